@@ -19,6 +19,10 @@
 // unmute them. Button 2 press will cause the system to go to test mode. In this
 // mode the tactors are buzzed one by one. Pressing it again will go back to the
 // microphone mode.
+//
+// When the sleeve reports that it is short of CPU headroom, the puck runs the
+// costly processing stages itself and sends tactile features rather than
+// audio, see tactile/processing_split.h.
 
 #include "analog_external_mic.h"
 #include "ble_com.h"
@@ -26,9 +30,12 @@
 #include "dsp/channel_map.h"
 #include "dsp/serialize.h"
 #include "serial_com.h"
+#include "tactile/deadline_monitor.h"
 #include "tactile/envelope_tracker.h"
+#include "tactile/processing_split.h"
 #include "tactile/tactile_pattern.h"
 #include "tactile/tuning.h"
+#include "tactile_processor_cpp.h"
 #include "two_wire.h"
 #include "ui.h"
 
@@ -53,7 +60,16 @@ ChannelMap g_channel_map;
 
 Message g_pending_message;
 
+// Runs the costly processing stages when the split selects the puck.
+TactileProcessorWrapper g_tactile_processor;
+// Measures the puck's load, to compare with the sleeve's kDeadlineStats.
+DeadlineMonitor g_deadline_monitor;
+// Chooses whether the puck or the sleeve runs the costly stages.
+ProcessingSplitSelector g_split_selector;
+
 constexpr int kStepSizeNavSwitchTune = 10;
+// Decimation factor of the sleeve's tactile processing.
+constexpr int kTactileDecimationFactor = 8;
 
 void RunEnvelopeTracker();
 void LoopTestMode();
@@ -61,6 +77,7 @@ void LoopMicMode();
 void AdcNewData();
 void TouchEvent();
 void OnBleEvent();
+void OnSerialEvent();
 
 void setup() {
   // Set custom pwm values for testing with sin wave.
@@ -79,6 +96,18 @@ void setup() {
   // SAADC sample rate in Hz.
   constexpr float kSaadcSampleRateHz = 15625.0f;
   EnvelopeTrackerInit(&g_envelope_tracker, kSaadcSampleRateHz);
+  g_tactile_processor.Init(kSaadcSampleRateHz, kAdcDataSize,
+                           kTactileDecimationFactor);
+  // The processing budget is the buffer period, in CPU cycles.
+  DeadlineMonitorInit(&g_deadline_monitor,
+                      static_cast<uint32_t>(
+                          (static_cast<uint64_t>(SystemCoreClock) *
+                           kAdcDataSize) / kSaadcSampleRateHz));
+  // Start with the sleeve running everything. The moved stages are initially
+  // estimated at 30% of the buffer period, and switching must lower the max
+  // load of the two devices by at least 10%.
+  ProcessingSplitSelectorInit(&g_split_selector, kProcessingSplitSleeve, 0.3f,
+                              0.1f);
 
   // Set LED as output.
   nrf_gpio_cfg_output(kLedPin);
@@ -94,7 +123,7 @@ void setup() {
   PuckUi.OnUiEventListener(TouchEvent);
   ExternalAnalogMic.Initialize();
   ExternalAnalogMic.OnAdcDataReady(AdcNewData);
-  SerialCom.InitPuck(+[] {} /* Pass do-nothing callback. */);
+  SerialCom.InitPuck(OnSerialEvent);
   BleCom.Init("Audio-to-Tactile puck", OnBleEvent);
 
   // Tell the sleeve to turn on the amplifiers.
@@ -169,22 +198,51 @@ void RunEnvelopeTracker() {
   }
 }
 
+void WriteTactileFeatures() {
+  float samples[kAdcDataSize];
+  const float scale = TuningGetInputGain(&g_tuning_knobs) / 2048.0f;
+  for (int i = 0; i < kAdcDataSize; ++i) {
+    samples[i] = scale * g_analog_mic_data[i];
+  }
+  float envelopes[kTactileFeaturesNumEnvelopeCodes];
+  float hex_weights[kTactileFeaturesNumHexCodes];
+  g_tactile_processor.ComputeFeatures(samples, envelopes, hex_weights);
+
+  uint8_t envelope_codes[kTactileFeaturesNumEnvelopeCodes];
+  uint8_t hex_codes[kTactileFeaturesNumHexCodes];
+  TactileFeaturesEncode(envelopes, g_tactile_processor.GetOutputBlockSize(),
+                        hex_weights, envelope_codes, hex_codes);
+  SerialCom.tx_message().WriteTactileFeatures(
+      Slice<const uint8_t, kTactileFeaturesNumEnvelopeCodes>(envelope_codes),
+      Slice<const uint8_t, kTactileFeaturesNumHexCodes>(hex_codes));
+}
+
 void LoopMicMode() {
+  DeadlineMonitorStartBuffer(&g_deadline_monitor);
   RunEnvelopeTracker();
 
   // There will be gaps in audio processing vs. other messages.
   if (g_pending_message.type() != MessageType::kNone) {
+    if (g_pending_message.type() == MessageType::kTuning) {
+      // Tuning also applies to the puck's share of the processing.
+      g_tactile_processor.ApplyTuning(g_tuning_knobs);
+    }
     SerialCom.tx_message() = g_pending_message;
     g_pending_message.set_type(MessageType::kNone);
   } else if (g_amps_enabled) {
-    SerialCom.tx_message().WriteAudioSamples(
-        Slice<const int16_t, kAdcDataSize>(g_analog_mic_data));
+    if (g_split_selector.split == kProcessingSplitPuck) {
+      WriteTactileFeatures();
+    } else {
+      SerialCom.tx_message().WriteAudioSamples(
+          Slice<const int16_t, kAdcDataSize>(g_analog_mic_data));
+    }
   } else {
     SerialCom.tx_message().WriteDisableAmplifiers();
   }
 
   SerialCom.SendTxMessage();
   g_new_mic_data = false;
+  DeadlineMonitorFinishBuffer(&g_deadline_monitor);
 }
 
 void LoopTestMode() {
@@ -274,6 +332,33 @@ void TouchEvent() {
   }
 }
 
+// Updates the processing split from the sleeve's deadline stats.
+void UpdateProcessingSplit(const DeadlineMonitorStats& sleeve_stats) {
+  DeadlineMonitorStats puck_stats;
+  DeadlineMonitorGetStats(&g_deadline_monitor, &puck_stats);
+  const int split = g_split_selector.split;
+  if (ProcessingSplitSelectorUpdate(&g_split_selector, &puck_stats,
+                                    &sleeve_stats) != split) {
+    // Restart the puck's stats for the new split. Its processor state is
+    // stale if the sleeve ran the costly stages, so reset it.
+    DeadlineMonitorReset(&g_deadline_monitor);
+    g_tactile_processor.Reset();
+    Serial.println(g_split_selector.split == kProcessingSplitPuck
+                       ? "Split: puck computes features."
+                       : "Split: sleeve processes audio.");
+  }
+}
+
+void OnSerialEvent() {
+  if (SerialCom.event() != SerialEvent::kMessageReceived) { return; }
+  const Message& message = SerialCom.rx_message();
+  DeadlineMonitorStats sleeve_stats;
+  if (message.type() == MessageType::kDeadlineStats &&
+      message.ReadDeadlineStats(&sleeve_stats)) {
+    UpdateProcessingSplit(sleeve_stats);
+  }
+}
+
 void OnBleEvent() {
   switch (BleCom.event()) {
     case BleEvent::kConnect:
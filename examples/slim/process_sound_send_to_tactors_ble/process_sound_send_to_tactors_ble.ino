@@ -46,12 +46,25 @@
 // (9)---(1)---(2)---(0)----(4)---( 5)---(8)---(3)  << Tactile processor number
 //
 // where bb is baseband. The rightmost tactor with ih is disabled.
+//
+// Subsystems are built lazily on first use rather than at boot: the PDM mic
+// driver once PDM input is selected, the TactileProcessor and envelope tracker
+// on the first mic buffer, TactilePattern on the first pattern, and tap-out on
+// the first tap-out message. Mode-specific subsystems are laid out in
+// g_mode_arena, a UnionArena shared by mutually exclusive modes.
 
 #include <algorithm>
 
 #include "analog_external_mic.h"
+#include "background_adc.h"
 #include "battery_monitor.h"
 #include "ble_com.h"
+#include "cpp/clock_sync.h"
+#include "cpp/deferred_log.h"
+#include "cpp/latency.h"
+#include "cpp/timed_playout.h"
+#include "cpp/union_arena.h"
+#include "cpp/warm_state.h"
 #include "dsp/datestamp.h"
 #include "dsp/serialize.h"
 #include "flash_settings.h"
@@ -60,7 +73,9 @@
 #include "post_processor_cpp.h"
 #include "pwm_sleeve.h"
 #include "tactile/envelope_tracker.h"
+#include "tactile/profiler.h"
 #include "tactile/tactile_pattern.h"
+#include "tactile/tactile_pattern_library.h"
 #include "tactile/tap_out.h"
 #include "tactile_processor_cpp.h"
 #include "temperature_monitor.h"
@@ -69,12 +84,16 @@
 using namespace audio_tactile;
 
 // Compile time constants.
-constexpr int kTactileDecimationFactor = 8;
 constexpr int kSaadcSampleRateHz = 15625;
-constexpr int kCarlBlockSize = 64;
 constexpr int kPwmSamplesAllChannels = kNumPwmValues * kNumTotalPwm;
-constexpr int kTactileFramesPerCarlBlock =
-    kCarlBlockSize / kTactileDecimationFactor;
+// Duration of one PWM sequence of kNumPwmValues samples at 2 kHz.
+constexpr uint32_t kPwmBlockPeriodUs = 4000;
+
+// Mic block size, TactileProcessor block size, and decimation factor, selected
+// by g_settings.latency.
+static LatencyConfig g_latency;
+// Estimated end-to-end latency in milliseconds for g_latency.
+static float g_latency_ms = 0.0f;
 
 static uint8_t g_which_pwm_module_triggered;
 
@@ -85,6 +104,14 @@ static int16_t g_mic_data[kAdcDataSize];
 // Buffer of input audio as floats in [-1, 1].
 static float g_audio_input[kAdcDataSize];
 
+// Storage for the subsystems of the current mode. Currently the only mode is
+// mic input to TactileProcessor, which needs about 20 KB at the default latency
+// profile; subsystems of other, mutually exclusive modes would claim the same
+// storage under a different owner id.
+UnionArena<32768> g_mode_arena;
+enum { kArenaOwnerTactileProcessor = 1 };
+
+// Built lazily on the first mic buffer, see GetTactileProcessor().
 TactileProcessorWrapper g_tactile_processor;
 PostProcessorWrapper g_post_processor;
 
@@ -98,6 +125,12 @@ constexpr int kSettingsWriteDelaySeconds = 15;
 constexpr int kSettingsWriteDelayCycles =
   (kSettingsWriteDelaySeconds * 2 + 4) / 5;
 
+// Interval in seconds between saving the processors' warm state to flash, so
+// that after a reboot they resume without warming up.
+constexpr int kWarmStateWriteIntervalSeconds = 300;
+constexpr int kWarmStateWriteIntervalCycles =
+  (kWarmStateWriteIntervalSeconds * 2 + 4) / 5;
+
 bool g_initialize_pwm = false;
 bool g_low_battery = false;
 int g_low_battery_counter = 0;
@@ -110,30 +143,72 @@ bool g_measure_temperature = false;
 
 // Whether BLE is currently connected.
 bool g_ble_connected = false;
-// Input audio envelope tracker.
+
+// Synchronization of micros() to the streaming app's clock, so that several
+// devices play kTimedTactorsSamples blocks at the same time.
+ClockSync g_clock_sync;
+// Set by OccasionalTasks() to send a kClockSyncRequest from loop().
+bool g_send_clock_sync_request = false;
+// Blocks received in kTimedTactorsSamples messages, pushed in the BLE handler
+// and played in OnPwmSequenceEnd().
+TimedPlayout<uint8_t, kPwmSamplesAllChannels, 16> g_timed_playout;
+// Input audio envelope tracker, initialized on the first mic buffer.
 EnvelopeTracker g_envelope_tracker;
+bool g_envelope_tracker_initialized = false;
 
-// Tactile pattern synthesizer.
+// Tactile pattern synthesizer. Use GetTactilePattern(), which initializes it on
+// first use.
 TactilePattern g_tactile_pattern;
+bool g_tactile_pattern_initialized = false;
 // True when a tactile pattern is active.
 bool g_tactile_pattern_active = false;
 
-// Pointer to the tactile output buffer of g_tactile_processor.
-static float* g_tactile_output;
+// Library of patterns uploaded with kTactilePatternChunk messages and played
+// with kPlayTactilePattern, stored in the patterns.bin flash file. Each slot is
+// one 1 KB emulated page, so the file is at most 16 KB.
+constexpr int kPatternLibraryPageSize = 1024;
+TactilePatternLibrary g_pattern_library;
+bool g_pattern_library_initialized = false;
+
+// Pointer to the tactile output buffer of g_tactile_processor, or nullptr
+// until it is built.
+static float* g_tactile_output = nullptr;
 
 SoftwareTimer g_occasional_tasks_timer;
 int g_measure_sensors_counter = 0;
 int g_write_settings_countdown = -1;
+int g_write_warm_state_countdown = kWarmStateWriteIntervalCycles;
 
 constexpr bool kTapOutEnabled = true;
+// Whether SetupTapOut() has been called, on the first received tap-out bytes.
+bool g_tap_out_initialized = false;
 struct {
   TapOutToken mic_input;
   TapOutToken carl_features;
   TapOutToken smoothed_energy;
   TapOutToken noise_energy;
   TapOutToken tactile_output;
+  TapOutToken profile;
 } g_tokens;
 
+// Profiled processing stages. Profiling stats are streamed over tap-out. The
+// ChannelMap is fused with the PWM update in OnPwmSequenceEnd(), so they are
+// measured together as one stage.
+enum {
+  kProfileTactileProcessor,
+  kProfilePostProcessor,
+  kProfileChannelMapPwmUpdate,
+  kNumProfileStages,
+};
+// Number of mic buffers per window of profiling stats.
+constexpr int kProfileWindowBuffers = 64;
+Profiler g_profiler;
+
+// Log of runtime events, recorded in binary without blocking and drained to
+// serial in loop(). Decode with extras/tools/decode_deferred_log.py. Set
+// DEFERRED_LOG_MIN_LEVEL to compile out lower levels.
+DeferredLog<64> g_log;
+
 #if defined(kPdmSelectPin) && defined(kTactileSwitchPin)
 #define SELECTABLE_MIC 1
 
@@ -149,20 +224,20 @@ void OnBleEvent();
 void OnPdmNewData();
 void OccasionalTasks(TimerHandle_t);
 void SetupTapOut();
+TactileProcessorWrapper* GetTactileProcessor();
+void ApplyChannelMap();
+TactilePattern* GetTactilePattern();
+void InitializePatternLibrary();
+void InitializePdmMic();
+bool g_pdm_mic_initialized = false;
+void ReadWarmState();
+void WriteWarmState();
 
 void setup() {
   // Set the indicator led pin to output.
   nrf_gpio_cfg_output(kLedPinBlue);
   nrf_gpio_cfg_output(kLedPinGreen);
 
-#ifdef kPdmSelectPin
-  // Initialize mics, start the PDM mic by default.
-  nrf_gpio_cfg_output(kPdmSelectPin);
-  nrf_gpio_pin_write(kPdmSelectPin, 0);
-  OnBoardMic.Initialize(kPdmClockPin, kPdmDataPin);
-  OnBoardMic.OnPdmDataReady(OnPdmNewData);
-#endif  // kPdmSelectPin
-
   ExternalAnalogMic.OnAdcDataReady(OnAnalogNewData);
   ExternalAnalogMic.Initialize();
   ExternalAnalogMic.Disable();
@@ -190,25 +265,6 @@ void setup() {
     /*source=*/{9, 1, 2, 0, 4, 5, 8, 3, 8, 9},
   };
 
-  // Initialize tactile processor.
-  g_tactile_processor.Init(kSaadcSampleRateHz, kCarlBlockSize,
-                           kTactileDecimationFactor);
-  constexpr float kDefaultGain = 10.0f;
-  g_post_processor.Init(g_tactile_processor.GetOutputSampleRate(),
-                        g_tactile_processor.GetOutputBlockSize(),
-                        g_tactile_processor.GetOutputNumberTactileChannels(),
-                        kDefaultGain);
-
-  EnvelopeTrackerInit(&g_envelope_tracker, kSaadcSampleRateHz);
-
-  TactilePatternInit(&g_tactile_pattern,
-                     g_tactile_processor.GetOutputSampleRate(),
-                     g_tactile_processor.GetOutputNumberTactileChannels());
-  TactilePatternStart(&g_tactile_pattern, kTactilePatternConfirm);
-  g_tactile_pattern_active = true;
-
-  SetupTapOut();
-
   Serial.println("Firmware built " __DATE__);
 
   // Initialize flash and read settings file.
@@ -226,20 +282,39 @@ void setup() {
         "Flash file system found, but did not find " kFlashSettingsFile
         "; using default settings.");
   }
+  InitializePatternLibrary();
 
-  // Apply tuning read from settings file.
-  g_tactile_processor.ApplyTuning(g_settings.tuning);
+  // Select block sizes for the latency profile read from settings file.
+  g_latency = GetLatencyConfig(g_settings.latency);
+  g_latency_ms = EstimateLatencyMs(g_latency, kSaadcSampleRateHz);
+  ExternalAnalogMic.SetBlockSize(g_latency.mic_block_size);
+
+  // The TactileProcessor is built on the first mic buffer, but the post
+  // processor is needed for tactile patterns as well, so it is built now.
+  constexpr float kDefaultGain = 10.0f;
+  g_post_processor.Init(
+      static_cast<float>(kSaadcSampleRateHz) / g_latency.decimation_factor,
+      g_latency.carl_block_size / g_latency.decimation_factor,
+      kTactileProcessorNumTactors, kDefaultGain);
+  ApplyChannelMap();
+
+  TactilePatternStart(GetTactilePattern(), kTactilePatternConfirm);
+  g_tactile_pattern_active = true;
+
+  ProfilerInit(&g_profiler, kNumProfileStages, kProfileWindowBuffers);
 
   // Force analog mic if input is not selectable on this device.
 #if !SELECTABLE_MIC
   g_settings.input = InputSelection::kAnalogMic;
 #endif  // SELECTABLE_MIC
-  // Make sure to fire interrupt handler for only one mic.
+  // Make sure to fire interrupt handler for only one mic. The PDM mic driver is
+  // only initialized if that input is selected.
   if (g_settings.input == InputSelection::kAnalogMic) {
     ExternalAnalogMic.Enable();
-    OnBoardMic.Disable();
   } else {
+    InitializePdmMic();
     OnBoardMic.Enable();
+    StartBackgroundAdc();
   }
 
   // Use a default name if device_name hasn't been set or is empty.
@@ -251,6 +326,12 @@ void setup() {
   // Initialize PWM.
   SleeveTactors.OnSequenceEnd(OnPwmSequenceEnd);
   SleeveTactors.Initialize();
+  if (g_settings.latency != LatencyProfile::kDefault) {
+    // Each block of tactile output fills one PWM sequence of kNumPwmValues
+    // frames. Upsampling by the decimation factor shortens the sequence along
+    // with the TactileProcessor block, so the ping-pong swaps more often.
+    SleeveTactors.SetUpsamplingFactor(g_latency.decimation_factor);
+  }
   // Turn the tactor amplifiers off initially, otherwise they buzz arbitrarly
   // while the system is still starting up.
   SleeveTactors.DisableAmplifiers();
@@ -263,6 +344,7 @@ void setup() {
   nrf_pwm_task_trigger(NRF_PWM2, NRF_PWM_TASK_SEQSTART0);
 
   // Set the timer to sample sensors on multiples of 2.5 seconds
+  g_timed_playout.Init(kPwmBlockPeriodUs);
   g_occasional_tasks_timer.begin(2500, OccasionalTasks);
   g_occasional_tasks_timer.start();
 
@@ -273,30 +355,36 @@ void HandleMessage(const Message& message) {
   switch (message.type()) {
     case MessageType::kGetOnConnectionBatch:
       // Request to get on-connection batch message.
-      Serial.println("Message: GetOnConnectionBatch.");
+      DEFERRED_LOG_INFO(g_log, "Message: GetOnConnectionBatch.");
       BleCom.tx_message().WriteOnConnectionBatch(
           /*firmware_build_date=*/DATESTAMP_UINT32,
           /*battery_v=*/g_latest_battery_v,
           /*temperature_c=*/g_latest_temperature_c,
           /*settings=*/g_settings);
+      BleCom.QueueTxMessage();
+      // Pack the latency estimate into the same notification.
+      BleCom.tx_message().WriteLatencyEstimate(g_latency_ms);
       BleCom.SendTxMessage();
       // Play "connect" pattern as UI feedback that connection is established.
-      TactilePatternStart(&g_tactile_pattern, kTactilePatternConnect);
+      TactilePatternStart(GetTactilePattern(), kTactilePatternConnect);
       g_tactile_pattern_active = true;
       break;
     case MessageType::kGetTuning:
       // Request message to get the current tuning knobs.
-      Serial.println("Message: GetTuning.");
+      DEFERRED_LOG_INFO(g_log, "Message: GetTuning.");
       BleCom.tx_message().WriteTuning(g_settings.tuning);
       BleCom.SendTxMessage();
       break;
     case MessageType::kTuning:
       // Message specifying new tuning knobs.
-      Serial.println("Message: Tuning.");
+      DEFERRED_LOG_INFO(g_log, "Message: Tuning.");
       if (message.ReadTuning(&g_settings.tuning)) {
-        g_tactile_processor.ApplyTuning(g_settings.tuning);
+        // If the processor isn't built yet, tuning is applied when it is.
+        if (g_tactile_processor.initialized()) {
+          g_tactile_processor.ApplyTuning(g_settings.tuning);
+        }
         // Play "confirm" pattern as UI feedback when new settings are applied.
-        TactilePatternStart(&g_tactile_pattern, kTactilePatternConfirm);
+        TactilePatternStart(GetTactilePattern(), kTactilePatternConfirm);
         g_tactile_pattern_active = true;
         // Settings were updated, so reset countdown to update flash settings.
         g_write_settings_countdown = kSettingsWriteDelayCycles;
@@ -305,47 +393,83 @@ void HandleMessage(const Message& message) {
     case MessageType::kTactilePattern: {
       // Message to play a (simple) tactile pattern.
       // TODO: Remove this message type and use extended patterns.
-      Serial.println("Message: TactilePattern.");
+      DEFERRED_LOG_INFO(g_log, "Message: TactilePattern.");
       char simple_pattern[kMaxTactilePatternLength + 1];
       if (message.ReadTactilePattern(simple_pattern)) {
-        TactilePatternStart(&g_tactile_pattern, simple_pattern);
+        TactilePatternStart(GetTactilePattern(), simple_pattern);
         g_tactile_pattern_active = true;
       }
     } break;
     case MessageType::kTactileExPattern: {
       // Message to play a tactile extended-format pattern.
-      Serial.println("Message: TactileExPattern.");
+      DEFERRED_LOG_INFO(g_log, "Message: TactileExPattern.");
       if (message.ReadTactileExPattern(Slice<uint8_t>(
-              g_tactile_pattern.buffer, kTactilePatternBufferSize))) {
+              GetTactilePattern()->buffer, kTactilePatternBufferSize))) {
         TactilePatternStartEx(&g_tactile_pattern, g_tactile_pattern.buffer);
         g_tactile_pattern_active = true;
       }
     } break;
+    case MessageType::kTactilePatternChunk: {
+      // Message with part of a pattern to store in the pattern library.
+      DEFERRED_LOG_INFO(g_log, "Message: TactilePatternChunk.");
+      int id;
+      int total_size;
+      int offset;
+      const uint8_t* data;
+      int data_size;
+      if (g_pattern_library_initialized &&
+          message.ReadTactilePatternChunk(&id, &total_size, &offset, &data,
+                                          &data_size)) {
+        const int status = TactilePatternLibraryWriteChunk(
+            &g_pattern_library, id, total_size, offset, data, data_size);
+        // Reply when the upload completes or fails.
+        if (status != kTactilePatternLibraryChunkAccepted) {
+          BleCom.tx_message().WriteTactilePatternUploadStatus(id, status);
+          BleCom.SendTxMessage();
+        }
+      }
+    } break;
+    case MessageType::kPlayTactilePattern: {
+      // Message to play a pattern from the pattern library.
+      DEFERRED_LOG_INFO(g_log, "Message: PlayTactilePattern.");
+      int id;
+      if (g_pattern_library_initialized &&
+          message.ReadPlayTactilePattern(&id)) {
+        const uint8_t* pattern =
+            TactilePatternLibraryGet(&g_pattern_library, id);
+        if (pattern != nullptr) {
+          TactilePatternStartEx(GetTactilePattern(), pattern);
+          g_tactile_pattern_active = true;
+        }
+      }
+    } break;
     case MessageType::kGetChannelMap:
       // Request message to get the current channel map.
-      Serial.println("Message: GetChannelMap.");
+      DEFERRED_LOG_INFO(g_log, "Message: GetChannelMap.");
       BleCom.tx_message().WriteChannelMap(g_settings.channel_map);
       BleCom.SendTxMessage();
       break;
     case MessageType::kChannelMap:
       // Message specifying a new channel map.
-      Serial.println("Message: ChannelMap.");
+      DEFERRED_LOG_INFO(g_log, "Message: ChannelMap.");
       message.ReadChannelMap(&g_settings.channel_map,
                              kTactileProcessorNumTactors,
                              kTactileProcessorNumTactors);
+      ApplyChannelMap();
       // Reset countdown to update flash settings.
       g_write_settings_countdown = kSettingsWriteDelayCycles;
       break;
     case MessageType::kChannelGainUpdate: {
-      Serial.println("Message: ChannelGainUpdate.");
+      DEFERRED_LOG_INFO(g_log, "Message: ChannelGainUpdate.");
       int tactors[2];
       if (message.ReadChannelGainUpdate(&g_settings.channel_map, tactors,
                                         kTactileProcessorNumTactors,
                                         kTactileProcessorNumTactors)) {
+        ApplyChannelMap();
         // Map tactors to channel indices.
         const int ref_channel = g_settings.channel_map.sources[tactors[0]];
         const int test_channel = g_settings.channel_map.sources[tactors[1]];
-        TactilePatternStartCalibrationTones(&g_tactile_pattern,
+        TactilePatternStartCalibrationTones(GetTactilePattern(),
                                             ref_channel, test_channel);
         g_tactile_pattern_active = true;
         // Reset countdown to update flash settings.
@@ -353,15 +477,16 @@ void HandleMessage(const Message& message) {
       }
       } break;
     case MessageType::kCalibrateTactor: {
-      Serial.println("Message: CalibrateTactor.");
+      DEFERRED_LOG_INFO(g_log, "Message: CalibrateTactor.");
       int tactors[2];
       float calibration_amplitude;
       if (message.ReadCalibrateTactor(&g_settings.channel_map, tactors,
                                       &calibration_amplitude)) {
+        ApplyChannelMap();
         // Map tactors to channel indices.
         const int ref_channel = g_settings.channel_map.sources[tactors[0]];
         const int test_channel = g_settings.channel_map.sources[tactors[1]];
-        TactilePatternStartCalibrationTonesThresholds(&g_tactile_pattern,
+        TactilePatternStartCalibrationTonesThresholds(GetTactilePattern(),
                                                       ref_channel, test_channel,
                                                       calibration_amplitude);
         g_tactile_pattern_active = true;
@@ -370,7 +495,7 @@ void HandleMessage(const Message& message) {
       }
       } break;
     case MessageType::kDeviceName:
-      Serial.println("Message: DeviceName.");
+      DEFERRED_LOG_INFO(g_log, "Message: DeviceName.");
       if (message.ReadDeviceName(g_settings.device_name)) {
         Serial.print("New device name: \"");
         Serial.print(g_settings.device_name);
@@ -380,36 +505,55 @@ void HandleMessage(const Message& message) {
       }
       break;
     case MessageType::kGetDeviceName:
-      Serial.println("Message: GetDeviceName.");
+      DEFERRED_LOG_INFO(g_log, "Message: GetDeviceName.");
       BleCom.tx_message().WriteDeviceName(g_settings.device_name);
       BleCom.SendTxMessage();
       break;
+    case MessageType::kClockSyncResponse: {
+      const uint32_t t4 = micros();
+      uint32_t t1, t2, t3;
+      if (message.ReadClockSyncResponse(&t1, &t2, &t3)) {
+        g_clock_sync.OnResponse(t1, t2, t3, t4);
+      }
+    } break;
+    case MessageType::kTimedTactorsSamples: {
+      uint32_t presentation_us;
+      uint8_t samples[kPwmSamplesAllChannels];
+      // Blocks are dropped until the clock is synchronized.
+      if (message.ReadTimedTactorsSamples(&presentation_us, samples) &&
+          g_clock_sync.synced()) {
+        g_timed_playout.Push(samples,
+                             g_clock_sync.ReferenceToLocal(presentation_us));
+      }
+    } break;
     case MessageType::kPrepareForBluetoothBootloading:
       // Turn off all interrupts, so they don't interfere with bootloading.
-      Serial.println("Message: kPrepareForOtaBootloading.");
+      DEFERRED_LOG_INFO(g_log, "Message: kPrepareForOtaBootloading.");
       SleeveTactors.DisableAmplifiers();
       SleeveTactors.DisablePwm();
       g_occasional_tasks_timer.stop();
       // Disable onboard or/and external mic.
       ExternalAnalogMic.Disable();
-      OnBoardMic.Disable();
+      if (g_pdm_mic_initialized) { OnBoardMic.Disable(); }
       break;
     default:
-      Serial.println("Unhandled message.");
+      DEFERRED_LOG_WARNING(g_log, "Unhandled message type %d.",
+                           message.type());
       break;
   }
 }
 
 void SetupTapOut() {
+  g_tap_out_initialized = true;
   TapOutSetTxFun([](const char* data, int size) { Serial.write(data, size); });
 
   static const TapOutDescriptor kMicInputDescriptor =
-      {"mic_input", "int16", 1, {kAdcDataSize}};
+      {"mic_input", "int16", 1, {g_latency.mic_block_size}};
   g_tokens.mic_input = TapOutAddDescriptor(&kMicInputDescriptor);
 
   static const TapOutDescriptor kCarlFeaturesDescriptor =
       {"carl_features", "float", 2,
-        {1, CarlFrontendNumChannels(g_tactile_processor.get()->frontend)}};
+        {1, CarlFrontendNumChannels(GetTactileProcessor()->get()->frontend)}};
   g_tokens.carl_features = TapOutAddDescriptor(&kCarlFeaturesDescriptor);
 
   static const TapOutDescriptor kSmoothedEnergyDescriptor =
@@ -423,6 +567,10 @@ void SetupTapOut() {
   static const TapOutDescriptor kTactileOutputDescriptor =
       {"tactile_output", "uint8", 2, {kNumPwmValues, 8}};
   g_tokens.tactile_output = TapOutAddDescriptor(&kTactileOutputDescriptor);
+
+  static const TapOutDescriptor kProfileDescriptor =
+      {"profile", "uint32", 3, {1, kNumProfileStages, 3}};
+  g_tokens.profile = TapOutAddDescriptor(&kProfileDescriptor);
 }
 
 void CaptureTapOutData() {
@@ -473,11 +621,22 @@ void CaptureTapOutData() {
     }
   }
 
+  if ((slice = TapOutGetSlice(g_tokens.profile)) != nullptr) {
+    ProfilerWriteStats(&g_profiler, slice->data);
+  }
+
   TapOutFinishedCaptureBuffer();
 }
 
 void loop() {
-  if (g_measure_battery) {
+  if (g_measure_battery && MonitorAdc.is_running()) {
+    // Use the latest reading sampled in the background.
+    g_latest_battery_v =
+        PuckBatteryMonitor.ConvertBatteryVoltageToFloat(MonitorAdc.latest(0));
+    BleCom.tx_message().WriteBatteryVoltage(g_latest_battery_v);
+    BleCom.SendTxMessage();
+    g_measure_battery = false;
+  } else if (g_measure_battery) {
     if (g_settings.input == InputSelection::kAnalogMic) {
       ExternalAnalogMic.Disable();
     }
@@ -494,7 +653,14 @@ void loop() {
     g_measure_battery = false;
   }
 
-  if (g_measure_temperature) {
+  if (g_measure_temperature && MonitorAdc.is_running()) {
+    g_latest_temperature_c =
+        SleeveTemperatureMonitor.ConvertAdcSampleToTemperature(
+            MonitorAdc.latest(1));
+    BleCom.tx_message().WriteTemperature(g_latest_temperature_c);
+    BleCom.SendTxMessage();
+    g_measure_temperature = false;
+  } else if (g_measure_temperature) {
     if (g_settings.input == InputSelection::kAnalogMic) {
       ExternalAnalogMic.Disable();
     }
@@ -514,27 +680,49 @@ void loop() {
 
   if (g_write_settings_countdown == 0) {
     g_write_settings_countdown = -1;
-    if (!FlashSettings.have_file_system()) {
-      BleCom.tx_message().WriteFlashWriteStatus(kFlashWriteErrorNotFormatted);
-      BleCom.SendTxMessage();
-    } else {
-      if (FlashSettings.WriteSettingsFile(g_settings)) {
-        BleCom.tx_message().WriteFlashWriteStatus(kFlashWriteSuccess);
-        BleCom.SendTxMessage();
-      } else {
-        // TODO: Extract and handle flash memory error codes.
-        BleCom.tx_message().WriteFlashWriteStatus(kFlashWriteUnkownError);
-        BleCom.SendTxMessage();
-      }
-    }
+    // Write in the background so that audio processing isn't stalled.
+    FlashSettings.QueueWriteSettingsFile(g_settings);
+  }
+
+  int flash_write_status;
+  if (FlashSettings.TakeWriteStatus(&flash_write_status)) {
+    // TODO: Extract and handle flash memory error codes.
+    BleCom.tx_message().WriteFlashWriteStatus(flash_write_status);
+    BleCom.SendTxMessage();
+  }
+
+  if (g_send_clock_sync_request && g_ble_connected) {
+    BleCom.tx_message().WriteClockSyncRequest(micros());
+    BleCom.SendTxMessage();
+    g_send_clock_sync_request = false;
+  }
+
+  if (g_write_warm_state_countdown == 0) {
+    g_write_warm_state_countdown = kWarmStateWriteIntervalCycles;
+    WriteWarmState();
   }
 
   if (kTapOutEnabled && Serial.available() > 0) {
     char data[16];
     int size = std_shim::min<int>(Serial.available(), sizeof(data));
     Serial.readBytes(data, size);
+    if (!g_tap_out_initialized) { SetupTapOut(); }
     TapOutReceiveMessage(data, size);
   }
+  if (kTapOutEnabled && TapOutRingSize() > 0) {
+    // Send ring-buffered tap_out data without blocking.
+    TapOutService(Serial.availableForWrite());
+  }
+  if (!g_tap_out_initialized) {
+    // Drain log records while serial has room. Tap-out owns the port once
+    // started, since its host tool doesn't expect log frames.
+    uint8_t frame[decltype(g_log)::kMaxFrameSize];
+    while (Serial.availableForWrite() >= static_cast<int>(sizeof(frame))) {
+      const int size = g_log.DrainFrame(frame);
+      if (size == 0) { break; }
+      Serial.write(frame, size);
+    }
+  }
 
   if (g_new_mic_data) {
     // Handle low battery voltage.
@@ -545,7 +733,7 @@ void loop() {
       if (g_low_battery_counter > 10) {
         // If the battery is low for more than 10 consecutive buffers, play a
         // tactile pattern to warn that the battery is low.
-        TactilePatternStart(&g_tactile_pattern, "  A66   88   88  ");
+        TactilePatternStart(GetTactilePattern(), "  A66   88   88  ");
         g_tactile_pattern_active = true;
         // Don't play the warning pattern again for 500 buffers.
         g_low_battery_counter = -500;
@@ -565,13 +753,20 @@ void loop() {
       scale /= 32768.0f;
     }
 
-    for (int i = 0; i < kAdcDataSize; ++i) {
+    for (int i = 0; i < g_latency.mic_block_size; ++i) {
       g_audio_input[i] = scale * g_mic_data[i];
     }
 
+    // Build the processing on the first buffer.
+    GetTactileProcessor();
+    if (!g_envelope_tracker_initialized) {
+      EnvelopeTrackerInit(&g_envelope_tracker, kSaadcSampleRateHz);
+      g_envelope_tracker_initialized = true;
+    }
+
     // Track the envelope of the input audio.
     if (EnvelopeTrackerProcessSamples(&g_envelope_tracker, g_audio_input,
-                                      kAdcDataSize) &&
+                                      g_latency.mic_block_size) &&
         g_ble_connected) {
       BleCom.tx_message().WriteStatsRecord(g_envelope_tracker);
       BleCom.SendTxMessage();
@@ -579,13 +774,18 @@ void loop() {
     // Play synthesized tactile pattern if a pattern is active.
     if (g_tactile_pattern_active) {
       g_tactile_pattern_active = TactilePatternSynthesize(
-          &g_tactile_pattern, g_tactile_processor.GetOutputBlockSize(),
+          GetTactilePattern(), g_tactile_processor.GetOutputBlockSize(),
           g_tactile_output);
     } else {
       // Process samples.
+      ProfilerStart(&g_profiler, kProfileTactileProcessor);
       g_tactile_output = g_tactile_processor.ProcessSamples(g_audio_input);
+      ProfilerStop(&g_profiler, kProfileTactileProcessor);
     }
+    ProfilerStart(&g_profiler, kProfilePostProcessor);
     g_post_processor.PostProcessSamples(g_tactile_output);
+    ProfilerStop(&g_profiler, kProfilePostProcessor);
+    ProfilerFinishedBuffer(&g_profiler);
 
     if (kTapOutEnabled && TapOutIsActive()) {
       CaptureTapOutData();
@@ -597,7 +797,7 @@ void loop() {
 
   // Notify the user about switching to a different mic.
   if (g_notify_mic_switch) {
-    TactilePatternStart(&g_tactile_pattern, kTactilePatternConnect);
+    TactilePatternStart(GetTactilePattern(), kTactilePatternConnect);
     g_tactile_pattern_active = true;
 
     // Flash blue LED for analog mic, green LED for PDM mic.
@@ -626,7 +826,19 @@ void OnPdmNewData() {
 void OnPwmSequenceEnd() {
   g_which_pwm_module_triggered = SleeveTactors.GetEvent();
 
-  if (g_tactor_processor_on && g_which_pwm_module_triggered == 0) {
+  // Timed blocks from the app take precedence over the processor output.
+  if (g_which_pwm_module_triggered == 0) {
+    uint8_t samples[kPwmSamplesAllChannels];
+    if (g_timed_playout.Pop(micros(), samples)) {
+      SleeveTactors.UpdatePwmAllChannelsByte(samples);
+      return;
+    }
+  }
+
+  // Nothing to play until the first mic buffer builds the processor.
+  if (g_tactor_processor_on && g_which_pwm_module_triggered == 0 &&
+      g_tactile_output != nullptr) {
+    ProfilerStart(&g_profiler, kProfileChannelMapPwmUpdate);
     constexpr int kNumChannels = 12;
     // Hardware channel `c` plays logical channel kHwToLogical[c]. Value -1
     // means that nothing is played on that channel.
@@ -656,6 +868,7 @@ void OnPwmSequenceEnd() {
       SleeveTactors.UpdateChannelWithGain(c, gain, src,
                                           kTactileProcessorNumTactors);
     }
+    ProfilerStop(&g_profiler, kProfileChannelMapPwmUpdate);
   }
 }
 
@@ -673,12 +886,13 @@ void FlashLeds() {
 void OnBleEvent() {
   switch (BleCom.event()) {
     case BleEvent::kConnect:
-      Serial.println("BLE: Connected.");
+      DEFERRED_LOG_INFO(g_log, "BLE: Connected.");
       g_ble_connected = true;
       break;
     case BleEvent::kDisconnect:
-      Serial.println("BLE: Disconnected.");
+      DEFERRED_LOG_INFO(g_log, "BLE: Disconnected.");
       g_ble_connected = false;
+      g_clock_sync.Reset();
 
       // On BLE disconnect, write settings immediately if an update is pending.
       if (g_write_settings_countdown > 0) {
@@ -686,7 +900,7 @@ void OnBleEvent() {
       }
       break;
     case BleEvent::kInvalidMessage:
-      Serial.println("BLE: Invalid message.");
+      DEFERRED_LOG_WARNING(g_log, "BLE: Invalid message.");
       break;
     case BleEvent::kMessageReceived:
       HandleMessage(BleCom.rx_message());
@@ -694,6 +908,14 @@ void OnBleEvent() {
   }
 }
 
+// When the SAADC is free, i.e. with the PDM mic, sample battery voltage and
+// temperature in the background so that the loop doesn't busy wait on the ADC.
+void StartBackgroundAdc() {
+  const nrf_saadc_input_t inputs[2] = {PuckBatteryMonitor.adc_input(),
+                                       SleeveTemperatureMonitor.adc_input()};
+  MonitorAdc.Start(inputs, 2, /*interval_ms=*/1000);
+}
+
 void LowBatteryWarning() {
   g_low_battery = (PuckBatteryMonitor.GetEvent() == 0);
   nrf_gpio_pin_write(kLedPinBlue, g_low_battery ? 1 : 0);
@@ -704,14 +926,19 @@ void LowBatteryWarning() {
 void OnSwitchPress() {
   if (g_settings.input == InputSelection::kPdmMic) {
     g_settings.input = InputSelection::kAnalogMic;
-    Serial.println("Input: Analog mic selected");
+    DEFERRED_LOG_INFO(g_log, "Input: Analog mic selected");
     OnBoardMic.Disable();
+    // The analog mic needs the SAADC.
+    MonitorAdc.Stop();
+    ExternalAnalogMic.Initialize();
     ExternalAnalogMic.Enable();
   } else {
     g_settings.input = InputSelection::kPdmMic;
-    Serial.println("Input: PDM mic selected");
+    DEFERRED_LOG_INFO(g_log, "Input: PDM mic selected");
+    InitializePdmMic();
     OnBoardMic.Enable();
     ExternalAnalogMic.Disable();
+    StartBackgroundAdc();
   }
 
   // Write updated input selection to flash.
@@ -726,12 +953,15 @@ void OccasionalTasks(TimerHandle_t) {
   if (g_initialize_pwm) {
     // On first call, turn on tactor amplifiers and play a "start up" pattern.
     SleeveTactors.EnableAmplifiers();
-    TactilePatternStartEx(&g_tactile_pattern, kTactilePatternExStartUp);
+    TactilePatternStartEx(GetTactilePattern(), kTactilePatternExStartUp);
     g_tactile_pattern_active = true;
     g_initialize_pwm = false;
     return;
   }
 
+  // Resynchronize the clock every 2.5 seconds while connected.
+  g_send_clock_sync_request = true;
+
   // To avoid disrupting tap out recordings, we pause countdowns on the below
   // occasional tasks while tap out is actively recording.
   const bool tap_out_is_active = kTapOutEnabled && TapOutIsActive();
@@ -757,4 +987,121 @@ void OccasionalTasks(TimerHandle_t) {
     // Decrement countdown for writing settings to flash.
     --g_write_settings_countdown;
   }
+  if (!tap_out_is_active && g_write_warm_state_countdown > 0) {
+    --g_write_warm_state_countdown;
+  }
+}
+
+// Buffer for the warm state of g_tactile_processor followed by
+// g_post_processor.
+static float g_warm_state[kWarmStateMaxValues];
+
+void ReadWarmState() {
+  const int tactile_size = g_tactile_processor.WarmStateSize();
+  const int num_values = tactile_size + kPostProcessorWarmStateSize;
+  if (num_values <= kWarmStateMaxValues &&
+      FlashSettings.ReadWarmStateFile(g_warm_state, num_values) &&
+      g_tactile_processor.SetWarmState(g_warm_state) &&
+      g_post_processor.SetWarmState(g_warm_state + tactile_size)) {
+    Serial.println("Restored warm state from " kFlashWarmStateFile);
+  }
+}
+
+void WriteWarmState() {
+  // Nothing to save if the processor hasn't been built. Don't save while the
+  // enveloper is still warming up, e.g. just after tuning was changed.
+  if (!g_tactile_processor.initialized() ||
+      g_tactile_processor.get()->enveloper.warm_up_counter > 0) {
+    return;
+  }
+  const int tactile_size = g_tactile_processor.WarmStateSize();
+  const int num_values = tactile_size + kPostProcessorWarmStateSize;
+  if (num_values > kWarmStateMaxValues) { return; }
+  g_tactile_processor.GetWarmState(g_warm_state);
+  g_post_processor.GetWarmState(g_warm_state + tactile_size);
+  FlashSettings.QueueWriteWarmStateFile(g_warm_state, num_values);
+}
+
+// Gets the TactileProcessor, building it in g_mode_arena on first use. Tuning
+// from the settings file and the warm state saved before the last reboot are
+// applied as it is built.
+TactileProcessorWrapper* GetTactileProcessor() {
+  if (!g_mode_arena.Owns(kArenaOwnerTactileProcessor)) {
+    g_tactile_processor.Deinit();
+    Arena* arena = g_mode_arena.Claim(kArenaOwnerTactileProcessor);
+    if (!g_tactile_processor.InitInArena(arena, kSaadcSampleRateHz,
+                                         g_latency.carl_block_size,
+                                         g_latency.decimation_factor)) {
+      Serial.println("Error: TactileProcessor doesn't fit in g_mode_arena.");
+      while (true) {}
+    }
+    g_tactile_output = g_tactile_processor.output();
+    g_tactile_processor.ApplyTuning(g_settings.tuning);
+    g_tactile_processor.SetActiveTactors(
+        ChannelMapUsedInputs(&g_settings.channel_map));
+    // Restore warm state. This must come after ApplyTuning(), which resets the
+    // enveloper.
+    ReadWarmState();
+  }
+  return &g_tactile_processor;
+}
+
+// Skips computing tactile channels that g_settings.channel_map doesn't use,
+// e.g. with a partial tactor array. Call after changing the channel map.
+void ApplyChannelMap() {
+  const uint32_t used = ChannelMapUsedInputs(&g_settings.channel_map);
+  g_post_processor.SetActiveChannels(used);
+  // If the processor isn't built yet, this is applied when it is.
+  if (g_tactile_processor.initialized()) {
+    g_tactile_processor.SetActiveTactors(used);
+  }
+}
+
+// Gets the TactilePattern, initializing it on first use.
+TactilePattern* GetTactilePattern() {
+  if (!g_tactile_pattern_initialized) {
+    TactilePatternInit(
+        &g_tactile_pattern,
+        static_cast<float>(kSaadcSampleRateHz) / g_latency.decimation_factor,
+        kTactileProcessorNumTactors);
+    g_tactile_pattern_initialized = true;
+  }
+  return &g_tactile_pattern;
+}
+
+// Flash callbacks for g_pattern_library, backed by the patterns.bin file.
+void PatternLibraryRead(void*, uint32_t address, uint8_t* dest, int size) {
+  FlashSettings.ReadPatternLibrary(address, dest, size);
+}
+int PatternLibraryWrite(void*, uint32_t address, const uint8_t* src,
+                        int size) {
+  return FlashSettings.WritePatternLibrary(address, src, size);
+}
+int PatternLibraryErasePage(void*, uint32_t address) {
+  return FlashSettings.ErasePatternLibraryPage(address,
+                                               kPatternLibraryPageSize);
+}
+
+// Initializes g_pattern_library from flash, if there is a file system.
+void InitializePatternLibrary() {
+  if (!FlashSettings.have_file_system()) { return; }
+  const TactilePatternLibraryFlash flash = {
+      PatternLibraryRead, PatternLibraryWrite, PatternLibraryErasePage,
+      nullptr};
+  g_pattern_library_initialized = TactilePatternLibraryInit(
+      &g_pattern_library, &flash, /*base_address=*/0, kPatternLibraryPageSize,
+      kTactilePatternLibraryMaxPatterns);
+}
+
+// Initializes the PDM mic driver, if not already done.
+void InitializePdmMic() {
+#ifdef kPdmSelectPin
+  if (g_pdm_mic_initialized) { return; }
+  nrf_gpio_cfg_output(kPdmSelectPin);
+  nrf_gpio_pin_write(kPdmSelectPin, 0);
+  OnBoardMic.Initialize(kPdmClockPin, kPdmDataPin);
+  OnBoardMic.OnPdmDataReady(OnPdmNewData);
+  OnBoardMic.SetBlockSize(g_latency.mic_block_size);
+  g_pdm_mic_initialized = true;
+#endif  // kPdmSelectPin
 }
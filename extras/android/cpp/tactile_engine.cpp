@@ -0,0 +1,306 @@
+// Copyright 2022 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tactile_engine.h"  // NOLINT(build/include)
+
+#include <android/log.h>
+
+#include <errno.h>
+#include <time.h>
+
+#include <algorithm>
+#include <cstring>
+
+#include "cpp/message_packer.h"
+
+#define LOG_TAG "TactileEngine"
+#define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, __VA_ARGS__)
+
+namespace audio_tactile {
+namespace {
+
+// Number of sleeve tactors.
+constexpr int kNumSleeveTactors = 10;
+// When streaming, the sleeve plays kAllTactorsSamples channel `c` on hardware
+// channel `c`. Hardware channel `c` is logical tactor kHwToLogical[c], as in
+// extras/ses_apps/sleeve/sleeve_simple_app.cpp.
+constexpr int kHwToLogical[kNumSleeveTactors] = {5, 8, 0, 6, 4,
+                                                 7, 2, 1, 9, 3};
+
+// Converts a tactile sample in [-1, 1] to a byte, such that the sleeve's
+// 2 * byte matches Pwm::FloatToPwmSample().
+uint8_t FloatToByteSample(float sample) {
+  const float value = 127.5f * sample + 128.0f;
+  return static_cast<uint8_t>(std::min(std::max(value, 0.0f), 255.0f));
+}
+
+// Gets the CLOCK_REALTIME time `ms` milliseconds from now, for sem_timedwait.
+timespec DeadlineAfterMs(int ms) {
+  timespec deadline;
+  clock_gettime(CLOCK_REALTIME, &deadline);
+  deadline.tv_nsec += ms * 1000000L;
+  if (deadline.tv_nsec >= 1000000000L) {
+    deadline.tv_nsec -= 1000000000L;
+    ++deadline.tv_sec;
+  }
+  return deadline;
+}
+
+}  // namespace
+
+TactileEngine::TactileEngine()
+    : tactile_processor_(nullptr),
+      stream_(nullptr),
+      sink_(nullptr),
+      att_mtu_(MessagePacker::kDefaultAttMtu),
+      input_gain_(1.0f),
+      block_size_(0),
+      num_dropped_messages_(0),
+      stop_sender_(false) {
+  sem_init(&messages_available_, 0, 0);
+  sem_init(&write_ready_, 0, 1);
+  tuning_ = kDefaultTuningKnobs;
+  // Unused channels rest at zero amplitude.
+  std::memset(samples_, FloatToByteSample(0.0f), sizeof(samples_));
+}
+
+TactileEngine::~TactileEngine() {
+  Stop();
+  sem_destroy(&messages_available_);
+  sem_destroy(&write_ready_);
+}
+
+bool TactileEngine::Start(PacketSink* sink, int att_mtu) {
+  if (is_running()) { return false; }
+  if (kTactileProcessorNumTactors != kNumTactors) {
+    LOGE("Expected TactileProcessor to have %d tactors.", kNumTactors);
+    return false;
+  }
+
+  TactileProcessorParams params;
+  TactileProcessorSetDefaultParams(&params);
+  params.decimation_factor = kDecimationFactor;
+  params.frontend_params.block_size = kAdcDataSize;
+  params.frontend_params.input_sample_rate_hz = kSampleRateHz;
+  tactile_processor_ = TactileProcessorMake(&params);
+  if (tactile_processor_ == nullptr) {
+    LOGE("TactileProcessorMake failed.");
+    return false;
+  }
+  TactileProcessorApplyTuning(tactile_processor_, &tuning_);
+  input_gain_ = TuningGetInputGain(&tuning_);
+
+  PostProcessorParams post_processor_params;
+  PostProcessorSetDefaultParams(&post_processor_params);
+  if (!PostProcessorInit(&post_processor_, &post_processor_params,
+                         static_cast<float>(kSampleRateHz) / kDecimationFactor,
+                         kNumTactors)) {
+    LOGE("PostProcessorInit failed.");
+    Stop();
+    return false;
+  }
+
+  // Drain stale tuning commands, since tuning_ is already applied.
+  TuningKnobs unused;
+  while (tuning_queue_.Pop(&unused)) {}
+  block_size_ = 0;
+  sink_ = sink;
+  att_mtu_ = att_mtu;
+
+  AAudioStreamBuilder* builder;
+  if (AAudio_createStreamBuilder(&builder) != AAUDIO_OK) {
+    LOGE("AAudio_createStreamBuilder failed.");
+    Stop();
+    return false;
+  }
+  AAudioStreamBuilder_setDirection(builder, AAUDIO_DIRECTION_INPUT);
+  AAudioStreamBuilder_setPerformanceMode(builder,
+                                         AAUDIO_PERFORMANCE_MODE_LOW_LATENCY);
+  AAudioStreamBuilder_setSharingMode(builder, AAUDIO_SHARING_MODE_EXCLUSIVE);
+  AAudioStreamBuilder_setFormat(builder, AAUDIO_FORMAT_PCM_FLOAT);
+  AAudioStreamBuilder_setChannelCount(builder, 1);
+  AAudioStreamBuilder_setSampleRate(builder, kSampleRateHz);
+  AAudioStreamBuilder_setDataCallback(builder, DataCallback, this);
+  AAudioStreamBuilder_setErrorCallback(builder, ErrorCallback, this);
+  const aaudio_result_t result =
+      AAudioStreamBuilder_openStream(builder, &stream_);
+  AAudioStreamBuilder_delete(builder);
+  if (result != AAUDIO_OK) {
+    LOGE("AAudioStreamBuilder_openStream failed: %s",
+         AAudio_convertResultToText(result));
+    stream_ = nullptr;
+    Stop();
+    return false;
+  }
+
+  // No write is in flight at start.
+  while (sem_trywait(&write_ready_) == 0) {}
+  sem_post(&write_ready_);
+  stop_sender_.store(false);
+  sender_thread_ = std::thread(&TactileEngine::SenderLoop, this);
+
+  if (AAudioStream_requestStart(stream_) != AAUDIO_OK) {
+    LOGE("AAudioStream_requestStart failed.");
+    Stop();
+    return false;
+  }
+  return true;
+}
+
+void TactileEngine::Stop() {
+  if (stream_ != nullptr) {
+    // Closing the stream waits for any running callback to finish.
+    AAudioStream_requestStop(stream_);
+    AAudioStream_close(stream_);
+    stream_ = nullptr;
+  }
+  if (sender_thread_.joinable()) {
+    stop_sender_.store(true);
+    sem_post(&messages_available_);
+    sem_post(&write_ready_);
+    sender_thread_.join();
+  }
+  Message unused;
+  while (message_queue_.Pop(&unused)) {}
+  TactileProcessorFree(tactile_processor_);
+  tactile_processor_ = nullptr;
+  sink_ = nullptr;
+}
+
+void TactileEngine::OnPacketWritten() {
+  // Don't let the count exceed one, e.g. if the app wrote a packet of its own.
+  int value;
+  if (sem_getvalue(&write_ready_, &value) == 0 && value < 1) {
+    sem_post(&write_ready_);
+  }
+}
+
+void TactileEngine::SetTuning(const TuningKnobs& tuning) {
+  tuning_ = tuning;
+  if (is_running() && !tuning_queue_.Push(tuning)) {
+    LOGE("Tuning queue full, dropped a tuning update.");
+  }
+}
+
+aaudio_data_callback_result_t TactileEngine::DataCallback(
+    AAudioStream* /* stream */, void* user_data, void* audio_data,
+    int32_t num_frames) {
+  TactileEngine* engine = static_cast<TactileEngine*>(user_data);
+  engine->ProcessAudio(static_cast<const float*>(audio_data), num_frames);
+  return AAUDIO_CALLBACK_RESULT_CONTINUE;
+}
+
+void TactileEngine::ErrorCallback(AAudioStream* /* stream */,
+                                  void* /* user_data */,
+                                  aaudio_result_t error) {
+  // AAudio doesn't allow stopping or closing the stream from this callback.
+  // The app should Stop() and Start() again, e.g. if the mic is disconnected.
+  LOGE("AAudio stream error: %s", AAudio_convertResultToText(error));
+}
+
+void TactileEngine::ProcessAudio(const float* input, int num_samples) {
+  // Apply the latest tuning, if any. Only the last queued value matters.
+  const TuningKnobs* tuning = nullptr;
+  while ((tuning = tuning_queue_.Front()) != nullptr) {
+    TactileProcessorApplyTuning(tactile_processor_, tuning);
+    input_gain_ = TuningGetInputGain(tuning);
+    tuning_queue_.PopFront();
+  }
+
+  // AAudio buffer sizes are generally not a multiple of kAdcDataSize, so
+  // accumulate input into blocks.
+  while (num_samples > 0) {
+    const int n = std::min(num_samples, kAdcDataSize - block_size_);
+    for (int i = 0; i < n; ++i) {
+      block_[block_size_ + i] = input_gain_ * input[i];
+    }
+    block_size_ += n;
+    input += n;
+    num_samples -= n;
+
+    if (block_size_ == kAdcDataSize) {
+      ProcessBlock();
+      block_size_ = 0;
+    }
+  }
+}
+
+void TactileEngine::ProcessBlock() {
+  TactileProcessorProcessSamples(tactile_processor_, block_, tactile_output_);
+  // Apply equalization, clipping, and lowpass filtering.
+  PostProcessorProcessSamples(&post_processor_, tactile_output_,
+                              kNumPwmValues);
+
+  for (int i = 0; i < kNumPwmValues; ++i) {
+    const float* frame = tactile_output_ + i * kNumTactors;
+    uint8_t* dest = samples_ + i * kNumTotalPwm;
+    for (int c = 0; c < kNumSleeveTactors; ++c) {
+      dest[c] = FloatToByteSample(frame[kHwToLogical[c]]);
+    }
+  }
+
+  Message* message = message_queue_.BeginPush();
+  if (message == nullptr) {  // Sender thread fell behind, drop the block.
+    num_dropped_messages_.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  message->WriteAllTactorsSamplesCompressed(
+      Slice<const uint8_t, kNumTotalPwm * kNumPwmValues>(samples_));
+  message->SetBleHeader();
+  message_queue_.EndPush();
+  sem_post(&messages_available_);  // Nonblocking, safe on the audio thread.
+}
+
+void TactileEngine::SenderLoop() {
+  MessagePacker packer;
+  packer.SetAttMtu(att_mtu_);
+  timespec flush_deadline;
+
+  while (!stop_sender_.load()) {
+    if (packer.empty()) {
+      sem_wait(&messages_available_);
+    } else if (sem_timedwait(&messages_available_, &flush_deadline) != 0) {
+      // Timed out holding a partial packet, send it.
+      SendPacket(&packer);
+      continue;
+    }
+
+    // Pack queued messages, sending whenever the packet fills up.
+    const Message* message;
+    while ((message = message_queue_.Front()) != nullptr) {
+      if (!packer.Append(*message)) {
+        SendPacket(&packer);
+        packer.Append(*message);
+      }
+      message_queue_.PopFront();
+      if (packer.num_messages() == 1) {  // Start the hold time for a packet.
+        flush_deadline = DeadlineAfterMs(kMaxPacketHoldMs);
+      }
+    }
+  }
+
+  sink_->OnSenderThreadExit();
+}
+
+void TactileEngine::SendPacket(MessagePacker* packer) {
+  const timespec deadline = DeadlineAfterMs(kWriteTimeoutMs);
+  // Wait for the previous write to complete. On timeout, assume the completion
+  // was lost and send anyway.
+  while (sem_timedwait(&write_ready_, &deadline) != 0 && errno == EINTR) {}
+
+  if (!stop_sender_.load()) { sink_->OnPacket(packer->packet()); }
+  packer->Clear();
+}
+
+}  // namespace audio_tactile
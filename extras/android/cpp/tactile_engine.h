@@ -0,0 +1,171 @@
+// Copyright 2022 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+// Low-latency native audio-to-tactile engine for the Android app.
+//
+// TactileEngine captures the phone mic with an AAudio low-latency input stream
+// and runs TactileProcessor and PostProcessor directly in the AAudio data
+// callback. Every kAdcDataSize input samples produce one block of kNumPwmValues
+// tactile frames, which is converted to 8-bit samples and encoded as a
+// kAllTactorsSamplesCompressed message for streaming to the sleeve over BLE.
+//
+// As in extras/python/tactile/tactile_worker.h, the audio thread never locks a
+// mutex or allocates. The threads are
+//
+//   JNI thread  --tuning ring-->  Audio thread  --message ring-->  Sender thread
+//
+// Tuning changes are passed to the audio thread through an SpscRingBuffer.
+// Encoded messages are passed out through another SpscRingBuffer to a sender
+// thread, which packs them into BLE packets up to the ATT MTU with
+// MessagePacker and hands each packet to `PacketSink`. A partial packet is held
+// at most kMaxPacketHoldMs for more messages before sending. The sender thread
+// sleeps on a semaphore that the audio thread posts, which is nonblocking.
+//
+// Android's GATT client allows only one characteristic write in flight, and
+// fails a write issued before the previous one completes. So the sender thread
+// paces writes: it waits for OnPacketWritten() before handing the sink another
+// packet. While it waits, messages back up in the bounded message ring and are
+// then coalesced into fuller packets. If the ring fills, the audio thread drops
+// blocks rather than blocking.
+//
+// Android has no native BLE API, so the sink is implemented in Java/Kotlin to
+// write the packet to the GATT characteristic. Only whole packets cross JNI,
+// about 80 per second, rather than every audio buffer.
+
+#ifndef AUDIO_TO_TACTILE_EXTRAS_ANDROID_CPP_TACTILE_ENGINE_H_
+#define AUDIO_TO_TACTILE_EXTRAS_ANDROID_CPP_TACTILE_ENGINE_H_
+
+#include <aaudio/AAudio.h>
+#include <semaphore.h>
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+#include "cpp/constants.h"
+#include "cpp/message.h"
+#include "cpp/message_packer.h"
+#include "cpp/slice.h"
+#include "cpp/spsc_ring_buffer.h"
+#include "tactile/post_processor.h"
+#include "tactile/tactile_processor.h"
+#include "tactile/tuning.h"
+
+namespace audio_tactile {
+
+class TactileEngine {
+ public:
+  // Input sample rate. AAudio resamples the mic if the device rate differs.
+  static constexpr int kSampleRateHz = 16000;
+  // Decimation factor, so that kAdcDataSize samples make kNumPwmValues frames,
+  // as on the puck.
+  static constexpr int kDecimationFactor = kAdcDataSize / kNumPwmValues;
+
+  // Interface for sending packed BLE packets, called on the sender thread.
+  class PacketSink {
+   public:
+    virtual ~PacketSink() {}
+    virtual void OnPacket(Slice<const uint8_t> packet) = 0;
+    // Called on the sender thread just before it exits.
+    virtual void OnSenderThreadExit() {}
+  };
+
+  TactileEngine();
+  ~TactileEngine();
+  TactileEngine(const TactileEngine&) = delete;
+  TactileEngine& operator=(const TactileEngine&) = delete;
+
+  // Starts capture and processing, sending packets to `sink`, which must
+  // outlive the engine or the next call to Stop(). `att_mtu` is the negotiated
+  // BLE ATT MTU. Returns false on failure.
+  bool Start(PacketSink* sink, int att_mtu);
+
+  // Stops capture and the sender thread. Safe to call if not started.
+  void Stop();
+
+  // Signals that the sink's last packet write completed, successful or not,
+  // so that the sender thread may send the next. Called from any thread, e.g.
+  // from BluetoothGattCallback.onCharacteristicWrite().
+  void OnPacketWritten();
+
+  // Sets tuning knobs. This may be called from any one thread, e.g. the JNI
+  // thread, while running; the audio thread applies it on its next callback.
+  void SetTuning(const TuningKnobs& tuning);
+
+  bool is_running() const { return stream_ != nullptr; }
+
+  // Number of messages dropped because the sender thread fell behind.
+  int num_dropped_messages() const {
+    return num_dropped_messages_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  // Number of tactor signals from TactileProcessor, which is
+  // kTactileProcessorNumTactors but needs to be a compile-time constant here.
+  static constexpr int kNumTactors = 10;
+  static constexpr int kOutputBlockSize = kNumPwmValues * kNumTactors;
+  // Max time to hold a partially-filled packet, about two blocks.
+  static constexpr int kMaxPacketHoldMs = 8;
+  // Max time to wait for OnPacketWritten() before sending anyway, in case a
+  // write completion is lost, e.g. on disconnect.
+  static constexpr int kWriteTimeoutMs = 50;
+
+  static aaudio_data_callback_result_t DataCallback(AAudioStream* stream,
+                                                    void* user_data,
+                                                    void* audio_data,
+                                                    int32_t num_frames);
+  static void ErrorCallback(AAudioStream* stream, void* user_data,
+                            aaudio_result_t error);
+
+  // Audio thread: processes `num_samples` mic samples.
+  void ProcessAudio(const float* input, int num_samples);
+  // Audio thread: processes one block of kAdcDataSize samples in `block_`.
+  void ProcessBlock();
+  // Sender thread main loop.
+  void SenderLoop();
+  // Sender thread: waits for the previous write, then sends `packer`'s packet.
+  void SendPacket(MessagePacker* packer);
+
+  TactileProcessor* tactile_processor_;
+  PostProcessor post_processor_;
+  AAudioStream* stream_;
+  PacketSink* sink_;
+  int att_mtu_;
+  // Latest tuning, written only by the thread calling SetTuning().
+  TuningKnobs tuning_;
+
+  // Audio thread state.
+  float input_gain_;
+  float block_[kAdcDataSize];
+  int block_size_;
+  float tactile_output_[kOutputBlockSize];
+  uint8_t samples_[kNumTotalPwm * kNumPwmValues];
+
+  // Tuning commands from the JNI thread to the audio thread.
+  SpscRingBuffer<TuningKnobs, 4> tuning_queue_;
+  // Encoded messages from the audio thread to the sender thread.
+  SpscRingBuffer<Message, 64> message_queue_;
+  std::atomic<int> num_dropped_messages_;
+
+  std::thread sender_thread_;
+  sem_t messages_available_;
+  // Posted by OnPacketWritten(). Its value is 1 when no write is in flight.
+  sem_t write_ready_;
+  std::atomic<bool> stop_sender_;
+};
+
+}  // namespace audio_tactile
+
+#endif  // AUDIO_TO_TACTILE_EXTRAS_ANDROID_CPP_TACTILE_ENGINE_H_
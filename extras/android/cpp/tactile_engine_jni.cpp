@@ -0,0 +1,152 @@
+// Copyright 2022 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+// JNI bindings for TactileEngine. Only control calls (start, stop, tuning)
+// cross JNI from Kotlin; audio never does. Packets go the other way from the
+// engine's sender thread to a Kotlin `PacketSink`.
+
+#include <jni.h>
+
+#include <algorithm>
+
+#include "tactile_engine.h"  // NOLINT(build/include)
+
+#define JNI_METHOD(fun) \
+  Java_com_google_audio_1to_1tactile_TactileEngineNative_##fun  // NOLINT
+
+using audio_tactile::Slice;
+using audio_tactile::TactileEngine;
+
+namespace {
+
+JavaVM* java_vm = nullptr;
+
+// PacketSink that calls `onPacket(ByteArray)` on a Kotlin object.
+class JniPacketSink : public TactileEngine::PacketSink {
+ public:
+  JniPacketSink() : sink_(nullptr), on_packet_(nullptr), env_(nullptr) {}
+
+  // Holds a global reference to `sink`. Called on the JNI thread.
+  bool Init(JNIEnv* env, jobject sink) {
+    jclass sink_class = env->GetObjectClass(sink);
+    on_packet_ = env->GetMethodID(sink_class, "onPacket", "([B)V");
+    env->DeleteLocalRef(sink_class);
+    if (on_packet_ == nullptr) { return false; }
+    sink_ = env->NewGlobalRef(sink);
+    env_ = nullptr;
+    return true;
+  }
+
+  // Releases the global reference. Called on the JNI thread after Stop().
+  void Release(JNIEnv* env) {
+    if (sink_ != nullptr) {
+      env->DeleteGlobalRef(sink_);
+      sink_ = nullptr;
+    }
+  }
+
+  // Called on the sender thread.
+  void OnPacket(Slice<const uint8_t> packet) override {
+    if (env_ == nullptr) {
+      // First call on this sender thread, attach it to the JVM.
+      if (java_vm->AttachCurrentThread(&env_, nullptr) != JNI_OK) {
+        env_ = nullptr;
+        return;
+      }
+    }
+    jbyteArray bytes = env_->NewByteArray(packet.size());
+    env_->SetByteArrayRegion(bytes, 0, packet.size(),
+                             reinterpret_cast<const jbyte*>(packet.data()));
+    env_->CallVoidMethod(sink_, on_packet_, bytes);
+    env_->DeleteLocalRef(bytes);
+    if (env_->ExceptionCheck()) { env_->ExceptionClear(); }
+  }
+
+  // Detaches the sender thread from the JVM as it exits.
+  void OnSenderThreadExit() override {
+    if (env_ != nullptr) {
+      java_vm->DetachCurrentThread();
+      env_ = nullptr;
+    }
+  }
+
+ private:
+  jobject sink_;
+  jmethodID on_packet_;
+  JNIEnv* env_;  // Sender thread's JNIEnv, or null if not yet attached.
+};
+
+TactileEngine* engine = nullptr;
+JniPacketSink packet_sink;
+
+}  // namespace
+
+extern "C" JNIEXPORT jint JNICALL JNI_OnLoad(JavaVM* vm, void* /* reserved */) {
+  java_vm = vm;
+  return JNI_VERSION_1_6;
+}
+
+// Starts the engine, sending BLE packets to `sink`. Returns true on success.
+extern "C" JNIEXPORT jboolean JNICALL JNI_METHOD(start)(JNIEnv* env,
+                                                        jobject /* this */,
+                                                        jobject sink,
+                                                        jint att_mtu) {
+  if (engine == nullptr) { engine = new TactileEngine; }
+  if (engine->is_running() || !packet_sink.Init(env, sink)) {
+    return JNI_FALSE;
+  }
+  if (!engine->Start(&packet_sink, att_mtu)) {
+    packet_sink.Release(env);
+    return JNI_FALSE;
+  }
+  return JNI_TRUE;
+}
+
+// Stops the engine. Does nothing if not running.
+extern "C" JNIEXPORT void JNICALL JNI_METHOD(stop)(JNIEnv* env,
+                                                   jobject /* this */) {
+  if (engine == nullptr || !engine->is_running()) { return; }
+  engine->Stop();
+  packet_sink.Release(env);
+}
+
+// Sets tuning knobs from an IntArray of kNumTuningKnobs values.
+extern "C" JNIEXPORT void JNICALL JNI_METHOD(setTuning)(JNIEnv* env,
+                                                        jobject /* this */,
+                                                        jintArray values) {
+  if (engine == nullptr) { engine = new TactileEngine; }
+  TuningKnobs tuning = kDefaultTuningKnobs;
+  const int size = std::min<int>(env->GetArrayLength(values), kNumTuningKnobs);
+  jint* elements = env->GetIntArrayElements(values, nullptr);
+  for (int knob = 0; knob < size; ++knob) {
+    tuning.values[knob] =
+        static_cast<uint8_t>(std::max(0, std::min<int>(elements[knob], 255)));
+  }
+  env->ReleaseIntArrayElements(values, elements, JNI_ABORT);
+  engine->SetTuning(tuning);
+}
+
+// Gets the number of tactile messages dropped since the engine was created.
+extern "C" JNIEXPORT jint JNICALL
+JNI_METHOD(numDroppedMessages)(JNIEnv* env, jobject /* this */) {
+  return engine ? engine->num_dropped_messages() : 0;
+}
+
+// Signals that the last packet write completed, so the engine may send the
+// next. Called from BluetoothGattCallback.onCharacteristicWrite().
+extern "C" JNIEXPORT void JNICALL
+JNI_METHOD(onPacketWritten)(JNIEnv* env, jobject /* this */) {
+  if (engine != nullptr) { engine->OnPacketWritten(); }
+}
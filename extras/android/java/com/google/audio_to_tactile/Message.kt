@@ -158,6 +158,42 @@ sealed class Message {
       }
     }
 
+    /**
+     * Deserializes a packet of one or more Messages concatenated back to back, as sent by the
+     * firmware's MessagePacker. Returns null if any message in the packet is invalid.
+     */
+    fun deserializePacket(bytes: ByteArray): List<Message>? {
+      val messages = mutableListOf<Message>()
+      var offset = 0
+      while (offset < bytes.size) {
+        if (bytes.size - offset < HEADER_SIZE) { return null }
+        val messageSize = HEADER_SIZE + bytes[offset + 3].toNonnegInt()
+        if (bytes.size - offset < messageSize) { return null }
+        messages.add(deserialize(bytes.copyOfRange(offset, offset + messageSize)) ?: return null)
+        offset += messageSize
+      }
+      return messages
+    }
+
+    /**
+     * Serializes `messages` into packets, each packing as many whole messages as fit in
+     * `maxPacketSize` bytes. A message larger than `maxPacketSize` is put alone in a packet.
+     */
+    fun serializePackets(messages: List<Message>, maxPacketSize: Int): List<ByteArray> {
+      val packets = mutableListOf<ByteArray>()
+      var pending = ByteArray(0)
+      for (message in messages) {
+        val bytes = message.serialize()
+        if (pending.isNotEmpty() && pending.size + bytes.size > maxPacketSize) {
+          packets.add(pending)
+          pending = ByteArray(0)
+        }
+        pending += bytes
+      }
+      if (pending.isNotEmpty()) { packets.add(pending) }
+      return packets
+    }
+
     /** Computes Fletcher-16 checksum over all of `bytes` except for the first two bytes. */
     fun computeChecksum(bytes: ByteArray): Int {
       val buffer = ByteBuffer.wrap(bytes)
@@ -0,0 +1,92 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Native low-latency audio-to-tactile engine, see extras/android/cpp/tactile_engine.h.
+ *
+ * The engine captures the phone mic with AAudio, runs TactileProcessor on the audio callback
+ * thread, and streams tactile samples to the connected sleeve. Only control calls cross JNI; audio
+ * processing and message encoding stay native. Requires the RECORD_AUDIO permission.
+ *
+ * While running, the engine requests high BLE connection priority and paces its packet writes on
+ * write completion, so that each write succeeds and packets coalesce while the link is busy.
+ */
+package com.google.audio_to_tactile
+
+import com.google.audio_to_tactile.ble.BleCom
+
+object TactileEngine {
+  /** Receives BLE packets from the engine's sender thread. */
+  interface PacketSink {
+    fun onPacket(packet: ByteArray)
+  }
+
+  /** BleCom that the engine is streaming to, or null if not running. */
+  private var bleCom: BleCom? = null
+
+  /** Starts the engine, streaming to `bleCom`. Returns true on success. */
+  fun start(bleCom: BleCom): Boolean {
+    bleCom.onWriteComplete = { TactileEngineNative.onPacketWritten() }
+    val started =
+      TactileEngineNative.start(
+        object : PacketSink {
+          override fun onPacket(packet: ByteArray) = bleCom.writePacket(packet)
+        },
+        bleCom.attMtu
+      )
+    if (started) {
+      bleCom.requestHighPriority(true)
+      this.bleCom = bleCom
+    } else {
+      bleCom.onWriteComplete = null
+    }
+    return started
+  }
+
+  /** Stops the engine. Does nothing if not running. */
+  fun stop() {
+    TactileEngineNative.stop()
+    bleCom?.let {
+      it.onWriteComplete = null
+      it.requestHighPriority(false)
+    }
+    bleCom = null
+  }
+
+  /** Sets the engine's tuning. This may be called while running. */
+  fun setTuning(tuning: Tuning) = TactileEngineNative.setTuning(tuning.values)
+
+  /** Number of tactile messages dropped because BLE writes fell behind. */
+  val numDroppedMessages: Int
+    get() = TactileEngineNative.numDroppedMessages()
+}
+
+/** TactileEngine JNI bindings. */
+private object TactileEngineNative {
+  init {
+    System.loadLibrary("tactile_engine_jni")
+  }
+
+  /** Starts the engine, sending packets up to `attMtu` to `sink`. */
+  external fun start(sink: TactileEngine.PacketSink, attMtu: Int): Boolean
+  /** Stops the engine. */
+  external fun stop()
+  /** Sets tuning knobs from an IntArray of knob values. */
+  external fun setTuning(values: IntArray)
+  /** Gets the number of dropped messages. */
+  external fun numDroppedMessages(): Int
+  /** Signals that the last packet write completed. */
+  external fun onPacketWritten()
+}
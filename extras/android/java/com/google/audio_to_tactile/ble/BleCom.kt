@@ -74,6 +74,15 @@ interface BleCom {
   /** Connected device unique address. Returns a string such as E1:A7:79:EB:A0:2E */
   val deviceAddress: String
 
+  /** Negotiated ATT MTU, the max packet size for `writePacket` plus ATT header. */
+  val attMtu: Int
+
+  /**
+   * Called on a binder thread whenever a write to the device completes, successful or not. Only
+   * one write may be in flight at a time, so a streaming writer uses this to pace its writes.
+   */
+  var onWriteComplete: (() -> Unit)?
+
   /**
    * Initiates a scan for BLE devices and displays a list to allow the user to select a devices.
    * Scan results are filtered to show only devices with name beginning with "Audio-to-Tactile" and
@@ -90,6 +99,25 @@ interface BleCom {
   /** Disconnects, if connected. */
   fun disconnect()
 
+  /**
+   * Requests high connection priority, a short connection interval for low-latency streaming, if
+   * `high` is true, or balanced priority to save power otherwise. Does nothing if not connected.
+   */
+  fun requestHighPriority(high: Boolean)
+
   /** Sends `message` to the connected device through NUS Rx. */
   fun write(message: Message)
+
+  /**
+   * Sends `messages` to the connected device, packing as many as fit in each write up to the
+   * negotiated MTU. This uses fewer connection events than writing messages one at a time.
+   */
+  fun writeBatch(messages: List<Message>)
+
+  /**
+   * Sends a `packet` of already-serialized messages, e.g. as packed by the native TactileEngine.
+   * The packet size must be at most `attMtu` minus the 3-byte ATT header. The packet is written
+   * without response if the device supports it, so that several may go in one connection event.
+   */
+  fun writePacket(packet: ByteArray)
 }
@@ -50,6 +50,10 @@ class BleComImpl @Inject internal constructor(@ApplicationContext private val co
   private var nusTx: BluetoothGattCharacteristic? = null
   /** NUS Rx characteristic, for sending messages to the connected device. */
   private var nusRx: BluetoothGattCharacteristic? = null
+  /** Negotiated MTU size. */
+  private var mtu = MIN_MTU_SIZE
+
+  @Volatile override var onWriteComplete: (() -> Unit)? = null
 
   override var callback: BleComCallback =
     object : BleComCallback {
@@ -67,12 +71,20 @@ class BleComImpl @Inject internal constructor(@ApplicationContext private val co
         when (status) {
           BluetoothGatt.GATT_SUCCESS ->
             when (newState) {
-              BluetoothProfile.STATE_CONNECTED ->
+              BluetoothProfile.STATE_CONNECTED -> {
+                // Request the 2M PHY for higher throughput. This is only a preference, and the
+                // connection continues with the 1M PHY if either side doesn't support it.
+                gatt.setPreferredPhy(
+                  BluetoothDevice.PHY_LE_2M_MASK,
+                  BluetoothDevice.PHY_LE_2M_MASK,
+                  BluetoothDevice.PHY_OPTION_NO_PREFERRED
+                )
                 if (!gatt.requestMtu(DESIRED_MTU_SIZE)) {
                   error(DisconnectReason.OPERATION_FAILED, "Failed to initiate MTU request.")
                 } else {
                   Log.i(TAG, "Initiating MTU request.")
                 }
+              }
               BluetoothProfile.STATE_DISCONNECTED ->
                 error(DisconnectReason.DEVICE_DISCONNECTED, "Device disconnected.")
             }
@@ -89,7 +101,8 @@ class BleComImpl @Inject internal constructor(@ApplicationContext private val co
       /** `onMtuChanged` is called when the Maximum Transmission Unit (MTU) is changed. */
       override fun onMtuChanged(gatt: BluetoothGatt, mtu: Int, status: Int) {
         Log.i(TAG, "onMtuChanged (mtu = $mtu, status = $status).")
-        if (mtu == DESIRED_MTU_SIZE && status == BluetoothGatt.GATT_SUCCESS) {
+        if (mtu >= MIN_MTU_SIZE && status == BluetoothGatt.GATT_SUCCESS) {
+          this@BleComImpl.mtu = mtu
           // Initiate GATT service discovery.
           if (!gatt.discoverServices()) {
             error(DisconnectReason.OPERATION_FAILED, "Failed to initiate service discovery.")
@@ -176,14 +189,28 @@ class BleComImpl @Inject internal constructor(@ApplicationContext private val co
       ) {
         if (characteristic == nusTx) {
           val bytes: ByteArray = characteristic.value
-          val message: Message? = Message.deserialize(bytes)
-          if (message != null) {
-            handler.post() { callback.onRead(message) }
+          // The device may pack several messages into one notification.
+          val messages: List<Message>? = Message.deserializePacket(bytes)
+          if (messages != null) {
+            for (message in messages) {
+              handler.post() { callback.onRead(message) }
+            }
           } else {
             Log.e(TAG, "Received invalid Message: ${byteArrayToString(bytes)}")
           }
         }
       }
+
+      /** `onCharacteristicWrite` is called when a write to NUS Rx completes. */
+      override fun onCharacteristicWrite(
+        gatt: BluetoothGatt,
+        characteristic: BluetoothGattCharacteristic,
+        status: Int
+      ) {
+        if (characteristic == nusRx) {
+          onWriteComplete?.invoke()
+        }
+      }
     }
 
   override fun scanForDevices(
@@ -245,6 +272,18 @@ class BleComImpl @Inject internal constructor(@ApplicationContext private val co
     disconnectImpl(DisconnectReason.APP_DISCONNECTED)
   }
 
+  override fun requestHighPriority(high: Boolean) {
+    val priority =
+      if (high) {
+        BluetoothGatt.CONNECTION_PRIORITY_HIGH
+      } else {
+        BluetoothGatt.CONNECTION_PRIORITY_BALANCED
+      }
+    if (connectedGatt?.requestConnectionPriority(priority) == false) {
+      Log.w(TAG, "Failed to request connection priority $priority.")
+    }
+  }
+
   private fun disconnectImpl(reason: DisconnectReason) {
     connectedGatt?.let {
       Log.i(TAG, "Disconnecting.")
@@ -253,12 +292,37 @@ class BleComImpl @Inject internal constructor(@ApplicationContext private val co
     }
     handler.post { callback.onDisconnect(reason) }
     connectedGatt = null
+    mtu = MIN_MTU_SIZE
   }
 
   override fun write(message: Message) {
     writeBytes(message.serialize())
   }
 
+  override fun writeBatch(messages: List<Message>) {
+    for (packet in Message.serializePackets(messages, mtu - ATT_HEADER_SIZE)) {
+      writeBytes(packet)
+    }
+  }
+
+  override val attMtu: Int
+    get() = mtu
+
+  override fun writePacket(packet: ByteArray) {
+    val supportsNoResponse =
+      nusRx?.let {
+        (it.properties and BluetoothGattCharacteristic.PROPERTY_WRITE_NO_RESPONSE) != 0
+      } ?: false
+    writeBytes(
+      packet,
+      if (supportsNoResponse) {
+        BluetoothGattCharacteristic.WRITE_TYPE_NO_RESPONSE
+      } else {
+        BluetoothGattCharacteristic.WRITE_TYPE_DEFAULT
+      }
+    )
+  }
+
   // Device name and address are stored when GATT is connected.
   private var _deviceName = ""
   override val deviceName: String
@@ -268,14 +332,18 @@ class BleComImpl @Inject internal constructor(@ApplicationContext private val co
   override val deviceAddress: String
     get() = _deviceAddress
 
-  /** Writes raw bytes to NUS Rx. */
-  private fun writeBytes(bytes: ByteArray) {
+  /** Writes raw bytes to NUS Rx with `writeType`, one of the WRITE_TYPE_* constants. */
+  private fun writeBytes(
+    bytes: ByteArray,
+    writeType: Int = BluetoothGattCharacteristic.WRITE_TYPE_DEFAULT
+  ) {
     val connectedGatt = this.connectedGatt
     val nusRx = this.nusRx
     if (connectedGatt == null || nusRx == null) {
       return
     }
 
+    nusRx.writeType = writeType
     nusRx.value = bytes
 
     if (!connectedGatt.writeCharacteristic(nusRx)) {
@@ -297,12 +365,18 @@ class BleComImpl @Inject internal constructor(@ApplicationContext private val co
     /** Tag for log messages generated by this class. */
     const val TAG = "BleComImpl"
     /**
-     * MTU size to request, large enough that the largest packet we can send is 128 + 3 bytes, or a
-     * message payload of 124 bytes, the bottleneck being the 128-byte buffer used for messages on
-     * the firmware side. Android supports an MTU up to 517, the nRF52 supports an MTU up to 247,
-     * and most microcontrollers support at least 180.
+     * MTU size to request. Android supports an MTU up to 517 and the nRF52 supports an MTU up to
+     * 247. The larger MTU allows packing several messages into one write with `writeBatch`.
+     */
+    const val DESIRED_MTU_SIZE = 247
+    /**
+     * Min acceptable MTU size, large enough that the largest packet we can send is 128 + 3 bytes,
+     * or a message payload of 124 bytes, the bottleneck being the 128-byte buffer used for messages
+     * on the firmware side. Most microcontrollers support at least 180.
      */
-    const val DESIRED_MTU_SIZE = 144
+    const val MIN_MTU_SIZE = 144
+    /** Number of bytes of ATT overhead per write. */
+    const val ATT_HEADER_SIZE = 3
     /** UUID for the BLE Nordic UART Service (NUS). */
     const val NUS_SERVICE_UUID = "6e400001-b5a3-f393-e0a9-e50e24dcca9e"
     /** NUS Rx characteristic, used for sending data from the app to the device. */
@@ -0,0 +1,98 @@
+// Copyright 2022 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+// Benchmark of CarlFrontendProcessSamples.
+//
+// The benchmark is parameterized by block size, which is also CarlFrontend's
+// decimation factor, and by channel density in channels per ERB, which
+// determines the channel count. The channel count is reported as "channels".
+// Besides time per call, the benchmark reports "x_realtime", the real-time
+// factor as seconds of audio processed per second of CPU time, and hardware
+// performance counters per call, including cache misses (see perf_counters.h).
+//
+// NOTE: When running benchmarks, build with optimizations (-c opt) and disable
+// frequency scaling (sudo cpupower frequency-set --governor performance). For
+// accurate measurement, run for longer time with --benchmark_min_time=2.0.
+
+#include <algorithm>
+#include <random>
+
+#include "extras/benchmark/perf_counters.h"
+#include "src/frontend/carl_frontend.h"
+#include "benchmark/benchmark.h"
+
+namespace {
+// Generates a float array of random normally-distributed values.
+float* RandomValues(int size) {
+  std::random_device dev;
+  std::mt19937 rng(dev());
+  std::normal_distribution<float> dist(0.0f, 0.1f);
+
+  float* values = new float[size];
+  for (int i = 0; i < size; ++i) {
+    values[i] = dist(rng);
+  }
+  return values;
+}
+}  // namespace
+
+void BM_CarlFrontendProcessSamples(benchmark::State& state) {
+  const int block_size = state.range(0);
+  const int channels_per_erb = state.range(1);
+  CarlFrontendParams params = kCarlFrontendDefaultParams;
+  params.block_size = block_size;
+  params.step_erbs = 1.0f / channels_per_erb;
+  CarlFrontend* frontend = CarlFrontendMake(&params);
+  if (frontend == nullptr) {
+    state.SkipWithError("CarlFrontendMake failed");
+    return;
+  }
+  // CarlFrontendProcessSamples uses `input` as scratch space, so it is
+  // refilled on each iteration.
+  float* random_input = RandomValues(block_size);
+  float* input = new float[block_size];
+  float* output = new float[CarlFrontendNumChannels(frontend)];
+
+  PerfCounters perf_counters;
+  perf_counters.Start();
+  for (auto _ : state) {
+    std::copy(random_input, random_input + block_size, input);
+    CarlFrontendProcessSamples(frontend, input, output);
+    benchmark::DoNotOptimize(output);
+  }
+  perf_counters.StopAndReport(state);
+
+  state.counters["channels"] = CarlFrontendNumChannels(frontend);
+  state.counters["x_realtime"] = benchmark::Counter(
+      block_size / params.input_sample_rate_hz,
+      benchmark::Counter::kIsIterationInvariantRate);
+  delete[] output;
+  delete[] input;
+  delete[] random_input;
+  CarlFrontendFree(frontend);
+}
+BENCHMARK(BM_CarlFrontendProcessSamples)
+    ->Apply([](benchmark::internal::Benchmark* b) {
+      b->ArgNames({"block_size", "channels_per_erb"});
+      // With default params, the block size is at most 64 (see
+      // pcen_cross_channel_diffusivity).
+      for (int block_size : {8, 16, 32, 64}) {
+        for (int channels_per_erb : {1, 2, 4}) {
+          b->Args({block_size, channels_per_erb});
+        }
+      }
+    });
+
+BENCHMARK_MAIN();
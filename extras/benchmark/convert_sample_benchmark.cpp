@@ -0,0 +1,228 @@
+// Copyright 2022 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+// Benchmark of convert_sample library.
+//
+// This benchmark measures the time to convert 1024 samples with the array
+// functions in convert_sample.h, which are vectorized with Float4, compared to
+// loops over the single-sample conversion functions.
+//
+// NOTE: When running benchmarks, build with optimizations (-c opt) and disable
+// frequency scaling (sudo cpupower frequency-set --governor performance). For
+// accurate measurement, run for longer time with --benchmark_min_time=2.0.
+
+#include <random>
+#include <vector>
+
+#include "src/dsp/convert_sample.h"
+#include "benchmark/benchmark.h"
+
+static constexpr int kNumSamples = 1024;
+
+namespace {
+std::vector<float> FloatTestValues() {
+  std::vector<float> values(kNumSamples);
+  std::mt19937 rng(0);
+  std::uniform_real_distribution<float> dist(-1.1f, 1.1f);
+  for (float& value : values) {
+    value = dist(rng);
+  }
+  return values;
+}
+
+template <typename T>
+std::vector<T> IntTestValues(int num_bits) {
+  std::vector<T> values(kNumSamples);
+  std::mt19937 rng(0);
+  std::uniform_int_distribution<int32_t> dist(
+      -(INT32_C(1) << (num_bits - 1)), (INT32_C(1) << (num_bits - 1)) - 1);
+  for (T& value : values) {
+    value = static_cast<T>(dist(rng));
+  }
+  return values;
+}
+}  // namespace
+
+// int16 -> float benchmarks. __________________________________________________
+
+static void BM_ScalarInt16ToFloat(benchmark::State& state) {
+  std::vector<int16_t> values = IntTestValues<int16_t>(16);
+  std::vector<float> result(kNumSamples);
+
+  for (auto _ : state) {
+    benchmark::ClobberMemory();
+    for (int i = 0; i < kNumSamples; ++i) {
+      result[i] = ConvertSampleInt16ToFloat(values[i]);
+    }
+    benchmark::DoNotOptimize(result.data());
+  }
+}
+BENCHMARK(BM_ScalarInt16ToFloat);
+
+static void BM_ArrayInt16ToFloat(benchmark::State& state) {
+  std::vector<int16_t> values = IntTestValues<int16_t>(16);
+  std::vector<float> result(kNumSamples);
+
+  for (auto _ : state) {
+    benchmark::ClobberMemory();
+    ConvertSampleArrayInt16ToFloat(values.data(), kNumSamples, result.data());
+    benchmark::DoNotOptimize(result.data());
+  }
+}
+BENCHMARK(BM_ArrayInt16ToFloat);
+
+// float -> int16 benchmarks. __________________________________________________
+
+static void BM_ScalarFloatToInt16(benchmark::State& state) {
+  std::vector<float> values = FloatTestValues();
+  std::vector<int16_t> result(kNumSamples);
+
+  for (auto _ : state) {
+    benchmark::ClobberMemory();
+    for (int i = 0; i < kNumSamples; ++i) {
+      result[i] = ConvertSampleFloatToInt16(values[i]);
+    }
+    benchmark::DoNotOptimize(result.data());
+  }
+}
+BENCHMARK(BM_ScalarFloatToInt16);
+
+static void BM_ArrayFloatToInt16(benchmark::State& state) {
+  std::vector<float> values = FloatTestValues();
+  std::vector<int16_t> result(kNumSamples);
+
+  for (auto _ : state) {
+    benchmark::ClobberMemory();
+    ConvertSampleArrayFloatToInt16(values.data(), kNumSamples, result.data());
+    benchmark::DoNotOptimize(result.data());
+  }
+}
+BENCHMARK(BM_ArrayFloatToInt16);
+
+// int32 -> float benchmarks. __________________________________________________
+
+static void BM_ScalarInt32ToFloat(benchmark::State& state) {
+  std::vector<int32_t> values = IntTestValues<int32_t>(32);
+  std::vector<float> result(kNumSamples);
+
+  for (auto _ : state) {
+    benchmark::ClobberMemory();
+    for (int i = 0; i < kNumSamples; ++i) {
+      result[i] = ConvertSampleInt32ToFloat(values[i]);
+    }
+    benchmark::DoNotOptimize(result.data());
+  }
+}
+BENCHMARK(BM_ScalarInt32ToFloat);
+
+static void BM_ArrayInt32ToFloat(benchmark::State& state) {
+  std::vector<int32_t> values = IntTestValues<int32_t>(32);
+  std::vector<float> result(kNumSamples);
+
+  for (auto _ : state) {
+    benchmark::ClobberMemory();
+    ConvertSampleArrayInt32ToFloat(values.data(), kNumSamples, result.data());
+    benchmark::DoNotOptimize(result.data());
+  }
+}
+BENCHMARK(BM_ArrayInt32ToFloat);
+
+// float -> int32 benchmarks. __________________________________________________
+
+static void BM_ScalarFloatToInt32(benchmark::State& state) {
+  std::vector<float> values = FloatTestValues();
+  std::vector<int32_t> result(kNumSamples);
+
+  for (auto _ : state) {
+    benchmark::ClobberMemory();
+    for (int i = 0; i < kNumSamples; ++i) {
+      result[i] = ConvertSampleFloatToInt32(values[i]);
+    }
+    benchmark::DoNotOptimize(result.data());
+  }
+}
+BENCHMARK(BM_ScalarFloatToInt32);
+
+static void BM_ArrayFloatToInt32(benchmark::State& state) {
+  std::vector<float> values = FloatTestValues();
+  std::vector<int32_t> result(kNumSamples);
+
+  for (auto _ : state) {
+    benchmark::ClobberMemory();
+    ConvertSampleArrayFloatToInt32(values.data(), kNumSamples, result.data());
+    benchmark::DoNotOptimize(result.data());
+  }
+}
+BENCHMARK(BM_ArrayFloatToInt32);
+
+// float -> int24 benchmarks. __________________________________________________
+
+static void BM_ScalarFloatToInt24(benchmark::State& state) {
+  std::vector<float> values = FloatTestValues();
+  std::vector<uint8_t> result(3 * kNumSamples);
+
+  for (auto _ : state) {
+    benchmark::ClobberMemory();
+    for (int i = 0; i < kNumSamples; ++i) {
+      const int32_t value = ConvertSampleFloatToInt24(values[i]);
+      result[3 * i] = static_cast<uint8_t>(value);
+      result[3 * i + 1] = static_cast<uint8_t>(value >> 8);
+      result[3 * i + 2] = static_cast<uint8_t>(value >> 16);
+    }
+    benchmark::DoNotOptimize(result.data());
+  }
+}
+BENCHMARK(BM_ScalarFloatToInt24);
+
+static void BM_ArrayFloatToInt24(benchmark::State& state) {
+  std::vector<float> values = FloatTestValues();
+  std::vector<uint8_t> result(3 * kNumSamples);
+
+  for (auto _ : state) {
+    benchmark::ClobberMemory();
+    ConvertSampleArrayFloatToInt24(values.data(), kNumSamples, result.data());
+    benchmark::DoNotOptimize(result.data());
+  }
+}
+BENCHMARK(BM_ArrayFloatToInt24);
+
+// float -> PWM benchmarks. ____________________________________________________
+
+static void BM_ScalarFloatTo0_MaxValue(benchmark::State& state) {
+  std::vector<float> values = FloatTestValues();
+  std::vector<uint16_t> result(kNumSamples);
+
+  for (auto _ : state) {
+    benchmark::ClobberMemory();
+    for (int i = 0; i < kNumSamples; ++i) {
+      result[i] = ConvertSampleFloatTo0_MaxValue(values[i], 512);
+    }
+    benchmark::DoNotOptimize(result.data());
+  }
+}
+BENCHMARK(BM_ScalarFloatTo0_MaxValue);
+
+static void BM_ArrayFloatTo0_MaxValue(benchmark::State& state) {
+  std::vector<float> values = FloatTestValues();
+  std::vector<uint16_t> result(kNumSamples);
+
+  for (auto _ : state) {
+    benchmark::ClobberMemory();
+    ConvertSampleArrayFloatTo0_MaxValue(
+        values.data(), kNumSamples, 512, result.data());
+    benchmark::DoNotOptimize(result.data());
+  }
+}
+BENCHMARK(BM_ArrayFloatTo0_MaxValue);
@@ -17,7 +17,7 @@
 //
 // This benchmark measures the time to make 1000 calls of FastLog2, FastExp2,
 // FastPow, and FastTanh compared to functions log2f, exp2f, powf, and tanhf in
-// the math.h standard library.
+// the math.h standard library, and the 4-lane SIMD versions in fast_fun_simd.h.
 //
 // NOTE: When running benchmarks, build with optimizations (-c opt) and disable
 // frequency scaling (sudo cpupower frequency-set --governor performance). For
@@ -28,6 +28,7 @@
 #include <vector>
 
 #include "src/dsp/fast_fun.h"
+#include "src/dsp/fast_fun_simd.h"
 #include "benchmark/benchmark.h"
 
 static constexpr int kNumCalls = 1000;
@@ -76,6 +77,21 @@ static void BM_math_log2f(benchmark::State& state) {
 }
 BENCHMARK(BM_math_log2f);
 
+// Benchmark of FastLog2Float4().
+static void BM_FastLog2Float4(benchmark::State& state) {
+  std::vector<float> values = Log2TestValues();
+  std::vector<float> result(kNumCalls);
+
+  for (auto _ : state) {
+    benchmark::ClobberMemory();
+    for (int i = 0; i < kNumCalls; i += 4) {
+      Float4Store(&result[i], FastLog2Float4(Float4Load(&values[i])));
+    }
+    benchmark::DoNotOptimize(result.data());
+  }
+}
+BENCHMARK(BM_FastLog2Float4);
+
 // exp2 benchmarks. ____________________________________________________________
 
 namespace {
@@ -120,6 +136,21 @@ static void BM_math_exp2f(benchmark::State& state) {
 }
 BENCHMARK(BM_math_exp2f);
 
+// Benchmark of FastExp2Float4().
+static void BM_FastExp2Float4(benchmark::State& state) {
+  std::vector<float> values = Exp2TestValues();
+  std::vector<float> result(kNumCalls);
+
+  for (auto _ : state) {
+    benchmark::ClobberMemory();
+    for (int i = 0; i < kNumCalls; i += 4) {
+      Float4Store(&result[i], FastExp2Float4(Float4Load(&values[i])));
+    }
+    benchmark::DoNotOptimize(result.data());
+  }
+}
+BENCHMARK(BM_FastExp2Float4);
+
 // pow benchmarks. _____________________________________________________________
 
 namespace {
@@ -164,6 +195,66 @@ static void BM_math_powf(benchmark::State& state) {
 }
 BENCHMARK(BM_math_powf);
 
+// Benchmark of FastPowN() with a fixed exponent, as in power law compression.
+static void BM_FastPowN(benchmark::State& state) {
+  std::vector<std::pair<float, float>> pairs = PowTestValues();
+  std::vector<float> values(kNumCalls);
+  for (int i = 0; i < kNumCalls; ++i) {
+    values[i] = pairs[i].first;
+  }
+  std::vector<float> result(kNumCalls);
+
+  for (auto _ : state) {
+    benchmark::ClobberMemory();
+    FastPowN(values.data(), 0.3f, kNumCalls, result.data());
+    benchmark::DoNotOptimize(result.data());
+  }
+}
+BENCHMARK(BM_FastPowN);
+
+// Benchmark of FastPow() with a fixed exponent, for comparison with the table.
+static void BM_FastPowFixedExponent(benchmark::State& state) {
+  std::vector<std::pair<float, float>> pairs = PowTestValues();
+  std::vector<float> result(kNumCalls);
+
+  for (auto _ : state) {
+    benchmark::ClobberMemory();
+    for (int i = 0; i < kNumCalls; ++i) {
+      result[i] = FastPow(pairs[i].first, 0.3f);
+    }
+    benchmark::DoNotOptimize(result.data());
+  }
+}
+BENCHMARK(BM_FastPowFixedExponent);
+
+// Benchmark of FastPowTableEval() with the same fixed exponent.
+static void BM_FastPowTableEval(benchmark::State& state) {
+  std::vector<std::pair<float, float>> pairs = PowTestValues();
+  std::vector<float> result(kNumCalls);
+  FastPowTable table;
+  FastPowTableInit(&table, 0.3f);
+
+  for (auto _ : state) {
+    benchmark::ClobberMemory();
+    for (int i = 0; i < kNumCalls; ++i) {
+      result[i] = FastPowTableEval(&table, pairs[i].first);
+    }
+    benchmark::DoNotOptimize(result.data());
+  }
+}
+BENCHMARK(BM_FastPowTableEval);
+
+// Benchmark of FastPowTableInit(), the cost of retuning the exponent.
+static void BM_FastPowTableInit(benchmark::State& state) {
+  FastPowTable table;
+
+  for (auto _ : state) {
+    FastPowTableInit(&table, 0.3f);
+    benchmark::DoNotOptimize(&table);
+  }
+}
+BENCHMARK(BM_FastPowTableInit);
+
 // tanh benchmarks. ____________________________________________________________
 
 namespace {
@@ -208,6 +299,34 @@ static void BM_math_tanhf(benchmark::State& state) {
 }
 BENCHMARK(BM_math_tanhf);
 
+// Benchmark of FastTanhFloat4().
+static void BM_FastTanhFloat4(benchmark::State& state) {
+  std::vector<float> values = TanhTestValues();
+  std::vector<float> result(kNumCalls);
+
+  for (auto _ : state) {
+    benchmark::ClobberMemory();
+    for (int i = 0; i < kNumCalls; i += 4) {
+      Float4Store(&result[i], FastTanhFloat4(Float4Load(&values[i])));
+    }
+    benchmark::DoNotOptimize(result.data());
+  }
+}
+BENCHMARK(BM_FastTanhFloat4);
+
+// Benchmark of FastTanhN().
+static void BM_FastTanhN(benchmark::State& state) {
+  std::vector<float> values = TanhTestValues();
+  std::vector<float> result(kNumCalls);
+
+  for (auto _ : state) {
+    benchmark::ClobberMemory();
+    FastTanhN(values.data(), kNumCalls, result.data());
+    benchmark::DoNotOptimize(result.data());
+  }
+}
+BENCHMARK(BM_FastTanhN);
+
 // sigmoid benchmarks. _________________________________________________________
 // The sigmoid benchmarks reuse TanhTestValues() from above.
 
@@ -20,8 +20,10 @@
 //  * FftForwardScrambledTransform
 //  * FftInverseScrambledTransform
 //  * FftScramble (same as FftUnscramble)
+//  * FftForwardRealTransform
+//  * FftInverseRealTransform
 //
-// for transform sizes 64, 256, and 2014.
+// for transform sizes 64, 256, 512, 1024, 2048, 4096, and 65536.
 //
 // NOTE: When running benchmarks, build with optimizations (-c opt) and disable
 // frequency scaling (sudo cpupower frequency-set --governor performance). For
@@ -46,6 +48,12 @@ ComplexFloat* RandomValues(int size) {
   }
   return values;
 }
+
+void TransformSizes(benchmark::internal::Benchmark* b) {
+  for (int transform_size : {64, 256, 512, 1024, 2048, 4096, 65536}) {
+    b->Arg(transform_size);
+  }
+}
 }  // namespace
 
 void BM_FftForwardScrambledTransform(benchmark::State& state) {
@@ -59,7 +67,7 @@ void BM_FftForwardScrambledTransform(benchmark::State& state) {
 
   delete [] data;
 }
-BENCHMARK(BM_FftForwardScrambledTransform)->Arg(64)->Arg(256)->Arg(1024);
+BENCHMARK(BM_FftForwardScrambledTransform)->Apply(TransformSizes);
 
 void BM_FftInverseScrambledTransform(benchmark::State& state) {
   const int transform_size = state.range(0);
@@ -72,7 +80,7 @@ void BM_FftInverseScrambledTransform(benchmark::State& state) {
 
   delete [] data;
 }
-BENCHMARK(BM_FftInverseScrambledTransform)->Arg(64)->Arg(256)->Arg(1024);
+BENCHMARK(BM_FftInverseScrambledTransform)->Apply(TransformSizes);
 
 void BM_FftScramble(benchmark::State& state) {
   const int transform_size = state.range(0);
@@ -85,6 +93,32 @@ void BM_FftScramble(benchmark::State& state) {
 
   delete [] data;
 }
-BENCHMARK(BM_FftScramble)->Arg(64)->Arg(256)->Arg(1024);
+BENCHMARK(BM_FftScramble)->Apply(TransformSizes);
+
+void BM_FftForwardRealTransform(benchmark::State& state) {
+  const int transform_size = state.range(0);
+  ComplexFloat* data = RandomValues(transform_size / 2);
+
+  for (auto _ : state) {
+    FftForwardRealTransform(data, transform_size);
+    benchmark::DoNotOptimize(data);
+  }
+
+  delete [] data;
+}
+BENCHMARK(BM_FftForwardRealTransform)->Apply(TransformSizes);
+
+void BM_FftInverseRealTransform(benchmark::State& state) {
+  const int transform_size = state.range(0);
+  ComplexFloat* data = RandomValues(transform_size / 2);
+
+  for (auto _ : state) {
+    FftInverseRealTransform(data, transform_size);
+    benchmark::DoNotOptimize(data);
+  }
+
+  delete [] data;
+}
+BENCHMARK(BM_FftInverseRealTransform)->Apply(TransformSizes);
 
 BENCHMARK_MAIN();
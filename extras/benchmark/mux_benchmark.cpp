@@ -0,0 +1,131 @@
+// Copyright 2022 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+// Benchmark of the mux library.
+//
+// The benchmarks measure the times to call MuxerProcessSamples and
+// DemuxerProcessSamples, parameterized by block size in tactile-rate frames and
+// by the number of channels, 12 for the default layout or 24 for the dense
+// layout (see mux_common.h). Besides time per call, each benchmark reports
+// "x_realtime", the real-time factor as seconds of signal processed per second
+// of CPU time.
+//
+// NOTE: When running benchmarks, build with optimizations (-c opt) and disable
+// frequency scaling (sudo cpupower frequency-set --governor performance). For
+// accurate measurement, run for longer time with --benchmark_min_time=2.0.
+
+#include <random>
+
+#include "src/mux/demuxer.h"
+#include "src/mux/muxer.h"
+#include "benchmark/benchmark.h"
+
+namespace {
+// Generates a float array of random normally-distributed values.
+float* RandomValues(int size) {
+  std::random_device dev;
+  std::mt19937 rng(dev());
+  std::normal_distribution<float> dist(0.0f, 0.1f);
+
+  float* values = new float[size];
+  for (int i = 0; i < size; ++i) {
+    values[i] = dist(rng);
+  }
+  return values;
+}
+
+// Gets the layout for `num_channels`, 12 or 24.
+MuxLayout GetLayout(int num_channels) {
+  MuxLayout layout;
+  if (num_channels == 24) {
+    MuxLayoutSetDense24(&layout);
+  } else {
+    MuxLayoutSetDefault(&layout);
+  }
+  return layout;
+}
+
+void MuxArgs(benchmark::internal::Benchmark* b) {
+  b->ArgNames({"block_size", "channels"});
+  for (int num_channels : {12, 24}) {
+    for (int block_size : {8, 16, 64}) {
+      b->Args({block_size, num_channels});
+    }
+  }
+}
+
+// Reports the real-time factor, where each iteration processes
+// `seconds_per_iteration` seconds of signal.
+void SetRealTimeFactor(benchmark::State& state, double seconds_per_iteration) {
+  state.counters["x_realtime"] = benchmark::Counter(
+      seconds_per_iteration, benchmark::Counter::kIsIterationInvariantRate);
+}
+}  // namespace
+
+void BM_MuxerProcessSamples(benchmark::State& state) {
+  const int num_frames = state.range(0);
+  const MuxLayout layout = GetLayout(state.range(1));
+  Muxer* muxer = MuxerMakeWithLayout(&layout);
+  if (muxer == nullptr) {
+    state.SkipWithError("MuxerMakeWithLayout failed");
+    return;
+  }
+  float* input = RandomValues(layout.num_channels * num_frames);
+  float* output = new float[layout.rate_factor * num_frames];
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(input);
+    MuxerProcessSamples(muxer, input, num_frames, output);
+    benchmark::DoNotOptimize(output);
+  }
+
+  SetRealTimeFactor(state, num_frames / MuxLayoutTactileRate(&layout));
+  delete[] output;
+  delete[] input;
+  MuxerFree(muxer);
+}
+BENCHMARK(BM_MuxerProcessSamples)->Apply(MuxArgs);
+
+void BM_DemuxerProcessSamples(benchmark::State& state) {
+  const int num_frames = state.range(0);
+  const MuxLayout layout = GetLayout(state.range(1));
+  const int num_samples = layout.rate_factor * num_frames;
+  // Demux a realistic muxed signal, as produced by the Muxer.
+  Muxer* muxer = MuxerMakeWithLayout(&layout);
+  if (muxer == nullptr) {
+    state.SkipWithError("MuxerMakeWithLayout failed");
+    return;
+  }
+  float* tactile = RandomValues(layout.num_channels * num_frames);
+  float* muxed = new float[num_samples];
+  MuxerProcessSamples(muxer, tactile, num_frames, muxed);
+  MuxerFree(muxer);
+
+  Demuxer demuxer;
+  DemuxerInitWithLayout(&demuxer, &layout);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(muxed);
+    DemuxerProcessSamples(&demuxer, muxed, num_samples, tactile);
+    benchmark::DoNotOptimize(tactile);
+  }
+
+  SetRealTimeFactor(state, num_frames / MuxLayoutTactileRate(&layout));
+  delete[] muxed;
+  delete[] tactile;
+}
+BENCHMARK(BM_DemuxerProcessSamples)->Apply(MuxArgs);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,126 @@
+// Copyright 2022 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "extras/benchmark/perf_counters.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace {
+const char* kEventNames[PerfCounters::kNumEvents] = {
+    "cycles", "instructions", "l1d_misses", "llc_misses", "branch_misses"};
+
+#ifdef __linux__
+// Event type and config for each of PerfCounters' events.
+struct EventSpec {
+  uint32_t type;
+  uint64_t config;
+};
+const EventSpec kEventSpecs[PerfCounters::kNumEvents] = {
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+    {PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D |
+                             (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                             (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+};
+
+int OpenEvent(const EventSpec& spec) {
+  struct perf_event_attr attr;
+  memset(&attr, 0, sizeof(attr));
+  attr.size = sizeof(attr);
+  attr.type = spec.type;
+  attr.config = spec.config;
+  attr.disabled = 1;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  attr.read_format =
+      PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+  // Count the calling thread on any CPU.
+  return static_cast<int>(syscall(SYS_perf_event_open, &attr, /*pid=*/0,
+                                  /*cpu=*/-1, /*group_fd=*/-1, /*flags=*/0));
+}
+#endif  // __linux__
+}  // namespace
+
+PerfCounters::PerfCounters() {
+  for (int i = 0; i < kNumEvents; ++i) {
+#ifdef __linux__
+    fds_[i] = OpenEvent(kEventSpecs[i]);
+#else
+    fds_[i] = -1;
+#endif
+  }
+}
+
+PerfCounters::~PerfCounters() {
+#ifdef __linux__
+  for (int i = 0; i < kNumEvents; ++i) {
+    if (available(i)) { close(fds_[i]); }
+  }
+#endif
+}
+
+void PerfCounters::Start() {
+#ifdef __linux__
+  for (int i = 0; i < kNumEvents; ++i) {
+    if (available(i)) {
+      ioctl(fds_[i], PERF_EVENT_IOC_RESET, 0);
+      ioctl(fds_[i], PERF_EVENT_IOC_ENABLE, 0);
+    }
+  }
+#endif
+}
+
+void PerfCounters::StopAndReport(benchmark::State& state) {
+#ifdef __linux__
+  for (int i = 0; i < kNumEvents; ++i) {
+    if (available(i)) { ioctl(fds_[i], PERF_EVENT_IOC_DISABLE, 0); }
+  }
+#endif
+
+  double counts[kNumEvents];
+  for (int i = 0; i < kNumEvents; ++i) {
+    counts[i] = Read(i);
+    if (counts[i] >= 0.0) {
+      state.counters[kEventNames[i]] = benchmark::Counter(
+          counts[i], benchmark::Counter::kAvgIterations);
+    }
+  }
+  if (counts[kCycles] > 0.0 && counts[kInstructions] >= 0.0) {
+    state.counters["ipc"] = counts[kInstructions] / counts[kCycles];
+  }
+}
+
+double PerfCounters::Read(int event) const {
+#ifdef __linux__
+  if (available(event)) {
+    // With PERF_FORMAT_TOTAL_TIME_*, the read is {value, enabled, running}.
+    uint64_t values[3];
+    if (read(fds_[event], values, sizeof(values)) == sizeof(values) &&
+        values[2] > 0) {
+      return static_cast<double>(values[0]) * values[1] / values[2];
+    }
+  }
+#endif
+  return -1.0;  // Unavailable.
+}
@@ -0,0 +1,84 @@
+// Copyright 2022 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+// Hardware performance counters for benchmarks.
+//
+// Wall time alone doesn't tell why a change is faster, e.g. whether a new
+// layout of Enveloper state actually reduced cache misses. PerfCounters counts
+// CPU events with Linux perf_event_open over the benchmark loop and reports
+// them per iteration as Google Benchmark user counters:
+//
+//   cycles         CPU cycles
+//   instructions   retired instructions
+//   ipc            instructions per cycle
+//   l1d_misses     L1 data cache read misses
+//   llc_misses     last-level cache misses
+//   branch_misses  mispredicted branches
+//
+// Only user-space events of the calling thread are counted. Events the CPU or
+// kernel doesn't support, e.g. in a VM, or when perf_event_paranoid forbids
+// them, are omitted from the report, and on other platforms nothing is
+// reported. If the kernel multiplexes the counters, counts are scaled by the
+// fraction of time each was running.
+//
+// Example use:
+//   void BM_Foo(benchmark::State& state) {
+//     ...  // Setup.
+//     PerfCounters perf_counters;
+//     perf_counters.Start();
+//     for (auto _ : state) {
+//       Foo();
+//     }
+//     perf_counters.StopAndReport(state);
+//   }
+
+#ifndef AUDIO_TO_TACTILE_EXTRAS_BENCHMARK_PERF_COUNTERS_H_
+#define AUDIO_TO_TACTILE_EXTRAS_BENCHMARK_PERF_COUNTERS_H_
+
+#include "benchmark/benchmark.h"
+
+class PerfCounters {
+ public:
+  enum {
+    kCycles,
+    kInstructions,
+    kL1dMisses,
+    kLlcMisses,
+    kBranchMisses,
+    kNumEvents,
+  };
+
+  // Opens the counters. Unsupported events are skipped.
+  PerfCounters();
+  ~PerfCounters();
+  PerfCounters(const PerfCounters&) = delete;
+  PerfCounters& operator=(const PerfCounters&) = delete;
+
+  // Resets and starts the counters.
+  void Start();
+  // Stops the counters and adds their counts per iteration to `state.counters`.
+  void StopAndReport(benchmark::State& state);
+
+  // Returns true if `event` is counted.
+  bool available(int event) const { return fds_[event] >= 0; }
+
+ private:
+  // Reads the scaled count of `event`.
+  double Read(int event) const;
+
+  int fds_[kNumEvents];
+};
+
+#endif  // AUDIO_TO_TACTILE_EXTRAS_BENCHMARK_PERF_COUNTERS_H_
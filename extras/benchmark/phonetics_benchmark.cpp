@@ -0,0 +1,169 @@
+// Copyright 2022 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+// Benchmark of the phonetics library.
+//
+// The benchmarks measure the times to call
+//
+//  * EmbedVowel and EmbedVowelBatch
+//  * ClassifyPhoneme, ClassifyPhonemeInt8, and ClassifyPhonemeBatch
+//  * GetHexagonInterpolationWeights and GetHexagonInterpolationWeightsTable
+//
+// The networks have a fixed number of input channels. EmbedVowel is
+// parameterized by the frontend block size, the hop between frames, and
+// ClassifyPhoneme runs with its required 128-sample hop at 16 kHz. Batched
+// variants are parameterized by the number of frames per call. Besides time per
+// call, each benchmark reports "x_realtime", the real-time factor as seconds of
+// audio processed per second of CPU time.
+//
+// NOTE: When running benchmarks, build with optimizations (-c opt) and disable
+// frequency scaling (sudo cpupower frequency-set --governor performance). For
+// accurate measurement, run for longer time with --benchmark_min_time=2.0.
+
+#include <random>
+
+#include "src/phonetics/classify_phoneme.h"
+#include "src/phonetics/embed_vowel.h"
+#include "src/phonetics/hexagon_interpolation.h"
+#include "benchmark/benchmark.h"
+
+namespace {
+constexpr float kInputSampleRateHz = 16000.0f;
+// Frontend block size required by ClassifyPhoneme.
+constexpr int kClassifyPhonemeBlockSize = 128;
+
+// Generates a float array of random uniformly-distributed values in [0, 1],
+// the typical range of CARL+PCEN frames.
+float* RandomFrames(int size) {
+  std::random_device dev;
+  std::mt19937 rng(dev());
+  std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+
+  float* values = new float[size];
+  for (int i = 0; i < size; ++i) {
+    values[i] = dist(rng);
+  }
+  return values;
+}
+
+// Reports the real-time factor, where each iteration processes
+// `seconds_per_iteration` seconds of audio.
+void SetRealTimeFactor(benchmark::State& state, double seconds_per_iteration) {
+  state.counters["x_realtime"] = benchmark::Counter(
+      seconds_per_iteration, benchmark::Counter::kIsIterationInvariantRate);
+}
+}  // namespace
+
+void BM_EmbedVowel(benchmark::State& state) {
+  const int block_size = state.range(0);
+  float* frame = RandomFrames(kEmbedVowelNumChannels);
+  float coord[2];
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(frame);
+    EmbedVowel(frame, coord);
+    benchmark::DoNotOptimize(coord);
+  }
+
+  SetRealTimeFactor(state, block_size / kInputSampleRateHz);
+  delete[] frame;
+}
+BENCHMARK(BM_EmbedVowel)->ArgName("block_size")->Arg(32)->Arg(64)->Arg(128);
+
+void BM_EmbedVowelBatch(benchmark::State& state) {
+  const int num_frames = state.range(0);
+  // Default TactileProcessor block size.
+  constexpr int kBlockSize = 64;
+  float* frames = RandomFrames(num_frames * kEmbedVowelNumChannels);
+  float* coords = new float[2 * num_frames];
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(frames);
+    EmbedVowelBatch(frames, num_frames, coords);
+    benchmark::DoNotOptimize(coords);
+  }
+
+  SetRealTimeFactor(state, num_frames * kBlockSize / kInputSampleRateHz);
+  delete[] coords;
+  delete[] frames;
+}
+BENCHMARK(BM_EmbedVowelBatch)->ArgName("frames")->Arg(16)->Arg(64)->Arg(256);
+
+template <void (*ClassifyFun)(const float*, ClassifyPhonemeLabels*,
+                              ClassifyPhonemeScores*)>
+void BM_ClassifyPhoneme(benchmark::State& state) {
+  float* frames =
+      RandomFrames(kClassifyPhonemeNumFrames * kClassifyPhonemeNumChannels);
+  ClassifyPhonemeLabels labels;
+  ClassifyPhonemeScores scores;
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(frames);
+    ClassifyFun(frames, &labels, &scores);
+    benchmark::DoNotOptimize(scores);
+  }
+
+  SetRealTimeFactor(state, kClassifyPhonemeBlockSize / kInputSampleRateHz);
+  delete[] frames;
+}
+BENCHMARK_TEMPLATE(BM_ClassifyPhoneme, ClassifyPhoneme);
+BENCHMARK_TEMPLATE(BM_ClassifyPhoneme, ClassifyPhonemeInt8);
+
+void BM_ClassifyPhonemeBatch(benchmark::State& state) {
+  const int num_outputs = state.range(0);
+  float* frames = RandomFrames((num_outputs + kClassifyPhonemeNumFrames - 1) *
+                               kClassifyPhonemeNumChannels);
+  ClassifyPhonemeLabels* labels = new ClassifyPhonemeLabels[num_outputs];
+  ClassifyPhonemeScores* scores = new ClassifyPhonemeScores[num_outputs];
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(frames);
+    ClassifyPhonemeBatch(frames, num_outputs, labels, scores);
+    benchmark::DoNotOptimize(scores);
+  }
+
+  SetRealTimeFactor(
+      state, num_outputs * kClassifyPhonemeBlockSize / kInputSampleRateHz);
+  delete[] scores;
+  delete[] labels;
+  delete[] frames;
+}
+BENCHMARK(BM_ClassifyPhonemeBatch)->ArgName("frames")->Arg(16)->Arg(64);
+
+// Gets hex weights for 256 random points in the hexagon's bounding box.
+template <void (*WeightsFun)(float, float, float*)>
+void BM_HexagonInterpolationWeights(benchmark::State& state) {
+  constexpr int kNumPoints = 256;
+  float* coords = RandomFrames(2 * kNumPoints);
+  for (int i = 0; i < 2 * kNumPoints; ++i) {
+    coords[i] = 2.0f * coords[i] - 1.0f;
+  }
+  float weights[7];
+
+  for (auto _ : state) {
+    for (int i = 0; i < kNumPoints; ++i) {
+      WeightsFun(coords[2 * i], coords[2 * i + 1], weights);
+      benchmark::DoNotOptimize(weights);
+    }
+  }
+
+  delete[] coords;
+}
+BENCHMARK_TEMPLATE(BM_HexagonInterpolationWeights,
+                   GetHexagonInterpolationWeights);
+BENCHMARK_TEMPLATE(BM_HexagonInterpolationWeights,
+                   GetHexagonInterpolationWeightsTable);
+
+BENCHMARK_MAIN();
@@ -40,10 +40,13 @@ float* RandomValues(int size) {
 }  // namespace
 
 void BenchmarkQResampler(benchmark::State& state, float input_sample_rate,
-                         float output_sample_rate, int num_channels) {
+                         float output_sample_rate, int num_channels,
+                         int kernel_table_phases = 0) {
   constexpr int kNumInFrames = 1000;
+  QResamplerOptions options = kQResamplerDefaultOptions;
+  options.kernel_table_phases = kernel_table_phases;
   QResampler* resampler = QResamplerMake(input_sample_rate, output_sample_rate,
-                                         num_channels, kNumInFrames, nullptr);
+                                         num_channels, kNumInFrames, &options);
   float* data = RandomValues(kNumInFrames * num_channels);
   QResamplerProcessSamples(resampler, data, kNumInFrames);
 
@@ -77,4 +80,31 @@ void BM_Resample12Channels48To16(benchmark::State& state) {
 }
 BENCHMARK(BM_Resample12Channels48To16);
 
+// Resampling by an arbitrary factor, as for clock drift correction, with exact
+// filters (1000 phases) and with interpolated kernel tables.
+void BM_ResampleMonoDrift(benchmark::State& state) {
+  BenchmarkQResampler(state, 16000.0f, 15990.0f, 1);
+}
+BENCHMARK(BM_ResampleMonoDrift);
+
+void BM_ResampleMonoDriftInterpolated32(benchmark::State& state) {
+  BenchmarkQResampler(state, 16000.0f, 15990.0f, 1, 32);
+}
+BENCHMARK(BM_ResampleMonoDriftInterpolated32);
+
+void BM_ResampleMonoDriftInterpolated128(benchmark::State& state) {
+  BenchmarkQResampler(state, 16000.0f, 15990.0f, 1, 128);
+}
+BENCHMARK(BM_ResampleMonoDriftInterpolated128);
+
+void BM_Resample12ChannelsDrift(benchmark::State& state) {
+  BenchmarkQResampler(state, 16000.0f, 15990.0f, 12);
+}
+BENCHMARK(BM_Resample12ChannelsDrift);
+
+void BM_Resample12ChannelsDriftInterpolated32(benchmark::State& state) {
+  BenchmarkQResampler(state, 16000.0f, 15990.0f, 12, 32);
+}
+BENCHMARK(BM_Resample12ChannelsDriftInterpolated32);
+
 BENCHMARK_MAIN();
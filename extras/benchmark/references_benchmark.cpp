@@ -0,0 +1,166 @@
+// Copyright 2022 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+// Benchmarks of the reference methods in extras/references, for comparing
+// their cost with the main TactileProcessor pipeline (tactile_benchmark).
+//
+// Each benchmark is parameterized by block size, and the batch benchmarks also
+// by the number of streams. Each reports "x_realtime", the real-time factor as
+// seconds of audio processed per second of CPU time, summed over streams.
+//
+// NOTE: When running benchmarks, build with optimizations (-c opt) and disable
+// frequency scaling (sudo cpupower frequency-set --governor performance). For
+// accurate measurement, run for longer time with --benchmark_min_time=2.0.
+
+#include <random>
+
+#include "extras/references/bratakos2001/bratakos2001.h"
+#include "extras/references/yuan2005/yuan2005.h"
+#include "benchmark/benchmark.h"
+
+namespace {
+constexpr float kSampleRateHz = 16000.0f;
+
+// Generates a float array of random normally-distributed values.
+float* RandomValues(int size) {
+  std::random_device dev;
+  std::mt19937 rng(dev());
+  std::normal_distribution<float> dist(0.0f, 0.1f);
+
+  float* values = new float[size];
+  for (int i = 0; i < size; ++i) {
+    values[i] = dist(rng);
+  }
+  return values;
+}
+
+void BlockSizeArgs(benchmark::internal::Benchmark* b) {
+  b->ArgName("block_size");
+  for (int block_size : {16, 64, 256, 1024}) {
+    b->Arg(block_size);
+  }
+}
+
+void BatchArgs(benchmark::internal::Benchmark* b) {
+  b->ArgNames({"block_size", "streams"});
+  for (int block_size : {64, 256}) {
+    for (int num_streams : {1, 4, 16, 64}) {
+      b->Args({block_size, num_streams});
+    }
+  }
+}
+}  // namespace
+
+void BM_Bratakos2001ProcessSamples(benchmark::State& state) {
+  const int block_size = state.range(0);
+  Bratakos2001State bratakos2001;
+  if (!Bratakos2001Init(&bratakos2001, kSampleRateHz)) {
+    state.SkipWithError("Bratakos2001Init failed");
+    return;
+  }
+  float* input = RandomValues(block_size);
+  float* output = new float[block_size];
+
+  for (auto _ : state) {
+    Bratakos2001ProcessSamples(&bratakos2001, input, block_size, output);
+    benchmark::DoNotOptimize(output);
+  }
+
+  state.counters["x_realtime"] = benchmark::Counter(
+      block_size / kSampleRateHz, benchmark::Counter::kIsIterationInvariantRate);
+  delete[] output;
+  delete[] input;
+}
+BENCHMARK(BM_Bratakos2001ProcessSamples)->Apply(BlockSizeArgs);
+
+void BM_Bratakos2001BatchProcessSamples(benchmark::State& state) {
+  const int block_size = state.range(0);
+  const int num_streams = state.range(1);
+  Bratakos2001Batch* batch = Bratakos2001BatchMake(kSampleRateHz, num_streams);
+  if (batch == nullptr) {
+    state.SkipWithError("Bratakos2001BatchMake failed");
+    return;
+  }
+  float* input = RandomValues(block_size * num_streams);
+  float* output = new float[block_size * num_streams];
+
+  for (auto _ : state) {
+    Bratakos2001BatchProcessSamples(batch, input, block_size, output);
+    benchmark::DoNotOptimize(output);
+  }
+
+  state.counters["x_realtime"] = benchmark::Counter(
+      num_streams * block_size / kSampleRateHz,
+      benchmark::Counter::kIsIterationInvariantRate);
+  delete[] output;
+  delete[] input;
+  Bratakos2001BatchFree(batch);
+}
+BENCHMARK(BM_Bratakos2001BatchProcessSamples)->Apply(BatchArgs);
+
+void BM_Yuan2005ProcessSamples(benchmark::State& state) {
+  const int block_size = state.range(0);
+  Yuan2005Params params;
+  Yuan2005SetDefaultParams(&params);
+  params.sample_rate_hz = kSampleRateHz;
+  Yuan2005State yuan2005;
+  if (!Yuan2005Init(&yuan2005, &params)) {
+    state.SkipWithError("Yuan2005Init failed");
+    return;
+  }
+  float* input = RandomValues(block_size);
+  float* output = new float[2 * block_size];
+
+  for (auto _ : state) {
+    Yuan2005ProcessSamples(&yuan2005, input, block_size, output);
+    benchmark::DoNotOptimize(output);
+  }
+
+  state.counters["x_realtime"] = benchmark::Counter(
+      block_size / kSampleRateHz, benchmark::Counter::kIsIterationInvariantRate);
+  delete[] output;
+  delete[] input;
+}
+BENCHMARK(BM_Yuan2005ProcessSamples)->Apply(BlockSizeArgs);
+
+void BM_Yuan2005BatchProcessSamples(benchmark::State& state) {
+  const int block_size = state.range(0);
+  const int num_streams = state.range(1);
+  Yuan2005Params params;
+  Yuan2005SetDefaultParams(&params);
+  params.sample_rate_hz = kSampleRateHz;
+  Yuan2005Batch* batch = Yuan2005BatchMake(&params, num_streams);
+  if (batch == nullptr) {
+    state.SkipWithError("Yuan2005BatchMake failed");
+    return;
+  }
+  float* input = RandomValues(block_size * num_streams);
+  float* output = new float[2 * block_size * num_streams];
+
+  for (auto _ : state) {
+    Yuan2005BatchProcessSamples(batch, input, block_size, output);
+    benchmark::DoNotOptimize(output);
+  }
+
+  state.counters["x_realtime"] = benchmark::Counter(
+      num_streams * block_size / kSampleRateHz,
+      benchmark::Counter::kIsIterationInvariantRate);
+  delete[] output;
+  delete[] input;
+  Yuan2005BatchFree(batch);
+}
+BENCHMARK(BM_Yuan2005BatchProcessSamples)->Apply(BatchArgs);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,86 @@
+// Copyright 2022 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+// Benchmark of Stft library.
+//
+// The benchmarks measure the time to process 1 second of 16 kHz audio with
+// StftProcessSamples, with and without mel pooling, for frame sizes 256, 512,
+// 1024, and 2048 with hop size of a quarter frame.
+//
+// NOTE: When running benchmarks, build with optimizations (-c opt) and disable
+// frequency scaling (sudo cpupower frequency-set --governor performance). For
+// accurate measurement, run for longer time with --benchmark_min_time=2.0.
+
+#include <random>
+
+#include "src/dsp/stft.h"
+#include "benchmark/benchmark.h"
+
+namespace {
+constexpr float kSampleRateHz = 16000.0f;
+constexpr int kNumSamples = 16000;
+
+// Generates a float array of random normally-distributed values.
+float* RandomValues(int size) {
+  std::random_device dev;
+  std::mt19937 rng(dev());
+  std::normal_distribution<float> dist;
+
+  float* values = new float[size];
+  for (int i = 0; i < size; ++i) {
+    values[i] = dist(rng);
+  }
+  return values;
+}
+
+void FrameSizes(benchmark::internal::Benchmark* b) {
+  for (int frame_size : {256, 512, 1024, 2048}) {
+    b->Arg(frame_size);
+  }
+}
+
+void BenchmarkStft(benchmark::State& state, StftPooling pooling) {
+  const int frame_size = state.range(0);
+  StftOptions options = kStftDefaultOptions;
+  options.pooling = pooling;
+  options.num_bands = 40;
+  Stft* stft = StftMake(kSampleRateHz, frame_size, frame_size / 4, &options);
+  float* input = RandomValues(kNumSamples);
+  float* output = new float[StftNextNumFrames(stft, kNumSamples) *
+                             StftNumOutputs(stft)];
+
+  for (auto _ : state) {
+    StftReset(stft);
+    StftProcessSamples(stft, input, kNumSamples, output);
+    benchmark::DoNotOptimize(output);
+  }
+
+  delete[] output;
+  delete[] input;
+  StftFree(stft);
+}
+}  // namespace
+
+void BM_StftPowerSpectrum(benchmark::State& state) {
+  BenchmarkStft(state, kStftNoPooling);
+}
+BENCHMARK(BM_StftPowerSpectrum)->Apply(FrameSizes);
+
+void BM_StftMelPooling(benchmark::State& state) {
+  BenchmarkStft(state, kStftMelPooling);
+}
+BENCHMARK(BM_StftMelPooling)->Apply(FrameSizes);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,573 @@
+// Copyright 2022 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+// Benchmark of the tactile library.
+//
+// The benchmarks measure the times to call
+//
+//  * TactileProcessorProcessSamples, by block size and decimation factor
+//  * TactileProcessorProcessSamples on silence after sound, where IIR filter
+//    states decay toward denormals (see dsp/denormals.h)
+//  * TactileProcessorBatchProcessSamples, by block size and number of streams
+//  * TactileProcessorProcessCapture on 48 kHz capture buffers, compared to
+//    running QResampler as a separate pass and buffering blocks, by capture
+//    buffer size
+//  * EnveloperProcessSamples, by block size and decimation factor
+//  * EnveloperProcessSamplesChannelMajor, and EnveloperProcessSamplesMultirate
+//    with the baseband filtered at a reduced rate, by block size and
+//    decimation factor
+//  * MultibandEnveloperProcessSamples, by number of bands
+//  * PostProcessorProcessSamples, by block size, decimation factor, and number
+//    of channels
+//  * PostProcessorProcessSamplesToPwm, the fused post processing, channel
+//    mapping, and PWM conversion, compared to running them as separate passes
+//  * TactilePatternSynthesize, by block size and number of channels
+//
+// Besides time per call, each benchmark reports "x_realtime", the real-time
+// factor as seconds of signal processed per second of CPU time. For instance,
+// x_realtime = 100 means processing is 100 times faster than real time. The
+// Enveloper benchmarks also report hardware performance counters per call,
+// including cache misses (see perf_counters.h).
+//
+// NOTE: When running benchmarks, build with optimizations (-c opt) and disable
+// frequency scaling (sudo cpupower frequency-set --governor performance). For
+// accurate measurement, run for longer time with --benchmark_min_time=2.0.
+
+#include <algorithm>
+#include <random>
+
+#include "extras/benchmark/perf_counters.h"
+#include "src/dsp/channel_map.h"
+#include "src/dsp/q_resampler.h"
+#include "src/tactile/enveloper.h"
+#include "src/tactile/multiband_enveloper.h"
+#include "src/tactile/post_processor.h"
+#include "src/tactile/tactile_pattern.h"
+#include "src/tactile/tactile_processor.h"
+#include "src/tactile/tactile_processor_batch.h"
+#include "benchmark/benchmark.h"
+
+namespace {
+constexpr float kInputSampleRateHz = 16000.0f;
+
+// Generates a float array of random normally-distributed values.
+float* RandomValues(int size) {
+  std::random_device dev;
+  std::mt19937 rng(dev());
+  std::normal_distribution<float> dist(0.0f, 0.1f);
+
+  float* values = new float[size];
+  for (int i = 0; i < size; ++i) {
+    values[i] = dist(rng);
+  }
+  return values;
+}
+
+// Reports the real-time factor, where each iteration processes
+// `seconds_per_iteration` seconds of signal.
+void SetRealTimeFactor(benchmark::State& state, double seconds_per_iteration) {
+  state.counters["x_realtime"] = benchmark::Counter(
+      seconds_per_iteration, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+// Args (block_size, decimation_factor). With the default CarlFrontend params,
+// the block size is at most 64 (see pcen_cross_channel_diffusivity).
+void BlockSizesAndDecimations(benchmark::internal::Benchmark* b) {
+  b->ArgNames({"block_size", "decimation"});
+  for (int block_size : {16, 32, 64}) {
+    for (int decimation_factor : {1, 2, 4, 8}) {
+      b->Args({block_size, decimation_factor});
+    }
+  }
+}
+}  // namespace
+
+void BM_TactileProcessorProcessSamples(benchmark::State& state) {
+  const int block_size = state.range(0);
+  const int decimation_factor = state.range(1);
+  TactileProcessorParams params;
+  TactileProcessorSetDefaultParams(&params);
+  params.frontend_params.input_sample_rate_hz = kInputSampleRateHz;
+  params.frontend_params.block_size = block_size;
+  params.decimation_factor = decimation_factor;
+  TactileProcessor* processor = TactileProcessorMake(&params);
+  if (processor == nullptr) {
+    state.SkipWithError("TactileProcessorMake failed");
+    return;
+  }
+  float* input = RandomValues(block_size);
+  float* output = new float[kTactileProcessorNumTactors * block_size /
+                            decimation_factor];
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(input);
+    TactileProcessorProcessSamples(processor, input, output);
+    benchmark::DoNotOptimize(output);
+  }
+
+  SetRealTimeFactor(state, block_size / kInputSampleRateHz);
+  delete[] output;
+  delete[] input;
+  TactileProcessorFree(processor);
+}
+BENCHMARK(BM_TactileProcessorProcessSamples)->Apply(BlockSizesAndDecimations);
+
+constexpr float kCaptureSampleRateHz = 48000.0f;
+constexpr int kCaptureBlockSize = 64;
+
+TactileProcessor* MakeCaptureProcessor(float capture_sample_rate_hz) {
+  TactileProcessorParams params;
+  TactileProcessorSetDefaultParams(&params);
+  params.frontend_params.input_sample_rate_hz = kInputSampleRateHz;
+  params.frontend_params.block_size = kCaptureBlockSize;
+  params.capture_sample_rate_hz = capture_sample_rate_hz;
+  return TactileProcessorMake(&params);
+}
+
+// Benchmark of resampling 48 kHz capture buffers with a separate QResampler
+// pass, buffering the output into blocks for TactileProcessorProcessSamples.
+void BM_TactileProcessorSeparateResampling(benchmark::State& state) {
+  const int capture_frames = state.range(0);
+  TactileProcessor* processor = MakeCaptureProcessor(0.0f);
+  QResampler* resampler = QResamplerMake(
+      kCaptureSampleRateHz, kInputSampleRateHz, 1, capture_frames, nullptr);
+  if (processor == nullptr || resampler == nullptr) {
+    state.SkipWithError("Make failed");
+    return;
+  }
+  float* input = RandomValues(capture_frames);
+  float* block = new float[kCaptureBlockSize];
+  float* output = new float[kTactileProcessorNumTactors *
+                            (QResamplerMaxOutputFrames(resampler) +
+                             kCaptureBlockSize)];
+  int block_fill = 0;
+
+  for (auto _ : state) {
+    const int num_resampled =
+        QResamplerProcessSamples(resampler, input, capture_frames);
+    const float* resampled = QResamplerOutput(resampler);
+    float* dest = output;
+    for (int i = 0; i < num_resampled;) {
+      const int n = std::min(num_resampled - i, kCaptureBlockSize - block_fill);
+      std::copy(resampled + i, resampled + i + n, block + block_fill);
+      i += n;
+      block_fill += n;
+      if (block_fill == kCaptureBlockSize) {
+        TactileProcessorProcessSamples(processor, block, dest);
+        dest += kTactileProcessorNumTactors * kCaptureBlockSize;
+        block_fill = 0;
+      }
+    }
+    benchmark::DoNotOptimize(output);
+  }
+
+  SetRealTimeFactor(state, capture_frames / kCaptureSampleRateHz);
+  delete[] output;
+  delete[] block;
+  delete[] input;
+  QResamplerFree(resampler);
+  TactileProcessorFree(processor);
+}
+BENCHMARK(BM_TactileProcessorSeparateResampling)
+    ->ArgName("capture_frames")->Arg(480)->Arg(1024);
+
+// Benchmark of TactileProcessorProcessCapture, which resamples 48 kHz capture
+// buffers directly into the processor's blocks.
+void BM_TactileProcessorProcessCapture(benchmark::State& state) {
+  const int capture_frames = state.range(0);
+  TactileProcessor* processor = MakeCaptureProcessor(kCaptureSampleRateHz);
+  if (processor == nullptr) {
+    state.SkipWithError("TactileProcessorMake failed");
+    return;
+  }
+  float* input = RandomValues(capture_frames);
+  const int max_output_frames =
+      capture_frames * kInputSampleRateHz / kCaptureSampleRateHz +
+      2 * kCaptureBlockSize;
+  float* output = new float[kTactileProcessorNumTactors * max_output_frames];
+
+  for (auto _ : state) {
+    TactileProcessorProcessCapture(processor, input, capture_frames, output);
+    benchmark::DoNotOptimize(output);
+  }
+
+  SetRealTimeFactor(state, capture_frames / kCaptureSampleRateHz);
+  delete[] output;
+  delete[] input;
+  TactileProcessorFree(processor);
+}
+BENCHMARK(BM_TactileProcessorProcessCapture)
+    ->ArgName("capture_frames")->Arg(480)->Arg(1024);
+
+void BM_TactileProcessorProcessSilence(benchmark::State& state) {
+  const int block_size = state.range(0);
+  const int decimation_factor = state.range(1);
+  TactileProcessorParams params;
+  TactileProcessorSetDefaultParams(&params);
+  params.frontend_params.input_sample_rate_hz = kInputSampleRateHz;
+  params.frontend_params.block_size = block_size;
+  params.decimation_factor = decimation_factor;
+  TactileProcessor* processor = TactileProcessorMake(&params);
+  if (processor == nullptr) {
+    state.SkipWithError("TactileProcessorMake failed");
+    return;
+  }
+  float* input = RandomValues(block_size);
+  float* output = new float[kTactileProcessorNumTactors * block_size /
+                            decimation_factor];
+  // Process one block of noise, then 30 s of silence so that filter tails
+  // have decayed to where they would be denormal without protection.
+  TactileProcessorProcessSamples(processor, input, output);
+  std::fill(input, input + block_size, 0.0f);
+  const int num_silent_blocks = 30 * kInputSampleRateHz / block_size;
+  for (int i = 0; i < num_silent_blocks; ++i) {
+    TactileProcessorProcessSamples(processor, input, output);
+  }
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(input);
+    TactileProcessorProcessSamples(processor, input, output);
+    benchmark::DoNotOptimize(output);
+  }
+
+  SetRealTimeFactor(state, block_size / kInputSampleRateHz);
+  delete[] output;
+  delete[] input;
+  TactileProcessorFree(processor);
+}
+BENCHMARK(BM_TactileProcessorProcessSilence)->Apply(BlockSizesAndDecimations);
+
+void BM_TactileProcessorBatchProcessSamples(benchmark::State& state) {
+  const int block_size = state.range(0);
+  const int num_streams = state.range(1);
+  TactileProcessorParams params;
+  TactileProcessorSetDefaultParams(&params);
+  params.frontend_params.input_sample_rate_hz = kInputSampleRateHz;
+  params.frontend_params.block_size = block_size;
+  TactileProcessorBatch* batch = TactileProcessorBatchMake(&params,
+                                                           num_streams);
+  if (batch == nullptr) {
+    state.SkipWithError("TactileProcessorBatchMake failed");
+    return;
+  }
+  float* input = RandomValues(block_size * num_streams);
+  float* output = new float[kTactileProcessorNumTactors * block_size *
+                            num_streams];
+  const float** inputs = new const float*[num_streams];
+  float** outputs = new float*[num_streams];
+  for (int i = 0; i < num_streams; ++i) {
+    inputs[i] = input + block_size * i;
+    outputs[i] = output + kTactileProcessorNumTactors * block_size * i;
+  }
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(input);
+    TactileProcessorBatchProcessSamples(batch, inputs, outputs);
+    benchmark::DoNotOptimize(output);
+  }
+
+  // Real-time factor of the total signal duration over all streams.
+  SetRealTimeFactor(state, num_streams * block_size / kInputSampleRateHz);
+  delete[] outputs;
+  delete[] inputs;
+  delete[] output;
+  delete[] input;
+  TactileProcessorBatchFree(batch);
+}
+BENCHMARK(BM_TactileProcessorBatchProcessSamples)
+    ->Apply([](benchmark::internal::Benchmark* b) {
+      b->ArgNames({"block_size", "streams"});
+      for (int block_size : {32, 64}) {
+        for (int num_streams : {1, 4, 16}) {
+          b->Args({block_size, num_streams});
+        }
+      }
+    });
+
+void BM_EnveloperProcessSamples(benchmark::State& state) {
+  const int block_size = state.range(0);
+  const int decimation_factor = state.range(1);
+  Enveloper enveloper;
+  if (!EnveloperInit(&enveloper, &kDefaultEnveloperParams, kInputSampleRateHz,
+                     decimation_factor)) {
+    state.SkipWithError("EnveloperInit failed");
+    return;
+  }
+  float* input = RandomValues(block_size);
+  float* output =
+      new float[kEnveloperNumChannels * block_size / decimation_factor];
+
+  PerfCounters perf_counters;
+  perf_counters.Start();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(input);
+    EnveloperProcessSamples(&enveloper, input, block_size, output);
+    benchmark::DoNotOptimize(output);
+  }
+  perf_counters.StopAndReport(state);
+
+  SetRealTimeFactor(state, block_size / kInputSampleRateHz);
+  delete[] output;
+  delete[] input;
+}
+BENCHMARK(BM_EnveloperProcessSamples)->Apply(BlockSizesAndDecimations);
+
+// Benchmarks an Enveloper processing function `fun` like
+// EnveloperProcessSamplesChannelMajor.
+static void BenchmarkEnveloperFun(benchmark::State& state,
+                                  void (*fun)(Enveloper*, const float*, int,
+                                              float*)) {
+  const int block_size = state.range(0);
+  const int decimation_factor = state.range(1);
+  Enveloper enveloper;
+  if (!EnveloperInit(&enveloper, &kDefaultEnveloperParams, kInputSampleRateHz,
+                     decimation_factor)) {
+    state.SkipWithError("EnveloperInit failed");
+    return;
+  }
+  float* input = RandomValues(block_size);
+  float* output =
+      new float[kEnveloperNumChannels * block_size / decimation_factor];
+
+  PerfCounters perf_counters;
+  perf_counters.Start();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(input);
+    fun(&enveloper, input, block_size, output);
+    benchmark::DoNotOptimize(output);
+  }
+  perf_counters.StopAndReport(state);
+
+  SetRealTimeFactor(state, block_size / kInputSampleRateHz);
+  delete[] output;
+  delete[] input;
+}
+
+void BM_EnveloperProcessSamplesChannelMajor(benchmark::State& state) {
+  BenchmarkEnveloperFun(state, EnveloperProcessSamplesChannelMajor);
+}
+BENCHMARK(BM_EnveloperProcessSamplesChannelMajor)
+    ->Apply(BlockSizesAndDecimations);
+
+void BM_EnveloperProcessSamplesMultirate(benchmark::State& state) {
+  BenchmarkEnveloperFun(state, EnveloperProcessSamplesMultirate);
+}
+BENCHMARK(BM_EnveloperProcessSamplesMultirate)
+    ->Apply(BlockSizesAndDecimations);
+
+void BM_MultibandEnveloperProcessSamples(benchmark::State& state) {
+  constexpr int kBlockSize = 64;
+  constexpr int kDecimationFactor = 8;
+  const int num_bands = state.range(0);
+  MultibandEnveloperParams params = kDefaultMultibandEnveloperParams;
+  MultibandEnveloper enveloper;
+  if (!MultibandEnveloperSetLogSpacedBands(&params, num_bands, 80.0f,
+                                           6000.0f) ||
+      !MultibandEnveloperInit(&enveloper, &params, kInputSampleRateHz,
+                              kDecimationFactor)) {
+    state.SkipWithError("MultibandEnveloperInit failed");
+    return;
+  }
+  float* input = RandomValues(kBlockSize);
+  float* output = new float[num_bands * kBlockSize / kDecimationFactor];
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(input);
+    MultibandEnveloperProcessSamples(&enveloper, input, kBlockSize, output);
+    benchmark::DoNotOptimize(output);
+  }
+
+  SetRealTimeFactor(state, kBlockSize / kInputSampleRateHz);
+  delete[] output;
+  delete[] input;
+}
+BENCHMARK(BM_MultibandEnveloperProcessSamples)
+    ->ArgName("bands")
+    ->Arg(4)
+    ->Arg(8)
+    ->Arg(16)
+    ->Arg(24);
+
+void BM_PostProcessorProcessSamples(benchmark::State& state) {
+  const int block_size = state.range(0);
+  const int decimation_factor = state.range(1);
+  const int num_channels = state.range(2);
+  // PostProcessor runs on TactileProcessor output, at the decimated rate.
+  const float sample_rate_hz = kInputSampleRateHz / decimation_factor;
+  const int num_frames = block_size / decimation_factor;
+  PostProcessorParams params;
+  PostProcessorSetDefaultParams(&params);
+  PostProcessor post_processor;
+  if (!PostProcessorInit(&post_processor, &params, sample_rate_hz,
+                         num_channels)) {
+    state.SkipWithError("PostProcessorInit failed");
+    return;
+  }
+  const int num_samples = num_frames * num_channels;
+  float* input = RandomValues(num_samples);
+  float* data = new float[num_samples];
+
+  for (auto _ : state) {
+    // Processing is in place. Restore the input on each iteration, since
+    // repeatedly filtering the output decays it into slow denormals.
+    std::copy(input, input + num_samples, data);
+    PostProcessorProcessSamples(&post_processor, data, num_frames);
+    benchmark::DoNotOptimize(data);
+  }
+
+  SetRealTimeFactor(state, num_frames / sample_rate_hz);
+  delete[] data;
+  delete[] input;
+}
+BENCHMARK(BM_PostProcessorProcessSamples)
+    ->Apply([](benchmark::internal::Benchmark* b) {
+      b->ArgNames({"block_size", "decimation", "channels"});
+      for (int block_size : {64, 128}) {
+        for (int decimation_factor : {1, 4}) {
+          for (int num_channels : {1, 4, 10, 12, 24}) {
+            b->Args({block_size, decimation_factor, num_channels});
+          }
+        }
+      }
+    });
+
+// Sets up a PostProcessor, 10 to 12 channel map, and PWM destination pointers
+// like the sleeve firmware's, for benchmarking PWM output.
+constexpr int kPwmNumChannels = 12;
+constexpr int kPwmTopValue = 512;
+constexpr int kPwmStride = 4;
+
+bool InitPostProcessorToPwm(float sample_rate_hz, PostProcessor* post_processor,
+                            ChannelMap* channel_map) {
+  PostProcessorParams params;
+  PostProcessorSetDefaultParams(&params);
+  if (!PostProcessorInit(post_processor, &params, sample_rate_hz,
+                         kTactileProcessorNumTactors)) {
+    return false;
+  }
+  channel_map->num_input_channels = kTactileProcessorNumTactors;
+  channel_map->num_output_channels = kPwmNumChannels;
+  for (int c = 0; c < kPwmNumChannels; ++c) {
+    channel_map->sources[c] = c % kTactileProcessorNumTactors;
+    channel_map->gains[c] = 0.8f;
+  }
+  return true;
+}
+
+// Benchmark of PostProcessorProcessSamples, ChannelMapApply, and PWM
+// conversion as separate passes.
+void BM_PostProcessorSeparatePassesToPwm(benchmark::State& state) {
+  const int num_frames = state.range(0);
+  const float sample_rate_hz = kInputSampleRateHz / 4;
+  PostProcessor post_processor;
+  ChannelMap channel_map;
+  if (!InitPostProcessorToPwm(sample_rate_hz, &post_processor, &channel_map)) {
+    state.SkipWithError("PostProcessorInit failed");
+    return;
+  }
+  const int num_samples = num_frames * kTactileProcessorNumTactors;
+  float* input = RandomValues(num_samples);
+  float* data = new float[num_samples];
+  float* mapped = new float[num_frames * kPwmNumChannels];
+  uint16_t* pwm = new uint16_t[num_frames * kPwmNumChannels];
+
+  for (auto _ : state) {
+    std::copy(input, input + num_samples, data);
+    PostProcessorProcessSamples(&post_processor, data, num_frames);
+    ChannelMapApply(&channel_map, data, num_frames, mapped);
+    for (int c = 0; c < kPwmNumChannels; ++c) {
+      uint16_t* dest =
+          pwm + num_frames * kPwmStride * (c / kPwmStride) + c % kPwmStride;
+      for (int i = 0; i < num_frames; ++i) {
+        dest[i * kPwmStride] = static_cast<uint16_t>(
+            0.5f * kPwmTopValue * mapped[c + kPwmNumChannels * i] +
+            (0.5f * kPwmTopValue + 0.5f));
+      }
+    }
+    benchmark::DoNotOptimize(pwm);
+  }
+
+  SetRealTimeFactor(state, num_frames / sample_rate_hz);
+  delete[] pwm;
+  delete[] mapped;
+  delete[] data;
+  delete[] input;
+}
+BENCHMARK(BM_PostProcessorSeparatePassesToPwm)->Arg(8)->Arg(64);
+
+// Benchmark of the fused PostProcessorProcessSamplesToPwm.
+void BM_PostProcessorProcessSamplesToPwm(benchmark::State& state) {
+  const int num_frames = state.range(0);
+  const float sample_rate_hz = kInputSampleRateHz / 4;
+  PostProcessor post_processor;
+  ChannelMap channel_map;
+  if (!InitPostProcessorToPwm(sample_rate_hz, &post_processor, &channel_map)) {
+    state.SkipWithError("PostProcessorInit failed");
+    return;
+  }
+  const int num_samples = num_frames * kTactileProcessorNumTactors;
+  float* input = RandomValues(num_samples);
+  uint16_t* pwm = new uint16_t[num_frames * kPwmNumChannels];
+  uint16_t* pwm_channels[kPwmNumChannels];
+  for (int c = 0; c < kPwmNumChannels; ++c) {
+    pwm_channels[c] =
+        pwm + num_frames * kPwmStride * (c / kPwmStride) + c % kPwmStride;
+  }
+
+  for (auto _ : state) {
+    PostProcessorProcessSamplesToPwm(&post_processor, &channel_map, input,
+                                     num_frames, kPwmTopValue, pwm_channels,
+                                     kPwmStride);
+    benchmark::DoNotOptimize(pwm);
+  }
+
+  SetRealTimeFactor(state, num_frames / sample_rate_hz);
+  delete[] pwm;
+  delete[] input;
+}
+BENCHMARK(BM_PostProcessorProcessSamplesToPwm)->Arg(8)->Arg(64);
+
+void BM_TactilePatternSynthesize(benchmark::State& state) {
+  const int num_frames = state.range(0);
+  const int num_channels = state.range(1);
+  // Synthesize at the TactileProcessor output rate with decimation 8.
+  const float sample_rate_hz = kInputSampleRateHz / 8;
+  const char* kPattern = "0123456789ABCDEF/-";
+  TactilePattern pattern;
+  TactilePatternInit(&pattern, sample_rate_hz, num_channels);
+  TactilePatternStart(&pattern, kPattern);
+  float* output = new float[num_frames * num_channels];
+
+  for (auto _ : state) {
+    if (!TactilePatternSynthesize(&pattern, num_frames, output)) {
+      TactilePatternStart(&pattern, kPattern);  // Loop the pattern.
+    }
+    benchmark::DoNotOptimize(output);
+  }
+
+  SetRealTimeFactor(state, num_frames / sample_rate_hz);
+  delete[] output;
+}
+BENCHMARK(BM_TactilePatternSynthesize)
+    ->Apply([](benchmark::internal::Benchmark* b) {
+      b->ArgNames({"block_size", "channels"});
+      for (int num_frames : {8, 16, 64}) {
+        for (int num_channels : {1, 4, 10, 12}) {
+          b->Args({num_frames, num_channels});
+        }
+      }
+    });
+
+BENCHMARK_MAIN();
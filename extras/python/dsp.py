@@ -21,6 +21,7 @@ import numpy as np
 
 from extras.python import fast_fun_python_bindings
 from extras.python import q_resampler_python_bindings
+from extras.python import stft_python_bindings
 from extras.python import wav_io_python_bindings
 
 
@@ -253,6 +254,79 @@ class ResamplerKernel:
     return self._impl.radians_per_sample
 
 
+class Stft:
+  """Python bindings for Stft, a streaming power spectrogram."""
+
+  _POOLING = {'none': 0, 'mel': 1, 'erb': 2}
+
+  def __init__(self,
+               sample_rate_hz: float,
+               frame_size: int,
+               hop_size: int,
+               window: Optional[Iterable[float]] = None,
+               pooling: str = 'none',
+               num_bands: int = 40,
+               min_frequency_hz: float = 0.0,
+               max_frequency_hz: float = 0.0):
+    """Constructor, wraps `StftMake()`.
+
+    Args:
+      sample_rate_hz: Float, input audio sample rate in Hz.
+      frame_size: Integer, frame size, a power of 2 between 4 and 65536.
+      hop_size: Integer, hop between successive frames, between 1 and
+        frame_size.
+      window: Optional array of frame_size window values. If None, a periodic
+        Hann window is used.
+      pooling: String, 'none' to output the power spectrum bins, or 'mel' or
+        'erb' to pool into triangular bands on the mel or ERB-rate scale.
+      num_bands: Integer, number of pooled bands.
+      min_frequency_hz: Float, low end of the pooled bands in Hz.
+      max_frequency_hz: Float, high end of the pooled bands in Hz, or 0 for the
+        Nyquist frequency.
+
+    Raises:
+      ValueError: if parameters are invalid. (In this case, the C library may
+        write additional details to stderr.)
+    """
+    if pooling not in self._POOLING:
+      raise ValueError(f'pooling must be one of {list(self._POOLING)}')
+    self._impl = stft_python_bindings.StftImpl(
+        sample_rate_hz,
+        frame_size,
+        hop_size,
+        window=window,
+        pooling=self._POOLING[pooling],
+        num_bands=num_bands,
+        min_frequency_hz=min_frequency_hz,
+        max_frequency_hz=max_frequency_hz)
+
+  def reset(self) -> None:
+    """Resets to initial state."""
+    self._impl.reset()
+
+  def process_samples(self, samples: np.ndarray) -> np.ndarray:
+    """Processes samples in a streaming manner.
+
+    Args:
+      samples: 1D numpy array with np.float32 dtype of input samples.
+
+    Returns:
+      2D numpy array of shape (num_frames, num_outputs) of the power spectra
+      (or pooled bands) of the frames completed by `samples`.
+    """
+    return self._impl.process_samples(samples)
+
+  @property
+  def num_outputs(self) -> int:
+    """Number of outputs per frame, the number of bins or bands."""
+    return self._impl.num_outputs
+
+  @property
+  def frequencies_hz(self) -> np.ndarray:
+    """Center frequency in Hz of each output bin or band."""
+    return self._impl.frequencies_hz
+
+
 def read_wav_file(filename: Union[str, IO[bytes]],
                   dtype: Optional[np.dtype] = None) -> Tuple[np.ndarray, int]:
   """Reads a WAV audio file.
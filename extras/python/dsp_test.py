@@ -344,6 +344,42 @@ class ResamplerTest(unittest.TestCase):
                                    err_msg=message)
 
 
+class StftTest(unittest.TestCase):
+
+  def test_sinusoid_power(self):
+    """A bin-centered sinusoid of amplitude A has power A^2 / 4."""
+    stft = dsp.Stft(16000.0, 256, 64)
+    self.assertEqual(stft.num_outputs, 129)
+    np.testing.assert_allclose(stft.frequencies_hz[20], 1250.0)
+    n = np.arange(256)
+    output = stft.process_samples(0.5 * np.cos(2 * np.pi * 20 * n / 256))
+    self.assertEqual(output.shape, (1, 129))
+    self.assertAlmostEqual(output[0, 20], 0.0625, delta=1e-5)
+
+  def test_streaming(self):
+    """Streaming in blocks matches processing all at once."""
+    np.random.seed(0)
+    input_samples = np.random.randn(3000).astype(np.float32)
+    for pooling in ('none', 'mel', 'erb'):
+      stft = dsp.Stft(16000.0, 512, 160, pooling=pooling, num_bands=24)
+      nonstreaming = stft.process_samples(input_samples)
+      self.assertEqual(nonstreaming.shape,
+                       ((3000 - 512) // 160 + 1, stft.num_outputs))
+
+      stft.reset()
+      streaming = np.vstack([stft.process_samples(block)
+                             for block in np.split(input_samples, [97, 1100])])
+      np.testing.assert_array_equal(streaming, nonstreaming)
+
+  def test_invalid_args(self):
+    with self.assertRaises(ValueError):
+      dsp.Stft(16000.0, 100, 50)
+    with self.assertRaises(ValueError):
+      dsp.Stft(16000.0, 256, 64, pooling='bark')
+    with self.assertRaises(ValueError):
+      dsp.Stft(16000.0, 256, 64, window=np.ones(100))
+
+
 def make_24_bit_wav(samples, sample_rate_hz):
   """Makes a 24-bit WAV."""
   num_frames, num_channels = samples.shape
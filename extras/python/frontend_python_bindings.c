@@ -35,8 +35,15 @@
  *                pcen_alpha=0.7,
  *                pcen_beta=0.2,
  *                pcen_gamma=1e-12,
- *                pcen_delta=0.001)
- *    """Constructor. [Wraps `CarlFrontendMake()` in the C library.]
+ *                pcen_delta=0.001,
+ *                min_samples_per_cycle=6.0,
+ *                first_output_channel=0,
+ *                num_output_channels=0)
+ *    """Constructor. [Wraps `CarlFrontendMakeCached()` in the C library.]
+ *
+ *    Channel designs are cached for the lifetime of the module, so that
+ *    constructing another CarlFrontend with the same parameters, other than
+ *    PCEN parameters, is fast.
  *
  *    Args:
  *      The arguments correspond to the CarlFrontendParams in carl_frontend.h in
@@ -57,15 +64,68 @@
  *  def reset(self)
  *    """Resets CarlFrontend to initial state. [Wraps `CarlFrontendReset()`.]"""
  *
- *  def process_samples(self, input_samples)
+ *  def process_samples(self, input_samples, out=None)
  *    """Process samples in a streaming manner.
  *
  *    Calls the C function `CarlFrontendProcessSamples()` on each input block.
+ *    The GIL is released while processing, so that different CarlFrontend
+ *    objects may run in parallel threads. A CarlFrontend object should be used
+ *    by only one thread at a time, otherwise RuntimeError is raised.
  *
  *    Args:
  *      input_samples: numpy array. NOTE: Size must be a multiple of block_size.
+ *        If it is C-contiguous float32, or any object supporting the buffer
+ *        protocol with such data, it is read without copying the whole array.
+ *      out: (Optional) Writable C-contiguous float32 buffer with
+ *        `len(input_samples) / block_size * num_channels` elements. If passed,
+ *        output is written to it and it is returned instead of allocating a
+ *        new array.
  *    Returns:
- *      2-D array of shape (len(input_samples)/block_size, num_channels).
+ *      2-D array of shape (len(input_samples)/block_size, num_channels), or
+ *      `out`.
+ *    """
+ *
+ * class CarlFrontendBatch(object):
+ *
+ *   def __init__(self, num_streams, input_sample_rate_hz=16000.0, ...)
+ *    """Constructor for processing `num_streams` independent streams at once.
+ *
+ *    Args are the same as for CarlFrontend, plus `num_streams`. Streams are
+ *    processed in lockstep by `TactileProcessorBatchProcessFrontend()`, with
+ *    filter state in struct-of-arrays layout so that the C inner loops
+ *    vectorize across streams.
+ *    """
+ *
+ *  @property
+ *  def num_streams(self)
+ *    """Number of streams."""
+ *
+ *  @property
+ *  def num_channels(self)
+ *    """Number of output channels."""
+ *
+ *  @property
+ *  def block_size(self)
+ *    """The block_size."""
+ *
+ *  def reset(self)
+ *    """Resets all streams to initial state."""
+ *
+ *  def reset_stream(self, stream)
+ *    """Resets one stream to initial state."""
+ *
+ *  def process_samples(self, input_samples, out=None)
+ *    """Process samples of all streams in a streaming manner.
+ *
+ *    Args:
+ *      input_samples: 2-D numpy array of shape (num_streams, num_samples),
+ *        where num_samples is a multiple of block_size.
+ *      out: (Optional) Writable C-contiguous float32 buffer with
+ *        `num_streams * num_samples / block_size * num_channels` elements.
+ *    Returns:
+ *      3-D array of shape
+ *      (num_streams, num_samples / block_size, num_channels), or `out`. For
+ *      each stream, this is the same as CarlFrontend.process_samples().
  *    """
  *
  * NOTE: Using a tool like CLIF is generally a better idea than writing bindings
@@ -84,12 +144,28 @@
 #include "Python.h"
 /* Disallow Numpy 1.7 deprecated symbols. */
 #define NPY_NO_DEPRECATED_API NPY_1_7_API_VERSION
+#include <stdlib.h>
+
 #include "src/frontend/carl_frontend.h"
+#include "src/tactile/tactile_processor_batch.h"
+#include "extras/python/python_buffer.h"
 #include "numpy/arrayobject.h"
+#include "structmember.h"
+
+/* Cache of channel designs, shared by all CarlFrontend objects. It is only
+ * accessed with the GIL held.
+ */
+static CarlFrontendDesignCache* g_design_cache = NULL;
 
 typedef struct {
   PyObject_HEAD
   CarlFrontend* frontend;
+  /* Copy of one input block, since CarlFrontendProcessSamples() overwrites
+   * its input.
+   */
+  float* block_buffer;
+  /* Nonzero while process_samples is running with the GIL released. */
+  int busy;
 } CarlFrontendObject;
 
 /* Define `CarlFrontend.__init__`. */
@@ -109,28 +185,46 @@ static int CarlFrontendObjectInit(CarlFrontendObject* self, PyObject* args,
                                    "pcen_beta",
                                    "pcen_gamma",
                                    "pcen_delta",
+                                   "min_samples_per_cycle",
+                                   "first_output_channel",
+                                   "num_output_channels",
                                    NULL};
 
   if (!PyArg_ParseTupleAndKeywords(
-          args, kw, "|fifffffffffff:__init__", (char**)keywords,
+          args, kw, "|fiffffffffffffii:__init__", (char**)keywords,
           &params.input_sample_rate_hz, &params.block_size,
           &params.highest_pole_frequency_hz, &params.min_pole_frequency_hz,
           &params.step_erbs, &params.envelope_cutoff_hz,
           &params.pcen_time_constant_s, &params.pcen_cross_channel_diffusivity,
           &params.pcen_init_value, &params.pcen_alpha, &params.pcen_beta,
-          &params.pcen_gamma, &params.pcen_delta)) {
+          &params.pcen_gamma, &params.pcen_delta,
+          &params.min_samples_per_cycle, &params.first_output_channel,
+          &params.num_output_channels)) {
     return -1;  /* PyArg_ParseTupleAndKeywords failed. */
   }
 
-  self->frontend = CarlFrontendMake(&params);
+  if (g_design_cache == NULL &&
+      (g_design_cache = CarlFrontendDesignCacheMake()) == NULL) {
+    PyErr_NoMemory();
+    return -1;
+  }
+  CarlFrontendFree(self->frontend);
+  self->frontend = CarlFrontendMakeCached(g_design_cache, &params);
   if (self->frontend == NULL) {
     PyErr_SetString(PyExc_ValueError, "Error making CarlFrontend");
     return -1;
   }
+  free(self->block_buffer);
+  self->block_buffer = (float*)malloc(params.block_size * sizeof(float));
+  if (self->block_buffer == NULL) {
+    PyErr_NoMemory();
+    return -1;
+  }
   return 0;
 }
 
 static void CarlFrontendDealloc(CarlFrontendObject* self) {
+  free(self->block_buffer);
   CarlFrontendFree(self->frontend);
   Py_TYPE(self)->tp_free((PyObject*)self);
 }
@@ -138,6 +232,11 @@ static void CarlFrontendDealloc(CarlFrontendObject* self) {
 /* Define `CarlFrontend.reset()`. */
 static PyObject* CarlFrontendObjectReset(CarlFrontendObject* self,
                                          PyObject* args, PyObject* kw) {
+  if (self->busy) {
+    PyErr_SetString(PyExc_RuntimeError,
+                    "CarlFrontend is in use by another thread");
+    return NULL;
+  }
   CarlFrontendReset(self->frontend);
   Py_INCREF(Py_None);
   return (PyObject*)Py_None;
@@ -158,21 +257,28 @@ static PyObject* CarlFrontendObjectProcessSamples(CarlFrontendObject* self,
                                                   PyObject* args,
                                                   PyObject* kw) {
   PyObject* samples_arg = NULL;
-  static const char* keywords[] = {"samples", NULL};
+  PyObject* out_arg = Py_None;
+  static const char* keywords[] = {"samples", "out", NULL};
 
-  if (!PyArg_ParseTupleAndKeywords(args, kw, "O:process_samples",
-                                   (char**)keywords, &samples_arg)) {
+  if (!PyArg_ParseTupleAndKeywords(args, kw, "O|O:process_samples",
+                                   (char**)keywords, &samples_arg, &out_arg)) {
     return NULL;  /* PyArg_ParseTupleAndKeywords failed. */
   }
+  if (self->busy) {
+    PyErr_SetString(PyExc_RuntimeError,
+                    "CarlFrontend is in use by another thread");
+    return NULL;
+  }
 
-  /* Convert input samples to numpy array with contiguous float32 data. We
-   * always make a copy (NPY_ARRAY_ENSURECOPY) since CarlFrontendProcessSamples
-   * overwrites its input.
+  /* Convert input samples to numpy array with contiguous float32 data. This
+   * doesn't copy if the input is already such an array. Since
+   * CarlFrontendProcessSamples overwrites its input, each block is copied to
+   * `block_buffer` before processing.
    */
   PyArrayObject* samples = (PyArrayObject*)PyArray_FromAny(
       samples_arg, PyArray_DescrFromType(NPY_FLOAT), 0, 0,
       NPY_ARRAY_ALIGNED | NPY_ARRAY_NOTSWAPPED | NPY_ARRAY_FORCECAST |
-          NPY_ARRAY_ENSURECOPY | NPY_ARRAY_DEFAULT,
+          NPY_ARRAY_DEFAULT,
       NULL);
 
   if (!samples) {  /* PyArray_DescrFromType failed. */
@@ -192,33 +298,52 @@ static PyObject* CarlFrontendObjectProcessSamples(CarlFrontendObject* self,
     goto fail;
   }
 
-  /* Create output numpy array. */
-  npy_intp output_dims[2];
-  output_dims[0] = size / block_size;
-  output_dims[1] = num_channels;
-  PyArrayObject* output =
-      (PyArrayObject*)PyArray_SimpleNew(2, output_dims, NPY_FLOAT);
-  if (!output) {  /* PyArray_SimpleNew failed. */
-    /* PyArray_SimpleNew already set an error, so clean up and return. */
-    goto fail;
+  const int num_blocks = size / block_size;
+  PyObject* output;
+  Py_buffer out_view;
+  float* output_data;
+  if (out_arg != Py_None) {
+    /* Write to the caller-provided buffer. */
+    if (!GetFloatOutBuffer(out_arg, (Py_ssize_t)num_blocks * num_channels,
+                           &out_view)) {
+      goto fail;
+    }
+    Py_INCREF(out_arg);
+    output = out_arg;
+    output_data = (float*)out_view.buf;
+  } else {
+    /* Create output numpy array. */
+    npy_intp output_dims[2];
+    output_dims[0] = num_blocks;
+    output_dims[1] = num_channels;
+    output = PyArray_SimpleNew(2, output_dims, NPY_FLOAT);
+    if (!output) {  /* PyArray_SimpleNew failed. */
+      /* PyArray_SimpleNew already set an error, so clean up and return. */
+      goto fail;
+    }
+    output_data = (float*)PyArray_DATA((PyArrayObject*)output);
   }
 
   /* Process the samples. */
-  float* samples_data = (float*)PyArray_DATA(samples);
-  float* output_data = (float*)PyArray_DATA(output);
+  const float* samples_data = (const float*)PyArray_DATA(samples);
+  float* block_buffer = self->block_buffer;
 
   /* Release the GIL so that other threads can run while processing. */
+  self->busy = 1;
   Py_BEGIN_ALLOW_THREADS
   int i;
-  for (i = 0; i < output_dims[0]; ++i) {
-    CarlFrontendProcessSamples(self->frontend, samples_data, output_data);
+  for (i = 0; i < num_blocks; ++i) {
+    memcpy(block_buffer, samples_data, block_size * sizeof(float));
+    CarlFrontendProcessSamples(self->frontend, block_buffer, output_data);
     samples_data += block_size;
     output_data += num_channels;
   }
   Py_END_ALLOW_THREADS
+  self->busy = 0;
 
+  if (out_arg != Py_None) { PyBuffer_Release(&out_view); }
   Py_DECREF(samples);
-  return (PyObject*)output;
+  return output;
 
 fail:
   Py_XDECREF(samples);
@@ -291,6 +416,292 @@ static void DefineCarlFrontendType(PyObject* m) {
   }
 }
 
+typedef struct {
+  PyObject_HEAD
+  TactileProcessorBatch* batch;
+  int num_streams;
+  int num_channels;
+  int block_size;
+  /* Arrays of `num_streams` pointers to the current input and output blocks. */
+  const float** input_blocks;
+  float** output_blocks;
+  /* Nonzero while process_samples is running with the GIL released. */
+  int busy;
+} CarlFrontendBatchObject;
+
+/* Define `CarlFrontendBatch.__init__`. */
+static int CarlFrontendBatchObjectInit(CarlFrontendBatchObject* self,
+                                       PyObject* args, PyObject* kw) {
+  TactileProcessorParams params;
+  TactileProcessorSetDefaultParams(&params);
+  params.frontend_params = kCarlFrontendDefaultParams;
+  params.decimation_factor = 1;
+  CarlFrontendParams* frontend_params = &params.frontend_params;
+  int num_streams = 0;
+  static const char* keywords[] = {"num_streams",
+                                   "input_sample_rate_hz",
+                                   "block_size",
+                                   "highest_pole_frequency_hz",
+                                   "min_pole_frequency_hz",
+                                   "step_erbs",
+                                   "envelope_cutoff_hz",
+                                   "pcen_time_constant_s",
+                                   "pcen_cross_channel_diffusivity",
+                                   "pcen_init_value",
+                                   "pcen_alpha",
+                                   "pcen_beta",
+                                   "pcen_gamma",
+                                   "pcen_delta",
+                                   "min_samples_per_cycle",
+                                   NULL};
+
+  if (!PyArg_ParseTupleAndKeywords(
+          args, kw, "i|fiffffffffffff:__init__", (char**)keywords,
+          &num_streams,
+          &frontend_params->input_sample_rate_hz, &frontend_params->block_size,
+          &frontend_params->highest_pole_frequency_hz,
+          &frontend_params->min_pole_frequency_hz,
+          &frontend_params->step_erbs, &frontend_params->envelope_cutoff_hz,
+          &frontend_params->pcen_time_constant_s,
+          &frontend_params->pcen_cross_channel_diffusivity,
+          &frontend_params->pcen_init_value, &frontend_params->pcen_alpha,
+          &frontend_params->pcen_beta, &frontend_params->pcen_gamma,
+          &frontend_params->pcen_delta,
+          &frontend_params->min_samples_per_cycle)) {
+    return -1;  /* PyArg_ParseTupleAndKeywords failed. */
+  }
+
+  TactileProcessorBatchFree(self->batch);
+  free(self->input_blocks);
+  free(self->output_blocks);
+  self->input_blocks = NULL;
+  self->output_blocks = NULL;
+  self->batch = TactileProcessorBatchMake(&params, num_streams);
+  if (self->batch == NULL) {
+    PyErr_SetString(PyExc_ValueError, "Error making CarlFrontendBatch");
+    return -1;
+  }
+  self->num_streams = num_streams;
+  self->num_channels = self->batch->num_frontend_channels;
+  self->block_size = frontend_params->block_size;
+  self->input_blocks = (const float**)malloc(num_streams * sizeof(float*));
+  self->output_blocks = (float**)malloc(num_streams * sizeof(float*));
+  if (self->input_blocks == NULL || self->output_blocks == NULL) {
+    PyErr_NoMemory();
+    return -1;
+  }
+  return 0;
+}
+
+static void CarlFrontendBatchDealloc(CarlFrontendBatchObject* self) {
+  free(self->output_blocks);
+  free(self->input_blocks);
+  TactileProcessorBatchFree(self->batch);
+  Py_TYPE(self)->tp_free((PyObject*)self);
+}
+
+/* Define `CarlFrontendBatch.reset()`. */
+static PyObject* CarlFrontendBatchObjectReset(CarlFrontendBatchObject* self) {
+  if (self->busy) {
+    PyErr_SetString(PyExc_RuntimeError,
+                    "CarlFrontendBatch is in use by another thread");
+    return NULL;
+  }
+  TactileProcessorBatchReset(self->batch);
+  Py_INCREF(Py_None);
+  return Py_None;
+}
+
+/* Define `CarlFrontendBatch.reset_stream(stream)`. */
+static PyObject* CarlFrontendBatchObjectResetStream(
+    CarlFrontendBatchObject* self, PyObject* args) {
+  int stream;
+  if (!PyArg_ParseTuple(args, "i:reset_stream", &stream)) { return NULL; }
+  if (!(0 <= stream && stream < self->num_streams)) {
+    PyErr_SetString(PyExc_IndexError, "stream out of range");
+    return NULL;
+  } else if (self->busy) {
+    PyErr_SetString(PyExc_RuntimeError,
+                    "CarlFrontendBatch is in use by another thread");
+    return NULL;
+  }
+  TactileProcessorBatchResetStream(self->batch, stream);
+  Py_INCREF(Py_None);
+  return Py_None;
+}
+
+/* Define `CarlFrontendBatch.process_samples`. */
+static PyObject* CarlFrontendBatchObjectProcessSamples(
+    CarlFrontendBatchObject* self, PyObject* args, PyObject* kw) {
+  PyObject* samples_arg = NULL;
+  PyObject* out_arg = Py_None;
+  static const char* keywords[] = {"samples", "out", NULL};
+
+  if (!PyArg_ParseTupleAndKeywords(args, kw, "O|O:process_samples",
+                                   (char**)keywords, &samples_arg, &out_arg)) {
+    return NULL;  /* PyArg_ParseTupleAndKeywords failed. */
+  }
+  if (self->busy) {
+    PyErr_SetString(PyExc_RuntimeError,
+                    "CarlFrontendBatch is in use by another thread");
+    return NULL;
+  }
+
+  /* Convert input samples to numpy array with contiguous float32 data. */
+  PyArrayObject* samples = (PyArrayObject*)PyArray_FromAny(
+      samples_arg, PyArray_DescrFromType(NPY_FLOAT), 0, 0,
+      NPY_ARRAY_ALIGNED | NPY_ARRAY_NOTSWAPPED | NPY_ARRAY_FORCECAST |
+          NPY_ARRAY_DEFAULT,
+      NULL);
+
+  if (!samples) {  /* PyArray_DescrFromType failed. */
+    /* PyArray_DescrFromType already set an error, so just need to return. */
+    return NULL;
+  } else if (PyArray_NDIM(samples) != 2 ||
+             PyArray_DIM(samples, 0) != self->num_streams) {
+    PyErr_SetString(PyExc_ValueError,
+                    "expected 2-D array of shape (num_streams, num_samples)");
+    goto fail;
+  }
+
+  const int num_streams = self->num_streams;
+  const int num_channels = self->num_channels;
+  const int block_size = self->block_size;
+  const int num_samples = PyArray_DIM(samples, 1);
+  if (num_samples % block_size != 0) {
+    PyErr_SetString(PyExc_ValueError,
+                    "num_samples must be a multiple of block_size");
+    goto fail;
+  }
+
+  const int num_blocks = num_samples / block_size;
+  PyObject* output;
+  Py_buffer out_view;
+  float* output_data;
+  if (out_arg != Py_None) {
+    /* Write to the caller-provided buffer. */
+    if (!GetFloatOutBuffer(
+          out_arg, (Py_ssize_t)num_streams * num_blocks * num_channels,
+          &out_view)) {
+      goto fail;
+    }
+    Py_INCREF(out_arg);
+    output = out_arg;
+    output_data = (float*)out_view.buf;
+  } else {
+    /* Create output numpy array. */
+    npy_intp output_dims[3];
+    output_dims[0] = num_streams;
+    output_dims[1] = num_blocks;
+    output_dims[2] = num_channels;
+    output = PyArray_SimpleNew(3, output_dims, NPY_FLOAT);
+    if (!output) {  /* PyArray_SimpleNew failed. */
+      /* PyArray_SimpleNew already set an error, so clean up and return. */
+      goto fail;
+    }
+    output_data = (float*)PyArray_DATA((PyArrayObject*)output);
+  }
+
+  const float* samples_data = (const float*)PyArray_DATA(samples);
+  const float** input_blocks = self->input_blocks;
+  float** output_blocks = self->output_blocks;
+
+  /* Release the GIL so that other threads can run while processing. */
+  self->busy = 1;
+  Py_BEGIN_ALLOW_THREADS
+  int i;
+  for (i = 0; i < num_blocks; ++i) {
+    int s;
+    for (s = 0; s < num_streams; ++s) {
+      input_blocks[s] = samples_data + s * num_samples + i * block_size;
+      output_blocks[s] = output_data + (s * num_blocks + i) * num_channels;
+    }
+    TactileProcessorBatchProcessFrontend(
+        self->batch, input_blocks, output_blocks);
+  }
+  Py_END_ALLOW_THREADS
+  self->busy = 0;
+
+  if (out_arg != Py_None) { PyBuffer_Release(&out_view); }
+  Py_DECREF(samples);
+  return output;
+
+fail:
+  Py_XDECREF(samples);
+  return NULL;
+}
+
+/* CarlFrontendBatch's method functions. */
+static PyMethodDef kCarlFrontendBatchMethods[] = {
+    {"reset", (PyCFunction)CarlFrontendBatchObjectReset,
+     METH_NOARGS, "Resets all streams to initial state."},
+    {"reset_stream", (PyCFunction)CarlFrontendBatchObjectResetStream,
+     METH_VARARGS, "Resets one stream to initial state."},
+    {"process_samples", (PyCFunction)CarlFrontendBatchObjectProcessSamples,
+     METH_VARARGS | METH_KEYWORDS, "Processes samples in a streaming manner."},
+    {NULL, NULL, 0, NULL} /* Sentinel */
+};
+
+/* Define `num_streams`, etc. as read-only members. */
+static PyMemberDef kCarlFrontendBatchMembers[] = {
+  {"num_streams", T_INT,
+   offsetof(CarlFrontendBatchObject, num_streams), READONLY, ""},
+  {"num_channels", T_INT,
+   offsetof(CarlFrontendBatchObject, num_channels), READONLY, ""},
+  {"block_size", T_INT,
+   offsetof(CarlFrontendBatchObject, block_size), READONLY, ""},
+  {NULL}  /* Sentinel. */
+};
+
+/* Define the CarlFrontendBatch Python type. */
+static PyTypeObject kCarlFrontendBatchType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    "CarlFrontendBatch",                   /* tp_name */
+    sizeof(CarlFrontendBatchObject),       /* tp_basicsize */
+    0,                                     /* tp_itemsize */
+    (destructor)CarlFrontendBatchDealloc,  /* tp_dealloc */
+    0,                                     /* tp_print */
+    0,                                     /* tp_getattr */
+    0,                                     /* tp_setattr */
+    0,                                     /* tp_compare */
+    0,                                     /* tp_repr */
+    0,                                     /* tp_as_number */
+    0,                                     /* tp_as_sequence */
+    0,                                     /* tp_as_mapping */
+    0,                                     /* tp_hash */
+    0,                                     /* tp_call */
+    0,                                     /* tp_str */
+    0,                                     /* tp_getattro */
+    0,                                     /* tp_setattro */
+    0,                                     /* tp_as_buffer */
+    Py_TPFLAGS_DEFAULT,                    /* tp_flags */
+    "CarlFrontendBatch object",            /* tp_doc */
+    0,                                     /* tp_traverse */
+    0,                                     /* tp_clear */
+    0,                                     /* tp_richcompare */
+    0,                                     /* tp_weaklistoffset */
+    0,                                     /* tp_iter */
+    0,                                     /* tp_iternext */
+    kCarlFrontendBatchMethods,             /* tp_methods */
+    kCarlFrontendBatchMembers,             /* tp_members */
+    0,                                     /* tp_getset */
+    0,                                     /* tp_base */
+    0,                                     /* tp_dict */
+    0,                                     /* tp_descr_get */
+    0,                                     /* tp_descr_set */
+    0,                                     /* tp_dictoffset */
+    (initproc)CarlFrontendBatchObjectInit, /* tp_init */
+};
+
+static void DefineCarlFrontendBatchType(PyObject* m) {
+  kCarlFrontendBatchType.tp_new = PyType_GenericNew;
+  if (PyType_Ready(&kCarlFrontendBatchType) >= 0) {
+    Py_INCREF(&kCarlFrontendBatchType);
+    PyModule_AddObject(m, "CarlFrontendBatch",
+                       (PyObject*)&kCarlFrontendBatchType);
+  }
+}
+
 /* Module methods. */
 static PyMethodDef kModuleMethods[] = {
     {NULL, NULL, 0, NULL} /* Sentinel */
@@ -313,5 +724,6 @@ PyMODINIT_FUNC PyInit_frontend(void) {
   import_array();
   PyObject* m = PyModule_Create(&kModule);
   DefineCarlFrontendType(m);
+  DefineCarlFrontendBatchType(m);
   return m;
 }
@@ -0,0 +1,504 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#if !defined(_POSIX_C_SOURCE) || _POSIX_C_SOURCE < 200112L
+#undef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200112L /* For mmap() and ftruncate(). */
+#endif
+
+#include "extras/python/phonetics/batch_frontend.h"
+
+#include <fcntl.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "extras/tools/task_pool.h"
+#include "src/dsp/read_wav_stream.h"
+
+/* Frames per block when reading WAV files. */
+#define kReadBlockFrames 1024
+
+void BatchFrontendSetDefaultParams(BatchFrontendParams* params) {
+  params->frontend_params = kCarlFrontendDefaultParams;
+  params->num_threads = 4;
+}
+
+typedef struct {
+  int num_channels;
+  int sample_rate_hz;
+  /* Number of samples per channel. */
+  int num_samples;
+  int big_endian;
+} SphereHeader;
+
+/* Reads the header of a NIST SPHERE file, leaving `f` at the start of the
+ * sample data. Only 16-bit PCM is supported. Returns 1 on success.
+ */
+static int ReadSphereHeader(FILE* f, SphereHeader* header) {
+  char magic[16];
+  if (fread(magic, 1, 16, f) != 16 || memcmp(magic, "NIST_1A\n", 8)) {
+    return 0;
+  }
+  magic[15] = '\0';
+  const long header_size = strtol(magic + 8, NULL, 10);
+  if (header_size < 16 || header_size > 65536) { return 0; }
+  char* text = (char*)malloc(header_size - 16 + 1);
+  if (text == NULL ||
+      fread(text, 1, header_size - 16, f) != (size_t)(header_size - 16)) {
+    free(text);
+    return 0;
+  }
+  text[header_size - 16] = '\0';
+
+  header->num_channels = 0;
+  header->sample_rate_hz = 0;
+  header->num_samples = 0;
+  header->big_endian = 0;
+  int sample_n_bytes = 0;
+  int is_pcm = 1;
+  char* line = strtok(text, "\n");
+  for (; line != NULL; line = strtok(NULL, "\n")) {
+    char name[64];
+    char type[8];
+    char value[64];
+    if (!strncmp(line, "end_head", 8)) { break; }
+    if (sscanf(line, "%63s %7s %63s", name, type, value) != 3) { continue; }
+    if (!strcmp(name, "channel_count")) {
+      header->num_channels = atoi(value);
+    } else if (!strcmp(name, "sample_rate")) {
+      header->sample_rate_hz = atoi(value);
+    } else if (!strcmp(name, "sample_count")) {
+      header->num_samples = atoi(value);
+    } else if (!strcmp(name, "sample_n_bytes")) {
+      sample_n_bytes = atoi(value);
+    } else if (!strcmp(name, "sample_byte_format")) {
+      header->big_endian = !strcmp(value, "10");
+    } else if (!strcmp(name, "sample_coding")) {
+      is_pcm = !strcmp(value, "pcm");
+    }
+  }
+  free(text);
+  return header->num_channels > 0 && header->sample_rate_hz > 0 &&
+      header->num_samples >= 0 && sample_n_bytes == 2 && is_pcm;
+}
+
+/* Returns 1 if file `f` starts with the NIST SPHERE magic string. */
+static int IsSphereFile(FILE* f) {
+  char magic[7];
+  const int is_sphere = fread(magic, 1, 7, f) == 7 &&
+      !memcmp(magic, "NIST_1A", 7);
+  rewind(f);
+  return is_sphere;
+}
+
+static float* ReadSphereFile(FILE* f, int* num_samples, int* sample_rate_hz) {
+  SphereHeader header;
+  if (!ReadSphereHeader(f, &header)) {
+    fprintf(stderr, "Error: Only 16-bit PCM SPHERE files are supported.\n");
+    return NULL;
+  }
+  const size_t num_values = (size_t)header.num_samples * header.num_channels;
+  uint8_t* bytes = (uint8_t*)malloc(2 * num_values + 1);
+  float* samples = (float*)malloc(sizeof(float) * header.num_samples + 1);
+  if (bytes == NULL || samples == NULL) {
+    fprintf(stderr, "Error: Memory allocation failed.\n");
+    free(samples);
+    free(bytes);
+    return NULL;
+  }
+  /* Like TIMIT's read_nist_sphere.py, tolerate truncated data. */
+  const size_t num_frames = fread(bytes, 2, num_values, f) /
+      header.num_channels;
+
+  const float scale = 1.0f / (32768.0f * header.num_channels);
+  const int lo = header.big_endian;
+  size_t i;
+  for (i = 0; i < num_frames; ++i) {
+    const uint8_t* frame = bytes + 2 * header.num_channels * i;
+    float sum = 0.0f;
+    int c;
+    for (c = 0; c < header.num_channels; ++c) {
+      sum += (int16_t)(frame[2 * c + lo] | (frame[2 * c + 1 - lo] << 8));
+    }
+    samples[i] = scale * sum;
+  }
+  free(bytes);
+
+  *num_samples = (int)num_frames;
+  *sample_rate_hz = header.sample_rate_hz;
+  return samples;
+}
+
+static float* ReadWavStreamFile(const char* file_name, int* num_samples,
+                                int* sample_rate_hz) {
+  ReadWavStream* stream = ReadWavStreamOpen(file_name, kReadBlockFrames);
+  if (stream == NULL) { return NULL; }
+  const int num_channels = ReadWavStreamNumChannels(stream);
+  const size_t capacity =
+      ReadWavStreamInfo(stream)->remaining_samples / num_channels;
+  float* samples = (float*)malloc(sizeof(float) * capacity + 1);
+  if (samples == NULL) {
+    fprintf(stderr, "Error: Memory allocation failed.\n");
+    ReadWavStreamClose(stream);
+    return NULL;
+  }
+
+  const float scale = 1.0f / num_channels;
+  size_t size = 0;
+  const float* block;
+  int num_frames;
+  while ((block = ReadWavStreamNextBlock(stream, &num_frames)) != NULL &&
+         size + num_frames <= capacity) {
+    int i;
+    for (i = 0; i < num_frames; ++i, block += num_channels) {
+      float sum = 0.0f;
+      int c;
+      for (c = 0; c < num_channels; ++c) {
+        sum += block[c];
+      }
+      samples[size++] = scale * sum;
+    }
+  }
+
+  *num_samples = (int)size;
+  *sample_rate_hz = ReadWavStreamSampleRateHz(stream);
+  ReadWavStreamClose(stream);
+  return samples;
+}
+
+float* BatchFrontendReadAudio(const char* file_name, int* num_samples,
+                              int* sample_rate_hz) {
+  FILE* f = fopen(file_name, "rb");
+  if (f == NULL) {
+    fprintf(stderr, "Error: Failed to open \"%s\".\n", file_name);
+    return NULL;
+  }
+  float* samples;
+  if (IsSphereFile(f)) {
+    samples = ReadSphereFile(f, num_samples, sample_rate_hz);
+    fclose(f);
+  } else {
+    fclose(f);
+    samples = ReadWavStreamFile(file_name, num_samples, sample_rate_hz);
+  }
+  if (samples == NULL) {
+    fprintf(stderr, "Error: Failed to read \"%s\".\n", file_name);
+  }
+  return samples;
+}
+
+/* Reads the number of samples per channel from the header of an audio file,
+ * without reading the samples. Returns 1 on success.
+ */
+static int ReadAudioLength(const char* file_name, int* num_samples) {
+  FILE* f = fopen(file_name, "rb");
+  if (f == NULL) { return 0; }
+  int success = 0;
+  if (IsSphereFile(f)) {
+    SphereHeader header;
+    if (ReadSphereHeader(f, &header)) {
+      *num_samples = header.num_samples;
+      success = 1;
+    }
+    fclose(f);
+  } else {
+    fclose(f);
+    ReadWavStream* stream = ReadWavStreamOpen(file_name, kReadBlockFrames);
+    if (stream != NULL) {
+      *num_samples = (int)(ReadWavStreamInfo(stream)->remaining_samples /
+                           ReadWavStreamNumChannels(stream));
+      ReadWavStreamClose(stream);
+      success = 1;
+    }
+  }
+  if (!success) {
+    fprintf(stderr, "Error: Failed to read \"%s\".\n", file_name);
+  }
+  return success;
+}
+
+/* Opens the .phn label file for `file_name`, trying extensions ".phn" and
+ * ".PHN". Returns NULL if there is none.
+ */
+static FILE* OpenPhoneLabelFile(const char* file_name) {
+  const size_t length = strlen(file_name);
+  char* phn_file = (char*)malloc(length + 5);
+  if (phn_file == NULL) { return NULL; }
+  strcpy(phn_file, file_name);
+  /* Remove the extension, if any. */
+  char* dot = strrchr(phn_file, '.');
+  if (dot != NULL && strchr(dot, '/') == NULL) { *dot = '\0'; }
+  char* end = phn_file + strlen(phn_file);
+
+  strcpy(end, ".phn");
+  FILE* f = fopen(phn_file, "rt");
+  if (f == NULL) {
+    strcpy(end, ".PHN");
+    f = fopen(phn_file, "rt");
+  }
+  free(phn_file);
+  return f;
+}
+
+/* Labels `num_frames` frames from the .phn file for `file_name`. */
+static void ReadPhoneLabels(const char* file_name, int num_frames,
+                            int block_size, char* labels) {
+  memset(labels, 0, (size_t)kBatchFrontendLabelSize * num_frames);
+  FILE* f = OpenPhoneLabelFile(file_name);
+  if (f == NULL) { return; }
+
+  const int half_block = block_size / 2;
+  long start;
+  long end;
+  char phone[kBatchFrontendLabelSize];
+  while (fscanf(f, "%ld %ld %7s", &start, &end, phone) == 3) {
+    /* Label frames whose center sample is in [start, end). */
+    long frame = (start <= half_block)
+        ? 0 : (start - half_block + block_size - 1) / block_size;
+    for (; frame < num_frames &&
+           frame * block_size + half_block < end; ++frame) {
+      strncpy(labels + kBatchFrontendLabelSize * frame, phone,
+              kBatchFrontendLabelSize);
+    }
+  }
+  fclose(f);
+}
+
+/* A .npy file mapped into memory. */
+typedef struct {
+  void* map;
+  size_t map_size;
+  /* Pointer to the array data in the mapping. */
+  void* data;
+} NpyMapping;
+
+/* Creates a .npy file for an array with dtype `descr` and the given shape,
+ * and maps it into memory for writing. Returns 1 on success.
+ */
+static int MapNpyFile(const char* file_name, const char* descr,
+                      int64_t num_rows, int num_cols, size_t item_size,
+                      NpyMapping* mapping) {
+  char header[192];
+  if (num_cols > 0) {
+    sprintf(header, "{'descr': '%s', 'fortran_order': False, "
+            "'shape': (%ld, %d), }", descr, (long)num_rows, num_cols);
+  } else {
+    sprintf(header, "{'descr': '%s', 'fortran_order': False, "
+            "'shape': (%ld,), }", descr, (long)num_rows);
+  }
+  /* Pad with spaces and a newline so that the data is 64-byte aligned. */
+  size_t header_size = 10 + strlen(header) + 1;
+  const size_t padding = (64 - header_size % 64) % 64;
+  memset(header + strlen(header), ' ', padding);
+  header_size += padding;
+  header[header_size - 11] = '\n';
+
+  mapping->map_size = header_size +
+      item_size * (size_t)num_rows * (num_cols > 0 ? num_cols : 1);
+  const int fd = open(file_name, O_RDWR | O_CREAT | O_TRUNC, 0644);
+  if (fd == -1) {
+    fprintf(stderr, "Error: Failed to create \"%s\".\n", file_name);
+    return 0;
+  }
+  if (ftruncate(fd, (off_t)mapping->map_size) != 0) {
+    fprintf(stderr, "Error: Failed to resize \"%s\".\n", file_name);
+    close(fd);
+    return 0;
+  }
+  mapping->map = mmap(NULL, mapping->map_size, PROT_READ | PROT_WRITE,
+                      MAP_SHARED, fd, 0);
+  close(fd);
+  if (mapping->map == MAP_FAILED) {
+    fprintf(stderr, "Error: Failed to map \"%s\".\n", file_name);
+    mapping->map = NULL;
+    return 0;
+  }
+
+  uint8_t* bytes = (uint8_t*)mapping->map;
+  memcpy(bytes, "\x93NUMPY\x01\x00", 8);
+  bytes[8] = (uint8_t)((header_size - 10) & 0xff);
+  bytes[9] = (uint8_t)((header_size - 10) >> 8);
+  memcpy(bytes + 10, header, header_size - 10);
+  mapping->data = bytes + header_size;
+  return 1;
+}
+
+static void UnmapNpyFile(NpyMapping* mapping) {
+  munmap(mapping->map, mapping->map_size);
+}
+
+typedef struct {
+  const BatchFrontendParams* params;
+  /* Designed frontend, cloned for each file. */
+  const CarlFrontend* prototype;
+  const char* const* files;
+  const int64_t* offsets;
+  int num_channels;
+  float* frames;
+  char* labels;
+  /* Whether each file succeeded, written by the task for that file. */
+  char* succeeded;
+} BatchContext;
+
+/* Task for TaskPoolRun(), processing one file. */
+static void ProcessFile(void* arg, int i) {
+  BatchContext* context = (BatchContext*)arg;
+  const CarlFrontendParams* frontend_params =
+      &context->params->frontend_params;
+  const char* file_name = context->files[i];
+  const int block_size = frontend_params->block_size;
+  const int64_t offset = context->offsets[i];
+  const int num_frames = (int)(context->offsets[i + 1] - offset);
+  context->succeeded[i] = 0;
+
+  int num_samples;
+  int sample_rate_hz;
+  float* samples =
+      BatchFrontendReadAudio(file_name, &num_samples, &sample_rate_hz);
+  if (samples == NULL) { return; }
+  if (fabs(sample_rate_hz - frontend_params->input_sample_rate_hz) > 0.5f) {
+    fprintf(stderr, "Error: \"%s\" has sample rate %d Hz, expected %g Hz.\n",
+            file_name, sample_rate_hz, frontend_params->input_sample_rate_hz);
+    free(samples);
+    return;
+  }
+
+  float* block = (float*)malloc(sizeof(float) * block_size);
+  CarlFrontend* frontend = CarlFrontendClone(context->prototype);
+  if (block != NULL && frontend != NULL) {
+    float* frame = context->frames + context->num_channels * offset;
+    int start = 0;
+    int f;
+    for (f = 0; f < num_frames; ++f, start += block_size) {
+      /* Copy the block, zero padding past the end. CarlFrontend overwrites
+       * its input, so it can't run directly on `samples`.
+       */
+      int j;
+      for (j = 0; j < block_size; ++j) {
+        block[j] = (start + j < num_samples) ? samples[start + j] : 0.0f;
+      }
+      CarlFrontendProcessSamples(frontend, block, frame);
+      frame += context->num_channels;
+    }
+
+    ReadPhoneLabels(file_name, num_frames, block_size,
+                    context->labels + kBatchFrontendLabelSize * offset);
+    context->succeeded[i] = 1;
+  } else {
+    fprintf(stderr, "Error: Failed to make CarlFrontend.\n");
+  }
+
+  CarlFrontendFree(frontend);
+  free(block);
+  free(samples);
+}
+
+/* Makes the name `output_prefix` + `suffix`. */
+static char* MakeOutputName(const char* output_prefix, const char* suffix) {
+  char* name = (char*)malloc(strlen(output_prefix) + strlen(suffix) + 1);
+  if (name != NULL) {
+    strcpy(name, output_prefix);
+    strcat(name, suffix);
+  }
+  return name;
+}
+
+int BatchFrontendRun(const BatchFrontendParams* params,
+                     const char* const* files, int num_files,
+                     const char* output_prefix,
+                     int64_t* total_num_frames) {
+  if (params == NULL || files == NULL || num_files < 0 ||
+      output_prefix == NULL || params->num_threads < 1) {
+    fprintf(stderr, "Error: Invalid arguments.\n");
+    return 0;
+  }
+
+  CarlFrontend* frontend = CarlFrontendMake(&params->frontend_params);
+  if (frontend == NULL) {
+    fprintf(stderr, "Error: Failed to make CarlFrontend.\n");
+    return 0;
+  }
+  const int num_channels = CarlFrontendNumChannels(frontend);
+  const int block_size = CarlFrontendBlockSize(frontend);
+
+  int success = 0;
+  NpyMapping frames_npy = {NULL, 0, NULL};
+  NpyMapping labels_npy = {NULL, 0, NULL};
+  NpyMapping offsets_npy = {NULL, 0, NULL};
+  TaskPool* pool = NULL;
+  char* succeeded = (char*)malloc(num_files + 1);
+  char* frames_name = MakeOutputName(output_prefix, "_frames.npy");
+  char* labels_name = MakeOutputName(output_prefix, "_labels.npy");
+  char* offsets_name = MakeOutputName(output_prefix, "_offsets.npy");
+  int64_t* offsets = NULL;
+  if (succeeded == NULL || frames_name == NULL || labels_name == NULL ||
+      offsets_name == NULL ||
+      !MapNpyFile(offsets_name, "<i8", (int64_t)num_files + 1, 0,
+                  sizeof(int64_t), &offsets_npy)) {
+    goto done;
+  }
+
+  /* Read the file lengths to lay out the output. */
+  offsets = (int64_t*)offsets_npy.data;
+  offsets[0] = 0;
+  int i;
+  for (i = 0; i < num_files; ++i) {
+    int num_samples;
+    if (!ReadAudioLength(files[i], &num_samples)) { goto done; }
+    offsets[i + 1] = offsets[i] + (num_samples + block_size - 1) / block_size;
+  }
+
+  if (!MapNpyFile(frames_name, "<f4", offsets[num_files], num_channels,
+                  sizeof(float), &frames_npy) ||
+      !MapNpyFile(labels_name, "|S8", offsets[num_files], 0,
+                  kBatchFrontendLabelSize, &labels_npy)) {
+    goto done;
+  }
+
+  /* The calling thread works on files too. */
+  if ((pool = TaskPoolMake(params->num_threads - 1)) == NULL) { goto done; }
+  BatchContext context;
+  context.params = params;
+  context.prototype = frontend;
+  context.files = files;
+  context.offsets = offsets;
+  context.num_channels = num_channels;
+  context.frames = (float*)frames_npy.data;
+  context.labels = (char*)labels_npy.data;
+  context.succeeded = succeeded;
+  TaskPoolRun(pool, ProcessFile, &context, num_files);
+
+  success = 1;
+  for (i = 0; i < num_files; ++i) {
+    if (!succeeded[i]) { success = 0; }
+  }
+  if (total_num_frames != NULL) { *total_num_frames = offsets[num_files]; }
+
+done:
+  TaskPoolFree(pool);
+  if (labels_npy.map != NULL) { UnmapNpyFile(&labels_npy); }
+  if (frames_npy.map != NULL) { UnmapNpyFile(&frames_npy); }
+  if (offsets_npy.map != NULL) { UnmapNpyFile(&offsets_npy); }
+  free(offsets_name);
+  free(labels_name);
+  free(frames_name);
+  free(succeeded);
+  CarlFrontendFree(frontend);
+  return success;
+}
@@ -0,0 +1,88 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ *
+ * Batch CARL+PCEN feature extraction of a corpus, for phonetics training data.
+ *
+ * `BatchFrontendRun()` runs the CARL+PCEN frontend over a list of audio files
+ * in one call, processing files in parallel on a thread pool. Audio is read
+ * natively from WAV or FLAC files (with read_wav_stream.c) or NIST SPHERE files
+ * (as in TIMIT, 16-bit PCM), with channels averaged to mono. Each file is zero
+ * padded to a whole number of blocks, as in phone_util.run_frontend().
+ *
+ * Labels are read from the .phn file next to each audio file, e.g. "a.phn" or
+ * "a.PHN" for "a.wav", in TIMIT text format. Each frame is labeled with the
+ * phone active at the center of its block, or an empty label if none is. If a
+ * file has no .phn file, its frames are unlabeled.
+ *
+ * Output is written as three numpy .npy files, which can be loaded with
+ * `np.load(..., mmap_mode='r')` without reading them into memory:
+ *
+ *   <output_prefix>_frames.npy   float32 [total_num_frames, num_channels].
+ *   <output_prefix>_labels.npy   'S8' [total_num_frames] phone labels.
+ *   <output_prefix>_offsets.npy  int64 [num_files + 1], where the frames of
+ *                                file i are offsets[i] to offsets[i + 1].
+ *
+ * The frames file is memory mapped, and each worker writes its frames directly
+ * to the mapping, so the corpus is never held in memory.
+ *
+ * NOTE: Audio must have sample rate `frontend_params.input_sample_rate_hz`.
+ * Resampling and data augmentation are left to make_training_data.py.
+ */
+
+#ifndef AUDIO_TO_TACTILE_EXTRAS_PYTHON_PHONETICS_BATCH_FRONTEND_H_
+#define AUDIO_TO_TACTILE_EXTRAS_PYTHON_PHONETICS_BATCH_FRONTEND_H_
+
+#include <stdint.h>
+
+#include "src/frontend/carl_frontend.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Size in bytes of each label, including null padding. */
+#define kBatchFrontendLabelSize 8
+
+typedef struct {
+  CarlFrontendParams frontend_params;
+  /* Number of threads, including the calling thread. */
+  int num_threads;
+} BatchFrontendParams;
+
+/* Sets all parameters to default values. */
+void BatchFrontendSetDefaultParams(BatchFrontendParams* params);
+
+/* Reads a WAV, FLAC, or NIST SPHERE audio file, averaging channels to mono.
+ * Returns a newly allocated array of `*num_samples` samples, which the caller
+ * should free, or NULL on failure.
+ */
+float* BatchFrontendReadAudio(const char* file_name, int* num_samples,
+                              int* sample_rate_hz);
+
+/* Runs the frontend on `num_files` audio files and writes frames, labels, and
+ * offsets to .npy files with names starting with `output_prefix`, as described
+ * above. If `total_num_frames` is not NULL, the total number of frames is
+ * written to it. Returns 1 on success, 0 on failure.
+ */
+int /*bool*/ BatchFrontendRun(const BatchFrontendParams* params,
+                              const char* const* files, int num_files,
+                              const char* output_prefix,
+                              int64_t* total_num_frames);
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif
+#endif /* AUDIO_TO_TACTILE_EXTRAS_PYTHON_PHONETICS_BATCH_FRONTEND_H_ */
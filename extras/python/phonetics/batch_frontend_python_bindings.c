@@ -0,0 +1,161 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ *
+ * Python bindings for batch CARL+PCEN feature extraction.
+ *
+ * These bindings wrap batch_frontend.c as a `batch_frontend` Python module.
+ *
+ * The interface is as follows. See also batch_frontend_test.py for use example.
+ *
+ * def extract(files,
+ *             output_prefix,
+ *             num_threads=4,
+ *             input_sample_rate_hz=16000.0,
+ *             block_size=64,
+ *             ...)
+ *   """Runs the frontend on a list of audio files. [Wraps BatchFrontendRun().]
+ *
+ *   Files are processed in parallel by native threads, with the GIL released.
+ *   Output is written to three .npy files, which may be loaded with
+ *   `np.load(..., mmap_mode='r')`:
+ *
+ *     <output_prefix>_frames.npy   float32 [num_frames, num_channels] frames.
+ *     <output_prefix>_labels.npy   'S8' [num_frames] phone labels, read from
+ *                                  .phn files next to the audio files.
+ *     <output_prefix>_offsets.npy  int64 [len(files) + 1], where file i's
+ *                                  frames are offsets[i] to offsets[i + 1].
+ *
+ *   Args:
+ *     files: List of WAV or NIST SPHERE file paths.
+ *     output_prefix: String, output path prefix.
+ *     num_threads: Integer, number of threads.
+ *     The remaining arguments are CarlFrontend parameters, as for
+ *     `frontend.CarlFrontend`.
+ *   Returns:
+ *     Total number of frames.
+ *   Raises:
+ *     ValueError: if processing fails. (The C library writes details to
+ *       stderr.)
+ *   """
+ */
+
+#define PY_SSIZE_T_CLEAN
+#include "Python.h"
+#include "extras/python/phonetics/batch_frontend.h"
+
+/* Define `extract()`. */
+static PyObject* ExtractPython(PyObject* dummy, PyObject* args, PyObject* kw) {
+  BatchFrontendParams params;
+  BatchFrontendSetDefaultParams(&params);
+  CarlFrontendParams* frontend_params = &params.frontend_params;
+  PyObject* files_arg;
+  const char* output_prefix;
+  static const char* keywords[] = {"files",
+                                   "output_prefix",
+                                   "num_threads",
+                                   "input_sample_rate_hz",
+                                   "block_size",
+                                   "highest_pole_frequency_hz",
+                                   "min_pole_frequency_hz",
+                                   "step_erbs",
+                                   "envelope_cutoff_hz",
+                                   "pcen_time_constant_s",
+                                   "pcen_cross_channel_diffusivity",
+                                   "pcen_init_value",
+                                   "pcen_alpha",
+                                   "pcen_beta",
+                                   "pcen_gamma",
+                                   "pcen_delta",
+                                   "min_samples_per_cycle",
+                                   NULL};
+
+  if (!PyArg_ParseTupleAndKeywords(
+          args, kw, "Os|ififfffffffffff:extract", (char**)keywords,
+          &files_arg, &output_prefix, &params.num_threads,
+          &frontend_params->input_sample_rate_hz,
+          &frontend_params->block_size,
+          &frontend_params->highest_pole_frequency_hz,
+          &frontend_params->min_pole_frequency_hz,
+          &frontend_params->step_erbs, &frontend_params->envelope_cutoff_hz,
+          &frontend_params->pcen_time_constant_s,
+          &frontend_params->pcen_cross_channel_diffusivity,
+          &frontend_params->pcen_init_value, &frontend_params->pcen_alpha,
+          &frontend_params->pcen_beta, &frontend_params->pcen_gamma,
+          &frontend_params->pcen_delta,
+          &frontend_params->min_samples_per_cycle)) {
+    return NULL;  /* PyArg_ParseTupleAndKeywords failed. */
+  }
+
+  PyObject* files_seq = PySequence_Fast(files_arg, "files must be a sequence");
+  if (files_seq == NULL) { return NULL; }
+  const Py_ssize_t num_files = PySequence_Fast_GET_SIZE(files_seq);
+  const char** files = (const char**)malloc(sizeof(char*) * (num_files + 1));
+  if (files == NULL) {
+    Py_DECREF(files_seq);
+    return PyErr_NoMemory();
+  }
+  /* The UTF-8 strings are owned by the str objects, which `files_seq` keeps
+   * alive while the GIL is released.
+   */
+  Py_ssize_t i;
+  for (i = 0; i < num_files; ++i) {
+    files[i] = PyUnicode_AsUTF8(PySequence_Fast_GET_ITEM(files_seq, i));
+    if (files[i] == NULL) {
+      free(files);
+      Py_DECREF(files_seq);
+      return NULL;
+    }
+  }
+
+  int success;
+  int64_t total_num_frames = 0;
+  Py_BEGIN_ALLOW_THREADS
+  success = BatchFrontendRun(&params, files, (int)num_files, output_prefix,
+                             &total_num_frames);
+  Py_END_ALLOW_THREADS
+
+  free(files);
+  Py_DECREF(files_seq);
+  if (!success) {
+    PyErr_SetString(PyExc_ValueError, "Error running batch frontend");
+    return NULL;
+  }
+  return PyLong_FromLongLong(total_num_frames);
+}
+
+/* Module methods. */
+static PyMethodDef kModuleMethods[] = {
+    {"extract", (PyCFunction)ExtractPython, METH_VARARGS | METH_KEYWORDS,
+     "Runs the frontend on a list of audio files."},
+    {NULL, NULL, 0, NULL} /* Sentinel */
+};
+
+/* Module definition. */
+static struct PyModuleDef kModule = {
+    PyModuleDef_HEAD_INIT,
+    "batch_frontend",  /* m_name */
+    NULL,              /* m_doc */
+    (Py_ssize_t)-1,    /* m_size */
+    kModuleMethods,    /* m_methods */
+    NULL,              /* m_reload */
+    NULL,              /* m_traverse */
+    NULL,              /* m_clear */
+    NULL,              /* m_free */
+};
+
+PyMODINIT_FUNC PyInit_batch_frontend(void) {
+  return PyModule_Create(&kModule);
+}
@@ -0,0 +1,100 @@
+# Copyright 2022 Google LLC
+#
+# Licensed under the Apache License, Version 2.0 (the "License"); you may not
+# use this file except in compliance with the License. You may obtain a copy of
+# the License at
+#
+#     https://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+# WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+# License for the specific language governing permissions and limitations under
+# the License.
+
+"""Tests for batch_frontend Python bindings."""
+
+import os
+import os.path
+import tempfile
+import unittest
+import numpy as np
+
+from extras.python import dsp
+from extras.python import frontend
+from extras.python.phonetics import batch_frontend
+
+
+def _run_frontend(samples: np.ndarray) -> np.ndarray:
+  """Runs CarlFrontend on one recording, zero padding the last block."""
+  carl = frontend.CarlFrontend()
+  samples = samples.astype(np.float32) / 32768.0
+  padding = (-len(samples)) % carl.block_size
+  return carl.process_samples(np.append(samples, np.zeros(padding, np.float32)))
+
+
+class BatchFrontendTest(unittest.TestCase):
+
+  def setUp(self):
+    super().setUp()
+    self.temp_dir = tempfile.mkdtemp()
+    np.random.seed(0)
+
+  def _make_samples(self, num_samples):
+    t = np.arange(num_samples) / 16000.0
+    return (8000 * np.sin(2 * np.pi * 400 * t)
+            + np.random.randint(-100, 100, num_samples)).astype(np.int16)
+
+  def test_matches_carl_frontend(self):
+    # A mono WAV, a stereo WAV, and a big-endian NIST SPHERE file.
+    samples = [self._make_samples(n) for n in (5000, 3333, 1280)]
+    files = [os.path.join(self.temp_dir, name)
+             for name in ('a.wav', 'b.wav', 'c.WAV')]
+    dsp.write_wav_file(files[0], samples[0], 16000)
+    dsp.write_wav_file(files[1], np.column_stack([samples[1]] * 2), 16000)
+    header = (b'NIST_1A\n   1024\n'
+              b'channel_count -i 1\n'
+              b'sample_count -i 1280\n'
+              b'sample_n_bytes -i 2\n'
+              b'sample_byte_format -s2 10\n'
+              b'sample_rate -i 16000\n'
+              b'end_head\n')
+    with open(files[2], 'wb') as f:
+      f.write(header.ljust(1024) + samples[2].astype('>i2').tobytes())
+    with open(os.path.join(self.temp_dir, 'c.PHN'), 'w') as f:
+      f.write('0 300 h#\n300 900 ae\n900 1280 sil\n')
+
+    output_prefix = os.path.join(self.temp_dir, 'out')
+    num_frames = batch_frontend.extract(files, output_prefix, num_threads=2)
+
+    frames = np.load(output_prefix + '_frames.npy', mmap_mode='r')
+    labels = np.load(output_prefix + '_labels.npy', mmap_mode='r')
+    offsets = np.load(output_prefix + '_offsets.npy')
+    expected = [_run_frontend(x) for x in samples]
+    np.testing.assert_array_equal(
+        offsets, np.cumsum([0] + [len(x) for x in expected]))
+    self.assertEqual(num_frames, offsets[-1])
+    self.assertEqual(frames.shape, (num_frames, expected[0].shape[1]))
+    for i in range(len(files)):
+      np.testing.assert_allclose(frames[offsets[i]:offsets[i + 1]],
+                                 expected[i], atol=1e-6)
+
+    # Frames are labeled by the phone at the center of the block.
+    self.assertTrue(np.all(labels[:offsets[2]] == b''))
+    np.testing.assert_array_equal(
+        labels[offsets[2]:], [b'h#'] * 5 + [b'ae'] * 9 + [b'sil'] * 6)
+
+  def test_wrong_sample_rate(self):
+    wav_file = os.path.join(self.temp_dir, 'a.wav')
+    dsp.write_wav_file(wav_file, self._make_samples(1000), 8000)
+    with self.assertRaises(ValueError):
+      batch_frontend.extract([wav_file], os.path.join(self.temp_dir, 'out'))
+
+  def test_missing_file(self):
+    with self.assertRaises(ValueError):
+      batch_frontend.extract([os.path.join(self.temp_dir, 'missing.wav')],
+                             os.path.join(self.temp_dir, 'out'))
+
+
+if __name__ == '__main__':
+  unittest.main()
@@ -20,6 +20,45 @@ flattened in column-major order and written in the form
 
   static const float kTensorName[dim0 * dim1 * ...] = {elements... };
 
+With --quantize_int8, each weight matrix (tensors with 2 or more dimensions) is
+instead written as int8 values with a float scale per output unit (the last
+dimension), in the form used by DenseLinearLayerInt8() in nn_ops.h:
+
+  static const int8_t kTensorNameInt8[dim0 * dim1 * ...] = {elements... };
+  static const float kTensorNameScales[dim_last] = {elements... };
+
+Biases are still written as float.
+
+With --float16, each weight matrix is instead written in half precision as IEEE
+binary16 bit patterns, in the form used by DenseLinearLayerF16() in nn_ops.h:
+
+  static const uint16_t kTensorNameF16[dim0 * dim1 * ...] = {elements... };
+
+Biases are still written as float.
+
+With --sparse, each weight matrix is instead written in the block-sparse form
+used by DenseLinearLayerSparse() in nn_ops.h, storing only the nonzero blocks of
+4 output units for one input:
+
+  static const uint16_t kTensorNameGroupBegin[...] = {elements... };
+  static const uint16_t kTensorNameBlockInput[...] = {elements... };
+  static const float kTensorNameBlockWeights[...] = {elements... };
+  static const DenseSparseWeights kTensorNameSparse = {...};
+
+The output then needs to include nn_ops.h. With --prune_fraction, the given
+fraction of blocks with the smallest L2 norm are additionally set to zero. For
+best accuracy, the model should be pruned and fine-tuned in training, in which
+case --prune_fraction is not needed.
+
+With --tile_first_layer_frames=N, the first weight matrix, whose input is N
+concatenated frames, is additionally written with its weights laid out as one
+contiguous tile per frame, in the order ClassifyPhonemeStreamer consumes them:
+
+  static const float kTensorNameTiled[dim0 * dim1] = {elements... };
+
+where element `c + num_channels * (j + num_units * p)` is the weight for channel
+c of frame p to unit j.
+
 NOTE: This program does not convert model behavior to C; only the parameter data
 is exported. It is up to the user to understand the model architecture and
 parameter meanings. This may yet help in writing C implementations for inference
@@ -27,7 +66,7 @@ on device.
 """
 
 import textwrap
-from typing import Iterable
+from typing import Iterable, Tuple
 
 from absl import app
 from absl import flags
@@ -42,6 +81,22 @@ flags.DEFINE_string('model', None, '[REQUIRED] Model params .pkl file.')
 
 flags.DEFINE_string('output', '/tmp/params.h', 'Output C file.')
 
+flags.DEFINE_bool('quantize_int8', False,
+                  'Write weight matrices as int8 with per-unit float scales.')
+
+flags.DEFINE_bool('float16', False,
+                  'Write weight matrices as half-precision bit patterns.')
+
+flags.DEFINE_bool('sparse', False,
+                  'Write weight matrices in block-sparse form.')
+
+flags.DEFINE_float('prune_fraction', 0.0,
+                   'With --sparse, fraction of blocks to prune by magnitude.')
+
+flags.DEFINE_integer('tile_first_layer_frames', 0,
+                     'If positive, also write the first weight matrix tiled '
+                     'by input frame, for this number of frames.')
+
 MAX_WIDTH = 80  # Output is wrapped to MAX_WIDTH chars.
 
 
@@ -55,17 +110,115 @@ def format_c_array(v: Iterable[float]) -> str:
   return '{' + ', '.join([f'{x:.6}f' for x in v]) + '}'
 
 
-def export_model_as_c_data(model_file: str, output_file: str) -> None:
+def format_c_int_array(v: Iterable[int]) -> str:
+  """Format 1D integer array as a C array."""
+  return '{' + ', '.join([str(int(x)) for x in v]) + '}'
+
+
+def format_c_hex16_array(v: Iterable[int]) -> str:
+  """Format 1D array of 16-bit values as a C array of hex literals."""
+  return '{' + ', '.join(['0x%04x' % int(x) for x in v]) + '}'
+
+
+def quantize_int8(array: np.ndarray) -> Tuple[np.ndarray, np.ndarray]:
+  """Quantizes weights to int8 with a scale per unit of the last dimension.
+
+  Args:
+    array: Float array of shape [..., num_units].
+  Returns:
+    (array_q, scales) 2-tuple, where array_q is an int8 array of the same shape
+    as `array` and scales has shape [num_units], such that
+    `array ~= array_q * scales`.
+  """
+  num_units = array.shape[-1]
+  max_abs = np.abs(array.reshape(-1, num_units)).max(axis=0)
+  scales = np.where(max_abs > 0, max_abs / 127.0, 1.0).astype(np.float32)
+  array_q = np.clip(np.round(array / scales), -127, 127).astype(np.int8)
+  return array_q, scales
+
+
+def sparsify_4x1(
+    array: np.ndarray,
+    prune_fraction: float = 0.0) -> Tuple[np.ndarray, np.ndarray, np.ndarray]:
+  """Converts a weight matrix to block-sparse form with 4x1 blocks.
+
+  Args:
+    array: Float array of shape [in_size, out_size].
+    prune_fraction: Float, fraction of blocks with the smallest L2 norm to set
+      to zero before conversion.
+  Returns:
+    (group_begin, block_input, block_weights) 3-tuple, as described for
+    DenseSparseWeights in nn_ops.h.
+  """
+  if array.ndim != 2:
+    raise ValueError(f'expected a 2D array, got shape {array.shape}')
+  in_size, out_size = array.shape
+  num_groups = (out_size + 3) // 4
+  # Pad the output units to a multiple of 4 and split into blocks, such that
+  # blocks[g, k] is the block for group g and input k.
+  padded = np.zeros((in_size, 4 * num_groups), np.float32)
+  padded[:, :out_size] = array
+  blocks = padded.reshape(in_size, num_groups, 4).transpose(1, 0, 2)
+
+  norms = np.sqrt((blocks**2).sum(axis=-1))
+  if prune_fraction > 0.0:
+    num_pruned = int(round(prune_fraction * norms.size))
+    pruned = np.argsort(norms, axis=None)[:num_pruned]
+    norms.flat[pruned] = 0.0
+  keep = norms > 0.0
+
+  group_begin = np.concatenate([[0], np.cumsum(keep.sum(axis=1))])
+  block_input = np.nonzero(keep)[1]  # Row-major, so increasing k per group.
+  block_weights = blocks[keep].flatten()
+  if max(in_size, len(block_input)) > 65535:
+    raise ValueError('too many blocks for 16-bit indices')
+  return group_begin, block_input, block_weights
+
+
+def tile_by_frame(array: np.ndarray, num_frames: int) -> np.ndarray:
+  """Lays out a first-layer weight matrix as one contiguous tile per frame.
+
+  Args:
+    array: Float array of shape [num_frames * num_channels, num_units], where
+      the input is `num_frames` concatenated frames of `num_channels` values.
+    num_frames: Integer, number of frames in the input.
+  Returns:
+    1D array where element `c + num_channels * (j + num_units * p)` is
+    `array[c + num_channels * p, j]`.
+  """
+  if array.ndim != 2 or array.shape[0] % num_frames:
+    raise ValueError(f'cannot tile shape {array.shape} by {num_frames} frames')
+  num_channels = array.shape[0] // num_frames
+  return (array.reshape(num_frames, num_channels, -1)
+          .transpose(0, 2, 1).flatten())
+
+
+def export_model_as_c_data(model_file: str,
+                           output_file: str,
+                           int8: bool = False,
+                           tile_first_layer_frames: int = 0,
+                           float16: bool = False,
+                           sparse: bool = False,
+                           prune_fraction: float = 0.0) -> None:
   """Export model as C data.
 
   Args:
     model_file: String, model params pickle file.
     output_file: String, output C file to write.
+    int8: Bool, if true, weight matrices are written as int8.
+    tile_first_layer_frames: Integer, if positive, the first weight matrix is
+      also written tiled by frame for this number of frames.
+    float16: Bool, if true, weight matrices are written as half precision.
+    sparse: Bool, if true, weight matrices are written in block-sparse form.
+    prune_fraction: Float, with `sparse`, fraction of blocks to prune.
   """
+  if int8 + float16 + sparse > 1:
+    raise ValueError('int8, float16, and sparse are mutually exclusive')
   model = hk_util.TrainedModel.load(
       model_file, phone_model.model_fun, phone_model.Metadata)
 
   s = []
+  tiled = False
   print('\nModel parameters:')
   print('  %-20s %-12s %s' % ('name', 'dtype', 'shape'))
   for name, array in hk_util.params_as_list(model.params):
@@ -73,10 +226,56 @@ def export_model_as_c_data(model_file: str, output_file: str) -> None:
     array = np.asarray(array)
     print('  %-20s %-12s %s' % (name, array.dtype, array.shape))
     size = ' * '.join(map(str, array.shape))
-    s.append(textwrap.fill(
-        f'static const float {name}[{size}] = '
-        + format_c_array(array.flatten(order='F')) + ';',
-        MAX_WIDTH, subsequent_indent='    ') + '\n')
+    if int8 and array.ndim >= 2:
+      array_q, scales = quantize_int8(array)
+      s.append(textwrap.fill(
+          f'static const int8_t {name}Int8[{size}] = '
+          + format_c_int_array(array_q.flatten(order='F')) + ';',
+          MAX_WIDTH, subsequent_indent='    ') + '\n')
+      s.append(textwrap.fill(
+          f'static const float {name}Scales[{array.shape[-1]}] = '
+          + format_c_array(scales) + ';',
+          MAX_WIDTH, subsequent_indent='    ') + '\n')
+    elif sparse and array.ndim == 2:
+      group_begin, block_input, block_weights = sparsify_4x1(
+          array, prune_fraction)
+      print('  %-20s %d of %d blocks nonzero' % (
+          '', len(block_input), array.shape[0] * (len(group_begin) - 1)))
+      for suffix, ctype, values in (
+          ('GroupBegin', 'uint16_t', group_begin),
+          ('BlockInput', 'uint16_t', block_input),
+          ('BlockWeights', 'float', block_weights)):
+        if not len(values):  # C doesn't allow empty arrays.
+          formatted = '{0}'
+        elif ctype == 'float':
+          formatted = format_c_array(values)
+        else:
+          formatted = format_c_int_array(values)
+        s.append(textwrap.fill(
+            f'static const {ctype} {name}{suffix}[{max(len(values), 1)}] = '
+            + formatted + ';', MAX_WIDTH, subsequent_indent='    ') + '\n')
+      s.append(textwrap.fill(
+          f'static const DenseSparseWeights {name}Sparse = '
+          f'{{{array.shape[0]}, {array.shape[1]}, {name}GroupBegin, '
+          f'{name}BlockInput, {name}BlockWeights}};',
+          MAX_WIDTH, subsequent_indent='    ') + '\n')
+    elif float16 and array.ndim >= 2:
+      array_f16 = array.astype(np.float16).view(np.uint16)
+      s.append(textwrap.fill(
+          f'static const uint16_t {name}F16[{size}] = '
+          + format_c_hex16_array(array_f16.flatten(order='F')) + ';',
+          MAX_WIDTH, subsequent_indent='    ') + '\n')
+    else:
+      s.append(textwrap.fill(
+          f'static const float {name}[{size}] = '
+          + format_c_array(array.flatten(order='F')) + ';',
+          MAX_WIDTH, subsequent_indent='    ') + '\n')
+    if tile_first_layer_frames > 0 and array.ndim == 2 and not tiled:
+      s.append(textwrap.fill(
+          f'static const float {name}Tiled[{size}] = '
+          + format_c_array(tile_by_frame(array, tile_first_layer_frames))
+          + ';', MAX_WIDTH, subsequent_indent='    ') + '\n')
+      tiled = True
 
   with open(output_file, 'wt') as f:
     f.write('/* Model parameters. */\n\n' + '\n'.join(s))
@@ -84,7 +283,9 @@ def export_model_as_c_data(model_file: str, output_file: str) -> None:
 
 
 def main(_):
-  export_model_as_c_data(FLAGS.model, FLAGS.output)
+  export_model_as_c_data(FLAGS.model, FLAGS.output, FLAGS.quantize_int8,
+                         FLAGS.tile_first_layer_frames, FLAGS.float16,
+                         FLAGS.sparse, FLAGS.prune_fraction)
 
 
 if __name__ == '__main__':
@@ -0,0 +1,447 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ *
+ * Python bindings for the memory-mapped frame store.
+ *
+ * These bindings wrap extras/tools/frame_store.c as a `frame_store` Python
+ * module. See frame_store.h for the file format.
+ *
+ * The interface is as follows. See also frame_store_test.py for use example.
+ *
+ * def write(file_name, utterances, metadata='')
+ *   """Writes a frame store.
+ *
+ *   Args:
+ *     file_name: String, output file path.
+ *     utterances: Iterable of (frames, labels) pairs, where `frames` is a 2D
+ *       float32 array of shape (num_frames, num_channels) and `labels` is None
+ *       or a sequence of `num_frames` str or bytes phone labels of at most 7
+ *       characters. The iterable may be a generator, so that the corpus need
+ *       not be in memory at once.
+ *     metadata: String, e.g. a JSON dump of frontend parameters.
+ *   """
+ *
+ * class FrameStore(object):
+ *
+ *   def __init__(self, file_name)
+ *     """Opens and memory maps a frame store. Raises ValueError on failure."""
+ *
+ *   The following properties are zero-copy, read-only numpy views of the
+ *   mapping, valid as long as they are referenced:
+ *
+ *   frames             float32 array of shape (num_frames, num_channels).
+ *   labels             'S8' array of shape (num_frames,).
+ *   utterance_offsets  int64 array of shape (num_utterances + 1,).
+ *
+ *   Other properties: num_channels, num_frames, num_utterances, metadata.
+ *
+ *   def gather(self, indices, num_context_frames=0)
+ *     """Copies a minibatch. [Wraps `FrameStoreGather()`.]
+ *
+ *     Returns:
+ *       float32 array of shape
+ *       (len(indices), num_context_frames + 1, num_channels), where example i
+ *       is frames `indices[i] - num_context_frames` to `indices[i]`, repeating
+ *       the first frame of the utterance where context precedes it.
+ *     """
+ *
+ *   def shard_range(self, shard, num_shards)
+ *     """Gets the (begin, end) frame range of shard `shard` of `num_shards`,
+ *     split at utterance boundaries, e.g. for one process of several."""
+ */
+
+#define PY_SSIZE_T_CLEAN
+#include "Python.h"
+/* Disallow Numpy 1.7 deprecated symbols. */
+#define NPY_NO_DEPRECATED_API NPY_1_7_API_VERSION
+#include "extras/tools/frame_store.h"
+#include "numpy/arrayobject.h"
+
+/* Copies a str or bytes label to `dest`, null padded. Returns 1 on success. */
+static int CopyLabel(PyObject* label, char* dest) {
+  const char* data;
+  Py_ssize_t size;
+  if (PyUnicode_Check(label)) {
+    if (!(data = PyUnicode_AsUTF8AndSize(label, &size))) { return 0; }
+  } else if (PyBytes_Check(label)) {
+    data = PyBytes_AS_STRING(label);
+    size = PyBytes_GET_SIZE(label);
+  } else {
+    PyErr_SetString(PyExc_TypeError, "labels must be str or bytes");
+    return 0;
+  }
+  if (size >= kFrameStoreLabelSize) {
+    PyErr_SetString(PyExc_ValueError, "label is too long");
+    return 0;
+  }
+  memset(dest, 0, kFrameStoreLabelSize);
+  memcpy(dest, data, size);
+  return 1;
+}
+
+/* Appends one (frames, labels) utterance. Returns 1 on success. */
+static int AppendUtterance(FrameStoreWriter** writer, const char* file_name,
+                           PyObject* utterance) {
+  PyObject* frames_arg;
+  PyObject* labels_arg;
+  if (!PyArg_ParseTuple(utterance, "OO:utterance", &frames_arg, &labels_arg)) {
+    return 0;
+  }
+  PyArrayObject* frames = (PyArrayObject*)PyArray_FromAny(
+      frames_arg, PyArray_DescrFromType(NPY_FLOAT), 2, 2,
+      NPY_ARRAY_FORCECAST | NPY_ARRAY_DEFAULT, NULL);
+  if (!frames) { return 0; }
+  const int num_frames = (int)PyArray_DIM(frames, 0);
+  const int num_channels = (int)PyArray_DIM(frames, 1);
+
+  char* labels = NULL;
+  int success = 0;
+  if (*writer == NULL &&
+      !(*writer = FrameStoreWriterOpen(file_name, num_channels))) {
+    PyErr_SetString(PyExc_ValueError, "Error creating frame store");
+    goto done;
+  } else if (num_channels != (*writer)->num_channels) {
+    PyErr_SetString(PyExc_ValueError,
+                    "all utterances must have the same number of channels");
+    goto done;
+  }
+
+  if (labels_arg != Py_None) {
+    if (PySequence_Size(labels_arg) != num_frames) {
+      PyErr_SetString(PyExc_ValueError,
+                      "labels must have one label per frame");
+      goto done;
+    }
+    labels = (char*)malloc(kFrameStoreLabelSize * (num_frames + 1));
+    if (labels == NULL) {
+      PyErr_NoMemory();
+      goto done;
+    }
+    int i;
+    for (i = 0; i < num_frames; ++i) {
+      PyObject* label = PySequence_GetItem(labels_arg, i);
+      const int copied =
+          label && CopyLabel(label, labels + kFrameStoreLabelSize * i);
+      Py_XDECREF(label);
+      if (!copied) { goto done; }
+    }
+  }
+
+  if (!FrameStoreWriterAppend(*writer, (const float*)PyArray_DATA(frames),
+                              labels, num_frames)) {
+    PyErr_SetString(PyExc_IOError, "Error writing frame store");
+    goto done;
+  }
+  success = 1;
+
+done:
+  free(labels);
+  Py_DECREF(frames);
+  return success;
+}
+
+/* Define `write()`. */
+static PyObject* WritePython(PyObject* dummy, PyObject* args, PyObject* kw) {
+  const char* file_name;
+  PyObject* utterances_arg;
+  const char* metadata = "";
+  static const char* keywords[] = {"file_name", "utterances", "metadata",
+                                   NULL};
+
+  if (!PyArg_ParseTupleAndKeywords(args, kw, "sO|s:write", (char**)keywords,
+                                   &file_name, &utterances_arg, &metadata)) {
+    return NULL;  /* PyArg_ParseTupleAndKeywords failed. */
+  }
+
+  PyObject* iterator = PyObject_GetIter(utterances_arg);
+  if (!iterator) { return NULL; }
+  FrameStoreWriter* writer = NULL;
+  PyObject* utterance;
+  int success = 1;
+  while (success && (utterance = PyIter_Next(iterator))) {
+    success = AppendUtterance(&writer, file_name, utterance);
+    Py_DECREF(utterance);
+  }
+  Py_DECREF(iterator);
+  if (PyErr_Occurred()) { success = 0; }
+
+  if (writer == NULL) {
+    if (success) {
+      PyErr_SetString(PyExc_ValueError, "utterances must not be empty");
+    }
+    return NULL;
+  }
+  if (!FrameStoreWriterClose(writer, metadata) && success) {
+    PyErr_SetString(PyExc_IOError, "Error writing frame store");
+    return NULL;
+  }
+  if (!success) { return NULL; }
+  Py_INCREF(Py_None);
+  return Py_None;
+}
+
+typedef struct {
+  PyObject_HEAD
+  FrameStore* store;
+} FrameStoreObject;
+
+/* Define `FrameStore.__init__`. */
+static int FrameStoreObjectInit(FrameStoreObject* self, PyObject* args,
+                                PyObject* kw) {
+  const char* file_name;
+  static const char* keywords[] = {"file_name", NULL};
+  if (!PyArg_ParseTupleAndKeywords(args, kw, "s:__init__", (char**)keywords,
+                                   &file_name)) {
+    return -1;  /* PyArg_ParseTupleAndKeywords failed. */
+  }
+  FrameStoreClose(self->store);
+  self->store = FrameStoreOpen(file_name);
+  if (self->store == NULL) {
+    PyErr_SetString(PyExc_ValueError, "Error opening frame store");
+    return -1;
+  }
+  return 0;
+}
+
+static void FrameStoreDealloc(FrameStoreObject* self) {
+  FrameStoreClose(self->store);
+  Py_TYPE(self)->tp_free((PyObject*)self);
+}
+
+/* Makes a read-only numpy array viewing `data`, which keeps `self` alive. */
+static PyObject* MakeView(FrameStoreObject* self, int nd, npy_intp* dims,
+                          int type_num, int itemsize, const void* data) {
+  PyObject* array = PyArray_New(&PyArray_Type, nd, dims, type_num, NULL,
+                                (void*)data, itemsize, NPY_ARRAY_CARRAY_RO,
+                                NULL);
+  if (!array) { return NULL; }
+  Py_INCREF(self);
+  if (PyArray_SetBaseObject((PyArrayObject*)array, (PyObject*)self) < 0) {
+    Py_DECREF(array);
+    return NULL;
+  }
+  return array;
+}
+
+/* Define `FrameStore.frames` property getter. */
+static PyObject* FrameStoreObjectFrames(FrameStoreObject* self) {
+  npy_intp dims[2];
+  dims[0] = (npy_intp)self->store->num_frames;
+  dims[1] = self->store->num_channels;
+  return MakeView(self, 2, dims, NPY_FLOAT, 0, self->store->frames);
+}
+
+/* Define `FrameStore.labels` property getter. */
+static PyObject* FrameStoreObjectLabels(FrameStoreObject* self) {
+  npy_intp dims[1];
+  dims[0] = (npy_intp)self->store->num_frames;
+  return MakeView(self, 1, dims, NPY_STRING, kFrameStoreLabelSize,
+                  self->store->labels);
+}
+
+/* Define `FrameStore.utterance_offsets` property getter. */
+static PyObject* FrameStoreObjectUtteranceOffsets(FrameStoreObject* self) {
+  npy_intp dims[1];
+  dims[0] = (npy_intp)self->store->num_utterances + 1;
+  return MakeView(self, 1, dims, NPY_INT64, 0,
+                  self->store->utterance_offsets);
+}
+
+/* Define `FrameStore.metadata` property getter. */
+static PyObject* FrameStoreObjectMetadata(FrameStoreObject* self) {
+  return PyUnicode_FromStringAndSize(self->store->metadata,
+                                     self->store->metadata_size);
+}
+
+static PyObject* FrameStoreObjectNumChannels(FrameStoreObject* self) {
+  return PyLong_FromLong(self->store->num_channels);
+}
+
+static PyObject* FrameStoreObjectNumFrames(FrameStoreObject* self) {
+  return PyLong_FromLongLong(self->store->num_frames);
+}
+
+static PyObject* FrameStoreObjectNumUtterances(FrameStoreObject* self) {
+  return PyLong_FromLongLong(self->store->num_utterances);
+}
+
+/* Define `FrameStore.gather()`. */
+static PyObject* FrameStoreObjectGather(FrameStoreObject* self,
+                                        PyObject* args, PyObject* kw) {
+  PyObject* indices_arg;
+  int num_context_frames = 0;
+  static const char* keywords[] = {"indices", "num_context_frames", NULL};
+  if (!PyArg_ParseTupleAndKeywords(args, kw, "O|i:gather", (char**)keywords,
+                                   &indices_arg, &num_context_frames)) {
+    return NULL;  /* PyArg_ParseTupleAndKeywords failed. */
+  }
+  if (num_context_frames < 0) {
+    PyErr_SetString(PyExc_ValueError, "num_context_frames must be >= 0");
+    return NULL;
+  }
+
+  PyArrayObject* indices = (PyArrayObject*)PyArray_FromAny(
+      indices_arg, PyArray_DescrFromType(NPY_INT64), 1, 1,
+      NPY_ARRAY_FORCECAST | NPY_ARRAY_DEFAULT, NULL);
+  if (!indices) { return NULL; }
+  const npy_intp num_indices = PyArray_DIM(indices, 0);
+  const int64_t* index_data = (const int64_t*)PyArray_DATA(indices);
+  npy_intp i;
+  for (i = 0; i < num_indices; ++i) {
+    if (!(0 <= index_data[i] && index_data[i] < self->store->num_frames)) {
+      Py_DECREF(indices);
+      PyErr_SetString(PyExc_IndexError, "index out of range");
+      return NULL;
+    }
+  }
+
+  npy_intp dims[3];
+  dims[0] = num_indices;
+  dims[1] = num_context_frames + 1;
+  dims[2] = self->store->num_channels;
+  PyArrayObject* output = (PyArrayObject*)PyArray_SimpleNew(3, dims, NPY_FLOAT);
+  if (!output) {
+    Py_DECREF(indices);
+    return NULL;
+  }
+
+  Py_BEGIN_ALLOW_THREADS
+  FrameStoreGather(self->store, index_data, (int)num_indices,
+                   num_context_frames, (float*)PyArray_DATA(output));
+  Py_END_ALLOW_THREADS
+
+  Py_DECREF(indices);
+  return (PyObject*)output;
+}
+
+/* Define `FrameStore.shard_range()`. */
+static PyObject* FrameStoreObjectShardRange(FrameStoreObject* self,
+                                            PyObject* args, PyObject* kw) {
+  int shard;
+  int num_shards;
+  static const char* keywords[] = {"shard", "num_shards", NULL};
+  if (!PyArg_ParseTupleAndKeywords(args, kw, "ii:shard_range",
+                                   (char**)keywords, &shard, &num_shards)) {
+    return NULL;  /* PyArg_ParseTupleAndKeywords failed. */
+  }
+  if (!(0 <= shard && shard < num_shards)) {
+    PyErr_SetString(PyExc_ValueError,
+                    "shard must be in range [0, num_shards)");
+    return NULL;
+  }
+  int64_t begin;
+  int64_t end;
+  FrameStoreShardRange(self->store, shard, num_shards, &begin, &end);
+  return Py_BuildValue("(LL)", (long long)begin, (long long)end);
+}
+
+/* FrameStore's methods. */
+static PyMethodDef kFrameStoreMethods[] = {
+    {"gather", (PyCFunction)FrameStoreObjectGather,
+     METH_VARARGS | METH_KEYWORDS, "Copies a minibatch of frames."},
+    {"shard_range", (PyCFunction)FrameStoreObjectShardRange,
+     METH_VARARGS | METH_KEYWORDS, "Gets the frame range of a shard."},
+    {NULL, NULL, 0, NULL} /* Sentinel */
+};
+
+/* FrameStore's getters (properties). */
+static PyGetSetDef kFrameStoreGetSetDef[] = {
+    {"frames", (getter)FrameStoreObjectFrames, NULL,
+     "Frames as a zero-copy 2D float32 array."},
+    {"labels", (getter)FrameStoreObjectLabels, NULL,
+     "Labels as a zero-copy 'S8' array."},
+    {"utterance_offsets", (getter)FrameStoreObjectUtteranceOffsets, NULL,
+     "Utterance frame offsets as a zero-copy int64 array."},
+    {"metadata", (getter)FrameStoreObjectMetadata, NULL, "Metadata string."},
+    {"num_channels", (getter)FrameStoreObjectNumChannels, NULL,
+     "Number of channels."},
+    {"num_frames", (getter)FrameStoreObjectNumFrames, NULL,
+     "Number of frames."},
+    {"num_utterances", (getter)FrameStoreObjectNumUtterances, NULL,
+     "Number of utterances."},
+    {NULL} /* Sentinel */
+};
+
+/* Define the FrameStore Python type. */
+static PyTypeObject kFrameStoreType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    "FrameStore",                     /* tp_name */
+    sizeof(FrameStoreObject),         /* tp_basicsize */
+    0,                                /* tp_itemsize */
+    (destructor)FrameStoreDealloc,    /* tp_dealloc */
+    0,                                /* tp_print */
+    0,                                /* tp_getattr */
+    0,                                /* tp_setattr */
+    0,                                /* tp_compare */
+    0,                                /* tp_repr */
+    0,                                /* tp_as_number */
+    0,                                /* tp_as_sequence */
+    0,                                /* tp_as_mapping */
+    0,                                /* tp_hash */
+    0,                                /* tp_call */
+    0,                                /* tp_str */
+    0,                                /* tp_getattro */
+    0,                                /* tp_setattro */
+    0,                                /* tp_as_buffer */
+    Py_TPFLAGS_DEFAULT,               /* tp_flags */
+    "FrameStore object",              /* tp_doc */
+    0,                                /* tp_traverse */
+    0,                                /* tp_clear */
+    0,                                /* tp_richcompare */
+    0,                                /* tp_weaklistoffset */
+    0,                                /* tp_iter */
+    0,                                /* tp_iternext */
+    kFrameStoreMethods,               /* tp_methods */
+    0,                                /* tp_members */
+    kFrameStoreGetSetDef,             /* tp_getset */
+    0,                                /* tp_base */
+    0,                                /* tp_dict */
+    0,                                /* tp_descr_get */
+    0,                                /* tp_descr_set */
+    0,                                /* tp_dictoffset */
+    (initproc)FrameStoreObjectInit,   /* tp_init */
+};
+
+/* Module methods. */
+static PyMethodDef kModuleMethods[] = {
+    {"write", (PyCFunction)WritePython, METH_VARARGS | METH_KEYWORDS,
+     "Writes a frame store."},
+    {NULL, NULL, 0, NULL} /* Sentinel */
+};
+
+/* Module definition. */
+static struct PyModuleDef kModule = {
+    PyModuleDef_HEAD_INIT,
+    "frame_store",   /* m_name */
+    NULL,            /* m_doc */
+    (Py_ssize_t)-1,  /* m_size */
+    kModuleMethods,  /* m_methods */
+    NULL,            /* m_reload */
+    NULL,            /* m_traverse */
+    NULL,            /* m_clear */
+    NULL,            /* m_free */
+};
+
+PyMODINIT_FUNC PyInit_frame_store(void) {
+  import_array();
+  PyObject* m = PyModule_Create(&kModule);
+  kFrameStoreType.tp_new = PyType_GenericNew;
+  if (PyType_Ready(&kFrameStoreType) >= 0) {
+    Py_INCREF(&kFrameStoreType);
+    PyModule_AddObject(m, "FrameStore", (PyObject*)&kFrameStoreType);
+  }
+  return m;
+}
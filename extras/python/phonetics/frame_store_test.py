@@ -0,0 +1,93 @@
+# Copyright 2022 Google LLC
+#
+# Licensed under the Apache License, Version 2.0 (the "License"); you may not
+# use this file except in compliance with the License. You may obtain a copy of
+# the License at
+#
+#     https://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+# WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+# License for the specific language governing permissions and limitations under
+# the License.
+
+"""Tests for frame_store Python bindings."""
+
+import json
+import os.path
+import tempfile
+import unittest
+import numpy as np
+
+from extras.python.phonetics import frame_store
+from extras.python.phonetics import phone_util
+
+
+class FrameStoreTest(unittest.TestCase):
+
+  def setUp(self):
+    super().setUp()
+    np.random.seed(0)
+    self.file_name = os.path.join(tempfile.mkdtemp(), 'test.fstore')
+    self.frames = [np.random.rand(n, 6).astype(np.float32) for n in (10, 4)]
+    self.labels = [['sil'] * 3 + ['ae'] * 7, [b'iy'] * 4]
+    frame_store.write(self.file_name,
+                      zip(self.frames, self.labels),
+                      metadata=json.dumps({'num_frames_left_context': 1}))
+
+  def test_zero_copy_views(self):
+    store = frame_store.FrameStore(self.file_name)
+    self.assertEqual(store.num_channels, 6)
+    self.assertEqual(store.num_frames, 14)
+    self.assertEqual(store.num_utterances, 2)
+    np.testing.assert_array_equal(store.utterance_offsets, [0, 10, 14])
+    np.testing.assert_array_equal(store.frames, np.concatenate(self.frames))
+    np.testing.assert_array_equal(
+        store.labels, [b'sil'] * 3 + [b'ae'] * 7 + [b'iy'] * 4)
+    self.assertEqual(json.loads(store.metadata),
+                     {'num_frames_left_context': 1})
+
+    frames = store.frames
+    self.assertFalse(frames.flags.writeable)
+    del store  # The view keeps the mapping alive.
+    np.testing.assert_array_equal(frames[10:], self.frames[1])
+
+  def test_gather(self):
+    store = frame_store.FrameStore(self.file_name)
+    batch = store.gather([11, 0, 5], num_context_frames=2)
+    self.assertEqual(batch.shape, (3, 3, 6))
+    # Context before the start of the utterance repeats its first frame.
+    np.testing.assert_array_equal(batch[0], self.frames[1][[0, 0, 1]])
+    np.testing.assert_array_equal(batch[1], self.frames[0][[0, 0, 0]])
+    np.testing.assert_array_equal(batch[2], self.frames[0][3:6])
+
+    with self.assertRaises(IndexError):
+      store.gather([14])
+
+  def test_shard_range(self):
+    store = frame_store.FrameStore(self.file_name)
+    self.assertEqual(store.shard_range(0, 1), (0, 14))
+    self.assertEqual(store.shard_range(0, 2), (0, 10))
+    self.assertEqual(store.shard_range(1, 2), (10, 14))
+
+  def test_read_dataset_frame_store(self):
+    dataset = phone_util.read_dataset_frame_store(self.file_name)
+    self.assertEqual(dataset.num_channels, 6)
+    self.assertEqual(dataset.num_frames, 2)
+    self.assertEqual(dataset.example_counts, {'sil': 3, 'ae': 7, 'iy': 4})
+    np.testing.assert_array_equal(dataset.examples['iy'][:, -1, :],
+                                  self.frames[1])
+
+  def test_invalid(self):
+    with self.assertRaises(ValueError):
+      frame_store.write(self.file_name,
+                        [(np.zeros((3, 6)), None), (np.zeros((3, 5)), None)])
+    with self.assertRaises(ValueError):
+      frame_store.write(self.file_name, [(np.zeros((3, 6)), ['a', 'b'])])
+    with self.assertRaises(ValueError):
+      frame_store.FrameStore(os.path.join(tempfile.mkdtemp(), 'missing'))
+
+
+if __name__ == '__main__':
+  unittest.main()
@@ -136,10 +136,11 @@ def load_dataset(npz_file: str,
 
   The .npz file holds 3D arrays of examples. The arrays are named according to
   which class they represent, e.g. an array named 'ae' represents examples with
-  ground truth label 'ae'.
+  ground truth label 'ae'. Alternatively, a memory-mapped frame store with
+  ".fstore" extension may be given (see phone_util.read_dataset_frame_store).
 
   Args:
-    npz_file: String, npz filename.
+    npz_file: String, npz or fstore filename.
     classes: List of phoneme class names to train the model to classify.
     class_weights: Dict, class weights for randomly subsampling the data. The
       fraction of examples retained for class `phone` is
@@ -153,7 +154,10 @@ def load_dataset(npz_file: str,
   class_weights = {phone: class_weights.get(phone, 1.0) / max_weight
                    for phone in classes}
 
-  dataset = phone_util.read_dataset_npz(npz_file)
+  if npz_file.endswith('.fstore'):
+    dataset = phone_util.read_dataset_frame_store(npz_file)
+  else:
+    dataset = phone_util.read_dataset_npz(npz_file)
   dataset.subsample(class_weights)
   return dataset
 
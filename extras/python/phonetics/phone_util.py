@@ -26,6 +26,7 @@ from absl import flags
 import numpy as np
 
 from extras.python import frontend
+from extras.python.phonetics import frame_store
 
 FLAGS = flags.FLAGS
 
@@ -373,3 +374,32 @@ def read_dataset_npz(npz_file: Any) -> Dataset:
       if k != 'dataset_metadata'
   }
   return Dataset(examples, metadata)
+
+
+def read_dataset_frame_store(store_file: str) -> Dataset:
+  """Reads Dataset from a frame store written by frame_store.write().
+
+  Each labeled frame becomes an example for its label, with
+  `metadata['num_frames_left_context']` frames of left context (default 0).
+  Frames are gathered from the memory-mapped store, so only the examples are
+  copied. Unlabeled frames are skipped.
+
+  Args:
+    store_file: String, frame store filename.
+  Returns:
+    Dataset.
+  """
+  store = frame_store.FrameStore(store_file)
+  metadata = json.loads(store.metadata) if store.metadata else {}
+  metadata['num_channels'] = store.num_channels
+  num_frames_left_context = int(metadata.setdefault(
+      'num_frames_left_context', 0))
+
+  labels = store.labels
+  examples = {}
+  for label in np.unique(labels):
+    if label:
+      indices = np.flatnonzero(labels == label)
+      examples[label.decode('utf8')] = store.gather(
+          indices, num_context_frames=num_frames_left_context)
+  return Dataset(examples, metadata)
@@ -0,0 +1,83 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * Helpers for Python bindings to write into caller-provided output buffers.
+ *
+ * With these, a binding's `process_samples(samples, out=None)` may write into
+ * any object supporting the buffer protocol, e.g. a preallocated numpy array or
+ * a slice of one, rather than allocating a new array on every call:
+ *
+ *   Py_buffer out_view;
+ *   if (!GetFloatOutBuffer(out_arg, num_elements, &out_view)) {
+ *     return NULL;
+ *   }
+ *   float* output = (float*)out_view.buf;
+ *   ...
+ *   PyBuffer_Release(&out_view);
+ */
+
+#ifndef AUDIO_TO_TACTILE_EXTRAS_PYTHON_PYTHON_BUFFER_H_
+#define AUDIO_TO_TACTILE_EXTRAS_PYTHON_PYTHON_BUFFER_H_
+
+#include <string.h>
+
+#include "Python.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Returns 1 if `format` is a buffer protocol format for native float32. */
+static int /*bool*/ IsFloat32Format(const char* format) {
+  if (format == NULL) { return 0; }  /* NULL means unsigned bytes. */
+  if (*format == '@' || *format == '=') {
+    ++format;
+#if PY_LITTLE_ENDIAN
+  } else if (*format == '<') {
+#else
+  } else if (*format == '>' || *format == '!') {
+#endif
+    ++format;
+  }
+  return strcmp(format, "f") == 0;
+}
+
+/* Gets a view of `obj` as a writable C-contiguous float32 buffer with
+ * `num_elements` elements. Returns 1 on success, in which case the caller must
+ * call `PyBuffer_Release(view)` when done. On failure, sets a Python exception
+ * and returns 0.
+ */
+static int /*bool*/ GetFloatOutBuffer(PyObject* obj, Py_ssize_t num_elements,
+                                      Py_buffer* view) {
+  if (PyObject_GetBuffer(obj, view, PyBUF_WRITABLE | PyBUF_FORMAT |
+                                    PyBUF_C_CONTIGUOUS) != 0) {
+    return 0;  /* PyObject_GetBuffer already set an error. */
+  }
+  if (view->itemsize != sizeof(float) || !IsFloat32Format(view->format)) {
+    PyErr_SetString(PyExc_ValueError, "out must have dtype float32");
+  } else if (view->len != num_elements * (Py_ssize_t)sizeof(float)) {
+    PyErr_Format(PyExc_ValueError, "out must have %zd elements, got %zd",
+                 num_elements, view->len / (Py_ssize_t)sizeof(float));
+  } else {
+    return 1;
+  }
+  PyBuffer_Release(view);
+  return 0;
+}
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif
+#endif /* AUDIO_TO_TACTILE_EXTRAS_PYTHON_PYTHON_BUFFER_H_ */
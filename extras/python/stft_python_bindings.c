@@ -0,0 +1,259 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * Python bindings for Stft C implementation.
+ *
+ * These bindings wrap the stft.c library in dsp as a `stft_python_bindings`
+ * Python module containing an `StftImpl` class.
+ *
+ * The Python library dsp.py wraps these bindings to give a nicer interface and
+ * type annotations. See q_resampler_python_bindings.c for general notes about
+ * these bindings.
+ */
+
+#define PY_SSIZE_T_CLEAN
+#include "Python.h"
+/* Disallow Numpy 1.7 deprecated symbols. */
+#define NPY_NO_DEPRECATED_API NPY_1_7_API_VERSION
+#include "numpy/arrayobject.h"
+#include "src/dsp/stft.h"
+
+typedef struct {
+  PyObject_HEAD Stft* stft;
+} StftImplObject;
+
+/* Define `StftImpl.__init__`. */
+static int StftImplObjectInit(StftImplObject* self,
+                              PyObject* args, PyObject* kw) {
+  float sample_rate_hz = 0.0f;
+  int frame_size = 0;
+  int hop_size = 0;
+  PyObject* window_arg = Py_None;
+  int pooling = kStftNoPooling;
+  StftOptions options = kStftDefaultOptions;
+  static const char* keywords[] = {
+      "sample_rate_hz",
+      "frame_size",
+      "hop_size",
+      "window",
+      "pooling",
+      "num_bands",
+      "min_frequency_hz",
+      "max_frequency_hz",
+      NULL};
+
+  /* 'f' => float, 'i' => int, 'O' => PyObject. */
+  if (!PyArg_ParseTupleAndKeywords(
+          args, kw, "fii|Oiiff:__init__", (char**)keywords,
+          &sample_rate_hz,
+          &frame_size,
+          &hop_size,
+          &window_arg,
+          &pooling,
+          &options.num_bands,
+          &options.min_frequency_hz,
+          &options.max_frequency_hz)) {
+    return -1;  /* PyArg_ParseTupleAndKeywords failed. */
+  }
+  if (!(kStftNoPooling <= pooling && pooling <= kStftErbPooling)) {
+    PyErr_SetString(PyExc_ValueError, "Invalid pooling");
+    return -1;
+  }
+  options.pooling = (StftPooling)pooling;
+
+  PyArrayObject* window = NULL;
+  if (window_arg != Py_None) {
+    /* Convert window to numpy array with contiguous float32 data. */
+    window = (PyArrayObject*)PyArray_FromAny(
+        window_arg, PyArray_DescrFromType(NPY_FLOAT), 1, 1,
+        NPY_ARRAY_ALIGNED | NPY_ARRAY_NOTSWAPPED | NPY_ARRAY_FORCECAST |
+            NPY_ARRAY_DEFAULT,
+        NULL);
+    if (!window) { return -1; }
+    if (PyArray_DIM(window, 0) != frame_size) {
+      PyErr_Format(PyExc_ValueError, "expected window of size %d",
+                   frame_size);
+      Py_DECREF(window);
+      return -1;
+    }
+    options.window = (const float*)PyArray_DATA(window);
+  }
+
+  /* StftMake() copies the window, so it can be released after. */
+  self->stft = StftMake(sample_rate_hz, frame_size, hop_size, &options);
+  Py_XDECREF(window);
+  if (self->stft == NULL) {
+    PyErr_SetString(PyExc_ValueError, "Error making Stft");
+    return -1;
+  }
+  return 0;
+}
+
+static void StftImplDealloc(StftImplObject* self) {
+  StftFree(self->stft);
+  Py_TYPE(self)->tp_free((PyObject*)self);
+}
+
+/* Define `StftImpl.reset`. */
+static PyObject* StftImplObjectReset(StftImplObject* self) {
+  StftReset(self->stft);
+  Py_INCREF(Py_None);
+  return Py_None;
+}
+
+/* Define `StftImpl.process_samples`. */
+static PyObject* StftImplObjectProcessSamples(
+    StftImplObject* self, PyObject* args, PyObject* kw) {
+  PyObject* samples_arg = NULL;
+  static const char* keywords[] = {"samples", NULL};
+
+  if (!PyArg_ParseTupleAndKeywords(args, kw, "O:process_samples",
+                                   (char**)keywords, &samples_arg)) {
+    return NULL; /* PyArg_ParseTupleAndKeywords failed. */
+  }
+
+  /* Convert input samples to 1D numpy array with contiguous float32 data. */
+  PyArrayObject* samples = (PyArrayObject*)PyArray_FromAny(
+      samples_arg, PyArray_DescrFromType(NPY_FLOAT), 1, 1,
+      NPY_ARRAY_ALIGNED | NPY_ARRAY_NOTSWAPPED | NPY_ARRAY_FORCECAST |
+          NPY_ARRAY_DEFAULT,
+      NULL);
+  if (!samples) { /* PyArray_FromAny failed and already set an error. */
+    return NULL;
+  }
+
+  Stft* stft = self->stft;
+  const int num_samples = PyArray_DIM(samples, 0);
+
+  /* Create output numpy array of shape (num_frames, num_outputs). */
+  npy_intp output_dims[2];
+  output_dims[0] = StftNextNumFrames(stft, num_samples);
+  output_dims[1] = StftNumOutputs(stft);
+  PyArrayObject* output = (PyArrayObject*)PyArray_SimpleNew(
+      2, output_dims, NPY_FLOAT);
+  if (!output) { /* PyArray_SimpleNew failed. */
+    Py_DECREF(samples);
+    return NULL;
+  }
+
+  StftProcessSamples(stft, (const float*)PyArray_DATA(samples), num_samples,
+                     (float*)PyArray_DATA(output));
+
+  Py_DECREF(samples);
+  return (PyObject*)output;
+}
+
+/* Define `StftImpl.num_outputs` property getter. */
+static PyObject* StftImplObjectNumOutputs(StftImplObject* self) {
+  return Py_BuildValue("i", StftNumOutputs(self->stft));
+}
+
+/* Define `StftImpl.frequencies_hz` property getter. */
+static PyObject* StftImplObjectFrequenciesHz(StftImplObject* self) {
+  npy_intp dims[1];
+  dims[0] = StftNumOutputs(self->stft);
+  PyArrayObject* frequencies_hz =
+      (PyArrayObject*)PyArray_SimpleNew(1, dims, NPY_FLOAT);
+  if (!frequencies_hz) { return NULL; }
+  float* data = (float*)PyArray_DATA(frequencies_hz);
+  int i;
+  for (i = 0; i < dims[0]; ++i) {
+    data[i] = StftOutputFrequencyHz(self->stft, i);
+  }
+  return (PyObject*)frequencies_hz;
+}
+
+/* StftImpl's method functions. */
+static PyMethodDef kStftImplMethods[] = {
+    {"reset", (PyCFunction)StftImplObjectReset, METH_NOARGS,
+     "Resets to initial state."},
+    {"process_samples", (PyCFunction)StftImplObjectProcessSamples,
+     METH_VARARGS | METH_KEYWORDS, "Processes samples in a streaming manner."},
+    {NULL} /* Sentinel */
+};
+
+/* StftImpl's getters (properties). */
+static PyGetSetDef kStftImplGetSetDef[] = {
+    {"num_outputs", (getter)StftImplObjectNumOutputs,
+     NULL, "Number of outputs per frame."},
+    {"frequencies_hz", (getter)StftImplObjectFrequenciesHz,
+     NULL, "Center frequency in Hz of each output."},
+    {NULL} /* Sentinel */
+};
+
+/* Define the StftImpl Python type. For meanings of these fields, see
+ * https://docs.python.org/3/c-api/typeobj.html
+ */
+static PyTypeObject kStftImplType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    "StftImpl",                        /* tp_name */
+    sizeof(StftImplObject),            /* tp_basicsize */
+    0,                                 /* tp_itemsize */
+    (destructor)StftImplDealloc,       /* tp_dealloc */
+    0,                                 /* tp_print */
+    0,                                 /* tp_getattr */
+    0,                                 /* tp_setattr */
+    0,                                 /* tp_compare */
+    0,                                 /* tp_repr */
+    0,                                 /* tp_as_number */
+    0,                                 /* tp_as_sequence */
+    0,                                 /* tp_as_mapping */
+    0,                                 /* tp_hash */
+    0,                                 /* tp_call */
+    0,                                 /* tp_str */
+    0,                                 /* tp_getattro */
+    0,                                 /* tp_setattro */
+    0,                                 /* tp_as_buffer */
+    Py_TPFLAGS_DEFAULT,                /* tp_flags */
+    "StftImpl object",                 /* tp_doc */
+    0,                                 /* tp_traverse */
+    0,                                 /* tp_clear */
+    0,                                 /* tp_richcompare */
+    0,                                 /* tp_weaklistoffset */
+    0,                                 /* tp_iter */
+    0,                                 /* tp_iternext */
+    kStftImplMethods,                  /* tp_methods */
+    0,                                 /* tp_members */
+    kStftImplGetSetDef,                /* tp_getset */
+    0,                                 /* tp_base */
+    0,                                 /* tp_dict */
+    0,                                 /* tp_descr_get */
+    0,                                 /* tp_descr_set */
+    0,                                 /* tp_dictoffset */
+    (initproc)StftImplObjectInit,      /* tp_init */
+};
+
+/* Module definition. */
+static struct PyModuleDef kModule = {
+    PyModuleDef_HEAD_INIT,
+    "stft_python_bindings",  /* m_name */
+    NULL,                    /* m_doc */
+    (Py_ssize_t)-1,          /* m_size */
+};
+
+PyMODINIT_FUNC PyInit_stft_python_bindings(void) {
+  import_array();
+  PyObject* m = PyModule_Create(&kModule);
+  if (m == NULL) { return NULL; }
+
+  kStftImplType.tp_new = PyType_GenericNew;
+  if (PyType_Ready(&kStftImplType) < 0) {
+    Py_DECREF(m);
+    return NULL;
+  }
+  Py_INCREF(&kStftImplType);
+  PyModule_AddObject(m, kStftImplType.tp_name, (PyObject*)&kStftImplType);
+  return m;
+}
@@ -37,15 +37,39 @@
  *  def reset():
  *    """Resets to initial state."""
  *
- *  def process_samples(self, input_samples, debug_out=None)
+ *  def process_samples(self, input_samples, debug_out=None, out=None,
+ *                      taps=None)
  *    """Process samples in a streaming manner.
  *
+ *    The GIL is released while processing, so that different Enveloper
+ *    objects may run in parallel threads. An Enveloper object should be used
+ *    by only one thread at a time, otherwise RuntimeError is raised.
+ *
  *    Args:
- *      input_samples: 1-D numpy array.
- *      debug_out: (Optional) A dict, which if passed, is filled with debug
- *        signals of the Enveloper's internal state.
+ *      input_samples: 1-D numpy array. If it is C-contiguous float32, or any
+ *        object supporting the buffer protocol with such data, it is used
+ *        without copying.
+ *      debug_out: (Optional) A dict, which if passed, is cleared and filled
+ *        with the 'smoothed_energy' and 'noise' taps described below.
+ *      out: (Optional) Writable C-contiguous float32 buffer with
+ *        `len(input_samples) / decimation_factor * NUM_CHANNELS` elements,
+ *        e.g. a numpy array. If passed, output is written to it and it is
+ *        returned instead of allocating a new array.
+ *      taps: (Optional) A dict requesting intermediate signals of the
+ *        Enveloper, recorded in the same pass as the output. Each key names a
+ *        signal, and its value is either None, in which case it is replaced
+ *        with a new array, or a writable C-contiguous float32 buffer to write
+ *        the signal to. The signals are
+ *          'bandpassed': Bandpass filter output, shape
+ *            `(len(input_samples), NUM_CHANNELS)`.
+ *          'energy': Lowpassed energy envelope, shape as the output.
+ *          'smoothed_energy': PCEN denominator, shape as the output.
+ *          'noise': Noise estimate for the noise gate, shape as the output.
+ *          'gain': Smoothed AGC gain, shape as the output.
+ *        Signals that aren't requested cost nothing.
  *    Returns:
- *      Array of length `len(input_samples) / decimation_factor`.
+ *      Array of shape `(len(input_samples) / decimation_factor, NUM_CHANNELS)`,
+ *      or `out` if passed.
  *    """
  *
  *  @property
@@ -60,6 +84,51 @@
  *  def decimation_factor(self)
  *    """Decimation factor between input and output."""
  *
+ * class EnveloperBatch(object):
+ *
+ *   def __init__(self, num_streams, input_sample_rate_hz,
+ *                decimation_factor=1, block_size=64, ...)
+ *    """Constructor for processing `num_streams` independent streams at once.
+ *
+ *    Remaining args are the same as for Enveloper. Streams are processed in
+ *    lockstep by `TactileProcessorBatchProcessEnveloper()`, with filter state
+ *    in struct-of-arrays layout so that the C inner loops vectorize across
+ *    streams. `block_size` is the number of samples per stream in each such
+ *    call, and must be a power of 2 and a multiple of decimation_factor.
+ *    """
+ *
+ *  def reset(self)
+ *    """Resets all streams to initial state."""
+ *
+ *  def reset_stream(self, stream)
+ *    """Resets one stream to initial state."""
+ *
+ *  def process_samples(self, input_samples, out=None)
+ *    """Process samples of all streams in a streaming manner.
+ *
+ *    Args:
+ *      input_samples: 2-D numpy array of shape (num_streams, num_samples),
+ *        where num_samples is a multiple of block_size.
+ *      out: (Optional) Writable C-contiguous float32 buffer with
+ *        `num_streams * num_samples / decimation_factor * NUM_CHANNELS`
+ *        elements.
+ *    Returns:
+ *      3-D array of shape
+ *      (num_streams, num_samples / decimation_factor, NUM_CHANNELS), or `out`.
+ *      For each stream, this is the same as Enveloper.process_samples().
+ *    """
+ *
+ *  @property
+ *  def num_streams(self)
+ *    """Number of streams."""
+ *
+ *  @property
+ *  def block_size(self)
+ *    """The block_size."""
+ *
+ *  (input_sample_rate_hz, output_sample_rate_hz, and decimation_factor
+ *  properties are as for Enveloper.)
+ *
  * NOTE: Using a tool like CLIF is generally a better idea than writing bindings
  * manually. We do it here anyway since as open sourced code it matters that it
  * is easy for others to build. Also, we use numpy, which CLIF does not natively
@@ -76,7 +145,12 @@
 #include "Python.h"
 /* Disallow Numpy 1.7 deprecated symbols. */
 #define NPY_NO_DEPRECATED_API NPY_1_7_API_VERSION
+#include <stdlib.h>
+#include <string.h>
+
 #include "src/tactile/enveloper.h"
+#include "src/tactile/tactile_processor_batch.h"
+#include "extras/python/python_buffer.h"
 #include "numpy/arrayobject.h"
 #include "structmember.h"
 
@@ -86,6 +160,8 @@ typedef struct {
   float input_sample_rate_hz;
   float output_sample_rate_hz;
   int decimation_factor;
+  /* Nonzero while process_samples is running with the GIL released. */
+  int busy;
 } EnveloperObject;
 
 /* Define `Enveloper.__init__`. */
@@ -146,12 +222,17 @@ static void EnveloperDealloc(EnveloperObject* self) {
 
 /* Define `Enveloper.reset`. */
 static PyObject* EnveloperObjectReset(EnveloperObject* self) {
+  if (self->busy) {
+    PyErr_SetString(PyExc_RuntimeError,
+                    "Enveloper is in use by another thread");
+    return NULL;
+  }
   EnveloperReset(&self->enveloper);
   Py_INCREF(Py_None);
   return Py_None;
 }
 
-/* Creates 1D float array in dict. Returns data pointer, or NULL on failure. */
+/* Creates 2D float array in dict. Returns data pointer, or NULL on failure. */
 static float* CreateArrayInDict(PyObject* dict, const char* key,
                                 int num_frames) {
   npy_intp dims[2];
@@ -166,18 +247,115 @@ static float* CreateArrayInDict(PyObject* dict, const char* key,
   return success ? data : NULL;
 }
 
+/* Number of signals that may be requested with `taps`. */
+#define kNumTaps 5
+/* Names of the signals that may be requested with `taps`. */
+static const char* kTapNames[kNumTaps] = {
+    "bandpassed", "energy", "smoothed_energy", "noise", "gain"};
+
+/* Views of caller-provided tap buffers, released after processing. */
+typedef struct {
+  Py_buffer views[kNumTaps];
+  int has_view[kNumTaps];
+} TapViews;
+
+static void ReleaseTapViews(TapViews* tap_views) {
+  int i;
+  for (i = 0; i < kNumTaps; ++i) {
+    if (tap_views->has_view[i]) {
+      PyBuffer_Release(&tap_views->views[i]);
+      tap_views->has_view[i] = 0;
+    }
+  }
+}
+
+/* Sets `taps` for the signals requested in `taps_dict`, where None values are
+ * replaced with new arrays. Returns 1 on success. On failure, sets a Python
+ * exception and returns 0. In either case, the caller must call
+ * ReleaseTapViews() when done.
+ */
+static int /*bool*/ SetUpTaps(PyObject* taps_dict, int num_samples,
+                              int num_frames, EnveloperTaps* taps,
+                              TapViews* tap_views) {
+  float** fields[kNumTaps];
+  fields[0] = &taps->bandpassed;
+  fields[1] = &taps->energy;
+  fields[2] = &taps->smoothed_energy;
+  fields[3] = &taps->noise;
+  fields[4] = &taps->gain;
+  memset(taps, 0, sizeof(*taps));
+
+  Py_ssize_t num_requested = 0;
+  int i;
+  for (i = 0; i < kNumTaps; ++i) {
+    /* PyDict_GetItemString() returns a borrowed reference. */
+    PyObject* value = PyDict_GetItemString(taps_dict, kTapNames[i]);
+    if (!value) { continue; }
+    ++num_requested;
+    /* The bandpassed signal has a frame per input sample. */
+    const int tap_frames = (i == 0) ? num_samples : num_frames;
+
+    if (value == Py_None) {
+      if (!(*fields[i] = CreateArrayInDict(taps_dict, kTapNames[i],
+                                           tap_frames))) {
+        return 0;
+      }
+    } else {
+      if (!GetFloatOutBuffer(
+            value, (Py_ssize_t)tap_frames * kEnveloperNumChannels,
+            &tap_views->views[i])) {
+        return 0;
+      }
+      tap_views->has_view[i] = 1;
+      *fields[i] = (float*)tap_views->views[i].buf;
+    }
+  }
+
+  if (num_requested != PyDict_Size(taps_dict)) {
+    PyErr_SetString(PyExc_ValueError,
+                    "taps keys must be 'bandpassed', 'energy', "
+                    "'smoothed_energy', 'noise', or 'gain'");
+    return 0;
+  }
+  return 1;
+}
+
 /* Define `Enveloper.process_samples`. */
 static PyObject* EnveloperObjectProcessSamples(
     EnveloperObject* self, PyObject* args, PyObject* kw) {
   PyObject* samples_arg = NULL;
   PyObject* debug_out = NULL;
-  static const char* keywords[] = {"samples", "debug_out", NULL};
+  PyObject* out_arg = Py_None;
+  PyObject* taps_dict = NULL;
+  static const char* keywords[] = {"samples", "debug_out", "out", "taps",
+                                   NULL};
 
-  if (!PyArg_ParseTupleAndKeywords(args, kw, "O|O!:process_samples",
+  if (!PyArg_ParseTupleAndKeywords(args, kw, "O|O!OO!:process_samples",
                                    (char**)keywords, &samples_arg,
-                                   &PyDict_Type, &debug_out)) {
+                                   &PyDict_Type, &debug_out, &out_arg,
+                                   &PyDict_Type, &taps_dict)) {
     return NULL;  /* PyArg_ParseTupleAndKeywords failed. */
   }
+  if (self->busy) {
+    PyErr_SetString(PyExc_RuntimeError,
+                    "Enveloper is in use by another thread");
+    return NULL;
+  }
+  if (debug_out) {
+    if (taps_dict) {
+      PyErr_SetString(PyExc_ValueError,
+                      "debug_out and taps may not both be passed");
+      return NULL;
+    }
+    /* `debug_out` is a shorthand for requesting these taps. */
+    PyDict_Clear(debug_out);
+    if (PyDict_SetItemString(debug_out, "smoothed_energy", Py_None) != 0 ||
+        PyDict_SetItemString(debug_out, "noise", Py_None) != 0) {
+      PyDict_Clear(debug_out);
+      return NULL;
+    }
+    taps_dict = debug_out;
+  }
 
   /* Convert input samples to numpy array with contiguous float32 data. */
   PyArrayObject* samples = (PyArrayObject*)PyArray_FromAny(
@@ -199,64 +377,66 @@ static PyObject* EnveloperObjectProcessSamples(
   const float* samples_data = (const float*)PyArray_DATA(samples);
   const int output_frames = num_samples / self->decimation_factor;
 
-  npy_intp output_dims[2];
-  output_dims[0] = output_frames;
-  output_dims[1] = kEnveloperNumChannels;
-  PyArrayObject* output_array =
-      (PyArrayObject*)PyArray_SimpleNew(2, output_dims, NPY_FLOAT);
-  if (!output_array) {
-    Py_DECREF(samples);
-    return NULL;
-  }
-  float* output = (float*)PyArray_DATA(output_array);
-
-  if (!debug_out) {
-    /* Process the samples. */
-    EnveloperProcessSamples(
-        &self->enveloper, samples_data, num_samples, output);
+  PyObject* output_array;
+  Py_buffer out_view;
+  float* output;
+  if (out_arg != Py_None) {
+    /* Write to the caller-provided buffer. */
+    if (!GetFloatOutBuffer(
+          out_arg, (Py_ssize_t)output_frames * kEnveloperNumChannels,
+          &out_view)) {
+      Py_DECREF(samples);
+      return NULL;
+    }
+    Py_INCREF(out_arg);
+    output_array = out_arg;
+    output = (float*)out_view.buf;
   } else {
-    /* If a `debug_out` dict was passed, clear it and put arrays in it for
-     * holding energy envelope debug signals.
-     */
-    PyDict_Clear(debug_out);
-    float* smoothed_energy = NULL;
-    float* noise = NULL;
-    if (!(smoothed_energy = CreateArrayInDict(
-          debug_out, "smoothed_energy", output_frames)) ||
-        !(noise = CreateArrayInDict(
-          debug_out, "noise", output_frames))) {
+    npy_intp output_dims[2];
+    output_dims[0] = output_frames;
+    output_dims[1] = kEnveloperNumChannels;
+    output_array = PyArray_SimpleNew(2, output_dims, NPY_FLOAT);
+    if (!output_array) {
       Py_DECREF(samples);
-      Py_DECREF(output_array);
-      PyDict_Clear(debug_out);
       return NULL;
     }
+    output = (float*)PyArray_DATA((PyArrayObject*)output_array);
+  }
 
-    int i;
-    for (i = 0; i < output_frames; ++i) {
-      /* Process the samples. In order to save debug signals, we pass
-       * decimation_factor input samples so that one output sample is produced
-       * at a time.
-       */
-      EnveloperProcessSamples(
-          &self->enveloper, samples_data, self->decimation_factor,
-          output);
-
-      int c;
-      for (c = 0; c < kEnveloperNumChannels; ++c) {
-        smoothed_energy[c] = self->enveloper.channels[c].smoothed_energy;
-        noise[c] = self->enveloper.channels[c].noise;
-      }
-
-      samples_data += self->decimation_factor;
-      output += kEnveloperNumChannels;
-      smoothed_energy += kEnveloperNumChannels;
-      noise += kEnveloperNumChannels;
-    }
+  /* Set up the requested taps, if any. The input is processed in whole
+   * frames, so 'bandpassed' has output_frames * decimation_factor frames.
+   */
+  EnveloperTaps taps;
+  TapViews tap_views;
+  memset(tap_views.has_view, 0, sizeof(tap_views.has_view));
+  if (taps_dict && !SetUpTaps(taps_dict,
+                              output_frames * self->decimation_factor,
+                              output_frames, &taps, &tap_views)) {
+    ReleaseTapViews(&tap_views);
+    if (debug_out) { PyDict_Clear(debug_out); }
+    if (out_arg != Py_None) { PyBuffer_Release(&out_view); }
+    Py_DECREF(samples);
+    Py_DECREF(output_array);
+    return NULL;
   }
 
+  /* Process the samples, releasing the GIL so that other threads can run. */
+  self->busy = 1;
+  Py_BEGIN_ALLOW_THREADS
+  if (taps_dict) {
+    EnveloperProcessSamplesWithTaps(
+        &self->enveloper, samples_data, num_samples, &taps, output);
+  } else {
+    EnveloperProcessSamples(
+        &self->enveloper, samples_data, num_samples, output);
+  }
+  Py_END_ALLOW_THREADS
+  self->busy = 0;
 
+  ReleaseTapViews(&tap_views);
+  if (out_arg != Py_None) { PyBuffer_Release(&out_view); }
   Py_DECREF(samples);
-  return (PyObject*)output_array;
+  return output_array;
 }
 
 /* Enveloper's method functions. */
@@ -319,6 +499,303 @@ static PyTypeObject kEnveloperType = {
     (initproc)EnveloperObjectInit, /* tp_init */
 };
 
+typedef struct {
+  PyObject_HEAD
+  TactileProcessorBatch* batch;
+  int num_streams;
+  int block_size;
+  float input_sample_rate_hz;
+  float output_sample_rate_hz;
+  int decimation_factor;
+  /* Arrays of `num_streams` pointers to the current input and output blocks. */
+  const float** input_blocks;
+  float** output_blocks;
+  /* Nonzero while process_samples is running with the GIL released. */
+  int busy;
+} EnveloperBatchObject;
+
+/* Define `EnveloperBatch.__init__`. */
+static int EnveloperBatchObjectInit(EnveloperBatchObject* self,
+                                    PyObject* args, PyObject* kw) {
+  TactileProcessorParams params;
+  TactileProcessorSetDefaultParams(&params);
+  params.enveloper_params = kDefaultEnveloperParams;
+  params.decimation_factor = 1;
+  EnveloperParams* enveloper_params = &params.enveloper_params;
+  int num_streams = 0;
+  float input_sample_rate_hz = 16000.0f;
+  int block_size = 64;
+  static const char* keywords[] = {"num_streams",
+                                   "input_sample_rate_hz",
+                                   "decimation_factor",
+                                   "block_size",
+                                   "bpf_low_edge_hz",
+                                   "bpf_high_edge_hz",
+                                   "energy_cutoff_hz",
+                                   "noise_db_s",
+                                   "agc_strength",
+                                   "compressor_exponent",
+                                   "output_gain",
+                                   NULL};
+
+  if (!PyArg_ParseTupleAndKeywords(
+          args, kw,
+          "if|ii(ffff)(ffff)ffff(ffff):__init__", (char**)keywords,
+          &num_streams,
+          &input_sample_rate_hz,
+          &params.decimation_factor,
+          &block_size,
+          &enveloper_params->channel_params[0].bpf_low_edge_hz,
+          &enveloper_params->channel_params[1].bpf_low_edge_hz,
+          &enveloper_params->channel_params[2].bpf_low_edge_hz,
+          &enveloper_params->channel_params[3].bpf_low_edge_hz,
+          &enveloper_params->channel_params[0].bpf_high_edge_hz,
+          &enveloper_params->channel_params[1].bpf_high_edge_hz,
+          &enveloper_params->channel_params[2].bpf_high_edge_hz,
+          &enveloper_params->channel_params[3].bpf_high_edge_hz,
+          &enveloper_params->energy_cutoff_hz,
+          &enveloper_params->noise_db_s,
+          &enveloper_params->agc_strength,
+          &enveloper_params->compressor_exponent,
+          &enveloper_params->channel_params[0].output_gain,
+          &enveloper_params->channel_params[1].output_gain,
+          &enveloper_params->channel_params[2].output_gain,
+          &enveloper_params->channel_params[3].output_gain)) {
+    return -1;  /* PyArg_ParseTupleAndKeywords failed. */
+  }
+  params.frontend_params.input_sample_rate_hz = input_sample_rate_hz;
+  params.frontend_params.block_size = block_size;
+
+  TactileProcessorBatchFree(self->batch);
+  free(self->input_blocks);
+  free(self->output_blocks);
+  self->input_blocks = NULL;
+  self->output_blocks = NULL;
+  self->batch = TactileProcessorBatchMake(&params, num_streams);
+  if (self->batch == NULL) {
+    PyErr_SetString(PyExc_ValueError, "Error making EnveloperBatch");
+    return -1;
+  }
+  self->num_streams = num_streams;
+  self->block_size = block_size;
+  self->input_sample_rate_hz = input_sample_rate_hz;
+  self->decimation_factor = params.decimation_factor;
+  self->output_sample_rate_hz =
+      input_sample_rate_hz / params.decimation_factor;
+  self->input_blocks = (const float**)malloc(num_streams * sizeof(float*));
+  self->output_blocks = (float**)malloc(num_streams * sizeof(float*));
+  if (self->input_blocks == NULL || self->output_blocks == NULL) {
+    PyErr_NoMemory();
+    return -1;
+  }
+  return 0;
+}
+
+static void EnveloperBatchDealloc(EnveloperBatchObject* self) {
+  free(self->output_blocks);
+  free(self->input_blocks);
+  TactileProcessorBatchFree(self->batch);
+  Py_TYPE(self)->tp_free((PyObject*)self);
+}
+
+/* Define `EnveloperBatch.reset()`. */
+static PyObject* EnveloperBatchObjectReset(EnveloperBatchObject* self) {
+  if (self->busy) {
+    PyErr_SetString(PyExc_RuntimeError,
+                    "EnveloperBatch is in use by another thread");
+    return NULL;
+  }
+  TactileProcessorBatchReset(self->batch);
+  Py_INCREF(Py_None);
+  return Py_None;
+}
+
+/* Define `EnveloperBatch.reset_stream(stream)`. */
+static PyObject* EnveloperBatchObjectResetStream(
+    EnveloperBatchObject* self, PyObject* args) {
+  int stream;
+  if (!PyArg_ParseTuple(args, "i:reset_stream", &stream)) { return NULL; }
+  if (!(0 <= stream && stream < self->num_streams)) {
+    PyErr_SetString(PyExc_IndexError, "stream out of range");
+    return NULL;
+  } else if (self->busy) {
+    PyErr_SetString(PyExc_RuntimeError,
+                    "EnveloperBatch is in use by another thread");
+    return NULL;
+  }
+  TactileProcessorBatchResetStream(self->batch, stream);
+  Py_INCREF(Py_None);
+  return Py_None;
+}
+
+/* Define `EnveloperBatch.process_samples`. */
+static PyObject* EnveloperBatchObjectProcessSamples(
+    EnveloperBatchObject* self, PyObject* args, PyObject* kw) {
+  PyObject* samples_arg = NULL;
+  PyObject* out_arg = Py_None;
+  static const char* keywords[] = {"samples", "out", NULL};
+
+  if (!PyArg_ParseTupleAndKeywords(args, kw, "O|O:process_samples",
+                                   (char**)keywords, &samples_arg, &out_arg)) {
+    return NULL;  /* PyArg_ParseTupleAndKeywords failed. */
+  }
+  if (self->busy) {
+    PyErr_SetString(PyExc_RuntimeError,
+                    "EnveloperBatch is in use by another thread");
+    return NULL;
+  }
+
+  /* Convert input samples to numpy array with contiguous float32 data. */
+  PyArrayObject* samples = (PyArrayObject*)PyArray_FromAny(
+      samples_arg, PyArray_DescrFromType(NPY_FLOAT), 0, 0,
+      NPY_ARRAY_ALIGNED | NPY_ARRAY_NOTSWAPPED | NPY_ARRAY_FORCECAST |
+          NPY_ARRAY_DEFAULT,
+      NULL);
+
+  if (!samples) {  /* PyArray_DescrFromType failed. */
+    /* PyArray_DescrFromType already set an error, so just need to return. */
+    return NULL;
+  } else if (PyArray_NDIM(samples) != 2 ||
+             PyArray_DIM(samples, 0) != self->num_streams) {
+    PyErr_SetString(PyExc_ValueError,
+                    "expected 2-D array of shape (num_streams, num_samples)");
+    Py_DECREF(samples);
+    return NULL;
+  }
+
+  const int num_streams = self->num_streams;
+  const int block_size = self->block_size;
+  const int num_samples = PyArray_DIM(samples, 1);
+  if (num_samples % block_size != 0) {
+    PyErr_SetString(PyExc_ValueError,
+                    "num_samples must be a multiple of block_size");
+    Py_DECREF(samples);
+    return NULL;
+  }
+
+  const int num_blocks = num_samples / block_size;
+  const int frames_per_block = block_size / self->decimation_factor;
+  const int output_frames = num_blocks * frames_per_block;
+  PyObject* output_array;
+  Py_buffer out_view;
+  float* output;
+  if (out_arg != Py_None) {
+    /* Write to the caller-provided buffer. */
+    if (!GetFloatOutBuffer(
+          out_arg,
+          (Py_ssize_t)num_streams * output_frames * kEnveloperNumChannels,
+          &out_view)) {
+      Py_DECREF(samples);
+      return NULL;
+    }
+    Py_INCREF(out_arg);
+    output_array = out_arg;
+    output = (float*)out_view.buf;
+  } else {
+    npy_intp output_dims[3];
+    output_dims[0] = num_streams;
+    output_dims[1] = output_frames;
+    output_dims[2] = kEnveloperNumChannels;
+    output_array = PyArray_SimpleNew(3, output_dims, NPY_FLOAT);
+    if (!output_array) {
+      Py_DECREF(samples);
+      return NULL;
+    }
+    output = (float*)PyArray_DATA((PyArrayObject*)output_array);
+  }
+
+  const float* samples_data = (const float*)PyArray_DATA(samples);
+  const float** input_blocks = self->input_blocks;
+  float** output_blocks = self->output_blocks;
+
+  /* Process the samples, releasing the GIL so that other threads can run. */
+  self->busy = 1;
+  Py_BEGIN_ALLOW_THREADS
+  int i;
+  for (i = 0; i < num_blocks; ++i) {
+    int s;
+    for (s = 0; s < num_streams; ++s) {
+      input_blocks[s] = samples_data + s * num_samples + i * block_size;
+      output_blocks[s] = output + (s * output_frames + i * frames_per_block) *
+                                      kEnveloperNumChannels;
+    }
+    TactileProcessorBatchProcessEnveloper(
+        self->batch, input_blocks, output_blocks);
+  }
+  Py_END_ALLOW_THREADS
+  self->busy = 0;
+
+  if (out_arg != Py_None) { PyBuffer_Release(&out_view); }
+  Py_DECREF(samples);
+  return output_array;
+}
+
+/* EnveloperBatch's method functions. */
+static PyMethodDef kEnveloperBatchMethods[] = {
+    {"reset", (PyCFunction)EnveloperBatchObjectReset,
+     METH_NOARGS, "Resets all streams to initial state."},
+    {"reset_stream", (PyCFunction)EnveloperBatchObjectResetStream,
+     METH_VARARGS, "Resets one stream to initial state."},
+    {"process_samples", (PyCFunction)EnveloperBatchObjectProcessSamples,
+     METH_VARARGS | METH_KEYWORDS, "Processes samples in a streaming manner."},
+    {NULL, NULL, 0, NULL} /* Sentinel */
+};
+
+/* Define `num_streams`, etc. as read-only members. */
+static PyMemberDef kEnveloperBatchMembers[] = {
+  {"num_streams", T_INT,
+   offsetof(EnveloperBatchObject, num_streams), READONLY, ""},
+  {"block_size", T_INT,
+   offsetof(EnveloperBatchObject, block_size), READONLY, ""},
+  {"input_sample_rate_hz", T_FLOAT,
+   offsetof(EnveloperBatchObject, input_sample_rate_hz), READONLY, ""},
+  {"output_sample_rate_hz", T_FLOAT,
+   offsetof(EnveloperBatchObject, output_sample_rate_hz), READONLY, ""},
+  {"decimation_factor", T_INT,
+   offsetof(EnveloperBatchObject, decimation_factor), READONLY, ""},
+  {NULL}  /* Sentinel. */
+};
+
+/* Define the EnveloperBatch Python type. */
+static PyTypeObject kEnveloperBatchType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    "EnveloperBatch",                   /* tp_name */
+    sizeof(EnveloperBatchObject),       /* tp_basicsize */
+    0,                                  /* tp_itemsize */
+    (destructor)EnveloperBatchDealloc,  /* tp_dealloc */
+    0,                                  /* tp_print */
+    0,                                  /* tp_getattr */
+    0,                                  /* tp_setattr */
+    0,                                  /* tp_compare */
+    0,                                  /* tp_repr */
+    0,                                  /* tp_as_number */
+    0,                                  /* tp_as_sequence */
+    0,                                  /* tp_as_mapping */
+    0,                                  /* tp_hash */
+    0,                                  /* tp_call */
+    0,                                  /* tp_str */
+    0,                                  /* tp_getattro */
+    0,                                  /* tp_setattro */
+    0,                                  /* tp_as_buffer */
+    Py_TPFLAGS_DEFAULT,                 /* tp_flags */
+    "EnveloperBatch object",            /* tp_doc */
+    0,                                  /* tp_traverse */
+    0,                                  /* tp_clear */
+    0,                                  /* tp_richcompare */
+    0,                                  /* tp_weaklistoffset */
+    0,                                  /* tp_iter */
+    0,                                  /* tp_iternext */
+    kEnveloperBatchMethods,             /* tp_methods */
+    kEnveloperBatchMembers,             /* tp_members */
+    0,                                  /* tp_getset */
+    0,                                  /* tp_base */
+    0,                                  /* tp_dict */
+    0,                                  /* tp_descr_get */
+    0,                                  /* tp_descr_set */
+    0,                                  /* tp_dictoffset */
+    (initproc)EnveloperBatchObjectInit, /* tp_init */
+};
+
 /* Module methods. */
 static PyMethodDef kModuleMethods[] = {
     {NULL, NULL, 0, NULL} /* Sentinel */
@@ -346,5 +823,10 @@ PyMODINIT_FUNC PyInit_enveloper(void) {
     Py_INCREF(&kEnveloperType);
     PyModule_AddObject(m, "Enveloper", (PyObject*)&kEnveloperType);
   }
+  kEnveloperBatchType.tp_new = PyType_GenericNew;
+  if (PyType_Ready(&kEnveloperBatchType) >= 0) {
+    Py_INCREF(&kEnveloperBatchType);
+    PyModule_AddObject(m, "EnveloperBatch", (PyObject*)&kEnveloperBatchType);
+  }
   return m;
 }
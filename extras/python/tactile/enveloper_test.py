@@ -75,6 +75,80 @@ class EnveloperTest(unittest.TestCase):
         for _, v in debug_out.items():
           self.assertTupleEqual(v.shape, output.shape)
 
+        # Output may be written to a caller-provided array.
+        env.reset()
+        out = np.empty_like(output)
+        self.assertIs(env.process_samples(input_samples, out=out), out)
+        np.testing.assert_array_equal(out, output)
+
+  def test_taps(self):
+    decimation_factor = 4
+    num_samples = 4000
+    input_samples = 0.2 * (np.random.rand(num_samples) - 0.5)
+    env = enveloper.Enveloper(16000.0, decimation_factor)
+    output = env.process_samples(input_samples)
+    output_shape = (num_samples // decimation_factor, enveloper.NUM_CHANNELS)
+
+    # Requested taps are recorded without changing the output.
+    env.reset()
+    gain_out = np.empty(output_shape, np.float32)
+    taps = {'bandpassed': None, 'smoothed_energy': None, 'gain': gain_out}
+    np.testing.assert_array_equal(
+        output, env.process_samples(input_samples, taps=taps))
+    self.assertCountEqual(taps.keys(),
+                          ('bandpassed', 'smoothed_energy', 'gain'))
+    self.assertTupleEqual(taps['bandpassed'].shape,
+                          (num_samples, enveloper.NUM_CHANNELS))
+    self.assertTupleEqual(taps['smoothed_energy'].shape, output_shape)
+    self.assertIs(taps['gain'], gain_out)
+    self.assertTrue(np.all(gain_out >= 0.0))
+
+    # debug_out is the same as requesting smoothed_energy and noise taps.
+    env.reset()
+    debug_out = {}
+    env.process_samples(input_samples, debug_out=debug_out)
+    np.testing.assert_array_equal(debug_out['smoothed_energy'],
+                                  taps['smoothed_energy'])
+    self.assertCountEqual(debug_out.keys(), ('smoothed_energy', 'noise'))
+
+    with self.assertRaises(ValueError):
+      env.process_samples(input_samples, taps={'nonexistent': None})
+    with self.assertRaises(ValueError):
+      env.process_samples(input_samples, taps={'noise': np.empty(3)})
+
+  def test_batch_matches_enveloper(self):
+    num_streams = 5
+    block_size = 64
+    for decimation_factor in (1, 4):
+      batch = enveloper.EnveloperBatch(
+          num_streams, 16000.0, decimation_factor, block_size)
+      self.assertEqual(batch.num_streams, num_streams)
+      self.assertEqual(batch.block_size, block_size)
+      self.assertAlmostEqual(batch.output_sample_rate_hz,
+                             16000.0 / decimation_factor, 0.01)
+
+      num_samples = 40 * block_size
+      input_samples = 0.2 * (
+          np.random.rand(num_streams, num_samples).astype(np.float32) - 0.5)
+      output = batch.process_samples(input_samples)
+      self.assertEqual(output.shape,
+                       (num_streams, num_samples // decimation_factor,
+                        enveloper.NUM_CHANNELS))
+
+      for s in range(num_streams):
+        env = enveloper.Enveloper(16000.0, decimation_factor)
+        np.testing.assert_allclose(
+            output[s], env.process_samples(input_samples[s]), atol=1e-6)
+
+      # Output may be written to a caller-provided array.
+      batch.reset()
+      out = np.empty_like(output)
+      self.assertIs(batch.process_samples(input_samples, out=out), out)
+      np.testing.assert_allclose(out, output, atol=1e-6)
+
+      with self.assertRaises(ValueError):
+        batch.process_samples(input_samples[:, :block_size + 1])
+
 
 if __name__ == '__main__':
   unittest.main()
@@ -321,6 +321,36 @@ def plot_tactile_output(
   return fig
 
 
+def plot_profile(
+    data: np.ndarray, sample_rate_hz: float) -> matplotlib.figure.Figure:
+  """Plots captured profile data.
+
+  The data has shape (num_buffers, num_stages, 3), where the last axis is the
+  min, mean, and max elapsed ticks of each stage (see src/tactile/profiler.h).
+  On device, ticks are CPU cycles.
+  """
+  stage_names = ('TactileProcessor', 'PostProcessor', 'ChannelMap + PWM')
+  num_stages = data.shape[1]
+  t = np.arange(data.shape[0]) / sample_rate_hz
+
+  fig = matplotlib.figure.Figure(figsize=(9, 3 * num_stages))
+  for s in range(num_stages):
+    ax = fig.add_subplot(num_stages, 1, s + 1)
+    ax.fill_between(t, data[:, s, 0], data[:, s, 2], alpha=0.3,
+                    label='min to max')
+    ax.plot(t, data[:, s, 1], '-', label='mean')
+    ax.set_xlim(t[0], t[-1])
+    ax.set_ylim(bottom=0)
+    if s == 0:
+      ax.set_title('profile')
+      ax.legend()
+    ax.set_ylabel((stage_names[s] if s < len(stage_names) else f'Stage {s}')
+                  + '\n(ticks)')
+
+  ax.set_xlabel('Time (s)')
+  return fig
+
+
 def plot_capture(name: str,
                  descriptor: tap_out.Descriptor,
                  data: np.ndarray) -> Optional[matplotlib.figure.Figure]:
@@ -341,6 +371,8 @@ def plot_capture(name: str,
     return plot_vowel_coord(data, sample_rate_hz)
   elif name == 'smoothed_energy' or name == 'noise_energy':
     return plot_enveloper_energies(name, data, sample_rate_hz)
+  elif name == 'profile':
+    return plot_profile(data, sample_rate_hz)
   elif len(data.shape) == 1:
     fig = matplotlib.figure.Figure(figsize=(9, 6))
     t = np.arange(num_samples) / sample_rate_hz
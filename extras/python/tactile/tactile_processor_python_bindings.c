@@ -46,17 +46,26 @@
  *  def reset():
  *    """Resets to initial state."""
  *
- *  def process_samples(self, input_samples)
+ *  def process_samples(self, input_samples, out=None)
  *    """Process samples in a streaming manner.
  *
  *    Calls the C function `TactileProcessorProcessSamples()` on each input
- *    audio block.
+ *    audio block. The GIL is released while processing, so that different
+ *    TactileProcessor objects may run in parallel threads. A TactileProcessor
+ *    object should be used by only one thread at a time, otherwise
+ *    RuntimeError is raised.
  *
  *    Args:
  *      input_samples: 1-D numpy array. Size must be a multiple of block_size.
+ *        If it is C-contiguous float32, or any object supporting the buffer
+ *        protocol with such data, it is used without copying.
+ *      out: (Optional) Writable C-contiguous float32 buffer with
+ *        `len(input_samples) / decimation_factor * NUM_TACTORS` elements. If
+ *        passed, output is written to it and it is returned instead of
+ *        allocating a new array.
  *    Returns:
  *      2-D array of shape
- *        (len(input_samples) * decimation_factor / block_size, NUM_TACTORS).
+ *        (len(input_samples) / decimation_factor, NUM_TACTORS), or `out`.
  *    """
  *
  *  @property
@@ -92,6 +101,7 @@
 /* Disallow Numpy 1.7 deprecated symbols. */
 #define NPY_NO_DEPRECATED_API NPY_1_7_API_VERSION
 #include "src/tactile/tactile_processor.h"
+#include "extras/python/python_buffer.h"
 #include "numpy/arrayobject.h"
 #include "structmember.h"
 
@@ -102,6 +112,8 @@ typedef struct {
   float output_sample_rate_hz;
   int block_size;
   int decimation_factor;
+  /* Nonzero while process_samples is running with the GIL released. */
+  int busy;
 } TactileProcessorObject;
 
 /* Define `TactileProcessor.__init__`. */
@@ -144,6 +156,11 @@ static void TactileProcessorDealloc(TactileProcessorObject* self) {
 
 /* Define `TactileProcessor.reset`. */
 static PyObject* TactileProcessorObjectReset(TactileProcessorObject* self) {
+  if (self->busy) {
+    PyErr_SetString(PyExc_RuntimeError,
+                    "TactileProcessor is in use by another thread");
+    return NULL;
+  }
   TactileProcessorReset(self->tactile_processor);
   Py_INCREF(Py_None);
   return Py_None;
@@ -153,12 +170,18 @@ static PyObject* TactileProcessorObjectReset(TactileProcessorObject* self) {
 static PyObject* TactileProcessorObjectProcessSamples(
     TactileProcessorObject* self, PyObject* args, PyObject* kw) {
   PyObject* samples_arg = NULL;
-  static const char* keywords[] = {"samples", NULL};
+  PyObject* out_arg = Py_None;
+  static const char* keywords[] = {"samples", "out", NULL};
 
-  if (!PyArg_ParseTupleAndKeywords(args, kw, "O:process_samples",
-                                   (char**)keywords, &samples_arg)) {
+  if (!PyArg_ParseTupleAndKeywords(args, kw, "O|O:process_samples",
+                                   (char**)keywords, &samples_arg, &out_arg)) {
     return NULL;  /* PyArg_ParseTupleAndKeywords failed. */
   }
+  if (self->busy) {
+    PyErr_SetString(PyExc_RuntimeError,
+                    "TactileProcessor is in use by another thread");
+    return NULL;
+  }
 
   /* Convert input samples to numpy array with contiguous float32 data. */
   PyArrayObject* samples = (PyArrayObject*)PyArray_FromAny(
@@ -186,29 +209,47 @@ static PyObject* TactileProcessorObjectProcessSamples(
   const int tactile_samples_per_block =
       kTactileProcessorNumTactors * (block_size / decimation_factor);
 
-  /* Create output numpy array. */
-  npy_intp output_dims[2];
-  output_dims[0] = size / decimation_factor;
-  output_dims[1] = kTactileProcessorNumTactors;
-  PyArrayObject* output =
-      (PyArrayObject*)PyArray_SimpleNew(2, output_dims, NPY_FLOAT);
-  if (!output) {  /* PyArray_SimpleNew failed. */
-    /* PyArray_SimpleNew already set an error, so clean up and return. */
-    goto fail;
+  PyObject* output;
+  Py_buffer out_view;
+  float* output_data;
+  if (out_arg != Py_None) {
+    /* Write to the caller-provided buffer. */
+    if (!GetFloatOutBuffer(out_arg, (Py_ssize_t)(size / decimation_factor) *
+                           kTactileProcessorNumTactors, &out_view)) {
+      goto fail;
+    }
+    Py_INCREF(out_arg);
+    output = out_arg;
+    output_data = (float*)out_view.buf;
+  } else {
+    /* Create output numpy array. */
+    npy_intp output_dims[2];
+    output_dims[0] = size / decimation_factor;
+    output_dims[1] = kTactileProcessorNumTactors;
+    output = PyArray_SimpleNew(2, output_dims, NPY_FLOAT);
+    if (!output) {  /* PyArray_SimpleNew failed. */
+      /* PyArray_SimpleNew already set an error, so clean up and return. */
+      goto fail;
+    }
+    output_data = (float*)PyArray_DATA((PyArrayObject*)output);
   }
 
-  /* Process the samples. */
-  float* samples_data = (float*)PyArray_DATA(samples);
-  float* output_data = (float*)PyArray_DATA(output);
+  /* Process the samples, releasing the GIL so that other threads can run. */
+  const float* samples_data = (const float*)PyArray_DATA(samples);
+  self->busy = 1;
+  Py_BEGIN_ALLOW_THREADS
   int start;
   for (start = 0; start < size; start += block_size) {
     TactileProcessorProcessSamples(self->tactile_processor,
         samples_data + start, output_data);
     output_data += tactile_samples_per_block;
   }
+  Py_END_ALLOW_THREADS
+  self->busy = 0;
 
+  if (out_arg != Py_None) { PyBuffer_Release(&out_view); }
   Py_DECREF(samples);
-  return (PyObject*)output;
+  return output;
 
 fail:
   Py_XDECREF(samples);
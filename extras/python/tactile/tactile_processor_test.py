@@ -14,6 +14,7 @@
 
 """Tests for TactileProcessor Python bindings."""
 
+import concurrent.futures
 import unittest
 
 import numpy as np
@@ -90,6 +91,34 @@ class TactileProcessorTest(unittest.TestCase):
     np.testing.assert_allclose(
         streaming_outputs, nonstreaming_outputs, atol=1e-9)
 
+  def test_out_and_threads(self):
+    np.random.seed(0)
+    block_size = 16
+    input_samples = np.random.uniform(
+        -0.1, 0.1, 40 * block_size).astype(np.float32)
+    expected = tactile_processor.TactileProcessor(
+        block_size=block_size).process_samples(input_samples)
+
+    # Output is written to a caller-provided array.
+    processor = tactile_processor.TactileProcessor(block_size=block_size)
+    out = np.zeros_like(expected)
+    self.assertIs(processor.process_samples(input_samples, out=out), out)
+    np.testing.assert_array_equal(out, expected)
+
+    with self.assertRaisesRegex(ValueError, 'float32'):
+      processor.process_samples(input_samples, out=np.zeros(expected.shape))
+    with self.assertRaisesRegex(ValueError, 'elements'):
+      processor.process_samples(input_samples, out=out[:-1])
+
+    # Separate processors run in parallel threads with the same results.
+    def run(_):
+      return tactile_processor.TactileProcessor(
+          block_size=block_size).process_samples(input_samples)
+
+    with concurrent.futures.ThreadPoolExecutor(max_workers=4) as executor:
+      for output in executor.map(run, range(8)):
+        np.testing.assert_array_equal(output, expected)
+
   def test_bad_input(self):
     processor = tactile_processor.TactileProcessor()
 
@@ -19,9 +19,40 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
 
 #include "extras/tools/portaudio_device.h"
+#include "extras/tools/trace_event.h"
 #include "extras/tools/util.h"
+#include "src/dsp/decibels.h"
+
+/* Max number of pending TactileWorkerPlay calls. */
+#define kPlaybackRingCapacity 256
+/* Max number of pending commands. */
+#define kCommandRingCapacity 64
+/* Max number of trace events per thread, enough for several minutes. */
+#define kTraceMaxEventsPerThread (1 << 20)
+
+typedef enum {
+  kTactileWorkerCommandReset,
+  kTactileWorkerCommandSetMicInput,
+  kTactileWorkerCommandSetPlaybackInput,
+  kTactileWorkerCommandResetTimingStats,
+} TactileWorkerCommand;
+
+/* Samples from one TactileWorkerPlay call. The samples are allocated together
+ * with the struct, following it in memory.
+ */
+struct TactileWorkerPlaybackBuffer {
+  /* Number of samples. */
+  int size;
+  /* Read position, accessed only by the audio thread. */
+  int position;
+  /* Trace flow id of the TactileWorkerPlay call. */
+  int id;
+  float* samples;
+};
+typedef struct TactileWorkerPlaybackBuffer PlaybackBuffer;
 
 void TactileWorkerSetDefaultParams(TactileWorkerParams* params) {
   params->input_device = NULL;
@@ -30,6 +61,7 @@ void TactileWorkerSetDefaultParams(TactileWorkerParams* params) {
   TactileProcessorSetDefaultParams(&params->tactile_processor_params);
   PostProcessorSetDefaultParams(&params->post_processor_params);
   ChannelMapParse(kTactileProcessorNumTactors, "0", NULL, &params->channel_map);
+  params->trace_path = NULL;
 }
 
 /* Sets TactileWorker variables to empty initial state. */
@@ -38,25 +70,168 @@ static void TactileWorkerInit(TactileWorker* worker) {
   worker->tactile_output = NULL;
 
   worker->mic_is_input = 0;
-  worker->should_reset_tactile_processor = 0;
-  worker->active_buffer_index = 0;
-  worker->buffers[0] = NULL;
-  worker->buffers[1] = NULL;
-
-  worker->queue_samples = NULL;
-  worker->queue_capacity = 0;
-  worker->queue_size = 0;
-  worker->queue_position = 0;
+  worker->last_callback_time_s = -1.0;
+  worker->playback_buffer = NULL;
+  worker->playback_chunk = NULL;
 
-  worker->queue_thread_initialized = 0;
-  worker->queue_thread_keep_running = 1;
+  worker->command_ring = NULL;
+  worker->playback_ring = NULL;
+  worker->free_ring = NULL;
+  atomic_init(&worker->num_playback_samples, 0);
 
   worker->pa_initialized = 0;
   worker->pa_stream = NULL;
 
+  worker->trace_path = NULL;
+  worker->num_plays = 0;
+
   int c;
   for (c = 0; c < kNumTactors; ++c) {
-    worker->volume_meters[c] = 0.0f;
+    atomic_init(&worker->volume_meters[c], 0.0f);
+  }
+
+  atomic_init(&worker->timing.num_callbacks, 0);
+  atomic_init(&worker->timing.num_output_underflows, 0);
+  atomic_init(&worker->timing.num_input_overflows, 0);
+  atomic_init(&worker->timing.max_duration_s, 0.0f);
+  int i;
+  for (i = 0; i < kTactileWorkerNumTimingBuckets; ++i) {
+    atomic_init(&worker->timing.duration_histogram[i], 0);
+    atomic_init(&worker->timing.interval_histogram[i], 0);
+  }
+}
+
+/* Gets monotonic time in seconds. */
+static double GetTimeSeconds(void) {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return now.tv_sec + 1e-9 * now.tv_nsec;
+}
+
+/* Audio thread: increments an atomic counter. Only the audio thread writes the
+ * timing counters, so a relaxed load and store suffices and is cheaper than an
+ * atomic read-modify-write.
+ */
+static void IncrementCounter(atomic_int* counter) {
+  atomic_store_explicit(
+      counter, atomic_load_explicit(counter, memory_order_relaxed) + 1,
+      memory_order_relaxed);
+}
+
+/* Audio thread: adds `time_s` to `histogram`. */
+static void AddToTimingHistogram(const TactileWorker* worker, double time_s,
+                                 atomic_int* histogram) {
+  int bucket = (int)(time_s * worker->sample_rate_hz *
+                     kTactileWorkerTimingBucketsPerPeriod / worker->chunk_size);
+  if (bucket < 0) { bucket = 0; }
+  if (bucket >= kTactileWorkerNumTimingBuckets) {
+    bucket = kTactileWorkerNumTimingBuckets - 1;
+  }
+  IncrementCounter(&histogram[bucket]);
+}
+
+/* Audio thread: resets timing statistics. */
+static void ResetTimingStats(TactileWorker* worker) {
+  atomic_store_explicit(&worker->timing.num_callbacks, 0, memory_order_relaxed);
+  atomic_store_explicit(&worker->timing.num_output_underflows, 0,
+                        memory_order_relaxed);
+  atomic_store_explicit(&worker->timing.num_input_overflows, 0,
+                        memory_order_relaxed);
+  atomic_store_explicit(&worker->timing.max_duration_s, 0.0f,
+                        memory_order_relaxed);
+  int i;
+  for (i = 0; i < kTactileWorkerNumTimingBuckets; ++i) {
+    atomic_store_explicit(&worker->timing.duration_histogram[i], 0,
+                          memory_order_relaxed);
+    atomic_store_explicit(&worker->timing.interval_histogram[i], 0,
+                          memory_order_relaxed);
+  }
+  worker->last_callback_time_s = -1.0;
+}
+
+/* Sends `command` to the audio thread. */
+static void SendCommand(TactileWorker* worker, TactileWorkerCommand command) {
+  const int value = command;
+  if (!SpscRingWrite(worker->command_ring, &value, 1)) {
+    fprintf(stderr, "Error: TactileWorker command queue is full.\n");
+  }
+}
+
+/* Audio thread: applies commands from the main thread. */
+static void ProcessCommands(TactileWorker* worker) {
+  int command;
+  while (SpscRingRead(worker->command_ring, &command, 1)) {
+    TraceEventInstant("command");
+    switch (command) {
+      case kTactileWorkerCommandReset:
+        TactileProcessorReset(worker->tactile_processor);
+        PostProcessorReset(&worker->post_processor);
+        break;
+      case kTactileWorkerCommandSetMicInput:
+        worker->mic_is_input = 1;
+        break;
+      case kTactileWorkerCommandSetPlaybackInput:
+        worker->mic_is_input = 0;
+        break;
+      case kTactileWorkerCommandResetTimingStats:
+        ResetTimingStats(worker);
+        break;
+    }
+  }
+}
+
+/* Audio thread: fills `playback_chunk` from queued playback buffers,
+ * zero-filling if the queue runs out.
+ */
+static float* ReadPlaybackChunk(TactileWorker* worker) {
+  const int chunk_size = worker->chunk_size;
+  float* dest = worker->playback_chunk;
+  int num_filled = 0;
+
+  while (num_filled < chunk_size) {
+    PlaybackBuffer* buffer = worker->playback_buffer;
+    if (buffer == NULL) {
+      if (!SpscRingRead(worker->playback_ring, &buffer, 1)) {
+        break;  /* Queue is exhausted. */
+      }
+      TraceEventFlowEnd("play", buffer->id);
+      worker->playback_buffer = buffer;
+    }
+
+    int num_copy = buffer->size - buffer->position;
+    if (num_copy > chunk_size - num_filled) {
+      num_copy = chunk_size - num_filled;
+    }
+    memcpy(dest + num_filled, buffer->samples + buffer->position,
+           num_copy * sizeof(float));
+    buffer->position += num_copy;
+    num_filled += num_copy;
+
+    if (buffer->position == buffer->size) {
+      /* Return the consumed buffer to be freed on the main thread. The free
+       * ring has room for every buffer that can be live, so this succeeds.
+       */
+      SpscRingWrite(worker->free_ring, &buffer, 1);
+      worker->playback_buffer = NULL;
+    }
+  }
+
+  if (num_filled > 0) {
+    atomic_fetch_sub_explicit(&worker->num_playback_samples, num_filled,
+                              memory_order_relaxed);
+  }
+  int i;
+  for (i = num_filled; i < chunk_size; ++i) {
+    dest[i] = 0.0f;
+  }
+  return dest;
+}
+
+/* Main thread: frees playback buffers that the audio thread has consumed. */
+static void FreeConsumedPlaybackBuffers(TactileWorker* worker) {
+  PlaybackBuffer* buffer;
+  while (SpscRingRead(worker->free_ring, &buffer, 1)) {
+    free(buffer);
   }
 }
 
@@ -65,6 +240,19 @@ static int PortAudioCallback(const void* input_buffer, void* output_buffer,
                              const PaStreamCallbackTimeInfo* time_info,
                              PaStreamCallbackFlags status_flags,
                              void* user_data) {
+  const double start_time_s = GetTimeSeconds();
+  TactileWorker* worker = (TactileWorker*)user_data;
+  TraceEventSetThreadName("audio");
+  TRACE_EVENT_SCOPE("callback");
+  ProcessCommands(worker);
+
+  IncrementCounter(&worker->timing.num_callbacks);
+  if (worker->last_callback_time_s >= 0.0) {
+    AddToTimingHistogram(worker, start_time_s - worker->last_callback_time_s,
+                         worker->timing.interval_histogram);
+  }
+  worker->last_callback_time_s = start_time_s;
+
   /* Check whether PortAudio detected output underflow, meaning the program did
    * not complete this callback in time to provide an output chunk.
    *
@@ -79,16 +267,20 @@ static int PortAudioCallback(const void* input_buffer, void* output_buffer,
    *    chunk_size >= 0.005 * sample_rate_hz.
    */
   if (status_flags & paOutputUnderflow) {
+    IncrementCounter(&worker->timing.num_output_underflows);
     fprintf(stderr, "Error: Underflow in tactile output. "
         "chunk_size (%lu) might be too small.\n", frames_per_buffer);
   }
-
-  TactileWorker* worker = (TactileWorker*)user_data;
+  if (status_flags & paInputOverflow) {
+    IncrementCounter(&worker->timing.num_input_overflows);
+  }
 
   /* Get input from the microphone or from the playback queue. */
-  float* input = worker->mic_is_input
-                     ? (float*)input_buffer
-                     : worker->buffers[worker->active_buffer_index];
+  const float* input = worker->mic_is_input ? (const float*)input_buffer
+                                            : ReadPlaybackChunk(worker);
+  TraceEventCounter("playback_samples",
+                    atomic_load_explicit(&worker->num_playback_samples,
+                                         memory_order_relaxed));
   float* output = (float*)output_buffer;
 
   const int block_size =
@@ -96,20 +288,15 @@ static int PortAudioCallback(const void* input_buffer, void* output_buffer,
   const int num_blocks = worker->chunk_size / block_size;
   float energy_accum[kNumTactors] = {0.0f};
 
-  /* Reset tactile processing if requested. */
-  if (worker->should_reset_tactile_processor) {
-    worker->should_reset_tactile_processor = 0;
-    TactileProcessorReset(worker->tactile_processor);
-    PostProcessorReset(&worker->post_processor);
-  }
-
   /* Process the chunk. */
   int b;
   for (b = 0; b < num_blocks; ++b) {
     float* tactile_output = worker->tactile_output;
     /* Run audio-to-tactile processing. */
+    TraceEventBegin("tactile_processor");
     TactileProcessorProcessSamples(
         worker->tactile_processor, input, tactile_output);
+    TraceEventEnd("tactile_processor");
 
     /* Accumulate signals for visualization. Do this before post processing. */
     int i;
@@ -123,107 +310,53 @@ static int PortAudioCallback(const void* input_buffer, void* output_buffer,
 
     /* Apply equalization, clipping, and lowpass filtering. */
     tactile_output = worker->tactile_output;
+    TraceEventBegin("post_processor");
     PostProcessorProcessSamples(
         &worker->post_processor, tactile_output, block_size);
+    TraceEventEnd("post_processor");
 
     /* Map channels and apply channel gains. */
+    TraceEventBegin("channel_map");
     ChannelMapApply(&worker->channel_map, tactile_output, block_size, output);
+    TraceEventEnd("channel_map");
 
     input += block_size;
     output += worker->channel_map.num_output_channels * block_size;
   }
 
-  const float volume_decay_coeff = worker->volume_decay_coeff;
+  // Convert tactile energy to perceived strength with Steven's power law.
+  // Perceived strength is roughly proportional to acceleration^0.55, which is
+  // proportional to sqrt(energy)^0.55, i.e. 0.55 times the energy in dB
+  // converted back as an amplitude ratio. Energies are floored at -120 dB.
+  float perceived[kNumTactors];
+  const float energy_scale = 1.0f / (num_blocks * block_size);
   int c;
   for (c = 0; c < kNumTactors; ++c) {
-    // Convert tactile energy to perceived strength with Steven's power law.
-    // Perceived strength is roughly proportional to acceleration^0.55, which is
-    // proportional to sqrt(energy)^0.55.
-    const float perceived = FastPow(1e-12f + energy_accum[c]
-        / (num_blocks * block_size), 0.55f * 0.5f);
-    float updated_volume = worker->volume_meters[c] * volume_decay_coeff;
-    if (perceived > updated_volume) { updated_volume = perceived; }
-    worker->volume_meters[c] = updated_volume;
-  }
-
-  if (!worker->mic_is_input) {
-    /* Ping pong the buffers. */
-    worker->active_buffer_index ^= 1;
-    /* Signal the queue thread to start filling the next buffer. */
-    pthread_cond_signal(&worker->queue_cond);
+    perceived[c] = energy_scale * energy_accum[c];
   }
-  return paContinue;
-}
-
-static void* QueueThread(void* user_data) {
-  TactileWorker* worker = (TactileWorker*)user_data;
-  const int chunk_size = worker->chunk_size;
-  pthread_mutex_lock(&worker->queue_mutex);
-
-  while (1) {
-    /* Wait until the consumer is done reading from the current buffer. */
-    int buffer_index = worker->active_buffer_index;
-    while (worker->queue_thread_keep_running &&
-           worker->active_buffer_index == buffer_index) {
-      pthread_cond_wait(&worker->queue_cond, &worker->queue_mutex);
-    }
-    if (!worker->queue_thread_keep_running) {
-      break;
-    }
-
-    /* Now refill the buffer from `queued_samples`, zero-filling if we have
-     * exhausted the queue.
-     */
-    float* dest = (float*)worker->buffers[buffer_index];
-    int num_copy = worker->queue_size - worker->queue_position;
-    if (num_copy > 0) {
-      if (chunk_size < num_copy) {
-        num_copy = chunk_size;
-      }
-      memcpy(dest, worker->queue_samples + worker->queue_position,
-             num_copy * sizeof(float));
-      worker->queue_position += num_copy;
-    }
-    int i;
-    for (i = num_copy; i < chunk_size; ++i) {
-      dest[i] = 0.0f;
-    }
-
-    /* Occasionally pop consumed samples off the queue. */
-    if (worker->queue_position >= worker->queue_size) {
-      worker->queue_size = 0;
-      worker->queue_position = 0;
-    } else if (worker->queue_position >= 16384) {
-      const int new_size = worker->queue_size - worker->queue_position;
-      if (new_size > 0) {
-        memmove(worker->queue_samples,
-                worker->queue_samples + worker->queue_position,
-                new_size * sizeof(float));
-      }
-      worker->queue_size = new_size;
-      worker->queue_position = 0;
-    }
+  FastPowerRatioToDecibelsN(perceived, -120.0f, kNumTactors, perceived);
+  for (c = 0; c < kNumTactors; ++c) {
+    perceived[c] *= 0.55f;
   }
+  FastDecibelsToAmplitudeRatioN(perceived, kNumTactors, perceived);
 
-  pthread_mutex_unlock(&worker->queue_mutex);
-  return NULL;
-}
+  const float volume_decay_coeff = worker->volume_decay_coeff;
+  for (c = 0; c < kNumTactors; ++c) {
+    float updated_volume = atomic_load_explicit(
+        &worker->volume_meters[c], memory_order_relaxed) * volume_decay_coeff;
+    if (perceived[c] > updated_volume) { updated_volume = perceived[c]; }
+    atomic_store_explicit(&worker->volume_meters[c], updated_volume,
+                          memory_order_relaxed);
+  }
 
-/* Starts the queue thread. Returns 1 on success, 0 on failure. */
-static int StartQueueThread(TactileWorker* worker) {
-  if (pthread_mutex_init(&worker->queue_mutex, NULL) != 0) {
-    return 0;
-  } else if (pthread_cond_init(&worker->queue_cond, NULL) != 0) {
-    pthread_mutex_destroy(&worker->queue_mutex);
-    return 0;
-  } else if (pthread_create(&worker->queue_thread, NULL, QueueThread, worker) !=
-             0) {
-    pthread_cond_destroy(&worker->queue_cond);
-    pthread_mutex_destroy(&worker->queue_mutex);
-    return 0;
+  const double duration_s = GetTimeSeconds() - start_time_s;
+  AddToTimingHistogram(worker, duration_s, worker->timing.duration_histogram);
+  if (duration_s > atomic_load_explicit(&worker->timing.max_duration_s,
+                                        memory_order_relaxed)) {
+    atomic_store_explicit(&worker->timing.max_duration_s, (float)duration_s,
+                          memory_order_relaxed);
   }
-  worker->queue_thread_initialized = 1;
-  return 1;
+  return paContinue;
 }
 
 /* Starts PortAudio. Returns 1 on success, 0 on failure. */
@@ -382,18 +515,40 @@ TactileWorker* TactileWorkerMake(TactileWorkerParams* params) {
   if (!worker->tactile_output) {
     goto fail;
   }
-  worker->buffers[0] = (float*)malloc(2 * worker->chunk_size * sizeof(float));
-  if (!worker->buffers[0]) {
+  worker->playback_chunk = (float*)malloc(worker->chunk_size * sizeof(float));
+  if (!worker->playback_chunk) {
     goto fail;
   }
-  worker->buffers[1] = worker->buffers[0] + worker->chunk_size;
 
-  int i;
-  for (i = 0; i < 2 * worker->chunk_size; ++i) {
-    worker->buffers[0][i] = 0.0f;
+  /* Make rings. The free ring has room for all buffers in the playback ring
+   * plus the one being read, so that the audio thread never fails to return a
+   * buffer.
+   */
+  worker->command_ring = SpscRingMake(sizeof(int), kCommandRingCapacity);
+  worker->playback_ring =
+      SpscRingMake(sizeof(PlaybackBuffer*), kPlaybackRingCapacity);
+  worker->free_ring =
+      SpscRingMake(sizeof(PlaybackBuffer*), 2 * kPlaybackRingCapacity);
+  if (!worker->command_ring || !worker->playback_ring || !worker->free_ring) {
+    goto fail;
   }
 
-  if (!StartQueueThread(worker) || !StartPortAudio(worker, params)) {
+  /* Start tracing before the audio thread. */
+  if (params->trace_path) {
+    worker->trace_path = (char*)malloc(strlen(params->trace_path) + 1);
+    if (!worker->trace_path) {
+      goto fail;
+    }
+    strcpy(worker->trace_path, params->trace_path);
+    if (!TraceEventStart(kTraceMaxEventsPerThread)) {
+      free(worker->trace_path);
+      worker->trace_path = NULL;
+      goto fail;
+    }
+    TraceEventSetThreadName("main");
+  }
+
+  if (!StartPortAudio(worker, params)) {
     goto fail;
   }
   return worker;
@@ -411,20 +566,30 @@ void TactileWorkerFree(TactileWorker* worker) {
       }
       Pa_Terminate();
     }
+    /* Write the trace after the audio thread has stopped. */
+    if (worker->trace_path) {
+      if (TraceEventStopAndWrite(worker->trace_path)) {
+        printf("Wrote trace to: %s\n", worker->trace_path);
+      }
+      free(worker->trace_path);
+    }
 
-    if (worker->queue_thread_initialized) { /* Clean up queue thread. */
-      pthread_mutex_lock(&worker->queue_mutex);
-      worker->queue_thread_keep_running = 0;
-      pthread_mutex_unlock(&worker->queue_mutex);
-      pthread_cond_broadcast(&worker->queue_cond);
-      pthread_join(worker->queue_thread, NULL);
-
-      pthread_cond_destroy(&worker->queue_cond);
-      pthread_mutex_destroy(&worker->queue_mutex);
+    /* The audio thread is stopped, so all playback buffers may be freed here. */
+    free(worker->playback_buffer);
+    if (worker->playback_ring) {
+      PlaybackBuffer* buffer;
+      while (SpscRingRead(worker->playback_ring, &buffer, 1)) {
+        free(buffer);
+      }
     }
+    if (worker->free_ring) {
+      FreeConsumedPlaybackBuffers(worker);
+    }
+    SpscRingFree(worker->free_ring);
+    SpscRingFree(worker->playback_ring);
+    SpscRingFree(worker->command_ring);
 
-    free(worker->queue_samples);
-    free(worker->buffers[0]);
+    free(worker->playback_chunk);
     free(worker->tactile_output);
     TactileProcessorFree(worker->tactile_processor);
     TactileWorkerInit(worker);
@@ -433,50 +598,79 @@ void TactileWorkerFree(TactileWorker* worker) {
 }
 
 void TactileWorkerReset(TactileWorker* worker) {
-  worker->should_reset_tactile_processor = 1;
+  SendCommand(worker, kTactileWorkerCommandReset);
 }
 
 void TactileWorkerSetMicInput(TactileWorker* worker) {
-  worker->mic_is_input = 1;
+  SendCommand(worker, kTactileWorkerCommandSetMicInput);
 }
 
 void TactileWorkerSetPlaybackInput(TactileWorker* worker) {
-  worker->mic_is_input = 0;
+  SendCommand(worker, kTactileWorkerCommandSetPlaybackInput);
 }
 
 int TactileWorkerPlay(TactileWorker* worker, float* samples, int num_samples) {
-  pthread_mutex_lock(&worker->queue_mutex);
-
-  const int new_size = worker->queue_size + num_samples;
-  if (new_size > worker->queue_capacity) { /* Grow queue_samples if needed. */
-    const int new_capacity = 2 * new_size;
-    float* new_queue_samples =
-        (float*)realloc(worker->queue_samples, new_capacity * sizeof(float));
-    if (!new_queue_samples) {
-      pthread_mutex_unlock(&worker->queue_mutex);
-      return 0;
-    }
-    worker->queue_samples = new_queue_samples;
-    worker->queue_capacity = new_capacity;
+  TRACE_EVENT_SCOPE("play");
+  FreeConsumedPlaybackBuffers(worker);
+  if (num_samples <= 0) { return 1; }
+
+  PlaybackBuffer* buffer = (PlaybackBuffer*)malloc(
+      sizeof(PlaybackBuffer) + num_samples * sizeof(float));
+  if (!buffer) { return 0; }
+  buffer->size = num_samples;
+  buffer->position = 0;
+  buffer->id = worker->num_plays++;
+  buffer->samples = (float*)(buffer + 1);
+  memcpy(buffer->samples, samples, num_samples * sizeof(float));
+
+  /* Count the samples before the audio thread can see the buffer, so that the
+   * count doesn't go transiently negative.
+   */
+  atomic_fetch_add_explicit(&worker->num_playback_samples, num_samples,
+                            memory_order_relaxed);
+  TraceEventFlowStart("play", buffer->id);
+  if (!SpscRingWrite(worker->playback_ring, &buffer, 1)) {
+    atomic_fetch_sub_explicit(&worker->num_playback_samples, num_samples,
+                              memory_order_relaxed);
+    free(buffer);
+    return 0;
   }
-  /* Append `samples` to queue_samples. */
-  memcpy(worker->queue_samples + worker->queue_size, samples,
-         num_samples * sizeof(float));
-  worker->queue_size = new_size;
-
-  pthread_mutex_unlock(&worker->queue_mutex);
   return 1;
 }
 
 int TactileWorkerGetRemainingPlaybackSamples(TactileWorker* worker) {
-  int num_remaining;
-  pthread_mutex_lock(&worker->queue_mutex);
-  num_remaining = worker->queue_size - worker->queue_position;
-  pthread_mutex_unlock(&worker->queue_mutex);
-  return num_remaining;
+  return atomic_load_explicit(&worker->num_playback_samples,
+                              memory_order_relaxed);
 }
 
 void TactileWorkerGetVolumeMeters(TactileWorker* worker, float* volume_meters) {
-  memcpy(volume_meters, (float*)worker->volume_meters,
-         kNumTactors * sizeof(float));
+  int c;
+  for (c = 0; c < kNumTactors; ++c) {
+    volume_meters[c] =
+        atomic_load_explicit(&worker->volume_meters[c], memory_order_relaxed);
+  }
+}
+
+void TactileWorkerGetTimingStats(TactileWorker* worker,
+                                 TactileWorkerTimingStats* stats) {
+  stats->num_callbacks = atomic_load_explicit(&worker->timing.num_callbacks,
+                                              memory_order_relaxed);
+  stats->num_output_underflows = atomic_load_explicit(
+      &worker->timing.num_output_underflows, memory_order_relaxed);
+  stats->num_input_overflows = atomic_load_explicit(
+      &worker->timing.num_input_overflows, memory_order_relaxed);
+  stats->period_s = (double)worker->chunk_size / worker->sample_rate_hz;
+  stats->max_duration_s = atomic_load_explicit(&worker->timing.max_duration_s,
+                                               memory_order_relaxed);
+  int i;
+  for (i = 0; i < kTactileWorkerNumTimingBuckets; ++i) {
+    stats->duration_histogram[i] = atomic_load_explicit(
+        &worker->timing.duration_histogram[i], memory_order_relaxed);
+    stats->interval_histogram[i] = atomic_load_explicit(
+        &worker->timing.interval_histogram[i], memory_order_relaxed);
+  }
+}
+
+void TactileWorkerResetTimingStats(TactileWorker* worker) {
+  SendCommand(worker, kTactileWorkerCommandResetTimingStats);
 }
@@ -29,14 +29,22 @@
  *
  *   http://atastypixel.com/blog/four-common-mistakes-in-audio-development/
  *
- * So we use a separate thread to manage the playback queue and to mediate
- * between public APIs and the audio thread:
+ * So public APIs communicate with the audio thread only through lock-free
+ * single-producer single-consumer rings (extras/tools/spsc_ring.h):
  *
- *   Main/Python thread <---> Queue thread  <---> Audio thread.
+ *   Main/Python thread  --command ring-->   Audio thread
+ *                       --playback ring-->
+ *                       <--free ring------
  *
- * Synchronization between the main thread and queue thread is done with
- * mutexes. Synchronization between the queue thread and audio thread is done
- * with lockless ping-pong buffering and a few volatile variables.
+ * Commands (reset, input source selection) are applied at the start of the
+ * next audio callback. `TactileWorkerPlay` allocates a buffer for the samples
+ * on the calling thread and passes its pointer through the playback ring. The
+ * audio thread reads from it directly and, once consumed, returns it through
+ * the free ring so that it is freed on the main thread. Playback therefore
+ * starts on the next callback, with no intermediate copy or thread hop.
+ *
+ * To see where callback time goes, set `trace_path` in the params to record a
+ * timeline of callbacks, processing stages, and ring handoffs.
  */
 
 #ifndef AUDIO_TO_TACTILE_EXTRAS_PYTHON_TACTILE_TACTILE_WORKER_H_
@@ -46,15 +54,23 @@
 extern "C" {
 #endif
 
-#include <pthread.h>
+#include <stdatomic.h>
 
 #include "extras/tools/channel_map_tui.h"
+#include "extras/tools/spsc_ring.h"
 #include "src/tactile/post_processor.h"
 #include "src/tactile/tactile_processor.h"
 #include "portaudio.h"
 
 #define kNumTactors 10
 
+/* Callback timing histograms have kTactileWorkerNumTimingBuckets buckets, each
+ * 1/kTactileWorkerTimingBucketsPerPeriod of the chunk period wide, so they
+ * cover up to twice the period. The last bucket also counts anything longer.
+ */
+#define kTactileWorkerNumTimingBuckets 32
+#define kTactileWorkerTimingBucketsPerPeriod 16
+
 typedef struct {
   /* PortAudio device to take input audio from, or NULL for no input device. */
   char* input_device;
@@ -70,8 +86,37 @@ typedef struct {
   PostProcessorParams post_processor_params;
   /* Configuration for mapping tactile signals to output channels. */
   ChannelMap channel_map;
+  /* If non-NULL, a timeline of the audio callbacks is recorded and written as
+   * Chrome trace JSON to this path when the worker is freed, see
+   * extras/tools/trace_event.h.
+   */
+  const char* trace_path;
 } TactileWorkerParams;
 
+/* Snapshot of PortAudio callback timing statistics. */
+typedef struct {
+  /* Number of callbacks since start or the last reset. */
+  int num_callbacks;
+  /* Number of callbacks where PortAudio reported output underflow. */
+  int num_output_underflows;
+  /* Number of callbacks where PortAudio reported input overflow. */
+  int num_input_overflows;
+  /* Callback deadline, the duration of one chunk in seconds. */
+  double period_s;
+  /* Longest callback execution time in seconds. */
+  double max_duration_s;
+  /* Histogram of callback execution time relative to `period_s`. Bucket `i`
+   * counts durations in [i, i + 1) * period_s /
+   * kTactileWorkerTimingBucketsPerPeriod.
+   */
+  int duration_histogram[kTactileWorkerNumTimingBuckets];
+  /* Histogram of time between successive callback starts, bucketed the same
+   * way. Ideally all counts are in the bucket at one period; spread around it
+   * is scheduling jitter.
+   */
+  int interval_histogram[kTactileWorkerNumTimingBuckets];
+} TactileWorkerTimingStats;
+
 /* Set TactileWorkerParams to defaults. */
 void TactileWorkerSetDefaultParams(TactileWorkerParams* params);
 
@@ -93,37 +138,36 @@ typedef struct {
 
   /* Audio thread variables. */
 
-  /* Ping pong buffers for synchronization with the audio thread. */
-  float* buffers[2];
-  /* The audio thread reads from `buffers[active_buffer_index]`. */
-  volatile int active_buffer_index;
   /* 1 => take input from microphone, 0 => input from playback queue. */
-  volatile int /* bool */ mic_is_input;
-  /* Nonzero if Reset method was called. */
-  volatile int /* bool */ should_reset_tactile_processor;
+  int /* bool */ mic_is_input;
+  /* Start time of the previous callback in seconds, or negative if none. */
+  double last_callback_time_s;
+  /* Playback buffer currently being read, or NULL. */
+  struct TactileWorkerPlaybackBuffer* playback_buffer;
+  /* Buffer of `chunk_size` samples for playback input. */
+  float* playback_chunk;
+
+  /* Variables shared between threads. */
+
+  /* TactileWorkerCommand values from the main thread to the audio thread. */
+  SpscRing* command_ring;
+  /* TactileWorkerPlaybackBuffer pointers from the main thread. */
+  SpscRing* playback_ring;
+  /* Consumed TactileWorkerPlaybackBuffer pointers to free on the main thread. */
+  SpscRing* free_ring;
+  /* Number of samples queued for playback and not yet consumed. */
+  atomic_int num_playback_samples;
   /* Volume meter for each tactor, used for visualization. */
-  volatile float volume_meters[kNumTactors];
-
-  /* Queue thread variables. */
-
-  /* Buffer of audio samples in the queue. */
-  float* queue_samples;
-  /* Allocated queue capacity. */
-  int queue_capacity;
-  /* Queue size, always less than `queue_capacity`. */
-  int queue_size;
-  /* Queue read position, always less than `queue_size`. */
-  int queue_position;
-  /* Queue thread. */
-  pthread_t queue_thread;
-  /* Mutex guarding all queue variables. */
-  pthread_mutex_t queue_mutex;
-  /* Cond used to signal the queue thread when to fill the ring buffer. */
-  pthread_cond_t queue_cond;
-  /* Nonzero if queue thread initialized successfully. */
-  int /* bool */ queue_thread_initialized;
-  /* Nonzero if queue thread should keep running. */
-  int /* bool */ queue_thread_keep_running;
+  _Atomic float volume_meters[kNumTactors];
+  /* Callback timing statistics, written only by the audio thread. */
+  struct {
+    atomic_int num_callbacks;
+    atomic_int num_output_underflows;
+    atomic_int num_input_overflows;
+    _Atomic float max_duration_s;
+    atomic_int duration_histogram[kTactileWorkerNumTimingBuckets];
+    atomic_int interval_histogram[kTactileWorkerNumTimingBuckets];
+  } timing;
 
   /* PortAudio variables. */
 
@@ -131,6 +175,11 @@ typedef struct {
   int /* bool */ pa_initialized;
   /* The PortAudio stream. */
   PaStream* pa_stream;
+
+  /* Path to write the trace to, or NULL if not tracing. */
+  char* trace_path;
+  /* Number of TactileWorkerPlay calls, used as trace flow ids. */
+  int num_plays;
 } TactileWorker;
 
 /* Makes a `TactileWorker`. The caller should free it when done with
@@ -152,7 +201,8 @@ void TactileWorkerSetPlaybackInput(TactileWorker* worker);
 
 /* This function appends `input_samples` audio to the playback queue, which will
  * get converted to tactile and played to the output device when the playback
- * input source is selected (with SetPlaybackInput).
+ * input source is selected (with SetPlaybackInput). Returns 1 on success, 0 on
+ * failure, e.g. if too many Play calls are queued.
  */
 int TactileWorkerPlay(TactileWorker* worker, float* samples, int num_samples);
 
@@ -162,6 +212,16 @@ int TactileWorkerGetRemainingPlaybackSamples(TactileWorker* worker);
 /* Gets the current tactor volume levels as size-kNumTactors array. */
 void TactileWorkerGetVolumeMeters(TactileWorker* worker, float* volume_meters);
 
+/* Gets callback timing statistics. Counters are read individually without
+ * stopping the audio thread, so a snapshot may be off by one callback between
+ * fields.
+ */
+void TactileWorkerGetTimingStats(TactileWorker* worker,
+                                 TactileWorkerTimingStats* stats);
+
+/* Resets timing statistics to zero. This takes effect at the next callback. */
+void TactileWorkerResetTimingStats(TactileWorker* worker);
+
 #ifdef __cplusplus
 }  /* extern "C" */
 #endif
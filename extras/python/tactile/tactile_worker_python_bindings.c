@@ -49,7 +49,8 @@
  *                use_equalizer=True,
  *                mid_gain_db=-10.0,
  *                high_gain_db=-5.5,
- *                post_processing_cutoff_hz=1000.0)
+ *                post_processing_cutoff_hz=1000.0,
+ *                trace_path=None)
  *    """Constructor. [Wraps `TactileWorkerMake()` in the C library.]
  *
  *    The constructor initializes PortAudio and starts a stream with the
@@ -77,6 +78,8 @@
  *      high_gain_db: Float, equalizer high band gain in dB.
  *      post_processing_cutoff_hz: Float, cutoff in Hz of post-processing
  *        lowpass filter.
+ *      trace_path: String, if specified, a timeline of the audio callbacks is
+ *        written as Chrome trace JSON to this file when the worker is freed.
  *
  *    Raises:
  *      ValueError: if parameters are invalid. The C library may write
@@ -111,6 +114,31 @@
  *  def volume_meters(self)
  *    """Gets the current tactor volume levels as size-NUM_TACTORS array."""
  *
+ *  @property
+ *  def timing_stats(self)
+ *    """Gets PortAudio callback timing statistics.
+ *
+ *    Useful for choosing `chunk_size` for a machine: callbacks should finish
+ *    well within `period_s`, and intervals should cluster at one period.
+ *
+ *    Returns:
+ *      Dict with keys
+ *        'num_callbacks': Number of callbacks since start or last reset.
+ *        'num_output_underflows': Callbacks with output underflow.
+ *        'num_input_overflows': Callbacks with input overflow.
+ *        'period_s': Callback deadline, the duration of one chunk.
+ *        'max_duration_s': Longest callback execution time.
+ *        'bucket_width_s': Width of histogram buckets in seconds.
+ *        'duration_histogram': Int array, histogram of callback execution
+ *          times. Bucket `i` counts times in [i, i + 1) * bucket_width_s, and
+ *          the last bucket counts also anything longer.
+ *        'interval_histogram': Int array, histogram of time between callback
+ *          starts, bucketed the same way.
+ *    """
+ *
+ *  def reset_timing_stats(self)
+ *    """Resets timing statistics to zero."""
+ *
  * NOTE: Using a tool like CLIF is generally a better idea than writing bindings
  * manually. We do it here anyway since as open sourced code it matters that it
  * is easy for others to build. Also, we use numpy, which CLIF does not natively
@@ -151,17 +179,17 @@ static int TactileWorkerObjectInit(TactileWorkerObject* self, PyObject* args,
       "input_device", "output_device", "chunk_size", "sample_rate_hz",
       "channels", "channel_gains_db", "global_gain_db", "cutoff_hz",
       "use_equalizer", "mid_gain_db", "high_gain_db",
-      "post_processing_cutoff_hz", NULL};
+      "post_processing_cutoff_hz", "trace_path", NULL};
 
   if (!PyArg_ParseTupleAndKeywords(
-          args, kw, "|zziiszffpfff:__init__", (char**)keywords,
+          args, kw, "|zziiszffpfffz:__init__", (char**)keywords,
           &params.input_device,
           &params.output_device, &params.chunk_size, &sample_rate_hz, &channels,
           &channel_gains_db, &global_gain_db,
           &params.tactile_processor_params.enveloper_params.energy_cutoff_hz,
           &params.post_processor_params.use_equalizer,
           &mid_gain_db, &high_gain_db,
-          &params.post_processor_params.cutoff_hz)) {
+          &params.post_processor_params.cutoff_hz, &params.trace_path)) {
     return -1; /* PyArg_ParseTupleAndKeywords failed. */
   }
 
@@ -283,6 +311,52 @@ static PyObject* TactileWorkerObjectGetVolumeMeters(TactileWorkerObject* self) {
   return (PyObject*)output;
 }
 
+/* Makes a 1-D numpy int array from `values`. */
+static PyObject* MakeIntArray(const int* values, int size) {
+  npy_intp dims[1];
+  dims[0] = size;
+  PyArrayObject* array = (PyArrayObject*)PyArray_SimpleNew(1, dims, NPY_INT);
+  if (!array) { return NULL; }
+  memcpy(PyArray_DATA(array), values, size * sizeof(int));
+  return (PyObject*)array;
+}
+
+/* Define `TactileWorker.timing_stats`. */
+static PyObject* TactileWorkerObjectGetTimingStats(TactileWorkerObject* self) {
+  TactileWorkerTimingStats stats;
+  TactileWorkerGetTimingStats(self->tactile_worker, &stats);
+
+  PyObject* duration_histogram =
+      MakeIntArray(stats.duration_histogram, kTactileWorkerNumTimingBuckets);
+  PyObject* interval_histogram =
+      MakeIntArray(stats.interval_histogram, kTactileWorkerNumTimingBuckets);
+  PyObject* result = NULL;
+  if (duration_histogram && interval_histogram) {
+    result = Py_BuildValue(
+        "{s:i,s:i,s:i,s:d,s:d,s:d,s:O,s:O}",
+        "num_callbacks", stats.num_callbacks,
+        "num_output_underflows", stats.num_output_underflows,
+        "num_input_overflows", stats.num_input_overflows,
+        "period_s", stats.period_s,
+        "max_duration_s", stats.max_duration_s,
+        "bucket_width_s",
+        stats.period_s / kTactileWorkerTimingBucketsPerPeriod,
+        "duration_histogram", duration_histogram,
+        "interval_histogram", interval_histogram);
+  }
+  Py_XDECREF(duration_histogram);
+  Py_XDECREF(interval_histogram);
+  return result;
+}
+
+/* Define `TactileWorker.reset_timing_stats`. */
+static PyObject* TactileWorkerObjectResetTimingStats(
+    TactileWorkerObject* self) {
+  TactileWorkerResetTimingStats(self->tactile_worker);
+  Py_INCREF(Py_None);
+  return Py_None;
+}
+
 /* TactileWorker's method functions. */
 static PyMethodDef kTactileWorkerMethods[] = {
     {"reset", (PyCFunction)TactileWorkerObjectReset,
@@ -293,6 +367,8 @@ static PyMethodDef kTactileWorkerMethods[] = {
      METH_NOARGS, "Sets playback queue as input source."},
     {"play", (PyCFunction)TactileWorkerObjectPlay, METH_VARARGS | METH_KEYWORDS,
      "Appends samples to playback queue."},
+    {"reset_timing_stats", (PyCFunction)TactileWorkerObjectResetTimingStats,
+     METH_NOARGS, "Resets callback timing statistics."},
     {NULL, NULL, 0, NULL} /* Sentinel */
 };
 
@@ -303,6 +379,8 @@ static PyGetSetDef kTactileWorkerGetSetDef[] = {
      "Number of samples remaining before playback completes."},
     {"volume_meters", (getter)TactileWorkerObjectGetVolumeMeters, NULL,
      "Volume meters for each tactor."},
+    {"timing_stats", (getter)TactileWorkerObjectGetTimingStats, NULL,
+     "Callback timing statistics."},
     {NULL} /* Sentinel */
 };
 
@@ -70,6 +70,21 @@ def volume_meter(a: float) -> str:
   return u'[\x1b[1;32m%s\x1b[0m]' % bar
 
 
+def print_timing_stats(stats):
+  """Prints a summary of TactileWorker callback timing statistics."""
+  print(f'callbacks: {stats["num_callbacks"]}, '
+        f'output underflows: {stats["num_output_underflows"]}, '
+        f'input overflows: {stats["num_input_overflows"]}')
+  print(f'period: {1000 * stats["period_s"]:.2f} ms, '
+        f'max callback duration: {1000 * stats["max_duration_s"]:.2f} ms')
+  width_ms = 1000 * stats['bucket_width_s']
+  for name in ('duration', 'interval'):
+    histogram = stats[name + '_histogram']
+    print(f'{name} histogram:')
+    for i in np.flatnonzero(histogram):
+      print(f'  {i * width_ms:6.2f} ms: {histogram[i]}')
+
+
 def main(argv):
   parser = argparse.ArgumentParser(description='TactileProcessor Python demo')
   parser.add_argument('--input', type=str, help='Input WAV or device')
@@ -144,6 +159,7 @@ def main(argv):
       time.sleep(0.025)
   except KeyboardInterrupt:  # Stop gracefully on Ctrl+C.
     print('\n')
+    print_timing_stats(worker.timing_stats)
 
 
 if __name__ == '__main__':
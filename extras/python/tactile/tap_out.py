@@ -27,12 +27,21 @@ the data encoded by the C library src/dsp/tap_out.h. The intended use is:
 
 3. The device begins to send back buffers of output. The data is deserialized
    here using the reader function.
+
+Alternatively, `TapOut.capture_ex()` requests ring-buffered capture, where each
+output may be captured on only every Nth buffer. Messages then carry a sequence
+number and a count of messages that the device dropped because its ring buffer
+was full, so that gaps in the capture can be detected.
+
+For streaming at full rate, the `tap_out_decoder` extension module parses
+capture messages in C into ring arrays made with `make_ring()`.
 """
 
 import dataclasses
 import datetime
 import enum
-from typing import Callable, Dict, Iterable, List, Type, TypeVar, Tuple, Union
+from typing import (Callable, Dict, Iterable, List, Optional, Sequence, Type,
+                    TypeVar, Tuple, Union)
 
 import numpy as np
 
@@ -60,6 +69,15 @@ OP_DESCRIPTORS = 0x03
 OP_START_CAPTURE = 0x04
 # Message containing captured tap out output.
 OP_CAPTURE = 0x05
+# Request to begin ring-buffered capture. Payload is (token, every_n) pairs.
+OP_START_CAPTURE_EX = 0x06
+# Message containing ring-buffered captured output.
+OP_CAPTURE_EX = 0x07
+
+# Size of the sequence, num dropped, and output mask fields of OP_CAPTURE_EX.
+CAPTURE_EX_HEADER_SIZE = 5
+# Max every_n factor for ring-buffered capture.
+MAX_EVERY_N = 255
 
 HEARTBEAT_BYTES = MARKER + bytes([OP_HEARTBEAT, 0])
 BUFFERS_PER_HEARTBEAT = 100
@@ -204,6 +222,55 @@ def make_reader(
   return reader
 
 
+def make_ring(descriptor: Descriptor, capacity: int) -> np.ndarray:
+  """Makes a ring array of `capacity` buffers of an output.
+
+  The result can be passed as a ring to `tap_out_decoder.TapOutDecoder`, which
+  writes the kth captured buffer to `ring[k % capacity]`.
+
+  Args:
+    descriptor: Descriptor of the output.
+    capacity: Int, number of buffers in the ring.
+  Returns:
+    Zero-initialized array of shape `(capacity,) + descriptor.shape` with the
+    output's dtype, or uint8 array of shape `(capacity, num_bytes)` for text.
+  """
+  if descriptor.dtype.is_numeric:
+    return np.zeros((capacity,) + tuple(descriptor.shape),
+                    descriptor.dtype.numpy_dtype)
+  return np.zeros((capacity, descriptor.num_bytes), np.uint8)
+
+
+@dataclasses.dataclass
+class CaptureExHeader:
+  """Header fields of an OP_CAPTURE_EX message."""
+
+  sequence: int
+  num_dropped: int
+  output_mask: int
+
+  @classmethod
+  def parse(cls, payload: bytes) -> 'CaptureExHeader':
+    """Parse a CaptureExHeader from the start of an OP_CAPTURE_EX payload."""
+    if len(payload) < CAPTURE_EX_HEADER_SIZE:
+      raise ValueError('Capture ex payload is too short')
+    return cls(
+        sequence=int(payload[0]) | int(payload[1]) << 8,
+        num_dropped=int(payload[2]) | int(payload[3]) << 8,
+        output_mask=int(payload[4]))
+
+
+@dataclasses.dataclass
+class CaptureExStats:
+  """Sequence numbers and drop count from `TapOut.capture_ex()`."""
+
+  # For each output name, the buffer index of each captured buffer, counted from
+  # the first message received.
+  sequence: Dict[str, np.ndarray]
+  # Number of messages the device dropped during the capture.
+  num_dropped: int
+
+
 class TapOut:
   """Object managing tap_out receiver communication."""
 
@@ -251,6 +318,107 @@ class TapOut:
 
     return capture_reader(b''.join(captured_raw))
 
+  def capture_ex(
+      self,
+      selected: Iterable[str],
+      num_buffers: int,
+      every_n: Optional[Sequence[int]] = None
+  ) -> Tuple[Dict[str, OutputData], CaptureExStats]:
+    """Captures `num_buffers` of data with ring-buffered capture.
+
+    Args:
+      selected: List of strings, the names of the outputs to capture.
+      num_buffers: Int, the number of device buffers to capture over. Output i
+        is captured on about `num_buffers / every_n[i]` of them.
+      every_n: Optional list of ints, where output i is captured on every
+        `every_n[i]`th buffer. Defaults to capturing every buffer.
+
+    Returns:
+      (captured, stats) tuple, where `captured` is a dictionary of the captured
+      data and `stats` has the sequence numbers and drop count.
+    """
+    descriptors = self.start_capture_ex(selected, every_n)
+    captured_raw = [[] for _ in descriptors]
+    sequence = [[] for _ in descriptors]
+    first_sequence = None
+    prev_sequence = 0
+    index = 0
+    next_heartbeat = BUFFERS_PER_HEARTBEAT
+    num_dropped = 0
+
+    while True:
+      op, payload = self._read_message()
+      if op != OP_CAPTURE_EX:
+        raise ValueError(f'Expected capture ex message, got op = {op}')
+      header = CaptureExHeader.parse(payload)
+      if first_sequence is None:
+        first_sequence = header.sequence
+        first_dropped = header.num_dropped
+      else:
+        # Unwrap 16-bit sequence numbers.
+        index += (header.sequence - prev_sequence) & 0xffff
+      prev_sequence = header.sequence
+      if index >= num_buffers:
+        break
+      num_dropped = (header.num_dropped - first_dropped) & 0xffff
+
+      start = CAPTURE_EX_HEADER_SIZE
+      for i, descriptor in enumerate(descriptors):
+        if header.output_mask & (1 << i):
+          stop = start + descriptor.num_bytes
+          captured_raw[i].append(payload[start:stop])
+          sequence[i].append(index)
+          start = stop
+      if start != len(payload):
+        raise ValueError('Capture ex payload size mismatch')
+
+      if index >= next_heartbeat:
+        self._uart.write(HEARTBEAT_BYTES)
+        next_heartbeat = index + BUFFERS_PER_HEARTBEAT
+
+    self._uart.write(HEARTBEAT_BYTES)
+    captured = {}
+    for i, descriptor in enumerate(descriptors):
+      captured.update(make_reader([descriptor])(b''.join(captured_raw[i])))
+    stats = CaptureExStats(
+        sequence={
+            descriptor.name: np.array(sequence[i], dtype=int)
+            for i, descriptor in enumerate(descriptors)
+        },
+        num_dropped=num_dropped)
+    return captured, stats
+
+  def start_capture_ex(
+      self,
+      selected: Iterable[str],
+      every_n: Optional[Sequence[int]] = None) -> List[Descriptor]:
+    """Sends Start Capture Ex message to begin ring-buffered capture.
+
+    The caller is then responsible for reading the OP_CAPTURE_EX messages and
+    sending a heartbeat every BUFFERS_PER_HEARTBEAT buffers, as `capture_ex()`
+    does, e.g. by feeding the received bytes to a `TapOutDecoder`.
+
+    Args:
+      selected: List of strings, the names of the outputs to capture.
+      every_n: Optional list of ints, where output i is captured on every
+        `every_n[i]`th buffer. Defaults to capturing every buffer.
+
+    Returns:
+      List of the selected outputs' descriptors.
+    """
+    tokens = [self._find_output_by_name(name) for name in selected]
+    if every_n is None:
+      every_n = [1] * len(tokens)
+    if len(every_n) != len(tokens):
+      raise ValueError('every_n must have one factor per output')
+    if not all(1 <= n <= MAX_EVERY_N for n in every_n):
+      raise ValueError(f'every_n factors must be in [1, {MAX_EVERY_N}]')
+
+    self._write_message(
+        OP_START_CAPTURE_EX,
+        bytes(b for pair in zip(tokens, every_n) for b in pair))
+    return [self._descriptors[token] for token in tokens]
+
   def _write_message(self, op: int, payload: bytes = b'') -> None:
     """Writes a tap_out message to UART serial connection."""
     if len(payload) > 255:
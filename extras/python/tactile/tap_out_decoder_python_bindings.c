@@ -0,0 +1,388 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * Python bindings for the TapOutDecoder C implementation.
+ *
+ * These bindings wrap extras/tools/tap_out_decoder.c as a `tap_out_decoder`
+ * Python module containing a `TapOutDecoder` class. Capture data is parsed in C
+ * and written directly into caller-provided numpy arrays, without creating a
+ * Python object per message.
+ *
+ * The interface is as follows.
+ *
+ * class TapOutDecoder(object):
+ *
+ *   def __init__(self, rings, indices=None)
+ *    """Constructor. [Wraps `TapOutDecoderInit()` in the C library.]
+ *
+ *    Args:
+ *      rings: List of writable C-contiguous arrays, one per selected output in
+ *        the order of the Start Capture message, e.g. made by
+ *        `tap_out.make_ring()`. The first dimension is the ring capacity, and
+ *        the remaining dimensions are one frame of the output.
+ *      indices: (Optional) List of writable int64 arrays with the same
+ *        capacities as `rings`, where the buffer index of each frame is
+ *        written.
+ *    """
+ *
+ *  def reset()
+ *    """Resets the parser, counters, and write counts."""
+ *
+ *  def feed(self, data)
+ *    """Parses received bytes, e.g. the result of a serial read.
+ *
+ *    Frame k of output i is written to `rings[i][k % capacity]`. The GIL is
+ *    released while parsing. A TapOutDecoder object should be used by only
+ *    one thread at a time, otherwise RuntimeError is raised.
+ *
+ *    Args:
+ *      data: bytes-like object.
+ *    Returns:
+ *      Number of capture messages completed.
+ *    """
+ *
+ *  @property
+ *  def write_counts(self)
+ *    """List of the number of frames written so far to each ring."""
+ *
+ *  @property
+ *  def num_messages(self)
+ *    """Number of capture messages decoded."""
+ *
+ *  @property
+ *  def num_missing_buffers(self)
+ *    """Number of buffers missing from gaps in the sequence numbers."""
+ *
+ *  @property
+ *  def num_dropped(self)
+ *    """Number of messages the device reported dropping."""
+ *
+ *  @property
+ *  def num_errors(self)
+ *    """Number of skipped messages with an unexpected op or size."""
+ *
+ *  @property
+ *  def num_skipped_bytes(self)
+ *    """Number of bytes skipped while looking for a marker."""
+ */
+
+#define PY_SSIZE_T_CLEAN
+#include "Python.h"
+#include "extras/tools/tap_out_decoder.h"
+#include "structmember.h"
+
+typedef struct {
+  PyObject_HEAD
+  TapOutDecoder decoder;
+  /* Views of the ring and index arrays, held for the object's lifetime. */
+  Py_buffer ring_views[kTapOutMaxOutputs];
+  Py_buffer indices_views[kTapOutMaxOutputs];
+  int num_ring_views;
+  int num_indices_views;
+  int busy;
+} TapOutDecoderObject;
+
+static void ReleaseViews(TapOutDecoderObject* self) {
+  int i;
+  for (i = 0; i < self->num_ring_views; ++i) {
+    PyBuffer_Release(&self->ring_views[i]);
+  }
+  for (i = 0; i < self->num_indices_views; ++i) {
+    PyBuffer_Release(&self->indices_views[i]);
+  }
+  self->num_ring_views = 0;
+  self->num_indices_views = 0;
+}
+
+/* Returns 1 if `format` is a buffer protocol format for native int64. */
+static int /*bool*/ IsInt64Format(const char* format, Py_ssize_t itemsize) {
+  if (format == NULL || itemsize != sizeof(int64_t)) { return 0; }
+  if (*format == '@' || *format == '=' || *format == '<') { ++format; }
+  return strcmp(format, "q") == 0 || strcmp(format, "l") == 0;
+}
+
+/* Define `TapOutDecoder.__init__`. */
+static int TapOutDecoderObjectInit(TapOutDecoderObject* self,
+                                   PyObject* args, PyObject* kw) {
+  PyObject* rings_arg = NULL;
+  PyObject* indices_arg = Py_None;
+  static const char* keywords[] = {"rings", "indices", NULL};
+
+  if (!PyArg_ParseTupleAndKeywords(args, kw, "O|O:__init__", (char**)keywords,
+                                   &rings_arg, &indices_arg)) {
+    return -1;  /* PyArg_ParseTupleAndKeywords failed. */
+  }
+  if (self->busy) {
+    PyErr_SetString(PyExc_RuntimeError,
+                    "TapOutDecoder is in use by another thread");
+    return -1;
+  }
+  ReleaseViews(self);
+
+  PyObject* rings_seq = PySequence_Fast(rings_arg, "rings must be a list");
+  if (!rings_seq) { return -1; }
+  const Py_ssize_t num_outputs = PySequence_Fast_GET_SIZE(rings_seq);
+  if (!(1 <= num_outputs && num_outputs <= kTapOutMaxOutputs)) {
+    PyErr_Format(PyExc_ValueError, "expected 1 to %d rings, got: %zd",
+                 kTapOutMaxOutputs, num_outputs);
+    Py_DECREF(rings_seq);
+    return -1;
+  }
+  PyObject* indices_seq = NULL;
+  if (indices_arg != Py_None) {
+    indices_seq = PySequence_Fast(indices_arg, "indices must be a list");
+    if (!indices_seq) {
+      Py_DECREF(rings_seq);
+      return -1;
+    }
+    if (PySequence_Fast_GET_SIZE(indices_seq) != num_outputs) {
+      PyErr_SetString(PyExc_ValueError,
+                      "indices must have one array per ring");
+      goto fail;
+    }
+  }
+
+  TapOutDecoderRing rings[kTapOutMaxOutputs];
+  int i;
+  for (i = 0; i < num_outputs; ++i) {
+    Py_buffer* view = &self->ring_views[i];
+    if (PyObject_GetBuffer(PySequence_Fast_GET_ITEM(rings_seq, i), view,
+                           PyBUF_WRITABLE | PyBUF_C_CONTIGUOUS) != 0) {
+      goto fail;  /* PyObject_GetBuffer already set an error. */
+    }
+    ++self->num_ring_views;
+    const Py_ssize_t capacity = (view->ndim > 0) ? view->shape[0] : 0;
+    const Py_ssize_t frame_size = (capacity > 0) ? view->len / capacity : 0;
+    if (capacity < 1 || capacity > INT32_MAX ||
+        !(1 <= frame_size && frame_size <= kTapOutDecoderMaxPayload)) {
+      PyErr_Format(PyExc_ValueError,
+                   "ring %d must have shape (capacity, ...) with 1 to %d "
+                   "bytes per frame", i, kTapOutDecoderMaxPayload);
+      goto fail;
+    }
+    rings[i].data = (uint8_t*)view->buf;
+    rings[i].indices = NULL;
+    rings[i].capacity = (int)capacity;
+    rings[i].frame_size = (int)frame_size;
+
+    if (indices_seq) {
+      view = &self->indices_views[i];
+      if (PyObject_GetBuffer(PySequence_Fast_GET_ITEM(indices_seq, i), view,
+                             PyBUF_WRITABLE | PyBUF_FORMAT |
+                                 PyBUF_C_CONTIGUOUS) != 0) {
+        goto fail;
+      }
+      ++self->num_indices_views;
+      if (!IsInt64Format(view->format, view->itemsize) ||
+          view->len != capacity * (Py_ssize_t)sizeof(int64_t)) {
+        PyErr_Format(PyExc_ValueError,
+                     "indices %d must be int64 with %zd elements", i,
+                     capacity);
+        goto fail;
+      }
+      rings[i].indices = (int64_t*)view->buf;
+    }
+  }
+
+  if (!TapOutDecoderInit(&self->decoder, rings, (int)num_outputs)) {
+    PyErr_SetString(PyExc_ValueError, "Error making TapOutDecoder");
+    goto fail;
+  }
+  Py_DECREF(rings_seq);
+  Py_XDECREF(indices_seq);
+  return 0;
+
+fail:
+  ReleaseViews(self);
+  Py_DECREF(rings_seq);
+  Py_XDECREF(indices_seq);
+  return -1;
+}
+
+static void TapOutDecoderDealloc(TapOutDecoderObject* self) {
+  ReleaseViews(self);
+  Py_TYPE(self)->tp_free((PyObject*)self);
+}
+
+/* Returns 1 if the decoder is initialized and not busy, otherwise sets a Python
+ * exception and returns 0.
+ */
+static int /*bool*/ CheckReady(TapOutDecoderObject* self) {
+  if (self->num_ring_views == 0) {
+    PyErr_SetString(PyExc_RuntimeError, "TapOutDecoder is not initialized");
+    return 0;
+  } else if (self->busy) {
+    PyErr_SetString(PyExc_RuntimeError,
+                    "TapOutDecoder is in use by another thread");
+    return 0;
+  }
+  return 1;
+}
+
+/* Define `TapOutDecoder.reset`. */
+static PyObject* TapOutDecoderObjectReset(TapOutDecoderObject* self) {
+  if (!CheckReady(self)) { return NULL; }
+  TapOutDecoderReset(&self->decoder);
+  Py_INCREF(Py_None);
+  return Py_None;
+}
+
+/* Define `TapOutDecoder.feed`. */
+static PyObject* TapOutDecoderObjectFeed(TapOutDecoderObject* self,
+                                         PyObject* args, PyObject* kw) {
+  Py_buffer data;
+  static const char* keywords[] = {"data", NULL};
+
+  if (!PyArg_ParseTupleAndKeywords(args, kw, "y*:feed", (char**)keywords,
+                                   &data)) {
+    return NULL;  /* PyArg_ParseTupleAndKeywords failed. */
+  }
+  if (!CheckReady(self)) {
+    PyBuffer_Release(&data);
+    return NULL;
+  } else if (data.len > INT32_MAX) {
+    PyErr_SetString(PyExc_ValueError, "data is too large");
+    PyBuffer_Release(&data);
+    return NULL;
+  }
+
+  /* Parse, releasing the GIL so that other threads can run. */
+  int num_completed;
+  self->busy = 1;
+  Py_BEGIN_ALLOW_THREADS
+  num_completed = TapOutDecoderFeed(&self->decoder, (const uint8_t*)data.buf,
+                                    (int)data.len);
+  Py_END_ALLOW_THREADS
+  self->busy = 0;
+
+  PyBuffer_Release(&data);
+  return PyLong_FromLong(num_completed);
+}
+
+/* Define `TapOutDecoder.write_counts` getter. */
+static PyObject* TapOutDecoderObjectGetWriteCounts(TapOutDecoderObject* self) {
+  const int num_outputs = self->num_ring_views ? self->decoder.num_outputs : 0;
+  PyObject* list = PyList_New(num_outputs);
+  if (!list) { return NULL; }
+  int i;
+  for (i = 0; i < num_outputs; ++i) {
+    PyObject* count = PyLong_FromLongLong(self->decoder.rings[i].write_count);
+    if (!count) {
+      Py_DECREF(list);
+      return NULL;
+    }
+    PyList_SET_ITEM(list, i, count);  /* Steals reference. */
+  }
+  return list;
+}
+
+/* TapOutDecoder's method functions. */
+static PyMethodDef kTapOutDecoderMethods[] = {
+    {"reset", (PyCFunction)TapOutDecoderObjectReset,
+     METH_NOARGS, "Resets the parser, counters, and write counts."},
+    {"feed", (PyCFunction)TapOutDecoderObjectFeed,
+     METH_VARARGS | METH_KEYWORDS, "Parses received bytes."},
+    {NULL, NULL, 0, NULL} /* Sentinel */
+};
+
+/* Define `num_messages`, etc. as read-only members. */
+static PyMemberDef kTapOutDecoderMembers[] = {
+  {"num_messages", T_LONGLONG,
+   offsetof(TapOutDecoderObject, decoder.num_messages), READONLY, ""},
+  {"num_missing_buffers", T_LONGLONG,
+   offsetof(TapOutDecoderObject, decoder.num_missing_buffers), READONLY, ""},
+  {"num_dropped", T_INT,
+   offsetof(TapOutDecoderObject, decoder.num_dropped), READONLY, ""},
+  {"num_errors", T_INT,
+   offsetof(TapOutDecoderObject, decoder.num_errors), READONLY, ""},
+  {"num_skipped_bytes", T_LONGLONG,
+   offsetof(TapOutDecoderObject, decoder.num_skipped_bytes), READONLY, ""},
+  {NULL}  /* Sentinel. */
+};
+
+/* TapOutDecoder's getters (properties). */
+static PyGetSetDef kTapOutDecoderGetSetDef[] = {
+    {"write_counts", (getter)TapOutDecoderObjectGetWriteCounts, NULL,
+     "Number of frames written so far to each ring."},
+    {NULL} /* Sentinel */
+};
+
+/* Define the TapOutDecoder Python type. */
+static PyTypeObject kTapOutDecoderType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    "TapOutDecoder",                    /* tp_name */
+    sizeof(TapOutDecoderObject),        /* tp_basicsize */
+    0,                                  /* tp_itemsize */
+    (destructor)TapOutDecoderDealloc,   /* tp_dealloc */
+    0,                                  /* tp_print */
+    0,                                  /* tp_getattr */
+    0,                                  /* tp_setattr */
+    0,                                  /* tp_compare */
+    0,                                  /* tp_repr */
+    0,                                  /* tp_as_number */
+    0,                                  /* tp_as_sequence */
+    0,                                  /* tp_as_mapping */
+    0,                                  /* tp_hash */
+    0,                                  /* tp_call */
+    0,                                  /* tp_str */
+    0,                                  /* tp_getattro */
+    0,                                  /* tp_setattro */
+    0,                                  /* tp_as_buffer */
+    Py_TPFLAGS_DEFAULT,                 /* tp_flags */
+    "TapOutDecoder object",             /* tp_doc */
+    0,                                  /* tp_traverse */
+    0,                                  /* tp_clear */
+    0,                                  /* tp_richcompare */
+    0,                                  /* tp_weaklistoffset */
+    0,                                  /* tp_iter */
+    0,                                  /* tp_iternext */
+    kTapOutDecoderMethods,              /* tp_methods */
+    kTapOutDecoderMembers,              /* tp_members */
+    kTapOutDecoderGetSetDef,            /* tp_getset */
+    0,                                  /* tp_base */
+    0,                                  /* tp_dict */
+    0,                                  /* tp_descr_get */
+    0,                                  /* tp_descr_set */
+    0,                                  /* tp_dictoffset */
+    (initproc)TapOutDecoderObjectInit,  /* tp_init */
+};
+
+/* Module methods. */
+static PyMethodDef kModuleMethods[] = {
+    {NULL, NULL, 0, NULL} /* Sentinel */
+};
+
+/* Module definition. */
+static struct PyModuleDef kModule = {
+    PyModuleDef_HEAD_INIT,
+    "tap_out_decoder",  /* m_name */
+    NULL,               /* m_doc */
+    (Py_ssize_t)-1,     /* m_size */
+    kModuleMethods,     /* m_methods */
+    NULL,               /* m_reload */
+    NULL,               /* m_traverse */
+    NULL,               /* m_clear */
+    NULL,               /* m_free */
+};
+
+PyMODINIT_FUNC PyInit_tap_out_decoder(void) {
+  PyObject* m = PyModule_Create(&kModule);
+  kTapOutDecoderType.tp_new = PyType_GenericNew;
+  if (PyType_Ready(&kTapOutDecoderType) >= 0) {
+    Py_INCREF(&kTapOutDecoderType);
+    PyModule_AddObject(m, "TapOutDecoder", (PyObject*)&kTapOutDecoderType);
+  }
+  return m;
+}
@@ -0,0 +1,92 @@
+# Copyright 2022 Google LLC
+#
+# Licensed under the Apache License, Version 2.0 (the "License"); you may not
+# use this file except in compliance with the License. You may obtain a copy of
+# the License at
+#
+#     https://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+# WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+# License for the specific language governing permissions and limitations under
+# the License.
+
+"""Tests for tap_out_decoder Python bindings."""
+
+import unittest
+
+import numpy as np
+
+from extras.python.tactile import tap_out
+from extras.python.tactile import tap_out_decoder
+
+APPLE = tap_out.Descriptor('Apple', tap_out.DType.INT16, (4,))
+BANANA = tap_out.Descriptor('Banana', tap_out.DType.FLOAT, (1, 2))
+
+
+def capture_ex_message(sequence, num_dropped, outputs):
+  """Makes an OP_CAPTURE_EX message with the given (index, array) outputs."""
+  mask = sum(1 << i for i, _ in outputs)
+  payload = (bytes([sequence & 0xff, sequence >> 8,
+                    num_dropped & 0xff, num_dropped >> 8, mask]) +
+             b''.join(x.tobytes() for _, x in outputs))
+  return (tap_out.MARKER + bytes([tap_out.OP_CAPTURE_EX, len(payload)]) +
+          payload)
+
+
+class TapOutDecoderTest(unittest.TestCase):
+
+  def test_capture_ex(self):
+    capacity = 8
+    rings = [tap_out.make_ring(d, capacity) for d in (APPLE, BANANA)]
+    indices = [np.zeros(capacity, np.int64) for _ in rings]
+    decoder = tap_out_decoder.TapOutDecoder(rings, indices)
+
+    apple = np.arange(24, dtype=np.int16).reshape(6, 4)
+    banana = np.arange(12, dtype=np.float32).reshape(6, 1, 2)
+    stream = b'junk'
+    for k, sequence in enumerate((65534, 65535, 0, 3, 4, 5)):
+      # Banana is captured on every other buffer.
+      outputs = [(0, apple[k])] + ([(1, banana[k])] if sequence % 2 else [])
+      stream += capture_ex_message(sequence, 10 + k // 3, outputs)
+
+    # Feed in chunks that split messages.
+    num_completed = 0
+    for start in range(0, len(stream), 7):
+      num_completed += decoder.feed(stream[start:start + 7])
+
+    self.assertEqual(num_completed, 6)
+    self.assertEqual(decoder.num_messages, 6)
+    self.assertEqual(decoder.write_counts, [6, 3])
+    self.assertEqual(decoder.num_missing_buffers, 2)
+    self.assertEqual(decoder.num_dropped, 1)
+    self.assertEqual(decoder.num_errors, 0)
+    self.assertEqual(decoder.num_skipped_bytes, 4)
+    np.testing.assert_array_equal(rings[0][:6], apple)
+    np.testing.assert_array_equal(indices[0][:6], [0, 1, 2, 5, 6, 7])
+    np.testing.assert_array_equal(rings[1][:3], banana[[1, 3, 5]])
+    np.testing.assert_array_equal(indices[1][:3], [1, 5, 7])
+
+  def test_ring_wraps_around(self):
+    ring = tap_out.make_ring(APPLE, 2)
+    decoder = tap_out_decoder.TapOutDecoder([ring])
+    for k in range(5):
+      decoder.feed(capture_ex_message(k, 0, [(0, np.full(4, k, np.int16))]))
+
+    self.assertEqual(decoder.write_counts, [5])
+    # Buffer k is at position k % 2, so 4 overwrote 2 and 3 overwrote 1.
+    np.testing.assert_array_equal(ring, [[4] * 4, [3] * 4])
+
+  def test_invalid_args(self):
+    with self.assertRaises(ValueError):
+      tap_out_decoder.TapOutDecoder([])
+    with self.assertRaises(ValueError):  # Wrong indices dtype.
+      tap_out_decoder.TapOutDecoder([np.zeros((4, 2), np.uint8)],
+                                    [np.zeros(4, np.int32)])
+    with self.assertRaises(ValueError):  # Frames larger than a payload.
+      tap_out_decoder.TapOutDecoder([np.zeros((4, 256), np.uint8)])
+
+
+if __name__ == '__main__':
+  unittest.main()
@@ -0,0 +1,398 @@
+# Copyright 2022 Google LLC
+#
+# Licensed under the Apache License, Version 2.0 (the "License"); you may not
+# use this file except in compliance with the License. You may obtain a copy of
+# the License at
+#
+#     https://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+# WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+# License for the specific language governing permissions and limitations under
+# the License.
+
+"""Daemon capturing tap_out streams from several devices at once.
+
+Connect the devices with USB cables, turn them on, and run this program as
+
+tap_out_server.py --ports <portnames> --capture <outputs> --duration <duration>
+
+where <portnames> is a comma-separated list of the ports where the devices are
+connected, and the other flags are as in run_tap_out.py. Each device is read on
+its own thread, with ring-buffered capture (`TapOut.start_capture_ex()`) parsed
+in C by `tap_out_decoder`. Every captured buffer is timestamped with a host
+clock shared by all devices, so that captures of different devices are aligned
+without manual effort.
+
+When the capture ends, after --duration seconds or on Ctrl+C, each numeric
+output is written to --output as a frame store file <output>.fstore (see
+extras/tools/frame_store.h), where utterance d is device d's stream. Each
+frame is one captured buffer, with columns
+
+  [time_s, index, values...]
+
+where `time_s` is the host time in seconds since the capture started, `index`
+is the device buffer index (gaps are buffers the device dropped), and `values`
+are the output's values flattened. The metadata is JSON describing the output,
+the devices, and their drop counts.
+
+While capturing, clients may subscribe to live views by connecting to
+--listen_port on localhost and sending one line of JSON like
+
+  {"devices": ["/dev/ttyACM0"], "outputs": ["mic_input"]}
+
+where omitted fields mean all devices or outputs. The server then streams one
+JSON line per device, output, and received chunk, with fields "device",
+"output", "time_s", "index", and "values". A client that doesn't keep up misses
+records rather than slowing the capture.
+"""
+
+import datetime
+import json
+import os
+import os.path
+import queue
+import socketserver
+import threading
+import time
+from typing import Any, Callable, Dict, List, Optional, Sequence
+
+from absl import app
+from absl import flags
+import numpy as np
+import serial
+
+from extras.python.phonetics import frame_store
+from extras.python.tactile import tap_out
+from extras.python.tactile import tap_out_decoder
+
+flags.DEFINE_list('ports', [],
+                  'A comma-separated list of serial ports where the devices '
+                  'are connected.')
+
+flags.DEFINE_list('capture', [],
+                  'A comma-separated list of which tap_out outputs to '
+                  'capture.')
+
+flags.DEFINE_list('every_n', [],
+                  'Optional comma-separated list of ints, capturing output i '
+                  'on every every_n[i]th buffer.')
+
+flags.DEFINE_string('output', None, 'Output directory.')
+
+flags.DEFINE_float('duration', 60.0,
+                   'Capture duration in seconds, or 0 to capture until Ctrl+C.')
+
+flags.DEFINE_integer('listen_port', 8765,
+                     'Port on localhost for live view subscribers, or 0 to '
+                     'disable.')
+
+FLAGS = flags.FLAGS
+
+MIC_SAMPLE_RATE_HZ = 15625.0
+# Buffer duration in seconds.
+BUFFER_DURATION_S = 64 / MIC_SAMPLE_RATE_HZ
+# Number of buffers in each decoder ring. Rings are drained after every serial
+# read, so this only needs to exceed the number of messages in one read.
+RING_CAPACITY = 4096
+# Max number of records queued for a live view subscriber.
+SUBSCRIBER_QUEUE_SIZE = 256
+
+
+class Hub:
+  """Distributes live capture records to subscribers."""
+
+  def __init__(self):
+    self._lock = threading.Lock()
+    self._subscribers = []  # type: List[Dict[str, Any]]
+
+  def subscribe(self, devices: Optional[Sequence[str]] = None,
+                outputs: Optional[Sequence[str]] = None) -> 'queue.Queue':
+    """Subscribes to records of `devices` and `outputs`, or all if None."""
+    subscriber = {
+        'devices': set(devices) if devices else None,
+        'outputs': set(outputs) if outputs else None,
+        'queue': queue.Queue(SUBSCRIBER_QUEUE_SIZE),
+    }
+    with self._lock:
+      self._subscribers.append(subscriber)
+    return subscriber['queue']
+
+  def unsubscribe(self, q: 'queue.Queue') -> None:
+    with self._lock:
+      self._subscribers = [s for s in self._subscribers if s['queue'] is not q]
+
+  def has_subscribers(self) -> bool:
+    return bool(self._subscribers)
+
+  def publish(self, record: Dict[str, Any]) -> None:
+    """Publishes a record to matching subscribers without blocking."""
+    with self._lock:
+      subscribers = list(self._subscribers)
+    for s in subscribers:
+      if ((s['devices'] is None or record['device'] in s['devices']) and
+          (s['outputs'] is None or record['output'] in s['outputs'])):
+        try:
+          s['queue'].put_nowait(record)
+        except queue.Full:
+          pass  # Drop records for subscribers that don't keep up.
+
+
+class DeviceCapture(threading.Thread):
+  """Thread capturing tap_out from one device.
+
+  Captured buffers accumulate in memory, where `captured(i)` gets them for
+  output i once the thread has stopped.
+  """
+
+  def __init__(self,
+               device: str,
+               uart,
+               selected: Sequence[str],
+               every_n: Optional[Sequence[int]],
+               hub: Hub,
+               clock: Callable[[], float],
+               ring_capacity: int = RING_CAPACITY):
+    super().__init__(name=f'tap_out {device}', daemon=True)
+    self.device = device
+    self.descriptors = []  # type: List[tap_out.Descriptor]
+    self.build_date = None  # type: Optional[datetime.date]
+    self.error = None  # type: Optional[Exception]
+    # Buffers that were overwritten in a ring before they were drained.
+    self.num_overrun = 0
+    self.decoder = None
+    self._uart = uart
+    self._selected = list(selected)
+    self._every_n = every_n
+    self._hub = hub
+    self._clock = clock
+    self._ring_capacity = ring_capacity
+    self._stop_event = threading.Event()
+    self._chunks = []  # type: List[List[tuple]]
+
+  def stop(self) -> None:
+    """Stops capture and waits for the thread to finish."""
+    self._stop_event.set()
+    self.join()
+
+  def run(self) -> None:
+    try:
+      comm = tap_out.TapOut(self._uart)
+      _, self.build_date = comm.get_descriptors()
+      self.descriptors = comm.start_capture_ex(self._selected, self._every_n)
+      self._capture()
+    except Exception as e:  # pylint: disable=broad-except
+      self.error = e
+
+  def captured(self, i: int):
+    """Gets (time_s, index, data) arrays captured for output i."""
+    chunks = self._chunks[i] if self._chunks else []
+    if not chunks:
+      descriptor = self.descriptors[i]
+      empty = tap_out.make_ring(descriptor, 0)
+      return np.zeros(0), np.zeros(0, np.int64), empty
+    times, indices, data = zip(*chunks)
+    return np.concatenate(times), np.concatenate(indices), np.concatenate(data)
+
+  def _capture(self) -> None:
+    rings = [tap_out.make_ring(d, self._ring_capacity)
+             for d in self.descriptors]
+    indices = [np.zeros(self._ring_capacity, np.int64) for _ in rings]
+    self.decoder = tap_out_decoder.TapOutDecoder(rings, indices)
+    self._chunks = [[] for _ in rings]
+    read_counts = [0] * len(rings)
+    next_heartbeat = tap_out.BUFFERS_PER_HEARTBEAT
+
+    while not self._stop_event.is_set():
+      data = self._uart.read(max(1, self._uart.in_waiting))
+      arrival_s = self._clock()
+      if not data or not self.decoder.feed(data):
+        continue
+
+      new_chunks = []
+      for i, count in enumerate(self.decoder.write_counts):
+        start = max(read_counts[i], count - self._ring_capacity)
+        self.num_overrun += start - read_counts[i]
+        read_counts[i] = count
+        positions = np.arange(start, count) % self._ring_capacity
+        new_chunks.append((indices[i][positions], rings[i][positions]))
+
+      # Timestamp buffers by their arrival, counting back from the latest
+      # buffer in this read by the nominal buffer duration.
+      latest = max((int(index[-1]) for index, _ in new_chunks if len(index)),
+                   default=0)
+      for i, (index, frames) in enumerate(new_chunks):
+        if not len(index):
+          continue
+        times = arrival_s - (latest - index) * BUFFER_DURATION_S
+        self._chunks[i].append((times, index, frames))
+        if self._hub.has_subscribers():
+          self._hub.publish(self._make_record(i, times, index, frames))
+
+      num_messages = self.decoder.num_messages
+      if num_messages >= next_heartbeat:
+        self._uart.write(tap_out.HEARTBEAT_BYTES)
+        next_heartbeat = num_messages + tap_out.BUFFERS_PER_HEARTBEAT
+
+  def _make_record(self, i: int, times: np.ndarray, index: np.ndarray,
+                   frames: np.ndarray) -> Dict[str, Any]:
+    descriptor = self.descriptors[i]
+    if descriptor.dtype.is_numeric:
+      values = frames.tolist()
+    else:
+      values = [str(f.tobytes(), 'ascii').rstrip('\x00') for f in frames]
+    return {
+        'device': self.device,
+        'output': descriptor.name,
+        'time_s': times.tolist(),
+        'index': index.tolist(),
+        'values': values,
+    }
+
+
+class SubscriberHandler(socketserver.StreamRequestHandler):
+  """Streams live records to a client as JSON lines."""
+
+  def handle(self) -> None:
+    try:
+      request = json.loads(self.rfile.readline() or b'{}')
+    except ValueError:
+      return
+    hub = self.server.hub
+    q = hub.subscribe(request.get('devices'), request.get('outputs'))
+    try:
+      while not self.server.stopping:
+        try:
+          record = q.get(timeout=0.5)
+        except queue.Empty:
+          continue
+        self.wfile.write(json.dumps(record).encode() + b'\n')
+    except OSError:
+      pass  # Client disconnected.
+    finally:
+      hub.unsubscribe(q)
+
+
+class SubscriberServer(socketserver.ThreadingTCPServer):
+  """Server for live view subscribers on localhost."""
+
+  daemon_threads = True
+  allow_reuse_address = True
+
+  def __init__(self, port: int, hub: Hub):
+    super().__init__(('localhost', port), SubscriberHandler)
+    self.hub = hub
+    self.stopping = False
+
+
+def write_stores(output_dir: str, captures: Sequence[DeviceCapture],
+                 start_time: datetime.datetime) -> List[str]:
+  """Writes each numeric output of `captures` as a frame store file.
+
+  Args:
+    output_dir: String, output directory.
+    captures: Stopped DeviceCaptures, all capturing the same outputs.
+    start_time: Datetime, wall clock time when capture started.
+  Returns:
+    List of the written file names.
+  """
+  os.makedirs(output_dir, exist_ok=True)
+  file_names = []
+  for i, descriptor in enumerate(captures[0].descriptors):
+    if not descriptor.dtype.is_numeric:
+      print(f'Skipping text output "{descriptor.name}".')
+      continue
+
+    num_values = int(np.prod(descriptor.shape))
+
+    def utterances(i=i, num_values=num_values):
+      for capture in captures:
+        times, index, data = capture.captured(i)
+        values = data.reshape(len(data), num_values)
+        yield np.column_stack((times, index, values)).astype(np.float32), None
+
+    metadata = {
+        'output': descriptor.name,
+        'dtype': descriptor.dtype.name.lower(),
+        'shape': list(descriptor.shape),
+        'columns': ['time_s', 'index', 'values...'],
+        'buffer_duration_s': BUFFER_DURATION_S,
+        'start_time': start_time.isoformat(),
+        'devices': [{
+            'device': capture.device,
+            'build_date': str(capture.build_date),
+            'num_missing_buffers': capture.decoder.num_missing_buffers,
+            'num_dropped': capture.decoder.num_dropped,
+            'num_errors': capture.decoder.num_errors,
+            'num_overrun': capture.num_overrun,
+        } for capture in captures],
+    }
+    file_name = os.path.join(output_dir, descriptor.name + '.fstore')
+    frame_store.write(file_name, utterances(), json.dumps(metadata))
+    file_names.append(file_name)
+  return file_names
+
+
+def main(_) -> int:
+  if not FLAGS.ports or not FLAGS.capture:
+    print(__doc__)
+    return 1
+  every_n = [int(n) for n in FLAGS.every_n] if FLAGS.every_n else None
+
+  start_time = datetime.datetime.now()
+  output_dir = FLAGS.output or os.path.join(
+      os.path.expanduser('~'),
+      start_time.strftime('tap_out_server_%Y%m%d_%H%M%S'))
+
+  hub = Hub()
+  server = None
+  if FLAGS.listen_port:
+    server = SubscriberServer(FLAGS.listen_port, hub)
+    threading.Thread(target=server.serve_forever, daemon=True).start()
+    print(f'Live view subscribers may connect to localhost:{FLAGS.listen_port}')
+
+  clock_start = time.monotonic()
+  clock = lambda: time.monotonic() - clock_start
+  uarts = [serial.Serial(port, baudrate=115200, timeout=0.1)
+           for port in FLAGS.ports]
+  captures = [DeviceCapture(port, uart, FLAGS.capture, every_n, hub, clock)
+              for port, uart in zip(FLAGS.ports, uarts)]
+  for capture in captures:
+    capture.start()
+
+  print('Recording... (Ctrl+C to stop)')
+  try:
+    while FLAGS.duration <= 0 or clock() < FLAGS.duration:
+      if not any(capture.is_alive() for capture in captures):
+        break
+      time.sleep(0.1)
+  except KeyboardInterrupt:
+    pass
+
+  for capture in captures:
+    capture.stop()
+  if server is not None:
+    server.stopping = True
+    server.shutdown()
+  for uart in uarts:
+    uart.close()
+
+  # Save what was captured even if some devices failed.
+  succeeded = []
+  for capture in captures:
+    if capture.error is not None:
+      print(f'Error on {capture.device}: {capture.error}')
+    if capture.decoder is not None:
+      succeeded.append(capture)
+      print(f'{capture.device}: {capture.decoder.num_messages} messages, '
+            f'{capture.decoder.num_missing_buffers} missing buffers')
+
+  if succeeded:
+    for file_name in write_stores(output_dir, succeeded, start_time):
+      print(f'Wrote {file_name}')
+  return 0 if len(succeeded) == len(captures) else 1
+
+
+if __name__ == '__main__':
+  app.run(main)
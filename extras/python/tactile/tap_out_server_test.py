@@ -0,0 +1,159 @@
+# Copyright 2022 Google LLC
+#
+# Licensed under the Apache License, Version 2.0 (the "License"); you may not
+# use this file except in compliance with the License. You may obtain a copy of
+# the License at
+#
+#     https://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+# WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+# License for the specific language governing permissions and limitations under
+# the License.
+
+"""Tests for tap_out_server."""
+
+import datetime
+import json
+import os.path
+import tempfile
+import threading
+import time
+import unittest
+
+import numpy as np
+
+from extras.python.phonetics import frame_store
+from extras.python.tactile import tap_out
+from extras.python.tactile import tap_out_server
+
+# Descriptors with build date 20220510 and one output, "Apple" of 4 int16s.
+DESCRIPTOR_DATA = bytes([94, 138, 52, 1, 1, 1]) + b'Apple'.ljust(
+    tap_out.MAX_NAME_LENGTH, b'\x00') + bytes([tap_out.DType.INT16.value, 4,
+                                               0, 0])
+
+
+class FakeUart:
+  """A fake UART serial object, thread safe, that reads in small chunks."""
+
+  def __init__(self, data: bytes):
+    self._lock = threading.Lock()
+    self._data = data
+    self.data_written = b''
+
+  @property
+  def in_waiting(self) -> int:
+    with self._lock:
+      return min(len(self._data), 9)
+
+  def read(self, num_bytes: int = 1) -> bytes:
+    with self._lock:
+      result = self._data[:num_bytes]
+      self._data = self._data[num_bytes:]
+    if not result:
+      time.sleep(0.001)
+    return result
+
+  def is_drained(self) -> bool:
+    with self._lock:
+      return not self._data
+
+  def write(self, data: bytes) -> None:
+    self.data_written += data
+
+  def flush(self) -> None:
+    pass
+
+
+def make_device_data(apple: np.ndarray, sequences) -> bytes:
+  """Makes the bytes a device sends: descriptors, then capture ex messages."""
+  data = (tap_out.MARKER +
+          bytes([tap_out.OP_DESCRIPTORS, len(DESCRIPTOR_DATA)]) +
+          DESCRIPTOR_DATA)
+  for frame, sequence in zip(apple, sequences):
+    payload = bytes([sequence & 0xff, sequence >> 8, 0, 0, 1]) + frame.tobytes()
+    data += (tap_out.MARKER + bytes([tap_out.OP_CAPTURE_EX, len(payload)]) +
+             payload)
+  return data
+
+
+class TapOutServerTest(unittest.TestCase):
+
+  def test_capture_two_devices(self):
+    np.random.seed(0)
+    apple = [np.random.randint(-1000, 1000, size=(n, 4), dtype=np.int16)
+             for n in (5, 3)]
+    # Device 1 drops buffer 1.
+    uarts = [FakeUart(make_device_data(apple[0], range(5))),
+             FakeUart(make_device_data(apple[1], [0, 2, 3]))]
+    hub = tap_out_server.Hub()
+    live = hub.subscribe(devices=['dev0'])
+    captures = [
+        tap_out_server.DeviceCapture(f'dev{d}', uart, ['Apple'], None, hub,
+                                     clock=lambda: 1.0)
+        for d, uart in enumerate(uarts)]
+    for capture in captures:
+      capture.start()
+    deadline = time.monotonic() + 10.0
+    while (not all(uart.is_drained() for uart in uarts) and
+           time.monotonic() < deadline):
+      time.sleep(0.01)
+    for capture in captures:
+      capture.stop()
+      self.assertIsNone(capture.error)
+
+    # Capture was started with every_n = 1 for the Apple output.
+    self.assertTrue(uarts[0].data_written.endswith(
+        tap_out.MARKER + bytes([tap_out.OP_START_CAPTURE_EX, 2, 1, 1])))
+    times, index, data = captures[0].captured(0)
+    np.testing.assert_array_equal(index, np.arange(5))
+    np.testing.assert_array_equal(data, apple[0])
+    self.assertTrue(np.all(times <= 1.0))
+    _, index, data = captures[1].captured(0)
+    np.testing.assert_array_equal(index, [0, 2, 3])
+    np.testing.assert_array_equal(data, apple[1])
+    self.assertEqual(captures[1].decoder.num_missing_buffers, 1)
+
+    # The live subscriber got only dev0's buffers.
+    received = []
+    while not live.empty():
+      record = live.get()
+      self.assertEqual(record['device'], 'dev0')
+      self.assertEqual(record['output'], 'Apple')
+      received += record['values']
+    np.testing.assert_array_equal(received, apple[0])
+
+    with tempfile.TemporaryDirectory() as output_dir:
+      file_names = tap_out_server.write_stores(
+          output_dir, captures, datetime.datetime(2022, 5, 10))
+      self.assertEqual(file_names, [os.path.join(output_dir, 'Apple.fstore')])
+
+      store = frame_store.FrameStore(file_names[0])
+      self.assertEqual(store.num_utterances, 2)
+      self.assertEqual(store.num_channels, 2 + 4)
+      np.testing.assert_array_equal(store.utterance_offsets, [0, 5, 8])
+      np.testing.assert_array_equal(store.frames[5:, 1], [0, 2, 3])
+      np.testing.assert_array_equal(store.frames[5:, 2:], apple[1])
+      metadata = json.loads(store.metadata)
+      self.assertEqual(metadata['output'], 'Apple')
+      self.assertEqual(metadata['shape'], [4])
+      self.assertEqual([d['device'] for d in metadata['devices']],
+                       ['dev0', 'dev1'])
+      self.assertEqual(metadata['devices'][1]['num_missing_buffers'], 1)
+
+  def test_hub_drops_for_slow_subscriber(self):
+    hub = tap_out_server.Hub()
+    q = hub.subscribe(outputs=['Apple'])
+    for k in range(tap_out_server.SUBSCRIBER_QUEUE_SIZE + 10):
+      hub.publish({'device': 'dev0', 'output': 'Apple', 'index': [k]})
+      hub.publish({'device': 'dev0', 'output': 'Banana', 'index': [k]})
+    self.assertEqual(q.qsize(), tap_out_server.SUBSCRIBER_QUEUE_SIZE)
+    self.assertEqual(q.get()['output'], 'Apple')
+
+    hub.unsubscribe(q)
+    self.assertFalse(hub.has_subscribers())
+
+
+if __name__ == '__main__':
+  unittest.main()
@@ -155,6 +155,62 @@ class TapOutTest(unittest.TestCase):
     np.testing.assert_array_equal(
         captured['Apple'], apple.reshape(-1, 8))
 
+  def test_capture_ex(self):
+    np.random.seed(0)
+
+    uart = FakeUart()
+    uart.data_to_be_read = (
+        tap_out.MARKER +
+        bytes([tap_out.OP_DESCRIPTORS, len(TEST_DESCRIPTOR_DATA)]) +
+        TEST_DESCRIPTOR_DATA)
+
+    comm = tap_out.TapOut(uart)
+    descriptors, _ = comm.get_descriptors()
+
+    num = 7
+    cherry = np.random.randint(
+        1000000, size=(num + 1, 9),
+        dtype=descriptors['Chocolate cherr'].dtype.numpy_dtype)
+    apple = np.random.randn(
+        num + 1, 3, 8).astype(descriptors['Apple'].dtype.numpy_dtype)
+    # Simulate that the device dropped the message for buffer 3. The sequence
+    # starts near 2^16 to test unwrapping.
+    kept = [0, 1, 2, 4, 5, 6, 7]
+    for i in kept:
+      has_apple = i % 2 == 0
+      header = tap_out.CaptureExHeader(
+          sequence=(65532 + i) & 0xffff,
+          num_dropped=int(i > 3),
+          output_mask=3 if has_apple else 1)
+      payload = bytes([
+          header.sequence & 0xff, header.sequence >> 8,
+          header.num_dropped, 0, header.output_mask
+      ]) + cherry[i].tobytes()
+      if has_apple:
+        payload += apple[i].tobytes()
+      uart.data_to_be_read += (
+          tap_out.MARKER + bytes([tap_out.OP_CAPTURE_EX, len(payload)]) +
+          payload)
+    uart.data_written = b''
+
+    captured, stats = comm.capture_ex(
+        ['Chocolate cherr', 'Apple'], num, every_n=[1, 2])
+
+    self.assertEqual(uart.data_written,
+                     tap_out.MARKER +
+                     bytes([tap_out.OP_START_CAPTURE_EX, 4, 3, 1, 1, 2]) +
+                     tap_out.MARKER +
+                     bytes([tap_out.OP_HEARTBEAT, 0]))
+    self.assertEqual(uart.data_to_be_read, b'')
+    np.testing.assert_array_equal(stats.sequence['Chocolate cherr'],
+                                  [0, 1, 2, 4, 5, 6])
+    np.testing.assert_array_equal(stats.sequence['Apple'], [0, 2, 4, 6])
+    self.assertEqual(stats.num_dropped, 1)
+    np.testing.assert_array_equal(
+        captured['Chocolate cherr'], cherry[[0, 1, 2, 4, 5, 6]].reshape(-1))
+    np.testing.assert_array_equal(
+        captured['Apple'], apple[[0, 2, 4, 6]].reshape(-1, 8))
+
 
 if __name__ == '__main__':
   unittest.main()
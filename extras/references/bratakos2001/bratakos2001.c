@@ -22,6 +22,9 @@
 #include "src/dsp/butterworth.h"
 #include "src/dsp/math_constants.h"
 
+/* Max number of frames per block in Bratakos2001BatchProcessSamples(). */
+#define kBatchBlockFrames 64
+
 int Bratakos2001Init(Bratakos2001State* state, float sample_rate_hz) {
   if (state == NULL) {
     fprintf(stderr, "Bratakos2001Init: Null argument.\n");
@@ -82,3 +85,93 @@ void Bratakos2001ProcessSamples(Bratakos2001State* state,
     PhasorRotatorNext(&state->oscillator);
   }
 }
+
+Bratakos2001Batch* Bratakos2001BatchMake(float sample_rate_hz,
+                                         int num_streams) {
+  if (num_streams <= 0) {
+    fprintf(stderr, "Bratakos2001BatchMake: num_streams must be positive.\n");
+    return NULL;
+  }
+  Bratakos2001Batch* batch =
+      (Bratakos2001Batch*)malloc(sizeof(Bratakos2001Batch));
+  if (batch == NULL) { return NULL; }
+  BiquadFilterState* states =
+      (BiquadFilterState*)malloc(3 * num_streams * sizeof(BiquadFilterState));
+  batch->workspace =
+      (float*)malloc(kBatchBlockFrames * num_streams * sizeof(float));
+  if (states == NULL || batch->workspace == NULL ||
+      !Bratakos2001Init(&batch->shared, sample_rate_hz)) {
+    free(batch->workspace);
+    free(states);
+    free(batch);
+    return NULL;
+  }
+
+  batch->num_streams = num_streams;
+  batch->bpf_biquad_state[0] = states;
+  batch->bpf_biquad_state[1] = states + num_streams;
+  batch->envelope_biquad_state = states + 2 * num_streams;
+  int i;
+  for (i = 0; i < 3 * num_streams; ++i) {
+    BiquadFilterInitZero(&states[i]);
+  }
+  return batch;
+}
+
+void Bratakos2001BatchFree(Bratakos2001Batch* batch) {
+  if (batch != NULL) {
+    free(batch->workspace);
+    free(batch->bpf_biquad_state[0]);  /* Frees all states. */
+  }
+  free(batch);
+}
+
+void Bratakos2001BatchProcessSamples(Bratakos2001Batch* batch,
+                                     const float* input,
+                                     int num_frames,
+                                     float* output) {
+  const int num_streams = batch->num_streams;
+  Bratakos2001State* shared = &batch->shared;
+  float* workspace = batch->workspace;
+
+  while (num_frames > 0) {
+    int block_frames = num_frames;
+    if (block_frames > kBatchBlockFrames) { block_frames = kBatchBlockFrames; }
+    const int block_samples = block_frames * num_streams;
+
+    /* Bandpass filter. */
+    BiquadFilterProcessInterleavedBlock(
+        &shared->bpf_biquad_coeffs[0], batch->bpf_biquad_state[0],
+        num_streams, input, block_frames, workspace);
+    BiquadFilterProcessInterleavedBlock(
+        &shared->bpf_biquad_coeffs[1], batch->bpf_biquad_state[1],
+        num_streams, workspace, block_frames, workspace);
+
+    /* Full-wave rectification. */
+    int i;
+    for (i = 0; i < block_samples; ++i) {
+      workspace[i] = fabs(workspace[i]);
+    }
+
+    /* Lowpass filter to smooth the amplitude envelope. */
+    BiquadFilterProcessInterleavedBlock(
+        &shared->envelope_biquad_coeffs, batch->envelope_biquad_state,
+        num_streams, workspace, block_frames, workspace);
+
+    /* Modulate on the sinusoidal carrier, which is the same for all streams. */
+    const float* src = workspace;
+    for (i = 0; i < block_frames; ++i) {
+      const float carrier = PhasorRotatorSin(&shared->oscillator);
+      int s;
+      for (s = 0; s < num_streams; ++s) {
+        output[s] = src[s] * carrier;
+      }
+      src += num_streams;
+      output += num_streams;
+      PhasorRotatorNext(&shared->oscillator);
+    }
+
+    input += block_samples;
+    num_frames -= block_frames;
+  }
+}
@@ -23,6 +23,14 @@
  *
  * The method takes input audio and produces one channel of tactile output,
  * based on filtering and extracting an amplitude envelopes.
+ *
+ * For running the method over many recordings at once, e.g. comparative
+ * studies over a large corpus, `Bratakos2001Batch` processes many independent
+ * streams in lockstep. Streams are filtered four at a time with
+ * BiquadFilterProcessInterleavedBlock(), which is several times faster per
+ * stream than Bratakos2001ProcessSamples(), whose filters are bound by the
+ * latency of their recursions. Results match Bratakos2001ProcessSamples()
+ * exactly.
  */
 
 #ifndef AUDIO_TO_TACTILE_EXTRAS_REFERENCES_BRATAKOS2001_BRATAKOS2001_H_
@@ -57,6 +65,38 @@ void Bratakos2001ProcessSamples(Bratakos2001State* state,
                                 int num_samples,
                                 float* output);
 
+typedef struct {
+  /* Filter coefficients and carrier oscillator, shared by all streams. The
+   * filter states in `shared` are unused.
+   */
+  Bratakos2001State shared;
+  int num_streams;
+  /* Filter states, each an array of `num_streams` elements. */
+  BiquadFilterState* bpf_biquad_state[2];
+  BiquadFilterState* envelope_biquad_state;
+  /* Workspace for one block of all streams. */
+  float* workspace;
+} Bratakos2001Batch;
+
+/* Makes a batch of `num_streams` processors. The caller should free it when
+ * done with Bratakos2001BatchFree. Returns NULL on failure.
+ */
+Bratakos2001Batch* Bratakos2001BatchMake(float sample_rate_hz,
+                                         int num_streams);
+
+/* Frees a Bratakos2001Batch. */
+void Bratakos2001BatchFree(Bratakos2001Batch* batch);
+
+/* Processes `num_frames` frames of interleaved input with `num_streams`
+ * channels, where channel s is the input audio of stream s. The output has the
+ * same layout, with `num_frames * num_streams` samples, where channel s is the
+ * tactile output of stream s.
+ */
+void Bratakos2001BatchProcessSamples(Bratakos2001Batch* batch,
+                                     const float* input,
+                                     int num_frames,
+                                     float* output);
+
 #ifdef __cplusplus
 }  /* extern "C" */
 #endif
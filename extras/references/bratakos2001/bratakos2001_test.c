@@ -77,10 +77,61 @@ static void TestBasic(float sample_rate_hz) {
   free(input);
 }
 
+/* Bratakos2001Batch matches Bratakos2001ProcessSamples on each stream. */
+static void TestBatchMatchesSingle(int num_streams) {
+  printf("TestBatchMatchesSingle(%d)\n", num_streams);
+  srand(0);
+  const int kNumFrames = 1000;
+  float* input = (float*)CHECK_NOTNULL(
+      malloc(num_streams * kNumFrames * sizeof(float)));
+  float* output = (float*)CHECK_NOTNULL(
+      malloc(num_streams * kNumFrames * sizeof(float)));
+  float* expected = (float*)CHECK_NOTNULL(malloc(kNumFrames * sizeof(float)));
+  float* stream_input = (float*)CHECK_NOTNULL(
+      malloc(kNumFrames * sizeof(float)));
+  int i;
+  for (i = 0; i < num_streams * kNumFrames; ++i) {
+    input[i] = 0.5f * ((float) rand() / RAND_MAX - 0.5f);
+  }
+
+  Bratakos2001Batch* batch =
+      CHECK_NOTNULL(Bratakos2001BatchMake(16000.0f, num_streams));
+  /* Process in blocks of varying size. */
+  int start;
+  int block_size;
+  for (start = 0; start < kNumFrames; start += block_size) {
+    block_size = 1 + rand() % 150;
+    if (block_size > kNumFrames - start) { block_size = kNumFrames - start; }
+    Bratakos2001BatchProcessSamples(batch, input + num_streams * start,
+                                    block_size, output + num_streams * start);
+  }
+
+  int s;
+  for (s = 0; s < num_streams; ++s) {
+    Bratakos2001State state;
+    CHECK(Bratakos2001Init(&state, 16000.0f));
+    for (i = 0; i < kNumFrames; ++i) {
+      stream_input[i] = input[num_streams * i + s];
+    }
+    Bratakos2001ProcessSamples(&state, stream_input, kNumFrames, expected);
+    for (i = 0; i < kNumFrames; ++i) {
+      CHECK(output[num_streams * i + s] == expected[i]);
+    }
+  }
+
+  Bratakos2001BatchFree(batch);
+  free(stream_input);
+  free(expected);
+  free(output);
+  free(input);
+}
+
 int main(int argc, char** argv) {
   TestBasic(16000.0f);
   TestBasic(44100.0f);
   TestBasic(48000.0f);
+  TestBatchMatchesSingle(1);
+  TestBatchMatchesSingle(7);
 
   puts("PASS");
   return EXIT_SUCCESS;
@@ -0,0 +1,141 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "extras/references/taps/phoneme_table.h"
+
+#include <ctype.h>
+#include <string.h>
+
+const PhonemeTable* PhonemeTableByName(const char* name) {
+  /* Convert `name` to uppercase as in PhonemeCodeByName(). */
+  char phoneme[3];
+  int i;
+  for (i = 0; i < 3; ++i) {
+    if (!isalnum(name[i])) {
+      phoneme[i] = '\0';
+      break;
+    } else if (i < 2) {
+      phoneme[i] = toupper(name[i]);
+    } else {
+      return NULL; /* Name longer than 2 chars is invalid. */
+    }
+  }
+
+  for (i = 0; i < kPhonemeTablesSize; ++i) {
+    if (!strcmp(phoneme, kPhonemeTables[i].phoneme)) {
+      return &kPhonemeTables[i];
+    }
+  }
+  return NULL; /* Not found. */
+}
+
+/* Finds start of next phoneme or NULL in a comma-delimited phonemes string. */
+static const char* NextPhoneme(const char* phonemes) {
+  phonemes = strchr(phonemes, ',');
+  if (phonemes) {
+    ++phonemes;
+  } /* Increment past the comma. */
+  return phonemes;
+}
+
+int PhonemeTablePlayerStart(PhonemeTablePlayer* player,
+                            const char* phonemes,
+                            float spacing) {
+  const char* p;
+  for (p = phonemes; p; p = NextPhoneme(p)) {
+    if (PhonemeTableByName(p) == NULL) {
+      return 0;
+    }
+  }
+
+  player->next_phoneme = phonemes;
+  player->next_start_frame = 0;
+  player->spacing_frames = (int)(kPhonemeTableSampleRateHz * spacing);
+  player->num_voices = 0;
+  player->frame = 0;
+  return 1;
+}
+
+/* Adds the part of `voice` within frames [frame, frame + num_frames) to
+ * `output`.
+ */
+static void MixVoice(const PhonemeTableVoice* voice, int frame,
+                     int num_frames, float* output) {
+  const PhonemeTable* table = voice->table;
+  const float scale = table->scale;
+  const PhonemeTableSpan* span = kPhonemeTableSpans + table->first_span;
+  int s;
+  for (s = 0; s < table->num_spans; ++s, ++span) {
+    /* Find the overlap of the span with the block, relative to the block. */
+    int begin = voice->start_frame + span->start_frame - frame;
+    int end = begin + span->num_frames;
+    const int8_t* samples = kPhonemeTableSamples + span->offset;
+    if (begin < 0) {
+      samples -= begin;
+      begin = 0;
+    }
+    if (end > num_frames) {
+      end = num_frames;
+    }
+
+    float* dest = output + kPhonemeTableNumChannels * begin + span->channel;
+    int i;
+    for (i = begin; i < end; ++i, dest += kPhonemeTableNumChannels) {
+      *dest += scale * *samples++;
+    }
+  }
+}
+
+int PhonemeTablePlayerProcess(PhonemeTablePlayer* player,
+                              float* output,
+                              int num_frames) {
+  int i;
+  for (i = 0; i < kPhonemeTableNumChannels * num_frames; ++i) {
+    output[i] = 0.0f;
+  }
+  const int end_frame = player->frame + num_frames;
+
+  /* Schedule the phonemes that start before the end of this block. */
+  while (player->next_phoneme && player->next_start_frame < end_frame &&
+         player->num_voices < kPhonemeTablePlayerMaxVoices) {
+    PhonemeTableVoice* voice = &player->voices[player->num_voices++];
+    voice->table = PhonemeTableByName(player->next_phoneme);
+    voice->start_frame = player->next_start_frame;
+
+    player->next_start_frame += voice->table->num_frames +
+        player->spacing_frames;
+    /* Force nonnegative start, in case `spacing` is negative. */
+    if (player->next_start_frame < 0) {
+      player->next_start_frame = 0;
+    }
+    player->next_phoneme = NextPhoneme(player->next_phoneme);
+  }
+
+  const int playing = player->next_phoneme != NULL || player->num_voices > 0;
+  /* Mix the playing phonemes, and remove those that end in this block. */
+  int v = 0;
+  while (v < player->num_voices) {
+    const PhonemeTableVoice* voice = &player->voices[v];
+    MixVoice(voice, player->frame, num_frames, output);
+    if (voice->start_frame + voice->table->num_frames <= end_frame) {
+      player->voices[v] = player->voices[--player->num_voices];
+    } else {
+      ++v;
+    }
+  }
+
+  player->frame = end_frame;
+  return playing;
+}
@@ -0,0 +1,136 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * Precomputed phoneme code tables and a player that mixes them.
+ *
+ * GeneratePhonemeSignal() (phoneme_code.h) synthesizes the code signals with
+ * sin() and window evaluations for every sample of every channel. This library
+ * instead plays the codes from tables precomputed at kPhonemeTableSampleRateHz,
+ * so that long phoneme sequences can play on a microcontroller with little
+ * more than a copy-add per sample.
+ *
+ * Tables are compact: each phoneme stores only spans of its active channels,
+ * excluding leading, trailing, and long internal silences, as int8 samples
+ * with a per-phoneme scale factor. The tables in phoneme_table_data.c are
+ * generated from kPhonemeCodebook, and can be regenerated by running the unit
+ * test as
+ *
+ *   phoneme_table_test --print_tables
+ *
+ * Example use:
+ *   PhonemeTablePlayer player;
+ *   PhonemeTablePlayerStart(&player, "B,ER,D", 0.15f);
+ *   while (PhonemeTablePlayerProcess(&player, output, num_frames)) {
+ *     // Play `num_frames` frames of 24-channel `output` at
+ *     // kPhonemeTableSampleRateHz.
+ *   }
+ */
+
+#ifndef AUDIO_TO_TACTILE_EXTRAS_REFERENCES_TAPS_PHONEME_TABLE_H_
+#define AUDIO_TO_TACTILE_EXTRAS_REFERENCES_TAPS_PHONEME_TABLE_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Sample rate of the tables in Hz. */
+#define kPhonemeTableSampleRateHz 2000
+/* Number of channels, in Purdue's order as in phoneme_code.h. */
+#define kPhonemeTableNumChannels 24
+/* Max number of phonemes that can overlap in playback. */
+#define kPhonemeTablePlayerMaxVoices 4
+
+/* A span of `num_frames` samples on `channel` starting at `start_frame`
+ * relative to the start of the phoneme. The samples are
+ * kPhonemeTableSamples[offset], ..., kPhonemeTableSamples[offset +
+ * num_frames - 1].
+ */
+typedef struct {
+  int16_t channel;
+  int16_t start_frame;
+  int16_t num_frames;
+  int32_t offset;
+} PhonemeTableSpan;
+
+typedef struct {
+  /* Name of the phoneme, as in kPhonemeCodebook. */
+  const char* phoneme;
+  /* Duration of the code in frames. */
+  int num_frames;
+  /* Scale factor to convert int8 samples to float. */
+  float scale;
+  /* The spans are kPhonemeTableSpans[first_span], ...,
+   * kPhonemeTableSpans[first_span + num_spans - 1].
+   */
+  int first_span;
+  int num_spans;
+} PhonemeTable;
+
+/* Generated tables, defined in phoneme_table_data.c. */
+extern const PhonemeTable kPhonemeTables[];
+extern const int kPhonemeTablesSize;
+extern const PhonemeTableSpan kPhonemeTableSpans[];
+extern const int8_t kPhonemeTableSamples[];
+
+/* Finds a PhonemeTable by name, interpreted as in PhonemeCodeByName(). Returns
+ * null if not found.
+ */
+const PhonemeTable* PhonemeTableByName(const char* name);
+
+/* A phoneme playing in PhonemeTablePlayer. */
+typedef struct {
+  const PhonemeTable* table;
+  /* Frame where the phoneme starts, relative to the start of playback. */
+  int start_frame;
+} PhonemeTableVoice;
+
+typedef struct {
+  /* Next phoneme to schedule in the comma-delimited string, or null. */
+  const char* next_phoneme;
+  /* Frame where the next phoneme starts. */
+  int next_start_frame;
+  /* Frames of silence between phonemes, may be negative. */
+  int spacing_frames;
+  /* Phonemes currently playing. */
+  PhonemeTableVoice voices[kPhonemeTablePlayerMaxVoices];
+  int num_voices;
+  /* Number of frames played so far. */
+  int frame;
+} PhonemeTablePlayer;
+
+/* Starts playing `phonemes`, a comma-delimited string of phonemes in Purdue's
+ * notation, with `spacing` seconds between them as in GeneratePhonemeSignal().
+ * The string is read during playback and must remain valid until then. Returns
+ * 1 on success, 0 if `phonemes` is invalid.
+ */
+int /*bool*/ PhonemeTablePlayerStart(PhonemeTablePlayer* player,
+                                     const char* phonemes,
+                                     float spacing);
+
+/* Writes the next `num_frames` frames of 24-channel output in interleaved
+ * order, mixing the phoneme tables with copy-add. After the sequence ends, the
+ * output is zero. Returns 1 if this block is part of the sequence, or 0 if the
+ * sequence had already ended and `output` is all zero.
+ */
+int /*bool*/ PhonemeTablePlayerProcess(PhonemeTablePlayer* player,
+                                       float* output,
+                                       int num_frames);
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif
+#endif  /* AUDIO_TO_TACTILE_EXTRAS_REFERENCES_TAPS_PHONEME_TABLE_H_ */
@@ -0,0 +1,7656 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * Precomputed phoneme code tables, generated by running
+ *   phoneme_table_test --print_tables
+ * Do not edit by hand.
+ */
+
+#include "extras/references/taps/phoneme_table.h"
+
+const int8_t kPhonemeTableSamples[87946] = {
+    2, -3, -23, -38, -4, 73, 112, 46, -68, -127, -81, 32,
+    118, 107, 8, -98, -123, -47, 68, 127, 81, -32, -118, -107,
+    -8, 98, 123, 47, -68, -127, -81, 32, 118, 107, 8, -98,
+    -123, -47, 68, 127, 81, -32, -118, -107, -8, 98, 123, 47,
+    -68, -127, -81, 32, 118, 107, 8, -94, -102, -30, 30, 33,
+    10, -1, -1, 2, -3, -23, -38, -4, 73, 112, 46, -68,
+    -127, -81, 32, 118, 107, 8, -98, -123, -47, 68, 127, 81,
+    -32, -118, -107, -8, 98, 123, 47, -68, -127, -81, 32, 118,
+    107, 8, -98, -123, -47, 68, 127, 81, -32, -118, -107, -8,
+    98, 123, 47, -68, -127, -81, 32, 118, 107, 8, -94, -102,
+    -30, 30, 33, 10, -1, -1, 1, 2, -9, -32, -32, 25,
+    99, 98, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -110, -78, 0, 37, 24, 3, -2, -1, 1, 2,
+    -9, -32, -32, 25, 99, 98, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -110, -78, 0, 37, 24, 3,
+    -2, -1, 1, 2, -9, -32, -32, 25, 99, 98, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -110, -78,
+    0, 37, 24, 3, -2, -1, 1, 2, -9, -32, -32, 25,
+    99, 98, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -110, -78, 0, 37, 24, 3, -2, -1, 1, 2,
+    -5, -27, -36, 9, 87, 107, 24, -87, -126, -61, 54, 125,
+    93, -16, -111, -115, -24, 87, 126, 61, -54, -125, -93, 16,
+    111, 115, 24, -87, -126, -61, 54, 125, 93, -16, -111, -115,
+    -24, 87, 126, 61, -54, -125, -93, 16, 111, 115, 24, -87,
+    -126, -61, 54, 125, 93, -16, -104, -91, -14, 35, 29, 6,
+    -2, -1, 1, 2, -5, -27, -36, 9, 87, 107, 24, -87,
+    -126, -61, 54, 125, 93, -16, -111, -115, -24, 87, 126, 61,
+    -54, -125, -93, 16, 111, 115, 24, -87, -126, -61, 54, 125,
+    93, -16, -111, -115, -24, 87, 126, 61, -54, -125, -93, 16,
+    111, 115, 24, -87, -126, -61, 54, 125, 93, -16, -104, -91,
+    -14, 35, 29, 6, -2, -1, 1, 2, -9, -32, -32, 25,
+    99, 98, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -110, -78, 0, 37, 24, 3, -2, -1, 1, 2,
+    -9, -32, -32, 25, 99, 98, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -110, -78, 0, 37, 24, 3,
+    -2, -1, 2, -1, -18, -37, -16, 57, 112, 67, -47, -123,
+    -98, 8, 107, 118, 32, -81, -127, -68, 47, 123, 98, -8,
+    -107, -118, -32, 81, 127, 68, -47, -123, -98, 8, 107, 118,
+    32, -81, -127, -68, 47, 123, 98, -8, -107, -118, -32, 81,
+    127, 68, -47, -123, -98, 8, 107, 118, 32, -79, -109, -46,
+    22, 36, 14, 0, -2, 2, -1, -18, -37, -16, 57, 112,
+    67, -47, -123, -98, 8, 107, 118, 32, -81, -127, -68, 47,
+    123, 98, -8, -107, -118, -32, 81, 127, 68, -47, -123, -98,
+    8, 107, 118, 32, -81, -127, -68, 47, 123, 98, -8, -107,
+    -118, -32, 81, 127, 68, -47, -123, -98, 8, 107, 118, 32,
+    -79, -109, -46, 22, 36, 14, 0, -2, 3, 10, 26, 49,
+    78, 104, 120, 121, 111, 98, 81, 61, 39, 16, -8, -32,
+    -54, -75, -93, -107, -118, -125, -127, -125, -118, -107, -93, -75,
+    -54, -32, -8, 16, 39, 61, 81, 98, 111, 121, 126, 127,
+    123, 115, 103, 87, 68, 47, 24, 0, -24, -47, -68, -87,
+    -103, -115, -123, -127, -126, -121, -111, -98, -81, -61, -39, -16,
+    8, 32, 54, 75, 93, 107, 118, 125, 127, 125, 118, 107,
+    93, 75, 54, 32, 8, -16, -39, -61, -81, -98, -111, -121,
+    -126, -127, -123, -115, -103, -87, -68, -47, -24, 0, 24, 47,
+    68, 87, 103, 115, 123, 127, 126, 121, 111, 98, 81, 61,
+    39, 16, -8, -32, -54, -75, -93, -107, -118, -122, -111, -87,
+    -59, -33, -15, -5, -1, 3, 10, 26, 49, 78, 104, 120,
+    121, 111, 98, 81, 61, 39, 16, -8, -32, -54, -75, -93,
+    -107, -118, -125, -127, -125, -118, -107, -93, -75, -54, -32, -8,
+    16, 39, 61, 81, 98, 111, 121, 126, 127, 123, 115, 103,
+    87, 68, 47, 24, 0, -24, -47, -68, -87, -103, -115, -123,
+    -127, -126, -121, -111, -98, -81, -61, -39, -16, 8, 32, 54,
+    75, 93, 107, 118, 125, 127, 125, 118, 107, 93, 75, 54,
+    32, 8, -16, -39, -61, -81, -98, -111, -121, -126, -127, -123,
+    -115, -103, -87, -68, -47, -24, 0, 24, 47, 68, 87, 103,
+    115, 123, 127, 126, 121, 111, 98, 81, 61, 39, 16, -8,
+    -32, -54, -75, -93, -107, -118, -122, -111, -87, -59, -33, -15,
+    -5, -1, 2, 8, 22, 44, 72, 99, 118, 122, 114, 101,
+    85, 65, 44, 21, -3, -27, -50, -71, -89, -105, -116, -124,
+    -127, -126, -120, -110, -96, -78, -58, -36, -13, 11, 35, 57,
+    77, 95, 109, 119, 125, 127, 124, 117, 105, 90, 72, 51,
+    28, 5, -19, -42, -64, -83, -100, -113, -122, -126, -127, -122,
+    -114, -101, -85, -65, -44, -21, 3, 27, 50, 71, 89, 105,
+    116, 124, 127, 126, 120, 110, 96, 78, 58, 36, 13, -11,
+    -35, -57, -77, -95, -109, -119, -125, -127, -124, -117, -105, -90,
+    -72, -51, -28, -5, 19, 42, 64, 83, 100, 113, 122, 126,
+    127, 122, 114, 101, 85, 65, 44, 21, -3, -27, -50, -71,
+    -89, -105, -116, -122, -114, -92, -64, -37, -18, -6, -1, 2,
+    8, 22, 44, 72, 99, 118, 122, 114, 101, 85, 65, 44,
+    21, -3, -27, -50, -71, -89, -105, -116, -124, -127, -126, -120,
+    -110, -96, -78, -58, -36, -13, 11, 35, 57, 77, 95, 109,
+    119, 125, 127, 124, 117, 105, 90, 72, 51, 28, 5, -19,
+    -42, -64, -83, -100, -113, -122, -126, -127, -122, -114, -101, -85,
+    -65, -44, -21, 3, 27, 50, 71, 89, 105, 116, 124, 127,
+    126, 120, 110, 96, 78, 58, 36, 13, -11, -35, -57, -77,
+    -95, -109, -119, -125, -127, -124, -117, -105, -90, -72, -51, -28,
+    -5, 19, 42, 64, 83, 100, 113, 122, 126, 127, 122, 114,
+    101, 85, 65, 44, 21, -3, -27, -50, -71, -89, -105, -116,
+    -122, -114, -92, -64, -37, -18, -6, -1, 1, 7, 19, 39,
+    66, 94, 115, 122, 116, 104, 88, 69, 48, 25, 2, -22,
+    -45, -67, -86, -102, -114, -123, -127, -126, -121, -112, -99, -82,
+    -63, -41, -17, 6, 30, 53, 73, 91, 106, 117, 124, 127,
+    125, 119, 108, 94, 76, 56, 33, 10, -14, -38, -60, -80,
+    -97, -111, -120, -126, -127, -123, -116, -104, -88, -69, -48, -25,
+    -2, 22, 45, 67, 86, 102, 114, 123, 127, 126, 121, 112,
+    99, 82, 63, 41, 17, -6, -30, -53, -73, -91, -106, -117,
+    -124, -127, -125, -119, -108, -94, -76, -56, -33, -10, 14, 38,
+    60, 80, 97, 111, 120, 126, 127, 123, 116, 104, 88, 69,
+    48, 25, 2, -22, -45, -67, -86, -102, -114, -122, -117, -98,
+    -70, -42, -21, -8, -2, 1, 7, 19, 39, 66, 94, 115,
+    122, 116, 104, 88, 69, 48, 25, 2, -22, -45, -67, -86,
+    -102, -114, -123, -127, -126, -121, -112, -99, -82, -63, -41, -17,
+    6, 30, 53, 73, 91, 106, 117, 124, 127, 125, 119, 108,
+    94, 76, 56, 33, 10, -14, -38, -60, -80, -97, -111, -120,
+    -126, -127, -123, -116, -104, -88, -69, -48, -25, -2, 22, 45,
+    67, 86, 102, 114, 123, 127, 126, 121, 112, 99, 82, 63,
+    41, 17, -6, -30, -53, -73, -91, -106, -117, -124, -127, -125,
+    -119, -108, -94, -76, -56, -33, -10, 14, 38, 60, 80, 97,
+    111, 120, 126, 127, 123, 116, 104, 88, 69, 48, 25, 2,
+    -22, -45, -67, -86, -102, -114, -122, -117, -98, -70, -42, -21,
+    -8, -2, 3, 10, 26, 49, 78, 104, 120, 121, 111, 98,
+    81, 61, 39, 16, -8, -32, -54, -75, -93, -107, -118, -125,
+    -127, -125, -118, -107, -93, -75, -54, -32, -8, 16, 39, 61,
+    81, 98, 111, 121, 126, 127, 123, 115, 103, 87, 68, 47,
+    24, 0, -24, -47, -68, -87, -103, -115, -123, -127, -126, -121,
+    -111, -98, -81, -61, -39, -16, 8, 32, 54, 75, 93, 107,
+    118, 125, 127, 125, 118, 107, 93, 75, 54, 32, 8, -16,
+    -39, -61, -81, -98, -111, -121, -126, -127, -123, -115, -103, -87,
+    -68, -47, -24, 0, 24, 47, 68, 87, 103, 115, 123, 127,
+    126, 121, 111, 98, 81, 61, 39, 16, -8, -32, -54, -75,
+    -93, -107, -118, -122, -111, -87, -59, -33, -15, -5, -1, 3,
+    10, 26, 49, 78, 104, 120, 121, 111, 98, 81, 61, 39,
+    16, -8, -32, -54, -75, -93, -107, -118, -125, -127, -125, -118,
+    -107, -93, -75, -54, -32, -8, 16, 39, 61, 81, 98, 111,
+    121, 126, 127, 123, 115, 103, 87, 68, 47, 24, 0, -24,
+    -47, -68, -87, -103, -115, -123, -127, -126, -121, -111, -98, -81,
+    -61, -39, -16, 8, 32, 54, 75, 93, 107, 118, 125, 127,
+    125, 118, 107, 93, 75, 54, 32, 8, -16, -39, -61, -81,
+    -98, -111, -121, -126, -127, -123, -115, -103, -87, -68, -47, -24,
+    0, 24, 47, 68, 87, 103, 115, 123, 127, 126, 121, 111,
+    98, 81, 61, 39, 16, -8, -32, -54, -75, -93, -107, -118,
+    -122, -111, -87, -59, -33, -15, -5, -1, 2, 8, 22, 44,
+    72, 99, 118, 122, 114, 101, 85, 65, 44, 21, -3, -27,
+    -50, -71, -89, -105, -116, -124, -127, -126, -120, -110, -96, -78,
+    -58, -36, -13, 11, 35, 57, 77, 95, 109, 119, 125, 127,
+    124, 117, 105, 90, 72, 51, 28, 5, -19, -42, -64, -83,
+    -100, -113, -122, -126, -127, -122, -114, -101, -85, -65, -44, -21,
+    3, 27, 50, 71, 89, 105, 116, 124, 127, 126, 120, 110,
+    96, 78, 58, 36, 13, -11, -35, -57, -77, -95, -109, -119,
+    -125, -127, -124, -117, -105, -90, -72, -51, -28, -5, 19, 42,
+    64, 83, 100, 113, 122, 126, 127, 122, 114, 101, 85, 65,
+    44, 21, -3, -27, -50, -71, -89, -105, -116, -122, -114, -92,
+    -64, -37, -18, -6, -1, 2, 8, 22, 44, 72, 99, 118,
+    122, 114, 101, 85, 65, 44, 21, -3, -27, -50, -71, -89,
+    -105, -116, -124, -127, -126, -120, -110, -96, -78, -58, -36, -13,
+    11, 35, 57, 77, 95, 109, 119, 125, 127, 124, 117, 105,
+    90, 72, 51, 28, 5, -19, -42, -64, -83, -100, -113, -122,
+    -126, -127, -122, -114, -101, -85, -65, -44, -21, 3, 27, 50,
+    71, 89, 105, 116, 124, 127, 126, 120, 110, 96, 78, 58,
+    36, 13, -11, -35, -57, -77, -95, -109, -119, -125, -127, -124,
+    -117, -105, -90, -72, -51, -28, -5, 19, 42, 64, 83, 100,
+    113, 122, 126, 127, 122, 114, 101, 85, 65, 44, 21, -3,
+    -27, -50, -71, -89, -105, -116, -122, -114, -92, -64, -37, -18,
+    -6, -1, 1, 5, 15, 34, 60, 89, 112, 122, 117, 106,
+    91, 73, 53, 30, 6, -17, -41, -63, -82, -99, -112, -121,
+    -126, -127, -123, -114, -102, -86, -67, -45, -22, 2, 25, 48,
+    69, 88, 104, 116, 123, 127, 126, 120, 111, 97, 80, 60,
+    38, 14, -10, -33, -56, -76, -94, -108, -119, -125, -127, -124,
+    -117, -106, -91, -73, -53, -30, -6, 18, 41, 63, 82, 99,
+    112, 121, 126, 127, 123, 114, 102, 86, 67, 45, 22, -2,
+    -25, -48, -69, -88, -104, -116, -123, -127, -126, -120, -111, -97,
+    -80, -60, -38, -14, 10, 33, 56, 76, 94, 108, 119, 125,
+    127, 124, 117, 106, 91, 73, 53, 30, 6, -17, -41, -63,
+    -82, -99, -112, -121, -119, -102, -76, -48, -24, -10, -3, 1,
+    5, 15, 34, 60, 89, 112, 122, 117, 106, 91, 73, 53,
+    30, 6, -17, -41, -63, -82, -99, -112, -121, -126, -127, -123,
+    -114, -102, -86, -67, -45, -22, 2, 25, 48, 69, 88, 104,
+    116, 123, 127, 126, 120, 111, 97, 80, 60, 38, 14, -10,
+    -33, -56, -76, -94, -108, -119, -125, -127, -124, -117, -106, -91,
+    -73, -53, -30, -6, 18, 41, 63, 82, 99, 112, 121, 126,
+    127, 123, 114, 102, 86, 67, 45, 22, -2, -25, -48, -69,
+    -88, -104, -116, -123, -127, -126, -120, -111, -97, -80, -60, -38,
+    -14, 10, 33, 56, 76, 94, 108, 119, 125, 127, 124, 117,
+    106, 91, 73, 53, 30, 6, -17, -41, -63, -82, -99, -112,
+    -121, -119, -102, -76, -48, -24, -10, -3, 2, -3, -23, -38,
+    -4, 73, 112, 46, -68, -127, -81, 32, 118, 107, 8, -98,
+    -123, -47, 68, 127, 81, -32, -118, -107, -8, 98, 123, 47,
+    -68, -127, -81, 32, 118, 107, 8, -98, -123, -47, 68, 127,
+    81, -32, -118, -107, -8, 98, 123, 47, -68, -127, -81, 32,
+    118, 107, 8, -94, -102, -30, 30, 33, 10, -1, -1, 2,
+    -3, -23, -38, -4, 73, 112, 46, -68, -127, -81, 32, 118,
+    107, 8, -98, -123, -47, 68, 127, 81, -32, -118, -107, -8,
+    98, 123, 47, -68, -127, -81, 32, 118, 107, 8, -98, -123,
+    -47, 68, 127, 81, -32, -118, -107, -8, 98, 123, 47, -68,
+    -127, -81, 32, 118, 107, 8, -94, -102, -30, 30, 33, 10,
+    -1, -1, 1, 2, -9, -32, -32, 25, 99, 98, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -110, -78,
+    0, 37, 24, 3, -2, -1, 1, 2, -9, -32, -32, 25,
+    99, 98, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -110, -78, 0, 37, 24, 3, -2, -1, 1, 2,
+    -9, -32, -32, 25, 99, 98, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -110, -78, 0, 37, 24, 3,
+    -2, -1, 1, 2, -9, -32, -32, 25, 99, 98, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -110, -78,
+    0, 37, 24, 3, -2, -1, 1, 2, -5, -27, -36, 9,
+    87, 107, 24, -87, -126, -61, 54, 125, 93, -16, -111, -115,
+    -24, 87, 126, 61, -54, -125, -93, 16, 111, 115, 24, -87,
+    -126, -61, 54, 125, 93, -16, -111, -115, -24, 87, 126, 61,
+    -54, -125, -93, 16, 111, 115, 24, -87, -126, -61, 54, 125,
+    93, -16, -104, -91, -14, 35, 29, 6, -2, -1, 1, 2,
+    -5, -27, -36, 9, 87, 107, 24, -87, -126, -61, 54, 125,
+    93, -16, -111, -115, -24, 87, 126, 61, -54, -125, -93, 16,
+    111, 115, 24, -87, -126, -61, 54, 125, 93, -16, -111, -115,
+    -24, 87, 126, 61, -54, -125, -93, 16, 111, 115, 24, -87,
+    -126, -61, 54, 125, 93, -16, -104, -91, -14, 35, 29, 6,
+    -2, -1, 1, 2, -9, -32, -32, 25, 99, 98, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -110, -78,
+    0, 37, 24, 3, -2, -1, 1, 2, -9, -32, -32, 25,
+    99, 98, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -110, -78, 0, 37, 24, 3, -2, -1, 2, -1,
+    -18, -37, -16, 57, 112, 67, -47, -123, -98, 8, 107, 118,
+    32, -81, -127, -68, 47, 123, 98, -8, -107, -118, -32, 81,
+    127, 68, -47, -123, -98, 8, 107, 118, 32, -81, -127, -68,
+    47, 123, 98, -8, -107, -118, -32, 81, 127, 68, -47, -123,
+    -98, 8, 107, 118, 32, -79, -109, -46, 22, 36, 14, 0,
+    -2, 2, -1, -18, -37, -16, 57, 112, 67, -47, -123, -98,
+    8, 107, 118, 32, -81, -127, -68, 47, 123, 98, -8, -107,
+    -118, -32, 81, 127, 68, -47, -123, -98, 8, 107, 118, 32,
+    -81, -127, -68, 47, 123, 98, -8, -107, -118, -32, 81, 127,
+    68, -47, -123, -98, 8, 107, 118, 32, -79, -109, -46, 22,
+    36, 14, 0, -2, 1, 1, -7, -26, -27, 22, 89, 90,
+    0, -98, -117, -39, 74, 127, 75, -39, -121, -102, 0, 100,
+    116, 37, -69, -115, -66, 34, 100, 82, 0, -76, -86, -27,
+    48, 78, 44, -22, -64, -51, 0, 46, 51, 16, -29, -47,
+    -27, 14, 41, 35, 0, -35, -41, -14, 27, 47, 29, -16,
+    -51, -46, 0, 51, 64, 22, -44, -78, -48, 27, 86, 76,
+    0, -82, -100, -34, 66, 115, 69, -37, -116, -100, 0, 102,
+    121, 39, -75, -127, -74, 39, 117, 98, 0, -90, -89, -22,
+    27, 26, 7, -1, -1, 1, 1, -7, -26, -27, 22, 89,
+    90, 0, -98, -117, -39, 74, 127, 75, -39, -121, -102, 0,
+    100, 116, 37, -69, -115, -66, 34, 100, 82, 0, -76, -86,
+    -27, 48, 78, 44, -22, -64, -51, 0, 46, 51, 16, -29,
+    -47, -27, 14, 41, 35, 0, -35, -41, -14, 27, 47, 29,
+    -16, -51, -46, 0, 51, 64, 22, -44, -78, -48, 27, 86,
+    76, 0, -82, -100, -34, 66, 115, 69, -37, -116, -100, 0,
+    102, 121, 39, -75, -127, -74, 39, 117, 98, 0, -90, -89,
+    -22, 27, 26, 7, -1, -1, 1, 1, -7, -26, -27, 22,
+    89, 90, 0, -98, -117, -39, 74, 127, 75, -39, -121, -102,
+    0, 100, 116, 37, -69, -115, -66, 34, 100, 82, 0, -76,
+    -86, -27, 48, 78, 44, -22, -64, -51, 0, 46, 51, 16,
+    -29, -47, -27, 14, 41, 35, 0, -35, -41, -14, 27, 47,
+    29, -16, -51, -46, 0, 51, 64, 22, -44, -78, -48, 27,
+    86, 76, 0, -82, -100, -34, 66, 115, 69, -37, -116, -100,
+    0, 102, 121, 39, -75, -127, -74, 39, 117, 98, 0, -90,
+    -89, -22, 27, 26, 7, -1, -1, 1, 1, -7, -26, -27,
+    22, 89, 90, 0, -98, -117, -39, 74, 127, 75, -39, -121,
+    -102, 0, 100, 116, 37, -69, -115, -66, 34, 100, 82, 0,
+    -76, -86, -27, 48, 78, 44, -22, -64, -51, 0, 46, 51,
+    16, -29, -47, -27, 14, 41, 35, 0, -35, -41, -14, 27,
+    47, 29, -16, -51, -46, 0, 51, 64, 22, -44, -78, -48,
+    27, 86, 76, 0, -82, -100, -34, 66, 115, 69, -37, -116,
+    -100, 0, 102, 121, 39, -75, -127, -74, 39, 117, 98, 0,
+    -90, -89, -22, 27, 26, 7, -1, -1, 1, 1, -7, -26,
+    -27, 22, 89, 90, 0, -98, -117, -39, 74, 127, 75, -39,
+    -121, -102, 0, 100, 116, 37, -69, -115, -66, 34, 100, 82,
+    0, -76, -86, -27, 48, 78, 44, -22, -64, -51, 0, 46,
+    51, 16, -29, -47, -27, 14, 41, 35, 0, -35, -41, -14,
+    27, 47, 29, -16, -51, -46, 0, 51, 64, 22, -44, -78,
+    -48, 27, 86, 76, 0, -82, -100, -34, 66, 115, 69, -37,
+    -116, -100, 0, 102, 121, 39, -75, -127, -74, 39, 117, 98,
+    0, -90, -89, -22, 27, 26, 7, -1, -1, 1, 1, -7,
+    -26, -27, 22, 89, 90, 0, -98, -117, -39, 74, 127, 75,
+    -39, -121, -102, 0, 100, 116, 37, -69, -115, -66, 34, 100,
+    82, 0, -76, -86, -27, 48, 78, 44, -22, -64, -51, 0,
+    46, 51, 16, -29, -47, -27, 14, 41, 35, 0, -35, -41,
+    -14, 27, 47, 29, -16, -51, -46, 0, 51, 64, 22, -44,
+    -78, -48, 27, 86, 76, 0, -82, -100, -34, 66, 115, 69,
+    -37, -116, -100, 0, 102, 121, 39, -75, -127, -74, 39, 117,
+    98, 0, -90, -89, -22, 27, 26, 7, -1, -1, 1, 1,
+    -7, -26, -27, 22, 89, 90, 0, -98, -117, -39, 74, 127,
+    75, -39, -121, -102, 0, 100, 116, 37, -69, -115, -66, 34,
+    100, 82, 0, -76, -86, -27, 48, 78, 44, -22, -64, -51,
+    0, 46, 51, 16, -29, -47, -27, 14, 41, 35, 0, -35,
+    -41, -14, 27, 47, 29, -16, -51, -46, 0, 51, 64, 22,
+    -44, -78, -48, 27, 86, 76, 0, -82, -100, -34, 66, 115,
+    69, -37, -116, -100, 0, 102, 121, 39, -75, -127, -74, 39,
+    117, 98, 0, -90, -89, -22, 27, 26, 7, -1, -1, 1,
+    1, -7, -26, -27, 22, 89, 90, 0, -98, -117, -39, 74,
+    127, 75, -39, -121, -102, 0, 100, 116, 37, -69, -115, -66,
+    34, 100, 82, 0, -76, -86, -27, 48, 78, 44, -22, -64,
+    -51, 0, 46, 51, 16, -29, -47, -27, 14, 41, 35, 0,
+    -35, -41, -14, 27, 47, 29, -16, -51, -46, 0, 51, 64,
+    22, -44, -78, -48, 27, 86, 76, 0, -82, -100, -34, 66,
+    115, 69, -37, -116, -100, 0, 102, 121, 39, -75, -127, -74,
+    39, 117, 98, 0, -90, -89, -22, 27, 26, 7, -1, -1,
+    1, 1, -7, -26, -27, 22, 89, 90, 0, -98, -117, -39,
+    74, 127, 75, -39, -121, -102, 0, 100, 116, 37, -69, -115,
+    -66, 34, 100, 82, 0, -76, -86, -27, 48, 78, 44, -22,
+    -64, -51, 0, 46, 51, 16, -29, -47, -27, 14, 41, 35,
+    0, -35, -41, -14, 27, 47, 29, -16, -51, -46, 0, 51,
+    64, 22, -44, -78, -48, 27, 86, 76, 0, -82, -100, -34,
+    66, 115, 69, -37, -116, -100, 0, 102, 121, 39, -75, -127,
+    -74, 39, 117, 98, 0, -95, -109, -34, 63, 104, 59, -30,
+    -88, -72, 0, 66, 73, 23, -41, -66, -37, 18, 53, 43,
+    0, -39, -44, -14, 26, 43, 25, -13, -41, -35, 0, 37,
+    45, 15, -31, -55, -34, 19, 61, 55, 0, -61, -76, -26,
+    52, 92, 56, -31, -98, -86, 0, 92, 110, 37, -71, -123,
+    -73, 39, 121, 103, 0, -103, -121, -39, 73, 123, 71, -37,
+    -110, -92, 0, 86, 98, 31, -56, -92, -52, 26, 76, 61,
+    0, -55, -61, -19, 34, 55, 31, -15, -45, -37, 0, 35,
+    41, 13, -25, -43, -26, 14, 44, 39, 0, -43, -53, -18,
+    37, 66, 41, -23, -73, -66, 0, 72, 88, 30, -59, -104,
+    -63, 34, 109, 95, 0, -98, -117, -39, 74, 127, 75, -39,
+    -121, -102, 0, 100, 116, 37, -69, -115, -66, 34, 100, 82,
+    0, -76, -86, -27, 48, 78, 44, -22, -64, -51, 0, 46,
+    51, 16, -29, -47, -27, 14, 41, 35, 0, -35, -41, -14,
+    27, 47, 29, -16, -51, -46, 0, 51, 64, 22, -44, -78,
+    -48, 27, 86, 76, 0, -78, -82, -21, 28, 29, 8, -2,
+    -1, 1, 1, -7, -26, -27, 22, 89, 90, 0, -98, -117,
+    -39, 74, 127, 75, -39, -121, -102, 0, 100, 116, 37, -69,
+    -115, -66, 34, 100, 82, 0, -76, -86, -27, 48, 78, 44,
+    -22, -64, -51, 0, 46, 51, 16, -29, -47, -27, 14, 41,
+    35, 0, -35, -41, -14, 27, 47, 29, -16, -51, -46, 0,
+    51, 64, 22, -44, -78, -48, 27, 86, 76, 0, -82, -100,
+    -34, 66, 115, 69, -37, -116, -100, 0, 102, 121, 39, -75,
+    -127, -74, 39, 117, 98, 0, -95, -109, -34, 63, 104, 59,
+    -30, -88, -72, 0, 66, 73, 23, -41, -66, -37, 18, 53,
+    43, 0, -39, -44, -14, 26, 43, 25, -13, -41, -35, 0,
+    37, 45, 15, -31, -55, -34, 19, 61, 55, 0, -61, -76,
+    -26, 52, 92, 56, -31, -98, -86, 0, 92, 110, 37, -71,
+    -123, -73, 39, 121, 103, 0, -103, -121, -39, 73, 123, 71,
+    -37, -110, -92, 0, 86, 98, 31, -56, -92, -52, 26, 76,
+    61, 0, -55, -61, -19, 34, 55, 31, -15, -45, -37, 0,
+    35, 41, 13, -25, -43, -26, 14, 44, 39, 0, -43, -53,
+    -18, 37, 66, 41, -23, -73, -66, 0, 72, 88, 30, -59,
+    -104, -63, 34, 109, 95, 0, -98, -117, -39, 74, 127, 75,
+    -39, -121, -102, 0, 100, 116, 37, -69, -115, -66, 34, 100,
+    82, 0, -76, -86, -27, 48, 78, 44, -22, -64, -51, 0,
+    46, 51, 16, -29, -47, -27, 14, 41, 35, 0, -35, -41,
+    -14, 27, 47, 29, -16, -51, -46, 0, 51, 64, 22, -44,
+    -78, -48, 27, 86, 76, 0, -78, -82, -21, 28, 29, 8,
+    -2, -1, 1, 1, -7, -26, -27, 22, 89, 90, 0, -98,
+    -117, -39, 74, 127, 75, -39, -121, -102, 0, 100, 116, 37,
+    -69, -115, -66, 34, 100, 82, 0, -76, -86, -27, 48, 78,
+    44, -22, -64, -51, 0, 46, 51, 16, -29, -47, -27, 14,
+    41, 35, 0, -35, -41, -14, 27, 47, 29, -16, -51, -46,
+    0, 51, 64, 22, -44, -78, -48, 27, 86, 76, 0, -82,
+    -100, -34, 66, 115, 69, -37, -116, -100, 0, 102, 121, 39,
+    -75, -127, -74, 39, 117, 98, 0, -95, -109, -34, 63, 104,
+    59, -30, -88, -72, 0, 66, 73, 23, -41, -66, -37, 18,
+    53, 43, 0, -39, -44, -14, 26, 43, 25, -13, -41, -35,
+    0, 37, 45, 15, -31, -55, -34, 19, 61, 55, 0, -61,
+    -76, -26, 52, 92, 56, -31, -98, -86, 0, 92, 110, 37,
+    -71, -123, -73, 39, 121, 103, 0, -103, -121, -39, 73, 123,
+    71, -37, -110, -92, 0, 86, 98, 31, -56, -92, -52, 26,
+    76, 61, 0, -55, -61, -19, 34, 55, 31, -15, -45, -37,
+    0, 35, 41, 13, -25, -43, -26, 14, 44, 39, 0, -43,
+    -53, -18, 37, 66, 41, -23, -73, -66, 0, 72, 88, 30,
+    -59, -104, -63, 34, 109, 95, 0, -98, -117, -39, 74, 127,
+    75, -39, -121, -102, 0, 100, 116, 37, -69, -115, -66, 34,
+    100, 82, 0, -76, -86, -27, 48, 78, 44, -22, -64, -51,
+    0, 46, 51, 16, -29, -47, -27, 14, 41, 35, 0, -35,
+    -41, -14, 27, 47, 29, -16, -51, -46, 0, 51, 64, 22,
+    -44, -78, -48, 27, 86, 76, 0, -78, -82, -21, 28, 29,
+    8, -2, -1, 1, 1, -7, -26, -27, 22, 89, 90, 0,
+    -98, -117, -39, 74, 127, 75, -39, -121, -102, 0, 100, 116,
+    37, -69, -115, -66, 34, 100, 82, 0, -76, -86, -27, 48,
+    78, 44, -22, -64, -51, 0, 46, 51, 16, -29, -47, -27,
+    14, 41, 35, 0, -35, -41, -14, 27, 47, 29, -16, -51,
+    -46, 0, 51, 64, 22, -44, -78, -48, 27, 86, 76, 0,
+    -82, -100, -34, 66, 115, 69, -37, -116, -100, 0, 102, 121,
+    39, -75, -127, -74, 39, 117, 98, 0, -95, -109, -34, 63,
+    104, 59, -30, -88, -72, 0, 66, 73, 23, -41, -66, -37,
+    18, 53, 43, 0, -39, -44, -14, 26, 43, 25, -13, -41,
+    -35, 0, 37, 45, 15, -31, -55, -34, 19, 61, 55, 0,
+    -61, -76, -26, 52, 92, 56, -31, -98, -86, 0, 92, 110,
+    37, -71, -123, -73, 39, 121, 103, 0, -103, -121, -39, 73,
+    123, 71, -37, -110, -92, 0, 86, 98, 31, -56, -92, -52,
+    26, 76, 61, 0, -55, -61, -19, 34, 55, 31, -15, -45,
+    -37, 0, 35, 41, 13, -25, -43, -26, 14, 44, 39, 0,
+    -43, -53, -18, 37, 66, 41, -23, -73, -66, 0, 72, 88,
+    30, -59, -104, -63, 34, 109, 95, 0, -98, -117, -39, 74,
+    127, 75, -39, -121, -102, 0, 100, 116, 37, -69, -115, -66,
+    34, 100, 82, 0, -76, -86, -27, 48, 78, 44, -22, -64,
+    -51, 0, 46, 51, 16, -29, -47, -27, 14, 41, 35, 0,
+    -35, -41, -14, 27, 47, 29, -16, -51, -46, 0, 51, 64,
+    22, -44, -78, -48, 27, 86, 76, 0, -78, -82, -21, 28,
+    29, 8, -2, -1, -1, 0, 0, 1, 1, 0, -1, -1,
+    0, 1, 1, 1, 0, -1, -1, 0, 1, 1, 0, -1,
+    -1, -1, 0, 2, 1, 0, -2, -2, -1, 1, 2, 1,
+    -1, -2, -2, 0, 2, 3, 1, -2, -3, -2, 1, 3,
+    3, 0, -3, -4, -1, 3, 5, 3, -2, -5, -4, 0,
+    5, 5, 2, -4, -6, -4, 2, 7, 6, 0, -6, -7,
+    -2, 5, 8, 5, -3, -9, -7, 0, 8, 9, 3, -6,
+    -11, -6, 3, 11, 10, 0, -10, -12, -4, 8, 14, 8,
+    -4, -14, -12, 0, 13, 15, 5, -10, -17, -10, 5, 17,
+    15, 0, -15, -18, -6, 12, 21, 12, -7, -21, -18, 0,
+    19, 22, 7, -14, -25, -15, 8, 25, 21, 0, -22, -27,
+    -9, 17, 29, 18, -9, -29, -25, 0, 26, 31, 10, -20,
+    -34, -20, 11, 34, 29, 0, -30, -36, -12, 23, 40, 24,
+    -13, -39, -34, 0, 35, 42, 14, -26, -45, -27, 14, 45,
+    39, 0, -40, -47, -15, 30, 51, 31, -16, -51, -44, 0,
+    45, 53, 17, -33, -58, -34, 18, 57, 49, 0, -50, -59,
+    -19, 37, 64, 38, -20, -63, -54, 0, 55, 65, 21, -41,
+    -70, -42, 22, 69, 59, 0, -60, -71, -23, 45, 77, 46,
+    -24, -75, -64, 0, 65, 77, 25, -49, -83, -49, 26, 81,
+    69, 0, -70, -83, -27, 52, 90, 53, -28, -87, -74, 0,
+    75, 89, 29, -56, -96, -57, 30, 93, 79, 0, -80, -95,
+    -31, 59, 101, 60, -32, -98, -84, 0, 85, 100, 33, -62,
+    -107, -63, 33, 103, 88, 0, -89, -105, -34, 65, 111, 66,
+    -35, -107, -92, 0, 92, 109, 36, -68, -116, -68, 36, 111,
+    95, 0, -95, -113, -37, 70, 119, 70, -37, -114, -98, 0,
+    98, 116, 38, -72, -122, -72, 38, 117, 100, 0, -100, -118,
+    -38, 73, 125, 73, -39, -119, -101, 0, 102, 120, 39, -74,
+    -126, -74, 39, 120, 102, 0, -103, -121, -39, 75, 127, 75,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121,
+    103, 0, -102, -120, -39, 74, 126, 74, -39, -120, -102, 0,
+    101, 119, 39, -73, -125, -73, 38, 118, 100, 0, -100, -117,
+    -38, 72, 122, 72, -38, -116, -98, 0, 98, 114, 37, -70,
+    -119, -70, 37, 113, 95, 0, -95, -111, -36, 68, 116, 68,
+    -35, -109, -92, 0, 92, 107, 35, -66, -111, -65, 34, 105,
+    89, 0, -88, -103, -33, 63, 107, 62, -33, -100, -85, 0,
+    84, 98, 32, -60, -101, -59, 31, 95, 80, 0, -79, -93,
+    -30, 57, 96, 56, -29, -89, -75, 0, 74, 87, 28, -53,
+    -90, -52, 27, 83, 70, 0, -69, -81, -26, 49, 83, 49,
+    -25, -77, -65, 0, 64, 75, 24, -46, -77, -45, 23, 71,
+    60, 0, -59, -69, -22, 42, 70, 41, -21, -65, -55, 0,
+    54, 63, 20, -38, -64, -37, 19, 59, 50, 0, -49, -57,
+    -18, 34, 58, 33, -17, -53, -45, 0, 44, 51, 16, -31,
+    -51, -30, 15, 47, 40, 0, -39, -45, -14, 27, 45, 26,
+    -14, -42, -35, 0, 34, 39, 13, -24, -40, -23, 12, 36,
+    30, 0, -29, -34, -11, 20, 34, 20, -10, -31, -26, 0,
+    25, 29, 9, -18, -29, -17, 9, 27, 22, 0, -21, -25,
+    -8, 15, 25, 14, -7, -22, -19, 0, 18, 21, 7, -12,
+    -21, -12, 6, 18, 15, 0, -15, -17, -5, 10, 17, 10,
+    -5, -15, -13, 0, 12, 14, 4, -8, -14, -8, 4, 12,
+    10, 0, -10, -11, -3, 6, 11, 6, -3, -9, -8, 0,
+    7, 9, 3, -5, -8, -5, 2, 7, 6, 0, -6, -7,
+    -2, 4, 6, 4, -2, -5, -5, 0, 4, 5, 2, -3,
+    -5, -3, 1, 4, 3, 0, -3, -3, -1, 2, 3, 2,
+    -1, -3, -2, 0, 2, 2, 1, -1, -2, -1, 1, 2,
+    2, 0, -1, -2, 0, 1, 1, 1, 0, -1, -1, 0,
+    1, 1, 0, -1, -1, -1, 0, 1, 1, 0, -1, -1,
+    0, 0, 1, -1, 0, 0, 1, 1, 0, -1, -1, 0,
+    1, 1, 1, 0, -1, -1, 0, 1, 1, 0, -1, -1,
+    -1, 0, 2, 1, 0, -2, -2, -1, 1, 2, 1, -1,
+    -2, -2, 0, 2, 3, 1, -2, -3, -2, 1, 3, 3,
+    0, -3, -4, -1, 3, 5, 3, -2, -5, -4, 0, 5,
+    5, 2, -4, -6, -4, 2, 7, 6, 0, -6, -7, -2,
+    5, 8, 5, -3, -9, -7, 0, 8, 9, 3, -6, -11,
+    -6, 3, 11, 10, 0, -10, -12, -4, 8, 14, 8, -4,
+    -14, -12, 0, 13, 15, 5, -10, -17, -10, 5, 17, 15,
+    0, -15, -18, -6, 12, 21, 12, -7, -21, -18, 0, 19,
+    22, 7, -14, -25, -15, 8, 25, 21, 0, -22, -27, -9,
+    17, 29, 18, -9, -29, -25, 0, 26, 31, 10, -20, -34,
+    -20, 11, 34, 29, 0, -30, -36, -12, 23, 40, 24, -13,
+    -39, -34, 0, 35, 42, 14, -26, -45, -27, 14, 45, 39,
+    0, -40, -47, -15, 30, 51, 31, -16, -51, -44, 0, 45,
+    53, 17, -33, -58, -34, 18, 57, 49, 0, -50, -59, -19,
+    37, 64, 38, -20, -63, -54, 0, 55, 65, 21, -41, -70,
+    -42, 22, 69, 59, 0, -60, -71, -23, 45, 77, 46, -24,
+    -75, -64, 0, 65, 77, 25, -49, -83, -49, 26, 81, 69,
+    0, -70, -83, -27, 52, 90, 53, -28, -87, -74, 0, 75,
+    89, 29, -56, -96, -57, 30, 93, 79, 0, -80, -95, -31,
+    59, 101, 60, -32, -98, -84, 0, 85, 100, 33, -62, -107,
+    -63, 33, 103, 88, 0, -89, -105, -34, 65, 111, 66, -35,
+    -107, -92, 0, 92, 109, 36, -68, -116, -68, 36, 111, 95,
+    0, -95, -113, -37, 70, 119, 70, -37, -114, -98, 0, 98,
+    116, 38, -72, -122, -72, 38, 117, 100, 0, -100, -118, -38,
+    73, 125, 73, -39, -119, -101, 0, 102, 120, 39, -74, -126,
+    -74, 39, 120, 102, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -102, -120, -39, 74, 126, 74, -39, -120, -102, 0, 101,
+    119, 39, -73, -125, -73, 38, 118, 100, 0, -100, -117, -38,
+    72, 122, 72, -38, -116, -98, 0, 98, 114, 37, -70, -119,
+    -70, 37, 113, 95, 0, -95, -111, -36, 68, 116, 68, -35,
+    -109, -92, 0, 92, 107, 35, -66, -111, -65, 34, 105, 89,
+    0, -88, -103, -33, 63, 107, 62, -33, -100, -85, 0, 84,
+    98, 32, -60, -101, -59, 31, 95, 80, 0, -79, -93, -30,
+    57, 96, 56, -29, -89, -75, 0, 74, 87, 28, -53, -90,
+    -52, 27, 83, 70, 0, -69, -81, -26, 49, 83, 49, -25,
+    -77, -65, 0, 64, 75, 24, -46, -77, -45, 23, 71, 60,
+    0, -59, -69, -22, 42, 70, 41, -21, -65, -55, 0, 54,
+    63, 20, -38, -64, -37, 19, 59, 50, 0, -49, -57, -18,
+    34, 58, 33, -17, -53, -45, 0, 44, 51, 16, -31, -51,
+    -30, 15, 47, 40, 0, -39, -45, -14, 27, 45, 26, -14,
+    -42, -35, 0, 34, 39, 13, -24, -40, -23, 12, 36, 30,
+    0, -29, -34, -11, 20, 34, 20, -10, -31, -26, 0, 25,
+    29, 9, -18, -29, -17, 9, 27, 22, 0, -21, -25, -8,
+    15, 25, 14, -7, -22, -19, 0, 18, 21, 7, -12, -21,
+    -12, 6, 18, 15, 0, -15, -17, -5, 10, 17, 10, -5,
+    -15, -13, 0, 12, 14, 4, -8, -14, -8, 4, 12, 10,
+    0, -10, -11, -3, 6, 11, 6, -3, -9, -8, 0, 7,
+    9, 3, -5, -8, -5, 2, 7, 6, 0, -6, -7, -2,
+    4, 6, 4, -2, -5, -5, 0, 4, 5, 2, -3, -5,
+    -3, 1, 4, 3, 0, -3, -3, -1, 2, 3, 2, -1,
+    -3, -2, 0, 2, 2, 1, -1, -2, -1, 1, 2, 2,
+    0, -1, -2, 0, 1, 1, 1, 0, -1, -1, 0, 1,
+    1, 0, -1, -1, -1, 0, 1, 1, 0, -1, -1, 0,
+    0, 1, -1, 0, 0, 1, 1, 0, -1, -1, 0, 1,
+    1, 1, 0, -1, -1, 0, 1, 1, 0, -1, -1, -1,
+    0, 2, 1, 0, -2, -2, -1, 1, 2, 1, -1, -2,
+    -2, 0, 2, 3, 1, -2, -3, -2, 1, 3, 3, 0,
+    -3, -4, -1, 3, 5, 3, -2, -5, -4, 0, 5, 5,
+    2, -4, -6, -4, 2, 7, 6, 0, -6, -7, -2, 5,
+    8, 5, -3, -9, -7, 0, 8, 9, 3, -6, -11, -6,
+    3, 11, 10, 0, -10, -12, -4, 8, 14, 8, -4, -14,
+    -12, 0, 13, 15, 5, -10, -17, -10, 5, 17, 15, 0,
+    -15, -18, -6, 12, 21, 12, -7, -21, -18, 0, 19, 22,
+    7, -14, -25, -15, 8, 25, 21, 0, -22, -27, -9, 17,
+    29, 18, -9, -29, -25, 0, 26, 31, 10, -20, -34, -20,
+    11, 34, 29, 0, -30, -36, -12, 23, 40, 24, -13, -39,
+    -34, 0, 35, 42, 14, -26, -45, -27, 14, 45, 39, 0,
+    -40, -47, -15, 30, 51, 31, -16, -51, -44, 0, 45, 53,
+    17, -33, -58, -34, 18, 57, 49, 0, -50, -59, -19, 37,
+    64, 38, -20, -63, -54, 0, 55, 65, 21, -41, -70, -42,
+    22, 69, 59, 0, -60, -71, -23, 45, 77, 46, -24, -75,
+    -64, 0, 65, 77, 25, -49, -83, -49, 26, 81, 69, 0,
+    -70, -83, -27, 52, 90, 53, -28, -87, -74, 0, 75, 89,
+    29, -56, -96, -57, 30, 93, 79, 0, -80, -95, -31, 59,
+    101, 60, -32, -98, -84, 0, 85, 100, 33, -62, -107, -63,
+    33, 103, 88, 0, -89, -105, -34, 65, 111, 66, -35, -107,
+    -92, 0, 92, 109, 36, -68, -116, -68, 36, 111, 95, 0,
+    -95, -113, -37, 70, 119, 70, -37, -114, -98, 0, 98, 116,
+    38, -72, -122, -72, 38, 117, 100, 0, -100, -118, -38, 73,
+    125, 73, -39, -119, -101, 0, 102, 120, 39, -74, -126, -74,
+    39, 120, 102, 0, -103, -121, -39, 75, 127, 75, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0,
+    -102, -120, -39, 74, 126, 74, -39, -120, -102, 0, 101, 119,
+    39, -73, -125, -73, 38, 118, 100, 0, -100, -117, -38, 72,
+    122, 72, -38, -116, -98, 0, 98, 114, 37, -70, -119, -70,
+    37, 113, 95, 0, -95, -111, -36, 68, 116, 68, -35, -109,
+    -92, 0, 92, 107, 35, -66, -111, -65, 34, 105, 89, 0,
+    -88, -103, -33, 63, 107, 62, -33, -100, -85, 0, 84, 98,
+    32, -60, -101, -59, 31, 95, 80, 0, -79, -93, -30, 57,
+    96, 56, -29, -89, -75, 0, 74, 87, 28, -53, -90, -52,
+    27, 83, 70, 0, -69, -81, -26, 49, 83, 49, -25, -77,
+    -65, 0, 64, 75, 24, -46, -77, -45, 23, 71, 60, 0,
+    -59, -69, -22, 42, 70, 41, -21, -65, -55, 0, 54, 63,
+    20, -38, -64, -37, 19, 59, 50, 0, -49, -57, -18, 34,
+    58, 33, -17, -53, -45, 0, 44, 51, 16, -31, -51, -30,
+    15, 47, 40, 0, -39, -45, -14, 27, 45, 26, -14, -42,
+    -35, 0, 34, 39, 13, -24, -40, -23, 12, 36, 30, 0,
+    -29, -34, -11, 20, 34, 20, -10, -31, -26, 0, 25, 29,
+    9, -18, -29, -17, 9, 27, 22, 0, -21, -25, -8, 15,
+    25, 14, -7, -22, -19, 0, 18, 21, 7, -12, -21, -12,
+    6, 18, 15, 0, -15, -17, -5, 10, 17, 10, -5, -15,
+    -13, 0, 12, 14, 4, -8, -14, -8, 4, 12, 10, 0,
+    -10, -11, -3, 6, 11, 6, -3, -9, -8, 0, 7, 9,
+    3, -5, -8, -5, 2, 7, 6, 0, -6, -7, -2, 4,
+    6, 4, -2, -5, -5, 0, 4, 5, 2, -3, -5, -3,
+    1, 4, 3, 0, -3, -3, -1, 2, 3, 2, -1, -3,
+    -2, 0, 2, 2, 1, -1, -2, -1, 1, 2, 2, 0,
+    -1, -2, 0, 1, 1, 1, 0, -1, -1, 0, 1, 1,
+    0, -1, -1, -1, 0, 1, 1, 0, -1, -1, 0, 0,
+    1, -1, 0, 0, 1, 1, 0, -1, -1, 0, 1, 1,
+    1, 0, -1, -1, 0, 1, 1, 0, -1, -1, -1, 0,
+    2, 1, 0, -2, -2, -1, 1, 2, 1, -1, -2, -2,
+    0, 2, 3, 1, -2, -3, -2, 1, 3, 3, 0, -3,
+    -4, -1, 3, 5, 3, -2, -5, -4, 0, 5, 5, 2,
+    -4, -6, -4, 2, 7, 6, 0, -6, -7, -2, 5, 8,
+    5, -3, -9, -7, 0, 8, 9, 3, -6, -11, -6, 3,
+    11, 10, 0, -10, -12, -4, 8, 14, 8, -4, -14, -12,
+    0, 13, 15, 5, -10, -17, -10, 5, 17, 15, 0, -15,
+    -18, -6, 12, 21, 12, -7, -21, -18, 0, 19, 22, 7,
+    -14, -25, -15, 8, 25, 21, 0, -22, -27, -9, 17, 29,
+    18, -9, -29, -25, 0, 26, 31, 10, -20, -34, -20, 11,
+    34, 29, 0, -30, -36, -12, 23, 40, 24, -13, -39, -34,
+    0, 35, 42, 14, -26, -45, -27, 14, 45, 39, 0, -40,
+    -47, -15, 30, 51, 31, -16, -51, -44, 0, 45, 53, 17,
+    -33, -58, -34, 18, 57, 49, 0, -50, -59, -19, 37, 64,
+    38, -20, -63, -54, 0, 55, 65, 21, -41, -70, -42, 22,
+    69, 59, 0, -60, -71, -23, 45, 77, 46, -24, -75, -64,
+    0, 65, 77, 25, -49, -83, -49, 26, 81, 69, 0, -70,
+    -83, -27, 52, 90, 53, -28, -87, -74, 0, 75, 89, 29,
+    -56, -96, -57, 30, 93, 79, 0, -80, -95, -31, 59, 101,
+    60, -32, -98, -84, 0, 85, 100, 33, -62, -107, -63, 33,
+    103, 88, 0, -89, -105, -34, 65, 111, 66, -35, -107, -92,
+    0, 92, 109, 36, -68, -116, -68, 36, 111, 95, 0, -95,
+    -113, -37, 70, 119, 70, -37, -114, -98, 0, 98, 116, 38,
+    -72, -122, -72, 38, 117, 100, 0, -100, -118, -38, 73, 125,
+    73, -39, -119, -101, 0, 102, 120, 39, -74, -126, -74, 39,
+    120, 102, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -102,
+    -120, -39, 74, 126, 74, -39, -120, -102, 0, 101, 119, 39,
+    -73, -125, -73, 38, 118, 100, 0, -100, -117, -38, 72, 122,
+    72, -38, -116, -98, 0, 98, 114, 37, -70, -119, -70, 37,
+    113, 95, 0, -95, -111, -36, 68, 116, 68, -35, -109, -92,
+    0, 92, 107, 35, -66, -111, -65, 34, 105, 89, 0, -88,
+    -103, -33, 63, 107, 62, -33, -100, -85, 0, 84, 98, 32,
+    -60, -101, -59, 31, 95, 80, 0, -79, -93, -30, 57, 96,
+    56, -29, -89, -75, 0, 74, 87, 28, -53, -90, -52, 27,
+    83, 70, 0, -69, -81, -26, 49, 83, 49, -25, -77, -65,
+    0, 64, 75, 24, -46, -77, -45, 23, 71, 60, 0, -59,
+    -69, -22, 42, 70, 41, -21, -65, -55, 0, 54, 63, 20,
+    -38, -64, -37, 19, 59, 50, 0, -49, -57, -18, 34, 58,
+    33, -17, -53, -45, 0, 44, 51, 16, -31, -51, -30, 15,
+    47, 40, 0, -39, -45, -14, 27, 45, 26, -14, -42, -35,
+    0, 34, 39, 13, -24, -40, -23, 12, 36, 30, 0, -29,
+    -34, -11, 20, 34, 20, -10, -31, -26, 0, 25, 29, 9,
+    -18, -29, -17, 9, 27, 22, 0, -21, -25, -8, 15, 25,
+    14, -7, -22, -19, 0, 18, 21, 7, -12, -21, -12, 6,
+    18, 15, 0, -15, -17, -5, 10, 17, 10, -5, -15, -13,
+    0, 12, 14, 4, -8, -14, -8, 4, 12, 10, 0, -10,
+    -11, -3, 6, 11, 6, -3, -9, -8, 0, 7, 9, 3,
+    -5, -8, -5, 2, 7, 6, 0, -6, -7, -2, 4, 6,
+    4, -2, -5, -5, 0, 4, 5, 2, -3, -5, -3, 1,
+    4, 3, 0, -3, -3, -1, 2, 3, 2, -1, -3, -2,
+    0, 2, 2, 1, -1, -2, -1, 1, 2, 2, 0, -1,
+    -2, 0, 1, 1, 1, 0, -1, -1, 0, 1, 1, 0,
+    -1, -1, -1, 0, 1, 1, 0, -1, -1, 0, 0, 1,
+    1, 1, -7, -26, -27, 22, 89, 90, 0, -98, -117, -39,
+    74, 127, 75, -39, -121, -102, 0, 100, 116, 37, -69, -115,
+    -66, 34, 100, 82, 0, -76, -86, -27, 48, 78, 44, -22,
+    -64, -51, 0, 46, 51, 16, -29, -47, -27, 14, 41, 35,
+    0, -35, -41, -14, 27, 47, 29, -16, -51, -46, 0, 51,
+    64, 22, -44, -78, -48, 27, 86, 76, 0, -82, -100, -34,
+    66, 115, 69, -37, -116, -100, 0, 102, 121, 39, -75, -127,
+    -74, 39, 117, 98, 0, -95, -109, -34, 63, 104, 59, -30,
+    -88, -72, 0, 66, 73, 23, -41, -66, -37, 18, 53, 43,
+    0, -39, -44, -14, 26, 43, 25, -13, -41, -35, 0, 37,
+    45, 15, -31, -55, -34, 19, 61, 55, 0, -61, -76, -26,
+    52, 92, 56, -31, -98, -86, 0, 92, 110, 37, -71, -123,
+    -73, 39, 121, 103, 0, -103, -121, -39, 73, 123, 71, -37,
+    -110, -92, 0, 86, 98, 31, -56, -92, -52, 26, 76, 61,
+    0, -55, -61, -19, 34, 55, 31, -15, -45, -37, 0, 35,
+    41, 13, -25, -43, -26, 14, 44, 39, 0, -43, -53, -18,
+    37, 66, 41, -23, -73, -66, 0, 72, 88, 30, -59, -104,
+    -63, 34, 109, 95, 0, -98, -117, -39, 74, 127, 75, -39,
+    -121, -102, 0, 100, 116, 37, -69, -115, -66, 34, 100, 82,
+    0, -76, -86, -27, 48, 78, 44, -22, -64, -51, 0, 46,
+    51, 16, -29, -47, -27, 14, 41, 35, 0, -35, -41, -14,
+    27, 47, 29, -16, -51, -46, 0, 51, 64, 22, -44, -78,
+    -48, 27, 86, 76, 0, -78, -82, -21, 28, 29, 8, -2,
+    -1, 1, 1, -7, -26, -27, 22, 89, 90, 0, -98, -117,
+    -39, 74, 127, 75, -39, -121, -102, 0, 100, 116, 37, -69,
+    -115, -66, 34, 100, 82, 0, -76, -86, -27, 48, 78, 44,
+    -22, -64, -51, 0, 46, 51, 16, -29, -47, -27, 14, 41,
+    35, 0, -35, -41, -14, 27, 47, 29, -16, -51, -46, 0,
+    51, 64, 22, -44, -78, -48, 27, 86, 76, 0, -82, -100,
+    -34, 66, 115, 69, -37, -116, -100, 0, 102, 121, 39, -75,
+    -127, -74, 39, 117, 98, 0, -95, -109, -34, 63, 104, 59,
+    -30, -88, -72, 0, 66, 73, 23, -41, -66, -37, 18, 53,
+    43, 0, -39, -44, -14, 26, 43, 25, -13, -41, -35, 0,
+    37, 45, 15, -31, -55, -34, 19, 61, 55, 0, -61, -76,
+    -26, 52, 92, 56, -31, -98, -86, 0, 92, 110, 37, -71,
+    -123, -73, 39, 121, 103, 0, -103, -121, -39, 73, 123, 71,
+    -37, -110, -92, 0, 86, 98, 31, -56, -92, -52, 26, 76,
+    61, 0, -55, -61, -19, 34, 55, 31, -15, -45, -37, 0,
+    35, 41, 13, -25, -43, -26, 14, 44, 39, 0, -43, -53,
+    -18, 37, 66, 41, -23, -73, -66, 0, 72, 88, 30, -59,
+    -104, -63, 34, 109, 95, 0, -98, -117, -39, 74, 127, 75,
+    -39, -121, -102, 0, 100, 116, 37, -69, -115, -66, 34, 100,
+    82, 0, -76, -86, -27, 48, 78, 44, -22, -64, -51, 0,
+    46, 51, 16, -29, -47, -27, 14, 41, 35, 0, -35, -41,
+    -14, 27, 47, 29, -16, -51, -46, 0, 51, 64, 22, -44,
+    -78, -48, 27, 86, 76, 0, -78, -82, -21, 28, 29, 8,
+    -2, -1, 1, 1, -7, -26, -27, 22, 89, 90, 0, -98,
+    -117, -39, 74, 127, 75, -39, -121, -102, 0, 100, 116, 37,
+    -69, -115, -66, 34, 100, 82, 0, -76, -86, -27, 48, 78,
+    44, -22, -64, -51, 0, 46, 51, 16, -29, -47, -27, 14,
+    41, 35, 0, -35, -41, -14, 27, 47, 29, -16, -51, -46,
+    0, 51, 64, 22, -44, -78, -48, 27, 86, 76, 0, -82,
+    -100, -34, 66, 115, 69, -37, -116, -100, 0, 102, 121, 39,
+    -75, -127, -74, 39, 117, 98, 0, -95, -109, -34, 63, 104,
+    59, -30, -88, -72, 0, 66, 73, 23, -41, -66, -37, 18,
+    53, 43, 0, -39, -44, -14, 26, 43, 25, -13, -41, -35,
+    0, 37, 45, 15, -31, -55, -34, 19, 61, 55, 0, -61,
+    -76, -26, 52, 92, 56, -31, -98, -86, 0, 92, 110, 37,
+    -71, -123, -73, 39, 121, 103, 0, -103, -121, -39, 73, 123,
+    71, -37, -110, -92, 0, 86, 98, 31, -56, -92, -52, 26,
+    76, 61, 0, -55, -61, -19, 34, 55, 31, -15, -45, -37,
+    0, 35, 41, 13, -25, -43, -26, 14, 44, 39, 0, -43,
+    -53, -18, 37, 66, 41, -23, -73, -66, 0, 72, 88, 30,
+    -59, -104, -63, 34, 109, 95, 0, -98, -117, -39, 74, 127,
+    75, -39, -121, -102, 0, 100, 116, 37, -69, -115, -66, 34,
+    100, 82, 0, -76, -86, -27, 48, 78, 44, -22, -64, -51,
+    0, 46, 51, 16, -29, -47, -27, 14, 41, 35, 0, -35,
+    -41, -14, 27, 47, 29, -16, -51, -46, 0, 51, 64, 22,
+    -44, -78, -48, 27, 86, 76, 0, -78, -82, -21, 28, 29,
+    8, -2, -1, 1, 1, -7, -26, -27, 22, 89, 90, 0,
+    -98, -117, -39, 74, 127, 75, -39, -121, -102, 0, 100, 116,
+    37, -69, -115, -66, 34, 100, 82, 0, -76, -86, -27, 48,
+    78, 44, -22, -64, -51, 0, 46, 51, 16, -29, -47, -27,
+    14, 41, 35, 0, -35, -41, -14, 27, 47, 29, -16, -51,
+    -46, 0, 51, 64, 22, -44, -78, -48, 27, 86, 76, 0,
+    -82, -100, -34, 66, 115, 69, -37, -116, -100, 0, 102, 121,
+    39, -75, -127, -74, 39, 117, 98, 0, -95, -109, -34, 63,
+    104, 59, -30, -88, -72, 0, 66, 73, 23, -41, -66, -37,
+    18, 53, 43, 0, -39, -44, -14, 26, 43, 25, -13, -41,
+    -35, 0, 37, 45, 15, -31, -55, -34, 19, 61, 55, 0,
+    -61, -76, -26, 52, 92, 56, -31, -98, -86, 0, 92, 110,
+    37, -71, -123, -73, 39, 121, 103, 0, -103, -121, -39, 73,
+    123, 71, -37, -110, -92, 0, 86, 98, 31, -56, -92, -52,
+    26, 76, 61, 0, -55, -61, -19, 34, 55, 31, -15, -45,
+    -37, 0, 35, 41, 13, -25, -43, -26, 14, 44, 39, 0,
+    -43, -53, -18, 37, 66, 41, -23, -73, -66, 0, 72, 88,
+    30, -59, -104, -63, 34, 109, 95, 0, -98, -117, -39, 74,
+    127, 75, -39, -121, -102, 0, 100, 116, 37, -69, -115, -66,
+    34, 100, 82, 0, -76, -86, -27, 48, 78, 44, -22, -64,
+    -51, 0, 46, 51, 16, -29, -47, -27, 14, 41, 35, 0,
+    -35, -41, -14, 27, 47, 29, -16, -51, -46, 0, 51, 64,
+    22, -44, -78, -48, 27, 86, 76, 0, -78, -82, -21, 28,
+    29, 8, -2, -1, 1, 1, -6, -23, -23, 18, 73, 73,
+    0, -78, -93, -30, 58, 100, 60, -32, -98, -84, 0, 86,
+    102, 33, -64, -110, -65, 34, 107, 91, 0, -93, -110, -36,
+    69, 117, 69, -37, -113, -97, 0, 98, 116, 38, -72, -123,
+    -73, 38, 118, 101, 0, -101, -119, -39, 74, 126, 74, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 120, 102,
+    0, -102, -120, -39, 74, 125, 73, -38, -118, -100, 0, 99,
+    116, 38, -71, -120, -70, 37, 113, 95, 0, -94, -110, -36,
+    67, 114, 66, -35, -106, -89, 0, 88, 103, 33, -62, -105,
+    -61, 32, 97, 82, 0, -80, -94, -30, 57, 95, 55, -29,
+    -88, -74, 0, 72, 84, 27, -50, -85, -49, 26, 78, 65,
+    0, -63, -74, -24, 44, 74, 43, -22, -68, -57, 0, 55,
+    64, 20, -38, -64, -37, 19, 59, 49, 0, -48, -55, -18,
+    33, 56, 32, -17, -51, -43, 0, 42, 48, 15, -29, -49,
+    -28, 15, 45, 38, 0, -37, -43, -14, 26, 44, 26, -14,
+    -41, -35, 0, 35, 41, 13, -25, -42, -25, 13, 40, 34,
+    0, -34, -41, -13, 25, 43, 25, -13, -42, -36, 0, 36,
+    43, 14, -27, -46, -28, 15, 46, 39, 0, -40, -48, -16,
+    30, 52, 31, -17, -52, -44, 0, 46, 55, 18, -35, -60,
+    -36, 19, 59, 51, 0, -53, -63, -21, 40, 69, 41, -22,
+    -69, -59, 0, 61, 73, 24, -46, -79, -47, 25, 79, 68,
+    0, -69, -83, -27, 52, 90, 54, -28, -89, -76, 0, 78,
+    93, 30, -58, -100, -60, 32, 98, 84, 0, -86, -102, -33,
+    64, 110, 65, -34, -107, -91, 0, 93, 110, 36, -69, -117,
+    -69, 37, 113, 97, 0, -98, -116, -38, 72, 123, 73, -38,
+    -118, -101, 0, 101, 119, 39, -74, -126, -74, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -120, -102, 0, 102,
+    120, 39, -74, -125, -73, 38, 118, 100, 0, -99, -116, -38,
+    71, 120, 70, -37, -113, -95, 0, 94, 110, 36, -67, -114,
+    -66, 35, 106, 89, 0, -88, -103, -33, 62, 105, 61, -32,
+    -97, -82, 0, 80, 94, 30, -57, -95, -55, 29, 88, 74,
+    0, -72, -84, -27, 50, 85, 49, -26, -78, -65, 0, 63,
+    74, 24, -44, -74, -43, 22, 68, 57, 0, -55, -64, -20,
+    38, 64, 37, -19, -59, -49, 0, 48, 55, 18, -33, -56,
+    -32, 17, 51, 43, 0, -42, -48, -15, 29, 49, 28, -15,
+    -45, -38, 0, 37, 43, 14, -26, -44, -26, 14, 41, 35,
+    0, -35, -41, -13, 25, 42, 25, -13, -40, -34, 0, 34,
+    41, 13, -25, -43, -25, 13, 42, 36, 0, -36, -43, -14,
+    27, 46, 28, -15, -46, -39, 0, 40, 48, 16, -30, -52,
+    -31, 17, 52, 44, 0, -46, -55, -18, 35, 60, 36, -19,
+    -59, -51, 0, 53, 63, 21, -40, -69, -41, 22, 69, 59,
+    0, -61, -73, -24, 46, 79, 47, -25, -79, -68, 0, 69,
+    83, 27, -52, -90, -54, 28, 89, 76, 0, -78, -93, -30,
+    58, 100, 60, -32, -98, -84, 0, 86, 102, 33, -64, -110,
+    -65, 34, 107, 91, 0, -93, -110, -36, 69, 117, 69, -37,
+    -113, -97, 0, 98, 116, 38, -72, -123, -73, 38, 118, 101,
+    0, -101, -119, -39, 74, 126, 74, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 120, 102, 0, -102, -120, -39,
+    74, 125, 73, -38, -118, -100, 0, 99, 116, 38, -71, -120,
+    -70, 37, 113, 95, 0, -94, -110, -36, 67, 114, 66, -35,
+    -106, -89, 0, 88, 103, 33, -62, -105, -61, 32, 97, 82,
+    0, -80, -94, -30, 57, 95, 55, -29, -88, -74, 0, 72,
+    84, 27, -50, -85, -49, 26, 78, 65, 0, -63, -74, -24,
+    44, 74, 43, -22, -68, -57, 0, 55, 64, 20, -38, -64,
+    -37, 19, 59, 49, 0, -48, -55, -18, 33, 56, 32, -17,
+    -51, -43, 0, 42, 48, 15, -29, -49, -28, 15, 45, 38,
+    0, -37, -43, -14, 26, 44, 26, -14, -41, -35, 0, 35,
+    41, 13, -25, -42, -25, 13, 40, 34, 0, -34, -41, -13,
+    25, 43, 25, -13, -42, -36, 0, 36, 43, 14, -27, -46,
+    -28, 15, 46, 39, 0, -40, -48, -16, 30, 52, 31, -17,
+    -52, -44, 0, 46, 55, 18, -35, -60, -36, 19, 59, 51,
+    0, -53, -63, -21, 40, 69, 41, -22, -69, -59, 0, 61,
+    73, 24, -46, -79, -47, 25, 79, 68, 0, -69, -83, -27,
+    52, 90, 54, -28, -89, -76, 0, 78, 93, 30, -58, -100,
+    -60, 32, 98, 84, 0, -86, -102, -33, 64, 110, 65, -34,
+    -107, -91, 0, 93, 110, 36, -69, -117, -69, 37, 113, 97,
+    0, -93, -95, -24, 31, 31, 9, -2, -1, 1, 1, -6,
+    -23, -23, 18, 73, 73, 0, -78, -93, -30, 58, 100, 60,
+    -32, -98, -84, 0, 86, 102, 33, -64, -110, -65, 34, 107,
+    91, 0, -93, -110, -36, 69, 117, 69, -37, -113, -97, 0,
+    98, 116, 38, -72, -123, -73, 38, 118, 101, 0, -101, -119,
+    -39, 74, 126, 74, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 120, 102, 0, -102, -120, -39, 74, 125, 73,
+    -38, -118, -100, 0, 99, 116, 38, -71, -120, -70, 37, 113,
+    95, 0, -94, -110, -36, 67, 114, 66, -35, -106, -89, 0,
+    88, 103, 33, -62, -105, -61, 32, 97, 82, 0, -80, -94,
+    -30, 57, 95, 55, -29, -88, -74, 0, 72, 84, 27, -50,
+    -85, -49, 26, 78, 65, 0, -63, -74, -24, 44, 74, 43,
+    -22, -68, -57, 0, 55, 64, 20, -38, -64, -37, 19, 59,
+    49, 0, -48, -55, -18, 33, 56, 32, -17, -51, -43, 0,
+    42, 48, 15, -29, -49, -28, 15, 45, 38, 0, -37, -43,
+    -14, 26, 44, 26, -14, -41, -35, 0, 35, 41, 13, -25,
+    -42, -25, 13, 40, 34, 0, -34, -41, -13, 25, 43, 25,
+    -13, -42, -36, 0, 36, 43, 14, -27, -46, -28, 15, 46,
+    39, 0, -40, -48, -16, 30, 52, 31, -17, -52, -44, 0,
+    46, 55, 18, -35, -60, -36, 19, 59, 51, 0, -53, -63,
+    -21, 40, 69, 41, -22, -69, -59, 0, 61, 73, 24, -46,
+    -79, -47, 25, 79, 68, 0, -69, -83, -27, 52, 90, 54,
+    -28, -89, -76, 0, 78, 93, 30, -58, -100, -60, 32, 98,
+    84, 0, -86, -102, -33, 64, 110, 65, -34, -107, -91, 0,
+    93, 110, 36, -69, -117, -69, 37, 113, 97, 0, -98, -116,
+    -38, 72, 123, 73, -38, -118, -101, 0, 101, 119, 39, -74,
+    -126, -74, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75,
+    -39, -120, -102, 0, 102, 120, 39, -74, -125, -73, 38, 118,
+    100, 0, -99, -116, -38, 71, 120, 70, -37, -113, -95, 0,
+    94, 110, 36, -67, -114, -66, 35, 106, 89, 0, -88, -103,
+    -33, 62, 105, 61, -32, -97, -82, 0, 80, 94, 30, -57,
+    -95, -55, 29, 88, 74, 0, -72, -84, -27, 50, 85, 49,
+    -26, -78, -65, 0, 63, 74, 24, -44, -74, -43, 22, 68,
+    57, 0, -55, -64, -20, 38, 64, 37, -19, -59, -49, 0,
+    48, 55, 18, -33, -56, -32, 17, 51, 43, 0, -42, -48,
+    -15, 29, 49, 28, -15, -45, -38, 0, 37, 43, 14, -26,
+    -44, -26, 14, 41, 35, 0, -35, -41, -13, 25, 42, 25,
+    -13, -40, -34, 0, 34, 41, 13, -25, -43, -25, 13, 42,
+    36, 0, -36, -43, -14, 27, 46, 28, -15, -46, -39, 0,
+    40, 48, 16, -30, -52, -31, 17, 52, 44, 0, -46, -55,
+    -18, 35, 60, 36, -19, -59, -51, 0, 53, 63, 21, -40,
+    -69, -41, 22, 69, 59, 0, -61, -73, -24, 46, 79, 47,
+    -25, -79, -68, 0, 69, 83, 27, -52, -90, -54, 28, 89,
+    76, 0, -78, -93, -30, 58, 100, 60, -32, -98, -84, 0,
+    86, 102, 33, -64, -110, -65, 34, 107, 91, 0, -93, -110,
+    -36, 69, 117, 69, -37, -113, -97, 0, 98, 116, 38, -72,
+    -123, -73, 38, 118, 101, 0, -101, -119, -39, 74, 126, 74,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 120,
+    102, 0, -102, -120, -39, 74, 125, 73, -38, -118, -100, 0,
+    99, 116, 38, -71, -120, -70, 37, 113, 95, 0, -94, -110,
+    -36, 67, 114, 66, -35, -106, -89, 0, 88, 103, 33, -62,
+    -105, -61, 32, 97, 82, 0, -80, -94, -30, 57, 95, 55,
+    -29, -88, -74, 0, 72, 84, 27, -50, -85, -49, 26, 78,
+    65, 0, -63, -74, -24, 44, 74, 43, -22, -68, -57, 0,
+    55, 64, 20, -38, -64, -37, 19, 59, 49, 0, -48, -55,
+    -18, 33, 56, 32, -17, -51, -43, 0, 42, 48, 15, -29,
+    -49, -28, 15, 45, 38, 0, -37, -43, -14, 26, 44, 26,
+    -14, -41, -35, 0, 35, 41, 13, -25, -42, -25, 13, 40,
+    34, 0, -34, -41, -13, 25, 43, 25, -13, -42, -36, 0,
+    36, 43, 14, -27, -46, -28, 15, 46, 39, 0, -40, -48,
+    -16, 30, 52, 31, -17, -52, -44, 0, 46, 55, 18, -35,
+    -60, -36, 19, 59, 51, 0, -53, -63, -21, 40, 69, 41,
+    -22, -69, -59, 0, 61, 73, 24, -46, -79, -47, 25, 79,
+    68, 0, -69, -83, -27, 52, 90, 54, -28, -89, -76, 0,
+    78, 93, 30, -58, -100, -60, 32, 98, 84, 0, -86, -102,
+    -33, 64, 110, 65, -34, -107, -91, 0, 93, 110, 36, -69,
+    -117, -69, 37, 113, 97, 0, -93, -95, -24, 31, 31, 9,
+    -2, -1, 1, 1, -6, -23, -23, 18, 73, 73, 0, -78,
+    -93, -30, 58, 100, 60, -32, -98, -84, 0, 86, 102, 33,
+    -64, -110, -65, 34, 107, 91, 0, -93, -110, -36, 69, 117,
+    69, -37, -113, -97, 0, 98, 116, 38, -72, -123, -73, 38,
+    118, 101, 0, -101, -119, -39, 74, 126, 74, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 120, 102, 0, -102,
+    -120, -39, 74, 125, 73, -38, -118, -100, 0, 99, 116, 38,
+    -71, -120, -70, 37, 113, 95, 0, -94, -110, -36, 67, 114,
+    66, -35, -106, -89, 0, 88, 103, 33, -62, -105, -61, 32,
+    97, 82, 0, -80, -94, -30, 57, 95, 55, -29, -88, -74,
+    0, 72, 84, 27, -50, -85, -49, 26, 78, 65, 0, -63,
+    -74, -24, 44, 74, 43, -22, -68, -57, 0, 55, 64, 20,
+    -38, -64, -37, 19, 59, 49, 0, -48, -55, -18, 33, 56,
+    32, -17, -51, -43, 0, 42, 48, 15, -29, -49, -28, 15,
+    45, 38, 0, -37, -43, -14, 26, 44, 26, -14, -41, -35,
+    0, 35, 41, 13, -25, -42, -25, 13, 40, 34, 0, -34,
+    -41, -13, 25, 43, 25, -13, -42, -36, 0, 36, 43, 14,
+    -27, -46, -28, 15, 46, 39, 0, -40, -48, -16, 30, 52,
+    31, -17, -52, -44, 0, 46, 55, 18, -35, -60, -36, 19,
+    59, 51, 0, -53, -63, -21, 40, 69, 41, -22, -69, -59,
+    0, 61, 73, 24, -46, -79, -47, 25, 79, 68, 0, -69,
+    -83, -27, 52, 90, 54, -28, -89, -76, 0, 78, 93, 30,
+    -58, -100, -60, 32, 98, 84, 0, -86, -102, -33, 64, 110,
+    65, -34, -107, -91, 0, 93, 110, 36, -69, -117, -69, 37,
+    113, 97, 0, -98, -116, -38, 72, 123, 73, -38, -118, -101,
+    0, 101, 119, 39, -74, -126, -74, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -120, -102, 0, 102, 120, 39,
+    -74, -125, -73, 38, 118, 100, 0, -99, -116, -38, 71, 120,
+    70, -37, -113, -95, 0, 94, 110, 36, -67, -114, -66, 35,
+    106, 89, 0, -88, -103, -33, 62, 105, 61, -32, -97, -82,
+    0, 80, 94, 30, -57, -95, -55, 29, 88, 74, 0, -72,
+    -84, -27, 50, 85, 49, -26, -78, -65, 0, 63, 74, 24,
+    -44, -74, -43, 22, 68, 57, 0, -55, -64, -20, 38, 64,
+    37, -19, -59, -49, 0, 48, 55, 18, -33, -56, -32, 17,
+    51, 43, 0, -42, -48, -15, 29, 49, 28, -15, -45, -38,
+    0, 37, 43, 14, -26, -44, -26, 14, 41, 35, 0, -35,
+    -41, -13, 25, 42, 25, -13, -40, -34, 0, 34, 41, 13,
+    -25, -43, -25, 13, 42, 36, 0, -36, -43, -14, 27, 46,
+    28, -15, -46, -39, 0, 40, 48, 16, -30, -52, -31, 17,
+    52, 44, 0, -46, -55, -18, 35, 60, 36, -19, -59, -51,
+    0, 53, 63, 21, -40, -69, -41, 22, 69, 59, 0, -61,
+    -73, -24, 46, 79, 47, -25, -79, -68, 0, 69, 83, 27,
+    -52, -90, -54, 28, 89, 76, 0, -78, -93, -30, 58, 100,
+    60, -32, -98, -84, 0, 86, 102, 33, -64, -110, -65, 34,
+    107, 91, 0, -93, -110, -36, 69, 117, 69, -37, -113, -97,
+    0, 98, 116, 38, -72, -123, -73, 38, 118, 101, 0, -101,
+    -119, -39, 74, 126, 74, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 120, 102, 0, -102, -120, -39, 74, 125,
+    73, -38, -118, -100, 0, 99, 116, 38, -71, -120, -70, 37,
+    113, 95, 0, -94, -110, -36, 67, 114, 66, -35, -106, -89,
+    0, 88, 103, 33, -62, -105, -61, 32, 97, 82, 0, -80,
+    -94, -30, 57, 95, 55, -29, -88, -74, 0, 72, 84, 27,
+    -50, -85, -49, 26, 78, 65, 0, -63, -74, -24, 44, 74,
+    43, -22, -68, -57, 0, 55, 64, 20, -38, -64, -37, 19,
+    59, 49, 0, -48, -55, -18, 33, 56, 32, -17, -51, -43,
+    0, 42, 48, 15, -29, -49, -28, 15, 45, 38, 0, -37,
+    -43, -14, 26, 44, 26, -14, -41, -35, 0, 35, 41, 13,
+    -25, -42, -25, 13, 40, 34, 0, -34, -41, -13, 25, 43,
+    25, -13, -42, -36, 0, 36, 43, 14, -27, -46, -28, 15,
+    46, 39, 0, -40, -48, -16, 30, 52, 31, -17, -52, -44,
+    0, 46, 55, 18, -35, -60, -36, 19, 59, 51, 0, -53,
+    -63, -21, 40, 69, 41, -22, -69, -59, 0, 61, 73, 24,
+    -46, -79, -47, 25, 79, 68, 0, -69, -83, -27, 52, 90,
+    54, -28, -89, -76, 0, 78, 93, 30, -58, -100, -60, 32,
+    98, 84, 0, -86, -102, -33, 64, 110, 65, -34, -107, -91,
+    0, 93, 110, 36, -69, -117, -69, 37, 113, 97, 0, -93,
+    -95, -24, 31, 31, 9, -2, -1, 1, 1, -6, -23, -23,
+    18, 73, 73, 0, -78, -93, -30, 58, 100, 60, -32, -98,
+    -84, 0, 86, 102, 33, -64, -110, -65, 34, 107, 91, 0,
+    -93, -110, -36, 69, 117, 69, -37, -113, -97, 0, 98, 116,
+    38, -72, -123, -73, 38, 118, 101, 0, -101, -119, -39, 74,
+    126, 74, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 120, 102, 0, -102, -120, -39, 74, 125, 73, -38, -118,
+    -100, 0, 99, 116, 38, -71, -120, -70, 37, 113, 95, 0,
+    -94, -110, -36, 67, 114, 66, -35, -106, -89, 0, 88, 103,
+    33, -62, -105, -61, 32, 97, 82, 0, -80, -94, -30, 57,
+    95, 55, -29, -88, -74, 0, 72, 84, 27, -50, -85, -49,
+    26, 78, 65, 0, -63, -74, -24, 44, 74, 43, -22, -68,
+    -57, 0, 55, 64, 20, -38, -64, -37, 19, 59, 49, 0,
+    -48, -55, -18, 33, 56, 32, -17, -51, -43, 0, 42, 48,
+    15, -29, -49, -28, 15, 45, 38, 0, -37, -43, -14, 26,
+    44, 26, -14, -41, -35, 0, 35, 41, 13, -25, -42, -25,
+    13, 40, 34, 0, -34, -41, -13, 25, 43, 25, -13, -42,
+    -36, 0, 36, 43, 14, -27, -46, -28, 15, 46, 39, 0,
+    -40, -48, -16, 30, 52, 31, -17, -52, -44, 0, 46, 55,
+    18, -35, -60, -36, 19, 59, 51, 0, -53, -63, -21, 40,
+    69, 41, -22, -69, -59, 0, 61, 73, 24, -46, -79, -47,
+    25, 79, 68, 0, -69, -83, -27, 52, 90, 54, -28, -89,
+    -76, 0, 78, 93, 30, -58, -100, -60, 32, 98, 84, 0,
+    -86, -102, -33, 64, 110, 65, -34, -107, -91, 0, 93, 110,
+    36, -69, -117, -69, 37, 113, 97, 0, -98, -116, -38, 72,
+    123, 73, -38, -118, -101, 0, 101, 119, 39, -74, -126, -74,
+    39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -120,
+    -102, 0, 102, 120, 39, -74, -125, -73, 38, 118, 100, 0,
+    -99, -116, -38, 71, 120, 70, -37, -113, -95, 0, 94, 110,
+    36, -67, -114, -66, 35, 106, 89, 0, -88, -103, -33, 62,
+    105, 61, -32, -97, -82, 0, 80, 94, 30, -57, -95, -55,
+    29, 88, 74, 0, -72, -84, -27, 50, 85, 49, -26, -78,
+    -65, 0, 63, 74, 24, -44, -74, -43, 22, 68, 57, 0,
+    -55, -64, -20, 38, 64, 37, -19, -59, -49, 0, 48, 55,
+    18, -33, -56, -32, 17, 51, 43, 0, -42, -48, -15, 29,
+    49, 28, -15, -45, -38, 0, 37, 43, 14, -26, -44, -26,
+    14, 41, 35, 0, -35, -41, -13, 25, 42, 25, -13, -40,
+    -34, 0, 34, 41, 13, -25, -43, -25, 13, 42, 36, 0,
+    -36, -43, -14, 27, 46, 28, -15, -46, -39, 0, 40, 48,
+    16, -30, -52, -31, 17, 52, 44, 0, -46, -55, -18, 35,
+    60, 36, -19, -59, -51, 0, 53, 63, 21, -40, -69, -41,
+    22, 69, 59, 0, -61, -73, -24, 46, 79, 47, -25, -79,
+    -68, 0, 69, 83, 27, -52, -90, -54, 28, 89, 76, 0,
+    -78, -93, -30, 58, 100, 60, -32, -98, -84, 0, 86, 102,
+    33, -64, -110, -65, 34, 107, 91, 0, -93, -110, -36, 69,
+    117, 69, -37, -113, -97, 0, 98, 116, 38, -72, -123, -73,
+    38, 118, 101, 0, -101, -119, -39, 74, 126, 74, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 120, 102, 0,
+    -102, -120, -39, 74, 125, 73, -38, -118, -100, 0, 99, 116,
+    38, -71, -120, -70, 37, 113, 95, 0, -94, -110, -36, 67,
+    114, 66, -35, -106, -89, 0, 88, 103, 33, -62, -105, -61,
+    32, 97, 82, 0, -80, -94, -30, 57, 95, 55, -29, -88,
+    -74, 0, 72, 84, 27, -50, -85, -49, 26, 78, 65, 0,
+    -63, -74, -24, 44, 74, 43, -22, -68, -57, 0, 55, 64,
+    20, -38, -64, -37, 19, 59, 49, 0, -48, -55, -18, 33,
+    56, 32, -17, -51, -43, 0, 42, 48, 15, -29, -49, -28,
+    15, 45, 38, 0, -37, -43, -14, 26, 44, 26, -14, -41,
+    -35, 0, 35, 41, 13, -25, -42, -25, 13, 40, 34, 0,
+    -34, -41, -13, 25, 43, 25, -13, -42, -36, 0, 36, 43,
+    14, -27, -46, -28, 15, 46, 39, 0, -40, -48, -16, 30,
+    52, 31, -17, -52, -44, 0, 46, 55, 18, -35, -60, -36,
+    19, 59, 51, 0, -53, -63, -21, 40, 69, 41, -22, -69,
+    -59, 0, 61, 73, 24, -46, -79, -47, 25, 79, 68, 0,
+    -69, -83, -27, 52, 90, 54, -28, -89, -76, 0, 78, 93,
+    30, -58, -100, -60, 32, 98, 84, 0, -86, -102, -33, 64,
+    110, 65, -34, -107, -91, 0, 93, 110, 36, -69, -117, -69,
+    37, 113, 97, 0, -93, -95, -24, 31, 31, 9, -2, -1,
+    2, -1, -18, -37, -16, 57, 112, 67, -47, -123, -98, 8,
+    107, 118, 32, -81, -127, -68, 47, 123, 98, -8, -107, -118,
+    -32, 81, 127, 68, -47, -123, -98, 8, 107, 118, 32, -81,
+    -127, -68, 47, 123, 98, -8, -107, -118, -32, 81, 127, 68,
+    -47, -123, -98, 8, 107, 118, 32, -81, -127, -68, 47, 123,
+    98, -8, -107, -118, -32, 81, 127, 68, -47, -123, -98, 8,
+    107, 118, 32, -81, -127, -68, 47, 123, 98, -8, -107, -118,
+    -32, 81, 127, 68, -47, -123, -98, 8, 107, 118, 32, -81,
+    -127, -68, 47, 123, 98, -8, -107, -118, -32, 81, 127, 68,
+    -47, -123, -98, 8, 107, 118, 32, -81, -127, -68, 47, 123,
+    98, -8, -107, -118, -32, 81, 127, 68, -47, -123, -98, 8,
+    107, 118, 32, -81, -127, -68, 47, 123, 98, -8, -107, -118,
+    -32, 81, 127, 68, -47, -123, -98, 8, 107, 118, 32, -81,
+    -127, -68, 47, 123, 98, -8, -107, -118, -32, 81, 127, 68,
+    -47, -123, -98, 8, 107, 118, 32, -79, -109, -46, 22, 36,
+    14, 0, -2, 2, -1, -18, -37, -16, 57, 112, 67, -47,
+    -123, -98, 8, 107, 118, 32, -81, -127, -68, 47, 123, 98,
+    -8, -107, -118, -32, 81, 127, 68, -47, -123, -98, 8, 107,
+    118, 32, -81, -127, -68, 47, 123, 98, -8, -107, -118, -32,
+    81, 127, 68, -47, -123, -98, 8, 107, 118, 32, -81, -127,
+    -68, 47, 123, 98, -8, -107, -118, -32, 81, 127, 68, -47,
+    -123, -98, 8, 107, 118, 32, -81, -127, -68, 47, 123, 98,
+    -8, -107, -118, -32, 81, 127, 68, -47, -123, -98, 8, 107,
+    118, 32, -81, -127, -68, 47, 123, 98, -8, -107, -118, -32,
+    81, 127, 68, -47, -123, -98, 8, 107, 118, 32, -81, -127,
+    -68, 47, 123, 98, -8, -107, -118, -32, 81, 127, 68, -47,
+    -123, -98, 8, 107, 118, 32, -81, -127, -68, 47, 123, 98,
+    -8, -107, -118, -32, 81, 127, 68, -47, -123, -98, 8, 107,
+    118, 32, -81, -127, -68, 47, 123, 98, -8, -107, -118, -32,
+    81, 127, 68, -47, -123, -98, 8, 107, 118, 32, -79, -109,
+    -46, 22, 36, 14, 0, -2, 1, 2, -5, -27, -36, 9,
+    87, 107, 24, -87, -126, -61, 54, 125, 93, -16, -111, -115,
+    -24, 87, 126, 61, -54, -125, -93, 16, 111, 115, 24, -87,
+    -126, -61, 54, 125, 93, -16, -111, -115, -24, 87, 126, 61,
+    -54, -125, -93, 16, 111, 115, 24, -87, -126, -61, 54, 125,
+    93, -16, -111, -115, -24, 87, 126, 61, -54, -125, -93, 16,
+    111, 115, 24, -87, -126, -61, 54, 125, 93, -16, -111, -115,
+    -24, 87, 126, 61, -54, -125, -93, 16, 111, 115, 24, -87,
+    -126, -61, 54, 125, 93, -16, -111, -115, -24, 87, 126, 61,
+    -54, -125, -93, 16, 111, 115, 24, -87, -126, -61, 54, 125,
+    93, -16, -111, -115, -24, 87, 126, 61, -54, -125, -93, 16,
+    111, 115, 24, -87, -126, -61, 54, 125, 93, -16, -111, -115,
+    -24, 87, 126, 61, -54, -125, -93, 16, 111, 115, 24, -87,
+    -126, -61, 54, 125, 93, -16, -111, -115, -24, 87, 126, 61,
+    -54, -125, -93, 16, 111, 115, 24, -87, -126, -61, 54, 125,
+    93, -16, -104, -91, -14, 35, 29, 6, -2, -1, 1, 1,
+    -13, -35, -25, 41, 107, 84, -24, -115, -111, -16, 93, 125,
+    54, -61, -126, -87, 24, 115, 111, 16, -93, -125, -54, 61,
+    126, 87, -24, -115, -111, -16, 93, 125, 54, -61, -126, -87,
+    24, 115, 111, 16, -93, -125, -54, 61, 126, 87, -24, -115,
+    -111, -16, 93, 125, 54, -61, -126, -87, 24, 115, 111, 16,
+    -93, -125, -54, 61, 126, 87, -24, -115, -111, -16, 93, 125,
+    54, -61, -126, -87, 24, 115, 111, 16, -93, -125, -54, 61,
+    126, 87, -24, -115, -111, -16, 93, 125, 54, -61, -126, -87,
+    24, 115, 111, 16, -93, -125, -54, 61, 126, 87, -24, -115,
+    -111, -16, 93, 125, 54, -61, -126, -87, 24, 115, 111, 16,
+    -93, -125, -54, 61, 126, 87, -24, -115, -111, -16, 93, 125,
+    54, -61, -126, -87, 24, 115, 111, 16, -93, -125, -54, 61,
+    126, 87, -24, -115, -111, -16, 93, 125, 54, -61, -126, -87,
+    24, 115, 111, 16, -93, -125, -54, 61, 126, 87, -24, -115,
+    -111, -16, 93, 125, 54, -60, -112, -63, 12, 38, 19, 1,
+    -2, 2, -3, -23, -38, -4, 73, 112, 46, -68, -127, -81,
+    32, 118, 107, 8, -98, -123, -47, 68, 127, 81, -32, -118,
+    -107, -8, 98, 123, 47, -68, -127, -81, 32, 118, 107, 8,
+    -98, -123, -47, 68, 127, 81, -32, -118, -107, -8, 98, 123,
+    47, -68, -127, -81, 32, 118, 107, 8, -98, -123, -47, 68,
+    127, 81, -32, -118, -107, -8, 98, 123, 47, -68, -127, -81,
+    32, 118, 107, 8, -98, -123, -47, 68, 127, 81, -32, -118,
+    -107, -8, 98, 123, 47, -68, -127, -81, 32, 118, 107, 8,
+    -98, -123, -47, 68, 127, 81, -32, -118, -107, -8, 98, 123,
+    47, -68, -127, -81, 32, 118, 107, 8, -98, -123, -47, 68,
+    127, 81, -32, -118, -107, -8, 98, 123, 47, -68, -127, -81,
+    32, 118, 107, 8, -98, -123, -47, 68, 127, 81, -32, -118,
+    -107, -8, 98, 123, 47, -68, -127, -81, 32, 118, 107, 8,
+    -98, -123, -47, 68, 127, 81, -32, -118, -107, -8, 98, 123,
+    47, -68, -127, -81, 32, 118, 107, 8, -94, -102, -30, 30,
+    33, 10, -1, -1, 1, 2, -9, -32, -32, 25, 99, 98,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -110, -78, 0, 37, 24, 3, -2, -1, 1, 2, -9, -32,
+    -32, 25, 99, 98, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 38, -62, -82,
+    -33, 10, 15, 5, 1, 2, -9, -32, -32, 25, 99, 98,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 38, -62, -82, -33, 10, 15, 5,
+    1, 2, -9, -32, -32, 25, 99, 98, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 38, -62, -82, -33, 10, 15, 5, 1, 2, -9, -32,
+    -32, 25, 99, 98, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 38, -62, -82,
+    -33, 10, 15, 5, 1, 1, -11, -34, -29, 33, 103, 92,
+    -12, -109, -117, -28, 84, 126, 65, -50, -124, -95, 12, 109,
+    117, 28, -84, -126, -65, 50, 124, 95, -12, -109, -117, -28,
+    84, 126, 65, -50, -124, -95, 12, 109, 117, 28, -84, -126,
+    -65, 50, 124, 95, -12, -109, -117, -28, 84, 126, 65, -50,
+    -124, -95, 12, 109, 117, 28, -84, -126, -65, 50, 124, 95,
+    -12, -109, -117, -28, 84, 126, 65, -50, -124, -95, 12, 109,
+    117, 28, -84, -126, -65, 50, 124, 95, -12, -109, -117, -28,
+    84, 126, 65, -50, -124, -95, 12, 109, 117, 28, -84, -126,
+    -65, 50, 124, 95, -12, -109, -117, -28, 84, 126, 65, -50,
+    -124, -95, 12, 109, 117, 28, -84, -126, -65, 50, 124, 95,
+    -12, -109, -117, -28, 84, 126, 65, -50, -124, -95, 12, 109,
+    117, 28, -84, -126, -65, 50, 124, 95, -12, -109, -117, -28,
+    84, 126, 65, -50, -124, -95, 12, 109, 117, 28, -84, -126,
+    -65, 50, 124, 95, -12, -109, -117, -28, 84, 126, 65, -50,
+    -124, -95, 12, 109, 117, 26, -68, -79, -27, 12, 14, 4,
+    1, 1, -11, -34, -29, 33, 103, 92, -12, -109, -117, -28,
+    84, 126, 65, -50, -124, -95, 12, 109, 117, 28, -84, -126,
+    -65, 50, 124, 95, -12, -109, -117, -28, 84, 126, 65, -50,
+    -124, -95, 12, 109, 117, 28, -84, -126, -65, 50, 124, 95,
+    -12, -109, -117, -28, 84, 126, 65, -50, -124, -95, 12, 109,
+    117, 28, -84, -126, -65, 50, 124, 95, -12, -109, -117, -28,
+    84, 126, 65, -50, -124, -95, 12, 109, 117, 28, -84, -126,
+    -65, 50, 124, 95, -12, -109, -117, -28, 84, 126, 65, -50,
+    -124, -95, 12, 109, 117, 28, -84, -126, -65, 50, 124, 95,
+    -12, -109, -117, -28, 84, 126, 65, -50, -124, -95, 12, 109,
+    117, 28, -84, -126, -65, 50, 124, 95, -12, -109, -117, -28,
+    84, 126, 65, -50, -124, -95, 12, 109, 117, 28, -84, -126,
+    -65, 50, 124, 95, -12, -109, -117, -28, 84, 126, 65, -50,
+    -124, -95, 12, 109, 117, 28, -84, -126, -65, 50, 124, 95,
+    -12, -109, -117, -28, 84, 126, 65, -50, -124, -95, 12, 109,
+    117, 26, -68, -79, -27, 12, 14, 4, 1, 1, -11, -34,
+    -29, 33, 103, 92, -12, -109, -117, -28, 84, 126, 65, -50,
+    -124, -95, 12, 109, 117, 28, -84, -126, -65, 50, 124, 95,
+    -12, -109, -117, -28, 84, 126, 65, -50, -124, -95, 12, 109,
+    117, 28, -84, -126, -65, 50, 124, 95, -12, -109, -117, -28,
+    84, 126, 65, -50, -124, -95, 12, 109, 117, 28, -84, -126,
+    -65, 50, 124, 95, -12, -109, -117, -28, 84, 126, 65, -50,
+    -124, -95, 12, 109, 117, 28, -84, -126, -65, 50, 124, 95,
+    -12, -109, -117, -28, 84, 126, 65, -50, -124, -95, 12, 109,
+    117, 28, -84, -126, -65, 50, 124, 95, -12, -109, -117, -28,
+    84, 126, 65, -50, -124, -95, 12, 109, 117, 28, -84, -126,
+    -65, 50, 124, 95, -12, -109, -117, -28, 84, 126, 65, -50,
+    -124, -95, 12, 109, 117, 28, -84, -126, -65, 50, 124, 95,
+    -12, -109, -117, -28, 84, 126, 65, -50, -124, -95, 12, 109,
+    117, 28, -84, -126, -65, 50, 124, 95, -12, -109, -117, -28,
+    84, 126, 65, -50, -124, -95, 12, 109, 117, 26, -68, -79,
+    -27, 12, 14, 4, 1, 1, -11, -34, -29, 33, 103, 92,
+    -12, -109, -117, -28, 84, 126, 65, -50, -124, -95, 12, 109,
+    117, 28, -84, -126, -65, 50, 124, 95, -12, -109, -117, -28,
+    84, 126, 65, -50, -124, -95, 12, 109, 117, 28, -84, -126,
+    -65, 50, 124, 95, -12, -109, -117, -28, 84, 126, 65, -50,
+    -124, -95, 12, 109, 117, 28, -84, -126, -65, 50, 124, 95,
+    -12, -109, -117, -28, 84, 126, 65, -50, -124, -95, 12, 109,
+    117, 28, -84, -126, -65, 50, 124, 95, -12, -109, -117, -28,
+    84, 126, 65, -50, -124, -95, 12, 109, 117, 28, -84, -126,
+    -65, 50, 124, 95, -12, -109, -117, -28, 84, 126, 65, -50,
+    -124, -95, 12, 109, 117, 28, -84, -126, -65, 50, 124, 95,
+    -12, -109, -117, -28, 84, 126, 65, -50, -124, -95, 12, 109,
+    117, 28, -84, -126, -65, 50, 124, 95, -12, -109, -117, -28,
+    84, 126, 65, -50, -124, -95, 12, 109, 117, 28, -84, -126,
+    -65, 50, 124, 95, -12, -109, -117, -28, 84, 126, 65, -50,
+    -124, -95, 12, 109, 117, 26, -68, -79, -27, 12, 14, 4,
+    1, 2, -9, -32, -32, 25, 99, 98, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -110, -78, 0, 37,
+    24, 3, -2, -1, 1, 2, -9, -32, -32, 25, 99, 98,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -110, -78, 0, 37, 24, 3, -2, -1, 2, -3, -23, -38,
+    -4, 73, 112, 46, -68, -127, -81, 32, 118, 107, 8, -98,
+    -123, -47, 68, 127, 81, -32, -118, -107, -8, 98, 123, 47,
+    -68, -127, -81, 32, 118, 107, 8, -98, -123, -47, 68, 127,
+    81, -32, -118, -107, -8, 98, 123, 47, -68, -127, -81, 32,
+    118, 107, 8, -94, -102, -30, 30, 33, 10, -1, -1, 2,
+    -3, -23, -38, -4, 73, 112, 46, -68, -127, -81, 32, 118,
+    107, 8, -98, -123, -47, 68, 127, 81, -32, -118, -107, -8,
+    98, 123, 47, -68, -127, -81, 32, 118, 107, 8, -98, -123,
+    -47, 68, 127, 81, -32, -118, -107, -8, 98, 123, 47, -68,
+    -127, -81, 32, 118, 107, 8, -94, -102, -30, 30, 33, 10,
+    -1, -1, 1, 2, -5, -27, -36, 9, 87, 107, 24, -87,
+    -126, -61, 54, 125, 93, -16, -111, -115, -24, 87, 126, 61,
+    -54, -125, -93, 16, 111, 115, 24, -87, -126, -61, 54, 125,
+    93, -16, -111, -115, -24, 87, 126, 61, -54, -125, -93, 16,
+    111, 115, 24, -87, -126, -61, 54, 125, 93, -16, -104, -91,
+    -14, 35, 29, 6, -2, -1, 1, 2, -5, -27, -36, 9,
+    87, 107, 24, -87, -126, -61, 54, 125, 93, -16, -111, -115,
+    -24, 87, 126, 61, -54, -125, -93, 16, 111, 115, 24, -87,
+    -126, -61, 54, 125, 93, -16, -111, -115, -24, 87, 126, 61,
+    -54, -125, -93, 16, 111, 115, 24, -87, -126, -61, 54, 125,
+    93, -16, -104, -91, -14, 35, 29, 6, -2, -1, 1, 2,
+    -9, -32, -32, 25, 99, 98, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -110, -78, 0, 37, 24, 3,
+    -2, -1, 1, 2, -9, -32, -32, 25, 99, 98, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -110, -78,
+    0, 37, 24, 3, -2, -1, 2, -1, -18, -37, -16, 57,
+    112, 67, -47, -123, -98, 8, 107, 118, 32, -81, -127, -68,
+    47, 123, 98, -8, -107, -118, -32, 81, 127, 68, -47, -123,
+    -98, 8, 107, 118, 32, -81, -127, -68, 47, 123, 98, -8,
+    -107, -118, -32, 81, 127, 68, -47, -123, -98, 8, 107, 118,
+    32, -79, -109, -46, 22, 36, 14, 0, -2, 2, -1, -18,
+    -37, -16, 57, 112, 67, -47, -123, -98, 8, 107, 118, 32,
+    -81, -127, -68, 47, 123, 98, -8, -107, -118, -32, 81, 127,
+    68, -47, -123, -98, 8, 107, 118, 32, -81, -127, -68, 47,
+    123, 98, -8, -107, -118, -32, 81, 127, 68, -47, -123, -98,
+    8, 107, 118, 32, -79, -109, -46, 22, 36, 14, 0, -2,
+    1, 2, -9, -32, -32, 25, 99, 98, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -110, -78, 0, 37,
+    24, 3, -2, -1, 1, 2, -9, -32, -32, 25, 99, 98,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -110, -78, 0, 37, 24, 3, -2, -1, 1, 2, -9, -32,
+    -32, 25, 99, 98, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -98, -99, -25, 32, 32, 9, -2,
+    -1, 1, 2, -9, -32, -32, 25, 99, 98, 0, -103, -121,
+    -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121,
+    103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0,
+    103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121,
+    -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121,
+    103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0,
+    103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121,
+    -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121,
+    103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0,
+    103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121,
+    -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121,
+    103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0,
+    103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121,
+    -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121,
+    103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0,
+    103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121,
+    -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121,
+    103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0,
+    103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121,
+    -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121,
+    103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0,
+    103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121,
+    -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121,
+    103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0,
+    103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121,
+    -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121,
+    103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0,
+    103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121,
+    -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121,
+    103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0,
+    103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121,
+    -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121,
+    103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0,
+    103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121,
+    -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121,
+    103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0,
+    103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121,
+    -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121,
+    103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0,
+    103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -98, -99,
+    -25, 32, 32, 9, -2, -1, 1, 2, -9, -32, -32, 25,
+    99, 98, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -98, -99, -25, 32, 32, 9, -2, -1, 1,
+    2, -9, -32, -32, 25, 99, 98, 0, -103, -121, -39, 75,
+    127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75,
+    127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75,
+    127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75,
+    127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75,
+    127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75,
+    127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75,
+    127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75,
+    127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75,
+    127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75,
+    127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75,
+    127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75,
+    127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75,
+    127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -98, -99, -25, 32,
+    32, 9, -2, -1, 1, 1, -7, -26, -27, 22, 89, 90,
+    0, -98, -117, -39, 74, 127, 75, -39, -121, -102, 0, 100,
+    116, 37, -69, -115, -66, 34, 100, 82, 0, -76, -86, -27,
+    48, 78, 44, -22, -64, -51, 0, 46, 51, 16, -29, -47,
+    -27, 14, 41, 35, 0, -35, -41, -14, 27, 47, 29, -16,
+    -51, -46, 0, 51, 64, 22, -44, -78, -48, 27, 86, 76,
+    0, -82, -100, -34, 66, 115, 69, -37, -116, -100, 0, 102,
+    121, 39, -75, -127, -74, 39, 117, 98, 0, -95, -109, -34,
+    63, 104, 59, -30, -88, -72, 0, 66, 73, 23, -41, -66,
+    -37, 18, 53, 43, 0, -39, -44, -14, 26, 43, 25, -13,
+    -41, -35, 0, 37, 45, 15, -31, -55, -34, 19, 61, 55,
+    0, -61, -76, -26, 52, 92, 56, -31, -98, -86, 0, 92,
+    110, 37, -71, -123, -73, 39, 121, 103, 0, -103, -121, -39,
+    73, 123, 71, -37, -110, -92, 0, 86, 98, 31, -56, -92,
+    -52, 26, 76, 61, 0, -55, -61, -19, 34, 55, 31, -15,
+    -45, -37, 0, 35, 41, 13, -25, -43, -26, 14, 44, 39,
+    0, -43, -53, -18, 37, 66, 41, -23, -73, -66, 0, 72,
+    88, 30, -59, -104, -63, 34, 109, 95, 0, -98, -117, -39,
+    74, 127, 75, -39, -121, -102, 0, 100, 116, 37, -69, -115,
+    -66, 34, 100, 82, 0, -76, -86, -27, 48, 78, 44, -22,
+    -64, -51, 0, 46, 51, 16, -29, -47, -27, 14, 41, 35,
+    0, -35, -41, -14, 27, 47, 29, -16, -51, -46, 0, 51,
+    64, 22, -44, -78, -48, 27, 86, 76, 0, -78, -82, -21,
+    28, 29, 8, -2, -1, 1, 1, -7, -26, -27, 22, 89,
+    90, 0, -98, -117, -39, 74, 127, 75, -39, -121, -102, 0,
+    100, 116, 37, -69, -115, -66, 34, 100, 82, 0, -76, -86,
+    -27, 48, 78, 44, -22, -64, -51, 0, 46, 51, 16, -29,
+    -47, -27, 14, 41, 35, 0, -35, -41, -14, 27, 47, 29,
+    -16, -51, -46, 0, 51, 64, 22, -44, -78, -48, 27, 86,
+    76, 0, -82, -100, -34, 66, 115, 69, -37, -116, -100, 0,
+    102, 121, 39, -75, -127, -74, 39, 117, 98, 0, -95, -109,
+    -34, 63, 104, 59, -30, -88, -72, 0, 66, 73, 23, -41,
+    -66, -37, 18, 53, 43, 0, -39, -44, -14, 26, 43, 25,
+    -13, -41, -35, 0, 37, 45, 15, -31, -55, -34, 19, 61,
+    55, 0, -61, -76, -26, 52, 92, 56, -31, -98, -86, 0,
+    92, 110, 37, -71, -123, -73, 39, 121, 103, 0, -103, -121,
+    -39, 73, 123, 71, -37, -110, -92, 0, 86, 98, 31, -56,
+    -92, -52, 26, 76, 61, 0, -55, -61, -19, 34, 55, 31,
+    -15, -45, -37, 0, 35, 41, 13, -25, -43, -26, 14, 44,
+    39, 0, -43, -53, -18, 37, 66, 41, -23, -73, -66, 0,
+    72, 88, 30, -59, -104, -63, 34, 109, 95, 0, -98, -117,
+    -39, 74, 127, 75, -39, -121, -102, 0, 100, 116, 37, -69,
+    -115, -66, 34, 100, 82, 0, -76, -86, -27, 48, 78, 44,
+    -22, -64, -51, 0, 46, 51, 16, -29, -47, -27, 14, 41,
+    35, 0, -35, -41, -14, 27, 47, 29, -16, -51, -46, 0,
+    51, 64, 22, -44, -78, -48, 27, 86, 76, 0, -78, -82,
+    -21, 28, 29, 8, -2, -1, 1, 1, -7, -26, -27, 22,
+    89, 90, 0, -98, -117, -39, 74, 127, 75, -39, -121, -102,
+    0, 100, 116, 37, -69, -115, -66, 34, 100, 82, 0, -76,
+    -86, -27, 48, 78, 44, -22, -64, -51, 0, 46, 51, 16,
+    -29, -47, -27, 14, 41, 35, 0, -35, -41, -14, 27, 47,
+    29, -16, -51, -46, 0, 51, 64, 22, -44, -78, -48, 27,
+    86, 76, 0, -82, -100, -34, 66, 115, 69, -37, -116, -100,
+    0, 102, 121, 39, -75, -127, -74, 39, 117, 98, 0, -95,
+    -109, -34, 63, 104, 59, -30, -88, -72, 0, 66, 73, 23,
+    -41, -66, -37, 18, 53, 43, 0, -39, -44, -14, 26, 43,
+    25, -13, -41, -35, 0, 37, 45, 15, -31, -55, -34, 19,
+    61, 55, 0, -61, -76, -26, 52, 92, 56, -31, -98, -86,
+    0, 92, 110, 37, -71, -123, -73, 39, 121, 103, 0, -103,
+    -121, -39, 73, 123, 71, -37, -110, -92, 0, 86, 98, 31,
+    -56, -92, -52, 26, 76, 61, 0, -55, -61, -19, 34, 55,
+    31, -15, -45, -37, 0, 35, 41, 13, -25, -43, -26, 14,
+    44, 39, 0, -43, -53, -18, 37, 66, 41, -23, -73, -66,
+    0, 72, 88, 30, -59, -104, -63, 34, 109, 95, 0, -98,
+    -117, -39, 74, 127, 75, -39, -121, -102, 0, 100, 116, 37,
+    -69, -115, -66, 34, 100, 82, 0, -76, -86, -27, 48, 78,
+    44, -22, -64, -51, 0, 46, 51, 16, -29, -47, -27, 14,
+    41, 35, 0, -35, -41, -14, 27, 47, 29, -16, -51, -46,
+    0, 51, 64, 22, -44, -78, -48, 27, 86, 76, 0, -78,
+    -82, -21, 28, 29, 8, -2, -1, 1, 1, -7, -26, -27,
+    22, 89, 90, 0, -98, -117, -39, 74, 127, 75, -39, -121,
+    -102, 0, 100, 116, 37, -69, -115, -66, 34, 100, 82, 0,
+    -76, -86, -27, 48, 78, 44, -22, -64, -51, 0, 46, 51,
+    16, -29, -47, -27, 14, 41, 35, 0, -35, -41, -14, 27,
+    47, 29, -16, -51, -46, 0, 51, 64, 22, -44, -78, -48,
+    27, 86, 76, 0, -82, -100, -34, 66, 115, 69, -37, -116,
+    -100, 0, 102, 121, 39, -75, -127, -74, 39, 117, 98, 0,
+    -95, -109, -34, 63, 104, 59, -30, -88, -72, 0, 66, 73,
+    23, -41, -66, -37, 18, 53, 43, 0, -39, -44, -14, 26,
+    43, 25, -13, -41, -35, 0, 37, 45, 15, -31, -55, -34,
+    19, 61, 55, 0, -61, -76, -26, 52, 92, 56, -31, -98,
+    -86, 0, 92, 110, 37, -71, -123, -73, 39, 121, 103, 0,
+    -103, -121, -39, 73, 123, 71, -37, -110, -92, 0, 86, 98,
+    31, -56, -92, -52, 26, 76, 61, 0, -55, -61, -19, 34,
+    55, 31, -15, -45, -37, 0, 35, 41, 13, -25, -43, -26,
+    14, 44, 39, 0, -43, -53, -18, 37, 66, 41, -23, -73,
+    -66, 0, 72, 88, 30, -59, -104, -63, 34, 109, 95, 0,
+    -98, -117, -39, 74, 127, 75, -39, -121, -102, 0, 100, 116,
+    37, -69, -115, -66, 34, 100, 82, 0, -76, -86, -27, 48,
+    78, 44, -22, -64, -51, 0, 46, 51, 16, -29, -47, -27,
+    14, 41, 35, 0, -35, -41, -14, 27, 47, 29, -16, -51,
+    -46, 0, 51, 64, 22, -44, -78, -48, 27, 86, 76, 0,
+    -78, -82, -21, 28, 29, 8, -2, -1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, -1,
+    -1, -1, -2, -2, -2, -2, -2, -2, -2, -2, -1, -1,
+    0, 0, 1, 1, 2, 2, 3, 3, 3, 4, 4, 4,
+    4, 3, 3, 2, 1, 1, 0, -1, -2, -3, -4, -5,
+    -6, -6, -6, -6, -6, -6, -5, -4, -3, -2, 0, 1,
+    3, 4, 6, 7, 8, 9, 10, 10, 10, 10, 9, 8,
+    6, 4, 2, 0, -2, -5, -7, -9, -11, -13, -14, -15,
+    -15, -14, -14, -12, -10, -8, -5, -2, 1, 4, 8, 11,
+    14, 16, 18, 20, 21, 21, 20, 18, 16, 13, 10, 6,
+    2, -3, -8, -12, -16, -20, -23, -26, -27, -28, -28, -26,
+    -24, -20, -16, -11, -6, 0, 6, 12, 18, 23, 28, 32,
+    34, 36, 36, 35, 33, 29, 25, 19, 12, 5, -3, -10,
+    -18, -25, -31, -37, -41, -44, -46, -45, -43, -40, -35, -29,
+    -21, -12, -3, 6, 16, 25, 34, 41, 47, 52, 55, 56,
+    55, 52, 47, 40, 32, 22, 11, 0, -12, -23, -34, -43,
+    -52, -59, -63, -66, -66, -64, -60, -53, -44, -34, -22, -9,
+    5, 18, 31, 43, 54, 63, 71, 75, 77, 76, 73, 67,
+    58, 47, 34, 20, 5, -10, -26, -41, -54, -66, -75, -82,
+    -87, -88, -86, -81, -73, -62, -49, -34, -17, 0, 18, 35,
+    51, 65, 78, 87, 94, 97, 97, 94, 87, 77, 64, 49,
+    31, 13, -6, -26, -44, -61, -76, -89, -98, -105, -107, -106,
+    -100, -92, -79, -64, -47, -27, -7, 14, 35, 54, 72, 87,
+    100, 108, 114, 115, 112, 105, 94, 80, 63, 43, 22, 0,
+    -22, -44, -64, -82, -97, -109, -117, -120, -120, -115, -107, -94,
+    -78, -59, -38, -15, 8, 31, 53, 73, 91, 105, 116, 123,
+    125, 123, 117, 106, 92, 74, 54, 31, 8, -16, -39, -61,
+    -81, -98, -111, -121, -126, -127, -123, -115, -103, -87, -68, -47,
+    -24, 0, 24, 47, 68, 87, 103, 115, 123, 127, 126, 121,
+    111, 98, 81, 61, 39, 16, -8, -31, -54, -74, -92, -106,
+    -117, -123, -125, -123, -116, -105, -91, -73, -53, -31, -8, 15,
+    38, 59, 78, 94, 107, 115, 120, 120, 117, 109, 97, 82,
+    64, 44, 22, 0, -22, -43, -63, -80, -94, -105, -112, -115,
+    -114, -108, -100, -87, -72, -54, -35, -14, 7, 27, 47, 64,
+    79, 92, 100, 106, 107, 105, 98, 89, 76, 61, 44, 26,
+    6, -13, -31, -49, -64, -77, -87, -94, -97, -97, -94, -87,
+    -78, -65, -51, -35, -18, 0, 17, 34, 49, 62, 73, 81,
+    86, 88, 87, 82, 75, 66, 54, 41, 26, 10, -5, -20,
+    -34, -47, -58, -67, -73, -76, -77, -75, -71, -63, -54, -43,
+    -31, -18, -5, 9, 22, 34, 44, 53, 60, 64, 66, 66,
+    63, 59, 52, 43, 34, 23, 12, 0, -11, -22, -32, -40,
+    -47, -52, -55, -56, -55, -52, -47, -41, -34, -25, -16, -6,
+    3, 12, 21, 29, 35, 40, 43, 45, 46, 44, 41, 37,
+    31, 25, 18, 10, 3, -5, -12, -19, -25, -29, -33, -35,
+    -36, -36, -34, -32, -28, -23, -18, -12, -6, 0, 6, 11,
+    16, 20, 24, 26, 28, 28, 27, 26, 23, 20, 16, 12,
+    8, 3, -2, -6, -10, -13, -16, -18, -20, -21, -21, -20,
+    -18, -16, -14, -11, -8, -4, -1, 2, 5, 8, 10, 12,
+    14, 14, 15, 15, 14, 13, 11, 9, 7, 5, 2, 0,
+    -2, -4, -6, -8, -9, -10, -10, -10, -10, -9, -8, -7,
+    -6, -4, -3, -1, 0, 2, 3, 4, 5, 6, 6, 6,
+    6, 6, 6, 5, 4, 3, 2, 1, 0, -1, -1, -2,
+    -3, -3, -4, -4, -4, -4, -3, -3, -3, -2, -2, -1,
+    -1, 0, 0, 1, 1, 2, 2, 2, 2, 2, 2, 2,
+    2, 1, 1, 1, 0, 0, 0, 0, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 0, 0, 0, 0, -1, -1,
+    -1, -2, -2, -2, -2, -2, -2, -2, -2, -1, -1, 0,
+    0, 1, 1, 2, 2, 3, 3, 3, 4, 4, 4, 4,
+    3, 3, 2, 1, 1, 0, -1, -2, -3, -4, -5, -6,
+    -6, -6, -6, -6, -6, -5, -4, -3, -2, 0, 1, 3,
+    4, 6, 7, 8, 9, 10, 10, 10, 10, 9, 8, 6,
+    4, 2, 0, -2, -5, -7, -9, -11, -13, -14, -15, -15,
+    -14, -14, -12, -10, -8, -5, -2, 1, 4, 8, 11, 14,
+    16, 18, 20, 21, 21, 20, 18, 16, 13, 10, 6, 2,
+    -3, -8, -12, -16, -20, -23, -26, -27, -28, -28, -26, -24,
+    -20, -16, -11, -6, 0, 6, 12, 18, 23, 28, 32, 34,
+    36, 36, 35, 33, 29, 25, 19, 12, 5, -3, -10, -18,
+    -25, -31, -37, -41, -44, -46, -45, -43, -40, -35, -29, -21,
+    -12, -3, 6, 16, 25, 34, 41, 47, 52, 55, 56, 55,
+    52, 47, 40, 32, 22, 11, 0, -12, -23, -34, -43, -52,
+    -59, -63, -66, -66, -64, -60, -53, -44, -34, -22, -9, 5,
+    18, 31, 43, 54, 63, 71, 75, 77, 76, 73, 67, 58,
+    47, 34, 20, 5, -10, -26, -41, -54, -66, -75, -82, -87,
+    -88, -86, -81, -73, -62, -49, -34, -17, 0, 18, 35, 51,
+    65, 78, 87, 94, 97, 97, 94, 87, 77, 64, 49, 31,
+    13, -6, -26, -44, -61, -76, -89, -98, -105, -107, -106, -100,
+    -92, -79, -64, -47, -27, -7, 14, 35, 54, 72, 87, 100,
+    108, 114, 115, 112, 105, 94, 80, 63, 43, 22, 0, -22,
+    -44, -64, -82, -97, -109, -117, -120, -120, -115, -107, -94, -78,
+    -59, -38, -15, 8, 31, 53, 73, 91, 105, 116, 123, 125,
+    123, 117, 106, 92, 74, 54, 31, 8, -16, -39, -61, -81,
+    -98, -111, -121, -126, -127, -123, -115, -103, -87, -68, -47, -24,
+    0, 24, 47, 68, 87, 103, 115, 123, 127, 126, 121, 111,
+    98, 81, 61, 39, 16, -8, -31, -54, -74, -92, -106, -117,
+    -123, -125, -123, -116, -105, -91, -73, -53, -31, -8, 15, 38,
+    59, 78, 94, 107, 115, 120, 120, 117, 109, 97, 82, 64,
+    44, 22, 0, -22, -43, -63, -80, -94, -105, -112, -115, -114,
+    -108, -100, -87, -72, -54, -35, -14, 7, 27, 47, 64, 79,
+    92, 100, 106, 107, 105, 98, 89, 76, 61, 44, 26, 6,
+    -13, -31, -49, -64, -77, -87, -94, -97, -97, -94, -87, -78,
+    -65, -51, -35, -18, 0, 17, 34, 49, 62, 73, 81, 86,
+    88, 87, 82, 75, 66, 54, 41, 26, 10, -5, -20, -34,
+    -47, -58, -67, -73, -76, -77, -75, -71, -63, -54, -43, -31,
+    -18, -5, 9, 22, 34, 44, 53, 60, 64, 66, 66, 63,
+    59, 52, 43, 34, 23, 12, 0, -11, -22, -32, -40, -47,
+    -52, -55, -56, -55, -52, -47, -41, -34, -25, -16, -6, 3,
+    12, 21, 29, 35, 40, 43, 45, 46, 44, 41, 37, 31,
+    25, 18, 10, 3, -5, -12, -19, -25, -29, -33, -35, -36,
+    -36, -34, -32, -28, -23, -18, -12, -6, 0, 6, 11, 16,
+    20, 24, 26, 28, 28, 27, 26, 23, 20, 16, 12, 8,
+    3, -2, -6, -10, -13, -16, -18, -20, -21, -21, -20, -18,
+    -16, -14, -11, -8, -4, -1, 2, 5, 8, 10, 12, 14,
+    14, 15, 15, 14, 13, 11, 9, 7, 5, 2, 0, -2,
+    -4, -6, -8, -9, -10, -10, -10, -10, -9, -8, -7, -6,
+    -4, -3, -1, 0, 2, 3, 4, 5, 6, 6, 6, 6,
+    6, 6, 5, 4, 3, 2, 1, 0, -1, -1, -2, -3,
+    -3, -4, -4, -4, -4, -3, -3, -3, -2, -2, -1, -1,
+    0, 0, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2,
+    1, 1, 1, 0, 0, 0, 0, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 0, 0, 0, 0, -1, -1, -1,
+    -2, -2, -2, -2, -2, -2, -2, -2, -1, -1, 0, 0,
+    1, 1, 2, 2, 3, 3, 3, 4, 4, 4, 4, 3,
+    3, 2, 1, 1, 0, -1, -2, -3, -4, -5, -6, -6,
+    -6, -6, -6, -6, -5, -4, -3, -2, 0, 1, 3, 4,
+    6, 7, 8, 9, 10, 10, 10, 10, 9, 8, 6, 4,
+    2, 0, -2, -5, -7, -9, -11, -13, -14, -15, -15, -14,
+    -14, -12, -10, -8, -5, -2, 1, 4, 8, 11, 14, 16,
+    18, 20, 21, 21, 20, 18, 16, 13, 10, 6, 2, -3,
+    -8, -12, -16, -20, -23, -26, -27, -28, -28, -26, -24, -20,
+    -16, -11, -6, 0, 6, 12, 18, 23, 28, 32, 34, 36,
+    36, 35, 33, 29, 25, 19, 12, 5, -3, -10, -18, -25,
+    -31, -37, -41, -44, -46, -45, -43, -40, -35, -29, -21, -12,
+    -3, 6, 16, 25, 34, 41, 47, 52, 55, 56, 55, 52,
+    47, 40, 32, 22, 11, 0, -12, -23, -34, -43, -52, -59,
+    -63, -66, -66, -64, -60, -53, -44, -34, -22, -9, 5, 18,
+    31, 43, 54, 63, 71, 75, 77, 76, 73, 67, 58, 47,
+    34, 20, 5, -10, -26, -41, -54, -66, -75, -82, -87, -88,
+    -86, -81, -73, -62, -49, -34, -17, 0, 18, 35, 51, 65,
+    78, 87, 94, 97, 97, 94, 87, 77, 64, 49, 31, 13,
+    -6, -26, -44, -61, -76, -89, -98, -105, -107, -106, -100, -92,
+    -79, -64, -47, -27, -7, 14, 35, 54, 72, 87, 100, 108,
+    114, 115, 112, 105, 94, 80, 63, 43, 22, 0, -22, -44,
+    -64, -82, -97, -109, -117, -120, -120, -115, -107, -94, -78, -59,
+    -38, -15, 8, 31, 53, 73, 91, 105, 116, 123, 125, 123,
+    117, 106, 92, 74, 54, 31, 8, -16, -39, -61, -81, -98,
+    -111, -121, -126, -127, -123, -115, -103, -87, -68, -47, -24, 0,
+    24, 47, 68, 87, 103, 115, 123, 127, 126, 121, 111, 98,
+    81, 61, 39, 16, -8, -31, -54, -74, -92, -106, -117, -123,
+    -125, -123, -116, -105, -91, -73, -53, -31, -8, 15, 38, 59,
+    78, 94, 107, 115, 120, 120, 117, 109, 97, 82, 64, 44,
+    22, 0, -22, -43, -63, -80, -94, -105, -112, -115, -114, -108,
+    -100, -87, -72, -54, -35, -14, 7, 27, 47, 64, 79, 92,
+    100, 106, 107, 105, 98, 89, 76, 61, 44, 26, 6, -13,
+    -31, -49, -64, -77, -87, -94, -97, -97, -94, -87, -78, -65,
+    -51, -35, -18, 0, 17, 34, 49, 62, 73, 81, 86, 88,
+    87, 82, 75, 66, 54, 41, 26, 10, -5, -20, -34, -47,
+    -58, -67, -73, -76, -77, -75, -71, -63, -54, -43, -31, -18,
+    -5, 9, 22, 34, 44, 53, 60, 64, 66, 66, 63, 59,
+    52, 43, 34, 23, 12, 0, -11, -22, -32, -40, -47, -52,
+    -55, -56, -55, -52, -47, -41, -34, -25, -16, -6, 3, 12,
+    21, 29, 35, 40, 43, 45, 46, 44, 41, 37, 31, 25,
+    18, 10, 3, -5, -12, -19, -25, -29, -33, -35, -36, -36,
+    -34, -32, -28, -23, -18, -12, -6, 0, 6, 11, 16, 20,
+    24, 26, 28, 28, 27, 26, 23, 20, 16, 12, 8, 3,
+    -2, -6, -10, -13, -16, -18, -20, -21, -21, -20, -18, -16,
+    -14, -11, -8, -4, -1, 2, 5, 8, 10, 12, 14, 14,
+    15, 15, 14, 13, 11, 9, 7, 5, 2, 0, -2, -4,
+    -6, -8, -9, -10, -10, -10, -10, -9, -8, -7, -6, -4,
+    -3, -1, 0, 2, 3, 4, 5, 6, 6, 6, 6, 6,
+    6, 5, 4, 3, 2, 1, 0, -1, -1, -2, -3, -3,
+    -4, -4, -4, -4, -3, -3, -3, -2, -2, -1, -1, 0,
+    0, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 1,
+    1, 1, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 0, 0, 0, 0, -1, -1, -1, -2,
+    -2, -2, -2, -2, -2, -2, -2, -1, -1, 0, 0, 1,
+    1, 2, 2, 3, 3, 3, 4, 4, 4, 4, 3, 3,
+    2, 1, 1, 0, -1, -2, -3, -4, -5, -6, -6, -6,
+    -6, -6, -6, -5, -4, -3, -2, 0, 1, 3, 4, 6,
+    7, 8, 9, 10, 10, 10, 10, 9, 8, 6, 4, 2,
+    0, -2, -5, -7, -9, -11, -13, -14, -15, -15, -14, -14,
+    -12, -10, -8, -5, -2, 1, 4, 8, 11, 14, 16, 18,
+    20, 21, 21, 20, 18, 16, 13, 10, 6, 2, -3, -8,
+    -12, -16, -20, -23, -26, -27, -28, -28, -26, -24, -20, -16,
+    -11, -6, 0, 6, 12, 18, 23, 28, 32, 34, 36, 36,
+    35, 33, 29, 25, 19, 12, 5, -3, -10, -18, -25, -31,
+    -37, -41, -44, -46, -45, -43, -40, -35, -29, -21, -12, -3,
+    6, 16, 25, 34, 41, 47, 52, 55, 56, 55, 52, 47,
+    40, 32, 22, 11, 0, -12, -23, -34, -43, -52, -59, -63,
+    -66, -66, -64, -60, -53, -44, -34, -22, -9, 5, 18, 31,
+    43, 54, 63, 71, 75, 77, 76, 73, 67, 58, 47, 34,
+    20, 5, -10, -26, -41, -54, -66, -75, -82, -87, -88, -86,
+    -81, -73, -62, -49, -34, -17, 0, 18, 35, 51, 65, 78,
+    87, 94, 97, 97, 94, 87, 77, 64, 49, 31, 13, -6,
+    -26, -44, -61, -76, -89, -98, -105, -107, -106, -100, -92, -79,
+    -64, -47, -27, -7, 14, 35, 54, 72, 87, 100, 108, 114,
+    115, 112, 105, 94, 80, 63, 43, 22, 0, -22, -44, -64,
+    -82, -97, -109, -117, -120, -120, -115, -107, -94, -78, -59, -38,
+    -15, 8, 31, 53, 73, 91, 105, 116, 123, 125, 123, 117,
+    106, 92, 74, 54, 31, 8, -16, -39, -61, -81, -98, -111,
+    -121, -126, -127, -123, -115, -103, -87, -68, -47, -24, 0, 24,
+    47, 68, 87, 103, 115, 123, 127, 126, 121, 111, 98, 81,
+    61, 39, 16, -8, -31, -54, -74, -92, -106, -117, -123, -125,
+    -123, -116, -105, -91, -73, -53, -31, -8, 15, 38, 59, 78,
+    94, 107, 115, 120, 120, 117, 109, 97, 82, 64, 44, 22,
+    0, -22, -43, -63, -80, -94, -105, -112, -115, -114, -108, -100,
+    -87, -72, -54, -35, -14, 7, 27, 47, 64, 79, 92, 100,
+    106, 107, 105, 98, 89, 76, 61, 44, 26, 6, -13, -31,
+    -49, -64, -77, -87, -94, -97, -97, -94, -87, -78, -65, -51,
+    -35, -18, 0, 17, 34, 49, 62, 73, 81, 86, 88, 87,
+    82, 75, 66, 54, 41, 26, 10, -5, -20, -34, -47, -58,
+    -67, -73, -76, -77, -75, -71, -63, -54, -43, -31, -18, -5,
+    9, 22, 34, 44, 53, 60, 64, 66, 66, 63, 59, 52,
+    43, 34, 23, 12, 0, -11, -22, -32, -40, -47, -52, -55,
+    -56, -55, -52, -47, -41, -34, -25, -16, -6, 3, 12, 21,
+    29, 35, 40, 43, 45, 46, 44, 41, 37, 31, 25, 18,
+    10, 3, -5, -12, -19, -25, -29, -33, -35, -36, -36, -34,
+    -32, -28, -23, -18, -12, -6, 0, 6, 11, 16, 20, 24,
+    26, 28, 28, 27, 26, 23, 20, 16, 12, 8, 3, -2,
+    -6, -10, -13, -16, -18, -20, -21, -21, -20, -18, -16, -14,
+    -11, -8, -4, -1, 2, 5, 8, 10, 12, 14, 14, 15,
+    15, 14, 13, 11, 9, 7, 5, 2, 0, -2, -4, -6,
+    -8, -9, -10, -10, -10, -10, -9, -8, -7, -6, -4, -3,
+    -1, 0, 2, 3, 4, 5, 6, 6, 6, 6, 6, 6,
+    5, 4, 3, 2, 1, 0, -1, -1, -2, -3, -3, -4,
+    -4, -4, -4, -3, -3, -3, -2, -2, -1, -1, 0, 0,
+    1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1,
+    1, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 0, 0, 0, 0, -1, -1, -1, -2, -2,
+    -2, -2, -2, -2, -2, -2, -1, -1, 0, 0, 1, 1,
+    2, 2, 3, 3, 3, 4, 4, 4, 4, 3, 3, 2,
+    1, 1, 0, -1, -2, -3, -4, -5, -6, -6, -6, -6,
+    -6, -6, -5, -4, -3, -2, 0, 1, 3, 4, 6, 7,
+    8, 9, 10, 10, 10, 10, 9, 8, 6, 4, 2, 0,
+    -2, -5, -7, -9, -11, -13, -14, -15, -15, -14, -14, -12,
+    -10, -8, -5, -2, 1, 4, 8, 11, 14, 16, 18, 20,
+    21, 21, 20, 18, 16, 13, 10, 6, 2, -3, -8, -12,
+    -16, -20, -23, -26, -27, -28, -28, -26, -24, -20, -16, -11,
+    -6, 0, 6, 12, 18, 23, 28, 32, 34, 36, 36, 35,
+    33, 29, 25, 19, 12, 5, -3, -10, -18, -25, -31, -37,
+    -41, -44, -46, -45, -43, -40, -35, -29, -21, -12, -3, 6,
+    16, 25, 34, 41, 47, 52, 55, 56, 55, 52, 47, 40,
+    32, 22, 11, 0, -12, -23, -34, -43, -52, -59, -63, -66,
+    -66, -64, -60, -53, -44, -34, -22, -9, 5, 18, 31, 43,
+    54, 63, 71, 75, 77, 76, 73, 67, 58, 47, 34, 20,
+    5, -10, -26, -41, -54, -66, -75, -82, -87, -88, -86, -81,
+    -73, -62, -49, -34, -17, 0, 18, 35, 51, 65, 78, 87,
+    94, 97, 97, 94, 87, 77, 64, 49, 31, 13, -6, -26,
+    -44, -61, -76, -89, -98, -105, -107, -106, -100, -92, -79, -64,
+    -47, -27, -7, 14, 35, 54, 72, 87, 100, 108, 114, 115,
+    112, 105, 94, 80, 63, 43, 22, 0, -22, -44, -64, -82,
+    -97, -109, -117, -120, -120, -115, -107, -94, -78, -59, -38, -15,
+    8, 31, 53, 73, 91, 105, 116, 123, 125, 123, 117, 106,
+    92, 74, 54, 31, 8, -16, -39, -61, -81, -98, -111, -121,
+    -126, -127, -123, -115, -103, -87, -68, -47, -24, 0, 24, 47,
+    68, 87, 103, 115, 123, 127, 126, 121, 111, 98, 81, 61,
+    39, 16, -8, -31, -54, -74, -92, -106, -117, -123, -125, -123,
+    -116, -105, -91, -73, -53, -31, -8, 15, 38, 59, 78, 94,
+    107, 115, 120, 120, 117, 109, 97, 82, 64, 44, 22, 0,
+    -22, -43, -63, -80, -94, -105, -112, -115, -114, -108, -100, -87,
+    -72, -54, -35, -14, 7, 27, 47, 64, 79, 92, 100, 106,
+    107, 105, 98, 89, 76, 61, 44, 26, 6, -13, -31, -49,
+    -64, -77, -87, -94, -97, -97, -94, -87, -78, -65, -51, -35,
+    -18, 0, 17, 34, 49, 62, 73, 81, 86, 88, 87, 82,
+    75, 66, 54, 41, 26, 10, -5, -20, -34, -47, -58, -67,
+    -73, -76, -77, -75, -71, -63, -54, -43, -31, -18, -5, 9,
+    22, 34, 44, 53, 60, 64, 66, 66, 63, 59, 52, 43,
+    34, 23, 12, 0, -11, -22, -32, -40, -47, -52, -55, -56,
+    -55, -52, -47, -41, -34, -25, -16, -6, 3, 12, 21, 29,
+    35, 40, 43, 45, 46, 44, 41, 37, 31, 25, 18, 10,
+    3, -5, -12, -19, -25, -29, -33, -35, -36, -36, -34, -32,
+    -28, -23, -18, -12, -6, 0, 6, 11, 16, 20, 24, 26,
+    28, 28, 27, 26, 23, 20, 16, 12, 8, 3, -2, -6,
+    -10, -13, -16, -18, -20, -21, -21, -20, -18, -16, -14, -11,
+    -8, -4, -1, 2, 5, 8, 10, 12, 14, 14, 15, 15,
+    14, 13, 11, 9, 7, 5, 2, 0, -2, -4, -6, -8,
+    -9, -10, -10, -10, -10, -9, -8, -7, -6, -4, -3, -1,
+    0, 2, 3, 4, 5, 6, 6, 6, 6, 6, 6, 5,
+    4, 3, 2, 1, 0, -1, -1, -2, -3, -3, -4, -4,
+    -4, -4, -3, -3, -3, -2, -2, -1, -1, 0, 0, 1,
+    1, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1,
+    0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 0, 0, 0, 0, -1, -1, -1, -2, -2, -2,
+    -2, -2, -2, -2, -2, -1, -1, 0, 0, 1, 1, 2,
+    2, 3, 3, 3, 4, 4, 4, 4, 3, 3, 2, 1,
+    1, 0, -1, -2, -3, -4, -5, -6, -6, -6, -6, -6,
+    -6, -5, -4, -3, -2, 0, 1, 3, 4, 6, 7, 8,
+    9, 10, 10, 10, 10, 9, 8, 6, 4, 2, 0, -2,
+    -5, -7, -9, -11, -13, -14, -15, -15, -14, -14, -12, -10,
+    -8, -5, -2, 1, 4, 8, 11, 14, 16, 18, 20, 21,
+    21, 20, 18, 16, 13, 10, 6, 2, -3, -8, -12, -16,
+    -20, -23, -26, -27, -28, -28, -26, -24, -20, -16, -11, -6,
+    0, 6, 12, 18, 23, 28, 32, 34, 36, 36, 35, 33,
+    29, 25, 19, 12, 5, -3, -10, -18, -25, -31, -37, -41,
+    -44, -46, -45, -43, -40, -35, -29, -21, -12, -3, 6, 16,
+    25, 34, 41, 47, 52, 55, 56, 55, 52, 47, 40, 32,
+    22, 11, 0, -12, -23, -34, -43, -52, -59, -63, -66, -66,
+    -64, -60, -53, -44, -34, -22, -9, 5, 18, 31, 43, 54,
+    63, 71, 75, 77, 76, 73, 67, 58, 47, 34, 20, 5,
+    -10, -26, -41, -54, -66, -75, -82, -87, -88, -86, -81, -73,
+    -62, -49, -34, -17, 0, 18, 35, 51, 65, 78, 87, 94,
+    97, 97, 94, 87, 77, 64, 49, 31, 13, -6, -26, -44,
+    -61, -76, -89, -98, -105, -107, -106, -100, -92, -79, -64, -47,
+    -27, -7, 14, 35, 54, 72, 87, 100, 108, 114, 115, 112,
+    105, 94, 80, 63, 43, 22, 0, -22, -44, -64, -82, -97,
+    -109, -117, -120, -120, -115, -107, -94, -78, -59, -38, -15, 8,
+    31, 53, 73, 91, 105, 116, 123, 125, 123, 117, 106, 92,
+    74, 54, 31, 8, -16, -39, -61, -81, -98, -111, -121, -126,
+    -127, -123, -115, -103, -87, -68, -47, -24, 0, 24, 47, 68,
+    87, 103, 115, 123, 127, 126, 121, 111, 98, 81, 61, 39,
+    16, -8, -31, -54, -74, -92, -106, -117, -123, -125, -123, -116,
+    -105, -91, -73, -53, -31, -8, 15, 38, 59, 78, 94, 107,
+    115, 120, 120, 117, 109, 97, 82, 64, 44, 22, 0, -22,
+    -43, -63, -80, -94, -105, -112, -115, -114, -108, -100, -87, -72,
+    -54, -35, -14, 7, 27, 47, 64, 79, 92, 100, 106, 107,
+    105, 98, 89, 76, 61, 44, 26, 6, -13, -31, -49, -64,
+    -77, -87, -94, -97, -97, -94, -87, -78, -65, -51, -35, -18,
+    0, 17, 34, 49, 62, 73, 81, 86, 88, 87, 82, 75,
+    66, 54, 41, 26, 10, -5, -20, -34, -47, -58, -67, -73,
+    -76, -77, -75, -71, -63, -54, -43, -31, -18, -5, 9, 22,
+    34, 44, 53, 60, 64, 66, 66, 63, 59, 52, 43, 34,
+    23, 12, 0, -11, -22, -32, -40, -47, -52, -55, -56, -55,
+    -52, -47, -41, -34, -25, -16, -6, 3, 12, 21, 29, 35,
+    40, 43, 45, 46, 44, 41, 37, 31, 25, 18, 10, 3,
+    -5, -12, -19, -25, -29, -33, -35, -36, -36, -34, -32, -28,
+    -23, -18, -12, -6, 0, 6, 11, 16, 20, 24, 26, 28,
+    28, 27, 26, 23, 20, 16, 12, 8, 3, -2, -6, -10,
+    -13, -16, -18, -20, -21, -21, -20, -18, -16, -14, -11, -8,
+    -4, -1, 2, 5, 8, 10, 12, 14, 14, 15, 15, 14,
+    13, 11, 9, 7, 5, 2, 0, -2, -4, -6, -8, -9,
+    -10, -10, -10, -10, -9, -8, -7, -6, -4, -3, -1, 0,
+    2, 3, 4, 5, 6, 6, 6, 6, 6, 6, 5, 4,
+    3, 2, 1, 0, -1, -1, -2, -3, -3, -4, -4, -4,
+    -4, -3, -3, -3, -2, -2, -1, -1, 0, 0, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 0,
+    0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 0, 0, 0, 0, -1, -1, -1, -2, -2, -2, -2,
+    -2, -2, -2, -2, -1, -1, 0, 0, 1, 1, 2, 2,
+    3, 3, 3, 4, 4, 4, 4, 3, 3, 2, 1, 1,
+    0, -1, -2, -3, -4, -5, -6, -6, -6, -6, -6, -6,
+    -5, -4, -3, -2, 0, 1, 3, 4, 6, 7, 8, 9,
+    10, 10, 10, 10, 9, 8, 6, 4, 2, 0, -2, -5,
+    -7, -9, -11, -13, -14, -15, -15, -14, -14, -12, -10, -8,
+    -5, -2, 1, 4, 8, 11, 14, 16, 18, 20, 21, 21,
+    20, 18, 16, 13, 10, 6, 2, -3, -8, -12, -16, -20,
+    -23, -26, -27, -28, -28, -26, -24, -20, -16, -11, -6, 0,
+    6, 12, 18, 23, 28, 32, 34, 36, 36, 35, 33, 29,
+    25, 19, 12, 5, -3, -10, -18, -25, -31, -37, -41, -44,
+    -46, -45, -43, -40, -35, -29, -21, -12, -3, 6, 16, 25,
+    34, 41, 47, 52, 55, 56, 55, 52, 47, 40, 32, 22,
+    11, 0, -12, -23, -34, -43, -52, -59, -63, -66, -66, -64,
+    -60, -53, -44, -34, -22, -9, 5, 18, 31, 43, 54, 63,
+    71, 75, 77, 76, 73, 67, 58, 47, 34, 20, 5, -10,
+    -26, -41, -54, -66, -75, -82, -87, -88, -86, -81, -73, -62,
+    -49, -34, -17, 0, 18, 35, 51, 65, 78, 87, 94, 97,
+    97, 94, 87, 77, 64, 49, 31, 13, -6, -26, -44, -61,
+    -76, -89, -98, -105, -107, -106, -100, -92, -79, -64, -47, -27,
+    -7, 14, 35, 54, 72, 87, 100, 108, 114, 115, 112, 105,
+    94, 80, 63, 43, 22, 0, -22, -44, -64, -82, -97, -109,
+    -117, -120, -120, -115, -107, -94, -78, -59, -38, -15, 8, 31,
+    53, 73, 91, 105, 116, 123, 125, 123, 117, 106, 92, 74,
+    54, 31, 8, -16, -39, -61, -81, -98, -111, -121, -126, -127,
+    -123, -115, -103, -87, -68, -47, -24, 0, 24, 47, 68, 87,
+    103, 115, 123, 127, 126, 121, 111, 98, 81, 61, 39, 16,
+    -8, -31, -54, -74, -92, -106, -117, -123, -125, -123, -116, -105,
+    -91, -73, -53, -31, -8, 15, 38, 59, 78, 94, 107, 115,
+    120, 120, 117, 109, 97, 82, 64, 44, 22, 0, -22, -43,
+    -63, -80, -94, -105, -112, -115, -114, -108, -100, -87, -72, -54,
+    -35, -14, 7, 27, 47, 64, 79, 92, 100, 106, 107, 105,
+    98, 89, 76, 61, 44, 26, 6, -13, -31, -49, -64, -77,
+    -87, -94, -97, -97, -94, -87, -78, -65, -51, -35, -18, 0,
+    17, 34, 49, 62, 73, 81, 86, 88, 87, 82, 75, 66,
+    54, 41, 26, 10, -5, -20, -34, -47, -58, -67, -73, -76,
+    -77, -75, -71, -63, -54, -43, -31, -18, -5, 9, 22, 34,
+    44, 53, 60, 64, 66, 66, 63, 59, 52, 43, 34, 23,
+    12, 0, -11, -22, -32, -40, -47, -52, -55, -56, -55, -52,
+    -47, -41, -34, -25, -16, -6, 3, 12, 21, 29, 35, 40,
+    43, 45, 46, 44, 41, 37, 31, 25, 18, 10, 3, -5,
+    -12, -19, -25, -29, -33, -35, -36, -36, -34, -32, -28, -23,
+    -18, -12, -6, 0, 6, 11, 16, 20, 24, 26, 28, 28,
+    27, 26, 23, 20, 16, 12, 8, 3, -2, -6, -10, -13,
+    -16, -18, -20, -21, -21, -20, -18, -16, -14, -11, -8, -4,
+    -1, 2, 5, 8, 10, 12, 14, 14, 15, 15, 14, 13,
+    11, 9, 7, 5, 2, 0, -2, -4, -6, -8, -9, -10,
+    -10, -10, -10, -9, -8, -7, -6, -4, -3, -1, 0, 2,
+    3, 4, 5, 6, 6, 6, 6, 6, 6, 5, 4, 3,
+    2, 1, 0, -1, -1, -2, -3, -3, -4, -4, -4, -4,
+    -3, -3, -3, -2, -2, -1, -1, 0, 0, 1, 1, 2,
+    2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 0, 0,
+    0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, -1, -1, -1, -2, -2, -2, -2, -2,
+    -2, -2, -2, -1, -1, 0, 0, 1, 1, 2, 2, 3,
+    3, 3, 4, 4, 4, 4, 3, 3, 2, 1, 1, 0,
+    -1, -2, -3, -4, -5, -6, -6, -6, -6, -6, -6, -5,
+    -4, -3, -2, 0, 1, 3, 4, 6, 7, 8, 9, 10,
+    10, 10, 10, 9, 8, 6, 4, 2, 0, -2, -5, -7,
+    -9, -11, -13, -14, -15, -15, -14, -14, -12, -10, -8, -5,
+    -2, 1, 4, 8, 11, 14, 16, 18, 20, 21, 21, 20,
+    18, 16, 13, 10, 6, 2, -3, -8, -12, -16, -20, -23,
+    -26, -27, -28, -28, -26, -24, -20, -16, -11, -6, 0, 6,
+    12, 18, 23, 28, 32, 34, 36, 36, 35, 33, 29, 25,
+    19, 12, 5, -3, -10, -18, -25, -31, -37, -41, -44, -46,
+    -45, -43, -40, -35, -29, -21, -12, -3, 6, 16, 25, 34,
+    41, 47, 52, 55, 56, 55, 52, 47, 40, 32, 22, 11,
+    0, -12, -23, -34, -43, -52, -59, -63, -66, -66, -64, -60,
+    -53, -44, -34, -22, -9, 5, 18, 31, 43, 54, 63, 71,
+    75, 77, 76, 73, 67, 58, 47, 34, 20, 5, -10, -26,
+    -41, -54, -66, -75, -82, -87, -88, -86, -81, -73, -62, -49,
+    -34, -17, 0, 18, 35, 51, 65, 78, 87, 94, 97, 97,
+    94, 87, 77, 64, 49, 31, 13, -6, -26, -44, -61, -76,
+    -89, -98, -105, -107, -106, -100, -92, -79, -64, -47, -27, -7,
+    14, 35, 54, 72, 87, 100, 108, 114, 115, 112, 105, 94,
+    80, 63, 43, 22, 0, -22, -44, -64, -82, -97, -109, -117,
+    -120, -120, -115, -107, -94, -78, -59, -38, -15, 8, 31, 53,
+    73, 91, 105, 116, 123, 125, 123, 117, 106, 92, 74, 54,
+    31, 8, -16, -39, -61, -81, -98, -111, -121, -126, -127, -123,
+    -115, -103, -87, -68, -47, -24, 0, 24, 47, 68, 87, 103,
+    115, 123, 127, 126, 121, 111, 98, 81, 61, 39, 16, -8,
+    -31, -54, -74, -92, -106, -117, -123, -125, -123, -116, -105, -91,
+    -73, -53, -31, -8, 15, 38, 59, 78, 94, 107, 115, 120,
+    120, 117, 109, 97, 82, 64, 44, 22, 0, -22, -43, -63,
+    -80, -94, -105, -112, -115, -114, -108, -100, -87, -72, -54, -35,
+    -14, 7, 27, 47, 64, 79, 92, 100, 106, 107, 105, 98,
+    89, 76, 61, 44, 26, 6, -13, -31, -49, -64, -77, -87,
+    -94, -97, -97, -94, -87, -78, -65, -51, -35, -18, 0, 17,
+    34, 49, 62, 73, 81, 86, 88, 87, 82, 75, 66, 54,
+    41, 26, 10, -5, -20, -34, -47, -58, -67, -73, -76, -77,
+    -75, -71, -63, -54, -43, -31, -18, -5, 9, 22, 34, 44,
+    53, 60, 64, 66, 66, 63, 59, 52, 43, 34, 23, 12,
+    0, -11, -22, -32, -40, -47, -52, -55, -56, -55, -52, -47,
+    -41, -34, -25, -16, -6, 3, 12, 21, 29, 35, 40, 43,
+    45, 46, 44, 41, 37, 31, 25, 18, 10, 3, -5, -12,
+    -19, -25, -29, -33, -35, -36, -36, -34, -32, -28, -23, -18,
+    -12, -6, 0, 6, 11, 16, 20, 24, 26, 28, 28, 27,
+    26, 23, 20, 16, 12, 8, 3, -2, -6, -10, -13, -16,
+    -18, -20, -21, -21, -20, -18, -16, -14, -11, -8, -4, -1,
+    2, 5, 8, 10, 12, 14, 14, 15, 15, 14, 13, 11,
+    9, 7, 5, 2, 0, -2, -4, -6, -8, -9, -10, -10,
+    -10, -10, -9, -8, -7, -6, -4, -3, -1, 0, 2, 3,
+    4, 5, 6, 6, 6, 6, 6, 6, 5, 4, 3, 2,
+    1, 0, -1, -1, -2, -3, -3, -4, -4, -4, -4, -3,
+    -3, -3, -2, -2, -1, -1, 0, 0, 1, 1, 2, 2,
+    2, 2, 2, 2, 2, 2, 1, 1, 1, 0, 0, 0,
+    0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    1, 1, -7, -26, -27, 22, 89, 90, 0, -98, -117, -39,
+    74, 127, 75, -39, -121, -102, 0, 100, 116, 37, -69, -115,
+    -66, 34, 100, 82, 0, -76, -86, -27, 48, 78, 44, -22,
+    -64, -51, 0, 46, 51, 16, -29, -47, -27, 14, 41, 35,
+    0, -35, -41, -14, 27, 47, 29, -16, -51, -46, 0, 51,
+    64, 22, -44, -78, -48, 27, 86, 76, 0, -82, -100, -34,
+    66, 115, 69, -37, -116, -100, 0, 102, 121, 39, -75, -127,
+    -74, 39, 117, 98, 0, -90, -89, -22, 27, 26, 7, -1,
+    -1, 1, 1, -7, -26, -27, 22, 89, 90, 0, -98, -117,
+    -39, 74, 127, 75, -39, -121, -102, 0, 100, 116, 37, -69,
+    -115, -66, 34, 100, 82, 0, -76, -86, -27, 48, 78, 44,
+    -22, -64, -51, 0, 46, 51, 16, -29, -47, -27, 14, 41,
+    35, 0, -35, -41, -14, 27, 47, 29, -16, -51, -46, 0,
+    51, 64, 22, -44, -78, -48, 27, 86, 76, 0, -82, -100,
+    -34, 66, 115, 69, -37, -116, -100, 0, 102, 121, 39, -75,
+    -127, -74, 39, 117, 98, 0, -90, -89, -22, 27, 26, 7,
+    -1, -1, 1, 1, -7, -26, -27, 22, 89, 90, 0, -98,
+    -117, -39, 74, 127, 75, -39, -121, -102, 0, 100, 116, 37,
+    -69, -115, -66, 34, 100, 82, 0, -76, -86, -27, 48, 78,
+    44, -22, -64, -51, 0, 46, 51, 16, -29, -47, -27, 14,
+    41, 35, 0, -35, -41, -14, 27, 47, 29, -16, -51, -46,
+    0, 51, 64, 22, -44, -78, -48, 27, 86, 76, 0, -82,
+    -100, -34, 66, 115, 69, -37, -116, -100, 0, 102, 121, 39,
+    -75, -127, -74, 39, 117, 98, 0, -90, -89, -22, 27, 26,
+    7, -1, -1, 1, 1, -7, -26, -27, 22, 89, 90, 0,
+    -98, -117, -39, 74, 127, 75, -39, -121, -102, 0, 100, 116,
+    37, -69, -115, -66, 34, 100, 82, 0, -76, -86, -27, 48,
+    78, 44, -22, -64, -51, 0, 46, 51, 16, -29, -47, -27,
+    14, 41, 35, 0, -35, -41, -14, 27, 47, 29, -16, -51,
+    -46, 0, 51, 64, 22, -44, -78, -48, 27, 86, 76, 0,
+    -82, -100, -34, 66, 115, 69, -37, -116, -100, 0, 102, 121,
+    39, -75, -127, -74, 39, 117, 98, 0, -90, -89, -22, 27,
+    26, 7, -1, -1, 1, 1, -7, -26, -27, 22, 89, 90,
+    0, -98, -117, -39, 74, 127, 75, -39, -121, -102, 0, 100,
+    116, 37, -69, -115, -66, 34, 100, 82, 0, -76, -86, -27,
+    48, 78, 44, -22, -64, -51, 0, 46, 51, 16, -29, -47,
+    -27, 14, 41, 35, 0, -35, -41, -14, 27, 47, 29, -16,
+    -51, -46, 0, 51, 64, 22, -44, -78, -48, 27, 86, 76,
+    0, -82, -100, -34, 66, 115, 69, -37, -116, -100, 0, 102,
+    121, 39, -75, -127, -74, 39, 117, 98, 0, -90, -89, -22,
+    27, 26, 7, -1, -1, 1, 1, -7, -26, -27, 22, 89,
+    90, 0, -98, -117, -39, 74, 127, 75, -39, -121, -102, 0,
+    100, 116, 37, -69, -115, -66, 34, 100, 82, 0, -76, -86,
+    -27, 48, 78, 44, -22, -64, -51, 0, 46, 51, 16, -29,
+    -47, -27, 14, 41, 35, 0, -35, -41, -14, 27, 47, 29,
+    -16, -51, -46, 0, 51, 64, 22, -44, -78, -48, 27, 86,
+    76, 0, -82, -100, -34, 66, 115, 69, -37, -116, -100, 0,
+    102, 121, 39, -75, -127, -74, 39, 117, 98, 0, -90, -89,
+    -22, 27, 26, 7, -1, -1, 1, 1, -7, -26, -27, 22,
+    89, 90, 0, -98, -117, -39, 74, 127, 75, -39, -121, -102,
+    0, 100, 116, 37, -69, -115, -66, 34, 100, 82, 0, -76,
+    -86, -27, 48, 78, 44, -22, -64, -51, 0, 46, 51, 16,
+    -29, -47, -27, 14, 41, 35, 0, -35, -41, -14, 27, 47,
+    29, -16, -51, -46, 0, 51, 64, 22, -44, -78, -48, 27,
+    86, 76, 0, -82, -100, -34, 66, 115, 69, -37, -116, -100,
+    0, 102, 121, 39, -75, -127, -74, 39, 117, 98, 0, -90,
+    -89, -22, 27, 26, 7, -1, -1, 1, 1, -7, -26, -27,
+    22, 89, 90, 0, -98, -117, -39, 74, 127, 75, -39, -121,
+    -102, 0, 100, 116, 37, -69, -115, -66, 34, 100, 82, 0,
+    -76, -86, -27, 48, 78, 44, -22, -64, -51, 0, 46, 51,
+    16, -29, -47, -27, 14, 41, 35, 0, -35, -41, -14, 27,
+    47, 29, -16, -51, -46, 0, 51, 64, 22, -44, -78, -48,
+    27, 86, 76, 0, -82, -100, -34, 66, 115, 69, -37, -116,
+    -100, 0, 102, 121, 39, -75, -127, -74, 39, 117, 98, 0,
+    -90, -89, -22, 27, 26, 7, -1, -1, 1, 1, -7, -26,
+    -27, 22, 89, 90, 0, -98, -117, -39, 74, 127, 75, -39,
+    -121, -102, 0, 100, 116, 37, -69, -115, -66, 34, 100, 82,
+    0, -76, -86, -27, 48, 78, 44, -22, -64, -51, 0, 46,
+    51, 16, -29, -47, -27, 14, 41, 35, 0, -35, -41, -14,
+    27, 47, 29, -16, -51, -46, 0, 51, 64, 22, -44, -78,
+    -48, 27, 86, 76, 0, -82, -100, -34, 66, 115, 69, -37,
+    -116, -100, 0, 102, 121, 39, -75, -127, -74, 39, 117, 98,
+    0, -90, -89, -22, 27, 26, 7, -1, -1, 1, 1, -7,
+    -26, -27, 22, 89, 90, 0, -98, -117, -39, 74, 127, 75,
+    -39, -121, -102, 0, 100, 116, 37, -69, -115, -66, 34, 100,
+    82, 0, -76, -86, -27, 48, 78, 44, -22, -64, -51, 0,
+    46, 51, 16, -29, -47, -27, 14, 41, 35, 0, -35, -41,
+    -14, 27, 47, 29, -16, -51, -46, 0, 51, 64, 22, -44,
+    -78, -48, 27, 86, 76, 0, -82, -100, -34, 66, 115, 69,
+    -37, -116, -100, 0, 102, 121, 39, -75, -127, -74, 39, 117,
+    98, 0, -90, -89, -22, 27, 26, 7, -1, -1, 1, 1,
+    -7, -26, -27, 22, 89, 90, 0, -98, -117, -39, 74, 127,
+    75, -39, -121, -102, 0, 100, 116, 37, -69, -115, -66, 34,
+    100, 82, 0, -76, -86, -27, 48, 78, 44, -22, -64, -51,
+    0, 46, 51, 16, -29, -47, -27, 14, 41, 35, 0, -35,
+    -41, -14, 27, 47, 29, -16, -51, -46, 0, 51, 64, 22,
+    -44, -78, -48, 27, 86, 76, 0, -82, -100, -34, 66, 115,
+    69, -37, -116, -100, 0, 102, 121, 39, -75, -127, -74, 39,
+    117, 98, 0, -90, -89, -22, 27, 26, 7, -1, -1, 1,
+    1, -7, -26, -27, 22, 89, 90, 0, -98, -117, -39, 74,
+    127, 75, -39, -121, -102, 0, 100, 116, 37, -69, -115, -66,
+    34, 100, 82, 0, -76, -86, -27, 48, 78, 44, -22, -64,
+    -51, 0, 46, 51, 16, -29, -47, -27, 14, 41, 35, 0,
+    -35, -41, -14, 27, 47, 29, -16, -51, -46, 0, 51, 64,
+    22, -44, -78, -48, 27, 86, 76, 0, -82, -100, -34, 66,
+    115, 69, -37, -116, -100, 0, 102, 121, 39, -75, -127, -74,
+    39, 117, 98, 0, -90, -89, -22, 27, 26, 7, -1, -1,
+    1, 1, -7, -26, -27, 22, 89, 90, 0, -98, -117, -39,
+    74, 127, 75, -39, -121, -102, 0, 100, 116, 37, -69, -115,
+    -66, 34, 100, 82, 0, -76, -86, -27, 48, 78, 44, -22,
+    -64, -51, 0, 46, 51, 16, -29, -47, -27, 14, 41, 35,
+    0, -35, -41, -14, 27, 47, 29, -16, -51, -46, 0, 51,
+    64, 22, -44, -78, -48, 27, 86, 76, 0, -82, -100, -34,
+    66, 115, 69, -37, -116, -100, 0, 102, 121, 39, -75, -127,
+    -74, 39, 117, 98, 0, -90, -89, -22, 27, 26, 7, -1,
+    -1, 1, 1, -7, -26, -27, 22, 89, 90, 0, -98, -117,
+    -39, 74, 127, 75, -39, -121, -102, 0, 100, 116, 37, -69,
+    -115, -66, 34, 100, 82, 0, -76, -86, -27, 48, 78, 44,
+    -22, -64, -51, 0, 46, 51, 16, -29, -47, -27, 14, 41,
+    35, 0, -35, -41, -14, 27, 47, 29, -16, -51, -46, 0,
+    51, 64, 22, -44, -78, -48, 27, 86, 76, 0, -82, -100,
+    -34, 66, 115, 69, -37, -116, -100, 0, 102, 121, 39, -75,
+    -127, -74, 39, 117, 98, 0, -90, -89, -22, 27, 26, 7,
+    -1, -1, 1, 1, -7, -26, -27, 22, 89, 90, 0, -98,
+    -117, -39, 74, 127, 75, -39, -121, -102, 0, 100, 116, 37,
+    -69, -115, -66, 34, 100, 82, 0, -76, -86, -27, 48, 78,
+    44, -22, -64, -51, 0, 46, 51, 16, -29, -47, -27, 14,
+    41, 35, 0, -35, -41, -14, 27, 47, 29, -16, -51, -46,
+    0, 51, 64, 22, -44, -78, -48, 27, 86, 76, 0, -82,
+    -100, -34, 66, 115, 69, -37, -116, -100, 0, 102, 121, 39,
+    -75, -127, -74, 39, 117, 98, 0, -90, -89, -22, 27, 26,
+    7, -1, -1, 1, 1, -7, -26, -27, 22, 89, 90, 0,
+    -98, -117, -39, 74, 127, 75, -39, -121, -102, 0, 100, 116,
+    37, -69, -115, -66, 34, 100, 82, 0, -76, -86, -27, 48,
+    78, 44, -22, -64, -51, 0, 46, 51, 16, -29, -47, -27,
+    14, 41, 35, 0, -35, -41, -14, 27, 47, 29, -16, -51,
+    -46, 0, 51, 64, 22, -44, -78, -48, 27, 86, 76, 0,
+    -82, -100, -34, 66, 115, 69, -37, -116, -100, 0, 102, 121,
+    39, -75, -127, -74, 39, 117, 98, 0, -90, -89, -22, 27,
+    26, 7, -1, -1, 1, 2, -9, -32, -32, 25, 99, 98,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -98, -99, -25, 32, 32, 9, -2,
+    -1, 1, 2, -9, -32, -32, 25, 99, 98, 0, -103, -121,
+    -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121,
+    103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0,
+    103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121,
+    -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121,
+    103, 0, -98, -99, -25, 32, 32, 9, -2, -1, 1, 2,
+    -9, -32, -32, 25, 99, 98, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -98,
+    -99, -25, 32, 32, 9, -2, -1, 1, 2, -9, -32, -32,
+    25, 99, 98, 0, -103, -121, -39, 75, 127, 75, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75,
+    127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -98, -99, -25, 32,
+    32, 9, -2, -1, 1, 1, -5, -19, -20, 16, 64, 64,
+    0, -70, -83, -27, 53, 91, 55, -29, -91, -78, 0, 80,
+    95, 31, -60, -104, -62, 33, 102, 88, 0, -89, -106, -35,
+    67, 114, 68, -36, -111, -95, 0, 96, 114, 37, -71, -122,
+    -72, 38, 117, 100, 0, -101, -119, -39, 74, 126, 74, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 120, 102,
+    0, -102, -119, -39, 73, 124, 73, -38, -117, -99, 0, 98,
+    115, 37, -70, -118, -69, 36, 110, 93, 0, -92, -107, -34,
+    65, 109, 64, -33, -101, -85, 0, 83, 97, 31, -58, -98,
+    -57, 29, 89, 75, 0, -73, -84, -27, 51, 85, 49, -25,
+    -77, -64, 0, 62, 71, 23, -42, -71, -41, 21, 63, 53,
+    0, -50, -58, -18, 34, 57, 33, -17, -50, -41, 0, 39,
+    45, 14, -26, -44, -25, 13, 38, 31, 0, -29, -34, -11,
+    19, 32, 18, -9, -28, -23, 0, 21, 24, 8, -14, -23,
+    -13, 7, 20, 16, 0, -15, -18, -6, 10, 17, 10, -5,
+    -15, -13, 0, 12, 14, 5, -9, -14, -8, 4, 14, 12,
+    0, -12, -14, -5, 9, 15, 9, -5, -15, -13, 0, 14,
+    17, 6, -11, -20, -12, 6, 21, 18, 0, -19, -23, -8,
+    16, 27, 17, -9, -29, -25, 0, 27, 33, 11, -21, -38,
+    -23, 12, 39, 34, 0, -36, -44, -15, 29, 50, 30, -16,
+    -51, -45, 0, 47, 57, 19, -37, -64, -38, 21, 65, 56,
+    0, -58, -70, -23, 45, 78, 47, -25, -78, -67, 0, 70,
+    83, 27, -53, -91, -55, 29, 91, 78, 0, -80, -95, -31,
+    60, 104, 62, -33, -102, -88, 0, 89, 106, 35, -67, -114,
+    -68, 36, 111, 95, 0, -96, -114, -37, 71, 122, 72, -38,
+    -117, -100, 0, 101, 119, 39, -74, -126, -74, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -120, -102, 0, 102,
+    119, 39, -73, -124, -73, 38, 117, 99, 0, -98, -115, -37,
+    70, 118, 69, -36, -110, -93, 0, 92, 107, 34, -65, -109,
+    -64, 33, 101, 85, 0, -83, -97, -31, 58, 98, 57, -29,
+    -89, -75, 0, 73, 84, 27, -51, -85, -49, 25, 77, 64,
+    0, -62, -71, -23, 42, 71, 41, -21, -63, -53, 0, 50,
+    58, 18, -34, -57, -33, 17, 50, 41, 0, -39, -45, -14,
+    26, 44, 25, -13, -38, -31, 0, 29, 34, 11, -19, -32,
+    -18, 9, 28, 23, 0, -21, -24, -8, 14, 23, 13, -7,
+    -20, -16, 0, 15, 18, 6, -10, -17, -10, 5, 15, 13,
+    0, -12, -14, -5, 9, 14, 8, -4, -14, -12, 0, 12,
+    14, 5, -9, -15, -9, 5, 15, 13, 0, -14, -17, -6,
+    11, 20, 12, -6, -21, -18, 0, 19, 23, 8, -16, -27,
+    -17, 9, 29, 25, 0, -27, -33, -11, 21, 38, 23, -12,
+    -39, -34, 0, 36, 44, 15, -29, -50, -30, 16, 51, 45,
+    0, -47, -57, -19, 37, 64, 38, -21, -65, -56, 0, 58,
+    70, 23, -45, -78, -47, 25, 78, 67, 0, -70, -83, -27,
+    53, 91, 55, -29, -91, -78, 0, 80, 95, 31, -60, -104,
+    -62, 33, 102, 88, 0, -89, -106, -35, 67, 114, 68, -36,
+    -111, -95, 0, 96, 114, 37, -71, -122, -72, 38, 117, 100,
+    0, -101, -119, -39, 74, 126, 74, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 120, 102, 0, -102, -119, -39,
+    73, 124, 73, -38, -117, -99, 0, 98, 115, 37, -70, -118,
+    -69, 36, 110, 93, 0, -92, -107, -34, 65, 109, 64, -33,
+    -101, -85, 0, 83, 97, 31, -58, -98, -57, 29, 89, 75,
+    0, -73, -84, -27, 51, 85, 49, -25, -77, -64, 0, 62,
+    71, 23, -42, -71, -41, 21, 63, 53, 0, -50, -58, -18,
+    34, 57, 33, -17, -50, -41, 0, 39, 45, 14, -26, -44,
+    -25, 13, 38, 31, 0, -29, -34, -11, 19, 32, 18, -9,
+    -28, -23, 0, 21, 24, 8, -14, -23, -13, 7, 20, 16,
+    0, -15, -18, -6, 10, 17, 10, -5, -15, -13, 0, 12,
+    14, 5, -9, -14, -8, 4, 14, 12, 0, -12, -14, -5,
+    9, 15, 9, -5, -15, -13, 0, 14, 17, 6, -11, -20,
+    -12, 6, 21, 18, 0, -19, -23, -8, 16, 27, 17, -9,
+    -29, -25, 0, 27, 33, 11, -21, -38, -23, 12, 39, 34,
+    0, -36, -44, -15, 29, 50, 30, -16, -51, -45, 0, 47,
+    57, 19, -37, -64, -38, 21, 65, 56, 0, -58, -70, -23,
+    45, 78, 47, -25, -78, -67, 0, 70, 83, 27, -53, -91,
+    -55, 29, 91, 78, 0, -80, -95, -31, 60, 104, 62, -33,
+    -102, -88, 0, 89, 106, 35, -67, -114, -68, 36, 111, 95,
+    0, -92, -93, -23, 30, 30, 9, -2, -1, 1, 1, -5,
+    -19, -20, 16, 64, 64, 0, -70, -83, -27, 53, 91, 55,
+    -29, -91, -78, 0, 80, 95, 31, -60, -104, -62, 33, 102,
+    88, 0, -89, -106, -35, 67, 114, 68, -36, -111, -95, 0,
+    96, 114, 37, -71, -122, -72, 38, 117, 100, 0, -101, -119,
+    -39, 74, 126, 74, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 120, 102, 0, -102, -119, -39, 73, 124, 73,
+    -38, -117, -99, 0, 98, 115, 37, -70, -118, -69, 36, 110,
+    93, 0, -92, -107, -34, 65, 109, 64, -33, -101, -85, 0,
+    83, 97, 31, -58, -98, -57, 29, 89, 75, 0, -73, -84,
+    -27, 51, 85, 49, -25, -77, -64, 0, 62, 71, 23, -42,
+    -71, -41, 21, 63, 53, 0, -50, -58, -18, 34, 57, 33,
+    -17, -50, -41, 0, 39, 45, 14, -26, -44, -25, 13, 38,
+    31, 0, -29, -34, -11, 19, 32, 18, -9, -28, -23, 0,
+    21, 24, 8, -14, -23, -13, 7, 20, 16, 0, -15, -18,
+    -6, 10, 17, 10, -5, -15, -13, 0, 12, 14, 5, -9,
+    -14, -8, 4, 14, 12, 0, -12, -14, -5, 9, 15, 9,
+    -5, -15, -13, 0, 14, 17, 6, -11, -20, -12, 6, 21,
+    18, 0, -19, -23, -8, 16, 27, 17, -9, -29, -25, 0,
+    27, 33, 11, -21, -38, -23, 12, 39, 34, 0, -36, -44,
+    -15, 29, 50, 30, -16, -51, -45, 0, 47, 57, 19, -37,
+    -64, -38, 21, 65, 56, 0, -58, -70, -23, 45, 78, 47,
+    -25, -78, -67, 0, 70, 83, 27, -53, -91, -55, 29, 91,
+    78, 0, -80, -95, -31, 60, 104, 62, -33, -102, -88, 0,
+    89, 106, 35, -67, -114, -68, 36, 111, 95, 0, -96, -114,
+    -37, 71, 122, 72, -38, -117, -100, 0, 101, 119, 39, -74,
+    -126, -74, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75,
+    -39, -120, -102, 0, 102, 119, 39, -73, -124, -73, 38, 117,
+    99, 0, -98, -115, -37, 70, 118, 69, -36, -110, -93, 0,
+    92, 107, 34, -65, -109, -64, 33, 101, 85, 0, -83, -97,
+    -31, 58, 98, 57, -29, -89, -75, 0, 73, 84, 27, -51,
+    -85, -49, 25, 77, 64, 0, -62, -71, -23, 42, 71, 41,
+    -21, -63, -53, 0, 50, 58, 18, -34, -57, -33, 17, 50,
+    41, 0, -39, -45, -14, 26, 44, 25, -13, -38, -31, 0,
+    29, 34, 11, -19, -32, -18, 9, 28, 23, 0, -21, -24,
+    -8, 14, 23, 13, -7, -20, -16, 0, 15, 18, 6, -10,
+    -17, -10, 5, 15, 13, 0, -12, -14, -5, 9, 14, 8,
+    -4, -14, -12, 0, 12, 14, 5, -9, -15, -9, 5, 15,
+    13, 0, -14, -17, -6, 11, 20, 12, -6, -21, -18, 0,
+    19, 23, 8, -16, -27, -17, 9, 29, 25, 0, -27, -33,
+    -11, 21, 38, 23, -12, -39, -34, 0, 36, 44, 15, -29,
+    -50, -30, 16, 51, 45, 0, -47, -57, -19, 37, 64, 38,
+    -21, -65, -56, 0, 58, 70, 23, -45, -78, -47, 25, 78,
+    67, 0, -70, -83, -27, 53, 91, 55, -29, -91, -78, 0,
+    80, 95, 31, -60, -104, -62, 33, 102, 88, 0, -89, -106,
+    -35, 67, 114, 68, -36, -111, -95, 0, 96, 114, 37, -71,
+    -122, -72, 38, 117, 100, 0, -101, -119, -39, 74, 126, 74,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 120,
+    102, 0, -102, -119, -39, 73, 124, 73, -38, -117, -99, 0,
+    98, 115, 37, -70, -118, -69, 36, 110, 93, 0, -92, -107,
+    -34, 65, 109, 64, -33, -101, -85, 0, 83, 97, 31, -58,
+    -98, -57, 29, 89, 75, 0, -73, -84, -27, 51, 85, 49,
+    -25, -77, -64, 0, 62, 71, 23, -42, -71, -41, 21, 63,
+    53, 0, -50, -58, -18, 34, 57, 33, -17, -50, -41, 0,
+    39, 45, 14, -26, -44, -25, 13, 38, 31, 0, -29, -34,
+    -11, 19, 32, 18, -9, -28, -23, 0, 21, 24, 8, -14,
+    -23, -13, 7, 20, 16, 0, -15, -18, -6, 10, 17, 10,
+    -5, -15, -13, 0, 12, 14, 5, -9, -14, -8, 4, 14,
+    12, 0, -12, -14, -5, 9, 15, 9, -5, -15, -13, 0,
+    14, 17, 6, -11, -20, -12, 6, 21, 18, 0, -19, -23,
+    -8, 16, 27, 17, -9, -29, -25, 0, 27, 33, 11, -21,
+    -38, -23, 12, 39, 34, 0, -36, -44, -15, 29, 50, 30,
+    -16, -51, -45, 0, 47, 57, 19, -37, -64, -38, 21, 65,
+    56, 0, -58, -70, -23, 45, 78, 47, -25, -78, -67, 0,
+    70, 83, 27, -53, -91, -55, 29, 91, 78, 0, -80, -95,
+    -31, 60, 104, 62, -33, -102, -88, 0, 89, 106, 35, -67,
+    -114, -68, 36, 111, 95, 0, -92, -93, -23, 30, 30, 9,
+    -2, -1, 1, 1, -5, -19, -20, 16, 64, 64, 0, -70,
+    -83, -27, 53, 91, 55, -29, -91, -78, 0, 80, 95, 31,
+    -60, -104, -62, 33, 102, 88, 0, -89, -106, -35, 67, 114,
+    68, -36, -111, -95, 0, 96, 114, 37, -71, -122, -72, 38,
+    117, 100, 0, -101, -119, -39, 74, 126, 74, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 120, 102, 0, -102,
+    -119, -39, 73, 124, 73, -38, -117, -99, 0, 98, 115, 37,
+    -70, -118, -69, 36, 110, 93, 0, -92, -107, -34, 65, 109,
+    64, -33, -101, -85, 0, 83, 97, 31, -58, -98, -57, 29,
+    89, 75, 0, -73, -84, -27, 51, 85, 49, -25, -77, -64,
+    0, 62, 71, 23, -42, -71, -41, 21, 63, 53, 0, -50,
+    -58, -18, 34, 57, 33, -17, -50, -41, 0, 39, 45, 14,
+    -26, -44, -25, 13, 38, 31, 0, -29, -34, -11, 19, 32,
+    18, -9, -28, -23, 0, 21, 24, 8, -14, -23, -13, 7,
+    20, 16, 0, -15, -18, -6, 10, 17, 10, -5, -15, -13,
+    0, 12, 14, 5, -9, -14, -8, 4, 14, 12, 0, -12,
+    -14, -5, 9, 15, 9, -5, -15, -13, 0, 14, 17, 6,
+    -11, -20, -12, 6, 21, 18, 0, -19, -23, -8, 16, 27,
+    17, -9, -29, -25, 0, 27, 33, 11, -21, -38, -23, 12,
+    39, 34, 0, -36, -44, -15, 29, 50, 30, -16, -51, -45,
+    0, 47, 57, 19, -37, -64, -38, 21, 65, 56, 0, -58,
+    -70, -23, 45, 78, 47, -25, -78, -67, 0, 70, 83, 27,
+    -53, -91, -55, 29, 91, 78, 0, -80, -95, -31, 60, 104,
+    62, -33, -102, -88, 0, 89, 106, 35, -67, -114, -68, 36,
+    111, 95, 0, -96, -114, -37, 71, 122, 72, -38, -117, -100,
+    0, 101, 119, 39, -74, -126, -74, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -120, -102, 0, 102, 119, 39,
+    -73, -124, -73, 38, 117, 99, 0, -98, -115, -37, 70, 118,
+    69, -36, -110, -93, 0, 92, 107, 34, -65, -109, -64, 33,
+    101, 85, 0, -83, -97, -31, 58, 98, 57, -29, -89, -75,
+    0, 73, 84, 27, -51, -85, -49, 25, 77, 64, 0, -62,
+    -71, -23, 42, 71, 41, -21, -63, -53, 0, 50, 58, 18,
+    -34, -57, -33, 17, 50, 41, 0, -39, -45, -14, 26, 44,
+    25, -13, -38, -31, 0, 29, 34, 11, -19, -32, -18, 9,
+    28, 23, 0, -21, -24, -8, 14, 23, 13, -7, -20, -16,
+    0, 15, 18, 6, -10, -17, -10, 5, 15, 13, 0, -12,
+    -14, -5, 9, 14, 8, -4, -14, -12, 0, 12, 14, 5,
+    -9, -15, -9, 5, 15, 13, 0, -14, -17, -6, 11, 20,
+    12, -6, -21, -18, 0, 19, 23, 8, -16, -27, -17, 9,
+    29, 25, 0, -27, -33, -11, 21, 38, 23, -12, -39, -34,
+    0, 36, 44, 15, -29, -50, -30, 16, 51, 45, 0, -47,
+    -57, -19, 37, 64, 38, -21, -65, -56, 0, 58, 70, 23,
+    -45, -78, -47, 25, 78, 67, 0, -70, -83, -27, 53, 91,
+    55, -29, -91, -78, 0, 80, 95, 31, -60, -104, -62, 33,
+    102, 88, 0, -89, -106, -35, 67, 114, 68, -36, -111, -95,
+    0, 96, 114, 37, -71, -122, -72, 38, 117, 100, 0, -101,
+    -119, -39, 74, 126, 74, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 120, 102, 0, -102, -119, -39, 73, 124,
+    73, -38, -117, -99, 0, 98, 115, 37, -70, -118, -69, 36,
+    110, 93, 0, -92, -107, -34, 65, 109, 64, -33, -101, -85,
+    0, 83, 97, 31, -58, -98, -57, 29, 89, 75, 0, -73,
+    -84, -27, 51, 85, 49, -25, -77, -64, 0, 62, 71, 23,
+    -42, -71, -41, 21, 63, 53, 0, -50, -58, -18, 34, 57,
+    33, -17, -50, -41, 0, 39, 45, 14, -26, -44, -25, 13,
+    38, 31, 0, -29, -34, -11, 19, 32, 18, -9, -28, -23,
+    0, 21, 24, 8, -14, -23, -13, 7, 20, 16, 0, -15,
+    -18, -6, 10, 17, 10, -5, -15, -13, 0, 12, 14, 5,
+    -9, -14, -8, 4, 14, 12, 0, -12, -14, -5, 9, 15,
+    9, -5, -15, -13, 0, 14, 17, 6, -11, -20, -12, 6,
+    21, 18, 0, -19, -23, -8, 16, 27, 17, -9, -29, -25,
+    0, 27, 33, 11, -21, -38, -23, 12, 39, 34, 0, -36,
+    -44, -15, 29, 50, 30, -16, -51, -45, 0, 47, 57, 19,
+    -37, -64, -38, 21, 65, 56, 0, -58, -70, -23, 45, 78,
+    47, -25, -78, -67, 0, 70, 83, 27, -53, -91, -55, 29,
+    91, 78, 0, -80, -95, -31, 60, 104, 62, -33, -102, -88,
+    0, 89, 106, 35, -67, -114, -68, 36, 111, 95, 0, -92,
+    -93, -23, 30, 30, 9, -2, -1, 1, 1, -5, -19, -20,
+    16, 64, 64, 0, -70, -83, -27, 53, 91, 55, -29, -91,
+    -78, 0, 80, 95, 31, -60, -104, -62, 33, 102, 88, 0,
+    -89, -106, -35, 67, 114, 68, -36, -111, -95, 0, 96, 114,
+    37, -71, -122, -72, 38, 117, 100, 0, -101, -119, -39, 74,
+    126, 74, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 120, 102, 0, -102, -119, -39, 73, 124, 73, -38, -117,
+    -99, 0, 98, 115, 37, -70, -118, -69, 36, 110, 93, 0,
+    -92, -107, -34, 65, 109, 64, -33, -101, -85, 0, 83, 97,
+    31, -58, -98, -57, 29, 89, 75, 0, -73, -84, -27, 51,
+    85, 49, -25, -77, -64, 0, 62, 71, 23, -42, -71, -41,
+    21, 63, 53, 0, -50, -58, -18, 34, 57, 33, -17, -50,
+    -41, 0, 39, 45, 14, -26, -44, -25, 13, 38, 31, 0,
+    -29, -34, -11, 19, 32, 18, -9, -28, -23, 0, 21, 24,
+    8, -14, -23, -13, 7, 20, 16, 0, -15, -18, -6, 10,
+    17, 10, -5, -15, -13, 0, 12, 14, 5, -9, -14, -8,
+    4, 14, 12, 0, -12, -14, -5, 9, 15, 9, -5, -15,
+    -13, 0, 14, 17, 6, -11, -20, -12, 6, 21, 18, 0,
+    -19, -23, -8, 16, 27, 17, -9, -29, -25, 0, 27, 33,
+    11, -21, -38, -23, 12, 39, 34, 0, -36, -44, -15, 29,
+    50, 30, -16, -51, -45, 0, 47, 57, 19, -37, -64, -38,
+    21, 65, 56, 0, -58, -70, -23, 45, 78, 47, -25, -78,
+    -67, 0, 70, 83, 27, -53, -91, -55, 29, 91, 78, 0,
+    -80, -95, -31, 60, 104, 62, -33, -102, -88, 0, 89, 106,
+    35, -67, -114, -68, 36, 111, 95, 0, -96, -114, -37, 71,
+    122, 72, -38, -117, -100, 0, 101, 119, 39, -74, -126, -74,
+    39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -120,
+    -102, 0, 102, 119, 39, -73, -124, -73, 38, 117, 99, 0,
+    -98, -115, -37, 70, 118, 69, -36, -110, -93, 0, 92, 107,
+    34, -65, -109, -64, 33, 101, 85, 0, -83, -97, -31, 58,
+    98, 57, -29, -89, -75, 0, 73, 84, 27, -51, -85, -49,
+    25, 77, 64, 0, -62, -71, -23, 42, 71, 41, -21, -63,
+    -53, 0, 50, 58, 18, -34, -57, -33, 17, 50, 41, 0,
+    -39, -45, -14, 26, 44, 25, -13, -38, -31, 0, 29, 34,
+    11, -19, -32, -18, 9, 28, 23, 0, -21, -24, -8, 14,
+    23, 13, -7, -20, -16, 0, 15, 18, 6, -10, -17, -10,
+    5, 15, 13, 0, -12, -14, -5, 9, 14, 8, -4, -14,
+    -12, 0, 12, 14, 5, -9, -15, -9, 5, 15, 13, 0,
+    -14, -17, -6, 11, 20, 12, -6, -21, -18, 0, 19, 23,
+    8, -16, -27, -17, 9, 29, 25, 0, -27, -33, -11, 21,
+    38, 23, -12, -39, -34, 0, 36, 44, 15, -29, -50, -30,
+    16, 51, 45, 0, -47, -57, -19, 37, 64, 38, -21, -65,
+    -56, 0, 58, 70, 23, -45, -78, -47, 25, 78, 67, 0,
+    -70, -83, -27, 53, 91, 55, -29, -91, -78, 0, 80, 95,
+    31, -60, -104, -62, 33, 102, 88, 0, -89, -106, -35, 67,
+    114, 68, -36, -111, -95, 0, 96, 114, 37, -71, -122, -72,
+    38, 117, 100, 0, -101, -119, -39, 74, 126, 74, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 120, 102, 0,
+    -102, -119, -39, 73, 124, 73, -38, -117, -99, 0, 98, 115,
+    37, -70, -118, -69, 36, 110, 93, 0, -92, -107, -34, 65,
+    109, 64, -33, -101, -85, 0, 83, 97, 31, -58, -98, -57,
+    29, 89, 75, 0, -73, -84, -27, 51, 85, 49, -25, -77,
+    -64, 0, 62, 71, 23, -42, -71, -41, 21, 63, 53, 0,
+    -50, -58, -18, 34, 57, 33, -17, -50, -41, 0, 39, 45,
+    14, -26, -44, -25, 13, 38, 31, 0, -29, -34, -11, 19,
+    32, 18, -9, -28, -23, 0, 21, 24, 8, -14, -23, -13,
+    7, 20, 16, 0, -15, -18, -6, 10, 17, 10, -5, -15,
+    -13, 0, 12, 14, 5, -9, -14, -8, 4, 14, 12, 0,
+    -12, -14, -5, 9, 15, 9, -5, -15, -13, 0, 14, 17,
+    6, -11, -20, -12, 6, 21, 18, 0, -19, -23, -8, 16,
+    27, 17, -9, -29, -25, 0, 27, 33, 11, -21, -38, -23,
+    12, 39, 34, 0, -36, -44, -15, 29, 50, 30, -16, -51,
+    -45, 0, 47, 57, 19, -37, -64, -38, 21, 65, 56, 0,
+    -58, -70, -23, 45, 78, 47, -25, -78, -67, 0, 70, 83,
+    27, -53, -91, -55, 29, 91, 78, 0, -80, -95, -31, 60,
+    104, 62, -33, -102, -88, 0, 89, 106, 35, -67, -114, -68,
+    36, 111, 95, 0, -92, -93, -23, 30, 30, 9, -2, -1,
+    1, 2, -9, -32, -32, 25, 99, 98, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -98, -99, -25, 32, 32, 9, -2,
+    -1, 1, 2, -9, -32, -32, 25, 99, 98, 0, -103, -121,
+    -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121,
+    103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0,
+    103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121,
+    -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121,
+    103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0,
+    103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121,
+    -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121,
+    103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0,
+    103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121,
+    -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121,
+    103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0,
+    103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121,
+    -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 121, 103, 0, -98, -99, -25, 32, 32, 9,
+    -2, -1, 1, 2, -9, -32, -32, 25, 99, 98, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -98, -99, -25, 32, 32,
+    9, -2, -1, 1, 2, -9, -32, -32, 25, 99, 98, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75,
+    127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75,
+    127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75,
+    127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75,
+    127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -98, -99, -25, 32,
+    32, 9, -2, -1, 1, 1, -7, -26, -27, 22, 89, 90,
+    0, -98, -117, -39, 74, 127, 75, -39, -121, -102, 0, 100,
+    116, 37, -69, -115, -66, 34, 100, 82, 0, -76, -86, -27,
+    48, 78, 44, -22, -64, -51, 0, 46, 51, 16, -29, -47,
+    -27, 14, 41, 35, 0, -35, -41, -14, 27, 47, 29, -16,
+    -51, -46, 0, 51, 64, 22, -44, -78, -48, 27, 86, 76,
+    0, -82, -100, -34, 66, 115, 69, -37, -116, -100, 0, 102,
+    121, 39, -75, -127, -74, 39, 117, 98, 0, -95, -109, -34,
+    63, 104, 59, -30, -88, -72, 0, 66, 73, 23, -41, -66,
+    -37, 18, 53, 43, 0, -39, -44, -14, 26, 43, 25, -13,
+    -41, -35, 0, 37, 45, 15, -31, -55, -34, 19, 61, 55,
+    0, -61, -76, -26, 52, 92, 56, -31, -98, -86, 0, 92,
+    110, 37, -71, -123, -73, 39, 121, 103, 0, -103, -121, -39,
+    73, 123, 71, -37, -110, -92, 0, 86, 98, 31, -56, -92,
+    -52, 26, 76, 61, 0, -55, -61, -19, 34, 55, 31, -15,
+    -45, -37, 0, 35, 41, 13, -25, -43, -26, 14, 44, 39,
+    0, -43, -53, -18, 37, 66, 41, -23, -73, -66, 0, 72,
+    88, 30, -59, -104, -63, 34, 109, 95, 0, -98, -117, -39,
+    74, 127, 75, -39, -121, -102, 0, 100, 116, 37, -69, -115,
+    -66, 34, 100, 82, 0, -76, -86, -27, 48, 78, 44, -22,
+    -64, -51, 0, 46, 51, 16, -29, -47, -27, 14, 41, 35,
+    0, -35, -41, -14, 27, 47, 29, -16, -51, -46, 0, 51,
+    64, 22, -44, -78, -48, 27, 86, 76, 0, -82, -100, -34,
+    66, 115, 69, -37, -116, -100, 0, 102, 121, 39, -75, -127,
+    -74, 39, 117, 98, 0, -95, -109, -34, 63, 104, 59, -30,
+    -88, -72, 0, 66, 73, 23, -41, -66, -37, 18, 53, 43,
+    0, -39, -44, -14, 26, 43, 25, -13, -41, -35, 0, 37,
+    45, 15, -31, -55, -34, 19, 61, 55, 0, -61, -76, -26,
+    52, 92, 56, -31, -98, -86, 0, 92, 110, 37, -71, -123,
+    -73, 39, 121, 103, 0, -103, -121, -39, 73, 123, 71, -37,
+    -110, -92, 0, 86, 98, 31, -56, -92, -52, 26, 76, 61,
+    0, -55, -61, -19, 34, 55, 31, -15, -45, -37, 0, 35,
+    41, 13, -25, -43, -26, 14, 44, 39, 0, -43, -53, -18,
+    37, 66, 41, -23, -73, -66, 0, 72, 88, 30, -59, -104,
+    -63, 34, 109, 95, 0, -98, -117, -39, 74, 127, 75, -39,
+    -121, -102, 0, 100, 116, 37, -69, -115, -66, 34, 100, 82,
+    0, -76, -86, -27, 48, 78, 44, -22, -64, -51, 0, 46,
+    51, 16, -29, -47, -27, 14, 41, 35, 0, -35, -41, -14,
+    27, 47, 29, -16, -51, -46, 0, 51, 64, 22, -44, -78,
+    -48, 27, 86, 76, 0, -82, -100, -34, 66, 115, 69, -37,
+    -116, -100, 0, 102, 121, 39, -75, -127, -74, 39, 117, 98,
+    0, -95, -109, -34, 63, 104, 59, -30, -88, -72, 0, 66,
+    73, 23, -41, -66, -37, 18, 53, 43, 0, -39, -44, -14,
+    26, 43, 25, -13, -41, -35, 0, 37, 45, 15, -31, -55,
+    -34, 19, 61, 55, 0, -61, -76, -26, 52, 92, 56, -31,
+    -98, -86, 0, 92, 110, 37, -71, -123, -73, 39, 121, 103,
+    0, -103, -121, -39, 73, 123, 71, -37, -110, -92, 0, 86,
+    98, 31, -56, -92, -52, 26, 76, 61, 0, -55, -61, -19,
+    34, 55, 31, -15, -45, -37, 0, 35, 41, 13, -25, -43,
+    -26, 14, 44, 39, 0, -43, -53, -18, 37, 66, 41, -23,
+    -73, -66, 0, 72, 88, 30, -59, -104, -63, 34, 109, 95,
+    0, -98, -117, -39, 74, 127, 75, -39, -121, -102, 0, 100,
+    116, 37, -69, -115, -66, 34, 100, 82, 0, -76, -86, -27,
+    48, 78, 44, -22, -64, -51, 0, 46, 51, 16, -29, -47,
+    -27, 14, 41, 35, 0, -35, -41, -14, 27, 47, 29, -16,
+    -51, -46, 0, 51, 64, 22, -44, -78, -48, 27, 86, 76,
+    0, -82, -100, -34, 66, 115, 69, -37, -116, -100, 0, 102,
+    121, 39, -75, -127, -74, 39, 117, 98, 0, -95, -109, -34,
+    63, 104, 59, -30, -88, -72, 0, 66, 73, 23, -41, -66,
+    -37, 18, 53, 43, 0, -39, -44, -14, 26, 43, 25, -13,
+    -41, -35, 0, 37, 45, 15, -31, -55, -34, 19, 61, 55,
+    0, -61, -76, -26, 52, 92, 56, -31, -98, -86, 0, 92,
+    110, 37, -71, -123, -73, 39, 121, 103, 0, -103, -121, -39,
+    73, 123, 71, -37, -110, -92, 0, 86, 98, 31, -56, -92,
+    -52, 26, 76, 61, 0, -55, -61, -19, 34, 55, 31, -15,
+    -45, -37, 0, 35, 41, 13, -25, -43, -26, 14, 44, 39,
+    0, -41, -44, -11, 16, 16, 5, -1, -1, 1, 1, -7,
+    -26, -27, 22, 89, 90, 0, -98, -117, -39, 74, 127, 75,
+    -39, -121, -102, 0, 100, 116, 37, -69, -115, -66, 34, 100,
+    82, 0, -76, -86, -27, 48, 78, 44, -22, -64, -51, 0,
+    46, 51, 16, -29, -47, -27, 14, 41, 35, 0, -35, -41,
+    -14, 27, 47, 29, -16, -51, -46, 0, 51, 64, 22, -44,
+    -78, -48, 27, 86, 76, 0, -82, -100, -34, 66, 115, 69,
+    -37, -116, -100, 0, 102, 121, 39, -75, -127, -74, 39, 117,
+    98, 0, -95, -109, -34, 63, 104, 59, -30, -88, -72, 0,
+    66, 73, 23, -41, -66, -37, 18, 53, 43, 0, -39, -44,
+    -14, 26, 43, 25, -13, -41, -35, 0, 37, 45, 15, -31,
+    -55, -34, 19, 61, 55, 0, -61, -76, -26, 52, 92, 56,
+    -31, -98, -86, 0, 92, 110, 37, -71, -123, -73, 39, 121,
+    103, 0, -103, -121, -39, 73, 123, 71, -37, -110, -92, 0,
+    86, 98, 31, -56, -92, -52, 26, 76, 61, 0, -55, -61,
+    -19, 34, 55, 31, -15, -45, -37, 0, 35, 41, 13, -25,
+    -43, -26, 14, 44, 39, 0, -43, -53, -18, 37, 66, 41,
+    -23, -73, -66, 0, 72, 88, 30, -59, -104, -63, 34, 109,
+    95, 0, -98, -117, -39, 74, 127, 75, -39, -121, -102, 0,
+    100, 116, 37, -69, -115, -66, 34, 100, 82, 0, -76, -86,
+    -27, 48, 78, 44, -22, -64, -51, 0, 46, 51, 16, -29,
+    -47, -27, 14, 41, 35, 0, -35, -41, -14, 27, 47, 29,
+    -16, -51, -46, 0, 51, 64, 22, -44, -78, -48, 27, 86,
+    76, 0, -82, -100, -34, 66, 115, 69, -37, -116, -100, 0,
+    102, 121, 39, -75, -127, -74, 39, 117, 98, 0, -95, -109,
+    -34, 63, 104, 59, -30, -88, -72, 0, 66, 73, 23, -41,
+    -66, -37, 18, 53, 43, 0, -39, -44, -14, 26, 43, 25,
+    -13, -41, -35, 0, 37, 45, 15, -31, -55, -34, 19, 61,
+    55, 0, -61, -76, -26, 52, 92, 56, -31, -98, -86, 0,
+    92, 110, 37, -71, -123, -73, 39, 121, 103, 0, -103, -121,
+    -39, 73, 123, 71, -37, -110, -92, 0, 86, 98, 31, -56,
+    -92, -52, 26, 76, 61, 0, -55, -61, -19, 34, 55, 31,
+    -15, -45, -37, 0, 35, 41, 13, -25, -43, -26, 14, 44,
+    39, 0, -43, -53, -18, 37, 66, 41, -23, -73, -66, 0,
+    72, 88, 30, -59, -104, -63, 34, 109, 95, 0, -98, -117,
+    -39, 74, 127, 75, -39, -121, -102, 0, 100, 116, 37, -69,
+    -115, -66, 34, 100, 82, 0, -76, -86, -27, 48, 78, 44,
+    -22, -64, -51, 0, 46, 51, 16, -29, -47, -27, 14, 41,
+    35, 0, -35, -41, -14, 27, 47, 29, -16, -51, -46, 0,
+    51, 64, 22, -44, -78, -48, 27, 86, 76, 0, -82, -100,
+    -34, 66, 115, 69, -37, -116, -100, 0, 102, 121, 39, -75,
+    -127, -74, 39, 117, 98, 0, -95, -109, -34, 63, 104, 59,
+    -30, -88, -72, 0, 66, 73, 23, -41, -66, -37, 18, 53,
+    43, 0, -39, -44, -14, 26, 43, 25, -13, -41, -35, 0,
+    37, 45, 15, -31, -55, -34, 19, 61, 55, 0, -61, -76,
+    -26, 52, 92, 56, -31, -98, -86, 0, 92, 110, 37, -71,
+    -123, -73, 39, 121, 103, 0, -103, -121, -39, 73, 123, 71,
+    -37, -110, -92, 0, 86, 98, 31, -56, -92, -52, 26, 76,
+    61, 0, -55, -61, -19, 34, 55, 31, -15, -45, -37, 0,
+    35, 41, 13, -25, -43, -26, 14, 44, 39, 0, -43, -53,
+    -18, 37, 66, 41, -23, -73, -66, 0, 72, 88, 30, -59,
+    -104, -63, 34, 109, 95, 0, -98, -117, -39, 74, 127, 75,
+    -39, -121, -102, 0, 100, 116, 37, -69, -115, -66, 34, 100,
+    82, 0, -76, -86, -27, 48, 78, 44, -22, -64, -51, 0,
+    46, 51, 16, -29, -47, -27, 14, 41, 35, 0, -35, -41,
+    -14, 27, 47, 29, -16, -51, -46, 0, 51, 64, 22, -44,
+    -78, -48, 27, 86, 76, 0, -82, -100, -34, 66, 115, 69,
+    -37, -116, -100, 0, 102, 121, 39, -75, -127, -74, 39, 117,
+    98, 0, -95, -109, -34, 63, 104, 59, -30, -88, -72, 0,
+    66, 73, 23, -41, -66, -37, 18, 53, 43, 0, -39, -44,
+    -14, 26, 43, 25, -13, -41, -35, 0, 37, 45, 15, -31,
+    -55, -34, 19, 61, 55, 0, -61, -76, -26, 52, 92, 56,
+    -31, -98, -86, 0, 92, 110, 37, -71, -123, -73, 39, 121,
+    103, 0, -103, -121, -39, 73, 123, 71, -37, -110, -92, 0,
+    86, 98, 31, -56, -92, -52, 26, 76, 61, 0, -55, -61,
+    -19, 34, 55, 31, -15, -45, -37, 0, 35, 41, 13, -25,
+    -43, -26, 14, 44, 39, 0, -41, -44, -11, 16, 16, 5,
+    -1, -1, 1, 1, -7, -26, -27, 22, 89, 90, 0, -98,
+    -117, -39, 74, 127, 75, -39, -121, -102, 0, 100, 116, 37,
+    -69, -115, -66, 34, 100, 82, 0, -76, -86, -27, 48, 78,
+    44, -22, -64, -51, 0, 46, 51, 16, -29, -47, -27, 14,
+    41, 35, 0, -35, -41, -14, 27, 47, 29, -16, -51, -46,
+    0, 51, 64, 22, -44, -78, -48, 27, 86, 76, 0, -82,
+    -100, -34, 66, 115, 69, -37, -116, -100, 0, 102, 121, 39,
+    -75, -127, -74, 39, 117, 98, 0, -95, -109, -34, 63, 104,
+    59, -30, -88, -72, 0, 66, 73, 23, -41, -66, -37, 18,
+    53, 43, 0, -39, -44, -14, 26, 43, 25, -13, -41, -35,
+    0, 37, 45, 15, -31, -55, -34, 19, 61, 55, 0, -61,
+    -76, -26, 52, 92, 56, -31, -98, -86, 0, 92, 110, 37,
+    -71, -123, -73, 39, 121, 103, 0, -103, -121, -39, 73, 123,
+    71, -37, -110, -92, 0, 86, 98, 31, -56, -92, -52, 26,
+    76, 61, 0, -55, -61, -19, 34, 55, 31, -15, -45, -37,
+    0, 35, 41, 13, -25, -43, -26, 14, 44, 39, 0, -43,
+    -53, -18, 37, 66, 41, -23, -73, -66, 0, 72, 88, 30,
+    -59, -104, -63, 34, 109, 95, 0, -98, -117, -39, 74, 127,
+    75, -39, -121, -102, 0, 100, 116, 37, -69, -115, -66, 34,
+    100, 82, 0, -76, -86, -27, 48, 78, 44, -22, -64, -51,
+    0, 46, 51, 16, -29, -47, -27, 14, 41, 35, 0, -35,
+    -41, -14, 27, 47, 29, -16, -51, -46, 0, 51, 64, 22,
+    -44, -78, -48, 27, 86, 76, 0, -82, -100, -34, 66, 115,
+    69, -37, -116, -100, 0, 102, 121, 39, -75, -127, -74, 39,
+    117, 98, 0, -95, -109, -34, 63, 104, 59, -30, -88, -72,
+    0, 66, 73, 23, -41, -66, -37, 18, 53, 43, 0, -39,
+    -44, -14, 26, 43, 25, -13, -41, -35, 0, 37, 45, 15,
+    -31, -55, -34, 19, 61, 55, 0, -61, -76, -26, 52, 92,
+    56, -31, -98, -86, 0, 92, 110, 37, -71, -123, -73, 39,
+    121, 103, 0, -103, -121, -39, 73, 123, 71, -37, -110, -92,
+    0, 86, 98, 31, -56, -92, -52, 26, 76, 61, 0, -55,
+    -61, -19, 34, 55, 31, -15, -45, -37, 0, 35, 41, 13,
+    -25, -43, -26, 14, 44, 39, 0, -43, -53, -18, 37, 66,
+    41, -23, -73, -66, 0, 72, 88, 30, -59, -104, -63, 34,
+    109, 95, 0, -98, -117, -39, 74, 127, 75, -39, -121, -102,
+    0, 100, 116, 37, -69, -115, -66, 34, 100, 82, 0, -76,
+    -86, -27, 48, 78, 44, -22, -64, -51, 0, 46, 51, 16,
+    -29, -47, -27, 14, 41, 35, 0, -35, -41, -14, 27, 47,
+    29, -16, -51, -46, 0, 51, 64, 22, -44, -78, -48, 27,
+    86, 76, 0, -82, -100, -34, 66, 115, 69, -37, -116, -100,
+    0, 102, 121, 39, -75, -127, -74, 39, 117, 98, 0, -95,
+    -109, -34, 63, 104, 59, -30, -88, -72, 0, 66, 73, 23,
+    -41, -66, -37, 18, 53, 43, 0, -39, -44, -14, 26, 43,
+    25, -13, -41, -35, 0, 37, 45, 15, -31, -55, -34, 19,
+    61, 55, 0, -61, -76, -26, 52, 92, 56, -31, -98, -86,
+    0, 92, 110, 37, -71, -123, -73, 39, 121, 103, 0, -103,
+    -121, -39, 73, 123, 71, -37, -110, -92, 0, 86, 98, 31,
+    -56, -92, -52, 26, 76, 61, 0, -55, -61, -19, 34, 55,
+    31, -15, -45, -37, 0, 35, 41, 13, -25, -43, -26, 14,
+    44, 39, 0, -43, -53, -18, 37, 66, 41, -23, -73, -66,
+    0, 72, 88, 30, -59, -104, -63, 34, 109, 95, 0, -98,
+    -117, -39, 74, 127, 75, -39, -121, -102, 0, 100, 116, 37,
+    -69, -115, -66, 34, 100, 82, 0, -76, -86, -27, 48, 78,
+    44, -22, -64, -51, 0, 46, 51, 16, -29, -47, -27, 14,
+    41, 35, 0, -35, -41, -14, 27, 47, 29, -16, -51, -46,
+    0, 51, 64, 22, -44, -78, -48, 27, 86, 76, 0, -82,
+    -100, -34, 66, 115, 69, -37, -116, -100, 0, 102, 121, 39,
+    -75, -127, -74, 39, 117, 98, 0, -95, -109, -34, 63, 104,
+    59, -30, -88, -72, 0, 66, 73, 23, -41, -66, -37, 18,
+    53, 43, 0, -39, -44, -14, 26, 43, 25, -13, -41, -35,
+    0, 37, 45, 15, -31, -55, -34, 19, 61, 55, 0, -61,
+    -76, -26, 52, 92, 56, -31, -98, -86, 0, 92, 110, 37,
+    -71, -123, -73, 39, 121, 103, 0, -103, -121, -39, 73, 123,
+    71, -37, -110, -92, 0, 86, 98, 31, -56, -92, -52, 26,
+    76, 61, 0, -55, -61, -19, 34, 55, 31, -15, -45, -37,
+    0, 35, 41, 13, -25, -43, -26, 14, 44, 39, 0, -41,
+    -44, -11, 16, 16, 5, -1, -1, 1, 1, -7, -26, -27,
+    22, 89, 90, 0, -98, -117, -39, 74, 127, 75, -39, -121,
+    -102, 0, 100, 116, 37, -69, -115, -66, 34, 100, 82, 0,
+    -76, -86, -27, 48, 78, 44, -22, -64, -51, 0, 46, 51,
+    16, -29, -47, -27, 14, 41, 35, 0, -35, -41, -14, 27,
+    47, 29, -16, -51, -46, 0, 51, 64, 22, -44, -78, -48,
+    27, 86, 76, 0, -82, -100, -34, 66, 115, 69, -37, -116,
+    -100, 0, 102, 121, 39, -75, -127, -74, 39, 117, 98, 0,
+    -95, -109, -34, 63, 104, 59, -30, -88, -72, 0, 66, 73,
+    23, -41, -66, -37, 18, 53, 43, 0, -39, -44, -14, 26,
+    43, 25, -13, -41, -35, 0, 37, 45, 15, -31, -55, -34,
+    19, 61, 55, 0, -61, -76, -26, 52, 92, 56, -31, -98,
+    -86, 0, 92, 110, 37, -71, -123, -73, 39, 121, 103, 0,
+    -103, -121, -39, 73, 123, 71, -37, -110, -92, 0, 86, 98,
+    31, -56, -92, -52, 26, 76, 61, 0, -55, -61, -19, 34,
+    55, 31, -15, -45, -37, 0, 35, 41, 13, -25, -43, -26,
+    14, 44, 39, 0, -43, -53, -18, 37, 66, 41, -23, -73,
+    -66, 0, 72, 88, 30, -59, -104, -63, 34, 109, 95, 0,
+    -98, -117, -39, 74, 127, 75, -39, -121, -102, 0, 100, 116,
+    37, -69, -115, -66, 34, 100, 82, 0, -76, -86, -27, 48,
+    78, 44, -22, -64, -51, 0, 46, 51, 16, -29, -47, -27,
+    14, 41, 35, 0, -35, -41, -14, 27, 47, 29, -16, -51,
+    -46, 0, 51, 64, 22, -44, -78, -48, 27, 86, 76, 0,
+    -82, -100, -34, 66, 115, 69, -37, -116, -100, 0, 102, 121,
+    39, -75, -127, -74, 39, 117, 98, 0, -95, -109, -34, 63,
+    104, 59, -30, -88, -72, 0, 66, 73, 23, -41, -66, -37,
+    18, 53, 43, 0, -39, -44, -14, 26, 43, 25, -13, -41,
+    -35, 0, 37, 45, 15, -31, -55, -34, 19, 61, 55, 0,
+    -61, -76, -26, 52, 92, 56, -31, -98, -86, 0, 92, 110,
+    37, -71, -123, -73, 39, 121, 103, 0, -103, -121, -39, 73,
+    123, 71, -37, -110, -92, 0, 86, 98, 31, -56, -92, -52,
+    26, 76, 61, 0, -55, -61, -19, 34, 55, 31, -15, -45,
+    -37, 0, 35, 41, 13, -25, -43, -26, 14, 44, 39, 0,
+    -43, -53, -18, 37, 66, 41, -23, -73, -66, 0, 72, 88,
+    30, -59, -104, -63, 34, 109, 95, 0, -98, -117, -39, 74,
+    127, 75, -39, -121, -102, 0, 100, 116, 37, -69, -115, -66,
+    34, 100, 82, 0, -76, -86, -27, 48, 78, 44, -22, -64,
+    -51, 0, 46, 51, 16, -29, -47, -27, 14, 41, 35, 0,
+    -35, -41, -14, 27, 47, 29, -16, -51, -46, 0, 51, 64,
+    22, -44, -78, -48, 27, 86, 76, 0, -82, -100, -34, 66,
+    115, 69, -37, -116, -100, 0, 102, 121, 39, -75, -127, -74,
+    39, 117, 98, 0, -95, -109, -34, 63, 104, 59, -30, -88,
+    -72, 0, 66, 73, 23, -41, -66, -37, 18, 53, 43, 0,
+    -39, -44, -14, 26, 43, 25, -13, -41, -35, 0, 37, 45,
+    15, -31, -55, -34, 19, 61, 55, 0, -61, -76, -26, 52,
+    92, 56, -31, -98, -86, 0, 92, 110, 37, -71, -123, -73,
+    39, 121, 103, 0, -103, -121, -39, 73, 123, 71, -37, -110,
+    -92, 0, 86, 98, 31, -56, -92, -52, 26, 76, 61, 0,
+    -55, -61, -19, 34, 55, 31, -15, -45, -37, 0, 35, 41,
+    13, -25, -43, -26, 14, 44, 39, 0, -43, -53, -18, 37,
+    66, 41, -23, -73, -66, 0, 72, 88, 30, -59, -104, -63,
+    34, 109, 95, 0, -98, -117, -39, 74, 127, 75, -39, -121,
+    -102, 0, 100, 116, 37, -69, -115, -66, 34, 100, 82, 0,
+    -76, -86, -27, 48, 78, 44, -22, -64, -51, 0, 46, 51,
+    16, -29, -47, -27, 14, 41, 35, 0, -35, -41, -14, 27,
+    47, 29, -16, -51, -46, 0, 51, 64, 22, -44, -78, -48,
+    27, 86, 76, 0, -82, -100, -34, 66, 115, 69, -37, -116,
+    -100, 0, 102, 121, 39, -75, -127, -74, 39, 117, 98, 0,
+    -95, -109, -34, 63, 104, 59, -30, -88, -72, 0, 66, 73,
+    23, -41, -66, -37, 18, 53, 43, 0, -39, -44, -14, 26,
+    43, 25, -13, -41, -35, 0, 37, 45, 15, -31, -55, -34,
+    19, 61, 55, 0, -61, -76, -26, 52, 92, 56, -31, -98,
+    -86, 0, 92, 110, 37, -71, -123, -73, 39, 121, 103, 0,
+    -103, -121, -39, 73, 123, 71, -37, -110, -92, 0, 86, 98,
+    31, -56, -92, -52, 26, 76, 61, 0, -55, -61, -19, 34,
+    55, 31, -15, -45, -37, 0, 35, 41, 13, -25, -43, -26,
+    14, 44, 39, 0, -41, -44, -11, 16, 16, 5, -1, -1,
+    2, 6, 15, 28, 46, 63, 74, 76, 71, 64, 54, 41,
+    27, 11, -6, -23, -40, -56, -70, -82, -92, -98, -101, -101,
+    -97, -89, -78, -63, -46, -27, -7, 14, 35, 55, 73, 89,
+    102, 112, 118, 119, 116, 109, 98, 84, 66, 45, 23, 0,
+    -23, -46, -67, -86, -102, -115, -123, -127, -126, -121, -112, -98,
+    -81, -61, -39, -16, 8, 32, 54, 74, 92, 106, 117, 123,
+    125, 122, 115, 104, 89, 71, 51, 30, 7, -15, -36, -56,
+    -74, -89, -100, -107, -111, -111, -106, -98, -87, -73, -56, -38,
+    -19, 0, 19, 36, 52, 66, 77, 84, 89, 90, 88, 83,
+    75, 65, 53, 39, 25, 10, -5, -19, -31, -42, -51, -58,
+    -62, -64, -64, -61, -56, -50, -42, -33, -23, -13, -3, 6,
+    15, 22, 29, 33, 37, 38, 39, 37, 35, 31, 27, 22,
+    16, 11, 5, 0, -5, -9, -12, -15, -16, -17, -17, -17,
+    -16, -14, -12, -10, -7, -5, -3, -1, 1, 2, 3, 4,
+    4, 4, 4, 4, 3, 3, 2, 2, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
+    -1, -1, -1, -1, 0, 0, 1, 2, 3, 4, 5, 6,
+    7, 8, 9, 9, 9, 9, 8, 7, 5, 2, -1, -4,
+    -8, -12, -16, -19, -22, -25, -26, -27, -27, -26, -23, -19,
+    -15, -9, -2, 5, 12, 20, 28, 35, 41, 46, 49, 51,
+    51, 49, 45, 39, 32, 22, 12, 0, -12, -25, -37, -48,
+    -58, -66, -73, -76, -78, -76, -71, -64, -54, -41, -27, -11,
+    6, 23, 40, 56, 70, 82, 92, 98, 101, 101, 97, 89,
+    78, 63, 46, 27, 7, -14, -35, -55, -73, -89, -102, -112,
+    -118, -119, -116, -109, -98, -84, -66, -45, -23, 0, 23, 46,
+    67, 86, 102, 115, 123, 127, 126, 121, 112, 98, 81, 61,
+    39, 16, -8, -32, -54, -74, -92, -106, -117, -123, -125, -122,
+    -115, -104, -89, -71, -51, -30, -7, 15, 36, 56, 74, 89,
+    100, 107, 111, 111, 106, 98, 87, 73, 56, 38, 19, 0,
+    -19, -36, -52, -66, -77, -84, -89, -90, -88, -83, -75, -65,
+    -53, -39, -25, -10, 5, 19, 31, 42, 51, 58, 62, 64,
+    64, 61, 56, 50, 42, 33, 23, 13, 3, -6, -15, -22,
+    -29, -33, -37, -38, -39, -37, -35, -31, -27, -22, -16, -11,
+    -5, 0, 5, 9, 12, 15, 16, 17, 17, 17, 16, 14,
+    12, 10, 7, 5, 3, 1, -1, -2, -3, -4, -4, -4,
+    -4, -4, -3, -3, -2, -2, -1, -1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    1, 1, 0, 0, -1, -2, -3, -4, -5, -6, -7, -8,
+    -9, -9, -9, -9, -8, -7, -5, -2, 1, 4, 8, 12,
+    16, 19, 22, 25, 26, 27, 27, 26, 23, 19, 15, 9,
+    2, -5, -12, -20, -28, -35, -41, -46, -49, -51, -51, -49,
+    -45, -39, -32, -22, -12, 0, 12, 25, 37, 48, 58, 66,
+    73, 76, 78, 76, 71, 64, 54, 41, 27, 11, -6, -23,
+    -40, -56, -70, -82, -92, -98, -101, -101, -97, -89, -78, -63,
+    -46, -27, -7, 14, 35, 55, 73, 89, 102, 112, 118, 119,
+    116, 109, 98, 84, 66, 45, 23, 0, -23, -46, -67, -86,
+    -102, -115, -123, -127, -126, -121, -112, -98, -81, -61, -39, -16,
+    8, 32, 54, 74, 92, 106, 117, 123, 125, 122, 115, 104,
+    89, 71, 51, 30, 7, -15, -36, -56, -74, -89, -100, -107,
+    -111, -111, -106, -98, -87, -73, -56, -38, -19, 0, 19, 36,
+    52, 66, 77, 84, 89, 90, 88, 83, 75, 65, 53, 39,
+    25, 10, -5, -19, -31, -42, -51, -58, -62, -64, -64, -61,
+    -56, -50, -42, -33, -23, -13, -3, 6, 15, 22, 29, 33,
+    37, 38, 39, 37, 35, 31, 27, 22, 16, 11, 5, 0,
+    -5, -9, -12, -15, -16, -17, -17, -17, -16, -14, -12, -10,
+    -7, -5, -3, -1, 1, 2, 3, 4, 4, 4, 4, 4,
+    3, 3, 2, 2, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1,
+    0, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 9,
+    9, 9, 8, 7, 5, 2, -1, -4, -8, -12, -16, -19,
+    -22, -25, -26, -27, -27, -26, -23, -19, -15, -9, -2, 5,
+    12, 20, 28, 35, 41, 46, 49, 51, 51, 49, 45, 39,
+    32, 22, 12, 0, -12, -25, -37, -48, -58, -66, -73, -76,
+    -78, -76, -71, -64, -54, -41, -27, -11, 6, 23, 40, 56,
+    70, 82, 92, 98, 101, 101, 97, 89, 78, 63, 46, 27,
+    7, -14, -35, -55, -73, -89, -102, -112, -112, -97, -73, -47,
+    -25, -10, -3, 2, 6, 15, 28, 46, 63, 74, 76, 71,
+    64, 54, 41, 27, 11, -6, -23, -40, -56, -70, -82, -92,
+    -98, -101, -101, -97, -89, -78, -63, -46, -27, -7, 14, 35,
+    55, 73, 89, 102, 112, 118, 119, 116, 109, 98, 84, 66,
+    45, 23, 0, -23, -46, -67, -86, -102, -115, -123, -127, -126,
+    -121, -112, -98, -81, -61, -39, -16, 8, 32, 54, 74, 92,
+    106, 117, 123, 125, 122, 115, 104, 89, 71, 51, 30, 7,
+    -15, -36, -56, -74, -89, -100, -107, -111, -111, -106, -98, -87,
+    -73, -56, -38, -19, 0, 19, 36, 52, 66, 77, 84, 89,
+    90, 88, 83, 75, 65, 53, 39, 25, 10, -5, -19, -31,
+    -42, -51, -58, -62, -64, -64, -61, -56, -50, -42, -33, -23,
+    -13, -3, 6, 15, 22, 29, 33, 37, 38, 39, 37, 35,
+    31, 27, 22, 16, 11, 5, 0, -5, -9, -12, -15, -16,
+    -17, -17, -17, -16, -14, -12, -10, -7, -5, -3, -1, 1,
+    2, 3, 4, 4, 4, 4, 4, 3, 3, 2, 2, 1,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -1, -1, -1, -1, -1, 0, 0, 1, 2, 3,
+    4, 5, 6, 7, 8, 9, 9, 9, 9, 8, 7, 5,
+    2, -1, -4, -8, -12, -16, -19, -22, -25, -26, -27, -27,
+    -26, -23, -19, -15, -9, -2, 5, 12, 20, 28, 35, 41,
+    46, 49, 51, 51, 49, 45, 39, 32, 22, 12, 0, -12,
+    -25, -37, -48, -58, -66, -73, -76, -78, -76, -71, -64, -54,
+    -41, -27, -11, 6, 23, 40, 56, 70, 82, 92, 98, 101,
+    101, 97, 89, 78, 63, 46, 27, 7, -14, -35, -55, -73,
+    -89, -102, -112, -118, -119, -116, -109, -98, -84, -66, -45, -23,
+    0, 23, 46, 67, 86, 102, 115, 123, 127, 126, 121, 112,
+    98, 81, 61, 39, 16, -8, -32, -54, -74, -92, -106, -117,
+    -123, -125, -122, -115, -104, -89, -71, -51, -30, -7, 15, 36,
+    56, 74, 89, 100, 107, 111, 111, 106, 98, 87, 73, 56,
+    38, 19, 0, -19, -36, -52, -66, -77, -84, -89, -90, -88,
+    -83, -75, -65, -53, -39, -25, -10, 5, 19, 31, 42, 51,
+    58, 62, 64, 64, 61, 56, 50, 42, 33, 23, 13, 3,
+    -6, -15, -22, -29, -33, -37, -38, -39, -37, -35, -31, -27,
+    -22, -16, -11, -5, 0, 5, 9, 12, 15, 16, 17, 17,
+    17, 16, 14, 12, 10, 7, 5, 3, 1, -1, -2, -3,
+    -4, -4, -4, -4, -4, -3, -3, -2, -2, -1, -1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    1, 1, 1, 1, 1, 0, 0, -1, -2, -3, -4, -5,
+    -6, -7, -8, -9, -9, -9, -9, -8, -7, -5, -2, 1,
+    4, 8, 12, 16, 19, 22, 25, 26, 27, 27, 26, 23,
+    19, 15, 9, 2, -5, -12, -20, -28, -35, -41, -46, -49,
+    -51, -51, -49, -45, -39, -32, -22, -12, 0, 12, 25, 37,
+    48, 58, 66, 73, 76, 78, 76, 71, 64, 54, 41, 27,
+    11, -6, -23, -40, -56, -70, -82, -92, -98, -101, -101, -97,
+    -89, -78, -63, -46, -27, -7, 14, 35, 55, 73, 89, 102,
+    112, 118, 119, 116, 109, 98, 84, 66, 45, 23, 0, -23,
+    -46, -67, -86, -102, -115, -123, -127, -126, -121, -112, -98, -81,
+    -61, -39, -16, 8, 32, 54, 74, 92, 106, 117, 123, 125,
+    122, 115, 104, 89, 71, 51, 30, 7, -15, -36, -56, -74,
+    -89, -100, -107, -111, -111, -106, -98, -87, -73, -56, -38, -19,
+    0, 19, 36, 52, 66, 77, 84, 89, 90, 88, 83, 75,
+    65, 53, 39, 25, 10, -5, -19, -31, -42, -51, -58, -62,
+    -64, -64, -61, -56, -50, -42, -33, -23, -13, -3, 6, 15,
+    22, 29, 33, 37, 38, 39, 37, 35, 31, 27, 22, 16,
+    11, 5, 0, -5, -9, -12, -15, -16, -17, -17, -17, -16,
+    -14, -12, -10, -7, -5, -3, -1, 1, 2, 3, 4, 4,
+    4, 4, 4, 3, 3, 2, 2, 1, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1,
+    -1, -1, -1, 0, 0, 1, 2, 3, 4, 5, 6, 7,
+    8, 9, 9, 9, 9, 8, 7, 5, 2, -1, -4, -8,
+    -12, -16, -19, -22, -25, -26, -27, -27, -26, -23, -19, -15,
+    -9, -2, 5, 12, 20, 28, 35, 41, 46, 49, 51, 51,
+    49, 45, 39, 32, 22, 12, 0, -12, -25, -37, -48, -58,
+    -66, -73, -76, -78, -76, -71, -64, -54, -41, -27, -11, 6,
+    23, 40, 56, 70, 82, 92, 98, 101, 101, 97, 89, 78,
+    63, 46, 27, 7, -14, -35, -55, -73, -89, -102, -112, -112,
+    -97, -73, -47, -25, -10, -3, 2, 6, 15, 28, 46, 63,
+    74, 76, 71, 64, 54, 41, 27, 11, -6, -23, -40, -56,
+    -70, -82, -92, -98, -101, -101, -97, -89, -78, -63, -46, -27,
+    -7, 14, 35, 55, 73, 89, 102, 112, 118, 119, 116, 109,
+    98, 84, 66, 45, 23, 0, -23, -46, -67, -86, -102, -115,
+    -123, -127, -126, -121, -112, -98, -81, -61, -39, -16, 8, 32,
+    54, 74, 92, 106, 117, 123, 125, 122, 115, 104, 89, 71,
+    51, 30, 7, -15, -36, -56, -74, -89, -100, -107, -111, -111,
+    -106, -98, -87, -73, -56, -38, -19, 0, 19, 36, 52, 66,
+    77, 84, 89, 90, 88, 83, 75, 65, 53, 39, 25, 10,
+    -5, -19, -31, -42, -51, -58, -62, -64, -64, -61, -56, -50,
+    -42, -33, -23, -13, -3, 6, 15, 22, 29, 33, 37, 38,
+    39, 37, 35, 31, 27, 22, 16, 11, 5, 0, -5, -9,
+    -12, -15, -16, -17, -17, -17, -16, -14, -12, -10, -7, -5,
+    -3, -1, 1, 2, 3, 4, 4, 4, 4, 4, 3, 3,
+    2, 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0,
+    1, 2, 3, 4, 5, 6, 7, 8, 9, 9, 9, 9,
+    8, 7, 5, 2, -1, -4, -8, -12, -16, -19, -22, -25,
+    -26, -27, -27, -26, -23, -19, -15, -9, -2, 5, 12, 20,
+    28, 35, 41, 46, 49, 51, 51, 49, 45, 39, 32, 22,
+    12, 0, -12, -25, -37, -48, -58, -66, -73, -76, -78, -76,
+    -71, -64, -54, -41, -27, -11, 6, 23, 40, 56, 70, 82,
+    92, 98, 101, 101, 97, 89, 78, 63, 46, 27, 7, -14,
+    -35, -55, -73, -89, -102, -112, -118, -119, -116, -109, -98, -84,
+    -66, -45, -23, 0, 23, 46, 67, 86, 102, 115, 123, 127,
+    126, 121, 112, 98, 81, 61, 39, 16, -8, -32, -54, -74,
+    -92, -106, -117, -123, -125, -122, -115, -104, -89, -71, -51, -30,
+    -7, 15, 36, 56, 74, 89, 100, 107, 111, 111, 106, 98,
+    87, 73, 56, 38, 19, 0, -19, -36, -52, -66, -77, -84,
+    -89, -90, -88, -83, -75, -65, -53, -39, -25, -10, 5, 19,
+    31, 42, 51, 58, 62, 64, 64, 61, 56, 50, 42, 33,
+    23, 13, 3, -6, -15, -22, -29, -33, -37, -38, -39, -37,
+    -35, -31, -27, -22, -16, -11, -5, 0, 5, 9, 12, 15,
+    16, 17, 17, 17, 16, 14, 12, 10, 7, 5, 3, 1,
+    -1, -2, -3, -4, -4, -4, -4, -4, -3, -3, -2, -2,
+    -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 1, 1, 0, 0, -1, -2,
+    -3, -4, -5, -6, -7, -8, -9, -9, -9, -9, -8, -7,
+    -5, -2, 1, 4, 8, 12, 16, 19, 22, 25, 26, 27,
+    27, 26, 23, 19, 15, 9, 2, -5, -12, -20, -28, -35,
+    -41, -46, -49, -51, -51, -49, -45, -39, -32, -22, -12, 0,
+    12, 25, 37, 48, 58, 66, 73, 76, 78, 76, 71, 64,
+    54, 41, 27, 11, -6, -23, -40, -56, -70, -82, -92, -98,
+    -101, -101, -97, -89, -78, -63, -46, -27, -7, 14, 35, 55,
+    73, 89, 102, 112, 118, 119, 116, 109, 98, 84, 66, 45,
+    23, 0, -23, -46, -67, -86, -102, -115, -123, -127, -126, -121,
+    -112, -98, -81, -61, -39, -16, 8, 32, 54, 74, 92, 106,
+    117, 123, 125, 122, 115, 104, 89, 71, 51, 30, 7, -15,
+    -36, -56, -74, -89, -100, -107, -111, -111, -106, -98, -87, -73,
+    -56, -38, -19, 0, 19, 36, 52, 66, 77, 84, 89, 90,
+    88, 83, 75, 65, 53, 39, 25, 10, -5, -19, -31, -42,
+    -51, -58, -62, -64, -64, -61, -56, -50, -42, -33, -23, -13,
+    -3, 6, 15, 22, 29, 33, 37, 38, 39, 37, 35, 31,
+    27, 22, 16, 11, 5, 0, -5, -9, -12, -15, -16, -17,
+    -17, -17, -16, -14, -12, -10, -7, -5, -3, -1, 1, 2,
+    3, 4, 4, 4, 4, 4, 3, 3, 2, 2, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    -1, -1, -1, -1, -1, -1, 0, 0, 1, 2, 3, 4,
+    5, 6, 7, 8, 9, 9, 9, 9, 8, 7, 5, 2,
+    -1, -4, -8, -12, -16, -19, -22, -25, -26, -27, -27, -26,
+    -23, -19, -15, -9, -2, 5, 12, 20, 28, 35, 41, 46,
+    49, 51, 51, 49, 45, 39, 32, 22, 12, 0, -12, -25,
+    -37, -48, -58, -66, -73, -76, -78, -76, -71, -64, -54, -41,
+    -27, -11, 6, 23, 40, 56, 70, 82, 92, 98, 101, 101,
+    97, 89, 78, 63, 46, 27, 7, -14, -35, -55, -73, -89,
+    -102, -112, -112, -97, -73, -47, -25, -10, -3, 2, 6, 15,
+    28, 46, 63, 74, 76, 71, 64, 54, 41, 27, 11, -6,
+    -23, -40, -56, -70, -82, -92, -98, -101, -101, -97, -89, -78,
+    -63, -46, -27, -7, 14, 35, 55, 73, 89, 102, 112, 118,
+    119, 116, 109, 98, 84, 66, 45, 23, 0, -23, -46, -67,
+    -86, -102, -115, -123, -127, -126, -121, -112, -98, -81, -61, -39,
+    -16, 8, 32, 54, 74, 92, 106, 117, 123, 125, 122, 115,
+    104, 89, 71, 51, 30, 7, -15, -36, -56, -74, -89, -100,
+    -107, -111, -111, -106, -98, -87, -73, -56, -38, -19, 0, 19,
+    36, 52, 66, 77, 84, 89, 90, 88, 83, 75, 65, 53,
+    39, 25, 10, -5, -19, -31, -42, -51, -58, -62, -64, -64,
+    -61, -56, -50, -42, -33, -23, -13, -3, 6, 15, 22, 29,
+    33, 37, 38, 39, 37, 35, 31, 27, 22, 16, 11, 5,
+    0, -5, -9, -12, -15, -16, -17, -17, -17, -16, -14, -12,
+    -10, -7, -5, -3, -1, 1, 2, 3, 4, 4, 4, 4,
+    4, 3, 3, 2, 2, 1, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1,
+    -1, 0, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9,
+    9, 9, 9, 8, 7, 5, 2, -1, -4, -8, -12, -16,
+    -19, -22, -25, -26, -27, -27, -26, -23, -19, -15, -9, -2,
+    5, 12, 20, 28, 35, 41, 46, 49, 51, 51, 49, 45,
+    39, 32, 22, 12, 0, -12, -25, -37, -48, -58, -66, -73,
+    -76, -78, -76, -71, -64, -54, -41, -27, -11, 6, 23, 40,
+    56, 70, 82, 92, 98, 101, 101, 97, 89, 78, 63, 46,
+    27, 7, -14, -35, -55, -73, -89, -102, -112, -118, -119, -116,
+    -109, -98, -84, -66, -45, -23, 0, 23, 46, 67, 86, 102,
+    115, 123, 127, 126, 121, 112, 98, 81, 61, 39, 16, -8,
+    -32, -54, -74, -92, -106, -117, -123, -125, -122, -115, -104, -89,
+    -71, -51, -30, -7, 15, 36, 56, 74, 89, 100, 107, 111,
+    111, 106, 98, 87, 73, 56, 38, 19, 0, -19, -36, -52,
+    -66, -77, -84, -89, -90, -88, -83, -75, -65, -53, -39, -25,
+    -10, 5, 19, 31, 42, 51, 58, 62, 64, 64, 61, 56,
+    50, 42, 33, 23, 13, 3, -6, -15, -22, -29, -33, -37,
+    -38, -39, -37, -35, -31, -27, -22, -16, -11, -5, 0, 5,
+    9, 12, 15, 16, 17, 17, 17, 16, 14, 12, 10, 7,
+    5, 3, 1, -1, -2, -3, -4, -4, -4, -4, -4, -3,
+    -3, -2, -2, -1, -1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 0,
+    0, -1, -2, -3, -4, -5, -6, -7, -8, -9, -9, -9,
+    -9, -8, -7, -5, -2, 1, 4, 8, 12, 16, 19, 22,
+    25, 26, 27, 27, 26, 23, 19, 15, 9, 2, -5, -12,
+    -20, -28, -35, -41, -46, -49, -51, -51, -49, -45, -39, -32,
+    -22, -12, 0, 12, 25, 37, 48, 58, 66, 73, 76, 78,
+    76, 71, 64, 54, 41, 27, 11, -6, -23, -40, -56, -70,
+    -82, -92, -98, -101, -101, -97, -89, -78, -63, -46, -27, -7,
+    14, 35, 55, 73, 89, 102, 112, 118, 119, 116, 109, 98,
+    84, 66, 45, 23, 0, -23, -46, -67, -86, -102, -115, -123,
+    -127, -126, -121, -112, -98, -81, -61, -39, -16, 8, 32, 54,
+    74, 92, 106, 117, 123, 125, 122, 115, 104, 89, 71, 51,
+    30, 7, -15, -36, -56, -74, -89, -100, -107, -111, -111, -106,
+    -98, -87, -73, -56, -38, -19, 0, 19, 36, 52, 66, 77,
+    84, 89, 90, 88, 83, 75, 65, 53, 39, 25, 10, -5,
+    -19, -31, -42, -51, -58, -62, -64, -64, -61, -56, -50, -42,
+    -33, -23, -13, -3, 6, 15, 22, 29, 33, 37, 38, 39,
+    37, 35, 31, 27, 22, 16, 11, 5, 0, -5, -9, -12,
+    -15, -16, -17, -17, -17, -16, -14, -12, -10, -7, -5, -3,
+    -1, 1, 2, 3, 4, 4, 4, 4, 4, 3, 3, 2,
+    2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 1,
+    2, 3, 4, 5, 6, 7, 8, 9, 9, 9, 9, 8,
+    7, 5, 2, -1, -4, -8, -12, -16, -19, -22, -25, -26,
+    -27, -27, -26, -23, -19, -15, -9, -2, 5, 12, 20, 28,
+    35, 41, 46, 49, 51, 51, 49, 45, 39, 32, 22, 12,
+    0, -12, -25, -37, -48, -58, -66, -73, -76, -78, -76, -71,
+    -64, -54, -41, -27, -11, 6, 23, 40, 56, 70, 82, 92,
+    98, 101, 101, 97, 89, 78, 63, 46, 27, 7, -14, -35,
+    -55, -73, -89, -102, -112, -112, -97, -73, -47, -25, -10, -3,
+    2, 6, 15, 28, 46, 63, 74, 76, 71, 64, 54, 41,
+    27, 11, -6, -23, -40, -56, -70, -82, -92, -98, -101, -101,
+    -97, -89, -78, -63, -46, -27, -7, 14, 35, 55, 73, 89,
+    102, 112, 118, 119, 116, 109, 98, 84, 66, 45, 23, 0,
+    -23, -46, -67, -86, -102, -115, -123, -127, -126, -121, -112, -98,
+    -81, -61, -39, -16, 8, 32, 54, 74, 92, 106, 117, 123,
+    125, 122, 115, 104, 89, 71, 51, 30, 7, -15, -36, -56,
+    -74, -89, -100, -107, -111, -111, -106, -98, -87, -73, -56, -38,
+    -19, 0, 19, 36, 52, 66, 77, 84, 89, 90, 88, 83,
+    75, 65, 53, 39, 25, 10, -5, -19, -31, -42, -51, -58,
+    -62, -64, -64, -61, -56, -50, -42, -33, -23, -13, -3, 6,
+    15, 22, 29, 33, 37, 38, 39, 37, 35, 31, 27, 22,
+    16, 11, 5, 0, -5, -9, -12, -15, -16, -17, -17, -17,
+    -16, -14, -12, -10, -7, -5, -3, -1, 1, 2, 3, 4,
+    4, 4, 4, 4, 3, 3, 2, 2, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
+    -1, -1, -1, -1, 0, 0, 1, 2, 3, 4, 5, 6,
+    7, 8, 9, 9, 9, 9, 8, 7, 5, 2, -1, -4,
+    -8, -12, -16, -19, -22, -25, -26, -27, -27, -26, -23, -19,
+    -15, -9, -2, 5, 12, 20, 28, 35, 41, 46, 49, 51,
+    51, 49, 45, 39, 32, 22, 12, 0, -12, -25, -37, -48,
+    -58, -66, -73, -76, -78, -76, -71, -64, -54, -41, -27, -11,
+    6, 23, 40, 56, 70, 82, 92, 98, 101, 101, 97, 89,
+    78, 63, 46, 27, 7, -14, -35, -55, -73, -89, -102, -112,
+    -118, -119, -116, -109, -98, -84, -66, -45, -23, 0, 23, 46,
+    67, 86, 102, 115, 123, 127, 126, 121, 112, 98, 81, 61,
+    39, 16, -8, -32, -54, -74, -92, -106, -117, -123, -125, -122,
+    -115, -104, -89, -71, -51, -30, -7, 15, 36, 56, 74, 89,
+    100, 107, 111, 111, 106, 98, 87, 73, 56, 38, 19, 0,
+    -19, -36, -52, -66, -77, -84, -89, -90, -88, -83, -75, -65,
+    -53, -39, -25, -10, 5, 19, 31, 42, 51, 58, 62, 64,
+    64, 61, 56, 50, 42, 33, 23, 13, 3, -6, -15, -22,
+    -29, -33, -37, -38, -39, -37, -35, -31, -27, -22, -16, -11,
+    -5, 0, 5, 9, 12, 15, 16, 17, 17, 17, 16, 14,
+    12, 10, 7, 5, 3, 1, -1, -2, -3, -4, -4, -4,
+    -4, -4, -3, -3, -2, -2, -1, -1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    1, 1, 0, 0, -1, -2, -3, -4, -5, -6, -7, -8,
+    -9, -9, -9, -9, -8, -7, -5, -2, 1, 4, 8, 12,
+    16, 19, 22, 25, 26, 27, 27, 26, 23, 19, 15, 9,
+    2, -5, -12, -20, -28, -35, -41, -46, -49, -51, -51, -49,
+    -45, -39, -32, -22, -12, 0, 12, 25, 37, 48, 58, 66,
+    73, 76, 78, 76, 71, 64, 54, 41, 27, 11, -6, -23,
+    -40, -56, -70, -82, -92, -98, -101, -101, -97, -89, -78, -63,
+    -46, -27, -7, 14, 35, 55, 73, 89, 102, 112, 118, 119,
+    116, 109, 98, 84, 66, 45, 23, 0, -23, -46, -67, -86,
+    -102, -115, -123, -127, -126, -121, -112, -98, -81, -61, -39, -16,
+    8, 32, 54, 74, 92, 106, 117, 123, 125, 122, 115, 104,
+    89, 71, 51, 30, 7, -15, -36, -56, -74, -89, -100, -107,
+    -111, -111, -106, -98, -87, -73, -56, -38, -19, 0, 19, 36,
+    52, 66, 77, 84, 89, 90, 88, 83, 75, 65, 53, 39,
+    25, 10, -5, -19, -31, -42, -51, -58, -62, -64, -64, -61,
+    -56, -50, -42, -33, -23, -13, -3, 6, 15, 22, 29, 33,
+    37, 38, 39, 37, 35, 31, 27, 22, 16, 11, 5, 0,
+    -5, -9, -12, -15, -16, -17, -17, -17, -16, -14, -12, -10,
+    -7, -5, -3, -1, 1, 2, 3, 4, 4, 4, 4, 4,
+    3, 3, 2, 2, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1,
+    0, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 9,
+    9, 9, 8, 7, 5, 2, -1, -4, -8, -12, -16, -19,
+    -22, -25, -26, -27, -27, -26, -23, -19, -15, -9, -2, 5,
+    12, 20, 28, 35, 41, 46, 49, 51, 51, 49, 45, 39,
+    32, 22, 12, 0, -12, -25, -37, -48, -58, -66, -73, -76,
+    -78, -76, -71, -64, -54, -41, -27, -11, 6, 23, 40, 56,
+    70, 82, 92, 98, 101, 101, 97, 89, 78, 63, 46, 27,
+    7, -14, -35, -55, -73, -89, -102, -112, -112, -97, -73, -47,
+    -25, -10, -3, 2, 6, 15, 28, 46, 63, 74, 76, 71,
+    64, 54, 41, 27, 11, -6, -23, -40, -56, -70, -82, -92,
+    -98, -101, -101, -97, -89, -78, -63, -46, -27, -7, 14, 35,
+    55, 73, 89, 102, 112, 118, 119, 116, 109, 98, 84, 66,
+    45, 23, 0, -23, -46, -67, -86, -102, -115, -123, -127, -126,
+    -121, -112, -98, -81, -61, -39, -16, 8, 32, 54, 74, 92,
+    106, 117, 123, 125, 122, 115, 104, 89, 71, 51, 30, 7,
+    -15, -36, -56, -74, -89, -100, -107, -111, -111, -106, -98, -87,
+    -73, -56, -38, -19, 0, 19, 36, 52, 66, 77, 84, 89,
+    90, 88, 83, 75, 65, 53, 39, 25, 10, -5, -19, -31,
+    -42, -51, -58, -62, -64, -64, -61, -56, -50, -42, -33, -23,
+    -13, -3, 6, 15, 22, 29, 33, 37, 38, 39, 37, 35,
+    31, 27, 22, 16, 11, 5, 0, -5, -9, -12, -15, -16,
+    -17, -17, -17, -16, -14, -12, -10, -7, -5, -3, -1, 1,
+    2, 3, 4, 4, 4, 4, 4, 3, 3, 2, 2, 1,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -1, -1, -1, -1, -1, 0, 0, 1, 2, 3,
+    4, 5, 6, 7, 8, 9, 9, 9, 9, 8, 7, 5,
+    2, -1, -4, -8, -12, -16, -19, -22, -25, -26, -27, -27,
+    -26, -23, -19, -15, -9, -2, 5, 12, 20, 28, 35, 41,
+    46, 49, 51, 51, 49, 45, 39, 32, 22, 12, 0, -12,
+    -25, -37, -48, -58, -66, -73, -76, -78, -76, -71, -64, -54,
+    -41, -27, -11, 6, 23, 40, 56, 70, 82, 92, 98, 101,
+    101, 97, 89, 78, 63, 46, 27, 7, -14, -35, -55, -73,
+    -89, -102, -112, -118, -119, -116, -109, -98, -84, -66, -45, -23,
+    0, 23, 46, 67, 86, 102, 115, 123, 127, 126, 121, 112,
+    98, 81, 61, 39, 16, -8, -32, -54, -74, -92, -106, -117,
+    -123, -125, -122, -115, -104, -89, -71, -51, -30, -7, 15, 36,
+    56, 74, 89, 100, 107, 111, 111, 106, 98, 87, 73, 56,
+    38, 19, 0, -19, -36, -52, -66, -77, -84, -89, -90, -88,
+    -83, -75, -65, -53, -39, -25, -10, 5, 19, 31, 42, 51,
+    58, 62, 64, 64, 61, 56, 50, 42, 33, 23, 13, 3,
+    -6, -15, -22, -29, -33, -37, -38, -39, -37, -35, -31, -27,
+    -22, -16, -11, -5, 0, 5, 9, 12, 15, 16, 17, 17,
+    17, 16, 14, 12, 10, 7, 5, 3, 1, -1, -2, -3,
+    -4, -4, -4, -4, -4, -3, -3, -2, -2, -1, -1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    1, 1, 1, 1, 1, 0, 0, -1, -2, -3, -4, -5,
+    -6, -7, -8, -9, -9, -9, -9, -8, -7, -5, -2, 1,
+    4, 8, 12, 16, 19, 22, 25, 26, 27, 27, 26, 23,
+    19, 15, 9, 2, -5, -12, -20, -28, -35, -41, -46, -49,
+    -51, -51, -49, -45, -39, -32, -22, -12, 0, 12, 25, 37,
+    48, 58, 66, 73, 76, 78, 76, 71, 64, 54, 41, 27,
+    11, -6, -23, -40, -56, -70, -82, -92, -98, -101, -101, -97,
+    -89, -78, -63, -46, -27, -7, 14, 35, 55, 73, 89, 102,
+    112, 118, 119, 116, 109, 98, 84, 66, 45, 23, 0, -23,
+    -46, -67, -86, -102, -115, -123, -127, -126, -121, -112, -98, -81,
+    -61, -39, -16, 8, 32, 54, 74, 92, 106, 117, 123, 125,
+    122, 115, 104, 89, 71, 51, 30, 7, -15, -36, -56, -74,
+    -89, -100, -107, -111, -111, -106, -98, -87, -73, -56, -38, -19,
+    0, 19, 36, 52, 66, 77, 84, 89, 90, 88, 83, 75,
+    65, 53, 39, 25, 10, -5, -19, -31, -42, -51, -58, -62,
+    -64, -64, -61, -56, -50, -42, -33, -23, -13, -3, 6, 15,
+    22, 29, 33, 37, 38, 39, 37, 35, 31, 27, 22, 16,
+    11, 5, 0, -5, -9, -12, -15, -16, -17, -17, -17, -16,
+    -14, -12, -10, -7, -5, -3, -1, 1, 2, 3, 4, 4,
+    4, 4, 4, 3, 3, 2, 2, 1, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1,
+    -1, -1, -1, 0, 0, 1, 2, 3, 4, 5, 6, 7,
+    8, 9, 9, 9, 9, 8, 7, 5, 2, -1, -4, -8,
+    -12, -16, -19, -22, -25, -26, -27, -27, -26, -23, -19, -15,
+    -9, -2, 5, 12, 20, 28, 35, 41, 46, 49, 51, 51,
+    49, 45, 39, 32, 22, 12, 0, -12, -25, -37, -48, -58,
+    -66, -73, -76, -78, -76, -71, -64, -54, -41, -27, -11, 6,
+    23, 40, 56, 70, 82, 92, 98, 101, 101, 97, 89, 78,
+    63, 46, 27, 7, -14, -35, -55, -73, -89, -102, -112, -112,
+    -97, -73, -47, -25, -10, -3, 2, 6, 15, 28, 46, 63,
+    74, 76, 71, 64, 54, 41, 27, 11, -6, -23, -40, -56,
+    -70, -82, -92, -98, -101, -101, -97, -89, -78, -63, -46, -27,
+    -7, 14, 35, 55, 73, 89, 102, 112, 118, 119, 116, 109,
+    98, 84, 66, 45, 23, 0, -23, -46, -67, -86, -102, -115,
+    -123, -127, -126, -121, -112, -98, -81, -61, -39, -16, 8, 32,
+    54, 74, 92, 106, 117, 123, 125, 122, 115, 104, 89, 71,
+    51, 30, 7, -15, -36, -56, -74, -89, -100, -107, -111, -111,
+    -106, -98, -87, -73, -56, -38, -19, 0, 19, 36, 52, 66,
+    77, 84, 89, 90, 88, 83, 75, 65, 53, 39, 25, 10,
+    -5, -19, -31, -42, -51, -58, -62, -64, -64, -61, -56, -50,
+    -42, -33, -23, -13, -3, 6, 15, 22, 29, 33, 37, 38,
+    39, 37, 35, 31, 27, 22, 16, 11, 5, 0, -5, -9,
+    -12, -15, -16, -17, -17, -17, -16, -14, -12, -10, -7, -5,
+    -3, -1, 1, 2, 3, 4, 4, 4, 4, 4, 3, 3,
+    2, 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0,
+    1, 2, 3, 4, 5, 6, 7, 8, 9, 9, 9, 9,
+    8, 7, 5, 2, -1, -4, -8, -12, -16, -19, -22, -25,
+    -26, -27, -27, -26, -23, -19, -15, -9, -2, 5, 12, 20,
+    28, 35, 41, 46, 49, 51, 51, 49, 45, 39, 32, 22,
+    12, 0, -12, -25, -37, -48, -58, -66, -73, -76, -78, -76,
+    -71, -64, -54, -41, -27, -11, 6, 23, 40, 56, 70, 82,
+    92, 98, 101, 101, 97, 89, 78, 63, 46, 27, 7, -14,
+    -35, -55, -73, -89, -102, -112, -118, -119, -116, -109, -98, -84,
+    -66, -45, -23, 0, 23, 46, 67, 86, 102, 115, 123, 127,
+    126, 121, 112, 98, 81, 61, 39, 16, -8, -32, -54, -74,
+    -92, -106, -117, -123, -125, -122, -115, -104, -89, -71, -51, -30,
+    -7, 15, 36, 56, 74, 89, 100, 107, 111, 111, 106, 98,
+    87, 73, 56, 38, 19, 0, -19, -36, -52, -66, -77, -84,
+    -89, -90, -88, -83, -75, -65, -53, -39, -25, -10, 5, 19,
+    31, 42, 51, 58, 62, 64, 64, 61, 56, 50, 42, 33,
+    23, 13, 3, -6, -15, -22, -29, -33, -37, -38, -39, -37,
+    -35, -31, -27, -22, -16, -11, -5, 0, 5, 9, 12, 15,
+    16, 17, 17, 17, 16, 14, 12, 10, 7, 5, 3, 1,
+    -1, -2, -3, -4, -4, -4, -4, -4, -3, -3, -2, -2,
+    -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 1, 1, 0, 0, -1, -2,
+    -3, -4, -5, -6, -7, -8, -9, -9, -9, -9, -8, -7,
+    -5, -2, 1, 4, 8, 12, 16, 19, 22, 25, 26, 27,
+    27, 26, 23, 19, 15, 9, 2, -5, -12, -20, -28, -35,
+    -41, -46, -49, -51, -51, -49, -45, -39, -32, -22, -12, 0,
+    12, 25, 37, 48, 58, 66, 73, 76, 78, 76, 71, 64,
+    54, 41, 27, 11, -6, -23, -40, -56, -70, -82, -92, -98,
+    -101, -101, -97, -89, -78, -63, -46, -27, -7, 14, 35, 55,
+    73, 89, 102, 112, 118, 119, 116, 109, 98, 84, 66, 45,
+    23, 0, -23, -46, -67, -86, -102, -115, -123, -127, -126, -121,
+    -112, -98, -81, -61, -39, -16, 8, 32, 54, 74, 92, 106,
+    117, 123, 125, 122, 115, 104, 89, 71, 51, 30, 7, -15,
+    -36, -56, -74, -89, -100, -107, -111, -111, -106, -98, -87, -73,
+    -56, -38, -19, 0, 19, 36, 52, 66, 77, 84, 89, 90,
+    88, 83, 75, 65, 53, 39, 25, 10, -5, -19, -31, -42,
+    -51, -58, -62, -64, -64, -61, -56, -50, -42, -33, -23, -13,
+    -3, 6, 15, 22, 29, 33, 37, 38, 39, 37, 35, 31,
+    27, 22, 16, 11, 5, 0, -5, -9, -12, -15, -16, -17,
+    -17, -17, -16, -14, -12, -10, -7, -5, -3, -1, 1, 2,
+    3, 4, 4, 4, 4, 4, 3, 3, 2, 2, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    -1, -1, -1, -1, -1, -1, 0, 0, 1, 2, 3, 4,
+    5, 6, 7, 8, 9, 9, 9, 9, 8, 7, 5, 2,
+    -1, -4, -8, -12, -16, -19, -22, -25, -26, -27, -27, -26,
+    -23, -19, -15, -9, -2, 5, 12, 20, 28, 35, 41, 46,
+    49, 51, 51, 49, 45, 39, 32, 22, 12, 0, -12, -25,
+    -37, -48, -58, -66, -73, -76, -78, -76, -71, -64, -54, -41,
+    -27, -11, 6, 23, 40, 56, 70, 82, 92, 98, 101, 101,
+    97, 89, 78, 63, 46, 27, 7, -14, -35, -55, -73, -89,
+    -102, -112, -112, -97, -73, -47, -25, -10, -3, 2, 6, 15,
+    28, 46, 63, 74, 76, 71, 64, 54, 41, 27, 11, -6,
+    -23, -40, -56, -70, -82, -92, -98, -101, -101, -97, -89, -78,
+    -63, -46, -27, -7, 14, 35, 55, 73, 89, 102, 112, 118,
+    119, 116, 109, 98, 84, 66, 45, 23, 0, -23, -46, -67,
+    -86, -102, -115, -123, -127, -126, -121, -112, -98, -81, -61, -39,
+    -16, 8, 32, 54, 74, 92, 106, 117, 123, 125, 122, 115,
+    104, 89, 71, 51, 30, 7, -15, -36, -56, -74, -89, -100,
+    -107, -111, -111, -106, -98, -87, -73, -56, -38, -19, 0, 19,
+    36, 52, 66, 77, 84, 89, 90, 88, 83, 75, 65, 53,
+    39, 25, 10, -5, -19, -31, -42, -51, -58, -62, -64, -64,
+    -61, -56, -50, -42, -33, -23, -13, -3, 6, 15, 22, 29,
+    33, 37, 38, 39, 37, 35, 31, 27, 22, 16, 11, 5,
+    0, -5, -9, -12, -15, -16, -17, -17, -17, -16, -14, -12,
+    -10, -7, -5, -3, -1, 1, 2, 3, 4, 4, 4, 4,
+    4, 3, 3, 2, 2, 1, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1,
+    -1, 0, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9,
+    9, 9, 9, 8, 7, 5, 2, -1, -4, -8, -12, -16,
+    -19, -22, -25, -26, -27, -27, -26, -23, -19, -15, -9, -2,
+    5, 12, 20, 28, 35, 41, 46, 49, 51, 51, 49, 45,
+    39, 32, 22, 12, 0, -12, -25, -37, -48, -58, -66, -73,
+    -76, -78, -76, -71, -64, -54, -41, -27, -11, 6, 23, 40,
+    56, 70, 82, 92, 98, 101, 101, 97, 89, 78, 63, 46,
+    27, 7, -14, -35, -55, -73, -89, -102, -112, -118, -119, -116,
+    -109, -98, -84, -66, -45, -23, 0, 23, 46, 67, 86, 102,
+    115, 123, 127, 126, 121, 112, 98, 81, 61, 39, 16, -8,
+    -32, -54, -74, -92, -106, -117, -123, -125, -122, -115, -104, -89,
+    -71, -51, -30, -7, 15, 36, 56, 74, 89, 100, 107, 111,
+    111, 106, 98, 87, 73, 56, 38, 19, 0, -19, -36, -52,
+    -66, -77, -84, -89, -90, -88, -83, -75, -65, -53, -39, -25,
+    -10, 5, 19, 31, 42, 51, 58, 62, 64, 64, 61, 56,
+    50, 42, 33, 23, 13, 3, -6, -15, -22, -29, -33, -37,
+    -38, -39, -37, -35, -31, -27, -22, -16, -11, -5, 0, 5,
+    9, 12, 15, 16, 17, 17, 17, 16, 14, 12, 10, 7,
+    5, 3, 1, -1, -2, -3, -4, -4, -4, -4, -4, -3,
+    -3, -2, -2, -1, -1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 0,
+    0, -1, -2, -3, -4, -5, -6, -7, -8, -9, -9, -9,
+    -9, -8, -7, -5, -2, 1, 4, 8, 12, 16, 19, 22,
+    25, 26, 27, 27, 26, 23, 19, 15, 9, 2, -5, -12,
+    -20, -28, -35, -41, -46, -49, -51, -51, -49, -45, -39, -32,
+    -22, -12, 0, 12, 25, 37, 48, 58, 66, 73, 76, 78,
+    76, 71, 64, 54, 41, 27, 11, -6, -23, -40, -56, -70,
+    -82, -92, -98, -101, -101, -97, -89, -78, -63, -46, -27, -7,
+    14, 35, 55, 73, 89, 102, 112, 118, 119, 116, 109, 98,
+    84, 66, 45, 23, 0, -23, -46, -67, -86, -102, -115, -123,
+    -127, -126, -121, -112, -98, -81, -61, -39, -16, 8, 32, 54,
+    74, 92, 106, 117, 123, 125, 122, 115, 104, 89, 71, 51,
+    30, 7, -15, -36, -56, -74, -89, -100, -107, -111, -111, -106,
+    -98, -87, -73, -56, -38, -19, 0, 19, 36, 52, 66, 77,
+    84, 89, 90, 88, 83, 75, 65, 53, 39, 25, 10, -5,
+    -19, -31, -42, -51, -58, -62, -64, -64, -61, -56, -50, -42,
+    -33, -23, -13, -3, 6, 15, 22, 29, 33, 37, 38, 39,
+    37, 35, 31, 27, 22, 16, 11, 5, 0, -5, -9, -12,
+    -15, -16, -17, -17, -17, -16, -14, -12, -10, -7, -5, -3,
+    -1, 1, 2, 3, 4, 4, 4, 4, 4, 3, 3, 2,
+    2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 1,
+    2, 3, 4, 5, 6, 7, 8, 9, 9, 9, 9, 8,
+    7, 5, 2, -1, -4, -8, -12, -16, -19, -22, -25, -26,
+    -27, -27, -26, -23, -19, -15, -9, -2, 5, 12, 20, 28,
+    35, 41, 46, 49, 51, 51, 49, 45, 39, 32, 22, 12,
+    0, -12, -25, -37, -48, -58, -66, -73, -76, -78, -76, -71,
+    -64, -54, -41, -27, -11, 6, 23, 40, 56, 70, 82, 92,
+    98, 101, 101, 97, 89, 78, 63, 46, 27, 7, -14, -35,
+    -55, -73, -89, -102, -112, -112, -97, -73, -47, -25, -10, -3,
+    2, 6, 15, 28, 46, 63, 74, 76, 71, 64, 54, 41,
+    27, 11, -6, -23, -40, -56, -70, -82, -92, -98, -101, -101,
+    -97, -89, -78, -63, -46, -27, -7, 14, 35, 55, 73, 89,
+    102, 112, 118, 119, 116, 109, 98, 84, 66, 45, 23, 0,
+    -23, -46, -67, -86, -102, -115, -123, -127, -126, -121, -112, -98,
+    -81, -61, -39, -16, 8, 32, 54, 74, 92, 106, 117, 123,
+    125, 122, 115, 104, 89, 71, 51, 30, 7, -15, -36, -56,
+    -74, -89, -100, -107, -111, -111, -106, -98, -87, -73, -56, -38,
+    -19, 0, 19, 36, 52, 66, 77, 84, 89, 90, 88, 83,
+    75, 65, 53, 39, 25, 10, -5, -19, -31, -42, -51, -58,
+    -62, -64, -64, -61, -56, -50, -42, -33, -23, -13, -3, 6,
+    15, 22, 29, 33, 37, 38, 39, 37, 35, 31, 27, 22,
+    16, 11, 5, 0, -5, -9, -12, -15, -16, -17, -17, -17,
+    -16, -14, -12, -10, -7, -5, -3, -1, 1, 2, 3, 4,
+    4, 4, 4, 4, 3, 3, 2, 2, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
+    -1, -1, -1, -1, 0, 0, 1, 2, 3, 4, 5, 6,
+    7, 8, 9, 9, 9, 9, 8, 7, 5, 2, -1, -4,
+    -8, -12, -16, -19, -22, -25, -26, -27, -27, -26, -23, -19,
+    -15, -9, -2, 5, 12, 20, 28, 35, 41, 46, 49, 51,
+    51, 49, 45, 39, 32, 22, 12, 0, -12, -25, -37, -48,
+    -58, -66, -73, -76, -78, -76, -71, -64, -54, -41, -27, -11,
+    6, 23, 40, 56, 70, 82, 92, 98, 101, 101, 97, 89,
+    78, 63, 46, 27, 7, -14, -35, -55, -73, -89, -102, -112,
+    -118, -119, -116, -109, -98, -84, -66, -45, -23, 0, 23, 46,
+    67, 86, 102, 115, 123, 127, 126, 121, 112, 98, 81, 61,
+    39, 16, -8, -32, -54, -74, -92, -106, -117, -123, -125, -122,
+    -115, -104, -89, -71, -51, -30, -7, 15, 36, 56, 74, 89,
+    100, 107, 111, 111, 106, 98, 87, 73, 56, 38, 19, 0,
+    -19, -36, -52, -66, -77, -84, -89, -90, -88, -83, -75, -65,
+    -53, -39, -25, -10, 5, 19, 31, 42, 51, 58, 62, 64,
+    64, 61, 56, 50, 42, 33, 23, 13, 3, -6, -15, -22,
+    -29, -33, -37, -38, -39, -37, -35, -31, -27, -22, -16, -11,
+    -5, 0, 5, 9, 12, 15, 16, 17, 17, 17, 16, 14,
+    12, 10, 7, 5, 3, 1, -1, -2, -3, -4, -4, -4,
+    -4, -4, -3, -3, -2, -2, -1, -1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    1, 1, 0, 0, -1, -2, -3, -4, -5, -6, -7, -8,
+    -9, -9, -9, -9, -8, -7, -5, -2, 1, 4, 8, 12,
+    16, 19, 22, 25, 26, 27, 27, 26, 23, 19, 15, 9,
+    2, -5, -12, -20, -28, -35, -41, -46, -49, -51, -51, -49,
+    -45, -39, -32, -22, -12, 0, 12, 25, 37, 48, 58, 66,
+    73, 76, 78, 76, 71, 64, 54, 41, 27, 11, -6, -23,
+    -40, -56, -70, -82, -92, -98, -101, -101, -97, -89, -78, -63,
+    -46, -27, -7, 14, 35, 55, 73, 89, 102, 112, 118, 119,
+    116, 109, 98, 84, 66, 45, 23, 0, -23, -46, -67, -86,
+    -102, -115, -123, -127, -126, -121, -112, -98, -81, -61, -39, -16,
+    8, 32, 54, 74, 92, 106, 117, 123, 125, 122, 115, 104,
+    89, 71, 51, 30, 7, -15, -36, -56, -74, -89, -100, -107,
+    -111, -111, -106, -98, -87, -73, -56, -38, -19, 0, 19, 36,
+    52, 66, 77, 84, 89, 90, 88, 83, 75, 65, 53, 39,
+    25, 10, -5, -19, -31, -42, -51, -58, -62, -64, -64, -61,
+    -56, -50, -42, -33, -23, -13, -3, 6, 15, 22, 29, 33,
+    37, 38, 39, 37, 35, 31, 27, 22, 16, 11, 5, 0,
+    -5, -9, -12, -15, -16, -17, -17, -17, -16, -14, -12, -10,
+    -7, -5, -3, -1, 1, 2, 3, 4, 4, 4, 4, 4,
+    3, 3, 2, 2, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1,
+    0, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 9,
+    9, 9, 8, 7, 5, 2, -1, -4, -8, -12, -16, -19,
+    -22, -25, -26, -27, -27, -26, -23, -19, -15, -9, -2, 5,
+    12, 20, 28, 35, 41, 46, 49, 51, 51, 49, 45, 39,
+    32, 22, 12, 0, -12, -25, -37, -48, -58, -66, -73, -76,
+    -78, -76, -71, -64, -54, -41, -27, -11, 6, 23, 40, 56,
+    70, 82, 92, 98, 101, 101, 97, 89, 78, 63, 46, 27,
+    7, -14, -35, -55, -73, -89, -102, -112, -112, -97, -73, -47,
+    -25, -10, -3, 2, 6, 15, 28, 46, 63, 74, 76, 71,
+    64, 54, 41, 27, 11, -6, -23, -40, -56, -70, -82, -92,
+    -98, -101, -101, -97, -89, -78, -63, -46, -27, -7, 14, 35,
+    55, 73, 89, 102, 112, 118, 119, 116, 109, 98, 84, 66,
+    45, 23, 0, -23, -46, -67, -86, -102, -115, -123, -127, -126,
+    -121, -112, -98, -81, -61, -39, -16, 8, 32, 54, 74, 92,
+    106, 117, 123, 125, 122, 115, 104, 89, 71, 51, 30, 7,
+    -15, -36, -56, -74, -89, -100, -107, -111, -111, -106, -98, -87,
+    -73, -56, -38, -19, 0, 19, 36, 52, 66, 77, 84, 89,
+    90, 88, 83, 75, 65, 53, 39, 25, 10, -5, -19, -31,
+    -42, -51, -58, -62, -64, -64, -61, -56, -50, -42, -33, -23,
+    -13, -3, 6, 15, 22, 29, 33, 37, 38, 39, 37, 35,
+    31, 27, 22, 16, 11, 5, 0, -5, -9, -12, -15, -16,
+    -17, -17, -17, -16, -14, -12, -10, -7, -5, -3, -1, 1,
+    2, 3, 4, 4, 4, 4, 4, 3, 3, 2, 2, 1,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -1, -1, -1, -1, -1, 0, 0, 1, 2, 3,
+    4, 5, 6, 7, 8, 9, 9, 9, 9, 8, 7, 5,
+    2, -1, -4, -8, -12, -16, -19, -22, -25, -26, -27, -27,
+    -26, -23, -19, -15, -9, -2, 5, 12, 20, 28, 35, 41,
+    46, 49, 51, 51, 49, 45, 39, 32, 22, 12, 0, -12,
+    -25, -37, -48, -58, -66, -73, -76, -78, -76, -71, -64, -54,
+    -41, -27, -11, 6, 23, 40, 56, 70, 82, 92, 98, 101,
+    101, 97, 89, 78, 63, 46, 27, 7, -14, -35, -55, -73,
+    -89, -102, -112, -118, -119, -116, -109, -98, -84, -66, -45, -23,
+    0, 23, 46, 67, 86, 102, 115, 123, 127, 126, 121, 112,
+    98, 81, 61, 39, 16, -8, -32, -54, -74, -92, -106, -117,
+    -123, -125, -122, -115, -104, -89, -71, -51, -30, -7, 15, 36,
+    56, 74, 89, 100, 107, 111, 111, 106, 98, 87, 73, 56,
+    38, 19, 0, -19, -36, -52, -66, -77, -84, -89, -90, -88,
+    -83, -75, -65, -53, -39, -25, -10, 5, 19, 31, 42, 51,
+    58, 62, 64, 64, 61, 56, 50, 42, 33, 23, 13, 3,
+    -6, -15, -22, -29, -33, -37, -38, -39, -37, -35, -31, -27,
+    -22, -16, -11, -5, 0, 5, 9, 12, 15, 16, 17, 17,
+    17, 16, 14, 12, 10, 7, 5, 3, 1, -1, -2, -3,
+    -4, -4, -4, -4, -4, -3, -3, -2, -2, -1, -1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    1, 1, 1, 1, 1, 0, 0, -1, -2, -3, -4, -5,
+    -6, -7, -8, -9, -9, -9, -9, -8, -7, -5, -2, 1,
+    4, 8, 12, 16, 19, 22, 25, 26, 27, 27, 26, 23,
+    19, 15, 9, 2, -5, -12, -20, -28, -35, -41, -46, -49,
+    -51, -51, -49, -45, -39, -32, -22, -12, 0, 12, 25, 37,
+    48, 58, 66, 73, 76, 78, 76, 71, 64, 54, 41, 27,
+    11, -6, -23, -40, -56, -70, -82, -92, -98, -101, -101, -97,
+    -89, -78, -63, -46, -27, -7, 14, 35, 55, 73, 89, 102,
+    112, 118, 119, 116, 109, 98, 84, 66, 45, 23, 0, -23,
+    -46, -67, -86, -102, -115, -123, -127, -126, -121, -112, -98, -81,
+    -61, -39, -16, 8, 32, 54, 74, 92, 106, 117, 123, 125,
+    122, 115, 104, 89, 71, 51, 30, 7, -15, -36, -56, -74,
+    -89, -100, -107, -111, -111, -106, -98, -87, -73, -56, -38, -19,
+    0, 19, 36, 52, 66, 77, 84, 89, 90, 88, 83, 75,
+    65, 53, 39, 25, 10, -5, -19, -31, -42, -51, -58, -62,
+    -64, -64, -61, -56, -50, -42, -33, -23, -13, -3, 6, 15,
+    22, 29, 33, 37, 38, 39, 37, 35, 31, 27, 22, 16,
+    11, 5, 0, -5, -9, -12, -15, -16, -17, -17, -17, -16,
+    -14, -12, -10, -7, -5, -3, -1, 1, 2, 3, 4, 4,
+    4, 4, 4, 3, 3, 2, 2, 1, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1,
+    -1, -1, -1, 0, 0, 1, 2, 3, 4, 5, 6, 7,
+    8, 9, 9, 9, 9, 8, 7, 5, 2, -1, -4, -8,
+    -12, -16, -19, -22, -25, -26, -27, -27, -26, -23, -19, -15,
+    -9, -2, 5, 12, 20, 28, 35, 41, 46, 49, 51, 51,
+    49, 45, 39, 32, 22, 12, 0, -12, -25, -37, -48, -58,
+    -66, -73, -76, -78, -76, -71, -64, -54, -41, -27, -11, 6,
+    23, 40, 56, 70, 82, 92, 98, 101, 101, 97, 89, 78,
+    63, 46, 27, 7, -14, -35, -55, -73, -89, -102, -112, -112,
+    -97, -73, -47, -25, -10, -3, 2, 6, 15, 28, 46, 63,
+    74, 76, 71, 64, 54, 41, 27, 11, -6, -23, -40, -56,
+    -70, -82, -92, -98, -101, -101, -97, -89, -78, -63, -46, -27,
+    -7, 14, 35, 55, 73, 89, 102, 112, 118, 119, 116, 109,
+    98, 84, 66, 45, 23, 0, -23, -46, -67, -86, -102, -115,
+    -123, -127, -126, -121, -112, -98, -81, -61, -39, -16, 8, 32,
+    54, 74, 92, 106, 117, 123, 125, 122, 115, 104, 89, 71,
+    51, 30, 7, -15, -36, -56, -74, -89, -100, -107, -111, -111,
+    -106, -98, -87, -73, -56, -38, -19, 0, 19, 36, 52, 66,
+    77, 84, 89, 90, 88, 83, 75, 65, 53, 39, 25, 10,
+    -5, -19, -31, -42, -51, -58, -62, -64, -64, -61, -56, -50,
+    -42, -33, -23, -13, -3, 6, 15, 22, 29, 33, 37, 38,
+    39, 37, 35, 31, 27, 22, 16, 11, 5, 0, -5, -9,
+    -12, -15, -16, -17, -17, -17, -16, -14, -12, -10, -7, -5,
+    -3, -1, 1, 2, 3, 4, 4, 4, 4, 4, 3, 3,
+    2, 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0,
+    1, 2, 3, 4, 5, 6, 7, 8, 9, 9, 9, 9,
+    8, 7, 5, 2, -1, -4, -8, -12, -16, -19, -22, -25,
+    -26, -27, -27, -26, -23, -19, -15, -9, -2, 5, 12, 20,
+    28, 35, 41, 46, 49, 51, 51, 49, 45, 39, 32, 22,
+    12, 0, -12, -25, -37, -48, -58, -66, -73, -76, -78, -76,
+    -71, -64, -54, -41, -27, -11, 6, 23, 40, 56, 70, 82,
+    92, 98, 101, 101, 97, 89, 78, 63, 46, 27, 7, -14,
+    -35, -55, -73, -89, -102, -112, -118, -119, -116, -109, -98, -84,
+    -66, -45, -23, 0, 23, 46, 67, 86, 102, 115, 123, 127,
+    126, 121, 112, 98, 81, 61, 39, 16, -8, -32, -54, -74,
+    -92, -106, -117, -123, -125, -122, -115, -104, -89, -71, -51, -30,
+    -7, 15, 36, 56, 74, 89, 100, 107, 111, 111, 106, 98,
+    87, 73, 56, 38, 19, 0, -19, -36, -52, -66, -77, -84,
+    -89, -90, -88, -83, -75, -65, -53, -39, -25, -10, 5, 19,
+    31, 42, 51, 58, 62, 64, 64, 61, 56, 50, 42, 33,
+    23, 13, 3, -6, -15, -22, -29, -33, -37, -38, -39, -37,
+    -35, -31, -27, -22, -16, -11, -5, 0, 5, 9, 12, 15,
+    16, 17, 17, 17, 16, 14, 12, 10, 7, 5, 3, 1,
+    -1, -2, -3, -4, -4, -4, -4, -4, -3, -3, -2, -2,
+    -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 1, 1, 0, 0, -1, -2,
+    -3, -4, -5, -6, -7, -8, -9, -9, -9, -9, -8, -7,
+    -5, -2, 1, 4, 8, 12, 16, 19, 22, 25, 26, 27,
+    27, 26, 23, 19, 15, 9, 2, -5, -12, -20, -28, -35,
+    -41, -46, -49, -51, -51, -49, -45, -39, -32, -22, -12, 0,
+    12, 25, 37, 48, 58, 66, 73, 76, 78, 76, 71, 64,
+    54, 41, 27, 11, -6, -23, -40, -56, -70, -82, -92, -98,
+    -101, -101, -97, -89, -78, -63, -46, -27, -7, 14, 35, 55,
+    73, 89, 102, 112, 118, 119, 116, 109, 98, 84, 66, 45,
+    23, 0, -23, -46, -67, -86, -102, -115, -123, -127, -126, -121,
+    -112, -98, -81, -61, -39, -16, 8, 32, 54, 74, 92, 106,
+    117, 123, 125, 122, 115, 104, 89, 71, 51, 30, 7, -15,
+    -36, -56, -74, -89, -100, -107, -111, -111, -106, -98, -87, -73,
+    -56, -38, -19, 0, 19, 36, 52, 66, 77, 84, 89, 90,
+    88, 83, 75, 65, 53, 39, 25, 10, -5, -19, -31, -42,
+    -51, -58, -62, -64, -64, -61, -56, -50, -42, -33, -23, -13,
+    -3, 6, 15, 22, 29, 33, 37, 38, 39, 37, 35, 31,
+    27, 22, 16, 11, 5, 0, -5, -9, -12, -15, -16, -17,
+    -17, -17, -16, -14, -12, -10, -7, -5, -3, -1, 1, 2,
+    3, 4, 4, 4, 4, 4, 3, 3, 2, 2, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    -1, -1, -1, -1, -1, -1, 0, 0, 1, 2, 3, 4,
+    5, 6, 7, 8, 9, 9, 9, 9, 8, 7, 5, 2,
+    -1, -4, -8, -12, -16, -19, -22, -25, -26, -27, -27, -26,
+    -23, -19, -15, -9, -2, 5, 12, 20, 28, 35, 41, 46,
+    49, 51, 51, 49, 45, 39, 32, 22, 12, 0, -12, -25,
+    -37, -48, -58, -66, -73, -76, -78, -76, -71, -64, -54, -41,
+    -27, -11, 6, 23, 40, 56, 70, 82, 92, 98, 101, 101,
+    97, 89, 78, 63, 46, 27, 7, -14, -35, -55, -73, -89,
+    -102, -112, -112, -97, -73, -47, -25, -10, -3, 2, 6, 15,
+    28, 46, 63, 74, 76, 71, 64, 54, 41, 27, 11, -6,
+    -23, -40, -56, -70, -82, -92, -98, -101, -101, -97, -89, -78,
+    -63, -46, -27, -7, 14, 35, 55, 73, 89, 102, 112, 118,
+    119, 116, 109, 98, 84, 66, 45, 23, 0, -23, -46, -67,
+    -86, -102, -115, -123, -127, -126, -121, -112, -98, -81, -61, -39,
+    -16, 8, 32, 54, 74, 92, 106, 117, 123, 125, 122, 115,
+    104, 89, 71, 51, 30, 7, -15, -36, -56, -74, -89, -100,
+    -107, -111, -111, -106, -98, -87, -73, -56, -38, -19, 0, 19,
+    36, 52, 66, 77, 84, 89, 90, 88, 83, 75, 65, 53,
+    39, 25, 10, -5, -19, -31, -42, -51, -58, -62, -64, -64,
+    -61, -56, -50, -42, -33, -23, -13, -3, 6, 15, 22, 29,
+    33, 37, 38, 39, 37, 35, 31, 27, 22, 16, 11, 5,
+    0, -5, -9, -12, -15, -16, -17, -17, -17, -16, -14, -12,
+    -10, -7, -5, -3, -1, 1, 2, 3, 4, 4, 4, 4,
+    4, 3, 3, 2, 2, 1, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1,
+    -1, 0, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9,
+    9, 9, 9, 8, 7, 5, 2, -1, -4, -8, -12, -16,
+    -19, -22, -25, -26, -27, -27, -26, -23, -19, -15, -9, -2,
+    5, 12, 20, 28, 35, 41, 46, 49, 51, 51, 49, 45,
+    39, 32, 22, 12, 0, -12, -25, -37, -48, -58, -66, -73,
+    -76, -78, -76, -71, -64, -54, -41, -27, -11, 6, 23, 40,
+    56, 70, 82, 92, 98, 101, 101, 97, 89, 78, 63, 46,
+    27, 7, -14, -35, -55, -73, -89, -102, -112, -118, -119, -116,
+    -109, -98, -84, -66, -45, -23, 0, 23, 46, 67, 86, 102,
+    115, 123, 127, 126, 121, 112, 98, 81, 61, 39, 16, -8,
+    -32, -54, -74, -92, -106, -117, -123, -125, -122, -115, -104, -89,
+    -71, -51, -30, -7, 15, 36, 56, 74, 89, 100, 107, 111,
+    111, 106, 98, 87, 73, 56, 38, 19, 0, -19, -36, -52,
+    -66, -77, -84, -89, -90, -88, -83, -75, -65, -53, -39, -25,
+    -10, 5, 19, 31, 42, 51, 58, 62, 64, 64, 61, 56,
+    50, 42, 33, 23, 13, 3, -6, -15, -22, -29, -33, -37,
+    -38, -39, -37, -35, -31, -27, -22, -16, -11, -5, 0, 5,
+    9, 12, 15, 16, 17, 17, 17, 16, 14, 12, 10, 7,
+    5, 3, 1, -1, -2, -3, -4, -4, -4, -4, -4, -3,
+    -3, -2, -2, -1, -1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 0,
+    0, -1, -2, -3, -4, -5, -6, -7, -8, -9, -9, -9,
+    -9, -8, -7, -5, -2, 1, 4, 8, 12, 16, 19, 22,
+    25, 26, 27, 27, 26, 23, 19, 15, 9, 2, -5, -12,
+    -20, -28, -35, -41, -46, -49, -51, -51, -49, -45, -39, -32,
+    -22, -12, 0, 12, 25, 37, 48, 58, 66, 73, 76, 78,
+    76, 71, 64, 54, 41, 27, 11, -6, -23, -40, -56, -70,
+    -82, -92, -98, -101, -101, -97, -89, -78, -63, -46, -27, -7,
+    14, 35, 55, 73, 89, 102, 112, 118, 119, 116, 109, 98,
+    84, 66, 45, 23, 0, -23, -46, -67, -86, -102, -115, -123,
+    -127, -126, -121, -112, -98, -81, -61, -39, -16, 8, 32, 54,
+    74, 92, 106, 117, 123, 125, 122, 115, 104, 89, 71, 51,
+    30, 7, -15, -36, -56, -74, -89, -100, -107, -111, -111, -106,
+    -98, -87, -73, -56, -38, -19, 0, 19, 36, 52, 66, 77,
+    84, 89, 90, 88, 83, 75, 65, 53, 39, 25, 10, -5,
+    -19, -31, -42, -51, -58, -62, -64, -64, -61, -56, -50, -42,
+    -33, -23, -13, -3, 6, 15, 22, 29, 33, 37, 38, 39,
+    37, 35, 31, 27, 22, 16, 11, 5, 0, -5, -9, -12,
+    -15, -16, -17, -17, -17, -16, -14, -12, -10, -7, -5, -3,
+    -1, 1, 2, 3, 4, 4, 4, 4, 4, 3, 3, 2,
+    2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 1,
+    2, 3, 4, 5, 6, 7, 8, 9, 9, 9, 9, 8,
+    7, 5, 2, -1, -4, -8, -12, -16, -19, -22, -25, -26,
+    -27, -27, -26, -23, -19, -15, -9, -2, 5, 12, 20, 28,
+    35, 41, 46, 49, 51, 51, 49, 45, 39, 32, 22, 12,
+    0, -12, -25, -37, -48, -58, -66, -73, -76, -78, -76, -71,
+    -64, -54, -41, -27, -11, 6, 23, 40, 56, 70, 82, 92,
+    98, 101, 101, 97, 89, 78, 63, 46, 27, 7, -14, -35,
+    -55, -73, -89, -102, -112, -112, -97, -73, -47, -25, -10, -3,
+    1, 1, 0, -1, -1, -1, 1, 2, 2, 0, -3, -3,
+    -1, 3, 5, 3, -2, -6, -6, 0, 7, 9, 3, -7,
+    -12, -8, 4, 15, 13, 0, -15, -19, -7, 13, 24, 15,
+    -8, -27, -25, 0, 27, 34, 12, -23, -41, -25, 14, 44,
+    39, 0, -43, -52, -18, 35, 61, 37, -20, -64, -57, 0,
+    60, 73, 24, -47, -83, -50, 27, 85, 74, 0, -77, -93,
+    -31, 59, 103, 62, -33, -103, -89, 0, 91, 109, 36, -69,
+    -119, -70, 37, 116, 99, 0, -101, -119, -39, 74, 127, 75,
+    -39, -122, -104, 0, 104, 122, 39, -75, -127, -74, 39, 119,
+    101, 0, -99, -116, -37, 70, 119, 69, -36, -109, -91, 0,
+    89, 103, 33, -62, -103, -59, 31, 93, 77, 0, -74, -85,
+    -27, 50, 83, 47, -24, -73, -60, 0, 57, 64, 20, -37,
+    -61, -35, 18, 52, 43, 0, -39, -44, -14, 25, 41, 23,
+    -12, -34, -27, 0, 25, 27, 8, -15, -24, -13, 7, 19,
+    15, 0, -13, -15, -4, 8, 12, 7, -3, -9, -7, 0,
+    6, 6, 2, -3, -5, -3, 1, 3, 3, 0, -2, -2,
+    -1, 1, 1, 1, 0, -1, -1, 1, 1, 0, -1, -1,
+    -1, 1, 2, 2, 0, -3, -3, -1, 3, 5, 3, -2,
+    -6, -6, 0, 7, 9, 3, -7, -12, -8, 4, 15, 13,
+    0, -15, -19, -7, 13, 24, 15, -8, -27, -25, 0, 27,
+    34, 12, -23, -41, -25, 14, 44, 39, 0, -43, -52, -18,
+    35, 61, 37, -20, -64, -57, 0, 60, 73, 24, -47, -83,
+    -50, 27, 85, 74, 0, -77, -93, -31, 59, 103, 62, -33,
+    -103, -89, 0, 91, 109, 36, -69, -119, -70, 37, 116, 99,
+    0, -101, -119, -39, 74, 127, 75, -39, -122, -104, 0, 104,
+    122, 39, -75, -127, -74, 39, 119, 101, 0, -99, -116, -37,
+    70, 119, 69, -36, -109, -91, 0, 89, 103, 33, -62, -103,
+    -59, 31, 93, 77, 0, -74, -85, -27, 50, 83, 47, -24,
+    -73, -60, 0, 57, 64, 20, -37, -61, -35, 18, 52, 43,
+    0, -39, -44, -14, 25, 41, 23, -12, -34, -27, 0, 25,
+    27, 8, -15, -24, -13, 7, 19, 15, 0, -13, -15, -4,
+    8, 12, 7, -3, -9, -7, 0, 6, 6, 2, -3, -5,
+    -3, 1, 3, 3, 0, -2, -2, -1, 1, 1, 1, 0,
+    -1, -1, 1, 1, 0, -1, -1, -1, 1, 2, 2, 0,
+    -3, -3, -1, 3, 5, 3, -2, -6, -6, 0, 7, 9,
+    3, -7, -12, -8, 4, 15, 13, 0, -15, -19, -7, 13,
+    24, 15, -8, -27, -25, 0, 27, 34, 12, -23, -41, -25,
+    14, 44, 39, 0, -43, -52, -18, 35, 61, 37, -20, -64,
+    -57, 0, 60, 73, 24, -47, -83, -50, 27, 85, 74, 0,
+    -77, -93, -31, 59, 103, 62, -33, -103, -89, 0, 91, 109,
+    36, -69, -119, -70, 37, 116, 99, 0, -101, -119, -39, 74,
+    127, 75, -39, -122, -104, 0, 104, 122, 39, -75, -127, -74,
+    39, 119, 101, 0, -99, -116, -37, 70, 119, 69, -36, -109,
+    -91, 0, 89, 103, 33, -62, -103, -59, 31, 93, 77, 0,
+    -74, -85, -27, 50, 83, 47, -24, -73, -60, 0, 57, 64,
+    20, -37, -61, -35, 18, 52, 43, 0, -39, -44, -14, 25,
+    41, 23, -12, -34, -27, 0, 25, 27, 8, -15, -24, -13,
+    7, 19, 15, 0, -13, -15, -4, 8, 12, 7, -3, -9,
+    -7, 0, 6, 6, 2, -3, -5, -3, 1, 3, 3, 0,
+    -2, -2, -1, 1, 1, 1, 0, -1, -1, 1, 1, 0,
+    -1, -1, -1, 1, 2, 2, 0, -3, -3, -1, 3, 5,
+    3, -2, -6, -6, 0, 7, 9, 3, -7, -12, -8, 4,
+    15, 13, 0, -15, -19, -7, 13, 24, 15, -8, -27, -25,
+    0, 27, 34, 12, -23, -41, -25, 14, 44, 39, 0, -43,
+    -52, -18, 35, 61, 37, -20, -64, -57, 0, 60, 73, 24,
+    -47, -83, -50, 27, 85, 74, 0, -77, -93, -31, 59, 103,
+    62, -33, -103, -89, 0, 91, 109, 36, -69, -119, -70, 37,
+    116, 99, 0, -101, -119, -39, 74, 127, 75, -39, -122, -104,
+    0, 104, 122, 39, -75, -127, -74, 39, 119, 101, 0, -99,
+    -116, -37, 70, 119, 69, -36, -109, -91, 0, 89, 103, 33,
+    -62, -103, -59, 31, 93, 77, 0, -74, -85, -27, 50, 83,
+    47, -24, -73, -60, 0, 57, 64, 20, -37, -61, -35, 18,
+    52, 43, 0, -39, -44, -14, 25, 41, 23, -12, -34, -27,
+    0, 25, 27, 8, -15, -24, -13, 7, 19, 15, 0, -13,
+    -15, -4, 8, 12, 7, -3, -9, -7, 0, 6, 6, 2,
+    -3, -5, -3, 1, 3, 3, 0, -2, -2, -1, 1, 1,
+    1, 0, -1, -1, 1, 1, 0, -1, -1, -1, 1, 2,
+    2, 0, -3, -3, -1, 3, 5, 3, -2, -6, -6, 0,
+    7, 9, 3, -7, -12, -8, 4, 15, 13, 0, -15, -19,
+    -7, 13, 24, 15, -8, -27, -25, 0, 27, 34, 12, -23,
+    -41, -25, 14, 44, 39, 0, -43, -52, -18, 35, 61, 37,
+    -20, -64, -57, 0, 60, 73, 24, -47, -83, -50, 27, 85,
+    74, 0, -77, -93, -31, 59, 103, 62, -33, -103, -89, 0,
+    91, 109, 36, -69, -119, -70, 37, 116, 99, 0, -101, -119,
+    -39, 74, 127, 75, -39, -122, -104, 0, 104, 122, 39, -75,
+    -127, -74, 39, 119, 101, 0, -99, -116, -37, 70, 119, 69,
+    -36, -109, -91, 0, 89, 103, 33, -62, -103, -59, 31, 93,
+    77, 0, -74, -85, -27, 50, 83, 47, -24, -73, -60, 0,
+    57, 64, 20, -37, -61, -35, 18, 52, 43, 0, -39, -44,
+    -14, 25, 41, 23, -12, -34, -27, 0, 25, 27, 8, -15,
+    -24, -13, 7, 19, 15, 0, -13, -15, -4, 8, 12, 7,
+    -3, -9, -7, 0, 6, 6, 2, -3, -5, -3, 1, 3,
+    3, 0, -2, -2, -1, 1, 1, 1, 0, -1, -1, 1,
+    1, 0, -1, -1, -1, 1, 2, 2, 0, -3, -3, -1,
+    3, 5, 3, -2, -6, -6, 0, 7, 9, 3, -7, -12,
+    -8, 4, 15, 13, 0, -15, -19, -7, 13, 24, 15, -8,
+    -27, -25, 0, 27, 34, 12, -23, -41, -25, 14, 44, 39,
+    0, -43, -52, -18, 35, 61, 37, -20, -64, -57, 0, 60,
+    73, 24, -47, -83, -50, 27, 85, 74, 0, -77, -93, -31,
+    59, 103, 62, -33, -103, -89, 0, 91, 109, 36, -69, -119,
+    -70, 37, 116, 99, 0, -101, -119, -39, 74, 127, 75, -39,
+    -122, -104, 0, 104, 122, 39, -75, -127, -74, 39, 119, 101,
+    0, -99, -116, -37, 70, 119, 69, -36, -109, -91, 0, 89,
+    103, 33, -62, -103, -59, 31, 93, 77, 0, -74, -85, -27,
+    50, 83, 47, -24, -73, -60, 0, 57, 64, 20, -37, -61,
+    -35, 18, 52, 43, 0, -39, -44, -14, 25, 41, 23, -12,
+    -34, -27, 0, 25, 27, 8, -15, -24, -13, 7, 19, 15,
+    0, -13, -15, -4, 8, 12, 7, -3, -9, -7, 0, 6,
+    6, 2, -3, -5, -3, 1, 3, 3, 0, -2, -2, -1,
+    1, 1, 1, 0, -1, -1, 1, 1, 0, -1, -1, -1,
+    1, 2, 2, 0, -3, -3, -1, 3, 5, 3, -2, -6,
+    -6, 0, 7, 9, 3, -7, -12, -8, 4, 15, 13, 0,
+    -15, -19, -7, 13, 24, 15, -8, -27, -25, 0, 27, 34,
+    12, -23, -41, -25, 14, 44, 39, 0, -43, -52, -18, 35,
+    61, 37, -20, -64, -57, 0, 60, 73, 24, -47, -83, -50,
+    27, 85, 74, 0, -77, -93, -31, 59, 103, 62, -33, -103,
+    -89, 0, 91, 109, 36, -69, -119, -70, 37, 116, 99, 0,
+    -101, -119, -39, 74, 127, 75, -39, -122, -104, 0, 104, 122,
+    39, -75, -127, -74, 39, 119, 101, 0, -99, -116, -37, 70,
+    119, 69, -36, -109, -91, 0, 89, 103, 33, -62, -103, -59,
+    31, 93, 77, 0, -74, -85, -27, 50, 83, 47, -24, -73,
+    -60, 0, 57, 64, 20, -37, -61, -35, 18, 52, 43, 0,
+    -39, -44, -14, 25, 41, 23, -12, -34, -27, 0, 25, 27,
+    8, -15, -24, -13, 7, 19, 15, 0, -13, -15, -4, 8,
+    12, 7, -3, -9, -7, 0, 6, 6, 2, -3, -5, -3,
+    1, 3, 3, 0, -2, -2, -1, 1, 1, 1, 0, -1,
+    -1, 1, 1, 0, -1, -1, -1, 1, 2, 2, 0, -3,
+    -3, -1, 3, 5, 3, -2, -6, -6, 0, 7, 9, 3,
+    -7, -12, -8, 4, 15, 13, 0, -15, -19, -7, 13, 24,
+    15, -8, -27, -25, 0, 27, 34, 12, -23, -41, -25, 14,
+    44, 39, 0, -43, -52, -18, 35, 61, 37, -20, -64, -57,
+    0, 60, 73, 24, -47, -83, -50, 27, 85, 74, 0, -77,
+    -93, -31, 59, 103, 62, -33, -103, -89, 0, 91, 109, 36,
+    -69, -119, -70, 37, 116, 99, 0, -101, -119, -39, 74, 127,
+    75, -39, -122, -104, 0, 104, 122, 39, -75, -127, -74, 39,
+    119, 101, 0, -99, -116, -37, 70, 119, 69, -36, -109, -91,
+    0, 89, 103, 33, -62, -103, -59, 31, 93, 77, 0, -74,
+    -85, -27, 50, 83, 47, -24, -73, -60, 0, 57, 64, 20,
+    -37, -61, -35, 18, 52, 43, 0, -39, -44, -14, 25, 41,
+    23, -12, -34, -27, 0, 25, 27, 8, -15, -24, -13, 7,
+    19, 15, 0, -13, -15, -4, 8, 12, 7, -3, -9, -7,
+    0, 6, 6, 2, -3, -5, -3, 1, 3, 3, 0, -2,
+    -2, -1, 1, 1, 1, 0, -1, -1, 1, 1, 0, -1,
+    -1, -1, 1, 2, 2, 0, -3, -3, -1, 3, 5, 3,
+    -2, -6, -6, 0, 7, 9, 3, -7, -12, -8, 4, 15,
+    13, 0, -15, -19, -7, 13, 24, 15, -8, -27, -25, 0,
+    27, 34, 12, -23, -41, -25, 14, 44, 39, 0, -43, -52,
+    -18, 35, 61, 37, -20, -64, -57, 0, 60, 73, 24, -47,
+    -83, -50, 27, 85, 74, 0, -77, -93, -31, 59, 103, 62,
+    -33, -103, -89, 0, 91, 109, 36, -69, -119, -70, 37, 116,
+    99, 0, -101, -119, -39, 74, 127, 75, -39, -122, -104, 0,
+    104, 122, 39, -75, -127, -74, 39, 119, 101, 0, -99, -116,
+    -37, 70, 119, 69, -36, -109, -91, 0, 89, 103, 33, -62,
+    -103, -59, 31, 93, 77, 0, -74, -85, -27, 50, 83, 47,
+    -24, -73, -60, 0, 57, 64, 20, -37, -61, -35, 18, 52,
+    43, 0, -39, -44, -14, 25, 41, 23, -12, -34, -27, 0,
+    25, 27, 8, -15, -24, -13, 7, 19, 15, 0, -13, -15,
+    -4, 8, 12, 7, -3, -9, -7, 0, 6, 6, 2, -3,
+    -5, -3, 1, 3, 3, 0, -2, -2, -1, 1, 1, 1,
+    0, -1, -1, 1, 1, 0, -1, -1, -1, 1, 2, 2,
+    0, -3, -3, -1, 3, 5, 3, -2, -6, -6, 0, 7,
+    9, 3, -7, -12, -8, 4, 15, 13, 0, -15, -19, -7,
+    13, 24, 15, -8, -27, -25, 0, 27, 34, 12, -23, -41,
+    -25, 14, 44, 39, 0, -43, -52, -18, 35, 61, 37, -20,
+    -64, -57, 0, 60, 73, 24, -47, -83, -50, 27, 85, 74,
+    0, -77, -93, -31, 59, 103, 62, -33, -103, -89, 0, 91,
+    109, 36, -69, -119, -70, 37, 116, 99, 0, -101, -119, -39,
+    74, 127, 75, -39, -122, -104, 0, 104, 122, 39, -75, -127,
+    -74, 39, 119, 101, 0, -99, -116, -37, 70, 119, 69, -36,
+    -109, -91, 0, 89, 103, 33, -62, -103, -59, 31, 93, 77,
+    0, -74, -85, -27, 50, 83, 47, -24, -73, -60, 0, 57,
+    64, 20, -37, -61, -35, 18, 52, 43, 0, -39, -44, -14,
+    25, 41, 23, -12, -34, -27, 0, 25, 27, 8, -15, -24,
+    -13, 7, 19, 15, 0, -13, -15, -4, 8, 12, 7, -3,
+    -9, -7, 0, 6, 6, 2, -3, -5, -3, 1, 3, 3,
+    0, -2, -2, -1, 1, 1, 1, 0, -1, -1, 1, 0,
+    -14, -31, -14, 51, 101, 62, -44, -119, -96, 8, 107, 118,
+    32, -81, -127, -68, 46, 119, 94, -7, -99, -106, -28, 69,
+    104, 54, -36, -90, -68, 5, 68, 71, 18, -44, -65, -33,
+    22, 54, 41, -3, -41, -43, -11, 28, 43, 23, -16, -42,
+    -34, 3, 39, 45, 12, -33, -55, -31, 23, 63, 53, -5,
+    -64, -74, -21, 56, 92, 51, -37, -100, -82, 7, 96, 108,
+    30, -77, -123, -67, 46, 123, 98, -8, -107, -118, -31, 79,
+    123, 65, -44, -112, -87, 7, 90, 96, 25, -61, -91, -47,
+    31, 77, 58, -4, -57, -60, -15, 37, 55, 28, -18, -46,
+    -35, 3, 37, 40, 11, -27, -43, -24, 17, 45, 37, -3,
+    -43, -43, -9, 17, 16, 4, -1, -1, 1, 0, -14, -31,
+    -14, 51, 101, 62, -44, -119, -96, 8, 107, 118, 32, -81,
+    -127, -68, 46, 119, 94, -7, -99, -106, -28, 69, 104, 54,
+    -36, -90, -68, 5, 68, 71, 18, -44, -65, -33, 22, 54,
+    41, -3, -41, -43, -11, 28, 43, 23, -16, -42, -34, 3,
+    39, 45, 12, -33, -55, -31, 23, 63, 53, -5, -64, -74,
+    -21, 56, 92, 51, -37, -100, -82, 7, 96, 108, 30, -77,
+    -123, -67, 46, 123, 98, -8, -107, -118, -31, 79, 123, 65,
+    -44, -112, -87, 7, 90, 96, 25, -61, -91, -47, 31, 77,
+    58, -4, -57, -60, -15, 37, 55, 28, -18, -46, -35, 3,
+    37, 40, 11, -27, -43, -24, 17, 45, 37, -3, -43, -43,
+    -9, 17, 16, 4, -1, -1, 1, 2, -4, -22, -30, 8,
+    78, 98, 22, -83, -122, -60, 54, 125, 93, -16, -112, -115,
+    -24, 85, 122, 58, -50, -114, -82, 14, 93, 93, 19, -65,
+    -90, -42, 35, 78, 55, -9, -59, -58, -11, 39, 54, 25,
+    -21, -47, -33, 6, 38, 39, 8, -29, -43, -21, 19, 46,
+    36, -6, -47, -51, -11, 43, 66, 34, -31, -76, -59, 11,
+    78, 85, 18, -69, -104, -52, 47, 112, 85, -15, -107, -112,
+    -23, 86, 126, 61, -54, -125, -92, 16, 108, 110, 22, -80,
+    -114, -54, 46, 103, 74, -12, -82, -81, -16, 56, 77, 36,
+    -30, -65, -46, 7, 50, 49, 10, -33, -47, -22, 19, 42,
+    31, -5, -37, -39, -8, 31, 47, 24, -22, -48, -31, 4,
+    20, 12, 1, -1, 1, 2, -4, -22, -30, 8, 78, 98,
+    22, -83, -122, -60, 54, 125, 93, -16, -112, -115, -24, 85,
+    122, 58, -50, -114, -82, 14, 93, 93, 19, -65, -90, -42,
+    35, 78, 55, -9, -59, -58, -11, 39, 54, 25, -21, -47,
+    -33, 6, 38, 39, 8, -29, -43, -21, 19, 46, 36, -6,
+    -47, -51, -11, 43, 66, 34, -31, -76, -59, 11, 78, 85,
+    18, -69, -104, -52, 47, 112, 85, -15, -107, -112, -23, 86,
+    126, 61, -54, -125, -92, 16, 108, 110, 22, -80, -114, -54,
+    46, 103, 74, -12, -82, -81, -16, 56, 77, 36, -30, -65,
+    -46, 7, 50, 49, 10, -33, -47, -22, 19, 42, 31, -5,
+    -37, -39, -8, 31, 47, 24, -22, -48, -31, 4, 20, 12,
+    1, -1, 1, 1, -7, -26, -27, 22, 89, 90, 0, -98,
+    -117, -39, 74, 127, 75, -39, -121, -102, 0, 100, 116, 37,
+    -69, -115, -66, 34, 100, 82, 0, -76, -86, -27, 48, 78,
+    44, -22, -64, -51, 0, 46, 51, 16, -29, -47, -27, 14,
+    41, 35, 0, -35, -41, -14, 27, 47, 29, -16, -51, -46,
+    0, 51, 64, 22, -44, -78, -48, 27, 86, 76, 0, -82,
+    -100, -34, 66, 115, 69, -37, -116, -100, 0, 102, 121, 39,
+    -75, -127, -74, 39, 117, 98, 0, -95, -109, -34, 63, 104,
+    59, -30, -88, -72, 0, 66, 73, 23, -41, -66, -37, 18,
+    53, 43, 0, -39, -44, -14, 26, 43, 25, -13, -41, -35,
+    0, 37, 45, 15, -30, -48, -24, 10, 19, 9, 0, -1,
+    1, 1, -7, -26, -27, 22, 89, 90, 0, -98, -117, -39,
+    74, 127, 75, -39, -121, -102, 0, 100, 116, 37, -69, -115,
+    -66, 34, 100, 82, 0, -76, -86, -27, 48, 78, 44, -22,
+    -64, -51, 0, 46, 51, 16, -29, -47, -27, 14, 41, 35,
+    0, -35, -41, -14, 27, 47, 29, -16, -51, -46, 0, 51,
+    64, 22, -44, -78, -48, 27, 86, 76, 0, -82, -100, -34,
+    66, 115, 69, -37, -116, -100, 0, 102, 121, 39, -75, -127,
+    -74, 39, 117, 98, 0, -95, -109, -34, 63, 104, 59, -30,
+    -88, -72, 0, 66, 73, 23, -41, -66, -37, 18, 53, 43,
+    0, -39, -44, -14, 26, 43, 25, -13, -41, -35, 0, 37,
+    45, 15, -30, -48, -24, 10, 19, 9, 0, -1, 1, 0,
+    -14, -31, -14, 51, 101, 62, -44, -119, -96, 8, 107, 118,
+    32, -81, -127, -68, 46, 119, 94, -7, -99, -106, -28, 69,
+    104, 54, -36, -90, -68, 5, 68, 71, 18, -44, -65, -33,
+    22, 54, 41, -3, -41, -43, -11, 28, 43, 23, -16, -42,
+    -34, 3, 39, 45, 12, -33, -55, -31, 23, 63, 53, -5,
+    -64, -74, -21, 56, 92, 51, -37, -100, -82, 7, 96, 108,
+    30, -77, -123, -67, 46, 123, 98, -8, -107, -118, -31, 79,
+    123, 65, -44, -112, -87, 7, 90, 96, 25, -61, -91, -47,
+    31, 77, 58, -4, -57, -60, -15, 37, 55, 28, -18, -46,
+    -35, 3, 37, 40, 11, -27, -43, -24, 17, 45, 37, -3,
+    -43, -43, -9, 17, 16, 4, -1, -1, 1, 0, -14, -31,
+    -14, 51, 101, 62, -44, -119, -96, 8, 107, 118, 32, -81,
+    -127, -68, 46, 119, 94, -7, -99, -106, -28, 69, 104, 54,
+    -36, -90, -68, 5, 68, 71, 18, -44, -65, -33, 22, 54,
+    41, -3, -41, -43, -11, 28, 43, 23, -16, -42, -34, 3,
+    39, 45, 12, -33, -55, -31, 23, 63, 53, -5, -64, -74,
+    -21, 56, 92, 51, -37, -100, -82, 7, 96, 108, 30, -77,
+    -123, -67, 46, 123, 98, -8, -107, -118, -31, 79, 123, 65,
+    -44, -112, -87, 7, 90, 96, 25, -61, -91, -47, 31, 77,
+    58, -4, -57, -60, -15, 37, 55, 28, -18, -46, -35, 3,
+    37, 40, 11, -27, -43, -24, 17, 45, 37, -3, -43, -43,
+    -9, 17, 16, 4, -1, -1, 1, 2, -4, -22, -30, 8,
+    78, 98, 22, -83, -122, -60, 54, 125, 93, -16, -112, -115,
+    -24, 85, 122, 58, -50, -114, -82, 14, 93, 93, 19, -65,
+    -90, -42, 35, 78, 55, -9, -59, -58, -11, 39, 54, 25,
+    -21, -47, -33, 6, 38, 39, 8, -29, -43, -21, 19, 46,
+    36, -6, -47, -51, -11, 43, 66, 34, -31, -76, -59, 11,
+    78, 85, 18, -69, -104, -52, 47, 112, 85, -15, -107, -112,
+    -23, 86, 126, 61, -54, -125, -92, 16, 108, 110, 22, -80,
+    -114, -54, 46, 103, 74, -12, -82, -81, -16, 56, 77, 36,
+    -30, -65, -46, 7, 50, 49, 10, -33, -47, -22, 19, 42,
+    31, -5, -37, -39, -8, 31, 47, 24, -22, -48, -31, 4,
+    20, 12, 1, -1, 1, 2, -4, -22, -30, 8, 78, 98,
+    22, -83, -122, -60, 54, 125, 93, -16, -112, -115, -24, 85,
+    122, 58, -50, -114, -82, 14, 93, 93, 19, -65, -90, -42,
+    35, 78, 55, -9, -59, -58, -11, 39, 54, 25, -21, -47,
+    -33, 6, 38, 39, 8, -29, -43, -21, 19, 46, 36, -6,
+    -47, -51, -11, 43, 66, 34, -31, -76, -59, 11, 78, 85,
+    18, -69, -104, -52, 47, 112, 85, -15, -107, -112, -23, 86,
+    126, 61, -54, -125, -92, 16, 108, 110, 22, -80, -114, -54,
+    46, 103, 74, -12, -82, -81, -16, 56, 77, 36, -30, -65,
+    -46, 7, 50, 49, 10, -33, -47, -22, 19, 42, 31, -5,
+    -37, -39, -8, 31, 47, 24, -22, -48, -31, 4, 20, 12,
+    1, -1, 1, 1, -7, -26, -27, 22, 89, 90, 0, -98,
+    -117, -39, 74, 127, 75, -39, -121, -102, 0, 100, 116, 37,
+    -69, -115, -66, 34, 100, 82, 0, -76, -86, -27, 48, 78,
+    44, -22, -64, -51, 0, 46, 51, 16, -29, -47, -27, 14,
+    41, 35, 0, -35, -41, -14, 27, 47, 29, -16, -51, -46,
+    0, 51, 64, 22, -44, -78, -48, 27, 86, 76, 0, -82,
+    -100, -34, 66, 115, 69, -37, -116, -100, 0, 102, 121, 39,
+    -75, -127, -74, 39, 117, 98, 0, -95, -109, -34, 63, 104,
+    59, -30, -88, -72, 0, 66, 73, 23, -41, -66, -37, 18,
+    53, 43, 0, -39, -44, -14, 26, 43, 25, -13, -41, -35,
+    0, 37, 45, 15, -30, -48, -24, 10, 19, 9, 0, -1,
+    1, 1, -7, -26, -27, 22, 89, 90, 0, -98, -117, -39,
+    74, 127, 75, -39, -121, -102, 0, 100, 116, 37, -69, -115,
+    -66, 34, 100, 82, 0, -76, -86, -27, 48, 78, 44, -22,
+    -64, -51, 0, 46, 51, 16, -29, -47, -27, 14, 41, 35,
+    0, -35, -41, -14, 27, 47, 29, -16, -51, -46, 0, 51,
+    64, 22, -44, -78, -48, 27, 86, 76, 0, -82, -100, -34,
+    66, 115, 69, -37, -116, -100, 0, 102, 121, 39, -75, -127,
+    -74, 39, 117, 98, 0, -95, -109, -34, 63, 104, 59, -30,
+    -88, -72, 0, 66, 73, 23, -41, -66, -37, 18, 53, 43,
+    0, -39, -44, -14, 26, 43, 25, -13, -41, -35, 0, 37,
+    45, 15, -30, -48, -24, 10, 19, 9, 0, -1, 1, 1,
+    -13, -35, -25, 41, 107, 84, -24, -115, -111, -16, 93, 125,
+    54, -61, -126, -87, 24, 115, 111, 16, -93, -125, -54, 61,
+    126, 87, -24, -115, -111, -16, 93, 125, 54, -61, -126, -81,
+    19, 68, 43, 3, -9, -4, 1, 2, -9, -32, -32, 25,
+    99, 98, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -98, 0, 65, 52, 10,
+    -9, -5, -1, 2, -3, -23, -38, -4, 73, 112, 46, -68,
+    -127, -81, 32, 118, 107, 8, -98, -123, -47, 68, 127, 81,
+    -32, -118, -107, -8, 98, 123, 47, -68, -127, -81, 32, 118,
+    107, 8, -93, -99, -26, 21, 16, 3, 2, -3, -23, -38,
+    -4, 73, 112, 46, -68, -127, -81, 32, 118, 107, 8, -98,
+    -123, -47, 68, 127, 81, -32, -118, -107, -8, 98, 123, 47,
+    -68, -127, -81, 32, 118, 107, 8, -98, -121, -41, 48, 64,
+    26, -5, -8, -2, 2, -1, -18, -37, -16, 57, 112, 67,
+    -47, -123, -98, 8, 107, 118, 32, -81, -127, -68, 47, 123,
+    98, -8, -107, -118, -32, 81, 127, 68, -47, -123, -98, 8,
+    107, 118, 32, -81, -126, -62, 35, 68, 34, -2, -9, -3,
+    1, 2, -9, -32, -32, 25, 99, 98, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -98, 0, 65, 52, 10, -9, -5, -1, 1, 2, -9,
+    -32, -32, 25, 99, 98, 0, -103, -121, -39, 75, 127, 75,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121,
+    103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -98, 0,
+    65, 52, 10, -9, -5, -1, 2, -3, -23, -38, -4, 73,
+    112, 46, -68, -127, -81, 32, 118, 107, 8, -98, -123, -47,
+    68, 127, 81, -32, -118, -107, -8, 98, 123, 47, -68, -127,
+    -81, 32, 118, 107, 8, -98, -121, -41, 48, 64, 26, -5,
+    -8, -2, 1, 1, -13, -35, -25, 41, 107, 84, -24, -115,
+    -111, -16, 93, 125, 54, -61, -126, -87, 24, 115, 111, 16,
+    -93, -125, -54, 61, 126, 87, -24, -115, -111, -16, 93, 125,
+    54, -61, -126, -81, 19, 68, 43, 3, -9, -4, 1, 2,
+    -9, -32, -32, 25, 99, 98, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -98,
+    0, 65, 52, 10, -9, -5, -1, 2, -3, -23, -38, -4,
+    73, 112, 46, -68, -127, -81, 32, 118, 107, 8, -98, -123,
+    -47, 68, 127, 81, -32, -118, -107, -8, 98, 123, 47, -68,
+    -127, -81, 32, 118, 107, 8, -98, -121, -41, 48, 64, 26,
+    -5, -8, -2, 1, 1, -13, -35, -25, 41, 107, 84, -24,
+    -115, -111, -16, 93, 125, 54, -61, -126, -87, 24, 115, 111,
+    16, -93, -125, -54, 61, 126, 87, -24, -115, -111, -16, 93,
+    125, 54, -61, -126, -81, 19, 68, 43, 3, -9, -4, 2,
+    -3, -23, -38, -4, 73, 112, 46, -68, -127, -81, 32, 118,
+    107, 8, -98, -123, -47, 68, 127, 81, -32, -118, -107, -8,
+    98, 123, 47, -68, -127, -81, 32, 118, 107, 8, -98, -121,
+    -41, 48, 64, 26, -5, -8, -2, 2, -1, -18, -37, -16,
+    57, 112, 67, -47, -123, -98, 8, 107, 118, 32, -81, -127,
+    -68, 47, 123, 98, -8, -107, -118, -32, 81, 127, 68, -47,
+    -123, -98, 8, 107, 118, 32, -81, -126, -62, 35, 68, 34,
+    -2, -9, -3, 1, 2, -9, -32, -32, 25, 99, 98, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75,
+    127, 75, -39, -121, -98, 0, 65, 52, 10, -9, -5, -1,
+    1, 1, -13, -35, -25, 41, 107, 84, -24, -115, -111, -16,
+    93, 125, 54, -61, -126, -87, 24, 115, 111, 16, -93, -125,
+    -54, 61, 126, 87, -24, -115, -111, -16, 93, 125, 54, -61,
+    -126, -81, 19, 68, 43, 3, -9, -4, 1, 2, -9, -32,
+    -32, 25, 99, 98, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -98, 0, 65,
+    52, 10, -9, -5, -1, 2, -3, -23, -38, -4, 73, 112,
+    46, -68, -127, -81, 32, 118, 107, 8, -98, -123, -47, 68,
+    127, 81, -32, -118, -107, -8, 98, 123, 47, -68, -127, -81,
+    32, 118, 107, 8, -93, -99, -26, 21, 16, 3, 1, 2,
+    -9, -32, -32, 25, 99, 98, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -98, -99, -25, 32, 32, 9, -2, -1, 1,
+    2, -9, -32, -32, 25, 99, 98, 0, -103, -121, -39, 75,
+    127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75,
+    127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75,
+    127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75,
+    127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75,
+    127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 121, 103, 0, -98, -99, -25, 32, 32, 9, -2, -1,
+    1, 2, -9, -32, -32, 25, 99, 98, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -98, -99, -25, 32, 32, 9, -2,
+    -1, 1, 2, -9, -32, -32, 25, 99, 98, 0, -103, -121,
+    -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121,
+    103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0,
+    103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121,
+    -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121,
+    103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0,
+    103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121,
+    -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121,
+    103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0,
+    103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121,
+    -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121,
+    103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0,
+    103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121,
+    -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 121, 103, 0, -98, -99, -25, 32, 32, 9,
+    -2, -1, 1, 1, -7, -26, -27, 22, 89, 90, 0, -98,
+    -117, -39, 74, 127, 75, -39, -121, -102, 0, 100, 116, 37,
+    -69, -115, -66, 34, 100, 82, 0, -76, -86, -27, 48, 78,
+    44, -22, -64, -51, 0, 46, 51, 16, -29, -47, -27, 14,
+    41, 35, 0, -35, -41, -14, 27, 47, 29, -16, -51, -46,
+    0, 51, 64, 22, -44, -78, -48, 27, 86, 76, 0, -82,
+    -100, -34, 66, 115, 69, -37, -116, -100, 0, 102, 121, 39,
+    -75, -127, -74, 39, 117, 98, 0, -95, -109, -34, 63, 104,
+    59, -30, -88, -72, 0, 66, 73, 23, -41, -66, -37, 18,
+    53, 43, 0, -39, -44, -14, 26, 43, 25, -13, -41, -35,
+    0, 37, 45, 15, -31, -55, -34, 19, 61, 55, 0, -61,
+    -76, -26, 52, 92, 56, -31, -98, -86, 0, 92, 110, 37,
+    -71, -123, -73, 39, 121, 103, 0, -103, -121, -39, 73, 123,
+    71, -37, -110, -92, 0, 86, 98, 31, -56, -92, -52, 26,
+    76, 61, 0, -55, -61, -19, 34, 55, 31, -15, -45, -37,
+    0, 35, 41, 13, -25, -43, -26, 14, 44, 39, 0, -43,
+    -53, -18, 37, 66, 41, -23, -73, -66, 0, 72, 88, 30,
+    -59, -104, -63, 34, 109, 95, 0, -98, -117, -39, 74, 127,
+    75, -39, -121, -102, 0, 100, 116, 37, -69, -115, -66, 34,
+    100, 82, 0, -76, -86, -27, 48, 78, 44, -22, -64, -51,
+    0, 46, 51, 16, -29, -47, -27, 14, 41, 35, 0, -35,
+    -41, -14, 27, 47, 29, -16, -51, -46, 0, 51, 64, 22,
+    -44, -78, -48, 27, 86, 76, 0, -82, -100, -34, 66, 115,
+    69, -37, -116, -100, 0, 102, 121, 39, -75, -127, -74, 39,
+    117, 98, 0, -95, -109, -34, 63, 104, 59, -30, -88, -72,
+    0, 66, 73, 23, -41, -66, -37, 18, 53, 43, 0, -39,
+    -44, -14, 26, 43, 25, -13, -41, -35, 0, 37, 45, 15,
+    -31, -55, -34, 19, 61, 55, 0, -61, -76, -26, 52, 92,
+    56, -31, -98, -86, 0, 92, 110, 37, -71, -123, -73, 39,
+    121, 103, 0, -103, -121, -39, 73, 123, 71, -37, -110, -92,
+    0, 86, 98, 31, -56, -92, -52, 26, 76, 61, 0, -55,
+    -61, -19, 34, 55, 31, -15, -45, -37, 0, 35, 41, 13,
+    -25, -43, -26, 14, 44, 39, 0, -43, -53, -18, 37, 66,
+    41, -23, -73, -66, 0, 72, 88, 30, -59, -104, -63, 34,
+    109, 95, 0, -98, -117, -39, 74, 127, 75, -39, -121, -102,
+    0, 100, 116, 37, -69, -115, -66, 34, 100, 82, 0, -76,
+    -86, -27, 48, 78, 44, -22, -64, -51, 0, 46, 51, 16,
+    -29, -47, -27, 14, 41, 35, 0, -35, -41, -14, 27, 47,
+    29, -16, -51, -46, 0, 51, 64, 22, -44, -78, -48, 27,
+    86, 76, 0, -82, -100, -34, 66, 115, 69, -37, -116, -100,
+    0, 102, 121, 39, -75, -127, -74, 39, 117, 98, 0, -95,
+    -109, -34, 63, 104, 59, -30, -88, -72, 0, 66, 73, 23,
+    -41, -66, -37, 18, 53, 43, 0, -39, -44, -14, 26, 43,
+    25, -13, -41, -35, 0, 37, 45, 15, -31, -55, -34, 19,
+    61, 55, 0, -61, -76, -26, 52, 92, 56, -31, -98, -86,
+    0, 92, 110, 37, -71, -123, -73, 39, 121, 103, 0, -103,
+    -121, -39, 73, 123, 71, -37, -110, -92, 0, 86, 98, 31,
+    -56, -92, -52, 26, 76, 61, 0, -55, -61, -19, 34, 55,
+    31, -15, -45, -37, 0, 35, 41, 13, -25, -43, -26, 14,
+    44, 39, 0, -43, -53, -18, 37, 66, 41, -23, -73, -66,
+    0, 72, 88, 30, -59, -104, -63, 34, 109, 95, 0, -98,
+    -117, -39, 74, 127, 75, -39, -121, -102, 0, 100, 116, 37,
+    -69, -115, -66, 34, 100, 82, 0, -76, -86, -27, 48, 78,
+    44, -22, -64, -51, 0, 46, 51, 16, -29, -47, -27, 14,
+    41, 35, 0, -35, -41, -14, 27, 47, 29, -16, -51, -46,
+    0, 51, 64, 22, -44, -78, -48, 27, 86, 76, 0, -82,
+    -100, -34, 66, 115, 69, -37, -116, -100, 0, 102, 121, 39,
+    -75, -127, -74, 39, 117, 98, 0, -95, -109, -34, 63, 104,
+    59, -30, -88, -72, 0, 66, 73, 23, -41, -66, -37, 18,
+    53, 43, 0, -39, -44, -14, 26, 43, 25, -13, -41, -35,
+    0, 37, 45, 15, -31, -55, -34, 19, 61, 55, 0, -61,
+    -76, -26, 52, 92, 56, -31, -98, -86, 0, 92, 110, 37,
+    -71, -123, -73, 39, 121, 103, 0, -103, -121, -39, 73, 123,
+    71, -37, -110, -92, 0, 86, 98, 31, -56, -92, -52, 26,
+    76, 61, 0, -55, -61, -19, 34, 55, 31, -15, -45, -37,
+    0, 35, 41, 13, -25, -43, -26, 14, 44, 39, 0, -41,
+    -44, -11, 16, 16, 5, -1, -1, 1, 1, -7, -26, -27,
+    22, 89, 90, 0, -98, -117, -39, 74, 127, 75, -39, -121,
+    -102, 0, 100, 116, 37, -69, -115, -66, 34, 100, 82, 0,
+    -76, -86, -27, 48, 78, 44, -22, -64, -51, 0, 46, 51,
+    16, -29, -47, -27, 14, 41, 35, 0, -35, -41, -14, 27,
+    47, 29, -16, -51, -46, 0, 51, 64, 22, -44, -78, -48,
+    27, 86, 76, 0, -82, -100, -34, 66, 115, 69, -37, -116,
+    -100, 0, 102, 121, 39, -75, -127, -74, 39, 117, 98, 0,
+    -95, -109, -34, 63, 104, 59, -30, -88, -72, 0, 66, 73,
+    23, -41, -66, -37, 18, 53, 43, 0, -39, -44, -14, 26,
+    43, 25, -13, -41, -35, 0, 37, 45, 15, -31, -55, -34,
+    19, 61, 55, 0, -61, -76, -26, 52, 92, 56, -31, -98,
+    -86, 0, 92, 110, 37, -71, -123, -73, 39, 121, 103, 0,
+    -103, -121, -39, 73, 123, 71, -37, -110, -92, 0, 86, 98,
+    31, -56, -92, -52, 26, 76, 61, 0, -55, -61, -19, 34,
+    55, 31, -15, -45, -37, 0, 35, 41, 13, -25, -43, -26,
+    14, 44, 39, 0, -43, -53, -18, 37, 66, 41, -23, -73,
+    -66, 0, 72, 88, 30, -59, -104, -63, 34, 109, 95, 0,
+    -98, -117, -39, 74, 127, 75, -39, -121, -102, 0, 100, 116,
+    37, -69, -115, -66, 34, 100, 82, 0, -76, -86, -27, 48,
+    78, 44, -22, -64, -51, 0, 46, 51, 16, -29, -47, -27,
+    14, 41, 35, 0, -35, -41, -14, 27, 47, 29, -16, -51,
+    -46, 0, 51, 64, 22, -44, -78, -48, 27, 86, 76, 0,
+    -82, -100, -34, 66, 115, 69, -37, -116, -100, 0, 102, 121,
+    39, -75, -127, -74, 39, 117, 98, 0, -95, -109, -34, 63,
+    104, 59, -30, -88, -72, 0, 66, 73, 23, -41, -66, -37,
+    18, 53, 43, 0, -39, -44, -14, 26, 43, 25, -13, -41,
+    -35, 0, 37, 45, 15, -31, -55, -34, 19, 61, 55, 0,
+    -61, -76, -26, 52, 92, 56, -31, -98, -86, 0, 92, 110,
+    37, -71, -123, -73, 39, 121, 103, 0, -103, -121, -39, 73,
+    123, 71, -37, -110, -92, 0, 86, 98, 31, -56, -92, -52,
+    26, 76, 61, 0, -55, -61, -19, 34, 55, 31, -15, -45,
+    -37, 0, 35, 41, 13, -25, -43, -26, 14, 44, 39, 0,
+    -43, -53, -18, 37, 66, 41, -23, -73, -66, 0, 72, 88,
+    30, -59, -104, -63, 34, 109, 95, 0, -98, -117, -39, 74,
+    127, 75, -39, -121, -102, 0, 100, 116, 37, -69, -115, -66,
+    34, 100, 82, 0, -76, -86, -27, 48, 78, 44, -22, -64,
+    -51, 0, 46, 51, 16, -29, -47, -27, 14, 41, 35, 0,
+    -35, -41, -14, 27, 47, 29, -16, -51, -46, 0, 51, 64,
+    22, -44, -78, -48, 27, 86, 76, 0, -82, -100, -34, 66,
+    115, 69, -37, -116, -100, 0, 102, 121, 39, -75, -127, -74,
+    39, 117, 98, 0, -95, -109, -34, 63, 104, 59, -30, -88,
+    -72, 0, 66, 73, 23, -41, -66, -37, 18, 53, 43, 0,
+    -39, -44, -14, 26, 43, 25, -13, -41, -35, 0, 37, 45,
+    15, -31, -55, -34, 19, 61, 55, 0, -61, -76, -26, 52,
+    92, 56, -31, -98, -86, 0, 92, 110, 37, -71, -123, -73,
+    39, 121, 103, 0, -103, -121, -39, 73, 123, 71, -37, -110,
+    -92, 0, 86, 98, 31, -56, -92, -52, 26, 76, 61, 0,
+    -55, -61, -19, 34, 55, 31, -15, -45, -37, 0, 35, 41,
+    13, -25, -43, -26, 14, 44, 39, 0, -43, -53, -18, 37,
+    66, 41, -23, -73, -66, 0, 72, 88, 30, -59, -104, -63,
+    34, 109, 95, 0, -98, -117, -39, 74, 127, 75, -39, -121,
+    -102, 0, 100, 116, 37, -69, -115, -66, 34, 100, 82, 0,
+    -76, -86, -27, 48, 78, 44, -22, -64, -51, 0, 46, 51,
+    16, -29, -47, -27, 14, 41, 35, 0, -35, -41, -14, 27,
+    47, 29, -16, -51, -46, 0, 51, 64, 22, -44, -78, -48,
+    27, 86, 76, 0, -82, -100, -34, 66, 115, 69, -37, -116,
+    -100, 0, 102, 121, 39, -75, -127, -74, 39, 117, 98, 0,
+    -95, -109, -34, 63, 104, 59, -30, -88, -72, 0, 66, 73,
+    23, -41, -66, -37, 18, 53, 43, 0, -39, -44, -14, 26,
+    43, 25, -13, -41, -35, 0, 37, 45, 15, -31, -55, -34,
+    19, 61, 55, 0, -61, -76, -26, 52, 92, 56, -31, -98,
+    -86, 0, 92, 110, 37, -71, -123, -73, 39, 121, 103, 0,
+    -103, -121, -39, 73, 123, 71, -37, -110, -92, 0, 86, 98,
+    31, -56, -92, -52, 26, 76, 61, 0, -55, -61, -19, 34,
+    55, 31, -15, -45, -37, 0, 35, 41, 13, -25, -43, -26,
+    14, 44, 39, 0, -41, -44, -11, 16, 16, 5, -1, -1,
+    1, 1, -7, -26, -27, 22, 89, 90, 0, -98, -117, -39,
+    74, 127, 75, -39, -121, -102, 0, 100, 116, 37, -69, -115,
+    -66, 34, 100, 82, 0, -76, -86, -27, 48, 78, 44, -22,
+    -64, -51, 0, 46, 51, 16, -29, -47, -27, 14, 41, 35,
+    0, -35, -41, -14, 27, 47, 29, -16, -51, -46, 0, 51,
+    64, 22, -44, -78, -48, 27, 86, 76, 0, -82, -100, -34,
+    66, 115, 69, -37, -116, -100, 0, 102, 121, 39, -75, -127,
+    -74, 39, 117, 98, 0, -95, -109, -34, 63, 104, 59, -30,
+    -88, -72, 0, 66, 73, 23, -41, -66, -37, 18, 53, 43,
+    0, -39, -44, -14, 26, 43, 25, -13, -41, -35, 0, 37,
+    45, 15, -31, -55, -34, 19, 61, 55, 0, -61, -76, -26,
+    52, 92, 56, -31, -98, -86, 0, 92, 110, 37, -71, -123,
+    -73, 39, 121, 103, 0, -103, -121, -39, 73, 123, 71, -37,
+    -110, -92, 0, 86, 98, 31, -56, -92, -52, 26, 76, 61,
+    0, -55, -61, -19, 34, 55, 31, -15, -45, -37, 0, 35,
+    41, 13, -25, -43, -26, 14, 44, 39, 0, -43, -53, -18,
+    37, 66, 41, -23, -73, -66, 0, 72, 88, 30, -59, -104,
+    -63, 34, 109, 95, 0, -98, -117, -39, 74, 127, 75, -39,
+    -121, -102, 0, 100, 116, 37, -69, -115, -66, 34, 100, 82,
+    0, -76, -86, -27, 48, 78, 44, -22, -64, -51, 0, 46,
+    51, 16, -29, -47, -27, 14, 41, 35, 0, -35, -41, -14,
+    27, 47, 29, -16, -51, -46, 0, 51, 64, 22, -44, -78,
+    -48, 27, 86, 76, 0, -82, -100, -34, 66, 115, 69, -37,
+    -116, -100, 0, 102, 121, 39, -75, -127, -74, 39, 117, 98,
+    0, -95, -109, -34, 63, 104, 59, -30, -88, -72, 0, 66,
+    73, 23, -41, -66, -37, 18, 53, 43, 0, -39, -44, -14,
+    26, 43, 25, -13, -41, -35, 0, 37, 45, 15, -31, -55,
+    -34, 19, 61, 55, 0, -61, -76, -26, 52, 92, 56, -31,
+    -98, -86, 0, 92, 110, 37, -71, -123, -73, 39, 121, 103,
+    0, -103, -121, -39, 73, 123, 71, -37, -110, -92, 0, 86,
+    98, 31, -56, -92, -52, 26, 76, 61, 0, -55, -61, -19,
+    34, 55, 31, -15, -45, -37, 0, 35, 41, 13, -25, -43,
+    -26, 14, 44, 39, 0, -43, -53, -18, 37, 66, 41, -23,
+    -73, -66, 0, 72, 88, 30, -59, -104, -63, 34, 109, 95,
+    0, -98, -117, -39, 74, 127, 75, -39, -121, -102, 0, 100,
+    116, 37, -69, -115, -66, 34, 100, 82, 0, -76, -86, -27,
+    48, 78, 44, -22, -64, -51, 0, 46, 51, 16, -29, -47,
+    -27, 14, 41, 35, 0, -35, -41, -14, 27, 47, 29, -16,
+    -51, -46, 0, 51, 64, 22, -44, -78, -48, 27, 86, 76,
+    0, -82, -100, -34, 66, 115, 69, -37, -116, -100, 0, 102,
+    121, 39, -75, -127, -74, 39, 117, 98, 0, -95, -109, -34,
+    63, 104, 59, -30, -88, -72, 0, 66, 73, 23, -41, -66,
+    -37, 18, 53, 43, 0, -39, -44, -14, 26, 43, 25, -13,
+    -41, -35, 0, 37, 45, 15, -31, -55, -34, 19, 61, 55,
+    0, -61, -76, -26, 52, 92, 56, -31, -98, -86, 0, 92,
+    110, 37, -71, -123, -73, 39, 121, 103, 0, -103, -121, -39,
+    73, 123, 71, -37, -110, -92, 0, 86, 98, 31, -56, -92,
+    -52, 26, 76, 61, 0, -55, -61, -19, 34, 55, 31, -15,
+    -45, -37, 0, 35, 41, 13, -25, -43, -26, 14, 44, 39,
+    0, -43, -53, -18, 37, 66, 41, -23, -73, -66, 0, 72,
+    88, 30, -59, -104, -63, 34, 109, 95, 0, -98, -117, -39,
+    74, 127, 75, -39, -121, -102, 0, 100, 116, 37, -69, -115,
+    -66, 34, 100, 82, 0, -76, -86, -27, 48, 78, 44, -22,
+    -64, -51, 0, 46, 51, 16, -29, -47, -27, 14, 41, 35,
+    0, -35, -41, -14, 27, 47, 29, -16, -51, -46, 0, 51,
+    64, 22, -44, -78, -48, 27, 86, 76, 0, -82, -100, -34,
+    66, 115, 69, -37, -116, -100, 0, 102, 121, 39, -75, -127,
+    -74, 39, 117, 98, 0, -95, -109, -34, 63, 104, 59, -30,
+    -88, -72, 0, 66, 73, 23, -41, -66, -37, 18, 53, 43,
+    0, -39, -44, -14, 26, 43, 25, -13, -41, -35, 0, 37,
+    45, 15, -31, -55, -34, 19, 61, 55, 0, -61, -76, -26,
+    52, 92, 56, -31, -98, -86, 0, 92, 110, 37, -71, -123,
+    -73, 39, 121, 103, 0, -103, -121, -39, 73, 123, 71, -37,
+    -110, -92, 0, 86, 98, 31, -56, -92, -52, 26, 76, 61,
+    0, -55, -61, -19, 34, 55, 31, -15, -45, -37, 0, 35,
+    41, 13, -25, -43, -26, 14, 44, 39, 0, -41, -44, -11,
+    16, 16, 5, -1, -1, 1, 1, -7, -26, -27, 22, 89,
+    90, 0, -98, -117, -39, 74, 127, 75, -39, -121, -102, 0,
+    100, 116, 37, -69, -115, -66, 34, 100, 82, 0, -76, -86,
+    -27, 48, 78, 44, -22, -64, -51, 0, 46, 51, 16, -29,
+    -47, -27, 14, 41, 35, 0, -35, -41, -14, 27, 47, 29,
+    -16, -51, -46, 0, 51, 64, 22, -44, -78, -48, 27, 86,
+    76, 0, -82, -100, -34, 66, 115, 69, -37, -116, -100, 0,
+    102, 121, 39, -75, -127, -74, 39, 117, 98, 0, -95, -109,
+    -34, 63, 104, 59, -30, -88, -72, 0, 66, 73, 23, -41,
+    -66, -37, 18, 53, 43, 0, -39, -44, -14, 26, 43, 25,
+    -13, -41, -35, 0, 37, 45, 15, -31, -55, -34, 19, 61,
+    55, 0, -61, -76, -26, 52, 92, 56, -31, -98, -86, 0,
+    92, 110, 37, -71, -123, -73, 39, 121, 103, 0, -103, -121,
+    -39, 73, 123, 71, -37, -110, -92, 0, 86, 98, 31, -56,
+    -92, -52, 26, 76, 61, 0, -55, -61, -19, 34, 55, 31,
+    -15, -45, -37, 0, 35, 41, 13, -25, -43, -26, 14, 44,
+    39, 0, -43, -53, -18, 37, 66, 41, -23, -73, -66, 0,
+    72, 88, 30, -59, -104, -63, 34, 109, 95, 0, -98, -117,
+    -39, 74, 127, 75, -39, -121, -102, 0, 100, 116, 37, -69,
+    -115, -66, 34, 100, 82, 0, -76, -86, -27, 48, 78, 44,
+    -22, -64, -51, 0, 46, 51, 16, -29, -47, -27, 14, 41,
+    35, 0, -35, -41, -14, 27, 47, 29, -16, -51, -46, 0,
+    51, 64, 22, -44, -78, -48, 27, 86, 76, 0, -82, -100,
+    -34, 66, 115, 69, -37, -116, -100, 0, 102, 121, 39, -75,
+    -127, -74, 39, 117, 98, 0, -95, -109, -34, 63, 104, 59,
+    -30, -88, -72, 0, 66, 73, 23, -41, -66, -37, 18, 53,
+    43, 0, -39, -44, -14, 26, 43, 25, -13, -41, -35, 0,
+    37, 45, 15, -31, -55, -34, 19, 61, 55, 0, -61, -76,
+    -26, 52, 92, 56, -31, -98, -86, 0, 92, 110, 37, -71,
+    -123, -73, 39, 121, 103, 0, -103, -121, -39, 73, 123, 71,
+    -37, -110, -92, 0, 86, 98, 31, -56, -92, -52, 26, 76,
+    61, 0, -55, -61, -19, 34, 55, 31, -15, -45, -37, 0,
+    35, 41, 13, -25, -43, -26, 14, 44, 39, 0, -43, -53,
+    -18, 37, 66, 41, -23, -73, -66, 0, 72, 88, 30, -59,
+    -104, -63, 34, 109, 95, 0, -98, -117, -39, 74, 127, 75,
+    -39, -121, -102, 0, 100, 116, 37, -69, -115, -66, 34, 100,
+    82, 0, -76, -86, -27, 48, 78, 44, -22, -64, -51, 0,
+    46, 51, 16, -29, -47, -27, 14, 41, 35, 0, -35, -41,
+    -14, 27, 47, 29, -16, -51, -46, 0, 51, 64, 22, -44,
+    -78, -48, 27, 86, 76, 0, -82, -100, -34, 66, 115, 69,
+    -37, -116, -100, 0, 102, 121, 39, -75, -127, -74, 39, 117,
+    98, 0, -95, -109, -34, 63, 104, 59, -30, -88, -72, 0,
+    66, 73, 23, -41, -66, -37, 18, 53, 43, 0, -39, -44,
+    -14, 26, 43, 25, -13, -41, -35, 0, 37, 45, 15, -31,
+    -55, -34, 19, 61, 55, 0, -61, -76, -26, 52, 92, 56,
+    -31, -98, -86, 0, 92, 110, 37, -71, -123, -73, 39, 121,
+    103, 0, -103, -121, -39, 73, 123, 71, -37, -110, -92, 0,
+    86, 98, 31, -56, -92, -52, 26, 76, 61, 0, -55, -61,
+    -19, 34, 55, 31, -15, -45, -37, 0, 35, 41, 13, -25,
+    -43, -26, 14, 44, 39, 0, -43, -53, -18, 37, 66, 41,
+    -23, -73, -66, 0, 72, 88, 30, -59, -104, -63, 34, 109,
+    95, 0, -98, -117, -39, 74, 127, 75, -39, -121, -102, 0,
+    100, 116, 37, -69, -115, -66, 34, 100, 82, 0, -76, -86,
+    -27, 48, 78, 44, -22, -64, -51, 0, 46, 51, 16, -29,
+    -47, -27, 14, 41, 35, 0, -35, -41, -14, 27, 47, 29,
+    -16, -51, -46, 0, 51, 64, 22, -44, -78, -48, 27, 86,
+    76, 0, -82, -100, -34, 66, 115, 69, -37, -116, -100, 0,
+    102, 121, 39, -75, -127, -74, 39, 117, 98, 0, -95, -109,
+    -34, 63, 104, 59, -30, -88, -72, 0, 66, 73, 23, -41,
+    -66, -37, 18, 53, 43, 0, -39, -44, -14, 26, 43, 25,
+    -13, -41, -35, 0, 37, 45, 15, -31, -55, -34, 19, 61,
+    55, 0, -61, -76, -26, 52, 92, 56, -31, -98, -86, 0,
+    92, 110, 37, -71, -123, -73, 39, 121, 103, 0, -103, -121,
+    -39, 73, 123, 71, -37, -110, -92, 0, 86, 98, 31, -56,
+    -92, -52, 26, 76, 61, 0, -55, -61, -19, 34, 55, 31,
+    -15, -45, -37, 0, 35, 41, 13, -25, -43, -26, 14, 44,
+    39, 0, -41, -44, -11, 16, 16, 5, -1, -1, 1, 2,
+    -9, -32, -32, 25, 99, 98, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -98, -99, -25, 32, 32,
+    9, -2, -1, 1, 2, -9, -32, -32, 25, 99, 98, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75,
+    127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75,
+    127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75,
+    127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75,
+    127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75,
+    127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75,
+    127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75,
+    127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75,
+    127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75,
+    127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75,
+    127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75,
+    127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75,
+    127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75,
+    127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0,
+    -98, -99, -25, 32, 32, 9, -2, -1, 1, 2, -9, -32,
+    -32, 25, 99, 98, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -98, -99, -25, 32, 32, 9, -2,
+    -1, 1, 2, -9, -32, -32, 25, 99, 98, 0, -103, -121,
+    -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121,
+    103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0,
+    103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121,
+    -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121,
+    103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0,
+    103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121,
+    -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121,
+    103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0,
+    103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121,
+    -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121,
+    103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0,
+    103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121,
+    -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121,
+    103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0,
+    103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121,
+    -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121,
+    103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0,
+    103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121,
+    -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121,
+    103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0,
+    103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121,
+    -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121,
+    103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0,
+    103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121,
+    -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121,
+    103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0,
+    103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121,
+    -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121,
+    103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0,
+    103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121,
+    -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121,
+    103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0,
+    103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121,
+    -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121,
+    103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0,
+    103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121,
+    -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121,
+    103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0,
+    103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -98, -99,
+    -25, 32, 32, 9, -2, -1, 1, 2, -9, -32, -32, 25,
+    99, 98, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -98, -99, -25, 32, 32, 9, -2, -1, 1,
+    2, -9, -32, -32, 25, 99, 98, 0, -103, -121, -39, 75,
+    127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75,
+    127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75,
+    127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75,
+    127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75,
+    127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75,
+    127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75,
+    127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75,
+    127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75,
+    127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75,
+    127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75,
+    127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75,
+    127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75,
+    127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -98, -99, -25, 32,
+    32, 9, -2, -1, 1, 2, -9, -32, -32, 25, 99, 98,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -98, -99, -25, 32, 32, 9, -2, -1, 1, 2, -9,
+    -32, -32, 25, 99, 98, 0, -103, -121, -39, 75, 127, 75,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121,
+    103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0,
+    103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121,
+    -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121,
+    103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0,
+    103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121,
+    -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121,
+    103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0,
+    103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121,
+    -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121,
+    103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0,
+    103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121,
+    -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121,
+    103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0,
+    103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121,
+    -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121,
+    103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0,
+    103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121,
+    -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121,
+    103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0,
+    103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121,
+    -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121,
+    103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0,
+    103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121,
+    -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121,
+    103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0,
+    103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121,
+    -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121,
+    103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0,
+    103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121,
+    -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121,
+    103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0,
+    103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121,
+    -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121,
+    103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0,
+    103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121,
+    -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121,
+    103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0,
+    103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121,
+    -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 121, 103, 0, -98, -99, -25, 32, 32, 9,
+    -2, -1, 1, 2, -9, -32, -32, 25, 99, 98, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -98, -99, -25, 32, 32,
+    9, -2, -1, 1, 2, -9, -32, -32, 25, 99, 98, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75,
+    127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75,
+    127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75,
+    127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75,
+    127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -98, -99, -25, 32,
+    32, 9, -2, -1, 1, 2, -9, -32, -32, 25, 99, 98,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -98, -99, -25,
+    32, 32, 9, -2, -1, 1, 2, -9, -32, -32, 25, 99,
+    98, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0,
+    103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121,
+    -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121,
+    103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0,
+    103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121,
+    -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121,
+    103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0,
+    103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121,
+    -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121,
+    103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0,
+    103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121,
+    -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121,
+    103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0,
+    103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -98, -99,
+    -25, 32, 32, 9, -2, -1, 1, 2, -9, -32, -32, 25,
+    99, 98, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -98, -99, -25, 32, 32, 9, -2, -1, 1,
+    2, -9, -32, -32, 25, 99, 98, 0, -103, -121, -39, 75,
+    127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75,
+    127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75,
+    127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75,
+    127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75,
+    127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75,
+    127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75,
+    127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75,
+    127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75,
+    127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75,
+    127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75,
+    127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75,
+    127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75,
+    127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0,
+    -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 121, 103, 0, -98, -99, -25, 32,
+    32, 9, -2, -1, 1, 2, -9, -32, -32, 25, 99, 98,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121, 103,
+    0, -98, -99, -25, 32, 32, 9, -2, -1, 1, 2, -9,
+    -32, -32, 25, 99, 98, 0, -103, -121, -39, 75, 127, 75,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121,
+    103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0,
+    103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121,
+    -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121,
+    103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0,
+    103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121,
+    -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121,
+    103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0,
+    103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121,
+    -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121,
+    103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0,
+    103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121,
+    -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121,
+    103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0,
+    103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121,
+    -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121,
+    103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0,
+    103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121,
+    -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121,
+    103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0,
+    103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121,
+    -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121,
+    103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0,
+    103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121,
+    -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121,
+    103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0,
+    103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121,
+    -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121,
+    103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0,
+    103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121,
+    -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121,
+    103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0,
+    103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121,
+    -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121,
+    103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0,
+    103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121,
+    -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 121,
+    103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103, 0,
+    103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103, -121,
+    -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 121, 103, 0, -98, -99, -25, 32, 32, 9,
+    -2, -1, 1, 1, -13, -35, -25, 41, 107, 84, -24, -115,
+    -111, -16, 93, 125, 54, -61, -126, -87, 24, 115, 111, 16,
+    -93, -125, -54, 61, 126, 87, -24, -115, -111, -16, 93, 125,
+    54, -61, -126, -87, 24, 115, 111, 16, -93, -125, -54, 61,
+    126, 87, -24, -115, -111, -16, 93, 125, 54, -61, -126, -87,
+    24, 115, 111, 16, -93, -125, -54, 61, 126, 87, -24, -115,
+    -111, -16, 93, 125, 54, -61, -126, -87, 24, 115, 111, 16,
+    -93, -125, -54, 61, 126, 87, -24, -115, -111, -16, 93, 125,
+    54, -61, -126, -87, 24, 115, 111, 16, -93, -125, -54, 61,
+    126, 87, -24, -115, -111, -16, 93, 125, 54, -61, -126, -87,
+    24, 115, 111, 16, -93, -125, -54, 61, 126, 87, -24, -115,
+    -111, -16, 93, 125, 54, -61, -126, -87, 24, 115, 111, 16,
+    -93, -125, -54, 61, 126, 87, -24, -115, -111, -16, 93, 125,
+    54, -61, -126, -87, 24, 115, 111, 16, -93, -125, -54, 61,
+    126, 87, -24, -115, -111, -16, 93, 125, 54, -61, -126, -87,
+    24, 115, 111, 15, -74, -76, -22, 14, 14, 3, 1, 1,
+    -13, -35, -25, 41, 107, 84, -24, -115, -111, -16, 93, 125,
+    54, -61, -126, -87, 24, 115, 111, 16, -93, -125, -54, 61,
+    126, 87, -24, -115, -111, -16, 93, 125, 54, -61, -126, -87,
+    24, 115, 111, 16, -93, -125, -54, 61, 126, 87, -24, -115,
+    -111, -16, 93, 125, 54, -61, -126, -87, 24, 115, 111, 16,
+    -93, -125, -54, 61, 126, 87, -24, -115, -111, -16, 93, 125,
+    54, -61, -126, -87, 24, 115, 111, 16, -93, -125, -54, 61,
+    126, 87, -24, -115, -111, -16, 93, 125, 54, -61, -126, -87,
+    24, 115, 111, 16, -93, -125, -54, 61, 126, 87, -24, -115,
+    -111, -16, 93, 125, 54, -61, -126, -87, 24, 115, 111, 16,
+    -93, -125, -54, 61, 126, 87, -24, -115, -111, -16, 93, 125,
+    54, -61, -126, -87, 24, 115, 111, 16, -93, -125, -54, 61,
+    126, 87, -24, -115, -111, -16, 93, 125, 54, -61, -126, -87,
+    24, 115, 111, 16, -93, -125, -54, 61, 126, 87, -24, -115,
+    -111, -16, 93, 125, 54, -61, -126, -87, 24, 115, 111, 15,
+    -74, -76, -22, 14, 14, 3, 1, 1, -13, -35, -25, 41,
+    107, 84, -24, -115, -111, -16, 93, 125, 54, -61, -126, -87,
+    24, 115, 111, 16, -93, -125, -54, 61, 126, 87, -24, -115,
+    -111, -16, 93, 125, 54, -61, -126, -87, 24, 115, 111, 16,
+    -93, -125, -54, 61, 126, 87, -24, -115, -111, -16, 93, 125,
+    54, -61, -126, -87, 24, 115, 111, 16, -93, -125, -54, 61,
+    126, 87, -24, -115, -111, -16, 93, 125, 54, -61, -126, -87,
+    24, 115, 111, 16, -93, -125, -54, 61, 126, 87, -24, -115,
+    -111, -16, 93, 125, 54, -61, -126, -87, 24, 115, 111, 16,
+    -93, -125, -54, 61, 126, 87, -24, -115, -111, -16, 93, 125,
+    54, -61, -126, -87, 24, 115, 111, 16, -93, -125, -54, 61,
+    126, 87, -24, -115, -111, -16, 93, 125, 54, -61, -126, -87,
+    24, 115, 111, 16, -93, -125, -54, 61, 126, 87, -24, -115,
+    -111, -16, 93, 125, 54, -61, -126, -87, 24, 115, 111, 16,
+    -93, -125, -54, 61, 126, 87, -24, -115, -111, -16, 93, 125,
+    54, -61, -126, -87, 24, 115, 111, 15, -74, -76, -22, 14,
+    14, 3, 1, 1, -13, -35, -25, 41, 107, 84, -24, -115,
+    -111, -16, 93, 125, 54, -61, -126, -87, 24, 115, 111, 16,
+    -93, -125, -54, 61, 126, 87, -24, -115, -111, -16, 93, 125,
+    54, -61, -126, -87, 24, 115, 111, 16, -93, -125, -54, 61,
+    126, 87, -24, -115, -111, -16, 93, 125, 54, -61, -126, -87,
+    24, 115, 111, 16, -93, -125, -54, 61, 126, 87, -24, -115,
+    -111, -16, 93, 125, 54, -61, -126, -87, 24, 115, 111, 16,
+    -93, -125, -54, 61, 126, 87, -24, -115, -111, -16, 93, 125,
+    54, -61, -126, -87, 24, 115, 111, 16, -93, -125, -54, 61,
+    126, 87, -24, -115, -111, -16, 93, 125, 54, -61, -126, -87,
+    24, 115, 111, 16, -93, -125, -54, 61, 126, 87, -24, -115,
+    -111, -16, 93, 125, 54, -61, -126, -87, 24, 115, 111, 16,
+    -93, -125, -54, 61, 126, 87, -24, -115, -111, -16, 93, 125,
+    54, -61, -126, -87, 24, 115, 111, 16, -93, -125, -54, 61,
+    126, 87, -24, -115, -111, -16, 93, 125, 54, -61, -126, -87,
+    24, 115, 111, 15, -74, -76, -22, 14, 14, 3, 1, 2,
+    -9, -32, -32, 25, 99, 98, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 38,
+    -62, -82, -33, 10, 15, 5, 1, 2, -9, -32, -32, 25,
+    99, 98, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 38, -62, -82, -33, 10,
+    15, 5, 1, 2, -9, -32, -32, 25, 99, 98, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 38, -62, -82, -33, 10, 15, 5, 1, 2,
+    -9, -32, -32, 25, 99, 98, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -121, -103, 0, 103, 121, 38,
+    -62, -82, -33, 10, 15, 5, 1, 1, -7, -26, -27, 22,
+    89, 90, 0, -98, -117, -39, 74, 127, 75, -39, -121, -102,
+    0, 100, 116, 37, -69, -115, -66, 34, 100, 82, 0, -76,
+    -86, -27, 48, 78, 44, -22, -64, -51, 0, 46, 51, 16,
+    -29, -47, -27, 14, 41, 35, 0, -35, -41, -14, 27, 47,
+    29, -16, -51, -46, 0, 51, 64, 22, -44, -78, -48, 27,
+    86, 76, 0, -82, -100, -34, 66, 115, 69, -37, -116, -100,
+    0, 102, 121, 39, -75, -127, -74, 39, 117, 98, 0, -95,
+    -109, -34, 63, 104, 59, -30, -88, -72, 0, 66, 73, 23,
+    -41, -66, -37, 18, 53, 43, 0, -37, -36, -9, 11, 11,
+    3, -1, 1, 1, -7, -26, -27, 22, 89, 90, 0, -98,
+    -117, -39, 74, 127, 75, -39, -121, -102, 0, 100, 116, 37,
+    -69, -115, -66, 34, 100, 82, 0, -76, -86, -27, 48, 78,
+    44, -22, -64, -51, 0, 46, 51, 16, -29, -47, -27, 14,
+    41, 35, 0, -35, -41, -14, 27, 47, 29, -16, -51, -46,
+    0, 51, 64, 22, -44, -78, -48, 27, 86, 76, 0, -82,
+    -100, -34, 66, 115, 69, -37, -116, -100, 0, 102, 121, 39,
+    -75, -127, -74, 39, 117, 98, 0, -95, -109, -34, 63, 104,
+    59, -30, -88, -72, 0, 66, 73, 23, -41, -66, -37, 18,
+    53, 43, 0, -37, -36, -9, 11, 11, 3, -1, 1, 1,
+    -7, -26, -27, 22, 89, 90, 0, -98, -117, -39, 74, 127,
+    75, -39, -121, -102, 0, 100, 116, 37, -69, -115, -66, 34,
+    100, 82, 0, -76, -86, -27, 48, 78, 44, -22, -64, -51,
+    0, 46, 51, 16, -29, -47, -27, 14, 41, 35, 0, -35,
+    -41, -14, 27, 47, 29, -16, -51, -46, 0, 51, 64, 22,
+    -44, -78, -48, 27, 86, 76, 0, -82, -100, -34, 66, 115,
+    69, -37, -116, -100, 0, 102, 121, 39, -75, -127, -74, 39,
+    117, 98, 0, -95, -109, -34, 63, 104, 59, -30, -88, -72,
+    0, 66, 73, 23, -41, -66, -37, 18, 53, 43, 0, -37,
+    -36, -9, 11, 11, 3, -1, 1, 1, -7, -26, -27, 22,
+    89, 90, 0, -98, -117, -39, 74, 127, 75, -39, -121, -102,
+    0, 100, 116, 37, -69, -115, -66, 34, 100, 82, 0, -76,
+    -86, -27, 48, 78, 44, -22, -64, -51, 0, 46, 51, 16,
+    -29, -47, -27, 14, 41, 35, 0, -35, -41, -14, 27, 47,
+    29, -16, -51, -46, 0, 51, 64, 22, -44, -78, -48, 27,
+    86, 76, 0, -82, -100, -34, 66, 115, 69, -37, -116, -100,
+    0, 102, 121, 39, -75, -127, -74, 39, 117, 98, 0, -95,
+    -109, -34, 63, 104, 59, -30, -88, -72, 0, 66, 73, 23,
+    -41, -66, -37, 18, 53, 43, 0, -37, -36, -9, 11, 11,
+    3, -1, 1, 1, -7, -26, -27, 22, 89, 90, 0, -98,
+    -117, -39, 74, 127, 75, -39, -121, -102, 0, 100, 116, 37,
+    -69, -115, -66, 34, 100, 82, 0, -76, -86, -27, 48, 78,
+    44, -22, -64, -51, 0, 46, 51, 16, -29, -47, -27, 14,
+    41, 35, 0, -35, -41, -14, 27, 47, 29, -16, -51, -46,
+    0, 51, 64, 22, -44, -78, -48, 27, 86, 76, 0, -82,
+    -100, -34, 66, 115, 69, -37, -116, -100, 0, 102, 121, 39,
+    -75, -127, -74, 39, 117, 98, 0, -95, -109, -34, 63, 104,
+    59, -30, -88, -72, 0, 66, 73, 23, -41, -66, -37, 18,
+    53, 43, 0, -37, -36, -9, 11, 11, 3, -1, 1, 1,
+    -7, -26, -27, 22, 89, 90, 0, -98, -117, -39, 74, 127,
+    75, -39, -121, -102, 0, 100, 116, 37, -69, -115, -66, 34,
+    100, 82, 0, -76, -86, -27, 48, 78, 44, -22, -64, -51,
+    0, 46, 51, 16, -29, -47, -27, 14, 41, 35, 0, -35,
+    -41, -14, 27, 47, 29, -16, -51, -46, 0, 51, 64, 22,
+    -44, -78, -48, 27, 86, 76, 0, -82, -100, -34, 66, 115,
+    69, -37, -116, -100, 0, 102, 121, 39, -75, -127, -74, 39,
+    117, 98, 0, -95, -109, -34, 63, 104, 59, -30, -88, -72,
+    0, 66, 73, 23, -41, -66, -37, 18, 53, 43, 0, -37,
+    -36, -9, 11, 11, 3, -1, 1, 1, -7, -26, -27, 22,
+    89, 90, 0, -98, -117, -39, 74, 127, 75, -39, -121, -102,
+    0, 100, 116, 37, -69, -115, -66, 34, 100, 82, 0, -76,
+    -86, -27, 48, 78, 44, -22, -64, -51, 0, 46, 51, 16,
+    -29, -47, -27, 14, 41, 35, 0, -35, -41, -14, 27, 47,
+    29, -16, -51, -46, 0, 51, 64, 22, -44, -78, -48, 27,
+    86, 76, 0, -82, -100, -34, 66, 115, 69, -37, -116, -100,
+    0, 102, 121, 39, -75, -127, -74, 39, 117, 98, 0, -95,
+    -109, -34, 63, 104, 59, -30, -88, -72, 0, 66, 73, 23,
+    -41, -66, -37, 18, 53, 43, 0, -37, -36, -9, 11, 11,
+    3, -1, 1, 1, -7, -26, -27, 22, 89, 90, 0, -98,
+    -117, -39, 74, 127, 75, -39, -121, -102, 0, 100, 116, 37,
+    -69, -115, -66, 34, 100, 82, 0, -76, -86, -27, 48, 78,
+    44, -22, -64, -51, 0, 46, 51, 16, -29, -47, -27, 14,
+    41, 35, 0, -35, -41, -14, 27, 47, 29, -16, -51, -46,
+    0, 51, 64, 22, -44, -78, -48, 27, 86, 76, 0, -82,
+    -100, -34, 66, 115, 69, -37, -116, -100, 0, 102, 121, 39,
+    -75, -127, -74, 39, 117, 98, 0, -95, -109, -34, 63, 104,
+    59, -30, -88, -72, 0, 66, 73, 23, -41, -66, -37, 18,
+    53, 43, 0, -37, -36, -9, 11, 11, 3, -1, 1, 1,
+    -6, -23, -23, 18, 73, 73, 0, -78, -93, -30, 58, 100,
+    60, -32, -98, -84, 0, 86, 102, 33, -64, -110, -65, 34,
+    107, 91, 0, -93, -110, -36, 69, 117, 69, -37, -113, -97,
+    0, 98, 116, 38, -72, -123, -73, 38, 118, 101, 0, -101,
+    -119, -39, 74, 126, 74, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 120, 102, 0, -102, -120, -39, 74, 125,
+    73, -38, -118, -100, 0, 99, 116, 38, -71, -120, -70, 37,
+    113, 95, 0, -94, -110, -36, 67, 114, 66, -35, -106, -89,
+    0, 88, 103, 33, -62, -105, -61, 32, 97, 82, 0, -80,
+    -94, -30, 57, 95, 55, -29, -88, -74, 0, 72, 84, 27,
+    -50, -85, -49, 26, 78, 65, 0, -63, -74, -24, 44, 74,
+    43, -22, -68, -57, 0, 55, 64, 20, -38, -64, -37, 19,
+    59, 49, 0, -48, -55, -18, 33, 56, 32, -17, -51, -43,
+    0, 42, 48, 15, -29, -49, -28, 15, 45, 38, 0, -37,
+    -43, -14, 26, 44, 26, -14, -41, -35, 0, 35, 41, 13,
+    -25, -42, -25, 13, 40, 34, 0, -34, -41, -13, 25, 43,
+    25, -13, -42, -36, 0, 36, 43, 14, -27, -46, -28, 15,
+    46, 39, 0, -40, -48, -16, 30, 52, 31, -17, -52, -44,
+    0, 46, 55, 18, -35, -60, -36, 19, 59, 51, 0, -53,
+    -63, -21, 40, 69, 41, -22, -69, -59, 0, 61, 73, 24,
+    -46, -79, -47, 25, 79, 68, 0, -69, -83, -27, 52, 90,
+    54, -28, -89, -76, 0, 78, 93, 30, -58, -100, -60, 32,
+    98, 84, 0, -86, -102, -33, 64, 110, 65, -34, -107, -91,
+    0, 93, 110, 36, -69, -117, -69, 37, 113, 97, 0, -98,
+    -116, -38, 72, 123, 73, -38, -118, -101, 0, 101, 119, 39,
+    -74, -126, -74, 39, 121, 103, 0, -103, -121, -39, 75, 127,
+    75, -39, -120, -102, 0, 102, 120, 39, -74, -125, -73, 38,
+    118, 100, 0, -99, -116, -38, 71, 120, 70, -37, -113, -95,
+    0, 94, 110, 36, -67, -114, -66, 35, 106, 89, 0, -88,
+    -103, -33, 62, 105, 61, -32, -97, -82, 0, 80, 94, 30,
+    -57, -95, -55, 29, 88, 74, 0, -72, -84, -27, 50, 85,
+    49, -26, -78, -65, 0, 63, 74, 24, -44, -74, -43, 22,
+    68, 57, 0, -55, -64, -20, 38, 64, 37, -19, -59, -49,
+    0, 48, 55, 18, -33, -56, -32, 17, 51, 43, 0, -42,
+    -48, -15, 29, 49, 28, -15, -45, -38, 0, 37, 43, 14,
+    -26, -44, -26, 14, 41, 35, 0, -35, -41, -13, 25, 42,
+    25, -13, -40, -34, 0, 34, 41, 13, -25, -43, -25, 13,
+    42, 36, 0, -36, -43, -14, 27, 46, 28, -15, -46, -39,
+    0, 40, 48, 16, -30, -52, -31, 17, 52, 44, 0, -46,
+    -55, -18, 35, 60, 36, -19, -59, -51, 0, 53, 63, 21,
+    -40, -69, -41, 22, 69, 59, 0, -61, -73, -24, 46, 79,
+    47, -25, -79, -68, 0, 69, 83, 27, -52, -90, -54, 28,
+    89, 76, 0, -78, -93, -30, 58, 100, 60, -32, -98, -84,
+    0, 86, 102, 33, -64, -110, -65, 34, 107, 91, 0, -93,
+    -110, -36, 69, 117, 69, -37, -113, -97, 0, 98, 116, 38,
+    -72, -123, -73, 38, 118, 101, 0, -101, -119, -39, 74, 126,
+    74, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    120, 102, 0, -102, -120, -39, 74, 125, 73, -38, -118, -100,
+    0, 99, 116, 38, -71, -120, -70, 37, 113, 95, 0, -94,
+    -110, -36, 67, 114, 66, -35, -106, -89, 0, 88, 103, 33,
+    -62, -105, -61, 32, 97, 82, 0, -80, -94, -30, 57, 95,
+    55, -29, -88, -74, 0, 72, 84, 27, -50, -85, -49, 26,
+    78, 65, 0, -63, -74, -24, 44, 74, 43, -22, -68, -57,
+    0, 55, 64, 20, -38, -64, -37, 19, 59, 49, 0, -48,
+    -55, -18, 33, 56, 32, -17, -51, -43, 0, 42, 48, 15,
+    -29, -49, -28, 15, 45, 38, 0, -37, -43, -14, 26, 44,
+    26, -14, -41, -35, 0, 35, 41, 13, -25, -42, -25, 13,
+    40, 34, 0, -34, -41, -13, 25, 43, 25, -13, -42, -36,
+    0, 36, 43, 14, -27, -46, -28, 15, 46, 39, 0, -40,
+    -48, -16, 30, 52, 31, -17, -52, -44, 0, 46, 55, 18,
+    -35, -60, -36, 19, 59, 51, 0, -53, -63, -21, 40, 69,
+    41, -22, -69, -59, 0, 61, 73, 24, -46, -79, -47, 25,
+    79, 68, 0, -69, -83, -27, 52, 90, 54, -28, -89, -76,
+    0, 78, 93, 30, -58, -100, -60, 32, 98, 84, 0, -86,
+    -102, -33, 64, 110, 65, -34, -107, -91, 0, 93, 110, 36,
+    -69, -117, -69, 37, 113, 97, 0, -93, -95, -24, 31, 31,
+    9, -2, -1, 1, 1, -6, -23, -23, 18, 73, 73, 0,
+    -78, -93, -30, 58, 100, 60, -32, -98, -84, 0, 86, 102,
+    33, -64, -110, -65, 34, 107, 91, 0, -93, -110, -36, 69,
+    117, 69, -37, -113, -97, 0, 98, 116, 38, -72, -123, -73,
+    38, 118, 101, 0, -101, -119, -39, 74, 126, 74, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 120, 102, 0,
+    -102, -120, -39, 74, 125, 73, -38, -118, -100, 0, 99, 116,
+    38, -71, -120, -70, 37, 113, 95, 0, -94, -110, -36, 67,
+    114, 66, -35, -106, -89, 0, 88, 103, 33, -62, -105, -61,
+    32, 97, 82, 0, -80, -94, -30, 57, 95, 55, -29, -88,
+    -74, 0, 72, 84, 27, -50, -85, -49, 26, 78, 65, 0,
+    -63, -74, -24, 44, 74, 43, -22, -68, -57, 0, 55, 64,
+    20, -38, -64, -37, 19, 59, 49, 0, -48, -55, -18, 33,
+    56, 32, -17, -51, -43, 0, 42, 48, 15, -29, -49, -28,
+    15, 45, 38, 0, -37, -43, -14, 26, 44, 26, -14, -41,
+    -35, 0, 35, 41, 13, -25, -42, -25, 13, 40, 34, 0,
+    -34, -41, -13, 25, 43, 25, -13, -42, -36, 0, 36, 43,
+    14, -27, -46, -28, 15, 46, 39, 0, -40, -48, -16, 30,
+    52, 31, -17, -52, -44, 0, 46, 55, 18, -35, -60, -36,
+    19, 59, 51, 0, -53, -63, -21, 40, 69, 41, -22, -69,
+    -59, 0, 61, 73, 24, -46, -79, -47, 25, 79, 68, 0,
+    -69, -83, -27, 52, 90, 54, -28, -89, -76, 0, 78, 93,
+    30, -58, -100, -60, 32, 98, 84, 0, -86, -102, -33, 64,
+    110, 65, -34, -107, -91, 0, 93, 110, 36, -69, -117, -69,
+    37, 113, 97, 0, -98, -116, -38, 72, 123, 73, -38, -118,
+    -101, 0, 101, 119, 39, -74, -126, -74, 39, 121, 103, 0,
+    -103, -121, -39, 75, 127, 75, -39, -120, -102, 0, 102, 120,
+    39, -74, -125, -73, 38, 118, 100, 0, -99, -116, -38, 71,
+    120, 70, -37, -113, -95, 0, 94, 110, 36, -67, -114, -66,
+    35, 106, 89, 0, -88, -103, -33, 62, 105, 61, -32, -97,
+    -82, 0, 80, 94, 30, -57, -95, -55, 29, 88, 74, 0,
+    -72, -84, -27, 50, 85, 49, -26, -78, -65, 0, 63, 74,
+    24, -44, -74, -43, 22, 68, 57, 0, -55, -64, -20, 38,
+    64, 37, -19, -59, -49, 0, 48, 55, 18, -33, -56, -32,
+    17, 51, 43, 0, -42, -48, -15, 29, 49, 28, -15, -45,
+    -38, 0, 37, 43, 14, -26, -44, -26, 14, 41, 35, 0,
+    -35, -41, -13, 25, 42, 25, -13, -40, -34, 0, 34, 41,
+    13, -25, -43, -25, 13, 42, 36, 0, -36, -43, -14, 27,
+    46, 28, -15, -46, -39, 0, 40, 48, 16, -30, -52, -31,
+    17, 52, 44, 0, -46, -55, -18, 35, 60, 36, -19, -59,
+    -51, 0, 53, 63, 21, -40, -69, -41, 22, 69, 59, 0,
+    -61, -73, -24, 46, 79, 47, -25, -79, -68, 0, 69, 83,
+    27, -52, -90, -54, 28, 89, 76, 0, -78, -93, -30, 58,
+    100, 60, -32, -98, -84, 0, 86, 102, 33, -64, -110, -65,
+    34, 107, 91, 0, -93, -110, -36, 69, 117, 69, -37, -113,
+    -97, 0, 98, 116, 38, -72, -123, -73, 38, 118, 101, 0,
+    -101, -119, -39, 74, 126, 74, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 120, 102, 0, -102, -120, -39, 74,
+    125, 73, -38, -118, -100, 0, 99, 116, 38, -71, -120, -70,
+    37, 113, 95, 0, -94, -110, -36, 67, 114, 66, -35, -106,
+    -89, 0, 88, 103, 33, -62, -105, -61, 32, 97, 82, 0,
+    -80, -94, -30, 57, 95, 55, -29, -88, -74, 0, 72, 84,
+    27, -50, -85, -49, 26, 78, 65, 0, -63, -74, -24, 44,
+    74, 43, -22, -68, -57, 0, 55, 64, 20, -38, -64, -37,
+    19, 59, 49, 0, -48, -55, -18, 33, 56, 32, -17, -51,
+    -43, 0, 42, 48, 15, -29, -49, -28, 15, 45, 38, 0,
+    -37, -43, -14, 26, 44, 26, -14, -41, -35, 0, 35, 41,
+    13, -25, -42, -25, 13, 40, 34, 0, -34, -41, -13, 25,
+    43, 25, -13, -42, -36, 0, 36, 43, 14, -27, -46, -28,
+    15, 46, 39, 0, -40, -48, -16, 30, 52, 31, -17, -52,
+    -44, 0, 46, 55, 18, -35, -60, -36, 19, 59, 51, 0,
+    -53, -63, -21, 40, 69, 41, -22, -69, -59, 0, 61, 73,
+    24, -46, -79, -47, 25, 79, 68, 0, -69, -83, -27, 52,
+    90, 54, -28, -89, -76, 0, 78, 93, 30, -58, -100, -60,
+    32, 98, 84, 0, -86, -102, -33, 64, 110, 65, -34, -107,
+    -91, 0, 93, 110, 36, -69, -117, -69, 37, 113, 97, 0,
+    -93, -95, -24, 31, 31, 9, -2, -1, 1, 1, -6, -23,
+    -23, 18, 73, 73, 0, -78, -93, -30, 58, 100, 60, -32,
+    -98, -84, 0, 86, 102, 33, -64, -110, -65, 34, 107, 91,
+    0, -93, -110, -36, 69, 117, 69, -37, -113, -97, 0, 98,
+    116, 38, -72, -123, -73, 38, 118, 101, 0, -101, -119, -39,
+    74, 126, 74, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 120, 102, 0, -102, -120, -39, 74, 125, 73, -38,
+    -118, -100, 0, 99, 116, 38, -71, -120, -70, 37, 113, 95,
+    0, -94, -110, -36, 67, 114, 66, -35, -106, -89, 0, 88,
+    103, 33, -62, -105, -61, 32, 97, 82, 0, -80, -94, -30,
+    57, 95, 55, -29, -88, -74, 0, 72, 84, 27, -50, -85,
+    -49, 26, 78, 65, 0, -63, -74, -24, 44, 74, 43, -22,
+    -68, -57, 0, 55, 64, 20, -38, -64, -37, 19, 59, 49,
+    0, -48, -55, -18, 33, 56, 32, -17, -51, -43, 0, 42,
+    48, 15, -29, -49, -28, 15, 45, 38, 0, -37, -43, -14,
+    26, 44, 26, -14, -41, -35, 0, 35, 41, 13, -25, -42,
+    -25, 13, 40, 34, 0, -34, -41, -13, 25, 43, 25, -13,
+    -42, -36, 0, 36, 43, 14, -27, -46, -28, 15, 46, 39,
+    0, -40, -48, -16, 30, 52, 31, -17, -52, -44, 0, 46,
+    55, 18, -35, -60, -36, 19, 59, 51, 0, -53, -63, -21,
+    40, 69, 41, -22, -69, -59, 0, 61, 73, 24, -46, -79,
+    -47, 25, 79, 68, 0, -69, -83, -27, 52, 90, 54, -28,
+    -89, -76, 0, 78, 93, 30, -58, -100, -60, 32, 98, 84,
+    0, -86, -102, -33, 64, 110, 65, -34, -107, -91, 0, 93,
+    110, 36, -69, -117, -69, 37, 113, 97, 0, -98, -116, -38,
+    72, 123, 73, -38, -118, -101, 0, 101, 119, 39, -74, -126,
+    -74, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39,
+    -120, -102, 0, 102, 120, 39, -74, -125, -73, 38, 118, 100,
+    0, -99, -116, -38, 71, 120, 70, -37, -113, -95, 0, 94,
+    110, 36, -67, -114, -66, 35, 106, 89, 0, -88, -103, -33,
+    62, 105, 61, -32, -97, -82, 0, 80, 94, 30, -57, -95,
+    -55, 29, 88, 74, 0, -72, -84, -27, 50, 85, 49, -26,
+    -78, -65, 0, 63, 74, 24, -44, -74, -43, 22, 68, 57,
+    0, -55, -64, -20, 38, 64, 37, -19, -59, -49, 0, 48,
+    55, 18, -33, -56, -32, 17, 51, 43, 0, -42, -48, -15,
+    29, 49, 28, -15, -45, -38, 0, 37, 43, 14, -26, -44,
+    -26, 14, 41, 35, 0, -35, -41, -13, 25, 42, 25, -13,
+    -40, -34, 0, 34, 41, 13, -25, -43, -25, 13, 42, 36,
+    0, -36, -43, -14, 27, 46, 28, -15, -46, -39, 0, 40,
+    48, 16, -30, -52, -31, 17, 52, 44, 0, -46, -55, -18,
+    35, 60, 36, -19, -59, -51, 0, 53, 63, 21, -40, -69,
+    -41, 22, 69, 59, 0, -61, -73, -24, 46, 79, 47, -25,
+    -79, -68, 0, 69, 83, 27, -52, -90, -54, 28, 89, 76,
+    0, -78, -93, -30, 58, 100, 60, -32, -98, -84, 0, 86,
+    102, 33, -64, -110, -65, 34, 107, 91, 0, -93, -110, -36,
+    69, 117, 69, -37, -113, -97, 0, 98, 116, 38, -72, -123,
+    -73, 38, 118, 101, 0, -101, -119, -39, 74, 126, 74, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 120, 102,
+    0, -102, -120, -39, 74, 125, 73, -38, -118, -100, 0, 99,
+    116, 38, -71, -120, -70, 37, 113, 95, 0, -94, -110, -36,
+    67, 114, 66, -35, -106, -89, 0, 88, 103, 33, -62, -105,
+    -61, 32, 97, 82, 0, -80, -94, -30, 57, 95, 55, -29,
+    -88, -74, 0, 72, 84, 27, -50, -85, -49, 26, 78, 65,
+    0, -63, -74, -24, 44, 74, 43, -22, -68, -57, 0, 55,
+    64, 20, -38, -64, -37, 19, 59, 49, 0, -48, -55, -18,
+    33, 56, 32, -17, -51, -43, 0, 42, 48, 15, -29, -49,
+    -28, 15, 45, 38, 0, -37, -43, -14, 26, 44, 26, -14,
+    -41, -35, 0, 35, 41, 13, -25, -42, -25, 13, 40, 34,
+    0, -34, -41, -13, 25, 43, 25, -13, -42, -36, 0, 36,
+    43, 14, -27, -46, -28, 15, 46, 39, 0, -40, -48, -16,
+    30, 52, 31, -17, -52, -44, 0, 46, 55, 18, -35, -60,
+    -36, 19, 59, 51, 0, -53, -63, -21, 40, 69, 41, -22,
+    -69, -59, 0, 61, 73, 24, -46, -79, -47, 25, 79, 68,
+    0, -69, -83, -27, 52, 90, 54, -28, -89, -76, 0, 78,
+    93, 30, -58, -100, -60, 32, 98, 84, 0, -86, -102, -33,
+    64, 110, 65, -34, -107, -91, 0, 93, 110, 36, -69, -117,
+    -69, 37, 113, 97, 0, -93, -95, -24, 31, 31, 9, -2,
+    -1, 1, 1, -6, -23, -23, 18, 73, 73, 0, -78, -93,
+    -30, 58, 100, 60, -32, -98, -84, 0, 86, 102, 33, -64,
+    -110, -65, 34, 107, 91, 0, -93, -110, -36, 69, 117, 69,
+    -37, -113, -97, 0, 98, 116, 38, -72, -123, -73, 38, 118,
+    101, 0, -101, -119, -39, 74, 126, 74, -39, -121, -103, 0,
+    103, 121, 39, -75, -127, -75, 39, 120, 102, 0, -102, -120,
+    -39, 74, 125, 73, -38, -118, -100, 0, 99, 116, 38, -71,
+    -120, -70, 37, 113, 95, 0, -94, -110, -36, 67, 114, 66,
+    -35, -106, -89, 0, 88, 103, 33, -62, -105, -61, 32, 97,
+    82, 0, -80, -94, -30, 57, 95, 55, -29, -88, -74, 0,
+    72, 84, 27, -50, -85, -49, 26, 78, 65, 0, -63, -74,
+    -24, 44, 74, 43, -22, -68, -57, 0, 55, 64, 20, -38,
+    -64, -37, 19, 59, 49, 0, -48, -55, -18, 33, 56, 32,
+    -17, -51, -43, 0, 42, 48, 15, -29, -49, -28, 15, 45,
+    38, 0, -37, -43, -14, 26, 44, 26, -14, -41, -35, 0,
+    35, 41, 13, -25, -42, -25, 13, 40, 34, 0, -34, -41,
+    -13, 25, 43, 25, -13, -42, -36, 0, 36, 43, 14, -27,
+    -46, -28, 15, 46, 39, 0, -40, -48, -16, 30, 52, 31,
+    -17, -52, -44, 0, 46, 55, 18, -35, -60, -36, 19, 59,
+    51, 0, -53, -63, -21, 40, 69, 41, -22, -69, -59, 0,
+    61, 73, 24, -46, -79, -47, 25, 79, 68, 0, -69, -83,
+    -27, 52, 90, 54, -28, -89, -76, 0, 78, 93, 30, -58,
+    -100, -60, 32, 98, 84, 0, -86, -102, -33, 64, 110, 65,
+    -34, -107, -91, 0, 93, 110, 36, -69, -117, -69, 37, 113,
+    97, 0, -98, -116, -38, 72, 123, 73, -38, -118, -101, 0,
+    101, 119, 39, -74, -126, -74, 39, 121, 103, 0, -103, -121,
+    -39, 75, 127, 75, -39, -120, -102, 0, 102, 120, 39, -74,
+    -125, -73, 38, 118, 100, 0, -99, -116, -38, 71, 120, 70,
+    -37, -113, -95, 0, 94, 110, 36, -67, -114, -66, 35, 106,
+    89, 0, -88, -103, -33, 62, 105, 61, -32, -97, -82, 0,
+    80, 94, 30, -57, -95, -55, 29, 88, 74, 0, -72, -84,
+    -27, 50, 85, 49, -26, -78, -65, 0, 63, 74, 24, -44,
+    -74, -43, 22, 68, 57, 0, -55, -64, -20, 38, 64, 37,
+    -19, -59, -49, 0, 48, 55, 18, -33, -56, -32, 17, 51,
+    43, 0, -42, -48, -15, 29, 49, 28, -15, -45, -38, 0,
+    37, 43, 14, -26, -44, -26, 14, 41, 35, 0, -35, -41,
+    -13, 25, 42, 25, -13, -40, -34, 0, 34, 41, 13, -25,
+    -43, -25, 13, 42, 36, 0, -36, -43, -14, 27, 46, 28,
+    -15, -46, -39, 0, 40, 48, 16, -30, -52, -31, 17, 52,
+    44, 0, -46, -55, -18, 35, 60, 36, -19, -59, -51, 0,
+    53, 63, 21, -40, -69, -41, 22, 69, 59, 0, -61, -73,
+    -24, 46, 79, 47, -25, -79, -68, 0, 69, 83, 27, -52,
+    -90, -54, 28, 89, 76, 0, -78, -93, -30, 58, 100, 60,
+    -32, -98, -84, 0, 86, 102, 33, -64, -110, -65, 34, 107,
+    91, 0, -93, -110, -36, 69, 117, 69, -37, -113, -97, 0,
+    98, 116, 38, -72, -123, -73, 38, 118, 101, 0, -101, -119,
+    -39, 74, 126, 74, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 120, 102, 0, -102, -120, -39, 74, 125, 73,
+    -38, -118, -100, 0, 99, 116, 38, -71, -120, -70, 37, 113,
+    95, 0, -94, -110, -36, 67, 114, 66, -35, -106, -89, 0,
+    88, 103, 33, -62, -105, -61, 32, 97, 82, 0, -80, -94,
+    -30, 57, 95, 55, -29, -88, -74, 0, 72, 84, 27, -50,
+    -85, -49, 26, 78, 65, 0, -63, -74, -24, 44, 74, 43,
+    -22, -68, -57, 0, 55, 64, 20, -38, -64, -37, 19, 59,
+    49, 0, -48, -55, -18, 33, 56, 32, -17, -51, -43, 0,
+    42, 48, 15, -29, -49, -28, 15, 45, 38, 0, -37, -43,
+    -14, 26, 44, 26, -14, -41, -35, 0, 35, 41, 13, -25,
+    -42, -25, 13, 40, 34, 0, -34, -41, -13, 25, 43, 25,
+    -13, -42, -36, 0, 36, 43, 14, -27, -46, -28, 15, 46,
+    39, 0, -40, -48, -16, 30, 52, 31, -17, -52, -44, 0,
+    46, 55, 18, -35, -60, -36, 19, 59, 51, 0, -53, -63,
+    -21, 40, 69, 41, -22, -69, -59, 0, 61, 73, 24, -46,
+    -79, -47, 25, 79, 68, 0, -69, -83, -27, 52, 90, 54,
+    -28, -89, -76, 0, 78, 93, 30, -58, -100, -60, 32, 98,
+    84, 0, -86, -102, -33, 64, 110, 65, -34, -107, -91, 0,
+    93, 110, 36, -69, -117, -69, 37, 113, 97, 0, -93, -95,
+    -24, 31, 31, 9, -2, -1, 2, 6, 15, 28, 46, 63,
+    74, 76, 71, 64, 54, 41, 27, 11, -6, -23, -40, -56,
+    -70, -82, -92, -98, -101, -101, -97, -89, -78, -63, -46, -27,
+    -7, 14, 35, 55, 73, 89, 102, 112, 118, 119, 116, 109,
+    98, 84, 66, 45, 23, 0, -23, -46, -67, -86, -102, -115,
+    -123, -127, -126, -121, -112, -98, -81, -61, -39, -16, 8, 32,
+    54, 74, 92, 106, 117, 123, 125, 122, 115, 104, 89, 71,
+    51, 30, 7, -15, -36, -56, -74, -89, -100, -107, -111, -111,
+    -106, -98, -87, -73, -56, -38, -19, 0, 19, 36, 52, 66,
+    77, 84, 89, 90, 88, 83, 75, 65, 53, 39, 25, 10,
+    -5, -19, -31, -42, -51, -58, -62, -64, -64, -61, -56, -50,
+    -42, -33, -23, -13, -3, 6, 15, 22, 29, 33, 37, 38,
+    39, 37, 35, 31, 27, 22, 16, 11, 5, 0, -5, -9,
+    -12, -15, -16, -17, -17, -17, -16, -14, -12, -10, -7, -5,
+    -3, -1, 1, 2, 3, 4, 4, 4, 4, 4, 3, 3,
+    2, 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0,
+    1, 2, 3, 4, 5, 6, 7, 8, 9, 9, 9, 9,
+    8, 7, 5, 2, -1, -4, -8, -12, -16, -19, -22, -25,
+    -26, -27, -27, -26, -23, -19, -15, -9, -2, 5, 12, 20,
+    28, 35, 41, 46, 49, 51, 51, 49, 45, 39, 32, 22,
+    12, 0, -12, -25, -37, -48, -58, -66, -73, -76, -78, -76,
+    -71, -64, -54, -41, -27, -11, 6, 23, 40, 56, 70, 82,
+    92, 98, 101, 101, 97, 89, 78, 63, 46, 27, 7, -14,
+    -35, -55, -73, -89, -102, -112, -118, -119, -116, -109, -98, -84,
+    -66, -45, -23, 0, 23, 46, 67, 86, 102, 115, 123, 127,
+    126, 121, 112, 98, 81, 61, 39, 16, -8, -32, -54, -74,
+    -92, -106, -117, -123, -125, -122, -115, -104, -89, -71, -51, -30,
+    -7, 15, 36, 56, 74, 89, 100, 107, 111, 111, 106, 98,
+    87, 73, 56, 38, 19, 0, -19, -36, -52, -66, -77, -84,
+    -89, -90, -88, -83, -75, -65, -53, -39, -25, -10, 5, 19,
+    31, 42, 51, 58, 62, 64, 64, 61, 56, 50, 42, 33,
+    23, 13, 3, -6, -15, -22, -29, -33, -37, -38, -39, -37,
+    -35, -31, -27, -22, -16, -11, -5, 0, 5, 9, 12, 15,
+    16, 17, 17, 17, 16, 14, 12, 10, 7, 5, 3, 1,
+    -1, -2, -3, -4, -4, -4, -4, -4, -3, -3, -2, -2,
+    -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 1, 1, 0, 0, -1, -2,
+    -3, -4, -5, -6, -7, -8, -9, -9, -9, -9, -8, -7,
+    -5, -2, 1, 4, 8, 12, 16, 19, 22, 25, 26, 27,
+    27, 26, 23, 19, 15, 9, 2, -5, -12, -20, -28, -35,
+    -41, -46, -49, -51, -51, -49, -45, -39, -32, -22, -12, 0,
+    12, 25, 37, 48, 58, 66, 73, 76, 78, 76, 71, 64,
+    54, 41, 27, 11, -6, -23, -40, -56, -70, -82, -92, -98,
+    -101, -101, -97, -89, -78, -63, -46, -27, -7, 14, 35, 55,
+    73, 89, 102, 112, 118, 119, 116, 109, 98, 84, 66, 45,
+    23, 0, -23, -46, -67, -86, -102, -115, -123, -127, -126, -121,
+    -112, -98, -81, -61, -39, -16, 8, 32, 54, 74, 92, 106,
+    117, 123, 125, 122, 115, 104, 89, 71, 51, 30, 7, -15,
+    -36, -56, -74, -89, -100, -107, -111, -111, -106, -98, -87, -73,
+    -56, -38, -19, 0, 19, 36, 52, 66, 77, 84, 89, 90,
+    88, 83, 75, 65, 53, 39, 25, 10, -5, -19, -31, -42,
+    -51, -58, -62, -64, -64, -61, -56, -50, -42, -33, -23, -13,
+    -3, 6, 15, 22, 29, 33, 37, 38, 39, 37, 35, 31,
+    27, 22, 16, 11, 5, 0, -5, -9, -12, -15, -16, -17,
+    -17, -17, -16, -14, -12, -10, -7, -5, -3, -1, 1, 2,
+    3, 4, 4, 4, 4, 4, 3, 3, 2, 2, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    -1, -1, -1, -1, -1, -1, 0, 0, 1, 2, 3, 4,
+    5, 6, 7, 8, 9, 9, 9, 9, 8, 7, 5, 2,
+    -1, -4, -8, -12, -16, -19, -22, -25, -26, -27, -27, -26,
+    -23, -19, -15, -9, -2, 5, 12, 20, 28, 35, 41, 46,
+    49, 51, 51, 49, 45, 39, 32, 22, 12, 0, -12, -25,
+    -37, -48, -58, -66, -73, -76, -78, -76, -71, -64, -54, -41,
+    -27, -11, 6, 23, 40, 56, 70, 82, 92, 98, 101, 101,
+    97, 89, 78, 63, 46, 27, 7, -14, -35, -55, -73, -89,
+    -102, -112, -112, -97, -73, -47, -25, -10, -3, 2, 6, 15,
+    28, 46, 63, 74, 76, 71, 64, 54, 41, 27, 11, -6,
+    -23, -40, -56, -70, -82, -92, -98, -101, -101, -97, -89, -78,
+    -63, -46, -27, -7, 14, 35, 55, 73, 89, 102, 112, 118,
+    119, 116, 109, 98, 84, 66, 45, 23, 0, -23, -46, -67,
+    -86, -102, -115, -123, -127, -126, -121, -112, -98, -81, -61, -39,
+    -16, 8, 32, 54, 74, 92, 106, 117, 123, 125, 122, 115,
+    104, 89, 71, 51, 30, 7, -15, -36, -56, -74, -89, -100,
+    -107, -111, -111, -106, -98, -87, -73, -56, -38, -19, 0, 19,
+    36, 52, 66, 77, 84, 89, 90, 88, 83, 75, 65, 53,
+    39, 25, 10, -5, -19, -31, -42, -51, -58, -62, -64, -64,
+    -61, -56, -50, -42, -33, -23, -13, -3, 6, 15, 22, 29,
+    33, 37, 38, 39, 37, 35, 31, 27, 22, 16, 11, 5,
+    0, -5, -9, -12, -15, -16, -17, -17, -17, -16, -14, -12,
+    -10, -7, -5, -3, -1, 1, 2, 3, 4, 4, 4, 4,
+    4, 3, 3, 2, 2, 1, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1,
+    -1, 0, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9,
+    9, 9, 9, 8, 7, 5, 2, -1, -4, -8, -12, -16,
+    -19, -22, -25, -26, -27, -27, -26, -23, -19, -15, -9, -2,
+    5, 12, 20, 28, 35, 41, 46, 49, 51, 51, 49, 45,
+    39, 32, 22, 12, 0, -12, -25, -37, -48, -58, -66, -73,
+    -76, -78, -76, -71, -64, -54, -41, -27, -11, 6, 23, 40,
+    56, 70, 82, 92, 98, 101, 101, 97, 89, 78, 63, 46,
+    27, 7, -14, -35, -55, -73, -89, -102, -112, -118, -119, -116,
+    -109, -98, -84, -66, -45, -23, 0, 23, 46, 67, 86, 102,
+    115, 123, 127, 126, 121, 112, 98, 81, 61, 39, 16, -8,
+    -32, -54, -74, -92, -106, -117, -123, -125, -122, -115, -104, -89,
+    -71, -51, -30, -7, 15, 36, 56, 74, 89, 100, 107, 111,
+    111, 106, 98, 87, 73, 56, 38, 19, 0, -19, -36, -52,
+    -66, -77, -84, -89, -90, -88, -83, -75, -65, -53, -39, -25,
+    -10, 5, 19, 31, 42, 51, 58, 62, 64, 64, 61, 56,
+    50, 42, 33, 23, 13, 3, -6, -15, -22, -29, -33, -37,
+    -38, -39, -37, -35, -31, -27, -22, -16, -11, -5, 0, 5,
+    9, 12, 15, 16, 17, 17, 17, 16, 14, 12, 10, 7,
+    5, 3, 1, -1, -2, -3, -4, -4, -4, -4, -4, -3,
+    -3, -2, -2, -1, -1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 0,
+    0, -1, -2, -3, -4, -5, -6, -7, -8, -9, -9, -9,
+    -9, -8, -7, -5, -2, 1, 4, 8, 12, 16, 19, 22,
+    25, 26, 27, 27, 26, 23, 19, 15, 9, 2, -5, -12,
+    -20, -28, -35, -41, -46, -49, -51, -51, -49, -45, -39, -32,
+    -22, -12, 0, 12, 25, 37, 48, 58, 66, 73, 76, 78,
+    76, 71, 64, 54, 41, 27, 11, -6, -23, -40, -56, -70,
+    -82, -92, -98, -101, -101, -97, -89, -78, -63, -46, -27, -7,
+    14, 35, 55, 73, 89, 102, 112, 118, 119, 116, 109, 98,
+    84, 66, 45, 23, 0, -23, -46, -67, -86, -102, -115, -123,
+    -127, -126, -121, -112, -98, -81, -61, -39, -16, 8, 32, 54,
+    74, 92, 106, 117, 123, 125, 122, 115, 104, 89, 71, 51,
+    30, 7, -15, -36, -56, -74, -89, -100, -107, -111, -111, -106,
+    -98, -87, -73, -56, -38, -19, 0, 19, 36, 52, 66, 77,
+    84, 89, 90, 88, 83, 75, 65, 53, 39, 25, 10, -5,
+    -19, -31, -42, -51, -58, -62, -64, -64, -61, -56, -50, -42,
+    -33, -23, -13, -3, 6, 15, 22, 29, 33, 37, 38, 39,
+    37, 35, 31, 27, 22, 16, 11, 5, 0, -5, -9, -12,
+    -15, -16, -17, -17, -17, -16, -14, -12, -10, -7, -5, -3,
+    -1, 1, 2, 3, 4, 4, 4, 4, 4, 3, 3, 2,
+    2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 1,
+    2, 3, 4, 5, 6, 7, 8, 9, 9, 9, 9, 8,
+    7, 5, 2, -1, -4, -8, -12, -16, -19, -22, -25, -26,
+    -27, -27, -26, -23, -19, -15, -9, -2, 5, 12, 20, 28,
+    35, 41, 46, 49, 51, 51, 49, 45, 39, 32, 22, 12,
+    0, -12, -25, -37, -48, -58, -66, -73, -76, -78, -76, -71,
+    -64, -54, -41, -27, -11, 6, 23, 40, 56, 70, 82, 92,
+    98, 101, 101, 97, 89, 78, 63, 46, 27, 7, -14, -35,
+    -55, -73, -89, -102, -112, -112, -97, -73, -47, -25, -10, -3,
+    2, 6, 15, 28, 46, 63, 74, 76, 71, 64, 54, 41,
+    27, 11, -6, -23, -40, -56, -70, -82, -92, -98, -101, -101,
+    -97, -89, -78, -63, -46, -27, -7, 14, 35, 55, 73, 89,
+    102, 112, 118, 119, 116, 109, 98, 84, 66, 45, 23, 0,
+    -23, -46, -67, -86, -102, -115, -123, -127, -126, -121, -112, -98,
+    -81, -61, -39, -16, 8, 32, 54, 74, 92, 106, 117, 123,
+    125, 122, 115, 104, 89, 71, 51, 30, 7, -15, -36, -56,
+    -74, -89, -100, -107, -111, -111, -106, -98, -87, -73, -56, -38,
+    -19, 0, 19, 36, 52, 66, 77, 84, 89, 90, 88, 83,
+    75, 65, 53, 39, 25, 10, -5, -19, -31, -42, -51, -58,
+    -62, -64, -64, -61, -56, -50, -42, -33, -23, -13, -3, 6,
+    15, 22, 29, 33, 37, 38, 39, 37, 35, 31, 27, 22,
+    16, 11, 5, 0, -5, -9, -12, -15, -16, -17, -17, -17,
+    -16, -14, -12, -10, -7, -5, -3, -1, 1, 2, 3, 4,
+    4, 4, 4, 4, 3, 3, 2, 2, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
+    -1, -1, -1, -1, 0, 0, 1, 2, 3, 4, 5, 6,
+    7, 8, 9, 9, 9, 9, 8, 7, 5, 2, -1, -4,
+    -8, -12, -16, -19, -22, -25, -26, -27, -27, -26, -23, -19,
+    -15, -9, -2, 5, 12, 20, 28, 35, 41, 46, 49, 51,
+    51, 49, 45, 39, 32, 22, 12, 0, -12, -25, -37, -48,
+    -58, -66, -73, -76, -78, -76, -71, -64, -54, -41, -27, -11,
+    6, 23, 40, 56, 70, 82, 92, 98, 101, 101, 97, 89,
+    78, 63, 46, 27, 7, -14, -35, -55, -73, -89, -102, -112,
+    -118, -119, -116, -109, -98, -84, -66, -45, -23, 0, 23, 46,
+    67, 86, 102, 115, 123, 127, 126, 121, 112, 98, 81, 61,
+    39, 16, -8, -32, -54, -74, -92, -106, -117, -123, -125, -122,
+    -115, -104, -89, -71, -51, -30, -7, 15, 36, 56, 74, 89,
+    100, 107, 111, 111, 106, 98, 87, 73, 56, 38, 19, 0,
+    -19, -36, -52, -66, -77, -84, -89, -90, -88, -83, -75, -65,
+    -53, -39, -25, -10, 5, 19, 31, 42, 51, 58, 62, 64,
+    64, 61, 56, 50, 42, 33, 23, 13, 3, -6, -15, -22,
+    -29, -33, -37, -38, -39, -37, -35, -31, -27, -22, -16, -11,
+    -5, 0, 5, 9, 12, 15, 16, 17, 17, 17, 16, 14,
+    12, 10, 7, 5, 3, 1, -1, -2, -3, -4, -4, -4,
+    -4, -4, -3, -3, -2, -2, -1, -1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    1, 1, 0, 0, -1, -2, -3, -4, -5, -6, -7, -8,
+    -9, -9, -9, -9, -8, -7, -5, -2, 1, 4, 8, 12,
+    16, 19, 22, 25, 26, 27, 27, 26, 23, 19, 15, 9,
+    2, -5, -12, -20, -28, -35, -41, -46, -49, -51, -51, -49,
+    -45, -39, -32, -22, -12, 0, 12, 25, 37, 48, 58, 66,
+    73, 76, 78, 76, 71, 64, 54, 41, 27, 11, -6, -23,
+    -40, -56, -70, -82, -92, -98, -101, -101, -97, -89, -78, -63,
+    -46, -27, -7, 14, 35, 55, 73, 89, 102, 112, 118, 119,
+    116, 109, 98, 84, 66, 45, 23, 0, -23, -46, -67, -86,
+    -102, -115, -123, -127, -126, -121, -112, -98, -81, -61, -39, -16,
+    8, 32, 54, 74, 92, 106, 117, 123, 125, 122, 115, 104,
+    89, 71, 51, 30, 7, -15, -36, -56, -74, -89, -100, -107,
+    -111, -111, -106, -98, -87, -73, -56, -38, -19, 0, 19, 36,
+    52, 66, 77, 84, 89, 90, 88, 83, 75, 65, 53, 39,
+    25, 10, -5, -19, -31, -42, -51, -58, -62, -64, -64, -61,
+    -56, -50, -42, -33, -23, -13, -3, 6, 15, 22, 29, 33,
+    37, 38, 39, 37, 35, 31, 27, 22, 16, 11, 5, 0,
+    -5, -9, -12, -15, -16, -17, -17, -17, -16, -14, -12, -10,
+    -7, -5, -3, -1, 1, 2, 3, 4, 4, 4, 4, 4,
+    3, 3, 2, 2, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1,
+    0, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 9,
+    9, 9, 8, 7, 5, 2, -1, -4, -8, -12, -16, -19,
+    -22, -25, -26, -27, -27, -26, -23, -19, -15, -9, -2, 5,
+    12, 20, 28, 35, 41, 46, 49, 51, 51, 49, 45, 39,
+    32, 22, 12, 0, -12, -25, -37, -48, -58, -66, -73, -76,
+    -78, -76, -71, -64, -54, -41, -27, -11, 6, 23, 40, 56,
+    70, 82, 92, 98, 101, 101, 97, 89, 78, 63, 46, 27,
+    7, -14, -35, -55, -73, -89, -102, -112, -112, -97, -73, -47,
+    -25, -10, -3, 2, 6, 15, 28, 46, 63, 74, 76, 71,
+    64, 54, 41, 27, 11, -6, -23, -40, -56, -70, -82, -92,
+    -98, -101, -101, -97, -89, -78, -63, -46, -27, -7, 14, 35,
+    55, 73, 89, 102, 112, 118, 119, 116, 109, 98, 84, 66,
+    45, 23, 0, -23, -46, -67, -86, -102, -115, -123, -127, -126,
+    -121, -112, -98, -81, -61, -39, -16, 8, 32, 54, 74, 92,
+    106, 117, 123, 125, 122, 115, 104, 89, 71, 51, 30, 7,
+    -15, -36, -56, -74, -89, -100, -107, -111, -111, -106, -98, -87,
+    -73, -56, -38, -19, 0, 19, 36, 52, 66, 77, 84, 89,
+    90, 88, 83, 75, 65, 53, 39, 25, 10, -5, -19, -31,
+    -42, -51, -58, -62, -64, -64, -61, -56, -50, -42, -33, -23,
+    -13, -3, 6, 15, 22, 29, 33, 37, 38, 39, 37, 35,
+    31, 27, 22, 16, 11, 5, 0, -5, -9, -12, -15, -16,
+    -17, -17, -17, -16, -14, -12, -10, -7, -5, -3, -1, 1,
+    2, 3, 4, 4, 4, 4, 4, 3, 3, 2, 2, 1,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -1, -1, -1, -1, -1, 0, 0, 1, 2, 3,
+    4, 5, 6, 7, 8, 9, 9, 9, 9, 8, 7, 5,
+    2, -1, -4, -8, -12, -16, -19, -22, -25, -26, -27, -27,
+    -26, -23, -19, -15, -9, -2, 5, 12, 20, 28, 35, 41,
+    46, 49, 51, 51, 49, 45, 39, 32, 22, 12, 0, -12,
+    -25, -37, -48, -58, -66, -73, -76, -78, -76, -71, -64, -54,
+    -41, -27, -11, 6, 23, 40, 56, 70, 82, 92, 98, 101,
+    101, 97, 89, 78, 63, 46, 27, 7, -14, -35, -55, -73,
+    -89, -102, -112, -118, -119, -116, -109, -98, -84, -66, -45, -23,
+    0, 23, 46, 67, 86, 102, 115, 123, 127, 126, 121, 112,
+    98, 81, 61, 39, 16, -8, -32, -54, -74, -92, -106, -117,
+    -123, -125, -122, -115, -104, -89, -71, -51, -30, -7, 15, 36,
+    56, 74, 89, 100, 107, 111, 111, 106, 98, 87, 73, 56,
+    38, 19, 0, -19, -36, -52, -66, -77, -84, -89, -90, -88,
+    -83, -75, -65, -53, -39, -25, -10, 5, 19, 31, 42, 51,
+    58, 62, 64, 64, 61, 56, 50, 42, 33, 23, 13, 3,
+    -6, -15, -22, -29, -33, -37, -38, -39, -37, -35, -31, -27,
+    -22, -16, -11, -5, 0, 5, 9, 12, 15, 16, 17, 17,
+    17, 16, 14, 12, 10, 7, 5, 3, 1, -1, -2, -3,
+    -4, -4, -4, -4, -4, -3, -3, -2, -2, -1, -1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    1, 1, 1, 1, 1, 0, 0, -1, -2, -3, -4, -5,
+    -6, -7, -8, -9, -9, -9, -9, -8, -7, -5, -2, 1,
+    4, 8, 12, 16, 19, 22, 25, 26, 27, 27, 26, 23,
+    19, 15, 9, 2, -5, -12, -20, -28, -35, -41, -46, -49,
+    -51, -51, -49, -45, -39, -32, -22, -12, 0, 12, 25, 37,
+    48, 58, 66, 73, 76, 78, 76, 71, 64, 54, 41, 27,
+    11, -6, -23, -40, -56, -70, -82, -92, -98, -101, -101, -97,
+    -89, -78, -63, -46, -27, -7, 14, 35, 55, 73, 89, 102,
+    112, 118, 119, 116, 109, 98, 84, 66, 45, 23, 0, -23,
+    -46, -67, -86, -102, -115, -123, -127, -126, -121, -112, -98, -81,
+    -61, -39, -16, 8, 32, 54, 74, 92, 106, 117, 123, 125,
+    122, 115, 104, 89, 71, 51, 30, 7, -15, -36, -56, -74,
+    -89, -100, -107, -111, -111, -106, -98, -87, -73, -56, -38, -19,
+    0, 19, 36, 52, 66, 77, 84, 89, 90, 88, 83, 75,
+    65, 53, 39, 25, 10, -5, -19, -31, -42, -51, -58, -62,
+    -64, -64, -61, -56, -50, -42, -33, -23, -13, -3, 6, 15,
+    22, 29, 33, 37, 38, 39, 37, 35, 31, 27, 22, 16,
+    11, 5, 0, -5, -9, -12, -15, -16, -17, -17, -17, -16,
+    -14, -12, -10, -7, -5, -3, -1, 1, 2, 3, 4, 4,
+    4, 4, 4, 3, 3, 2, 2, 1, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1,
+    -1, -1, -1, 0, 0, 1, 2, 3, 4, 5, 6, 7,
+    8, 9, 9, 9, 9, 8, 7, 5, 2, -1, -4, -8,
+    -12, -16, -19, -22, -25, -26, -27, -27, -26, -23, -19, -15,
+    -9, -2, 5, 12, 20, 28, 35, 41, 46, 49, 51, 51,
+    49, 45, 39, 32, 22, 12, 0, -12, -25, -37, -48, -58,
+    -66, -73, -76, -78, -76, -71, -64, -54, -41, -27, -11, 6,
+    23, 40, 56, 70, 82, 92, 98, 101, 101, 97, 89, 78,
+    63, 46, 27, 7, -14, -35, -55, -73, -89, -102, -112, -112,
+    -97, -73, -47, -25, -10, -3, 2, 6, 15, 28, 46, 63,
+    74, 76, 71, 64, 54, 41, 27, 11, -6, -23, -40, -56,
+    -70, -82, -92, -98, -101, -101, -97, -89, -78, -63, -46, -27,
+    -7, 14, 35, 55, 73, 89, 102, 112, 118, 119, 116, 109,
+    98, 84, 66, 45, 23, 0, -23, -46, -67, -86, -102, -115,
+    -123, -127, -126, -121, -112, -98, -81, -61, -39, -16, 8, 32,
+    54, 74, 92, 106, 117, 123, 125, 122, 115, 104, 89, 71,
+    51, 30, 7, -15, -36, -56, -74, -89, -100, -107, -111, -111,
+    -106, -98, -87, -73, -56, -38, -19, 0, 19, 36, 52, 66,
+    77, 84, 89, 90, 88, 83, 75, 65, 53, 39, 25, 10,
+    -5, -19, -31, -42, -51, -58, -62, -64, -64, -61, -56, -50,
+    -42, -33, -23, -13, -3, 6, 15, 22, 29, 33, 37, 38,
+    39, 37, 35, 31, 27, 22, 16, 11, 5, 0, -5, -9,
+    -12, -15, -16, -17, -17, -17, -16, -14, -12, -10, -7, -5,
+    -3, -1, 1, 2, 3, 4, 4, 4, 4, 4, 3, 3,
+    2, 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0,
+    1, 2, 3, 4, 5, 6, 7, 8, 9, 9, 9, 9,
+    8, 7, 5, 2, -1, -4, -8, -12, -16, -19, -22, -25,
+    -26, -27, -27, -26, -23, -19, -15, -9, -2, 5, 12, 20,
+    28, 35, 41, 46, 49, 51, 51, 49, 45, 39, 32, 22,
+    12, 0, -12, -25, -37, -48, -58, -66, -73, -76, -78, -76,
+    -71, -64, -54, -41, -27, -11, 6, 23, 40, 56, 70, 82,
+    92, 98, 101, 101, 97, 89, 78, 63, 46, 27, 7, -14,
+    -35, -55, -73, -89, -102, -112, -118, -119, -116, -109, -98, -84,
+    -66, -45, -23, 0, 23, 46, 67, 86, 102, 115, 123, 127,
+    126, 121, 112, 98, 81, 61, 39, 16, -8, -32, -54, -74,
+    -92, -106, -117, -123, -125, -122, -115, -104, -89, -71, -51, -30,
+    -7, 15, 36, 56, 74, 89, 100, 107, 111, 111, 106, 98,
+    87, 73, 56, 38, 19, 0, -19, -36, -52, -66, -77, -84,
+    -89, -90, -88, -83, -75, -65, -53, -39, -25, -10, 5, 19,
+    31, 42, 51, 58, 62, 64, 64, 61, 56, 50, 42, 33,
+    23, 13, 3, -6, -15, -22, -29, -33, -37, -38, -39, -37,
+    -35, -31, -27, -22, -16, -11, -5, 0, 5, 9, 12, 15,
+    16, 17, 17, 17, 16, 14, 12, 10, 7, 5, 3, 1,
+    -1, -2, -3, -4, -4, -4, -4, -4, -3, -3, -2, -2,
+    -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 1, 1, 0, 0, -1, -2,
+    -3, -4, -5, -6, -7, -8, -9, -9, -9, -9, -8, -7,
+    -5, -2, 1, 4, 8, 12, 16, 19, 22, 25, 26, 27,
+    27, 26, 23, 19, 15, 9, 2, -5, -12, -20, -28, -35,
+    -41, -46, -49, -51, -51, -49, -45, -39, -32, -22, -12, 0,
+    12, 25, 37, 48, 58, 66, 73, 76, 78, 76, 71, 64,
+    54, 41, 27, 11, -6, -23, -40, -56, -70, -82, -92, -98,
+    -101, -101, -97, -89, -78, -63, -46, -27, -7, 14, 35, 55,
+    73, 89, 102, 112, 118, 119, 116, 109, 98, 84, 66, 45,
+    23, 0, -23, -46, -67, -86, -102, -115, -123, -127, -126, -121,
+    -112, -98, -81, -61, -39, -16, 8, 32, 54, 74, 92, 106,
+    117, 123, 125, 122, 115, 104, 89, 71, 51, 30, 7, -15,
+    -36, -56, -74, -89, -100, -107, -111, -111, -106, -98, -87, -73,
+    -56, -38, -19, 0, 19, 36, 52, 66, 77, 84, 89, 90,
+    88, 83, 75, 65, 53, 39, 25, 10, -5, -19, -31, -42,
+    -51, -58, -62, -64, -64, -61, -56, -50, -42, -33, -23, -13,
+    -3, 6, 15, 22, 29, 33, 37, 38, 39, 37, 35, 31,
+    27, 22, 16, 11, 5, 0, -5, -9, -12, -15, -16, -17,
+    -17, -17, -16, -14, -12, -10, -7, -5, -3, -1, 1, 2,
+    3, 4, 4, 4, 4, 4, 3, 3, 2, 2, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    -1, -1, -1, -1, -1, -1, 0, 0, 1, 2, 3, 4,
+    5, 6, 7, 8, 9, 9, 9, 9, 8, 7, 5, 2,
+    -1, -4, -8, -12, -16, -19, -22, -25, -26, -27, -27, -26,
+    -23, -19, -15, -9, -2, 5, 12, 20, 28, 35, 41, 46,
+    49, 51, 51, 49, 45, 39, 32, 22, 12, 0, -12, -25,
+    -37, -48, -58, -66, -73, -76, -78, -76, -71, -64, -54, -41,
+    -27, -11, 6, 23, 40, 56, 70, 82, 92, 98, 101, 101,
+    97, 89, 78, 63, 46, 27, 7, -14, -35, -55, -73, -89,
+    -102, -112, -112, -97, -73, -47, -25, -10, -3, 2, 6, 15,
+    28, 46, 63, 74, 76, 71, 64, 54, 41, 27, 11, -6,
+    -23, -40, -56, -70, -82, -92, -98, -101, -101, -97, -89, -78,
+    -63, -46, -27, -7, 14, 35, 55, 73, 89, 102, 112, 118,
+    119, 116, 109, 98, 84, 66, 45, 23, 0, -23, -46, -67,
+    -86, -102, -115, -123, -127, -126, -121, -112, -98, -81, -61, -39,
+    -16, 8, 32, 54, 74, 92, 106, 117, 123, 125, 122, 115,
+    104, 89, 71, 51, 30, 7, -15, -36, -56, -74, -89, -100,
+    -107, -111, -111, -106, -98, -87, -73, -56, -38, -19, 0, 19,
+    36, 52, 66, 77, 84, 89, 90, 88, 83, 75, 65, 53,
+    39, 25, 10, -5, -19, -31, -42, -51, -58, -62, -64, -64,
+    -61, -56, -50, -42, -33, -23, -13, -3, 6, 15, 22, 29,
+    33, 37, 38, 39, 37, 35, 31, 27, 22, 16, 11, 5,
+    0, -5, -9, -12, -15, -16, -17, -17, -17, -16, -14, -12,
+    -10, -7, -5, -3, -1, 1, 2, 3, 4, 4, 4, 4,
+    4, 3, 3, 2, 2, 1, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1,
+    -1, 0, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9,
+    9, 9, 9, 8, 7, 5, 2, -1, -4, -8, -12, -16,
+    -19, -22, -25, -26, -27, -27, -26, -23, -19, -15, -9, -2,
+    5, 12, 20, 28, 35, 41, 46, 49, 51, 51, 49, 45,
+    39, 32, 22, 12, 0, -12, -25, -37, -48, -58, -66, -73,
+    -76, -78, -76, -71, -64, -54, -41, -27, -11, 6, 23, 40,
+    56, 70, 82, 92, 98, 101, 101, 97, 89, 78, 63, 46,
+    27, 7, -14, -35, -55, -73, -89, -102, -112, -118, -119, -116,
+    -109, -98, -84, -66, -45, -23, 0, 23, 46, 67, 86, 102,
+    115, 123, 127, 126, 121, 112, 98, 81, 61, 39, 16, -8,
+    -32, -54, -74, -92, -106, -117, -123, -125, -122, -115, -104, -89,
+    -71, -51, -30, -7, 15, 36, 56, 74, 89, 100, 107, 111,
+    111, 106, 98, 87, 73, 56, 38, 19, 0, -19, -36, -52,
+    -66, -77, -84, -89, -90, -88, -83, -75, -65, -53, -39, -25,
+    -10, 5, 19, 31, 42, 51, 58, 62, 64, 64, 61, 56,
+    50, 42, 33, 23, 13, 3, -6, -15, -22, -29, -33, -37,
+    -38, -39, -37, -35, -31, -27, -22, -16, -11, -5, 0, 5,
+    9, 12, 15, 16, 17, 17, 17, 16, 14, 12, 10, 7,
+    5, 3, 1, -1, -2, -3, -4, -4, -4, -4, -4, -3,
+    -3, -2, -2, -1, -1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 0,
+    0, -1, -2, -3, -4, -5, -6, -7, -8, -9, -9, -9,
+    -9, -8, -7, -5, -2, 1, 4, 8, 12, 16, 19, 22,
+    25, 26, 27, 27, 26, 23, 19, 15, 9, 2, -5, -12,
+    -20, -28, -35, -41, -46, -49, -51, -51, -49, -45, -39, -32,
+    -22, -12, 0, 12, 25, 37, 48, 58, 66, 73, 76, 78,
+    76, 71, 64, 54, 41, 27, 11, -6, -23, -40, -56, -70,
+    -82, -92, -98, -101, -101, -97, -89, -78, -63, -46, -27, -7,
+    14, 35, 55, 73, 89, 102, 112, 118, 119, 116, 109, 98,
+    84, 66, 45, 23, 0, -23, -46, -67, -86, -102, -115, -123,
+    -127, -126, -121, -112, -98, -81, -61, -39, -16, 8, 32, 54,
+    74, 92, 106, 117, 123, 125, 122, 115, 104, 89, 71, 51,
+    30, 7, -15, -36, -56, -74, -89, -100, -107, -111, -111, -106,
+    -98, -87, -73, -56, -38, -19, 0, 19, 36, 52, 66, 77,
+    84, 89, 90, 88, 83, 75, 65, 53, 39, 25, 10, -5,
+    -19, -31, -42, -51, -58, -62, -64, -64, -61, -56, -50, -42,
+    -33, -23, -13, -3, 6, 15, 22, 29, 33, 37, 38, 39,
+    37, 35, 31, 27, 22, 16, 11, 5, 0, -5, -9, -12,
+    -15, -16, -17, -17, -17, -16, -14, -12, -10, -7, -5, -3,
+    -1, 1, 2, 3, 4, 4, 4, 4, 4, 3, 3, 2,
+    2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 1,
+    2, 3, 4, 5, 6, 7, 8, 9, 9, 9, 9, 8,
+    7, 5, 2, -1, -4, -8, -12, -16, -19, -22, -25, -26,
+    -27, -27, -26, -23, -19, -15, -9, -2, 5, 12, 20, 28,
+    35, 41, 46, 49, 51, 51, 49, 45, 39, 32, 22, 12,
+    0, -12, -25, -37, -48, -58, -66, -73, -76, -78, -76, -71,
+    -64, -54, -41, -27, -11, 6, 23, 40, 56, 70, 82, 92,
+    98, 101, 101, 97, 89, 78, 63, 46, 27, 7, -14, -35,
+    -55, -73, -89, -102, -112, -112, -97, -73, -47, -25, -10, -3,
+    2, 6, 15, 28, 46, 63, 74, 76, 71, 64, 54, 41,
+    27, 11, -6, -23, -40, -56, -70, -82, -92, -98, -101, -101,
+    -97, -89, -78, -63, -46, -27, -7, 14, 35, 55, 73, 89,
+    102, 112, 118, 119, 116, 109, 98, 84, 66, 45, 23, 0,
+    -23, -46, -67, -86, -102, -115, -123, -127, -126, -121, -112, -98,
+    -81, -61, -39, -16, 8, 32, 54, 74, 92, 106, 117, 123,
+    125, 122, 115, 104, 89, 71, 51, 30, 7, -15, -36, -56,
+    -74, -89, -100, -107, -111, -111, -106, -98, -87, -73, -56, -38,
+    -19, 0, 19, 36, 52, 66, 77, 84, 89, 90, 88, 83,
+    75, 65, 53, 39, 25, 10, -5, -19, -31, -42, -51, -58,
+    -62, -64, -64, -61, -56, -50, -42, -33, -23, -13, -3, 6,
+    15, 22, 29, 33, 37, 38, 39, 37, 35, 31, 27, 22,
+    16, 11, 5, 0, -5, -9, -12, -15, -16, -17, -17, -17,
+    -16, -14, -12, -10, -7, -5, -3, -1, 1, 2, 3, 4,
+    4, 4, 4, 4, 3, 3, 2, 2, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
+    -1, -1, -1, -1, 0, 0, 1, 2, 3, 4, 5, 6,
+    7, 8, 9, 9, 9, 9, 8, 7, 5, 2, -1, -4,
+    -8, -12, -16, -19, -22, -25, -26, -27, -27, -26, -23, -19,
+    -15, -9, -2, 5, 12, 20, 28, 35, 41, 46, 49, 51,
+    51, 49, 45, 39, 32, 22, 12, 0, -12, -25, -37, -48,
+    -58, -66, -73, -76, -78, -76, -71, -64, -54, -41, -27, -11,
+    6, 23, 40, 56, 70, 82, 92, 98, 101, 101, 97, 89,
+    78, 63, 46, 27, 7, -14, -35, -55, -73, -89, -102, -112,
+    -118, -119, -116, -109, -98, -84, -66, -45, -23, 0, 23, 46,
+    67, 86, 102, 115, 123, 127, 126, 121, 112, 98, 81, 61,
+    39, 16, -8, -32, -54, -74, -92, -106, -117, -123, -125, -122,
+    -115, -104, -89, -71, -51, -30, -7, 15, 36, 56, 74, 89,
+    100, 107, 111, 111, 106, 98, 87, 73, 56, 38, 19, 0,
+    -19, -36, -52, -66, -77, -84, -89, -90, -88, -83, -75, -65,
+    -53, -39, -25, -10, 5, 19, 31, 42, 51, 58, 62, 64,
+    64, 61, 56, 50, 42, 33, 23, 13, 3, -6, -15, -22,
+    -29, -33, -37, -38, -39, -37, -35, -31, -27, -22, -16, -11,
+    -5, 0, 5, 9, 12, 15, 16, 17, 17, 17, 16, 14,
+    12, 10, 7, 5, 3, 1, -1, -2, -3, -4, -4, -4,
+    -4, -4, -3, -3, -2, -2, -1, -1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    1, 1, 0, 0, -1, -2, -3, -4, -5, -6, -7, -8,
+    -9, -9, -9, -9, -8, -7, -5, -2, 1, 4, 8, 12,
+    16, 19, 22, 25, 26, 27, 27, 26, 23, 19, 15, 9,
+    2, -5, -12, -20, -28, -35, -41, -46, -49, -51, -51, -49,
+    -45, -39, -32, -22, -12, 0, 12, 25, 37, 48, 58, 66,
+    73, 76, 78, 76, 71, 64, 54, 41, 27, 11, -6, -23,
+    -40, -56, -70, -82, -92, -98, -101, -101, -97, -89, -78, -63,
+    -46, -27, -7, 14, 35, 55, 73, 89, 102, 112, 118, 119,
+    116, 109, 98, 84, 66, 45, 23, 0, -23, -46, -67, -86,
+    -102, -115, -123, -127, -126, -121, -112, -98, -81, -61, -39, -16,
+    8, 32, 54, 74, 92, 106, 117, 123, 125, 122, 115, 104,
+    89, 71, 51, 30, 7, -15, -36, -56, -74, -89, -100, -107,
+    -111, -111, -106, -98, -87, -73, -56, -38, -19, 0, 19, 36,
+    52, 66, 77, 84, 89, 90, 88, 83, 75, 65, 53, 39,
+    25, 10, -5, -19, -31, -42, -51, -58, -62, -64, -64, -61,
+    -56, -50, -42, -33, -23, -13, -3, 6, 15, 22, 29, 33,
+    37, 38, 39, 37, 35, 31, 27, 22, 16, 11, 5, 0,
+    -5, -9, -12, -15, -16, -17, -17, -17, -16, -14, -12, -10,
+    -7, -5, -3, -1, 1, 2, 3, 4, 4, 4, 4, 4,
+    3, 3, 2, 2, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1,
+    0, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 9,
+    9, 9, 8, 7, 5, 2, -1, -4, -8, -12, -16, -19,
+    -22, -25, -26, -27, -27, -26, -23, -19, -15, -9, -2, 5,
+    12, 20, 28, 35, 41, 46, 49, 51, 51, 49, 45, 39,
+    32, 22, 12, 0, -12, -25, -37, -48, -58, -66, -73, -76,
+    -78, -76, -71, -64, -54, -41, -27, -11, 6, 23, 40, 56,
+    70, 82, 92, 98, 101, 101, 97, 89, 78, 63, 46, 27,
+    7, -14, -35, -55, -73, -89, -102, -112, -112, -97, -73, -47,
+    -25, -10, -3, 2, 6, 15, 28, 46, 63, 74, 76, 71,
+    64, 54, 41, 27, 11, -6, -23, -40, -56, -70, -82, -92,
+    -98, -101, -101, -97, -89, -78, -63, -46, -27, -7, 14, 35,
+    55, 73, 89, 102, 112, 118, 119, 116, 109, 98, 84, 66,
+    45, 23, 0, -23, -46, -67, -86, -102, -115, -123, -127, -126,
+    -121, -112, -98, -81, -61, -39, -16, 8, 32, 54, 74, 92,
+    106, 117, 123, 125, 122, 115, 104, 89, 71, 51, 30, 7,
+    -15, -36, -56, -74, -89, -100, -107, -111, -111, -106, -98, -87,
+    -73, -56, -38, -19, 0, 19, 36, 52, 66, 77, 84, 89,
+    90, 88, 83, 75, 65, 53, 39, 25, 10, -5, -19, -31,
+    -42, -51, -58, -62, -64, -64, -61, -56, -50, -42, -33, -23,
+    -13, -3, 6, 15, 22, 29, 33, 37, 38, 39, 37, 35,
+    31, 27, 22, 16, 11, 5, 0, -5, -9, -12, -15, -16,
+    -17, -17, -17, -16, -14, -12, -10, -7, -5, -3, -1, 1,
+    2, 3, 4, 4, 4, 4, 4, 3, 3, 2, 2, 1,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -1, -1, -1, -1, -1, 0, 0, 1, 2, 3,
+    4, 5, 6, 7, 8, 9, 9, 9, 9, 8, 7, 5,
+    2, -1, -4, -8, -12, -16, -19, -22, -25, -26, -27, -27,
+    -26, -23, -19, -15, -9, -2, 5, 12, 20, 28, 35, 41,
+    46, 49, 51, 51, 49, 45, 39, 32, 22, 12, 0, -12,
+    -25, -37, -48, -58, -66, -73, -76, -78, -76, -71, -64, -54,
+    -41, -27, -11, 6, 23, 40, 56, 70, 82, 92, 98, 101,
+    101, 97, 89, 78, 63, 46, 27, 7, -14, -35, -55, -73,
+    -89, -102, -112, -118, -119, -116, -109, -98, -84, -66, -45, -23,
+    0, 23, 46, 67, 86, 102, 115, 123, 127, 126, 121, 112,
+    98, 81, 61, 39, 16, -8, -32, -54, -74, -92, -106, -117,
+    -123, -125, -122, -115, -104, -89, -71, -51, -30, -7, 15, 36,
+    56, 74, 89, 100, 107, 111, 111, 106, 98, 87, 73, 56,
+    38, 19, 0, -19, -36, -52, -66, -77, -84, -89, -90, -88,
+    -83, -75, -65, -53, -39, -25, -10, 5, 19, 31, 42, 51,
+    58, 62, 64, 64, 61, 56, 50, 42, 33, 23, 13, 3,
+    -6, -15, -22, -29, -33, -37, -38, -39, -37, -35, -31, -27,
+    -22, -16, -11, -5, 0, 5, 9, 12, 15, 16, 17, 17,
+    17, 16, 14, 12, 10, 7, 5, 3, 1, -1, -2, -3,
+    -4, -4, -4, -4, -4, -3, -3, -2, -2, -1, -1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    1, 1, 1, 1, 1, 0, 0, -1, -2, -3, -4, -5,
+    -6, -7, -8, -9, -9, -9, -9, -8, -7, -5, -2, 1,
+    4, 8, 12, 16, 19, 22, 25, 26, 27, 27, 26, 23,
+    19, 15, 9, 2, -5, -12, -20, -28, -35, -41, -46, -49,
+    -51, -51, -49, -45, -39, -32, -22, -12, 0, 12, 25, 37,
+    48, 58, 66, 73, 76, 78, 76, 71, 64, 54, 41, 27,
+    11, -6, -23, -40, -56, -70, -82, -92, -98, -101, -101, -97,
+    -89, -78, -63, -46, -27, -7, 14, 35, 55, 73, 89, 102,
+    112, 118, 119, 116, 109, 98, 84, 66, 45, 23, 0, -23,
+    -46, -67, -86, -102, -115, -123, -127, -126, -121, -112, -98, -81,
+    -61, -39, -16, 8, 32, 54, 74, 92, 106, 117, 123, 125,
+    122, 115, 104, 89, 71, 51, 30, 7, -15, -36, -56, -74,
+    -89, -100, -107, -111, -111, -106, -98, -87, -73, -56, -38, -19,
+    0, 19, 36, 52, 66, 77, 84, 89, 90, 88, 83, 75,
+    65, 53, 39, 25, 10, -5, -19, -31, -42, -51, -58, -62,
+    -64, -64, -61, -56, -50, -42, -33, -23, -13, -3, 6, 15,
+    22, 29, 33, 37, 38, 39, 37, 35, 31, 27, 22, 16,
+    11, 5, 0, -5, -9, -12, -15, -16, -17, -17, -17, -16,
+    -14, -12, -10, -7, -5, -3, -1, 1, 2, 3, 4, 4,
+    4, 4, 4, 3, 3, 2, 2, 1, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1,
+    -1, -1, -1, 0, 0, 1, 2, 3, 4, 5, 6, 7,
+    8, 9, 9, 9, 9, 8, 7, 5, 2, -1, -4, -8,
+    -12, -16, -19, -22, -25, -26, -27, -27, -26, -23, -19, -15,
+    -9, -2, 5, 12, 20, 28, 35, 41, 46, 49, 51, 51,
+    49, 45, 39, 32, 22, 12, 0, -12, -25, -37, -48, -58,
+    -66, -73, -76, -78, -76, -71, -64, -54, -41, -27, -11, 6,
+    23, 40, 56, 70, 82, 92, 98, 101, 101, 97, 89, 78,
+    63, 46, 27, 7, -14, -35, -55, -73, -89, -102, -112, -112,
+    -97, -73, -47, -25, -10, -3, 3, 10, 26, 49, 78, 104,
+    120, 121, 111, 98, 81, 61, 39, 16, -8, -32, -54, -75,
+    -93, -107, -118, -125, -127, -125, -118, -107, -93, -75, -54, -32,
+    -8, 16, 39, 61, 81, 98, 111, 121, 126, 127, 123, 115,
+    103, 87, 68, 47, 24, 0, -24, -47, -68, -87, -103, -115,
+    -123, -127, -126, -121, -111, -98, -81, -61, -39, -16, 8, 32,
+    54, 75, 93, 107, 118, 125, 127, 125, 118, 107, 93, 75,
+    54, 32, 8, -16, -39, -61, -81, -98, -111, -121, -126, -127,
+    -123, -115, -103, -87, -68, -47, -24, 0, 24, 47, 68, 87,
+    103, 115, 123, 127, 126, 121, 111, 98, 81, 61, 39, 16,
+    -8, -32, -54, -75, -93, -107, -118, -125, -127, -125, -118, -107,
+    -93, -75, -54, -32, -8, 16, 39, 61, 81, 98, 111, 121,
+    126, 127, 123, 115, 103, 87, 68, 47, 24, 0, -24, -47,
+    -68, -87, -103, -115, -123, -127, -126, -121, -111, -98, -81, -61,
+    -39, -16, 8, 32, 54, 75, 93, 107, 118, 125, 127, 125,
+    118, 107, 93, 75, 54, 32, 8, -16, -39, -61, -81, -98,
+    -111, -121, -126, -127, -123, -115, -103, -87, -68, -47, -24, 0,
+    24, 47, 68, 87, 103, 115, 123, 127, 126, 121, 111, 98,
+    81, 61, 39, 16, -8, -32, -54, -75, -93, -107, -118, -125,
+    -127, -125, -118, -107, -93, -75, -54, -32, -8, 16, 39, 61,
+    81, 98, 111, 121, 126, 127, 123, 115, 103, 87, 68, 47,
+    24, 0, -24, -47, -68, -87, -103, -115, -123, -127, -126, -121,
+    -111, -98, -81, -61, -39, -16, 8, 32, 54, 75, 93, 107,
+    118, 125, 127, 125, 118, 107, 93, 75, 54, 32, 8, -16,
+    -39, -61, -81, -98, -111, -121, -126, -127, -123, -115, -103, -87,
+    -68, -47, -24, 0, 24, 47, 68, 87, 103, 115, 123, 127,
+    126, 121, 111, 98, 81, 61, 39, 16, -8, -32, -54, -75,
+    -93, -107, -118, -125, -127, -125, -118, -107, -93, -75, -54, -32,
+    -8, 16, 39, 61, 81, 98, 111, 121, 126, 127, 123, 115,
+    103, 87, 68, 47, 24, 0, -24, -47, -68, -87, -103, -115,
+    -123, -127, -126, -121, -111, -98, -81, -61, -39, -16, 8, 32,
+    54, 75, 93, 107, 118, 125, 127, 125, 118, 107, 93, 75,
+    54, 32, 8, -16, -39, -61, -81, -98, -111, -121, -126, -127,
+    -123, -115, -103, -87, -68, -47, -24, 0, 24, 47, 68, 87,
+    103, 115, 123, 127, 126, 121, 111, 98, 81, 61, 39, 16,
+    -8, -32, -54, -75, -93, -107, -118, -125, -127, -125, -118, -107,
+    -93, -75, -54, -32, -8, 16, 39, 61, 81, 98, 111, 121,
+    126, 127, 123, 115, 103, 87, 68, 47, 24, 0, -24, -47,
+    -68, -87, -103, -115, -123, -127, -126, -121, -111, -98, -81, -61,
+    -39, -16, 8, 32, 54, 75, 93, 107, 118, 125, 127, 125,
+    118, 107, 93, 75, 54, 32, 8, -16, -39, -61, -81, -98,
+    -111, -121, -126, -127, -123, -115, -103, -87, -68, -47, -24, 0,
+    24, 47, 68, 87, 103, 115, 123, 127, 126, 121, 111, 98,
+    81, 61, 39, 16, -8, -32, -54, -75, -93, -107, -118, -125,
+    -127, -125, -118, -107, -93, -75, -54, -32, -8, 16, 39, 61,
+    81, 98, 111, 121, 126, 127, 123, 115, 103, 87, 68, 47,
+    24, 0, -24, -47, -68, -87, -103, -115, -123, -127, -126, -121,
+    -111, -98, -81, -61, -39, -16, 8, 32, 54, 75, 93, 107,
+    118, 125, 127, 125, 118, 107, 93, 75, 54, 32, 8, -16,
+    -39, -61, -81, -98, -111, -121, -126, -127, -123, -115, -103, -87,
+    -68, -47, -24, 0, 24, 47, 68, 87, 103, 115, 123, 127,
+    126, 121, 111, 98, 81, 61, 39, 16, -8, -32, -54, -75,
+    -93, -107, -118, -125, -127, -125, -118, -107, -93, -75, -54, -32,
+    -8, 16, 39, 61, 81, 98, 111, 121, 126, 127, 123, 115,
+    103, 87, 68, 47, 24, 0, -24, -47, -68, -87, -103, -115,
+    -123, -127, -126, -121, -111, -98, -81, -61, -39, -16, 8, 32,
+    54, 75, 93, 107, 118, 125, 127, 125, 118, 107, 93, 75,
+    54, 32, 8, -16, -39, -61, -81, -98, -111, -121, -126, -127,
+    -123, -115, -103, -87, -68, -47, -24, 0, 24, 47, 68, 87,
+    103, 115, 123, 127, 126, 121, 111, 98, 81, 61, 39, 16,
+    -8, -32, -54, -75, -93, -107, -118, -125, -127, -125, -118, -107,
+    -93, -75, -54, -32, -8, 16, 39, 61, 81, 98, 111, 121,
+    126, 127, 123, 115, 103, 87, 68, 47, 24, 0, -24, -47,
+    -68, -87, -103, -115, -123, -127, -126, -121, -111, -98, -81, -61,
+    -39, -16, 8, 32, 54, 75, 93, 107, 118, 125, 127, 125,
+    118, 107, 93, 75, 54, 32, 8, -16, -39, -61, -81, -98,
+    -111, -121, -120, -104, -78, -49, -26, -10, -3, 3, 10, 26,
+    49, 78, 104, 120, 121, 111, 98, 81, 61, 39, 16, -8,
+    -32, -54, -75, -93, -107, -118, -125, -127, -125, -118, -107, -93,
+    -75, -54, -32, -8, 16, 39, 61, 81, 98, 111, 121, 126,
+    127, 123, 115, 103, 87, 68, 47, 24, 0, -24, -47, -68,
+    -87, -103, -115, -123, -127, -126, -121, -111, -98, -81, -61, -39,
+    -16, 8, 32, 54, 75, 93, 107, 118, 125, 127, 125, 118,
+    107, 93, 75, 54, 32, 8, -16, -39, -61, -81, -98, -111,
+    -121, -126, -127, -123, -115, -103, -87, -68, -47, -24, 0, 24,
+    47, 68, 87, 103, 115, 123, 127, 126, 121, 111, 98, 81,
+    61, 39, 16, -8, -32, -54, -75, -93, -107, -118, -125, -127,
+    -125, -118, -107, -93, -75, -54, -32, -8, 16, 39, 61, 81,
+    98, 111, 121, 126, 127, 123, 115, 103, 87, 68, 47, 24,
+    0, -24, -47, -68, -87, -103, -115, -123, -127, -126, -121, -111,
+    -98, -81, -61, -39, -16, 8, 32, 54, 75, 93, 107, 118,
+    125, 127, 125, 118, 107, 93, 75, 54, 32, 8, -16, -39,
+    -61, -81, -98, -111, -121, -126, -127, -123, -115, -103, -87, -68,
+    -47, -24, 0, 24, 47, 68, 87, 103, 115, 123, 127, 126,
+    121, 111, 98, 81, 61, 39, 16, -8, -32, -54, -75, -93,
+    -107, -118, -125, -127, -125, -118, -107, -93, -75, -54, -32, -8,
+    16, 39, 61, 81, 98, 111, 121, 126, 127, 123, 115, 103,
+    87, 68, 47, 24, 0, -24, -47, -68, -87, -103, -115, -123,
+    -127, -126, -121, -111, -98, -81, -61, -39, -16, 8, 32, 54,
+    75, 93, 107, 118, 125, 127, 125, 118, 107, 93, 75, 54,
+    32, 8, -16, -39, -61, -81, -98, -111, -121, -126, -127, -123,
+    -115, -103, -87, -68, -47, -24, 0, 24, 47, 68, 87, 103,
+    115, 123, 127, 126, 121, 111, 98, 81, 61, 39, 16, -8,
+    -32, -54, -75, -93, -107, -118, -125, -127, -125, -118, -107, -93,
+    -75, -54, -32, -8, 16, 39, 61, 81, 98, 111, 121, 126,
+    127, 123, 115, 103, 87, 68, 47, 24, 0, -24, -47, -68,
+    -87, -103, -115, -123, -127, -126, -121, -111, -98, -81, -61, -39,
+    -16, 8, 32, 54, 75, 93, 107, 118, 125, 127, 125, 118,
+    107, 93, 75, 54, 32, 8, -16, -39, -61, -81, -98, -111,
+    -121, -126, -127, -123, -115, -103, -87, -68, -47, -24, 0, 24,
+    47, 68, 87, 103, 115, 123, 127, 126, 121, 111, 98, 81,
+    61, 39, 16, -8, -32, -54, -75, -93, -107, -118, -125, -127,
+    -125, -118, -107, -93, -75, -54, -32, -8, 16, 39, 61, 81,
+    98, 111, 121, 126, 127, 123, 115, 103, 87, 68, 47, 24,
+    0, -24, -47, -68, -87, -103, -115, -123, -127, -126, -121, -111,
+    -98, -81, -61, -39, -16, 8, 32, 54, 75, 93, 107, 118,
+    125, 127, 125, 118, 107, 93, 75, 54, 32, 8, -16, -39,
+    -61, -81, -98, -111, -121, -126, -127, -123, -115, -103, -87, -68,
+    -47, -24, 0, 24, 47, 68, 87, 103, 115, 123, 127, 126,
+    121, 111, 98, 81, 61, 39, 16, -8, -32, -54, -75, -93,
+    -107, -118, -125, -127, -125, -118, -107, -93, -75, -54, -32, -8,
+    16, 39, 61, 81, 98, 111, 121, 126, 127, 123, 115, 103,
+    87, 68, 47, 24, 0, -24, -47, -68, -87, -103, -115, -123,
+    -127, -126, -121, -111, -98, -81, -61, -39, -16, 8, 32, 54,
+    75, 93, 107, 118, 125, 127, 125, 118, 107, 93, 75, 54,
+    32, 8, -16, -39, -61, -81, -98, -111, -121, -126, -127, -123,
+    -115, -103, -87, -68, -47, -24, 0, 24, 47, 68, 87, 103,
+    115, 123, 127, 126, 121, 111, 98, 81, 61, 39, 16, -8,
+    -32, -54, -75, -93, -107, -118, -125, -127, -125, -118, -107, -93,
+    -75, -54, -32, -8, 16, 39, 61, 81, 98, 111, 121, 126,
+    127, 123, 115, 103, 87, 68, 47, 24, 0, -24, -47, -68,
+    -87, -103, -115, -123, -127, -126, -121, -111, -98, -81, -61, -39,
+    -16, 8, 32, 54, 75, 93, 107, 118, 125, 127, 125, 118,
+    107, 93, 75, 54, 32, 8, -16, -39, -61, -81, -98, -111,
+    -121, -126, -127, -123, -115, -103, -87, -68, -47, -24, 0, 24,
+    47, 68, 87, 103, 115, 123, 127, 126, 121, 111, 98, 81,
+    61, 39, 16, -8, -32, -54, -75, -93, -107, -118, -125, -127,
+    -125, -118, -107, -93, -75, -54, -32, -8, 16, 39, 61, 81,
+    98, 111, 121, 126, 127, 123, 115, 103, 87, 68, 47, 24,
+    0, -24, -47, -68, -87, -103, -115, -123, -127, -126, -121, -111,
+    -98, -81, -61, -39, -16, 8, 32, 54, 75, 93, 107, 118,
+    125, 127, 125, 118, 107, 93, 75, 54, 32, 8, -16, -39,
+    -61, -81, -98, -111, -121, -120, -104, -78, -49, -26, -10, -3,
+    3, 10, 26, 49, 78, 104, 120, 121, 111, 98, 81, 61,
+    39, 16, -8, -32, -54, -75, -93, -107, -118, -125, -127, -125,
+    -118, -107, -93, -75, -54, -32, -8, 16, 39, 61, 81, 98,
+    111, 121, 126, 127, 123, 115, 103, 87, 68, 47, 24, 0,
+    -24, -47, -68, -87, -103, -115, -123, -127, -126, -121, -111, -98,
+    -81, -61, -39, -16, 8, 32, 54, 75, 93, 107, 118, 125,
+    127, 125, 118, 107, 93, 75, 54, 32, 8, -16, -39, -61,
+    -81, -98, -111, -121, -126, -127, -123, -115, -103, -87, -68, -47,
+    -24, 0, 24, 47, 68, 87, 103, 115, 123, 127, 126, 121,
+    111, 98, 81, 61, 39, 16, -8, -32, -54, -75, -93, -107,
+    -118, -125, -127, -125, -118, -107, -93, -75, -54, -32, -8, 16,
+    39, 61, 81, 98, 111, 121, 126, 127, 123, 115, 103, 87,
+    68, 47, 24, 0, -24, -47, -68, -87, -103, -115, -123, -127,
+    -126, -121, -111, -98, -81, -61, -39, -16, 8, 32, 54, 75,
+    93, 107, 118, 125, 127, 125, 118, 107, 93, 75, 54, 32,
+    8, -16, -39, -61, -81, -98, -111, -121, -126, -127, -123, -115,
+    -103, -87, -68, -47, -24, 0, 24, 47, 68, 87, 103, 115,
+    123, 127, 126, 121, 111, 98, 81, 61, 39, 16, -8, -32,
+    -54, -75, -93, -107, -118, -125, -127, -125, -118, -107, -93, -75,
+    -54, -32, -8, 16, 39, 61, 81, 98, 111, 121, 126, 127,
+    123, 115, 103, 87, 68, 47, 24, 0, -24, -47, -68, -87,
+    -103, -115, -123, -127, -126, -121, -111, -98, -81, -61, -39, -16,
+    8, 32, 54, 75, 93, 107, 118, 125, 127, 125, 118, 107,
+    93, 75, 54, 32, 8, -16, -39, -61, -81, -98, -111, -121,
+    -126, -127, -123, -115, -103, -87, -68, -47, -24, 0, 24, 47,
+    68, 87, 103, 115, 123, 127, 126, 121, 111, 98, 81, 61,
+    39, 16, -8, -32, -54, -75, -93, -107, -118, -125, -127, -125,
+    -118, -107, -93, -75, -54, -32, -8, 16, 39, 61, 81, 98,
+    111, 121, 126, 127, 123, 115, 103, 87, 68, 47, 24, 0,
+    -24, -47, -68, -87, -103, -115, -123, -127, -126, -121, -111, -98,
+    -81, -61, -39, -16, 8, 32, 54, 75, 93, 107, 118, 125,
+    127, 125, 118, 107, 93, 75, 54, 32, 8, -16, -39, -61,
+    -81, -98, -111, -121, -126, -127, -123, -115, -103, -87, -68, -47,
+    -24, 0, 24, 47, 68, 87, 103, 115, 123, 127, 126, 121,
+    111, 98, 81, 61, 39, 16, -8, -32, -54, -75, -93, -107,
+    -118, -125, -127, -125, -118, -107, -93, -75, -54, -32, -8, 16,
+    39, 61, 81, 98, 111, 121, 126, 127, 123, 115, 103, 87,
+    68, 47, 24, 0, -24, -47, -68, -87, -103, -115, -123, -127,
+    -126, -121, -111, -98, -81, -61, -39, -16, 8, 32, 54, 75,
+    93, 107, 118, 125, 127, 125, 118, 107, 93, 75, 54, 32,
+    8, -16, -39, -61, -81, -98, -111, -121, -126, -127, -123, -115,
+    -103, -87, -68, -47, -24, 0, 24, 47, 68, 87, 103, 115,
+    123, 127, 126, 121, 111, 98, 81, 61, 39, 16, -8, -32,
+    -54, -75, -93, -107, -118, -125, -127, -125, -118, -107, -93, -75,
+    -54, -32, -8, 16, 39, 61, 81, 98, 111, 121, 126, 127,
+    123, 115, 103, 87, 68, 47, 24, 0, -24, -47, -68, -87,
+    -103, -115, -123, -127, -126, -121, -111, -98, -81, -61, -39, -16,
+    8, 32, 54, 75, 93, 107, 118, 125, 127, 125, 118, 107,
+    93, 75, 54, 32, 8, -16, -39, -61, -81, -98, -111, -121,
+    -126, -127, -123, -115, -103, -87, -68, -47, -24, 0, 24, 47,
+    68, 87, 103, 115, 123, 127, 126, 121, 111, 98, 81, 61,
+    39, 16, -8, -32, -54, -75, -93, -107, -118, -125, -127, -125,
+    -118, -107, -93, -75, -54, -32, -8, 16, 39, 61, 81, 98,
+    111, 121, 126, 127, 123, 115, 103, 87, 68, 47, 24, 0,
+    -24, -47, -68, -87, -103, -115, -123, -127, -126, -121, -111, -98,
+    -81, -61, -39, -16, 8, 32, 54, 75, 93, 107, 118, 125,
+    127, 125, 118, 107, 93, 75, 54, 32, 8, -16, -39, -61,
+    -81, -98, -111, -121, -126, -127, -123, -115, -103, -87, -68, -47,
+    -24, 0, 24, 47, 68, 87, 103, 115, 123, 127, 126, 121,
+    111, 98, 81, 61, 39, 16, -8, -32, -54, -75, -93, -107,
+    -118, -125, -127, -125, -118, -107, -93, -75, -54, -32, -8, 16,
+    39, 61, 81, 98, 111, 121, 126, 127, 123, 115, 103, 87,
+    68, 47, 24, 0, -24, -47, -68, -87, -103, -115, -123, -127,
+    -126, -121, -111, -98, -81, -61, -39, -16, 8, 32, 54, 75,
+    93, 107, 118, 125, 127, 125, 118, 107, 93, 75, 54, 32,
+    8, -16, -39, -61, -81, -98, -111, -121, -120, -104, -78, -49,
+    -26, -10, -3, 3, 10, 26, 49, 78, 104, 120, 121, 111,
+    98, 81, 61, 39, 16, -8, -32, -54, -75, -93, -107, -118,
+    -125, -127, -125, -118, -107, -93, -75, -54, -32, -8, 16, 39,
+    61, 81, 98, 111, 121, 126, 127, 123, 115, 103, 87, 68,
+    47, 24, 0, -24, -47, -68, -87, -103, -115, -123, -127, -126,
+    -121, -111, -98, -81, -61, -39, -16, 8, 32, 54, 75, 93,
+    107, 118, 125, 127, 125, 118, 107, 93, 75, 54, 32, 8,
+    -16, -39, -61, -81, -98, -111, -121, -126, -127, -123, -115, -103,
+    -87, -68, -47, -24, 0, 24, 47, 68, 87, 103, 115, 123,
+    127, 126, 121, 111, 98, 81, 61, 39, 16, -8, -32, -54,
+    -75, -93, -107, -118, -125, -127, -125, -118, -107, -93, -75, -54,
+    -32, -8, 16, 39, 61, 81, 98, 111, 121, 126, 127, 123,
+    115, 103, 87, 68, 47, 24, 0, -24, -47, -68, -87, -103,
+    -115, -123, -127, -126, -121, -111, -98, -81, -61, -39, -16, 8,
+    32, 54, 75, 93, 107, 118, 125, 127, 125, 118, 107, 93,
+    75, 54, 32, 8, -16, -39, -61, -81, -98, -111, -121, -126,
+    -127, -123, -115, -103, -87, -68, -47, -24, 0, 24, 47, 68,
+    87, 103, 115, 123, 127, 126, 121, 111, 98, 81, 61, 39,
+    16, -8, -32, -54, -75, -93, -107, -118, -125, -127, -125, -118,
+    -107, -93, -75, -54, -32, -8, 16, 39, 61, 81, 98, 111,
+    121, 126, 127, 123, 115, 103, 87, 68, 47, 24, 0, -24,
+    -47, -68, -87, -103, -115, -123, -127, -126, -121, -111, -98, -81,
+    -61, -39, -16, 8, 32, 54, 75, 93, 107, 118, 125, 127,
+    125, 118, 107, 93, 75, 54, 32, 8, -16, -39, -61, -81,
+    -98, -111, -121, -126, -127, -123, -115, -103, -87, -68, -47, -24,
+    0, 24, 47, 68, 87, 103, 115, 123, 127, 126, 121, 111,
+    98, 81, 61, 39, 16, -8, -32, -54, -75, -93, -107, -118,
+    -125, -127, -125, -118, -107, -93, -75, -54, -32, -8, 16, 39,
+    61, 81, 98, 111, 121, 126, 127, 123, 115, 103, 87, 68,
+    47, 24, 0, -24, -47, -68, -87, -103, -115, -123, -127, -126,
+    -121, -111, -98, -81, -61, -39, -16, 8, 32, 54, 75, 93,
+    107, 118, 125, 127, 125, 118, 107, 93, 75, 54, 32, 8,
+    -16, -39, -61, -81, -98, -111, -121, -126, -127, -123, -115, -103,
+    -87, -68, -47, -24, 0, 24, 47, 68, 87, 103, 115, 123,
+    127, 126, 121, 111, 98, 81, 61, 39, 16, -8, -32, -54,
+    -75, -93, -107, -118, -125, -127, -125, -118, -107, -93, -75, -54,
+    -32, -8, 16, 39, 61, 81, 98, 111, 121, 126, 127, 123,
+    115, 103, 87, 68, 47, 24, 0, -24, -47, -68, -87, -103,
+    -115, -123, -127, -126, -121, -111, -98, -81, -61, -39, -16, 8,
+    32, 54, 75, 93, 107, 118, 125, 127, 125, 118, 107, 93,
+    75, 54, 32, 8, -16, -39, -61, -81, -98, -111, -121, -126,
+    -127, -123, -115, -103, -87, -68, -47, -24, 0, 24, 47, 68,
+    87, 103, 115, 123, 127, 126, 121, 111, 98, 81, 61, 39,
+    16, -8, -32, -54, -75, -93, -107, -118, -125, -127, -125, -118,
+    -107, -93, -75, -54, -32, -8, 16, 39, 61, 81, 98, 111,
+    121, 126, 127, 123, 115, 103, 87, 68, 47, 24, 0, -24,
+    -47, -68, -87, -103, -115, -123, -127, -126, -121, -111, -98, -81,
+    -61, -39, -16, 8, 32, 54, 75, 93, 107, 118, 125, 127,
+    125, 118, 107, 93, 75, 54, 32, 8, -16, -39, -61, -81,
+    -98, -111, -121, -126, -127, -123, -115, -103, -87, -68, -47, -24,
+    0, 24, 47, 68, 87, 103, 115, 123, 127, 126, 121, 111,
+    98, 81, 61, 39, 16, -8, -32, -54, -75, -93, -107, -118,
+    -125, -127, -125, -118, -107, -93, -75, -54, -32, -8, 16, 39,
+    61, 81, 98, 111, 121, 126, 127, 123, 115, 103, 87, 68,
+    47, 24, 0, -24, -47, -68, -87, -103, -115, -123, -127, -126,
+    -121, -111, -98, -81, -61, -39, -16, 8, 32, 54, 75, 93,
+    107, 118, 125, 127, 125, 118, 107, 93, 75, 54, 32, 8,
+    -16, -39, -61, -81, -98, -111, -121, -126, -127, -123, -115, -103,
+    -87, -68, -47, -24, 0, 24, 47, 68, 87, 103, 115, 123,
+    127, 126, 121, 111, 98, 81, 61, 39, 16, -8, -32, -54,
+    -75, -93, -107, -118, -125, -127, -125, -118, -107, -93, -75, -54,
+    -32, -8, 16, 39, 61, 81, 98, 111, 121, 126, 127, 123,
+    115, 103, 87, 68, 47, 24, 0, -24, -47, -68, -87, -103,
+    -115, -123, -127, -126, -121, -111, -98, -81, -61, -39, -16, 8,
+    32, 54, 75, 93, 107, 118, 125, 127, 125, 118, 107, 93,
+    75, 54, 32, 8, -16, -39, -61, -81, -98, -111, -121, -120,
+    -104, -78, -49, -26, -10, -3, 3, 10, 26, 49, 78, 104,
+    120, 121, 111, 98, 81, 61, 39, 16, -8, -32, -54, -75,
+    -93, -107, -118, -125, -127, -125, -118, -107, -93, -75, -54, -32,
+    -8, 16, 39, 61, 81, 98, 111, 121, 126, 127, 123, 115,
+    103, 87, 68, 47, 24, 0, -24, -47, -68, -87, -103, -115,
+    -123, -127, -126, -121, -111, -98, -81, -61, -39, -16, 8, 32,
+    54, 75, 93, 107, 118, 125, 127, 125, 118, 107, 93, 75,
+    54, 32, 8, -16, -39, -61, -81, -98, -111, -121, -126, -127,
+    -123, -115, -103, -87, -68, -47, -24, 0, 24, 47, 68, 87,
+    103, 115, 123, 127, 126, 121, 111, 98, 81, 61, 39, 16,
+    -8, -32, -54, -75, -93, -107, -118, -125, -127, -125, -118, -107,
+    -93, -75, -54, -32, -8, 16, 39, 61, 81, 98, 111, 121,
+    126, 127, 123, 115, 103, 87, 68, 47, 24, 0, -24, -47,
+    -68, -87, -103, -115, -123, -127, -126, -121, -111, -98, -81, -61,
+    -39, -16, 8, 32, 54, 75, 93, 107, 118, 125, 127, 125,
+    118, 107, 93, 75, 54, 32, 8, -16, -39, -61, -81, -98,
+    -111, -121, -126, -127, -123, -115, -103, -87, -68, -47, -24, 0,
+    24, 47, 68, 87, 103, 115, 123, 127, 126, 121, 111, 98,
+    81, 61, 39, 16, -8, -32, -54, -75, -93, -107, -118, -125,
+    -127, -125, -118, -107, -93, -75, -54, -32, -8, 16, 39, 61,
+    81, 98, 111, 121, 126, 127, 123, 115, 103, 87, 68, 47,
+    24, 0, -24, -47, -68, -87, -103, -115, -123, -127, -126, -121,
+    -111, -98, -81, -61, -39, -16, 8, 32, 54, 75, 93, 107,
+    118, 125, 127, 125, 118, 107, 93, 75, 54, 32, 8, -16,
+    -39, -61, -81, -98, -111, -121, -126, -127, -123, -115, -103, -87,
+    -68, -47, -24, 0, 24, 47, 68, 87, 103, 115, 123, 127,
+    126, 121, 111, 98, 81, 61, 39, 16, -8, -32, -54, -75,
+    -93, -107, -118, -125, -127, -125, -118, -107, -93, -75, -54, -32,
+    -8, 16, 39, 61, 81, 98, 111, 121, 126, 127, 123, 115,
+    103, 87, 68, 47, 24, 0, -24, -47, -68, -87, -103, -115,
+    -123, -127, -126, -121, -111, -98, -81, -61, -39, -16, 8, 32,
+    54, 75, 93, 107, 118, 125, 127, 125, 118, 107, 93, 75,
+    54, 32, 8, -16, -39, -61, -81, -98, -111, -121, -126, -127,
+    -123, -115, -103, -87, -68, -47, -24, 0, 24, 47, 68, 87,
+    103, 115, 123, 127, 126, 121, 111, 98, 81, 61, 39, 16,
+    -8, -32, -54, -75, -93, -107, -118, -125, -127, -125, -118, -107,
+    -93, -75, -54, -32, -8, 16, 39, 61, 81, 98, 111, 121,
+    126, 127, 123, 115, 103, 87, 68, 47, 24, 0, -24, -47,
+    -68, -87, -103, -115, -123, -127, -126, -121, -111, -98, -81, -61,
+    -39, -16, 8, 32, 54, 75, 93, 107, 118, 125, 127, 125,
+    118, 107, 93, 75, 54, 32, 8, -16, -39, -61, -81, -98,
+    -111, -121, -126, -127, -123, -115, -103, -87, -68, -47, -24, 0,
+    24, 47, 68, 87, 103, 115, 123, 127, 126, 121, 111, 98,
+    81, 61, 39, 16, -8, -32, -54, -75, -93, -107, -118, -125,
+    -127, -125, -118, -107, -93, -75, -54, -32, -8, 16, 39, 61,
+    81, 98, 111, 121, 126, 127, 123, 115, 103, 87, 68, 47,
+    24, 0, -24, -47, -68, -87, -103, -115, -123, -127, -126, -121,
+    -111, -98, -81, -61, -39, -16, 8, 32, 54, 75, 93, 107,
+    118, 125, 127, 125, 118, 107, 93, 75, 54, 32, 8, -16,
+    -39, -61, -81, -98, -111, -121, -126, -127, -123, -115, -103, -87,
+    -68, -47, -24, 0, 24, 47, 68, 87, 103, 115, 123, 127,
+    126, 121, 111, 98, 81, 61, 39, 16, -8, -32, -54, -75,
+    -93, -107, -118, -125, -127, -125, -118, -107, -93, -75, -54, -32,
+    -8, 16, 39, 61, 81, 98, 111, 121, 126, 127, 123, 115,
+    103, 87, 68, 47, 24, 0, -24, -47, -68, -87, -103, -115,
+    -123, -127, -126, -121, -111, -98, -81, -61, -39, -16, 8, 32,
+    54, 75, 93, 107, 118, 125, 127, 125, 118, 107, 93, 75,
+    54, 32, 8, -16, -39, -61, -81, -98, -111, -121, -126, -127,
+    -123, -115, -103, -87, -68, -47, -24, 0, 24, 47, 68, 87,
+    103, 115, 123, 127, 126, 121, 111, 98, 81, 61, 39, 16,
+    -8, -32, -54, -75, -93, -107, -118, -125, -127, -125, -118, -107,
+    -93, -75, -54, -32, -8, 16, 39, 61, 81, 98, 111, 121,
+    126, 127, 123, 115, 103, 87, 68, 47, 24, 0, -24, -47,
+    -68, -87, -103, -115, -123, -127, -126, -121, -111, -98, -81, -61,
+    -39, -16, 8, 32, 54, 75, 93, 107, 118, 125, 127, 125,
+    118, 107, 93, 75, 54, 32, 8, -16, -39, -61, -81, -98,
+    -111, -121, -120, -104, -78, -49, -26, -10, -3, 3, 10, 26,
+    49, 78, 104, 120, 121, 111, 98, 81, 61, 39, 16, -8,
+    -32, -54, -75, -93, -107, -118, -125, -127, -125, -118, -107, -93,
+    -75, -54, -32, -8, 16, 39, 61, 81, 98, 111, 121, 126,
+    127, 123, 115, 103, 87, 68, 47, 24, 0, -24, -47, -68,
+    -87, -103, -115, -123, -127, -126, -121, -111, -98, -81, -61, -39,
+    -16, 8, 32, 54, 75, 93, 107, 118, 125, 127, 125, 118,
+    107, 93, 75, 54, 32, 8, -16, -39, -61, -81, -98, -111,
+    -121, -126, -127, -123, -115, -103, -87, -68, -47, -24, 0, 24,
+    47, 68, 87, 103, 115, 123, 127, 126, 121, 111, 98, 81,
+    61, 39, 16, -8, -32, -54, -75, -93, -107, -118, -125, -127,
+    -125, -118, -107, -93, -75, -54, -32, -8, 16, 39, 61, 81,
+    98, 111, 121, 126, 127, 123, 115, 103, 87, 68, 47, 24,
+    0, -24, -47, -68, -87, -103, -115, -123, -127, -126, -121, -111,
+    -98, -81, -61, -39, -16, 8, 32, 54, 75, 93, 107, 118,
+    125, 127, 125, 118, 107, 93, 75, 54, 32, 8, -16, -39,
+    -61, -81, -98, -111, -121, -126, -127, -123, -115, -103, -87, -68,
+    -47, -24, 0, 24, 47, 68, 87, 103, 115, 123, 127, 126,
+    121, 111, 98, 81, 61, 39, 16, -8, -32, -54, -75, -93,
+    -107, -118, -125, -127, -125, -118, -107, -93, -75, -54, -32, -8,
+    16, 39, 61, 81, 98, 111, 121, 126, 127, 123, 115, 103,
+    87, 68, 47, 24, 0, -24, -47, -68, -87, -103, -115, -123,
+    -127, -126, -121, -111, -98, -81, -61, -39, -16, 8, 32, 54,
+    75, 93, 107, 118, 125, 127, 125, 118, 107, 93, 75, 54,
+    32, 8, -16, -39, -61, -81, -98, -111, -121, -126, -127, -123,
+    -115, -103, -87, -68, -47, -24, 0, 24, 47, 68, 87, 103,
+    115, 123, 127, 126, 121, 111, 98, 81, 61, 39, 16, -8,
+    -32, -54, -75, -93, -107, -118, -125, -127, -125, -118, -107, -93,
+    -75, -54, -32, -8, 16, 39, 61, 81, 98, 111, 121, 126,
+    127, 123, 115, 103, 87, 68, 47, 24, 0, -24, -47, -68,
+    -87, -103, -115, -123, -127, -126, -121, -111, -98, -81, -61, -39,
+    -16, 8, 32, 54, 75, 93, 107, 118, 125, 127, 125, 118,
+    107, 93, 75, 54, 32, 8, -16, -39, -61, -81, -98, -111,
+    -121, -126, -127, -123, -115, -103, -87, -68, -47, -24, 0, 24,
+    47, 68, 87, 103, 115, 123, 127, 126, 121, 111, 98, 81,
+    61, 39, 16, -8, -32, -54, -75, -93, -107, -118, -125, -127,
+    -125, -118, -107, -93, -75, -54, -32, -8, 16, 39, 61, 81,
+    98, 111, 121, 126, 127, 123, 115, 103, 87, 68, 47, 24,
+    0, -24, -47, -68, -87, -103, -115, -123, -127, -126, -121, -111,
+    -98, -81, -61, -39, -16, 8, 32, 54, 75, 93, 107, 118,
+    125, 127, 125, 118, 107, 93, 75, 54, 32, 8, -16, -39,
+    -61, -81, -98, -111, -121, -126, -127, -123, -115, -103, -87, -68,
+    -47, -24, 0, 24, 47, 68, 87, 103, 115, 123, 127, 126,
+    121, 111, 98, 81, 61, 39, 16, -8, -32, -54, -75, -93,
+    -107, -118, -125, -127, -125, -118, -107, -93, -75, -54, -32, -8,
+    16, 39, 61, 81, 98, 111, 121, 126, 127, 123, 115, 103,
+    87, 68, 47, 24, 0, -24, -47, -68, -87, -103, -115, -123,
+    -127, -126, -121, -111, -98, -81, -61, -39, -16, 8, 32, 54,
+    75, 93, 107, 118, 125, 127, 125, 118, 107, 93, 75, 54,
+    32, 8, -16, -39, -61, -81, -98, -111, -121, -126, -127, -123,
+    -115, -103, -87, -68, -47, -24, 0, 24, 47, 68, 87, 103,
+    115, 123, 127, 126, 121, 111, 98, 81, 61, 39, 16, -8,
+    -32, -54, -75, -93, -107, -118, -125, -127, -125, -118, -107, -93,
+    -75, -54, -32, -8, 16, 39, 61, 81, 98, 111, 121, 126,
+    127, 123, 115, 103, 87, 68, 47, 24, 0, -24, -47, -68,
+    -87, -103, -115, -123, -127, -126, -121, -111, -98, -81, -61, -39,
+    -16, 8, 32, 54, 75, 93, 107, 118, 125, 127, 125, 118,
+    107, 93, 75, 54, 32, 8, -16, -39, -61, -81, -98, -111,
+    -121, -126, -127, -123, -115, -103, -87, -68, -47, -24, 0, 24,
+    47, 68, 87, 103, 115, 123, 127, 126, 121, 111, 98, 81,
+    61, 39, 16, -8, -32, -54, -75, -93, -107, -118, -125, -127,
+    -125, -118, -107, -93, -75, -54, -32, -8, 16, 39, 61, 81,
+    98, 111, 121, 126, 127, 123, 115, 103, 87, 68, 47, 24,
+    0, -24, -47, -68, -87, -103, -115, -123, -127, -126, -121, -111,
+    -98, -81, -61, -39, -16, 8, 32, 54, 75, 93, 107, 118,
+    125, 127, 125, 118, 107, 93, 75, 54, 32, 8, -16, -39,
+    -61, -81, -98, -111, -121, -120, -104, -78, -49, -26, -10, -3,
+    3, 10, 26, 49, 78, 104, 120, 121, 111, 98, 81, 61,
+    39, 16, -8, -32, -54, -75, -93, -107, -118, -125, -127, -125,
+    -118, -107, -93, -75, -54, -32, -8, 16, 39, 61, 81, 98,
+    111, 121, 126, 127, 123, 115, 103, 87, 68, 47, 24, 0,
+    -24, -47, -68, -87, -103, -115, -123, -127, -126, -121, -111, -98,
+    -81, -61, -39, -16, 8, 32, 54, 75, 93, 107, 118, 125,
+    127, 125, 118, 107, 93, 75, 54, 32, 8, -16, -39, -61,
+    -81, -98, -111, -121, -126, -127, -123, -115, -103, -87, -68, -47,
+    -24, 0, 24, 47, 68, 87, 103, 115, 123, 127, 126, 121,
+    111, 98, 81, 61, 39, 16, -8, -32, -54, -75, -93, -107,
+    -118, -125, -127, -125, -118, -107, -93, -75, -54, -32, -8, 16,
+    39, 61, 81, 98, 111, 121, 126, 127, 123, 115, 103, 87,
+    68, 47, 24, 0, -24, -47, -68, -87, -103, -115, -123, -127,
+    -126, -121, -111, -98, -81, -61, -39, -16, 8, 32, 54, 75,
+    93, 107, 118, 125, 127, 125, 118, 107, 93, 75, 54, 32,
+    8, -16, -39, -61, -81, -98, -111, -121, -126, -127, -123, -115,
+    -103, -87, -68, -47, -24, 0, 24, 47, 68, 87, 103, 115,
+    123, 127, 126, 121, 111, 98, 81, 61, 39, 16, -8, -32,
+    -54, -75, -93, -107, -118, -125, -127, -125, -118, -107, -93, -75,
+    -54, -32, -8, 16, 39, 61, 81, 98, 111, 121, 126, 127,
+    123, 115, 103, 87, 68, 47, 24, 0, -24, -47, -68, -87,
+    -103, -115, -123, -127, -126, -121, -111, -98, -81, -61, -39, -16,
+    8, 32, 54, 75, 93, 107, 118, 125, 127, 125, 118, 107,
+    93, 75, 54, 32, 8, -16, -39, -61, -81, -98, -111, -121,
+    -126, -127, -123, -115, -103, -87, -68, -47, -24, 0, 24, 47,
+    68, 87, 103, 115, 123, 127, 126, 121, 111, 98, 81, 61,
+    39, 16, -8, -32, -54, -75, -93, -107, -118, -125, -127, -125,
+    -118, -107, -93, -75, -54, -32, -8, 16, 39, 61, 81, 98,
+    111, 121, 126, 127, 123, 115, 103, 87, 68, 47, 24, 0,
+    -24, -47, -68, -87, -103, -115, -123, -127, -126, -121, -111, -98,
+    -81, -61, -39, -16, 8, 32, 54, 75, 93, 107, 118, 125,
+    127, 125, 118, 107, 93, 75, 54, 32, 8, -16, -39, -61,
+    -81, -98, -111, -121, -126, -127, -123, -115, -103, -87, -68, -47,
+    -24, 0, 24, 47, 68, 87, 103, 115, 123, 127, 126, 121,
+    111, 98, 81, 61, 39, 16, -8, -32, -54, -75, -93, -107,
+    -118, -125, -127, -125, -118, -107, -93, -75, -54, -32, -8, 16,
+    39, 61, 81, 98, 111, 121, 126, 127, 123, 115, 103, 87,
+    68, 47, 24, 0, -24, -47, -68, -87, -103, -115, -123, -127,
+    -126, -121, -111, -98, -81, -61, -39, -16, 8, 32, 54, 75,
+    93, 107, 118, 125, 127, 125, 118, 107, 93, 75, 54, 32,
+    8, -16, -39, -61, -81, -98, -111, -121, -126, -127, -123, -115,
+    -103, -87, -68, -47, -24, 0, 24, 47, 68, 87, 103, 115,
+    123, 127, 126, 121, 111, 98, 81, 61, 39, 16, -8, -32,
+    -54, -75, -93, -107, -118, -125, -127, -125, -118, -107, -93, -75,
+    -54, -32, -8, 16, 39, 61, 81, 98, 111, 121, 126, 127,
+    123, 115, 103, 87, 68, 47, 24, 0, -24, -47, -68, -87,
+    -103, -115, -123, -127, -126, -121, -111, -98, -81, -61, -39, -16,
+    8, 32, 54, 75, 93, 107, 118, 125, 127, 125, 118, 107,
+    93, 75, 54, 32, 8, -16, -39, -61, -81, -98, -111, -121,
+    -126, -127, -123, -115, -103, -87, -68, -47, -24, 0, 24, 47,
+    68, 87, 103, 115, 123, 127, 126, 121, 111, 98, 81, 61,
+    39, 16, -8, -32, -54, -75, -93, -107, -118, -125, -127, -125,
+    -118, -107, -93, -75, -54, -32, -8, 16, 39, 61, 81, 98,
+    111, 121, 126, 127, 123, 115, 103, 87, 68, 47, 24, 0,
+    -24, -47, -68, -87, -103, -115, -123, -127, -126, -121, -111, -98,
+    -81, -61, -39, -16, 8, 32, 54, 75, 93, 107, 118, 125,
+    127, 125, 118, 107, 93, 75, 54, 32, 8, -16, -39, -61,
+    -81, -98, -111, -121, -126, -127, -123, -115, -103, -87, -68, -47,
+    -24, 0, 24, 47, 68, 87, 103, 115, 123, 127, 126, 121,
+    111, 98, 81, 61, 39, 16, -8, -32, -54, -75, -93, -107,
+    -118, -125, -127, -125, -118, -107, -93, -75, -54, -32, -8, 16,
+    39, 61, 81, 98, 111, 121, 126, 127, 123, 115, 103, 87,
+    68, 47, 24, 0, -24, -47, -68, -87, -103, -115, -123, -127,
+    -126, -121, -111, -98, -81, -61, -39, -16, 8, 32, 54, 75,
+    93, 107, 118, 125, 127, 125, 118, 107, 93, 75, 54, 32,
+    8, -16, -39, -61, -81, -98, -111, -121, -120, -104, -78, -49,
+    -26, -10, -3, 3, 10, 26, 49, 78, 104, 120, 121, 111,
+    98, 81, 61, 39, 16, -8, -32, -54, -75, -93, -107, -118,
+    -125, -127, -125, -118, -107, -93, -75, -54, -32, -8, 16, 39,
+    61, 81, 98, 111, 121, 126, 127, 123, 115, 103, 87, 68,
+    47, 24, 0, -24, -47, -68, -87, -103, -115, -123, -127, -126,
+    -121, -111, -98, -81, -61, -39, -16, 8, 32, 54, 75, 93,
+    107, 118, 125, 127, 125, 118, 107, 93, 75, 54, 32, 8,
+    -16, -39, -61, -81, -98, -111, -121, -126, -127, -123, -115, -103,
+    -87, -68, -47, -24, 0, 24, 47, 68, 87, 103, 115, 123,
+    127, 126, 121, 111, 98, 81, 61, 39, 16, -8, -32, -54,
+    -75, -93, -107, -118, -125, -127, -125, -118, -107, -93, -75, -54,
+    -32, -8, 16, 39, 61, 81, 98, 111, 121, 126, 127, 123,
+    115, 103, 87, 68, 47, 24, 0, -24, -47, -68, -87, -103,
+    -115, -123, -127, -126, -121, -111, -98, -81, -61, -39, -16, 8,
+    32, 54, 75, 93, 107, 118, 125, 127, 125, 118, 107, 93,
+    75, 54, 32, 8, -16, -39, -61, -81, -98, -111, -121, -126,
+    -127, -123, -115, -103, -87, -68, -47, -24, 0, 24, 47, 68,
+    87, 103, 115, 123, 127, 126, 121, 111, 98, 81, 61, 39,
+    16, -8, -32, -54, -75, -93, -107, -118, -125, -127, -125, -118,
+    -107, -93, -75, -54, -32, -8, 16, 39, 61, 81, 98, 111,
+    121, 126, 127, 123, 115, 103, 87, 68, 47, 24, 0, -24,
+    -47, -68, -87, -103, -115, -123, -127, -126, -121, -111, -98, -81,
+    -61, -39, -16, 8, 32, 54, 75, 93, 107, 118, 125, 127,
+    125, 118, 107, 93, 75, 54, 32, 8, -16, -39, -61, -81,
+    -98, -111, -121, -126, -127, -123, -115, -103, -87, -68, -47, -24,
+    0, 24, 47, 68, 87, 103, 115, 123, 127, 126, 121, 111,
+    98, 81, 61, 39, 16, -8, -32, -54, -75, -93, -107, -118,
+    -125, -127, -125, -118, -107, -93, -75, -54, -32, -8, 16, 39,
+    61, 81, 98, 111, 121, 126, 127, 123, 115, 103, 87, 68,
+    47, 24, 0, -24, -47, -68, -87, -103, -115, -123, -127, -126,
+    -121, -111, -98, -81, -61, -39, -16, 8, 32, 54, 75, 93,
+    107, 118, 125, 127, 125, 118, 107, 93, 75, 54, 32, 8,
+    -16, -39, -61, -81, -98, -111, -121, -126, -127, -123, -115, -103,
+    -87, -68, -47, -24, 0, 24, 47, 68, 87, 103, 115, 123,
+    127, 126, 121, 111, 98, 81, 61, 39, 16, -8, -32, -54,
+    -75, -93, -107, -118, -125, -127, -125, -118, -107, -93, -75, -54,
+    -32, -8, 16, 39, 61, 81, 98, 111, 121, 126, 127, 123,
+    115, 103, 87, 68, 47, 24, 0, -24, -47, -68, -87, -103,
+    -115, -123, -127, -126, -121, -111, -98, -81, -61, -39, -16, 8,
+    32, 54, 75, 93, 107, 118, 125, 127, 125, 118, 107, 93,
+    75, 54, 32, 8, -16, -39, -61, -81, -98, -111, -121, -126,
+    -127, -123, -115, -103, -87, -68, -47, -24, 0, 24, 47, 68,
+    87, 103, 115, 123, 127, 126, 121, 111, 98, 81, 61, 39,
+    16, -8, -32, -54, -75, -93, -107, -118, -125, -127, -125, -118,
+    -107, -93, -75, -54, -32, -8, 16, 39, 61, 81, 98, 111,
+    121, 126, 127, 123, 115, 103, 87, 68, 47, 24, 0, -24,
+    -47, -68, -87, -103, -115, -123, -127, -126, -121, -111, -98, -81,
+    -61, -39, -16, 8, 32, 54, 75, 93, 107, 118, 125, 127,
+    125, 118, 107, 93, 75, 54, 32, 8, -16, -39, -61, -81,
+    -98, -111, -121, -126, -127, -123, -115, -103, -87, -68, -47, -24,
+    0, 24, 47, 68, 87, 103, 115, 123, 127, 126, 121, 111,
+    98, 81, 61, 39, 16, -8, -32, -54, -75, -93, -107, -118,
+    -125, -127, -125, -118, -107, -93, -75, -54, -32, -8, 16, 39,
+    61, 81, 98, 111, 121, 126, 127, 123, 115, 103, 87, 68,
+    47, 24, 0, -24, -47, -68, -87, -103, -115, -123, -127, -126,
+    -121, -111, -98, -81, -61, -39, -16, 8, 32, 54, 75, 93,
+    107, 118, 125, 127, 125, 118, 107, 93, 75, 54, 32, 8,
+    -16, -39, -61, -81, -98, -111, -121, -126, -127, -123, -115, -103,
+    -87, -68, -47, -24, 0, 24, 47, 68, 87, 103, 115, 123,
+    127, 126, 121, 111, 98, 81, 61, 39, 16, -8, -32, -54,
+    -75, -93, -107, -118, -125, -127, -125, -118, -107, -93, -75, -54,
+    -32, -8, 16, 39, 61, 81, 98, 111, 121, 126, 127, 123,
+    115, 103, 87, 68, 47, 24, 0, -24, -47, -68, -87, -103,
+    -115, -123, -127, -126, -121, -111, -98, -81, -61, -39, -16, 8,
+    32, 54, 75, 93, 107, 118, 125, 127, 125, 118, 107, 93,
+    75, 54, 32, 8, -16, -39, -61, -81, -98, -111, -121, -120,
+    -104, -78, -49, -26, -10, -3, 1, 1, -6, -23, -23, 18,
+    73, 73, 0, -78, -93, -30, 58, 100, 60, -32, -98, -84,
+    0, 86, 102, 33, -64, -110, -65, 34, 107, 91, 0, -93,
+    -110, -36, 69, 117, 69, -37, -113, -97, 0, 98, 116, 38,
+    -72, -123, -73, 38, 118, 101, 0, -101, -119, -39, 74, 126,
+    74, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39,
+    120, 102, 0, -102, -120, -39, 74, 125, 73, -38, -118, -100,
+    0, 99, 116, 38, -71, -120, -70, 37, 113, 95, 0, -94,
+    -110, -36, 67, 114, 66, -35, -106, -89, 0, 88, 103, 33,
+    -62, -105, -61, 32, 97, 82, 0, -80, -94, -30, 57, 95,
+    55, -29, -88, -74, 0, 72, 84, 27, -50, -85, -49, 26,
+    78, 65, 0, -63, -74, -24, 44, 74, 43, -22, -68, -57,
+    0, 55, 64, 20, -38, -64, -37, 19, 59, 49, 0, -48,
+    -55, -18, 33, 56, 32, -17, -51, -43, 0, 42, 48, 15,
+    -29, -49, -28, 15, 45, 38, 0, -37, -43, -14, 26, 44,
+    26, -14, -41, -35, 0, 35, 41, 13, -25, -42, -25, 13,
+    40, 34, 0, -34, -41, -13, 25, 43, 25, -13, -42, -36,
+    0, 36, 43, 14, -27, -46, -28, 15, 46, 39, 0, -40,
+    -48, -16, 30, 52, 31, -17, -52, -44, 0, 46, 55, 18,
+    -35, -60, -36, 19, 59, 51, 0, -53, -63, -21, 40, 69,
+    41, -22, -69, -59, 0, 61, 73, 24, -46, -79, -47, 25,
+    79, 68, 0, -69, -83, -27, 52, 90, 54, -28, -89, -76,
+    0, 78, 93, 30, -58, -100, -60, 32, 98, 84, 0, -86,
+    -102, -33, 64, 110, 65, -34, -107, -91, 0, 93, 110, 36,
+    -69, -117, -69, 37, 113, 97, 0, -98, -116, -38, 72, 123,
+    73, -38, -118, -101, 0, 101, 119, 39, -74, -126, -74, 39,
+    121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -120, -102,
+    0, 102, 120, 39, -74, -125, -73, 38, 118, 100, 0, -99,
+    -116, -38, 71, 120, 70, -37, -113, -95, 0, 94, 110, 36,
+    -67, -114, -66, 35, 106, 89, 0, -88, -103, -33, 62, 105,
+    61, -32, -97, -82, 0, 80, 94, 30, -57, -95, -55, 29,
+    88, 74, 0, -72, -84, -27, 50, 85, 49, -26, -78, -65,
+    0, 63, 74, 24, -44, -74, -43, 22, 68, 57, 0, -55,
+    -64, -20, 38, 64, 37, -19, -59, -49, 0, 48, 55, 18,
+    -33, -56, -32, 17, 51, 43, 0, -42, -48, -15, 29, 49,
+    28, -15, -45, -38, 0, 37, 43, 14, -26, -44, -26, 14,
+    41, 35, 0, -35, -41, -13, 25, 42, 25, -13, -40, -34,
+    0, 34, 41, 13, -25, -43, -25, 13, 42, 36, 0, -36,
+    -43, -14, 27, 46, 28, -15, -46, -39, 0, 40, 48, 16,
+    -30, -52, -31, 17, 52, 44, 0, -46, -55, -18, 35, 60,
+    36, -19, -59, -51, 0, 53, 63, 21, -40, -69, -41, 22,
+    69, 59, 0, -61, -73, -24, 46, 79, 47, -25, -79, -68,
+    0, 69, 83, 27, -52, -90, -54, 28, 89, 76, 0, -78,
+    -93, -30, 58, 100, 60, -32, -98, -84, 0, 86, 102, 33,
+    -64, -110, -65, 34, 107, 91, 0, -93, -110, -36, 69, 117,
+    69, -37, -113, -97, 0, 98, 116, 38, -72, -123, -73, 38,
+    118, 101, 0, -101, -119, -39, 74, 126, 74, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 120, 102, 0, -102,
+    -120, -39, 74, 125, 73, -38, -118, -100, 0, 99, 116, 38,
+    -71, -120, -70, 37, 113, 95, 0, -94, -110, -36, 67, 114,
+    66, -35, -106, -89, 0, 88, 103, 33, -62, -105, -61, 32,
+    97, 82, 0, -80, -94, -30, 57, 95, 55, -29, -88, -74,
+    0, 72, 84, 27, -50, -85, -49, 26, 78, 65, 0, -63,
+    -74, -24, 44, 74, 43, -22, -68, -57, 0, 55, 64, 20,
+    -38, -64, -37, 19, 59, 49, 0, -48, -55, -18, 33, 56,
+    32, -17, -51, -43, 0, 42, 48, 15, -29, -49, -28, 15,
+    45, 38, 0, -37, -43, -14, 26, 44, 26, -14, -41, -35,
+    0, 35, 41, 13, -25, -42, -25, 13, 40, 34, 0, -34,
+    -41, -13, 25, 43, 25, -13, -42, -36, 0, 36, 43, 14,
+    -27, -46, -28, 15, 46, 39, 0, -40, -48, -16, 30, 52,
+    31, -17, -52, -44, 0, 46, 55, 18, -35, -60, -36, 19,
+    59, 51, 0, -53, -63, -21, 40, 69, 41, -22, -69, -59,
+    0, 61, 73, 24, -46, -79, -47, 25, 79, 68, 0, -69,
+    -83, -27, 52, 90, 54, -28, -89, -76, 0, 78, 93, 30,
+    -58, -100, -60, 32, 98, 84, 0, -86, -102, -33, 64, 110,
+    65, -34, -107, -91, 0, 93, 110, 36, -69, -117, -69, 37,
+    113, 97, 0, -93, -95, -24, 31, 31, 9, -2, -1, 1,
+    1, -6, -23, -23, 18, 73, 73, 0, -78, -93, -30, 58,
+    100, 60, -32, -98, -84, 0, 86, 102, 33, -64, -110, -65,
+    34, 107, 91, 0, -93, -110, -36, 69, 117, 69, -37, -113,
+    -97, 0, 98, 116, 38, -72, -123, -73, 38, 118, 101, 0,
+    -101, -119, -39, 74, 126, 74, -39, -121, -103, 0, 103, 121,
+    39, -75, -127, -75, 39, 120, 102, 0, -102, -120, -39, 74,
+    125, 73, -38, -118, -100, 0, 99, 116, 38, -71, -120, -70,
+    37, 113, 95, 0, -94, -110, -36, 67, 114, 66, -35, -106,
+    -89, 0, 88, 103, 33, -62, -105, -61, 32, 97, 82, 0,
+    -80, -94, -30, 57, 95, 55, -29, -88, -74, 0, 72, 84,
+    27, -50, -85, -49, 26, 78, 65, 0, -63, -74, -24, 44,
+    74, 43, -22, -68, -57, 0, 55, 64, 20, -38, -64, -37,
+    19, 59, 49, 0, -48, -55, -18, 33, 56, 32, -17, -51,
+    -43, 0, 42, 48, 15, -29, -49, -28, 15, 45, 38, 0,
+    -37, -43, -14, 26, 44, 26, -14, -41, -35, 0, 35, 41,
+    13, -25, -42, -25, 13, 40, 34, 0, -34, -41, -13, 25,
+    43, 25, -13, -42, -36, 0, 36, 43, 14, -27, -46, -28,
+    15, 46, 39, 0, -40, -48, -16, 30, 52, 31, -17, -52,
+    -44, 0, 46, 55, 18, -35, -60, -36, 19, 59, 51, 0,
+    -53, -63, -21, 40, 69, 41, -22, -69, -59, 0, 61, 73,
+    24, -46, -79, -47, 25, 79, 68, 0, -69, -83, -27, 52,
+    90, 54, -28, -89, -76, 0, 78, 93, 30, -58, -100, -60,
+    32, 98, 84, 0, -86, -102, -33, 64, 110, 65, -34, -107,
+    -91, 0, 93, 110, 36, -69, -117, -69, 37, 113, 97, 0,
+    -98, -116, -38, 72, 123, 73, -38, -118, -101, 0, 101, 119,
+    39, -74, -126, -74, 39, 121, 103, 0, -103, -121, -39, 75,
+    127, 75, -39, -120, -102, 0, 102, 120, 39, -74, -125, -73,
+    38, 118, 100, 0, -99, -116, -38, 71, 120, 70, -37, -113,
+    -95, 0, 94, 110, 36, -67, -114, -66, 35, 106, 89, 0,
+    -88, -103, -33, 62, 105, 61, -32, -97, -82, 0, 80, 94,
+    30, -57, -95, -55, 29, 88, 74, 0, -72, -84, -27, 50,
+    85, 49, -26, -78, -65, 0, 63, 74, 24, -44, -74, -43,
+    22, 68, 57, 0, -55, -64, -20, 38, 64, 37, -19, -59,
+    -49, 0, 48, 55, 18, -33, -56, -32, 17, 51, 43, 0,
+    -42, -48, -15, 29, 49, 28, -15, -45, -38, 0, 37, 43,
+    14, -26, -44, -26, 14, 41, 35, 0, -35, -41, -13, 25,
+    42, 25, -13, -40, -34, 0, 34, 41, 13, -25, -43, -25,
+    13, 42, 36, 0, -36, -43, -14, 27, 46, 28, -15, -46,
+    -39, 0, 40, 48, 16, -30, -52, -31, 17, 52, 44, 0,
+    -46, -55, -18, 35, 60, 36, -19, -59, -51, 0, 53, 63,
+    21, -40, -69, -41, 22, 69, 59, 0, -61, -73, -24, 46,
+    79, 47, -25, -79, -68, 0, 69, 83, 27, -52, -90, -54,
+    28, 89, 76, 0, -78, -93, -30, 58, 100, 60, -32, -98,
+    -84, 0, 86, 102, 33, -64, -110, -65, 34, 107, 91, 0,
+    -93, -110, -36, 69, 117, 69, -37, -113, -97, 0, 98, 116,
+    38, -72, -123, -73, 38, 118, 101, 0, -101, -119, -39, 74,
+    126, 74, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 120, 102, 0, -102, -120, -39, 74, 125, 73, -38, -118,
+    -100, 0, 99, 116, 38, -71, -120, -70, 37, 113, 95, 0,
+    -94, -110, -36, 67, 114, 66, -35, -106, -89, 0, 88, 103,
+    33, -62, -105, -61, 32, 97, 82, 0, -80, -94, -30, 57,
+    95, 55, -29, -88, -74, 0, 72, 84, 27, -50, -85, -49,
+    26, 78, 65, 0, -63, -74, -24, 44, 74, 43, -22, -68,
+    -57, 0, 55, 64, 20, -38, -64, -37, 19, 59, 49, 0,
+    -48, -55, -18, 33, 56, 32, -17, -51, -43, 0, 42, 48,
+    15, -29, -49, -28, 15, 45, 38, 0, -37, -43, -14, 26,
+    44, 26, -14, -41, -35, 0, 35, 41, 13, -25, -42, -25,
+    13, 40, 34, 0, -34, -41, -13, 25, 43, 25, -13, -42,
+    -36, 0, 36, 43, 14, -27, -46, -28, 15, 46, 39, 0,
+    -40, -48, -16, 30, 52, 31, -17, -52, -44, 0, 46, 55,
+    18, -35, -60, -36, 19, 59, 51, 0, -53, -63, -21, 40,
+    69, 41, -22, -69, -59, 0, 61, 73, 24, -46, -79, -47,
+    25, 79, 68, 0, -69, -83, -27, 52, 90, 54, -28, -89,
+    -76, 0, 78, 93, 30, -58, -100, -60, 32, 98, 84, 0,
+    -86, -102, -33, 64, 110, 65, -34, -107, -91, 0, 93, 110,
+    36, -69, -117, -69, 37, 113, 97, 0, -93, -95, -24, 31,
+    31, 9, -2, -1, 1, 1, -6, -23, -23, 18, 73, 73,
+    0, -78, -93, -30, 58, 100, 60, -32, -98, -84, 0, 86,
+    102, 33, -64, -110, -65, 34, 107, 91, 0, -93, -110, -36,
+    69, 117, 69, -37, -113, -97, 0, 98, 116, 38, -72, -123,
+    -73, 38, 118, 101, 0, -101, -119, -39, 74, 126, 74, -39,
+    -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 120, 102,
+    0, -102, -120, -39, 74, 125, 73, -38, -118, -100, 0, 99,
+    116, 38, -71, -120, -70, 37, 113, 95, 0, -94, -110, -36,
+    67, 114, 66, -35, -106, -89, 0, 88, 103, 33, -62, -105,
+    -61, 32, 97, 82, 0, -80, -94, -30, 57, 95, 55, -29,
+    -88, -74, 0, 72, 84, 27, -50, -85, -49, 26, 78, 65,
+    0, -63, -74, -24, 44, 74, 43, -22, -68, -57, 0, 55,
+    64, 20, -38, -64, -37, 19, 59, 49, 0, -48, -55, -18,
+    33, 56, 32, -17, -51, -43, 0, 42, 48, 15, -29, -49,
+    -28, 15, 45, 38, 0, -37, -43, -14, 26, 44, 26, -14,
+    -41, -35, 0, 35, 41, 13, -25, -42, -25, 13, 40, 34,
+    0, -34, -41, -13, 25, 43, 25, -13, -42, -36, 0, 36,
+    43, 14, -27, -46, -28, 15, 46, 39, 0, -40, -48, -16,
+    30, 52, 31, -17, -52, -44, 0, 46, 55, 18, -35, -60,
+    -36, 19, 59, 51, 0, -53, -63, -21, 40, 69, 41, -22,
+    -69, -59, 0, 61, 73, 24, -46, -79, -47, 25, 79, 68,
+    0, -69, -83, -27, 52, 90, 54, -28, -89, -76, 0, 78,
+    93, 30, -58, -100, -60, 32, 98, 84, 0, -86, -102, -33,
+    64, 110, 65, -34, -107, -91, 0, 93, 110, 36, -69, -117,
+    -69, 37, 113, 97, 0, -98, -116, -38, 72, 123, 73, -38,
+    -118, -101, 0, 101, 119, 39, -74, -126, -74, 39, 121, 103,
+    0, -103, -121, -39, 75, 127, 75, -39, -120, -102, 0, 102,
+    120, 39, -74, -125, -73, 38, 118, 100, 0, -99, -116, -38,
+    71, 120, 70, -37, -113, -95, 0, 94, 110, 36, -67, -114,
+    -66, 35, 106, 89, 0, -88, -103, -33, 62, 105, 61, -32,
+    -97, -82, 0, 80, 94, 30, -57, -95, -55, 29, 88, 74,
+    0, -72, -84, -27, 50, 85, 49, -26, -78, -65, 0, 63,
+    74, 24, -44, -74, -43, 22, 68, 57, 0, -55, -64, -20,
+    38, 64, 37, -19, -59, -49, 0, 48, 55, 18, -33, -56,
+    -32, 17, 51, 43, 0, -42, -48, -15, 29, 49, 28, -15,
+    -45, -38, 0, 37, 43, 14, -26, -44, -26, 14, 41, 35,
+    0, -35, -41, -13, 25, 42, 25, -13, -40, -34, 0, 34,
+    41, 13, -25, -43, -25, 13, 42, 36, 0, -36, -43, -14,
+    27, 46, 28, -15, -46, -39, 0, 40, 48, 16, -30, -52,
+    -31, 17, 52, 44, 0, -46, -55, -18, 35, 60, 36, -19,
+    -59, -51, 0, 53, 63, 21, -40, -69, -41, 22, 69, 59,
+    0, -61, -73, -24, 46, 79, 47, -25, -79, -68, 0, 69,
+    83, 27, -52, -90, -54, 28, 89, 76, 0, -78, -93, -30,
+    58, 100, 60, -32, -98, -84, 0, 86, 102, 33, -64, -110,
+    -65, 34, 107, 91, 0, -93, -110, -36, 69, 117, 69, -37,
+    -113, -97, 0, 98, 116, 38, -72, -123, -73, 38, 118, 101,
+    0, -101, -119, -39, 74, 126, 74, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 120, 102, 0, -102, -120, -39,
+    74, 125, 73, -38, -118, -100, 0, 99, 116, 38, -71, -120,
+    -70, 37, 113, 95, 0, -94, -110, -36, 67, 114, 66, -35,
+    -106, -89, 0, 88, 103, 33, -62, -105, -61, 32, 97, 82,
+    0, -80, -94, -30, 57, 95, 55, -29, -88, -74, 0, 72,
+    84, 27, -50, -85, -49, 26, 78, 65, 0, -63, -74, -24,
+    44, 74, 43, -22, -68, -57, 0, 55, 64, 20, -38, -64,
+    -37, 19, 59, 49, 0, -48, -55, -18, 33, 56, 32, -17,
+    -51, -43, 0, 42, 48, 15, -29, -49, -28, 15, 45, 38,
+    0, -37, -43, -14, 26, 44, 26, -14, -41, -35, 0, 35,
+    41, 13, -25, -42, -25, 13, 40, 34, 0, -34, -41, -13,
+    25, 43, 25, -13, -42, -36, 0, 36, 43, 14, -27, -46,
+    -28, 15, 46, 39, 0, -40, -48, -16, 30, 52, 31, -17,
+    -52, -44, 0, 46, 55, 18, -35, -60, -36, 19, 59, 51,
+    0, -53, -63, -21, 40, 69, 41, -22, -69, -59, 0, 61,
+    73, 24, -46, -79, -47, 25, 79, 68, 0, -69, -83, -27,
+    52, 90, 54, -28, -89, -76, 0, 78, 93, 30, -58, -100,
+    -60, 32, 98, 84, 0, -86, -102, -33, 64, 110, 65, -34,
+    -107, -91, 0, 93, 110, 36, -69, -117, -69, 37, 113, 97,
+    0, -93, -95, -24, 31, 31, 9, -2, -1, 1, 1, -6,
+    -23, -23, 18, 73, 73, 0, -78, -93, -30, 58, 100, 60,
+    -32, -98, -84, 0, 86, 102, 33, -64, -110, -65, 34, 107,
+    91, 0, -93, -110, -36, 69, 117, 69, -37, -113, -97, 0,
+    98, 116, 38, -72, -123, -73, 38, 118, 101, 0, -101, -119,
+    -39, 74, 126, 74, -39, -121, -103, 0, 103, 121, 39, -75,
+    -127, -75, 39, 120, 102, 0, -102, -120, -39, 74, 125, 73,
+    -38, -118, -100, 0, 99, 116, 38, -71, -120, -70, 37, 113,
+    95, 0, -94, -110, -36, 67, 114, 66, -35, -106, -89, 0,
+    88, 103, 33, -62, -105, -61, 32, 97, 82, 0, -80, -94,
+    -30, 57, 95, 55, -29, -88, -74, 0, 72, 84, 27, -50,
+    -85, -49, 26, 78, 65, 0, -63, -74, -24, 44, 74, 43,
+    -22, -68, -57, 0, 55, 64, 20, -38, -64, -37, 19, 59,
+    49, 0, -48, -55, -18, 33, 56, 32, -17, -51, -43, 0,
+    42, 48, 15, -29, -49, -28, 15, 45, 38, 0, -37, -43,
+    -14, 26, 44, 26, -14, -41, -35, 0, 35, 41, 13, -25,
+    -42, -25, 13, 40, 34, 0, -34, -41, -13, 25, 43, 25,
+    -13, -42, -36, 0, 36, 43, 14, -27, -46, -28, 15, 46,
+    39, 0, -40, -48, -16, 30, 52, 31, -17, -52, -44, 0,
+    46, 55, 18, -35, -60, -36, 19, 59, 51, 0, -53, -63,
+    -21, 40, 69, 41, -22, -69, -59, 0, 61, 73, 24, -46,
+    -79, -47, 25, 79, 68, 0, -69, -83, -27, 52, 90, 54,
+    -28, -89, -76, 0, 78, 93, 30, -58, -100, -60, 32, 98,
+    84, 0, -86, -102, -33, 64, 110, 65, -34, -107, -91, 0,
+    93, 110, 36, -69, -117, -69, 37, 113, 97, 0, -98, -116,
+    -38, 72, 123, 73, -38, -118, -101, 0, 101, 119, 39, -74,
+    -126, -74, 39, 121, 103, 0, -103, -121, -39, 75, 127, 75,
+    -39, -120, -102, 0, 102, 120, 39, -74, -125, -73, 38, 118,
+    100, 0, -99, -116, -38, 71, 120, 70, -37, -113, -95, 0,
+    94, 110, 36, -67, -114, -66, 35, 106, 89, 0, -88, -103,
+    -33, 62, 105, 61, -32, -97, -82, 0, 80, 94, 30, -57,
+    -95, -55, 29, 88, 74, 0, -72, -84, -27, 50, 85, 49,
+    -26, -78, -65, 0, 63, 74, 24, -44, -74, -43, 22, 68,
+    57, 0, -55, -64, -20, 38, 64, 37, -19, -59, -49, 0,
+    48, 55, 18, -33, -56, -32, 17, 51, 43, 0, -42, -48,
+    -15, 29, 49, 28, -15, -45, -38, 0, 37, 43, 14, -26,
+    -44, -26, 14, 41, 35, 0, -35, -41, -13, 25, 42, 25,
+    -13, -40, -34, 0, 34, 41, 13, -25, -43, -25, 13, 42,
+    36, 0, -36, -43, -14, 27, 46, 28, -15, -46, -39, 0,
+    40, 48, 16, -30, -52, -31, 17, 52, 44, 0, -46, -55,
+    -18, 35, 60, 36, -19, -59, -51, 0, 53, 63, 21, -40,
+    -69, -41, 22, 69, 59, 0, -61, -73, -24, 46, 79, 47,
+    -25, -79, -68, 0, 69, 83, 27, -52, -90, -54, 28, 89,
+    76, 0, -78, -93, -30, 58, 100, 60, -32, -98, -84, 0,
+    86, 102, 33, -64, -110, -65, 34, 107, 91, 0, -93, -110,
+    -36, 69, 117, 69, -37, -113, -97, 0, 98, 116, 38, -72,
+    -123, -73, 38, 118, 101, 0, -101, -119, -39, 74, 126, 74,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 120,
+    102, 0, -102, -120, -39, 74, 125, 73, -38, -118, -100, 0,
+    99, 116, 38, -71, -120, -70, 37, 113, 95, 0, -94, -110,
+    -36, 67, 114, 66, -35, -106, -89, 0, 88, 103, 33, -62,
+    -105, -61, 32, 97, 82, 0, -80, -94, -30, 57, 95, 55,
+    -29, -88, -74, 0, 72, 84, 27, -50, -85, -49, 26, 78,
+    65, 0, -63, -74, -24, 44, 74, 43, -22, -68, -57, 0,
+    55, 64, 20, -38, -64, -37, 19, 59, 49, 0, -48, -55,
+    -18, 33, 56, 32, -17, -51, -43, 0, 42, 48, 15, -29,
+    -49, -28, 15, 45, 38, 0, -37, -43, -14, 26, 44, 26,
+    -14, -41, -35, 0, 35, 41, 13, -25, -42, -25, 13, 40,
+    34, 0, -34, -41, -13, 25, 43, 25, -13, -42, -36, 0,
+    36, 43, 14, -27, -46, -28, 15, 46, 39, 0, -40, -48,
+    -16, 30, 52, 31, -17, -52, -44, 0, 46, 55, 18, -35,
+    -60, -36, 19, 59, 51, 0, -53, -63, -21, 40, 69, 41,
+    -22, -69, -59, 0, 61, 73, 24, -46, -79, -47, 25, 79,
+    68, 0, -69, -83, -27, 52, 90, 54, -28, -89, -76, 0,
+    78, 93, 30, -58, -100, -60, 32, 98, 84, 0, -86, -102,
+    -33, 64, 110, 65, -34, -107, -91, 0, 93, 110, 36, -69,
+    -117, -69, 37, 113, 97, 0, -93, -95, -24, 31, 31, 9,
+    -2, -1, 1, 1, -6, -23, -23, 18, 73, 73, 0, -78,
+    -93, -30, 58, 100, 60, -32, -98, -84, 0, 86, 102, 33,
+    -64, -110, -65, 34, 107, 91, 0, -93, -110, -36, 69, 117,
+    69, -37, -113, -97, 0, 98, 116, 38, -72, -123, -73, 38,
+    118, 101, 0, -101, -119, -39, 74, 126, 74, -39, -121, -103,
+    0, 103, 121, 39, -75, -127, -75, 39, 120, 102, 0, -102,
+    -120, -39, 74, 125, 73, -38, -118, -100, 0, 99, 116, 38,
+    -71, -120, -70, 37, 113, 95, 0, -94, -110, -36, 67, 114,
+    66, -35, -106, -89, 0, 88, 103, 33, -62, -105, -61, 32,
+    97, 82, 0, -80, -94, -30, 57, 95, 55, -29, -88, -74,
+    0, 72, 84, 27, -50, -85, -49, 26, 78, 65, 0, -63,
+    -74, -24, 44, 74, 43, -22, -68, -57, 0, 55, 64, 20,
+    -38, -64, -37, 19, 59, 49, 0, -48, -55, -18, 33, 56,
+    32, -17, -51, -43, 0, 42, 48, 15, -29, -49, -28, 15,
+    45, 38, 0, -37, -43, -14, 26, 44, 26, -14, -41, -35,
+    0, 35, 41, 13, -25, -42, -25, 13, 40, 34, 0, -34,
+    -41, -13, 25, 43, 25, -13, -42, -36, 0, 36, 43, 14,
+    -27, -46, -28, 15, 46, 39, 0, -40, -48, -16, 30, 52,
+    31, -17, -52, -44, 0, 46, 55, 18, -35, -60, -36, 19,
+    59, 51, 0, -53, -63, -21, 40, 69, 41, -22, -69, -59,
+    0, 61, 73, 24, -46, -79, -47, 25, 79, 68, 0, -69,
+    -83, -27, 52, 90, 54, -28, -89, -76, 0, 78, 93, 30,
+    -58, -100, -60, 32, 98, 84, 0, -86, -102, -33, 64, 110,
+    65, -34, -107, -91, 0, 93, 110, 36, -69, -117, -69, 37,
+    113, 97, 0, -98, -116, -38, 72, 123, 73, -38, -118, -101,
+    0, 101, 119, 39, -74, -126, -74, 39, 121, 103, 0, -103,
+    -121, -39, 75, 127, 75, -39, -120, -102, 0, 102, 120, 39,
+    -74, -125, -73, 38, 118, 100, 0, -99, -116, -38, 71, 120,
+    70, -37, -113, -95, 0, 94, 110, 36, -67, -114, -66, 35,
+    106, 89, 0, -88, -103, -33, 62, 105, 61, -32, -97, -82,
+    0, 80, 94, 30, -57, -95, -55, 29, 88, 74, 0, -72,
+    -84, -27, 50, 85, 49, -26, -78, -65, 0, 63, 74, 24,
+    -44, -74, -43, 22, 68, 57, 0, -55, -64, -20, 38, 64,
+    37, -19, -59, -49, 0, 48, 55, 18, -33, -56, -32, 17,
+    51, 43, 0, -42, -48, -15, 29, 49, 28, -15, -45, -38,
+    0, 37, 43, 14, -26, -44, -26, 14, 41, 35, 0, -35,
+    -41, -13, 25, 42, 25, -13, -40, -34, 0, 34, 41, 13,
+    -25, -43, -25, 13, 42, 36, 0, -36, -43, -14, 27, 46,
+    28, -15, -46, -39, 0, 40, 48, 16, -30, -52, -31, 17,
+    52, 44, 0, -46, -55, -18, 35, 60, 36, -19, -59, -51,
+    0, 53, 63, 21, -40, -69, -41, 22, 69, 59, 0, -61,
+    -73, -24, 46, 79, 47, -25, -79, -68, 0, 69, 83, 27,
+    -52, -90, -54, 28, 89, 76, 0, -78, -93, -30, 58, 100,
+    60, -32, -98, -84, 0, 86, 102, 33, -64, -110, -65, 34,
+    107, 91, 0, -93, -110, -36, 69, 117, 69, -37, -113, -97,
+    0, 98, 116, 38, -72, -123, -73, 38, 118, 101, 0, -101,
+    -119, -39, 74, 126, 74, -39, -121, -103, 0, 103, 121, 39,
+    -75, -127, -75, 39, 120, 102, 0, -102, -120, -39, 74, 125,
+    73, -38, -118, -100, 0, 99, 116, 38, -71, -120, -70, 37,
+    113, 95, 0, -94, -110, -36, 67, 114, 66, -35, -106, -89,
+    0, 88, 103, 33, -62, -105, -61, 32, 97, 82, 0, -80,
+    -94, -30, 57, 95, 55, -29, -88, -74, 0, 72, 84, 27,
+    -50, -85, -49, 26, 78, 65, 0, -63, -74, -24, 44, 74,
+    43, -22, -68, -57, 0, 55, 64, 20, -38, -64, -37, 19,
+    59, 49, 0, -48, -55, -18, 33, 56, 32, -17, -51, -43,
+    0, 42, 48, 15, -29, -49, -28, 15, 45, 38, 0, -37,
+    -43, -14, 26, 44, 26, -14, -41, -35, 0, 35, 41, 13,
+    -25, -42, -25, 13, 40, 34, 0, -34, -41, -13, 25, 43,
+    25, -13, -42, -36, 0, 36, 43, 14, -27, -46, -28, 15,
+    46, 39, 0, -40, -48, -16, 30, 52, 31, -17, -52, -44,
+    0, 46, 55, 18, -35, -60, -36, 19, 59, 51, 0, -53,
+    -63, -21, 40, 69, 41, -22, -69, -59, 0, 61, 73, 24,
+    -46, -79, -47, 25, 79, 68, 0, -69, -83, -27, 52, 90,
+    54, -28, -89, -76, 0, 78, 93, 30, -58, -100, -60, 32,
+    98, 84, 0, -86, -102, -33, 64, 110, 65, -34, -107, -91,
+    0, 93, 110, 36, -69, -117, -69, 37, 113, 97, 0, -93,
+    -95, -24, 31, 31, 9, -2, -1, 1, 1, -6, -23, -23,
+    18, 73, 73, 0, -78, -93, -30, 58, 100, 60, -32, -98,
+    -84, 0, 86, 102, 33, -64, -110, -65, 34, 107, 91, 0,
+    -93, -110, -36, 69, 117, 69, -37, -113, -97, 0, 98, 116,
+    38, -72, -123, -73, 38, 118, 101, 0, -101, -119, -39, 74,
+    126, 74, -39, -121, -103, 0, 103, 121, 39, -75, -127, -75,
+    39, 120, 102, 0, -102, -120, -39, 74, 125, 73, -38, -118,
+    -100, 0, 99, 116, 38, -71, -120, -70, 37, 113, 95, 0,
+    -94, -110, -36, 67, 114, 66, -35, -106, -89, 0, 88, 103,
+    33, -62, -105, -61, 32, 97, 82, 0, -80, -94, -30, 57,
+    95, 55, -29, -88, -74, 0, 72, 84, 27, -50, -85, -49,
+    26, 78, 65, 0, -63, -74, -24, 44, 74, 43, -22, -68,
+    -57, 0, 55, 64, 20, -38, -64, -37, 19, 59, 49, 0,
+    -48, -55, -18, 33, 56, 32, -17, -51, -43, 0, 42, 48,
+    15, -29, -49, -28, 15, 45, 38, 0, -37, -43, -14, 26,
+    44, 26, -14, -41, -35, 0, 35, 41, 13, -25, -42, -25,
+    13, 40, 34, 0, -34, -41, -13, 25, 43, 25, -13, -42,
+    -36, 0, 36, 43, 14, -27, -46, -28, 15, 46, 39, 0,
+    -40, -48, -16, 30, 52, 31, -17, -52, -44, 0, 46, 55,
+    18, -35, -60, -36, 19, 59, 51, 0, -53, -63, -21, 40,
+    69, 41, -22, -69, -59, 0, 61, 73, 24, -46, -79, -47,
+    25, 79, 68, 0, -69, -83, -27, 52, 90, 54, -28, -89,
+    -76, 0, 78, 93, 30, -58, -100, -60, 32, 98, 84, 0,
+    -86, -102, -33, 64, 110, 65, -34, -107, -91, 0, 93, 110,
+    36, -69, -117, -69, 37, 113, 97, 0, -98, -116, -38, 72,
+    123, 73, -38, -118, -101, 0, 101, 119, 39, -74, -126, -74,
+    39, 121, 103, 0, -103, -121, -39, 75, 127, 75, -39, -120,
+    -102, 0, 102, 120, 39, -74, -125, -73, 38, 118, 100, 0,
+    -99, -116, -38, 71, 120, 70, -37, -113, -95, 0, 94, 110,
+    36, -67, -114, -66, 35, 106, 89, 0, -88, -103, -33, 62,
+    105, 61, -32, -97, -82, 0, 80, 94, 30, -57, -95, -55,
+    29, 88, 74, 0, -72, -84, -27, 50, 85, 49, -26, -78,
+    -65, 0, 63, 74, 24, -44, -74, -43, 22, 68, 57, 0,
+    -55, -64, -20, 38, 64, 37, -19, -59, -49, 0, 48, 55,
+    18, -33, -56, -32, 17, 51, 43, 0, -42, -48, -15, 29,
+    49, 28, -15, -45, -38, 0, 37, 43, 14, -26, -44, -26,
+    14, 41, 35, 0, -35, -41, -13, 25, 42, 25, -13, -40,
+    -34, 0, 34, 41, 13, -25, -43, -25, 13, 42, 36, 0,
+    -36, -43, -14, 27, 46, 28, -15, -46, -39, 0, 40, 48,
+    16, -30, -52, -31, 17, 52, 44, 0, -46, -55, -18, 35,
+    60, 36, -19, -59, -51, 0, 53, 63, 21, -40, -69, -41,
+    22, 69, 59, 0, -61, -73, -24, 46, 79, 47, -25, -79,
+    -68, 0, 69, 83, 27, -52, -90, -54, 28, 89, 76, 0,
+    -78, -93, -30, 58, 100, 60, -32, -98, -84, 0, 86, 102,
+    33, -64, -110, -65, 34, 107, 91, 0, -93, -110, -36, 69,
+    117, 69, -37, -113, -97, 0, 98, 116, 38, -72, -123, -73,
+    38, 118, 101, 0, -101, -119, -39, 74, 126, 74, -39, -121,
+    -103, 0, 103, 121, 39, -75, -127, -75, 39, 120, 102, 0,
+    -102, -120, -39, 74, 125, 73, -38, -118, -100, 0, 99, 116,
+    38, -71, -120, -70, 37, 113, 95, 0, -94, -110, -36, 67,
+    114, 66, -35, -106, -89, 0, 88, 103, 33, -62, -105, -61,
+    32, 97, 82, 0, -80, -94, -30, 57, 95, 55, -29, -88,
+    -74, 0, 72, 84, 27, -50, -85, -49, 26, 78, 65, 0,
+    -63, -74, -24, 44, 74, 43, -22, -68, -57, 0, 55, 64,
+    20, -38, -64, -37, 19, 59, 49, 0, -48, -55, -18, 33,
+    56, 32, -17, -51, -43, 0, 42, 48, 15, -29, -49, -28,
+    15, 45, 38, 0, -37, -43, -14, 26, 44, 26, -14, -41,
+    -35, 0, 35, 41, 13, -25, -42, -25, 13, 40, 34, 0,
+    -34, -41, -13, 25, 43, 25, -13, -42, -36, 0, 36, 43,
+    14, -27, -46, -28, 15, 46, 39, 0, -40, -48, -16, 30,
+    52, 31, -17, -52, -44, 0, 46, 55, 18, -35, -60, -36,
+    19, 59, 51, 0, -53, -63, -21, 40, 69, 41, -22, -69,
+    -59, 0, 61, 73, 24, -46, -79, -47, 25, 79, 68, 0,
+    -69, -83, -27, 52, 90, 54, -28, -89, -76, 0, 78, 93,
+    30, -58, -100, -60, 32, 98, 84, 0, -86, -102, -33, 64,
+    110, 65, -34, -107, -91, 0, 93, 110, 36, -69, -117, -69,
+    37, 113, 97, 0, -93, -95, -24, 31, 31, 9, -2, -1,
+    1, 1, -6, -23, -23, 18, 73, 73, 0, -78, -93, -30,
+    58, 100, 60, -32, -98, -84, 0, 86, 102, 33, -64, -110,
+    -65, 34, 107, 91, 0, -93, -110, -36, 69, 117, 69, -37,
+    -113, -97, 0, 98, 116, 38, -72, -123, -73, 38, 118, 101,
+    0, -101, -119, -39, 74, 126, 74, -39, -121, -103, 0, 103,
+    121, 39, -75, -127, -75, 39, 120, 102, 0, -102, -120, -39,
+    74, 125, 73, -38, -118, -100, 0, 99, 116, 38, -71, -120,
+    -70, 37, 113, 95, 0, -94, -110, -36, 67, 114, 66, -35,
+    -106, -89, 0, 88, 103, 33, -62, -105, -61, 32, 97, 82,
+    0, -80, -94, -30, 57, 95, 55, -29, -88, -74, 0, 72,
+    84, 27, -50, -85, -49, 26, 78, 65, 0, -63, -74, -24,
+    44, 74, 43, -22, -68, -57, 0, 55, 64, 20, -38, -64,
+    -37, 19, 59, 49, 0, -48, -55, -18, 33, 56, 32, -17,
+    -51, -43, 0, 42, 48, 15, -29, -49, -28, 15, 45, 38,
+    0, -37, -43, -14, 26, 44, 26, -14, -41, -35, 0, 35,
+    41, 13, -25, -42, -25, 13, 40, 34, 0, -34, -41, -13,
+    25, 43, 25, -13, -42, -36, 0, 36, 43, 14, -27, -46,
+    -28, 15, 46, 39, 0, -40, -48, -16, 30, 52, 31, -17,
+    -52, -44, 0, 46, 55, 18, -35, -60, -36, 19, 59, 51,
+    0, -53, -63, -21, 40, 69, 41, -22, -69, -59, 0, 61,
+    73, 24, -46, -79, -47, 25, 79, 68, 0, -69, -83, -27,
+    52, 90, 54, -28, -89, -76, 0, 78, 93, 30, -58, -100,
+    -60, 32, 98, 84, 0, -86, -102, -33, 64, 110, 65, -34,
+    -107, -91, 0, 93, 110, 36, -69, -117, -69, 37, 113, 97,
+    0, -98, -116, -38, 72, 123, 73, -38, -118, -101, 0, 101,
+    119, 39, -74, -126, -74, 39, 121, 103, 0, -103, -121, -39,
+    75, 127, 75, -39, -120, -102, 0, 102, 120, 39, -74, -125,
+    -73, 38, 118, 100, 0, -99, -116, -38, 71, 120, 70, -37,
+    -113, -95, 0, 94, 110, 36, -67, -114, -66, 35, 106, 89,
+    0, -88, -103, -33, 62, 105, 61, -32, -97, -82, 0, 80,
+    94, 30, -57, -95, -55, 29, 88, 74, 0, -72, -84, -27,
+    50, 85, 49, -26, -78, -65, 0, 63, 74, 24, -44, -74,
+    -43, 22, 68, 57, 0, -55, -64, -20, 38, 64, 37, -19,
+    -59, -49, 0, 48, 55, 18, -33, -56, -32, 17, 51, 43,
+    0, -42, -48, -15, 29, 49, 28, -15, -45, -38, 0, 37,
+    43, 14, -26, -44, -26, 14, 41, 35, 0, -35, -41, -13,
+    25, 42, 25, -13, -40, -34, 0, 34, 41, 13, -25, -43,
+    -25, 13, 42, 36, 0, -36, -43, -14, 27, 46, 28, -15,
+    -46, -39, 0, 40, 48, 16, -30, -52, -31, 17, 52, 44,
+    0, -46, -55, -18, 35, 60, 36, -19, -59, -51, 0, 53,
+    63, 21, -40, -69, -41, 22, 69, 59, 0, -61, -73, -24,
+    46, 79, 47, -25, -79, -68, 0, 69, 83, 27, -52, -90,
+    -54, 28, 89, 76, 0, -78, -93, -30, 58, 100, 60, -32,
+    -98, -84, 0, 86, 102, 33, -64, -110, -65, 34, 107, 91,
+    0, -93, -110, -36, 69, 117, 69, -37, -113, -97, 0, 98,
+    116, 38, -72, -123, -73, 38, 118, 101, 0, -101, -119, -39,
+    74, 126, 74, -39, -121, -103, 0, 103, 121, 39, -75, -127,
+    -75, 39, 120, 102, 0, -102, -120, -39, 74, 125, 73, -38,
+    -118, -100, 0, 99, 116, 38, -71, -120, -70, 37, 113, 95,
+    0, -94, -110, -36, 67, 114, 66, -35, -106, -89, 0, 88,
+    103, 33, -62, -105, -61, 32, 97, 82, 0, -80, -94, -30,
+    57, 95, 55, -29, -88, -74, 0, 72, 84, 27, -50, -85,
+    -49, 26, 78, 65, 0, -63, -74, -24, 44, 74, 43, -22,
+    -68, -57, 0, 55, 64, 20, -38, -64, -37, 19, 59, 49,
+    0, -48, -55, -18, 33, 56, 32, -17, -51, -43, 0, 42,
+    48, 15, -29, -49, -28, 15, 45, 38, 0, -37, -43, -14,
+    26, 44, 26, -14, -41, -35, 0, 35, 41, 13, -25, -42,
+    -25, 13, 40, 34, 0, -34, -41, -13, 25, 43, 25, -13,
+    -42, -36, 0, 36, 43, 14, -27, -46, -28, 15, 46, 39,
+    0, -40, -48, -16, 30, 52, 31, -17, -52, -44, 0, 46,
+    55, 18, -35, -60, -36, 19, 59, 51, 0, -53, -63, -21,
+    40, 69, 41, -22, -69, -59, 0, 61, 73, 24, -46, -79,
+    -47, 25, 79, 68, 0, -69, -83, -27, 52, 90, 54, -28,
+    -89, -76, 0, 78, 93, 30, -58, -100, -60, 32, 98, 84,
+    0, -86, -102, -33, 64, 110, 65, -34, -107, -91, 0, 93,
+    110, 36, -69, -117, -69, 37, 113, 97, 0, -93, -95, -24,
+    31, 31, 9, -2, -1, 1, 1, -6, -23, -23, 18, 73,
+    73, 0, -78, -93, -30, 58, 100, 60, -32, -98, -84, 0,
+    86, 102, 33, -64, -110, -65, 34, 107, 91, 0, -93, -110,
+    -36, 69, 117, 69, -37, -113, -97, 0, 98, 116, 38, -72,
+    -123, -73, 38, 118, 101, 0, -101, -119, -39, 74, 126, 74,
+    -39, -121, -103, 0, 103, 121, 39, -75, -127, -75, 39, 120,
+    102, 0, -102, -120, -39, 74, 125, 73, -38, -118, -100, 0,
+    99, 116, 38, -71, -120, -70, 37, 113, 95, 0, -94, -110,
+    -36, 67, 114, 66, -35, -106, -89, 0, 88, 103, 33, -62,
+    -105, -61, 32, 97, 82, 0, -80, -94, -30, 57, 95, 55,
+    -29, -88, -74, 0, 72, 84, 27, -50, -85, -49, 26, 78,
+    65, 0, -63, -74, -24, 44, 74, 43, -22, -68, -57, 0,
+    55, 64, 20, -38, -64, -37, 19, 59, 49, 0, -48, -55,
+    -18, 33, 56, 32, -17, -51, -43, 0, 42, 48, 15, -29,
+    -49, -28, 15, 45, 38, 0, -37, -43, -14, 26, 44, 26,
+    -14, -41, -35, 0, 35, 41, 13, -25, -42, -25, 13, 40,
+    34, 0, -34, -41, -13, 25, 43, 25, -13, -42, -36, 0,
+    36, 43, 14, -27, -46, -28, 15, 46, 39, 0, -40, -48,
+    -16, 30, 52, 31, -17, -52, -44, 0, 46, 55, 18, -35,
+    -60, -36, 19, 59, 51, 0, -53, -63, -21, 40, 69, 41,
+    -22, -69, -59, 0, 61, 73, 24, -46, -79, -47, 25, 79,
+    68, 0, -69, -83, -27, 52, 90, 54, -28, -89, -76, 0,
+    78, 93, 30, -58, -100, -60, 32, 98, 84, 0, -86, -102,
+    -33, 64, 110, 65, -34, -107, -91, 0, 93, 110, 36, -69,
+    -117, -69, 37, 113, 97, 0, -98, -116, -38, 72, 123, 73,
+    -38, -118, -101, 0, 101, 119, 39, -74, -126, -74, 39, 121,
+    103, 0, -103, -121, -39, 75, 127, 75, -39, -120, -102, 0,
+    102, 120, 39, -74, -125, -73, 38, 118, 100, 0, -99, -116,
+    -38, 71, 120, 70, -37, -113, -95, 0, 94, 110, 36, -67,
+    -114, -66, 35, 106, 89, 0, -88, -103, -33, 62, 105, 61,
+    -32, -97, -82, 0, 80, 94, 30, -57, -95, -55, 29, 88,
+    74, 0, -72, -84, -27, 50, 85, 49, -26, -78, -65, 0,
+    63, 74, 24, -44, -74, -43, 22, 68, 57, 0, -55, -64,
+    -20, 38, 64, 37, -19, -59, -49, 0, 48, 55, 18, -33,
+    -56, -32, 17, 51, 43, 0, -42, -48, -15, 29, 49, 28,
+    -15, -45, -38, 0, 37, 43, 14, -26, -44, -26, 14, 41,
+    35, 0, -35, -41, -13, 25, 42, 25, -13, -40, -34, 0,
+    34, 41, 13, -25, -43, -25, 13, 42, 36, 0, -36, -43,
+    -14, 27, 46, 28, -15, -46, -39, 0, 40, 48, 16, -30,
+    -52, -31, 17, 52, 44, 0, -46, -55, -18, 35, 60, 36,
+    -19, -59, -51, 0, 53, 63, 21, -40, -69, -41, 22, 69,
+    59, 0, -61, -73, -24, 46, 79, 47, -25, -79, -68, 0,
+    69, 83, 27, -52, -90, -54, 28, 89, 76, 0, -78, -93,
+    -30, 58, 100, 60, -32, -98, -84, 0, 86, 102, 33, -64,
+    -110, -65, 34, 107, 91, 0, -93, -110, -36, 69, 117, 69,
+    -37, -113, -97, 0, 98, 116, 38, -72, -123, -73, 38, 118,
+    101, 0, -101, -119, -39, 74, 126, 74, -39, -121, -103, 0,
+    103, 121, 39, -75, -127, -75, 39, 120, 102, 0, -102, -120,
+    -39, 74, 125, 73, -38, -118, -100, 0, 99, 116, 38, -71,
+    -120, -70, 37, 113, 95, 0, -94, -110, -36, 67, 114, 66,
+    -35, -106, -89, 0, 88, 103, 33, -62, -105, -61, 32, 97,
+    82, 0, -80, -94, -30, 57, 95, 55, -29, -88, -74, 0,
+    72, 84, 27, -50, -85, -49, 26, 78, 65, 0, -63, -74,
+    -24, 44, 74, 43, -22, -68, -57, 0, 55, 64, 20, -38,
+    -64, -37, 19, 59, 49, 0, -48, -55, -18, 33, 56, 32,
+    -17, -51, -43, 0, 42, 48, 15, -29, -49, -28, 15, 45,
+    38, 0, -37, -43, -14, 26, 44, 26, -14, -41, -35, 0,
+    35, 41, 13, -25, -42, -25, 13, 40, 34, 0, -34, -41,
+    -13, 25, 43, 25, -13, -42, -36, 0, 36, 43, 14, -27,
+    -46, -28, 15, 46, 39, 0, -40, -48, -16, 30, 52, 31,
+    -17, -52, -44, 0, 46, 55, 18, -35, -60, -36, 19, 59,
+    51, 0, -53, -63, -21, 40, 69, 41, -22, -69, -59, 0,
+    61, 73, 24, -46, -79, -47, 25, 79, 68, 0, -69, -83,
+    -27, 52, 90, 54, -28, -89, -76, 0, 78, 93, 30, -58,
+    -100, -60, 32, 98, 84, 0, -86, -102, -33, 64, 110, 65,
+    -34, -107, -91, 0, 93, 110, 36, -69, -117, -69, 37, 113,
+    97, 0, -93, -95, -24, 31, 31, 9, -2, -1,
+};
+
+const PhonemeTableSpan kPhonemeTableSpans[254] = {
+    /* Fields: channel, start_frame, num_frames, offset. */
+    {0, 269, 63, 0},
+    {0, 669, 63, 63},
+    {1, 202, 64, 126},
+    {1, 602, 64, 190},
+    {4, 334, 64, 254},
+    {4, 734, 64, 318},
+    {5, 135, 64, 382},
+    {5, 535, 64, 446},
+    {8, 2, 64, 510},
+    {8, 402, 64, 574},
+    {9, 69, 63, 638},
+    {9, 469, 63, 701},
+    {0, 3, 129, 764},
+    {1, 3, 129, 893},
+    {4, 136, 129, 1022},
+    {5, 136, 129, 1151},
+    {8, 269, 129, 1280},
+    {9, 269, 129, 1409},
+    {12, 403, 129, 1538},
+    {13, 403, 129, 1667},
+    {16, 536, 129, 1796},
+    {17, 536, 129, 1925},
+    {20, 669, 129, 2054},
+    {21, 669, 129, 2183},
+    {14, 269, 63, 2312},
+    {14, 669, 63, 2375},
+    {15, 202, 64, 2438},
+    {15, 602, 64, 2502},
+    {18, 334, 64, 2566},
+    {18, 734, 64, 2630},
+    {19, 135, 64, 2694},
+    {19, 535, 64, 2758},
+    {22, 2, 64, 2822},
+    {22, 402, 64, 2886},
+    {23, 69, 63, 2950},
+    {23, 469, 63, 3013},
+    {8, 2, 97, 3076},
+    {9, 701, 97, 3173},
+    {12, 102, 97, 3270},
+    {13, 602, 97, 3367},
+    {16, 202, 97, 3464},
+    {17, 502, 97, 3561},
+    {20, 302, 97, 3658},
+    {21, 402, 97, 3755},
+    {16, 2, 277, 3852},
+    {17, 2, 277, 4129},
+    {20, 2, 277, 4406},
+    {21, 2, 277, 4683},
+    {0, 65, 671, 4960},
+    {1, 65, 671, 5631},
+    {20, 65, 671, 6302},
+    {21, 65, 671, 6973},
+    {10, 2, 277, 7644},
+    {11, 2, 277, 7921},
+    {14, 2, 277, 8198},
+    {15, 2, 277, 8475},
+    {8, 2, 797, 8752},
+    {9, 2, 797, 9549},
+    {12, 2, 797, 10346},
+    {13, 2, 797, 11143},
+    {0, 615, 183, 11940},
+    {4, 492, 183, 12123},
+    {8, 369, 184, 12306},
+    {12, 247, 183, 12490},
+    {16, 125, 183, 12673},
+    {20, 2, 184, 12856},
+    {0, 2, 188, 13040},
+    {1, 2, 188, 13228},
+    {2, 2, 188, 13416},
+    {3, 2, 188, 13604},
+    {12, 290, 188, 13792},
+    {13, 290, 188, 13980},
+    {14, 290, 188, 14168},
+    {15, 290, 188, 14356},
+    {2, 202, 64, 14544},
+    {2, 602, 64, 14608},
+    {3, 269, 63, 14672},
+    {3, 669, 63, 14735},
+    {6, 135, 64, 14798},
+    {6, 535, 64, 14862},
+    {7, 334, 64, 14926},
+    {7, 734, 64, 14990},
+    {10, 69, 63, 15054},
+    {10, 469, 63, 15117},
+    {11, 2, 64, 15180},
+    {11, 402, 64, 15244},
+    {20, 2, 797, 15308},
+    {21, 2, 797, 16105},
+    {22, 2, 797, 16902},
+    {23, 2, 797, 17699},
+    {0, 2, 277, 18496},
+    {1, 2, 277, 18773},
+    {4, 2, 277, 19050},
+    {5, 2, 277, 19327},
+    {12, 71, 659, 19604},
+    {13, 71, 659, 20263},
+    {14, 71, 659, 20922},
+    {15, 71, 659, 21581},
+    {16, 71, 659, 22240},
+    {17, 71, 659, 22899},
+    {18, 71, 659, 23558},
+    {19, 71, 659, 24217},
+    {0, 701, 97, 24876},
+    {1, 701, 97, 24973},
+    {2, 2, 97, 25070},
+    {3, 2, 97, 25167},
+    {4, 602, 97, 25264},
+    {5, 602, 97, 25361},
+    {6, 102, 97, 25458},
+    {7, 102, 97, 25555},
+    {8, 502, 97, 25652},
+    {9, 502, 97, 25749},
+    {10, 202, 97, 25846},
+    {11, 202, 97, 25943},
+    {12, 402, 97, 26040},
+    {13, 402, 97, 26137},
+    {14, 302, 97, 26234},
+    {15, 302, 97, 26331},
+    {0, 2, 117, 26428},
+    {4, 122, 117, 26545},
+    {8, 242, 117, 26662},
+    {12, 362, 117, 26779},
+    {0, 2, 797, 26896},
+    {1, 2, 797, 27693},
+    {20, 2, 797, 28490},
+    {21, 2, 797, 29287},
+    {0, 2, 277, 30084},
+    {1, 2, 277, 30361},
+    {4, 2, 277, 30638},
+    {5, 2, 277, 30915},
+    {18, 2, 797, 31192},
+    {19, 2, 797, 31989},
+    {22, 2, 797, 32786},
+    {23, 2, 797, 33583},
+    {16, 3, 795, 34380},
+    {17, 3, 795, 35175},
+    {20, 3, 795, 35970},
+    {21, 3, 795, 36765},
+    {10, 3, 795, 37560},
+    {11, 3, 795, 38355},
+    {14, 3, 795, 39150},
+    {15, 3, 795, 39945},
+    {0, 3, 795, 40740},
+    {1, 3, 795, 41535},
+    {4, 3, 795, 42330},
+    {5, 3, 795, 43125},
+    {8, 21, 199, 43920},
+    {8, 581, 199, 44119},
+    {9, 161, 199, 44318},
+    {10, 301, 199, 44517},
+    {11, 441, 199, 44716},
+    {12, 21, 199, 44915},
+    {12, 581, 199, 45114},
+    {13, 161, 199, 45313},
+    {14, 301, 199, 45512},
+    {15, 441, 199, 45711},
+    {2, 669, 130, 45910},
+    {3, 669, 130, 46040},
+    {6, 535, 130, 46170},
+    {7, 535, 130, 46300},
+    {10, 402, 130, 46430},
+    {11, 402, 130, 46560},
+    {14, 269, 130, 46690},
+    {15, 269, 130, 46820},
+    {18, 135, 130, 46950},
+    {19, 135, 130, 47080},
+    {22, 2, 130, 47210},
+    {23, 2, 130, 47340},
+    {4, 567, 44, 47470},
+    {4, 661, 45, 47514},
+    {4, 756, 41, 47559},
+    {12, 285, 44, 47600},
+    {12, 380, 44, 47644},
+    {12, 474, 45, 47688},
+    {20, 2, 45, 47733},
+    {20, 97, 44, 47778},
+    {20, 190, 44, 47822},
+    {6, 2, 45, 47866},
+    {6, 97, 44, 47911},
+    {6, 190, 44, 47955},
+    {14, 285, 44, 47999},
+    {14, 380, 44, 48043},
+    {14, 474, 45, 48087},
+    {22, 567, 44, 48132},
+    {22, 661, 45, 48176},
+    {22, 756, 41, 48221},
+    {16, 2, 277, 48262},
+    {17, 2, 277, 48539},
+    {20, 2, 277, 48816},
+    {21, 2, 277, 49093},
+    {2, 2, 797, 49370},
+    {3, 2, 797, 50167},
+    {6, 2, 797, 50964},
+    {7, 2, 797, 51761},
+    {0, 2, 797, 52558},
+    {1, 2, 797, 53355},
+    {2, 2, 797, 54152},
+    {3, 2, 797, 54949},
+    {18, 2, 797, 55746},
+    {19, 2, 797, 56543},
+    {22, 2, 797, 57340},
+    {23, 2, 797, 58137},
+    {10, 2, 277, 58934},
+    {11, 2, 277, 59211},
+    {14, 2, 277, 59488},
+    {15, 2, 277, 59765},
+    {8, 2, 797, 60042},
+    {9, 2, 797, 60839},
+    {12, 2, 797, 61636},
+    {13, 2, 797, 62433},
+    {8, 290, 188, 63230},
+    {9, 290, 188, 63418},
+    {10, 290, 188, 63606},
+    {11, 290, 188, 63794},
+    {20, 2, 188, 63982},
+    {21, 2, 188, 64170},
+    {22, 2, 188, 64358},
+    {23, 2, 188, 64546},
+    {2, 2, 116, 64734},
+    {3, 2, 116, 64850},
+    {6, 122, 116, 64966},
+    {7, 122, 116, 65082},
+    {10, 242, 116, 65198},
+    {11, 242, 116, 65314},
+    {14, 362, 116, 65430},
+    {15, 362, 116, 65546},
+    {20, 2, 797, 65662},
+    {21, 2, 797, 66459},
+    {22, 2, 797, 67256},
+    {23, 2, 797, 68053},
+    {8, 3, 795, 68850},
+    {10, 3, 795, 69645},
+    {12, 3, 795, 70440},
+    {14, 3, 795, 71235},
+    {16, 3, 795, 72030},
+    {18, 3, 795, 72825},
+    {20, 3, 795, 73620},
+    {22, 3, 795, 74415},
+    {8, 3, 795, 75210},
+    {10, 3, 795, 76005},
+    {12, 3, 795, 76800},
+    {14, 3, 795, 77595},
+    {16, 3, 795, 78390},
+    {18, 3, 795, 79185},
+    {20, 3, 795, 79980},
+    {22, 3, 795, 80775},
+    {0, 2, 797, 81570},
+    {1, 2, 797, 82367},
+    {2, 2, 797, 83164},
+    {3, 2, 797, 83961},
+    {2, 2, 797, 84758},
+    {3, 2, 797, 85555},
+    {6, 2, 797, 86352},
+    {7, 2, 797, 87149},
+};
+
+const PhonemeTable kPhonemeTables[] = {
+    /* Fields: phoneme, num_frames, scale, first_span, num_spans. */
+    {"AE", 800, 0.000602362212f, 0, 12},
+    {"AH", 800, 0.000602362212f, 12, 12},
+    {"AW", 800, 0.000602362212f, 24, 12},
+    {"AY", 800, 0.000899835373f, 36, 8},
+    {"B", 280, 0.000899835257f, 44, 4},
+    {"CH", 800, 0.000601897889f, 48, 4},
+    {"D", 280, 0.000899835257f, 52, 4},
+    {"DH", 800, 0.000902949017f, 56, 4},
+    {"EE", 800, 0.000602362212f, 60, 6},
+    {"EH", 480, 0.000602362212f, 66, 8},
+    {"ER", 800, 0.000602362212f, 74, 12},
+    {"F", 800, 0.000602362212f, 86, 4},
+    {"G", 280, 0.000899835257f, 90, 4},
+    {"H", 800, 0.000599987921f, 94, 8},
+    {"I", 800, 0.000899835373f, 102, 16},
+    {"IH", 480, 0.000602362212f, 118, 4},
+    {"J", 800, 0.00108172942f, 122, 4},
+    {"K", 280, 0.000602362212f, 126, 4},
+    {"L", 800, 0.000899835315f, 130, 4},
+    {"M", 800, 0.00119850691f, 134, 4},
+    {"N", 800, 0.00119850691f, 138, 4},
+    {"NG", 800, 0.00119850691f, 142, 4},
+    {"OE", 800, 0.000597220031f, 146, 10},
+    {"OO", 800, 0.000899835257f, 156, 12},
+    {"OW", 800, 0.000602362212f, 168, 9},
+    {"OY", 800, 0.000602362212f, 177, 9},
+    {"P", 280, 0.000602362212f, 186, 4},
+    {"R", 800, 0.000899835315f, 190, 4},
+    {"S", 800, 0.000602362212f, 194, 4},
+    {"SH", 800, 0.000602362212f, 198, 4},
+    {"T", 280, 0.000602362212f, 202, 4},
+    {"TH", 800, 0.000602362212f, 206, 4},
+    {"UH", 480, 0.000602362212f, 210, 8},
+    {"UU", 480, 0.000899835373f, 218, 8},
+    {"V", 800, 0.000902949017f, 226, 4},
+    {"W", 800, 0.00119850691f, 230, 8},
+    {"Y", 800, 0.000602362212f, 238, 8},
+    {"Z", 800, 0.000902949017f, 246, 4},
+    {"ZH", 800, 0.000902949017f, 250, 4},
+};
+const int kPhonemeTablesSize =
+    sizeof(kPhonemeTables) / sizeof(*kPhonemeTables);
@@ -0,0 +1,271 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "extras/references/taps/phoneme_table.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "extras/references/taps/phoneme_code.h"
+#include "src/dsp/logging.h"
+
+#define kNumChannels kPhonemeTableNumChannels
+/* Runs of zeros at least this long split a channel into separate spans. */
+#define kMinGapFrames 32
+
+/* Tables generated from kPhonemeCodebook. */
+typedef struct {
+  int8_t* samples;
+  int num_samples;
+  PhonemeTableSpan* spans;
+  int num_spans;
+  PhonemeTable* tables;
+} GeneratedTables;
+
+/* Generates the tables by sampling the codebook functions, quantizing to int8
+ * with a per-phoneme scale, and keeping nonzero spans of each channel.
+ */
+static void GenerateTables(GeneratedTables* generated) {
+  const float sample_rate_hz = kPhonemeTableSampleRateHz;
+  int max_frames = 0;
+  int i;
+  for (i = 0; i < kPhonemeCodebookSize; ++i) {
+    const int num_frames =
+        (int)(sample_rate_hz * kPhonemeCodebook[i].duration + 0.5f);
+    if (num_frames > max_frames) { max_frames = num_frames; }
+  }
+  const int max_samples = kPhonemeCodebookSize * kNumChannels * max_frames;
+  float* signal = (float*)CHECK_NOTNULL(
+      malloc(sizeof(float) * kNumChannels * max_frames));
+  int* quantized = (int*)CHECK_NOTNULL(
+      malloc(sizeof(int) * kNumChannels * max_frames));
+  generated->samples = (int8_t*)CHECK_NOTNULL(malloc(max_samples));
+  generated->spans = (PhonemeTableSpan*)CHECK_NOTNULL(
+      malloc(sizeof(PhonemeTableSpan) * max_samples / kMinGapFrames));
+  generated->tables = (PhonemeTable*)CHECK_NOTNULL(
+      malloc(sizeof(PhonemeTable) * kPhonemeCodebookSize));
+  generated->num_samples = 0;
+  generated->num_spans = 0;
+
+  for (i = 0; i < kPhonemeCodebookSize; ++i) {
+    const PhonemeCode* code = &kPhonemeCodebook[i];
+    PhonemeTable* table = &generated->tables[i];
+    table->phoneme = code->phoneme;
+    table->num_frames = (int)(sample_rate_hz * code->duration + 0.5f);
+    table->first_span = generated->num_spans;
+
+    float max_abs = 0.0f;
+    int n;
+    for (n = 0; n < table->num_frames; ++n) {
+      float* frame = signal + kNumChannels * n;
+      code->fun(n / sample_rate_hz, frame);
+      int c;
+      for (c = 0; c < kNumChannels; ++c) {
+        if (fabs(frame[c]) > max_abs) { max_abs = fabs(frame[c]); }
+      }
+    }
+    table->scale = (max_abs > 0.0f) ? max_abs / 127 : 1.0f;
+    for (n = 0; n < kNumChannels * table->num_frames; ++n) {
+      quantized[n] = (int)floor(signal[n] / table->scale + 0.5f);
+    }
+
+    int c;
+    for (c = 0; c < kNumChannels; ++c) {
+      n = 0;
+      while (1) {
+        /* Find the next nonzero sample, then the end of the span, where
+         * kMinGapFrames or more zeros follow.
+         */
+        while (n < table->num_frames && !quantized[kNumChannels * n + c]) {
+          ++n;
+        }
+        if (n == table->num_frames) { break; }
+        const int start = n;
+        int last_nonzero = n;
+        for (; n < table->num_frames && n - last_nonzero < kMinGapFrames;
+             ++n) {
+          if (quantized[kNumChannels * n + c]) { last_nonzero = n; }
+        }
+
+        PhonemeTableSpan* span = &generated->spans[generated->num_spans++];
+        span->channel = c;
+        span->start_frame = start;
+        span->num_frames = last_nonzero + 1 - start;
+        span->offset = generated->num_samples;
+        int k;
+        for (k = start; k <= last_nonzero; ++k) {
+          generated->samples[generated->num_samples++] =
+              (int8_t)quantized[kNumChannels * k + c];
+        }
+        n = last_nonzero + 1;
+      }
+    }
+    table->num_spans = generated->num_spans - table->first_span;
+  }
+
+  free(quantized);
+  free(signal);
+}
+
+static void FreeGeneratedTables(GeneratedTables* generated) {
+  free(generated->tables);
+  free(generated->spans);
+  free(generated->samples);
+}
+
+/* Prints the tables for phoneme_table_data.c. Called if the program runs with
+ * --print_tables.
+ */
+static void PrintTables(void) {
+  GeneratedTables generated;
+  GenerateTables(&generated);
+  int i;
+  printf("const int8_t kPhonemeTableSamples[%d] = {\n",
+         generated.num_samples);
+  for (i = 0; i < generated.num_samples; ++i) {
+    printf("%s%d,%s", (i % 12 == 0) ? "    " : "", generated.samples[i],
+           (i % 12 == 11 || i == generated.num_samples - 1) ? "\n" : " ");
+  }
+  printf("};\n\n");
+
+  printf("const PhonemeTableSpan kPhonemeTableSpans[%d] = {\n"
+         "    /* Fields: channel, start_frame, num_frames, offset. */\n",
+         generated.num_spans);
+  for (i = 0; i < generated.num_spans; ++i) {
+    const PhonemeTableSpan* span = &generated.spans[i];
+    printf("    {%d, %d, %d, %d},\n", span->channel, span->start_frame,
+           span->num_frames, (int)span->offset);
+  }
+  printf("};\n\n");
+
+  printf("const PhonemeTable kPhonemeTables[] = {\n"
+         "    /* Fields: phoneme, num_frames, scale, first_span, num_spans. */"
+         "\n");
+  for (i = 0; i < kPhonemeCodebookSize; ++i) {
+    const PhonemeTable* table = &generated.tables[i];
+    printf("    {\"%s\", %d, %.9gf, %d, %d},\n", table->phoneme,
+           table->num_frames, table->scale, table->first_span,
+           table->num_spans);
+  }
+  printf("};\nconst int kPhonemeTablesSize =\n"
+         "    sizeof(kPhonemeTables) / sizeof(*kPhonemeTables);\n");
+  FreeGeneratedTables(&generated);
+}
+
+/* The tables in phoneme_table_data.c are up to date with kPhonemeCodebook. */
+static void TestTablesMatchCodebook(void) {
+  puts("TestTablesMatchCodebook");
+  GeneratedTables generated;
+  GenerateTables(&generated);
+
+  CHECK(kPhonemeTablesSize == kPhonemeCodebookSize);
+  int i;
+  for (i = 0; i < kPhonemeTablesSize; ++i) {
+    const PhonemeTable* expected = &generated.tables[i];
+    const PhonemeTable* actual = &kPhonemeTables[i];
+    CHECK(!strcmp(actual->phoneme, expected->phoneme));
+    CHECK(actual->num_frames == expected->num_frames);
+    CHECK(fabs(actual->scale - expected->scale) <= 1e-6f * expected->scale);
+    CHECK(actual->first_span == expected->first_span);
+    CHECK(actual->num_spans == expected->num_spans);
+  }
+  for (i = 0; i < generated.num_spans; ++i) {
+    CHECK(kPhonemeTableSpans[i].channel == generated.spans[i].channel);
+    CHECK(kPhonemeTableSpans[i].start_frame == generated.spans[i].start_frame);
+    CHECK(kPhonemeTableSpans[i].num_frames == generated.spans[i].num_frames);
+    CHECK(kPhonemeTableSpans[i].offset == generated.spans[i].offset);
+  }
+  CHECK(!memcmp(kPhonemeTableSamples, generated.samples,
+                generated.num_samples));
+
+  FreeGeneratedTables(&generated);
+}
+
+static void TestPhonemeTableByName(void) {
+  puts("TestPhonemeTableByName");
+  const PhonemeTable* table = PhonemeTableByName("b,er,d");
+  CHECK(table != NULL && !strcmp(table->phoneme, "B"));
+  CHECK(PhonemeTableByName("ZZ") == NULL);
+  CHECK(PhonemeTableByName("BER") == NULL);
+}
+
+/* PhonemeTablePlayer output approximates GeneratePhonemeSignal(). */
+static void TestPlayerMatchesGeneratePhonemeSignal(float spacing,
+                                                   int block_size) {
+  printf("TestPlayerMatchesGeneratePhonemeSignal(%g, %d)\n",
+         spacing, block_size);
+  const char* kPhonemes = "B,ER,D,AE,M,OE,K,T,SH";
+  int num_frames;
+  float* expected = CHECK_NOTNULL(GeneratePhonemeSignal(
+      kPhonemes, spacing, NULL, 1.0f, kPhonemeTableSampleRateHz,
+      &num_frames));
+
+  PhonemeTablePlayer player;
+  CHECK(PhonemeTablePlayerStart(&player, kPhonemes, spacing));
+  float* output = (float*)CHECK_NOTNULL(
+      malloc(sizeof(float) * kNumChannels * block_size));
+  float max_error = 0.0f;
+  float max_abs = 0.0f;
+  int start;
+  for (start = 0; PhonemeTablePlayerProcess(&player, output, block_size);
+       start += block_size) {
+    int i;
+    for (i = 0; i < kNumChannels * block_size; ++i) {
+      const int index = kNumChannels * start + i;
+      const float expected_value =
+          (index < kNumChannels * num_frames) ? expected[index] : 0.0f;
+      const float error = fabs(output[i] - expected_value);
+      if (error > max_error) { max_error = error; }
+      if (fabs(expected_value) > max_abs) { max_abs = fabs(expected_value); }
+    }
+  }
+  /* Playback ends within a block of the end of the signal. */
+  CHECK(abs(start - num_frames) <= block_size);
+  /* Output is zero after the end. */
+  int i;
+  for (i = 0; i < kNumChannels * block_size; ++i) {
+    CHECK(output[i] == 0.0f);
+  }
+  /* Error is within int8 quantization error, summed over overlaps. */
+  CHECK(max_error <= 0.02f * max_abs);
+
+  free(output);
+  free(expected);
+}
+
+static void TestInvalidPhonemes(void) {
+  puts("TestInvalidPhonemes");
+  PhonemeTablePlayer player;
+  CHECK(!PhonemeTablePlayerStart(&player, "B,ZZ,D", 0.1f));
+  CHECK(!PhonemeTablePlayerStart(&player, "", 0.1f));
+}
+
+int main(int argc, char** argv) {
+  if (argc == 2 && !strcmp(argv[1], "--print_tables")) {
+    PrintTables();
+    return EXIT_SUCCESS;
+  }
+
+  TestTablesMatchCodebook();
+  TestPhonemeTableByName();
+  TestPlayerMatchesGeneratePhonemeSignal(0.15f, 64);
+  TestPlayerMatchesGeneratePhonemeSignal(0.0f, 17);
+  TestPlayerMatchesGeneratePhonemeSignal(-0.1f, 100);
+  TestInvalidPhonemes();
+
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
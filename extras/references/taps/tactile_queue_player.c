@@ -0,0 +1,346 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "extras/references/taps/tactile_queue_player.h"
+
+#include <math.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "extras/tools/spsc_ring.h"
+
+/* Capacity of the ring of RMS records passed from the callback. */
+#define kRmsRecordCapacity 64
+
+/* A slot of samples passed from the producer to the consumer. */
+typedef struct {
+  /* Index of the slot in `slot_samples`. */
+  int slot;
+  /* Number of frames in use in the slot. */
+  int num_frames;
+  /* Value of `generation` when the slot was enqueued. */
+  unsigned generation;
+} QueueEntry;
+
+struct TactileQueuePlayer {
+  int num_channels;
+  int num_slots;
+  int slot_frames;
+  int fade_out_frames;
+  /* Storage for `num_slots` slots of `slot_frames * num_channels` samples. */
+  float* slot_samples;
+
+  /* Passes QueueEntry elements from producer to consumer. */
+  SpscRing* queued;
+  /* Passes slot indices from consumer back to producer once played. */
+  SpscRing* free_slots;
+  /* Passes records from consumer to producer of `num_channels` sums of squares
+   * followed by the number of frames, for TactileQueuePlayerGetRms().
+   */
+  SpscRing* rms_records;
+  /* Incremented by the producer to interrupt. Entries enqueued with an older
+   * generation are dropped by the consumer.
+   */
+  atomic_uint generation;
+  /* Producer scratch space for reading an RMS record. */
+  float* rms_read_record;
+
+  /* The remaining fields are used only by the consumer. */
+
+  /* FIFO of `num_slots` entries received from `queued`, the front of which is
+   * playing. Since there are `num_slots` slots, it can't overflow.
+   */
+  QueueEntry* pending;
+  int pending_head;
+  int num_pending;
+  /* Read position in the front pending entry. */
+  int read_frame;
+  /* Faded out tail of an interrupted signal, still to be added to the output,
+   * starting at `fade_samples + num_channels * fade_start`.
+   */
+  float* fade_samples;
+  int fade_start;
+  int fade_frames;
+  /* Consumer scratch space for making an RMS record. */
+  float* rms_record;
+};
+
+TactileQueuePlayer* TactileQueuePlayerMake(int num_channels,
+                                           float sample_rate_hz,
+                                           int num_slots, int slot_frames) {
+  if (num_channels <= 0 || num_slots <= 0 || slot_frames <= 0) {
+    return NULL;
+  }
+  TactileQueuePlayer* player =
+      (TactileQueuePlayer*)malloc(sizeof(TactileQueuePlayer));
+  if (player == NULL) { return NULL; }
+
+  player->num_channels = num_channels;
+  player->num_slots = num_slots;
+  player->slot_frames = slot_frames;
+  player->fade_out_frames = (int)(0.005f * sample_rate_hz + 0.5f);
+  player->slot_samples = (float*)malloc(
+      sizeof(float) * num_slots * slot_frames * num_channels);
+  player->queued = SpscRingMake(sizeof(QueueEntry), num_slots);
+  player->free_slots = SpscRingMake(sizeof(int), num_slots);
+  player->rms_records = SpscRingMake(sizeof(float) * (num_channels + 1),
+                                     kRmsRecordCapacity);
+  atomic_init(&player->generation, 0);
+  player->rms_read_record =
+      (float*)malloc(sizeof(float) * (num_channels + 1));
+  player->pending = (QueueEntry*)malloc(sizeof(QueueEntry) * num_slots);
+  player->pending_head = 0;
+  player->num_pending = 0;
+  player->read_frame = 0;
+  player->fade_samples = (float*)malloc(
+      sizeof(float) * (player->fade_out_frames + 1) * num_channels);
+  player->fade_start = 0;
+  player->fade_frames = 0;
+  player->rms_record = (float*)malloc(sizeof(float) * (num_channels + 1));
+
+  if (player->slot_samples == NULL || player->queued == NULL ||
+      player->free_slots == NULL || player->rms_records == NULL ||
+      player->pending == NULL || player->fade_samples == NULL ||
+      player->rms_record == NULL || player->rms_read_record == NULL) {
+    TactileQueuePlayerFree(player);
+    return NULL;
+  }
+
+  int slot;
+  for (slot = 0; slot < num_slots; ++slot) {
+    SpscRingWrite(player->free_slots, &slot, 1);
+  }
+  return player;
+}
+
+void TactileQueuePlayerFree(TactileQueuePlayer* player) {
+  if (player != NULL) {
+    free(player->rms_record);
+    free(player->fade_samples);
+    free(player->pending);
+    free(player->rms_read_record);
+    SpscRingFree(player->rms_records);
+    SpscRingFree(player->free_slots);
+    SpscRingFree(player->queued);
+    free(player->slot_samples);
+  }
+  free(player);
+}
+
+static float* SlotSamples(TactileQueuePlayer* player, int slot) {
+  return player->slot_samples +
+         (size_t)slot * player->slot_frames * player->num_channels;
+}
+
+int TactileQueuePlayerEnqueue(TactileQueuePlayer* player, const float* samples,
+                              int num_frames, int interrupt) {
+  const int num_channels = player->num_channels;
+  /* Only the producer writes `generation`, so a relaxed load suffices. */
+  unsigned generation =
+      atomic_load_explicit(&player->generation, memory_order_relaxed);
+  if (interrupt) {
+    atomic_store_explicit(&player->generation, ++generation,
+                          memory_order_release);
+  }
+
+  int num_enqueued = 0;
+  while (num_enqueued < num_frames) {
+    QueueEntry entry;
+    if (!SpscRingRead(player->free_slots, &entry.slot, 1)) { break; }
+    entry.num_frames = num_frames - num_enqueued;
+    if (entry.num_frames > player->slot_frames) {
+      entry.num_frames = player->slot_frames;
+    }
+    entry.generation = generation;
+    memcpy(SlotSamples(player, entry.slot),
+           samples + num_channels * num_enqueued,
+           sizeof(float) * entry.num_frames * num_channels);
+    /* This can't fail, since `queued` has room for all slots. */
+    SpscRingWrite(player->queued, &entry, 1);
+    num_enqueued += entry.num_frames;
+  }
+  return num_enqueued;
+}
+
+int TactileQueuePlayerNumFreeFrames(TactileQueuePlayer* player) {
+  return SpscRingNumAvailable(player->free_slots) * player->slot_frames;
+}
+
+/* Consumer: Returns the front pending entry's slot to the producer. */
+static void PopPending(TactileQueuePlayer* player) {
+  SpscRingWrite(player->free_slots,
+                &player->pending[player->pending_head].slot, 1);
+  if (++player->pending_head == player->num_slots) { player->pending_head = 0; }
+  --player->num_pending;
+  player->read_frame = 0;
+}
+
+/* Consumer: Returns 1 if the front pending entry was interrupted. */
+static int /*bool*/ FrontIsInterrupted(const TactileQueuePlayer* player,
+                                       unsigned generation) {
+  return player->num_pending > 0 &&
+         player->pending[player->pending_head].generation != generation;
+}
+
+/* Consumer: Drops the pending entries enqueued before `generation`. To avoid
+ * clicks, the first `fade_out_frames` frames following the current read
+ * position are multiplied with a linear fade out ramp and added to
+ * `fade_samples`.
+ */
+static void DropInterrupted(TactileQueuePlayer* player, unsigned generation) {
+  const int num_channels = player->num_channels;
+  /* Count frames to fade, which may span several entries. */
+  int count = 0;
+  int k;
+  for (k = 0; k < player->num_pending && count < player->fade_out_frames;
+       ++k) {
+    const QueueEntry* entry =
+        &player->pending[(player->pending_head + k) % player->num_slots];
+    if (entry->generation == generation) { break; }
+    count += entry->num_frames - (k == 0 ? player->read_frame : 0);
+  }
+  if (count > player->fade_out_frames) { count = player->fade_out_frames; }
+
+  /* Move what remains of any previous fade to the start of the buffer. */
+  memmove(player->fade_samples,
+          player->fade_samples + num_channels * player->fade_start,
+          sizeof(float) * player->fade_frames * num_channels);
+  player->fade_start = 0;
+  if (player->fade_frames < count) {
+    memset(player->fade_samples + num_channels * player->fade_frames, 0,
+           sizeof(float) * (count - player->fade_frames) * num_channels);
+    player->fade_frames = count;
+  }
+
+  float* dest = player->fade_samples;
+  const float weight_step = (count > 0) ? 1.0f / count : 0.0f;
+  const float offset = weight_step * (count - 0.5f);
+  int i = 0;
+  do {
+    const QueueEntry* front = &player->pending[player->pending_head];
+    const float* src =
+        SlotSamples(player, front->slot) + num_channels * player->read_frame;
+    int j;
+    for (j = player->read_frame; j < front->num_frames && i < count;
+         ++i, ++j) {
+      const float weight = offset - i * weight_step;
+      int c;
+      for (c = 0; c < num_channels; ++c) {
+        dest[c] += weight * src[c];
+      }
+      dest += num_channels;
+      src += num_channels;
+    }
+    PopPending(player);
+  } while (FrontIsInterrupted(player, generation));
+}
+
+/* Consumer: Receives newly queued entries and drops entries that have been
+ * interrupted.
+ */
+static void ReceiveEntries(TactileQueuePlayer* player) {
+  QueueEntry entry;
+  while (SpscRingRead(player->queued, &entry, 1)) {
+    int index = player->pending_head + player->num_pending;
+    if (index >= player->num_slots) { index -= player->num_slots; }
+    player->pending[index] = entry;
+    ++player->num_pending;
+  }
+
+  /* Load after reading `queued`, so that the generation is at least that of
+   * every received entry.
+   */
+  const unsigned generation =
+      atomic_load_explicit(&player->generation, memory_order_acquire);
+  if (FrontIsInterrupted(player, generation)) {
+    DropInterrupted(player, generation);
+  }
+}
+
+int TactileQueuePlayerFillBuffer(TactileQueuePlayer* player, int num_frames,
+                                 float* output) {
+  const int num_channels = player->num_channels;
+  ReceiveEntries(player);
+
+  /* Copy from pending entries back to back. */
+  int num_played = 0;
+  while (num_played < num_frames && player->num_pending > 0) {
+    const QueueEntry* front = &player->pending[player->pending_head];
+    int count = front->num_frames - player->read_frame;
+    if (count > num_frames - num_played) { count = num_frames - num_played; }
+    memcpy(output + num_channels * num_played,
+           SlotSamples(player, front->slot) + num_channels * player->read_frame,
+           sizeof(float) * count * num_channels);
+    num_played += count;
+    player->read_frame += count;
+    if (player->read_frame == front->num_frames) { PopPending(player); }
+  }
+  memset(output + num_channels * num_played, 0,
+         sizeof(float) * (num_frames - num_played) * num_channels);
+
+  /* Add the faded out tail of an interrupted signal. */
+  int fade_count = player->fade_frames;
+  if (fade_count > num_frames) { fade_count = num_frames; }
+  const float* fade = player->fade_samples + num_channels * player->fade_start;
+  int i;
+  for (i = 0; i < fade_count * num_channels; ++i) {
+    output[i] += fade[i];
+  }
+  player->fade_start += fade_count;
+  player->fade_frames -= fade_count;
+
+  /* Publish sums of squares for the RMS. If the ring is full, the producer
+   * hasn't been calling TactileQueuePlayerGetRms(), so drop the record.
+   */
+  float* record = player->rms_record;
+  int c;
+  for (c = 0; c < num_channels; ++c) {
+    record[c] = 0.0f;
+  }
+  const float* src = output;
+  for (i = 0; i < num_frames; ++i, src += num_channels) {
+    for (c = 0; c < num_channels; ++c) {
+      record[c] += src[c] * src[c];
+    }
+  }
+  record[num_channels] = (float)num_frames;
+  SpscRingWrite(player->rms_records, record, 1);
+
+  return num_played;
+}
+
+void TactileQueuePlayerGetRms(TactileQueuePlayer* player, float* rms) {
+  const int num_channels = player->num_channels;
+  float* record = player->rms_read_record;
+  float count = 0.0f;
+  int c;
+  for (c = 0; c < num_channels; ++c) {
+    rms[c] = 0.0f;
+  }
+
+  while (SpscRingRead(player->rms_records, record, 1)) {
+    for (c = 0; c < num_channels; ++c) {
+      rms[c] += record[c];  /* Aggregate sum of squares. */
+    }
+    count += record[num_channels];
+  }
+
+  if (count > 0.0f) {
+    for (c = 0; c < num_channels; ++c) {
+      rms[c] = sqrt(rms[c] / count);  /* Convert sum of squares to RMS. */
+    }
+  }
+}
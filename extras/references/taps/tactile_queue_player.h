@@ -0,0 +1,103 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * Lock-free queued playback of tactile signals.
+ *
+ * TactileQueuePlayer is like TactilePlayer, but the audio callback never takes
+ * a lock, and signals may be queued to play back to back without gaps, e.g. a
+ * rapid sequence of phoneme codes. There is one producer thread (e.g. the UI)
+ * that enqueues signals, and one consumer thread (the audio callback) that
+ * plays them.
+ *
+ * Sample storage is preallocated as `num_slots` slots of `slot_frames` frames
+ * each. Enqueuing copies samples into free slots, splitting long signals over
+ * several slots, and passes the slots to the callback through an SpscRing.
+ * The callback returns slots through a second SpscRing once played, so neither
+ * thread allocates, frees, or blocks after TactileQueuePlayerMake().
+ *
+ * Example use:
+ *
+ *   TactileQueuePlayer* player = TactileQueuePlayerMake(
+ *       num_channels, sample_rate_hz, num_slots, slot_frames);
+ *
+ *   // In the portaudio stream callback.
+ *   TactileQueuePlayerFillBuffer(player, frames_per_buffer, output_buffer);
+ *
+ *   // In the main thread, play a signal, interrupting what is playing.
+ *   int num_queued = TactileQueuePlayerEnqueue(player, samples, num_frames, 1);
+ *   // Queue more to play gaplessly after it. Samples that didn't fit may be
+ *   // enqueued later, once the callback has freed some slots.
+ *   num_queued += TactileQueuePlayerEnqueue(
+ *       player, samples + num_channels * num_queued, num_frames - num_queued,
+ *       0);
+ *
+ * NOTE: This library requires C11 (-std=c11) for <stdatomic.h>.
+ */
+
+#ifndef AUDIO_TO_TACTILE_EXTRAS_REFERENCES_TAPS_TACTILE_QUEUE_PLAYER_H_
+#define AUDIO_TO_TACTILE_EXTRAS_REFERENCES_TAPS_TACTILE_QUEUE_PLAYER_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct TactileQueuePlayer;
+typedef struct TactileQueuePlayer TactileQueuePlayer;
+
+/* Allocates and returns a TactileQueuePlayer with storage for `num_slots`
+ * slots of `slot_frames` frames, or NULL on failure. The caller should free it
+ * when done with TactileQueuePlayerFree.
+ */
+TactileQueuePlayer* TactileQueuePlayerMake(int num_channels,
+                                           float sample_rate_hz,
+                                           int num_slots, int slot_frames);
+
+/* Frees a TactileQueuePlayer. */
+void TactileQueuePlayerFree(TactileQueuePlayer* player);
+
+/* Producer: Copies up to `num_frames` frames of `samples` (interleaved, with
+ * `num_channels` channels) to the back of the queue. Returns the number of
+ * frames enqueued, which is less than `num_frames` if free slots ran out.
+ *
+ * If `interrupt` is nonzero, the callback drops everything playing or queued
+ * before this signal, fading out the current signal over 5 ms to avoid clicks,
+ * as TactilePlayerPlay does. Otherwise the signal plays gaplessly after what is
+ * already queued.
+ */
+int TactileQueuePlayerEnqueue(TactileQueuePlayer* player, const float* samples,
+                              int num_frames, int /*bool*/ interrupt);
+
+/* Producer: Gets the number of frames that may currently be enqueued. */
+int TactileQueuePlayerNumFreeFrames(TactileQueuePlayer* player);
+
+/* Consumer: Fills `output` with `num_frames` frames of queued signals, zero
+ * filling once the queue runs empty. Returns the number of frames of queued
+ * signal written, i.e. a return value less than num_frames means playback has
+ * ended. This function is lock free and suitable for the audio callback.
+ */
+int TactileQueuePlayerFillBuffer(TactileQueuePlayer* player, int num_frames,
+                                 float* output);
+
+/* Producer: For tactor activity displays, gets the root-mean-squared (RMS)
+ * value of each channel over the output filled since the previous call, or
+ * zeros if there was none. RMS values are written to `rms`, an array of size
+ * `num_channels`.
+ */
+void TactileQueuePlayerGetRms(TactileQueuePlayer* player, float* rms);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+#endif /* AUDIO_TO_TACTILE_EXTRAS_REFERENCES_TAPS_TACTILE_QUEUE_PLAYER_H_ */
@@ -0,0 +1,300 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "extras/references/taps/tactile_queue_player.h"
+
+#include <math.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "src/dsp/logging.h"
+
+/* Test signal value for frame `i` and channel `c`. */
+static float Ramp(int i, int c) { return i + 0.1f * c; }
+
+static float* MakeRamp(int start, int num_frames, int num_channels) {
+  float* samples = (float*)CHECK_NOTNULL(
+      malloc(num_frames * num_channels * sizeof(float)));
+  int i;
+  for (i = 0; i < num_frames; ++i) {
+    int c;
+    for (c = 0; c < num_channels; ++c) {
+      samples[num_channels * i + c] = Ramp(start + i, c);
+    }
+  }
+  return samples;
+}
+
+/* Signals queued without interrupting play back to back without gaps. */
+static void TestGaplessQueue(void) {
+  puts("TestGaplessQueue");
+  const int kNumChannels = 3;
+  const int kSlotFrames = 16;
+  const int kBufferFrames = 7;
+  /* Signals of various lengths, some spanning several slots. */
+  const int kSignalFrames[] = {5, 16, 40, 1, 23};
+  const int kNumSignals = 5;
+  int total_frames = 0;
+  int k;
+  for (k = 0; k < kNumSignals; ++k) {
+    total_frames += kSignalFrames[k];
+  }
+
+  TactileQueuePlayer* player = CHECK_NOTNULL(
+      TactileQueuePlayerMake(kNumChannels, 8000.0f, 8, kSlotFrames));
+  CHECK(TactileQueuePlayerNumFreeFrames(player) == 8 * kSlotFrames);
+
+  int start = 0;
+  for (k = 0; k < kNumSignals; ++k) {
+    float* samples = MakeRamp(start, kSignalFrames[k], kNumChannels);
+    CHECK(TactileQueuePlayerEnqueue(player, samples, kSignalFrames[k], 0) ==
+          kSignalFrames[k]);
+    free(samples);
+    start += kSignalFrames[k];
+  }
+
+  float buffer[kBufferFrames * kNumChannels];
+  int i = 0;
+  while (i < total_frames) {
+    const int num_played =
+        TactileQueuePlayerFillBuffer(player, kBufferFrames, buffer);
+    const int expected_played = (total_frames - i < kBufferFrames)
+        ? total_frames - i : kBufferFrames;
+    CHECK(num_played == expected_played);
+    int j;
+    for (j = 0; j < kBufferFrames; ++j, ++i) {
+      int c;
+      for (c = 0; c < kNumChannels; ++c) {
+        CHECK(buffer[kNumChannels * j + c] ==
+              ((i < total_frames) ? Ramp(i, c) : 0.0f));
+      }
+    }
+  }
+
+  /* All slots have been returned. */
+  CHECK(TactileQueuePlayerFillBuffer(player, kBufferFrames, buffer) == 0);
+  CHECK(TactileQueuePlayerNumFreeFrames(player) == 8 * kSlotFrames);
+  TactileQueuePlayerFree(player);
+}
+
+/* Enqueue is limited by free slots, which are recycled once played. */
+static void TestSlotsRunOut(void) {
+  puts("TestSlotsRunOut");
+  const int kNumChannels = 2;
+  const int kSlotFrames = 10;
+  const int kNumFrames = 100;
+  TactileQueuePlayer* player = CHECK_NOTNULL(
+      TactileQueuePlayerMake(kNumChannels, 8000.0f, 4, kSlotFrames));
+  float* samples = MakeRamp(0, kNumFrames, kNumChannels);
+
+  int num_queued = TactileQueuePlayerEnqueue(player, samples, kNumFrames, 1);
+  CHECK(num_queued == 4 * kSlotFrames);
+  CHECK(TactileQueuePlayerNumFreeFrames(player) == 0);
+
+  float buffer[25 * 2];
+  int i = 0;
+  while (i < kNumFrames) {
+    CHECK(TactileQueuePlayerFillBuffer(player, 25, buffer) == 25);
+    int j;
+    for (j = 0; j < 25 * kNumChannels; ++j) {
+      CHECK(buffer[j] == samples[kNumChannels * i + j]);
+    }
+    i += 25;
+    /* Top up the queue, as the UI thread does on each tick. */
+    num_queued += TactileQueuePlayerEnqueue(
+        player, samples + kNumChannels * num_queued, kNumFrames - num_queued,
+        0);
+  }
+  CHECK(num_queued == kNumFrames);
+
+  free(samples);
+  TactileQueuePlayerFree(player);
+}
+
+static float SignalA(int c, float t) { return sin((15 + c) * 1000 * t); }
+static float SignalB(int c, float t) { return sin((5 + c) * 1000 * t); }
+
+/* Interrupting drops queued signals and fades out the playing one. */
+static void TestInterrupt(void) {
+  puts("TestInterrupt");
+  const int kNumChannels = 4;
+  const float kSampleRateHz = 8000.0f;
+  const int kBufferFrames = 64;
+  const int kTotalFrames = 140;
+  const float kFadeOutDuration = 0.005f;
+
+  TactileQueuePlayer* player = CHECK_NOTNULL(
+      TactileQueuePlayerMake(kNumChannels, kSampleRateHz, 16, 32));
+  float* samples_a = (float*)CHECK_NOTNULL(
+      malloc(kTotalFrames * kNumChannels * sizeof(float)));
+  float* samples_b = (float*)CHECK_NOTNULL(
+      malloc(kTotalFrames * kNumChannels * sizeof(float)));
+  int i;
+  int c;
+  for (i = 0; i < kTotalFrames; ++i) {
+    const float t = i / kSampleRateHz;
+    for (c = 0; c < kNumChannels; ++c) {
+      samples_a[kNumChannels * i + c] = SignalA(c, t);
+      samples_b[kNumChannels * i + c] = SignalB(c, t);
+    }
+  }
+
+  /* Queue signal A twice and play the first kBufferFrames frames. */
+  float buffer[64 * 4];
+  CHECK(TactileQueuePlayerEnqueue(player, samples_a, kTotalFrames, 1) ==
+        kTotalFrames);
+  CHECK(TactileQueuePlayerEnqueue(player, samples_a, kTotalFrames, 0) ==
+        kTotalFrames);
+  CHECK(TactileQueuePlayerFillBuffer(player, kBufferFrames, buffer) ==
+        kBufferFrames);
+  CHECK(memcmp(buffer, samples_a,
+               kBufferFrames * kNumChannels * sizeof(float)) == 0);
+
+  /* Interrupt with signal B. */
+  CHECK(TactileQueuePlayerEnqueue(player, samples_b, kTotalFrames, 1) ==
+        kTotalFrames);
+  CHECK(TactileQueuePlayerFillBuffer(player, kBufferFrames, buffer) ==
+        kBufferFrames);
+
+  const float offset_a = kBufferFrames / kSampleRateHz;
+  for (i = 0; i < kBufferFrames; ++i) {
+    const float t = i / kSampleRateHz;
+    float fade_weight = 1.0f - (t + 0.5f / kSampleRateHz) / kFadeOutDuration;
+    if (fade_weight < 0.0f) {
+      fade_weight = 0.0f;
+    }
+
+    for (c = 0; c < kNumChannels; ++c) {
+      const float expected =
+          SignalB(c, t) + fade_weight * SignalA(c, t + offset_a);
+      CHECK(fabs(buffer[kNumChannels * i + c] - expected) <= 2e-5f);
+    }
+  }
+
+  /* Only the rest of signal B plays, not the second signal A. */
+  CHECK(TactileQueuePlayerFillBuffer(player, kBufferFrames, buffer) ==
+        kBufferFrames);
+  CHECK(memcmp(buffer, samples_b + kBufferFrames * kNumChannels,
+               kBufferFrames * kNumChannels * sizeof(float)) == 0);
+  CHECK(TactileQueuePlayerFillBuffer(player, kBufferFrames, buffer) ==
+        kTotalFrames - 2 * kBufferFrames);
+  CHECK(TactileQueuePlayerFillBuffer(player, kBufferFrames, buffer) == 0);
+  CHECK(TactileQueuePlayerNumFreeFrames(player) == 16 * 32);
+
+  free(samples_b);
+  free(samples_a);
+  TactileQueuePlayerFree(player);
+}
+
+static void TestGetRms(void) {
+  puts("TestGetRms");
+  const int kNumChannels = 2;
+  TactileQueuePlayer* player = CHECK_NOTNULL(
+      TactileQueuePlayerMake(kNumChannels, 16000.0f, 4, 100));
+  float rms[2];
+  /* No output yet. */
+  TactileQueuePlayerGetRms(player, rms);
+  CHECK(rms[0] == 0.0f && rms[1] == 0.0f);
+
+  float samples[2 * 40];
+  int i;
+  for (i = 0; i < 40; ++i) {
+    samples[2 * i + 0] = (i % 2) ? 0.5f : -0.5f;
+    samples[2 * i + 1] = 0.25f;
+  }
+  CHECK(TactileQueuePlayerEnqueue(player, samples, 40, 0) == 40);
+
+  /* RMS is over all output since the last call, including silence. */
+  float buffer[2 * 20];
+  CHECK(TactileQueuePlayerFillBuffer(player, 20, buffer) == 20);
+  CHECK(TactileQueuePlayerFillBuffer(player, 20, buffer) == 20);
+  TactileQueuePlayerGetRms(player, rms);
+  CHECK(fabs(rms[0] - 0.5f) <= 1e-6f);
+  CHECK(fabs(rms[1] - 0.25f) <= 1e-6f);
+
+  CHECK(TactileQueuePlayerEnqueue(player, samples, 10, 0) == 10);
+  CHECK(TactileQueuePlayerFillBuffer(player, 20, buffer) == 10);
+  TactileQueuePlayerGetRms(player, rms);
+  CHECK(fabs(rms[0] - 0.5f * sqrt(0.5)) <= 1e-6f);
+  CHECK(fabs(rms[1] - 0.25f * sqrt(0.5)) <= 1e-6f);
+
+  TactileQueuePlayerFree(player);
+}
+
+typedef struct {
+  TactileQueuePlayer* player;
+  const float* samples;
+  int num_frames;
+} ProducerArgs;
+
+static void* ProducerThread(void* arg) {
+  ProducerArgs* args = (ProducerArgs*)arg;
+  int num_queued = 0;
+  while (num_queued < args->num_frames) {
+    /* Enqueue in short pieces like a sequence of phonemes. */
+    int count = 1 + rand() % 50;
+    if (count > args->num_frames - num_queued) {
+      count = args->num_frames - num_queued;
+    }
+    num_queued += TactileQueuePlayerEnqueue(
+        args->player, args->samples + num_queued, count, 0);
+  }
+  return NULL;
+}
+
+/* Concurrent producer and consumer, checking that output is gapless and in
+ * order once playback starts.
+ */
+static void TestThreaded(void) {
+  puts("TestThreaded");
+  const int kNumFrames = 200000;
+  TactileQueuePlayer* player =
+      CHECK_NOTNULL(TactileQueuePlayerMake(1, 8000.0f, 16, 64));
+  float* samples = MakeRamp(1, kNumFrames, 1);
+  ProducerArgs args = {player, samples, kNumFrames};
+  pthread_t thread;
+  CHECK(pthread_create(&thread, NULL, ProducerThread, &args) == 0);
+
+  float buffer[37];
+  int next = 1;
+  while (next <= kNumFrames) {
+    const int num_played = TactileQueuePlayerFillBuffer(player, 37, buffer);
+    int i;
+    for (i = 0; i < 37; ++i) {
+      if (i < num_played) {
+        CHECK(buffer[i] == Ramp(next++, 0));
+      } else {
+        CHECK(buffer[i] == 0.0f);
+      }
+    }
+  }
+
+  CHECK(pthread_join(thread, NULL) == 0);
+  free(samples);
+  TactileQueuePlayerFree(player);
+}
+
+int main(int argc, char** argv) {
+  srand(0);
+  TestGaplessQueue();
+  TestSlotsRunOut();
+  TestInterrupt();
+  TestGetRms();
+  TestThreaded();
+
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
@@ -89,7 +89,8 @@ static int PortaudioStreamCallback(const void* input_buffer,
   float* output = (float*)output_buffer;
   TactophoneEngine* engine = (TactophoneEngine*)user_data;
 
-  TactilePlayerFillBuffer(engine->tactile_player, frames_per_buffer, output);
+  TactileQueuePlayerFillBuffer(engine->tactile_player, frames_per_buffer,
+                               output);
   return (engine->keep_running) ? paContinue : paComplete;
 }
 
@@ -33,25 +33,48 @@ const int kSampleRateHz = 44100;
 const float kPhonemeSpacingInSeconds = 0.05f;
 /* Duration of a game clock tick in milliseconds. */
 const int kMillisecondsPerClockTick = 50;
+/* Tactile player storage, 64 slots of 2048 frames, or about 3 s at 44.1 kHz.
+ * PlayTactileSignal() enqueues as much as fits, and the rest of the signal is
+ * enqueued on later clock ticks as slots are played.
+ */
+#define kPlayerNumSlots 64
+#define kPlayerSlotFrames 2048
 /* Buttons to use for selecting menu choices. */
 const char* kMenuButtons = "123456789ABCDEFGHIJKLMNOP";
 
 void TactophoneEngineInit(TactophoneEngine* engine) {
   memset(engine, 0, sizeof(TactophoneEngine));
   engine->keep_running = 1;
-  engine->tactile_player =
-      CHECK_NOTNULL(TactilePlayerMake(kNumChannels, kSampleRateHz));
+  engine->tactile_player = CHECK_NOTNULL(TactileQueuePlayerMake(
+      kNumChannels, kSampleRateHz, kPlayerNumSlots, kPlayerSlotFrames));
 }
 
 void TactophoneEngineFree(TactophoneEngine* engine) {
   TactophoneFreeLessonSet(engine->lesson_set);
-  TactilePlayerFree(engine->tactile_player);
+  TactileQueuePlayerFree(engine->tactile_player);
+  free(engine->pending_samples);
   if (engine->log_file != NULL) {
     fclose(engine->log_file);
   }
 }
 
+/* Enqueues as much of the pending tactile signal as the player has room for. */
+static void EnqueuePendingSamples(TactophoneEngine* engine) {
+  if (engine->pending_samples == NULL) { return; }
+  const int num_channels = engine->channel_map.num_output_channels;
+  engine->pending_frame += TactileQueuePlayerEnqueue(
+      engine->tactile_player,
+      engine->pending_samples + num_channels * engine->pending_frame,
+      engine->pending_num_frames - engine->pending_frame, 0);
+  if (engine->pending_frame == engine->pending_num_frames) {
+    free(engine->pending_samples);
+    engine->pending_samples = NULL;
+  }
+}
+
 int TactophoneEngineRun(TactophoneEngine* engine, int key_press) {
+  EnqueuePendingSamples(engine);
+
   if (key_press != -1) {  /* Handle keyboard button press. */
     if (0 <= key_press && key_press < 255) { key_press = toupper(key_press); }
     engine->state->on_key_press(engine, key_press);
@@ -246,7 +269,13 @@ static void PlayTactileSignal(TactophoneEngine* engine, float* samples,
   ChannelMapApply(&engine->channel_map, samples, num_frames, mapped_samples);
   free(samples);
 
-  TactilePlayerPlay(engine->tactile_player, mapped_samples, num_frames);
+  /* Interrupt what is playing with the new signal. */
+  free(engine->pending_samples);
+  engine->pending_samples = mapped_samples;
+  engine->pending_num_frames = num_frames;
+  engine->pending_frame = TactileQueuePlayerEnqueue(
+      engine->tactile_player, mapped_samples, num_frames, 1);
+  EnqueuePendingSamples(engine);
 }
 
 void TactophonePlayPhonemes(TactophoneEngine* engine, const char* phonemes) {
@@ -272,8 +301,7 @@ void TactophonePlayWinBuzz(TactophoneEngine* engine) {
 
 void TactophoneVisualizeTactors(TactophoneEngine* engine, int y, int x) {
   float rms[kNumChannels];
-  TactilePlayerGetRms(engine->tactile_player,
-                      0.001f * kMillisecondsPerClockTick, rms);
+  TactileQueuePlayerGetRms(engine->tactile_player, rms);
 
   /* Consider a tactor "active" if its current RMS value is above 1e-4. */
   int active[kNumChannels];
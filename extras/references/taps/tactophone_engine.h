@@ -22,7 +22,7 @@
 #include <stdio.h>
 #include <string.h>
 
-#include "extras/references/taps/tactile_player.h"
+#include "extras/references/taps/tactile_queue_player.h"
 #include "extras/references/taps/tactophone_lesson.h"
 #include "extras/tools/channel_map_tui.h"
 #include "extras/tools/util.h"
@@ -73,7 +73,13 @@ struct TactophoneEngine {
   /* Tactile output. */
   PaStream* portaudio_stream;
   ChannelMap channel_map;
-  TactilePlayer* tactile_player;
+  TactileQueuePlayer* tactile_player;
+  /* Tactile signal of `pending_num_frames` frames being enqueued to the player,
+   * of which frames before `pending_frame` have been enqueued, or NULL.
+   */
+  float* pending_samples;
+  int pending_num_frames;
+  int pending_frame;
 
   /* Logging. */
   FILE* log_file;
@@ -21,6 +21,9 @@
 
 #include "src/dsp/butterworth.h"
 
+/* Max number of frames per block in Yuan2005BatchProcessSamples(). */
+#define kBatchBlockFrames 64
+
 void Yuan2005SetDefaultParams(Yuan2005Params* params) {
   if (params) {
     params->sample_rate_hz = 16000.0f;
@@ -131,3 +134,110 @@ void Yuan2005ProcessSamples(Yuan2005State* state,
   OneChannelProcessSamples(
       &state->high_channel, input, num_samples, output + 1);
 }
+
+Yuan2005Batch* Yuan2005BatchMake(const Yuan2005Params* params,
+                                 int num_streams) {
+  if (num_streams <= 0) {
+    fprintf(stderr, "Yuan2005BatchMake: num_streams must be positive.\n");
+    return NULL;
+  }
+  Yuan2005Batch* batch = (Yuan2005Batch*)malloc(sizeof(Yuan2005Batch));
+  if (batch == NULL) { return NULL; }
+  BiquadFilterState* states =
+      (BiquadFilterState*)malloc(4 * num_streams * sizeof(BiquadFilterState));
+  batch->workspace =
+      (float*)malloc(kBatchBlockFrames * num_streams * sizeof(float));
+  if (states == NULL || batch->workspace == NULL ||
+      !Yuan2005Init(&batch->shared, params)) {
+    free(batch->workspace);
+    free(states);
+    free(batch);
+    return NULL;
+  }
+
+  batch->num_streams = num_streams;
+  int c;
+  for (c = 0; c < 2; ++c) {
+    batch->band_biquad_state[c] = states + (2 * c) * num_streams;
+    batch->envelope_biquad_state[c] = states + (2 * c + 1) * num_streams;
+  }
+  int i;
+  for (i = 0; i < 4 * num_streams; ++i) {
+    BiquadFilterInitZero(&states[i]);
+  }
+  return batch;
+}
+
+void Yuan2005BatchFree(Yuan2005Batch* batch) {
+  if (batch != NULL) {
+    free(batch->workspace);
+    free(batch->band_biquad_state[0]);  /* Frees all states. */
+  }
+  free(batch);
+}
+
+/* Processes one block for output channel `c` of every stream. */
+static void BatchChannelProcessBlock(Yuan2005Batch* batch, int c,
+                                     const float* input,
+                                     int num_frames,
+                                     float* output) {
+  const int num_streams = batch->num_streams;
+  Yuan2005ChannelState* channel = (c == 0) ? &batch->shared.low_channel
+                                           : &batch->shared.high_channel;
+  const Yuan2005ChannelParams channel_params = channel->channel_params;
+  float* workspace = batch->workspace;
+
+  /* Apply band filter. */
+  BiquadFilterProcessInterleavedBlock(
+      &channel->band_biquad_coeffs, batch->band_biquad_state[c],
+      num_streams, input, num_frames, workspace);
+
+  /* Full-wave rectification. */
+  const int num_samples = num_frames * num_streams;
+  int i;
+  for (i = 0; i < num_samples; ++i) {
+    workspace[i] = fabs(workspace[i]);
+  }
+
+  /* Apply smoothing filter to the amplitude envelope. */
+  BiquadFilterProcessInterleavedBlock(
+      &channel->envelope_biquad_coeffs, batch->envelope_biquad_state[c],
+      num_streams, workspace, num_frames, workspace);
+
+  const float* src = workspace;
+  output += c;
+  for (i = 0; i < num_frames; ++i) {
+    /* The carrier is the same for all streams. */
+    const float carrier = PhasorRotatorSin(&channel->oscillator);
+    int s;
+    for (s = 0; s < num_streams; ++s) {
+      float sample = src[s];
+      if (sample > channel_params.denoising_threshold) {
+        /* Add the absolute detection threshold and modulate. */
+        sample = (sample + channel_params.sensory_offset) * carrier;
+      } else {
+        sample = 0.0f;
+      }
+      output[2 * s] = sample;
+    }
+    src += num_streams;
+    output += 2 * num_streams;
+    PhasorRotatorNext(&channel->oscillator);
+  }
+}
+
+void Yuan2005BatchProcessSamples(Yuan2005Batch* batch,
+                                 const float* input,
+                                 int num_frames,
+                                 float* output) {
+  const int num_streams = batch->num_streams;
+  while (num_frames > 0) {
+    int block_frames = num_frames;
+    if (block_frames > kBatchBlockFrames) { block_frames = kBatchBlockFrames; }
+    BatchChannelProcessBlock(batch, 0, input, block_frames, output);
+    BatchChannelProcessBlock(batch, 1, input, block_frames, output);
+    input += block_frames * num_streams;
+    output += 2 * block_frames * num_streams;
+    num_frames -= block_frames;
+  }
+}
@@ -24,6 +24,11 @@
  *
  * The method takes input audio and produces 2-channel tactile output, based on
  * filtering and extracting amplitude envelopes.
+ *
+ * `Yuan2005Batch` processes many independent streams in lockstep, e.g. for
+ * running the method over a large corpus. Streams are filtered four at a time
+ * with BiquadFilterProcessInterleavedBlock(), and results match
+ * Yuan2005ProcessSamples() exactly.
  */
 
 #ifndef AUDIO_TO_TACTILE_EXTRAS_REFERENCES_YUAN2005_YUAN2005_H_
@@ -83,6 +88,41 @@ void Yuan2005ProcessSamples(Yuan2005State* state,
                             int num_samples,
                             float* output);
 
+typedef struct {
+  /* Params, filter coefficients, and carrier oscillators, shared by all
+   * streams. The filter states in `shared` are unused.
+   */
+  Yuan2005State shared;
+  int num_streams;
+  /* Filter states for the low (index 0) and high (index 1) channels, each an
+   * array of `num_streams` elements.
+   */
+  BiquadFilterState* band_biquad_state[2];
+  BiquadFilterState* envelope_biquad_state[2];
+  /* Workspace for one block of all streams. */
+  float* workspace;
+} Yuan2005Batch;
+
+/* Makes a batch of `num_streams` processors, all with `params`. The caller
+ * should free it when done with Yuan2005BatchFree. Returns NULL on failure.
+ */
+Yuan2005Batch* Yuan2005BatchMake(const Yuan2005Params* params,
+                                 int num_streams);
+
+/* Frees a Yuan2005Batch. */
+void Yuan2005BatchFree(Yuan2005Batch* batch);
+
+/* Processes `num_frames` frames of interleaved input with `num_streams`
+ * channels, where channel s is the input audio of stream s. The number of
+ * output samples written is `2 * num_streams * num_frames`. Each output frame
+ * has the two output channels of stream 0, then of stream 1, and so on, such
+ * that channel `2 * s + c` is output channel c of stream s.
+ */
+void Yuan2005BatchProcessSamples(Yuan2005Batch* batch,
+                                 const float* input,
+                                 int num_frames,
+                                 float* output);
+
 #ifdef __cplusplus
 }  /* extern "C" */
 #endif
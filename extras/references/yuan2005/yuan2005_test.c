@@ -94,10 +94,64 @@ static void TestBasic(float sample_rate_hz) {
   free(input);
 }
 
+/* Yuan2005Batch matches Yuan2005ProcessSamples on each stream. */
+static void TestBatchMatchesSingle(int num_streams) {
+  printf("TestBatchMatchesSingle(%d)\n", num_streams);
+  srand(0);
+  const int kNumFrames = 1000;
+  float* input = (float*)CHECK_NOTNULL(
+      malloc(num_streams * kNumFrames * sizeof(float)));
+  float* output = (float*)CHECK_NOTNULL(
+      malloc(2 * num_streams * kNumFrames * sizeof(float)));
+  float* expected = (float*)CHECK_NOTNULL(
+      malloc(2 * kNumFrames * sizeof(float)));
+  float* stream_input = (float*)CHECK_NOTNULL(
+      malloc(kNumFrames * sizeof(float)));
+  int i;
+  for (i = 0; i < num_streams * kNumFrames; ++i) {
+    input[i] = 0.5f * ((float) rand() / RAND_MAX - 0.5f);
+  }
+
+  Yuan2005Params params;
+  Yuan2005SetDefaultParams(&params);
+  Yuan2005Batch* batch = CHECK_NOTNULL(Yuan2005BatchMake(&params, num_streams));
+  /* Process in blocks of varying size. */
+  int start;
+  int block_size;
+  for (start = 0; start < kNumFrames; start += block_size) {
+    block_size = 1 + rand() % 150;
+    if (block_size > kNumFrames - start) { block_size = kNumFrames - start; }
+    Yuan2005BatchProcessSamples(batch, input + num_streams * start, block_size,
+                                output + 2 * num_streams * start);
+  }
+
+  int s;
+  for (s = 0; s < num_streams; ++s) {
+    Yuan2005State state;
+    CHECK(Yuan2005Init(&state, &params));
+    for (i = 0; i < kNumFrames; ++i) {
+      stream_input[i] = input[num_streams * i + s];
+    }
+    Yuan2005ProcessSamples(&state, stream_input, kNumFrames, expected);
+    for (i = 0; i < kNumFrames; ++i) {
+      CHECK(output[2 * (num_streams * i + s)] == expected[2 * i]);
+      CHECK(output[2 * (num_streams * i + s) + 1] == expected[2 * i + 1]);
+    }
+  }
+
+  Yuan2005BatchFree(batch);
+  free(stream_input);
+  free(expected);
+  free(output);
+  free(input);
+}
+
 int main(int argc, char** argv) {
   TestBasic(16000.0f);
   TestBasic(44100.0f);
   TestBasic(48000.0f);
+  TestBatchMatchesSingle(1);
+  TestBatchMatchesSingle(7);
 
   puts("PASS");
   return EXIT_SUCCESS;
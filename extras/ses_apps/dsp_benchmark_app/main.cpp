@@ -0,0 +1,275 @@
+// Copyright 2022 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+// On-target microbenchmarks of the DSP kernels.
+//
+// The app was compiled using Segger Studio (SES) and runs on the puck or the
+// sleeve. Host benchmarks in extras/benchmark don't reflect the Cortex-M4F
+// flash wait states, instruction cache, and lack of SIMD, so this app runs
+// each kernel on synthetic input on the device and measures CPU cycles with the
+// DWT cycle counter (see tactile/profiler.h).
+//
+// Each kernel runs kNumWarmupRuns times untimed, to fill the cache and let
+// adaptive state settle, and then kNumRuns times timed. The report is printed
+// through the nRF log, which should be configured with the UART backend to go
+// over serial, as CSV lines:
+//
+//   dsp_benchmark,<build date>
+//   kernel,variant,runs,min_cycles,mean_cycles,max_cycles
+//   biquad,block64,64,1210,1214,1250
+//   ...
+//   done
+//
+// Interrupts stay enabled, so max_cycles may include interrupt handlers;
+// min_cycles is the most reproducible figure. Capture a report, e.g. with
+// `cat /dev/ttyACM0 > report.txt`, and compare reports between commits with
+// extras/tools/diff_benchmark_reports.py.
+//
+// NOTE: Build with the same optimization level as the firmware (-O2 in SES)
+// for representative numbers.
+
+#include <stdint.h>
+#include <stdlib.h>
+
+// nRF libraries.
+#include "nrf_delay.h"                 // NOLINT(build/include)
+#include "nrf_log.h"                   // NOLINT(build/include)
+#include "nrf_log_ctrl.h"              // NOLINT(build/include)
+#include "nrf_log_default_backends.h"  // NOLINT(build/include)
+
+#include "dsp/biquad_filter.h"         // NOLINT(build/include)
+#include "dsp/butterworth.h"           // NOLINT(build/include)
+#include "dsp/datestamp.h"             // NOLINT(build/include)
+#include "dsp/fft.h"                   // NOLINT(build/include)
+#include "dsp/q_resampler.h"           // NOLINT(build/include)
+#include "frontend/carl_frontend.h"    // NOLINT(build/include)
+#include "phonetics/classify_phoneme.h"  // NOLINT(build/include)
+#include "phonetics/embed_vowel.h"     // NOLINT(build/include)
+#include "tactile/enveloper.h"         // NOLINT(build/include)
+#include "tactile/post_processor.h"    // NOLINT(build/include)
+#include "tactile/profiler.h"          // NOLINT(build/include)
+
+namespace {
+
+constexpr int kNumWarmupRuns = 4;
+constexpr int kNumRuns = 64;
+
+// Block size of the mic input, as in the firmware.
+constexpr int kBlockSize = 64;
+constexpr float kSampleRateHz = 16000.0f;
+// Decimation factor to the tactile output rate.
+constexpr int kDecimationFactor = 8;
+constexpr int kNumTactors = 10;
+constexpr int kMaxFftSize = 1024;
+
+float g_input[kBlockSize * kNumTactors];
+float g_output[kBlockSize * kNumTactors];
+
+static void log_init(void) {
+  ret_code_t err_code = NRF_LOG_INIT(NULL);
+  APP_ERROR_CHECK(err_code);
+  NRF_LOG_DEFAULT_BACKENDS_INIT();
+}
+
+// Fills `x` with uniform random values in [lo, hi] from a fixed seed, so that
+// every report runs on the same input.
+void FillRandom(float* x, int size, float lo, float hi) {
+  static uint32_t seed = 1;
+  for (int i = 0; i < size; ++i) {
+    seed = seed * UINT32_C(1664525) + UINT32_C(1013904223);
+    x[i] = lo + (hi - lo) * static_cast<float>(seed >> 8) * (1.0f / (1 << 24));
+  }
+}
+
+// Runs `prepare` and then `run` kNumWarmupRuns + kNumRuns times, timing only
+// `run`, and prints one report line.
+template <typename Prepare, typename Run>
+void Benchmark(const char* kernel, const char* variant, Prepare prepare,
+               Run run) {
+  uint32_t min_cycles = UINT32_MAX;
+  uint32_t max_cycles = 0;
+  uint64_t sum_cycles = 0;
+  for (int i = 0; i < kNumWarmupRuns + kNumRuns; ++i) {
+    prepare();
+    const uint32_t start = ProfilerGetTicks();
+    run();
+    const uint32_t cycles = ProfilerGetTicks() - start;
+    if (i < kNumWarmupRuns) { continue; }
+    if (cycles < min_cycles) { min_cycles = cycles; }
+    if (cycles > max_cycles) { max_cycles = cycles; }
+    sum_cycles += cycles;
+  }
+
+  NRF_LOG_RAW_INFO("%s,%s,%d,%u,%u,%u\n", kernel, variant, kNumRuns,
+                   (unsigned)min_cycles, (unsigned)(sum_cycles / kNumRuns),
+                   (unsigned)max_cycles);
+  NRF_LOG_FLUSH();
+}
+
+void NoPrepare() {}
+
+void BenchmarkBiquad() {
+  BiquadFilterCoeffs coeffs;
+  DesignButterworthOrder2Lowpass(1000.0, kSampleRateHz, &coeffs);
+  BiquadFilterState state[kNumTactors];
+  for (int c = 0; c < kNumTactors; ++c) { BiquadFilterInitZero(&state[c]); }
+  FillRandom(g_input, kBlockSize * kNumTactors, -1.0f, 1.0f);
+
+  Benchmark("biquad", "block64", NoPrepare, [&] {
+    BiquadFilterProcessBlock(&coeffs, &state[0], g_input, kBlockSize,
+                             g_output);
+  });
+  Benchmark("biquad", "interleaved10x64", NoPrepare, [&] {
+    BiquadFilterProcessInterleavedBlock(&coeffs, state, kNumTactors, g_input,
+                                        kBlockSize, g_output);
+  });
+}
+
+void BenchmarkEnveloper() {
+  static Enveloper enveloper;
+  if (!EnveloperInit(&enveloper, &kDefaultEnveloperParams, kSampleRateHz,
+                     kDecimationFactor)) {
+    NRF_LOG_RAW_INFO("error,EnveloperInit\n");
+    return;
+  }
+  FillRandom(g_input, kBlockSize, -0.5f, 0.5f);
+
+  Benchmark("enveloper", "block64", NoPrepare, [&] {
+    EnveloperProcessSamples(&enveloper, g_input, kBlockSize, g_output);
+  });
+  Benchmark("enveloper", "channel_major64", NoPrepare, [&] {
+    EnveloperProcessSamplesChannelMajor(&enveloper, g_input, kBlockSize,
+                                        g_output);
+  });
+}
+
+void BenchmarkCarlFrontend() {
+  CarlFrontend* frontend = CarlFrontendMake(&kCarlFrontendDefaultParams);
+  if (frontend == nullptr) {
+    NRF_LOG_RAW_INFO("error,CarlFrontendMake\n");
+    return;
+  }
+  const int block_size = CarlFrontendBlockSize(frontend);
+
+  Benchmark("carl_frontend", "block64",
+            [&] { FillRandom(g_input, block_size, -0.5f, 0.5f); },
+            [&] { CarlFrontendProcessSamples(frontend, g_input, g_output); });
+  CarlFrontendFree(frontend);
+}
+
+void BenchmarkPhonetics() {
+  // CARL+PCEN frames are in [0, 1].
+  const int num_values = kClassifyPhonemeNumFrames *
+                         kClassifyPhonemeNumChannels;
+  float* frames = static_cast<float*>(malloc(num_values * sizeof(float)));
+  if (frames == nullptr) {
+    NRF_LOG_RAW_INFO("error,malloc\n");
+    return;
+  }
+  FillRandom(frames, num_values, 0.0f, 1.0f);
+
+  float coord[2];
+  Benchmark("embed_vowel", "float", NoPrepare,
+            [&] { EmbedVowel(frames, coord); });
+  Benchmark("embed_vowel", "f16", NoPrepare,
+            [&] { EmbedVowelF16(frames, coord); });
+
+  ClassifyPhonemeLabels labels;
+  ClassifyPhonemeScores scores;
+  Benchmark("classify_phoneme", "float", NoPrepare,
+            [&] { ClassifyPhoneme(frames, &labels, &scores); });
+  Benchmark("classify_phoneme", "int8", NoPrepare,
+            [&] { ClassifyPhonemeInt8(frames, &labels, &scores); });
+  Benchmark("classify_phoneme", "f16", NoPrepare,
+            [&] { ClassifyPhonemeF16(frames, &labels, &scores); });
+  free(frames);
+}
+
+void BenchmarkQResampler() {
+  // Resampling from the SAADC rate to the frontend rate, as on the sleeve.
+  QResampler* resampler = QResamplerMake(15625.0f, kSampleRateHz, 1,
+                                         kBlockSize, nullptr);
+  if (resampler == nullptr) {
+    NRF_LOG_RAW_INFO("error,QResamplerMake\n");
+    return;
+  }
+  FillRandom(g_input, kBlockSize, -0.5f, 0.5f);
+
+  Benchmark("q_resampler", "15625to16000x64", NoPrepare,
+            [&] { QResamplerProcessSamples(resampler, g_input, kBlockSize); });
+  QResamplerFree(resampler);
+}
+
+void BenchmarkPostProcessor() {
+  static PostProcessor post_processor;
+  PostProcessorParams params;
+  PostProcessorSetDefaultParams(&params);
+  params.cutoff_hz = 975.0f;  // As in PostProcessorWrapper.
+  if (!PostProcessorInit(&post_processor, &params,
+                         kSampleRateHz / kDecimationFactor, kNumTactors)) {
+    NRF_LOG_RAW_INFO("error,PostProcessorInit\n");
+    return;
+  }
+  constexpr int kNumFrames = kBlockSize / kDecimationFactor;
+
+  // Processing is in place, so refill the input before each run.
+  Benchmark("post_processor", "10x8",
+            [&] { FillRandom(g_output, kNumFrames * kNumTactors, 0.0f, 0.5f); },
+            [&] {
+              PostProcessorProcessSamples(&post_processor, g_output,
+                                          kNumFrames);
+            });
+}
+
+void BenchmarkFft() {
+  static ComplexFloat data[kMaxFftSize];
+  static const char* kVariants[] = {"64", "128", "256", "512", "1024"};
+  int variant = 0;
+  for (int size = 64; size <= kMaxFftSize; size *= 2, ++variant) {
+    // Transforms are in place, so refill the input before each run.
+    Benchmark("fft_forward", kVariants[variant],
+              [&] {
+                FillRandom(reinterpret_cast<float*>(data), 2 * size, -1.0f,
+                           1.0f);
+              },
+              [&] { FftForwardScrambledTransform(data, size); });
+  }
+}
+
+}  // namespace
+
+int main() {
+  log_init();
+  ProfilerEnableTicks();
+  // Let the host connect to the serial port.
+  nrf_delay_ms(2000);
+
+  NRF_LOG_RAW_INFO("dsp_benchmark,%u\n", (unsigned)DATESTAMP_UINT32);
+  NRF_LOG_RAW_INFO("kernel,variant,runs,min_cycles,mean_cycles,max_cycles\n");
+  NRF_LOG_FLUSH();
+
+  BenchmarkBiquad();
+  BenchmarkEnveloper();
+  BenchmarkCarlFrontend();
+  BenchmarkPhonetics();
+  BenchmarkQResampler();
+  BenchmarkPostProcessor();
+  BenchmarkFft();
+
+  NRF_LOG_RAW_INFO("done\n");
+  NRF_LOG_FLUSH();
+  while (1) {
+  }
+}
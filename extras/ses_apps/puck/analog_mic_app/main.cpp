@@ -83,7 +83,8 @@ int main() {
   PuckUi.Initialize();
   PuckUi.OnUiEventListener(touch_event);
 
-  // Initialize external analog microphone.
+  // Initialize external analog microphone, oversampled for higher SNR.
+  ExternalAnalogMic.SetOversampled(true);
   ExternalAnalogMic.Initialize();
   ExternalAnalogMic.OnAdcDataReady(adc_new_data);
 
@@ -25,7 +25,9 @@
 // The sleeve implements a state machine, controlled by the puck commands.
 // Either raw data from the analog microphone or tactor pwm values could be
 // sent. Also, the puck can send a command to disable/enable the audio
-// amplifiers.
+// amplifiers. When the sleeve is short of CPU headroom, the puck may instead
+// run the costly processing stages itself and send tactile features, which the
+// sleeve only maps to tactors (see tactile/processing_split.h).
 //
 // On the puck:
 // Pressing button 1 on the puck silences the amplifiers. Pressing button 2 will
@@ -81,7 +83,10 @@
 #include "look_up.h"
 #include "post_processor_cpp.h"
 #include "dsp/channel_map.h"
-#include "tactile/tactile_pattern.h"
+#include "tactile/deadline_monitor.h"
+#include "tactile/energy_meter.h"
+#include "tactile/processing_split.h"
+#include "tactile/tactile_pattern_cache.h"
 #include "tactile_processor_cpp.h"
 #include "two_wire.h"
 
@@ -120,12 +125,23 @@ static int16_t g_mic_audio_int16[kAdcDataSize];
 // Buffer of mic audio converted to floats in [-1, 1].
 static float g_mic_audio_float[kAdcDataSize];
 
+// Tactile features received from the puck when processing is split, see
+// tactile/processing_split.h.
+static uint8_t g_envelope_codes[kTactileFeaturesNumEnvelopeCodes];
+static uint8_t g_hex_codes[kTactileFeaturesNumHexCodes];
+
 static uint16_t pwm_rx[kNumPwmValues];
 
 // True when serial is streaming tactile playback.
 static bool g_streaming_tactile_playback = true;
 // True when serial is receiving mic audio (kLoadMicDataOpCode).
 static bool g_receiving_audio = false;
+// True when the puck runs the costly processing stages and sends features
+// (kTactileFeatures) rather than audio.
+static bool g_receiving_features = false;
+// Set by HandleMessage() when g_receiving_features changes, so that the task
+// restarts the deadline stats and processor state for the new split.
+static volatile bool g_split_changed = false;
 static bool g_led_initialized = false;
 
 // TactileProcessor, turns audio into tactile signals.
@@ -137,8 +153,22 @@ PostProcessorWrapper g_post_processor;
 // Channel to tactor mapping and final output gains.
 ChannelMap g_channel_map;
 
-// Tactile pattern synthesizer.
-TactilePattern g_tactile_pattern;
+// Tactile pattern synthesizer, with a cache of pre-rendered patterns so that
+// UI feedback patterns play as a copy rather than by synthesis.
+TactilePatternCache g_tactile_pattern;
+// Storage for g_tactile_pattern, 16 KB. Declared as uint16_t for alignment.
+static uint16_t g_tactile_pattern_storage[8192];
+
+// Counts buffers whose processing overruns the buffer period.
+DeadlineMonitor g_deadline_monitor;
+// Number of buffers between sending kDeadlineStats messages, about 1 second.
+const int kDeadlineStatsPeriodBuffers = 244;
+// Accounts the tactor drive power and CPU active time per minute, sent in
+// kEnergyStats messages.
+EnergyMeter g_energy_meter;
+// Period for sending LED changes. LED driver I2C transactions are then at most
+// 20 per second, however often tuning messages arrive.
+const int kLedUpdatePeriodMs = 50;
 
 // Pointer to the tactile output buffer of g_tactile_processor.
 static float* g_tactile_output;
@@ -191,11 +221,24 @@ void OnPwmSequenceEnd() {
 
 void HandleMessage(const Message& message) {
   switch (message.type()) {
-    case MessageType::kAudioSamples: {
+    case MessageType::kAudioSamples:
+    case MessageType::kTactileFeatures: {
+      const bool features =
+          (message.type() == MessageType::kTactileFeatures);
+      if (features) {
+        message.ReadTactileFeatures(
+            Slice<uint8_t, kTactileFeaturesNumEnvelopeCodes>(g_envelope_codes),
+            Slice<uint8_t, kTactileFeaturesNumHexCodes>(g_hex_codes));
+      } else {
+        message.ReadAudioSamples(
+            Slice<int16_t, kAdcDataSize>(g_mic_audio_int16));
+      }
+      if (features != g_receiving_features) {
+        g_receiving_features = features;
+        g_split_changed = true;
+      }
       g_receiving_audio = true;
       g_streaming_tactile_playback = false;
-      message.ReadAudioSamples(
-          Slice<int16_t, kAdcDataSize>(g_mic_audio_int16));
       // Unblock the audio processing task.
       BaseType_t xHigherPriorityTaskWoken;
       xHigherPriorityTaskWoken = pdFALSE;
@@ -230,6 +273,8 @@ void HandleMessage(const Message& message) {
     case MessageType::kTuning: {
       if (message.ReadTuning(&g_tuning_knobs)) {
         g_tactile_processor.ApplyTuning(g_tuning_knobs);
+        // Restart the deadline stats so they reflect the new tuning.
+        DeadlineMonitorReset(&g_deadline_monitor);
         if (!g_led_initialized) {
           LedArray.Initialize();
           g_led_initialized = true;
@@ -238,13 +283,13 @@ void HandleMessage(const Message& message) {
         LedArray.LedBar(g_tuning_knobs.values[kKnobOutputGain], 20);
 
         // Play "confirm" pattern as UI feedback when new settings are applied.
-        TactilePatternStart(&g_tactile_pattern, kTactilePatternConfirm);
+        TactilePatternCacheStart(&g_tactile_pattern, kTactilePatternConfirm);
       }
     } break;
     case MessageType::kTactilePattern: {
       char simple_pattern[kMaxTactilePatternLength + 1];
       if (message.ReadTactilePattern(simple_pattern)) {
-        TactilePatternStart(&g_tactile_pattern, simple_pattern);
+        TactilePatternCacheStart(&g_tactile_pattern, simple_pattern);
       }
     } break;
     case MessageType::kChannelMap:
@@ -257,8 +302,8 @@ void HandleMessage(const Message& message) {
       if (message.ReadChannelGainUpdate(&g_channel_map, test_channels,
                                         kTactileProcessorNumTactors,
                                         kTactileProcessorNumTactors)) {
-        TactilePatternStartCalibrationTones(&g_tactile_pattern,
-                                            test_channels[0], test_channels[1]);
+        TactilePatternCacheStartCalibrationTones(
+            &g_tactile_pattern, test_channels[0], test_channels[1]);
       }
     } break;
     case MessageType::kStreamDataStart:
@@ -276,6 +321,13 @@ void HandleMessage(const Message& message) {
         g_streaming_tactile_playback = true;
       }
       break;
+    case MessageType::kAllTactorsSamplesCompressed:
+      if (message.ReadAllTactorsSamplesCompressed(
+              Slice<uint8_t, kNumTotalPwm * kNumPwmValues>(
+                  g_all_tactor_streaming_buffer))) {
+        g_streaming_tactile_playback = true;
+      }
+      break;
     default:
       // Handle an unknown op code event.
       NRF_LOG_RAW_INFO("== UNKNOWN MESSAGE TYPE ==\n");
@@ -320,15 +372,34 @@ static void TactileProcessorTaskFun(void*) {
     // https://www.freertos.org/xTaskNotifyGive.html
     ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
 
+    if (g_split_changed) {
+      g_split_changed = false;
+      // Restart the deadline stats so that the puck's ProcessingSplitSelector
+      // sees the load of the new split. The processor state is stale if the
+      // puck ran the costly stages, so reset it.
+      DeadlineMonitorReset(&g_deadline_monitor);
+      g_tactile_processor.Reset();
+    }
+
+    DeadlineMonitorStartBuffer(&g_deadline_monitor);
     nrf_gpio_pin_write(kLedPinBlue, 1);
 
     // Play synthesized tactile pattern if either a pattern is active or if the
     // sleeve is not receiving audio, for instance because of a timeout error.
     // If the pattern isn't active, the pattern synthesizer produces silence.
-    if (!g_receiving_audio || TactilePatternIsActive(&g_tactile_pattern)) {
-      TactilePatternSynthesize(
+    if (!g_receiving_audio || TactilePatternCacheIsActive(&g_tactile_pattern)) {
+      TactilePatternCacheSynthesize(
           &g_tactile_pattern, g_tactile_processor.GetOutputBlockSize(),
           g_tactile_output);
+    } else if (g_receiving_features) {
+      // The puck ran the Enveloper and vowel embedding, so only map the
+      // features to tactor outputs.
+      float envelopes[kTactileFeaturesNumEnvelopeCodes];
+      float hex_weights[kTactileFeaturesNumHexCodes];
+      TactileFeaturesDecode(g_envelope_codes, kTactileFramesPerCarlBlock,
+                            g_hex_codes, envelopes, hex_weights);
+      g_tactile_output =
+          g_tactile_processor.ProcessFeatures(envelopes, hex_weights);
     } else {
       // Convert ADC values to floats. The raw ADC values can swing from -2048
       // to 2048, so we scale by that value.
@@ -341,8 +412,30 @@ static void TactileProcessorTaskFun(void*) {
     }
 
     g_post_processor.PostProcessSamples(g_tactile_output);
+    LedArray.Tick(xTaskGetTickCount() * portTICK_PERIOD_MS);
 
     nrf_gpio_pin_write(kLedPinBlue, 0);
+    DeadlineMonitorFinishBuffer(&g_deadline_monitor);
+    // Lower the tactile processing quality if the CPU can't keep up.
+    g_tactile_processor.UpdateLoad(
+        DeadlineMonitorLastLoad(&g_deadline_monitor));
+    EnergyMeterAddCpuTicks(&g_energy_meter, g_deadline_monitor.last_ticks);
+    SleeveTactors.MeterEnergy(&g_energy_meter);
+
+    // Periodically report energy and deadline stats, while receiving audio.
+    // (During tactile streaming, the serial TX is used in OnPwmSequenceEnd.)
+    if (g_receiving_audio && EnergyMeterMinuteCompleted(&g_energy_meter)) {
+      EnergyMeterStats stats;
+      EnergyMeterGetStats(&g_energy_meter, &stats);
+      SerialCom.tx_message().WriteEnergyStats(stats);
+      SerialCom.SendTxMessage();
+    } else if (g_receiving_audio &&
+        g_deadline_monitor.num_buffers % kDeadlineStatsPeriodBuffers == 0) {
+      DeadlineMonitorStats stats;
+      DeadlineMonitorGetStats(&g_deadline_monitor, &stats);
+      SerialCom.tx_message().WriteDeadlineStats(stats);
+      SerialCom.SendTxMessage();
+    }
   }
 }
 
@@ -384,11 +477,14 @@ int main() {
   LedArray.Initialize();
   LedArray.CycleAllLeds(1);
   LedArray.SetOneLed(1, 10);
+  // Send LED changes, like the output gain bar on tuning updates, at most
+  // every kLedUpdatePeriodMs from the tactile processing task.
+  LedArray.SetUpdatePeriod(kLedUpdatePeriodMs);
 
   // Initialize tactor driver.
   SleeveTactors.OnSequenceEnd(OnPwmSequenceEnd);
   SleeveTactors.Initialize();
-  SleeveTactors.SetUpsamplingFactor(kTactileDecimationFactor);
+  SleeveTactors.SetInterpolationFactor(kTactileDecimationFactor);
   SleeveTactors.StartPlayback();
 
   // Initialize temperature monitor.
@@ -398,6 +494,7 @@ int main() {
   // Initialize the tactile processor.
   g_tactile_processor.Init(kSaadcSampleRateHz, kCarlBlockSize,
                            kTactileDecimationFactor);
+  g_tactile_processor.EnableAdaptiveQuality(true);
 
   const float kDefaultGain = 4.0f;
   g_post_processor.Init(g_tactile_processor.GetOutputSampleRate(),
@@ -406,13 +503,29 @@ int main() {
                         kDefaultGain);
   ChannelMapInit(&g_channel_map, kTactileProcessorNumTactors);
 
-  TactilePatternInit(&g_tactile_pattern,
-                     g_tactile_processor.GetOutputSampleRate(),
-                     g_tactile_processor.GetOutputNumberTactileChannels());
+  TactilePatternCacheInit(
+      &g_tactile_pattern,
+      reinterpret_cast<uint8_t*>(g_tactile_pattern_storage),
+      sizeof(g_tactile_pattern_storage),
+      g_tactile_processor.GetOutputSampleRate(),
+      g_tactile_processor.GetOutputNumberTactileChannels());
+  // Pre-render the "confirm" pattern, which plays whenever settings change.
+  TactilePatternCacheCompileSimple(&g_tactile_pattern, kTactilePatternConfirm);
 
   NRF_LOG_RAW_INFO("== TACTILE PROCESSOR SETUP DONE ==\n");
   NRF_LOG_FLUSH();
 
+  // The processing budget is the buffer period, in CPU cycles.
+  DeadlineMonitorInit(&g_deadline_monitor,
+                      static_cast<uint32_t>(
+                          (static_cast<uint64_t>(SystemCoreClock) *
+                           kAdcDataSize) / kSaadcSampleRateHz));
+  // PWM values are updated kNumPwmValues at a time, once per buffer.
+  EnergyMeterInit(&g_energy_meter, kNumTotalPwm,
+                  static_cast<float>(kNumPwmValues) * kSaadcSampleRateHz /
+                      kAdcDataSize,
+                  SystemCoreClock);
+
   // Initialize serial port.
   SerialCom.InitSleeve(OnSerialEvent);
 
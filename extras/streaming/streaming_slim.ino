@@ -14,66 +14,65 @@
 //
 // App for streaming tactile data to the slim board.
 // This app takes the data from the USB from the pc and sends it to
-// actuators. Full 12-channel data is expected at 16 bit resolution and 2kHz.
+// actuators. Full 12-channel data is expected as 8-bit PWM samples at 2kHz,
+// for instance from extras/tools/stream_wav_to_usb.c.
 //
-// The slim board buffers kNumBufferedFrames of pwm data to avoid USB timing
-// issues. Double buffer is used to allow playback without gaps. Overall the
-// timing is as follows:
-// 1) Serial USB buffer is filled with kNumBufferedFrames
-// 2) When full serial buffer is copied into pending playback buffer.
-// 3) When PWM buffer of kNumBufferedFrames is done playing, it is filled from
-// pending playback buffer.
-// 4) When PWM buffer played kWhenToSendFrame frames, new USB
-// data is requested.
+// Data arrives in blocks of the usb_stream protocol (see
+// src/tactile/usb_stream.h), each a multiple of kPwmSamples frames. Blocks are
+// queued in kNumSlots slots of kUsbStreamMaxMessageBytes. The PWM sequence end
+// interrupt plays kPwmSamples frames at a time from the oldest slot, and when
+// a slot is finished, a Credit message tells the PC that it may send another
+// block. The PC keeps up to kNumSlots blocks in flight, so USB latency of up to
+// (kNumSlots - 1) blocks is absorbed without gaps.
 //
-// Note that PWM is always playing something, so if the buffer is not
-// replenished, it will replay old data.
-// To silence the tactors a buffer of zeros should be send.
+// If the queue runs empty, the tactors are silenced and an underrun is
+// counted, reported to the PC in Credit messages.
 
 #include "board_defs.h"
 #include "pwm_sleeve.h"
 #include "serial_com.h"
+#include "tactile/usb_stream.h"
 
 using namespace audio_tactile;
 
 constexpr int kNumChannels = 12;
 constexpr int kPwmSamples = 8;
-constexpr int kDataBytes = kNumChannels * kPwmSamples;
-constexpr int kHeaderBytes = 4;
-// Number of buffered pwm frames.
-constexpr int kNumBufferedFrames = 8;
-// The new data is send after playing kWhenToSendFrame frames.
-// There should enough time to fill the buffer to allow continous playback
-// On MacOS, each frame takes ~2 ms to transmit and ~4 ms to play.
-// To minimize latency kNumBufferedFrames can be decreased, depending on the USB
-// driver.
-// TODO: test on Linux and Windows OS.
-constexpr int kWhenToSendFrame = 3;
-constexpr int kSerialBufferSize = 2048;
-constexpr int kPendingPwmBufferSize =
-    kNumBufferedFrames * (kDataBytes + kHeaderBytes);
-
-static uint8_t g_serial_input_buffer[kSerialBufferSize];
-// Make sure that the serial buffer is large enough to hold kNumBufferedFrames.
-static_assert(sizeof(g_serial_input_buffer) >=
-                  ((kDataBytes + kHeaderBytes) * kNumBufferedFrames),
-              "g_serial_input_buffer is not large enough");
-
-static uint8_t g_pending_playback_pwm_buffer[kPendingPwmBufferSize];
-static uint8_t g_playback_pwm_buffer[kPendingPwmBufferSize];
-static int g_serial_counter = 0;
-static uint8_t g_received_tactile_frame[kDataBytes];
-volatile bool g_sequence_finished = false;
-volatile uint8_t g_which_pwm_module_triggered;
-static int g_frame_counter = 0;
+// Number of queued blocks.
+constexpr int kNumSlots = 8;
+// Period for sending a Credit message when no blocks are being consumed, so
+// that the PC learns the queue capacity after a Reset.
+constexpr uint32_t kCreditHeartbeatMs = 100;
+
+// Queue of received blocks. The main loop writes slots, and the PWM interrupt
+// reads them. Slot i is at index i % kNumSlots.
+static uint8_t g_slots[kNumSlots][kUsbStreamMaxPayloadBytes]
+    __attribute__((aligned(4)));
+static int g_slot_num_frames[kNumSlots];
+static volatile uint32_t g_num_written = 0;
+static volatile uint32_t g_num_consumed = 0;
+// Frame position in the slot being played.
+static int g_frame_position = 0;
+static volatile uint16_t g_num_underruns = 0;
+static bool g_playing = false;
+
+static UsbStreamParser g_parser;
+static uint16_t g_expected_sequence = 0;
+static uint16_t g_num_errors = 0;
+static uint32_t g_num_consumed_reported = 0;
+static uint32_t g_last_credit_ms = 0;
+static uint8_t g_silence[kNumChannels * kPwmSamples];
 
 void FlashLeds();
 void OnPwmSequenceEnd();
+void HandleMessage(const UsbStreamMessage& message);
+void SendCredit();
 
 void setup() {
   Serial.begin(1000000);
   nrf_gpio_cfg_output(kLedPinBlue);
   nrf_gpio_cfg_output(kLedPinGreen);
+  UsbStreamParserInit(&g_parser);
+  memset(g_silence, 128, sizeof(g_silence));
 
   // Initialize PWM.
   SleeveTactors.OnSequenceEnd(OnPwmSequenceEnd);
@@ -90,75 +89,103 @@ void setup() {
 }
 
 void loop() {
-  if (Serial.available()) {
-    // Save the received bytes into an array.
-    while (Serial.available()) {
-      // Get the new byte:
-      uint8_t c = Serial.read();
-      // Exit execution on a serial buffer overrun.
-      if (g_serial_counter >= kSerialBufferSize) {
-        Serial.println("Buffer overrun in serial communication");
-        // Force sleep.
-        for (;;) {
-          delay(1000);
-        }
-      }
-      g_serial_input_buffer[g_serial_counter] = c;
-      ++g_serial_counter;
-      nrf_gpio_pin_toggle(kLedPinBlue);
-    }
-
-    Serial.println(g_serial_counter);
-
-    // Copy the USB data into temp pwm buffer, and swap it once previous buffer
-    // is finished playing.
-    if (g_serial_counter ==
-        ((kDataBytes + kHeaderBytes) * kNumBufferedFrames)) {
-      memcpy(g_pending_playback_pwm_buffer, g_serial_input_buffer,
-             g_serial_counter);
-      g_serial_counter = 0;
-    } else {
-      // "buffer_copied" is sent to request new frame from the PC.
-      Serial.println("buffer_copied");
-      // Make sure that the "buffer_copied" is not send twice in loop().
-      return;
+  uint8_t chunk[256];
+  int size;
+  while ((size = Serial.available()) > 0) {
+    if (size > static_cast<int>(sizeof(chunk))) { size = sizeof(chunk); }
+    size = Serial.readBytes(chunk, size);
+    const uint8_t* data = chunk;
+    while (size > 0) {
+      UsbStreamMessage message;
+      const int consumed = UsbStreamParserFeed(&g_parser, data, size, &message);
+      data += consumed;
+      size -= consumed;
+      HandleMessage(message);
     }
+    nrf_gpio_pin_toggle(kLedPinBlue);
   }
 
-  // The "buffer_copied" here will trigger the first frame to be transmitted,
-  // when PWM interrupt asks for it.
-  // This will kickstart the USB-serial exchange with the PC in
-  // Serial.available()
-  if (g_sequence_finished) {
-    Serial.println("buffer_copied");
-    g_sequence_finished = false;
+  // Grant credit when blocks finished playing, or periodically as heartbeat.
+  if (g_num_consumed != g_num_consumed_reported ||
+      millis() - g_last_credit_ms >= kCreditHeartbeatMs) {
+    SendCredit();
   }
 }
 
-void OnPwmSequenceEnd() {
-  g_which_pwm_module_triggered = SleeveTactors.GetEvent();
-
-  if (g_which_pwm_module_triggered == 0) {
-    int mem_offset =
-        kHeaderBytes +
-        (g_frame_counter * (kNumChannels * kPwmSamples + kHeaderBytes));
-    memcpy(g_received_tactile_frame, g_playback_pwm_buffer + mem_offset,
-           (kNumChannels * kPwmSamples));
+void HandleMessage(const UsbStreamMessage& message) {
+  switch (message.type) {
+    case kUsbStreamReset:
+      // Drop queued blocks. The interrupt only reads slots while
+      // g_num_consumed != g_num_written, so setting both stops playback.
+      noInterrupts();
+      g_num_written = 0;
+      g_num_consumed = 0;
+      g_frame_position = 0;
+      g_num_underruns = 0;
+      g_playing = false;
+      interrupts();
+      g_expected_sequence = 0;
+      g_num_errors = 0;
+      SendCredit();
+      break;
+
+    case kUsbStreamData: {
+      const bool valid = message.num_channels == kNumChannels &&
+                         message.num_frames % kPwmSamples == 0 &&
+                         message.sequence == g_expected_sequence &&
+                         g_num_written - g_num_consumed < kNumSlots;
+      g_expected_sequence = message.sequence + 1;
+      if (!valid) {
+        if (g_num_errors < UINT16_MAX) { ++g_num_errors; }
+        return;
+      }
+      const int slot = g_num_written % kNumSlots;
+      memcpy(g_slots[slot], message.payload, message.payload_size);
+      g_slot_num_frames[slot] = message.num_frames;
+      // Compiler barrier so that the slot is written before it is published.
+      __asm__ volatile("" ::: "memory");
+      ++g_num_written;
+    } break;
+
+    default:
+      break;
+  }
+}
 
-    SleeveTactors.UpdatePwmAllChannelsByte(g_received_tactile_frame);
+void SendCredit() {
+  UsbStreamCredit credit;
+  credit.num_consumed = g_num_consumed;
+  credit.capacity = kNumSlots;
+  credit.num_underruns = g_num_underruns;
+  credit.num_errors = g_num_errors;
+  uint8_t message[kUsbStreamHeaderBytes + kUsbStreamCreditPayloadBytes];
+  Serial.write(message, UsbStreamEncodeCredit(&credit, message));
+  g_num_consumed_reported = credit.num_consumed;
+  g_last_credit_ms = millis();
+}
 
-    // Trigger the request for new data after playing kWhenToSendFrame frames.
-    if (g_frame_counter == kWhenToSendFrame) {
-      g_sequence_finished = true;
+void OnPwmSequenceEnd() {
+  if (SleeveTactors.GetEvent() != 0) { return; }
+
+  if (g_num_consumed == g_num_written) {
+    // Queue is empty. Silence the tactors, counting an underrun if this
+    // interrupts playback.
+    if (g_playing) {
+      SleeveTactors.UpdatePwmAllChannelsByte(g_silence);
+      if (g_num_underruns < UINT16_MAX) { ++g_num_underruns; }
+      g_playing = false;
     }
-    ++g_frame_counter;
+    return;
+  }
 
-    // When the last frame is played swap the PWM buffer with new serial data.
-    if (g_frame_counter >= kNumBufferedFrames) {
-      g_frame_counter = 0;
-      memcpy(g_playback_pwm_buffer, g_pending_playback_pwm_buffer,
-             (kDataBytes + kHeaderBytes) * kNumBufferedFrames);
-    }
+  g_playing = true;
+  const int slot = g_num_consumed % kNumSlots;
+  SleeveTactors.UpdatePwmAllChannelsByte(
+      g_slots[slot] + g_frame_position * kNumChannels);
+  g_frame_position += kPwmSamples;
+  if (g_frame_position >= g_slot_num_frames[slot]) {
+    g_frame_position = 0;
+    ++g_num_consumed;  // Free the slot.
   }
 }
 
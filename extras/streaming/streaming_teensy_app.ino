@@ -12,128 +12,143 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 //
-//
 // Teensy 4.0 app for streaming tactile data to the sleeve.
-// This app takes the data from the USB data from the pc and sends it to sleeve.
-// Syncronization is done between the Teensy and the sleeve so serial data to
-// prevent gaps in playback. Teensy does not need to buffer the data as full
-// speed usb is fast enough.
+// This app takes the data from the USB from the pc and sends it to the sleeve.
+// Data arrives in blocks of the usb_stream protocol (see
+// src/tactile/usb_stream.h), for instance from
+// extras/tools/stream_wav_to_usb.c, and is queued in kNumSlots slots. Each
+// time the sleeve requests more data with kRequestMoreData, the next
+// kPwmSamples frames are sent to it over Serial1. When a block has been sent,
+// a Credit message tells the PC that it may send another block, so the PC
+// keeps the queue full and the sleeve never waits on USB.
+
+#include "tactile/usb_stream.h"
 
 const int kNumChannels = 12;
 const int kPwmSamples = 8;
+// The sleeve expects 128 data bytes and 4 header bytes in one serial packet.
 const int kDataBytes = 128;
 const int kHeaderBytes = 4;
-byte inputArray[4096];
-int serial_counter = 0;
-unsigned long time_prev;
-// The puck expects 128 data bytes and 4 header bytes in one serial packet.
-byte received_tactile_frame[kHeaderBytes + kDataBytes];
-volatile bool sequence_finished = false;
-volatile bool new_data = false;
-
-void setup() {
-  SerialUSB.begin(1000000);
-  Serial1.begin(1000000);
+// Sleeve message byte requesting the next packet (kRequestMoreData).
+const uint8_t kRequestMoreData = 23;
+// Number of queued blocks.
+const int kNumSlots = 8;
+// Period for sending a Credit message when no blocks are being consumed.
+const uint32_t kCreditHeartbeatMs = 100;
+
+uint8_t slots[kNumSlots][kUsbStreamMaxPayloadBytes];
+int slot_num_frames[kNumSlots];
+uint32_t num_written = 0;
+uint32_t num_consumed = 0;
+uint32_t num_consumed_reported = 0;
+// Frame position in the slot being sent.
+int frame_position = 0;
+uint16_t expected_sequence = 0;
+uint16_t num_underruns = 0;
+uint16_t num_errors = 0;
+bool playing = false;
+uint32_t last_credit_ms = 0;
+UsbStreamParser parser;
+byte sleeve_packet[kHeaderBytes + kDataBytes] = {200, 201, 17, 128};
+
+void SendCredit() {
+  UsbStreamCredit credit;
+  credit.num_consumed = num_consumed;
+  credit.capacity = kNumSlots;
+  credit.num_underruns = num_underruns;
+  credit.num_errors = num_errors;
+  uint8_t message[kUsbStreamHeaderBytes + kUsbStreamCreditPayloadBytes];
+  SerialUSB.write(message, UsbStreamEncodeCredit(&credit, message));
+  num_consumed_reported = num_consumed;
+  last_credit_ms = millis();
 }
 
-void loop() {
-  if (SerialUSB.available()) {
-    while (SerialUSB.available()) {
-      // get the new byte:
-      byte c = SerialUSB.read();
-      inputArray[serial_counter] = c;
-      serial_counter = serial_counter + 1;
+void HandleMessage(const UsbStreamMessage& message) {
+  if (message.type == kUsbStreamReset) {
+    num_written = 0;
+    num_consumed = 0;
+    frame_position = 0;
+    expected_sequence = 0;
+    num_underruns = 0;
+    num_errors = 0;
+    playing = false;
+    SendCredit();
+  } else if (message.type == kUsbStreamData) {
+    const bool valid = message.num_channels == kNumChannels &&
+                       message.num_frames % kPwmSamples == 0 &&
+                       message.sequence == expected_sequence &&
+                       num_written - num_consumed < kNumSlots;
+    expected_sequence = message.sequence + 1;
+    if (!valid) {
+      if (num_errors < UINT16_MAX) { ++num_errors; }
+      return;
     }
-
-    new_data = true;
-
-    // Get the timestamp to make sure there is no lag on USB port.
-    // Should be around 4 ms for real-time performance.
-    int time_stamp = (int)(time_prev - micros());
-    SerialUSB.println(time_stamp);
-    memcpy(received_tactile_frame, inputArray,
-           (kNumChannels * kPwmSamples) + kHeaderBytes);
-
-    serial_counter = 0;
-    time_prev = micros();
-  }  // end serial USB
-
-  // send the data to the sleeve, and request new packet.
-  if (sequence_finished && new_data) {
-    Serial1.write(received_tactile_frame, 132);
-    sequence_finished = false;
-    new_data = false;
-    // By sending buffer_copied to PC, new frame is sent.
-    SerialUSB.println("buffer_copied");
+    const int slot = num_written % kNumSlots;
+    memcpy(slots[slot], message.payload, message.payload_size);
+    slot_num_frames[slot] = message.num_frames;
+    ++num_written;
   }
 }
 
-// Check for sync serial packet from the sleeve.
-void serialEvent1() {
-  byte c = Serial1.read();
+// Sends the next kPwmSamples frames to the sleeve.
+void SendToSleeve() {
+  if (num_consumed == num_written) {
+    // Queue is empty. Send silence, counting an underrun if this interrupts
+    // playback.
+    if (playing) {
+      memset(sleeve_packet + kHeaderBytes, 128, kNumChannels * kPwmSamples);
+      Serial1.write(sleeve_packet, sizeof(sleeve_packet));
+      if (num_underruns < UINT16_MAX) { ++num_underruns; }
+      playing = false;
+    }
+    return;
+  }
 
-  if (c == 23) {
-    sequence_finished = true;
+  playing = true;
+  const int slot = num_consumed % kNumSlots;
+  memcpy(sleeve_packet + kHeaderBytes,
+         slots[slot] + frame_position * kNumChannels,
+         kNumChannels * kPwmSamples);
+  Serial1.write(sleeve_packet, sizeof(sleeve_packet));
+  frame_position += kPwmSamples;
+  if (frame_position >= slot_num_frames[slot]) {
+    frame_position = 0;
+    ++num_consumed;  // Free the slot.
   }
 }
- is done between the Teensy and the sleeve so serial data to
-// prevent gaps in playback. Teensy does not need to buffer the data as full
-// speed usb is fast enough.
-
-const int kNumChannels = 12;
-const int kPwmSamples = 8;
-const int kDataBytes = 128;
-const int kHeaderBytes = 4;
-byte inputArray[4096];
-int serial_counter = 0;
-unsigned long time_prev;
-// The sleeve expects 128 data bytes and 4 header bytes in one serial packet.
-byte received_tactile_frame[kHeaderBytes + kDataBytes];
-volatile bool sequence_finished = false;
-volatile bool new_data = false;
 
 void setup() {
   SerialUSB.begin(1000000);
   Serial1.begin(1000000);
+  UsbStreamParserInit(&parser);
 }
 
 void loop() {
-  if (SerialUSB.available()) {
-    while (SerialUSB.available()) {
-      // get the new byte:
-      byte c = SerialUSB.read();
-      inputArray[serial_counter] = c;
-      serial_counter = serial_counter + 1;
+  uint8_t chunk[512];
+  int size;
+  while ((size = SerialUSB.available()) > 0) {
+    if (size > static_cast<int>(sizeof(chunk))) { size = sizeof(chunk); }
+    size = SerialUSB.readBytes(reinterpret_cast<char*>(chunk), size);
+    const uint8_t* data = chunk;
+    while (size > 0) {
+      UsbStreamMessage message;
+      const int consumed = UsbStreamParserFeed(&parser, data, size, &message);
+      data += consumed;
+      size -= consumed;
+      HandleMessage(message);
     }
+  }
 
-    new_data = true;
-
-    // Get the timestamp to make sure there is no lag on USB port.
-    // Should be around 4 ms for real-time performance.
-    int time_stamp = (int)(time_prev - micros());
-    SerialUSB.println(time_stamp);
-    memcpy(received_tactile_frame, inputArray,
-           (kNumChannels * kPwmSamples) + kHeaderBytes);
-
-    serial_counter = 0;
-    time_prev = micros();
-  }  // end serial USB
-
-  // send the data to the sleeve, and request new packet.
-  if (sequence_finished && new_data) {
-    Serial1.write(received_tactile_frame, 132);
-    sequence_finished = false;
-    new_data = false;
-    // By sending buffer_copied to PC, new frame is sent.
-    SerialUSB.println("buffer_copied");
+  // Grant credit when blocks were sent, or periodically as heartbeat.
+  if (num_consumed != num_consumed_reported ||
+      millis() - last_credit_ms >= kCreditHeartbeatMs) {
+    SendCredit();
   }
 }
 
 // Check for sync serial packet from the sleeve.
 void serialEvent1() {
-  byte c = Serial1.read();
-
-  if (c == 23) {
-    sequence_finished = true;
+  while (Serial1.available()) {
+    if (Serial1.read() == kRequestMoreData) { SendToSleeve(); }
   }
 }
@@ -0,0 +1,175 @@
+// Copyright 2022 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/cpp/atomic_object_pool.h"
+
+#include <string>
+#include <thread>  // NOLINT(build/c++11)
+
+#include "src/cpp/spsc_ring_buffer.h"
+#include "src/dsp/logging.h"
+
+// NOLINTBEGIN(readability/check)
+
+namespace audio_tactile {
+
+// A dummy object that tracks the number of constructor and destructor calls.
+struct Object {
+  explicit Object(int label_in) : label(label_in) { ++constructor_count; }
+  ~Object() { ++destructor_count; }
+
+  int label;
+
+  static void ResetCounters() { constructor_count = destructor_count = 0; }
+  static int constructor_count;
+  static int destructor_count;
+};
+int Object::constructor_count = 0;
+int Object::destructor_count = 0;
+
+// Gets the state of the pool. Returns a string of length kCapacity, in which
+// the ith char is '*' if the ith object is live or '.' if it is free.
+template <typename PoolType>
+std::string PoolState(const PoolType& pool) {
+  std::string state(PoolType::kCapacity, ' ');
+  char is_live[PoolType::kCapacity];
+  PoolType::TestAccess::MarkLiveObjects(pool, is_live);
+  for (int i = 0; i < PoolType::kCapacity; ++i) {
+    state[i] = is_live[i] ? '*' : '.';
+  }
+  return state;
+}
+
+// Test allocating and freeing on one thread.
+void TestAllocateFree() {
+  puts("TestAllocateFree");
+  Object::ResetCounters();
+  {
+    AtomicObjectPool<Object, 3> pool;
+    CHECK(pool.num_free() == 3);
+    CHECK(PoolState(pool) == "...");
+
+    Object* a = pool.Allocate(1);
+    Object* b = pool.Allocate(2);
+    Object* c = pool.Allocate(3);
+    CHECK(a && a->label == 1);
+    CHECK(b && b->label == 2);
+    CHECK(c && c->label == 3);
+    CHECK(pool.num_live() == 3);
+    CHECK(PoolState(pool) == "***");
+    CHECK(pool.Allocate(4) == nullptr);  // Pool is exhausted.
+    CHECK(Object::constructor_count == 3);
+
+    pool.Free(b);  // Objects may be freed in any order.
+    CHECK(Object::destructor_count == 1);
+    CHECK(PoolState(pool) == "*.*");
+    Object* d = pool.Allocate(5);  // Reuses b's node.
+    CHECK(d == b && d->label == 5);
+    pool.Free(a);
+    pool.Free(nullptr);  // Freeing nullptr does nothing.
+    CHECK(pool.num_free() == 1);
+    CHECK(PoolState(pool) == ".**");
+  }
+  // The pool's destructor frees the remaining live objects.
+  CHECK(Object::destructor_count == Object::constructor_count);
+}
+
+// Test handing objects from a producer thread to a consumer thread, which
+// frees them, as between an interrupt handler and the main loop.
+void TestHandOffThreads() {
+  puts("TestHandOffThreads");
+  constexpr int kNumObjects = 200000;
+  AtomicObjectPool<int, 8> pool;
+  SpscRingBuffer<int*, 8> queue;
+
+  std::thread producer([&pool, &queue]() {
+    for (int i = 0; i < kNumObjects;) {
+      int* object = pool.Allocate(i);
+      if (object == nullptr) {  // Exhausted, retry.
+        std::this_thread::yield();
+        continue;
+      }
+      CHECK(queue.Push(object));  // The queue is at least as large as the pool.
+      ++i;
+    }
+  });
+
+  // The consumer should receive every object in order and intact.
+  for (int i = 0; i < kNumObjects;) {
+    int* object;
+    if (!queue.Pop(&object)) {  // Empty, retry.
+      std::this_thread::yield();
+      continue;
+    }
+    CHECK(*object == i);
+    pool.Free(object);
+    ++i;
+  }
+
+  producer.join();
+  CHECK(pool.num_free() == 8);
+}
+
+// Test several threads allocating and freeing concurrently from one pool. Each
+// thread writes a unique value into its objects and checks that no other
+// thread modified them, which would happen if a node were given out twice.
+void TestConcurrentAllocateFree() {
+  puts("TestConcurrentAllocateFree");
+  constexpr int kNumThreads = 4;
+  constexpr int kNumIterations = 100000;
+  constexpr int kMaxHeld = 3;
+  AtomicObjectPool<int, 8> pool;
+
+  auto worker = [&pool](int thread_index) {
+    int* held[kMaxHeld];
+    for (int iter = 0; iter < kNumIterations; ++iter) {
+      const int value = thread_index * kNumIterations + iter;
+      int num_held = 0;
+      for (; num_held < kMaxHeld; ++num_held) {
+        held[num_held] = pool.Allocate(value + num_held);
+        if (held[num_held] == nullptr) { break; }
+      }
+      for (int j = 0; j < num_held; ++j) {
+        CHECK(*held[j] == value + j);
+      }
+      for (int j = num_held - 1; j >= 0; --j) {
+        pool.Free(held[j]);
+      }
+    }
+  };
+
+  std::thread threads[kNumThreads];
+  for (int i = 0; i < kNumThreads; ++i) {
+    threads[i] = std::thread(worker, i);
+  }
+  for (int i = 0; i < kNumThreads; ++i) {
+    threads[i].join();
+  }
+
+  CHECK(pool.num_free() == 8);
+  CHECK(PoolState(pool) == "........");
+}
+
+}  // namespace audio_tactile
+
+// NOLINTEND
+
+int main(int argc, char** argv) {
+  audio_tactile::TestAllocateFree();
+  audio_tactile::TestHandOffThreads();
+  audio_tactile::TestConcurrentAllocateFree();
+
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,147 @@
+// Copyright 2022 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/cpp/clock_sync.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+#include <random>
+
+#include "src/dsp/logging.h"
+
+// NOLINTBEGIN(readability/check)
+
+namespace audio_tactile {
+
+// Simulated reference clock, running `drift_ppm` faster than the local clock,
+// with both clocks starting near wraparound.
+struct SimulatedClocks {
+  double drift_ppm;
+  uint32_t local_start_us;
+  uint32_t reference_start_us;
+
+  // Reference time at `elapsed_us` after the start, in local microseconds.
+  uint32_t Reference(double elapsed_us) const {
+    return reference_start_us +
+        static_cast<uint32_t>(llround(elapsed_us * (1.0 + 1e-6 * drift_ppm)));
+  }
+  uint32_t Local(double elapsed_us) const {
+    return local_start_us + static_cast<uint32_t>(llround(elapsed_us));
+  }
+};
+
+// Runs an exchange starting at `elapsed_us` with one-way delays `up_us` and
+// `down_us`, and a response turnaround of 250 us.
+bool Exchange(const SimulatedClocks& clocks, double elapsed_us, double up_us,
+              double down_us, ClockSync* clock_sync) {
+  const uint32_t t1 = clocks.Local(elapsed_us);
+  const uint32_t t2 = clocks.Reference(elapsed_us + up_us);
+  const uint32_t t3 = clocks.Reference(elapsed_us + up_us + 250.0);
+  const uint32_t t4 = clocks.Local(elapsed_us + up_us + 250.0 + down_us);
+  return clock_sync->OnResponse(t1, t2, t3, t4);
+}
+
+// With symmetric delays, offset and drift are estimated accurately.
+void TestSymmetricDelays() {
+  puts("TestSymmetricDelays");
+  const SimulatedClocks clocks = {/*drift_ppm=*/35.0, 0xfff00000, 0x7ff80000};
+  ClockSync clock_sync;
+  CHECK(!clock_sync.synced());
+
+  double elapsed_us = 0.0;
+  for (int i = 0; i < 20; ++i, elapsed_us += 2.5e6) {
+    CHECK(Exchange(clocks, elapsed_us, 10000.0, 10000.0, &clock_sync));
+    CHECK(clock_sync.synced() == (i + 1 >= ClockSync::kMinSamples));
+    CHECK(clock_sync.round_trip_us() == 20000);
+  }
+  CHECK(fabs(clock_sync.drift_ppm() - 35.0f) < 1.0f);
+
+  // Conversion is accurate, also extrapolating well after the last exchange.
+  for (double t = elapsed_us; t < elapsed_us + 30e6; t += 1.1e6) {
+    const uint32_t local_us = clocks.Local(t);
+    const uint32_t reference_us = clocks.Reference(t);
+    CHECK(abs(static_cast<int32_t>(
+              clock_sync.LocalToReference(local_us) - reference_us)) <= 2);
+    CHECK(abs(static_cast<int32_t>(
+              clock_sync.ReferenceToLocal(reference_us) - local_us)) <= 2);
+  }
+
+  clock_sync.Reset();
+  CHECK(!clock_sync.synced());
+}
+
+// With random BLE delays, the error is a fraction of the connection interval,
+// exchanges delayed by retransmission are discarded, and enough of the others
+// are kept.
+void TestRandomDelays() {
+  puts("TestRandomDelays");
+  std::mt19937 rng(0);
+  // One-way delays of 3 ms plus up to a 7.5 ms connection interval.
+  std::uniform_real_distribution<double> delay_dist(3000.0, 10500.0);
+  const SimulatedClocks clocks = {/*drift_ppm=*/-28.0, 0x1000, 0xffffff00};
+  ClockSync clock_sync;
+
+  double elapsed_us = 0.0;
+  int num_used = 0;
+  for (int i = 0; i < 100; ++i, elapsed_us += 2e6) {
+    double up_us = delay_dist(rng);
+    const double down_us = delay_dist(rng);
+    const bool retransmitted = (i % 10 == 9);
+    if (retransmitted) { up_us += 30000.0; }
+    const bool used =
+        Exchange(clocks, elapsed_us, up_us, down_us, &clock_sync);
+    if (retransmitted) {
+      CHECK(!used);
+    } else if (used) {
+      ++num_used;
+    }
+
+    if (i >= 20) {
+      for (double t = elapsed_us; t < elapsed_us + 2e6; t += 0.37e6) {
+        const int32_t error_us = static_cast<int32_t>(
+            clock_sync.LocalToReference(clocks.Local(t)) -
+            clocks.Reference(t));
+        CHECK(abs(error_us) < 2500);
+      }
+    }
+  }
+  CHECK(num_used >= 30);
+}
+
+// Invalid exchanges are discarded.
+void TestInvalidExchanges() {
+  puts("TestInvalidExchanges");
+  ClockSync clock_sync;
+  // Response received before the request was sent.
+  CHECK(!clock_sync.OnResponse(1000, 50000, 50100, 900));
+  // Reference sent before it received.
+  CHECK(!clock_sync.OnResponse(1000, 50000, 49000, 3000));
+  // Round trip too long.
+  CHECK(!clock_sync.OnResponse(1000, 50000, 50100, 1000 + 300000));
+  CHECK(!clock_sync.synced());
+}
+
+}  // namespace audio_tactile
+
+// NOLINTEND
+
+int main(int argc, char** argv) {
+  audio_tactile::TestSymmetricDelays();
+  audio_tactile::TestRandomDelays();
+  audio_tactile::TestInvalidExchanges();
+
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
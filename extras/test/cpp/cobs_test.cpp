@@ -0,0 +1,173 @@
+// Copyright 2022 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "src/cpp/cobs.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "src/dsp/logging.h"
+
+// NOLINTBEGIN(readability/check)
+
+namespace audio_tactile {
+
+// Checks that `decoded` encodes to `encoded`, and decodes back in place.
+void CheckCobs(const std::vector<uint8_t>& decoded,
+               const std::vector<uint8_t>& encoded) {
+  std::vector<uint8_t> buffer(CobsMaxEncodedSize(decoded.size()));
+  const int encoded_size = CobsEncode(decoded.data(), decoded.size(),
+                                      buffer.data());
+  CHECK(encoded_size == static_cast<int>(encoded.size()));
+  CHECK(std::equal(encoded.begin(), encoded.end(), buffer.begin()));
+  const int decoded_size = CobsDecode(buffer.data(), encoded_size,
+                                      buffer.data());
+  CHECK(decoded_size == static_cast<int>(decoded.size()));
+  CHECK(std::equal(decoded.begin(), decoded.end(), buffer.begin()));
+}
+
+// Test with examples from the COBS paper and Wikipedia.
+void TestCobsExamples() {
+  puts("TestCobsExamples");
+  CheckCobs({}, {0x01});
+  CheckCobs({0x00}, {0x01, 0x01});
+  CheckCobs({0x00, 0x00}, {0x01, 0x01, 0x01});
+  CheckCobs({0x00, 0x11, 0x00}, {0x01, 0x02, 0x11, 0x01});
+  CheckCobs({0x11, 0x22, 0x00, 0x33}, {0x03, 0x11, 0x22, 0x02, 0x33});
+  CheckCobs({0x11, 0x22, 0x33, 0x44}, {0x05, 0x11, 0x22, 0x33, 0x44});
+  CheckCobs({0x11, 0x00, 0x00, 0x00}, {0x02, 0x11, 0x01, 0x01, 0x01});
+
+  // 254 nonzero bytes fill a block exactly.
+  std::vector<uint8_t> decoded;
+  std::vector<uint8_t> encoded = {0xff};
+  for (int i = 1; i <= 254; ++i) {
+    decoded.push_back(i);
+    encoded.push_back(i);
+  }
+  CheckCobs(decoded, encoded);
+  // With 255 nonzero bytes, the last byte starts a second block.
+  decoded.push_back(0xff);
+  encoded.push_back(0x02);
+  encoded.push_back(0xff);
+  CheckCobs(decoded, encoded);
+}
+
+void TestCobsDecodeInvalid() {
+  puts("TestCobsDecodeInvalid");
+  uint8_t out[8];
+  const uint8_t kZeroCode[] = {0x02, 0x11, 0x00};
+  CHECK(CobsDecode(kZeroCode, 3, out) == -1);
+  const uint8_t kTruncated[] = {0x05, 0x11, 0x22};
+  CHECK(CobsDecode(kTruncated, 3, out) == -1);
+}
+
+// Appends the COBS encoding of `frame` and a delimiter to `stream`.
+void AppendFrame(const std::vector<uint8_t>& frame,
+                 std::vector<uint8_t>* stream) {
+  std::vector<uint8_t> encoded(CobsMaxEncodedSize(frame.size()));
+  encoded.resize(CobsEncode(frame.data(), frame.size(), encoded.data()));
+  stream->insert(stream->end(), encoded.begin(), encoded.end());
+  stream->push_back(0);
+}
+
+// Random frames split into random chunks decode in order. Frames within a
+// chunk are returned without copying.
+void TestStreamDecoder() {
+  puts("TestStreamDecoder");
+  constexpr int kMaxFrameSize = 132;
+  std::mt19937 rng(0);
+  std::uniform_int_distribution<int> size_dist(1, kMaxFrameSize);
+  std::uniform_int_distribution<int> byte_dist(0, 3);  // Many zeros.
+  std::uniform_int_distribution<int> chunk_dist(1, 300);
+
+  std::vector<std::vector<uint8_t>> frames(200);
+  std::vector<uint8_t> stream;
+  for (auto& frame : frames) {
+    frame.resize(size_dist(rng));
+    for (uint8_t& value : frame) { value = 60 * byte_dist(rng); }
+    AppendFrame(frame, &stream);
+    if (byte_dist(rng) == 0) { stream.push_back(0); }  // Padding is allowed.
+  }
+
+  CobsStreamDecoder<kMaxFrameSize> decoder;
+  int num_decoded = 0;
+  int num_zero_copy = 0;
+  for (int start = 0; start < static_cast<int>(stream.size());) {
+    const int chunk_size = std::min<int>(chunk_dist(rng),
+                                         stream.size() - start);
+    uint8_t* chunk = stream.data() + start;
+    decoder.Feed({chunk, chunk_size});
+    Slice<const uint8_t> frame;
+    while (decoder.Next(&frame)) {
+      CHECK(num_decoded < static_cast<int>(frames.size()));
+      const auto& expected = frames[num_decoded];
+      CHECK(frame.size() == static_cast<int>(expected.size()));
+      CHECK(std::equal(expected.begin(), expected.end(), frame.data()));
+      if (chunk <= frame.data() && frame.data() < chunk + chunk_size) {
+        ++num_zero_copy;
+      }
+      ++num_decoded;
+    }
+    start += chunk_size;
+  }
+  CHECK(num_decoded == static_cast<int>(frames.size()));
+  CHECK(num_zero_copy > 0);
+  CHECK(decoder.num_errors() == 0);
+}
+
+// After corrupted and overlong frames, the decoder resynchronizes at the next
+// delimiter.
+void TestStreamDecoderErrors() {
+  puts("TestStreamDecoderErrors");
+  constexpr int kMaxFrameSize = 8;
+  const std::vector<uint8_t> good = {1, 0, 2, 3};
+  std::vector<uint8_t> stream;
+  // Invalid: code byte runs past the delimiter.
+  stream.insert(stream.end(), {0x09, 0x11, 0x22, 0x00});
+  AppendFrame(good, &stream);
+  // Overlong frame, split across chunks below.
+  AppendFrame(std::vector<uint8_t>(20, 7), &stream);
+  AppendFrame(good, &stream);
+
+  CobsStreamDecoder<kMaxFrameSize> decoder;
+  int num_decoded = 0;
+  for (int start = 0; start < static_cast<int>(stream.size()); start += 5) {
+    const int chunk_size = std::min<int>(5, stream.size() - start);
+    decoder.Feed({stream.data() + start, chunk_size});
+    Slice<const uint8_t> frame;
+    while (decoder.Next(&frame)) {
+      CHECK(frame.size() == static_cast<int>(good.size()));
+      CHECK(std::equal(good.begin(), good.end(), frame.data()));
+      ++num_decoded;
+    }
+  }
+  CHECK(num_decoded == 2);
+  CHECK(decoder.num_errors() == 2);
+}
+
+}  // namespace audio_tactile
+
+// NOLINTEND
+
+int main(int argc, char** argv) {
+  audio_tactile::TestCobsExamples();
+  audio_tactile::TestCobsDecodeInvalid();
+  audio_tactile::TestStreamDecoder();
+  audio_tactile::TestStreamDecoderErrors();
+
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,204 @@
+// Copyright 2022 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/cpp/deferred_log.h"
+
+#include <thread>  // NOLINT(build/c++11)
+#include <vector>
+
+#include "src/dsp/logging.h"
+
+// NOLINTBEGIN(readability/check)
+
+namespace audio_tactile {
+
+static uint32_t g_ticks = 0;
+static uint32_t GetFakeTicks() { return g_ticks; }
+
+// Decoded record.
+struct DecodedRecord {
+  uint32_t format_address;
+  uint32_t timestamp;
+  int level;
+  std::vector<uint32_t> args;
+};
+
+// Decodes a frame from DrainFrame().
+static DecodedRecord DecodeFrame(uint8_t* frame, int size) {
+  CHECK(size >= 3);
+  CHECK(frame[0] == 0);  // Frame is delimited.
+  CHECK(frame[size - 1] == 0);
+  uint8_t record[64];
+  const int record_size = CobsDecode(frame + 1, size - 2, record);
+  CHECK(record_size >= 10);
+
+  DecodedRecord decoded;
+  decoded.format_address = LittleEndianReadU32(record);
+  decoded.timestamp = LittleEndianReadU32(record + 4);
+  decoded.level = record[8];
+  const int num_args = record[9];
+  CHECK(record_size == 10 + 4 * num_args);
+  for (int i = 0; i < num_args; ++i) {
+    decoded.args.push_back(LittleEndianReadU32(record + 10 + 4 * i));
+  }
+  return decoded;
+}
+
+static uint32_t AddressOf(const char* format) {
+  return static_cast<uint32_t>(reinterpret_cast<uintptr_t>(format));
+}
+
+// Test logging and draining a few records.
+void TestLogAndDrain() {
+  puts("TestLogAndDrain");
+  DeferredLog<8> log(GetFakeTicks);
+  uint8_t frame[DeferredLog<8>::kMaxFrameSize];
+  CHECK(log.DrainFrame(frame) == 0);  // Empty.
+
+  static const char* kFormat1 = "Started";
+  static const char* kFormat2 = "x=%d y=%u z=%g ok=%d";
+  g_ticks = 100;
+  CHECK(log.Log(kDeferredLogInfo, kFormat1));
+  g_ticks = 250;
+  CHECK(log.Log(kDeferredLogError, kFormat2, -7, 40000u, 1.5f, true));
+
+  int size = log.DrainFrame(frame);
+  DecodedRecord record = DecodeFrame(frame, size);
+  CHECK(record.format_address == AddressOf(kFormat1));
+  CHECK(record.timestamp == 100);
+  CHECK(record.level == kDeferredLogInfo);
+  CHECK(record.args.empty());
+
+  size = log.DrainFrame(frame);
+  record = DecodeFrame(frame, size);
+  CHECK(record.format_address == AddressOf(kFormat2));
+  CHECK(record.timestamp == 250);
+  CHECK(record.level == kDeferredLogError);
+  CHECK(record.args.size() == 4);
+  CHECK(static_cast<int32_t>(record.args[0]) == -7);
+  CHECK(record.args[1] == 40000);
+  CHECK(record.args[2] == 0x3fc00000);  // Bits of 1.5f.
+  CHECK(record.args[3] == 1);
+
+  CHECK(log.DrainFrame(frame) == 0);
+  CHECK(log.num_dropped() == 0);
+}
+
+// Test that records are dropped when the ring is full, and the number dropped
+// is reported before the next record.
+void TestDropsWhenFull() {
+  puts("TestDropsWhenFull");
+  DeferredLog<4> log(GetFakeTicks);
+  uint8_t frame[DeferredLog<4>::kMaxFrameSize];
+  static const char* kFormat = "i=%d";
+
+  for (int i = 0; i < 4; ++i) {
+    CHECK(log.Log(kDeferredLogDebug, kFormat, i));
+  }
+  CHECK(!log.Log(kDeferredLogDebug, kFormat, 4));
+  CHECK(!log.Log(kDeferredLogDebug, kFormat, 5));
+  CHECK(log.num_dropped() == 2);
+
+  DecodedRecord record = DecodeFrame(frame, log.DrainFrame(frame));
+  CHECK(record.format_address == 0);  // Dropped records report.
+  CHECK(record.level == kDeferredLogWarning);
+  CHECK(record.args.size() == 1 && record.args[0] == 2);
+
+  // The ring wraps around after draining.
+  for (int i = 0; i < 4; ++i) {
+    record = DecodeFrame(frame, log.DrainFrame(frame));
+    CHECK(record.format_address == AddressOf(kFormat));
+    CHECK(record.args.size() == 1 && static_cast<int>(record.args[0]) == i);
+    CHECK(log.Log(kDeferredLogDebug, kFormat, 10 + i));
+  }
+  for (int i = 0; i < 4; ++i) {
+    record = DecodeFrame(frame, log.DrainFrame(frame));
+    CHECK(static_cast<int>(record.args[0]) == 10 + i);
+  }
+  CHECK(log.DrainFrame(frame) == 0);
+}
+
+// Test that disabled levels are compiled out.
+void TestLevelFiltering() {
+  puts("TestLevelFiltering");
+  DeferredLog<4> log(GetFakeTicks);
+  uint8_t frame[DeferredLog<4>::kMaxFrameSize];
+  DEFERRED_LOG_DEBUG(log, "debug %d", 1);
+  DEFERRED_LOG_ERROR(log, "error %d", 2);
+
+#if DEFERRED_LOG_MIN_LEVEL <= 0
+  CHECK(DecodeFrame(frame, log.DrainFrame(frame)).args[0] == 1);
+#endif
+  CHECK(DecodeFrame(frame, log.DrainFrame(frame)).args[0] == 2);
+  CHECK(log.DrainFrame(frame) == 0);
+}
+
+// Test logging concurrently from multiple producer threads.
+void TestConcurrentProducers() {
+  puts("TestConcurrentProducers");
+  constexpr int kNumProducers = 3;
+  constexpr int kNumPerProducer = 20000;
+  static DeferredLog<16> log(GetFakeTicks);
+  static const char* kFormat = "producer %d item %d";
+
+  std::vector<std::thread> producers;
+  for (int p = 0; p < kNumProducers; ++p) {
+    producers.emplace_back([p]() {
+      for (int i = 0; i < kNumPerProducer; ++i) {
+        while (!log.Log(kDeferredLogInfo, kFormat, p, i)) {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+
+  // Records of each producer come out complete and in order.
+  int next_item[kNumProducers] = {0};
+  int num_received = 0;
+  uint8_t frame[DeferredLog<16>::kMaxFrameSize];
+  while (num_received < kNumProducers * kNumPerProducer) {
+    const int size = log.DrainFrame(frame);
+    if (size == 0) {
+      std::this_thread::yield();
+      continue;
+    }
+    const DecodedRecord record = DecodeFrame(frame, size);
+    if (record.format_address == 0) { continue; }  // Dropped records report.
+    CHECK(record.format_address == AddressOf(kFormat));
+    CHECK(record.args.size() == 2);
+    const int p = record.args[0];
+    CHECK(0 <= p && p < kNumProducers);
+    CHECK(static_cast<int>(record.args[1]) == next_item[p]);
+    ++next_item[p];
+    ++num_received;
+  }
+
+  for (auto& producer : producers) {
+    producer.join();
+  }
+}
+
+}  // namespace audio_tactile
+
+// NOLINTEND
+
+int main(int argc, char** argv) {
+  audio_tactile::TestLogAndDrain();
+  audio_tactile::TestDropsWhenFull();
+  audio_tactile::TestLevelFiltering();
+  audio_tactile::TestConcurrentProducers();
+
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
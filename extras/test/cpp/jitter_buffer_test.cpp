@@ -0,0 +1,277 @@
+// Copyright 2022 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/cpp/jitter_buffer.h"
+
+#include <math.h>
+
+#include "src/dsp/logging.h"
+
+// NOLINTBEGIN(readability/check)
+
+namespace audio_tactile {
+
+constexpr int kNumFrames = 8;
+constexpr int kNumChannels = 2;
+constexpr int kBlockSize = kNumFrames * kNumChannels;
+constexpr uint32_t kPeriodUs = 4000;
+using TestJitterBuffer = JitterBuffer<kNumFrames, kNumChannels, 16>;
+
+// Fills `block` with the value `index` in every sample.
+void MakeBlock(int index, float* block) {
+  for (int i = 0; i < kBlockSize; ++i) {
+    block[i] = static_cast<float>(index);
+  }
+}
+
+// With periodic arrival, the target is the one-block margin and every pop
+// after the first push plays from the stream.
+void TestPeriodicArrival() {
+  puts("TestPeriodicArrival");
+  TestJitterBuffer jitter_buffer;
+  jitter_buffer.Init(kPeriodUs);
+  float block[kBlockSize];
+  float output[kBlockSize];
+
+  for (int n = 0; n < 1000; ++n) {
+    MakeBlock(n, block);
+    CHECK(jitter_buffer.Push(block, 12345 + n * kPeriodUs));
+    CHECK(jitter_buffer.Pop(output));
+    CHECK(output[0] == n);
+    CHECK(output[kBlockSize - 1] == n);
+    CHECK(jitter_buffer.target_depth() == 1);
+  }
+
+  const JitterBufferStats stats = jitter_buffer.stats();
+  CHECK(stats.target_depth == 1);
+  CHECK(fabs(stats.latency_ms - 4.0f) < 1e-6f);
+  CHECK(stats.jitter_ms == 0.0f);
+  CHECK(stats.num_underruns == 0);
+  CHECK(stats.num_concealed_blocks == 0);
+  CHECK(stats.num_dropped_blocks == 0);
+}
+
+// With bursts of 3 blocks every 3 periods, the target adapts to 3 blocks, and
+// blocks play in order without underruns. When the bursts stop, the target is
+// eventually released back to 1.
+void TestBurstyArrival() {
+  puts("TestBurstyArrival");
+  TestJitterBuffer jitter_buffer;
+  jitter_buffer.Init(kPeriodUs);
+  float block[kBlockSize];
+  float output[kBlockSize];
+  int num_pushed = 0;
+  int expected = 0;
+
+  for (int k = 0; k < 3000; ++k) {
+    // Wraps around the uint32_t timestamp during the test.
+    const uint32_t time_us = 0xfff00000u + k * kPeriodUs;
+    if (k % 3 == 0) {
+      for (int i = 0; i < 3; ++i) {
+        MakeBlock(num_pushed++, block);
+        CHECK(jitter_buffer.Push(block, time_us));
+      }
+    }
+    if (jitter_buffer.Pop(output)) {
+      CHECK(output[0] == expected);
+      ++expected;
+    }
+    CHECK(jitter_buffer.target_depth() == 3);
+  }
+  CHECK(expected > 2990);
+  JitterBufferStats stats = jitter_buffer.stats();
+  CHECK(stats.num_underruns == 0);
+  CHECK(stats.num_dropped_blocks == 0);
+  CHECK(7.0f < stats.jitter_ms && stats.jitter_ms <= 8.0f);
+  CHECK(fabs(stats.latency_ms - 12.0f) < 1e-6f);
+
+  // Switch to periodic arrival. The target decreases to 1 without underruns.
+  for (int k = 3000; k < 6000; ++k) {
+    MakeBlock(num_pushed++, block);
+    CHECK(jitter_buffer.Push(block, 0xfff00000u + k * kPeriodUs));
+    CHECK(jitter_buffer.Pop(output));
+    CHECK(output[0] >= expected);  // Some blocks may be trimmed.
+    expected = output[0] + 1;
+  }
+  stats = jitter_buffer.stats();
+  CHECK(stats.target_depth == 1);
+  CHECK(stats.num_underruns == 0);
+  CHECK(stats.num_dropped_blocks == 0);
+  CHECK(expected == num_pushed);
+}
+
+// After a burst of extra blocks, excess depth is trimmed once the target is
+// released, restoring low latency.
+void TestTrim() {
+  puts("TestTrim");
+  TestJitterBuffer jitter_buffer;
+  jitter_buffer.Init(kPeriodUs);
+  float block[kBlockSize];
+  float output[kBlockSize];
+  int num_pushed = 0;
+  for (int k = 0; k < 100; ++k) {
+    MakeBlock(num_pushed++, block);
+    jitter_buffer.Push(block, k * kPeriodUs);
+    CHECK(jitter_buffer.Pop(output));
+  }
+  // 4 extra blocks arrive at once.
+  for (int i = 0; i < 4; ++i) {
+    MakeBlock(num_pushed++, block);
+    jitter_buffer.Push(block, 100 * kPeriodUs);
+  }
+  CHECK(jitter_buffer.target_depth() == 4);
+
+  int expected = 100;
+  for (int k = 100; k < 6000; ++k) {
+    MakeBlock(num_pushed++, block);
+    jitter_buffer.Push(block, k * kPeriodUs);
+    CHECK(jitter_buffer.Pop(output));  // No underruns.
+    CHECK(output[0] >= expected);  // Trimming skips blocks.
+    expected = output[0] + 1;
+  }
+  const JitterBufferStats stats = jitter_buffer.stats();
+  CHECK(stats.target_depth == 1);
+  CHECK(stats.num_dropped_blocks == 4);
+  CHECK(stats.num_underruns == 0);
+  CHECK(jitter_buffer.depth() == 0);
+}
+
+// A gap in arrival is concealed by holding the last block, then fading out.
+// Playback fades back in when blocks arrive again.
+void TestConcealment() {
+  puts("TestConcealment");
+  TestJitterBuffer jitter_buffer;
+  jitter_buffer.Init(kPeriodUs);
+  float block[kBlockSize];
+  float output[kBlockSize];
+
+  // Pop before any push outputs silence.
+  CHECK(!jitter_buffer.Pop(output));
+  CHECK(output[0] == 0.0f);
+
+  int n;
+  for (n = 0; n < 100; ++n) {
+    MakeBlock(1, block);
+    jitter_buffer.Push(block, n * kPeriodUs);
+    CHECK(jitter_buffer.Pop(output));
+  }
+
+  // Stop pushing. The first missing block is held.
+  CHECK(!jitter_buffer.Pop(output));
+  for (int i = 0; i < kBlockSize; ++i) {
+    CHECK(output[i] == 1.0f);
+  }
+  CHECK(jitter_buffer.stats().num_underruns == 1);
+  // Then fades linearly to zero over kFadeBlocks blocks.
+  float prev = 1.0f;
+  for (int b = 0; b < TestJitterBuffer::kFadeBlocks; ++b) {
+    CHECK(!jitter_buffer.Pop(output));
+    for (int i = 0; i < kNumFrames; ++i) {
+      const float value = output[i * kNumChannels];
+      CHECK(value < prev);
+      CHECK(output[i * kNumChannels + 1] == value);
+      prev = value;
+    }
+  }
+  CHECK(fabs(prev) < 1e-6f);
+  CHECK(!jitter_buffer.Pop(output));
+  CHECK(output[0] == 0.0f && output[kBlockSize - 1] == 0.0f);
+  n += 1 + TestJitterBuffer::kFadeBlocks + 1;
+  CHECK(jitter_buffer.stats().num_concealed_blocks ==
+        1 + TestJitterBuffer::kFadeBlocks + 1 + 1);
+
+  // The underrun added a block of margin to the target.
+  CHECK(jitter_buffer.target_depth() >= 2);
+  // Resume pushing. Output is silent while priming, then fades in.
+  bool playing = false;
+  for (; !playing; ++n) {
+    MakeBlock(1, block);
+    jitter_buffer.Push(block, n * kPeriodUs);
+    playing = jitter_buffer.Pop(output);
+    if (!playing) { CHECK(output[0] == 0.0f); }
+  }
+  for (int i = 0; i < kNumFrames; ++i) {
+    CHECK(fabs(output[i * kNumChannels] - (i + 1.0f) / kNumFrames) < 1e-6f);
+  }
+  MakeBlock(1, block);
+  jitter_buffer.Push(block, n * kPeriodUs);
+  CHECK(jitter_buffer.Pop(output));
+  CHECK(output[0] == 1.0f);
+  CHECK(jitter_buffer.stats().num_underruns == 1);
+}
+
+// Pushing to a full buffer drops the block.
+void TestOverflow() {
+  puts("TestOverflow");
+  TestJitterBuffer jitter_buffer;
+  jitter_buffer.Init(kPeriodUs);
+  float block[kBlockSize];
+  for (int n = 0; n < TestJitterBuffer::kCapacity; ++n) {
+    MakeBlock(n, block);
+    CHECK(jitter_buffer.Push(block, 0));
+  }
+  CHECK(jitter_buffer.depth() == TestJitterBuffer::kCapacity);
+  CHECK(!jitter_buffer.Push(block, 0));
+  CHECK(jitter_buffer.stats().num_dropped_blocks == 1);
+  CHECK(jitter_buffer.target_depth() == TestJitterBuffer::kCapacity);
+
+  // Blocks play in order.
+  float output[kBlockSize];
+  for (int n = 0; n < TestJitterBuffer::kCapacity; ++n) {
+    CHECK(jitter_buffer.Pop(output));
+    CHECK(output[kBlockSize - 1] == n);
+  }
+
+  jitter_buffer.Reset();
+  CHECK(jitter_buffer.depth() == 0);
+  CHECK(jitter_buffer.target_depth() == 1);
+  CHECK(!jitter_buffer.playing());
+  CHECK(jitter_buffer.stats().num_dropped_blocks == 0);
+}
+
+// Lost blocks resync the nominal clock rather than being measured as jitter.
+void TestLostBlocks() {
+  puts("TestLostBlocks");
+  TestJitterBuffer jitter_buffer;
+  jitter_buffer.Init(kPeriodUs);
+  float block[kBlockSize];
+  float output[kBlockSize];
+  MakeBlock(0, block);
+  for (int n = 0; n < 100; ++n) {
+    jitter_buffer.Push(block, n * kPeriodUs);
+    jitter_buffer.Pop(output);
+  }
+  // Skip 1000 blocks.
+  for (int n = 1100; n < 1200; ++n) {
+    jitter_buffer.Push(block, n * kPeriodUs);
+    jitter_buffer.Pop(output);
+  }
+  CHECK(jitter_buffer.stats().jitter_ms == 0.0f);
+}
+
+}  // namespace audio_tactile
+
+// NOLINTEND
+
+int main(int argc, char** argv) {
+  audio_tactile::TestPeriodicArrival();
+  audio_tactile::TestBurstyArrival();
+  audio_tactile::TestTrim();
+  audio_tactile::TestConcealment();
+  audio_tactile::TestOverflow();
+  audio_tactile::TestLostBlocks();
+
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,73 @@
+// Copyright 2022 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/cpp/latency.h"
+
+#include <math.h>
+
+#include "src/dsp/logging.h"
+
+// NOLINTBEGIN(readability/check)
+
+namespace audio_tactile {
+
+constexpr float kSampleRateHz = 15625.0f;
+
+// Test that both profiles produce one PWM sequence per TactileProcessor block.
+void TestConfigs() {
+  puts("TestConfigs");
+  constexpr LatencyProfile kProfiles[] = {LatencyProfile::kDefault,
+                                          LatencyProfile::kLowLatency};
+  for (LatencyProfile profile : kProfiles) {
+    const LatencyConfig config = GetLatencyConfig(profile);
+    CHECK(1 <= config.mic_block_size && config.mic_block_size <= kAdcDataSize);
+    CHECK(config.carl_block_size % config.mic_block_size == 0);
+    CHECK(config.carl_block_size ==
+          config.decimation_factor * kNumPwmValues);
+  }
+
+  const LatencyConfig default_config =
+      GetLatencyConfig(LatencyProfile::kDefault);
+  CHECK(default_config.mic_block_size == 64);
+  CHECK(default_config.carl_block_size == 64);
+  CHECK(default_config.decimation_factor == 8);
+}
+
+// Test that the low latency profile has about half the latency.
+void TestEstimateLatency() {
+  puts("TestEstimateLatency");
+  const float default_ms = EstimateLatencyMs(
+      GetLatencyConfig(LatencyProfile::kDefault), kSampleRateHz);
+  const float low_ms = EstimateLatencyMs(
+      GetLatencyConfig(LatencyProfile::kLowLatency), kSampleRateHz);
+
+  CHECK(fabs(default_ms - 8.192f) < 1e-3f);  // (64 + 64) / 15625 Hz.
+  CHECK(fabs(low_ms - 4.096f) < 1e-3f);  // (32 + 32) / 15625 Hz.
+
+  // The input delay is the larger of the mic and TactileProcessor blocks.
+  const LatencyConfig config = {16, 64, 8};
+  CHECK(fabs(EstimateLatencyMs(config, 16000.0f) - 8.0f) < 1e-3f);
+}
+
+}  // namespace audio_tactile
+
+// NOLINTEND
+
+int main(int argc, char** argv) {
+  audio_tactile::TestConfigs();
+  audio_tactile::TestEstimateLatency();
+
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,168 @@
+// Copyright 2022 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/cpp/message_packer.h"
+
+#include <string.h>
+
+#include "src/cpp/constants.h"
+#include "src/dsp/logging.h"
+
+// NOLINTBEGIN(readability/check)
+
+namespace audio_tactile {
+
+// Makes a kAllTactorsSamples message with BLE header, filled with `value`.
+Message MakeAllTactorsMessage(uint8_t value) {
+  uint8_t samples[kNumTotalPwm * kNumPwmValues];
+  memset(samples, value, sizeof(samples));
+  Message message;
+  message.WriteAllTactorsSamples(
+      Slice<const uint8_t, kNumTotalPwm * kNumPwmValues>(samples));
+  message.SetBleHeader();
+  return message;
+}
+
+// Checks that `actual` has the same bytes as `expected`.
+void CheckSameMessage(const Message& actual, const Message& expected) {
+  CHECK(actual.size() == expected.size());
+  CHECK(memcmp(actual.data(), expected.data(), expected.size()) == 0);
+}
+
+// With the max MTU, two 100-byte kAllTactorsSamples messages fit in a packet
+// and unpack in order.
+void TestPackAndUnpack() {
+  puts("TestPackAndUnpack");
+  MessagePacker packer;
+  packer.SetAttMtu(MessagePacker::kMaxAttMtu);
+  CHECK(packer.capacity() == 244);
+  CHECK(packer.empty());
+
+  const Message first = MakeAllTactorsMessage(1);
+  const Message second = MakeAllTactorsMessage(2);
+  Message temperature;
+  temperature.WriteTemperature(25.0f);
+  temperature.SetBleHeader();
+  CHECK(packer.Append(first));
+  CHECK(packer.Append(second));
+  CHECK(packer.Append(temperature));
+  CHECK(packer.num_messages() == 3);
+  CHECK(packer.packet().size() == 2 * first.size() + temperature.size());
+  // A third kAllTactorsSamples doesn't fit.
+  CHECK(!packer.Append(MakeAllTactorsMessage(3)));
+  CHECK(packer.num_messages() == 3);
+
+  MessageUnpacker unpacker(packer.packet().data(), packer.packet().size());
+  Message message;
+  CHECK(unpacker.Next(&message));
+  CheckSameMessage(message, first);
+  CHECK(unpacker.Next(&message));
+  CheckSameMessage(message, second);
+  CHECK(unpacker.Next(&message));
+  CheckSameMessage(message, temperature);
+  float temperature_c;
+  CHECK(message.ReadTemperature(&temperature_c) && temperature_c == 25.0f);
+  CHECK(!unpacker.Next(&message));
+  CHECK(!unpacker.error());
+
+  packer.Clear();
+  CHECK(packer.empty());
+  CHECK(packer.num_messages() == 0);
+}
+
+// With the default MTU, a message larger than the capacity is still accepted
+// alone in an empty packet.
+void TestDefaultMtu() {
+  puts("TestDefaultMtu");
+  MessagePacker packer;
+  CHECK(packer.capacity() == 20);
+  packer.SetAttMtu(0);  // Invalid MTU is treated as the default.
+  CHECK(packer.capacity() == 20);
+  packer.SetAttMtu(1000);
+  CHECK(packer.capacity() == MessagePacker::kMaxPacketSize);
+  packer.SetAttMtu(MessagePacker::kDefaultAttMtu);
+
+  const Message message = MakeAllTactorsMessage(7);
+  CHECK(packer.Append(message));
+  CHECK(!packer.Append(message));
+  CHECK(packer.packet().size() == message.size());
+}
+
+// A single message, as sent without packing, unpacks as one message.
+void TestUnpackSingleMessage() {
+  puts("TestUnpackSingleMessage");
+  Message sent;
+  sent.WriteBatteryVoltage(3.7f);
+  sent.SetBleHeader();
+  MessageUnpacker unpacker(sent.data(), sent.size());
+  Message message;
+  CHECK(unpacker.Next(&message));
+  CheckSameMessage(message, sent);
+  CHECK(!unpacker.Next(&message));
+  CHECK(!unpacker.error());
+}
+
+// Corrupt or truncated messages stop unpacking with an error.
+void TestUnpackInvalid() {
+  puts("TestUnpackInvalid");
+  MessagePacker packer;
+  packer.SetAttMtu(MessagePacker::kMaxAttMtu);
+  const Message first = MakeAllTactorsMessage(1);
+  const Message second = MakeAllTactorsMessage(2);
+  packer.Append(first);
+  packer.Append(second);
+  uint8_t bytes[MessagePacker::kMaxPacketSize];
+  const int size = packer.packet().size();
+  memcpy(bytes, packer.packet().data(), size);
+  Message message;
+
+  {  // Truncated second message.
+    MessageUnpacker unpacker(bytes, size - 1);
+    CHECK(unpacker.Next(&message));
+    CHECK(!unpacker.Next(&message));
+    CHECK(unpacker.error());
+  }
+  {  // Trailing bytes shorter than a header.
+    MessageUnpacker unpacker(bytes, first.size() + 2);
+    CHECK(unpacker.Next(&message));
+    CHECK(!unpacker.Next(&message));
+    CHECK(unpacker.error());
+  }
+  {  // Corrupt payload in the first message skips the rest.
+    bytes[10] ^= 1;
+    MessageUnpacker unpacker(bytes, size);
+    CHECK(!unpacker.Next(&message));
+    CHECK(unpacker.error());
+    CHECK(!unpacker.Next(&message));
+  }
+  {  // Empty packet.
+    MessageUnpacker unpacker(bytes, 0);
+    CHECK(!unpacker.Next(&message));
+    CHECK(!unpacker.error());
+  }
+}
+
+}  // namespace audio_tactile
+
+// NOLINTEND
+
+int main(int argc, char** argv) {
+  audio_tactile::TestPackAndUnpack();
+  audio_tactile::TestDefaultMtu();
+  audio_tactile::TestUnpackSingleMessage();
+  audio_tactile::TestUnpackInvalid();
+
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
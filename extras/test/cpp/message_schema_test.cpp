@@ -0,0 +1,84 @@
+// Copyright 2022 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/cpp/message_schema.h"
+
+#include "src/dsp/logging.h"
+
+// NOLINTBEGIN(readability/check)
+
+namespace audio_tactile {
+
+using TestSchema = MessageSchema<U8Field, U16Field, F32Field, U32Field,
+                                 SaturatedU8Field, ArrayField<int16_t, 3>>;
+static_assert(TestSchema::kPayloadSize == 1 + 2 + 4 + 4 + 1 + 6,
+              "TestSchema has wrong payload size");
+static_assert(MessageSchema<>::kPayloadSize == 0,
+              "Empty schema has wrong payload size");
+
+// Test writing and reading all field types.
+void TestRoundTrip() {
+  puts("TestRoundTrip");
+  const int16_t array[3] = {-7, 300, 12345};
+  uint8_t payload[TestSchema::kPayloadSize];
+  TestSchema::Write(payload, 42, 0xbeef, 2.5f, 0x12345678, 999,
+                    Slice<const int16_t, 3>(array));
+
+  // Fields are written consecutively in little endian order.
+  CHECK(payload[0] == 42);
+  CHECK(payload[1] == 0xef && payload[2] == 0xbe);
+  CHECK(payload[7] == 0x78 && payload[10] == 0x12);
+  CHECK(payload[11] == 255);  // SaturatedU8Field saturated 999 to 255.
+
+  int u8;
+  uint16_t u16;
+  float f32;
+  uint32_t u32;
+  int saturated;
+  int16_t recovered_array[3];
+  TestSchema::Read(payload, &u8, &u16, &f32, &u32, &saturated,
+                   Slice<int16_t, 3>(recovered_array));
+  CHECK(u8 == 42);
+  CHECK(u16 == 0xbeef);
+  CHECK(f32 == 2.5f);
+  CHECK(u32 == 0x12345678);
+  CHECK(saturated == 255);
+  CHECK(recovered_array[0] == -7);
+  CHECK(recovered_array[1] == 300);
+  CHECK(recovered_array[2] == 12345);
+}
+
+// Test that U8Field truncates and SaturatedU8Field saturates.
+void TestU8Fields() {
+  puts("TestU8Fields");
+  uint8_t byte;
+  U8Field::Write(258, &byte);
+  CHECK(byte == 2);
+  SaturatedU8Field::Write(-5, &byte);
+  CHECK(byte == 0);
+  SaturatedU8Field::Write(258, &byte);
+  CHECK(byte == 255);
+}
+
+}  // namespace audio_tactile
+
+// NOLINTEND
+
+int main(int argc, char** argv) {
+  audio_tactile::TestRoundTrip();
+  audio_tactile::TestU8Fields();
+
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
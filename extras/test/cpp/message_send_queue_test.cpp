@@ -0,0 +1,193 @@
+// Copyright 2022 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/cpp/message_send_queue.h"
+
+#include <thread>  // NOLINT(build/c++11)
+
+#include "src/dsp/logging.h"
+
+// NOLINTBEGIN(readability/check)
+
+namespace audio_tactile {
+
+// Records the completions of queued messages.
+struct DoneLog {
+  int num_sent = 0;
+  int num_dropped = 0;
+  int last_id = -1;
+};
+
+struct DoneContext {
+  DoneLog* log;
+  int id;
+};
+
+void OnDone(void* context, MessageSendStatus status) {
+  DoneContext* done = static_cast<DoneContext*>(context);
+  if (status == MessageSendStatus::kSent) {
+    ++done->log->num_sent;
+  } else {
+    ++done->log->num_dropped;
+  }
+  done->log->last_id = done->id;
+}
+
+// Test queueing, sending in order, and completion callbacks.
+void TestSendAndComplete() {
+  puts("TestSendAndComplete");
+  MessageSendQueue<4> queue;
+  CHECK(decltype(queue)::kCapacity == 4);
+  CHECK(queue.empty());
+  CHECK(queue.Front() == nullptr);
+
+  DoneLog log;
+  DoneContext contexts[4];
+  for (int i = 0; i < 4; ++i) {
+    contexts[i] = {&log, i};
+    Message* message = queue.BeginSend();
+    CHECK(message != nullptr);
+    message->WriteTemperature(20.0f + i);
+    queue.EndSend(OnDone, &contexts[i]);
+  }
+  CHECK(queue.full());
+  CHECK(queue.BeginSend() == nullptr);  // No free slots.
+  Message extra;
+  extra.WriteBatteryVoltage(3.7f);
+  CHECK(!queue.Send(extra, OnDone, &contexts[0]));
+  CHECK(log.num_sent == 0 && log.num_dropped == 0);
+
+  // Messages come out in FIFO order.
+  for (int i = 0; i < 4; ++i) {
+    Message* message = queue.Front();
+    CHECK(message != nullptr);
+    float temperature_c;
+    CHECK(message->ReadTemperature(&temperature_c));
+    CHECK(temperature_c == 20.0f + i);
+    queue.Complete(MessageSendStatus::kSent);
+    CHECK(log.num_sent == i + 1);
+    CHECK(log.last_id == i);
+  }
+  CHECK(queue.empty());
+
+  // Completion function is optional.
+  CHECK(queue.Send(extra));
+  queue.Complete(MessageSendStatus::kSent);
+  CHECK(log.num_sent == 4);
+}
+
+// Test that DropAll() completes pending messages as dropped.
+void TestDropAll() {
+  puts("TestDropAll");
+  MessageSendQueue<8> queue;
+  DoneLog log;
+  DoneContext contexts[3];
+  Message message;
+  message.WriteBatteryVoltage(3.7f);
+  for (int i = 0; i < 3; ++i) {
+    contexts[i] = {&log, i};
+    CHECK(queue.Send(message, OnDone, &contexts[i]));
+  }
+
+  queue.DropAll();
+  CHECK(queue.empty());
+  CHECK(log.num_sent == 0);
+  CHECK(log.num_dropped == 3);
+  CHECK(log.last_id == 2);
+}
+
+struct Resender {
+  MessageSendQueue<2>* queue;
+  int remaining;
+};
+
+void Resend(void* context, MessageSendStatus status) {
+  Resender* resender = static_cast<Resender*>(context);
+  if (--resender->remaining > 0) {
+    Message* message = resender->queue->BeginSend();
+    CHECK(message != nullptr);
+    message->WriteBatteryVoltage(resender->remaining);
+    resender->queue->EndSend(Resend, resender);
+  }
+}
+
+// A completion function may queue the next message, since the slot is released
+// before it is called.
+void TestResendFromCallback() {
+  puts("TestResendFromCallback");
+  MessageSendQueue<2> queue;
+  Resender resender = {&queue, 5};
+  Message message;
+  message.WriteBatteryVoltage(5.0f);
+  CHECK(queue.Send(message, Resend, &resender));
+  CHECK(queue.Send(message));  // Fill the queue.
+
+  int num_sent = 0;
+  while (Message* front = queue.Front()) {
+    float voltage;
+    CHECK(front->ReadBatteryVoltage(&voltage));
+    queue.Complete(MessageSendStatus::kSent);
+    ++num_sent;
+  }
+  CHECK(num_sent == 6);
+  CHECK(resender.remaining == 0);
+}
+
+// Test a producer thread sending to a consumer thread.
+void TestConcurrentSend() {
+  puts("TestConcurrentSend");
+  constexpr int kNumMessages = 5000;
+  MessageSendQueue<4> queue;
+  DoneLog log;
+  DoneContext context = {&log, 0};
+
+  std::thread producer([&queue, &context]() {
+    for (int i = 0; i < kNumMessages; ++i) {
+      Message* message;
+      while ((message = queue.BeginSend()) == nullptr) {
+        std::this_thread::yield();
+      }
+      message->WriteTemperature(static_cast<float>(i));
+      queue.EndSend(OnDone, &context);
+    }
+  });
+
+  for (int i = 0; i < kNumMessages; ++i) {
+    Message* message;
+    while ((message = queue.Front()) == nullptr) {
+      std::this_thread::yield();
+    }
+    float temperature_c;
+    CHECK(message->ReadTemperature(&temperature_c));
+    CHECK(temperature_c == static_cast<float>(i));
+    queue.Complete(MessageSendStatus::kSent);
+  }
+  producer.join();
+
+  CHECK(queue.empty());
+  CHECK(log.num_sent == kNumMessages);
+}
+
+}  // namespace audio_tactile
+// NOLINTEND
+
+int main(int argc, char** argv) {
+  audio_tactile::TestSendAndComplete();
+  audio_tactile::TestDropAll();
+  audio_tactile::TestResendFromCallback();
+  audio_tactile::TestConcurrentSend();
+
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
@@ -46,6 +46,24 @@ std::vector<T> RandomValues(int n, std::mt19937* rng) {
 }
 
 // Test the kAudioSamples message.
+// Test copying a message with BLE header while verifying its checksum.
+void TestCopyAndVerifyChecksum() {
+  puts("TestCopyAndVerifyChecksum");
+  Message sent;
+  sent.WriteTemperature(25.5f);
+  sent.SetBleHeader();
+  CHECK(sent.VerifyChecksum());
+
+  Message received;
+  CHECK(received.CopyAndVerifyChecksum(sent.data()));
+  CHECK(received.size() == sent.size());
+  CHECK(memcmp(received.data(), sent.data(), sent.size()) == 0);
+  CHECK(received.VerifyChecksum());
+
+  sent.data()[5] ^= 1;  // Corrupt a payload byte.
+  CHECK(!received.CopyAndVerifyChecksum(sent.data()));
+}
+
 void TestAudioSamples() {
   puts("TestAudioSamples");
   std::mt19937 rng(0);
@@ -65,6 +83,64 @@ void TestAudioSamples() {
   CHECK(std::equal(recovered, recovered + kAdcDataSize, samples.begin()));
 }
 
+// Test the kAudioSamplesLowRate message.
+void TestAudioSamplesLowRate() {
+  puts("TestAudioSamplesLowRate");
+  std::mt19937 rng(0);
+  std::vector<int16_t> samples =
+      RandomValues<int16_t>(kLowRateAudioDataSize, &rng);
+  std::vector<uint8_t> codes =
+      RandomValues<uint8_t>(kLowRateAudioNumCodes, &rng);
+
+  Message message;
+  message.WriteAudioSamplesLowRate(
+      Slice<int16_t, kLowRateAudioDataSize>(samples.data()),
+      Slice<uint8_t, kLowRateAudioNumCodes>(codes.data()));
+  CHECK(message.type() == MessageType::kAudioSamplesLowRate);
+  CHECK(message.size() == Message::kHeaderSize + 72);
+
+  int16_t recovered_samples[kLowRateAudioDataSize];
+  uint8_t recovered_codes[kLowRateAudioNumCodes];
+  CHECK(message.ReadAudioSamplesLowRate(
+      Slice<int16_t, kLowRateAudioDataSize>(recovered_samples),
+      Slice<uint8_t, kLowRateAudioNumCodes>(recovered_codes)));
+  CHECK(std::equal(recovered_samples,
+                   recovered_samples + kLowRateAudioDataSize,
+                   samples.begin()));
+  CHECK(std::equal(recovered_codes, recovered_codes + kLowRateAudioNumCodes,
+                   codes.begin()));
+}
+
+// Test the kTactileFeatures message.
+void TestTactileFeatures() {
+  puts("TestTactileFeatures");
+  std::mt19937 rng(0);
+  std::vector<uint8_t> envelope_codes =
+      RandomValues<uint8_t>(kTactileFeaturesNumEnvelopeCodes, &rng);
+  std::vector<uint8_t> hex_codes =
+      RandomValues<uint8_t>(kTactileFeaturesNumHexCodes, &rng);
+
+  Message message;
+  message.WriteTactileFeatures(
+      Slice<uint8_t, kTactileFeaturesNumEnvelopeCodes>(envelope_codes.data()),
+      Slice<uint8_t, kTactileFeaturesNumHexCodes>(hex_codes.data()));
+  CHECK(message.type() == MessageType::kTactileFeatures);
+  CHECK(message.size() == Message::kHeaderSize + 39);
+
+  uint8_t recovered_envelope_codes[kTactileFeaturesNumEnvelopeCodes];
+  uint8_t recovered_hex_codes[kTactileFeaturesNumHexCodes];
+  CHECK(message.ReadTactileFeatures(
+      Slice<uint8_t, kTactileFeaturesNumEnvelopeCodes>(
+          recovered_envelope_codes),
+      Slice<uint8_t, kTactileFeaturesNumHexCodes>(recovered_hex_codes)));
+  CHECK(std::equal(recovered_envelope_codes,
+                   recovered_envelope_codes + kTactileFeaturesNumEnvelopeCodes,
+                   envelope_codes.begin()));
+  CHECK(std::equal(recovered_hex_codes,
+                   recovered_hex_codes + kTactileFeaturesNumHexCodes,
+                   hex_codes.begin()));
+}
+
 // Test the kTactor*Samples messages
 void TestSingleTactorSamples() {
   puts("TestSingleTactorSamples");
@@ -113,6 +189,33 @@ void TestAllTactorsSamples() {
   CHECK(std::equal(recovered, recovered + kSize, samples.begin()));
 }
 
+// Test the kAllTactorsSamplesCompressed message.
+void TestAllTactorsSamplesCompressed() {
+  puts("TestAllTactorsSamplesCompressed");
+  constexpr int kSize = kNumTotalPwm * kNumPwmValues;
+  // Slowly-varying samples, with deltas small enough to code losslessly.
+  uint8_t samples[kSize];
+  for (int i = 0; i < kSize; ++i) {
+    samples[i] = static_cast<uint8_t>(128 + (i % kNumTotalPwm) * 5 -
+                                      (i / kNumTotalPwm) * 3);
+  }
+
+  Message message;
+  message.WriteAllTactorsSamplesCompressed(Slice<uint8_t, kSize>(samples));
+  CHECK(message.type() == MessageType::kAllTactorsSamplesCompressed);
+  CHECK(message.payload().size() == 5 * kNumTotalPwm);
+
+  uint8_t recovered[kSize];
+  CHECK(message.ReadAllTactorsSamplesCompressed(
+      Slice<uint8_t, kSize>(recovered)));
+  CHECK(std::equal(recovered, recovered + kSize, samples));
+
+  // Reading fails on a truncated payload.
+  message.data()[3] = 59;
+  CHECK(!message.ReadAllTactorsSamplesCompressed(
+      Slice<uint8_t, kSize>(recovered)));
+}
+
 // Test the kTemperature message.
 void TestTemperature() {
   puts("TestTemperature");
@@ -124,6 +227,10 @@ void TestTemperature() {
   float recovered;
   CHECK(message.ReadTemperature(&recovered));
   CHECK(recovered == 12.345f);
+
+  // Reading fails on a truncated payload.
+  message.data()[3] = 3;
+  CHECK(!message.ReadTemperature(&recovered));
 }
 
 // Test the kBatteryVoltage message.
@@ -139,6 +246,274 @@ void TestBatteryVoltage() {
   CHECK(recovered == 3.750f);
 }
 
+// Test the kLatencyEstimate message.
+void TestLatencyEstimate() {
+  puts("TestLatencyEstimate");
+  Message message;
+  message.WriteLatencyEstimate(8.192f);
+  CHECK(message.type() == MessageType::kLatencyEstimate);
+  CHECK(message.payload().size() == 4);
+
+  float recovered;
+  CHECK(message.ReadLatencyEstimate(&recovered));
+  CHECK(recovered == 8.192f);
+}
+
+// Test the kJitterBufferStats message.
+void TestJitterBufferStats() {
+  puts("TestJitterBufferStats");
+  JitterBufferStats stats;
+  stats.latency_ms = 24.0f;
+  stats.jitter_ms = 13.5f;
+  stats.target_depth = 3;
+  stats.num_underruns = 2;
+  stats.num_concealed_blocks = 70000;
+  stats.num_dropped_blocks = 5;
+  Message message;
+  message.WriteJitterBufferStats(stats);
+  CHECK(message.type() == MessageType::kJitterBufferStats);
+  CHECK(message.payload().size() == 21);
+
+  JitterBufferStats recovered;
+  CHECK(message.ReadJitterBufferStats(&recovered));
+  CHECK(recovered.latency_ms == 24.0f);
+  CHECK(recovered.jitter_ms == 13.5f);
+  CHECK(recovered.target_depth == 3);
+  CHECK(recovered.num_underruns == 2);
+  CHECK(recovered.num_concealed_blocks == 70000);
+  CHECK(recovered.num_dropped_blocks == 5);
+
+  // Reading fails on a truncated payload.
+  message.data()[3] = 20;
+  CHECK(!message.ReadJitterBufferStats(&recovered));
+}
+
+// Test the kDeadlineStats message.
+void TestDeadlineStats() {
+  puts("TestDeadlineStats");
+  DeadlineMonitorStats stats;
+  stats.num_buffers = 100000;
+  stats.num_overruns = 3;
+  stats.num_near_misses = 41;
+  stats.mean_load = 0.625f;
+  stats.max_load = 1.25f;
+  Message message;
+  message.WriteDeadlineStats(stats);
+  CHECK(message.type() == MessageType::kDeadlineStats);
+  CHECK(message.payload().size() == 20);
+
+  DeadlineMonitorStats recovered;
+  CHECK(message.ReadDeadlineStats(&recovered));
+  CHECK(recovered.num_buffers == 100000);
+  CHECK(recovered.num_overruns == 3);
+  CHECK(recovered.num_near_misses == 41);
+  CHECK(recovered.mean_load == 0.625f);
+  CHECK(recovered.max_load == 1.25f);
+}
+
+// Test the kEnergyStats message.
+void TestEnergyStats() {
+  puts("TestEnergyStats");
+  EnergyMeterStats stats;
+  stats.num_minutes = 42;
+  stats.cpu_active_fraction = 0.375f;
+  for (int c = 0; c < kEnergyMeterMaxChannels; ++c) {
+    stats.channel_power[c] = 0.01f * c;
+  }
+  Message message;
+  message.WriteEnergyStats(stats);
+  CHECK(message.type() == MessageType::kEnergyStats);
+  CHECK(message.payload().size() == 104);
+
+  EnergyMeterStats recovered;
+  CHECK(message.ReadEnergyStats(&recovered));
+  CHECK(recovered.num_minutes == 42);
+  CHECK(recovered.cpu_active_fraction == 0.375f);
+  for (int c = 0; c < kEnergyMeterMaxChannels; ++c) {
+    CHECK(recovered.channel_power[c] == 0.01f * c);
+  }
+}
+
+// Test the kTimedTactorsSamples message.
+void TestTimedTactorsSamples() {
+  puts("TestTimedTactorsSamples");
+  std::mt19937 rng(0);
+  std::vector<uint8_t> samples =
+      RandomValues<uint8_t>(kNumTotalPwm * kNumPwmValues, &rng);
+
+  Message message;
+  message.WriteTimedTactorsSamples(
+      0xfedcba98, Slice<uint8_t, kNumTotalPwm * kNumPwmValues>(samples.data()));
+  CHECK(message.type() == MessageType::kTimedTactorsSamples);
+  CHECK(message.payload().size() == 100);
+
+  uint32_t presentation_us;
+  uint8_t recovered[kNumTotalPwm * kNumPwmValues];
+  CHECK(message.ReadTimedTactorsSamples(
+      &presentation_us,
+      Slice<uint8_t, kNumTotalPwm * kNumPwmValues>(recovered)));
+  CHECK(presentation_us == 0xfedcba98);
+  CHECK(std::equal(recovered, recovered + kNumTotalPwm * kNumPwmValues,
+                   samples.begin()));
+}
+
+// Test the kClockSyncRequest and kClockSyncResponse messages.
+void TestClockSync() {
+  puts("TestClockSync");
+  Message message;
+  message.WriteClockSyncRequest(123456789);
+  CHECK(message.type() == MessageType::kClockSyncRequest);
+  CHECK(message.payload().size() == 4);
+  uint32_t t1;
+  CHECK(message.ReadClockSyncRequest(&t1));
+  CHECK(t1 == 123456789);
+
+  message.WriteClockSyncResponse(123456789, 4000000000u, 4000000250u);
+  CHECK(message.type() == MessageType::kClockSyncResponse);
+  CHECK(message.payload().size() == 12);
+  uint32_t t2;
+  uint32_t t3;
+  CHECK(message.ReadClockSyncResponse(&t1, &t2, &t3));
+  CHECK(t1 == 123456789);
+  CHECK(t2 == 4000000000u);
+  CHECK(t3 == 4000000250u);
+}
+
+// Test the kTactilePatternChunk message.
+void TestTactilePatternChunk() {
+  puts("TestTactilePatternChunk");
+  std::mt19937 rng(0);
+  std::vector<uint8_t> data =
+      RandomValues<uint8_t>(kMaxTactilePatternChunkBytes, &rng);
+
+  Message message;
+  message.WriteTactilePatternChunk(5, 300, 246, data.data(), data.size());
+  CHECK(message.type() == MessageType::kTactilePatternChunk);
+  CHECK(message.payload().size() == Message::kMaxPayloadSize);
+
+  int id;
+  int total_size;
+  int offset;
+  const uint8_t* recovered;
+  int recovered_size;
+  CHECK(message.ReadTactilePatternChunk(&id, &total_size, &offset, &recovered,
+                                        &recovered_size));
+  CHECK(id == 5);
+  CHECK(total_size == 300);
+  CHECK(offset == 246);
+  CHECK(recovered_size == kMaxTactilePatternChunkBytes);
+  CHECK(std::equal(recovered, recovered + recovered_size, data.begin()));
+
+  // Empty chunk, as used to delete a pattern.
+  message.WriteTactilePatternChunk(2, 0, 0, nullptr, 0);
+  CHECK(message.payload().size() == 5);
+  CHECK(message.ReadTactilePatternChunk(&id, &total_size, &offset, &recovered,
+                                        &recovered_size));
+  CHECK(id == 2);
+  CHECK(total_size == 0);
+  CHECK(recovered_size == 0);
+}
+
+// Test the kPlayTactilePattern and kTactilePatternUploadStatus messages.
+void TestPlayTactilePattern() {
+  puts("TestPlayTactilePattern");
+  Message message;
+  message.WritePlayTactilePattern(7);
+  CHECK(message.type() == MessageType::kPlayTactilePattern);
+  CHECK(message.payload().size() == 1);
+  int id;
+  CHECK(message.ReadPlayTactilePattern(&id));
+  CHECK(id == 7);
+
+  message.WriteTactilePatternUploadStatus(3, 1);
+  CHECK(message.type() == MessageType::kTactilePatternUploadStatus);
+  CHECK(message.payload().size() == 2);
+  int status;
+  CHECK(message.ReadTactilePatternUploadStatus(&id, &status));
+  CHECK(id == 3);
+  CHECK(status == 1);
+}
+
+// Test the kEnvelopeLogEntries message.
+void TestEnvelopeLogEntries() {
+  puts("TestEnvelopeLogEntries");
+  EnvelopeLogEntry entries[kMaxEnvelopeLogEntriesPerMessage + 1];
+  for (int i = 0; i <= kMaxEnvelopeLogEntriesPerMessage; ++i) {
+    entries[i].timestamp = 3000000000u + i;
+    for (int j = 0; j < kEnvelopeTrackerRecordBytes; ++j) {
+      entries[i].record[j] = static_cast<uint8_t>(10 * i + j);
+    }
+  }
+
+  Message message;
+  // At most kMaxEnvelopeLogEntriesPerMessage entries are written.
+  message.WriteEnvelopeLogEntries(entries,
+                                  kMaxEnvelopeLogEntriesPerMessage + 1);
+  CHECK(message.type() == MessageType::kEnvelopeLogEntries);
+  CHECK(message.payload().size() == 119);
+
+  EnvelopeLogEntry recovered[kMaxEnvelopeLogEntriesPerMessage];
+  int num_entries;
+  CHECK(message.ReadEnvelopeLogEntries(recovered, &num_entries));
+  CHECK(num_entries == kMaxEnvelopeLogEntriesPerMessage);
+  for (int i = 0; i < num_entries; ++i) {
+    CHECK(recovered[i].timestamp == entries[i].timestamp);
+    CHECK(memcmp(recovered[i].record, entries[i].record,
+                 kEnvelopeTrackerRecordBytes) == 0);
+  }
+
+  // An empty message marks the end of the download.
+  message.WriteEnvelopeLogEntries(entries, 0);
+  CHECK(message.payload().size() == 0);
+  CHECK(message.ReadEnvelopeLogEntries(recovered, &num_entries));
+  CHECK(num_entries == 0);
+
+  // Reading fails on a truncated payload.
+  message.WriteEnvelopeLogEntries(entries, 2);
+  message.data()[3] = 20;
+  CHECK(!message.ReadEnvelopeLogEntries(recovered, &num_entries));
+}
+
+// Test the kEnvelopeEvents message.
+void TestEnvelopeEvents() {
+  puts("TestEnvelopeEvents");
+  constexpr int kNumEvents = kMaxEnvelopeEventsPerMessage + 1;
+  uint8_t events[kEnvelopeEventBytes * kNumEvents];
+  for (int i = 0; i < kEnvelopeEventBytes * kNumEvents; ++i) {
+    events[i] = static_cast<uint8_t>(3 * i);
+  }
+
+  Message message;
+  // At most kMaxEnvelopeEventsPerMessage events are written.
+  message.WriteEnvelopeEvents(events, kNumEvents);
+  CHECK(message.type() == MessageType::kEnvelopeEvents);
+  CHECK(message.payload().size() == 128);
+
+  uint8_t recovered[kEnvelopeEventBytes * kMaxEnvelopeEventsPerMessage];
+  int num_events;
+  CHECK(message.ReadEnvelopeEvents(recovered, &num_events));
+  CHECK(num_events == kMaxEnvelopeEventsPerMessage);
+  CHECK(memcmp(recovered, events, sizeof(recovered)) == 0);
+
+  // Reading fails if the payload isn't a whole number of events.
+  message.WriteEnvelopeEvents(events, 3);
+  message.data()[3] = 5;
+  CHECK(!message.ReadEnvelopeEvents(recovered, &num_events));
+}
+
+// Test the kFlashWriteStatus message.
+void TestFlashWriteStatus() {
+  puts("TestFlashWriteStatus");
+  Message message;
+  message.WriteFlashWriteStatus(2);
+  CHECK(message.type() == MessageType::kFlashWriteStatus);
+  CHECK(message.payload().size() == 1);
+
+  int recovered;
+  CHECK(message.ReadFlashWriteStatus(&recovered));
+  CHECK(recovered == 2);
+}
+
 // Test the kTuning message.
 void TestTuning() {
   puts("TestTuning");
@@ -391,6 +766,8 @@ void TestSimpleMessages() {
                     &Message::WriteGetChannelMap);
   TestSimpleMessage("GetDeviceName", MessageType::kGetDeviceName,
                     &Message::WriteGetDeviceName);
+  TestSimpleMessage("GetEnvelopeLog", MessageType::kGetEnvelopeLog,
+                    &Message::WriteGetEnvelopeLog);
   TestSimpleMessage("StreamDataStart", MessageType::kStreamDataStart,
                     &Message::WriteStreamDataStart);
   TestSimpleMessage("StreamDataStop", MessageType::kStreamDataStop,
@@ -402,11 +779,26 @@ void TestSimpleMessages() {
 // NOLINTEND
 
 int main(int argc, char** argv) {
+  audio_tactile::TestCopyAndVerifyChecksum();
   audio_tactile::TestAudioSamples();
+  audio_tactile::TestAudioSamplesLowRate();
+  audio_tactile::TestTactileFeatures();
   audio_tactile::TestSingleTactorSamples();
   audio_tactile::TestAllTactorsSamples();
+  audio_tactile::TestAllTactorsSamplesCompressed();
   audio_tactile::TestTemperature();
   audio_tactile::TestBatteryVoltage();
+  audio_tactile::TestLatencyEstimate();
+  audio_tactile::TestJitterBufferStats();
+  audio_tactile::TestDeadlineStats();
+  audio_tactile::TestEnergyStats();
+  audio_tactile::TestTimedTactorsSamples();
+  audio_tactile::TestClockSync();
+  audio_tactile::TestTactilePatternChunk();
+  audio_tactile::TestPlayTactilePattern();
+  audio_tactile::TestEnvelopeLogEntries();
+  audio_tactile::TestEnvelopeEvents();
+  audio_tactile::TestFlashWriteStatus();
   audio_tactile::TestTuning();
   audio_tactile::TestTactilePattern();
   audio_tactile::TestChannelMap();
@@ -0,0 +1,233 @@
+// Copyright 2022 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/cpp/processing_graph.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+#include <vector>
+
+#include "src/dsp/logging.h"
+
+// NOLINTBEGIN(readability/check)
+
+namespace audio_tactile {
+
+constexpr float kSampleRateHz = 16000.0f;
+constexpr int kBlockSize = 64;
+constexpr int kDecimationFactor = 4;
+constexpr int kOutputFrames = kBlockSize / kDecimationFactor;
+constexpr float kOutputSampleRateHz = kSampleRateHz / kDecimationFactor;
+const int kNumTactors = kTactileProcessorNumTactors;
+
+// Makes a test signal of a tone in noise.
+std::vector<float> MakeInput(int num_samples) {
+  srand(0);
+  std::vector<float> input(num_samples);
+  for (int i = 0; i < num_samples; ++i) {
+    const float t = i / kSampleRateHz;
+    input[i] = 0.3f * sin(2.0 * M_PI * 300.0 * t) +
+               0.05f * (static_cast<float>(rand()) / RAND_MAX - 0.5f);
+  }
+  return input;
+}
+
+TactileProcessor* MakeTactileProcessor() {
+  TactileProcessorParams params;
+  TactileProcessorSetDefaultParams(&params);
+  params.frontend_params.input_sample_rate_hz = kSampleRateHz;
+  params.frontend_params.block_size = kBlockSize;
+  params.decimation_factor = kDecimationFactor;
+  return CHECK_NOTNULL(TactileProcessorMake(&params));
+}
+
+void InitPostProcessor(PostProcessor* post_processor) {
+  PostProcessorParams params;
+  PostProcessorSetDefaultParams(&params);
+  CHECK(PostProcessorInit(post_processor, &params, kOutputSampleRateHz,
+                          kNumTactors));
+}
+
+// Reverses the channel order and adds two silent channels.
+void InitChannelMap(ChannelMap* channel_map) {
+  ChannelMapInit(channel_map, kNumTactors + 2);
+  channel_map->num_input_channels = kNumTactors;
+  for (int c = 0; c < kNumTactors; ++c) {
+    channel_map->sources[c] = kNumTactors - 1 - c;
+    channel_map->gains[c] = 0.5f + 0.1f * c;
+  }
+  for (int c = kNumTactors; c < kNumTactors + 2; ++c) {
+    channel_map->sources[c] = 0;
+    channel_map->gains[c] = 0.0f;
+  }
+}
+
+// Graph output matches hand-wired TactileProcessor -> PostProcessor ->
+// ChannelMap.
+void TestMatchesHandWired() {
+  puts("TestMatchesHandWired");
+  TactileProcessor* processor_graph = MakeTactileProcessor();
+  TactileProcessor* processor_wired = MakeTactileProcessor();
+  PostProcessor post_processor_graph;
+  PostProcessor post_processor_wired;
+  InitPostProcessor(&post_processor_graph);
+  InitPostProcessor(&post_processor_wired);
+  ChannelMap channel_map;
+  InitChannelMap(&channel_map);
+
+  ProcessingGraph<4, 512> graph;
+  CHECK(graph.Add(MakeTactileProcessorNode(processor_graph, kSampleRateHz)));
+  CHECK(graph.Add(MakePostProcessorNode(&post_processor_graph, kOutputFrames,
+                                        kOutputSampleRateHz)));
+  CHECK(graph.Add(MakeChannelMapNode(&channel_map, kOutputFrames)));
+  CHECK(graph.Init());
+  CHECK(graph.ready());
+  CHECK(graph.input_size() == kBlockSize);
+  CHECK(graph.output_size() == (kNumTactors + 2) * kOutputFrames);
+  // PostProcessor runs in place in the TactileProcessor's output buffer.
+  CHECK(graph.node_output(0) == graph.node_output(1));
+  CHECK(graph.node_output(1) != graph.node_output(2));
+  CHECK(graph.required_floats() == (2 * kNumTactors + 2) * kOutputFrames);
+
+  std::vector<float> tactile(kNumTactors * kOutputFrames);
+  std::vector<float> mapped((kNumTactors + 2) * kOutputFrames);
+  const int num_blocks = static_cast<int>(1.5f * kSampleRateHz) / kBlockSize;
+  const std::vector<float> input = MakeInput(num_blocks * kBlockSize);
+  float max_output = 0.0f;
+  for (int b = 0; b < num_blocks; ++b) {
+    const float* block = input.data() + b * kBlockSize;
+    const float* output = graph.ProcessSamples(block);
+    TactileProcessorProcessSamples(processor_wired, block, tactile.data());
+    PostProcessorProcessSamples(&post_processor_wired, tactile.data(),
+                                kOutputFrames);
+    ChannelMapApply(&channel_map, tactile.data(), kOutputFrames,
+                    mapped.data());
+
+    CHECK(output == graph.node_output(2));
+    for (int i = 0; i < static_cast<int>(mapped.size()); ++i) {
+      CHECK(output[i] == mapped[i]);
+      max_output = fmax(max_output, mapped[i]);
+    }
+  }
+  CHECK(max_output > 1e-4f);  // Check that the output isn't trivially zero.
+
+  TactileProcessorFree(processor_wired);
+  TactileProcessorFree(processor_graph);
+}
+
+// Adds one to each sample, in place.
+void AddOne(void* /*state*/, const float* input, int num_frames,
+            float* output) {
+  for (int i = 0; i < num_frames; ++i) {
+    output[i] = input[i] + 1.0f;
+  }
+}
+
+// Doubles the number of frames by repeating samples.
+void Upsample(void* /*state*/, const float* input, int num_frames,
+              float* output) {
+  for (int i = 0; i < num_frames; ++i) {
+    output[2 * i] = input[i];
+    output[2 * i + 1] = input[i];
+  }
+}
+
+GraphNode MakeTestNode(bool in_place, int input_frames, int output_frames) {
+  GraphNode node;
+  node.process = in_place ? AddOne : Upsample;
+  node.state = nullptr;
+  node.num_input_channels = 1;
+  node.input_frames = input_frames;
+  node.num_output_channels = 1;
+  node.output_frames = output_frames;
+  node.input_sample_rate_hz = 0.0f;
+  node.output_sample_rate_hz = 0.0f;
+  node.in_place = in_place;
+  return node;
+}
+
+// Check buffer planning for a chain of in-place and out-of-place nodes.
+void TestPlanning() {
+  puts("TestPlanning");
+  ProcessingGraph<5, 16> graph;
+  // An in-place first node copies the const input.
+  CHECK(graph.Add(MakeTestNode(true, 2, 2)));
+  CHECK(graph.Add(MakeTestNode(false, 2, 4)));
+  CHECK(graph.Add(MakeTestNode(true, 4, 4)));
+  CHECK(graph.Add(MakeTestNode(false, 4, 8)));
+  CHECK(graph.Add(MakeTestNode(true, 8, 8)));
+  CHECK(graph.Init());
+  // Slot 0 holds 8 floats, slot 1 holds 4.
+  CHECK(graph.required_floats() == 12);
+  CHECK(graph.node_output(0) == graph.node_output(3));
+  CHECK(graph.node_output(1) == graph.node_output(2));
+  CHECK(graph.node_output(0) != graph.node_output(1));
+  CHECK(graph.node_output(3) == graph.node_output(4));
+
+  const float input[2] = {1.0f, 5.0f};
+  const float* output = graph.ProcessSamples(input);
+  const float expected[8] = {3, 3, 3, 3, 7, 7, 7, 7};
+  for (int i = 0; i < 8; ++i) {
+    CHECK(output[i] == expected[i] + 1.0f);
+  }
+  CHECK(input[0] == 1.0f);  // Input is unchanged.
+
+  // Fails if kPoolFloats is too small.
+  ProcessingGraph<5, 11> small_graph;
+  CHECK(small_graph.Add(MakeTestNode(true, 2, 2)));
+  CHECK(small_graph.Add(MakeTestNode(false, 2, 4)));
+  CHECK(small_graph.Add(MakeTestNode(true, 4, 4)));
+  CHECK(small_graph.Add(MakeTestNode(false, 4, 8)));
+  CHECK(!small_graph.Init());
+  CHECK(!small_graph.ready());
+  CHECK(small_graph.required_floats() == 12);
+}
+
+// Init fails on mismatched shapes or rates.
+void TestMismatch() {
+  puts("TestMismatch");
+  ProcessingGraph<2, 64> graph;
+  CHECK(!graph.Init());  // No nodes.
+
+  CHECK(graph.Add(MakeTestNode(false, 2, 4)));
+  CHECK(graph.Add(MakeTestNode(true, 2, 2)));
+  CHECK(!graph.Add(MakeTestNode(true, 2, 2)));  // More than kMaxNodes.
+  CHECK(!graph.Init());  // Frames don't match.
+
+  TactileProcessor* processor = MakeTactileProcessor();
+  PostProcessor post_processor;
+  InitPostProcessor(&post_processor);
+
+  ProcessingGraph<2, 512> rate_graph;
+  CHECK(rate_graph.Add(MakeTactileProcessorNode(processor, kSampleRateHz)));
+  CHECK(rate_graph.Add(MakePostProcessorNode(&post_processor, kOutputFrames,
+                                             kSampleRateHz)));
+  CHECK(!rate_graph.Init());  // Rates don't match.
+
+  TactileProcessorFree(processor);
+}
+
+}  // namespace audio_tactile
+
+// NOLINTEND
+
+int main(int argc, char** argv) {
+  audio_tactile::TestMatchesHandWired();
+  audio_tactile::TestPlanning();
+  audio_tactile::TestMismatch();
+
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
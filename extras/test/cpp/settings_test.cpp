@@ -14,6 +14,9 @@
 
 #include "src/cpp/settings.h"
 
+#include <ctype.h>
+
+#include <algorithm>
 #include <string>
 
 #include "src/dsp/channel_map.h"
@@ -101,6 +104,11 @@ void TestCopyAndCompare() {
   b = a;
   CHECK(a == b);
 
+  a.latency = LatencyProfile::kLowLatency;
+  CHECK(a != b);  // Comparison considers latency profile.
+  b = a;
+  CHECK(a == b);
+
   a.tuning.values[kKnobInputGain] = 123;
   CHECK(a != b);  // Comparison considers tuning knobs.
   b = a;
@@ -126,6 +134,7 @@ void TestReadBasic() {
 # Test settings.
 device_name: Pineapple
 input: PDM mic
+latency: low
 tuning:
   input_gain: 123
   output_gain: 72
@@ -145,6 +154,7 @@ channel_map:
 
   CHECK(strcmp(settings.device_name, "Pineapple") == 0);
   CHECK(settings.input == InputSelection::kPdmMic);
+  CHECK(settings.latency == LatencyProfile::kLowLatency);
   CHECK(settings.tuning.values[kKnobInputGain] == 123);
   CHECK(settings.tuning.values[kKnobOutputGain] == 72);
   CHECK(settings.channel_map.gains[0] == ChannelGainFromControlValue(10));
@@ -188,6 +198,7 @@ abracadabra: this key should be ignored
 tuning:
   magic: 123
 input: mystery
+latency: instant
 device_name: Should read this
 )");
   InMemoryFile::Reader file_reader = settings_file.OpenForRead();
@@ -195,6 +206,7 @@ device_name: Should read this
   bool error_on_abracadabra = false;
   bool error_on_magic = false;
   bool error_on_mystery = false;
+  bool error_on_instant = false;
 
   settings.ReadFile(
       [&file_reader](char* buffer, int buffer_size) {
@@ -214,6 +226,10 @@ device_name: Should read this
             CHECK(strcmp(message, "Unknown input: \"mystery\"") == 0);
             error_on_mystery = true;
             break;
+          case 6:
+            CHECK(strcmp(message, "Unknown latency: \"instant\"") == 0);
+            error_on_instant = true;
+            break;
 
           default:
             // Unexpected error.
@@ -224,6 +240,7 @@ device_name: Should read this
   CHECK(error_on_abracadabra);
   CHECK(error_on_magic);
   CHECK(error_on_mystery);
+  CHECK(error_on_instant);
   CHECK(strcmp(settings.device_name, "Should read this") == 0);
 }
 
@@ -252,11 +269,81 @@ device_name: Should read this
   CHECK(strcmp(settings.device_name, "Should read this") == 0);
 }
 
+// Tests ReadFileChunked() for several chunk sizes.
+void TestReadChunked() {
+  puts("TestReadChunked");
+  // The last line has no newline, and the device_name line is longer than the
+  // reader's line buffer.
+  const std::string long_name(400, 'x');
+  const std::string content =
+      "# Test settings.\n"
+      "device_name: " + long_name + "\n"
+      "input: PDM mic\r\n"
+      "tuning:\n"
+      "  Input Gain: 123\n"
+      "  AGC-strength: 50\n"
+      "channel_map:\n"
+      "  sources: 3,2,1";
+
+  for (int chunk_size : {1, 5, 128}) {
+    size_t position = 0;
+    Settings settings;
+    settings.ReadFileChunked(
+        [&](char* buffer, int buffer_size) {
+          const int count = std::min<int>(
+              std::min(chunk_size, buffer_size), content.size() - position);
+          memcpy(buffer, content.data() + position, count);
+          position += count;
+          return count;
+        },
+        FailTestOnError  // There should be no errors for this input.
+        );
+
+    // The long line is truncated, then the name to kMaxDeviceNameLength.
+    CHECK(strlen(settings.device_name) == kMaxDeviceNameLength);
+    CHECK(settings.input == InputSelection::kPdmMic);
+    CHECK(settings.tuning.values[kKnobInputGain] == 123);
+    CHECK(settings.tuning.values[kKnobAgcStrength] == 50);
+    CHECK(settings.channel_map.sources[0] == 2);
+    CHECK(settings.channel_map.sources[1] == 1);
+    CHECK(settings.channel_map.sources[2] == 0);
+  }
+}
+
+// Tests that every tuning knob can be found by name.
+void TestReadAllTuningKnobs() {
+  puts("TestReadAllTuningKnobs");
+  std::string content = "tuning:\n";
+  for (int knob = 0; knob < kNumTuningKnobs; ++knob) {
+    // Write the knob name in snake_case, e.g. "denoising__vowel".
+    std::string key = kTuningKnobInfo[knob].name;
+    for (char& c : key) {
+      c = isalnum(c) ? tolower(c) : '_';
+    }
+    content += "  " + key + ": " + std::to_string(knob + 1) + "\n";
+  }
+  InMemoryFile settings_file(content.c_str());
+  InMemoryFile::Reader file_reader = settings_file.OpenForRead();
+  Settings settings;
+
+  settings.ReadFile(
+      [&file_reader](char* buffer, int buffer_size) {
+        return file_reader(buffer, buffer_size);
+      },
+      FailTestOnError  // There should be no errors for this input.
+      );
+
+  for (int knob = 0; knob < kNumTuningKnobs; ++knob) {
+    CHECK(settings.tuning.values[knob] == knob + 1);
+  }
+}
+
 void TestWriteBasic() {
   puts("TestWriteBasic");
   Settings settings;  // Make up some test settings.
   strcpy(settings.device_name, "Pineapple");  // NOLINT
   settings.input = InputSelection::kPdmMic;
+  settings.latency = LatencyProfile::kLowLatency;
   settings.tuning.values[kKnobInputGain] = 123;
   settings.tuning.values[kKnobOutputGain] = 72;
   settings.channel_map.gains[0] = ChannelGainFromControlValue(10);
@@ -276,6 +363,7 @@ void TestWriteBasic() {
   // Check that file contains these expected substrings.
   CHECK(strstr(settings_file.content(), "device_name: Pineapple"));
   CHECK(strstr(settings_file.content(), "input: PDM mic"));
+  CHECK(strstr(settings_file.content(), "latency: low"));
   CHECK(strstr(settings_file.content(), "  input_gain: 123"));
   CHECK(strstr(settings_file.content(), "  output_gain: 72"));
   CHECK(strstr(settings_file.content(), "  gains: 10, 0, 63, 63, 63"));
@@ -293,6 +381,7 @@ void TestWriteBasic() {
 
   CHECK(strcmp(recovered.device_name, "Pineapple") == 0);
   CHECK(recovered.input == InputSelection::kPdmMic);
+  CHECK(recovered.latency == LatencyProfile::kLowLatency);
   CHECK(recovered.tuning.values[kKnobInputGain] == 123);
   CHECK(recovered.tuning.values[kKnobOutputGain] == 72);
   CHECK(recovered.channel_map.gains[0] == ChannelGainFromControlValue(10));
@@ -303,6 +392,67 @@ void TestWriteBasic() {
   CHECK(recovered.channel_map.sources[2] == 1)
   CHECK(recovered == settings);
 }
+
+// Tests that a binary snapshot round trips, and that WriteBinary() and
+// ReadBinary() agree on kBinarySize.
+void TestBinaryRoundTrip() {
+  puts("TestBinaryRoundTrip");
+  Settings settings;
+  strcpy(settings.device_name, "0123456789abcdef");  // NOLINT
+  settings.input = InputSelection::kPdmMic;
+  settings.latency = LatencyProfile::kLowLatency;
+  for (int knob = 0; knob < kNumTuningKnobs; ++knob) {
+    settings.tuning.values[knob] = static_cast<uint8_t>(17 * knob + 3);
+  }
+  settings.channel_map.gains[0] = 0.0f;
+  settings.channel_map.gains[3] = ChannelGainFromControlValue(40);
+  settings.channel_map.sources[0] = 9;
+  settings.channel_map.sources[4] = 15;
+
+  uint8_t snapshot[Settings::kBinarySize + 1];
+  snapshot[Settings::kBinarySize] = 0xee;  // Sentinel to check for overrun.
+  settings.WriteBinary(0x12345678, snapshot);
+  CHECK(snapshot[Settings::kBinarySize] == 0xee);
+
+  Settings recovered;
+  CHECK(recovered != settings);
+  CHECK(recovered.ReadBinary(snapshot, Settings::kBinarySize, 0x12345678));
+  CHECK(recovered == settings);
+}
+
+// Tests that stale or corrupt snapshots are rejected and leave Settings
+// unchanged.
+void TestBinaryRejectsInvalid() {
+  puts("TestBinaryRejectsInvalid");
+  Settings settings;
+  strcpy(settings.device_name, "Banana");  // NOLINT
+  settings.tuning.values[kKnobInputGain] = 200;
+  uint8_t snapshot[Settings::kBinarySize];
+  settings.WriteBinary(7, snapshot);
+
+  Settings recovered;
+  const Settings defaults;
+  // Wrong stamp, as when the text file has changed.
+  CHECK(!recovered.ReadBinary(snapshot, Settings::kBinarySize, 8));
+  // Wrong size.
+  CHECK(!recovered.ReadBinary(snapshot, Settings::kBinarySize - 1, 7));
+  // Different version.
+  snapshot[2] ^= 1;
+  CHECK(!recovered.ReadBinary(snapshot, Settings::kBinarySize, 7));
+  snapshot[2] ^= 1;
+  // Any flipped bit fails the checksum.
+  for (int i = 0; i < Settings::kBinarySize; ++i) {
+    for (int bit = 0; bit < 8; ++bit) {
+      snapshot[i] ^= 1 << bit;
+      CHECK(!recovered.ReadBinary(snapshot, Settings::kBinarySize, 7));
+      snapshot[i] ^= 1 << bit;
+    }
+  }
+  CHECK(recovered == defaults);
+
+  CHECK(recovered.ReadBinary(snapshot, Settings::kBinarySize, 7));
+  CHECK(recovered == settings);
+}
 }  // namespace
 }  // namespace audio_tactile
 
@@ -314,7 +464,11 @@ int main(int argc, char** argv) {
   audio_tactile::TestReadInvalidSyntax();
   audio_tactile::TestReadUnknownKey();
   audio_tactile::TestReadOutOfRange();
+  audio_tactile::TestReadChunked();
+  audio_tactile::TestReadAllTuningKnobs();
   audio_tactile::TestWriteBasic();
+  audio_tactile::TestBinaryRoundTrip();
+  audio_tactile::TestBinaryRejectsInvalid();
 
   puts("PASS");
   return EXIT_SUCCESS;
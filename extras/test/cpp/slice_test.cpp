@@ -119,7 +119,7 @@ void TestSubslices() {
   auto head1 = slice.head(3);
   CHECK(head1.data() == buffer);
   CHECK(head1.size() == 3);
-  CHECK(decltype(head1)::kSizeAtCompileTime == kDynamic);
+  CHECK(static_cast<int>(decltype(head1)::kSizeAtCompileTime) == kDynamic);
   auto head2 = slice.head<3>();
   CHECK(head2.data() == buffer);
   CHECK(head2.size() == 3);
@@ -128,7 +128,7 @@ void TestSubslices() {
   auto tail1 = slice.tail(2);
   CHECK(tail1.data() == buffer + 4);
   CHECK(tail1.size() == 2);
-  CHECK(decltype(tail1)::kSizeAtCompileTime == kDynamic);
+  CHECK(static_cast<int>(decltype(tail1)::kSizeAtCompileTime) == kDynamic);
   auto tail2 = slice.tail<2>();
   CHECK(tail2.data() == buffer + 4);
   CHECK(tail2.size() == 2);
@@ -137,7 +137,7 @@ void TestSubslices() {
   auto segment1 = slice.segment(1, 4);
   CHECK(segment1.data() == buffer + 1);
   CHECK(segment1.size() == 4);
-  CHECK(decltype(segment1)::kSizeAtCompileTime == kDynamic);
+  CHECK(static_cast<int>(decltype(segment1)::kSizeAtCompileTime) == kDynamic);
   auto segment2 = slice.segment<4>(1);
   CHECK(segment2.data() == buffer + 1);
   CHECK(segment2.size() == 4);
@@ -163,6 +163,48 @@ void TestCopyFrom() {
   CHECK(b[2] == 5.6f);
 }
 
+void TestAlignedSlice() {
+  puts("TestAlignedSlice");
+  alignas(16) float buffer[8] = {0.0f, 1.0f, 2.0f, 3.0f,
+                                 4.0f, 5.0f, 6.0f, 7.0f};
+  CHECK((AlignedSlice<float, 16>::IsAligned(buffer)));
+  CHECK(!(AlignedSlice<float, 16>::IsAligned(buffer + 1)));
+
+  AlignedSlice<float, 16, 8> slice1(buffer);
+  CHECK(slice1.data() == buffer);
+  CHECK(slice1.size() == 8);
+  CHECK(decltype(slice1)::kAlignmentBytes == 16);
+  slice1[3] = 42.0f;
+  CHECK(buffer[3] == 42.0f);
+
+  // Conversion to a weaker alignment, dynamic size, and const.
+  AlignedSlice<const float, 8> slice2 = slice1;
+  CHECK(slice2.data() == buffer);
+  CHECK(slice2.size() == 8);
+  // Conversion to a plain Slice.
+  Slice<const float> slice3 = slice2;
+  CHECK(slice3.data() == buffer);
+  CHECK(slice3.size() == 8);
+  float sum = 0.0f;
+  for (float value : slice2) { sum += value; }
+  CHECK(sum == 67.0f);
+
+  // Head keeps the alignment, other sub-slices are plain Slices.
+  auto head1 = slice1.head<4>();
+  CHECK(head1.data() == buffer);
+  CHECK(decltype(head1)::kAlignmentBytes == 16);
+  CHECK(decltype(head1)::kSizeAtCompileTime == 4);
+  auto head2 = slice1.head(2);
+  CHECK(head2.size() == 2);
+  CHECK(decltype(head2)::kAlignmentBytes == 16);
+  Slice<float> tail = slice1.tail(3);
+  CHECK(tail.data() == buffer + 5);
+
+  float source[8] = {0.0f};
+  CHECK(slice1.CopyFrom(Slice<const float, 8>(source)));
+  CHECK(buffer[3] == 0.0f);
+}
+
 }  // namespace audio_tactile
 
 // NOLINTEND
@@ -172,6 +214,7 @@ int main(int argc, char** argv) {
   audio_tactile::TestFixedSize();
   audio_tactile::TestSubslices();
   audio_tactile::TestCopyFrom();
+  audio_tactile::TestAlignedSlice();
 
   puts("PASS");
   return EXIT_SUCCESS;
@@ -0,0 +1,181 @@
+// Copyright 2022 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/cpp/spsc_ring_buffer.h"
+
+#include <thread>  // NOLINT(build/c++11)
+
+#include "src/dsp/logging.h"
+
+// NOLINTBEGIN(readability/check)
+
+namespace audio_tactile {
+
+struct Block {
+  int samples[8];
+};
+
+// Test pushing and popping on one thread.
+void TestPushPop() {
+  puts("TestPushPop");
+  SpscRingBuffer<int, 4> queue;
+  CHECK(decltype(queue)::kCapacity == 4);
+  CHECK(queue.empty());
+  CHECK(queue.size() == 0);
+  int value = -1;
+  CHECK(!queue.Pop(&value));  // Popping an empty queue fails.
+  CHECK(value == -1);
+
+  CHECK(queue.Push(10));
+  CHECK(queue.Push(11));
+  CHECK(queue.Push(12));
+  CHECK(queue.size() == 3);
+  CHECK(queue.Pop(&value));
+  CHECK(value == 10);
+  CHECK(queue.Push(13));
+  CHECK(queue.Push(14));
+  CHECK(queue.full());
+  CHECK(!queue.Push(15));  // Pushing a full queue fails.
+
+  // Elements come out in FIFO order.
+  for (int expected = 11; expected <= 14; ++expected) {
+    CHECK(queue.Pop(&value));
+    CHECK(value == expected);
+  }
+  CHECK(queue.empty());
+}
+
+// Test in-place access with BeginPush/EndPush and Front/PopFront.
+void TestInPlaceAccess() {
+  puts("TestInPlaceAccess");
+  SpscRingBuffer<Block, 2> queue;
+  CHECK(queue.Front() == nullptr);
+
+  for (int i = 0; i < 5; ++i) {  // Enough iterations to wrap around.
+    Block* slot = queue.BeginPush();
+    CHECK(slot != nullptr);
+    for (int j = 0; j < 8; ++j) { slot->samples[j] = 8 * i + j; }
+    CHECK(queue.empty());  // Not visible until EndPush().
+    queue.EndPush();
+    CHECK(queue.size() == 1);
+
+    const Block* front = queue.Front();
+    CHECK(front == slot);
+    for (int j = 0; j < 8; ++j) { CHECK(front->samples[j] == 8 * i + j); }
+    queue.PopFront();
+    CHECK(queue.empty());
+  }
+
+  CHECK(queue.BeginPush() != nullptr);
+  queue.EndPush();
+  CHECK(queue.BeginPush() != nullptr);
+  queue.EndPush();
+  CHECK(queue.BeginPush() == nullptr);  // Full.
+}
+
+// Test filling slots ahead of the back with BeginPushAhead.
+void TestPushAhead() {
+  puts("TestPushAhead");
+  SpscRingBuffer<int, 4> queue;
+  for (int i = 0; i < 3; ++i) {  // Enough iterations to wrap around.
+    int* slot0 = queue.BeginPushAhead(0);
+    int* slot1 = queue.BeginPushAhead(1);
+    CHECK(slot0 == queue.BeginPush());
+    CHECK(slot1 != nullptr && slot1 != slot0);
+    *slot1 = 2 * i + 1;  // Fill out of order.
+    *slot0 = 2 * i;
+    queue.EndPush();
+    CHECK(queue.BeginPush() == slot1);
+    queue.EndPush();
+
+    int value;
+    CHECK(queue.Pop(&value));
+    CHECK(value == 2 * i);
+    CHECK(queue.Pop(&value));
+    CHECK(value == 2 * i + 1);
+  }
+
+  CHECK(queue.Push(0));
+  CHECK(queue.Push(1));
+  CHECK(queue.BeginPushAhead(1) != nullptr);
+  CHECK(queue.BeginPushAhead(2) == nullptr);  // Past the capacity.
+}
+
+// Test that the counts work correctly when they wrap around 2^32.
+void TestCountWrapAround() {
+  puts("TestCountWrapAround");
+  SpscRingBuffer<int, 4> queue;
+  // Start the counts just below 2^32, so that they wrap while pushing.
+  SpscRingBuffer<int, 4>::TestAccess::SetCounts(&queue, UINT32_C(0xfffffffe));
+  CHECK(queue.empty());
+  for (int i = 0; i < 4; ++i) { CHECK(queue.Push(100 + i)); }
+  CHECK(queue.full());
+  CHECK(!queue.Push(104));
+  for (int i = 0; i < 4; ++i) {
+    int value;
+    CHECK(queue.Pop(&value));
+    CHECK(value == 100 + i);
+  }
+  CHECK(queue.empty());
+}
+
+// Test streaming blocks between a producer thread and a consumer thread.
+void TestProducerConsumerThreads() {
+  puts("TestProducerConsumerThreads");
+  constexpr int kNumBlocks = 200000;
+  SpscRingBuffer<Block, 8> queue;
+
+  std::thread producer([&queue]() {
+    for (int i = 0; i < kNumBlocks;) {
+      Block* slot = queue.BeginPush();
+      if (slot == nullptr) {  // Full, retry.
+        std::this_thread::yield();
+        continue;
+      }
+      for (int j = 0; j < 8; ++j) { slot->samples[j] = i + j; }
+      queue.EndPush();
+      ++i;
+    }
+  });
+
+  // The consumer should receive every block in order and intact.
+  for (int i = 0; i < kNumBlocks;) {
+    const Block* front = queue.Front();
+    if (front == nullptr) {  // Empty, retry.
+      std::this_thread::yield();
+      continue;
+    }
+    for (int j = 0; j < 8; ++j) { CHECK(front->samples[j] == i + j); }
+    queue.PopFront();
+    ++i;
+  }
+
+  producer.join();
+  CHECK(queue.empty());
+}
+
+}  // namespace audio_tactile
+
+// NOLINTEND
+
+int main(int argc, char** argv) {
+  audio_tactile::TestPushPop();
+  audio_tactile::TestInPlaceAccess();
+  audio_tactile::TestPushAhead();
+  audio_tactile::TestCountWrapAround();
+  audio_tactile::TestProducerConsumerThreads();
+
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,142 @@
+// Copyright 2022 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "src/cpp/tactile_codec.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+#include <algorithm>
+#include <random>
+
+#include "src/dsp/logging.h"
+#include "src/dsp/math_constants.h"
+
+// NOLINTBEGIN(readability/check)
+
+namespace audio_tactile {
+
+constexpr int kNumChannels = 12;
+constexpr int kBlockSize = kNumPwmValues * kNumChannels;
+
+// Encodes and decodes a block, returning the max abs error.
+int RoundTripMaxError(const uint8_t* samples, int num_channels) {
+  uint8_t encoded[TactileCodecEncodedSize(kNumChannels)];
+  uint8_t decoded[kBlockSize];
+  TactileCodecEncode(samples, num_channels, encoded);
+  CHECK(TactileCodecDecode(encoded, num_channels, decoded));
+  int max_error = 0;
+  for (int i = 0; i < kNumPwmValues * num_channels; ++i) {
+    max_error = std::max<int>(max_error, abs(decoded[i] - samples[i]));
+  }
+  return max_error;
+}
+
+// Constant and slowly-varying blocks are coded losslessly.
+void TestLossless() {
+  puts("TestLossless");
+  CHECK(TactileCodecEncodedSize(kNumChannels) == 60);
+  uint8_t samples[kBlockSize];
+  for (int value : {0, 1, 128, 254, 255}) {
+    for (int i = 0; i < kBlockSize; ++i) {
+      samples[i] = static_cast<uint8_t>(value);
+    }
+    CHECK(RoundTripMaxError(samples, kNumChannels) == 0);
+  }
+
+  std::mt19937 rng(0);
+  std::uniform_int_distribution<int> delta_dist(-7, 7);
+  for (int trial = 0; trial < 100; ++trial) {
+    for (int c = 0; c < kNumChannels; ++c) {
+      int x = 128;
+      for (int n = 0; n < kNumPwmValues; ++n) {
+        x += delta_dist(rng);
+        samples[n * kNumChannels + c] = static_cast<uint8_t>(x);
+      }
+    }
+    CHECK(RoundTripMaxError(samples, kNumChannels) == 0);
+  }
+}
+
+// A full-scale 250 Hz tone sampled at 2 kHz is coded with small error.
+void TestTone() {
+  puts("TestTone");
+  uint8_t samples[kBlockSize];
+  int max_error = 0;
+  for (int block = 0; block < 100; ++block) {
+    for (int n = 0; n < kNumPwmValues; ++n) {
+      const double t = block * kNumPwmValues + n;
+      for (int c = 0; c < kNumChannels; ++c) {
+        const double amplitude = 127.0 * (c + 1) / kNumChannels;
+        samples[n * kNumChannels + c] = static_cast<uint8_t>(
+            floor(128.0 + amplitude * sin(2.0 * M_PI * 0.125 * t + c) + 0.5));
+      }
+    }
+    max_error = std::max(max_error, RoundTripMaxError(samples, kNumChannels));
+  }
+  // The largest deltas are about 90, coded with shift 4.
+  CHECK(max_error <= 8);
+}
+
+// Random blocks, the worst case, decode with bounded error, and extreme steps
+// saturate without wrapping.
+void TestRandomAndSteps() {
+  puts("TestRandomAndSteps");
+  std::mt19937 rng(0);
+  std::uniform_int_distribution<int> dist(0, 255);
+  uint8_t samples[kBlockSize];
+  for (int trial = 0; trial < 100; ++trial) {
+    for (int i = 0; i < kBlockSize; ++i) {
+      samples[i] = static_cast<uint8_t>(dist(rng));
+    }
+    CHECK(RoundTripMaxError(samples, kNumChannels) <= 128);
+  }
+
+  for (int n = 0; n < kNumPwmValues; ++n) {
+    samples[n] = (n % 2) ? 255 : 0;
+  }
+  uint8_t encoded[kTactileCodecBytesPerChannel];
+  uint8_t decoded[kNumPwmValues];
+  TactileCodecEncode(samples, 1, encoded);
+  CHECK(TactileCodecDecode(encoded, 1, decoded));
+  for (int n = 0; n < kNumPwmValues; ++n) {
+    CHECK(decoded[n] == samples[n]);
+  }
+}
+
+// Decoding rejects an invalid shift.
+void TestInvalid() {
+  puts("TestInvalid");
+  uint8_t encoded[kTactileCodecBytesPerChannel] = {128, 8, 0, 0, 0};
+  uint8_t decoded[kNumPwmValues];
+  CHECK(!TactileCodecDecode(encoded, 1, decoded));
+  encoded[1] = 7;
+  CHECK(TactileCodecDecode(encoded, 1, decoded));
+  CHECK(decoded[kNumPwmValues - 1] == 128);
+}
+
+}  // namespace audio_tactile
+
+// NOLINTEND
+
+int main(int argc, char** argv) {
+  audio_tactile::TestLossless();
+  audio_tactile::TestTone();
+  audio_tactile::TestRandomAndSteps();
+  audio_tactile::TestInvalid();
+
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
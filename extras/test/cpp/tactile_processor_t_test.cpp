@@ -0,0 +1,132 @@
+// Copyright 2022 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/cpp/tactile_processor_t.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+#include <vector>
+
+#include "src/dsp/logging.h"
+
+// NOLINTBEGIN(readability/check)
+
+namespace audio_tactile {
+
+constexpr float kSampleRateHz = 16000.0f;
+
+// Makes a test signal of a few tones in noise, with a silent gap.
+std::vector<float> MakeInput(int num_samples) {
+  srand(0);
+  std::vector<float> input(num_samples);
+  for (int i = 0; i < num_samples; ++i) {
+    const float t = i / kSampleRateHz;
+    if (0.3f < t && t < 0.9f) { continue; }  // Silent gap.
+    input[i] = 0.1f * sin(2.0 * M_PI * 300.0 * t) +
+               0.05f * sin(2.0 * M_PI * 1500.0 * t) +
+               0.05f * (static_cast<float>(rand()) / RAND_MAX - 0.5f);
+  }
+  return input;
+}
+
+// Checks that TactileProcessorT output matches TactileProcessorProcessSamples.
+template <typename ProcessorT>
+void CheckMatchesC(const TactileProcessorParams& params) {
+  ProcessorT processor_t;
+  CHECK(processor_t.Init(params));
+  CHECK(processor_t.decimation_factor() == params.decimation_factor);
+
+  TactileProcessorParams params_c = params;
+  TactileProcessor* processor_c = TactileProcessorMake(&params_c);
+  CHECK(processor_c != nullptr);
+
+  constexpr int kBlockSize = ProcessorT::kBlockSize;
+  constexpr int kNumChannels = ProcessorT::kNumChannels;
+  const int output_block_size = processor_t.output_block_size();
+  CHECK(output_block_size == kBlockSize / params.decimation_factor);
+  std::vector<float> output_c(kTactileProcessorNumTactors * output_block_size);
+
+  const int num_blocks = static_cast<int>(1.5f * kSampleRateHz) / kBlockSize;
+  const std::vector<float> input = MakeInput(num_blocks * kBlockSize);
+  float max_output = 0.0f;
+  for (int b = 0; b < num_blocks; ++b) {
+    const float* block = input.data() + b * kBlockSize;
+    const float* output_t = processor_t.ProcessSamples(block);
+    TactileProcessorProcessSamples(processor_c, block, output_c.data());
+
+    for (int i = 0; i < output_block_size; ++i) {
+      for (int c = 0; c < kNumChannels; ++c) {
+        const float expected = (c < kTactileProcessorNumTactors)
+            ? output_c[i * kTactileProcessorNumTactors + c] : 0.0f;
+        CHECK(output_t[i * kNumChannels + c] == expected);
+        max_output = fmax(max_output, expected);
+      }
+    }
+  }
+  CHECK(max_output > 0.01f);  // Check that the output isn't trivially zero.
+
+  TactileProcessorFree(processor_c);
+}
+
+TactileProcessorParams MakeParams(int block_size, int decimation_factor,
+                                  int enable_silence_gating) {
+  TactileProcessorParams params;
+  TactileProcessorSetDefaultParams(&params);
+  params.frontend_params.input_sample_rate_hz = kSampleRateHz;
+  params.frontend_params.block_size = block_size;
+  params.decimation_factor = decimation_factor;
+  params.enable_silence_gating = enable_silence_gating;
+  return params;
+}
+
+void TestMatchesC() {
+  puts("TestMatchesC");
+  for (int gating = 0; gating <= 1; ++gating) {
+    CheckMatchesC<TactileProcessorT<64, 8>>(MakeParams(64, 8, gating));
+    CheckMatchesC<TactileProcessorT<32, 4, 12>>(MakeParams(32, 4, gating));
+    CheckMatchesC<TactileProcessorT<64, kDynamic>>(MakeParams(64, 4, gating));
+  }
+}
+
+void TestInit() {
+  puts("TestInit");
+  TactileProcessorT<64, 8> processor;
+  CHECK(processor.get() == nullptr);
+  CHECK(processor.Init(kSampleRateHz));
+  CHECK(processor.get() != nullptr);
+  CHECK(processor.output_block_size() == 8);
+
+  // Fails if params don't match the template arguments.
+  CHECK(!processor.Init(MakeParams(32, 8, 0)));
+  CHECK(processor.get() == nullptr);
+  CHECK(!processor.Init(MakeParams(64, 4, 0)));
+
+  // Fails if kArenaBytes is too small.
+  TactileProcessorT<64, 8, 10, 1024> small_processor;
+  CHECK(!small_processor.Init(kSampleRateHz));
+  CHECK(small_processor.get() == nullptr);
+}
+
+}  // namespace audio_tactile
+
+// NOLINTEND
+
+int main(int argc, char** argv) {
+  audio_tactile::TestMatchesC();
+  audio_tactile::TestInit();
+
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
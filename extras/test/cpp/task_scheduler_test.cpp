@@ -0,0 +1,201 @@
+// Copyright 2022 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/cpp/task_scheduler.h"
+
+#include <vector>
+
+#include "src/dsp/logging.h"
+
+// NOLINTBEGIN(readability/check)
+
+namespace audio_tactile {
+
+// Fake clock, advanced by the test tasks.
+static uint32_t g_ticks = 0;
+static uint32_t GetFakeTicks() { return g_ticks; }
+
+// Test task that logs its id and takes `cost` ticks per run, running for
+// `num_slices` runs in total.
+struct TestTask {
+  int id;
+  uint32_t cost;
+  int num_slices;
+  std::vector<int>* log;
+};
+
+static bool RunTestTask(void* context) {
+  TestTask* task = static_cast<TestTask*>(context);
+  task->log->push_back(task->id);
+  g_ticks += task->cost;
+  return --task->num_slices > 0;
+}
+
+// Tasks run in order of priority, then of deadline.
+void TestPriorityAndDeadline() {
+  puts("TestPriorityAndDeadline");
+  g_ticks = 1000;
+  TaskScheduler scheduler(GetFakeTicks);
+  std::vector<int> log;
+  TestTask tasks[4] = {
+      {0, 10, 1, &log}, {1, 10, 1, &log}, {2, 10, 1, &log}, {3, 10, 1, &log}};
+  CHECK(scheduler.AddTask(RunTestTask, &tasks[0], 2, 500) == 0);
+  CHECK(scheduler.AddTask(RunTestTask, &tasks[1], 0, 500) == 1);
+  CHECK(scheduler.AddTask(RunTestTask, &tasks[2], 2, 100) == 2);
+  CHECK(scheduler.AddTask(RunTestTask, &tasks[3], 1, 500) == 3);
+
+  CHECK(!scheduler.has_ready_tasks());
+  CHECK(!scheduler.RunOnce());
+  for (int i = 0; i < 4; ++i) { scheduler.Post(i); }
+  CHECK(scheduler.has_ready_tasks());
+  scheduler.RunUntilIdle(nullptr);
+  CHECK(!scheduler.has_ready_tasks());
+  // Priority 0, then 1, then the priority 2 task with the earlier deadline.
+  CHECK((log == std::vector<int>{1, 3, 2, 0}));
+  CHECK(scheduler.num_missed_deadlines() == 0);
+
+  // Posting a ready task again doesn't run it twice.
+  log.clear();
+  tasks[0].num_slices = 1;
+  scheduler.Post(0);
+  scheduler.Post(0);
+  scheduler.RunUntilIdle(nullptr);
+  CHECK((log == std::vector<int>{0}));
+  // Invalid tasks are ignored.
+  scheduler.Post(-1);
+  scheduler.Post(4);
+  CHECK(!scheduler.has_ready_tasks());
+}
+
+// A task started after its deadline is counted as a miss, and tasks of equal
+// priority run in order of their deadlines rather than of posting.
+void TestMissedDeadline() {
+  puts("TestMissedDeadline");
+  g_ticks = 0xffffff00u;  // Test wraparound of the tick counter.
+  TaskScheduler scheduler(GetFakeTicks);
+  std::vector<int> log;
+  TestTask slow = {0, 300, 1, &log};
+  TestTask fast = {1, 10, 1, &log};
+  scheduler.AddTask(RunTestTask, &slow, 1, 1000);
+  scheduler.AddTask(RunTestTask, &fast, 1, 200);
+
+  scheduler.Post(0);
+  g_ticks += 50;
+  scheduler.Post(1);
+  scheduler.RunUntilIdle(nullptr);
+  CHECK((log == std::vector<int>{1, 0}));
+  CHECK(scheduler.num_missed_deadlines() == 0);
+
+  log.clear();
+  slow.num_slices = 1;
+  fast.num_slices = 1;
+  scheduler.Post(1);
+  scheduler.Post(0);
+  g_ticks += 250;  // The fast task's deadline passes before it runs.
+  scheduler.RunUntilIdle(nullptr);
+  CHECK((log == std::vector<int>{1, 0}));
+  CHECK(scheduler.num_missed_deadlines() == 1);
+}
+
+// Context for a sliced background task that checks ShouldYield().
+struct SlicedJob {
+  TaskScheduler* scheduler;
+  int units_left;
+  int runs;
+  int audio_task;
+  // Interrupt posting audio work is simulated when this many units are left.
+  int post_audio_at;
+};
+
+static bool RunSlicedJob(void* context) {
+  SlicedJob* job = static_cast<SlicedJob*>(context);
+  ++job->runs;
+  while (job->units_left > 0) {
+    --job->units_left;
+    g_ticks += 10;
+    if (job->units_left == job->post_audio_at) {
+      job->scheduler->Post(job->audio_task);
+    }
+    if (job->scheduler->ShouldYield()) { break; }
+  }
+  return job->units_left > 0;
+}
+
+// A long job split into slices yields to higher priority work.
+void TestSlicedJob() {
+  puts("TestSlicedJob");
+  g_ticks = 0;
+  TaskScheduler scheduler(GetFakeTicks);
+  std::vector<int> log;
+  TestTask audio = {7, 5, 1, &log};
+  SlicedJob job = {&scheduler, 100, 0, -1, 95};
+  job.audio_task = scheduler.AddTask(RunTestTask, &audio, 0, 50);
+  const int job_task = scheduler.AddTask(RunSlicedJob, &job, 5, 100000,
+                                         /*slice_ticks=*/200);
+
+  CHECK(!scheduler.ShouldYield());  // No task is running.
+  scheduler.Post(job_task);
+  CHECK(scheduler.RunOnce());
+  // The job yielded as soon as audio work was posted, after 5 units.
+  CHECK(job.units_left == 95);
+  CHECK(scheduler.RunOnce());
+  CHECK((log == std::vector<int>{7}));
+  CHECK(scheduler.current_task() == -1);
+
+  // The rest of the job runs in slices of 200 ticks = 20 units.
+  int num_idle = 0;
+  while (scheduler.has_ready_tasks()) {
+    scheduler.RunUntilIdle(nullptr);
+    ++num_idle;
+  }
+  CHECK(job.units_left == 0);
+  CHECK(job.runs == 1 + 5);
+  CHECK(num_idle == 1);
+  CHECK(scheduler.num_missed_deadlines() == 0);
+}
+
+static int g_num_idle_calls = 0;
+static void CountIdle() { ++g_num_idle_calls; }
+
+// The idle function is called once no task is ready.
+void TestIdle() {
+  puts("TestIdle");
+  TaskScheduler scheduler(GetFakeTicks);
+  std::vector<int> log;
+  TestTask task = {0, 1, 1, &log};
+  scheduler.AddTask(RunTestTask, &task, 0, 100);
+  scheduler.Post(0);
+  scheduler.RunUntilIdle(CountIdle);
+  CHECK(log.size() == 1);
+  CHECK(g_num_idle_calls == 1);
+
+  for (int i = 1; i < TaskScheduler::kMaxTasks; ++i) {
+    CHECK(scheduler.AddTask(RunTestTask, &task, 0, 100) == i);
+  }
+  CHECK(scheduler.AddTask(RunTestTask, &task, 0, 100) == -1);
+}
+
+}  // namespace audio_tactile
+
+// NOLINTEND
+
+int main(int argc, char** argv) {
+  audio_tactile::TestPriorityAndDeadline();
+  audio_tactile::TestMissedDeadline();
+  audio_tactile::TestSlicedJob();
+  audio_tactile::TestIdle();
+
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
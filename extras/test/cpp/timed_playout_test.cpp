@@ -0,0 +1,132 @@
+// Copyright 2022 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/cpp/timed_playout.h"
+
+#include <stdlib.h>
+
+#include "src/dsp/logging.h"
+
+// NOLINTBEGIN(readability/check)
+
+namespace audio_tactile {
+
+constexpr int kBlockSize = 4;
+constexpr uint32_t kPeriodUs = 4000;
+using TestTimedPlayout = TimedPlayout<uint8_t, kBlockSize, 8>;
+
+// Fills `block` with the value `index` in every sample.
+void MakeBlock(int index, uint8_t* block) {
+  for (int i = 0; i < kBlockSize; ++i) {
+    block[i] = static_cast<uint8_t>(index);
+  }
+}
+
+// Blocks play in the period of their presentation time, also when the pops
+// are offset from the presentation times and the clock wraps around.
+void TestPlaysOnSchedule() {
+  puts("TestPlaysOnSchedule");
+  TestTimedPlayout playout;
+  playout.Init(kPeriodUs);
+  uint8_t block[kBlockSize];
+  uint8_t output[kBlockSize];
+  const uint32_t kStartUs = 0xffffc000;
+  // Presentation times for blocks 0, 1, 2, ...
+  auto presentation_us = [=](int n) { return kStartUs + n * kPeriodUs; };
+
+  // Queue 3 blocks ahead.
+  int num_pushed = 0;
+  for (; num_pushed < 3; ++num_pushed) {
+    MakeBlock(num_pushed, block);
+    CHECK(playout.Push(block, presentation_us(num_pushed)));
+  }
+
+  // Pop 2 periods early: nothing is due.
+  CHECK(!playout.Pop(kStartUs - 2 * kPeriodUs, output));
+  CHECK(!playout.Pop(kStartUs - kPeriodUs, output));
+
+  // Pops offset by 1.5 ms from the presentation times.
+  for (int n = 0; n < 50; ++n) {
+    const uint32_t now_us = presentation_us(n) + 1500;
+    CHECK(playout.Pop(now_us, output));
+    CHECK(output[0] == n);
+    CHECK(output[kBlockSize - 1] == n);
+    CHECK(playout.stats().last_skew_us == -1500);
+    MakeBlock(num_pushed, block);
+    CHECK(playout.Push(block, presentation_us(num_pushed)));
+    ++num_pushed;
+  }
+
+  const TimedPlayoutStats stats = playout.stats();
+  CHECK(stats.num_played == 50);
+  CHECK(stats.num_dropped == 0);
+  CHECK(stats.num_waits == 2);
+}
+
+// Late blocks are dropped so that playback catches up.
+void TestDropsLateBlocks() {
+  puts("TestDropsLateBlocks");
+  TestTimedPlayout playout;
+  playout.Init(kPeriodUs);
+  uint8_t block[kBlockSize];
+  uint8_t output[kBlockSize];
+  for (int n = 0; n < 5; ++n) {
+    MakeBlock(n, block);
+    CHECK(playout.Push(block, 100000 + n * kPeriodUs));
+  }
+
+  // At block 3's time, blocks 0-2 are too late.
+  CHECK(playout.Pop(100000 + 3 * kPeriodUs, output));
+  CHECK(output[0] == 3);
+  CHECK(playout.stats().num_dropped == 3);
+  CHECK(playout.depth() == 1);
+
+  // Block 4 is due within half a period.
+  CHECK(playout.Pop(100000 + 4 * kPeriodUs + kPeriodUs / 2, output));
+  CHECK(output[0] == 4);
+  // Queue is empty.
+  CHECK(!playout.Pop(100000 + 5 * kPeriodUs, output));
+  CHECK(playout.stats().num_played == 2);
+}
+
+// Pushing to a full queue drops the block.
+void TestOverflow() {
+  puts("TestOverflow");
+  TestTimedPlayout playout;
+  playout.Init(kPeriodUs);
+  uint8_t block[kBlockSize];
+  for (int n = 0; n < TestTimedPlayout::kCapacity; ++n) {
+    MakeBlock(n, block);
+    CHECK(playout.Push(block, n * kPeriodUs));
+  }
+  CHECK(!playout.Push(block, 99 * kPeriodUs));
+  CHECK(playout.stats().num_dropped == 1);
+
+  playout.Reset();
+  CHECK(playout.depth() == 0);
+  CHECK(playout.stats().num_dropped == 0);
+}
+
+}  // namespace audio_tactile
+
+// NOLINTEND
+
+int main(int argc, char** argv) {
+  audio_tactile::TestPlaysOnSchedule();
+  audio_tactile::TestDropsLateBlocks();
+  audio_tactile::TestOverflow();
+
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,113 @@
+// Copyright 2022 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/cpp/union_arena.h"
+
+#include <stdint.h>
+
+#include "src/dsp/logging.h"
+#include "src/tactile/tactile_processor.h"
+
+// NOLINTBEGIN(readability/check)
+
+namespace audio_tactile {
+
+enum { kOwnerA = 1, kOwnerB = 2 };
+
+bool IsAligned(const void* p) {
+  return reinterpret_cast<uintptr_t>(p) % kArenaAlignment == 0;
+}
+
+// Owners take turns claiming the buffer.
+void TestClaimAndRelease() {
+  puts("TestClaimAndRelease");
+  UnionArena<1024> arena;
+  CHECK(arena.owner() == decltype(arena)::kNoOwner);
+  CHECK(!arena.Owns(kOwnerA));
+  CHECK(arena.bytes_used() <= kArenaAlignmentSlack);
+
+  Arena* a = arena.Claim(kOwnerA);
+  CHECK(arena.Owns(kOwnerA));
+  CHECK(!arena.Owns(kOwnerB));
+  void* a1 = ArenaAlloc(a, 100);
+  void* a2 = ArenaAlloc(a, 300);
+  CHECK(a1 != nullptr && IsAligned(a1));
+  CHECK(a2 != nullptr && IsAligned(a2));
+  CHECK(static_cast<char*>(a2) - static_cast<char*>(a1) ==
+        static_cast<ptrdiff_t>(ArenaAllocationSize(100)));
+  const size_t used_a = arena.bytes_used();
+  CHECK(used_a >= ArenaAllocationSize(100) + ArenaAllocationSize(300));
+
+  // B claiming reuses the same memory.
+  Arena* b = arena.Claim(kOwnerB);
+  CHECK(arena.Owns(kOwnerB));
+  CHECK(!arena.Owns(kOwnerA));
+  void* b1 = ArenaAlloc(b, 10);
+  CHECK(b1 == a1);
+  CHECK(arena.bytes_used() < used_a);
+  CHECK(arena.peak_bytes_used() == used_a);
+
+  // Allocations past the buffer fail.
+  CHECK(ArenaAlloc(b, 1024) == nullptr);
+
+  // Releasing by a non-owner does nothing.
+  arena.Release(kOwnerA);
+  CHECK(arena.Owns(kOwnerB));
+  arena.Release(kOwnerB);
+  CHECK(arena.owner() == decltype(arena)::kNoOwner);
+  CHECK(arena.peak_bytes_used() == used_a);
+}
+
+// A TactileProcessor is built lazily in the arena, and rebuilt after another
+// owner has used the buffer.
+void TestLazyTactileProcessor() {
+  puts("TestLazyTactileProcessor");
+  static UnionArena<200000> arena;
+  TactileProcessorParams params;
+  TactileProcessorSetDefaultParams(&params);
+  const size_t required_bytes = TactileProcessorRequiredBytes(&params);
+  CHECK(0 < required_bytes && required_bytes <= decltype(arena)::kSize);
+
+  TactileProcessor* processor = nullptr;
+  for (int trial = 0; trial < 2; ++trial) {
+    if (!arena.Owns(kOwnerA)) {
+      Arena* a = arena.Claim(kOwnerA);
+      processor = TactileProcessorInitInBuffer(
+          a->next, static_cast<size_t>(a->end - a->next), &params);
+      CHECK(processor != nullptr);
+    }
+
+    float input[64] = {0.0f};
+    float output[kTactileProcessorNumTactors * 64];
+    TactileProcessorProcessSamples(processor, input, output);
+
+    // Another owner takes over the buffer, e.g. on switching modes.
+    ArenaAlloc(arena.Claim(kOwnerB), 1000);
+    CHECK(!arena.Owns(kOwnerA));
+  }
+
+  CHECK(arena.peak_bytes_used() <= required_bytes);
+}
+
+}  // namespace audio_tactile
+
+// NOLINTEND
+
+int main(int argc, char** argv) {
+  audio_tactile::TestClaimAndRelease();
+  audio_tactile::TestLazyTactileProcessor();
+
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
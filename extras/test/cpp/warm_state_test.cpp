@@ -0,0 +1,84 @@
+// Copyright 2022 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/cpp/warm_state.h"
+
+#include "src/dsp/logging.h"
+
+// NOLINTBEGIN(readability/check)
+
+namespace audio_tactile {
+
+// Values round trip through serialization.
+void TestRoundTrip(int num_values) {
+  printf("TestRoundTrip(%d)\n", num_values);
+  float values[kWarmStateMaxValues];
+  for (int i = 0; i < num_values; ++i) {
+    values[i] = 1e-7f * (i + 1) * (i + 1);
+  }
+  uint8_t bytes[WarmStateSerializedSize(kWarmStateMaxValues) + 1];
+  bytes[WarmStateSerializedSize(num_values)] = 0xee;  // Overrun sentinel.
+  SerializeWarmState(values, num_values, bytes);
+  CHECK(bytes[WarmStateSerializedSize(num_values)] == 0xee);
+
+  float recovered[kWarmStateMaxValues];
+  CHECK(DeserializeWarmState(bytes, WarmStateSerializedSize(num_values),
+                             recovered, num_values));
+  for (int i = 0; i < num_values; ++i) {
+    CHECK(recovered[i] == values[i]);
+  }
+}
+
+// Corrupt data or a mismatched number of values is rejected.
+void TestRejectsInvalid() {
+  puts("TestRejectsInvalid");
+  constexpr int kNumValues = 20;
+  constexpr int kSize = WarmStateSerializedSize(kNumValues);
+  float values[kNumValues];
+  for (int i = 0; i < kNumValues; ++i) {
+    values[i] = 0.5f * i;
+  }
+  uint8_t bytes[kSize];
+  SerializeWarmState(values, kNumValues, bytes);
+
+  float recovered[kNumValues + 1] = {0.0f};
+  CHECK(!DeserializeWarmState(bytes, kSize - 1, recovered, kNumValues));
+  CHECK(!DeserializeWarmState(bytes, kSize, recovered, kNumValues + 1));
+  CHECK(!DeserializeWarmState(bytes, kSize, recovered, kNumValues - 1));
+  for (int i = 0; i < kSize; ++i) {
+    bytes[i] ^= 0x10;
+    CHECK(!DeserializeWarmState(bytes, kSize, recovered, kNumValues));
+    bytes[i] ^= 0x10;
+  }
+  for (int i = 0; i <= kNumValues; ++i) {
+    CHECK(recovered[i] == 0.0f);  // Unchanged.
+  }
+  CHECK(DeserializeWarmState(bytes, kSize, recovered, kNumValues));
+  CHECK(recovered[kNumValues - 1] == values[kNumValues - 1]);
+}
+
+}  // namespace audio_tactile
+
+// NOLINTEND
+
+int main(int argc, char** argv) {
+  audio_tactile::TestRoundTrip(0);
+  audio_tactile::TestRoundTrip(1);
+  audio_tactile::TestRoundTrip(77);
+  audio_tactile::TestRoundTrip(audio_tactile::kWarmStateMaxValues);
+  audio_tactile::TestRejectsInvalid();
+
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,79 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "src/dsp/aligned_alloc.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "src/dsp/logging.h"
+
+/* Allocations of various sizes are aligned and writable. */
+static void TestAlignedAlloc(void) {
+  puts("TestAlignedAlloc");
+  char* allocations[20];
+  int i;
+  for (i = 0; i < 20; ++i) {
+    const size_t size = 1 + 13 * i;
+    allocations[i] = (char*)CHECK_NOTNULL(AlignedAlloc(size));
+    CHECK(AlignedAllocIsAligned(allocations[i], kAlignedAllocAlignment));
+    memset(allocations[i], i, size);
+  }
+  for (i = 0; i < 20; ++i) {
+    CHECK(allocations[i][0] == i);
+    AlignedFree(allocations[i]);
+  }
+
+  /* Zero-size allocations are valid and freeable. */
+  AlignedFree(CHECK_NOTNULL(AlignedAlloc(0)));
+  /* Freeing NULL does nothing. */
+  AlignedFree(NULL);
+}
+
+static void TestAlignedCalloc(void) {
+  puts("TestAlignedCalloc");
+  const int kNum = 37;
+  float* values = (float*)CHECK_NOTNULL(AlignedCalloc(kNum, sizeof(float)));
+  CHECK(AlignedAllocIsAligned(values, kAlignedAllocAlignment));
+  int i;
+  for (i = 0; i < kNum; ++i) {
+    CHECK(values[i] == 0.0f);
+  }
+  AlignedFree(values);
+
+  /* Overflowing sizes fail. */
+  CHECK(AlignedCalloc(SIZE_MAX / 2, 4) == NULL);
+  CHECK(AlignedAlloc(SIZE_MAX) == NULL);
+}
+
+static void TestIsAligned(void) {
+  puts("TestIsAligned");
+  char* p = (char*)CHECK_NOTNULL(AlignedAlloc(64));
+  CHECK(AlignedAllocIsAligned(p, 16));
+  CHECK(AlignedAllocIsAligned(p + 16, 16));
+  CHECK(!AlignedAllocIsAligned(p + 4, 16));
+  CHECK(AlignedAllocIsAligned(p + 4, 4));
+  AlignedFree(p);
+}
+
+int main(int argc, char** argv) {
+  TestAlignedAlloc();
+  TestAlignedCalloc();
+  TestIsAligned();
+
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,83 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "src/dsp/arena.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "src/dsp/logging.h"
+
+static int IsAligned(const void* p) {
+  return (uintptr_t)p % kArenaAlignment == 0;
+}
+
+static void TestAllocationSize(void) {
+  puts("TestAllocationSize");
+  CHECK(ArenaAllocationSize(0) == 0);
+  CHECK(ArenaAllocationSize(1) == kArenaAlignment);
+  CHECK(ArenaAllocationSize(kArenaAlignment) == kArenaAlignment);
+  CHECK(ArenaAllocationSize(kArenaAlignment + 1) == 2 * kArenaAlignment);
+}
+
+/* Allocations are aligned and within the buffer, including when the buffer is
+ * unaligned, and the arena returns NULL when out of space.
+ */
+static void TestAlloc(void) {
+  puts("TestAlloc");
+  const size_t kSizes[3] = {10, 64, 100};
+  const size_t required_bytes = kArenaAlignmentSlack +
+      ArenaAllocationSize(kSizes[0]) + ArenaAllocationSize(kSizes[1]) +
+      ArenaAllocationSize(kSizes[2]);
+  char* storage =
+      (char*)CHECK_NOTNULL(malloc(required_bytes + kArenaAlignment));
+  int offset;
+  for (offset = 0; offset < kArenaAlignment; ++offset) {
+    char* buffer = storage + offset;
+    Arena arena;
+    ArenaInit(&arena, buffer, required_bytes);
+
+    char* prev_end = buffer;
+    int i;
+    for (i = 0; i < 3; ++i) {
+      char* p = (char*)CHECK_NOTNULL(ArenaAlloc(&arena, kSizes[i]));
+      CHECK(IsAligned(p));
+      CHECK(p >= prev_end);
+      prev_end = p + kSizes[i];
+      CHECK(prev_end <= buffer + required_bytes);
+    }
+    /* The arena is now full. */
+    CHECK(ArenaAlloc(&arena, 1) == NULL);
+    /* A zero-size allocation still succeeds. */
+    CHECK(ArenaAlloc(&arena, 0) != NULL);
+  }
+
+  { /* A buffer too small to align gives an empty arena. */
+    Arena arena;
+    char* buffer = IsAligned(storage) ? storage + 1 : storage;
+    ArenaInit(&arena, buffer, 0);
+    CHECK(ArenaAlloc(&arena, 1) == NULL);
+  }
+
+  free(storage);
+}
+
+int main(int argc, char** argv) {
+  TestAllocationSize();
+  TestAlloc();
+
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,237 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "src/dsp/async_resampler.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "src/dsp/logging.h"
+#include "src/dsp/math_constants.h"
+
+static const float kSampleRateHz = 16000.0f;
+#define kPacketFrames 64
+#define kBlockFrames 64
+#define kMaxChannels 4
+
+/* Simulates a producer whose clock runs `drift_ppm` fast relative to the
+ * consumer, writing packets of kPacketFrames frames of a sine tone with random
+ * arrival jitter, while the consumer reads blocks of kBlockFrames. Checks that
+ * there are no underruns or overflows, the fill stays near the target, the
+ * ratio tracks the clock ratio, and the output tone is clean.
+ */
+static void TestDriftTracking(double drift_ppm, int num_channels) {
+  printf("TestDriftTracking(%g, %d)\n", drift_ppm, num_channels);
+  CHECK(num_channels <= kMaxChannels);
+  /* Target a packet plus a block plus the 1 ms jitter. */
+  AsyncResamplerOptions options = kAsyncResamplerDefaultOptions;
+  options.target_fill_frames = kPacketFrames + kBlockFrames + 16;
+  AsyncResampler* resampler = CHECK_NOTNULL(AsyncResamplerMake(
+      kSampleRateHz, kSampleRateHz, num_channels, kPacketFrames, &options));
+  CHECK(AsyncResamplerNumChannels(resampler) == num_channels);
+  const int target = AsyncResamplerTargetFillFrames(resampler);
+  CHECK(target == options.target_fill_frames);
+
+  const double producer_rate_hz = kSampleRateHz * (1.0 + 1e-6 * drift_ppm);
+  const double kFrequencyHz = 500.0;
+  const int kNumBlocks = (int)(40.0f * kSampleRateHz) / kBlockFrames;
+  float packet[kPacketFrames * kMaxChannels];
+  float output[kBlockFrames * kMaxChannels];
+  double producer_time = 0.0;  /* Time in seconds of the next packet. */
+  int produced_frames = 0;
+  double max_fill_error = 0.0;
+  double max_amplitude_error = 0.0;
+  double sum_deviation = 0.0;
+  int num_settled_blocks = 0;
+  double prev_sample = 0.0;
+  int b;
+  for (b = 0; b < kNumBlocks; ++b) {
+    const double consumer_time = (b + 1) * kBlockFrames / kSampleRateHz;
+    /* Deliver packets due before this block, with up to 1 ms jitter. */
+    while (producer_time + 0.001 * rand() / RAND_MAX <= consumer_time) {
+      int i;
+      for (i = 0; i < kPacketFrames; ++i) {
+        const double t = (produced_frames + i) / producer_rate_hz;
+        const float value = (float)sin(2.0 * M_PI * kFrequencyHz * t);
+        int c;
+        for (c = 0; c < num_channels; ++c) {
+          packet[i * num_channels + c] = value / (c + 1);
+        }
+      }
+      CHECK(AsyncResamplerWrite(resampler, packet, kPacketFrames) ==
+            kPacketFrames);
+      produced_frames += kPacketFrames;
+      producer_time = produced_frames / producer_rate_hz;
+    }
+
+    const double fill = AsyncResamplerFillFrames(resampler);
+    const int num_read = AsyncResamplerRead(resampler, output, kBlockFrames);
+    if (b < 8) { continue; }  /* Allow for priming. */
+    CHECK(num_read == kBlockFrames);  /* No underruns after priming. */
+
+    if (b * kBlockFrames > 20.0f * kSampleRateHz) {
+      /* After settling, check fill and ratio. */
+      const double fill_error = fabs(fill - target);
+      if (fill_error > max_fill_error) { max_fill_error = fill_error; }
+        sum_deviation += AsyncResamplerRatio(resampler) - 1.0;
+      ++num_settled_blocks;
+
+      /* A sinusoid of amplitude A satisfies
+       *   x[n]^2 + x[n-1]^2 - 2 cos(w) x[n] x[n-1] = sin(w)^2 A^2,
+       * which checks the amplitude without knowing the phase.
+       */
+      const double cos_w = cos(2.0 * M_PI * kFrequencyHz / kSampleRateHz);
+      const double sin_w = sin(2.0 * M_PI * kFrequencyHz / kSampleRateHz);
+      int i;
+      for (i = 0; i < kBlockFrames; ++i) {
+        const double x = output[i * num_channels];
+        const double amplitude = sqrt(fabs(
+            x * x + prev_sample * prev_sample -
+            2.0 * cos_w * x * prev_sample)) / sin_w;
+        const double error = fabs(amplitude - 1.0);
+        if (error > max_amplitude_error) { max_amplitude_error = error; }
+        int c;
+        for (c = 1; c < num_channels; ++c) {
+          CHECK(fabs(output[i * num_channels + c] - x / (c + 1)) < 1e-5f);
+        }
+        prev_sample = x;
+      }
+    } else if (num_read > 0) {
+      prev_sample = output[(kBlockFrames - 1) * num_channels];
+    }
+  }
+  /* The fill varies by up to about a packet due to bursty arrival. */
+  CHECK(max_fill_error < 1.25 * kPacketFrames);
+  /* The amplitude estimate assumes a fixed frequency, so it is perturbed
+   * slightly as the ratio varies in correcting for whole packet steps.
+   */
+  CHECK(max_amplitude_error < 0.02);
+  /* The mean ratio matches the clock ratio, up to the fill variation over the
+   * settled duration, 64 frames / (20 s * 16 kHz) = 2e-4.
+   */
+  const double mean_deviation = sum_deviation / num_settled_blocks;
+  CHECK(fabs(mean_deviation - 1e-6 * drift_ppm) < 2.5e-4);
+
+  AsyncResamplerFree(resampler);
+}
+
+/* Reads output zeros while priming and after underrun, then resumes. */
+static void TestPrimingAndUnderrun(void) {
+  puts("TestPrimingAndUnderrun");
+  AsyncResampler* resampler = CHECK_NOTNULL(AsyncResamplerMake(
+      kSampleRateHz, kSampleRateHz, 1, kPacketFrames, NULL));
+  float packet[kPacketFrames];
+  float output[kBlockFrames];
+  int i;
+  for (i = 0; i < kPacketFrames; ++i) {
+    packet[i] = 1.0f;
+  }
+
+  /* Not primed with an empty buffer. */
+  CHECK(AsyncResamplerRead(resampler, output, kBlockFrames) == 0);
+  for (i = 0; i < kBlockFrames; ++i) {
+    CHECK(output[i] == 0.0f);
+  }
+
+  /* Prime with enough input for the filter history plus the target. */
+  while (AsyncResamplerFillFrames(resampler) <
+         AsyncResamplerTargetFillFrames(resampler)) {
+    CHECK(AsyncResamplerWrite(resampler, packet, kPacketFrames) ==
+          kPacketFrames);
+  }
+  CHECK(AsyncResamplerRead(resampler, output, kBlockFrames) == kBlockFrames);
+
+  /* Stop writing. Reading eventually underruns and outputs zeros. */
+  int num_read;
+  do {
+    num_read = AsyncResamplerRead(resampler, output, kBlockFrames);
+  } while (num_read == kBlockFrames);
+  for (i = num_read; i < kBlockFrames; ++i) {
+    CHECK(output[i] == 0.0f);
+  }
+  /* Still not primed after one more packet, since the target is not met. */
+  AsyncResamplerWrite(resampler, packet, 1);
+  CHECK(AsyncResamplerRead(resampler, output, kBlockFrames) == 0);
+
+  /* Resumes after refilling. */
+  while (AsyncResamplerFillFrames(resampler) <
+         AsyncResamplerTargetFillFrames(resampler)) {
+    AsyncResamplerWrite(resampler, packet, kPacketFrames);
+  }
+  CHECK(AsyncResamplerRead(resampler, output, kBlockFrames) == kBlockFrames);
+
+  AsyncResamplerFree(resampler);
+}
+
+/* Writes beyond the capacity are dropped. */
+static void TestOverflow(void) {
+  puts("TestOverflow");
+  AsyncResampler* resampler = CHECK_NOTNULL(AsyncResamplerMake(
+      kSampleRateHz, kSampleRateHz, 1, kPacketFrames, NULL));
+  float packet[kPacketFrames];
+  memset(packet, 0, sizeof(packet));
+  int total_written = 0;
+  int num_written;
+  do {
+    num_written = AsyncResamplerWrite(resampler, packet, kPacketFrames);
+    total_written += num_written;
+  } while (num_written == kPacketFrames);
+  CHECK(AsyncResamplerWrite(resampler, packet, kPacketFrames) == 0);
+  /* Capacity is the filter history plus 2 * target + max_input_frames, where
+   * the default target is 2 * max_input_frames.
+   */
+  CHECK(AsyncResamplerTargetFillFrames(resampler) == 2 * kPacketFrames);
+  CHECK(AsyncResamplerFillFrames(resampler) == 5 * kPacketFrames);
+  CHECK(total_written > 5 * kPacketFrames);
+
+  AsyncResamplerReset(resampler);
+  CHECK(AsyncResamplerFillFrames(resampler) < 0.0);
+  CHECK(AsyncResamplerRatio(resampler) == 1.0);
+  CHECK(AsyncResamplerWrite(resampler, packet, kPacketFrames) ==
+        kPacketFrames);
+  AsyncResamplerFree(resampler);
+}
+
+static void TestInvalidOptions(void) {
+  puts("TestInvalidOptions");
+  AsyncResamplerOptions options = kAsyncResamplerDefaultOptions;
+  options.loop_bandwidth_hz = 0.0f;
+  CHECK(AsyncResamplerMake(kSampleRateHz, kSampleRateHz, 1, kPacketFrames,
+                           &options) == NULL);
+  options = kAsyncResamplerDefaultOptions;
+  options.kernel_table_phases = 0;
+  CHECK(AsyncResamplerMake(kSampleRateHz, kSampleRateHz, 1, kPacketFrames,
+                           &options) == NULL);
+  CHECK(AsyncResamplerMake(kSampleRateHz, kSampleRateHz, 0, kPacketFrames,
+                           NULL) == NULL);
+}
+
+int main(int argc, char** argv) {
+  srand(0);
+  TestDriftTracking(0.0, 1);
+  TestDriftTracking(100.0, 1);
+  TestDriftTracking(-100.0, 1);
+  TestDriftTracking(2000.0, 1);
+  TestDriftTracking(-2000.0, 1);
+  TestDriftTracking(60.0, 3);
+  TestDriftTracking(-1000.0, 4);
+  TestPrimingAndUnderrun();
+  TestOverflow();
+  TestInvalidOptions();
+
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
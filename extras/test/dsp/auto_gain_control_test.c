@@ -16,6 +16,7 @@
 #include "src/dsp/auto_gain_control.h"
 
 #include <math.h>
+#include <stdio.h>
 #include <stdlib.h>
 
 #include "src/dsp/logging.h"
@@ -69,11 +70,139 @@ static void TestBasic(float agc_strength) {
   free(signal);
 }
 
+/* Makes noise whose amplitude varies over time. */
+static float* MakeTestSignal(int num_samples) {
+  float* signal = (float*)CHECK_NOTNULL(malloc(num_samples * sizeof(float)));
+  int i;
+  for (i = 0; i < num_samples; ++i) {
+    const float amplitude = (i / 4000) % 2 ? 0.5f : 0.01f;
+    signal[i] = amplitude * (rand() / (0.5f * RAND_MAX) - 1.0f);
+  }
+  return signal;
+}
+
+/* Gains applied by AutoGainControlProcessBlock() are close to per-sample
+ * processing. Gains are interpolated between control points, so the gain at
+ * each sample should be within the range of the per-sample gains over the
+ * surrounding control periods.
+ */
+static void TestBlockMatchesPerSample(int control_period, int block_size) {
+  printf("TestBlockMatchesPerSample(%d, %d)\n", control_period, block_size);
+  const int kSampleRateHz = 16000;
+  const int num_samples = kSampleRateHz;
+  AutoGainControlState state;
+  CHECK(AutoGainControlInit(&state, kSampleRateHz, /*time_constant_s=*/0.05f,
+                            /*agc_strength=*/0.5f, /*power_floor=*/1e-6f));
+  CHECK(AutoGainControlSetControlPeriod(&state, control_period));
+
+  float* input = MakeTestSignal(num_samples);
+  float* expected_gains = (float*)CHECK_NOTNULL(
+      malloc(num_samples * sizeof(float)));
+  float* output = (float*)CHECK_NOTNULL(malloc(num_samples * sizeof(float)));
+  int i;
+  for (i = 0; i < num_samples; ++i) {
+    AutoGainControlProcessSample(&state, input[i] * input[i]);
+    expected_gains[i] = AutoGainControlGetGain(&state);
+  }
+
+  AutoGainControlReset(&state);
+  int start;
+  for (start = 0; start < num_samples; start += block_size) {
+    const int num_frames = (num_samples - start < block_size)
+        ? num_samples - start : block_size;
+    AutoGainControlProcessBlock(&state, input + start, 1, num_frames,
+                                output + start);
+  }
+
+  /* Allow 1% error for FastPow() differences. */
+  const float kTol = 0.01f;
+  for (i = control_period; i < num_samples; ++i) {
+    if (input[i] == 0.0f) { continue; }
+    const float gain = output[i] / input[i];
+    float min_gain = expected_gains[i];
+    float max_gain = expected_gains[i];
+    int j;
+    for (j = i - control_period;
+         j < i + control_period && j < num_samples; ++j) {
+      if (expected_gains[j] < min_gain) { min_gain = expected_gains[j]; }
+      if (expected_gains[j] > max_gain) { max_gain = expected_gains[j]; }
+    }
+    CHECK((1.0f - kTol) * min_gain <= gain && gain <= (1.0f + kTol) * max_gain);
+  }
+
+  free(output);
+  free(expected_gains);
+  free(input);
+}
+
+/* Multichannel power is the mean square over channels, so a signal duplicated
+ * to several channels gives the same result as mono.
+ */
+static void TestBlockMultichannel(void) {
+  puts("TestBlockMultichannel");
+  const int kSampleRateHz = 16000;
+  const int kNumChannels = 3;
+  const int num_frames = 4000;
+  AutoGainControlState state;
+  CHECK(AutoGainControlInit(&state, kSampleRateHz, /*time_constant_s=*/0.05f,
+                            /*agc_strength=*/0.5f, /*power_floor=*/1e-6f));
+
+  float* input = MakeTestSignal(num_frames);
+  float* expected = (float*)CHECK_NOTNULL(malloc(num_frames * sizeof(float)));
+  float* multichannel = (float*)CHECK_NOTNULL(
+      malloc(num_frames * kNumChannels * sizeof(float)));
+  int i;
+  for (i = 0; i < num_frames; ++i) {
+    int c;
+    for (c = 0; c < kNumChannels; ++c) {
+      multichannel[i * kNumChannels + c] = input[i];
+    }
+  }
+
+  AutoGainControlProcessBlock(&state, input, 1, num_frames, expected);
+  AutoGainControlReset(&state);
+  /* Process in place. */
+  AutoGainControlProcessBlock(&state, multichannel, kNumChannels, num_frames,
+                              multichannel);
+
+  for (i = 0; i < num_frames; ++i) {
+    int c;
+    for (c = 0; c < kNumChannels; ++c) {
+      CHECK(fabs(multichannel[i * kNumChannels + c] - expected[i]) <=
+            1e-6f * fabs(expected[i]));
+    }
+  }
+
+  free(multichannel);
+  free(expected);
+  free(input);
+}
+
+static void TestSetControlPeriod(void) {
+  puts("TestSetControlPeriod");
+  AutoGainControlState state;
+  CHECK(AutoGainControlInit(&state, 16000.0f, 0.25f, 0.5f, 1e-6f));
+  CHECK(state.control_period == kAutoGainControlDefaultControlPeriod);
+  CHECK(AutoGainControlSetControlPeriod(&state, 1));
+  CHECK(AutoGainControlSetControlPeriod(&state,
+                                        kAutoGainControlMaxControlPeriod));
+  CHECK(!AutoGainControlSetControlPeriod(&state, 0));
+  CHECK(!AutoGainControlSetControlPeriod(
+      &state, kAutoGainControlMaxControlPeriod + 1));
+  CHECK(state.control_period == kAutoGainControlMaxControlPeriod);
+}
+
 int main(int argc, char** argv) {
   srand(0);
   TestBasic(0.3f);
   TestBasic(0.5f);
   TestBasic(0.8f);
+  TestBlockMatchesPerSample(1, 64);
+  TestBlockMatchesPerSample(16, 64);
+  TestBlockMatchesPerSample(16, 37);
+  TestBlockMatchesPerSample(kAutoGainControlMaxControlPeriod, 256);
+  TestBlockMultichannel();
+  TestSetControlPeriod();
 
   puts("PASS");
   return EXIT_SUCCESS;
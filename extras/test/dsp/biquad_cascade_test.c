@@ -0,0 +1,222 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "src/dsp/biquad_cascade.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+#include "src/dsp/logging.h"
+#include "src/dsp/math_constants.h"
+
+static double RandUniform(void) { return (double) rand() / RAND_MAX; }
+
+static BiquadFilterCoeffs RandomStableFilter(void) {
+  BiquadFilterCoeffs coeffs;
+  coeffs.b0 = 2 * RandUniform() - 1;
+  coeffs.b1 = 2 * RandUniform() - 1;
+  coeffs.b2 = 2 * RandUniform() - 1;
+  const float pole_mag = 0.999 * RandUniform();
+  const float pole_arg = M_PI * RandUniform();
+  coeffs.a1 = 2 * pole_mag * cos(pole_arg);
+  coeffs.a2 = pole_mag * pole_mag;
+  return coeffs;
+}
+
+static void MakeRandomCascade(int num_sections, BiquadCascade* cascade,
+                              BiquadFilterCoeffs* coeffs) {
+  int k;
+  for (k = 0; k < num_sections; ++k) {
+    coeffs[k] = RandomStableFilter();
+  }
+  CHECK(BiquadCascadeInit(cascade, coeffs, num_sections));
+}
+
+/* Processes one sample through `num_sections` sections in series. */
+static float ReferenceProcessOneSample(const BiquadFilterCoeffs* coeffs,
+                                       BiquadFilterState* state,
+                                       int num_sections,
+                                       float sample) {
+  int k;
+  for (k = 0; k < num_sections; ++k) {
+    sample = BiquadFilterProcessOneSample(&coeffs[k], &state[k], sample);
+  }
+  return sample;
+}
+
+/* BiquadCascadeInit rejects invalid args. */
+static void TestInitInvalidArgs(void) {
+  puts("TestInitInvalidArgs");
+  BiquadCascade cascade;
+  BiquadFilterCoeffs coeffs[kBiquadCascadeMaxSections + 1];
+  int k;
+  for (k = 0; k <= kBiquadCascadeMaxSections; ++k) {
+    coeffs[k] = kBiquadFilterIdentityCoeffs;
+  }
+  CHECK(!BiquadCascadeInit(NULL, coeffs, 2));
+  CHECK(!BiquadCascadeInit(&cascade, NULL, 2));
+  CHECK(!BiquadCascadeInit(&cascade, coeffs, -1));
+  CHECK(!BiquadCascadeInit(&cascade, coeffs, kBiquadCascadeMaxSections + 1));
+  CHECK(BiquadCascadeInit(&cascade, NULL, 0));
+  CHECK(BiquadCascadeInit(&cascade, coeffs, kBiquadCascadeMaxSections));
+}
+
+/* BiquadCascadeProcessOneSample and BiquadCascadeProcessBlock match sections
+ * applied in series with BiquadFilterProcessOneSample.
+ */
+static void TestProcessBlock(int num_sections) {
+  printf("TestProcessBlock(%d)\n", num_sections);
+  const int kNumSamples = 50;
+  float input[50];
+  float output[50];
+  BiquadFilterCoeffs coeffs[kBiquadCascadeMaxSections];
+  BiquadFilterState expected_state[kBiquadCascadeMaxSections];
+  BiquadCascade cascade;
+  BiquadCascadeState block_state;
+  BiquadCascadeState one_sample_state;
+  MakeRandomCascade(num_sections, &cascade, coeffs);
+  BiquadCascadeStateInitZero(&block_state);
+  BiquadCascadeStateInitZero(&one_sample_state);
+  int k;
+  for (k = 0; k < num_sections; ++k) {
+    BiquadFilterInitZero(&expected_state[k]);
+  }
+
+  int block;
+  for (block = 0; block < 2; ++block) {
+    int n;
+    for (n = 0; n < kNumSamples; ++n) {
+      input[n] = 2 * RandUniform() - 1;
+      output[n] = input[n];
+    }
+
+    /* Process in-place. */
+    BiquadCascadeProcessBlock(&cascade, &block_state,
+                              output, kNumSamples, output);
+
+    for (n = 0; n < kNumSamples; ++n) {
+      const float expected = ReferenceProcessOneSample(
+          coeffs, expected_state, num_sections, input[n]);
+      CHECK(output[n] == expected);
+      CHECK(BiquadCascadeProcessOneSample(
+                &cascade, &one_sample_state, input[n]) == expected);
+    }
+  }
+
+  for (k = 0; k < num_sections; ++k) {
+    CHECK(block_state.sections[k].z[0] == expected_state[k].z[0]);
+    CHECK(block_state.sections[k].z[1] == expected_state[k].z[1]);
+  }
+}
+
+/* BiquadCascadeProcessInterleavedBlock matches per-sample processing. */
+static void TestProcessInterleavedBlock(int num_sections, int num_channels) {
+  printf("TestProcessInterleavedBlock(%d, %d)\n", num_sections, num_channels);
+  const int kNumFrames = 30;
+  float* input = (float*)CHECK_NOTNULL(
+      malloc(kNumFrames * num_channels * sizeof(float)));
+  float* output = (float*)CHECK_NOTNULL(
+      malloc(kNumFrames * num_channels * sizeof(float)));
+  BiquadCascadeState* block_state = (BiquadCascadeState*)CHECK_NOTNULL(
+      malloc(num_channels * sizeof(BiquadCascadeState)));
+  BiquadCascadeState* expected_state = (BiquadCascadeState*)CHECK_NOTNULL(
+      malloc(num_channels * sizeof(BiquadCascadeState)));
+  BiquadFilterCoeffs coeffs[kBiquadCascadeMaxSections];
+  BiquadCascade cascade;
+  MakeRandomCascade(num_sections, &cascade, coeffs);
+
+  int c;
+  for (c = 0; c < num_channels; ++c) {
+    BiquadCascadeStateInitZero(&block_state[c]);
+    BiquadCascadeStateInitZero(&expected_state[c]);
+  }
+  int i;
+  for (i = 0; i < kNumFrames * num_channels; ++i) {
+    input[i] = 2 * RandUniform() - 1;
+  }
+
+  BiquadCascadeProcessInterleavedBlock(&cascade, block_state, num_channels,
+                                       input, kNumFrames, output);
+
+  for (i = 0; i < kNumFrames * num_channels; ++i) {
+    const float expected = ReferenceProcessOneSample(
+        coeffs, expected_state[i % num_channels].sections, num_sections,
+        input[i]);
+    CHECK(output[i] == expected);
+  }
+  for (c = 0; c < num_channels; ++c) {
+    int k;
+    for (k = 0; k < num_sections; ++k) {
+      CHECK(block_state[c].sections[k].z[0] ==
+            expected_state[c].sections[k].z[0]);
+      CHECK(block_state[c].sections[k].z[1] ==
+            expected_state[c].sections[k].z[1]);
+    }
+  }
+
+  free(expected_state);
+  free(block_state);
+  free(output);
+  free(input);
+}
+
+/* The frequency response is the product of the section responses. */
+static void TestFrequencyResponse(void) {
+  puts("TestFrequencyResponse");
+  BiquadFilterCoeffs coeffs[3];
+  BiquadCascade cascade;
+  MakeRandomCascade(3, &cascade, coeffs);
+
+  int i;
+  for (i = 0; i <= 10; ++i) {
+    const double cycles_per_sample = 0.05 * i;
+    ComplexDouble expected = ComplexDoubleMake(1.0, 0.0);
+    int k;
+    for (k = 0; k < 3; ++k) {
+      expected = ComplexDoubleMul(expected, BiquadFilterFrequencyResponse(
+          &coeffs[k], cycles_per_sample));
+    }
+    const ComplexDouble response =
+        BiquadCascadeFrequencyResponse(&cascade, cycles_per_sample);
+    CHECK(fabs(response.real - expected.real) < 1e-9);
+    CHECK(fabs(response.imag - expected.imag) < 1e-9);
+  }
+
+  /* An empty cascade is the identity. */
+  CHECK(BiquadCascadeInit(&cascade, NULL, 0));
+  const ComplexDouble response = BiquadCascadeFrequencyResponse(&cascade, 0.1);
+  CHECK(response.real == 1.0);
+  CHECK(response.imag == 0.0);
+}
+
+int main(int argc, char** argv) {
+  srand(0);
+  TestInitInvalidArgs();
+  int num_sections;
+  for (num_sections = 0; num_sections <= kBiquadCascadeMaxSections;
+       ++num_sections) {
+    TestProcessBlock(num_sections);
+  }
+  for (num_sections = 0; num_sections <= 5; ++num_sections) {
+    int num_channels;
+    for (num_channels = 1; num_channels <= 9; num_channels += 4) {
+      TestProcessInterleavedBlock(num_sections, num_channels);
+    }
+  }
+  TestFrequencyResponse();
+
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,185 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "src/dsp/biquad_filter_fixed.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+#include "src/dsp/butterworth.h"
+#include "src/dsp/logging.h"
+
+static double RandUniform(void) { return (double)rand() / RAND_MAX; }
+
+/* Filters in double precision as a reference. */
+static void ReferenceBiquadFilter(const BiquadFilterCoeffs* coeffs,
+                                  const double* input,
+                                  int num_samples,
+                                  double* output) {
+  int n;
+  for (n = 0; n < num_samples; ++n) {
+    output[n] = coeffs->b0 * input[n]
+        + coeffs->b1 * ((n < 1) ? 0.0 : input[n - 1])
+        + coeffs->b2 * ((n < 2) ? 0.0 : input[n - 2])
+        - coeffs->a1 * ((n < 1) ? 0.0 : output[n - 1])
+        - coeffs->a2 * ((n < 2) ? 0.0 : output[n - 2]);
+  }
+}
+
+static void TestCoeffsFromFloat(void) {
+  puts("TestCoeffsFromFloat");
+  BiquadFilterCoeffs coeffs;
+  BiquadFilterFixedCoeffs fixed;
+
+  CHECK(DesignButterworthOrder2Lowpass(1000.0, 16000.0, &coeffs));
+  CHECK(BiquadFilterFixedCoeffsFromFloat(&coeffs, &fixed));
+  CHECK(fixed.frac_bits == kBiquadFilterFixedMaxFracBits);
+  CHECK(fabs(ldexp(fixed.b0, -fixed.frac_bits) - coeffs.b0) <= 1e-8);
+  CHECK(fabs(ldexp(fixed.a1, -fixed.frac_bits) - coeffs.a1) <= 1e-8);
+  CHECK(fabs(ldexp(fixed.a2, -fixed.frac_bits) - coeffs.a2) <= 1e-8);
+
+  /* Highpass filter has a zero at DC, which is preserved exactly. */
+  CHECK(DesignButterworthOrder2Highpass(20.0, 16000.0, &coeffs));
+  CHECK(BiquadFilterFixedCoeffsFromFloat(&coeffs, &fixed));
+  CHECK(fixed.b0 + fixed.b1 + fixed.b2 == 0);
+
+  /* Large coefficients use fewer fractional bits. */
+  coeffs = kBiquadFilterIdentityCoeffs;
+  coeffs.b0 = 100.0f;
+  CHECK(BiquadFilterFixedCoeffsFromFloat(&coeffs, &fixed));
+  CHECK(fixed.frac_bits == 24);
+  CHECK(fixed.b0 == 100 << 24);
+
+  /* Fails for unstable feedback coefficients. */
+  coeffs = kBiquadFilterIdentityCoeffs;
+  coeffs.a1 = 2.5f;
+  CHECK(!BiquadFilterFixedCoeffsFromFloat(&coeffs, &fixed));
+  coeffs.a1 = 0.0f;
+  coeffs.a2 = -2.0f;
+  CHECK(!BiquadFilterFixedCoeffsFromFloat(&coeffs, &fixed));
+}
+
+/* Compare with double precision filtering of random input. */
+static void TestCompareToDouble(const BiquadFilterCoeffs* coeffs,
+                                double tolerance) {
+  const int kNumSamples = 2000;
+  const int kInputFracBits = 24;
+  double* input = (double*)CHECK_NOTNULL(malloc(kNumSamples * sizeof(double)));
+  double* expected = (double*)CHECK_NOTNULL(
+      malloc(kNumSamples * sizeof(double)));
+  int32_t* input_fixed = (int32_t*)CHECK_NOTNULL(
+      malloc(kNumSamples * sizeof(int32_t)));
+
+  int n;
+  for (n = 0; n < kNumSamples; ++n) {
+    input_fixed[n] = (int32_t)ldexp(RandUniform() - 0.5, kInputFracBits);
+    input[n] = ldexp(input_fixed[n], -kInputFracBits);
+  }
+  ReferenceBiquadFilter(coeffs, input, kNumSamples, expected);
+
+  BiquadFilterFixedCoeffs fixed;
+  CHECK(BiquadFilterFixedCoeffsFromFloat(coeffs, &fixed));
+  BiquadFilterFixedState state;
+  BiquadFilterFixedInitZero(&state);
+  double max_error = 0.0;
+  for (n = 0; n < kNumSamples; ++n) {
+    const int32_t output = BiquadFilterFixedProcessOneSample(
+        &fixed, &state, input_fixed[n]);
+    const double error = fabs(ldexp(output, -kInputFracBits) - expected[n]);
+    if (error > max_error) { max_error = error; }
+  }
+  CHECK(max_error <= tolerance);
+
+  free(input_fixed);
+  free(expected);
+  free(input);
+}
+
+static void TestFilters(void) {
+  puts("TestFilters");
+  BiquadFilterCoeffs coeffs;
+  CHECK(DesignButterworthOrder2Lowpass(1000.0, 16000.0, &coeffs));
+  TestCompareToDouble(&coeffs, 1e-6);
+  CHECK(DesignButterworthOrder2Lowpass(100.0, 44100.0, &coeffs));
+  TestCompareToDouble(&coeffs, 1e-5);
+  CHECK(DesignButterworthOrder2Highpass(50.0, 16000.0, &coeffs));
+  TestCompareToDouble(&coeffs, 1e-6);
+
+  BiquadFilterCoeffs bandpass[2];
+  CHECK(DesignButterworthOrder2Bandpass(80.0, 500.0, 16000.0, bandpass));
+  TestCompareToDouble(&bandpass[0], 1e-6);
+  TestCompareToDouble(&bandpass[1], 1e-5);
+}
+
+/* Lowpass filter with poles near z = 1 converges to the DC output implied by
+ * the fixed-point coefficients, without a bias from rounding error.
+ */
+static void TestLowpassDcGain(void) {
+  puts("TestLowpassDcGain");
+  BiquadFilterCoeffs coeffs;
+  CHECK(DesignButterworthOrder2Lowpass(20.0, 44100.0, &coeffs));
+  BiquadFilterFixedCoeffs fixed;
+  CHECK(BiquadFilterFixedCoeffsFromFloat(&coeffs, &fixed));
+  BiquadFilterFixedState state;
+  BiquadFilterFixedInitZero(&state);
+
+  /* Without error feedback, the output could get stuck anywhere within
+   * 2^27 / (2^28 + a1 + a2) of the DC output, which is about 61000 for this
+   * filter. Averaged over a long window, the output should match it closely.
+   */
+  const int32_t kInput = 1000;
+  const int kNumSamples = 441000;
+  const int kWarmUp = 44100;
+  double output_sum = 0.0;
+  int n;
+  for (n = 0; n < kNumSamples; ++n) {
+    const int32_t output =
+        BiquadFilterFixedProcessOneSample(&fixed, &state, kInput);
+    if (n >= kWarmUp) { output_sum += output; }
+  }
+  const double output_mean = output_sum / (kNumSamples - kWarmUp);
+  const double dc_gain = ((double)fixed.b0 + fixed.b1 + fixed.b2) /
+      (ldexp(1.0, fixed.frac_bits) + fixed.a1 + fixed.a2);
+  CHECK(fabs(output_mean - kInput * dc_gain) <= 0.5);
+}
+
+/* Highpass filter rejects DC after settling. */
+static void TestHighpassDcRejection(void) {
+  puts("TestHighpassDcRejection");
+  BiquadFilterCoeffs coeffs;
+  CHECK(DesignButterworthOrder2Highpass(20.0, 16000.0, &coeffs));
+  BiquadFilterFixedCoeffs fixed;
+  CHECK(BiquadFilterFixedCoeffsFromFloat(&coeffs, &fixed));
+  BiquadFilterFixedState state;
+  BiquadFilterFixedInitZero(&state);
+
+  int n;
+  for (n = 0; n < 16000; ++n) {
+    const int32_t output = BiquadFilterFixedProcessOneSample(
+        &fixed, &state, 1 << 24);
+    if (n >= 8000) { CHECK(abs(output) <= 1); }
+  }
+}
+
+int main(int argc, char** argv) {
+  srand(0);
+  TestCoeffsFromFloat();
+  TestFilters();
+  TestLowpassDcGain();
+  TestHighpassDcRejection();
+
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
@@ -130,6 +130,138 @@ static void TestIdentityFilter(void) {
   }
 }
 
+/* Generates a random stable biquad filter. */
+static BiquadFilterCoeffs RandomStableFilter(void) {
+  BiquadFilterCoeffs coeffs;
+  coeffs.b0 = 2 * RandUniform() - 1;
+  coeffs.b1 = 2 * RandUniform() - 1;
+  coeffs.b2 = 2 * RandUniform() - 1;
+  const float pole_mag = 0.999 * RandUniform();
+  const float pole_arg = M_PI * RandUniform();
+  coeffs.a1 = 2 * pole_mag * cos(pole_arg);
+  coeffs.a2 = pole_mag * pole_mag;
+  return coeffs;
+}
+
+/* BiquadFilterProcessBlock matches BiquadFilterProcessOneSample. */
+static void TestProcessBlock(void) {
+  puts("TestProcessBlock");
+  const int kNumSamples = 50;
+  float input[50];
+  float output[50];
+  int trial;
+  for (trial = 0; trial < 10; ++trial) {
+    const BiquadFilterCoeffs coeffs = RandomStableFilter();
+    BiquadFilterState block_state;
+    BiquadFilterState expected_state;
+    BiquadFilterInitZero(&block_state);
+    BiquadFilterInitZero(&expected_state);
+
+    int n;
+    for (n = 0; n < kNumSamples; ++n) {
+      input[n] = 2 * RandUniform() - 1;
+    }
+
+    /* Process in two blocks to check that state carries over. */
+    BiquadFilterProcessBlock(&coeffs, &block_state, input, 20, output);
+    BiquadFilterProcessBlock(&coeffs, &block_state, input + 20,
+                             kNumSamples - 20, output + 20);
+
+    for (n = 0; n < kNumSamples; ++n) {
+      const float expected = BiquadFilterProcessOneSample(
+          &coeffs, &expected_state, input[n]);
+      CHECK(output[n] == expected);
+    }
+    CHECK(block_state.z[0] == expected_state.z[0]);
+    CHECK(block_state.z[1] == expected_state.z[1]);
+
+    /* Check that in-place processing works. */
+    BiquadFilterInitZero(&block_state);
+    BiquadFilterProcessBlock(&coeffs, &block_state, output, kNumSamples,
+                             output);
+  }
+}
+
+/* BiquadFilterCascadeProcessBlock matches per-sample processing. */
+static void TestCascadeProcessBlock(void) {
+  puts("TestCascadeProcessBlock");
+  const int kNumSamples = 50;
+  const int kNumSections = 3;
+  float input[50];
+  float output[50];
+  BiquadFilterCoeffs coeffs[3];
+  BiquadFilterState block_state[3];
+  BiquadFilterState expected_state[3];
+  int k;
+  for (k = 0; k < kNumSections; ++k) {
+    coeffs[k] = RandomStableFilter();
+    BiquadFilterInitZero(&block_state[k]);
+    BiquadFilterInitZero(&expected_state[k]);
+  }
+
+  int n;
+  for (n = 0; n < kNumSamples; ++n) {
+    input[n] = 2 * RandUniform() - 1;
+    output[n] = input[n];
+  }
+
+  /* Process in-place. */
+  BiquadFilterCascadeProcessBlock(coeffs, block_state, kNumSections,
+                                  output, kNumSamples, output);
+
+  for (n = 0; n < kNumSamples; ++n) {
+    float expected = input[n];
+    for (k = 0; k < kNumSections; ++k) {
+      expected = BiquadFilterProcessOneSample(
+          &coeffs[k], &expected_state[k], expected);
+    }
+    CHECK(output[n] == expected);
+  }
+}
+
+/* BiquadFilterProcessInterleavedBlock matches per-sample processing. */
+static void TestProcessInterleavedBlock(int num_channels) {
+  printf("TestProcessInterleavedBlock(%d)\n", num_channels);
+  const int kNumFrames = 30;
+  float* input = (float*)CHECK_NOTNULL(
+      malloc(kNumFrames * num_channels * sizeof(float)));
+  float* output = (float*)CHECK_NOTNULL(
+      malloc(kNumFrames * num_channels * sizeof(float)));
+  BiquadFilterState* block_state = (BiquadFilterState*)CHECK_NOTNULL(
+      malloc(num_channels * sizeof(BiquadFilterState)));
+  BiquadFilterState* expected_state = (BiquadFilterState*)CHECK_NOTNULL(
+      malloc(num_channels * sizeof(BiquadFilterState)));
+  const BiquadFilterCoeffs coeffs = RandomStableFilter();
+
+  int c;
+  for (c = 0; c < num_channels; ++c) {
+    BiquadFilterInitZero(&block_state[c]);
+    BiquadFilterInitZero(&expected_state[c]);
+  }
+  int i;
+  for (i = 0; i < kNumFrames * num_channels; ++i) {
+    input[i] = 2 * RandUniform() - 1;
+  }
+
+  BiquadFilterProcessInterleavedBlock(&coeffs, block_state, num_channels,
+                                      input, kNumFrames, output);
+
+  for (i = 0; i < kNumFrames * num_channels; ++i) {
+    const float expected = BiquadFilterProcessOneSample(
+        &coeffs, &expected_state[i % num_channels], input[i]);
+    CHECK(output[i] == expected);
+  }
+  for (c = 0; c < num_channels; ++c) {
+    CHECK(block_state[c].z[0] == expected_state[c].z[0]);
+    CHECK(block_state[c].z[1] == expected_state[c].z[1]);
+  }
+
+  free(expected_state);
+  free(block_state);
+  free(output);
+  free(input);
+}
+
 /* Test frequency response computation. */
 static void TestFrequencyResponse(void) {
   puts("TestFrequencyResponse");
@@ -166,6 +298,12 @@ int main(int argc, char** argv) {
   TestImpulseResponse();
   TestCompareWithReference();
   TestIdentityFilter();
+  TestProcessBlock();
+  TestCascadeProcessBlock();
+  int num_channels;
+  for (num_channels = 1; num_channels <= 10; ++num_channels) {
+    TestProcessInterleavedBlock(num_channels);
+  }
   TestFrequencyResponse();
 
   puts("PASS");
@@ -0,0 +1,210 @@
+/* Copyright 2021-2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "src/dsp/channel_map_ramp.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+#include "src/dsp/logging.h"
+
+#define kNumFrames 30
+#define kInputChannels 3
+#define kOutputChannels 4
+
+/* Makes a ChannelMap mapping 3 inputs to 4 outputs. */
+static ChannelMap MakeChannelMap(void) {
+  ChannelMap channel_map;
+  channel_map.num_input_channels = kInputChannels;
+  channel_map.num_output_channels = kOutputChannels;
+  channel_map.sources[0] = 2;
+  channel_map.sources[1] = 2;
+  channel_map.sources[2] = 0;
+  channel_map.sources[3] = 1;
+  channel_map.gains[0] = 0.2f;
+  channel_map.gains[1] = 0.4f;
+  channel_map.gains[2] = 0.0f;
+  channel_map.gains[3] = 0.8f;
+  return channel_map;
+}
+
+/* Runs ChannelMapRampApply() on an input of ones in blocks of 4 frames, so
+ * that the output is the gain at each frame.
+ */
+static void RunOnOnes(ChannelMapRamp* ramp, float* output) {
+  float input[kNumFrames * kInputChannels];
+  int i;
+  for (i = 0; i < kNumFrames * kInputChannels; ++i) {
+    input[i] = 1.0f;
+  }
+  int start;
+  for (start = 0; start < kNumFrames; start += 4) {
+    const int num_frames = (start + 4 <= kNumFrames) ? 4 : kNumFrames - start;
+    ChannelMapRampApply(ramp, input + kInputChannels * start, num_frames,
+                        output + kOutputChannels * start);
+  }
+}
+
+/* Without gain changes, ChannelMapRampApply() matches ChannelMapApply(). */
+static void TestStaticGains(void) {
+  puts("TestStaticGains");
+  const ChannelMap channel_map = MakeChannelMap();
+  ChannelMapRamp ramp;
+  CHECK(ChannelMapRampInit(&ramp, &channel_map, 10, kChannelMapRampLinear));
+  /* Setting the current gains doesn't start ramps. */
+  ChannelMapRampSetGains(&ramp, channel_map.gains);
+  CHECK(ramp.num_ramping == 0);
+
+  float input[kNumFrames * kInputChannels];
+  int i;
+  for (i = 0; i < kNumFrames * kInputChannels; ++i) {
+    input[i] = (float)rand() / RAND_MAX;
+  }
+  float expected[kNumFrames * kOutputChannels];
+  float actual[kNumFrames * kOutputChannels];
+  ChannelMapApply(&channel_map, input, kNumFrames, expected);
+  ChannelMapRampApply(&ramp, input, kNumFrames, actual);
+  for (i = 0; i < kNumFrames * kOutputChannels; ++i) {
+    CHECK(actual[i] == expected[i]);
+  }
+}
+
+/* Linear ramps change gains by a constant increment over 10 frames. */
+static void TestLinearRamp(void) {
+  puts("TestLinearRamp");
+  const ChannelMap channel_map = MakeChannelMap();
+  ChannelMapRamp ramp;
+  CHECK(ChannelMapRampInit(&ramp, &channel_map, 10, kChannelMapRampLinear));
+  const float kNewGains[kOutputChannels] = {0.7f, 0.4f, 0.5f, 0.0f};
+  ChannelMapRampSetGains(&ramp, kNewGains);
+  CHECK(ramp.num_ramping == 3);  /* Channel 1 is unchanged. */
+
+  float output[kNumFrames * kOutputChannels];
+  RunOnOnes(&ramp, output);
+
+  int n;
+  for (n = 0; n < kNumFrames; ++n) {
+    const float fraction = (n < 10) ? (n + 1) / 10.0f : 1.0f;
+    int c;
+    for (c = 0; c < kOutputChannels; ++c) {
+      const float expected = channel_map.gains[c] +
+          (kNewGains[c] - channel_map.gains[c]) * fraction;
+      CHECK(fabs(output[kOutputChannels * n + c] - expected) <= 1e-6f);
+    }
+  }
+  /* After the ramps, gains are exactly the targets. */
+  CHECK(ramp.num_ramping == 0);
+  int c;
+  for (c = 0; c < kOutputChannels; ++c) {
+    CHECK(ramp.channel_map.gains[c] == kNewGains[c]);
+  }
+}
+
+/* Exponential ramps change gains linearly in dB, through
+ * kChannelMapRampMinGain when ramping to or from zero.
+ */
+static void TestExponentialRamp(void) {
+  puts("TestExponentialRamp");
+  const ChannelMap channel_map = MakeChannelMap();
+  ChannelMapRamp ramp;
+  CHECK(ChannelMapRampInit(&ramp, &channel_map, 10,
+                           kChannelMapRampExponential));
+  const float kNewGains[kOutputChannels] = {0.02f, 0.4f, 1.0f, 0.0f};
+  ChannelMapRampSetGains(&ramp, kNewGains);
+
+  float output[kNumFrames * kOutputChannels];
+  RunOnOnes(&ramp, output);
+
+  int n;
+  for (n = 0; n < 10; ++n) {
+    const float fraction = (n + 1) / 10.0f;
+    int c;
+    for (c = 0; c < kOutputChannels; ++c) {
+      float start = channel_map.gains[c];
+      float end = kNewGains[c];
+      if (start < kChannelMapRampMinGain) { start = kChannelMapRampMinGain; }
+      if (end < kChannelMapRampMinGain) { end = kChannelMapRampMinGain; }
+      const float expected = start * pow(end / start, fraction);
+      if (n < 9 || kNewGains[c] > 0.0f) {
+        CHECK(fabs(output[kOutputChannels * n + c] - expected) <=
+              1e-5f * expected);
+      } else {
+        CHECK(output[kOutputChannels * n + c] == 0.0f);
+      }
+    }
+  }
+  for (; n < kNumFrames; ++n) {
+    int c;
+    for (c = 0; c < kOutputChannels; ++c) {
+      CHECK(output[kOutputChannels * n + c] == kNewGains[c]);
+    }
+  }
+}
+
+/* Setting a new target during a ramp continues from the current gain. */
+static void TestRetargetDuringRamp(void) {
+  puts("TestRetargetDuringRamp");
+  const ChannelMap channel_map = MakeChannelMap();
+  ChannelMapRamp ramp;
+  CHECK(ChannelMapRampInit(&ramp, &channel_map, 8, kChannelMapRampLinear));
+  ChannelMapRampSetGain(&ramp, 0, 1.0f);
+
+  float input[kNumFrames * kInputChannels];
+  float output[kNumFrames * kOutputChannels];
+  int i;
+  for (i = 0; i < kNumFrames * kInputChannels; ++i) {
+    input[i] = 1.0f;
+  }
+  ChannelMapRampApply(&ramp, input, 5, output);
+  const float gain_at_retarget = ramp.channel_map.gains[0];
+  CHECK(fabs(gain_at_retarget - (0.2f + 0.8f * 5 / 8)) <= 1e-6f);
+  ChannelMapRampSetGain(&ramp, 0, 0.0f);
+  CHECK(ramp.num_ramping == 1);
+  ChannelMapRampApply(&ramp, input, 20, output + kOutputChannels * 5);
+
+  /* Steps between frames are no larger than a full-range step. */
+  int n;
+  for (n = 1; n < 25; ++n) {
+    CHECK(fabs(output[kOutputChannels * n] -
+               output[kOutputChannels * (n - 1)]) <= 0.8f / 8 + 1e-6f);
+  }
+  CHECK(output[kOutputChannels * 24] == 0.0f);
+  CHECK(ramp.num_ramping == 0);
+}
+
+static void TestInvalidArgs(void) {
+  puts("TestInvalidArgs");
+  const ChannelMap channel_map = MakeChannelMap();
+  ChannelMapRamp ramp;
+  CHECK(!ChannelMapRampInit(&ramp, &channel_map, -1, kChannelMapRampLinear));
+  CHECK(!ChannelMapRampInit(&ramp, &channel_map, 10, 2));
+  /* With ramp_frames = 0, gains change immediately. */
+  CHECK(ChannelMapRampInit(&ramp, &channel_map, 0, kChannelMapRampLinear));
+  ChannelMapRampSetGain(&ramp, 3, 0.1f);
+  CHECK(ramp.num_ramping == 0);
+  CHECK(ramp.channel_map.gains[3] == 0.1f);
+}
+
+int main(int argc, char** argv) {
+  srand(0);
+  TestStaticGains();
+  TestLinearRamp();
+  TestExponentialRamp();
+  TestRetargetDuringRamp();
+  TestInvalidArgs();
+
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
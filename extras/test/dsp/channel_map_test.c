@@ -77,6 +77,34 @@ static void TestChannelMapApply(void) {
 }
 
 /* Test control value to gain mapping. */
+/* ChannelMapUsedInputs() finds the sources of outputs with nonzero gain. */
+static void TestUsedInputs(void) {
+  puts("TestUsedInputs");
+  ChannelMap channel_map;
+  ChannelMapInit(&channel_map, 10);
+  CHECK(ChannelMapUsedInputs(&channel_map) == 0x3ff);
+
+  channel_map.num_input_channels = 10;
+  channel_map.num_output_channels = 4;
+  channel_map.sources[0] = 9;
+  channel_map.sources[1] = 2;
+  channel_map.sources[2] = 2;
+  channel_map.sources[3] = 5;
+  channel_map.gains[0] = 0.5f;
+  channel_map.gains[1] = 0.0f;
+  channel_map.gains[2] = 1.0f;
+  channel_map.gains[3] = 0.0f;
+  /* Outputs past num_output_channels are ignored. */
+  channel_map.sources[4] = 7;
+  channel_map.gains[4] = 1.0f;
+  CHECK(ChannelMapUsedInputs(&channel_map) == ((1 << 9) | (1 << 2)));
+
+  channel_map.gains[2] = 0.0f;
+  CHECK(ChannelMapUsedInputs(&channel_map) == (1 << 9));
+  channel_map.gains[0] = 0.0f;
+  CHECK(ChannelMapUsedInputs(&channel_map) == 0);
+}
+
 static void TestGainMapping(void) {
   puts("TestGainMapping");
   CHECK(ChannelGainFromControlValue(0) == 0.0f);
@@ -110,6 +138,7 @@ int main(int argc, char** argv) {
   srand(0);
   TestChannelMapInit();
   TestChannelMapApply();
+  TestUsedInputs();
   TestGainMapping();
   TestGainControlValueRoundTrip();
 
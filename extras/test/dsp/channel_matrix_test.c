@@ -0,0 +1,228 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "src/dsp/channel_matrix.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "src/dsp/logging.h"
+
+#define kNumFrames 20
+
+static float RandUniform(float min_value, float max_value) {
+  return min_value + (max_value - min_value) * ((float)rand() / RAND_MAX);
+}
+
+static float* MakeInput(int num_channels) {
+  float* input = (float*)CHECK_NOTNULL(
+      malloc(kNumFrames * num_channels * sizeof(float)));
+  int i;
+  for (i = 0; i < kNumFrames * num_channels; ++i) {
+    input[i] = RandUniform(-1.0f, 1.0f);
+  }
+  return input;
+}
+
+/* Checks that arrays are equal. Padding terms with gain 0 may produce -0.0
+ * where the reference has 0.0, so floats are compared by value.
+ */
+static void CheckEqual(const float* actual, const float* expected, int size) {
+  int i;
+  for (i = 0; i < size; ++i) {
+    CHECK(actual[i] == expected[i]);
+  }
+}
+
+/* Computes the expected output with scalar code, summing terms in order. */
+static void ReferenceApply(const ChannelMatrix* matrix, const float* input,
+                           float* output) {
+  const int num_input_channels = matrix->num_input_channels;
+  const int num_output_channels = matrix->num_output_channels;
+  int i;
+  for (i = 0; i < kNumFrames; ++i) {
+    int c;
+    for (c = 0; c < num_output_channels; ++c) {
+      float sum = 0.0f;
+      int k;
+      for (k = 0; k < matrix->term_counts[c]; ++k) {
+        const float term = matrix->gains[k][c] * input[matrix->sources[k][c]];
+        sum = (k == 0) ? term : sum + term;
+      }
+      output[c] = sum;
+    }
+    input += num_input_channels;
+    output += num_output_channels;
+  }
+}
+
+/* Random sparse matrices match the scalar reference exactly. */
+static void TestRandomMatrix(int num_input_channels, int num_output_channels) {
+  printf("TestRandomMatrix(%d, %d)\n",
+         num_input_channels, num_output_channels);
+  ChannelMatrix matrix;
+  CHECK(ChannelMatrixInit(&matrix, num_input_channels, num_output_channels));
+  int c;
+  for (c = 0; c < num_output_channels; ++c) {
+    const int num_terms = rand() % (kChannelMatrixMaxTerms + 1);
+    int k;
+    for (k = 0; k < num_terms; ++k) {
+      CHECK(ChannelMatrixAddTerm(&matrix, c, rand() % num_input_channels,
+                                 RandUniform(0.0f, 1.0f)));
+    }
+  }
+
+  float* input = MakeInput(num_input_channels);
+  /* Sentinel after the output to check for overruns. */
+  const int output_size = kNumFrames * num_output_channels;
+  float* output = (float*)CHECK_NOTNULL(
+      malloc((output_size + 1) * sizeof(float)));
+  float* expected = (float*)CHECK_NOTNULL(
+      malloc(output_size * sizeof(float)));
+  output[output_size] = 123.0f;
+
+  ChannelMatrixApply(&matrix, input, kNumFrames, output);
+  ReferenceApply(&matrix, input, expected);
+
+  CHECK(output[output_size] == 123.0f);
+  CheckEqual(output, expected, output_size);
+
+  free(expected);
+  free(output);
+  free(input);
+}
+
+/* A matrix made from a ChannelMap, a permutation with gains, gives the same
+ * result as ChannelMapApply().
+ */
+static void TestFromChannelMap(void) {
+  puts("TestFromChannelMap");
+  const int kInputChannels = 10;
+  const int kOutputChannels = 24;
+  ChannelMap channel_map;
+  channel_map.num_input_channels = kInputChannels;
+  channel_map.num_output_channels = kOutputChannels;
+  int c;
+  for (c = 0; c < kOutputChannels; ++c) {
+    channel_map.sources[c] = rand() % kInputChannels;
+    channel_map.gains[c] = RandUniform(0.0f, 1.0f);
+  }
+  ChannelMatrix matrix;
+  CHECK(ChannelMatrixInitFromChannelMap(&matrix, &channel_map));
+  CHECK(matrix.num_terms == 1);
+
+  float* input = MakeInput(kInputChannels);
+  float output[kNumFrames * 24];
+  float expected[kNumFrames * 24];
+  ChannelMatrixApply(&matrix, input, kNumFrames, output);
+  ChannelMapApply(&channel_map, input, kNumFrames, expected);
+  CheckEqual(output, expected, kNumFrames * kOutputChannels);
+
+  free(input);
+}
+
+/* Identity mapping with gains, including in-place processing. */
+static void TestIdentity(int num_channels) {
+  printf("TestIdentity(%d)\n", num_channels);
+  ChannelMap channel_map;
+  ChannelMapInit(&channel_map, num_channels);
+  int c;
+  for (c = 0; c < num_channels; ++c) {
+    channel_map.gains[c] = RandUniform(0.0f, 1.0f);
+  }
+  ChannelMatrix matrix;
+  CHECK(ChannelMatrixInitFromChannelMap(&matrix, &channel_map));
+
+  float* input = MakeInput(num_channels);
+  float* expected = (float*)CHECK_NOTNULL(
+      malloc(kNumFrames * num_channels * sizeof(float)));
+  ChannelMapApply(&channel_map, input, kNumFrames, expected);
+  ChannelMatrixApply(&matrix, input, kNumFrames, input);
+  CheckEqual(input, expected, kNumFrames * num_channels);
+
+  free(expected);
+  free(input);
+}
+
+/* A general matrix may also be applied in place. */
+static void TestInPlace(void) {
+  puts("TestInPlace");
+  const int kNumChannels = 6;
+  ChannelMatrix matrix;
+  CHECK(ChannelMatrixInit(&matrix, kNumChannels, kNumChannels));
+  int c;
+  for (c = 0; c < kNumChannels; ++c) {  /* Average of neighboring channels. */
+    CHECK(ChannelMatrixAddTerm(&matrix, c, (c + 1) % kNumChannels, 0.5f));
+    CHECK(ChannelMatrixAddTerm(&matrix, c, c, 0.5f));
+  }
+
+  float* input = MakeInput(kNumChannels);
+  float expected[kNumFrames * 6];
+  ReferenceApply(&matrix, input, expected);
+  ChannelMatrixApply(&matrix, input, kNumFrames, input);
+  CheckEqual(input, expected, kNumFrames * kNumChannels);
+
+  free(input);
+}
+
+static void TestAddTerm(void) {
+  puts("TestAddTerm");
+  ChannelMatrix matrix;
+  CHECK(!ChannelMatrixInit(&matrix, 0, 2));
+  CHECK(!ChannelMatrixInit(&matrix, 2, kChannelMapMaxChannels + 1));
+  CHECK(ChannelMatrixInit(&matrix, 8, 2));
+  CHECK(matrix.num_terms == 0);
+
+  /* Adding an existing source accumulates its gain. */
+  CHECK(ChannelMatrixAddTerm(&matrix, 0, 3, 0.25f));
+  CHECK(ChannelMatrixAddTerm(&matrix, 0, 3, 0.5f));
+  CHECK(matrix.term_counts[0] == 1);
+  CHECK(matrix.gains[0][0] == 0.75f);
+
+  int k;
+  for (k = 1; k < kChannelMatrixMaxTerms; ++k) {
+    CHECK(ChannelMatrixAddTerm(&matrix, 0, k + 3, 1.0f));
+  }
+  CHECK(matrix.num_terms == kChannelMatrixMaxTerms);
+  CHECK(!ChannelMatrixAddTerm(&matrix, 0, 0, 1.0f));  /* Too many terms. */
+  CHECK(!ChannelMatrixAddTerm(&matrix, 2, 0, 1.0f));  /* Output out of range. */
+  CHECK(!ChannelMatrixAddTerm(&matrix, 1, 8, 1.0f));  /* Source out of range. */
+  CHECK(matrix.term_counts[1] == 0);
+
+  /* Output 1 has no terms, so it is zero. */
+  float input[8] = {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f};
+  float output[2];
+  ChannelMatrixApply(&matrix, input, 1, output);
+  CHECK(output[0] == 0.75f * 4.0f + 5.0f + 6.0f + 7.0f);
+  CHECK(output[1] == 0.0f);
+}
+
+int main(int argc, char** argv) {
+  srand(0);
+  TestRandomMatrix(1, 1);
+  TestRandomMatrix(10, 24);
+  TestRandomMatrix(24, 10);
+  TestRandomMatrix(3, 7);
+  TestRandomMatrix(32, 32);
+  TestFromChannelMap();
+  TestIdentity(4);
+  TestIdentity(10);
+  TestIdentity(24);
+  TestInPlace();
+  TestAddTerm();
+
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,181 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "src/dsp/cic_decimator.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+#include "src/dsp/logging.h"
+#include "src/dsp/math_constants.h"
+
+#define kNumOutput 2000
+#define kMaxInput (kNumOutput * kCicDecimatorMaxFactor)
+
+/* Computes the amplitude of `x` at `frequency` in cycles per sample. */
+static double ToneAmplitude(const int16_t* x, int num_samples,
+                            double frequency) {
+  double real = 0.0;
+  double imag = 0.0;
+  int n;
+  for (n = 0; n < num_samples; ++n) {
+    real += x[n] * cos(2.0 * M_PI * frequency * n);
+    imag -= x[n] * sin(2.0 * M_PI * frequency * n);
+  }
+  return 2.0 * sqrt(real * real + imag * imag) / num_samples;
+}
+
+/* Decimates a tone at `frequency` cycles per output sample with amplitude
+ * 10000, and returns the output amplitude at the tone's aliased frequency.
+ */
+static double DecimateTone(int factor, double frequency) {
+  static int16_t input[kMaxInput];
+  static int16_t output[kNumOutput];
+  const int num_input = kNumOutput * factor;
+  int n;
+  for (n = 0; n < num_input; ++n) {
+    input[n] = (int16_t)floor(
+        10000.0 * sin(2.0 * M_PI * frequency * n / factor) + 0.5);
+  }
+  CicDecimator decimator;
+  CHECK(CicDecimatorInit(&decimator, factor, 0));
+  CHECK(CicDecimatorProcessSamples(&decimator, input, num_input, output) ==
+        kNumOutput);
+  double aliased = frequency - floor(frequency + 0.5);
+  /* Skip the filter's startup transient. */
+  return ToneAmplitude(output + 100, kNumOutput - 100, fabs(aliased)) / 10000.0;
+}
+
+/* Constant input passes with unit gain. */
+static void TestConstant(int factor, int output_shift) {
+  printf("TestConstant(%d, %d)\n", factor, output_shift);
+  CicDecimator decimator;
+  CHECK(CicDecimatorInit(&decimator, factor, output_shift));
+  int16_t input[64 * kCicDecimatorMaxFactor];
+  int16_t output[64];
+  int i;
+  for (i = 0; i < 64 * factor; ++i) {
+    input[i] = -8000;
+  }
+  CHECK(CicDecimatorProcessSamples(&decimator, input, 64 * factor, output) ==
+        64);
+  /* After the CIC and compensator histories fill, output equals the input. */
+  for (i = kCicDecimatorOrder + 2; i < 64; ++i) {
+    CHECK(output[i] == -8000 >> output_shift);
+  }
+}
+
+/* The passband is flat after compensation, and aliasing bands are
+ * attenuated.
+ */
+static void TestFrequencyResponse(int factor) {
+  printf("TestFrequencyResponse(%d)\n", factor);
+  const double kPassbandFrequencies[] = {0.05, 0.1, 0.15, 0.2, 0.25};
+  int i;
+  for (i = 0; i < 5; ++i) {
+    const double gain_db = 20.0 * log10(
+        DecimateTone(factor, kPassbandFrequencies[i]));
+    CHECK(fabs(gain_db) < 0.3);
+  }
+  CHECK(20.0 * log10(DecimateTone(factor, 0.35)) > -1.6);
+
+  if (factor >= 4) {
+    /* Tones within 0.1 of the output rate alias into [0, 0.1]. */
+    CHECK(20.0 * log10(DecimateTone(factor, 0.9)) < -45.0);
+    CHECK(20.0 * log10(DecimateTone(factor, 1.05)) < -60.0);
+  }
+}
+
+/* Processing in blocks of any size gives the same output. */
+static void TestStreaming(int factor) {
+  printf("TestStreaming(%d)\n", factor);
+  static int16_t input[kMaxInput];
+  static int16_t expected[kNumOutput];
+  static int16_t output[kNumOutput];
+  const int num_input = 200 * factor;
+  int n;
+  for (n = 0; n < num_input; ++n) {
+    input[n] = (int16_t)(rand() % 20001 - 10000);
+  }
+
+  CicDecimator decimator;
+  CHECK(CicDecimatorInit(&decimator, factor, 2));
+  CHECK(CicDecimatorProcessSamples(&decimator, input, num_input, expected) ==
+        200);
+
+  CicDecimatorReset(&decimator);
+  int num_output = 0;
+  int start = 0;
+  while (start < num_input) {
+    int block_size = 1 + rand() % 50;
+    if (block_size > num_input - start) { block_size = num_input - start; }
+    num_output += CicDecimatorProcessSamples(
+        &decimator, input + start, block_size, output + num_output);
+    start += block_size;
+  }
+  CHECK(num_output == 200);
+  for (n = 0; n < 200; ++n) {
+    CHECK(output[n] == expected[n]);
+  }
+}
+
+/* Full-scale input saturates without wrapping around. */
+static void TestFullScale(void) {
+  puts("TestFullScale");
+  CicDecimator decimator;
+  CHECK(CicDecimatorInit(&decimator, kCicDecimatorMaxFactor, 0));
+  static int16_t input[64 * kCicDecimatorMaxFactor];
+  int16_t output[64];
+  int n;
+  /* A full-scale step, which overshoots through the compensator. */
+  for (n = 0; n < 64 * kCicDecimatorMaxFactor; ++n) {
+    input[n] = (n < 32 * kCicDecimatorMaxFactor) ? INT16_MIN : INT16_MAX;
+  }
+  CicDecimatorProcessSamples(&decimator, input, 64 * kCicDecimatorMaxFactor,
+                             output);
+  for (n = kCicDecimatorOrder + 2; n < 32; ++n) {
+    CHECK(output[n] == INT16_MIN);
+  }
+  for (n = 34; n < 64; ++n) {
+    CHECK(output[n] >= 0);
+  }
+  CHECK(output[63] == INT16_MAX);
+}
+
+static void TestInvalidArgs(void) {
+  puts("TestInvalidArgs");
+  CicDecimator decimator;
+  CHECK(!CicDecimatorInit(NULL, 4, 0));
+  CHECK(!CicDecimatorInit(&decimator, 0, 0));
+  CHECK(!CicDecimatorInit(&decimator, 3, 0));
+  CHECK(!CicDecimatorInit(&decimator, 2 * kCicDecimatorMaxFactor, 0));
+  CHECK(!CicDecimatorInit(&decimator, 4, -1));
+}
+
+int main(int argc, char** argv) {
+  srand(0);
+  int factor;
+  for (factor = 1; factor <= kCicDecimatorMaxFactor; factor *= 2) {
+    TestConstant(factor, 0);
+    TestConstant(factor, 2);
+    TestFrequencyResponse(factor);
+    TestStreaming(factor);
+  }
+  TestFullScale();
+  TestInvalidArgs();
+
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
@@ -397,6 +397,83 @@ static void TestComplexFloatArithmetic(void) {
   }
 }
 
+static ComplexFloat RandComplexFloat(void) {
+  return ComplexFloatMake(2 * RandUnif() - 1, 2 * RandUnif() - 1);
+}
+
+/* Array ops match the scalar ops exactly, for all sizes mod 4. */
+static void TestComplexFloatArrays(int size) {
+  printf("TestComplexFloatArrays(%d)\n", size);
+  ComplexFloat* a = (ComplexFloat*)CHECK_NOTNULL(
+      malloc(size * sizeof(ComplexFloat)));
+  ComplexFloat* b = (ComplexFloat*)CHECK_NOTNULL(
+      malloc(size * sizeof(ComplexFloat)));
+  ComplexFloat* init = (ComplexFloat*)CHECK_NOTNULL(
+      malloc(size * sizeof(ComplexFloat)));
+  /* One extra element as a sentinel to check for overruns. */
+  ComplexFloat* out = (ComplexFloat*)CHECK_NOTNULL(
+      malloc((size + 1) * sizeof(ComplexFloat)));
+  float* abs2 = (float*)CHECK_NOTNULL(malloc((size + 1) * sizeof(float)));
+  int k;
+  for (k = 0; k < size; ++k) {
+    a[k] = RandComplexFloat();
+    b[k] = RandComplexFloat();
+    init[k] = RandComplexFloat();
+  }
+  out[size] = ComplexFloatMake(123.0f, 456.0f);
+  abs2[size] = 789.0f;
+
+  ComplexFloatArrayMul(a, b, size, out);
+  for (k = 0; k < size; ++k) {
+    const ComplexFloat expected = ComplexFloatMul(a[k], b[k]);
+    CHECK(out[k].real == expected.real && out[k].imag == expected.imag);
+  }
+
+  for (k = 0; k < size; ++k) { out[k] = init[k]; }
+  ComplexFloatArrayMulAccum(a, b, size, out);
+  for (k = 0; k < size; ++k) {
+    const ComplexFloat expected =
+        ComplexFloatAdd(init[k], ComplexFloatMul(a[k], b[k]));
+    CHECK(out[k].real == expected.real && out[k].imag == expected.imag);
+  }
+
+  for (k = 0; k < size; ++k) { out[k] = init[k]; }
+  ComplexFloatArrayConjMulAccum(a, b, size, out);
+  for (k = 0; k < size; ++k) {
+    const ComplexFloat expected = ComplexFloatAdd(
+        init[k], ComplexFloatMul(ComplexFloatConj(a[k]), b[k]));
+    CHECK(out[k].real == expected.real && out[k].imag == expected.imag);
+  }
+
+  ComplexFloatArrayAbs2(a, size, abs2);
+  for (k = 0; k < size; ++k) {
+    CHECK(abs2[k] == ComplexFloatAbs2(a[k]));
+  }
+
+  ComplexFloatArrayScale(a, 0.3f, size, out);
+  for (k = 0; k < size; ++k) {
+    const ComplexFloat expected = ComplexFloatMulReal(a[k], 0.3f);
+    CHECK(out[k].real == expected.real && out[k].imag == expected.imag);
+  }
+
+  CHECK(out[size].real == 123.0f && out[size].imag == 456.0f);
+  CHECK(abs2[size] == 789.0f);
+
+  /* In-place multiply. */
+  for (k = 0; k < size; ++k) { out[k] = a[k]; }
+  ComplexFloatArrayMul(out, b, size, out);
+  for (k = 0; k < size; ++k) {
+    const ComplexFloat expected = ComplexFloatMul(a[k], b[k]);
+    CHECK(out[k].real == expected.real && out[k].imag == expected.imag);
+  }
+
+  free(abs2);
+  free(out);
+  free(init);
+  free(b);
+  free(a);
+}
+
 int main(int argc, char** argv) {
   srand(0);
   TestComplexDoubleBasic();
@@ -411,6 +488,11 @@ int main(int argc, char** argv) {
 
   TestComplexFloatBasic();
   TestComplexFloatArithmetic();
+  TestComplexFloatArrays(1);
+  TestComplexFloatArrays(6);
+  TestComplexFloatArrays(7);
+  TestComplexFloatArrays(64);
+  TestComplexFloatArrays(101);
 
   puts("PASS");
   return EXIT_SUCCESS;
@@ -18,6 +18,7 @@
 #include <math.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "src/dsp/logging.h"
 
@@ -112,6 +113,115 @@ static void TestConvertInt32ToFromFloat(void) {
   free(as_float);
 }
 
+static void TestConvertInt24ToFromFloat(void) {
+  puts("TestConvertInt24ToFromFloat");
+
+  CHECK(ConvertSampleInt24ToFloat(0) == 0);
+  CHECK(ConvertSampleInt24ToFloat(INT32_C(2097152)) == 0.25f);
+  CHECK(ConvertSampleInt24ToFloat(-INT32_C(8388608)) == -1.0f);
+
+  CHECK(ConvertSampleFloatToInt24(0.0f) == 0);
+  CHECK(ConvertSampleFloatToInt24(0.25f) == INT32_C(2097152));
+  CHECK(ConvertSampleFloatToInt24(-1.0f) == -INT32_C(8388608));
+  CHECK(ConvertSampleFloatToInt24(1.0f) == INT32_C(8388607));
+  CHECK(ConvertSampleFloatToInt24(-1000.0f) == -INT32_C(8388608));
+  CHECK(ConvertSampleFloatToInt24(1000.0f) == INT32_C(8388607));
+
+  /* Packed samples are 3-byte little endian. */
+  const uint8_t kPacked[9] = {0x01, 0x02, 0x03, 0x00, 0x00, 0x80, 0xff, 0xff,
+                              0xff};
+  float as_float[3];
+  ConvertSampleArrayInt24ToFloat(kPacked, 3, as_float);
+  CHECK(as_float[0] == 0x030201 / 8388608.0f);
+  CHECK(as_float[1] == -1.0f);
+  CHECK(as_float[2] == -1.0f / 8388608.0f);
+
+  uint8_t packed[9];
+  ConvertSampleArrayFloatToInt24(as_float, 3, packed);
+  CHECK(memcmp(packed, kPacked, 9) == 0);
+}
+
+/* Makes `num_samples` random samples, including out-of-range and boundary
+ * values, for comparing array and single-sample conversions.
+ */
+static float* MakeTestSamples(int num_samples) {
+  static const float kSpecial[] = {0.0f, -0.0f, 1.0f, -1.0f, 1000.0f,
+                                   -1000.0f, 0.5f / 32768, -0.5f / 32768,
+                                   1.5f / 32768, -1.5f / 32768};
+  const int kNumSpecial = sizeof(kSpecial) / sizeof(*kSpecial);
+  float* samples = (float*)CHECK_NOTNULL(malloc(num_samples * sizeof(float)));
+  int i;
+  for (i = 0; i < num_samples; ++i) {
+    samples[i] = (i < kNumSpecial) ? kSpecial[i]
+        : (float)(2.4 * RandUniform() - 1.2);
+  }
+  return samples;
+}
+
+/* Array conversions match the single-sample conversions exactly, for lengths
+ * that exercise both the vectorized loop and the remainder.
+ */
+static void TestArrayMatchesScalar(int num_samples) {
+  printf("TestArrayMatchesScalar(%d)\n", num_samples);
+  float* samples = MakeTestSamples(num_samples);
+  float* as_float = (float*)CHECK_NOTNULL(malloc(num_samples * sizeof(float)));
+  int16_t* as_int16 =
+      (int16_t*)CHECK_NOTNULL(malloc(num_samples * sizeof(int16_t)));
+  int32_t* as_int32 =
+      (int32_t*)CHECK_NOTNULL(malloc(num_samples * sizeof(int32_t)));
+  uint8_t* as_int24 = (uint8_t*)CHECK_NOTNULL(malloc(3 * num_samples));
+  uint16_t* as_pwm =
+      (uint16_t*)CHECK_NOTNULL(malloc(num_samples * sizeof(uint16_t)));
+  int i;
+
+  ConvertSampleArrayFloatToInt16(samples, num_samples, as_int16);
+  for (i = 0; i < num_samples; ++i) {
+    CHECK(as_int16[i] == ConvertSampleFloatToInt16(samples[i]));
+  }
+  ConvertSampleArrayInt16ToFloat(as_int16, num_samples, as_float);
+  for (i = 0; i < num_samples; ++i) {
+    CHECK(as_float[i] == ConvertSampleInt16ToFloat(as_int16[i]));
+  }
+
+  ConvertSampleArrayFloatToInt32(samples, num_samples, as_int32);
+  for (i = 0; i < num_samples; ++i) {
+    CHECK(as_int32[i] == ConvertSampleFloatToInt32(samples[i]));
+  }
+  ConvertSampleArrayInt32ToFloat(as_int32, num_samples, as_float);
+  for (i = 0; i < num_samples; ++i) {
+    CHECK(as_float[i] == ConvertSampleInt32ToFloat(as_int32[i]));
+  }
+
+  ConvertSampleArrayFloatToInt24(samples, num_samples, as_int24);
+  for (i = 0; i < num_samples; ++i) {
+    const int32_t expected = ConvertSampleFloatToInt24(samples[i]);
+    CHECK(as_int24[3 * i] == (expected & 0xff));
+    CHECK(as_int24[3 * i + 1] == ((expected >> 8) & 0xff));
+    CHECK(as_int24[3 * i + 2] == ((expected >> 16) & 0xff));
+  }
+  ConvertSampleArrayInt24ToFloat(as_int24, num_samples, as_float);
+  for (i = 0; i < num_samples; ++i) {
+    CHECK(as_float[i] ==
+          ConvertSampleInt24ToFloat(ConvertSampleFloatToInt24(samples[i])));
+  }
+
+  ConvertSampleArrayFloatTo0_MaxValue(samples, num_samples, 512, as_pwm);
+  for (i = 0; i < num_samples; ++i) {
+    CHECK(as_pwm[i] == ConvertSampleFloatTo0_MaxValue(samples[i], 512));
+  }
+  ConvertSampleArrayFloatTo0_MaxValue(samples, num_samples, 65535, as_pwm);
+  for (i = 0; i < num_samples; ++i) {
+    CHECK(as_pwm[i] == ConvertSampleFloatTo0_MaxValue(samples[i], 65535));
+  }
+
+  free(as_pwm);
+  free(as_int24);
+  free(as_int32);
+  free(as_int16);
+  free(as_float);
+  free(samples);
+}
+
 static void TestConvertFloatTo0_MaxValue(void) {
   puts("TestConvertFloatTo0_MaxValue");
 
@@ -130,7 +240,12 @@ int main(int argc, char** argv) {
   srand(0);
   TestConvertInt16ToFromFloat();
   TestConvertInt32ToFromFloat();
+  TestConvertInt24ToFromFloat();
   TestConvertFloatTo0_MaxValue();
+  TestArrayMatchesScalar(1);
+  TestArrayMatchesScalar(11);
+  TestArrayMatchesScalar(1000);
+  TestArrayMatchesScalar(1003);
 
   puts("PASS");
   return EXIT_SUCCESS;
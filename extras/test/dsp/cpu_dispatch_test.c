@@ -0,0 +1,46 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "src/dsp/cpu_dispatch.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "src/dsp/logging.h"
+#include "src/dsp/simd.h"
+
+/* CpuDispatchLevel() names a clone, or the baseline Float4 implementation. */
+static void TestCpuDispatchLevel(void) {
+  puts("TestCpuDispatchLevel");
+  const char* level = CpuDispatchLevel();
+  CHECK(level != NULL);
+  printf("CpuDispatchLevel: %s\n", level);
+#ifdef CPU_DISPATCH_ENABLED
+  CHECK(!strcmp(level, "avx512f") || !strcmp(level, "avx2") ||
+        !strcmp(level, kFloat4Implementation));
+#else
+  CHECK(!strcmp(level, kFloat4Implementation));
+#endif
+  /* The result is the same on repeated calls. */
+  CHECK(!strcmp(CpuDispatchLevel(), level));
+}
+
+int main(int argc, char** argv) {
+  TestCpuDispatchLevel();
+
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
@@ -16,6 +16,7 @@
 #include "src/dsp/decibels.h"
 
 #include <math.h>
+#include <stdlib.h>
 
 #include "src/dsp/logging.h"
 #include "src/dsp/math_constants.h"
@@ -178,6 +179,59 @@ static void TestFastDecibelsToAmplitudeRatio(void) {
   }
 }
 
+/* Array conversions match the exact conversions. Sizes not a multiple of 4
+ * exercise the remainder handling.
+ */
+static void TestFastArrayConversions(int size) {
+  printf("TestFastArrayConversions(%d)\n", size);
+  float* linear = (float*)CHECK_NOTNULL(malloc(size * sizeof(float)));
+  float* decibels = (float*)CHECK_NOTNULL(malloc(size * sizeof(float)));
+  float* output = (float*)CHECK_NOTNULL(malloc(size * sizeof(float)));
+  int i;
+  for (i = 0; i < size; ++i) {
+    decibels[i] = RandDb();
+  }
+
+  for (i = 0; i < size; ++i) {
+    linear[i] = DecibelsToPowerRatio(decibels[i]);
+  }
+  FastPowerRatioToDecibelsN(linear, -HUGE_VAL, size, output);
+  for (i = 0; i < size; ++i) {
+    CHECK(IsClose(output[i], decibels[i], 1e-4f));
+  }
+  FastDecibelsToPowerRatioN(decibels, size, output);
+  for (i = 0; i < size; ++i) {
+    CHECK(IsClose(output[i], linear[i], 1e-5f * linear[i]));
+  }
+
+  for (i = 0; i < size; ++i) {
+    linear[i] = DecibelsToAmplitudeRatio(decibels[i]);
+  }
+  FastAmplitudeRatioToDecibelsN(linear, -HUGE_VAL, size, output);
+  for (i = 0; i < size; ++i) {
+    CHECK(IsClose(output[i], decibels[i], 2e-4f));
+  }
+  FastDecibelsToAmplitudeRatioN(decibels, size, output);
+  for (i = 0; i < size; ++i) {
+    CHECK(IsClose(output[i], linear[i], 1e-5f * linear[i]));
+  }
+
+  /* Conversion to dB with a floor, in place. Zeros are allowed. */
+  for (i = 0; i < size; ++i) {
+    output[i] = (i % 3 == 0) ? 0.0f : DecibelsToPowerRatio(decibels[i]);
+  }
+  FastPowerRatioToDecibelsN(output, -20.0f, size, output);
+  for (i = 0; i < size; ++i) {
+    const float expected =
+        (i % 3 == 0 || decibels[i] < -20.0f) ? -20.0f : decibels[i];
+    CHECK(IsClose(output[i], expected, 1e-4f));
+  }
+
+  free(output);
+  free(decibels);
+  free(linear);
+}
+
 int main(int argc, char** argv) {
   srand(0);
   TestPowerRatioToDecibels();
@@ -190,6 +244,12 @@ int main(int argc, char** argv) {
   TestFastDecibelsToPowerRatio();
   TestFastDecibelsToAmplitudeRatio();
 
+  int size;
+  for (size = 1; size <= 9; ++size) {
+    TestFastArrayConversions(size);
+  }
+  TestFastArrayConversions(kNumRandomValues);
+
   puts("PASS");
   return EXIT_SUCCESS;
 }
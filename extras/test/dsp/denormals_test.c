@@ -0,0 +1,112 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "src/dsp/denormals.h"
+
+#include <float.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "src/dsp/biquad_filter.h"
+#include "src/dsp/butterworth.h"
+#include "src/dsp/logging.h"
+
+/* Computes FLT_MIN / 4, a denormal, at run time. */
+static float MakeDenormal(void) {
+  volatile float x = FLT_MIN;
+  volatile float y = x * 0.25f;
+  return y;
+}
+
+/* Inside a guard, denormals are flushed to zero where supported, and the
+ * caller's mode is restored afterward.
+ */
+static void TestGuard(void) {
+  puts("TestGuard");
+  const uint32_t control_before = DenormalsGetControl();
+  CHECK(MakeDenormal() != 0.0f);
+
+  DenormalGuard guard;
+  DenormalGuardBegin(&guard);
+  if (kDenormalsHaveFlushToZero) {
+    CHECK(MakeDenormal() == 0.0f);
+  }
+
+  /* Nested guard leaves the mode on. */
+  DenormalGuard inner_guard;
+  DenormalGuardBegin(&inner_guard);
+  DenormalGuardEnd(&inner_guard);
+  if (kDenormalsHaveFlushToZero) {
+    CHECK(MakeDenormal() == 0.0f);
+  }
+
+  DenormalGuardEnd(&guard);
+  /* Compare only the mode bits, since exception status flags may change. */
+  CHECK((DenormalsGetControl() & kDenormalsControlBits) ==
+        (control_before & kDenormalsControlBits));
+  CHECK(MakeDenormal() != 0.0f);
+}
+
+static void TestDither(void) {
+  puts("TestDither");
+  float state[3] = {0.0f, 1.0f, -2.0f};
+  DenormalsDither(state, 3);
+  if (kDenormalsUseDither) {
+    CHECK(state[0] == kDenormalsDitherOffset);
+    CHECK(state[1] == 1.0f + kDenormalsDitherOffset);
+  } else {
+    CHECK(state[0] == 0.0f);
+    CHECK(state[1] == 1.0f);
+  }
+}
+
+/* A lowpass filter's state decays through the denormal range after an
+ * impulse. With the guard and dither applied per block as the library does,
+ * the state never becomes denormal (unless AUDIO_TO_TACTILE_ALLOW_DENORMALS).
+ */
+static void TestBiquadDecay(void) {
+  puts("TestBiquadDecay");
+  BiquadFilterCoeffs coeffs;
+  CHECK(DesignButterworthOrder2Lowpass(500.0f, 16000.0f, &coeffs));
+  BiquadFilterState state;
+  BiquadFilterInitZero(&state);
+
+  float block[64] = {1.0f};
+  int n;
+  for (n = 0; n < 2000; ++n) {
+    DenormalGuard guard;
+    DenormalGuardBegin(&guard);
+    DenormalsDither(state.z, 2);
+    BiquadFilterProcessBlock(&coeffs, &state, block, 64, block);
+    DenormalGuardEnd(&guard);
+
+    int i;
+    for (i = 0; i < 2 && (kDenormalsHaveFlushToZero || kDenormalsUseDither);
+         ++i) {
+      const float z = (state.z[i] < 0.0f) ? -state.z[i] : state.z[i];
+      CHECK(z == 0.0f || z >= FLT_MIN);
+    }
+    for (i = 0; i < 64; ++i) { block[i] = 0.0f; }
+  }
+}
+
+int main(int argc, char** argv) {
+  TestGuard();
+  TestDither();
+  TestBiquadDecay();
+
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
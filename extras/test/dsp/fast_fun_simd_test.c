@@ -0,0 +1,183 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "src/dsp/fast_fun_simd.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "src/dsp/logging.h"
+#include "src/dsp/math_constants.h"
+
+static double RandUniform(void) { return (double)rand() / RAND_MAX; }
+
+/* Loads four random values in [min_value, max_value] into `values`. */
+static Float4 RandFloat4(double min_value, double max_value, float* values) {
+  int i;
+  for (i = 0; i < 4; ++i) {
+    values[i] = (float)(min_value + (max_value - min_value) * RandUniform());
+  }
+  return Float4Load(values);
+}
+
+/* Compare FastLog2Float4 with math.h. */
+static void TestFastLog2Float4Accuracy(void) {
+  puts("TestFastLog2Float4Accuracy");
+  double max_abs_error = 0.0;
+  int trial;
+  for (trial = 0; trial < 10000; ++trial) {
+    float x[4];
+    RandFloat4(-125.5, 125.5, x);
+    int i;
+    for (i = 0; i < 4; ++i) {
+      x[i] = (float)exp(M_LN2 * x[i]);
+    }
+    float result[4];
+    Float4Store(result, FastLog2Float4(Float4Load(x)));
+    for (i = 0; i < 4; ++i) {
+      const double abs_error = fabs(result[i] - log(x[i]) / M_LN2);
+      if (abs_error > max_abs_error) { max_abs_error = abs_error; }
+    }
+  }
+  CHECK(max_abs_error < 2e-5);
+}
+
+/* Compare FastExp2Float4 with math.h. */
+static void TestFastExp2Float4Accuracy(void) {
+  puts("TestFastExp2Float4Accuracy");
+  double max_rel_error = 0.0;
+  int trial;
+  for (trial = 0; trial < 10000; ++trial) {
+    float x[4];
+    const Float4 x4 = RandFloat4(-125.5, 125.5, x);
+    float result[4];
+    Float4Store(result, FastExp2Float4(x4));
+    int i;
+    for (i = 0; i < 4; ++i) {
+      const double rel_error = fabs(result[i] / exp(M_LN2 * x[i]) - 1.0);
+      if (rel_error > max_rel_error) { max_rel_error = rel_error; }
+    }
+  }
+  CHECK(max_rel_error < 3e-6);
+
+  /* Exact at integers. */
+  const float integers[4] = {-20.0f, 0.0f, 1.0f, 100.0f};
+  float result[4];
+  Float4Store(result, FastExp2Float4(Float4Load(integers)));
+  CHECK(fabs(result[0] / ldexp(1.0, -20) - 1.0) < 1e-6);
+  CHECK(fabs(result[1] - 1.0) < 1e-6);
+  CHECK(fabs(result[2] - 2.0) < 2e-6);
+  CHECK(fabs(result[3] / ldexp(1.0, 100) - 1.0) < 1e-6);
+}
+
+/* Compare FastPowFloat4 with math.h. */
+static void TestFastPowFloat4Accuracy(void) {
+  puts("TestFastPowFloat4Accuracy");
+  double max_rel_error = 0.0;
+  /* Check x^y over a 2-D grid of points 0.1 <= x <= 50, -2 <= y <= 2. */
+  int i;
+  for (i = 1; i <= 500; ++i) {
+    const double x = 0.1 * i;
+    int j;
+    for (j = -20; j <= 20; j += 4) {
+      const float y[4] = {0.1f * j, 0.1f * (j + 1), 0.1f * (j + 2),
+                          0.1f * (j + 3)};
+      float result[4];
+      Float4Store(result, FastPowFloat4(Float4Broadcast(x), Float4Load(y)));
+      int k;
+      for (k = 0; k < 4; ++k) {
+        const double rel_error = fabs(result[k] / pow(x, y[k]) - 1.0);
+        if (rel_error > max_rel_error) { max_rel_error = rel_error; }
+      }
+    }
+  }
+  CHECK(max_rel_error < 3e-5);
+}
+
+/* Compare FastTanhFloat4 with math.h. */
+static void TestFastTanhFloat4Accuracy(void) {
+  puts("TestFastTanhFloat4Accuracy");
+  double max_abs_error = 0.0;
+  int trial;
+  for (trial = 0; trial < 10000; ++trial) {
+    float x[4];
+    const Float4 x4 = RandFloat4(-12.0, 12.0, x);
+    float result[4];
+    Float4Store(result, FastTanhFloat4(x4));
+    int i;
+    for (i = 0; i < 4; ++i) {
+      const double abs_error = fabs(result[i] - tanh(x[i]));
+      if (abs_error > max_abs_error) { max_abs_error = abs_error; }
+    }
+  }
+  CHECK(max_abs_error < 2e-6);
+
+  /* Saturates for large |x|. */
+  const float large[4] = {-1e30f, -20.0f, 20.0f, 1e30f};
+  float result[4];
+  Float4Store(result, FastTanhFloat4(Float4Load(large)));
+  CHECK(result[0] == -1.0f);
+  CHECK(result[1] == -1.0f);
+  CHECK(result[2] == 1.0f);
+  CHECK(result[3] == 1.0f);
+}
+
+/* FastPowN and FastTanhN match the Float4 functions, for sizes that are not
+ * multiples of 4 and with in-place processing.
+ */
+static void TestArrayFunctions(void) {
+  puts("TestArrayFunctions");
+  float input[11];
+  float output[11];
+  int size;
+  for (size = 0; size <= 11; ++size) {
+    int i;
+    for (i = 0; i < size; ++i) {
+      input[i] = (float)(0.01 + 10.0 * RandUniform());
+    }
+
+    FastPowN(input, 0.3f, size, output);
+    for (i = 0; i < size; ++i) {
+      CHECK(output[i] == Float4GetLane(FastPowFloat4(
+          Float4Broadcast(input[i]), Float4Broadcast(0.3f)), 0));
+    }
+
+    FastTanhN(input, size, output);
+    for (i = 0; i < size; ++i) {
+      CHECK(output[i] == Float4GetLane(
+          FastTanhFloat4(Float4Broadcast(input[i])), 0));
+    }
+
+    /* In place. */
+    memcpy(output, input, size * sizeof(float));
+    FastPowN(output, -0.5f, size, output);
+    for (i = 0; i < size; ++i) {
+      CHECK(fabs(output[i] * sqrt(input[i]) - 1.0) < 3e-5);
+    }
+  }
+}
+
+int main(int argc, char** argv) {
+  srand(0);
+  TestFastLog2Float4Accuracy();
+  TestFastExp2Float4Accuracy();
+  TestFastPowFloat4Accuracy();
+  TestFastTanhFloat4Accuracy();
+  TestArrayFunctions();
+
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
@@ -106,6 +106,55 @@ static void TestFastPowAccuracy(void) {
   CHECK(max_rel_error < 0.005);
 }
 
+/* Compare FastPowTableEval with math.h. */
+static void TestFastPowTableAccuracy(void) {
+  puts("TestFastPowTableAccuracy");
+  const float kExponents[] = {-1.0f, -0.7f, -0.3f, 0.1f, 0.25f, 0.5f, 1.0f};
+  int n;
+  for (n = 0; n < (int)(sizeof(kExponents) / sizeof(*kExponents)); ++n) {
+    const float p = kExponents[n];
+    FastPowTable table;
+    FastPowTableInit(&table, p);
+    double max_rel_error = 0.0;
+
+    /* Check random x with log2(x) uniform over [-60, 60]. */
+    int i;
+    for (i = 0; i < 20000; ++i) {
+      const float x = (float)pow(2.0, 120.0 * RandUniform() - 60.0);
+      const double rel_error =
+          fabs(FastPowTableEval(&table, x) / pow(x, p) - 1.0);
+      if (rel_error > max_rel_error) {
+        max_rel_error = rel_error;
+      }
+    }
+
+    CHECK(max_rel_error < ((p == 0.25f) ? 3e-5 : 1.5e-4));
+    /* Exact at powers of 2, up to the segment shift. */
+    CHECK(fabs(FastPowTableEval(&table, 8.0f) / pow(8.0, p) - 1.0) < 1.5e-4);
+    /* Zero is clamped to 2^-64. */
+    CHECK(FastPowTableEval(&table, 0.0f) ==
+          FastPowTableEval(&table, (float)pow(2.0, -64.0)));
+  }
+}
+
+/* Compare FastRsqrt with math.h. */
+static void TestFastRsqrtAccuracy(void) {
+  puts("TestFastRsqrtAccuracy");
+  double max_rel_error = 0.0;
+
+  /* Check 1/sqrt(x) over 1e-6 <= x <= 1e6. */
+  int i;
+  for (i = -6000; i <= 6000; ++i) {
+    const double x = pow(10.0, i / 1000.0);
+    const double rel_error = fabs(FastRsqrt(x) * sqrt(x) - 1.0);
+    if (rel_error > max_rel_error) {
+      max_rel_error = rel_error;
+    }
+  }
+
+  CHECK(max_rel_error < 0.002);
+}
+
 /* Compare FastTanh with math.h. */
 static void TestFastTanhAccuracy(void) {
   puts("TestFastTanhAccuracy");
@@ -326,6 +375,8 @@ int main(int argc, char** argv) {
   TestFastLog2Accuracy();
   TestFastExp2Accuracy();
   TestFastPowAccuracy();
+  TestFastPowTableAccuracy();
+  TestFastRsqrtAccuracy();
   TestFastTanhAccuracy();
   TestFastSigmoidAccuracy();
   TestFastLog2DerivativeAccuracy();
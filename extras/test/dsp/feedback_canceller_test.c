@@ -0,0 +1,248 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "src/dsp/feedback_canceller.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "src/dsp/logging.h"
+
+/* Fills random values in [-1, 1]. */
+static void FillRandomValues(int size, float* output) {
+  int i;
+  for (i = 0; i < size; ++i) {
+    output[i] = rand() / (0.5f * RAND_MAX) - 1;
+  }
+}
+
+/* Makes a random decaying feedback path of `num_taps` taps. */
+static void MakeFeedbackPath(int num_taps, float* path) {
+  FillRandomValues(num_taps, path);
+  int k;
+  for (k = 0; k < num_taps; ++k) {
+    path[k] *= 0.5f * (float)exp(-4.0 * k / num_taps);
+  }
+}
+
+/* Simulated feedback: a streaming FIR filter of the reference signal. */
+typedef struct {
+  const float* path;
+  int num_taps;
+  float* history;  /* Past reference samples, most recent first. */
+} FeedbackPath;
+
+static void FeedbackPathInit(FeedbackPath* feedback, const float* path,
+                             int num_taps) {
+  feedback->path = path;
+  feedback->num_taps = num_taps;
+  feedback->history = (float*)CHECK_NOTNULL(calloc(num_taps, sizeof(float)));
+}
+
+static float FeedbackPathProcessSample(FeedbackPath* feedback, float x) {
+  memmove(feedback->history + 1, feedback->history,
+          sizeof(float) * (feedback->num_taps - 1));
+  feedback->history[0] = x;
+  double sum = 0.0;
+  int k;
+  for (k = 0; k < feedback->num_taps; ++k) {
+    sum += feedback->path[k] * feedback->history[k];
+  }
+  return (float)sum;
+}
+
+/* Runs `num_blocks` blocks of white reference through `feedback` plus `ambient`
+ * (may be NULL for none) and the canceller. Returns the ratio in dB of mic
+ * feedback energy to residual feedback energy, over the last quarter of the
+ * blocks.
+ */
+static double RunBlocks(FeedbackCanceller* canceller, FeedbackPath* feedback,
+                        int num_blocks, float ambient_amplitude) {
+  const int block_size = FeedbackCancellerBlockSize(canceller);
+  float* reference = (float*)CHECK_NOTNULL(malloc(sizeof(float) * block_size));
+  float* mic = (float*)CHECK_NOTNULL(malloc(sizeof(float) * block_size));
+  float* ambient = (float*)CHECK_NOTNULL(malloc(sizeof(float) * block_size));
+  float* output = (float*)CHECK_NOTNULL(malloc(sizeof(float) * block_size));
+  double feedback_energy = 0.0;
+  double residual_energy = 0.0;
+  int block;
+  for (block = 0; block < num_blocks; ++block) {
+    FillRandomValues(block_size, reference);
+    FillRandomValues(block_size, ambient);
+    int n;
+    for (n = 0; n < block_size; ++n) {
+      ambient[n] *= ambient_amplitude;
+      mic[n] = FeedbackPathProcessSample(feedback, reference[n]) + ambient[n];
+    }
+    FeedbackCancellerProcessBlock(canceller, reference, mic, 1, output);
+
+    if (block >= num_blocks - num_blocks / 4) {
+      for (n = 0; n < block_size; ++n) {
+        const float feedback_sample = mic[n] - ambient[n];
+        const float residual = output[n] - ambient[n];
+        feedback_energy += feedback_sample * feedback_sample;
+        residual_energy += residual * residual;
+      }
+    }
+  }
+
+  free(output);
+  free(ambient);
+  free(mic);
+  free(reference);
+  return 10.0 * log10(feedback_energy / (residual_energy + 1e-30));
+}
+
+/* The canceller learns the feedback path and removes most of the feedback. */
+static void TestConvergence(int block_size, int num_taps) {
+  printf("TestConvergence(%d, %d)\n", block_size, num_taps);
+  srand(0);
+  float* path = (float*)CHECK_NOTNULL(malloc(sizeof(float) * num_taps));
+  MakeFeedbackPath(num_taps, path);
+  FeedbackPath feedback;
+  FeedbackPathInit(&feedback, path, num_taps);
+  FeedbackCanceller* canceller =
+      CHECK_NOTNULL(FeedbackCancellerMake(block_size, num_taps, NULL));
+  CHECK(FeedbackCancellerNumTaps(canceller) >= num_taps);
+  CHECK(FeedbackCancellerNumTaps(canceller) % block_size == 0);
+
+  const double erle_db = RunBlocks(canceller, &feedback,
+                                   (60 * num_taps) / block_size + 200, 0.0f);
+  CHECK(erle_db >= 40.0);
+
+  /* The learned taps approximate the feedback path. */
+  float* taps = (float*)CHECK_NOTNULL(
+      malloc(sizeof(float) * FeedbackCancellerNumTaps(canceller)));
+  FeedbackCancellerGetTaps(canceller, taps);
+  int k;
+  for (k = 0; k < FeedbackCancellerNumTaps(canceller); ++k) {
+    const float expected = (k < num_taps) ? path[k] : 0.0f;
+    CHECK(fabs(taps[k] - expected) <= 1e-3f);
+  }
+
+  free(taps);
+  FeedbackCancellerFree(canceller);
+  free(feedback.history);
+  free(path);
+}
+
+/* With ambient sound in the mic, feedback is still reduced, and the ambient
+ * sound is passed through.
+ */
+static void TestWithAmbientSound(void) {
+  puts("TestWithAmbientSound");
+  srand(0);
+  const int kBlockSize = 64;
+  const int kNumTaps = 128;
+  float path[128];
+  MakeFeedbackPath(kNumTaps, path);
+  FeedbackPath feedback;
+  FeedbackPathInit(&feedback, path, kNumTaps);
+  FeedbackCanceller* canceller =
+      CHECK_NOTNULL(FeedbackCancellerMake(kBlockSize, kNumTaps, NULL));
+
+  /* Ambient sound at about -20 dB relative to the feedback. */
+  const double erle_db = RunBlocks(canceller, &feedback, 500, 0.05f);
+  CHECK(erle_db >= 15.0);
+
+  FeedbackCancellerFree(canceller);
+  free(feedback.history);
+}
+
+/* The canceller tracks a change in the feedback path. */
+static void TestTracksPathChange(void) {
+  puts("TestTracksPathChange");
+  srand(0);
+  const int kBlockSize = 32;
+  const int kNumTaps = 64;
+  float path[64];
+  MakeFeedbackPath(kNumTaps, path);
+  FeedbackPath feedback;
+  FeedbackPathInit(&feedback, path, kNumTaps);
+  FeedbackCanceller* canceller =
+      CHECK_NOTNULL(FeedbackCancellerMake(kBlockSize, kNumTaps, NULL));
+  CHECK(RunBlocks(canceller, &feedback, 300, 0.0f) >= 40.0);
+
+  /* Change the path, e.g. from the wearer adjusting the device. */
+  int k;
+  for (k = 0; k < kNumTaps; ++k) {
+    path[k] *= -0.7f;
+  }
+  CHECK(RunBlocks(canceller, &feedback, 300, 0.0f) >= 40.0);
+
+  FeedbackCancellerFree(canceller);
+  free(feedback.history);
+}
+
+/* Without adaptation, a fresh canceller passes the mic through unchanged, and
+ * a fixed model is applied consistently across calls.
+ */
+static void TestNoAdaptation(void) {
+  puts("TestNoAdaptation");
+  srand(0);
+  const int kBlockSize = 16;
+  FeedbackCanceller* canceller =
+      CHECK_NOTNULL(FeedbackCancellerMake(kBlockSize, 40, NULL));
+  CHECK(FeedbackCancellerNumTaps(canceller) == 48);
+  float reference[16];
+  float mic[16];
+  float output[16];
+  int block;
+  for (block = 0; block < 10; ++block) {
+    FillRandomValues(kBlockSize, reference);
+    FillRandomValues(kBlockSize, mic);
+    FeedbackCancellerProcessBlock(canceller, reference, mic, 0, output);
+    int n;
+    for (n = 0; n < kBlockSize; ++n) {
+      CHECK(output[n] == mic[n]);
+    }
+  }
+
+  /* In-place processing. */
+  float expected[16];
+  memcpy(expected, mic, sizeof(mic));
+  FeedbackCancellerProcessBlock(canceller, reference, mic, 0, mic);
+  CHECK(memcmp(mic, expected, sizeof(mic)) == 0);
+
+  FeedbackCancellerFree(canceller);
+}
+
+static void TestInvalidArgs(void) {
+  puts("TestInvalidArgs");
+  CHECK(FeedbackCancellerMake(1, 64, NULL) == NULL);
+  CHECK(FeedbackCancellerMake(48, 64, NULL) == NULL);
+  CHECK(FeedbackCancellerMake(64, 0, NULL) == NULL);
+
+  FeedbackCancellerOptions options = kFeedbackCancellerDefaultOptions;
+  options.step_size = 0.0f;
+  CHECK(FeedbackCancellerMake(64, 64, &options) == NULL);
+  options = kFeedbackCancellerDefaultOptions;
+  options.power_smoothing = 1.0f;
+  CHECK(FeedbackCancellerMake(64, 64, &options) == NULL);
+}
+
+int main(int argc, char** argv) {
+  TestConvergence(16, 16);
+  TestConvergence(32, 100);
+  TestConvergence(64, 256);
+  TestWithAmbientSound();
+  TestTracksPathChange();
+  TestNoAdaptation();
+  TestInvalidArgs();
+
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
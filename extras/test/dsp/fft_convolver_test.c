@@ -0,0 +1,181 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "src/dsp/fft_convolver.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "src/dsp/fft.h"
+#include "src/dsp/logging.h"
+
+static const float kTol = 1e-4f;
+
+/* Fills random values in [-1, 1]. */
+static void FillRandomValues(int size, float* output) {
+  int i;
+  for (i = 0; i < size; ++i) {
+    output[i] = rand() / (0.5f * RAND_MAX) - 1;
+  }
+}
+
+/* Computes the FIR filtering y[n] = sum_k h[k] x[n - k] by direct convolution,
+ * with x[n] = 0 for n < 0.
+ */
+static void DirectConvolution(const float* kernel, int num_taps,
+                              const float* input, int num_samples,
+                              float* output) {
+  int n;
+  for (n = 0; n < num_samples; ++n) {
+    double sum = 0.0;
+    int k;
+    for (k = 0; k < num_taps && k <= n; ++k) {
+      sum += kernel[k] * input[n - k];
+    }
+    output[n] = (float)sum;
+  }
+}
+
+/* Checks that FftConvolver matches direct convolution. */
+static void TestMatchesDirectConvolution(int num_taps, int block_size) {
+  printf("TestMatchesDirectConvolution(%d, %d)\n", num_taps, block_size);
+  const int kNumBlocks = 6;
+  const int num_samples = kNumBlocks * block_size;
+  float* kernel = (float*)CHECK_NOTNULL(malloc(sizeof(float) * num_taps));
+  float* input = (float*)CHECK_NOTNULL(malloc(sizeof(float) * num_samples));
+  float* expected = (float*)CHECK_NOTNULL(malloc(sizeof(float) * num_samples));
+  float* output = (float*)CHECK_NOTNULL(malloc(sizeof(float) * num_samples));
+  FillRandomValues(num_taps, kernel);
+  FillRandomValues(num_samples, input);
+  DirectConvolution(kernel, num_taps, input, num_samples, expected);
+
+  FftConvolver* convolver =
+      CHECK_NOTNULL(FftConvolverMake(kernel, num_taps, block_size));
+  CHECK(FftConvolverBlockSize(convolver) == block_size);
+  CHECK(FftConvolverNumTaps(convolver) == num_taps);
+
+  /* Error grows with the number of terms in the sum. */
+  const float tol = kTol * sqrt(num_taps);
+  int trial;
+  for (trial = 0; trial < 2; ++trial) {
+    int n;
+    for (n = 0; n < num_samples; n += block_size) {
+      FftConvolverProcessBlock(convolver, input + n, output + n);
+    }
+
+    for (n = 0; n < num_samples; ++n) {
+      CHECK(fabs(output[n] - expected[n]) <= tol);
+    }
+
+    /* After reset, the output is the same on the second trial. */
+    FftConvolverReset(convolver);
+  }
+
+  FftConvolverFree(convolver);
+  free(output);
+  free(expected);
+  free(input);
+  free(kernel);
+}
+
+/* Checks in-place processing, where output aliases input. */
+static void TestInPlace(void) {
+  puts("TestInPlace");
+  const int kNumTaps = 100;
+  const int kBlockSize = 16;
+  const int kNumSamples = 10 * kBlockSize;
+  float kernel[100];
+  float input[160];
+  float expected[160];
+  FillRandomValues(kNumTaps, kernel);
+  FillRandomValues(kNumSamples, input);
+  DirectConvolution(kernel, kNumTaps, input, kNumSamples, expected);
+
+  FftConvolver* convolver =
+      CHECK_NOTNULL(FftConvolverMake(kernel, kNumTaps, kBlockSize));
+
+  int n;
+  for (n = 0; n < kNumSamples; n += kBlockSize) {
+    FftConvolverProcessBlock(convolver, input + n, input + n);
+  }
+
+  for (n = 0; n < kNumSamples; ++n) {
+    CHECK(fabs(input[n] - expected[n]) <= 10 * kTol);
+  }
+
+  FftConvolverFree(convolver);
+}
+
+/* Checks that the impulse response is the kernel. */
+static void TestImpulseResponse(void) {
+  puts("TestImpulseResponse");
+  const int kNumTaps = 37;
+  const int kBlockSize = 8;
+  float kernel[37];
+  FillRandomValues(kNumTaps, kernel);
+
+  FftConvolver* convolver =
+      CHECK_NOTNULL(FftConvolverMake(kernel, kNumTaps, kBlockSize));
+
+  float block[8];
+  int n;
+  for (n = 0; n < 48; n += kBlockSize) {
+    memset(block, 0, sizeof(block));
+    if (n == 0) { block[0] = 1.0f; }
+    FftConvolverProcessBlock(convolver, block, block);
+
+    int i;
+    for (i = 0; i < kBlockSize; ++i) {
+      const float expected = (n + i < kNumTaps) ? kernel[n + i] : 0.0f;
+      CHECK(fabs(block[i] - expected) <= kTol);
+    }
+  }
+
+  FftConvolverFree(convolver);
+}
+
+/* Checks that Make fails gracefully for invalid arguments. */
+static void TestInvalidArgs(void) {
+  puts("TestInvalidArgs");
+  const float kernel[4] = {1.0f, 2.0f, 3.0f, 4.0f};
+  CHECK(FftConvolverMake(NULL, 4, 16) == NULL);
+  CHECK(FftConvolverMake(kernel, 0, 16) == NULL);
+  CHECK(FftConvolverMake(kernel, 4, 0) == NULL);
+  CHECK(FftConvolverMake(kernel, 4, 12) == NULL);
+  CHECK(FftConvolverMake(kernel, 4, kFftMaxTransformSize) == NULL);
+}
+
+int main(int argc, char** argv) {
+  srand(0);
+  TestMatchesDirectConvolution(1, 1);
+  TestMatchesDirectConvolution(5, 1);
+  TestMatchesDirectConvolution(1, 16);
+  TestMatchesDirectConvolution(10, 16);
+  TestMatchesDirectConvolution(16, 16);
+  TestMatchesDirectConvolution(17, 16);
+  TestMatchesDirectConvolution(100, 8);
+  TestMatchesDirectConvolution(100, 32);
+  TestMatchesDirectConvolution(171, 64);
+  TestMatchesDirectConvolution(1000, 128);
+  TestMatchesDirectConvolution(2048, 256);
+  TestMatchesDirectConvolution(4000, 2048);
+  TestInPlace();
+  TestImpulseResponse();
+  TestInvalidArgs();
+
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
@@ -81,8 +81,9 @@ static void TestScrambling(int transform_size) {
 
 /* Fill the Dirichlet kernel [http://en.wikipedia.org/wiki/Dirichlet_kernel]. */
 static void FillDirichletKernel(int radius, int size, ComplexFloat* output) {
-  const float numerator_factor = (2.0 * M_PI * (radius + 0.5)) / size;
-  const float denominator_factor = M_PI / size;
+  /* Compute in double, since for large sizes float arguments lose precision. */
+  const double numerator_factor = (2.0 * M_PI * (radius + 0.5)) / size;
+  const double denominator_factor = M_PI / size;
   int i;
   output[0].real = (2.0 * radius + 1.0) / size;
   output[0].imag = 0.0f;
@@ -228,6 +229,76 @@ static void TestRoundTrips(int transform_size) {
   free(data);
 }
 
+/* Fills random real values, packed two per ComplexFloat. */
+static void FillRandomRealValues(int size, float* output) {
+  int i;
+  for (i = 0; i < size; ++i) {
+    output[i] = rand() / (0.5f * RAND_MAX) - 1;
+  }
+}
+
+/* Checks FftForwardRealTransform against the complex FFT of the same signal. */
+static void TestForwardRealTransform(int transform_size) {
+  printf("TestForwardRealTransform(%d)\n", transform_size);
+  const int half_size = transform_size / 2;
+  float* samples = CHECK_NOTNULL(malloc(sizeof(float) * transform_size));
+  ComplexFloat* expected =
+      CHECK_NOTNULL(malloc(sizeof(ComplexFloat) * transform_size));
+  FillRandomRealValues(transform_size, samples);
+  int n;
+  for (n = 0; n < transform_size; ++n) {
+    expected[n] = ComplexFloatMake(samples[n], 0.0f);
+  }
+  FftForwardScrambledTransform(expected, transform_size);
+  FftUnscramble(expected, transform_size);
+
+  ComplexFloat* data = (ComplexFloat*)samples;
+  FftForwardRealTransform(data, transform_size);
+
+  /* Error grows like sqrt(N) for random input, so scale the tolerance. */
+  const float tol = kTol * sqrt(transform_size);
+  CHECK(fabs(data[0].real - expected[0].real) <= tol);
+  CHECK(fabs(data[0].imag - expected[half_size].real) <= tol);
+  CHECK(fabs(expected[0].imag) <= tol);
+  CHECK(fabs(expected[half_size].imag) <= tol);
+  int k;
+  for (k = 1; k < half_size; ++k) {
+    CHECK(fabs(data[k].real - expected[k].real) <= tol);
+    CHECK(fabs(data[k].imag - expected[k].imag) <= tol);
+  }
+
+  free(expected);
+  free(samples);
+}
+
+/* Check that FftForwardRealTransform followed by FftInverseRealTransform and
+ * normalization recovers the original.
+ */
+static void TestRealRoundTrips(int transform_size) {
+  printf("TestRealRoundTrips(%d)\n", transform_size);
+  const int kNumTrials = 5;
+  const int num_bytes = sizeof(float) * transform_size;
+  float* samples = CHECK_NOTNULL(malloc(num_bytes));
+  float* original = CHECK_NOTNULL(malloc(num_bytes));
+
+  int trial;
+  for (trial = 0; trial < kNumTrials; ++trial) {
+    FillRandomRealValues(transform_size, samples);
+    memcpy(original, samples, num_bytes);
+
+    FftForwardRealTransform((ComplexFloat*)samples, transform_size);
+    FftInverseRealTransform((ComplexFloat*)samples, transform_size);
+
+    int n;
+    for (n = 0; n < transform_size; ++n) {
+      CHECK(fabs(samples[n] / transform_size - original[n]) <= kTol);
+    }
+  }
+
+  free(original);
+  free(samples);
+}
+
 /* Checks that attempting an unsupport transform size has no effect. */
 static void TestUnsupportedSize(int transform_size) {
   printf("TestUnsupportedSize(%d)\n", transform_size);
@@ -252,6 +323,16 @@ static void TestUnsupportedSize(int transform_size) {
     CHECK(data[n].imag == original[n].imag);
   }
 
+  if (transform_size % 2 == 0) {
+    FftForwardRealTransform(data, 2 * transform_size);
+    FftInverseRealTransform(data, 2 * transform_size);
+
+    for (n = 0; n < transform_size; ++n) { /* data is unchanged. */
+      CHECK(data[n].real == original[n].real);
+      CHECK(data[n].imag == original[n].imag);
+    }
+  }
+
   free(original);
   free(data);
 }
@@ -262,17 +343,25 @@ int main(int argc, char** argv) {
   TestForwardTransformSize4();
 
   int transform_size;
-  for (transform_size = 4; transform_size <= 1024; transform_size *= 4) {
-    TestScrambling(transform_size);
-    TestForwardTransformOfDirichletKernel(transform_size);
-    TestInverseTransformOfDirichletKernel(transform_size);
-    TestFftBasedConvolution(transform_size);
+  for (transform_size = 2; transform_size <= kFftMaxTransformSize;
+       transform_size *= 2) {
+    if (transform_size >= 4) {
+      TestScrambling(transform_size);
+      TestForwardTransformOfDirichletKernel(transform_size);
+      TestInverseTransformOfDirichletKernel(transform_size);
+      TestForwardRealTransform(transform_size);
+      TestRealRoundTrips(transform_size);
+    }
+    if (transform_size <= 1024) { /* Direct convolution is O(N^2). */
+      TestFftBasedConvolution(transform_size);
+    }
     TestRoundTrips(transform_size);
   }
 
   TestUnsupportedSize(3);
   TestUnsupportedSize(25);
-  TestUnsupportedSize(32);
+  TestUnsupportedSize(96);
+  TestUnsupportedSize(2 * kFftMaxTransformSize);
 
   puts("PASS");
   return EXIT_SUCCESS;
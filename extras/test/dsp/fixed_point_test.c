@@ -0,0 +1,133 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "src/dsp/fixed_point.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+#include "src/dsp/logging.h"
+
+static double RandUniform(void) { return (double)rand() / RAND_MAX; }
+
+static void TestSaturate(void) {
+  puts("TestSaturate");
+  CHECK(FixedSaturateInt16(123) == 123);
+  CHECK(FixedSaturateInt16(-40000) == INT16_MIN);
+  CHECK(FixedSaturateInt16(40000) == INT16_MAX);
+  CHECK(FixedSaturateInt32(-123) == -123);
+  CHECK(FixedSaturateInt32(INT64_C(1) << 40) == INT32_MAX);
+  CHECK(FixedSaturateInt32(-(INT64_C(1) << 40)) == INT32_MIN);
+}
+
+static void TestFloatConversion(void) {
+  puts("TestFloatConversion");
+  CHECK(FixedFromFloat(0.5f, 15) == 16384);
+  CHECK(FixedFromFloat(-0.25f, 24) == -(1 << 22));
+  CHECK(FixedFromFloat(1e-6f, 15) == 0);
+  CHECK(FixedFromFloat(5.0f, 30) == INT32_MAX);
+  CHECK(FixedFromFloat(-5.0f, 30) == INT32_MIN);
+  CHECK(FixedToFloat(-16384, 15) == -0.5f);
+  CHECK(FixedToFloat(3 << 20, 24) == 0.1875f);
+}
+
+/* Compare FixedLog2() with log2() over a wide range. */
+static void TestLog2(void) {
+  puts("TestLog2");
+  CHECK(FixedLog2(0) == kFixedLog2OfZero);
+  CHECK(FixedLog2(1) == 0);
+  int k;
+  for (k = 0; k < 64; ++k) {
+    /* Exact for powers of two. */
+    CHECK(FixedLog2(UINT64_C(1) << k) == k << kFixedLog2FracBits);
+  }
+
+  double max_error = 0.0;
+  int trial;
+  for (trial = 0; trial < 10000; ++trial) {
+    const uint64_t x = (uint64_t)ldexp(1.0 + RandUniform(),
+                                       (int)(RandUniform() * 62.0));
+    const double expected = log(x) / log(2.0);
+    const double actual = ldexp(FixedLog2(x), -kFixedLog2FracBits);
+    const double error = fabs(actual - expected);
+    if (error > max_error) { max_error = error; }
+  }
+  CHECK(max_error <= 2e-4);
+}
+
+/* Compare FixedExp2() with exp2(). */
+static void TestExp2(void) {
+  puts("TestExp2");
+  CHECK(FixedExp2(0, 0) == 1);
+  CHECK(FixedExp2(0, 15) == 32768);
+  CHECK(FixedExp2(-(1 << kFixedLog2FracBits), 15) == 16384);
+  CHECK(FixedExp2(kFixedLog2OfZero, 30) == 0);
+  CHECK(FixedExp2(-40 << kFixedLog2FracBits, 30) == 0);
+  /* Saturates. */
+  CHECK(FixedExp2(64 << kFixedLog2FracBits, 0) == UINT64_MAX);
+  CHECK(FixedExp2(20 << kFixedLog2FracBits, 50) == UINT64_MAX);
+
+  double max_rel_error = 0.0;
+  int trial;
+  for (trial = 0; trial < 10000; ++trial) {
+    const double y = 40.0 * RandUniform() - 20.0;
+    const int32_t y_fixed = (int32_t)floor(ldexp(y, kFixedLog2FracBits) + 0.5);
+    const double expected = pow(2.0, ldexp(y_fixed, -kFixedLog2FracBits));
+    const double actual = ldexp((double)FixedExp2(y_fixed, 40), -40);
+    const double rel_error = fabs(actual - expected) / expected;
+    if (rel_error > max_rel_error) { max_rel_error = rel_error; }
+  }
+  CHECK(max_rel_error <= 1e-4);
+}
+
+/* Compute x^p with FixedLog2Scale(). */
+static void TestPow(void) {
+  puts("TestPow");
+  CHECK(FixedLog2Scale(3 << kFixedLog2FracBits, 1 << 15) ==
+        (3 << kFixedLog2FracBits) / 2);
+  CHECK(FixedLog2Scale(kFixedLog2OfZero, 2 << 16) == kFixedLog2OfZero);
+  CHECK(FixedLog2Scale(-kFixedLog2OfZero, 2 << 16) == -kFixedLog2OfZero);
+
+  static const float kExponents[4] = {-0.5f, 0.25f, 0.5f, 2.0f};
+  int i;
+  for (i = 0; i < 4; ++i) {
+    const float p = kExponents[i];
+    const int32_t p_q16 = FixedFromFloat(p, 16);
+    double max_rel_error = 0.0;
+    int trial;
+    for (trial = 0; trial < 1000; ++trial) {
+      const int32_t x = 1 + (int32_t)(RandUniform() * 1e6);  /* In Q20. */
+      const double expected = pow(ldexp(x, -20), p);
+      const double actual = ldexp((double)FixedExp2(
+          FixedLog2Scale(FixedLog2(x) - (20 << kFixedLog2FracBits), p_q16),
+          30), -30);
+      const double rel_error = fabs(actual - expected) / expected;
+      if (rel_error > max_rel_error) { max_rel_error = rel_error; }
+    }
+    CHECK(max_rel_error <= 5e-4);
+  }
+}
+
+int main(int argc, char** argv) {
+  srand(0);
+  TestSaturate();
+  TestFloatConversion();
+  TestLog2();
+  TestExp2();
+  TestPow();
+
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,311 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "src/dsp/multistage_resampler.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "src/dsp/logging.h"
+#include "src/dsp/math_constants.h"
+
+static double Decibels(double amplitude) { return 20.0 * log10(amplitude); }
+
+/* Resamples `num_input_frames` frames of `input` in one call. */
+static float* ResampleAll(MultistageResampler* resampler, const float* input,
+                          int num_input_frames, int* num_output_frames) {
+  const int num_channels = MultistageResamplerNumChannels(resampler);
+  *num_output_frames =
+      MultistageResamplerProcessSamples(resampler, input, num_input_frames);
+  CHECK(*num_output_frames <= MultistageResamplerMaxOutputFrames(resampler));
+  float* output = (float*)CHECK_NOTNULL(
+      malloc(sizeof(float) * num_channels * (*num_output_frames + 1)));
+  memcpy(output, MultistageResamplerOutput(resampler),
+         sizeof(float) * num_channels * *num_output_frames);
+  return output;
+}
+
+/* Resamples a sine tone of `frequency_hz` and returns the amplitude of the
+ * output at the same frequency, measured by a least squares fit over the
+ * second half of the output to skip the transient.
+ */
+static double ToneGain(float input_rate_hz, float output_rate_hz,
+                       double frequency_hz) {
+  const int kNumInputFrames = (int)(0.25f * input_rate_hz);
+  MultistageResampler* resampler = CHECK_NOTNULL(MultistageResamplerMake(
+      input_rate_hz, output_rate_hz, 1, kNumInputFrames, NULL));
+
+  float* input = (float*)CHECK_NOTNULL(malloc(sizeof(float) * kNumInputFrames));
+  int n;
+  for (n = 0; n < kNumInputFrames; ++n) {
+    input[n] = (float)sin(2.0 * M_PI * frequency_hz * n / input_rate_hz);
+  }
+
+  int num_output_frames;
+  float* output = ResampleAll(resampler, input, kNumInputFrames,
+                              &num_output_frames);
+  /* The output is delayed by less than FlushFrames() input frames. */
+  CHECK(fabs(num_output_frames * input_rate_hz / output_rate_hz -
+             kNumInputFrames) < MultistageResamplerFlushFrames(resampler));
+
+  /* Fit output[m] ~= a cos(w m + phi) + b sin(w m + phi). The phase offset
+   * doesn't matter for the amplitude sqrt(a^2 + b^2).
+   */
+  const double radians_per_sample = 2.0 * M_PI * frequency_hz / output_rate_hz;
+  double cc = 0.0;
+  double cs = 0.0;
+  double ss = 0.0;
+  double xc = 0.0;
+  double xs = 0.0;
+  int m;
+  for (m = num_output_frames / 2; m < num_output_frames; ++m) {
+    const double c = cos(radians_per_sample * m);
+    const double s = sin(radians_per_sample * m);
+    cc += c * c;
+    cs += c * s;
+    ss += s * s;
+    xc += output[m] * c;
+    xs += output[m] * s;
+  }
+  const double det = cc * ss - cs * cs;
+  const double a = (ss * xc - cs * xs) / det;
+  const double b = (cc * xs - cs * xc) / det;
+
+  free(output);
+  free(input);
+  MultistageResamplerFree(resampler);
+  return sqrt(a * a + b * b);
+}
+
+/* The planner uses halfband stages when they reduce the cost. */
+static void TestPlan(void) {
+  puts("TestPlan");
+  const float kInputRates[] = {48000.0f, 44100.0f};
+  int i;
+  for (i = 0; i < 2; ++i) {
+    MultistageResamplerPlan plan;
+    CHECK(MultistageResamplerPlanConversion(kInputRates[i], 16000.0f, NULL,
+                                            &plan));
+    CHECK(plan.num_halfband_stages >= 1);
+    CHECK(plan.cost < 0.75f * plan.single_stage_cost);
+    CHECK(plan.qresampler_output_rate_hz == 16000.0f);
+    CHECK(fabs(plan.qresampler_input_rate_hz -
+               kInputRates[i] / (1 << plan.num_halfband_stages)) < 1e-3f);
+  }
+
+  { /* With max_halfband_stages = 0, the plan is a single QResampler. */
+    MultistageResamplerOptions options = kMultistageResamplerDefaultOptions;
+    options.max_halfband_stages = 0;
+    MultistageResamplerPlan plan;
+    CHECK(MultistageResamplerPlanConversion(48000.0f, 16000.0f, &options,
+                                            &plan));
+    CHECK(plan.num_halfband_stages == 0);
+    CHECK(plan.cost == plan.single_stage_cost);
+  }
+
+  { /* Halfband stages aren't possible for a small factor. */
+    MultistageResamplerPlan plan;
+    CHECK(MultistageResamplerPlanConversion(16000.0f, 12000.0f, NULL, &plan));
+    CHECK(plan.num_halfband_stages == 0);
+  }
+
+  { /* Upsampling uses halfband interpolators after the QResampler. */
+    MultistageResamplerPlan plan;
+    CHECK(MultistageResamplerPlanConversion(16000.0f, 48000.0f, NULL, &plan));
+    CHECK(plan.num_halfband_stages >= 1);
+    CHECK(plan.qresampler_input_rate_hz == 16000.0f);
+    CHECK(plan.cost < plan.single_stage_cost);
+  }
+
+  { /* Invalid options. */
+    MultistageResamplerOptions options = kMultistageResamplerDefaultOptions;
+    MultistageResamplerPlan plan;
+    options.passband_proportion = 1.0f;
+    CHECK(!MultistageResamplerPlanConversion(48000.0f, 16000.0f, &options,
+                                             &plan));
+    options = kMultistageResamplerDefaultOptions;
+    options.max_halfband_stages = kMultistageResamplerMaxHalfbandStages + 1;
+    CHECK(!MultistageResamplerPlanConversion(48000.0f, 16000.0f, &options,
+                                             &plan));
+  }
+}
+
+/* Passband tones are preserved and tones above the output Nyquist frequency
+ * are attenuated.
+ */
+static void TestFrequencyResponse(float input_rate_hz, float output_rate_hz) {
+  printf("TestFrequencyResponse(%g, %g)\n", input_rate_hz, output_rate_hz);
+  const float min_rate_hz =
+      (input_rate_hz < output_rate_hz) ? input_rate_hz : output_rate_hz;
+  const float kPassbandFrequencies[] = {0.05f, 0.2f, 0.4f};
+  int i;
+  for (i = 0; i < 3; ++i) {
+    const double gain =
+        ToneGain(input_rate_hz, output_rate_hz,
+                 kPassbandFrequencies[i] * min_rate_hz);
+    CHECK(fabs(gain - 1.0) < 0.01);
+  }
+
+  if (input_rate_hz > output_rate_hz) {
+    /* Tones in the stopband, which would alias when downsampling. */
+    const float kStopbandFrequencies[] = {0.55f, 0.8f, 1.1f};
+    for (i = 0; i < 3; ++i) {
+      const double frequency_hz = kStopbandFrequencies[i] * min_rate_hz;
+      if (frequency_hz >= input_rate_hz / 2) { continue; }
+      const int kNumInputFrames = (int)(0.25f * input_rate_hz);
+      MultistageResampler* resampler = CHECK_NOTNULL(MultistageResamplerMake(
+          input_rate_hz, output_rate_hz, 1, kNumInputFrames, NULL));
+      float* input =
+          (float*)CHECK_NOTNULL(malloc(sizeof(float) * kNumInputFrames));
+      int n;
+      for (n = 0; n < kNumInputFrames; ++n) {
+        input[n] = (float)sin(2.0 * M_PI * frequency_hz * n / input_rate_hz);
+      }
+      int num_output_frames;
+      float* output = ResampleAll(resampler, input, kNumInputFrames,
+                                  &num_output_frames);
+      /* Bound the output peak, which includes energy at any frequency. */
+      double peak = 0.0;
+      int m;
+      for (m = num_output_frames / 2; m < num_output_frames; ++m) {
+        if (fabs(output[m]) > peak) { peak = fabs(output[m]); }
+      }
+      CHECK(Decibels(peak) < -55.0);
+      free(output);
+      free(input);
+      MultistageResamplerFree(resampler);
+    }
+  }
+}
+
+/* Streaming with random block sizes gives the same result as a single call. */
+static void TestStreaming(float input_rate_hz, float output_rate_hz,
+                          int num_channels) {
+  printf("TestStreaming(%g, %g, %d)\n", input_rate_hz, output_rate_hz,
+         num_channels);
+  const int kNumInputFrames = 2000;
+  float* input = (float*)CHECK_NOTNULL(
+      malloc(sizeof(float) * kNumInputFrames * num_channels));
+  int i;
+  for (i = 0; i < kNumInputFrames * num_channels; ++i) {
+    input[i] = (float)rand() / RAND_MAX - 0.5f;
+  }
+
+  MultistageResampler* resampler = CHECK_NOTNULL(MultistageResamplerMake(
+      input_rate_hz, output_rate_hz, num_channels, kNumInputFrames, NULL));
+  CHECK(MultistageResamplerNumChannels(resampler) == num_channels);
+  CHECK(MultistageResamplerMaxInputFrames(resampler) == kNumInputFrames);
+  int expected_frames;
+  float* expected = ResampleAll(resampler, input, kNumInputFrames,
+                                &expected_frames);
+
+  const int kMaxBlockSize = 50;
+  MultistageResampler* streaming = CHECK_NOTNULL(MultistageResamplerMake(
+      input_rate_hz, output_rate_hz, num_channels, kMaxBlockSize, NULL));
+  int start = 0;
+  int output_frames = 0;
+  while (start < kNumInputFrames) {
+    int block_size = rand() % (kMaxBlockSize + 1);
+    if (block_size > kNumInputFrames - start) {
+      block_size = kNumInputFrames - start;
+    }
+    const int num_output = MultistageResamplerProcessSamples(
+        streaming, input + start * num_channels, block_size);
+    CHECK(num_output <= MultistageResamplerMaxOutputFrames(streaming));
+    CHECK(output_frames + num_output <= expected_frames);
+    const float* output = MultistageResamplerOutput(streaming);
+    for (i = 0; i < num_output * num_channels; ++i) {
+      CHECK(fabs(output[i] - expected[output_frames * num_channels + i]) <
+            1e-6f);
+    }
+    output_frames += num_output;
+    start += block_size;
+  }
+  CHECK(output_frames == expected_frames);
+
+  /* After Reset, processing is the same as for a new resampler. */
+  MultistageResamplerReset(resampler);
+  int reset_frames;
+  float* reset_output = ResampleAll(resampler, input, kNumInputFrames,
+                                    &reset_frames);
+  CHECK(reset_frames == expected_frames);
+  CHECK(memcmp(reset_output, expected,
+               sizeof(float) * expected_frames * num_channels) == 0);
+
+  free(reset_output);
+  free(expected);
+  free(input);
+  MultistageResamplerFree(streaming);
+  MultistageResamplerFree(resampler);
+}
+
+/* Passing FlushFrames() zeros flushes the resampler, after which further zero
+ * input produces zero output.
+ */
+static void TestFlush(float input_rate_hz, float output_rate_hz) {
+  printf("TestFlush(%g, %g)\n", input_rate_hz, output_rate_hz);
+  const int kMaxInputFrames = 64;
+  MultistageResampler* resampler = CHECK_NOTNULL(MultistageResamplerMake(
+      input_rate_hz, output_rate_hz, 1, kMaxInputFrames, NULL));
+  float input[64];
+  int i;
+  for (i = 0; i < kMaxInputFrames; ++i) {
+    input[i] = (float)rand() / RAND_MAX - 0.5f;
+  }
+  MultistageResamplerProcessSamples(resampler, input, kMaxInputFrames);
+
+  memset(input, 0, sizeof(input));
+  int flush_frames = MultistageResamplerFlushFrames(resampler);
+  while (flush_frames > 0) {
+    const int block_size =
+        (flush_frames < kMaxInputFrames) ? flush_frames : kMaxInputFrames;
+    MultistageResamplerProcessSamples(resampler, input, block_size);
+    flush_frames -= block_size;
+  }
+
+  for (i = 0; i < 4; ++i) {
+    const int num_output = MultistageResamplerProcessSamples(
+        resampler, input, kMaxInputFrames);
+    const float* output = MultistageResamplerOutput(resampler);
+    int m;
+    for (m = 0; m < num_output; ++m) {
+      CHECK(output[m] == 0.0f);
+    }
+  }
+  MultistageResamplerFree(resampler);
+}
+
+int main(int argc, char** argv) {
+  srand(0);
+  TestPlan();
+  TestFrequencyResponse(48000.0f, 16000.0f);
+  TestFrequencyResponse(44100.0f, 16000.0f);
+  TestFrequencyResponse(96000.0f, 16000.0f);
+  TestFrequencyResponse(16000.0f, 48000.0f);
+
+  int num_channels;
+  for (num_channels = 1; num_channels <= 3; ++num_channels) {
+    TestStreaming(48000.0f, 16000.0f, num_channels);
+    TestStreaming(44100.0f, 16000.0f, num_channels);
+    TestStreaming(16000.0f, 48000.0f, num_channels);
+  }
+  TestFlush(48000.0f, 16000.0f);
+  TestFlush(96000.0f, 16000.0f);
+  TestFlush(16000.0f, 48000.0f);
+
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,122 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "src/dsp/oscillator_bank.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "src/dsp/logging.h"
+
+#define kNumFrames 100
+
+static float RandUniform(float min_value, float max_value) {
+  return min_value + (max_value - min_value) * ((float)rand() / RAND_MAX);
+}
+
+/* OscillatorBankSynthesize() matches scalar Oscillator and Phase32Sin() code
+ * exactly, for any number of oscillators including partial groups of 4.
+ */
+static void TestMatchesScalar(int num_oscillators, int use_fade) {
+  printf("TestMatchesScalar(%d, %d)\n", num_oscillators, use_fade);
+  OscillatorBank bank;
+  CHECK(OscillatorBankInit(&bank, num_oscillators));
+
+  Oscillator expected_oscillators[kOscillatorBankMaxOscillators];
+  int k;
+  for (k = 0; k < num_oscillators; ++k) {
+    const float frequency = RandUniform(0.0f, 0.4f);
+    OscillatorInit(&expected_oscillators[k], frequency);
+    expected_oscillators[k].phase = (Phase32)rand();
+    bank.phase[k] = (int32_t)expected_oscillators[k].phase;
+    OscillatorBankSetFrequency(&bank, k, frequency);
+    CHECK(bank.frequency[k] == (int32_t)expected_oscillators[k].frequency);
+    /* Ramp every other oscillator. */
+    bank.frequency_ramp[k] = (k % 2) ? RandUniform(0.999f, 1.001f) : 1.0f;
+    bank.gain[k] = RandUniform(0.0f, 1.0f);
+    bank.gain_fade_delta[k] = RandUniform(-1.0f, 1.0f);
+  }
+  float fade_weights[kNumFrames];
+  int i;
+  for (i = 0; i < kNumFrames; ++i) {
+    fade_weights[i] = RandUniform(0.0f, 1.0f);
+  }
+
+  /* Sentinel after the output to check for overruns. */
+  float output[kNumFrames * kOscillatorBankMaxOscillators + 1];
+  output[kNumFrames * num_oscillators] = 123.0f;
+  OscillatorBankSynthesize(&bank, use_fade ? fade_weights : NULL, kNumFrames,
+                           output);
+  CHECK(output[kNumFrames * num_oscillators] == 123.0f);
+
+  for (i = 0; i < kNumFrames; ++i) {
+    for (k = 0; k < num_oscillators; ++k) {
+      Oscillator* oscillator = &expected_oscillators[k];
+      OscillatorNext(oscillator);
+      const float weight = use_fade ? fade_weights[i] : 0.0f;
+      const float expected = Phase32Sin(oscillator->phase) *
+          (bank.gain[k] + bank.gain_fade_delta[k] * weight);
+      if (bank.frequency_ramp[k] != 1.0f) {
+        oscillator->frequency *= bank.frequency_ramp[k];
+      }
+      CHECK(output[i * num_oscillators + k] == expected);
+    }
+  }
+
+  for (k = 0; k < num_oscillators; ++k) {
+    CHECK(bank.phase[k] == (int32_t)expected_oscillators[k].phase);
+    CHECK(bank.frequency[k] == (int32_t)expected_oscillators[k].frequency);
+  }
+}
+
+/* A frequency above 2^24 in Phase32 units is unchanged without a ramp. */
+static void TestLargeFrequencyWithoutRamp(void) {
+  puts("TestLargeFrequencyWithoutRamp");
+  OscillatorBank bank;
+  CHECK(OscillatorBankInit(&bank, 2));
+  bank.frequency[0] = 123456789;
+  bank.frequency[1] = 1000;
+  bank.frequency_ramp[1] = 2.0f;
+  float output[2 * 3];
+  OscillatorBankSynthesize(&bank, NULL, 3, output);
+  CHECK(bank.frequency[0] == 123456789);
+  CHECK(bank.frequency[1] == 8000);
+  CHECK(bank.phase[0] == 3 * 123456789);
+  CHECK(bank.phase[1] == 1000 + 2000 + 4000);
+}
+
+static void TestInitRange(void) {
+  puts("TestInitRange");
+  OscillatorBank bank;
+  CHECK(OscillatorBankInit(&bank, 0));
+  CHECK(OscillatorBankInit(&bank, kOscillatorBankMaxOscillators));
+  CHECK(!OscillatorBankInit(&bank, -1));
+  CHECK(!OscillatorBankInit(&bank, kOscillatorBankMaxOscillators + 1));
+}
+
+int main(int argc, char** argv) {
+  srand(0);
+  int num_oscillators;
+  for (num_oscillators = 1; num_oscillators <= kOscillatorBankMaxOscillators;
+       ++num_oscillators) {
+    TestMatchesScalar(num_oscillators, 0);
+    TestMatchesScalar(num_oscillators, 1);
+  }
+  TestLargeFrequencyWithoutRamp();
+  TestInitRange();
+
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,101 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "src/dsp/phase32_simd.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "src/dsp/logging.h"
+
+static uint32_t RandPhase32(void) {
+  return ((uint32_t)rand() << 16) ^ (uint32_t)rand();
+}
+
+/* Phase32Sin4() and Phase32Cos4() match the scalar functions exactly. */
+static void TestSinCosMatchScalar(void) {
+  puts("TestSinCosMatchScalar");
+  srand(0);
+  int trial;
+  for (trial = 0; trial < 1000; ++trial) {
+    Phase32 phases[4];
+    int i;
+    for (i = 0; i < 4; ++i) {
+      phases[i] = RandPhase32();
+    }
+    if (trial == 0) {  /* Check some edge cases. */
+      phases[0] = 0;
+      phases[1] = UINT32_C(0xffffffff);
+      phases[2] = UINT32_C(0x80000000);
+      phases[3] = UINT32_C(0x7fffffff);
+    }
+
+    const Int4 phase4 = Int4Load((const int32_t*)phases);
+    float sin_values[4];
+    float cos_values[4];
+    Float4Store(sin_values, Phase32Sin4(phase4));
+    Float4Store(cos_values, Phase32Cos4(phase4));
+    for (i = 0; i < 4; ++i) {
+      CHECK(sin_values[i] == Phase32Sin(phases[i]));
+      CHECK(cos_values[i] == Phase32Cos(phases[i]));
+    }
+  }
+}
+
+/* Phase32FromFloat4() is close to Phase32FromFloat(). */
+static void TestPhase32FromFloat4(void) {
+  puts("TestPhase32FromFloat4");
+  srand(0);
+  int trial;
+  for (trial = 0; trial < 1000; ++trial) {
+    float values[4];
+    int i;
+    for (i = 0; i < 4; ++i) {
+      values[i] = 4.0f * ((float)rand() / RAND_MAX - 0.5f);
+    }
+    if (trial == 0) {  /* Check some edge cases. */
+      values[0] = 0.0f;
+      values[1] = -0.25f;
+      values[2] = 1.0f;
+      values[3] = 1e9f;
+    } else if (trial == 1) {  /* Small values, as for oscillator frequencies. */
+      values[0] = 1e-6f;
+      values[1] = -1e-6f;
+      values[2] = 3e-3f;
+      values[3] = -0.4999f;
+    }
+
+    Phase32 phases[4];
+    Int4Store((int32_t*)phases, Phase32FromFloat4(Float4Load(values)));
+    for (i = 0; i < 4; ++i) {
+      const int32_t difference = (int32_t)(phases[i] -
+                                           Phase32FromFloat(values[i]));
+      /* Phase32FromFloat() rounds, since 1 + value for negative value is
+       * rounded in float, so allow for that.
+       */
+      const int32_t tolerance = (values[i] < 0.0f) ? 256 : 4;
+      CHECK(-tolerance <= difference && difference <= tolerance);
+    }
+  }
+}
+
+int main(int argc, char** argv) {
+  printf("Float4 implementation: %s\n", kFloat4Implementation);
+  TestSinCosMatchScalar();
+  TestPhase32FromFloat4();
+
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,221 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "src/dsp/polyphase_interpolator_fixed.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+#include "src/dsp/logging.h"
+#include "src/dsp/math_constants.h"
+
+/* Midpoint of PWM values with kTopValue = 512. */
+static const uint16_t kOffset = 256;
+#define kNumFrames 1000
+#define kMaxFactor kPolyphaseInterpolatorFixedMaxFactor
+
+/* Computes the amplitude of `x` at `frequency` in cycles per sample. */
+static double ToneAmplitude(const double* x, int num_samples,
+                            double frequency) {
+  double real = 0.0;
+  double imag = 0.0;
+  int n;
+  for (n = 0; n < num_samples; ++n) {
+    real += x[n] * cos(2.0 * M_PI * frequency * n);
+    imag -= x[n] * sin(2.0 * M_PI * frequency * n);
+  }
+  return 2.0 * sqrt(real * real + imag * imag) / num_samples;
+}
+
+/* Constant input passes unchanged, for any factor. */
+static void TestConstant(int factor) {
+  printf("TestConstant(%d)\n", factor);
+  PolyphaseInterpolatorFixed interpolator;
+  CHECK(PolyphaseInterpolatorFixedInit(&interpolator, factor, 1));
+  uint16_t input[64];
+  uint16_t output[64 * kMaxFactor];
+  int i;
+  for (i = 0; i < 64; ++i) {
+    input[i] = 400;
+  }
+  PolyphaseInterpolatorFixedProcessChannel(
+      &interpolator, 0, input, 1, 64, kOffset, output, 1);
+  /* After the filter history fills, output equals the input. */
+  for (i = kPolyphaseInterpolatorFixedTaps * factor; i < 64 * factor; ++i) {
+    CHECK(output[i] == 400);
+  }
+}
+
+/* A low frequency tone is interpolated smoothly, with the image near the input
+ * sample rate much weaker than with sample repetition.
+ */
+static void TestTone(double frequency) {
+  printf("TestTone(%g)\n", frequency);
+  const int kFactor = 8;
+  const int kSkip = 8;
+  PolyphaseInterpolatorFixed interpolator;
+  CHECK(PolyphaseInterpolatorFixedInit(&interpolator, kFactor, 1));
+  uint16_t* input = (uint16_t*)CHECK_NOTNULL(
+      malloc(kNumFrames * sizeof(uint16_t)));
+  uint16_t* output = (uint16_t*)CHECK_NOTNULL(
+      malloc(kNumFrames * kFactor * sizeof(uint16_t)));
+  double* interpolated = (double*)CHECK_NOTNULL(
+      malloc(kNumFrames * kFactor * sizeof(double)));
+  double* held = (double*)CHECK_NOTNULL(
+      malloc(kNumFrames * kFactor * sizeof(double)));
+  int i;
+  for (i = 0; i < kNumFrames; ++i) {
+    input[i] = (uint16_t)floor(
+        kOffset + 200.0 * sin(2.0 * M_PI * frequency * i) + 0.5);
+  }
+  /* Process in blocks of 8 frames, as for the PWM. */
+  for (i = 0; i < kNumFrames; i += 8) {
+    PolyphaseInterpolatorFixedProcessChannel(
+        &interpolator, 0, input + i, 1, 8, kOffset, output + i * kFactor, 1);
+  }
+
+  double max_error = 0.0;
+  for (i = 0; i < kNumFrames * kFactor; ++i) {
+    interpolated[i] = output[i] - (double)kOffset;
+    held[i] = input[i / kFactor] - (double)kOffset;
+    if (i >= kSkip * kFactor) {
+      /* Compare with the continuous tone, delayed by Taps / 2 input samples.
+       * The error includes the gain droop and rounding.
+       */
+      const double t = (double)i / kFactor -
+          kPolyphaseInterpolatorFixedTaps / 2;
+      const double error =
+          fabs(interpolated[i] - 200.0 * sin(2.0 * M_PI * frequency * t));
+      if (error > max_error) { max_error = error; }
+    }
+  }
+  CHECK(max_error < 200.0 * 0.05 + 1.0);
+
+  const int num_samples = (kNumFrames - kSkip) * kFactor;
+  const double* y = interpolated + kSkip * kFactor;
+  const double* h = held + kSkip * kFactor;
+  const double signal = ToneAmplitude(y, num_samples, frequency / kFactor);
+  const double image =
+      ToneAmplitude(y, num_samples, (1.0 - frequency) / kFactor);
+  const double held_signal =
+      ToneAmplitude(h, num_samples, frequency / kFactor);
+  const double held_image =
+      ToneAmplitude(h, num_samples, (1.0 - frequency) / kFactor);
+  CHECK(fabs(signal / 200.0 - 1.0) < 0.05);
+  /* Images are at least 40 dB below the signal, and at least 20 dB weaker than
+   * with sample repetition.
+   */
+  CHECK(image < 0.01 * signal);
+  CHECK(image / signal < 0.1 * held_image / held_signal);
+
+  free(held);
+  free(interpolated);
+  free(output);
+  free(input);
+}
+
+/* Channels have independent history, and strides address interleaved data. */
+static void TestInterleavedChannels(void) {
+  puts("TestInterleavedChannels");
+  const int kFactor = 4;
+  const int kNumChannels = 3;
+  PolyphaseInterpolatorFixed interpolator;
+  CHECK(PolyphaseInterpolatorFixedInit(&interpolator, kFactor, kNumChannels));
+  PolyphaseInterpolatorFixed mono;
+  CHECK(PolyphaseInterpolatorFixedInit(&mono, kFactor, 1));
+  uint16_t input[16 * 3];
+  uint16_t output[16 * 4 * 3];
+  uint16_t mono_input[16];
+  uint16_t mono_output[16 * 4];
+  int i;
+  int c;
+  for (i = 0; i < 16 * kNumChannels; ++i) {
+    input[i] = (uint16_t)(rand() % 513);
+  }
+
+  for (c = 0; c < kNumChannels; ++c) {
+    /* Process each channel in two calls, to check history continuity. */
+    PolyphaseInterpolatorFixedProcessChannel(
+        &interpolator, c, input + c, kNumChannels, 5, kOffset,
+        output + c, kNumChannels);
+    PolyphaseInterpolatorFixedProcessChannel(
+        &interpolator, c, input + 5 * kNumChannels + c, kNumChannels, 11,
+        kOffset, output + 5 * kFactor * kNumChannels + c, kNumChannels);
+  }
+
+  for (c = 0; c < kNumChannels; ++c) {
+    for (i = 0; i < 16; ++i) {
+      mono_input[i] = input[i * kNumChannels + c];
+    }
+    PolyphaseInterpolatorFixedReset(&mono);
+    PolyphaseInterpolatorFixedProcessChannel(
+        &mono, 0, mono_input, 1, 16, kOffset, mono_output, 1);
+    for (i = 0; i < 16 * kFactor; ++i) {
+      CHECK(output[i * kNumChannels + c] == mono_output[i]);
+    }
+  }
+}
+
+/* Full-scale steps saturate to [0, 2 * offset] rather than wrapping. */
+static void TestSaturation(void) {
+  puts("TestSaturation");
+  const int kFactor = 8;
+  PolyphaseInterpolatorFixed interpolator;
+  CHECK(PolyphaseInterpolatorFixedInit(&interpolator, kFactor, 1));
+  uint16_t input[64];
+  uint16_t output[64 * 8];
+  int i;
+  for (i = 0; i < 64; ++i) {
+    input[i] = ((i / 3) % 2) ? 2 * kOffset : 0;
+  }
+  PolyphaseInterpolatorFixedProcessChannel(
+      &interpolator, 0, input, 1, 64, kOffset, output, 1);
+  int saw_min = 0;
+  int saw_max = 0;
+  for (i = 0; i < 64 * kFactor; ++i) {
+    CHECK(output[i] <= 2 * kOffset);
+    saw_min |= (output[i] == 0);
+    saw_max |= (output[i] == 2 * kOffset);
+  }
+  CHECK(saw_min && saw_max);
+}
+
+static void TestInvalidArgs(void) {
+  puts("TestInvalidArgs");
+  PolyphaseInterpolatorFixed interpolator;
+  CHECK(!PolyphaseInterpolatorFixedInit(&interpolator, 0, 1));
+  CHECK(!PolyphaseInterpolatorFixedInit(&interpolator, kMaxFactor + 1, 1));
+  CHECK(!PolyphaseInterpolatorFixedInit(&interpolator, 8, 0));
+  CHECK(!PolyphaseInterpolatorFixedInit(
+      &interpolator, 8, kPolyphaseInterpolatorFixedMaxChannels + 1));
+}
+
+int main(int argc, char** argv) {
+  srand(0);
+  TestConstant(1);
+  TestConstant(2);
+  TestConstant(8);
+  TestConstant(kMaxFactor);
+  TestTone(0.02);
+  TestTone(0.05);
+  TestTone(0.1);
+  TestTone(0.15);
+  TestInterleavedChannels();
+  TestSaturation();
+  TestInvalidArgs();
+
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
@@ -18,6 +18,7 @@
 #include <math.h>
 #include <string.h>
 
+#include "src/dsp/arena.h"
 #include "src/dsp/logging.h"
 #include "src/dsp/math_constants.h"
 #include "src/dsp/phasor_rotator.h"
@@ -244,6 +245,96 @@ static void TestStreamingRandomBlockSizes(int num_channels) {
   free(input);
 }
 
+/* Fill fixed-size output blocks, resampling directly into them with
+ * QResamplerMaxInputFramesForOutput() and QResamplerProcessSamplesToBuffer().
+ * When upsampling, a block may overflow by a few frames, which are carried
+ * over to the next block.
+ */
+static void TestFillFixedOutputBlocks(int num_channels) {
+  printf("TestFillFixedOutputBlocks(%d)\n", num_channels);
+  const int kTotalInputFrames = 500;
+  const int kOutputBlockFrames = 37;
+
+  float* input = (float*)CHECK_NOTNULL(
+      malloc(sizeof(float) * kTotalInputFrames * num_channels));
+  int n;
+  for (n = 0; n < kTotalInputFrames * num_channels; ++n) {
+    input[n] = -0.5f + ((float)rand()) / RAND_MAX;
+  }
+
+  int i;
+  for (i = 0; i < kNumRates; ++i) {
+    int j;
+    for (j = 0; j < kNumRates; ++j) {
+      QResampler* resampler = CHECK_NOTNULL(
+          QResamplerMake(kRates[i], kRates[j], num_channels,
+                         kTotalInputFrames, NULL));
+      const int total_output_frames =
+          QResamplerProcessSamples(resampler, input, kTotalInputFrames);
+      const float* nonstreaming = QResamplerOutput(resampler);
+
+      QResampler* block_resampler = CHECK_NOTNULL(
+          QResamplerMake(kRates[i], kRates[j], num_channels,
+                         kTotalInputFrames, NULL));
+      int factor_numerator;
+      int factor_denominator;
+      QResamplerGetRationalFactor(block_resampler, &factor_numerator,
+                                  &factor_denominator);
+      /* Max number of output frames produced by one input frame. */
+      const int max_overflow =
+          (factor_denominator + factor_numerator - 1) / factor_numerator;
+      float* block = (float*)CHECK_NOTNULL(malloc(
+          sizeof(float) * (kOutputBlockFrames + max_overflow) * num_channels));
+      int fill = 0;
+      int num_blocks = 0;
+      for (n = 0; n < kTotalInputFrames;) {
+        const int remaining = kOutputBlockFrames - fill;
+        int num_input_frames =
+            QResamplerMaxInputFramesForOutput(block_resampler, remaining);
+        CHECK(num_input_frames >= (factor_numerator >= factor_denominator));
+        /* One more input frame would overflow the block. */
+        CHECK(QResamplerNextNumOutputFrames(
+                  block_resampler, num_input_frames) <= remaining);
+        CHECK(QResamplerNextNumOutputFrames(
+                  block_resampler, num_input_frames + 1) > remaining);
+        if (num_input_frames == 0) {
+          num_input_frames = 1;  /* Overflow the block. */
+        }
+        if (num_input_frames > kTotalInputFrames - n) {
+          num_input_frames = kTotalInputFrames - n;
+        }
+
+        fill += QResamplerProcessSamplesToBuffer(
+            block_resampler, input + n * num_channels, num_input_frames,
+            block + fill * num_channels);
+        n += num_input_frames;
+
+        CHECK(fill < kOutputBlockFrames + max_overflow);
+        if (fill >= kOutputBlockFrames) {
+          /* The block matches the corresponding nonstreaming output. */
+          const float* expected =
+              nonstreaming + num_blocks * kOutputBlockFrames * num_channels;
+          int m;
+          for (m = 0; m < kOutputBlockFrames * num_channels; ++m) {
+            CHECK(fabs(block[m] - expected[m]) < 1e-6f);
+          }
+          ++num_blocks;
+          fill -= kOutputBlockFrames;
+          memmove(block, block + kOutputBlockFrames * num_channels,
+                  sizeof(float) * fill * num_channels);
+        }
+      }
+      CHECK(num_blocks * kOutputBlockFrames + fill == total_output_frames);
+
+      free(block);
+      QResamplerFree(block_resampler);
+      QResamplerFree(resampler);
+    }
+  }
+
+  free(input);
+}
+
 /* Resampling a sine wave should produce again a sine wave. */
 static void TestResampleSineWave(void) {
   puts("TestResampleSineWave");
@@ -442,6 +533,375 @@ static void TestInputSizeExceedsMax(int num_channels) {
   free(input);
 }
 
+/* QResamplerInitInBuffer() gives the same output as QResamplerMake(). */
+static void TestInitInBuffer(int num_channels) {
+  printf("TestInitInBuffer(%d)\n", num_channels);
+  const int kInputFrames = 100;
+  const float kInputSampleRateHz = 44100.0f;
+  const float kOutputSampleRateHz = 16000.0f;
+  float* input =
+      CHECK_NOTNULL(malloc(sizeof(float) * kInputFrames * num_channels));
+  int n;
+  for (n = 0; n < kInputFrames * num_channels; ++n) {
+    input[n] = -0.5f + ((float)rand()) / RAND_MAX;
+  }
+
+  CHECK(QResamplerRequiredBytes(kInputSampleRateHz, kOutputSampleRateHz,
+                                0, kInputFrames, NULL) == 0);
+  const size_t required_bytes = QResamplerRequiredBytes(
+      kInputSampleRateHz, kOutputSampleRateHz, num_channels, kInputFrames,
+      NULL);
+  CHECK(required_bytes > 0);
+  /* Use an offset to test an unaligned buffer. */
+  char* storage = (char*)CHECK_NOTNULL(malloc(required_bytes + 3));
+  char* buffer = storage + 3;
+  /* Too small buffer fails. */
+  CHECK(QResamplerInitInBuffer(buffer, required_bytes / 2, kInputSampleRateHz,
+                               kOutputSampleRateHz, num_channels, kInputFrames,
+                               NULL) == NULL);
+
+  QResampler* expected = CHECK_NOTNULL(
+      QResamplerMake(kInputSampleRateHz, kOutputSampleRateHz, num_channels,
+                     kInputFrames, NULL));
+  QResampler* actual = CHECK_NOTNULL(
+      QResamplerInitInBuffer(buffer, required_bytes, kInputSampleRateHz,
+                             kOutputSampleRateHz, num_channels, kInputFrames,
+                             NULL));
+  CHECK((char*)actual >= buffer && (char*)actual < buffer + required_bytes);
+
+  const int num_output_frames =
+      QResamplerProcessSamples(expected, input, kInputFrames);
+  CHECK(QResamplerProcessSamples(actual, input, kInputFrames) ==
+        num_output_frames);
+  const float* output_expected = QResamplerOutput(expected);
+  const float* output_actual = QResamplerOutput(actual);
+  CHECK((const char*)output_actual >= buffer &&
+        (const char*)(output_actual + num_output_frames * num_channels) <=
+        buffer + required_bytes);
+  for (n = 0; n < num_output_frames * num_channels; ++n) {
+    CHECK(output_actual[n] == output_expected[n]);
+  }
+
+  QResamplerFree(actual);  /* Doesn't free the caller's buffer. */
+  QResamplerFree(expected);
+  free(storage);
+  free(input);
+}
+
+/* Resampling with an interpolated kernel table is close to the exact filters
+ * and uses less memory.
+ */
+static void TestKernelTablePhases(int num_channels) {
+  printf("TestKernelTablePhases(%d)\n", num_channels);
+  const int kInputFrames = 500;
+  /* An arbitrary factor, as for clock drift correction, with a large
+   * denominator.
+   */
+  const float kInputSampleRateHz = 16000.0f;
+  const float kOutputSampleRateHz = 15990.0f;
+  float* input =
+      CHECK_NOTNULL(malloc(sizeof(float) * kInputFrames * num_channels));
+  int n;
+  for (n = 0; n < kInputFrames * num_channels; ++n) {
+    input[n] = -0.5f + ((float)rand()) / RAND_MAX;
+  }
+
+  QResampler* expected = CHECK_NOTNULL(
+      QResamplerMake(kInputSampleRateHz, kOutputSampleRateHz, num_channels,
+                     kInputFrames, NULL));
+  int factor_numerator;
+  int factor_denominator;
+  QResamplerGetRationalFactor(expected, &factor_numerator, &factor_denominator);
+  CHECK(factor_denominator == 1000);
+  const int num_output_frames =
+      QResamplerProcessSamples(expected, input, kInputFrames);
+
+  const int kTablePhases[2] = {32, 128};
+  const float kTolerance[2] = {1e-3f, 5e-4f};
+  int i;
+  for (i = 0; i < 2; ++i) {
+    QResamplerOptions options = kQResamplerDefaultOptions;
+    options.kernel_table_phases = kTablePhases[i];
+    CHECK(QResamplerRequiredBytes(kInputSampleRateHz, kOutputSampleRateHz,
+                                  num_channels, kInputFrames, &options) <
+          QResamplerRequiredBytes(kInputSampleRateHz, kOutputSampleRateHz,
+                                  num_channels, kInputFrames, NULL) / 2);
+
+    QResampler* actual = CHECK_NOTNULL(
+        QResamplerMake(kInputSampleRateHz, kOutputSampleRateHz, num_channels,
+                       kInputFrames, &options));
+    int actual_numerator;
+    int actual_denominator;
+    QResamplerGetRationalFactor(actual, &actual_numerator, &actual_denominator);
+    CHECK(actual_numerator == factor_numerator);
+    CHECK(actual_denominator == factor_denominator);
+    CHECK(QResamplerProcessSamples(actual, input, kInputFrames) ==
+          num_output_frames);
+
+    float max_error = 0.0f;
+    for (n = 0; n < num_output_frames * num_channels; ++n) {
+      const float error = fabs(QResamplerOutput(actual)[n] -
+                               QResamplerOutput(expected)[n]);
+      if (error > max_error) { max_error = error; }
+    }
+    CHECK(max_error <= kTolerance[i]);
+    QResamplerFree(actual);
+  }
+
+  /* If the denominator is small enough, the filters are exact. */
+  QResamplerOptions options = kQResamplerDefaultOptions;
+  options.kernel_table_phases = factor_denominator;
+  QResampler* actual = CHECK_NOTNULL(
+      QResamplerMake(kInputSampleRateHz, kOutputSampleRateHz, num_channels,
+                     kInputFrames, &options));
+  CHECK(QResamplerProcessSamples(actual, input, kInputFrames) ==
+        num_output_frames);
+  for (n = 0; n < num_output_frames * num_channels; ++n) {
+    CHECK(QResamplerOutput(actual)[n] == QResamplerOutput(expected)[n]);
+  }
+
+  QResamplerFree(actual);
+  QResamplerFree(expected);
+  free(input);
+}
+
+/* Resamplers with the same rates and options share cached filters. */
+static void TestSharedFilters(void) {
+  puts("TestSharedFilters");
+  const int kInputFrames = 100;
+  QResamplerFilterCache* cache = CHECK_NOTNULL(QResamplerFilterCacheMake());
+  CHECK(QResamplerFilterCacheSize(cache) == 0);
+  QResamplerOptions options = kQResamplerDefaultOptions;
+  options.filter_cache = cache;
+
+  /* Resamplers differing only in num_channels and max_input_frames share. */
+  QResampler* a = CHECK_NOTNULL(
+      QResamplerMake(48000.0f, 16000.0f, 1, kInputFrames, &options));
+  QResampler* b = CHECK_NOTNULL(
+      QResamplerMake(48000.0f, 16000.0f, 3, 2 * kInputFrames, &options));
+  CHECK(QResamplerFilterCacheSize(cache) == 1);
+  /* A different factor or kernel option gets a separate entry. */
+  QResampler* c = CHECK_NOTNULL(
+      QResamplerMake(44100.0f, 16000.0f, 1, kInputFrames, &options));
+  options.kaiser_beta = 7.865f;
+  QResampler* d = CHECK_NOTNULL(
+      QResamplerMake(48000.0f, 16000.0f, 1, kInputFrames, &options));
+  CHECK(QResamplerFilterCacheSize(cache) == 3);
+
+  /* Output of a resampler with shared filters matches one with its own. */
+  const size_t required_bytes = QResamplerRequiredBytes(
+      48000.0f, 16000.0f, 1, kInputFrames, NULL);
+  void* buffer = CHECK_NOTNULL(malloc(required_bytes));
+  QResampler* expected = CHECK_NOTNULL(QResamplerInitInBuffer(
+      buffer, required_bytes, 48000.0f, 16000.0f, 1, kInputFrames, NULL));
+  CHECK(QResamplerFilterCacheSize(cache) == 3);
+  float input[100];
+  int n;
+  for (n = 0; n < kInputFrames; ++n) {
+    input[n] = -0.5f + ((float)rand()) / RAND_MAX;
+  }
+  const int num_output_frames =
+      QResamplerProcessSamples(expected, input, kInputFrames);
+  CHECK(QResamplerProcessSamples(a, input, kInputFrames) == num_output_frames);
+  for (n = 0; n < num_output_frames; ++n) {
+    CHECK(QResamplerOutput(a)[n] == QResamplerOutput(expected)[n]);
+  }
+
+  /* Entries are freed with the last resampler using them. */
+  QResamplerFree(a);
+  CHECK(QResamplerFilterCacheSize(cache) == 3);
+  QResamplerFree(b);
+  CHECK(QResamplerFilterCacheSize(cache) == 2);
+  QResamplerFree(d);
+  CHECK(QResamplerFilterCacheSize(cache) == 1);
+  QResamplerFree(c);
+  CHECK(QResamplerFilterCacheSize(cache) == 0);
+  QResamplerFree(expected);
+  free(buffer);
+  QResamplerFilterCacheFree(cache);
+}
+
+/* QResamplerMemoryUsage() reports the buffer size, plus the cache entry for
+ * resamplers with shared filters. Without a cache, QResamplerMake() allocates
+ * the same size as QResamplerInitInBuffer() needs.
+ */
+static void TestMemoryUsage(int kernel_table_phases) {
+  printf("TestMemoryUsage(%d)\n", kernel_table_phases);
+  const int kInputFrames = 64;
+  QResamplerOptions options = kQResamplerDefaultOptions;
+  options.kernel_table_phases = kernel_table_phases;
+  const size_t required_bytes = QResamplerRequiredBytes(
+      44100.0f, 16000.0f, 3, kInputFrames, &options);
+  void* buffer = CHECK_NOTNULL(malloc(required_bytes));
+  QResampler* in_buffer = CHECK_NOTNULL(QResamplerInitInBuffer(
+      buffer, required_bytes, 44100.0f, 16000.0f, 3, kInputFrames, &options));
+  MemoryUsage usage;
+  QResamplerMemoryUsage(in_buffer, &usage);
+  CHECK(usage.heap_bytes == required_bytes);
+  CHECK(usage.state_bytes == 0);
+  CHECK(usage.table_bytes == 0);
+
+  QResampler* made = CHECK_NOTNULL(QResamplerMake(
+      44100.0f, 16000.0f, 3, kInputFrames, &options));
+  QResamplerMemoryUsage(made, &usage);
+  CHECK(usage.heap_bytes == required_bytes);
+
+  /* With shared filters, the cache entry replaces the filters' allocation,
+   * differing by its small header and arena rounding.
+   */
+  QResamplerFilterCache* cache = CHECK_NOTNULL(QResamplerFilterCacheMake());
+  options.filter_cache = cache;
+  QResampler* shared = CHECK_NOTNULL(QResamplerMake(
+      44100.0f, 16000.0f, 3, kInputFrames, &options));
+  QResamplerMemoryUsage(shared, &usage);
+  CHECK(usage.heap_bytes + kArenaAlignment > required_bytes);
+  CHECK(usage.heap_bytes < required_bytes + 128);
+
+  QResamplerFree(shared);
+  QResamplerFree(made);
+  QResamplerFree(in_buffer);
+  free(buffer);
+  QResamplerFilterCacheFree(cache);
+}
+
+/* Reconfiguring to the same rates doesn't change the output. */
+static void TestReconfigureSameRates(int num_channels) {
+  printf("TestReconfigureSameRates(%d)\n", num_channels);
+  const int kBlockFrames = 40;
+  const int kNumBlocks = 10;
+  QResamplerFilterCache* cache = CHECK_NOTNULL(QResamplerFilterCacheMake());
+  QResamplerOptions options = kQResamplerDefaultOptions;
+  options.filter_cache = cache;
+  QResampler* reconfigured = CHECK_NOTNULL(QResamplerMakeReconfigurable(
+      48000.0f, 16000.0f, 44100.0f / 16000.0f, 48000.0f / 16000.0f,
+      num_channels, kBlockFrames, &options));
+  QResampler* expected = CHECK_NOTNULL(QResamplerMake(
+      48000.0f, 16000.0f, num_channels, kBlockFrames, &options));
+  CHECK(QResamplerFilterCacheSize(cache) == 1);
+  float* input = (float*)CHECK_NOTNULL(
+      malloc(sizeof(float) * kBlockFrames * num_channels));
+
+  int block;
+  for (block = 0; block < kNumBlocks; ++block) {
+    if (block == kNumBlocks / 2) {
+      CHECK(QResamplerReconfigure(reconfigured, 48000.0f, 16000.0f));
+      CHECK(QResamplerFilterCacheSize(cache) == 1);
+    }
+    int i;
+    for (i = 0; i < kBlockFrames * num_channels; ++i) {
+      input[i] = -0.5f + ((float)rand()) / RAND_MAX;
+    }
+    const int num_output_frames =
+        QResamplerProcessSamples(expected, input, kBlockFrames);
+    CHECK(QResamplerProcessSamples(reconfigured, input, kBlockFrames) ==
+          num_output_frames);
+    for (i = 0; i < num_output_frames * num_channels; ++i) {
+      CHECK(QResamplerOutput(reconfigured)[i] == QResamplerOutput(expected)[i]);
+    }
+  }
+
+  free(input);
+  QResamplerFree(expected);
+  QResamplerFree(reconfigured);
+  CHECK(QResamplerFilterCacheSize(cache) == 0);
+  QResamplerFilterCacheFree(cache);
+}
+
+/* A sine wave stays continuous when switching the input sample rate. Without
+ * a filter cache, switching to filters larger than the initial ones puts them
+ * on the heap.
+ */
+static void TestReconfigureSineWave(void) {
+  puts("TestReconfigureSineWave");
+  const float kFrequency = 440.0f;
+  const float kOutputSampleRate = 16000.0f;
+  /* Input sample rate for each segment of kSegmentFrames input frames. */
+  const float kInputRates[] = {48000.0f, 44100.0f, 46000.0f, 47000.0f};
+  const int kNumSegments = sizeof(kInputRates) / sizeof(*kInputRates);
+  const int kSegmentFrames = 4800;
+  const int kBlockFrames = 64;
+  QResampler* resampler = CHECK_NOTNULL(QResamplerMakeReconfigurable(
+      kInputRates[0], kOutputSampleRate, 2.75f, 3.0f, 1, kBlockFrames, NULL));
+  float input[64];
+  double input_time = 0.0;
+  int m = 0;
+  int outputs_since_switch = 0;
+  int segment;
+
+  for (segment = 0; segment < kNumSegments; ++segment) {
+    const float input_sample_rate_hz = kInputRates[segment];
+    if (segment > 0) {
+      CHECK(QResamplerReconfigure(
+          resampler, input_sample_rate_hz, kOutputSampleRate));
+      outputs_since_switch = 0;
+    }
+    int n;
+    for (n = 0; n < kSegmentFrames; n += kBlockFrames) {
+      int i;
+      for (i = 0; i < kBlockFrames; ++i) {
+        input[i] = sin(2.0 * M_PI * kFrequency * input_time);
+        input_time += 1.0 / input_sample_rate_hz;
+      }
+      const int num_output_frames =
+          QResamplerProcessSamples(resampler, input, kBlockFrames);
+      CHECK(num_output_frames <= QResamplerMaxOutputFrames(resampler));
+      const float* output = QResamplerOutput(resampler);
+      for (i = 0; i < num_output_frames; ++i, ++m, ++outputs_since_switch) {
+        /* Output frame m is at time m / kOutputSampleRate. Skip the start,
+         * which depends on input at negative times.
+         */
+        if (m < 16) { continue; }
+        const double expected =
+            sin(2.0 * M_PI * kFrequency * m / kOutputSampleRate);
+        /* Outputs just after a switch depend on delayed input at the old
+         * rate, so they have a small transient error.
+         */
+        const double tol = (outputs_since_switch < 16) ? 0.1 : 0.01;
+        CHECK(fabs(output[i] - expected) < tol);
+      }
+    }
+  }
+
+  /* The output duration matches the input duration. */
+  CHECK(fabs(m / kOutputSampleRate - input_time) < 0.002);
+  QResamplerFree(resampler);
+}
+
+/* Reconfiguring fails if the buffers are too small, leaving the resampler
+ * unchanged.
+ */
+static void TestReconfigureTooLarge(void) {
+  puts("TestReconfigureTooLarge");
+  const int kInputFrames = 50;
+  QResampler* resampler = CHECK_NOTNULL(
+      QResamplerMake(16000.0f, 16000.0f, 1, kInputFrames, NULL));
+  QResampler* expected = CHECK_NOTNULL(
+      QResamplerMake(16000.0f, 16000.0f, 1, kInputFrames, NULL));
+  CHECK(!QResamplerReconfigure(resampler, 48000.0f, 16000.0f));
+  CHECK(!QResamplerReconfigure(resampler, 16000.0f, 48000.0f));
+  CHECK(!QResamplerReconfigure(resampler, -1.0f, 16000.0f));
+
+  float input[50];
+  int n;
+  for (n = 0; n < kInputFrames; ++n) {
+    input[n] = -0.5f + ((float)rand()) / RAND_MAX;
+  }
+  const int num_output_frames =
+      QResamplerProcessSamples(expected, input, kInputFrames);
+  CHECK(QResamplerProcessSamples(resampler, input, kInputFrames) ==
+        num_output_frames);
+  for (n = 0; n < num_output_frames; ++n) {
+    CHECK(QResamplerOutput(resampler)[n] == QResamplerOutput(expected)[n]);
+  }
+
+  /* The initial factor must be within [min_factor, max_factor]. */
+  CHECK(QResamplerMakeReconfigurable(
+      48000.0f, 16000.0f, 1.0f, 2.0f, 1, kInputFrames, NULL) == NULL);
+
+  QResamplerFree(expected);
+  QResamplerFree(resampler);
+}
+
 int main(int argc, char** argv) {
   srand(0);
 
@@ -449,13 +909,27 @@ int main(int argc, char** argv) {
   for (num_channels = 1; num_channels <= 4; ++num_channels) {
     TestCompareWithReferenceResampler(num_channels, 5.0f);
     TestStreamingRandomBlockSizes(num_channels);
+    TestFillFixedOutputBlocks(num_channels);
     TestInputSizeExceedsMax(num_channels);
+    TestInitInBuffer(num_channels);
+    TestKernelTablePhases(num_channels);
+    TestReconfigureSameRates(num_channels);
   }
 
+  TestCompareWithReferenceResampler(7, 5.0f);
+  TestStreamingRandomBlockSizes(7);
+  TestCompareWithReferenceResampler(12, 5.0f);
+  TestStreamingRandomBlockSizes(12);
+
   TestCompareWithReferenceResampler(1, 4.0f);
   TestCompareWithReferenceResampler(1, 17.0f);
   TestResampleSineWave();
   TestResampleChirp();
+  TestSharedFilters();
+  TestMemoryUsage(0);
+  TestMemoryUsage(64);
+  TestReconfigureSineWave();
+  TestReconfigureTooLarge();
 
   puts("PASS");
   return EXIT_SUCCESS;
@@ -0,0 +1,563 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * Tests FLAC decoding with files written by a minimal encoder in this test,
+ * which exercises each subframe type and stereo decorrelation mode.
+ */
+
+#include "src/dsp/read_flac_generic.h"
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "src/dsp/logging.h"
+#include "src/dsp/read_wav_stream.h"
+
+#define kSampleRateHz 16000
+#define kBlockSize 1152
+#define kMaxChannels 2
+#define kLastBlockSize 392
+#define kMaxBytes 1000000
+
+/* Subframe types of the test encoder. */
+enum {
+  kConstant,
+  kVerbatim,
+  kFixed,
+  kLpc,
+};
+
+typedef struct {
+  int type;
+  int order;
+  int partition_order;
+  /* Partition to write with escape-coded binary values, or -1. */
+  int escape_partition;
+  int wasted_bits;
+} SubframeSpec;
+
+typedef struct {
+  int channel_assignment;
+  SubframeSpec subframes[kMaxChannels];
+} FrameSpec;
+
+/* LPC coefficients used by the test encoder, for orders up to 4. */
+static const int32_t kLpcCoeffs[4] = {1800, -1100, 300, -50};
+#define kLpcPrecision 12
+#define kLpcShift 10
+
+typedef struct {
+  uint8_t bytes[kMaxBytes];
+  size_t size;
+  uint32_t acc;
+  int acc_bits;
+  /* Byte offset where each frame starts. */
+  size_t frame_starts[8];
+} BitWriter;
+
+static void WriteBits(BitWriter* bw, uint32_t value, int num_bits) {
+  int i;
+  for (i = num_bits - 1; i >= 0; --i) {
+    const uint32_t bit = (i < 32) ? (value >> i) & 1 : 0;
+    bw->acc = (bw->acc << 1) | bit;
+    if (++bw->acc_bits == 8) {
+      CHECK(bw->size < kMaxBytes);
+      bw->bytes[bw->size++] = (uint8_t)bw->acc;
+      bw->acc = 0;
+      bw->acc_bits = 0;
+    }
+  }
+}
+
+static void WriteSignedBits(BitWriter* bw, int32_t value, int num_bits) {
+  WriteBits(bw, (uint32_t)value & (uint32_t)((UINT64_C(1) << num_bits) - 1),
+            num_bits);
+}
+
+static void AlignToByte(BitWriter* bw) {
+  while (bw->acc_bits) { WriteBits(bw, 0, 1); }
+}
+
+/* Computes FLAC's CRC-8 or CRC-16 of `bytes`. */
+static uint32_t Crc(const uint8_t* bytes, size_t size, int num_bits,
+                    uint32_t polynomial) {
+  const uint32_t top_bit = UINT32_C(1) << (num_bits - 1);
+  const uint32_t mask = (top_bit << 1) - 1;
+  uint32_t crc = 0;
+  size_t i;
+  for (i = 0; i < size; ++i) {
+    crc ^= (uint32_t)bytes[i] << (num_bits - 8);
+    int bit;
+    for (bit = 0; bit < 8; ++bit) {
+      crc = ((crc & top_bit) ? (crc << 1) ^ polynomial : crc << 1) & mask;
+    }
+  }
+  return crc;
+}
+
+/* Number of bits to code signed `value` in two's complement. */
+static int SignedBitWidth(int32_t value) {
+  int num_bits = 1;
+  while (value < -(INT32_C(1) << (num_bits - 1)) ||
+         value >= (INT32_C(1) << (num_bits - 1))) {
+    ++num_bits;
+  }
+  return num_bits;
+}
+
+/* Writes `residual` coded with a Rice parameter chosen per partition. */
+static void WriteResidual(BitWriter* bw, const int32_t* residual,
+                          int block_size, int order,
+                          const SubframeSpec* spec) {
+  /* Use 5-bit parameters for odd partition orders, to test both methods. */
+  const int method = spec->partition_order % 2;
+  const int param_bits = method ? 5 : 4;
+  WriteBits(bw, method, 2);
+  WriteBits(bw, spec->partition_order, 4);
+  const int partition_size = block_size >> spec->partition_order;
+  int i = order;
+  int partition;
+  for (partition = 0; partition < (1 << spec->partition_order); ++partition) {
+    const int start = i;
+    const int end = (partition + 1) * partition_size;
+    if (partition == spec->escape_partition) {
+      int num_bits = 0;
+      for (i = start; i < end; ++i) {
+        const int width = SignedBitWidth(residual[i]);
+        if (width > num_bits) { num_bits = width; }
+      }
+      WriteBits(bw, (1 << param_bits) - 1, param_bits);
+      WriteBits(bw, num_bits, 5);
+      for (i = start; i < end; ++i) {
+        WriteSignedBits(bw, residual[i], num_bits);
+      }
+      continue;
+    }
+
+    /* Choose the parameter minimizing the coded size. */
+    int best_param = 0;
+    uint64_t best_size = UINT64_MAX;
+    int param;
+    for (param = 0; param < (1 << param_bits) - 1; ++param) {
+      uint64_t size = 0;
+      for (i = start; i < end; ++i) {
+        const uint32_t zigzag = ((uint32_t)residual[i] << 1) ^
+                                (uint32_t)(residual[i] >> 31);
+        size += (zigzag >> param) + 1 + param;
+      }
+      if (size < best_size) {
+        best_size = size;
+        best_param = param;
+      }
+    }
+    WriteBits(bw, best_param, param_bits);
+    for (i = start; i < end; ++i) {
+      const uint32_t zigzag = ((uint32_t)residual[i] << 1) ^
+                              (uint32_t)(residual[i] >> 31);
+      WriteBits(bw, 0, zigzag >> best_param);
+      WriteBits(bw, 1, 1);
+      WriteBits(bw, zigzag, best_param);
+    }
+  }
+}
+
+/* Writes a subframe of `bit_depth`-bit samples `x`. */
+static void WriteSubframe(BitWriter* bw, const int32_t* x, int block_size,
+                          int bit_depth, const SubframeSpec* spec) {
+  static int32_t shifted[kBlockSize];
+  static int32_t residual[kBlockSize];
+  const int k = spec->wasted_bits;
+  int i;
+  for (i = 0; i < block_size; ++i) {
+    CHECK(x[i] % (1 << k) == 0);
+    shifted[i] = x[i] / (1 << k);
+  }
+  bit_depth -= k;
+  const int order = spec->order;
+  int type;
+  switch (spec->type) {
+    case kConstant: type = 0; break;
+    case kVerbatim: type = 1; break;
+    case kFixed: type = 8 + order; break;
+    default: type = 31 + order; break;
+  }
+  WriteBits(bw, 0, 1);
+  WriteBits(bw, type, 6);
+  if (k) {
+    WriteBits(bw, 1, 1);
+    WriteBits(bw, 0, k - 1);
+    WriteBits(bw, 1, 1);
+  } else {
+    WriteBits(bw, 0, 1);
+  }
+
+  if (spec->type == kConstant) {
+    WriteSignedBits(bw, shifted[0], bit_depth);
+    return;
+  }
+  const int num_warm_up = (spec->type == kVerbatim) ? block_size : order;
+  for (i = 0; i < num_warm_up; ++i) {
+    WriteSignedBits(bw, shifted[i], bit_depth);
+  }
+  if (spec->type == kVerbatim) { return; }
+
+  if (spec->type == kLpc) {
+    WriteBits(bw, kLpcPrecision - 1, 4);
+    WriteSignedBits(bw, kLpcShift, 5);
+    for (i = 0; i < order; ++i) {
+      WriteSignedBits(bw, kLpcCoeffs[i], kLpcPrecision);
+    }
+  }
+  for (i = order; i < block_size; ++i) {
+    const int32_t* h = shifted + i;
+    int64_t prediction = 0;
+    if (spec->type == kFixed) {
+      static const int kFixedCoeffs[5][4] = {
+          {0, 0, 0, 0}, {1, 0, 0, 0}, {2, -1, 0, 0},
+          {3, -3, 1, 0}, {4, -6, 4, -1}};
+      int j;
+      for (j = 0; j < order; ++j) {
+        prediction += (int64_t)kFixedCoeffs[order][j] * h[-1 - j];
+      }
+    } else {
+      int j;
+      for (j = 0; j < order; ++j) {
+        prediction += (int64_t)kLpcCoeffs[j] * h[-1 - j];
+      }
+      prediction >>= kLpcShift;
+    }
+    residual[i] = (int32_t)(shifted[i] - prediction);
+  }
+  WriteResidual(bw, residual, block_size, order, spec);
+}
+
+/* Writes a frame of the `num_channels`-channel signal `x`, with channel c
+ * starting at `x[c]`.
+ */
+static void WriteFrame(BitWriter* bw, int frame_index, int32_t* const* x,
+                       int num_channels, int block_size, int bit_depth,
+                       const FrameSpec* spec) {
+  const size_t frame_start = bw->size;
+  bw->frame_starts[frame_index] = frame_start;
+  WriteBits(bw, 0x3ffe, 14);
+  WriteBits(bw, 0, 2);
+  WriteBits(bw, 7, 4);  /* 16-bit block size at the end of the header. */
+  WriteBits(bw, 0, 4);  /* Sample rate from the stream info. */
+  WriteBits(bw, spec->channel_assignment, 4);
+  WriteBits(bw, (bit_depth == 16) ? 4 : 6, 3);
+  WriteBits(bw, 0, 1);
+  CHECK(frame_index < 2048);
+  if (frame_index < 128) {
+    WriteBits(bw, frame_index, 8);
+  } else {  /* Two-byte UTF-8 coding. */
+    WriteBits(bw, 0xc0 | (frame_index >> 6), 8);
+    WriteBits(bw, 0x80 | (frame_index & 0x3f), 8);
+  }
+  WriteBits(bw, block_size - 1, 16);
+  WriteBits(bw, Crc(bw->bytes + frame_start, bw->size - frame_start, 8, 0x07),
+            8);
+
+  /* Stereo decorrelation. */
+  static int32_t decorrelated[kMaxChannels][kBlockSize];
+  int i;
+  for (i = 0; i < block_size; ++i) {
+    const int32_t left = x[0][i];
+    const int32_t right = (num_channels > 1) ? x[1][i] : 0;
+    decorrelated[0][i] = left;
+    decorrelated[1][i] = right;
+    switch (spec->channel_assignment) {
+      case 8:  /* Left-side. */
+        decorrelated[1][i] = left - right;
+        break;
+      case 9:  /* Right-side. */
+        decorrelated[0][i] = left - right;
+        break;
+      case 10:  /* Mid-side. */
+        decorrelated[0][i] = (left + right) >> 1;
+        decorrelated[1][i] = left - right;
+        break;
+    }
+  }
+
+  int c;
+  for (c = 0; c < num_channels; ++c) {
+    const int is_side =
+        (spec->channel_assignment == 9) ? (c == 0)
+        : (spec->channel_assignment >= 8) ? (c == 1) : 0;
+    WriteSubframe(bw, decorrelated[c], block_size, bit_depth + is_side,
+                  &spec->subframes[c]);
+  }
+  AlignToByte(bw);
+  WriteBits(bw, Crc(bw->bytes + frame_start, bw->size - frame_start, 16,
+                    0x8005), 16);
+}
+
+/* Test signal in channel-major order, with special sections so that some
+ * frames are best coded with constant subframes or wasted bits.
+ */
+static int32_t TestSignal(int c, int i, int bit_depth, int num_frames) {
+  const double amplitude = (1 << (bit_depth - 1)) - 1;
+  double x = 0.6 * sin(0.01 * (c + 1) * i) + 0.3 * sin(0.37 * i) +
+             0.05 * ((double)rand() / RAND_MAX - 0.5);
+  /* The last, partial frame is constant. */
+  if (i >= num_frames - kLastBlockSize) { x = -0.25 + c * 0.5; }
+  int32_t value = (int32_t)(amplitude * x);
+  if (i >= 4 * kBlockSize && c == 1) {
+    value = (int32_t)((uint32_t)value & ~UINT32_C(3));  /* Wasted bits. */
+  }
+  return value;
+}
+
+/* Encodes a FLAC file with the given frame specs. The last frame is partial.
+ * Returns the expected float samples, which the caller should free.
+ */
+static float* EncodeTestFlac(BitWriter* bw, int num_channels, int bit_depth,
+                             const FrameSpec* specs, int num_specs,
+                             int* num_frames_out) {
+  const int num_frames = (num_specs - 1) * kBlockSize + kLastBlockSize;
+  int32_t* signal[kMaxChannels];
+  float* expected = (float*)CHECK_NOTNULL(
+      malloc(sizeof(float) * num_frames * num_channels));
+  int c;
+  int i;
+  srand(0);
+  for (c = 0; c < num_channels; ++c) {
+    signal[c] = (int32_t*)CHECK_NOTNULL(malloc(sizeof(int32_t) * num_frames));
+    for (i = 0; i < num_frames; ++i) {
+      signal[c][i] = TestSignal(c, i, bit_depth, num_frames);
+      expected[num_channels * i + c] =
+          signal[c][i] / (float)(1 << (bit_depth - 1));
+    }
+  }
+
+  memset(bw, 0, sizeof(BitWriter));
+  WriteBits(bw, 0x664c6143, 32);  /* "fLaC" */
+  /* A padding block, which the decoder should skip. */
+  WriteBits(bw, 0, 1);
+  WriteBits(bw, 1, 7);
+  WriteBits(bw, 5, 24);
+  WriteBits(bw, 0, 32);
+  WriteBits(bw, 0, 8);
+  /* Stream info. */
+  WriteBits(bw, 1, 1);
+  WriteBits(bw, 0, 7);
+  WriteBits(bw, 34, 24);
+  WriteBits(bw, kBlockSize, 16);
+  WriteBits(bw, kBlockSize, 16);
+  WriteBits(bw, 0, 24);
+  WriteBits(bw, 0, 24);
+  WriteBits(bw, kSampleRateHz, 20);
+  WriteBits(bw, num_channels - 1, 3);
+  WriteBits(bw, bit_depth - 1, 5);
+  WriteBits(bw, 0, 4);
+  WriteBits(bw, num_frames, 32);
+  for (i = 0; i < 4; ++i) { WriteBits(bw, 0, 32); }  /* MD5 (unchecked). */
+
+  for (i = 0; i < num_specs; ++i) {
+    int32_t* x[kMaxChannels];
+    for (c = 0; c < num_channels; ++c) {
+      x[c] = signal[c] + i * kBlockSize;
+    }
+    const int block_size = (i < num_specs - 1) ? kBlockSize : kLastBlockSize;
+    WriteFrame(bw, i, x, num_channels, block_size, bit_depth, &specs[i]);
+  }
+
+  for (c = 0; c < num_channels; ++c) {
+    free(signal[c]);
+  }
+  *num_frames_out = num_frames;
+  return expected;
+}
+
+static const FrameSpec kStereoSpecs[5] = {
+    /* Independent channels. */
+    {1, {{kVerbatim, 0, 0, -1, 0}, {kFixed, 0, 0, -1, 0}}},
+    /* Left-side. */
+    {8, {{kFixed, 2, 2, -1, 0}, {kFixed, 1, 3, -1, 0}}},
+    /* Right-side. */
+    {9, {{kLpc, 4, 1, -1, 0}, {kLpc, 2, 0, -1, 0}}},
+    /* Mid-side with an escaped partition. */
+    {10, {{kFixed, 4, 3, 2, 0}, {kLpc, 3, 2, 0, 0}}},
+    /* Partial frame, constant, and with wasted bits in channel 1. */
+    {1, {{kFixed, 3, 3, -1, 0}, {kFixed, 2, 0, -1, 2}}},
+};
+
+static const FrameSpec kMonoSpecs[3] = {
+    {0, {{kLpc, 4, 4, -1, 0}}},
+    {0, {{kFixed, 3, 0, 0, 0}}},
+    {0, {{kConstant, 0, 0, -1, 0}}},
+};
+
+static void WriteFile(const char* file_name, const uint8_t* bytes,
+                      size_t size) {
+  FILE* f = CHECK_NOTNULL(fopen(file_name, "wb"));
+  CHECK(fwrite(bytes, 1, size, f) == size);
+  fclose(f);
+}
+
+/* Reads `stream` to the end, checking that it matches `expected`. */
+static void CheckStream(ReadWavStream* stream, int num_channels,
+                        int frames_per_block, const float* expected,
+                        int expected_frames) {
+  CHECK(ReadWavStreamNumChannels(stream) == num_channels);
+  CHECK(ReadWavStreamSampleRateHz(stream) == kSampleRateHz);
+  CHECK(ReadWavStreamInfo(stream)->encoding == kFlacEncoding);
+
+  int total_frames = 0;
+  const float* block;
+  int num_frames;
+  while ((block = ReadWavStreamNextBlock(stream, &num_frames)) != NULL) {
+    CHECK(1 <= num_frames && num_frames <= frames_per_block);
+    CHECK(total_frames + num_frames <= expected_frames);
+    CHECK(memcmp(block, expected + total_frames * num_channels,
+                 sizeof(float) * num_frames * num_channels) == 0);
+    total_frames += num_frames;
+  }
+  CHECK(total_frames == expected_frames);
+}
+
+/* An implementation of standard I/O callbacks. */
+static size_t ReadBytes(void* bytes, size_t num_bytes, void* io_ptr) {
+  return fread(bytes, 1, num_bytes, (FILE*)io_ptr);
+}
+
+static int Seek(size_t num_bytes, void* io_ptr) {
+  return fseek((FILE*)io_ptr, num_bytes, SEEK_CUR);
+}
+
+static int EndOfFile(void* io_ptr) {
+  return feof((FILE*)io_ptr);
+}
+
+/* Decodes a stereo or mono file, mapped and with custom callbacks. */
+static void TestDecode(int num_channels, int bit_depth) {
+  printf("TestDecode(%d, %d)\n", num_channels, bit_depth);
+  const int kFramesPerBlock = 100;
+  const char* file_name = CHECK_NOTNULL(tmpnam(NULL));
+  BitWriter* bw = (BitWriter*)CHECK_NOTNULL(malloc(sizeof(BitWriter)));
+  int num_frames;
+  float* expected = (num_channels == 2)
+      ? EncodeTestFlac(bw, 2, bit_depth, kStereoSpecs, 5, &num_frames)
+      : EncodeTestFlac(bw, 1, bit_depth, kMonoSpecs, 3, &num_frames);
+  WriteFile(file_name, bw->bytes, bw->size);
+
+  ReadWavStream* stream =
+      CHECK_NOTNULL(ReadWavStreamOpen(file_name, kFramesPerBlock));
+  CHECK(ReadWavStreamInfo(stream)->bit_depth == bit_depth);
+  CheckStream(stream, num_channels, kFramesPerBlock, expected, num_frames);
+  ReadWavStreamClose(stream);
+
+  FILE* f = CHECK_NOTNULL(fopen(file_name, "rb"));
+  WavReader w;
+  w.io_ptr = f;
+  w.read_fun = ReadBytes;
+  w.seek_fun = Seek;
+  w.eof_fun = EndOfFile;
+  w.custom_chunk_fun = NULL;
+  stream = CHECK_NOTNULL(ReadWavStreamOpenGeneric(&w, kFramesPerBlock));
+  CHECK(!ReadWavStreamIsMapped(stream));
+  CheckStream(stream, num_channels, kFramesPerBlock, expected, num_frames);
+  ReadWavStreamClose(stream);
+  fclose(f);
+
+  free(expected);
+  free(bw);
+  remove(file_name);
+}
+
+/* Reading stops at a corrupt frame or the end of a truncated file. */
+static void TestCorruptAndTruncated(void) {
+  puts("TestCorruptAndTruncated");
+  const char* file_name = CHECK_NOTNULL(tmpnam(NULL));
+  BitWriter* bw = (BitWriter*)CHECK_NOTNULL(malloc(sizeof(BitWriter)));
+  int num_frames;
+  float* expected = EncodeTestFlac(bw, 2, 16, kStereoSpecs, 5, &num_frames);
+  const size_t size = bw->size;
+
+  const size_t third_frame = bw->frame_starts[2];
+
+  /* Flip a bit in the middle of the third frame. */
+  bw->bytes[third_frame + 100] ^= 4;
+  WriteFile(file_name, bw->bytes, size);
+  ReadWavStream* stream = CHECK_NOTNULL(ReadWavStreamOpen(file_name, 64));
+  CheckStream(stream, 2, 64, expected, 2 * kBlockSize);
+  ReadWavStreamClose(stream);
+  bw->bytes[third_frame + 100] ^= 4;
+
+  /* Truncate in the middle of the third frame. */
+  WriteFile(file_name, bw->bytes, third_frame + 200);
+  stream = CHECK_NOTNULL(ReadWavStreamOpen(file_name, 64));
+  CheckStream(stream, 2, 64, expected, 2 * kBlockSize);
+  ReadWavStreamClose(stream);
+
+  free(expected);
+  free(bw);
+  remove(file_name);
+}
+
+/* Decodes with FlacDecoder directly, reading in odd sizes. */
+static void TestDecoderOddReads(void) {
+  puts("TestDecoderOddReads");
+  const char* file_name = CHECK_NOTNULL(tmpnam(NULL));
+  BitWriter* bw = (BitWriter*)CHECK_NOTNULL(malloc(sizeof(BitWriter)));
+  int num_frames;
+  float* expected = EncodeTestFlac(bw, 2, 24, kStereoSpecs, 5, &num_frames);
+  WriteFile(file_name, bw->bytes, bw->size);
+
+  FILE* f = CHECK_NOTNULL(fopen(file_name, "rb"));
+  WavReader w;
+  w.io_ptr = f;
+  w.read_fun = ReadBytes;
+  w.seek_fun = NULL;
+  w.eof_fun = NULL;
+  w.custom_chunk_fun = NULL;
+  ReadWavInfo info;
+  FlacDecoder* decoder = CHECK_NOTNULL(FlacDecoderOpenGeneric(&w, &info));
+  CHECK(info.num_channels == 2);
+  CHECK(info.remaining_samples == (size_t)num_frames * 2);
+
+  float buffer[2 * 777];
+  size_t total = 0;
+  size_t num_read;
+  /* Odd sizes are rounded down to whole frames. */
+  while ((num_read = ReadFlacFloatSamplesGeneric(
+              decoder, &info, buffer, 2 * 777 - 1)) > 0) {
+    CHECK(num_read % 2 == 0);
+    CHECK(memcmp(buffer, expected + total, sizeof(float) * num_read) == 0);
+    total += num_read;
+  }
+  CHECK(total == (size_t)num_frames * 2);
+  CHECK(info.remaining_samples == 0);
+  FlacDecoderClose(decoder);
+  fclose(f);
+
+  free(expected);
+  free(bw);
+  remove(file_name);
+}
+
+int main(int argc, char** argv) {
+  TestDecode(2, 16);
+  TestDecode(2, 24);
+  TestDecode(1, 16);
+  TestCorruptAndTruncated();
+  TestDecoderOddReads();
+
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
@@ -42,6 +42,22 @@ static const uint8_t kNonStandardWavFile[56] = {
 /*  d    a    t    a                                     */
     100, 97,  116, 97,  0,   0,   0,   0};
 
+/* Same samples as kTest16BitMonoWavFile in RF64 format. The RIFF and data
+ * chunk sizes are -1, with the actual sizes in the ds64 chunk.
+ */
+static const uint8_t kTestRf64MonoWavFile[88] = {
+/*  R    F    6    4                      W    A    V    E   d    s    6    4 */
+    82,  70,  54,  52,  255, 255, 255, 255, 87, 65, 86, 69, 100, 115, 54, 52,
+/*                      RIFF size                data size                   */
+    28,  0,   0,   0,   80,  0,   0,   0,   0,  0,  0,  0,  8,   0,   0,  0,
+/*                      frame count              table length                */
+    0,   0,   0,   0,   4,   0,   0,   0,   0,  0,  0,  0,  0,   0,   0,  0,
+/*  f    m    t    _                                                         */
+    102, 109, 116, 32,  16,  0,   0,   0,   1,  0,  1,  0,  128, 187, 0,  0,
+/*                                          d    a    t    a                 */
+    0,   119, 1,   0,   2,   0,   16,  0,   100, 97, 116, 97, 255, 255, 255,
+    255, 7,   0,   254, 255, 255, 127, 0,   128};
+
 struct TestData {
   uint8_t /* bool */ found_custom_chunk;
   char custom_chunk_contents[4];  /* We know the chunk is of size 4. */
@@ -149,10 +165,41 @@ static void TestNonstandardWavFile(void) {
   fclose(f);
 }
 
+static void TestReadRf64WavFile(void) {
+  puts("TestReadRf64WavFile");
+  const char* wav_file_name = NULL;
+  FILE* f;
+  ReadWavInfo info;
+
+  wav_file_name = CHECK_NOTNULL(tmpnam(NULL));
+  WriteBytesAsFile(wav_file_name, kTestRf64MonoWavFile, 88);
+
+  f = CHECK_NOTNULL(fopen(wav_file_name, "rb"));
+
+  TestData data = MakeTestData(f);
+  WavReader reader = CustomChunkWavReader(&data);
+  CHECK(ReadWavHeaderGeneric(&reader, &info));
+  CHECK(info.num_channels == 1);
+  CHECK(info.sample_rate_hz == 48000);
+  CHECK(info.remaining_samples == 4);
+  CHECK(!data.found_custom_chunk);
+
+  int16_t samples[4];
+  CHECK(Read16BitWavSamplesGeneric(&reader, &info, samples, 4) == 4);
+  CHECK(samples[0] == 7);
+  CHECK(samples[1] == -2);
+  CHECK(samples[2] == INT16_MAX);
+  CHECK(samples[3] == INT16_MIN);
+
+  fclose(f);
+  remove(wav_file_name);
+}
+
 int main(int argc, char** argv) {
   srand(0);
   TestReadMonoWav();
   TestNonstandardWavFile();
+  TestReadRf64WavFile();
 
   puts("PASS");
   return EXIT_SUCCESS;
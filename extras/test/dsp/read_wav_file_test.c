@@ -86,6 +86,16 @@ static const uint8_t kTest24BitMonoWavFile[92] = {
    4,  0,  0,  0,   4,   0,   0,   0,   100, 97,  116, 97,  12,  0,   0,   0,
    0,  7,  0,  0,   254, 255, 0,   255, 127, 0,   0,   128};
 
+/* A 48kHz mono WAV file with 32-bit PCM samples {7, -2, INT32_MAX, INT32_MIN}.
+ */
+static const uint8_t kTest32BitMonoWavFile[60] = {
+/*  R    I    F    F                      W    A    V   E   f    m    t    _ */
+    82,  73,  70,  70,  52,  0,  0,   0,  87,  65,  86, 69, 102, 109, 116, 32,
+    16,  0,   0,   0,   1,   0,  1,   0,  128, 187, 0,  0,  0,   238, 2,   0,
+/*                      d    a   t    a                                      */
+    4,   0,   32,  0,   100, 97, 116, 97, 16,  0,   0,  0,  7,   0,   0,   0,
+    254, 255, 255, 255, 255, 255, 255, 127, 0, 0,   0,  128};
+
 /* A 8kHz mono WAV file with mulaw samples, decoding to
    {29052, 20860, 18812, 31100, -7164, 716, -25980, -24956}
 
@@ -250,6 +260,29 @@ static void TestReadMonoWav24BitGeneric(void) {
   remove(wav_file_name);
 }
 
+static void TestReadMonoWav32BitGeneric(void) {
+  puts("TestReadMonoWav32BitGeneric");
+  static const int32_t kExpectedSamples[4] = {7, -2, INT32_MAX, INT32_MIN};
+  const char* wav_file_name = NULL;
+  int32_t* samples = NULL;
+  size_t num_samples;
+  int num_channels;
+  int sample_rate_hz;
+
+  wav_file_name = CHECK_NOTNULL(tmpnam(NULL));
+  WriteBytesAsFile(wav_file_name, kTest32BitMonoWavFile, 60);
+
+  samples = CHECK_NOTNULL(ReadWavFile(wav_file_name, &num_samples,
+                                      &num_channels, &sample_rate_hz));
+  CHECK(num_samples == 4);
+  CHECK(memcmp(samples, kExpectedSamples, sizeof(kExpectedSamples)) == 0);
+  CHECK(num_channels == 1);
+  CHECK(sample_rate_hz == 48000);
+
+  free(samples);
+  remove(wav_file_name);
+}
+
 static void TestReadMonoWavFloatGeneric(void) {
   puts("TestReadMonoWavFloatGeneric");
   /* The LSBs are going to be empty since we're reading 16 bits into a 32-bit
@@ -474,6 +507,7 @@ int main(int argc, char** argv) {
   TestReadMonoWav16BitGeneric();
   TestReadBigWavFile();
   TestReadMonoWav24BitGeneric();
+  TestReadMonoWav32BitGeneric();
   TestReadMonoWavFloatGeneric();
   TestReadMonoWavStreaming();
   TestRead3ChannelWav();
@@ -0,0 +1,237 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "src/dsp/read_wav_stream.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "src/dsp/logging.h"
+#include "src/dsp/serialize.h"
+
+#define kWavPcmCode 1
+#define kWavIeeeFloatingPointCode 3
+#define kNumChannels 2
+#define kNumFrames 1000
+#define kSampleRateHz 16000
+
+/* Makes a test signal, a ramp with a different slope in each channel. */
+static double TestSignal(int frame, int channel) {
+  return (channel ? -0.9 : 0.7) * (2.0 * frame / kNumFrames - 1.0);
+}
+
+/* Writes a WAV file of TestSignal() with the specified format. If
+ * `truncate_frames` is positive, the data chunk is written as if it had that
+ * many more frames than it actually does. Returns the expected float samples,
+ * which the caller should free.
+ */
+static float* WriteTestWav(const char* file_name, int format_code,
+                           int bit_depth, int truncate_frames) {
+  const int bytes_per_sample = bit_depth / 8;
+  const int num_samples = kNumFrames * kNumChannels;
+  const uint32_t data_size =
+      (kNumFrames + truncate_frames) * kNumChannels * bytes_per_sample;
+  uint8_t header[44];
+  memcpy(header, "RIFF", 4);
+  LittleEndianWriteU32(36 + data_size, header + 4);
+  memcpy(header + 8, "WAVEfmt ", 8);
+  LittleEndianWriteU32(16, header + 16);
+  LittleEndianWriteU16(format_code, header + 20);
+  LittleEndianWriteU16(kNumChannels, header + 22);
+  LittleEndianWriteU32(kSampleRateHz, header + 24);
+  LittleEndianWriteU32(kSampleRateHz * kNumChannels * bytes_per_sample,
+                       header + 28);
+  LittleEndianWriteU16(kNumChannels * bytes_per_sample, header + 32);
+  LittleEndianWriteU16(bit_depth, header + 34);
+  memcpy(header + 36, "data", 4);
+  LittleEndianWriteU32(data_size, header + 40);
+
+  FILE* f = CHECK_NOTNULL(fopen(file_name, "wb"));
+  CHECK(fwrite(header, 1, sizeof(header), f) == sizeof(header));
+
+  float* expected = (float*)CHECK_NOTNULL(malloc(num_samples * sizeof(float)));
+  int i;
+  for (i = 0; i < num_samples; ++i) {
+    const double x = TestSignal(i / kNumChannels, i % kNumChannels);
+    uint8_t bytes[8];
+    if (format_code == kWavIeeeFloatingPointCode) {
+      if (bit_depth == 32) {
+        LittleEndianWriteF32((float)x, bytes);
+      } else {
+        LittleEndianWriteF64(x, bytes);
+      }
+      expected[i] = (float)x;
+    } else {
+      /* Write int32 value `q` truncated to the top `bit_depth` bits. */
+      const int shift = 32 - bit_depth;
+      const uint32_t u = (uint32_t)(int32_t)(x * 2147483648.0) &
+                         ~((UINT32_C(1) << shift) - 1);
+      const int32_t q = (int32_t)u;
+      int b;
+      for (b = 0; b < bytes_per_sample; ++b) {
+        bytes[b] = (uint8_t)(u >> (shift + 8 * b));
+      }
+      expected[i] = q / 2147483648.0f;
+    }
+    CHECK(fwrite(bytes, 1, bytes_per_sample, f) == (size_t)bytes_per_sample);
+  }
+  fclose(f);
+  return expected;
+}
+
+/* An implementation of standard I/O callbacks. */
+static size_t ReadBytes(void* bytes, size_t num_bytes, void* io_ptr) {
+  return fread(bytes, 1, num_bytes, (FILE*)io_ptr);
+}
+
+static int Seek(size_t num_bytes, void* io_ptr) {
+  return fseek((FILE*)io_ptr, num_bytes, SEEK_CUR);
+}
+
+static int EndOfFile(void* io_ptr) {
+  return feof((FILE*)io_ptr);
+}
+
+/* Reads all blocks from `stream` and checks that they match `expected`. */
+static void CheckStream(ReadWavStream* stream, int frames_per_block,
+                        const float* expected, int expected_frames) {
+  CHECK(ReadWavStreamNumChannels(stream) == kNumChannels);
+  CHECK(ReadWavStreamSampleRateHz(stream) == kSampleRateHz);
+
+  int total_frames = 0;
+  const float* block;
+  int num_frames;
+  while ((block = ReadWavStreamNextBlock(stream, &num_frames)) != NULL) {
+    CHECK(1 <= num_frames && num_frames <= frames_per_block);
+    const int num_samples = num_frames * kNumChannels;
+    int i;
+    for (i = 0; i < num_samples; ++i) {
+      CHECK(block[i] == expected[total_frames * kNumChannels + i]);
+    }
+    for (; i < frames_per_block * kNumChannels; ++i) {
+      CHECK(block[i] == 0.0f);  /* Last block is zero padded. */
+    }
+    total_frames += num_frames;
+  }
+
+  CHECK(total_frames == expected_frames);
+  CHECK(ReadWavStreamNextBlock(stream, &num_frames) == NULL);
+  CHECK(num_frames == 0);
+}
+
+/* Test mapped and chunked streaming for each supported format. */
+static void TestStream(int format_code, int bit_depth) {
+  printf("TestStream(%d, %d)\n", format_code, bit_depth);
+  const int kFramesPerBlock = 64;
+  const char* wav_file_name = CHECK_NOTNULL(tmpnam(NULL));
+  float* expected = WriteTestWav(wav_file_name, format_code, bit_depth, 0);
+
+  /* Mapped implementation. */
+  ReadWavStream* stream =
+      CHECK_NOTNULL(ReadWavStreamOpen(wav_file_name, kFramesPerBlock));
+#if defined(__unix__) || defined(__APPLE__)
+  CHECK(ReadWavStreamIsMapped(stream));
+#endif
+  CheckStream(stream, kFramesPerBlock, expected, kNumFrames);
+  ReadWavStreamClose(stream);
+
+  /* Chunked implementation with custom callbacks. */
+  FILE* f = CHECK_NOTNULL(fopen(wav_file_name, "rb"));
+  WavReader w;
+  w.io_ptr = f;
+  w.read_fun = ReadBytes;
+  w.seek_fun = Seek;
+  w.eof_fun = EndOfFile;
+  w.custom_chunk_fun = NULL;
+  stream = CHECK_NOTNULL(ReadWavStreamOpenGeneric(&w, kFramesPerBlock));
+  CHECK(!ReadWavStreamIsMapped(stream));
+  CheckStream(stream, kFramesPerBlock, expected, kNumFrames);
+  ReadWavStreamClose(stream);
+  fclose(f);
+
+  free(expected);
+  remove(wav_file_name);
+}
+
+/* With a mapped float32 WAV, full blocks point directly into the mapping. */
+static void TestZeroCopyFloat(void) {
+  puts("TestZeroCopyFloat");
+  const int kFramesPerBlock = 100;
+  const char* wav_file_name = CHECK_NOTNULL(tmpnam(NULL));
+  float* expected =
+      WriteTestWav(wav_file_name, kWavIeeeFloatingPointCode, 32, 0);
+
+  ReadWavStream* stream =
+      CHECK_NOTNULL(ReadWavStreamOpen(wav_file_name, kFramesPerBlock));
+  if (ReadWavStreamIsMapped(stream)) {
+    int num_frames;
+    const float* block1 = ReadWavStreamNextBlock(stream, &num_frames);
+    const float* block2 = ReadWavStreamNextBlock(stream, &num_frames);
+    CHECK(block1 != NULL && block2 != NULL);
+    /* Consecutive blocks are adjacent in the mapped file. */
+    CHECK(block2 - block1 == kFramesPerBlock * kNumChannels);
+    CHECK(memcmp(block2, expected + kFramesPerBlock * kNumChannels,
+                 kFramesPerBlock * kNumChannels * sizeof(float)) == 0);
+  }
+  ReadWavStreamClose(stream);
+
+  free(expected);
+  remove(wav_file_name);
+}
+
+/* A truncated data chunk is read up to the end of the file. */
+static void TestTruncatedFile(void) {
+  puts("TestTruncatedFile");
+  const int kFramesPerBlock = 128;
+  const char* wav_file_name = CHECK_NOTNULL(tmpnam(NULL));
+  float* expected = WriteTestWav(wav_file_name, kWavPcmCode, 16, 50);
+
+  ReadWavStream* stream =
+      CHECK_NOTNULL(ReadWavStreamOpen(wav_file_name, kFramesPerBlock));
+  CheckStream(stream, kFramesPerBlock, expected, kNumFrames);
+  ReadWavStreamClose(stream);
+
+  free(expected);
+  remove(wav_file_name);
+}
+
+static void TestOpenFailure(void) {
+  puts("TestOpenFailure");
+  const char* wav_file_name = CHECK_NOTNULL(tmpnam(NULL));
+  CHECK(ReadWavStreamOpen(wav_file_name, 64) == NULL);  /* Nonexistent. */
+
+  FILE* f = CHECK_NOTNULL(fopen(wav_file_name, "wb"));
+  CHECK(fwrite("not a WAV file", 1, 14, f) == 14);
+  fclose(f);
+  CHECK(ReadWavStreamOpen(wav_file_name, 64) == NULL);
+  CHECK(ReadWavStreamOpen(wav_file_name, 0) == NULL);
+  remove(wav_file_name);
+}
+
+int main(int argc, char** argv) {
+  TestStream(kWavPcmCode, 16);
+  TestStream(kWavPcmCode, 24);
+  TestStream(kWavPcmCode, 32);
+  TestStream(kWavIeeeFloatingPointCode, 32);
+  TestStream(kWavIeeeFloatingPointCode, 64);
+  TestZeroCopyFloat();
+  TestTruncatedFile();
+  TestOpenFailure();
+
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
@@ -16,6 +16,7 @@
 #include "src/dsp/serialize.h"
 
 #include <stdlib.h>
+#include <string.h>
 
 #include "src/dsp/logging.h"
 
@@ -235,6 +236,69 @@ static void TestF64(void) {
   }
 }
 
+/* Test that array functions match the corresponding per-value functions. */
+static void TestArrays(void) {
+  puts("TestArrays");
+  enum { kNum = 9 };
+  uint8_t buffer[4 * kNum];
+  uint8_t expected[4 * kNum];
+  int i;
+
+  int16_t s16[kNum];
+  int16_t s16_recovered[kNum];
+  for (i = 0; i < kNum; ++i) {
+    s16[i] = (int16_t)(rand() - RAND_MAX / 2);
+    LittleEndianWriteS16(s16[i], expected + 2 * i);
+  }
+  LittleEndianWriteS16Array(s16, kNum, buffer);
+  CHECK(memcmp(buffer, expected, 2 * kNum) == 0);
+  LittleEndianReadS16Array(buffer, kNum, s16_recovered);
+  CHECK(memcmp(s16_recovered, s16, sizeof(s16)) == 0);
+
+  uint16_t u16[kNum];
+  LittleEndianReadU16Array(buffer, kNum, u16);
+  for (i = 0; i < kNum; ++i) {
+    CHECK(u16[i] == LittleEndianReadU16(buffer + 2 * i));
+  }
+  LittleEndianWriteU16Array(u16, kNum, buffer);
+  CHECK(memcmp(buffer, expected, 2 * kNum) == 0);
+
+  int32_t s32[kNum];
+  int32_t s32_recovered[kNum];
+  for (i = 0; i < kNum; ++i) {
+    s32[i] = (int32_t)(rand() - RAND_MAX / 2);
+    LittleEndianWriteS32(s32[i], expected + 4 * i);
+  }
+  LittleEndianWriteS32Array(s32, kNum, buffer);
+  CHECK(memcmp(buffer, expected, 4 * kNum) == 0);
+  LittleEndianReadS32Array(buffer, kNum, s32_recovered);
+  CHECK(memcmp(s32_recovered, s32, sizeof(s32)) == 0);
+
+  uint32_t u32[kNum];
+  LittleEndianReadU32Array(buffer, kNum, u32);
+  for (i = 0; i < kNum; ++i) {
+    CHECK(u32[i] == LittleEndianReadU32(buffer + 4 * i));
+  }
+  LittleEndianWriteU32Array(u32, kNum, buffer);
+  CHECK(memcmp(buffer, expected, 4 * kNum) == 0);
+
+  float f32[kNum];
+  float f32_recovered[kNum];
+  for (i = 0; i < kNum; ++i) {
+    f32[i] = (float)rand() / RAND_MAX - 0.5f;
+    LittleEndianWriteF32(f32[i], expected + 4 * i);
+  }
+  LittleEndianWriteF32Array(f32, kNum, buffer);
+  CHECK(memcmp(buffer, expected, 4 * kNum) == 0);
+  LittleEndianReadF32Array(buffer, kNum, f32_recovered);
+  CHECK(memcmp(f32_recovered, f32, sizeof(f32)) == 0);
+
+  /* Unaligned byte buffers are supported. */
+  LittleEndianWriteF32Array(f32, kNum - 1, buffer + 1);
+  LittleEndianReadF32Array(buffer + 1, kNum - 1, f32_recovered);
+  CHECK(memcmp(f32_recovered, f32, sizeof(float) * (kNum - 1)) == 0);
+}
+
 /* A "naive" implementation of Fletcher-8 with modulo by 15 on every step. */
 static uint8_t Fletcher8Naive(const uint8_t* data, size_t size) {
   int sum1 = 1;
@@ -334,6 +398,21 @@ static void TestFletcher16(void) {
   }
   CHECK(streaming == nonstreaming);
 
+  /* Check short inputs of all lengths mod 4, and Fletcher16Copy(). */
+  uint8_t* copy = (uint8_t*)CHECK_NOTNULL(malloc(size));
+  int n;
+  for (n = 0; n <= 300; ++n) {
+    const uint8_t* src = data + rand() % 100;
+    const uint16_t expected = Fletcher16Naive(src, n);
+    CHECK(Fletcher16(src, n, 1) == expected);
+    memset(copy, 0, n);
+    CHECK(Fletcher16Copy(copy, src, n, 1) == expected);
+    CHECK(memcmp(copy, src, n) == 0);
+  }
+  CHECK(Fletcher16Copy(copy, data, size, 1) == nonstreaming);
+  CHECK(memcmp(copy, data, size) == 0);
+
+  free(copy);
   free(data);
 }
 
@@ -347,6 +426,7 @@ int main(int argc, char** argv) {
   TestS64();
   TestF32();
   TestF64();
+  TestArrays();
   TestFletcher8();
   TestFletcher16();
 
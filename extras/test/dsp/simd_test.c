@@ -0,0 +1,220 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "src/dsp/simd.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "src/dsp/logging.h"
+
+static void CheckFloat4(Float4 actual, float x0, float x1, float x2, float x3) {
+  CHECK(Float4GetLane(actual, 0) == x0);
+  CHECK(Float4GetLane(actual, 1) == x1);
+  CHECK(Float4GetLane(actual, 2) == x2);
+  CHECK(Float4GetLane(actual, 3) == x3);
+}
+
+static void TestLoadStore(void) {
+  puts("TestLoadStore");
+  /* Use an offset to test unaligned loads and stores. */
+  float buffer[6] = {0.0f, 1.0f, -2.0f, 3.5f, 4.0f, 0.0f};
+  Float4 a = Float4Load(buffer + 1);
+  CheckFloat4(a, 1.0f, -2.0f, 3.5f, 4.0f);
+
+  Float4Store(buffer + 2, Float4Broadcast(7.0f));
+  CHECK(buffer[1] == 1.0f);
+  CHECK(buffer[2] == 7.0f);
+  CHECK(buffer[5] == 7.0f);
+}
+
+static void TestArithmetic(void) {
+  puts("TestArithmetic");
+  const float values_a[4] = {1.0f, -2.0f, 3.5f, 0.0f};
+  const float values_b[4] = {0.5f, 4.0f, -1.0f, -0.25f};
+  const Float4 a = Float4Load(values_a);
+  const Float4 b = Float4Load(values_b);
+
+  CheckFloat4(Float4Add(a, b), 1.5f, 2.0f, 2.5f, -0.25f);
+  CheckFloat4(Float4Sub(a, b), 0.5f, -6.0f, 4.5f, 0.25f);
+  CheckFloat4(Float4Mul(a, b), 0.5f, -8.0f, -3.5f, 0.0f);
+  CheckFloat4(Float4Min(a, b), 0.5f, -2.0f, -1.0f, -0.25f);
+  CheckFloat4(Float4Max(a, b), 1.0f, 4.0f, 3.5f, 0.0f);
+  CheckFloat4(Float4Div(a, b), 2.0f, -0.5f, -3.5f, 0.0f);
+}
+
+static void CheckInt4(Int4 actual, int32_t x0, int32_t x1, int32_t x2,
+                      int32_t x3) {
+  CHECK(Int4GetLane(actual, 0) == x0);
+  CHECK(Int4GetLane(actual, 1) == x1);
+  CHECK(Int4GetLane(actual, 2) == x2);
+  CHECK(Int4GetLane(actual, 3) == x3);
+}
+
+static void TestInt4(void) {
+  puts("TestInt4");
+  const float values[4] = {1.0f, -2.0f, 0.75f, 0.0f};
+  const Int4 a = Float4AsInt4(Float4Load(values));
+  CheckInt4(a, 0x3F800000, (int32_t)0xC0000000, 0x3F400000, 0);
+  CheckFloat4(Int4AsFloat4(a), 1.0f, -2.0f, 0.75f, 0.0f);
+
+  const Int4 b = Int4Sub(Int4ShiftRight(a, 23), Int4Broadcast(127));
+  CheckInt4(b, 0, -255, -1, -127);
+  CheckFloat4(Int4ToFloat4(b), 0.0f, -255.0f, -1.0f, -127.0f);
+  const float to_int_values[4] = {1.7f, -2.7f, 0.5f, -3e9f / 2};
+  CheckInt4(Float4ToInt4(Float4Load(to_int_values)), 1, -2, 0, -1500000000);
+  CheckInt4(Int4Add(b, Int4Broadcast(5)), 5, -250, 4, -122);
+  CheckInt4(Int4ShiftLeft(b, 3), 0, -2040, -8, -1016);
+  CheckInt4(Int4And(a, Int4Broadcast(0x7FFFFF)), 0, 0, 0x400000, 0);
+  CheckInt4(Int4Or(b, Int4Broadcast(1)), 1, -255, -1, -127);
+
+  /* Use an offset to test unaligned loads and stores. */
+  int32_t buffer[6] = {0, 5, -6, 7, (int32_t)0x80000000, 0};
+  CheckInt4(Int4Load(buffer + 1), 5, -6, 7, (int32_t)0x80000000);
+  Int4Store(buffer + 2, Int4Broadcast(-3));
+  CHECK(buffer[1] == 5);
+  CHECK(buffer[2] == -3);
+  CHECK(buffer[5] == -3);
+
+  const int16_t int16_values[5] = {0, -32768, 32767, -1, 123};
+  CheckInt4(Int4LoadInt16(int16_values + 1), -32768, 32767, -1, 123);
+  buffer[0] = -40000;
+  buffer[1] = 40000;
+  buffer[2] = -5;
+  buffer[3] = 65535;
+  int16_t int16_out[5] = {0, 0, 0, 0, 99};
+  Int4StoreInt16Saturate(int16_out, Int4Load(buffer));
+  CHECK(int16_out[0] == -32768);
+  CHECK(int16_out[1] == 32767);
+  CHECK(int16_out[2] == -5);
+  CHECK(int16_out[3] == 32767);
+  CHECK(int16_out[4] == 99);
+  uint16_t uint16_out[5] = {0, 0, 0, 0, 99};
+  Int4StoreUint16Saturate(uint16_out, Int4Load(buffer));
+  CHECK(uint16_out[0] == 0);
+  CHECK(uint16_out[1] == 40000);
+  CHECK(uint16_out[2] == 0);
+  CHECK(uint16_out[3] == 65535);
+  CHECK(uint16_out[4] == 99);
+  Int4StoreUint16Saturate(uint16_out, Int4Broadcast(70000));
+  CHECK(uint16_out[0] == 65535);
+}
+
+static void TestShiftLanesUp(void) {
+  puts("TestShiftLanesUp");
+  const float values[4] = {1.0f, -2.0f, 3.5f, 4.0f};
+  const Float4 a = Float4Load(values);
+  CheckFloat4(Float4ShiftLanesUp(a, 9.0f), 9.0f, 1.0f, -2.0f, 3.5f);
+  CheckFloat4(Float4ShiftLanesUp(Float4ShiftLanesUp(a, 9.0f), -5.0f),
+              -5.0f, 9.0f, 1.0f, -2.0f);
+}
+
+static void TestShiftLanesDown(void) {
+  puts("TestShiftLanesDown");
+  const float values[4] = {1.0f, -2.0f, 3.5f, 4.0f};
+  const Float4 a = Float4Load(values);
+  CheckFloat4(Float4ShiftLanesDown(a, 9.0f), -2.0f, 3.5f, 4.0f, 9.0f);
+  CheckFloat4(Float4ShiftLanesDown(Float4ShiftLanesDown(a, 9.0f), -5.0f),
+              3.5f, 4.0f, 9.0f, -5.0f);
+}
+
+static void TestPairOps(void) {
+  puts("TestPairOps");
+  const float values_a[4] = {1.0f, -2.0f, 3.5f, 4.0f};
+  const float values_b[4] = {0.5f, 6.0f, -7.0f, 8.25f};
+  const Float4 a = Float4Load(values_a);
+  const Float4 b = Float4Load(values_b);
+  CheckFloat4(Float4SwapPairs(a), -2.0f, 1.0f, 4.0f, 3.5f);
+  CheckFloat4(Float4DupEven(a), 1.0f, 1.0f, 3.5f, 3.5f);
+  CheckFloat4(Float4DupOdd(a), -2.0f, -2.0f, 4.0f, 4.0f);
+  CheckFloat4(Float4PairwiseAdd(a, b), -1.0f, 7.5f, 6.5f, 1.25f);
+}
+
+static void TestCompareSelect(void) {
+  puts("TestCompareSelect");
+  const float nan_value = (float)sqrt(-1.0);
+  const float values_a[4] = {1.0f, -2.0f, 3.5f, nan_value};
+  const float values_b[4] = {0.5f, -2.0f, 4.0f, 0.0f};
+  const Float4 a = Float4Load(values_a);
+  const Float4 b = Float4Load(values_b);
+  CheckInt4(Float4LessThan(a, b), 0, 0, -1, 0);
+  CheckInt4(Float4LessEqual(a, b), 0, -1, -1, 0);
+  CheckInt4(Float4LessThan(b, a), -1, 0, 0, 0);
+  CheckFloat4(Float4Select(Float4LessThan(a, b), a, b), 0.5f, -2.0f, 3.5f,
+              0.0f);
+  const Float4 c = Float4Select(Float4LessEqual(a, b), b, a);
+  CHECK(Float4GetLane(c, 0) == 1.0f);
+  CHECK(Float4GetLane(c, 1) == -2.0f);
+  CHECK(Float4GetLane(c, 2) == 4.0f);
+  const float nan_lane = Float4GetLane(c, 3);
+  CHECK(nan_lane != nan_lane);  /* Check that lane is NaN. */
+}
+
+/* Min and max return the second argument if either argument is NaN. */
+static void TestMinMaxNan(void) {
+  puts("TestMinMaxNan");
+  const float nan_value = (float)sqrt(-1.0);
+  const Float4 nan4 = Float4Broadcast(nan_value);
+  const Float4 one = Float4Broadcast(1.0f);
+  CHECK(Float4GetLane(Float4Max(nan4, one), 0) == 1.0f);
+  CHECK(Float4GetLane(Float4Min(nan4, one), 1) == 1.0f);
+  const float max_value = Float4GetLane(Float4Max(one, nan4), 2);
+  CHECK(max_value != max_value);  /* Check that max_value is NaN. */
+  const float min_value = Float4GetLane(Float4Min(one, nan4), 3);
+  CHECK(min_value != min_value);
+}
+
+/* Vector arithmetic should match scalar arithmetic exactly. */
+static void TestMatchesScalar(void) {
+  puts("TestMatchesScalar");
+  srand(0);
+  int trial;
+  for (trial = 0; trial < 1000; ++trial) {
+    float values_a[4];
+    float values_b[4];
+    float values_c[4];
+    int i;
+    for (i = 0; i < 4; ++i) {
+      values_a[i] = (float)rand() / RAND_MAX - 0.5f;
+      values_b[i] = (float)rand() / RAND_MAX - 0.5f;
+      values_c[i] = (float)rand() / RAND_MAX - 0.5f;
+    }
+    float result[4];
+    Float4Store(result, Float4Sub(
+        Float4Mul(Float4Load(values_a), Float4Load(values_b)),
+        Float4Load(values_c)));
+    for (i = 0; i < 4; ++i) {
+      const float expected = values_a[i] * values_b[i] - values_c[i];
+      CHECK(result[i] == expected);
+    }
+  }
+}
+
+int main(int argc, char** argv) {
+  printf("Float4 implementation: %s\n", kFloat4Implementation);
+  TestLoadStore();
+  TestArithmetic();
+  TestInt4();
+  TestShiftLanesUp();
+  TestShiftLanesDown();
+  TestPairOps();
+  TestCompareSelect();
+  TestMinMaxNan();
+  TestMatchesScalar();
+
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,234 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "src/dsp/stft.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "src/dsp/logging.h"
+#include "src/dsp/math_constants.h"
+
+#define kSampleRateHz 16000.0f
+
+static float RandUniform(float min_value, float max_value) {
+  return min_value + (max_value - min_value) * ((float)rand() / RAND_MAX);
+}
+
+static float* MakeRandomInput(int num_samples) {
+  float* input = (float*)CHECK_NOTNULL(malloc(sizeof(float) * num_samples));
+  int n;
+  for (n = 0; n < num_samples; ++n) {
+    input[n] = RandUniform(-1.0f, 1.0f);
+  }
+  return input;
+}
+
+/* Power spectrum frames match a direct DFT of the Hann-windowed input. */
+static void TestMatchesDirectDft(int frame_size, int hop_size) {
+  printf("TestMatchesDirectDft(%d, %d)\n", frame_size, hop_size);
+  const int kNumSamples = 1000;
+  float* input = MakeRandomInput(kNumSamples);
+  Stft* stft = CHECK_NOTNULL(StftMake(kSampleRateHz, frame_size, hop_size,
+                                      NULL));
+  const int num_bins = StftNumOutputs(stft);
+  CHECK(num_bins == frame_size / 2 + 1);
+  CHECK(fabs(StftOutputFrequencyHz(stft, 1) - kSampleRateHz / frame_size)
+        < 1e-3f);
+
+  const int num_frames = StftNextNumFrames(stft, kNumSamples);
+  CHECK(num_frames == (kNumSamples - frame_size) / hop_size + 1);
+  float* output = (float*)CHECK_NOTNULL(
+      malloc(sizeof(float) * num_frames * num_bins));
+  CHECK(StftProcessSamples(stft, input, kNumSamples, output) == num_frames);
+
+  double window_sum = 0.0;
+  int n;
+  for (n = 0; n < frame_size; ++n) {
+    window_sum += 0.5 - 0.5 * cos(2.0 * M_PI * n / frame_size);
+  }
+
+  int i;
+  for (i = 0; i < num_frames; ++i) {
+    const float* frame = input + i * hop_size;
+    double max_power = 0.0;
+    double max_diff = 0.0;
+    int k;
+    for (k = 0; k < num_bins; ++k) {
+      double real = 0.0;
+      double imag = 0.0;
+      for (n = 0; n < frame_size; ++n) {
+        const double w = 0.5 - 0.5 * cos(2.0 * M_PI * n / frame_size);
+        const double theta = 2.0 * M_PI * k * n / frame_size;
+        real += w * frame[n] * cos(theta);
+        imag -= w * frame[n] * sin(theta);
+      }
+      const double expected =
+          (real * real + imag * imag) / (window_sum * window_sum);
+      const double diff = fabs(output[i * num_bins + k] - expected);
+      if (expected > max_power) { max_power = expected; }
+      if (diff > max_diff) { max_diff = diff; }
+    }
+    CHECK(max_diff <= 1e-4 * max_power);
+  }
+
+  free(output);
+  StftFree(stft);
+  free(input);
+}
+
+/* A sinusoid of amplitude A centered on a bin has power A^2 / 4 there. */
+static void TestSinusoidPower(void) {
+  puts("TestSinusoidPower");
+  const int kFrameSize = 256;
+  const int kBin = 20;
+  const float kAmplitude = 0.5f;
+  float input[256];
+  int n;
+  for (n = 0; n < kFrameSize; ++n) {
+    input[n] = kAmplitude * cos(2.0 * M_PI * kBin * n / kFrameSize + 0.3);
+  }
+  Stft* stft = CHECK_NOTNULL(StftMake(kSampleRateHz, kFrameSize, 64, NULL));
+  float output[129];
+  CHECK(StftProcessSamples(stft, input, kFrameSize, output) == 1);
+
+  CHECK(fabs(output[kBin] - kAmplitude * kAmplitude / 4) < 1e-5f);
+  /* The Hann window's mainlobe spans two bins on either side. */
+  int k;
+  for (k = 0; k < 129; ++k) {
+    if (abs(k - kBin) > 1) { CHECK(output[k] < 1e-8f); }
+  }
+
+  StftFree(stft);
+}
+
+/* Streaming in chunks of random sizes gives the same output as processing the
+ * whole input at once.
+ */
+static void TestStreaming(StftPooling pooling) {
+  printf("TestStreaming(%d)\n", (int)pooling);
+  const int kNumSamples = 3000;
+  float* input = MakeRandomInput(kNumSamples);
+  StftOptions options = kStftDefaultOptions;
+  options.pooling = pooling;
+  options.num_bands = 24;
+  Stft* stft = CHECK_NOTNULL(StftMake(kSampleRateHz, 512, 160, &options));
+  const int num_outputs = StftNumOutputs(stft);
+  const int num_frames = StftNextNumFrames(stft, kNumSamples);
+  float* expected = (float*)CHECK_NOTNULL(
+      malloc(sizeof(float) * num_frames * num_outputs));
+  float* output = (float*)CHECK_NOTNULL(
+      malloc(sizeof(float) * num_frames * num_outputs));
+  CHECK(StftProcessSamples(stft, input, kNumSamples, expected) == num_frames);
+
+  StftReset(stft);
+  int total_frames = 0;
+  int start = 0;
+  while (start < kNumSamples) {
+    int count = rand() % 400;
+    if (count > kNumSamples - start) { count = kNumSamples - start; }
+    const int frames = StftNextNumFrames(stft, count);
+    CHECK(StftProcessSamples(stft, input + start,
+                             count, output + total_frames * num_outputs)
+          == frames);
+    total_frames += frames;
+    start += count;
+  }
+  CHECK(total_frames == num_frames);
+  int i;
+  for (i = 0; i < num_frames * num_outputs; ++i) {
+    CHECK(output[i] == expected[i]);
+  }
+
+  free(output);
+  free(expected);
+  StftFree(stft);
+  free(input);
+}
+
+/* With pooling, a sinusoid's energy is in the band nearest its frequency. */
+static void TestPooling(StftPooling pooling) {
+  printf("TestPooling(%d)\n", (int)pooling);
+  StftOptions options = kStftDefaultOptions;
+  options.pooling = pooling;
+  options.num_bands = 32;
+  options.min_frequency_hz = 50.0f;
+  options.max_frequency_hz = 7000.0f;
+  Stft* stft = CHECK_NOTNULL(StftMake(kSampleRateHz, 1024, 256, &options));
+  CHECK(StftNumOutputs(stft) == 32);
+
+  int b;
+  for (b = 0; b < 32; ++b) {
+    const float center_hz = StftOutputFrequencyHz(stft, b);
+    CHECK(50.0f < center_hz && center_hz < 7000.0f);
+    if (b > 0) { CHECK(center_hz > StftOutputFrequencyHz(stft, b - 1)); }
+  }
+
+  const int kTestBands[3] = {5, 16, 30};
+  int t;
+  for (t = 0; t < 3; ++t) {
+    const double frequency_hz = StftOutputFrequencyHz(stft, kTestBands[t]);
+    float input[1024];
+    int n;
+    for (n = 0; n < 1024; ++n) {
+      input[n] = sin(2.0 * M_PI * frequency_hz * n / kSampleRateHz);
+    }
+    float output[32];
+    StftReset(stft);
+    CHECK(StftProcessSamples(stft, input, 1024, output) == 1);
+    int max_band = 0;
+    for (b = 1; b < 32; ++b) {
+      if (output[b] > output[max_band]) { max_band = b; }
+    }
+    CHECK(max_band == kTestBands[t]);
+  }
+
+  StftFree(stft);
+}
+
+static void TestInvalidArgs(void) {
+  puts("TestInvalidArgs");
+  CHECK(StftMake(kSampleRateHz, 100, 50, NULL) == NULL);  /* Not power of 2. */
+  CHECK(StftMake(kSampleRateHz, 2, 1, NULL) == NULL);
+  CHECK(StftMake(kSampleRateHz, 256, 0, NULL) == NULL);
+  CHECK(StftMake(kSampleRateHz, 256, 257, NULL) == NULL);
+  CHECK(StftMake(0.0f, 256, 64, NULL) == NULL);
+
+  StftOptions options = kStftDefaultOptions;
+  options.pooling = kStftMelPooling;
+  options.num_bands = 0;
+  CHECK(StftMake(kSampleRateHz, 256, 64, &options) == NULL);
+  options.num_bands = 10;
+  options.max_frequency_hz = 9000.0f;  /* Above Nyquist. */
+  CHECK(StftMake(kSampleRateHz, 256, 64, &options) == NULL);
+}
+
+int main(int argc, char** argv) {
+  srand(0);
+  TestMatchesDirectDft(64, 64);
+  TestMatchesDirectDft(128, 37);
+  TestMatchesDirectDft(256, 64);
+  TestSinusoidPower();
+  TestStreaming(kStftNoPooling);
+  TestStreaming(kStftMelPooling);
+  TestStreaming(kStftErbPooling);
+  TestPooling(kStftMelPooling);
+  TestPooling(kStftErbPooling);
+  TestInvalidArgs();
+
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
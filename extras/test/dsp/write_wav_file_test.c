@@ -18,6 +18,7 @@
 #include <string.h>
 
 #include "src/dsp/logging.h"
+#include "src/dsp/read_wav_file.h"
 #include "src/dsp/write_wav_file_generic.h"
 
 /*
@@ -87,6 +88,19 @@ static const uint8_t kTest24BitMonoOddWavFile[90] = {
 /*                                          pad */
     0,  7,  0,  0,  254, 255, 0,  255, 127, 0};
 
+/* A 48kHz mono WAV file with float samples {0.5f, -1.0f}. */
+static const uint8_t kTestFloatMonoWavFile[88] = {
+/*  R   I   F   F                      W    A    V    E    f    m    t    _  */
+    82, 73, 70, 70, 80,  0,   0,  0,   87,  65,  86,  69,  102, 109, 116, 32,
+    40, 0,  0,  0,  254, 255, 1,  0,   128, 187, 0,   0,   0,   238, 2,   0,
+/*                                                 float                     */
+    4,  0,  32, 0,  22,  0,   32, 0,   4,   0,   0,   0,   3,   0,   0,   0,
+/*                                                         f    a    c    t  */
+    0,  0,  16, 0,  128, 0,   0,  170, 0,   56,  155, 113, 102, 97,  99,  116,
+/*                                     d    a    t    a  */
+    4,  0,  0,  0,  2,   0,   0,  0,   100, 97,  116, 97,  8,   0,   0,   0,
+    0,  0,  0,  63, 0,   0,   128, 191};
+
 static void CheckFileBytes(const char* file_name, const uint8_t* expected_bytes,
                            size_t num_bytes) {
   uint8_t* bytes = CHECK_NOTNULL((uint8_t *) malloc(num_bytes + 1));
@@ -174,12 +188,86 @@ static void TestWriteMono24BitWavPadding(void) {
   remove(wav_file_name);
 }
 
+static void TestWriteMonoFloatWav(void) {
+  puts("TestWriteMonoFloatWav");
+  static const float kSamples[2] = {0.5f, -1.0f};
+  const char* wav_file_name = NULL;
+
+  wav_file_name = CHECK_NOTNULL(tmpnam(NULL));
+  CHECK(WriteWavFileFloat(wav_file_name, kSamples, 2, 48000, 1));
+
+  CheckFileBytes(wav_file_name, kTestFloatMonoWavFile, 88);
+  remove(wav_file_name);
+}
+
+/* An RF64-capable header for a small file is a standard header plus a JUNK
+ * chunk. Streaming rewrites it in place.
+ */
+static void TestWriteRf64HeaderSmall(void) {
+  puts("TestWriteRf64HeaderSmall");
+  static const int16_t kSamples[4] = {7, -2, INT16_MAX, INT16_MIN};
+  const char* wav_file_name = NULL;
+
+  wav_file_name = CHECK_NOTNULL(tmpnam(NULL));
+  FILE* f = NULL;
+  CHECK(f = fopen(wav_file_name, "wb"));
+  CHECK(WriteWavHeaderRf64(f, 0, 48000, 1, kWavInt16Format));
+  CHECK(WriteWavSamples(f, kSamples, 4));
+  fseek(f, 0, SEEK_SET);
+  CHECK(WriteWavHeaderRf64(f, 4, 48000, 1, kWavInt16Format));
+  fclose(f);
+
+  /* Same as kTestMonoWavFile, with RIFF size increased by 36 for JUNK. */
+  uint8_t expected[52 + 36];
+  memcpy(expected, kTestMonoWavFile, 12);
+  expected[4] += 36;
+  memcpy(expected + 12, "JUNK\x1c\0\0\0", 8);
+  memset(expected + 20, 0, 28);
+  memcpy(expected + 48, kTestMonoWavFile + 12, 40);
+  CheckFileBytes(wav_file_name, expected, 52 + 36);
+  remove(wav_file_name);
+}
+
+/* A header for more than 4 GB of data is RF64, and reads back. */
+static void TestWriteRf64HeaderLarge(void) {
+  puts("TestWriteRf64HeaderLarge");
+  const uint64_t kNumSamples = UINT64_C(3000000000);  /* 12 GB of floats. */
+  const char* wav_file_name = NULL;
+
+  wav_file_name = CHECK_NOTNULL(tmpnam(NULL));
+  FILE* f = NULL;
+  CHECK(f = fopen(wav_file_name, "wb"));
+  /* A standard header can't represent this size. */
+  CHECK(!WriteWavHeaderFloat(f, kNumSamples, 48000, 2));
+  CHECK(WriteWavHeaderRf64(f, kNumSamples, 48000, 2, kWavFloat32Format));
+  fclose(f);
+
+  uint8_t header[12];
+  CHECK(f = fopen(wav_file_name, "rb"));
+  CHECK(fread(header, 1, 12, f) == 12);
+  CHECK(memcmp(header, "RF64\xff\xff\xff\xffWAVE", 12) == 0);
+  if (sizeof(size_t) >= 8) {
+    fseek(f, 0, SEEK_SET);
+    ReadWavInfo info;
+    CHECK(ReadWavHeader(f, &info));
+    CHECK(info.num_channels == 2);
+    CHECK(info.sample_rate_hz == 48000);
+    CHECK(info.encoding == kIeeeFloat32Encoding);
+    CHECK((uint64_t)info.remaining_samples == kNumSamples);
+  }
+  fclose(f);
+  remove(wav_file_name);
+}
+
 int main(int argc, char** argv) {
   TestWriteMonoWav();
   TestWriteMonoWavStreaming();
   TestWrite3ChannelWav();
   TestWriteMono24BitWav();
   TestWriteMono24BitWavPadding();
+  TestWriteMonoFloatWav();
+  TestWriteRf64HeaderSmall();
+  TestWriteRf64HeaderLarge();
 
   puts("PASS");
   return EXIT_SUCCESS;
@@ -16,7 +16,11 @@
 #include "src/frontend/carl_frontend.h"
 
 #include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
 
+#include "src/dsp/arena.h"
 #include "src/dsp/complex.h"
 #include "src/dsp/logging.h"
 #include "src/dsp/math_constants.h"
@@ -42,9 +46,10 @@ static double GammaFilterFrequencyMagnitudeResponse(
 }
 
 /* Tests CarlFrontend filter design. */
-static void TestDesign(void) {
-  puts("TestDesign");
+static void TestDesign(float min_samples_per_cycle) {
+  printf("TestDesign(%g)\n", min_samples_per_cycle);
   CarlFrontendParams params = kCarlFrontendDefaultParams;
+  params.min_samples_per_cycle = min_samples_per_cycle;
   CarlFrontend* frontend = CHECK_NOTNULL(CarlFrontendMake(&params));
 
   const int num_channels = CarlFrontendNumChannels(frontend);
@@ -61,6 +66,7 @@ static void TestDesign(void) {
     const CarlFrontendChannelData* channel_data = &frontend->channel_data[c];
     if (channel_data->should_decimate) {
       sample_rate_hz /= 2;
+      CHECK(sample_rate_hz > min_samples_per_cycle * pole);
     }
     CHECK(sample_rate_hz >= output_sample_rate_hz);
 
@@ -115,9 +121,10 @@ static float FindMax(const float* values, int size, int* max_index) {
 }
 
 /* Tests response to sine wave inputs. */
-static void TestResponse(void) {
-  puts("TestResponse");
+static void TestResponse(float min_samples_per_cycle) {
+  printf("TestResponse(%g)\n", min_samples_per_cycle);
   CarlFrontendParams params = kCarlFrontendDefaultParams;
+  params.min_samples_per_cycle = min_samples_per_cycle;
   CarlFrontend* frontend = CHECK_NOTNULL(CarlFrontendMake(&params));
 
   const float dt = 1.0f / params.input_sample_rate_hz;
@@ -182,6 +189,291 @@ static void TestResponse(void) {
   CarlFrontendFree(frontend);
 }
 
+/* Reference implementation of the CARL cascade and energy envelopes, running
+ * each channel over the whole block before the next.
+ */
+static void ReferenceCascade(CarlFrontend* frontend, float* input) {
+  int stride = 1;
+  int c;
+  for (c = 0; c < frontend->num_channels; ++c) {
+    const CarlFrontendChannelData* data = &frontend->channel_data[c];
+    if (data->should_decimate) {
+      stride *= 2;
+    }
+    BiquadFilterState biquad_state;
+    biquad_state.z[0] = frontend->biquad_z0[c];
+    biquad_state.z[1] = frontend->biquad_z1[c];
+
+    int i;
+    for (i = 0; i < frontend->block_size; i += stride) {
+      const float biquad_output = BiquadFilterProcessOneSample(
+          &data->biquad_coeffs, &biquad_state, input[i]);
+      input[i] = biquad_output;
+      const float carl_output = biquad_output - frontend->diff_state[c];
+      frontend->diff_state[c] = biquad_output;
+      const float energy = (carl_output > 0.0f)
+          ? carl_output * carl_output : 0.0f;
+      frontend->energy_envelope_stage1[c] += data->envelope_smoother_coeff * (
+          energy - frontend->energy_envelope_stage1[c]);
+      frontend->energy_envelope[c] += data->envelope_smoother_coeff * (
+          frontend->energy_envelope_stage1[c] - frontend->energy_envelope[c]);
+    }
+    frontend->biquad_z0[c] = biquad_state.z[0];
+    frontend->biquad_z1[c] = biquad_state.z[1];
+  }
+}
+
+/* The pipelined cascade in CarlFrontendProcessSamples matches the reference
+ * channel-by-channel implementation exactly.
+ */
+static void TestMatchesReferenceCascade(int block_size) {
+  printf("TestMatchesReferenceCascade(%d)\n", block_size);
+  CarlFrontendParams params = kCarlFrontendDefaultParams;
+  params.block_size = block_size;
+  params.envelope_cutoff_hz = 10.0f;
+  params.pcen_cross_channel_diffusivity = 10.0f;
+  CarlFrontend* frontend = CHECK_NOTNULL(CarlFrontendMake(&params));
+  CarlFrontend* reference = CHECK_NOTNULL(CarlFrontendMake(&params));
+  const int num_channels = CarlFrontendNumChannels(frontend);
+  float* input = (float*)CHECK_NOTNULL(malloc(block_size * sizeof(float)));
+  float* reference_input = (float*)CHECK_NOTNULL(
+      malloc(block_size * sizeof(float)));
+  float* output = (float*)CHECK_NOTNULL(malloc(num_channels * sizeof(float)));
+
+  int block;
+  for (block = 0; block < 20; ++block) {
+    int i;
+    for (i = 0; i < block_size; ++i) {
+      input[i] = reference_input[i] = 2.0f * ((float)rand() / RAND_MAX) - 1.0f;
+    }
+
+    CarlFrontendProcessSamples(frontend, input, output);
+    ReferenceCascade(reference, reference_input);
+
+    for (i = 0; i < block_size; ++i) {
+      CHECK(input[i] == reference_input[i]);
+    }
+    int c;
+    for (c = 0; c < num_channels; ++c) {
+      CHECK(frontend->biquad_z0[c] == reference->biquad_z0[c]);
+      CHECK(frontend->biquad_z1[c] == reference->biquad_z1[c]);
+      CHECK(frontend->diff_state[c] == reference->diff_state[c]);
+      CHECK(frontend->energy_envelope_stage1[c] ==
+            reference->energy_envelope_stage1[c]);
+      CHECK(frontend->energy_envelope[c] == reference->energy_envelope[c]);
+    }
+  }
+
+  free(output);
+  free(reference_input);
+  free(input);
+  CarlFrontendFree(reference);
+  CarlFrontendFree(frontend);
+}
+
+/* The vectorized PCEN stage matches a scalar reference. `step_erbs` is varied
+ * to test numbers of channels that are and aren't multiples of four. By
+ * default, compression matches the scalar formula exactly. With
+ * vectorized_pcen_compression, it is close to the exact formula.
+ */
+static void TestPcenMatchesReference(float step_erbs,
+                                     int vectorized_pcen_compression) {
+  printf("TestPcenMatchesReference(%g, %d)\n", step_erbs,
+         vectorized_pcen_compression);
+  CarlFrontendParams params = kCarlFrontendDefaultParams;
+  params.step_erbs = step_erbs;
+  params.vectorized_pcen_compression = vectorized_pcen_compression;
+  CarlFrontend* frontend = CHECK_NOTNULL(CarlFrontendMake(&params));
+  const int block_size = params.block_size;
+  const int num_channels = CarlFrontendNumChannels(frontend);
+  float* input = (float*)CHECK_NOTNULL(malloc(block_size * sizeof(float)));
+  float* output = (float*)CHECK_NOTNULL(malloc(num_channels * sizeof(float)));
+  float* denom = (float*)CHECK_NOTNULL(malloc(num_channels * sizeof(float)));
+  const float alpha = params.pcen_alpha;
+  const float beta = params.pcen_beta;
+  const float gamma = params.pcen_gamma;
+  const float delta = params.pcen_delta;
+
+  int block;
+  for (block = 0; block < 20; ++block) {
+    memcpy(denom, frontend->pcen_denom, num_channels * sizeof(float));
+    int i;
+    for (i = 0; i < block_size; ++i) {
+      input[i] = 0.2f * ((float)rand() / RAND_MAX - 0.5f);
+    }
+    CarlFrontendProcessSamples(frontend, input, output);
+
+    /* Reference PCEN denominator update and cross-channel smoothing. */
+    const float* envelope = frontend->energy_envelope;
+    const float coeff = frontend->pcen_cross_channel_smoother_coeff;
+    int c;
+    for (c = 0; c < num_channels; ++c) {
+      denom[c] += frontend->pcen_smoother_coeff * (envelope[c] - denom[c]);
+    }
+    float left_flux;
+    float right_flux = denom[1] - denom[0];
+    denom[0] += coeff * right_flux;
+    for (c = 1; c < num_channels - 1; ++c) {
+      left_flux = right_flux;
+      right_flux = denom[c + 1] - denom[c];
+      denom[c] += coeff * (right_flux - left_flux);
+    }
+    denom[c] -= coeff * right_flux;
+
+    for (c = 0; c < num_channels; ++c) {
+      CHECK(frontend->pcen_denom[c] == denom[c]);
+      if (vectorized_pcen_compression) {
+        const float expected = pow(
+            envelope[c] / pow(gamma + denom[c], alpha) + delta, beta) -
+            pow(delta, beta);
+        CHECK(fabs(output[c] - expected) <= 2e-4f);
+      } else {
+        CHECK(output[c] ==
+              CarlFrontendPcenCompression(frontend, envelope[c], denom[c]));
+      }
+      CHECK(output[c] >= 0.0f);
+    }
+  }
+
+  free(denom);
+  free(output);
+  free(input);
+  CarlFrontendFree(frontend);
+}
+
+/* Smaller min_samples_per_cycle decimates more, for fewer filter evaluations,
+ * while the output stays close to the default.
+ */
+static void TestAggressiveDecimation(void) {
+  puts("TestAggressiveDecimation");
+  const int kNumBlocks = 100;
+  CarlFrontendParams params = kCarlFrontendDefaultParams;
+  CarlFrontend* frontend = CHECK_NOTNULL(CarlFrontendMake(&params));
+  const int block_size = params.block_size;
+  const int num_channels = CarlFrontendNumChannels(frontend);
+  /* All channels at the full rate would be 56 * 64 = 3584 evaluations. */
+  CHECK(CarlFrontendFilterEvaluationsPerBlock(frontend) == 2316);
+
+  params.min_samples_per_cycle = 3.0f;
+  CarlFrontend* aggressive = CHECK_NOTNULL(CarlFrontendMake(&params));
+  CHECK(CarlFrontendNumChannels(aggressive) == num_channels);
+  CHECK(CarlFrontendFilterEvaluationsPerBlock(aggressive) == 1702);
+
+  float* input = (float*)CHECK_NOTNULL(malloc(block_size * sizeof(float)));
+  float* input_copy = (float*)CHECK_NOTNULL(
+      malloc(block_size * sizeof(float)));
+  float* output = (float*)CHECK_NOTNULL(malloc(num_channels * sizeof(float)));
+  float* aggressive_output = (float*)CHECK_NOTNULL(
+      malloc(num_channels * sizeof(float)));
+
+  /* Input is a mix of two tones and noise. */
+  const float dt = 1.0f / params.input_sample_rate_hz;
+  float t = 0.0f;
+  double sum_abs_diff = 0.0;
+  double sum_abs = 0.0;
+  int block;
+  for (block = 0; block < kNumBlocks; ++block) {
+    int i;
+    for (i = 0; i < block_size; ++i, t += dt) {
+      input[i] = input_copy[i] = 0.05f * sin(2 * M_PI * 300.0f * t) +
+          0.05f * sin(2 * M_PI * 2100.0f * t) +
+          0.01f * (2.0f * ((float)rand() / RAND_MAX) - 1.0f);
+    }
+
+    CarlFrontendProcessSamples(frontend, input, output);
+    CarlFrontendProcessSamples(aggressive, input_copy, aggressive_output);
+
+    int c;
+    for (c = 0; c < num_channels; ++c) {
+      sum_abs_diff += fabs(output[c] - aggressive_output[c]);
+      sum_abs += fabs(output[c]);
+    }
+  }
+
+  CHECK(sum_abs_diff <= 0.15 * sum_abs);
+
+  free(aggressive_output);
+  free(output);
+  free(input_copy);
+  free(input);
+  CarlFrontendFree(aggressive);
+  CarlFrontendFree(frontend);
+}
+
+/* A channel subset matches the corresponding channels of the full frontend.
+ * Cross-channel smoothing is disabled, since it is confined to the subset.
+ */
+static void TestChannelSubset(int first_output_channel,
+                              int num_output_channels) {
+  printf("TestChannelSubset(%d, %d)\n",
+         first_output_channel, num_output_channels);
+  const int kNumBlocks = 50;
+  CarlFrontendParams params = kCarlFrontendDefaultParams;
+  params.pcen_cross_channel_diffusivity = 0.0f;
+  CarlFrontend* frontend = CHECK_NOTNULL(CarlFrontendMake(&params));
+  const int block_size = params.block_size;
+  const int num_channels = CarlFrontendNumChannels(frontend);
+
+  params.first_output_channel = first_output_channel;
+  params.num_output_channels = num_output_channels;
+  CarlFrontend* subset = CHECK_NOTNULL(CarlFrontendMake(&params));
+  const int num_subset_channels = num_output_channels
+      ? num_output_channels : num_channels - first_output_channel;
+  CHECK(CarlFrontendNumChannels(subset) == num_subset_channels);
+  CHECK(CarlFrontendCountNumOutputChannels(&params) == num_subset_channels);
+  CHECK(CarlFrontendWarmStateSize(subset) == num_subset_channels);
+  /* The cascade runs only through the last output channel. */
+  CHECK(CarlFrontendFilterEvaluationsPerBlock(subset) <=
+        CarlFrontendFilterEvaluationsPerBlock(frontend));
+
+  float* input = (float*)CHECK_NOTNULL(malloc(block_size * sizeof(float)));
+  float* input_copy = (float*)CHECK_NOTNULL(
+      malloc(block_size * sizeof(float)));
+  float* output = (float*)CHECK_NOTNULL(malloc(num_channels * sizeof(float)));
+  float* subset_output = (float*)CHECK_NOTNULL(
+      malloc(num_subset_channels * sizeof(float)));
+
+  int block;
+  for (block = 0; block < kNumBlocks; ++block) {
+    int i;
+    for (i = 0; i < block_size; ++i) {
+      input[i] = input_copy[i] = 0.2f * ((float)rand() / RAND_MAX - 0.5f);
+    }
+
+    CarlFrontendProcessSamples(frontend, input, output);
+    CarlFrontendProcessSamples(subset, input_copy, subset_output);
+
+    int c;
+    for (c = 0; c < num_subset_channels; ++c) {
+      CHECK(fabs(subset_output[c] - output[first_output_channel + c]) <=
+            1e-5f);
+    }
+  }
+
+  /* Warm state is the subset of the full frontend's warm state. */
+  float* warm_state = (float*)CHECK_NOTNULL(
+      malloc(num_channels * sizeof(float)));
+  float* subset_warm_state = (float*)CHECK_NOTNULL(
+      malloc(num_subset_channels * sizeof(float)));
+  CarlFrontendGetWarmState(frontend, warm_state);
+  CarlFrontendGetWarmState(subset, subset_warm_state);
+  int c;
+  for (c = 0; c < num_subset_channels; ++c) {
+    CHECK(fabs(subset_warm_state[c] - warm_state[first_output_channel + c]) <=
+          1e-6f * warm_state[first_output_channel + c]);
+  }
+  CHECK(CarlFrontendSetWarmState(subset, subset_warm_state));
+
+  free(subset_warm_state);
+  free(warm_state);
+  free(subset_output);
+  free(output);
+  free(input_copy);
+  free(input);
+  CarlFrontendFree(subset);
+  CarlFrontendFree(frontend);
+}
+
 /* Spot checks that invalid parameters are correctly rejected. */
 static void TestInvalidParameters(void) {
   puts("TestInvalidParameters");
@@ -201,6 +493,11 @@ static void TestInvalidParameters(void) {
     params.block_size = 15;
     CHECK(CarlFrontendMake(&params) == NULL);
   }
+  { /* Decimating below 3 samples per cycle. */
+    CarlFrontendParams params = kCarlFrontendDefaultParams;
+    params.min_samples_per_cycle = 2.0f;
+    CHECK(CarlFrontendMake(&params) == NULL);
+  }
   { /* Diffusivity too large for output sample rate. */
     CarlFrontendParams params = kCarlFrontendDefaultParams;
     params.input_sample_rate_hz = 16000.0f;
@@ -208,12 +505,343 @@ static void TestInvalidParameters(void) {
     params.pcen_cross_channel_diffusivity = 130.0f;
     CHECK(CarlFrontendMake(&params) == NULL);
   }
+  { /* Channel subset beyond the last channel. */
+    CarlFrontendParams params = kCarlFrontendDefaultParams;
+    params.first_output_channel = 50;
+    params.num_output_channels = 10;
+    CHECK(CarlFrontendMake(&params) == NULL);
+  }
+  { /* Negative first output channel. */
+    CarlFrontendParams params = kCarlFrontendDefaultParams;
+    params.first_output_channel = -1;
+    CHECK(CarlFrontendMake(&params) == NULL);
+  }
+}
+
+/* CarlFrontendInitInBuffer() gives the same output as CarlFrontendMake(). */
+static void TestInitInBuffer(void) {
+  puts("TestInitInBuffer");
+  const CarlFrontendParams* params = &kCarlFrontendDefaultParams;
+  const size_t required_bytes = CarlFrontendRequiredBytes(params);
+  CHECK(required_bytes > 0);
+  /* Use an offset to test an unaligned buffer. */
+  char* storage = (char*)CHECK_NOTNULL(malloc(required_bytes + 1));
+  char* buffer = storage + 1;
+
+  /* Too small buffer fails. */
+  CHECK(CarlFrontendInitInBuffer(buffer, required_bytes - 64, params) == NULL);
+
+  CarlFrontend* expected = CHECK_NOTNULL(CarlFrontendMake(params));
+  CarlFrontend* actual = CHECK_NOTNULL(
+      CarlFrontendInitInBuffer(buffer, required_bytes, params));
+  CHECK((char*)actual >= buffer &&
+        (char*)(actual->pcen_denom + actual->num_channels) <=
+        buffer + required_bytes);
+  /* Hot arrays start on a cache line and are each 16-byte aligned. */
+  CHECK((uintptr_t)actual->b0 % kArenaAlignment == 0);
+  CHECK((uintptr_t)actual->biquad_z0 % 16 == 0);
+  CHECK((uintptr_t)actual->pcen_denom % 16 == 0);
+
+  const int block_size = CarlFrontendBlockSize(expected);
+  const int num_channels = CarlFrontendNumChannels(expected);
+  CHECK(CarlFrontendNumChannels(actual) == num_channels);
+  float* input_expected = (float*)CHECK_NOTNULL(
+      malloc(sizeof(float) * block_size));
+  float* input_actual = (float*)CHECK_NOTNULL(
+      malloc(sizeof(float) * block_size));
+  float* output_expected = (float*)CHECK_NOTNULL(
+      malloc(sizeof(float) * num_channels));
+  float* output_actual = (float*)CHECK_NOTNULL(
+      malloc(sizeof(float) * num_channels));
+  int b;
+  for (b = 0; b < 20; ++b) {
+    int i;
+    for (i = 0; i < block_size; ++i) {
+      input_expected[i] = input_actual[i] = (float)rand() / RAND_MAX - 0.5f;
+    }
+    CarlFrontendProcessSamples(expected, input_expected, output_expected);
+    CarlFrontendProcessSamples(actual, input_actual, output_actual);
+    for (i = 0; i < num_channels; ++i) {
+      CHECK(output_actual[i] == output_expected[i]);
+    }
+  }
+
+  /* Free doesn't free the caller's buffer. */
+  CarlFrontendFree(actual);
+  CarlFrontendFree(expected);
+  free(output_actual);
+  free(output_expected);
+  free(input_actual);
+  free(input_expected);
+  free(storage);
+}
+
+/* Sample rates and block sizes for precomputed designs. */
+static const float kPrecomputedSampleRatesHz[] = {15625.0f, 16000.0f};
+static const int kPrecomputedBlockSizes[] = {32, 64};
+
+/* Gets params for precomputed design `i`. */
+static CarlFrontendParams PrecomputedDesignParams(int i) {
+  CarlFrontendParams params = kCarlFrontendDefaultParams;
+  params.input_sample_rate_hz = kPrecomputedSampleRatesHz[i / 2];
+  params.block_size = kPrecomputedBlockSizes[i % 2];
+  return params;
+}
+
+/* Designs channels for `params` at runtime. The caller should free the result.
+ */
+static CarlFrontendChannelData* DesignChannels(
+    const CarlFrontendParams* params, int* num_channels) {
+  CarlFrontend* frontend = CHECK_NOTNULL(CarlFrontendMake(params));
+  *num_channels = CarlFrontendNumChannels(frontend);
+  CarlFrontendFree(frontend);
+  CarlFrontendChannelData* channel_data = (CarlFrontendChannelData*)
+      CHECK_NOTNULL(malloc(sizeof(CarlFrontendChannelData) * *num_channels));
+  CarlFrontendDesignChannels(params, *num_channels, channel_data);
+  return channel_data;
+}
+
+/* Precomputed designs match runtime design exactly. */
+static void TestPrecomputedDesigns(void) {
+  puts("TestPrecomputedDesigns");
+  CHECK(kCarlFrontendNumPrecomputedDesigns == 4);
+  int i;
+  for (i = 0; i < kCarlFrontendNumPrecomputedDesigns; ++i) {
+    const CarlFrontendParams params = PrecomputedDesignParams(i);
+    const CarlFrontendPrecomputedDesign* precomputed =
+        CarlFrontendFindPrecomputedDesign(&params);
+    CHECK(precomputed == &kCarlFrontendPrecomputedDesigns[i]);
+
+    int num_channels;
+    CarlFrontendChannelData* expected = DesignChannels(&params, &num_channels);
+    CHECK(precomputed->num_channels == num_channels);
+    int c;
+    for (c = 0; c < num_channels; ++c) {
+      const CarlFrontendChannelData* actual = &precomputed->channel_data[c];
+      CHECK(actual->biquad_coeffs.b0 == expected[c].biquad_coeffs.b0);
+      CHECK(actual->biquad_coeffs.b1 == expected[c].biquad_coeffs.b1);
+      CHECK(actual->biquad_coeffs.b2 == expected[c].biquad_coeffs.b2);
+      CHECK(actual->biquad_coeffs.a1 == expected[c].biquad_coeffs.a1);
+      CHECK(actual->biquad_coeffs.a2 == expected[c].biquad_coeffs.a2);
+      CHECK(actual->should_decimate == expected[c].should_decimate);
+      CHECK(actual->envelope_smoother_coeff ==
+            expected[c].envelope_smoother_coeff);
+    }
+    free(expected);
+  }
+
+  /* No precomputed design for other params. */
+  CarlFrontendParams params = kCarlFrontendDefaultParams;
+  params.input_sample_rate_hz = 44100.0f;
+  CHECK(CarlFrontendFindPrecomputedDesign(&params) == NULL);
+  params = kCarlFrontendDefaultParams;
+  params.step_erbs = 0.25f;
+  CHECK(CarlFrontendFindPrecomputedDesign(&params) == NULL);
+  /* PCEN params don't affect the channel design. */
+  params = kCarlFrontendDefaultParams;
+  params.pcen_alpha = 0.5f;
+  CHECK(CarlFrontendFindPrecomputedDesign(&params) != NULL);
+}
+
+/* Prints precomputed designs for carl_frontend_tables.c. Called if the program
+ * runs with --print_tables.
+ */
+static void PrintTables(void) {
+  const int num_designs = 4;
+  int i;
+  for (i = 0; i < num_designs; ++i) {
+    const CarlFrontendParams params = PrecomputedDesignParams(i);
+    int num_channels;
+    CarlFrontendChannelData* channel_data =
+        DesignChannels(&params, &num_channels);
+    printf("static const CarlFrontendChannelData kChannelData%dHzBlock%d[%d] = "
+           "{\n", (int)params.input_sample_rate_hz, params.block_size,
+           num_channels);
+    int c;
+    for (c = 0; c < num_channels; ++c) {
+      const BiquadFilterCoeffs* coeffs = &channel_data[c].biquad_coeffs;
+      printf("    {{%.9g, %.9g, %.9g, %.9g, %.9g},\n"
+             "     %d, %.9g},\n",
+             coeffs->b0, coeffs->b1, coeffs->b2, coeffs->a1, coeffs->a2,
+             channel_data[c].should_decimate,
+             channel_data[c].envelope_smoother_coeff);
+    }
+    printf("};\n\n");
+    free(channel_data);
+  }
+
+  printf("const CarlFrontendPrecomputedDesign "
+         "kCarlFrontendPrecomputedDesigns[] = {\n");
+  for (i = 0; i < num_designs; ++i) {
+    const CarlFrontendParams params = PrecomputedDesignParams(i);
+    int num_channels;
+    free(DesignChannels(&params, &num_channels));
+    printf("    {%.1ff, %d, %d, kChannelData%dHzBlock%d},\n",
+           params.input_sample_rate_hz, params.block_size, num_channels,
+           (int)params.input_sample_rate_hz, params.block_size);
+  }
+  printf("};\n\nconst int kCarlFrontendNumPrecomputedDesigns = %d;\n",
+         num_designs);
+}
+
+static void TestMemoryUsage(void) {
+  puts("TestMemoryUsage");
+  const CarlFrontendParams* params = &kCarlFrontendDefaultParams;
+  CarlFrontend* frontend = CHECK_NOTNULL(CarlFrontendMake(params));
+  MemoryUsage usage;
+  CarlFrontendMemoryUsage(frontend, &usage);
+  CHECK(usage.heap_bytes == CarlFrontendRequiredBytes(params));
+  CHECK(usage.state_bytes == 0);
+  /* Tables include at least the design for the default params. */
+  CHECK(usage.table_bytes >= sizeof(CarlFrontendChannelData) *
+                             CarlFrontendNumChannels(frontend));
+  CarlFrontendFree(frontend);
+}
+
+/* Runs `actual` and `expected` on the same random input, checking that they
+ * produce identical output.
+ */
+static void CheckSameOutput(CarlFrontend* actual, CarlFrontend* expected) {
+  const int block_size = CarlFrontendBlockSize(expected);
+  const int num_channels = CarlFrontendNumChannels(expected);
+  CHECK(CarlFrontendBlockSize(actual) == block_size);
+  CHECK(CarlFrontendNumChannels(actual) == num_channels);
+  float* input_expected = (float*)CHECK_NOTNULL(
+      malloc(sizeof(float) * block_size));
+  float* input_actual = (float*)CHECK_NOTNULL(
+      malloc(sizeof(float) * block_size));
+  float* output_expected = (float*)CHECK_NOTNULL(
+      malloc(sizeof(float) * num_channels));
+  float* output_actual = (float*)CHECK_NOTNULL(
+      malloc(sizeof(float) * num_channels));
+  int b;
+  for (b = 0; b < 20; ++b) {
+    int i;
+    for (i = 0; i < block_size; ++i) {
+      input_expected[i] = input_actual[i] = (float)rand() / RAND_MAX - 0.5f;
+    }
+    CarlFrontendProcessSamples(expected, input_expected, output_expected);
+    CarlFrontendProcessSamples(actual, input_actual, output_actual);
+    for (i = 0; i < num_channels; ++i) {
+      CHECK(output_actual[i] == output_expected[i]);
+    }
+  }
+  free(output_actual);
+  free(output_expected);
+  free(input_actual);
+  free(input_expected);
+}
+
+/* A clone behaves as a newly made frontend, and shares the channel design. */
+static void TestClone(void) {
+  puts("TestClone");
+  CarlFrontendParams params = kCarlFrontendDefaultParams;
+  params.step_erbs = 0.6f;  /* Not a precomputed design. */
+  params.first_output_channel = 3;
+  CarlFrontend* frontend = CHECK_NOTNULL(CarlFrontendMake(&params));
+  /* Run the original, so that it is not in initial state. */
+  CarlFrontend* expected = CHECK_NOTNULL(CarlFrontendMake(&params));
+  CheckSameOutput(frontend, expected);
+  CarlFrontendFree(expected);
+
+  CarlFrontend* clone = CHECK_NOTNULL(CarlFrontendClone(frontend));
+  CHECK(clone->channel_data == frontend->channel_data);
+  CHECK((uintptr_t)clone->b0 % kArenaAlignment == 0);
+  CHECK((uintptr_t)clone->biquad_z0 % 16 == 0);
+  MemoryUsage usage;
+  CarlFrontendMemoryUsage(clone, &usage);
+  CHECK(usage.heap_bytes < CarlFrontendRequiredBytes(&params));
+
+  expected = CHECK_NOTNULL(CarlFrontendMake(&params));
+  CheckSameOutput(clone, expected);
+  /* A clone of a clone also references the original design. */
+  CarlFrontend* clone2 = CHECK_NOTNULL(CarlFrontendClone(clone));
+  CHECK(clone2->channel_data == frontend->channel_data);
+  CarlFrontendReset(expected);
+  CheckSameOutput(clone2, expected);
+
+  CHECK(CarlFrontendClone(NULL) == NULL);
+  CarlFrontendFree(clone2);
+  CarlFrontendFree(clone);
+  CarlFrontendFree(expected);
+  CarlFrontendFree(frontend);
+}
+
+/* CarlFrontendMakeCached() matches CarlFrontendMake() and reuses designs. */
+static void TestDesignCache(void) {
+  puts("TestDesignCache");
+  CarlFrontendDesignCache* cache = CHECK_NOTNULL(CarlFrontendDesignCacheMake());
+  CarlFrontendParams params = kCarlFrontendDefaultParams;
+  params.step_erbs = 0.6f;
+  CarlFrontend* a = CHECK_NOTNULL(CarlFrontendMakeCached(cache, &params));
+  CHECK(CarlFrontendDesignCacheSize(cache) == 1);
+  CarlFrontend* expected = CHECK_NOTNULL(CarlFrontendMake(&params));
+  CheckSameOutput(a, expected);
+  CarlFrontendFree(expected);
+
+  /* Differing only in PCEN params, the design is reused. */
+  params.pcen_alpha = 0.5f;
+  params.pcen_init_value = 1e-5f;
+  CarlFrontend* b = CHECK_NOTNULL(CarlFrontendMakeCached(cache, &params));
+  CHECK(CarlFrontendDesignCacheSize(cache) == 1);
+  CHECK(b->channel_data == a->channel_data);
+  expected = CHECK_NOTNULL(CarlFrontendMake(&params));
+  CheckSameOutput(b, expected);
+  CarlFrontendFree(expected);
+
+  /* A different design adds an entry. */
+  params.first_output_channel = 5;
+  CarlFrontend* c = CHECK_NOTNULL(CarlFrontendMakeCached(cache, &params));
+  CHECK(CarlFrontendDesignCacheSize(cache) == 2);
+  CHECK(c->channel_data != a->channel_data);
+  expected = CHECK_NOTNULL(CarlFrontendMake(&params));
+  CheckSameOutput(c, expected);
+  CarlFrontendFree(expected);
+
+  /* Invalid params fail, including invalid PCEN params with a cached design. */
+  params.pcen_beta = -1.0f;
+  CHECK(CarlFrontendMakeCached(cache, &params) == NULL);
+  params = kCarlFrontendDefaultParams;
+  params.block_size = 3;
+  CHECK(CarlFrontendMakeCached(cache, &params) == NULL);
+  CHECK(CarlFrontendDesignCacheSize(cache) == 2);
+
+  CarlFrontendFree(c);
+  CarlFrontendFree(b);
+  CarlFrontendFree(a);
+  CarlFrontendDesignCacheFree(cache);
 }
 
 int main(int argc, char** argv) {
-  TestDesign();
-  TestResponse();
+  if (argc == 2 && !strcmp(argv[1], "--print_tables")) {
+    PrintTables();
+    return EXIT_SUCCESS;
+  }
+
+  TestDesign(kCarlFrontendDefaultParams.min_samples_per_cycle);
+  TestDesign(3.0f);
+  TestResponse(kCarlFrontendDefaultParams.min_samples_per_cycle);
+  TestResponse(3.0f);
+  int block_size;
+  for (block_size = 1; block_size <= 128; block_size *= 2) {
+    TestMatchesReferenceCascade(block_size);
+  }
+  TestPcenMatchesReference(kCarlFrontendDefaultParams.step_erbs, 0);
+  TestPcenMatchesReference(kCarlFrontendDefaultParams.step_erbs, 1);
+  TestPcenMatchesReference(0.6f, 0);  /* 47 channels. */
+  TestPcenMatchesReference(0.6f, 1);
+  TestAggressiveDecimation();
+  TestChannelSubset(0, 0);
+  TestChannelSubset(0, 10);
+  TestChannelSubset(13, 22);
+  TestChannelSubset(40, 0);
+  TestChannelSubset(55, 1);
   TestInvalidParameters();
+  TestPrecomputedDesigns();
+  TestInitInBuffer();
+  TestClone();
+  TestDesignCache();
+  TestMemoryUsage();
 
   puts("PASS");
   return EXIT_SUCCESS;
@@ -19,6 +19,7 @@
 #include <math.h>
 #include <stdlib.h>
 
+#include "src/dsp/convert_sample.h"
 #include "src/dsp/iir_design.h"
 #include "src/dsp/logging.h"
 #include "src/dsp/math_constants.h"
@@ -44,7 +45,9 @@ static float HammingWindow(float x) {
 }
 
 /* Bandpass filters tactile signals to remove content outside of 10-500 Hz. */
-static void FilterTactileSignalsToBand(float* tactile_signals, int num_frames) {
+static void FilterTactileSignalsToBand(const MuxLayout* layout,
+                                       float* tactile_signals, int num_frames) {
+  const int num_channels = layout->num_channels;
 #define kBpfOrder 4
   BiquadFilterCoeffs coeffs[kBpfOrder];
   /* Make a 4th-order elliptic bandpass filter. To account for transition bands,
@@ -56,12 +59,12 @@ static void FilterTactileSignalsToBand(float* tactile_signals, int num_frames) {
                                /*stopband_ripple_db=*/30.0,
                                /*low_edge_hz=*/15.0,
                                /*high_edge_hz=*/410.0,
-                               /*sample_rate_hz=*/kMuxTactileRate,
+                               /*sample_rate_hz=*/MuxLayoutTactileRate(layout),
                                /*coeffs=*/coeffs,
                                /*max_biquads=*/kBpfOrder) == kBpfOrder);
 
   int c;
-  for (c = 0; c < kMuxChannels; ++c) {
+  for (c = 0; c < num_channels; ++c) {
     float* channel = tactile_signals + c;
     BiquadFilterState state[kBpfOrder];
     int k;
@@ -70,7 +73,7 @@ static void FilterTactileSignalsToBand(float* tactile_signals, int num_frames) {
     }
 
     int i;
-    for (i = 0; i < num_frames; ++i, channel += kMuxChannels) {
+    for (i = 0; i < num_frames; ++i, channel += num_channels) {
       float sample = *channel;
       for (k = 0; k < kBpfOrder; ++k) { /* Apply bandpass filter. */
         sample = BiquadFilterProcessOneSample(&coeffs[k], &state[k], sample);
@@ -81,8 +84,8 @@ static void FilterTactileSignalsToBand(float* tactile_signals, int num_frames) {
 }
 
 /* Make some tactile test signals by filtering random sample values. */
-static float* MakeTactileTestSignals(int num_frames) {
-  const int num_samples = kMuxChannels * num_frames;
+static float* MakeTactileTestSignals(const MuxLayout* layout, int num_frames) {
+  const int num_samples = layout->num_channels * num_frames;
   float* tactile_signals = (float*)CHECK_NOTNULL(
       malloc(sizeof(float) * num_samples));
 
@@ -90,15 +93,15 @@ static float* MakeTactileTestSignals(int num_frames) {
   for (i = 0; i < num_samples; ++i) {
     tactile_signals[i] = 1.9f * (RandUniform() - 0.5f);
   }
-  FilterTactileSignalsToBand(tactile_signals, num_frames);
+  FilterTactileSignalsToBand(layout, tactile_signals, num_frames);
 
   return tactile_signals;
 }
 
 /* Runs Muxer on `tactile_signals`. */
-static float* RunMuxer(const float* tactile_signals, int num_frames,
-                       int* num_muxed_samples) {
-  Muxer* muxer = (Muxer*)CHECK_NOTNULL(MuxerMake());
+static float* RunMuxer(const MuxLayout* layout, const float* tactile_signals,
+                       int num_frames, int* num_muxed_samples) {
+  Muxer* muxer = (Muxer*)CHECK_NOTNULL(MuxerMakeWithLayout(layout));
   *num_muxed_samples = MuxerNextOutputSize(muxer, num_frames);
   float* muxed_signal =
       (float*)CHECK_NOTNULL(malloc(*num_muxed_samples * sizeof(float)));
@@ -109,13 +112,13 @@ static float* RunMuxer(const float* tactile_signals, int num_frames,
 }
 
 /* Runs Demuxer on `muxed_signal`. */
-static float* RunDemuxer(const float* muxed_signal, int num_samples,
-                         int* num_demuxed_frames) {
+static float* RunDemuxer(const MuxLayout* layout, const float* muxed_signal,
+                         int num_samples, int* num_demuxed_frames) {
   Demuxer demuxer;
-  DemuxerInit(&demuxer);
-  *num_demuxed_frames = num_samples / kMuxRateFactor;
+  CHECK(DemuxerInitWithLayout(&demuxer, layout));
+  *num_demuxed_frames = num_samples / layout->rate_factor;
   float* demuxed_signals = (float*)CHECK_NOTNULL(
-      malloc(*num_demuxed_frames * kMuxChannels * sizeof(float)));
+      malloc(*num_demuxed_frames * layout->num_channels * sizeof(float)));
   DemuxerProcessSamples(&demuxer, muxed_signal, num_samples,
                         demuxed_signals);
   return demuxed_signals;
@@ -156,16 +159,19 @@ static float* SimulateDistortion(float* signal, int num_samples,
 /* Test mux + demux round trip with a time delay and added noise. This test
  * that time synchronization in demuxing works robustly.
  */
-static void TestRoundTrip(float delay_in_samples, float noise_stddev) {
-  printf("TestRoundTrip(%g, %g)\n", delay_in_samples, noise_stddev);
+static void TestRoundTrip(const MuxLayout* layout, float delay_in_samples,
+                          float noise_stddev) {
+  printf("TestRoundTrip(%d channels, %g, %g)\n", layout->num_channels,
+         delay_in_samples, noise_stddev);
+  const int num_channels = layout->num_channels;
   const int kNumFrames = 1000;
   /* Make random tactile test signals.*/
-  float* tactile_signals = MakeTactileTestSignals(kNumFrames);
+  float* tactile_signals = MakeTactileTestSignals(layout, kNumFrames);
 
   /* Multiplex the `tactile_signals` into `muxed_signal`. */
   int num_muxed_samples;
   float* muxed_signal =
-      RunMuxer(tactile_signals, kNumFrames, &num_muxed_samples);
+      RunMuxer(layout, tactile_signals, kNumFrames, &num_muxed_samples);
 
   float* received_signal = SimulateDistortion(muxed_signal, num_muxed_samples,
                                               delay_in_samples, noise_stddev);
@@ -173,11 +179,12 @@ static void TestRoundTrip(float delay_in_samples, float noise_stddev) {
   /* Demultiplex `received_signal` to `demuxed_signals`. */
   int num_demuxed_frames;
   float* demuxed_signals =
-      RunDemuxer(received_signal, num_muxed_samples, &num_demuxed_frames);
+      RunDemuxer(layout, received_signal, num_muxed_samples,
+                 &num_demuxed_frames);
 
   /* For each channel, compute signal to noise ratio of demuxed output. */
   int c;
-  for (c = 0; c < kMuxChannels; ++c) {
+  for (c = 0; c < num_channels; ++c) {
     const float* expected = tactile_signals + c;
     const float* actual = demuxed_signals + c;
     float signal_energy = 0.0f;
@@ -188,8 +195,8 @@ static void TestRoundTrip(float delay_in_samples, float noise_stddev) {
       signal_energy += *expected * *expected;
       const float error = *expected - *actual;
       noise_energy += error * error;
-      expected += kMuxChannels;
-      actual += kMuxChannels;
+      expected += num_channels;
+      actual += num_channels;
     }
 
     const float snr_db = 10 * log(M_LN10 * signal_energy / noise_energy);
@@ -205,17 +212,18 @@ static void TestRoundTrip(float delay_in_samples, float noise_stddev) {
 /* Same as TestRoundTrip but with odd channels equal to zero. This checks for
  * interference from pilot signals and neighboring channels.
  */
-static void TestZeroOddChannelsRoundTrip(void) {
-  puts("TestZeroOddChannelsRoundTrip");
+static void TestZeroOddChannelsRoundTrip(const MuxLayout* layout) {
+  printf("TestZeroOddChannelsRoundTrip(%d channels)\n", layout->num_channels);
+  const int num_channels = layout->num_channels;
   const int kNumFrames = 1000;
-  float* tactile_signals = MakeTactileTestSignals(kNumFrames);
+  float* tactile_signals = MakeTactileTestSignals(layout, kNumFrames);
 
   /* Set odd channels to zero. */
   float* dest = tactile_signals;
   int i;
-  for (i = 0; i < kNumFrames; ++i, dest += kMuxChannels) {
+  for (i = 0; i < kNumFrames; ++i, dest += num_channels) {
     int c;
-    for (c = 1; c < kMuxChannels; c += 2) {
+    for (c = 1; c < num_channels; c += 2) {
       dest[c] = 0.0f;
     }
   }
@@ -223,31 +231,36 @@ static void TestZeroOddChannelsRoundTrip(void) {
   /* Multiplex the `tactile_signals` into `muxed_signal`. */
   int num_muxed_samples;
   float* muxed_signal =
-      RunMuxer(tactile_signals, kNumFrames, &num_muxed_samples);
+      RunMuxer(layout, tactile_signals, kNumFrames, &num_muxed_samples);
   /* Demultiplex `muxed_signal` to `demuxed_signals`. */
   int num_demuxed_frames;
   float* demuxed_signals =
-      RunDemuxer(muxed_signal, num_muxed_samples, &num_demuxed_frames);
+      RunDemuxer(layout, muxed_signal, num_muxed_samples, &num_demuxed_frames);
 
   /* Odd channels of the demuxed output should ideally be zero. So any values in
    * there are noise, leaked in from pilot signals and other channels. Check
    * noise standard deviation in the odd channels.
+   *
+   * The dense layout's demuxer PLL has a startup transient of about 25 frames,
+   * so its first frames are skipped.
    */
+  const int start_frame = (num_channels > kMuxChannels) ? 50 : 0;
   int c;
-  for (c = 1; c < kMuxChannels; c += 1) {
-    const float* expected = tactile_signals + c;
-    const float* actual = demuxed_signals + c;
+  for (c = 1; c < num_channels; c += 1) {
+    const float* expected = tactile_signals + start_frame * num_channels + c;
+    const float* actual = demuxed_signals + start_frame * num_channels + c;
     float noise_energy = 0.0f;
 
     int i;
-    for (i = 0; i < num_demuxed_frames; ++i) {
+    for (i = start_frame; i < num_demuxed_frames; ++i) {
       const float error = *expected - *actual;
       noise_energy += error * error;
-      expected += kMuxChannels;
-      actual += kMuxChannels;
+      expected += num_channels;
+      actual += num_channels;
     }
 
-    const float noise_stddev = sqrt(noise_energy / num_demuxed_frames);
+    const float noise_stddev =
+        sqrt(noise_energy / (num_demuxed_frames - start_frame));
     CHECK(noise_stddev < 0.12f);
   }
 
@@ -256,19 +269,20 @@ static void TestZeroOddChannelsRoundTrip(void) {
   free(tactile_signals);
 }
 
-static void TestMuxerStreaming(void) {
-  puts("TestMuxerStreaming");
+static void TestMuxerStreaming(const MuxLayout* layout) {
+  printf("TestMuxerStreaming(%d channels)\n", layout->num_channels);
+  const int num_channels = layout->num_channels;
   const int kNumFrames = 250;
-  float* tactile_signals = MakeTactileTestSignals(kNumFrames);
+  float* tactile_signals = MakeTactileTestSignals(layout, kNumFrames);
 
   /* Multiplex the `tactile_signals` into `muxed_nonstreaming`. */
   int num_nonstreaming;
   float* muxed_nonstreaming =
-      RunMuxer(tactile_signals, kNumFrames, &num_nonstreaming);
+      RunMuxer(layout, tactile_signals, kNumFrames, &num_nonstreaming);
 
   float* muxed_streaming = (float*)CHECK_NOTNULL(
-      malloc(sizeof(float) * kNumFrames * kMuxRateFactor));
-  Muxer* muxer = (Muxer*)CHECK_NOTNULL(MuxerMake());
+      malloc(sizeof(float) * kNumFrames * layout->rate_factor));
+  Muxer* muxer = (Muxer*)CHECK_NOTNULL(MuxerMakeWithLayout(layout));
 
   /* Run the muxer on tactile_signals 10 times, processing in randomly-sized
    * blocks of 0 to 20 frames at a time.
@@ -288,7 +302,7 @@ static void TestMuxerStreaming(void) {
       const int expected_output_size = MuxerNextOutputSize(muxer, block_size);
       CHECK(num_streaming + expected_output_size <= num_nonstreaming);
       const int actual_output_size =
-          MuxerProcessSamples(muxer, tactile_signals + kMuxChannels * start,
+          MuxerProcessSamples(muxer, tactile_signals + num_channels * start,
                               block_size, muxed_streaming + num_streaming);
       CHECK(expected_output_size == actual_output_size);
       num_streaming += actual_output_size;
@@ -309,10 +323,12 @@ static void TestMuxerStreaming(void) {
   free(tactile_signals);
 }
 
-static void TestDemuxerStreaming(void) {
-  puts("TestDemuxerStreaming");
+static void TestDemuxerStreaming(const MuxLayout* layout) {
+  printf("TestDemuxerStreaming(%d channels)\n", layout->num_channels);
+  const int num_channels = layout->num_channels;
+  const int rate_factor = layout->rate_factor;
   const int kNumFrames = 250;
-  const int kNumMuxedSamples = kNumFrames * kMuxRateFactor;
+  const int kNumMuxedSamples = kNumFrames * rate_factor;
   float* muxed_signal =
       (float*)CHECK_NOTNULL(malloc(kNumMuxedSamples * sizeof(float)));
   int i;
@@ -323,36 +339,36 @@ static void TestDemuxerStreaming(void) {
   /* Demultiplex the `muxed_signal` into `demuxed_nonstreaming`. */
   int num_nonstreaming;
   float* demuxed_nonstreaming =
-      RunDemuxer(muxed_signal, kNumMuxedSamples, &num_nonstreaming);
+      RunDemuxer(layout, muxed_signal, kNumMuxedSamples, &num_nonstreaming);
 
   float* demuxed_streaming = (float*)CHECK_NOTNULL(
-      malloc(kNumFrames * kMuxChannels * sizeof(float)));
+      malloc(kNumFrames * num_channels * sizeof(float)));
 
   /* Run the demuxer on muxed_signal 10 times, processing in randomly-sized
-   * blocks of 0 to 20 * kMuxRateFactor samples at a time.
+   * blocks of 0 to 20 * rate_factor samples at a time.
    */
   int trial;
   for (trial = 0; trial < 10; ++trial) {
     Demuxer demuxer;
-    DemuxerInit(&demuxer);
+    CHECK(DemuxerInitWithLayout(&demuxer, layout));
     int num_streaming = 0;
 
     int start = 0;
     while (start < kNumMuxedSamples) {
-      int block_size = (int)(20 * RandUniform()) * kMuxRateFactor;
+      int block_size = (int)(20 * RandUniform()) * rate_factor;
       if (block_size > kNumMuxedSamples - start) {
         block_size = kNumMuxedSamples - start;
       }
 
       DemuxerProcessSamples(&demuxer, muxed_signal + start, block_size,
-                            demuxed_streaming + kMuxChannels * num_streaming);
-      num_streaming += block_size / kMuxRateFactor;
+                            demuxed_streaming + num_channels * num_streaming);
+      num_streaming += block_size / rate_factor;
       start += block_size;
     }
 
     /* The streaming and nonstreaming demuxed outputs should match. */
     CHECK(num_streaming == num_nonstreaming);
-    for (i = 0; i < kMuxChannels * num_streaming; ++i) {
+    for (i = 0; i < num_channels * num_streaming; ++i) {
       CHECK(fabs(demuxed_streaming[i] - demuxed_nonstreaming[i]) < 1e-6f);
     }
   }
@@ -362,19 +378,117 @@ static void TestDemuxerStreaming(void) {
   free(muxed_signal);
 }
 
+/* DemuxerProcessSamplesToPwm() matches DemuxerProcessSamples() followed by
+ * conversion to PWM values.
+ */
+static void TestDemuxerToPwm(const MuxLayout* layout) {
+  printf("TestDemuxerToPwm(%d channels)\n", layout->num_channels);
+  const int num_channels = layout->num_channels;
+  const int rate_factor = layout->rate_factor;
+  const int kNumFrames = 250;
+  const int kNumMuxedSamples = kNumFrames * rate_factor;
+  const int kPwmMaxValue = 512;
+  const int kPwmStride = 4;
+  /* Gain large enough that some samples saturate. */
+  const float kGain = 20.0f;
+  float* muxed_signal =
+      (float*)CHECK_NOTNULL(malloc(kNumMuxedSamples * sizeof(float)));
+  int i;
+  for (i = 0; i < kNumMuxedSamples; ++i) {
+    muxed_signal[i] = 1.9f * (RandUniform() - 0.5f);
+  }
+
+  int num_expected;
+  float* expected =
+      RunDemuxer(layout, muxed_signal, kNumMuxedSamples, &num_expected);
+  CHECK(num_expected == kNumFrames);
+
+  uint16_t* pwm_buffer = (uint16_t*)CHECK_NOTNULL(
+      malloc(num_channels * kNumFrames * kPwmStride * sizeof(uint16_t)));
+  uint16_t* pwm_channels[kMuxMaxChannels];
+  int c;
+  for (c = 0; c < num_channels; ++c) {
+    pwm_channels[c] = pwm_buffer + kNumFrames * kPwmStride * c;
+  }
+
+  Demuxer demuxer;
+  CHECK(DemuxerInitWithLayout(&demuxer, layout));
+  DemuxerProcessSamplesToPwm(&demuxer, muxed_signal, kNumMuxedSamples, kGain,
+                             kPwmMaxValue, pwm_channels, kPwmStride);
+
+  int num_saturated = 0;
+  for (c = 0; c < num_channels; ++c) {
+    for (i = 0; i < kNumFrames; ++i) {
+      const int expected_value = ConvertSampleFloatTo0_MaxValue(
+          kGain * expected[num_channels * i + c], kPwmMaxValue);
+      const int value = pwm_channels[c][i * kPwmStride];
+      /* Allow off-by-one from rounding differences in the SIMD conversion. */
+      CHECK(abs(value - expected_value) <= 1);
+      num_saturated += (value == 0 || value == kPwmMaxValue);
+    }
+  }
+  CHECK(num_saturated > 0);
+
+  free(pwm_buffer);
+  free(expected);
+  free(muxed_signal);
+}
+
+static void TestLayoutIsValid(void) {
+  puts("TestLayoutIsValid");
+  MuxLayout layout;
+  MuxLayoutSetDefault(&layout);
+  CHECK(MuxLayoutIsValid(&layout));
+  CHECK(layout.num_channels == kMuxChannels);
+  CHECK(MuxLayoutTactileRate(&layout) == kMuxTactileRate);
+  MuxLayoutSetDense24(&layout);
+  CHECK(MuxLayoutIsValid(&layout));
+  CHECK(layout.num_channels == 24);
+
+  /* Too many channels for the bandwidth. */
+  layout.carrier_spacing_hz = 1000.0f;
+  CHECK(!MuxLayoutIsValid(&layout));
+  CHECK(MuxerMakeWithLayout(&layout) == NULL);
+  Demuxer demuxer;
+  CHECK(!DemuxerInitWithLayout(&demuxer, &layout));
+  /* Carriers too close together. */
+  MuxLayoutSetDense24(&layout);
+  layout.carrier_spacing_hz = 600.0f;
+  CHECK(!MuxLayoutIsValid(&layout));
+  /* Number of channels not a multiple of 4. */
+  MuxLayoutSetDense24(&layout);
+  layout.num_channels = 22;
+  CHECK(!MuxLayoutIsValid(&layout));
+  /* Tactile rate too low. */
+  MuxLayoutSetDense24(&layout);
+  layout.rate_factor = 48;
+  CHECK(!MuxLayoutIsValid(&layout));
+}
+
 int main(int argc, char** argv) {
   srand(0);
-  TestRoundTrip(0.0f, 0.0f);  /* Clean round trip without distortions. */
+  MuxLayout layouts[2];
+  MuxLayoutSetDefault(&layouts[0]);
+  MuxLayoutSetDense24(&layouts[1]);
 
-  TestRoundTrip(4.8f, 0.0f);
-  TestRoundTrip(-0.3f, 0.0f);
-  TestRoundTrip(4.8f, 0.005f);
-  TestRoundTrip(7.3f, 0.005f);
-  TestRoundTrip(-4.8f, 0.005f);
-
-  TestZeroOddChannelsRoundTrip();
-  TestMuxerStreaming();
-  TestDemuxerStreaming();
+  TestLayoutIsValid();
+  int i;
+  for (i = 0; i < 2; ++i) {
+    const MuxLayout* layout = &layouts[i];
+    /* Clean round trip without distortions. */
+    TestRoundTrip(layout, 0.0f, 0.0f);
+
+    TestRoundTrip(layout, 4.8f, 0.0f);
+    TestRoundTrip(layout, -0.3f, 0.0f);
+    TestRoundTrip(layout, 4.8f, 0.005f);
+    TestRoundTrip(layout, 7.3f, 0.005f);
+    TestRoundTrip(layout, -4.8f, 0.005f);
+
+    TestZeroOddChannelsRoundTrip(layout);
+    TestMuxerStreaming(layout);
+    TestDemuxerStreaming(layout);
+    TestDemuxerToPwm(layout);
+  }
 
   puts("PASS");
   return EXIT_SUCCESS;
@@ -100,6 +100,190 @@ static void TestWarblingTone(void) {
   }
 }
 
+/* PilotTrackerProcessSamples() matches PilotTrackerProcessOneSample(). */
+static void TestProcessSamples(void) {
+  puts("TestProcessSamples");
+  PilotTrackerCoeffs tracker_coeffs;
+  PilotTrackerCoeffsInit(&tracker_coeffs, 500.0f, kSampleRateHz);
+  PilotTracker tracker;
+  PilotTrackerInit(&tracker, &tracker_coeffs);
+  PilotTracker block_tracker;
+  PilotTrackerInit(&block_tracker, &tracker_coeffs);
+
+  const float cycles_per_sample = 500.0f / kSampleRateHz;
+#define kNumSamples 400
+  ComplexFloat input[kNumSamples];
+  int n;
+  for (n = 0; n < kNumSamples; ++n) {
+    input[n] = ComplexFloatMake(
+        cos(2 * M_PI * cycles_per_sample * n) + 0.2 * (RandUniform() - 0.5),
+        sin(2 * M_PI * cycles_per_sample * n) + 0.2 * (RandUniform() - 0.5));
+  }
+
+  Phase32 phases[kNumSamples];
+  /* Process in blocks of varying size. */
+  int start;
+  int block_size;
+  for (start = 0, block_size = 1; start < kNumSamples;
+       start += block_size, ++block_size) {
+    if (block_size > kNumSamples - start) { block_size = kNumSamples - start; }
+    PilotTrackerProcessSamples(&block_tracker, &tracker_coeffs, input + start,
+                               block_size, phases + start);
+  }
+
+  for (n = 0; n < kNumSamples; ++n) {
+    CHECK(phases[n] ==
+          PilotTrackerProcessOneSample(&tracker, &tracker_coeffs, input[n]));
+  }
+  CHECK(block_tracker.pilot_frequency == tracker.pilot_frequency);
+#undef kNumSamples
+}
+
+/* PilotTracker4 tracks four tones at once, each close to a scalar tracker. */
+static void TestPilotTracker4(void) {
+  puts("TestPilotTracker4");
+  const float kFrequencyHz[4] = {500.0f, 505.0f, 495.0f, 502.0f};
+  const float kInitialPhase[4] = {0.0f, 0.6f, 0.7f, 0.2f};
+  PilotTrackerCoeffs tracker_coeffs;
+  PilotTrackerCoeffsInit(&tracker_coeffs, 500.0f, kSampleRateHz);
+  PilotTracker4 tracker4;
+  PilotTracker4Init(&tracker4, &tracker_coeffs);
+  PilotTracker trackers[4];
+  int i;
+  for (i = 0; i < 4; ++i) {
+    PilotTrackerInit(&trackers[i], &tracker_coeffs);
+  }
+
+#define kBlockSize 16
+  float input_real[4 * kBlockSize];
+  float input_imag[4 * kBlockSize];
+  Phase32 phases[4 * kBlockSize];
+  int block;
+  for (block = 0; block < 40; ++block) {
+    int n;
+    for (n = 0; n < kBlockSize; ++n) {
+      for (i = 0; i < 4; ++i) {
+        const float expected_phase = kInitialPhase[i] +
+            kFrequencyHz[i] / kSampleRateHz * (block * kBlockSize + n);
+        input_real[4 * n + i] =
+            cos(2 * M_PI * expected_phase) + 0.2 * (RandUniform() - 0.5);
+        input_imag[4 * n + i] =
+            sin(2 * M_PI * expected_phase) + 0.2 * (RandUniform() - 0.5);
+      }
+    }
+
+    PilotTracker4ProcessSamples(&tracker4, &tracker_coeffs, input_real,
+                                input_imag, kBlockSize, phases);
+
+    for (n = 0; n < kBlockSize; ++n) {
+      for (i = 0; i < 4; ++i) {
+        const Phase32 expected = PilotTrackerProcessOneSample(
+            &trackers[i], &tracker_coeffs,
+            ComplexFloatMake(input_real[4 * n + i], input_imag[4 * n + i]));
+        float error = Phase32ToFloat(phases[4 * n + i] - expected);
+        error -= floor(error + 0.5); /* Wrap phase error to [-0.5, 0.5). */
+        CHECK(fabs(error) < 1e-4f);
+      }
+    }
+  }
+
+  for (i = 0; i < 4; ++i) {
+    CHECK(fabs(tracker4.pilot_frequency[i] - trackers[i].pilot_frequency)
+          < 1e-5f);
+  }
+#undef kBlockSize
+}
+
+/* Generates `num_samples` samples of a tone with the given frequency and
+ * initial phase plus a little noise. If `warble_hz` is nonzero, the frequency
+ * varies sinusoidally by +/-5 Hz at that rate.
+ */
+static void GenerateTone(float frequency_hz, float initial_phase,
+                         float warble_hz, int num_samples,
+                         ComplexFloat* output, float* expected_phases) {
+  const float alpha = (warble_hz > 0.0f) ? 10.0f / (4 * M_PI * warble_hz) : 0;
+  int n;
+  for (n = 0; n < num_samples; ++n) {
+    const float t = n / kSampleRateHz;
+    const float expected_phase = initial_phase + frequency_hz * t -
+        alpha * cos(2 * M_PI * warble_hz * t);
+    output[n] = ComplexFloatMake(
+        cos(2 * M_PI * expected_phase) + 0.2 * (RandUniform() - 0.5),
+        sin(2 * M_PI * expected_phase) + 0.2 * (RandUniform() - 0.5));
+    expected_phases[n] = expected_phase;
+  }
+}
+
+/* DecimatedPilotTracker locks onto steady and warbling tones. */
+static void TestDecimatedTracker(float frequency_hz, float initial_phase,
+                                 float warble_hz) {
+  printf("TestDecimatedTracker(%g, %g, %g)\n",
+         frequency_hz, initial_phase, warble_hz);
+  PilotTrackerCoeffs tracker_coeffs;
+  PilotTrackerCoeffsInit(&tracker_coeffs, frequency_hz, kSampleRateHz);
+  DecimatedPilotTracker tracker;
+  DecimatedPilotTrackerInit(&tracker, &tracker_coeffs);
+
+#define kNumSamples 1000
+  ComplexFloat input[kNumSamples];
+  float expected_phases[kNumSamples];
+  GenerateTone(frequency_hz, initial_phase, warble_hz, kNumSamples,
+               input, expected_phases);
+  Phase32 phases[kNumSamples];
+  DecimatedPilotTrackerProcessSamples(&tracker, &tracker_coeffs, input,
+                                      kNumSamples, phases);
+
+  int n;
+  for (n = 160; n < kNumSamples; ++n) {
+    float error = expected_phases[n] - Phase32ToFloat(phases[n]);
+    error -= floor(error + 0.5); /* Wrap phase error to [-0.5, 0.5). */
+    CHECK(fabs(error) < 0.05f); /* Within 1/20th of a cycle (18 degrees). */
+  }
+  float frequency_error = Phase32ToFloat(tracker.pilot_frequency) -
+                          frequency_hz / kSampleRateHz;
+  frequency_error -= floor(frequency_error + 0.5);
+  CHECK(fabs(frequency_error) < 0.001f);
+#undef kNumSamples
+}
+
+/* DecimatedPilotTracker results don't depend on the block size. */
+static void TestDecimatedProcessSamplesBlockSizes(void) {
+  puts("TestDecimatedProcessSamplesBlockSizes");
+  PilotTrackerCoeffs tracker_coeffs;
+  PilotTrackerCoeffsInit(&tracker_coeffs, 500.0f, kSampleRateHz);
+  DecimatedPilotTracker tracker;
+  DecimatedPilotTrackerInit(&tracker, &tracker_coeffs);
+  DecimatedPilotTracker block_tracker;
+  DecimatedPilotTrackerInit(&block_tracker, &tracker_coeffs);
+
+#define kNumSamples 400
+  ComplexFloat input[kNumSamples];
+  float expected_phases[kNumSamples];
+  GenerateTone(500.0f, 0.3f, 0.0f, kNumSamples, input, expected_phases);
+
+  Phase32 expected[kNumSamples];
+  DecimatedPilotTrackerProcessSamples(&tracker, &tracker_coeffs, input,
+                                      kNumSamples, expected);
+  Phase32 phases[kNumSamples];
+  /* Process in blocks of varying size. */
+  int start;
+  int block_size;
+  for (start = 0, block_size = 1; start < kNumSamples;
+       start += block_size, ++block_size) {
+    if (block_size > kNumSamples - start) { block_size = kNumSamples - start; }
+    DecimatedPilotTrackerProcessSamples(&block_tracker, &tracker_coeffs,
+                                        input + start, block_size,
+                                        phases + start);
+  }
+
+  int n;
+  for (n = 0; n < kNumSamples; ++n) {
+    CHECK(phases[n] == expected[n]);
+  }
+  CHECK(block_tracker.pilot_frequency == tracker.pilot_frequency);
+#undef kNumSamples
+}
+
 int main(int argc, char** argv) {
   srand(0);
   TestSteadyTone(1.0f, 500.0f, 0.0f);
@@ -113,6 +297,15 @@ int main(int argc, char** argv) {
   TestSteadyTone(0.4f, -1200.0f, 0.9f);
 
   TestWarblingTone();
+  TestProcessSamples();
+  TestPilotTracker4();
+
+  TestDecimatedTracker(500.0f, 0.0f, 0.0f);
+  TestDecimatedTracker(500.0f, 0.6f, 0.0f);
+  TestDecimatedTracker(1000.0f, 0.2f, 0.0f);
+  TestDecimatedTracker(-1200.0f, 0.9f, 0.0f);
+  TestDecimatedTracker(300.0f, 0.0f, 60.0f);
+  TestDecimatedProcessSamplesBlockSizes();
 
   puts("PASS");
   return EXIT_SUCCESS;
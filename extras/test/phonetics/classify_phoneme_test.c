@@ -45,8 +45,12 @@ static int FindPhoneme(const char* name) {
  * + ClassifyPhoneme on a short WAV recording of a pure phoneme, and checks that
  * a moderately confident score is sometimes given to the correct label.
  */
-static void TestPhoneme(const char* phoneme) {
-  printf("TestPhoneme(\"%s\")\n", phoneme);
+typedef void (*ClassifyFun)(const float*, ClassifyPhonemeLabels*,
+                            ClassifyPhonemeScores*);
+
+static void TestPhoneme(const char* phoneme, ClassifyFun classify_fun) {
+  printf("TestPhoneme(\"%s\", %s)\n", phoneme,
+         (classify_fun == ClassifyPhoneme) ? "float" : "int8");
   char wav_file[1024];
   sprintf(wav_file,
           "extras/test/testdata/phone_%s.wav",
@@ -102,7 +106,7 @@ static void TestPhoneme(const char* phoneme) {
 
     if (start < kBlockSize * (kClassifyPhonemeNumFrames - 1)) { continue; }
 
-    ClassifyPhoneme(frame_buffer, NULL, &scores);
+    classify_fun(frame_buffer, NULL, &scores);
 
     /* Count as "correct" if correct label's score is moderately confident. */
     count_correct += (scores.phoneme[intended_label] > 0.1f);
@@ -204,12 +208,260 @@ static void TestLabelOutput(void) {
   free(frames);
 }
 
+/* ClassifyPhonemeBatch produces the same results as ClassifyPhoneme on each
+ * position of the sliding window.
+ */
+static void TestBatch(int num_outputs) {
+  printf("TestBatch(%d)\n", num_outputs);
+  const int num_frames = num_outputs + kClassifyPhonemeNumFrames - 1;
+  float* frames = (float*)CHECK_NOTNULL(
+      malloc(sizeof(float) * kClassifyPhonemeNumChannels * num_frames));
+  ClassifyPhonemeLabels* labels = (ClassifyPhonemeLabels*)CHECK_NOTNULL(
+      malloc(sizeof(ClassifyPhonemeLabels) * num_outputs));
+  ClassifyPhonemeScores* scores = (ClassifyPhonemeScores*)CHECK_NOTNULL(
+      malloc(sizeof(ClassifyPhonemeScores) * num_outputs));
+  int i;
+  for (i = 0; i < kClassifyPhonemeNumChannels * num_frames; ++i) {
+    frames[i] = rand() / (float)RAND_MAX;
+  }
+
+  ClassifyPhonemeBatch(frames, num_outputs, labels, scores);
+
+  int m;
+  for (m = 0; m < num_outputs; ++m) {
+    ClassifyPhonemeLabels expected_labels;
+    ClassifyPhonemeScores expected_scores;
+    ClassifyPhoneme(frames + m * kClassifyPhonemeNumChannels,
+                    &expected_labels, &expected_scores);
+    CHECK(!memcmp(&labels[m], &expected_labels, sizeof(expected_labels)));
+    CHECK(!memcmp(&scores[m], &expected_scores, sizeof(expected_scores)));
+  }
+
+  /* Requesting only the labels should work, too. */
+  ClassifyPhonemeLabels* labels_no_scores = (ClassifyPhonemeLabels*)
+      CHECK_NOTNULL(malloc(sizeof(ClassifyPhonemeLabels) * num_outputs));
+  ClassifyPhonemeBatch(frames, num_outputs, labels_no_scores, NULL);
+  CHECK(!memcmp(labels_no_scores, labels,
+                sizeof(ClassifyPhonemeLabels) * num_outputs));
+
+  free(labels_no_scores);
+  free(scores);
+  free(labels);
+  free(frames);
+}
+
+/* ClassifyPhonemeStreamer matches ClassifyPhoneme on a window of the most
+ * recent frames, with zeros before the first frame. This holds also when
+ * outputs are skipped for some frames.
+ */
+static void TestStreamer(void) {
+  puts("TestStreamer");
+  const int kNumTestFrames = 20;
+  const int kWindowFrames = kClassifyPhonemeNumFrames - 1 + kNumTestFrames;
+  float* frames = (float*)CHECK_NOTNULL(calloc(
+      kClassifyPhonemeNumChannels * kWindowFrames, sizeof(float)));
+  /* The first kClassifyPhonemeNumFrames - 1 frames are left as zeros. */
+  float* new_frames =
+      frames + (kClassifyPhonemeNumFrames - 1) * kClassifyPhonemeNumChannels;
+  int i;
+  for (i = 0; i < kClassifyPhonemeNumChannels * kNumTestFrames; ++i) {
+    new_frames[i] = rand() / (float)RAND_MAX;
+  }
+
+  ClassifyPhonemeStreamer streamer;
+  int pass;
+  /* The second pass checks that reset works. */
+  for (pass = 0; pass < 2; ++pass) {
+    ClassifyPhonemeStreamerReset(&streamer);
+
+    int m;
+    for (m = 0; m < kNumTestFrames; ++m) {
+      if (pass == 1 && m % 3 != 2) {  /* Skip outputs for some frames. */
+        ClassifyPhonemeStreamerProcessFrame(
+            &streamer, new_frames + m * kClassifyPhonemeNumChannels,
+            NULL, NULL);
+        continue;
+      }
+      ClassifyPhonemeLabels labels;
+      ClassifyPhonemeScores scores;
+      ClassifyPhonemeStreamerProcessFrame(
+          &streamer, new_frames + m * kClassifyPhonemeNumChannels,
+          &labels, &scores);
+
+      ClassifyPhonemeLabels expected_labels;
+      ClassifyPhonemeScores expected_scores;
+      ClassifyPhoneme(frames + m * kClassifyPhonemeNumChannels,
+                      &expected_labels, &expected_scores);
+
+      /* Results differ only by float rounding. */
+      for (i = 0; i < kClassifyPhonemeNumPhonemes; ++i) {
+        CHECK(fabs(scores.phoneme[i] - expected_scores.phoneme[i]) <= 1e-3f);
+      }
+      CHECK(fabs(scores.vad - expected_scores.vad) <= 1e-3f);
+      CHECK(fabs(scores.voiced - expected_scores.voiced) <= 1e-3f);
+      CHECK(labels.phoneme == expected_labels.phoneme);
+    }
+  }
+
+  /* Requesting only the labels should work, too. */
+  ClassifyPhonemeLabels labels;
+  ClassifyPhonemeStreamerProcessFrame(&streamer, new_frames, &labels, NULL);
+  CHECK(0 <= labels.phoneme && labels.phoneme < kClassifyPhonemeNumPhonemes);
+
+  free(frames);
+}
+
+/* ClassifyPhonemeCascade returns cached results for unchanged input, and
+ * otherwise the same as ClassifyPhoneme.
+ */
+static void TestCascade(void) {
+  puts("TestCascade");
+  const int kInputSize =
+      kClassifyPhonemeNumFrames * kClassifyPhonemeNumChannels;
+  const int kMaxHoldFrames = 4;
+  float* frames = (float*)CHECK_NOTNULL(malloc(sizeof(float) * kInputSize));
+  int i;
+  for (i = 0; i < kInputSize; ++i) {
+    frames[i] = rand() / (float)RAND_MAX;
+  }
+
+  ClassifyPhonemeCascade cascade;
+  CHECK(!ClassifyPhonemeCascadeInit(&cascade, -0.1f, kMaxHoldFrames));
+  CHECK(!ClassifyPhonemeCascadeInit(&cascade, 0.02f, -1));
+  CHECK(ClassifyPhonemeCascadeInit(&cascade, 0.02f, kMaxHoldFrames));
+  CHECK(ClassifyPhonemeCascadeAverageCost(&cascade) == 0.0f);
+
+  ClassifyPhonemeLabels labels;
+  ClassifyPhonemeScores scores;
+  ClassifyPhonemeLabels expected_labels;
+  ClassifyPhonemeScores expected_scores;
+  ClassifyPhoneme(frames, &expected_labels, &expected_scores);
+
+  /* The first frame runs the full network. */
+  CHECK(ClassifyPhonemeCascadeProcess(&cascade, frames, &labels, &scores));
+  CHECK(!memcmp(&labels, &expected_labels, sizeof(labels)));
+  CHECK(!memcmp(&scores, &expected_scores, sizeof(scores)));
+
+  /* Small changes return cached results, up to kMaxHoldFrames frames. */
+  int frame;
+  for (frame = 0; frame < kMaxHoldFrames; ++frame) {
+    frames[frame] += 0.5f;
+    CHECK(!ClassifyPhonemeCascadeProcess(&cascade, frames, &labels, NULL));
+    CHECK(!memcmp(&labels, &expected_labels, sizeof(labels)));
+  }
+  CHECK(ClassifyPhonemeCascadeProcess(&cascade, frames, NULL, NULL));
+
+  /* Cost is 2 full evaluations and 4 gates over 6 frames. */
+  float cost = ClassifyPhonemeCascadeAverageCost(&cascade);
+  CHECK(2.0f / 6 < cost && cost < 2.1f / 6);
+
+  /* A large change runs the full network. */
+  for (i = 0; i < kInputSize; ++i) {
+    frames[i] = rand() / (float)RAND_MAX;
+  }
+  ClassifyPhoneme(frames, &expected_labels, &expected_scores);
+  CHECK(ClassifyPhonemeCascadeProcess(&cascade, frames, &labels, &scores));
+  CHECK(!memcmp(&labels, &expected_labels, sizeof(labels)));
+  CHECK(!memcmp(&scores, &expected_scores, sizeof(scores)));
+
+  /* With max_hold_frames = 0, the full network runs on every frame. */
+  CHECK(ClassifyPhonemeCascadeInit(&cascade, 0.02f, 0));
+  for (frame = 0; frame < 3; ++frame) {
+    CHECK(ClassifyPhonemeCascadeProcess(&cascade, frames, NULL, NULL));
+  }
+  CHECK(ClassifyPhonemeCascadeAverageCost(&cascade) == 1.0f);
+
+  free(frames);
+}
+
+/* ClassifyPhonemeInt8 usually agrees with ClassifyPhoneme. */
+static void TestInt8MatchesFloat(void) {
+  puts("TestInt8MatchesFloat");
+
+  const int kInputSize =
+      kClassifyPhonemeNumFrames * kClassifyPhonemeNumChannels;
+  float* frames = (float*)CHECK_NOTNULL(malloc(sizeof(float) * kInputSize));
+
+  ClassifyPhonemeLabels labels;
+  ClassifyPhonemeLabels labels_int8;
+  ClassifyPhonemeScores scores;
+  ClassifyPhonemeScores scores_int8;
+  const int kNumTrials = 200;
+  int num_agree = 0;
+
+  int trial;
+  for (trial = 0; trial < kNumTrials; ++trial) {
+    int i;
+    for (i = 0; i < kInputSize; ++i) {
+      frames[i] = rand() / (float)RAND_MAX;
+    }
+
+    ClassifyPhoneme(frames, &labels, &scores);
+    ClassifyPhonemeInt8(frames, &labels_int8, &scores_int8);
+    num_agree += (labels.phoneme == labels_int8.phoneme);
+
+    for (i = 0; i < kClassifyPhonemeNumPhonemes; ++i) {
+      CHECK(fabs(scores.phoneme[i] - scores_int8.phoneme[i]) <= 0.1f);
+    }
+    CHECK(fabs(scores.vad - scores_int8.vad) <= 0.1f);
+  }
+
+  CHECK(num_agree >= 0.9f * kNumTrials);
+  free(frames);
+}
+
+/* ClassifyPhonemeF16 produces nearly the same results as ClassifyPhoneme. */
+static void TestF16MatchesFloat(void) {
+  puts("TestF16MatchesFloat");
+
+  const int kInputSize =
+      kClassifyPhonemeNumFrames * kClassifyPhonemeNumChannels;
+  float* frames = (float*)CHECK_NOTNULL(malloc(sizeof(float) * kInputSize));
+
+  ClassifyPhonemeLabels labels;
+  ClassifyPhonemeLabels labels_f16;
+  ClassifyPhonemeScores scores;
+  ClassifyPhonemeScores scores_f16;
+  const int kNumTrials = 200;
+  int num_agree = 0;
+
+  int trial;
+  for (trial = 0; trial < kNumTrials; ++trial) {
+    int i;
+    for (i = 0; i < kInputSize; ++i) {
+      frames[i] = rand() / (float)RAND_MAX;
+    }
+
+    ClassifyPhoneme(frames, &labels, &scores);
+    ClassifyPhonemeF16(frames, &labels_f16, &scores_f16);
+    num_agree += (labels.phoneme == labels_f16.phoneme);
+
+    for (i = 0; i < kClassifyPhonemeNumPhonemes; ++i) {
+      CHECK(fabs(scores.phoneme[i] - scores_f16.phoneme[i]) <= 0.01f);
+    }
+    CHECK(fabs(scores.vad - scores_f16.vad) <= 0.01f);
+  }
+
+  CHECK(num_agree >= 0.98f * kNumTrials);
+  free(frames);
+}
+
 int main(int argc, char** argv) {
   srand(0);
-  TestPhoneme("ae");
-  TestPhoneme("er");
-  TestPhoneme("z");
+  TestPhoneme("ae", ClassifyPhoneme);
+  TestPhoneme("er", ClassifyPhoneme);
+  TestPhoneme("z", ClassifyPhoneme);
+  TestPhoneme("ae", ClassifyPhonemeInt8);
+  TestPhoneme("er", ClassifyPhonemeInt8);
+  TestPhoneme("z", ClassifyPhonemeInt8);
   TestLabelOutput();
+  TestBatch(1);
+  TestBatch(6);
+  TestBatch(40);
+  TestStreamer();
+  TestCascade();
+  TestInt8MatchesFloat();
+  TestF16MatchesFloat();
 
   puts("PASS");
   return EXIT_SUCCESS;
@@ -93,8 +93,57 @@ static void TestPhone(const char* phone) {
   CHECK(accuracy >= 0.7f);
 }
 
+/* EmbedVowelBatch produces the same results as EmbedVowel per frame. */
+static void TestBatch(int num_frames) {
+  printf("TestBatch(%d)\n", num_frames);
+  float* frames = (float*)CHECK_NOTNULL(
+      malloc(sizeof(float) * kEmbedVowelNumChannels * num_frames));
+  float* coords = (float*)CHECK_NOTNULL(malloc(sizeof(float) * 2 * num_frames));
+  int i;
+  for (i = 0; i < kEmbedVowelNumChannels * num_frames; ++i) {
+    frames[i] = rand() / (float)RAND_MAX;
+  }
+
+  EmbedVowelBatch(frames, num_frames, coords);
+
+  int m;
+  for (m = 0; m < num_frames; ++m) {
+    float expected[2];
+    EmbedVowel(frames + m * kEmbedVowelNumChannels, expected);
+    CHECK(coords[2 * m] == expected[0]);
+    CHECK(coords[2 * m + 1] == expected[1]);
+  }
+
+  free(coords);
+  free(frames);
+}
+
+/* EmbedVowelF16 produces nearly the same results as EmbedVowel. */
+static void TestF16MatchesFloat(void) {
+  puts("TestF16MatchesFloat");
+  float frame[kEmbedVowelNumChannels];
+  int trial;
+  for (trial = 0; trial < 200; ++trial) {
+    int i;
+    for (i = 0; i < kEmbedVowelNumChannels; ++i) {
+      frame[i] = rand() / (float)RAND_MAX;
+    }
+
+    float expected[2];
+    float coord[2];
+    EmbedVowel(frame, expected);
+    EmbedVowelF16(frame, coord);
+    CHECK(fabs(coord[0] - expected[0]) <= 0.01f);
+    CHECK(fabs(coord[1] - expected[1]) <= 0.01f);
+  }
+}
+
 int main(int argc, char** argv) {
   TestTargetLookup();
+  TestBatch(1);
+  TestBatch(7);
+  TestBatch(50);
+  TestF16MatchesFloat();
   TestPhone("aa");
   TestPhone("uw");
   TestPhone("ih");
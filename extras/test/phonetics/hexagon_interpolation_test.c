@@ -17,6 +17,7 @@
 
 #include <math.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "src/dsp/logging.h"
 #include "src/dsp/math_constants.h"
@@ -174,13 +175,102 @@ static void TestHexagonNormNearEuclideanNorm(void) {
   }
 }
 
+/* kHexagonInterpolationTable matches ComputeHexagonInterpolationTable(). */
+static void TestTableMatchesComputed(void) {
+  puts("TestTableMatchesComputed");
+  float table[7 * kHexagonTableGridSize * kHexagonTableGridSize];
+  ComputeHexagonInterpolationTable(table);
+  int i;
+  for (i = 0; i < 7 * kHexagonTableGridSize * kHexagonTableGridSize; ++i) {
+    CHECK(fabs(table[i] - kHexagonInterpolationTable[i]) <= 1e-7f);
+  }
+}
+
+/* The table lookup is close to the exact weights inside the hexagon, exact at
+ * grid points, and nonnegative everywhere.
+ */
+static void TestTableLookup(void) {
+  puts("TestTableLookup");
+  float weights[7];
+  float expected[7];
+  int n;
+  int i;
+  for (i = 0; i < 7; ++i) {  /* Grid points, including hexagon vertex (0, -1). */
+    const float x = -1.0f + (rand() % kHexagonTableGridSize) / 8.0f;
+    const float y = (i == 0) ? -1.0f
+        : -1.0f + (rand() % kHexagonTableGridSize) / 8.0f;
+    GetHexagonInterpolationWeightsTable(x, y, weights);
+    GetHexagonInterpolationWeights(x, y, expected);
+    for (n = 0; n < 7; ++n) {
+      CHECK(fabs(weights[n] - expected[n]) <= 1e-6f);
+    }
+  }
+
+  float max_error = 0.0f;
+  for (i = 0; i < 10000; ++i) {
+    const float x = 2.0f * RandUniform() - 1.0f;
+    const float y = 2.0f * RandUniform() - 1.0f;
+    GetHexagonInterpolationWeightsTable(x, y, weights);
+    for (n = 0; n < 7; ++n) {
+      CHECK(weights[n] >= 0.0f);
+    }
+    if (HexagonNorm(x, y) <= 1.0f) {
+      GetHexagonInterpolationWeights(x, y, expected);
+      for (n = 0; n < 7; ++n) {
+        const float error = fabs(weights[n] - expected[n]);
+        if (error > max_error) { max_error = error; }
+      }
+    }
+  }
+  CHECK(max_error <= 0.035f);
+
+  /* Points outside the square are clamped. */
+  GetHexagonInterpolationWeightsTable(0.0f, -5.0f, weights);
+  GetHexagonInterpolationWeights(0.0f, -1.0f, expected);
+  for (n = 0; n < 7; ++n) {
+    CHECK(fabs(weights[n] - expected[n]) <= 1e-6f);
+  }
+}
+
+/* Prints kHexagonInterpolationTable. Called if the program runs with
+ * --print_tables.
+ */
+static void PrintTables(void) {
+  float table[7 * kHexagonTableGridSize * kHexagonTableGridSize];
+  ComputeHexagonInterpolationTable(table);
+  printf("const float kHexagonInterpolationTable[\n"
+         "    7 * kHexagonTableGridSize * kHexagonTableGridSize] = {\n");
+  int i;
+  for (i = 0; i < kHexagonTableGridSize * kHexagonTableGridSize; ++i) {
+    printf("    ");
+    int n;
+    for (n = 0; n < 7; ++n) {
+      char buffer[32];
+      sprintf(buffer, "%.9g", table[7 * i + n] + 0.0f);  /* Avoid "-0". */
+      /* Ensure it is a valid float literal, e.g. "1.0f" rather than "1f". */
+      if (!strchr(buffer, '.') && !strchr(buffer, 'e')) {
+        strcat(buffer, ".0");
+      }
+      printf("%sf,%s", buffer, (n < 6) ? " " : "\n");
+    }
+  }
+  printf("};\n");
+}
+
 int main(int argc, char** argv) {
+  if (argc == 2 && !strcmp(argv[1], "--print_tables")) {
+    PrintTables();
+    return EXIT_SUCCESS;
+  }
+
   srand(0);
   TestInterpolationAtVertices();
   TestConvex();
   TestContinuity();
   TestHexagonNorm();
   TestHexagonNormNearEuclideanNorm();
+  TestTableMatchesComputed();
+  TestTableLookup();
 
   puts("PASS");
   return EXIT_SUCCESS;
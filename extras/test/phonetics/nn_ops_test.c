@@ -16,7 +16,9 @@
 #include "src/phonetics/nn_ops.h"
 
 #include <math.h>
+#include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "src/dsp/logging.h"
 
@@ -64,6 +66,290 @@ static void FillRandomValues(float* x, int size) {
   }
 }
 
+/* Batched dense layers produce the same results as per-input calls. */
+static void TestDenseLayersBatch(int num_inputs, int in_stride) {
+  printf("TestDenseLayersBatch(%d, %d)\n", num_inputs, in_stride);
+  const int kInSize = 7;
+  const int kOutSize = 5;
+  const int in_total = in_stride * (num_inputs - 1) + kInSize;
+  float* in = (float*)CHECK_NOTNULL(malloc(in_total * sizeof(float)));
+  float* weights = (float*)CHECK_NOTNULL(
+      malloc(kInSize * kOutSize * sizeof(float)));
+  float* bias = (float*)CHECK_NOTNULL(malloc(kOutSize * sizeof(float)));
+  float* out = (float*)CHECK_NOTNULL(
+      malloc(num_inputs * kOutSize * sizeof(float)));
+  float expected[5];
+  FillRandomValues(in, in_total);
+  FillRandomValues(weights, kInSize * kOutSize);
+  FillRandomValues(bias, kOutSize);
+
+  DenseLinearLayerBatch(num_inputs, kInSize, in_stride, kOutSize,
+                        in, weights, bias, out);
+  int m;
+  int j;
+  for (m = 0; m < num_inputs; ++m) {
+    DenseLinearLayer(kInSize, kOutSize, in + m * in_stride, weights, bias,
+                     expected);
+    for (j = 0; j < kOutSize; ++j) {
+      CHECK(out[m * kOutSize + j] == expected[j]);
+    }
+  }
+
+  DenseReluLayerBatch(num_inputs, kInSize, in_stride, kOutSize,
+                      in, weights, bias, out);
+  for (m = 0; m < num_inputs; ++m) {
+    DenseReluLayer(kInSize, kOutSize, in + m * in_stride, weights, bias,
+                   expected);
+    for (j = 0; j < kOutSize; ++j) {
+      CHECK(out[m * kOutSize + j] == expected[j]);
+    }
+  }
+
+  free(out);
+  free(bias);
+  free(weights);
+  free(in);
+}
+
+/* Int8 dense layers approximate the float layers with dequantized weights. */
+static void TestDenseLayersInt8(int in_size, int out_size) {
+  printf("TestDenseLayersInt8(%d, %d)\n", in_size, out_size);
+  float* in = (float*)CHECK_NOTNULL(malloc(in_size * sizeof(float)));
+  int8_t* weights_q = (int8_t*)CHECK_NOTNULL(
+      malloc(in_size * out_size * sizeof(int8_t)));
+  float* weights = (float*)CHECK_NOTNULL(
+      malloc(in_size * out_size * sizeof(float)));
+  float* weight_scales = (float*)CHECK_NOTNULL(malloc(out_size * sizeof(float)));
+  float* bias = (float*)CHECK_NOTNULL(malloc(out_size * sizeof(float)));
+  float* out = (float*)CHECK_NOTNULL(malloc(out_size * sizeof(float)));
+  float* expected = (float*)CHECK_NOTNULL(malloc(out_size * sizeof(float)));
+
+  FillRandomValues(in, in_size);
+  FillRandomValues(bias, out_size);
+  int j;
+  for (j = 0; j < out_size; ++j) {
+    weight_scales[j] = 0.01f * (j + 1);
+    int k;
+    for (k = 0; k < in_size; ++k) {
+      const int i = k + in_size * j;
+      weights_q[i] = (int8_t)((rand() % 255) - 127);
+      weights[i] = weight_scales[j] * weights_q[i];
+    }
+  }
+
+  /* Error comes from rounding the input to 16 bits. */
+  float in_max_abs = 0.0f;
+  int k;
+  for (k = 0; k < in_size; ++k) {
+    in_max_abs = (fabs(in[k]) > in_max_abs) ? fabs(in[k]) : in_max_abs;
+  }
+
+  DenseLinearLayer(in_size, out_size, in, weights, bias, expected);
+  DenseLinearLayerInt8(in_size, out_size, in, weights_q, weight_scales, bias,
+                       out);
+  for (j = 0; j < out_size; ++j) {
+    const float tol = 1e-4f + 0.5f * in_size * weight_scales[j] * 127.0f
+        * in_max_abs / 32767.0f;
+    CHECK(fabs(out[j] - expected[j]) <= tol);
+  }
+
+  DenseReluLayer(in_size, out_size, in, weights, bias, expected);
+  DenseReluLayerInt8(in_size, out_size, in, weights_q, weight_scales, bias,
+                     out);
+  for (j = 0; j < out_size; ++j) {
+    const float tol = 1e-4f + 0.5f * in_size * weight_scales[j] * 127.0f
+        * in_max_abs / 32767.0f;
+    CHECK(out[j] >= 0.0f);
+    CHECK(fabs(out[j] - expected[j]) <= tol);
+  }
+
+  /* With zero input, the output is the bias. */
+  for (k = 0; k < in_size; ++k) {
+    in[k] = 0.0f;
+  }
+  DenseLinearLayerInt8(in_size, out_size, in, weights_q, weight_scales, bias,
+                       out);
+  for (j = 0; j < out_size; ++j) {
+    CHECK(out[j] == bias[j]);
+  }
+
+  free(expected);
+  free(out);
+  free(bias);
+  free(weight_scales);
+  free(weights);
+  free(weights_q);
+  free(in);
+}
+
+/* Gets the bit pattern of a float. */
+static uint32_t FloatBits(float x) {
+  uint32_t bits;
+  memcpy(&bits, &x, sizeof(bits));
+  return bits;
+}
+
+/* Float16ToFloat() converts every binary16 bit pattern exactly. Results are
+ * compared as bit patterns, so that signed zeros, infinities, and NaNs are
+ * checked without the C99 classification macros.
+ */
+static void TestFloat16ToFloat(void) {
+  puts("TestFloat16ToFloat");
+  CHECK(Float16ToFloat(0x0000) == 0.0f);
+  CHECK(Float16ToFloat(0x3c00) == 1.0f);
+  CHECK(Float16ToFloat(0xc000) == -2.0f);
+  CHECK(Float16ToFloat(0x3555) == 0.333251953125f);
+  CHECK(Float16ToFloat(0x7bff) == 65504.0f);  /* Largest finite. */
+  CHECK(Float16ToFloat(0x0001) == ldexp(1.0, -24));  /* Smallest subnormal. */
+  /* Negative zero. */
+  CHECK(FloatBits(Float16ToFloat(0x8000)) == UINT32_C(0x80000000));
+  /* Infinities. */
+  CHECK(FloatBits(Float16ToFloat(0x7c00)) == UINT32_C(0x7f800000));
+  CHECK(FloatBits(Float16ToFloat(0xfc00)) == UINT32_C(0xff800000));
+  /* Quiet NaN. */
+  CHECK(FloatBits(Float16ToFloat(0x7e00)) == UINT32_C(0x7fc00000));
+
+  int bits;
+  for (bits = 0; bits < 0x10000; ++bits) {
+    const int exponent = (bits >> 10) & 0x1f;
+    const int mantissa = bits & 0x3ff;
+    uint32_t expected_bits;
+    if (exponent == 0x1f) {
+      /* Infinity or NaN, with the NaN payload in the high mantissa bits. */
+      expected_bits = ((uint32_t)(bits & 0x8000) << 16) |
+                      UINT32_C(0x7f800000) | ((uint32_t)mantissa << 13);
+    } else {
+      double expected = (exponent == 0)
+          ? ldexp(mantissa, -24) : ldexp(1024 + mantissa, exponent - 25);
+      if (bits & 0x8000) { expected = -expected; }
+      expected_bits = FloatBits((float)expected);
+    }
+    CHECK(FloatBits(Float16ToFloat((uint16_t)bits)) == expected_bits);
+  }
+}
+
+/* The F16 dense layers match the float layers on the converted weights. */
+static void TestDenseLayersF16(int in_size, int out_size) {
+  printf("TestDenseLayersF16(%d, %d)\n", in_size, out_size);
+  float* in = (float*)CHECK_NOTNULL(malloc(in_size * sizeof(float)));
+  uint16_t* weights_f16 = (uint16_t*)CHECK_NOTNULL(
+      malloc(in_size * out_size * sizeof(uint16_t)));
+  float* weights = (float*)CHECK_NOTNULL(
+      malloc(in_size * out_size * sizeof(float)));
+  float* bias = (float*)CHECK_NOTNULL(malloc(out_size * sizeof(float)));
+  float* out = (float*)CHECK_NOTNULL(malloc(out_size * sizeof(float)));
+  float* expected = (float*)CHECK_NOTNULL(malloc(out_size * sizeof(float)));
+
+  FillRandomValues(in, in_size);
+  FillRandomValues(bias, out_size);
+  int i;
+  for (i = 0; i < in_size * out_size; ++i) {
+    /* Random normal weights with magnitude in [2^-14, 4). */
+    const int exponent = rand() % 16 + 1;
+    weights_f16[i] = (uint16_t)(((rand() & 1) << 15) | (exponent << 10) |
+                                (rand() & 0x3ff));
+    weights[i] = Float16ToFloat(weights_f16[i]);
+  }
+
+  int j;
+  DenseLinearLayer(in_size, out_size, in, weights, bias, expected);
+  DenseLinearLayerF16(in_size, out_size, in, weights_f16, bias, out);
+  for (j = 0; j < out_size; ++j) {
+    CHECK(out[j] == expected[j]);
+  }
+
+  DenseReluLayer(in_size, out_size, in, weights, bias, expected);
+  DenseReluLayerF16(in_size, out_size, in, weights_f16, bias, out);
+  for (j = 0; j < out_size; ++j) {
+    CHECK(out[j] == expected[j]);
+  }
+
+  free(expected);
+  free(out);
+  free(bias);
+  free(weights);
+  free(weights_f16);
+  free(in);
+}
+
+/* The sparse dense layers match the dense layers on the same weights, where
+ * about `prune_fraction` of the 4x1 blocks are zero.
+ */
+static void TestDenseLayersSparse(int in_size, int out_size,
+                                  float prune_fraction) {
+  printf("TestDenseLayersSparse(%d, %d, %g)\n",
+         in_size, out_size, prune_fraction);
+  const int num_groups = (out_size + 3) / 4;
+  float* in = (float*)CHECK_NOTNULL(malloc(in_size * sizeof(float)));
+  float* weights = (float*)CHECK_NOTNULL(
+      malloc(in_size * out_size * sizeof(float)));
+  uint16_t* group_begin = (uint16_t*)CHECK_NOTNULL(
+      malloc((num_groups + 1) * sizeof(uint16_t)));
+  uint16_t* block_input = (uint16_t*)CHECK_NOTNULL(
+      malloc(in_size * num_groups * sizeof(uint16_t)));
+  float* block_weights = (float*)CHECK_NOTNULL(
+      malloc(4 * in_size * num_groups * sizeof(float)));
+  float* bias = (float*)CHECK_NOTNULL(malloc(out_size * sizeof(float)));
+  float* out = (float*)CHECK_NOTNULL(malloc(out_size * sizeof(float)));
+  float* expected = (float*)CHECK_NOTNULL(malloc(out_size * sizeof(float)));
+
+  FillRandomValues(in, in_size);
+  FillRandomValues(weights, in_size * out_size);
+  FillRandomValues(bias, out_size);
+
+  /* Prune random blocks and convert the remaining blocks to sparse form. */
+  int num_blocks = 0;
+  int g;
+  for (g = 0; g < num_groups; ++g) {
+    group_begin[g] = (uint16_t)num_blocks;
+    int k;
+    for (k = 0; k < in_size; ++k) {
+      const int prune = (rand() / (float)RAND_MAX < prune_fraction);
+      int c;
+      for (c = 0; c < 4; ++c) {
+        const int j = 4 * g + c;
+        float value = 0.0f;
+        if (j < out_size) {
+          if (prune) { weights[k + in_size * j] = 0.0f; }
+          value = weights[k + in_size * j];
+        }
+        block_weights[4 * num_blocks + c] = value;
+      }
+      if (!prune) { block_input[num_blocks++] = (uint16_t)k; }
+    }
+  }
+  group_begin[num_groups] = (uint16_t)num_blocks;
+
+  DenseSparseWeights sparse;
+  sparse.in_size = in_size;
+  sparse.out_size = out_size;
+  sparse.group_begin = group_begin;
+  sparse.block_input = block_input;
+  sparse.block_weights = block_weights;
+
+  int j;
+  DenseLinearLayer(in_size, out_size, in, weights, bias, expected);
+  DenseLinearLayerSparse(&sparse, in, bias, out);
+  for (j = 0; j < out_size; ++j) {
+    CHECK(out[j] == expected[j]);
+  }
+
+  DenseReluLayer(in_size, out_size, in, weights, bias, expected);
+  DenseReluLayerSparse(&sparse, in, bias, out);
+  for (j = 0; j < out_size; ++j) {
+    CHECK(out[j] == expected[j]);
+  }
+
+  free(expected);
+  free(out);
+  free(bias);
+  free(block_weights);
+  free(block_input);
+  free(group_begin);
+  free(weights);
+  free(in);
+}
+
 static void TestConv1DReluLayer(int in_channels, int out_channels) {
   printf("TestConv1DReluLayer(%d, %d)\n", in_channels, out_channels);
   const int kInFrames = 5;
@@ -116,6 +402,73 @@ static void TestConv1DReluLayer(int in_channels, int out_channels) {
   free(in);
 }
 
+/* The packed conv layers produce the same results as Conv1DReluLayer(),
+ * followed by MaxPool1DLayer() for the fused version.
+ */
+static void TestConv1DReluLayerPacked(int in_frames, int in_channels,
+                                      int out_channels, int kernel_size) {
+  printf("TestConv1DReluLayerPacked(%d, %d, %d, %d)\n",
+         in_frames, in_channels, out_channels, kernel_size);
+  const int conv_frames = in_frames - kernel_size + 1;
+  const int pool_frames = conv_frames / 2;
+  const int filters_size = in_channels * kernel_size * out_channels;
+  const int packed_size =
+      Conv1DPackedFiltersSize(in_channels, out_channels, kernel_size);
+  CHECK(packed_size >= filters_size);
+  CHECK(packed_size % 4 == 0);
+
+  float* in = (float*)CHECK_NOTNULL(
+      malloc(in_frames * in_channels * sizeof(float)));
+  float* filters = (float*)CHECK_NOTNULL(malloc(filters_size * sizeof(float)));
+  float* packed = (float*)CHECK_NOTNULL(malloc(packed_size * sizeof(float)));
+  float* bias = (float*)CHECK_NOTNULL(malloc(out_channels * sizeof(float)));
+  float* expected = (float*)CHECK_NOTNULL(
+      malloc(conv_frames * out_channels * sizeof(float)));
+  float* expected_pool = (float*)CHECK_NOTNULL(
+      malloc((pool_frames + 1) * out_channels * sizeof(float)));
+  /* One extra frame, to check that nothing is written past the end. */
+  float* out = (float*)CHECK_NOTNULL(
+      malloc((conv_frames + 1) * out_channels * sizeof(float)));
+
+  FillRandomValues(in, in_frames * in_channels);
+  FillRandomValues(filters, filters_size);
+  FillRandomValues(bias, out_channels);
+  Conv1DPackFilters(in_channels, out_channels, kernel_size, filters, packed);
+
+  Conv1DReluLayer(in_frames, in_channels, out_channels, kernel_size,
+                  in, filters, bias, expected);
+  MaxPool1DLayer(conv_frames, out_channels, expected, expected_pool);
+
+  int i;
+  for (i = 0; i < (conv_frames + 1) * out_channels; ++i) {
+    out[i] = 99.0f;
+  }
+  Conv1DReluLayerPacked(in_frames, in_channels, out_channels, kernel_size,
+                        in, packed, bias, out);
+  for (i = 0; i < conv_frames * out_channels; ++i) {
+    CHECK(out[i] == expected[i]);
+  }
+  CHECK(out[conv_frames * out_channels] == 99.0f);
+
+  for (i = 0; i < (conv_frames + 1) * out_channels; ++i) {
+    out[i] = 99.0f;
+  }
+  Conv1DReluMaxPoolLayerPacked(in_frames, in_channels, out_channels,
+                               kernel_size, in, packed, bias, out);
+  for (i = 0; i < pool_frames * out_channels; ++i) {
+    CHECK(out[i] == expected_pool[i]);
+  }
+  CHECK(out[pool_frames * out_channels] == 99.0f);
+
+  free(out);
+  free(expected_pool);
+  free(expected);
+  free(bias);
+  free(packed);
+  free(filters);
+  free(in);
+}
+
 static void TestMaxPool1DLayer(void) {
   puts("TestMaxPool1DLayer");
   /* Input with 7 frames and 2 channels. */
@@ -165,9 +518,27 @@ static void TestSoftmax(void) {
 int main(int argc, char** argv) {
   srand(0);
   TestDenseLayers();
+  TestDenseLayersBatch(1, 7);
+  TestDenseLayersBatch(4, 7);
+  TestDenseLayersBatch(11, 7);
+  TestDenseLayersBatch(11, 2);  /* Overlapping inputs. */
+  TestDenseLayersInt8(3, 2);
+  TestDenseLayersInt8(280, 96);
+  TestDenseLayersInt8(kDenseInt8MaxInSize, 5);
+  TestFloat16ToFloat();
+  TestDenseLayersF16(3, 2);
+  TestDenseLayersF16(280, 96);
+  TestDenseLayersSparse(3, 2, 0.0f);
+  TestDenseLayersSparse(7, 5, 0.5f);
+  TestDenseLayersSparse(280, 96, 0.75f);
+  TestDenseLayersSparse(64, 32, 1.0f);
   TestConv1DReluLayer(1, 1);
   TestConv1DReluLayer(3, 2);
   TestConv1DReluLayer(2, 3);
+  TestConv1DReluLayerPacked(5, 1, 1, 3);
+  TestConv1DReluLayerPacked(12, 3, 4, 3);
+  TestConv1DReluLayerPacked(13, 5, 6, 2);
+  TestConv1DReluLayerPacked(30, 56, 9, 5);
   TestMaxPool1DLayer();
   TestSoftmax();
 
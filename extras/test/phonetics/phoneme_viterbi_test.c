@@ -0,0 +1,263 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "src/phonetics/phoneme_viterbi.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "src/dsp/logging.h"
+
+#define kNumPhonemes kClassifyPhonemeNumPhonemes
+
+/* Random float distributed uniformly in [0, 1]. */
+static float RandUniform(void) { return (float)rand() / RAND_MAX; }
+
+/* Fills `scores` with random softmax-like scores, with `phoneme` boosted. */
+static void RandomScores(int phoneme, float boost, float* scores) {
+  float sum = 0.0f;
+  int j;
+  for (j = 0; j < kNumPhonemes; ++j) {
+    scores[j] = RandUniform() + 0.01f + (j == phoneme ? boost : 0.0f);
+    sum += scores[j];
+  }
+  for (j = 0; j < kNumPhonemes; ++j) {
+    scores[j] /= sum;
+  }
+}
+
+/* Runs the decoder over `num_frames` frames of `scores` and gets the label of
+ * every frame, using PhonemeViterbiFlush() for the last frames.
+ */
+static void Decode(PhonemeViterbi* viterbi, const float* scores,
+                   int num_frames, int* labels) {
+  int num_labels = 0;
+  int i;
+  for (i = 0; i < num_frames; ++i) {
+    const int phoneme =
+        PhonemeViterbiProcessFrame(viterbi, scores + kNumPhonemes * i);
+    if (i < viterbi->lag) {
+      CHECK(phoneme == -1);
+    } else {
+      CHECK(0 <= phoneme && phoneme < kNumPhonemes);
+      labels[num_labels++] = phoneme;
+    }
+  }
+  num_labels += PhonemeViterbiFlush(viterbi, labels + num_labels);
+  CHECK(num_labels == num_frames);
+}
+
+/* Single-frame blips of another phoneme are smoothed out. */
+static void TestRemovesFlicker(void) {
+  puts("TestRemovesFlicker");
+  const int kNumFrames = 60;
+  float* scores = (float*)CHECK_NOTNULL(
+      malloc(sizeof(float) * kNumPhonemes * kNumFrames));
+  int* labels = (int*)CHECK_NOTNULL(malloc(sizeof(int) * kNumFrames));
+  int i;
+  for (i = 0; i < kNumFrames; ++i) {
+    const int phoneme = (i < 30) ? 5 : 9;
+    /* Every 7th frame, a different phoneme narrowly wins the argmax. */
+    const int blip = (i % 7 == 3) ? 20 : phoneme;
+    float* frame_scores = scores + kNumPhonemes * i;
+    memset(frame_scores, 0, sizeof(float) * kNumPhonemes);
+    frame_scores[phoneme] = 0.4f;
+    frame_scores[blip] = (blip == phoneme) ? 0.7f : 0.45f;
+  }
+
+  PhonemeViterbiParams params;
+  PhonemeViterbiSetDefaultParams(&params);
+  PhonemeViterbi viterbi;
+  CHECK(PhonemeViterbiInit(&viterbi, &params));
+
+  int trial;
+  for (trial = 0; trial < 2; ++trial) {
+    Decode(&viterbi, scores, kNumFrames, labels);
+    for (i = 0; i < kNumFrames; ++i) {
+      CHECK(labels[i] == ((i < 30) ? 5 : 9));
+    }
+    PhonemeViterbiReset(&viterbi);
+  }
+
+  free(labels);
+  free(scores);
+}
+
+/* Log probability of the transition `from` -> `to` under `params`. */
+static float TransitionLogProb(const PhonemeViterbiParams* params,
+                               int from, int to) {
+  if (from == to) { return params->stay_log_prob; }
+  float log_prob = params->switch_log_prob;
+  int k;
+  for (k = 0; k < params->num_arcs; ++k) {
+    const PhonemeViterbiArc* arc = &params->arcs[k];
+    if (arc->from == from && arc->to == to && arc->log_prob > log_prob) {
+      log_prob = arc->log_prob;
+    }
+  }
+  return log_prob;
+}
+
+/* Offline Viterbi with a dense transition matrix, for reference. */
+static void ReferenceViterbi(const PhonemeViterbiParams* params,
+                             const float* scores, int num_frames,
+                             int* labels) {
+  double* path_log_prob = (double*)CHECK_NOTNULL(
+      malloc(sizeof(double) * kNumPhonemes * num_frames));
+  int* backpointers = (int*)CHECK_NOTNULL(
+      malloc(sizeof(int) * kNumPhonemes * num_frames));
+  int t;
+  for (t = 0; t < num_frames; ++t) {
+    int j;
+    for (j = 0; j < kNumPhonemes; ++j) {
+      double best = 0.0;
+      int best_from = j;
+      if (t > 0) {
+        int i;
+        best = -HUGE_VAL;
+        for (i = 0; i < kNumPhonemes; ++i) {
+          const double log_prob = path_log_prob[kNumPhonemes * (t - 1) + i] +
+                                  TransitionLogProb(params, i, j);
+          if (log_prob > best) {
+            best = log_prob;
+            best_from = i;
+          }
+        }
+      }
+      const float score = scores[kNumPhonemes * t + j];
+      path_log_prob[kNumPhonemes * t + j] =
+          best + log(score > params->min_score ? score : params->min_score);
+      backpointers[kNumPhonemes * t + j] = best_from;
+    }
+  }
+
+  int state = 0;
+  int j;
+  for (j = 1; j < kNumPhonemes; ++j) {
+    if (path_log_prob[kNumPhonemes * (num_frames - 1) + j] >
+        path_log_prob[kNumPhonemes * (num_frames - 1) + state]) {
+      state = j;
+    }
+  }
+  for (t = num_frames - 1; t >= 0; --t) {
+    labels[t] = state;
+    state = backpointers[kNumPhonemes * t + state];
+  }
+
+  free(backpointers);
+  free(path_log_prob);
+}
+
+/* With lag covering the whole input, the result is the exact Viterbi path. */
+static void TestMatchesReference(float switch_log_prob) {
+  printf("TestMatchesReference(%g)\n", switch_log_prob);
+  const int kNumFrames = kPhonemeViterbiMaxLag;
+  PhonemeViterbiArc arcs[120];
+  int k;
+  for (k = 0; k < 120; ++k) {
+    arcs[k].from = rand() % kNumPhonemes;
+    arcs[k].to = (arcs[k].from + 1 + rand() % (kNumPhonemes - 1))
+        % kNumPhonemes;
+    arcs[k].log_prob = -1.0f - 3.0f * RandUniform();
+  }
+  /* Ensure every state is reachable without generic transitions. */
+  for (k = 0; k < kNumPhonemes; ++k) {
+    arcs[k].from = (k + 1) % kNumPhonemes;
+    arcs[k].to = k;
+  }
+
+  PhonemeViterbiParams params;
+  PhonemeViterbiSetDefaultParams(&params);
+  params.lag = kPhonemeViterbiMaxLag;
+  params.switch_log_prob = switch_log_prob;
+  params.arcs = arcs;
+  params.num_arcs = 120;
+  PhonemeViterbi viterbi;
+  CHECK(PhonemeViterbiInit(&viterbi, &params));
+
+  float* scores = (float*)CHECK_NOTNULL(
+      malloc(sizeof(float) * kNumPhonemes * kNumFrames));
+  int expected[kPhonemeViterbiMaxLag];
+  int actual[kPhonemeViterbiMaxLag];
+  int trial;
+  for (trial = 0; trial < 5; ++trial) {
+    int i;
+    for (i = 0; i < kNumFrames; ++i) {
+      RandomScores(rand() % kNumPhonemes, 0.5f, scores + kNumPhonemes * i);
+    }
+    ReferenceViterbi(&params, scores, kNumFrames, expected);
+
+    PhonemeViterbiReset(&viterbi);
+    Decode(&viterbi, scores, kNumFrames, actual);
+    for (i = 0; i < kNumFrames; ++i) {
+      CHECK(actual[i] == expected[i]);
+    }
+  }
+
+  free(scores);
+}
+
+/* With zero lag and uniform transitions, the result is the per-frame argmax. */
+static void TestZeroLagUniform(void) {
+  puts("TestZeroLagUniform");
+  PhonemeViterbiParams params;
+  PhonemeViterbiSetDefaultParams(&params);
+  params.lag = 0;
+  params.stay_log_prob = log(1.0 / kNumPhonemes);
+  params.switch_log_prob = params.stay_log_prob;
+  PhonemeViterbi viterbi;
+  CHECK(PhonemeViterbiInit(&viterbi, &params));
+
+  float scores[kNumPhonemes];
+  int i;
+  for (i = 0; i < 100; ++i) {
+    const int phoneme = rand() % kNumPhonemes;
+    RandomScores(phoneme, 2.0f, scores);
+    CHECK(PhonemeViterbiProcessFrame(&viterbi, scores) == phoneme);
+  }
+  CHECK(PhonemeViterbiFlush(&viterbi, NULL) == 0);
+}
+
+static void TestInvalidParams(void) {
+  puts("TestInvalidParams");
+  PhonemeViterbi viterbi;
+  PhonemeViterbiParams params;
+  PhonemeViterbiSetDefaultParams(&params);
+  params.lag = kPhonemeViterbiMaxLag + 1;
+  CHECK(!PhonemeViterbiInit(&viterbi, &params));
+
+  PhonemeViterbiArc arc = {3, 3, -1.0f};
+  PhonemeViterbiSetDefaultParams(&params);
+  params.arcs = &arc;
+  params.num_arcs = 1;
+  CHECK(!PhonemeViterbiInit(&viterbi, &params));
+  arc.to = kNumPhonemes;
+  CHECK(!PhonemeViterbiInit(&viterbi, &params));
+  arc.to = 4;
+  CHECK(PhonemeViterbiInit(&viterbi, &params));
+}
+
+int main(int argc, char** argv) {
+  srand(0);
+  TestRemovesFlicker();
+  TestMatchesReference(log(0.02));
+  TestMatchesReference(kPhonemeViterbiImpossible);
+  TestZeroLagUniform();
+  TestInvalidParams();
+
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,96 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "src/tactile/deadline_monitor.h"
+
+#include <math.h>
+
+#include "src/dsp/logging.h"
+
+/* Overruns and near misses are counted against the budget. */
+static void TestCounts(void) {
+  puts("TestCounts");
+  DeadlineMonitor monitor;
+  CHECK(DeadlineMonitorInit(&monitor, 1000));
+
+  DeadlineMonitorStats stats;
+  DeadlineMonitorGetStats(&monitor, &stats);
+  CHECK(stats.num_buffers == 0);
+  CHECK(stats.mean_load == 0.0f);
+  CHECK(stats.max_load == 0.0f);
+
+  DeadlineMonitorRecord(&monitor, 500);   /* Within budget. */
+  DeadlineMonitorRecord(&monitor, 900);   /* Exactly 90%, not a near miss. */
+  DeadlineMonitorRecord(&monitor, 901);   /* Near miss. */
+  DeadlineMonitorRecord(&monitor, 1000);  /* Exactly on budget, near miss. */
+  DeadlineMonitorRecord(&monitor, 1001);  /* Overrun. */
+  DeadlineMonitorRecord(&monitor, 2000);  /* Overrun. */
+  CHECK(fabs(DeadlineMonitorLastLoad(&monitor) - 2.0f) < 1e-6f);
+
+  DeadlineMonitorGetStats(&monitor, &stats);
+  CHECK(stats.num_buffers == 6);
+  CHECK(stats.num_overruns == 2);
+  CHECK(stats.num_near_misses == 2);
+  CHECK(fabs(stats.mean_load - 6302.0f / 6000.0f) < 1e-6f);
+  CHECK(fabs(stats.max_load - 2.0f) < 1e-6f);
+
+  DeadlineMonitorReset(&monitor);
+  DeadlineMonitorGetStats(&monitor, &stats);
+  CHECK(stats.num_buffers == 0);
+  CHECK(stats.num_overruns == 0);
+  CHECK(stats.num_near_misses == 0);
+  CHECK(stats.max_load == 0.0f);
+}
+
+static void TestStartFinish(void) {
+  puts("TestStartFinish");
+  DeadlineMonitor monitor;
+  CHECK(DeadlineMonitorInit(&monitor, UINT32_C(1) << 30));
+
+  int buffer;
+  for (buffer = 0; buffer < 4; ++buffer) {
+    DeadlineMonitorStartBuffer(&monitor);
+    volatile float sum = 0.0f;
+    int i;
+    for (i = 0; i < 10000; ++i) {
+      sum += (float)i;
+    }
+    DeadlineMonitorFinishBuffer(&monitor);
+  }
+
+  DeadlineMonitorStats stats;
+  DeadlineMonitorGetStats(&monitor, &stats);
+  CHECK(stats.num_buffers == 4);
+  CHECK(stats.num_overruns == 0);
+  CHECK(0.0f <= stats.mean_load);
+  CHECK(stats.mean_load <= stats.max_load);
+  CHECK(stats.max_load < 1.0f);
+}
+
+static void TestInvalidInit(void) {
+  puts("TestInvalidInit");
+  DeadlineMonitor monitor;
+  CHECK(!DeadlineMonitorInit(NULL, 1000));
+  CHECK(!DeadlineMonitorInit(&monitor, 0));
+}
+
+int main(int argc, char** argv) {
+  TestCounts();
+  TestStartFinish();
+  TestInvalidInit();
+
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,139 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "src/tactile/energy_meter.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+#include "src/dsp/logging.h"
+
+/* Sample rate such that one minute is 600 PWM frames. */
+#define kSampleRateHz 10.0f
+#define kTicksPerSecond 1000
+#define kMaxValue 512
+#define kStride 4
+
+/* Fills `buffer` with a strided PWM channel of constant `value`. */
+static void FillChannel(uint16_t* buffer, int num_frames, uint16_t value) {
+  int i;
+  for (i = 0; i < num_frames; ++i) {
+    buffer[i * kStride] = value;
+  }
+}
+
+/* Per-minute drive power and CPU fraction from constant PWM levels. */
+static void TestMinuteStats(void) {
+  puts("TestMinuteStats");
+  const int kNumFrames = 8;
+  uint16_t buffers[3][8 * kStride];
+  FillChannel(buffers[0], kNumFrames, kMaxValue / 2);  /* Zero drive. */
+  FillChannel(buffers[1], kNumFrames, kMaxValue);      /* Full scale. */
+  FillChannel(buffers[2], kNumFrames, kMaxValue / 4);  /* Half scale. */
+  const uint16_t* pwm_channels[3] = {buffers[0], buffers[1], buffers[2]};
+
+  EnergyMeter meter;
+  CHECK(EnergyMeterInit(&meter, 3, kSampleRateHz, kTicksPerSecond));
+  EnergyMeterStats stats;
+  EnergyMeterGetStats(&meter, &stats);
+  CHECK(stats.num_minutes == 0);
+  CHECK(stats.channel_power[1] == 0.0f);
+
+  /* 600 frames per minute is 75 blocks of 8 frames. Run 1.5 minutes. */
+  int block;
+  int num_completed = 0;
+  for (block = 0; block < 112; ++block) {
+    EnergyMeterAddCpuTicks(&meter, 200);  /* 25% of the 0.8 s block. */
+    EnergyMeterAddPwm(&meter, pwm_channels, kNumFrames, kStride, kMaxValue);
+    if (EnergyMeterMinuteCompleted(&meter)) {
+      CHECK(block == 74);
+      ++num_completed;
+    }
+  }
+  CHECK(num_completed == 1);
+
+  EnergyMeterGetStats(&meter, &stats);
+  CHECK(stats.num_minutes == 1);
+  CHECK(stats.channel_power[0] == 0.0f);
+  CHECK(fabs(stats.channel_power[1] - 1.0f) < 1e-6f);
+  CHECK(fabs(stats.channel_power[2] - 0.25f) < 1e-6f);
+  CHECK(stats.channel_power[3] == 0.0f);
+  CHECK(fabs(stats.cpu_active_fraction - 0.25f) < 1e-6f);
+  /* The smoothed power converges to the sum over channels. */
+  CHECK(fabs(EnergyMeterPower(&meter) - 1.25f) < 1e-3f);
+
+  EnergyMeterReset(&meter);
+  EnergyMeterGetStats(&meter, &stats);
+  CHECK(stats.num_minutes == 0);
+  CHECK(stats.channel_power[1] == 0.0f);
+  CHECK(EnergyMeterPower(&meter) == 0.0f);
+}
+
+/* A block straddling a minute boundary is split between the two minutes. */
+static void TestBlockStraddlesMinute(void) {
+  puts("TestBlockStraddlesMinute");
+  const int kNumFrames = 500;
+  uint16_t* buffer = (uint16_t*)CHECK_NOTNULL(
+      malloc(kNumFrames * kStride * sizeof(uint16_t)));
+  const uint16_t* pwm_channels[1] = {buffer};
+
+  EnergyMeter meter;
+  CHECK(EnergyMeterInit(&meter, 1, kSampleRateHz, kTicksPerSecond));
+  /* First minute: 500 frames full scale, then 100 frames of zero drive. */
+  FillChannel(buffer, kNumFrames, kMaxValue);
+  EnergyMeterAddPwm(&meter, pwm_channels, kNumFrames, kStride, kMaxValue);
+  CHECK(!EnergyMeterMinuteCompleted(&meter));
+  FillChannel(buffer, 100, kMaxValue / 2);
+  FillChannel(buffer + 100 * kStride, kNumFrames - 100, 0);
+  /* This block completes the first minute, and its last 400 frames at full
+   * scale (value 0, x = -1) count toward the second.
+   */
+  EnergyMeterAddPwm(&meter, pwm_channels, kNumFrames, kStride, kMaxValue);
+  CHECK(EnergyMeterMinuteCompleted(&meter));
+
+  EnergyMeterStats stats;
+  EnergyMeterGetStats(&meter, &stats);
+  CHECK(stats.num_minutes == 1);
+  CHECK(fabs(stats.channel_power[0] - 500.0f / 600.0f) < 1e-6f);
+
+  FillChannel(buffer, 200, kMaxValue / 2);
+  EnergyMeterAddPwm(&meter, pwm_channels, 200, kStride, kMaxValue);
+  CHECK(EnergyMeterMinuteCompleted(&meter));
+  EnergyMeterGetStats(&meter, &stats);
+  CHECK(stats.num_minutes == 2);
+  CHECK(fabs(stats.channel_power[0] - 400.0f / 600.0f) < 1e-6f);
+
+  free(buffer);
+}
+
+static void TestInvalidInit(void) {
+  puts("TestInvalidInit");
+  EnergyMeter meter;
+  CHECK(!EnergyMeterInit(NULL, 1, kSampleRateHz, kTicksPerSecond));
+  CHECK(!EnergyMeterInit(&meter, 0, kSampleRateHz, kTicksPerSecond));
+  CHECK(!EnergyMeterInit(&meter, kEnergyMeterMaxChannels + 1, kSampleRateHz,
+                         kTicksPerSecond));
+  CHECK(!EnergyMeterInit(&meter, 1, 0.0f, kTicksPerSecond));
+  CHECK(!EnergyMeterInit(&meter, 1, kSampleRateHz, 0));
+}
+
+int main(int argc, char** argv) {
+  TestMinuteStats();
+  TestBlockStraddlesMinute();
+  TestInvalidInit();
+
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
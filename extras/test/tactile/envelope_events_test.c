@@ -0,0 +1,195 @@
+/* Copyright 2021 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "src/tactile/envelope_events.h"
+
+#include <math.h>
+
+#include "src/dsp/logging.h"
+#include "src/dsp/math_constants.h"
+
+#define kNumChannels 12
+#define kNumFrames 2000
+
+/* Random float distributed uniformly in [0, 1]. */
+static float RandUniform(void) { return (float)rand() / RAND_MAX; }
+
+/* Makes test envelopes: silence, slow modulation, and abrupt onsets. */
+static void MakeEnvelopes(float* input) {
+  int c;
+  for (c = 0; c < kNumChannels; ++c) {
+    const float rate = 0.002f + 0.03f * RandUniform();
+    const float phase = 2 * M_PI * RandUniform();
+    const int onset = rand() % kNumFrames;
+    int n;
+    for (n = 0; n < kNumFrames; ++n) {
+      float value = 0.5f + 0.6f * sin(2 * M_PI * rate * n + phase);
+      if (n < onset || (n / 300) % 2 == 0) { value *= 0.05f; }
+      input[n * kNumChannels + c] = value;  /* Slightly out of [0, 1]. */
+    }
+  }
+}
+
+/* Encodes `input`, and decodes in chunks of at most `max_events` events. */
+static int RoundTrip(const EnvelopeEventEncoderParams* params,
+                     const float* input, float* output) {
+  EnvelopeEventEncoder encoder;
+  CHECK(EnvelopeEventEncoderInit(&encoder, params, kNumChannels));
+  EnvelopeEventDecoder decoder;
+  CHECK(EnvelopeEventDecoderInit(&decoder, kNumChannels));
+
+  uint8_t* events = (uint8_t*)CHECK_NOTNULL(
+      malloc(kEnvelopeEventBytes * (kNumFrames + 1) * kNumChannels));
+  int num_events = 0;
+  int n = 0;
+  while (n < kNumFrames) {
+    int block_size = 1 + rand() % 50;
+    if (block_size > kNumFrames - n) { block_size = kNumFrames - n; }
+    num_events += EnvelopeEventEncoderProcessFrames(
+        &encoder, input + n * kNumChannels, block_size,
+        events + kEnvelopeEventBytes * num_events);
+    n += block_size;
+  }
+  num_events += EnvelopeEventEncoderFlush(
+      &encoder, events + kEnvelopeEventBytes * num_events);
+
+  const uint8_t* src = events;
+  int events_left = num_events;
+  int num_frames = 0;
+  while (events_left > 0) {
+    const int num_decoded = EnvelopeEventDecoderProcessEvents(
+        &decoder, src, events_left);
+    CHECK(num_decoded >= 0);
+    src += kEnvelopeEventBytes * num_decoded;
+    events_left -= num_decoded;
+    num_frames += EnvelopeEventDecoderReadFrames(
+        &decoder, output + num_frames * kNumChannels, kNumFrames - num_frames);
+  }
+  CHECK(num_frames == kNumFrames);
+  CHECK(EnvelopeEventDecoderReadFrames(&decoder, output, 1) == 0);
+
+  free(events);
+  return num_events;
+}
+
+/* Reconstruction is within the tolerance, using a fraction of the bandwidth. */
+static void TestRoundTrip(void) {
+  puts("TestRoundTrip");
+  float* input = (float*)CHECK_NOTNULL(
+      malloc(sizeof(float) * kNumFrames * kNumChannels));
+  float* output = (float*)CHECK_NOTNULL(
+      malloc(sizeof(float) * kNumFrames * kNumChannels));
+  MakeEnvelopes(input);
+
+  EnvelopeEventEncoderParams params;
+  EnvelopeEventEncoderSetDefaultParams(&params);
+  const int num_events = RoundTrip(&params, input, output);
+
+  int i;
+  for (i = 0; i < kNumFrames * kNumChannels; ++i) {
+    float expected = input[i];
+    if (expected < 0.0f) { expected = 0.0f; }
+    if (expected > 1.0f) { expected = 1.0f; }
+    const float tolerance = params.min_change +
+        params.relative_change * expected + 0.5f / 255 + 1e-5f;
+    CHECK(fabs(output[i] - expected) <= tolerance);
+  }
+  /* Sending every frame takes one byte per channel per frame. */
+  const float fraction = (float)(kEnvelopeEventBytes * num_events) /
+                         (kNumFrames * kNumChannels);
+  CHECK(fraction < 0.2f);
+
+  free(output);
+  free(input);
+}
+
+/* Silence is sent as one keyframe per channel per max_interval frames. */
+static void TestSilence(void) {
+  puts("TestSilence");
+  float* input = (float*)CHECK_NOTNULL(
+      malloc(sizeof(float) * kNumFrames * kNumChannels));
+  float* output = (float*)CHECK_NOTNULL(
+      malloc(sizeof(float) * kNumFrames * kNumChannels));
+  int i;
+  for (i = 0; i < kNumFrames * kNumChannels; ++i) {
+    input[i] = 0.0f;
+  }
+
+  EnvelopeEventEncoderParams params;
+  EnvelopeEventEncoderSetDefaultParams(&params);
+  const int num_events = RoundTrip(&params, input, output);
+  CHECK(num_events == kNumChannels * ((kNumFrames + params.max_interval - 1) /
+                                      params.max_interval));
+  for (i = 0; i < kNumFrames * kNumChannels; ++i) {
+    CHECK(output[i] == 0.0f);
+  }
+
+  free(output);
+  free(input);
+}
+
+/* With max_interval = 1, every frame is sent with 8-bit quantization. */
+static void TestEveryFrame(void) {
+  puts("TestEveryFrame");
+  float* input = (float*)CHECK_NOTNULL(
+      malloc(sizeof(float) * kNumFrames * kNumChannels));
+  float* output = (float*)CHECK_NOTNULL(
+      malloc(sizeof(float) * kNumFrames * kNumChannels));
+  int i;
+  for (i = 0; i < kNumFrames * kNumChannels; ++i) {
+    input[i] = (rand() % 256) / 255.0f;
+  }
+
+  EnvelopeEventEncoderParams params;
+  EnvelopeEventEncoderSetDefaultParams(&params);
+  params.max_interval = 1;
+  CHECK(RoundTrip(&params, input, output) == kNumFrames * kNumChannels);
+  for (i = 0; i < kNumFrames * kNumChannels; ++i) {
+    CHECK(output[i] == input[i]);
+  }
+
+  free(output);
+  free(input);
+}
+
+static void TestInvalid(void) {
+  puts("TestInvalid");
+  EnvelopeEventEncoderParams params;
+  EnvelopeEventEncoderSetDefaultParams(&params);
+  EnvelopeEventEncoder encoder;
+  CHECK(!EnvelopeEventEncoderInit(&encoder, &params, 0));
+  CHECK(!EnvelopeEventEncoderInit(&encoder, &params,
+                                  kEnvelopeEventsMaxChannels + 1));
+  params.max_interval = kEnvelopeEventsMaxInterval + 1;
+  CHECK(!EnvelopeEventEncoderInit(&encoder, &params, 4));
+
+  EnvelopeEventDecoder decoder;
+  CHECK(!EnvelopeEventDecoderInit(&decoder, 0));
+  CHECK(EnvelopeEventDecoderInit(&decoder, 4));
+  const uint8_t events[4] = {0x32, 100, 0x05, 100};  /* Channel 5 is invalid. */
+  CHECK(EnvelopeEventDecoderProcessEvents(&decoder, events, 1) == 1);
+  CHECK(EnvelopeEventDecoderProcessEvents(&decoder, events + 2, 1) == -1);
+}
+
+int main(int argc, char** argv) {
+  srand(0);
+  TestRoundTrip();
+  TestSilence();
+  TestEveryFrame();
+  TestInvalid();
+
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
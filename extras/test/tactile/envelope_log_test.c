@@ -0,0 +1,263 @@
+/* Copyright 2021 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "src/tactile/envelope_log.h"
+
+#include <string.h>
+
+#include "src/dsp/logging.h"
+
+#define kPageSize 128
+#define kNumPages 4
+#define kBaseAddress 0x1000
+/* (128 - 8) / 17 = 7 entries per page. */
+#define kEntriesPerPage 7
+
+/* Fake flash in RAM. Like real flash, writes may only clear bits. */
+typedef struct {
+  uint8_t bytes[kNumPages * kPageSize];
+  int num_erases[kNumPages];
+} FakeFlash;
+
+static void FakeRead(void* user_data, uint32_t address, uint8_t* dest,
+                     int size) {
+  FakeFlash* fake = (FakeFlash*)user_data;
+  CHECK(kBaseAddress <= address &&
+        address + size <= kBaseAddress + sizeof(fake->bytes));
+  memcpy(dest, fake->bytes + (address - kBaseAddress), size);
+}
+
+static int FakeWrite(void* user_data, uint32_t address, const uint8_t* src,
+                     int size) {
+  FakeFlash* fake = (FakeFlash*)user_data;
+  CHECK(kBaseAddress <= address &&
+        address + size <= kBaseAddress + sizeof(fake->bytes));
+  uint8_t* dest = fake->bytes + (address - kBaseAddress);
+  int i;
+  for (i = 0; i < size; ++i) {
+    CHECK(dest[i] == 0xff);  /* Only erased bytes may be written. */
+    dest[i] = src[i];
+  }
+  return 1;
+}
+
+static int FakeErasePage(void* user_data, uint32_t address) {
+  FakeFlash* fake = (FakeFlash*)user_data;
+  CHECK((address - kBaseAddress) % kPageSize == 0);
+  const int page = (address - kBaseAddress) / kPageSize;
+  CHECK(0 <= page && page < kNumPages);
+  memset(fake->bytes + page * kPageSize, 0xff, kPageSize);
+  ++fake->num_erases[page];
+  return 1;
+}
+
+/* Makes a fake flash with arbitrary initial content. */
+static void FakeFlashInit(FakeFlash* fake, EnvelopeLogFlash* flash) {
+  int i;
+  for (i = 0; i < kNumPages * kPageSize; ++i) {
+    fake->bytes[i] = (uint8_t)rand();
+  }
+  memset(fake->num_erases, 0, sizeof(fake->num_erases));
+  flash->read = FakeRead;
+  flash->write = FakeWrite;
+  flash->erase_page = FakeErasePage;
+  flash->user_data = fake;
+}
+
+/* Makes a record whose bytes are determined by `timestamp`. */
+static void MakeRecord(uint32_t timestamp, uint8_t* record) {
+  int i;
+  for (i = 0; i < kEnvelopeTrackerRecordBytes; ++i) {
+    record[i] = (uint8_t)(timestamp * 7 + i);
+  }
+}
+
+static void Append(EnvelopeLog* log, uint32_t timestamp) {
+  uint8_t record[kEnvelopeTrackerRecordBytes];
+  MakeRecord(timestamp, record);
+  CHECK(EnvelopeLogAppend(log, timestamp, record));
+}
+
+/* Checks that the log holds entries with timestamps `first` to `last`. */
+static void CheckContents(const EnvelopeLog* log, uint32_t first,
+                          uint32_t last) {
+  EnvelopeLogCursor cursor;
+  EnvelopeLogReadBegin(log, &cursor);
+  EnvelopeLogEntry entry;
+  uint32_t expected;
+  for (expected = first; expected <= last; ++expected) {
+    CHECK(EnvelopeLogReadNext(log, &cursor, &entry));
+    CHECK(entry.timestamp == expected);
+    uint8_t record[kEnvelopeTrackerRecordBytes];
+    MakeRecord(expected, record);
+    CHECK(memcmp(entry.record, record, kEnvelopeTrackerRecordBytes) == 0);
+  }
+  CHECK(!EnvelopeLogReadNext(log, &cursor, &entry));
+}
+
+/* Gets the oldest timestamp in the log after appending timestamps 1 to `t`.
+ * The log holds all full pages except the oldest, plus the head page.
+ */
+static uint32_t OldestTimestamp(uint32_t t) {
+  const uint32_t num_head = (t - 1) % kEntriesPerPage + 1;
+  const uint32_t max_entries = (kNumPages - 1) * kEntriesPerPage + num_head;
+  return (t > max_entries) ? t - max_entries + 1 : 1;
+}
+
+static void TestAppendAndRead(void) {
+  puts("TestAppendAndRead");
+  FakeFlash fake;
+  EnvelopeLogFlash flash;
+  FakeFlashInit(&fake, &flash);
+  EnvelopeLog log;
+  CHECK(EnvelopeLogInit(&log, &flash, kBaseAddress, kPageSize, kNumPages));
+  CHECK(log.entries_per_page == kEntriesPerPage);
+
+  EnvelopeLogCursor cursor;
+  EnvelopeLogReadBegin(&log, &cursor);
+  EnvelopeLogEntry entry;
+  CHECK(!EnvelopeLogReadNext(&log, &cursor, &entry));  /* Empty log. */
+
+  uint32_t t;
+  for (t = 1; t <= 10; ++t) {
+    Append(&log, t);
+  }
+  CheckContents(&log, 1, 10);
+
+  /* Entries appended while reading are also read. */
+  EnvelopeLogReadBegin(&log, &cursor);
+  for (t = 1; t <= 10; ++t) {
+    CHECK(EnvelopeLogReadNext(&log, &cursor, &entry));
+  }
+  CHECK(!EnvelopeLogReadNext(&log, &cursor, &entry));
+  Append(&log, 11);
+  CHECK(EnvelopeLogReadNext(&log, &cursor, &entry));
+  CHECK(entry.timestamp == 11);
+}
+
+/* When the ring wraps, the oldest page is dropped and pages wear evenly. */
+static void TestWrapAround(void) {
+  puts("TestWrapAround");
+  FakeFlash fake;
+  EnvelopeLogFlash flash;
+  FakeFlashInit(&fake, &flash);
+  EnvelopeLog log;
+  CHECK(EnvelopeLogInit(&log, &flash, kBaseAddress, kPageSize, kNumPages));
+
+  uint32_t t;
+  for (t = 1; t <= 1000; ++t) {
+    Append(&log, t);
+    if (t % 37 == 0 || t == 1000) {
+      CheckContents(&log, OldestTimestamp(t), t);
+    }
+  }
+
+  int page;
+  for (page = 0; page < kNumPages; ++page) {
+    CHECK(abs(fake.num_erases[page] - fake.num_erases[0]) <= 1);
+  }
+}
+
+/* Log is recovered after reinitializing, e.g. after power loss. */
+static void TestReinit(void) {
+  puts("TestReinit");
+  FakeFlash fake;
+  EnvelopeLogFlash flash;
+  FakeFlashInit(&fake, &flash);
+  EnvelopeLog log;
+  CHECK(EnvelopeLogInit(&log, &flash, kBaseAddress, kPageSize, kNumPages));
+
+  uint32_t t;
+  for (t = 1; t <= 60; ++t) {
+    Append(&log, t);
+
+    EnvelopeLog log2;
+    CHECK(EnvelopeLogInit(&log2, &flash, kBaseAddress, kPageSize, kNumPages));
+    CHECK(log2.head_page == log.head_page);
+    CHECK(log2.head_entry == log.head_entry);
+    CHECK(log2.head_sequence == log.head_sequence);
+  }
+  CHECK(EnvelopeLogInit(&log, &flash, kBaseAddress, kPageSize, kNumPages));
+  CheckContents(&log, OldestTimestamp(60), 60);
+
+  /* Simulate power loss in the middle of writing an entry. */
+  const uint32_t address = kBaseAddress + log.head_page * kPageSize +
+                           kEnvelopeLogPageHeaderBytes +
+                           log.head_entry * kEnvelopeLogEntryBytes;
+  fake.bytes[address - kBaseAddress + 6] = 0;
+  CHECK(EnvelopeLogInit(&log, &flash, kBaseAddress, kPageSize, kNumPages));
+  /* The partial entry is skipped when reading and when appending. */
+  Append(&log, 61);
+  EnvelopeLogCursor cursor;
+  EnvelopeLogReadBegin(&log, &cursor);
+  EnvelopeLogEntry entry;
+  uint32_t last = 0;
+  while (EnvelopeLogReadNext(&log, &cursor, &entry)) {
+    CHECK(entry.timestamp > last);
+    last = entry.timestamp;
+  }
+  CHECK(last == 61);
+}
+
+static void TestClear(void) {
+  puts("TestClear");
+  FakeFlash fake;
+  EnvelopeLogFlash flash;
+  FakeFlashInit(&fake, &flash);
+  EnvelopeLog log;
+  CHECK(EnvelopeLogInit(&log, &flash, kBaseAddress, kPageSize, kNumPages));
+
+  uint32_t t;
+  for (t = 1; t <= 50; ++t) {
+    Append(&log, t);
+  }
+  CHECK(EnvelopeLogClear(&log));
+  EnvelopeLogCursor cursor;
+  EnvelopeLogReadBegin(&log, &cursor);
+  EnvelopeLogEntry entry;
+  CHECK(!EnvelopeLogReadNext(&log, &cursor, &entry));
+
+  for (t = 100; t <= 105; ++t) {
+    Append(&log, t);
+  }
+  CHECK(EnvelopeLogInit(&log, &flash, kBaseAddress, kPageSize, kNumPages));
+  CheckContents(&log, 100, 105);
+}
+
+static void TestInvalid(void) {
+  puts("TestInvalid");
+  FakeFlash fake;
+  EnvelopeLogFlash flash;
+  FakeFlashInit(&fake, &flash);
+  EnvelopeLog log;
+  CHECK(!EnvelopeLogInit(&log, &flash, kBaseAddress, 24, kNumPages));
+  CHECK(!EnvelopeLogInit(&log, &flash, kBaseAddress, kPageSize, 0));
+  CHECK(EnvelopeLogInit(&log, &flash, kBaseAddress, kPageSize, 1));
+
+  uint8_t record[kEnvelopeTrackerRecordBytes] = {0};
+  CHECK(!EnvelopeLogAppend(&log, kEnvelopeLogInvalidTimestamp, record));
+}
+
+int main(int argc, char** argv) {
+  srand(0);
+  TestAppendAndRead();
+  TestWrapAround();
+  TestReinit();
+  TestClear();
+  TestInvalid();
+
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
@@ -124,10 +124,41 @@ static void TestStreamingRandomBlockSizes(void) {
   free(input);
 }
 
+/* Batched decoding matches decoding records one at a time. */
+static void TestDecodeRecords(void) {
+  puts("TestDecodeRecords");
+  const int kNumRecords = 20;
+  uint8_t* records = (uint8_t*)CHECK_NOTNULL(
+      malloc(kNumRecords * kEnvelopeTrackerRecordBytes));
+  float* decoded = (float*)CHECK_NOTNULL(
+      malloc(kNumRecords * kEnvelopeTrackerRecordPoints * sizeof(float)));
+  int i;
+  /* Arbitrary bytes, including records whose deltas drift out of [0, 255]. */
+  for (i = 0; i < kNumRecords * kEnvelopeTrackerRecordBytes; ++i) {
+    records[i] = (uint8_t)rand();
+  }
+
+  EnvelopeTrackerDecodeRecords(records, kNumRecords, decoded);
+
+  for (i = 0; i < kNumRecords; ++i) {
+    float expected[kEnvelopeTrackerRecordPoints];
+    EnvelopeTrackerDecodeRecord(records + i * kEnvelopeTrackerRecordBytes,
+                                expected);
+    int j;
+    for (j = 0; j < kEnvelopeTrackerRecordPoints; ++j) {
+      CHECK(decoded[i * kEnvelopeTrackerRecordPoints + j] == expected[j]);
+    }
+  }
+
+  free(decoded);
+  free(records);
+}
+
 int main(int argc, char** argv) {
   srand(0);
   TestBasic();
   TestStreamingRandomBlockSizes();
+  TestDecodeRecords();
 
   puts("PASS");
   return EXIT_SUCCESS;
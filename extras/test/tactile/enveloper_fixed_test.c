@@ -0,0 +1,183 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "src/tactile/enveloper_fixed.h"
+
+#include <math.h>
+
+#include "src/dsp/logging.h"
+#include "src/dsp/math_constants.h"
+
+/* Max absolute difference between fixed and float outputs after warm up. */
+static const float kTolerance = 0.01f;
+
+static float Taper(float t, float t_min, float t_max) {
+  float x = (t - t_min) / 0.005f;
+  float y = (t_max - t) / 0.005f;
+  x = (x < 0.0f) ? 0.0f : ((x > 1.0f) ? 1.0f : x);
+  y = (y < 0.0f) ? 0.0f : ((y > 1.0f) ? 1.0f : y);
+  return x * y;
+}
+
+/* Generates Q15 test audio with noise and tones in each Enveloper band. */
+static int16_t* GenerateInput(float sample_rate_hz, int num_samples) {
+  static const float kFrequencies[4] = {120.0f, 900.0f, 3000.0f, 5000.0f};
+  static const float kAmplitudes[3] = {0.3f, 0.05f, 0.01f};
+  int16_t* input = (int16_t*)CHECK_NOTNULL(
+      malloc(num_samples * sizeof(int16_t)));
+  srand(0);
+  int i;
+  for (i = 0; i < num_samples; ++i) {
+    const float t = i / sample_rate_hz;
+    /* Noise at about -50 dBFS. */
+    float value = 1e-2f * ((float)rand() / RAND_MAX - 0.5f);
+    /* Starting from t = 0.6, play a 0.1 s burst every 0.15 s, cycling through
+     * frequencies and amplitudes.
+     */
+    if (t >= 0.6f) {
+      const int burst = (int)((t - 0.6f) / 0.15f);
+      const float t_start = 0.6f + 0.15f * burst;
+      value += kAmplitudes[burst % 3] *
+          sin(2.0 * M_PI * kFrequencies[burst % 4] * t) *
+          Taper(t, t_start, t_start + 0.1f);
+    }
+    input[i] = (int16_t)floor(32768.0f * value + 0.5f);
+  }
+  return input;
+}
+
+/* Runs fixed and float Enveloper on the same input and compares outputs. */
+static void CompareToFloat(Enveloper* enveloper,
+                           EnveloperFixed* enveloper_fixed,
+                           float sample_rate_hz, int decimation_factor) {
+  const int num_samples = (int)(2.5f * sample_rate_hz);
+  const int num_frames = num_samples / decimation_factor;
+  const int warm_up_frames = (int)(0.6f * sample_rate_hz / decimation_factor);
+  int16_t* input = GenerateInput(sample_rate_hz, num_samples);
+  float* input_float = (float*)CHECK_NOTNULL(
+      malloc(num_samples * sizeof(float)));
+  float* output = (float*)CHECK_NOTNULL(malloc(
+      num_frames * kEnveloperNumChannels * sizeof(float)));
+  int32_t* output_fixed = (int32_t*)CHECK_NOTNULL(malloc(
+      num_frames * kEnveloperNumChannels * sizeof(int32_t)));
+
+  int i;
+  for (i = 0; i < num_samples; ++i) {
+    input_float[i] = input[i] / 32768.0f;
+  }
+
+  /* Process in blocks of 64 samples. */
+  const int kBlockSize = 64;
+  for (i = 0; i + kBlockSize <= num_samples; i += kBlockSize) {
+    const int offset = (i / decimation_factor) * kEnveloperNumChannels;
+    EnveloperProcessSamples(enveloper, input_float + i, kBlockSize,
+                            output + offset);
+    EnveloperFixedProcessSamples(enveloper_fixed, input + i, kBlockSize,
+                                 output_fixed + offset);
+  }
+
+  const int end = (i / decimation_factor) * kEnveloperNumChannels;
+  float max_output = 0.0f;
+  float max_diff = 0.0f;
+  for (i = warm_up_frames * kEnveloperNumChannels; i < end; ++i) {
+    const float value = FixedToFloat(output_fixed[i],
+                                     kEnveloperFixedOutputFracBits);
+    const float diff = fabs(value - output[i]);
+    if (diff > max_diff) { max_diff = diff; }
+    if (output[i] > max_output) { max_output = output[i]; }
+  }
+  printf("  max output: %g, max diff: %g\n", max_output, max_diff);
+  CHECK(max_output > 0.5f);  /* Check that the bursts were detected. */
+  CHECK(max_diff <= kTolerance);
+
+  free(output_fixed);
+  free(output);
+  free(input_float);
+  free(input);
+}
+
+static void TestCompareToFloat(float sample_rate_hz, int decimation_factor) {
+  printf("TestCompareToFloat(%g, %d)\n", sample_rate_hz, decimation_factor);
+  Enveloper enveloper;
+  CHECK(EnveloperInit(&enveloper, &kDefaultEnveloperParams,
+                      sample_rate_hz, decimation_factor));
+  EnveloperFixed enveloper_fixed;
+  CHECK(EnveloperFixedInit(&enveloper_fixed, &kDefaultEnveloperParams,
+                           sample_rate_hz, decimation_factor));
+
+  CompareToFloat(&enveloper, &enveloper_fixed,
+                 sample_rate_hz, decimation_factor);
+}
+
+/* Test EnveloperFixedSetParams() with tuned parameters. */
+static void TestSetParams(void) {
+  puts("TestSetParams");
+  const float kSampleRateHz = 16000.0f;
+  const int kDecimationFactor = 8;
+  Enveloper enveloper;
+  CHECK(EnveloperInit(&enveloper, &kDefaultEnveloperParams,
+                      kSampleRateHz, kDecimationFactor));
+
+  /* Change parameters as TactileProcessorApplyTuning() does. */
+  enveloper.noise_coeffs[1] = EnveloperGrowthCoeff(&enveloper, 5.0f);
+  enveloper.gate_transition_factor = DecibelsToPowerRatio(5.0f);
+  enveloper.agc_exponent = -0.5f;
+  enveloper.compressor_exponent = 0.4f;
+  int c;
+  for (c = 0; c < kEnveloperNumChannels; ++c) {
+    enveloper.channels[c].gate_thresh_factor = 3.0f + c;
+    enveloper.channels[c].output_gain = 1.5f;
+  }
+  EnveloperUpdatePrecomputedParams(&enveloper);
+  EnveloperReset(&enveloper);
+
+  EnveloperFixed enveloper_fixed;
+  CHECK(EnveloperFixedInit(&enveloper_fixed, &kDefaultEnveloperParams,
+                           kSampleRateHz, kDecimationFactor));
+  CHECK(EnveloperFixedSetParams(&enveloper_fixed, &enveloper));
+  EnveloperFixedReset(&enveloper_fixed);
+
+  CompareToFloat(&enveloper, &enveloper_fixed,
+                 kSampleRateHz, kDecimationFactor);
+}
+
+/* Silent input produces zero output. */
+static void TestSilence(void) {
+  puts("TestSilence");
+  EnveloperFixed enveloper_fixed;
+  CHECK(EnveloperFixedInit(&enveloper_fixed, &kDefaultEnveloperParams,
+                           16000.0f, 8));
+  int16_t input[64] = {0};
+  int32_t output[8 * kEnveloperNumChannels];
+  int block;
+  for (block = 0; block < 500; ++block) {
+    EnveloperFixedProcessSamples(&enveloper_fixed, input, 64, output);
+    int i;
+    for (i = 0; i < 8 * kEnveloperNumChannels; ++i) {
+      CHECK(abs(output[i]) <= 2);
+    }
+  }
+}
+
+int main(int argc, char** argv) {
+  TestCompareToFloat(16000.0f, 1);
+  TestCompareToFloat(16000.0f, 8);
+  TestCompareToFloat(44100.0f, 4);
+  TestSetParams();
+  TestSilence();
+
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
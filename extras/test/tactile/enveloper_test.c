@@ -16,6 +16,7 @@
 #include "src/tactile/enveloper.h"
 
 #include <math.h>
+#include <string.h>
 
 #include "src/dsp/logging.h"
 #include "src/dsp/math_constants.h"
@@ -216,6 +217,580 @@ static void TestStreaming(int decimation_factor) {
   free(input);
 }
 
+/* EnveloperProcessSamplesChannelMajor() gives identical output and state as
+ * EnveloperProcessSamples().
+ */
+static void TestChannelMajor(int decimation_factor) {
+  printf("TestChannelMajor(%d)\n", decimation_factor);
+  srand(0);
+  const int kChannels = kEnveloperNumChannels;
+  const float sample_rate_hz = 16000.0f;
+  const int output_frames = 8000;
+  const int input_size = output_frames * decimation_factor;
+  float* input = (float*)CHECK_NOTNULL(malloc(input_size * sizeof(float)));
+  float* expected = (float*)CHECK_NOTNULL(malloc(
+      output_frames * kChannels * sizeof(float)));
+  float* actual = (float*)CHECK_NOTNULL(malloc(
+      output_frames * kChannels * sizeof(float)));
+  int i;
+  for (i = 0; i < input_size; ++i) {
+    float t = i / sample_rate_hz;
+    input[i] = 1e-2f * ((float) rand() / RAND_MAX - 0.5f);
+    /* Bursts of tones at different frequencies to exercise all channels. */
+    if (fmod(t, 0.25) > 0.15) {
+      input[i] += 0.2f * sin(2.0 * M_PI * (200.0 + 6000.0 * t) * t);
+    }
+  }
+
+  Enveloper enveloper;
+  CHECK(EnveloperInit(&enveloper, &kDefaultEnveloperParams,
+                      sample_rate_hz, decimation_factor));
+  Enveloper enveloper_channel_major = enveloper;
+
+  int start = 0;
+  while (start < input_size) {
+    /* Process blocks of between 64 and 256 samples. */
+    int input_block_size = decimation_factor *
+        ((64 + rand() / (RAND_MAX / 193)) / decimation_factor);
+    if (input_block_size > input_size - start) {
+      input_block_size = input_size - start;
+    }
+
+    const int offset = (start / decimation_factor) * kChannels;
+    EnveloperProcessSamples(&enveloper, input + start, input_block_size,
+                            expected + offset);
+    EnveloperProcessSamplesChannelMajor(
+        &enveloper_channel_major, input + start, input_block_size,
+        actual + offset);
+    start += input_block_size;
+  }
+
+  for (i = 0; i < output_frames * kChannels; ++i) {
+    CHECK(actual[i] == expected[i]);
+  }
+  CHECK(enveloper_channel_major.warm_up_counter == enveloper.warm_up_counter);
+  int c;
+  for (c = 0; c < kChannels; ++c) {
+    const EnveloperChannel* expected_c = &enveloper.channels[c];
+    const EnveloperChannel* actual_c = &enveloper_channel_major.channels[c];
+    CHECK(enveloper_channel_major.biquad_z[1][0][c] ==
+          enveloper.biquad_z[1][0][c]);
+    CHECK(enveloper_channel_major.biquad_z[2][1][c] ==
+          enveloper.biquad_z[2][1][c]);
+    CHECK(actual_c->smoothed_energy == expected_c->smoothed_energy);
+    CHECK(actual_c->noise == expected_c->noise);
+    CHECK(actual_c->smoothed_gain == expected_c->smoothed_gain);
+  }
+
+  free(actual);
+  free(expected);
+  free(input);
+}
+
+/* With `use_fast_pow_table`, the output is close to that with FastPow(), the
+ * channel-major output is still identical, and the tables follow tuning.
+ */
+static void TestFastPowTable(int decimation_factor) {
+  printf("TestFastPowTable(%d)\n", decimation_factor);
+  srand(0);
+  const int kChannels = kEnveloperNumChannels;
+  const float sample_rate_hz = 16000.0f;
+  const int output_frames = 8000;
+  const int input_size = output_frames * decimation_factor;
+  const int output_size = output_frames * kChannels;
+  float* input = (float*)CHECK_NOTNULL(malloc(input_size * sizeof(float)));
+  float* expected = (float*)CHECK_NOTNULL(malloc(output_size * sizeof(float)));
+  float* actual = (float*)CHECK_NOTNULL(malloc(output_size * sizeof(float)));
+  float* channel_major = (float*)CHECK_NOTNULL(
+      malloc(output_size * sizeof(float)));
+  int i;
+  for (i = 0; i < input_size; ++i) {
+    float t = i / sample_rate_hz;
+    input[i] = 1e-2f * ((float) rand() / RAND_MAX - 0.5f);
+    if (fmod(t, 0.25) > 0.15) {
+      input[i] += 0.2f * sin(2.0 * M_PI * (200.0 + 6000.0 * t) * t);
+    }
+  }
+
+  EnveloperParams params = kDefaultEnveloperParams;
+  Enveloper enveloper;
+  CHECK(EnveloperInit(&enveloper, &params, sample_rate_hz, decimation_factor));
+  EnveloperProcessSamples(&enveloper, input, input_size, expected);
+
+  params.use_fast_pow_table = 1;
+  CHECK(EnveloperInit(&enveloper, &params, sample_rate_hz, decimation_factor));
+  Enveloper enveloper_channel_major = enveloper;
+  EnveloperProcessSamples(&enveloper, input, input_size, actual);
+  EnveloperProcessSamplesChannelMajor(&enveloper_channel_major, input,
+                                      input_size, channel_major);
+
+  float max_expected = 0.0f;
+  for (i = 0; i < output_size; ++i) {
+    if (expected[i] > max_expected) { max_expected = expected[i]; }
+  }
+  CHECK(max_expected > 0.1f);
+  for (i = 0; i < output_size; ++i) {
+    CHECK(channel_major[i] == actual[i]);
+    CHECK(fabs(actual[i] - expected[i]) <= 0.01f * max_expected);
+  }
+
+  /* Changing the exponents through tuning regenerates the tables. */
+  EnveloperTuning tuning;
+  EnveloperGetTuning(&enveloper, &tuning);
+  tuning.agc_exponent = -0.4f;
+  tuning.compressor_exponent = 0.35f;
+  EnveloperUpdateTuning(&enveloper, &tuning,
+                        kEnveloperTuningCompressorChanged);
+  EnveloperSetTuning(&enveloper, &tuning);
+  FastPowTable table;
+  FastPowTableInit(&table, -0.4f);
+  CHECK(memcmp(&enveloper.agc_pow_table, &table, sizeof(table)) == 0);
+  FastPowTableInit(&table, 0.35f);
+  CHECK(memcmp(&enveloper.compressor_pow_table, &table, sizeof(table)) == 0);
+
+  free(channel_major);
+  free(actual);
+  free(expected);
+  free(input);
+}
+
+/* With output decimation, decimated channels hold their output, are close to
+ * the undecimated output, and channel-major processing gives identical output.
+ */
+static void TestOutputDecimation(int decimation_factor) {
+  printf("TestOutputDecimation(%d)\n", decimation_factor);
+  srand(0);
+  const int kChannels = kEnveloperNumChannels;
+  const float sample_rate_hz = 16000.0f;
+  const int output_frames = (int)(2.0f * sample_rate_hz) / decimation_factor;
+  const int input_size = output_frames * decimation_factor;
+  const int output_size = output_frames * kChannels;
+  float* input = (float*)CHECK_NOTNULL(malloc(input_size * sizeof(float)));
+  float* expected = (float*)CHECK_NOTNULL(malloc(output_size * sizeof(float)));
+  float* actual = (float*)CHECK_NOTNULL(malloc(output_size * sizeof(float)));
+  float* channel_major = (float*)CHECK_NOTNULL(
+      malloc(output_size * sizeof(float)));
+  int i;
+  for (i = 0; i < input_size; ++i) {
+    float t = i / sample_rate_hz;
+    input[i] = 1e-2f * ((float) rand() / RAND_MAX - 0.5f);
+    /* Bursts of a tone in each channel's band, starting after warm up. */
+    if (t > 0.5f && fmod(t, 0.25) > 0.15) {
+      input[i] += 0.1f * (sin(2.0 * M_PI * 250.0 * t) +
+                          sin(2.0 * M_PI * 1000.0 * t) +
+                          sin(2.0 * M_PI * 3000.0 * t) +
+                          sin(2.0 * M_PI * 5000.0 * t));
+    }
+  }
+
+  EnveloperParams params = kDefaultEnveloperParams;
+  Enveloper enveloper;
+  CHECK(EnveloperInit(&enveloper, &params, sample_rate_hz, decimation_factor));
+  EnveloperProcessSamples(&enveloper, input, input_size, expected);
+
+  params.channel_params[0].output_decimation = 0;
+  CHECK(!EnveloperInit(&enveloper, &params, sample_rate_hz,
+                       decimation_factor));
+  /* Update the baseband at 2 kHz, as suggested in enveloper.h. */
+  params.channel_params[0].output_decimation = 8 / decimation_factor;
+  params.channel_params[1].output_decimation = 2;
+  CHECK(EnveloperInit(&enveloper, &params, sample_rate_hz, decimation_factor));
+  Enveloper enveloper_channel_major = enveloper;
+
+  int start = 0;
+  while (start < input_size) {
+    /* Process blocks of varying size, so holds span block boundaries. */
+    int input_block_size = decimation_factor *
+        ((64 + rand() / (RAND_MAX / 193)) / decimation_factor);
+    if (input_block_size > input_size - start) {
+      input_block_size = input_size - start;
+    }
+    const int offset = (start / decimation_factor) * kChannels;
+    EnveloperProcessSamples(&enveloper, input + start, input_block_size,
+                            actual + offset);
+    EnveloperProcessSamplesChannelMajor(
+        &enveloper_channel_major, input + start, input_block_size,
+        channel_major + offset);
+    start += input_block_size;
+  }
+
+  for (i = 0; i < output_size; ++i) {
+    CHECK(channel_major[i] == actual[i]);
+  }
+
+  const int num_warm_up_frames = enveloper.num_warm_up_samples;
+  /* Number of frames in 10 ms. */
+  const int window = (int)(0.01f * sample_rate_hz) / decimation_factor;
+  int c;
+  for (c = 0; c < kChannels; ++c) {
+    const int factor = params.channel_params[c].output_decimation;
+    double sum_diff = 0.0;
+    double sum_expected = 0.0;
+    double window_actual = 0.0;
+    double window_expected = 0.0;
+    for (i = 0; i < output_frames; ++i) {
+      const int index = kChannels * i + c;
+      if (i < num_warm_up_frames) {
+        CHECK(actual[index] == expected[index]);
+        continue;
+      }
+      /* Output is held over groups of `factor` frames after warm up. */
+      if ((i - num_warm_up_frames) % factor != 0) {
+        CHECK(actual[index] == actual[index - kChannels]);
+      }
+      /* Compare 10 ms averages, since holding aliases the energy ripple. */
+      window_actual += actual[index];
+      window_expected += expected[index];
+      if ((i - num_warm_up_frames) % window == window - 1) {
+        sum_diff += fabs(window_actual - window_expected);
+        sum_expected += window_expected;
+        window_actual = 0.0;
+        window_expected = 0.0;
+      }
+    }
+    CHECK(sum_expected > 0.0);
+    CHECK(sum_diff <= 0.05 * sum_expected);
+  }
+
+  free(channel_major);
+  free(actual);
+  free(expected);
+  free(input);
+}
+
+/* EnveloperProcessSamplesMultirate() gives identical output to
+ * EnveloperProcessSamplesChannelMajor() on channels 1-3, and close output on
+ * the baseband channel.
+ */
+static void TestMultirate(int decimation_factor) {
+  printf("TestMultirate(%d)\n", decimation_factor);
+  srand(0);
+  const int kChannels = kEnveloperNumChannels;
+  const float sample_rate_hz = 16000.0f;
+  const int output_frames = 32000 / decimation_factor;
+  const int input_size = output_frames * decimation_factor;
+  float* input = (float*)CHECK_NOTNULL(malloc(input_size * sizeof(float)));
+  float* expected = (float*)CHECK_NOTNULL(malloc(
+      output_frames * kChannels * sizeof(float)));
+  float* actual = (float*)CHECK_NOTNULL(malloc(
+      output_frames * kChannels * sizeof(float)));
+  int i;
+  for (i = 0; i < input_size; ++i) {
+    float t = i / sample_rate_hz;
+    input[i] = 1e-2f * ((float) rand() / RAND_MAX - 0.5f);
+    /* After the 0.5 s warm up, bursts of a tone sweeping through the baseband
+     * from 200 to 500 Hz.
+     */
+    if (t > 0.5f && fmod(t, 0.25) > 0.1) {
+      input[i] += 0.2f * sin(2.0 * M_PI * (100.0 + 100.0 * t) * t);
+    }
+  }
+
+  Enveloper enveloper;
+  CHECK(EnveloperInit(&enveloper, &kDefaultEnveloperParams,
+                      sample_rate_hz, decimation_factor));
+  CHECK(enveloper.baseband_decimation ==
+        ((decimation_factor % 4 == 0) ? 4 : (decimation_factor % 2 == 0) ? 2
+                                                                        : 1));
+  Enveloper enveloper_multirate = enveloper;
+
+  int start = 0;
+  while (start < input_size) {
+    /* Process blocks of between 64 and 256 samples. */
+    int input_block_size = decimation_factor *
+        ((64 + rand() / (RAND_MAX / 193)) / decimation_factor);
+    if (input_block_size > input_size - start) {
+      input_block_size = input_size - start;
+    }
+
+    const int offset = (start / decimation_factor) * kChannels;
+    EnveloperProcessSamplesChannelMajor(&enveloper, input + start,
+                                        input_block_size, expected + offset);
+    EnveloperProcessSamplesMultirate(&enveloper_multirate, input + start,
+                                     input_block_size, actual + offset);
+    start += input_block_size;
+  }
+
+  /* The ripple in the baseband energy envelope is sensitive to the slight
+   * differences in filter response and delay between rates, so compare means
+   * over 20 ms windows.
+   */
+  const int window_frames = output_frames / 100;
+  double energy = 0.0;
+  double error_energy = 0.0;
+  double window_expected = 0.0;
+  double window_actual = 0.0;
+  for (i = 0; i < output_frames; ++i) {
+    int c;
+    for (c = 1; c < kChannels; ++c) {
+      CHECK(actual[kChannels * i + c] == expected[kChannels * i + c]);
+    }
+    window_expected += expected[kChannels * i];
+    window_actual += actual[kChannels * i];
+    if ((i + 1) % window_frames == 0) {
+      const double diff = window_actual - window_expected;
+      energy += window_expected * window_expected;
+      error_energy += diff * diff;
+      window_expected = 0.0;
+      window_actual = 0.0;
+    }
+  }
+  /* The baseband channel is active and close to the full-rate output. */
+  CHECK(energy > 0.0);
+  if (enveloper.baseband_decimation == 1) {
+    CHECK(error_energy == 0.0);
+  } else {
+    CHECK(error_energy <= 0.01 * energy);
+  }
+
+  free(actual);
+  free(expected);
+  free(input);
+}
+
+/* With EnveloperSetActiveChannels(), channels from the lowest active one up are
+ * identical to processing all channels, skipped channels output zero, and
+ * enabling a skipped channel resets the Enveloper.
+ */
+static void TestActiveChannels(int decimation_factor) {
+  printf("TestActiveChannels(%d)\n", decimation_factor);
+  srand(0);
+  const int kChannels = kEnveloperNumChannels;
+  const float sample_rate_hz = 16000.0f;
+  const int output_frames = 4000;
+  const int input_size = output_frames * decimation_factor;
+  const int output_size = output_frames * kChannels;
+  float* input = (float*)CHECK_NOTNULL(malloc(input_size * sizeof(float)));
+  float* expected = (float*)CHECK_NOTNULL(malloc(output_size * sizeof(float)));
+  float* actual = (float*)CHECK_NOTNULL(malloc(output_size * sizeof(float)));
+  float* channel_major = (float*)CHECK_NOTNULL(
+      malloc(output_size * sizeof(float)));
+  int i;
+  for (i = 0; i < input_size; ++i) {
+    float t = i / sample_rate_hz;
+    input[i] = 1e-2f * ((float) rand() / RAND_MAX - 0.5f);
+    if (fmod(t, 0.25) > 0.15) {
+      input[i] += 0.2f * sin(2.0 * M_PI * (200.0 + 6000.0 * t) * t);
+    }
+  }
+
+  Enveloper reference;
+  CHECK(EnveloperInit(&reference, &kDefaultEnveloperParams,
+                      sample_rate_hz, decimation_factor));
+  CHECK(reference.first_active_channel == 0);
+  Enveloper enveloper = reference;
+  Enveloper enveloper_channel_major = reference;
+  EnveloperProcessSamples(&reference, input, input_size, expected);
+
+  int first;
+  for (first = 1; first <= kChannels; ++first) {
+    /* Only the lowest set bit matters, since the channels above are coupled. */
+    const int active_channels = (first < kChannels) ? (1 << first) | 8 : 0;
+    EnveloperSetActiveChannels(&enveloper, active_channels);
+    EnveloperSetActiveChannels(&enveloper_channel_major, active_channels);
+    CHECK(enveloper.first_active_channel == first);
+    EnveloperReset(&enveloper);
+    EnveloperReset(&enveloper_channel_major);
+
+    EnveloperProcessSamples(&enveloper, input, input_size, actual);
+    EnveloperProcessSamplesChannelMajor(&enveloper_channel_major, input,
+                                        input_size, channel_major);
+    for (i = 0; i < output_size; ++i) {
+      const int c = i % kChannels;
+      if (c < first) {
+        CHECK(actual[i] == 0.0f);
+        CHECK(channel_major[i] == 0.0f);
+      } else {
+        CHECK(actual[i] == expected[i]);
+        CHECK(channel_major[i] == expected[i]);
+      }
+    }
+  }
+
+  /* Enabling skipped channels resets, after which the output is identical to
+   * that of a reset Enveloper.
+   */
+  EnveloperProcessSamples(&enveloper, input, input_size / 2, actual);
+  EnveloperSetActiveChannels(&enveloper, 0xf);
+  CHECK(enveloper.first_active_channel == 0);
+  CHECK(enveloper.warm_up_counter == enveloper.num_warm_up_samples);
+  EnveloperProcessSamples(&enveloper, input, input_size, actual);
+  for (i = 0; i < output_size; ++i) {
+    CHECK(actual[i] == expected[i]);
+  }
+
+  free(channel_major);
+  free(actual);
+  free(expected);
+  free(input);
+}
+
+/* EnveloperProcessSamplesWithTaps() output matches EnveloperProcessSamples(),
+ * and the taps match the Enveloper state and a reference bandpass filter.
+ */
+static void TestTaps(int decimation_factor) {
+  printf("TestTaps(%d)\n", decimation_factor);
+  srand(0);
+  const int kChannels = kEnveloperNumChannels;
+  const float sample_rate_hz = 16000.0f;
+  const int output_frames = 400;
+  const int input_size = output_frames * decimation_factor;
+  const int output_size = output_frames * kChannels;
+  float* input = (float*)CHECK_NOTNULL(malloc(input_size * sizeof(float)));
+  float* expected = (float*)CHECK_NOTNULL(malloc(output_size * sizeof(float)));
+  float* actual = (float*)CHECK_NOTNULL(malloc(output_size * sizeof(float)));
+  float* frame = (float*)CHECK_NOTNULL(malloc(kChannels * sizeof(float)));
+  EnveloperTaps taps;
+  taps.bandpassed = (float*)CHECK_NOTNULL(
+      malloc(input_size * kChannels * sizeof(float)));
+  taps.energy = (float*)CHECK_NOTNULL(malloc(output_size * sizeof(float)));
+  taps.smoothed_energy = (float*)CHECK_NOTNULL(
+      malloc(output_size * sizeof(float)));
+  taps.noise = (float*)CHECK_NOTNULL(malloc(output_size * sizeof(float)));
+  taps.gain = (float*)CHECK_NOTNULL(malloc(output_size * sizeof(float)));
+  int i;
+  for (i = 0; i < input_size; ++i) {
+    input[i] = 0.2f * ((float) rand() / RAND_MAX - 0.5f);
+  }
+
+  Enveloper reference;
+  CHECK(EnveloperInit(&reference, &kDefaultEnveloperParams,
+                      sample_rate_hz, decimation_factor));
+  Enveloper enveloper = reference;
+  EnveloperProcessSamplesWithTaps(&enveloper, input, input_size, &taps,
+                                  actual);
+
+  BiquadFilterState bpf_state[kEnveloperNumChannels][2];
+  int c;
+  for (c = 0; c < kChannels; ++c) {
+    BiquadFilterInitZero(&bpf_state[c][0]);
+    BiquadFilterInitZero(&bpf_state[c][1]);
+  }
+  for (i = 0; i < input_size; ++i) {
+    for (c = 0; c < kChannels; ++c) {
+      const BiquadFilterCoeffs* coeffs =
+          reference.channels[c].bpf_biquad_coeffs;
+      const float bandpassed = BiquadFilterProcessOneSample(
+          &coeffs[1], &bpf_state[c][1], BiquadFilterProcessOneSample(
+              &coeffs[0], &bpf_state[c][0], input[i]));
+      CHECK(fabs(taps.bandpassed[i * kChannels + c] - bandpassed) <= 1e-6f);
+    }
+  }
+
+  /* Process one frame at a time, comparing with the reference state. */
+  for (i = 0; i < output_frames; ++i) {
+    EnveloperProcessSamples(&reference, input + i * decimation_factor,
+                            decimation_factor, frame);
+    for (c = 0; c < kChannels; ++c) {
+      const EnveloperChannel* channel = &reference.channels[c];
+      const int k = i * kChannels + c;
+      CHECK(actual[k] == frame[c]);
+      CHECK(taps.energy[k] >= 0.0f);
+      CHECK(taps.smoothed_energy[k] == channel->smoothed_energy);
+      CHECK(taps.gain[k] == channel->smoothed_gain);
+      if (!reference.warm_up_counter) {  /* After warm up is done. */
+        const float min_noise = 1e-9f;
+        CHECK(taps.noise[k] == ((channel->noise < min_noise)
+                                    ? min_noise : channel->noise));
+      }
+    }
+  }
+
+  /* Requesting some taps records only those. */
+  EnveloperReset(&enveloper);
+  EnveloperProcessSamples(&enveloper, input, input_size, expected);
+  EnveloperReset(&enveloper);
+  for (i = 0; i < output_size; ++i) { taps.gain[i] = -1.0f; }
+  free(taps.bandpassed);
+  free(taps.energy);
+  free(taps.smoothed_energy);
+  free(taps.noise);
+  float* gain = taps.gain;
+  memset(&taps, 0, sizeof(taps));
+  taps.gain = gain;
+  EnveloperProcessSamplesWithTaps(&enveloper, input, input_size, &taps,
+                                  actual);
+  for (i = 0; i < output_size; ++i) {
+    CHECK(actual[i] == expected[i]);
+    CHECK(taps.gain[i] >= 0.0f);
+  }
+
+  free(gain);
+  free(frame);
+  free(actual);
+  free(expected);
+  free(input);
+}
+
+/* EnveloperProcessSamplesDualMic() with equal inputs matches one microphone,
+ * and with a noisy and a clean microphone, selects the clean one.
+ */
+static void TestDualMic(int decimation_factor) {
+  printf("TestDualMic(%d)\n", decimation_factor);
+  srand(0);
+  const int kChannels = kEnveloperNumChannels;
+  const float sample_rate_hz = 16000.0f;
+  const int kBlockSize = 64;
+  const int num_blocks = (int)(2.0f * sample_rate_hz) / kBlockSize;
+  const int output_block_size = kChannels * kBlockSize / decimation_factor;
+  float input0[64];
+  float input1[64];
+  float* expected = (float*)CHECK_NOTNULL(malloc(
+      output_block_size * sizeof(float)));
+  float* actual = (float*)CHECK_NOTNULL(malloc(
+      output_block_size * sizeof(float)));
+
+  Enveloper enveloper;
+  CHECK(EnveloperInit(&enveloper, &kDefaultEnveloperParams,
+                      sample_rate_hz, decimation_factor));
+  Enveloper enveloper_dual_mic = enveloper;
+
+  int block;
+  int i;
+  for (block = 0; block < num_blocks; ++block) {
+    for (i = 0; i < kBlockSize; ++i) {
+      const float t = (block * kBlockSize + i) / sample_rate_hz;
+      input0[i] = 1e-2f * ((float) rand() / RAND_MAX - 0.5f);
+      if (fmod(t, 0.25) > 0.15) {
+        input0[i] += 0.2f * sin(2.0 * M_PI * (200.0 + 6000.0 * t) * t);
+      }
+    }
+
+    EnveloperProcessSamples(&enveloper, input0, kBlockSize, expected);
+    EnveloperProcessSamplesDualMic(&enveloper_dual_mic, input0, input0,
+                                   kBlockSize, actual);
+    for (i = 0; i < output_block_size; ++i) {
+      CHECK(actual[i] == expected[i]);
+    }
+  }
+
+  /* Microphone 0 has loud noise, microphone 1 is clean. The signal is bursts
+   * of a tone in each channel's band, starting after the warm up.
+   */
+  EnveloperReset(&enveloper_dual_mic);
+  for (block = 0; block < num_blocks; ++block) {
+    for (i = 0; i < kBlockSize; ++i) {
+      const float t = (block * kBlockSize + i) / sample_rate_hz;
+      const float signal = (t > 0.5f && fmod(t, 0.25) > 0.15)
+          ? 0.1f * (sin(2.0 * M_PI * 250.0 * t) + sin(2.0 * M_PI * 1000.0 * t) +
+                    sin(2.0 * M_PI * 3000.0 * t) + sin(2.0 * M_PI * 5000.0 * t))
+          : 0.0f;
+      input0[i] = signal + 0.3f * ((float) rand() / RAND_MAX - 0.5f);
+      input1[i] = signal + 1e-3f * ((float) rand() / RAND_MAX - 0.5f);
+    }
+    EnveloperProcessSamplesDualMic(&enveloper_dual_mic, input0, input1,
+                                   kBlockSize, actual);
+  }
+
+  int c;
+  for (c = 0; c < kChannels; ++c) {
+    CHECK(enveloper_dual_mic.dual_mic.weight[c] > 0.9f);
+  }
+
+  free(actual);
+  free(expected);
+}
+
 int main(int argc, char** argv) {
   int decimation_factor;
   for (decimation_factor = 1; decimation_factor <= 4; decimation_factor *= 2) {
@@ -225,7 +800,16 @@ int main(int argc, char** argv) {
 
     TestSilence(decimation_factor);
     TestStreaming(decimation_factor);
+    TestChannelMajor(decimation_factor);
+    TestFastPowTable(decimation_factor);
+    TestActiveChannels(decimation_factor);
+    TestTaps(decimation_factor);
+    TestDualMic(decimation_factor);
+    TestOutputDecimation(decimation_factor);
   }
+  TestMultirate(1);
+  TestMultirate(2);
+  TestMultirate(8);
 
   puts("PASS");
   return EXIT_SUCCESS;
@@ -0,0 +1,142 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "src/tactile/frame_bus.h"
+
+#include <stdlib.h>
+
+#include "src/dsp/logging.h"
+
+#define kFrameSize 3
+
+/* Writes and publishes a frame filled with `value`. */
+static void PublishFrame(FrameBus* bus, float value) {
+  float* frame = FrameBusNextSlot(bus);
+  int i;
+  for (i = 0; i < kFrameSize; ++i) {
+    frame[i] = value + i;
+  }
+  FrameBusPublish(bus);
+}
+
+/* Checks that `frame` was published with `value`. */
+static void CheckFrame(const float* frame, float value) {
+  CHECK(frame != NULL);
+  int i;
+  for (i = 0; i < kFrameSize; ++i) {
+    CHECK(frame[i] == value + i);
+  }
+}
+
+/* Several readers each read every frame in order. */
+static void TestReaders(void) {
+  puts("TestReaders");
+  float storage[kFrameBusNumSlots * kFrameSize];
+  FrameBus bus;
+  CHECK(FrameBusInit(&bus, storage, kFrameSize));
+  CHECK(FrameBusLatest(&bus) == NULL);
+
+  FrameBusReader reader1;
+  FrameBusReader reader2;
+  FrameBusSubscribe(&bus, &reader1);
+  FrameBusSubscribe(&bus, &reader2);
+  CHECK(FrameBusRead(&bus, &reader1) == NULL);
+
+  int n;
+  for (n = 0; n < 50; ++n) {
+    PublishFrame(&bus, 10.0f * n);
+    CheckFrame(FrameBusLatest(&bus), 10.0f * n);
+    CheckFrame(FrameBusRead(&bus, &reader1), 10.0f * n);
+    CHECK(FrameBusRead(&bus, &reader1) == NULL);
+
+    /* reader2 reads every third frame, staying within the ring. */
+    if (n % 3 == 2) {
+      int k;
+      for (k = 2; k >= 0; --k) {
+        CheckFrame(FrameBusRead(&bus, &reader2), 10.0f * (n - k));
+      }
+      CHECK(FrameBusRead(&bus, &reader2) == NULL);
+    }
+  }
+
+  /* A reader subscribing later starts from the next frame. */
+  FrameBusReader reader3;
+  FrameBusSubscribe(&bus, &reader3);
+  CHECK(FrameBusRead(&bus, &reader3) == NULL);
+  PublishFrame(&bus, 7.0f);
+  CheckFrame(FrameBusRead(&bus, &reader3), 7.0f);
+
+  CHECK(reader1.num_dropped == 0);
+  CHECK(reader2.num_dropped == 0);
+}
+
+/* A reader falling behind skips to the oldest frame still held. */
+static void TestDropped(void) {
+  puts("TestDropped");
+  float storage[kFrameBusNumSlots * kFrameSize];
+  FrameBus bus;
+  CHECK(FrameBusInit(&bus, storage, kFrameSize));
+  FrameBusReader reader;
+  FrameBusSubscribe(&bus, &reader);
+
+  const int kNumFrames = kFrameBusNumSlots + 5;
+  int n;
+  for (n = 0; n < kNumFrames; ++n) {
+    PublishFrame(&bus, 10.0f * n);
+  }
+  for (n = kNumFrames - (kFrameBusNumSlots - 1); n < kNumFrames; ++n) {
+    CheckFrame(FrameBusRead(&bus, &reader), 10.0f * n);
+  }
+  CHECK(FrameBusRead(&bus, &reader) == NULL);
+  CHECK(reader.num_dropped == (uint32_t)(kNumFrames - (kFrameBusNumSlots - 1)));
+}
+
+/* Frame counts wrap around modulo 2^32. */
+static void TestWraparound(void) {
+  puts("TestWraparound");
+  float storage[kFrameBusNumSlots * kFrameSize];
+  FrameBus bus;
+  CHECK(FrameBusInit(&bus, storage, kFrameSize));
+  bus.num_published = UINT32_MAX - 2;
+  FrameBusReader reader;
+  FrameBusSubscribe(&bus, &reader);
+
+  int n;
+  for (n = 0; n < 6; ++n) {
+    PublishFrame(&bus, 10.0f * n);
+    CheckFrame(FrameBusRead(&bus, &reader), 10.0f * n);
+  }
+  CHECK(bus.num_published == 3);
+  CHECK(reader.num_dropped == 0);
+}
+
+static void TestInvalidArgs(void) {
+  puts("TestInvalidArgs");
+  float storage[kFrameBusNumSlots];
+  FrameBus bus;
+  CHECK(!FrameBusInit(NULL, storage, 1));
+  CHECK(!FrameBusInit(&bus, NULL, 1));
+  CHECK(!FrameBusInit(&bus, storage, 0));
+}
+
+int main(int argc, char** argv) {
+  TestReaders();
+  TestDropped();
+  TestWraparound();
+  TestInvalidArgs();
+
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
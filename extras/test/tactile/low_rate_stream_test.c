@@ -0,0 +1,249 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "src/tactile/low_rate_stream.h"
+
+#include <float.h>
+#include <math.h>
+#include <stdlib.h>
+
+#include "src/dsp/logging.h"
+#include "src/dsp/math_constants.h"
+#include "src/phonetics/embed_vowel.h"
+#include "src/tactile/tactile_processor.h"
+
+#define kSenderRateHz 16000.0f
+#define kNumSamples 64
+#define kNumCodes \
+    (kNumSamples / (kLowRateStreamDecimation * kLowRateStreamCodeStride))
+
+/* Returns 1 if x is finite, without the C99 isfinite(). */
+static int /*bool*/ IsFinite(float x) {
+  return x == x && fabs(x) <= FLT_MAX;
+}
+
+/* Generates `num_samples` of a sine wave at `frequency_hz` plus some noise. */
+static void GenerateInput(float frequency_hz, int num_samples, float* input) {
+  int i;
+  for (i = 0; i < num_samples; ++i) {
+    input[i] = 0.2f * sin(2.0 * M_PI * frequency_hz * i / kSenderRateHz) +
+        0.02f * ((float)rand() / RAND_MAX - 0.5f);
+  }
+}
+
+/* Energy codes round trip to within half a step. */
+static void TestEnergyCoding(void) {
+  puts("TestEnergyCoding");
+  volatile float zero = 0.0f;
+  CHECK(LowRateStreamEncodeEnergy(0.0f) == 0);
+  CHECK(LowRateStreamEncodeEnergy(-1.0f) == 0);
+  CHECK(LowRateStreamEncodeEnergy(zero / zero) == 0);  /* NaN. */
+  CHECK(LowRateStreamEncodeEnergy(1e-12f) == 0);
+  CHECK(LowRateStreamEncodeEnergy(1e3f) == 255);
+  CHECK(LowRateStreamDecodeEnergy(0) == 0.0f);
+
+  float energy;
+  for (energy = 1e-9f; energy < 3.0f; energy *= 1.37f) {
+    const uint8_t code = LowRateStreamEncodeEnergy(energy);
+    const float decoded = LowRateStreamDecodeEnergy(code);
+    /* Half a step of 10 / 24 dB. */
+    CHECK(fabs(10.0 * log10(decoded / energy)) <= 0.21);
+  }
+}
+
+/* The encoder downsamples by 2 and codes energy in the fricative band. */
+static void TestEncode(void) {
+  puts("TestEncode");
+  const float kFrequencies[2] = {1000.0f, 5000.0f};
+  int k;
+  for (k = 0; k < 2; ++k) {
+    LowRateStreamEncoder* encoder = CHECK_NOTNULL(LowRateStreamEncoderMake(
+        &kDefaultEnveloperParams, kSenderRateHz, kNumSamples));
+    const int kNumBlocks = 50;
+    float* input = (float*)CHECK_NOTNULL(
+        malloc(sizeof(float) * kNumSamples * kNumBlocks));
+    GenerateInput(kFrequencies[k], kNumSamples * kNumBlocks, input);
+
+    float audio_energy = 0.0f;
+    int max_code = 0;
+    int b;
+    for (b = 0; b < kNumBlocks; ++b) {
+      float audio[kNumSamples / kLowRateStreamDecimation];
+      uint8_t codes[kNumCodes];
+      LowRateStreamEncode(encoder, input + kNumSamples * b, kNumSamples,
+                          audio, codes);
+      if (b < kNumBlocks / 2) { continue; }  /* Skip transients. */
+
+      int i;
+      for (i = 0; i < kNumSamples / kLowRateStreamDecimation; ++i) {
+        audio_energy += audio[i] * audio[i];
+      }
+      for (i = 0; i < kNumCodes; ++i) {
+        if (codes[i] > max_code) { max_code = codes[i]; }
+      }
+    }
+    audio_energy /= kNumSamples / kLowRateStreamDecimation * kNumBlocks / 2;
+
+    if (kFrequencies[k] < 4000.0f) {
+      /* Passes through the downsampling, little fricative energy. */
+      CHECK(fabs(audio_energy - 0.02f) < 0.002f);
+      CHECK(LowRateStreamDecodeEnergy(max_code) < 1e-4f);
+    } else {
+      /* Above the downsampled Nyquist frequency, but in the fricative band. */
+      CHECK(audio_energy < 1e-4f);
+      CHECK(LowRateStreamDecodeEnergy(max_code) > 1e-3f);
+    }
+
+    free(input);
+    LowRateStreamEncoderFree(encoder);
+  }
+}
+
+/* The low-rate Enveloper's fricative channel closely follows that of a
+ * full-rate Enveloper.
+ */
+static void TestSideEnergyMatchesFullRate(void) {
+  puts("TestSideEnergyMatchesFullRate");
+  const int kDecimation = 4;  /* At the low rate. */
+  const int kNumBlocks = 400;
+  const int kNumFrames = kNumSamples / (kLowRateStreamDecimation * kDecimation);
+  float* input = (float*)CHECK_NOTNULL(
+      malloc(sizeof(float) * kNumSamples * kNumBlocks));
+  /* After 0.8 s of noise, for warming up, alternate fricative and vowel
+   * bursts.
+   */
+  int b;
+  for (b = 0; b < kNumBlocks; b += 20) {
+    float frequency_hz = 0.0f;
+    if (b >= 200) { frequency_hz = (b % 40 == 0) ? 5000.0f : 800.0f; }
+    GenerateInput(frequency_hz, kNumSamples * 20, input + kNumSamples * b);
+  }
+
+  Enveloper full_rate;
+  CHECK(EnveloperInit(&full_rate, &kDefaultEnveloperParams, kSenderRateHz,
+                      kLowRateStreamDecimation * kDecimation));
+  EnveloperParams params = kDefaultEnveloperParams;
+  params.side_energy_sample_rate_hz = kSenderRateHz;
+  Enveloper low_rate;
+  CHECK(EnveloperInit(&low_rate, &params,
+                      kSenderRateHz / kLowRateStreamDecimation, kDecimation));
+  LowRateStreamEncoder* encoder = CHECK_NOTNULL(LowRateStreamEncoderMake(
+      &kDefaultEnveloperParams, kSenderRateHz, kNumSamples));
+
+  float max_output = 0.0f;
+  float max_diff = 0.0f;
+  for (b = 0; b < kNumBlocks; ++b) {
+    const float* block = input + kNumSamples * b;
+    float full_output[kNumFrames * kEnveloperNumChannels];
+    EnveloperProcessSamples(&full_rate, block, kNumSamples, full_output);
+
+    float audio[kNumSamples / kLowRateStreamDecimation];
+    uint8_t codes[kNumCodes];
+    LowRateStreamEncode(encoder, block, kNumSamples, audio, codes);
+    float side_energy[kNumFrames];
+    LowRateStreamDecodeEnergies(codes, kNumSamples / kLowRateStreamDecimation,
+                                kDecimation, side_energy);
+    float low_output[kNumFrames * kEnveloperNumChannels];
+    EnveloperProcessSamplesWithSideEnergy(
+        &low_rate, audio, kNumSamples / kLowRateStreamDecimation, side_energy,
+        low_output);
+
+    int i;
+    for (i = 0; i < kNumFrames; ++i) {
+      const float expected = full_output[kEnveloperNumChannels * i + 3];
+      const float actual = low_output[kEnveloperNumChannels * i + 3];
+      CHECK(IsFinite(actual));
+      if (expected > max_output) { max_output = expected; }
+      if (fabs(actual - expected) > max_diff) {
+        max_diff = fabs(actual - expected);
+      }
+    }
+  }
+
+  CHECK(max_output > 0.1f);
+  CHECK(max_diff <= 0.02f * max_output);
+
+  LowRateStreamEncoderFree(encoder);
+  free(input);
+}
+
+/* TactileProcessor runs with the low-rate profile. */
+static void TestLowRateTactileProcessor(void) {
+  puts("TestLowRateTactileProcessor");
+  TactileProcessorParams params;
+  TactileProcessorSetLowRateParams(&params, kSenderRateHz);
+  CHECK(params.frontend_params.input_sample_rate_hz ==
+        kSenderRateHz / kLowRateStreamDecimation);
+  CHECK(params.frame_channel_offset > 0);
+  TactileProcessor* processor = CHECK_NOTNULL(TactileProcessorMake(&params));
+  const int block_size = CarlFrontendBlockSize(processor->frontend);
+  CHECK(block_size == kNumSamples / kLowRateStreamDecimation);
+  /* Frames are in the vowel embedding's layout. */
+  CHECK(processor->frame_bus.frame_size == kEmbedVowelNumChannels);
+  CHECK(params.frame_channel_offset +
+        CarlFrontendNumChannels(processor->frontend) ==
+        kEmbedVowelNumChannels);
+
+  LowRateStreamEncoder* encoder = CHECK_NOTNULL(LowRateStreamEncoderMake(
+      &params.enveloper_params, kSenderRateHz, kNumSamples));
+  const int kNumBlocks = 100;
+  const int num_frames = block_size / params.decimation_factor;
+  float* output = (float*)CHECK_NOTNULL(
+      malloc(sizeof(float) * num_frames * kTactileProcessorNumTactors));
+  float* side_energy =
+      (float*)CHECK_NOTNULL(malloc(sizeof(float) * num_frames));
+  float input[kNumSamples];
+  float max_output = 0.0f;
+  int b;
+  for (b = 0; b < kNumBlocks; ++b) {
+    GenerateInput((b < kNumBlocks / 2) ? 5000.0f : 800.0f, kNumSamples,
+                  input);
+    float audio[kNumSamples / kLowRateStreamDecimation];
+    uint8_t codes[kNumCodes];
+    LowRateStreamEncode(encoder, input, kNumSamples, audio, codes);
+    LowRateStreamDecodeEnergies(codes, block_size, params.decimation_factor,
+                                side_energy);
+    TactileProcessorProcessSamplesWithSideEnergy(processor, audio,
+                                                 side_energy, output);
+
+    int i;
+    for (i = 0; i < num_frames * kTactileProcessorNumTactors; ++i) {
+      CHECK(IsFinite(output[i]));
+      if (output[i] > max_output) { max_output = output[i]; }
+    }
+    /* Channels above the streamed Nyquist frequency are zero. */
+    const float* frame = FrameBusLatest(&processor->frame_bus);
+    for (i = 0; i < params.frame_channel_offset; ++i) {
+      CHECK(frame[i] == 0.0f);
+    }
+  }
+  CHECK(max_output > 0.0f);
+
+  free(side_energy);
+  free(output);
+  LowRateStreamEncoderFree(encoder);
+  TactileProcessorFree(processor);
+}
+
+int main(int argc, char** argv) {
+  srand(0);
+  TestEnergyCoding();
+  TestEncode();
+  TestSideEnergyMatchesFullRate();
+  TestLowRateTactileProcessor();
+
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
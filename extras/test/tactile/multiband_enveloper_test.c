@@ -0,0 +1,317 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "src/tactile/multiband_enveloper.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+#include "src/dsp/fast_fun.h"
+#include "src/dsp/logging.h"
+#include "src/dsp/math_constants.h"
+#include "src/tactile/enveloper_kernel.h"
+
+static const float kSampleRateHz = 16000.0f;
+
+static float RandUniform(void) { return (float)rand() / RAND_MAX; }
+
+/* Runs one biquad section on one sample, as BiquadFilterProcessOneSample. */
+static float Biquad(const float* b0, const float* b1, const float* b2,
+                    const float* a1, const float* a2, float* z0, float* z1,
+                    float x) {
+  const float next_state = x - *a1 * *z0 - *a2 * *z1;
+  const float y = *b0 * next_state + *b1 * *z0 + *b2 * *z1;
+  *z1 = *z0;
+  *z0 = next_state;
+  return y;
+}
+
+/* Straightforward scalar implementation of MultibandEnveloperProcessSamples(),
+ * processing one band at a time, sample by sample.
+ */
+static void ReferenceProcessSamples(MultibandEnveloper* state,
+                                    const float* input, int num_samples,
+                                    float* output) {
+  const int num_bands = state->num_bands;
+  const int decimation_factor = state->decimation_factor;
+  const int num_frames = num_samples / decimation_factor;
+  const BiquadFilterCoeffs* lpf = &state->energy_biquad_coeffs;
+  int b;
+  for (b = 0; b < num_bands; ++b) {
+    float c[2][5];
+    int k;
+    for (k = 0; k < 2; ++k) {
+      int m;
+      for (m = 0; m < 5; ++m) { c[k][m] = state->bpf_coeffs[k][m][b]; }
+    }
+    int warm_up_counter = state->warm_up_counter;
+    int i;
+    for (i = 0; i < num_frames; ++i) {
+      float energy = 0.0f;
+      int j;
+      for (j = 0; j < decimation_factor; ++j) {
+        float x = input[i * decimation_factor + j];
+        for (k = 0; k < 2; ++k) {
+          x = Biquad(&c[k][0], &c[k][1], &c[k][2], &c[k][3], &c[k][4],
+                     &state->bpf_z[k][0][b], &state->bpf_z[k][1][b], x);
+        }
+        x = (x > 0.0f) ? x : 0.0f;
+        energy = Biquad(&lpf->b0, &lpf->b1, &lpf->b2, &lpf->a1, &lpf->a2,
+                        &state->energy_z[0][b], &state->energy_z[1][b], x * x);
+      }
+      if (energy < 0.0f) { energy = 0.0f; }
+
+      state->smoothed_energy[b] += state->energy_smoother_coeff *
+          (state->equalization[b] * energy - state->smoothed_energy[b]);
+      float noise;
+      if (warm_up_counter) {
+        state->noise[b] += 2.0f * energy;
+        noise = state->noise[b] /
+            (float)(state->num_warm_up_samples - warm_up_counter + 1);
+        if (warm_up_counter == 1) { state->noise[b] = noise; }
+      } else {
+        state->noise[b] *= state->noise_coeffs[
+            state->noise[b] < state->smoothed_energy[b]];
+        noise = state->noise[b];
+      }
+      if (noise < 1e-9f) { noise = 1e-9f; }
+
+      const float thresh = state->gate_thresh_factor[b] * noise;
+      const float diff = state->smoothed_energy[b] - thresh;
+      const float gain = (diff <= 1e-9f) ? 0.0f :
+          EnveloperSoftGate(diff, state->gate_transition_factor * thresh) *
+          FastPow(state->smoothed_energy[b], state->agc_exponent);
+      state->smoothed_gain[b] += state->gain_smoother_coeffs[
+          gain < state->smoothed_gain[b]] * (gain - state->smoothed_gain[b]);
+      output[i * num_bands + b] = state->output_gain[b] * (FastPow(
+          state->smoothed_gain[b] * energy + state->compressor_delta,
+          state->compressor_exponent) - kEnveloperCompressorStabilization);
+      if (warm_up_counter) { --warm_up_counter; }
+    }
+  }
+  state->warm_up_counter = (state->warm_up_counter > num_frames)
+      ? state->warm_up_counter - num_frames : 0;
+}
+
+/* Compare with the scalar reference, for band counts that do and don't fill
+ * whole groups of 4.
+ */
+static void TestMatchesReference(int num_bands, int decimation_factor) {
+  printf("TestMatchesReference(%d, %d)\n", num_bands, decimation_factor);
+  srand(0);
+  const int num_samples = 8000;
+  const int num_frames = num_samples / decimation_factor;
+  float* input = (float*)CHECK_NOTNULL(malloc(num_samples * sizeof(float)));
+  float* output = (float*)CHECK_NOTNULL(malloc(
+      num_frames * num_bands * sizeof(float)));
+  float* expected = (float*)CHECK_NOTNULL(malloc(
+      num_frames * num_bands * sizeof(float)));
+  int i;
+  for (i = 0; i < num_samples; ++i) {
+    /* Noise, with a louder burst in the middle. */
+    const float amplitude = (2000 <= i && i < 5000) ? 0.3f : 0.001f;
+    input[i] = amplitude * (RandUniform() - 0.5f);
+  }
+
+  MultibandEnveloperParams params = kDefaultMultibandEnveloperParams;
+  CHECK(MultibandEnveloperSetLogSpacedBands(
+      &params, num_bands, 100.0f, 7000.0f));
+  MultibandEnveloper enveloper;
+  CHECK(MultibandEnveloperInit(&enveloper, &params, kSampleRateHz,
+                               decimation_factor));
+  MultibandEnveloper reference = enveloper;
+
+  MultibandEnveloperProcessSamples(&enveloper, input, num_samples, output);
+  ReferenceProcessSamples(&reference, input, num_samples, expected);
+
+  float max_output = 0.0f;
+  for (i = 0; i < num_frames * num_bands; ++i) {
+    CHECK(fabs(output[i] - expected[i]) <= 1e-4f * (1.0f + fabs(expected[i])));
+    if (output[i] > max_output) { max_output = output[i]; }
+  }
+  CHECK(max_output > 0.1f);  /* Output is nontrivial. */
+  CHECK(enveloper.warm_up_counter == reference.warm_up_counter);
+
+  free(expected);
+  free(output);
+  free(input);
+}
+
+/* A tone is strongest in the band containing its frequency. */
+static void TestToneLocalization(int num_bands) {
+  printf("TestToneLocalization(%d)\n", num_bands);
+  const int decimation_factor = 8;
+  const int num_samples = 16000;
+  /* The tone starts after the 0.5 s warm up, so that the noise estimates are
+   * of the background noise.
+   */
+  const int tone_start = 9600;
+  const int num_frames = num_samples / decimation_factor;
+  float* input = (float*)CHECK_NOTNULL(malloc(num_samples * sizeof(float)));
+  float* output = (float*)CHECK_NOTNULL(malloc(
+      num_frames * num_bands * sizeof(float)));
+
+  MultibandEnveloperParams params = kDefaultMultibandEnveloperParams;
+  CHECK(MultibandEnveloperSetLogSpacedBands(
+      &params, num_bands, 80.0f, 6000.0f));
+  MultibandEnveloper enveloper;
+  CHECK(MultibandEnveloperInit(&enveloper, &params, kSampleRateHz,
+                               decimation_factor));
+
+  int b;
+  for (b = 0; b < num_bands; ++b) {
+    /* Tone at the geometric center of band b, over a little noise. */
+    const double frequency_hz =
+        sqrt(params.band_edges_hz[b] * params.band_edges_hz[b + 1]);
+    srand(0);
+    int i;
+    for (i = 0; i < num_samples; ++i) {
+      input[i] = 1e-4f * (RandUniform() - 0.5f);
+      if (i >= tone_start) {
+        /* Fade in over 20 ms to avoid a broadband click. */
+        const float fade =
+            (i - tone_start < 320) ? (i - tone_start) / 320.0f : 1.0f;
+        input[i] += fade *
+            (float)(0.2 * sin(2.0 * M_PI * frequency_hz * i / kSampleRateHz));
+      }
+    }
+
+    MultibandEnveloperReset(&enveloper);
+    MultibandEnveloperProcessSamples(&enveloper, input, num_samples, output);
+
+    /* Find the band with the largest mean output over the tone. */
+    int max_band = -1;
+    float max_sum = 0.0f;
+    int c;
+    for (c = 0; c < num_bands; ++c) {
+      float sum = 0.0f;
+      for (i = tone_start / decimation_factor; i < num_frames; ++i) {
+        sum += output[i * num_bands + c];
+      }
+      if (sum > max_sum) {
+        max_sum = sum;
+        max_band = c;
+      }
+    }
+    CHECK(max_band == b);
+  }
+
+  free(output);
+  free(input);
+}
+
+/* Output is the same whether processed in one call or in random blocks. */
+static void TestStreaming(void) {
+  puts("TestStreaming");
+  srand(0);
+  const int num_bands = 13;
+  const int decimation_factor = 4;
+  const int num_samples = 4000;
+  const int num_frames = num_samples / decimation_factor;
+  float* input = (float*)CHECK_NOTNULL(malloc(num_samples * sizeof(float)));
+  float* nonstreaming = (float*)CHECK_NOTNULL(malloc(
+      num_frames * num_bands * sizeof(float)));
+  float* streaming = (float*)CHECK_NOTNULL(malloc(
+      num_frames * num_bands * sizeof(float)));
+  int i;
+  for (i = 0; i < num_samples; ++i) {
+    input[i] = 0.2f * (RandUniform() - 0.5f);
+  }
+
+  MultibandEnveloperParams params = kDefaultMultibandEnveloperParams;
+  CHECK(MultibandEnveloperSetLogSpacedBands(
+      &params, num_bands, 80.0f, 6000.0f));
+  MultibandEnveloper enveloper;
+  CHECK(MultibandEnveloperInit(&enveloper, &params, kSampleRateHz,
+                               decimation_factor));
+  MultibandEnveloperProcessSamples(&enveloper, input, num_samples,
+                                   nonstreaming);
+
+  MultibandEnveloperReset(&enveloper);
+  int start = 0;
+  while (start < num_samples) {
+    int block_size = decimation_factor * (rand() % 50);
+    if (block_size > num_samples - start) { block_size = num_samples - start; }
+    MultibandEnveloperProcessSamples(
+        &enveloper, input + start, block_size,
+        streaming + (start / decimation_factor) * num_bands);
+    start += block_size;
+  }
+
+  for (i = 0; i < num_frames * num_bands; ++i) {
+    CHECK(streaming[i] == nonstreaming[i]);
+  }
+
+  free(streaming);
+  free(nonstreaming);
+  free(input);
+}
+
+/* When input is pure silence (zero), output is zero. */
+static void TestSilence(void) {
+  puts("TestSilence");
+  const int num_samples = 8000;
+  float* input = (float*)CHECK_NOTNULL(calloc(num_samples, sizeof(float)));
+  float* output = (float*)CHECK_NOTNULL(malloc(
+      num_samples * kMultibandEnveloperMaxBands * sizeof(float)));
+
+  MultibandEnveloper enveloper;
+  CHECK(MultibandEnveloperInit(&enveloper, &kDefaultMultibandEnveloperParams,
+                               kSampleRateHz, 1));
+  MultibandEnveloperProcessSamples(&enveloper, input, num_samples, output);
+
+  int i;
+  for (i = 0; i < num_samples * kMultibandEnveloperMaxBands; ++i) {
+    CHECK(output[i] == 0.0f);
+  }
+
+  free(output);
+  free(input);
+}
+
+static void TestInvalidParams(void) {
+  puts("TestInvalidParams");
+  MultibandEnveloper enveloper;
+  MultibandEnveloperParams params = kDefaultMultibandEnveloperParams;
+  CHECK(!MultibandEnveloperSetLogSpacedBands(&params, 0, 80.0f, 6000.0f));
+  CHECK(!MultibandEnveloperSetLogSpacedBands(
+      &params, kMultibandEnveloperMaxBands + 1, 80.0f, 6000.0f));
+  CHECK(!MultibandEnveloperSetLogSpacedBands(&params, 8, 6000.0f, 80.0f));
+
+  params.num_bands = 0;
+  CHECK(!MultibandEnveloperInit(&enveloper, &params, kSampleRateHz, 1));
+
+  params = kDefaultMultibandEnveloperParams;
+  params.band_edges_hz[3] = params.band_edges_hz[2];  /* Empty band. */
+  CHECK(!MultibandEnveloperInit(&enveloper, &params, kSampleRateHz, 1));
+
+  params = kDefaultMultibandEnveloperParams;
+  CHECK(!MultibandEnveloperInit(&enveloper, &params, kSampleRateHz, 0));
+}
+
+int main(int argc, char** argv) {
+  TestMatchesReference(4, 1);
+  TestMatchesReference(8, 8);
+  TestMatchesReference(13, 4);
+  TestMatchesReference(24, 2);
+  TestToneLocalization(8);
+  TestToneLocalization(16);
+  TestStreaming();
+  TestSilence();
+  TestInvalidParams();
+
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,153 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "src/tactile/multiband_tactile_processor.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+#include "src/dsp/logging.h"
+#include "src/dsp/math_constants.h"
+
+/* Runs `processor` on 0.6 s of low noise, for warm up, followed by 0.4 s of a
+ * tone, returning the sum of each tactor's output over the tone in `sums`.
+ */
+static void RunTone(MultibandTactileProcessor* processor,
+                    const MultibandTactileProcessorParams* params,
+                    float frequency_hz, float* sums) {
+  const int block_size = params->block_size;
+  const int num_tactors = params->num_tactors;
+  const int output_frames = block_size / params->decimation_factor;
+  const int tone_start = (int)(0.6f * params->input_sample_rate_hz);
+  const int num_samples = (int)params->input_sample_rate_hz;
+  const int fade_samples = (int)(0.02f * params->input_sample_rate_hz);
+  float* input = (float*)CHECK_NOTNULL(malloc(block_size * sizeof(float)));
+  float* output = (float*)CHECK_NOTNULL(malloc(
+      output_frames * num_tactors * sizeof(float)));
+  int t;
+  for (t = 0; t < num_tactors; ++t) { sums[t] = 0.0f; }
+
+  srand(0);
+  MultibandTactileProcessorReset(processor);
+  int start;
+  for (start = 0; start + block_size <= num_samples; start += block_size) {
+    int i;
+    for (i = 0; i < block_size; ++i) {
+      const int n = start + i;
+      input[i] = 1e-4f * ((float)rand() / RAND_MAX - 0.5f);
+      if (n >= tone_start) {
+        /* Fade in to avoid a broadband click. */
+        const float fade = (n - tone_start < fade_samples)
+            ? (float)(n - tone_start) / fade_samples : 1.0f;
+        input[i] += fade * (float)(0.2 * sin(2.0 * M_PI * frequency_hz * n /
+                                             params->input_sample_rate_hz));
+      }
+    }
+    MultibandTactileProcessorProcessSamples(processor, input, output);
+    if (start < tone_start) { continue; }
+    for (i = 0; i < output_frames * num_tactors; ++i) {
+      sums[i % num_tactors] += output[i];
+    }
+  }
+
+  free(output);
+  free(input);
+}
+
+static int ArgMax(const float* x, int size) {
+  int i_max = 0;
+  int i;
+  for (i = 1; i < size; ++i) {
+    if (x[i] > x[i_max]) { i_max = i; }
+  }
+  return i_max;
+}
+
+/* With default params, each tactor has its own band. */
+static void TestOneBandPerTactor(void) {
+  puts("TestOneBandPerTactor");
+  MultibandTactileProcessorParams params;
+  MultibandTactileProcessorSetDefaultParams(&params);
+  CHECK(params.num_tactors == kPostProcessorMaxChannels);
+  CHECK(params.enveloper_params.num_bands == kPostProcessorMaxChannels);
+  MultibandTactileProcessor* processor =
+      CHECK_NOTNULL(MultibandTactileProcessorMake(&params));
+
+  const int kTestBands[3] = {2, 11, 20};
+  int k;
+  for (k = 0; k < 3; ++k) {
+    const float* edges = params.enveloper_params.band_edges_hz;
+    const int b = kTestBands[k];
+    float sums[kPostProcessorMaxChannels];
+    RunTone(processor, &params, (float)sqrt(edges[b] * edges[b + 1]), sums);
+    CHECK(ArgMax(sums, params.num_tactors) == b);
+  }
+
+  MultibandTactileProcessorFree(processor);
+}
+
+/* With fewer bands than tactors, adjacent tactors share bands, and unmapped
+ * tactors are zero.
+ */
+static void TestSharedBands(void) {
+  puts("TestSharedBands");
+  MultibandTactileProcessorParams params;
+  MultibandTactileProcessorSetDefaultParams(&params);
+  CHECK(MultibandEnveloperSetLogSpacedBands(
+      &params.enveloper_params, 8, 80.0f, 6000.0f));
+  params.num_tactors = 16;
+  MultibandTactileProcessorMapBandsEvenly(&params);
+  int t;
+  for (t = 0; t < 16; ++t) {
+    CHECK(params.tactor_band[t] == t / 2);
+  }
+  params.tactor_band[15] = -1;
+  MultibandTactileProcessor* processor =
+      CHECK_NOTNULL(MultibandTactileProcessorMake(&params));
+
+  const float* edges = params.enveloper_params.band_edges_hz;
+  float sums[16];
+  RunTone(processor, &params, (float)sqrt(edges[3] * edges[4]), sums);
+  CHECK(ArgMax(sums, 16) == 6);
+  CHECK(sums[6] == sums[7]);
+  CHECK(sums[15] == 0.0f);
+
+  MultibandTactileProcessorFree(processor);
+}
+
+static void TestInvalidParams(void) {
+  puts("TestInvalidParams");
+  MultibandTactileProcessorParams params;
+  MultibandTactileProcessorSetDefaultParams(&params);
+  params.block_size = 60;  /* Not a multiple of decimation_factor = 8. */
+  CHECK(MultibandTactileProcessorMake(&params) == NULL);
+
+  MultibandTactileProcessorSetDefaultParams(&params);
+  params.num_tactors = kPostProcessorMaxChannels + 1;
+  CHECK(MultibandTactileProcessorMake(&params) == NULL);
+
+  MultibandTactileProcessorSetDefaultParams(&params);
+  params.tactor_band[3] = params.enveloper_params.num_bands;
+  CHECK(MultibandTactileProcessorMake(&params) == NULL);
+}
+
+int main(int argc, char** argv) {
+  TestOneBandPerTactor();
+  TestSharedBands();
+  TestInvalidParams();
+
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
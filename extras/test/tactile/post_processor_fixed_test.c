@@ -0,0 +1,130 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "src/tactile/post_processor_fixed.h"
+
+#include <math.h>
+
+#include "src/dsp/logging.h"
+#include "src/dsp/math_constants.h"
+
+/* Max absolute difference between fixed and float outputs. */
+static const float kTolerance = 2e-4f;
+/* Max difference when the power limiter is active. The tolerance is larger
+ * since the float PostProcessor computes the limiter gain with FastPow(),
+ * which has up to about 0.5% relative error.
+ */
+static const float kLimiterTolerance = 3e-3f;
+
+/* Runs fixed and float PostProcessor on the same input and compares outputs.
+ * The input in each channel is a tone with amplitude increasing over time, so
+ * that both clipping and the power limiter are exercised.
+ */
+static void TestCompareToFloat(const PostProcessorParams* params,
+                               int num_channels,
+                               int /*bool*/ low_battery) {
+  printf("TestCompareToFloat(use_equalizer=%d, gain=%g, num_channels=%d, "
+         "low_battery=%d)\n",
+         params->use_equalizer, params->gain, num_channels, low_battery);
+  const float kSampleRateHz = 8000.0f;
+  PostProcessor post_processor;
+  CHECK(PostProcessorInit(&post_processor, params, kSampleRateHz,
+                          num_channels));
+  PostProcessorFixed post_processor_fixed;
+  CHECK(PostProcessorFixedInit(&post_processor_fixed, params, kSampleRateHz,
+                               num_channels));
+
+  const int kBlockSize = 32;
+  const int kNumBlocks = 200;
+  int16_t input_output[32 * kPostProcessorMaxChannels];
+  float input_output_float[32 * kPostProcessorMaxChannels];
+  float max_output = 0.0f;
+  float max_diff = 0.0f;
+  int block;
+  for (block = 0; block < kNumBlocks; ++block) {
+    int i;
+    for (i = 0; i < kBlockSize * num_channels; ++i) {
+      const int n = block * kBlockSize + i / num_channels;
+      const int c = i % num_channels;
+      const float amplitude = 1.2f * n / (kBlockSize * kNumBlocks);
+      const float frequency_hz = 30.0f + 25.0f * c;
+      const float value = amplitude *
+          sin(2.0 * M_PI * frequency_hz * n / kSampleRateHz + c);
+      input_output[i] = FixedSaturateInt16(
+          (int32_t)floor(32768.0f * value + 0.5f));
+      input_output_float[i] = input_output[i] / 32768.0f;
+    }
+
+    if (low_battery && block % 50 == 10) {
+      PostProcessorLowBattery(&post_processor);
+      PostProcessorFixedLowBattery(&post_processor_fixed);
+    }
+
+    PostProcessorProcessSamples(&post_processor, input_output_float,
+                                kBlockSize);
+    PostProcessorFixedProcessSamples(&post_processor_fixed, input_output,
+                                     kBlockSize);
+
+    for (i = 0; i < kBlockSize * num_channels; ++i) {
+      const float diff = fabs(input_output[i] / 32768.0f
+                              - input_output_float[i]);
+      if (diff > max_diff) { max_diff = diff; }
+      if (fabs(input_output_float[i]) > max_output) {
+        max_output = fabs(input_output_float[i]);
+      }
+    }
+  }
+
+  printf("  max output: %g, max diff: %g\n", max_output, max_diff);
+  CHECK(max_output > 0.2f);
+  /* The limiter is active after PostProcessorLowBattery() calls. */
+  CHECK(max_diff <= (low_battery ? kLimiterTolerance : kTolerance));
+}
+
+/* Silent input produces zero output. */
+static void TestSilence(void) {
+  puts("TestSilence");
+  PostProcessorParams params;
+  PostProcessorSetDefaultParams(&params);
+  PostProcessorFixed post_processor_fixed;
+  CHECK(PostProcessorFixedInit(&post_processor_fixed, &params, 8000.0f, 4));
+  int16_t input_output[4 * 32] = {0};
+  int block;
+  for (block = 0; block < 100; ++block) {
+    PostProcessorFixedProcessSamples(&post_processor_fixed, input_output, 32);
+    int i;
+    for (i = 0; i < 4 * 32; ++i) {
+      CHECK(input_output[i] == 0);
+    }
+  }
+}
+
+int main(int argc, char** argv) {
+  PostProcessorParams params;
+  PostProcessorSetDefaultParams(&params);
+  TestCompareToFloat(&params, 1, 0);
+  TestCompareToFloat(&params, 10, 0);
+  TestCompareToFloat(&params, 10, 1);
+
+  params.use_equalizer = 0;
+  params.gain = 4.0f;
+  TestCompareToFloat(&params, 3, 0);
+  TestCompareToFloat(&params, kPostProcessorMaxChannels, 1);
+
+  TestSilence();
+
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,296 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "src/tactile/post_processor.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+#include "src/dsp/logging.h"
+#include "src/dsp/math_constants.h"
+
+/* PWM top value, the same as in pwm_sleeve.h. */
+static const int kPwmTopValue = 512;
+
+/* Reference for the fused path: same as Pwm::FloatToPwmSample(). */
+static uint16_t FloatToPwmSample(float sample) {
+  const float scale = 0.5f * kPwmTopValue;
+  const float offset = scale + 0.5f;
+  return (uint16_t)(scale * sample + offset);
+}
+
+/* Checks that PostProcessorProcessSamplesToPwm() matches running
+ * PostProcessorProcessSamples(), ChannelMapApply(), and PWM conversion as
+ * separate passes. The input is a tone in each channel with amplitude
+ * increasing over time, so that clipping and the power limiter are exercised.
+ */
+static void TestFusedPwmMatchesSeparatePasses(int use_equalizer,
+                                              int num_channels,
+                                              int /*bool*/ low_battery) {
+  printf("TestFusedPwmMatchesSeparatePasses(use_equalizer=%d, "
+         "num_channels=%d, low_battery=%d)\n",
+         use_equalizer, num_channels, low_battery);
+  const float kSampleRateHz = 8000.0f;
+  PostProcessorParams params;
+  PostProcessorSetDefaultParams(&params);
+  params.use_equalizer = use_equalizer;
+  params.gain = 2.0f;
+  PostProcessor post_processor;
+  CHECK(PostProcessorInit(&post_processor, &params, kSampleRateHz,
+                          num_channels));
+  PostProcessor post_processor_fused;
+  CHECK(PostProcessorInit(&post_processor_fused, &params, kSampleRateHz,
+                          num_channels));
+
+  /* Map 12 output channels, with some sources repeated, and varied gains. */
+  const int kNumOutputChannels = 12;
+  ChannelMap channel_map;
+  channel_map.num_input_channels = num_channels;
+  channel_map.num_output_channels = kNumOutputChannels;
+  int c;
+  for (c = 0; c < kNumOutputChannels; ++c) {
+    channel_map.sources[c] = (5 * c + 2) % num_channels;
+    channel_map.gains[c] = ChannelGainFromControlValue(63 - 4 * c);
+  }
+
+  /* PWM buffer laid out like Pwm's, with 4 channels interleaved per module. */
+  const int kBlockSize = 8;
+  const int kNumBlocks = 500;
+  const int kPwmStride = 4;
+  uint16_t pwm_buffer[12 * 8];
+  uint16_t* pwm_channels[12];
+  for (c = 0; c < kNumOutputChannels; ++c) {
+    pwm_channels[c] = pwm_buffer + kBlockSize * kPwmStride * (c / kPwmStride)
+        + (c % kPwmStride);
+  }
+
+  float input[8 * kPostProcessorMaxChannels];
+  float input_output[8 * kPostProcessorMaxChannels];
+  float mapped[8 * 12];
+  int block;
+  for (block = 0; block < kNumBlocks; ++block) {
+    int i;
+    for (i = 0; i < kBlockSize * num_channels; ++i) {
+      const int n = block * kBlockSize + i / num_channels;
+      const int c = i % num_channels;
+      const float amplitude = 1.5f * n / (kBlockSize * kNumBlocks);
+      const float frequency_hz = 30.0f + 25.0f * c;
+      input[i] = amplitude *
+          sin(2.0 * M_PI * frequency_hz * n / kSampleRateHz + c);
+      input_output[i] = input[i];
+    }
+
+    if (low_battery && block % 150 == 20) {
+      PostProcessorLowBattery(&post_processor);
+      PostProcessorLowBattery(&post_processor_fused);
+    }
+
+    PostProcessorProcessSamples(&post_processor, input_output, kBlockSize);
+    ChannelMapApply(&channel_map, input_output, kBlockSize, mapped);
+    PostProcessorProcessSamplesToPwm(
+        &post_processor_fused, &channel_map, input, kBlockSize, kPwmTopValue,
+        pwm_channels, kPwmStride);
+
+    for (i = 0; i < kBlockSize; ++i) {
+      for (c = 0; c < kNumOutputChannels; ++c) {
+        const uint16_t expected =
+            FloatToPwmSample(mapped[c + kNumOutputChannels * i]);
+        CHECK(pwm_channels[c][i * kPwmStride] == expected);
+      }
+    }
+  }
+
+  CHECK(post_processor_fused.output_limit == post_processor.output_limit);
+  CHECK(post_processor_fused.recovery == post_processor.recovery);
+}
+
+/* Checks PostProcessorProcessSamples() against a scalar reference that filters
+ * each channel with BiquadFilterProcessOneSample() and computes the limiter
+ * gain with sqrt(). Channel counts that are not a multiple of four exercise
+ * both the SIMD and remainder paths. With all channels, the limiter is engaged
+ * on most frames.
+ */
+static void TestMatchesScalarReference(int num_channels) {
+  printf("TestMatchesScalarReference(num_channels=%d)\n", num_channels);
+  const float kSampleRateHz = 8000.0f;
+  PostProcessorParams params;
+  PostProcessorSetDefaultParams(&params);
+  params.gain = 2.0f;
+  PostProcessor post_processor;
+  CHECK(PostProcessorInit(&post_processor, &params, kSampleRateHz,
+                          num_channels));
+
+  const BiquadFilterCoeffs* coeffs[3];
+  coeffs[0] = &post_processor.equalizer_biquad_coeffs[0];
+  coeffs[1] = &post_processor.equalizer_biquad_coeffs[1];
+  coeffs[2] = &post_processor.lpf_biquad_coeffs;
+  BiquadFilterState states[3][kPostProcessorMaxChannels];
+  int f;
+  int c;
+  for (f = 0; f < 3; ++f) {
+    for (c = 0; c < num_channels; ++c) {
+      BiquadFilterInitZero(&states[f][c]);
+    }
+  }
+
+  const int kBlockSize = 8;
+  const int kNumBlocks = 200;
+  float input_output[8 * kPostProcessorMaxChannels];
+  float expected[8 * kPostProcessorMaxChannels];
+  int num_limited_frames = 0;
+  int block;
+  for (block = 0; block < kNumBlocks; ++block) {
+    int i;
+    for (i = 0; i < kBlockSize * num_channels; ++i) {
+      const int n = block * kBlockSize + i / num_channels;
+      const int c = i % num_channels;
+      const float frequency_hz = 30.0f + 25.0f * c;
+      input_output[i] = 0.8f * sin(2.0 * M_PI * frequency_hz * n /
+                                   kSampleRateHz + c);
+      expected[i] = input_output[i];
+    }
+
+    PostProcessorProcessSamples(&post_processor, input_output, kBlockSize);
+    const float output_limit = post_processor.output_limit;
+
+    float* frame = expected;
+    for (i = 0; i < kBlockSize; ++i, frame += num_channels) {
+      double power = 0.0;
+      for (c = 0; c < num_channels; ++c) {
+        float sample = frame[c];
+        for (f = 0; f < 3; ++f) {
+          if (f == 2) {
+            if (sample > 0.96f) { sample = 0.96f; }
+            if (sample < -0.96f) { sample = -0.96f; }
+          }
+          sample = BiquadFilterProcessOneSample(coeffs[f], &states[f][c],
+                                                sample);
+        }
+        frame[c] = sample;
+        power += sample * sample;
+      }
+      if (power > output_limit) {
+        const float limiter_gain = (float)sqrt(output_limit / power);
+        for (c = 0; c < num_channels; ++c) {
+          frame[c] *= limiter_gain;
+        }
+        ++num_limited_frames;
+      }
+    }
+
+    for (i = 0; i < kBlockSize * num_channels; ++i) {
+      CHECK(fabs(input_output[i] - expected[i]) <= 0.003f);
+    }
+  }
+
+  if (num_channels == kPostProcessorMaxChannels) {
+    CHECK(num_limited_frames > kBlockSize * kNumBlocks / 2);
+  }
+}
+
+/* The output limit round trips through the warm state, clamped to range. */
+static void TestWarmState(void) {
+  puts("TestWarmState");
+  PostProcessorParams params;
+  PostProcessorSetDefaultParams(&params);
+  PostProcessor state;
+  CHECK(PostProcessorInit(&state, &params, 8000.0f, 10));
+  PostProcessorLowBattery(&state);
+  PostProcessorLowBattery(&state);
+  float warm_state[kPostProcessorWarmStateSize];
+  PostProcessorGetWarmState(&state, warm_state);
+
+  PostProcessor restored;
+  CHECK(PostProcessorInit(&restored, &params, 8000.0f, 10));
+  CHECK(restored.output_limit != state.output_limit);
+  CHECK(PostProcessorSetWarmState(&restored, warm_state));
+  CHECK(restored.output_limit == state.output_limit);
+
+  warm_state[0] = 1e6f;
+  CHECK(PostProcessorSetWarmState(&restored, warm_state));
+  CHECK(restored.output_limit == 6.0f);
+  warm_state[0] = -1.0f;
+  CHECK(PostProcessorSetWarmState(&restored, warm_state));
+  CHECK(restored.output_limit == 1.0f);
+  volatile float zero = 0.0f;
+  warm_state[0] = zero / zero;  /* NaN. */
+  CHECK(!PostProcessorSetWarmState(&restored, warm_state));
+  CHECK(restored.output_limit == 1.0f);
+}
+
+/* With inactive channels, the output is identical to processing all channels
+ * with zero input on the inactive channels. Reactivated channels restart from
+ * zero state, so that stays true after reactivating all channels.
+ */
+static void TestActiveChannels(int num_channels, uint32_t active_channels) {
+  printf("TestActiveChannels(num_channels=%d, active_channels=0x%x)\n",
+         num_channels, (unsigned)active_channels);
+  const float kSampleRateHz = 8000.0f;
+  PostProcessorParams params;
+  PostProcessorSetDefaultParams(&params);
+  params.gain = 2.0f;
+  PostProcessor post_processor;
+  CHECK(PostProcessorInit(&post_processor, &params, kSampleRateHz,
+                          num_channels));
+  PostProcessor reference = post_processor;
+  PostProcessorSetActiveChannels(&post_processor, active_channels);
+
+  const int kBlockSize = 8;
+  float actual[8 * kPostProcessorMaxChannels];
+  float expected[8 * kPostProcessorMaxChannels];
+  int block;
+  for (block = 0; block < 200; ++block) {
+    if (block == 100) {
+      PostProcessorSetActiveChannels(&post_processor, ~UINT32_C(0));
+    }
+    int i;
+    for (i = 0; i < kBlockSize * num_channels; ++i) {
+      const int n = block * kBlockSize + i / num_channels;
+      const int c = i % num_channels;
+      const float frequency_hz = 30.0f + 25.0f * c;
+      actual[i] = 0.8f * sin(2.0 * M_PI * frequency_hz * n /
+                             kSampleRateHz + c);
+      expected[i] = (block >= 100 || ((active_channels >> c) & 1))
+          ? actual[i] : 0.0f;
+    }
+
+    PostProcessorProcessSamples(&post_processor, actual, kBlockSize);
+    PostProcessorProcessSamples(&reference, expected, kBlockSize);
+    for (i = 0; i < kBlockSize * num_channels; ++i) {
+      CHECK(actual[i] == expected[i]);
+    }
+  }
+}
+
+int main(int argc, char** argv) {
+  int use_equalizer;
+  for (use_equalizer = 0; use_equalizer <= 1; ++use_equalizer) {
+    TestFusedPwmMatchesSeparatePasses(use_equalizer, 10, 0);
+    TestFusedPwmMatchesSeparatePasses(use_equalizer, 10, 1);
+    TestFusedPwmMatchesSeparatePasses(use_equalizer, 3, 1);
+  }
+  TestMatchesScalarReference(3);
+  TestMatchesScalarReference(10);
+  TestMatchesScalarReference(kPostProcessorMaxChannels);
+  TestActiveChannels(10, 0x3ff);
+  TestActiveChannels(10, 0x301);
+  TestActiveChannels(10, 0x0f0);
+  TestActiveChannels(10, 0);
+  TestActiveChannels(kPostProcessorMaxChannels, 0x0f00f5);
+  TestWarmState();
+
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,216 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "src/tactile/processing_split.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "src/dsp/logging.h"
+#include "src/dsp/math_constants.h"
+#include "src/tactile/tactile_processor.h"
+
+#define kSampleRateHz 15625.0f
+#define kBlockSize 64
+#define kDecimationFactor 8
+#define kNumFrames (kBlockSize / kDecimationFactor)
+
+static DeadlineMonitorStats MakeStats(float mean_load, int num_overruns) {
+  DeadlineMonitorStats stats;
+  stats.num_buffers = 1000;
+  stats.num_overruns = num_overruns;
+  stats.num_near_misses = 0;
+  stats.mean_load = mean_load;
+  stats.max_load = (num_overruns > 0) ? 1.2f : mean_load;
+  return stats;
+}
+
+/* Envelope and hex weight codes round trip accurately. */
+static void TestFeatureCoding(void) {
+  puts("TestFeatureCoding");
+  volatile float zero = 0.0f;
+  CHECK(TactileFeaturesEncodeEnvelope(0.0f) == 0);
+  CHECK(TactileFeaturesEncodeEnvelope(-0.5f) == 0);
+  CHECK(TactileFeaturesEncodeEnvelope(zero / zero) == 0);  /* NaN. */
+  CHECK(TactileFeaturesEncodeEnvelope(5.0f) == 255);
+  CHECK(TactileFeaturesDecodeEnvelope(0) == 0.0f);
+  CHECK(TactileFeaturesDecodeEnvelope(255) == kTactileFeaturesMaxEnvelope);
+
+  float value;
+  for (value = 1e-3f; value < kTactileFeaturesMaxEnvelope; value *= 1.1f) {
+    const float decoded =
+        TactileFeaturesDecodeEnvelope(TactileFeaturesEncodeEnvelope(value));
+    /* Error is at most half a step of sqrt(value). */
+    CHECK(fabs(sqrt(decoded) - sqrt(value)) <=
+          0.5 * sqrt(kTactileFeaturesMaxEnvelope) / 255 + 1e-6);
+  }
+
+  float envelopes[kNumFrames * kEnveloperNumChannels];
+  float hex_weights[kTactileFeaturesNumHexWeights];
+  int i;
+  for (i = 0; i < kNumFrames * kEnveloperNumChannels; ++i) {
+    envelopes[i] = (float)rand() / RAND_MAX;
+  }
+  for (i = 0; i < kTactileFeaturesNumHexWeights; ++i) {
+    hex_weights[i] = (float)rand() / RAND_MAX;
+  }
+  uint8_t envelope_codes[kNumFrames * kEnveloperNumChannels];
+  uint8_t hex_codes[kTactileFeaturesNumHexWeights];
+  TactileFeaturesEncode(envelopes, kNumFrames, hex_weights, envelope_codes,
+                        hex_codes);
+  float decoded_envelopes[kNumFrames * kEnveloperNumChannels];
+  float decoded_hex_weights[kTactileFeaturesNumHexWeights];
+  TactileFeaturesDecode(envelope_codes, kNumFrames, hex_codes,
+                        decoded_envelopes, decoded_hex_weights);
+  for (i = 0; i < kNumFrames * kEnveloperNumChannels; ++i) {
+    CHECK(fabs(decoded_envelopes[i] - envelopes[i]) <= 0.01f);
+  }
+  for (i = 0; i < kTactileFeaturesNumHexWeights; ++i) {
+    CHECK(fabs(decoded_hex_weights[i] - hex_weights[i]) <= 0.5f / 255);
+  }
+}
+
+/* Computing features on one processor and writing outputs on another matches
+ * TactileProcessorProcessSamples(), exactly without coding and closely with.
+ */
+static void TestSplitMatchesFullProcessing(void) {
+  puts("TestSplitMatchesFullProcessing");
+  TactileProcessorParams params;
+  TactileProcessorSetDefaultParams(&params);
+  params.frontend_params.input_sample_rate_hz = kSampleRateHz;
+  params.frontend_params.block_size = kBlockSize;
+  params.decimation_factor = kDecimationFactor;
+  params.enable_silence_gating = 1;
+  params.vowel_embedding_stride = 2;
+
+  TactileProcessor* full = CHECK_NOTNULL(TactileProcessorMake(&params));
+  TactileProcessor* puck = CHECK_NOTNULL(TactileProcessorMake(&params));
+  TactileProcessor* sleeve = CHECK_NOTNULL(TactileProcessorMake(&params));
+  TactileProcessor* coded_puck = CHECK_NOTNULL(TactileProcessorMake(&params));
+  TactileProcessor* coded_sleeve =
+      CHECK_NOTNULL(TactileProcessorMake(&params));
+
+  const int kNumBlocks = 300;
+  float max_output = 0.0f;
+  int num_silent_blocks = 0;
+  int b;
+  for (b = 0; b < kNumBlocks; ++b) {
+    /* Alternate tones of different frequencies with silence. */
+    float input[kBlockSize];
+    const int segment = (b / 30) % 4;
+    const float frequency_hz = 300.0f + 700.0f * segment;
+    int i;
+    for (i = 0; i < kBlockSize; ++i) {
+      input[i] = (segment == 3) ? 0.0f :
+          0.3f * sin(2.0 * M_PI * frequency_hz * (b * kBlockSize + i) /
+                     kSampleRateHz);
+    }
+
+    float expected[kNumFrames * kTactileProcessorNumTactors];
+    TactileProcessorProcessSamples(full, input, expected);
+
+    float envelopes[kNumFrames * kEnveloperNumChannels];
+    float hex_weights[kTactileFeaturesNumHexWeights];
+    TactileProcessorComputeFeatures(puck, input, envelopes, hex_weights);
+    float actual[kNumFrames * kTactileProcessorNumTactors];
+    TactileProcessorWriteOutputs(sleeve, envelopes, hex_weights, actual,
+                                 kTactileProcessorNumTactors);
+    CHECK(memcmp(actual, expected, sizeof(expected)) == 0);
+
+    TactileProcessorComputeFeatures(coded_puck, input, envelopes,
+                                    hex_weights);
+    uint8_t envelope_codes[kNumFrames * kEnveloperNumChannels];
+    uint8_t hex_codes[kTactileFeaturesNumHexWeights];
+    TactileFeaturesEncode(envelopes, kNumFrames, hex_weights, envelope_codes,
+                          hex_codes);
+    TactileFeaturesDecode(envelope_codes, kNumFrames, hex_codes, envelopes,
+                          hex_weights);
+    TactileProcessorWriteOutputs(coded_sleeve, envelopes, hex_weights, actual,
+                                 kTactileProcessorNumTactors);
+    int all_zero = 1;
+    for (i = 0; i < kNumFrames * kTactileProcessorNumTactors; ++i) {
+      CHECK(fabs(actual[i] - expected[i]) <= 0.02f);
+      if (expected[i] != 0.0f) { all_zero = 0; }
+      if (expected[i] > max_output) { max_output = expected[i]; }
+    }
+    num_silent_blocks += all_zero;
+  }
+
+  CHECK(max_output > 0.1f);
+  CHECK(num_silent_blocks > 0);  /* Silence gating was exercised. */
+
+  TactileProcessorFree(coded_sleeve);
+  TactileProcessorFree(coded_puck);
+  TactileProcessorFree(sleeve);
+  TactileProcessorFree(puck);
+  TactileProcessorFree(full);
+}
+
+/* The selector moves the costly stages to the device with more headroom. */
+static void TestSelector(void) {
+  puts("TestSelector");
+  ProcessingSplitSelector selector;
+  CHECK(!ProcessingSplitSelectorInit(&selector, 2, 0.3f, 0.1f));
+  CHECK(!ProcessingSplitSelectorInit(&selector, kProcessingSplitSleeve,
+                                     0.0f, 0.1f));
+  CHECK(ProcessingSplitSelectorInit(&selector, kProcessingSplitSleeve,
+                                    0.3f, 0.1f));
+
+  /* Stats with no buffers are ignored. */
+  DeadlineMonitorStats puck_stats = MakeStats(0.1f, 0);
+  DeadlineMonitorStats sleeve_stats = MakeStats(0.9f, 0);
+  sleeve_stats.num_buffers = 0;
+  CHECK(ProcessingSplitSelectorUpdate(&selector, &puck_stats, &sleeve_stats)
+        == kProcessingSplitSleeve);
+
+  /* Balanced enough: moving would not lower the max load by the margin. */
+  puck_stats = MakeStats(0.2f, 0);
+  sleeve_stats = MakeStats(0.45f, 0);
+  CHECK(ProcessingSplitSelectorUpdate(&selector, &puck_stats, &sleeve_stats)
+        == kProcessingSplitSleeve);
+
+  /* The sleeve is busy, so move to the puck. */
+  puck_stats = MakeStats(0.1f, 0);
+  sleeve_stats = MakeStats(0.7f, 0);
+  CHECK(ProcessingSplitSelectorUpdate(&selector, &puck_stats, &sleeve_stats)
+        == kProcessingSplitPuck);
+
+  /* After the switch, the sleeve's drop in load measures the moved stages as
+   * 0.7 - 0.25 = 0.45. The puck at 0.55 is now busier, but moving back would
+   * make the max load 0.7, so the split holds.
+   */
+  puck_stats = MakeStats(0.55f, 0);
+  sleeve_stats = MakeStats(0.25f, 0);
+  CHECK(ProcessingSplitSelectorUpdate(&selector, &puck_stats, &sleeve_stats)
+        == kProcessingSplitPuck);
+  CHECK(fabs(selector.moved_load - 0.45f) < 1e-6f);
+
+  /* The puck overruns, e.g. from BLE activity, so move back. */
+  puck_stats = MakeStats(0.6f, 3);
+  sleeve_stats = MakeStats(0.25f, 0);
+  CHECK(ProcessingSplitSelectorUpdate(&selector, &puck_stats, &sleeve_stats)
+        == kProcessingSplitSleeve);
+}
+
+int main(int argc, char** argv) {
+  srand(0);
+  TestFeatureCoding();
+  TestSplitMatchesFullProcessing();
+  TestSelector();
+
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,153 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "src/tactile/profiler.h"
+
+#include "src/dsp/logging.h"
+#include "src/dsp/serialize.h"
+
+static void CheckStats(const Profiler* profiler, int stage,
+                       uint32_t expected_min, uint32_t expected_mean,
+                       uint32_t expected_max) {
+  uint32_t min_ticks;
+  uint32_t mean_ticks;
+  uint32_t max_ticks;
+  ProfilerGetStats(profiler, stage, &min_ticks, &mean_ticks, &max_ticks);
+  CHECK(min_ticks == expected_min);
+  CHECK(mean_ticks == expected_mean);
+  CHECK(max_ticks == expected_max);
+}
+
+/* Stats are computed over each window of buffers. */
+static void TestWindowStats(void) {
+  puts("TestWindowStats");
+  Profiler profiler;
+  CHECK(ProfilerInit(&profiler, 2, 3));
+
+  /* Stats are zero before the first window completes. */
+  CheckStats(&profiler, 0, 0, 0, 0);
+  CheckStats(&profiler, 1, 0, 0, 0);
+
+  /* First window. Stage 0 runs once per buffer, stage 1 runs twice. */
+  ProfilerRecord(&profiler, 0, 100);
+  ProfilerRecord(&profiler, 1, 7);
+  ProfilerRecord(&profiler, 1, 9);
+  ProfilerFinishedBuffer(&profiler);
+  ProfilerRecord(&profiler, 0, 300);
+  ProfilerRecord(&profiler, 1, 2);
+  ProfilerRecord(&profiler, 1, 30);
+  ProfilerFinishedBuffer(&profiler);
+  ProfilerRecord(&profiler, 0, 201);
+  ProfilerRecord(&profiler, 1, 11);
+  ProfilerRecord(&profiler, 1, 13);
+  /* Window is not yet complete, so stats are still zero. */
+  CheckStats(&profiler, 0, 0, 0, 0);
+  ProfilerFinishedBuffer(&profiler);
+
+  CheckStats(&profiler, 0, 100, 200, 300);
+  CheckStats(&profiler, 1, 2, 12, 30);
+
+  /* Second window. Stage 1 doesn't run. */
+  ProfilerRecord(&profiler, 0, 50);
+  ProfilerFinishedBuffer(&profiler);
+  ProfilerRecord(&profiler, 0, 51);
+  ProfilerFinishedBuffer(&profiler);
+  /* Stats of the first window are reported until the second completes. */
+  CheckStats(&profiler, 0, 100, 200, 300);
+  ProfilerRecord(&profiler, 0, 52);
+  ProfilerFinishedBuffer(&profiler);
+
+  CheckStats(&profiler, 0, 50, 51, 52);
+  CheckStats(&profiler, 1, 0, 0, 0);
+
+  ProfilerReset(&profiler);
+  CheckStats(&profiler, 0, 0, 0, 0);
+}
+
+/* Test ProfilerWriteStats() byte layout. */
+static void TestWriteStats(void) {
+  puts("TestWriteStats");
+  Profiler profiler;
+  CHECK(ProfilerInit(&profiler, 3, 1));
+
+  ProfilerRecord(&profiler, 0, 10);
+  ProfilerRecord(&profiler, 0, 20);
+  ProfilerRecord(&profiler, 2, 70000);
+  ProfilerFinishedBuffer(&profiler);
+
+  uint8_t bytes[3 * 3 * 4 + 1];
+  bytes[3 * 3 * 4] = 0xaa;
+  ProfilerWriteStats(&profiler, bytes);
+
+  static const uint32_t kExpected[3 * 3] = {
+    10, 15, 20,  /* Stage 0. */
+    0, 0, 0,  /* Stage 1. */
+    70000, 70000, 70000,  /* Stage 2. */
+  };
+  int i;
+  for (i = 0; i < 3 * 3; ++i) {
+    CHECK(LittleEndianReadU32(bytes + 4 * i) == kExpected[i]);
+  }
+  CHECK(bytes[3 * 3 * 4] == 0xaa);  /* Check writing stays in bounds. */
+}
+
+/* Test measuring with ProfilerStart() and ProfilerStop(). */
+static void TestStartStop(void) {
+  puts("TestStartStop");
+  Profiler profiler;
+  CHECK(ProfilerInit(&profiler, 1, 4));
+
+  int buffer;
+  for (buffer = 0; buffer < 4; ++buffer) {
+    ProfilerStart(&profiler, 0);
+    volatile float sum = 0.0f;
+    int i;
+    for (i = 0; i < 10000; ++i) {
+      sum += (float)i;
+    }
+    ProfilerStop(&profiler, 0);
+    ProfilerFinishedBuffer(&profiler);
+  }
+
+  CHECK(profiler.last[0].count == 4);
+  uint32_t min_ticks;
+  uint32_t mean_ticks;
+  uint32_t max_ticks;
+  ProfilerGetStats(&profiler, 0, &min_ticks, &mean_ticks, &max_ticks);
+  CHECK(min_ticks <= mean_ticks);
+  CHECK(mean_ticks <= max_ticks);
+  /* Elapsed ticks should be far less than wraparound. */
+  CHECK(max_ticks < UINT32_C(1) << 31);
+}
+
+static void TestInvalidInit(void) {
+  puts("TestInvalidInit");
+  Profiler profiler;
+  CHECK(!ProfilerInit(NULL, 1, 1));
+  CHECK(!ProfilerInit(&profiler, 0, 1));
+  CHECK(!ProfilerInit(&profiler, kProfilerMaxStages + 1, 1));
+  CHECK(!ProfilerInit(&profiler, 1, 0));
+  CHECK(ProfilerInit(&profiler, kProfilerMaxStages, 1));
+}
+
+int main(int argc, char** argv) {
+  TestWindowStats();
+  TestWriteStats();
+  TestStartStop();
+  TestInvalidInit();
+
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
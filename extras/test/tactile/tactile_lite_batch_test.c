@@ -0,0 +1,291 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "src/tactile/tactile_lite_batch.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "src/dsp/logging.h"
+
+#define kSampleRateHz 16000.0f
+#define kDecimationFactor 8
+#define kBlockSize 64
+#define kNumFramesPerBlock (kBlockSize / kDecimationFactor)
+#define kNumBlocks 500
+#define kMaxInstances 7
+#define kMaxEvents 64
+
+static float RandUniform(float min_value, float max_value) {
+  return min_value + (max_value - min_value) * ((float)rand() / RAND_MAX);
+}
+
+/* Makes input with bursts of noise, different for each instance. */
+static float* MakeInput(int instance, int num_samples) {
+  float* input = (float*)CHECK_NOTNULL(malloc(num_samples * sizeof(float)));
+  const int burst_period = 2500 + 300 * instance;
+  const float amplitude = 0.05f + 0.1f * instance;
+  int n;
+  for (n = 0; n < num_samples; ++n) {
+    const float noise = RandUniform(-1e-3f, 1e-3f);
+    const int in_burst = (n % burst_period) < 600;
+    input[n] = noise + (in_burst ? amplitude * RandUniform(-1.0f, 1.0f) : 0.0f);
+  }
+  return input;
+}
+
+/* Varies the default params for each instance. */
+static void MakeParams(int instance, SingleBandEnvelopeParams* envelope_params,
+                       SparsePeakPickerParams* peak_picker_params) {
+  *envelope_params = kDefaultSingleBandEnvelopeParams;
+  *peak_picker_params = kDefaultSparsePeakPickerParams;
+  envelope_params->bpf_low_edge_hz += 50.0f * instance;
+  envelope_params->denoising_strength *= 1.0f + 0.1f * instance;
+  envelope_params->agc_strength = 0.5f + 0.05f * instance;
+  envelope_params->compressor_exponent = 0.2f + 0.02f * instance;
+  if (instance == 2) {  /* Bypass the feedback highpass filter. */
+    envelope_params->feedback_hpf_cutoff_hz = 0.0f;
+  }
+  peak_picker_params->min_peak_spacing_s = 0.04f + 0.01f * instance;
+}
+
+/* Compares batch processing with running scalar SingleBandEnvelope and
+ * SparsePeakPicker separately for each instance.
+ */
+static void TestCompareWithScalar(int num_instances) {
+  printf("TestCompareWithScalar(%d)\n", num_instances);
+  srand(0);
+  const int num_samples = kNumBlocks * kBlockSize;
+  SingleBandEnvelopeParams envelope_params[kMaxInstances];
+  SparsePeakPickerParams peak_picker_params[kMaxInstances];
+  SingleBandEnvelope envelopes[kMaxInstances];
+  SparsePeakPicker peak_pickers[kMaxInstances];
+  /* Scalar peak pickers run on the batch's envelope output, to check that peak
+   * picking matches exactly.
+   */
+  SparsePeakPicker exact_peak_pickers[kMaxInstances];
+  float* inputs[kMaxInstances];
+  int i;
+  for (i = 0; i < num_instances; ++i) {
+    MakeParams(i, &envelope_params[i], &peak_picker_params[i]);
+    CHECK(SingleBandEnvelopeInit(&envelopes[i], &envelope_params[i],
+                                 kSampleRateHz, kDecimationFactor));
+    CHECK(SparsePeakPickerInit(&peak_pickers[i], &peak_picker_params[i],
+                               kSampleRateHz / kDecimationFactor));
+    CHECK(SparsePeakPickerInit(&exact_peak_pickers[i], &peak_picker_params[i],
+                               kSampleRateHz / kDecimationFactor));
+    inputs[i] = MakeInput(i, num_samples);
+  }
+
+  TactileLiteBatch* batch = CHECK_NOTNULL(TactileLiteBatchMake(
+      num_instances, envelope_params, peak_picker_params, kSampleRateHz,
+      kDecimationFactor, kBlockSize));
+
+  int num_scalar_events = 0;
+  int num_batch_events = 0;
+  int num_matched_events = 0;
+  float max_envelope_diff = 0.0f;  /* Max relative difference. */
+  int block;
+  for (block = 0; block < kNumBlocks; ++block) {
+    const float* block_inputs[kMaxInstances];
+    float envelope_buffers[kMaxInstances][kNumFramesPerBlock];
+    float* envelope_outputs[kMaxInstances];
+    for (i = 0; i < num_instances; ++i) {
+      block_inputs[i] = inputs[i] + block * kBlockSize;
+      envelope_outputs[i] = envelope_buffers[i];
+    }
+    TactileLiteEvent events[kMaxEvents];
+    const int num_events = TactileLiteBatchProcessSamples(
+        batch, block_inputs, kBlockSize, envelope_outputs, events, kMaxEvents);
+    num_batch_events += num_events;
+
+    for (i = 0; i < num_instances; ++i) {
+      float expected[kNumFramesPerBlock];
+      SingleBandEnvelopeProcessSamples(&envelopes[i], block_inputs[i],
+                                       kBlockSize, expected);
+      int e = 0;
+      int t;
+      for (t = 0; t < kNumFramesPerBlock; ++t) {
+        /* Difference relative to the compressor output before subtracting
+         * kCompressorStabilization, dominated by FastPow()'s ~0.5% error.
+         */
+        const float diff = fabs(envelope_outputs[i][t] - expected[t]) /
+            (expected[t] + 0.125f);
+        if (diff > max_envelope_diff) { max_envelope_diff = diff; }
+
+        if (SparsePeakPickerProcessSamples(&peak_pickers[i], &expected[t], 1)) {
+          ++num_scalar_events;
+        }
+        /* Check that instance i's next event in the list matches. */
+        const float peak = SparsePeakPickerProcessSamples(
+            &exact_peak_pickers[i], &envelope_outputs[i][t], 1);
+        if (peak > 0.0f) {
+          while (e < num_events && events[e].instance != i) { ++e; }
+          CHECK(e < num_events);
+          CHECK(events[e].frame == t);
+          CHECK(events[e].peak == peak);
+          ++e;
+          ++num_matched_events;
+        }
+      }
+      /* There are no further events for instance i. */
+      for (; e < num_events; ++e) {
+        CHECK(events[e].instance != i);
+      }
+    }
+  }
+
+  CHECK(num_matched_events == num_batch_events);
+  CHECK(max_envelope_diff < 0.01f);
+  /* Envelopes agree closely, so the same peaks should be picked. */
+  CHECK(num_batch_events == num_scalar_events);
+  CHECK(num_batch_events >= 5 * num_instances);
+  CHECK(batch->num_dropped_events == 0);
+
+  TactileLiteBatchFree(batch);
+  for (i = 0; i < num_instances; ++i) {
+    free(inputs[i]);
+  }
+}
+
+/* Events past `max_events` are dropped and counted. */
+static void TestDroppedEvents(void) {
+  puts("TestDroppedEvents");
+  srand(0);
+  const int kNumInstances = 4;
+  const int num_samples = kNumBlocks * kBlockSize;
+  SingleBandEnvelopeParams envelope_params[4];
+  SparsePeakPickerParams peak_picker_params[4];
+  int i;
+  for (i = 0; i < kNumInstances; ++i) {
+    MakeParams(0, &envelope_params[i], &peak_picker_params[i]);
+  }
+  float* input = MakeInput(0, num_samples);
+  TactileLiteBatch* batch = CHECK_NOTNULL(TactileLiteBatchMake(
+      kNumInstances, envelope_params, peak_picker_params, kSampleRateHz,
+      kDecimationFactor, kBlockSize));
+
+  int num_events = 0;
+  int block;
+  for (block = 0; block < kNumBlocks; ++block) {
+    /* All instances process the same input. */
+    const float* block_inputs[4];
+    for (i = 0; i < kNumInstances; ++i) {
+      block_inputs[i] = input + block * kBlockSize;
+    }
+    TactileLiteEvent events[2];
+    num_events += TactileLiteBatchProcessSamples(
+        batch, block_inputs, kBlockSize, NULL, events, 1);
+  }
+
+  /* Identical instances pick peaks simultaneously, so 3 of every 4 are
+   * dropped.
+   */
+  CHECK(num_events > 0);
+  CHECK(batch->num_dropped_events == 3 * num_events);
+
+  TactileLiteBatchFree(batch);
+  free(input);
+}
+
+/* Resetting one instance restores its initial state and leaves the others
+ * unchanged.
+ */
+static void TestResetInstance(void) {
+  puts("TestResetInstance");
+  srand(0);
+  const int kNumInstances = 2;
+  SingleBandEnvelopeParams envelope_params[2];
+  SparsePeakPickerParams peak_picker_params[2];
+  int i;
+  for (i = 0; i < kNumInstances; ++i) {
+    MakeParams(i, &envelope_params[i], &peak_picker_params[i]);
+  }
+  float* input = MakeInput(1, 4 * kBlockSize);
+  TactileLiteBatch* batch = CHECK_NOTNULL(TactileLiteBatchMake(
+      kNumInstances, envelope_params, peak_picker_params, kSampleRateHz,
+      kDecimationFactor, kBlockSize));
+  TactileLiteBatch* fresh_batch = CHECK_NOTNULL(TactileLiteBatchMake(
+      kNumInstances, envelope_params, peak_picker_params, kSampleRateHz,
+      kDecimationFactor, kBlockSize));
+
+  float buffers[2][2][kNumFramesPerBlock];
+  float* outputs[2] = {buffers[0][0], buffers[0][1]};
+  float* fresh_outputs[2] = {buffers[1][0], buffers[1][1]};
+  TactileLiteEvent events[kMaxEvents];
+  const float* block_inputs[2];
+  int block;
+  for (block = 0; block < 3; ++block) {
+    block_inputs[0] = block_inputs[1] = input + block * kBlockSize;
+    TactileLiteBatchProcessSamples(batch, block_inputs, kBlockSize, outputs,
+                                   events, kMaxEvents);
+  }
+
+  TactileLiteBatchResetInstance(batch, 0);
+  /* Instance 0 continues as if starting from block 0, instance 1 from
+   * block 3.
+   */
+  block_inputs[0] = input;
+  block_inputs[1] = input + 3 * kBlockSize;
+  TactileLiteBatchProcessSamples(batch, block_inputs, kBlockSize, outputs,
+                                 events, kMaxEvents);
+  TactileLiteBatchProcessSamples(fresh_batch, block_inputs, kBlockSize,
+                                 fresh_outputs, events, kMaxEvents);
+  int t;
+  for (t = 0; t < kNumFramesPerBlock; ++t) {
+    CHECK(outputs[0][t] == fresh_outputs[0][t]);
+    CHECK(outputs[1][t] != fresh_outputs[1][t]);
+  }
+
+  TactileLiteBatchFree(fresh_batch);
+  TactileLiteBatchFree(batch);
+  free(input);
+}
+
+static void TestInvalidParams(void) {
+  puts("TestInvalidParams");
+  SingleBandEnvelopeParams envelope_params[2];
+  SparsePeakPickerParams peak_picker_params[2];
+  MakeParams(0, &envelope_params[0], &peak_picker_params[0]);
+  MakeParams(1, &envelope_params[1], &peak_picker_params[1]);
+  peak_picker_params[1].min_peak_spacing_s = -1.0f;
+  CHECK(TactileLiteBatchMake(2, envelope_params, peak_picker_params,
+                             kSampleRateHz, kDecimationFactor,
+                             kBlockSize) == NULL);
+
+  TactileLiteBatch* batch = CHECK_NOTNULL(TactileLiteBatchMake(
+      1, envelope_params, peak_picker_params, kSampleRateHz,
+      kDecimationFactor, kBlockSize));
+  CHECK(!TactileLiteBatchSetParams(batch, 0, &envelope_params[1],
+                                   &peak_picker_params[1]));
+  CHECK(!TactileLiteBatchSetParams(batch, 1, &envelope_params[0],
+                                   &peak_picker_params[0]));
+  CHECK(TactileLiteBatchSetParams(batch, 0, &envelope_params[0],
+                                  &peak_picker_params[0]));
+  TactileLiteBatchFree(batch);
+}
+
+int main(int argc, char** argv) {
+  TestCompareWithScalar(1);
+  TestCompareWithScalar(4);
+  TestCompareWithScalar(kMaxInstances);
+  TestDroppedEvents();
+  TestResetInstance();
+  TestInvalidParams();
+
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
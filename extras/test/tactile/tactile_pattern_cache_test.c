@@ -0,0 +1,229 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "src/tactile/tactile_pattern_cache.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "src/dsp/logging.h"
+
+#define kSampleRateHz 2000.0f
+#define kNumChannels 10
+#define kBlockSize 64
+
+/* Storage, with int16 alignment. */
+static int16_t g_storage[8192];
+
+/* Synthesizes a pattern with TactilePattern and with the cache, and checks
+ * that they agree. If `ex_pattern` is NULL, `simple_pattern` is used.
+ */
+static void CheckMatchesSynth(TactilePatternCache* cache,
+                              const uint8_t* ex_pattern,
+                              const char* simple_pattern) {
+  TactilePattern synth;
+  TactilePatternInit(&synth, kSampleRateHz, kNumChannels);
+  if (ex_pattern) {
+    TactilePatternStartEx(&synth, ex_pattern);
+    TactilePatternCacheStartEx(cache, ex_pattern);
+  } else {
+    CHECK(TactilePatternStart(&synth, simple_pattern));
+    CHECK(TactilePatternCacheStart(cache, simple_pattern));
+  }
+  CHECK(TactilePatternCacheIsActive(cache));
+
+  float expected[kBlockSize * kNumChannels];
+  float actual[kBlockSize * kNumChannels];
+  int expected_active;
+  int num_blocks = 0;
+  do {
+    expected_active = TactilePatternSynthesize(&synth, kBlockSize, expected);
+    const int actual_active =
+        TactilePatternCacheSynthesize(cache, kBlockSize, actual);
+    CHECK(actual_active == expected_active);
+
+    int i;
+    for (i = 0; i < kBlockSize * kNumChannels; ++i) {
+      CHECK(fabs(actual[i] - expected[i]) <= 1e-4f);
+    }
+    ++num_blocks;
+  } while (expected_active);
+
+  CHECK(num_blocks > 1);
+  CHECK(!TactilePatternCacheIsActive(cache));
+}
+
+/* Simple patterns play the same signal on all channels, so they should be
+ * cached as one track, and a second Start should be a cache hit.
+ */
+static void TestSimplePattern(void) {
+  puts("TestSimplePattern");
+  TactilePatternCache cache;
+  CHECK(TactilePatternCacheInit(&cache, (uint8_t*)g_storage,
+                                sizeof(g_storage), kSampleRateHz,
+                                kNumChannels));
+
+  CheckMatchesSynth(&cache, NULL, kTactilePatternConfirm);
+  TactilePatternCacheStats stats;
+  TactilePatternCacheGetStats(&cache, &stats);
+  CHECK(stats.misses == 1);
+  CHECK(stats.hits == 0);
+  CHECK(stats.num_entries == 1);
+  CHECK(stats.bytes_capacity == (int)sizeof(g_storage));
+
+  const TactilePatternCacheEntry* entry = &cache.entries[0];
+  int c;
+  for (c = 0; c < kNumChannels; ++c) {
+    CHECK(entry->channel_track[c] == 0);
+  }
+  /* One track, plus the pattern bytes. */
+  CHECK(stats.bytes_used < entry->num_frames * (int)sizeof(int16_t) + 32);
+
+  CheckMatchesSynth(&cache, NULL, kTactilePatternConfirm);
+  TactilePatternCacheGetStats(&cache, &stats);
+  CHECK(stats.misses == 1);
+  CHECK(stats.hits == 1);
+}
+
+/* Extended pattern with a movement across a few channels. */
+static void TestExPattern(void) {
+  puts("TestExPattern");
+  static const uint8_t kPattern[] = {
+      kTactilePatternOpSetWaveform + 0, kTactilePatternWaveformSin25Hz,
+      kTactilePatternOpSetGain + 0, 0xff,
+      TACTILE_PATTERN_OP_PLAY_MS(100),
+      kTactilePatternOpMove, 0x01,
+      TACTILE_PATTERN_OP_PLAY_MS(100),
+      kTactilePatternOpMove, 0x12,
+      TACTILE_PATTERN_OP_PLAY_MS(100),
+      kTactilePatternOpEnd,
+  };
+  TactilePatternCache cache;
+  CHECK(TactilePatternCacheInit(&cache, (uint8_t*)g_storage,
+                                sizeof(g_storage), kSampleRateHz,
+                                kNumChannels));
+  CheckMatchesSynth(&cache, kPattern, NULL);
+
+  const TactilePatternCacheEntry* entry = &cache.entries[0];
+  CHECK(entry->channel_track[0] == 0);
+  CHECK(entry->channel_track[1] == 1);
+  CHECK(entry->channel_track[2] == 2);
+  int c;
+  for (c = 3; c < kNumChannels; ++c) {
+    CHECK(entry->channel_track[c] == -1);  /* Silent channels. */
+  }
+
+  CheckMatchesSynth(&cache, kPattern, NULL);
+  TactilePatternCacheStats stats;
+  TactilePatternCacheGetStats(&cache, &stats);
+  CHECK(stats.hits == 1);
+}
+
+/* With small storage, least-recently-used patterns are evicted. */
+static void TestEviction(void) {
+  puts("TestEviction");
+  TactilePatternCache cache;
+  /* Room for about two of the patterns below. */
+  CHECK(TactilePatternCacheInit(&cache, (uint8_t*)g_storage, 3200,
+                                kSampleRateHz, kNumChannels));
+
+  CHECK(TactilePatternCacheCompileSimple(&cache, "6A-6A"));
+  CHECK(TactilePatternCacheCompileSimple(&cache, "6B-6B"));
+  TactilePatternCacheStats stats;
+  TactilePatternCacheGetStats(&cache, &stats);
+  CHECK(stats.num_entries == 2);
+  CHECK(stats.misses == 2);
+  CHECK(stats.evictions == 0);
+
+  /* Use "6A-6A" so that "6B-6B" is least recently used. */
+  CheckMatchesSynth(&cache, NULL, "6A-6A");
+  CheckMatchesSynth(&cache, NULL, "6C-6C");
+  TactilePatternCacheGetStats(&cache, &stats);
+  CHECK(stats.hits == 1);
+  CHECK(stats.misses == 3);
+  CHECK(stats.evictions >= 1);
+  CHECK(stats.bytes_used <= stats.bytes_capacity);
+
+  /* "6A-6A" is still cached, and playback is still correct after storage was
+   * compacted.
+   */
+  CheckMatchesSynth(&cache, NULL, "6A-6A");
+  TactilePatternCacheGetStats(&cache, &stats);
+  CHECK(stats.hits == 2);
+  CheckMatchesSynth(&cache, NULL, "6C-6C");
+  TactilePatternCacheGetStats(&cache, &stats);
+  CHECK(stats.hits == 3);
+  /* "6B-6B" was evicted. */
+  CheckMatchesSynth(&cache, NULL, "6B-6B");
+  TactilePatternCacheGetStats(&cache, &stats);
+  CHECK(stats.misses == 4);
+}
+
+/* A pattern too large for storage is played by live synthesis. */
+static void TestUncached(void) {
+  puts("TestUncached");
+  TactilePatternCache cache;
+  CHECK(TactilePatternCacheInit(&cache, (uint8_t*)g_storage, 64,
+                                kSampleRateHz, kNumChannels));
+  CHECK(!TactilePatternCacheCompileSimple(&cache, kTactilePatternConnect));
+  CheckMatchesSynth(&cache, NULL, kTactilePatternConnect);
+
+  TactilePatternCacheStats stats;
+  TactilePatternCacheGetStats(&cache, &stats);
+  CHECK(stats.uncached == 1);
+  CHECK(stats.num_entries == 0);
+  CHECK(stats.bytes_used == 0);
+}
+
+/* Calibration tones go through the cache too. */
+static void TestCalibrationTones(void) {
+  puts("TestCalibrationTones");
+  TactilePatternCache cache;
+  CHECK(TactilePatternCacheInit(&cache, (uint8_t*)g_storage,
+                                sizeof(g_storage), kSampleRateHz,
+                                kNumChannels));
+  TactilePattern synth;
+  TactilePatternInit(&synth, kSampleRateHz, kNumChannels);
+  TactilePatternStartCalibrationTones(&synth, 2, 5);
+  TactilePatternCacheStartCalibrationTones(&cache, 2, 5);
+
+  float expected[kBlockSize * kNumChannels];
+  float actual[kBlockSize * kNumChannels];
+  int active;
+  do {
+    active = TactilePatternSynthesize(&synth, kBlockSize, expected);
+    CHECK(TactilePatternCacheSynthesize(&cache, kBlockSize, actual) == active);
+    int i;
+    for (i = 0; i < kBlockSize * kNumChannels; ++i) {
+      CHECK(fabs(actual[i] - expected[i]) <= 1e-4f);
+    }
+  } while (active);
+
+  TactilePatternCacheStats stats;
+  TactilePatternCacheGetStats(&cache, &stats);
+  CHECK(stats.misses == 1);
+}
+
+int main(int argc, char** argv) {
+  TestSimplePattern();
+  TestExPattern();
+  TestEviction();
+  TestUncached();
+  TestCalibrationTones();
+
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
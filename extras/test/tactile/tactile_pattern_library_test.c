@@ -0,0 +1,343 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "src/tactile/tactile_pattern_library.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "src/dsp/logging.h"
+#include "src/tactile/tactile_pattern.h"
+#include "src/tactile/tactile_pattern_cache.h"
+
+#define kPageSize 1024
+#define kNumPatterns 4
+#define kBaseAddress 0x2000
+/* Max chunk data size in a kTactilePatternChunk message. */
+#define kChunkSize 123
+
+/* Fake flash in RAM. Like real flash, writes may only clear bits. */
+typedef struct {
+  uint8_t bytes[kNumPatterns * kPageSize];
+  int num_reads;
+  int num_erases;
+  /* If nonnegative, writes fail after this many more bytes are written. */
+  int fail_after_bytes;
+} FakeFlash;
+
+static void FakeRead(void* user_data, uint32_t address, uint8_t* dest,
+                     int size) {
+  FakeFlash* fake = (FakeFlash*)user_data;
+  CHECK(kBaseAddress <= address &&
+        address + size <= kBaseAddress + sizeof(fake->bytes));
+  memcpy(dest, fake->bytes + (address - kBaseAddress), size);
+  ++fake->num_reads;
+}
+
+static int FakeWrite(void* user_data, uint32_t address, const uint8_t* src,
+                     int size) {
+  FakeFlash* fake = (FakeFlash*)user_data;
+  CHECK(kBaseAddress <= address &&
+        address + size <= kBaseAddress + sizeof(fake->bytes));
+  uint8_t* dest = fake->bytes + (address - kBaseAddress);
+  int i;
+  for (i = 0; i < size; ++i) {
+    if (fake->fail_after_bytes == 0) { return 0; }
+    if (fake->fail_after_bytes > 0) { --fake->fail_after_bytes; }
+    CHECK(dest[i] == 0xff);  /* Only erased bytes may be written. */
+    dest[i] = src[i];
+  }
+  return 1;
+}
+
+static int FakeErasePage(void* user_data, uint32_t address) {
+  FakeFlash* fake = (FakeFlash*)user_data;
+  CHECK((address - kBaseAddress) % kPageSize == 0);
+  const int page = (address - kBaseAddress) / kPageSize;
+  CHECK(0 <= page && page < kNumPatterns);
+  memset(fake->bytes + page * kPageSize, 0xff, kPageSize);
+  ++fake->num_erases;
+  return 1;
+}
+
+/* Makes a fake flash with arbitrary initial content. */
+static void FakeFlashInit(FakeFlash* fake, TactilePatternLibraryFlash* flash) {
+  int i;
+  for (i = 0; i < kNumPatterns * kPageSize; ++i) {
+    fake->bytes[i] = (uint8_t)rand();
+  }
+  fake->num_reads = 0;
+  fake->num_erases = 0;
+  fake->fail_after_bytes = -1;
+  flash->read = FakeRead;
+  flash->write = FakeWrite;
+  flash->erase_page = FakeErasePage;
+  flash->user_data = fake;
+}
+
+/* Makes a valid pattern of `size` bytes, without the End op, that plays
+ * 20 ms segments with varying gain.
+ */
+static void MakePattern(int size, int seed, uint8_t* pattern) {
+  int i;
+  for (i = 0; i + 2 < size; i += 3) {
+    pattern[i] = kTactilePatternOpSetAllGain;
+    pattern[i + 1] = (uint8_t)(seed + 10 * i);
+    pattern[i + 2] = kTactilePatternOpPlay;
+  }
+  for (; i < size; ++i) {
+    pattern[i] = kTactilePatternOpPlay;
+  }
+}
+
+/* Uploads `pattern` in chunks of kChunkSize bytes, checking the statuses. */
+static void Upload(TactilePatternLibrary* library, int id,
+                   const uint8_t* pattern, int size) {
+  int offset = 0;
+  do {
+    const int chunk_size = (size - offset < kChunkSize)
+        ? size - offset : kChunkSize;
+    const int status = TactilePatternLibraryWriteChunk(
+        library, id, size, offset, pattern + offset, chunk_size);
+    offset += chunk_size;
+    CHECK(status == ((offset < size) ? kTactilePatternLibraryChunkAccepted
+                                     : kTactilePatternLibraryUploadComplete));
+  } while (offset < size);
+}
+
+/* Checks that pattern `id` is `pattern` followed by the End op. */
+static void CheckPattern(TactilePatternLibrary* library, int id,
+                         const uint8_t* pattern, int size) {
+  CHECK(TactilePatternLibraryHas(library, id));
+  const uint8_t* stored = TactilePatternLibraryGet(library, id);
+  CHECK(stored != NULL);
+  CHECK(memcmp(stored, pattern, size) == 0);
+  CHECK(stored[size] == kTactilePatternOpEnd);
+}
+
+static void TestUploadAndGet(void) {
+  puts("TestUploadAndGet");
+  FakeFlash fake;
+  TactilePatternLibraryFlash flash;
+  FakeFlashInit(&fake, &flash);
+  TactilePatternLibrary library;
+  CHECK(TactilePatternLibraryInit(&library, &flash, kBaseAddress, kPageSize,
+                                  kNumPatterns));
+  int id;
+  for (id = 0; id < kNumPatterns; ++id) {
+    CHECK(!TactilePatternLibraryHas(&library, id));
+    CHECK(TactilePatternLibraryGet(&library, id) == NULL);
+  }
+
+  /* Patterns of 1, 2, and 5 chunks. */
+  uint8_t pattern0[100];
+  uint8_t pattern1[200];
+  uint8_t pattern3[kTactilePatternLibraryMaxPatternBytes - 1];
+  MakePattern(sizeof(pattern0), 0, pattern0);
+  MakePattern(sizeof(pattern1), 1, pattern1);
+  MakePattern(sizeof(pattern3), 3, pattern3);
+  Upload(&library, 0, pattern0, sizeof(pattern0));
+  Upload(&library, 1, pattern1, sizeof(pattern1));
+  Upload(&library, 3, pattern3, sizeof(pattern3));
+  CHECK(fake.num_erases == 3);
+
+  CheckPattern(&library, 0, pattern0, sizeof(pattern0));
+  CheckPattern(&library, 1, pattern1, sizeof(pattern1));
+  CheckPattern(&library, 3, pattern3, sizeof(pattern3));
+  CHECK(!TactilePatternLibraryHas(&library, 2));
+
+  /* Getting the same pattern again doesn't read flash. */
+  const int num_reads = fake.num_reads;
+  const uint8_t* stored = TactilePatternLibraryGet(&library, 3);
+  CHECK(stored == TactilePatternLibraryGet(&library, 3));
+  CHECK(fake.num_reads == num_reads);
+
+  /* Patterns persist after reinitializing. */
+  CHECK(TactilePatternLibraryInit(&library, &flash, kBaseAddress, kPageSize,
+                                  kNumPatterns));
+  CheckPattern(&library, 0, pattern0, sizeof(pattern0));
+  CheckPattern(&library, 1, pattern1, sizeof(pattern1));
+  CheckPattern(&library, 3, pattern3, sizeof(pattern3));
+  CHECK(!TactilePatternLibraryHas(&library, 2));
+
+  /* Replace pattern 1 while it is loaded. */
+  uint8_t new_pattern1[50];
+  MakePattern(sizeof(new_pattern1), 7, new_pattern1);
+  CHECK(TactilePatternLibraryGet(&library, 1) != NULL);
+  Upload(&library, 1, new_pattern1, sizeof(new_pattern1));
+  CheckPattern(&library, 1, new_pattern1, sizeof(new_pattern1));
+
+  /* Uploading an empty pattern deletes it. */
+  CHECK(TactilePatternLibraryWriteChunk(&library, 0, 0, 0, NULL, 0) ==
+        kTactilePatternLibraryUploadComplete);
+  CHECK(!TactilePatternLibraryHas(&library, 0));
+  CHECK(TactilePatternLibraryGet(&library, 0) == NULL);
+  CHECK(TactilePatternLibraryDelete(&library, 3));
+  CHECK(TactilePatternLibraryInit(&library, &flash, kBaseAddress, kPageSize,
+                                  kNumPatterns));
+  CHECK(!TactilePatternLibraryHas(&library, 0));
+  CheckPattern(&library, 1, new_pattern1, sizeof(new_pattern1));
+  CHECK(!TactilePatternLibraryHas(&library, 3));
+}
+
+static void TestOutOfOrderChunks(void) {
+  puts("TestOutOfOrderChunks");
+  FakeFlash fake;
+  TactilePatternLibraryFlash flash;
+  FakeFlashInit(&fake, &flash);
+  TactilePatternLibrary library;
+  CHECK(TactilePatternLibraryInit(&library, &flash, kBaseAddress, kPageSize,
+                                  kNumPatterns));
+  uint8_t pattern[300];
+  MakePattern(sizeof(pattern), 0, pattern);
+
+  /* Skipping a chunk discards the upload. */
+  CHECK(TactilePatternLibraryWriteChunk(&library, 2, 300, 0, pattern, 100) ==
+        kTactilePatternLibraryChunkAccepted);
+  CHECK(TactilePatternLibraryWriteChunk(
+            &library, 2, 300, 200, pattern + 200, 100) ==
+        kTactilePatternLibraryErrorOutOfOrder);
+  CHECK(TactilePatternLibraryWriteChunk(
+            &library, 2, 300, 100, pattern + 100, 100) ==
+        kTactilePatternLibraryErrorOutOfOrder);
+
+  /* Chunks with a different ID or size don't continue the upload. */
+  CHECK(TactilePatternLibraryWriteChunk(&library, 2, 300, 0, pattern, 100) ==
+        kTactilePatternLibraryChunkAccepted);
+  CHECK(TactilePatternLibraryWriteChunk(
+            &library, 1, 300, 100, pattern + 100, 100) ==
+        kTactilePatternLibraryErrorOutOfOrder);
+  CHECK(TactilePatternLibraryWriteChunk(&library, 2, 300, 0, pattern, 100) ==
+        kTactilePatternLibraryChunkAccepted);
+  CHECK(TactilePatternLibraryWriteChunk(
+            &library, 2, 299, 100, pattern + 100, 100) ==
+        kTactilePatternLibraryErrorOutOfOrder);
+
+  /* A chunk at offset 0 restarts the upload. */
+  CHECK(TactilePatternLibraryWriteChunk(&library, 2, 300, 0, pattern, 100) ==
+        kTactilePatternLibraryChunkAccepted);
+  Upload(&library, 2, pattern, sizeof(pattern));
+  CheckPattern(&library, 2, pattern, sizeof(pattern));
+  CHECK(fake.num_erases == 1);
+}
+
+/* A write interrupted by power loss leaves the slot empty. */
+static void TestInterruptedWrite(void) {
+  puts("TestInterruptedWrite");
+  FakeFlash fake;
+  TactilePatternLibraryFlash flash;
+  FakeFlashInit(&fake, &flash);
+  TactilePatternLibrary library;
+  CHECK(TactilePatternLibraryInit(&library, &flash, kBaseAddress, kPageSize,
+                                  kNumPatterns));
+  uint8_t pattern[150];
+  MakePattern(sizeof(pattern), 0, pattern);
+  Upload(&library, 1, pattern, sizeof(pattern));
+
+  fake.fail_after_bytes = 80;
+  CHECK(TactilePatternLibraryWriteChunk(&library, 1, 150, 0, pattern, 150) ==
+        kTactilePatternLibraryErrorFlash);
+  CHECK(!TactilePatternLibraryHas(&library, 1));
+  fake.fail_after_bytes = -1;
+  CHECK(TactilePatternLibraryInit(&library, &flash, kBaseAddress, kPageSize,
+                                  kNumPatterns));
+  CHECK(!TactilePatternLibraryHas(&library, 1));
+
+  /* A corrupted pattern fails its checksum. */
+  Upload(&library, 1, pattern, sizeof(pattern));
+  CHECK(TactilePatternLibraryInit(&library, &flash, kBaseAddress, kPageSize,
+                                  kNumPatterns));
+  fake.bytes[kPageSize + kTactilePatternLibraryHeaderBytes + 10] = 0;
+  CHECK(TactilePatternLibraryGet(&library, 1) == NULL);
+  CHECK(!TactilePatternLibraryHas(&library, 1));
+}
+
+/* Playing a library pattern twice hits the TactilePatternCache. */
+static void TestPlayWithCache(void) {
+  puts("TestPlayWithCache");
+  FakeFlash fake;
+  TactilePatternLibraryFlash flash;
+  FakeFlashInit(&fake, &flash);
+  TactilePatternLibrary library;
+  CHECK(TactilePatternLibraryInit(&library, &flash, kBaseAddress, kPageSize,
+                                  kNumPatterns));
+  /* Larger than kTactilePatternBufferSize. */
+  uint8_t pattern[200];
+  MakePattern(sizeof(pattern), 0, pattern);
+  Upload(&library, 0, pattern, sizeof(pattern));
+
+  static uint16_t storage[16384];
+  TactilePatternCache cache;
+  CHECK(TactilePatternCacheInit(&cache, (uint8_t*)storage, sizeof(storage),
+                                1000.0f, 2));
+  float output[2 * 64];
+  int i;
+  for (i = 0; i < 2; ++i) {
+    const uint8_t* stored = TactilePatternLibraryGet(&library, 0);
+    CHECK(stored != NULL);
+    TactilePatternCacheStartEx(&cache, stored);
+    while (TactilePatternCacheSynthesize(&cache, 64, output)) {}
+  }
+
+  TactilePatternCacheStats stats;
+  TactilePatternCacheGetStats(&cache, &stats);
+  CHECK(stats.misses == 1);
+  CHECK(stats.hits == 1);
+  CHECK(stats.uncached == 0);
+}
+
+static void TestInvalid(void) {
+  puts("TestInvalid");
+  FakeFlash fake;
+  TactilePatternLibraryFlash flash;
+  FakeFlashInit(&fake, &flash);
+  TactilePatternLibrary library;
+  CHECK(!TactilePatternLibraryInit(&library, &flash, kBaseAddress, 512,
+                                   kNumPatterns));
+  CHECK(!TactilePatternLibraryInit(&library, &flash, kBaseAddress, kPageSize,
+                                   0));
+  CHECK(!TactilePatternLibraryInit(&library, &flash, kBaseAddress, kPageSize,
+                                   kTactilePatternLibraryMaxPatterns + 1));
+  CHECK(TactilePatternLibraryInit(&library, &flash, kBaseAddress, kPageSize,
+                                  kNumPatterns));
+
+  uint8_t pattern[kTactilePatternLibraryMaxPatternBytes] = {0};
+  CHECK(TactilePatternLibraryWriteChunk(&library, -1, 10, 0, pattern, 10) ==
+        kTactilePatternLibraryErrorInvalidArgs);
+  CHECK(TactilePatternLibraryWriteChunk(
+            &library, kNumPatterns, 10, 0, pattern, 10) ==
+        kTactilePatternLibraryErrorInvalidArgs);
+  CHECK(TactilePatternLibraryWriteChunk(
+            &library, 0, kTactilePatternLibraryMaxPatternBytes, 0, pattern,
+            10) == kTactilePatternLibraryErrorInvalidArgs);
+  CHECK(TactilePatternLibraryWriteChunk(&library, 0, 10, 5, pattern, 10) ==
+        kTactilePatternLibraryErrorInvalidArgs);
+  CHECK(!TactilePatternLibraryDelete(&library, kNumPatterns));
+  CHECK(!TactilePatternLibraryHas(&library, -1));
+  CHECK(TactilePatternLibraryGet(&library, kNumPatterns) == NULL);
+  CHECK(fake.num_erases == 0);
+}
+
+int main(int argc, char** argv) {
+  srand(0);
+  TestUploadAndGet();
+  TestOutOfOrderChunks();
+  TestInterruptedWrite();
+  TestPlayWithCache();
+  TestInvalid();
+
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
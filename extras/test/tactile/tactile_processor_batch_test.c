@@ -0,0 +1,280 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "src/tactile/tactile_processor_batch.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "src/dsp/logging.h"
+#include "src/dsp/math_constants.h"
+
+const int kBlockSize = 64;
+
+/* Generates a test signal for stream `s` with a stream-dependent tone. */
+static void GenerateInput(int s, float sample_rate_hz, float* input,
+                          int num_samples) {
+  const float frequency_hz = 100.0f * (1 << (s % 6));
+  int i;
+  for (i = 0; i < num_samples; ++i) {
+    const float t = i / sample_rate_hz;
+    input[i] = 0.05f * ((float)rand() / RAND_MAX - 0.5f);
+    if (t > 0.1f * (s % 3)) {
+      input[i] += 0.2f * sin(2.0 * M_PI * frequency_hz * t);
+    }
+  }
+}
+
+/* Checks that TactileProcessorBatch matches separate TactileProcessors. */
+static void TestMatchesTactileProcessor(float sample_rate_hz,
+                                        int decimation_factor,
+                                        int num_streams) {
+  printf("TestMatchesTactileProcessor(%g, %d, %d)\n",
+         sample_rate_hz, decimation_factor, num_streams);
+  const int kNumBlocks = 40;
+  const int num_samples = kNumBlocks * kBlockSize;
+  const int output_block_size =
+      kTactileProcessorNumTactors * kBlockSize / decimation_factor;
+
+  TactileProcessorParams params;
+  TactileProcessorSetDefaultParams(&params);
+  params.frontend_params.input_sample_rate_hz = sample_rate_hz;
+  params.frontend_params.block_size = kBlockSize;
+  params.decimation_factor = decimation_factor;
+
+  TactileProcessorBatch* batch =
+      CHECK_NOTNULL(TactileProcessorBatchMake(&params, num_streams));
+  TactileProcessor** processors = (TactileProcessor**)CHECK_NOTNULL(
+      malloc(num_streams * sizeof(TactileProcessor*)));
+  float** inputs = (float**)CHECK_NOTNULL(malloc(num_streams * sizeof(float*)));
+  float** outputs = (float**)CHECK_NOTNULL(
+      malloc(num_streams * sizeof(float*)));
+  const float** input_blocks = (const float**)CHECK_NOTNULL(
+      malloc(num_streams * sizeof(float*)));
+  float* expected = (float*)CHECK_NOTNULL(
+      malloc(output_block_size * sizeof(float)));
+  int s;
+  for (s = 0; s < num_streams; ++s) {
+    processors[s] = CHECK_NOTNULL(TactileProcessorMake(&params));
+    inputs[s] = (float*)CHECK_NOTNULL(malloc(num_samples * sizeof(float)));
+    outputs[s] = (float*)CHECK_NOTNULL(
+        malloc(output_block_size * sizeof(float)));
+    GenerateInput(s, sample_rate_hz, inputs[s], num_samples);
+  }
+
+  int block;
+  for (block = 0; block < kNumBlocks; ++block) {
+    for (s = 0; s < num_streams; ++s) {
+      input_blocks[s] = inputs[s] + block * kBlockSize;
+    }
+    TactileProcessorBatchProcessSamples(batch, input_blocks, outputs);
+
+    for (s = 0; s < num_streams; ++s) {
+      TactileProcessorProcessSamples(processors[s], input_blocks[s], expected);
+      int i;
+      for (i = 0; i < output_block_size; ++i) {
+        CHECK(fabs(outputs[s][i] - expected[i]) <= 1e-6f);
+      }
+    }
+  }
+
+  for (s = 0; s < num_streams; ++s) {
+    free(outputs[s]);
+    free(inputs[s]);
+    TactileProcessorFree(processors[s]);
+  }
+  free(expected);
+  free(input_blocks);
+  free(outputs);
+  free(inputs);
+  free(processors);
+  TactileProcessorBatchFree(batch);
+}
+
+/* Tests that TactileProcessorBatchResetStream resets only one stream. */
+static void TestResetStream(void) {
+  puts("TestResetStream");
+  const int kNumStreams = 3;
+  const int kNumBlocks = 20;
+  const int output_block_size = kTactileProcessorNumTactors * kBlockSize;
+
+  TactileProcessorParams params;
+  TactileProcessorSetDefaultParams(&params);
+  params.frontend_params.block_size = kBlockSize;
+
+  TactileProcessorBatch* batch =
+      CHECK_NOTNULL(TactileProcessorBatchMake(&params, kNumStreams));
+  TactileProcessor* processor = CHECK_NOTNULL(TactileProcessorMake(&params));
+  float* input = (float*)CHECK_NOTNULL(
+      malloc(kNumBlocks * kBlockSize * sizeof(float)));
+  GenerateInput(1, 16000.0f, input, kNumBlocks * kBlockSize);
+  float* outputs[3];
+  const float* input_blocks[3];
+  float* expected = (float*)CHECK_NOTNULL(
+      malloc(output_block_size * sizeof(float)));
+  int s;
+  for (s = 0; s < kNumStreams; ++s) {
+    outputs[s] = (float*)CHECK_NOTNULL(
+        malloc(output_block_size * sizeof(float)));
+  }
+
+  int block;
+  for (block = 0; block < kNumBlocks; ++block) {
+    for (s = 0; s < kNumStreams; ++s) {
+      input_blocks[s] = input + block * kBlockSize;
+    }
+    TactileProcessorBatchProcessSamples(batch, input_blocks, outputs);
+  }
+
+  /* Reset stream 1 and run the same input. Stream 1 should then match a fresh
+   * TactileProcessor, while the other streams continue from their state.
+   */
+  TactileProcessorBatchResetStream(batch, 1);
+  int diff_count = 0;
+  for (block = 0; block < kNumBlocks; ++block) {
+    for (s = 0; s < kNumStreams; ++s) {
+      input_blocks[s] = input + block * kBlockSize;
+    }
+    TactileProcessorBatchProcessSamples(batch, input_blocks, outputs);
+    TactileProcessorProcessSamples(processor, input_blocks[1], expected);
+    int i;
+    for (i = 0; i < output_block_size; ++i) {
+      CHECK(fabs(outputs[1][i] - expected[i]) <= 1e-6f);
+      diff_count += (fabs(outputs[0][i] - expected[i]) > 1e-6f);
+    }
+  }
+  CHECK(diff_count > 0);
+
+  for (s = 0; s < kNumStreams; ++s) {
+    free(outputs[s]);
+  }
+  free(expected);
+  free(input);
+  TactileProcessorFree(processor);
+  TactileProcessorBatchFree(batch);
+}
+
+/* Checks that the Enveloper-only and frontend-only stages match separate
+ * Enveloper and CarlFrontend instances.
+ */
+static void TestStagesMatch(int decimation_factor, int num_streams,
+                            int vectorized_pcen_compression) {
+  printf("TestStagesMatch(%d, %d, %d)\n", decimation_factor, num_streams,
+         vectorized_pcen_compression);
+  const int kNumBlocks = 30;
+  const float kSampleRateHz = 16000.0f;
+  const int num_samples = kNumBlocks * kBlockSize;
+  const int envelope_block_size =
+      kEnveloperNumChannels * kBlockSize / decimation_factor;
+
+  TactileProcessorParams params;
+  TactileProcessorSetDefaultParams(&params);
+  params.frontend_params.input_sample_rate_hz = kSampleRateHz;
+  params.frontend_params.block_size = kBlockSize;
+  params.decimation_factor = decimation_factor;
+  params.frontend_params.vectorized_pcen_compression =
+      vectorized_pcen_compression;
+
+  TactileProcessorBatch* enveloper_batch =
+      CHECK_NOTNULL(TactileProcessorBatchMake(&params, num_streams));
+  TactileProcessorBatch* frontend_batch =
+      CHECK_NOTNULL(TactileProcessorBatchMake(&params, num_streams));
+  const int num_channels =
+      CarlFrontendNumChannels(frontend_batch->processor->frontend);
+  Enveloper* envelopers = (Enveloper*)CHECK_NOTNULL(
+      malloc(num_streams * sizeof(Enveloper)));
+  CarlFrontend** frontends = (CarlFrontend**)CHECK_NOTNULL(
+      malloc(num_streams * sizeof(CarlFrontend*)));
+  float** inputs = (float**)CHECK_NOTNULL(malloc(num_streams * sizeof(float*)));
+  const float** input_blocks = (const float**)CHECK_NOTNULL(
+      malloc(num_streams * sizeof(float*)));
+  float** envelopes = (float**)CHECK_NOTNULL(
+      malloc(num_streams * sizeof(float*)));
+  float** frames = (float**)CHECK_NOTNULL(malloc(num_streams * sizeof(float*)));
+  const int expected_size = (envelope_block_size > num_channels)
+      ? envelope_block_size : num_channels;
+  float* expected = (float*)CHECK_NOTNULL(
+      malloc(expected_size * sizeof(float)));
+  float* scratch = (float*)CHECK_NOTNULL(malloc(kBlockSize * sizeof(float)));
+  int s;
+  for (s = 0; s < num_streams; ++s) {
+    CHECK(EnveloperInit(&envelopers[s], &params.enveloper_params,
+                        kSampleRateHz, decimation_factor));
+    frontends[s] = CHECK_NOTNULL(CarlFrontendMake(&params.frontend_params));
+    inputs[s] = (float*)CHECK_NOTNULL(malloc(num_samples * sizeof(float)));
+    envelopes[s] = (float*)CHECK_NOTNULL(
+        malloc(envelope_block_size * sizeof(float)));
+    frames[s] = (float*)CHECK_NOTNULL(malloc(num_channels * sizeof(float)));
+    GenerateInput(s, kSampleRateHz, inputs[s], num_samples);
+  }
+
+  int block;
+  for (block = 0; block < kNumBlocks; ++block) {
+    for (s = 0; s < num_streams; ++s) {
+      input_blocks[s] = inputs[s] + block * kBlockSize;
+    }
+    TactileProcessorBatchProcessEnveloper(
+        enveloper_batch, input_blocks, envelopes);
+    TactileProcessorBatchProcessFrontend(frontend_batch, input_blocks, frames);
+
+    for (s = 0; s < num_streams; ++s) {
+      EnveloperProcessSamples(&envelopers[s], input_blocks[s], kBlockSize,
+                              expected);
+      int i;
+      for (i = 0; i < envelope_block_size; ++i) {
+        CHECK(fabs(envelopes[s][i] - expected[i]) <= 1e-6f);
+      }
+
+      memcpy(scratch, input_blocks[s], kBlockSize * sizeof(float));
+      CarlFrontendProcessSamples(frontends[s], scratch, expected);
+      for (i = 0; i < num_channels; ++i) {
+        CHECK(fabs(frames[s][i] - expected[i]) <= 1e-5f);
+      }
+    }
+  }
+
+  for (s = 0; s < num_streams; ++s) {
+    free(frames[s]);
+    free(envelopes[s]);
+    free(inputs[s]);
+    CarlFrontendFree(frontends[s]);
+  }
+  free(scratch);
+  free(expected);
+  free(frames);
+  free(envelopes);
+  free(input_blocks);
+  free(inputs);
+  free(frontends);
+  free(envelopers);
+  TactileProcessorBatchFree(frontend_batch);
+  TactileProcessorBatchFree(enveloper_batch);
+}
+
+int main(int argc, char** argv) {
+  srand(0);
+  TestMatchesTactileProcessor(16000.0f, 1, 1);
+  TestMatchesTactileProcessor(16000.0f, 1, 5);
+  TestMatchesTactileProcessor(16000.0f, 2, 8);
+  TestMatchesTactileProcessor(48000.0f, 4, 3);
+  TestResetStream();
+  TestStagesMatch(1, 4, 0);
+  TestStagesMatch(4, 7, 0);
+  TestStagesMatch(4, 7, 1);
+
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
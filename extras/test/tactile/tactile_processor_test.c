@@ -22,6 +22,7 @@
 #include "src/dsp/logging.h"
 #include "src/dsp/math_constants.h"
 #include "src/dsp/read_wav_file.h"
+#include "src/phonetics/classify_phoneme.h"
 
 const int kBlockSize = 64;
 
@@ -204,6 +205,674 @@ static void TestReset(float sample_rate_hz, int decimation_factor) {
   free(input);
 }
 
+/* Loading a checkpoint resumes processing exactly. */
+static void TestCheckpoint(int decimation_factor) {
+  printf("TestCheckpoint(%d)\n", decimation_factor);
+  const float sample_rate_hz = 16000.0f;
+  const int num_tactors = kTactileProcessorNumTactors;
+  const int num_blocks = (int)(1.5f * sample_rate_hz / kBlockSize);
+  const int output_size = num_tactors * kBlockSize / decimation_factor;
+  float* input = (float*)CHECK_NOTNULL(
+      malloc(num_blocks * kBlockSize * sizeof(float)));
+  int i;
+  for (i = 0; i < num_blocks * kBlockSize; ++i) {
+    float t = i / sample_rate_hz;
+    input[i] = 0.05f * ((float) rand() / RAND_MAX - 0.5f)
+        + 0.3f * sin(2.0 * M_PI * 300.0 * t) * (fmod(t, 0.5) < 0.1);
+  }
+
+  TactileProcessorParams params;
+  TactileProcessorSetDefaultParams(&params);
+  params.frontend_params.input_sample_rate_hz = sample_rate_hz;
+  params.frontend_params.block_size = kBlockSize;
+  params.decimation_factor = decimation_factor;
+  params.enable_silence_gating = 1;
+  params.silence_hold_s = 0.05f;
+  TactileProcessor* running = CHECK_NOTNULL(TactileProcessorMake(&params));
+  TactileProcessor* restored = CHECK_NOTNULL(TactileProcessorMake(&params));
+  const size_t checkpoint_bytes = TactileProcessorCheckpointBytes(running);
+  CHECK(checkpoint_bytes == TactileProcessorCheckpointBytes(restored));
+  void* checkpoint = CHECK_NOTNULL(malloc(checkpoint_bytes));
+  float* output_running = (float*)CHECK_NOTNULL(
+      malloc(output_size * sizeof(float)));
+  float* output_restored = (float*)CHECK_NOTNULL(
+      malloc(output_size * sizeof(float)));
+
+  /* Run `running` for 1 s and `restored` on different input, then save a
+   * checkpoint of `running` and load it into `restored`.
+   */
+  const int checkpoint_at = (int)(sample_rate_hz / kBlockSize);
+  int b;
+  for (b = 0; b < checkpoint_at; ++b) {
+    TactileProcessorProcessSamples(running, input + kBlockSize * b,
+                                   output_running);
+    TactileProcessorProcessSamples(restored,
+                                   input + kBlockSize * (num_blocks - 1 - b),
+                                   output_restored);
+  }
+  TactileProcessorSaveCheckpoint(running, checkpoint);
+  CHECK(TactileProcessorLoadCheckpoint(restored, checkpoint));
+  CHECK(restored->frontend != running->frontend);
+
+  /* Output matches exactly from there on. */
+  for (; b < num_blocks; ++b) {
+    TactileProcessorProcessSamples(running, input + kBlockSize * b,
+                                   output_running);
+    TactileProcessorProcessSamples(restored, input + kBlockSize * b,
+                                   output_restored);
+    CHECK(!memcmp(output_restored, output_running,
+                  output_size * sizeof(float)));
+  }
+
+  /* A checkpoint for a different configuration is rejected. */
+  params.decimation_factor = 2 * decimation_factor;
+  TactileProcessor* other = CHECK_NOTNULL(TactileProcessorMake(&params));
+  CHECK(!TactileProcessorLoadCheckpoint(other, checkpoint));
+
+  TactileProcessorFree(other);
+  free(output_restored);
+  free(output_running);
+  free(checkpoint);
+  TactileProcessorFree(restored);
+  TactileProcessorFree(running);
+  free(input);
+}
+
+/* Restoring warm state from a running processor skips warm up and resumes with
+ * output close to the processor it came from.
+ */
+static void TestWarmState(int decimation_factor) {
+  printf("TestWarmState(%d)\n", decimation_factor);
+  const float sample_rate_hz = 16000.0f;
+  const int num_tactors = kTactileProcessorNumTactors;
+  const int input_size = (int)(2.5f * sample_rate_hz);
+  const int output_block_size = kBlockSize / decimation_factor;
+  float* input = (float*)CHECK_NOTNULL(malloc(input_size * sizeof(float)));
+  int i;
+  for (i = 0; i < input_size; ++i) {
+    float t = i / sample_rate_hz;
+    input[i] = 0.05f * ((float) rand() / RAND_MAX - 0.5f)
+        + 0.3f * sin(2.0 * M_PI * 300.0 * t) * (fmod(t, 0.5) < 0.1);
+  }
+
+  TactileProcessorParams params;
+  TactileProcessorSetDefaultParams(&params);
+  params.frontend_params.input_sample_rate_hz = sample_rate_hz;
+  params.frontend_params.block_size = kBlockSize;
+  params.decimation_factor = decimation_factor;
+  TactileProcessor* running = CHECK_NOTNULL(TactileProcessorMake(&params));
+  TactileProcessor* restored = CHECK_NOTNULL(TactileProcessorMake(&params));
+  TactileProcessor* fresh = CHECK_NOTNULL(TactileProcessorMake(&params));
+  const int warm_state_size = TactileProcessorWarmStateSize(running);
+  CHECK(warm_state_size ==
+        kEnveloperWarmStateSize + CarlFrontendNumChannels(running->frontend));
+  float* warm_state = (float*)CHECK_NOTNULL(
+      malloc(warm_state_size * sizeof(float)));
+  float* warm_state2 = (float*)CHECK_NOTNULL(
+      malloc(warm_state_size * sizeof(float)));
+  float* output_running = (float*)CHECK_NOTNULL(
+      malloc(num_tactors * output_block_size * sizeof(float)));
+  float* output_restored = (float*)CHECK_NOTNULL(
+      malloc(num_tactors * output_block_size * sizeof(float)));
+  float* output_fresh = (float*)CHECK_NOTNULL(
+      malloc(num_tactors * output_block_size * sizeof(float)));
+
+  /* Run for 2 s, then snapshot and restore. */
+  const int restore_at = (int)(2.0f * sample_rate_hz / kBlockSize) * kBlockSize;
+  int start;
+  for (start = 0; start < restore_at; start += kBlockSize) {
+    TactileProcessorProcessSamples(running, input + start, output_running);
+  }
+  TactileProcessorGetWarmState(running, warm_state);
+  CHECK(TactileProcessorSetWarmState(restored, warm_state));
+  CHECK(restored->enveloper.warm_up_counter == 0);
+  TactileProcessorGetWarmState(restored, warm_state2);
+  for (i = 0; i < warm_state_size; ++i) {
+    CHECK(warm_state2[i] == warm_state[i]);
+  }
+
+  /* Over the next 0.5 s, the restored processor's output is much closer than
+   * a fresh processor's to the output of the running processor.
+   */
+  double diff_restored = 0.0;
+  double diff_fresh = 0.0;
+  for (; start + kBlockSize <= input_size; start += kBlockSize) {
+    TactileProcessorProcessSamples(running, input + start, output_running);
+    TactileProcessorProcessSamples(restored, input + start, output_restored);
+    TactileProcessorProcessSamples(fresh, input + start, output_fresh);
+    for (i = 0; i < num_tactors * output_block_size; ++i) {
+      diff_restored += fabs(output_restored[i] - output_running[i]);
+      diff_fresh += fabs(output_fresh[i] - output_running[i]);
+    }
+  }
+  CHECK(diff_restored < 0.05 * diff_fresh);
+
+  /* Invalid warm state is rejected. */
+  warm_state[1] = -1.0f;
+  CHECK(!TactileProcessorSetWarmState(restored, warm_state));
+  CHECK(restored->enveloper.warm_up_counter ==
+        restored->enveloper.num_warm_up_samples);
+  warm_state[1] = 0.0f;
+  warm_state[warm_state_size - 1] = (float)HUGE_VAL;
+  CHECK(!TactileProcessorSetWarmState(restored, warm_state));
+
+  free(output_fresh);
+  free(output_restored);
+  free(output_running);
+  free(warm_state2);
+  free(warm_state);
+  TactileProcessorFree(fresh);
+  TactileProcessorFree(restored);
+  TactileProcessorFree(running);
+  free(input);
+}
+
+/* Checks that TactileProcessorProcessSamplesPlanar() produces the same output
+ * as TactileProcessorProcessSamples(), in planar layout.
+ */
+static void TestPlanarOutput(float sample_rate_hz, int decimation_factor) {
+  printf("TestPlanarOutput(%g, %d)\n", sample_rate_hz, decimation_factor);
+  const int num_tactors = kTactileProcessorNumTactors;
+  const int num_blocks = 50;
+  const int output_block_size = kBlockSize / decimation_factor;
+  float* input = (float*)CHECK_NOTNULL(
+      malloc(kBlockSize * num_blocks * sizeof(float)));
+  float* scratch = (float*)CHECK_NOTNULL(malloc(kBlockSize * sizeof(float)));
+  float* interleaved = (float*)CHECK_NOTNULL(
+      malloc(num_tactors * output_block_size * sizeof(float)));
+  float* planar = (float*)CHECK_NOTNULL(
+      malloc(num_tactors * output_block_size * sizeof(float)));
+  float* outputs[10];
+  int c;
+  for (c = 0; c < num_tactors; ++c) {
+    outputs[c] = planar + c * output_block_size;
+  }
+  int i;
+  for (i = 0; i < kBlockSize * num_blocks; ++i) {
+    float t = i / sample_rate_hz;
+    input[i] = 0.2 * ((float) rand() / RAND_MAX - 0.5f)
+        + 0.2 * sin(2.0 * M_PI * 700.0 * t) * Taper(t, 0.05f, 0.15f);
+  }
+
+  TactileProcessorParams params;
+  TactileProcessorSetDefaultParams(&params);
+  params.frontend_params.input_sample_rate_hz = sample_rate_hz;
+  params.frontend_params.block_size = kBlockSize;
+  params.decimation_factor = decimation_factor;
+  TactileProcessor* processor1 = CHECK_NOTNULL(TactileProcessorMake(&params));
+  TactileProcessor* processor2 = CHECK_NOTNULL(TactileProcessorMake(&params));
+
+  int b;
+  for (b = 0; b < num_blocks; ++b) {
+    const float* input_block = input + kBlockSize * b;
+    TactileProcessorProcessSamples(processor1, input_block, interleaved);
+    /* The planar function overwrites its input, so pass it a copy. */
+    memcpy(scratch, input_block, kBlockSize * sizeof(float));
+    TactileProcessorProcessSamplesPlanar(processor2, scratch, outputs);
+
+    for (i = 0; i < output_block_size; ++i) {
+      for (c = 0; c < num_tactors; ++c) {
+        CHECK(interleaved[c + num_tactors * i] == outputs[c][i]);
+      }
+    }
+  }
+
+  TactileProcessorFree(processor2);
+  TactileProcessorFree(processor1);
+  free(planar);
+  free(interleaved);
+  free(scratch);
+  free(input);
+}
+
+/* TactileProcessorProcessSamplesDualMic() with both microphones equal matches
+ * TactileProcessorProcessSamples().
+ */
+static void TestDualMic(int decimation_factor) {
+  printf("TestDualMic(%d)\n", decimation_factor);
+  const float sample_rate_hz = 16000.0f;
+  const int num_tactors = kTactileProcessorNumTactors;
+  const int num_blocks = 50;
+  const int output_size = num_tactors * kBlockSize / decimation_factor;
+  float* input = (float*)CHECK_NOTNULL(
+      malloc(kBlockSize * num_blocks * sizeof(float)));
+  float* expected = (float*)CHECK_NOTNULL(malloc(output_size * sizeof(float)));
+  float* actual = (float*)CHECK_NOTNULL(malloc(output_size * sizeof(float)));
+  int i;
+  for (i = 0; i < kBlockSize * num_blocks; ++i) {
+    float t = i / sample_rate_hz;
+    input[i] = 0.2 * ((float) rand() / RAND_MAX - 0.5f)
+        + 0.2 * sin(2.0 * M_PI * 700.0 * t) * Taper(t, 0.05f, 0.15f);
+  }
+
+  TactileProcessorParams params;
+  TactileProcessorSetDefaultParams(&params);
+  params.frontend_params.input_sample_rate_hz = sample_rate_hz;
+  params.frontend_params.block_size = kBlockSize;
+  params.decimation_factor = decimation_factor;
+  TactileProcessor* processor1 = CHECK_NOTNULL(TactileProcessorMake(&params));
+  TactileProcessor* processor2 = CHECK_NOTNULL(TactileProcessorMake(&params));
+
+  int b;
+  for (b = 0; b < num_blocks; ++b) {
+    const float* input_block = input + kBlockSize * b;
+    TactileProcessorProcessSamples(processor1, input_block, expected);
+    TactileProcessorProcessSamplesDualMic(processor2, input_block, input_block,
+                                          actual);
+
+    for (i = 0; i < output_size; ++i) {
+      CHECK(actual[i] == expected[i]);
+    }
+  }
+
+  TactileProcessorFree(processor2);
+  TactileProcessorFree(processor1);
+  free(actual);
+  free(expected);
+  free(input);
+}
+
+/* Tests silence gating, comparing with processing with gating disabled. */
+static void TestSilenceGating(int decimation_factor) {
+  printf("TestSilenceGating(%d)\n", decimation_factor);
+  const float sample_rate_hz = 16000.0f;
+  const int num_tactors = kTactileProcessorNumTactors;
+  const int output_block_size = kBlockSize / decimation_factor;
+  const int num_blocks = (int)(2.5f * sample_rate_hz) / kBlockSize;
+  const int input_size = kBlockSize * num_blocks;
+  const int output_size = num_tactors * output_block_size * num_blocks;
+  float* input = (float*)CHECK_NOTNULL(malloc(input_size * sizeof(float)));
+  float* expected = (float*)CHECK_NOTNULL(malloc(output_size * sizeof(float)));
+  float* actual = (float*)CHECK_NOTNULL(malloc(output_size * sizeof(float)));
+  int i;
+  for (i = 0; i < input_size; ++i) {
+    float t = i / sample_rate_hz;
+    input[i] = 1e-5f * ((float) rand() / RAND_MAX - 0.5f);
+    /* From 1 < t < 1.3, add a 1500 Hz tone. */
+    input[i] += 0.2 * sin(2.0 * M_PI * 1500.0 * t) * Taper(t, 1.0f, 1.3f);
+  }
+
+  TactileProcessorParams params;
+  TactileProcessorSetDefaultParams(&params);
+  params.frontend_params.input_sample_rate_hz = sample_rate_hz;
+  params.frontend_params.block_size = kBlockSize;
+  params.decimation_factor = decimation_factor;
+  TactileProcessor* ungated = CHECK_NOTNULL(TactileProcessorMake(&params));
+  params.enable_silence_gating = 1;
+  TactileProcessor* gated = CHECK_NOTNULL(TactileProcessorMake(&params));
+
+  int num_silent_blocks = 0;
+  int b;
+  for (b = 0; b < num_blocks; ++b) {
+    const float t = (float)(kBlockSize * b) / sample_rate_hz;
+    const int offset = num_tactors * output_block_size * b;
+    TactileProcessorProcessSamples(ungated, input + kBlockSize * b,
+                                   expected + offset);
+    TactileProcessorProcessSamples(gated, input + kBlockSize * b,
+                                   actual + offset);
+
+    if (t < 0.8f) {
+      /* Enveloper warm up and hold time have passed by t = 0.8. */
+      if (t > 0.7f) { CHECK(gated->is_silent); }
+    } else if (t > 1.05f && t < 1.3f) { /* Active during the tone. */
+      CHECK(!gated->is_silent);
+    } else if (t > 2.3f) { /* Silent again after the tone. */
+      CHECK(gated->is_silent);
+    }
+
+    if (gated->is_silent) {
+      ++num_silent_blocks;
+      for (i = 0; i < num_tactors * output_block_size; ++i) {
+        /* Output is exact zeros, and close to the ungated output. */
+        CHECK(actual[offset + i] == 0.0f);
+        CHECK(fabs(expected[offset + i]) < params.silence_threshold);
+      }
+    } else {
+      for (i = 0; i < output_block_size; ++i) {
+        /* Output channels that don't depend on the frontend match exactly. */
+        const int j = offset + num_tactors * i;
+        CHECK(actual[j] == expected[j]);
+        CHECK(actual[j + 8] == expected[j + 8]);
+        CHECK(actual[j + 9] == expected[j + 9]);
+      }
+    }
+  }
+  CHECK(num_silent_blocks > num_blocks / 2);
+
+  /* During the tone, the vowel cluster output is close to ungated, since the
+   * frontend has been warm started.
+   */
+  const float output_rate = sample_rate_hz / decimation_factor;
+  const float expected_vowel_max =
+      ComputeVowelMax(expected, 1.05f, 1.25f, output_rate);
+  const float actual_vowel_max =
+      ComputeVowelMax(actual, 1.05f, 1.25f, output_rate);
+  CHECK(expected_vowel_max > 0.2f);
+  CHECK(fabs(actual_vowel_max - expected_vowel_max) <
+        0.05f * expected_vowel_max);
+
+  /* After reset, processing is no longer silent. */
+  TactileProcessorReset(gated);
+  CHECK(!gated->is_silent);
+
+  TactileProcessorFree(gated);
+  TactileProcessorFree(ungated);
+  free(actual);
+  free(expected);
+  free(input);
+}
+
+/* TactileProcessorInitInBuffer() gives the same output as
+ * TactileProcessorMake().
+ */
+static void TestInitInBuffer(int enable_silence_gating) {
+  printf("TestInitInBuffer(%d)\n", enable_silence_gating);
+  const int num_tactors = kTactileProcessorNumTactors;
+  const int decimation_factor = 8;
+  const int output_block_size = kBlockSize / decimation_factor;
+  const int num_blocks = 100;
+  float* input = (float*)CHECK_NOTNULL(
+      malloc(kBlockSize * num_blocks * sizeof(float)));
+  float* expected = (float*)CHECK_NOTNULL(
+      malloc(num_tactors * output_block_size * sizeof(float)));
+  float* actual = (float*)CHECK_NOTNULL(
+      malloc(num_tactors * output_block_size * sizeof(float)));
+  int i;
+  for (i = 0; i < kBlockSize * num_blocks; ++i) {
+    float t = i / 16000.0f;
+    input[i] = 0.2 * ((float) rand() / RAND_MAX - 0.5f)
+        + 0.2 * sin(2.0 * M_PI * 700.0 * t) * Taper(t, 0.05f, 0.25f);
+  }
+
+  TactileProcessorParams params;
+  TactileProcessorSetDefaultParams(&params);
+  params.frontend_params.block_size = kBlockSize;
+  params.decimation_factor = decimation_factor;
+  params.enable_silence_gating = enable_silence_gating;
+  const size_t required_bytes = TactileProcessorRequiredBytes(&params);
+  CHECK(required_bytes > 0);
+  /* Use an offset to test an unaligned buffer. */
+  char* storage = (char*)CHECK_NOTNULL(malloc(required_bytes + 5));
+  char* buffer = storage + 5;
+  /* Too small buffer fails. */
+  CHECK(TactileProcessorInitInBuffer(buffer, required_bytes - 64, &params)
+        == NULL);
+
+  TactileProcessor* processor1 = CHECK_NOTNULL(TactileProcessorMake(&params));
+  TactileProcessor* processor2 = CHECK_NOTNULL(
+      TactileProcessorInitInBuffer(buffer, required_bytes, &params));
+  /* Everything is laid out in the buffer. */
+  char* buffer_end = buffer + required_bytes;
+  CHECK(buffer <= (char*)processor2 && (char*)processor2 < buffer_end);
+  CHECK(buffer <= (char*)processor2->frontend &&
+        (char*)processor2->frontend < buffer_end);
+  CHECK(buffer <= (char*)processor2->workspace &&
+        (char*)processor2->workspace < buffer_end);
+  CHECK(buffer <= (char*)processor2->frame_bus.frames &&
+        (char*)processor2->frame_bus.frames < buffer_end);
+
+  int b;
+  for (b = 0; b < num_blocks; ++b) {
+    const float* input_block = input + kBlockSize * b;
+    TactileProcessorProcessSamples(processor1, input_block, expected);
+    TactileProcessorProcessSamples(processor2, input_block, actual);
+    for (i = 0; i < num_tactors * output_block_size; ++i) {
+      CHECK(actual[i] == expected[i]);
+    }
+  }
+
+  TactileProcessorFree(processor2);  /* Doesn't free the caller's buffer. */
+  TactileProcessorFree(processor1);
+  free(storage);
+  free(actual);
+  free(expected);
+  free(input);
+}
+
+/* TactileProcessorPushSamples() on buffers of random sizes gives the same
+ * output as TactileProcessorProcessSamples() on blocks.
+ */
+static void TestPushSamples(int decimation_factor) {
+  printf("TestPushSamples(%d)\n", decimation_factor);
+  const int num_tactors = kTactileProcessorNumTactors;
+  const int output_block_size = kBlockSize / decimation_factor;
+  const int num_blocks = 60;
+  const int num_frames = kBlockSize * num_blocks + 17;
+  const int num_output_frames = output_block_size * num_blocks;
+  float* input = (float*)CHECK_NOTNULL(malloc(num_frames * sizeof(float)));
+  int i;
+  for (i = 0; i < num_frames; ++i) {
+    float t = i / 16000.0f;
+    input[i] = 0.05 * ((float) rand() / RAND_MAX - 0.5f)
+        + 0.2 * sin(2.0 * M_PI * 700.0 * t) * Taper(t, 0.05f, 0.2f);
+  }
+
+  TactileProcessorParams params;
+  TactileProcessorSetDefaultParams(&params);
+  params.frontend_params.block_size = kBlockSize;
+  params.decimation_factor = decimation_factor;
+  TactileProcessor* reference = CHECK_NOTNULL(TactileProcessorMake(&params));
+  TactileProcessor* processor = CHECK_NOTNULL(TactileProcessorMake(&params));
+
+  float* expected = (float*)CHECK_NOTNULL(
+      malloc(num_tactors * num_output_frames * sizeof(float)));
+  int b;
+  for (b = 0; b < num_blocks; ++b) {
+    TactileProcessorProcessSamples(
+        reference, input + kBlockSize * b,
+        expected + num_tactors * output_block_size * b);
+  }
+
+  float* actual = (float*)CHECK_NOTNULL(
+      malloc(num_tactors * num_output_frames * sizeof(float)));
+  int num_actual = 0;
+  int start;
+  for (start = 0; start < num_frames;) {
+    /* Mix sizes smaller and larger than a block, like audio callbacks. */
+    int size = rand() % (3 * kBlockSize);
+    if (size > num_frames - start) { size = num_frames - start; }
+    const int expected_size =
+        TactileProcessorNextNumPushOutputFrames(processor, size);
+    CHECK(num_actual + expected_size <= num_output_frames);
+    const int size_out = TactileProcessorPushSamples(
+        processor, input + start, size, actual + num_tactors * num_actual);
+    CHECK(size_out == expected_size);
+    num_actual += size_out;
+    start += size;
+  }
+  CHECK(num_actual == num_output_frames);
+  CHECK(processor->block_fill == 17);
+
+  for (i = 0; i < num_tactors * num_output_frames; ++i) {
+    CHECK(actual[i] == expected[i]);
+  }
+
+  /* Reset discards the staged frames. */
+  TactileProcessorReset(processor);
+  CHECK(TactileProcessorNextNumPushOutputFrames(
+            processor, kBlockSize - 1) == 0);
+  CHECK(TactileProcessorNextNumPushOutputFrames(processor, kBlockSize) ==
+        output_block_size);
+
+  TactileProcessorFree(processor);
+  TactileProcessorFree(reference);
+  free(actual);
+  free(expected);
+  free(input);
+}
+
+/* Consumers subscribed to the frame bus get the same frames as a separate
+ * CarlFrontend, so that e.g. a streaming phoneme classifier can share the
+ * processor's frontend.
+ */
+static void TestFrameBus(void) {
+  puts("TestFrameBus");
+  const int num_blocks = 40;
+  const int num_frames = kBlockSize * num_blocks;
+  float* input = (float*)CHECK_NOTNULL(malloc(num_frames * sizeof(float)));
+  int i;
+  for (i = 0; i < num_frames; ++i) {
+    float t = i / 16000.0f;
+    input[i] = 0.05 * ((float) rand() / RAND_MAX - 0.5f)
+        + 0.2 * sin(2.0 * M_PI * 700.0 * t) * Taper(t, 0.05f, 0.2f);
+  }
+
+  TactileProcessorParams params;
+  TactileProcessorSetDefaultParams(&params);
+  params.frontend_params.block_size = kBlockSize;
+  TactileProcessor* processor = CHECK_NOTNULL(TactileProcessorMake(&params));
+  CarlFrontend* frontend =
+      CHECK_NOTNULL(CarlFrontendMake(&params.frontend_params));
+  const int frame_size = CarlFrontendNumChannels(frontend);
+  CHECK(processor->frame_bus.frame_size == frame_size);
+  CHECK(frame_size == kClassifyPhonemeNumChannels);
+  CHECK(FrameBusLatest(&processor->frame_bus) == NULL);
+
+  FrameBusReader reader;
+  FrameBusSubscribe(&processor->frame_bus, &reader);
+  /* A second consumer that reads only every 10 blocks. */
+  FrameBusReader slow_reader;
+  FrameBusSubscribe(&processor->frame_bus, &slow_reader);
+  ClassifyPhonemeStreamer streamer;
+  ClassifyPhonemeStreamerReset(&streamer);
+  ClassifyPhonemeStreamer expected_streamer;
+  ClassifyPhonemeStreamerReset(&expected_streamer);
+
+  float* block = (float*)CHECK_NOTNULL(malloc(kBlockSize * sizeof(float)));
+  float* output = (float*)CHECK_NOTNULL(malloc(
+      kTactileProcessorNumTactors * kBlockSize * sizeof(float)));
+  float* expected_frame =
+      (float*)CHECK_NOTNULL(malloc(frame_size * sizeof(float)));
+  int b;
+  for (b = 0; b < num_blocks; ++b) {
+    TactileProcessorProcessSamples(processor, input + kBlockSize * b, output);
+    memcpy(block, input + kBlockSize * b, kBlockSize * sizeof(float));
+    CarlFrontendProcessSamples(frontend, block, expected_frame);
+
+    /* One frame is published per block. */
+    const float* frame = FrameBusRead(&processor->frame_bus, &reader);
+    CHECK(frame != NULL);
+    CHECK(frame == FrameBusLatest(&processor->frame_bus));
+    CHECK(FrameBusRead(&processor->frame_bus, &reader) == NULL);
+    CHECK(memcmp(frame, expected_frame, frame_size * sizeof(float)) == 0);
+
+    ClassifyPhonemeLabels labels;
+    ClassifyPhonemeLabels expected_labels;
+    ClassifyPhonemeStreamerProcessFrame(&streamer, frame, &labels, NULL);
+    ClassifyPhonemeStreamerProcessFrame(&expected_streamer, expected_frame,
+                                        &expected_labels, NULL);
+    CHECK(labels.phoneme == expected_labels.phoneme);
+
+    if (b % 10 == 9) {
+      /* The slow reader gets the most recent frames, and older frames are
+       * counted as dropped.
+       */
+      int num_read = 0;
+      while ((frame = FrameBusRead(&processor->frame_bus, &slow_reader))) {
+        ++num_read;
+      }
+      CHECK(num_read == kFrameBusNumSlots - 1);
+      CHECK(frame == NULL);
+      CHECK(slow_reader.num_dropped == (uint32_t)(
+            (b / 10 + 1) * (10 - (kFrameBusNumSlots - 1))));
+    }
+  }
+  CHECK(reader.num_dropped == 0);
+
+  free(expected_frame);
+  free(output);
+  free(block);
+  CarlFrontendFree(frontend);
+  TactileProcessorFree(processor);
+  free(input);
+}
+
+/* Compares TactileProcessorProcessCapture() with running a separate QResampler
+ * and passing blocks of its output to TactileProcessorProcessSamples().
+ */
+static void TestCapture(float capture_sample_rate_hz, int decimation_factor) {
+  printf("TestCapture(%g, %d)\n", capture_sample_rate_hz, decimation_factor);
+  const int num_tactors = kTactileProcessorNumTactors;
+  const float sample_rate_hz = 16000.0f;
+  const int output_block_size = kBlockSize / decimation_factor;
+  const int num_input_frames = (int)(0.3f * capture_sample_rate_hz);
+  float* input = (float*)CHECK_NOTNULL(
+      malloc(num_input_frames * sizeof(float)));
+  int i;
+  for (i = 0; i < num_input_frames; ++i) {
+    float t = i / capture_sample_rate_hz;
+    input[i] = 0.05 * ((float) rand() / RAND_MAX - 0.5f)
+        + 0.2 * sin(2.0 * M_PI * 700.0 * t) * Taper(t, 0.05f, 0.25f);
+  }
+
+  TactileProcessorParams params;
+  TactileProcessorSetDefaultParams(&params);
+  params.frontend_params.input_sample_rate_hz = sample_rate_hz;
+  params.frontend_params.block_size = kBlockSize;
+  params.decimation_factor = decimation_factor;
+  TactileProcessor* reference = CHECK_NOTNULL(TactileProcessorMake(&params));
+  params.capture_sample_rate_hz = capture_sample_rate_hz;
+  TactileProcessor* processor = CHECK_NOTNULL(TactileProcessorMake(&params));
+  /* Capture is disabled without a capture rate. */
+  CHECK(TactileProcessorProcessCapture(reference, input, 100, NULL) == 0);
+
+  MemoryUsage usage;
+  TactileProcessorMemoryUsage(processor, &usage);
+  CHECK(usage.heap_bytes == TactileProcessorRequiredBytes(&params));
+
+  /* Resample all input, then run the reference processor on whole blocks. */
+  QResampler* resampler = CHECK_NOTNULL(QResamplerMake(
+      capture_sample_rate_hz, sample_rate_hz, 1, num_input_frames, NULL));
+  const int num_resampled =
+      QResamplerProcessSamples(resampler, input, num_input_frames);
+  const int num_blocks = num_resampled / kBlockSize;
+  const int num_output_frames = num_blocks * output_block_size;
+  float* expected = (float*)CHECK_NOTNULL(
+      malloc(num_tactors * num_output_frames * sizeof(float)));
+  int b;
+  for (b = 0; b < num_blocks; ++b) {
+    TactileProcessorProcessSamples(
+        reference, QResamplerOutput(resampler) + kBlockSize * b,
+        expected + num_tactors * output_block_size * b);
+  }
+
+  /* Capture buffers of random sizes. */
+  float* actual = (float*)CHECK_NOTNULL(
+      malloc(num_tactors * (num_output_frames + output_block_size) *
+             sizeof(float)));
+  int num_actual = 0;
+  int start;
+  for (start = 0; start < num_input_frames;) {
+    int size = rand() % 300;
+    if (size > num_input_frames - start) { size = num_input_frames - start; }
+    const int expected_size =
+        TactileProcessorNextNumCaptureOutputFrames(processor, size);
+    CHECK(num_actual + expected_size <= num_output_frames);
+    const int size_out = TactileProcessorProcessCapture(
+        processor, input + start, size, actual + num_tactors * num_actual);
+    CHECK(size_out == expected_size);
+    CHECK(size_out % output_block_size == 0);
+    num_actual += size_out;
+    start += size;
+  }
+  CHECK(num_actual == num_output_frames);
+
+  /* The resampled blocks differ only by rounding from resampling in chunks,
+   * which the Enveloper's compression and the vowel network amplify slightly.
+   * A vowel tactor with near-zero hex weight may also be zero in one only.
+   */
+  for (i = 0; i < num_tactors * num_output_frames; ++i) {
+    CHECK(fabs(actual[i] - expected[i]) <= 2e-4f + 0.02f * fabs(expected[i]));
+  }
+
+  QResamplerFree(resampler);
+  TactileProcessorFree(processor);
+  TactileProcessorFree(reference);
+  free(actual);
+  free(expected);
+  free(input);
+}
+
 /* Runs TactileProcessor on a short WAV recording of a pure phone, and
  * checks that the intended tactor is the most active.
  */
@@ -271,6 +940,344 @@ static void TestPhone(const char* phone, int intended_tactor) {
   free(input_int16);
 }
 
+/* With vowel_embedding_stride > 1, channels not depending on the frontend are
+ * unchanged, and the vowel cluster output is close to evaluating the embedding
+ * every block.
+ */
+static void TestVowelEmbeddingStride(int stride) {
+  printf("TestVowelEmbeddingStride(%d)\n", stride);
+  const float sample_rate_hz = 16000.0f;
+  const int block_size = 16;
+  const int num_tactors = kTactileProcessorNumTactors;
+  const int num_blocks = (int)(0.5f * sample_rate_hz) / block_size;
+  const int input_size = block_size * num_blocks;
+  const int output_size = num_tactors * input_size;
+  float* input = (float*)CHECK_NOTNULL(malloc(input_size * sizeof(float)));
+  float* expected = (float*)CHECK_NOTNULL(malloc(output_size * sizeof(float)));
+  float* actual = (float*)CHECK_NOTNULL(malloc(output_size * sizeof(float)));
+  int i;
+  for (i = 0; i < input_size; ++i) {
+    float t = i / sample_rate_hz;
+    input[i] = 1e-5f * ((float) rand() / RAND_MAX - 0.5f);
+    input[i] += 0.2 * sin(2.0 * M_PI * 1500.0 * t) * Taper(t, 0.05f, 0.45f);
+    input[i] += 0.2 * sin(2.0 * M_PI * 800.0 * t) * Taper(t, 0.25f, 0.45f);
+  }
+
+  TactileProcessorParams params;
+  TactileProcessorSetDefaultParams(&params);
+  params.frontend_params.input_sample_rate_hz = sample_rate_hz;
+  params.frontend_params.block_size = block_size;
+  TactileProcessor* every_block = CHECK_NOTNULL(TactileProcessorMake(&params));
+  params.vowel_embedding_stride = stride;
+  TactileProcessor* strided = CHECK_NOTNULL(TactileProcessorMake(&params));
+  int b;
+  for (b = 0; b < num_blocks; ++b) {
+    const int offset = num_tactors * block_size * b;
+    TactileProcessorProcessSamples(every_block, input + block_size * b,
+                                   expected + offset);
+    TactileProcessorProcessSamples(strided, input + block_size * b,
+                                   actual + offset);
+  }
+
+  float expected_energy = 0.0f;
+  float actual_energy = 0.0f;
+  for (i = 0; i < output_size; ++i) {
+    const int c = i % num_tactors;
+    if (c == 0 || c >= 8) {
+      CHECK(actual[i] == expected[i]);
+    } else {
+      expected_energy += expected[i] * expected[i];
+      actual_energy += actual[i] * actual[i];
+    }
+  }
+  CHECK(expected_energy > 1.0f);
+  CHECK(fabs(actual_energy - expected_energy) < 0.1f * expected_energy);
+
+  params.vowel_embedding_stride = 0;
+  CHECK(TactileProcessorMake(&params) == NULL);
+
+  TactileProcessorFree(strided);
+  TactileProcessorFree(every_block);
+  free(actual);
+  free(expected);
+  free(input);
+}
+
+/* Runs each quality level on a sequence of tones. Channels not depending on
+ * the frontend are the same at all levels, and the vowel cluster degrades
+ * gracefully: at half rate, the vowel cluster energy is about the same as at
+ * full quality and spread over the cluster, and with envelope only, the vowel
+ * energy is on the center tactor.
+ */
+static void TestQualityLevels(int decimation_factor) {
+  printf("TestQualityLevels(%d)\n", decimation_factor);
+  const float sample_rate_hz = 16000.0f;
+  const int num_tactors = kTactileProcessorNumTactors;
+  const int output_block_size = kBlockSize / decimation_factor;
+  const int num_blocks = (int)(0.5f * sample_rate_hz) / kBlockSize;
+  const int input_size = kBlockSize * num_blocks;
+  const int output_size = num_tactors * output_block_size * num_blocks;
+  float* input = (float*)CHECK_NOTNULL(malloc(input_size * sizeof(float)));
+  float* outputs[3];
+  int i;
+  for (i = 0; i < input_size; ++i) {
+    float t = i / sample_rate_hz;
+    input[i] = 1e-5f * ((float) rand() / RAND_MAX - 0.5f);
+    /* From 0.05 < t < 0.45, add a 1500 Hz tone, and for t > 0.25, an 800 Hz
+     * tone, to move the vowel coordinate.
+     */
+    input[i] += 0.2 * sin(2.0 * M_PI * 1500.0 * t) * Taper(t, 0.05f, 0.45f);
+    input[i] += 0.2 * sin(2.0 * M_PI * 800.0 * t) * Taper(t, 0.25f, 0.45f);
+  }
+
+  TactileProcessorParams params;
+  TactileProcessorSetDefaultParams(&params);
+  params.frontend_params.input_sample_rate_hz = sample_rate_hz;
+  params.frontend_params.block_size = kBlockSize;
+  params.decimation_factor = decimation_factor;
+  int quality;
+  for (quality = 0; quality < 3; ++quality) {
+    outputs[quality] =
+        (float*)CHECK_NOTNULL(malloc(output_size * sizeof(float)));
+    TactileProcessor* processor = CHECK_NOTNULL(TactileProcessorMake(&params));
+    TactileProcessorSetQuality(processor, quality);
+    CHECK(processor->quality == quality);
+    int b;
+    for (b = 0; b < num_blocks; ++b) {
+      TactileProcessorProcessSamples(
+          processor, input + kBlockSize * b,
+          outputs[quality] + num_tactors * output_block_size * b);
+    }
+    TactileProcessorFree(processor);
+  }
+
+  float energy[3][10];
+  float vowel_energy[3];
+  int max_tactor[3];
+  for (quality = 0; quality < 3; ++quality) {
+    int c;
+    for (c = 0; c < num_tactors; ++c) {
+      energy[quality][c] = 0.0f;
+    }
+    for (i = 0; i < output_size; ++i) {
+      const float value = outputs[quality][i];
+      const int c = i % num_tactors;
+      energy[quality][c] += value * value;
+      if (c == 0 || c >= 8) {
+        CHECK(value == outputs[kTactileQualityFull][i]);
+      }
+    }
+    vowel_energy[quality] = 0.0f;
+    max_tactor[quality] = 1;
+    for (c = 1; c <= 7; ++c) {
+      vowel_energy[quality] += energy[quality][c];
+      if (energy[quality][c] > energy[quality][max_tactor[quality]]) {
+        max_tactor[quality] = c;
+      }
+    }
+  }
+
+  CHECK(vowel_energy[kTactileQualityFull] > 1.0f);
+  CHECK(fabs(vowel_energy[kTactileQualityHalfRateVowel] -
+             vowel_energy[kTactileQualityFull]) <
+        0.1f * vowel_energy[kTactileQualityFull]);
+  /* At half rate, the vowel energy is still spread over the cluster. */
+  CHECK(energy[kTactileQualityHalfRateVowel][max_tactor[
+            kTactileQualityHalfRateVowel]] <
+        0.5f * vowel_energy[kTactileQualityHalfRateVowel]);
+  CHECK(energy[kTactileQualityEnvelopeOnly][7] ==
+        vowel_energy[kTactileQualityEnvelopeOnly]);
+  CHECK(vowel_energy[kTactileQualityEnvelopeOnly] > 1.0f);
+
+  for (quality = 0; quality < 3; ++quality) {
+    free(outputs[quality]);
+  }
+  free(input);
+}
+
+/* With TactileProcessorSetActiveTactors(), active tactors match processing all
+ * tactors and unused tactors output zero. Reactivating tactors resets the
+ * stages that were skipped.
+ */
+static void TestActiveTactors(int decimation_factor) {
+  printf("TestActiveTactors(%d)\n", decimation_factor);
+  const float sample_rate_hz = 16000.0f;
+  const int num_tactors = kTactileProcessorNumTactors;
+  const int output_block_size = kBlockSize / decimation_factor;
+  const int num_blocks = (int)(0.5f * sample_rate_hz) / kBlockSize;
+  const int input_size = kBlockSize * num_blocks;
+  const int output_size = num_tactors * output_block_size * num_blocks;
+  float* input = (float*)CHECK_NOTNULL(malloc(input_size * sizeof(float)));
+  float* expected = (float*)CHECK_NOTNULL(malloc(output_size * sizeof(float)));
+  float* actual = (float*)CHECK_NOTNULL(malloc(output_size * sizeof(float)));
+  int i;
+  for (i = 0; i < input_size; ++i) {
+    float t = i / sample_rate_hz;
+    input[i] = 1e-5f * ((float) rand() / RAND_MAX - 0.5f);
+    input[i] += 0.2 * sin(2.0 * M_PI * 1500.0 * t) * Taper(t, 0.05f, 0.45f);
+    input[i] += 0.2 * sin(2.0 * M_PI * 100.0 * t) * Taper(t, 0.15f, 0.35f);
+  }
+
+  TactileProcessorParams params;
+  TactileProcessorSetDefaultParams(&params);
+  params.frontend_params.input_sample_rate_hz = sample_rate_hz;
+  params.frontend_params.block_size = kBlockSize;
+  params.decimation_factor = decimation_factor;
+  TactileProcessor* reference = CHECK_NOTNULL(TactileProcessorMake(&params));
+  CHECK(reference->active_tactors == 0x3ff);
+  int b;
+  for (b = 0; b < num_blocks; ++b) {
+    TactileProcessorProcessSamples(
+        reference, input + kBlockSize * b,
+        expected + num_tactors * output_block_size * b);
+  }
+
+  const uint32_t kActiveTactors[5] = {0x301, 0x0fe, 0x106, 0x100, 0};
+  int k;
+  for (k = 0; k < 5; ++k) {
+    const uint32_t active_tactors = kActiveTactors[k];
+    TactileProcessor* processor = CHECK_NOTNULL(TactileProcessorMake(&params));
+    TactileProcessorSetActiveTactors(processor, active_tactors);
+    for (b = 0; b < num_blocks; ++b) {
+      TactileProcessorProcessSamples(
+          processor, input + kBlockSize * b,
+          actual + num_tactors * output_block_size * b);
+    }
+    /* The frontend runs only for the vowel cluster. */
+    CHECK((FrameBusLatest(&processor->frame_bus) != NULL) ==
+          ((active_tactors & 0xfe) != 0));
+    for (i = 0; i < output_size; ++i) {
+      if ((active_tactors >> (i % num_tactors)) & 1) {
+        CHECK(actual[i] == expected[i]);
+      } else {
+        CHECK(actual[i] == 0.0f);
+      }
+    }
+    TactileProcessorFree(processor);
+  }
+
+  /* Reactivating all tactors halfway through resets the processor, so the
+   * output matches that of a processor reset at the same block.
+   */
+  TactileProcessor* processor = CHECK_NOTNULL(TactileProcessorMake(&params));
+  TactileProcessorSetActiveTactors(processor, 0x300);
+  for (b = 0; b < num_blocks; ++b) {
+    float* output = actual + num_tactors * output_block_size * b;
+    if (b == num_blocks / 2) {
+      TactileProcessorSetActiveTactors(processor, 0x3ff);
+      TactileProcessorReset(reference);
+    }
+    TactileProcessorProcessSamples(processor, input + kBlockSize * b, output);
+    if (b >= num_blocks / 2) {
+      TactileProcessorProcessSamples(reference, input + kBlockSize * b,
+                                     expected);
+      for (i = 0; i < num_tactors * output_block_size; ++i) {
+        CHECK(output[i] == expected[i]);
+      }
+    }
+  }
+
+  TactileProcessorFree(processor);
+  TactileProcessorFree(reference);
+  free(actual);
+  free(expected);
+  free(input);
+}
+
+/* TactileProcessorUpdateLoad() steps the quality ladder with hysteresis. */
+static void TestAdaptiveQuality(void) {
+  puts("TestAdaptiveQuality");
+  const float sample_rate_hz = 16000.0f;
+  TactileProcessorParams params;
+  TactileProcessorSetDefaultParams(&params);
+  params.frontend_params.input_sample_rate_hz = sample_rate_hz;
+  params.frontend_params.block_size = kBlockSize;
+  params.enable_adaptive_quality = 1;
+  params.quality_restore_hold_s = 0.064f;  /* = 16 blocks. */
+  TactileProcessor* processor = CHECK_NOTNULL(TactileProcessorMake(&params));
+  CHECK(processor->quality == kTactileQualityFull);
+
+  /* Moderate load keeps full quality. */
+  int i;
+  for (i = 0; i < 100; ++i) {
+    TactileProcessorUpdateLoad(processor, 0.7f);
+  }
+  CHECK(processor->quality == kTactileQualityFull);
+
+  /* Sustained high load lowers quality one level at a time. */
+  for (i = 0; i < 4; ++i) {
+    TactileProcessorUpdateLoad(processor, 0.95f);
+  }
+  CHECK(processor->quality == kTactileQualityHalfRateVowel);
+  for (i = 0; i < 7; ++i) {
+    TactileProcessorUpdateLoad(processor, 0.95f);
+  }
+  CHECK(processor->quality == kTactileQualityHalfRateVowel);
+  TactileProcessorUpdateLoad(processor, 0.95f);
+  CHECK(processor->quality == kTactileQualityEnvelopeOnly);
+
+  /* Load between the thresholds holds the current level. */
+  for (i = 0; i < 100; ++i) {
+    TactileProcessorUpdateLoad(processor, 0.7f);
+  }
+  CHECK(processor->quality == kTactileQualityEnvelopeOnly);
+
+  /* Low load raises quality after the hold time. The smoothed load falls
+   * below 0.5 on the 3rd block, then the hold time is 16 blocks.
+   */
+  for (i = 0; i < 17; ++i) {
+    TactileProcessorUpdateLoad(processor, 0.3f);
+  }
+  CHECK(processor->quality == kTactileQualityEnvelopeOnly);
+  TactileProcessorUpdateLoad(processor, 0.3f);
+  CHECK(processor->quality == kTactileQualityHalfRateVowel);
+
+  /* An overrun lowers quality immediately. */
+  TactileProcessorUpdateLoad(processor, 1.2f);
+  CHECK(processor->quality == kTactileQualityEnvelopeOnly);
+
+  /* Invalid loads are ignored. */
+  volatile float zero = 0.0f;
+  TactileProcessorUpdateLoad(processor, zero / zero);  /* NaN. */
+  TactileProcessorUpdateLoad(processor, -1.0f);
+  CHECK(processor->smoothed_load == processor->smoothed_load);
+
+  TactileProcessorReset(processor);
+  CHECK(processor->quality == kTactileQualityFull);
+  TactileProcessorFree(processor);
+
+  /* Invalid params. */
+  params.quality_restore_load = 0.9f;
+  CHECK(TactileProcessorMake(&params) == NULL);
+}
+
+/* TactileProcessorMemoryUsage() reports TactileProcessorRequiredBytes(). */
+static void TestMemoryUsage(int enable_silence_gating, int decimation_factor) {
+  printf("TestMemoryUsage(%d, %d)\n",
+         enable_silence_gating, decimation_factor);
+  TactileProcessorParams params;
+  TactileProcessorSetDefaultParams(&params);
+  params.frontend_params.block_size = kBlockSize;
+  params.decimation_factor = decimation_factor;
+  params.enable_silence_gating = enable_silence_gating;
+  TactileProcessor* processor = CHECK_NOTNULL(TactileProcessorMake(&params));
+
+  MemoryUsage usage;
+  TactileProcessorMemoryUsage(processor, &usage);
+  CHECK(usage.heap_bytes == TactileProcessorRequiredBytes(&params));
+  CHECK(usage.state_bytes == 0);
+  CHECK(MemoryUsageRamBytes(&usage) == usage.heap_bytes);
+
+  /* Tables include the frontend's, the vowel network, and FastFun tables. */
+  MemoryUsage frontend_usage;
+  CarlFrontendMemoryUsage(processor->frontend, &frontend_usage);
+  CHECK(usage.heap_bytes > frontend_usage.heap_bytes);
+  CHECK(usage.table_bytes >= frontend_usage.table_bytes +
+                             EmbedVowelTableBytes() + 2 * 256 * 4);
+
+  TactileProcessorFree(processor);
+}
+
 int main(int argc, char** argv) {
   srand(0);
   int decimation_factor;
@@ -278,10 +1285,33 @@ int main(int argc, char** argv) {
     TestTones(16000.0f, decimation_factor);
     TestTones(48000.0f, decimation_factor);
     TestReset(48000.0f, decimation_factor);
+    TestPlanarOutput(16000.0f, decimation_factor);
+    TestSilenceGating(decimation_factor);
+    TestWarmState(decimation_factor);
+    TestCheckpoint(decimation_factor);
   }
+  TestInitInBuffer(0);
+  TestInitInBuffer(1);
+  TestPushSamples(1);
+  TestPushSamples(4);
+  TestCapture(44100.0f, 1);
+  TestCapture(48000.0f, 4);
+  TestCapture(11025.0f, 2);
+  TestFrameBus();
   TestPhone("aa", 1);
   TestPhone("eh", 5);
   TestPhone("uw", 2);
+  TestVowelEmbeddingStride(1);
+  TestVowelEmbeddingStride(4);
+  TestQualityLevels(1);
+  TestQualityLevels(4);
+  TestActiveTactors(1);
+  TestActiveTactors(4);
+  TestAdaptiveQuality();
+  TestMemoryUsage(0, 1);
+  TestMemoryUsage(1, 8);
+  TestDualMic(1);
+  TestDualMic(4);
 
   puts("PASS");
   return EXIT_SUCCESS;
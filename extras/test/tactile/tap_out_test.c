@@ -18,6 +18,7 @@
 #include <string.h>
 
 #include "src/dsp/logging.h"
+#include "src/dsp/serialize.h"
 
 static const TapOutDescriptor kApple = {"Apple", "float", 2, {3, 8}};
 static const TapOutDescriptor kBanana = {"Banana", "text", 1, {30}};
@@ -216,6 +217,157 @@ static void TestCapture(void) {
   CHECK(g_tx_callback_called);
 }
 
+/* Bytes received by the tx callback in ring-buffered capture tests. */
+static uint8_t g_rx_bytes[4 * kTapOutRingCapacity];
+static int g_rx_size = 0;
+
+static void TestRingTxAppend(const char* data, int size) {
+  CHECK(g_rx_size + size <= (int)sizeof(g_rx_bytes));
+  memcpy(g_rx_bytes + g_rx_size, data, size);
+  g_rx_size += size;
+}
+
+static void SendHeartbeat(void) {
+  static const uint8_t kMessageHeartbeat[3] =
+      {kTapOutMarker, kTapOutMessageHeartbeat, 0};
+  TapOutReceiveMessage((const char*)kMessageHeartbeat,
+                       sizeof(kMessageHeartbeat));
+}
+
+/* Sets up Apple and Cherry descriptors and starts ring-buffered capture with
+ * Cherry on every buffer and Apple on every other buffer.
+ */
+static void StartRingCapture(void) {
+  TapOutClearDescriptors();
+  CHECK(TapOutAddDescriptor(&kApple) == 1);
+  CHECK(TapOutAddDescriptor(&kCherry) == 2);
+  g_rx_size = 0;
+  TapOutSetTxFun(TestRingTxAppend);
+
+  static const uint8_t kMessageStartCaptureEx[7] =
+      {kTapOutMarker, kTapOutMessageStartCaptureEx, 4, 2, 1, 1, 2};
+  TapOutReceiveMessage((const char*)kMessageStartCaptureEx,
+                       sizeof(kMessageStartCaptureEx));
+  CHECK(TapOutIsActive());
+}
+
+/* Fills the slices of the current buffer with `value`. */
+static void FillSlices(uint32_t value) {
+  const TapOutSlice* slice = TapOutGetSlice(2);  /* Cherry. */
+  CHECK(slice != NULL);
+  int i;
+  for (i = 0; i < 9; ++i) {
+    LittleEndianWriteU32(value, slice->data + 4 * i);
+  }
+  slice = TapOutGetSlice(1);  /* Apple. */
+  if (slice != NULL) {
+    for (i = 0; i < 24; ++i) {
+      LittleEndianWriteF32((float)value, slice->data + 4 * i);
+    }
+  }
+}
+
+static void TestRingCapture(void) {
+  puts("TestRingCapture()");
+  StartRingCapture();
+
+  const int kNumBuffers = 6;
+  int n;
+  for (n = 0; n < kNumBuffers; ++n) {
+    /* Apple is included on even buffers only. */
+    CHECK((TapOutGetSlice(1) != NULL) == (n % 2 == 0));
+    FillSlices(n);
+    TapOutFinishedCaptureBuffer();
+  }
+  /* Nothing is sent until TapOutService() is called. */
+  CHECK(g_rx_size == 0);
+  const int kExpectedSize = kNumBuffers * (8 + 9 * 4) + (kNumBuffers / 2) * 96;
+  CHECK(TapOutRingSize() == kExpectedSize);
+
+  /* Send in small chunks. */
+  while (TapOutRingSize() > 0) {
+    CHECK(TapOutService(7) <= 7);
+  }
+  CHECK(g_rx_size == kExpectedSize);
+  CHECK(TapOutService(100) == 0);
+
+  const uint8_t* p = g_rx_bytes;
+  for (n = 0; n < kNumBuffers; ++n) {
+    const int has_apple = (n % 2 == 0);
+    CHECK(p[0] == kTapOutMarker);
+    CHECK(p[1] == kTapOutMessageCaptureEx);
+    CHECK(p[2] == 5 + 9 * 4 + (has_apple ? 96 : 0));
+    CHECK(LittleEndianReadU16(p + 3) == n);  /* Sequence. */
+    CHECK(LittleEndianReadU16(p + 5) == 0);  /* Num dropped. */
+    CHECK(p[7] == (has_apple ? 3 : 1));  /* Output mask. */
+    CHECK(LittleEndianReadU32(p + 8 + 4 * 8) == (uint32_t)n);
+    if (has_apple) {
+      CHECK(LittleEndianReadF32(p + 8 + 36 + 4 * 23) == (float)n);
+    }
+    p += 3 + p[2];
+  }
+  CHECK(p == g_rx_bytes + g_rx_size);
+  SendHeartbeat();
+}
+
+static void TestRingDrops(void) {
+  puts("TestRingDrops()");
+  StartRingCapture();
+
+  /* Without servicing, the ring fills and later messages are dropped. */
+  int num_buffers = 0;
+  while (TapOutNumDropped() < 3) {
+    FillSlices(num_buffers);
+    TapOutFinishedCaptureBuffer();
+    ++num_buffers;
+    CHECK(TapOutRingSize() <= kTapOutRingCapacity);
+    CHECK(num_buffers < 100);
+  }
+  const int num_queued = num_buffers - 3;
+
+  /* After servicing, the next message reports the drops. */
+  TapOutService(kTapOutRingCapacity);
+  SendHeartbeat();
+  FillSlices(num_buffers);
+  TapOutFinishedCaptureBuffer();
+  TapOutService(kTapOutRingCapacity);
+
+  const uint8_t* p = g_rx_bytes;
+  int n;
+  for (n = 0; n < num_queued; ++n) {
+    CHECK(LittleEndianReadU16(p + 3) == n);
+    CHECK(LittleEndianReadU16(p + 5) == 0);
+    p += 3 + p[2];
+  }
+  CHECK(LittleEndianReadU16(p + 3) == num_buffers);
+  CHECK(LittleEndianReadU16(p + 5) == 3);
+  p += 3 + p[2];
+  CHECK(p == g_rx_bytes + g_rx_size);
+
+  /* Legacy StartCapture turns off ring buffering. */
+  static const uint8_t kMessageStartCapture[4] =
+      {kTapOutMarker, kTapOutMessageStartCapture, 1, 2};
+  TapOutReceiveMessage((const char*)kMessageStartCapture,
+                       sizeof(kMessageStartCapture));
+  g_rx_size = 0;
+  TapOutFinishedCaptureBuffer();
+  CHECK(g_rx_size == 3 + 9 * 4);
+  CHECK(g_rx_bytes[1] == kTapOutMessageCapture);
+  CHECK(TapOutRingSize() == 0);
+}
+
+static void TestRingBadEveryN(void) {
+  puts("TestRingBadEveryN()");
+  TapOutClearDescriptors();
+  TapOutToken token = TapOutAddDescriptor(&kCherry);
+  uint8_t every_n = 0;
+  CHECK(!TapOutEnableRing(&token, &every_n, 1));
+  CHECK(TapOutGetSlice(token) == NULL);
+  every_n = 4;
+  CHECK(TapOutEnableRing(&token, &every_n, 1));
+  CHECK(TapOutGetSlice(token) != NULL);
+}
+
 static void PrintToStderr(const char* message) {
   fprintf(stderr, "Error: TapOut: %s\n", message);
 }
@@ -230,6 +382,9 @@ int main(int argc, char** argv) {
   TestDescriptorShapeTooBig();
   TestBadToken();
   TestCapture();
+  TestRingCapture();
+  TestRingDrops();
+  TestRingBadEveryN();
 
   puts("PASS");
   return EXIT_SUCCESS;
@@ -15,6 +15,8 @@
 
 #include "src/tactile/tuning.h"
 
+#include <math.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include "src/dsp/logging.h"
@@ -127,6 +129,95 @@ static void TestTactileProcessorApplyTuning(void) {
   TactileProcessorFree(processor);
 }
 
+/* Checks that the tunable Enveloper fields of `a` and `b` are identical. */
+static void CheckSameTuning(const Enveloper* a, const Enveloper* b) {
+  EnveloperTuning tuning_a;
+  EnveloperTuning tuning_b;
+  EnveloperGetTuning(a, &tuning_a);
+  EnveloperGetTuning(b, &tuning_b);
+  CHECK(memcmp(&tuning_a, &tuning_b, sizeof(EnveloperTuning)) == 0);
+}
+
+/* Applying tuning incrementally, one knob change at a time, gives the same
+ * Enveloper params as applying the knobs to a fresh processor.
+ */
+static void TestIncrementalApplyTuning(void) {
+  puts("TestIncrementalApplyTuning");
+  TactileProcessorParams params;
+  TactileProcessorSetDefaultParams(&params);
+  TactileProcessor* processor = CHECK_NOTNULL(TactileProcessorMake(&params));
+  TuningKnobs tuning_knobs = kDefaultTuningKnobs;
+  TactileProcessorApplyTuning(processor, &tuning_knobs);
+
+  int trial;
+  for (trial = 0; trial < 50; ++trial) {
+    tuning_knobs.values[rand() % kNumTuningKnobs] = rand() % 256;
+    TactileProcessorApplyTuning(processor, &tuning_knobs);
+
+    TactileProcessor* fresh = CHECK_NOTNULL(TactileProcessorMake(&params));
+    TactileProcessorApplyTuning(fresh, &tuning_knobs);
+    CheckSameTuning(&fresh->enveloper, &processor->enveloper);
+    TactileProcessorFree(fresh);
+  }
+
+  TactileProcessorFree(processor);
+}
+
+/* Staged tuning is taken by the audio loop at the next block, without
+ * resetting the Enveloper.
+ */
+static void TestStageTuning(void) {
+  puts("TestStageTuning");
+  TactileProcessorParams params;
+  TactileProcessorSetDefaultParams(&params);
+  TactileProcessor* processor = CHECK_NOTNULL(TactileProcessorMake(&params));
+  TactileProcessor* expected = CHECK_NOTNULL(TactileProcessorMake(&params));
+  TuningKnobs tuning_knobs = kDefaultTuningKnobs;
+  TactileProcessorApplyTuning(processor, &tuning_knobs);
+
+  const int block_size = params.frontend_params.block_size;
+  float* input = (float*)CHECK_NOTNULL(malloc(sizeof(float) * block_size));
+  float* output = (float*)CHECK_NOTNULL(malloc(
+      sizeof(float) * kTactileProcessorNumTactors * block_size));
+  int i;
+  for (i = 0; i < block_size; ++i) {
+    input[i] = 0.5f * sin(0.3f * i);
+  }
+  TactileProcessorProcessSamples(processor, input, output);
+  const float smoothed_energy =
+      processor->enveloper.channels[0].smoothed_energy;
+  CHECK(smoothed_energy > 0.0f);
+
+  int trial;
+  for (trial = 0; trial < 10; ++trial) {
+    TuningKnobs old_knobs = tuning_knobs;
+    TactileProcessorApplyTuning(expected, &old_knobs);
+
+    tuning_knobs.values[kKnobAgcStrength] = rand() % 256;
+    tuning_knobs.values[kKnobOutputGain] = rand() % 256;
+    CHECK(TactileProcessorStageTuning(processor, &tuning_knobs));
+    /* A second stage before the audio loop takes the first one fails. */
+    TuningKnobs other_knobs = kDefaultTuningKnobs;
+    CHECK(!TactileProcessorStageTuning(processor, &other_knobs));
+    /* The Enveloper is unchanged until the next block. */
+    CheckSameTuning(&expected->enveloper, &processor->enveloper);
+
+    for (i = 0; i < block_size; ++i) {
+      input[i] = 0.5f * sin(0.3f * i);
+    }
+    TactileProcessorProcessSamples(processor, input, output);
+    TactileProcessorApplyTuning(expected, &tuning_knobs);
+    CheckSameTuning(&expected->enveloper, &processor->enveloper);
+    /* Enveloper state was not reset. */
+    CHECK(processor->enveloper.channels[0].smoothed_energy > 0.0f);
+  }
+
+  free(output);
+  free(input);
+  TactileProcessorFree(expected);
+  TactileProcessorFree(processor);
+}
+
 static void TestTuningGetInputGain(void) {
   puts("TestTuningGetInputGain");
   TuningKnobs tuning_knobs = kDefaultTuningKnobs;
@@ -136,12 +227,73 @@ static void TestTuningGetInputGain(void) {
   CHECK(IsClose(0.175f, TuningGetInputGain(&tuning_knobs)));
 }
 
+/* Precomputed tables match the mapping computed at runtime exactly. */
+static void TestPrecomputedTables(void) {
+  puts("TestPrecomputedTables");
+  int knob;
+  int value;
+  for (knob = 0; knob < kNumTuningKnobs; ++knob) {
+    for (value = 0; value <= 255; ++value) {
+      CHECK(kTuningKnobTables[knob][value] ==
+            TuningComputeControlValue(knob, value));
+    }
+  }
+  TuningKnobs tuning_knobs = kDefaultTuningKnobs;
+  for (value = 0; value <= 255; ++value) {
+    tuning_knobs.values[kKnobInputGain] = value;
+    CHECK(TuningGetInputGain(&tuning_knobs) == TuningComputeInputGain(value));
+  }
+  /* Out-of-range control values are clamped. */
+  CHECK(TuningMapControlValue(kKnobCompressor, -5) ==
+        kTuningKnobInfo[kKnobCompressor].min_value);
+  CHECK(TuningMapControlValue(kKnobCompressor, 300) ==
+        kTuningKnobInfo[kKnobCompressor].max_value);
+  CHECK(TuningMapControlValue(kNumTuningKnobs, 100) == 0.0f);
+}
+
+/* Prints a table of 256 floats computed by `fun`. */
+static void PrintTable(float (*fun)(int, int), int knob) {
+  int value;
+  for (value = 0; value <= 255; ++value) {
+    printf("%s%.9g,%s", (value % 4 == 0) ? "    " : " ", fun(knob, value),
+           (value % 4 == 3) ? "\n" : "");
+  }
+}
+
+static float ComputeInputGain(int unused, int value) {
+  return TuningComputeInputGain(value);
+}
+
+/* Prints the precomputed tables for tuning_tables.c. Called if the program
+ * runs with --print_tables.
+ */
+static void PrintTables(void) {
+  printf("const float kTuningKnobTables[kNumTuningKnobs][256] = {\n");
+  int knob;
+  for (knob = 0; knob < kNumTuningKnobs; ++knob) {
+    printf("  { /* %s */\n", kTuningKnobInfo[knob].name);
+    PrintTable(TuningComputeControlValue, knob);
+    printf("  },\n");
+  }
+  printf("};\n\nconst float kTuningInputGainTable[256] = {\n");
+  PrintTable(ComputeInputGain, 0);
+  printf("};\n");
+}
+
 int main(int argc, char** argv) {
+  if (argc == 2 && !strcmp(argv[1], "--print_tables")) {
+    PrintTables();
+    return EXIT_SUCCESS;
+  }
+
   srand(0);
   TestKnobNamesAreUnique();
   TestTuningKnobInfo();
   TestTactileProcessorApplyTuning();
+  TestIncrementalApplyTuning();
+  TestStageTuning();
   TestTuningGetInputGain();
+  TestPrecomputedTables();
 
   TestTuningMapControlValue(kKnobInputGain, 0, -30.0f);
   TestTuningMapControlValue(kKnobInputGain, 255, 30.2363f);
@@ -0,0 +1,201 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "src/tactile/usb_stream.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "src/dsp/logging.h"
+
+#define kNumBlocks 20
+
+/* Fills `samples` with a pattern depending on `seed`. */
+static void MakeSamples(int seed, int num_samples, uint8_t* samples) {
+  int i;
+  for (i = 0; i < num_samples; ++i) {
+    samples[i] = (uint8_t)(seed * 31 + i * 7);
+  }
+}
+
+static void TestFramesPerBlock(void) {
+  puts("TestFramesPerBlock");
+  CHECK(UsbStreamFramesPerBlock(12, 8) == 40);
+  CHECK(UsbStreamFramesPerBlock(24, 8) == 16);
+  CHECK(UsbStreamFramesPerBlock(24, 1) == 21);
+  CHECK(UsbStreamFramesPerBlock(1, 1) == 255);
+  CHECK(UsbStreamFramesPerBlock(200, 8) == 0);
+  CHECK(UsbStreamFramesPerBlock(0, 8) == 0);
+}
+
+/* Encodes a stream of Data, Credit and Reset messages, with junk bytes in
+ * between, and checks that it parses correctly when fed in random chunks.
+ */
+static void TestRoundTrip(int num_channels, int num_frames) {
+  printf("TestRoundTrip(%d, %d)\n", num_channels, num_frames);
+  const int block_samples = num_channels * num_frames;
+  uint8_t* stream = (uint8_t*)CHECK_NOTNULL(
+      malloc(kNumBlocks * (kUsbStreamMaxMessageBytes + 64)));
+  uint8_t samples[kUsbStreamMaxPayloadBytes];
+  int stream_size = UsbStreamEncodeReset(stream);
+  CHECK(stream_size == kUsbStreamHeaderBytes);
+
+  int i;
+  for (i = 0; i < kNumBlocks; ++i) {
+    /* Junk text, as printed by the firmware. */
+    memcpy(stream + stream_size, "hello\r\n", 7);
+    stream_size += 7;
+
+    MakeSamples(i, block_samples, samples);
+    const int size = UsbStreamEncodeData((uint16_t)(65530 + i), num_channels,
+                                         num_frames, samples,
+                                         stream + stream_size);
+    CHECK(size == kUsbStreamHeaderBytes + block_samples);
+    CHECK(size <= kUsbStreamMaxMessageBytes);
+    stream_size += size;
+
+    UsbStreamCredit credit = {0xfffffff0 + i, 8, i, 2 * i};
+    stream_size += UsbStreamEncodeCredit(&credit, stream + stream_size);
+  }
+
+  UsbStreamParser parser;
+  UsbStreamParserInit(&parser);
+  int num_resets = 0;
+  int num_data = 0;
+  int num_credits = 0;
+  int position = 0;
+  while (position < stream_size) {
+    int chunk_size = 1 + rand() % 100;
+    if (chunk_size > stream_size - position) {
+      chunk_size = stream_size - position;
+    }
+    const uint8_t* chunk = stream + position;
+    position += chunk_size;
+
+    while (chunk_size > 0) {
+      UsbStreamMessage message;
+      const int consumed =
+          UsbStreamParserFeed(&parser, chunk, chunk_size, &message);
+      CHECK(0 < consumed && consumed <= chunk_size);
+      chunk += consumed;
+      chunk_size -= consumed;
+
+      switch (message.type) {
+        case kUsbStreamNone:
+          CHECK(chunk_size == 0);
+          break;
+        case kUsbStreamReset:
+          CHECK(num_data == 0);
+          ++num_resets;
+          break;
+        case kUsbStreamData:
+          CHECK(message.sequence == (uint16_t)(65530 + num_data));
+          CHECK(message.num_channels == num_channels);
+          CHECK(message.num_frames == num_frames);
+          CHECK(message.payload_size == block_samples);
+          MakeSamples(num_data, block_samples, samples);
+          CHECK(memcmp(message.payload, samples, block_samples) == 0);
+          ++num_data;
+          break;
+        case kUsbStreamCredit: {
+          UsbStreamCredit credit;
+          CHECK(UsbStreamDecodeCredit(&message, &credit));
+          CHECK(credit.num_consumed == 0xfffffff0 + num_credits);
+          CHECK(credit.capacity == 8);
+          CHECK(credit.num_underruns == num_credits);
+          CHECK(credit.num_errors == 2 * num_credits);
+          ++num_credits;
+        } break;
+      }
+    }
+  }
+
+  CHECK(num_resets == 1);
+  CHECK(num_data == kNumBlocks);
+  CHECK(num_credits == kNumBlocks);
+  CHECK(parser.num_errors == 0);
+  free(stream);
+}
+
+/* Corrupted messages are dropped and the parser resyncs at the next marker. */
+static void TestCorruption(void) {
+  puts("TestCorruption");
+  uint8_t stream[3 * kUsbStreamMaxMessageBytes];
+  uint8_t samples[12 * 8];
+  MakeSamples(1, sizeof(samples), samples);
+  const int size = UsbStreamEncodeData(7, 12, 8, samples, stream);
+  memcpy(stream + size, stream, size);
+  memcpy(stream + 2 * size, stream, size);
+  stream[size + 20] ^= 1;      /* Corrupt the second message's payload. */
+  stream[2 * size + 1] = 0x7f; /* Invalid type in the third message. */
+
+  UsbStreamParser parser;
+  UsbStreamParserInit(&parser);
+  UsbStreamMessage message;
+  int consumed = UsbStreamParserFeed(&parser, stream, 3 * size, &message);
+  CHECK(consumed == size);
+  CHECK(message.type == kUsbStreamData);
+  CHECK(message.sequence == 7);
+
+  consumed += UsbStreamParserFeed(&parser, stream + consumed,
+                                  3 * size - consumed, &message);
+  CHECK(consumed == 3 * size);
+  CHECK(message.type == kUsbStreamNone);
+  CHECK(parser.num_errors == 2);
+}
+
+static void TestSendableBlocks(void) {
+  puts("TestSendableBlocks");
+  UsbStreamCredit credit = {0, 8, 0, 0};
+  CHECK(UsbStreamSendableBlocks(&credit, 0) == 8);
+  CHECK(UsbStreamSendableBlocks(&credit, 5) == 3);
+  CHECK(UsbStreamSendableBlocks(&credit, 8) == 0);
+  /* Stale credit from before blocks were sent never allows more than 0. */
+  CHECK(UsbStreamSendableBlocks(&credit, 12) == 0);
+
+  /* Counters wrapping around 2^32. */
+  credit.num_consumed = 0xfffffffe;
+  CHECK(UsbStreamSendableBlocks(&credit, 0xfffffffe) == 8);
+  CHECK(UsbStreamSendableBlocks(&credit, 3) == 3);
+}
+
+static void TestInvalidArgs(void) {
+  puts("TestInvalidArgs");
+  uint8_t message[kUsbStreamMaxMessageBytes];
+  uint8_t samples[kUsbStreamMaxPayloadBytes] = {0};
+  CHECK(UsbStreamEncodeData(0, 0, 8, samples, message) == 0);
+  CHECK(UsbStreamEncodeData(0, 12, 0, samples, message) == 0);
+  CHECK(UsbStreamEncodeData(0, 12, 43, samples, message) == 0);
+  CHECK(UsbStreamEncodeData(0, 1, 256, samples, message) == 0);
+
+  UsbStreamMessage data_message = {kUsbStreamData, 0, 12, 8, samples, 96};
+  UsbStreamCredit credit;
+  CHECK(!UsbStreamDecodeCredit(&data_message, &credit));
+}
+
+int main(int argc, char** argv) {
+  srand(0);
+  TestFramesPerBlock();
+  TestRoundTrip(1, 1);
+  TestRoundTrip(12, 40);
+  TestRoundTrip(24, 16);
+  TestRoundTrip(2, 252);
+  TestCorruption();
+  TestSendableBlocks();
+  TestInvalidArgs();
+
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
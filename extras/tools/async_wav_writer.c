@@ -0,0 +1,259 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "extras/tools/async_wav_writer.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "src/dsp/convert_sample.h"
+#include "src/dsp/write_wav_file.h"
+
+static int16_t* BufferSamples(AsyncWavWriter* writer, int index) {
+  return writer->buffers +
+      (size_t)index * writer->buffer_frames * writer->num_channels;
+}
+
+/* Wakes the writer thread. The mutex is held only briefly by either side. */
+static void WakeWriter(AsyncWavWriter* writer) {
+  pthread_mutex_lock(&writer->mutex);
+  pthread_cond_signal(&writer->cond);
+  pthread_mutex_unlock(&writer->mutex);
+}
+
+static void* WriterThread(void* arg) {
+  AsyncWavWriter* writer = (AsyncWavWriter*)arg;
+  for (;;) {
+    int index;
+    if (SpscRingRead(writer->full_buffers, &index, 1)) {
+      const int num_frames = writer->buffer_num_frames[index];
+      if (!atomic_load(&writer->has_error)) {
+        if (WriteWavSamples(writer->f, BufferSamples(writer, index),
+                            (size_t)num_frames * writer->num_channels)) {
+          writer->num_written_frames += num_frames;
+        } else {
+          atomic_store(&writer->has_error, 1);
+        }
+      }
+      /* Return the buffer to the pool. This always fits, since the free ring
+       * has room for all buffers.
+       */
+      SpscRingWrite(writer->free_buffers, &index, 1);
+      continue;
+    }
+
+    /* Wait for a buffer or close. Checking under the mutex, which the producer
+     * holds to signal after passing a buffer, avoids missing a wakeup.
+     */
+    pthread_mutex_lock(&writer->mutex);
+    int done = 0;
+    while (SpscRingNumAvailable(writer->full_buffers) == 0) {
+      if (atomic_load(&writer->closing)) {
+        done = 1;
+        break;
+      }
+      pthread_cond_wait(&writer->cond, &writer->mutex);
+    }
+    pthread_mutex_unlock(&writer->mutex);
+    if (done) { break; }
+  }
+  return NULL;
+}
+
+AsyncWavWriter* AsyncWavWriterMake(const char* file_name,
+                                   int sample_rate_hz,
+                                   int num_channels,
+                                   int buffer_frames,
+                                   int num_buffers) {
+  if (file_name == NULL || sample_rate_hz <= 0 || num_channels <= 0 ||
+      buffer_frames <= 0 || num_buffers < 2) {
+    fprintf(stderr, "Error: Invalid AsyncWavWriter arguments.\n");
+    return NULL;
+  }
+
+  AsyncWavWriter* writer = (AsyncWavWriter*)malloc(sizeof(AsyncWavWriter));
+  if (writer == NULL) {
+    fprintf(stderr, "Error: Memory allocation failed.\n");
+    return NULL;
+  }
+  writer->f = NULL;
+  writer->buffers = NULL;
+  writer->buffer_num_frames = NULL;
+  writer->full_buffers = NULL;
+  writer->free_buffers = NULL;
+  writer->sample_rate_hz = sample_rate_hz;
+  writer->num_channels = num_channels;
+  writer->buffer_frames = buffer_frames;
+  writer->num_buffers = num_buffers;
+  writer->fill_buffer = 0;
+  writer->fill_frames = 0;
+  writer->num_dropped_frames = 0;
+  writer->num_written_frames = 0;
+  atomic_init(&writer->closing, 0);
+  atomic_init(&writer->has_error, 0);
+
+  writer->buffers = (int16_t*)malloc(
+      sizeof(int16_t) * num_buffers * buffer_frames * num_channels);
+  writer->buffer_num_frames = (int*)malloc(sizeof(int) * num_buffers);
+  writer->full_buffers = SpscRingMake(sizeof(int), num_buffers);
+  writer->free_buffers = SpscRingMake(sizeof(int), num_buffers);
+  if (writer->buffers == NULL || writer->buffer_num_frames == NULL ||
+      writer->full_buffers == NULL || writer->free_buffers == NULL) {
+    fprintf(stderr, "Error: Memory allocation failed.\n");
+    goto fail;
+  }
+
+  /* Buffer 0 starts as the fill buffer, the rest are free. */
+  int i;
+  for (i = 1; i < num_buffers; ++i) {
+    SpscRingWrite(writer->free_buffers, &i, 1);
+  }
+
+  writer->f = fopen(file_name, "wb");
+  if (writer->f == NULL) {
+    fprintf(stderr, "Error: Failed to open \"%s\" for writing.\n", file_name);
+    goto fail;
+  }
+  /* Write header with zero length, to be patched on close. The header is
+   * RF64-capable, so it can be patched for recordings over 4 GB.
+   */
+  if (!WriteWavHeaderRf64(writer->f, 0, sample_rate_hz, num_channels,
+                          kWavInt16Format)) {
+    fprintf(stderr, "Error: Failed to write \"%s\".\n", file_name);
+    goto fail;
+  }
+
+  if (pthread_mutex_init(&writer->mutex, NULL) != 0) { goto fail; }
+  if (pthread_cond_init(&writer->cond, NULL) != 0) {
+    pthread_mutex_destroy(&writer->mutex);
+    goto fail;
+  }
+  if (pthread_create(&writer->thread, NULL, WriterThread, writer) != 0) {
+    fprintf(stderr, "Error: Failed to create writer thread.\n");
+    pthread_cond_destroy(&writer->cond);
+    pthread_mutex_destroy(&writer->mutex);
+    goto fail;
+  }
+  return writer;
+
+fail:
+  if (writer->f) { fclose(writer->f); }
+  SpscRingFree(writer->free_buffers);
+  SpscRingFree(writer->full_buffers);
+  free(writer->buffer_num_frames);
+  free(writer->buffers);
+  free(writer);
+  return NULL;
+}
+
+/* Passes the fill buffer to the writer thread and gets a new one. */
+static void PassFillBuffer(AsyncWavWriter* writer) {
+  writer->buffer_num_frames[writer->fill_buffer] = writer->fill_frames;
+  SpscRingWrite(writer->full_buffers, &writer->fill_buffer, 1);
+  WakeWriter(writer);
+  writer->fill_frames = 0;
+  if (!SpscRingRead(writer->free_buffers, &writer->fill_buffer, 1)) {
+    writer->fill_buffer = -1;
+  }
+}
+
+/* Enqueues samples, which are int16_t if `is_float` is 0 or float otherwise. */
+static int Enqueue(AsyncWavWriter* writer, const void* samples,
+                   int is_float, int num_frames) {
+  const int num_channels = writer->num_channels;
+  const int16_t* samples_int16 = (const int16_t*)samples;
+  const float* samples_float = (const float*)samples;
+
+  while (num_frames > 0) {
+    if (writer->fill_buffer < 0 &&
+        !SpscRingRead(writer->free_buffers, &writer->fill_buffer, 1)) {
+      /* No buffer is free. Drop the remaining frames. */
+      writer->fill_buffer = -1;
+      writer->num_dropped_frames += num_frames;
+      return 0;
+    }
+
+    int chunk_frames = writer->buffer_frames - writer->fill_frames;
+    if (chunk_frames > num_frames) { chunk_frames = num_frames; }
+    const int chunk_size = chunk_frames * num_channels;
+    int16_t* dest = BufferSamples(writer, writer->fill_buffer) +
+        writer->fill_frames * num_channels;
+    if (is_float) {
+      int i;
+      for (i = 0; i < chunk_size; ++i) {
+        dest[i] = ConvertSampleFloatToInt16(samples_float[i]);
+      }
+      samples_float += chunk_size;
+    } else {
+      memcpy(dest, samples_int16, sizeof(int16_t) * chunk_size);
+      samples_int16 += chunk_size;
+    }
+    writer->fill_frames += chunk_frames;
+    num_frames -= chunk_frames;
+
+    if (writer->fill_frames == writer->buffer_frames) {
+      PassFillBuffer(writer);
+    }
+  }
+  return 1;
+}
+
+int AsyncWavWriterWrite(AsyncWavWriter* writer, const int16_t* samples,
+                        int num_frames) {
+  return Enqueue(writer, samples, 0, num_frames);
+}
+
+int AsyncWavWriterWriteFloat(AsyncWavWriter* writer, const float* samples,
+                             int num_frames) {
+  return Enqueue(writer, samples, 1, num_frames);
+}
+
+int AsyncWavWriterClose(AsyncWavWriter* writer) {
+  if (writer == NULL) { return 0; }
+  if (writer->fill_buffer >= 0 && writer->fill_frames > 0) {
+    PassFillBuffer(writer);
+  }
+  atomic_store(&writer->closing, 1);
+  WakeWriter(writer);
+  pthread_join(writer->thread, NULL);
+  pthread_cond_destroy(&writer->cond);
+  pthread_mutex_destroy(&writer->mutex);
+
+  /* Patch the header with the final size. */
+  int success = !atomic_load(&writer->has_error);
+  if (success) {
+    success = fseek(writer->f, 0, SEEK_SET) == 0 &&
+        WriteWavHeaderRf64(writer->f,
+                           (uint64_t)writer->num_written_frames *
+                               writer->num_channels,
+                           writer->sample_rate_hz, writer->num_channels,
+                           kWavInt16Format);
+  }
+  if (fclose(writer->f) != 0) { success = 0; }
+  if (!success) {
+    fprintf(stderr, "Error: AsyncWavWriter failed to write WAV file.\n");
+  }
+  if (writer->num_dropped_frames > 0) {
+    fprintf(stderr, "Warning: AsyncWavWriter dropped %d frames.\n",
+            writer->num_dropped_frames);
+  }
+
+  SpscRingFree(writer->free_buffers);
+  SpscRingFree(writer->full_buffers);
+  free(writer->buffer_num_frames);
+  free(writer->buffers);
+  free(writer);
+  return success;
+}
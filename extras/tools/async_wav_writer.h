@@ -0,0 +1,130 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * Asynchronous double-buffered WAV writer for recording from an audio thread.
+ *
+ * `AsyncWavWriter` writes a 16-bit WAV file on a background writer thread, so
+ * that recording does not block the producer (e.g. a PortAudio callback) on
+ * disk I/O. Samples are copied into a pool of preallocated buffers. Full
+ * buffers are passed to the writer thread, and written buffers are returned to
+ * the pool, through two SpscRings (see spsc_ring.h) of buffer indices.
+ *
+ * The producer never waits for the disk: if the writer falls so far behind
+ * that no buffer is free, samples are dropped and counted in
+ * `num_dropped_frames`. The WAV header is first written with zero length and
+ * patched with the final size when the writer is closed, becoming RF64 if the
+ * recording exceeds 4 GB, so recordings may be arbitrarily long.
+ *
+ * Example use:
+ *   AsyncWavWriter* writer = AsyncWavWriterMake(
+ *       "recording.wav", sample_rate_hz, num_channels, 4096, 8);
+ *   // Producer thread, e.g. in the audio callback.
+ *   AsyncWavWriterWriteFloat(writer, samples, num_frames);
+ *   ...
+ *   // When done, after the producer has stopped.
+ *   AsyncWavWriterClose(writer);
+ *
+ * NOTE: This library requires C11 (-std=c11) for <stdatomic.h>.
+ */
+
+#ifndef AUDIO_TO_TACTILE_EXTRAS_TOOLS_ASYNC_WAV_WRITER_H_
+#define AUDIO_TO_TACTILE_EXTRAS_TOOLS_ASYNC_WAV_WRITER_H_
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "extras/tools/spsc_ring.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+  FILE* f;
+  int sample_rate_hz;
+  int num_channels;
+  /* Capacity of each buffer in frames. */
+  int buffer_frames;
+  int num_buffers;
+  /* Buffer pool, `num_buffers * buffer_frames * num_channels` samples. */
+  int16_t* buffers;
+  /* Number of frames in each buffer, set by the producer before passing it to
+   * the writer thread.
+   */
+  int* buffer_num_frames;
+
+  /* Ring of indices of buffers ready to be written, producer -> writer. */
+  SpscRing* full_buffers;
+  /* Ring of indices of free buffers, writer -> producer. */
+  SpscRing* free_buffers;
+
+  /* Producer state: the buffer being filled, or -1 if none is available. */
+  int fill_buffer;
+  int fill_frames;
+  /* Number of frames dropped because no buffer was free. Producer only. */
+  int num_dropped_frames;
+
+  /* Writer thread state. The mutex and condition variable are used only to
+   * wake the writer; buffers are passed through the rings.
+   */
+  pthread_t thread;
+  pthread_mutex_t mutex;
+  pthread_cond_t cond;
+  atomic_int closing;
+  /* Number of frames written to the file. Writer only until joined. */
+  int64_t num_written_frames;
+  /* Set by the writer thread if a write fails. */
+  atomic_int has_error;
+} AsyncWavWriter;
+
+/* Opens `file_name` for writing and starts the writer thread. Buffers hold
+ * `buffer_frames` frames each, with `num_buffers` (at least 2) buffers in the
+ * pool. Returns NULL on failure.
+ */
+AsyncWavWriter* AsyncWavWriterMake(const char* file_name,
+                                   int sample_rate_hz,
+                                   int num_channels,
+                                   int buffer_frames,
+                                   int num_buffers);
+
+/* Producer: enqueues `num_frames` frames of interleaved int16 samples without
+ * blocking. Returns 1 on success, or 0 if any frames were dropped because no
+ * buffer was free.
+ */
+int /*bool*/ AsyncWavWriterWrite(AsyncWavWriter* writer,
+                                 const int16_t* samples,
+                                 int num_frames);
+
+/* Producer: same as above, but for float samples in [-1, 1], which are
+ * converted to int16 with ConvertSampleFloatToInt16() directly into the
+ * buffer.
+ */
+int /*bool*/ AsyncWavWriterWriteFloat(AsyncWavWriter* writer,
+                                      const float* samples,
+                                      int num_frames);
+
+/* Writes any remaining samples, stops the writer thread, patches the WAV
+ * header with the final size, closes the file, and frees the writer. Must not
+ * be called concurrently with the producer. Returns 1 on success, 0 if any
+ * I/O failed.
+ */
+int /*bool*/ AsyncWavWriterClose(AsyncWavWriter* writer);
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif
+#endif /* AUDIO_TO_TACTILE_EXTRAS_TOOLS_ASYNC_WAV_WRITER_H_ */
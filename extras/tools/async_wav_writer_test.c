@@ -0,0 +1,150 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "extras/tools/async_wav_writer.h"
+
+#include <stdlib.h>
+
+#include "src/dsp/logging.h"
+#include "src/dsp/read_wav_file.h"
+
+#define kNumChannels 3
+#define kSampleRateHz 16000
+
+static int16_t TestSample(int i) { return (int16_t)((i * 7919) % 65536); }
+
+/* Writes int16 samples in chunks that straddle buffers, then reads back. */
+static void TestWriteInt16(void) {
+  puts("TestWriteInt16");
+  const char* file_name = CHECK_NOTNULL(tmpnam(NULL));
+
+  const int kBufferFrames = 64;
+  const int kNumFrames = 10000;
+  const int kChunkFrames = 37;
+  /* Enough buffers for the whole recording, so that nothing is dropped
+   * however slow the writer thread is.
+   */
+  const int kNumBuffers = kNumFrames / kBufferFrames + 2;
+  AsyncWavWriter* writer = CHECK_NOTNULL(AsyncWavWriterMake(
+      file_name, kSampleRateHz, kNumChannels, kBufferFrames, kNumBuffers));
+
+  int16_t chunk[37 * kNumChannels];
+  int start;
+  for (start = 0; start < kNumFrames; start += kChunkFrames) {
+    const int num_frames = (kNumFrames - start < kChunkFrames)
+        ? kNumFrames - start : kChunkFrames;
+    int i;
+    for (i = 0; i < num_frames * kNumChannels; ++i) {
+      chunk[i] = TestSample(start * kNumChannels + i);
+    }
+    CHECK(AsyncWavWriterWrite(writer, chunk, num_frames));
+  }
+  CHECK(writer->num_dropped_frames == 0);
+  CHECK(AsyncWavWriterClose(writer));
+
+  size_t num_samples;
+  int num_channels;
+  int sample_rate_hz;
+  int16_t* samples = CHECK_NOTNULL(Read16BitWavFile(
+      file_name, &num_samples, &num_channels, &sample_rate_hz));
+  CHECK(num_samples == (size_t)kNumFrames * kNumChannels);
+  CHECK(num_channels == kNumChannels);
+  CHECK(sample_rate_hz == kSampleRateHz);
+  int i;
+  for (i = 0; i < (int)num_samples; ++i) {
+    CHECK(samples[i] == TestSample(i));
+  }
+
+  free(samples);
+  remove(file_name);
+}
+
+/* Writes float samples, which are converted to int16. */
+static void TestWriteFloat(void) {
+  puts("TestWriteFloat");
+  const char* file_name = CHECK_NOTNULL(tmpnam(NULL));
+
+  AsyncWavWriter* writer = CHECK_NOTNULL(
+      AsyncWavWriterMake(file_name, kSampleRateHz, 1, 4, 4));
+  const float kSamples[5] = {0.0f, 0.5f, -0.5f, 1.0f, -1.0f};
+  CHECK(AsyncWavWriterWriteFloat(writer, kSamples, 5));
+  CHECK(AsyncWavWriterClose(writer));
+
+  size_t num_samples;
+  int num_channels;
+  int sample_rate_hz;
+  int16_t* samples = CHECK_NOTNULL(Read16BitWavFile(
+      file_name, &num_samples, &num_channels, &sample_rate_hz));
+  CHECK(num_samples == 5);
+  CHECK(num_channels == 1);
+  CHECK(samples[0] == 0);
+  CHECK(samples[1] == 16384);
+  CHECK(samples[2] == -16384);
+  CHECK(samples[3] == 32767);  /* Clamped. */
+  CHECK(samples[4] == -32768);
+
+  free(samples);
+  remove(file_name);
+}
+
+/* When the pool is exhausted, frames are dropped rather than blocking, and the
+ * file has exactly the frames that weren't dropped.
+ */
+static void TestDropWhenFull(void) {
+  puts("TestDropWhenFull");
+  const char* file_name = CHECK_NOTNULL(tmpnam(NULL));
+
+  const int kNumFrames = 100000;
+  int16_t* input = (int16_t*)CHECK_NOTNULL(
+      calloc(kNumFrames, sizeof(int16_t)));
+  AsyncWavWriter* writer = CHECK_NOTNULL(
+      AsyncWavWriterMake(file_name, kSampleRateHz, 1, 16, 2));
+  /* A single large write fills both buffers far faster than they are
+   * written, so most frames are dropped.
+   */
+  CHECK(!AsyncWavWriterWrite(writer, input, kNumFrames));
+  const int num_dropped_frames = writer->num_dropped_frames;
+  CHECK(num_dropped_frames > 0);
+  CHECK(AsyncWavWriterClose(writer));
+
+  size_t num_samples;
+  int num_channels;
+  int sample_rate_hz;
+  int16_t* samples = CHECK_NOTNULL(Read16BitWavFile(
+      file_name, &num_samples, &num_channels, &sample_rate_hz));
+  CHECK((int)num_samples == kNumFrames - num_dropped_frames);
+
+  free(samples);
+  free(input);
+  remove(file_name);
+}
+
+static void TestInvalidArgs(void) {
+  puts("TestInvalidArgs");
+  CHECK(AsyncWavWriterMake("unused.wav", kSampleRateHz, 1, 16, 1) == NULL);
+  CHECK(AsyncWavWriterMake("unused.wav", kSampleRateHz, 0, 16, 2) == NULL);
+  CHECK(AsyncWavWriterMake("/nonexistent/dir/out.wav",
+                           kSampleRateHz, 1, 16, 2) == NULL);
+}
+
+int main(int argc, char** argv) {
+  TestWriteInt16();
+  TestWriteFloat();
+  TestDropWhenFull();
+  TestInvalidArgs();
+
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,87 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "extras/tools/checkpoint_index.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+CheckpointIndex* CheckpointIndexMake(const TactileProcessor* processor,
+                                     int interval_blocks) {
+  if (interval_blocks < 1) {
+    fprintf(stderr, "Error: interval_blocks must be positive.\n");
+    return NULL;
+  }
+  CheckpointIndex* index = (CheckpointIndex*)malloc(sizeof(CheckpointIndex));
+  if (index == NULL) {
+    fprintf(stderr, "Error: Memory allocation failed.\n");
+    return NULL;
+  }
+  index->interval_blocks = interval_blocks;
+  index->num_checkpoints = 0;
+  index->capacity = 0;
+  index->processor_bytes = TactileProcessorCheckpointBytes(processor);
+  index->checkpoint_bytes = index->processor_bytes + sizeof(PostProcessor);
+  index->data = NULL;
+  return index;
+}
+
+void CheckpointIndexFree(CheckpointIndex* index) {
+  if (index != NULL) {
+    free(index->data);
+    free(index);
+  }
+}
+
+int CheckpointIndexRecord(CheckpointIndex* index, int block_index,
+                          const TactileProcessor* processor,
+                          const PostProcessor* post_processor) {
+  if (block_index != index->num_checkpoints * index->interval_blocks) {
+    return 0;
+  }
+  if (index->num_checkpoints == index->capacity) {
+    /* Grow geometrically so that recording is amortized O(1). */
+    const int new_capacity = (index->capacity > 0) ? 2 * index->capacity : 16;
+    char* data = (char*)realloc(
+        index->data, index->checkpoint_bytes * new_capacity);
+    if (data == NULL) {
+      fprintf(stderr, "Error: Memory allocation failed.\n");
+      return 0;
+    }
+    index->data = data;
+    index->capacity = new_capacity;
+  }
+  char* checkpoint =
+      index->data + index->checkpoint_bytes * index->num_checkpoints;
+  TactileProcessorSaveCheckpoint(processor, checkpoint);
+  memcpy(checkpoint + index->processor_bytes, post_processor,
+         sizeof(PostProcessor));
+  ++index->num_checkpoints;
+  return 1;
+}
+
+int CheckpointIndexRestore(const CheckpointIndex* index, int block_index,
+                           TactileProcessor* processor,
+                           PostProcessor* post_processor) {
+  if (block_index < 0 || index->num_checkpoints == 0) { return -1; }
+  int k = block_index / index->interval_blocks;
+  if (k >= index->num_checkpoints) { k = index->num_checkpoints - 1; }
+  const char* checkpoint = index->data + index->checkpoint_bytes * k;
+  if (!TactileProcessorLoadCheckpoint(processor, checkpoint)) { return -1; }
+  memcpy(post_processor, checkpoint + index->processor_bytes,
+         sizeof(PostProcessor));
+  return k * index->interval_blocks;
+}
@@ -0,0 +1,97 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * Index of processor state checkpoints, for seeking when replaying a file.
+ *
+ * Tools that replay a WAV file with scrubbing would otherwise need to reset
+ * and reprocess from the start of the file on each seek, or accept warm-up
+ * artifacts. Instead, during the first pass, `CheckpointIndexRecord()` saves
+ * the full TactileProcessor and PostProcessor state every `interval_blocks`
+ * blocks (see TactileProcessorSaveCheckpoint()). To seek to a block,
+ * `CheckpointIndexRestore()` loads the nearest earlier checkpoint, and the
+ * caller processes the blocks from there to the target. So a seek costs at
+ * most `interval_blocks` blocks of processing instead of the whole file, and
+ * the output is exactly that of uninterrupted processing.
+ *
+ * Checkpoints are a few KB each, so for example a 16 kHz file with block size
+ * 64 and `interval_blocks` 250 (1 second) needs a few KB per second of audio.
+ *
+ * Example use:
+ *   CheckpointIndex* index = CheckpointIndexMake(processor, 250);
+ *   // First pass.
+ *   for (b = 0; b < num_blocks; ++b) {
+ *     CheckpointIndexRecord(index, b, processor, &post_processor);
+ *     ... process block b ...
+ *   }
+ *   // Seek to block `target`.
+ *   int b = CheckpointIndexRestore(index, target, processor, &post_processor);
+ *   for (; b < target; ++b) { ... process block b, discarding output ... }
+ */
+
+#ifndef AUDIO_TO_TACTILE_EXTRAS_TOOLS_CHECKPOINT_INDEX_H_
+#define AUDIO_TO_TACTILE_EXTRAS_TOOLS_CHECKPOINT_INDEX_H_
+
+#include <stddef.h>
+
+#include "src/tactile/post_processor.h"
+#include "src/tactile/tactile_processor.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+  /* Number of blocks between checkpoints. */
+  int interval_blocks;
+  /* Checkpoint k is for the state before block k * interval_blocks. */
+  int num_checkpoints;
+  int capacity;
+  /* Bytes per checkpoint, a TactileProcessor checkpoint and a PostProcessor. */
+  size_t checkpoint_bytes;
+  size_t processor_bytes;
+  char* data;
+} CheckpointIndex;
+
+/* Makes an empty CheckpointIndex for checkpoints of `processor` every
+ * `interval_blocks` blocks. The caller should free it when done with
+ * `CheckpointIndexFree`. Returns NULL on failure.
+ */
+CheckpointIndex* CheckpointIndexMake(const TactileProcessor* processor,
+                                     int interval_blocks);
+
+/* Frees a CheckpointIndex. */
+void CheckpointIndexFree(CheckpointIndex* index);
+
+/* Records a checkpoint of the state before processing block `block_index`, if
+ * it is the next checkpoint due, i.e. `block_index` is the next multiple of
+ * `interval_blocks`. Call this before processing each block on the first
+ * pass. Returns 1 if a checkpoint was recorded, 0 otherwise.
+ */
+int CheckpointIndexRecord(CheckpointIndex* index, int block_index,
+                          const TactileProcessor* processor,
+                          const PostProcessor* post_processor);
+
+/* Restores the latest checkpoint at or before block `block_index` and returns
+ * its block index. The caller should then process blocks from there up to
+ * `block_index`. Returns -1 on failure, if there is no such checkpoint.
+ */
+int CheckpointIndexRestore(const CheckpointIndex* index, int block_index,
+                           TactileProcessor* processor,
+                           PostProcessor* post_processor);
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif
+#endif /* AUDIO_TO_TACTILE_EXTRAS_TOOLS_CHECKPOINT_INDEX_H_ */
@@ -0,0 +1,130 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "extras/tools/checkpoint_index.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "src/dsp/logging.h"
+#include "src/dsp/math_constants.h"
+
+#define kBlockSize 64
+#define kNumBlocks 400
+#define kIntervalBlocks 50
+#define kSampleRateHz 16000.0f
+
+/* Makes a test signal of noise and a tone, with a gap of silence. */
+static float* MakeInput(void) {
+  float* input = (float*)CHECK_NOTNULL(
+      malloc(sizeof(float) * kBlockSize * kNumBlocks));
+  int i;
+  for (i = 0; i < kBlockSize * kNumBlocks; ++i) {
+    const int block = i / kBlockSize;
+    if (150 <= block && block < 230) {
+      input[i] = 0.0f;
+    } else {
+      const float t = i / kSampleRateHz;
+      input[i] = 0.1f * ((float)rand() / RAND_MAX - 0.5f) +
+          0.2f * sin(2.0 * M_PI * 500.0 * t);
+    }
+  }
+  return input;
+}
+
+/* Processes block `b` of `input`, writing `output_size` samples to `output`. */
+static void ProcessBlock(TactileProcessor* processor,
+                         PostProcessor* post_processor, const float* input,
+                         int b, int output_frames, float* output) {
+  TactileProcessorProcessSamples(processor, input + kBlockSize * b, output);
+  PostProcessorProcessSamples(post_processor, output, output_frames);
+}
+
+/* After seeking, output matches that of the first pass exactly. */
+static void TestSeek(int enable_silence_gating) {
+  printf("TestSeek(%d)\n", enable_silence_gating);
+  TactileProcessorParams params;
+  TactileProcessorSetDefaultParams(&params);
+  params.frontend_params.block_size = kBlockSize;
+  params.decimation_factor = 4;
+  params.enable_silence_gating = enable_silence_gating;
+  params.silence_hold_s = 0.1f;
+  TactileProcessor* processor = CHECK_NOTNULL(TactileProcessorMake(&params));
+  PostProcessorParams post_processor_params;
+  PostProcessorSetDefaultParams(&post_processor_params);
+  PostProcessor post_processor;
+  CHECK(PostProcessorInit(&post_processor, &post_processor_params,
+                          TactileProcessorOutputSampleRateHz(&params),
+                          kTactileProcessorNumTactors));
+  CheckpointIndex* index =
+      CHECK_NOTNULL(CheckpointIndexMake(processor, kIntervalBlocks));
+
+  float* input = MakeInput();
+  const int output_frames = kBlockSize / params.decimation_factor;
+  const int output_size = kTactileProcessorNumTactors * output_frames;
+  float* expected = (float*)CHECK_NOTNULL(
+      malloc(sizeof(float) * output_size * kNumBlocks));
+  float* actual = (float*)CHECK_NOTNULL(malloc(sizeof(float) * output_size));
+
+  /* First pass, recording checkpoints. */
+  int b;
+  for (b = 0; b < kNumBlocks; ++b) {
+    CHECK(CheckpointIndexRecord(index, b, processor, &post_processor) ==
+          (b % kIntervalBlocks == 0));
+    ProcessBlock(processor, &post_processor, input, b, output_frames,
+                 expected + output_size * b);
+  }
+  CHECK(index->num_checkpoints == kNumBlocks / kIntervalBlocks);
+  /* Recording again, e.g. on a second pass, does nothing. */
+  CHECK(!CheckpointIndexRecord(index, 0, processor, &post_processor));
+
+  /* Seek back and forth, including into and out of the silent gap. */
+  const int kTargets[] = {0, 120, 37, 399, 200, 50, 160, 249, 300};
+  int i;
+  for (i = 0; i < (int)(sizeof(kTargets) / sizeof(*kTargets)); ++i) {
+    const int target = kTargets[i];
+    b = CheckpointIndexRestore(index, target, processor, &post_processor);
+    CHECK(b == (target / kIntervalBlocks) * kIntervalBlocks);
+    for (; b < target; ++b) {
+      ProcessBlock(processor, &post_processor, input, b, output_frames,
+                   actual);
+    }
+    /* Play a few blocks from the target. */
+    for (; b < target + 30 && b < kNumBlocks; ++b) {
+      ProcessBlock(processor, &post_processor, input, b, output_frames,
+                   actual);
+      CHECK(!memcmp(actual, expected + output_size * b,
+                    sizeof(float) * output_size));
+    }
+  }
+
+  CHECK(CheckpointIndexRestore(index, -1, processor, &post_processor) == -1);
+
+  free(actual);
+  free(expected);
+  free(input);
+  CheckpointIndexFree(index);
+  TactileProcessorFree(processor);
+}
+
+int main(int argc, char** argv) {
+  srand(0);
+  TestSeek(0);
+  TestSeek(1);
+
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
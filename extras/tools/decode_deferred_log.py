@@ -0,0 +1,199 @@
+# Copyright 2022 Google LLC
+#
+# Licensed under the Apache License, Version 2.0 (the "License"); you may not
+# use this file except in compliance with the License. You may obtain a copy of
+# the License at
+#
+#     https://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+# WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+# License for the specific language governing permissions and limitations under
+# the License.
+
+"""Script to decode DeferredLog records from a device serial stream.
+
+Use: python3 decode_deferred_log.py --elf=firmware.elf [--ticks_per_s=64e6]
+         capture.bin
+
+DeferredLog (src/cpp/deferred_log.h) sends log records in binary, with format
+strings referenced by their address in flash. This script looks up the format
+strings in the firmware's ELF file, which must be from the same build as the
+running firmware, and prints the formatted messages with timestamps in seconds.
+The input may be a capture file or the serial device itself, e.g.
+
+  $ python3 decode_deferred_log.py --elf=firmware.elf /dev/ttyACM0
+
+Text written to the same port with Serial.print() is passed through as is.
+"""
+
+import re
+import struct
+import sys
+from typing import BinaryIO, Dict, Iterator, List, Optional, Sequence
+
+LEVEL_NAMES = ('D', 'I', 'W', 'E')
+# Matches a printf conversion, capturing flags/width/precision and the type.
+CONVERSION = re.compile(
+    r'%([-+ #0]*\d*(?:\.\d+)?)(?:hh|h|ll|l|z|j|t)?([diouxXeEfgGc%])')
+
+
+class ElfStrings:
+  """Reads null-terminated strings by address from a 32-bit ELF file."""
+
+  def __init__(self, filename: str):
+    with open(filename, 'rb') as f:
+      self._data = f.read()
+    if self._data[:5] != b'\x7fELF\x01':
+      raise ValueError(f'"{filename}" is not a 32-bit ELF file.')
+    e_shoff, = struct.unpack_from('<I', self._data, 0x20)
+    e_shentsize, e_shnum = struct.unpack_from('<HH', self._data, 0x2e)
+    # Sections of type PROGBITS with the ALLOC flag, as (addr, offset, size).
+    self._sections = []
+    for i in range(e_shnum):
+      (_, sh_type, sh_flags, sh_addr, sh_offset,
+       sh_size) = struct.unpack_from('<6I', self._data,
+                                     e_shoff + i * e_shentsize)
+      if sh_type == 1 and sh_flags & 2 and sh_size > 0:
+        self._sections.append((sh_addr, sh_offset, sh_size))
+    self._cache: Dict[int, Optional[str]] = {}
+
+  def lookup(self, address: int) -> Optional[str]:
+    """Gets the string at `address`, or None if not found."""
+    if address not in self._cache:
+      self._cache[address] = None
+      for sh_addr, sh_offset, sh_size in self._sections:
+        if sh_addr <= address < sh_addr + sh_size:
+          start = sh_offset + address - sh_addr
+          end = self._data.find(b'\x00', start, sh_offset + sh_size)
+          if end >= 0:
+            self._cache[address] = self._data[start:end].decode(
+                errors='replace')
+          break
+    return self._cache[address]
+
+
+def cobs_decode(encoded: bytes) -> Optional[bytes]:
+  """Decodes a COBS frame without delimiter, or returns None if invalid."""
+  decoded = bytearray()
+  i = 0
+  while i < len(encoded):
+    code = encoded[i]
+    if code == 0 or i + code > len(encoded):
+      return None
+    decoded += encoded[i + 1:i + code]
+    i += code
+    if code < 0xff and i < len(encoded):
+      decoded.append(0)
+  return bytes(decoded)
+
+
+def format_message(fmt: str, args: List[int]) -> str:
+  """Formats printf-style `fmt` with 32-bit argument words `args`."""
+  args = list(args)
+
+  def convert(match: re.Match) -> str:
+    spec, kind = match.groups()
+    if kind == '%':
+      return '%'
+    if not args:
+      return '<missing>'
+    word = args.pop(0)
+    if kind in 'eEfgG':
+      value = struct.unpack('<f', struct.pack('<I', word))[0]
+    elif kind in 'di':
+      value = word - (1 << 32) if word & 0x80000000 else word
+    else:
+      value = word
+    return ('%' + spec + kind) % value
+
+  return CONVERSION.sub(convert, fmt)
+
+
+class Decoder:
+  """Decodes frames and prints messages."""
+
+  def __init__(self, strings: ElfStrings, ticks_per_s: float):
+    self._strings = strings
+    self._ticks_per_s = ticks_per_s
+    self._last_ticks: Optional[int] = None
+    self._elapsed_ticks = 0
+
+  def _seconds(self, ticks: int) -> float:
+    """Converts a 32-bit timestamp to seconds, unwrapping overflow."""
+    if self._last_ticks is not None:
+      self._elapsed_ticks += (ticks - self._last_ticks) & 0xffffffff
+    self._last_ticks = ticks
+    return self._elapsed_ticks / self._ticks_per_s
+
+  def decode_record(self, record: bytes) -> Optional[str]:
+    """Decodes a record, or returns None if it isn't a valid record."""
+    if len(record) < 10:
+      return None
+    address, ticks, level, num_args = struct.unpack_from('<IIBB', record)
+    if (level >= len(LEVEL_NAMES) or len(record) != 10 + 4 * num_args):
+      return None
+    args = list(struct.unpack_from(f'<{num_args}I', record, 10))
+    if address == 0:
+      message = f'Dropped {args[0] if args else 0} log records.'
+    else:
+      fmt = self._strings.lookup(address)
+      if fmt is None:
+        return None
+      message = format_message(fmt, args)
+    return f'{self._seconds(ticks):12.6f} {LEVEL_NAMES[level]} {message}'
+
+  def decode_chunk(self, chunk: bytes) -> Optional[str]:
+    """Decodes a chunk between zero bytes, either a frame or plain text."""
+    record = cobs_decode(chunk)
+    line = self.decode_record(record) if record is not None else None
+    if line is None:
+      text = chunk.decode(errors='replace').strip()
+      return text or None
+    return line
+
+
+def read_chunks(f: BinaryIO) -> Iterator[bytes]:
+  """Reads `f` incrementally as chunks delimited by zero bytes."""
+  pending = b''
+  while True:
+    data = f.read1(4096) if hasattr(f, 'read1') else f.read(4096)
+    if not data:
+      break
+    parts = (pending + data).split(b'\x00')
+    pending = parts.pop()
+    for part in parts:
+      if part:
+        yield part
+  if pending:
+    yield pending
+
+
+def main(argv: Sequence[str]) -> int:
+  elf_filename = None
+  ticks_per_s = 64e6  # nRF52 CPU clock, the rate of ProfilerGetTicks().
+  filenames = []
+  for arg in argv[1:]:
+    if arg.startswith('--elf='):
+      elf_filename = arg.split('=', 1)[1]
+    elif arg.startswith('--ticks_per_s='):
+      ticks_per_s = float(arg.split('=', 1)[1])
+    else:
+      filenames.append(arg)
+
+  if elf_filename is None or len(filenames) != 1:
+    print(__doc__)
+    return 1
+
+  decoder = Decoder(ElfStrings(elf_filename), ticks_per_s)
+  with open(filenames[0], 'rb') as f:
+    for chunk in read_chunks(f):
+      line = decoder.decode_chunk(chunk)
+      if line is not None:
+        print(line, flush=True)
+  return 0
+
+
+if __name__ == '__main__':
+  sys.exit(main(sys.argv))
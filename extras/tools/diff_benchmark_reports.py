@@ -0,0 +1,98 @@
+# Copyright 2022 Google LLC
+#
+# Licensed under the Apache License, Version 2.0 (the "License"); you may not
+# use this file except in compliance with the License. You may obtain a copy of
+# the License at
+#
+#     https://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+# WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+# License for the specific language governing permissions and limitations under
+# the License.
+
+"""Script to compare two on-target DSP benchmark reports.
+
+Use: python3 diff_benchmark_reports.py [--threshold=5] before.txt after.txt
+
+The reports are serial captures of extras/ses_apps/dsp_benchmark_app, e.g.
+from building the app at two commits and running
+
+  $ cat /dev/ttyACM0 > before.txt
+
+Lines other than the report's CSV lines, like boot messages, are ignored. The
+script prints for each kernel the min cycles in both reports and the relative
+change. Kernels whose min cycles grew by more than the threshold percentage are
+marked as regressions, and then the script exits with status 1, so it can gate
+a change.
+"""
+
+import sys
+from typing import Dict, Sequence, Tuple
+
+HEADER = 'kernel,variant,runs,min_cycles,mean_cycles,max_cycles'
+
+
+def read_report(filename: str) -> Dict[Tuple[str, str], int]:
+  """Reads a report as a dict of (kernel, variant) -> min cycles."""
+  results = {}
+  in_report = False
+  with open(filename, 'rt', errors='replace') as f:
+    for line in f:
+      line = line.strip()
+      if line == HEADER:
+        in_report = True
+        results = {}  # Keep only the last report in the capture.
+      elif line == 'done':
+        in_report = False
+      elif in_report:
+        fields = line.split(',')
+        if len(fields) == 6 and fields[3].isdigit():
+          results[(fields[0], fields[1])] = int(fields[3])
+  if not results:
+    print(f'No benchmark report found in "{filename}".')
+    sys.exit(1)
+  return results
+
+
+def main(argv: Sequence[str]) -> int:
+  threshold_percent = 5.0
+  args = []
+  for arg in argv[1:]:
+    if arg.startswith('--threshold='):
+      threshold_percent = float(arg.split('=', 1)[1])
+    else:
+      args.append(arg)
+  if len(args) != 2:
+    print('Use: python3 diff_benchmark_reports.py [--threshold=5] '
+          'before.txt after.txt')
+    return 1
+
+  before = read_report(args[0])
+  after = read_report(args[1])
+
+  print('%-36s %10s %10s %8s' % ('kernel', 'before', 'after', 'change'))
+  num_regressions = 0
+  for key in sorted(set(before) | set(after)):
+    name = '/'.join(key)
+    if key not in before or key not in after:
+      print('%-36s %10s %10s %8s' % (name, before.get(key, '-'),
+                                      after.get(key, '-'), 'n/a'))
+      continue
+    change_percent = 100.0 * (after[key] - before[key]) / max(before[key], 1)
+    regressed = change_percent > threshold_percent
+    num_regressions += regressed
+    print('%-36s %10d %10d %+7.1f%%%s' % (name, before[key], after[key],
+                                          change_percent,
+                                          '  REGRESSION' if regressed else ''))
+
+  if num_regressions:
+    print(f'\n{num_regressions} kernel(s) regressed by more than '
+          f'{threshold_percent:g}%.')
+    return 1
+  return 0
+
+
+if __name__ == '__main__':
+  sys.exit(main(sys.argv))
@@ -0,0 +1,291 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#if !defined(_POSIX_C_SOURCE) || _POSIX_C_SOURCE < 200112L
+#undef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200112L /* For mmap(). */
+#endif
+
+#include "extras/tools/frame_store.h"
+
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static const char kFrameStoreMagic[8] = {'F', 'R', 'S', 'T', 'O', 'R', 'E',
+                                         '1'};
+/* Columns are aligned to this many bytes. */
+#define kFrameStoreAlignment 64
+
+typedef struct {
+  char magic[8];
+  int32_t num_channels;
+  int32_t label_size;
+  int64_t num_frames;
+  int64_t num_utterances;
+  int64_t labels_offset;
+  int64_t utterance_offsets_offset;
+  int64_t metadata_offset;
+  int64_t metadata_size;
+} FrameStoreHeader;
+
+FrameStoreWriter* FrameStoreWriterOpen(const char* file_name,
+                                       int num_channels) {
+  if (num_channels <= 0) {
+    fprintf(stderr, "Error: num_channels must be positive.\n");
+    return NULL;
+  }
+  FrameStoreWriter* writer =
+      (FrameStoreWriter*)malloc(sizeof(FrameStoreWriter));
+  if (writer == NULL) {
+    fprintf(stderr, "Error: Memory allocation failed.\n");
+    return NULL;
+  }
+  writer->num_channels = num_channels;
+  writer->num_frames = 0;
+  writer->labels = NULL;
+  writer->labels_capacity = 0;
+  writer->num_utterances = 0;
+  writer->utterances_capacity = 16;
+  writer->utterance_offsets =
+      (int64_t*)malloc(sizeof(int64_t) * (writer->utterances_capacity + 1));
+  writer->file = fopen(file_name, "wb");
+  if (writer->utterance_offsets == NULL || writer->file == NULL) {
+    fprintf(stderr, "Error: Failed to create \"%s\".\n", file_name);
+    goto fail;
+  }
+  writer->utterance_offsets[0] = 0;
+
+  /* Reserve space for the header, written on close. */
+  char header[sizeof(FrameStoreHeader)];
+  memset(header, 0, sizeof(header));
+  if (fwrite(header, sizeof(header), 1, writer->file) != 1) { goto fail; }
+  return writer;
+
+fail:
+  if (writer->file != NULL) { fclose(writer->file); }
+  free(writer->utterance_offsets);
+  free(writer);
+  return NULL;
+}
+
+int FrameStoreWriterAppend(FrameStoreWriter* writer,
+                           const float* frames, const char* labels,
+                           int num_frames) {
+  if (num_frames < 0) { return 0; }
+  if (writer->num_frames + num_frames > writer->labels_capacity) {
+    int64_t capacity = 2 * writer->labels_capacity;
+    if (capacity < writer->num_frames + num_frames) {
+      capacity = writer->num_frames + num_frames;
+    }
+    char* new_labels = (char*)realloc(
+        writer->labels, (size_t)(kFrameStoreLabelSize * capacity));
+    if (new_labels == NULL) { goto fail; }
+    writer->labels = new_labels;
+    writer->labels_capacity = capacity;
+  }
+  if (writer->num_utterances == writer->utterances_capacity) {
+    const int64_t capacity = 2 * writer->utterances_capacity;
+    int64_t* new_offsets = (int64_t*)realloc(
+        writer->utterance_offsets, sizeof(int64_t) * (size_t)(capacity + 1));
+    if (new_offsets == NULL) { goto fail; }
+    writer->utterance_offsets = new_offsets;
+    writer->utterances_capacity = capacity;
+  }
+
+  if (fwrite(frames, sizeof(float) * writer->num_channels, num_frames,
+             writer->file) != (size_t)num_frames) {
+    fprintf(stderr, "Error: Failed to write frames.\n");
+    return 0;
+  }
+  char* dest = writer->labels + kFrameStoreLabelSize * writer->num_frames;
+  const size_t labels_size = (size_t)kFrameStoreLabelSize * num_frames;
+  if (labels != NULL) {
+    memcpy(dest, labels, labels_size);
+  } else {
+    memset(dest, 0, labels_size);
+  }
+  writer->num_frames += num_frames;
+  writer->utterance_offsets[++writer->num_utterances] = writer->num_frames;
+  return 1;
+
+fail:
+  fprintf(stderr, "Error: Memory allocation failed.\n");
+  return 0;
+}
+
+/* Writes zeros to align the file position to kFrameStoreAlignment, and
+ * returns the aligned position.
+ */
+static int64_t AlignFile(FILE* f) {
+  static const char kZeros[kFrameStoreAlignment] = {0};
+  const int64_t position = ftell(f);
+  const int64_t padding =
+      (kFrameStoreAlignment - position % kFrameStoreAlignment) %
+      kFrameStoreAlignment;
+  fwrite(kZeros, 1, (size_t)padding, f);
+  return position + padding;
+}
+
+int FrameStoreWriterClose(FrameStoreWriter* writer, const char* metadata) {
+  if (writer == NULL) { return 0; }
+  FILE* f = writer->file;
+  if (metadata == NULL) { metadata = ""; }
+
+  FrameStoreHeader header;
+  memcpy(header.magic, kFrameStoreMagic, sizeof(header.magic));
+  header.num_channels = writer->num_channels;
+  header.label_size = kFrameStoreLabelSize;
+  header.num_frames = writer->num_frames;
+  header.num_utterances = writer->num_utterances;
+  header.labels_offset = AlignFile(f);
+  fwrite(writer->labels, kFrameStoreLabelSize, (size_t)writer->num_frames, f);
+  header.utterance_offsets_offset = AlignFile(f);
+  fwrite(writer->utterance_offsets, sizeof(int64_t),
+         (size_t)(writer->num_utterances + 1), f);
+  header.metadata_offset = AlignFile(f);
+  header.metadata_size = strlen(metadata);
+  fwrite(metadata, 1, (size_t)header.metadata_size + 1, f);
+
+  fseek(f, 0, SEEK_SET);
+  fwrite(&header, sizeof(header), 1, f);
+  int success = !ferror(f);
+  if (fclose(f) != 0) { success = 0; }
+  if (!success) {
+    fprintf(stderr, "Error: Failed to write frame store.\n");
+  }
+
+  free(writer->utterance_offsets);
+  free(writer->labels);
+  free(writer);
+  return success;
+}
+
+/* Checks that [offset, offset + size) is within the mapping. */
+static int InMap(const FrameStore* store, int64_t offset, int64_t size) {
+  return 0 <= offset && 0 <= size &&
+      (uint64_t)offset + (uint64_t)size <= store->map_size;
+}
+
+FrameStore* FrameStoreOpen(const char* file_name) {
+  FrameStore* store = (FrameStore*)malloc(sizeof(FrameStore));
+  if (store == NULL) {
+    fprintf(stderr, "Error: Memory allocation failed.\n");
+    return NULL;
+  }
+  store->map = NULL;
+
+  const int fd = open(file_name, O_RDONLY);
+  struct stat st;
+  if (fd == -1 || fstat(fd, &st) != 0 ||
+      st.st_size < (off_t)sizeof(FrameStoreHeader)) {
+    fprintf(stderr, "Error: Failed to open \"%s\".\n", file_name);
+    if (fd != -1) { close(fd); }
+    free(store);
+    return NULL;
+  }
+  store->map_size = (size_t)st.st_size;
+  store->map = mmap(NULL, store->map_size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (store->map == MAP_FAILED) {
+    fprintf(stderr, "Error: Failed to map \"%s\".\n", file_name);
+    free(store);
+    return NULL;
+  }
+
+  FrameStoreHeader header;
+  memcpy(&header, store->map, sizeof(header));
+  const char* bytes = (const char*)store->map;
+  store->num_channels = header.num_channels;
+  store->num_frames = header.num_frames;
+  store->num_utterances = header.num_utterances;
+  store->frames = (const float*)(bytes + sizeof(FrameStoreHeader));
+  store->labels = bytes + header.labels_offset;
+  store->utterance_offsets =
+      (const int64_t*)(bytes + header.utterance_offsets_offset);
+  store->metadata = bytes + header.metadata_offset;
+  store->metadata_size = (size_t)header.metadata_size;
+
+  if (memcmp(header.magic, kFrameStoreMagic, sizeof(header.magic)) ||
+      header.num_channels <= 0 || header.num_frames < 0 ||
+      header.num_utterances < 0 ||
+      header.label_size != kFrameStoreLabelSize ||
+      !InMap(store, sizeof(FrameStoreHeader),
+             (int64_t)sizeof(float) * header.num_channels *
+                 header.num_frames) ||
+      !InMap(store, header.labels_offset,
+             kFrameStoreLabelSize * header.num_frames) ||
+      !InMap(store, header.utterance_offsets_offset,
+             (int64_t)sizeof(int64_t) * (header.num_utterances + 1)) ||
+      !InMap(store, header.metadata_offset, header.metadata_size + 1) ||
+      store->utterance_offsets[header.num_utterances] !=
+          header.num_frames) {
+    fprintf(stderr, "Error: \"%s\" is not a valid frame store.\n", file_name);
+    FrameStoreClose(store);
+    return NULL;
+  }
+  return store;
+}
+
+void FrameStoreClose(FrameStore* store) {
+  if (store == NULL) { return; }
+  munmap(store->map, store->map_size);
+  free(store);
+}
+
+int64_t FrameStoreFindUtterance(const FrameStore* store, int64_t frame) {
+  /* Binary search for the last utterance starting at or before `frame`. */
+  int64_t lo = 0;
+  int64_t hi = store->num_utterances;
+  while (hi - lo > 1) {
+    const int64_t mid = lo + (hi - lo) / 2;
+    if (store->utterance_offsets[mid] <= frame) {
+      lo = mid;
+    } else {
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
+void FrameStoreGather(const FrameStore* store, const int64_t* indices,
+                      int num_indices, int num_context_frames, float* output) {
+  const int num_channels = store->num_channels;
+  const size_t frame_bytes = sizeof(float) * num_channels;
+  int i;
+  for (i = 0; i < num_indices; ++i) {
+    const int64_t index = indices[i];
+    int64_t start = index - num_context_frames;
+    int64_t utterance_start = start;
+    if (num_context_frames > 0) {
+      utterance_start = store->utterance_offsets[
+          FrameStoreFindUtterance(store, index)];
+    }
+    for (; start <= index; ++start, output += num_channels) {
+      const int64_t frame = (start < utterance_start) ? utterance_start : start;
+      memcpy(output, store->frames + num_channels * frame, frame_bytes);
+    }
+  }
+}
+
+void FrameStoreShardRange(const FrameStore* store, int shard, int num_shards,
+                          int64_t* begin, int64_t* end) {
+  const int64_t num_utterances = store->num_utterances;
+  *begin = store->utterance_offsets[num_utterances * shard / num_shards];
+  *end = store->utterance_offsets[num_utterances * (shard + 1) / num_shards];
+}
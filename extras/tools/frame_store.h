@@ -0,0 +1,142 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ *
+ * Memory-mapped on-disk store of frontend frames, labels, and metadata.
+ *
+ * A frame store is a single file holding a corpus of CarlFrontend frames in
+ * columns, so that training and evaluation can map it and read minibatches
+ * directly instead of loading per-utterance arrays:
+ *
+ *   Offset                    Contents
+ *   0                         64-byte header (see below).
+ *   64                        frames, float32 [num_frames][num_channels].
+ *   labels_offset             labels, char [num_frames][kFrameStoreLabelSize],
+ *                             null padded, e.g. "ae", or "" if unlabeled.
+ *   utterance_offsets_offset  int64 [num_utterances + 1]. The frames of
+ *                             utterance u are utterance_offsets[u] to
+ *                             utterance_offsets[u + 1].
+ *   metadata_offset           Metadata text (e.g. JSON), null terminated.
+ *
+ * Each column starts on a 64-byte boundary. Values are in host byte order,
+ * which in practice is little endian.
+ *
+ * `FrameStoreWriter` writes a store one utterance at a time, streaming the
+ * frames to disk. `FrameStoreOpen()` maps a store read only, so that several
+ * processes can share it through the page cache. For training,
+ * `FrameStoreGather()` copies a random-access minibatch of frames with left
+ * context, and `FrameStoreShardRange()` splits the store between processes
+ * at utterance boundaries.
+ *
+ * Example use:
+ *   FrameStoreWriter* writer = FrameStoreWriterOpen("train.fstore", 56);
+ *   FrameStoreWriterAppend(writer, frames, labels, num_frames);  // Repeat.
+ *   FrameStoreWriterClose(writer, "{\"block_size\": 64}");
+ *
+ *   FrameStore* store = FrameStoreOpen("train.fstore");
+ *   FrameStoreGather(store, indices, batch_size, 2, batch);
+ *   FrameStoreClose(store);
+ */
+
+#ifndef AUDIO_TO_TACTILE_EXTRAS_TOOLS_FRAME_STORE_H_
+#define AUDIO_TO_TACTILE_EXTRAS_TOOLS_FRAME_STORE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Size in bytes of each label, including null padding. */
+#define kFrameStoreLabelSize 8
+
+typedef struct {
+  FILE* file;
+  int num_channels;
+  int64_t num_frames;
+  /* Labels and utterance offsets are buffered and written on close. */
+  char* labels;
+  int64_t labels_capacity;
+  int64_t* utterance_offsets;
+  int64_t num_utterances;
+  int64_t utterances_capacity;
+} FrameStoreWriter;
+
+/* Creates frame store file `file_name` for frames with `num_channels`
+ * channels. Returns NULL on failure.
+ */
+FrameStoreWriter* FrameStoreWriterOpen(const char* file_name,
+                                       int num_channels);
+
+/* Appends an utterance of `num_frames` frames. `frames` has
+ * `num_frames * num_channels` elements. `labels` has `num_frames` labels of
+ * kFrameStoreLabelSize bytes, or is NULL if unlabeled. Returns 1 on success.
+ */
+int /*bool*/ FrameStoreWriterAppend(FrameStoreWriter* writer,
+                                    const float* frames, const char* labels,
+                                    int num_frames);
+
+/* Writes the labels, utterance offsets, and `metadata` (may be NULL), then
+ * closes the file and frees the writer. Returns 1 on success.
+ */
+int /*bool*/ FrameStoreWriterClose(FrameStoreWriter* writer,
+                                   const char* metadata);
+
+typedef struct {
+  int num_channels;
+  int64_t num_frames;
+  int64_t num_utterances;
+  /* Columns, pointing into the read-only mapping. */
+  const float* frames;
+  const char* labels;
+  const int64_t* utterance_offsets;
+  const char* metadata;
+  size_t metadata_size;
+
+  void* map;
+  size_t map_size;
+} FrameStore;
+
+/* Opens and maps frame store file `file_name`. The caller should close it
+ * when done with `FrameStoreClose`. Returns NULL on failure.
+ */
+FrameStore* FrameStoreOpen(const char* file_name);
+
+/* Unmaps and frees a FrameStore. */
+void FrameStoreClose(FrameStore* store);
+
+/* Returns the index of the utterance containing frame `frame`. */
+int64_t FrameStoreFindUtterance(const FrameStore* store, int64_t frame);
+
+/* Copies a minibatch of `num_indices` examples. Example i is frames
+ * `indices[i] - num_context_frames` through `indices[i]`, where frames before
+ * the start of the utterance repeat its first frame. `output` has
+ * `num_indices * (num_context_frames + 1) * num_channels` elements.
+ */
+void FrameStoreGather(const FrameStore* store, const int64_t* indices,
+                      int num_indices, int num_context_frames, float* output);
+
+/* Gets the frame range [*begin, *end) of shard `shard` out of `num_shards`,
+ * splitting utterances as evenly as possible.
+ */
+void FrameStoreShardRange(const FrameStore* store, int shard, int num_shards,
+                          int64_t* begin, int64_t* end);
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif
+#endif /* AUDIO_TO_TACTILE_EXTRAS_TOOLS_FRAME_STORE_H_ */
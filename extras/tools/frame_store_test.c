@@ -0,0 +1,179 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "extras/tools/frame_store.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "src/dsp/logging.h"
+
+#define kNumChannels 5
+#define kNumUtterances 3
+
+static const int kUtteranceFrames[kNumUtterances] = {7, 0, 12};
+
+/* Value of channel c of frame `frame` in the test store. */
+static float FrameValue(int64_t frame, int c) {
+  return 100.0f * frame + c;
+}
+
+/* Writes a test store and returns its file name. */
+static const char* WriteTestStore(void) {
+  const char* file_name = CHECK_NOTNULL(tmpnam(NULL));
+  FrameStoreWriter* writer =
+      CHECK_NOTNULL(FrameStoreWriterOpen(file_name, kNumChannels));
+  float frames[12 * kNumChannels];
+  char labels[12 * kFrameStoreLabelSize];
+  int64_t offset = 0;
+  int u;
+  for (u = 0; u < kNumUtterances; ++u) {
+    int i;
+    for (i = 0; i < kUtteranceFrames[u]; ++i) {
+      int c;
+      for (c = 0; c < kNumChannels; ++c) {
+        frames[kNumChannels * i + c] = FrameValue(offset + i, c);
+      }
+      memset(labels + kFrameStoreLabelSize * i, 0, kFrameStoreLabelSize);
+      strcpy(labels + kFrameStoreLabelSize * i, (i < 3) ? "sil" : "ae");
+    }
+    /* The first utterance is unlabeled. */
+    CHECK(FrameStoreWriterAppend(writer, frames, (u == 0) ? NULL : labels,
+                                 kUtteranceFrames[u]));
+    offset += kUtteranceFrames[u];
+  }
+  CHECK(FrameStoreWriterClose(writer, "{\"block_size\": 64}"));
+  return file_name;
+}
+
+/* Written frames, labels, offsets, and metadata read back from the mapping. */
+static void TestRoundTrip(void) {
+  puts("TestRoundTrip");
+  const char* file_name = WriteTestStore();
+  FrameStore* store = CHECK_NOTNULL(FrameStoreOpen(file_name));
+
+  CHECK(store->num_channels == kNumChannels);
+  CHECK(store->num_frames == 19);
+  CHECK(store->num_utterances == kNumUtterances);
+  CHECK(store->utterance_offsets[0] == 0);
+  CHECK(store->utterance_offsets[1] == 7);
+  CHECK(store->utterance_offsets[2] == 7);
+  CHECK(store->utterance_offsets[3] == 19);
+  CHECK(!strcmp(store->metadata, "{\"block_size\": 64}"));
+  CHECK(store->metadata_size == strlen(store->metadata));
+  /* Columns are 64-byte aligned. */
+  CHECK(((const char*)store->labels - (const char*)store->map) % 64 == 0);
+  CHECK(((const char*)store->utterance_offsets -
+         (const char*)store->map) % 64 == 0);
+
+  int64_t i;
+  for (i = 0; i < store->num_frames; ++i) {
+    int c;
+    for (c = 0; c < kNumChannels; ++c) {
+      CHECK(store->frames[kNumChannels * i + c] == FrameValue(i, c));
+    }
+    const char* label = store->labels + kFrameStoreLabelSize * i;
+    if (i < 7) {
+      CHECK(!strcmp(label, ""));
+    } else {
+      CHECK(!strcmp(label, (i < 10) ? "sil" : "ae"));
+    }
+  }
+
+  FrameStoreClose(store);
+  remove(file_name);
+}
+
+/* Minibatches have left context, clamped to the start of the utterance. */
+static void TestGather(void) {
+  puts("TestGather");
+  const char* file_name = WriteTestStore();
+  FrameStore* store = CHECK_NOTNULL(FrameStoreOpen(file_name));
+
+  CHECK(FrameStoreFindUtterance(store, 0) == 0);
+  CHECK(FrameStoreFindUtterance(store, 6) == 0);
+  CHECK(FrameStoreFindUtterance(store, 7) == 2);  /* Utterance 1 is empty. */
+  CHECK(FrameStoreFindUtterance(store, 18) == 2);
+
+  const int64_t kIndices[4] = {18, 7, 1, 8};
+  const int kNumContextFrames = 2;
+  const int64_t kExpected[4][3] = {{16, 17, 18}, {7, 7, 7}, {0, 0, 1},
+                                   {7, 7, 8}};
+  float batch[4 * 3 * kNumChannels];
+  FrameStoreGather(store, kIndices, 4, kNumContextFrames, batch);
+  int i;
+  for (i = 0; i < 4; ++i) {
+    int j;
+    for (j = 0; j < 3; ++j) {
+      int c;
+      for (c = 0; c < kNumChannels; ++c) {
+        CHECK(batch[(3 * i + j) * kNumChannels + c] ==
+              FrameValue(kExpected[i][j], c));
+      }
+    }
+  }
+
+  FrameStoreClose(store);
+  remove(file_name);
+}
+
+/* Shards partition the frames at utterance boundaries. */
+static void TestShardRange(void) {
+  puts("TestShardRange");
+  const char* file_name = WriteTestStore();
+  FrameStore* store = CHECK_NOTNULL(FrameStoreOpen(file_name));
+
+  int num_shards;
+  for (num_shards = 1; num_shards <= 4; ++num_shards) {
+    int64_t expected_begin = 0;
+    int shard;
+    for (shard = 0; shard < num_shards; ++shard) {
+      int64_t begin;
+      int64_t end;
+      FrameStoreShardRange(store, shard, num_shards, &begin, &end);
+      CHECK(begin == expected_begin);
+      CHECK(begin <= end);
+      CHECK(end == 0 || end == 7 || end == 19);
+      expected_begin = end;
+    }
+    CHECK(expected_begin == store->num_frames);
+  }
+
+  FrameStoreClose(store);
+  remove(file_name);
+}
+
+static void TestInvalidFile(void) {
+  puts("TestInvalidFile");
+  const char* file_name = CHECK_NOTNULL(tmpnam(NULL));
+  FILE* f = CHECK_NOTNULL(fopen(file_name, "wb"));
+  char bytes[100];
+  memset(bytes, 'x', sizeof(bytes));
+  fwrite(bytes, 1, sizeof(bytes), f);
+  fclose(f);
+  CHECK(FrameStoreOpen(file_name) == NULL);
+  remove(file_name);
+  CHECK(FrameStoreOpen(file_name) == NULL);  /* Nonexistent. */
+}
+
+int main(int argc, char** argv) {
+  TestRoundTrip();
+  TestGather();
+  TestShardRange();
+  TestInvalidFile();
+
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
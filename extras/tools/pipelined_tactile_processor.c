@@ -0,0 +1,207 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "extras/tools/pipelined_tactile_processor.h"
+
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "extras/tools/trace_event.h"
+
+/* Values of `pending_state`. */
+enum {
+  kPendingNone,
+  kPendingSilent,
+  kPendingSubmitted,
+};
+
+/* Wakes the worker thread. The mutex is held only briefly by either side. */
+static void WakeWorker(PipelinedTactileProcessor* pipelined) {
+  pthread_mutex_lock(&pipelined->mutex);
+  pthread_cond_signal(&pipelined->cond);
+  pthread_mutex_unlock(&pipelined->mutex);
+}
+
+static void* WorkerThread(void* arg) {
+  PipelinedTactileProcessor* pipelined = (PipelinedTactileProcessor*)arg;
+  int num_completed = 0;
+  for (;;) {
+    if (atomic_load_explicit(&pipelined->num_submitted,
+                             memory_order_acquire) != num_completed) {
+      TraceEventSetThreadName("pipeline_worker");
+      TRACE_EVENT_SCOPE("frontend");
+      TraceEventFlowEnd("frontend_job", num_completed + 1);
+      TactileProcessorProcessVowel(pipelined->processor, pipelined->job_input,
+                                   pipelined->job_vowel_hex_weights);
+      atomic_store_explicit(&pipelined->num_completed, ++num_completed,
+                            memory_order_release);
+      continue;
+    }
+
+    /* Wait for a block or stop. Checking under the mutex, which the caller
+     * holds to signal after submitting a block, avoids missing a wakeup.
+     */
+    pthread_mutex_lock(&pipelined->mutex);
+    int done = 0;
+    while (atomic_load(&pipelined->num_submitted) == num_completed) {
+      if (atomic_load(&pipelined->stopping)) {
+        done = 1;
+        break;
+      }
+      pthread_cond_wait(&pipelined->cond, &pipelined->mutex);
+    }
+    pthread_mutex_unlock(&pipelined->mutex);
+    if (done) { break; }
+  }
+  return NULL;
+}
+
+/* Waits until the worker has completed all submitted blocks. */
+static void JoinWorker(PipelinedTactileProcessor* pipelined) {
+  const int num_submitted =
+      atomic_load_explicit(&pipelined->num_submitted, memory_order_relaxed);
+  if (atomic_load_explicit(&pipelined->num_completed,
+                           memory_order_acquire) == num_submitted) {
+    return;
+  }
+  ++pipelined->num_late_joins;
+  TRACE_EVENT_SCOPE("wait_worker");
+  while (atomic_load_explicit(&pipelined->num_completed,
+                              memory_order_acquire) != num_submitted) {
+    sched_yield();
+  }
+}
+
+PipelinedTactileProcessor* PipelinedTactileProcessorMake(
+    TactileProcessorParams* params) {
+  PipelinedTactileProcessor* pipelined = (PipelinedTactileProcessor*)malloc(
+      sizeof(PipelinedTactileProcessor));
+  if (pipelined == NULL) {
+    fprintf(stderr, "Error: Memory allocation failed.\n");
+    return NULL;
+  }
+  pipelined->job_input = NULL;
+  pipelined->envelopes = NULL;
+  pipelined->pending_envelopes = NULL;
+
+  pipelined->processor = TactileProcessorMake(params);
+  if (pipelined->processor == NULL) { goto fail; }
+  const int block_size = params->frontend_params.block_size;
+  const int num_envelopes =
+      kEnveloperNumChannels * block_size / params->decimation_factor;
+  pipelined->job_input = (float*)malloc(sizeof(float) * block_size);
+  pipelined->envelopes = (float*)malloc(sizeof(float) * num_envelopes);
+  pipelined->pending_envelopes = (float*)malloc(sizeof(float) * num_envelopes);
+  if (pipelined->job_input == NULL || pipelined->envelopes == NULL ||
+      pipelined->pending_envelopes == NULL) {
+    fprintf(stderr, "Error: Memory allocation failed.\n");
+    goto fail;
+  }
+
+  atomic_init(&pipelined->num_submitted, 0);
+  atomic_init(&pipelined->num_completed, 0);
+  atomic_init(&pipelined->stopping, 0);
+  pipelined->pending_state = kPendingNone;
+  pipelined->num_late_joins = 0;
+
+  if (pthread_mutex_init(&pipelined->mutex, NULL) != 0) { goto fail; }
+  if (pthread_cond_init(&pipelined->cond, NULL) != 0) {
+    pthread_mutex_destroy(&pipelined->mutex);
+    goto fail;
+  }
+  if (pthread_create(&pipelined->thread, NULL, WorkerThread, pipelined) != 0) {
+    fprintf(stderr, "Error: Failed to create worker thread.\n");
+    pthread_cond_destroy(&pipelined->cond);
+    pthread_mutex_destroy(&pipelined->mutex);
+    goto fail;
+  }
+  return pipelined;
+
+fail:
+  TactileProcessorFree(pipelined->processor);
+  free(pipelined->pending_envelopes);
+  free(pipelined->envelopes);
+  free(pipelined->job_input);
+  free(pipelined);
+  return NULL;
+}
+
+void PipelinedTactileProcessorFree(PipelinedTactileProcessor* pipelined) {
+  if (pipelined == NULL) { return; }
+  atomic_store(&pipelined->stopping, 1);
+  WakeWorker(pipelined);
+  pthread_join(pipelined->thread, NULL);
+  pthread_cond_destroy(&pipelined->cond);
+  pthread_mutex_destroy(&pipelined->mutex);
+
+  TactileProcessorFree(pipelined->processor);
+  free(pipelined->pending_envelopes);
+  free(pipelined->envelopes);
+  free(pipelined->job_input);
+  free(pipelined);
+}
+
+void PipelinedTactileProcessorReset(PipelinedTactileProcessor* pipelined) {
+  JoinWorker(pipelined);
+  TactileProcessorReset(pipelined->processor);
+  pipelined->pending_state = kPendingNone;
+}
+
+void PipelinedTactileProcessorProcessSamples(
+    PipelinedTactileProcessor* pipelined, const float* input, float* output) {
+  TactileProcessor* processor = pipelined->processor;
+  const int block_size = CarlFrontendBlockSize(processor->frontend);
+
+  /* Run the Enveloper on the current block, while the worker may still be
+   * running the frontend on the previous block.
+   */
+  TactileProcessorTakeStagedTuning(processor);
+  TraceEventBegin("enveloper");
+  EnveloperProcessSamples(&processor->enveloper, input, block_size,
+                          pipelined->envelopes);
+  TraceEventEnd("enveloper");
+
+  /* Join the branches and write the output for the previous block. */
+  if (pipelined->pending_state == kPendingSubmitted) {
+    JoinWorker(pipelined);
+    TactileProcessorWriteOutputs(processor, pipelined->pending_envelopes,
+                                 pipelined->job_vowel_hex_weights, output,
+                                 kTactileProcessorNumTactors);
+  } else {
+    memset(output, 0, sizeof(float) * kTactileProcessorNumTactors *
+           (block_size / processor->decimation_factor));
+  }
+
+  /* Submit the current block to the worker, unless it is silent. */
+  if (TactileProcessorUpdateSilenceGate(processor, input,
+                                        pipelined->envelopes)) {
+    pipelined->pending_state = kPendingSilent;
+  } else {
+    memcpy(pipelined->job_input, input, sizeof(float) * block_size);
+    pipelined->pending_state = kPendingSubmitted;
+    const int num_submitted = atomic_load_explicit(
+        &pipelined->num_submitted, memory_order_relaxed) + 1;
+    TraceEventFlowStart("frontend_job", num_submitted);
+    atomic_store_explicit(&pipelined->num_submitted, num_submitted,
+                          memory_order_release);
+    WakeWorker(pipelined);
+  }
+
+  float* swap = pipelined->envelopes;
+  pipelined->envelopes = pipelined->pending_envelopes;
+  pipelined->pending_envelopes = swap;
+}
@@ -0,0 +1,125 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * Pipelined TactileProcessor, running the CARL frontend on a worker thread.
+ *
+ * `PipelinedTactileProcessor` splits TactileProcessor into two branches that
+ * run on separate cores. The calling thread (e.g. a PortAudio callback) runs
+ * the Enveloper, and a worker thread runs the CARL frontend and EmbedVowel,
+ * which are most of the cost. The branches are joined with one block of fixed
+ * latency: each call computes the envelopes for the current block, hands the
+ * block to the worker, and writes the output for the previous block, using
+ * the previous block's envelopes and the vowel weights the worker computed
+ * meanwhile. The output is exactly that of TactileProcessorProcessSamples()
+ * delayed by one block; the first block of output is zero.
+ *
+ * The handoff is lock free: the block is passed through buffers owned by one
+ * side at a time, with acquire/release counters of submitted and completed
+ * blocks. The worker normally finishes well within a block period, so the
+ * calling thread does not wait. If it hasn't finished, the calling thread
+ * spins until it has, counted in `num_late_joins`. The worker sleeps on a
+ * condition variable when idle; the mutex is held only briefly to wake it, as
+ * in async_wav_writer.c.
+ *
+ * Example use:
+ *   PipelinedTactileProcessor* pipelined =
+ *       PipelinedTactileProcessorMake(&params);
+ *   // In the audio thread, for each block.
+ *   PipelinedTactileProcessorProcessSamples(pipelined, input, output);
+ *   ...
+ *   PipelinedTactileProcessorFree(pipelined);
+ *
+ * While the pipeline is running, `processor` should not be used directly,
+ * except for staging tuning with TactileProcessorStageTuning(). Adaptive
+ * quality is not supported, since TactileProcessorUpdateLoad() could change
+ * the quality while the worker runs.
+ *
+ * NOTE: This library requires C11 (-std=c11) for <stdatomic.h>.
+ */
+
+#ifndef AUDIO_TO_TACTILE_EXTRAS_TOOLS_PIPELINED_TACTILE_PROCESSOR_H_
+#define AUDIO_TO_TACTILE_EXTRAS_TOOLS_PIPELINED_TACTILE_PROCESSOR_H_
+
+#include <pthread.h>
+#include <stdatomic.h>
+
+#include "src/tactile/tactile_processor.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Size in bytes to separate the handoff counters, so that they are on
+ * different cache lines and don't false share.
+ */
+#define kPipelinedCacheLineSize 64
+
+typedef struct {
+  TactileProcessor* processor;
+  /* Number of blocks submitted to the worker, written only by the caller. */
+  atomic_int num_submitted;
+  char padding1[kPipelinedCacheLineSize - sizeof(atomic_int)];
+  /* Number of blocks completed by the worker, written only by the worker. */
+  atomic_int num_completed;
+  char padding2[kPipelinedCacheLineSize - sizeof(atomic_int)];
+
+  /* Input block and resulting vowel hex weights for the worker. These are
+   * owned by the worker from submission until completion.
+   */
+  float* job_input;
+  float job_vowel_hex_weights[7];
+
+  /* Envelopes for the current block and the previous, pending block. */
+  float* envelopes;
+  float* pending_envelopes;
+  /* Whether the pending block has been submitted, is silent, or is absent. */
+  int pending_state;
+
+  /* Number of calls that waited for the worker, for diagnostics. */
+  int num_late_joins;
+
+  pthread_t thread;
+  pthread_mutex_t mutex;
+  pthread_cond_t cond;
+  atomic_int stopping;
+} PipelinedTactileProcessor;
+
+/* Makes a PipelinedTactileProcessor with a TactileProcessor for `params` and
+ * starts its worker thread. The caller should free it when done with
+ * `PipelinedTactileProcessorFree`. Returns NULL on failure.
+ */
+PipelinedTactileProcessor* PipelinedTactileProcessorMake(
+    TactileProcessorParams* params);
+
+/* Stops the worker thread and frees the PipelinedTactileProcessor, including
+ * its TactileProcessor.
+ */
+void PipelinedTactileProcessorFree(PipelinedTactileProcessor* pipelined);
+
+/* Waits for the worker and resets to initial state. */
+void PipelinedTactileProcessorReset(PipelinedTactileProcessor* pipelined);
+
+/* Processes one block in a streaming manner. `input` is an array of
+ * `block_size` elements and `output` is an array of
+ * `kTactileProcessorNumTactors * block_size / decimation_factor` elements, as
+ * for TactileProcessorProcessSamples(). The output is for the previous block.
+ */
+void PipelinedTactileProcessorProcessSamples(
+    PipelinedTactileProcessor* pipelined, const float* input, float* output);
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif
+#endif /* AUDIO_TO_TACTILE_EXTRAS_TOOLS_PIPELINED_TACTILE_PROCESSOR_H_ */
@@ -0,0 +1,108 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "extras/tools/pipelined_tactile_processor.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "src/dsp/logging.h"
+#include "src/dsp/math_constants.h"
+
+#define kBlockSize 64
+#define kNumBlocks 300
+
+/* Makes a test signal of noise and a tone, with a gap of silence. */
+static float* MakeInput(void) {
+  float* input = (float*)CHECK_NOTNULL(
+      malloc(sizeof(float) * kBlockSize * kNumBlocks));
+  int i;
+  for (i = 0; i < kBlockSize * kNumBlocks; ++i) {
+    const int block = i / kBlockSize;
+    if (100 <= block && block < 200) {
+      input[i] = 0.0f;
+    } else {
+      const float t = i / 16000.0f;
+      input[i] = 0.1f * ((float)rand() / RAND_MAX - 0.5f) +
+          0.2f * sin(2.0 * M_PI * 500.0 * t);
+    }
+  }
+  return input;
+}
+
+/* The pipelined output matches TactileProcessorProcessSamples() delayed by one
+ * block, including through silence gating and reset.
+ */
+static void TestMatchesTactileProcessor(int enable_silence_gating,
+                                        int decimation_factor) {
+  printf("TestMatchesTactileProcessor(%d, %d)\n",
+         enable_silence_gating, decimation_factor);
+  TactileProcessorParams params;
+  TactileProcessorSetDefaultParams(&params);
+  params.frontend_params.block_size = kBlockSize;
+  params.decimation_factor = decimation_factor;
+  params.enable_silence_gating = enable_silence_gating;
+  params.silence_hold_s = 0.1f;
+  TactileProcessor* processor = CHECK_NOTNULL(TactileProcessorMake(&params));
+  PipelinedTactileProcessor* pipelined =
+      CHECK_NOTNULL(PipelinedTactileProcessorMake(&params));
+
+  float* input = MakeInput();
+  const int output_size =
+      kTactileProcessorNumTactors * kBlockSize / decimation_factor;
+  float* expected = (float*)CHECK_NOTNULL(
+      malloc(sizeof(float) * output_size * kNumBlocks));
+  float* actual = (float*)CHECK_NOTNULL(malloc(sizeof(float) * output_size));
+
+  int trial;
+  for (trial = 0; trial < 2; ++trial) {
+    int b;
+    for (b = 0; b < kNumBlocks; ++b) {
+      const float* input_block = input + kBlockSize * b;
+      TactileProcessorProcessSamples(processor, input_block,
+                                     expected + output_size * b);
+      PipelinedTactileProcessorProcessSamples(pipelined, input_block, actual);
+
+      int i;
+      for (i = 0; i < output_size; ++i) {
+        /* The first output block is zero, then lags by one block. */
+        const float expected_value =
+            (b == 0) ? 0.0f : expected[output_size * (b - 1) + i];
+        CHECK(actual[i] == expected_value);
+      }
+    }
+
+    TactileProcessorReset(processor);
+    PipelinedTactileProcessorReset(pipelined);
+  }
+
+  free(actual);
+  free(expected);
+  free(input);
+  PipelinedTactileProcessorFree(pipelined);
+  TactileProcessorFree(processor);
+}
+
+int main(int argc, char** argv) {
+  srand(0);
+  TestMatchesTactileProcessor(0, 1);
+  TestMatchesTactileProcessor(0, 4);
+  TestMatchesTactileProcessor(1, 1);
+  TestMatchesTactileProcessor(1, 4);
+
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
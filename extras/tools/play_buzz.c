@@ -24,6 +24,9 @@
  *                          `--channel=all` for all channels. (Default 1)
  *  --amplitude=<float>     Buzz amplitude, value in [0.0, 1.0]. (Default 0.2)
  *  --frequency_hz=<float>  Buzz frequency. (Default 250.0)
+ *  --output_wav=<file>     Instead of playing with PortAudio, renders the buzz
+ *                          offline as fast as possible to a float WAV file.
+ *  --duration_s=<float>    Duration to render with --output_wav. (Default 8)
  */
 
 #include <math.h>
@@ -34,6 +37,7 @@
 #include <string.h>
 
 #include "src/dsp/math_constants.h"
+#include "src/dsp/write_wav_file.h"
 #include "extras/tools/portaudio_device.h"
 #include "extras/tools/util.h"
 #include "portaudio.h"
@@ -116,17 +120,9 @@ void BuzzerGenerate(BuzzerState* state, int num_samples,
   state->position = position;
 }
 
-/* Stream callback function. In each call, portaudio passes kChunkSize frames
- * of input, and we process it to produce kChunkSize frames of output.
- */
-int Callback(const void* input_buffer, void* output_buffer,
-             unsigned long frames_per_buffer,
-             const PaStreamCallbackTimeInfo* time_info,
-             PaStreamCallbackFlags status_flags, void* user_data) {
-  float* output = (float*)output_buffer;
-
+/* Generates `num_frames` frames of `g_num_channels`-channel output. */
+void GenerateFrames(float* output, int num_frames) {
   if (g_channel_index == -1) {
-    const int num_frames = (int)frames_per_buffer;
     BuzzerGenerate(&g_buzzer_state, num_frames, output, g_num_channels);
     int i;
     for (i = 0; i < num_frames; ++i) {
@@ -137,18 +133,43 @@ int Callback(const void* input_buffer, void* output_buffer,
       }
     }
   } else {
-    const int num_samples = frames_per_buffer * g_num_channels;
+    const int num_samples = num_frames * g_num_channels;
     int i;
     for (i = 0; i < num_samples; ++i) {
       output[i] = 0.0f;
     }
 
-    BuzzerGenerate(&g_buzzer_state, frames_per_buffer,
+    BuzzerGenerate(&g_buzzer_state, num_frames,
                    output + g_channel_index - 1, g_num_channels);
   }
+}
+
+/* Stream callback function. In each call, portaudio passes kChunkSize frames
+ * of input, and we process it to produce kChunkSize frames of output.
+ */
+int Callback(const void* input_buffer, void* output_buffer,
+             unsigned long frames_per_buffer,
+             const PaStreamCallbackTimeInfo* time_info,
+             PaStreamCallbackFlags status_flags, void* user_data) {
+  GenerateFrames((float*)output_buffer, (int)frames_per_buffer);
   return paContinue;
 }
 
+/* Renders `num_frames` frames offline to a WAV file. Returns 1 on success. */
+int RenderToWav(const char* output_wav, int num_frames, int sample_rate_hz) {
+  const size_t num_samples = (size_t)num_frames * g_num_channels;
+  float* samples = (float*)malloc(sizeof(float) * num_samples);
+  if (samples == NULL) {
+    fprintf(stderr, "Error: Memory allocation failed.\n");
+    return 0;
+  }
+  GenerateFrames(samples, num_frames);
+  const int success = WriteWavFileFloat(output_wav, samples, num_samples,
+                                        sample_rate_hz, g_num_channels);
+  free(samples);
+  return success;
+}
+
 int main(int argc, char** argv) {
   PaError err = Pa_Initialize();
   if (err != paNoError) { goto fail; }
@@ -157,6 +178,8 @@ int main(int argc, char** argv) {
   int sample_rate_hz = 44100;
   float amplitude = 0.2f;
   float frequency_hz = 250.0f;
+  const char* output_wav = NULL;
+  float duration_s = 8.0f;
   int i;
 
   for (i = 1; i < argc; ++i) { /* Parse flags. */
@@ -176,6 +199,10 @@ int main(int argc, char** argv) {
       amplitude = atof(strchr(argv[i], '=') + 1);
     } else if (StartsWith(argv[i], "--frequency_hz=")) {
       frequency_hz = atof(strchr(argv[i], '=') + 1);
+    } else if (StartsWith(argv[i], "--output_wav=")) {
+      output_wav = strchr(argv[i], '=') + 1;
+    } else if (StartsWith(argv[i], "--duration_s=")) {
+      duration_s = atof(strchr(argv[i], '=') + 1);
     } else {
       fprintf(stderr, "Error: Invalid flag \"%s\"\n", argv[i]);
       goto fail;
@@ -189,6 +216,19 @@ int main(int argc, char** argv) {
     goto fail;
   }
 
+  if (output_wav) {  /* Render offline without PortAudio. */
+    if (!(duration_s > 0.0f) ||
+        !BuzzerInit(&g_buzzer_state, amplitude, frequency_hz, sample_rate_hz) ||
+        !RenderToWav(output_wav, (int)(duration_s * sample_rate_hz + 0.5f),
+                     sample_rate_hz)) {
+      goto fail;
+    }
+    Pa_Terminate();
+    free(g_buzzer_state.waveform);
+    printf("Wrote %.6g s buzz to %s\n", duration_s, output_wav);
+    return EXIT_SUCCESS;
+  }
+
   const int output_device_index =
       FindPortAudioDevice(output_device, 0, g_num_channels);
   if (output_device_index < 0) {
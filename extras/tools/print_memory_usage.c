@@ -0,0 +1,204 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * Prints the memory footprint of a tactile processing configuration.
+ *
+ * This is a small program to budget RAM and flash for a firmware variant
+ * before flashing. It makes the DSP objects for the given configuration on the
+ * host and prints a breakdown of heap, state, and constant-table bytes for
+ * each, see src/dsp/memory_usage.h. Each stream has a TactileProcessor,
+ * PostProcessor, and TactilePattern, plus optionally an input QResampler and a
+ * Muxer. Sizes are host sizes; on a 32-bit target, structs with pointers are a
+ * little smaller.
+ *
+ * Each QResampler is counted with its own filters, as when made with
+ * QResamplerInitInBuffer(). Table bytes are counted once per kind of object,
+ * since instances share tables. Some tables, like kFastFunLog2Table, are read
+ * by more than one kind of object, so the table total is an upper bound.
+ *
+ * Flags (TactileProcessor defaults are used if not set):
+ *  --sample_rate_hz=<float>        TactileProcessor input sample rate in Hz.
+ *  --input_sample_rate_hz=<float>  Audio input sample rate in Hz. If different
+ *                                  from sample_rate_hz, a QResampler is added
+ *                                  per stream. (Default same as above).
+ *  --block_size=<int>              TactileProcessor block size.
+ *  --decimation_factor=<int>       Decimation factor.
+ *  --num_tactors=<int>             PostProcessor channels. (Default 10).
+ *  --num_streams=<int>             Number of independent streams. (Default 1).
+ *  --silence_gating                Enable silence gating.
+ *  --muxer                         Add a Muxer per stream.
+ *
+ * Example, a 24-tactor sleeve and 4 streams with resampling:
+ *   print_memory_usage --num_tactors=24
+ *   print_memory_usage --num_streams=4 --input_sample_rate_hz=44100
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "extras/tools/util.h"
+#include "src/dsp/memory_usage.h"
+#include "src/dsp/q_resampler.h"
+#include "src/mux/muxer.h"
+#include "src/tactile/post_processor.h"
+#include "src/tactile/tactile_pattern.h"
+#include "src/tactile/tactile_processor.h"
+
+/* Prints one row of the breakdown for `count` objects with `usage` each. */
+static void PrintRow(const char* name, int count, const MemoryUsage* usage) {
+  printf("%-18s %5d %10lu %10lu %10lu %10lu\n", name, count,
+         (unsigned long)(count * usage->heap_bytes),
+         (unsigned long)(count * usage->state_bytes),
+         (unsigned long)(count * MemoryUsageRamBytes(usage)),
+         (unsigned long)usage->table_bytes);
+}
+
+/* Adds `count` objects with `usage` each to `total`, counting tables once. */
+static void AddToTotal(MemoryUsage* total, int count,
+                       const MemoryUsage* usage) {
+  total->heap_bytes += count * usage->heap_bytes;
+  total->state_bytes += count * usage->state_bytes;
+  total->table_bytes += usage->table_bytes;
+}
+
+int main(int argc, char** argv) {
+  TactileProcessorParams params;
+  TactileProcessorSetDefaultParams(&params);
+  float input_sample_rate_hz = -1.0f;
+  int num_tactors = kTactileProcessorNumTactors;
+  int num_streams = 1;
+  int use_muxer = 0;
+  int i;
+
+  for (i = 1; i < argc; ++i) { /* Parse flags. */
+    if (StartsWith(argv[i], "--sample_rate_hz=")) {
+      params.frontend_params.input_sample_rate_hz =
+          atof(strchr(argv[i], '=') + 1);
+    } else if (StartsWith(argv[i], "--input_sample_rate_hz=")) {
+      input_sample_rate_hz = atof(strchr(argv[i], '=') + 1);
+    } else if (StartsWith(argv[i], "--block_size=")) {
+      params.frontend_params.block_size = atoi(strchr(argv[i], '=') + 1);
+    } else if (StartsWith(argv[i], "--decimation_factor=")) {
+      params.decimation_factor = atoi(strchr(argv[i], '=') + 1);
+    } else if (StartsWith(argv[i], "--num_tactors=")) {
+      num_tactors = atoi(strchr(argv[i], '=') + 1);
+    } else if (StartsWith(argv[i], "--num_streams=")) {
+      num_streams = atoi(strchr(argv[i], '=') + 1);
+    } else if (!strcmp(argv[i], "--silence_gating")) {
+      params.enable_silence_gating = 1;
+    } else if (!strcmp(argv[i], "--muxer")) {
+      use_muxer = 1;
+    } else {
+      fprintf(stderr, "Error: Invalid flag \"%s\"\n", argv[i]);
+      return EXIT_FAILURE;
+    }
+  }
+
+  const float sample_rate_hz = params.frontend_params.input_sample_rate_hz;
+  const int block_size = params.frontend_params.block_size;
+  if (input_sample_rate_hz <= 0.0f) {
+    input_sample_rate_hz = sample_rate_hz;
+  }
+  if (!(1 <= num_tactors && num_tactors <= kPostProcessorMaxChannels)) {
+    fprintf(stderr, "Error: num_tactors must be between 1 and %d.\n",
+            kPostProcessorMaxChannels);
+    return EXIT_FAILURE;
+  } else if (num_streams < 1) {
+    fprintf(stderr, "Error: num_streams must be positive.\n");
+    return EXIT_FAILURE;
+  }
+
+  TactileProcessor* processor = TactileProcessorMake(&params);
+  if (processor == NULL) {
+    fprintf(stderr, "Error: TactileProcessorMake failed.\n");
+    return EXIT_FAILURE;
+  }
+  const float output_sample_rate_hz =
+      TactileProcessorOutputSampleRateHz(&params);
+
+  PostProcessorParams post_processor_params;
+  PostProcessorSetDefaultParams(&post_processor_params);
+  PostProcessor post_processor;
+  if (!PostProcessorInit(&post_processor, &post_processor_params,
+                         output_sample_rate_hz, num_tactors)) {
+    fprintf(stderr, "Error: PostProcessorInit failed.\n");
+    TactileProcessorFree(processor);
+    return EXIT_FAILURE;
+  }
+
+  /* TactilePattern state has a fixed size, regardless of num_channels. */
+  TactilePattern pattern;
+  TactilePatternInit(&pattern, output_sample_rate_hz,
+                     (num_tactors < kTactilePatternMaxChannels)
+                         ? num_tactors : kTactilePatternMaxChannels - 1);
+
+  printf("sample_rate_hz: %g, block_size: %d, decimation_factor: %d, "
+         "num_tactors: %d, num_streams: %d\n\n",
+         sample_rate_hz, block_size, params.decimation_factor,
+         num_tactors, num_streams);
+  printf("%-18s %5s %10s %10s %10s %10s\n",
+         "Object", "Count", "Heap", "State", "RAM", "Tables");
+
+  MemoryUsage total;
+  MemoryUsageZero(&total);
+  MemoryUsage usage;
+
+  if (input_sample_rate_hz != sample_rate_hz) {
+    QResampler* resampler = QResamplerMake(
+        input_sample_rate_hz, sample_rate_hz, 1, block_size, NULL);
+    if (resampler == NULL) {
+      fprintf(stderr, "Error: QResamplerMake failed.\n");
+      TactileProcessorFree(processor);
+      return EXIT_FAILURE;
+    }
+    QResamplerMemoryUsage(resampler, &usage);
+    PrintRow("QResampler", num_streams, &usage);
+    AddToTotal(&total, num_streams, &usage);
+    QResamplerFree(resampler);
+  }
+
+  TactileProcessorMemoryUsage(processor, &usage);
+  PrintRow("TactileProcessor", num_streams, &usage);
+  AddToTotal(&total, num_streams, &usage);
+  CarlFrontendMemoryUsage(processor->frontend, &usage);
+  PrintRow("  (CarlFrontend)", num_streams, &usage);
+
+  PostProcessorMemoryUsage(&post_processor, &usage);
+  PrintRow("PostProcessor", num_streams, &usage);
+  AddToTotal(&total, num_streams, &usage);
+
+  TactilePatternMemoryUsage(&pattern, &usage);
+  PrintRow("TactilePattern", num_streams, &usage);
+  AddToTotal(&total, num_streams, &usage);
+
+  if (use_muxer) {
+    Muxer* muxer = MuxerMake();
+    if (muxer == NULL) {
+      fprintf(stderr, "Error: MuxerMake failed.\n");
+      TactileProcessorFree(processor);
+      return EXIT_FAILURE;
+    }
+    MuxerMemoryUsage(muxer, &usage);
+    PrintRow("Muxer", num_streams, &usage);
+    AddToTotal(&total, num_streams, &usage);
+    MuxerFree(muxer);
+  }
+
+  PrintRow("Total", 1, &total);
+
+  TactileProcessorFree(processor);
+  return EXIT_SUCCESS;
+}
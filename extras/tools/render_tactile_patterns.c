@@ -0,0 +1,249 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * Renders tactile patterns offline to multichannel WAV files.
+ *
+ * This program synthesizes TactilePattern patterns (see
+ * src/tactile/tactile_pattern.h) straight to WAV files, without PortAudio and
+ * as fast as possible, rendering several patterns in parallel. This is useful
+ * for producing test data and perceptual stimulus sets.
+ *
+ * Each job is given as an argument "<output.wav>=<pattern>", where <pattern> is
+ * a simple pattern string as in TactilePatternStart(), for instance
+ *
+ *   render_tactile_patterns --num_channels=4 a.wav=555-C-8 b.wav=6/6
+ *
+ * Alternatively, --jobs=<file> reads jobs from a text file with one job per
+ * line in the same format. Output is 32-bit float WAV, and ends when the
+ * pattern completes.
+ *
+ * Flags:
+ *  --sample_rate_hz=<int>    Sample rate. (Default 44100)
+ *  --num_channels=<int>      Number of output channels. (Default 10)
+ *  --num_threads=<int>       Number of worker threads. (Default 4)
+ *  --max_duration_s=<float>  Max duration of each output. (Default 60)
+ *  --jobs=<file>             Read jobs from a text file.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "src/dsp/write_wav_file.h"
+#include "src/tactile/tactile_pattern.h"
+#include "extras/tools/task_pool.h"
+#include "extras/tools/util.h"
+
+/* Number of frames synthesized per TactilePatternSynthesize() call. */
+#define kChunkFrames 512
+/* Max length of a line in the --jobs file. */
+#define kMaxLineLength 1024
+
+typedef struct {
+  char* output_wav;  /* Output WAV file name.                   */
+  char* pattern;     /* Simple pattern string.                  */
+  int success;       /* Set to 1 when rendered and written.     */
+  double duration_s; /* Duration of the rendered output.        */
+} RenderJob;
+
+typedef struct {
+  RenderJob* jobs;
+  int num_jobs;
+  int sample_rate_hz;
+  int num_channels;
+  int max_frames;
+} RenderContext;
+
+/* Parses "<output.wav>=<pattern>" into a newly allocated job. Returns 1 on
+ * success, 0 on failure.
+ */
+static int ParseJob(const char* spec, RenderJob* job) {
+  const char* equals = strchr(spec, '=');
+  if (equals == NULL || equals == spec || equals[1] == '\0') {
+    fprintf(stderr, "Error: Invalid job \"%s\", expected "
+            "\"<output.wav>=<pattern>\"\n", spec);
+    return 0;
+  }
+  const size_t name_length = equals - spec;
+  job->output_wav = (char*)malloc(name_length + 1);
+  job->pattern = (char*)malloc(strlen(equals + 1) + 1);
+  if (job->output_wav == NULL || job->pattern == NULL) {
+    fprintf(stderr, "Error: Memory allocation failed.\n");
+    return 0;
+  }
+  memcpy(job->output_wav, spec, name_length);
+  job->output_wav[name_length] = '\0';
+  strcpy(job->pattern, equals + 1);
+  job->success = 0;
+  job->duration_s = 0.0;
+  return 1;
+}
+
+/* Appends a job to `*jobs`, growing the array as needed. */
+static int AddJob(const char* spec, RenderJob** jobs, int* num_jobs) {
+  RenderJob* grown = (RenderJob*)realloc(
+      *jobs, sizeof(RenderJob) * (*num_jobs + 1));
+  if (grown == NULL) {
+    fprintf(stderr, "Error: Memory allocation failed.\n");
+    return 0;
+  }
+  *jobs = grown;
+  RenderJob* job = &grown[*num_jobs];
+  job->output_wav = NULL;
+  job->pattern = NULL;
+  ++*num_jobs;
+  return ParseJob(spec, job);
+}
+
+/* Reads jobs from a text file, one per line. Blank lines are skipped. */
+static int ReadJobsFile(const char* file_name, RenderJob** jobs,
+                        int* num_jobs) {
+  FILE* f = fopen(file_name, "rt");
+  if (f == NULL) {
+    fprintf(stderr, "Error: Failed to open \"%s\"\n", file_name);
+    return 0;
+  }
+  char line[kMaxLineLength];
+  int success = 1;
+  while (success && fgets(line, sizeof(line), f)) {
+    line[strcspn(line, "\r\n")] = '\0';
+    if (line[0] != '\0') {
+      success = AddJob(line, jobs, num_jobs);
+    }
+  }
+  fclose(f);
+  return success;
+}
+
+/* Renders one job. Called concurrently from the task pool. */
+static void RenderTask(void* arg, int task) {
+  const RenderContext* context = (const RenderContext*)arg;
+  RenderJob* job = &context->jobs[task];
+  const int num_channels = context->num_channels;
+
+  TactilePattern pattern;
+  TactilePatternInit(&pattern, context->sample_rate_hz, num_channels);
+  if (!TactilePatternStart(&pattern, job->pattern)) {
+    fprintf(stderr, "Error: Invalid pattern \"%s\"\n", job->pattern);
+    return;
+  }
+
+  /* Synthesize into a buffer that grows by doubling. */
+  int capacity = kChunkFrames;
+  int num_frames = 0;
+  float* samples = (float*)malloc(sizeof(float) * capacity * num_channels);
+  int active = 1;
+  while (samples != NULL && active && num_frames < context->max_frames) {
+    if (num_frames + kChunkFrames > capacity) {
+      capacity *= 2;
+      float* grown = (float*)realloc(
+          samples, sizeof(float) * capacity * num_channels);
+      if (grown == NULL) {
+        free(samples);
+        samples = NULL;
+        break;
+      }
+      samples = grown;
+    }
+    active = TactilePatternSynthesize(&pattern, kChunkFrames,
+                                      samples + num_frames * num_channels);
+    num_frames += kChunkFrames;
+  }
+  if (samples == NULL) {
+    fprintf(stderr, "Error: Memory allocation failed.\n");
+    return;
+  }
+  if (num_frames > context->max_frames) { num_frames = context->max_frames; }
+
+  job->success = WriteWavFileFloat(job->output_wav, samples,
+                                   (size_t)num_frames * num_channels,
+                                   context->sample_rate_hz, num_channels);
+  job->duration_s = (double)num_frames / context->sample_rate_hz;
+  free(samples);
+}
+
+int main(int argc, char** argv) {
+  int exit_status = EXIT_FAILURE;
+  RenderContext context;
+  context.jobs = NULL;
+  context.num_jobs = 0;
+  context.sample_rate_hz = 44100;
+  context.num_channels = 10;
+  int num_threads = 4;
+  float max_duration_s = 60.0f;
+  TaskPool* pool = NULL;
+  int i;
+
+  for (i = 1; i < argc; ++i) { /* Parse flags. */
+    if (StartsWith(argv[i], "--sample_rate_hz=")) {
+      context.sample_rate_hz = atoi(strchr(argv[i], '=') + 1);
+    } else if (StartsWith(argv[i], "--num_channels=")) {
+      context.num_channels = atoi(strchr(argv[i], '=') + 1);
+    } else if (StartsWith(argv[i], "--num_threads=")) {
+      num_threads = atoi(strchr(argv[i], '=') + 1);
+    } else if (StartsWith(argv[i], "--max_duration_s=")) {
+      max_duration_s = atof(strchr(argv[i], '=') + 1);
+    } else if (StartsWith(argv[i], "--jobs=")) {
+      if (!ReadJobsFile(strchr(argv[i], '=') + 1,
+                        &context.jobs, &context.num_jobs)) {
+        goto done;
+      }
+    } else if (StartsWith(argv[i], "--")) {
+      fprintf(stderr, "Error: Invalid flag \"%s\"\n", argv[i]);
+      goto done;
+    } else if (!AddJob(argv[i], &context.jobs, &context.num_jobs)) {
+      goto done;
+    }
+  }
+
+  if (context.sample_rate_hz <= 0 ||
+      !(1 <= context.num_channels &&
+        context.num_channels < kTactilePatternMaxChannels) ||
+      num_threads < 0 || !(max_duration_s > 0.0f)) {
+    fprintf(stderr, "Error: Invalid parameters.\n");
+    goto done;
+  } else if (context.num_jobs == 0) {
+    fprintf(stderr, "Error: No jobs. Pass jobs as <output.wav>=<pattern>.\n");
+    goto done;
+  }
+  context.max_frames = (int)(max_duration_s * context.sample_rate_hz + 0.5f);
+
+  pool = TaskPoolMake(num_threads);
+  if (pool == NULL) {
+    fprintf(stderr, "Error: Failed to create threads.\n");
+    goto done;
+  }
+  TaskPoolRun(pool, RenderTask, &context, context.num_jobs);
+
+  exit_status = EXIT_SUCCESS;
+  for (i = 0; i < context.num_jobs; ++i) {
+    const RenderJob* job = &context.jobs[i];
+    if (job->success) {
+      printf("%s: %.3f s\n", job->output_wav, job->duration_s);
+    } else {
+      fprintf(stderr, "Error: Failed to render \"%s\"\n", job->output_wav);
+      exit_status = EXIT_FAILURE;
+    }
+  }
+
+done:
+  if (pool) { TaskPoolFree(pool); }
+  for (i = 0; i < context.num_jobs; ++i) {
+    free(context.jobs[i].output_wav);
+    free(context.jobs[i].pattern);
+  }
+  free(context.jobs);
+  return exit_status;
+}
@@ -13,34 +13,94 @@
  * limitations under the License.
  *
  *
- * Runs Muxer on a WAV file.
+ * Runs Muxer on WAV files.
  *
  * This is a small program that runs Muxer on a multichannel WAV file with up to
- * 12 channels, producing a single-channel output WAV file.
+ * 12 channels, producing a single-channel output WAV file. The input is
+ * streamed block by block and the output is written as it is produced, so long
+ * files are processed in constant memory. Output larger than 4 GB is written as
+ * RF64.
+ *
+ * Several files may be processed in parallel by passing jobs as arguments
+ * "<output.wav>=<input.wav>", for instance
+ *
+ *   run_muxer_on_wav --num_threads=4 a_muxed.wav=a.wav b_muxed.wav=b.wav
+ *
+ * For each file, the program prints the input duration and the throughput as a
+ * real-time factor (seconds of audio per second of wall time).
  *
  * Flags:
  *  --input=<path>              Input WAV file path.
  *  --output=<path>             Output WAV file path.
  *  --output_sample_rate=<int>  Output sample rate in Hz.
+ *  --num_threads=<int>         Number of worker threads. (Default 0)
  */
 
+#if !defined(_POSIX_C_SOURCE) || _POSIX_C_SOURCE < 199309L
+#undef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 199309L /* For clock_gettime(). */
+#endif
+
 #include <math.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
 
+#include "extras/tools/task_pool.h"
 #include "extras/tools/util.h"
 #include "src/dsp/convert_sample.h"
 #include "src/dsp/q_resampler.h"
-#include "src/dsp/read_wav_file.h"
+#include "src/dsp/read_wav_stream.h"
 #include "src/dsp/write_wav_file.h"
 #include "src/mux/muxer.h"
 
-int main(int argc, char** argv) {
-  const char* input_wav = NULL;
-  const char* output_wav = NULL;
-  int output_sample_rate = kMuxMuxedRate;
-  FILE* f_in = NULL;
+typedef struct {
+  const char* input_wav;   /* Input WAV file name.                  */
+  const char* output_wav;  /* Output WAV file name.                 */
+  int success;             /* Set to 1 when processed successfully. */
+  double duration_s;       /* Duration of the input.                */
+  double elapsed_s;        /* Wall time to process the file.        */
+} MuxJob;
+
+typedef struct {
+  MuxJob* jobs;
+  int num_jobs;
+  int output_sample_rate;
+} MuxContext;
+
+/* Gets a monotonic wall clock time in seconds. */
+static double WallTimeSeconds(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec + 1e-9 * t.tv_nsec;
+}
+
+/* Appends job "<output.wav>=<input.wav>" to `*jobs`. */
+static int AddJob(const char* input_wav, const char* output_wav,
+                  MuxJob** jobs, int* num_jobs) {
+  MuxJob* grown = (MuxJob*)realloc(*jobs, sizeof(MuxJob) * (*num_jobs + 1));
+  if (grown == NULL) {
+    fprintf(stderr, "Error: Memory allocation failed.\n");
+    return 0;
+  }
+  *jobs = grown;
+  MuxJob* job = &grown[(*num_jobs)++];
+  job->input_wav = input_wav;
+  job->output_wav = output_wav;
+  job->success = 0;
+  job->duration_s = 0.0;
+  job->elapsed_s = 0.0;
+  return 1;
+}
+
+/* Runs Muxer on one WAV file, streaming from `job->input_wav` to
+ * `job->output_wav`. Returns 1 on success, 0 on failure.
+ */
+static int MuxWavFile(MuxJob* job, int output_sample_rate) {
+  const char* input_wav = job->input_wav;
+  const char* output_wav = job->output_wav;
+  ReadWavStream* stream = NULL;
   FILE* f_out = NULL;
   QResampler* resampler = NULL;
   QResampler* output_resampler = NULL;
@@ -48,54 +108,22 @@ int main(int argc, char** argv) {
   int16_t* buffer_int16 = NULL;
   float* buffer_float = NULL;
   float* resampled_signals = NULL;
-  int status = EXIT_FAILURE;
+  int success = 0;
   int i;
 
-  for (i = 1; i < argc; ++i) { /* Parse flags. */
-    if (StartsWith(argv[i], "--input=")) {
-      input_wav = strchr(argv[i], '=') + 1;
-    } else if (StartsWith(argv[i], "--output=")) {
-      output_wav = strchr(argv[i], '=') + 1;
-    } else if (StartsWith(argv[i], "--output_sample_rate=")) {
-      output_sample_rate = atoi(strchr(argv[i], '=') + 1);
-    } else {
-      fprintf(stderr, "Error: Invalid flag \"%s\"\n", argv[i]);
-      goto done;
-    }
-  }
-
-  const int kMinOutputSampleRateHz =
-      ceil(2 * MuxCarrierFrequency(kMuxChannels));
-  if (input_wav == NULL) {
-    fprintf(stderr, "Error: Must specify --input\n");
-    goto done;
-  } else if (output_wav == NULL) {
-    fprintf(stderr, "Error: Must specify --output\n");
-    goto done;
-  } else if (output_sample_rate < kMinOutputSampleRateHz) {
-    fprintf(stderr, "Error: output_sample_rate must be at least %d.\n",
-        kMinOutputSampleRateHz);
-    goto done;
-  }
-
   /* Begin reading input WAV file. */
-  f_in = fopen(input_wav, "rb");
-  if (f_in == NULL) {
-    fprintf(stderr, "Error: Failed to open \"%s\"\n", input_wav);
-    goto done;
-  }
-  ReadWavInfo wav_info;
-  if (!ReadWavHeader(f_in, &wav_info)) {
+  const int max_in_frames = 1024;
+  stream = ReadWavStreamOpen(input_wav, max_in_frames);
+  if (stream == NULL) {
     fprintf(stderr, "Error reading \"%s\"\n", input_wav);
     goto done;
-  } else if (wav_info.num_channels > kMuxChannels) {
+  } else if (ReadWavStreamNumChannels(stream) > kMuxChannels) {
     fprintf(stderr, "Error: Up to %d channels supported, got: %d\n",
-            kMuxChannels, wav_info.num_channels);
+            kMuxChannels, ReadWavStreamNumChannels(stream));
     goto done;
   }
-  const int input_channels = wav_info.num_channels;
-  const int input_sample_rate_hz = wav_info.sample_rate_hz;
-  const int max_in_frames = 1024;
+  const int input_channels = ReadWavStreamNumChannels(stream);
+  const int input_sample_rate_hz = ReadWavStreamSampleRateHz(stream);
 
   /* Prepare to resample from the WAV file sample rate to kMuxTactileRate. */
   resampler = QResamplerMake(input_sample_rate_hz, kMuxTactileRate,
@@ -123,12 +151,15 @@ int main(int argc, char** argv) {
   }
   const int max_output_samples = QResamplerMaxOutputFrames(output_resampler);
 
-  /* Begin writing output WAV file. */
+  /* Begin writing output WAV file. The header is RF64-capable, so that it can
+   * be patched at the end for output over 4 GB.
+   */
   f_out = fopen(output_wav, "wb");
   if (f_out == NULL) {
     fprintf(stderr, "Failed to create output file \"%s\"\n", output_wav);
     goto done;
-  } else if (!WriteWavHeader(f_out, 0, output_sample_rate, 1)) {
+  } else if (!WriteWavHeaderRf64(f_out, 0, output_sample_rate, 1,
+                                 kWavInt16Format)) {
     fprintf(stderr, "Error while writing \"%s\"\n", output_wav);
     goto done;
   }
@@ -158,39 +189,38 @@ int main(int argc, char** argv) {
       ((64 + QResamplerFlushFrames(output_resampler)) *
        factor_denominator + factor_numerator - 1) / factor_numerator;
 
-  const size_t max_read = max_in_frames * input_channels;
-  size_t num_read;
-  size_t total_written = 0;
+  int num_in_frames;
+  uint64_t total_read = 0;
+  uint64_t total_written = 0;
 
-  /* Main loop, each iteration processing up to max_read input samples. */
+  /* Main loop, each iteration processing up to max_in_frames input frames. */
   do {
     /* Read from input WAV. */
-    num_read = Read16BitWavSamples(f_in, &wav_info, buffer_int16,
-                                   max_read);
-    if (num_read < max_read && num_flush_frames > 0) {
-      /* At the end of the WAV, append some zeros for flushing. */
-      int num_append = (max_read - num_read) / input_channels;
+    const float* input = ReadWavStreamNextBlock(stream, &num_in_frames);
+    if (input == NULL) {  /* End of the WAV, use a block of zeros. */
+      memset(buffer_float, 0, max_in_frames * input_channels * sizeof(float));
+      input = buffer_float;
+    }
+    total_read += num_in_frames;
+    if (num_in_frames < max_in_frames && num_flush_frames > 0) {
+      /* At the end of the WAV, append some zeros for flushing. The last block
+       * from the stream is already zero padded.
+       */
+      int num_append = max_in_frames - num_in_frames;
       if (num_flush_frames < num_append) { num_append = num_flush_frames; }
-      memset(buffer_int16 + num_read, 0,
-             num_append * input_channels * sizeof(int16_t));
-      num_read += num_append * input_channels;
+      num_in_frames += num_append;
       num_flush_frames -= num_append;
     }
-    const int num_in_frames = num_read / input_channels;
-
-    /* Convert int16 samples to float. */
-    ConvertSampleArrayInt16ToFloat(buffer_int16, num_read, buffer_float);
 
     /* Resample to kMuxTactileRate. */
     const int num_resampled_frames = QResamplerProcessSamples(
-        resampler, buffer_float, num_in_frames);
+        resampler, input, num_in_frames);
 
     /* Copy resampled output of `input_channels` channels to `resampled_signals`
      * with `kMuxChannels` channels, filling unused channels with zero.
      */
     const float* src = QResamplerOutput(resampler);
     float* dest = resampled_signals;
-    int i;
     for (i = 0; i < num_resampled_frames; ++i) {
       memcpy(dest, src, input_channels * sizeof(float));
       int c;
@@ -220,28 +250,132 @@ int main(int argc, char** argv) {
       goto done;
     }
     total_written += num_output_samples;
-  } while (num_read == max_read);
+  } while (num_in_frames == max_in_frames);
 
   /* Rewind and write the total number of samples. */
   if (fseek(f_out, 0, SEEK_SET) != 0 ||
-      !WriteWavHeader(f_out, total_written, output_sample_rate, 1)) {
+      !WriteWavHeaderRf64(f_out, total_written, output_sample_rate, 1,
+                          kWavInt16Format)) {
     fprintf(stderr, "Error while writing \"%s\"\n", output_wav);
     goto done;
   }
 
-  status = EXIT_SUCCESS;
+  job->duration_s = (double)total_read / input_sample_rate_hz;
+  success = 1;
 
   /* We jump to `done` on error. The cleanup code that follows is executed
    * regardless, on either success or failure.
    */
 done:
-  if (f_out) { fclose(f_out); }
-  if (f_in) { fclose(f_in); }
+  if (f_out && fclose(f_out) != 0) { success = 0; }
+  ReadWavStreamClose(stream);
   free(resampled_signals);
   free(buffer_float);
   free(buffer_int16);
   QResamplerFree(output_resampler);
   MuxerFree(muxer);
   QResamplerFree(resampler);
+  return success;
+}
+
+/* Processes one job. Called concurrently from the task pool. */
+static void MuxTask(void* arg, int task) {
+  const MuxContext* context = (const MuxContext*)arg;
+  MuxJob* job = &context->jobs[task];
+  const double start_time = WallTimeSeconds();
+  job->success = MuxWavFile(job, context->output_sample_rate);
+  job->elapsed_s = WallTimeSeconds() - start_time;
+}
+
+int main(int argc, char** argv) {
+  const char* input_wav = NULL;
+  const char* output_wav = NULL;
+  MuxContext context;
+  context.jobs = NULL;
+  context.num_jobs = 0;
+  context.output_sample_rate = kMuxMuxedRate;
+  int num_threads = 0;
+  TaskPool* pool = NULL;
+  int status = EXIT_FAILURE;
+  int i;
+
+  for (i = 1; i < argc; ++i) { /* Parse flags. */
+    if (StartsWith(argv[i], "--input=")) {
+      input_wav = strchr(argv[i], '=') + 1;
+    } else if (StartsWith(argv[i], "--output=")) {
+      output_wav = strchr(argv[i], '=') + 1;
+    } else if (StartsWith(argv[i], "--output_sample_rate=")) {
+      context.output_sample_rate = atoi(strchr(argv[i], '=') + 1);
+    } else if (StartsWith(argv[i], "--num_threads=")) {
+      num_threads = atoi(strchr(argv[i], '=') + 1);
+    } else if (StartsWith(argv[i], "--") || strchr(argv[i], '=') == NULL) {
+      fprintf(stderr, "Error: Invalid flag \"%s\"\n", argv[i]);
+      goto done;
+    } else {  /* Job "<output.wav>=<input.wav>". */
+      char* equals = strchr(argv[i], '=');
+      *equals = '\0';
+      if (!AddJob(equals + 1, argv[i], &context.jobs, &context.num_jobs)) {
+        goto done;
+      }
+    }
+  }
+
+  const int kMinOutputSampleRateHz =
+      ceil(2 * MuxCarrierFrequency(kMuxChannels));
+  if (input_wav != NULL || output_wav != NULL) {
+    if (input_wav == NULL) {
+      fprintf(stderr, "Error: Must specify --input\n");
+      goto done;
+    } else if (output_wav == NULL) {
+      fprintf(stderr, "Error: Must specify --output\n");
+      goto done;
+    } else if (!AddJob(input_wav, output_wav,
+                       &context.jobs, &context.num_jobs)) {
+      goto done;
+    }
+  }
+  if (context.num_jobs == 0) {
+    fprintf(stderr, "Error: Must specify --input and --output, or jobs as "
+            "<output.wav>=<input.wav>\n");
+    goto done;
+  } else if (context.output_sample_rate < kMinOutputSampleRateHz) {
+    fprintf(stderr, "Error: output_sample_rate must be at least %d.\n",
+        kMinOutputSampleRateHz);
+    goto done;
+  } else if (num_threads < 0) {
+    fprintf(stderr, "Error: num_threads must be nonnegative.\n");
+    goto done;
+  }
+
+  pool = TaskPoolMake(num_threads);
+  if (pool == NULL) {
+    fprintf(stderr, "Error: Failed to create threads.\n");
+    goto done;
+  }
+  const double start_time = WallTimeSeconds();
+  TaskPoolRun(pool, MuxTask, &context, context.num_jobs);
+  const double elapsed_s = WallTimeSeconds() - start_time;
+
+  status = EXIT_SUCCESS;
+  double total_duration_s = 0.0;
+  for (i = 0; i < context.num_jobs; ++i) {
+    const MuxJob* job = &context.jobs[i];
+    if (job->success) {
+      printf("%s: %.3f s, %.1fx realtime\n", job->output_wav,
+             job->duration_s, job->duration_s / job->elapsed_s);
+      total_duration_s += job->duration_s;
+    } else {
+      fprintf(stderr, "Error: Failed to process \"%s\"\n", job->input_wav);
+      status = EXIT_FAILURE;
+    }
+  }
+  if (context.num_jobs > 1) {
+    printf("Total: %.3f s in %.3f s, %.1fx realtime\n",
+           total_duration_s, elapsed_s, total_duration_s / elapsed_s);
+  }
+
+done:
+  if (pool) { TaskPoolFree(pool); }
+  free(context.jobs);
   return status;
 }
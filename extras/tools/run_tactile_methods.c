@@ -23,6 +23,13 @@
  *   Bratakos2001                 1
  *   Yuan2005                     2
  *   Enveloper                    4
+ *   All                          7
+ *
+ * With --method=All, all methods are rendered at once, for A/B comparisons.
+ * Their signals are concatenated in the order above, so that signal 1 is
+ * Bratakos2001, signals 2-3 are Yuan2005, and signals 4-7 are Enveloper. The
+ * common front end, auto gain control, runs once per block, then the methods
+ * run in parallel on a thread pool.
  *
  * Use --channels to map tactile signals to output channels. For instance,
  * --channels=3,1,2,2 plays signal 3 on channel 1, signal 1 on channel 2, and
@@ -30,7 +37,8 @@
  * is filled with zeros, e.g. --channels=1,0,2 sets channel 2 to zeros.
  *
  * Flags:
- *  --method=<name>            'Bratakos2001', 'Yuan2005', or 'Enveloper'.
+ *  --method=<name>            'Bratakos2001', 'Yuan2005', 'Enveloper', or
+ *                             'All'.
  *  --input=<name>             Input device to read source audio from.
  *  --output=<name>            Output device to play tactor signals to.
  *  --sample_rate_hz=<int>     Sample rate. Note that most devices only support
@@ -64,10 +72,12 @@
 #include "extras/references/yuan2005/yuan2005.h"
 #include "extras/tools/channel_map_tui.h"
 #include "extras/tools/portaudio_device.h"
+#include "extras/tools/task_pool.h"
 #include "extras/tools/util.h"
 #include "portaudio.h"
 
 #define kMaxTactors 10
+#define kNumMethods 3
 
 /* The main processing loop runs while `is_running` is nonzero. We set a
  * signal handler to change `is_running` to 0 when Ctrl+C is pressed.
@@ -83,6 +93,9 @@ struct {
   float* tactile_output;
 
   void (*method_fun)(const float*, int, float*);
+  /* With --method=All, pool for running the methods and their outputs. */
+  TaskPool* pool;
+  float* method_outputs[kNumMethods];
   Enveloper enveloper;
   Bratakos2001State bratakos2001;
   Yuan2005State yuan2005;
@@ -146,6 +159,64 @@ void RunYuan2005(const float* input, int num_samples, float* output) {
   Yuan2005ProcessSamples(&engine.yuan2005, input, num_samples, output);
 }
 
+typedef struct {
+  const char* name;
+  int num_channels;
+  void (*fun)(const float*, int, float*);
+} Method;
+
+static const Method kMethods[] = {
+    {"Bratakos2001", 1, RunBratakos2001},
+    {"Yuan2005", 2, RunYuan2005},
+    {"Enveloper", kEnveloperNumChannels, RunEnveloper},
+};
+
+/* Initializes the method with index `m`. Returns 1 on success. */
+static int InitMethod(int m, int sample_rate_hz,
+                      const Yuan2005Params* yuan2005_params) {
+  switch (m) {
+    case 0:
+      return Bratakos2001Init(&engine.bratakos2001, sample_rate_hz);
+    case 1:
+      return Yuan2005Init(&engine.yuan2005, yuan2005_params);
+    default:
+      if (!EnveloperInit(&engine.enveloper, &kDefaultEnveloperParams,
+                         sample_rate_hz, 1)) {
+        fprintf(stderr, "Error: EnveloperInit failed.\n");
+        return 0;
+      }
+      return 1;
+  }
+}
+
+/* Task for TaskPoolRun(), running one method on the AGC output. */
+static void RunMethodTask(void* arg, int m) {
+  const int num_frames = *(const int*)arg;
+  kMethods[m].fun(engine.agc_output, num_frames, engine.method_outputs[m]);
+}
+
+/* Runs all methods in parallel and concatenates their channels. */
+static void RunAllMethods(int num_frames, float* output) {
+  TaskPoolRun(engine.pool, RunMethodTask, &num_frames, kNumMethods);
+
+  const int num_tactors = engine.channel_map.num_input_channels;
+  int offset = 0;
+  int m;
+  for (m = 0; m < kNumMethods; ++m) {
+    const int num_channels = kMethods[m].num_channels;
+    const float* method_output = engine.method_outputs[m];
+    int i;
+    for (i = 0; i < num_frames; ++i) {
+      int c;
+      for (c = 0; c < num_channels; ++c) {
+        output[num_tactors * i + offset + c] =
+            method_output[num_channels * i + c];
+      }
+    }
+    offset += num_channels;
+  }
+}
+
 /* Stream callback function. In each call, portaudio passes chunk_size frames
  * of input, and we process it to produce chunk_size frames of output.
  */
@@ -163,14 +234,15 @@ int TactorCallback(const void *input_buffer, void *output_buffer,
   float* output = (float*) output_buffer;
   const int num_frames = (int)frames_per_buffer;
 
-  int i;
-  for (i = 0; i < num_frames; ++i) {
-    AutoGainControlProcessSample(&engine.agc, input[i] * input[i]);
-    engine.agc_output[i] = input[i] * AutoGainControlGetGain(&engine.agc);
-  }
+  AutoGainControlProcessBlock(&engine.agc, input, 1, num_frames,
+                              engine.agc_output);
 
-  engine.method_fun(engine.agc_output, num_frames,
-                    engine.tactile_output);
+  if (engine.pool != NULL) {
+    RunAllMethods(num_frames, engine.tactile_output);
+  } else {
+    engine.method_fun(engine.agc_output, num_frames,
+                      engine.tactile_output);
+  }
 
   UpdateVolumeMeters(engine.tactile_output, num_frames);
   ChannelMapApply(&engine.channel_map, engine.tactile_output, num_frames,
@@ -179,10 +251,24 @@ int TactorCallback(const void *input_buffer, void *output_buffer,
   return paContinue;
 }
 
+static void FreeEngine(void) {
+  TaskPoolFree(engine.pool);
+  int i;
+  for (i = 0; i < kNumMethods; ++i) {
+    free(engine.method_outputs[i]);
+  }
+  free(engine.tactile_output);
+  free(engine.agc_output);
+}
+
 int main(int argc, char** argv) {
   engine.agc_output = NULL;
   engine.tactile_output = NULL;
+  engine.pool = NULL;
   int i;
+  for (i = 0; i < kNumMethods; ++i) {
+    engine.method_outputs[i] = NULL;
+  }
   for (i = 0; i < kMaxTactors; ++i) {
     engine.volume_meters[i] = 0.0f;
   }
@@ -236,38 +322,29 @@ int main(int argc, char** argv) {
     }
   }
 
+  int run_all = 0;
   if (!method) {
     fprintf(stderr, "Error: Must specify --method.\n");
     goto fail;
-  } else if (StringEqualIgnoreCase(method, "Bratakos2001")) {
-    printf("method: Bratakos2001\n");
-    engine.method_fun = RunBratakos2001;
-    num_tactors = 1;
-
-    if (!Bratakos2001Init(&engine.bratakos2001, sample_rate_hz)) {
-      goto fail;
+  } else if (StringEqualIgnoreCase(method, "All")) {
+    printf("method: All\n");
+    run_all = 1;
+    for (i = 0; i < kNumMethods; ++i) {
+      if (!InitMethod(i, sample_rate_hz, &yuan2005_params)) { goto fail; }
+      num_tactors += kMethods[i].num_channels;
     }
-  } else if (StringEqualIgnoreCase(method, "Yuan2005")) {
-    printf("method: Yuan2005\n");
-    engine.method_fun = RunYuan2005;
-    num_tactors = 2;
-
-    if (!Yuan2005Init(&engine.yuan2005, &yuan2005_params)) {
-      goto fail;
+  } else {
+    for (i = 0; i < kNumMethods; ++i) {
+      if (StringEqualIgnoreCase(method, kMethods[i].name)) { break; }
     }
-  } else if (StringEqualIgnoreCase(method, "Enveloper")) {
-    printf("method: Enveloper\n");
-    engine.method_fun = RunEnveloper;
-    num_tactors = kEnveloperNumChannels;
-
-    if (!EnveloperInit(&engine.enveloper, &kDefaultEnveloperParams,
-                       sample_rate_hz, 1)) {
-      fprintf(stderr, "Error: EnveloperInit failed.\n");
+    if (i == kNumMethods) {
+      fprintf(stderr, "Error: Invalid method \"%s\".\n", method);
       goto fail;
     }
-  } else {
-    fprintf(stderr, "Error: Invalid method \"%s\".\n", method);
-    goto fail;
+    printf("method: %s\n", kMethods[i].name);
+    engine.method_fun = kMethods[i].fun;
+    num_tactors = kMethods[i].num_channels;
+    if (!InitMethod(i, sample_rate_hz, &yuan2005_params)) { goto fail; }
   }
 
   if (!source_list) {
@@ -311,6 +388,16 @@ int main(int argc, char** argv) {
   engine.tactile_output = (float*)malloc(
       num_tactors * chunk_size * sizeof(float));
   if (engine.tactile_output == NULL) { goto fail; }
+  if (run_all) {
+    for (i = 0; i < kNumMethods; ++i) {
+      engine.method_outputs[i] = (float*)malloc(
+          kMethods[i].num_channels * chunk_size * sizeof(float));
+      if (engine.method_outputs[i] == NULL) { goto fail; }
+    }
+    /* The calling thread runs one of the methods itself. */
+    engine.pool = TaskPoolMake(kNumMethods - 1);
+    if (engine.pool == NULL) { goto fail; }
+  }
 
   if (!AutoGainControlInit(&engine.agc,
                            sample_rate_hz,
@@ -370,8 +457,7 @@ int main(int argc, char** argv) {
   err = Pa_CloseStream(stream);
   if (err != paNoError) goto fail;
 
-  free(engine.tactile_output);
-  free(engine.agc_output);
+  FreeEngine();
   Pa_Terminate();
   printf("\nFinished.\n");
   return EXIT_SUCCESS;
@@ -380,8 +466,7 @@ fail:
   if (err != paNoError) {
     fprintf(stderr, "Error: portaudio: %s\n", Pa_GetErrorText(err));
   }
-  free(engine.tactile_output);
-  free(engine.agc_output);
+  FreeEngine();
   Pa_Terminate();
   return EXIT_FAILURE;
 }
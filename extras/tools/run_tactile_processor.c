@@ -69,6 +69,14 @@
  *  --block_size=<int>         TactileProcessor block_size. Must be power of 2.
  *  --chunk_size=<int>         Frames per PortAudio buffer. (Default 256).
  *  --cutoff_hz=<float>        Cutoff in Hz for energy smoothing filters.
+ *  --record=<wavfile>         Record the output channels to a WAV file.
+ *  --trace=<jsonfile>         Record a timeline of the audio callbacks,
+ *                             processing stages, and thread handoffs, written
+ *                             on exit as Chrome trace JSON. Open it in
+ *                             chrome://tracing or https://ui.perfetto.dev.
+ *  --pipelined                Run the CARL frontend on a worker thread, with
+ *                             one block of added latency, see
+ *                             pipelined_tactile_processor.h.
  *  --fullscreen               Fullscreen display.
  *
  * Use keyboard buttons to control the program:
@@ -82,16 +90,20 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "src/dsp/decibels.h"
 #include "src/dsp/fast_fun.h"
 #include "src/dsp/number_util.h"
 #include "src/dsp/read_wav_file.h"
 #include "src/tactile/post_processor.h"
 #include "src/tactile/tactile_processor.h"
+#include "extras/tools/async_wav_writer.h"
 #include "extras/tools/channel_map_tui.h"
+#include "extras/tools/pipelined_tactile_processor.h"
 #include "extras/tools/portaudio_device.h"
 #include "extras/tools/sdl/basic_sdl_app.h"
 #include "extras/tools/sdl/texture_from_rle_data.h"
 #include "extras/tools/sdl/window_icon.h"
+#include "extras/tools/trace_event.h"
 #include "extras/tools/util.h"
 #include "portaudio.h"
 
@@ -102,20 +114,44 @@
 
 #define kNumFormFactors 2
 #define kNumImageAssets (kNumTactors + 1)
+/* Max number of trace events per thread, enough for several minutes. */
+#define kTraceMaxEventsPerThread (1 << 20)
 /* Defined in run_tactile_processor_assets.c. */
 extern const uint8_t* kBraceletImageAssetsRle[kNumImageAssets];
 extern const uint8_t* kSleeveImageAssetsRle[kNumImageAssets];
 
+/* The images of a form factor are uploaded once to a single texture atlas, so
+ * that each frame is drawn from one texture with per-tactor color modulation.
+ */
 typedef struct {
-  SDL_Texture* images[kNumImageAssets];
-  SDL_Rect image_rects[kNumImageAssets];
+  SDL_Texture* atlas;
+  SDL_Rect image_rects[kNumImageAssets];  /* Where to draw each image.      */
+  SDL_Rect atlas_rects[kNumImageAssets];  /* Where each image is in atlas.  */
 } FormFactorAssets;
 
+/* Snapshot of the tactor volume meters. The audio thread passes snapshots to
+ * the render thread through a lock-free triple buffer: the audio thread fills
+ * its back buffer and swaps it with the middle buffer, and the render thread
+ * swaps the middle buffer with its front buffer when a new snapshot is there.
+ * Neither thread ever waits for the other, and the render thread always reads
+ * a consistent snapshot.
+ */
+typedef struct {
+  float volume[kNumTactors];
+  /* Sequence number, used as the trace flow id of the handoff. */
+  int seq;
+} MeterSnapshot;
+
+/* Flag in `meter_middle` indicating a snapshot not yet seen by the renderer. */
+#define kMeterSnapshotFresh 4
+
 typedef struct {
   /* SDL variables. */
   BasicSdlApp app;
+  /* Assets are loaded on first use. */
   FormFactorAssets form_factors[kNumFormFactors];
   int selected_form_factor;        /* 0 => bracelet, 1 => sleeve.            */
+  int window_fullscreen;
 
   /* PortAudio variables. */
   int pa_initialized;              /* Whether PortAudio was initialized.     */
@@ -132,29 +168,62 @@ typedef struct {
   int input_wav_pos;
 
   float volume_decay_coeff;
-  volatile float volume[kNumTactors];
+  float volume[kNumTactors];       /* Meters, updated by the audio thread.  */
+  MeterSnapshot meter_snapshots[3];
+  int meter_back;                  /* Owned by the audio thread.             */
+  int meter_middle;                /* Shared, accessed atomically.           */
+  int meter_front;                 /* Owned by the render thread.            */
+  int meter_seq;                   /* Owned by the audio thread.             */
 
   TactileProcessor* tactile_processor;
+  /* If non-NULL, `tactile_processor` is run through this pipeline. */
+  PipelinedTactileProcessor* pipelined;
   PostProcessor post_processor;
   float* tactile_output;
+
+  /* If non-NULL, output is recorded to a WAV file without blocking the audio
+   * thread on disk I/O.
+   */
+  AsyncWavWriter* recorder;
+
+  /* If non-NULL, a trace is recorded and written to this path on exit. */
+  const char* trace_path;
 } Engine;
 
 /* Loads the assets for a form factor. */
 static int LoadFormFactorAssets(SDL_Renderer* renderer, int window_fullscreen,
     const uint8_t* data[kNumImageAssets], FormFactorAssets* form_factor) {
-  int i;
-  for (i = 0; i < kNumImageAssets; ++i) {
-    form_factor->images[i] = CreateTextureFromRleData(
-        data[i], renderer, &form_factor->image_rects[i]);
-    if (!form_factor->images[i]) { return 0; }
-    if (window_fullscreen) {
+  form_factor->atlas = CreateTextureAtlasFromRleData(
+      data, kNumImageAssets, renderer, form_factor->image_rects,
+      form_factor->atlas_rects);
+  if (!form_factor->atlas) { return 0; }
+  if (window_fullscreen) {
+    int i;
+    for (i = 0; i < kNumImageAssets; ++i) {
       form_factor->image_rects[i].x += 167;
     }
   }
-  SDL_SetTextureColorMod(form_factor->images[kNumTactors], 0x9d, 0x8c, 0x78);
   return 1;
 }
 
+/* Gets the assets for the selected form factor, decoding them on first use so
+ * that only the form factors actually viewed are decoded. Returns NULL on
+ * failure.
+ */
+static const FormFactorAssets* GetSelectedAssets(Engine* engine) {
+  FormFactorAssets* assets =
+      &engine->form_factors[engine->selected_form_factor];
+  if (!assets->atlas &&
+      !LoadFormFactorAssets(engine->app.renderer, engine->window_fullscreen,
+                            (engine->selected_form_factor == 0)
+                                ? kBraceletImageAssetsRle
+                                : kSleeveImageAssetsRle,
+                            assets)) {
+    return NULL;
+  }
+  return assets;
+}
+
 int StartSdl(Engine* engine, int window_fullscreen, int window_borderless,
              int window_on_top) {
   if (SDL_Init(SDL_INIT_VIDEO) != 0) {
@@ -178,14 +247,10 @@ int StartSdl(Engine* engine, int window_fullscreen, int window_borderless,
   }
   /* Set a nice window icon. */
   SetWindowIcon(engine->app.window);
+  engine->window_fullscreen = window_fullscreen;
 
-  /* Create SDL_Textures from embedded image assets. */
-  return LoadFormFactorAssets(engine->app.renderer, window_fullscreen,
-                              kBraceletImageAssetsRle,
-                              &engine->form_factors[0]) &&
-         LoadFormFactorAssets(engine->app.renderer, window_fullscreen,
-                              kSleeveImageAssetsRle,
-                              &engine->form_factors[1]);
+  /* Create the texture for the initial form factor from embedded assets. */
+  return GetSelectedAssets(engine) != NULL;
 }
 
 /* Reads input WAV file. */
@@ -231,6 +296,34 @@ int ReadInputWav(Engine* engine, const char* input_wav) {
 }
 
 /* Processes one chunk of audio data. */
+/* Audio thread: Publishes the current volume meters to the render thread. */
+static void PublishMeterSnapshot(Engine* engine) {
+  MeterSnapshot* snapshot = &engine->meter_snapshots[engine->meter_back];
+  memcpy(snapshot->volume, engine->volume, sizeof(snapshot->volume));
+  snapshot->seq = ++engine->meter_seq;
+  TraceEventFlowStart("meter_snapshot", snapshot->seq);
+  engine->meter_back = __atomic_exchange_n(
+      &engine->meter_middle, engine->meter_back | kMeterSnapshotFresh,
+      __ATOMIC_ACQ_REL) & ~kMeterSnapshotFresh;
+}
+
+/* Render thread: Gets the newest meter snapshot, or NULL if there is none
+ * since the last call.
+ */
+static const MeterSnapshot* PollMeterSnapshot(Engine* engine) {
+  if (!(__atomic_load_n(&engine->meter_middle, __ATOMIC_RELAXED) &
+        kMeterSnapshotFresh)) {
+    return NULL;
+  }
+  TRACE_EVENT_SCOPE("poll_meters");
+  engine->meter_front = __atomic_exchange_n(
+      &engine->meter_middle, engine->meter_front,
+      __ATOMIC_ACQ_REL) & ~kMeterSnapshotFresh;
+  const MeterSnapshot* snapshot = &engine->meter_snapshots[engine->meter_front];
+  TraceEventFlowEnd("meter_snapshot", snapshot->seq);
+  return snapshot;
+}
+
 void ProcessChunk(Engine* engine, float* input, float* output) {
   const int block_size = CarlFrontendBlockSize(
       engine->tactile_processor->frontend);
@@ -241,8 +334,15 @@ void ProcessChunk(Engine* engine, float* input, float* output) {
   for (b = 0; b < num_blocks; ++b) {
     float* tactile_output = engine->tactile_output;
     /* Run audio-to-tactile processing. */
-    TactileProcessorProcessSamples(
-        engine->tactile_processor, input, tactile_output);
+    TraceEventBegin("tactile_processor");
+    if (engine->pipelined) {
+      PipelinedTactileProcessorProcessSamples(
+          engine->pipelined, input, tactile_output);
+    } else {
+      TactileProcessorProcessSamples(
+          engine->tactile_processor, input, tactile_output);
+    }
+    TraceEventEnd("tactile_processor");
 
     /* Accumulate signals for visualization. Do this before post processing. */
     int i;
@@ -256,40 +356,57 @@ void ProcessChunk(Engine* engine, float* input, float* output) {
 
     /* Apply equalization, clipping, and lowpass filtering. */
     tactile_output = engine->tactile_output;
+    TraceEventBegin("post_processor");
     PostProcessorProcessSamples(
         &engine->post_processor, tactile_output, block_size);
+    TraceEventEnd("post_processor");
 
     /* Map channels and apply channel gains. */
+    TraceEventBegin("channel_map");
     ChannelMapApply(&engine->channel_map, tactile_output, block_size, output);
+    TraceEventEnd("channel_map");
 
     input += block_size;
     output += engine->channel_map.num_output_channels * block_size;
   }
 
+  /* Convert tactile energy to perceived strength with Steven's power law.
+   * Perceived strength is roughly proportional to acceleration^0.55, which is
+   * proportional to sqrt(energy)^0.55. In decibels, this is 0.55 times the
+   * energy in dB, converted back as an amplitude ratio. Energies are floored at
+   * -120 dB.
+   *
+   * Different experiments have measured the exponent to be between 0.32 and
+   * 0.81. The exponent depends especially on the stimulus frequency. Over
+   * our range of interest 80-250 Hz, Ryu2010 measured 0.55.
+   *
+   * Reference: Ryu, "Psychophysical model for vibrotactile rendering in
+   * mobile devices," Presence 19.4 (2010): 364-387.
+   */
+  float perceived[kNumTactors];
+  const float energy_scale = 1.0f / (num_blocks * block_size);
   int c;
   for (c = 0; c < kNumTactors; ++c) {
-    /* Convert tactile energy to perceived strength with Steven's power law.
-     * Perceived strength is roughly proportional to acceleration^0.55, which is
-     * proportional to sqrt(energy)^0.55.
-     *
-     * Different experiments have measured the exponent to be between 0.32 and
-     * 0.81. The exponent depends especially on the stimulus frequency. Over
-     * our range of interest 80-250 Hz, Ryu2010 measured 0.55.
-     *
-     * Reference: Ryu, "Psychophysical model for vibrotactile rendering in
-     * mobile devices," Presence 19.4 (2010): 364-387.
-     */
-    const float perceived = FastPow(1e-12f + energy_accum[c]
-        / (num_blocks * block_size), 0.55f * 0.5f);
+    perceived[c] = energy_scale * energy_accum[c];
+  }
+  FastPowerRatioToDecibelsN(perceived, -120.0f, kNumTactors, perceived);
+  for (c = 0; c < kNumTactors; ++c) {
+    perceived[c] *= 0.55f;
+  }
+  FastDecibelsToAmplitudeRatioN(perceived, kNumTactors, perceived);
+
+  for (c = 0; c < kNumTactors; ++c) {
     /* Update engine->volume[c] according to
      *   volume = max(rms, volume * volume_decay_coeff).
      * This way the visualization follows the RMS with instantaneous attack but
      * smoothed release, so that onsets are well represented.
      */
     float updated_volume = engine->volume[c] * engine->volume_decay_coeff;
-    if (perceived > updated_volume) { updated_volume = perceived; }
+    if (perceived[c] > updated_volume) { updated_volume = perceived[c]; }
     engine->volume[c] = updated_volume;
   }
+
+  PublishMeterSnapshot(engine);
 }
 
 /* The audio thread calls this function for every chunk of audio. */
@@ -298,7 +415,10 @@ int PortAudioCallback(const void *input_buffer, void *output_buffer,
     const PaStreamCallbackTimeInfo* time_info,
     PaStreamCallbackFlags status_flags,
     void *user_data) {
+  TraceEventSetThreadName("audio");
+  TRACE_EVENT_SCOPE("callback");
   if (status_flags & paOutputUnderflow) {
+    TraceEventInstant("output_underflow");
     fprintf(stderr, "Error: Underflow in tactile output. "
         "chunk_size (%lu) might be too small.\n", chunk_size);
   }
@@ -318,6 +438,10 @@ int PortAudioCallback(const void *input_buffer, void *output_buffer,
   }
 
   ProcessChunk(engine, (float*)input, output);
+  if (engine->recorder) {
+    TRACE_EVENT_SCOPE("record");
+    AsyncWavWriterWriteFloat(engine->recorder, output, (int)chunk_size);
+  }
   return paContinue;
 }
 
@@ -399,18 +523,19 @@ int EngineInit(Engine* engine, int argc, char** argv) {
 
   BasicSdlAppInit(&engine->app);
   for (i = 0; i < kNumFormFactors; ++i) {
-    int j;
-    for (j = 0; j < kNumImageAssets; ++j) {
-      engine->form_factors[i].images[j] = NULL;
-    }
+    engine->form_factors[i].atlas = NULL;
   }
   engine->pa_initialized = 0;
   engine->pa_error = paNoError;
   engine->pa_stream = NULL;
   engine->input_wav_samples = NULL;
   engine->tactile_processor = NULL;
+  engine->pipelined = NULL;
   engine->tactile_output = NULL;
+  engine->recorder = NULL;
+  engine->trace_path = NULL;
   engine->selected_form_factor = 0;
+  engine->window_fullscreen = 0;
   engine->keep_running = 1;
 
   TactileProcessorParams params;
@@ -422,6 +547,7 @@ int EngineInit(Engine* engine, int argc, char** argv) {
   const char* output_device = NULL;
   const char* source_list = NULL;
   const char* gains_db_list = NULL;
+  const char* record_wav = NULL;
   int sample_rate_hz = 16000;
   int chunk_size = 256;
   int block_size = params.frontend_params.block_size;
@@ -429,6 +555,7 @@ int EngineInit(Engine* engine, int argc, char** argv) {
   int window_fullscreen = 0;
   int window_borderless = 0;
   int window_on_top = 0;
+  int use_pipeline = 0;
 
   for (i = 1; i < argc; ++i) {  /* Parse flags. */
     if (StartsWith(argv[i], "--input=")) {
@@ -461,6 +588,12 @@ int EngineInit(Engine* engine, int argc, char** argv) {
       chunk_size = atoi(strchr(argv[i], '=') + 1);
     } else if (StartsWith(argv[i], "--cutoff_hz=")) {
       cutoff_hz = atof(strchr(argv[i], '=') + 1);
+    } else if (StartsWith(argv[i], "--record=")) {
+      record_wav = strchr(argv[i], '=') + 1;
+    } else if (StartsWith(argv[i], "--trace=")) {
+      engine->trace_path = strchr(argv[i], '=') + 1;
+    } else if (!strcmp(argv[i], "--pipelined")) {
+      use_pipeline = 1;
     } else if (!strcmp(argv[i], "--fullscreen")) {
       window_fullscreen = 1;
     } else if (!strcmp(argv[i], "--borderless")) {
@@ -487,6 +620,12 @@ int EngineInit(Engine* engine, int argc, char** argv) {
   }
   engine->chunk_size = chunk_size;
 
+  /* Start tracing before any threads are started. */
+  if (engine->trace_path) {
+    if (!TraceEventStart(kTraceMaxEventsPerThread)) { return 0; }
+    TraceEventSetThreadName("main");
+  }
+
   /* Initialize SDL. */
   if (!StartSdl(engine, window_fullscreen, window_borderless, window_on_top)) {
     return 0;
@@ -508,10 +647,19 @@ int EngineInit(Engine* engine, int argc, char** argv) {
   params.frontend_params.block_size = block_size;
   params.enveloper_params.energy_cutoff_hz = cutoff_hz;
 
-  engine->tactile_processor = TactileProcessorMake(&params);
-  if (engine->tactile_processor == NULL) {
-    fprintf(stderr, "Error: TactileProcessorInit failed.\n");
-    return 0;
+  if (use_pipeline) {
+    engine->pipelined = PipelinedTactileProcessorMake(&params);
+    if (engine->pipelined == NULL) {
+      fprintf(stderr, "Error: PipelinedTactileProcessorMake failed.\n");
+      return 0;
+    }
+    engine->tactile_processor = engine->pipelined->processor;
+  } else {
+    engine->tactile_processor = TactileProcessorMake(&params);
+    if (engine->tactile_processor == NULL) {
+      fprintf(stderr, "Error: TactileProcessorInit failed.\n");
+      return 0;
+    }
   }
 
   /* Create PostProcessor. */
@@ -527,14 +675,27 @@ int EngineInit(Engine* engine, int argc, char** argv) {
     return 0;
   }
 
-  int c;
-  for (c = 0; c < kNumTactors; ++c) {
-    engine->volume[c] = 0.0f;
-  }
+  memset(engine->volume, 0, sizeof(engine->volume));
+  memset(engine->meter_snapshots, 0, sizeof(engine->meter_snapshots));
+  engine->meter_back = 0;
+  engine->meter_middle = 1;
+  engine->meter_front = 2;
+  engine->meter_seq = 0;
   const float kVolumeMeterTimeConstantSeconds = 0.05;
   engine->volume_decay_coeff = (float)exp(
       -chunk_size / (kVolumeMeterTimeConstantSeconds * sample_rate_hz));
 
+  /* Open the recording, with buffers for about 4 seconds of output. */
+  if (record_wav) {
+    const int num_buffers =
+        2 + (int)(4 * engine->sample_rate_hz) / chunk_size;
+    engine->recorder = AsyncWavWriterMake(
+        record_wav, (int)engine->sample_rate_hz,
+        engine->channel_map.num_output_channels, chunk_size, num_buffers);
+    if (engine->recorder == NULL) { return 0; }
+    printf("Recording output to: %s\n", record_wav);
+  }
+
   /* Start PortAudio and audio thread. */
   if (!StartPortAudio(engine, input_device, input_wav, output_device)) {
     return 0;
@@ -556,18 +717,29 @@ void EngineTerminate(Engine* engine) {
   if (engine->pa_initialized) {
     Pa_Terminate();
   }
+  /* Close the recording after the audio thread has stopped. */
+  if (engine->recorder) {
+    AsyncWavWriterClose(engine->recorder);
+  }
 
   free(engine->tactile_output);
-  TactileProcessorFree(engine->tactile_processor);
+  if (engine->pipelined) {
+    PipelinedTactileProcessorFree(engine->pipelined);
+  } else {
+    TactileProcessorFree(engine->tactile_processor);
+  }
   free(engine->input_wav_samples);
 
+  /* Write the trace after the audio and worker threads have stopped. */
+  if (TraceEventEnabled() &&
+      TraceEventStopAndWrite(engine->trace_path)) {
+    printf("Wrote trace to: %s\n", engine->trace_path);
+  }
+
   int i;
   for (i = 0; i < kNumFormFactors; ++i) {
-    int j;
-    for (j = 0; j < kNumImageAssets; ++j) {
-      if (engine->form_factors[i].images[j]) {
-        SDL_DestroyTexture(engine->form_factors[i].images[j]);
-      }
+    if (engine->form_factors[i].atlas) {
+      SDL_DestroyTexture(engine->form_factors[i].atlas);
     }
   }
 
@@ -594,6 +766,41 @@ void GenerateColormap(uint8_t* colormap) {
   }
 }
 
+/* Draws the visualization of `snapshot` with the selected form factor. Returns
+ * 1 on success, 0 on failure.
+ */
+static int Render(Engine* engine, const uint8_t* colormap,
+                  const MeterSnapshot* snapshot) {
+  const FormFactorAssets* assets = GetSelectedAssets(engine);
+  if (!assets) { return 0; }
+  SDL_Renderer* renderer = engine->app.renderer;
+  SDL_RenderClear(renderer);
+  /* Render background image. */
+  SDL_SetTextureColorMod(assets->atlas, 0x9d, 0x8c, 0x78);
+  SDL_RenderCopy(renderer, assets->atlas, &assets->atlas_rects[kNumTactors],
+                 &assets->image_rects[kNumTactors]);
+
+  int c;
+  for (c = 0; c < kNumTactors; ++c) {
+    /* Get volume for the cth tactor. */
+    float activation = snapshot->volume[c] / 0.4f;
+    if (activation < 0.0f) { activation = 0.0f; }
+    if (activation > 1.0f) { activation = 1.0f; }
+
+    /* Render the cth image with color according to `activation`. Since all
+     * images are in the same texture, SDL batches these draws.
+     */
+    const int index = (int)(255 * activation + 0.5f);
+    const uint8_t* rgb = &colormap[3 * index];
+    SDL_SetTextureColorMod(assets->atlas, rgb[0], rgb[1], rgb[2]);
+    SDL_RenderCopy(renderer, assets->atlas, &assets->atlas_rects[c],
+                   &assets->image_rects[c]);
+  }
+
+  SDL_RenderPresent(renderer);
+  return 1;
+}
+
 int main(int argc, char** argv) {
   int exit_status = EXIT_FAILURE;
   Engine engine;
@@ -602,6 +809,9 @@ int main(int argc, char** argv) {
   uint8_t colormap[256 * 3];
   GenerateColormap(colormap);
   SDL_SetRenderDrawColor(engine.app.renderer, 0x0, 0x0, 0x0, 0xff);
+  MeterSnapshot snapshot;
+  memset(&snapshot, 0, sizeof(snapshot));
+  int needs_redraw = 1;
 
   while (engine.keep_running) {  /* Engine main loop. */
     SDL_Event event;
@@ -615,32 +825,24 @@ int main(int argc, char** argv) {
       } else if (event.type == SDL_KEYDOWN &&
                  event.key.keysym.sym == SDLK_TAB) {
         engine.selected_form_factor ^= 1;
+        needs_redraw = 1;
+      } else if (event.type == SDL_WINDOWEVENT) {
+        needs_redraw = 1;
       }
     }
 
-    const FormFactorAssets* assets =
-        &engine.form_factors[engine.selected_form_factor];
-    SDL_RenderClear(engine.app.renderer);
-    /* Render background texture. */
-    SDL_RenderCopy(engine.app.renderer, assets->images[kNumTactors],
-                   NULL, &assets->image_rects[kNumTactors]);
-
-    int c;
-    for (c = 0; c < kNumTactors; ++c) {
-      /* Get volume for the cth tactor. */
-      float activation = engine.volume[c] / 0.4f;
-      if (activation < 0.0f) { activation = 0.0f; }
-      if (activation > 1.0f) { activation = 1.0f; }
-
-      /* Render the cth texture with color according to `activation`. */
-      const int index = (int)(255 * activation + 0.5f);
-      const uint8_t* rgb = &colormap[3 * index];
-      SDL_SetTextureColorMod(assets->images[c], rgb[0], rgb[1], rgb[2]);
-      SDL_RenderCopy(engine.app.renderer, assets->images[c],
-                     NULL, &assets->image_rects[c]);
+    /* Redraw only when the meters or the window changed. */
+    const MeterSnapshot* latest = PollMeterSnapshot(&engine);
+    if (latest &&
+        memcmp(latest->volume, snapshot.volume, sizeof(snapshot.volume))) {
+      snapshot = *latest;
+      needs_redraw = 1;
+    }
+    if (needs_redraw) {
+      TRACE_EVENT_SCOPE("render");
+      if (!Render(&engine, colormap, &snapshot)) { goto done; }
+      needs_redraw = 0;
     }
-
-    SDL_RenderPresent(engine.app.renderer);
     Pa_Sleep(25);
   }
 
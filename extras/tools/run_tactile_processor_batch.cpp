@@ -0,0 +1,403 @@
+// Copyright 2022 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+// Runs TactileProcessor offline on a list of WAV files.
+//
+// This is a headless program for batch evaluation of the audio-to-tactile
+// processing. For each input WAV file, it runs TactileProcessor, PostProcessor,
+// and the channel map, and writes the tactile signals as a multichannel 16-bit
+// WAV file. Tuning knobs and the channel map are optionally read from a device
+// settings file (see src/cpp/settings.h), so that results match a device.
+//
+// Files are processed in parallel on a TaskPool (see task_pool.h). Each worker
+// starts with a contiguous range of the manifest and steals files from other
+// workers when its range is done, so that threads stay busy when file
+// durations vary. Every file is processed
+// with its own TactileProcessor and PostProcessor and read as a stream (see
+// src/dsp/read_wav_stream.h), so memory use is constant in the file length.
+//
+// The manifest is a text file with one input WAV path per line. Optionally, an
+// output path follows the input path, separated by a tab. Otherwise the output
+// is written to --output_dir with the same base name as the input. Blank lines
+// and lines starting with '#' are ignored.
+//
+// A line of timing stats is printed for each file, followed by a summary. With
+// --stats_csv, per-file stats are also written as CSV.
+//
+// Flags:
+//  --manifest=<path>          Manifest text file listing the input WAV files.
+//  --output_dir=<path>        Output directory (default ".").
+//  --settings=<path>          Optional device settings file.
+//  --num_threads=<int>        Number of worker threads. Default is the number
+//                             of hardware threads.
+//  --block_size=<int>         TactileProcessor block_size. Must be power of 2.
+//  --decimation_factor=<int>  Decimation factor of the tactile output.
+//  --gain_db=<float>          Overall output gain in dB.
+//  --cutoff_hz=<float>        PostProcessor lowpass cutoff in Hz (default 975).
+//  --stats_csv=<path>         Optional CSV file to write per-file stats.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "extras/tools/task_pool.h"
+#include "extras/tools/util.h"
+#include "src/cpp/settings.h"
+#include "src/dsp/convert_sample.h"
+#include "src/dsp/decibels.h"
+#include "src/dsp/read_wav_stream.h"
+#include "src/dsp/write_wav_file.h"
+#include "src/tactile/post_processor.h"
+#include "src/tactile/tactile_processor.h"
+#include "src/tactile/tuning.h"
+
+namespace {
+
+using ::audio_tactile::Settings;
+
+struct Options {
+  TactileProcessorParams params;
+  PostProcessorParams post_processor_params;
+  Settings settings;
+};
+
+struct Task {
+  std::string input;
+  std::string output;
+  // Results, set by the worker that processes the task.
+  bool success = false;
+  double audio_s = 0.0;
+  double wall_s = 0.0;
+};
+
+// Returns the final component of `path`.
+std::string BaseName(const std::string& path) {
+  const size_t slash = path.find_last_of('/');
+  return (slash == std::string::npos) ? path : path.substr(slash + 1);
+}
+
+// Reads the manifest. Returns false on failure.
+bool ReadManifest(const char* manifest_file, const std::string& output_dir,
+                  std::vector<Task>* tasks) {
+  FILE* f = fopen(manifest_file, "rt");
+  if (!f) {
+    fprintf(stderr, "Error: Failed to open \"%s\".\n", manifest_file);
+    return false;
+  }
+  char line[1024];
+  while (fgets(line, sizeof(line), f)) {
+    std::string s(line);
+    while (!s.empty() && (s.back() == '\n' || s.back() == '\r')) {
+      s.pop_back();
+    }
+    if (s.empty() || s[0] == '#') { continue; }
+
+    Task task;
+    const size_t tab = s.find('\t');
+    if (tab != std::string::npos) {
+      task.input = s.substr(0, tab);
+      task.output = s.substr(tab + 1);
+    } else {
+      task.input = s;
+      task.output = output_dir + "/" + BaseName(s);
+    }
+    tasks->push_back(task);
+  }
+  fclose(f);
+  return true;
+}
+
+// Reads a device settings file into `settings`. Returns false on failure.
+bool ReadSettingsFile(const char* settings_file, Settings* settings) {
+  FILE* f = fopen(settings_file, "rt");
+  if (!f) {
+    fprintf(stderr, "Error: Failed to open \"%s\".\n", settings_file);
+    return false;
+  }
+  bool success = true;
+  settings->ReadFile(
+      [f](char* buffer, int buffer_size) {
+        return fgets(buffer, buffer_size, f) != nullptr;
+      },
+      [settings_file, &success](int line_number, const char* message) {
+        fprintf(stderr, "Error: %s:%d: %s\n",
+                settings_file, line_number, message);
+        success = false;
+      });
+  fclose(f);
+  return success;
+}
+
+// Processes one file. Returns true on success.
+bool ProcessFile(const Options& options, Task* task) {
+  const auto start_time = std::chrono::steady_clock::now();
+  const int block_size = options.params.frontend_params.block_size;
+  const int decimation_factor = options.params.decimation_factor;
+  const int kNumTactors = kTactileProcessorNumTactors;
+  const ChannelMap& channel_map = options.settings.channel_map;
+  const int num_output_channels = channel_map.num_output_channels;
+
+  ReadWavStream* stream = nullptr;
+  TactileProcessor* processor = nullptr;
+  FILE* f_out = nullptr;
+  bool success = false;
+  size_t num_output_frames = 0;
+
+  TactileProcessorParams params = options.params;
+  PostProcessorParams post_processor_params = options.post_processor_params;
+  PostProcessor post_processor;
+  std::vector<float> mono(block_size);
+  std::vector<float> tactile(block_size / decimation_factor * kNumTactors);
+  std::vector<float> mapped(block_size / decimation_factor *
+                            num_output_channels);
+  std::vector<int16_t> output_int16(mapped.size());
+  const float input_gain = TuningGetInputGain(&options.settings.tuning);
+  int sample_rate_hz;
+  int num_channels;
+
+  stream = ReadWavStreamOpen(task->input.c_str(), block_size);
+  if (!stream) { goto done; }  // ReadWavStreamOpen prints the error.
+  sample_rate_hz = ReadWavStreamSampleRateHz(stream);
+  num_channels = ReadWavStreamNumChannels(stream);
+
+  params.frontend_params.input_sample_rate_hz = sample_rate_hz;
+  processor = TactileProcessorMake(&params);
+  if (!processor) {
+    fprintf(stderr, "Error: %s: TactileProcessorMake failed.\n",
+            task->input.c_str());
+    goto done;
+  }
+  TactileProcessorApplyTuning(processor, &options.settings.tuning);
+
+  if (!PostProcessorInit(&post_processor, &post_processor_params,
+                         TactileProcessorOutputSampleRateHz(&params),
+                         kNumTactors)) {
+    fprintf(stderr, "Error: %s: PostProcessorInit failed.\n",
+            task->input.c_str());
+    goto done;
+  }
+
+  f_out = fopen(task->output.c_str(), "wb");
+  if (!f_out) {
+    fprintf(stderr, "Error: Failed to create \"%s\".\n", task->output.c_str());
+    goto done;
+  }
+  // Write a placeholder header. It is rewritten once the length is known.
+  if (!WriteWavHeader(f_out, 0,
+                      static_cast<int>(TactileProcessorOutputSampleRateHz(
+                          &params)),
+                      num_output_channels)) {
+    goto done;
+  }
+
+  for (;;) {
+    int num_frames;
+    const float* input = ReadWavStreamNextBlock(stream, &num_frames);
+    if (!input) { break; }
+
+    // Mix down to mono and apply the input gain.
+    const float scale = input_gain / num_channels;
+    for (int i = 0; i < block_size; ++i, input += num_channels) {
+      float sum = 0.0f;
+      for (int c = 0; c < num_channels; ++c) { sum += input[c]; }
+      mono[i] = scale * sum;
+    }
+
+    TactileProcessorProcessSamples(processor, mono.data(), tactile.data());
+    const int num_tactile_frames = block_size / decimation_factor;
+    PostProcessorProcessSamples(&post_processor, tactile.data(),
+                                num_tactile_frames);
+    ChannelMapApply(&channel_map, tactile.data(), num_tactile_frames,
+                    mapped.data());
+    ConvertSampleArrayFloatToInt16(mapped.data(),
+                                   static_cast<int>(mapped.size()),
+                                   output_int16.data());
+    if (!WriteWavSamples(f_out, output_int16.data(), output_int16.size())) {
+      goto done;
+    }
+    num_output_frames += num_tactile_frames;
+  }
+
+  if (fseek(f_out, 0, SEEK_SET) ||
+      !WriteWavHeader(f_out, num_output_frames * num_output_channels,
+                      static_cast<int>(TactileProcessorOutputSampleRateHz(
+                          &params)),
+                      num_output_channels)) {
+    fprintf(stderr, "Error: Failed to write \"%s\".\n", task->output.c_str());
+    goto done;
+  }
+
+  task->audio_s = static_cast<double>(num_output_frames) * decimation_factor /
+                  sample_rate_hz;
+  success = true;
+done:
+  if (f_out && fclose(f_out)) {
+    fprintf(stderr, "Error: Failed to write \"%s\".\n", task->output.c_str());
+    success = false;
+  }
+  TactileProcessorFree(processor);
+  ReadWavStreamClose(stream);
+
+  task->wall_s = std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - start_time).count();
+  task->success = success;
+  return success;
+}
+
+// Writes per-file stats as CSV. Returns false on failure.
+bool WriteStatsCsv(const char* stats_csv, const std::vector<Task>& tasks) {
+  FILE* f = fopen(stats_csv, "wt");
+  if (!f) {
+    fprintf(stderr, "Error: Failed to create \"%s\".\n", stats_csv);
+    return false;
+  }
+  fprintf(f, "input,output,success,audio_s,wall_s,realtime_factor\n");
+  for (const Task& task : tasks) {
+    fprintf(f, "%s,%s,%d,%.4f,%.4f,%.2f\n", task.input.c_str(),
+            task.output.c_str(), task.success ? 1 : 0, task.audio_s,
+            task.wall_s, task.wall_s > 0.0 ? task.audio_s / task.wall_s : 0.0);
+  }
+  if (fclose(f)) {
+    fprintf(stderr, "Error: Failed to write \"%s\".\n", stats_csv);
+    return false;
+  }
+  return true;
+}
+
+// Context for ProcessFileTask().
+struct BatchContext {
+  const Options* options;
+  std::vector<Task>* tasks;
+  std::mutex print_mutex;
+};
+
+// Task for TaskPoolRun(), processing one file.
+void ProcessFileTask(void* arg, int i) {
+  BatchContext* context = static_cast<BatchContext*>(arg);
+  Task& task = (*context->tasks)[i];
+  ProcessFile(*context->options, &task);
+  std::lock_guard<std::mutex> lock(context->print_mutex);
+  if (task.success) {
+    printf("%s: %.2f s audio in %.3f s (%.1fx realtime)\n",
+           task.input.c_str(), task.audio_s, task.wall_s,
+           task.wall_s > 0.0 ? task.audio_s / task.wall_s : 0.0);
+  } else {
+    printf("%s: FAILED\n", task.input.c_str());
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  Options options;
+  TactileProcessorSetDefaultParams(&options.params);
+  PostProcessorSetDefaultParams(&options.post_processor_params);
+  // Same cutoff as the firmware's PostProcessorWrapper, which is below Nyquist
+  // for the 2 kHz output rate with decimation_factor 8.
+  options.post_processor_params.cutoff_hz = 975.0f;
+  const char* manifest_file = nullptr;
+  const char* settings_file = nullptr;
+  const char* stats_csv = nullptr;
+  std::string output_dir = ".";
+  int num_threads = static_cast<int>(std::thread::hardware_concurrency());
+
+  for (int i = 1; i < argc; ++i) {  // Parse flags.
+    if (StartsWith(argv[i], "--manifest=")) {
+      manifest_file = strchr(argv[i], '=') + 1;
+    } else if (StartsWith(argv[i], "--output_dir=")) {
+      output_dir = strchr(argv[i], '=') + 1;
+    } else if (StartsWith(argv[i], "--settings=")) {
+      settings_file = strchr(argv[i], '=') + 1;
+    } else if (StartsWith(argv[i], "--num_threads=")) {
+      num_threads = atoi(strchr(argv[i], '=') + 1);
+    } else if (StartsWith(argv[i], "--block_size=")) {
+      options.params.frontend_params.block_size =
+          atoi(strchr(argv[i], '=') + 1);
+    } else if (StartsWith(argv[i], "--decimation_factor=")) {
+      options.params.decimation_factor = atoi(strchr(argv[i], '=') + 1);
+    } else if (StartsWith(argv[i], "--gain_db=")) {
+      options.post_processor_params.gain =
+          DecibelsToAmplitudeRatio(atof(strchr(argv[i], '=') + 1));
+    } else if (StartsWith(argv[i], "--cutoff_hz=")) {
+      options.post_processor_params.cutoff_hz = atof(strchr(argv[i], '=') + 1);
+    } else if (StartsWith(argv[i], "--stats_csv=")) {
+      stats_csv = strchr(argv[i], '=') + 1;
+    } else {
+      fprintf(stderr, "Error: Invalid flag \"%s\"\n", argv[i]);
+      return EXIT_FAILURE;
+    }
+  }
+
+  if (manifest_file == nullptr) {
+    fprintf(stderr, "Error: Must specify --manifest\n");
+    return EXIT_FAILURE;
+  }
+  const int block_size = options.params.frontend_params.block_size;
+  const int decimation_factor = options.params.decimation_factor;
+  if (block_size < 1 || decimation_factor < 1 ||
+      block_size % decimation_factor != 0) {
+    fprintf(stderr, "Error: block_size must be a multiple of "
+            "decimation_factor.\n");
+    return EXIT_FAILURE;
+  }
+  if (settings_file && !ReadSettingsFile(settings_file, &options.settings)) {
+    return EXIT_FAILURE;
+  }
+
+  std::vector<Task> tasks;
+  if (!ReadManifest(manifest_file, output_dir, &tasks)) { return EXIT_FAILURE; }
+  if (tasks.empty()) {
+    fprintf(stderr, "Error: No input files in \"%s\".\n", manifest_file);
+    return EXIT_FAILURE;
+  }
+  num_threads = std::min<int>(std::max(num_threads, 1), tasks.size());
+
+  const auto start_time = std::chrono::steady_clock::now();
+  // The calling thread works on files too.
+  TaskPool* pool = TaskPoolMake(num_threads - 1);
+  if (pool == nullptr) { return EXIT_FAILURE; }
+  BatchContext context;
+  context.options = &options;
+  context.tasks = &tasks;
+  TaskPoolRun(pool, ProcessFileTask, &context, static_cast<int>(tasks.size()));
+  TaskPoolFree(pool);
+  const double wall_s = std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - start_time).count();
+
+  int num_failed = 0;
+  double audio_s = 0.0;
+  double cpu_s = 0.0;
+  for (const Task& task : tasks) {
+    if (!task.success) { ++num_failed; }
+    audio_s += task.audio_s;
+    cpu_s += task.wall_s;
+  }
+  printf("\nProcessed %d files (%d failed) with %d threads.\n"
+         "Total audio: %.2f s, thread time: %.3f s, wall time: %.3f s "
+         "(%.1fx realtime).\n",
+         static_cast<int>(tasks.size()), num_failed, num_threads, audio_s,
+         cpu_s, wall_s, wall_s > 0.0 ? audio_s / wall_s : 0.0);
+
+  if (stats_csv && !WriteStatsCsv(stats_csv, tasks)) { return EXIT_FAILURE; }
+  return num_failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
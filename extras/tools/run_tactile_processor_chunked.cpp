@@ -0,0 +1,373 @@
+// Copyright 2022 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+// Runs TactileProcessor offline on one long WAV file, in parallel chunks.
+//
+// TactileProcessor and PostProcessor are stateful, so a long recording is
+// normally processed serially. This program instead splits the file into
+// segments and processes them in parallel on a TaskPool, each segment
+// with its own TactileProcessor and PostProcessor:
+//
+//  * Each segment starts processing --warmup_s seconds before its own range,
+//    and discards that output, so that the Enveloper noise estimates and PCEN
+//    state have (mostly) converged by the time its output is used.
+//
+//  * Consecutive segments overlap by --crossfade_s seconds of output, where the
+//    output is linearly crossfaded from the earlier to the later segment.
+//
+// The result approximates serial processing. Unless --skip_serial is set, the
+// file is also processed serially and the error of the chunked output relative
+// to it is reported, overall and at each segment boundary. The warm-up should
+// be increased if the error is too large.
+//
+// The input is read into memory and mixed down to mono. The output is the 10
+// tactile channels (see src/tactile/tactile_processor.h) after PostProcessor,
+// written as a 16-bit WAV file.
+//
+// Flags:
+//  --input=<path>             Input WAV file.
+//  --output=<path>            Output WAV file.
+//  --num_threads=<int>        Number of worker threads. Default is the number
+//                             of hardware threads.
+//  --num_segments=<int>       Number of segments. Default is --num_threads.
+//  --warmup_s=<float>         Warm-up before each segment (default 5.0).
+//  --crossfade_s=<float>      Crossfade between segments (default 0.05).
+//  --block_size=<int>         TactileProcessor block_size. Must be power of 2.
+//  --decimation_factor=<int>  Decimation factor of the tactile output.
+//  --cutoff_hz=<float>        PostProcessor lowpass cutoff in Hz (default 975).
+//  --skip_serial              Don't run serial processing to report error.
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "extras/tools/task_pool.h"
+#include "extras/tools/util.h"
+#include "src/dsp/convert_sample.h"
+#include "src/dsp/read_wav_file.h"
+#include "src/dsp/write_wav_file.h"
+#include "src/tactile/post_processor.h"
+#include "src/tactile/tactile_processor.h"
+
+namespace {
+
+struct Options {
+  TactileProcessorParams params;
+  PostProcessorParams post_processor_params;
+};
+
+// One segment of the input. Ranges are in blocks of input.
+struct Segment {
+  // Processing runs over blocks [process_begin, end), and output is kept for
+  // blocks [output_begin, end). The segment's own range is [begin, end); the
+  // output for [output_begin, begin) is crossfaded with the previous segment.
+  int process_begin;
+  int output_begin;
+  int begin;
+  int end;
+  // Results, set by the worker that processes the segment.
+  std::vector<float> output;
+  bool success = false;
+  double wall_s = 0.0;
+};
+
+// Processes blocks [process_begin, end) of `input`, keeping output for blocks
+// at or after `output_begin`. Returns false on failure.
+bool ProcessRange(const Options& options, const std::vector<float>& input,
+                  int process_begin, int output_begin, int end,
+                  std::vector<float>* output) {
+  TactileProcessorParams params = options.params;
+  const int block_size = params.frontend_params.block_size;
+  const int output_block_size =
+      kTactileProcessorNumTactors * block_size / params.decimation_factor;
+  const int output_frames = block_size / params.decimation_factor;
+
+  TactileProcessor* processor = TactileProcessorMake(&params);
+  if (!processor) {
+    fprintf(stderr, "Error: TactileProcessorMake failed.\n");
+    return false;
+  }
+  PostProcessor post_processor;
+  if (!PostProcessorInit(&post_processor, &options.post_processor_params,
+                         TactileProcessorOutputSampleRateHz(&params),
+                         kTactileProcessorNumTactors)) {
+    fprintf(stderr, "Error: PostProcessorInit failed.\n");
+    TactileProcessorFree(processor);
+    return false;
+  }
+
+  output->resize(static_cast<size_t>(end - output_begin) * output_block_size);
+  std::vector<float> discard(output_block_size);
+  for (int b = process_begin; b < end; ++b) {
+    float* tactile = (b >= output_begin)
+        ? output->data() + static_cast<size_t>(b - output_begin) *
+                           output_block_size
+        : discard.data();
+    TactileProcessorProcessSamples(
+        processor, input.data() + static_cast<size_t>(b) * block_size,
+        tactile);
+    PostProcessorProcessSamples(&post_processor, tactile, output_frames);
+  }
+
+  TactileProcessorFree(processor);
+  return true;
+}
+
+// Reads `input_file` and mixes down to mono, zero-padded to whole blocks.
+bool ReadInput(const char* input_file, int block_size,
+               std::vector<float>* mono, int* sample_rate_hz) {
+  size_t num_samples;
+  int num_channels;
+  int32_t* samples = ReadWavFile(input_file, &num_samples, &num_channels,
+                                 sample_rate_hz);
+  if (!samples) {
+    fprintf(stderr, "Error: Failed to read \"%s\".\n", input_file);
+    return false;
+  }
+  const size_t num_frames = num_samples / num_channels;
+  const size_t num_blocks = (num_frames + block_size - 1) / block_size;
+  mono->assign(num_blocks * block_size, 0.0f);
+  const float scale = 1.0f / num_channels;
+  for (size_t i = 0; i < num_frames; ++i) {
+    float sum = 0.0f;
+    for (int c = 0; c < num_channels; ++c) {
+      sum += ConvertSampleInt32ToFloat(samples[i * num_channels + c]);
+    }
+    (*mono)[i] = scale * sum;
+  }
+  free(samples);
+  return true;
+}
+
+// Context for ProcessSegmentTask().
+struct ChunkedContext {
+  const Options* options;
+  const std::vector<float>* input;
+  std::vector<Segment>* segments;
+};
+
+// Task for TaskPoolRun(), processing one segment.
+void ProcessSegmentTask(void* arg, int k) {
+  ChunkedContext* context = static_cast<ChunkedContext*>(arg);
+  Segment& segment = (*context->segments)[k];
+  const auto start_time = std::chrono::steady_clock::now();
+  segment.success = ProcessRange(
+      *context->options, *context->input, segment.process_begin,
+      segment.output_begin, segment.end, &segment.output);
+  segment.wall_s = std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - start_time).count();
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  Options options;
+  TactileProcessorSetDefaultParams(&options.params);
+  PostProcessorSetDefaultParams(&options.post_processor_params);
+  // Same cutoff as run_tactile_processor_batch.
+  options.post_processor_params.cutoff_hz = 975.0f;
+  const char* input_file = nullptr;
+  const char* output_file = nullptr;
+  int num_threads = static_cast<int>(std::thread::hardware_concurrency());
+  int num_segments = 0;
+  float warmup_s = 5.0f;
+  float crossfade_s = 0.05f;
+  bool skip_serial = false;
+
+  for (int i = 1; i < argc; ++i) {  // Parse flags.
+    if (StartsWith(argv[i], "--input=")) {
+      input_file = strchr(argv[i], '=') + 1;
+    } else if (StartsWith(argv[i], "--output=")) {
+      output_file = strchr(argv[i], '=') + 1;
+    } else if (StartsWith(argv[i], "--num_threads=")) {
+      num_threads = atoi(strchr(argv[i], '=') + 1);
+    } else if (StartsWith(argv[i], "--num_segments=")) {
+      num_segments = atoi(strchr(argv[i], '=') + 1);
+    } else if (StartsWith(argv[i], "--warmup_s=")) {
+      warmup_s = atof(strchr(argv[i], '=') + 1);
+    } else if (StartsWith(argv[i], "--crossfade_s=")) {
+      crossfade_s = atof(strchr(argv[i], '=') + 1);
+    } else if (StartsWith(argv[i], "--block_size=")) {
+      options.params.frontend_params.block_size =
+          atoi(strchr(argv[i], '=') + 1);
+    } else if (StartsWith(argv[i], "--decimation_factor=")) {
+      options.params.decimation_factor = atoi(strchr(argv[i], '=') + 1);
+    } else if (StartsWith(argv[i], "--cutoff_hz=")) {
+      options.post_processor_params.cutoff_hz = atof(strchr(argv[i], '=') + 1);
+    } else if (!strcmp(argv[i], "--skip_serial")) {
+      skip_serial = true;
+    } else {
+      fprintf(stderr, "Error: Invalid flag \"%s\"\n", argv[i]);
+      return EXIT_FAILURE;
+    }
+  }
+
+  if (input_file == nullptr || output_file == nullptr) {
+    fprintf(stderr, "Error: Must specify --input and --output\n");
+    return EXIT_FAILURE;
+  }
+  const int block_size = options.params.frontend_params.block_size;
+  const int decimation_factor = options.params.decimation_factor;
+  if (block_size < 1 || decimation_factor < 1 ||
+      block_size % decimation_factor != 0) {
+    fprintf(stderr, "Error: block_size must be a multiple of "
+            "decimation_factor.\n");
+    return EXIT_FAILURE;
+  } else if (!(warmup_s >= 0.0f) || !(crossfade_s >= 0.0f)) {
+    fprintf(stderr, "Error: warmup_s and crossfade_s must be nonnegative.\n");
+    return EXIT_FAILURE;
+  }
+
+  std::vector<float> input;
+  int sample_rate_hz;
+  if (!ReadInput(input_file, block_size, &input, &sample_rate_hz)) {
+    return EXIT_FAILURE;
+  }
+  options.params.frontend_params.input_sample_rate_hz = sample_rate_hz;
+  const int num_blocks = static_cast<int>(input.size() / block_size);
+  const int output_frames = block_size / decimation_factor;
+  const int output_block_size = kTactileProcessorNumTactors * output_frames;
+  const int warmup_blocks =
+      static_cast<int>(ceil(warmup_s * sample_rate_hz / block_size));
+  const int crossfade_blocks =
+      static_cast<int>(ceil(crossfade_s * sample_rate_hz / block_size));
+
+  num_threads = std::max(num_threads, 1);
+  if (num_segments < 1) { num_segments = num_threads; }
+  // Each segment must be longer than the crossfade.
+  num_segments = std::max(std::min(
+      num_segments, num_blocks / (crossfade_blocks + 1)), 1);
+  num_threads = std::min(num_threads, num_segments);
+
+  std::vector<Segment> segments(num_segments);
+  for (int k = 0; k < num_segments; ++k) {
+    Segment& segment = segments[k];
+    segment.begin = static_cast<int>(
+        static_cast<int64_t>(k) * num_blocks / num_segments);
+    segment.end = static_cast<int>(
+        static_cast<int64_t>(k + 1) * num_blocks / num_segments);
+    segment.output_begin = std::max(segment.begin - crossfade_blocks, 0);
+    segment.process_begin = std::max(segment.output_begin - warmup_blocks, 0);
+  }
+
+  // Process segments in parallel.
+  const auto start_time = std::chrono::steady_clock::now();
+  // The calling thread works on segments too.
+  TaskPool* pool = TaskPoolMake(num_threads - 1);
+  if (pool == nullptr) { return EXIT_FAILURE; }
+  ChunkedContext context;
+  context.options = &options;
+  context.input = &input;
+  context.segments = &segments;
+  TaskPoolRun(pool, ProcessSegmentTask, &context, num_segments);
+  TaskPoolFree(pool);
+  const double chunked_wall_s = std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - start_time).count();
+
+  // Stitch the segments, crossfading where they overlap.
+  std::vector<float> output(static_cast<size_t>(num_blocks) *
+                            output_block_size);
+  for (int k = 0; k < num_segments; ++k) {
+    const Segment& segment = segments[k];
+    if (!segment.success) { return EXIT_FAILURE; }
+    const size_t offset =
+        static_cast<size_t>(segment.output_begin) * output_block_size;
+    const int num_crossfade_frames =
+        (segment.begin - segment.output_begin) * output_frames;
+    for (int i = 0; i < num_crossfade_frames; ++i) {
+      const float weight = (i + 0.5f) / num_crossfade_frames;
+      for (int c = 0; c < kTactileProcessorNumTactors; ++c) {
+        const size_t j = i * kTactileProcessorNumTactors + c;
+        output[offset + j] += weight * (segment.output[j] - output[offset + j]);
+      }
+    }
+    const size_t num_crossfade_samples =
+        static_cast<size_t>(num_crossfade_frames) * kTactileProcessorNumTactors;
+    std::copy(segment.output.begin() + num_crossfade_samples,
+              segment.output.end(),
+              output.begin() + offset + num_crossfade_samples);
+  }
+
+  const double audio_s = static_cast<double>(num_blocks) * block_size /
+                         sample_rate_hz;
+  printf("Processed %.2f s audio in %d segments with %d threads, "
+         "warm-up %d blocks, crossfade %d blocks.\n"
+         "Chunked wall time: %.3f s (%.1fx realtime).\n",
+         audio_s, num_segments, num_threads, warmup_blocks, crossfade_blocks,
+         chunked_wall_s, chunked_wall_s > 0.0 ? audio_s / chunked_wall_s : 0.0);
+
+  if (!skip_serial) {
+    const auto serial_start_time = std::chrono::steady_clock::now();
+    std::vector<float> serial;
+    if (!ProcessRange(options, input, 0, 0, num_blocks, &serial)) {
+      return EXIT_FAILURE;
+    }
+    const double serial_wall_s = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - serial_start_time).count();
+    printf("Serial wall time: %.3f s (%.1fx realtime), speedup %.2fx.\n",
+           serial_wall_s, serial_wall_s > 0.0 ? audio_s / serial_wall_s : 0.0,
+           chunked_wall_s > 0.0 ? serial_wall_s / chunked_wall_s : 0.0);
+
+    // Report the max error over each segment, which is largest near its start,
+    // and the overall error relative to the serial output.
+    double sum_error2 = 0.0;
+    double sum_serial2 = 0.0;
+    float max_error = 0.0f;
+    for (int k = 0; k < num_segments; ++k) {
+      const Segment& segment = segments[k];
+      float segment_max_error = 0.0f;
+      for (size_t j = static_cast<size_t>(segment.output_begin) *
+                      output_block_size;
+           j < static_cast<size_t>(segment.end) * output_block_size; ++j) {
+        const float error = fabs(output[j] - serial[j]);
+        segment_max_error = std::max(segment_max_error, error);
+      }
+      max_error = std::max(max_error, segment_max_error);
+      printf("Segment %d at %.2f s: max error %.3g\n", k,
+             static_cast<double>(segment.begin) * block_size / sample_rate_hz,
+             segment_max_error);
+    }
+    for (size_t j = 0; j < output.size(); ++j) {
+      const double error = output[j] - serial[j];
+      sum_error2 += error * error;
+      sum_serial2 += static_cast<double>(serial[j]) * serial[j];
+    }
+    const double rms_error = sqrt(sum_error2 / output.size());
+    printf("Max error: %.3g, RMS error: %.3g (%.1f dB relative to serial).\n",
+           max_error, rms_error,
+           (sum_error2 > 0.0 && sum_serial2 > 0.0)
+               ? 10.0 * log10(sum_error2 / sum_serial2) : -INFINITY);
+  }
+
+  std::vector<int16_t> output_int16(output.size());
+  ConvertSampleArrayFloatToInt16(output.data(),
+                                 static_cast<int>(output.size()),
+                                 output_int16.data());
+  if (!WriteWavFile(output_file, output_int16.data(), output_int16.size(),
+                    static_cast<int>(TactileProcessorOutputSampleRateHz(
+                        &options.params)),
+                    kTactileProcessorNumTactors)) {
+    fprintf(stderr, "Error: Failed to write \"%s\".\n", output_file);
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
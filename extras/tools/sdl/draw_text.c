@@ -569,16 +569,82 @@ int DrawTextInitFontTexture(SDL_Renderer* renderer) {
 void DrawTextFreeFontTexture(void) {
   if (font_texture) {
     SDL_DestroyTexture(font_texture);
+    font_texture = NULL;
   }
 }
 
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+/* Max number of characters submitted in one SDL_RenderGeometry() call. */
+#define kMaxCharsPerBatch 64
+
+/* Draws `str` as one batch of textured quads per kMaxCharsPerBatch chars. */
+static void DrawTextGeometry(SDL_Renderer* renderer, int x, int y,
+                             const char* str, int num_chars) {
+  SDL_Vertex vertices[4 * kMaxCharsPerBatch];
+  int indices[6 * kMaxCharsPerBatch];
+  SDL_Color color;
+  SDL_GetTextureColorMod(font_texture, &color.r, &color.g, &color.b);
+  color.a = 0xff;
+  const float kCharV = 1.0f / kFontNumChars;
+  int num_quads = 0;
+  int i;
+
+  /* Vertex colors carry the text color, so the texture color mod is set to
+   * white while drawing in case the renderer applies both.
+   */
+  SDL_SetTextureColorMod(font_texture, 0xff, 0xff, 0xff);
+  for (i = 0; i < num_chars; ++i, x += kFontCharWidth) {
+    const unsigned char c = str[i];
+    if (33 <= c && c < 33 + kFontNumChars) { /* A printable character. */
+      SDL_Vertex* v = vertices + 4 * num_quads;
+      int* index = indices + 6 * num_quads;
+      const float v0 = kCharV * (c - 33);
+      int k;
+      for (k = 0; k < 4; ++k) {
+        const int right = k & 1;
+        const int bottom = k >> 1;
+        v[k].position.x = (float)(x + right * kFontCharWidth);
+        v[k].position.y = (float)(y + bottom * kFontCharHeight);
+        v[k].color = color;
+        v[k].tex_coord.x = (float)right;
+        v[k].tex_coord.y = v0 + bottom * kCharV;
+      }
+      /* Two triangles per quad. */
+      index[0] = 4 * num_quads;
+      index[1] = index[0] + 1;
+      index[2] = index[0] + 2;
+      index[3] = index[0] + 1;
+      index[4] = index[0] + 3;
+      index[5] = index[0] + 2;
+
+      if (++num_quads == kMaxCharsPerBatch) {
+        SDL_RenderGeometry(renderer, font_texture, vertices, 4 * num_quads,
+                           indices, 6 * num_quads);
+        num_quads = 0;
+      }
+    }
+  }
+  if (num_quads > 0) {
+    SDL_RenderGeometry(renderer, font_texture, vertices, 4 * num_quads,
+                       indices, 6 * num_quads);
+  }
+  SDL_SetTextureColorMod(font_texture, color.r, color.g, color.b);
+}
+#endif /* SDL_VERSION_ATLEAST(2, 0, 18) */
+
 void DrawText(SDL_Renderer* renderer, int x, int y, const char* format, ...) {
   char str[1024];
   va_list args;
   va_start(args, format);
-  int num_chars = vsprintf(str, format, args);
+  int num_chars = vsnprintf(str, sizeof(str), format, args);
   va_end(args);
+  if (num_chars < 0) { return; }
+  if (num_chars >= (int)sizeof(str)) { num_chars = sizeof(str) - 1; }
 
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+  /* Submit the string as batches of quads rather than a copy per char. */
+  DrawTextGeometry(renderer, x, y, str, num_chars);
+#else
   SDL_Rect source_rect;
   source_rect.x = 0;
   source_rect.y = 0;
@@ -603,6 +669,7 @@ void DrawText(SDL_Renderer* renderer, int x, int y, const char* format, ...) {
       SDL_RenderCopy(renderer, font_texture, &source_rect, &dest_rect);
     }
   }
+#endif /* SDL_VERSION_ATLEAST(2, 0, 18) */
 }
 
 int DrawTextSetColor(uint8_t r, uint8_t g, uint8_t b) {
@@ -22,7 +22,9 @@
  *
  * `DrawText()` is a simple function that is good for such dynamic text. It
  * efficiently renders given text to the current rendering target, without
- * allocating resources.
+ * allocating resources. The glyphs are in a single font texture created once,
+ * and with SDL 2.0.18 or later, each string is submitted as one batch of
+ * textured quads with SDL_RenderGeometry().
  */
 
 #ifndef AUDIO_TO_TACTILE_EXTRAS_TOOLS_SDL_DRAW_TEXT_H_
@@ -21,14 +21,75 @@
 
 #include "src/dsp/serialize.h"
 
-SDL_Texture* CreateTextureFromRleData(const uint8_t* encoded,
-                                      SDL_Renderer* renderer, SDL_Rect* rect) {
-  /* Decode the rectangle from the first 8 bytes. */
+/* Reads the rectangle from the first 8 bytes of `encoded`. */
+static void ReadRleRect(const uint8_t* encoded, SDL_Rect* rect) {
   rect->x = BigEndianReadU16(encoded);
   rect->y = BigEndianReadU16(encoded + 2);
   rect->w = BigEndianReadU16(encoded + 4);
   rect->h = BigEndianReadU16(encoded + 6);
-  encoded += 8;
+}
+
+/* Decodes the `w` by `h` image of `encoded` into `argb_data`, where `stride` is
+ * the number of pixels between rows. Returns 1 on success, 0 on failure.
+ */
+static int DecodeRleImage(const uint8_t* encoded, int w, int h, int stride,
+                          uint32_t* argb_data) {
+  encoded += 8;  /* Skip the rectangle. */
+  const size_t num_pixels = (size_t)w * (size_t)h;
+  uint32_t* dest = argb_data;
+  int row_remaining = w;  /* Pixels left in the current row. */
+
+  /* Image data is run-length encoded in TGA format. Pixels are encoded in
+   * "packets". There are two kinds: "run-length packets" and "raw packets".
+   */
+  size_t i;
+  for (i = 0; i < num_pixels;) {
+    /* Each packet starts with a one-byte packet header. The high bit indicates
+     * the kind of packet. The lower 7 bits encodes the length `n` minus one.
+     */
+    const unsigned packet_header = *(encoded++);
+    const int is_run = packet_header >> 7;
+    int n = 1 + (packet_header & 0x7f);
+    if (i + n > num_pixels) {
+      fprintf(stderr, "Error: Corrupt image data\n");
+      return 0;
+    }
+    i += n;
+
+    /* Packets may span rows. Expand the packet in spans that end at row ends,
+     * so that the inner loops are simple 32-bit fills and conversions that the
+     * compiler can vectorize.
+     */
+    const uint32_t run_value = ((uint32_t)*encoded << 24) | 0xffffffUL;
+    while (n > 0) {
+      const int span = (n < row_remaining) ? n : row_remaining;
+      int k;
+      if (is_run) { /* Fill a run-length packet. */
+        for (k = 0; k < span; ++k) {
+          dest[k] = run_value;
+        }
+      } else { /* Convert a raw packet. */
+        for (k = 0; k < span; ++k) {
+          dest[k] = ((uint32_t)encoded[k] << 24) | 0xffffffUL;
+        }
+        encoded += span;
+      }
+      dest += span;
+      n -= span;
+      row_remaining -= span;
+      if (row_remaining == 0) {
+        dest += stride - w;
+        row_remaining = w;
+      }
+    }
+    if (is_run) { ++encoded; }
+  }
+  return 1;
+}
+
+SDL_Texture* CreateTextureFromRleData(const uint8_t* encoded,
+                                      SDL_Renderer* renderer, SDL_Rect* rect) {
+  ReadRleRect(encoded, rect);
 
   uint32_t* argb_data = NULL;
   SDL_Texture* texture =
@@ -39,7 +100,6 @@ SDL_Texture* CreateTextureFromRleData(const uint8_t* encoded,
     goto fail;
   }
 
-  const size_t num_pixels = (size_t)rect->w * (size_t)rect->h;
   const size_t pitch = sizeof(uint32_t) * rect->w;
   argb_data = (uint32_t*)malloc(pitch * rect->h);
   if (argb_data == NULL) {
@@ -47,35 +107,100 @@ SDL_Texture* CreateTextureFromRleData(const uint8_t* encoded,
     goto fail;
   }
 
-  /* Image data is run-length encoded in TGA format. Pixels are encoded in
-   * "packets". There are two kinds: "run-length packets" and "raw packets".
+  if (!DecodeRleImage(encoded, rect->w, rect->h, rect->w, argb_data)) {
+    goto fail;
+  }
+
+  if ((SDL_UpdateTexture(texture, NULL, argb_data, pitch) != 0) ||
+      (SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND) != 0)) {
+    fprintf(stderr, "Error: %s\n", SDL_GetError());
+    goto fail;
+  }
+
+  free(argb_data);
+  return texture;
+
+fail:
+  free(argb_data);
+  if (texture) {
+    SDL_DestroyTexture(texture);
+    texture = NULL;
+  }
+  return NULL;
+}
+
+SDL_Texture* CreateTextureAtlasFromRleData(
+    const uint8_t* const* encoded, int num_images, SDL_Renderer* renderer,
+    SDL_Rect* rects, SDL_Rect* atlas_rects) {
+  SDL_RendererInfo info;
+  if (SDL_GetRendererInfo(renderer, &info) != 0) {
+    fprintf(stderr, "Error: %s\n", SDL_GetError());
+    return NULL;
+  }
+  /* A max texture size of zero means no limit. */
+  const int max_width = info.max_texture_width > 0
+      ? info.max_texture_width : kTextureAtlasMaxWidth;
+  const int max_height = info.max_texture_height > 0
+      ? info.max_texture_height : 0x7fffffff;
+
+  /* Pack the images left to right into rows ("shelves"), starting a new row
+   * when the current row is full. Row height is that of its tallest image.
    */
-  size_t i;
-  for (i = 0; i < num_pixels;) {
-    /* Each packet starts with a one-byte packet header. The high bit indicates
-     * the kind of packet. The lower 7 bits encodes the length `n` minus one.
-     */
-    const unsigned packet_header = *(encoded++);
-    const int is_run = packet_header >> 7;
-    int n = 1 + (packet_header & 0x7f);
-    if (i + n > num_pixels) {
-      fprintf(stderr, "Error: Corrupt image data\n");
-      goto fail;
+  int atlas_width = 0;
+  int atlas_height = 0;
+  int row_width = kTextureAtlasMaxWidth;
+  if (row_width > max_width) { row_width = max_width; }
+  int x = 0;
+  int y = 0;
+  int row_height = 0;
+  int i;
+  for (i = 0; i < num_images; ++i) {
+    ReadRleRect(encoded[i], &rects[i]);
+    if (rects[i].w > row_width) {
+      fprintf(stderr, "Error: Image too wide for texture atlas\n");
+      return NULL;
     }
-    if (is_run) { /* Decode a run-length packet. */
-      const uint32_t value = ((uint32_t)*(encoded++) << 24) | 0xffffffUL;
-      do {
-        argb_data[i++] = value;
-      } while (--n);
-    } else { /* Decode a raw packet. */
-      do {
-        const uint32_t value = ((uint32_t)*(encoded++) << 24) | 0xffffffUL;
-        argb_data[i++] = value;
-      } while (--n);
+    if (x + rects[i].w > row_width) {  /* Start a new row. */
+      x = 0;
+      y += row_height;
+      row_height = 0;
     }
+    atlas_rects[i].x = x;
+    atlas_rects[i].y = y;
+    atlas_rects[i].w = rects[i].w;
+    atlas_rects[i].h = rects[i].h;
+    x += rects[i].w;
+    if (x > atlas_width) { atlas_width = x; }
+    if (rects[i].h > row_height) { row_height = rects[i].h; }
+  }
+  atlas_height = y + row_height;
+  if (atlas_width == 0 || atlas_height == 0 || atlas_height > max_height) {
+    fprintf(stderr, "Error: Invalid texture atlas size %dx%d\n",
+            atlas_width, atlas_height);
+    return NULL;
   }
 
-  if ((SDL_UpdateTexture(texture, NULL, argb_data, pitch) != 0) ||
+  /* Pixels between images are transparent. */
+  const size_t pitch = sizeof(uint32_t) * atlas_width;
+  uint32_t* argb_data = (uint32_t*)calloc(atlas_height, pitch);
+  SDL_Texture* texture = NULL;
+  if (argb_data == NULL) {
+    fprintf(stderr, "Error: Memory allocation failed\n");
+    goto fail;
+  }
+  for (i = 0; i < num_images; ++i) {
+    if (!DecodeRleImage(encoded[i], rects[i].w, rects[i].h, atlas_width,
+          argb_data + (size_t)atlas_width * atlas_rects[i].y
+          + atlas_rects[i].x)) {
+      goto fail;
+    }
+  }
+
+  texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888,
+                              SDL_TEXTUREACCESS_STATIC,
+                              atlas_width, atlas_height);
+  if (!texture ||
+      (SDL_UpdateTexture(texture, NULL, argb_data, pitch) != 0) ||
       (SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND) != 0)) {
     fprintf(stderr, "Error: %s\n", SDL_GetError());
     goto fail;
@@ -88,7 +213,6 @@ fail:
   free(argb_data);
   if (texture) {
     SDL_DestroyTexture(texture);
-    texture = NULL;
   }
   return NULL;
 }
@@ -22,6 +22,13 @@
  * SDL_DestroyTexture to release memory when done. On failure, the function
  * prints a message to stderr and returns NULL.
  *
+ * CreateTextureAtlasFromRleData() decodes several images into a single texture
+ * atlas, so that drawing them all uses one texture and the renderer can batch
+ * the draws. It fills `rects[i]` with the destination rectangle of image i as
+ * with CreateTextureFromRleData() and `atlas_rects[i]` with where the image is
+ * in the atlas, to use as the source rectangle when drawing. Images are packed
+ * into rows at most kTextureAtlasMaxWidth pixels wide.
+ *
  * The encoded data format is described in rle_compress_image.py.
  */
 
@@ -37,6 +44,12 @@ extern "C" {
 SDL_Texture* CreateTextureFromRleData(const uint8_t* encoded,
                                       SDL_Renderer* renderer, SDL_Rect* rect);
 
+#define kTextureAtlasMaxWidth 2048
+
+SDL_Texture* CreateTextureAtlasFromRleData(
+    const uint8_t* const* encoded, int num_images, SDL_Renderer* renderer,
+    SDL_Rect* rects, SDL_Rect* atlas_rects);
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
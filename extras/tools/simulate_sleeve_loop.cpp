@@ -0,0 +1,409 @@
+// Copyright 2022 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+// Host-side simulation of the sleeve firmware's audio processing loop.
+//
+// This program replays recorded audio through the same processing path as the
+// sleeve firmware (e.g. extras/ses_apps/sleeve/sleeve_simple_app.cpp), with
+// the hardware drivers stubbed out, for deterministic and reproducible
+// performance testing on a workstation. For each buffer of kAdcDataSize mic
+// samples, it does as the firmware does:
+//
+//   1. Convert 12-bit SAADC values to floats, applying the input gain knob.
+//   2. Run TactileProcessor.
+//   3. Run PostProcessor, ChannelMap, and PWM conversion in one pass with
+//      PostProcessorProcessSamplesToPwm(), as in Pwm::PostProcessToBuffer().
+//
+// Input WAV files are mixed to mono, resampled to the SAADC sample rate, and
+// quantized to 12-bit ADC values, standing in for the SAADC driver. Files are
+// concatenated in the order given.
+//
+// The program reports:
+//  * Per-buffer processing time against the real-time deadline, which is the
+//    buffer duration kAdcDataSize / kSaadcSampleRateHz. Times are for the host
+//    CPU, so they are useful for comparing changes rather than predicting
+//    absolute time on the nRF52.
+//  * Peak stack use of the processing loop, measured by running it on a thread
+//    whose stack is painted with a known pattern.
+//  * Heap use after initialization, and heap allocated during processing,
+//    which should be zero.
+//  * A Fletcher-16 checksum of the PWM output, to check determinism. With
+//    --output, the PWM output is also written as a WAV file.
+//
+// Usage:
+//   simulate_sleeve_loop [flags] input1.wav [input2.wav ...]
+//
+// Flags:
+//  --output=<path>    Optional WAV file to write PWM output, one channel per
+//                     output channel of the channel map.
+//  --settings=<path>  Optional device settings file for tuning and channel map.
+//  --repeat=<int>     Number of times to replay the input (default 1).
+//  --gain=<float>     PostProcessor gain (default 4, as in the firmware).
+
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+#include "extras/tools/util.h"
+#include "src/cpp/constants.h"
+#include "src/cpp/settings.h"
+#include "src/dsp/q_resampler.h"
+#include "src/dsp/read_wav_file.h"
+#include "src/dsp/serialize.h"
+#include "src/dsp/write_wav_file.h"
+#include "src/tactile/post_processor.h"
+#include "src/tactile/tactile_processor.h"
+#include "src/tactile/tuning.h"
+
+namespace {
+
+using ::audio_tactile::kAdcDataSize;
+using ::audio_tactile::kNumPwmValues;
+using ::audio_tactile::kNumTotalPwm;
+using ::audio_tactile::Settings;
+
+// Firmware constants, as in extras/ses_apps/sleeve/sleeve_simple_app.cpp.
+constexpr int kSaadcSampleRateHz = 15625;
+constexpr int kTactileDecimationFactor = 8;
+// PWM top value of the sleeve, see Pwm::kTopValue in src/pwm_sleeve.h.
+constexpr int kPwmTopValue = 512;
+// SAADC full scale, 12-bit signed.
+constexpr int kAdcFullScale = 2048;
+
+// Size of the stack for the processing thread. This is much larger than the
+// firmware's task stack, so that overflow isn't a concern for measuring.
+constexpr size_t kStackSize = 256 * 1024;
+constexpr uint8_t kStackPaint = 0xa5;
+
+// Gets the number of bytes currently allocated on the heap, or -1 if unknown.
+long HeapInUse() {
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || \
+                           (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+  return static_cast<long>(mallinfo2().uordblks);
+#else
+  return -1;
+#endif
+}
+
+// Reads a device settings file into `settings`. Returns false on failure.
+bool ReadSettingsFile(const char* settings_file, Settings* settings) {
+  FILE* f = fopen(settings_file, "rb");
+  if (!f) {
+    fprintf(stderr, "Error: Failed to open \"%s\".\n", settings_file);
+    return false;
+  }
+  bool success = true;
+  settings->ReadFileChunked(
+      [f](char* buffer, int buffer_size) {
+        return static_cast<int>(fread(buffer, 1, buffer_size, f));
+      },
+      [settings_file, &success](int line_number, const char* message) {
+        fprintf(stderr, "Error: %s:%d: %s\n",
+                settings_file, line_number, message);
+        success = false;
+      });
+  fclose(f);
+  return success;
+}
+
+// Reads a WAV file, mixes to mono, resamples to kSaadcSampleRateHz, and
+// appends the result to `adc` as 12-bit ADC values. Returns false on failure.
+bool AppendWavAsAdcSamples(const char* file_name, std::vector<int16_t>* adc) {
+  size_t num_samples;
+  int num_channels;
+  int sample_rate_hz;
+  int32_t* samples = ReadWavFile(file_name, &num_samples, &num_channels,
+                                 &sample_rate_hz);
+  if (!samples) { return false; }  // ReadWavFile prints the error.
+  const int num_frames = static_cast<int>(num_samples / num_channels);
+
+  std::vector<float> mono(num_frames);
+  const float scale = 1.0f / (2147483648.0f * num_channels);
+  for (int i = 0; i < num_frames; ++i) {
+    float sum = 0.0f;
+    for (int c = 0; c < num_channels; ++c) {
+      sum += samples[i * num_channels + c];
+    }
+    mono[i] = scale * sum;
+  }
+  free(samples);
+
+  QResampler* resampler = QResamplerMake(
+      sample_rate_hz, kSaadcSampleRateHz, 1, num_frames, nullptr);
+  if (!resampler) {
+    fprintf(stderr, "Error: %s: QResamplerMake failed.\n", file_name);
+    return false;
+  }
+  const int num_resampled =
+      QResamplerProcessSamples(resampler, mono.data(), num_frames);
+  const float* resampled = QResamplerOutput(resampler);
+  for (int i = 0; i < num_resampled; ++i) {
+    const float value = std::min<float>(std::max<float>(
+        kAdcFullScale * resampled[i], -kAdcFullScale), kAdcFullScale - 1);
+    adc->push_back(static_cast<int16_t>(value));
+  }
+  QResamplerFree(resampler);
+  return true;
+}
+
+struct Simulation {
+  // Inputs.
+  const std::vector<int16_t>* adc;
+  const Settings* settings;
+  TactileProcessor* processor;
+  PostProcessor* post_processor;
+  int repeat;
+  // Outputs.
+  std::vector<double> buffer_us;  // Processing time of each buffer.
+  std::vector<uint16_t> pwm;      // PWM output, interleaved.
+  long heap_delta;                // Heap allocated during processing.
+};
+
+// Runs the processing loop, as in the firmware's tactile processor task.
+void* RunLoop(void* arg) {
+  Simulation* sim = static_cast<Simulation*>(arg);
+  const ChannelMap& channel_map = sim->settings->channel_map;
+  const int num_out = channel_map.num_output_channels;
+  const int num_buffers = static_cast<int>(sim->adc->size() / kAdcDataSize);
+  const float scale =
+      TuningGetInputGain(&sim->settings->tuning) / kAdcFullScale;
+
+  float mic_audio_float[kAdcDataSize];
+  float tactile_output[kAdcDataSize / kTactileDecimationFactor *
+                       kNumTotalPwm];
+  uint16_t pwm_buffer[kNumPwmValues * kNumTotalPwm];
+  uint16_t* pwm_channels[kNumTotalPwm];
+  for (int c = 0; c < kNumTotalPwm; ++c) {
+    pwm_channels[c] = pwm_buffer + c;
+  }
+
+  sim->buffer_us.reserve(sim->repeat * num_buffers);
+  sim->pwm.reserve(sim->repeat * num_buffers * kNumPwmValues * num_out);
+  const long heap_start = HeapInUse();
+
+  for (int r = 0; r < sim->repeat; ++r) {
+    for (int b = 0; b < num_buffers; ++b) {
+      const int16_t* mic_audio_int16 = sim->adc->data() + b * kAdcDataSize;
+      const auto start_time = std::chrono::steady_clock::now();
+
+      for (int i = 0; i < kAdcDataSize; ++i) {
+        mic_audio_float[i] = scale * mic_audio_int16[i];
+      }
+      TactileProcessorProcessSamples(sim->processor, mic_audio_float,
+                                     tactile_output);
+      PostProcessorProcessSamplesToPwm(
+          sim->post_processor, &channel_map, tactile_output, kNumPwmValues,
+          kPwmTopValue, pwm_channels, kNumTotalPwm);
+
+      sim->buffer_us.push_back(std::chrono::duration<double, std::micro>(
+          std::chrono::steady_clock::now() - start_time).count());
+      for (int n = 0; n < kNumPwmValues; ++n) {
+        sim->pwm.insert(sim->pwm.end(), pwm_buffer + n * kNumTotalPwm,
+                        pwm_buffer + n * kNumTotalPwm + num_out);
+      }
+    }
+  }
+
+  const long heap_end = HeapInUse();
+  // The output vectors were reserved up front, so they don't count here.
+  sim->heap_delta = (heap_start < 0 || heap_end < 0) ? -1
+      : heap_end - heap_start;
+  return nullptr;
+}
+
+// Runs `sim` on a thread with a painted stack. Returns the peak stack use in
+// bytes, or -1 on failure.
+long RunOnPaintedStack(Simulation* sim) {
+  std::vector<uint8_t> stack(kStackSize, kStackPaint);
+  pthread_attr_t attr;
+  pthread_t thread;
+  if (pthread_attr_init(&attr) ||
+      pthread_attr_setstack(&attr, stack.data(), stack.size()) ||
+      pthread_create(&thread, &attr, RunLoop, sim)) {
+    fprintf(stderr, "Error: Failed to start processing thread.\n");
+    return -1;
+  }
+  pthread_join(thread, nullptr);
+  pthread_attr_destroy(&attr);
+
+  // The stack grows down, so the lowest overwritten byte marks the peak.
+  size_t untouched = 0;
+  while (untouched < stack.size() && stack[untouched] == kStackPaint) {
+    ++untouched;
+  }
+  return static_cast<long>(stack.size() - untouched);
+}
+
+// Writes PWM output as a WAV file, mapping [0, kPwmTopValue] to int16.
+bool WritePwmWav(const char* file_name, const std::vector<uint16_t>& pwm,
+                 int num_channels) {
+  std::vector<int16_t> samples(pwm.size());
+  for (size_t i = 0; i < pwm.size(); ++i) {
+    const int centered = static_cast<int>(pwm[i]) - kPwmTopValue / 2;
+    samples[i] = static_cast<int16_t>(std::min<int>(std::max<int>(
+        centered * (65536 / kPwmTopValue), -32768), 32767));
+  }
+  const int output_rate_hz =
+      kSaadcSampleRateHz / kTactileDecimationFactor;
+  if (!WriteWavFile(file_name, samples.data(), samples.size(), output_rate_hz,
+                    num_channels)) {
+    fprintf(stderr, "Error: Failed to write \"%s\".\n", file_name);
+    return false;
+  }
+  return true;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const char* output_file = nullptr;
+  const char* settings_file = nullptr;
+  int repeat = 1;
+  float gain = 4.0f;
+  std::vector<const char*> input_files;
+
+  for (int i = 1; i < argc; ++i) {  // Parse flags.
+    if (StartsWith(argv[i], "--output=")) {
+      output_file = strchr(argv[i], '=') + 1;
+    } else if (StartsWith(argv[i], "--settings=")) {
+      settings_file = strchr(argv[i], '=') + 1;
+    } else if (StartsWith(argv[i], "--repeat=")) {
+      repeat = atoi(strchr(argv[i], '=') + 1);
+    } else if (StartsWith(argv[i], "--gain=")) {
+      gain = static_cast<float>(atof(strchr(argv[i], '=') + 1));
+    } else if (StartsWith(argv[i], "--")) {
+      fprintf(stderr, "Error: Invalid flag \"%s\"\n", argv[i]);
+      return EXIT_FAILURE;
+    } else {
+      input_files.push_back(argv[i]);
+    }
+  }
+
+  if (input_files.empty()) {
+    fprintf(stderr, "Error: Must specify at least one input WAV file.\n");
+    return EXIT_FAILURE;
+  } else if (repeat < 1) {
+    fprintf(stderr, "Error: --repeat must be positive.\n");
+    return EXIT_FAILURE;
+  }
+
+  Settings settings;
+  if (settings_file && !ReadSettingsFile(settings_file, &settings)) {
+    return EXIT_FAILURE;
+  }
+  if (settings.channel_map.num_input_channels != kTactileProcessorNumTactors ||
+      settings.channel_map.num_output_channels > kNumTotalPwm) {
+    fprintf(stderr, "Error: Channel map must have %d inputs and at most %d "
+            "outputs.\n", kTactileProcessorNumTactors, kNumTotalPwm);
+    return EXIT_FAILURE;
+  }
+
+  std::vector<int16_t> adc;
+  for (const char* input_file : input_files) {
+    if (!AppendWavAsAdcSamples(input_file, &adc)) { return EXIT_FAILURE; }
+  }
+  if (adc.size() < static_cast<size_t>(kAdcDataSize)) {
+    fprintf(stderr, "Error: Input is shorter than one buffer.\n");
+    return EXIT_FAILURE;
+  }
+
+  // Initialize processing as in the firmware.
+  const long heap_before_init = HeapInUse();
+  TactileProcessorParams params;
+  TactileProcessorSetDefaultParams(&params);
+  params.frontend_params.input_sample_rate_hz = kSaadcSampleRateHz;
+  params.frontend_params.block_size = kAdcDataSize;
+  params.decimation_factor = kTactileDecimationFactor;
+  TactileProcessor* processor = TactileProcessorMake(&params);
+  if (!processor) {
+    fprintf(stderr, "Error: TactileProcessorMake failed.\n");
+    return EXIT_FAILURE;
+  }
+  TactileProcessorApplyTuning(processor, &settings.tuning);
+
+  PostProcessorParams post_processor_params;
+  PostProcessorSetDefaultParams(&post_processor_params);
+  post_processor_params.gain = gain;
+  post_processor_params.cutoff_hz = 975.0f;
+  PostProcessor post_processor;
+  if (!PostProcessorInit(&post_processor, &post_processor_params,
+                         TactileProcessorOutputSampleRateHz(&params),
+                         kTactileProcessorNumTactors)) {
+    fprintf(stderr, "Error: PostProcessorInit failed.\n");
+    TactileProcessorFree(processor);
+    return EXIT_FAILURE;
+  }
+  const long heap_after_init = HeapInUse();
+
+  Simulation sim;
+  sim.adc = &adc;
+  sim.settings = &settings;
+  sim.processor = processor;
+  sim.post_processor = &post_processor;
+  sim.repeat = repeat;
+  const long peak_stack = RunOnPaintedStack(&sim);
+  TactileProcessorFree(processor);
+  if (peak_stack < 0) { return EXIT_FAILURE; }
+
+  // Report timing against the real-time deadline.
+  const double deadline_us = 1e6 * kAdcDataSize / kSaadcSampleRateHz;
+  std::vector<double> sorted_us(sim.buffer_us);
+  std::sort(sorted_us.begin(), sorted_us.end());
+  const int num_buffers = static_cast<int>(sorted_us.size());
+  double sum_us = 0.0;
+  int num_missed = 0;
+  for (double us : sorted_us) {
+    sum_us += us;
+    if (us > deadline_us) { ++num_missed; }
+  }
+  const double mean_us = sum_us / num_buffers;
+  const double p99_us = sorted_us[(num_buffers - 1) * 99 / 100];
+  const int num_out = settings.channel_map.num_output_channels;
+  std::vector<uint8_t> pwm_bytes(2 * sim.pwm.size());
+  LittleEndianWriteU16Array(sim.pwm.data(), sim.pwm.size(), pwm_bytes.data());
+
+  printf("Buffers: %d of %d samples at %d Hz (%.3f s of audio)\n",
+         num_buffers, kAdcDataSize, kSaadcSampleRateHz,
+         num_buffers * deadline_us * 1e-6);
+  printf("Deadline: %.1f us per buffer\n", deadline_us);
+  printf("Time per buffer: mean %.2f us, median %.2f us, p99 %.2f us, "
+         "max %.2f us\n", mean_us, sorted_us[num_buffers / 2], p99_us,
+         sorted_us.back());
+  printf("Deadline use: mean %.2f%%, max %.2f%%, %d buffers missed\n",
+         100.0 * mean_us / deadline_us,
+         100.0 * sorted_us.back() / deadline_us, num_missed);
+  printf("Peak stack: %ld bytes\n", peak_stack);
+  if (heap_after_init >= 0) {
+    printf("Heap after init: %ld bytes\n", heap_after_init - heap_before_init);
+    printf("Heap allocated while processing: %ld bytes\n", sim.heap_delta);
+  }
+  printf("PWM output: %d channels, checksum 0x%04x\n", num_out,
+         Fletcher16(pwm_bytes.data(), pwm_bytes.size(), 1));
+
+  if (output_file && !WritePwmWav(output_file, sim.pwm, num_out)) {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,124 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "extras/tools/spsc_ring.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "extras/tools/util.h"
+
+/* Indices run freely and wrap around UINT_MAX. Since capacity is a power of
+ * two, `write_index - read_index` is the number of elements in the ring even
+ * after wrapping, and `index & (capacity - 1)` is the position in `elements`.
+ */
+
+SpscRing* SpscRingMake(int element_size, int capacity) {
+  if (element_size <= 0 || capacity <= 0 || capacity > (1 << 30)) {
+    return NULL;
+  }
+  SpscRing* ring = (SpscRing*)malloc(sizeof(SpscRing));
+  if (ring == NULL) { return NULL; }
+
+  ring->capacity = RoundUpToPowerOfTwo(capacity);
+  ring->element_size = element_size;
+  ring->elements = (char*)malloc((size_t)ring->capacity * element_size);
+  if (ring->elements == NULL) {
+    free(ring);
+    return NULL;
+  }
+  atomic_init(&ring->read_index, 0);
+  atomic_init(&ring->write_index, 0);
+  return ring;
+}
+
+void SpscRingFree(SpscRing* ring) {
+  if (ring) {
+    free(ring->elements);
+    free(ring);
+  }
+}
+
+/* Copies `num_elements` between `elements` and the ring starting at `index`,
+ * in up to two segments to handle wrapping.
+ */
+static void CopySegments(SpscRing* ring, unsigned index, char* elements,
+                         int num_elements, int /* bool */ to_ring) {
+  const int start = (int)(index & (unsigned)(ring->capacity - 1));
+  int first = ring->capacity - start;
+  if (first > num_elements) { first = num_elements; }
+  const size_t element_size = (size_t)ring->element_size;
+  char* ring_start = ring->elements + start * element_size;
+
+  if (to_ring) {
+    memcpy(ring_start, elements, first * element_size);
+    memcpy(ring->elements, elements + first * element_size,
+           (num_elements - first) * element_size);
+  } else {
+    memcpy(elements, ring_start, first * element_size);
+    memcpy(elements + first * element_size, ring->elements,
+           (num_elements - first) * element_size);
+  }
+}
+
+int SpscRingWrite(SpscRing* ring, const void* elements, int num_elements) {
+  const unsigned write_index =
+      atomic_load_explicit(&ring->write_index, memory_order_relaxed);
+  /* Acquire, so that the consumer's reads of the slots complete before we
+   * overwrite them.
+   */
+  const unsigned read_index =
+      atomic_load_explicit(&ring->read_index, memory_order_acquire);
+  const int num_free = ring->capacity - (int)(write_index - read_index);
+  if (num_elements > num_free) { num_elements = num_free; }
+  if (num_elements <= 0) { return 0; }
+
+  CopySegments(ring, write_index, (char*)elements, num_elements, 1);
+  /* Release, so that the element data is visible before the new index. */
+  atomic_store_explicit(&ring->write_index, write_index + num_elements,
+                        memory_order_release);
+  return num_elements;
+}
+
+int SpscRingRead(SpscRing* ring, void* elements, int num_elements) {
+  const unsigned read_index =
+      atomic_load_explicit(&ring->read_index, memory_order_relaxed);
+  const unsigned write_index =
+      atomic_load_explicit(&ring->write_index, memory_order_acquire);
+  const int num_available = (int)(write_index - read_index);
+  if (num_elements > num_available) { num_elements = num_available; }
+  if (num_elements <= 0) { return 0; }
+
+  CopySegments(ring, read_index, (char*)elements, num_elements, 0);
+  atomic_store_explicit(&ring->read_index, read_index + num_elements,
+                        memory_order_release);
+  return num_elements;
+}
+
+int SpscRingNumAvailable(SpscRing* ring) {
+  const unsigned read_index =
+      atomic_load_explicit(&ring->read_index, memory_order_relaxed);
+  const unsigned write_index =
+      atomic_load_explicit(&ring->write_index, memory_order_acquire);
+  return (int)(write_index - read_index);
+}
+
+int SpscRingNumFree(SpscRing* ring) {
+  const unsigned write_index =
+      atomic_load_explicit(&ring->write_index, memory_order_relaxed);
+  const unsigned read_index =
+      atomic_load_explicit(&ring->read_index, memory_order_acquire);
+  return ring->capacity - (int)(write_index - read_index);
+}
@@ -0,0 +1,93 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * Lock-free single-producer single-consumer ring buffer using C11 atomics.
+ *
+ * This is a C counterpart of src/cpp/spsc_ring_buffer.h for host tools, for
+ * passing data to and from an audio thread without mutexes. One thread may
+ * write while one other thread reads. Neither side blocks: writes and reads
+ * transfer as many elements as currently fit or are available.
+ *
+ * Elements are fixed-size blobs of `element_size` bytes, copied with memcpy.
+ * Capacity is rounded up to a power of two so that indices wrap with a mask.
+ *
+ * Example use:
+ *   SpscRing* ring = SpscRingMake(sizeof(float), 1024);
+ *   // Producer thread.
+ *   SpscRingWrite(ring, samples, num_samples);
+ *   // Consumer thread.
+ *   const int num_read = SpscRingRead(ring, buffer, buffer_size);
+ *
+ * NOTE: This library requires C11 (-std=c11) for <stdatomic.h>.
+ */
+
+#ifndef AUDIO_TO_TACTILE_EXTRAS_TOOLS_SPSC_RING_H_
+#define AUDIO_TO_TACTILE_EXTRAS_TOOLS_SPSC_RING_H_
+
+#include <stdatomic.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Size in bytes to separate producer and consumer indices, so that they are on
+ * different cache lines and don't false share.
+ */
+#define kSpscRingCacheLineSize 64
+
+typedef struct {
+  /* Index of the next element to read, written only by the consumer. */
+  atomic_uint read_index;
+  char padding1[kSpscRingCacheLineSize - sizeof(atomic_uint)];
+  /* Index of the next element to write, written only by the producer. */
+  atomic_uint write_index;
+  char padding2[kSpscRingCacheLineSize - sizeof(atomic_uint)];
+
+  /* Element storage, `capacity * element_size` bytes. */
+  char* elements;
+  int element_size;
+  /* Capacity in elements, a power of two. */
+  int capacity;
+} SpscRing;
+
+/* Makes an SpscRing for at least `capacity` elements of `element_size` bytes.
+ * The caller should free it when done with `SpscRingFree`. Returns NULL on
+ * failure.
+ */
+SpscRing* SpscRingMake(int element_size, int capacity);
+
+/* Frees an SpscRing. */
+void SpscRingFree(SpscRing* ring);
+
+/* Producer: writes up to `num_elements` elements. Returns the number written,
+ * which is less than `num_elements` if the ring is full.
+ */
+int SpscRingWrite(SpscRing* ring, const void* elements, int num_elements);
+
+/* Consumer: reads up to `num_elements` elements into `elements`. Returns the
+ * number read, which is less than `num_elements` if the ring runs empty.
+ */
+int SpscRingRead(SpscRing* ring, void* elements, int num_elements);
+
+/* Consumer: gets the number of elements available to read. */
+int SpscRingNumAvailable(SpscRing* ring);
+
+/* Producer: gets the number of elements that may be written. */
+int SpscRingNumFree(SpscRing* ring);
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif
+#endif /* AUDIO_TO_TACTILE_EXTRAS_TOOLS_SPSC_RING_H_ */
@@ -0,0 +1,118 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "extras/tools/spsc_ring.h"
+
+#include <pthread.h>
+#include <stdlib.h>
+
+#include "extras/tools/util.h"
+#include "src/dsp/logging.h"
+
+/* Test writing and reading in one thread, including wrapping around. */
+static void TestBasic(void) {
+  puts("TestBasic");
+  SpscRing* ring = SpscRingMake(sizeof(int), 5);
+  CHECK(ring != NULL);
+  CHECK(ring->capacity == 8);  /* Rounded up to a power of two. */
+  CHECK(SpscRingNumAvailable(ring) == 0);
+  CHECK(SpscRingNumFree(ring) == 8);
+
+  int values[10];
+  int i;
+  for (i = 0; i < 10; ++i) {
+    values[i] = i;
+  }
+  int out[10];
+  CHECK(SpscRingRead(ring, out, 3) == 0);  /* Empty. */
+
+  CHECK(SpscRingWrite(ring, values, 6) == 6);
+  CHECK(SpscRingNumAvailable(ring) == 6);
+  CHECK(SpscRingRead(ring, out, 4) == 4);
+  for (i = 0; i < 4; ++i) {
+    CHECK(out[i] == i);
+  }
+
+  /* Write 10, of which only 6 fit. The write wraps around. */
+  CHECK(SpscRingWrite(ring, values, 10) == 6);
+  CHECK(SpscRingNumFree(ring) == 0);
+  CHECK(SpscRingRead(ring, out, 10) == 8);
+  CHECK(out[0] == 4);
+  CHECK(out[1] == 5);
+  for (i = 0; i < 6; ++i) {
+    CHECK(out[2 + i] == i);
+  }
+  CHECK(SpscRingNumAvailable(ring) == 0);
+
+  SpscRingFree(ring);
+}
+
+#define kNumStreamValues 200000
+
+static void* ProducerThread(void* user_data) {
+  SpscRing* ring = (SpscRing*)user_data;
+  int buffer[37];
+  int next = 0;
+  while (next < kNumStreamValues) {
+    int n = 1 + RandomInt(36);
+    if (n > kNumStreamValues - next) { n = kNumStreamValues - next; }
+    int i;
+    for (i = 0; i < n; ++i) {
+      buffer[i] = next + i;
+    }
+    /* Retry until the whole buffer is written. */
+    int written = 0;
+    while (written < n) {
+      written += SpscRingWrite(ring, buffer + written, n - written);
+    }
+    next += n;
+  }
+  return NULL;
+}
+
+/* Stream values from a producer thread, checking that the consumer gets them
+ * all in order.
+ */
+static void TestTwoThreads(void) {
+  puts("TestTwoThreads");
+  SpscRing* ring = SpscRingMake(sizeof(int), 64);
+  CHECK(ring != NULL);
+  pthread_t producer;
+  CHECK(pthread_create(&producer, NULL, ProducerThread, ring) == 0);
+
+  int buffer[29];
+  int expected = 0;
+  while (expected < kNumStreamValues) {
+    const int n = SpscRingRead(ring, buffer, 1 + RandomInt(28));
+    int i;
+    for (i = 0; i < n; ++i) {
+      CHECK(buffer[i] == expected);
+      ++expected;
+    }
+  }
+
+  pthread_join(producer, NULL);
+  CHECK(SpscRingNumAvailable(ring) == 0);
+  SpscRingFree(ring);
+}
+
+int main(int argc, char** argv) {
+  srand(0);
+  TestBasic();
+  TestTwoThreads();
+
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,335 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * Streams a WAV file of tactile signals to a device over USB serial.
+ *
+ * This is the host sender for the streaming apps in extras/streaming. The WAV
+ * file is read block by block, converted to 8-bit PWM samples, and sent as
+ * Data messages of the usb_stream protocol (see src/tactile/usb_stream.h). The
+ * device grants credits for as many blocks as its queue holds, so several
+ * blocks are always in flight and playback has no gaps, e.g. for 24 channels
+ * at 2 kHz. The WAV sample rate should match the device's playback rate.
+ *
+ * When done, or on Ctrl+C, a Reset message silences the device. The number of
+ * blocks sent and the device's underrun and error counts are printed.
+ *
+ * Example use:
+ *   stream_wav_to_usb --port=/dev/ttyACM0 --input=tactile_2khz.wav
+ *
+ * Flags:
+ *  --port=<path>             Serial device path.
+ *  --input=<path>            Input WAV or FLAC file.
+ *  --frames_per_block=<int>  Frames per Data block. (Default: as many
+ *                            multiples of 8 as fit in a block)
+ */
+
+#if !defined(_POSIX_C_SOURCE) || _POSIX_C_SOURCE < 200112L
+#undef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200112L /* For poll(), termios, clock_gettime(). */
+#endif
+
+#include <errno.h>
+#include <fcntl.h>
+#include <math.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "src/dsp/read_wav_stream.h"
+#include "src/tactile/usb_stream.h"
+#include "extras/tools/util.h"
+
+/* Playback rate of the streaming apps. */
+#define kDeviceSampleRateHz 2000
+/* Frames per PWM sequence on the device. Blocks are a multiple of this. */
+#define kPwmSamples 8
+/* Time to wait for the device to respond to a Reset. */
+#define kResetTimeoutMs 2000
+/* Time to wait for the device to consume in-flight blocks before giving up. */
+#define kCreditTimeoutMs 2000
+
+/* The main loop runs while `is_running` is nonzero. We set a signal handler to
+ * change `is_running` to 0 when Ctrl+C is pressed.
+ */
+static volatile sig_atomic_t is_running = 0;
+static void StopOnCtrlC(int signum /*unused*/) { is_running = 0; }
+
+static double CurrentTimeS(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec + 1e-9 * t.tv_nsec;
+}
+
+/* Opens serial device `path` in raw mode. Returns the file descriptor, or -1
+ * on failure.
+ */
+static int OpenSerialPort(const char* path) {
+  const int fd = open(path, O_RDWR | O_NOCTTY | O_NONBLOCK);
+  if (fd < 0) {
+    fprintf(stderr, "Error: Failed to open \"%s\": %s\n", path,
+            strerror(errno));
+    return -1;
+  }
+
+  struct termios tty;
+  if (tcgetattr(fd, &tty) != 0) {
+    fprintf(stderr, "Error: \"%s\" is not a serial device.\n", path);
+    close(fd);
+    return -1;
+  }
+  /* Raw 8N1. The baud rate is irrelevant for USB CDC serial. */
+  tty.c_iflag &= ~(IGNBRK | BRKINT | PARMRK | ISTRIP | INLCR | IGNCR | ICRNL |
+                   IXON | IXOFF);
+  tty.c_oflag &= ~OPOST;
+  tty.c_lflag &= ~(ECHO | ECHONL | ICANON | ISIG | IEXTEN);
+  tty.c_cflag &= ~(CSIZE | PARENB | CSTOPB);
+  tty.c_cflag |= CS8 | CREAD | CLOCAL;
+  cfsetispeed(&tty, B115200);
+  cfsetospeed(&tty, B115200);
+  if (tcsetattr(fd, TCSANOW, &tty) != 0) {
+    fprintf(stderr, "Error: Failed to configure \"%s\".\n", path);
+    close(fd);
+    return -1;
+  }
+  tcflush(fd, TCIOFLUSH);
+  return fd;
+}
+
+/* Writes all `size` bytes, waiting while the port is busy. Returns 1 on
+ * success, 0 on failure.
+ */
+static int /*bool*/ WriteAll(int fd, const uint8_t* data, int size) {
+  while (size > 0) {
+    const ssize_t written = write(fd, data, size);
+    if (written > 0) {
+      data += written;
+      size -= (int)written;
+    } else if (written < 0 && errno != EAGAIN && errno != EINTR) {
+      fprintf(stderr, "Error: Serial write failed: %s\n", strerror(errno));
+      return 0;
+    } else {
+      struct pollfd p = {fd, POLLOUT, 0};
+      poll(&p, 1, 100);
+    }
+  }
+  return 1;
+}
+
+typedef struct {
+  int fd;
+  UsbStreamParser parser;
+  /* Latest credit received from the device. */
+  UsbStreamCredit credit;
+} Device;
+
+/* Waits up to `timeout_ms` for data from the device and parses it, updating
+ * `device->credit` from any Credit messages. Returns 1 if a credit was
+ * received, 0 if not, or -1 on error.
+ */
+static int ReceiveCredits(Device* device, int timeout_ms) {
+  struct pollfd p = {device->fd, POLLIN, 0};
+  if (poll(&p, 1, timeout_ms) <= 0) { return 0; }
+  if (p.revents & (POLLERR | POLLHUP)) {
+    fprintf(stderr, "Error: Serial device disconnected.\n");
+    return -1;
+  }
+
+  uint8_t chunk[1024];
+  const ssize_t size = read(device->fd, chunk, sizeof(chunk));
+  if (size < 0) {
+    return (errno == EAGAIN || errno == EINTR) ? 0 : -1;
+  }
+
+  int received = 0;
+  const uint8_t* data = chunk;
+  int remaining = (int)size;
+  while (remaining > 0) {
+    UsbStreamMessage message;
+    const int consumed =
+        UsbStreamParserFeed(&device->parser, data, remaining, &message);
+    data += consumed;
+    remaining -= consumed;
+    if (UsbStreamDecodeCredit(&message, &device->credit)) { received = 1; }
+  }
+  return received;
+}
+
+/* Sends a Reset and waits for the device's first credit. */
+static int /*bool*/ ResetDevice(Device* device) {
+  uint8_t message[kUsbStreamHeaderBytes];
+  if (!WriteAll(device->fd, message, UsbStreamEncodeReset(message))) {
+    return 0;
+  }
+  const double deadline = CurrentTimeS() + 1e-3 * kResetTimeoutMs;
+  while (CurrentTimeS() < deadline) {
+    const int status = ReceiveCredits(device, 100);
+    if (status < 0) { return 0; }
+    /* Skip stale credits sent before the Reset. */
+    if (status > 0 && device->credit.num_consumed == 0) { return 1; }
+  }
+  fprintf(stderr, "Error: No response from the device. Is it running a "
+          "streaming app?\n");
+  return 0;
+}
+
+/* Converts float samples in [-1, 1] to uint8 PWM samples, 128 meaning 0. */
+static void ConvertToPwm(const float* samples, int num_samples,
+                         uint8_t* pwm) {
+  int i;
+  for (i = 0; i < num_samples; ++i) {
+    long value = lrintf(127.5f * (samples[i] + 1.0f));
+    if (value < 0) { value = 0; }
+    if (value > 255) { value = 255; }
+    pwm[i] = (uint8_t)value;
+  }
+}
+
+int main(int argc, char** argv) {
+  const char* port = NULL;
+  const char* input_wav = NULL;
+  int frames_per_block = 0;
+  int i;
+
+  for (i = 1; i < argc; ++i) {
+    if (StartsWith(argv[i], "--port=")) {
+      port = strchr(argv[i], '=') + 1;
+    } else if (StartsWith(argv[i], "--input=")) {
+      input_wav = strchr(argv[i], '=') + 1;
+    } else if (StartsWith(argv[i], "--frames_per_block=")) {
+      frames_per_block = atoi(strchr(argv[i], '=') + 1);
+    } else {
+      fprintf(stderr, "Error: Invalid flag \"%s\"\n", argv[i]);
+      return EXIT_FAILURE;
+    }
+  }
+
+  if (port == NULL || input_wav == NULL) {
+    fprintf(stderr, "Error: Must specify --port and --input\n");
+    return EXIT_FAILURE;
+  }
+
+  /* Get the channel count to choose the block size, then reopen. */
+  ReadWavStream* stream = ReadWavStreamOpen(input_wav, 1);
+  if (stream == NULL) {
+    fprintf(stderr, "Error reading \"%s\"\n", input_wav);
+    return EXIT_FAILURE;
+  }
+  const int num_channels = ReadWavStreamNumChannels(stream);
+  const int sample_rate_hz = ReadWavStreamSampleRateHz(stream);
+  ReadWavStreamClose(stream);
+
+  if (frames_per_block == 0) {
+    frames_per_block = UsbStreamFramesPerBlock(num_channels, kPwmSamples);
+  }
+  if (frames_per_block <= 0 || frames_per_block % kPwmSamples != 0 ||
+      frames_per_block > UsbStreamFramesPerBlock(num_channels, 1)) {
+    fprintf(stderr, "Error: Can't send blocks of %d frames of %d channels.\n",
+            frames_per_block, num_channels);
+    return EXIT_FAILURE;
+  }
+  if (sample_rate_hz != kDeviceSampleRateHz) {
+    fprintf(stderr, "Warning: Input is %d Hz, but the device plays at %d Hz.\n",
+            sample_rate_hz, kDeviceSampleRateHz);
+  }
+
+  stream = ReadWavStreamOpen(input_wav, frames_per_block);
+  if (stream == NULL) {
+    fprintf(stderr, "Error reading \"%s\"\n", input_wav);
+    return EXIT_FAILURE;
+  }
+
+  Device device;
+  UsbStreamParserInit(&device.parser);
+  memset(&device.credit, 0, sizeof(device.credit));
+  device.fd = OpenSerialPort(port);
+  if (device.fd < 0 || !ResetDevice(&device)) {
+    if (device.fd >= 0) { close(device.fd); }
+    ReadWavStreamClose(stream);
+    return EXIT_FAILURE;
+  }
+  printf("Streaming %d channels in blocks of %d frames, device queue of %d "
+         "blocks.\n", num_channels, frames_per_block, device.credit.capacity);
+
+  is_running = 1;
+  signal(SIGINT, StopOnCtrlC);
+
+  const int block_samples = num_channels * frames_per_block;
+  uint8_t pwm[kUsbStreamMaxPayloadBytes];
+  uint8_t message[kUsbStreamMaxMessageBytes];
+  uint32_t num_sent = 0;
+  int end_of_file = 0;
+  int success = 1;
+  double last_credit_time = CurrentTimeS();
+  const double start_time = last_credit_time;
+
+  while (is_running) {
+    /* Send as many blocks as the device has credit for. */
+    int sendable = UsbStreamSendableBlocks(&device.credit, num_sent);
+    for (; sendable > 0 && !end_of_file; --sendable) {
+      int num_frames;
+      const float* block = ReadWavStreamNextBlock(stream, &num_frames);
+      if (block == NULL) {
+        end_of_file = 1;
+        break;
+      }
+      ConvertToPwm(block, block_samples, pwm);
+      const int size = UsbStreamEncodeData((uint16_t)num_sent, num_channels,
+                                           frames_per_block, pwm, message);
+      if (!WriteAll(device.fd, message, size)) {
+        success = 0;
+        break;
+      }
+      ++num_sent;
+    }
+    if (!success ||
+        (end_of_file && device.credit.num_consumed == num_sent)) {
+      break;
+    }
+
+    const int status = ReceiveCredits(&device, 50);
+    if (status < 0) {
+      success = 0;
+      break;
+    } else if (status > 0) {
+      last_credit_time = CurrentTimeS();
+    } else if (CurrentTimeS() - last_credit_time > 1e-3 * kCreditTimeoutMs) {
+      fprintf(stderr, "Error: Device stopped sending credits.\n");
+      success = 0;
+      break;
+    }
+  }
+
+  const double elapsed_s = CurrentTimeS() - start_time;
+  /* Silence the device. */
+  WriteAll(device.fd, message, UsbStreamEncodeReset(message));
+  close(device.fd);
+  ReadWavStreamClose(stream);
+
+  printf("Sent %u blocks (%.1f s of audio) in %.1f s. Device reported %d "
+         "underruns, %d errors.\n", (unsigned)num_sent,
+         (double)num_sent * frames_per_block / sample_rate_hz, elapsed_s,
+         device.credit.num_underruns, device.credit.num_errors);
+  if (device.parser.num_errors > 0) {
+    printf("%d corrupt messages received from the device.\n",
+           device.parser.num_errors);
+  }
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -22,8 +22,6 @@
  *  --chunk_size=<int>      Number of frames per buffer in audio callback.
  */
 
-#include <assert.h>
-#include <limits.h>
 #include <math.h>
 #include <stdint.h>
 #include <stdio.h>
@@ -32,10 +30,12 @@
 
 #include "src/dsp/decibels.h"
 #include "src/dsp/logging.h"
+#include "src/dsp/math_constants.h"
 #include "extras/tools/portaudio_device.h"
 #include "extras/tools/sdl/basic_sdl_app.h"
 #include "extras/tools/sdl/draw_text.h"
 #include "extras/tools/sdl/window_icon.h"
+#include "extras/tools/timed_event_queue.h"
 #include "extras/tools/util.h"
 #include "portaudio.h"
 
@@ -60,17 +60,23 @@ static const float kMaxFrequencyHz = 600.0f;
 static const float kMinAmplitude = 0.001f;
 static const float kMinAmplitudeDb = -60.0f;
 
+/* Buzzer event types for the TimedEventQueue. */
+enum { kBuzzerSetFrequency, kBuzzerSetAmplitude };
+
 struct Buzzer {
-  /* For communication from main thread to audio thread, these variables are
-   * atomics. SDL atomics hold an int, so we use fixed point representation
-   * to approximate float values.
+  /* The main thread sends frequency and amplitude changes to the audio thread
+   * as timestamped events, which the audio callback applies at exact sample
+   * offsets, so that timing doesn't depend on the chunk size.
+   */
+  TimedEventQueue* events;
+  /* Only manipulated by the main thread. Last values sent, to skip sending
+   * unchanged values.
    */
-  /* Target frequency with 4 fractional bits. */
-  SDL_atomic_t frequency_hz_atomic;
-  /* Target amplitude with 14 fractional bits. */
-  SDL_atomic_t target_amplitude_atomic;
+  float sent_frequency_hz;
+  float sent_amplitude;
 
   /* Only manipulated by the audio thread. */
+  float target_amplitude;
   float rotator[2];
   float phasor[2];
   float smoothed_amplitude_stage1;
@@ -96,6 +102,7 @@ struct Engine {
   float amplitude_db;              /* `amplitude`, but in decibels.          */
   float amplitude_smoother;        /* Coefficient for amplitude smoothing.   */
   Buzzer buzzer;                   /* Oscillator state.                      */
+  double event_lead_s;             /* Delay from sending to playing events.  */
 
   /* Basic UI logic. */
   int keep_running;                /* Whether main loop should keep running. */
@@ -112,68 +119,67 @@ struct Engine {
   float bekesy_thresholds_db[kNumFrequencies];
 } engine;
 
-/* Initializes buzzer to zero state. */
-static void BuzzerInit(Buzzer* buzzer) {
-  SDL_AtomicSet(&buzzer->frequency_hz_atomic, 0);
-  SDL_AtomicSet(&buzzer->target_amplitude_atomic, 0);
+/* Initializes buzzer to zero state. Returns 1 on success, 0 on failure. */
+static int BuzzerInit(Buzzer* buzzer) {
+  buzzer->events = TimedEventQueueMake(256);
+  buzzer->sent_frequency_hz = 0.0f;
+  buzzer->sent_amplitude = 0.0f;
+  buzzer->target_amplitude = 0.0f;
   buzzer->rotator[0] = 1.0f;
   buzzer->rotator[1] = 0.0f;
   buzzer->phasor[0] = 1.0f;
   buzzer->phasor[1] = 0.0f;
   buzzer->smoothed_amplitude_stage1 = 0.0f;
   buzzer->smoothed_amplitude = 0.0f;
+  return buzzer->events != NULL;
+}
+
+/* Sends an event to the audio thread, to play after the fixed lead time. */
+static void BuzzerSendEvent(Buzzer* buzzer, int type, float value) {
+  const double time = (engine.pa_stream ? Pa_GetStreamTime(engine.pa_stream)
+                                        : 0.0) + engine.event_lead_s;
+  if (!TimedEventQueuePush(buzzer->events, time, type, value)) {
+    fprintf(stderr, "Warning: Buzzer event queue is full.\n");
+  }
 }
 
-/* Sets buzzer frequency safely through the atomic. */
+/* Sets buzzer frequency. */
 static void BuzzerSetFrequency(Buzzer* buzzer, float frequency_hz) {
-  /* Avoid overflow. */
-  assert(frequency_hz / 16 < INT_MAX);
-  /* Convert to fixed point with 4 fractional bits. */
-  const int fixed = (int)(frequency_hz * 16 + 0.5f);
-  SDL_AtomicSet(&buzzer->frequency_hz_atomic, fixed);
+  if (frequency_hz == buzzer->sent_frequency_hz) { return; }
+  buzzer->sent_frequency_hz = frequency_hz;
+  BuzzerSendEvent(buzzer, kBuzzerSetFrequency, frequency_hz);
 }
 
-/* Sets buzzer amplitude safely through the atomic. */
+/* Sets buzzer amplitude. */
 static void BuzzerSetAmplitude(Buzzer* buzzer, float target_amplitude) {
-  /* Avoid overflow. */
-  assert(target_amplitude / 16384 < INT_MAX);
-  /* Convert to fixed point with 14 fractional bits. */
-  const int fixed = (int)(target_amplitude * 16384 + 0.5f);
-  SDL_AtomicSet(&buzzer->target_amplitude_atomic, fixed);
+  if (target_amplitude == buzzer->sent_amplitude) { return; }
+  buzzer->sent_amplitude = target_amplitude;
+  BuzzerSendEvent(buzzer, kBuzzerSetAmplitude, target_amplitude);
 }
 
-/* The portaudio callback, runs the sine wave oscillator. */
-static int PortaudioCallback(const void* input_buffer, void* output_buffer,
-                             unsigned long frames_per_buffer,
-                             const PaStreamCallbackTimeInfo* time_info,
-                             PaStreamCallbackFlags status_flags,
-                             void* user_data) {
-  float* output = (float*)output_buffer;
-
-  Buzzer* buzzer = &engine.buzzer;
-  /* Get frequency and target amplitude from the atomics. */
-  const int frequency_hz_fixed =
-    SDL_AtomicGet(&buzzer->frequency_hz_atomic);
-  const int target_amplitude_fixed =
-    SDL_AtomicGet(&buzzer->target_amplitude_atomic);
-  /* Convert to float. */
-  const float frequency_hz = frequency_hz_fixed / 16.0f;
-  const float target_amplitude = target_amplitude_fixed / 16384.0f;
-
-  /* Determine the rotator for the desired frequency. */
-  const float radians_per_sample = (float)(
-      2.0 * M_PI * frequency_hz / engine.sample_rate_hz);
-  float rotator[2];
-  rotator[0] = cos(radians_per_sample);
-  rotator[1] = sin(radians_per_sample);
+/* Audio thread: applies an event from the main thread. */
+static void BuzzerApplyEvent(Buzzer* buzzer, const TimedEvent* event) {
+  if (event->type == kBuzzerSetFrequency) {
+    /* Determine the rotator for the desired frequency. */
+    const float radians_per_sample = (float)(
+        2.0 * M_PI * event->value / engine.sample_rate_hz);
+    buzzer->rotator[0] = cos(radians_per_sample);
+    buzzer->rotator[1] = sin(radians_per_sample);
+  } else if (event->type == kBuzzerSetAmplitude) {
+    buzzer->target_amplitude = event->value;
+  }
+}
 
+/* Audio thread: runs the sine wave oscillator for `num_frames` samples. */
+static void BuzzerRender(Buzzer* buzzer, float* output, int num_frames) {
+  const float target_amplitude = buzzer->target_amplitude;
+  const float rotator[2] = {buzzer->rotator[0], buzzer->rotator[1]};
   float phasor[2];
   phasor[0] = buzzer->phasor[0];
   phasor[1] = buzzer->phasor[1];
   float smoothed_amplitude_stage1 = buzzer->smoothed_amplitude_stage1;
   float smoothed_amplitude = buzzer->smoothed_amplitude;
 
-  const int num_frames = (int)frames_per_buffer;
   int i;
   for (i = 0; i < num_frames; ++i) {
     /* Apply second-order Gamma filter to smooth the target amplitude. */
@@ -189,14 +195,41 @@ static int PortaudioCallback(const void* input_buffer, void* output_buffer,
     phasor[0] = tmp;
   }
 
+  buzzer->phasor[0] = phasor[0];
+  buzzer->phasor[1] = phasor[1];
+  buzzer->smoothed_amplitude_stage1 = smoothed_amplitude_stage1;
+  buzzer->smoothed_amplitude = smoothed_amplitude;
+}
+
+/* The portaudio callback, runs the sine wave oscillator. */
+static int PortaudioCallback(const void* input_buffer, void* output_buffer,
+                             unsigned long frames_per_buffer,
+                             const PaStreamCallbackTimeInfo* time_info,
+                             PaStreamCallbackFlags status_flags,
+                             void* user_data) {
+  float* output = (float*)output_buffer;
+  Buzzer* buzzer = &engine.buzzer;
+  const int num_frames = (int)frames_per_buffer;
+
+  /* Render up to each due event, then apply it at its sample offset. */
+  int pos = 0;
+  TimedEvent event;
+  while (TimedEventQueuePopDue(buzzer->events,
+                               time_info->outputBufferDacTime,
+                               engine.sample_rate_hz, num_frames, &event)) {
+    BuzzerRender(buzzer, output + pos, event.offset - pos);
+    pos = event.offset;
+    BuzzerApplyEvent(buzzer, &event);
+  }
+  BuzzerRender(buzzer, output + pos, num_frames - pos);
+
   /* Occasionally correct for accumulating round-off error by normalizing phasor
    * back to unit magnitude.
    */
-  const float mag = sqrt(phasor[0] * phasor[0] + phasor[1] * phasor[1]);
-  buzzer->phasor[0] = phasor[0] / mag;
-  buzzer->phasor[1] = phasor[1] / mag;
-  buzzer->smoothed_amplitude_stage1 = smoothed_amplitude_stage1;
-  buzzer->smoothed_amplitude = smoothed_amplitude;
+  const float mag = sqrt(buzzer->phasor[0] * buzzer->phasor[0] +
+                         buzzer->phasor[1] * buzzer->phasor[1]);
+  buzzer->phasor[0] /= mag;
+  buzzer->phasor[1] /= mag;
   return paContinue;
 }
 
@@ -223,7 +256,7 @@ static int StartPortaudio(void) {
   /* Set up buzzer. */
   engine.amplitude_smoother = 1.0 - exp(
       -1.0 / (0.002 * engine.sample_rate_hz));
-  BuzzerInit(&engine.buzzer);
+  if (!BuzzerInit(&engine.buzzer)) { return 0; }
 
   /* Start output stream. */
   PaStreamParameters output_parameters;
@@ -242,6 +275,12 @@ static int StartPortaudio(void) {
 
   engine.pa_error = Pa_StartStream(engine.pa_stream);
   if (engine.pa_error != paNoError) { return 0; }
+
+  /* Schedule events ahead by the output latency plus one chunk, so that they
+   * play on time with a constant delay.
+   */
+  engine.event_lead_s = Pa_GetStreamInfo(engine.pa_stream)->outputLatency +
+      (double)engine.chunk_size / engine.sample_rate_hz;
   return 1;
 }
 
@@ -252,6 +291,7 @@ static void CleanupPortaudio(void) {
 
   if (engine.pa_stream) { Pa_CloseStream(engine.pa_stream); }
   if (engine.pa_initialized) { Pa_Terminate(); }
+  TimedEventQueueFree(engine.buzzer.events);
 }
 
 /* Starts SDL. Returns 1 on success, 0 on failure. */
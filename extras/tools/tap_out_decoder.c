@@ -0,0 +1,206 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "extras/tools/tap_out_decoder.h"
+
+#include <stdio.h>
+#include <string.h>
+
+/* Size of the sequence, num dropped, and output mask fields of Capture Ex. */
+#define kCaptureExHeaderSize 5
+
+/* Parser states. */
+enum {
+  kStateMarker,
+  kStateOp,
+  kStateSize,
+  kStatePayload,
+};
+
+int TapOutDecoderInit(TapOutDecoder* decoder, const TapOutDecoderRing* rings,
+                      int num_outputs) {
+  if (!(1 <= num_outputs && num_outputs <= kTapOutMaxOutputs)) {
+    fprintf(stderr, "Error: num_outputs must be between 1 and %d.\n",
+            kTapOutMaxOutputs);
+    return 0;
+  }
+  int i;
+  for (i = 0; i < num_outputs; ++i) {
+    if (rings[i].data == NULL || rings[i].capacity < 1 ||
+        !(1 <= rings[i].frame_size &&
+          rings[i].frame_size <= kTapOutDecoderMaxPayload)) {
+      fprintf(stderr, "Error: Invalid ring for output %d.\n", i);
+      return 0;
+    }
+    decoder->rings[i] = rings[i];
+  }
+  decoder->num_outputs = num_outputs;
+  TapOutDecoderReset(decoder);
+  return 1;
+}
+
+void TapOutDecoderReset(TapOutDecoder* decoder) {
+  int i;
+  for (i = 0; i < decoder->num_outputs; ++i) {
+    decoder->rings[i].write_count = 0;
+  }
+  decoder->num_messages = 0;
+  decoder->num_missing_buffers = 0;
+  decoder->num_dropped = 0;
+  decoder->num_errors = 0;
+  decoder->num_skipped_bytes = 0;
+  decoder->state = kStateMarker;
+  decoder->have_sequence = 0;
+  decoder->index = 0;
+}
+
+/* Copies a frame of output `i` with buffer index `index` to its ring. */
+static void WriteFrame(TapOutDecoder* decoder, int i, const uint8_t* frame,
+                       int64_t index) {
+  TapOutDecoderRing* ring = &decoder->rings[i];
+  const int position = (int)(ring->write_count % ring->capacity);
+  memcpy(ring->data + (size_t)position * ring->frame_size, frame,
+         ring->frame_size);
+  if (ring->indices) { ring->indices[position] = index; }
+  ++ring->write_count;
+}
+
+/* Handles a Capture message, whose payload has all outputs. */
+static int /*bool*/ HandleCapture(TapOutDecoder* decoder) {
+  int expected_size = 0;
+  int i;
+  for (i = 0; i < decoder->num_outputs; ++i) {
+    expected_size += decoder->rings[i].frame_size;
+  }
+  if (decoder->payload_size != expected_size) { return 0; }
+
+  const uint8_t* src = decoder->payload;
+  for (i = 0; i < decoder->num_outputs; ++i) {
+    WriteFrame(decoder, i, src, decoder->num_messages);
+    src += decoder->rings[i].frame_size;
+  }
+  return 1;
+}
+
+/* Handles a Capture Ex message, whose payload has a header and the outputs in
+ * the output mask.
+ */
+static int /*bool*/ HandleCaptureEx(TapOutDecoder* decoder) {
+  const uint8_t* payload = decoder->payload;
+  if (decoder->payload_size < kCaptureExHeaderSize) { return 0; }
+  const uint16_t sequence = (uint16_t)(payload[0] | payload[1] << 8);
+  const uint16_t dropped = (uint16_t)(payload[2] | payload[3] << 8);
+  const int output_mask = payload[4];
+
+  /* Check the size before updating any state. */
+  int expected_size = kCaptureExHeaderSize;
+  int i;
+  for (i = 0; i < decoder->num_outputs; ++i) {
+    if (output_mask & (1 << i)) {
+      expected_size += decoder->rings[i].frame_size;
+    }
+  }
+  if (decoder->payload_size != expected_size ||
+      (output_mask >> decoder->num_outputs) != 0) {
+    return 0;
+  }
+
+  if (!decoder->have_sequence) {
+    decoder->have_sequence = 1;
+    decoder->first_dropped = dropped;
+    decoder->index = 0;
+  } else {
+    /* Unwrap the 16-bit sequence number. */
+    const int delta = (uint16_t)(sequence - decoder->last_sequence);
+    if (delta > 1) { decoder->num_missing_buffers += delta - 1; }
+    decoder->index += delta;
+  }
+  decoder->last_sequence = sequence;
+  decoder->num_dropped = (uint16_t)(dropped - decoder->first_dropped);
+
+  const uint8_t* src = payload + kCaptureExHeaderSize;
+  for (i = 0; i < decoder->num_outputs; ++i) {
+    if (output_mask & (1 << i)) {
+      WriteFrame(decoder, i, src, decoder->index);
+      src += decoder->rings[i].frame_size;
+    }
+  }
+  return 1;
+}
+
+/* Handles a complete message. Returns 1 if it was a capture message. */
+static int /*bool*/ HandleMessage(TapOutDecoder* decoder) {
+  int success = 0;
+  if (decoder->op == kTapOutMessageCapture) {
+    success = HandleCapture(decoder);
+  } else if (decoder->op == kTapOutMessageCaptureEx) {
+    success = HandleCaptureEx(decoder);
+  }
+  if (success) {
+    ++decoder->num_messages;
+  } else {
+    ++decoder->num_errors;
+  }
+  return success;
+}
+
+int TapOutDecoderFeed(TapOutDecoder* decoder, const uint8_t* data, int size) {
+  const uint8_t* end = data + size;
+  int num_completed = 0;
+
+  while (data < end) {
+    switch (decoder->state) {
+      case kStateMarker: {
+        const uint8_t* marker =
+            (const uint8_t*)memchr(data, kTapOutMarker, end - data);
+        if (marker == NULL) {
+          decoder->num_skipped_bytes += end - data;
+          return num_completed;
+        }
+        decoder->num_skipped_bytes += marker - data;
+        data = marker + 1;
+        decoder->state = kStateOp;
+      } break;
+
+      case kStateOp:
+        decoder->op = *data++;
+        decoder->state = kStateSize;
+        break;
+
+      case kStateSize:
+        decoder->payload_size = *data++;
+        decoder->payload_pos = 0;
+        decoder->state = kStatePayload;
+        if (decoder->payload_size == 0) {
+          num_completed += HandleMessage(decoder);
+          decoder->state = kStateMarker;
+        }
+        break;
+
+      case kStatePayload: {
+        int n = decoder->payload_size - decoder->payload_pos;
+        if (n > end - data) { n = (int)(end - data); }
+        memcpy(decoder->payload + decoder->payload_pos, data, n);
+        decoder->payload_pos += n;
+        data += n;
+        if (decoder->payload_pos == decoder->payload_size) {
+          num_completed += HandleMessage(decoder);
+          decoder->state = kStateMarker;
+        }
+      } break;
+    }
+  }
+  return num_completed;
+}
@@ -0,0 +1,130 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * Host-side decoder of tap_out capture streams into ring buffers.
+ *
+ * Parsing a tap_out capture stream byte by byte in Python can't keep up when
+ * capturing several outputs at full rate. TapOutDecoder parses Capture and
+ * Capture Ex messages (see src/tactile/tap_out.h) from a stream of received
+ * bytes in C, and copies each output's data into a caller-provided ring buffer
+ * of frames, one frame per captured buffer. The decoder keeps no copy of the
+ * data, so that the rings may be e.g. preallocated numpy arrays that Python
+ * reads directly, see tap_out_decoder_python_bindings.c.
+ *
+ * Bytes may be fed in chunks of any size, such as whatever a serial read
+ * returns; messages split across chunks are reassembled. Bytes before a marker
+ * byte are skipped, and messages with an unexpected op or size are counted as
+ * errors and skipped.
+ *
+ * For Capture Ex messages, the 16-bit sequence numbers are unwrapped to buffer
+ * indices counted from the first message, which are written alongside each
+ * frame. A jump of more than one buffer between messages is a gap, whose
+ * missing buffers are counted in `num_missing_buffers`. Since outputs with
+ * `every_n` > 1 are missing from some messages by design, gaps are measured
+ * between messages, not per output. For plain Capture messages, which have no
+ * sequence number, the buffer index is the message count.
+ *
+ * Example use:
+ *   TapOutDecoderRing rings[2] = {
+ *     {mic_frames, mic_indices, 1024, 2 * 64},   (64 int16 samples)
+ *     {env_frames, env_indices, 1024, 4 * 4},    (4 floats)
+ *   };
+ *   TapOutDecoder decoder;
+ *   TapOutDecoderInit(&decoder, rings, 2);
+ *   while (...) {
+ *     const int size = ReadSerial(chunk, sizeof(chunk));
+ *     TapOutDecoderFeed(&decoder, chunk, size);
+ *     // Frames [0, decoder.rings[i].write_count) have been written to ring i,
+ *     // frame k at position k % capacity.
+ *   }
+ */
+
+#ifndef AUDIO_TO_TACTILE_EXTRAS_TOOLS_TAP_OUT_DECODER_H_
+#define AUDIO_TO_TACTILE_EXTRAS_TOOLS_TAP_OUT_DECODER_H_
+
+#include <stdint.h>
+
+#include "src/tactile/tap_out.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Max payload size of a tap_out message. */
+#define kTapOutDecoderMaxPayload 255
+
+typedef struct {
+  /* Ring of `capacity` frames, each `frame_size` bytes. */
+  uint8_t* data;
+  /* Optional ring of `capacity` buffer indices, one per frame, or NULL. */
+  int64_t* indices;
+  int capacity;
+  int frame_size;
+  /* Number of frames written so far. When it exceeds `capacity`, the oldest
+   * frames have been overwritten.
+   */
+  int64_t write_count;
+} TapOutDecoderRing;
+
+typedef struct {
+  TapOutDecoderRing rings[kTapOutMaxOutputs];
+  int num_outputs;
+
+  /* Number of capture messages decoded. */
+  int64_t num_messages;
+  /* Number of buffers missing from gaps in the sequence numbers. */
+  int64_t num_missing_buffers;
+  /* Number of messages the device reported dropping since the first message. */
+  int num_dropped;
+  /* Number of skipped messages with an unexpected op or size. */
+  int num_errors;
+  /* Number of bytes skipped while looking for a marker. */
+  int64_t num_skipped_bytes;
+
+  /* Parser state. */
+  int state;
+  int op;
+  int payload_size;
+  int payload_pos;
+  uint8_t payload[kTapOutDecoderMaxPayload];
+  /* Sequence unwrapping state. */
+  int /*bool*/ have_sequence;
+  uint16_t last_sequence;
+  uint16_t first_dropped;
+  int64_t index;
+} TapOutDecoder;
+
+/* Initializes the decoder to write the ith selected output, in the order of
+ * the Start Capture message, to `rings[i]`. The ring fields other than
+ * `write_count` must be set, and the ring memory must stay valid while the
+ * decoder is used. Returns 1 on success, 0 on failure.
+ */
+int /*bool*/ TapOutDecoderInit(TapOutDecoder* decoder,
+                               const TapOutDecoderRing* rings,
+                               int num_outputs);
+
+/* Resets the parser, counters, and ring write counts. */
+void TapOutDecoderReset(TapOutDecoder* decoder);
+
+/* Parses `size` received bytes. Returns the number of capture messages that
+ * were completed.
+ */
+int TapOutDecoderFeed(TapOutDecoder* decoder, const uint8_t* data, int size);
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif
+
+#endif  /* AUDIO_TO_TACTILE_EXTRAS_TOOLS_TAP_OUT_DECODER_H_ */
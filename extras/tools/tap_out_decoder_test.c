@@ -0,0 +1,228 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "extras/tools/tap_out_decoder.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "src/dsp/logging.h"
+
+#define kCapacity 4
+#define kFrameSize0 3
+#define kFrameSize1 2
+
+static uint8_t g_frames0[kCapacity * kFrameSize0];
+static uint8_t g_frames1[kCapacity * kFrameSize1];
+static int64_t g_indices0[kCapacity];
+static int64_t g_indices1[kCapacity];
+
+/* Initializes a decoder with two outputs of 3 and 2 bytes. */
+static void InitDecoder(TapOutDecoder* decoder) {
+  TapOutDecoderRing rings[2] = {
+      {g_frames0, g_indices0, kCapacity, kFrameSize0, 0},
+      {g_frames1, g_indices1, kCapacity, kFrameSize1, 0},
+  };
+  memset(g_frames0, 0, sizeof(g_frames0));
+  memset(g_frames1, 0, sizeof(g_frames1));
+  CHECK(TapOutDecoderInit(decoder, rings, 2));
+}
+
+/* Writes a Capture message with output data filled with `value`. */
+static int MakeCapture(uint8_t value, uint8_t* out) {
+  out[0] = kTapOutMarker;
+  out[1] = kTapOutMessageCapture;
+  out[2] = kFrameSize0 + kFrameSize1;
+  memset(out + 3, value, kFrameSize0 + kFrameSize1);
+  return 3 + kFrameSize0 + kFrameSize1;
+}
+
+/* Writes a Capture Ex message including the outputs in `mask`. */
+static int MakeCaptureEx(uint16_t sequence, uint16_t dropped, int mask,
+                         uint8_t value, uint8_t* out) {
+  int size = 5;
+  if (mask & 1) {
+    memset(out + 3 + size, value, kFrameSize0);
+    size += kFrameSize0;
+  }
+  if (mask & 2) {
+    memset(out + 3 + size, value, kFrameSize1);
+    size += kFrameSize1;
+  }
+  out[0] = kTapOutMarker;
+  out[1] = kTapOutMessageCaptureEx;
+  out[2] = size;
+  out[3] = sequence & 0xff;
+  out[4] = sequence >> 8;
+  out[5] = dropped & 0xff;
+  out[6] = dropped >> 8;
+  out[7] = mask;
+  return 3 + size;
+}
+
+/* Checks that frame `k` of ring `i` is filled with `value`. */
+static void CheckFrame(const TapOutDecoder* decoder, int i, int64_t k,
+                       uint8_t value, int64_t index) {
+  const TapOutDecoderRing* ring = &decoder->rings[i];
+  CHECK(k < ring->write_count);
+  const int position = (int)(k % ring->capacity);
+  int j;
+  for (j = 0; j < ring->frame_size; ++j) {
+    CHECK(ring->data[position * ring->frame_size + j] == value);
+  }
+  CHECK(ring->indices[position] == index);
+}
+
+/* Plain Capture messages fill all outputs, indexed by message count. */
+static void TestCapture(void) {
+  puts("TestCapture");
+  TapOutDecoder decoder;
+  InitDecoder(&decoder);
+  uint8_t stream[64];
+  int size = MakeCapture(10, stream);
+  size += MakeCapture(11, stream + size);
+
+  CHECK(TapOutDecoderFeed(&decoder, stream, size) == 2);
+  CHECK(decoder.num_messages == 2);
+  CHECK(decoder.rings[0].write_count == 2);
+  CHECK(decoder.rings[1].write_count == 2);
+  CheckFrame(&decoder, 0, 0, 10, 0);
+  CheckFrame(&decoder, 1, 0, 10, 0);
+  CheckFrame(&decoder, 0, 1, 11, 1);
+  CheckFrame(&decoder, 1, 1, 11, 1);
+  CHECK(decoder.num_errors == 0);
+  CHECK(decoder.num_skipped_bytes == 0);
+}
+
+/* Messages split across chunks are reassembled, and junk is skipped. */
+static void TestChunksAndJunk(void) {
+  puts("TestChunksAndJunk");
+  TapOutDecoder decoder;
+  InitDecoder(&decoder);
+  uint8_t stream[64] = {'h', 'i', '\n'};
+  int size = 3;
+  size += MakeCapture(20, stream + size);
+  size += MakeCapture(21, stream + size);
+
+  int num_completed = 0;
+  int i;
+  for (i = 0; i < size; ++i) {  /* Feed one byte at a time. */
+    num_completed += TapOutDecoderFeed(&decoder, stream + i, 1);
+  }
+  CHECK(num_completed == 2);
+  CHECK(decoder.num_skipped_bytes == 3);
+  CheckFrame(&decoder, 0, 0, 20, 0);
+  CheckFrame(&decoder, 1, 1, 21, 1);
+}
+
+/* Capture Ex sequence numbers are unwrapped and gaps are counted. */
+static void TestCaptureExGaps(void) {
+  puts("TestCaptureExGaps");
+  TapOutDecoder decoder;
+  InitDecoder(&decoder);
+  uint8_t stream[128];
+  int size = MakeCaptureEx(65534, 7, 3, 1, stream);
+  size += MakeCaptureEx(65535, 7, 3, 2, stream + size);
+  /* Wraps around, skipping sequence numbers 0 and 1. */
+  size += MakeCaptureEx(2, 9, 3, 3, stream + size);
+
+  CHECK(TapOutDecoderFeed(&decoder, stream, size) == 3);
+  CHECK(decoder.num_messages == 3);
+  CHECK(decoder.num_missing_buffers == 2);
+  CHECK(decoder.num_dropped == 2);
+  CheckFrame(&decoder, 0, 0, 1, 0);
+  CheckFrame(&decoder, 0, 1, 2, 1);
+  CheckFrame(&decoder, 0, 2, 3, 4);
+  CheckFrame(&decoder, 1, 2, 3, 4);
+}
+
+/* Outputs missing from a message by their every_n aren't gaps. */
+static void TestCaptureExMask(void) {
+  puts("TestCaptureExMask");
+  TapOutDecoder decoder;
+  InitDecoder(&decoder);
+  uint8_t stream[128];
+  int size = 0;
+  uint16_t sequence;
+  for (sequence = 100; sequence < 104; ++sequence) {
+    /* Output 1 is in every other message. */
+    const int mask = (sequence % 2 == 0) ? 3 : 1;
+    size += MakeCaptureEx(sequence, 0, mask, sequence, stream + size);
+  }
+
+  CHECK(TapOutDecoderFeed(&decoder, stream, size) == 4);
+  CHECK(decoder.num_missing_buffers == 0);
+  CHECK(decoder.rings[0].write_count == 4);
+  CHECK(decoder.rings[1].write_count == 2);
+  CheckFrame(&decoder, 0, 3, 103, 3);
+  CheckFrame(&decoder, 1, 0, 100, 0);
+  CheckFrame(&decoder, 1, 1, 102, 2);
+}
+
+/* Messages with unexpected op or size are errors and don't write frames. */
+static void TestErrors(void) {
+  puts("TestErrors");
+  TapOutDecoder decoder;
+  InitDecoder(&decoder);
+  uint8_t stream[128];
+  int size = MakeCapture(1, stream);
+  stream[2] = 4;  /* Wrong size, truncating the message. */
+  size -= 1;
+  const uint8_t kOther[] = {kTapOutMarker, kTapOutMessageHeartbeat, 0};
+  memcpy(stream + size, kOther, sizeof(kOther));
+  size += sizeof(kOther);
+  size += MakeCaptureEx(5, 0, 1, 2, stream + size);
+  stream[size - 4] = 3;  /* Mask with output 1 but without its data. */
+  size += MakeCapture(3, stream + size);
+
+  CHECK(TapOutDecoderFeed(&decoder, stream, size) == 1);
+  CHECK(decoder.num_errors == 3);
+  CHECK(decoder.num_messages == 1);
+  CHECK(decoder.rings[0].write_count == 1);
+  CheckFrame(&decoder, 0, 0, 3, 0);
+}
+
+/* Rings overwrite the oldest frames when full. */
+static void TestRingOverwrite(void) {
+  puts("TestRingOverwrite");
+  TapOutDecoder decoder;
+  InitDecoder(&decoder);
+  uint8_t stream[8];
+  int k;
+  for (k = 0; k < 10; ++k) {
+    const int size = MakeCapture(k, stream);
+    CHECK(TapOutDecoderFeed(&decoder, stream, size) == 1);
+  }
+  CHECK(decoder.rings[0].write_count == 10);
+  for (k = 10 - kCapacity; k < 10; ++k) {
+    CheckFrame(&decoder, 0, k, k, k);
+  }
+
+  TapOutDecoderReset(&decoder);
+  CHECK(decoder.rings[0].write_count == 0);
+  CHECK(decoder.num_messages == 0);
+}
+
+int main(int argc, char** argv) {
+  TestCapture();
+  TestChunksAndJunk();
+  TestCaptureExGaps();
+  TestCaptureExMask();
+  TestErrors();
+  TestRingOverwrite();
+
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,313 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "extras/tools/task_pool.h"
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/* A worker's range of tasks [begin, end), packed into one 64-bit word as
+ * begin + (end << 32) so that it can be claimed with a single CAS. Padded to a
+ * cache line so that workers don't contend on each other's ranges.
+ */
+typedef struct {
+  _Atomic uint64_t range;
+  char padding[kArenaAlignment - sizeof(uint64_t)];
+} WorkerRange;
+
+typedef struct {
+  TaskPool* pool;
+  int worker;
+} WorkerStart;
+
+struct TaskPool {
+  pthread_t* threads;
+  WorkerStart* starts;
+  int num_threads;
+  int num_workers;
+  WorkerRange* ranges;
+  void* ranges_buffer;
+  char* scratch;
+  size_t scratch_stride;
+
+  pthread_mutex_t mutex;
+  /* Signaled when a run starts or the pool is stopping. */
+  pthread_cond_t start_cond;
+  /* Signaled when the last pending task completes. */
+  pthread_cond_t done_cond;
+  /* Incremented on each run, guarded by `mutex`. */
+  int generation;
+  int stopping;
+
+  /* Current run. `fun` and `arg` are written before the ranges are published,
+   * and read only after claiming a task.
+   */
+  TaskPoolWorkerFun fun;
+  void* arg;
+  _Atomic int num_pending;
+};
+
+static uint64_t PackRange(uint32_t begin, uint32_t end) {
+  return (uint64_t)begin | ((uint64_t)end << 32);
+}
+
+/* Claims a task from `worker`'s range, from the front if `steal` is 0 or from
+ * the back if `steal` is 1. Returns the task, or -1 if the range is empty.
+ */
+static int ClaimTask(TaskPool* pool, int worker, int steal) {
+  _Atomic uint64_t* range = &pool->ranges[worker].range;
+  uint64_t packed = atomic_load_explicit(range, memory_order_acquire);
+  for (;;) {
+    const uint32_t begin = (uint32_t)packed;
+    const uint32_t end = (uint32_t)(packed >> 32);
+    if (begin >= end) { return -1; }
+    const uint64_t claimed = steal ? PackRange(begin, end - 1)
+                                   : PackRange(begin + 1, end);
+    if (atomic_compare_exchange_weak_explicit(
+            range, &packed, claimed, memory_order_acq_rel,
+            memory_order_acquire)) {
+      return (int)(steal ? end - 1 : begin);
+    }
+  }
+}
+
+/* Gets the next task for `worker`, first from its own range, then by stealing
+ * from the others. Returns -1 if all ranges are empty. Ranges only shrink
+ * during a run, so then the run has no more tasks to start.
+ */
+static int NextTask(TaskPool* pool, int worker) {
+  int task = ClaimTask(pool, worker, 0);
+  int k;
+  for (k = 1; task < 0 && k < pool->num_workers; ++k) {
+    task = ClaimTask(pool, (worker + k) % pool->num_workers, 1);
+  }
+  return task;
+}
+
+/* Runs tasks of the current run on `worker` until none are left to start. */
+static void RunAvailableTasks(TaskPool* pool, int worker) {
+  int task;
+  while ((task = NextTask(pool, worker)) >= 0) {
+    pool->fun(pool->arg, task, worker);
+    if (atomic_fetch_sub_explicit(&pool->num_pending, 1,
+                                  memory_order_acq_rel) == 1) {
+      pthread_mutex_lock(&pool->mutex);
+      pthread_cond_signal(&pool->done_cond);
+      pthread_mutex_unlock(&pool->mutex);
+    }
+  }
+}
+
+static void* WorkerThread(void* arg) {
+  const WorkerStart* start = (const WorkerStart*)arg;
+  TaskPool* pool = start->pool;
+  const int worker = start->worker;
+  int generation = 0;
+  pthread_mutex_lock(&pool->mutex);
+  for (;;) {
+    while (!pool->stopping && pool->generation == generation) {
+      pthread_cond_wait(&pool->start_cond, &pool->mutex);
+    }
+    if (pool->stopping) { break; }
+    generation = pool->generation;
+    pthread_mutex_unlock(&pool->mutex);
+    RunAvailableTasks(pool, worker);
+    pthread_mutex_lock(&pool->mutex);
+  }
+  pthread_mutex_unlock(&pool->mutex);
+  return NULL;
+}
+
+/* Stops and joins the first `num_started` threads. */
+static void StopThreads(TaskPool* pool, int num_started) {
+  pthread_mutex_lock(&pool->mutex);
+  pool->stopping = 1;
+  pthread_cond_broadcast(&pool->start_cond);
+  pthread_mutex_unlock(&pool->mutex);
+  int i;
+  for (i = 0; i < num_started; ++i) {
+    pthread_join(pool->threads[i], NULL);
+  }
+}
+
+static void FreeBuffers(TaskPool* pool) {
+  free(pool->scratch);
+  free(pool->ranges_buffer);
+  free(pool->starts);
+  free(pool->threads);
+}
+
+TaskPool* TaskPoolMake(int num_threads) {
+  return TaskPoolMakeWithScratch(num_threads, 0);
+}
+
+TaskPool* TaskPoolMakeWithScratch(int num_threads, size_t scratch_bytes) {
+  if (num_threads < 0) {
+    fprintf(stderr, "Error: num_threads must be nonnegative.\n");
+    return NULL;
+  }
+  TaskPool* pool = (TaskPool*)malloc(sizeof(TaskPool));
+  if (pool == NULL) {
+    fprintf(stderr, "Error: Memory allocation failed.\n");
+    return NULL;
+  }
+  const int num_workers = num_threads + 1;
+  pool->num_threads = num_threads;
+  pool->num_workers = num_workers;
+  pool->threads = (pthread_t*)malloc(sizeof(pthread_t) * num_workers);
+  pool->starts = (WorkerStart*)malloc(sizeof(WorkerStart) * num_workers);
+  pool->ranges_buffer = malloc(
+      sizeof(WorkerRange) * num_workers + kArenaAlignmentSlack);
+  /* Each scratch buffer is padded to whole cache lines, plus slack so that
+   * ArenaInit() can align it.
+   */
+  pool->scratch_stride = (scratch_bytes > 0)
+      ? ArenaAllocationSize(scratch_bytes) + kArenaAlignment : 0;
+  pool->scratch = (scratch_bytes > 0)
+      ? (char*)malloc(pool->scratch_stride * num_workers) : NULL;
+  if (pool->threads == NULL || pool->starts == NULL ||
+      pool->ranges_buffer == NULL ||
+      (scratch_bytes > 0 && pool->scratch == NULL)) {
+    fprintf(stderr, "Error: Memory allocation failed.\n");
+    goto fail;
+  }
+
+  Arena arena;
+  ArenaInit(&arena, pool->ranges_buffer,
+            sizeof(WorkerRange) * num_workers + kArenaAlignmentSlack);
+  pool->ranges = (WorkerRange*)ArenaAlloc(
+      &arena, sizeof(WorkerRange) * num_workers);
+  int i;
+  for (i = 0; i < num_workers; ++i) {
+    atomic_init(&pool->ranges[i].range, 0);
+  }
+  pool->generation = 0;
+  pool->stopping = 0;
+  pool->fun = NULL;
+  pool->arg = NULL;
+  atomic_init(&pool->num_pending, 0);
+
+  if (pthread_mutex_init(&pool->mutex, NULL) != 0) { goto fail; }
+  if (pthread_cond_init(&pool->start_cond, NULL) != 0) {
+    pthread_mutex_destroy(&pool->mutex);
+    goto fail;
+  }
+  if (pthread_cond_init(&pool->done_cond, NULL) != 0) {
+    pthread_cond_destroy(&pool->start_cond);
+    pthread_mutex_destroy(&pool->mutex);
+    goto fail;
+  }
+
+  for (i = 0; i < num_threads; ++i) {
+    /* Worker 0 is the calling thread, so threads are workers 1, 2, .... */
+    pool->starts[i].pool = pool;
+    pool->starts[i].worker = i + 1;
+    if (pthread_create(&pool->threads[i], NULL, WorkerThread,
+                       &pool->starts[i]) != 0) {
+      fprintf(stderr, "Error: Failed to create worker thread.\n");
+      StopThreads(pool, i);
+      pthread_cond_destroy(&pool->done_cond);
+      pthread_cond_destroy(&pool->start_cond);
+      pthread_mutex_destroy(&pool->mutex);
+      goto fail;
+    }
+  }
+  return pool;
+
+fail:
+  FreeBuffers(pool);
+  free(pool);
+  return NULL;
+}
+
+void TaskPoolFree(TaskPool* pool) {
+  if (pool == NULL) { return; }
+  StopThreads(pool, pool->num_threads);
+  pthread_cond_destroy(&pool->done_cond);
+  pthread_cond_destroy(&pool->start_cond);
+  pthread_mutex_destroy(&pool->mutex);
+  FreeBuffers(pool);
+  free(pool);
+}
+
+int TaskPoolNumWorkers(const TaskPool* pool) {
+  return pool->num_workers;
+}
+
+void TaskPoolRunWithWorker(TaskPool* pool, TaskPoolWorkerFun fun, void* arg,
+                           int num_tasks) {
+  if (num_tasks <= 0) { return; }
+  pthread_mutex_lock(&pool->mutex);
+  pool->fun = fun;
+  pool->arg = arg;
+  atomic_store_explicit(&pool->num_pending, num_tasks, memory_order_relaxed);
+  /* Split the tasks into contiguous ranges, one per worker. The release
+   * stores publish `fun` and `arg` to workers that claim from the ranges.
+   */
+  const int num_workers = pool->num_workers;
+  int w;
+  for (w = 0; w < num_workers; ++w) {
+    const uint32_t begin = (uint32_t)((int64_t)num_tasks * w / num_workers);
+    const uint32_t end = (uint32_t)((int64_t)num_tasks * (w + 1) / num_workers);
+    atomic_store_explicit(&pool->ranges[w].range, PackRange(begin, end),
+                          memory_order_release);
+  }
+  if (num_tasks > 1) {
+    ++pool->generation;
+    pthread_cond_broadcast(&pool->start_cond);
+  }
+  pthread_mutex_unlock(&pool->mutex);
+
+  /* The calling thread works on tasks too, then waits for the rest. */
+  RunAvailableTasks(pool, 0);
+  pthread_mutex_lock(&pool->mutex);
+  while (atomic_load_explicit(&pool->num_pending, memory_order_acquire) > 0) {
+    pthread_cond_wait(&pool->done_cond, &pool->mutex);
+  }
+  pthread_mutex_unlock(&pool->mutex);
+}
+
+/* Adapts a TaskPoolFun for TaskPoolRunWithWorker(). */
+typedef struct {
+  TaskPoolFun fun;
+  void* arg;
+} RunAdapter;
+
+static void RunAdapterTask(void* arg, int task, int worker) {
+  const RunAdapter* adapter = (const RunAdapter*)arg;
+  (void)worker;
+  adapter->fun(adapter->arg, task);
+}
+
+void TaskPoolRun(TaskPool* pool, TaskPoolFun fun, void* arg, int num_tasks) {
+  RunAdapter adapter;
+  adapter.fun = fun;
+  adapter.arg = arg;
+  TaskPoolRunWithWorker(pool, RunAdapterTask, &adapter, num_tasks);
+}
+
+Arena TaskPoolScratch(TaskPool* pool, int worker) {
+  Arena arena;
+  if (pool->scratch == NULL || worker < 0 || worker >= pool->num_workers) {
+    ArenaInit(&arena, NULL, 0);
+  } else {
+    ArenaInit(&arena, pool->scratch + pool->scratch_stride * worker,
+              pool->scratch_stride);
+  }
+  return arena;
+}
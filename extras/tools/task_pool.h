@@ -0,0 +1,108 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ *
+ * Small fork-join thread pool for running independent tasks.
+ *
+ * `TaskPoolRun()` calls `fun(arg, task)` for task = 0, ..., num_tasks - 1,
+ * distributing the tasks over the pool's worker threads and the calling
+ * thread, and returns when all tasks have completed. Each run is a task
+ * group: its tasks may execute concurrently, but never overlap another run.
+ * This is meant both for running several independent processors on the same
+ * block of audio, for instance in an audio callback, and for batch tools
+ * processing a list of files or chunks.
+ *
+ * Example use:
+ *   TaskPool* pool = TaskPoolMake(2);
+ *   // For each block.
+ *   TaskPoolRun(pool, ProcessTask, &context, 3);
+ *   ...
+ *   TaskPoolFree(pool);
+ *
+ * Tasks are scheduled by work stealing. Each run splits [0, num_tasks) into
+ * one contiguous range per worker, so that neighboring tasks (e.g. consecutive
+ * chunks of a file) tend to run on the same thread. A worker takes tasks from
+ * the front of its own range and, once that is empty, steals from the back of
+ * another worker's range, so that threads stay busy when task durations vary.
+ * Ranges are claimed with atomic compare-and-swap; the mutex is used only to
+ * start runs and to wake the calling thread when the last task completes.
+ *
+ * Workers are numbered 0, ..., TaskPoolNumWorkers() - 1, where 0 is the
+ * calling thread. `TaskPoolRunWithWorker()` passes the worker number to each
+ * task, e.g. to index per-thread state. The pool can optionally own a scratch
+ * buffer per worker (see TaskPoolMakeWithScratch()), so that tasks can get
+ * temporary memory without allocating.
+ *
+ * TaskPoolRun() should be called from one thread at a time, and not from
+ * within a task.
+ */
+
+#ifndef AUDIO_TO_TACTILE_EXTRAS_TOOLS_TASK_POOL_H_
+#define AUDIO_TO_TACTILE_EXTRAS_TOOLS_TASK_POOL_H_
+
+#include <stddef.h>
+
+#include "src/dsp/arena.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef void (*TaskPoolFun)(void* arg, int task);
+typedef void (*TaskPoolWorkerFun)(void* arg, int task, int worker);
+
+typedef struct TaskPool TaskPool;
+
+/* Makes a TaskPool with `num_threads` worker threads. With zero threads, tasks
+ * run serially on the calling thread. The caller should free it when done with
+ * `TaskPoolFree`. Returns NULL on failure.
+ */
+TaskPool* TaskPoolMake(int num_threads);
+
+/* Same as TaskPoolMake(), and additionally allocates a scratch buffer of
+ * `scratch_bytes` for each worker. See TaskPoolScratch().
+ */
+TaskPool* TaskPoolMakeWithScratch(int num_threads, size_t scratch_bytes);
+
+/* Stops the worker threads and frees the TaskPool. */
+void TaskPoolFree(TaskPool* pool);
+
+/* Gets the number of workers, num_threads + 1 including the calling thread. */
+int TaskPoolNumWorkers(const TaskPool* pool);
+
+/* Runs `fun(arg, task)` for each task in [0, num_tasks) and waits for them to
+ * complete. Tasks may run in any order and concurrently.
+ */
+void TaskPoolRun(TaskPool* pool, TaskPoolFun fun, void* arg, int num_tasks);
+
+/* Same as TaskPoolRun(), but calls `fun(arg, task, worker)` where `worker` in
+ * [0, TaskPoolNumWorkers()) is the worker running the task. Tasks running
+ * concurrently always have different worker numbers.
+ */
+void TaskPoolRunWithWorker(TaskPool* pool, TaskPoolWorkerFun fun, void* arg,
+                           int num_tasks);
+
+/* Gets an arena over `worker`'s scratch buffer, for use within a task running
+ * on that worker. The arena starts empty on each call, so memory from it is
+ * valid only until the task returns. Allocations are cache line aligned, so
+ * workers don't share cache lines. The arena has no space if the pool was made
+ * without scratch.
+ */
+Arena TaskPoolScratch(TaskPool* pool, int worker);
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif
+#endif /* AUDIO_TO_TACTILE_EXTRAS_TOOLS_TASK_POOL_H_ */
@@ -0,0 +1,160 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "extras/tools/task_pool.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "src/dsp/logging.h"
+
+#define kMaxTasks 16
+
+typedef struct {
+  int counts[kMaxTasks];
+  int round;
+  int last_round[kMaxTasks];
+} TestContext;
+
+static void CountTask(void* arg, int task) {
+  TestContext* context = (TestContext*)arg;
+  CHECK(0 <= task && task < kMaxTasks);
+  ++context->counts[task];
+  context->last_round[task] = context->round;
+}
+
+/* Each task runs exactly once per TaskPoolRun(), and has completed when it
+ * returns.
+ */
+static void TestRunsEachTaskOnce(int num_threads, int num_tasks) {
+  printf("TestRunsEachTaskOnce(%d, %d)\n", num_threads, num_tasks);
+  TaskPool* pool = CHECK_NOTNULL(TaskPoolMake(num_threads));
+  TestContext context;
+  int i;
+  for (i = 0; i < kMaxTasks; ++i) {
+    context.counts[i] = 0;
+    context.last_round[i] = -1;
+  }
+
+  const int kNumRounds = 1000;
+  for (context.round = 0; context.round < kNumRounds; ++context.round) {
+    TaskPoolRun(pool, CountTask, &context, num_tasks);
+    for (i = 0; i < num_tasks; ++i) {
+      CHECK(context.last_round[i] == context.round);
+    }
+  }
+
+  for (i = 0; i < kMaxTasks; ++i) {
+    CHECK(context.counts[i] == ((i < num_tasks) ? kNumRounds : 0));
+  }
+  TaskPoolFree(pool);
+}
+
+#define kMaxWorkers 8
+#define kNumStealTasks 200
+
+typedef struct {
+  TaskPool* pool;
+  int counts[kNumStealTasks];
+  /* Whether each worker is running a task, to check exclusivity. */
+  int busy[kMaxWorkers];
+  int workers[kNumStealTasks];
+} WorkerContext;
+
+static void WorkerTask(void* arg, int task, int worker) {
+  WorkerContext* context = (WorkerContext*)arg;
+  CHECK(0 <= task && task < kNumStealTasks);
+  CHECK(0 <= worker && worker < TaskPoolNumWorkers(context->pool));
+  CHECK(!context->busy[worker]);
+  context->busy[worker] = 1;
+
+  /* Use the worker's scratch buffer, filling it with a pattern and checking
+   * that no other worker overwrites it.
+   */
+  Arena arena = TaskPoolScratch(context->pool, worker);
+  unsigned char* scratch =
+      (unsigned char*)CHECK_NOTNULL(ArenaAlloc(&arena, 100));
+  CHECK(ArenaAlloc(&arena, 1000) == NULL);
+  /* Tasks have uneven durations, so that workers steal. */
+  const int num_iters = (task % 7 == 0) ? 2000 : 20;
+  int i;
+  for (i = 0; i < num_iters; ++i) {
+    memset(scratch, (unsigned char)(task + i), 100);
+    int j;
+    for (j = 0; j < 100; ++j) {
+      CHECK(scratch[j] == (unsigned char)(task + i));
+    }
+  }
+
+  ++context->counts[task];
+  context->workers[task] = worker;
+  context->busy[worker] = 0;
+}
+
+/* TaskPoolRunWithWorker() runs each task once with a valid worker number, and
+ * each worker's scratch buffer is private.
+ */
+static void TestRunWithWorker(int num_threads) {
+  printf("TestRunWithWorker(%d)\n", num_threads);
+  WorkerContext context;
+  memset(&context, 0, sizeof(context));
+  context.pool = CHECK_NOTNULL(TaskPoolMakeWithScratch(num_threads, 100));
+  CHECK(TaskPoolNumWorkers(context.pool) == num_threads + 1);
+
+  const int kNumRounds = 20;
+  int round;
+  for (round = 0; round < kNumRounds; ++round) {
+    TaskPoolRunWithWorker(context.pool, WorkerTask, &context, kNumStealTasks);
+  }
+
+  int i;
+  for (i = 0; i < kNumStealTasks; ++i) {
+    CHECK(context.counts[i] == kNumRounds);
+    CHECK(0 <= context.workers[i] && context.workers[i] <= num_threads);
+  }
+  TaskPoolFree(context.pool);
+}
+
+/* Without scratch, TaskPoolScratch() returns an empty arena. */
+static void TestNoScratch(void) {
+  puts("TestNoScratch");
+  TaskPool* pool = CHECK_NOTNULL(TaskPoolMake(1));
+  Arena arena = TaskPoolScratch(pool, 0);
+  CHECK(ArenaAlloc(&arena, 1) == NULL);
+  TaskPoolFree(pool);
+}
+
+static void TestInvalidArgs(void) {
+  puts("TestInvalidArgs");
+  CHECK(TaskPoolMake(-1) == NULL);
+  CHECK(TaskPoolMakeWithScratch(-1, 100) == NULL);
+  TaskPoolFree(NULL);
+}
+
+int main(int argc, char** argv) {
+  TestRunsEachTaskOnce(0, 3);
+  TestRunsEachTaskOnce(1, 1);
+  TestRunsEachTaskOnce(2, 3);
+  TestRunsEachTaskOnce(3, 16);
+  TestRunWithWorker(0);
+  TestRunWithWorker(1);
+  TestRunWithWorker(3);
+  TestRunWithWorker(7);
+  TestNoScratch();
+  TestInvalidArgs();
+
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,71 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "extras/tools/timed_event_queue.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+TimedEventQueue* TimedEventQueueMake(int capacity) {
+  TimedEventQueue* queue = (TimedEventQueue*)malloc(sizeof(TimedEventQueue));
+  if (queue == NULL) { return NULL; }
+  queue->ring = SpscRingMake(sizeof(TimedEvent), capacity);
+  if (queue->ring == NULL) {
+    free(queue);
+    return NULL;
+  }
+  queue->has_pending = 0;
+  return queue;
+}
+
+void TimedEventQueueFree(TimedEventQueue* queue) {
+  if (queue) {
+    SpscRingFree(queue->ring);
+    free(queue);
+  }
+}
+
+int TimedEventQueuePush(TimedEventQueue* queue, double time, int type,
+                        float value) {
+  TimedEvent event;
+  event.time = time;
+  event.type = type;
+  event.value = value;
+  event.offset = 0;
+  return SpscRingWrite(queue->ring, &event, 1);
+}
+
+int TimedEventQueuePopDue(TimedEventQueue* queue, double start_time,
+                          float sample_rate_hz, int num_frames,
+                          TimedEvent* event) {
+  if (!queue->has_pending) {
+    if (!SpscRingRead(queue->ring, &queue->pending, 1)) { return 0; }
+    queue->has_pending = 1;
+  }
+
+  int offset = 0;
+  if (start_time > 0.0) {
+    /* Round the event time to the nearest sample. */
+    const double offset_samples =
+        floor((queue->pending.time - start_time) * sample_rate_hz + 0.5);
+    if (offset_samples >= num_frames) { return 0; }  /* Not due yet. */
+    if (offset_samples > 0.0) { offset = (int)offset_samples; }
+  }
+
+  *event = queue->pending;
+  event->offset = offset;
+  queue->has_pending = 0;
+  return 1;
+}
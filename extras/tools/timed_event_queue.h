@@ -0,0 +1,108 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * Lock-free queue of timestamped events, applied at sample offsets in an
+ * audio callback.
+ *
+ * A UI thread that changes synthesis parameters directly, e.g. through
+ * atomics, only has an effect at the start of the next audio chunk, so the
+ * timing jitters by up to a chunk and small chunks are needed to keep it low.
+ * With TimedEventQueue, the UI thread instead pushes events stamped with the
+ * stream time when they should take effect, and the audio callback applies
+ * each event at the corresponding sample within its chunk. Timing is then
+ * sample accurate regardless of the chunk size, at the cost of a fixed lead
+ * time, which should cover the output latency plus one chunk.
+ *
+ * Times are in seconds on the PortAudio stream clock (Pa_GetStreamTime), which
+ * is the clock of `time_info->outputBufferDacTime` in the callback.
+ *
+ * Example use:
+ *   TimedEventQueue* queue = TimedEventQueueMake(256);
+ *
+ *   // UI thread.
+ *   TimedEventQueuePush(queue, Pa_GetStreamTime(stream) + lead_s,
+ *                       kSetAmplitude, 0.5f);
+ *
+ *   // Audio callback.
+ *   const double start = time_info->outputBufferDacTime;
+ *   int pos = 0;
+ *   TimedEvent event;
+ *   while (TimedEventQueuePopDue(queue, start, sample_rate_hz, num_frames,
+ *                                &event)) {
+ *     Render(output + pos, event.offset - pos);
+ *     pos = event.offset;
+ *     Apply(&event);
+ *   }
+ *   Render(output + pos, num_frames - pos);
+ *
+ * There must be a single producer thread and a single consumer thread. The
+ * producer must push events in nondecreasing time order.
+ *
+ * NOTE: This library requires C11 (-std=c11) for <stdatomic.h>.
+ */
+
+#ifndef AUDIO_TO_TACTILE_EXTRAS_TOOLS_TIMED_EVENT_QUEUE_H_
+#define AUDIO_TO_TACTILE_EXTRAS_TOOLS_TIMED_EVENT_QUEUE_H_
+
+#include "extras/tools/spsc_ring.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+  double time;  /* Stream time in seconds when the event takes effect.   */
+  int type;     /* Application-defined event type.                       */
+  float value;  /* Application-defined event value.                      */
+  /* Set by TimedEventQueuePopDue(), the sample offset within the chunk. */
+  int offset;
+} TimedEvent;
+
+typedef struct {
+  SpscRing* ring;
+  /* Consumer: an event read from the ring that isn't due yet. */
+  TimedEvent pending;
+  int has_pending;
+} TimedEventQueue;
+
+/* Makes a TimedEventQueue with space for at least `capacity` events. The
+ * caller should free it when done with `TimedEventQueueFree`. Returns NULL on
+ * failure.
+ */
+TimedEventQueue* TimedEventQueueMake(int capacity);
+
+/* Frees a TimedEventQueue. */
+void TimedEventQueueFree(TimedEventQueue* queue);
+
+/* Producer: pushes an event to take effect at `time`. Returns 1 on success, 0
+ * if the queue is full.
+ */
+int TimedEventQueuePush(TimedEventQueue* queue, double time, int type,
+                        float value);
+
+/* Consumer: gets the next event due within the chunk of `num_frames` frames
+ * starting at time `start_time`. Returns 1 and sets `*event` if there is one,
+ * with `event->offset` in [0, num_frames). Events that are late are due at
+ * offset 0. If `start_time` is not positive, as with host APIs that don't
+ * report stream times, all queued events are due at offset 0.
+ */
+int TimedEventQueuePopDue(TimedEventQueue* queue, double start_time,
+                          float sample_rate_hz, int num_frames,
+                          TimedEvent* event);
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif
+#endif /* AUDIO_TO_TACTILE_EXTRAS_TOOLS_TIMED_EVENT_QUEUE_H_ */
@@ -0,0 +1,98 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "extras/tools/timed_event_queue.h"
+
+#include <stdlib.h>
+
+#include "src/dsp/logging.h"
+
+#define kSampleRateHz 1000.0f
+#define kChunkSize 64
+
+/* Events are returned with their sample offsets within the chunk. */
+static void TestOffsets(void) {
+  puts("TestOffsets");
+  TimedEventQueue* queue = CHECK_NOTNULL(TimedEventQueueMake(16));
+  const double kStart = 10.0;  /* Chunk 0 starts at time 10 s. */
+  CHECK(TimedEventQueuePush(queue, kStart + 0.005, 1, 0.5f));
+  CHECK(TimedEventQueuePush(queue, kStart + 0.005, 2, 0.25f));
+  CHECK(TimedEventQueuePush(queue, kStart + 0.0401, 3, 1.0f));
+  /* 70 ms is in the next chunk, at offset 70 - 64 = 6. */
+  CHECK(TimedEventQueuePush(queue, kStart + 0.070, 4, 2.0f));
+
+  TimedEvent event;
+  CHECK(TimedEventQueuePopDue(queue, kStart, kSampleRateHz, kChunkSize,
+                              &event));
+  CHECK(event.type == 1);
+  CHECK(event.value == 0.5f);
+  CHECK(event.offset == 5);
+  CHECK(TimedEventQueuePopDue(queue, kStart, kSampleRateHz, kChunkSize,
+                              &event));
+  CHECK(event.type == 2);
+  CHECK(event.offset == 5);
+  CHECK(TimedEventQueuePopDue(queue, kStart, kSampleRateHz, kChunkSize,
+                              &event));
+  CHECK(event.type == 3);
+  CHECK(event.offset == 40);
+  /* The last event isn't due in this chunk. It is held, not lost. */
+  CHECK(!TimedEventQueuePopDue(queue, kStart, kSampleRateHz, kChunkSize,
+                               &event));
+  CHECK(!TimedEventQueuePopDue(queue, kStart, kSampleRateHz, kChunkSize,
+                               &event));
+
+  const double next_start = kStart + kChunkSize / kSampleRateHz;
+  CHECK(TimedEventQueuePopDue(queue, next_start, kSampleRateHz, kChunkSize,
+                              &event));
+  CHECK(event.type == 4);
+  CHECK(event.offset == 6);
+  CHECK(!TimedEventQueuePopDue(queue, next_start, kSampleRateHz, kChunkSize,
+                               &event));
+
+  TimedEventQueueFree(queue);
+}
+
+/* Late events and events without stream times are due at offset 0. */
+static void TestLateAndUntimed(void) {
+  puts("TestLateAndUntimed");
+  TimedEventQueue* queue = CHECK_NOTNULL(TimedEventQueueMake(4));
+  TimedEvent event;
+  CHECK(TimedEventQueuePush(queue, 1.0, 1, 0.0f));
+  CHECK(TimedEventQueuePopDue(queue, 5.0, kSampleRateHz, kChunkSize, &event));
+  CHECK(event.type == 1);
+  CHECK(event.offset == 0);
+
+  CHECK(TimedEventQueuePush(queue, 100.0, 2, 0.0f));
+  CHECK(TimedEventQueuePopDue(queue, 0.0, kSampleRateHz, kChunkSize, &event));
+  CHECK(event.type == 2);
+  CHECK(event.offset == 0);
+
+  /* The queue holds at most 4 events. */
+  int i;
+  for (i = 0; i < 4; ++i) {
+    CHECK(TimedEventQueuePush(queue, 1.0, i, 0.0f));
+  }
+  CHECK(!TimedEventQueuePush(queue, 1.0, 4, 0.0f));
+
+  TimedEventQueueFree(queue);
+}
+
+int main(int argc, char** argv) {
+  TestOffsets();
+  TestLateAndUntimed();
+
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,252 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#if !defined(_POSIX_C_SOURCE) || _POSIX_C_SOURCE < 199309L
+#undef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 199309L /* For clock_gettime(). */
+#endif
+
+#include "extras/tools/trace_event.h"
+
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+typedef struct {
+  const char* name;
+  int64_t time_ns;
+  /* Counter value or flow id. */
+  int64_t value;
+  /* Chrome trace event phase: 'B', 'E', 'i', 'C', 's', or 'f'. */
+  char phase;
+} TraceEvent;
+
+typedef struct {
+  TraceEvent* events;
+  /* Number of recorded events, written only by the owning thread. */
+  atomic_int num_events;
+  int num_dropped;
+  const char* thread_name;
+} TraceEventBuffer;
+
+static atomic_int g_enabled = 0;
+/* Incremented on each start, so that threads reclaim a buffer after a
+ * restart.
+ */
+static atomic_int g_generation = 0;
+static atomic_int g_num_claimed = 0;
+static int g_max_events_per_thread = 0;
+static TraceEventBuffer g_buffers[kTraceEventMaxThreads];
+static struct timespec g_start_time;
+
+static _Thread_local TraceEventBuffer* tls_buffer = NULL;
+static _Thread_local int tls_generation = 0;
+
+static int64_t ElapsedNs(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return (int64_t)(t.tv_sec - g_start_time.tv_sec) * 1000000000 +
+         (t.tv_nsec - g_start_time.tv_nsec);
+}
+
+/* Gets the calling thread's buffer, claiming one on first use, or NULL if all
+ * buffers are claimed.
+ */
+static TraceEventBuffer* GetThreadBuffer(void) {
+  const int generation =
+      atomic_load_explicit(&g_generation, memory_order_relaxed);
+  if (tls_generation != generation) {
+    tls_generation = generation;
+    const int index =
+        atomic_fetch_add_explicit(&g_num_claimed, 1, memory_order_relaxed);
+    tls_buffer = (index < kTraceEventMaxThreads) ? &g_buffers[index] : NULL;
+  }
+  return tls_buffer;
+}
+
+static void Record(const char* name, char phase, int64_t value) {
+  if (!atomic_load_explicit(&g_enabled, memory_order_relaxed)) { return; }
+  TraceEventBuffer* buffer = GetThreadBuffer();
+  if (buffer == NULL) { return; }
+
+  const int n = atomic_load_explicit(&buffer->num_events, memory_order_relaxed);
+  if (n >= g_max_events_per_thread) {
+    ++buffer->num_dropped;
+    return;
+  }
+  TraceEvent* event = &buffer->events[n];
+  event->name = name;
+  event->time_ns = ElapsedNs();
+  event->value = value;
+  event->phase = phase;
+  atomic_store_explicit(&buffer->num_events, n + 1, memory_order_release);
+}
+
+int TraceEventStart(int max_events_per_thread) {
+  if (atomic_load(&g_enabled)) {
+    fprintf(stderr, "Error: Tracing is already started.\n");
+    return 0;
+  } else if (max_events_per_thread < 1) {
+    fprintf(stderr, "Error: max_events_per_thread must be positive.\n");
+    return 0;
+  }
+
+  int i;
+  for (i = 0; i < kTraceEventMaxThreads; ++i) {
+    TraceEventBuffer* buffer = &g_buffers[i];
+    buffer->events =
+        (TraceEvent*)malloc(max_events_per_thread * sizeof(TraceEvent));
+    if (buffer->events == NULL) {
+      fprintf(stderr, "Error: Memory allocation failed.\n");
+      while (i > 0) { free(g_buffers[--i].events); }
+      return 0;
+    }
+    atomic_init(&buffer->num_events, 0);
+    buffer->num_dropped = 0;
+    buffer->thread_name = NULL;
+  }
+
+  g_max_events_per_thread = max_events_per_thread;
+  atomic_store(&g_num_claimed, 0);
+  atomic_fetch_add(&g_generation, 1);
+  clock_gettime(CLOCK_MONOTONIC, &g_start_time);
+  atomic_store(&g_enabled, 1);
+  return 1;
+}
+
+/* Writes `s` as a JSON string. */
+static void WriteJsonString(FILE* f, const char* s) {
+  fputc('"', f);
+  for (; *s; ++s) {
+    if (*s == '"' || *s == '\\') {
+      fputc('\\', f);
+      fputc(*s, f);
+    } else if ((unsigned char)*s >= 0x20) {
+      fputc(*s, f);
+    }
+  }
+  fputc('"', f);
+}
+
+int TraceEventStopAndWrite(const char* path) {
+  if (!atomic_exchange(&g_enabled, 0)) {
+    fprintf(stderr, "Error: Tracing is not started.\n");
+    return 0;
+  }
+
+  FILE* f = fopen(path, "wt");
+  if (f == NULL) {
+    fprintf(stderr, "Error: Failed to open \"%s\".\n", path);
+  } else {
+    fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n", f);
+  }
+  int num_claimed = atomic_load(&g_num_claimed);
+  if (num_claimed > kTraceEventMaxThreads) {
+    fprintf(stderr, "Warning: %d threads were not traced.\n",
+            num_claimed - kTraceEventMaxThreads);
+    num_claimed = kTraceEventMaxThreads;
+  }
+
+  int first = 1;
+  int tid;
+  for (tid = 0; tid < num_claimed; ++tid) {
+    TraceEventBuffer* buffer = &g_buffers[tid];
+    const int num_events =
+        atomic_load_explicit(&buffer->num_events, memory_order_acquire);
+    if (buffer->num_dropped > 0) {
+      fprintf(stderr, "Warning: Dropped %d trace events of thread %d.\n",
+              buffer->num_dropped, tid);
+    }
+    if (f == NULL) { continue; }
+
+    if (buffer->thread_name) {
+      fprintf(f, "%s{\"ph\":\"M\",\"pid\":1,\"tid\":%d,"
+              "\"name\":\"thread_name\",\"args\":{\"name\":",
+              first ? "" : ",\n", tid);
+      WriteJsonString(f, buffer->thread_name);
+      fputs("}}", f);
+      first = 0;
+    }
+
+    int i;
+    for (i = 0; i < num_events; ++i) {
+      const TraceEvent* event = &buffer->events[i];
+      fprintf(f, "%s{\"ph\":\"%c\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,"
+              "\"cat\":\"tactile\",\"name\":",
+              first ? "" : ",\n", event->phase, tid, event->time_ns * 1e-3);
+      WriteJsonString(f, event->name);
+      switch (event->phase) {
+        case 'C':
+          fprintf(f, ",\"args\":{\"value\":%lld}", (long long)event->value);
+          break;
+        case 'i':
+          fputs(",\"s\":\"t\"", f);
+          break;
+        case 's':
+          fprintf(f, ",\"id\":%llu", (unsigned long long)event->value);
+          break;
+        case 'f':
+          fprintf(f, ",\"id\":%llu,\"bp\":\"e\"",
+                  (unsigned long long)event->value);
+          break;
+      }
+      fputc('}', f);
+      first = 0;
+    }
+  }
+
+  int success = 0;
+  if (f != NULL) {
+    fputs("\n]}\n", f);
+    success = !ferror(f);
+    if (fclose(f) != 0) { success = 0; }
+    if (!success) { fprintf(stderr, "Error: Failed to write \"%s\".\n", path); }
+  }
+
+  for (tid = 0; tid < kTraceEventMaxThreads; ++tid) {
+    free(g_buffers[tid].events);
+    g_buffers[tid].events = NULL;
+  }
+  return success;
+}
+
+int TraceEventEnabled(void) {
+  return atomic_load_explicit(&g_enabled, memory_order_relaxed);
+}
+
+void TraceEventSetThreadName(const char* name) {
+  if (!atomic_load_explicit(&g_enabled, memory_order_relaxed)) { return; }
+  TraceEventBuffer* buffer = GetThreadBuffer();
+  if (buffer) { buffer->thread_name = name; }
+}
+
+void TraceEventBegin(const char* name) { Record(name, 'B', 0); }
+
+void TraceEventEnd(const char* name) { Record(name, 'E', 0); }
+
+void TraceEventInstant(const char* name) { Record(name, 'i', 0); }
+
+void TraceEventCounter(const char* name, int64_t value) {
+  Record(name, 'C', value);
+}
+
+void TraceEventFlowStart(const char* name, uint64_t id) {
+  Record(name, 's', (int64_t)id);
+}
+
+void TraceEventFlowEnd(const char* name, uint64_t id) {
+  Record(name, 'f', (int64_t)id);
+}
@@ -0,0 +1,121 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * Timeline tracing of host tools, exported as Chrome trace JSON.
+ *
+ * To diagnose latency in a host pipeline, e.g. to see where chunk time goes and
+ * where threads wait, instrument it with trace events:
+ *
+ *  - TraceEventBegin/End(), or TRACE_EVENT_SCOPE(), around callbacks and
+ *    processing stages, which show as nested slices on each thread's track.
+ *  - TraceEventFlowStart/End() with a matching id where data is handed off
+ *    between threads, e.g. through an SpscRing, which show as arrows from the
+ *    producer's slice to the consumer's slice.
+ *  - TraceEventInstant() for point events and TraceEventCounter() for values
+ *    like queue depths.
+ *
+ * After the pipeline stops, TraceEventStopAndWrite() writes the events as JSON
+ * to open in chrome://tracing or https://ui.perfetto.dev.
+ *
+ * Each thread records into its own preallocated buffer, claimed on its first
+ * event with an atomic increment, so recording takes no locks and doesn't
+ * allocate, and is safe in audio callbacks. When a thread's buffer is full,
+ * further events of that thread are dropped and counted. While tracing is not
+ * started, the record functions return after one relaxed atomic load.
+ *
+ * Event names must be string literals or otherwise outlive the trace, since
+ * only their pointers are recorded.
+ *
+ * Example use:
+ *   TraceEventStart(1 << 16);
+ *   ...
+ *   // Audio thread.
+ *   TRACE_EVENT_SCOPE("callback");
+ *   TraceEventBegin("tactile_processor");
+ *   TactileProcessorProcessSamples(...);
+ *   TraceEventEnd("tactile_processor");
+ *   ...
+ *   // On exit, after stopping the audio thread.
+ *   TraceEventStopAndWrite("trace.json");
+ *
+ * NOTE: This library requires C11 (-std=c11) for <stdatomic.h>.
+ */
+
+#ifndef AUDIO_TO_TACTILE_EXTRAS_TOOLS_TRACE_EVENT_H_
+#define AUDIO_TO_TACTILE_EXTRAS_TOOLS_TRACE_EVENT_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Max number of threads that can record events. */
+#define kTraceEventMaxThreads 8
+
+/* Starts tracing, with room for `max_events_per_thread` events for each of up
+ * to kTraceEventMaxThreads threads. Returns 1 on success, 0 on failure.
+ */
+int /*bool*/ TraceEventStart(int max_events_per_thread);
+
+/* Stops tracing, writes the recorded events as Chrome trace JSON to `path`,
+ * and frees the buffers. Threads must have stopped recording, e.g. by closing
+ * the audio stream, before calling this. Returns 1 on success, 0 on failure.
+ */
+int /*bool*/ TraceEventStopAndWrite(const char* path);
+
+/* Returns 1 if tracing is started. */
+int /*bool*/ TraceEventEnabled(void);
+
+/* Names the calling thread's track in the trace, e.g. "audio". */
+void TraceEventSetThreadName(const char* name);
+
+/* Marks the beginning and end of a slice on the calling thread. Slices on a
+ * thread must nest.
+ */
+void TraceEventBegin(const char* name);
+void TraceEventEnd(const char* name);
+
+/* Records a point event on the calling thread. */
+void TraceEventInstant(const char* name);
+
+/* Records the value of counter `name`, e.g. a queue depth. */
+void TraceEventCounter(const char* name, int64_t value);
+
+/* Marks the handoff of item `id` to another thread. The flow starts from the
+ * calling thread's enclosing slice and ends at the enclosing slice of the
+ * TraceEventFlowEnd() call with the same `name` and `id`.
+ */
+void TraceEventFlowStart(const char* name, uint64_t id);
+void TraceEventFlowEnd(const char* name, uint64_t id);
+
+#if defined(__GNUC__) || defined(__clang__)
+/* Used by TRACE_EVENT_SCOPE. */
+static void TraceEventScopeEnd_(const char** name) { TraceEventEnd(*name); }
+
+#define TRACE_EVENT_CONCAT_(a, b) a##b
+#define TRACE_EVENT_SCOPE_VAR_(line) TRACE_EVENT_CONCAT_(trace_scope_, line)
+/* Records a slice from this point to the end of the enclosing C scope. */
+#define TRACE_EVENT_SCOPE(name)                                      \
+  const char* TRACE_EVENT_SCOPE_VAR_(__LINE__)                       \
+      __attribute__((cleanup(TraceEventScopeEnd_), unused)) =       \
+          (TraceEventBegin(name), (name))
+#endif  /* defined(__GNUC__) || defined(__clang__) */
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif
+
+#endif  /* AUDIO_TO_TACTILE_EXTRAS_TOOLS_TRACE_EVENT_H_ */
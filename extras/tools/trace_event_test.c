@@ -0,0 +1,158 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "extras/tools/trace_event.h"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "src/dsp/logging.h"
+
+static const char* g_temp_file = NULL;
+
+/* Reads the whole file at `path` as a null-terminated string. */
+static char* ReadFile(const char* path) {
+  FILE* f = CHECK_NOTNULL(fopen(path, "rb"));
+  CHECK(fseek(f, 0, SEEK_END) == 0);
+  const long size = ftell(f);
+  CHECK(fseek(f, 0, SEEK_SET) == 0);
+  char* contents = (char*)CHECK_NOTNULL(malloc(size + 1));
+  CHECK(fread(contents, 1, size, f) == (size_t)size);
+  contents[size] = '\0';
+  fclose(f);
+  return contents;
+}
+
+/* Counts the occurrences of `pattern` in `s`. */
+static int CountOccurrences(const char* s, const char* pattern) {
+  int count = 0;
+  while ((s = strstr(s, pattern)) != NULL) {
+    ++count;
+    s += strlen(pattern);
+  }
+  return count;
+}
+
+/* Nested slices, instants, and counters are written in order. */
+static void TestSingleThread(void) {
+  puts("TestSingleThread");
+  CHECK(!TraceEventEnabled());
+  TraceEventBegin("ignored");  /* Not started: no-op. */
+
+  CHECK(TraceEventStart(64));
+  CHECK(TraceEventEnabled());
+  TraceEventSetThreadName("main");
+  {
+    TRACE_EVENT_SCOPE("outer");
+    TraceEventBegin("inner");
+    TraceEventInstant("mark");
+    TraceEventCounter("depth", 3);
+    TraceEventEnd("inner");
+  }
+  CHECK(TraceEventStopAndWrite(g_temp_file));
+  CHECK(!TraceEventEnabled());
+
+  char* json = ReadFile(g_temp_file);
+  CHECK(strstr(json, "\"traceEvents\":[") != NULL);
+  CHECK(strstr(json, "\"name\":\"thread_name\",\"args\":{\"name\":\"main\"}"));
+  CHECK(strstr(json, "ignored") == NULL);
+  CHECK(CountOccurrences(json, "\"ph\":\"B\"") == 2);
+  CHECK(CountOccurrences(json, "\"ph\":\"E\"") == 2);
+  CHECK(strstr(json, "\"ph\":\"C\"") != NULL);
+  CHECK(strstr(json, "\"args\":{\"value\":3}") != NULL);
+
+  /* Events are in order: outer begins first and ends last. */
+  const char* outer_begin = strstr(json, "\"ph\":\"B\"");
+  const char* inner_begin = strstr(outer_begin + 1, "\"ph\":\"B\"");
+  const char* mark = strstr(json, "\"name\":\"mark\"");
+  const char* outer_end = strstr(json, "\"name\":\"outer\"}\n]}");
+  CHECK(outer_begin < inner_begin);
+  CHECK(inner_begin < mark);
+  CHECK(outer_end != NULL);
+  free(json);
+}
+
+/* Events beyond a thread's capacity are dropped. */
+static void TestDropsWhenFull(void) {
+  puts("TestDropsWhenFull");
+  CHECK(TraceEventStart(4));
+  int i;
+  for (i = 0; i < 10; ++i) {
+    TraceEventInstant("tick");
+  }
+  CHECK(TraceEventStopAndWrite(g_temp_file));
+
+  char* json = ReadFile(g_temp_file);
+  CHECK(CountOccurrences(json, "\"name\":\"tick\"") == 4);
+  free(json);
+}
+
+enum { kNumItems = 100 };
+static _Atomic int g_handoff_count = 0;
+
+static void* ProducerThread(void* arg) {
+  TraceEventSetThreadName("producer");
+  int i;
+  for (i = 0; i < kNumItems; ++i) {
+    TRACE_EVENT_SCOPE("produce");
+    TraceEventFlowStart("item", i);
+    g_handoff_count = i + 1;
+  }
+  return NULL;
+}
+
+/* Each thread records on its own track, and flows connect the threads. */
+static void TestThreadsAndFlows(void) {
+  puts("TestThreadsAndFlows");
+  CHECK(TraceEventStart(1024));
+  TraceEventSetThreadName("consumer");
+
+  pthread_t thread;
+  CHECK(pthread_create(&thread, NULL, ProducerThread, NULL) == 0);
+  int consumed = 0;
+  while (consumed < kNumItems) {
+    if (consumed < g_handoff_count) {
+      TRACE_EVENT_SCOPE("consume");
+      TraceEventFlowEnd("item", consumed);
+      ++consumed;
+    }
+  }
+  CHECK(pthread_join(thread, NULL) == 0);
+  CHECK(TraceEventStopAndWrite(g_temp_file));
+
+  char* json = ReadFile(g_temp_file);
+  CHECK(strstr(json, "\"args\":{\"name\":\"consumer\"}") != NULL);
+  CHECK(strstr(json, "\"args\":{\"name\":\"producer\"}") != NULL);
+  CHECK(CountOccurrences(json, "\"ph\":\"s\"") == kNumItems);
+  CHECK(CountOccurrences(json, "\"ph\":\"f\"") == kNumItems);
+  CHECK(CountOccurrences(json, "\"tid\":0,") == 1 + 3 * kNumItems);
+  CHECK(CountOccurrences(json, "\"tid\":1,") == 1 + 3 * kNumItems);
+  CHECK(strstr(json, "\"id\":99,\"bp\":\"e\"") != NULL);
+  free(json);
+}
+
+int main(int argc, char** argv) {
+  g_temp_file = CHECK_NOTNULL(tmpnam(NULL));
+
+  TestSingleThread();
+  TestDropsWhenFull();
+  TestThreadsAndFlows();
+
+  remove(g_temp_file);
+  puts("PASS");
+  return EXIT_SUCCESS;
+}
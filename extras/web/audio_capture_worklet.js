@@ -0,0 +1,48 @@
+/**
+ * Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * AudioWorkletProcessor forwarding input audio to a SharedArrayBuffer ring.
+ *
+ * The processor is constructed with processorOptions
+ *   {audioRing: SharedArrayBuffer from SabRing.allocate(..., QUANTUM_SIZE)}
+ * It passes input audio through unchanged and pushes each 128-sample render
+ * quantum to `audioRing`, for processing on another thread such as the Web
+ * Worker in classify_phoneme_worker.js. The audio thread does no other work, so
+ * processing load never causes audio glitches. If the consumer falls behind
+ * and the ring fills, quanta are dropped.
+ */
+
+import {SabRing} from './sab_ring.js';
+
+const QUANTUM_SIZE = 128;
+
+class AudioCaptureWorklet extends AudioWorkletProcessor {
+  constructor(options) {
+    super();
+    this.audioRing = new SabRing(options.processorOptions.audioRing, QUANTUM_SIZE);
+  }
+
+  process(inputs, outputs) {
+    const input = inputs[0][0];
+    if (!input) { return true; }  // No input connected.
+    // Copy audio to output so that it can be played.
+    outputs[0][0].set(input);
+    if (input.length == QUANTUM_SIZE) { this.audioRing.push(input); }
+    return true;
+  }
+}
+
+registerProcessor('audio-capture', AudioCaptureWorklet);
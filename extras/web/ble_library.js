@@ -43,6 +43,16 @@ const MESSAGE_TYPE_GET_DEVICE_NAME = 30;
 const MESSAGE_TYPE_OTA_BOOTLOADMODE = 31;
 const MESSAGE_TYPE_CALIBRATE_TACTOR = 35;
 const MESSAGE_TYPE_TACTILE_EX_PATTERN = 36;
+const MESSAGE_TYPE_LATENCY_ESTIMATE = 37;
+const MESSAGE_TYPE_JITTER_BUFFER_STATS = 38;
+const MESSAGE_TYPE_DEADLINE_STATS = 40;
+const MESSAGE_TYPE_CLOCK_SYNC_REQUEST = 46;
+const MESSAGE_TYPE_CLOCK_SYNC_RESPONSE = 47;
+const MESSAGE_TYPE_TIMED_TACTORS_SAMPLES = 48;
+const MESSAGE_TYPE_TACTILE_PATTERN_CHUNK = 49;
+const MESSAGE_TYPE_PLAY_TACTILE_PATTERN = 50;
+const MESSAGE_TYPE_TACTILE_PATTERN_UPLOAD_STATUS = 51;
+const MESSAGE_TYPE_ENERGY_STATS = 52;
 
 const NUM_TACTORS = 10;
 const ENVELOPE_TRACKER_RECORD_POINTS = 33;
@@ -562,21 +572,37 @@ class BleManager {
   }
 
   /**
-   * Handles a new BLE message from the device by parsing message type and
-   * calling the appropriate handler.
-   * @param {!Event} event Event containing message information.
+   * Handles a new BLE packet from the device. A packet holds one or more
+   * messages back to back, each with a 4-byte header, up to the ATT MTU.
+   * @param {!Event} event Event containing the packet.
    * @private
    */
   onReceivedMessage(event) {
     let bytes = event.target.value;
-    if (bytes.byteLength < 4 || bytes.byteLength != 4 + bytes.getUint8(3)) {
-      this.log('Received invalid message.');
-    }
-    let messageType = bytes.getUint8(2);
-    let messagePayload = new Uint8Array(bytes.getUint8(3));
-    for (let i = 0; i < messagePayload.byteLength; i++) {
-      messagePayload[i] = bytes.getUint8(4 + i);
+    let offset = 0;
+    while (offset < bytes.byteLength) {
+      if (bytes.byteLength - offset < 4 ||
+          bytes.byteLength - offset < 4 + bytes.getUint8(offset + 3)) {
+        this.log('Received invalid message.');
+        return;
+      }
+      let messageType = bytes.getUint8(offset + 2);
+      let messagePayload = new Uint8Array(bytes.getUint8(offset + 3));
+      for (let i = 0; i < messagePayload.byteLength; i++) {
+        messagePayload[i] = bytes.getUint8(offset + 4 + i);
+      }
+      offset += 4 + messagePayload.byteLength;
+      this.handleMessage(messageType, messagePayload);
     }
+  }
+
+  /**
+   * Handles one message by calling the appropriate handler for its type.
+   * @param {number} messageType The message type code.
+   * @param {!Uint8Array} messagePayload The message payload.
+   * @private
+   */
+  handleMessage(messageType, messagePayload) {
     this.log('Got type: ' + messageType + ', [' +
       messagePayload.join(', ') + ']');
     switch (messageType) {
@@ -606,11 +632,42 @@ class BleManager {
       case MESSAGE_TYPE_TEMPERATURE:
         this.receiveTemperature(messagePayload);
         break;
+      case MESSAGE_TYPE_LATENCY_ESTIMATE:
+        this.receiveLatencyEstimate(messagePayload);
+        break;
+      case MESSAGE_TYPE_JITTER_BUFFER_STATS:
+        this.receiveJitterBufferStats(messagePayload);
+        break;
+      case MESSAGE_TYPE_DEADLINE_STATS:
+        this.receiveDeadlineStats(messagePayload);
+        break;
+      case MESSAGE_TYPE_ENERGY_STATS:
+        this.receiveEnergyStats(messagePayload);
+        break;
+      case MESSAGE_TYPE_CLOCK_SYNC_REQUEST:
+        this.receiveClockSyncRequest(messagePayload);
+        break;
+      case MESSAGE_TYPE_TACTILE_PATTERN_UPLOAD_STATUS:
+        this.receiveTactilePatternUploadStatus(messagePayload);
+        break;
       default:
         this.log('Unsupported message type.');
     }
   }
 
+  /**
+   * Handles a pattern upload status message by logging it.
+   * @param {!Uint8Array} messagePayload A byte array containing the pattern ID
+   *    and a status code, 1 for success and 2-4 for errors.
+   * @private
+   */
+  receiveTactilePatternUploadStatus(messagePayload) {
+    if (messagePayload.length != 2) { return; }
+    this.log('Pattern ' + messagePayload[0] + ' upload ' +
+        (messagePayload[1] == 1 ? 'complete.' :
+                                  'failed with status ' + messagePayload[1]));
+  }
+
   /**
    * Handles a battery voltage message by parsing the input and updating the UI.
    * @param {!Uint8Array} messagePayload A byte array containing the
@@ -623,6 +680,171 @@ class BleManager {
     this.batteryVoltageUIUpdate(num);
   }
 
+  /**
+   * Handles a latency estimate message by parsing the input and logging it.
+   * @param {!Uint8Array} messagePayload A byte array containing the estimated
+   *    end-to-end latency in milliseconds.
+   * @private
+   */
+  receiveLatencyEstimate(messagePayload) {
+    let view = new DataView(messagePayload.buffer);
+    let latencyMs = view.getFloat32(0, /*littleEndian=*/true);
+    this.log('Latency estimate: ' + latencyMs.toFixed(1) + ' ms');
+  }
+
+  /**
+   * Handles a jitter buffer stats message by parsing the input and logging it.
+   * @param {!Uint8Array} messagePayload A byte array containing the streaming
+   *    latency, jitter, target depth, and underrun statistics.
+   * @private
+   */
+  receiveJitterBufferStats(messagePayload) {
+    if (messagePayload.length != 21) {
+      this.log('Invalid jitter buffer stats message.');
+      return;
+    }
+    let view = new DataView(messagePayload.buffer, messagePayload.byteOffset);
+    let latencyMs = view.getFloat32(0, /*littleEndian=*/true);
+    let jitterMs = view.getFloat32(4, /*littleEndian=*/true);
+    let targetDepth = view.getUint8(8);
+    let numUnderruns = view.getUint32(9, /*littleEndian=*/true);
+    let numConcealed = view.getUint32(13, /*littleEndian=*/true);
+    let numDropped = view.getUint32(17, /*littleEndian=*/true);
+    this.log('Jitter buffer: latency ' + latencyMs.toFixed(1) + ' ms (' +
+        targetDepth + ' blocks), jitter ' + jitterMs.toFixed(1) + ' ms, ' +
+        numUnderruns + ' underruns, ' + numConcealed + ' concealed, ' +
+        numDropped + ' dropped');
+  }
+
+  /**
+   * Handles a deadline stats message by parsing the input and logging it.
+   * @param {!Uint8Array} messagePayload A byte array containing the number of
+   *    processed buffers, overruns, near misses, and mean and max CPU load.
+   * @private
+   */
+  receiveDeadlineStats(messagePayload) {
+    if (messagePayload.length != 20) {
+      this.log('Invalid deadline stats message.');
+      return;
+    }
+    let view = new DataView(messagePayload.buffer, messagePayload.byteOffset);
+    let numBuffers = view.getUint32(0, /*littleEndian=*/true);
+    let numOverruns = view.getUint32(4, /*littleEndian=*/true);
+    let numNearMisses = view.getUint32(8, /*littleEndian=*/true);
+    let meanLoad = view.getFloat32(12, /*littleEndian=*/true);
+    let maxLoad = view.getFloat32(16, /*littleEndian=*/true);
+    this.log('CPU load: mean ' + (100 * meanLoad).toFixed(1) + '%, max ' +
+        (100 * maxLoad).toFixed(1) + '%, ' + numOverruns + ' overruns, ' +
+        numNearMisses + ' near misses in ' + numBuffers + ' buffers');
+  }
+
+  /**
+   * Handles an energy stats message by parsing the input and logging it.
+   * @param {!Uint8Array} messagePayload A byte array containing the number of
+   *    completed minutes, the CPU active fraction, and the mean drive power of
+   *    each channel over the last minute.
+   * @private
+   */
+  receiveEnergyStats(messagePayload) {
+    if (messagePayload.length != 104) {
+      this.log('Invalid energy stats message.');
+      return;
+    }
+    let view = new DataView(messagePayload.buffer, messagePayload.byteOffset);
+    let numMinutes = view.getUint32(0, /*littleEndian=*/true);
+    let cpuActive = view.getFloat32(4, /*littleEndian=*/true);
+    let totalPower = 0;
+    let powers = [];
+    for (let c = 0; c < NUM_TACTORS; c++) {
+      let power = view.getFloat32(8 + 4 * c, /*littleEndian=*/true);
+      totalPower += power;
+      powers.push((100 * power).toFixed(1));
+    }
+    this.log('Energy, minute ' + numMinutes + ': CPU active ' +
+        (100 * cpuActive).toFixed(1) + '%, total drive power ' +
+        (100 * totalPower).toFixed(1) + '% [' + powers.join(', ') + ']');
+  }
+
+  /**
+   * Current time of the reference clock for synchronized playback, in
+   * microseconds as a wrapping uint32.
+   * @return {number}
+   */
+  referenceTimeUs() {
+    return Math.round(performance.now() * 1000) >>> 0;
+  }
+
+  /**
+   * Handles a clock sync request by replying with the device's send time t1,
+   * and the reference times t2 of receiving the request and t3 of replying.
+   * @param {!Uint8Array} messagePayload A byte array containing t1.
+   * @private
+   */
+  receiveClockSyncRequest(messagePayload) {
+    const t2 = this.referenceTimeUs();
+    if (messagePayload.length != 4) {
+      this.log('Invalid clock sync request message.');
+      return;
+    }
+    let responsePayload = new Uint8Array(12);
+    let view = new DataView(responsePayload.buffer);
+    responsePayload.set(messagePayload, 0);
+    view.setUint32(4, t2, /*littleEndian=*/true);
+    view.setUint32(8, this.referenceTimeUs(), /*littleEndian=*/true);
+    this.writeMessage(MESSAGE_TYPE_CLOCK_SYNC_RESPONSE, responsePayload);
+  }
+
+  /**
+   * Writes a block of samples for all tactors, to be played by every connected
+   * device at the same reference time. The presentation time should lead the
+   * current reference time by more than the worst BLE delay of the devices.
+   * @param {number} presentationUs Reference time in microseconds to play at.
+   * @param {!Uint8Array} samples 96 samples, 8 per PWM channel.
+   */
+  requestPlayTimedSamples(presentationUs, samples) {
+    if (!this.connected) { return; }
+    let messagePayload = new Uint8Array(4 + samples.length);
+    let view = new DataView(messagePayload.buffer);
+    view.setUint32(0, presentationUs >>> 0, /*littleEndian=*/true);
+    messagePayload.set(samples, 4);
+    this.writeMessage(MESSAGE_TYPE_TIMED_TACTORS_SAMPLES, messagePayload);
+  }
+
+  /**
+   * Uploads an extended-format pattern, without the End op, to be stored in
+   * the device's pattern library as `id`. Patterns longer than a message are
+   * sent in chunks, each written after the previous write completes. The
+   * device replies with an upload status message.
+   * @param {number} id Pattern ID in [0, 15].
+   * @param {!Uint8Array} pattern Pattern bytes, at most 511.
+   */
+  async requestUploadPattern(id, pattern) {
+    if (!this.connected) { return; }
+    const kMaxChunkBytes = 123;
+    let offset = 0;
+    do {
+      let chunk = pattern.subarray(offset, offset + kMaxChunkBytes);
+      let messagePayload = new Uint8Array(5 + chunk.length);
+      let view = new DataView(messagePayload.buffer);
+      messagePayload[0] = id;
+      view.setUint16(1, pattern.length, /*littleEndian=*/true);
+      view.setUint16(3, offset, /*littleEndian=*/true);
+      messagePayload.set(chunk, 5);
+      await this.writeMessage(MESSAGE_TYPE_TACTILE_PATTERN_CHUNK,
+                              messagePayload);
+      offset += chunk.length;
+    } while (offset < pattern.length);
+  }
+
+  /**
+   * Plays a pattern from the device's pattern library.
+   * @param {number} id Pattern ID.
+   */
+  requestPlayPattern(id) {
+    if (!this.connected) { return; }
+    this.writeMessage(MESSAGE_TYPE_PLAY_TACTILE_PATTERN, new Uint8Array([id]));
+  }
+
   /**
    * Handles a channel map message by parsing the input, recording the new
    * values, and updating the channel UI.
@@ -784,6 +1006,7 @@ class BleManager {
    * Writes a message to the device.
    * @param {number} messageType Code indicating the message type.
    * @param {!Uint8Array} messagePayload Contents to send to device.
+   * @return {!Promise|undefined} Promise resolved when the write completes.
    * @private
    */
   writeMessage(messageType, messagePayload) {
@@ -805,7 +1028,7 @@ class BleManager {
     }
     bytes[0] = sum1 % 255;
     bytes[1] = sum2 % 255;
-    this.nusRx.writeValue(bytes);
+    return this.nusRx.writeValue(bytes);
   }
 }
 
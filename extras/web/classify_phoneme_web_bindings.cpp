@@ -192,6 +192,16 @@ extern "C" void EMSCRIPTEN_KEEPALIVE ClassifierInitAudio(int sample_rate_hz,
   engine.frames = (float*)malloc(sizeof(float) * kNumFrames * kNumChannels);
 }
 
+// Sets the phoneme scores to display from kNumPhonemes scores quantized to
+// [0, 255]. Called with updates posted by classify_phoneme_worker.js, when
+// classification runs in a Web Worker instead of ClassifierProcessAudio().
+extern "C" void EMSCRIPTEN_KEEPALIVE ClassifierSetScores(intptr_t scores_ptr) {
+  const uint8_t* scores = reinterpret_cast<const uint8_t*>(scores_ptr);
+  for (int i = 0; i < kNumPhonemes; ++i) {
+    engine.scores.phoneme[i] = scores[i] / 255.0f;
+  }
+}
+
 // Processes one chunk of audio data. Called from onaudioprocess.
 extern "C" void EMSCRIPTEN_KEEPALIVE ClassifierProcessAudio(intptr_t input_ptr,
                                                             int chunk_size) {
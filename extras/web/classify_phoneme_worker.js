@@ -0,0 +1,81 @@
+/**
+ * Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * Web Worker running phoneme classification off the main thread.
+ *
+ * The worker is started as a module worker and sent one message
+ *   {wasmBytes: ArrayBuffer of classify_phoneme_worker.wasm,
+ *    audioRing: SharedArrayBuffer from SabRing.allocate(..., QUANTUM_SIZE),
+ *    sampleRate: audio sample rate in Hz}
+ * Audio arrives through `audioRing`, pushed by audio_capture_worklet.js. The
+ * worker blocks until audio is available, drains all available quanta into
+ * wasm memory, and runs CarlFrontend and the streaming classifier on them in
+ * one call (see classify_phoneme_worker_bindings.cpp). After each call that
+ * produced frames, it posts a compact update
+ *   {phoneme: index of the top-scoring phoneme,
+ *    scores: Uint8Array of phoneme scores quantized to [0, 255]}
+ * back to the page. Neither the audio thread nor the page ever waits on the
+ * classifier, so UI animation doesn't stall classification and vice versa.
+ */
+
+import {SabRing} from './sab_ring.js';
+import {MakeWasiImports} from './wasi_imports.js';
+
+const QUANTUM_SIZE = 128;
+const NUM_PHONEMES = 40;
+
+function Run(wasmBytes, audioRingSab, sampleRate) {
+  const module = new WebAssembly.Module(wasmBytes);
+  let memory = null;
+  const instance = new WebAssembly.Instance(
+      module, MakeWasiImports(module, () => memory));
+  const wasm = instance.exports;
+  memory = wasm.memory;
+  if (wasm._initialize) { wasm._initialize(); }
+
+  if (!wasm.PhonemeWorkerInit(sampleRate)) {
+    console.log('Error: Failed to initialize phoneme classifier.');
+    return;
+  }
+  const maxSamples = wasm.PhonemeWorkerMaxInputSize();
+  const audioRing = new SabRing(audioRingSab, QUANTUM_SIZE);
+
+  for (;;) {
+    if (!audioRing.wait(1000)) { continue; }
+    // Pop quanta directly into wasm memory. The buffer may move if memory
+    // grows, so get the pointer and view on every call.
+    const inputPtr = wasm.PhonemeWorkerInputBuffer();
+    let numSamples = 0;
+    while (numSamples + QUANTUM_SIZE <= maxSamples &&
+           audioRing.pop(new Float32Array(memory.buffer,
+                                          inputPtr + 4 * numSamples,
+                                          QUANTUM_SIZE))) {
+      numSamples += QUANTUM_SIZE;
+    }
+
+    if (wasm.PhonemeWorkerProcess(numSamples) > 0) {
+      const scores = new Uint8Array(memory.buffer,
+                                    wasm.PhonemeWorkerScores(),
+                                    NUM_PHONEMES).slice();
+      postMessage({phoneme: wasm.PhonemeWorkerPhoneme(), scores: scores},
+                  [scores.buffer]);
+    }
+  }
+}
+
+onmessage = (e) => {
+  Run(e.data.wasmBytes, e.data.audioRing, e.data.sampleRate);
+};
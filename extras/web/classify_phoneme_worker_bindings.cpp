@@ -0,0 +1,128 @@
+// Copyright 2022 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+// Phoneme classification engine for running in a Web Worker.
+//
+// This is built as a standalone wasm module with SIMD128 enabled, like
+// tactile_processor_worklet_bindings.cpp, so that CarlFrontend and the
+// classifier's dense layers use WebAssembly SIMD (see dsp/simd.h). It is
+// instantiated by classify_phoneme_worker.js, which writes all audio that has
+// arrived to `PhonemeWorkerInputBuffer()` and calls `PhonemeWorkerProcess()`
+// once for the batch. Frames are classified with ClassifyPhonemeStreamer, so
+// no window of frames is shifted per frame, and only the scores of the newest
+// frame are returned, quantized to bytes for a compact message to the page.
+
+#if !defined(__EMSCRIPTEN__)
+#error This file must be built with emscripten
+#endif
+
+#include <emscripten.h>
+
+#include <cstdint>
+
+#include "frontend/carl_frontend.h"
+#include "phonetics/classify_phoneme.h"
+
+constexpr int kNumChannels = kClassifyPhonemeStreamerNumChannels;
+constexpr int kNumPhonemes = kClassifyPhonemeNumPhonemes;
+// ClassifyPhoneme expects 8ms blocks at 16 kHz.
+constexpr int kBlockSize = 128;
+constexpr float kPcenDiffusivity = 60.0f;
+// Max number of samples per PhonemeWorkerProcess() call, 64ms of audio. If the
+// worker falls further behind, the rest is processed in the next call.
+constexpr int kMaxInputSize = 1024;
+
+struct {
+  CarlFrontend* frontend;
+  ClassifyPhonemeStreamer streamer;
+  // Input samples not yet processed, at most kBlockSize - 1 of them are carried
+  // over between calls.
+  float input[kBlockSize + kMaxInputSize];
+  int input_size;
+  float frame[kNumChannels];
+  ClassifyPhonemeLabels labels;
+  ClassifyPhonemeScores scores;
+  // Phoneme scores of the newest frame, quantized to [0, 255].
+  uint8_t quantized_scores[kNumPhonemes];
+} engine;
+
+// Initializes CarlFrontend and the classifier. Returns 1 on success, 0 on
+// failure.
+extern "C" int EMSCRIPTEN_KEEPALIVE PhonemeWorkerInit(int sample_rate_hz) {
+  CarlFrontendParams frontend_params = kCarlFrontendDefaultParams;
+  frontend_params.input_sample_rate_hz = sample_rate_hz;
+  frontend_params.block_size = kBlockSize;
+  frontend_params.pcen_cross_channel_diffusivity = kPcenDiffusivity;
+  engine.frontend = CarlFrontendMake(&frontend_params);
+  if (engine.frontend == nullptr) { return 0; }
+  ClassifyPhonemeStreamerReset(&engine.streamer);
+  engine.input_size = 0;
+  return 1;
+}
+
+// Returns the max number of samples per PhonemeWorkerProcess() call.
+extern "C" int EMSCRIPTEN_KEEPALIVE PhonemeWorkerMaxInputSize() {
+  return kMaxInputSize;
+}
+
+// Returns the buffer where the caller should write input samples, with space
+// for kMaxInputSize samples.
+extern "C" float* EMSCRIPTEN_KEEPALIVE PhonemeWorkerInputBuffer() {
+  return engine.input + engine.input_size;
+}
+
+// Returns the kNumPhonemes quantized scores of the newest frame.
+extern "C" uint8_t* EMSCRIPTEN_KEEPALIVE PhonemeWorkerScores() {
+  return engine.quantized_scores;
+}
+
+// Returns the index of the top-scoring phoneme in the newest frame.
+extern "C" int EMSCRIPTEN_KEEPALIVE PhonemeWorkerPhoneme() {
+  return engine.labels.phoneme;
+}
+
+// Processes `num_samples` samples written to PhonemeWorkerInputBuffer().
+// Returns the number of frames classified, which is zero if not enough input
+// has accumulated for a full block.
+extern "C" int EMSCRIPTEN_KEEPALIVE PhonemeWorkerProcess(int num_samples) {
+  if (num_samples > kMaxInputSize) { num_samples = kMaxInputSize; }
+  engine.input_size += num_samples;
+  const int num_frames = engine.input_size / kBlockSize;
+
+  float* input = engine.input;
+  for (int f = 0; f < num_frames; ++f) {
+    CarlFrontendProcessSamples(engine.frontend, input, engine.frame);
+    // Only the newest frame's outputs are reported.
+    const bool newest = (f == num_frames - 1);
+    ClassifyPhonemeStreamerProcessFrame(
+        &engine.streamer, engine.frame, newest ? &engine.labels : nullptr,
+        newest ? &engine.scores : nullptr);
+    input += kBlockSize;
+  }
+
+  if (num_frames > 0) {
+    for (int i = 0; i < kNumPhonemes; ++i) {
+      engine.quantized_scores[i] =
+          static_cast<uint8_t>(255.0f * engine.scores.phoneme[i] + 0.5f);
+    }
+  }
+
+  // Move leftover samples to the front of the buffer.
+  engine.input_size -= num_frames * kBlockSize;
+  for (int i = 0; i < engine.input_size; ++i) {
+    engine.input[i] = input[i];
+  }
+  return num_frames;
+}
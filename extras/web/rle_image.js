@@ -0,0 +1,52 @@
+/**
+ * Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * Decodes run-length encoded (RLE) image assets in JavaScript.
+ *
+ * This is the same format as decoded by CreateTextureFromRleData() in
+ * extras/tools/sdl/texture_from_rle_data.c and described in
+  * extras/tools/sdl/rle_compress_image.py: an 8-byte big endian rectangle (x, y, w, h), followed
+ * by an 8-bit alpha channel in TGA-style run-length and raw packets. It is used
+ * to draw the tactile visualization assets without SDL, see
+ * tactile_render_worker.js.
+ */
+
+/* Decodes the image starting at `bytes[0]`. Returns {rect, imageData} where
+ * `rect` is {x, y, w, h} and `imageData` is an ImageData of white pixels with
+ * the decoded alpha, or null if the data is corrupt.
+ */
+export function DecodeRleImage(bytes) {
+  const readU16 = (i) => (bytes[i] << 8) | bytes[i + 1];
+  const rect = {x: readU16(0), y: readU16(2), w: readU16(4), h: readU16(6)};
+  const numPixels = rect.w * rect.h;
+  const rgba = new Uint8ClampedArray(4 * numPixels).fill(255);
+  let pos = 8;  // Skip the rectangle.
+  for (let i = 0; i < numPixels;) {
+    // The high bit of the packet header indicates a run-length packet, and the
+    // lower 7 bits encode the length minus one.
+    const header = bytes[pos++];
+    const n = 1 + (header & 0x7f);
+    if (i + n > numPixels) { return null; }
+    if (header & 0x80) {  // Run-length packet.
+      const alpha = bytes[pos++];
+      for (let k = 0; k < n; ++k) { rgba[4 * (i + k) + 3] = alpha; }
+    } else {  // Raw packet.
+      for (let k = 0; k < n; ++k) { rgba[4 * (i + k) + 3] = bytes[pos++]; }
+    }
+    i += n;
+  }
+  return {rect: rect, imageData: new ImageData(rgba, rect.w, rect.h)};
+}
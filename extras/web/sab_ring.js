@@ -0,0 +1,86 @@
+/**
+ * Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * Single-producer single-consumer ring of fixed-size float frames in a
+ * SharedArrayBuffer.
+ *
+ * The producer and consumer may run on different threads, e.g. an
+ * AudioWorklet and the UI thread. Neither side ever blocks: `push` drops the
+ * frame and returns false when the ring is full, and `pop` returns false when
+ * it is empty. Read and write indices are updated with Atomics so that frame
+ * data written before a `push` is visible to the consumer after it observes
+ * the new write index. A consumer on a Web Worker may also block in `wait`
+ * until a frame arrives, rather than polling.
+ *
+ * Example use:
+ *   // On the UI thread.
+ *   const sab = SabRing.allocate(64, 10);
+ *   node.port.postMessage(sab);  // Hand to the other thread.
+ *   const ring = new SabRing(sab, 10);
+ *   const frame = new Float32Array(10);
+ *   while (ring.pop(frame)) { ... }
+ */
+
+export class SabRing {
+  /* Allocates a SharedArrayBuffer for a ring of `capacity` frames, each of
+   * `frameSize` floats.
+   */
+  static allocate(capacity, frameSize) {
+    // Header of two Int32 indices, followed by one extra frame so that a full
+    // ring is distinguishable from an empty one.
+    return new SharedArrayBuffer(8 + 4 * (capacity + 1) * frameSize);
+  }
+
+  /* Wraps a SharedArrayBuffer made by `allocate()`. */
+  constructor(sab, frameSize) {
+    this.indices = new Int32Array(sab, 0, 2);  // [read index, write index].
+    this.data = new Float32Array(sab, 8);
+    this.frameSize = frameSize;
+    this.numSlots = this.data.length / frameSize;
+  }
+
+  /* Pushes `frame`. Returns false if the ring is full. Producer only. */
+  push(frame) {
+    const write = Atomics.load(this.indices, 1);
+    const next = (write + 1) % this.numSlots;
+    if (next == Atomics.load(this.indices, 0)) { return false; }
+    this.data.set(frame.subarray(0, this.frameSize), write * this.frameSize);
+    Atomics.store(this.indices, 1, next);
+    Atomics.notify(this.indices, 1);
+    return true;
+  }
+
+  /* Blocks until the ring is nonempty or `timeoutMs` elapses. Returns false on
+   * timeout. Consumer only, and not allowed on the main thread.
+   */
+  wait(timeoutMs) {
+    const write = Atomics.load(this.indices, 1);
+    if (write != Atomics.load(this.indices, 0)) { return true; }
+    return Atomics.wait(this.indices, 1, write, timeoutMs) != 'timed-out';
+  }
+
+  /* Pops the oldest frame into `frame`. Returns false if the ring is empty.
+   * Consumer only.
+   */
+  pop(frame) {
+    const read = Atomics.load(this.indices, 0);
+    if (read == Atomics.load(this.indices, 1)) { return false; }
+    const start = read * this.frameSize;
+    frame.set(this.data.subarray(start, start + this.frameSize));
+    Atomics.store(this.indices, 0, (read + 1) % this.numSlots);
+    return true;
+  }
+}
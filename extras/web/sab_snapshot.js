@@ -0,0 +1,73 @@
+/**
+ * Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * Latest-value snapshot of a fixed-size float array in a SharedArrayBuffer.
+ *
+ * Unlike SabRing, which queues every frame, a snapshot holds only the most
+ * recent values, as suits a visualization that draws at its own frame rate,
+ * e.g. tactor volume meters written by an AudioWorklet and read by a render
+ * worker. It is a seqlock: the writer makes a sequence number odd while
+ * writing and even when done, and the reader retries if the number was odd or
+ * changed while it copied the values. Neither side ever blocks or waits for
+ * the other, and there must be only one writer.
+ *
+ * Example use:
+ *   const sab = SabSnapshot.allocate(10);
+ *   const snapshot = new SabSnapshot(sab, 10);
+ *   snapshot.write(values);  // On the writer thread.
+ *   if (snapshot.read(values)) { ... }  // On the reader thread.
+ */
+
+export class SabSnapshot {
+  /* Allocates a SharedArrayBuffer for a snapshot of `size` floats. */
+  static allocate(size) {
+    // Header of an Int32 sequence number, followed by the values.
+    return new SharedArrayBuffer(4 + 4 * size);
+  }
+
+  /* Wraps a SharedArrayBuffer made by `allocate()`. */
+  constructor(sab, size) {
+    this.sequence = new Int32Array(sab, 0, 1);
+    this.data = new Float32Array(sab, 4, size);
+    this.scratch = new Float32Array(size);  // Reader's copy, checked on read.
+  }
+
+  /* Writes `values`, the first `size` of which are used. Writer only. */
+  write(values) {
+    const sequence = Atomics.load(this.sequence, 0);
+    Atomics.store(this.sequence, 0, sequence + 1);  // Odd while writing.
+    this.data.set(values.subarray(0, this.data.length));
+    Atomics.store(this.sequence, 0, sequence + 2);
+  }
+
+  /* Copies the latest values into `values`. Returns false, leaving `values`
+   * unchanged, if nothing has been written yet or if a consistent copy wasn't
+   * obtained after a few tries because the writer was busy. Reader only.
+   */
+  read(values) {
+    for (let tries = 0; tries < 4; ++tries) {
+      const sequence = Atomics.load(this.sequence, 0);
+      if (sequence == 0) { return false; }
+      if (sequence & 1) { continue; }  // Write in progress.
+      this.scratch.set(this.data);
+      if (Atomics.load(this.sequence, 0) == sequence) {
+        values.set(this.scratch);
+        return true;
+      }
+    }
+    return false;
+  }
+}
@@ -44,13 +44,14 @@ struct {
   int peak_i[kMaxPeaks];
   int peak_y[kMaxPeaks];
   int num_peaks;
+  // Plot data for tactile_render_worker.js, see TactileLitePlotSnapshot().
+  float snapshot[1 + 3 * kNumPoints + 2 * kMaxPeaks];
 } engine;
 
 static void MainTick();
 
-// Initializes SDL. This gets called immediately after the emscripten runtime
-// has initialized.
-extern "C" void EMSCRIPTEN_KEEPALIVE OnLoad() {
+// Initializes the plots.
+static void InitPlots() {
   for (int i = 0; i < kNumPoints; ++i) {
     const int x = (kCanvasWidth * i + (kNumPoints - 1) / 2) / (kNumPoints - 1);
     engine.envelope_plot[i].x = x;
@@ -61,6 +62,12 @@ extern "C" void EMSCRIPTEN_KEEPALIVE OnLoad() {
     engine.thresh_plot[i].y = kCanvasHeight - 1;
   }
   engine.num_peaks = 0;
+}
+
+// Initializes SDL. This gets called immediately after the emscripten runtime
+// has initialized.
+extern "C" void EMSCRIPTEN_KEEPALIVE OnLoad() {
+  InitPlots();
 
   if (SDL_Init(SDL_INIT_VIDEO) != 0) {
     fprintf(stderr, "Error: %s\n", SDL_GetError());
@@ -84,6 +91,26 @@ extern "C" void EMSCRIPTEN_KEEPALIVE OnLoad() {
   }
 }
 
+// Initializes without SDL, when tactile_render_worker.js draws the plots
+// instead. Called in place of OnLoad().
+extern "C" void EMSCRIPTEN_KEEPALIVE OnLoadWithoutRendering() {
+  InitPlots();
+}
+
+// Fills and returns a snapshot of the plots for tactile_render_worker.js: the
+// number of peaks, the y coordinates of the envelope, smoothed envelope, and
+// threshold (kNumPoints each), then kMaxPeaks peak indices and y coordinates.
+extern "C" float* EMSCRIPTEN_KEEPALIVE TactileLitePlotSnapshot() {
+  float* dest = engine.snapshot;
+  *dest++ = engine.num_peaks;
+  for (int i = 0; i < kNumPoints; ++i) { *dest++ = engine.envelope_plot[i].y; }
+  for (int i = 0; i < kNumPoints; ++i) { *dest++ = engine.smoothed_plot[i].y; }
+  for (int i = 0; i < kNumPoints; ++i) { *dest++ = engine.thresh_plot[i].y; }
+  for (int i = 0; i < kMaxPeaks; ++i) { *dest++ = engine.peak_i[i]; }
+  for (int i = 0; i < kMaxPeaks; ++i) { *dest++ = engine.peak_y[i]; }
+  return engine.snapshot;
+}
+
 static void SetColor(uint32_t color) {
   SDL_SetRenderDrawColor(engine.app.renderer, color >> 16, (color >> 8) & 0xff,
                          color & 0xff, SDL_ALPHA_OPAQUE);
@@ -74,13 +74,19 @@ static bool LoadFormFactorAssets(SDL_Renderer* renderer,
   return true;
 }
 
-// Initializes SDL. This gets called immediately after the emscripten runtime
-// has initialized.
-extern "C" void EMSCRIPTEN_KEEPALIVE OnLoad() {
+// Initializes the volume meters and colormap.
+static void InitVisualization() {
   for (int c = 0; c < kNumTactors; ++c) {
     engine.volume[c] = 0.0f;
   }
   engine.selected_form_factor = 0;
+  GenerateColormap(engine.colormap);
+}
+
+// Initializes SDL. This gets called immediately after the emscripten runtime
+// has initialized.
+extern "C" void EMSCRIPTEN_KEEPALIVE OnLoad() {
+  InitVisualization();
 
   if (SDL_Init(SDL_INIT_VIDEO) != 0) {
     fprintf(stderr, "Error: %s\n", SDL_GetError());
@@ -111,8 +117,25 @@ extern "C" void EMSCRIPTEN_KEEPALIVE OnLoad() {
                             &engine.form_factors[1])) {
     exit(1);
   }
+}
 
-  GenerateColormap(engine.colormap);
+// Initializes without SDL, when tactile_render_worker.js draws the
+// visualization instead. Called in place of OnLoad().
+extern "C" void EMSCRIPTEN_KEEPALIVE OnLoadWithoutRendering() {
+  InitVisualization();
+}
+
+// Returns the RLE-encoded image asset `index` for `form_factor`, for drawing
+// without SDL. Index kNumTactors is the background.
+extern "C" const uint8_t* EMSCRIPTEN_KEEPALIVE TactileImageAssetRle(
+    int form_factor, int index) {
+  return (form_factor == 0 ? kBraceletImageAssetsRle
+                           : kSleeveImageAssetsRle)[index];
+}
+
+// Returns the colormap of 256 RGB colors.
+extern "C" const uint8_t* EMSCRIPTEN_KEEPALIVE TactileColormap() {
+  return engine.colormap;
 }
 
 // Emscripten will call this function once per frame to do event processing
@@ -144,7 +167,8 @@ static void MainTick() {
   SDL_RenderPresent(engine.app.renderer);
 }
 
-// Initializes TactileProcessor. This gets called after WebAudio has started.
+// Initializes TactileProcessor. This gets called after WebAudio has started,
+// unless the AudioWorklet engine is used instead.
 extern "C" void EMSCRIPTEN_KEEPALIVE TactileInitAudio(
     int sample_rate_hz, int chunk_size) {
   engine.chunk_size = chunk_size;
@@ -165,7 +189,21 @@ extern "C" void EMSCRIPTEN_KEEPALIVE TactileInitAudio(
       -chunk_size / (kVolumeMeterTimeConstantSeconds * sample_rate_hz));
 }
 
-// Processes one chunk of audio data. Called from onaudioprocess.
+// Updates the volume meters from `mean_energy`, the mean tactile energy for
+// each tactor over one chunk.
+static void UpdateVolume(const float* mean_energy) {
+  for (int c = 0; c < kNumTactors; ++c) {
+    // Convert tactile energy to perceived strength with Steven's power law.
+    // Perceived strength is roughly proportional to acceleration^0.55, which is
+    // proportional to sqrt(energy)^0.55.
+    const float perceived = std::pow(mean_energy[c], 0.55f * 0.5f);
+    engine.volume[c] *= engine.volume_decay_coeff;
+    engine.volume[c] = std::max(engine.volume[c], perceived);
+  }
+}
+
+// Processes one chunk of audio data. Called from onaudioprocess when
+// AudioWorklet is unavailable.
 extern "C" void EMSCRIPTEN_KEEPALIVE TactileProcessAudio(
     intptr_t input_ptr, int chunk_size) {
   float* input = reinterpret_cast<float*>(input_ptr);
@@ -188,14 +226,17 @@ extern "C" void EMSCRIPTEN_KEEPALIVE TactileProcessAudio(
   }
 
   for (int c = 0; c < kNumTactors; ++c) {
-    // Convert tactile energy to perceived strength with Steven's power law.
-    // Perceived strength is roughly proportional to acceleration^0.55, which is
-    // proportional to sqrt(energy)^0.55.
-    const float perceived = std::pow(energy_accum[c]
-        / (num_blocks * kOutputBlockSize), 0.55f * 0.5f);
-    engine.volume[c] *= engine.volume_decay_coeff;
-    engine.volume[c] = std::max(engine.volume[c], perceived);
+    energy_accum[c] /= num_blocks * kOutputBlockSize;
   }
+  UpdateVolume(energy_accum);
+}
+
+// Returns the kNumTactors volume meters. When the AudioWorklet engine is used,
+// the UI thread writes meters computed by the engine here (see
+// tactile_processor_worklet_bindings.cpp). When rendering in a worker, the UI
+// thread reads meters computed by TactileProcessAudio() from here.
+extern "C" float* EMSCRIPTEN_KEEPALIVE TactileVolumeBuffer() {
+  return engine.volume;
 }
 
 // Sets the selected form factor, bracelet (0) or sleeve (1).
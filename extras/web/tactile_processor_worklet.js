@@ -0,0 +1,73 @@
+/**
+ * Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * AudioWorkletProcessor running TactileProcessor on the audio thread.
+ *
+ * The processor is constructed with processorOptions
+ *   {wasmBytes: ArrayBuffer of tactile_processor_worklet.wasm,
+ *    meterSnapshot: SharedArrayBuffer from SabSnapshot.allocate(NUM_TACTORS)}
+ * It passes input audio through unchanged and, for each render quantum,
+ * writes the NUM_TACTORS volume meters to `meterSnapshot`. The UI thread or
+ * tactile_render_worker.js reads the latest meters at its own frame rate, so
+ * rendering never blocks audio.
+ */
+
+import {SabSnapshot} from './sab_snapshot.js';
+import {MakeWasiImports} from './wasi_imports.js';
+
+const NUM_TACTORS = 10;
+
+class TactileProcessorWorklet extends AudioWorkletProcessor {
+  constructor(options) {
+    super();
+    const module = new WebAssembly.Module(options.processorOptions.wasmBytes);
+    let memory = null;
+    const instance = new WebAssembly.Instance(
+        module, MakeWasiImports(module, () => memory));
+    this.wasm = instance.exports;
+    memory = this.wasm.memory;
+    if (this.wasm._initialize) { this.wasm._initialize(); }
+
+    this.ready = this.wasm.TactileWorkletInit(sampleRate) != 0;
+    if (!this.ready) {
+      console.log('Error: Failed to create TactileProcessor.');
+    }
+    this.meterSnapshot = new SabSnapshot(
+        options.processorOptions.meterSnapshot, NUM_TACTORS);
+  }
+
+  process(inputs, outputs) {
+    const input = inputs[0][0];
+    if (!input) { return true; }  // No input connected.
+    // Copy audio to output so that it can be played.
+    outputs[0][0].set(input);
+    if (!this.ready) { return true; }
+
+    // Copy to wasm memory. The buffer may move if memory grows, so get the
+    // pointer and view on every call.
+    const inputPtr = this.wasm.TactileWorkletInputBuffer();
+    new Float32Array(this.wasm.memory.buffer, inputPtr, input.length).set(input);
+
+    if (this.wasm.TactileWorkletProcess(input.length) > 0) {
+      const volumePtr = this.wasm.TactileWorkletVolumeBuffer();
+      this.meterSnapshot.write(
+          new Float32Array(this.wasm.memory.buffer, volumePtr, NUM_TACTORS));
+    }
+    return true;
+  }
+}
+
+registerProcessor('tactile-processor', TactileProcessorWorklet);
@@ -0,0 +1,132 @@
+// Copyright 2022 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+// TactileProcessor engine for running in an AudioWorklet.
+//
+// This is built as a standalone wasm module with SIMD128 enabled, separate
+// from the SDL visualization in tactile_processor_web_bindings.cpp, so that it
+// can be instantiated on the audio rendering thread by
+// tactile_processor_worklet.js. Per render quantum, the worklet copies input
+// audio to `TactileWorkletInputBuffer()`, calls `TactileWorkletProcess()`, and
+// publishes the volume meters in `TactileWorkletVolumeBuffer()` through a
+// SharedArrayBuffer snapshot, which is drawn by the UI thread or a render
+// worker.
+
+#if !defined(__EMSCRIPTEN__)
+#error This file must be built with emscripten
+#endif
+
+#include <emscripten.h>
+
+#include <algorithm>
+#include <cmath>
+
+#include "tactile/tactile_processor.h"
+
+// The visualization has nominally 10 tactors even for the bracelet.
+constexpr int kNumTactors = 10;
+constexpr int kDecimationFactor = 8;
+constexpr int kBlockSize = 64;
+constexpr int kOutputBlockSize = kBlockSize / kDecimationFactor;
+// Max number of samples per TactileWorkletProcess() call. AudioWorklet
+// currently uses a fixed render quantum of 128 samples.
+constexpr int kMaxInputSize = 1024;
+constexpr float kVolumeMeterTimeConstantSeconds = 0.05f;
+
+struct {
+  TactileProcessor* tactile_processor;
+  // Input samples not yet processed, at most kBlockSize - 1 of them are carried
+  // over between calls.
+  float input[kBlockSize + kMaxInputSize];
+  int input_size;
+  float tactile_output[kOutputBlockSize * kNumTactors];
+  float sample_rate_hz;
+  // Volume meter for each tactor, as in tactile_processor_web_bindings.cpp.
+  float volume[kNumTactors];
+} engine;
+
+// Initializes TactileProcessor. Returns 1 on success, 0 on failure.
+extern "C" int EMSCRIPTEN_KEEPALIVE TactileWorkletInit(int sample_rate_hz) {
+  TactileProcessorParams params;
+  TactileProcessorSetDefaultParams(&params);
+  params.decimation_factor = kDecimationFactor;
+  params.frontend_params.block_size = kBlockSize;
+  params.frontend_params.input_sample_rate_hz = sample_rate_hz;
+
+  engine.tactile_processor = TactileProcessorMake(&params);
+  engine.input_size = 0;
+  engine.sample_rate_hz = sample_rate_hz;
+  for (int c = 0; c < kNumTactors; ++c) {
+    engine.volume[c] = 0.0f;
+  }
+  return engine.tactile_processor != nullptr;
+}
+
+// Returns the buffer where the caller should write input samples, with space
+// for kMaxInputSize samples.
+extern "C" float* EMSCRIPTEN_KEEPALIVE TactileWorkletInputBuffer() {
+  return engine.input + engine.input_size;
+}
+
+// Returns the buffer of kNumTactors volume meters, updated by
+// TactileWorkletProcess().
+extern "C" float* EMSCRIPTEN_KEEPALIVE TactileWorkletVolumeBuffer() {
+  return engine.volume;
+}
+
+// Processes `num_samples` samples written to TactileWorkletInputBuffer().
+// Returns the number of tactile frames that contributed to the volume meters,
+// which is zero if not enough input has accumulated for a full block.
+extern "C" int EMSCRIPTEN_KEEPALIVE TactileWorkletProcess(int num_samples) {
+  if (num_samples > kMaxInputSize) { num_samples = kMaxInputSize; }
+  engine.input_size += num_samples;
+  const int num_blocks = engine.input_size / kBlockSize;
+  float energy[kNumTactors] = {0.0f};
+
+  const float* input = engine.input;
+  for (int b = 0; b < num_blocks; ++b) {
+    float* tactile = engine.tactile_output;
+    TactileProcessorProcessSamples(engine.tactile_processor, input, tactile);
+
+    for (int i = 0; i < kOutputBlockSize; ++i) {
+      for (int c = 0; c < kNumTactors; ++c) {
+        energy[c] += tactile[c] * tactile[c];
+      }
+      tactile += kNumTactors;
+    }
+    input += kBlockSize;
+  }
+
+  const int num_frames = num_blocks * kOutputBlockSize;
+  if (num_frames > 0) {
+    const float decay_coeff = std::exp(
+        -num_blocks * kBlockSize /
+        (kVolumeMeterTimeConstantSeconds * engine.sample_rate_hz));
+    for (int c = 0; c < kNumTactors; ++c) {
+      // Convert mean tactile energy to perceived strength with Steven's power
+      // law, as in tactile_processor_web_bindings.cpp.
+      const float perceived = std::pow(energy[c] / num_frames, 0.55f * 0.5f);
+      engine.volume[c] =
+          std::max(engine.volume[c] * decay_coeff, perceived);
+    }
+  }
+
+  // Move leftover samples to the front of the buffer.
+  engine.input_size -= num_blocks * kBlockSize;
+  for (int i = 0; i < engine.input_size; ++i) {
+    engine.input[i] = input[i];
+  }
+  return num_frames;
+}
@@ -0,0 +1,167 @@
+/**
+ * Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * Web Worker rendering the tactile visualizations on an OffscreenCanvas.
+ *
+ * The tactile_processor and tactile_lite demos otherwise draw with SDL on the
+ * main thread, where rendering competes with audio processing and can cause
+ * underruns. Instead, when the page is cross-origin isolated, the page
+ * transfers its canvas to this worker with transferControlToOffscreen(). The
+ * worker draws on its own animation frames from the latest values in a
+ * SabSnapshot, so neither side ever waits for the other. Drawing matches the
+ * SDL code in tactile_processor_web_bindings.cpp and
+ * tactile_lite_web_bindings.cpp.
+ *
+ * The worker is started as a module worker and sent one of
+ *
+ *   {kind: 'meters', canvas: OffscreenCanvas,
+ *    snapshot: SharedArrayBuffer from SabSnapshot.allocate(numTactors),
+ *    numTactors, colormap: Uint8Array of 256 RGB colors,
+ *    formFactors: per form factor, an array of numTactors + 1 images
+ *                 {rect, bitmap}, the last being the background,
+ *    formFactor: index of the selected form factor}
+ *
+ *   {kind: 'envelope', canvas: OffscreenCanvas,
+ *    snapshot: SharedArrayBuffer from SabSnapshot.allocate(
+ *                  1 + 3 * numPoints + 2 * maxPeaks),
+ *    numPoints, maxPeaks}
+ *
+ * For 'meters', later messages {formFactor} select the form factor.
+ */
+
+import {SabSnapshot} from './sab_snapshot.js';
+
+const requestFrame = self.requestAnimationFrame ?
+    (callback) => self.requestAnimationFrame(callback) :
+    (callback) => setTimeout(callback, 16);
+
+/* Returns a CSS color string for an RGB triple. */
+function CssColor(r, g, b) {
+  return `rgb(${r},${g},${b})`;
+}
+
+/* White image mask that is drawn with a color, as with SDL_SetTextureColorMod.
+ * The tinted image is cached and only redrawn when the color changes.
+ */
+class TintedImage {
+  constructor({rect, bitmap}) {
+    this.rect = rect;
+    this.bitmap = bitmap;
+    this.tinted = new OffscreenCanvas(rect.w, rect.h);
+    this.context = this.tinted.getContext('2d');
+    this.color = null;
+  }
+
+  draw(context, color) {
+    if (color != this.color) {
+      this.context.globalCompositeOperation = 'copy';
+      this.context.drawImage(this.bitmap, 0, 0);
+      // Keep the mask's alpha, replacing white with `color`.
+      this.context.globalCompositeOperation = 'source-in';
+      this.context.fillStyle = color;
+      this.context.fillRect(0, 0, this.rect.w, this.rect.h);
+      this.color = color;
+    }
+    context.drawImage(this.tinted, this.rect.x, this.rect.y);
+  }
+}
+
+/* Draws tactor volume meters, as in tactile_processor_web_bindings.cpp. */
+function RunMeters(message) {
+  const context = message.canvas.getContext('2d');
+  const numTactors = message.numTactors;
+  const snapshot = new SabSnapshot(message.snapshot, numTactors);
+  const volume = new Float32Array(numTactors);
+  const colormap = message.colormap;
+  const formFactors = message.formFactors.map(
+      (images) => images.map((image) => new TintedImage(image)));
+  let formFactor = message.formFactor;
+  onmessage = (e) => { formFactor = e.data.formFactor; };
+
+  const draw = () => {
+    snapshot.read(volume);
+    const images = formFactors[formFactor];
+    context.fillStyle = '#000';
+    context.fillRect(0, 0, message.canvas.width, message.canvas.height);
+    images[numTactors].draw(context, CssColor(0x9d, 0x8c, 0x78));  // Background.
+
+    for (let c = 0; c < numTactors; ++c) {
+      const activation = Math.min(Math.max(volume[c] / 0.4, 0.0), 1.0);
+      const i = 3 * Math.round(255 * activation);
+      images[c].draw(context, CssColor(colormap[i], colormap[i + 1], colormap[i + 2]));
+    }
+    requestFrame(draw);
+  };
+  requestFrame(draw);
+}
+
+/* Draws the envelope, smoothed envelope, threshold, and peaks, as in
+ * tactile_lite_web_bindings.cpp. The snapshot holds the number of peaks,
+ * the y coordinates of the three curves, then peak indices and y coordinates.
+ */
+function RunEnvelope(message) {
+  const canvas = message.canvas;
+  const context = canvas.getContext('2d');
+  const numPoints = message.numPoints;
+  const maxPeaks = message.maxPeaks;
+  const snapshot = new SabSnapshot(message.snapshot,
+                                   1 + 3 * numPoints + 2 * maxPeaks);
+  const values = new Float32Array(1 + 3 * numPoints + 2 * maxPeaks);
+  const x = new Float32Array(numPoints);
+  for (let i = 0; i < numPoints; ++i) {
+    x[i] = Math.floor((canvas.width * i + Math.floor((numPoints - 1) / 2)) /
+                      (numPoints - 1));
+  }
+  values.fill(canvas.height - 1);
+  values[0] = 0;
+
+  const drawCurve = (offset, color) => {
+    context.strokeStyle = color;
+    context.beginPath();
+    context.moveTo(x[0], values[offset]);
+    for (let i = 1; i < numPoints; ++i) {
+      context.lineTo(x[i], values[offset + i]);
+    }
+    context.stroke();
+  };
+
+  const draw = () => {
+    snapshot.read(values);
+    context.fillStyle = '#000';
+    context.fillRect(0, 0, canvas.width, canvas.height);
+    drawCurve(1, '#67493e');
+    drawCurve(1 + 2 * numPoints, '#5e94b8');
+    drawCurve(1 + numPoints, '#f1bc1c');
+
+    context.fillStyle = '#ffffcc';
+    const peaks = 1 + 3 * numPoints;
+    const numPeaks = Math.min(values[0], maxPeaks);
+    for (let i = 0; i < numPeaks; ++i) {
+      const y = values[peaks + maxPeaks + i];
+      context.fillRect(x[values[peaks + i]], y, 3, canvas.height - y);
+    }
+    requestFrame(draw);
+  };
+  requestFrame(draw);
+}
+
+onmessage = (e) => {
+  if (e.data.kind == 'meters') {
+    RunMeters(e.data);
+  } else if (e.data.kind == 'envelope') {
+    RunEnvelope(e.data);
+  }
+};
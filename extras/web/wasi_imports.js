@@ -0,0 +1,51 @@
+/**
+ * Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * Stub WASI imports for standalone emscripten wasm modules.
+ *
+ * Modules built with -s STANDALONE_WASM=1 import a few WASI functions for stdio
+ * and exit. The engines in tactile_processor_worklet.js and
+ * classify_phoneme_worker.js instantiate such modules directly, without
+ * emscripten's JS glue, so they provide these stubs instead.
+ */
+
+/* Makes stub imports for the WASI functions that a standalone emscripten
+ * module imports for stdio and exit. Output written to stderr is logged.
+ */
+export function MakeWasiImports(module, getMemory) {
+  const imports = {};
+  for (const entry of WebAssembly.Module.imports(module)) {
+    imports[entry.module] = imports[entry.module] || {};
+    imports[entry.module][entry.name] = () => 0;
+  }
+  if (imports.wasi_snapshot_preview1) {
+    imports.wasi_snapshot_preview1.fd_write = (fd, iovs, iovsLen, nwritten) => {
+      const view = new DataView(getMemory().buffer);
+      let text = '';
+      let total = 0;
+      for (let i = 0; i < iovsLen; ++i) {
+        const ptr = view.getUint32(iovs + 8 * i, true);
+        const len = view.getUint32(iovs + 8 * i + 4, true);
+        text += String.fromCharCode(...new Uint8Array(getMemory().buffer, ptr, len));
+        total += len;
+      }
+      view.setUint32(nwritten, total, true);
+      if (fd == 2) { console.log(text); }
+      return 0;
+    };
+  }
+  return imports;
+}
@@ -18,7 +18,15 @@
 
 namespace audio_tactile {
 
-Lis3dh::Lis3dh() {}
+Lis3dh::Lis3dh()
+    : accel_raw_{0, 0, 0},
+      read_pending_(false),
+      ready_(false),
+      fifo_batch_size_(0),
+      fifo_read_pending_(false),
+      fifo_batch_ready_(false),
+      num_fifo_overruns_(0),
+      fifo_int1_pin_(-1) {}
 
 bool Lis3dh::Initialize() {
   // Initialize the I2C bus.
@@ -44,29 +52,155 @@ bool Lis3dh::Initialize() {
 
 void Lis3dh::Disable() {
   // Disable all the axis, put accelerometer to sleep.
-  i2c_write(CTRL_REG1, 0x00);
+  const uint8_t value = 0x00;
+  i2c_write_registers_async(kLis3dhAddress, CTRL_REG1, &value, 1, nullptr,
+                            nullptr);
 }
 
 void Lis3dh::Enable() {
   // Enable all the axis, wake up the accelerometer.
-  i2c_write(CTRL_REG1, 0x37);
+  const uint8_t value = 0x37;
+  i2c_write_registers_async(kLis3dhAddress, CTRL_REG1, &value, 1, nullptr,
+                            nullptr);
 }
 
-const int16_t* Lis3dh::ReadXyzAccelerationRaw() {
-  static int16_t accel[3];
-  uint8_t* buffer;
-
+void Lis3dh::StartReadXyzAcceleration() {
+  if (read_pending_) { return; }
+  read_pending_ = true;
   // Set the most significant bit of the first read register to 1, to enable
   // auto-increment. This way we can read all 6 acceleration registers at once.
-  uint8_t auto_increment_address = OUT_X_L;
-  auto_increment_address |= 0x80;
+  const uint8_t auto_increment_address = OUT_X_L | 0x80;
+  i2c_read_registers_async(kLis3dhAddress, auto_increment_address,
+                           read_buffer_, sizeof(read_buffer_), OnReadComplete,
+                           this);
+}
 
-  buffer = i2c_read_array(auto_increment_address, 6);
+void Lis3dh::OnReadComplete(void* user_data, bool success) {
+  Lis3dh* accelerometer = static_cast<Lis3dh*>(user_data);
+  if (success) {
+    const uint8_t* buffer = accelerometer->read_buffer_;
+    LittleEndianReadS16Array(buffer, 3, accelerometer->accel_raw_);
+    accelerometer->ready_ = true;
+  }
+  accelerometer->read_pending_ = false;
+}
 
-  accel[0] = LittleEndianReadS16(buffer);
-  accel[1] = LittleEndianReadS16(buffer + 2);
-  accel[2] = LittleEndianReadS16(buffer + 4);
-  return accel;
+const int16_t* Lis3dh::LatestXyzAccelerationRaw() {
+  ready_ = false;
+  return accel_raw_;
+}
+
+const int16_t* Lis3dh::ReadXyzAccelerationRaw() {
+  StartReadXyzAcceleration();
+  i2c_wait_idle();
+  return LatestXyzAccelerationRaw();
+}
+
+bool Lis3dh::EnableFifo(int watermark, int int1_pin) {
+  if (!(1 <= watermark && watermark < kFifoSize) || int1_pin < 0) {
+    return false;
+  }
+  // Set INT1 pin as input.
+  nrf_gpio_cfg_input(int1_pin, NRF_GPIO_PIN_NOPULL);
+
+  // Latch rising edges of INT1 in a GPIOTE event. The event's interrupt is not
+  // enabled; PollFifo() checks the event register directly.
+  NRF_GPIOTE->CONFIG[kFifoGpioteChannel] =
+      (GPIOTE_CONFIG_MODE_Event << GPIOTE_CONFIG_MODE_Pos) |
+      ((int1_pin << GPIOTE_CONFIG_PSEL_Pos) & GPIOTE_CONFIG_PORT_PIN_Msk) |
+      (GPIOTE_CONFIG_POLARITY_LoToHi << GPIOTE_CONFIG_POLARITY_Pos);
+  NRF_GPIOTE->EVENTS_IN[kFifoGpioteChannel] = 0;
+
+  fifo_batch_size_ = 0;
+  fifo_batch_ready_ = false;
+  num_fifo_overruns_ = 0;
+  fifo_int1_pin_ = int1_pin;
+
+  // Enable the FIFO (FIFO_EN). Passing through bypass mode clears the FIFO.
+  const uint8_t kCtrlReg5FifoEn = 0x40;
+  const uint8_t kFifoBypassMode = 0x00;
+  // Stream mode (FM = 10) with the watermark level in FTH.
+  const uint8_t fifo_ctrl = 0x80 | (uint8_t)watermark;
+  // Route the FIFO watermark interrupt to INT1 (I1_WTM).
+  const uint8_t kCtrlReg3I1Wtm = 0x04;
+  i2c_write_registers_async(kLis3dhAddress, CTRL_REG5, &kCtrlReg5FifoEn, 1,
+                            nullptr, nullptr);
+  i2c_write_registers_async(kLis3dhAddress, FIFO_CTRL_REG, &kFifoBypassMode,
+                            1, nullptr, nullptr);
+  i2c_write_registers_async(kLis3dhAddress, FIFO_CTRL_REG, &fifo_ctrl, 1,
+                            nullptr, nullptr);
+  i2c_write_registers_async(kLis3dhAddress, CTRL_REG3, &kCtrlReg3I1Wtm, 1,
+                            nullptr, nullptr);
+  return true;
+}
+
+void Lis3dh::DisableFifo() {
+  const uint8_t kZero = 0x00;
+  i2c_write_registers_async(kLis3dhAddress, CTRL_REG3, &kZero, 1, nullptr,
+                            nullptr);
+  i2c_write_registers_async(kLis3dhAddress, FIFO_CTRL_REG, &kZero, 1, nullptr,
+                            nullptr);
+  i2c_write_registers_async(kLis3dhAddress, CTRL_REG5, &kZero, 1, nullptr,
+                            nullptr);
+  NRF_GPIOTE->CONFIG[kFifoGpioteChannel] = 0;
+  fifo_int1_pin_ = -1;
+}
+
+void Lis3dh::PollFifo() {
+  if (fifo_int1_pin_ < 0 || fifo_read_pending_ || fifo_batch_ready_) {
+    return;
+  }
+  // The GPIOTE event latches the rising edge of INT1. Also check the pin
+  // level, since INT1 stays high without a new edge if the FIFO refilled past
+  // the watermark while it was being read.
+  if (!NRF_GPIOTE->EVENTS_IN[kFifoGpioteChannel] &&
+      !nrf_gpio_pin_read(fifo_int1_pin_)) {
+    return;
+  }
+  NRF_GPIOTE->EVENTS_IN[kFifoGpioteChannel] = 0;
+  fifo_read_pending_ = true;
+  // Read the FIFO level, then OnFifoLevelReadComplete() reads the samples.
+  i2c_read_registers_async(kLis3dhAddress, FIFO_SRC_REG, &fifo_level_, 1,
+                           OnFifoLevelReadComplete, this);
+}
+
+void Lis3dh::OnFifoLevelReadComplete(void* user_data, bool success) {
+  Lis3dh* accelerometer = static_cast<Lis3dh*>(user_data);
+  const uint8_t fifo_src = accelerometer->fifo_level_;
+  // FIFO_SRC_REG has the number of unread samples in FSS (bits 4-0), and
+  // OVRN_FIFO (bit 6) set when the FIFO is full, holding 32 samples.
+  const bool overrun = (fifo_src & 0x40) != 0;
+  const int num_samples = overrun ? kFifoSize : (fifo_src & 0x1f);
+  if (!success || num_samples == 0) {
+    accelerometer->fifo_read_pending_ = false;
+    return;
+  }
+  if (overrun) { ++accelerometer->num_fifo_overruns_; }
+  accelerometer->fifo_batch_size_ = num_samples;
+
+  // Read all samples in one burst. With the FIFO enabled, the auto-incremented
+  // register address wraps from OUT_Z_H back to OUT_X_L, and each wrap pops
+  // the next sample.
+  i2c_read_registers_async(kLis3dhAddress, OUT_X_L | 0x80,
+                           accelerometer->fifo_buffer_, 6 * num_samples,
+                           OnFifoDataReadComplete, accelerometer);
+}
+
+void Lis3dh::OnFifoDataReadComplete(void* user_data, bool success) {
+  Lis3dh* accelerometer = static_cast<Lis3dh*>(user_data);
+  if (success) {
+    LittleEndianReadS16Array(accelerometer->fifo_buffer_,
+                             3 * accelerometer->fifo_batch_size_,
+                             accelerometer->fifo_samples_);
+    accelerometer->fifo_batch_ready_ = true;
+  }
+  accelerometer->fifo_read_pending_ = false;
+}
+
+Slice<const int16_t> Lis3dh::ReadFifoBatch() {
+  if (!fifo_batch_ready_) { return Slice<const int16_t>(); }
+  fifo_batch_ready_ = false;
+  return Slice<const int16_t>(fifo_samples_, 3 * fifo_batch_size_);
 }
 
 const float* Lis3dh::ReadXyzAccelerationFloat() {
@@ -42,10 +42,34 @@
 // elbow  wrist  hand
 //
 // +Y is not shown as it points away from the screen.
+//
+// Register writes and reads go through the two_wire.h transaction queue. Use
+// StartReadXyzAcceleration() to read without stalling the caller.
+//
+// For continuous sampling, the LIS3DH's 32-level FIFO batches samples so that
+// a whole batch comes back in one burst read, rather than an I2C transaction
+// per sample. EnableFifo() sets the FIFO to stream mode with a watermark
+// interrupt on the INT1 pin, latched by a GPIOTE event on the nRF. The main
+// loop calls PollFifo(), which only checks the latched event until the
+// watermark is reached, then reads the FIFO level and all samples in the FIFO
+// asynchronously. Example use:
+//
+//   Accelerometer.Initialize();
+//   Accelerometer.EnableFifo(25, kAccelInt1Pin);
+//   while (true) {
+//     Accelerometer.PollFifo();
+//     Slice<const int16_t> batch = Accelerometer.ReadFifoBatch();
+//     // batch has batch.size() / 3 samples of interleaved X, Y, Z.
+//     ...
+//   }
 
 #ifndef AUDIO_TO_TACTILE_SRC_ACCELEROMETER_LIS3DH_H_
 #define AUDIO_TO_TACTILE_SRC_ACCELEROMETER_LIS3DH_H_
 
+#include <stdint.h>
+
+#include "cpp/slice.h"  // NOLINT(build/include)
+
 namespace audio_tactile {
 
 class Lis3dh {
@@ -70,7 +94,71 @@ class Lis3dh {
   // Currently the gravity is set to (-2 to +2 Gs).
   const float* ReadXyzAccelerationFloat();
 
+  // Starts reading the XYZ acceleration data and returns without waiting. Does
+  // nothing if a read is already in progress. When the read completes,
+  // XyzAccelerationReady() returns true.
+  void StartReadXyzAcceleration();
+
+  // Returns true if a read started by StartReadXyzAcceleration() has
+  // completed and not yet been retrieved.
+  bool XyzAccelerationReady() const { return ready_; }
+
+  // Gets the XYZ acceleration data from the most recent completed read, in the
+  // same format as ReadXyzAccelerationRaw(), and clears XyzAccelerationReady().
+  const int16_t* LatestXyzAccelerationRaw();
+
+  // Number of samples the FIFO holds.
+  enum { kFifoSize = 32 };
+
+  // Enables the FIFO in stream mode, with the INT1 pin asserted when it holds
+  // at least `watermark` samples, between 1 and kFifoSize - 1. `int1_pin` is
+  // the nRF pin connected to LIS3DH INT1. Returns false on invalid arguments.
+  bool EnableFifo(int watermark, int int1_pin);
+
+  // Disables the FIFO and the watermark interrupt.
+  void DisableFifo();
+
+  // Call regularly, e.g. once per main loop iteration. If the watermark was
+  // reached, starts an asynchronous read of all samples in the FIFO. While the
+  // FIFO is filling, this is cheap and makes no I2C transactions. New reads
+  // are not started until the previous batch is retrieved with
+  // ReadFifoBatch(). In the meantime, the FIFO continues to fill and, if full,
+  // drops the oldest samples.
+  void PollFifo();
+
+  // Gets the most recently read batch of samples as 3 int16_t values (X, Y, Z)
+  // per sample, in the same format as ReadXyzAccelerationRaw(), or an empty
+  // slice if there is no new batch. The batch stays valid until the next
+  // PollFifo().
+  Slice<const int16_t> ReadFifoBatch();
+
+  // Number of times the FIFO overran before it was read, dropping samples.
+  int num_fifo_overruns() const { return num_fifo_overruns_; }
+
  private:
+  // I2C completion callback for StartReadXyzAcceleration().
+  static void OnReadComplete(void* user_data, bool success);
+  // I2C completion callbacks for the FIFO level and data reads of PollFifo().
+  static void OnFifoLevelReadComplete(void* user_data, bool success);
+  static void OnFifoDataReadComplete(void* user_data, bool success);
+
+  // DMA destination for the 6 acceleration registers.
+  uint8_t read_buffer_[6];
+  int16_t accel_raw_[3];
+  volatile bool read_pending_;
+  volatile bool ready_;
+
+  // FIFO state. fifo_buffer_ is the DMA destination, and fifo_samples_ holds
+  // the converted batch.
+  uint8_t fifo_level_;
+  uint8_t fifo_buffer_[6 * kFifoSize];
+  int16_t fifo_samples_[3 * kFifoSize];
+  volatile int fifo_batch_size_;
+  volatile bool fifo_read_pending_;
+  volatile bool fifo_batch_ready_;
+  int num_fifo_overruns_;
+  int fifo_int1_pin_;
+
   // Register map.
   enum {
     STATUS_REG_AUX = 0x07,
@@ -122,6 +210,9 @@ class Lis3dh {
     kSdaPin = 24,
     kLis3dhAddress = 0x18,
     kWhoAmIResponse = 0x33,  // 0b00110011
+    // GPIOTE channel for the FIFO watermark interrupt. Channel 0 is used by
+    // Ui (ui.h).
+    kFifoGpioteChannel = 1,
   };
 };
 
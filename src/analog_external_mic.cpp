@@ -14,9 +14,24 @@
 
 #include "analog_external_mic.h"  // NOLINT(build/include)
 
-namespace audio_tactile {
+#include "nrf_ppi.h"  // NOLINT(build/include)
 
-AnalogMic::AnalogMic() {}
+namespace audio_tactile {
+namespace {
+// Restarts the SAADC on END in the oversampled mode.
+constexpr nrf_ppi_channel_t kPpiRestart = NRF_PPI_CHANNEL14;
+// SAADC internal timer period in 16 MHz ticks for the output rate. Setting CC
+// to 1024 gives 15625 Hz sampling rate.
+constexpr uint16_t kSampleTimerCc = 1024;
+}  // namespace
+
+AnalogMic::AnalogMic()
+    : callback_(nullptr),
+      active_buffer_(0),
+      buffer_size_{0, 0},
+      oversampled_(false),
+      num_overruns_(0),
+      block_size_(kAdcDataSize) {}
 
 void AnalogMic::Initialize() {
   // Found discussion here (warning: the code has problems):
@@ -28,7 +43,15 @@ void AnalogMic::Initialize() {
   // Turn on the microphone amplifier.
   nrf_gpio_pin_write(kMicShutDownPin, 1);
 
-  nrf_saadc_resolution_set(NRF_SAADC, NRF_SAADC_RESOLUTION_12BIT);
+  // In the oversampled mode, the SAADC averages 2 conversions per sample at
+  // 14-bit resolution. Results are then 4 times the 12-bit scale, which the
+  // decimator scales back by 2^-2.
+  nrf_saadc_resolution_set(NRF_SAADC, oversampled_
+                                          ? NRF_SAADC_RESOLUTION_14BIT
+                                          : NRF_SAADC_RESOLUTION_12BIT);
+  nrf_saadc_oversample_set(NRF_SAADC, oversampled_
+                                          ? NRF_SAADC_OVERSAMPLE_2X
+                                          : NRF_SAADC_OVERSAMPLE_DISABLED);
 
   // Configure the ADC channel.
   nrf_saadc_channel_config_t channel_config = {
@@ -39,7 +62,10 @@ void AnalogMic::Initialize() {
       .acq_time = NRF_SAADC_ACQTIME_3US,  // The output impedance is about 10k,
                                           // so 3us is ok.
       .mode = NRF_SAADC_MODE_DIFFERENTIAL,
-      .burst = NRF_SAADC_BURST_DISABLED};
+      // Oversampling with the internal timer requires burst mode, converting
+      // all oversamples on one SAMPLE task.
+      .burst = oversampled_ ? NRF_SAADC_BURST_ENABLED
+                            : NRF_SAADC_BURST_DISABLED};
 
   nrf_saadc_channel_init(NRF_SAADC, 0, &channel_config);
 
@@ -47,9 +73,12 @@ void AnalogMic::Initialize() {
   nrf_saadc_channel_pos_input_set(NRF_SAADC, 0, (nrf_saadc_input_t)kMicAdcPin);
 
   // Set SAADC to continuous sampling using the internal timer SAADC timer.
-  // Sample Rate is 16 MHz / CC register.
-  // Setting CC to 1024 gives 15625 Hz sampling rate.
-  nrf_saadc_continuous_mode_enable(NRF_SAADC, 1024);
+  // Sample Rate is 16 MHz / CC register. In the oversampled mode, the rate is
+  // 62500 Hz. A burst of two conversions takes 2 * (3 us acquisition + 2 us
+  // conversion) = 10 us, within the 16 us sample period.
+  nrf_saadc_continuous_mode_enable(
+      NRF_SAADC,
+      oversampled_ ? kSampleTimerCc / kOversampleFactor : kSampleTimerCc);
 
   // Enable SAADC global interrupt.
   NVIC_DisableIRQ(SAADC_IRQn);
@@ -61,8 +90,23 @@ void AnalogMic::Initialize() {
   nrf_saadc_int_enable(NRF_SAADC, NRF_SAADC_INT_END);
   nrf_saadc_int_enable(NRF_SAADC, NRF_SAADC_INT_STOPPED);
 
+  if (oversampled_) {
+    CicDecimatorInit(&decimator_, kOversampleFactor, 2);
+    // END -> START restarts the SAADC on the next buffer in hardware.
+    nrf_ppi_channel_endpoint_setup(
+        kPpiRestart,
+        nrf_saadc_event_address_get(NRF_SAADC, NRF_SAADC_EVENT_END),
+        nrf_saadc_task_address_get(NRF_SAADC, NRF_SAADC_TASK_START));
+    nrf_ppi_channel_enable(kPpiRestart);
+    active_buffer_ = 0;
+    buffer_size_[0] = oversampled_buffer_size();
+  } else {
+    nrf_ppi_channel_disable(kPpiRestart);
+    buffer_size_[0] = block_size_;
+  }
+
   // Set the buffer for EASY DMA transfer.
-  nrf_saadc_buffer_init(NRF_SAADC, adc_buffer_, kAdcDataSize);
+  nrf_saadc_buffer_init(NRF_SAADC, adc_buffer_[0], buffer_size_[0]);
 
   // Enable SAADC.
   nrf_saadc_enable(NRF_SAADC);
@@ -75,6 +119,13 @@ void AnalogMic::Initialize() {
   }
   nrf_saadc_event_clear(NRF_SAADC, NRF_SAADC_EVENT_STARTED);
 
+  if (oversampled_) {
+    // The buffer pointer was latched on START, so the next buffer can be set
+    // now. PPI starts it when the first buffer is full.
+    buffer_size_[1] = oversampled_buffer_size();
+    nrf_saadc_buffer_init(NRF_SAADC, adc_buffer_[1], buffer_size_[1]);
+  }
+
   // Start sampling, from now SAADC is handled by the interrupt routine.
   nrf_saadc_task_trigger(NRF_SAADC, NRF_SAADC_TASK_SAMPLE);
 }
@@ -93,8 +144,32 @@ void AnalogMic::Enable() {
   nrf_saadc_task_trigger(NRF_SAADC, NRF_SAADC_TASK_SAMPLE);
 }
 
-void AnalogMic::GetData(int16_t* destination_array) {
-  memcpy(destination_array, adc_buffer_, kAdcDataSize * sizeof(int16_t));
+void AnalogMic::SetBlockSize(int block_size) {
+  if (block_size < 1) {
+    block_size = 1;
+  } else if (block_size > kAdcDataSize) {
+    block_size = kAdcDataSize;
+  }
+  block_size_ = block_size;
+}
+
+bool AnalogMic::QueueBlock(const int16_t* samples, int num_samples) {
+  Block* block = queue_.BeginPush();
+  if (block == nullptr) {
+    ++num_overruns_;  // The main loop fell behind; drop the block.
+    return false;
+  }
+  memcpy(block->samples, samples, num_samples * sizeof(int16_t));
+  queue_.EndPush();
+  return true;
+}
+
+bool AnalogMic::GetData(int16_t* destination_array) {
+  const Block* block = queue_.Front();
+  if (block == nullptr) { return false; }
+  memcpy(destination_array, block->samples, block_size_ * sizeof(int16_t));
+  queue_.PopFront();
+  return true;
 }
 
 AnalogMic ExternalAnalogMic;
@@ -107,12 +182,35 @@ void SAADC_IRQHandler() { ExternalAnalogMic.IrqHandler(); }
 }
 
 void AnalogMic::IrqHandler() {
-  bool event;
+  bool event = false;
+  int num_queued = 0;
   // Triggered when data points are collected,
   if (nrf_saadc_event_check(NRF_SAADC, NRF_SAADC_EVENT_END)) {
     nrf_saadc_event_clear(NRF_SAADC, NRF_SAADC_EVENT_END);
-    nrf_saadc_buffer_init(NRF_SAADC, adc_buffer_, kAdcDataSize);
-    nrf_saadc_task_trigger(NRF_SAADC, NRF_SAADC_TASK_START);
+    if (oversampled_) {
+      // PPI has already restarted the SAADC on the other buffer, latching its
+      // pointer, so the completed buffer can be set as the next one.
+      const int completed = active_buffer_;
+      active_buffer_ ^= 1;
+      const int num_samples = buffer_size_[completed];
+      buffer_size_[completed] = oversampled_buffer_size();
+      nrf_saadc_buffer_init(NRF_SAADC, adc_buffer_[completed],
+                            buffer_size_[completed]);
+
+      // Decimate and queue kBlocksPerOversampledBuffer blocks.
+      int16_t decimated[kBlocksPerOversampledBuffer * kAdcDataSize];
+      const int num_decimated = CicDecimatorProcessSamples(
+          &decimator_, adc_buffer_[completed], num_samples, decimated);
+      const int block_size = num_decimated / kBlocksPerOversampledBuffer;
+      for (int b = 0; b < kBlocksPerOversampledBuffer; ++b) {
+        num_queued += QueueBlock(decimated + b * block_size, block_size);
+      }
+    } else {
+      // Queue a copy of the completed buffer for GetData() before restarting.
+      QueueBlock(adc_buffer_[0], block_size_);
+      nrf_saadc_buffer_init(NRF_SAADC, adc_buffer_[0], block_size_);
+      nrf_saadc_task_trigger(NRF_SAADC, NRF_SAADC_TASK_START);
+    }
   }
 
   // Triggered when data is trasfered to RAM with Easy DMA.
@@ -126,9 +224,16 @@ void AnalogMic::IrqHandler() {
     nrf_saadc_event_clear(NRF_SAADC, NRF_SAADC_EVENT_STOPPED);
   }
 
-  // Pass the event if new data is collected.
-  if (callback_ && event) {
-    callback_();
+  // Pass the event if new data is collected. In the oversampled mode, call
+  // once per queued block, so that each call can GetData() one block.
+  if (callback_) {
+    if (oversampled_) {
+      for (int b = 0; b < num_queued; ++b) {
+        callback_();
+      }
+    } else if (event) {
+      callback_();
+    }
   }
 }
 
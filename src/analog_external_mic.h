@@ -33,6 +33,21 @@
 // task trigger has to be initiated on EVENT_END, otherwise it leads to a
 // hardfault. The ADC is documented here:
 // https://infocenter.nordicsemi.com/index.jsp?topic=%2Fcom.nordic.infocenter.nrf52832.ps.v1.1%2Fsaadc.html
+//
+// Oversampled mode: with SetOversampled(true) before Initialize(), the SAADC
+// instead runs at kOversampleFactor times the output rate, 62500 Hz, with the
+// SAADC's hardware oversampling averaging a burst of two conversions per
+// sample at 14-bit resolution. The IRQ handler decimates to 15625 Hz with a
+// CIC filter and compensation FIR (dsp/cic_decimator.h). Averaging 8
+// conversions per output sample reduces ADC and amplifier noise outside the
+// audio band, for up to 9 dB higher SNR with white noise. Output samples have
+// the same 12-bit scale as in the direct mode.
+//
+// In this mode, the SAADC fills two larger DMA buffers of
+// kBlocksPerOversampledBuffer blocks each, alternately. The END event restarts
+// the SAADC on the other buffer through PPI, without waiting for the IRQ, so
+// there are no sampling gaps, and the IRQ rate is halved. PPI channel 14 is
+// reserved while running in this mode.
 
 #ifndef AUDIO_TO_TACTILE_SRC_ANALOG_EXTERNAL_MIC_H_
 #define AUDIO_TO_TACTILE_SRC_ANALOG_EXTERNAL_MIC_H_
@@ -44,6 +59,8 @@
 
 #include "board_defs.h"
 #include "cpp/constants.h"
+#include "cpp/spsc_ring_buffer.h"
+#include "dsp/cic_decimator.h"
 #include "nrf_gpio.h"
 #include "nrf_saadc.h"
 
@@ -55,6 +72,11 @@ class AnalogMic {
  public:
   AnalogMic();
 
+  // Selects the oversampled mode described above. Takes effect at the next
+  // Initialize(). The default is false.
+  void SetOversampled(bool oversampled) { oversampled_ = oversampled; }
+  bool oversampled() const { return oversampled_; }
+
   // Configure the ADC.
   // This function starts the listener (interrupt handler) as well.
   void Initialize();
@@ -68,24 +90,72 @@ class AnalogMic {
   // This function is called when buffer is filled with new data.
   void IrqHandler();
 
-  // Returns the latest data in the buffer.
-  void GetData(int16_t* destination_array);
+  // Sets the number of samples per block, between 1 and kAdcDataSize. A
+  // smaller block reduces latency at the cost of more frequent interrupts.
+  // Takes effect from the next block. The default is kAdcDataSize.
+  void SetBlockSize(int block_size);
+  int block_size() const { return block_size_; }
+
+  // Gets the oldest queued block of block_size() samples. Blocks are queued
+  // automatically in IRQ. Returns false if no block is available, in which case
+  // `destination_array` is not modified.
+  bool GetData(int16_t* destination_array);
+
+  // Number of blocks dropped because the queue was full.
+  int num_overruns() const { return num_overruns_; }
 
   // This function is called when new data is ready. Good for real-time
-  // processing.
+  // processing. In the oversampled mode, it is called once per queued block.
   void OnAdcDataReady(void (*function)(void));
 
+  enum {
+    // SAADC rate as a multiple of the output rate in the oversampled mode.
+    kOversampleFactor = 4,
+    // Number of blocks per DMA buffer in the oversampled mode.
+    kBlocksPerOversampledBuffer = 2,
+  };
+
  private:
+  // Number of SAADC samples per DMA buffer in the oversampled mode.
+  int oversampled_buffer_size() const {
+    return kOversampleFactor * kBlocksPerOversampledBuffer * block_size_;
+  }
+  // Queues a copy of `num_samples` samples, counting an overrun if the queue
+  // is full. Returns true if queued.
+  bool QueueBlock(const int16_t* samples, int num_samples);
+
   // Callback for the interrupt.
   void (*callback_)(void);
 
-  // Buffer for the collected analog data.
-  nrf_saadc_value_t adc_buffer_[kAdcDataSize];
-
   // Hardware definitions.
   enum {
     kSaadcIrqPriority = 7,  // Lowest priority interrupt.
+    // Number of completed blocks that can be queued for GetData(). A deeper
+    // queue absorbs more main loop jitter without dropouts, at the cost of
+    // more latency when the main loop falls behind.
+    kAdcQueueDepth = 4,
+  };
+
+  // Buffers for the collected analog data. The direct mode uses only the
+  // first kAdcDataSize samples of adc_buffer_[0].
+  nrf_saadc_value_t adc_buffer_[2][kOversampleFactor *
+                                   kBlocksPerOversampledBuffer * kAdcDataSize];
+  // Index of the buffer being filled in the oversampled mode.
+  int active_buffer_;
+  // Number of samples each buffer was started with.
+  int buffer_size_[2];
+  CicDecimator decimator_;
+  bool oversampled_;
+
+  // Queue of completed blocks, produced by IrqHandler() and consumed by
+  // GetData().
+  struct Block {
+    int16_t samples[kAdcDataSize];
   };
+  SpscRingBuffer<Block, kAdcQueueDepth> queue_;
+  int num_overruns_;
+  // Number of samples per block.
+  int block_size_;
 
 // Pin definitions.
 #if PUCK_BOARD
@@ -0,0 +1,123 @@
+// Copyright 2022 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "background_adc.h"  // NOLINT(build/include)
+
+#include "nrf_ppi.h"    // NOLINT(build/include)
+#include "nrf_timer.h"  // NOLINT(build/include)
+
+namespace audio_tactile {
+namespace {
+NRF_TIMER_Type* const kSampleTimer = NRF_TIMER2;
+constexpr nrf_ppi_channel_t kPpiSample = NRF_PPI_CHANNEL12;
+constexpr nrf_ppi_channel_t kPpiRestart = NRF_PPI_CHANNEL13;
+// The timer runs at 31250 Hz, so that a 32-bit compare value covers long
+// intervals.
+constexpr uint32_t kTimerTicksPerSecond = 31250;
+}  // namespace
+
+BackgroundAdc::BackgroundAdc() : results_{0, 0, 0, 0}, running_(false) {}
+
+bool BackgroundAdc::Start(const nrf_saadc_input_t* inputs, int num_inputs,
+                          uint32_t interval_ms) {
+  if (!(1 <= num_inputs && num_inputs <= kMaxInputs) ||
+      !(1 <= interval_ms && interval_ms <= 100000)) {
+    return false;
+  }
+  Stop();
+
+  for (int i = 0; i < kMaxInputs; ++i) {
+    results_[i] = 0;
+  }
+
+  nrf_saadc_enable(NRF_SAADC);
+  nrf_saadc_resolution_set(NRF_SAADC, NRF_SAADC_RESOLUTION_12BIT);
+  // Use the one-shot functions' settings, so that their conversions apply.
+  const nrf_saadc_channel_config_t channel_config = {
+      .resistor_p = NRF_SAADC_RESISTOR_DISABLED,
+      .resistor_n = NRF_SAADC_RESISTOR_DISABLED,
+      .gain = NRF_SAADC_GAIN1_6,
+      .reference = NRF_SAADC_REFERENCE_INTERNAL,
+      .acq_time = NRF_SAADC_ACQTIME_40US,
+      .mode = NRF_SAADC_MODE_SINGLE_ENDED,
+      .burst = NRF_SAADC_BURST_DISABLED};
+  // With more than one channel enabled, the SAADC scans all channels with a
+  // connected input on each SAMPLE task.
+  for (int i = 0; i < NRF_SAADC_CHANNEL_COUNT; ++i) {
+    if (i < num_inputs) {
+      nrf_saadc_channel_init(NRF_SAADC, i, &channel_config);
+      nrf_saadc_channel_input_set(NRF_SAADC, i, inputs[i],
+                                  NRF_SAADC_INPUT_DISABLED);
+    } else {
+      nrf_saadc_channel_input_set(NRF_SAADC, i, NRF_SAADC_INPUT_DISABLED,
+                                  NRF_SAADC_INPUT_DISABLED);
+    }
+  }
+  nrf_saadc_int_disable(NRF_SAADC, NRF_SAADC_INT_ALL);
+  nrf_saadc_buffer_init(NRF_SAADC, const_cast<nrf_saadc_value_t*>(results_),
+                        num_inputs);
+
+  // TIMER2 generates COMPARE0 every interval, clearing itself.
+  nrf_timer_mode_set(kSampleTimer, NRF_TIMER_MODE_TIMER);
+  nrf_timer_bit_width_set(kSampleTimer, NRF_TIMER_BIT_WIDTH_32);
+  nrf_timer_frequency_set(kSampleTimer, NRF_TIMER_FREQ_31250Hz);
+  nrf_timer_cc_write(kSampleTimer, NRF_TIMER_CC_CHANNEL0,
+                     (interval_ms * kTimerTicksPerSecond) / 1000);
+  nrf_timer_shorts_enable(kSampleTimer,
+                          NRF_TIMER_SHORT_COMPARE0_CLEAR_MASK);
+  nrf_timer_int_disable(kSampleTimer, NRF_TIMER_INT_COMPARE0_MASK);
+
+  // COMPARE0 -> SAMPLE scans the inputs. END -> START rearms the buffer for
+  // the next scan.
+  nrf_ppi_channel_endpoint_setup(
+      kPpiSample,
+      nrf_timer_event_address_get(kSampleTimer, NRF_TIMER_EVENT_COMPARE0),
+      nrf_saadc_task_address_get(NRF_SAADC, NRF_SAADC_TASK_SAMPLE));
+  nrf_ppi_channel_endpoint_setup(
+      kPpiRestart, nrf_saadc_event_address_get(NRF_SAADC, NRF_SAADC_EVENT_END),
+      nrf_saadc_task_address_get(NRF_SAADC, NRF_SAADC_TASK_START));
+  nrf_ppi_channel_enable(kPpiSample);
+  nrf_ppi_channel_enable(kPpiRestart);
+
+  nrf_saadc_task_trigger(NRF_SAADC, NRF_SAADC_TASK_START);
+  nrf_timer_task_trigger(kSampleTimer, NRF_TIMER_TASK_CLEAR);
+  nrf_timer_task_trigger(kSampleTimer, NRF_TIMER_TASK_START);
+  running_ = true;
+  return true;
+}
+
+void BackgroundAdc::Stop() {
+  if (!running_) { return; }
+  nrf_ppi_channel_disable(kPpiSample);
+  nrf_ppi_channel_disable(kPpiRestart);
+  nrf_timer_task_trigger(kSampleTimer, NRF_TIMER_TASK_STOP);
+
+  nrf_saadc_event_clear(NRF_SAADC, NRF_SAADC_EVENT_STOPPED);
+  nrf_saadc_task_trigger(NRF_SAADC, NRF_SAADC_TASK_STOP);
+  while (!nrf_saadc_event_check(NRF_SAADC, NRF_SAADC_EVENT_STOPPED)) {
+  }
+  nrf_saadc_event_clear(NRF_SAADC, NRF_SAADC_EVENT_STOPPED);
+  // Disconnect the inputs, since other SAADC users like AnalogMic configure
+  // only the channels they use.
+  for (int i = 0; i < NRF_SAADC_CHANNEL_COUNT; ++i) {
+    nrf_saadc_channel_input_set(NRF_SAADC, i, NRF_SAADC_INPUT_DISABLED,
+                                NRF_SAADC_INPUT_DISABLED);
+  }
+  nrf_saadc_disable(NRF_SAADC);
+  running_ = false;
+}
+
+BackgroundAdc MonitorAdc;
+
+}  // namespace audio_tactile
@@ -0,0 +1,91 @@
+// Copyright 2022 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+// Background sampling of slowly varying analog inputs, like the battery
+// voltage (battery_monitor.h) and thermistor (temperature_monitor.h).
+//
+// BatteryMonitor::MeasureBatteryVoltage() and TemperatureMonitor::
+// TakeAdcSample() run the SAADC in one-shot mode and busy wait for the result.
+// Instead, BackgroundAdc samples in hardware without CPU involvement: TIMER2
+// triggers the SAADC SAMPLE task through PPI every `interval_ms`, the SAADC
+// scans all configured inputs into a RAM buffer by EasyDMA, and the END event
+// restarts the SAADC on the same buffer through a second PPI channel. No
+// interrupts are used, and latest() just reads RAM, so in steady state the
+// main loop does not touch the peripherals. Threshold events, like low
+// battery, are detected separately with LPCOMP (lpcomp_common.h).
+//
+// Each input is sampled with the same settings as the one-shot functions: gain
+// 1/6, internal 0.6 V reference, 12-bit resolution, and 40 us acquisition time
+// (enough for the high-impedance battery voltage divider). So readings can be
+// converted with BatteryMonitor::ConvertBatteryVoltageToFloat() and
+// TemperatureMonitor::ConvertAdcSampleToTemperature().
+//
+// The SAADC can't be shared, so BackgroundAdc can't run while AnalogMic
+// (analog_external_mic.h) is enabled, nor at the same time as the one-shot
+// functions. TIMER2 and PPI channels 12 and 13 are reserved while running.
+//
+// Example use:
+//   const nrf_saadc_input_t kInputs[2] = {
+//       PuckBatteryMonitor.adc_input(), SleeveTemperatureMonitor.adc_input()};
+//   MonitorAdc.Start(kInputs, 2, 1000);  // Sample every second.
+//   ...
+//   float battery_v =
+//       PuckBatteryMonitor.ConvertBatteryVoltageToFloat(MonitorAdc.latest(0));
+
+#ifndef AUDIO_TO_TACTILE_SRC_BACKGROUND_ADC_H_
+#define AUDIO_TO_TACTILE_SRC_BACKGROUND_ADC_H_
+
+#include <stdint.h>
+
+#include "nrf_saadc.h"  // NOLINT(build/include)
+
+namespace audio_tactile {
+
+class BackgroundAdc {
+ public:
+  enum { kMaxInputs = 4 };
+
+  BackgroundAdc();
+
+  // Starts sampling `num_inputs` analog inputs, between 1 and kMaxInputs, every
+  // `interval_ms` milliseconds, between 1 and 100000. Returns false on invalid
+  // arguments.
+  bool Start(const nrf_saadc_input_t* inputs, int num_inputs,
+             uint32_t interval_ms);
+
+  // Stops sampling and disables the SAADC.
+  void Stop();
+
+  bool is_running() const { return running_; }
+
+  // Gets the most recent raw reading of input `index`, in the order passed to
+  // Start(). Negative readings are clamped to zero. Before the first sample
+  // completes, this is zero.
+  int16_t latest(int index) const {
+    const int16_t value = results_[index];
+    return (value < 0) ? 0 : value;
+  }
+
+ private:
+  // EasyDMA destination, one value per input.
+  volatile nrf_saadc_value_t results_[kMaxInputs];
+  bool running_;
+};
+
+extern BackgroundAdc MonitorAdc;
+
+}  // namespace audio_tactile
+
+#endif  // AUDIO_TO_TACTILE_SRC_BACKGROUND_ADC_H_
@@ -39,6 +39,10 @@ void BatteryMonitor::InitializeLowVoltageInterrupt() {
   // Set reference input source to an analog input pin.
   NRF_LPCOMP->PSEL |= (kLowPowerCompPin << LPCOMP_PSEL_PSEL_Pos);
 
+  // Enable hysteresis, so that noise near the threshold doesn't generate a
+  // burst of crossings.
+  NRF_LPCOMP->HYST = LPCOMP_HYST_HYST_Hyst50mV << LPCOMP_HYST_HYST_Pos;
+
   // Enable and start the low power comparator.
   NRF_LPCOMP->ENABLE = LPCOMP_ENABLE_ENABLE_Enabled;
   NRF_LPCOMP->TASKS_START = 1;
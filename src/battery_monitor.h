@@ -23,6 +23,11 @@
 // To measure the analog battery voltage, SAADC was used.
 // Note: the low power comparator can run only for one of the battery monitor or
 // temperature monitor at a time
+//
+// The comparator has 50 mV hysteresis, so that the callback runs once per
+// threshold crossing rather than chattering while the voltage is near the
+// threshold. For periodic voltage readings without busy waiting, use
+// BackgroundAdc (background_adc.h) with adc_input().
 
 #ifndef AUDIO_TO_TACTILE_SRC_BATTERY_MONITOR_H_
 #define AUDIO_TO_TACTILE_SRC_BATTERY_MONITOR_H_
@@ -32,6 +37,7 @@
 #include "board_defs.h"     // NOLINT(build/include)
 #include "lpcomp_common.h"  // NOLINT(build/include)
 #include "nrf_gpio.h"       // NOLINT(build/include)
+#include "nrf_saadc.h"      // NOLINT(build/include)
 
 namespace audio_tactile {
 
@@ -60,6 +66,11 @@ class BatteryMonitor {
   // could be done by measuring discharge curve.
   float ConvertBatteryVoltageToFloat(int16_t raw_adc_battery_reading);
 
+  // SAADC input connected to the battery voltage divider.
+  nrf_saadc_input_t adc_input() const {
+    return static_cast<nrf_saadc_input_t>(kLowPowerCompAdcPin);
+  }
+
  private:
   // Low power comparator definitions.
   enum {
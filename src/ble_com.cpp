@@ -21,11 +21,16 @@ namespace audio_tactile {
 AudioTactileBleCom BleCom;
 
 void OnBleConnect(uint16_t connection_handle) {
+  BleCom.connection_handle_ = connection_handle;
+  BleCom.tx_packer_.Clear();
+  BleCom.RequestHighThroughput();
   BleCom.event_ = BleEvent::kConnect;
   BleCom.event_fun_();
 }
 
 void OnBleDisconnect(uint16_t connection_handle, uint8_t reason) {
+  BleCom.connection_handle_ = BLE_CONN_HANDLE_INVALID;
+  BleCom.tx_packer_.Clear();
   BleCom.event_ = BleEvent::kDisconnect;
   BleCom.event_fun_();
 }
@@ -106,44 +111,87 @@ void AudioTactileBleCom::Init(const char* device_name, void (*event_fun)()) {
   Serial.println("\"");
 }
 
+void AudioTactileBleCom::RequestHighThroughput() {
+  BLEConnection* connection = Bluefruit.Connection(connection_handle_);
+  if (connection == nullptr) { return; }
+  // These are requests. The central may decline them, in which case the
+  // connection continues with the 1M PHY and a smaller MTU.
+  connection->requestPHY(BLE_GAP_PHY_2MBPS);
+  connection->requestDataLengthUpdate();
+  connection->requestMtuExchange(MessagePacker::kMaxAttMtu);
+}
+
 void AudioTactileBleCom::ReadFromBleUart() {
-  constexpr int kHeaderSize = Message::kHeaderSize;
-  constexpr int kMaxPayloadSize = Message::kMaxPayloadSize;
-  const int num_received_bytes = ble_uart_.available();
-  uint8_t* dest = rx_message_.data();
-  int payload_size;
-
-  // Read from ble_uart_, writing directly into rx_message_. We first read the
-  // 4-byte message header to get the payload size, then read the payload.
+  uint8_t packet[MessagePacker::kMaxPacketSize];
+  const int num_received_bytes = std_shim::min<int>(
+      ble_uart_.available(), MessagePacker::kMaxPacketSize);
+
+  // Read from ble_uart_ the packet, which holds one or more whole messages.
   //
   // When BLE receives a packet, BLEUart appears to buffer the whole packet and
   // then call the `OnBleUartRx()` callback above. Then, this function can
-  // instantly read the whole packet without waiting. This has been reliable in
-  // all tests with it so far, in which BLE transferred at most 20 bytes at a
-  // time. I'd expect that with a sufficiently large transmission, NUS will
-  // break it into multiple packets sent over multiple BLE time intervals. Then
-  // this receiving code would need some streaming or waiting logic to get the
-  // whole transmission. But this is complicated and not needed so far.
-  if (num_received_bytes >= kHeaderSize &&  // Read the message header.
-      ble_uart_.read(dest, kHeaderSize) == kHeaderSize &&
-      dest[2] >= 1 &&  // Check type field.
-      (payload_size = dest[3]) <= kMaxPayloadSize &&  // Check size field.
-      num_received_bytes >= kHeaderSize + payload_size &&  // Read the payload.
-      ble_uart_.read(dest + kHeaderSize, payload_size) == payload_size &&
-      // Verify the checksum.
-      rx_message_.VerifyChecksum()) {
+  // instantly read the whole packet without waiting. With data length extension
+  // a packet up to the ATT MTU arrives in one link layer packet. If the central
+  // writes more than the MTU at once, the write is split over several packets,
+  // and a message spanning packets is rejected as invalid.
+  const bool read_ok =
+      num_received_bytes > 0 &&
+      ble_uart_.read(packet, num_received_bytes) == num_received_bytes;
+  ble_uart_.flush();  // Flush in case a partial or failed message remains.
+
+  MessageUnpacker unpacker(packet, read_ok ? num_received_bytes : 0);
+  while (unpacker.Next(&rx_message_)) {
     event_ = BleEvent::kMessageReceived;
-  } else {
-    event_ = BleEvent::kInvalidMessage;
+    event_fun_();
   }
 
-  ble_uart_.flush();  // Flush in case a partial or failed message remains.
-  event_fun_();
+  if (!read_ok || unpacker.error()) {
+    event_ = BleEvent::kInvalidMessage;
+    event_fun_();
+  }
 }
 
 void AudioTactileBleCom::SendTxMessage() {
-  tx_message_.SetBleHeader();
-  ble_uart_.write(tx_message_.data(), tx_message_.size());
+  QueueTxMessage();
+  FlushTx();
+}
+
+void AudioTactileBleCom::QueueTxMessage() { QueueMessage(&tx_message_); }
+
+void AudioTactileBleCom::QueueMessage(Message* message) {
+  BLEConnection* connection = Bluefruit.Connection(connection_handle_);
+  if (connection != nullptr) {
+    // Update capacity in case the MTU exchange completed since the last call.
+    tx_packer_.SetAttMtu(connection->getMtu());
+  }
+
+  message->SetBleHeader();
+  if (!tx_packer_.Append(*message)) {  // Pending packet is full.
+    FlushTx();
+    tx_packer_.Append(*message);
+  }
+}
+
+void AudioTactileBleCom::FlushTx() {
+  if (tx_packer_.empty()) { return; }
+  const Slice<const uint8_t> packet = tx_packer_.packet();
+  ble_uart_.write(packet.data(), packet.size());
+  tx_packer_.Clear();
+}
+
+void AudioTactileBleCom::ServiceTxQueue() {
+  if (connection_handle_ == BLE_CONN_HANDLE_INVALID) {
+    tx_queue_.DropAll();
+    return;
+  }
+
+  Message* message;
+  while ((message = tx_queue_.Front()) != nullptr) {
+    // The packer copies the message, so the slot may be released right away.
+    QueueMessage(message);
+    tx_queue_.Complete(MessageSendStatus::kSent);
+  }
+  FlushTx();
 }
 
 }  // namespace audio_tactile
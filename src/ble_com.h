@@ -28,6 +28,29 @@
 //         break;
 //     }
 //   }
+//
+// Several messages may be packed into one BLE notification, up to the
+// negotiated ATT MTU, with QueueTxMessage() followed by FlushTx(). Received
+// packets are unpacked the same way, calling the event function once for each
+// message. See cpp/message_packer.h for the packet format.
+//
+//   BleCom.tx_message().WriteBatteryVoltage(battery_v);
+//   BleCom.QueueTxMessage();
+//   BleCom.tx_message().WriteTemperature(temperature_c);
+//   BleCom.QueueTxMessage();
+//   BleCom.FlushTx();  // Sends both messages in one packet.
+//
+// Alternatively, producers that shouldn't wait on BLE, like the audio loop, may
+// write messages to tx_queue() and return immediately. The main loop then calls
+// ServiceTxQueue() to pack and send them. See cpp/message_send_queue.h.
+//
+//   Message* message = BleCom.tx_queue().BeginSend();
+//   if (message) {
+//     message->WriteBatteryVoltage(battery_v);
+//     BleCom.tx_queue().EndSend(OnBatterySent, &battery_state);
+//   }
+//   ...
+//   BleCom.ServiceTxQueue();  // In the main loop.
 
 #ifndef AUDIO_TO_TACTILE_SRC_BLE_COM_H_
 #define AUDIO_TO_TACTILE_SRC_BLE_COM_H_
@@ -35,6 +58,8 @@
 #include <bluefruit.h>
 
 #include "cpp/message.h"  // NOLINT(build/include)
+#include "cpp/message_packer.h"  // NOLINT(build/include)
+#include "cpp/message_send_queue.h"  // NOLINT(build/include)
 
 namespace audio_tactile {
 
@@ -48,7 +73,12 @@ enum class BleEvent {
 
 class AudioTactileBleCom {
  public:
-  AudioTactileBleCom(): event_fun_(nullptr), event_(BleEvent::kNone) {}
+  enum { kTxQueueCapacity = 8 };
+
+  AudioTactileBleCom()
+      : event_fun_(nullptr),
+        event_(BleEvent::kNone),
+        connection_handle_(BLE_CONN_HANDLE_INVALID) {}
 
   // Initializes and begins BLE advertising.
   void Init(const char* device_name, void (*event_fun)());
@@ -58,9 +88,22 @@ class AudioTactileBleCom {
 
   // Gets Message that will be transmitted.
   Message& tx_message() { return tx_message_; }
-  // Sends tx_message over BLE UART.
+  // Sends tx_message over BLE UART, along with any queued messages.
   void SendTxMessage();
 
+  // Queues tx_message to send packed with other messages in one notification.
+  // If the pending packet is full, it is sent first.
+  void QueueTxMessage();
+  // Sends the pending packet of queued messages, if any.
+  void FlushTx();
+
+  // Gets the queue of messages to send asynchronously.
+  MessageSendQueue<kTxQueueCapacity>& tx_queue() { return tx_queue_; }
+  // Packs and sends all messages in tx_queue, calling their completion
+  // functions. If not connected, the messages are dropped. Must be called from
+  // a single context, e.g. the main loop.
+  void ServiceTxQueue();
+
   // Gets Message that was most recently received.
   Message& rx_message() { return rx_message_; }
 
@@ -69,14 +112,24 @@ class AudioTactileBleCom {
   friend void OnBleUartRx(uint16_t connection_handle);
 
  private:
+  // Queues `message` in tx_packer_, like QueueTxMessage().
+  void QueueMessage(Message* message);
+
   // Reads a message from ble_uart_ into rx_message_ and updates event_.
   void ReadFromBleUart();
 
+  // Requests 2M PHY, data length extension, and the max ATT MTU, so that a
+  // packed notification is sent in a single link layer packet.
+  void RequestHighThroughput();
+
   BLEUart ble_uart_;
   Message rx_message_;
   Message tx_message_;
+  MessagePacker tx_packer_;
+  MessageSendQueue<kTxQueueCapacity> tx_queue_;
   void (*event_fun_)();
   BleEvent event_;
+  uint16_t connection_handle_;
   BLEDfu bledfu_;
 };
 
@@ -0,0 +1,204 @@
+// Copyright 2022 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+// AtomicObjectPool, a lock-free pool of reusable objects.
+//
+// AtomicObjectPool<T, kCapacity> has the same interface as ObjectPool (see
+// object_pool.h), but Allocate() and Free() may be called concurrently from
+// interrupt handlers and the main loop without disabling interrupts. A typical
+// use is to hand objects from an interrupt handler to the main loop without
+// copying, together with an SpscRingBuffer of pointers:
+//
+//   AtomicObjectPool<Message, 8> pool;
+//   SpscRingBuffer<Message*, 8> queue;
+//
+//   // In the interrupt handler:
+//   Message* message = pool.Allocate();
+//   if (message) {
+//     Receive(message);
+//     queue.Push(message);
+//   }
+//
+//   // In the main loop:
+//   Message* message;
+//   if (queue.Pop(&message)) {
+//     Process(*message);
+//     pool.Free(message);
+//   }
+//
+// The free list is a lock-free stack (Treiber stack) of node indices. The head
+// is a 32-bit word holding the index of the first free node and a 16-bit tag
+// that is incremented on every change. Allocate() and Free() update the head
+// with a compare-and-swap, which fails and retries if another context changed
+// the head in between. The tag prevents the ABA problem, where the head
+// index is the same but the list has changed, e.g. if an interrupt allocates
+// and frees nodes between a load and the compare-and-swap.
+//
+// Synchronization uses the GCC/Clang `__atomic` builtins, like SpscRingBuffer.
+// On Cortex-M3 and later, compare-and-swap compiles to an LDREX/STREX loop.
+// Cortex-M0 lacks these instructions, so this class isn't suitable there.
+
+#ifndef AUDIO_TO_TACTILE_SRC_CPP_ATOMIC_OBJECT_POOL_H_
+#define AUDIO_TO_TACTILE_SRC_CPP_ATOMIC_OBJECT_POOL_H_
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace audio_tactile {
+
+template <typename T, int kCapacity_>
+class AtomicObjectPool {
+ public:
+  enum { kCapacity = kCapacity_ };
+  struct TestAccess;
+
+  static_assert(0 < kCapacity && kCapacity < 0xffff,
+                "kCapacity must be between 1 and 65534");
+
+  AtomicObjectPool() noexcept: head_(Pack(0, 0)), num_free_(kCapacity) {
+    for (int i = 0; i < kCapacity - 1; ++i) {
+      next_free_[i] = i + 1;
+    }
+    next_free_[kCapacity - 1] = kNil;
+  }
+  AtomicObjectPool(const AtomicObjectPool&) = delete;  // No copying.
+  AtomicObjectPool& operator=(const AtomicObjectPool&) = delete;
+
+  ~AtomicObjectPool() {
+    // Find and free any remaining live objects. We only need to do this if T
+    // has a nontrivial destructor.
+    if (!std::is_trivially_destructible<T>::value && num_live() > 0) {
+      char is_live[kCapacity];
+      MarkLiveObjects(is_live);
+      for (int i = 0; i < kCapacity; ++i) {
+        if (is_live[i]) {
+          Free(GetObject(i));
+        }
+      }
+    }
+  }
+
+  // Number of live objects. When other contexts are concurrently allocating or
+  // freeing, this is a snapshot that may momentarily lag the free list.
+  int num_live() const noexcept { return kCapacity - num_free(); }
+  // Number of free objects, available for allocation.
+  int num_free() const noexcept {
+    return __atomic_load_n(&num_free_, __ATOMIC_RELAXED);
+  }
+
+  // Allocates an object from the pool and invokes T's constructor, or returns
+  // nullptr if the pool is exhausted. Constructor arguments may be passed as:
+  //
+  //   pool.Allocate(x, y, z);  // Invokes constructor `T(x, y, z)`.
+  template <typename... Args>
+  T* Allocate(Args&&... args) {
+    uint32_t head = __atomic_load_n(&head_, __ATOMIC_ACQUIRE);
+    int index;
+    for (;;) {  // Pop head off the free list.
+      index = Index(head);
+      if (index == kNil) { return nullptr; }
+      // If another context pops this node first, the value read here may be
+      // stale, but then the tag has changed and the compare-and-swap fails.
+      const uint16_t next = __atomic_load_n(&next_free_[index],
+                                            __ATOMIC_RELAXED);
+      if (__atomic_compare_exchange_n(&head_, &head, Pack(Tag(head) + 1, next),
+                                      /*weak=*/true, __ATOMIC_ACQUIRE,
+                                      __ATOMIC_ACQUIRE)) {
+        break;
+      }
+    }
+    __atomic_fetch_sub(&num_free_, 1, __ATOMIC_RELAXED);
+    void* memory = nodes_[index].storage;
+    return new(memory) T(std::forward<Args>(args)...);  // Construct the object.
+  }
+
+  // Frees an object from the pool.
+  //
+  // WARNING: `object` must be a pointer for a live object in this pool
+  // previously obtained from Allocate(), otherwise behavior is undefined.
+  void Free(T* object) {
+    if (object == nullptr) { return; }
+    const int index = static_cast<int>(reinterpret_cast<Node*>(object) -
+                                       nodes_);
+    object->~T();  // Destruct the object.
+    uint32_t head = __atomic_load_n(&head_, __ATOMIC_RELAXED);
+    do {  // Push onto head of the free list.
+      __atomic_store_n(&next_free_[index], Index(head), __ATOMIC_RELAXED);
+      // Release ordering publishes the destruction and next_free_ write.
+    } while (!__atomic_compare_exchange_n(
+        &head_, &head, Pack(Tag(head) + 1, index), /*weak=*/true,
+        __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+    __atomic_fetch_add(&num_free_, 1, __ATOMIC_RELAXED);
+  }
+
+ private:
+  enum { kNil = 0xffff };
+
+  static uint32_t Pack(uint32_t tag, int index) noexcept {
+    return (tag << 16) | static_cast<uint32_t>(index);
+  }
+  static int Index(uint32_t head) noexcept {
+    return static_cast<int>(head & 0xffff);
+  }
+  static uint32_t Tag(uint32_t head) noexcept { return head >> 16; }
+
+  // Returns T pointer to the ith node, assuming it holds a live object.
+  T* GetObject(int i) noexcept {
+    return reinterpret_cast<T*>(nodes_[i].storage);
+  }
+
+  // Fills array `is_live` such that `is_live[i]` is 1 if the ith object is
+  // live or 0 if it is free. Must not be called concurrently with Allocate()
+  // or Free().
+  void MarkLiveObjects(char is_live[kCapacity]) const noexcept {
+    std::fill_n(is_live, kCapacity, 1);  // Initialize all objects as live.
+    for (int i = Index(head_); i != kNil; i = next_free_[i]) {
+      is_live[i] = 0;  // Mark object as free.
+    }
+  }
+
+  // Unlike ObjectPool, the free list links are stored outside the nodes, so
+  // that a context reading a stale head never reads memory of a live object.
+  struct Node {
+    alignas(T) char storage[sizeof(T)];
+  };
+
+  Node nodes_[kCapacity];
+  // Index of the next free node after each free node, or kNil.
+  uint16_t next_free_[kCapacity];
+  // Head of the free list, with the tag in the upper 16 bits.
+  uint32_t head_;
+  int num_free_;
+};
+
+// Test-only access to AtomicObjectPool.
+template <typename T, int kCapacity>
+struct AtomicObjectPool<T, kCapacity>::TestAccess {
+  static T* GetObject(AtomicObjectPool<T, kCapacity>& pool, int i) {
+    return pool.GetObject(i);
+  }
+  static void MarkLiveObjects(const AtomicObjectPool<T, kCapacity>& pool,
+                              char is_live[kCapacity]) {
+    return pool.MarkLiveObjects(is_live);
+  }
+};
+
+}  // namespace audio_tactile
+
+#endif  // AUDIO_TO_TACTILE_SRC_CPP_ATOMIC_OBJECT_POOL_H_
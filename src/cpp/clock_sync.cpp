@@ -0,0 +1,117 @@
+// Copyright 2022 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "cpp/clock_sync.h"  // NOLINT(build/include)
+
+#include <math.h>
+
+namespace audio_tactile {
+
+// Amount by which the shortest round trip leaks upward per exchange.
+constexpr uint32_t kRoundTripLeakUs = 250;
+
+void ClockSync::Reset() {
+  num_samples_ = 0;
+  next_sample_ = 0;
+  min_round_trip_us_ = kMaxRoundTripUs;
+  last_round_trip_us_ = 0;
+  anchor_us_ = 0;
+  anchor_offset_us_ = 0;
+  drift_ = 0.0;
+}
+
+bool ClockSync::OnResponse(uint32_t t1, uint32_t t2, uint32_t t3,
+                           uint32_t t4) {
+  const int32_t local_elapsed = static_cast<int32_t>(t4 - t1);
+  const int32_t reference_elapsed = static_cast<int32_t>(t3 - t2);
+  if (local_elapsed < 0 || reference_elapsed < 0) { return false; }
+  int32_t round_trip = local_elapsed - reference_elapsed;
+  if (round_trip < 0) { round_trip = 0; }  // Possible by drift or rounding.
+  if (round_trip > kMaxRoundTripUs) { return false; }
+
+  min_round_trip_us_ += kRoundTripLeakUs;
+  if (static_cast<uint32_t>(round_trip) < min_round_trip_us_) {
+    min_round_trip_us_ = round_trip;
+  } else if (static_cast<uint32_t>(round_trip) >
+             min_round_trip_us_ + kRoundTripSlackUs) {
+    return false;  // Delayed by a missed connection event or retransmission.
+  }
+  last_round_trip_us_ = round_trip;
+
+  // offset = ((t2 - t1) + (t3 - t4)) / 2 = (t2 - t1) - round_trip / 2.
+  sample_offset_us_[next_sample_] = (t2 - t1) - round_trip / 2;
+  sample_local_us_[next_sample_] = t1 + local_elapsed / 2;
+  next_sample_ = (next_sample_ + 1) % kNumSamples;
+  if (num_samples_ < kNumSamples) { ++num_samples_; }
+  Fit();
+  return true;
+}
+
+void ClockSync::Fit() {
+  // Fit relative to the latest sample, so that differences are small.
+  const int latest = (next_sample_ + kNumSamples - 1) % kNumSamples;
+  const uint32_t latest_local_us = sample_local_us_[latest];
+  const uint32_t latest_offset_us = sample_offset_us_[latest];
+
+  double sum_x = 0.0;
+  double sum_y = 0.0;
+  for (int i = 0; i < num_samples_; ++i) {
+    sum_x += static_cast<int32_t>(sample_local_us_[i] - latest_local_us);
+    sum_y += static_cast<int32_t>(sample_offset_us_[i] - latest_offset_us);
+  }
+  const double mean_x = sum_x / num_samples_;
+  const double mean_y = sum_y / num_samples_;
+  double sum_xx = 0.0;
+  double sum_xy = 0.0;
+  for (int i = 0; i < num_samples_; ++i) {
+    const double x =
+        static_cast<int32_t>(sample_local_us_[i] - latest_local_us) - mean_x;
+    const double y =
+        static_cast<int32_t>(sample_offset_us_[i] - latest_offset_us) - mean_y;
+    sum_xx += x * x;
+    sum_xy += x * y;
+  }
+
+  double drift = (num_samples_ >= 2 && sum_xx > 0.0) ? sum_xy / sum_xx : 0.0;
+  const double kMaxDrift = kMaxDriftPpm * 1e-6;
+  if (drift > kMaxDrift) {
+    drift = kMaxDrift;
+  } else if (drift < -kMaxDrift) {
+    drift = -kMaxDrift;
+  }
+  drift_ = drift;
+  // Anchor the model at the latest sample, with the fitted offset there.
+  anchor_us_ = latest_local_us;
+  anchor_offset_us_ = latest_offset_us +
+      static_cast<int32_t>(lround(mean_y - drift * mean_x));
+}
+
+uint32_t ClockSync::OffsetAt(uint32_t local_us) const {
+  const int32_t elapsed = static_cast<int32_t>(local_us - anchor_us_);
+  return anchor_offset_us_ +
+      static_cast<uint32_t>(static_cast<int32_t>(lround(drift_ * elapsed)));
+}
+
+uint32_t ClockSync::LocalToReference(uint32_t local_us) const {
+  return local_us + OffsetAt(local_us);
+}
+
+uint32_t ClockSync::ReferenceToLocal(uint32_t reference_us) const {
+  // Invert local + offset(local) = reference. One step of fixed point
+  // iteration is enough, since the offset changes by ppm of the error.
+  const uint32_t local_us = reference_us - anchor_offset_us_;
+  return reference_us - OffsetAt(local_us);
+}
+
+}  // namespace audio_tactile
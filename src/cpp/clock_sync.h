@@ -0,0 +1,138 @@
+// Copyright 2022 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+// ClockSync, estimates the offset and drift of the local clock relative to a
+// reference clock, for synchronized playback on multiple devices.
+//
+// When two devices, e.g. a bracelet on each wrist, play tactile signals
+// streamed over BLE, each device's latency depends on its own connection
+// events and buffering, so they play out of step. Instead, the streaming app
+// is the reference clock, stamps each block with a presentation time on that
+// clock (kTimedTactorsSamples in cpp/message.h), and each device plays the
+// block when its local clock, converted to the reference clock, reaches that
+// time (see cpp/timed_playout.h).
+//
+// The clocks are synchronized by a timestamp exchange as in NTP:
+//
+//  1. The device sends kClockSyncRequest with its local time t1.
+//  2. The app replies kClockSyncResponse with t1 and its reference times t2 of
+//     receiving the request and t3 of sending the reply.
+//  3. The device receives the reply at local time t4 and calls OnResponse().
+//
+// Assuming symmetric transit times, the offset reference - local is
+// ((t2 - t1) + (t3 - t4)) / 2, with error at most half the round trip time
+// (t4 - t1) - (t3 - t2). BLE round trips vary by connection intervals, so
+// exchanges with a round trip much longer than the shortest recently seen are
+// discarded. The drift, the rate difference of the two crystals, typically up
+// to 40 ppm, is the least-squares slope of the last kNumSamples offsets. It
+// extrapolates the offset between exchanges, so that exchanges every few
+// seconds suffice.
+//
+// Times are in microseconds as uint32_t, which wrap around every 71.6 minutes;
+// differences are computed modulo 2^32, so wraparound is fine as long as
+// samples span less than about 35 minutes.
+//
+// Example use:
+//   ClockSync clock_sync;
+//
+//   // Every few seconds.
+//   BleCom.tx_message().WriteClockSyncRequest(micros());
+//   BleCom.SendTxMessage();
+//
+//   // On kClockSyncResponse.
+//   uint32_t t1, t2, t3;
+//   if (message.ReadClockSyncResponse(&t1, &t2, &t3)) {
+//     clock_sync.OnResponse(t1, t2, t3, micros());
+//   }
+//
+//   // Converting a presentation time to the local clock.
+//   if (clock_sync.synced()) {
+//     const uint32_t local_us = clock_sync.ReferenceToLocal(presentation_us);
+//   }
+
+#ifndef AUDIO_TO_TACTILE_SRC_CPP_CLOCK_SYNC_H_
+#define AUDIO_TO_TACTILE_SRC_CPP_CLOCK_SYNC_H_
+
+#include <stdint.h>
+
+namespace audio_tactile {
+
+class ClockSync {
+ public:
+  enum {
+    // Number of recent offset samples fitted for the drift.
+    kNumSamples = 32,
+    // Number of samples before the estimate is considered synchronized.
+    kMinSamples = 3,
+    // Exchanges with a round trip longer than this are always discarded.
+    kMaxRoundTripUs = 200000,
+    // Exchanges with a round trip longer than the shortest recent round trip
+    // plus this slack are discarded.
+    kRoundTripSlackUs = 4000,
+    // Max plausible drift in ppm. Larger fitted drifts are clamped.
+    kMaxDriftPpm = 200,
+  };
+
+  ClockSync() { Reset(); }
+
+  // Resets to the unsynchronized state, e.g. when BLE disconnects.
+  void Reset();
+
+  // Processes a timestamp exchange, where `t1` and `t4` are the local times of
+  // sending the request and receiving the response, and `t2` and `t3` are the
+  // reference times of receiving the request and sending the response. Returns
+  // true if the exchange was used, or false if it was discarded for a long or
+  // invalid round trip.
+  bool OnResponse(uint32_t t1, uint32_t t2, uint32_t t3, uint32_t t4);
+
+  // Returns true once enough exchanges have been used to convert times.
+  bool synced() const { return num_samples_ >= kMinSamples; }
+
+  // Converts a local time to the reference clock.
+  uint32_t LocalToReference(uint32_t local_us) const;
+  // Converts a reference time to the local clock.
+  uint32_t ReferenceToLocal(uint32_t reference_us) const;
+
+  // Estimated drift in ppm, positive if the reference clock runs faster.
+  float drift_ppm() const { return static_cast<float>(drift_ * 1e6); }
+  // Round trip time in microseconds of the last used exchange.
+  uint32_t round_trip_us() const { return last_round_trip_us_; }
+
+ private:
+  // Estimated offset reference - local at `local_us`, modulo 2^32.
+  uint32_t OffsetAt(uint32_t local_us) const;
+  // Refits the offset and drift to the samples.
+  void Fit();
+
+  // Ring buffer of samples: local time (midpoint of t1 and t4) and offset.
+  uint32_t sample_local_us_[kNumSamples];
+  uint32_t sample_offset_us_[kNumSamples];
+  int num_samples_;
+  int next_sample_;
+
+  // Shortest recent round trip, which slowly leaks upward so that it adapts
+  // if the connection interval increases.
+  uint32_t min_round_trip_us_;
+  uint32_t last_round_trip_us_;
+
+  // Fitted model: offset(t) = anchor_offset_us_ + drift_ * (t - anchor_us_).
+  uint32_t anchor_us_;
+  uint32_t anchor_offset_us_;
+  double drift_;
+};
+
+}  // namespace audio_tactile
+
+#endif  // AUDIO_TO_TACTILE_SRC_CPP_CLOCK_SYNC_H_
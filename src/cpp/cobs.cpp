@@ -0,0 +1,64 @@
+// Copyright 2022 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "cpp/cobs.h"
+
+namespace audio_tactile {
+
+int CobsEncode(const uint8_t* in, int size, uint8_t* out) {
+  // Each block starts with a code byte, the offset to the next zero.
+  int code_index = 0;
+  int write = 1;
+  int code = 1;
+  for (int read = 0; read < size; ++read) {
+    if (in[read] == 0) {
+      out[code_index] = static_cast<uint8_t>(code);
+      code_index = write++;
+      code = 1;
+    } else {
+      out[write++] = in[read];
+      // At max block length, start a new block with no implied zero, unless
+      // this is the last byte.
+      if (++code == 0xff && read + 1 < size) {
+        out[code_index] = static_cast<uint8_t>(code);
+        code_index = write++;
+        code = 1;
+      }
+    }
+  }
+  out[code_index] = static_cast<uint8_t>(code);
+  return write;
+}
+
+int CobsDecode(const uint8_t* in, int size, uint8_t* out) {
+  int read = 0;
+  int write = 0;
+  // The write position never passes the read position, so decoding in place is
+  // safe.
+  while (read < size) {
+    const int code = in[read];
+    if (code == 0 || read + code > size) { return -1; }
+    ++read;
+    for (int i = 1; i < code; ++i) {
+      out[write++] = in[read++];
+    }
+    if (code != 0xff && read < size) {
+      out[write++] = 0;
+    }
+  }
+  return write;
+}
+
+}  // namespace audio_tactile
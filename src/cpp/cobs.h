@@ -0,0 +1,170 @@
+// Copyright 2022 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+//
+// Consistent Overhead Byte Stuffing (COBS) framing for serial streams.
+//
+// COBS encodes a frame of bytes so that it contains no zero bytes, at a cost of
+// at most one byte per 254 bytes plus one. A zero byte then delimits frames:
+//
+//   [COBS-encoded frame 1] 0x00 [COBS-encoded frame 2] 0x00 ...
+//
+// Unlike fixed-size packets that start with a marker byte, the receiver finds
+// frame boundaries unambiguously and resynchronizes at the next delimiter after
+// a corrupted or dropped byte. Decoding works in place, since the decoded frame
+// is never longer than the encoded frame.
+//
+// Reference:
+// Cheshire and Baker, "Consistent Overhead Byte Stuffing," IEEE/ACM
+// Transactions on Networking, 1999.
+//
+// Example use:
+//   // Sender.
+//   uint8_t encoded[CobsMaxEncodedSize(kFrameSize) + 1];
+//   const int size = CobsEncode(frame, kFrameSize, encoded);
+//   encoded[size] = 0;  // Delimiter.
+//   Send(encoded, size + 1);
+//
+//   // Receiver, for chunks of received bytes.
+//   CobsStreamDecoder<kMaxFrameSize> decoder;
+//   decoder.Feed({chunk, chunk_size});
+//   Slice<const uint8_t> frame;
+//   while (decoder.Next(&frame)) {
+//     HandleFrame(frame);
+//   }
+
+#ifndef AUDIO_TO_TACTILE_SRC_CPP_COBS_H_
+#define AUDIO_TO_TACTILE_SRC_CPP_COBS_H_
+
+#include <stdint.h>
+#include <string.h>
+
+#include "cpp/slice.h"
+
+namespace audio_tactile {
+
+// Max size of COBS encoding of `size` bytes, not including the delimiter.
+constexpr int CobsMaxEncodedSize(int size) { return size + size / 254 + 1; }
+
+// COBS encodes `size` bytes from `in` to `out`, which must have space for
+// CobsMaxEncodedSize(size) bytes. Returns the encoded size. Does not write a
+// delimiter. `in` and `out` must not overlap.
+int CobsEncode(const uint8_t* in, int size, uint8_t* out);
+
+// Decodes a COBS-encoded frame of `size` bytes, not including the delimiter,
+// from `in` to `out`. Decoding may be in place with `out` == `in`. Returns the
+// decoded size, or -1 if the data is invalid.
+int CobsDecode(const uint8_t* in, int size, uint8_t* out);
+
+// Decodes COBS-delimited frames from a stream of received chunks, such as DMA
+// buffers. Frames that lie entirely within a chunk are decoded in place and
+// returned as views into the chunk without copying. Frames split across chunks
+// are collected in an internal buffer of `kMaxFrameSize` bytes. Frames longer
+// than that, empty frames, and invalid frames are skipped and counted in
+// num_errors().
+template <int kMaxFrameSize>
+class CobsStreamDecoder {
+ public:
+  enum { kMaxEncodedSize = CobsMaxEncodedSize(kMaxFrameSize) };
+
+  CobsStreamDecoder() { Reset(); }
+
+  // Discards any partial frame and pending chunk.
+  void Reset() {
+    chunk_ = nullptr;
+    chunk_remaining_ = 0;
+    staging_size_ = 0;
+    overflow_ = false;
+    num_errors_ = 0;
+  }
+
+  // Sets the next chunk of received bytes. The chunk is modified by in-place
+  // decoding, and must stay valid while frames from it are used. Any frames of
+  // the previous chunk not yet read with Next() are discarded, except that a
+  // trailing partial frame is kept.
+  void Feed(Slice<uint8_t> chunk) {
+    chunk_ = chunk.data();
+    chunk_remaining_ = chunk.size();
+  }
+
+  // Gets the next complete frame from the current chunk. Returns false when the
+  // chunk has no more complete frames. The returned view is valid until the
+  // next call to Next(), Feed(), or Reset().
+  bool Next(Slice<const uint8_t>* frame);
+
+  // Number of frames skipped due to errors.
+  int num_errors() const { return num_errors_; }
+
+ private:
+  uint8_t* chunk_;
+  int chunk_remaining_;
+  // Partial frame carried over from previous chunks.
+  uint8_t staging_[kMaxEncodedSize];
+  int staging_size_;
+  // Whether the current partial frame is too long and being skipped.
+  bool overflow_;
+  int num_errors_;
+};
+
+template <int kMaxFrameSize>
+bool CobsStreamDecoder<kMaxFrameSize>::Next(Slice<const uint8_t>* frame) {
+  while (chunk_remaining_ > 0) {
+    uint8_t* delimiter = static_cast<uint8_t*>(
+        memchr(chunk_, 0, chunk_remaining_));
+    if (delimiter == nullptr) {
+      // No delimiter in the rest of the chunk. Save the partial frame.
+      if (!overflow_ && staging_size_ + chunk_remaining_ <= kMaxEncodedSize) {
+        memcpy(staging_ + staging_size_, chunk_, chunk_remaining_);
+        staging_size_ += chunk_remaining_;
+      } else {
+        overflow_ = true;
+      }
+      chunk_remaining_ = 0;
+      return false;
+    }
+
+    uint8_t* encoded = chunk_;
+    int encoded_size = static_cast<int>(delimiter - chunk_);
+    chunk_remaining_ -= encoded_size + 1;
+    chunk_ = delimiter + 1;
+
+    if (staging_size_ > 0 || overflow_) {
+      // Complete the frame carried over from previous chunks.
+      if (!overflow_ && staging_size_ + encoded_size <= kMaxEncodedSize) {
+        memcpy(staging_ + staging_size_, encoded, encoded_size);
+        encoded = staging_;
+        encoded_size += staging_size_;
+      } else {
+        encoded_size = -1;
+      }
+      staging_size_ = 0;
+      overflow_ = false;
+    }
+
+    const int size = (0 < encoded_size && encoded_size <= kMaxEncodedSize)
+        ? CobsDecode(encoded, encoded_size, encoded) : -1;
+    if (0 < size && size <= kMaxFrameSize) {
+      *frame = Slice<const uint8_t>(encoded, size);
+      return true;
+    } else if (encoded_size != 0) {
+      ++num_errors_;  // Back-to-back delimiters are allowed as padding.
+    }
+  }
+  return false;
+}
+
+}  // namespace audio_tactile
+
+#endif  // AUDIO_TO_TACTILE_SRC_CPP_COBS_H_
@@ -19,6 +19,16 @@ namespace audio_tactile {
 
 // Number of ADC samples per buffer.
 constexpr int kAdcDataSize = 64;
+// Number of audio samples and fricative energy codes per buffer in a
+// kAudioSamplesLowRate message, with audio downsampled by 2 as in
+// tactile/low_rate_stream.h.
+constexpr int kLowRateAudioDataSize = kAdcDataSize / 2;
+constexpr int kLowRateAudioNumCodes = kLowRateAudioDataSize / 4;
+// Number of Enveloper output codes and vowel hex weight codes per buffer in a
+// kTactileFeatures message, see tactile/processing_split.h. The envelopes are
+// 8 frames, for 8x decimation, of 4 Enveloper channels.
+constexpr int kTactileFeaturesNumEnvelopeCodes = (kAdcDataSize / 8) * 4;
+constexpr int kTactileFeaturesNumHexCodes = 7;
 // Number of PWM samples for each channel per buffer.
 constexpr int kNumPwmValues = 8;
 // Number of PWM channels.
@@ -27,10 +37,20 @@ constexpr int kNumTotalPwm = 12;
 constexpr int kMaxTactilePatternLength = 15;
 // Max length of a device name string, not including null terminator.
 constexpr int kMaxDeviceNameLength = 16;
+// Max number of EnvelopeLog entries in a kEnvelopeLogEntries message.
+constexpr int kMaxEnvelopeLogEntriesPerMessage = 7;
+// Max number of EnvelopeEvent events in a kEnvelopeEvents message.
+constexpr int kMaxEnvelopeEventsPerMessage = 64;
+// Max number of pattern bytes in a kTactilePatternChunk message, after the
+// 5-byte chunk header.
+constexpr int kMaxTactilePatternChunkBytes = 123;
 
 // Constants for mic input selection.
 enum class InputSelection { kAnalogMic, kPdmMic };
 
+// Constants for latency profile selection. See cpp/latency.h.
+enum class LatencyProfile { kDefault, kLowLatency };
+
 }  // namespace audio_tactile
 
 #endif  // AUDIO_TO_TACTILE_SRC_CPP_CONSTANTS_H_
@@ -0,0 +1,289 @@
+// Copyright 2022 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+// DeferredLog, binary logging that is formatted later on the host.
+//
+// Formatting text with Serial.print() on the device is slow, and it blocks when
+// the serial buffer is full, so it can't be left on in time-critical code.
+// DeferredLog instead records only the address of the format string, a
+// timestamp, and the raw 32-bit arguments into a ring buffer of fixed-size
+// records. The main loop drains records opportunistically when the serial port
+// has room, and the host decodes them with extras/tools/decode_deferred_log.py,
+// looking up each format string by its address in the firmware ELF file.
+//
+// Recording costs a few dozen cycles and never blocks. When the ring is full,
+// the record is dropped and counted, and the count is reported with the next
+// drained record. Log() is lock free and safe to call concurrently from
+// interrupt handlers, RTOS tasks, and the main loop. Only one context should
+// drain the log.
+//
+// Log statements use the DEFERRED_LOG_* macros with a printf-style format
+// string literal. Arguments may be integers or enums of up to 32 bits, bools,
+// or floats, at most kMaxArgs of them. Strings and pointers are not supported,
+// since only the format string is resolved on the host. Levels below
+// DEFERRED_LOG_MIN_LEVEL, set with a compiler flag, are compiled out along
+// with their format strings, so debug logging can be left in the source.
+//
+// Example use:
+//   DeferredLog<64> g_log;
+//
+//   void OnPwmSequenceEnd() {  // Interrupt.
+//     DEFERRED_LOG_DEBUG(g_log, "PWM underrun, queue %d", queue_size);
+//   }
+//
+//   void loop() {
+//     uint8_t frame[DeferredLog<64>::kMaxFrameSize];
+//     while (Serial.availableForWrite() >= sizeof(frame)) {
+//       const int size = g_log.DrainFrame(frame);
+//       if (size == 0) { break; }
+//       Serial.write(frame, size);
+//     }
+//   }
+//
+// Each drained frame is a record serialized as below, COBS encoded (see
+// cobs.h), with a zero delimiter before and after it so that the host
+// resynchronizes after any text written to the same port:
+//
+//   Offset  Field
+//   0       uint32 format string address, or 0 for a dropped records report
+//   4       uint32 timestamp in ticks
+//   8       uint8 level
+//   9       uint8 number of arguments N
+//   10      N uint32 arguments, floats as their IEEE 754 bits
+//
+// All multibyte values are little endian.
+
+#ifndef AUDIO_TO_TACTILE_SRC_CPP_DEFERRED_LOG_H_
+#define AUDIO_TO_TACTILE_SRC_CPP_DEFERRED_LOG_H_
+
+#include <stdint.h>
+#include <string.h>
+
+#include "cpp/cobs.h"
+#include "dsp/serialize.h"
+#include "tactile/profiler.h"
+
+namespace audio_tactile {
+
+enum DeferredLogLevel {
+  kDeferredLogDebug = 0,
+  kDeferredLogInfo = 1,
+  kDeferredLogWarning = 2,
+  kDeferredLogError = 3,
+};
+
+// Minimum level that is compiled in. For instance, build with
+// -DDEFERRED_LOG_MIN_LEVEL=1 to compile out debug logging.
+#ifndef DEFERRED_LOG_MIN_LEVEL
+#define DEFERRED_LOG_MIN_LEVEL 0
+#endif
+
+// Logs to DeferredLog `log` if `level` is at least DEFERRED_LOG_MIN_LEVEL.
+// Since both are constants, disabled statements compile to nothing.
+#define DEFERRED_LOG(log, level, ...)        \
+  do {                                       \
+    if ((level) >= DEFERRED_LOG_MIN_LEVEL) { \
+      (log).Log((level), __VA_ARGS__);       \
+    }                                        \
+  } while (0)
+
+#define DEFERRED_LOG_DEBUG(log, ...) \
+  DEFERRED_LOG(log, ::audio_tactile::kDeferredLogDebug, __VA_ARGS__)
+#define DEFERRED_LOG_INFO(log, ...) \
+  DEFERRED_LOG(log, ::audio_tactile::kDeferredLogInfo, __VA_ARGS__)
+#define DEFERRED_LOG_WARNING(log, ...) \
+  DEFERRED_LOG(log, ::audio_tactile::kDeferredLogWarning, __VA_ARGS__)
+#define DEFERRED_LOG_ERROR(log, ...) \
+  DEFERRED_LOG(log, ::audio_tactile::kDeferredLogError, __VA_ARGS__)
+
+template <int kCapacity_>
+class DeferredLog {
+ public:
+  enum {
+    // Max number of records in the ring.
+    kCapacity = kCapacity_,
+    // Max number of arguments per log statement.
+    kMaxArgs = 6,
+    // Max size of a serialized record.
+    kMaxRecordSize = 10 + 4 * kMaxArgs,
+    // Max size of a frame from DrainFrame(), including delimiters.
+    kMaxFrameSize = CobsMaxEncodedSize(kMaxRecordSize) + 2,
+  };
+  struct TestAccess;
+
+  static_assert(kCapacity > 0 && (kCapacity & (kCapacity - 1)) == 0,
+                "kCapacity must be a power of 2");
+
+  // Function returning the current time in ticks.
+  typedef uint32_t (*GetTicksFun)();
+
+  explicit DeferredLog(GetTicksFun get_ticks = ProfilerGetTicks) noexcept
+      : get_ticks_(get_ticks),
+        write_count_(0),
+        read_count_(0),
+        num_dropped_(0),
+        num_reported_dropped_(0) {
+    for (int i = 0; i < kCapacity; ++i) {
+      records_[i].sequence = i;
+    }
+  }
+  DeferredLog(const DeferredLog&) = delete;  // No copying.
+  DeferredLog& operator=(const DeferredLog&) = delete;
+
+  // Records a log statement. Use the DEFERRED_LOG_* macros rather than calling
+  // this directly. Returns false if the ring is full and the record was
+  // dropped.
+  template <typename... Args>
+  bool Log(int level, const char* format, Args... args) noexcept {
+    static_assert(sizeof...(Args) <= kMaxArgs, "Too many log arguments");
+    // The extra element avoids a zero-size array when there are no arguments.
+    const uint32_t words[sizeof...(Args) + 1] = {ToWord(args)..., 0};
+    return Push(level, format, words, sizeof...(Args));
+  }
+
+  // Drains the oldest record as a COBS-encoded frame with delimiters, written
+  // to `frame`, which must have space for kMaxFrameSize bytes. Returns the
+  // frame size, or 0 if there are no records ready. Records dropped since the
+  // last call are reported in a frame of their own before the next record.
+  int DrainFrame(uint8_t* frame) noexcept {
+    uint8_t record[kMaxRecordSize];
+    int size;
+    const uint32_t num_dropped =
+        __atomic_load_n(&num_dropped_, __ATOMIC_RELAXED);
+    if (num_dropped != num_reported_dropped_) {
+      const uint32_t arg = num_dropped - num_reported_dropped_;
+      num_reported_dropped_ = num_dropped;
+      size = Serialize(0, get_ticks_(), kDeferredLogWarning, &arg, 1, record);
+    } else if (!(size = Pop(record))) {
+      return 0;
+    }
+    frame[0] = 0;
+    size = 1 + CobsEncode(record, size, frame + 1);
+    frame[size] = 0;
+    return size + 1;
+  }
+
+  // Number of records dropped because the ring was full.
+  uint32_t num_dropped() const noexcept {
+    return __atomic_load_n(&num_dropped_, __ATOMIC_RELAXED);
+  }
+
+ private:
+  struct Record {
+    // Sequence number for synchronization: equal to the write count when the
+    // slot is free for that write, and one more when the record is ready.
+    uint32_t sequence;
+    const char* format;
+    uint32_t timestamp;
+    uint8_t level;
+    uint8_t num_args;
+    uint32_t args[kMaxArgs];
+  };
+
+  static uint32_t ToWord(float x) noexcept {
+    uint32_t word;
+    memcpy(&word, &x, sizeof(word));
+    return word;
+  }
+  static uint32_t ToWord(double x) noexcept {
+    return ToWord(static_cast<float>(x));
+  }
+  template <typename T>
+  static uint32_t ToWord(T x) noexcept {
+    static_assert(sizeof(T) <= sizeof(uint32_t),
+                  "Log arguments must be at most 32 bits");
+    return static_cast<uint32_t>(x);
+  }
+
+  // Claims a slot, following Vyukov's bounded MPMC queue: a producer claims
+  // the slot at the write count with a compare-and-swap once the consumer has
+  // freed it, fills it, then marks it ready through its sequence number.
+  bool Push(int level, const char* format, const uint32_t* args,
+            int num_args) noexcept {
+    const uint32_t timestamp = get_ticks_();
+    uint32_t write = __atomic_load_n(&write_count_, __ATOMIC_RELAXED);
+    Record* record;
+    for (;;) {
+      record = &records_[write & (kCapacity - 1)];
+      const uint32_t sequence =
+          __atomic_load_n(&record->sequence, __ATOMIC_ACQUIRE);
+      const int32_t diff = static_cast<int32_t>(sequence - write);
+      if (diff == 0) {
+        if (__atomic_compare_exchange_n(&write_count_, &write, write + 1,
+                                        /*weak=*/true, __ATOMIC_RELAXED,
+                                        __ATOMIC_RELAXED)) {
+          break;
+        }
+        // On failure, `write` was updated to the current write count.
+      } else if (diff < 0) {  // Full.
+        __atomic_fetch_add(&num_dropped_, 1, __ATOMIC_RELAXED);
+        return false;
+      } else {  // Another producer claimed this slot; retry.
+        write = __atomic_load_n(&write_count_, __ATOMIC_RELAXED);
+      }
+    }
+
+    record->format = format;
+    record->timestamp = timestamp;
+    record->level = static_cast<uint8_t>(level);
+    record->num_args = static_cast<uint8_t>(num_args);
+    memcpy(record->args, args, num_args * sizeof(uint32_t));
+    __atomic_store_n(&record->sequence, write + 1, __ATOMIC_RELEASE);
+    return true;
+  }
+
+  // Pops the oldest ready record, serialized to `out`. Returns its size, or 0
+  // if none is ready.
+  int Pop(uint8_t* out) noexcept {
+    Record* record = &records_[read_count_ & (kCapacity - 1)];
+    if (__atomic_load_n(&record->sequence, __ATOMIC_ACQUIRE) !=
+        read_count_ + 1) {
+      return 0;
+    }
+    const int size = Serialize(
+        static_cast<uint32_t>(reinterpret_cast<uintptr_t>(record->format)),
+        record->timestamp, record->level, record->args, record->num_args, out);
+    // Free the slot for the write one lap later.
+    __atomic_store_n(&record->sequence, read_count_ + kCapacity,
+                     __ATOMIC_RELEASE);
+    ++read_count_;
+    return size;
+  }
+
+  static int Serialize(uint32_t format_address, uint32_t timestamp, int level,
+                       const uint32_t* args, int num_args, uint8_t* out) {
+    LittleEndianWriteU32(format_address, out);
+    LittleEndianWriteU32(timestamp, out + 4);
+    out[8] = static_cast<uint8_t>(level);
+    out[9] = static_cast<uint8_t>(num_args);
+    for (int i = 0; i < num_args; ++i) {
+      LittleEndianWriteU32(args[i], out + 10 + 4 * i);
+    }
+    return 10 + 4 * num_args;
+  }
+
+  GetTicksFun get_ticks_;
+  Record records_[kCapacity];
+  // Number of slots claimed by producers, updated by compare-and-swap.
+  uint32_t write_count_;
+  // Number of records drained, accessed only by the consumer.
+  uint32_t read_count_;
+  uint32_t num_dropped_;
+  uint32_t num_reported_dropped_;
+};
+
+}  // namespace audio_tactile
+
+#endif  // AUDIO_TO_TACTILE_SRC_CPP_DEFERRED_LOG_H_
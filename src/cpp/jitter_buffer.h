@@ -0,0 +1,346 @@
+// Copyright 2022 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+// JitterBuffer, an adaptive jitter buffer for streamed sample blocks.
+//
+// Streamed samples, e.g. kAllTactorsSamples messages over BLE, arrive in bursts
+// tied to the connection interval, while the tactors consume one block per
+// fixed period. JitterBuffer<kNumFrames, kNumChannels, kCapacity> queues up to
+// `kCapacity` blocks of `kNumFrames` interleaved frames with `kNumChannels`
+// channels, and adapts its depth to the measured arrival jitter, so that the
+// latency is as low as possible without dropouts under the current RF
+// conditions:
+//
+//  * Jitter measurement: each Push() compares the arrival time with a nominal
+//    clock advancing by one block period per block. The spread between the
+//    earliest and latest relative arrival, tracked by slowly leaking peak
+//    detectors, is the jitter. The target depth is the jitter in blocks plus a
+//    margin of one block. It rises immediately when jitter increases, and falls
+//    one block at a time after `kReleaseBlocks` blocks of lower jitter.
+//
+//  * Priming: after Reset() or an underrun, Pop() waits until the depth reaches
+//    the target before playing. Each underrun also adds a block to the target,
+//    which is removed after `kReleaseBlocks` pops without underruns.
+//
+//  * Latency trimming: if the depth never drops below the target over a window
+//    of `kTrimWindow` pops, the buffer holds more than it needs, e.g. after a
+//    burst of retransmitted packets, and one block is dropped.
+//
+//  * Concealment: when there is no block to play, Pop() repeats the last block,
+//    holding it for the first missing block and then fading it out with a
+//    linear ramp over `kFadeBlocks` blocks, so that the envelope decays
+//    smoothly for short gaps rather than cutting to zero. After concealment,
+//    playback fades back in over one block.
+//
+// Push() and Pop() may be called from different threads or interrupts: blocks
+// are passed through an SpscRingBuffer, and the jitter measurement is state
+// owned by the producer. Call Push() from one producer and Pop() from one
+// consumer. Stats may then be read by the consumer with stats() and sent to the
+// app in a kJitterBufferStats message (see cpp/message.h).
+//
+// Example use:
+//   JitterBuffer<kNumPwmValues, kNumTotalPwm, 16> jitter_buffer;
+//   jitter_buffer.Init(kPwmBlockPeriodUs);
+//
+//   // When a block arrives.
+//   jitter_buffer.Push(block, timestamp_us);
+//
+//   // Once per block period.
+//   float output[kNumPwmValues * kNumTotalPwm];
+//   jitter_buffer.Pop(output);
+
+#ifndef AUDIO_TO_TACTILE_SRC_CPP_JITTER_BUFFER_H_
+#define AUDIO_TO_TACTILE_SRC_CPP_JITTER_BUFFER_H_
+
+#include <stdint.h>
+#include <string.h>
+
+#include "cpp/spsc_ring_buffer.h"
+
+namespace audio_tactile {
+
+// Streaming statistics of a JitterBuffer.
+struct JitterBufferStats {
+  // Buffering latency in milliseconds, the target depth times the block period.
+  float latency_ms;
+  // Measured arrival jitter in milliseconds.
+  float jitter_ms;
+  // Target depth in blocks.
+  int target_depth;
+  // Number of times the buffer ran empty while playing.
+  uint32_t num_underruns;
+  // Number of blocks output by concealment or while priming.
+  uint32_t num_concealed_blocks;
+  // Number of blocks dropped, on overflow or by latency trimming.
+  uint32_t num_dropped_blocks;
+};
+
+template <int kNumFrames_, int kNumChannels_, int kCapacity_>
+class JitterBuffer {
+ public:
+  enum {
+    kNumFrames = kNumFrames_,
+    kNumChannels = kNumChannels_,
+    kCapacity = kCapacity_,
+    // Number of samples in a block.
+    kBlockSize = kNumFrames * kNumChannels,
+    // Safety margin in blocks added to the measured jitter.
+    kMarginBlocks = 1,
+    // Number of blocks over which the target depth is released by one block.
+    kReleaseBlocks = 512,
+    // Number of pops over which the min depth is measured for trimming.
+    kTrimWindow = 128,
+    // Number of blocks over which concealment fades out.
+    kFadeBlocks = 4,
+  };
+
+  static_assert(kNumFrames > 0 && kNumChannels > 0,
+                "Block dimensions must be positive");
+
+  JitterBuffer() noexcept: block_period_us_(1) { Reset(); }
+  JitterBuffer(const JitterBuffer&) = delete;  // No copying.
+  JitterBuffer& operator=(const JitterBuffer&) = delete;
+
+  // Initializes with the nominal period in microseconds between blocks.
+  void Init(uint32_t block_period_us) {
+    block_period_us_ = (block_period_us > 0) ? block_period_us : 1;
+    Reset();
+  }
+
+  // Resets to initial state. This should be called from the consumer while the
+  // producer is idle, e.g. on kStreamDataStart.
+  void Reset() {
+    while (queue_.Front() != nullptr) { queue_.PopFront(); }
+    // Producer state.
+    num_pushed_ = 0;
+    expected_us_ = 0;
+    min_delay_us_ = 0;
+    max_delay_us_ = 0;
+    jitter_us_ = 0;
+    jitter_target_ = kMarginBlocks;
+    release_count_ = 0;
+    num_overflows_ = 0;
+    // Consumer state.
+    playing_ = false;
+    underrun_margin_ = 0;
+    underrun_release_count_ = 0;
+    trim_count_ = 0;
+    trim_min_depth_ = kCapacity;
+    missing_blocks_ = 0;
+    gain_ = 0.0f;
+    num_underruns_ = 0;
+    num_concealed_blocks_ = 0;
+    num_trimmed_ = 0;
+    memset(last_block_.samples, 0, sizeof(last_block_.samples));
+  }
+
+  // Producer: Pushes a block of kBlockSize samples that arrived at time
+  // `arrival_us` in microseconds. The timestamp may wrap around. Returns false
+  // if the buffer is full, in which case the block is dropped.
+  bool Push(const float* block, uint32_t arrival_us) {
+    UpdateJitter(arrival_us);
+    Block* slot = queue_.BeginPush();
+    if (slot == nullptr) {
+      ++num_overflows_;
+      return false;
+    }
+    memcpy(slot->samples, block, sizeof(slot->samples));
+    queue_.EndPush();
+    return true;
+  }
+
+  // Consumer: Gets the next block of kBlockSize samples into `output`. Returns
+  // true if the block is from the stream, or false if it is concealment.
+  bool Pop(float* output) {
+    const int depth = queue_.size();
+    const int target = target_depth();
+    if (!playing_ && depth >= target && depth > 0) {
+      playing_ = true;
+    }
+
+    if (playing_) {
+      UpdateTrim(depth, target);
+      const Block* front = queue_.Front();
+      if (front != nullptr) {
+        // Fade in if resuming after concealment, otherwise gain_ is 1.
+        ApplyRamp(front->samples, gain_, 1.0f, output);
+        last_block_ = *front;
+        queue_.PopFront();
+        gain_ = 1.0f;
+        missing_blocks_ = 0;
+        if (underrun_margin_ > 0 && ++underrun_release_count_ >=
+            kReleaseBlocks) {
+          --underrun_margin_;
+          underrun_release_count_ = 0;
+        }
+        return true;
+      }
+      // Underrun. Prime again to a deeper target.
+      playing_ = false;
+      ++num_underruns_;
+      if (underrun_margin_ < kCapacity) { ++underrun_margin_; }
+      underrun_release_count_ = 0;
+    }
+
+    // Conceal by holding the last block, then fading it out.
+    ++num_concealed_blocks_;
+    ++missing_blocks_;
+    float end_gain = gain_;
+    if (missing_blocks_ > 1) {
+      end_gain -= 1.0f / kFadeBlocks;
+      if (end_gain < 0.0f) { end_gain = 0.0f; }
+    }
+    ApplyRamp(last_block_.samples, gain_, end_gain, output);
+    gain_ = end_gain;
+    return false;
+  }
+
+  // Number of buffered blocks.
+  int depth() const { return queue_.size(); }
+
+  // Current target depth in blocks.
+  int target_depth() const {
+    const int target = jitter_target_ + underrun_margin_;
+    return (target < kCapacity) ? target : kCapacity;
+  }
+
+  // Whether Pop() is playing from the stream, as opposed to priming.
+  bool playing() const { return playing_; }
+
+  // Consumer: Gets streaming statistics.
+  JitterBufferStats stats() const {
+    JitterBufferStats stats;
+    stats.target_depth = target_depth();
+    stats.latency_ms = 1e-3f * stats.target_depth * block_period_us_;
+    stats.jitter_ms = 1e-3f * jitter_us_;
+    stats.num_underruns = num_underruns_;
+    stats.num_concealed_blocks = num_concealed_blocks_;
+    stats.num_dropped_blocks = num_overflows_ + num_trimmed_;
+    return stats;
+  }
+
+ private:
+  struct Block {
+    float samples[kBlockSize];
+  };
+
+  // Producer: Updates the jitter measurement and target for a block arriving
+  // at `arrival_us`.
+  void UpdateJitter(uint32_t arrival_us) {
+    if (num_pushed_ == 0) {
+      expected_us_ = arrival_us;
+    }
+    ++num_pushed_;
+    // Arrival time relative to the nominal clock. Positive is late.
+    int32_t delay_us = static_cast<int32_t>(arrival_us - expected_us_);
+    const int32_t max_delay_us =
+        static_cast<int32_t>(kCapacity * block_period_us_);
+    if (delay_us > max_delay_us || delay_us < -max_delay_us) {
+      // Blocks were lost or the producer restarted. More delay than the buffer
+      // could absorb is not jitter, so resync the nominal clock.
+      expected_us_ = arrival_us;
+      min_delay_us_ = max_delay_us_ = delay_us = 0;
+    }
+    expected_us_ += block_period_us_;
+
+    // Peak detectors that leak toward each other by 1/256 block per block, so
+    // that they forget old jitter over several hundred blocks and follow slow
+    // clock drift.
+    const int32_t leak_us = static_cast<int32_t>(block_period_us_ / 256 + 1);
+    if (num_pushed_ == 1) {
+      min_delay_us_ = max_delay_us_ = delay_us;
+    } else {
+      min_delay_us_ += leak_us;
+      max_delay_us_ -= leak_us;
+      if (min_delay_us_ > delay_us) { min_delay_us_ = delay_us; }
+      if (max_delay_us_ < delay_us) { max_delay_us_ = delay_us; }
+      if (max_delay_us_ < min_delay_us_) { max_delay_us_ = min_delay_us_; }
+    }
+    jitter_us_ = max_delay_us_ - min_delay_us_;
+
+    // Target the jitter in whole blocks plus the margin.
+    int measured = kMarginBlocks + static_cast<int>(
+        (static_cast<uint32_t>(jitter_us_) + block_period_us_ - 1) /
+        block_period_us_);
+    if (measured > kCapacity) { measured = kCapacity; }
+    if (measured >= jitter_target_) {
+      jitter_target_ = measured;  // Attack immediately.
+      release_count_ = 0;
+    } else if (++release_count_ >= kReleaseBlocks) {
+      --jitter_target_;  // Release slowly.
+      release_count_ = 0;
+    }
+  }
+
+  // Consumer: Drops a block if the depth before popping has stayed above the
+  // target over the last kTrimWindow pops.
+  void UpdateTrim(int depth, int target) {
+    if (depth < trim_min_depth_) { trim_min_depth_ = depth; }
+    if (++trim_count_ < kTrimWindow) { return; }
+    if (trim_min_depth_ > target && queue_.Front() != nullptr) {
+      queue_.PopFront();
+      ++num_trimmed_;
+    }
+    trim_count_ = 0;
+    trim_min_depth_ = kCapacity;
+  }
+
+  // Writes `input` scaled by a gain ramping linearly from `gain_start` to
+  // `gain_end` over the block's frames.
+  static void ApplyRamp(const float* input, float gain_start, float gain_end,
+                        float* output) {
+    if (gain_start == 1.0f && gain_end == 1.0f) {
+      memcpy(output, input, sizeof(float) * kBlockSize);
+      return;
+    }
+    const float step = (gain_end - gain_start) / kNumFrames;
+    for (int i = 0; i < kNumFrames; ++i) {
+      const float gain = gain_start + step * (i + 1);
+      for (int c = 0; c < kNumChannels; ++c) {
+        output[i * kNumChannels + c] = gain * input[i * kNumChannels + c];
+      }
+    }
+  }
+
+  SpscRingBuffer<Block, kCapacity> queue_;
+  uint32_t block_period_us_;
+
+  // Producer state.
+  uint32_t num_pushed_;
+  uint32_t expected_us_;
+  int32_t min_delay_us_;
+  int32_t max_delay_us_;
+  int32_t jitter_us_;
+  int jitter_target_;
+  int release_count_;
+  uint32_t num_overflows_;
+
+  // Consumer state.
+  bool playing_;
+  int underrun_margin_;
+  int underrun_release_count_;
+  int trim_count_;
+  int trim_min_depth_;
+  int missing_blocks_;
+  float gain_;
+  uint32_t num_underruns_;
+  uint32_t num_concealed_blocks_;
+  uint32_t num_trimmed_;
+  Block last_block_;
+};
+
+}  // namespace audio_tactile
+
+#endif  // AUDIO_TO_TACTILE_SRC_CPP_JITTER_BUFFER_H_
@@ -0,0 +1,41 @@
+// Copyright 2022 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "cpp/latency.h"
+
+namespace audio_tactile {
+
+LatencyConfig GetLatencyConfig(LatencyProfile profile) {
+  switch (profile) {
+    case LatencyProfile::kLowLatency:
+      return LatencyConfig{kAdcDataSize / 2, kAdcDataSize / 2,
+                           kAdcDataSize / (2 * kNumPwmValues)};
+
+    case LatencyProfile::kDefault:
+      break;
+  }
+  return LatencyConfig{kAdcDataSize, kAdcDataSize,
+                       kAdcDataSize / kNumPwmValues};
+}
+
+float EstimateLatencyMs(const LatencyConfig& config, float sample_rate_hz) {
+  // The TactileProcessor block completes when its last mic block arrives.
+  const int input_delay = (config.carl_block_size > config.mic_block_size)
+                              ? config.carl_block_size
+                              : config.mic_block_size;
+  const int pwm_delay = config.carl_block_size;
+  return 1000.0f * (input_delay + pwm_delay) / sample_rate_hz;
+}
+
+}  // namespace audio_tactile
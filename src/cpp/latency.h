@@ -0,0 +1,64 @@
+// Copyright 2022 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+// Latency profiles for the mic-to-tactor processing path.
+//
+// A LatencyProfile selects the block sizes used from mic to tactors:
+//
+//  * `mic_block_size`: number of mic samples per interrupt.
+//  * `carl_block_size`: TactileProcessor input block size.
+//  * `decimation_factor`: TactileProcessor decimation factor. This is also the
+//    PWM upsampling factor, so that each block of tactile output fills one PWM
+//    sequence of kNumPwmValues frames.
+//
+// The low latency profile halves the block sizes and decimation factor. Since
+// carl_block_size / decimation_factor stays at kNumPwmValues, the PWM sequence
+// is half as long and the PwmSleeve ping-pong swaps twice as often. The cost is
+// twice the interrupt and per-block processing overhead.
+//
+// Example use:
+//   const LatencyConfig config = GetLatencyConfig(settings.latency);
+//   ExternalAnalogMic.SetBlockSize(config.mic_block_size);
+//   tactile_processor.Init(kSampleRateHz, config.carl_block_size,
+//                          config.decimation_factor);
+//   SleeveTactors.SetUpsamplingFactor(config.decimation_factor);
+
+#ifndef AUDIO_TO_TACTILE_SRC_CPP_LATENCY_H_
+#define AUDIO_TO_TACTILE_SRC_CPP_LATENCY_H_
+
+#include "cpp/constants.h"
+
+namespace audio_tactile {
+
+struct LatencyConfig {
+  int mic_block_size;
+  int carl_block_size;
+  int decimation_factor;
+};
+
+// Gets the block sizes for `profile`.
+LatencyConfig GetLatencyConfig(LatencyProfile profile);
+
+// Estimates the end-to-end latency in milliseconds from mic input to tactor
+// output with `config` at sample rate `sample_rate_hz`. The estimate counts
+// buffering delay: a sample waits for its mic block to fill and for the
+// TactileProcessor block to complete, then for the PWM ping-pong buffer to
+// swap, which takes at most one PWM sequence (carl_block_size samples). Group
+// delay of the filters and envelope smoothing is not included.
+float EstimateLatencyMs(const LatencyConfig& config, float sample_rate_hz);
+
+}  // namespace audio_tactile
+
+#endif  // AUDIO_TO_TACTILE_SRC_CPP_LATENCY_H_
@@ -18,7 +18,11 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "cpp/tactile_codec.h"  // NOLINT(build/include)
 #include "dsp/serialize.h"  // NOLINT(build/include)
+#include "tactile/enveloper.h"  // NOLINT(build/include)
+#include "tactile/low_rate_stream.h"  // NOLINT(build/include)
+#include "tactile/processing_split.h"  // NOLINT(build/include)
 
 namespace audio_tactile {
 
@@ -30,63 +34,283 @@ bool Message::VerifyChecksum() {
   return ::LittleEndianReadU16(bytes_) == ComputeChecksum();
 }
 
+bool Message::CopyAndVerifyChecksum(const uint8_t* data) {
+  bytes_[0] = data[0];
+  bytes_[1] = data[1];
+  // Same as ComputeChecksum(), over the type, size, and payload.
+  return ::LittleEndianReadU16(data) ==
+         ::Fletcher16Copy(bytes_ + 2, data + 2, (kHeaderSize - 2) + data[3],
+                          /*init=*/1);
+}
+
 uint16_t Message::ComputeChecksum() const {
   return ::Fletcher16(bytes_ + 2, (kHeaderSize - 2) + payload_size(),
                       /*init=*/1);
 }
 
+namespace {
+// Schemas of messages with fixed payload layouts. Sizes are checked at compile
+// time below, and must not change, to keep compatibility with other devices.
+using AudioSamplesSchema = MessageSchema<ArrayField<int16_t, kAdcDataSize>>;
+using AudioSamplesLowRateSchema = MessageSchema<
+    ArrayField<int16_t, kLowRateAudioDataSize>,   // Samples.
+    ArrayField<uint8_t, kLowRateAudioNumCodes>>;  // Fricative energy codes.
+using TactileFeaturesSchema = MessageSchema<
+    ArrayField<uint8_t, kTactileFeaturesNumEnvelopeCodes>,  // Envelopes.
+    ArrayField<uint8_t, kTactileFeaturesNumHexCodes>>;      // Hex weights.
+using SingleFloatSchema = MessageSchema<F32Field>;
+using JitterBufferStatsSchema = MessageSchema<
+    F32Field,           // latency_ms.
+    F32Field,           // jitter_ms.
+    SaturatedU8Field,   // target_depth.
+    U32Field,           // num_underruns.
+    U32Field,           // num_concealed_blocks.
+    U32Field>;          // num_dropped_blocks.
+using DeadlineStatsSchema = MessageSchema<
+    U32Field,   // num_buffers.
+    U32Field,   // num_overruns.
+    U32Field,   // num_near_misses.
+    F32Field,   // mean_load.
+    F32Field>;  // max_load.
+using EnergyStatsSchema = MessageSchema<
+    U32Field,   // num_minutes.
+    F32Field,   // cpu_active_fraction.
+    ArrayField<float, kEnergyMeterMaxChannels>>;  // channel_power.
+using SingleTactorSamplesSchema =
+    MessageSchema<ArrayField<uint16_t, kNumPwmValues>>;
+using AllTactorsSamplesSchema =
+    MessageSchema<ArrayField<uint8_t, kNumTotalPwm * kNumPwmValues>>;
+using TimedTactorsSamplesSchema = MessageSchema<
+    U32Field,                                          // presentation_us.
+    ArrayField<uint8_t, kNumTotalPwm * kNumPwmValues>>;  // Samples.
+using ClockSyncRequestSchema = MessageSchema<U32Field>;  // t1.
+using ClockSyncResponseSchema = MessageSchema<
+    U32Field,   // t1.
+    U32Field,   // t2.
+    U32Field>;  // t3.
+using TuningSchema = MessageSchema<ArrayField<uint8_t, kNumTuningKnobs>>;
+using CalibrateTactorSchema = MessageSchema<
+    U8Field,    // Two 4-bit tactor indices.
+    U8Field,    // Gain control value.
+    U16Field>;  // Amplitude.
+using FlashWriteStatusSchema = MessageSchema<U8Field>;
+using PlayTactilePatternSchema = MessageSchema<U8Field>;  // id.
+using TactilePatternUploadStatusSchema = MessageSchema<
+    U8Field,    // id.
+    U8Field>;   // status.
+// kTactilePatternChunk has a variable-size payload: a uint8 id, uint16
+// total_size, and uint16 offset, followed by the chunk data.
+constexpr int kTactilePatternChunkHeaderBytes = 5;
+
+static_assert(AudioSamplesLowRateSchema::kPayloadSize == 72,
+              "Wire format changed");
+static_assert(kLowRateAudioDataSize ==
+                  kAdcDataSize / kLowRateStreamDecimation &&
+              kLowRateAudioNumCodes ==
+                  kLowRateAudioDataSize / kLowRateStreamCodeStride,
+              "kAudioSamplesLowRate layout mismatches low_rate_stream.h");
+static_assert(TactileFeaturesSchema::kPayloadSize == 39,
+              "Wire format changed");
+static_assert(kTactileFeaturesNumEnvelopeCodes % kEnveloperNumChannels == 0 &&
+              kTactileFeaturesNumHexCodes == kTactileFeaturesNumHexWeights,
+              "kTactileFeatures layout mismatches processing_split.h");
+static_assert(SingleFloatSchema::kPayloadSize == 4, "Wire format changed");
+static_assert(JitterBufferStatsSchema::kPayloadSize == 21,
+              "Wire format changed");
+static_assert(DeadlineStatsSchema::kPayloadSize == 20, "Wire format changed");
+static_assert(EnergyStatsSchema::kPayloadSize == 104, "Wire format changed");
+static_assert(TimedTactorsSamplesSchema::kPayloadSize == 100,
+              "Wire format changed");
+static_assert(ClockSyncResponseSchema::kPayloadSize == 12,
+              "Wire format changed");
+static_assert(CalibrateTactorSchema::kPayloadSize == 4, "Wire format changed");
+static_assert(kEnvelopeTrackerRecordBytes <= Message::kMaxPayloadSize,
+              "kStatsRecord payload exceeds kMaxPayloadSize");
+static_assert(kMaxEnvelopeLogEntriesPerMessage * kEnvelopeLogEntryBytes <=
+                  Message::kMaxPayloadSize,
+              "kEnvelopeLogEntries payload exceeds kMaxPayloadSize");
+static_assert(kMaxEnvelopeEventsPerMessage * kEnvelopeEventBytes <=
+                  Message::kMaxPayloadSize,
+              "kEnvelopeEvents payload exceeds kMaxPayloadSize");
+static_assert(kTactilePatternChunkHeaderBytes + kMaxTactilePatternChunkBytes ==
+                  Message::kMaxPayloadSize,
+              "kTactilePatternChunk payload mismatches kMaxPayloadSize");
+}  // namespace
+
 void Message::WriteAudioSamples(Slice<const int16_t, kAdcDataSize> samples) {
-  SetTypeAndPayload(MessageType::kAudioSamples, samples.bytes());
+  WriteWithSchema<AudioSamplesSchema>(MessageType::kAudioSamples, samples);
 }
 bool Message::ReadAudioSamples(Slice<int16_t, kAdcDataSize> samples) const {
-  return samples.bytes().CopyFrom(payload());
+  return ReadWithSchema<AudioSamplesSchema>(samples);
+}
+
+void Message::WriteAudioSamplesLowRate(
+    Slice<const int16_t, kLowRateAudioDataSize> samples,
+    Slice<const uint8_t, kLowRateAudioNumCodes> codes) {
+  WriteWithSchema<AudioSamplesLowRateSchema>(
+      MessageType::kAudioSamplesLowRate, samples, codes);
+}
+bool Message::ReadAudioSamplesLowRate(
+    Slice<int16_t, kLowRateAudioDataSize> samples,
+    Slice<uint8_t, kLowRateAudioNumCodes> codes) const {
+  return ReadWithSchema<AudioSamplesLowRateSchema>(samples, codes);
+}
+
+void Message::WriteTactileFeatures(
+    Slice<const uint8_t, kTactileFeaturesNumEnvelopeCodes> envelope_codes,
+    Slice<const uint8_t, kTactileFeaturesNumHexCodes> hex_codes) {
+  WriteWithSchema<TactileFeaturesSchema>(MessageType::kTactileFeatures,
+                                         envelope_codes, hex_codes);
+}
+bool Message::ReadTactileFeatures(
+    Slice<uint8_t, kTactileFeaturesNumEnvelopeCodes> envelope_codes,
+    Slice<uint8_t, kTactileFeaturesNumHexCodes> hex_codes) const {
+  return ReadWithSchema<TactileFeaturesSchema>(envelope_codes, hex_codes);
 }
 
 void Message::WriteTemperature(float temperature_c) {
-  uint8_t bytes[4];
-  ::LittleEndianWriteF32(temperature_c, bytes);
-  SetTypeAndPayload(MessageType::kTemperature, Slice<uint8_t, 4>(bytes));
+  WriteWithSchema<SingleFloatSchema>(MessageType::kTemperature, temperature_c);
 }
 bool Message::ReadTemperature(float* temperature_c) const {
-  *temperature_c = ::LittleEndianReadF32(payload().data());
-  return true;
+  return ReadWithSchema<SingleFloatSchema>(temperature_c);
 }
 
 void Message::WriteBatteryVoltage(float voltage) {
-  uint8_t bytes[4];
-  ::LittleEndianWriteF32(voltage, bytes);
-  SetTypeAndPayload(MessageType::kBatteryVoltage, Slice<uint8_t, 4>(bytes));
+  WriteWithSchema<SingleFloatSchema>(MessageType::kBatteryVoltage, voltage);
 }
 bool Message::ReadBatteryVoltage(float* voltage) const {
-  *voltage = ::LittleEndianReadF32(payload().data());
-  return true;
+  return ReadWithSchema<SingleFloatSchema>(voltage);
+}
+
+void Message::WriteLatencyEstimate(float latency_ms) {
+  WriteWithSchema<SingleFloatSchema>(MessageType::kLatencyEstimate, latency_ms);
+}
+bool Message::ReadLatencyEstimate(float* latency_ms) const {
+  return ReadWithSchema<SingleFloatSchema>(latency_ms);
+}
+
+void Message::WriteJitterBufferStats(const JitterBufferStats& stats) {
+  WriteWithSchema<JitterBufferStatsSchema>(
+      MessageType::kJitterBufferStats, stats.latency_ms, stats.jitter_ms,
+      stats.target_depth, stats.num_underruns, stats.num_concealed_blocks,
+      stats.num_dropped_blocks);
+}
+bool Message::ReadJitterBufferStats(JitterBufferStats* stats) const {
+  return ReadWithSchema<JitterBufferStatsSchema>(
+      &stats->latency_ms, &stats->jitter_ms, &stats->target_depth,
+      &stats->num_underruns, &stats->num_concealed_blocks,
+      &stats->num_dropped_blocks);
+}
+
+void Message::WriteDeadlineStats(const DeadlineMonitorStats& stats) {
+  WriteWithSchema<DeadlineStatsSchema>(
+      MessageType::kDeadlineStats, stats.num_buffers, stats.num_overruns,
+      stats.num_near_misses, stats.mean_load, stats.max_load);
+}
+bool Message::ReadDeadlineStats(DeadlineMonitorStats* stats) const {
+  return ReadWithSchema<DeadlineStatsSchema>(
+      &stats->num_buffers, &stats->num_overruns, &stats->num_near_misses,
+      &stats->mean_load, &stats->max_load);
+}
+
+void Message::WriteEnergyStats(const EnergyMeterStats& stats) {
+  WriteWithSchema<EnergyStatsSchema>(
+      MessageType::kEnergyStats, stats.num_minutes, stats.cpu_active_fraction,
+      Slice<const float, kEnergyMeterMaxChannels>(stats.channel_power));
+}
+bool Message::ReadEnergyStats(EnergyMeterStats* stats) const {
+  return ReadWithSchema<EnergyStatsSchema>(
+      &stats->num_minutes, &stats->cpu_active_fraction,
+      Slice<float, kEnergyMeterMaxChannels>(stats->channel_power));
 }
 
 void Message::WriteSingleTactorSamples(
     int channel, Slice<const uint16_t, kNumPwmValues> samples) {
-  SetTypeAndPayload(static_cast<MessageType>(channel), samples.bytes());
+  WriteWithSchema<SingleTactorSamplesSchema>(
+      static_cast<MessageType>(channel), samples);
 }
 bool Message::ReadSingleTactorSamples(
     int* channel, Slice<uint16_t, kNumPwmValues> samples) const {
   *channel = static_cast<int>(type());
-  return samples.bytes().CopyFrom(payload());
+  return ReadWithSchema<SingleTactorSamplesSchema>(samples);
 }
 
 void Message::WriteAllTactorsSamples(
     Slice<const uint8_t, kNumTotalPwm * kNumPwmValues> samples) {
-  SetTypeAndPayload(MessageType::kAllTactorsSamples, samples);
+  WriteWithSchema<AllTactorsSamplesSchema>(MessageType::kAllTactorsSamples,
+                                           samples);
 }
 bool Message::ReadAllTactorsSamples(
       Slice<uint8_t, kNumTotalPwm * kNumPwmValues> samples) const {
-  return samples.CopyFrom(payload());
+  return ReadWithSchema<AllTactorsSamplesSchema>(samples);
+}
+
+void Message::WriteTimedTactorsSamples(
+    uint32_t presentation_us,
+    Slice<const uint8_t, kNumTotalPwm * kNumPwmValues> samples) {
+  WriteWithSchema<TimedTactorsSamplesSchema>(
+      MessageType::kTimedTactorsSamples, presentation_us, samples);
+}
+bool Message::ReadTimedTactorsSamples(
+    uint32_t* presentation_us,
+    Slice<uint8_t, kNumTotalPwm * kNumPwmValues> samples) const {
+  return ReadWithSchema<TimedTactorsSamplesSchema>(presentation_us, samples);
+}
+
+void Message::WriteClockSyncRequest(uint32_t t1) {
+  WriteWithSchema<ClockSyncRequestSchema>(MessageType::kClockSyncRequest, t1);
+}
+bool Message::ReadClockSyncRequest(uint32_t* t1) const {
+  return ReadWithSchema<ClockSyncRequestSchema>(t1);
+}
+
+void Message::WriteClockSyncResponse(uint32_t t1, uint32_t t2, uint32_t t3) {
+  WriteWithSchema<ClockSyncResponseSchema>(MessageType::kClockSyncResponse,
+                                           t1, t2, t3);
+}
+bool Message::ReadClockSyncResponse(uint32_t* t1, uint32_t* t2,
+                                    uint32_t* t3) const {
+  return ReadWithSchema<ClockSyncResponseSchema>(t1, t2, t3);
+}
+
+void Message::WriteAllTactorsSamplesCompressed(
+    Slice<const uint8_t, kNumTotalPwm * kNumPwmValues> samples) {
+  constexpr int kEncodedSize = TactileCodecEncodedSize(kNumTotalPwm);
+  TactileCodecEncode(samples.data(), kNumTotalPwm, bytes_ + kHeaderSize);
+  bytes_[3] = kEncodedSize;
+  set_type(MessageType::kAllTactorsSamplesCompressed);
+}
+bool Message::ReadAllTactorsSamplesCompressed(
+    Slice<uint8_t, kNumTotalPwm * kNumPwmValues> samples) const {
+  if (payload_size() != TactileCodecEncodedSize(kNumTotalPwm)) { return false; }
+  return TactileCodecDecode(payload().data(), kNumTotalPwm, samples.data());
+}
+
+void Message::WriteEnvelopeEvents(const uint8_t* events, int num_events) {
+  num_events = std_shim::min<int>(num_events, kMaxEnvelopeEventsPerMessage);
+  SetTypeAndPayload(MessageType::kEnvelopeEvents,
+                    Slice<const uint8_t>(events,
+                                         kEnvelopeEventBytes * num_events));
+}
+
+bool Message::ReadEnvelopeEvents(uint8_t* events, int* num_events) const {
+  const int size = payload_size();
+  if (size % kEnvelopeEventBytes != 0 ||
+      size > kMaxEnvelopeEventsPerMessage * kEnvelopeEventBytes) {
+    return false;
+  }
+  *num_events = size / kEnvelopeEventBytes;
+  return Slice<uint8_t>(events, size).CopyFrom(payload());
 }
 
 void Message::WriteTuning(const TuningKnobs& knobs) {
-  SetTypeAndPayload(MessageType::kTuning,
-                    Slice<const uint8_t, kNumTuningKnobs>(knobs.values));
+  WriteWithSchema<TuningSchema>(
+      MessageType::kTuning,
+      Slice<const uint8_t, kNumTuningKnobs>(knobs.values));
 }
 bool Message::ReadTuning(TuningKnobs* knobs) const {
-  return Slice<uint8_t, kNumTuningKnobs>(knobs->values).CopyFrom(payload());
+  return ReadWithSchema<TuningSchema>(
+      Slice<uint8_t, kNumTuningKnobs>(knobs->values));
 }
 
 void Message::WriteTactilePattern(const char* pattern) {
@@ -306,12 +530,17 @@ bool Message::ReadChannelGainUpdate(ChannelMap* channel_map,
 bool Message::ReadCalibrateTactor(ChannelMap* channel_map,
                                   int calibration_tactors[2],
                                   float* calibration_amplitude) const {
-  if (payload_size() != 4) { return false; }
-  const uint8_t* src = payload().data();
+  int tactors;
+  int gain_control_value;
+  uint16_t amplitude;
+  if (!ReadWithSchema<CalibrateTactorSchema>(&tactors, &gain_control_value,
+                                             &amplitude)) {
+    return false;
+  }
 
   // Read the two test channel indices.
-  calibration_tactors[0] = *src & 15;
-  calibration_tactors[1] = *src >> 4;
+  calibration_tactors[0] = tactors & 15;
+  calibration_tactors[1] = tactors >> 4;
 
   // validate that these indices are < channel_map->num_output_channels
   if (calibration_tactors[0] >= channel_map->num_output_channels ||
@@ -321,10 +550,10 @@ bool Message::ReadCalibrateTactor(ChannelMap* channel_map,
 
   // Read and set the new gain.
   channel_map->gains[calibration_tactors[1]] =
-      ChannelGainFromControlValue(*++src);
+      ChannelGainFromControlValue(gain_control_value);
 
   // Read playback amplitude, converting uint16 value to a float in [0, 1].
-  *calibration_amplitude = ::LittleEndianReadU16(++src) / 65535.0f;
+  *calibration_amplitude = amplitude / 65535.0f;
 
   return true;
 }
@@ -336,6 +565,36 @@ void Message::WriteStatsRecord(const EnvelopeTracker& envelope_tracker) {
   set_type(MessageType::kStatsRecord);
 }
 
+void Message::WriteEnvelopeLogEntries(const EnvelopeLogEntry* entries,
+                                      int num_entries) {
+  num_entries = std_shim::min<int>(num_entries,
+                                   kMaxEnvelopeLogEntriesPerMessage);
+  // Entries are serialized as in flash, a uint32 timestamp and the record.
+  uint8_t* dest = bytes_ + kHeaderSize;
+  for (int i = 0; i < num_entries; ++i, dest += kEnvelopeLogEntryBytes) {
+    ::LittleEndianWriteU32(entries[i].timestamp, dest);
+    memcpy(dest + 4, entries[i].record, kEnvelopeTrackerRecordBytes);
+  }
+  bytes_[3] = static_cast<uint8_t>(num_entries * kEnvelopeLogEntryBytes);
+  set_type(MessageType::kEnvelopeLogEntries);
+}
+
+bool Message::ReadEnvelopeLogEntries(EnvelopeLogEntry* entries,
+                                     int* num_entries) const {
+  const int size = payload_size();
+  if (size % kEnvelopeLogEntryBytes != 0 ||
+      size > kMaxEnvelopeLogEntriesPerMessage * kEnvelopeLogEntryBytes) {
+    return false;
+  }
+  *num_entries = size / kEnvelopeLogEntryBytes;
+  const uint8_t* src = bytes_ + kHeaderSize;
+  for (int i = 0; i < *num_entries; ++i, src += kEnvelopeLogEntryBytes) {
+    entries[i].timestamp = ::LittleEndianReadU32(src);
+    memcpy(entries[i].record, src + 4, kEnvelopeTrackerRecordBytes);
+  }
+  return true;
+}
+
 void Message::WriteDeviceName(const char* device_name) {
   const int length =
       std_shim::min<int>(kMaxDeviceNameLength, strlen(device_name));
@@ -355,15 +614,12 @@ bool Message::ReadDeviceName(char* device_name) const {
 }
 
 void Message::WriteFlashWriteStatus(int status) {
-  uint8_t status_byte[1];
-  status_byte[0] = static_cast<uint8_t>(status);
-  SetTypeAndPayload(MessageType::kFlashWriteStatus,
-                    Slice<uint8_t, 1>(status_byte));
+  WriteWithSchema<FlashWriteStatusSchema>(MessageType::kFlashWriteStatus,
+                                          status);
 }
 
 bool Message::ReadFlashWriteStatus(int* status) const {
-  *status = ::LittleEndianReadF32(payload().data());
-  return true;
+  return ReadWithSchema<FlashWriteStatusSchema>(status);
 }
 
 namespace {
@@ -472,4 +728,49 @@ bool Message::ReadTactileExPattern(Slice<uint8_t> pattern) const {
   return true;
 }
 
+void Message::WriteTactilePatternChunk(int id, int total_size, int offset,
+                                       const uint8_t* data, int data_size) {
+  data_size = std_shim::min<int>(data_size, kMaxTactilePatternChunkBytes);
+  uint8_t* dest = bytes_ + kHeaderSize;
+  dest[0] = static_cast<uint8_t>(id);
+  ::LittleEndianWriteU16(static_cast<uint16_t>(total_size), dest + 1);
+  ::LittleEndianWriteU16(static_cast<uint16_t>(offset), dest + 3);
+  if (data_size > 0) {
+    memcpy(dest + kTactilePatternChunkHeaderBytes, data, data_size);
+  }
+  bytes_[3] =
+      static_cast<uint8_t>(kTactilePatternChunkHeaderBytes + data_size);
+  set_type(MessageType::kTactilePatternChunk);
+}
+
+bool Message::ReadTactilePatternChunk(int* id, int* total_size, int* offset,
+                                      const uint8_t** data,
+                                      int* data_size) const {
+  const int size = payload_size();
+  if (size < kTactilePatternChunkHeaderBytes) { return false; }
+  const uint8_t* src = bytes_ + kHeaderSize;
+  *id = src[0];
+  *total_size = ::LittleEndianReadU16(src + 1);
+  *offset = ::LittleEndianReadU16(src + 3);
+  *data = src + kTactilePatternChunkHeaderBytes;
+  *data_size = size - kTactilePatternChunkHeaderBytes;
+  return true;
+}
+
+void Message::WritePlayTactilePattern(int id) {
+  WriteWithSchema<PlayTactilePatternSchema>(MessageType::kPlayTactilePattern,
+                                            id);
+}
+bool Message::ReadPlayTactilePattern(int* id) const {
+  return ReadWithSchema<PlayTactilePatternSchema>(id);
+}
+
+void Message::WriteTactilePatternUploadStatus(int id, int status) {
+  WriteWithSchema<TactilePatternUploadStatusSchema>(
+      MessageType::kTactilePatternUploadStatus, id, status);
+}
+bool Message::ReadTactilePatternUploadStatus(int* id, int* status) const {
+  return ReadWithSchema<TactilePatternUploadStatusSchema>(id, status);
+}
+
 }  // namespace audio_tactile
@@ -29,9 +29,15 @@
 #include <stdint.h>
 
 #include "cpp/constants.h"
+#include "cpp/jitter_buffer.h"
+#include "cpp/message_schema.h"
 #include "cpp/slice.h"
 #include "cpp/settings.h"
 #include "dsp/channel_map.h"
+#include "tactile/deadline_monitor.h"
+#include "tactile/energy_meter.h"
+#include "tactile/envelope_events.h"
+#include "tactile/envelope_log.h"
 #include "tactile/envelope_tracker.h"
 #include "tactile/tuning.h"
 
@@ -78,6 +84,22 @@ enum class MessageType {
   kGetOnConnectionBatch = 34,
   kCalibrateTactor = 35,
   kTactileExPattern = 36,
+  kLatencyEstimate = 37,
+  kJitterBufferStats = 38,
+  kAllTactorsSamplesCompressed = 39,
+  kDeadlineStats = 40,
+  kEnvelopeLogEntries = 41,
+  kGetEnvelopeLog = 42,
+  kEnvelopeEvents = 43,
+  kAudioSamplesLowRate = 44,
+  kTactileFeatures = 45,
+  kClockSyncRequest = 46,
+  kClockSyncResponse = 47,
+  kTimedTactorsSamples = 48,
+  kTactilePatternChunk = 49,
+  kPlayTactilePattern = 50,
+  kTactilePatternUploadStatus = 51,
+  kEnergyStats = 52,
 };
 
 // Recipients of messages.
@@ -122,6 +144,12 @@ class Message {
   // Verifies the checksum for a message with BLE header. Returns true if valid.
   bool VerifyChecksum();
 
+  // Copies a message with BLE header from `data`, computing the checksum in the
+  // same pass as the copy. The caller must check that `data` has
+  // kHeaderSize + data[3] bytes, and data[3] <= kMaxPayloadSize. Returns true
+  // if the checksum is valid.
+  bool CopyAndVerifyChecksum(const uint8_t* data);
+
   // The message recipient. Note, this field is only valid if it has been set
   // with SetHeader().
   MessageRecipient recipient() const {
@@ -158,6 +186,27 @@ class Message {
   // Reads the samples from a kAudioSamples message.
   bool ReadAudioSamples(Slice<int16_t, kAdcDataSize> samples) const;
 
+  // Writes a kAudioSamplesLowRate message of int16 audio samples downsampled
+  // by 2 and fricative energy codes, as produced by LowRateStreamEncode().
+  void WriteAudioSamplesLowRate(
+      Slice<const int16_t, kLowRateAudioDataSize> samples,
+      Slice<const uint8_t, kLowRateAudioNumCodes> codes);
+  // Reads the samples and codes from a kAudioSamplesLowRate message.
+  bool ReadAudioSamplesLowRate(
+      Slice<int16_t, kLowRateAudioDataSize> samples,
+      Slice<uint8_t, kLowRateAudioNumCodes> codes) const;
+
+  // Writes a kTactileFeatures message of Enveloper output codes and vowel hex
+  // weight codes for one buffer, as produced by TactileFeaturesEncode(), for
+  // the puck to offload processing from the sleeve.
+  void WriteTactileFeatures(
+      Slice<const uint8_t, kTactileFeaturesNumEnvelopeCodes> envelope_codes,
+      Slice<const uint8_t, kTactileFeaturesNumHexCodes> hex_codes);
+  // Reads the codes from a kTactileFeatures message.
+  bool ReadTactileFeatures(
+      Slice<uint8_t, kTactileFeaturesNumEnvelopeCodes> envelope_codes,
+      Slice<uint8_t, kTactileFeaturesNumHexCodes> hex_codes) const;
+
   // Writes a kTemperature message to send thermistor temperature measurement.
   void WriteTemperature(float temperature_c);
   // Reads the temperature from a kTemperature message.
@@ -168,6 +217,30 @@ class Message {
   // Reads the voltage from a kBatteryVoltage message.
   bool ReadBatteryVoltage(float* voltage) const;
 
+  // Writes a kLatencyEstimate message to send the estimated end-to-end latency
+  // in milliseconds from mic input to tactor output.
+  void WriteLatencyEstimate(float latency_ms);
+  // Reads the latency in milliseconds from a kLatencyEstimate message.
+  bool ReadLatencyEstimate(float* latency_ms) const;
+
+  // Writes a kJitterBufferStats message to send streaming latency and underrun
+  // statistics from a JitterBuffer.
+  void WriteJitterBufferStats(const JitterBufferStats& stats);
+  // Reads stats from a kJitterBufferStats message.
+  bool ReadJitterBufferStats(JitterBufferStats* stats) const;
+
+  // Writes a kDeadlineStats message to send processing overrun and CPU load
+  // statistics from a DeadlineMonitor.
+  void WriteDeadlineStats(const DeadlineMonitorStats& stats);
+  // Reads stats from a kDeadlineStats message.
+  bool ReadDeadlineStats(DeadlineMonitorStats* stats) const;
+
+  // Writes a kEnergyStats message to send the per-minute tactor drive power and
+  // CPU active time from an EnergyMeter.
+  void WriteEnergyStats(const EnergyMeterStats& stats);
+  // Reads stats from a kEnergyStats message.
+  bool ReadEnergyStats(EnergyMeterStats* stats) const;
+
   // Writes a kTactor*Samples message, where `channel` is a one-based channel
   // index and `samples` is an array of PWM samples.
   void WriteSingleTactorSamples(
@@ -186,6 +259,50 @@ class Message {
   bool ReadAllTactorsSamples(
       Slice<uint8_t, kNumTotalPwm * kNumPwmValues> samples) const;
 
+  // Writes a kAllTactorsSamplesCompressed message, with the same samples as
+  // kAllTactorsSamples encoded with the lossy codec in cpp/tactile_codec.h.
+  // The payload is 60 bytes rather than 96.
+  void WriteAllTactorsSamplesCompressed(
+      Slice<const uint8_t, kNumTotalPwm * kNumPwmValues> samples);
+  // Reads and decodes the samples from a kAllTactorsSamplesCompressed message.
+  bool ReadAllTactorsSamplesCompressed(
+      Slice<uint8_t, kNumTotalPwm * kNumPwmValues> samples) const;
+
+  // Writes a kTimedTactorsSamples message, with the same samples as
+  // kAllTactorsSamples and the time in microseconds on the sender's clock at
+  // which to present them, for synchronized playback on multiple devices (see
+  // cpp/clock_sync.h and cpp/timed_playout.h).
+  void WriteTimedTactorsSamples(
+      uint32_t presentation_us,
+      Slice<const uint8_t, kNumTotalPwm * kNumPwmValues> samples);
+  // Reads the presentation time and samples from a kTimedTactorsSamples
+  // message.
+  bool ReadTimedTactorsSamples(
+      uint32_t* presentation_us,
+      Slice<uint8_t, kNumTotalPwm * kNumPwmValues> samples) const;
+
+  // Writes a kClockSyncRequest message with the sender's local time `t1` in
+  // microseconds, see cpp/clock_sync.h.
+  void WriteClockSyncRequest(uint32_t t1);
+  // Reads a kClockSyncRequest message.
+  bool ReadClockSyncRequest(uint32_t* t1) const;
+
+  // Writes a kClockSyncResponse message replying to a kClockSyncRequest with
+  // its `t1` and the responder's times `t2` of receiving the request and `t3`
+  // of sending the response.
+  void WriteClockSyncResponse(uint32_t t1, uint32_t t2, uint32_t t3);
+  // Reads a kClockSyncResponse message.
+  bool ReadClockSyncResponse(uint32_t* t1, uint32_t* t2, uint32_t* t3) const;
+
+  // Writes a kEnvelopeEvents message of up to kMaxEnvelopeEventsPerMessage
+  // (= 64) amplitude keyframe events from an EnvelopeEventEncoder, for
+  // streaming tactile amplitudes at a fraction of the bandwidth of
+  // kAllTactorsSamples (see tactile/envelope_events.h).
+  void WriteEnvelopeEvents(const uint8_t* events, int num_events);
+  // Reads a kEnvelopeEvents message. `events` must have space for
+  // kEnvelopeEventBytes * kMaxEnvelopeEventsPerMessage bytes.
+  bool ReadEnvelopeEvents(uint8_t* events, int* num_events) const;
+
   // Writes kTuning message of settings for all tuning knobs.
   void WriteTuning(const TuningKnobs& knobs);
   // Reads the tuning knobs from a kTuning message.
@@ -231,6 +348,17 @@ class Message {
   // Writes a kStatsRecord message.
   void WriteStatsRecord(const EnvelopeTracker& envelope_tracker);
 
+  // Writes a kEnvelopeLogEntries message of up to
+  // kMaxEnvelopeLogEntriesPerMessage (= 7) timestamped records from an
+  // EnvelopeLog, for bulk download of the log in reply to kGetEnvelopeLog. A
+  // message with zero entries marks the end of the download.
+  void WriteEnvelopeLogEntries(const EnvelopeLogEntry* entries,
+                               int num_entries);
+  // Reads a kEnvelopeLogEntries message. `entries` must have space for
+  // kMaxEnvelopeLogEntriesPerMessage entries.
+  bool ReadEnvelopeLogEntries(EnvelopeLogEntry* entries,
+                              int* num_entries) const;
+
   // Writes a kDeviceName message. `device_name` must be a string with
   // length <= kMaxDeviceNameLength (= 16), not counting the null terminator.
   void WriteDeviceName(const char* device_name);
@@ -269,6 +397,31 @@ class Message {
   // Reads the extended-format pattern from a kTactileExPattern message.
   bool ReadTactileExPattern(Slice<uint8_t> pattern) const;
 
+  // Writes a kTactilePatternChunk message with `data_size` bytes, at most
+  // kMaxTactilePatternChunkBytes (= 123), at byte `offset` of an
+  // extended-format pattern of `total_size` bytes to store in the pattern
+  // library as `id`, see tactile/tactile_pattern_library.h. The End op is not
+  // sent.
+  void WriteTactilePatternChunk(int id, int total_size, int offset,
+                                const uint8_t* data, int data_size);
+  // Reads a kTactilePatternChunk message. `data` is set to point into the
+  // message payload.
+  bool ReadTactilePatternChunk(int* id, int* total_size, int* offset,
+                               const uint8_t** data, int* data_size) const;
+
+  // Writes a kPlayTactilePattern message to play pattern `id` from the pattern
+  // library.
+  void WritePlayTactilePattern(int id);
+  // Reads a kPlayTactilePattern message.
+  bool ReadPlayTactilePattern(int* id) const;
+
+  // Writes a kTactilePatternUploadStatus message, sent by the device when an
+  // upload to the pattern library completes or fails. `status` is a
+  // kTactilePatternLibrary* status code.
+  void WriteTactilePatternUploadStatus(int id, int status);
+  // Reads a kTactilePatternUploadStatus message.
+  bool ReadTactilePatternUploadStatus(int* id, int* status) const;
+
   // For the following messages, the payload is empty and are read simply by
   // checking `type()`.
 
@@ -299,6 +452,11 @@ class Message {
     SetTypeAndPayload(MessageType::kGetDeviceName, {});
   }
 
+  // Writes kGetEnvelopeLog message request to download the envelope log.
+  void WriteGetEnvelopeLog() {
+    SetTypeAndPayload(MessageType::kGetEnvelopeLog, {});
+  }
+
   // Writes a kStreamDataStart message.
   void WriteStreamDataStart() {
     SetTypeAndPayload(MessageType::kStreamDataStart, {});
@@ -317,6 +475,28 @@ class Message {
     set_payload(payload);
   }
 
+  // Sets the type and a payload of `values` encoded according to `Schema`, a
+  // MessageSchema (see message_schema.h).
+  template <typename Schema, typename... Values>
+  void WriteWithSchema(MessageType type, Values... values) {
+    // Cast to int, since the enums are of different types.
+    static_assert(static_cast<int>(Schema::kPayloadSize) <=
+                      static_cast<int>(kMaxPayloadSize),
+                  "Payload size must be less than kMaxPayloadSize");
+    Schema::Write(bytes_ + kHeaderSize, values...);
+    bytes_[3] = static_cast<uint8_t>(Schema::kPayloadSize);
+    set_type(type);
+  }
+
+  // Reads the payload to `outputs` according to `Schema`. Returns false if the
+  // payload size doesn't match the schema.
+  template <typename Schema, typename... Outputs>
+  bool ReadWithSchema(Outputs... outputs) const {
+    if (payload_size() != Schema::kPayloadSize) { return false; }
+    Schema::Read(bytes_ + kHeaderSize, outputs...);
+    return true;
+  }
+
   uint16_t ComputeChecksum() const;
 
   uint8_t bytes_[kHeaderSize + kMaxPayloadSize];
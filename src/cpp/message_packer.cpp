@@ -0,0 +1,77 @@
+// Copyright 2022 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "cpp/message_packer.h"
+
+#include <string.h>
+
+#include "cpp/std_shim.h"
+
+namespace audio_tactile {
+
+// A message larger than the capacity is accepted in an empty packet, so the
+// buffer must hold the largest message.
+static_assert(static_cast<int>(MessagePacker::kMaxPacketSize) >=
+                  static_cast<int>(Message::kMaxMessageSize),
+              "Packet buffer must hold the largest message");
+
+MessagePacker::MessagePacker()
+    : size_(0),
+      num_messages_(0),
+      capacity_(kDefaultAttMtu - kAttHeaderSize) {}
+
+void MessagePacker::SetAttMtu(int att_mtu) {
+  capacity_ = std_shim::min<int>(
+      std_shim::max<int>(att_mtu, kDefaultAttMtu) - kAttHeaderSize,
+      kMaxPacketSize);
+}
+
+bool MessagePacker::Append(const Message& message) {
+  const int message_size = message.size();
+  if (size_ > 0 && size_ + message_size > capacity_) {
+    return false;
+  }
+  memcpy(bytes_ + size_, message.data(), message_size);
+  size_ += message_size;
+  ++num_messages_;
+  return true;
+}
+
+bool MessageUnpacker::Next(Message* message) {
+  constexpr int kHeaderSize = Message::kHeaderSize;
+  if (error_ || remaining_ == 0) {
+    return false;
+  }
+
+  const int payload_size = (remaining_ >= kHeaderSize) ? data_[3] : 0;
+  const int message_size = kHeaderSize + payload_size;
+  if (remaining_ < kHeaderSize ||
+      data_[2] < 1 ||  // Check type field.
+      payload_size > Message::kMaxPayloadSize ||  // Check size field.
+      remaining_ < message_size) {
+    error_ = true;
+    return false;
+  }
+
+  const bool valid = message->CopyAndVerifyChecksum(data_);
+  data_ += message_size;
+  remaining_ -= message_size;
+  if (!valid) {
+    error_ = true;
+    return false;
+  }
+  return true;
+}
+
+}  // namespace audio_tactile
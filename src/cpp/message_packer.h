@@ -0,0 +1,124 @@
+// Copyright 2022 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+// Packing of multiple Messages into one BLE packet.
+//
+// Each BLE notification or write has a fixed cost of a connection event slot,
+// so sending one Message per packet wastes most of the packet when the ATT MTU
+// is large. For instance, a kAllTactorsSamples message is 100 bytes, while with
+// the nRF52's max ATT MTU of 247 a packet holds 244 bytes.
+//
+// Messages with BLE header are self-delimiting, since the header has the
+// payload size, so a packet is simply the concatenation of whole messages:
+//
+//   [message 1: checksum, type, size, payload][message 2: ...]...
+//
+// A packet holding a single message is the same as before packing was added,
+// so unpacking is backward compatible with unpacked senders.
+//
+// Example use:
+//   MessagePacker packer;
+//   packer.SetAttMtu(negotiated_mtu);
+//   message.SetBleHeader();
+//   if (!packer.Append(message)) {  // Packet is full.
+//     Send(packer.packet());
+//     packer.Clear();
+//     packer.Append(message);
+//   }
+//
+//   MessageUnpacker unpacker(received_bytes, num_received_bytes);
+//   Message message;
+//   while (unpacker.Next(&message)) {
+//     HandleMessage(message);
+//   }
+//   if (unpacker.error()) { /* Invalid message in the packet. */ }
+
+#ifndef AUDIO_TO_TACTILE_SRC_CPP_MESSAGE_PACKER_H_
+#define AUDIO_TO_TACTILE_SRC_CPP_MESSAGE_PACKER_H_
+
+#include <stdint.h>
+
+#include "cpp/message.h"
+#include "cpp/slice.h"
+
+namespace audio_tactile {
+
+class MessagePacker {
+ public:
+  enum {
+    // Number of bytes of ATT overhead per packet (opcode and handle).
+    kAttHeaderSize = 3,
+    // ATT MTU without negotiation, as defined by the BLE spec.
+    kDefaultAttMtu = 23,
+    // Max ATT MTU supported by the nRF52 SoftDevice.
+    kMaxAttMtu = 247,
+    // Max number of bytes in a packet.
+    kMaxPacketSize = kMaxAttMtu - kAttHeaderSize,
+  };
+
+  MessagePacker();
+
+  // Sets the packet capacity from the negotiated ATT MTU. The capacity is
+  // `att_mtu - kAttHeaderSize`, limited to kMaxPacketSize.
+  void SetAttMtu(int att_mtu);
+
+  // Appends `message` to the packet. The message must have its BLE header set
+  // with SetBleHeader(). Returns false, leaving the packet unchanged, if the
+  // packet is nonempty and lacks space for the message. A message larger than
+  // the capacity is accepted in an empty packet, to be sent alone and
+  // fragmented by the BLE stack as without packing.
+  bool Append(const Message& message);
+
+  // Clears the packet.
+  void Clear() { size_ = 0; num_messages_ = 0; }
+
+  // The packed bytes.
+  Slice<const uint8_t> packet() const { return {bytes_, size_}; }
+  bool empty() const { return size_ == 0; }
+  int num_messages() const { return num_messages_; }
+  int capacity() const { return capacity_; }
+
+ private:
+  uint8_t bytes_[kMaxPacketSize];
+  int size_;
+  int num_messages_;
+  int capacity_;
+};
+
+class MessageUnpacker {
+ public:
+  // Constructs an unpacker to read messages from `data`. The data must outlive
+  // the unpacker.
+  MessageUnpacker(const uint8_t* data, int size)
+      : data_(data), remaining_(size), error_(false) {}
+
+  // Reads the next message into `message`. Returns true on success. Returns
+  // false at the end of the packet, or if the next message is truncated or
+  // fails its checksum, in which case error() is true and the rest of the
+  // packet is skipped.
+  bool Next(Message* message);
+
+  // Whether an invalid message was found.
+  bool error() const { return error_; }
+
+ private:
+  const uint8_t* data_;
+  int remaining_;
+  bool error_;
+};
+
+}  // namespace audio_tactile
+
+#endif  // AUDIO_TO_TACTILE_SRC_CPP_MESSAGE_PACKER_H_
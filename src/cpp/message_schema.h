@@ -0,0 +1,150 @@
+// Copyright 2022 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+// Compile-time schemas for fixed-layout Message payloads.
+//
+// A MessageSchema lists the fields of a payload once, in wire order. From that
+// list the templates generate the encoder, the decoder, and the payload size as
+// a compile-time constant, so that the size check when reading is a single
+// comparison and field offsets are constants:
+//
+//   using TemperatureSchema = MessageSchema<F32Field>;
+//   static_assert(TemperatureSchema::kPayloadSize == 4, "");
+//
+//   uint8_t payload[TemperatureSchema::kPayloadSize];
+//   TemperatureSchema::Write(payload, 12.3f);
+//   float temperature_c;
+//   TemperatureSchema::Read(payload, &temperature_c);
+//
+// A field type `F` has a byte size `F::kSize` and static functions
+// `F::Write(value, dest)` and `F::Read(src, output)`. Multibyte numbers are
+// little endian, as with the functions in dsp/serialize.h. Schemas only apply
+// to payloads whose layout doesn't depend on the data; variable-length
+// messages like kChannelMap are encoded by hand in message.cpp.
+
+#ifndef AUDIO_TO_TACTILE_SRC_CPP_MESSAGE_SCHEMA_H_
+#define AUDIO_TO_TACTILE_SRC_CPP_MESSAGE_SCHEMA_H_
+
+#include <stdint.h>
+#include <string.h>
+
+#include "cpp/slice.h"
+#include "cpp/std_shim.h"
+#include "dsp/serialize.h"
+
+namespace audio_tactile {
+
+// A float, 4 bytes.
+struct F32Field {
+  enum { kSize = 4 };
+  static void Write(float value, uint8_t* dest) {
+    ::LittleEndianWriteF32(value, dest);
+  }
+  static void Read(const uint8_t* src, float* output) {
+    *output = ::LittleEndianReadF32(src);
+  }
+};
+
+// A uint32, 4 bytes.
+struct U32Field {
+  enum { kSize = 4 };
+  static void Write(uint32_t value, uint8_t* dest) {
+    ::LittleEndianWriteU32(value, dest);
+  }
+  static void Read(const uint8_t* src, uint32_t* output) {
+    *output = ::LittleEndianReadU32(src);
+  }
+};
+
+// A uint16, 2 bytes.
+struct U16Field {
+  enum { kSize = 2 };
+  static void Write(uint16_t value, uint8_t* dest) {
+    ::LittleEndianWriteU16(value, dest);
+  }
+  static void Read(const uint8_t* src, uint16_t* output) {
+    *output = ::LittleEndianReadU16(src);
+  }
+};
+
+// An int stored in 1 byte. Values are truncated to the low 8 bits.
+struct U8Field {
+  enum { kSize = 1 };
+  static void Write(int value, uint8_t* dest) {
+    dest[0] = static_cast<uint8_t>(value);
+  }
+  static void Read(const uint8_t* src, int* output) { *output = src[0]; }
+};
+
+// An int stored in 1 byte. Values are saturated to [0, 255].
+struct SaturatedU8Field {
+  enum { kSize = 1 };
+  static void Write(int value, uint8_t* dest) {
+    dest[0] = static_cast<uint8_t>(
+        std_shim::min<int>(std_shim::max<int>(value, 0), 255));
+  }
+  static void Read(const uint8_t* src, int* output) { *output = src[0]; }
+};
+
+// An array of kNum elements of trivially-copyable type T, copied as raw bytes.
+template <typename T, int kNum>
+struct ArrayField {
+  enum { kSize = kNum * static_cast<int>(sizeof(T)) };
+  static void Write(Slice<const T, kNum> value, uint8_t* dest) {
+    memcpy(dest, value.data(), kSize);
+  }
+  static void Read(const uint8_t* src, Slice<T, kNum> output) {
+    memcpy(output.data(), src, kSize);
+  }
+};
+
+// Schema of a payload consisting of `Fields` in order.
+template <typename... Fields> struct MessageSchema;
+
+template <>
+struct MessageSchema<> {  // Base case, the empty schema.
+  enum { kPayloadSize = 0 };
+  static void Write(uint8_t* /*dest*/) {}
+  static void Read(const uint8_t* /*src*/) {}
+};
+
+template <typename Field, typename... Rest>
+struct MessageSchema<Field, Rest...> {
+  enum { kPayloadSize = Field::kSize + MessageSchema<Rest...>::kPayloadSize };
+
+  // Writes `values`, one per field, to `dest`, which must have space for
+  // kPayloadSize bytes.
+  template <typename Value, typename... Values>
+  static void Write(uint8_t* dest, Value value, Values... values) {
+    static_assert(sizeof...(Values) == sizeof...(Rest),
+                  "Number of values must match number of fields");
+    Field::Write(value, dest);
+    MessageSchema<Rest...>::Write(dest + Field::kSize, values...);
+  }
+
+  // Reads fields from `src` to `outputs`, one per field. The caller should
+  // check beforehand that the payload has kPayloadSize bytes.
+  template <typename Output, typename... Outputs>
+  static void Read(const uint8_t* src, Output output, Outputs... outputs) {
+    static_assert(sizeof...(Outputs) == sizeof...(Rest),
+                  "Number of outputs must match number of fields");
+    Field::Read(src, output);
+    MessageSchema<Rest...>::Read(src + Field::kSize, outputs...);
+  }
+};
+
+}  // namespace audio_tactile
+
+#endif  // AUDIO_TO_TACTILE_SRC_CPP_MESSAGE_SCHEMA_H_
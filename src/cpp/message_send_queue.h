@@ -0,0 +1,143 @@
+// Copyright 2022 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+// MessageSendQueue, a queue of outgoing Messages with completion callbacks.
+//
+// With a single tx_message, a producer must wait until the message is sent
+// before writing the next one, or it risks overwriting the message in flight.
+// MessageSendQueue instead holds a fixed number of Message slots. A producer
+// writes a message in place in a free slot and returns immediately, and the
+// transport drains the queue in order when it is ready, calling an optional
+// completion function for each message once it is sent or dropped:
+//
+//   MessageSendQueue<8> queue;
+//
+//   // Producer, e.g. the audio loop:
+//   Message* message = queue.BeginSend();
+//   if (message) {  // nullptr if all slots are in use.
+//     message->WriteBatteryVoltage(battery_v);
+//     queue.EndSend(OnBatterySent, &battery_state);
+//   }
+//
+//   // Consumer, e.g. the transport in the main loop:
+//   Message* message = queue.Front();
+//   if (message && Transmit(message)) {
+//     queue.Complete(MessageSendStatus::kSent);
+//   }
+//
+// The completion function gets the opaque `context` pointer given to
+// EndSend(), so that on a host the caller may resume a coroutine or fulfill a
+// promise from it. It runs in the consumer's context after the slot has been
+// released.
+//
+// Like SpscRingBuffer, which holds the slots, there must be a single producer
+// context and a single consumer context, which may be an interrupt handler.
+
+#ifndef AUDIO_TO_TACTILE_SRC_CPP_MESSAGE_SEND_QUEUE_H_
+#define AUDIO_TO_TACTILE_SRC_CPP_MESSAGE_SEND_QUEUE_H_
+
+#include "cpp/message.h"
+#include "cpp/spsc_ring_buffer.h"
+
+namespace audio_tactile {
+
+enum class MessageSendStatus {
+  kSent,     // Message was handed to the transport.
+  kDropped,  // Message was discarded, e.g. because of a disconnection.
+};
+
+// Function called when a queued message completes.
+using MessageSendDoneFun = void (*)(void* context, MessageSendStatus status);
+
+template <int kCapacity_>
+class MessageSendQueue {
+ public:
+  enum { kCapacity = kCapacity_ };
+
+  MessageSendQueue() = default;
+  MessageSendQueue(const MessageSendQueue&) = delete;  // No copying.
+  MessageSendQueue& operator=(const MessageSendQueue&) = delete;
+
+  // Number of queued messages.
+  int size() const noexcept { return entries_.size(); }
+  bool empty() const noexcept { return entries_.empty(); }
+  bool full() const noexcept { return entries_.full(); }
+
+  // Producer: Gets a free Message slot to write in place, or nullptr if the
+  // queue is full. The message is not queued until EndSend() is called.
+  Message* BeginSend() noexcept {
+    Entry* entry = entries_.BeginPush();
+    return entry ? &entry->message : nullptr;
+  }
+
+  // Producer: Queues the message obtained from BeginSend(). If nonnull,
+  // `done_fun(context, status)` is called when the message completes.
+  void EndSend(MessageSendDoneFun done_fun = nullptr,
+               void* context = nullptr) noexcept {
+    Entry* entry = entries_.BeginPush();
+    entry->done_fun = done_fun;
+    entry->context = context;
+    entries_.EndPush();
+  }
+
+  // Producer: Copies `message` into the queue. Returns false if the queue is
+  // full, in which case the message is dropped and `done_fun` is not called.
+  bool Send(const Message& message, MessageSendDoneFun done_fun = nullptr,
+            void* context = nullptr) {
+    Message* slot = BeginSend();
+    if (slot == nullptr) { return false; }
+    *slot = message;
+    EndSend(done_fun, context);
+    return true;
+  }
+
+  // Consumer: Gets the oldest queued message, or nullptr if the queue is
+  // empty. The transport may modify it in place, e.g. to set the header. It
+  // stays valid until Complete().
+  Message* Front() noexcept {
+    Entry* entry = entries_.Front();
+    return entry ? &entry->message : nullptr;
+  }
+
+  // Consumer: Removes the front message and calls its completion function
+  // with `status`. Must only be called when the queue is nonempty.
+  void Complete(MessageSendStatus status) {
+    const Entry* entry = entries_.Front();
+    const MessageSendDoneFun done_fun = entry->done_fun;
+    void* context = entry->context;
+    entries_.PopFront();
+    if (done_fun) { done_fun(context, status); }
+  }
+
+  // Consumer: Completes all queued messages with kDropped.
+  void DropAll() {
+    while (!entries_.empty()) {
+      Complete(MessageSendStatus::kDropped);
+    }
+  }
+
+ private:
+  struct Entry {
+    Message message;
+    MessageSendDoneFun done_fun;
+    void* context;
+  };
+
+  SpscRingBuffer<Entry, kCapacity> entries_;
+};
+
+}  // namespace audio_tactile
+
+#endif  // AUDIO_TO_TACTILE_SRC_CPP_MESSAGE_SEND_QUEUE_H_
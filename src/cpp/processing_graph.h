@@ -0,0 +1,319 @@
+// Copyright 2022 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+// ProcessingGraph, a chain of processing nodes with planned buffers.
+//
+// Apps wire TactileProcessor, PostProcessor, ChannelMap, and so on in sequence,
+// each with its own output buffer. ProcessingGraph instead has each node
+// declare the shape of its input and output, meaning the number of channels,
+// frames per block, and sample rate, and whether it can process in place.
+// Init() checks that the shapes match between consecutive nodes and plans the
+// buffers:
+//
+//  * In-place nodes, like PostProcessor, write over their input, so no buffer
+//    or copy is needed for their output.
+//
+//  * Other nodes alternate between two buffers in a pool that is a member
+//    array, each sized for the largest block it holds. A chain of any length
+//    then needs at most two buffers.
+//
+//  * The first node reads the caller's input directly, and ProcessSamples()
+//    returns a pointer to the last node's output instead of copying. The only
+//    copy is when the first node is in place, since the input is const.
+//
+// Planning happens once in Init(). Nothing is allocated, at init or at run
+// time, so this is suitable for firmware. Declare the graph as a global or
+// static, with `kPoolFloats` large enough for the plan; if not, Init() fails
+// and prints the required size.
+//
+// Nodes are GraphNode structs, a function pointer with a state pointer, so
+// that existing C objects plug in without wrappers or virtual functions. The
+// Make*Node() functions below make nodes for TactileProcessor, PostProcessor,
+// and ChannelMap. The node state must outlive the graph.
+//
+// Example use:
+//
+//   ProcessingGraph<4, 512> graph;
+//   graph.Add(MakeTactileProcessorNode(tactile_processor, 16000.0f));
+//   graph.Add(MakePostProcessorNode(&post_processor, output_frames,
+//                                   output_sample_rate_hz));
+//   graph.Add(MakeChannelMapNode(&channel_map, output_frames));
+//   if (!graph.Init()) { /* Error. */ }
+//
+//   // Processing loop.
+//   while (...) {
+//     const float* output = graph.ProcessSamples(input);
+//   }
+
+#ifndef AUDIO_TO_TACTILE_SRC_CPP_PROCESSING_GRAPH_H_
+#define AUDIO_TO_TACTILE_SRC_CPP_PROCESSING_GRAPH_H_
+
+#include <stdio.h>
+#include <string.h>
+
+#include "dsp/channel_map.h"
+#include "tactile/post_processor.h"
+#include "tactile/tactile_processor.h"
+
+namespace audio_tactile {
+
+struct GraphNode {
+  // Processes one block, reading `num_input_channels * input_frames`
+  // interleaved samples from `input` and writing `num_output_channels *
+  // output_frames` to `output`. `num_frames` is `input_frames`. If `in_place`
+  // is true, `output == input`.
+  void (*process)(void* state, const float* input, int num_frames,
+                  float* output);
+  void* state;
+  int num_input_channels;
+  int input_frames;
+  int num_output_channels;
+  int output_frames;
+  // Sample rates in Hz, or 0 if the node works at any rate, in which case its
+  // output has the same rate as its input. For a rate-changing node, set both.
+  float input_sample_rate_hz;
+  float output_sample_rate_hz;
+  // Whether the node may process in place. This requires that the output is
+  // no larger than the input.
+  bool in_place;
+
+  int input_size() const { return num_input_channels * input_frames; }
+  int output_size() const { return num_output_channels * output_frames; }
+};
+
+template <int kMaxNodes_, int kPoolFloats_>
+class ProcessingGraph {
+ public:
+  enum {
+    kMaxNodes = kMaxNodes_,
+    kPoolFloats = kPoolFloats_,
+  };
+
+  static_assert(kMaxNodes > 0, "kMaxNodes must be positive");
+  static_assert(kPoolFloats > 0, "kPoolFloats must be positive");
+
+  ProcessingGraph() noexcept: num_nodes_(0), ready_(false) {}
+  ProcessingGraph(const ProcessingGraph&) = delete;  // No copying.
+  ProcessingGraph& operator=(const ProcessingGraph&) = delete;
+
+  // Appends `node` to the chain. Returns false if there are already kMaxNodes
+  // nodes. Init() must be called after adding nodes.
+  bool Add(const GraphNode& node) {
+    ready_ = false;
+    if (num_nodes_ >= kMaxNodes) {
+      fprintf(stderr, "Error: ProcessingGraph: More than kMaxNodes = %d.\n",
+              kMaxNodes);
+      return false;
+    }
+    nodes_[num_nodes_++] = node;
+    return true;
+  }
+
+  // Checks the node shapes and plans buffers. Returns true on success.
+  bool Init() {
+    ready_ = false;
+    if (num_nodes_ == 0) {
+      fprintf(stderr, "Error: ProcessingGraph: No nodes.\n");
+      return false;
+    }
+    float rate_hz = 0.0f;
+    for (int i = 0; i < num_nodes_; ++i) {
+      const GraphNode& node = nodes_[i];
+      if (node.process == nullptr || node.input_size() <= 0 ||
+          node.output_size() <= 0 ||
+          (node.in_place && node.output_size() > node.input_size())) {
+        fprintf(stderr, "Error: ProcessingGraph: Invalid node %d.\n", i);
+        return false;
+      }
+      if (i > 0 && (node.num_input_channels !=
+                        nodes_[i - 1].num_output_channels ||
+                    node.input_frames != nodes_[i - 1].output_frames)) {
+        fprintf(stderr, "Error: ProcessingGraph: Node %d input (%d channels, "
+                "%d frames) doesn't match node %d output (%d channels, "
+                "%d frames).\n", i, node.num_input_channels,
+                node.input_frames, i - 1, nodes_[i - 1].num_output_channels,
+                nodes_[i - 1].output_frames);
+        return false;
+      }
+      // Rate-agnostic nodes pass through the rate of the previous node.
+      if (node.input_sample_rate_hz > 0.0f && rate_hz > 0.0f &&
+          node.input_sample_rate_hz != rate_hz) {
+        fprintf(stderr, "Error: ProcessingGraph: Node %d input rate %g Hz "
+                "doesn't match node %d output rate %g Hz.\n", i,
+                node.input_sample_rate_hz, i - 1, rate_hz);
+        return false;
+      }
+      if (node.output_sample_rate_hz > 0.0f) {
+        rate_hz = node.output_sample_rate_hz;
+      } else if (node.input_sample_rate_hz > 0.0f) {
+        rate_hz = node.input_sample_rate_hz;
+      }
+    }
+
+    // Assign each node's output to buffer 0 or 1. Slot -1 is the caller's
+    // input. An in-place node keeps its input's slot, except that it copies
+    // the caller's const input into slot 0 first.
+    int slot_size[2] = {0, 0};
+    int slot = -1;
+    copy_input_ = nodes_[0].in_place;
+    if (copy_input_) {
+      slot = 0;
+      slot_size[0] = nodes_[0].input_size();
+    }
+    for (int i = 0; i < num_nodes_; ++i) {
+      const GraphNode& node = nodes_[i];
+      if (!node.in_place) {
+        slot = (slot == 0) ? 1 : 0;
+      }
+      if (node.output_size() > slot_size[slot]) {
+        slot_size[slot] = node.output_size();
+      }
+      output_slot_[i] = slot;
+    }
+
+    required_floats_ = slot_size[0] + slot_size[1];
+    if (required_floats_ > kPoolFloats) {
+      fprintf(stderr, "Error: ProcessingGraph: kPoolFloats = %d is too "
+              "small, %d floats are needed.\n",
+              kPoolFloats, required_floats_);
+      return false;
+    }
+    slot_buffer_[0] = pool_;
+    slot_buffer_[1] = pool_ + slot_size[0];
+    ready_ = true;
+    return true;
+  }
+
+  // Processes one block of `input_size()` input samples and returns a pointer
+  // to `output_size()` output samples. The pointer is valid until the next
+  // call. Init() must have succeeded.
+  const float* ProcessSamples(const float* input) {
+    const float* x = input;
+    if (copy_input_) {
+      memcpy(slot_buffer_[0], input, sizeof(float) * nodes_[0].input_size());
+      x = slot_buffer_[0];
+    }
+    for (int i = 0; i < num_nodes_; ++i) {
+      float* y = slot_buffer_[output_slot_[i]];
+      nodes_[i].process(nodes_[i].state, x, nodes_[i].input_frames, y);
+      x = y;
+    }
+    return x;
+  }
+
+  // Number of nodes.
+  int num_nodes() const { return num_nodes_; }
+  // Whether Init() has succeeded since the last Add().
+  bool ready() const { return ready_; }
+  // Number of input samples per block, the first node's input size.
+  int input_size() const { return nodes_[0].input_size(); }
+  // Number of output samples per block, the last node's output size.
+  int output_size() const { return nodes_[num_nodes_ - 1].output_size(); }
+  // Number of pool floats used by the plan, valid after Init().
+  int required_floats() const { return required_floats_; }
+  // Buffer that node `i` writes its output to, valid after Init().
+  const float* node_output(int i) const {
+    return slot_buffer_[output_slot_[i]];
+  }
+
+ private:
+  GraphNode nodes_[kMaxNodes];
+  int output_slot_[kMaxNodes];
+  float* slot_buffer_[2];
+  int num_nodes_;
+  int required_floats_;
+  bool copy_input_;
+  bool ready_;
+  float pool_[kPoolFloats];
+};
+
+namespace processing_graph_internal {
+
+inline void ProcessTactileProcessor(void* state, const float* input,
+                                    int /*num_frames*/, float* output) {
+  TactileProcessorProcessSamples(static_cast<TactileProcessor*>(state), input,
+                                 output);
+}
+
+inline void ProcessPostProcessor(void* state, const float* /*input*/,
+                                 int num_frames, float* output) {
+  PostProcessorProcessSamples(static_cast<PostProcessor*>(state), output,
+                              num_frames);
+}
+
+inline void ProcessChannelMap(void* state, const float* input, int num_frames,
+                              float* output) {
+  ChannelMapApply(static_cast<const ChannelMap*>(state), input, num_frames,
+                  output);
+}
+
+}  // namespace processing_graph_internal
+
+// Makes a node for TactileProcessorProcessSamples(), taking mono input at
+// `sample_rate_hz` and producing kTactileProcessorNumTactors output channels.
+inline GraphNode MakeTactileProcessorNode(TactileProcessor* processor,
+                                          float sample_rate_hz) {
+  const int block_size = CarlFrontendBlockSize(processor->frontend);
+  GraphNode node;
+  node.process = processing_graph_internal::ProcessTactileProcessor;
+  node.state = processor;
+  node.num_input_channels = 1;
+  node.input_frames = block_size;
+  node.num_output_channels = kTactileProcessorNumTactors;
+  node.output_frames = block_size / processor->decimation_factor;
+  node.input_sample_rate_hz = sample_rate_hz;
+  node.output_sample_rate_hz = sample_rate_hz / processor->decimation_factor;
+  node.in_place = false;
+  return node;
+}
+
+// Makes an in-place node for PostProcessorProcessSamples() on blocks of
+// `num_frames` frames. `sample_rate_hz` is the rate the PostProcessor was
+// initialized with.
+inline GraphNode MakePostProcessorNode(PostProcessor* post_processor,
+                                       int num_frames, float sample_rate_hz) {
+  GraphNode node;
+  node.process = processing_graph_internal::ProcessPostProcessor;
+  node.state = post_processor;
+  node.num_input_channels = post_processor->num_channels;
+  node.input_frames = num_frames;
+  node.num_output_channels = post_processor->num_channels;
+  node.output_frames = num_frames;
+  node.input_sample_rate_hz = sample_rate_hz;
+  node.output_sample_rate_hz = sample_rate_hz;
+  node.in_place = true;
+  return node;
+}
+
+// Makes a node for ChannelMapApply() on blocks of `num_frames` frames. It is
+// not in place, since an output channel may read any input channel.
+inline GraphNode MakeChannelMapNode(const ChannelMap* channel_map,
+                                    int num_frames) {
+  GraphNode node;
+  node.process = processing_graph_internal::ProcessChannelMap;
+  node.state = const_cast<ChannelMap*>(channel_map);
+  node.num_input_channels = channel_map->num_input_channels;
+  node.input_frames = num_frames;
+  node.num_output_channels = channel_map->num_output_channels;
+  node.output_frames = num_frames;
+  node.input_sample_rate_hz = 0.0f;
+  node.output_sample_rate_hz = 0.0f;
+  node.in_place = false;
+  return node;
+}
+
+}  // namespace audio_tactile
+
+#endif  // AUDIO_TO_TACTILE_SRC_CPP_PROCESSING_GRAPH_H_
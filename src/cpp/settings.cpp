@@ -18,8 +18,10 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "cpp/std_shim.h"
 #include "dsp/fast_fun.h"
 #include "dsp/math_constants.h"
+#include "dsp/serialize.h"
 #include "tactile/parse_key_value.h"
 #include "tactile/tactile_processor.h"
 
@@ -28,6 +30,7 @@ namespace audio_tactile {
 Settings::Settings() {
   device_name[0] = '\0';
   input = InputSelection::kAnalogMic;
+  latency = LatencyProfile::kDefault;
   tuning = kDefaultTuningKnobs;
   ChannelMapInit(&channel_map, kTactileProcessorNumTactors);
 }
@@ -37,6 +40,8 @@ bool Settings::operator==(const Settings& rhs) const {
   if (strcmp(device_name, rhs.device_name) ||
       // Compare input selection.
       input != rhs.input ||
+      // Compare latency profile.
+      latency != rhs.latency ||
       // Compare tuning knobs.
       memcmp(tuning.values, rhs.tuning.values, kNumTuningKnobs)) {
     return false;
@@ -57,10 +62,155 @@ bool Settings::operator==(const Settings& rhs) const {
   return true;
 }
 
+namespace {
+// Start of a binary snapshot, "AT" for Audio-to-Tactile.
+constexpr uint16_t kBinaryMagic = 0x5441;
+}  // namespace
+
+// Binary snapshot layout, with multibyte values in little endian order:
+//
+//   Offset  Size  Field
+//   0       2     kBinaryMagic
+//   2       1     kBinaryVersion
+//   3       1     kNumTuningKnobs
+//   4       4     source_stamp
+//   8       17    device_name, null padded
+//   25      1     input
+//   26      1     latency
+//   27      K     tuning.values, K = kNumTuningKnobs
+//   27+K    1     channel_map.num_input_channels
+//   28+K    1     channel_map.num_output_channels
+//   29+K    4*M   channel_map.gains as float32, M = kChannelMapMaxChannels
+//   29+K+4M M     channel_map.sources
+//   29+K+5M 2     Fletcher-16 checksum of the preceding bytes
+void Settings::WriteBinary(uint32_t source_stamp, uint8_t* dest) const {
+  uint8_t* p = dest;
+  ::LittleEndianWriteU16(kBinaryMagic, p);
+  p[2] = kBinaryVersion;
+  p[3] = kNumTuningKnobs;
+  ::LittleEndianWriteU32(source_stamp, p + 4);
+  p += 8;
+
+  // Copy at most kMaxDeviceNameLength chars, zero padding the rest.
+  const int name_length =
+      std_shim::min<int>(kMaxDeviceNameLength, strlen(device_name));
+  memset(p, 0, kMaxDeviceNameLength + 1);
+  memcpy(p, device_name, name_length);
+  p += kMaxDeviceNameLength + 1;
+  *p++ = static_cast<uint8_t>(input);
+  *p++ = static_cast<uint8_t>(latency);
+  memcpy(p, tuning.values, kNumTuningKnobs);
+  p += kNumTuningKnobs;
+
+  const int num_out = channel_map.num_output_channels;
+  *p++ = static_cast<uint8_t>(channel_map.num_input_channels);
+  *p++ = static_cast<uint8_t>(num_out);
+  for (int c = 0; c < kChannelMapMaxChannels; ++c, p += 4) {
+    ::LittleEndianWriteF32(c < num_out ? channel_map.gains[c] : 0.0f, p);
+  }
+  for (int c = 0; c < kChannelMapMaxChannels; ++c) {
+    *p++ = static_cast<uint8_t>(c < num_out ? channel_map.sources[c] : 0);
+  }
+
+  ::LittleEndianWriteU16(::Fletcher16(dest, p - dest, 1), p);
+}
+
+bool Settings::ReadBinary(const uint8_t* src, int size,
+                          uint32_t source_stamp) {
+  if (size != kBinarySize ||
+      ::LittleEndianReadU16(src) != kBinaryMagic ||
+      src[2] != kBinaryVersion ||
+      src[3] != kNumTuningKnobs ||
+      ::LittleEndianReadU32(src + 4) != source_stamp ||
+      ::LittleEndianReadU16(src + kBinarySize - 2) !=
+          ::Fletcher16(src, kBinarySize - 2, 1)) {
+    return false;
+  }
+
+  // Decode to a temporary and validate before modifying *this.
+  Settings result;
+  const uint8_t* p = src + 8;
+  if (p[kMaxDeviceNameLength] != '\0') { return false; }
+  memcpy(result.device_name, p, kMaxDeviceNameLength + 1);
+  p += kMaxDeviceNameLength + 1;
+
+  switch (*p++) {
+    case static_cast<uint8_t>(InputSelection::kAnalogMic):
+      result.input = InputSelection::kAnalogMic;
+      break;
+    case static_cast<uint8_t>(InputSelection::kPdmMic):
+      result.input = InputSelection::kPdmMic;
+      break;
+    default:
+      return false;
+  }
+  switch (*p++) {
+    case static_cast<uint8_t>(LatencyProfile::kDefault):
+      result.latency = LatencyProfile::kDefault;
+      break;
+    case static_cast<uint8_t>(LatencyProfile::kLowLatency):
+      result.latency = LatencyProfile::kLowLatency;
+      break;
+    default:
+      return false;
+  }
+  memcpy(result.tuning.values, p, kNumTuningKnobs);
+  p += kNumTuningKnobs;
+
+  const int num_in = *p++;
+  const int num_out = *p++;
+  if (num_in > kChannelMapMaxChannels || num_out > kChannelMapMaxChannels) {
+    return false;
+  }
+  result.channel_map.num_input_channels = num_in;
+  result.channel_map.num_output_channels = num_out;
+  for (int c = 0; c < kChannelMapMaxChannels; ++c, p += 4) {
+    if (c < num_out) {
+      result.channel_map.gains[c] = ::LittleEndianReadF32(p);
+    }
+  }
+  for (int c = 0; c < kChannelMapMaxChannels; ++c, ++p) {
+    if (c < num_out) {
+      if (*p >= kChannelMapMaxChannels) { return false; }
+      result.channel_map.sources[c] = *p;
+    }
+  }
+
+  *this = result;
+  return true;
+}
+
 namespace settings_internal {
 
 SettingsFileReader::SettingsFileReader(Settings* settings)
-    : settings_(settings), line_number_(0), section_(0) {}
+    : settings_(settings), line_number_(0), section_(0), line_length_(0) {}
+
+bool SettingsFileReader::AppendData(const char** src, const char* end) {
+  const char* newline =
+      static_cast<const char*>(memchr(*src, '\n', end - *src));
+  const char* line_end = newline ? newline : end;
+  // Copy as much of the line as fits, dropping any excess.
+  const int count = std_shim::min<int>(line_end - *src,
+                                       kBufferSize - 1 - line_length_);
+  memcpy(buffer_ + line_length_, *src, count);
+  line_length_ += count;
+
+  if (!newline) {
+    *src = end;
+    return false;
+  }
+  *src = newline + 1;
+  buffer_[line_length_] = '\0';
+  line_length_ = 0;
+  return true;
+}
+
+bool SettingsFileReader::FinishData() {
+  if (line_length_ == 0) { return false; }
+  buffer_[line_length_] = '\0';
+  line_length_ = 0;
+  return true;
+}
 
 namespace {
 // Truncates a string to length of at most `max_length`. Used below for
@@ -109,6 +259,16 @@ ErrorCode SettingsFileReader::ReadLine() {
       } else {
         return Error(kNonfatalError, "Unknown input", kv.value);
       }
+    } else if (strcmp(kv.key, "latency") == 0) {
+      if (strcmp(kv.value, "default") == 0) {
+        settings_->latency = LatencyProfile::kDefault;
+        return kSuccess;
+      } else if (strcmp(kv.value, "low") == 0) {
+        settings_->latency = LatencyProfile::kLowLatency;
+        return kSuccess;
+      } else {
+        return Error(kNonfatalError, "Unknown latency", kv.value);
+      }
     } else  if (strcmp(kv.key, "tuning") == 0) {
       section_ = kSectionTuning;
       return kSuccess;
@@ -139,28 +299,86 @@ namespace {
 // Maps `c` to lowercase and non-alphanumeric chars to '_'.
 char NormalizeChar(char c) { return isalnum(c) ? tolower(c) : '_'; }
 
-// Finds index of the tuning knob with the same name as `key`. Comparison is
-// forgiving, made after normalizing each char with NormalizeChar(). Returns -1
-// if not found.
-int FindTuningKnob(const char* key) {
-  const int key_length = static_cast<int>(strlen(key));
+// Returns true if `key` equals `name` after normalizing each char with
+// NormalizeChar().
+bool NormalizedEqual(const char* key, const char* name) {
+  for (; *key && *name; ++key, ++name) {
+    if (NormalizeChar(*key) != NormalizeChar(*name)) { return false; }
+  }
+  return *key == *name;  // Both strings must end at the same point.
+}
 
-  for (int knob = 0; knob < kNumTuningKnobs; ++knob) {
-    const char* name = kTuningKnobInfo[knob].name;
-    // Can't be a match unless lengths agree.
-    if (key_length != static_cast<int>(strlen(name))) { continue; }
+// FNV-1a hash of a string after normalizing each char with NormalizeChar().
+uint32_t HashNormalized(const char* s, uint32_t seed) {
+  uint32_t hash = UINT32_C(2166136261) ^ seed;
+  for (; *s; ++s) {
+    hash = (hash ^ static_cast<uint8_t>(NormalizeChar(*s))) *
+        UINT32_C(16777619);
+  }
+  return hash;
+}
 
-    int i;
-    for (i = 0; i < key_length; ++i) {
-      if (NormalizeChar(key[i]) != NormalizeChar(name[i])) { break; }
+// Hash table mapping normalized tuning knob names to knob indices. The table
+// is built on first use, searching for a hash seed under which every knob
+// name lands in a distinct slot, i.e. a perfect hash. A lookup is then one
+// hash of the key and usually one string comparison, rather than comparing
+// against every knob name. Linear probing keeps lookups correct in case no
+// perfect seed is found.
+class TuningKnobTable {
+ public:
+  TuningKnobTable() {
+    for (uint32_t seed = 0; seed < kMaxSeedSearch; ++seed) {
+      if (Build(seed)) { return; }  // Found a perfect hash.
     }
+    Build(0);
+  }
 
-    if (i == key_length) {
-      return knob;  // Return index of the matching knob.
+  // Finds index of the tuning knob with the same name as `key`. Returns -1 if
+  // not found.
+  int Find(const char* key) const {
+    for (int i = HashNormalized(key, seed_) & kMask;; i = (i + 1) & kMask) {
+      const int knob = slots_[i];
+      if (knob < 0) { return -1; }  // Reached an empty slot, key not found.
+      if (NormalizedEqual(key, kTuningKnobInfo[knob].name)) { return knob; }
+    }
+  }
+
+ private:
+  enum {
+    // Table size, a power of 2. A load factor of 1/4 or less makes it likely
+    // that a perfect seed is found within a few tries.
+    kSize = 64,
+    kMask = kSize - 1,
+    kMaxSeedSearch = 256,
+  };
+  static_assert(kSize >= 4 * kNumTuningKnobs, "TuningKnobTable is too small");
+
+  // Builds the table with `seed`. Returns true if there were no collisions.
+  bool Build(uint32_t seed) {
+    seed_ = seed;
+    memset(slots_, -1, sizeof(slots_));
+    bool perfect = true;
+    for (int knob = 0; knob < kNumTuningKnobs; ++knob) {
+      int i = HashNormalized(kTuningKnobInfo[knob].name, seed) & kMask;
+      while (slots_[i] >= 0) {  // Linear probing on collision.
+        perfect = false;
+        i = (i + 1) & kMask;
+      }
+      slots_[i] = knob;
     }
+    return perfect;
   }
 
-  return -1;  // key not found.
+  uint32_t seed_;
+  int8_t slots_[kSize];  // Knob index for each slot, or -1 if empty.
+};
+
+// Finds index of the tuning knob with the same name as `key`. Comparison is
+// forgiving, made after normalizing each char with NormalizeChar(). Returns -1
+// if not found.
+int FindTuningKnob(const char* key) {
+  static const TuningKnobTable table;
+  return table.Find(key);
 }
 
 // Extracts and returns the next list item in a comma-delimited list. Leading
@@ -22,6 +22,7 @@
 // # An example settings file.
 // device_name: My device
 // input: analog mic
+// latency: low
 //
 // tuning:
 //   input_gain: 123
@@ -44,6 +45,9 @@
 //
 // * input: selects where to read input audio. May be either "analog" or "pdm".
 //
+// * latency: selects the latency profile, either "default" or "low". The low
+//   latency profile processes audio in half-size blocks, see cpp/latency.h.
+//
 // * tuning: each subkey names a tuning knob. The name lookup searches over
 //   `name` fields in `kTuningKnobInfo` (src/tactile/tuning.c). Case and
 //   nonalphanumeric characeters are ignored so that knob subkeys may be written
@@ -72,10 +76,21 @@
 // Specifically for channel_map: The lengths of the "gains" and "sources" lists
 // should normally match the number of tactors. But if they don't, excess
 // elements are ignored, and unset elements take on default values.
+//
+// == Binary snapshot ==
+//
+// Parsing the text file is comparatively slow, so the parsed Settings may also
+// be saved as a compact binary snapshot with WriteBinary() and restored with
+// ReadBinary(). The snapshot has a version byte and a Fletcher-16 checksum, and
+// records a caller-defined `source_stamp` identifying the text file it was
+// derived from. ReadBinary() rejects a snapshot whose version, checksum, or
+// stamp doesn't match, in which case the caller should fall back to parsing
+// the text file.
 
 #ifndef AUDIO_TO_TACTILE_SRC_CPP_SETTINGS_H_
 #define AUDIO_TO_TACTILE_SRC_CPP_SETTINGS_H_
 
+#include <stdint.h>
 #include <string.h>
 
 #include "cpp/constants.h"
@@ -85,8 +100,16 @@
 namespace audio_tactile {
 
 struct Settings {
+  // Binary snapshot format version. Increment when the layout changes.
+  enum { kBinaryVersion = 1 };
+  // Size in bytes of the binary snapshot.
+  static constexpr int kBinarySize =
+      8 + (kMaxDeviceNameLength + 1) + 2 + kNumTuningKnobs +
+      2 + 5 * kChannelMapMaxChannels + 2;
+
   char device_name[kMaxDeviceNameLength + 1];
   InputSelection input;
+  LatencyProfile latency;
   TuningKnobs tuning;
   ChannelMap channel_map;
 
@@ -130,6 +153,21 @@ struct Settings {
   template <typename ReadLineFun, typename ErrorFun>
   void ReadFile(ReadLineFun read_line_fun, ErrorFun error_fun);
 
+  // Reads Settings from a settings file in chunks of arbitrary size, such as
+  // flash pages, as an alternative to ReadFile(). Lines are assembled in a
+  // fixed buffer as chunks are consumed, so neither the whole file nor a
+  // per-line read call is needed. The `read_fun` callback has the signature
+  //
+  //   int read_fun(char* buffer, int buffer_size)
+  //
+  // Like the `read()` function, it reads up to `buffer_size` bytes into
+  // `buffer` and returns the number of bytes read, 0 at end of file, or a
+  // negative value on IO error. The reader stops when 0 or less is returned.
+  // Line characters beyond the reader's buffer size are dropped. Otherwise,
+  // behavior and `error_fun` are as in ReadFile().
+  template <typename ReadFun, typename ErrorFun>
+  void ReadFileChunked(ReadFun read_fun, ErrorFun error_fun);
+
   // Writes Settings to a settings file. Returns true on success, false on
   // failure. The `write_line_fun` callback has the signature
   //
@@ -140,6 +178,15 @@ struct Settings {
   // successful or false on error.
   template <typename WriteLineFun>
   bool WriteFile(WriteLineFun write_line_fun) const;
+
+  // Writes a binary snapshot of kBinarySize bytes to `dest`, tagged with
+  // `source_stamp`.
+  void WriteBinary(uint32_t source_stamp, uint8_t* dest) const;
+
+  // Reads a binary snapshot of `size` bytes written by WriteBinary(). Returns
+  // true on success. Returns false, leaving Settings unchanged, if the snapshot
+  // is invalid, of a different version, or not tagged with `source_stamp`.
+  bool ReadBinary(const uint8_t* src, int size, uint32_t source_stamp);
 };
 
 // Implementation details only below this line. ________________________________
@@ -150,7 +197,11 @@ enum ErrorCode { kSuccess, kNonfatalError, kFatalError };
 
 class SettingsFileReader {  // Helper class for reading.
  public:
-  enum { kBufferSize = 256 };
+  enum {
+    kBufferSize = 256,
+    // Size of chunks read by ReadFileChunked().
+    kChunkSize = 128,
+  };
 
   // Constructor. Sets the output args and puts reader in initial state.
   explicit SettingsFileReader(Settings* settings);
@@ -164,6 +215,14 @@ class SettingsFileReader {  // Helper class for reading.
   // On error, `buffer` is replaced with an error message.
   ErrorCode ReadLine();
 
+  // Consumes file data from [*src, end) into `buffer`, advancing `*src`.
+  // Returns true when a complete line is in `buffer`, after consuming its
+  // newline, in which case ReadLine() should be called before consuming more.
+  bool AppendData(const char** src, const char* end);
+  // At end of file, completes a final line that lacks a newline. Returns true
+  // if there is such a line in `buffer`.
+  bool FinishData();
+
  private:
   // Sets the tuning knob with name `key` to control value `value`.
   ErrorCode ReadTuningKnob(char* key, char* value);
@@ -188,8 +247,24 @@ class SettingsFileReader {  // Helper class for reading.
   Settings* settings_;
   int line_number_;  // Current line number.
   int section_;      // Current "section", for tracking what subkeys refer to.
+  int line_length_;  // Length of the partial line assembled by AppendData().
 };
 
+// Handles the line in `reader`'s buffer, reporting any error to `error_fun`.
+// Returns false if reading should stop due to a fatal error.
+template <typename ErrorFun>
+bool ReadLineAndReportErrors(SettingsFileReader* reader, ErrorFun& error_fun) {
+  // The core reading logic happens within ReadLine().
+  const ErrorCode error = reader->ReadLine();
+  if (error) {
+    // There was an error. The error message is in reader->buffer().
+    error_fun(reader->line_number(), reader->buffer());
+    // Abort reading on fatal error.
+    if (error == kFatalError) { return false; }
+  }
+  return true;
+}
+
 // The following functions are for writing settings to file.
 
 // Writes one tuning knob to `line`.
@@ -207,15 +282,32 @@ void Settings::ReadFile(ReadLineFun read_line_fun, ErrorFun error_fun) {
 
   // Each iteration reads one line of the settings file.
   while (read_line_fun(reader.buffer(), decltype(reader)::kBufferSize)) {
-    // The core reading logic happens within ReadLine().
-    const auto error = reader.ReadLine();
-    if (error) {
-      // There was an error. The error message is in reader.buffer().
-      error_fun(reader.line_number(), reader.buffer());
-      // Abort reading on fatal error.
-      if (error == settings_internal::kFatalError) { return; }
+    if (!settings_internal::ReadLineAndReportErrors(&reader, error_fun)) {
+      return;
+    }
+  }
+}
+
+template <typename ReadFun, typename ErrorFun>
+void Settings::ReadFileChunked(ReadFun read_fun, ErrorFun error_fun) {
+  settings_internal::SettingsFileReader reader(this);
+  char chunk[decltype(reader)::kChunkSize];
+
+  // Each iteration reads one chunk, which may complete any number of lines.
+  int count;
+  while ((count = read_fun(chunk, decltype(reader)::kChunkSize)) > 0) {
+    const char* src = chunk;
+    const char* end = chunk + count;
+    while (src < end) {
+      if (reader.AppendData(&src, end) &&
+          !settings_internal::ReadLineAndReportErrors(&reader, error_fun)) {
+        return;
+      }
     }
   }
+  if (reader.FinishData()) {
+    settings_internal::ReadLineAndReportErrors(&reader, error_fun);
+  }
 }
 
 template <typename WriteLineFun>
@@ -242,6 +334,17 @@ bool Settings::WriteFile(WriteLineFun write_line_fun) const {
       break;
   }
 
+  // Latency profile.
+  switch (latency) {
+    case LatencyProfile::kDefault:
+      if (!write_line_fun("latency: default")) { return false; }
+      break;
+
+    case LatencyProfile::kLowLatency:
+      if (!write_line_fun("latency: low")) { return false; }
+      break;
+  }
+
   // Tuning knobs.
   if (!write_line_fun("\ntuning:")) { return false; }
   for (int knob = 0; knob < kNumTuningKnobs; ++knob) {
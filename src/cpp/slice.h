@@ -46,6 +46,27 @@
 //   slice.head<n>()
 //   slice.tail<n>()
 //   slice.segment<n>(start)
+//
+// `AlignedSlice` is a Slice whose data pointer is aligned to a number of bytes
+// given in the type, so that SIMD kernels can select aligned code paths at
+// compile time rather than using unaligned loads or peeling loops:
+//
+//   alignas(16) float buffer[64];
+//   AlignedSlice<float, 16, 64> slice4(buffer);
+//
+//   // Buffers from AlignedAlloc() (dsp/aligned_alloc.h).
+//   float* data = (float*)AlignedAlloc(sizeof(float) * n);
+//   AlignedSlice<float, kAlignedAllocAlignment> slice5(data, n);
+//
+//   template <int kAlignment>
+//   void Kernel(AlignedSlice<const float, kAlignment> x) {
+//     if (kAlignment >= 16) { /* Aligned fast path. */ }
+//     ...
+//   }
+//
+// AlignedSlice converts implicitly to a Slice and to an AlignedSlice of equal
+// or weaker alignment, but constructing one from a pointer is explicit, since
+// the caller must guarantee the alignment.
 
 #ifndef AUDIO_TO_TACTILE_SRC_CPP_SLICE_H_
 #define AUDIO_TO_TACTILE_SRC_CPP_SLICE_H_
@@ -214,6 +235,99 @@ class Slice {
   slice_internal::Representation<T, kSize> representation_;
 };
 
+template <typename T, int kAlignment, int kSize = kDynamic>
+class AlignedSlice {
+ public:
+  static constexpr int kSizeAtCompileTime = kSize;
+  static constexpr int kAlignmentBytes = kAlignment;
+  using value_type = typename std_shim::remove_const<T>::type;
+  static_assert(kAlignment > 0 && (kAlignment & (kAlignment - 1)) == 0,
+                "Alignment must be a power of 2");
+  static_assert(kAlignment >= static_cast<int>(alignof(T)),
+                "Alignment must be at least the alignment of T");
+
+  // Default constructor sets null data pointer, which is aligned.
+  constexpr AlignedSlice() noexcept : slice_() {}
+  // Construct with given `data` pointer and `size`. `data` must be aligned to
+  // kAlignment bytes. For a fixed-sized AlignedSlice, `size` is ignored.
+  constexpr AlignedSlice(T* data, int size) noexcept : slice_(data, size) {}
+  // Only for fixed-sized AlignedSlice: construct with a given `data` pointer,
+  // which must be aligned to kAlignment bytes.
+  template <int kLazySize = kSize, typename = typename std_shim::enable_if<
+                                       kLazySize != kDynamic>::type>
+  constexpr explicit AlignedSlice(T* data) noexcept : slice_(data, kSize) {}
+  // Implicit conversion from an AlignedSlice of equal or stronger alignment.
+  template <typename RhsT, int kRhsAlignment, int kRhsSize>
+  constexpr AlignedSlice(  // NOLINT(runtime/explicit)
+      AlignedSlice<RhsT, kRhsAlignment, kRhsSize> rhs) noexcept
+      : slice_(rhs.slice()) {
+    static_assert(kRhsAlignment % kAlignment == 0,
+                  "Cannot convert to an AlignedSlice of stronger alignment");
+  }
+
+  // Returns true if `data` is aligned to kAlignment bytes, e.g. to check the
+  // precondition of the constructors.
+  static bool IsAligned(const T* data) noexcept {
+    return (reinterpret_cast<uintptr_t>(data) &
+            static_cast<uintptr_t>(kAlignment - 1)) == 0;
+  }
+
+  // Implicit conversion to Slice.
+  template <typename RhsT, int kRhsSize>
+  constexpr operator Slice<RhsT, kRhsSize>() const noexcept {  // NOLINT
+    return Slice<RhsT, kRhsSize>(slice_);
+  }
+  // Gets the underlying Slice.
+  constexpr Slice<T, kSize> slice() const noexcept { return slice_; }
+
+  // Data pointer to the first element, with the alignment told to the compiler
+  // so that it may use aligned loads and stores.
+  T* data() const noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<T*>(__builtin_assume_aligned(slice_.data(), kAlignment));
+#else
+    return slice_.data();
+#endif
+  }
+  constexpr int size() const noexcept { return slice_.size(); }
+  constexpr int size_bytes() const noexcept { return slice_.size_bytes(); }
+  T& operator[](int i) const noexcept { return *(data() + i); }
+  constexpr bool empty() const noexcept { return slice_.empty(); }
+  T* begin() const noexcept { return data(); }
+  T* end() const noexcept { return data() + size(); }
+
+  // Sub-slices starting at the first element keep the alignment. Others are
+  // plain Slices, since their alignment depends on `start`.
+  constexpr AlignedSlice<T, kAlignment> head(int n) const noexcept {
+    return AlignedSlice<T, kAlignment>(slice_.data(), n);
+  }
+  template <int kSegmentSize>
+  constexpr AlignedSlice<T, kAlignment, kSegmentSize> head() const noexcept {
+    static_assert(kSegmentSize >= 0, "Segment size must be nonnegative");
+    static_assert(kSize == kDynamic || kSegmentSize <= kSize,
+                  "Segment size must be <= Slice size");
+    return AlignedSlice<T, kAlignment, kSegmentSize>(slice_.data());
+  }
+  constexpr Slice<T> tail(int n) const noexcept { return slice_.tail(n); }
+  constexpr Slice<T> segment(int start, int n) const noexcept {
+    return slice_.segment(start, n);
+  }
+
+  // memcpy from another Slice, as Slice::CopyFrom(). Returns true on success.
+  template <typename RhsT, int kRhsSize>
+  bool CopyFrom(Slice<RhsT, kRhsSize> rhs) {
+    return slice_.CopyFrom(rhs);
+  }
+
+ private:
+  Slice<T, kSize> slice_;
+};
+
+template <typename T, int kAlignment, int kSize>
+constexpr int AlignedSlice<T, kAlignment, kSize>::kSizeAtCompileTime;
+template <typename T, int kAlignment, int kSize>
+constexpr int AlignedSlice<T, kAlignment, kSize>::kAlignmentBytes;
+
 }  // namespace audio_tactile
 
 #endif  // AUDIO_TO_TACTILE_SRC_CPP_SLICE_H_
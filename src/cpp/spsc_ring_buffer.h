@@ -0,0 +1,173 @@
+// Copyright 2022 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+// SpscRingBuffer, a lock-free single-producer single-consumer ring buffer.
+//
+// SpscRingBuffer<T, kCapacity> is a FIFO queue of up to `kCapacity` elements of
+// type `T`. It's meant for passing blocks of samples between an interrupt
+// handler and the main loop, e.g. mic audio from the PDM interrupt to the
+// processing task. It uses no locks and it's safe without disabling
+// interrupts, provided that there is one producer and one consumer:
+//
+//  * Only the producer calls Push(), BeginPush(), and EndPush().
+//  * Only the consumer calls Pop(), Front(), and PopFront().
+//
+// The queue depth sets the latency vs. robustness tradeoff: a deeper queue
+// absorbs more jitter in the consumer before the producer finds it full.
+//
+// Elements may be copied in and out with Push() and Pop():
+//
+//   SpscRingBuffer<Block, 4> queue;
+//   // In the producer (e.g. an interrupt handler):
+//   if (!queue.Push(block)) { /* Queue is full, drop the block. */ }
+//   // In the consumer:
+//   Block block;
+//   if (queue.Pop(&block)) { /* Process block. */ }
+//
+// Or accessed in place to avoid copying:
+//
+//   Block* slot = queue.BeginPush();      // Returns nullptr if full.
+//   if (slot) { Fill(slot); queue.EndPush(); }
+//
+//   const Block* front = queue.Front();   // Returns nullptr if empty.
+//   if (front) { Process(*front); queue.PopFront(); }
+//
+// Synchronization uses the GCC/Clang `__atomic` builtins with acquire/release
+// ordering, rather than <atomic>, which some embedded toolchains lack. These
+// compile to plain loads and stores plus memory barriers on Cortex-M, since no
+// read-modify-write operations are needed.
+
+#ifndef AUDIO_TO_TACTILE_SRC_CPP_SPSC_RING_BUFFER_H_
+#define AUDIO_TO_TACTILE_SRC_CPP_SPSC_RING_BUFFER_H_
+
+#include <stdint.h>
+
+namespace audio_tactile {
+
+template <typename T, int kCapacity_>
+class SpscRingBuffer {
+ public:
+  enum { kCapacity = kCapacity_ };
+  struct TestAccess;
+
+  static_assert(kCapacity > 0 && (kCapacity & (kCapacity - 1)) == 0,
+                "kCapacity must be a power of 2");
+
+  SpscRingBuffer() noexcept: write_count_(0), read_count_(0) {}
+  SpscRingBuffer(const SpscRingBuffer&) = delete;  // No copying.
+  SpscRingBuffer& operator=(const SpscRingBuffer&) = delete;
+
+  // Number of elements in the queue. When called from the producer or the
+  // consumer, the true size may only have grown or shrunk, respectively.
+  int size() const noexcept {
+    return static_cast<int>(LoadAcquire(&write_count_) -
+                            LoadAcquire(&read_count_));
+  }
+  bool empty() const noexcept { return size() == 0; }
+  bool full() const noexcept { return size() == kCapacity; }
+
+  // Producer: Copies `value` onto the back of the queue. Returns false if the
+  // queue is full, in which case `value` is dropped.
+  bool Push(const T& value) {
+    T* slot = BeginPush();
+    if (slot == nullptr) { return false; }
+    *slot = value;
+    EndPush();
+    return true;
+  }
+
+  // Producer: Returns a pointer to the slot at the back of the queue to write
+  // in place, or nullptr if the queue is full. The element is not visible to
+  // the consumer until EndPush() is called.
+  T* BeginPush() noexcept {
+    const uint32_t write_count = write_count_;  // Only the producer writes it.
+    if (write_count - LoadAcquire(&read_count_) >= kCapacity) {
+      return nullptr;
+    }
+    return &elements_[write_count & kIndexMask];
+  }
+
+  // Producer: Like BeginPush(), but gets the slot `ahead` elements past the
+  // back of the queue, or nullptr if the queue lacks room for `ahead + 1` more
+  // elements. This lets a producer such as DMA start filling later slots before
+  // the back slot is published. Slots are published in order by EndPush(), so
+  // BeginPushAhead(1) becomes BeginPush() after one EndPush().
+  T* BeginPushAhead(int ahead) noexcept {
+    const uint32_t write_count = write_count_ + ahead;
+    if (write_count - LoadAcquire(&read_count_) >= kCapacity) {
+      return nullptr;
+    }
+    return &elements_[write_count & kIndexMask];
+  }
+
+  // Producer: Publishes the slot obtained from BeginPush().
+  void EndPush() noexcept { StoreRelease(&write_count_, write_count_ + 1); }
+
+  // Consumer: Copies the front of the queue to `*value` and removes it.
+  // Returns false if the queue is empty.
+  bool Pop(T* value) {
+    const T* front = Front();
+    if (front == nullptr) { return false; }
+    *value = *front;
+    PopFront();
+    return true;
+  }
+
+  // Consumer: Returns a pointer to the front of the queue to read in place, or
+  // nullptr if the queue is empty. The slot stays valid until PopFront().
+  const T* Front() const noexcept {
+    const uint32_t read_count = read_count_;  // Only the consumer writes it.
+    if (LoadAcquire(&write_count_) == read_count) { return nullptr; }
+    return &elements_[read_count & kIndexMask];
+  }
+  // Consumer: Like above, but the front element may be modified in place.
+  T* Front() noexcept {
+    return const_cast<T*>(static_cast<const SpscRingBuffer*>(this)->Front());
+  }
+
+  // Consumer: Removes the front element, releasing its slot to the producer.
+  // Must only be called when the queue is nonempty.
+  void PopFront() noexcept { StoreRelease(&read_count_, read_count_ + 1); }
+
+ private:
+  enum { kIndexMask = kCapacity - 1 };
+
+  static uint32_t LoadAcquire(const uint32_t* p) noexcept {
+    return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+  }
+  static void StoreRelease(uint32_t* p, uint32_t value) noexcept {
+    __atomic_store_n(p, value, __ATOMIC_RELEASE);
+  }
+
+  T elements_[kCapacity];
+  // Free-running counts of pushed and popped elements. Since kCapacity is a
+  // power of 2, indices and the size are correct after the counts wrap.
+  uint32_t write_count_;
+  uint32_t read_count_;
+};
+
+// Test-only access to SpscRingBuffer.
+template <typename T, int kCapacity>
+struct SpscRingBuffer<T, kCapacity>::TestAccess {
+  // Sets both counts to `count`, emptying the queue.
+  static void SetCounts(SpscRingBuffer<T, kCapacity>* queue, uint32_t count) {
+    queue->write_count_ = count;
+    queue->read_count_ = count;
+  }
+};
+
+}  // namespace audio_tactile
+
+#endif  // AUDIO_TO_TACTILE_SRC_CPP_SPSC_RING_BUFFER_H_
@@ -0,0 +1,110 @@
+// Copyright 2022 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "cpp/tactile_codec.h"
+
+namespace audio_tactile {
+
+static_assert(kNumPwmValues == 8,
+              "Tactile codec format assumes 8 frames per block");
+
+namespace {
+constexpr int kMaxShift = 7;
+constexpr int kMinCode = -8;
+constexpr int kMaxCode = 7;
+
+int ClampSample(int x) { return (x < 0) ? 0 : (x > 255) ? 255 : x; }
+
+// Quantizes `delta` to a code at `shift`, rounding to nearest.
+int QuantizeDelta(int delta, int shift) {
+  const int half = (1 << shift) >> 1;
+  const int code = (delta >= 0) ? ((delta + half) >> shift)
+                                : -((-delta + half) >> shift);
+  return (code < kMinCode) ? kMinCode : (code > kMaxCode) ? kMaxCode : code;
+}
+
+// Encodes one channel with `shift`, writing codes to `codes` and returning the
+// squared error.
+int EncodeChannel(const uint8_t* samples, int stride, int shift, int* codes) {
+  int prev = samples[0];
+  int error = 0;
+  for (int n = 1; n < kNumPwmValues; ++n) {
+    const int x = samples[n * stride];
+    const int code = QuantizeDelta(x - prev, shift);
+    codes[n - 1] = code;
+    prev = ClampSample(prev + code * (1 << shift));
+    error += (x - prev) * (x - prev);
+  }
+  return error;
+}
+}  // namespace
+
+void TactileCodecEncode(const uint8_t* samples, int num_channels,
+                        uint8_t* encoded) {
+  for (int c = 0; c < num_channels;
+       ++c, encoded += kTactileCodecBytesPerChannel) {
+    const uint8_t* channel = samples + c;
+    int best_codes[kNumPwmValues - 1];
+    int best_shift = 0;
+    int best_error = EncodeChannel(channel, num_channels, 0, best_codes);
+    for (int shift = 1; shift <= kMaxShift && best_error > 0; ++shift) {
+      int codes[kNumPwmValues - 1];
+      const int error = EncodeChannel(channel, num_channels, shift, codes);
+      if (error < best_error) {
+        best_error = error;
+        best_shift = shift;
+        for (int i = 0; i < kNumPwmValues - 1; ++i) {
+          best_codes[i] = codes[i];
+        }
+      }
+    }
+
+    encoded[0] = channel[0];
+    encoded[1] = static_cast<uint8_t>(best_shift | ((best_codes[0] & 15) << 4));
+    for (int i = 1; i < kNumPwmValues - 1; i += 2) {
+      encoded[2 + i / 2] = static_cast<uint8_t>(
+          (best_codes[i] & 15) | ((best_codes[i + 1] & 15) << 4));
+    }
+  }
+}
+
+bool TactileCodecDecode(const uint8_t* encoded, int num_channels,
+                        uint8_t* samples) {
+  for (int c = 0; c < num_channels;
+       ++c, encoded += kTactileCodecBytesPerChannel) {
+    const int shift = encoded[1] & 15;
+    if (shift > kMaxShift) { return false; }
+
+    // Unpack the 4-bit codes, sign extending.
+    int codes[kNumPwmValues - 1];
+    codes[0] = encoded[1] >> 4;
+    for (int i = 1; i < kNumPwmValues - 1; i += 2) {
+      codes[i] = encoded[2 + i / 2] & 15;
+      codes[i + 1] = encoded[2 + i / 2] >> 4;
+    }
+
+    uint8_t* channel = samples + c;
+    int prev = encoded[0];
+    channel[0] = static_cast<uint8_t>(prev);
+    for (int n = 1; n < kNumPwmValues; ++n) {
+      const int code = codes[n - 1] - ((codes[n - 1] & 8) << 1);
+      prev = ClampSample(prev + code * (1 << shift));
+      channel[n * num_channels] = static_cast<uint8_t>(prev);
+    }
+  }
+  return true;
+}
+
+}  // namespace audio_tactile
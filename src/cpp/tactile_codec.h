@@ -0,0 +1,71 @@
+// Copyright 2022 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+//
+// Low-complexity lossy codec for streaming multichannel tactile frames.
+//
+// The codec compresses a block of kNumPwmValues (= 8) frames of 8-bit samples,
+// the same data as in a kAllTactorsSamples message, to 5 bytes per channel
+// instead of 8. Each channel is coded independently as block ADPCM:
+//
+//   byte 0:     first sample, verbatim.
+//   byte 1:     low nibble = shift `s` in [0, 7], high nibble = code 1.
+//   bytes 2-4:  codes 2-7, two per byte, low nibble first.
+//
+// Each code is a 4-bit signed value `c` in [-8, 7], and the decoder
+// reconstructs sample n as x[n] = clamp(x[n - 1] + c * 2^s, 0, 255). The shift
+// is a shared exponent for the block, as in block floating point. The encoder
+// predicts from its own reconstruction, so error doesn't accumulate over the
+// block, and picks the shift with the least squared error. Deltas up to 7 in
+// magnitude, as for smooth or quiet signals, are coded losslessly.
+//
+// Blocks are independent, with no state carried between them, so a lost BLE
+// packet doesn't corrupt later blocks.
+//
+// For 12 channels, a block is 60 bytes rather than 96, so that with the packing
+// in cpp/message_packer.h, a 244-byte BLE packet holds 3 blocks rather than 2.
+
+#ifndef AUDIO_TO_TACTILE_SRC_CPP_TACTILE_CODEC_H_
+#define AUDIO_TO_TACTILE_SRC_CPP_TACTILE_CODEC_H_
+
+#include <stdint.h>
+
+#include "cpp/constants.h"
+
+namespace audio_tactile {
+
+// Number of encoded bytes per channel.
+constexpr int kTactileCodecBytesPerChannel = 5;
+
+// Number of encoded bytes for a block of `num_channels` channels.
+constexpr int TactileCodecEncodedSize(int num_channels) {
+  return kTactileCodecBytesPerChannel * num_channels;
+}
+
+// Encodes a block of kNumPwmValues frames. `samples` has
+// kNumPwmValues * num_channels samples interleaved, with sample `n` of channel
+// `c` at index n * num_channels + c, as in kAllTactorsSamples. Writes
+// TactileCodecEncodedSize(num_channels) bytes to `encoded`.
+void TactileCodecEncode(const uint8_t* samples, int num_channels,
+                        uint8_t* encoded);
+
+// Decodes a block encoded by TactileCodecEncode(), writing interleaved samples
+// to `samples`. Returns false if the data is invalid.
+bool TactileCodecDecode(const uint8_t* encoded, int num_channels,
+                        uint8_t* samples);
+
+}  // namespace audio_tactile
+
+#endif  // AUDIO_TO_TACTILE_SRC_CPP_TACTILE_CODEC_H_
@@ -0,0 +1,199 @@
+// Copyright 2022 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+// TactileProcessorT, a TactileProcessor with compile-time block size.
+//
+// TactileProcessorT<kBlockSize, kDecimation, kNumChannels> runs the same
+// processing as TactileProcessorProcessSamples(), with results identical to
+// it, but with the block size and decimation factor fixed at compile time:
+//
+//  * The Enveloper, which runs once per input sample and is the hot loop
+//    besides the CARL frontend, is compiled specifically for the configuration
+//    so that the per-sample decimation loop is fully unrolled.
+//
+//  * The processor and its buffers are laid out by
+//    TactileProcessorInitInBuffer() in a member array of `kArenaBytes`, and the
+//    output buffer is a member array, so no heap allocation is needed. Declare
+//    the object as a global or static in firmware, since it is several KB.
+//
+// Output is interleaved with `kNumChannels` elements per frame, of which the
+// first kTactileProcessorNumTactors = 10 are the tactile channels (see
+// tactile/tactile_processor.h) and any extra channels are zero. This way the
+// output can be passed directly to a device with more than 10 channels.
+//
+// The decimation factor may be `kDynamic` (see cpp/fixed_or_dynamic.h) to set
+// it at run time with Init(params). Then the output buffer is sized for the
+// worst case of no decimation, and the Enveloper loop is not specialized.
+//
+// Example use:
+//
+//   TactileProcessorT<64, 8> processor;
+//   if (!processor.Init(16000.0f)) { /* Error. */ }
+//
+//   // Processing loop.
+//   while (...) {
+//     float input[64] = ...
+//     const float* output = processor.ProcessSamples(input);
+//     // output[i * processor.kNumChannels + c] is sample i of channel c,
+//     // for 0 <= i < processor.output_block_size().
+//   }
+
+#ifndef AUDIO_TO_TACTILE_SRC_CPP_TACTILE_PROCESSOR_T_H_
+#define AUDIO_TO_TACTILE_SRC_CPP_TACTILE_PROCESSOR_T_H_
+
+#include <stdio.h>
+
+#include "cpp/fixed_or_dynamic.h"  // NOLINT(build/include)
+#include "dsp/arena.h"
+#include "tactile/enveloper_kernel.h"
+#include "tactile/tactile_processor.h"
+
+namespace audio_tactile {
+
+template <int kBlockSize_, int kDecimation_, int kNumChannels_ = 10,
+          int kArenaBytes_ = 12288>
+class TactileProcessorT {
+ public:
+  // These are ints rather than enumerators, so that comparing with kDynamic
+  // doesn't compare different enum types.
+  static constexpr int kBlockSize = kBlockSize_;
+  static constexpr int kDecimation = kDecimation_;
+  static constexpr int kNumChannels = kNumChannels_;
+  static constexpr int kArenaBytes = kArenaBytes_;
+  // Max number of output frames per block.
+  static constexpr int kMaxOutputBlockSize =
+      (kDecimation == kDynamic) ? kBlockSize : kBlockSize / kDecimation;
+
+  static_assert(kBlockSize > 0 && (kBlockSize & (kBlockSize - 1)) == 0,
+                "kBlockSize must be a power of 2");
+  static_assert(kDecimation == kDynamic ||
+                (kDecimation > 0 && kBlockSize % kDecimation == 0),
+                "kBlockSize must be a multiple of kDecimation");
+  static_assert(kNumChannels >= 10,
+                "kNumChannels must be at least kTactileProcessorNumTactors");
+
+  TactileProcessorT() noexcept: processor_(nullptr), output_() {}
+  TactileProcessorT(const TactileProcessorT&) = delete;  // No copying.
+  TactileProcessorT& operator=(const TactileProcessorT&) = delete;
+
+  // Initializes with default params and input sample rate in Hz. The
+  // decimation factor must be fixed. Returns true on success.
+  bool Init(float input_sample_rate_hz) {
+    static_assert(kDecimation != kDynamic,
+                  "Use Init(params) with dynamic decimation");
+    TactileProcessorParams params;
+    TactileProcessorSetDefaultParams(&params);
+    params.frontend_params.input_sample_rate_hz = input_sample_rate_hz;
+    params.frontend_params.block_size = kBlockSize;
+    params.decimation_factor = kDecimation;
+    return Init(params);
+  }
+
+  // Initializes with `params`, whose block size and decimation factor must
+  // match the template arguments. Returns true on success.
+  bool Init(const TactileProcessorParams& params) {
+    processor_ = nullptr;
+    if (params.frontend_params.block_size != kBlockSize ||
+        (kDecimation != kDynamic && params.decimation_factor != kDecimation)) {
+      fprintf(stderr, "Error: TactileProcessorT: params don't match "
+              "template block size %d and decimation %d.\n",
+              kBlockSize, kDecimation);
+      return false;
+    }
+    const size_t required_bytes = TactileProcessorRequiredBytes(&params);
+    if (required_bytes > static_cast<size_t>(kArenaBytes)) {
+      fprintf(stderr, "Error: TactileProcessorT: kArenaBytes = %d is too "
+              "small, %d bytes are needed.\n",
+              kArenaBytes, static_cast<int>(required_bytes));
+      return false;
+    }
+    processor_ = TactileProcessorInitInBuffer(arena_, kArenaBytes, &params);
+    return processor_ != nullptr;
+  }
+
+  // Processes one block of `kBlockSize` input samples and returns a pointer
+  // to `output_block_size() * kNumChannels` interleaved output samples. The
+  // pointer is valid until the next call.
+  const float* ProcessSamples(const float* input) {
+    TactileProcessorTakeStagedTuning(processor_);
+    // Envelopes are written into the processor's workspace, as in
+    // TactileProcessorProcessSamples().
+    float* envelopes = processor_->workspace;
+    EnveloperProcessSamplesKernel(&processor_->enveloper, input, kBlockSize,
+                                  decimation_factor(), /*taps=*/nullptr,
+                                  envelopes);
+    TactileProcessorProcessEnvelopes(processor_, input, envelopes, output_,
+                                     kNumChannels);
+    return output_;
+  }
+
+  // Resets to initial state.
+  void Reset() { TactileProcessorReset(processor_); }
+
+  // Applies tuning specified by `tuning_knobs`.
+  void ApplyTuning(const TuningKnobs& tuning_knobs) {
+    TactileProcessorApplyTuning(processor_, &tuning_knobs);
+  }
+
+  // Stages tuning from a control thread, to be taken by the next
+  // ProcessSamples() call. Returns false if previously staged tuning hasn't
+  // been taken yet. See TactileProcessorStageTuning().
+  bool StageTuning(const TuningKnobs& tuning_knobs) {
+    return TactileProcessorStageTuning(processor_, &tuning_knobs);
+  }
+
+  // Decimation factor, a compile-time constant unless kDecimation is dynamic.
+  int decimation_factor() const {
+    return (kDecimation == kDynamic) ? processor_->decimation_factor
+                                     : kDecimation;
+  }
+  // Number of output frames per block.
+  int output_block_size() const { return kBlockSize / decimation_factor(); }
+
+  // Accesses the underlying C TactileProcessor, or nullptr if not initialized.
+  TactileProcessor* get() { return processor_; }
+  const TactileProcessor* get() const { return processor_; }
+
+ private:
+  TactileProcessor* processor_;
+  alignas(kArenaAlignment) unsigned char arena_[kArenaBytes];
+  float output_[kMaxOutputBlockSize * kNumChannels];
+};
+
+// Definitions of the static constexpr members, needed in C++11 if odr-used.
+template <int kBlockSize_, int kDecimation_, int kNumChannels_,
+          int kArenaBytes_>
+constexpr int TactileProcessorT<kBlockSize_, kDecimation_, kNumChannels_,
+                                kArenaBytes_>::kBlockSize;
+template <int kBlockSize_, int kDecimation_, int kNumChannels_,
+          int kArenaBytes_>
+constexpr int TactileProcessorT<kBlockSize_, kDecimation_, kNumChannels_,
+                                kArenaBytes_>::kDecimation;
+template <int kBlockSize_, int kDecimation_, int kNumChannels_,
+          int kArenaBytes_>
+constexpr int TactileProcessorT<kBlockSize_, kDecimation_, kNumChannels_,
+                                kArenaBytes_>::kNumChannels;
+template <int kBlockSize_, int kDecimation_, int kNumChannels_,
+          int kArenaBytes_>
+constexpr int TactileProcessorT<kBlockSize_, kDecimation_, kNumChannels_,
+                                kArenaBytes_>::kArenaBytes;
+template <int kBlockSize_, int kDecimation_, int kNumChannels_,
+          int kArenaBytes_>
+constexpr int TactileProcessorT<kBlockSize_, kDecimation_, kNumChannels_,
+                                kArenaBytes_>::kMaxOutputBlockSize;
+
+}  // namespace audio_tactile
+
+#endif  // AUDIO_TO_TACTILE_SRC_CPP_TACTILE_PROCESSOR_T_H_
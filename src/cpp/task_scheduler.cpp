@@ -0,0 +1,116 @@
+// Copyright 2022 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "cpp/task_scheduler.h"  // NOLINT(build/include)
+
+namespace audio_tactile {
+
+TaskScheduler::TaskScheduler(GetTicksFun get_ticks)
+    : get_ticks_(get_ticks),
+      num_tasks_(0),
+      ready_mask_(0),
+      current_task_(-1),
+      current_start_ticks_(0),
+      num_missed_deadlines_(0) {}
+
+int TaskScheduler::AddTask(TaskFun fun, void* context, int priority,
+                           uint32_t deadline_ticks, uint32_t slice_ticks) {
+  if (num_tasks_ >= kMaxTasks || fun == nullptr) { return -1; }
+  Task& task = tasks_[num_tasks_];
+  task.fun = fun;
+  task.context = context;
+  task.priority = priority;
+  task.deadline_ticks = deadline_ticks;
+  task.slice_ticks = slice_ticks;
+  task.posted_ticks = 0;
+  return num_tasks_++;
+}
+
+void TaskScheduler::Post(int task) {
+  if (!(0 <= task && task < num_tasks_)) { return; }
+  const uint32_t bit = UINT32_C(1) << task;
+  // The posted time is only written while the task isn't ready, since the main
+  // loop reads it only while the task is ready.
+  if (!(__atomic_load_n(&ready_mask_, __ATOMIC_ACQUIRE) & bit)) {
+    tasks_[task].posted_ticks = get_ticks_();
+  }
+  __atomic_fetch_or(&ready_mask_, bit, __ATOMIC_RELEASE);
+}
+
+int TaskScheduler::SelectTask(uint32_t ready, uint32_t now) const {
+  int best = -1;
+  int32_t best_slack = 0;
+  for (int i = 0; ready; ++i, ready >>= 1) {
+    if (!(ready & 1)) { continue; }
+    const Task& task = tasks_[i];
+    // Ticks left until the deadline, negative if it has passed. Computed by
+    // unsigned difference so that tick wraparound is handled.
+    const int32_t slack = static_cast<int32_t>(
+        task.posted_ticks + task.deadline_ticks - now);
+    if (best == -1 || task.priority < tasks_[best].priority ||
+        (task.priority == tasks_[best].priority && slack < best_slack)) {
+      best = i;
+      best_slack = slack;
+    }
+  }
+  return best;
+}
+
+bool TaskScheduler::RunOnce() {
+  const uint32_t ready = __atomic_load_n(&ready_mask_, __ATOMIC_ACQUIRE);
+  if (!ready) { return false; }
+  const uint32_t now = get_ticks_();
+  const int index = SelectTask(ready, now);
+  Task& task = tasks_[index];
+  if (now - task.posted_ticks > task.deadline_ticks) {
+    ++num_missed_deadlines_;
+  }
+
+  // Clear the ready bit before running, so that a Post() during the run makes
+  // the task run again.
+  const uint32_t bit = UINT32_C(1) << index;
+  __atomic_fetch_and(&ready_mask_, ~bit, __ATOMIC_ACQ_REL);
+  current_task_ = index;
+  current_start_ticks_ = now;
+  const bool more_work = task.fun(task.context);
+  current_task_ = -1;
+
+  if (more_work) {
+    // Keep the task ready with its original posted time, so that its deadline
+    // doesn't move while it is resumed slice by slice.
+    __atomic_fetch_or(&ready_mask_, bit, __ATOMIC_RELEASE);
+  }
+  return true;
+}
+
+void TaskScheduler::RunUntilIdle(IdleFun idle) {
+  while (RunOnce()) {}
+  if (idle) { idle(); }
+}
+
+bool TaskScheduler::ShouldYield() const {
+  if (current_task_ < 0) { return false; }
+  const Task& task = tasks_[current_task_];
+  if (task.slice_ticks > 0 &&
+      get_ticks_() - current_start_ticks_ >= task.slice_ticks) {
+    return true;
+  }
+  uint32_t ready = __atomic_load_n(&ready_mask_, __ATOMIC_ACQUIRE);
+  for (int i = 0; ready; ++i, ready >>= 1) {
+    if ((ready & 1) && tasks_[i].priority < task.priority) { return true; }
+  }
+  return false;
+}
+
+}  // namespace audio_tactile
@@ -0,0 +1,153 @@
+// Copyright 2022 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+// TaskScheduler, a small cooperative scheduler for the firmware main loop.
+//
+// Firmware work is triggered by interrupt handlers: a mic buffer is ready, a
+// message arrived over serial or BLE, a PWM sequence ended. Rather than polling
+// flags in `loop()`, each kind of work is a task, which interrupt handlers post
+// to mark ready. The main loop then runs ready tasks, most urgent first:
+//
+//  * Tasks with a lower `priority` value run first. Audio processing should
+//    have the highest priority (lowest value), with BLE, settings, and LED
+//    work at lower priorities.
+//  * Among ready tasks of equal priority, the one closest to its deadline runs
+//    first. A task's deadline is `deadline_ticks` after it was posted. Tasks
+//    started after their deadline are counted in num_missed_deadlines().
+//
+// Scheduling is cooperative, so a running task is never preempted by another
+// task. A long job, like a flash write or LED animation, should be split into
+// slices: the task function returns true while it has more work, so that it
+// stays ready and resumes on a later run, and may call ShouldYield() to
+// return early when a more urgent task is ready or its `slice_ticks` are used
+// up. This way a slow job never delays the next audio buffer by more than a
+// slice.
+//
+// When no task is ready, RunUntilIdle() calls an idle function to sleep the CPU
+// until the next interrupt. On nRF52 with SEVONPEND set (SCB->SCR), any pending
+// interrupt wakes WFE, even while interrupts are masked, so that an interrupt
+// after checking for ready tasks isn't missed:
+//
+//   void Sleep() {
+//     __disable_irq();
+//     if (!g_scheduler.has_ready_tasks()) { __WFE(); }
+//     __enable_irq();
+//   }
+//
+// Time is measured in ticks from ProfilerGetTicks() (see tactile/profiler.h),
+// which are CPU cycles on nRF52, or from a function passed to the constructor.
+//
+// Example use:
+//   TaskScheduler g_scheduler;
+//   int g_audio_task;
+//
+//   bool ProcessAudio(void* context) { ...; return false; }
+//   void OnPdmMicBuffer() { g_scheduler.Post(g_audio_task); }  // Interrupt.
+//
+//   void setup() {
+//     g_audio_task = g_scheduler.AddTask(ProcessAudio, nullptr,
+//                                        /*priority=*/0, kBufferPeriodTicks);
+//     ...
+//   }
+//
+//   void loop() { g_scheduler.RunUntilIdle(Sleep); }
+//
+// Post() is safe to call from interrupt handlers. All other methods should be
+// called only from the main loop. Synchronization uses the GCC/Clang
+// `__atomic` builtins, like SpscRingBuffer.
+
+#ifndef AUDIO_TO_TACTILE_SRC_CPP_TASK_SCHEDULER_H_
+#define AUDIO_TO_TACTILE_SRC_CPP_TASK_SCHEDULER_H_
+
+#include <stdint.h>
+
+#include "tactile/profiler.h"
+
+namespace audio_tactile {
+
+class TaskScheduler {
+ public:
+  enum {
+    // Max number of tasks.
+    kMaxTasks = 16,
+  };
+
+  // Task function. Returns true if the task has more work, in which case it
+  // stays ready and runs again later.
+  typedef bool (*TaskFun)(void* context);
+  // Function returning the current time in ticks.
+  typedef uint32_t (*GetTicksFun)();
+  // Function to call when no task is ready, e.g. to sleep the CPU.
+  typedef void (*IdleFun)();
+
+  explicit TaskScheduler(GetTicksFun get_ticks = ProfilerGetTicks);
+
+  // Adds a task calling `fun(context)`, with `priority` (lower runs first) and
+  // a deadline `deadline_ticks` after it is posted. If `slice_ticks` is
+  // positive, ShouldYield() returns true once the task has run that long.
+  // Returns the task's index, or -1 if there are already kMaxTasks tasks.
+  int AddTask(TaskFun fun, void* context, int priority,
+              uint32_t deadline_ticks, uint32_t slice_ticks = 0);
+
+  // Marks `task` as ready to run. Safe to call from interrupt handlers. If the
+  // task is already ready, it keeps its earlier deadline.
+  void Post(int task);
+
+  // Runs the most urgent ready task. Returns false if no task was ready.
+  bool RunOnce();
+
+  // Runs ready tasks until none are ready, then calls `idle` if it is nonnull.
+  void RunUntilIdle(IdleFun idle);
+
+  // Called by a running task to check whether it should return early: true if
+  // a higher priority task is ready or the task's slice is used up.
+  bool ShouldYield() const;
+
+  // Whether any task is ready.
+  bool has_ready_tasks() const {
+    return __atomic_load_n(&ready_mask_, __ATOMIC_ACQUIRE) != 0;
+  }
+  // Index of the running task, or -1 if none.
+  int current_task() const { return current_task_; }
+  // Number of times a task started after its deadline.
+  uint32_t num_missed_deadlines() const { return num_missed_deadlines_; }
+
+ private:
+  struct Task {
+    TaskFun fun;
+    void* context;
+    int priority;
+    uint32_t deadline_ticks;
+    uint32_t slice_ticks;
+    // Time when the task was posted, written by Post() while not ready.
+    uint32_t posted_ticks;
+  };
+
+  // Finds the most urgent ready task, or returns -1 if none.
+  int SelectTask(uint32_t ready, uint32_t now) const;
+
+  GetTicksFun get_ticks_;
+  Task tasks_[kMaxTasks];
+  int num_tasks_;
+  // Bit `i` is set if task `i` is ready.
+  uint32_t ready_mask_;
+  int current_task_;
+  uint32_t current_start_ticks_;
+  uint32_t num_missed_deadlines_;
+};
+
+}  // namespace audio_tactile
+
+#endif  // AUDIO_TO_TACTILE_SRC_CPP_TASK_SCHEDULER_H_
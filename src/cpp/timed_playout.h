@@ -0,0 +1,178 @@
+// Copyright 2022 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+// TimedPlayout, a queue of timestamped blocks played at their presentation
+// times, for synchronized playback on multiple devices.
+//
+// Blocks arrive in kTimedTactorsSamples messages stamped with a presentation
+// time on the streaming app's clock. The receiver converts it to its local
+// clock with ClockSync (see cpp/clock_sync.h) and pushes the block. The
+// consumer, e.g. the PWM sequence end interrupt, calls Pop() once per block
+// period with the local time, and gets the front block if it is due:
+//
+//  * A block is due if its presentation time is within half a block period of
+//    the current time. Then all devices play it in the same period, and the
+//    inter-device skew is at most half a block period plus the clock sync
+//    error.
+//  * A block more than half a period early is held, and Pop() returns false,
+//    e.g. to play silence, since the stream is ahead of schedule.
+//  * A block more than half a period late is dropped, so that a device that
+//    fell behind, e.g. after a burst of retransmissions, catches up.
+//
+// Unlike JitterBuffer (see cpp/jitter_buffer.h), which adapts buffering to the
+// measured jitter of each device on its own, the buffering here is set by the
+// sender, as the lead of the presentation time over the sending time, which
+// must cover the worst-case BLE delay of all devices. This costs no more
+// buffering than the slowest device needs anyway.
+//
+// Push() and Pop() may be called from different threads or interrupts: blocks
+// are passed through an SpscRingBuffer. Call Push() from one producer and Pop()
+// from one consumer.
+//
+// Example use:
+//   TimedPlayout<uint8_t, kNumTotalPwm * kNumPwmValues, 16> playout;
+//   playout.Init(kPwmBlockPeriodUs);
+//
+//   // On kTimedTactorsSamples.
+//   if (message.ReadTimedTactorsSamples(&presentation_us, samples) &&
+//       clock_sync.synced()) {
+//     playout.Push(samples, clock_sync.ReferenceToLocal(presentation_us));
+//   }
+//
+//   // Once per block period.
+//   uint8_t output[kNumTotalPwm * kNumPwmValues];
+//   if (playout.Pop(micros(), output)) { Play(output); }
+
+#ifndef AUDIO_TO_TACTILE_SRC_CPP_TIMED_PLAYOUT_H_
+#define AUDIO_TO_TACTILE_SRC_CPP_TIMED_PLAYOUT_H_
+
+#include <stdint.h>
+#include <string.h>
+
+#include "cpp/spsc_ring_buffer.h"
+
+namespace audio_tactile {
+
+// Playout statistics of a TimedPlayout.
+struct TimedPlayoutStats {
+  // Number of blocks played.
+  uint32_t num_played;
+  // Number of blocks dropped for arriving after their presentation time, or on
+  // overflow.
+  uint32_t num_dropped;
+  // Number of Pop() calls that waited for the front block to be due.
+  uint32_t num_waits;
+  // Presentation time minus the Pop() time of the last played block in
+  // microseconds. Positive means the block played early.
+  int32_t last_skew_us;
+};
+
+template <typename T, int kBlockSize_, int kCapacity_>
+class TimedPlayout {
+ public:
+  enum {
+    kBlockSize = kBlockSize_,
+    kCapacity = kCapacity_,
+  };
+
+  static_assert(kBlockSize > 0, "Block size must be positive");
+
+  TimedPlayout() noexcept: half_period_us_(0) { Reset(); }
+  TimedPlayout(const TimedPlayout&) = delete;  // No copying.
+  TimedPlayout& operator=(const TimedPlayout&) = delete;
+
+  // Initializes with the period in microseconds between Pop() calls.
+  void Init(uint32_t block_period_us) {
+    half_period_us_ = static_cast<int32_t>(block_period_us / 2);
+    Reset();
+  }
+
+  // Resets to initial state. This should be called from the consumer while the
+  // producer is idle.
+  void Reset() {
+    while (queue_.Front() != nullptr) { queue_.PopFront(); }
+    num_overflows_ = 0;
+    stats_.num_played = 0;
+    stats_.num_dropped = 0;
+    stats_.num_waits = 0;
+    stats_.last_skew_us = 0;
+  }
+
+  // Producer: Pushes a block of kBlockSize samples to be presented at local
+  // time `presentation_us` in microseconds. The time may wrap around. Returns
+  // false if the queue is full, in which case the block is dropped.
+  bool Push(const T* block, uint32_t presentation_us) {
+    Block* slot = queue_.BeginPush();
+    if (slot == nullptr) {
+      ++num_overflows_;
+      return false;
+    }
+    memcpy(slot->samples, block, sizeof(slot->samples));
+    slot->presentation_us = presentation_us;
+    queue_.EndPush();
+    return true;
+  }
+
+  // Consumer: Gets the block due at local time `now_us` into `output`. Returns
+  // true if a block is due, or false if the queue is empty or its front block
+  // is early, in which case `output` is unchanged.
+  bool Pop(uint32_t now_us, T* output) {
+    const Block* front;
+    while ((front = queue_.Front()) != nullptr) {
+      const int32_t lead_us =
+          static_cast<int32_t>(front->presentation_us - now_us);
+      if (lead_us > half_period_us_) {
+        ++stats_.num_waits;
+        return false;
+      } else if (lead_us >= -half_period_us_) {
+        memcpy(output, front->samples, sizeof(front->samples));
+        queue_.PopFront();
+        ++stats_.num_played;
+        stats_.last_skew_us = lead_us;
+        return true;
+      }
+      queue_.PopFront();  // Too late to play.
+      ++stats_.num_dropped;
+    }
+    return false;
+  }
+
+  // Number of queued blocks.
+  int depth() const { return queue_.size(); }
+
+  // Consumer: Gets playout statistics.
+  TimedPlayoutStats stats() const {
+    TimedPlayoutStats stats = stats_;
+    stats.num_dropped += num_overflows_;
+    return stats;
+  }
+
+ private:
+  struct Block {
+    T samples[kBlockSize];
+    uint32_t presentation_us;
+  };
+
+  SpscRingBuffer<Block, kCapacity> queue_;
+  int32_t half_period_us_;
+  // Producer state.
+  uint32_t num_overflows_;
+  // Consumer state.
+  TimedPlayoutStats stats_;
+};
+
+}  // namespace audio_tactile
+
+#endif  // AUDIO_TO_TACTILE_SRC_CPP_TIMED_PLAYOUT_H_
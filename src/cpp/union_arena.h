@@ -0,0 +1,111 @@
+// Copyright 2022 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+// UnionArena, static storage shared by mutually exclusive subsystems.
+//
+// Like a C union, UnionArena<kSize> holds the objects of at most one owner at
+// a time in a fixed buffer of kSize bytes, so that subsystems that are never
+// used together, e.g. those for different input modes, don't each need their
+// own static memory. Owners are identified by nonzero int ids. An owner claims
+// the buffer with Claim(), which returns an Arena (dsp/arena.h) over the whole
+// buffer, and lays out its objects with ArenaAlloc() or FooInitInBuffer().
+//
+// Claiming discards whatever the previous owner had in the buffer, so the
+// previous owner must stop using its objects first. This pairs naturally with
+// lazy construction, where each subsystem is built on first use:
+//
+//   UnionArena<32768> g_arena;
+//   enum { kOwnerProcessor = 1, kOwnerPatternCache };
+//
+//   Processor* GetProcessor() {
+//     if (!g_arena.Owns(kOwnerProcessor)) {
+//       Arena* arena = g_arena.Claim(kOwnerProcessor);
+//       g_processor = ProcessorInitInBuffer(
+//           arena->next, arena->end - arena->next, &params);
+//     }
+//     return g_processor;
+//   }
+//
+// Objects in the buffer are not destroyed when the owner changes; owners should
+// be trivially destructible C structs, as is the case for objects supporting
+// FooInitInBuffer().
+
+#ifndef AUDIO_TO_TACTILE_SRC_CPP_UNION_ARENA_H_
+#define AUDIO_TO_TACTILE_SRC_CPP_UNION_ARENA_H_
+
+#include <stddef.h>
+
+#include "dsp/arena.h"
+
+namespace audio_tactile {
+
+template <int kSize_>
+class UnionArena {
+ public:
+  enum { kSize = kSize_, kNoOwner = 0 };
+  static_assert(kSize > kArenaAlignmentSlack, "kSize is too small");
+
+  UnionArena(): owner_(kNoOwner), peak_bytes_(0) {
+    ArenaInit(&arena_, buffer_, kSize);
+  }
+  UnionArena(const UnionArena&) = delete;  // No copying.
+  UnionArena& operator=(const UnionArena&) = delete;
+
+  // Claims the buffer for `owner`, a nonzero id, discarding the objects of the
+  // previous owner, if any. Returns an empty Arena over the whole buffer. This
+  // also resets the arena if `owner` already owns it.
+  Arena* Claim(int owner) {
+    UpdatePeak();
+    owner_ = owner;
+    ArenaInit(&arena_, buffer_, kSize);
+    return &arena_;
+  }
+
+  // Releases the buffer if it is owned by `owner`.
+  void Release(int owner) {
+    if (owner_ == owner) {
+      UpdatePeak();
+      owner_ = kNoOwner;
+      ArenaInit(&arena_, buffer_, kSize);
+    }
+  }
+
+  // Returns true if the buffer is owned by `owner`.
+  bool Owns(int owner) const { return owner != kNoOwner && owner_ == owner; }
+  // Id of the current owner, or kNoOwner.
+  int owner() const { return owner_; }
+
+  // Bytes allocated by the current owner, including alignment padding.
+  size_t bytes_used() const {
+    return static_cast<size_t>(arena_.next - buffer_);
+  }
+  // Max of bytes_used() over all owners so far, for measuring peak RAM.
+  size_t peak_bytes_used() const {
+    const size_t used = bytes_used();
+    return (used > peak_bytes_) ? used : peak_bytes_;
+  }
+
+ private:
+  void UpdatePeak() { peak_bytes_ = peak_bytes_used(); }
+
+  char buffer_[kSize];
+  Arena arena_;
+  int owner_;
+  size_t peak_bytes_;
+};
+
+}  // namespace audio_tactile
+
+#endif  // AUDIO_TO_TACTILE_SRC_CPP_UNION_ARENA_H_
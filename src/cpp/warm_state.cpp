@@ -0,0 +1,48 @@
+// Copyright 2022 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "cpp/warm_state.h"
+
+#include "dsp/serialize.h"
+
+namespace audio_tactile {
+namespace {
+// Start of a serialized warm state, "WS".
+constexpr uint16_t kWarmStateMagic = 0x5357;
+}  // namespace
+
+void SerializeWarmState(const float* values, int num_values, uint8_t* dest) {
+  ::LittleEndianWriteU16(kWarmStateMagic, dest);
+  ::LittleEndianWriteU16(static_cast<uint16_t>(num_values), dest + 2);
+  ::LittleEndianWriteF32Array(values, num_values, dest + 4);
+  const int checksum_offset = 4 + 4 * num_values;
+  ::LittleEndianWriteU16(::Fletcher16(dest, checksum_offset, 1),
+                         dest + checksum_offset);
+}
+
+bool DeserializeWarmState(const uint8_t* src, int size, float* values,
+                          int num_values) {
+  const int checksum_offset = 4 + 4 * num_values;
+  if (size != WarmStateSerializedSize(num_values) ||
+      ::LittleEndianReadU16(src) != kWarmStateMagic ||
+      ::LittleEndianReadU16(src + 2) != num_values ||
+      ::LittleEndianReadU16(src + checksum_offset) !=
+          ::Fletcher16(src, checksum_offset, 1)) {
+    return false;
+  }
+  ::LittleEndianReadF32Array(src + 4, num_values, values);
+  return true;
+}
+
+}  // namespace audio_tactile
@@ -0,0 +1,61 @@
+// Copyright 2022 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+// Serialization of processor "warm" state for persisting across reboots.
+//
+// The Enveloper noise estimates, CARL frontend PCEN denominators, and
+// PostProcessor output limit adapt over seconds, so after a reset the output is
+// poorly gated until they settle. TactileProcessorGetWarmState() and
+// PostProcessorGetWarmState() get this state as an array of floats. The
+// functions here serialize such an array for saving to flash, as
+//
+//   Offset  Size  Field
+//   0       2     kWarmStateMagic
+//   2       2     num_values
+//   4       4*N   values as float32, N = num_values
+//   4+4N    2     Fletcher-16 checksum of the preceding bytes
+//
+// with multibyte values in little endian order. Since the number of values
+// depends on the processor configuration, deserializing checks that it
+// matches, so that state saved by a different configuration is rejected.
+
+#ifndef AUDIO_TO_TACTILE_SRC_CPP_WARM_STATE_H_
+#define AUDIO_TO_TACTILE_SRC_CPP_WARM_STATE_H_
+
+#include <stdint.h>
+
+namespace audio_tactile {
+
+// Max number of values supported in a warm state.
+constexpr int kWarmStateMaxValues = 128;
+
+// Number of bytes to serialize a warm state of `num_values` values.
+constexpr int WarmStateSerializedSize(int num_values) {
+  return 6 + 4 * num_values;
+}
+
+// Serializes `num_values` values, writing WarmStateSerializedSize(num_values)
+// bytes to `dest`.
+void SerializeWarmState(const float* values, int num_values, uint8_t* dest);
+
+// Deserializes a warm state of `size` bytes into `values`. Returns true on
+// success, or false if the data is invalid or doesn't have `num_values`
+// values, in which case `values` is unchanged.
+bool DeserializeWarmState(const uint8_t* src, int size, float* values,
+                          int num_values);
+
+}  // namespace audio_tactile
+
+#endif  // AUDIO_TO_TACTILE_SRC_CPP_WARM_STATE_H_
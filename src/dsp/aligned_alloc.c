@@ -0,0 +1,51 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/aligned_alloc.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/* The allocation is over-allocated by kAlignedAllocAlignment - 1 bytes for
+ * alignment plus one pointer, and the pointer returned by malloc() is stored
+ * just before the aligned block for AlignedFree():
+ *
+ *   [padding][malloc pointer][aligned block of `size` bytes]
+ */
+void* AlignedAlloc(size_t size) {
+  const size_t overhead = sizeof(void*) + (kAlignedAllocAlignment - 1);
+  if (size > SIZE_MAX - overhead) { return NULL; }
+  void* allocation = malloc(size + overhead);
+  if (allocation == NULL) { return NULL; }
+  const uintptr_t aligned =
+      ((uintptr_t)allocation + overhead) &
+      ~(uintptr_t)(kAlignedAllocAlignment - 1);
+  memcpy((void**)aligned - 1, &allocation, sizeof(void*));
+  return (void*)aligned;
+}
+
+void* AlignedCalloc(size_t num, size_t size) {
+  if (size != 0 && num > SIZE_MAX / size) { return NULL; }
+  void* ptr = AlignedAlloc(num * size);
+  if (ptr != NULL) { memset(ptr, 0, num * size); }
+  return ptr;
+}
+
+void AlignedFree(void* ptr) {
+  if (ptr == NULL) { return; }
+  void* allocation;
+  memcpy(&allocation, (void**)ptr - 1, sizeof(void*));
+  free(allocation);
+}
@@ -0,0 +1,71 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * Heap allocation aligned for SIMD.
+ *
+ * Plain malloc() only guarantees alignment for the largest scalar type, so
+ * vector kernels reading malloc'd buffers must use unaligned loads or peel
+ * loops. `AlignedAlloc()` returns memory aligned to kAlignedAllocAlignment,
+ * the same cache-line alignment as Arena allocations (see arena.h), so that
+ * buffers from FooMake() and FooInitInBuffer() have the same guarantee.
+ * Memory from AlignedAlloc() or AlignedCalloc() must be freed with
+ * AlignedFree(), never free().
+ *
+ * Example use:
+ *   float* buffer = (float*)AlignedAlloc(sizeof(float) * num_samples);
+ *   ...
+ *   AlignedFree(buffer);
+ */
+
+#ifndef AUDIO_TO_TACTILE_SRC_DSP_ALIGNED_ALLOC_H_
+#define AUDIO_TO_TACTILE_SRC_DSP_ALIGNED_ALLOC_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "dsp/arena.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Alignment in bytes of AlignedAlloc() allocations. Must be a power of 2. */
+#define kAlignedAllocAlignment kArenaAlignment
+
+/* Allocates `size` bytes aligned to kAlignedAllocAlignment. Returns NULL on
+ * failure. Free with AlignedFree().
+ */
+void* AlignedAlloc(size_t size);
+
+/* Same as AlignedAlloc(), for an array of `num` elements of `size` bytes each,
+ * with the memory set to zero. Returns NULL on failure or overflow.
+ */
+void* AlignedCalloc(size_t num, size_t size);
+
+/* Frees memory from AlignedAlloc() or AlignedCalloc(). Does nothing if `ptr`
+ * is NULL.
+ */
+void AlignedFree(void* ptr);
+
+/* Returns 1 if `ptr` is aligned to `alignment` bytes, a power of 2. */
+static int /*bool*/ AlignedAllocIsAligned(const void* ptr,
+                                           size_t alignment) {
+  return ((uintptr_t)ptr & (alignment - 1)) == 0;
+}
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif
+#endif /* AUDIO_TO_TACTILE_SRC_DSP_ALIGNED_ALLOC_H_ */
@@ -0,0 +1,97 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * Arena, a bump allocator over a caller-provided buffer.
+ *
+ * This is used to lay out an object and its arrays contiguously in one buffer,
+ * so that firmware can avoid the heap. Objects supporting this have a pair of
+ * functions following the pattern
+ *
+ *   size_t FooRequiredBytes(const FooParams* params);
+ *   Foo* FooInitInBuffer(void* buffer, size_t buffer_size,
+ *                        const FooParams* params);
+ *
+ * where FooRequiredBytes() computes the buffer size for FooInitInBuffer() by
+ * summing ArenaAllocationSize() of each allocation plus kArenaAlignmentSlack.
+ * The buffer need not be aligned. It is owned by the caller and must outlive
+ * the object. Example:
+ *
+ *   Arena arena;
+ *   ArenaInit(&arena, buffer, buffer_size);
+ *   Foo* foo = (Foo*)ArenaAlloc(&arena, sizeof(Foo));
+ *   foo->values = (float*)ArenaAlloc(&arena, sizeof(float) * num_values);
+ *
+ * All allocations are aligned to kArenaAlignment, a cache line on Cortex-M and
+ * x86, so that separate arrays don't share cache lines.
+ *
+ * NOTE: Functions below are marked `static` [the C analogy for `inline`] so
+ * that ideally they get inline expanded.
+ */
+
+#ifndef AUDIO_TO_TACTILE_SRC_DSP_ARENA_H_
+#define AUDIO_TO_TACTILE_SRC_DSP_ARENA_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Alignment in bytes of arena allocations. Must be a power of 2. */
+#define kArenaAlignment 64
+/* Extra bytes needed to align the start of an unaligned buffer. */
+#define kArenaAlignmentSlack (kArenaAlignment - 1)
+
+typedef struct {
+  /* Next free byte, aligned to kArenaAlignment. */
+  char* next;
+  /* End of the buffer. */
+  char* end;
+} Arena;
+
+/* Number of bytes used by an allocation of `size` bytes, rounded up to a
+ * multiple of kArenaAlignment.
+ */
+static size_t ArenaAllocationSize(size_t size) {
+  return (size + (kArenaAlignment - 1)) & ~(size_t)(kArenaAlignment - 1);
+}
+
+/* Initializes `arena` to allocate from `buffer` of `buffer_size` bytes. */
+static void ArenaInit(Arena* arena, void* buffer, size_t buffer_size) {
+  const size_t padding = (size_t)(
+      (kArenaAlignment - (uintptr_t)buffer % kArenaAlignment) %
+      kArenaAlignment);
+  arena->end = (char*)buffer + buffer_size;
+  /* If the buffer is too small to align, make the arena empty. */
+  arena->next = (padding <= buffer_size) ? (char*)buffer + padding
+                                         : arena->end;
+}
+
+/* Allocates `size` bytes from `arena`, aligned to kArenaAlignment. Returns NULL
+ * if there isn't enough space.
+ */
+static void* ArenaAlloc(Arena* arena, size_t size) {
+  const size_t allocation_size = ArenaAllocationSize(size);
+  if ((size_t)(arena->end - arena->next) < allocation_size) { return NULL; }
+  void* result = arena->next;
+  arena->next += allocation_size;
+  return result;
+}
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif
+#endif /* AUDIO_TO_TACTILE_SRC_DSP_ARENA_H_ */
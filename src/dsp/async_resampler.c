@@ -0,0 +1,336 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/async_resampler.h"
+
+#include <assert.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "dsp/aligned_alloc.h"
+#include "dsp/arena.h"
+#include "dsp/dot_product.h"
+#include "dsp/math_constants.h"
+#include "dsp/q_resampler_kernel.h"
+
+const AsyncResamplerOptions kAsyncResamplerDefaultOptions = {
+    /*filter_radius_factor=*/5.0f,
+    /*cutoff_proportion=*/0.9f,
+    /*kaiser_beta=*/5.658f,
+    /*kernel_table_phases=*/128,
+    /*target_fill_frames=*/0,
+    /*loop_bandwidth_hz=*/0.1f,
+    /*max_ratio_deviation=*/0.005f,
+};
+
+/* Scale factor for 32.32 fixed point. */
+#define kFixedPointOne 4294967296.0
+
+struct AsyncResampler {
+  /* Kernel table with `table_phases` + 1 rows of `num_taps` coefficients,
+   * stored backward as in QResampler. Row j is the filter for phase
+   * j / table_phases.
+   */
+  float* filters;
+  int table_phases;
+  /* Buffer of num_taps floats for the interpolated filter. */
+  float* interpolated_filter;
+  /* Buffered input frames, with capacity for `capacity_frames` frames. */
+  float* buffer;
+  int capacity_frames;
+  int buffered_frames;
+  int num_channels;
+  int num_taps;
+  int radius;
+  int target_fill_frames;
+  /* Read position, the frame index in `buffer` where the filter for the next
+   * output frame starts, in 32.32 fixed point.
+   */
+  int position_frames;
+  uint32_t position_frac;
+  /* Position step per output frame, the current ratio, in 32.32 fixed point. */
+  int step_frames;
+  uint32_t step_frac;
+  /* Nominal ratio, input_sample_rate_hz / output_sample_rate_hz. */
+  double nominal_ratio;
+  /* Coefficient per output frame for smoothing the fill. */
+  double smoother_coeff;
+  double smoothed_fill;
+  /* PI controller gains per output frame and integrator state. */
+  double proportional_gain;
+  double integral_gain;
+  double integral;
+  double max_ratio_deviation;
+  /* Whether the buffer has filled to the target since the last underrun. */
+  int primed;
+  /* Buffer to free in AsyncResamplerFree(). */
+  void* allocation;
+};
+
+AsyncResampler* AsyncResamplerMake(float input_sample_rate_hz,
+                                   float output_sample_rate_hz,
+                                   int num_channels,
+                                   int max_input_frames,
+                                   const AsyncResamplerOptions* options) {
+  if (!options) {
+    options = &kAsyncResamplerDefaultOptions;
+  }
+  QResamplerKernel kernel;
+  if (!QResamplerKernelInit(
+          &kernel, input_sample_rate_hz, output_sample_rate_hz,
+          /*filter_radius_factor=*/options->filter_radius_factor,
+          /*cutoff_proportion=*/options->cutoff_proportion,
+          /*kaiser_beta=*/options->kaiser_beta) ||
+      num_channels <= 0 || max_input_frames <= 0 ||
+      options->kernel_table_phases <= 0 ||
+      options->target_fill_frames < 0 ||
+      !(options->loop_bandwidth_hz > 0.0f) ||
+      !(0.0f < options->max_ratio_deviation &&
+        options->max_ratio_deviation < 0.5f)) {
+    return NULL;
+  }
+
+  const int radius = (int)ceil(kernel.radius);
+  const int num_taps = 2 * radius + 1;
+  const int table_phases = options->kernel_table_phases;
+  const int target_fill_frames = (options->target_fill_frames > 0)
+      ? options->target_fill_frames : 2 * max_input_frames;
+  const int capacity_frames =
+      num_taps - 1 + 2 * target_fill_frames + max_input_frames;
+
+  const size_t required_bytes = kArenaAlignmentSlack +
+      ArenaAllocationSize(sizeof(AsyncResampler)) +
+      ArenaAllocationSize(sizeof(float) * (table_phases + 1) * num_taps) +
+      ArenaAllocationSize(sizeof(float) * num_taps) +
+      ArenaAllocationSize(sizeof(float) * capacity_frames * num_channels);
+  void* buffer = AlignedAlloc(required_bytes);
+  if (buffer == NULL) { return NULL; }
+  Arena arena;
+  ArenaInit(&arena, buffer, required_bytes);
+  AsyncResampler* resampler =
+      (AsyncResampler*)ArenaAlloc(&arena, sizeof(AsyncResampler));
+  resampler->filters = (float*)ArenaAlloc(
+      &arena, sizeof(float) * (table_phases + 1) * num_taps);
+  resampler->interpolated_filter =
+      (float*)ArenaAlloc(&arena, sizeof(float) * num_taps);
+  resampler->buffer = (float*)ArenaAlloc(
+      &arena, sizeof(float) * capacity_frames * num_channels);
+  /* The arena was sized for these allocations, so they can't fail. */
+  assert(resampler->buffer != NULL);
+
+  resampler->allocation = buffer;
+  resampler->table_phases = table_phases;
+  resampler->capacity_frames = capacity_frames;
+  resampler->num_channels = num_channels;
+  resampler->num_taps = num_taps;
+  resampler->radius = radius;
+  resampler->target_fill_frames = target_fill_frames;
+  resampler->nominal_ratio = (double)input_sample_rate_hz /
+      output_sample_rate_hz;
+  resampler->max_ratio_deviation = options->max_ratio_deviation;
+
+  /* The fill changes per output frame by the actual ratio minus the resampling
+   * ratio nominal_ratio * (1 + u). With u = kp e + ki sum(e), the loop has
+   * characteristic polynomial s^2 + nominal_ratio (kp s + ki). For a critically
+   * damped loop with natural frequency w (radians per output frame),
+   * kp = 2 w / nominal_ratio and ki = w^2 / nominal_ratio.
+   */
+  const double w = 2.0 * M_PI * options->loop_bandwidth_hz /
+      output_sample_rate_hz;
+  resampler->proportional_gain = 2.0 * w / resampler->nominal_ratio;
+  resampler->integral_gain = w * w / resampler->nominal_ratio;
+  resampler->smoother_coeff = 10.0 * w;
+
+  /* Compute the kernel table, as in QResampler's ComputeFilters(). */
+  float* coeffs = resampler->filters;
+  int phase;
+  for (phase = 0; phase <= table_phases; ++phase) {
+    const double offset = ((double)phase) / table_phases;
+    int k;
+    for (k = -radius; k <= radius; ++k) {
+      coeffs[radius - k] = (float)QResamplerKernelEval(&kernel, offset + k);
+    }
+    coeffs += num_taps;
+  }
+
+  AsyncResamplerReset(resampler);
+  return resampler;
+}
+
+void AsyncResamplerFree(AsyncResampler* resampler) {
+  if (resampler) {
+    AlignedFree(resampler->allocation);
+  }
+}
+
+/* Sets the ratio to nominal_ratio * (1 + deviation). */
+static void SetRatio(AsyncResampler* resampler, double deviation) {
+  const double ratio = resampler->nominal_ratio * (1.0 + deviation);
+  const int64_t step = (int64_t)(ratio * kFixedPointOne + 0.5);
+  resampler->step_frames = (int)(step >> 32);
+  resampler->step_frac = (uint32_t)step;
+}
+
+void AsyncResamplerReset(AsyncResampler* resampler) {
+  assert(resampler != NULL);
+  resampler->buffered_frames = 0;
+  resampler->position_frames = 0;
+  resampler->position_frac = 0;
+  resampler->smoothed_fill = 0.0;
+  resampler->integral = 0.0;
+  resampler->primed = 0;
+  SetRatio(resampler, 0.0);
+}
+
+int AsyncResamplerWrite(AsyncResampler* resampler, const float* input,
+                        int num_frames) {
+  assert(resampler != NULL);
+  assert(input != NULL);
+  assert(num_frames >= 0);
+  const int available = resampler->capacity_frames - resampler->buffered_frames;
+  if (num_frames > available) {
+    num_frames = available;  /* Drop excess frames on overflow. */
+  }
+  const int num_channels = resampler->num_channels;
+  memcpy(resampler->buffer + resampler->buffered_frames * num_channels, input,
+         sizeof(float) * num_frames * num_channels);
+  resampler->buffered_frames += num_frames;
+  return num_frames;
+}
+
+/* Updates the ratio from the fill error over a block of `num_frames`. */
+static void UpdateRatio(AsyncResampler* resampler, int num_frames) {
+  const double max_deviation = resampler->max_ratio_deviation;
+  /* Smooth the fill with a one-pole lowpass. */
+  double coeff = resampler->smoother_coeff * num_frames;
+  if (coeff > 1.0) { coeff = 1.0; }
+  resampler->smoothed_fill +=
+      coeff * (AsyncResamplerFillFrames(resampler) - resampler->smoothed_fill);
+  const double error =
+      resampler->smoothed_fill - resampler->target_fill_frames;
+  double integral = resampler->integral +
+      resampler->integral_gain * error * num_frames;
+  /* Clamp the integrator to prevent windup. */
+  if (integral > max_deviation) {
+    integral = max_deviation;
+  } else if (integral < -max_deviation) {
+    integral = -max_deviation;
+  }
+  resampler->integral = integral;
+
+  double deviation = resampler->proportional_gain * error + integral;
+  if (deviation > max_deviation) {
+    deviation = max_deviation;
+  } else if (deviation < -max_deviation) {
+    deviation = -max_deviation;
+  }
+  SetRatio(resampler, deviation);
+}
+
+int AsyncResamplerRead(AsyncResampler* resampler, float* output,
+                       int num_frames) {
+  assert(resampler != NULL);
+  assert(output != NULL);
+  assert(num_frames >= 0);
+  const int num_channels = resampler->num_channels;
+  const int num_taps = resampler->num_taps;
+  const int table_phases = resampler->table_phases;
+  const float table_scale = (float)(table_phases / kFixedPointOne);
+  int num_read = 0;
+
+  if (!resampler->primed &&
+      AsyncResamplerFillFrames(resampler) >= resampler->target_fill_frames) {
+    resampler->primed = 1;
+    resampler->smoothed_fill = resampler->target_fill_frames;
+  }
+
+  if (resampler->primed) {
+    UpdateRatio(resampler, num_frames);
+
+    const int step_frames = resampler->step_frames;
+    const uint32_t step_frac = resampler->step_frac;
+    int position_frames = resampler->position_frames;
+    uint32_t position_frac = resampler->position_frac;
+    for (; num_read < num_frames; ++num_read) {
+      if (position_frames + num_taps > resampler->buffered_frames) {
+        resampler->primed = 0;  /* Underrun. */
+        break;
+      }
+
+      /* Interpolate the filter for the fractional part of the position. */
+      const float table_position = position_frac * table_scale;
+      int row = (int)table_position;
+      if (row >= table_phases) { row = table_phases - 1; }
+      const float* row0 = resampler->filters + row * num_taps;
+      InterpolateFilter(row0, row0 + num_taps, table_position - row, num_taps,
+                        resampler->interpolated_filter);
+
+      const float* input = resampler->buffer + position_frames * num_channels;
+      float* output_frame = output + num_read * num_channels;
+      if (num_channels == 1) {
+        output_frame[0] =
+            MonoDotProduct(resampler->interpolated_filter, input, num_taps);
+      } else {
+        int c;
+        for (c = 0; c < num_channels; ++c) {
+          output_frame[c] = 0.0f;
+        }
+        AccumulateMultichannelDotProducts(resampler->interpolated_filter,
+                                          num_taps, input, num_channels,
+                                          output_frame);
+      }
+
+      const uint32_t next_frac = position_frac + step_frac;
+      position_frames += step_frames + (next_frac < position_frac);
+      position_frac = next_frac;
+    }
+
+    /* Discard consumed input frames. */
+    if (position_frames > resampler->buffered_frames) {
+      position_frames = resampler->buffered_frames;
+    }
+    resampler->buffered_frames -= position_frames;
+    memmove(resampler->buffer,
+            resampler->buffer + position_frames * num_channels,
+            sizeof(float) * resampler->buffered_frames * num_channels);
+    resampler->position_frames = 0;
+    resampler->position_frac = position_frac;
+  }
+
+  /* Zero the rest of the output if priming or underrun. */
+  memset(output + num_read * num_channels, 0,
+         sizeof(float) * (num_frames - num_read) * num_channels);
+  return num_read;
+}
+
+double AsyncResamplerFillFrames(const AsyncResampler* resampler) {
+  return resampler->buffered_frames - (resampler->num_taps - 1) -
+      (resampler->position_frames +
+       resampler->position_frac / kFixedPointOne);
+}
+
+int AsyncResamplerTargetFillFrames(const AsyncResampler* resampler) {
+  return resampler->target_fill_frames;
+}
+
+double AsyncResamplerRatio(const AsyncResampler* resampler) {
+  return resampler->step_frames + resampler->step_frac / kFixedPointOne;
+}
+
+int AsyncResamplerNumChannels(const AsyncResampler* resampler) {
+  return resampler->num_channels;
+}
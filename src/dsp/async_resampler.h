@@ -0,0 +1,156 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * Asynchronous sample rate converter (ASRC) for clock drift.
+ *
+ * When samples are produced under one clock and consumed under another, for
+ * instance audio streamed over BLE from a phone and played on the sleeve's PWM
+ * clock, the two nominally equal rates differ by some tens of ppm. A plain
+ * FIFO between them slowly overruns or underruns, unless it has a large safety
+ * margin that adds latency. `AsyncResampler` instead resamples by a slowly
+ * varying ratio that tracks the actual clock ratio, keeping the FIFO at a
+ * small, constant depth.
+ *
+ * The producer writes input frames in arbitrary sized chunks with
+ * AsyncResamplerWrite(), and the consumer reads output frames in blocks with
+ * AsyncResamplerRead(). Each read, the buffered input depth ("fill") is
+ * compared with `target_fill_frames`, and a PI controller adjusts the
+ * resampling ratio to hold the fill at the target, cancelling the drift:
+ *
+ *   ratio = nominal_ratio * (1 + kp * error + ki * integral(error dt)),
+ *
+ * with gains set for a critically damped loop of bandwidth
+ * `loop_bandwidth_hz`. Since writes are bursty, the fill sawtooths by about a
+ * packet between reads. So that this jitter doesn't modulate the ratio, the
+ * fill is smoothed by a one-pole lowpass at 10 times the loop bandwidth, and
+ * the loop bandwidth should be low, e.g. the default 0.1 Hz.
+ *
+ * Resampling uses the same Kaiser-windowed sinc kernel as QResampler (see
+ * dsp/q_resampler.h) in its interpolated kernel table form: filters for
+ * `kernel_table_phases` + 1 evenly-spaced fractional phases are precomputed,
+ * and the filter for an arbitrary phase is linearly interpolated between the
+ * nearest two. The position in the input is tracked in 32.32 fixed point,
+ * allowing ratio adjustments finer than 1 ppm.
+ *
+ * Until the fill first reaches the target, and after an underrun, Read()
+ * outputs zeros while the buffer refills. If a Write() would overflow the
+ * buffer, which holds 2 * target_fill_frames + max_input_frames frames beyond
+ * the filter history, the excess frames are dropped.
+ *
+ * NOTE: Write() and Read() modify shared state and must not be called
+ * concurrently. On firmware, call Write() from the same task as Read(), e.g.
+ * by passing received packets to the task through a queue.
+ *
+ * Example use:
+ *   AsyncResampler* resampler = AsyncResamplerMake(
+ *       16000.0f, 16000.0f, num_channels, max_input_frames, NULL);
+ *
+ *   // When a packet arrives.
+ *   AsyncResamplerWrite(resampler, packet_samples, num_packet_frames);
+ *
+ *   // When the consumer needs a block.
+ *   AsyncResamplerRead(resampler, output, block_size);
+ *
+ *   AsyncResamplerFree(resampler);
+ */
+
+#ifndef AUDIO_TO_TACTILE_SRC_DSP_ASYNC_RESAMPLER_H_
+#define AUDIO_TO_TACTILE_SRC_DSP_ASYNC_RESAMPLER_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+  /* Kernel parameters, with the same meaning and defaults as in
+   * QResamplerOptions: radius factor 5.0, cutoff proportion 0.9, and Kaiser
+   * beta 5.658.
+   */
+  float filter_radius_factor;
+  float cutoff_proportion;
+  float kaiser_beta;
+  /* Number of kernel table phases. The default is 128. */
+  int kernel_table_phases;
+  /* Target number of buffered input frames beyond the filter history, or 0 to
+   * use 2 * max_input_frames. This is the latency added by the FIFO. Since
+   * writes are bursty, the fill at a read may dip up to a write size below the
+   * target, so to avoid underruns the target should be at least the largest
+   * write size plus the read block size plus the arrival jitter, in frames.
+   */
+  int target_fill_frames;
+  /* Bandwidth in Hz of the fill control loop. The default is 0.1 Hz. */
+  float loop_bandwidth_hz;
+  /* Max relative deviation of the ratio from nominal. The default is 0.005, or
+   * 5000 ppm, far more than crystal clock drift.
+   */
+  float max_ratio_deviation;
+} AsyncResamplerOptions;
+extern const AsyncResamplerOptions kAsyncResamplerDefaultOptions;
+
+struct AsyncResampler; /* Forward declaration. */
+typedef struct AsyncResampler AsyncResampler;
+
+/* Makes an AsyncResampler for converting from nominal `input_sample_rate_hz`
+ * to nominal `output_sample_rate_hz` with `num_channels` interleaved channels.
+ * Write() callers may pass up to `max_input_frames` frames at a time. Pass NULL
+ * for `options` to use the defaults. The caller should free it when done with
+ * `AsyncResamplerFree()`. Returns NULL on failure.
+ */
+AsyncResampler* AsyncResamplerMake(float input_sample_rate_hz,
+                                   float output_sample_rate_hz,
+                                   int num_channels,
+                                   int max_input_frames,
+                                   const AsyncResamplerOptions* options);
+
+/* Frees an AsyncResampler. */
+void AsyncResamplerFree(AsyncResampler* resampler);
+
+/* Resets to initial state: buffer empty, ratio at nominal. */
+void AsyncResamplerReset(AsyncResampler* resampler);
+
+/* Writes `num_frames` frames of interleaved `input`. Returns the number of
+ * frames written, which is less than `num_frames` if the buffer overflows.
+ */
+int AsyncResamplerWrite(AsyncResampler* resampler, const float* input,
+                        int num_frames);
+
+/* Reads `num_frames` frames into interleaved `output`, first updating the ratio
+ * from the current fill. Returns the number of frames resampled from input,
+ * which is less than `num_frames` when the buffer is priming or underruns, in
+ * which case the remaining output frames are zero.
+ */
+int AsyncResamplerRead(AsyncResampler* resampler, float* output,
+                       int num_frames);
+
+/* Gets the number of buffered input frames beyond the filter history. This is
+ * fractional, since the read position is between input frames.
+ */
+double AsyncResamplerFillFrames(const AsyncResampler* resampler);
+
+/* Gets the target fill in frames. */
+int AsyncResamplerTargetFillFrames(const AsyncResampler* resampler);
+
+/* Gets the current resampling ratio, the number of input frames consumed per
+ * output frame. The measured clock ratio is this over the nominal ratio.
+ */
+double AsyncResamplerRatio(const AsyncResampler* resampler);
+
+/* Gets number of channels. */
+int AsyncResamplerNumChannels(const AsyncResampler* resampler);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+#endif /* AUDIO_TO_TACTILE_SRC_DSP_ASYNC_RESAMPLER_H_ */
@@ -18,7 +18,9 @@
 #include <math.h>
 #include <stdlib.h>
 
+#include "dsp/dot_product.h"
 #include "dsp/fast_fun.h"
+#include "dsp/simd.h"
 
 int AutoGainControlInit(AutoGainControlState* state,
                         float sample_rate_hz,
@@ -39,6 +41,7 @@ int AutoGainControlInit(AutoGainControlState* state,
       (float)(1 - exp(-1 / (time_constant_s * sample_rate_hz)));
   state->exponent = -0.5f * agc_strength;
   state->power_floor = power_floor;
+  AutoGainControlSetControlPeriod(state, kAutoGainControlDefaultControlPeriod);
   AutoGainControlReset(state);
   return 1;
 }
@@ -46,6 +49,22 @@ int AutoGainControlInit(AutoGainControlState* state,
 void AutoGainControlReset(AutoGainControlState* state) {
   state->smoothed_power = 1.0f;
   state->warm_up_counter = 1;
+  state->gain = AutoGainControlGetGain(state);
+}
+
+int AutoGainControlSetControlPeriod(AutoGainControlState* state,
+                                    int control_period) {
+  if (!(1 <= control_period &&
+        control_period <= kAutoGainControlMaxControlPeriod)) {
+    return 0;
+  }
+  state->control_period = control_period;
+  const double decay = 1.0 - state->smoother_coeff;
+  int i;
+  for (i = 0; i < control_period; ++i) {
+    state->power_weights[i] = (float)pow(decay, control_period - 1 - i);
+  }
+  return 1;
 }
 
 /* This function gets called from AutoGainControlProcessSample if we are still
@@ -86,3 +105,102 @@ float AutoGainControlGetGain(const AutoGainControlState* state) {
   /* Compute the gain = (power_floor + smoothed_power)^(-agc_strength / 2). */
   return FastPow(state->power_floor + smoothed_power, state->exponent);
 }
+
+/* Processes a chunk of 1 <= num_frames <= control_period frames, ending at a
+ * control point.
+ */
+static void ProcessChunk(AutoGainControlState* state,
+                         const float* input,
+                         int num_channels,
+                         int num_frames,
+                         float* output) {
+  float power[kAutoGainControlMaxControlPeriod];
+  int i;
+  int c;
+
+  /* Compute power samples. */
+  if (num_channels == 1) {
+    for (i = 0; i + 4 <= num_frames; i += 4) {
+      const Float4 x = Float4Load(input + i);
+      Float4Store(power + i, Float4Mul(x, x));
+    }
+    for (; i < num_frames; ++i) {
+      power[i] = input[i] * input[i];
+    }
+  } else {
+    const float scale = 1.0f / num_channels;
+    const float* frame = input;
+    for (i = 0; i < num_frames; ++i, frame += num_channels) {
+      float sum = 0.0f;
+      for (c = 0; c < num_channels; ++c) {
+        sum += frame[c] * frame[c];
+      }
+      power[i] = scale * sum;
+    }
+  }
+
+  if (state->warm_up_counter <= state->num_warm_up_samples) {
+    for (i = 0; i < num_frames; ++i) {
+      AutoGainControlProcessSample(state, power[i]);
+    }
+  } else {
+    /* Applying the smoothing filter over n = num_frames samples is
+     *
+     *   smoothed_power = (1 - smoother_coeff)^n smoothed_power
+     *       + smoother_coeff * sum_i (1 - smoother_coeff)^(n - 1 - i) power[i],
+     *
+     * where the sum is a dot product with the last n power_weights.
+     */
+    const float* weights =
+        state->power_weights + state->control_period - num_frames;
+    const float smoother_coeff = state->smoother_coeff;
+    state->smoothed_power =
+        (1.0f - smoother_coeff) * weights[0] * state->smoothed_power +
+        smoother_coeff * MonoDotProduct(weights, power, num_frames);
+  }
+
+  /* Compute gain at the control point, and interpolate from the previous. */
+  const float gain = state->gain;
+  const float next_gain = AutoGainControlGetGain(state);
+  const float gain_step = (next_gain - gain) / num_frames;
+  state->gain = next_gain;
+
+  if (num_channels == 1) {
+    static const float kRamp[4] = {1.0f, 2.0f, 3.0f, 4.0f};
+    const Float4 ramp = Float4Mul(Float4Broadcast(gain_step),
+                                  Float4Load(kRamp));
+    for (i = 0; i + 4 <= num_frames; i += 4) {
+      const Float4 gains = Float4Add(Float4Broadcast(gain + gain_step * i),
+                                     ramp);
+      Float4Store(output + i, Float4Mul(Float4Load(input + i), gains));
+    }
+    for (; i < num_frames; ++i) {
+      output[i] = input[i] * (gain + gain_step * (i + 1));
+    }
+  } else {
+    for (i = 0; i < num_frames; ++i) {
+      const float frame_gain = gain + gain_step * (i + 1);
+      for (c = 0; c < num_channels; ++c) {
+        output[c] = input[c] * frame_gain;
+      }
+      input += num_channels;
+      output += num_channels;
+    }
+  }
+}
+
+void AutoGainControlProcessBlock(AutoGainControlState* state,
+                                 const float* input,
+                                 int num_channels,
+                                 int num_frames,
+                                 float* output) {
+  const int control_period = state->control_period;
+  while (num_frames > 0) {
+    const int chunk_frames =
+        (num_frames < control_period) ? num_frames : control_period;
+    ProcessChunk(state, input, num_channels, chunk_frames, output);
+    input += chunk_frames * num_channels;
+    output += chunk_frames * num_channels;
+    num_frames -= chunk_frames;
+  }
+}
@@ -51,6 +51,12 @@
  *     AutoGainControlProcessSample(&state, power_sample);
  *     signal[i] *= AutoGainControlGetGain(&state);
  *   }
+ *
+ * Alternatively, AutoGainControlProcessBlock() processes a whole buffer, which
+ * is much cheaper. It computes the gain only once per control period, every
+ * `control_period` frames, and linearly interpolates the gain in between:
+ *
+ *   AutoGainControlProcessBlock(&state, signal, 1, num_samples, signal);
  */
 
 #ifndef AUDIO_TO_TACTILE_SRC_DSP_AUTO_GAIN_CONTROL_H_
@@ -60,6 +66,10 @@
 extern "C" {
 #endif
 
+/* Max and default control periods for AutoGainControlProcessBlock(). */
+#define kAutoGainControlMaxControlPeriod 64
+#define kAutoGainControlDefaultControlPeriod 16
+
 typedef struct {
   float smoother_coeff;
   float exponent;
@@ -67,6 +77,15 @@ typedef struct {
   float power_floor;
   int num_warm_up_samples;
   int warm_up_counter;
+
+  /* Number of frames between gain updates in AutoGainControlProcessBlock(). */
+  int control_period;
+  /* Gain at the last control point. */
+  float gain;
+  /* Weights to update smoothed_power over a control period as a dot product,
+   * power_weights[i] = (1 - smoother_coeff)^(control_period - 1 - i).
+   */
+  float power_weights[kAutoGainControlMaxControlPeriod];
 } AutoGainControlState;
 
 /* Initializes state:
@@ -79,6 +98,9 @@ typedef struct {
  *  - power_floor: A small offset added to the power estimate to avoid
  *    excessive amplification. A value on the order of 1e-6 is typical.
  *
+ * The control period for AutoGainControlProcessBlock() is set to
+ * kAutoGainControlDefaultControlPeriod.
+ *
  * Returns 1 on success, 0 on failure.
  */
 int AutoGainControlInit(AutoGainControlState* state,
@@ -110,6 +132,29 @@ static void AutoGainControlProcessSample(AutoGainControlState* state,
  */
 float AutoGainControlGetGain(const AutoGainControlState* state);
 
+/* Sets the number of frames between gain updates in
+ * AutoGainControlProcessBlock(), between 1 and kAutoGainControlMaxControlPeriod.
+ * Returns 1 on success, 0 on failure.
+ */
+int AutoGainControlSetControlPeriod(AutoGainControlState* state,
+                                    int control_period);
+
+/* Processes a block of `num_frames` frames of `num_channels` interleaved
+ * channels from `input`, writing the result to `output`. Processing may be in
+ * place, i.e. output == input. The power of a frame is the mean square over
+ * the channels, so that the result for mono input is about the same as
+ * calling AutoGainControlProcessSample() and AutoGainControlGetGain() on each
+ * sample. But gain is computed (with one FastPow) only at control points
+ * every `control_period` frames and at the end of the block, and linearly
+ * interpolated in between. Squares and power smoothing over a control period
+ * are computed with Float4 (see simd.h).
+ */
+void AutoGainControlProcessBlock(AutoGainControlState* state,
+                                 const float* input,
+                                 int num_channels,
+                                 int num_frames,
+                                 float* output);
+
 /* Implementation details only below this line. ----------------------------- */
 
 /* (Internal method exposed so that AutoGainControlProcessSample can inline.) */
@@ -0,0 +1,187 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/biquad_cascade.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "dsp/simd.h"
+
+int BiquadCascadeInit(BiquadCascade* cascade,
+                      const BiquadFilterCoeffs* coeffs,
+                      int num_sections) {
+  if (cascade == NULL || (coeffs == NULL && num_sections > 0) ||
+      !(0 <= num_sections && num_sections <= kBiquadCascadeMaxSections)) {
+    fprintf(stderr, "Error: Invalid BiquadCascade args.\n");
+    return 0;
+  }
+  int k;
+  for (k = 0; k < num_sections; ++k) {
+    cascade->coeffs[k] = coeffs[k];
+  }
+  for (; k < kBiquadCascadeMaxSections; ++k) {
+    cascade->coeffs[k] = kBiquadFilterIdentityCoeffs;
+  }
+  cascade->num_sections = num_sections;
+  return 1;
+}
+
+void BiquadCascadeStateInitZero(BiquadCascadeState* state) {
+  int k;
+  for (k = 0; k < kBiquadCascadeMaxSections; ++k) {
+    BiquadFilterInitZero(&state->sections[k]);
+  }
+}
+
+/* Applies two consecutive sections in one pass over the block. */
+static void ProcessSectionPair(const BiquadFilterCoeffs* coeffs,
+                               BiquadFilterState* state,
+                               const float* input,
+                               int num_samples,
+                               float* output) {
+  const float b00 = coeffs[0].b0;
+  const float b01 = coeffs[0].b1;
+  const float b02 = coeffs[0].b2;
+  const float a01 = coeffs[0].a1;
+  const float a02 = coeffs[0].a2;
+  const float b10 = coeffs[1].b0;
+  const float b11 = coeffs[1].b1;
+  const float b12 = coeffs[1].b2;
+  const float a11 = coeffs[1].a1;
+  const float a12 = coeffs[1].a2;
+  float z00 = state[0].z[0];
+  float z01 = state[0].z[1];
+  float z10 = state[1].z[0];
+  float z11 = state[1].z[1];
+  int n;
+  for (n = 0; n < num_samples; ++n) {
+    const float next_state0 = input[n] - a01 * z00 - a02 * z01;
+    const float sample = b00 * next_state0 + b01 * z00 + b02 * z01;
+    z01 = z00;
+    z00 = next_state0;
+    const float next_state1 = sample - a11 * z10 - a12 * z11;
+    output[n] = b10 * next_state1 + b11 * z10 + b12 * z11;
+    z11 = z10;
+    z10 = next_state1;
+  }
+  state[0].z[0] = z00;
+  state[0].z[1] = z01;
+  state[1].z[0] = z10;
+  state[1].z[1] = z11;
+}
+
+void BiquadCascadeProcessBlock(const BiquadCascade* cascade,
+                               BiquadCascadeState* state,
+                               const float* input,
+                               int num_samples,
+                               float* output) {
+  const int num_sections = cascade->num_sections;
+  int k = 0;
+  for (; k + 2 <= num_sections; k += 2) {
+    ProcessSectionPair(&cascade->coeffs[k], &state->sections[k],
+                       (k == 0) ? input : output, num_samples, output);
+  }
+  if (k < num_sections) {
+    BiquadFilterProcessBlock(&cascade->coeffs[k], &state->sections[k],
+                             (k == 0) ? input : output, num_samples, output);
+  } else if (num_sections == 0 && output != input) {
+    memcpy(output, input, num_samples * sizeof(float));
+  }
+}
+
+void BiquadCascadeProcessInterleavedBlock(const BiquadCascade* cascade,
+                                          BiquadCascadeState* state,
+                                          int num_channels,
+                                          const float* input,
+                                          int num_frames,
+                                          float* output) {
+  const int num_sections = cascade->num_sections;
+  int c = 0;
+  int n;
+  int k;
+
+  if (num_sections == 0) {
+    if (output != input) {
+      memcpy(output, input, num_channels * num_frames * sizeof(float));
+    }
+    return;
+  }
+
+  /* Process four channels at a time, with channel c + i in lane i. */
+  for (; c + 4 <= num_channels; c += 4) {
+    Float4 z0[kBiquadCascadeMaxSections];
+    Float4 z1[kBiquadCascadeMaxSections];
+    for (k = 0; k < num_sections; ++k) {
+      float values[2][4];
+      int i;
+      for (i = 0; i < 4; ++i) {
+        values[0][i] = state[c + i].sections[k].z[0];
+        values[1][i] = state[c + i].sections[k].z[1];
+      }
+      z0[k] = Float4Load(values[0]);
+      z1[k] = Float4Load(values[1]);
+    }
+
+    for (n = 0; n < num_frames; ++n) {
+      const int offset = n * num_channels + c;
+      Float4 sample = Float4Load(input + offset);
+      for (k = 0; k < num_sections; ++k) {
+        const BiquadFilterCoeffs* coeffs = &cascade->coeffs[k];
+        const Float4 next_state = Float4Sub(
+            Float4Sub(sample, Float4Mul(Float4Broadcast(coeffs->a1), z0[k])),
+            Float4Mul(Float4Broadcast(coeffs->a2), z1[k]));
+        sample = Float4Add(
+            Float4Add(Float4Mul(Float4Broadcast(coeffs->b0), next_state),
+                      Float4Mul(Float4Broadcast(coeffs->b1), z0[k])),
+            Float4Mul(Float4Broadcast(coeffs->b2), z1[k]));
+        z1[k] = z0[k];
+        z0[k] = next_state;
+      }
+      Float4Store(output + offset, sample);
+    }
+
+    for (k = 0; k < num_sections; ++k) {
+      float values[2][4];
+      int i;
+      Float4Store(values[0], z0[k]);
+      Float4Store(values[1], z1[k]);
+      for (i = 0; i < 4; ++i) {
+        state[c + i].sections[k].z[0] = values[0][i];
+        state[c + i].sections[k].z[1] = values[1][i];
+      }
+    }
+  }
+
+  /* Process remaining channels one at a time. */
+  for (; c < num_channels; ++c) {
+    for (n = 0; n < num_frames; ++n) {
+      const int offset = n * num_channels + c;
+      output[offset] = BiquadCascadeProcessOneSample(
+          cascade, &state[c], input[offset]);
+    }
+  }
+}
+
+ComplexDouble BiquadCascadeFrequencyResponse(const BiquadCascade* cascade,
+                                             double cycles_per_sample) {
+  ComplexDouble response = ComplexDoubleMake(1.0, 0.0);
+  int k;
+  for (k = 0; k < cascade->num_sections; ++k) {
+    response = ComplexDoubleMul(response, BiquadFilterFrequencyResponse(
+        &cascade->coeffs[k], cycles_per_sample));
+  }
+  return response;
+}
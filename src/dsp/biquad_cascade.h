@@ -0,0 +1,121 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * High-order IIR filter as a cascade of biquads (second-order sections).
+ *
+ * Filter designs like DesignButterworthOrder2Bandpass() and
+ * DesignChebyshev2Highpass() produce several biquads that are then applied in
+ * series. `BiquadCascade` holds up to kBiquadCascadeMaxSections sections as one
+ * filter object, so that code filtering with it doesn't need to unroll the
+ * sections by hand, and `BiquadCascadeState` holds the matching state.
+ *
+ * `BiquadCascadeProcessBlock()` runs two sections per pass over the block with
+ * the state of both in local variables, halving the loads and stores of
+ * intermediate samples compared to BiquadFilterCascadeProcessBlock(). The
+ * interleaved version runs all sections per frame on four channels at a time
+ * with 4-lane vector operations, keeping all section state in registers. All
+ * functions produce the same results as running the sections in series with
+ * BiquadFilterProcessOneSample().
+ *
+ * Example use:
+ *   BiquadFilterCoeffs sections[2];
+ *   DesignButterworthOrder2Bandpass(300.0f, 3500.0f, 16000.0f, sections);
+ *   BiquadCascade cascade;
+ *   BiquadCascadeInit(&cascade, sections, 2);
+ *   BiquadCascadeState state;
+ *   BiquadCascadeStateInitZero(&state);
+ *   BiquadCascadeProcessBlock(&cascade, &state, input, num_samples, output);
+ */
+
+#ifndef AUDIO_TO_TACTILE_SRC_DSP_BIQUAD_CASCADE_H_
+#define AUDIO_TO_TACTILE_SRC_DSP_BIQUAD_CASCADE_H_
+
+#include "dsp/biquad_filter.h"
+#include "dsp/complex.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Max number of sections in a cascade. */
+#define kBiquadCascadeMaxSections 8
+
+typedef struct {
+  BiquadFilterCoeffs coeffs[kBiquadCascadeMaxSections];
+  int num_sections;
+} BiquadCascade;
+
+typedef struct {
+  BiquadFilterState sections[kBiquadCascadeMaxSections];
+} BiquadCascadeState;
+
+/* Initializes `cascade` with `num_sections` sections copied from `coeffs`,
+ * where 0 <= num_sections <= kBiquadCascadeMaxSections. A cascade with zero
+ * sections is the identity filter. Returns 1 on success, 0 on failure.
+ */
+int /*bool*/ BiquadCascadeInit(BiquadCascade* cascade,
+                               const BiquadFilterCoeffs* coeffs,
+                               int num_sections);
+
+/* Initializes cascade state variables to zero. */
+void BiquadCascadeStateInitZero(BiquadCascadeState* state);
+
+/* Processes one sample through all sections.
+ * NOTE: This function is marked `static` [the C analogy for `inline`] to
+ * encourage the compiler to inline it.
+ */
+static float BiquadCascadeProcessOneSample(const BiquadCascade* cascade,
+                                           BiquadCascadeState* state,
+                                           float sample) {
+  const int num_sections = cascade->num_sections;
+  int k;
+  for (k = 0; k < num_sections; ++k) {
+    sample = BiquadFilterProcessOneSample(
+        &cascade->coeffs[k], &state->sections[k], sample);
+  }
+  return sample;
+}
+
+/* Processes a block of `num_samples` samples. In-place processing
+ * `output == input` is allowed.
+ */
+void BiquadCascadeProcessBlock(const BiquadCascade* cascade,
+                               BiquadCascadeState* state,
+                               const float* input,
+                               int num_samples,
+                               float* output);
+
+/* Processes a block of `num_frames` frames of `num_channels`-channel
+ * interleaved audio, filtering every channel with the same cascade. `state` is
+ * an array of size `num_channels`, with `state[c]` the state for channel c.
+ * In-place processing `output == input` is allowed.
+ */
+void BiquadCascadeProcessInterleavedBlock(const BiquadCascade* cascade,
+                                          BiquadCascadeState* state,
+                                          int num_channels,
+                                          const float* input,
+                                          int num_frames,
+                                          float* output);
+
+/* Computes the cascade's frequency response, the product of the section
+ * responses, for a frequency in units of cycles per sample.
+ */
+ComplexDouble BiquadCascadeFrequencyResponse(const BiquadCascade* cascade,
+                                             double cycles_per_sample);
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif
+#endif /* AUDIO_TO_TACTILE_SRC_DSP_BIQUAD_CASCADE_H_ */
@@ -15,11 +15,125 @@
 
 #include "dsp/biquad_filter.h"
 
+#include <string.h>
+
 #include "dsp/math_constants.h"
+#include "dsp/simd.h"
 
 const BiquadFilterCoeffs kBiquadFilterIdentityCoeffs =
     {1.0f, 0.0f, 0.0f, 0.0f, 0.0f};
 
+void BiquadFilterProcessBlock(const BiquadFilterCoeffs* coeffs,
+                              BiquadFilterState* state,
+                              const float* input,
+                              int num_samples,
+                              float* output) {
+  const float b0 = coeffs->b0;
+  const float b1 = coeffs->b1;
+  const float b2 = coeffs->b2;
+  const float a1 = coeffs->a1;
+  const float a2 = coeffs->a2;
+  float z0 = state->z[0];
+  float z1 = state->z[1];
+  int n;
+  for (n = 0; n < num_samples; ++n) {
+    const float next_state = input[n] - a1 * z0 - a2 * z1;
+    output[n] = b0 * next_state + b1 * z0 + b2 * z1;
+    z1 = z0;
+    z0 = next_state;
+  }
+  state->z[0] = z0;
+  state->z[1] = z1;
+}
+
+void BiquadFilterCascadeProcessBlock(const BiquadFilterCoeffs* coeffs,
+                                     BiquadFilterState* state,
+                                     int num_sections,
+                                     const float* input,
+                                     int num_samples,
+                                     float* output) {
+  /* Apply sections one at a time over the whole block. Since each section is
+   * causal, this computes the same result as running the cascade per sample.
+   */
+  int k;
+  for (k = 0; k < num_sections; ++k) {
+    BiquadFilterProcessBlock(&coeffs[k], &state[k],
+                             (k == 0) ? input : output, num_samples, output);
+  }
+  if (num_sections <= 0 && output != input) {
+    memcpy(output, input, num_samples * sizeof(float));
+  }
+}
+
+void BiquadFilterProcessInterleavedBlock(const BiquadFilterCoeffs* coeffs,
+                                         BiquadFilterState* state,
+                                         int num_channels,
+                                         const float* input,
+                                         int num_frames,
+                                         float* output) {
+  int c = 0;
+  int n;
+
+  if (num_channels >= 4) {
+    const Float4 b0 = Float4Broadcast(coeffs->b0);
+    const Float4 b1 = Float4Broadcast(coeffs->b1);
+    const Float4 b2 = Float4Broadcast(coeffs->b2);
+    const Float4 a1 = Float4Broadcast(coeffs->a1);
+    const Float4 a2 = Float4Broadcast(coeffs->a2);
+
+    /* Process four channels at a time, with channel c + i in lane i. */
+    for (; c + 4 <= num_channels; c += 4) {
+      float values[2][4];
+      int i;
+      for (i = 0; i < 4; ++i) {
+        values[0][i] = state[c + i].z[0];
+        values[1][i] = state[c + i].z[1];
+      }
+      Float4 z0 = Float4Load(values[0]);
+      Float4 z1 = Float4Load(values[1]);
+
+      for (n = 0; n < num_frames; ++n) {
+        const int offset = n * num_channels + c;
+        const Float4 next_state = Float4Sub(
+            Float4Sub(Float4Load(input + offset), Float4Mul(a1, z0)),
+            Float4Mul(a2, z1));
+        Float4Store(output + offset, Float4Add(
+            Float4Add(Float4Mul(b0, next_state), Float4Mul(b1, z0)),
+            Float4Mul(b2, z1)));
+        z1 = z0;
+        z0 = next_state;
+      }
+
+      Float4Store(values[0], z0);
+      Float4Store(values[1], z1);
+      for (i = 0; i < 4; ++i) {
+        state[c + i].z[0] = values[0][i];
+        state[c + i].z[1] = values[1][i];
+      }
+    }
+  }
+
+  /* Process remaining channels one at a time. */
+  for (; c < num_channels; ++c) {
+    const float b0 = coeffs->b0;
+    const float b1 = coeffs->b1;
+    const float b2 = coeffs->b2;
+    const float a1 = coeffs->a1;
+    const float a2 = coeffs->a2;
+    float z0 = state[c].z[0];
+    float z1 = state[c].z[1];
+    for (n = 0; n < num_frames; ++n) {
+      const int offset = n * num_channels + c;
+      const float next_state = input[offset] - a1 * z0 - a2 * z1;
+      output[offset] = b0 * next_state + b1 * z0 + b2 * z1;
+      z1 = z0;
+      z0 = next_state;
+    }
+    state[c].z[0] = z0;
+    state[c].z[1] = z1;
+  }
+}
+
 ComplexDouble BiquadFilterFrequencyResponse(const BiquadFilterCoeffs* coeffs,
                                             double cycles_per_sample) {
   const double omega = -2 * M_PI * cycles_per_sample;
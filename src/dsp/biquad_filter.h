@@ -14,6 +14,15 @@
  *
  *
  * Biquad filter (second-order section).
+ *
+ * `BiquadFilterProcessOneSample()` processes a single sample and is intended
+ * for inline use in loops that do other per-sample work. For whole blocks of
+ * samples, the block functions below are more efficient: they keep filter state
+ * in local variables (registers) over the whole block rather than loading and
+ * storing it per sample, and `BiquadFilterProcessInterleavedBlock()` runs four
+ * channels at a time with 4-lane vector operations. All block functions produce
+ * the same results as the equivalent sequence of
+ * `BiquadFilterProcessOneSample()` calls.
  */
 
 #ifndef AUDIO_TO_TACTILE_SRC_DSP_BIQUAD_FILTER_H_
@@ -70,6 +79,38 @@ static float BiquadFilterProcessOneSample(const BiquadFilterCoeffs* coeffs,
   return output_sample;
 }
 
+/* Processes a block of `num_samples` samples with a single biquad. In-place
+ * processing `output == input` is allowed.
+ */
+void BiquadFilterProcessBlock(const BiquadFilterCoeffs* coeffs,
+                              BiquadFilterState* state,
+                              const float* input,
+                              int num_samples,
+                              float* output);
+
+/* Processes a block of `num_samples` samples with a cascade of `num_sections`
+ * biquads, where `coeffs` and `state` are arrays of size `num_sections`. In-place
+ * processing `output == input` is allowed.
+ */
+void BiquadFilterCascadeProcessBlock(const BiquadFilterCoeffs* coeffs,
+                                     BiquadFilterState* state,
+                                     int num_sections,
+                                     const float* input,
+                                     int num_samples,
+                                     float* output);
+
+/* Processes a block of `num_frames` frames of `num_channels`-channel
+ * interleaved audio, filtering every channel with the same `coeffs`. `state` is
+ * an array of size `num_channels`, with `state[c]` the state for channel c.
+ * In-place processing `output == input` is allowed.
+ */
+void BiquadFilterProcessInterleavedBlock(const BiquadFilterCoeffs* coeffs,
+                                         BiquadFilterState* state,
+                                         int num_channels,
+                                         const float* input,
+                                         int num_frames,
+                                         float* output);
+
 /* Computes the biquad filter's frequency response for a given frequency in
  * units of cycles per sample, typically in the range [0, 0.5]. To compute the
  * response at a frequency in units of Hz, do
@@ -0,0 +1,52 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/biquad_filter_fixed.h"
+
+#include <math.h>
+
+int BiquadFilterFixedCoeffsFromFloat(const BiquadFilterCoeffs* coeffs,
+                                     BiquadFilterFixedCoeffs* fixed) {
+  if (!(fabs(coeffs->a1) < 2.0f) || !(fabs(coeffs->a2) < 2.0f)) {
+    return 0;
+  }
+
+  /* Use as many fractional bits as fit in int32_t. To preserve zeros at z = 1,
+   * as in highpass and bandpass filters, b1 is rounded so that the sum
+   * b0 + b1 + b2, the DC gain numerator, is correctly rounded. Otherwise with
+   * poles near z = 1, rounding error in the zeros is significant at low
+   * frequencies.
+   */
+  const double kMaxValue = 2147483647.0;
+  const double b_sum = (double)coeffs->b0 + coeffs->b1 + coeffs->b2;
+  int frac_bits;
+  for (frac_bits = kBiquadFilterFixedMaxFracBits; frac_bits >= 1;
+       --frac_bits) {
+    const double b0 = floor(ldexp(coeffs->b0, frac_bits) + 0.5);
+    const double b2 = floor(ldexp(coeffs->b2, frac_bits) + 0.5);
+    const double b1 = floor(ldexp(b_sum, frac_bits) + 0.5) - b0 - b2;
+    if (fabs(b0) <= kMaxValue && fabs(b1) <= kMaxValue &&
+        fabs(b2) <= kMaxValue) {
+      fixed->b0 = (int32_t)b0;
+      fixed->b1 = (int32_t)b1;
+      fixed->b2 = (int32_t)b2;
+      fixed->a1 = FixedFromFloat(coeffs->a1, frac_bits);
+      fixed->a2 = FixedFromFloat(coeffs->a2, frac_bits);
+      fixed->frac_bits = frac_bits;
+      return 1;
+    }
+  }
+  return 0;  /* Coefficients are too large. */
+}
@@ -0,0 +1,141 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * Fixed-point biquad filter for microcontrollers without an FPU.
+ *
+ * Coefficients are 32-bit integers in Qn, with the same n for all five
+ * coefficients, n = 28 unless a coefficient is 8 or larger in magnitude. This
+ * is the same representation as CMSIS-DSP's arm_biquad_cascade_df1_q31 with a
+ * post shift. 16-bit coefficients are not precise enough for many filters:
+ * with poles close to z = 1, as in an 80 Hz bandpass at 16 kHz or the tactor
+ * equalizer, rounding the coefficients to 16 bits changes the low frequency
+ * gain by several percent.
+ *
+ * Samples are 32-bit integers in any Qn format; the output has the same format
+ * as the input. To avoid overflow in accumulation, samples should be less than
+ * 2^30 in magnitude. The filter is computed in direct form I with 64-bit
+ * accumulation, so the only rounding is once per output sample. The rounding
+ * error is fed back into the next sample (first-order error feedback), which
+ * cancels its amplification by the poles at low frequencies. Without it, with
+ * poles near z = 1 the rounding noise at low frequencies is amplified
+ * by about 1 / (1 + a1 + a2), which is hundreds for a lowpass at 500 Hz with
+ * a 44.1 kHz sample rate.
+ *
+ * Coefficients are converted from a float BiquadFilterCoeffs, e.g. as designed
+ * by butterworth.h, with `BiquadFilterFixedCoeffsFromFloat()`.
+ *
+ * Example use:
+ *   BiquadFilterCoeffs coeffs;
+ *   DesignButterworthOrder2Lowpass(cutoff_hz, sample_rate_hz, &coeffs);
+ *   BiquadFilterFixedCoeffs fixed_coeffs;
+ *   BiquadFilterFixedCoeffsFromFloat(&coeffs, &fixed_coeffs);
+ *
+ *   BiquadFilterFixedState state;
+ *   BiquadFilterFixedInitZero(&state);
+ *   int i;
+ *   for (i = 0; i < num_samples; ++i) {
+ *     output[i] = BiquadFilterFixedProcessOneSample(
+ *         &fixed_coeffs, &state, input[i]);
+ *   }
+ */
+
+#ifndef AUDIO_TO_TACTILE_SRC_DSP_BIQUAD_FILTER_FIXED_H_
+#define AUDIO_TO_TACTILE_SRC_DSP_BIQUAD_FILTER_FIXED_H_
+
+#include <stdint.h>
+
+#include "dsp/biquad_filter.h"
+#include "dsp/fixed_point.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Max number of fractional bits in the coefficients. */
+#define kBiquadFilterFixedMaxFracBits 28
+
+/* Fixed-point filter coefficients, representing
+ *
+ *          b0 + b1 z^-1 + b2 z^-2
+ *   H(z) = ----------------------,
+ *          2^n + a1 z^-1 + a2 z^-2
+ *
+ * where n = frac_bits.
+ */
+typedef struct {
+  int32_t b0;
+  int32_t b1;
+  int32_t b2;
+  int32_t a1;
+  int32_t a2;
+  int frac_bits;
+} BiquadFilterFixedCoeffs;
+
+/* Direct form I filter state of the past two input and output samples, and
+ * the rounding error of the last output in units of 2^-frac_bits output LSBs.
+ */
+typedef struct {
+  int32_t x[2];
+  int32_t y[2];
+  int32_t error;
+} BiquadFilterFixedState;
+
+/* Converts float coefficients to fixed point. Returns 1 on success, 0 on
+ * failure, which happens if a1 or a2 is outside of (-2, 2) (such a filter is
+ * unstable) or if b0, b1, or b2 is 2^31 or larger in magnitude.
+ */
+int /*bool*/ BiquadFilterFixedCoeffsFromFloat(const BiquadFilterCoeffs* coeffs,
+                                              BiquadFilterFixedCoeffs* fixed);
+
+/* Initializes filter state variables to zero. */
+static void BiquadFilterFixedInitZero(BiquadFilterFixedState* state) {
+  state->x[0] = 0;
+  state->x[1] = 0;
+  state->y[0] = 0;
+  state->y[1] = 0;
+  state->error = 0;
+}
+
+/* Processes one sample. The output is rounded and saturated to int32_t range.
+ * NOTE: This function is marked `static` [the C analogy for `inline`] to
+ * encourage the compiler to inline it.
+ */
+static int32_t BiquadFilterFixedProcessOneSample(
+    const BiquadFilterFixedCoeffs* coeffs, BiquadFilterFixedState* state,
+    int32_t input_sample) {
+  const int frac_bits = coeffs->frac_bits;
+  /* Accumulate in Q(m + frac_bits), where Qm is the sample format. */
+  int64_t accum = (int64_t)coeffs->b0 * input_sample
+      + (int64_t)coeffs->b1 * state->x[0]
+      + (int64_t)coeffs->b2 * state->x[1]
+      - (int64_t)coeffs->a1 * state->y[0]
+      - (int64_t)coeffs->a2 * state->y[1]
+      + state->error;  /* Feed back the previous rounding error. */
+  const int64_t rounded =
+      (accum + (INT64_C(1) << (frac_bits - 1))) >> frac_bits;
+  state->error = (int32_t)(accum - rounded * (INT64_C(1) << frac_bits));
+  const int32_t output_sample = FixedSaturateInt32(rounded);
+
+  state->x[1] = state->x[0];
+  state->x[0] = input_sample;
+  state->y[1] = state->y[0];
+  state->y[0] = output_sample;
+  return output_sample;
+}
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif
+#endif /* AUDIO_TO_TACTILE_SRC_DSP_BIQUAD_FILTER_FIXED_H_ */
@@ -45,6 +45,17 @@ void ChannelMapApply(const ChannelMap* channel_map, const float* input,
   }
 }
 
+uint32_t ChannelMapUsedInputs(const ChannelMap* channel_map) {
+  uint32_t used = 0;
+  int c;
+  for (c = 0; c < channel_map->num_output_channels; ++c) {
+    if (channel_map->gains[c] != 0.0f) {
+      used |= UINT32_C(1) << channel_map->sources[c];
+    }
+  }
+  return used;
+}
+
 int ChannelGainToControlValue(float gain) {
   if (gain >= 1.0f) { return 63; }
   if (!(gain >= 0.128f)) { return (gain >= 0.05f) ? 1 : 0; }
@@ -31,6 +31,8 @@
 #ifndef AUDIO_TO_TACTILE_SRC_DSP_CHANNEL_MAP_H_
 #define AUDIO_TO_TACTILE_SRC_DSP_CHANNEL_MAP_H_
 
+#include <stdint.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -53,6 +55,13 @@ void ChannelMapInit(ChannelMap* channel_map, int num_channels);
 void ChannelMapApply(const ChannelMap* channel_map, const float* input,
                      int num_frames, float* output);
 
+/* Gets the input channels that contribute to the output, as a bit mask where
+ * bit i is set if some output channel has source i and nonzero gain. Other
+ * input channels are dead, so whatever computes them may skip them, e.g. with
+ * TactileProcessorSetActiveTactors() and PostProcessorSetActiveChannels().
+ */
+uint32_t ChannelMapUsedInputs(const ChannelMap* channel_map);
+
 /* Maps a control value in the range 0-63 to a linear gain. Control value 0 maps
  * to gain 0.0. Control values 1-63 map linearly in dB space to -18 to 0 dB, and
  * is converted to linear gain. This is used to serialize channel maps.
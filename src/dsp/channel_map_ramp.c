@@ -0,0 +1,141 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/channel_map_ramp.h"
+
+#include <math.h>
+#include <stdio.h>
+
+int ChannelMapRampInit(ChannelMapRamp* ramp,
+                       const ChannelMap* channel_map,
+                       int ramp_frames,
+                       int shape) {
+  if (ramp == NULL || channel_map == NULL) {
+    return 0;
+  } else if (!(0 <= channel_map->num_output_channels &&
+               channel_map->num_output_channels <= kChannelMapMaxChannels)) {
+    fprintf(stderr, "Error: Invalid ChannelMap with %d output channels.\n",
+            channel_map->num_output_channels);
+    return 0;
+  } else if (ramp_frames < 0 || !(shape == kChannelMapRampLinear ||
+                                  shape == kChannelMapRampExponential)) {
+    fprintf(stderr, "Error: Invalid ramp_frames %d or shape %d.\n",
+            ramp_frames, shape);
+    return 0;
+  }
+
+  ramp->channel_map = *channel_map;
+  ramp->num_ramping = 0;
+  ramp->ramp_frames = ramp_frames;
+  ramp->shape = shape;
+  int c;
+  for (c = 0; c < kChannelMapMaxChannels; ++c) {
+    ramp->target_gains[c] = channel_map->gains[c];
+    ramp->steps[c] = 0.0f;
+    ramp->frames_remaining[c] = 0;
+  }
+  return 1;
+}
+
+void ChannelMapRampSetGain(ChannelMapRamp* ramp, int channel, float gain) {
+  float* current_gain = &ramp->channel_map.gains[channel];
+  ramp->target_gains[channel] = gain;
+  if (ramp->frames_remaining[channel] > 0) {
+    ramp->frames_remaining[channel] = 0;
+    --ramp->num_ramping;
+  }
+  if (gain == *current_gain || ramp->ramp_frames == 0) {
+    *current_gain = gain;
+    return;
+  }
+
+  if (ramp->shape == kChannelMapRampLinear) {
+    ramp->steps[channel] = (gain - *current_gain) / ramp->ramp_frames;
+  } else {
+    /* Ramp by a constant ratio from `start` to `end`. A gain of zero can't be
+     * reached by multiplying, so it is replaced with kChannelMapRampMinGain and
+     * snapped to at the end of the ramp.
+     */
+    const float start = (*current_gain > kChannelMapRampMinGain)
+        ? *current_gain : kChannelMapRampMinGain;
+    const float end = (gain > kChannelMapRampMinGain)
+        ? gain : kChannelMapRampMinGain;
+    *current_gain = start;
+    ramp->steps[channel] = (float)exp(log(end / start) / ramp->ramp_frames);
+  }
+  ramp->frames_remaining[channel] = ramp->ramp_frames;
+  ++ramp->num_ramping;
+}
+
+void ChannelMapRampSetGains(ChannelMapRamp* ramp, const float* gains) {
+  int c;
+  for (c = 0; c < ramp->channel_map.num_output_channels; ++c) {
+    ChannelMapRampSetGain(ramp, c, gains[c]);
+  }
+}
+
+void ChannelMapRampApply(ChannelMapRamp* ramp, const float* input,
+                         int num_frames, float* output) {
+  ChannelMap* channel_map = &ramp->channel_map;
+  if (ramp->num_ramping == 0) {
+    /* No ramps in progress, so gains are static. */
+    ChannelMapApply(channel_map, input, num_frames, output);
+    return;
+  }
+
+  const int num_input_channels = channel_map->num_input_channels;
+  const int num_output_channels = channel_map->num_output_channels;
+  int c;
+  for (c = 0; c < num_output_channels; ++c) {
+    const float* src = input + channel_map->sources[c];
+    float* dest = output + c;
+    float gain = channel_map->gains[c];
+    int n = 0;
+
+    int frames_remaining = ramp->frames_remaining[c];
+    if (frames_remaining > 0) {
+      /* If the ramp finishes within this block, its last frame is played
+       * below with exactly the target gain.
+       */
+      const int finishes = (frames_remaining <= num_frames);
+      const int ramp_end = finishes ? frames_remaining - 1 : num_frames;
+      const float step = ramp->steps[c];
+      if (ramp->shape == kChannelMapRampLinear) {
+        for (; n < ramp_end; ++n) {
+          gain += step;
+          dest[n * num_output_channels] = gain * src[n * num_input_channels];
+        }
+      } else {
+        for (; n < ramp_end; ++n) {
+          gain *= step;
+          dest[n * num_output_channels] = gain * src[n * num_input_channels];
+        }
+      }
+
+      if (finishes) {
+        gain = ramp->target_gains[c];
+        ramp->frames_remaining[c] = 0;
+        --ramp->num_ramping;
+      } else {
+        ramp->frames_remaining[c] = frames_remaining - num_frames;
+      }
+      channel_map->gains[c] = gain;
+    }
+
+    for (; n < num_frames; ++n) {
+      dest[n * num_output_channels] = gain * src[n * num_input_channels];
+    }
+  }
+}
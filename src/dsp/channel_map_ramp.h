@@ -0,0 +1,102 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * ChannelMap with gains that ramp smoothly to new values.
+ *
+ * Replacing the gains of a ChannelMap abruptly, e.g. on a kChannelGainUpdate
+ * message, makes an audible or tactile click. `ChannelMapRamp` holds a
+ * ChannelMap whose gains move to target gains over a configurable number of
+ * frames, either linearly or exponentially (linearly in dB). The per-frame
+ * increment (or ratio) is computed once when a target is set, so a ramp costs
+ * one add or multiply per sample, and a channel that is not ramping costs
+ * nothing extra. When no channel is ramping, ChannelMapRampApply() is the
+ * same as ChannelMapApply().
+ *
+ * Example use:
+ *   ChannelMapRamp ramp;
+ *   ChannelMapRampInit(&ramp, &channel_map, 64, kChannelMapRampExponential);
+ *   ...
+ *   // On a gain update.
+ *   ChannelMapRampSetGains(&ramp, new_gains);
+ *   ...
+ *   // For each block.
+ *   ChannelMapRampApply(&ramp, input, num_frames, output);
+ */
+
+#ifndef AUDIO_TO_TACTILE_SRC_DSP_CHANNEL_MAP_RAMP_H_
+#define AUDIO_TO_TACTILE_SRC_DSP_CHANNEL_MAP_RAMP_H_
+
+#include "dsp/channel_map.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Ramp shapes. */
+enum {
+  /* Gains change by a constant increment per frame. */
+  kChannelMapRampLinear,
+  /* Gains change by a constant ratio per frame, i.e. linearly in dB. Ramps
+   * to or from a gain of zero go through kChannelMapRampMinGain.
+   */
+  kChannelMapRampExponential
+};
+
+/* Smallest nonzero gain for exponential ramps, -60 dB. */
+#define kChannelMapRampMinGain 1e-3f
+
+typedef struct {
+  /* Channel map with the current gains. */
+  ChannelMap channel_map;
+  /* Gains at the end of the ramps. */
+  float target_gains[kChannelMapMaxChannels];
+  /* Per-frame increment for a linear ramp, or ratio for an exponential ramp. */
+  float steps[kChannelMapMaxChannels];
+  /* Number of frames remaining in each channel's ramp, or 0 if not ramping. */
+  int frames_remaining[kChannelMapMaxChannels];
+  /* Number of channels with frames_remaining > 0. */
+  int num_ramping;
+  int ramp_frames;
+  int shape;
+} ChannelMapRamp;
+
+/* Initializes with `channel_map` and no ramps in progress. New gains ramp over
+ * `ramp_frames` frames with `shape`, kChannelMapRampLinear or
+ * kChannelMapRampExponential. Returns 1 on success, 0 on failure.
+ */
+int /*bool*/ ChannelMapRampInit(ChannelMapRamp* ramp,
+                                const ChannelMap* channel_map,
+                                int ramp_frames,
+                                int shape);
+
+/* Starts ramps from the current gains to `gains`, an array of
+ * `channel_map.num_output_channels` elements. A ramp in progress restarts from
+ * its current gain. Channels whose gain is unchanged don't ramp.
+ */
+void ChannelMapRampSetGains(ChannelMapRamp* ramp, const float* gains);
+
+/* Same as above, for one output channel. */
+void ChannelMapRampSetGain(ChannelMapRamp* ramp, int channel, float gain);
+
+/* Applies `ramp->channel_map`, advancing the ramps by `num_frames` frames.
+ * Arguments are as in ChannelMapApply().
+ */
+void ChannelMapRampApply(ChannelMapRamp* ramp, const float* input,
+                         int num_frames, float* output);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+#endif /* AUDIO_TO_TACTILE_SRC_DSP_CHANNEL_MAP_RAMP_H_ */
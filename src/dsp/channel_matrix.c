@@ -0,0 +1,177 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/channel_matrix.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "dsp/simd.h"
+
+int ChannelMatrixInit(ChannelMatrix* matrix, int num_input_channels,
+                      int num_output_channels) {
+  if (!(1 <= num_input_channels &&
+        num_input_channels <= kChannelMapMaxChannels &&
+        0 <= num_output_channels &&
+        num_output_channels <= kChannelMapMaxChannels)) {
+    fprintf(stderr, "Error: Invalid ChannelMatrix size %dx%d.\n",
+            num_output_channels, num_input_channels);
+    return 0;
+  }
+
+  matrix->num_input_channels = num_input_channels;
+  matrix->num_output_channels = num_output_channels;
+  matrix->num_terms = 0;
+  int c;
+  for (c = 0; c < kChannelMapMaxChannels; ++c) {
+    matrix->term_counts[c] = 0;
+    int k;
+    for (k = 0; k < kChannelMatrixMaxTerms; ++k) {
+      matrix->gains[k][c] = 0.0f;
+      matrix->sources[k][c] = 0;
+    }
+  }
+  return 1;
+}
+
+int ChannelMatrixInitFromChannelMap(ChannelMatrix* matrix,
+                                    const ChannelMap* channel_map) {
+  if (!ChannelMatrixInit(matrix, channel_map->num_input_channels,
+                         channel_map->num_output_channels)) {
+    return 0;
+  }
+  int c;
+  for (c = 0; c < channel_map->num_output_channels; ++c) {
+    if (!ChannelMatrixAddTerm(matrix, c, channel_map->sources[c],
+                              channel_map->gains[c])) {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+int ChannelMatrixAddTerm(ChannelMatrix* matrix, int output_channel,
+                         int source, float gain) {
+  if (!(0 <= output_channel && output_channel < matrix->num_output_channels &&
+        0 <= source && source < matrix->num_input_channels)) {
+    fprintf(stderr, "Error: ChannelMatrix term %d <- %d out of range.\n",
+            output_channel, source);
+    return 0;
+  }
+
+  const int count = matrix->term_counts[output_channel];
+  int k;
+  for (k = 0; k < count; ++k) {
+    if (matrix->sources[k][output_channel] == source) {
+      matrix->gains[k][output_channel] += gain;
+      return 1;
+    }
+  }
+  if (count == kChannelMatrixMaxTerms) {
+    fprintf(stderr, "Error: ChannelMatrix output %d has too many terms.\n",
+            output_channel);
+    return 0;
+  }
+
+  matrix->sources[count][output_channel] = source;
+  matrix->gains[count][output_channel] = gain;
+  matrix->term_counts[output_channel] = count + 1;
+  if (count + 1 > matrix->num_terms) { matrix->num_terms = count + 1; }
+  return 1;
+}
+
+/* Returns 1 if the matrix is diagonal, i.e. an identity mapping with gains. */
+static int IsIdentity(const ChannelMatrix* matrix) {
+  if (matrix->num_terms != 1 ||
+      matrix->num_input_channels != matrix->num_output_channels) {
+    return 0;
+  }
+  int c;
+  for (c = 0; c < matrix->num_output_channels; ++c) {
+    if (matrix->sources[0][c] != c) { return 0; }
+  }
+  return 1;
+}
+
+void ChannelMatrixApply(const ChannelMatrix* matrix, const float* input,
+                        int num_frames, float* output) {
+  const int num_input_channels = matrix->num_input_channels;
+  const int num_output_channels = matrix->num_output_channels;
+  const int num_terms = matrix->num_terms;
+  /* Number of channels in full groups of 4, which are stored directly. */
+  const int num_full_channels = num_output_channels & ~3;
+  int i;
+  int c;
+
+  if (num_terms == 0) {
+    memset(output, 0, num_frames * num_output_channels * sizeof(float));
+    return;
+  }
+
+  if (IsIdentity(matrix)) {
+    /* Inputs are contiguous, so load them directly. */
+    const float* gains = matrix->gains[0];
+    for (i = 0; i < num_frames; ++i) {
+      for (c = 0; c < num_full_channels; c += 4) {
+        Float4Store(output + c,
+                    Float4Mul(Float4Load(gains + c), Float4Load(input + c)));
+      }
+      for (; c < num_output_channels; ++c) {
+        output[c] = gains[c] * input[c];
+      }
+      input += num_input_channels;
+      output += num_output_channels;
+    }
+    return;
+  }
+
+  /* Padded to a multiple of 4. Padding terms have source 0 and gain 0. */
+  const int num_padded_channels = (num_output_channels + 3) & ~3;
+  float gathered[kChannelMatrixMaxTerms][kChannelMapMaxChannels];
+  float frame[4];
+  for (i = 0; i < num_frames; ++i) {
+    /* Gather all inputs for the frame before writing any output, so that
+     * in-place processing works.
+     */
+    int k;
+    for (k = 0; k < num_terms; ++k) {
+      const int* sources = matrix->sources[k];
+      for (c = 0; c < num_padded_channels; ++c) {
+        gathered[k][c] = input[sources[c]];
+      }
+    }
+
+    for (c = 0; c < num_padded_channels; c += 4) {
+      Float4 sum = Float4Mul(Float4Load(matrix->gains[0] + c),
+                             Float4Load(gathered[0] + c));
+      for (k = 1; k < num_terms; ++k) {
+        sum = Float4Add(sum, Float4Mul(Float4Load(matrix->gains[k] + c),
+                                       Float4Load(gathered[k] + c)));
+      }
+
+      if (c < num_full_channels) {
+        Float4Store(output + c, sum);
+      } else {  /* Last group is partial, store only channels in use. */
+        Float4Store(frame, sum);
+        for (k = c; k < num_output_channels; ++k) {
+          output[k] = frame[k - c];
+        }
+      }
+    }
+
+    input += num_input_channels;
+    output += num_output_channels;
+  }
+}
@@ -0,0 +1,101 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * Sparse mixing matrix, generalizing ChannelMap to sum several inputs.
+ *
+ * `ChannelMatrix` describes a mixing of a multichannel signal of the form
+ *
+ *   output[c] = sum_k gains[k][c] * input[sources[k][c]],
+ *
+ * where each output channel sums up to kChannelMatrixMaxTerms weighted input
+ * channels. For instance, a tactor between two others may play a weighted mix
+ * of their signals to produce a phantom sensation between them. ChannelMap's
+ * `output[c] = gains[c] * input[sources[c]]` is the special case of one term
+ * per output.
+ *
+ * The matrix is stored sparsely with a fixed number of terms per output (also
+ * known as ELLPACK format), with term k of every output stored contiguously.
+ * ChannelMatrixApply() gathers the inputs for each term, then multiplies and
+ * accumulates four output channels at a time with Float4 (see simd.h). The
+ * identity mapping (with gains) is detected and skips the gather.
+ *
+ * Example use:
+ *   ChannelMatrix matrix;
+ *   ChannelMatrixInit(&matrix, 10, 24);
+ *   ChannelMatrixAddTerm(&matrix, 0, 0, 1.0f);  // Output 0 plays input 0.
+ *   ChannelMatrixAddTerm(&matrix, 1, 0, 0.5f);  // Output 1 is halfway between
+ *   ChannelMatrixAddTerm(&matrix, 1, 1, 0.5f);  // inputs 0 and 1.
+ *   ...
+ *   ChannelMatrixApply(&matrix, input, num_frames, output);
+ */
+
+#ifndef AUDIO_TO_TACTILE_SRC_DSP_CHANNEL_MATRIX_H_
+#define AUDIO_TO_TACTILE_SRC_DSP_CHANNEL_MATRIX_H_
+
+#include "dsp/channel_map.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Max number of input channels summed into one output channel. */
+#define kChannelMatrixMaxTerms 4
+
+typedef struct {
+  int num_input_channels;
+  int num_output_channels;
+  /* Max over output channels of the number of terms in use. */
+  int num_terms;
+  /* Number of terms in use for each output channel. */
+  int term_counts[kChannelMapMaxChannels];
+  /* Term k for output channel c is `gains[k][c] * input[sources[k][c]]`, where
+   * sources are base-0 indices. Unused terms have gain 0 and source 0.
+   */
+  float gains[kChannelMatrixMaxTerms][kChannelMapMaxChannels];
+  int sources[kChannelMatrixMaxTerms][kChannelMapMaxChannels];
+} ChannelMatrix;
+
+/* Initializes an all-zero matrix with the given number of channels. Returns 1
+ * on success, 0 on failure.
+ */
+int /*bool*/ ChannelMatrixInit(ChannelMatrix* matrix, int num_input_channels,
+                               int num_output_channels);
+
+/* Initializes a matrix equivalent to `channel_map`. Returns 1 on success, 0 on
+ * failure.
+ */
+int /*bool*/ ChannelMatrixInitFromChannelMap(ChannelMatrix* matrix,
+                                             const ChannelMap* channel_map);
+
+/* Adds `gain * input[source]` to output channel `output_channel`. If `source`
+ * is already a term of that output, `gain` is added to its gain. Returns 1 on
+ * success, or 0 if the channels are out of range or the output already has
+ * kChannelMatrixMaxTerms terms.
+ */
+int /*bool*/ ChannelMatrixAddTerm(ChannelMatrix* matrix, int output_channel,
+                                  int source, float gain);
+
+/* Applies `matrix` to `input`, an array of `num_frames * num_input_channels`
+ * samples in interleaved order, writing `num_frames * num_output_channels`
+ * samples to `output`. Processing may be in place, i.e. output == input, if
+ * the numbers of input and output channels are equal.
+ */
+void ChannelMatrixApply(const ChannelMatrix* matrix, const float* input,
+                        int num_frames, float* output);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+#endif /* AUDIO_TO_TACTILE_SRC_DSP_CHANNEL_MATRIX_H_ */
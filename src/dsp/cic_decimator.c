@@ -0,0 +1,114 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/cic_decimator.h"
+
+#include <math.h>
+#include <stdio.h>
+
+#include "dsp/math_constants.h"
+
+#if kCicDecimatorOrder != 3
+#error "CicDecimatorProcessSamples() assumes kCicDecimatorOrder == 3."
+#endif
+
+int CicDecimatorInit(CicDecimator* state, int factor, int output_shift) {
+  if (state == NULL ||
+      !(1 <= factor && factor <= kCicDecimatorMaxFactor) ||
+      (factor & (factor - 1)) != 0 ||
+      !(0 <= output_shift && output_shift <= 8)) {
+    fprintf(stderr, "Error: Invalid CicDecimator args.\n");
+    return 0;
+  }
+
+  int factor_log2 = 0;
+  while ((1 << factor_log2) < factor) { ++factor_log2; }
+  state->factor = factor;
+  state->shift = kCicDecimatorOrder * factor_log2 + output_shift;
+
+  /* CIC gain at a quarter of the output rate, normalized to unit DC gain. The
+   * compensator's gain there is 1 + 2a, since cos(2 pi / 4) = 0.
+   */
+  const double cic_gain = pow(
+      sin(M_PI / 4) / (factor * sin(M_PI / (4 * factor))), kCicDecimatorOrder);
+  const double a = 0.5 * (1.0 / cic_gain - 1.0);
+  state->compensator_coeff = (int32_t)floor(32768.0 * a + 0.5);
+
+  CicDecimatorReset(state);
+  return 1;
+}
+
+void CicDecimatorReset(CicDecimator* state) {
+  int k;
+  for (k = 0; k < kCicDecimatorOrder; ++k) {
+    state->integrators[k] = 0;
+    state->comb_delays[k] = 0;
+  }
+  state->compensator_history[0] = 0;
+  state->compensator_history[1] = 0;
+  state->phase = 0;
+}
+
+int CicDecimatorProcessSamples(CicDecimator* state, const int16_t* input,
+                               int num_samples, int16_t* output) {
+  uint32_t i0 = state->integrators[0];
+  uint32_t i1 = state->integrators[1];
+  uint32_t i2 = state->integrators[2];
+  const int64_t a = state->compensator_coeff;
+  const int shift = state->shift;
+  /* Rounding offset for the final shift, including the Q15 coefficients. */
+  const int64_t rounding = ((int64_t)1 << (shift + 15)) >> 1;
+  int num_output = 0;
+  int n;
+
+  for (n = 0; n < num_samples; ++n) {
+    /* Integrators, with wrapping unsigned arithmetic. */
+    i0 += (uint32_t)(int32_t)input[n];
+    i1 += i0;
+    i2 += i1;
+
+    if (++state->phase < state->factor) { continue; }
+    state->phase = 0;
+
+    /* Combs at the output rate. */
+    uint32_t c = i2;
+    int k;
+    for (k = 0; k < kCicDecimatorOrder; ++k) {
+      const uint32_t previous = state->comb_delays[k];
+      state->comb_delays[k] = c;
+      c -= previous;
+    }
+    const int32_t x0 = (int32_t)c;
+
+    /* Compensation FIR [-a, 1 + 2a, -a] in Q15, centered on x1. */
+    const int32_t x1 = state->compensator_history[0];
+    const int32_t x2 = state->compensator_history[1];
+    state->compensator_history[1] = x1;
+    state->compensator_history[0] = x0;
+    const int64_t sum = ((int64_t)32768 + 2 * a) * x1 - a * ((int64_t)x0 + x2);
+    int64_t y = (sum + rounding) >> (shift + 15);
+    if (y > INT16_MAX) {
+      y = INT16_MAX;
+    } else if (y < INT16_MIN) {
+      y = INT16_MIN;
+    }
+    output[num_output++] = (int16_t)y;
+  }
+
+  state->integrators[0] = i0;
+  state->integrators[1] = i1;
+  state->integrators[2] = i2;
+  return num_output;
+}
@@ -0,0 +1,100 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * Fixed-point CIC decimator with a compensation FIR, for oversampled ADCs.
+ *
+ * Sampling an ADC faster than needed and decimating averages out ADC and
+ * amplifier noise outside the output band, so the output has higher SNR than
+ * sampling directly at the output rate. `CicDecimator` decimates by a power of
+ * two `factor` with a kCicDecimatorOrder-order cascaded integrator-comb (CIC)
+ * filter, which needs no multiplies: per input sample, only
+ * kCicDecimatorOrder additions, plus kCicDecimatorOrder subtractions per
+ * output sample. The CIC's nulls at multiples of the output rate strongly
+ * attenuate the bands that alias into low frequencies, e.g. by about 55 dB
+ * for a tone at 0.9 times the output rate with factor 4.
+ *
+ * The CIC response droops toward the output Nyquist frequency, e.g. -2.6 dB at
+ * a quarter of the output rate for factor 4. A 3-tap compensation FIR
+ * [-a, 1 + 2a, -a] running at the output rate corrects this, with `a` chosen
+ * so the combined response is exactly 1 at a quarter of the output rate. The
+ * result is flat within 0.25 dB up to that frequency, and -1.4 dB at 0.35
+ * times the output rate. The FIR delays the output by one output sample.
+ *
+ * Integrators use wrapping 32-bit arithmetic, which is exact since the output
+ * is bounded: with int16 input, factors up to kCicDecimatorMaxFactor don't
+ * overflow. The output is normalized to unit DC gain and further scaled by
+ * 2^-output_shift with rounding, e.g. to convert 14-bit oversampled ADC
+ * results to a 12-bit scale. Outputs are saturated to int16.
+ *
+ * Example use:
+ *   CicDecimator decimator;
+ *   CicDecimatorInit(&decimator, 4, 0);
+ *   int16_t output[kNumInput / 4];
+ *   const int num_output = CicDecimatorProcessSamples(
+ *       &decimator, input, kNumInput, output);
+ */
+
+#ifndef AUDIO_TO_TACTILE_SRC_DSP_CIC_DECIMATOR_H_
+#define AUDIO_TO_TACTILE_SRC_DSP_CIC_DECIMATOR_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Number of integrator and comb stages. */
+#define kCicDecimatorOrder 3
+/* Max decimation factor. */
+#define kCicDecimatorMaxFactor 16
+
+typedef struct {
+  uint32_t integrators[kCicDecimatorOrder];
+  /* Previous input of each comb stage. */
+  uint32_t comb_delays[kCicDecimatorOrder];
+  /* Previous two CIC outputs, most recent first. */
+  int32_t compensator_history[2];
+  /* Q15 compensator coefficient `a`. */
+  int32_t compensator_coeff;
+  int factor;
+  /* log2(factor^kCicDecimatorOrder) + output_shift. */
+  int shift;
+  /* Number of input samples since the last output. */
+  int phase;
+} CicDecimator;
+
+/* Initializes for decimation by `factor`, a power of two between 1 and
+ * kCicDecimatorMaxFactor, with output scaled by 2^-output_shift, where
+ * 0 <= output_shift <= 8. Returns 1 on success, 0 on failure.
+ */
+int /*bool*/ CicDecimatorInit(CicDecimator* state, int factor,
+                              int output_shift);
+
+/* Resets to initial state, as if the input had been zero. */
+void CicDecimatorReset(CicDecimator* state);
+
+/* Decimates `num_samples` input samples, writing output samples to `output`.
+ * Returns the number of output samples written, which is num_samples / factor
+ * when num_samples is a multiple of factor. Otherwise, the remaining input
+ * samples are carried over to the next call.
+ */
+int CicDecimatorProcessSamples(CicDecimator* state, const int16_t* input,
+                               int num_samples, int16_t* output);
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif
+
+#endif  /* AUDIO_TO_TACTILE_SRC_DSP_CIC_DECIMATOR_H_ */
@@ -15,6 +15,8 @@
 
 #include "dsp/complex.h"
 
+#include "dsp/simd.h"
+
 static double CopySign(double x, double y) {
   x = fabs(x);
   return (y < 0.0) ? -x : x;
@@ -182,3 +184,94 @@ ComplexDouble ComplexDoubleASin(ComplexDouble z) {
   ComplexDouble w = ComplexDoubleASinh(ComplexDoubleMake(-z.imag, z.real));
   return ComplexDoubleMake(w.imag, -w.real);
 }
+
+static const float kMulSigns[4] = {-1.0f, 1.0f, -1.0f, 1.0f};
+static const float kConjMulSigns[4] = {1.0f, -1.0f, 1.0f, -1.0f};
+
+/* Computes w * z for two interleaved complex values per Float4,
+ *
+ *   {wr * zr - wi * zi, wr * zi + wi * zr},
+ *
+ * with the same operation order as ComplexFloatMul(), if `signs` is kMulSigns.
+ * With kConjMulSigns, computes conj(w) * z = {wr * zr + wi * zi,
+ * wr * zi - wi * zr} instead.
+ */
+static Float4 ComplexMulFloat4(Float4 w, Float4 z, Float4 signs) {
+  return Float4Add(Float4Mul(Float4DupEven(w), z),
+                   Float4Mul(Float4DupOdd(w),
+                             Float4Mul(Float4SwapPairs(z), signs)));
+}
+
+void ComplexFloatArrayMul(const ComplexFloat* a, const ComplexFloat* b,
+                          int size, ComplexFloat* out) {
+  const Float4 signs = Float4Load(kMulSigns);
+  int k;
+  for (k = 0; k + 1 < size; k += 2) {
+    Float4Store((float*)(out + k),
+                ComplexMulFloat4(Float4Load((const float*)(a + k)),
+                                 Float4Load((const float*)(b + k)), signs));
+  }
+  if (k < size) {
+    out[k] = ComplexFloatMul(a[k], b[k]);
+  }
+}
+
+void ComplexFloatArrayMulAccum(const ComplexFloat* a, const ComplexFloat* b,
+                               int size, ComplexFloat* accum) {
+  const Float4 signs = Float4Load(kMulSigns);
+  int k;
+  for (k = 0; k + 1 < size; k += 2) {
+    float* dest = (float*)(accum + k);
+    Float4Store(dest, Float4Add(Float4Load(dest), ComplexMulFloat4(
+        Float4Load((const float*)(a + k)),
+        Float4Load((const float*)(b + k)), signs)));
+  }
+  if (k < size) {
+    accum[k] = ComplexFloatAdd(accum[k], ComplexFloatMul(a[k], b[k]));
+  }
+}
+
+void ComplexFloatArrayConjMulAccum(const ComplexFloat* a,
+                                   const ComplexFloat* b, int size,
+                                   ComplexFloat* accum) {
+  const Float4 signs = Float4Load(kConjMulSigns);
+  int k;
+  for (k = 0; k + 1 < size; k += 2) {
+    float* dest = (float*)(accum + k);
+    Float4Store(dest, Float4Add(Float4Load(dest), ComplexMulFloat4(
+        Float4Load((const float*)(a + k)),
+        Float4Load((const float*)(b + k)), signs)));
+  }
+  if (k < size) {
+    ComplexFloat product;
+    product.real = a[k].real * b[k].real + a[k].imag * b[k].imag;
+    product.imag = a[k].real * b[k].imag + a[k].imag * -b[k].real;
+    accum[k] = ComplexFloatAdd(accum[k], product);
+  }
+}
+
+void ComplexFloatArrayAbs2(const ComplexFloat* a, int size, float* out) {
+  int k;
+  for (k = 0; k + 3 < size; k += 4) {
+    const Float4 z0 = Float4Load((const float*)(a + k));
+    const Float4 z1 = Float4Load((const float*)(a + k + 2));
+    Float4Store(out + k,
+                Float4PairwiseAdd(Float4Mul(z0, z0), Float4Mul(z1, z1)));
+  }
+  for (; k < size; ++k) {
+    out[k] = ComplexFloatAbs2(a[k]);
+  }
+}
+
+void ComplexFloatArrayScale(const ComplexFloat* a, float x, int size,
+                            ComplexFloat* out) {
+  const Float4 scale = Float4Broadcast(x);
+  int k;
+  for (k = 0; k + 1 < size; k += 2) {
+    Float4Store((float*)(out + k),
+                Float4Mul(Float4Load((const float*)(a + k)), scale));
+  }
+  if (k < size) {
+    out[k] = ComplexFloatMulReal(a[k], x);
+  }
+}
@@ -15,34 +15,152 @@
 
 #include "dsp/convert_sample.h"
 
+#include "dsp/simd.h"
+
+/* Computes floor(scale * x + 0.5) clamped to [min_value, max_value], the same
+ * as ConvertSampleFloatToInt16() for lanes of Float4. The bounds must be
+ * exactly representable as floats.
+ */
+static Int4 RoundAndClamp(Float4 x, Float4 scale, Float4 min_value,
+                          Float4 max_value) {
+  Float4 value = Float4Add(Float4Mul(scale, x), Float4Broadcast(0.5f));
+  /* Clamping before rounding is equivalent since the bounds are integers. */
+  value = Float4Min(Float4Max(value, min_value), max_value);
+  /* Float4ToInt4 truncates toward zero. Subtract 1 where that rounded up to
+   * get floor. The comparison mask is -1 in those lanes.
+   */
+  const Int4 truncated = Float4ToInt4(value);
+  return Int4Add(truncated, Float4LessThan(value, Int4ToFloat4(truncated)));
+}
+
+/* Decodes a 3-byte little endian 24-bit sample with sign extension. */
+static int32_t LoadInt24(const uint8_t* p) {
+  const int32_t value =
+      (int32_t)p[0] | ((int32_t)p[1] << 8) | ((int32_t)p[2] << 16);
+  return value - ((value & 0x800000) << 1);
+}
+
+/* Encodes a 24-bit sample as 3 bytes little endian. */
+static void StoreInt24(uint8_t* p, int32_t value) {
+  p[0] = (uint8_t)value;
+  p[1] = (uint8_t)(value >> 8);
+  p[2] = (uint8_t)(value >> 16);
+}
+
 void ConvertSampleArrayInt16ToFloat(
     const int16_t* in, int num_samples, float* out) {
+  const Float4 scale = Float4Broadcast(1.0f / 32768.0f);
   int i;
-  for (i = 0; i < num_samples; ++i) {
+  /* Unroll by 8 to hide the latency of the int16 -> int32 widening. */
+  for (i = 0; i + 8 <= num_samples; i += 8) {
+    const Int4 x0 = Int4LoadInt16(in + i);
+    const Int4 x1 = Int4LoadInt16(in + i + 4);
+    Float4Store(out + i, Float4Mul(Int4ToFloat4(x0), scale));
+    Float4Store(out + i + 4, Float4Mul(Int4ToFloat4(x1), scale));
+  }
+  for (; i + 4 <= num_samples; i += 4) {
+    Float4Store(out + i, Float4Mul(Int4ToFloat4(Int4LoadInt16(in + i)), scale));
+  }
+  for (; i < num_samples; ++i) {
     out[i] = ConvertSampleInt16ToFloat(in[i]);
   }
 }
 
 void ConvertSampleArrayInt32ToFloat(
     const int32_t* in, int num_samples, float* out) {
+  const Float4 scale = Float4Broadcast(1.0f / 2147483648.0f);
   int i;
-  for (i = 0; i < num_samples; ++i) {
+  for (i = 0; i + 4 <= num_samples; i += 4) {
+    Float4Store(out + i, Float4Mul(Int4ToFloat4(Int4Load(in + i)), scale));
+  }
+  for (; i < num_samples; ++i) {
     out[i] = ConvertSampleInt32ToFloat(in[i]);
   }
 }
 
+void ConvertSampleArrayInt24ToFloat(
+    const uint8_t* in, int num_samples, float* out) {
+  /* Unpacking 3-byte samples doesn't map well onto Float4, and the loop is
+   * cheap in comparison to the byte loads.
+   */
+  int i;
+  for (i = 0; i < num_samples; ++i, in += 3) {
+    out[i] = ConvertSampleInt24ToFloat(LoadInt24(in));
+  }
+}
+
 void ConvertSampleArrayFloatToInt16(
     const float* in, int num_samples, int16_t* out) {
+  const Float4 scale = Float4Broadcast(32768.0f);
+  const Float4 min_value = Float4Broadcast(INT16_MIN);
+  const Float4 max_value = Float4Broadcast(INT16_MAX);
   int i;
-  for (i = 0; i < num_samples; ++i) {
+  for (i = 0; i + 4 <= num_samples; i += 4) {
+    Int4StoreInt16Saturate(out + i, RoundAndClamp(
+        Float4Load(in + i), scale, min_value, max_value));
+  }
+  for (; i < num_samples; ++i) {
     out[i] = ConvertSampleFloatToInt16(in[i]);
   }
 }
 
+void ConvertSampleArrayFloatToInt24(
+    const float* in, int num_samples, uint8_t* out) {
+  const Float4 scale = Float4Broadcast(8388608.0f);
+  const Float4 min_value = Float4Broadcast(-8388608.0f);
+  const Float4 max_value = Float4Broadcast(8388607.0f);
+  int32_t values[4];
+  int i;
+  for (i = 0; i + 4 <= num_samples; i += 4, out += 12) {
+    Int4Store(values, RoundAndClamp(
+        Float4Load(in + i), scale, min_value, max_value));
+    StoreInt24(out, values[0]);
+    StoreInt24(out + 3, values[1]);
+    StoreInt24(out + 6, values[2]);
+    StoreInt24(out + 9, values[3]);
+  }
+  for (; i < num_samples; ++i, out += 3) {
+    StoreInt24(out, ConvertSampleFloatToInt24(in[i]));
+  }
+}
+
 void ConvertSampleArrayFloatToInt32(
     const float* in, int num_samples, int32_t* out) {
+  const Float4 scale = Float4Broadcast(2147483648.0f);
+  const Float4 min_value = Float4Broadcast(-2147483648.0f);
+  /* Largest float less than 2^31. */
+  const Float4 max_value = Float4Broadcast(2147483520.0f);
+  const Float4 int32_max = Int4AsFloat4(Int4Broadcast(INT32_MAX));
   int i;
-  for (i = 0; i < num_samples; ++i) {
+  for (i = 0; i + 4 <= num_samples; i += 4) {
+    const Float4 value = Float4Mul(scale, Float4Load(in + i));
+    const Float4 truncated = Int4AsFloat4(Float4ToInt4(
+        Float4Min(Float4Max(value, min_value), max_value)));
+    /* As in ConvertSampleFloatToInt32(), values >= 2^31 map to INT32_MAX. */
+    Int4Store(out + i, Float4AsInt4(Float4Select(
+        Float4LessEqual(scale, value), int32_max, truncated)));
+  }
+  for (; i < num_samples; ++i) {
     out[i] = ConvertSampleFloatToInt32(in[i]);
   }
 }
+
+void ConvertSampleArrayFloatTo0_MaxValue(
+    const float* in, int num_samples, int max_value, uint16_t* out) {
+  const float scale = 0.5f * max_value;
+  const Float4 scale4 = Float4Broadcast(scale);
+  const Float4 offset4 = Float4Broadcast(scale + 0.5f);
+  const Float4 minus_one = Float4Broadcast(-1.0f);
+  const Float4 one = Float4Broadcast(1.0f);
+  int i;
+  for (i = 0; i + 4 <= num_samples; i += 4) {
+    const Float4 sample = Float4Min(Float4Max(Float4Load(in + i), minus_one),
+                                    one);
+    /* Values are nonnegative, so truncation is the same as the scalar cast. */
+    Int4StoreUint16Saturate(out + i, Float4ToInt4(
+        Float4Add(Float4Mul(scale4, sample), offset4)));
+  }
+  for (; i < num_samples; ++i) {
+    out[i] = (uint16_t)ConvertSampleFloatTo0_MaxValue(in[i], max_value);
+  }
+}
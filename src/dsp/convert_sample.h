@@ -14,6 +14,9 @@
  *
  *
  * Functions for converting samples between different data types.
+ *
+ * The array functions are vectorized with Float4 (see simd.h), and produce
+ * results identical to calling the single-sample functions in a loop.
  */
 
 #ifndef AUDIO_TO_TACTILE_SRC_DSP_CONVERT_SAMPLE_H_
@@ -36,6 +39,11 @@ static float ConvertSampleInt32ToFloat(int32_t sample) {
   return sample / 2147483648.0f /* 2^31 */;
 }
 
+/* Convert 24-bit sample, an int32_t in [-2^23, 2^23), to float in [-1, 1]. */
+static float ConvertSampleInt24ToFloat(int32_t sample) {
+  return sample / 8388608.0f /* 2^23 */;
+}
+
 /* Convert float sample in [-1, 1] to int16_t. */
 static int16_t ConvertSampleFloatToInt16(float sample) {
   /* Scale by 2^15 and round. */
@@ -49,6 +57,17 @@ static int16_t ConvertSampleFloatToInt16(float sample) {
   return (int16_t)value;
 }
 
+/* Convert float sample in [-1, 1] to a 24-bit sample in [-2^23, 2^23). */
+static int32_t ConvertSampleFloatToInt24(float sample) {
+  /* Scale by 2^23 and round. Unlike INT32_MAX, the clamping bounds are exactly
+   * representable as floats.
+   */
+  float value = floor(8388608.0f * sample + 0.5f);
+  if (-8388608.0f >= value) { value = -8388608.0f; }
+  if (8388607.0f <= value) { value = 8388607.0f; }
+  return (int32_t)value;
+}
+
 /* Convert float sample in [-1, 1] to int32_t. */
 static int32_t ConvertSampleFloatToInt32(float sample) {
   /* Scale by 2^31. It's not worth rounding in this case. Float has only 23
@@ -94,6 +113,21 @@ void ConvertSampleArrayFloatToInt16(
 void ConvertSampleArrayFloatToInt32(
     const float* in, int num_samples, int32_t* out);
 
+/* Convert 24-bit samples packed as 3 bytes each, little endian, as in 24-bit
+ * WAV files. `in` has 3 * num_samples bytes.
+ */
+void ConvertSampleArrayInt24ToFloat(
+    const uint8_t* in, int num_samples, float* out);
+/* Convert floats to packed 24-bit samples. `out` has 3 * num_samples bytes. */
+void ConvertSampleArrayFloatToInt24(
+    const float* in, int num_samples, uint8_t* out);
+
+/* Convert floats to uint16_t values in [0, max_value], for instance for PWM
+ * output, where `max_value` is at most 65535.
+ */
+void ConvertSampleArrayFloatTo0_MaxValue(
+    const float* in, int num_samples, int max_value, uint16_t* out);
+
 #ifdef __cplusplus
 }  /* extern "C" */
 #endif
@@ -0,0 +1,31 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/cpu_dispatch.h"
+
+#include "dsp/simd.h"
+
+const char* CpuDispatchLevel(void) {
+#ifdef CPU_DISPATCH_ENABLED
+  /* Same priority as the ifunc resolver of CPU_DISPATCH_CLONES. */
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f")) {
+    return "avx512f";
+  } else if (__builtin_cpu_supports("avx2")) {
+    return "avx2";
+  }
+#endif
+  return kFloat4Implementation;
+}
@@ -0,0 +1,74 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * Runtime CPU feature dispatch for host builds.
+ *
+ * Host builds compile for a baseline ISA, SSE2 on x86-64, so that one binary
+ * runs on every machine. Marking a hot function with `CPU_DISPATCH_CLONES`
+ * compiles it additionally for AVX2 and AVX-512, and the dynamic loader picks
+ * the best version for the running CPU once at startup (GCC and Clang
+ * `target_clones` function multiversioning, using an ifunc resolver).
+ *
+ * This pays off for plain loops that the compiler auto-vectorizes, which then
+ * run 16 or 32 lanes wide instead of 8, e.g. the int8 dot products in nn_ops.c.
+ * Auto-vectorization needs -O3 or -ftree-vectorize; at -O2, GCC vectorizes
+ * little and the clones are about the same speed as the baseline. Don't use
+ * it on hand-written Float4 kernels (see simd.h): these stay 4 lanes wide in
+ * any clone, so they gain nothing, and static Float4 helpers that aren't
+ * inlined are called at the baseline ISA anyway.
+ *
+ * Clones are compiled without FMA, so that all versions produce the same
+ * results, bit for bit, as the baseline.
+ *
+ * Dispatch is enabled when compiling for x86-64 ELF targets (e.g. Linux) with a
+ * compiler that supports `target_clones`. Elsewhere `CPU_DISPATCH_CLONES`
+ * expands to nothing: NEON is part of the AArch64 baseline, and firmware and
+ * WebAssembly builds target one known CPU. Defining
+ * `AUDIO_TO_TACTILE_DISABLE_CPU_DISPATCH` or `AUDIO_TO_TACTILE_DISABLE_SIMD`
+ * disables it.
+ */
+
+#ifndef AUDIO_TO_TACTILE_SRC_DSP_CPU_DISPATCH_H_
+#define AUDIO_TO_TACTILE_SRC_DSP_CPU_DISPATCH_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if !defined(AUDIO_TO_TACTILE_DISABLE_CPU_DISPATCH) && \
+    !defined(AUDIO_TO_TACTILE_DISABLE_SIMD) && \
+    defined(__x86_64__) && defined(__ELF__) && defined(__has_attribute)
+#if __has_attribute(target_clones)
+#define CPU_DISPATCH_ENABLED 1
+#endif
+#endif
+
+#ifdef CPU_DISPATCH_ENABLED
+#define CPU_DISPATCH_CLONES \
+    __attribute__((target_clones("default", "avx2", "avx512f")))
+#else
+#define CPU_DISPATCH_CLONES
+#endif
+
+/* Gets the name of the instruction set that CPU_DISPATCH_CLONES functions use
+ * on the running CPU: "avx512f", "avx2", or otherwise the baseline Float4
+ * implementation, kFloat4Implementation. For diagnostics.
+ */
+const char* CpuDispatchLevel(void);
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif
+#endif /* AUDIO_TO_TACTILE_SRC_DSP_CPU_DISPATCH_H_ */
@@ -17,6 +17,8 @@
 
 #include <math.h>
 
+#include "dsp/fast_fun_simd.h"
+
 double PowerRatioToDecibels(double linear) {
   /* Calculate 10 * log10(linear) = (10 / log(10)) * log(linear). */
   return (10.0 / M_LN10) * log(linear);
@@ -36,3 +38,73 @@ double DecibelsToAmplitudeRatio(double decibels) {
   /* Invert AmplitudeRatioToDecibels(). */
   return exp((M_LN10 / 20.0) * decibels);
 }
+
+/* Computes output[i] = max(scale * log2(input[i]), floor_db). */
+static void Log2ToDecibelsN(const float* input, float scale, float floor_db,
+                            int size, float* output) {
+  /* Clamp in the linear domain so that log2 is evaluated on valid input. For
+   * floor_db = -HUGE_VAL, floor_linear is 0 and max() leaves input unchanged.
+   */
+  const Float4 floor_linear =
+      Float4Broadcast((float)pow(2.0, floor_db / scale));
+  const Float4 scale4 = Float4Broadcast(scale);
+  const Float4 floor4 = Float4Broadcast(floor_db);
+  int i;
+  for (i = 0; i + 4 <= size; i += 4) {
+    const Float4 x = Float4Max(Float4Load(input + i), floor_linear);
+    Float4Store(output + i, Float4Max(
+        Float4Mul(scale4, FastLog2Float4(x)), floor4));
+  }
+  if (i < size) {
+    /* Process the remaining 1-3 values, padded with ones. */
+    float buffer[4] = {1.0f, 1.0f, 1.0f, 1.0f};
+    const int remaining = size - i;
+    int j;
+    for (j = 0; j < remaining; ++j) { buffer[j] = input[i + j]; }
+    const Float4 x = Float4Max(Float4Load(buffer), floor_linear);
+    Float4Store(buffer, Float4Max(
+        Float4Mul(scale4, FastLog2Float4(x)), floor4));
+    for (j = 0; j < remaining; ++j) { output[i + j] = buffer[j]; }
+  }
+}
+
+/* Computes output[i] = 2^(scale * input[i]). */
+static void DecibelsToExp2N(const float* input, float scale, int size,
+                            float* output) {
+  const Float4 scale4 = Float4Broadcast(scale);
+  int i;
+  for (i = 0; i + 4 <= size; i += 4) {
+    Float4Store(output + i,
+                FastExp2Float4(Float4Mul(scale4, Float4Load(input + i))));
+  }
+  if (i < size) {
+    /* Process the remaining 1-3 values, padded with zeros. */
+    float buffer[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+    const int remaining = size - i;
+    int j;
+    for (j = 0; j < remaining; ++j) { buffer[j] = input[i + j]; }
+    Float4Store(buffer, FastExp2Float4(Float4Mul(scale4, Float4Load(buffer))));
+    for (j = 0; j < remaining; ++j) { output[i + j] = buffer[j]; }
+  }
+}
+
+void FastPowerRatioToDecibelsN(const float* input, float floor_db, int size,
+                               float* output) {
+  Log2ToDecibelsN(input, (float)((10.0 * M_LN2) / M_LN10), floor_db,
+                  size, output);
+}
+
+void FastAmplitudeRatioToDecibelsN(const float* input, float floor_db,
+                                   int size, float* output) {
+  Log2ToDecibelsN(input, (float)((20.0 * M_LN2) / M_LN10), floor_db,
+                  size, output);
+}
+
+void FastDecibelsToPowerRatioN(const float* input, int size, float* output) {
+  DecibelsToExp2N(input, (float)(M_LN10 / (10.0 * M_LN2)), size, output);
+}
+
+void FastDecibelsToAmplitudeRatioN(const float* input, int size,
+                                   float* output) {
+  DecibelsToExp2N(input, (float)(M_LN10 / (20.0 * M_LN2)), size, output);
+}
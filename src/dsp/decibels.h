@@ -15,6 +15,10 @@
  *
  * Functions for converting to and from decibels.
  *
+ * The `N` functions at the bottom convert arrays, four values at a time with
+ * the Float4 functions from fast_fun_simd.h. They are faster per value than
+ * looping over the scalar Fast* functions, and also more accurate.
+ *
  * NOTE: Lighter functions below are marked `static` [the C analogy for
  * `inline`] so that ideally they get inlined.
  */
@@ -90,6 +94,36 @@ static float FastDecibelsToAmplitudeRatio(float decibels) {
   return FastExp2((float)(M_LN10 / (20.0 * M_LN2)) * decibels);
 }
 
+/* Converts `size` power ratios to decibels,
+ *
+ *   output[i] = max(10 log10(input[i]), floor_db),
+ *
+ * with max absolute error of about 1e-4 dB. Clamping the input to the floor
+ * also makes zero input valid. Pass floor_db = -HUGE_VAL for no clamping, in
+ * which case input values must be positive and finite. Processing may be in
+ * place, i.e. output == input.
+ */
+void FastPowerRatioToDecibelsN(const float* input, float floor_db, int size,
+                               float* output);
+
+/* Converts `size` amplitude ratios to decibels, like
+ * FastPowerRatioToDecibelsN() but computing max(20 log10(input[i]), floor_db).
+ */
+void FastAmplitudeRatioToDecibelsN(const float* input, float floor_db,
+                                   int size, float* output);
+
+/* Converts `size` decibel values to power ratios, with max relative error of
+ * about 1e-5. Same limitations as FastDecibelsToPowerRatio(). Processing may be
+ * in place.
+ */
+void FastDecibelsToPowerRatioN(const float* input, int size, float* output);
+
+/* Converts `size` decibel values to amplitude ratios, like
+ * FastDecibelsToPowerRatioN().
+ */
+void FastDecibelsToAmplitudeRatioN(const float* input, int size,
+                                   float* output);
+
 #ifdef __cplusplus
 }  /* extern "C" */
 #endif
@@ -0,0 +1,168 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * Protection against denormal (subnormal) floats in IIR filter state.
+ *
+ * When the input goes silent, IIR filter states decay exponentially toward
+ * zero and eventually become denormal. On x86, arithmetic on denormals takes a
+ * slow microcode path, so that processing silence can be 10-100x slower than
+ * processing sound. Two mechanisms are provided:
+ *
+ *  - `DenormalGuardBegin()` and `DenormalGuardEnd()` set the CPU to flush
+ *    denormals to zero for the duration of a processing call and then restore
+ *    the caller's setting. This sets the FTZ and DAZ bits of MXCSR on x86 with
+ *    SSE, FZ of FPCR on AArch64, and FZ of FPSCR on 32-bit ARM with an FPU
+ *    such as Cortex-M4F. Guards nest: an inner guard with the mode already set
+ *    only reads the control register.
+ *
+ *  - On other targets (e.g. WebAssembly or soft float), where flush-to-zero is
+ *    not available, `DenormalsDither()` adds a tiny DC offset to filter state
+ *    once per block, which keeps it away from the denormal range. The offset
+ *    kDenormalsDitherOffset = 1e-18 is far below any audible or tactile
+ *    level. Dithering is a no-op where flush-to-zero is available, unless
+ *    `AUDIO_TO_TACTILE_DENORMAL_DITHER` is defined to force it.
+ *
+ * Defining `AUDIO_TO_TACTILE_ALLOW_DENORMALS` disables flush-to-zero and the
+ * default dithering, e.g. to benchmark without protection.
+ *
+ * The Enveloper, CarlFrontend, PostProcessor, and TactileProcessorBatch
+ * processing functions use these internally, so callers don't need to.
+ *
+ * Example use:
+ *   DenormalGuard guard;
+ *   DenormalGuardBegin(&guard);
+ *   DenormalsDither(filter_state, num_states);
+ *   ... Process samples ...
+ *   DenormalGuardEnd(&guard);
+ *
+ * NOTE: Functions below are marked `static` [the C analogy for `inline`] so
+ * that ideally they get inline expanded.
+ */
+
+#ifndef AUDIO_TO_TACTILE_SRC_DSP_DENORMALS_H_
+#define AUDIO_TO_TACTILE_SRC_DSP_DENORMALS_H_
+
+#include <stdint.h>
+
+#if defined(AUDIO_TO_TACTILE_ALLOW_DENORMALS)
+/* No protection. */
+#elif defined(__SSE__) || defined(__SSE2__) || defined(_M_X64)
+#define DENORMALS_USE_SSE 1
+#include <xmmintrin.h>
+#elif defined(__aarch64__) && defined(__GNUC__)
+#define DENORMALS_USE_AARCH64 1
+#elif defined(__arm__) && defined(__ARM_FP) && defined(__GNUC__)
+#define DENORMALS_USE_VFP 1
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(DENORMALS_USE_SSE)
+/* MXCSR flush-to-zero (bit 15) and denormals-are-zero (bit 6). */
+#define kDenormalsControlBits 0x8040u
+#elif defined(DENORMALS_USE_AARCH64) || defined(DENORMALS_USE_VFP)
+/* FPCR or FPSCR flush-to-zero (bit 24). */
+#define kDenormalsControlBits 0x1000000u
+#else
+#define kDenormalsControlBits 0u
+#endif
+
+/* Nonzero if DenormalGuardBegin() enables flush-to-zero on this target. */
+#define kDenormalsHaveFlushToZero (kDenormalsControlBits != 0)
+
+/* Offset added by DenormalsDither(). */
+#define kDenormalsDitherOffset 1e-18f
+
+#if defined(AUDIO_TO_TACTILE_DENORMAL_DITHER) || \
+    (!defined(AUDIO_TO_TACTILE_ALLOW_DENORMALS) && !kDenormalsHaveFlushToZero)
+#define kDenormalsUseDither 1
+#else
+#define kDenormalsUseDither 0
+#endif
+
+typedef struct {
+  /* Floating-point control register value before DenormalGuardBegin(). */
+  uint32_t saved_control;
+} DenormalGuard;
+
+/* Reads the floating-point control register. */
+static uint32_t DenormalsGetControl(void) {
+#if defined(DENORMALS_USE_SSE)
+  return (uint32_t)_mm_getcsr();
+#elif defined(DENORMALS_USE_AARCH64)
+  uint64_t fpcr;
+  __asm__ __volatile__("mrs %0, fpcr" : "=r"(fpcr));
+  return (uint32_t)fpcr;
+#elif defined(DENORMALS_USE_VFP)
+  uint32_t fpscr;
+  __asm__ __volatile__("vmrs %0, fpscr" : "=r"(fpscr));
+  return fpscr;
+#else
+  return 0;
+#endif
+}
+
+/* Writes the floating-point control register. */
+static void DenormalsSetControl(uint32_t control) {
+#if defined(DENORMALS_USE_SSE)
+  _mm_setcsr(control);
+#elif defined(DENORMALS_USE_AARCH64)
+  const uint64_t fpcr = control;
+  __asm__ __volatile__("msr fpcr, %0" : : "r"(fpcr));
+#elif defined(DENORMALS_USE_VFP)
+  __asm__ __volatile__("vmsr fpscr, %0" : : "r"(control));
+#else
+  (void)control;
+#endif
+}
+
+/* Enables flush-to-zero, saving the previous mode in `guard`. */
+static void DenormalGuardBegin(DenormalGuard* guard) {
+  const uint32_t control = DenormalsGetControl();
+  guard->saved_control = control;
+  if ((control & kDenormalsControlBits) != kDenormalsControlBits) {
+    DenormalsSetControl(control | kDenormalsControlBits);
+  }
+}
+
+/* Restores the mode saved by the matching DenormalGuardBegin(). */
+static void DenormalGuardEnd(const DenormalGuard* guard) {
+  if ((guard->saved_control & kDenormalsControlBits) !=
+      kDenormalsControlBits) {
+    DenormalsSetControl(guard->saved_control);
+  }
+}
+
+/* Adds kDenormalsDitherOffset to `state[0]`, ..., `state[size - 1]` if
+ * dithering is enabled, otherwise does nothing.
+ */
+static void DenormalsDither(float* state, int size) {
+#if kDenormalsUseDither
+  int i;
+  for (i = 0; i < size; ++i) {
+    state[i] += kDenormalsDitherOffset;
+  }
+#else
+  (void)state;
+  (void)size;
+#endif
+}
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif
+#endif /* AUDIO_TO_TACTILE_SRC_DSP_DENORMALS_H_ */
@@ -0,0 +1,130 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * Float4 helpers for FIR resampling filters, shared by q_resampler.c and
+ * async_resampler.c: dot products of a filter with mono or interleaved
+ * multichannel input, and linear interpolation between two filters.
+ *
+ * NOTE: Functions below are marked `static` [the C analogy for `inline`] so
+ * that ideally they get inline expanded.
+ */
+
+#ifndef AUDIO_TO_TACTILE_SRC_DSP_DOT_PRODUCT_H_
+#define AUDIO_TO_TACTILE_SRC_DSP_DOT_PRODUCT_H_
+
+#include "dsp/simd.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Accumulates dot products of `filter` with each channel of interleaved
+ * `input`, `sums[c] += sum_k filter[k] * input[k * num_channels + c]`. Four
+ * channels at a time are computed together in Float4 lanes, which is the same
+ * arithmetic per channel as a scalar loop over k.
+ */
+static void AccumulateMultichannelDotProducts(const float* filter,
+                                              int num_terms,
+                                              const float* input,
+                                              int num_channels,
+                                              float* sums) {
+  int c = 0;
+  int k;
+  for (; c + 4 <= num_channels; c += 4) {
+    Float4 sum = Float4Load(sums + c);
+    const float* input_c = input + c;
+    for (k = 0; k < num_terms; ++k, input_c += num_channels) {
+      sum = Float4Add(sum, Float4Mul(Float4Broadcast(filter[k]),
+                                     Float4Load(input_c)));
+    }
+    Float4Store(sums + c, sum);
+  }
+
+  /* Process the remaining 0 to 3 channels together in one pass over `input`. */
+  const float* input_c = input + c;
+  switch (num_channels - c) {
+    case 1: {
+      float sum0 = sums[c];
+      for (k = 0; k < num_terms; ++k, input_c += num_channels) {
+        sum0 += filter[k] * input_c[0];
+      }
+      sums[c] = sum0;
+    } break;
+    case 2: {
+      float sum0 = sums[c];
+      float sum1 = sums[c + 1];
+      for (k = 0; k < num_terms; ++k, input_c += num_channels) {
+        sum0 += filter[k] * input_c[0];
+        sum1 += filter[k] * input_c[1];
+      }
+      sums[c] = sum0;
+      sums[c + 1] = sum1;
+    } break;
+    case 3: {
+      float sum0 = sums[c];
+      float sum1 = sums[c + 1];
+      float sum2 = sums[c + 2];
+      for (k = 0; k < num_terms; ++k, input_c += num_channels) {
+        sum0 += filter[k] * input_c[0];
+        sum1 += filter[k] * input_c[1];
+        sum2 += filter[k] * input_c[2];
+      }
+      sums[c] = sum0;
+      sums[c + 1] = sum1;
+      sums[c + 2] = sum2;
+    } break;
+  }
+}
+
+/* Computes the dot product `sum_k filter[k] * input[k]` for the mono case,
+ * accumulating four partial sums in Float4 lanes.
+ */
+static float MonoDotProduct(const float* filter, const float* input,
+                            int num_terms) {
+  Float4 sum4 = Float4Broadcast(0.0f);
+  int k;
+  for (k = 0; k + 4 <= num_terms; k += 4) {
+    sum4 = Float4Add(sum4, Float4Mul(Float4Load(filter + k),
+                                     Float4Load(input + k)));
+  }
+  float sum = (Float4GetLane(sum4, 0) + Float4GetLane(sum4, 1))
+      + (Float4GetLane(sum4, 2) + Float4GetLane(sum4, 3));
+  for (; k < num_terms; ++k) {
+    sum += filter[k] * input[k];
+  }
+  return sum;
+}
+
+/* Linearly interpolates `num_taps` coefficients between filters `row0` and
+ * `row1`, `filter[k] = row0[k] + frac * (row1[k] - row0[k])`.
+ */
+static void InterpolateFilter(const float* row0, const float* row1,
+                              float frac, int num_taps, float* filter) {
+  const Float4 frac4 = Float4Broadcast(frac);
+  int k;
+  for (k = 0; k + 4 <= num_taps; k += 4) {
+    const Float4 value0 = Float4Load(row0 + k);
+    Float4Store(filter + k, Float4Add(value0, Float4Mul(
+        frac4, Float4Sub(Float4Load(row1 + k), value0))));
+  }
+  for (; k < num_taps; ++k) {
+    filter[k] = row0[k] + frac * (row1[k] - row0[k]);
+  }
+}
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif
+#endif /* AUDIO_TO_TACTILE_SRC_DSP_DOT_PRODUCT_H_ */
@@ -15,6 +15,8 @@
 
 #include "dsp/fast_fun.h"
 
+#include <math.h>
+
 /* These table values match the values computed by fast_fun_compute_tables.c.
  * Printed tables can be regenerated by running the unit test as
  *
@@ -107,3 +109,27 @@ const int32_t kFastFunExp2Table[256] = {
     7333050, 7375676, 7418417, 7461274, 7504247, 7547337, 7590544, 7633868,
     7677309, 7720868, 7764546, 7808341, 7852256, 7896289, 7940442, 7984715,
     8029107, 8073620, 8118254, 8163008, 8207884, 8252882, 8298002, 8343244};
+
+void FastPowTableInit(FastPowTable* table, float exponent) {
+  const double p = exponent;
+  int i;
+  for (i = 0; i < kFastPowTableNumOctaves; ++i) {
+    table->octave[i] = (float)pow(2.0, (i - kFastPowTableNumOctaves / 2) * p);
+  }
+
+  const double segment_width = 1.0 / kFastPowTableNumSegments;
+  int k;
+  for (k = 0; k < kFastPowTableNumSegments; ++k) {
+    const double m0 = 1.0 + k * segment_width;
+    const double y0 = pow(m0, p);
+    const double y1 = pow(m0 + segment_width, p);
+    /* The chord through the segment endpoints, shifted by half its error at
+     * the midpoint to roughly balance the error over the segment.
+     */
+    const double midpoint_error =
+        0.5 * (y0 + y1) - pow(m0 + 0.5 * segment_width, p);
+    const double slope = (y1 - y0) / segment_width;
+    table->segment[k][0] = (float)(y0 - 0.5 * midpoint_error - slope * m0);
+    table->segment[k][1] = (float)slope;
+  }
+}
@@ -13,7 +13,7 @@
  * limitations under the License.
  *
  *
- * Fast log2, exp2, pow, and tanh functions in C.
+ * Fast log2, exp2, pow, rsqrt, and tanh functions in C.
  *
  * This library implements fast log2 (log base 2), exp2 (2^x), power x^y, tanh,
  * and sigmoid functions for 32-bit float arguments through float bit
@@ -37,6 +37,8 @@
  *  - FastLog2(x) has max absolute error of about 0.003.
  *  - FastExp2(x) has max relative error of about 0.3%.
  *  - FastPow(x) has max relative error of about 0.5%.
+ *  - FastPowTableEval(x) has max relative error of about 0.012% for |p| <= 1.
+ *  - FastRsqrt(x) has max relative error of about 0.2%.
  *  - FastTanh(x) has max absolute error of about 0.0008.
  *  - FastSigmoid(x) has max absolute error of about 0.0004.
  *
@@ -183,6 +185,80 @@ static float FastExp2(float x) {
  */
 static float FastPow(float x, float y) { return FastExp2(FastLog2(x) * y); }
 
+/* Number of octaves and of mantissa segments in FastPowTable. */
+#define kFastPowTableNumOctaves 128
+#define kFastPowTableNumSegments 32
+
+/* Lookup table for x^p with a fixed exponent p, e.g. for power law compression
+ * where the exponent changes only when tuning changes. Decomposing x as
+ * x = 2^e * m with m in [1, 2), we have x^p = 2^(e p) * m^p. The first factor
+ * is looked up per octave e. For the second factor, [1, 2) is divided into
+ * kFastPowTableNumSegments equal segments, and m^p is approximated linearly
+ * over each segment.
+ *
+ * For |p| <= 1, the max relative error is about 1.2e-4, compared to about 0.5%
+ * for FastPow(). It is about 7e-5 for p = -0.7 and 1.1e-5 for p = 0.25, the
+ * default Enveloper AGC and compressor exponents. The table is 768 bytes.
+ */
+typedef struct {
+  /* octave[i] = 2^((i - kFastPowTableNumOctaves / 2) p). */
+  float octave[kFastPowTableNumOctaves];
+  /* m^p ~= segment[k][0] + segment[k][1] * m for m in segment k. */
+  float segment[kFastPowTableNumSegments][2];
+} FastPowTable;
+
+/* Fills `table` for computing x^`exponent`. This calls math.h pow a couple
+ * hundred times, so it should be done when the exponent changes rather than
+ * in an audio loop.
+ */
+void FastPowTableInit(FastPowTable* table, float exponent);
+
+/* Computes x^p with `table` from FastPowTableInit(table, p). This costs about
+ * the same as FastPow(), with 40x smaller error.
+ *
+ * Limitations:
+ *  - Assumes x is nonnegative and finite.
+ *  - x is effectively clamped to [2^-64, 2^64), the range of octaves in the
+ *    table. In particular, x = 0 gives 2^(-64 p), which is finite.
+ */
+static float FastPowTableEval(const FastPowTable* table, float x) {
+  int32_t x_bits;
+  memcpy(&x_bits, &x, sizeof(float));
+  /* Octave index, from the exponent bits offset by (bias - num_octaves / 2). */
+  int32_t i = ((x_bits >> 23) & 0xFF) - (127 - kFastPowTableNumOctaves / 2);
+  if (i < 0) { i = 0; }
+  if (i >= kFastPowTableNumOctaves) { i = kFastPowTableNumOctaves - 1; }
+  /* Segment index from the top 5 bits of the mantissa. */
+  const int32_t k = (x_bits >> (23 - 5)) & (kFastPowTableNumSegments - 1);
+  /* Get m in [1, 2) by replacing the exponent bits with those of 1.0f. */
+  const int32_t m_bits = (x_bits & ((1 << 23) - 1)) | INT32_C(0x3F800000);
+  float m;
+  memcpy(&m, &m_bits, sizeof(float));
+  const float* segment = table->segment[k];
+  return table->octave[i] * (segment[0] + segment[1] * m);
+}
+
+/* Fast 1/sqrt(x), accurate to about 0.2% relative error.
+ *
+ * Limitations:
+ *  - x is assumed to be positive, finite, and not denormal.
+ *
+ * Algorithm:
+ * Halving and negating the float bits roughly halves and negates log2(x). A
+ * magic constant restores the exponent bias and reduces the error of the
+ * initial estimate, which is then refined by one Newton iteration. Unlike
+ * FastPow(x, -0.5f), no lookup tables are used. See
+ * http://www.lomont.org/papers/2003/InvSqrt.pdf
+ */
+static float FastRsqrt(float x) {
+  int32_t bits;
+  memcpy(&bits, &x, sizeof(float));
+  bits = INT32_C(0x5f3759df) - (bits >> 1);
+  float y;
+  memcpy(&y, &bits, sizeof(float));
+  return y * (1.5f - (0.5f * x) * (y * y));
+}
+
 /* Fast tanh(x), accurate to about 0.0008 max abs error, ~1.7 ns on Skylake.
  *
  * The result is valid for non-NaN x (even for large x). The implementation
@@ -0,0 +1,49 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/fast_fun_simd.h"
+
+void FastPowN(const float* input, float exponent, int size, float* output) {
+  const Float4 exponent4 = Float4Broadcast(exponent);
+  int i;
+  for (i = 0; i + 4 <= size; i += 4) {
+    Float4Store(output + i, FastPowFloat4(Float4Load(input + i), exponent4));
+  }
+  if (i < size) {
+    /* Process the remaining 1-3 values, padded with ones. */
+    float buffer[4] = {1.0f, 1.0f, 1.0f, 1.0f};
+    const int remaining = size - i;
+    int j;
+    for (j = 0; j < remaining; ++j) { buffer[j] = input[i + j]; }
+    Float4Store(buffer, FastPowFloat4(Float4Load(buffer), exponent4));
+    for (j = 0; j < remaining; ++j) { output[i + j] = buffer[j]; }
+  }
+}
+
+void FastTanhN(const float* input, int size, float* output) {
+  int i;
+  for (i = 0; i + 4 <= size; i += 4) {
+    Float4Store(output + i, FastTanhFloat4(Float4Load(input + i)));
+  }
+  if (i < size) {
+    /* Process the remaining 1-3 values, padded with zeros. */
+    float buffer[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+    const int remaining = size - i;
+    int j;
+    for (j = 0; j < remaining; ++j) { buffer[j] = input[i + j]; }
+    Float4Store(buffer, FastTanhFloat4(Float4Load(buffer)));
+    for (j = 0; j < remaining; ++j) { output[i + j] = buffer[j]; }
+  }
+}
@@ -0,0 +1,153 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * Vectorized fast log2, exp2, pow, and tanh functions.
+ *
+ * These are 4-lane Float4 (see simd.h) analogs of the functions in fast_fun.h.
+ * Instead of the lookup tables used by fast_fun.h, which would need a gather
+ * per lane, they use float bit manipulations and polynomial approximations,
+ * so they are both faster per value and more accurate:
+ *
+ *  - FastLog2Float4(x) has max absolute error of about 2e-5.
+ *  - FastExp2Float4(x) has max relative error of about 3e-6.
+ *  - FastPowFloat4(x, y) has max relative error of about 3e-5 for |y| <= 2.
+ *  - FastTanhFloat4(x) has max absolute error of about 2e-6.
+ *
+ * The limitations on arguments are the same as for the scalar functions.
+ * Results are the same with all Float4 implementations, except for small
+ * differences in FastTanhFloat4() on 32-bit ARM NEON (see Float4Div()).
+ *
+ * For processing arrays, FastPowN() and FastTanhN() apply the functions to
+ * `size` values, four at a time.
+ */
+
+#ifndef AUDIO_TO_TACTILE_SRC_DSP_FAST_FUN_SIMD_H_
+#define AUDIO_TO_TACTILE_SRC_DSP_FAST_FUN_SIMD_H_
+
+#include "dsp/math_constants.h"
+#include "dsp/simd.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Fast log base 2 of each lane, with max abs error of about 2e-5.
+ *
+ * Limitations:
+ *  - x is assumed to be positive and finite.
+ *  - If x is a denormal, the result is less accurate.
+ *
+ * Algorithm:
+ * As in FastLog2(), x is decomposed as x = 2^exponent * (1 + mantissa) so that
+ *
+ *   log2(x) = exponent + log2(1 + mantissa).
+ *
+ * The second term is approximated with a degree-5 polynomial in mantissa,
+ * fitted to minimize the max error over [0, 1) with p(0) = 0.
+ */
+static Float4 FastLog2Float4(Float4 x) {
+  const Int4 x_bits = Float4AsInt4(x);
+  /* Extract and debias the exponent. Magic constant 23 is the number of
+   * mantissa bits in a 32-bit float.
+   */
+  const Float4 exponent = Int4ToFloat4(
+      Int4Sub(Int4ShiftRight(x_bits, 23), Int4Broadcast(127)));
+  /* Construct 1 + mantissa as a float in [1, 2). */
+  const Float4 t = Float4Sub(
+      Int4AsFloat4(Int4Or(Int4And(x_bits, Int4Broadcast(0x7FFFFF)),
+                          Int4Broadcast(0x3F800000))),
+      Float4Broadcast(1.0f));
+  /* Evaluate the polynomial with Horner's method. */
+  Float4 p = Float4Broadcast(0.0463853415f);
+  p = Float4Add(Float4Mul(p, t), Float4Broadcast(-0.196269593f));
+  p = Float4Add(Float4Mul(p, t), Float4Broadcast(0.417595749f));
+  p = Float4Add(Float4Mul(p, t), Float4Broadcast(-0.709662811f));
+  p = Float4Add(Float4Mul(p, t), Float4Broadcast(1.44196562f));
+  return Float4Add(exponent, Float4Mul(p, t));
+}
+
+/* Fast 2^x of each lane, with max relative error of about 3e-6.
+ *
+ * Limitations:
+ *  - x is clamped to [-126, 126], so that the result is a normal float.
+ *
+ * Algorithm:
+ * As in FastExp2(), x is split as x = x_int + x_frac, and
+ *
+ *   2^x = 2^x_int * 2^x_frac.
+ *
+ * Here x_int = round(x) so that x_frac is in [-0.5, 0.5], where 2^x_frac is
+ * approximated by a degree-4 polynomial fitted to minimize the max relative
+ * error. Multiplying by 2^x_int is done by adding x_int to the exponent bits.
+ */
+static Float4 FastExp2Float4(Float4 x) {
+  /* Adding 1.5 * 2^23 rounds x to an integer, in the low mantissa bits. */
+  const float kRoundMagic = 12582912.0f;
+  x = Float4Min(Float4Max(x, Float4Broadcast(-126.0f)),
+                Float4Broadcast(126.0f));
+  const Float4 y = Float4Add(x, Float4Broadcast(kRoundMagic));
+  const Int4 x_int = Int4Sub(Float4AsInt4(y),
+                             Float4AsInt4(Float4Broadcast(kRoundMagic)));
+  const Float4 x_frac = Float4Sub(
+      x, Float4Sub(y, Float4Broadcast(kRoundMagic)));
+
+  Float4 p = Float4Broadcast(0.00957010169f);
+  p = Float4Add(Float4Mul(p, x_frac), Float4Broadcast(0.0559178603f));
+  p = Float4Add(Float4Mul(p, x_frac), Float4Broadcast(0.240247448f));
+  p = Float4Add(Float4Mul(p, x_frac), Float4Broadcast(0.693121815f));
+  p = Float4Add(Float4Mul(p, x_frac), Float4Broadcast(0.999999261f));
+  return Int4AsFloat4(Int4Add(Float4AsInt4(p), Int4ShiftLeft(x_int, 23)));
+}
+
+/* Fast power x^y of each lane for x > 0, with max relative error of about
+ * 3e-5 for |y| <= 2.
+ *
+ * Limitations:
+ *  - Assumes x is positive and finite.
+ *  - Assumes 1e-37 <= |x^y| <= 1e37.
+ */
+static Float4 FastPowFloat4(Float4 x, Float4 y) {
+  return FastExp2Float4(Float4Mul(FastLog2Float4(x), y));
+}
+
+/* Fast tanh(x) of each lane, with max abs error of about 2e-6. The result is
+ * valid for non-NaN x, computed as in FastTanh() as (y - 1) / (y + 1) with
+ * y = FastExp2Float4((2 / M_LN2) * x).
+ */
+static Float4 FastTanhFloat4(Float4 x) {
+  /* For |x| >= 9.011, tanh(x) is exactly 1 or -1 to float32 precision. */
+  x = Float4Min(Float4Max(x, Float4Broadcast(-9.011f)),
+                Float4Broadcast(9.011f));
+  const Float4 exp_2x = FastExp2Float4(
+      Float4Mul(Float4Broadcast((float)(2.0 / M_LN2)), x));
+  const Float4 one = Float4Broadcast(1.0f);
+  return Float4Div(Float4Sub(exp_2x, one), Float4Add(exp_2x, one));
+}
+
+/* Computes `output[i] = input[i]^exponent` for `size` values with
+ * FastPowFloat4(). The input values are assumed positive. Processing may be
+ * in place, i.e. output == input.
+ */
+void FastPowN(const float* input, float exponent, int size, float* output);
+
+/* Computes `output[i] = tanh(input[i])` for `size` values with
+ * FastTanhFloat4(). Processing may be in place, i.e. output == input.
+ */
+void FastTanhN(const float* input, int size, float* output);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+#endif /* AUDIO_TO_TACTILE_SRC_DSP_FAST_FUN_SIMD_H_ */
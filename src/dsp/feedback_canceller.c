@@ -0,0 +1,309 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/feedback_canceller.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "dsp/aligned_alloc.h"
+#include "dsp/complex.h"
+#include "dsp/fft.h"
+
+const FeedbackCancellerOptions kFeedbackCancellerDefaultOptions = {
+    /*step_size=*/0.2f,
+    /*power_smoothing=*/0.9f,
+    /*regularization=*/1e-4f,
+};
+
+/* Spectra below are in the packed format of FftForwardRealTransform(), B
+ * complex values where element 0 holds the real-valued DC and Nyquist
+ * coefficients in its real and imaginary parts.
+ */
+struct FeedbackCanceller {
+  /* Partition spectra W_p. `weights[B * p + k]` is coefficient k of partition
+   * p. The inverse transform is unnormalized, so W_p is N times the spectrum
+   * of the partition's taps.
+   */
+  ComplexFloat* weights;
+  /* Circular delay line of the past P reference window spectra, with the same
+   * layout as `weights`.
+   */
+  ComplexFloat* delay_line;
+  /* Workspace of B complex values, viewed as N floats for the real FFT. */
+  ComplexFloat* workspace;
+  /* Smoothed reference power per bin, B + 1 values from DC to Nyquist. */
+  float* power;
+  /* The previous reference block, the first half of the next window. */
+  float* prev_reference;
+  /* Index in `delay_line` of the most recent window spectrum. */
+  int delay_line_head;
+  /* Partition to apply the gradient constraint to on the next block. */
+  int constrain_index;
+  /* Number of filter partitions P. */
+  int num_partitions;
+  /* Block size B. The transform size is N = 2 B. */
+  int block_size;
+
+  float step_size;
+  float power_smoothing;
+  float regularization;
+};
+
+/* Computes `accum += a * b` for packed spectra of `size` values. */
+static void PackedMulAccum(const ComplexFloat* a, const ComplexFloat* b,
+                           int size, ComplexFloat* accum) {
+  accum[0].real += a[0].real * b[0].real;
+  accum[0].imag += a[0].imag * b[0].imag;
+  ComplexFloatArrayMulAccum(a + 1, b + 1, size - 1, accum + 1);
+}
+
+/* Computes `accum += conj(a) * b` for packed spectra of `size` values. */
+static void PackedConjMulAccum(const ComplexFloat* a, const ComplexFloat* b,
+                               int size, ComplexFloat* accum) {
+  accum[0].real += a[0].real * b[0].real;
+  accum[0].imag += a[0].imag * b[0].imag;
+  ComplexFloatArrayConjMulAccum(a + 1, b + 1, size - 1, accum + 1);
+}
+
+FeedbackCanceller* FeedbackCancellerMake(int block_size, int num_taps,
+                                         const FeedbackCancellerOptions*
+                                             options) {
+  if (!(2 <= block_size && block_size <= kFftMaxTransformSize / 2 &&
+        (block_size & (block_size - 1)) == 0)) {
+    fprintf(stderr, "Error: FeedbackCanceller block_size must be a power of 2 "
+            "between 2 and %d, got: %d.\n", kFftMaxTransformSize / 2,
+            block_size);
+    return NULL;
+  } else if (num_taps <= 0) {
+    fprintf(stderr, "Error: FeedbackCanceller num_taps must be positive.\n");
+    return NULL;
+  }
+  if (options == NULL) {
+    options = &kFeedbackCancellerDefaultOptions;
+  }
+  if (!(0.0f < options->step_size && options->step_size <= 1.0f) ||
+      !(0.0f <= options->power_smoothing && options->power_smoothing < 1.0f) ||
+      !(options->regularization > 0.0f)) {
+    fprintf(stderr, "Error: Invalid FeedbackCanceller options.\n");
+    return NULL;
+  }
+
+  FeedbackCanceller* canceller =
+      (FeedbackCanceller*)AlignedAlloc(sizeof(FeedbackCanceller));
+  if (canceller == NULL) {
+    fprintf(stderr, "Error: Memory allocation failed.\n");
+    return NULL;
+  }
+  canceller->weights = NULL;
+  canceller->delay_line = NULL;
+  canceller->workspace = NULL;
+  canceller->power = NULL;
+  canceller->prev_reference = NULL;
+
+  const int num_partitions = (num_taps + block_size - 1) / block_size;
+  const size_t spectra_bytes =
+      sizeof(ComplexFloat) * num_partitions * block_size;
+  if (!(canceller->weights = (ComplexFloat*)AlignedAlloc(spectra_bytes)) ||
+      !(canceller->delay_line = (ComplexFloat*)AlignedAlloc(spectra_bytes)) ||
+      !(canceller->workspace = (ComplexFloat*)AlignedAlloc(
+            sizeof(ComplexFloat) * block_size)) ||
+      !(canceller->power =
+            (float*)AlignedAlloc(sizeof(float) * (block_size + 1))) ||
+      !(canceller->prev_reference =
+            (float*)AlignedAlloc(sizeof(float) * block_size))) {
+    fprintf(stderr, "Error: Memory allocation failed.\n");
+    FeedbackCancellerFree(canceller);
+    return NULL;
+  }
+
+  canceller->num_partitions = num_partitions;
+  canceller->block_size = block_size;
+  canceller->step_size = options->step_size;
+  canceller->power_smoothing = options->power_smoothing;
+  /* A unit-variance white window of N samples has expected power N per bin. */
+  canceller->regularization = options->regularization * 2 * block_size;
+
+  FeedbackCancellerReset(canceller);
+  return canceller;
+}
+
+void FeedbackCancellerFree(FeedbackCanceller* canceller) {
+  if (canceller) {
+    AlignedFree(canceller->prev_reference);
+    AlignedFree(canceller->power);
+    AlignedFree(canceller->workspace);
+    AlignedFree(canceller->delay_line);
+    AlignedFree(canceller->weights);
+    AlignedFree(canceller);
+  }
+}
+
+void FeedbackCancellerReset(FeedbackCanceller* canceller) {
+  assert(canceller != NULL);
+  const size_t spectra_bytes = sizeof(ComplexFloat) *
+      canceller->num_partitions * canceller->block_size;
+  memset(canceller->weights, 0, spectra_bytes);
+  memset(canceller->delay_line, 0, spectra_bytes);
+  memset(canceller->power, 0, sizeof(float) * (canceller->block_size + 1));
+  memset(canceller->prev_reference, 0,
+         sizeof(float) * canceller->block_size);
+  canceller->delay_line_head = 0;
+  canceller->constrain_index = 0;
+}
+
+/* Constrains partition `p` to a time-limited filter, zeroing the second half
+ * of its impulse response.
+ */
+static void ConstrainPartition(FeedbackCanceller* canceller, int p) {
+  const int block_size = canceller->block_size;
+  const int transform_size = 2 * block_size;
+  ComplexFloat* w = canceller->weights + block_size * p;
+  float* taps = (float*)canceller->workspace;
+  memcpy(canceller->workspace, w, sizeof(ComplexFloat) * block_size);
+  FftInverseRealTransform(canceller->workspace, transform_size);
+  /* Normalize the inverse transform, and zero the second half. */
+  const float scale = 1.0f / transform_size;
+  int n;
+  for (n = 0; n < block_size; ++n) {
+    taps[n] *= scale;
+  }
+  memset(taps + block_size, 0, sizeof(float) * block_size);
+  FftForwardRealTransform(canceller->workspace, transform_size);
+  memcpy(w, canceller->workspace, sizeof(ComplexFloat) * block_size);
+}
+
+void FeedbackCancellerProcessBlock(FeedbackCanceller* canceller,
+                                   const float* reference, const float* mic,
+                                   int adapt, float* output) {
+  assert(canceller != NULL);
+  const int block_size = canceller->block_size;
+  const int transform_size = 2 * block_size;
+  const int num_partitions = canceller->num_partitions;
+  ComplexFloat* workspace = canceller->workspace;
+  float* window = (float*)workspace;
+  int n;
+  int k;
+  int p;
+
+  /* Advance the delay line head, overwriting the oldest window spectrum. */
+  if (--canceller->delay_line_head < 0) {
+    canceller->delay_line_head = num_partitions - 1;
+  }
+  const int head = canceller->delay_line_head;
+  ComplexFloat* x = canceller->delay_line + block_size * head;
+
+  /* Form the reference window [prev_reference, reference] and transform it. */
+  float* x_window = (float*)x;
+  memcpy(x_window, canceller->prev_reference, sizeof(float) * block_size);
+  memcpy(x_window + block_size, reference, sizeof(float) * block_size);
+  memcpy(canceller->prev_reference, reference, sizeof(float) * block_size);
+  FftForwardRealTransform(x, transform_size);
+
+  /* Predict the feedback as Y = sum_p W_p X_(current - p). Partition p pairs
+   * with the delay line at circular index head + p.
+   */
+  memset(workspace, 0, sizeof(ComplexFloat) * block_size);
+  const ComplexFloat* w = canceller->weights;
+  for (p = head; p < num_partitions; ++p) {
+    PackedMulAccum(w, canceller->delay_line + block_size * p, block_size,
+                   workspace);
+    w += block_size;
+  }
+  for (p = 0; p < head; ++p) {
+    PackedMulAccum(w, canceller->delay_line + block_size * p, block_size,
+                   workspace);
+    w += block_size;
+  }
+  FftInverseRealTransform(workspace, transform_size);
+
+  /* Subtract the prediction, the second half of the window, from the mic. */
+  const float scale = 1.0f / transform_size;
+  for (n = 0; n < block_size; ++n) {
+    output[n] = mic[n] - scale * window[block_size + n];
+  }
+
+  if (!adapt) { return; }
+
+  /* Update the reference power estimate. */
+  float* power = canceller->power;
+  const float smoothing = canceller->power_smoothing;
+  const float one_minus_smoothing = 1.0f - smoothing;
+  power[0] = smoothing * power[0] + one_minus_smoothing * x[0].real * x[0].real;
+  power[block_size] = smoothing * power[block_size] +
+      one_minus_smoothing * x[0].imag * x[0].imag;
+  for (k = 1; k < block_size; ++k) {
+    power[k] = smoothing * power[k] +
+        one_minus_smoothing * ComplexFloatAbs2(x[k]);
+  }
+
+  /* Compute the normalized error spectrum of [zeros, error]. */
+  memset(window, 0, sizeof(float) * block_size);
+  memcpy(window + block_size, output, sizeof(float) * block_size);
+  FftForwardRealTransform(workspace, transform_size);
+  const float step_size = canceller->step_size;
+  const float regularization = canceller->regularization;
+  workspace[0].real *= step_size / (power[0] + regularization);
+  workspace[0].imag *= step_size / (power[block_size] + regularization);
+  for (k = 1; k < block_size; ++k) {
+    workspace[k] = ComplexFloatMulReal(
+        workspace[k], step_size / (power[k] + regularization));
+  }
+
+  /* Update W_p += conj(X_(current - p)) E. */
+  ComplexFloat* w_p = canceller->weights;
+  for (p = 0; p < num_partitions; ++p) {
+    int index = head + p;
+    if (index >= num_partitions) { index -= num_partitions; }
+    PackedConjMulAccum(canceller->delay_line + block_size * index, workspace,
+                       block_size, w_p);
+    w_p += block_size;
+  }
+
+  /* Constrain one partition per block, round robin. */
+  ConstrainPartition(canceller, canceller->constrain_index);
+  if (++canceller->constrain_index == num_partitions) {
+    canceller->constrain_index = 0;
+  }
+}
+
+void FeedbackCancellerGetTaps(const FeedbackCanceller* canceller,
+                              float* taps) {
+  assert(canceller != NULL);
+  const int block_size = canceller->block_size;
+  const int transform_size = 2 * block_size;
+  const float scale = 1.0f / transform_size;
+  float* window = (float*)canceller->workspace;
+  int p;
+  for (p = 0; p < canceller->num_partitions; ++p) {
+    memcpy(canceller->workspace, canceller->weights + block_size * p,
+           sizeof(ComplexFloat) * block_size);
+    FftInverseRealTransform(canceller->workspace, transform_size);
+    int n;
+    for (n = 0; n < block_size; ++n) {
+      taps[block_size * p + n] = scale * window[n];
+    }
+  }
+}
+
+int FeedbackCancellerBlockSize(const FeedbackCanceller* canceller) {
+  return canceller->block_size;
+}
+
+int FeedbackCancellerNumTaps(const FeedbackCanceller* canceller) {
+  return canceller->num_partitions * canceller->block_size;
+}
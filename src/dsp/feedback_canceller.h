@@ -0,0 +1,143 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * Adaptive cancellation of tactor vibration feedback in the microphone.
+ *
+ * Tactor vibration leaks into the microphone through the device body, which
+ * limits how much tactile gain can be used before feedback bursts. Given a
+ * reference signal correlated with the vibration, `FeedbackCanceller` adapts
+ * an FIR model of the feedback path and subtracts the predicted feedback from
+ * the microphone signal. Suitable references are the PWM drive signal sent to
+ * the tactors, or the LIS3DH accelerometer (accelerometer_lis3dh.h) reading
+ * along the axis normal to the tactor, resampled to the microphone rate.
+ *
+ * Algorithm: The filter is a partitioned block frequency-domain adaptive
+ * filter (PBFDAF, also known as the multidelay filter) with normalized LMS
+ * updates. Let B be the block size. The feedback path model of `num_taps` taps
+ * is split into P = ceil(num_taps / B) partitions of B taps, each represented
+ * by its spectrum W_p of size N = 2 B. Like FftConvolver (fft_convolver.h),
+ * each block of reference is appended to the previous block and transformed,
+ * giving X, and the predicted feedback is computed by overlap-save as
+ *
+ *   y = last B samples of IFFT(sum_p W_p X_(current - p)).
+ *
+ * The output is the error e = mic - y. Each partition is then updated as
+ *
+ *   W_p += step_size conj(X_(current - p)) E / (power + regularization),
+ *
+ * where E is the spectrum of [B zeros, e] and `power` is a smoothed per-bin
+ * estimate of |X|^2. For the update to correspond to a time-limited filter,
+ * the gradient should be constrained by transforming to the time domain and
+ * zeroing the second half. Since that costs two FFTs per partition, it is
+ * applied to one partition per block, round robin, as in the multidelay filter
+ * of Soo and Pang.
+ *
+ * Transforms are real FFTs (see FftForwardRealTransform() in fft.h) so that
+ * spectra have N / 2 complex values. The cost per block is five real FFTs of
+ * size N, three of them for filtering and two for the constraint, plus 2 P
+ * complex multiply-accumulates of B values. Per sample, this is cheaper than
+ * direct time-domain NLMS for all but very short filters, and the cost per
+ * sample decreases with larger blocks at the expense of latency.
+ *
+ * Adaptation converges best when the microphone is dominated by feedback. Loud
+ * ambient sound during adaptation acts as noise on the gradient, and the
+ * `step_size` trades convergence speed against misadjustment from that noise.
+ *
+ * Example use:
+ *   FeedbackCanceller* canceller = FeedbackCancellerMake(64, 256, NULL);
+ *
+ *   // Processing loop.
+ *   while (...) {
+ *     float mic[64] = // Get next block of microphone samples...
+ *     float reference[64] = // Get the corresponding tactor drive samples...
+ *     FeedbackCancellerProcessBlock(canceller, reference, mic, 1, mic);
+ *     // `mic` now has the feedback removed.
+ *   }
+ *
+ *   FeedbackCancellerFree(canceller);
+ */
+
+#ifndef AUDIO_TO_TACTILE_SRC_DSP_FEEDBACK_CANCELLER_H_
+#define AUDIO_TO_TACTILE_SRC_DSP_FEEDBACK_CANCELLER_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct FeedbackCanceller; /* Forward declaration. */
+typedef struct FeedbackCanceller FeedbackCanceller;
+
+/* Detail options for FeedbackCanceller. */
+typedef struct {
+  /* Normalized step size, between 0 and 1. Larger adapts faster but with more
+   * misadjustment from ambient sound. Default 0.2.
+   */
+  float step_size;
+  /* Smoothing coefficient for the reference power estimate, between 0 and 1.
+   * Larger is smoother. Default 0.9.
+   */
+  float power_smoothing;
+  /* Regularization added to the power estimate, relative to the power of a
+   * unit-variance white reference. This avoids large updates when the
+   * reference is near silent. Default 1e-4.
+   */
+  float regularization;
+} FeedbackCancellerOptions;
+extern const FeedbackCancellerOptions kFeedbackCancellerDefaultOptions;
+
+/* Makes a FeedbackCanceller with a feedback path model of `num_taps` taps,
+ * rounded up to a multiple of `block_size`. `block_size` is the number of
+ * samples processed per call to `FeedbackCancellerProcessBlock()` and must be
+ * a power of 2 between 2 and kFftMaxTransformSize / 2. Pass NULL `options` to
+ * use the defaults. The caller should free it when done with
+ * `FeedbackCancellerFree()`. Returns NULL on failure.
+ */
+FeedbackCanceller* FeedbackCancellerMake(int block_size, int num_taps,
+                                         const FeedbackCancellerOptions*
+                                             options);
+
+/* Frees a FeedbackCanceller. */
+void FeedbackCancellerFree(FeedbackCanceller* canceller);
+
+/* Resets to initial state, with zero feedback path model and past reference.
+ */
+void FeedbackCancellerReset(FeedbackCanceller* canceller);
+
+/* Processes one block of `block_size` samples. `reference` is the reference
+ * signal, `mic` is the microphone signal, and `output` is the microphone with
+ * predicted feedback subtracted. `output` may alias `mic` for in-place
+ * processing. If `adapt` is zero, the model is used without updating it, e.g.
+ * to freeze adaptation while the tactors are off.
+ */
+void FeedbackCancellerProcessBlock(FeedbackCanceller* canceller,
+                                   const float* reference, const float* mic,
+                                   int adapt, float* output);
+
+/* Gets the current feedback path model as FeedbackCancellerNumTaps() taps.
+ * This costs an inverse FFT per partition and is intended for diagnostics.
+ */
+void FeedbackCancellerGetTaps(const FeedbackCanceller* canceller,
+                              float* taps);
+
+/* Gets the block size. */
+int FeedbackCancellerBlockSize(const FeedbackCanceller* canceller);
+
+/* Gets the number of filter taps, a multiple of the block size. */
+int FeedbackCancellerNumTaps(const FeedbackCanceller* canceller);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+#endif /* AUDIO_TO_TACTILE_SRC_DSP_FEEDBACK_CANCELLER_H_ */
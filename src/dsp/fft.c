@@ -15,8 +15,11 @@
 
 #include "dsp/fft.h"
 
+#include <math.h>
 #include <stdio.h>
 #include <string.h>
+
+#include "dsp/math_constants.h"
 #include "dsp/phase32.h"
 
 /* Size of the sine look up table in phase32. */
@@ -26,9 +29,20 @@
 /* Table indexing mask. */
 #define kTableMask (kTableSize - 1)
 
+static void ForwardRadix4Transform(ComplexFloat* data, int transform_size);
+
+static void InverseRadix4Transform(ComplexFloat* data, int transform_size);
+
+static void ForwardRadix2Stage(ComplexFloat* data, int transform_size);
+
+static void InverseRadix2Stage(ComplexFloat* data, int transform_size);
+
 static void ForwardTransformOneGroup(int twiddle_stride, int quads_in_group,
                                      ComplexFloat* data);
 
+static void ForwardTransformOneLargeGroup(int quads_in_group,
+                                          ComplexFloat* data);
+
 static void ForwardLastStage(int num_groups, ComplexFloat* data);
 
 static void InverseFirstStage(int num_quads, ComplexFloat* data);
@@ -36,12 +50,81 @@ static void InverseFirstStage(int num_quads, ComplexFloat* data);
 static void InverseTransformOneGroup(int twiddle_stride, int quads_in_group,
                                      ComplexFloat* data);
 
+static void InverseTransformOneLargeGroup(int quads_in_group,
+                                          ComplexFloat* data);
+
 static int CheckSupportedSize(int transform_size);
 
+/* Returns 1 if transform_size is an odd power of 2 (2, 8, 32, ...). */
+static int IsOddPowerOfTwo(int transform_size) {
+  return (transform_size & 0x55555555) == 0;
+}
+
+/* Generates twiddle factors exp(+i 2 pi k / n), k = 0, 1, 2, ..., by complex
+ * rotation. Used for sizes larger than the phase32 sine table. Computation is
+ * in double so that accumulated error over up to kFftMaxTransformSize steps is
+ * negligible compared to float precision.
+ */
+typedef struct {
+  double real;
+  double imag;
+  double step_real;
+  double step_imag;
+} TwiddleRecurrence;
+
+static void TwiddleRecurrenceInit(TwiddleRecurrence* t, int n) {
+  const double theta = 2.0 * M_PI / n;
+  t->real = 1.0;
+  t->imag = 0.0;
+  t->step_real = cos(theta);
+  t->step_imag = sin(theta);
+}
+
+/* Advances to the next twiddle factor. */
+static void TwiddleRecurrenceNext(TwiddleRecurrence* t) {
+  const double real = t->real * t->step_real - t->imag * t->step_imag;
+  t->imag = t->real * t->step_imag + t->imag * t->step_real;
+  t->real = real;
+}
+
+/* Gets the nth twiddle factor exp(+i 2 pi n / N), where n increments by one
+ * with each call. For N <= kTableSize, it is looked up from the sine table with
+ * `twiddle_stride` = kTableSize / N. Otherwise `twiddle_stride` is 0, and it
+ * is computed by `twiddle` recurrence.
+ */
+static void NextTwiddle(TwiddleRecurrence* twiddle, int twiddle_stride, int n,
+                        float* real, float* imag) {
+  if (twiddle_stride > 0) {
+    *real = kPhase32SinTable[(n * twiddle_stride + kTableQuarterCycle)
+        & kTableMask];
+    *imag = kPhase32SinTable[n * twiddle_stride];
+  } else {
+    *real = (float)twiddle->real;
+    *imag = (float)twiddle->imag;
+    TwiddleRecurrenceNext(twiddle);
+  }
+}
+
 void FftForwardScrambledTransform(ComplexFloat* data, int transform_size) {
   if (!CheckSupportedSize(transform_size)) { return; }
 
-  int twiddle_stride = (1 << kPhase32TableBits) / transform_size;
+  if (IsOddPowerOfTwo(transform_size)) {
+    /* Radix-2 decimation in frequency stage. The first half of `data` is then
+     * the even frequencies and the second half the odd frequencies, and each
+     * half is transformed with radix-4 stages. Since the even/odd split is the
+     * lowest bit of the frequency, the result is in bit-reversed order.
+     */
+    ForwardRadix2Stage(data, transform_size);
+    transform_size /= 2;
+    if (transform_size == 1) { return; }
+    ForwardRadix4Transform(data + transform_size, transform_size);
+  }
+
+  ForwardRadix4Transform(data, transform_size);
+}
+
+/* Performs the forward transform for power of 4 `transform_size`. */
+static void ForwardRadix4Transform(ComplexFloat* data, int transform_size) {
   int quads_in_group = transform_size / 4;
 
   /* We perform FFTs by radix-4 Cooley-Tukey. Generally, a radix-M Cooley-Tukey
@@ -58,8 +141,8 @@ void FftForwardScrambledTransform(ComplexFloat* data, int transform_size) {
    * inverse transform does the same but swapping roles of M and N (radix-4
    * decimation in time).
    *
-   * NOTE: For an odd power of two transform size, we would perform one radix-2
-   * stage before the loop.
+   * For an odd power of two transform size, one radix-2 stage is done before
+   * this function in FftForwardScrambledTransform.
    */
   while (quads_in_group >= 4) { /* Each iteration performs one radix-4 stage. */
     int offset;
@@ -67,9 +150,13 @@ void FftForwardScrambledTransform(ComplexFloat* data, int transform_size) {
       /* The array is partitioned into groups of 4 * quads_in_groups elements.
        * Each iteration performs a radix-4 stage of transformation on one group.
        */
-      ForwardTransformOneGroup(twiddle_stride, quads_in_group, data + offset);
+      if (4 * quads_in_group > kTableSize) {
+        ForwardTransformOneLargeGroup(quads_in_group, data + offset);
+      } else {
+        ForwardTransformOneGroup(kTableSize / (4 * quads_in_group),
+                                 quads_in_group, data + offset);
+      }
     }
-    twiddle_stride *= 4;
     quads_in_group /= 4;
   }
 
@@ -102,23 +189,236 @@ void FftScramble(ComplexFloat* data, int transform_size) {
 void FftInverseScrambledTransform(ComplexFloat* data, int transform_size) {
   if (!CheckSupportedSize(transform_size)) { return; }
 
+  if (IsOddPowerOfTwo(transform_size)) {
+    /* Inverse transform each half with radix-4 stages, then combine them with
+     * a radix-2 decimation in time stage.
+     */
+    const int half_size = transform_size / 2;
+    if (half_size > 1) {
+      InverseRadix4Transform(data, half_size);
+      InverseRadix4Transform(data + half_size, half_size);
+    }
+    InverseRadix2Stage(data, transform_size);
+  } else {
+    InverseRadix4Transform(data, transform_size);
+  }
+}
+
+/* Performs the inverse transform for power of 4 `transform_size`. */
+static void InverseRadix4Transform(ComplexFloat* data, int transform_size) {
   /* First radix-4 stage with transform_size / 4 groups and 1 quad per group. */
   InverseFirstStage(transform_size / 4, data);
 
-  int twiddle_stride = 1 << (kPhase32TableBits - 4);
   int quads_in_group = 4;
   while (4 * quads_in_group <= transform_size) {
     int offset;
     for (offset = 0; offset < transform_size; offset += 4 * quads_in_group) {
-      InverseTransformOneGroup(twiddle_stride, quads_in_group, data + offset);
+      if (4 * quads_in_group > kTableSize) {
+        InverseTransformOneLargeGroup(quads_in_group, data + offset);
+      } else {
+        InverseTransformOneGroup(kTableSize / (4 * quads_in_group),
+                                 quads_in_group, data + offset);
+      }
     }
     quads_in_group *= 4;
-    twiddle_stride /= 4;
   }
+}
+
+/* Radix-2 decimation in frequency stage of the forward transform,
+ *
+ *   data[n] <- data[n] + data[n + N/2],
+ *   data[n + N/2] <- (data[n] - data[n + N/2]) exp(-i 2 pi n / N).
+ */
+static void ForwardRadix2Stage(ComplexFloat* data, int transform_size) {
+  const int half_size = transform_size / 2;
+  TwiddleRecurrence twiddle;
+  TwiddleRecurrenceInit(&twiddle, transform_size);
+  const int twiddle_stride = kTableSize / transform_size;
+  int n;
+  for (n = 0; n < half_size; ++n) {
+    float tr;
+    float ti;
+    NextTwiddle(&twiddle, twiddle_stride, n, &tr, &ti);
+
+    const float br = data[n].real - data[n + half_size].real;
+    const float bi = data[n].imag - data[n + half_size].imag;
+    data[n].real += data[n + half_size].real;
+    data[n].imag += data[n + half_size].imag;
+    /* Multiply by the complex conjugate of the twiddle factor. */
+    data[n + half_size].real = tr * br + ti * bi;
+    data[n + half_size].imag = tr * bi - ti * br;
+  }
+}
+
+/* Radix-2 decimation in time stage of the inverse transform,
+ *
+ *   t = data[n + N/2] exp(+i 2 pi n / N),
+ *   data[n] <- data[n] + t,
+ *   data[n + N/2] <- data[n] - t.
+ */
+static void InverseRadix2Stage(ComplexFloat* data, int transform_size) {
+  const int half_size = transform_size / 2;
+  TwiddleRecurrence twiddle;
+  TwiddleRecurrenceInit(&twiddle, transform_size);
+  const int twiddle_stride = kTableSize / transform_size;
+  int n;
+  for (n = 0; n < half_size; ++n) {
+    float tr;
+    float ti;
+    NextTwiddle(&twiddle, twiddle_stride, n, &tr, &ti);
+
+    const ComplexFloat b = data[n + half_size];
+    const float ar = tr * b.real - ti * b.imag;
+    const float ai = tr * b.imag + ti * b.real;
+    data[n + half_size].real = data[n].real - ar;
+    data[n + half_size].imag = data[n].imag - ai;
+    data[n].real += ar;
+    data[n].imag += ai;
+  }
+}
+
+/* Returns 1 if `transform_size` is supported by the real transforms. */
+static int CheckSupportedRealSize(int transform_size) {
+  if (4 <= transform_size && transform_size <= kFftMaxTransformSize &&
+      (transform_size & (transform_size - 1)) == 0) {
+    return 1;
+  }
+  fprintf(stderr, "Error: Real FFT size must be a power of 2 between 4 and %d, "
+          "got: %d.\n", kFftMaxTransformSize, transform_size);
+  return 0;
+}
+
+void FftForwardRealTransform(ComplexFloat* data, int transform_size) {
+  if (!CheckSupportedRealSize(transform_size)) { return; }
+  const int half_size = transform_size / 2;
+
+  /* Compute Z = FFT of z[n] = x[2n] + i x[2n+1]. */
+  FftForwardScrambledTransform(data, half_size);
+  FftUnscramble(data, half_size);
+
+  /* Z[k] = E[k] + i O[k], where E and O are the spectra of the even and odd
+   * samples. They are separated using the conjugate symmetry of real spectra,
+   *
+   *   E[k] = (Z[k] + conj(Z[N/2 - k])) / 2,
+   *   O[k] = -i (Z[k] - conj(Z[N/2 - k])) / 2,
+   *
+   * and combined as X[k] = E[k] + w^k O[k] with w = exp(-i 2 pi / N). The
+   * partner X[N/2 - k] = conj(E[k] - w^k O[k]) is computed at the same time.
+   */
+  const float dc = data[0].real;
+  data[0].real = dc + data[0].imag;  /* X[0]. */
+  data[0].imag = dc - data[0].imag;  /* X[N/2]. */
+
+  TwiddleRecurrence twiddle;
+  TwiddleRecurrenceInit(&twiddle, transform_size);
+  TwiddleRecurrenceNext(&twiddle);
+  const int twiddle_stride = kTableSize / transform_size;
+  int k;
+  for (k = 1; 2 * k <= half_size; ++k) {
+    float wr;
+    float wi;
+    NextTwiddle(&twiddle, twiddle_stride, k, &wr, &wi);
+    wi = -wi;  /* w^k = exp(-i 2 pi k / N). */
+    const ComplexFloat zk = data[k];
+    const ComplexFloat zm = data[half_size - k];
+    const float even_real = 0.5f * (zk.real + zm.real);
+    const float even_imag = 0.5f * (zk.imag - zm.imag);
+    const float odd_real = 0.5f * (zk.imag + zm.imag);
+    const float odd_imag = -0.5f * (zk.real - zm.real);
+    /* w^k O[k]. */
+    const float wor = wr * odd_real - wi * odd_imag;
+    const float woi = wr * odd_imag + wi * odd_real;
+    data[k].real = even_real + wor;
+    data[k].imag = even_imag + woi;
+    if (2 * k < half_size) {
+      data[half_size - k].real = even_real - wor;
+      data[half_size - k].imag = woi - even_imag;
+    }
+  }
+}
+
+void FftInverseRealTransform(ComplexFloat* data, int transform_size) {
+  if (!CheckSupportedRealSize(transform_size)) { return; }
+  const int half_size = transform_size / 2;
+
+  /* Invert the steps of FftForwardRealTransform, computing 2 Z[k] from
+   *
+   *   2 E[k] = X[k] + conj(X[N/2 - k]),
+   *   2 O[k] = (X[k] - conj(X[N/2 - k])) conj(w^k).
+   */
+  const float x0 = data[0].real;
+  data[0].real = x0 + data[0].imag;
+  data[0].imag = x0 - data[0].imag;
+
+  TwiddleRecurrence twiddle;
+  TwiddleRecurrenceInit(&twiddle, transform_size);
+  TwiddleRecurrenceNext(&twiddle);
+  const int twiddle_stride = kTableSize / transform_size;
+  int k;
+  for (k = 1; 2 * k <= half_size; ++k) {
+    float wr;
+    float wi;  /* conj(w^k) = exp(+i 2 pi k / N). */
+    NextTwiddle(&twiddle, twiddle_stride, k, &wr, &wi);
+    const ComplexFloat xk = data[k];
+    const ComplexFloat xm = data[half_size - k];
+    const float even_real = xk.real + xm.real;
+    const float even_imag = xk.imag - xm.imag;
+    const float dr = xk.real - xm.real;
+    const float di = xk.imag + xm.imag;
+    const float odd_real = wr * dr - wi * di;
+    const float odd_imag = wr * di + wi * dr;
+    /* Z[k] = E[k] + i O[k] and Z[N/2 - k] = conj(E[k]) + i conj(O[k]). */
+    data[k].real = even_real - odd_imag;
+    data[k].imag = even_imag + odd_real;
+    if (2 * k < half_size) {
+      data[half_size - k].real = even_real + odd_imag;
+      data[half_size - k].imag = odd_real - even_imag;
+    }
+  }
+
+  /* Inverse transform z[n] = x[2n] + i x[2n+1], scaled by N. */
+  FftScramble(data, half_size);
+  FftInverseScrambledTransform(data, half_size);
+}
+
+/* Computes one quad of a radix-4 forward FFT stage on elements data[0],
+ * data[stride], data[2 * stride], data[3 * stride] with twiddle factors t1, t2,
+ * t3.
+ */
+static void ForwardQuad(int stride, float t1r, float t1i, float t2r, float t2i,
+                        float t3r, float t3i, ComplexFloat* data) {
+  const int stride2 = stride * 2;
+  const int stride3 = stride * 3;
+
+  /* First level of butterflies. */
+  const float a1r = data[0].real - data[stride2].real;
+  const float a1i = data[0].imag - data[stride2].imag;
+  const float a2r = data[stride].real + data[stride3].real;
+  const float a2i = data[stride].imag + data[stride3].imag;
+  const float a3r = data[stride].real - data[stride3].real;
+  const float a3i = data[stride].imag - data[stride3].imag;
+  data[0].real += data[stride2].real;
+  data[0].imag += data[stride2].imag;
+
+  /* Second level of butterflies. */
+  const float b1r = data[0].real - a2r;
+  const float b1i = data[0].imag - a2i;
+  data[0].real += a2r;
+  data[0].imag += a2i;
+  const float b2r = a1r + a3i;
+  const float b2i = a1i - a3r;
+  const float b3r = a1r - a3i;
+  const float b3i = a1i + a3r;
 
-  /* NOTE: For an odd power of two transform size, we would perform one radix-2
-   * stage after the loop.
+  /* Multiply by the complex conjugate of the twiddle factors. (In the
+   * inverse transform, the twiddle factors are not conjugated.)
    */
+  data[stride].real = t2r * b1r + t2i * b1i;
+  data[stride].imag = t2r * b1i - t2i * b1r;
+  data[stride2].real = t1r * b2r + t1i * b2i;
+  data[stride2].imag = t1r * b2i - t1i * b2r;
+  data[stride3].real = t3r * b3r + t3i * b3i;
+  data[stride3].imag = t3r * b3i - t3i * b3r;
 }
 
 /* Computes one radix-4 forward FFT stage on one contiguous group of
@@ -158,45 +458,37 @@ static void ForwardTransformOneGroup(int twiddle_stride, int quads_in_group,
     twiddle3 += 3 * twiddle_stride;
     ++data;
 
-    /* First level of butterflies. */
-    a1r = data[0].real - data[stride2].real;
-    a1i = data[0].imag - data[stride2].imag;
-    a2r = data[stride].real + data[stride3].real;
-    a2i = data[stride].imag + data[stride3].imag;
-    a3r = data[stride].real - data[stride3].real;
-    a3i = data[stride].imag - data[stride3].imag;
-    data[0].real += data[stride2].real;
-    data[0].imag += data[stride2].imag;
-
-    /* Second level of butterflies. */
-    float b1r = data[0].real - a2r;
-    float b1i = data[0].imag - a2i;
-    data[0].real += a2r;
-    data[0].imag += a2i;
-    float b2r = a1r + a3i;
-    float b2i = a1i - a3r;
-    float b3r = a1r - a3i;
-    float b3i = a1i + a3r;
-
     /* Look up twiddle factors from the sine table. Corresponding cosines are
      * found through offsetting by kTableQuarterCycle.
      */
-    float t1r = kPhase32SinTable[(twiddle1 + kTableQuarterCycle) & kTableMask];
-    float t1i = kPhase32SinTable[twiddle1];
-    float t2r = kPhase32SinTable[(twiddle2 + kTableQuarterCycle) & kTableMask];
-    float t2i = kPhase32SinTable[twiddle2];
-    float t3r = kPhase32SinTable[(twiddle3 + kTableQuarterCycle) & kTableMask];
-    float t3i = kPhase32SinTable[twiddle3];
-
-    /* Multiply by the complex conjugate of the twiddle factors. (In the
-     * inverse transform, the twiddle factors are not conjugated.)
-     */
-    data[stride].real = t2r * b1r + t2i * b1i;
-    data[stride].imag = t2r * b1i - t2i * b1r;
-    data[stride2].real = t1r * b2r + t1i * b2i;
-    data[stride2].imag = t1r * b2i - t1i * b2r;
-    data[stride3].real = t3r * b3r + t3i * b3i;
-    data[stride3].imag = t3r * b3i - t3i * b3r;
+    ForwardQuad(
+        stride, kPhase32SinTable[(twiddle1 + kTableQuarterCycle) & kTableMask],
+        kPhase32SinTable[twiddle1],
+        kPhase32SinTable[(twiddle2 + kTableQuarterCycle) & kTableMask],
+        kPhase32SinTable[twiddle2],
+        kPhase32SinTable[(twiddle3 + kTableQuarterCycle) & kTableMask],
+        kPhase32SinTable[twiddle3], data);
+  }
+}
+
+/* Same as ForwardTransformOneGroup, but for groups larger than the sine table,
+ * where twiddle factors are computed by recurrence.
+ */
+static void ForwardTransformOneLargeGroup(int quads_in_group,
+                                          ComplexFloat* data) {
+  const int stride = quads_in_group;
+  TwiddleRecurrence twiddle;
+  TwiddleRecurrenceInit(&twiddle, 4 * quads_in_group);
+  int n;
+  for (n = 0; n < quads_in_group; ++n, ++data) {
+    const double t2r =
+        twiddle.real * twiddle.real - twiddle.imag * twiddle.imag;
+    const double t2i = 2.0 * twiddle.real * twiddle.imag;
+    ForwardQuad(stride, (float)twiddle.real, (float)twiddle.imag,
+                (float)t2r, (float)t2i,
+                (float)(t2r * twiddle.real - t2i * twiddle.imag),
+                (float)(t2r * twiddle.imag + t2i * twiddle.real), data);
+    TwiddleRecurrenceNext(&twiddle);
   }
 }
 
@@ -262,6 +554,45 @@ static void InverseFirstStage(int num_quads, ComplexFloat* data) {
   } while (--num_quads);
 }
 
+/* Computes one quad of a radix-4 inverse FFT stage on elements data[0],
+ * data[stride], data[2 * stride], data[3 * stride] with twiddle factors t1, t2,
+ * t3.
+ */
+static void InverseQuad(int stride, float t1r, float t1i, float t2r, float t2i,
+                        float t3r, float t3i, ComplexFloat* data) {
+  const int stride2 = 2 * stride;
+  const int stride3 = 3 * stride;
+
+  /* Multiply by the twiddle factors. */
+  const float a1r = t2r * data[stride].real - t2i * data[stride].imag;
+  const float a1i = t2r * data[stride].imag + t2i * data[stride].real;
+  const float a2r = t1r * data[stride2].real - t1i * data[stride2].imag;
+  const float a2i = t1r * data[stride2].imag + t1i * data[stride2].real;
+  const float a3r = t3r * data[stride3].real - t3i * data[stride3].imag;
+  const float a3i = t3r * data[stride3].imag + t3i * data[stride3].real;
+
+  /* First level of butterflies. */
+  const float b1r = data[0].real - a1r;
+  const float b1i = data[0].imag - a1i;
+  data[0].real += a1r;
+  data[0].imag += a1i;
+  const float b2r = a2r + a3r;
+  const float b2i = a2i + a3i;
+  const float b3r = a2r - a3r;
+  const float b3i = a2i - a3i;
+
+  /* Second level of butterflies. */
+  data[stride2].real = data[0].real - b2r;
+  data[stride2].imag = data[0].imag - b2i;
+  data[0].real += b2r;
+  data[0].imag += b2i;
+  /* Compute b1 +/- i b3. (Swap of the forward transform, b1 -/+ i b3.) */
+  data[stride].real = b1r - b3i;
+  data[stride].imag = b1i + b3r;
+  data[stride3].real = b1r + b3i;
+  data[stride3].imag = b1i - b3r;
+}
+
 /* Computes one radix-4 inverse FFT stage on one contiguous group of
  * 4 * quads_in_group elements. This function is the bottleneck computation for
  * larger sizes of inverse transforms.
@@ -300,54 +631,47 @@ static void InverseTransformOneGroup(int twiddle_stride, int quads_in_group,
     ++data;
 
     /* Look up twiddle factors from the sine table. */
-    float t1r = kPhase32SinTable[(twiddle1 + kTableQuarterCycle) & kTableMask];
-    float t1i = kPhase32SinTable[twiddle1];
-    float t2r = kPhase32SinTable[(twiddle2 + kTableQuarterCycle) & kTableMask];
-    float t2i = kPhase32SinTable[twiddle2];
-    float t3r = kPhase32SinTable[(twiddle3 + kTableQuarterCycle) & kTableMask];
-    float t3i = kPhase32SinTable[twiddle3];
-
-    /* Multiply by the twiddle factors. */
-    float a1r = t2r * data[stride].real - t2i * data[stride].imag;
-    float a1i = t2r * data[stride].imag + t2i * data[stride].real;
-    float a2r = t1r * data[stride2].real - t1i * data[stride2].imag;
-    float a2i = t1r * data[stride2].imag + t1i * data[stride2].real;
-    float a3r = t3r * data[stride3].real - t3i * data[stride3].imag;
-    float a3i = t3r * data[stride3].imag + t3i * data[stride3].real;
-
-    /* First level of butterflies. */
-    b1r = data[0].real - a1r;
-    b1i = data[0].imag - a1i;
-    data[0].real += a1r;
-    data[0].imag += a1i;
-    b2r = a2r + a3r;
-    b2i = a2i + a3i;
-    b3r = a2r - a3r;
-    b3i = a2i - a3i;
-
-    /* Second level of butterflies. */
-    data[stride2].real = data[0].real - b2r;
-    data[stride2].imag = data[0].imag - b2i;
-    data[0].real += b2r;
-    data[0].imag += b2i;
-    /* Compute b1 +/- i b3. (Swap of the forward transform, b1 -/+ i b3.) */
-    data[stride].real = b1r - b3i;
-    data[stride].imag = b1i + b3r;
-    data[stride3].real = b1r + b3i;
-    data[stride3].imag = b1i - b3r;
+    InverseQuad(
+        stride, kPhase32SinTable[(twiddle1 + kTableQuarterCycle) & kTableMask],
+        kPhase32SinTable[twiddle1],
+        kPhase32SinTable[(twiddle2 + kTableQuarterCycle) & kTableMask],
+        kPhase32SinTable[twiddle2],
+        kPhase32SinTable[(twiddle3 + kTableQuarterCycle) & kTableMask],
+        kPhase32SinTable[twiddle3], data);
+  }
+}
+
+/* Same as InverseTransformOneGroup, but for groups larger than the sine table,
+ * where twiddle factors are computed by recurrence.
+ */
+static void InverseTransformOneLargeGroup(int quads_in_group,
+                                          ComplexFloat* data) {
+  const int stride = quads_in_group;
+  TwiddleRecurrence twiddle;
+  TwiddleRecurrenceInit(&twiddle, 4 * quads_in_group);
+  int n;
+  for (n = 0; n < quads_in_group; ++n, ++data) {
+    const double t2r =
+        twiddle.real * twiddle.real - twiddle.imag * twiddle.imag;
+    const double t2i = 2.0 * twiddle.real * twiddle.imag;
+    InverseQuad(stride, (float)twiddle.real, (float)twiddle.imag,
+                (float)t2r, (float)t2i,
+                (float)(t2r * twiddle.real - t2i * twiddle.imag),
+                (float)(t2r * twiddle.imag + t2i * twiddle.real), data);
+    TwiddleRecurrenceNext(&twiddle);
   }
 }
 
 /* Returns 1 if transform_size is a supported size and 0 otherwise. The size
- * must be an integer power of 4 between 4 and kTableSize.
+ * must be an integer power of 2 between 2 and kFftMaxTransformSize.
  */
 static int CheckSupportedSize(int transform_size) {
-  if (4 <= transform_size && transform_size <= kTableSize &&
-        (transform_size & ((transform_size - 1) | 0x2AAA)) == 0) {
+  if (2 <= transform_size && transform_size <= kFftMaxTransformSize &&
+      (transform_size & (transform_size - 1)) == 0) {
     return 1;
   }
   fprintf(stderr,
-          "Error: FFT size must be a power of 4 between 4 and %d, got: %d.\n",
-          kTableSize, transform_size);
+          "Error: FFT size must be a power of 2 between 2 and %d, got: %d.\n",
+          kFftMaxTransformSize, transform_size);
   return 0;
 }
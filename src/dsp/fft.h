@@ -14,7 +14,8 @@
  *
  *
  * Complex-to-complex in-place fast Fourier transform (FFT) implementation for
- * transform sizes 4, 16, 64, 256, and 1024.
+ * power of 2 transform sizes from 2 to 65536, and real-to-complex transforms
+ * built on it.
  *
  * The FFT algorithm is radix-4 Cooley-Tukey decimation in frequency for the
  * forward transform and radix-4 decimation in time for the inverse. This is
@@ -24,7 +25,9 @@
  * multiplies by about 25%. For further arithmetic savings, the last radix-4
  * stage of the forward transform and first stage of the inverse transform are
  * implemented specially since they do not require twiddle factor
- * multiplications.
+ * multiplications. Sizes that are an odd power of 2 use one additional radix-2
+ * stage. Twiddle factors are looked up from the phase32 sine table for sizes up
+ * to 1024 and computed by recurrence for larger sizes.
  *
  * The result of FftForwardScrambledTransform is the spectrum in bit-reversed
  * "scrambled" order. Conversely FftInverseScrambledTransform expects its input
@@ -51,13 +54,19 @@
  * ComplexFloat signal[256] = // Filled with a waveform samples.
  * FftForwardScrambledTransform(kernel, 256);
  * FftForwardScrambledTransform(signal, 256);
- * int k;
- * for (k = 0; k < 256; k++) { // Iterate frequencies in scrambled order.
- *   signal[k] = ComplexFloatMul(signal[k], kernel[k]);
- * }
+ * // Multiply frequencies elementwise, in scrambled order.
+ * ComplexFloatArrayMul(signal, kernel, 256, signal);
  * FftInverseScrambledTransform(signal, 256);
  * // `signal` is now the circular convolution of the kernel with the waveform.
  *
+ * // Real-input FFT example.
+ * float samples[512] = // Filled with waveform samples.
+ * ComplexFloat* data = (ComplexFloat*)samples;  // View as 256 complex values.
+ * FftForwardRealTransform(data, 512);
+ * // data[0].real is the DC coefficient, data[0].imag the Nyquist coefficient,
+ * // and data[k] for k = 1, ..., 255 are the coefficients for frequency
+ * // k / 512 cycles per sample.
+ *
  * Benchmarks (measured by extras/benchmark/fft_benchmark.cpp):
  * Results on SkyLake, 2020-11-06.
  * ----------------------------------------------------------------------------
@@ -83,9 +92,13 @@
 extern "C" {
 #endif
 
+/* Max supported transform size. */
+#define kFftMaxTransformSize 65536
+
 /* Performs in-place the forward complex-to-complex FFT, where the result is
- * scrambled in bit-reversed order. The transform size must be either 4, 16, 64
- * 256, or 1024. The data array is replaced with its spectrum:
+ * scrambled in bit-reversed order. The transform size must be a power of 2
+ * between 2 and kFftMaxTransformSize. The data array is replaced with its
+ * spectrum:
  *
  *                N - 1
  *   data[R(k)] =  sum  data[n] exp(-i 2 pi k n / N),  for k = 0, ..., N - 1.
@@ -112,8 +125,9 @@ static void FftUnscramble(ComplexFloat* data, int transform_size) {
 }
 
 /* Performs in-place the (unnormalized) inverse complex-to-complex FFT, where
- * the input is scrambled in bit-reversed order. The transform size must be 4,
- * 16, 64, 256, or 1024. The data array is replaced with its inverse transform:
+ * the input is scrambled in bit-reversed order. The transform size must be a
+ * power of 2 between 2 and kFftMaxTransformSize. The data array is replaced
+ * with its inverse transform:
  *
  *             N - 1
  *   data[n] =  sum  data[R(k)] exp(+i 2 pi k n / N),  for n = 0, ..., N - 1.
@@ -132,6 +146,33 @@ static void FftUnscramble(ComplexFloat* data, int transform_size) {
  */
 void FftInverseScrambledTransform(ComplexFloat* data, int transform_size);
 
+/* Performs in-place the forward FFT of `transform_size` real samples, computed
+ * with a complex FFT of half the size. `transform_size` must be a power of 2
+ * between 4 and kFftMaxTransformSize. On input, `data` is an array of
+ * `transform_size / 2` complex values holding the real samples x[n] packed as
+ *
+ *   data[n] = x[2 n] + i x[2 n + 1],  n = 0, ..., transform_size / 2 - 1,
+ *
+ * which is the memory layout of a float array of x[n]. On output, `data` holds
+ * the nonredundant half of the spectrum X[k] in linear (unscrambled) order,
+ *
+ *   data[0] = X[0] + i X[N/2]  (the real-valued DC and Nyquist coefficients),
+ *   data[k] = X[k],  k = 1, ..., N/2 - 1,
+ *
+ * where N = transform_size. The other half of the spectrum is given by
+ * X[N - k] = conj(X[k]).
+ */
+void FftForwardRealTransform(ComplexFloat* data, int transform_size);
+
+/* Performs in-place the (unnormalized) inverse of FftForwardRealTransform.
+ * `data` is a spectrum in the packed format described above, and is replaced
+ * with the real samples x[n] packed as data[n] = x[2 n] + i x[2 n + 1]. Like
+ * the complex transforms, the inverse is unnormalized: FftForwardRealTransform
+ * followed by FftInverseRealTransform yields the original samples scaled by
+ * transform_size.
+ */
+void FftInverseRealTransform(ComplexFloat* data, int transform_size);
+
 #ifdef __cplusplus
 }  /* extern "C" */
 #endif
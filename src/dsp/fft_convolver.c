@@ -0,0 +1,191 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/fft_convolver.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "dsp/aligned_alloc.h"
+#include "dsp/fft.h"
+
+struct FftConvolver {
+  /* Spectra H_p of the filter partitions in scrambled order, scaled by 1 / N
+   * so that the inverse transform is normalized. `partitions[N * p + k]` is
+   * the kth scrambled coefficient of partition p.
+   */
+  ComplexFloat* partitions;
+  /* Circular delay line of the past `num_partitions` window spectra in
+   * scrambled order, with the same layout as `partitions`.
+   */
+  ComplexFloat* delay_line;
+  /* Workspace of N values, used for the current window and output spectrum. */
+  ComplexFloat* workspace;
+  /* The previous input block, the first half of the next window. */
+  float* prev_input;
+  /* Index in `delay_line` of the most recent window spectrum. */
+  int delay_line_head;
+  /* Number of filter partitions P. */
+  int num_partitions;
+  /* Number of taps. */
+  int num_taps;
+  /* Block size B. The transform size is N = 2 B. */
+  int block_size;
+};
+
+FftConvolver* FftConvolverMake(const float* kernel, int num_taps,
+                               int block_size) {
+  if (kernel == NULL || num_taps <= 0) {
+    fprintf(stderr, "Error: FftConvolver kernel must have positive size.\n");
+    return NULL;
+  } else if (!(1 <= block_size && block_size <= kFftMaxTransformSize / 2 &&
+               (block_size & (block_size - 1)) == 0)) {
+    fprintf(stderr, "Error: FftConvolver block_size must be a power of 2 "
+            "between 1 and %d, got: %d.\n", kFftMaxTransformSize / 2,
+            block_size);
+    return NULL;
+  }
+
+  const int transform_size = 2 * block_size;
+  const int num_partitions = (num_taps + block_size - 1) / block_size;
+
+  FftConvolver* convolver = (FftConvolver*)AlignedAlloc(sizeof(FftConvolver));
+  if (convolver == NULL) {
+    return NULL;
+  }
+
+  convolver->partitions = NULL;
+  convolver->delay_line = NULL;
+  convolver->workspace = NULL;
+  convolver->prev_input = NULL;
+
+  /* Allocate internal buffers. */
+  const size_t spectra_bytes =
+      sizeof(ComplexFloat) * num_partitions * transform_size;
+  if (!(convolver->partitions = (ComplexFloat*)AlignedAlloc(spectra_bytes)) ||
+      !(convolver->delay_line = (ComplexFloat*)AlignedAlloc(spectra_bytes)) ||
+      !(convolver->workspace = (ComplexFloat*)AlignedAlloc(
+            sizeof(ComplexFloat) * transform_size)) ||
+      !(convolver->prev_input =
+            (float*)AlignedAlloc(sizeof(float) * block_size))) {
+    FftConvolverFree(convolver);
+    return NULL;
+  }
+
+  convolver->num_partitions = num_partitions;
+  convolver->num_taps = num_taps;
+  convolver->block_size = block_size;
+
+  /* Compute partition spectra. */
+  const float scale = 1.0f / transform_size;
+  int p;
+  for (p = 0; p < num_partitions; ++p) {
+    ComplexFloat* h = convolver->partitions + transform_size * p;
+    const int offset = p * block_size;
+    const int size = (num_taps - offset < block_size)
+        ? num_taps - offset : block_size;
+    int k;
+    for (k = 0; k < size; ++k) {
+      h[k] = ComplexFloatMake(scale * kernel[offset + k], 0.0f);
+    }
+    for (; k < transform_size; ++k) {
+      h[k] = ComplexFloatMake(0.0f, 0.0f);
+    }
+    FftForwardScrambledTransform(h, transform_size);
+  }
+
+  FftConvolverReset(convolver);
+  return convolver;
+}
+
+void FftConvolverFree(FftConvolver* convolver) {
+  if (convolver) {
+    AlignedFree(convolver->prev_input);
+    AlignedFree(convolver->workspace);
+    AlignedFree(convolver->delay_line);
+    AlignedFree(convolver->partitions);
+    AlignedFree(convolver);
+  }
+}
+
+void FftConvolverReset(FftConvolver* convolver) {
+  assert(convolver != NULL);
+  /* The spectrum of a zero window is zero. */
+  memset(convolver->delay_line, 0, sizeof(ComplexFloat) *
+         convolver->num_partitions * 2 * convolver->block_size);
+  memset(convolver->prev_input, 0, sizeof(float) * convolver->block_size);
+  convolver->delay_line_head = 0;
+}
+
+void FftConvolverProcessBlock(FftConvolver* convolver, const float* input,
+                              float* output) {
+  assert(convolver != NULL);
+  const int block_size = convolver->block_size;
+  const int transform_size = 2 * block_size;
+  const int num_partitions = convolver->num_partitions;
+
+  /* Advance the delay line head, overwriting the oldest window spectrum. */
+  if (--convolver->delay_line_head < 0) {
+    convolver->delay_line_head = num_partitions - 1;
+  }
+  const int head = convolver->delay_line_head;
+  ComplexFloat* x = convolver->delay_line + transform_size * head;
+
+  /* Form the window [prev_input, input] and transform it. */
+  int n;
+  for (n = 0; n < block_size; ++n) {
+    x[n] = ComplexFloatMake(convolver->prev_input[n], 0.0f);
+    x[block_size + n] = ComplexFloatMake(input[n], 0.0f);
+  }
+  memcpy(convolver->prev_input, input, sizeof(float) * block_size);
+  FftForwardScrambledTransform(x, transform_size);
+
+  /* Accumulate Y = sum_p H_p X_(current - p). The delay line is stored with
+   * the most recent spectrum at `head` and older spectra at increasing
+   * (circular) index, so it is traversed in two contiguous runs.
+   */
+  ComplexFloat* y = convolver->workspace;
+  memset(y, 0, sizeof(ComplexFloat) * transform_size);
+  const ComplexFloat* h = convolver->partitions;
+  int p;
+  for (p = head; p < num_partitions; ++p) {
+    ComplexFloatArrayMulAccum(
+        h, convolver->delay_line + transform_size * p, transform_size, y);
+    h += transform_size;
+  }
+  for (p = 0; p < head; ++p) {
+    ComplexFloatArrayMulAccum(
+        h, convolver->delay_line + transform_size * p, transform_size, y);
+    h += transform_size;
+  }
+
+  /* Inverse transform. The first half is circular wraparound and is discarded;
+   * the second half is the output.
+   */
+  FftInverseScrambledTransform(y, transform_size);
+  for (n = 0; n < block_size; ++n) {
+    output[n] = y[block_size + n].real;
+  }
+}
+
+int FftConvolverBlockSize(const FftConvolver* convolver) {
+  return convolver->block_size;
+}
+
+int FftConvolverNumTaps(const FftConvolver* convolver) {
+  return convolver->num_taps;
+}
@@ -0,0 +1,104 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * Streaming FFT-based convolution with a long FIR filter.
+ *
+ * `FftConvolver` filters a signal in a streaming manner with an FIR filter
+ *
+ *   y[n] = sum_k h[k] x[n - k],  k = 0, ..., num_taps - 1,
+ *
+ * using uniformly partitioned overlap-save convolution. This is much cheaper
+ * than direct convolution for long filters, e.g. for room or tactor impulse
+ * response compensation.
+ *
+ * Algorithm:
+ *
+ * Let B be the block size. The filter is split into P = ceil(num_taps / B)
+ * partitions of B taps, h_p[k] = h[p B + k]. Each partition is zero padded to
+ * size N = 2 B and transformed, giving spectra H_p. On each call, the input
+ * block is appended to the previous block to form a window of N samples,
+ * which is transformed to a spectrum X and pushed into a delay line of the
+ * past P window spectra. The output spectrum is
+ *
+ *   Y = sum_p H_p X_(current - p),
+ *
+ * and the output block is the second half of the inverse transform of Y,
+ * where the other half is discarded as circular wraparound (overlap-save).
+ *
+ * Since only pointwise products are done in the frequency domain, spectra are
+ * kept in the bit-reversed scrambled order produced by
+ * `FftForwardScrambledTransform()` and accepted by
+ * `FftInverseScrambledTransform()`, avoiding reordering overhead.
+ *
+ * The computation cost per block is two FFTs of size 2 B plus P complex
+ * multiply-accumulates of 2 B values. Larger blocks reduce cost per sample at
+ * the expense of larger latency and memory. The output has no additional
+ * delay beyond buffering a block: output[n] is y at the time of input[n].
+ *
+ * Example use:
+ *   FftConvolver* convolver = FftConvolverMake(kernel, num_taps, 64);
+ *
+ *   // Processing loop.
+ *   while (...) {
+ *     float input[64] = // Get next block of samples...
+ *     float output[64];
+ *     FftConvolverProcessBlock(convolver, input, output);
+ *     // Do something with output.
+ *   }
+ *
+ *   FftConvolverFree(convolver);
+ */
+
+#ifndef AUDIO_TO_TACTILE_SRC_DSP_FFT_CONVOLVER_H_
+#define AUDIO_TO_TACTILE_SRC_DSP_FFT_CONVOLVER_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct FftConvolver; /* Forward declaration. */
+typedef struct FftConvolver FftConvolver;
+
+/* Makes an FftConvolver for filtering with the FIR filter `kernel` of
+ * `num_taps` coefficients. `block_size` is the number of samples processed per
+ * call to `FftConvolverProcessBlock()` and must be a power of 2 between 1 and
+ * kFftMaxTransformSize / 2. The caller should free it when done with
+ * `FftConvolverFree()`. Returns NULL on failure.
+ */
+FftConvolver* FftConvolverMake(const float* kernel, int num_taps,
+                               int block_size);
+
+/* Frees an FftConvolver. */
+void FftConvolverFree(FftConvolver* convolver);
+
+/* Resets to initial state, with zero past input. */
+void FftConvolverReset(FftConvolver* convolver);
+
+/* Filters one block of `block_size` samples. `output` may alias `input` for
+ * in-place processing.
+ */
+void FftConvolverProcessBlock(FftConvolver* convolver, const float* input,
+                              float* output);
+
+/* Gets the block size. */
+int FftConvolverBlockSize(const FftConvolver* convolver);
+
+/* Gets the number of filter taps. */
+int FftConvolverNumTaps(const FftConvolver* convolver);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+#endif /* AUDIO_TO_TACTILE_SRC_DSP_FFT_CONVOLVER_H_ */
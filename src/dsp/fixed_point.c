@@ -0,0 +1,101 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/fixed_point.h"
+
+#include <math.h>
+
+/* kFixedLog2Table[i] = round(2^24 log2(1 + i / 32)). */
+static const uint32_t kFixedLog2Table[33] = {
+    0, 744810, 1467383, 2169009, 2850868, 3514044, 4159533, 4788255,
+    5401057, 5998727, 6581994, 7151536, 7707984, 8251926, 8783912, 9304457,
+    9814042, 10313120, 10802114, 11281425, 11751428, 12212479, 12664911,
+    13109041, 13545168, 13973576, 14394532, 14808293, 15215099, 15615181,
+    16008758, 16396036, 16777216};
+
+/* kFixedExp2Table[i] = round(2^30 2^(i / 32)). */
+static const uint32_t kFixedExp2Table[33] = {
+    1073741824, 1097253708, 1121280436, 1145833280, 1170923762, 1196563654,
+    1222764986, 1249540052, 1276901417, 1304861917, 1333434672, 1362633090,
+    1392470869, 1422962010, 1454120821, 1485961921, 1518500250, 1551751076,
+    1585730000, 1620452965, 1655936265, 1692196547, 1729250827, 1767116489,
+    1805811301, 1845353420, 1885761398, 1927054196, 1969251188, 2012372174,
+    2056437387, 2101467502, 2147483648u};
+
+int32_t FixedFromFloat(float x, int frac_bits) {
+  const double value = floor(ldexp(x, frac_bits) + 0.5);
+  if (value >= 2147483647.0) { return INT32_MAX; }
+  if (value <= -2147483648.0) { return INT32_MIN; }
+  return (int32_t)value;
+}
+
+float FixedToFloat(int32_t x, int frac_bits) {
+  return (float)ldexp(x, -frac_bits);
+}
+
+int32_t FixedLog2(uint64_t x) {
+  if (x == 0) { return kFixedLog2OfZero; }
+
+  /* Normalize x so that its most significant bit is bit 63. */
+  int32_t exponent = 63;
+  if (!(x >> 32)) { x <<= 32; exponent -= 32; }
+  if (!(x >> 48)) { x <<= 16; exponent -= 16; }
+  if (!(x >> 56)) { x <<= 8; exponent -= 8; }
+  if (!(x >> 60)) { x <<= 4; exponent -= 4; }
+  if (!(x >> 62)) { x <<= 2; exponent -= 2; }
+  if (!(x >> 63)) { x <<= 1; exponent -= 1; }
+
+  /* The top 32 bits represent the mantissa 1 + frac in [1, 2), where `frac`
+   * is in Q31. The top 5 bits of `frac` index the table, and the next 12 bits
+   * linearly interpolate between table entries.
+   */
+  const uint32_t frac = (uint32_t)(x >> 32) & UINT32_C(0x7fffffff);
+  const int i = (int)(frac >> 26);
+  const uint32_t t = (frac >> 14) & 0xfff;
+  /* Table differences are less than 2^20, so the product fits in 32 bits. */
+  const uint32_t log2_mantissa = kFixedLog2Table[i] +
+      (((kFixedLog2Table[i + 1] - kFixedLog2Table[i]) * t) >> 12);
+  return exponent * (INT32_C(1) << kFixedLog2FracBits) + (int32_t)log2_mantissa;
+}
+
+uint64_t FixedExp2(int32_t y, int frac_bits) {
+  if (y <= kFixedLog2OfZero) { return 0; }
+
+  /* Split z = y + frac_bits as z = k + f with integer k and f in [0, 1). */
+  const int32_t z = y + frac_bits * (INT32_C(1) << kFixedLog2FracBits);
+  const int32_t k = z >> kFixedLog2FracBits;
+  const uint32_t f = (uint32_t)z & ((UINT32_C(1) << kFixedLog2FracBits) - 1);
+
+  /* Compute 2^f in Q30. The top 5 bits of `f` index the table, and the next 12
+   * bits linearly interpolate between table entries. Table differences are
+   * less than 2^26, so after shifting by 6 the product fits in 32 bits.
+   */
+  const int i = (int)(f >> 19);
+  const uint32_t t = (f >> 7) & 0xfff;
+  const uint32_t mantissa = kFixedExp2Table[i] +
+      ((((kFixedExp2Table[i + 1] - kFixedExp2Table[i]) >> 6) * t) >> 6);
+
+  /* Result is mantissa * 2^(k - 30), where mantissa is in [2^30, 2^31]. */
+  if (k >= 63) {
+    return (k == 63 && mantissa < (UINT32_C(1) << 31))
+        ? (uint64_t)mantissa << 33 : UINT64_MAX;
+  } else if (k >= 30) {
+    return (uint64_t)mantissa << (k - 30);
+  } else {
+    const int shift = 30 - k;
+    if (shift > 31) { return 0; }
+    return (mantissa + ((UINT32_C(1) << shift) >> 1)) >> shift;
+  }
+}
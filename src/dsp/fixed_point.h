@@ -0,0 +1,104 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * Fixed-point arithmetic for microcontrollers without an FPU.
+ *
+ * We use the usual Qn notation: an integer x in Qn format represents the real
+ * value x / 2^n. For instance, Q15 in int16_t represents [-1, 1) and Q31 in
+ * int32_t represents [-1, 1) with higher resolution.
+ *
+ * `FixedLog2()` and `FixedExp2()` are integer-only analogs of `FastLog2()` and
+ * `FastExp2()` in fast_fun.h, with log values in Q24 format. They are
+ * implemented with 33-entry lookup tables and linear interpolation:
+ *
+ *  - FixedLog2(x) has max absolute error of about 2e-4.
+ *  - FixedExp2(x) has max relative error of about 1e-4.
+ *
+ * Together they compute powers x^y = 2^(y log2(x)), as used for power law
+ * compression, with about 0.02% relative error for moderate y.
+ *
+ * The conversion functions from float are intended for precomputing
+ * parameters and coefficients at initialization. Processing functions built
+ * on this library should otherwise use only integer arithmetic.
+ *
+ * NOTE: It is assumed that right shifting a negative signed integer is an
+ * arithmetic shift, as is the case with GCC, Clang, and Arm compilers.
+ */
+
+#ifndef AUDIO_TO_TACTILE_SRC_DSP_FIXED_POINT_H_
+#define AUDIO_TO_TACTILE_SRC_DSP_FIXED_POINT_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Number of fractional bits in log values of FixedLog2() and FixedExp2(). */
+#define kFixedLog2FracBits 24
+/* Value returned by FixedLog2(0), representing log2(0) = -infinity. It is
+ * finite so that it can be offset without overflow, and FixedExp2() of it or
+ * any smaller value is zero.
+ */
+#define kFixedLog2OfZero (-(INT32_C(64) << kFixedLog2FracBits))
+
+/* Saturates a 32-bit value to int16_t range. */
+static int16_t FixedSaturateInt16(int32_t x) {
+  if (x > INT16_MAX) { return INT16_MAX; }
+  if (x < INT16_MIN) { return INT16_MIN; }
+  return (int16_t)x;
+}
+
+/* Saturates a 64-bit value to int32_t range. */
+static int32_t FixedSaturateInt32(int64_t x) {
+  if (x > INT32_MAX) { return INT32_MAX; }
+  if (x < INT32_MIN) { return INT32_MIN; }
+  return (int32_t)x;
+}
+
+/* Converts float `x` to fixed point with `frac_bits` fractional bits,
+ * rounding to nearest and saturating to int32_t range.
+ */
+int32_t FixedFromFloat(float x, int frac_bits);
+
+/* Converts fixed point `x` with `frac_bits` fractional bits to float. */
+float FixedToFloat(int32_t x, int frac_bits);
+
+/* Computes log2(x) in Q24 format, where `x` is read as an integer. If `x` is
+ * in Qn format, subtract `n << kFixedLog2FracBits` from the result to get
+ * log2 of the value it represents. Returns kFixedLog2OfZero if x = 0.
+ */
+int32_t FixedLog2(uint64_t x);
+
+/* Computes 2^y for `y` in Q24 format, returning the result with `frac_bits`
+ * fractional bits, rounded and saturated to [0, UINT64_MAX].
+ */
+uint64_t FixedExp2(int32_t y, int frac_bits);
+
+/* Multiplies Q24 log value `y` by `exponent` in Q16 format, e.g. to scale
+ * FixedLog2(x) by exponent p to compute x^p = FixedExp2(p log2(x)). The result
+ * is in Q24 format, saturated to [kFixedLog2OfZero, -kFixedLog2OfZero].
+ */
+static int32_t FixedLog2Scale(int32_t y, int32_t exponent) {
+  const int64_t result = ((int64_t)y * exponent) >> 16;
+  if (result > -kFixedLog2OfZero) { return -kFixedLog2OfZero; }
+  if (result < kFixedLog2OfZero) { return kFixedLog2OfZero; }
+  return (int32_t)result;
+}
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif
+#endif /* AUDIO_TO_TACTILE_SRC_DSP_FIXED_POINT_H_ */
@@ -0,0 +1,89 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * MemoryUsage, a breakdown of the memory used by a DSP object.
+ *
+ * Objects supporting this have a function following the pattern
+ *
+ *   void FooMemoryUsage(const Foo* foo, MemoryUsage* usage);
+ *
+ * that sets `usage` to the memory used by `foo`, in three disjoint parts:
+ *
+ *  - `heap_bytes`: RAM in the object's dynamically-sized buffer, allocated by
+ *    FooMake() or passed to FooInitInBuffer() [in which case this is
+ *    FooRequiredBytes(), including kArenaAlignmentSlack].
+ *
+ *  - `state_bytes`: RAM in fixed-size state held by value, e.g. the size of the
+ *    PostProcessor struct, which the caller embeds in its own storage.
+ *
+ *  - `table_bytes`: Constant tables the object reads, such as filter designs
+ *    and lookup tables. On a microcontroller, these are in flash rather than
+ *    RAM. Tables are shared, so e.g. kFastFunLog2Table is counted by each
+ *    object that reads it. Use MemoryUsageAddRam() when combining objects
+ *    that share tables.
+ *
+ * NOTE: Functions below are marked `static` [the C analogy for `inline`] so
+ * that ideally they get inline expanded.
+ */
+
+#ifndef AUDIO_TO_TACTILE_SRC_DSP_MEMORY_USAGE_H_
+#define AUDIO_TO_TACTILE_SRC_DSP_MEMORY_USAGE_H_
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+  /* Bytes in the dynamically-sized buffer. */
+  size_t heap_bytes;
+  /* Bytes in fixed-size state held by value. */
+  size_t state_bytes;
+  /* Bytes in constant tables. */
+  size_t table_bytes;
+} MemoryUsage;
+
+/* Sets all counts in `usage` to zero. */
+static void MemoryUsageZero(MemoryUsage* usage) {
+  usage->heap_bytes = 0;
+  usage->state_bytes = 0;
+  usage->table_bytes = 0;
+}
+
+/* Total RAM bytes, the sum of heap and state bytes. */
+static size_t MemoryUsageRamBytes(const MemoryUsage* usage) {
+  return usage->heap_bytes + usage->state_bytes;
+}
+
+/* Adds all counts of `usage` to `total`. */
+static void MemoryUsageAdd(MemoryUsage* total, const MemoryUsage* usage) {
+  total->heap_bytes += usage->heap_bytes;
+  total->state_bytes += usage->state_bytes;
+  total->table_bytes += usage->table_bytes;
+}
+
+/* Adds the heap and state bytes of `usage` to `total`, but not table bytes.
+ * This is useful to count an object whose tables are already counted.
+ */
+static void MemoryUsageAddRam(MemoryUsage* total, const MemoryUsage* usage) {
+  total->heap_bytes += usage->heap_bytes;
+  total->state_bytes += usage->state_bytes;
+}
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif
+#endif /* AUDIO_TO_TACTILE_SRC_DSP_MEMORY_USAGE_H_ */
@@ -0,0 +1,543 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/multistage_resampler.h"
+
+#include <assert.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "dsp/aligned_alloc.h"
+#include "dsp/arena.h"
+#include "dsp/q_resampler_kernel.h"
+
+const MultistageResamplerOptions kMultistageResamplerDefaultOptions = {
+    /*stopband_db=*/60.0f,
+    /*passband_proportion=*/0.9f,
+    /*max_halfband_stages=*/3,
+};
+
+/* One halfband stage, either a decimator or an interpolator.
+ *
+ * The halfband filter h[k], |k| <= radius, has h[0] = 1/2, h[k] = 0 for even
+ * k != 0, and is symmetric. `radius` is odd, so that the outermost taps are
+ * nonzero, and the filter has `num_pairs` = (radius + 1) / 2 pairs of nonzero
+ * taps besides the center.
+ */
+typedef struct {
+  int radius;
+  int num_pairs;
+  /* Odd taps, `coeffs[i]` = h[2 i + 1]. For an interpolator, these are scaled
+   * by 2 to compensate for zero stuffing.
+   */
+  float* coeffs;
+  /* Buffer of delayed and new input frames, with capacity `max_input_frames`
+   * plus the history.
+   */
+  float* buffer;
+  int buffered_frames;
+  /* Index in `buffer` of the center frame of the next output. */
+  int center;
+  int max_input_frames;
+  int max_output_frames;
+  float* output;
+} HalfbandStage;
+
+struct MultistageResampler {
+  MultistageResamplerPlan plan;
+  int num_channels;
+  int is_upsampling;
+  int max_input_frames;
+  int max_output_frames;
+  int flush_frames;
+  HalfbandStage stages[kMultistageResamplerMaxHalfbandStages];
+  QResampler* qresampler;
+  /* Output of the last stage. */
+  float* output;
+  /* Buffer to free in MultistageResamplerFree(). */
+  void* allocation;
+};
+
+/* Estimates the number of taps for a Kaiser-windowed filter with `transition`
+ * width as a proportion of the sample rate.
+ */
+static double KaiserNumTaps(double stopband_db, double transition) {
+  return (stopband_db - 7.95) / (14.36 * transition) + 1.0;
+}
+
+/* Kaiser window beta parameter for a given stopband attenuation. */
+static float KaiserBeta(float stopband_db) {
+  if (stopband_db > 50.0f) {
+    return 0.1102f * (stopband_db - 8.7f);
+  } else if (stopband_db > 21.0f) {
+    return 0.5842f * (float)pow(stopband_db - 21.0f, 0.4f) +
+        0.07886f * (stopband_db - 21.0f);
+  } else {
+    return 1e-3f;  /* QResamplerKernelInit() requires beta > 0. */
+  }
+}
+
+/* Gets the radius of a halfband filter at `rate_hz`, the higher of the stage's
+ * input and output rates, or 0 if a halfband stage isn't possible.
+ */
+static int HalfbandRadius(double rate_hz, double min_rate_hz,
+                          double stopband_db) {
+  /* Passband up to min_rate_hz / 2, stopband from rate_hz / 2 - min_rate_hz /
+   * 2, as described in the .h file.
+   */
+  const double transition = (0.5 * rate_hz - min_rate_hz) / rate_hz;
+  if (transition <= 0.0) { return 0; }
+  int radius = (int)ceil((KaiserNumTaps(stopband_db, transition) - 1.0) / 2);
+  if (radius % 2 == 0) { ++radius; }
+  return radius;
+}
+
+/* Fills in QResampler options for converting from `input_rate_hz` to
+ * `output_rate_hz`, and returns the cost in multiplies per output frame.
+ */
+static double PlanQResamplerStage(double input_rate_hz, double output_rate_hz,
+                                  const MultistageResamplerOptions* options,
+                                  QResamplerOptions* qresampler_options) {
+  /* Transition as a proportion of the lower rate, between the passband edge
+   * and the lower Nyquist frequency.
+   */
+  const double transition = 0.5 * (1.0 - options->passband_proportion);
+  /* QResampler's kernel has radius `filter_radius_factor` in units of samples
+   * at the lower rate, so its length is 2 * filter_radius_factor.
+   */
+  const double radius_factor =
+      (KaiserNumTaps(options->stopband_db, transition) - 1.0) / 2;
+  *qresampler_options = kQResamplerDefaultOptions;
+  qresampler_options->filter_radius_factor = (float)radius_factor;
+  /* QResampler's cutoff is the middle of the transition band. */
+  qresampler_options->cutoff_proportion =
+      0.5f * (1.0f + options->passband_proportion);
+  qresampler_options->kaiser_beta = KaiserBeta(options->stopband_db);
+
+  const double factor = input_rate_hz / output_rate_hz;
+  const double radius = radius_factor * ((factor > 1.0) ? factor : 1.0);
+  return 2 * ceil(radius) + 1;
+}
+
+int MultistageResamplerPlanConversion(float input_sample_rate_hz,
+                                      float output_sample_rate_hz,
+                                      const MultistageResamplerOptions* options,
+                                      MultistageResamplerPlan* plan) {
+  if (!options) {
+    options = &kMultistageResamplerDefaultOptions;
+  }
+  if (plan == NULL ||
+      !(input_sample_rate_hz > 0.0f) ||
+      !(output_sample_rate_hz > 0.0f) ||
+      !(options->stopband_db > 0.0f) ||
+      !(0.0f < options->passband_proportion &&
+        options->passband_proportion < 1.0f) ||
+      !(0 <= options->max_halfband_stages &&
+        options->max_halfband_stages <= kMultistageResamplerMaxHalfbandStages)) {
+    return 0;
+  }
+
+  const int is_upsampling = (input_sample_rate_hz < output_sample_rate_hz);
+  const double min_rate_hz =
+      is_upsampling ? input_sample_rate_hz : output_sample_rate_hz;
+  const double max_rate_hz =
+      is_upsampling ? output_sample_rate_hz : input_sample_rate_hz;
+  int best_num_stages = -1;
+  int k;
+  for (k = 0; k <= options->max_halfband_stages; ++k) {
+    /* Halfband stages run at the higher rate, max_rate_hz / 2^i, i < k. */
+    double cost = 0.0;
+    double rate_hz = max_rate_hz;
+    int radius[kMultistageResamplerMaxHalfbandStages];
+    int i;
+    for (i = 0; i < k; ++i) {
+      radius[i] = HalfbandRadius(rate_hz, min_rate_hz, options->stopband_db);
+      if (!radius[i]) { break; }
+      /* The filter is computed once per frame at the lower rate, with one
+       * multiply per pair of nonzero taps plus one for the center tap if
+       * decimating. Normalize to cost per input frame.
+       */
+      const int num_pairs = (radius[i] + 1) / 2;
+      const double cost_per_frame = num_pairs + (is_upsampling ? 0 : 1);
+      cost += cost_per_frame * (0.5 * rate_hz) / input_sample_rate_hz;
+      rate_hz *= 0.5;
+    }
+    if (i < k) { break; }  /* More stages aren't possible. */
+
+    QResamplerOptions qresampler_options;
+    const double qresampler_input_rate_hz =
+        is_upsampling ? input_sample_rate_hz : rate_hz;
+    const double qresampler_output_rate_hz =
+        is_upsampling ? rate_hz : output_sample_rate_hz;
+    cost += PlanQResamplerStage(qresampler_input_rate_hz,
+                                qresampler_output_rate_hz, options,
+                                &qresampler_options) *
+        qresampler_output_rate_hz / input_sample_rate_hz;
+
+    if (k == 0) {
+      plan->single_stage_cost = (float)cost;
+    }
+    if (best_num_stages < 0 || cost < plan->cost) {
+      best_num_stages = k;
+      plan->num_halfband_stages = k;
+      /* Store halfband radii in processing order. */
+      for (i = 0; i < k; ++i) {
+        plan->halfband_radius[i] = radius[is_upsampling ? k - 1 - i : i];
+      }
+      plan->qresampler_input_rate_hz = (float)qresampler_input_rate_hz;
+      plan->qresampler_output_rate_hz = (float)qresampler_output_rate_hz;
+      plan->qresampler_options = qresampler_options;
+      plan->cost = (float)cost;
+    }
+  }
+  return 1;
+}
+
+/* Designs the halfband filter for `stage`, with `gain` 1 for a decimator and 2
+ * for an interpolator.
+ */
+static int DesignHalfband(HalfbandStage* stage, float stopband_db,
+                          float gain) {
+  QResamplerKernel kernel;
+  /* A factor of 2 with cutoff_proportion 1 is a sinc with cutoff at a quarter
+   * of the sample rate. Make the window slightly wider than the filter so that
+   * the outermost taps are nonzero.
+   */
+  if (!QResamplerKernelInit(&kernel, 2.0f, 1.0f,
+                            /*filter_radius_factor=*/0.5f * (stage->radius + 1),
+                            /*cutoff_proportion=*/1.0f,
+                            /*kaiser_beta=*/KaiserBeta(stopband_db))) {
+    return 0;
+  }
+  double sum = 0.0;
+  int i;
+  for (i = 0; i < stage->num_pairs; ++i) {
+    sum += QResamplerKernelEval(&kernel, 2 * i + 1);
+  }
+  /* Normalize so that the odd taps sum to 1/2 on each side, for unit DC gain
+   * with center tap 1/2.
+   */
+  for (i = 0; i < stage->num_pairs; ++i) {
+    stage->coeffs[i] =
+        (float)(gain * 0.25 * QResamplerKernelEval(&kernel, 2 * i + 1) / sum);
+  }
+  return 1;
+}
+
+/* Number of history frames kept in a halfband stage buffer. */
+static int HalfbandHistoryFrames(const HalfbandStage* stage) {
+  return 2 * stage->radius;
+}
+
+static void HalfbandReset(HalfbandStage* stage, int num_channels,
+                          int is_upsampling) {
+  /* Start with zeros before the first input frame. */
+  const int num_zeros = is_upsampling ? stage->num_pairs - 1 : stage->radius;
+  memset(stage->buffer, 0, sizeof(float) * num_zeros * num_channels);
+  stage->buffered_frames = num_zeros;
+  stage->center = num_zeros;
+}
+
+/* Appends `num_input_frames` frames of `input` to the stage buffer. */
+static void HalfbandAppend(HalfbandStage* stage, const float* input,
+                           int num_input_frames, int num_channels) {
+  assert(num_input_frames <= stage->max_input_frames);
+  memcpy(stage->buffer + stage->buffered_frames * num_channels, input,
+         sizeof(float) * num_input_frames * num_channels);
+  stage->buffered_frames += num_input_frames;
+}
+
+/* Discards buffered frames before `keep_from`. */
+static void HalfbandDiscard(HalfbandStage* stage, int keep_from,
+                            int num_channels) {
+  stage->buffered_frames -= keep_from;
+  memmove(stage->buffer, stage->buffer + keep_from * num_channels,
+          sizeof(float) * stage->buffered_frames * num_channels);
+  stage->center -= keep_from;
+}
+
+/* Runs a halfband decimator, returning the number of output frames. */
+static int HalfbandDecimate(HalfbandStage* stage, const float* input,
+                            int num_input_frames, int num_channels) {
+  HalfbandAppend(stage, input, num_input_frames, num_channels);
+  const int radius = stage->radius;
+  const int num_pairs = stage->num_pairs;
+  const float* coeffs = stage->coeffs;
+  float* output = stage->output;
+  int num_output_frames = 0;
+  int center;
+  for (center = stage->center; center + radius < stage->buffered_frames;
+       center += 2) {
+    const float* x = stage->buffer + center * num_channels;
+    int c;
+    for (c = 0; c < num_channels; ++c) {
+      float sum = 0.5f * x[c];
+      int i;
+      for (i = 0; i < num_pairs; ++i) {
+        const int offset = (2 * i + 1) * num_channels;
+        sum += coeffs[i] * (x[c - offset] + x[c + offset]);
+      }
+      output[c] = sum;
+    }
+    output += num_channels;
+    ++num_output_frames;
+  }
+  stage->center = center;
+  HalfbandDiscard(stage, center - radius, num_channels);
+  return num_output_frames;
+}
+
+/* Runs a halfband interpolator, returning the number of output frames. */
+static int HalfbandInterpolate(HalfbandStage* stage, const float* input,
+                               int num_input_frames, int num_channels) {
+  HalfbandAppend(stage, input, num_input_frames, num_channels);
+  const int num_pairs = stage->num_pairs;
+  const float* coeffs = stage->coeffs;
+  float* output = stage->output;
+  int num_output_frames = 0;
+  int center;
+  /* Output frames 2n and 2n + 1 need input frames n - num_pairs + 1 through
+   * n + num_pairs.
+   */
+  for (center = stage->center; center + num_pairs < stage->buffered_frames;
+       ++center) {
+    const float* x = stage->buffer + center * num_channels;
+    int c;
+    for (c = 0; c < num_channels; ++c) {
+      float sum = 0.0f;
+      int i;
+      for (i = 0; i < num_pairs; ++i) {
+        sum += coeffs[i] * (x[c - i * num_channels] +
+                            x[c + (i + 1) * num_channels]);
+      }
+      /* Even output is the input sample, since the center tap is 1/2. */
+      output[c] = x[c];
+      output[num_channels + c] = sum;
+    }
+    output += 2 * num_channels;
+    num_output_frames += 2;
+  }
+  stage->center = center;
+  HalfbandDiscard(stage, center - (num_pairs - 1), num_channels);
+  return num_output_frames;
+}
+
+MultistageResampler* MultistageResamplerMake(
+    float input_sample_rate_hz,
+    float output_sample_rate_hz,
+    int num_channels,
+    int max_input_frames,
+    const MultistageResamplerOptions* options) {
+  if (!options) {
+    options = &kMultistageResamplerDefaultOptions;
+  }
+  MultistageResamplerPlan plan;
+  if (num_channels <= 0 || max_input_frames <= 0 ||
+      !MultistageResamplerPlanConversion(
+          input_sample_rate_hz, output_sample_rate_hz, options, &plan)) {
+    return NULL;
+  }
+  const int is_upsampling = (input_sample_rate_hz < output_sample_rate_hz);
+  const int num_stages = plan.num_halfband_stages;
+
+  /* Determine the stage sizes, propagating max frames through the chain. */
+  HalfbandStage stages[kMultistageResamplerMaxHalfbandStages];
+  QResampler* qresampler = NULL;
+  int max_frames = max_input_frames;
+  if (is_upsampling) {
+    qresampler = QResamplerMake(
+        plan.qresampler_input_rate_hz, plan.qresampler_output_rate_hz,
+        num_channels, max_frames, &plan.qresampler_options);
+    if (qresampler == NULL) { return NULL; }
+    max_input_frames = QResamplerMaxInputFrames(qresampler);
+    max_frames = QResamplerMaxOutputFrames(qresampler);
+  }
+  size_t required_bytes = kArenaAlignmentSlack +
+      ArenaAllocationSize(sizeof(MultistageResampler));
+  int k;
+  for (k = 0; k < num_stages; ++k) {
+    HalfbandStage* stage = &stages[k];
+    stage->radius = plan.halfband_radius[k];
+    stage->num_pairs = (stage->radius + 1) / 2;
+    stage->max_input_frames = max_frames;
+    stage->max_output_frames =
+        is_upsampling ? 2 * max_frames : (max_frames + 1) / 2;
+    max_frames = stage->max_output_frames;
+    required_bytes +=
+        ArenaAllocationSize(sizeof(float) * stage->num_pairs) +
+        ArenaAllocationSize(sizeof(float) * num_channels *
+            (HalfbandHistoryFrames(stage) + stage->max_input_frames)) +
+        ArenaAllocationSize(
+            sizeof(float) * num_channels * stage->max_output_frames);
+  }
+
+  void* buffer = AlignedAlloc(required_bytes);
+  if (buffer == NULL) {
+    QResamplerFree(qresampler);
+    return NULL;
+  }
+  Arena arena;
+  ArenaInit(&arena, buffer, required_bytes);
+  MultistageResampler* resampler = (MultistageResampler*)ArenaAlloc(
+      &arena, sizeof(MultistageResampler));
+  resampler->plan = plan;
+  resampler->num_channels = num_channels;
+  resampler->is_upsampling = is_upsampling;
+  resampler->max_input_frames = max_input_frames;
+  resampler->qresampler = qresampler;
+  resampler->allocation = buffer;
+
+  for (k = 0; k < num_stages; ++k) {
+    HalfbandStage* stage = &resampler->stages[k];
+    *stage = stages[k];
+    stage->coeffs = (float*)ArenaAlloc(&arena, sizeof(float) * stage->num_pairs);
+    stage->buffer = (float*)ArenaAlloc(&arena, sizeof(float) * num_channels *
+        (HalfbandHistoryFrames(stage) + stage->max_input_frames));
+    stage->output = (float*)ArenaAlloc(
+        &arena, sizeof(float) * num_channels * stage->max_output_frames);
+    if (!DesignHalfband(stage, options->stopband_db,
+                        is_upsampling ? 2.0f : 1.0f)) {
+      MultistageResamplerFree(resampler);
+      return NULL;
+    }
+  }
+  /* Stage buffers come from the arena, so this can't fail. */
+  assert(arena.next <= arena.end);
+
+  if (!is_upsampling) {
+    resampler->qresampler = QResamplerMake(
+        plan.qresampler_input_rate_hz, plan.qresampler_output_rate_hz,
+        num_channels, max_frames, &plan.qresampler_options);
+    if (resampler->qresampler == NULL) {
+      MultistageResamplerFree(resampler);
+      return NULL;
+    }
+    resampler->max_output_frames =
+        QResamplerMaxOutputFrames(resampler->qresampler);
+    resampler->output = QResamplerOutput(resampler->qresampler);
+  } else {
+    resampler->max_output_frames = max_frames;
+    resampler->output = (num_stages > 0)
+        ? resampler->stages[num_stages - 1].output
+        : QResamplerOutput(resampler->qresampler);
+  }
+
+  /* Compute the flush size. Each halfband stage is flushed by its history
+   * length of zeros at its input rate, and the QResampler stage by its flush
+   * frames. Convert to frames at the input rate, rounding up.
+   */
+  const double qresampler_rate_ratio = is_upsampling
+      ? 1.0 : input_sample_rate_hz / plan.qresampler_input_rate_hz;
+  double flush_frames =
+      QResamplerFlushFrames(resampler->qresampler) * qresampler_rate_ratio;
+  double rate_ratio = is_upsampling
+      ? input_sample_rate_hz / plan.qresampler_output_rate_hz : 1.0;
+  for (k = 0; k < num_stages; ++k) {
+    flush_frames +=
+        HalfbandHistoryFrames(&resampler->stages[k]) * rate_ratio + 1;
+    rate_ratio *= is_upsampling ? 0.5 : 2.0;
+  }
+  resampler->flush_frames = (int)ceil(flush_frames) + 1;
+
+  MultistageResamplerReset(resampler);
+  return resampler;
+}
+
+void MultistageResamplerFree(MultistageResampler* resampler) {
+  if (resampler) {
+    QResamplerFree(resampler->qresampler);
+    AlignedFree(resampler->allocation);
+  }
+}
+
+void MultistageResamplerReset(MultistageResampler* resampler) {
+  assert(resampler != NULL);
+  int k;
+  for (k = 0; k < resampler->plan.num_halfband_stages; ++k) {
+    HalfbandReset(&resampler->stages[k], resampler->num_channels,
+                  resampler->is_upsampling);
+  }
+  QResamplerReset(resampler->qresampler);
+}
+
+int MultistageResamplerProcessSamples(MultistageResampler* resampler,
+                                      const float* input,
+                                      int num_input_frames) {
+  assert(resampler != NULL);
+  assert(input != NULL);
+  assert(num_input_frames >= 0);
+  const int num_channels = resampler->num_channels;
+  const int num_stages = resampler->plan.num_halfband_stages;
+
+  /* If num_input_frames is too big, drop some samples from the beginning, as
+   * QResamplerProcessSamples() does.
+   */
+  const int excess_input = num_input_frames - resampler->max_input_frames;
+  if (excess_input > 0) {
+    MultistageResamplerReset(resampler);
+    input += excess_input * num_channels;
+    num_input_frames -= excess_input;
+  }
+
+  const float* frames = input;
+  int num_frames = num_input_frames;
+  int k;
+  if (resampler->is_upsampling) {
+    num_frames = QResamplerProcessSamples(resampler->qresampler, frames,
+                                          num_frames);
+    frames = QResamplerOutput(resampler->qresampler);
+    for (k = 0; k < num_stages; ++k) {
+      HalfbandStage* stage = &resampler->stages[k];
+      num_frames = HalfbandInterpolate(stage, frames, num_frames,
+                                       num_channels);
+      frames = stage->output;
+    }
+  } else {
+    for (k = 0; k < num_stages; ++k) {
+      HalfbandStage* stage = &resampler->stages[k];
+      num_frames = HalfbandDecimate(stage, frames, num_frames, num_channels);
+      frames = stage->output;
+    }
+    num_frames = QResamplerProcessSamples(resampler->qresampler, frames,
+                                          num_frames);
+  }
+  return num_frames;
+}
+
+float* MultistageResamplerOutput(const MultistageResampler* resampler) {
+  return resampler->output;
+}
+
+int MultistageResamplerNumChannels(const MultistageResampler* resampler) {
+  return resampler->num_channels;
+}
+
+int MultistageResamplerMaxInputFrames(const MultistageResampler* resampler) {
+  return resampler->max_input_frames;
+}
+
+int MultistageResamplerMaxOutputFrames(const MultistageResampler* resampler) {
+  return resampler->max_output_frames;
+}
+
+int MultistageResamplerFlushFrames(const MultistageResampler* resampler) {
+  return resampler->flush_frames;
+}
+
+const MultistageResamplerPlan* MultistageResamplerGetPlan(
+    const MultistageResampler* resampler) {
+  return &resampler->plan;
+}
@@ -0,0 +1,176 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * Multistage resampler with halfband stages.
+ *
+ * `MultistageResampler` converts sample rate like QResampler, but factors the
+ * conversion into a cascade of halfband filter stages, each changing the rate
+ * by a factor of 2, plus at most one rational QResampler stage. When
+ * downsampling, e.g. 48 kHz to 16 kHz, the halfband decimators come first:
+ *
+ *   48 kHz --[halfband /2]--> 24 kHz --[QResampler 3/2]--> 16 kHz.
+ *
+ * When upsampling, the QResampler stage comes first and is followed by halfband
+ * interpolators.
+ *
+ * This is cheaper than a single QResampler for sharp filters, since a filter's
+ * cost per second is proportional to its input rate over transition width.
+ * The halfband stages run at high rates but have wide transition bands, and
+ * half their taps are zero, while the sharp final filter runs at a lower rate.
+ *
+ * Filter specification: all chains are designed to meet the same spec, with
+ * passband up to `passband_proportion` times the lower Nyquist frequency,
+ * stopband from the lower Nyquist frequency, and `stopband_db` attenuation.
+ * Filter lengths are estimated with Kaiser's formula
+ *
+ *   num_taps ~= (stopband_db - 7.95) / (14.36 transition_width / sample_rate).
+ *
+ * A halfband filter at rate R has its transition band centered at R/4. For
+ * aliases and images to land in the final stage's stopband, the halfband
+ * passes up to the lower Nyquist frequency F/2 and attenuates above R/2 - F/2,
+ * so a halfband stage is possible when R > 2 F. The final QResampler stage
+ * then does the sharp filtering, but at a lower rate than a single stage.
+ *
+ * The planner, `MultistageResamplerPlanConversion()`, tries 0, 1, ...,
+ * `max_halfband_stages` halfband stages and picks the chain with the fewest
+ * multiplies per input frame. For instance with the default options, 48 kHz to
+ * 16 kHz and 44.1 kHz to 16 kHz each use one halfband stage, at about 55% of
+ * the cost of a single stage.
+ *
+ * Example use:
+ *   MultistageResampler* resampler = MultistageResamplerMake(
+ *       48000.0f, 16000.0f, num_channels, max_input_frames, NULL);
+ *
+ *   while (...) {
+ *     float* input = // Get num_input_frames frames...
+ *     int num_output_frames = MultistageResamplerProcessSamples(
+ *         resampler, input, num_input_frames);
+ *     float* output = MultistageResamplerOutput(resampler);
+ *     // Do something with output.
+ *   }
+ *
+ *   MultistageResamplerFree(resampler);
+ */
+
+#ifndef AUDIO_TO_TACTILE_SRC_DSP_MULTISTAGE_RESAMPLER_H_
+#define AUDIO_TO_TACTILE_SRC_DSP_MULTISTAGE_RESAMPLER_H_
+
+#include "dsp/q_resampler.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Max supported number of halfband stages. */
+#define kMultistageResamplerMaxHalfbandStages 6
+
+typedef struct {
+  /* Min stopband attenuation in dB. The default is 60 dB. */
+  float stopband_db;
+  /* Passband edge as a proportion of min(input_sample_rate_hz,
+   * output_sample_rate_hz) / 2. The stopband begins at 1.0. The default is
+   * 0.9, meaning the passband extends to 90% of the lower Nyquist frequency.
+   */
+  float passband_proportion;
+  /* Max number of halfband stages to consider, between 0 and
+   * kMultistageResamplerMaxHalfbandStages. The default is 3.
+   */
+  int max_halfband_stages;
+} MultistageResamplerOptions;
+extern const MultistageResamplerOptions kMultistageResamplerDefaultOptions;
+
+/* A planned chain of resampling stages. */
+typedef struct {
+  /* Number of halfband stages. */
+  int num_halfband_stages;
+  /* Half length of each halfband filter, which has 2 * radius + 1 taps. Stages
+   * are in processing order.
+   */
+  int halfband_radius[kMultistageResamplerMaxHalfbandStages];
+  /* Input and output sample rates of the QResampler stage. */
+  float qresampler_input_rate_hz;
+  float qresampler_output_rate_hz;
+  /* Options for the QResampler stage. */
+  QResamplerOptions qresampler_options;
+  /* Estimated multiplies per input frame per channel for the chain. */
+  float cost;
+  /* Estimated cost of a single QResampler stage meeting the same spec. */
+  float single_stage_cost;
+} MultistageResamplerPlan;
+
+/* Plans the cheapest chain for converting from `input_sample_rate_hz` to
+ * `output_sample_rate_hz`. Pass NULL for `options` to use the defaults. Returns
+ * 1 on success, 0 on failure.
+ */
+int MultistageResamplerPlanConversion(float input_sample_rate_hz,
+                                      float output_sample_rate_hz,
+                                      const MultistageResamplerOptions* options,
+                                      MultistageResamplerPlan* plan);
+
+struct MultistageResampler; /* Forward declaration. */
+typedef struct MultistageResampler MultistageResampler;
+
+/* Makes a MultistageResampler using the plan from
+ * MultistageResamplerPlanConversion(). The arguments are as for
+ * QResamplerMake(). The caller should free it when done with
+ * `MultistageResamplerFree()`. Returns NULL on failure.
+ */
+MultistageResampler* MultistageResamplerMake(
+    float input_sample_rate_hz,
+    float output_sample_rate_hz,
+    int num_channels,
+    int max_input_frames,
+    const MultistageResamplerOptions* options);
+
+/* Frees a MultistageResampler. */
+void MultistageResamplerFree(MultistageResampler* resampler);
+
+/* Resets to initial state. */
+void MultistageResamplerReset(MultistageResampler* resampler);
+
+/* Processes samples in a streaming manner, same as QResamplerProcessSamples().
+ * `input` has `num_input_frames` interleaved frames. Returns the number of
+ * output frames, which are read with MultistageResamplerOutput().
+ */
+int MultistageResamplerProcessSamples(MultistageResampler* resampler,
+                                      const float* input,
+                                      int num_input_frames);
+
+/* Gets the resampled output buffer. */
+float* MultistageResamplerOutput(const MultistageResampler* resampler);
+
+/* Gets number of channels. */
+int MultistageResamplerNumChannels(const MultistageResampler* resampler);
+
+/* Gets max number of input frames that can be passed to ProcessSamples(). */
+int MultistageResamplerMaxInputFrames(const MultistageResampler* resampler);
+
+/* Gets max number of output frames that ProcessSamples() can produce. */
+int MultistageResamplerMaxOutputFrames(const MultistageResampler* resampler);
+
+/* Gets a number of zero-valued input frames guaranteed to flush the resampler,
+ * as for QResamplerFlushFrames(). It may exceed MaxInputFrames(), in which case
+ * the flush input should be passed in several calls.
+ */
+int MultistageResamplerFlushFrames(const MultistageResampler* resampler);
+
+/* Gets the plan used by the resampler. */
+const MultistageResamplerPlan* MultistageResamplerGetPlan(
+    const MultistageResampler* resampler);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+#endif /* AUDIO_TO_TACTILE_SRC_DSP_MULTISTAGE_RESAMPLER_H_ */
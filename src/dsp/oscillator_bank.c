@@ -0,0 +1,110 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/oscillator_bank.h"
+
+#include "dsp/phase32_simd.h"
+#include "dsp/simd.h"
+
+#define kMaxGroups (kOscillatorBankMaxOscillators / 4)
+
+int OscillatorBankInit(OscillatorBank* bank, int num_oscillators) {
+  if (!(0 <= num_oscillators &&
+        num_oscillators <= kOscillatorBankMaxOscillators)) {
+    return 0;
+  }
+  bank->num_oscillators = num_oscillators;
+  int k;
+  for (k = 0; k < kOscillatorBankMaxOscillators; ++k) {
+    bank->phase[k] = 0;
+    bank->frequency[k] = 0;
+    bank->frequency_ramp[k] = 1.0f;
+    bank->gain[k] = 0.0f;
+    bank->gain_fade_delta[k] = 0.0f;
+  }
+  return 1;
+}
+
+void OscillatorBankSynthesize(OscillatorBank* bank, const float* fade_weights,
+                              int num_frames, float* output) {
+  const int num_oscillators = bank->num_oscillators;
+  const int num_groups = (num_oscillators + 3) / 4;
+  /* Number of groups with all 4 lanes in use, which are stored directly. */
+  const int num_full_groups = num_oscillators / 4;
+  const Float4 kOne = Float4Broadcast(1.0f);
+
+  /* Keep state in vector registers over the loop. */
+  Int4 phase[kMaxGroups];
+  Int4 frequency[kMaxGroups];
+  Float4 frequency_ramp[kMaxGroups];
+  Int4 ramp_mask[kMaxGroups];
+  Float4 gain[kMaxGroups];
+  Float4 gain_fade_delta[kMaxGroups];
+  int any_ramp = 0;
+  int g;
+  for (g = 0; g < num_groups; ++g) {
+    phase[g] = Int4Load(bank->phase + 4 * g);
+    frequency[g] = Int4Load(bank->frequency + 4 * g);
+    frequency_ramp[g] = Float4Load(bank->frequency_ramp + 4 * g);
+    gain[g] = Float4Load(bank->gain + 4 * g);
+    gain_fade_delta[g] = Float4Load(bank->gain_fade_delta + 4 * g);
+
+    /* Frequencies are ramped only in lanes where frequency_ramp != 1, since
+     * converting to float and back would round frequencies larger than 2^24.
+     */
+    ramp_mask[g] = Int4Or(Float4LessThan(frequency_ramp[g], kOne),
+                          Float4LessThan(kOne, frequency_ramp[g]));
+    int k;
+    for (k = 4 * g; k < 4 * g + 4 && k < num_oscillators; ++k) {
+      if (bank->frequency_ramp[k] != 1.0f) { any_ramp = 1; }
+    }
+  }
+
+  int i;
+  for (i = 0; i < num_frames; ++i, output += num_oscillators) {
+    const Float4 fade_weight =
+        Float4Broadcast(fade_weights ? fade_weights[i] : 0.0f);
+
+    for (g = 0; g < num_groups; ++g) {
+      phase[g] = Int4Add(phase[g], frequency[g]);
+      const Float4 value = Float4Mul(
+          Phase32Sin4(phase[g]),
+          Float4Add(gain[g], Float4Mul(gain_fade_delta[g], fade_weight)));
+
+      if (g < num_full_groups) {
+        Float4Store(output + 4 * g, value);
+      } else {  /* Last group is partial, store only lanes in use. */
+        float lanes[4];
+        Float4Store(lanes, value);
+        int k;
+        for (k = 4 * g; k < num_oscillators; ++k) {
+          output[k] = lanes[k - 4 * g];
+        }
+      }
+
+      if (any_ramp) {
+        const Int4 ramped = Float4ToInt4(
+            Float4Mul(Int4ToFloat4(frequency[g]), frequency_ramp[g]));
+        frequency[g] = Float4AsInt4(Float4Select(
+            ramp_mask[g], Int4AsFloat4(ramped), Int4AsFloat4(frequency[g])));
+      }
+    }
+  }
+
+  for (g = 0; g < num_groups; ++g) {
+    Int4Store(bank->phase + 4 * g, phase[g]);
+    Int4Store(bank->frequency + 4 * g, frequency[g]);
+  }
+}
@@ -0,0 +1,98 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * Bank of sine oscillators, computed four at a time in SIMD lanes.
+ *
+ * `OscillatorBank` synthesizes up to kOscillatorBankMaxOscillators sine waves
+ * as interleaved multichannel output, one oscillator per channel. Each
+ * oscillator is a numerically controlled oscillator like `Oscillator` in
+ * phase32.h, and for each frame i and oscillator k computes
+ *
+ *   phase[k] += frequency[k],
+ *   output[i * num_oscillators + k] =
+ *       Phase32Sin(phase[k]) * (gain[k] + gain_fade_delta[k] * fade_weights[i]),
+ *   frequency[k] *= frequency_ramp[k]  (if frequency_ramp[k] != 1),
+ *
+ * the same as the equivalent scalar code with Phase32Sin() and Oscillator. The
+ * per-frame `fade_weights` are shared by all oscillators, e.g. for crossfading
+ * the gains with a window, while `frequency_ramp` makes exponential chirps.
+ *
+ * State is in structure-of-arrays layout padded to a multiple of 4, so that
+ * lanes past `num_oscillators` are loaded harmlessly and have zero gain.
+ *
+ * Example use:
+ *   OscillatorBank bank;
+ *   OscillatorBankInit(&bank, kNumChannels);
+ *   OscillatorBankSetFrequency(&bank, 0, 50.0f / kSampleRateHz);
+ *   bank.gain[0] = 1.0f;
+ *   float output[kNumFrames * kNumChannels];
+ *   OscillatorBankSynthesize(&bank, NULL, kNumFrames, output);
+ */
+
+#ifndef AUDIO_TO_TACTILE_SRC_DSP_OSCILLATOR_BANK_H_
+#define AUDIO_TO_TACTILE_SRC_DSP_OSCILLATOR_BANK_H_
+
+#include <stdint.h>
+
+#include "dsp/phase32.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Max number of oscillators in a bank, a multiple of 4. */
+enum { kOscillatorBankMaxOscillators = 16 };
+
+typedef struct {
+  /* Oscillator phases and frequencies in cycles per sample. These are Phase32
+   * values, stored as int32_t to load them as Int4.
+   */
+  int32_t phase[kOscillatorBankMaxOscillators];
+  int32_t frequency[kOscillatorBankMaxOscillators];
+  /* Factor multiplying the frequency after each sample, or 1.0 for constant
+   * frequency. Ramps should only be used with frequencies in [0, 0.5).
+   */
+  float frequency_ramp[kOscillatorBankMaxOscillators];
+  /* Output gain. During a fade, the gain for frame i is
+   * `gain + gain_fade_delta * fade_weights[i]`.
+   */
+  float gain[kOscillatorBankMaxOscillators];
+  float gain_fade_delta[kOscillatorBankMaxOscillators];
+  int num_oscillators;
+} OscillatorBank;
+
+/* Initializes a bank of `num_oscillators` oscillators, all with phase 0,
+ * frequency 0, no frequency ramp, and gain 0. Returns 1 on success, 0 if
+ * `num_oscillators` is out of range.
+ */
+int /*bool*/ OscillatorBankInit(OscillatorBank* bank, int num_oscillators);
+
+/* Sets the frequency of oscillator `k` in units of cycles per sample. */
+static void OscillatorBankSetFrequency(OscillatorBank* bank, int k,
+                                       float frequency_cycles_per_sample) {
+  bank->frequency[k] = (int32_t)Phase32FromFloat(frequency_cycles_per_sample);
+}
+
+/* Synthesizes `num_frames` frames of interleaved output with `num_oscillators`
+ * channels. `fade_weights` is an array of `num_frames` weights for fading the
+ * gains, or NULL if not fading, equivalent to all weights being zero.
+ */
+void OscillatorBankSynthesize(OscillatorBank* bank, const float* fade_weights,
+                              int num_frames, float* output);
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif
+#endif /* AUDIO_TO_TACTILE_SRC_DSP_OSCILLATOR_BANK_H_ */
@@ -0,0 +1,94 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * Vectorized Phase32 functions.
+ *
+ * These are 4-lane analogs of the functions in phase32.h, for running banks of
+ * oscillators in SIMD lanes. Phases are Int4 values (see simd.h) holding the
+ * Phase32 bits, so that they wrap modulo 2^32 with Int4Add().
+ *
+ * Phase32Sin4() and Phase32Cos4() give the same results as Phase32Sin() and
+ * Phase32Cos(). The table index is computed in vector registers, then the four
+ * values are gathered with scalar loads since SSE2 and NEON have no gather.
+ *
+ * Phase32FromFloat4() differs from Phase32FromFloat() by at most a few units of
+ * 2^-32 cycles.
+ *
+ * NOTE: Functions below are marked `static` [the C analogy for `inline`] so
+ * that ideally they get inline expanded.
+ */
+
+#ifndef AUDIO_TO_TACTILE_SRC_DSP_PHASE32_SIMD_H_
+#define AUDIO_TO_TACTILE_SRC_DSP_PHASE32_SIMD_H_
+
+#include "dsp/phase32.h"
+#include "dsp/simd.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Looks up kPhase32SinTable at each lane of `phase` plus `offset`. */
+static Float4 Phase32TableLookup4(Int4 phase, int32_t offset) {
+  int32_t index[4];
+  /* Arithmetic shift then masking is equivalent to a logical shift. */
+  Int4Store(index, Int4And(
+      Int4ShiftRight(Int4Add(phase, Int4Broadcast(offset)),
+                     32 - kPhase32TableBits),
+      Int4Broadcast((1 << kPhase32TableBits) - 1)));
+  float values[4];
+  values[0] = kPhase32SinTable[index[0]];
+  values[1] = kPhase32SinTable[index[1]];
+  values[2] = kPhase32SinTable[index[2]];
+  values[3] = kPhase32SinTable[index[3]];
+  return Float4Load(values);
+}
+
+/* Sine of each lane of `phase`, same as Phase32Sin(). */
+static Float4 Phase32Sin4(Int4 phase) {
+  return Phase32TableLookup4(
+      phase, (int32_t)1 << (31 - kPhase32TableBits)); /* Rounding offset. */
+}
+
+/* Cosine of each lane of `phase`, same as Phase32Cos(). */
+static Float4 Phase32Cos4(Int4 phase) {
+  return Phase32TableLookup4(
+      phase, ((int32_t)1 << (31 - kPhase32TableBits)) /* Rounding offset. */
+          + ((int32_t)1 << 30));                       /* Quarter cycle. */
+}
+
+/* Gets Phase32 from float in units of cycles for each lane, wrapping values
+ * outside of [0, 1). Only the fractional part is used, and values larger than
+ * 2^24 in magnitude, which have no fractional part, map to phase 0.
+ */
+static Int4 Phase32FromFloat4(Float4 phase_float) {
+  const Float4 kMax = Float4Broadcast(16777216.0f);  /* = 2^24. */
+  phase_float = Float4Min(Float4Max(phase_float,
+                                    Float4Sub(Float4Broadcast(0.0f), kMax)),
+                          kMax);
+  /* Remove the integer part so that `frac` is in (-1, 1). */
+  const Float4 frac = Float4Sub(
+      phase_float, Int4ToFloat4(Float4ToInt4(phase_float)));
+  /* Convert to Q30 so that it fits in int32_t, then shift up to Q32. The
+   * result wraps modulo 2^32, so negative `frac` maps to 1 + frac.
+   */
+  return Int4ShiftLeft(
+      Float4ToInt4(Float4Mul(frac, Float4Broadcast(1073741824.0f))), 2);
+}
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif
+#endif /* AUDIO_TO_TACTILE_SRC_DSP_PHASE32_SIMD_H_ */
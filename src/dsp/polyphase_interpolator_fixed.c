@@ -0,0 +1,130 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/polyphase_interpolator_fixed.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "dsp/q_resampler_kernel.h"
+
+#if kPolyphaseInterpolatorFixedTaps != 4
+#error "PolyphaseInterpolatorFixedProcessChannel() assumes 4 taps per phase."
+#endif
+
+/* Kernel cutoff as a proportion of input Nyquist, and Kaiser beta. With only
+ * four taps per phase the transition band is wide. These values trade passband
+ * droop, about -0.3 dB at 0.2 cycles per input sample (400 Hz at 2 kHz), for
+ * image attenuation of 45 dB or more below that frequency. The zero-order hold
+ * by comparison droops -0.6 dB with images at -12 dB.
+ */
+static const float kCutoffProportion = 0.95f;
+static const float kKaiserBeta = 4.0f;
+
+int PolyphaseInterpolatorFixedInit(PolyphaseInterpolatorFixed* state,
+                                   int factor, int num_channels) {
+  if (state == NULL ||
+      !(1 <= factor && factor <= kPolyphaseInterpolatorFixedMaxFactor) ||
+      !(1 <= num_channels &&
+        num_channels <= kPolyphaseInterpolatorFixedMaxChannels)) {
+    fprintf(stderr, "Error: Invalid PolyphaseInterpolatorFixed args.\n");
+    return 0;
+  }
+
+  QResamplerKernel kernel;
+  if (!QResamplerKernelInit(&kernel, 1.0f, (float)factor,
+                            0.5f * kPolyphaseInterpolatorFixedTaps,
+                            kCutoffProportion, kKaiserBeta)) {
+    return 0;
+  }
+
+  const int kHalfTaps = kPolyphaseInterpolatorFixedTaps / 2;
+  int p;
+  for (p = 0; p < factor; ++p) {
+    /* Output phase p is at time kHalfTaps - p / factor before the most recent
+     * input sample, so tap k is at distance k - kHalfTaps + p / factor.
+     */
+    double taps[kPolyphaseInterpolatorFixedTaps];
+    double sum = 0.0;
+    int k;
+    for (k = 0; k < kPolyphaseInterpolatorFixedTaps; ++k) {
+      taps[k] = QResamplerKernelEval(
+          &kernel, k - kHalfTaps + (double)p / factor);
+      sum += taps[k];
+    }
+    /* Normalize the phase to unit DC gain, and round to Q15 such that the
+     * coefficients sum to exactly 2^15 by putting the rounding residual on the
+     * largest tap.
+     */
+    int32_t total = 0;
+    int largest = 0;
+    for (k = 0; k < kPolyphaseInterpolatorFixedTaps; ++k) {
+      const int32_t coeff = (int32_t)floor(32768.0 * taps[k] / sum + 0.5);
+      state->coeffs[p][k] = (int16_t)coeff;
+      total += coeff;
+      if (taps[k] > taps[largest]) { largest = k; }
+    }
+    state->coeffs[p][largest] += (int16_t)(32768 - total);
+  }
+
+  state->factor = factor;
+  state->num_channels = num_channels;
+  PolyphaseInterpolatorFixedReset(state);
+  return 1;
+}
+
+void PolyphaseInterpolatorFixedReset(PolyphaseInterpolatorFixed* state) {
+  memset(state->history, 0, sizeof(state->history));
+}
+
+void PolyphaseInterpolatorFixedProcessChannel(
+    PolyphaseInterpolatorFixed* state, int channel, const uint16_t* input,
+    int input_stride, int num_frames, uint16_t offset, uint16_t* output,
+    int output_stride) {
+  const int factor = state->factor;
+  const int32_t max_value = 2 * (int32_t)offset;
+  int16_t* history = state->history[channel];
+  /* Keep history in locals, most recent first. */
+  int32_t x1 = history[0];
+  int32_t x2 = history[1];
+  int32_t x3 = history[2];
+  int n;
+  for (n = 0; n < num_frames; ++n, input += input_stride) {
+    const int32_t x0 = (int32_t)*input - offset;
+    int p;
+    for (p = 0; p < factor; ++p, output += output_stride) {
+      const int16_t* coeffs = state->coeffs[p];
+      /* Accumulate in Q15. Input magnitude is at most 2^14, and coefficients
+       * sum to 2^15 with small negative lobes, so this doesn't overflow.
+       */
+      const int32_t accum = coeffs[0] * x0 + coeffs[1] * x1 +
+          coeffs[2] * x2 + coeffs[3] * x3;
+      int32_t value = offset + ((accum + (1 << 14)) >> 15);
+      if (value < 0) {
+        value = 0;
+      } else if (value > max_value) {
+        value = max_value;
+      }
+      *output = (uint16_t)value;
+    }
+    x3 = x2;
+    x2 = x1;
+    x1 = x0;
+  }
+  history[0] = (int16_t)x1;
+  history[1] = (int16_t)x2;
+  history[2] = (int16_t)x3;
+}
@@ -0,0 +1,103 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * Fixed-point polyphase interpolator for upsampling PWM samples.
+ *
+ * The tactile pipeline produces samples at a decimated rate, around 2 kHz,
+ * while the PWM plays at around 15.6 kHz. Repeating each sample (a zero-order
+ * hold) leaves images of the tactile signal around multiples of the decimated
+ * rate, attenuated only by the hold's sinc response, e.g. -25 dB for the image
+ * of a 100 Hz tone. `PolyphaseInterpolatorFixed` upsamples by an integer
+ * `factor` with a short Kaiser-windowed sinc filter instead, so that images
+ * are strongly attenuated without running the pipeline at a higher rate.
+ *
+ * The filter has kPolyphaseInterpolatorFixedTaps taps per phase, with Q15
+ * coefficients. Each phase is normalized to unit DC gain, so that constant
+ * input is reproduced exactly. Each output sample costs
+ * kPolyphaseInterpolatorFixedTaps 16x16 -> 32-bit multiply-accumulates, with
+ * no floating point. The interpolation delay is
+ * kPolyphaseInterpolatorFixedTaps / 2 input samples.
+ *
+ * Samples are uint16_t in offset binary with midpoint `offset`, as PWM values
+ * are, with `offset` = kTopValue / 2 in pwm_sleeve.h. Outputs are saturated to
+ * [0, 2 * offset]. The offset should be at most 2^14, so that samples relative
+ * to the offset fit in int16_t.
+ *
+ * Channels are processed independently, each with its own filter history, so
+ * that they may be written to buffers with any layout.
+ *
+ * Example use:
+ *   PolyphaseInterpolatorFixed interpolator;
+ *   PolyphaseInterpolatorFixedInit(&interpolator, 8, num_channels);
+ *
+ *   for (c = 0; c < num_channels; ++c) {
+ *     PolyphaseInterpolatorFixedProcessChannel(
+ *         &interpolator, c, input + c, num_channels, num_frames, 256,
+ *         output + c, num_channels);
+ *   }
+ */
+
+#ifndef AUDIO_TO_TACTILE_SRC_DSP_POLYPHASE_INTERPOLATOR_FIXED_H_
+#define AUDIO_TO_TACTILE_SRC_DSP_POLYPHASE_INTERPOLATOR_FIXED_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Max upsampling factor. */
+#define kPolyphaseInterpolatorFixedMaxFactor 16
+/* Number of filter taps per phase. */
+#define kPolyphaseInterpolatorFixedTaps 4
+/* Max number of channels. */
+#define kPolyphaseInterpolatorFixedMaxChannels 12
+
+typedef struct {
+  /* Q15 filter coefficients, where coeffs[p][k] multiplies the kth most recent
+   * input sample for output phase p.
+   */
+  int16_t coeffs[kPolyphaseInterpolatorFixedMaxFactor]
+                [kPolyphaseInterpolatorFixedTaps];
+  /* Past input samples relative to the offset, most recent first. */
+  int16_t history[kPolyphaseInterpolatorFixedMaxChannels]
+                 [kPolyphaseInterpolatorFixedTaps - 1];
+  int factor;
+  int num_channels;
+} PolyphaseInterpolatorFixed;
+
+/* Initializes for upsampling by `factor`, between 1 and
+ * kPolyphaseInterpolatorFixedMaxFactor, with `num_channels` channels. Returns 1
+ * on success, 0 on failure.
+ */
+int /*bool*/ PolyphaseInterpolatorFixedInit(PolyphaseInterpolatorFixed* state,
+                                            int factor, int num_channels);
+
+/* Resets filter history to the midpoint, as if the input had been silent. */
+void PolyphaseInterpolatorFixedReset(PolyphaseInterpolatorFixed* state);
+
+/* Upsamples `num_frames` samples of `channel`, read from `input` with stride
+ * `input_stride`, writing `num_frames * factor` samples to `output` with stride
+ * `output_stride`. Samples are offset binary with midpoint `offset`.
+ */
+void PolyphaseInterpolatorFixedProcessChannel(
+    PolyphaseInterpolatorFixed* state, int channel, const uint16_t* input,
+    int input_stride, int num_frames, uint16_t offset, uint16_t* output,
+    int output_stride);
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif
+#endif /* AUDIO_TO_TACTILE_SRC_DSP_POLYPHASE_INTERPOLATOR_FIXED_H_ */
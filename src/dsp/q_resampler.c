@@ -21,6 +21,9 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "dsp/aligned_alloc.h"
+#include "dsp/arena.h"
+#include "dsp/dot_product.h"
 #include "dsp/q_resampler_kernel.h"
 
 const QResamplerOptions kQResamplerDefaultOptions = {
@@ -29,20 +32,47 @@ const QResamplerOptions kQResamplerDefaultOptions = {
     /*filter_radius_factor=*/5.0f,
     /*cutoff_proportion=*/0.9f,
     /*kaiser_beta=*/5.658f,
+    /*kernel_table_phases=*/0,
+    /*filter_cache=*/NULL,
 };
 
 struct QResampler {
-  /* Buffer of delayed input samples with capacity for num_taps frames. When
-   * calling to ProcessSamples(), unconsumed input samples are stored in this
-   * buffer so that they are available in the next call to ProcessSamples().
+  /* Buffer of delayed input samples with capacity for `taps_capacity` frames.
+   * When calling to ProcessSamples(), unconsumed input samples are stored in
+   * this buffer so that they are available in the next call to
+   * ProcessSamples().
    */
   float* delayed_input;
   /* Polyphase filters, stored backward so that they can be applied as a dot
    * product. `filters[num_taps * p + k]` is the kth coefficient for phase p.
+   * If `table_phases` != factor_denominator, this is instead the kernel table
+   * with table_phases + 1 rows, where row j is the filter for phase
+   * j / table_phases, and filters are interpolated between rows.
    */
-  float* filters;
-  /* Output buffer. Its capacity is large enough to hold the output from
-   * resampling an input with size up to max(max_input_frames, FlushFrames).
+  const float* filters;
+  /* Number of table phases, see `filters`. */
+  int table_phases;
+  /* Equal to table_phases / factor_denominator. */
+  float table_step;
+  /* Buffer of `taps_capacity` floats for an interpolated filter, or NULL if
+   * interpolation is disabled in the options.
+   */
+  float* interpolated_filter;
+  /* Filter cache entry that `filters` points into, or NULL if not shared. */
+  struct QResamplerCachedFilters* cached_filters;
+  /* Filters laid out in the resampler's own buffer, with capacity for
+   * `buffer_filter_floats` floats, or NULL if there is no space for them.
+   */
+  float* buffer_filters;
+  /* Heap-allocated filters that the resampler owns, or NULL. This is used when
+   * QResamplerReconfigure() switches to filters that don't fit in the buffer
+   * and there is no filter cache.
+   */
+  float* heap_filters;
+  int heap_filter_floats;
+  /* Output buffer with capacity for `output_capacity` frames, which is large
+   * enough to hold the output from resampling an input with size up to
+   * max(max_input_frames, FlushFrames).
    */
   float* output;
   /* Number of channels. */
@@ -55,8 +85,23 @@ struct QResampler {
   int radius;
   /* Max supported number of input frames in calls to ProcessSamples(). */
   int max_input_frames;
-  /* Max output size that ProcessSamples() can produce; capacity of `output`. */
+  /* Max output size that ProcessSamples() can produce. */
   int max_output_frames;
+  /* Buffer capacities, see `delayed_input` and `output`. These are the sizes
+   * for the current configuration, unless the resampler was made with
+   * QResamplerMakeReconfigurable().
+   */
+  int taps_capacity;
+  int output_capacity;
+  /* Args needed to design a new configuration in QResamplerReconfigure(). */
+  float input_sample_rate_hz;
+  int requested_max_input_frames;
+  /* Capacity of `buffer_filters` in floats, or 0 if the filters are shared
+   * through a cache.
+   */
+  int buffer_filter_floats;
+  QResamplerOptions options;
+  RationalApproximationOptions rational_approximation_options;
   /* The rational approximating the requested resampling factor,
    *
    *   factor_numerator / factor_denominator
@@ -73,28 +118,47 @@ struct QResampler {
    */
   int phase_step;
   int phase;
+  /* Buffer to free in QResamplerFree(), or NULL if the caller owns it. */
+  void* allocation;
 };
 
-QResampler* QResamplerMake(float input_sample_rate_hz,
-                           float output_sample_rate_hz,
-                           int num_channels,
-                           int max_input_frames,
-                           const QResamplerOptions* options) {
-  if (!options) {
-    options = &kQResamplerDefaultOptions;
-  }
+/* Resampler design, computed from the QResamplerMake() args. */
+typedef struct {
   QResamplerKernel kernel;
+  float input_sample_rate_hz;
+  int radius;
+  int num_taps;
+  int factor_numerator;
+  int factor_denominator;
+  /* The filter table has `table_rows` rows, where row j is the filter for
+   * phase j / table_phases. Normally, table_phases = table_rows =
+   * factor_denominator. With interpolation, table_rows = table_phases + 1.
+   */
+  int table_phases;
+  int table_rows;
+  int max_input_frames;
+  int max_output_frames;
+} QResamplerDesign;
+
+/* Computes the resampler design. Returns 1 on success, 0 on failure. */
+static int ComputeDesign(float input_sample_rate_hz,
+                         float output_sample_rate_hz,
+                         int num_channels,
+                         int max_input_frames,
+                         const QResamplerOptions* options,
+                         QResamplerDesign* design) {
   if (!QResamplerKernelInit(
-          &kernel, input_sample_rate_hz, output_sample_rate_hz,
+          &design->kernel, input_sample_rate_hz, output_sample_rate_hz,
           /*filter_radius_factor=*/options->filter_radius_factor,
           /*cutoff_proportion=*/options->cutoff_proportion,
           /*kaiser_beta=*/options->kaiser_beta) ||
       num_channels <= 0 || max_input_frames <= 0 ||
       options->max_denominator <= 0) {
-    return NULL;
+    return 0;
   }
 
-  const int radius = (int)ceil(kernel.radius);
+  design->input_sample_rate_hz = input_sample_rate_hz;
+  const int radius = (int)ceil(design->kernel.radius);
   /* We create the polyphase filters h_p by sampling the kernel h(x) as
    *
    *   h_p[k] := h(p/b + k),  p = 0, 1, ..., b - 1,
@@ -114,78 +178,553 @@ QResampler* QResamplerMake(float input_sample_rate_hz,
    */
   const int num_taps = 2 * radius + 1;
   /* Approximate resampling factor as a rational number, > 1 if downsampling. */
-  int factor_numerator;
-  int factor_denominator;
-  RationalApproximation(kernel.factor, options->max_denominator,
+  RationalApproximation(design->kernel.factor, options->max_denominator,
                         options->rational_approximation_options,
-                        &factor_numerator, &factor_denominator);
+                        &design->factor_numerator, &design->factor_denominator);
   /* For flushing, max_input_frames must be at least num_taps - 1. */
   if (num_taps - 1 > max_input_frames) {
     max_input_frames = num_taps - 1;
   }
+  design->radius = radius;
+  design->num_taps = num_taps;
+  if (options->kernel_table_phases > 0 &&
+      design->factor_denominator > options->kernel_table_phases) {
+    design->table_phases = options->kernel_table_phases;
+    design->table_rows = options->kernel_table_phases + 1;
+  } else {
+    design->table_phases = design->factor_denominator;
+    design->table_rows = design->factor_denominator;
+  }
+  design->max_input_frames = max_input_frames;
   /* Get the max possible output size for the given max input size. */
-  const int max_output_frames =
-      (int)((((int64_t)max_input_frames) * factor_denominator +
-             factor_numerator - 1) /
-            factor_numerator);
+  design->max_output_frames =
+      (int)((((int64_t)max_input_frames) * design->factor_denominator +
+             design->factor_numerator - 1) /
+            design->factor_numerator);
+  return 1;
+}
 
-  QResampler* resampler = (QResampler*)malloc(sizeof(QResampler));
-  if (resampler == NULL) {
-    return NULL;
+/* Buffer sizes for laying out a resampler. */
+typedef struct {
+  /* Capacity of the delayed input in frames and of the interpolated filter. */
+  int num_taps;
+  /* Capacity of the output in frames. */
+  int max_output_frames;
+  /* Nonzero if there is an interpolated filter buffer. */
+  int interpolated;
+  /* Number of floats of filters in the buffer, or 0 if they are shared. */
+  int filter_floats;
+} QResamplerCapacity;
+
+/* Gets the capacity for exactly `design`, including space for the filters if
+ * `include_filters` is nonzero.
+ */
+static QResamplerCapacity DesignCapacity(const QResamplerDesign* design,
+                                         int include_filters) {
+  QResamplerCapacity capacity;
+  capacity.num_taps = design->num_taps;
+  capacity.max_output_frames = design->max_output_frames;
+  capacity.interpolated = (design->table_phases != design->factor_denominator);
+  capacity.filter_floats =
+      include_filters ? design->table_rows * design->num_taps : 0;
+  return capacity;
+}
+
+/* Gets the buffer size needed for `capacity`. */
+static size_t CapacityRequiredBytes(const QResamplerCapacity* capacity,
+                                    int num_channels) {
+  return kArenaAlignmentSlack + ArenaAllocationSize(sizeof(QResampler)) +
+      (capacity->filter_floats
+           ? ArenaAllocationSize(sizeof(float) * capacity->filter_floats)
+           : 0) +
+      (capacity->interpolated
+           ? ArenaAllocationSize(sizeof(float) * capacity->num_taps)
+           : 0) +
+      ArenaAllocationSize(sizeof(float) * capacity->num_taps * num_channels) +
+      ArenaAllocationSize(
+          sizeof(float) * capacity->max_output_frames * num_channels);
+}
+
+/* Computes polyphase resampling filter coefficients for `design`, writing
+ * `table_rows * num_taps` values to `coeffs`.
+ */
+static void ComputeFilters(const QResamplerDesign* design, float* coeffs) {
+  const int radius = design->radius;
+  int phase;
+  for (phase = 0; phase < design->table_rows; ++phase) {
+    const double offset = ((double)phase) / design->table_phases;
+    int k;
+    for (k = -radius; k <= radius; ++k) {
+      /* Store filter backwards so that convolution becomes a dot product. */
+      coeffs[radius - k] =
+          (float)QResamplerKernelEval(&design->kernel, offset + k);
+    }
+    coeffs += design->num_taps;
   }
+}
 
-  resampler->filters = NULL;
-  resampler->delayed_input = NULL;
-  resampler->output = NULL;
+/* Entry of a QResamplerFilterCache. Resamplers using the same cache with the
+ * same kernel and number of phases share one immutable filter table. Entries
+ * are reference counted and freed with the last resampler using them.
+ */
+typedef struct QResamplerCachedFilters {
+  struct QResamplerCachedFilters* next;
+  /* Cache key. The filters are a function of the kernel, which is determined
+   * by the resampling factor, radius, cutoff, and Kaiser beta, and the
+   * number of phases.
+   */
+  QResamplerKernel kernel;
+  int table_phases;
+  int table_rows;
+  int num_taps;
+  int ref_count;
+  float* filters;
+} QResamplerCachedFilters;
 
-  /* Allocate internal buffers. */
-  if (!(resampler->filters =
-            (float*)malloc(sizeof(float) * factor_denominator * num_taps)) ||
-      !(resampler->delayed_input =
-            (float*)malloc(sizeof(float) * num_taps * num_channels)) ||
-      !(resampler->output =
-            (float*)malloc(sizeof(float) * max_output_frames * num_channels))) {
-    QResamplerFree(resampler);
-    return NULL;
+struct QResamplerFilterCache {
+  QResamplerCachedFilters* entries;
+};
+
+QResamplerFilterCache* QResamplerFilterCacheMake(void) {
+  QResamplerFilterCache* cache =
+      (QResamplerFilterCache*)malloc(sizeof(QResamplerFilterCache));
+  if (cache) { cache->entries = NULL; }
+  return cache;
+}
+
+void QResamplerFilterCacheFree(QResamplerFilterCache* cache) {
+  if (cache) {
+    assert(cache->entries == NULL);  /* Resamplers must be freed first. */
+    free(cache);
   }
+}
 
-  resampler->num_channels = num_channels;
-  resampler->num_taps = num_taps;
-  resampler->radius = radius;
-  resampler->max_input_frames = max_input_frames;
-  resampler->max_output_frames = max_output_frames;
+int QResamplerFilterCacheSize(const QResamplerFilterCache* cache) {
+  int count = 0;
+  const QResamplerCachedFilters* entry;
+  for (entry = cache->entries; entry; entry = entry->next) {
+    ++count;
+  }
+  return count;
+}
+
+static int KernelsEqual(const QResamplerKernel* a, const QResamplerKernel* b) {
+  return a->factor == b->factor &&
+      a->radius == b->radius &&
+      a->radians_per_sample == b->radians_per_sample &&
+      a->normalization == b->normalization &&
+      a->kaiser_beta == b->kaiser_beta;
+}
+
+/* Gets filters for `design` from `cache`, computing them if not already cached,
+ * and increments the reference count. Returns NULL on allocation failure.
+ */
+static QResamplerCachedFilters* AcquireCachedFilters(
+    QResamplerFilterCache* cache, const QResamplerDesign* design) {
+  QResamplerCachedFilters* entry;
+  for (entry = cache->entries; entry; entry = entry->next) {
+    if (KernelsEqual(&entry->kernel, &design->kernel) &&
+        entry->table_phases == design->table_phases &&
+        entry->table_rows == design->table_rows &&
+        entry->num_taps == design->num_taps) {
+      ++entry->ref_count;
+      return entry;
+    }
+  }
+
+  /* Not found. Allocate a new entry with the filters after the struct. */
+  entry = (QResamplerCachedFilters*)malloc(
+      sizeof(QResamplerCachedFilters) +
+      sizeof(float) * design->table_rows * design->num_taps);
+  if (entry == NULL) { return NULL; }
+  entry->kernel = design->kernel;
+  entry->table_phases = design->table_phases;
+  entry->table_rows = design->table_rows;
+  entry->num_taps = design->num_taps;
+  entry->ref_count = 1;
+  entry->filters = (float*)(entry + 1);
+  ComputeFilters(design, entry->filters);
+
+  entry->next = cache->entries;
+  cache->entries = entry;
+  return entry;
+}
+
+/* Decrements the reference count of `entry`, removing it from `cache` and
+ * freeing it if it reaches zero.
+ */
+static void ReleaseCachedFilters(QResamplerFilterCache* cache,
+                                 QResamplerCachedFilters* entry) {
+  if (--entry->ref_count > 0) { return; }
+  QResamplerCachedFilters** link = &cache->entries;
+  while (*link != entry) {
+    link = &(*link)->next;
+  }
+  *link = entry->next;
+  free(entry);
+}
+
+/* Sets the configuration of `resampler` to `design`, with `filters` pointing
+ * to the filter table. The state is not changed.
+ */
+static void ApplyDesign(QResampler* resampler, const QResamplerDesign* design,
+                        const float* filters) {
+  const int factor_numerator = design->factor_numerator;
+  const int factor_denominator = design->factor_denominator;
+  resampler->input_sample_rate_hz = design->input_sample_rate_hz;
+  resampler->num_taps = design->num_taps;
+  resampler->radius = design->radius;
+  resampler->max_input_frames = design->max_input_frames;
+  resampler->max_output_frames = design->max_output_frames;
   resampler->factor_numerator = factor_numerator;
   resampler->factor_denominator = factor_denominator;
   resampler->factor_floor =
       factor_numerator / factor_denominator; /* Integer divide. */
   resampler->phase_step = factor_numerator % factor_denominator;
+  resampler->table_phases = design->table_phases;
+  resampler->table_step = (float)design->table_phases / factor_denominator;
+  resampler->filters = filters;
+}
 
-  /* Compute polyphase resampling filter coefficients. */
-  float* coeffs = resampler->filters;
-  int phase;
-  for (phase = 0; phase < factor_denominator; ++phase) {
-    const double offset = ((double)phase) / factor_denominator;
-    int k;
-    for (k = -radius; k <= radius; ++k) {
-      /* Store filter backwards so that convolution becomes a dot product. */
-      coeffs[radius - k] = (float)QResamplerKernelEval(&kernel, offset + k);
-    }
-    coeffs += num_taps;
+/* Releases the cached or heap filters of `resampler`, if any. */
+static void ReleaseFilters(QResampler* resampler) {
+  if (resampler->cached_filters) {
+    ReleaseCachedFilters(resampler->options.filter_cache,
+                         resampler->cached_filters);
+    resampler->cached_filters = NULL;
+  }
+  free(resampler->heap_filters);
+  resampler->heap_filters = NULL;
+  resampler->heap_filter_floats = 0;
+}
+
+/* Sets the configuration of `resampler` to `design` and gets its filters: from
+ * the filter cache if the options have one, otherwise computed into the
+ * resampler's buffer or, if they don't fit there, a new heap allocation.
+ * Returns 1 on success. On failure, returns 0 and the resampler is unchanged.
+ */
+static int SetDesignAndFilters(QResampler* resampler,
+                               const QResamplerDesign* design) {
+  QResamplerFilterCache* cache = resampler->options.filter_cache;
+  const int filter_floats = design->table_rows * design->num_taps;
+  if (cache) {
+    QResamplerCachedFilters* cached_filters =
+        AcquireCachedFilters(cache, design);
+    if (cached_filters == NULL) { return 0; }
+    ReleaseFilters(resampler);
+    resampler->cached_filters = cached_filters;
+    ApplyDesign(resampler, design, cached_filters->filters);
+  } else if (filter_floats <= resampler->buffer_filter_floats) {
+    ReleaseFilters(resampler);
+    ComputeFilters(design, resampler->buffer_filters);
+    ApplyDesign(resampler, design, resampler->buffer_filters);
+  } else {
+    float* filters = (float*)malloc(sizeof(float) * filter_floats);
+    if (filters == NULL) { return 0; }
+    ComputeFilters(design, filters);
+    ReleaseFilters(resampler);
+    resampler->heap_filters = filters;
+    resampler->heap_filter_floats = filter_floats;
+    ApplyDesign(resampler, design, filters);
   }
+  return 1;
+}
+
+/* Lays out a resampler for `design` in `buffer`, with buffers sized according
+ * to `capacity`, and gets its filters as in SetDesignAndFilters().
+ */
+static QResampler* InitWithDesign(void* buffer,
+                                  size_t buffer_size,
+                                  const QResamplerDesign* design,
+                                  const QResamplerCapacity* capacity,
+                                  int num_channels,
+                                  int requested_max_input_frames,
+                                  const QResamplerOptions* options) {
+  const int num_taps = capacity->num_taps;
+
+  /* Lay out the QResampler struct and internal buffers in `buffer`. */
+  Arena arena;
+  ArenaInit(&arena, buffer, buffer_size);
+  QResampler* resampler = (QResampler*)ArenaAlloc(&arena, sizeof(QResampler));
+  float* filters = NULL;
+  if (resampler == NULL ||
+      (capacity->filter_floats && !(filters = (float*)ArenaAlloc(
+            &arena, sizeof(float) * capacity->filter_floats))) ||
+      !(resampler->delayed_input = (float*)ArenaAlloc(
+            &arena, sizeof(float) * num_taps * num_channels)) ||
+      !(resampler->output = (float*)ArenaAlloc(
+            &arena,
+            sizeof(float) * capacity->max_output_frames * num_channels))) {
+    return NULL;
+  }
+  resampler->interpolated_filter = NULL;
+  if (capacity->interpolated &&
+      !(resampler->interpolated_filter =
+            (float*)ArenaAlloc(&arena, sizeof(float) * num_taps))) {
+    return NULL;
+  }
+
+  resampler->allocation = NULL;
+  resampler->cached_filters = NULL;
+  resampler->buffer_filters = filters;
+  resampler->heap_filters = NULL;
+  resampler->heap_filter_floats = 0;
+  resampler->num_channels = num_channels;
+  resampler->taps_capacity = num_taps;
+  resampler->output_capacity = capacity->max_output_frames;
+  resampler->buffer_filter_floats = capacity->filter_floats;
+  resampler->requested_max_input_frames = requested_max_input_frames;
+  resampler->options = *options;
+  if (options->rational_approximation_options) {
+    resampler->rational_approximation_options =
+        *options->rational_approximation_options;
+    resampler->options.rational_approximation_options =
+        &resampler->rational_approximation_options;
+  }
+
+  if (!SetDesignAndFilters(resampler, design)) { return NULL; }
 
   QResamplerReset(resampler);
   return resampler;
 }
 
+void QResamplerMemoryUsage(const QResampler* resampler, MemoryUsage* usage) {
+  QResamplerCapacity capacity;
+  capacity.num_taps = resampler->taps_capacity;
+  capacity.max_output_frames = resampler->output_capacity;
+  capacity.interpolated = (resampler->interpolated_filter != NULL);
+  capacity.filter_floats = resampler->buffer_filter_floats;
+
+  const QResamplerCachedFilters* cached_filters = resampler->cached_filters;
+  MemoryUsageZero(usage);
+  usage->heap_bytes =
+      CapacityRequiredBytes(&capacity, resampler->num_channels);
+  if (cached_filters) {
+    usage->heap_bytes += sizeof(QResamplerCachedFilters) +
+        sizeof(float) * cached_filters->table_rows * cached_filters->num_taps;
+  }
+  usage->heap_bytes += sizeof(float) * resampler->heap_filter_floats;
+}
+
+size_t QResamplerRequiredBytes(float input_sample_rate_hz,
+                               float output_sample_rate_hz,
+                               int num_channels,
+                               int max_input_frames,
+                               const QResamplerOptions* options) {
+  if (!options) {
+    options = &kQResamplerDefaultOptions;
+  }
+  QResamplerDesign design;
+  if (!ComputeDesign(input_sample_rate_hz, output_sample_rate_hz, num_channels,
+                     max_input_frames, options, &design)) {
+    return 0;
+  }
+  const QResamplerCapacity capacity = DesignCapacity(&design, 1);
+  return CapacityRequiredBytes(&capacity, num_channels);
+}
+
+/* Allocates a resampler for `design` with buffers sized by `capacity`. */
+static QResampler* MakeWithCapacity(const QResamplerDesign* design,
+                                    const QResamplerCapacity* capacity,
+                                    int num_channels,
+                                    int requested_max_input_frames,
+                                    const QResamplerOptions* options) {
+  const size_t required_bytes = CapacityRequiredBytes(capacity, num_channels);
+  void* buffer = AlignedAlloc(required_bytes);
+  QResampler* resampler = NULL;
+  if (buffer == NULL ||
+      !(resampler = InitWithDesign(buffer, required_bytes, design, capacity,
+                                   num_channels, requested_max_input_frames,
+                                   options))) {
+    AlignedFree(buffer);
+    return NULL;
+  }
+  resampler->allocation = buffer;
+  return resampler;
+}
+
+QResampler* QResamplerMake(float input_sample_rate_hz,
+                           float output_sample_rate_hz,
+                           int num_channels,
+                           int max_input_frames,
+                           const QResamplerOptions* options) {
+  if (!options) {
+    options = &kQResamplerDefaultOptions;
+  }
+  QResamplerDesign design;
+  if (!ComputeDesign(input_sample_rate_hz, output_sample_rate_hz, num_channels,
+                     max_input_frames, options, &design)) {
+    return NULL;
+  }
+  /* Space for filters is needed unless they are shared through a cache. */
+  const QResamplerCapacity capacity =
+      DesignCapacity(&design, options->filter_cache == NULL);
+  return MakeWithCapacity(&design, &capacity, num_channels, max_input_frames,
+                          options);
+}
+
+QResampler* QResamplerMakeReconfigurable(float input_sample_rate_hz,
+                                         float output_sample_rate_hz,
+                                         float min_factor,
+                                         float max_factor,
+                                         int num_channels,
+                                         int max_input_frames,
+                                         const QResamplerOptions* options) {
+  if (!options) {
+    options = &kQResamplerDefaultOptions;
+  }
+  const double factor = (double)input_sample_rate_hz / output_sample_rate_hz;
+  QResamplerDesign design;
+  QResamplerDesign max_design;
+  if (!(0.0f < min_factor && min_factor <= max_factor) ||
+      !(min_factor * (1 - 1e-6) <= factor &&
+        factor <= max_factor * (1 + 1e-6)) ||
+      !ComputeDesign(input_sample_rate_hz, output_sample_rate_hz, num_channels,
+                     max_input_frames, options, &design) ||
+      !ComputeDesign(max_factor, 1.0f, num_channels, max_input_frames,
+                     options, &max_design)) {
+    return NULL;
+  }
+  /* Rational approximation changes the factor by at most
+   * 0.5 / max_denominator.
+   */
+  const double min_approx_factor =
+      min_factor - 0.5 / options->max_denominator;
+  if (!(min_approx_factor > 0.0)) { return NULL; }
+
+  /* The filters are longest at max_factor, and the output is largest at
+   * min_factor. After QResamplerReconfigure(), the next ProcessSamples() call
+   * may consume up to num_taps delayed input frames in addition to its input.
+   */
+  QResamplerCapacity capacity;
+  capacity.num_taps = (design.num_taps > max_design.num_taps)
+      ? design.num_taps : max_design.num_taps;
+  const int max_frames = (max_input_frames > capacity.num_taps - 1)
+      ? max_input_frames : capacity.num_taps - 1;
+  capacity.max_output_frames =
+      (int)ceil((max_frames + capacity.num_taps) / min_approx_factor);
+  if (capacity.max_output_frames < design.max_output_frames) {
+    capacity.max_output_frames = design.max_output_frames;
+  }
+  capacity.interpolated = (options->kernel_table_phases > 0);
+  /* Without a cache, the buffer has space for the initial filters. */
+  capacity.filter_floats = options->filter_cache
+      ? 0 : design.table_rows * design.num_taps;
+  return MakeWithCapacity(&design, &capacity, num_channels, max_input_frames,
+                          options);
+}
+
+QResampler* QResamplerInitInBuffer(void* buffer,
+                                   size_t buffer_size,
+                                   float input_sample_rate_hz,
+                                   float output_sample_rate_hz,
+                                   int num_channels,
+                                   int max_input_frames,
+                                   const QResamplerOptions* options) {
+  /* The filters are always computed into the buffer, so ignore any cache. */
+  QResamplerOptions buffer_options = options ? *options
+                                             : kQResamplerDefaultOptions;
+  buffer_options.filter_cache = NULL;
+  QResamplerDesign design;
+  if (!ComputeDesign(input_sample_rate_hz, output_sample_rate_hz, num_channels,
+                     max_input_frames, &buffer_options, &design)) {
+    return NULL;
+  }
+  const QResamplerCapacity capacity = DesignCapacity(&design, 1);
+  return InitWithDesign(buffer, buffer_size, &design, &capacity, num_channels,
+                        max_input_frames, &buffer_options);
+}
+
 void QResamplerFree(QResampler* resampler) {
   if (resampler) {
-    free(resampler->output);
-    free(resampler->delayed_input);
-    free(resampler->filters);
-    free(resampler);
+    ReleaseFilters(resampler);
+    AlignedFree(resampler->allocation);
   }
 }
 
+int QResamplerReconfigure(QResampler* resampler,
+                          float input_sample_rate_hz,
+                          float output_sample_rate_hz) {
+  assert(resampler != NULL);
+  const int num_channels = resampler->num_channels;
+  QResamplerDesign design;
+  if (!ComputeDesign(input_sample_rate_hz, output_sample_rate_hz, num_channels,
+                     resampler->requested_max_input_frames,
+                     &resampler->options, &design)) {
+    return 0;
+  }
+
+  /* The next output is centered at delayed input position
+   *
+   *   center = radius + phase / factor_denominator,
+   *
+   * which is `distance` frames before the end of the delayed input. To keep the
+   * output timeline continuous with the input yet to arrive, the distance is
+   * converted to frames at the new input sample rate. The delayed input is then
+   * shifted by `shift` frames so that the new filters are centered at
+   * new_radius + new_phase / new_factor_denominator.
+   */
+  const int delayed_input_frames = resampler->delayed_input_frames;
+  const double distance = (delayed_input_frames - resampler->radius) -
+      (double)resampler->phase / resampler->factor_denominator;
+  const double position = delayed_input_frames - design.radius -
+      distance * (input_sample_rate_hz / resampler->input_sample_rate_hz);
+  int shift = (int)floor(position);
+  int phase = (int)floor((position - shift) * design.factor_denominator + 0.5);
+  if (phase >= design.factor_denominator) {
+    phase -= design.factor_denominator;
+    ++shift;
+  }
+  const int new_delayed_input_frames = delayed_input_frames - shift;
+  const int reset = (shift > delayed_input_frames ||
+                     new_delayed_input_frames >= resampler->taps_capacity);
+
+  /* Delayed input frames beyond the new filter support are consumed by the
+   * next ProcessSamples() call in addition to its input, producing extra
+   * output.
+   */
+  const int extra_frames = reset ? 0
+      : new_delayed_input_frames - (design.num_taps - 1);
+  design.max_output_frames =
+      (int)((((int64_t)design.max_input_frames +
+              (extra_frames > 0 ? extra_frames : 0)) *
+                 design.factor_denominator +
+             design.factor_numerator - 1) /
+            design.factor_numerator);
+  if (design.num_taps > resampler->taps_capacity ||
+      design.max_output_frames > resampler->output_capacity ||
+      (design.table_phases != design.factor_denominator &&
+       !resampler->interpolated_filter)) {
+    return 0;  /* The new configuration doesn't fit in the buffers. */
+  }
+  if (!SetDesignAndFilters(resampler, &design)) { return 0; }
+
+  if (reset) {
+    /* The new center is outside the delayed input, which can only happen
+     * shortly after a reset or for extreme rate changes. Start over.
+     */
+    QResamplerReset(resampler);
+    return 1;
+  }
+
+  float* delayed_input = resampler->delayed_input;
+  if (shift >= 0) {
+    /* Discard frames no longer in the filter support. */
+    memmove(delayed_input, delayed_input + shift * num_channels,
+            sizeof(float) * new_delayed_input_frames * num_channels);
+  } else {
+    /* The filters reach further back than the delayed input. Prepend zeros
+     * for this history, which only the outermost filter taps reach.
+     */
+    memmove(delayed_input - shift * num_channels, delayed_input,
+            sizeof(float) * delayed_input_frames * num_channels);
+    memset(delayed_input, 0, sizeof(float) * -shift * num_channels);
+  }
+  resampler->delayed_input_frames = new_delayed_input_frames;
+  resampler->phase = phase;
+  return 1;
+}
+
 void QResamplerReset(QResampler* resampler) {
   assert(resampler != NULL);
   int i;
@@ -254,12 +793,58 @@ int QResamplerNextNumOutputFrames(const QResampler* resampler,
                resampler->factor_numerator);
 }
 
+int QResamplerMaxInputFramesForOutput(const QResampler* resampler,
+                                      int num_output_frames) {
+  assert(resampler != NULL);
+  assert(num_output_frames >= 0);
+  /* Inverting QResamplerNextNumOutputFrames(), the output is at most
+   * num_output_frames when min_consumed_input * factor_denominator - phase
+   * <= num_output_frames * factor_numerator.
+   */
+  const int max_consumed_input =
+      (int)((((int64_t)num_output_frames) * resampler->factor_numerator +
+             resampler->phase) / resampler->factor_denominator);
+  const int result = max_consumed_input - 1 -
+      resampler->delayed_input_frames + resampler->num_taps;
+  /* The result may be negative after QResamplerReconfigure() shortens the
+   * filters, when the delayed input alone produces enough output.
+   */
+  return (result > 0) ? result : 0;
+}
+
+/* Gets the filter for `phase`. With an interpolated kernel table, the filter
+ * is linearly interpolated between the two nearest table rows.
+ */
+static const float* GetFilter(const QResampler* resampler, int phase) {
+  const int num_taps = resampler->num_taps;
+  if (resampler->table_phases == resampler->factor_denominator) {
+    return resampler->filters + phase * num_taps;
+  }
+  /* Position in the table is phase * table_phases / factor_denominator. */
+  const float position = phase * resampler->table_step;
+  int row = (int)position;
+  if (row >= resampler->table_phases) { row = resampler->table_phases - 1; }
+  const float frac = position - row;
+  const float* row0 = resampler->filters + row * num_taps;
+  const float* row1 = row0 + num_taps;
+  float* filter = resampler->interpolated_filter;
+  InterpolateFilter(row0, row1, frac, num_taps, filter);
+  return filter;
+}
+
 int QResamplerProcessSamples(QResampler* resampler, const float* input,
                              int num_input_frames) {
+  return QResamplerProcessSamplesToBuffer(resampler, input, num_input_frames,
+                                          resampler->output);
+}
+
+int QResamplerProcessSamplesToBuffer(QResampler* resampler, const float* input,
+                                     int num_input_frames, float* output) {
   assert(resampler != NULL);
   assert(input != NULL);
+  assert(output != NULL);
   assert(num_input_frames >= 0);
-  assert(resampler->delayed_input_frames < resampler->num_taps);
+  assert(resampler->delayed_input_frames < resampler->taps_capacity);
   assert(resampler->phase < resampler->factor_denominator);
   float* delayed_input = resampler->delayed_input;
   const int num_taps = resampler->num_taps;
@@ -289,11 +874,9 @@ int QResamplerProcessSamples(QResampler* resampler, const float* input,
     return 0; /* Not enough frames available to produce any output yet. */
   }
 
-  float* output = resampler->output;
   const int num_output_frames =
       QResamplerNextNumOutputFrames(resampler, num_input_frames);
 
-  const float* filters = resampler->filters;
   const int factor_denominator = resampler->factor_denominator;
   const int factor_floor = resampler->factor_floor;
   const int phase_step = resampler->phase_step;
@@ -316,28 +899,26 @@ int QResamplerProcessSamples(QResampler* resampler, const float* input,
   /* Process samples where the filter straddles delayed_input and input. */
   while (i < resampler->delayed_input_frames && i < i_end) {
     assert(num_written < num_output_frames);
-    const int num_state = resampler->delayed_input_frames - i;
+    /* After QResamplerReconfigure() shortens the filters, the filter may be
+     * entirely within delayed_input.
+     */
+    const int num_state = (resampler->delayed_input_frames - i < num_taps)
+        ? resampler->delayed_input_frames - i : num_taps;
     const int num_input = num_taps - num_state;
-    const float* filter = filters + phase * num_taps;
+    const float* filter = GetFilter(resampler, phase);
 
+    /* Compute the dot product between `filter` and the concatenation of
+     * `delayed_input[i:]` and `input[:num_input]` for each channel.
+     */
     int c;
     for (c = 0; c < num_channels; ++c) {
-      float sum = 0.0f;
-
-      int k;
-      int offset = i * num_channels + c;
-      /* Compute the dot product between `filter` and the concatenation of
-       * `delayed_input[i:]` and `input[:num_input]`.
-       */
-      for (k = 0; k < num_state; ++k, offset += num_channels) {
-        sum += filter[k] * delayed_input[offset];
-      }
-      for (k = 0, offset = c; k < num_input; ++k, offset += num_channels) {
-        sum += filter[num_state + k] * input[offset];
-      }
-
-      output[c] = sum;
+      output[c] = 0.0f;
     }
+    AccumulateMultichannelDotProducts(filter, num_state,
+                                      delayed_input + i * num_channels,
+                                      num_channels, output);
+    AccumulateMultichannelDotProducts(filter + num_state, num_input, input,
+                                      num_channels, output);
 
     output += num_channels;
     ++num_written;
@@ -373,18 +954,12 @@ int QResamplerProcessSamples(QResampler* resampler, const float* input,
   i_end -= resampler->delayed_input_frames;
 
   if (num_channels == 1) {
-    /* Specialization for num_channels == 1. Improves benchmark by 10%. */
+    /* Specialization for num_channels == 1. */
     int count = 0;
     while (i < i_end) {
       assert(num_written < num_output_frames);
-      const float* filter = filters + phase * num_taps;
-
-      float sum = 0.0f;
-      int k;
-      for (k = 0; k < num_taps; ++k) {
-        sum += filter[k] * input[i + k];
-      }
-      output[count] = sum;
+      const float* filter = GetFilter(resampler, phase);
+      output[count] = MonoDotProduct(filter, input + i, num_taps);
       ++count;
 
       i += factor_floor;
@@ -398,20 +973,15 @@ int QResamplerProcessSamples(QResampler* resampler, const float* input,
   } else { /* General implementation for arbitrary num_channels. */
     while (i < i_end) {
       assert(num_written < num_output_frames);
-      const float* filter = filters + phase * num_taps;
+      const float* filter = GetFilter(resampler, phase);
 
       int c;
       for (c = 0; c < num_channels; ++c) {
-        float sum = 0.0f;
-
-        int k;
-        int offset = i * num_channels + c;
-        for (k = 0; k < num_taps; ++k, offset += num_channels) {
-          sum += filter[k] * input[offset];
-        }
-
-        output[c] = sum;
+        output[c] = 0.0f;
       }
+      AccumulateMultichannelDotProducts(filter, num_taps,
+                                        input + i * num_channels,
+                                        num_channels, output);
       output += num_channels;
 
       ++num_written;
@@ -70,6 +70,9 @@
 #ifndef AUDIO_TO_TACTILE_SRC_DSP_Q_RESAMPLER_H_
 #define AUDIO_TO_TACTILE_SRC_DSP_Q_RESAMPLER_H_
 
+#include <stddef.h>
+
+#include "dsp/memory_usage.h"
 #include "dsp/number_util.h"
 
 #ifdef __cplusplus
@@ -79,6 +82,18 @@ extern "C" {
 struct QResampler; /* Forward declaration. */
 typedef struct QResampler QResampler;
 
+/* Cache of polyphase filters, which resamplers made with the same sample rates
+ * and filter options may share to save memory and the cost of designing the
+ * filters again. The cache is owned by the caller; there is no global state.
+ *
+ * NOTE: The cache is not thread safe. Resamplers using the same cache should
+ * be made, reconfigured, and freed from one thread at a time, though they may
+ * then process samples concurrently. Code running on worker threads should use
+ * its own cache, or none.
+ */
+struct QResamplerFilterCache; /* Forward declaration. */
+typedef struct QResamplerFilterCache QResamplerFilterCache;
+
 /* Detail options for QResampler. */
 typedef struct {
   /* `max_denominator` determines the max allowed denominator b in approximating
@@ -130,18 +145,53 @@ typedef struct {
    *   7.865            -80 dB
    */
   float kaiser_beta;
+  /* If positive, bounds the memory for filters. When the denominator b exceeds
+   * `kernel_table_phases`, the resampler stores the kernel sampled at
+   * `kernel_table_phases + 1` evenly-spaced phases instead of b phases, and
+   * linearly interpolates the filter for each output sample. Memory is then
+   * independent of max_denominator, at the cost of computing the filter per
+   * output sample and a small interpolation error. This is useful for
+   * arbitrary factors like clock drift correction, where b is large.
+   *
+   * Measured with default options resampling uniform random input in
+   * [-0.5, 0.5] from 16000 to 15990 Hz, for which b = 1000 and the filters
+   * have 13 taps:
+   *
+   *   kernel_table_phases      Max error   Filter memory (floats)
+   *   0 (disabled)             0           13000
+   *   16                       1.2e-3      221
+   *   32                       4.5e-4      429
+   *   128                      1.7e-4      1677
+   *
+   * The error decreases more slowly than quadratically, since the kernel has
+   * a small discontinuity at the edge of its support.
+   *
+   * Computing the filter costs about 1.7x time for mono resampling and a few
+   * percent for 12 channels, see the BM_Resample*DriftInterpolated* benchmarks
+   * in extras/benchmark/q_resampler_benchmark.cpp. The default is 0, disabled.
+   */
+  int kernel_table_phases;
+  /* Filter cache to share filters through, or NULL to not share filters. The
+   * cache must outlive the resamplers using it. The default is NULL.
+   */
+  QResamplerFilterCache* filter_cache;
 } QResamplerOptions;
 extern const QResamplerOptions kQResamplerDefaultOptions;
 
 /* Makes a QResampler. The caller should free it when done with
  * `QResamplerFree()`.
  *
+ * If options->filter_cache is set, the polyphase filters are taken from that
+ * cache, otherwise they are computed into the resampler's own allocation.
+ *
  * The resampling factor input_sample_rate_hz / output_sample_rate_hz
  * is approximated by a rational factor a/b where 0 < b <= max_denominator.
  *
  * `num_channels` is the number of channels. For instance, num_channels = 2 to
  * resample a stereo audio signal. The implementation supports an arbitrary
  * number of channels with an optimized specialization for num_channels = 1.
+ * With multiple channels, each output frame is computed four channels at a
+ * time in SIMD lanes (see dsp/simd.h).
  *
  * `max_input_frames` arg is the max number of input frames that will be passed
  * per call to `QResamplerProcessSamples()`.
@@ -158,6 +208,95 @@ QResampler* QResamplerMake(float input_sample_rate_hz,
 /* Frees a QResampler. */
 void QResamplerFree(QResampler* resampler);
 
+/* Makes an empty QResamplerFilterCache. Returns NULL on allocation failure. */
+QResamplerFilterCache* QResamplerFilterCacheMake(void);
+
+/* Frees a QResamplerFilterCache. All resamplers using it must be freed first. */
+void QResamplerFilterCacheFree(QResamplerFilterCache* cache);
+
+/* Gets the number of distinct filter tables currently in `cache`, for
+ * diagnostics and testing.
+ */
+int QResamplerFilterCacheSize(const QResamplerFilterCache* cache);
+
+/* Same as QResamplerMake(), but with buffers sized so that
+ * QResamplerReconfigure() can switch to any sample rates whose factor
+ * input_sample_rate_hz / output_sample_rate_hz is within
+ * [min_factor, max_factor]. The initial factor must be within this range.
+ * For instance, use min_factor = 44100.0f / 16000, max_factor = 48000.0f /
+ * 16000 to switch between 44.1 kHz and 48 kHz input devices, or a range of
+ * +/-1% around the nominal factor for clock drift compensation.
+ */
+QResampler* QResamplerMakeReconfigurable(float input_sample_rate_hz,
+                                         float output_sample_rate_hz,
+                                         float min_factor,
+                                         float max_factor,
+                                         int num_channels,
+                                         int max_input_frames,
+                                         const QResamplerOptions* options);
+
+/* Switches `resampler` to new sample rates in place, keeping the number of
+ * channels, max_input_frames, and options. Unlike freeing and making a new
+ * resampler, this reuses the existing buffers and preserves the delayed input,
+ * so that output continues smoothly across the switch. The output timeline
+ * stays aligned with input arriving at the new input sample rate. Outputs in
+ * the first filter radius after the switch also depend on delayed input
+ * sampled at the old rate, which is slightly time warped if the input rate
+ * changed, and if the new filters are longer, the history that the outermost
+ * taps would reach is zero. The position of the next output is rounded to the
+ * nearest of the new configuration's factor_denominator phases, e.g. to a
+ * whole input frame for a factor of 3 with factor_denominator 1.
+ *
+ * With a filter cache, the new filters are taken from the cache. The switch
+ * does not allocate if another resampler currently uses filters for the new
+ * configuration; otherwise they are designed and added to the cache. The
+ * cache's thread restrictions apply. Without a cache, the new filters are
+ * computed into the resampler's buffer if they fit, otherwise into a new heap
+ * allocation.
+ *
+ * Returns 1 on success. Returns 0 if the args are invalid or the new
+ * configuration doesn't fit in the buffers, in which case the resampler is
+ * unchanged. Resamplers from QResamplerMake() and QResamplerInitInBuffer()
+ * have buffers sized for their initial configuration, so use
+ * QResamplerMakeReconfigurable() to switch to a larger one.
+ *
+ * NOTE: QResamplerMaxOutputFrames() and QResamplerFlushFrames() may change
+ * after reconfiguration.
+ */
+int /*bool*/ QResamplerReconfigure(QResampler* resampler,
+                                   float input_sample_rate_hz,
+                                   float output_sample_rate_hz);
+
+/* Gets the buffer size in bytes needed by QResamplerInitInBuffer(), or 0 if
+ * the args are invalid.
+ */
+size_t QResamplerRequiredBytes(float input_sample_rate_hz,
+                               float output_sample_rate_hz,
+                               int num_channels,
+                               int max_input_frames,
+                               const QResamplerOptions* options);
+
+/* Same as QResamplerMake(), but lays out the resampler in a caller-provided
+ * `buffer` of `buffer_size` bytes instead of allocating, see dsp/arena.h. The
+ * filters are computed into the buffer; options->filter_cache is ignored.
+ * The buffer must be at least QResamplerRequiredBytes() bytes and outlive the
+ * resampler. QResamplerFree() may be called on the result, but does not free
+ * the buffer. Returns NULL on failure.
+ */
+QResampler* QResamplerInitInBuffer(void* buffer,
+                                   size_t buffer_size,
+                                   float input_sample_rate_hz,
+                                   float output_sample_rate_hz,
+                                   int num_channels,
+                                   int max_input_frames,
+                                   const QResamplerOptions* options);
+
+/* Gets the memory used by `resampler`, see dsp/memory_usage.h. Filters shared
+ * through the cache are counted in full as heap bytes, including the cache
+ * entry, though other resamplers may share them.
+ */
+void QResamplerMemoryUsage(const QResampler* resampler, MemoryUsage* usage);
+
 /* Resets to initial state. */
 void QResamplerReset(QResampler* resampler);
 
@@ -184,6 +323,14 @@ void QResamplerReset(QResampler* resampler);
 int QResamplerProcessSamples(QResampler* resampler, const float* input,
                              int num_input_frames);
 
+/* Same as QResamplerProcessSamples(), but writes the output to a
+ * caller-provided `output` buffer instead of the resampler's own, e.g. to
+ * resample directly into the input buffer of the next processing stage.
+ * `output` must have space for QResamplerNextNumOutputFrames() frames.
+ */
+int QResamplerProcessSamplesToBuffer(QResampler* resampler, const float* input,
+                                     int num_input_frames, float* output);
+
 /* Gets the resampled output buffer. */
 float* QResamplerOutput(const QResampler* resampler);
 
@@ -213,6 +360,17 @@ void QResamplerGetRationalFactor(const QResampler* resampler,
 int QResamplerNextNumOutputFrames(const QResampler* resampler,
                                   int num_input_frames);
 
+/* Gets the largest number of input frames for which the next call to
+ * ProcessSamples() produces at most `num_output_frames` output frames,
+ * according to the current resampler state. This is useful to fill an output
+ * buffer of fixed size exactly. When downsampling, the result is at least 1 if
+ * `num_output_frames` is positive. When upsampling, one input frame may produce
+ * several output frames, and the result is 0 if even one would produce more
+ * than `num_output_frames`.
+ */
+int QResamplerMaxInputFramesForOutput(const QResampler* resampler,
+                                      int num_output_frames);
+
 /* Gets a number of zero-valued input frames guaranteed to flush the resampler.
  * Calling ProcessSamples() on FlushFrames() number of zero-valued input frames
  * extracts all the nonzero output samples.
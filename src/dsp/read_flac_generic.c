@@ -0,0 +1,566 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * For details on the FLAC format, see https://xiph.org/flac/format.html.
+ */
+
+#include "dsp/read_flac_generic.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "dsp/logging.h"
+
+/* Size of the buffer of bytes read from the WavReader. */
+#define kFlacReadBufferSize 4096
+#define kFlacMaxBitDepth 24
+#define kFlacMaxLpcOrder 32
+#define kFlacStreamInfoType 0
+#define kFlacStreamInfoSize 34
+#define kFlacFrameSync 0x3ffe
+
+/* Channel assignments for stereo decorrelation. */
+enum {
+  kFlacLeftSide = 8,
+  kFlacRightSide = 9,
+  kFlacMidSide = 10,
+};
+
+struct FlacDecoder {
+  WavReader* w;
+  int num_channels;
+  int bit_depth;
+  int max_block_size;
+
+  /* Bytes read from `w`, of which `buffer[pos]` is the next unread byte. */
+  uint8_t buffer[kFlacReadBufferSize];
+  size_t size;
+  size_t pos;
+  /* Bit cache holding the low `cache_bits` bits of `cache`, the next bits to
+   * read. Bytes are moved to the cache only as needed, so that `cache_bits` is
+   * less than 8 between reads and zero at byte-aligned positions.
+   */
+  uint64_t cache;
+  int cache_bits;
+  /* Set on reading past the end of the input. */
+  int /*bool*/ end_of_input;
+
+  /* CRCs of the current frame, updated over buffer[crc_start, pos). */
+  size_t crc_start;
+  uint8_t crc8;
+  uint16_t crc16;
+
+  /* Decoded block of `block_size` frames, in channel-major order with a
+   * stride of max_block_size. Frames before `block_pos` have been read.
+   */
+  int32_t* block;
+  int block_size;
+  int block_pos;
+};
+
+static void UpdateCrcs(FlacDecoder* decoder, size_t end) {
+  uint8_t crc8 = decoder->crc8;
+  uint16_t crc16 = decoder->crc16;
+  size_t i;
+  for (i = decoder->crc_start; i < end; ++i) {
+    const uint8_t byte = decoder->buffer[i];
+    int bit;
+    /* CRC-8 with polynomial x^8 + x^2 + x + 1. */
+    crc8 ^= byte;
+    for (bit = 0; bit < 8; ++bit) {
+      crc8 = (uint8_t)((crc8 & 0x80) ? (crc8 << 1) ^ 0x07 : crc8 << 1);
+    }
+    /* CRC-16 with polynomial x^16 + x^15 + x^2 + 1. */
+    crc16 ^= (uint16_t)(byte << 8);
+    for (bit = 0; bit < 8; ++bit) {
+      crc16 = (uint16_t)((crc16 & 0x8000) ? (crc16 << 1) ^ 0x8005
+                                          : crc16 << 1);
+    }
+  }
+  decoder->crc8 = crc8;
+  decoder->crc16 = crc16;
+  decoder->crc_start = end;
+}
+
+/* Starts computing the CRCs at the current position, which must be byte
+ * aligned.
+ */
+static void ResetCrcs(FlacDecoder* decoder) {
+  decoder->crc_start = decoder->pos;
+  decoder->crc8 = 0;
+  decoder->crc16 = 0;
+}
+
+/* Refills the buffer if it is fully read. Returns 0 at the end of input. */
+static int /*bool*/ FillBuffer(FlacDecoder* decoder) {
+  if (decoder->pos < decoder->size) { return 1; }
+  UpdateCrcs(decoder, decoder->size);
+  WavReader* w = decoder->w;
+  decoder->size = w->read_fun(decoder->buffer, kFlacReadBufferSize, w->io_ptr);
+  decoder->pos = 0;
+  decoder->crc_start = 0;
+  if (decoder->size == 0) {
+    decoder->end_of_input = 1;
+    return 0;
+  }
+  return 1;
+}
+
+/* Moves one byte into the bit cache. Returns 0 at the end of input. */
+static int /*bool*/ CacheByte(FlacDecoder* decoder) {
+  if (!FillBuffer(decoder)) { return 0; }
+  decoder->cache = (decoder->cache << 8) | decoder->buffer[decoder->pos++];
+  decoder->cache_bits += 8;
+  return 1;
+}
+
+/* Reads an unsigned `num_bits`-bit value, 0 <= num_bits <= 32. */
+static uint32_t ReadBits(FlacDecoder* decoder, int num_bits) {
+  while (decoder->cache_bits < num_bits) {
+    if (!CacheByte(decoder)) { return 0; }
+  }
+  decoder->cache_bits -= num_bits;
+  return (uint32_t)((decoder->cache >> decoder->cache_bits) &
+                    ((UINT64_C(1) << num_bits) - 1));
+}
+
+/* Reads a two's complement `num_bits`-bit value, 0 <= num_bits <= 32. */
+static int32_t ReadSignedBits(FlacDecoder* decoder, int num_bits) {
+  if (num_bits == 0) { return 0; }
+  const uint32_t value = ReadBits(decoder, num_bits);
+  const uint32_t sign_bit = UINT32_C(1) << (num_bits - 1);
+  return (int32_t)((int64_t)(value ^ sign_bit) - (int64_t)sign_bit);
+}
+
+/* Reads a unary-coded value, the number of 0 bits before a 1 bit. */
+static uint32_t ReadUnary(FlacDecoder* decoder) {
+  uint32_t count = 0;
+  for (;;) {
+    if (decoder->cache_bits == 0 && !CacheByte(decoder)) { return 0; }
+    /* Left-align the cached bits, dropping the already-read bits above. */
+    uint64_t bits = decoder->cache << (64 - decoder->cache_bits);
+    if (bits == 0) {
+      count += decoder->cache_bits;
+      decoder->cache_bits = 0;
+    } else {
+      int num_zeros = 0;
+      while (!(bits >> 63)) {
+        bits <<= 1;
+        ++num_zeros;
+      }
+      decoder->cache_bits -= num_zeros + 1;
+      return count + num_zeros;
+    }
+  }
+}
+
+/* Skips to the next byte boundary. */
+static void AlignToByte(FlacDecoder* decoder) {
+  decoder->cache_bits = 0;
+}
+
+/* Skips `num_bytes` bytes at a byte-aligned position. */
+static void SkipBytes(FlacDecoder* decoder, size_t num_bytes) {
+  while (num_bytes > 0 && FillBuffer(decoder)) {
+    size_t n = decoder->size - decoder->pos;
+    if (n > num_bytes) { n = num_bytes; }
+    decoder->pos += n;
+    num_bytes -= n;
+  }
+}
+
+/* Reads the "fLaC" marker and the metadata blocks up to the first frame. */
+static int /*bool*/ ReadMetadata(FlacDecoder* decoder, ReadWavInfo* info) {
+  if (ReadBits(decoder, 32) != 0x664c6143 /* "fLaC" */) {
+    LOG_ERROR("Error: Not a FLAC file.\n");
+    return 0;
+  }
+
+  uint64_t total_frames = 0;
+  int sample_rate_hz = 0;
+  int have_stream_info = 0;
+  int is_last;
+  do {
+    is_last = ReadBits(decoder, 1);
+    const int type = ReadBits(decoder, 7);
+    const uint32_t size = ReadBits(decoder, 24);
+    if (decoder->end_of_input) { break; }
+
+    if (type == kFlacStreamInfoType && size == kFlacStreamInfoSize) {
+      ReadBits(decoder, 16);  /* Min block size. */
+      decoder->max_block_size = ReadBits(decoder, 16);
+      ReadBits(decoder, 24);  /* Min frame size. */
+      ReadBits(decoder, 24);  /* Max frame size. */
+      sample_rate_hz = ReadBits(decoder, 20);
+      decoder->num_channels = ReadBits(decoder, 3) + 1;
+      decoder->bit_depth = ReadBits(decoder, 5) + 1;
+      total_frames = (uint64_t)ReadBits(decoder, 4) << 32;
+      total_frames |= ReadBits(decoder, 32);
+      SkipBytes(decoder, 16);  /* MD5 signature. */
+      have_stream_info = 1;
+    } else {
+      SkipBytes(decoder, size);
+    }
+  } while (!is_last);
+
+  if (decoder->end_of_input || !have_stream_info) {
+    LOG_ERROR("Error: Invalid FLAC header.\n");
+    return 0;
+  } else if (decoder->bit_depth < 4 ||
+             decoder->bit_depth > kFlacMaxBitDepth) {
+    LOG_ERROR("Error: Unsupported FLAC bit depth: %d\n", decoder->bit_depth);
+    return 0;
+  } else if (decoder->max_block_size < 16 || sample_rate_hz == 0) {
+    LOG_ERROR("Error: Invalid FLAC header.\n");
+    return 0;
+  } else if (total_frames == 0) {
+    LOG_ERROR("Error: FLAC files of unknown length are unsupported.\n");
+    return 0;
+  } else if (total_frames > SIZE_MAX / decoder->num_channels) {
+    LOG_ERROR("Error: FLAC file is too long.\n");
+    return 0;
+  }
+
+  info->num_channels = decoder->num_channels;
+  info->sample_rate_hz = sample_rate_hz;
+  info->remaining_samples = (size_t)total_frames * decoder->num_channels;
+  info->bit_depth = decoder->bit_depth;
+  info->destination_alignment_bytes = 4;
+  info->encoding = kFlacEncoding;
+  info->sample_format = kFloat;
+  return 1;
+}
+
+FlacDecoder* FlacDecoderOpenGeneric(WavReader* w, ReadWavInfo* info) {
+  if (w == NULL || info == NULL) { return NULL; }
+  FlacDecoder* decoder = (FlacDecoder*)malloc(sizeof(FlacDecoder));
+  if (decoder == NULL) {
+    LOG_ERROR("Error: Failed to allocate memory\n");
+    return NULL;
+  }
+  decoder->w = w;
+  decoder->size = 0;
+  decoder->pos = 0;
+  decoder->cache = 0;
+  decoder->cache_bits = 0;
+  decoder->end_of_input = 0;
+  decoder->block = NULL;
+  decoder->block_size = 0;
+  decoder->block_pos = 0;
+  ResetCrcs(decoder);
+
+  if (!ReadMetadata(decoder, info)) { goto fail; }
+  decoder->block = (int32_t*)malloc(
+      sizeof(int32_t) * decoder->max_block_size * decoder->num_channels);
+  if (decoder->block == NULL) {
+    LOG_ERROR("Error: Failed to allocate memory\n");
+    goto fail;
+  }
+  return decoder;
+
+fail:
+  FlacDecoderClose(decoder);
+  return NULL;
+}
+
+void FlacDecoderClose(FlacDecoder* decoder) {
+  if (decoder == NULL) { return; }
+  free(decoder->block);
+  free(decoder);
+}
+
+/* Reads a frame header, setting `block_size`. Returns the channel assignment
+ * on success, or -1 on failure.
+ */
+static int ReadFrameHeader(FlacDecoder* decoder) {
+  ResetCrcs(decoder);
+  if (ReadBits(decoder, 14) != kFlacFrameSync || ReadBits(decoder, 1) != 0) {
+    return -1;
+  }
+  ReadBits(decoder, 1);  /* Blocking strategy. */
+  const int block_size_code = ReadBits(decoder, 4);
+  const int sample_rate_code = ReadBits(decoder, 4);
+  const int channel_assignment = ReadBits(decoder, 4);
+  const int sample_size_code = ReadBits(decoder, 3);
+  if (ReadBits(decoder, 1) != 0) { return -1; }
+
+  /* Skip the frame or sample number, coded like UTF-8 in up to 7 bytes. */
+  const uint32_t first_byte = ReadBits(decoder, 8);
+  int num_leading_ones = 0;
+  while (num_leading_ones < 8 && (first_byte & (0x80 >> num_leading_ones))) {
+    ++num_leading_ones;
+  }
+  if (num_leading_ones == 1 || num_leading_ones == 8) { return -1; }
+  /* The count of leading ones includes the first byte. */
+  for (; num_leading_ones > 1; --num_leading_ones) {
+    if ((ReadBits(decoder, 8) & 0xc0) != 0x80) { return -1; }
+  }
+
+  if (block_size_code == 0) {
+    return -1;
+  } else if (block_size_code == 1) {
+    decoder->block_size = 192;
+  } else if (block_size_code <= 5) {
+    decoder->block_size = 576 << (block_size_code - 2);
+  } else if (block_size_code == 6) {
+    decoder->block_size = ReadBits(decoder, 8) + 1;
+  } else if (block_size_code == 7) {
+    decoder->block_size = ReadBits(decoder, 16) + 1;
+  } else {
+    decoder->block_size = 256 << (block_size_code - 8);
+  }
+  /* Skip the sample rate, which the stream info already gives. */
+  if (sample_rate_code == 12) {
+    ReadBits(decoder, 8);
+  } else if (sample_rate_code == 13 || sample_rate_code == 14) {
+    ReadBits(decoder, 16);
+  } else if (sample_rate_code == 15) {
+    return -1;
+  }
+
+  UpdateCrcs(decoder, decoder->pos);
+  const uint8_t crc8 = decoder->crc8;
+  if (ReadBits(decoder, 8) != crc8 || decoder->end_of_input) { return -1; }
+
+  static const int kSampleSizes[8] = {0, 8, 12, -1, 16, 20, 24, -1};
+  const int num_channels =
+      (channel_assignment < kFlacLeftSide) ? channel_assignment + 1 : 2;
+  if (decoder->block_size > decoder->max_block_size ||
+      channel_assignment > kFlacMidSide ||
+      num_channels != decoder->num_channels ||
+      (sample_size_code != 0 &&
+       kSampleSizes[sample_size_code] != decoder->bit_depth)) {
+    return -1;
+  }
+  return channel_assignment;
+}
+
+/* Decodes the Rice-coded residual of a subframe with predictor order `order`
+ * to `residual[order]` to `residual[block_size - 1]`.
+ */
+static int /*bool*/ ReadResidual(FlacDecoder* decoder, int order,
+                                 int32_t* residual) {
+  const int method = ReadBits(decoder, 2);
+  if (method > 1) { return 0; }
+  const int param_bits = method ? 5 : 4;
+  const int escape_code = (1 << param_bits) - 1;
+  const int partition_order = ReadBits(decoder, 4);
+  const int partition_size = decoder->block_size >> partition_order;
+  if ((partition_size << partition_order) != decoder->block_size ||
+      partition_size < order) {
+    return 0;
+  }
+
+  int i = order;
+  int partition;
+  for (partition = 0; partition < (1 << partition_order); ++partition) {
+    const int end = (partition + 1) * partition_size;
+    const int param = ReadBits(decoder, param_bits);
+    if (param == escape_code) {  /* Unencoded binary values. */
+      const int num_bits = ReadBits(decoder, 5);
+      for (; i < end; ++i) {
+        residual[i] = ReadSignedBits(decoder, num_bits);
+      }
+    } else {
+      for (; i < end; ++i) {
+        const uint64_t value = ((uint64_t)ReadUnary(decoder) << param) |
+                               ReadBits(decoder, param);
+        if (value >> 32) { return 0; }  /* Overflow. */
+        /* Map the zigzag code 0, 1, 2, 3, ... to 0, -1, 1, -2, .... */
+        residual[i] = (int32_t)(value >> 1) ^ -(int32_t)(value & 1);
+      }
+    }
+    if (decoder->end_of_input) { return 0; }
+  }
+  return 1;
+}
+
+/* Decodes a subframe of `bit_depth`-bit samples to `output`. */
+static int /*bool*/ ReadSubframe(FlacDecoder* decoder, int bit_depth,
+                                 int32_t* output) {
+  const int block_size = decoder->block_size;
+  if (ReadBits(decoder, 1) != 0) { return 0; }
+  const int type = ReadBits(decoder, 6);
+  int wasted_bits = 0;
+  if (ReadBits(decoder, 1)) {
+    wasted_bits = ReadUnary(decoder) + 1;
+    if (wasted_bits >= bit_depth) { return 0; }
+    bit_depth -= wasted_bits;
+  }
+
+  int i;
+  if (type == 0) {  /* Constant. */
+    const int32_t value = ReadSignedBits(decoder, bit_depth);
+    for (i = 0; i < block_size; ++i) {
+      output[i] = value;
+    }
+  } else if (type == 1) {  /* Verbatim. */
+    for (i = 0; i < block_size; ++i) {
+      output[i] = ReadSignedBits(decoder, bit_depth);
+    }
+  } else if (8 <= type && type <= 12) {  /* Fixed predictor. */
+    const int order = type - 8;
+    if (order > block_size) { return 0; }
+    for (i = 0; i < order; ++i) {
+      output[i] = ReadSignedBits(decoder, bit_depth);
+    }
+    if (!ReadResidual(decoder, order, output)) { return 0; }
+    /* Add the prediction, a polynomial extrapolation of the previous samples,
+     * computed in 64 bits in case the stream is corrupt.
+     */
+    for (i = order; i < block_size; ++i) {
+      int64_t prediction = 0;
+      switch (order) {
+        case 1:
+          prediction = output[i - 1];
+          break;
+        case 2:
+          prediction = 2 * (int64_t)output[i - 1] - output[i - 2];
+          break;
+        case 3:
+          prediction = 3 * ((int64_t)output[i - 1] - output[i - 2]) +
+                       output[i - 3];
+          break;
+        case 4:
+          prediction = 4 * ((int64_t)output[i - 1] + output[i - 3]) -
+                       6 * (int64_t)output[i - 2] - output[i - 4];
+          break;
+      }
+      output[i] = (int32_t)(prediction + output[i]);
+    }
+  } else if (32 <= type) {  /* Linear predictive coding (LPC). */
+    const int order = type - 31;
+    if (order > block_size) { return 0; }
+    for (i = 0; i < order; ++i) {
+      output[i] = ReadSignedBits(decoder, bit_depth);
+    }
+    const int precision = ReadBits(decoder, 4) + 1;
+    const int shift = ReadSignedBits(decoder, 5);
+    if (precision == 16 || shift < 0) { return 0; }
+    int32_t coeffs[kFlacMaxLpcOrder];
+    int k;
+    for (k = 0; k < order; ++k) {
+      coeffs[k] = ReadSignedBits(decoder, precision);
+    }
+    if (!ReadResidual(decoder, order, output)) { return 0; }
+    for (i = order; i < block_size; ++i) {
+      const int32_t* history = output + i;
+      int64_t sum = 0;
+      for (k = 0; k < order; ++k) {
+        sum += (int64_t)coeffs[k] * history[-1 - k];
+      }
+      output[i] = (int32_t)((sum >> shift) + output[i]);
+    }
+  } else {
+    return 0;  /* Reserved subframe type. */
+  }
+
+  if (wasted_bits) {
+    for (i = 0; i < block_size; ++i) {
+      output[i] = (int32_t)((uint32_t)output[i] << wasted_bits);
+    }
+  }
+  return !decoder->end_of_input;
+}
+
+/* Decodes the next frame into `block`. Returns 0 at the end of the input or on
+ * error.
+ */
+static int /*bool*/ ReadFrame(FlacDecoder* decoder) {
+  decoder->block_size = 0;
+  decoder->block_pos = 0;
+  const int channel_assignment = ReadFrameHeader(decoder);
+  if (channel_assignment < 0) { return 0; }
+
+  const int stride = decoder->max_block_size;
+  int c;
+  for (c = 0; c < decoder->num_channels; ++c) {
+    /* The side channel of stereo decorrelation has one more bit. */
+    const int is_side =
+        (channel_assignment == kFlacRightSide) ? (c == 0)
+        : (channel_assignment >= kFlacLeftSide) ? (c == 1) : 0;
+    if (!ReadSubframe(decoder, decoder->bit_depth + is_side,
+                      decoder->block + c * stride)) {
+      decoder->block_size = 0;
+      return 0;
+    }
+  }
+
+  /* The footer has zero padding to a byte boundary and a CRC-16. */
+  AlignToByte(decoder);
+  UpdateCrcs(decoder, decoder->pos);
+  const uint16_t crc16 = decoder->crc16;
+  if (ReadBits(decoder, 16) != crc16 || decoder->end_of_input) {
+    decoder->block_size = 0;
+    return 0;
+  }
+
+  if (channel_assignment >= kFlacLeftSide) {
+    int32_t* left = decoder->block;
+    int32_t* right = decoder->block + stride;
+    int i;
+    for (i = 0; i < decoder->block_size; ++i) {
+      if (channel_assignment == kFlacLeftSide) {
+        right[i] = left[i] - right[i];
+      } else if (channel_assignment == kFlacRightSide) {
+        left[i] += right[i];
+      } else {  /* Mid-side. Recover the mid channel's dropped low bit. */
+        const int32_t side = right[i];
+        const int32_t mid = (int32_t)((uint32_t)left[i] << 1) | (side & 1);
+        left[i] = (mid + side) >> 1;
+        right[i] = (mid - side) >> 1;
+      }
+    }
+  }
+  return 1;
+}
+
+size_t ReadFlacFloatSamplesGeneric(FlacDecoder* decoder, ReadWavInfo* info,
+                                   float* samples, size_t num_samples) {
+  const int num_channels = decoder->num_channels;
+  const int stride = decoder->max_block_size;
+  const float scale = 1.0f / (1 << (decoder->bit_depth - 1));
+  if (num_samples > info->remaining_samples) {
+    num_samples = info->remaining_samples;
+  }
+  size_t num_frames = num_samples / num_channels;
+  size_t num_read = 0;
+
+  while (num_frames > 0) {
+    if (decoder->block_pos == decoder->block_size && !ReadFrame(decoder)) {
+      LOG_ERROR("Error: FLAC file %s.\n", decoder->end_of_input
+                ? "ended unexpectedly" : "is corrupt");
+      info->remaining_samples = 0;
+      break;
+    }
+    size_t n = decoder->block_size - decoder->block_pos;
+    if (n > num_frames) { n = num_frames; }
+    const int32_t* src = decoder->block + decoder->block_pos;
+    size_t i;
+    for (i = 0; i < n; ++i, ++src) {
+      int c;
+      for (c = 0; c < num_channels; ++c) {
+        *samples++ = scale * src[c * stride];
+      }
+    }
+    decoder->block_pos += (int)n;
+    num_frames -= n;
+    num_read += n * num_channels;
+    info->remaining_samples -= n * num_channels;
+  }
+  return num_read;
+}
@@ -0,0 +1,79 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * Streaming FLAC decoder reading through WavReader IO callbacks.
+ *
+ * FLAC losslessly compresses audio to about half the size of a WAV file, so
+ * that reading corpora stored as FLAC needs about half the I/O. This decoder
+ * reads FLAC with the same IO callbacks as the WAV reader (see
+ * read_wav_file_generic.h) and decodes one frame at a time, so memory use is
+ * constant regardless of the file length. It supports the features of FLAC
+ * written by common encoders: fixed and LPC subframes, stereo decorrelation,
+ * and bit depths up to 24 bits. Frame CRCs are checked.
+ *
+ * Usually, don't use this file directly: ReadWavStreamOpen() in
+ * read_wav_stream.h detects FLAC files and decodes them with this decoder.
+ *
+ * Example use:
+ *   ReadWavInfo info;
+ *   FlacDecoder* decoder = FlacDecoderOpenGeneric(&w, &info);
+ *   if (decoder == NULL) { ... }
+ *   float buffer[kBufferSize];
+ *   size_t num_read;
+ *   while ((num_read = ReadFlacFloatSamplesGeneric(
+ *               decoder, &info, buffer, kBufferSize)) > 0) {
+ *     // Process num_read interleaved samples.
+ *   }
+ *   FlacDecoderClose(decoder);
+ */
+
+#ifndef AUDIO_TO_TACTILE_SRC_DSP_READ_FLAC_GENERIC_H_
+#define AUDIO_TO_TACTILE_SRC_DSP_READ_FLAC_GENERIC_H_
+
+#include <stddef.h>
+
+#include "dsp/read_wav_file_generic.h"
+#include "dsp/read_wav_info.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct FlacDecoder FlacDecoder;
+
+/* Reads the FLAC stream header and metadata from `w`, filling the fields of
+ * `info`. `info->encoding` is set to kFlacEncoding and `info->bit_depth` to
+ * the encoded bit depth. `w` must remain valid until FlacDecoderClose().
+ * Returns NULL on failure, including for FLAC files whose header doesn't give
+ * the number of samples.
+ */
+FlacDecoder* FlacDecoderOpenGeneric(WavReader* w, ReadWavInfo* info);
+
+/* Closes the decoder and frees its memory. */
+void FlacDecoderClose(FlacDecoder* decoder);
+
+/* Decodes up to num_samples samples, converted to float such that full scale
+ * maps to [-1, 1). Returns the number of samples actually read, a multiple of
+ * info->num_channels. Samples are in interleaved order. If the file is
+ * truncated or corrupt, an error is logged and reading stops there.
+ */
+size_t ReadFlacFloatSamplesGeneric(FlacDecoder* decoder, ReadWavInfo* info,
+                                   float* samples, size_t num_samples);
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif
+
+#endif  /* AUDIO_TO_TACTILE_SRC_DSP_READ_FLAC_GENERIC_H_ */
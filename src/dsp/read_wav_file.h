@@ -13,8 +13,8 @@
  * limitations under the License.
  *
  *
- * A WAV reader with support for 16 or 24-bit linear PCM format, mu-law format,
- * or IEEE floating point format (32 or 64 bits).
+ * A WAV reader with support for 16, 24, or 32-bit linear PCM format, mu-law
+ * format, or IEEE floating point format (32 or 64 bits).
  *
  * The simplest usage of this API is to use the ReadWavFile function, which
  * reads all samples into memory.
@@ -28,6 +28,9 @@
  * Read16BitWavSamples(f, &info, buffer, kBufferSize);
  * ...
  * fclose(f);
+ *
+ * To stream long files as blocks of float samples in constant memory, see
+ * read_wav_stream.h.
  */
 
 #ifndef AUDIO_TO_TACTILE_SRC_DSP_READ_WAV_FILE_H_
@@ -55,7 +58,7 @@ int ReadWavHeader(FILE* f, ReadWavInfo* info);
 size_t Read16BitWavSamples(FILE* f, ReadWavInfo* info, int16_t* samples,
                            size_t num_samples);
 
-/* Read up to num_samples samples from a WAV file in either 16- or 24-bit PCM
+/* Read up to num_samples samples from a WAV file in 16, 24, or 32-bit PCM
  * format or mu-law format into a 32-bit container. Data is shifted into the
  * most significant bits such that full scale values of 16- or 24-bit samples
  * will fill the [2^31 - 1, -2^31] range and leave the least significant bits
@@ -35,6 +35,7 @@
 #define kWavMulawCode 7
 #define kWavPcmGuid "\x00\x00\x00\x00\x10\x00\x80\x00\x00\xAA\x00\x38\x9B\x71"
 #define kWavFactChunkSize 4
+#define kWavDs64ChunkMinSize 24
 
 /* We assume IEEE 754 floats. Statically assert that `sizeof(float) == 4`. */
 typedef char kReadWaveFileStaticAssert_SIZEOF_FLOAT_MUST_EQUAL_4
@@ -165,8 +166,12 @@ static int ReadWavFmtChunk(WavReader* w, ReadWavInfo* info,
         info->encoding = kPcm24Encoding;
         info->destination_alignment_bytes = 4 /* 32-bit int */;
         info->sample_format = kInt32;
+      } else if (significant_bits_per_sample == 32) {
+        info->encoding = kPcm32Encoding;
+        info->destination_alignment_bytes = 4 /* 32-bit int */;
+        info->sample_format = kInt32;
       } else {
-        LOG_ERROR("Error: Only 16 and 24 bit PCM data is supported.\n");
+        LOG_ERROR("Error: Only 16, 24, and 32 bit PCM data is supported.\n");
         return 0;
       }
       break;
@@ -243,9 +248,12 @@ int ReadWavHeaderGeneric(WavReader* w, ReadWavInfo* info) {
   }
   w->has_error = 0;  /* Clear the error flag. */
 
-  /* WAV file should begin with "RIFF". */
+  /* WAV file should begin with "RIFF", or "RF64" or "BW64" for a WAV file
+   * larger than 4 GB [EBU Tech 3306 and ITU-R BS.2088].
+   */
   ReadWithErrorCheck(id, 4, w);
-  if (memcmp(id, "RIFF", 4) != 0) {
+  const int is_rf64 = memcmp(id, "RF64", 4) == 0 || memcmp(id, "BW64", 4) == 0;
+  if (!is_rf64 && memcmp(id, "RIFF", 4) != 0) {
     if (memcmp(id, "RIFX", 4) == 0) {
       LOG_ERROR("Error: Big endian WAV is unsupported.\n");
     } else {
@@ -264,13 +272,30 @@ int ReadWavHeaderGeneric(WavReader* w, ReadWavInfo* info) {
 
   info->num_channels = 0;
   uint8_t read_fact_chunk = 0;
+  uint8_t read_ds64_chunk = 0;
+  uint64_t ds64_data_size = 0;
   /* Loop until data chunk is found. Each iteration reads one chunk. */
   while (1) {
     uint32_t chunk_size;
     ReadWithErrorCheck(id, 4, w);
     chunk_size = ReadUint32(w);
 
-    if (memcmp(id, "fmt ", 4) == 0) {  /* Read format chunk. */
+    if (is_rf64 && memcmp(id, "ds64", 4) == 0) {  /* Read ds64 chunk. */
+      if (chunk_size < kWavDs64ChunkMinSize) {
+        LOG_ERROR("Error: WAV has invalid ds64 chunk.\n");
+        goto fail;
+      }
+      /* The ds64 chunk has 64-bit sizes for the RIFF chunk, data chunk, and
+       * number of frames, followed by a table for other large chunks. Only the
+       * data size is needed.
+       */
+      uint8_t bytes[8];
+      SeekWithErrorCheck(8, w);
+      ReadWithErrorCheck(bytes, 8, w);
+      ds64_data_size = LittleEndianReadU64(bytes);
+      SeekWithErrorCheck(chunk_size - 16, w);
+      read_ds64_chunk = 1;
+    } else if (memcmp(id, "fmt ", 4) == 0) {  /* Read format chunk. */
       if (!ReadWavFmtChunk(w, info, chunk_size)) {
         goto fail;
       }
@@ -285,14 +310,20 @@ int ReadWavHeaderGeneric(WavReader* w, ReadWavInfo* info) {
         goto fail;
       }
 
-      const uint32_t num_samples = chunk_size / (info->bit_depth / 8);
-      if (UINT32_MAX > SIZE_MAX && num_samples > SIZE_MAX) {
+      /* In RF64, a data chunk size of -1 means the size is in ds64. */
+      const uint64_t data_size =
+          (read_ds64_chunk && chunk_size == UINT32_MAX) ? ds64_data_size
+                                                        : chunk_size;
+      const uint64_t num_samples = data_size / (info->bit_depth / 8);
+      if (num_samples > SIZE_MAX) {
         LOG_ERROR("Error: Number of WAV samples exceeds %zu.\n", SIZE_MAX);
         goto fail;
       }
       size_t remaining_samples = (size_t)num_samples;
 
-      if (read_fact_chunk && remaining_samples != info->remaining_samples) {
+      /* The RF64 fact chunk may be -1 if the count didn't fit in 32 bits. */
+      if (read_fact_chunk && !read_ds64_chunk &&
+          remaining_samples != info->remaining_samples) {
         LOG_ERROR("Error: WAV fact and data chunks indicate different data "
                   "size. Using size from data chunk.\n");
       }
@@ -431,9 +462,17 @@ static size_t ReadBytesAsSamples(WavReader* w, ReadWavInfo* info,
               memcpy((int32_t*)dst_samples + i, &value_u32, sizeof(int32_t));
             }
           } break;
-          case 4: /* Read 32-bits into a float container. */
-            for (i = 0; i < count; ++i) {
-              ((float*)dst_samples)[i] = LittleEndianReadF32(buffer + 4 * i);
+          case 4:
+            if (info->encoding == kPcm32Encoding) {
+              /* Read 32-bit ints into a 32-bit container. */
+              for (i = 0; i < count; ++i) {
+                const uint32_t value_u32 = LittleEndianReadU32(buffer + 4 * i);
+                memcpy((int32_t*)dst_samples + i, &value_u32, sizeof(int32_t));
+              }
+            } else {  /* Read 32-bits into a float container. */
+              for (i = 0; i < count; ++i) {
+                ((float*)dst_samples)[i] = LittleEndianReadF32(buffer + 4 * i);
+              }
             }
             break;
           case 8: /* Read 64-bits into a float container. */
@@ -474,3 +513,106 @@ size_t ReadWavSamplesGeneric(WavReader* w, ReadWavInfo* info,
                              void* samples, size_t num_samples) {
   return ReadBytesAsSamples(w, info, (char*)samples, num_samples);
 }
+
+void ConvertWavBytesToFloat(const ReadWavInfo* info, const uint8_t* bytes,
+                            size_t num_samples, float* samples) {
+  /* Scale factors mapping integer full scale to [-1, 1). */
+  const float kScale16 = 1.0f / 32768.0f;
+  const float kScale32 = 1.0f / 2147483648.0f;
+  size_t i;
+
+  switch (info->encoding) {
+    case kMuLawEncoding:
+      for (i = 0; i < num_samples; ++i) {
+        samples[i] = kScale16 * kMuLawTable[bytes[i]];
+      }
+      break;
+    case kPcm16Encoding:
+      for (i = 0; i < num_samples; ++i, bytes += 2) {
+        samples[i] = kScale16 * (int16_t)LittleEndianReadU16(bytes);
+      }
+      break;
+    case kPcm24Encoding:
+      for (i = 0; i < num_samples; ++i, bytes += 3) {
+        const uint32_t value_u32 = (((uint32_t)bytes[0]) << 8) |
+                                   (((uint32_t)bytes[1]) << 16) |
+                                   (((uint32_t)bytes[2]) << 24);
+        samples[i] = kScale32 * (int32_t)value_u32;
+      }
+      break;
+    case kPcm32Encoding:
+      for (i = 0; i < num_samples; ++i, bytes += 4) {
+        samples[i] = kScale32 * (int32_t)LittleEndianReadU32(bytes);
+      }
+      break;
+    case kIeeeFloat32Encoding:
+      for (i = 0; i < num_samples; ++i, bytes += 4) {
+        samples[i] = LittleEndianReadF32(bytes);
+      }
+      break;
+    case kIeeeFloat64Encoding:
+      for (i = 0; i < num_samples; ++i, bytes += 8) {
+        samples[i] = (float)LittleEndianReadF64(bytes);
+      }
+      break;
+    case kFlacEncoding:
+      /* FLAC data is compressed and must be decoded with
+       * ReadFlacFloatSamplesGeneric() instead. Output silence rather than
+       * leave samples uninitialized.
+       */
+      for (i = 0; i < num_samples; ++i) {
+        samples[i] = 0.0f;
+      }
+      break;
+  }
+}
+
+size_t ReadWavFloatSamplesGeneric(WavReader* w, ReadWavInfo* info,
+                                  float* samples, size_t num_samples) {
+  size_t samples_to_read;
+  size_t current_sample;
+  if (w == NULL || w->io_ptr == NULL || info == NULL ||
+      info->remaining_samples < (size_t)info->num_channels ||
+      samples == NULL || num_samples <= 0) {
+    return 0;
+  }
+  w->has_error = 0; /* Clear the error flag. */
+
+  const size_t src_alignment_bytes = info->bit_depth / 8;
+  samples_to_read = info->remaining_samples;
+  if (num_samples < samples_to_read) {
+    samples_to_read = num_samples;
+  }
+  samples_to_read -= samples_to_read % info->num_channels;
+
+  /* As in ReadBytesAsSamples(), read through a 1 KB buffer. */
+  uint8_t buffer[1024];
+  const size_t max_count = sizeof(buffer) / src_alignment_bytes;
+
+  for (current_sample = 0; current_sample < samples_to_read;) {
+    size_t count = samples_to_read - current_sample;
+    if (count > max_count) { count = max_count; }
+    const size_t num_bytes = count * src_alignment_bytes;
+
+    const size_t bytes_read = ReadWithErrorCheck(buffer, num_bytes, w);
+    if (bytes_read < num_bytes) {
+      count = bytes_read / src_alignment_bytes;
+    } else if (bytes_read > num_bytes) {
+      count = 0;
+    }
+
+    ConvertWavBytesToFloat(info, buffer, count, samples + current_sample);
+    current_sample += count;
+
+    if (w->has_error) {
+      /* Tolerate a truncated data chunk, just return what was read. */
+      current_sample -= current_sample % info->num_channels;
+      info->remaining_samples = 0;
+      LOG_ERROR("Error: File error while reading WAV.\n");
+      return current_sample;
+    }
+  }
+
+  info->remaining_samples -= samples_to_read;
+  return samples_to_read;
+}
@@ -16,8 +16,9 @@
 #ifndef AUDIO_TO_TACTILE_SRC_DSP_READ_WAV_FILE_GENERIC_H_
 #define AUDIO_TO_TACTILE_SRC_DSP_READ_WAV_FILE_GENERIC_H_
 
-/* A WAV reader with support for 16 or 24-bit linear PCM format, mu-law format,
- * or IEEE floating point format (32 or 64 bits).
+/* A WAV reader with support for 16, 24, or 32-bit linear PCM format, mu-law
+ * format, or IEEE floating point format (32 or 64 bits). Files larger than
+ * 4 GB in RF64 or BW64 format are supported.
  *
  * Don't use this file directly unless you are adding support for a different
  * kind of filesystem. See read_wav_file.h or audio/util/wavfile.
@@ -100,6 +101,22 @@ size_t Read16BitWavSamplesGeneric(WavReader* w, ReadWavInfo* info,
 size_t ReadWavSamplesGeneric(WavReader* w, ReadWavInfo* info, void* samples,
                              size_t num_samples);
 
+/* Read up to num_samples samples from a WAV file in any supported format,
+ * converting directly to float. Integer samples are scaled so that full scale
+ * maps to [-1, 1). Returns the number of samples actually read, a multiple of
+ * info->num_channels. Samples are in interleaved order.
+ */
+size_t ReadWavFloatSamplesGeneric(WavReader* w, ReadWavInfo* info,
+                                  float* samples, size_t num_samples);
+
+/* Converts `num_samples` samples of raw WAV data `bytes`, encoded as described
+ * by `info`, to float as in ReadWavFloatSamplesGeneric(). This is useful to
+ * read WAV data that is already in memory, e.g. a memory-mapped file. FLAC
+ * data can't be converted this way, and produces zeros.
+ */
+void ConvertWavBytesToFloat(const ReadWavInfo* info, const uint8_t* bytes,
+                            size_t num_samples, float* samples);
+
 #ifdef __cplusplus
 }  /* extern "C" */
 #endif
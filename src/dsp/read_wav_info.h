@@ -46,6 +46,8 @@ struct ReadWavInfo {
     kMuLawEncoding,
     kIeeeFloat32Encoding,
     kIeeeFloat64Encoding,
+    kPcm32Encoding,
+    kFlacEncoding,  /* FLAC file, see read_flac_generic.h. */
   } encoding;
 
   /* The sample format of the read samples (the type of the data as returned by
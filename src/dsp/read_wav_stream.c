@@ -0,0 +1,405 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#if defined(__unix__) || defined(__APPLE__)
+#define kReadWavStreamUseMmap 1
+#if !defined(_POSIX_C_SOURCE) || _POSIX_C_SOURCE < 200112L
+#undef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200112L /* For mmap() and posix_madvise(). */
+#endif
+#else
+#define kReadWavStreamUseMmap 0
+#endif
+
+#include "dsp/read_wav_stream.h"
+
+#include <errno.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if kReadWavStreamUseMmap
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "dsp/logging.h"
+#include "dsp/read_flac_generic.h"
+
+/* Size of the marker at the start of a FLAC file. */
+#define kFlacMarkerSize 4
+
+/* In-memory data for reading the header of a mapped file with a WavReader. */
+typedef struct {
+  const uint8_t* data;
+  size_t size;
+  size_t pos;
+} MemoryFile;
+
+/* WavReader wrapping another WavReader `source`, replaying bytes peeked from
+ * it before continuing to read from it. This way, the file format can be
+ * detected from the first bytes of a stream that can't seek backward.
+ */
+typedef struct {
+  WavReader* source;
+  uint8_t bytes[kFlacMarkerSize];
+  size_t num_bytes;
+  size_t pos;
+} PeekedFile;
+
+struct ReadWavStream {
+  ReadWavInfo info;
+  int frames_per_block;
+  /* Buffer of frames_per_block * num_channels samples. */
+  float* block;
+
+  /* Chunked implementation. `w` points to `peeked_reader`, which reads from
+   * either `stdio_reader` or a WavReader provided by the caller. `file` is
+   * non-NULL if opened with stdio.
+   */
+  WavReader* w;
+  WavReader stdio_reader;
+  WavReader peeked_reader;
+  PeekedFile peeked_file;
+  FILE* file;
+
+  /* FLAC decoder, used when non-NULL, reading from `w` or for a mapped file
+   * from `memory_reader`.
+   */
+  FlacDecoder* flac;
+  WavReader memory_reader;
+  MemoryFile memory_file;
+
+  /* Memory-mapped implementation, used when `map` is non-NULL. */
+  const uint8_t* map;
+  size_t map_size;
+  /* Pointer to the next unread sample in the mapping. */
+  const uint8_t* data;
+  /* Whether full blocks can be returned as pointers into the mapping. */
+  int zero_copy;
+};
+
+static size_t StdioRead(void* bytes, size_t num_bytes, void* io_ptr) {
+  return fread(bytes, 1, num_bytes, (FILE*)io_ptr);
+}
+
+static int StdioSeek(size_t num_bytes, void* io_ptr) {
+  return fseek((FILE*)io_ptr, num_bytes, SEEK_CUR);
+}
+
+static int StdioEndOfFile(void* io_ptr) {
+  return feof((FILE*)io_ptr);
+}
+
+static size_t MemoryRead(void* bytes, size_t num_bytes, void* io_ptr) {
+  MemoryFile* m = (MemoryFile*)io_ptr;
+  const size_t available = m->size - m->pos;
+  if (num_bytes > available) { num_bytes = available; }
+  memcpy(bytes, m->data + m->pos, num_bytes);
+  m->pos += num_bytes;
+  return num_bytes;
+}
+
+static int MemorySeek(size_t num_bytes, void* io_ptr) {
+  MemoryFile* m = (MemoryFile*)io_ptr;
+  if (num_bytes > m->size - m->pos) {
+    m->pos = m->size;
+    return 1;
+  }
+  m->pos += num_bytes;
+  return 0;
+}
+
+static int MemoryEndOfFile(void* io_ptr) {
+  const MemoryFile* m = (const MemoryFile*)io_ptr;
+  return m->pos >= m->size;
+}
+
+static size_t PeekedRead(void* bytes, size_t num_bytes, void* io_ptr) {
+  PeekedFile* p = (PeekedFile*)io_ptr;
+  size_t n = p->num_bytes - p->pos;
+  if (n > num_bytes) { n = num_bytes; }
+  memcpy(bytes, p->bytes + p->pos, n);
+  p->pos += n;
+  if (n == num_bytes) { return n; }
+  return n + p->source->read_fun((uint8_t*)bytes + n, num_bytes - n,
+                                 p->source->io_ptr);
+}
+
+static int PeekedSeek(size_t num_bytes, void* io_ptr) {
+  PeekedFile* p = (PeekedFile*)io_ptr;
+  size_t n = p->num_bytes - p->pos;
+  if (n > num_bytes) { n = num_bytes; }
+  p->pos += n;
+  if (n == num_bytes) { return 0; }
+  return p->source->seek_fun(num_bytes - n, p->source->io_ptr);
+}
+
+static int PeekedEndOfFile(void* io_ptr) {
+  const PeekedFile* p = (const PeekedFile*)io_ptr;
+  return p->pos >= p->num_bytes && p->source->eof_fun(p->source->io_ptr);
+}
+
+static void PeekedCustomChunk(char (*id)[4], const void* data,
+                              size_t num_bytes, void* io_ptr) {
+  const PeekedFile* p = (const PeekedFile*)io_ptr;
+  p->source->custom_chunk_fun(id, data, num_bytes, p->source->io_ptr);
+}
+
+/* Returns 1 if `bytes` starts with the FLAC marker "fLaC". */
+static int /*bool*/ IsFlacMarker(const uint8_t* bytes, size_t num_bytes) {
+  return num_bytes >= kFlacMarkerSize &&
+         memcmp(bytes, "fLaC", kFlacMarkerSize) == 0;
+}
+
+static int IsLittleEndian(void) {
+  const uint16_t one = 1;
+  return *(const uint8_t*)&one == 1;
+}
+
+/* Allocates a stream, with all fields cleared. */
+static ReadWavStream* AllocStream(void) {
+  ReadWavStream* stream = (ReadWavStream*)malloc(sizeof(ReadWavStream));
+  if (stream == NULL) {
+    LOG_ERROR("Error: Failed to allocate memory\n");
+    return NULL;
+  }
+  stream->block = NULL;
+  stream->w = NULL;
+  stream->file = NULL;
+  stream->flac = NULL;
+  stream->map = NULL;
+  stream->map_size = 0;
+  stream->data = NULL;
+  stream->zero_copy = 0;
+  return stream;
+}
+
+/* Allocates the block buffer once the header has been read. */
+static int AllocBlock(ReadWavStream* stream, int frames_per_block) {
+  const size_t block_size =
+      (size_t)frames_per_block * stream->info.num_channels;
+  stream->frames_per_block = frames_per_block;
+  stream->block = (float*)malloc(block_size * sizeof(float));
+  if (stream->block == NULL) {
+    LOG_ERROR("Error: Failed to allocate memory\n");
+    return 0;
+  }
+  return 1;
+}
+
+#if kReadWavStreamUseMmap
+/* Attempts to memory map `file_name`. Returns 1 on success. On failure,
+ * returns 0 and the caller may fall back to stdio.
+ */
+static int OpenMapped(ReadWavStream* stream, const char* file_name) {
+  const int fd = open(file_name, O_RDONLY);
+  if (fd == -1) { return 0; }
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) || !S_ISREG(file_stat.st_mode) ||
+      file_stat.st_size <= 0 ||
+      (uintmax_t)file_stat.st_size > (uintmax_t)SIZE_MAX) {
+    close(fd);
+    return 0;
+  }
+  const size_t map_size = (size_t)file_stat.st_size;
+  void* map = mmap(NULL, map_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);  /* The mapping remains valid after closing. */
+  if (map == MAP_FAILED) { return 0; }
+  posix_madvise(map, map_size, POSIX_MADV_SEQUENTIAL);
+
+  stream->map = (const uint8_t*)map;
+  stream->map_size = map_size;
+  return 1;
+}
+#endif  /* kReadWavStreamUseMmap */
+
+/* Reads the header from the mapping and sets up reading the data chunk, or for
+ * a FLAC file, decoding from the mapping.
+ */
+static int ReadMappedHeader(ReadWavStream* stream) {
+  MemoryFile* memory_file = &stream->memory_file;
+  memory_file->data = stream->map;
+  memory_file->size = stream->map_size;
+  memory_file->pos = 0;
+  WavReader* w = &stream->memory_reader;
+  w->io_ptr = memory_file;
+  w->read_fun = MemoryRead;
+  w->seek_fun = MemorySeek;
+  w->eof_fun = MemoryEndOfFile;
+  w->custom_chunk_fun = NULL;
+  if (IsFlacMarker(stream->map, stream->map_size)) {
+    stream->flac = FlacDecoderOpenGeneric(w, &stream->info);
+    return stream->flac != NULL;
+  }
+  if (!ReadWavHeaderGeneric(w, &stream->info)) { return 0; }
+
+  stream->data = stream->map + memory_file->pos;
+  /* Tolerate a truncated data chunk by reading only what is in the file. */
+  const size_t bytes_per_sample = stream->info.bit_depth / 8;
+  size_t available = (stream->map_size - memory_file->pos) / bytes_per_sample;
+  available -= available % stream->info.num_channels;
+  if (stream->info.remaining_samples > available) {
+    LOG_ERROR("Error: WAV file ended unexpectedly.\n");
+    stream->info.remaining_samples = available;
+  }
+
+  stream->zero_copy = stream->info.encoding == kIeeeFloat32Encoding &&
+                      IsLittleEndian() &&
+                      ((size_t)stream->data) % sizeof(float) == 0;
+  return 1;
+}
+
+/* Reads the header from WavReader `source`, detecting whether it is a WAV or
+ * FLAC file from its first bytes.
+ */
+static int ReadHeader(ReadWavStream* stream, WavReader* source) {
+  PeekedFile* p = &stream->peeked_file;
+  p->source = source;
+  p->num_bytes = source->read_fun(p->bytes, kFlacMarkerSize, source->io_ptr);
+  p->pos = 0;
+  WavReader* w = &stream->peeked_reader;
+  w->io_ptr = p;
+  w->read_fun = PeekedRead;
+  w->seek_fun = source->seek_fun ? PeekedSeek : NULL;
+  w->eof_fun = source->eof_fun ? PeekedEndOfFile : NULL;
+  w->custom_chunk_fun = source->custom_chunk_fun ? PeekedCustomChunk : NULL;
+  stream->w = w;
+
+  if (IsFlacMarker(p->bytes, p->num_bytes)) {
+    stream->flac = FlacDecoderOpenGeneric(w, &stream->info);
+    return stream->flac != NULL;
+  }
+  return ReadWavHeaderGeneric(w, &stream->info);
+}
+
+ReadWavStream* ReadWavStreamOpen(const char* file_name, int frames_per_block) {
+  if (file_name == NULL || frames_per_block <= 0) { return NULL; }
+  ReadWavStream* stream = AllocStream();
+  if (stream == NULL) { return NULL; }
+
+#if kReadWavStreamUseMmap
+  if (OpenMapped(stream, file_name)) {
+    if (!ReadMappedHeader(stream) || !AllocBlock(stream, frames_per_block)) {
+      goto fail;
+    }
+    return stream;
+  }
+#endif  /* kReadWavStreamUseMmap */
+
+  /* Fall back to reading with stdio. */
+  stream->file = fopen(file_name, "rb");
+  if (stream->file == NULL) {
+    LOG_ERROR("Error: Failed to open \"%s\" for reading: %s\n", file_name,
+              strerror(errno));
+    goto fail;
+  }
+  stream->stdio_reader.io_ptr = stream->file;
+  stream->stdio_reader.read_fun = StdioRead;
+  stream->stdio_reader.seek_fun = StdioSeek;
+  stream->stdio_reader.eof_fun = StdioEndOfFile;
+  stream->stdio_reader.custom_chunk_fun = NULL;
+  if (!ReadHeader(stream, &stream->stdio_reader) ||
+      !AllocBlock(stream, frames_per_block)) {
+    goto fail;
+  }
+  return stream;
+
+fail:
+  ReadWavStreamClose(stream);
+  return NULL;
+}
+
+ReadWavStream* ReadWavStreamOpenGeneric(WavReader* w, int frames_per_block) {
+  if (w == NULL || frames_per_block <= 0) { return NULL; }
+  ReadWavStream* stream = AllocStream();
+  if (stream == NULL) { return NULL; }
+
+  if (!ReadHeader(stream, w) || !AllocBlock(stream, frames_per_block)) {
+    ReadWavStreamClose(stream);
+    return NULL;
+  }
+  return stream;
+}
+
+void ReadWavStreamClose(ReadWavStream* stream) {
+  if (stream == NULL) { return; }
+  FlacDecoderClose(stream->flac);
+#if kReadWavStreamUseMmap
+  if (stream->map != NULL) {
+    munmap((void*)stream->map, stream->map_size);
+  }
+#endif  /* kReadWavStreamUseMmap */
+  if (stream->file != NULL) { fclose(stream->file); }
+  free(stream->block);
+  free(stream);
+}
+
+int ReadWavStreamNumChannels(const ReadWavStream* stream) {
+  return stream->info.num_channels;
+}
+
+int ReadWavStreamSampleRateHz(const ReadWavStream* stream) {
+  return stream->info.sample_rate_hz;
+}
+
+const ReadWavInfo* ReadWavStreamInfo(const ReadWavStream* stream) {
+  return &stream->info;
+}
+
+int ReadWavStreamIsMapped(const ReadWavStream* stream) {
+  return stream->map != NULL;
+}
+
+const float* ReadWavStreamNextBlock(ReadWavStream* stream, int* num_frames) {
+  const int num_channels = stream->info.num_channels;
+  const size_t block_size = (size_t)stream->frames_per_block * num_channels;
+  size_t num_read;
+  *num_frames = 0;
+
+  if (stream->flac != NULL) {
+    num_read = ReadFlacFloatSamplesGeneric(
+        stream->flac, &stream->info, stream->block, block_size);
+    if (num_read == 0) { return NULL; }
+  } else if (stream->map != NULL) {
+    num_read = stream->info.remaining_samples;
+    if (num_read == 0) { return NULL; }
+    if (num_read > block_size) { num_read = block_size; }
+    const uint8_t* src = stream->data;
+    stream->data += num_read * (stream->info.bit_depth / 8);
+    stream->info.remaining_samples -= num_read;
+
+    if (stream->zero_copy && num_read == block_size) {
+      *num_frames = stream->frames_per_block;
+      return (const float*)src;  /* Samples are already float. */
+    }
+    ConvertWavBytesToFloat(&stream->info, src, num_read, stream->block);
+  } else {
+    num_read = ReadWavFloatSamplesGeneric(
+        stream->w, &stream->info, stream->block, block_size);
+    if (num_read == 0) { return NULL; }
+  }
+
+  /* Zero-pad a partial last block. */
+  if (num_read < block_size) {
+    memset(stream->block + num_read, 0,
+           (block_size - num_read) * sizeof(float));
+  }
+  *num_frames = (int)(num_read / num_channels);
+  return stream->block;
+}
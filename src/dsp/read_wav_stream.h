@@ -0,0 +1,105 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * Streaming WAV reader that returns fixed-size blocks of float samples.
+ *
+ * ReadWavFile() loads a whole file into memory, which is a problem for long
+ * recordings. ReadWavStream instead reads one block of `frames_per_block`
+ * frames at a time, converted to float in [-1, 1), so that arbitrarily long
+ * files are processed in constant memory. All formats supported by the
+ * WavReader are supported (see read_wav_file_generic.h). FLAC files are also
+ * supported, detected by their "fLaC" marker and decoded a frame at a time
+ * (see read_flac_generic.h), so that compressed corpora can be read directly.
+ *
+ * There are two implementations:
+ *
+ *  - Memory mapped. On POSIX systems, ReadWavStreamOpen() maps the file with
+ *    mmap() and converts samples directly from the mapping, avoiding read
+ *    calls and intermediate copies. For 32-bit float WAV files on a little
+ *    endian machine, no conversion is needed and full blocks are returned as
+ *    pointers into the mapping.
+ *
+ *  - Chunked. On other systems, or if mapping fails (e.g. for a pipe),
+ *    ReadWavStreamOpen() falls back to reading with stdio.
+ *    ReadWavStreamOpenGeneric() reads from any WavReader with custom IO
+ *    callbacks. Each block is read with ReadWavFloatSamplesGeneric(), or
+ *    ReadFlacFloatSamplesGeneric() for FLAC.
+ *
+ * Example use:
+ *   ReadWavStream* stream = ReadWavStreamOpen("input.wav", 256);
+ *   if (stream == NULL) { ... }
+ *   const int num_channels = ReadWavStreamNumChannels(stream);
+ *   const float* block;
+ *   int num_frames;
+ *   while ((block = ReadWavStreamNextBlock(stream, &num_frames)) != NULL) {
+ *     // Process num_frames frames of interleaved samples in `block`.
+ *   }
+ *   ReadWavStreamClose(stream);
+ */
+
+#ifndef AUDIO_TO_TACTILE_SRC_DSP_READ_WAV_STREAM_H_
+#define AUDIO_TO_TACTILE_SRC_DSP_READ_WAV_STREAM_H_
+
+#include "dsp/read_wav_file_generic.h"
+#include "dsp/read_wav_info.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct ReadWavStream ReadWavStream;
+
+/* Opens WAV or FLAC file `file_name` for streaming in blocks of
+ * `frames_per_block` frames. The file is memory mapped where possible. Returns
+ * NULL on failure. The caller should free it with ReadWavStreamClose() when
+ * done.
+ */
+ReadWavStream* ReadWavStreamOpen(const char* file_name, int frames_per_block);
+
+/* Opens a stream reading from WavReader `w` with custom IO callbacks. `w` must
+ * remain valid until ReadWavStreamClose(). Returns NULL on failure.
+ */
+ReadWavStream* ReadWavStreamOpenGeneric(WavReader* w, int frames_per_block);
+
+/* Closes the stream and frees its memory. */
+void ReadWavStreamClose(ReadWavStream* stream);
+
+/* Gets the number of channels. */
+int ReadWavStreamNumChannels(const ReadWavStream* stream);
+
+/* Gets the sample rate in Hz. */
+int ReadWavStreamSampleRateHz(const ReadWavStream* stream);
+
+/* Gets the WAV info, e.g. to check the encoding or remaining samples. For FLAC
+ * files, the encoding is kFlacEncoding.
+ */
+const ReadWavInfo* ReadWavStreamInfo(const ReadWavStream* stream);
+
+/* Returns 1 if the stream is memory mapped, 0 if it reads in chunks. */
+int /*bool*/ ReadWavStreamIsMapped(const ReadWavStream* stream);
+
+/* Reads the next block. Returns a pointer to `frames_per_block` frames of
+ * interleaved float samples, which is valid until the next call. The number of
+ * frames read is written to `*num_frames`. This is less than frames_per_block
+ * only for the last block, in which case the remainder of the block is filled
+ * with zeros. Returns NULL at the end of the file.
+ */
+const float* ReadWavStreamNextBlock(ReadWavStream* stream, int* num_frames);
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif
+
+#endif  /* AUDIO_TO_TACTILE_SRC_DSP_READ_WAV_STREAM_H_ */
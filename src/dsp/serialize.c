@@ -15,6 +15,136 @@
 
 #include "dsp/serialize.h"
 
+#include <string.h>
+
+/* Whether the host byte order is known at compile time to be little endian. */
+#if defined(__BYTE_ORDER__) && defined(__ORDER_LITTLE_ENDIAN__) && \
+    __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define SERIALIZE_HOST_IS_LITTLE_ENDIAN 1
+#else
+#define SERIALIZE_HOST_IS_LITTLE_ENDIAN 0
+#endif
+
+void LittleEndianReadU16Array(const uint8_t* bytes, size_t num,
+                              uint16_t* values) {
+#if SERIALIZE_HOST_IS_LITTLE_ENDIAN
+  memcpy(values, bytes, sizeof(uint16_t) * num);
+#else
+  size_t i;
+  for (i = 0; i < num; ++i, bytes += 2) {
+    values[i] = LittleEndianReadU16(bytes);
+  }
+#endif
+}
+
+void LittleEndianReadS16Array(const uint8_t* bytes, size_t num,
+                              int16_t* values) {
+#if SERIALIZE_HOST_IS_LITTLE_ENDIAN
+  memcpy(values, bytes, sizeof(int16_t) * num);
+#else
+  size_t i;
+  for (i = 0; i < num; ++i, bytes += 2) {
+    values[i] = LittleEndianReadS16(bytes);
+  }
+#endif
+}
+
+void LittleEndianReadU32Array(const uint8_t* bytes, size_t num,
+                              uint32_t* values) {
+#if SERIALIZE_HOST_IS_LITTLE_ENDIAN
+  memcpy(values, bytes, sizeof(uint32_t) * num);
+#else
+  size_t i;
+  for (i = 0; i < num; ++i, bytes += 4) {
+    values[i] = LittleEndianReadU32(bytes);
+  }
+#endif
+}
+
+void LittleEndianReadS32Array(const uint8_t* bytes, size_t num,
+                              int32_t* values) {
+#if SERIALIZE_HOST_IS_LITTLE_ENDIAN
+  memcpy(values, bytes, sizeof(int32_t) * num);
+#else
+  size_t i;
+  for (i = 0; i < num; ++i, bytes += 4) {
+    values[i] = LittleEndianReadS32(bytes);
+  }
+#endif
+}
+
+void LittleEndianReadF32Array(const uint8_t* bytes, size_t num,
+                              float* values) {
+#if SERIALIZE_HOST_IS_LITTLE_ENDIAN
+  memcpy(values, bytes, sizeof(float) * num);
+#else
+  size_t i;
+  for (i = 0; i < num; ++i, bytes += 4) {
+    values[i] = LittleEndianReadF32(bytes);
+  }
+#endif
+}
+
+void LittleEndianWriteU16Array(const uint16_t* values, size_t num,
+                               uint8_t* bytes) {
+#if SERIALIZE_HOST_IS_LITTLE_ENDIAN
+  memcpy(bytes, values, sizeof(uint16_t) * num);
+#else
+  size_t i;
+  for (i = 0; i < num; ++i, bytes += 2) {
+    LittleEndianWriteU16(values[i], bytes);
+  }
+#endif
+}
+
+void LittleEndianWriteS16Array(const int16_t* values, size_t num,
+                               uint8_t* bytes) {
+#if SERIALIZE_HOST_IS_LITTLE_ENDIAN
+  memcpy(bytes, values, sizeof(int16_t) * num);
+#else
+  size_t i;
+  for (i = 0; i < num; ++i, bytes += 2) {
+    LittleEndianWriteS16(values[i], bytes);
+  }
+#endif
+}
+
+void LittleEndianWriteU32Array(const uint32_t* values, size_t num,
+                               uint8_t* bytes) {
+#if SERIALIZE_HOST_IS_LITTLE_ENDIAN
+  memcpy(bytes, values, sizeof(uint32_t) * num);
+#else
+  size_t i;
+  for (i = 0; i < num; ++i, bytes += 4) {
+    LittleEndianWriteU32(values[i], bytes);
+  }
+#endif
+}
+
+void LittleEndianWriteS32Array(const int32_t* values, size_t num,
+                               uint8_t* bytes) {
+#if SERIALIZE_HOST_IS_LITTLE_ENDIAN
+  memcpy(bytes, values, sizeof(int32_t) * num);
+#else
+  size_t i;
+  for (i = 0; i < num; ++i, bytes += 4) {
+    LittleEndianWriteS32(values[i], bytes);
+  }
+#endif
+}
+
+void LittleEndianWriteF32Array(const float* values, size_t num,
+                               uint8_t* bytes) {
+#if SERIALIZE_HOST_IS_LITTLE_ENDIAN
+  memcpy(bytes, values, sizeof(float) * num);
+#else
+  size_t i;
+  for (i = 0; i < num; ++i, bytes += 4) {
+    LittleEndianWriteF32(values[i], bytes);
+  }
+#endif
+}
+
 uint8_t Fletcher8(const uint8_t* data, size_t size, uint8_t init) {
   uint_fast32_t sum1 = init & 0xf;
   uint_fast32_t sum2 = init >> 4;
@@ -53,29 +183,87 @@ uint8_t Fletcher8(const uint8_t* data, size_t size, uint8_t init) {
   return (uint8_t)(sum2 << 4 | sum1);
 }
 
-uint16_t Fletcher16(const uint8_t* data, size_t size, uint16_t init) {
-  uint_fast32_t sum1 = init & 0xff;
-  uint_fast32_t sum2 = init >> 8;
+/* Max block size for Fletcher-16 between modulo reductions. After n steps:
+ *
+ *   sum1 <= 254 + 255 n,
+ *   sum2 <= 254 + 254 n + 255 (n + 1) n / 2.
+ *
+ * So sum2 <= 2^32 - 1 for n <= 5802. It is rounded down to a multiple of 4.
+ */
+#define kFletcher16MaxBlockSize 5800
 
-  while (size > 0) {
-    /* After n steps:
-     *
-     *   sum1 <= 254 + 255 n,
-     *   sum2 <= 254 + 254 n + 255 (n + 1) n / 2.
-     *
-     * So sum2 <= 2^32 - 1 for n <= 5802.
-     */
-    const size_t kMaxBlockSize = 5802;
-    const int block_size = (int)(size < kMaxBlockSize ? size : kMaxBlockSize);
+/* Accumulates Fletcher-16 sums over `size` bytes, at most
+ * kFletcher16MaxBlockSize, without modulo reduction. If `dest` is nonnull, the
+ * bytes are also copied to it.
+ *
+ * Bytes are processed 4 at a time, using that 4 steps of the recurrence
+ *
+ *   sum1 += d[i], sum2 += sum1
+ *
+ * are equivalent to
+ *
+ *   sum2 += 4 sum1 + 4 d[0] + 3 d[1] + 2 d[2] + d[3],
+ *   sum1 += d[0] + d[1] + d[2] + d[3],
+ *
+ * which shortens the chain of dependent additions.
+ */
+static void Fletcher16Block(uint8_t* dest, const uint8_t* data, int size,
+                            uint_fast32_t* sum1_ptr, uint_fast32_t* sum2_ptr) {
+  uint_fast32_t sum1 = *sum1_ptr;
+  uint_fast32_t sum2 = *sum2_ptr;
+  int i = 0;
 
-    int i;
-    for (i = 0; i < block_size; ++i) {
+  if (dest) {
+    for (; i + 4 <= size; i += 4) {
+      const uint_fast32_t d0 = data[i];
+      const uint_fast32_t d1 = data[i + 1];
+      const uint_fast32_t d2 = data[i + 2];
+      const uint_fast32_t d3 = data[i + 3];
+      dest[i] = (uint8_t)d0;
+      dest[i + 1] = (uint8_t)d1;
+      dest[i + 2] = (uint8_t)d2;
+      dest[i + 3] = (uint8_t)d3;
+      sum2 += 4 * (sum1 + d0) + 3 * d1 + 2 * d2 + d3;
+      sum1 += d0 + d1 + d2 + d3;
+    }
+    for (; i < size; ++i) {
+      dest[i] = data[i];
+      sum1 += data[i];
+      sum2 += sum1;
+    }
+  } else {
+    for (; i + 4 <= size; i += 4) {
+      const uint_fast32_t d0 = data[i];
+      const uint_fast32_t d1 = data[i + 1];
+      const uint_fast32_t d2 = data[i + 2];
+      const uint_fast32_t d3 = data[i + 3];
+      sum2 += 4 * (sum1 + d0) + 3 * d1 + 2 * d2 + d3;
+      sum1 += d0 + d1 + d2 + d3;
+    }
+    for (; i < size; ++i) {
       sum1 += data[i];
       sum2 += sum1;
     }
+  }
+
+  *sum1_ptr = sum1 % 255;
+  *sum2_ptr = sum2 % 255;
+}
+
+uint16_t Fletcher16(const uint8_t* data, size_t size, uint16_t init) {
+  return Fletcher16Copy(NULL, data, size, init);
+}
 
-    sum1 %= 255;
-    sum2 %= 255;
+uint16_t Fletcher16Copy(uint8_t* dest, const uint8_t* data, size_t size,
+                        uint16_t init) {
+  uint_fast32_t sum1 = init & 0xff;
+  uint_fast32_t sum2 = init >> 8;
+
+  while (size > 0) {
+    const int block_size = (int)(size < kFletcher16MaxBlockSize
+                                 ? size : kFletcher16MaxBlockSize);
+    Fletcher16Block(dest, data, block_size, &sum1, &sum2);
+    if (dest) { dest += block_size; }
     data += block_size;
     size -= block_size;
   }
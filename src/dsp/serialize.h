@@ -62,6 +62,44 @@ static void LittleEndianWriteF32(float value, uint8_t* bytes);
 /* Serializes a 64-bit float value to bytes in little endian order. */
 static void LittleEndianWriteF64(double value, uint8_t* bytes);
 
+/* Little endian arrays. These are equivalent to calling the functions above
+ * on each element with a stride of the element size, but on little endian
+ * hosts (including ARM Cortex-M and x86) they are a single memcpy, so that
+ * serializing a buffer of samples is one copy. On other hosts, they fall back
+ * to an element loop, which compilers reduce to byte-swapping loads.
+ */
+
+/* Deserializes `num` uint16_t values from bytes in little endian order. */
+void LittleEndianReadU16Array(const uint8_t* bytes, size_t num,
+                              uint16_t* values);
+/* Deserializes `num` int16_t values from bytes in little endian order. */
+void LittleEndianReadS16Array(const uint8_t* bytes, size_t num,
+                              int16_t* values);
+/* Deserializes `num` uint32_t values from bytes in little endian order. */
+void LittleEndianReadU32Array(const uint8_t* bytes, size_t num,
+                              uint32_t* values);
+/* Deserializes `num` int32_t values from bytes in little endian order. */
+void LittleEndianReadS32Array(const uint8_t* bytes, size_t num,
+                              int32_t* values);
+/* Deserializes `num` 32-bit float values from bytes in little endian order. */
+void LittleEndianReadF32Array(const uint8_t* bytes, size_t num, float* values);
+
+/* Serializes `num` uint16_t values to bytes in little endian order. */
+void LittleEndianWriteU16Array(const uint16_t* values, size_t num,
+                               uint8_t* bytes);
+/* Serializes `num` int16_t values to bytes in little endian order. */
+void LittleEndianWriteS16Array(const int16_t* values, size_t num,
+                               uint8_t* bytes);
+/* Serializes `num` uint32_t values to bytes in little endian order. */
+void LittleEndianWriteU32Array(const uint32_t* values, size_t num,
+                               uint8_t* bytes);
+/* Serializes `num` int32_t values to bytes in little endian order. */
+void LittleEndianWriteS32Array(const int32_t* values, size_t num,
+                               uint8_t* bytes);
+/* Serializes `num` 32-bit float values to bytes in little endian order. */
+void LittleEndianWriteF32Array(const float* values, size_t num,
+                               uint8_t* bytes);
+
 
 /* Big endian byte order. */
 
@@ -136,6 +174,12 @@ uint8_t Fletcher8(const uint8_t* data, size_t size, uint8_t init);
  * value for `init` is 1.
  */
 uint16_t Fletcher16(const uint8_t* data, size_t size, uint16_t init);
+/* Same as Fletcher16(), and also copies the `size` bytes of `data` to `dest`.
+ * This checksums data in the same pass as writing it, e.g. when copying a
+ * received message out of a packet, rather than reading it a second time.
+ */
+uint16_t Fletcher16Copy(uint8_t* dest, const uint8_t* data, size_t size,
+                        uint16_t init);
 
 
 /* Implementation details only below this line. ----------------------------- */
@@ -0,0 +1,706 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * Portable 4-lane float vector type.
+ *
+ * `Float4` holds four floats and has elementwise arithmetic. `Int4` holds four
+ * int32_t values, with a few integer ops for bit manipulation of floats, as
+ * used by the vector functions in fast_fun_simd.h. The implementation is
+ * selected at build time:
+ *
+ *  - SSE2 on x86 (when `__SSE2__` is defined, which is always the case on
+ *    x86-64),
+ *  - NEON on ARM (when `__ARM_NEON` is defined),
+ *  - WebAssembly SIMD128 (when `__wasm_simd128__` is defined, i.e. building
+ *    with emscripten and `-msimd128`),
+ *  - otherwise, a portable fallback that is a struct of four floats.
+ *
+ * Defining `AUDIO_TO_TACTILE_DISABLE_SIMD` forces the portable fallback. The
+ * fallback is what is used on Cortex-M4F microcontrollers, where compilers
+ * generate efficient scalar code for it.
+ *
+ * Arithmetic is done without fused multiply-add so that all implementations
+ * produce the same results as equivalent scalar code. The exception is
+ * Float4Div() on 32-bit ARM NEON, which lacks a vector divide instruction.
+ *
+ * NOTE: Functions below are marked `static` [the C analogy for `inline`] so
+ * that ideally they get inline expanded.
+ */
+
+#ifndef AUDIO_TO_TACTILE_SRC_DSP_SIMD_H_
+#define AUDIO_TO_TACTILE_SRC_DSP_SIMD_H_
+
+#include <stdint.h>
+#include <string.h>
+
+#if !defined(AUDIO_TO_TACTILE_DISABLE_SIMD) && defined(__SSE2__)
+#define FLOAT4_USE_SSE 1
+#include <emmintrin.h>
+#elif !defined(AUDIO_TO_TACTILE_DISABLE_SIMD) && defined(__ARM_NEON)
+#define FLOAT4_USE_NEON 1
+#include <arm_neon.h>
+#elif !defined(AUDIO_TO_TACTILE_DISABLE_SIMD) && defined(__wasm_simd128__)
+#define FLOAT4_USE_WASM 1
+#include <wasm_simd128.h>
+#endif
+
+#if !defined(FLOAT4_USE_SSE) && !defined(FLOAT4_USE_NEON) && \
+    !defined(FLOAT4_USE_WASM) && defined(__ARM_FEATURE_SAT)
+/* Cortex-M cores with saturation instructions, like M4, whose portable
+ * fallback uses SSAT and USAT for saturating stores.
+ */
+#include <arm_acle.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(FLOAT4_USE_SSE)
+#define kFloat4Implementation "SSE"
+typedef __m128 Float4;
+typedef __m128i Int4;
+#elif defined(FLOAT4_USE_NEON)
+#define kFloat4Implementation "NEON"
+typedef float32x4_t Float4;
+typedef int32x4_t Int4;
+#elif defined(FLOAT4_USE_WASM)
+#define kFloat4Implementation "WASM"
+/* WebAssembly SIMD128 has a single vector type for all lane types. */
+typedef v128_t Float4;
+typedef v128_t Int4;
+#else
+#define kFloat4Implementation "portable"
+typedef struct { float v[4]; } Float4;
+typedef struct { int32_t v[4]; } Int4;
+#endif
+
+/* Loads four floats from `p`. `p` does not need to be aligned. */
+static Float4 Float4Load(const float* p) {
+#if defined(FLOAT4_USE_SSE)
+  return _mm_loadu_ps(p);
+#elif defined(FLOAT4_USE_NEON)
+  return vld1q_f32(p);
+#elif defined(FLOAT4_USE_WASM)
+  return wasm_v128_load(p);
+#else
+  Float4 r;
+  r.v[0] = p[0];
+  r.v[1] = p[1];
+  r.v[2] = p[2];
+  r.v[3] = p[3];
+  return r;
+#endif
+}
+
+/* Stores four floats to `p`. `p` does not need to be aligned. */
+static void Float4Store(float* p, Float4 a) {
+#if defined(FLOAT4_USE_SSE)
+  _mm_storeu_ps(p, a);
+#elif defined(FLOAT4_USE_NEON)
+  vst1q_f32(p, a);
+#elif defined(FLOAT4_USE_WASM)
+  wasm_v128_store(p, a);
+#else
+  p[0] = a.v[0];
+  p[1] = a.v[1];
+  p[2] = a.v[2];
+  p[3] = a.v[3];
+#endif
+}
+
+/* Returns `x` broadcast to all four lanes. */
+static Float4 Float4Broadcast(float x) {
+#if defined(FLOAT4_USE_SSE)
+  return _mm_set1_ps(x);
+#elif defined(FLOAT4_USE_NEON)
+  return vdupq_n_f32(x);
+#elif defined(FLOAT4_USE_WASM)
+  return wasm_f32x4_splat(x);
+#else
+  Float4 r;
+  r.v[0] = x;
+  r.v[1] = x;
+  r.v[2] = x;
+  r.v[3] = x;
+  return r;
+#endif
+}
+
+/* Portable fallback implementations of elementwise binary ops. */
+#if !defined(FLOAT4_USE_SSE) && !defined(FLOAT4_USE_NEON) && \
+    !defined(FLOAT4_USE_WASM)
+#define FLOAT4_PORTABLE_BINARY_OP(a, b, expr)      \
+  Float4 r;                                        \
+  int i;                                           \
+  for (i = 0; i < 4; ++i) {                        \
+    const float x = (a).v[i];                      \
+    const float y = (b).v[i];                      \
+    r.v[i] = (expr);                               \
+  }                                                \
+  return r
+#endif
+
+/* Returns elementwise a + b. */
+static Float4 Float4Add(Float4 a, Float4 b) {
+#if defined(FLOAT4_USE_SSE)
+  return _mm_add_ps(a, b);
+#elif defined(FLOAT4_USE_NEON)
+  return vaddq_f32(a, b);
+#elif defined(FLOAT4_USE_WASM)
+  return wasm_f32x4_add(a, b);
+#else
+  FLOAT4_PORTABLE_BINARY_OP(a, b, x + y);
+#endif
+}
+
+/* Returns elementwise a - b. */
+static Float4 Float4Sub(Float4 a, Float4 b) {
+#if defined(FLOAT4_USE_SSE)
+  return _mm_sub_ps(a, b);
+#elif defined(FLOAT4_USE_NEON)
+  return vsubq_f32(a, b);
+#elif defined(FLOAT4_USE_WASM)
+  return wasm_f32x4_sub(a, b);
+#else
+  FLOAT4_PORTABLE_BINARY_OP(a, b, x - y);
+#endif
+}
+
+/* Returns elementwise a * b. */
+static Float4 Float4Mul(Float4 a, Float4 b) {
+#if defined(FLOAT4_USE_SSE)
+  return _mm_mul_ps(a, b);
+#elif defined(FLOAT4_USE_NEON)
+  return vmulq_f32(a, b);
+#elif defined(FLOAT4_USE_WASM)
+  return wasm_f32x4_mul(a, b);
+#else
+  FLOAT4_PORTABLE_BINARY_OP(a, b, x * y);
+#endif
+}
+
+/* Returns elementwise a / b. */
+static Float4 Float4Div(Float4 a, Float4 b) {
+#if defined(FLOAT4_USE_SSE)
+  return _mm_div_ps(a, b);
+#elif defined(FLOAT4_USE_NEON) && defined(__aarch64__)
+  return vdivq_f32(a, b);
+#elif defined(FLOAT4_USE_NEON)
+  /* ARMv7 NEON has no divide. Refine the reciprocal estimate with two Newton
+   * steps, which is accurate to about 1 ulp.
+   */
+  float32x4_t recip = vrecpeq_f32(b);
+  recip = vmulq_f32(vrecpsq_f32(b, recip), recip);
+  recip = vmulq_f32(vrecpsq_f32(b, recip), recip);
+  return vmulq_f32(a, recip);
+#elif defined(FLOAT4_USE_WASM)
+  return wasm_f32x4_div(a, b);
+#else
+  FLOAT4_PORTABLE_BINARY_OP(a, b, x / y);
+#endif
+}
+
+/* Returns elementwise `(a < b) ? a : b`. Like the ternary expression, b is
+ * returned if either argument is NaN. (This differs from fminf.)
+ */
+static Float4 Float4Min(Float4 a, Float4 b) {
+#if defined(FLOAT4_USE_SSE)
+  return _mm_min_ps(a, b);
+#elif defined(FLOAT4_USE_NEON)
+  return vbslq_f32(vcltq_f32(a, b), a, b);
+#elif defined(FLOAT4_USE_WASM)
+  return wasm_f32x4_pmin(b, a);  /* = (a < b) ? a : b. */
+#else
+  FLOAT4_PORTABLE_BINARY_OP(a, b, (x < y) ? x : y);
+#endif
+}
+
+/* Returns elementwise `(a > b) ? a : b`. Like the ternary expression, b is
+ * returned if either argument is NaN. (This differs from fmaxf.)
+ */
+static Float4 Float4Max(Float4 a, Float4 b) {
+#if defined(FLOAT4_USE_SSE)
+  return _mm_max_ps(a, b);
+#elif defined(FLOAT4_USE_NEON)
+  return vbslq_f32(vcgtq_f32(a, b), a, b);
+#elif defined(FLOAT4_USE_WASM)
+  return wasm_f32x4_pmax(b, a);  /* = (b < a) ? a : b. */
+#else
+  FLOAT4_PORTABLE_BINARY_OP(a, b, (x > y) ? x : y);
+#endif
+}
+
+/* Returns `{x, a[0], a[1], a[2]}`, shifting the lanes of `a` up by one and
+ * inserting `x` in lane 0. This is useful for pipelining a cascade of filters
+ * across the lanes, where lane i feeds lane i + 1.
+ */
+static Float4 Float4ShiftLanesUp(Float4 a, float x) {
+#if defined(FLOAT4_USE_SSE)
+  return _mm_move_ss(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 1, 0, 0)),
+                     _mm_set_ss(x));
+#elif defined(FLOAT4_USE_NEON)
+  return vextq_f32(vdupq_n_f32(x), a, 3);
+#elif defined(FLOAT4_USE_WASM)
+  return wasm_i32x4_shuffle(wasm_f32x4_splat(x), a, 0, 4, 5, 6);
+#else
+  Float4 r;
+  r.v[0] = x;
+  r.v[1] = a.v[0];
+  r.v[2] = a.v[1];
+  r.v[3] = a.v[2];
+  return r;
+#endif
+}
+
+/* Returns `{a[1], a[2], a[3], x}`, shifting the lanes of `a` down by one and
+ * inserting `x` in lane 3.
+ */
+static Float4 Float4ShiftLanesDown(Float4 a, float x) {
+#if defined(FLOAT4_USE_SSE)
+  const __m128 t = _mm_move_ss(a, _mm_set_ss(x));  /* = {x, a1, a2, a3}. */
+  return _mm_shuffle_ps(t, t, _MM_SHUFFLE(0, 3, 2, 1));
+#elif defined(FLOAT4_USE_NEON)
+  return vextq_f32(a, vdupq_n_f32(x), 1);
+#elif defined(FLOAT4_USE_WASM)
+  return wasm_i32x4_shuffle(a, wasm_f32x4_splat(x), 1, 2, 3, 4);
+#else
+  Float4 r;
+  r.v[0] = a.v[1];
+  r.v[1] = a.v[2];
+  r.v[2] = a.v[3];
+  r.v[3] = x;
+  return r;
+#endif
+}
+
+/* Returns `{a[1], a[0], a[3], a[2]}`, swapping adjacent pairs of lanes. For
+ * interleaved complex values, this swaps real and imaginary parts.
+ */
+static Float4 Float4SwapPairs(Float4 a) {
+#if defined(FLOAT4_USE_SSE)
+  return _mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1));
+#elif defined(FLOAT4_USE_NEON)
+  return vrev64q_f32(a);
+#elif defined(FLOAT4_USE_WASM)
+  return wasm_i32x4_shuffle(a, a, 1, 0, 3, 2);
+#else
+  Float4 r;
+  r.v[0] = a.v[1];
+  r.v[1] = a.v[0];
+  r.v[2] = a.v[3];
+  r.v[3] = a.v[2];
+  return r;
+#endif
+}
+
+/* Returns `{a[0], a[0], a[2], a[2]}`, duplicating the even lanes. */
+static Float4 Float4DupEven(Float4 a) {
+#if defined(FLOAT4_USE_SSE)
+  return _mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 2, 0, 0));
+#elif defined(FLOAT4_USE_NEON)
+  return vtrnq_f32(a, a).val[0];
+#elif defined(FLOAT4_USE_WASM)
+  return wasm_i32x4_shuffle(a, a, 0, 0, 2, 2);
+#else
+  Float4 r;
+  r.v[0] = r.v[1] = a.v[0];
+  r.v[2] = r.v[3] = a.v[2];
+  return r;
+#endif
+}
+
+/* Returns `{a[1], a[1], a[3], a[3]}`, duplicating the odd lanes. */
+static Float4 Float4DupOdd(Float4 a) {
+#if defined(FLOAT4_USE_SSE)
+  return _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 3, 1, 1));
+#elif defined(FLOAT4_USE_NEON)
+  return vtrnq_f32(a, a).val[1];
+#elif defined(FLOAT4_USE_WASM)
+  return wasm_i32x4_shuffle(a, a, 1, 1, 3, 3);
+#else
+  Float4 r;
+  r.v[0] = r.v[1] = a.v[1];
+  r.v[2] = r.v[3] = a.v[3];
+  return r;
+#endif
+}
+
+/* Returns `{a[0] + a[1], a[2] + a[3], b[0] + b[1], b[2] + b[3]}`, the sums of
+ * adjacent pairs of lanes.
+ */
+static Float4 Float4PairwiseAdd(Float4 a, Float4 b) {
+#if defined(FLOAT4_USE_SSE)
+  return _mm_add_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)),
+                    _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1)));
+#elif defined(FLOAT4_USE_NEON) && defined(__aarch64__)
+  return vpaddq_f32(a, b);
+#elif defined(FLOAT4_USE_NEON)
+  return vcombine_f32(vpadd_f32(vget_low_f32(a), vget_high_f32(a)),
+                      vpadd_f32(vget_low_f32(b), vget_high_f32(b)));
+#elif defined(FLOAT4_USE_WASM)
+  return wasm_f32x4_add(wasm_i32x4_shuffle(a, b, 0, 2, 4, 6),
+                        wasm_i32x4_shuffle(a, b, 1, 3, 5, 7));
+#else
+  Float4 r;
+  r.v[0] = a.v[0] + a.v[1];
+  r.v[1] = a.v[2] + a.v[3];
+  r.v[2] = b.v[0] + b.v[1];
+  r.v[3] = b.v[2] + b.v[3];
+  return r;
+#endif
+}
+
+/* Int4 ops. ________________________________________________________________ */
+
+/* Portable fallback implementations of elementwise Int4 ops. */
+#if !defined(FLOAT4_USE_SSE) && !defined(FLOAT4_USE_NEON) && \
+    !defined(FLOAT4_USE_WASM)
+#define INT4_PORTABLE_OP(expr)                     \
+  Int4 r;                                          \
+  int i;                                           \
+  for (i = 0; i < 4; ++i) {                        \
+    r.v[i] = (expr);                               \
+  }                                                \
+  return r
+#endif
+
+/* Returns `x` broadcast to all four lanes. */
+static Int4 Int4Broadcast(int32_t x) {
+#if defined(FLOAT4_USE_SSE)
+  return _mm_set1_epi32(x);
+#elif defined(FLOAT4_USE_NEON)
+  return vdupq_n_s32(x);
+#elif defined(FLOAT4_USE_WASM)
+  return wasm_i32x4_splat(x);
+#else
+  INT4_PORTABLE_OP(x);
+#endif
+}
+
+/* Loads four int32_t values from `p`. `p` does not need to be aligned. */
+static Int4 Int4Load(const int32_t* p) {
+#if defined(FLOAT4_USE_SSE)
+  return _mm_loadu_si128((const __m128i*)p);
+#elif defined(FLOAT4_USE_NEON)
+  return vld1q_s32(p);
+#elif defined(FLOAT4_USE_WASM)
+  return wasm_v128_load(p);
+#else
+  Int4 r;
+  memcpy(r.v, p, sizeof(r.v));
+  return r;
+#endif
+}
+
+/* Stores four int32_t values to `p`. `p` does not need to be aligned. */
+static void Int4Store(int32_t* p, Int4 a) {
+#if defined(FLOAT4_USE_SSE)
+  _mm_storeu_si128((__m128i*)p, a);
+#elif defined(FLOAT4_USE_NEON)
+  vst1q_s32(p, a);
+#elif defined(FLOAT4_USE_WASM)
+  wasm_v128_store(p, a);
+#else
+  memcpy(p, a.v, sizeof(a.v));
+#endif
+}
+
+/* Loads four int16_t values from `p`, sign extended to int32_t. `p` does not
+ * need to be aligned.
+ */
+static Int4 Int4LoadInt16(const int16_t* p) {
+#if defined(FLOAT4_USE_SSE)
+  const __m128i x = _mm_loadl_epi64((const __m128i*)p);
+  /* Interleave into the upper half of each lane, then shift down. */
+  return _mm_srai_epi32(_mm_unpacklo_epi16(_mm_setzero_si128(), x), 16);
+#elif defined(FLOAT4_USE_NEON)
+  return vmovl_s16(vld1_s16(p));
+#elif defined(FLOAT4_USE_WASM)
+  return wasm_i32x4_load16x4(p);
+#else
+  INT4_PORTABLE_OP(p[i]);
+#endif
+}
+
+/* Stores four int32_t values to `p` as int16_t, saturating to int16_t range.
+ * `p` does not need to be aligned.
+ */
+static void Int4StoreInt16Saturate(int16_t* p, Int4 a) {
+#if defined(FLOAT4_USE_SSE)
+  _mm_storel_epi64((__m128i*)p, _mm_packs_epi32(a, a));
+#elif defined(FLOAT4_USE_NEON)
+  vst1_s16(p, vqmovn_s32(a));
+#elif defined(FLOAT4_USE_WASM)
+  wasm_v128_store64_lane(p, wasm_i16x8_narrow_i32x4(a, a), 0);
+#else
+  int i;
+  for (i = 0; i < 4; ++i) {
+#if defined(__ARM_FEATURE_SAT)
+    p[i] = (int16_t)__ssat(a.v[i], 16);
+#else
+    const int32_t x = a.v[i];
+    p[i] = (int16_t)((x < INT16_MIN) ? INT16_MIN : (x > INT16_MAX) ? INT16_MAX
+                                                                   : x);
+#endif
+  }
+#endif
+}
+
+/* Stores four int32_t values to `p` as uint16_t, saturating to [0, 65535].
+ * `p` does not need to be aligned. With SSE2, values should be at least
+ * -2^31 + 2^15.
+ */
+static void Int4StoreUint16Saturate(uint16_t* p, Int4 a) {
+#if defined(FLOAT4_USE_SSE)
+  /* SSE2 has only signed saturation, so offset to int16_t range and back. */
+  __m128i x = _mm_packs_epi32(_mm_sub_epi32(a, _mm_set1_epi32(32768)),
+                              _mm_setzero_si128());
+  x = _mm_xor_si128(x, _mm_set1_epi16((int16_t)0x8000));
+  _mm_storel_epi64((__m128i*)p, x);
+#elif defined(FLOAT4_USE_NEON)
+  vst1_u16(p, vqmovun_s32(a));
+#elif defined(FLOAT4_USE_WASM)
+  wasm_v128_store64_lane(p, wasm_u16x8_narrow_i32x4(a, a), 0);
+#else
+  int i;
+  for (i = 0; i < 4; ++i) {
+#if defined(__ARM_FEATURE_SAT)
+    p[i] = (uint16_t)__usat(a.v[i], 16);
+#else
+    const int32_t x = a.v[i];
+    p[i] = (uint16_t)((x < 0) ? 0 : (x > UINT16_MAX) ? UINT16_MAX : x);
+#endif
+  }
+#endif
+}
+
+/* Returns elementwise a + b, wrapping on overflow. */
+static Int4 Int4Add(Int4 a, Int4 b) {
+#if defined(FLOAT4_USE_SSE)
+  return _mm_add_epi32(a, b);
+#elif defined(FLOAT4_USE_NEON)
+  return vaddq_s32(a, b);
+#elif defined(FLOAT4_USE_WASM)
+  return wasm_i32x4_add(a, b);
+#else
+  INT4_PORTABLE_OP((int32_t)((uint32_t)a.v[i] + (uint32_t)b.v[i]));
+#endif
+}
+
+/* Returns elementwise a - b, wrapping on overflow. */
+static Int4 Int4Sub(Int4 a, Int4 b) {
+#if defined(FLOAT4_USE_SSE)
+  return _mm_sub_epi32(a, b);
+#elif defined(FLOAT4_USE_NEON)
+  return vsubq_s32(a, b);
+#elif defined(FLOAT4_USE_WASM)
+  return wasm_i32x4_sub(a, b);
+#else
+  INT4_PORTABLE_OP((int32_t)((uint32_t)a.v[i] - (uint32_t)b.v[i]));
+#endif
+}
+
+/* Returns elementwise bitwise a & b. */
+static Int4 Int4And(Int4 a, Int4 b) {
+#if defined(FLOAT4_USE_SSE)
+  return _mm_and_si128(a, b);
+#elif defined(FLOAT4_USE_NEON)
+  return vandq_s32(a, b);
+#elif defined(FLOAT4_USE_WASM)
+  return wasm_v128_and(a, b);
+#else
+  INT4_PORTABLE_OP(a.v[i] & b.v[i]);
+#endif
+}
+
+/* Returns elementwise bitwise a | b. */
+static Int4 Int4Or(Int4 a, Int4 b) {
+#if defined(FLOAT4_USE_SSE)
+  return _mm_or_si128(a, b);
+#elif defined(FLOAT4_USE_NEON)
+  return vorrq_s32(a, b);
+#elif defined(FLOAT4_USE_WASM)
+  return wasm_v128_or(a, b);
+#else
+  INT4_PORTABLE_OP(a.v[i] | b.v[i]);
+#endif
+}
+
+/* Returns elementwise a << n for 0 <= n < 32. */
+static Int4 Int4ShiftLeft(Int4 a, int n) {
+#if defined(FLOAT4_USE_SSE)
+  return _mm_sll_epi32(a, _mm_cvtsi32_si128(n));
+#elif defined(FLOAT4_USE_NEON)
+  return vshlq_s32(a, vdupq_n_s32(n));
+#elif defined(FLOAT4_USE_WASM)
+  return wasm_i32x4_shl(a, n);
+#else
+  INT4_PORTABLE_OP((int32_t)((uint32_t)a.v[i] << n));
+#endif
+}
+
+/* Returns elementwise arithmetic right shift a >> n for 0 <= n < 32. */
+static Int4 Int4ShiftRight(Int4 a, int n) {
+#if defined(FLOAT4_USE_SSE)
+  return _mm_sra_epi32(a, _mm_cvtsi32_si128(n));
+#elif defined(FLOAT4_USE_NEON)
+  return vshlq_s32(a, vdupq_n_s32(-n));
+#elif defined(FLOAT4_USE_WASM)
+  return wasm_i32x4_shr(a, n);
+#else
+  /* Right shift of negative values is assumed arithmetic, as in GCC and Clang.
+   */
+  INT4_PORTABLE_OP(a.v[i] >> n);
+#endif
+}
+
+/* Converts Int4 values to Float4, e.g. {1, -2, 3, 4} -> {1.0f, -2.0f, ...}. */
+static Float4 Int4ToFloat4(Int4 a) {
+#if defined(FLOAT4_USE_SSE)
+  return _mm_cvtepi32_ps(a);
+#elif defined(FLOAT4_USE_NEON)
+  return vcvtq_f32_s32(a);
+#elif defined(FLOAT4_USE_WASM)
+  return wasm_f32x4_convert_i32x4(a);
+#else
+  Float4 r;
+  int i;
+  for (i = 0; i < 4; ++i) {
+    r.v[i] = (float)a.v[i];
+  }
+  return r;
+#endif
+}
+
+/* Converts Float4 values to Int4 by truncating toward zero, like a C cast
+ * for each lane, e.g. {1.7f, -2.7f, ...} -> {1, -2, ...}. Values should be in
+ * int32_t range.
+ */
+static Int4 Float4ToInt4(Float4 a) {
+#if defined(FLOAT4_USE_SSE)
+  return _mm_cvttps_epi32(a);
+#elif defined(FLOAT4_USE_NEON)
+  return vcvtq_s32_f32(a);
+#elif defined(FLOAT4_USE_WASM)
+  return wasm_i32x4_trunc_sat_f32x4(a);
+#else
+  Int4 r;
+  int i;
+  for (i = 0; i < 4; ++i) {
+    r.v[i] = (int32_t)a.v[i];
+  }
+  return r;
+#endif
+}
+
+/* Reinterprets the bits of a Float4 as Int4, like memcpy for each lane. */
+static Int4 Float4AsInt4(Float4 a) {
+#if defined(FLOAT4_USE_SSE)
+  return _mm_castps_si128(a);
+#elif defined(FLOAT4_USE_NEON)
+  return vreinterpretq_s32_f32(a);
+#elif defined(FLOAT4_USE_WASM)
+  return a;  /* Float4 and Int4 are both v128_t. */
+#else
+  Int4 r;
+  memcpy(r.v, a.v, sizeof(r.v));
+  return r;
+#endif
+}
+
+/* Reinterprets the bits of an Int4 as Float4. */
+static Float4 Int4AsFloat4(Int4 a) {
+#if defined(FLOAT4_USE_SSE)
+  return _mm_castsi128_ps(a);
+#elif defined(FLOAT4_USE_NEON)
+  return vreinterpretq_f32_s32(a);
+#elif defined(FLOAT4_USE_WASM)
+  return a;
+#else
+  Float4 r;
+  memcpy(r.v, a.v, sizeof(r.v));
+  return r;
+#endif
+}
+
+/* Comparisons. ______________________________________________________________
+ * Comparisons return a mask with all bits set (-1) in lanes where the
+ * comparison is true and zero elsewhere. Like scalar comparisons, they are
+ * false if either argument is NaN.
+ */
+
+/* Returns elementwise mask of `a < b`. */
+static Int4 Float4LessThan(Float4 a, Float4 b) {
+#if defined(FLOAT4_USE_SSE)
+  return _mm_castps_si128(_mm_cmplt_ps(a, b));
+#elif defined(FLOAT4_USE_NEON)
+  return vreinterpretq_s32_u32(vcltq_f32(a, b));
+#elif defined(FLOAT4_USE_WASM)
+  return wasm_f32x4_lt(a, b);
+#else
+  INT4_PORTABLE_OP((a.v[i] < b.v[i]) ? -1 : 0);
+#endif
+}
+
+/* Returns elementwise mask of `a <= b`. */
+static Int4 Float4LessEqual(Float4 a, Float4 b) {
+#if defined(FLOAT4_USE_SSE)
+  return _mm_castps_si128(_mm_cmple_ps(a, b));
+#elif defined(FLOAT4_USE_NEON)
+  return vreinterpretq_s32_u32(vcleq_f32(a, b));
+#elif defined(FLOAT4_USE_WASM)
+  return wasm_f32x4_le(a, b);
+#else
+  INT4_PORTABLE_OP((a.v[i] <= b.v[i]) ? -1 : 0);
+#endif
+}
+
+/* Returns elementwise `mask ? a : b`, where `mask` is a comparison result. */
+static Float4 Float4Select(Int4 mask, Float4 a, Float4 b) {
+#if defined(FLOAT4_USE_SSE)
+  const __m128 m = _mm_castsi128_ps(mask);
+  return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b));
+#elif defined(FLOAT4_USE_NEON)
+  return vbslq_f32(vreinterpretq_u32_s32(mask), a, b);
+#elif defined(FLOAT4_USE_WASM)
+  return wasm_v128_bitselect(a, b, mask);
+#else
+  FLOAT4_PORTABLE_BINARY_OP(a, b, mask.v[i] ? x : y);
+#endif
+}
+
+/* Returns lane `i` of `a`, where 0 <= i < 4. This is slow and intended for
+ * setup and tests rather than inner loops.
+ */
+static float Float4GetLane(Float4 a, int i) {
+  float values[4];
+  Float4Store(values, a);
+  return values[i];
+}
+
+/* Returns lane `i` of `a`, where 0 <= i < 4. This is slow and intended for
+ * setup and tests rather than inner loops.
+ */
+static int32_t Int4GetLane(Int4 a, int i) {
+  int32_t values[4];
+  Int4Store(values, a);
+  return values[i];
+}
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif
+#endif /* AUDIO_TO_TACTILE_SRC_DSP_SIMD_H_ */
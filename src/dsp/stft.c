@@ -0,0 +1,319 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/stft.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "dsp/aligned_alloc.h"
+#include "dsp/complex.h"
+#include "dsp/dot_product.h"
+#include "dsp/fft.h"
+#include "dsp/math_constants.h"
+
+const StftOptions kStftDefaultOptions = {
+    /*window=*/NULL,
+    /*pooling=*/kStftNoPooling,
+    /*num_bands=*/40,
+    /*min_frequency_hz=*/0.0f,
+    /*max_frequency_hz=*/0.0f,
+};
+
+struct Stft {
+  float sample_rate_hz;
+  int frame_size;
+  int hop_size;
+  /* Number of power spectrum bins, frame_size / 2 + 1. */
+  int num_bins;
+  /* Window, scaled by 1 / sum of the window to normalize power. */
+  float* window;
+  /* Buffered input, the last `buffer_fill` samples received. */
+  float* buffer;
+  int buffer_fill;
+  /* Workspace of frame_size floats, viewed as frame_size / 2 ComplexFloats for
+   * the real FFT.
+   */
+  float* fft_data;
+
+  /* Pooling, or num_bands = 0 if disabled. Band b is the dot product of
+   * `band_num_bins[b]` weights starting at `weights + band_weight_offset[b]`
+   * with the power spectrum starting at bin `band_first_bin[b]`.
+   */
+  int num_bands;
+  float* power;
+  int* band_first_bin;
+  int* band_num_bins;
+  int* band_weight_offset;
+  float* weights;
+  float* band_center_hz;
+};
+
+/* Converts Hz to mel or ERB-rate scale. */
+static double HzToScale(StftPooling pooling, double frequency_hz) {
+  return (pooling == kStftMelPooling)
+             ? 2595.0 * log10(1.0 + frequency_hz / 700.0)
+             : 21.4 * log10(1.0 + 0.00437 * frequency_hz);
+}
+
+/* Converts mel or ERB-rate scale to Hz, the inverse of HzToScale(). */
+static double ScaleToHz(StftPooling pooling, double value) {
+  return (pooling == kStftMelPooling)
+             ? 700.0 * (pow(10.0, value / 2595.0) - 1.0)
+             : (pow(10.0, value / 21.4) - 1.0) / 0.00437;
+}
+
+/* Triangle with vertices at frequencies `lo`, `center`, `hi`, evaluated at `f`.
+ */
+static double Triangle(double lo, double center, double hi, double f) {
+  if (f <= lo || f >= hi) { return 0.0; }
+  return (f < center) ? (f - lo) / (center - lo) : (hi - f) / (hi - center);
+}
+
+/* Designs the pooling filters. Returns 1 on success, 0 on failure. */
+static int DesignBands(Stft* stft, const StftOptions* options) {
+  const int num_bands = options->num_bands;
+  const double nyquist_hz = stft->sample_rate_hz / 2.0;
+  const double min_hz = options->min_frequency_hz;
+  const double max_hz = (options->max_frequency_hz > 0.0f)
+                            ? options->max_frequency_hz : nyquist_hz;
+  const double bin_hz = (double)stft->sample_rate_hz / stft->frame_size;
+  if (!(num_bands >= 1 && 0.0 <= min_hz && min_hz < max_hz &&
+        max_hz <= nyquist_hz)) {
+    fprintf(stderr, "Error: Invalid Stft bands: %d bands, %g to %g Hz.\n",
+            num_bands, min_hz, max_hz);
+    return 0;
+  }
+
+  /* Band edge frequencies, evenly spaced on the scale. */
+  double* edges_hz = (double*)malloc(sizeof(double) * (num_bands + 2));
+  stft->num_bands = num_bands;
+  stft->power = (float*)AlignedAlloc(sizeof(float) * stft->num_bins);
+  stft->band_first_bin = (int*)AlignedAlloc(sizeof(int) * num_bands);
+  stft->band_num_bins = (int*)AlignedAlloc(sizeof(int) * num_bands);
+  stft->band_weight_offset = (int*)AlignedAlloc(sizeof(int) * num_bands);
+  stft->band_center_hz = (float*)AlignedAlloc(sizeof(float) * num_bands);
+  /* Each bin is in at most two triangles, plus one weight per band narrower
+   * than the bin spacing, so this is enough for all weights.
+   */
+  stft->weights =
+      (float*)AlignedAlloc(sizeof(float) * (2 * stft->num_bins + num_bands));
+  if (edges_hz == NULL || stft->power == NULL ||
+      stft->band_first_bin == NULL || stft->band_num_bins == NULL ||
+      stft->band_weight_offset == NULL || stft->band_center_hz == NULL ||
+      stft->weights == NULL) {
+    fprintf(stderr, "Error: Memory allocation failed.\n");
+    free(edges_hz);
+    return 0;
+  }
+
+  const double min_scale = HzToScale(options->pooling, min_hz);
+  const double max_scale = HzToScale(options->pooling, max_hz);
+  int j;
+  for (j = 0; j < num_bands + 2; ++j) {
+    edges_hz[j] = ScaleToHz(options->pooling, min_scale +
+        (max_scale - min_scale) * j / (num_bands + 1));
+  }
+
+  int num_weights = 0;
+  int b;
+  for (b = 0; b < num_bands; ++b) {
+    const double lo = edges_hz[b];
+    const double center = edges_hz[b + 1];
+    const double hi = edges_hz[b + 2];
+    int first_bin = (int)floor(lo / bin_hz) + 1;
+    int last_bin = (int)ceil(hi / bin_hz) - 1;
+    if (last_bin > stft->num_bins - 1) { last_bin = stft->num_bins - 1; }
+
+    stft->band_weight_offset[b] = num_weights;
+    stft->band_center_hz[b] = (float)center;
+    if (first_bin > last_bin) {
+      /* The band is narrower than the bin spacing. Use the nearest bin so that
+       * the band is not always zero.
+       */
+      first_bin = (int)floor(center / bin_hz + 0.5);
+      if (first_bin > stft->num_bins - 1) { first_bin = stft->num_bins - 1; }
+      stft->weights[num_weights++] = 1.0f;
+      stft->band_first_bin[b] = first_bin;
+      stft->band_num_bins[b] = 1;
+      continue;
+    }
+
+    int k;
+    for (k = first_bin; k <= last_bin; ++k) {
+      stft->weights[num_weights++] =
+          (float)Triangle(lo, center, hi, k * bin_hz);
+    }
+    stft->band_first_bin[b] = first_bin;
+    stft->band_num_bins[b] = last_bin - first_bin + 1;
+  }
+
+  free(edges_hz);
+  return 1;
+}
+
+Stft* StftMake(float sample_rate_hz, int frame_size, int hop_size,
+               const StftOptions* options) {
+  if (!(sample_rate_hz > 0.0f && 4 <= frame_size &&
+        frame_size <= kFftMaxTransformSize &&
+        (frame_size & (frame_size - 1)) == 0 &&
+        1 <= hop_size && hop_size <= frame_size)) {
+    fprintf(stderr, "Error: Invalid Stft frame_size %d, hop_size %d.\n",
+            frame_size, hop_size);
+    return NULL;
+  }
+  if (options == NULL) {
+    options = &kStftDefaultOptions;
+  }
+
+  Stft* stft = (Stft*)AlignedAlloc(sizeof(Stft));
+  if (stft == NULL) {
+    fprintf(stderr, "Error: Memory allocation failed.\n");
+    return NULL;
+  }
+  memset(stft, 0, sizeof(Stft));
+  stft->sample_rate_hz = sample_rate_hz;
+  stft->frame_size = frame_size;
+  stft->hop_size = hop_size;
+  stft->num_bins = frame_size / 2 + 1;
+
+  stft->window = (float*)AlignedAlloc(sizeof(float) * frame_size);
+  stft->buffer = (float*)AlignedAlloc(sizeof(float) * frame_size);
+  stft->fft_data = (float*)AlignedAlloc(sizeof(float) * frame_size);
+  if (stft->window == NULL || stft->buffer == NULL ||
+      stft->fft_data == NULL) {
+    fprintf(stderr, "Error: Memory allocation failed.\n");
+    goto fail;
+  }
+
+  /* Compute the window, normalized to unit sum. */
+  double window_sum = 0.0;
+  int n;
+  for (n = 0; n < frame_size; ++n) {
+    const double w = (options->window != NULL)
+        ? options->window[n] : 0.5 - 0.5 * cos(2.0 * M_PI * n / frame_size);
+    stft->window[n] = (float)w;
+    window_sum += w;
+  }
+  if (!(window_sum > 0.0)) {
+    fprintf(stderr, "Error: Stft window must have positive sum.\n");
+    goto fail;
+  }
+  for (n = 0; n < frame_size; ++n) {
+    stft->window[n] = (float)(stft->window[n] / window_sum);
+  }
+
+  if (options->pooling != kStftNoPooling && !DesignBands(stft, options)) {
+    goto fail;
+  }
+
+  StftReset(stft);
+  return stft;
+
+fail:
+  StftFree(stft);
+  return NULL;
+}
+
+void StftFree(Stft* stft) {
+  if (stft == NULL) { return; }
+  AlignedFree(stft->band_center_hz);
+  AlignedFree(stft->weights);
+  AlignedFree(stft->band_weight_offset);
+  AlignedFree(stft->band_num_bins);
+  AlignedFree(stft->band_first_bin);
+  AlignedFree(stft->power);
+  AlignedFree(stft->fft_data);
+  AlignedFree(stft->buffer);
+  AlignedFree(stft->window);
+  AlignedFree(stft);
+}
+
+void StftReset(Stft* stft) {
+  stft->buffer_fill = 0;
+}
+
+int StftNumOutputs(const Stft* stft) {
+  return (stft->num_bands > 0) ? stft->num_bands : stft->num_bins;
+}
+
+int StftNextNumFrames(const Stft* stft, int num_samples) {
+  const int total = stft->buffer_fill + num_samples;
+  if (total < stft->frame_size) { return 0; }
+  return (total - stft->frame_size) / stft->hop_size + 1;
+}
+
+/* Computes the output for the frame in `stft->buffer`. */
+static void ComputeFrame(Stft* stft, float* output) {
+  const int frame_size = stft->frame_size;
+  const int half_size = frame_size / 2;
+  float* data = stft->fft_data;
+  int n;
+  for (n = 0; n < frame_size; ++n) {
+    data[n] = stft->window[n] * stft->buffer[n];
+  }
+
+  ComplexFloat* spectrum = (ComplexFloat*)data;
+  FftForwardRealTransform(spectrum, frame_size);
+
+  /* Unpack the DC and Nyquist coefficients, which share spectrum[0]. */
+  float* power = (stft->num_bands > 0) ? stft->power : output;
+  power[0] = spectrum[0].real * spectrum[0].real;
+  power[half_size] = spectrum[0].imag * spectrum[0].imag;
+  ComplexFloatArrayAbs2(spectrum + 1, half_size - 1, power + 1);
+
+  int b;
+  for (b = 0; b < stft->num_bands; ++b) {
+    output[b] = MonoDotProduct(stft->weights + stft->band_weight_offset[b],
+                               power + stft->band_first_bin[b],
+                               stft->band_num_bins[b]);
+  }
+}
+
+int StftProcessSamples(Stft* stft, const float* input, int num_samples,
+                       float* output) {
+  const int frame_size = stft->frame_size;
+  const int hop_size = stft->hop_size;
+  const int num_outputs = StftNumOutputs(stft);
+  int num_frames = 0;
+
+  while (num_samples > 0) {
+    int count = frame_size - stft->buffer_fill;
+    if (count > num_samples) { count = num_samples; }
+    memcpy(stft->buffer + stft->buffer_fill, input, sizeof(float) * count);
+    stft->buffer_fill += count;
+    input += count;
+    num_samples -= count;
+
+    if (stft->buffer_fill == frame_size) {
+      ComputeFrame(stft, output);
+      output += num_outputs;
+      ++num_frames;
+      /* Discard the oldest hop_size samples. */
+      memmove(stft->buffer, stft->buffer + hop_size,
+              sizeof(float) * (frame_size - hop_size));
+      stft->buffer_fill = frame_size - hop_size;
+    }
+  }
+  return num_frames;
+}
+
+float StftOutputFrequencyHz(const Stft* stft, int index) {
+  return (stft->num_bands > 0)
+             ? stft->band_center_hz[index]
+             : index * stft->sample_rate_hz / stft->frame_size;
+}
@@ -0,0 +1,130 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * Streaming short-time Fourier transform (STFT) power spectrogram.
+ *
+ * `Stft` computes a power spectrogram of a mono input signal in a streaming
+ * manner, for visualization and analysis. Input samples are buffered and every
+ * `hop_size` samples, the most recent `frame_size` samples are windowed and
+ * transformed with FftForwardRealTransform() (see fft.h), which packs the real
+ * input as half-size complex data for the scrambled FFT. The first frame is
+ * produced once `frame_size` samples have been received, so that frame i
+ * covers input samples [i * hop_size, i * hop_size + frame_size).
+ *
+ * Each frame's output is either the power spectrum, `frame_size / 2 + 1` bins
+ * from DC to Nyquist, or optionally pooled into bands with triangular filters
+ * evenly spaced on the mel or ERB-rate scale. Power is normalized by the
+ * window sum, so that a sinusoid of amplitude A centered on a bin has power
+ * A^2 / 4 in that bin.
+ *
+ * Example use:
+ *   StftOptions options = kStftDefaultOptions;
+ *   options.pooling = kStftMelPooling;
+ *   options.num_bands = 40;
+ *   Stft* stft = StftMake(16000.0f, 512, 128, &options);
+ *   ...
+ *   const int num_frames = StftNextNumFrames(stft, num_samples);
+ *   float* output = malloc(sizeof(float) * num_frames * StftNumOutputs(stft));
+ *   StftProcessSamples(stft, samples, num_samples, output);
+ *   ...
+ *   StftFree(stft);
+ *
+ * Benchmarks are in extras/benchmark/stft_benchmark.cpp.
+ */
+
+#ifndef AUDIO_TO_TACTILE_SRC_DSP_STFT_H_
+#define AUDIO_TO_TACTILE_SRC_DSP_STFT_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct Stft; /* Forward declaration. */
+typedef struct Stft Stft;
+
+/* Frequency pooling of the power spectrum. */
+typedef enum {
+  /* No pooling, output the power spectrum bins. */
+  kStftNoPooling,
+  /* Triangular filters evenly spaced on the mel scale,
+   * mel = 2595 log10(1 + f / 700).
+   */
+  kStftMelPooling,
+  /* Triangular filters evenly spaced on the ERB-rate scale of Glasberg and
+   * Moore, erbs = 21.4 log10(1 + 0.00437 f).
+   */
+  kStftErbPooling
+} StftPooling;
+
+/* Detail options for Stft. */
+typedef struct {
+  /* Analysis window of `frame_size` values, or NULL to use a periodic Hann
+   * window. The window is copied by StftMake().
+   */
+  const float* window;
+  /* Frequency pooling. Default is kStftNoPooling. */
+  StftPooling pooling;
+  /* Number of pooled bands, ignored with kStftNoPooling. Default 40. */
+  int num_bands;
+  /* Frequency range in Hz covered by the pooled bands. The lowest band's
+   * triangle starts at min_frequency_hz and the highest's ends at
+   * max_frequency_hz. A max_frequency_hz of 0 means the Nyquist frequency.
+   * Defaults are 0 and 0.
+   */
+  float min_frequency_hz;
+  float max_frequency_hz;
+} StftOptions;
+extern const StftOptions kStftDefaultOptions;
+
+/* Makes an Stft for input at `sample_rate_hz`, with frames of `frame_size`
+ * samples, a power of 2 between 4 and 65536, taken every `hop_size` samples,
+ * where 1 <= hop_size <= frame_size. Pass NULL `options` to use the defaults.
+ * The caller should free it when done with `StftFree()`. Returns NULL on
+ * failure.
+ */
+Stft* StftMake(float sample_rate_hz, int frame_size, int hop_size,
+               const StftOptions* options);
+
+/* Frees an Stft. */
+void StftFree(Stft* stft);
+
+/* Resets to initial state, discarding buffered input. */
+void StftReset(Stft* stft);
+
+/* Number of output values per frame, the number of bins or bands. */
+int StftNumOutputs(const Stft* stft);
+
+/* Number of frames that the next call to StftProcessSamples() will produce,
+ * given `num_samples` input samples.
+ */
+int StftNextNumFrames(const Stft* stft, int num_samples);
+
+/* Processes `num_samples` input samples in a streaming manner, writing
+ * `StftNextNumFrames(stft, num_samples)` frames of `StftNumOutputs(stft)`
+ * values each to `output`. Returns the number of frames written.
+ */
+int StftProcessSamples(Stft* stft, const float* input, int num_samples,
+                       float* output);
+
+/* Gets the center frequency in Hz of output `index`, either a bin or the peak
+ * of a pooled band's triangle.
+ */
+float StftOutputFrequencyHz(const Stft* stft, int index);
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif
+
+#endif  /* AUDIO_TO_TACTILE_SRC_DSP_STFT_H_ */
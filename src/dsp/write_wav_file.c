@@ -46,6 +46,20 @@ int WriteWavHeader24Bit(FILE* f, size_t num_samples, int sample_rate_hz,
                                     num_channels);
 }
 
+int WriteWavHeaderFloat(FILE* f, size_t num_samples, int sample_rate_hz,
+                        int num_channels) {
+  WavWriter w = WavWriterLocal(f);
+  return WriteWavHeaderGenericFloat(&w, num_samples, sample_rate_hz,
+                                    num_channels);
+}
+
+int WriteWavHeaderRf64(FILE* f, uint64_t num_samples, int sample_rate_hz,
+                       int num_channels, WavSampleFormat format) {
+  WavWriter w = WavWriterLocal(f);
+  return WriteWavHeaderGenericRf64(&w, num_samples, sample_rate_hz,
+                                   num_channels, format);
+}
+
 int WriteWavSamples(FILE* f, const int16_t* samples, size_t num_samples) {
   WavWriter w = WavWriterLocal(f);
   return WriteWavSamplesGeneric(&w, samples, num_samples);
@@ -56,11 +70,16 @@ int WriteWavSamples24Bit(FILE* f, const int32_t* samples, size_t num_samples) {
   return WriteWavSamplesGeneric24Bit(&w, samples, num_samples);
 }
 
-int WriteWavFileInternal(const char* file_name, const void* samples,
-                         size_t num_samples, int sample_rate_hz,
-                         int num_channels, int /* bool */ is_24_bit) {
+int WriteWavSamplesFloat(FILE* f, const float* samples, size_t num_samples) {
+  WavWriter w = WavWriterLocal(f);
+  return WriteWavSamplesGenericFloat(&w, samples, num_samples);
+}
+
+static int WriteWavFileInternal(const char* file_name, const void* samples,
+                                size_t num_samples, int sample_rate_hz,
+                                int num_channels, WavSampleFormat format) {
   if (file_name == NULL || sample_rate_hz <= 0 || num_channels <= 0 ||
-      num_samples % num_channels != 0 || num_samples > (UINT32_MAX - 60) / 2) {
+      num_samples % num_channels != 0) {
     goto fail; /* Invalid input arguments. */
   }
   FILE* f = fopen(file_name, "wb");
@@ -72,25 +91,50 @@ int WriteWavFileInternal(const char* file_name, const void* samples,
     goto fail; /* Failed to open file_name for writing. */
   }
 
-  if (is_24_bit) {
-    WriteWavHeaderGeneric24Bit(&w, num_samples, sample_rate_hz, num_channels);
-  } else {
-    WriteWavHeaderGeneric(&w, num_samples, sample_rate_hz, num_channels);
+  /* Write a standard header if possible, or an RF64 header if the file is too
+   * large for RIFF.
+   */
+  int header_ok;
+  switch (format) {
+    case kWavInt16Format:
+      header_ok = WriteWavHeaderGeneric(&w, num_samples, sample_rate_hz,
+                                        num_channels);
+      break;
+    case kWavInt24Format:
+      header_ok = WriteWavHeaderGeneric24Bit(&w, num_samples, sample_rate_hz,
+                                             num_channels);
+      break;
+    default:
+      header_ok = WriteWavHeaderGenericFloat(&w, num_samples, sample_rate_hz,
+                                             num_channels);
+      break;
+  }
+  if (!header_ok && !w.has_error) {
+    WriteWavHeaderGenericRf64(&w, num_samples, sample_rate_hz, num_channels,
+                              format);
   }
 
   if (w.has_error) {
     LOG_ERROR("Error while writing \"%s\".\n", file_name);
+    fclose(f);
     goto fail;
   }
 
-  if (is_24_bit) {
-    WriteWavSamplesGeneric24Bit(&w, (const int32_t*)samples, num_samples);
-  } else {
-    WriteWavSamplesGeneric(&w, (const int16_t*)samples, num_samples);
+  switch (format) {
+    case kWavInt16Format:
+      WriteWavSamplesGeneric(&w, (const int16_t*)samples, num_samples);
+      break;
+    case kWavInt24Format:
+      WriteWavSamplesGeneric24Bit(&w, (const int32_t*)samples, num_samples);
+      break;
+    default:
+      WriteWavSamplesGenericFloat(&w, (const float*)samples, num_samples);
+      break;
   }
 
   if (w.has_error) {
     LOG_ERROR("Error while writing \"%s\".\n", file_name);
+    fclose(f);
     goto fail;
   }
 
@@ -101,19 +145,25 @@ int WriteWavFileInternal(const char* file_name, const void* samples,
   return 1;
 
 fail:
-  w.has_error = 1;
   return 0;
 }
 
 int WriteWavFile(const char* file_name, const int16_t* samples,
                  size_t num_samples, int sample_rate_hz, int num_channels) {
   return WriteWavFileInternal(file_name, samples, num_samples, sample_rate_hz,
-                              num_channels, 0);
+                              num_channels, kWavInt16Format);
 }
 
 int WriteWavFile24Bit(const char* file_name, const int32_t* samples,
                       size_t num_samples, int sample_rate_hz,
                       int num_channels) {
   return WriteWavFileInternal(file_name, samples, num_samples, sample_rate_hz,
-                              num_channels, 1);
+                              num_channels, kWavInt24Format);
+}
+
+int WriteWavFileFloat(const char* file_name, const float* samples,
+                      size_t num_samples, int sample_rate_hz,
+                      int num_channels) {
+  return WriteWavFileInternal(file_name, samples, num_samples, sample_rate_hz,
+                              num_channels, kWavFloat32Format);
 }
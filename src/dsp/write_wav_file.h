@@ -13,7 +13,7 @@
  * limitations under the License.
  *
  *
- * C library to write 16 or 24-bit WAV files.
+ * C library to write 16-bit, 24-bit, or 32-bit float WAV files.
  *
  * The simplest usage of this API is to use the WriteWavFile function, which
  * requires the samples to be buffered at the application layer.
@@ -39,6 +39,9 @@
  * WriteWavHeader(f, ...);
  * fclose(f);
  *
+ * Standard WAV files are limited to 4 GB. For long recordings, write the header
+ * with WriteWavHeaderRf64() in both places of the pattern above, which makes an
+ * RF64 file if the final size exceeds 4 GB.
  */
 
 #ifndef AUDIO_TO_TACTILE_SRC_DSP_WRITE_WAV_FILE_H_
@@ -48,6 +51,8 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+#include "dsp/write_wav_file_generic.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -84,6 +89,25 @@ int WriteWavSamples24Bit(FILE* f, const int32_t* samples, size_t num_samples);
 int WriteWavFile24Bit(const char* file_name, const int32_t* samples,
                       size_t num_samples, int sample_rate_hz, int num_channels);
 
+/* Same as above, but for 32-bit IEEE float WAV files. Samples are written as
+ * is, without conversion or clipping.
+ */
+int WriteWavHeaderFloat(FILE* f, size_t num_samples, int sample_rate_hz,
+                        int num_channels);
+int WriteWavSamplesFloat(FILE* f, const float* samples, size_t num_samples);
+
+int WriteWavFileFloat(const char* file_name, const float* samples,
+                      size_t num_samples, int sample_rate_hz, int num_channels);
+
+/* Writes a header that supports files larger than 4 GB, for samples in the
+ * given format. The header is RF64 if the file exceeds 4 GB and is otherwise a
+ * standard WAV header with a reserved JUNK chunk, see
+ * WriteWavHeaderGenericRf64(). WriteWavFile*() use RF64 automatically when
+ * needed.
+ */
+int WriteWavHeaderRf64(FILE* f, uint64_t num_samples, int sample_rate_hz,
+                       int num_channels, WavSampleFormat format);
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
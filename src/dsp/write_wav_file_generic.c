@@ -25,6 +25,7 @@
 
 #define kWavFmtExtensionCode 0xFFFE
 #define kWavPcmCode 1
+#define kWavIeeeFloatingPointCode 3
 #define kWavPcmGuid "\x00\x00\x00\x00\x10\x00\x80\x00\x00\xAA\x00\x38\x9B\x71"
 
 static void WriteWithErrorCheck(const void* bytes, size_t num_bytes,
@@ -86,36 +87,77 @@ static uint32_t GetChannelMask(int num_channels) {
   }
 }
 
-int WriteWavHeaderGenericInternal(WavWriter* w, size_t num_samples,
-                                  int sample_rate_hz, int num_channels,
-                                  int bits_per_sample) {
+/* Write uint64_t in little endian order. */
+static void WriteUint64(uint64_t value, WavWriter* w) {
+  uint8_t bytes[8];
+  LittleEndianWriteU64(value, bytes);
+  WriteWithErrorCheck(bytes, sizeof(bytes), w);
+}
+
+/* Writes the header. If `rf64_capable` is nonzero, a 36-byte chunk is placed
+ * after the "WAVE" ID: a ds64 chunk with 64-bit sizes if the file is too large
+ * for the 32-bit RIFF sizes, or otherwise a JUNK chunk reserving the space, so
+ * that the header has the same size either way [EBU Tech 3306].
+ */
+static int WriteWavHeaderGenericInternal(WavWriter* w, uint64_t num_samples,
+                                         int sample_rate_hz, int num_channels,
+                                         WavSampleFormat format,
+                                         int rf64_capable) {
+  const int is_float = (format == kWavFloat32Format);
+  const int bits_per_sample = (format == kWavInt16Format) ? 16
+      : (format == kWavInt24Format) ? 24 : 32;
   /* The fmt chunk extension should be used when num_channels is more than 2,
    * when the number of bits per sample exceeds 16, when the number of bits per
    * sample does not match the container size, or when the channel to speaker
    * mapping must be specified. Only these first two conditions are relevant. */
   const int extended = num_channels > 2 || bits_per_sample > 16;
   const uint32_t fmt_chunk_size = extended ? 40 : 16;
-  const uint32_t data_chunk_size = (bits_per_sample / 8) * num_samples;
-  const uint32_t data_chunk_padding = data_chunk_size % 2;
+  const uint64_t data_chunk_size = (bits_per_sample / 8) * num_samples;
+  const uint64_t data_chunk_padding = data_chunk_size % 2;
   const int block_align = num_channels * (bits_per_sample / 8);
+  /* Size of the file minus the 8 bytes for the "RIFF" ID and RIFF chunk size.
+   * The constant 20 counts the "WAVE" ID, "fmt " ID, fmt chunk size, "data" ID,
+   * data chunk size, and data chunk padding.
+   */
+  const uint64_t riff_size = 20 + (rf64_capable ? 36 : 0) + fmt_chunk_size +
+      (extended ? 12 : 0) + data_chunk_size + data_chunk_padding;
+  const int is_rf64 = riff_size > UINT32_MAX;
+  const uint64_t num_frames =
+      (num_channels > 0) ? num_samples / num_channels : 0;
 
   if (w == NULL || w->io_ptr == NULL) {
     return 0;
   }
   w->has_error = 0; /* Clear the error flag. */
-  WriteString("RIFF", w);
-  /* Write the size of the file minus the 8 bytes for the "RIFF" ID and RIFF
-   * chunk size. The constant 20 counts the "WAVE" ID, "fmt " ID, fmt chunk
-   * size, "data" ID, data chunk size, and data chunk padding.
-   */
-  WriteUint32(20 + fmt_chunk_size + (extended ? 12 : 0) + data_chunk_size +
-                  data_chunk_padding,
-              w);
+  if (is_rf64 && !rf64_capable) {
+    return 0;  /* Too large for a RIFF WAV file. */
+  }
+
+  WriteString(is_rf64 ? "RF64" : "RIFF", w);
+  /* With RF64, sizes that don't fit are set to -1 and stored in ds64. */
+  WriteUint32(is_rf64 ? UINT32_MAX : (uint32_t)riff_size, w);
   WriteString("WAVE", w);
   if (w->has_error) {
     return 0;
   }
 
+  if (rf64_capable) {
+    if (is_rf64) {
+      WriteString("ds64", w);
+      WriteUint32(28, w);
+      WriteUint64(riff_size, w);
+      WriteUint64(data_chunk_size, w);
+      WriteUint64(num_frames, w);
+      WriteUint32(0, w);  /* Number of table entries for other chunks. */
+    } else {
+      static const char kZeros[28] = {0};
+      WriteString("JUNK", w);
+      WriteUint32(28, w);
+      WriteWithErrorCheck(kZeros, sizeof(kZeros), w);
+    }
+    if (w->has_error) { return 0; }
+  }
+
   /* Write fmt chunk. */
   WriteString("fmt ", w);
   WriteUint32(fmt_chunk_size, w);
@@ -133,19 +175,21 @@ int WriteWavHeaderGenericInternal(WavWriter* w, size_t num_samples,
     WriteUint16(22, w);             /* Size of the fmt extension. */
     WriteUint16(bits_per_sample, w); /* Valid bits per sample. */
     WriteUint32(GetChannelMask(num_channels), w); /* Channel mask. */
-    WriteUint16(kWavPcmCode, w);    /* Set linear PCM sample format. */
+    /* Set linear PCM or IEEE float sample format. */
+    WriteUint16(is_float ? kWavIeeeFloatingPointCode : kWavPcmCode, w);
+    /* The rest of the subformat GUID is the same for PCM and float. */
     WriteWithErrorCheck(kWavPcmGuid, 14, w);
 
     /* Also write a fact chunk when using fmt extension. */
     WriteString("fact", w);
     WriteUint32(4, w);
-    WriteUint32(num_samples / num_channels, w);
+    WriteUint32(is_rf64 ? UINT32_MAX : (uint32_t)num_frames, w);
   }
   if (w->has_error) { return 0; }
 
   /* Write data chunk. data_chunk_padding is not included in the size. */
   WriteString("data", w);
-  WriteUint32(data_chunk_size, w);
+  WriteUint32(is_rf64 ? UINT32_MAX : (uint32_t)data_chunk_size, w);
   if (w->has_error) { return 0; }
 
   return 1;
@@ -154,13 +198,26 @@ int WriteWavHeaderGenericInternal(WavWriter* w, size_t num_samples,
 int WriteWavHeaderGeneric(WavWriter* w, size_t num_samples, int sample_rate_hz,
                           int num_channels) {
   return WriteWavHeaderGenericInternal(w, num_samples, sample_rate_hz,
-                                       num_channels, 16);
+                                       num_channels, kWavInt16Format, 0);
 }
 
 int WriteWavHeaderGeneric24Bit(WavWriter* w, size_t num_samples,
                                int sample_rate_hz, int num_channels) {
   return WriteWavHeaderGenericInternal(w, num_samples, sample_rate_hz,
-                                       num_channels, 24);
+                                       num_channels, kWavInt24Format, 0);
+}
+
+int WriteWavHeaderGenericFloat(WavWriter* w, size_t num_samples,
+                               int sample_rate_hz, int num_channels) {
+  return WriteWavHeaderGenericInternal(w, num_samples, sample_rate_hz,
+                                       num_channels, kWavFloat32Format, 0);
+}
+
+int WriteWavHeaderGenericRf64(WavWriter* w, uint64_t num_samples,
+                              int sample_rate_hz, int num_channels,
+                              WavSampleFormat format) {
+  return WriteWavHeaderGenericInternal(w, num_samples, sample_rate_hz,
+                                       num_channels, format, 1);
 }
 
 int WriteWavSamplesGeneric(WavWriter* w, const int16_t* samples,
@@ -234,3 +291,34 @@ int WriteWavSamplesGeneric24Bit(WavWriter* w, const int32_t* samples,
 
   return 1;
 }
+
+int WriteWavSamplesGenericFloat(WavWriter* w, const float* samples,
+                                size_t num_samples) {
+  if (w == NULL || w->io_ptr == NULL || samples == NULL) {
+    return 0;
+  }
+  w->has_error = 0;  /* Clear the error flag. */
+
+  uint8_t buffer[1024];
+  while (num_samples) {
+    int count = sizeof(buffer) / sizeof(float);
+    if ((size_t)count > num_samples) { count = (int)num_samples; }
+
+    int i;
+    for (i = 0; i < count; ++i) {
+      LittleEndianWriteF32(samples[i], buffer + 4 * i);
+    }
+
+    /* Call the writing callback with ~1 KB at a time. */
+    WriteWithErrorCheck(buffer, 4 * count, w);
+    samples += count;
+    num_samples -= count;
+  }
+
+  /* 32-bit samples never need a pad byte. */
+  if (w->has_error) {
+    return 0;
+  }
+
+  return 1;
+}
@@ -13,7 +13,7 @@
  * limitations under the License.
  *
  *
- * 16 or 24-bit WAV writer. Don't use this file directly unless you are
+ * 16-bit, 24-bit, or 32-bit float WAV writer. Don't use this file directly unless you are
  * adding support for a different kind of filesystem.
  *
  * For reading local files, see write_wav_file.h.
@@ -43,8 +43,15 @@ struct WavWriter {
 };
 typedef struct WavWriter WavWriter;
 
+/* Sample formats for WriteWavHeaderGenericRf64(). */
+typedef enum {
+  kWavInt16Format,
+  kWavInt24Format,
+  kWavFloat32Format
+} WavSampleFormat;
+
 /* Write a WAV file header at the beginning of a WAV file.  Returns 1 on
- * success, 0 on failure.
+ * success, 0 on failure, including if the data exceeds the 4 GB RIFF limit.
  */
 int WriteWavHeaderGeneric(WavWriter* w, size_t num_samples, int sample_rate_hz,
                           int num_channels);
@@ -52,6 +59,21 @@ int WriteWavHeaderGeneric(WavWriter* w, size_t num_samples, int sample_rate_hz,
 int WriteWavHeaderGeneric24Bit(WavWriter* w, size_t num_samples,
                                int sample_rate_hz, int num_channels);
 
+/* Same as above but for 32-bit IEEE float samples. */
+int WriteWavHeaderGenericFloat(WavWriter* w, size_t num_samples,
+                               int sample_rate_hz, int num_channels);
+
+/* Writes a header that supports files larger than 4 GB. If the file fits in
+ * 4 GB, this is a standard RIFF WAV header, plus a JUNK chunk reserving space.
+ * Otherwise the header is RF64 [EBU Tech 3306] with 64-bit sizes in a ds64
+ * chunk in place of the JUNK chunk. The header has the same size either way,
+ * so it may be rewritten in place after streaming samples, as described in
+ * write_wav_file.h.
+ */
+int WriteWavHeaderGenericRf64(WavWriter* w, uint64_t num_samples,
+                              int sample_rate_hz, int num_channels,
+                              WavSampleFormat format);
+
 /* Write samples into a WAV file.  samples should be interleaved, and
  * num_samples must be an integer multiple of num_channels. Returns 1 on
  * success, 0 on failure.
@@ -63,6 +85,10 @@ int WriteWavSamplesGeneric(WavWriter* w, const int16_t* samples,
 int WriteWavSamplesGeneric24Bit(WavWriter* w, const int32_t* samples,
                                 size_t num_samples);
 
+/* Same as above but writing 32-bit float samples, without conversion. */
+int WriteWavSamplesGenericFloat(WavWriter* w, const float* samples,
+                                size_t num_samples);
+
 #ifdef __cplusplus
 }  /* extern "C" */
 #endif
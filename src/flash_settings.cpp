@@ -14,9 +14,13 @@
 
 #include "flash_settings.h"  // NOLINT(build/include)
 
+#include <string.h>
+
 #include "Adafruit_SPIFlash.h"  // NOLINT(build/include)
 #include "SPI.h"  // NOLINT(build/include)
 #include "SdFat.h"  // NOLINT(build/include)
+#include "cpp/std_shim.h"  // NOLINT(build/include)
+#include "dsp/serialize.h"  // NOLINT(build/include)
 
 namespace audio_tactile {
 
@@ -27,32 +31,193 @@ Adafruit_FlashTransport_QSPI g_flash_transport;
 Adafruit_SPIFlash g_flash(&g_flash_transport);
 FatFileSystem g_flash_file_system;
 File g_flash_file;
+
+// Stack size in 32-bit words for the background writer task.
+constexpr int kWriterTaskStackWords = 1024;
+TaskHandle_t g_writer_task = nullptr;
+// Protects the queued_* fields, settings_queued_, warm_state_queued_,
+// status_ready_, and status_.
+SemaphoreHandle_t g_queue_mutex = nullptr;
+// Serializes file system access by the writer task and the pattern library
+// functions, which are called from the main loop.
+SemaphoreHandle_t g_file_system_mutex = nullptr;
 }  // namespace
 
 AudioToTactileFlashSettings::AudioToTactileFlashSettings()
-    : have_file_system_(false) {}
+    : defaults_checksum_(0),
+      have_file_system_(false),
+      queued_warm_state_size_(0),
+      settings_queued_(false),
+      warm_state_queued_(false),
+      status_ready_(false),
+      status_(kFlashWriteSuccess) {}
 
 void AudioToTactileFlashSettings::Initialize() {
   // Initialize external flash.
   g_flash.begin();
   // Open FAT file system on the flash.
   have_file_system_ = g_flash_file_system.begin(&g_flash);
+
+  // Start the writer at the same priority as the main loop, so that the two
+  // are time sliced and a long write doesn't stall audio processing.
+  g_queue_mutex = xSemaphoreCreateMutex();
+  g_file_system_mutex = xSemaphoreCreateMutex();
+  xTaskCreate(WriterTask, "flash", kWriterTaskStackWords, this, TASK_PRIO_LOW,
+              &g_writer_task);
+}
+
+void AudioToTactileFlashSettings::QueueWriteSettingsFile(
+    const Settings& settings) {
+  xSemaphoreTake(g_queue_mutex, portMAX_DELAY);
+  queued_settings_ = settings;
+  settings_queued_ = true;
+  xSemaphoreGive(g_queue_mutex);
+  xTaskNotifyGive(g_writer_task);
+}
+
+void AudioToTactileFlashSettings::QueueWriteWarmStateFile(const float* values,
+                                                          int num_values) {
+  if (num_values > kWarmStateMaxValues) { return; }
+  xSemaphoreTake(g_queue_mutex, portMAX_DELAY);
+  memcpy(queued_warm_state_, values, num_values * sizeof(float));
+  queued_warm_state_size_ = num_values;
+  warm_state_queued_ = true;
+  xSemaphoreGive(g_queue_mutex);
+  xTaskNotifyGive(g_writer_task);
+}
+
+bool AudioToTactileFlashSettings::TakeWriteStatus(int* status) {
+  if (g_queue_mutex == nullptr) { return false; }
+  xSemaphoreTake(g_queue_mutex, portMAX_DELAY);
+  const bool ready = status_ready_;
+  if (ready) {
+    *status = status_;
+    status_ready_ = false;
+  }
+  xSemaphoreGive(g_queue_mutex);
+  return ready;
+}
+
+void AudioToTactileFlashSettings::WriterTask(void* arg) {
+  auto* self = static_cast<AudioToTactileFlashSettings*>(arg);
+  while (true) {
+    // Sleep until a write is queued.
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    self->RunQueuedWrites();
+  }
+}
+
+void AudioToTactileFlashSettings::RunQueuedWrites() {
+  // Buffers for copying out the queued writes, so that the mutex is not held
+  // while writing. These are static to avoid a large task stack. They are only
+  // used by the writer task.
+  static Settings settings;
+  static float warm_state[kWarmStateMaxValues];
+
+  while (true) {
+    xSemaphoreTake(g_queue_mutex, portMAX_DELAY);
+    const bool write_settings = settings_queued_;
+    const bool write_warm_state = warm_state_queued_;
+    const int warm_state_size = queued_warm_state_size_;
+    if (write_settings) { settings = queued_settings_; }
+    if (write_warm_state) {
+      memcpy(warm_state, queued_warm_state_, warm_state_size * sizeof(float));
+    }
+    settings_queued_ = false;
+    warm_state_queued_ = false;
+    xSemaphoreGive(g_queue_mutex);
+
+    if (!write_settings && !write_warm_state) { return; }
+
+    if (write_settings) {
+      int status;
+      xSemaphoreTake(g_file_system_mutex, portMAX_DELAY);
+      if (!have_file_system_) {
+        status = kFlashWriteErrorNotFormatted;
+      } else if (WriteSettingsFile(settings)) {
+        status = kFlashWriteSuccess;
+      } else {
+        status = kFlashWriteUnkownError;
+      }
+      xSemaphoreGive(g_file_system_mutex);
+      xSemaphoreTake(g_queue_mutex, portMAX_DELAY);
+      status_ = status;
+      status_ready_ = true;
+      xSemaphoreGive(g_queue_mutex);
+    }
+    if (write_warm_state) {
+      xSemaphoreTake(g_file_system_mutex, portMAX_DELAY);
+      WriteWarmStateFile(warm_state, warm_state_size);
+      xSemaphoreGive(g_file_system_mutex);
+    }
+  }
+}
+
+uint32_t AudioToTactileFlashSettings::ComputeSourceStamp() {
+  dir_t dir;
+  uint32_t modify_time = 0;
+  if (g_flash_file.dirEntry(&dir)) {
+    modify_time = static_cast<uint32_t>(dir.lastWriteDate) << 16 |
+                  dir.lastWriteTime;
+  }
+  uint8_t bytes[10];
+  ::LittleEndianWriteU32(g_flash_file.fileSize(), bytes);
+  ::LittleEndianWriteU32(modify_time, bytes + 4);
+  ::LittleEndianWriteU16(defaults_checksum_, bytes + 8);
+  // Pack two different Fletcher-16 checksums to make a 32-bit stamp.
+  return static_cast<uint32_t>(::Fletcher16(bytes, sizeof(bytes), 1)) << 16 |
+         ::Fletcher16(bytes, sizeof(bytes), 0x5a5a);
+}
+
+bool AudioToTactileFlashSettings::WriteBinaryFile(const Settings& settings,
+                                                  uint32_t source_stamp) {
+  uint8_t snapshot[Settings::kBinarySize];
+  settings.WriteBinary(source_stamp, snapshot);
+  if (!(g_flash_file = g_flash_file_system.open(
+          kFlashSettingsBinaryFile, O_WRONLY | O_CREAT | O_TRUNC))) {
+    return false;
+  }
+  const bool success =
+      g_flash_file.write(snapshot, sizeof(snapshot)) == sizeof(snapshot);
+  g_flash_file.close();
+  return success;
 }
 
 bool AudioToTactileFlashSettings::ReadSettingsFile(Settings* settings) {
+  uint8_t snapshot[Settings::kBinarySize];
+  settings->WriteBinary(0, snapshot);
+  defaults_checksum_ = ::Fletcher16(snapshot, sizeof(snapshot), 1);
+
   if (!have_file_system_ ||
       !(g_flash_file = g_flash_file_system.open(
           kFlashSettingsFile, FILE_READ))) {
     return false;
   }
+  const uint32_t source_stamp = ComputeSourceStamp();
+  g_flash_file.close();
+
+  // Use the binary snapshot if it is up to date.
+  if ((g_flash_file = g_flash_file_system.open(
+          kFlashSettingsBinaryFile, FILE_READ))) {
+    const int size = g_flash_file.read(snapshot, sizeof(snapshot));
+    g_flash_file.close();
+    if (settings->ReadBinary(snapshot, size, source_stamp)) {
+      last_written_settings_ = *settings;
+      Serial.println("FlashSettings: Read " kFlashSettingsBinaryFile);
+      return true;
+    }
+  }
 
-  settings->ReadFile(
+  if (!(g_flash_file = g_flash_file_system.open(
+          kFlashSettingsFile, FILE_READ))) {
+    return false;
+  }
+
+  settings->ReadFileChunked(
       [](char* buffer, int buffer_size) {
-        // File::fgets reads one line and returns a number of bytes. IO error is
-        // indicated by count < 0, and EOF by count == 0 and .available() == 0.
-        const int count = g_flash_file.fgets(buffer, buffer_size);
-        // Return true (success) if something was read or if it is not yet EOF.
-        return count > 0 || (count == 0 && g_flash_file.available());
+        // File::read returns the number of bytes read, 0 at EOF, or -1 on IO
+        // error. Reading in chunks avoids a slow byte-at-a-time fgets scan.
+        return g_flash_file.read(buffer, buffer_size);
       },
       [](int line_number, const char* message) {
         // Print error message to serial.
@@ -65,12 +230,19 @@ bool AudioToTactileFlashSettings::ReadSettingsFile(Settings* settings) {
   g_flash_file.close();
   last_written_settings_ = *settings;
   Serial.println("FlashSettings: Read " kFlashSettingsFile);
+  // Save a snapshot so that the next boot can skip parsing.
+  WriteBinaryFile(*settings, source_stamp);
   return true;
 }
 
 bool AudioToTactileFlashSettings::WriteSettingsFile(const Settings& settings) {
   if (last_written_settings_ == settings) { return true; }
 
+  // Remove the snapshot first, so that it is not mistaken as up to date if
+  // writing is interrupted.
+  if (have_file_system_) {
+    g_flash_file_system.remove(kFlashSettingsBinaryFile);
+  }
   if (!have_file_system_ ||
       !(g_flash_file = g_flash_file_system.open(
           kFlashSettingsFile,
@@ -89,8 +261,106 @@ bool AudioToTactileFlashSettings::WriteSettingsFile(const Settings& settings) {
   g_flash_file.close();
   last_written_settings_ = settings;
   Serial.println("FlashSettings: Wrote " kFlashSettingsFile);
+
+  if ((g_flash_file = g_flash_file_system.open(
+          kFlashSettingsFile, FILE_READ))) {
+    const uint32_t source_stamp = ComputeSourceStamp();
+    g_flash_file.close();
+    WriteBinaryFile(settings, source_stamp);
+  }
   return true;
 }
 
+bool AudioToTactileFlashSettings::ReadWarmStateFile(float* values,
+                                                    int num_values) {
+  if (!have_file_system_ || num_values > kWarmStateMaxValues ||
+      !(g_flash_file = g_flash_file_system.open(
+          kFlashWarmStateFile, FILE_READ))) {
+    return false;
+  }
+  uint8_t bytes[WarmStateSerializedSize(kWarmStateMaxValues)];
+  const int size = g_flash_file.read(bytes, sizeof(bytes));
+  g_flash_file.close();
+  return DeserializeWarmState(bytes, size, values, num_values);
+}
+
+bool AudioToTactileFlashSettings::WriteWarmStateFile(const float* values,
+                                                     int num_values) {
+  if (!have_file_system_ || num_values > kWarmStateMaxValues ||
+      !(g_flash_file = g_flash_file_system.open(
+          kFlashWarmStateFile, O_WRONLY | O_CREAT | O_TRUNC))) {
+    return false;
+  }
+  uint8_t bytes[WarmStateSerializedSize(kWarmStateMaxValues)];
+  SerializeWarmState(values, num_values, bytes);
+  const size_t size = WarmStateSerializedSize(num_values);
+  const bool success = g_flash_file.write(bytes, size) == size;
+  g_flash_file.close();
+  return success;
+}
+
+bool AudioToTactileFlashSettings::ReadPatternLibrary(uint32_t address,
+                                                    uint8_t* dest, int size) {
+  if (!have_file_system_) { return false; }
+  memset(dest, 0xff, size);
+  xSemaphoreTake(g_file_system_mutex, portMAX_DELAY);
+  if ((g_flash_file = g_flash_file_system.open(
+          kFlashPatternLibraryFile, FILE_READ))) {
+    if (address < g_flash_file.fileSize() && g_flash_file.seekSet(address)) {
+      g_flash_file.read(dest, size);
+    }
+    g_flash_file.close();
+  }
+  xSemaphoreGive(g_file_system_mutex);
+  return true;
+}
+
+bool AudioToTactileFlashSettings::OpenPatternLibraryForWrite(
+    uint32_t address) {
+  if (!(g_flash_file = g_flash_file_system.open(
+          kFlashPatternLibraryFile, O_RDWR | O_CREAT))) {
+    return false;
+  }
+  uint8_t padding[64];
+  memset(padding, 0xff, sizeof(padding));
+  uint32_t size = g_flash_file.fileSize();
+  if (!g_flash_file.seekSet(size)) { return false; }
+  while (size < address) {
+    const size_t n = std_shim::min<size_t>(sizeof(padding), address - size);
+    if (g_flash_file.write(padding, n) != n) { return false; }
+    size += n;
+  }
+  return g_flash_file.seekSet(address);
+}
+
+bool AudioToTactileFlashSettings::WritePatternLibrary(uint32_t address,
+                                                     const uint8_t* src,
+                                                     int size) {
+  if (!have_file_system_) { return false; }
+  xSemaphoreTake(g_file_system_mutex, portMAX_DELAY);
+  const bool success =
+      OpenPatternLibraryForWrite(address) &&
+      g_flash_file.write(src, size) == static_cast<size_t>(size);
+  g_flash_file.close();
+  xSemaphoreGive(g_file_system_mutex);
+  return success;
+}
+
+bool AudioToTactileFlashSettings::ErasePatternLibraryPage(uint32_t address,
+                                                         int page_size) {
+  if (!have_file_system_) { return false; }
+  uint8_t erased[64];
+  memset(erased, 0xff, sizeof(erased));
+  xSemaphoreTake(g_file_system_mutex, portMAX_DELAY);
+  bool success = OpenPatternLibraryForWrite(address);
+  for (int i = 0; success && i < page_size; i += sizeof(erased)) {
+    const size_t n = std_shim::min<size_t>(sizeof(erased), page_size - i);
+    success = g_flash_file.write(erased, n) == n;
+  }
+  g_flash_file.close();
+  xSemaphoreGive(g_file_system_mutex);
+  return success;
+}
+
 }  // namespace audio_tactile
 
@@ -14,15 +14,45 @@
 //
 //
 // Library for reading and writing device settings to flash.
+//
+// Settings are stored in the human-readable text file settings.cfg. To speed
+// up boot, a binary snapshot of the parsed settings is also kept in
+// settings.bin (see "Binary snapshot" in cpp/settings.h). The snapshot is
+// tagged with a stamp of the text file's size and modification time, and of
+// the default settings, and the text file is only parsed when the snapshot is
+// missing or stale, e.g. after settings.cfg was edited over USB.
+//
+// Flash writes take long enough to glitch audio if made from the main loop, so
+// writes may be queued with QueueWriteSettingsFile() and
+// QueueWriteWarmStateFile() instead. These return immediately, and a
+// background FreeRTOS task started by Initialize() performs the write while
+// the main loop keeps running. Completion of a queued settings write is polled
+// with TakeWriteStatus(), e.g. to report it with a kFlashWriteStatus message.
+// After Initialize(), the synchronous Write*File() functions should not be
+// called, since the file system is not safe to use from two tasks at once.
+//
+// The tactile pattern library (see tactile/tactile_pattern_library.h) is kept
+// in patterns.bin, which emulates a region of raw flash pages with
+// ReadPatternLibrary(), WritePatternLibrary(), and ErasePatternLibraryPage().
+// These are synchronous, since a pattern must be stored before it can be
+// played, and share the file system with the writer task through a mutex.
+// They only write when a pattern upload completes.
 
 #ifndef AUDIO_TO_TACTILE_SRC_FLASH_SETTINGS_H_
 #define AUDIO_TO_TACTILE_SRC_FLASH_SETTINGS_H_
 
 #include "cpp/settings.h"  // NOLINT(build/include)
+#include "cpp/warm_state.h"  // NOLINT(build/include)
 
 // Path for the settings file. Must be a valid 8.3 FAT filename.
 // https://en.wikipedia.org/wiki/8.3_filename
 #define kFlashSettingsFile "settings.cfg"
+// Path for the binary snapshot of the settings.
+#define kFlashSettingsBinaryFile "settings.bin"
+// Path for the processors' warm state, see cpp/warm_state.h.
+#define kFlashWarmStateFile "warm.bin"
+// Path for the tactile pattern library.
+#define kFlashPatternLibraryFile "patterns.bin"
 
 namespace audio_tactile {
 
@@ -37,16 +67,19 @@ class AudioToTactileFlashSettings {
  public:
   AudioToTactileFlashSettings();
 
-  // Initializes flash filesystem.
+  // Initializes flash filesystem and starts the background writer task.
   void Initialize();
 
   // True if a FAT flash file system was found on the device.
   bool have_file_system() const { return have_file_system_; }
 
-  // Reads from settings.cfg flash file. Returns true on success.
+  // Reads settings from flash, from the settings.bin snapshot if it is up to
+  // date and otherwise by parsing settings.cfg. `settings` should be set to
+  // default values before calling. Returns true on success.
   bool ReadSettingsFile(Settings* settings);
 
-  // Writes to settings.cfg flash file. The function compares `settings` to the
+  // Writes to settings.cfg flash file and updates the settings.bin snapshot.
+  // The function compares `settings` to the
   // last written settings, and only writes to flash if they differ. Returns
   // true on success.
   //
@@ -54,9 +87,71 @@ class AudioToTactileFlashSettings {
   // wearing out the flash.
   bool WriteSettingsFile(const Settings& settings);
 
+  // Reads `num_values` warm state values from the warm.bin flash file. Returns
+  // true on success, or false if the file is missing or invalid.
+  bool ReadWarmStateFile(float* values, int num_values);
+
+  // Writes `num_values` warm state values, at most kWarmStateMaxValues, to
+  // the warm.bin flash file. Returns true on success.
+  //
+  // NOTE: As with WriteSettingsFile(), calls should be rate limited.
+  bool WriteWarmStateFile(const float* values, int num_values);
+
+  // Queues `settings` to be written by WriteSettingsFile() in the background.
+  // Returns immediately. A queued write that hasn't started yet is replaced.
+  void QueueWriteSettingsFile(const Settings& settings);
+
+  // Queues `num_values` values to be written by WriteWarmStateFile() in the
+  // background. Returns immediately. A queued write that hasn't started yet is
+  // replaced.
+  void QueueWriteWarmStateFile(const float* values, int num_values);
+
+  // Returns true if a queued settings write has completed since the last call,
+  // and sets `*status` to the result, a kFlashWrite* code.
+  bool TakeWriteStatus(int* status);
+
+  // Reads `size` bytes at byte `address` of the pattern library file into
+  // `dest`. Bytes past the end of the file read as 0xff, like erased flash.
+  // Returns true on success.
+  bool ReadPatternLibrary(uint32_t address, uint8_t* dest, int size);
+
+  // Writes `size` bytes at byte `address` of the pattern library file,
+  // extending the file with 0xff bytes if needed. Returns true on success.
+  bool WritePatternLibrary(uint32_t address, const uint8_t* src, int size);
+
+  // Fills `page_size` bytes at byte `address` of the pattern library file with
+  // 0xff, the equivalent of erasing a flash page. Returns true on success.
+  bool ErasePatternLibraryPage(uint32_t address, int page_size);
+
  private:
+  // Body of the background writer task.
+  static void WriterTask(void* arg);
+  // Performs all queued writes.
+  void RunQueuedWrites();
+
+  // Computes the snapshot stamp for the open settings.cfg file.
+  uint32_t ComputeSourceStamp();
+  // Writes the settings.bin snapshot. Returns true on success.
+  bool WriteBinaryFile(const Settings& settings, uint32_t source_stamp);
+  // Opens the pattern library file for writing at `address`, extending it
+  // with 0xff bytes if it is shorter. Returns true on success.
+  bool OpenPatternLibraryForWrite(uint32_t address);
+
   Settings last_written_settings_;
+  // Fletcher-16 checksum of the defaults passed to ReadSettingsFile(), so that
+  // the snapshot is invalidated when firmware defaults change.
+  uint16_t defaults_checksum_;
   bool have_file_system_;
+
+  // Writes queued for the background task. These fields are protected by a
+  // mutex, see flash_settings.cpp.
+  Settings queued_settings_;
+  float queued_warm_state_[kWarmStateMaxValues];
+  int queued_warm_state_size_;
+  bool settings_queued_;
+  bool warm_state_queued_;
+  bool status_ready_;
+  int status_;
 };
 extern AudioToTactileFlashSettings FlashSettings;
 
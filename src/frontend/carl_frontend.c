@@ -21,8 +21,12 @@
 #include <stdlib.h>
 #include <string.h>
 
-#include "dsp/fast_fun.h"
+#include "dsp/aligned_alloc.h"
+#include "dsp/arena.h"
+#include "dsp/denormals.h"
+#include "dsp/fast_fun_simd.h"
 #include "dsp/math_constants.h"
+#include "dsp/simd.h"
 #include "frontend/carl_frontend_design.h"
 
 const CarlFrontendParams kCarlFrontendDefaultParams = {
@@ -32,6 +36,7 @@ const CarlFrontendParams kCarlFrontendDefaultParams = {
   /*min_pole_frequency_hz=*/100.0,
   /*step_erbs=*/0.5,
   /*envelope_cutoff_hz=*/20.0f,
+  /*min_samples_per_cycle=*/6.0f,
   /*pcen_time_constant_s=*/0.3f,
   /*pcen_cross_channel_diffusivity=*/100.0f,
   /*pcen_init_value=*/1e-7f,
@@ -39,6 +44,9 @@ const CarlFrontendParams kCarlFrontendDefaultParams = {
   /*pcen_beta=*/0.2f,
   /*pcen_gamma=*/1e-12f,
   /*pcen_delta=*/0.001f,
+  /*first_output_channel=*/0,
+  /*num_output_channels=*/0,
+  /*vectorized_pcen_compression=*/0,
 };
 
 /* Computes Z-plane pole location for a Gamma filter with specified cutoff. */
@@ -52,8 +60,7 @@ static double ComputeGammaFilterZPole(int order,
   return q - sqrt(q * q - 1.0);
 }
 
-/* Counts how many channels will be generated. */
-static int CountNumChannels(const CarlFrontendParams* params) {
+int CarlFrontendCountNumChannels(const CarlFrontendParams* params) {
   int num_channels = 0;
   double pole;
   for (pole = params->highest_pole_frequency_hz;
@@ -64,7 +71,22 @@ static int CountNumChannels(const CarlFrontendParams* params) {
   return num_channels;
 }
 
-CarlFrontend* CarlFrontendMake(const CarlFrontendParams* params) {
+int CarlFrontendCountNumOutputChannels(const CarlFrontendParams* params) {
+  const int num_channels = CarlFrontendCountNumChannels(params);
+  const int first = params->first_output_channel;
+  if (!(0 <= first && first < num_channels) ||
+      !(0 <= params->num_output_channels &&
+        params->num_output_channels <= num_channels - first)) {
+    return 0;
+  }
+  return params->num_output_channels ? params->num_output_channels
+                                     : num_channels - first;
+}
+
+/* Checks that `params` are valid. Returns the number of channels in the
+ * cascade, through the last output channel, on success, or 0 on failure.
+ */
+static int CheckParams(const CarlFrontendParams* params) {
   /* Check that parameters are valid. */
   if (params == NULL ||
       !(params->input_sample_rate_hz > 0.0f) ||
@@ -72,6 +94,7 @@ CarlFrontend* CarlFrontendMake(const CarlFrontendParams* params) {
       !(params->highest_pole_frequency_hz < params->input_sample_rate_hz / 2) ||
       !(params->step_erbs > 0.01f) ||
       !(params->envelope_cutoff_hz > 0.0f) ||
+      !(params->min_samples_per_cycle >= 3.0f) ||
       !(params->pcen_time_constant_s > 0.0f) ||
       !(params->pcen_cross_channel_diffusivity >= 0.0f) ||
       !(params->pcen_init_value >= 0.0f) ||
@@ -80,55 +103,93 @@ CarlFrontend* CarlFrontendMake(const CarlFrontendParams* params) {
       !(params->pcen_gamma > 0.0f) ||
       !(params->pcen_delta > 0.0f)) {
     fprintf(stderr, "CarlFrontendMake: Invalid CarlFrontendParams.\n");
-    return NULL;
+    return 0;
   } else if (!(params->block_size >= 1) ||
              !((params->block_size & (params->block_size - 1)) == 0)) {
     fprintf(stderr, "CarlFrontendMake: block_size must be a power of 2.\n");
-    return NULL;
+    return 0;
   }
 
   const double output_sample_rate_hz =
       params->input_sample_rate_hz / params->block_size;
-  const int num_channels = CountNumChannels(params);
+  const int num_channels = CarlFrontendCountNumChannels(params);
 
   if (params->envelope_cutoff_hz >= output_sample_rate_hz / 2) {
     fprintf(stderr, "CarlFrontendMake: envelope_cutoff_hz=%g "
             "too large for output sample rate %gHz.\n",
             params->envelope_cutoff_hz, output_sample_rate_hz);
-    return NULL;
+    return 0;
   } else if (params->pcen_cross_channel_diffusivity >=
              output_sample_rate_hz / 2) {
     fprintf(stderr, "CarlFrontendMake: pcen_cross_channel_diffusivity=%g "
             "too large for output sample rate %gHz.\n",
             params->pcen_cross_channel_diffusivity, output_sample_rate_hz);
-    return NULL;
+    return 0;
   } else if (!(num_channels >= 2)) {
     fprintf(stderr, "CarlFrontendMake: Must have at least 2 channels.\n");
-    return NULL;
+    return 0;
   }
 
-  /* Allocate CarlFrontend struct. */
-  CarlFrontend* frontend = (CarlFrontend*)malloc(sizeof(CarlFrontend));
-  if (frontend == NULL) {
-    fprintf(stderr, "Error: Memory allocation failed.\n");
-    return NULL;
-  }
-  frontend->channel_data = NULL;
-  frontend->channel_state = NULL;
-  /* Allocate per-channel structures. */
-  frontend->channel_data = (CarlFrontendChannelData*)malloc(
-      sizeof(CarlFrontendChannelData) * num_channels);
-  frontend->channel_state = (CarlFrontendChannelState*)malloc(
-      sizeof(CarlFrontendChannelState) * num_channels);
-  if (frontend->channel_data == NULL || frontend->channel_state == NULL) {
-    fprintf(stderr, "Error: Memory allocation failed.\n");
-    CarlFrontendFree(frontend);
-    return NULL;
+  const int num_output_channels = CarlFrontendCountNumOutputChannels(params);
+  if (!num_output_channels) {
+    fprintf(stderr, "CarlFrontendMake: Output channels [%d, %d + %d) are not "
+            "within the %d channels.\n", params->first_output_channel,
+            params->first_output_channel, params->num_output_channels,
+            num_channels);
+    return 0;
   }
+  return params->first_output_channel + num_output_channels;
+}
 
-  frontend->num_channels = num_channels;
-  frontend->block_size = params->block_size;
+/* Number of floats between consecutive hot arrays, num_channels rounded up to a
+ * multiple of 4 so that every array is 16-byte aligned.
+ */
+static int HotArrayStride(int num_channels) {
+  return (num_channels + 3) & ~3;
+}
+
+/* Gets the buffer size needed for a frontend with `num_channels` channels. */
+static size_t RequiredBytesForChannels(int num_channels) {
+  return kArenaAlignmentSlack + ArenaAllocationSize(sizeof(CarlFrontend)) +
+      ArenaAllocationSize(sizeof(CarlFrontendChannelData) * num_channels) +
+      ArenaAllocationSize(sizeof(float) * kCarlFrontendNumHotArrays *
+                          HotArrayStride(num_channels));
+}
+
+/* Gets the buffer size needed for a clone, which shares the channel design. */
+static size_t RequiredBytesForClone(int num_channels) {
+  return kArenaAlignmentSlack + ArenaAllocationSize(sizeof(CarlFrontend)) +
+      ArenaAllocationSize(sizeof(float) * kCarlFrontendNumHotArrays *
+                          HotArrayStride(num_channels));
+}
+
+/* Lays out the hot arrays back to back in loop order, from `hot_data`. */
+static void LayOutHotArrays(CarlFrontend* frontend, float* hot_data) {
+  float** hot_arrays[kCarlFrontendNumHotArrays];
+  hot_arrays[0] = &frontend->b0;
+  hot_arrays[1] = &frontend->b1;
+  hot_arrays[2] = &frontend->b2;
+  hot_arrays[3] = &frontend->a1;
+  hot_arrays[4] = &frontend->a2;
+  hot_arrays[5] = &frontend->envelope_smoother_coeff;
+  hot_arrays[6] = &frontend->biquad_z0;
+  hot_arrays[7] = &frontend->biquad_z1;
+  hot_arrays[8] = &frontend->diff_state;
+  hot_arrays[9] = &frontend->energy_envelope_stage1;
+  hot_arrays[10] = &frontend->energy_envelope;
+  hot_arrays[11] = &frontend->pcen_denom;
+  const int stride = HotArrayStride(frontend->num_channels);
+  int i;
+  for (i = 0; i < kCarlFrontendNumHotArrays; ++i) {
+    *hot_arrays[i] = hot_data + i * stride;
+  }
+}
 
+/* Sets the PCEN parameters, which don't affect the channel design. */
+static void SetPcenParams(CarlFrontend* frontend,
+                          const CarlFrontendParams* params) {
+  const double output_sample_rate_hz =
+      params->input_sample_rate_hz / params->block_size;
   /* Compute pcen_smoother_coeff from time constant. */
   frontend->pcen_smoother_coeff = (float)(1.0 - exp(
     -1.0 / (params->pcen_time_constant_s * output_sample_rate_hz)));
@@ -141,83 +202,444 @@ CarlFrontend* CarlFrontendMake(const CarlFrontendParams* params) {
   frontend->pcen_beta = params->pcen_beta;
   frontend->pcen_gamma = params->pcen_gamma;
   frontend->pcen_delta = params->pcen_delta;
-  frontend->pcen_offset = FastPow(params->pcen_delta, params->pcen_beta);
+  frontend->vectorized_pcen_compression = params->vectorized_pcen_compression;
+  /* Compute the offset with the same pow function as the compression, so that
+   * PCEN output is exactly zero for zero energy.
+   */
+  if (params->vectorized_pcen_compression) {
+    float offset[4];
+    Float4Store(offset, FastPowFloat4(Float4Broadcast(params->pcen_delta),
+                                      Float4Broadcast(params->pcen_beta)));
+    frontend->pcen_offset = offset[0];
+  } else {
+    frontend->pcen_offset = FastPow(params->pcen_delta, params->pcen_beta);
+  }
+}
+
+size_t CarlFrontendRequiredBytes(const CarlFrontendParams* params) {
+  const int num_channels = CheckParams(params);
+  if (!num_channels) { return 0; }
+  return RequiredBytesForChannels(num_channels);
+}
+
+CarlFrontend* CarlFrontendMake(const CarlFrontendParams* params) {
+  const size_t required_bytes = CarlFrontendRequiredBytes(params);
+  if (!required_bytes) { return NULL; }
+  void* buffer = AlignedAlloc(required_bytes);
+  if (buffer == NULL) {
+    fprintf(stderr, "Error: Memory allocation failed.\n");
+    return NULL;
+  }
+  CarlFrontend* frontend =
+      CarlFrontendInitInBuffer(buffer, required_bytes, params);
+  if (frontend == NULL) {
+    AlignedFree(buffer);
+    return NULL;
+  }
+  frontend->allocation = buffer;
+  return frontend;
+}
 
+CarlFrontend* CarlFrontendInitInBuffer(void* buffer, size_t buffer_size,
+                                       const CarlFrontendParams* params) {
+  const int num_channels = CheckParams(params);
+  if (!num_channels) { return NULL; }
+
+  /* Lay out the CarlFrontend struct and per-channel arrays in `buffer`. */
+  Arena arena;
+  ArenaInit(&arena, buffer, buffer_size);
+  CarlFrontend* frontend =
+      (CarlFrontend*)ArenaAlloc(&arena, sizeof(CarlFrontend));
+  float* hot_data;
+  if (frontend == NULL ||
+      !(frontend->channel_data = (CarlFrontendChannelData*)ArenaAlloc(
+            &arena, sizeof(CarlFrontendChannelData) * num_channels)) ||
+      !(hot_data = (float*)ArenaAlloc(&arena, sizeof(float) *
+            kCarlFrontendNumHotArrays * HotArrayStride(num_channels)))) {
+    fprintf(stderr, "CarlFrontendInitInBuffer: Buffer is too small.\n");
+    return NULL;
+  }
+  frontend->num_channels = num_channels;
+  LayOutHotArrays(frontend, hot_data);
+  frontend->allocation = NULL;
+  frontend->shares_channel_data = 0;
+  frontend->first_output_channel = params->first_output_channel;
+  frontend->block_size = params->block_size;
+  SetPcenParams(frontend, params);
+
+  /* Use a precomputed design if available, since designing is slow. */
+  const CarlFrontendPrecomputedDesign* precomputed =
+      CarlFrontendFindPrecomputedDesign(params);
+  if (precomputed != NULL && precomputed->num_channels >= num_channels) {
+    memcpy(frontend->channel_data, precomputed->channel_data,
+           sizeof(CarlFrontendChannelData) * num_channels);
+  } else {
+    CarlFrontendDesignChannels(params, num_channels, frontend->channel_data);
+  }
+  /* Copy coefficients from the design into the hot arrays. */
+  int c;
+  for (c = 0; c < num_channels; ++c) {
+    const CarlFrontendChannelData* data = &frontend->channel_data[c];
+    frontend->b0[c] = data->biquad_coeffs.b0;
+    frontend->b1[c] = data->biquad_coeffs.b1;
+    frontend->b2[c] = data->biquad_coeffs.b2;
+    frontend->a1[c] = data->biquad_coeffs.a1;
+    frontend->a2[c] = data->biquad_coeffs.a2;
+    frontend->envelope_smoother_coeff[c] = data->envelope_smoother_coeff;
+  }
+
+  CarlFrontendReset(frontend);
+  return frontend;
+}
+
+const CarlFrontendPrecomputedDesign* CarlFrontendFindPrecomputedDesign(
+    const CarlFrontendParams* params) {
+  const CarlFrontendParams* defaults = &kCarlFrontendDefaultParams;
+  if (params->highest_pole_frequency_hz !=
+          defaults->highest_pole_frequency_hz ||
+      params->min_pole_frequency_hz != defaults->min_pole_frequency_hz ||
+      params->step_erbs != defaults->step_erbs ||
+      params->envelope_cutoff_hz != defaults->envelope_cutoff_hz ||
+      params->min_samples_per_cycle != defaults->min_samples_per_cycle) {
+    return NULL;
+  }
+
+  int i;
+  for (i = 0; i < kCarlFrontendNumPrecomputedDesigns; ++i) {
+    const CarlFrontendPrecomputedDesign* design =
+        &kCarlFrontendPrecomputedDesigns[i];
+    if (params->input_sample_rate_hz == design->input_sample_rate_hz &&
+        params->block_size == design->block_size) {
+      return design;
+    }
+  }
+  return NULL;
+}
+
+void CarlFrontendDesignChannels(const CarlFrontendParams* params,
+                                int num_channels,
+                                CarlFrontendChannelData* channel_data) {
+  const double output_sample_rate_hz =
+      params->input_sample_rate_hz / params->block_size;
   double pole = params->highest_pole_frequency_hz;
   double sample_rate_hz = params->input_sample_rate_hz;
-  int c = 0;
+  int c;
 
   /* Iterate channels, starting with the highest frequency and going down. */
   for (c = 0; c < num_channels; ++c) {
-    const double kMaxSamplesPerCycle = 12.0;
     /* Decimate by factor 2 if possible before the next filter. */
     if (pole < params->highest_pole_frequency_hz &&
-        pole * kMaxSamplesPerCycle < sample_rate_hz &&
+        pole * (2.0 * params->min_samples_per_cycle) < sample_rate_hz &&
         sample_rate_hz >= 2 * output_sample_rate_hz) {
       sample_rate_hz /= 2.0;
-      frontend->channel_data[c].should_decimate = 1;
+      channel_data[c].should_decimate = 1;
     } else {
-      frontend->channel_data[c].should_decimate = 0;
+      channel_data[c].should_decimate = 0;
     }
 
     /* Design asymmetric resonator biquad filter. */
-    CarlFrontendDesignBiquad(pole, sample_rate_hz, &frontend->channel_data[c]);
+    CarlFrontendDesignBiquad(pole, sample_rate_hz, &channel_data[c]);
     /* Normalize channel output to have unit peak gain. */
     double peak_frequency_hz = pole;
     const double peak_gain = CarlFrontendFindPeakGain(
-        frontend->channel_data, c, params->input_sample_rate_hz,
+        channel_data, c, params->input_sample_rate_hz,
         &peak_frequency_hz);
-    frontend->channel_data[c].biquad_coeffs.b0 /= peak_gain;
-    frontend->channel_data[c].biquad_coeffs.b1 /= peak_gain;
-    frontend->channel_data[c].biquad_coeffs.b2 /= peak_gain;
+    channel_data[c].biquad_coeffs.b0 /= peak_gain;
+    channel_data[c].biquad_coeffs.b1 /= peak_gain;
+    channel_data[c].biquad_coeffs.b2 /= peak_gain;
 
-    frontend->channel_data[c].envelope_smoother_coeff =
+    channel_data[c].envelope_smoother_coeff =
       (float)(1.0 - ComputeGammaFilterZPole(
             2, params->envelope_cutoff_hz, sample_rate_hz));
 
     /* Get pole frequency for the next channel. */
     pole = CarlFrontendNextAuditoryFrequency(pole, params->step_erbs);
   }
+}
 
-  CarlFrontendReset(frontend);
+/* Number of hot coefficient arrays, b0 through envelope_smoother_coeff, which
+ * are the first ones and contiguous.
+ */
+#define kCarlFrontendNumCoeffArrays 6
+
+CarlFrontend* CarlFrontendClone(const CarlFrontend* frontend) {
+  if (frontend == NULL) { return NULL; }
+  const int num_channels = frontend->num_channels;
+  const size_t required_bytes = RequiredBytesForClone(num_channels);
+  void* buffer = AlignedAlloc(required_bytes);
+  if (buffer == NULL) {
+    fprintf(stderr, "Error: Memory allocation failed.\n");
+    return NULL;
+  }
+  /* Allocations can't fail, since the buffer has the required size. */
+  Arena arena;
+  ArenaInit(&arena, buffer, required_bytes);
+  CarlFrontend* clone =
+      (CarlFrontend*)ArenaAlloc(&arena, sizeof(CarlFrontend));
+  float* hot_data = (float*)ArenaAlloc(&arena, sizeof(float) *
+      kCarlFrontendNumHotArrays * HotArrayStride(num_channels));
+
+  /* Copy the params, and reference the cold channel design. */
+  *clone = *frontend;
+  clone->allocation = buffer;
+  clone->shares_channel_data = 1;
+  LayOutHotArrays(clone, hot_data);
+  memcpy(clone->b0, frontend->b0, sizeof(float) *
+         kCarlFrontendNumCoeffArrays * HotArrayStride(num_channels));
+  CarlFrontendReset(clone);
+  return clone;
+}
+
+/* A designed frontend in a CarlFrontendDesignCache. */
+typedef struct CarlFrontendDesignCacheEntry {
+  CarlFrontendParams params;
+  CarlFrontend* prototype;
+  struct CarlFrontendDesignCacheEntry* next;
+} CarlFrontendDesignCacheEntry;
+
+struct CarlFrontendDesignCache {
+  /* Singly-linked list of entries, most recently used first. */
+  CarlFrontendDesignCacheEntry* head;
+};
+
+CarlFrontendDesignCache* CarlFrontendDesignCacheMake(void) {
+  CarlFrontendDesignCache* cache =
+      (CarlFrontendDesignCache*)malloc(sizeof(CarlFrontendDesignCache));
+  if (cache == NULL) {
+    fprintf(stderr, "Error: Memory allocation failed.\n");
+    return NULL;
+  }
+  cache->head = NULL;
+  return cache;
+}
+
+void CarlFrontendDesignCacheFree(CarlFrontendDesignCache* cache) {
+  if (cache == NULL) { return; }
+  CarlFrontendDesignCacheEntry* entry = cache->head;
+  while (entry != NULL) {
+    CarlFrontendDesignCacheEntry* next = entry->next;
+    CarlFrontendFree(entry->prototype);
+    free(entry);
+    entry = next;
+  }
+  free(cache);
+}
+
+int CarlFrontendDesignCacheSize(const CarlFrontendDesignCache* cache) {
+  int size = 0;
+  const CarlFrontendDesignCacheEntry* entry;
+  for (entry = cache->head; entry != NULL; entry = entry->next) { ++size; }
+  return size;
+}
+
+/* Returns 1 if `a` and `b` lead to the same channel design and layout, that
+ * is, they are equal except possibly in the PCEN params.
+ */
+static int /*bool*/ SameDesign(const CarlFrontendParams* a,
+                               const CarlFrontendParams* b) {
+  return a->input_sample_rate_hz == b->input_sample_rate_hz &&
+      a->block_size == b->block_size &&
+      a->highest_pole_frequency_hz == b->highest_pole_frequency_hz &&
+      a->min_pole_frequency_hz == b->min_pole_frequency_hz &&
+      a->step_erbs == b->step_erbs &&
+      a->envelope_cutoff_hz == b->envelope_cutoff_hz &&
+      a->min_samples_per_cycle == b->min_samples_per_cycle &&
+      a->first_output_channel == b->first_output_channel &&
+      a->num_output_channels == b->num_output_channels;
+}
+
+CarlFrontend* CarlFrontendMakeCached(CarlFrontendDesignCache* cache,
+                                     const CarlFrontendParams* params) {
+  if (cache == NULL || !CheckParams(params)) { return NULL; }
+
+  CarlFrontendDesignCacheEntry** link = &cache->head;
+  while (*link != NULL && !SameDesign(&(*link)->params, params)) {
+    link = &(*link)->next;
+  }
+  CarlFrontendDesignCacheEntry* entry = *link;
+  if (entry != NULL) {
+    *link = entry->next;  /* Unlink to move it to the front below. */
+  } else {  /* Cache miss, design a new prototype. */
+    entry = (CarlFrontendDesignCacheEntry*)malloc(
+        sizeof(CarlFrontendDesignCacheEntry));
+    if (entry == NULL) {
+      fprintf(stderr, "Error: Memory allocation failed.\n");
+      return NULL;
+    } else if (!(entry->prototype = CarlFrontendMake(params))) {
+      free(entry);
+      return NULL;
+    }
+    entry->params = *params;
+  }
+  entry->next = cache->head;
+  cache->head = entry;
+
+  CarlFrontend* frontend = CarlFrontendClone(entry->prototype);
+  if (frontend != NULL) {
+    SetPcenParams(frontend, params);
+    CarlFrontendReset(frontend);
+  }
   return frontend;
 }
 
 void CarlFrontendFree(CarlFrontend* frontend) {
   if (frontend != NULL) {
-    free(frontend->channel_data);
-    free(frontend->channel_state);
-    free(frontend);
+    AlignedFree(frontend->allocation);
   }
 }
 
 void CarlFrontendReset(CarlFrontend* frontend) {
   int c;
   for (c = 0; c < frontend->num_channels; ++c) {
-    CarlFrontendChannelState* channel_state = &frontend->channel_state[c];
-    BiquadFilterInitZero(&channel_state->biquad_state);
-    channel_state->diff_state = 0.0f;
-    channel_state->energy_envelope_stage1 = 0.0f;
-    channel_state->energy_envelope = 0.0f;
+    frontend->biquad_z0[c] = 0.0f;
+    frontend->biquad_z1[c] = 0.0f;
+    frontend->diff_state[c] = 0.0f;
+    frontend->energy_envelope_stage1[c] = 0.0f;
+    frontend->energy_envelope[c] = 0.0f;
     /* Reset to small positive value, not zero, since it is a denominator. */
-    channel_state->pcen_denom = frontend->pcen_init_value;
+    frontend->pcen_denom[c] = frontend->pcen_init_value;
+  }
+}
+
+int CarlFrontendWarmStateSize(const CarlFrontend* frontend) {
+  return CarlFrontendNumChannels(frontend);
+}
+
+void CarlFrontendGetWarmState(const CarlFrontend* frontend,
+                              float* warm_state) {
+  memcpy(warm_state, frontend->pcen_denom + frontend->first_output_channel,
+         sizeof(float) * CarlFrontendNumChannels(frontend));
+}
+
+int CarlFrontendSetWarmState(CarlFrontend* frontend, const float* warm_state) {
+  const int num_output_channels = CarlFrontendNumChannels(frontend);
+  int c;
+  for (c = 0; c < num_output_channels; ++c) {
+    /* This also rejects NaN and infinity. */
+    if (!(0.0f <= warm_state[c] && warm_state[c] <= 1e30f)) {
+      fprintf(stderr, "Error: Invalid CarlFrontend warm state.\n");
+      return 0;
+    }
   }
+  memcpy(frontend->pcen_denom + frontend->first_output_channel, warm_state,
+         sizeof(float) * num_output_channels);
+  return 1;
+}
+
+/* The streaming state is the hot arrays from biquad_z0 through pcen_denom,
+ * which are the last ones and contiguous.
+ */
+#define kCarlFrontendNumStateArrays 6
+
+int CarlFrontendCheckpointSize(const CarlFrontend* frontend) {
+  return kCarlFrontendNumStateArrays * HotArrayStride(frontend->num_channels);
+}
+
+void CarlFrontendSaveCheckpoint(const CarlFrontend* frontend,
+                                float* checkpoint) {
+  memcpy(checkpoint, frontend->biquad_z0,
+         sizeof(float) * CarlFrontendCheckpointSize(frontend));
+}
+
+void CarlFrontendLoadCheckpoint(CarlFrontend* frontend,
+                                const float* checkpoint) {
+  memcpy(frontend->biquad_z0, checkpoint,
+         sizeof(float) * CarlFrontendCheckpointSize(frontend));
 }
 
 int CarlFrontendNumChannels(const CarlFrontend* frontend) {
-  return frontend->num_channels;
+  return frontend->num_channels - frontend->first_output_channel;
 }
 
 int CarlFrontendBlockSize(const CarlFrontend* frontend) {
   return frontend->block_size;
 }
 
-/* The PCEN compression formula. */
-static float PcenCompression(const CarlFrontend* frontend,
-    float energy, float smoothed_energy) {
-  return FastPow(energy * FastPow(frontend->pcen_gamma + smoothed_energy,
-                                  -frontend->pcen_alpha)
-      + frontend->pcen_delta, frontend->pcen_beta) - frontend->pcen_offset;
+int CarlFrontendFilterEvaluationsPerBlock(const CarlFrontend* frontend) {
+  int num_evaluations = 0;
+  int stride = 1;
+  int c;
+  for (c = 0; c < frontend->num_channels; ++c) {
+    if (frontend->channel_data[c].should_decimate) {
+      stride *= 2;
+    }
+    num_evaluations += frontend->block_size / stride;
+  }
+  return num_evaluations;
+}
+
+void CarlFrontendMemoryUsage(const CarlFrontend* frontend,
+                             MemoryUsage* usage) {
+  MemoryUsageZero(usage);
+  usage->heap_bytes = frontend->shares_channel_data
+      ? RequiredBytesForClone(frontend->num_channels)
+      : RequiredBytesForChannels(frontend->num_channels);
+  usage->table_bytes = sizeof(CarlFrontendPrecomputedDesign) *
+      kCarlFrontendNumPrecomputedDesigns;
+  int i;
+  for (i = 0; i < kCarlFrontendNumPrecomputedDesigns; ++i) {
+    usage->table_bytes += sizeof(CarlFrontendChannelData) *
+        kCarlFrontendPrecomputedDesigns[i].num_channels;
+  }
+}
+
+/* Computes PCEN-normalized energy for all output channels, four at a time if
+ * vectorized_pcen_compression is set.
+ */
+static void PcenCompression(const CarlFrontend* frontend, float* output) {
+  const int first = frontend->first_output_channel;
+  const int num_channels = frontend->num_channels - first;
+  const float* energy_envelope = frontend->energy_envelope + first;
+  const float* pcen_denom = frontend->pcen_denom + first;
+  int c;
+  if (!frontend->vectorized_pcen_compression) {
+    for (c = 0; c < num_channels; ++c) {
+      output[c] = CarlFrontendPcenCompression(
+          frontend, energy_envelope[c], pcen_denom[c]);
+    }
+    return;
+  }
+
+  for (c = 0; c + 4 <= num_channels; c += 4) {
+    Float4Store(output + c, CarlFrontendPcenCompressionFloat4(
+        frontend, Float4Load(energy_envelope + c),
+        Float4Load(pcen_denom + c)));
+  }
+  if (c < num_channels) {
+    /* Process the remaining 1-3 channels, padded with zero energy. */
+    float energy[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+    float denom[4] = {1.0f, 1.0f, 1.0f, 1.0f};
+    const int remaining = num_channels - c;
+    int j;
+    for (j = 0; j < remaining; ++j) {
+      energy[j] = energy_envelope[c + j];
+      denom[j] = pcen_denom[c + j];
+    }
+    Float4Store(energy, CarlFrontendPcenCompressionFloat4(
+        frontend, Float4Load(energy), Float4Load(denom)));
+    for (j = 0; j < remaining; ++j) { output[c + j] = energy[j]; }
+  }
+}
+
+/* Updates the PCEN denominator, the energy envelope lowpass filtered by a
+ * second one-pole smoother.
+ */
+static void PcenDenomUpdate(CarlFrontend* frontend) {
+  const int first = frontend->first_output_channel;
+  const int num_channels = frontend->num_channels - first;
+  const float* energy_envelope = frontend->energy_envelope + first;
+  float* pcen_denom = frontend->pcen_denom + first;
+  const float coeff = frontend->pcen_smoother_coeff;
+  const Float4 coeff4 = Float4Broadcast(coeff);
+  int c;
+  for (c = 0; c + 4 <= num_channels; c += 4) {
+    const Float4 denom = Float4Load(pcen_denom + c);
+    Float4Store(pcen_denom + c, Float4Add(denom, Float4Mul(coeff4,
+        Float4Sub(Float4Load(energy_envelope + c), denom))));
+  }
+  for (; c < num_channels; ++c) {
+    pcen_denom[c] += coeff * (energy_envelope[c] - pcen_denom[c]);
+  }
 }
 
 /* Smooth pcen_denom in-place across channels with a 3-tap filter:
@@ -226,97 +648,303 @@ static float PcenCompression(const CarlFrontend* frontend,
  *       pcen_denom[c+1] - 2 * pcen_denom[c] + pcen_denom[c-1]).
  *
  * This is 1-D heat equation with a forward Euler finite difference scheme.
- * Boundaries are handled reflecting; no flow across boundaries.
+ * Boundaries, the ends of the output channels, are handled reflecting; no flow
+ * across boundaries.
  */
 static void PcenDenomCrossChannelSmoothing(CarlFrontend* frontend) {
-  CarlFrontendChannelState* channel_state = frontend->channel_state;
-  const int num_channels = frontend->num_channels;
+  const int first = frontend->first_output_channel;
+  float* pcen_denom = frontend->pcen_denom + first;
+  const int num_channels = frontend->num_channels - first;
   const float coeff = frontend->pcen_cross_channel_smoother_coeff;
-
-  float left_flux;
-  float right_flux = channel_state[1].pcen_denom - channel_state[0].pcen_denom;
-  channel_state[0].pcen_denom += coeff * right_flux;
+  if (num_channels < 2) { return; }
 
   /* It is convenient to define flux[c] = (pcen_denom[c+1] - pcen_denom[c]) and
    * express the time step "in flux form" as
    *
-   *   new_pcen_denom[c] = pcen_denom[c] + coeff * (flux[c] - flux[c-1]),
+   *   new_pcen_denom[c] = pcen_denom[c] + coeff * (flux[c] - flux[c-1]).
    *
-   * or in-place as `pcen_denom[c] += coeff * (flux[c] - flux[c-1])`.
+   * Every channel is updated from the old values of its neighbors. The
+   * interior channels are updated four at a time, where `left` is formed from
+   * the old values by shifting in the old value of the channel below.
    */
+  float left_old = pcen_denom[0];
+  float left_flux;
+  float right_flux = pcen_denom[1] - pcen_denom[0];
+  pcen_denom[0] += coeff * right_flux;
+
+  const Float4 coeff4 = Float4Broadcast(coeff);
   int c;
-  for (c = 1; c < num_channels - 1; ++c) {
+  for (c = 1; c + 4 < num_channels; c += 4) {
+    const Float4 center = Float4Load(pcen_denom + c);
+    const Float4 right = Float4Load(pcen_denom + c + 1);
+    const Float4 left = Float4ShiftLanesUp(center, left_old);
+    left_old = Float4GetLane(center, 3);
+    const Float4 right_flux4 = Float4Sub(right, center);
+    const Float4 left_flux4 = Float4Sub(center, left);
+    Float4Store(pcen_denom + c, Float4Add(center,
+        Float4Mul(coeff4, Float4Sub(right_flux4, left_flux4))));
+    right_flux = Float4GetLane(right_flux4, 3);
+  }
+
+  for (; c < num_channels - 1; ++c) {
     left_flux = right_flux;
-    right_flux = channel_state[c + 1].pcen_denom - channel_state[c].pcen_denom;
-    channel_state[c].pcen_denom += coeff * (right_flux - left_flux);
+    right_flux = pcen_denom[c + 1] - pcen_denom[c];
+    pcen_denom[c] += coeff * (right_flux - left_flux);
+  }
+
+  pcen_denom[c] -= coeff * right_flux;
+}
+
+/* Coefficients and state of one channel, held in locals while processing. */
+typedef struct {
+  BiquadFilterCoeffs biquad_coeffs;
+  float envelope_smoother_coeff;
+  BiquadFilterState biquad_state;
+  float diff_state;
+  float energy_envelope_stage1;
+  float energy_envelope;
+} ChannelLocals;
+
+/* Loads channel `c` from the hot arrays. */
+static void LoadChannel(const CarlFrontend* frontend, int c,
+                        ChannelLocals* channel) {
+  channel->biquad_coeffs.b0 = frontend->b0[c];
+  channel->biquad_coeffs.b1 = frontend->b1[c];
+  channel->biquad_coeffs.b2 = frontend->b2[c];
+  channel->biquad_coeffs.a1 = frontend->a1[c];
+  channel->biquad_coeffs.a2 = frontend->a2[c];
+  channel->envelope_smoother_coeff = frontend->envelope_smoother_coeff[c];
+  channel->biquad_state.z[0] = frontend->biquad_z0[c];
+  channel->biquad_state.z[1] = frontend->biquad_z1[c];
+  channel->diff_state = frontend->diff_state[c];
+  channel->energy_envelope_stage1 = frontend->energy_envelope_stage1[c];
+  channel->energy_envelope = frontend->energy_envelope[c];
+}
+
+/* Stores the state of channel `c` back to the hot arrays. */
+static void StoreChannelState(CarlFrontend* frontend, int c,
+                              const ChannelLocals* channel) {
+  frontend->biquad_z0[c] = channel->biquad_state.z[0];
+  frontend->biquad_z1[c] = channel->biquad_state.z[1];
+  frontend->diff_state[c] = channel->diff_state;
+  frontend->energy_envelope_stage1[c] = channel->energy_envelope_stage1;
+  frontend->energy_envelope[c] = channel->energy_envelope;
+}
+
+/* Processes one sample `x` through `channel`. Returns the channel's biquad
+ * output, which is the input to the next channel.
+ */
+static float ChannelProcessOneSample(ChannelLocals* channel, float x) {
+  /* Apply asymmetric resonator biquad filter. */
+  const float biquad_output = BiquadFilterProcessOneSample(
+      &channel->biquad_coeffs, &channel->biquad_state, x);
+
+  /* Apply difference filter. This computes CARL's output. */
+  const float carl_output = biquad_output - channel->diff_state;
+  channel->diff_state = biquad_output;
+
+  /* Half-wave rectification and square to get energy. */
+  const float energy = (carl_output > 0.0f)
+      ? carl_output * carl_output : 0.0f;
+
+  /* Apply 2nd-order Gamma filter to get anti-aliased energy envelope. */
+  channel->energy_envelope_stage1 += channel->envelope_smoother_coeff * (
+      energy - channel->energy_envelope_stage1);
+  channel->energy_envelope += channel->envelope_smoother_coeff * (
+      channel->energy_envelope_stage1 - channel->energy_envelope);
+  return biquad_output;
+}
+
+/* Processes `input[i]` for i = 0, stride, 2 * stride, ... < block_size through
+ * channel `c`, overwriting `input` with the output so that the next biquad is
+ * cascaded with this one. If `compute_envelope` is zero, only the cascade
+ * biquad is run, for channels before the first output channel.
+ */
+static void ProcessChannel(CarlFrontend* frontend, int c,
+                           float* input, int block_size, int stride,
+                           int /*bool*/ compute_envelope) {
+  ChannelLocals channel;
+  LoadChannel(frontend, c, &channel);
+  int i;
+  if (compute_envelope) {
+    for (i = 0; i < block_size; i += stride) {
+      input[i] = ChannelProcessOneSample(&channel, input[i]);
+    }
+  } else {
+    for (i = 0; i < block_size; i += stride) {
+      input[i] = BiquadFilterProcessOneSample(
+          &channel.biquad_coeffs, &channel.biquad_state, input[i]);
+    }
   }
+  StoreChannelState(frontend, c, &channel);
+}
 
-  channel_state[c].pcen_denom -= coeff * right_flux;
+/* Steps the biquads of four channels with input `x`, updating the state
+ * `*z0` and `*z1`, and returns their outputs.
+ */
+static Float4 BiquadFloat4ProcessOneSample(
+    Float4 b0, Float4 b1, Float4 b2, Float4 a1, Float4 a2,
+    Float4* z0, Float4* z1, Float4 x) {
+  const Float4 next_state = Float4Sub(
+      Float4Sub(x, Float4Mul(a1, *z0)), Float4Mul(a2, *z1));
+  const Float4 output = Float4Add(
+      Float4Add(Float4Mul(b0, next_state), Float4Mul(b1, *z0)),
+      Float4Mul(b2, *z1));
+  *z1 = *z0;
+  *z0 = next_state;
+  return output;
+}
+
+/* Processes four consecutive channels at the same stride as a wavefront.
+ *
+ * Rather than running each channel over the whole block before moving to the
+ * next, the four channels are in the four Float4 lanes and staggered by one
+ * sample: at step t, lane k processes sample t - k of channel k, taking as
+ * input the output of lane k - 1 from step t - 1. This way the cascade stays in
+ * registers and the block is read and written once for all four channels. In
+ * the first and last three steps, not all lanes are active, and these steps
+ * are done in scalar code. The result is the same as `ProcessChannel()` on each
+ * channel in sequence, with the same `compute_envelope`.
+ */
+static void ProcessChannelsWavefront(CarlFrontend* frontend, int c,
+                                     float* input, int block_size,
+                                     int stride,
+                                     int /*bool*/ compute_envelope) {
+  const int num_samples = block_size / stride;
+  const int num_steps = num_samples + 3;
+  /* lane_output[k] is the output of lane k from the previous step. */
+  float lane_output[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+  int t = 0;
+
+  while (t < num_steps) {
+    if (3 <= t && t < num_samples) {
+      /* All lanes are active. Load coefficients and state of channels c to
+       * c + 3, which are contiguous in the hot arrays.
+       */
+      const Float4 b0 = Float4Load(frontend->b0 + c);
+      const Float4 b1 = Float4Load(frontend->b1 + c);
+      const Float4 b2 = Float4Load(frontend->b2 + c);
+      const Float4 a1 = Float4Load(frontend->a1 + c);
+      const Float4 a2 = Float4Load(frontend->a2 + c);
+      const Float4 smoother_coeff =
+          Float4Load(frontend->envelope_smoother_coeff + c);
+      const Float4 zero = Float4Broadcast(0.0f);
+      Float4 z0 = Float4Load(frontend->biquad_z0 + c);
+      Float4 z1 = Float4Load(frontend->biquad_z1 + c);
+      Float4 diff_state = Float4Load(frontend->diff_state + c);
+      Float4 energy_envelope_stage1 =
+          Float4Load(frontend->energy_envelope_stage1 + c);
+      Float4 energy_envelope = Float4Load(frontend->energy_envelope + c);
+      Float4 output = Float4Load(lane_output);
+
+      if (!compute_envelope) {
+        for (; t < num_samples; ++t) {
+          output = BiquadFloat4ProcessOneSample(b0, b1, b2, a1, a2, &z0, &z1,
+              Float4ShiftLanesUp(output, input[t * stride]));
+          input[(t - 3) * stride] = Float4GetLane(output, 3);
+        }
+      }
+
+      for (; t < num_samples; ++t) {
+        output = BiquadFloat4ProcessOneSample(b0, b1, b2, a1, a2, &z0, &z1,
+            Float4ShiftLanesUp(output, input[t * stride]));
+
+        /* Lane 3 finishes sample t - 3 of the last channel. */
+        input[(t - 3) * stride] = Float4GetLane(output, 3);
+
+        Float4 carl_output = Float4Sub(output, diff_state);
+        diff_state = output;
+        /* Same as `(carl_output > 0) ? carl_output^2 : 0`, including NaN. */
+        carl_output = Float4Max(carl_output, zero);
+        const Float4 energy = Float4Mul(carl_output, carl_output);
+
+        energy_envelope_stage1 = Float4Add(energy_envelope_stage1,
+            Float4Mul(smoother_coeff,
+                      Float4Sub(energy, energy_envelope_stage1)));
+        energy_envelope = Float4Add(energy_envelope,
+            Float4Mul(smoother_coeff,
+                      Float4Sub(energy_envelope_stage1, energy_envelope)));
+      }
+
+      /* Store state back. */
+      Float4Store(lane_output, output);
+      Float4Store(frontend->biquad_z0 + c, z0);
+      Float4Store(frontend->biquad_z1 + c, z1);
+      Float4Store(frontend->diff_state + c, diff_state);
+      Float4Store(frontend->energy_envelope_stage1 + c,
+                  energy_envelope_stage1);
+      Float4Store(frontend->energy_envelope + c, energy_envelope);
+    } else {
+      /* Some lanes are inactive. Process the active lanes in scalar code, in
+       * descending order so that lane_output[k - 1] is still from step t - 1.
+       */
+      int k;
+      for (k = 3; k >= 0; --k) {
+        const int n = t - k;
+        if (0 <= n && n < num_samples) {
+          const float x = (k == 0) ? input[n * stride] : lane_output[k - 1];
+          ChannelLocals channel;
+          LoadChannel(frontend, c + k, &channel);
+          lane_output[k] = compute_envelope
+              ? ChannelProcessOneSample(&channel, x)
+              : BiquadFilterProcessOneSample(
+                    &channel.biquad_coeffs, &channel.biquad_state, x);
+          StoreChannelState(frontend, c + k, &channel);
+          if (k == 3) {
+            input[n * stride] = lane_output[k];
+          }
+        }
+      }
+      ++t;
+    }
+  }
 }
 
 void CarlFrontendProcessSamples(CarlFrontend* frontend,
                                 float* input,
                                 float* output) {
   const int num_channels = frontend->num_channels;
-  int c;
+  const int first_output_channel = frontend->first_output_channel;
+  const int block_size = frontend->block_size;
+  int c = 0;
   int stride = 1;
+  DenormalGuard guard;
+  DenormalGuardBegin(&guard);
+  /* Dither the hot state arrays biquad_z0 through energy_envelope, which are
+   * contiguous.
+   */
+  DenormalsDither(frontend->biquad_z0,
+                  (int)(frontend->pcen_denom - frontend->biquad_z0));
 
-  for (c = 0; c < num_channels; ++c) {
-    const CarlFrontendChannelData channel_data = frontend->channel_data[c];
-    CarlFrontendChannelState channel_state = frontend->channel_state[c];
-
-    if (channel_data.should_decimate) {
+  while (c < num_channels) {
+    if (frontend->channel_data[c].should_decimate) {
       stride *= 2;  /* Decimate by factor 2. */
     }
 
-    int i;
-    for (i = 0; i < frontend->block_size; i += stride) {
-      /* Apply asymmetric resonator biquad filter. */
-      const float biquad_output = BiquadFilterProcessOneSample(
-          &channel_data.biquad_coeffs, &channel_state.biquad_state, input[i]);
-
-      /* Overwrite `input` with the output so that the next biquad is cascaded
-       * with this one.
-       */
-      input[i] = biquad_output;
-
-      /* Apply difference filter. This computes CARL's output. */
-      const float carl_output = biquad_output - channel_state.diff_state;
-      channel_state.diff_state = biquad_output;
-
-      /* Half-wave rectification and square to get energy. */
-      const float energy = (carl_output > 0.0f)
-          ? carl_output * carl_output : 0.0f;
-
-      /* Apply 2nd-order Gamma filter to get anti-aliased energy envelope. */
-      channel_state.energy_envelope_stage1 +=
-          channel_data.envelope_smoother_coeff * (
-              energy - channel_state.energy_envelope_stage1);
-      channel_state.energy_envelope +=
-          channel_data.envelope_smoother_coeff * (
-              channel_state.energy_envelope_stage1
-              - channel_state.energy_envelope);
+    /* Use the wavefront if the next four channels have the same stride. It
+     * computes envelopes if any of the four channels is an output channel.
+     */
+    if (c + 4 <= num_channels &&
+        !frontend->channel_data[c + 1].should_decimate &&
+        !frontend->channel_data[c + 2].should_decimate &&
+        !frontend->channel_data[c + 3].should_decimate) {
+      ProcessChannelsWavefront(frontend, c, input, block_size, stride,
+                               c + 3 >= first_output_channel);
+      c += 4;
+    } else {
+      ProcessChannel(frontend, c, input, block_size, stride,
+                     c >= first_output_channel);
+      ++c;
     }
-
-    frontend->channel_state[c] = channel_state;
   }
 
   /* Second pass of lowpass filtering for PCEN denominator, done here outside
    * the loop on the downsampled envelope.
    */
-  const float pcen_smoother_coeff = frontend->pcen_smoother_coeff;
-  for (c = 0; c < num_channels; ++c) {
-    frontend->channel_state[c].pcen_denom += pcen_smoother_coeff * (
-        frontend->channel_state[c].energy_envelope
-        - frontend->channel_state[c].pcen_denom);
-  }
-
+  PcenDenomUpdate(frontend);
   /* Smooth pcen_denom across channels. */
   PcenDenomCrossChannelSmoothing(frontend);
   /* Compute PCEN-normalized energy. */
-  for (c = 0; c < num_channels; ++c) {
-    output[c] = PcenCompression(frontend,
-                                frontend->channel_state[c].energy_envelope,
-                                frontend->channel_state[c].pcen_denom);
-  }
+  PcenCompression(frontend, output);
+  DenormalGuardEnd(&guard);
 }
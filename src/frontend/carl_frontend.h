@@ -31,6 +31,10 @@
 #ifndef AUDIO_TO_TACTILE_SRC_FRONTEND_CARL_FRONTEND_H_
 #define AUDIO_TO_TACTILE_SRC_FRONTEND_CARL_FRONTEND_H_
 
+#include <stddef.h>
+
+#include "dsp/memory_usage.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -50,6 +54,15 @@ struct CarlFrontendParams {
   float step_erbs;
   /* Cutoff frequency in Hz for smoothing energy envelopes. */
   float envelope_cutoff_hz;
+  /* Controls decimation in the cascade. Before each channel, the cascade is
+   * decimated by 2 if the channel's pole frequency would still have at least
+   * this many samples per cycle at the decimated rate, and the rate stays at
+   * least the output sample rate. The default 6 is conservative. Smaller
+   * values, down to 3, decimate the low channels more aggressively for fewer
+   * filter evaluations per block, at the cost of some aliasing in the
+   * channels' upper skirts.
+   */
+  float min_samples_per_cycle;
 
   /* Time constant for the lowpass filter that produces the PCEN denominator. */
   float pcen_time_constant_s;
@@ -75,6 +88,25 @@ struct CarlFrontendParams {
   float pcen_beta;   /* PCEN beta (outer) exponent applied to the ratio. */
   float pcen_gamma;  /* PCEN denominator offset. */
   float pcen_delta;  /* PCEN zero offset. */
+
+  /* Optionally, outputs only the channel subset `first_output_channel`
+   * through `first_output_channel + num_output_channels - 1`, for consumers
+   * that need only some of the bands. The cascade then runs only down to the
+   * last output channel, and channels before the first output channel run
+   * the cascade filter without computing their energy envelopes. PCEN
+   * cross-channel smoothing is confined to the subset, reflecting at its
+   * ends. The default num_output_channels = 0 means all channels from
+   * first_output_channel on.
+   */
+  int first_output_channel;
+  int num_output_channels;
+
+  /* If nonzero, PCEN compression is computed four channels at a time with
+   * FastPowFloat4(). This is about 2% faster per block on x86, but since
+   * FastPowFloat4() differs in accuracy from the scalar FastPow(), output
+   * differs from the default path by up to about 2e-3. The default is 0.
+   */
+  int /*bool*/ vectorized_pcen_compression;
 };
 typedef struct CarlFrontendParams CarlFrontendParams;
 
@@ -91,15 +123,121 @@ CarlFrontend* CarlFrontendMake(const CarlFrontendParams* params);
 /* Frees a CarlFrontend. */
 void CarlFrontendFree(CarlFrontend* frontend);
 
-/* Gets the number of output channels. */
+/* Gets the buffer size in bytes needed by CarlFrontendInitInBuffer() for
+ * `params`, or 0 if `params` are invalid.
+ */
+size_t CarlFrontendRequiredBytes(const CarlFrontendParams* params);
+
+/* Same as CarlFrontendMake(), but lays out the frontend in a caller-provided
+ * `buffer` of `buffer_size` bytes instead of allocating, see dsp/arena.h. The
+ * buffer must be at least CarlFrontendRequiredBytes(params) bytes and outlive
+ * the frontend. CarlFrontendFree() may be called on the result, but does not
+ * free the buffer. Returns NULL on failure.
+ */
+CarlFrontend* CarlFrontendInitInBuffer(void* buffer, size_t buffer_size,
+                                       const CarlFrontendParams* params);
+
+/* Makes a new frontend with the same params and design as `frontend`, in
+ * initial state. This is fast, since the channel design is not recomputed: the
+ * clone references the design held by `frontend`, which must outlive the clone
+ * (for a clone of a clone, the original frontend must), and copies only the
+ * filter coefficients that the cascade reads per sample. Cloning only reads
+ * `frontend`, so it may be done from several threads at once. The caller
+ * should free the clone with CarlFrontendFree. Returns NULL on failure.
+ */
+CarlFrontend* CarlFrontendClone(const CarlFrontend* frontend);
+
+/* Cache of frontend designs, for code that makes many frontends, e.g. one per
+ * audio file in a batch tool. CarlFrontendMakeCached() designs a frontend on
+ * the first call with a given channel design, then clones it on subsequent
+ * calls. The design depends on all params except the PCEN params, so calls
+ * differing only in PCEN params share a design. The cache is not thread safe.
+ *
+ * Example use:
+ *   CarlFrontendDesignCache* cache = CarlFrontendDesignCacheMake();
+ *   for (i = 0; i < num_files; ++i) {
+ *     CarlFrontend* frontend = CarlFrontendMakeCached(cache, &params);
+ *     ...
+ *     CarlFrontendFree(frontend);
+ *   }
+ *   CarlFrontendDesignCacheFree(cache);
+ */
+struct CarlFrontendDesignCache;
+typedef struct CarlFrontendDesignCache CarlFrontendDesignCache;
+
+/* Makes an empty cache. Returns NULL on failure. */
+CarlFrontendDesignCache* CarlFrontendDesignCacheMake(void);
+
+/* Frees a cache. Frontends made from it must be freed first. */
+void CarlFrontendDesignCacheFree(CarlFrontendDesignCache* cache);
+
+/* Gets the number of designs in the cache. */
+int CarlFrontendDesignCacheSize(const CarlFrontendDesignCache* cache);
+
+/* Same as CarlFrontendMake(), but reuses a design in `cache` if there is one
+ * for `params`, and otherwise adds one. The caller should free the frontend
+ * with CarlFrontendFree, before freeing the cache. Returns NULL on failure.
+ */
+CarlFrontend* CarlFrontendMakeCached(CarlFrontendDesignCache* cache,
+                                     const CarlFrontendParams* params);
+
+/* Gets the number of output channels, which is num_output_channels if a
+ * channel subset is selected.
+ */
 int CarlFrontendNumChannels(const CarlFrontend* frontend);
 
 /* Gets the block size. */
 int CarlFrontendBlockSize(const CarlFrontend* frontend);
 
+/* Gets the number of channel filter evaluations per block, summed over all
+ * channels at their decimated rates. This is a measure of the compute cost.
+ */
+int CarlFrontendFilterEvaluationsPerBlock(const CarlFrontend* frontend);
+
+/* Gets the memory used by `frontend`, see dsp/memory_usage.h. Heap bytes are
+ * the frontend's buffer and table bytes are the precomputed channel designs.
+ */
+void CarlFrontendMemoryUsage(const CarlFrontend* frontend, MemoryUsage* usage);
+
 /* Resets the frontend to initial state. */
 void CarlFrontendReset(CarlFrontend* frontend);
 
+/* Gets the number of floats in the warm state, equal to the number of output
+ * channels.
+ */
+int CarlFrontendWarmStateSize(const CarlFrontend* frontend);
+
+/* Gets the slowly-adapting "warm" state, the PCEN denominator of each output
+ * channel, as an array of CarlFrontendWarmStateSize() floats. This may be
+ * persisted and later restored with CarlFrontendSetWarmState(), so that PCEN
+ * doesn't restart from `pcen_init_value`, e.g. after a reboot.
+ */
+void CarlFrontendGetWarmState(const CarlFrontend* frontend, float* warm_state);
+
+/* Restores warm state from CarlFrontendGetWarmState(). Returns 1 on success,
+ * or 0 if `warm_state` has invalid values, in which case the frontend is
+ * unchanged.
+ */
+int /*bool*/ CarlFrontendSetWarmState(CarlFrontend* frontend,
+                                      const float* warm_state);
+
+/* Gets the number of floats in a checkpoint of the full frontend state. */
+int CarlFrontendCheckpointSize(const CarlFrontend* frontend);
+
+/* Saves the full streaming state, the filter states, energy envelopes, and
+ * PCEN denominators, as an array of CarlFrontendCheckpointSize() floats.
+ * Unlike warm state, restoring a checkpoint with CarlFrontendLoadCheckpoint()
+ * resumes processing exactly, e.g. to seek in an offline tool.
+ */
+void CarlFrontendSaveCheckpoint(const CarlFrontend* frontend,
+                                float* checkpoint);
+
+/* Restores a checkpoint from CarlFrontendSaveCheckpoint() of a frontend made
+ * with the same params.
+ */
+void CarlFrontendLoadCheckpoint(CarlFrontend* frontend,
+                                const float* checkpoint);
+
 /* Runs the CARL+PCEN frontend in a streaming manner. `input` is an array of
  * `block_size` input samples at rate `sample_rate_hz`. `output` is  an array of
  * size `CarlFrontendNumChannels`.
@@ -20,6 +20,9 @@
 #define AUDIO_TO_TACTILE_SRC_FRONTEND_CARL_FRONTEND_DESIGN_H_
 
 #include "dsp/biquad_filter.h"
+#include "dsp/fast_fun.h"
+#include "dsp/fast_fun_simd.h"
+#include "frontend/carl_frontend.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -32,20 +35,42 @@ struct CarlFrontendChannelData {
 };
 typedef struct CarlFrontendChannelData CarlFrontendChannelData;
 
-struct CarlFrontendChannelState {
-  BiquadFilterState biquad_state;
-  float diff_state;
-  float energy_envelope_stage1;
-  float energy_envelope;
-  float pcen_denom;
-};
-typedef struct CarlFrontendChannelState CarlFrontendChannelState;
+/* Number of hot float arrays in CarlFrontend, b0 through pcen_denom. */
+#define kCarlFrontendNumHotArrays 12
 
 struct CarlFrontend {
+  /* Hot per-channel data, read and written every sample by the cascade. Each
+   * is an array of size num_channels. They are back to back in this order in
+   * one cache-line-aligned allocation, each padded to a multiple of 4 floats,
+   * so that four consecutive channels load as one Float4 in the wavefront
+   * without gathering. Biquad coefficients are copied here from
+   * `channel_data` at init.
+   */
+  float* b0;
+  float* b1;
+  float* b2;
+  float* a1;
+  float* a2;
+  float* envelope_smoother_coeff;
+  float* biquad_z0;
+  float* biquad_z1;
+  float* diff_state;
+  float* energy_envelope_stage1;
+  float* energy_envelope;
+  float* pcen_denom;
+  /* Cold channel design. Per block, only `should_decimate` is read. */
   CarlFrontendChannelData* channel_data;
-  CarlFrontendChannelState* channel_state;
+  /* Buffer to free in CarlFrontendFree(), or NULL if the caller owns it. */
+  void* allocation;
+  /* Nonzero for a clone, whose `channel_data` is that of another frontend. */
+  int shares_channel_data;
 
+  /* Number of channels in the cascade, through the last output channel. */
   int num_channels;
+  /* Output is channels first_output_channel through num_channels - 1. Before
+   * it, channels run the cascade filter only.
+   */
+  int first_output_channel;
   int block_size;
 
   float pcen_smoother_coeff;
@@ -56,8 +81,36 @@ struct CarlFrontend {
   float pcen_gamma;
   float pcen_delta;
   float pcen_offset;
+  int vectorized_pcen_compression;
 };
 
+/* The PCEN compression formula,
+ *
+ *   (energy / (gamma + smoothed_energy)^alpha + delta)^beta - delta^beta.
+ */
+static float CarlFrontendPcenCompression(const CarlFrontend* frontend,
+                                         float energy, float smoothed_energy) {
+  return FastPow(energy * FastPow(frontend->pcen_gamma + smoothed_energy,
+                                  -frontend->pcen_alpha)
+      + frontend->pcen_delta, frontend->pcen_beta) - frontend->pcen_offset;
+}
+
+/* Same as CarlFrontendPcenCompression(), for four channels. This is used with
+ * vectorized_pcen_compression, which also computes pcen_offset with
+ * FastPowFloat4().
+ */
+static Float4 CarlFrontendPcenCompressionFloat4(const CarlFrontend* frontend,
+                                                Float4 energy,
+                                                Float4 smoothed_energy) {
+  const Float4 ratio = Float4Mul(energy, FastPowFloat4(
+      Float4Add(Float4Broadcast(frontend->pcen_gamma), smoothed_energy),
+      Float4Broadcast(-frontend->pcen_alpha)));
+  return Float4Sub(
+      FastPowFloat4(Float4Add(ratio, Float4Broadcast(frontend->pcen_delta)),
+                    Float4Broadcast(frontend->pcen_beta)),
+      Float4Broadcast(frontend->pcen_offset));
+}
+
 /* Gets the next pole frequency, `step_erbs` ERBs below `frequency_hz`. */
 double CarlFrontendNextAuditoryFrequency(double frequency_hz, double step_erbs);
 
@@ -72,6 +125,43 @@ void CarlFrontendDesignBiquad(double pole_frequency_hz, double sample_rate_hz,
 double CarlFrontendFindPeakGain(const CarlFrontendChannelData* channel_data,
                                 int channel_index, double input_sample_rate_hz,
                                 double* peak_frequency_hz);
+
+/* Counts how many channels CarlFrontendMake() will generate for `params`. */
+int CarlFrontendCountNumChannels(const CarlFrontendParams* params);
+
+/* Counts how many channels CarlFrontendMake() will output for `params`, taking
+ * the channel subset into account, or returns 0 if the subset is invalid.
+ */
+int CarlFrontendCountNumOutputChannels(const CarlFrontendParams* params);
+
+/* Designs all `num_channels` channels for `params`, as CarlFrontendMake()
+ * does when no precomputed design is available.
+ */
+void CarlFrontendDesignChannels(const CarlFrontendParams* params,
+                                int num_channels,
+                                CarlFrontendChannelData* channel_data);
+
+/* Precomputed channel design, to speed up CarlFrontendMake(). The channel
+ * design depends only on the sample rate, block size, pole frequency params,
+ * envelope_cutoff_hz, and min_samples_per_cycle. Precomputed designs are for
+ * the values of these in kCarlFrontendDefaultParams, with standard sample
+ * rates and block sizes.
+ */
+typedef struct {
+  float input_sample_rate_hz;
+  int block_size;
+  int num_channels;
+  const CarlFrontendChannelData* channel_data;
+} CarlFrontendPrecomputedDesign;
+
+/* Table of precomputed designs, defined in carl_frontend_tables.c. */
+extern const CarlFrontendPrecomputedDesign kCarlFrontendPrecomputedDesigns[];
+extern const int kCarlFrontendNumPrecomputedDesigns;
+
+/* Returns the precomputed design for `params`, or NULL if there is none. */
+const CarlFrontendPrecomputedDesign* CarlFrontendFindPrecomputedDesign(
+    const CarlFrontendParams* params);
+
 #ifdef __cplusplus
 }  /* extern "C" */
 #endif
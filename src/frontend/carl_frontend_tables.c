@@ -0,0 +1,496 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * Precomputed CARL frontend channel designs.
+ *
+ * These are the designs from CarlFrontendDesignChannels() for
+ * kCarlFrontendDefaultParams at the SAADC sample rate 15625 Hz and at 16 kHz,
+ * with block sizes 32 and 64, so that CarlFrontendMake() skips the slow
+ * double-precision design for these configurations. Tables after the
+ * includes can be regenerated by running the unit test as
+ *
+ * carl_frontend_test --print_tables
+ */
+
+#include "frontend/carl_frontend_design.h"
+
+static const CarlFrontendChannelData kChannelData15625HzBlock32[56] = {
+    {{0.259411722, 0.492892861, 0.247057229, 1.80719543, 0.908139229},
+     0, 0.0124183251},
+    {{0.746973753, 1.35703671, 0.695196033, 1.65519977, 0.869601488},
+     0, 0.0124183251},
+    {{0.743633449, 1.2768836, 0.677471161, 1.48230553, 0.837193072},
+     0, 0.0124183251},
+    {{0.724160492, 1.16167462, 0.646916747, 1.29668808, 0.810475588},
+     0, 0.0124183251},
+    {{0.704099655, 1.04238832, 0.617864847, 1.10462379, 0.788927674},
+     0, 0.0124183251},
+    {{0.6855582, 0.924198866, 0.592002392, 0.910855889, 0.772003114},
+     0, 0.0124183251},
+    {{0.668713748, 0.808455467, 0.569271147, 0.71891284, 0.759165764},
+     0, 0.0124183251},
+    {{0.653348386, 0.695659518, 0.549295068, 0.531374037, 0.74990809},
+     0, 0.0124183251},
+    {{0.639249027, 0.586187303, 0.531730473, 0.350082129, 0.743761301},
+     0, 0.0124183251},
+    {{0.626297355, 0.480414808, 0.516335428, 0.176310897, 0.74029839},
+     0, 0.0124183251},
+    {{0.614438474, 0.3786681, 0.502936006, 0.0108963503, 0.739134908},
+     0, 0.0124183251},
+    {{0.603641391, 0.281184465, 0.491390169, -0.145661384, 0.739927113},
+     0, 0.0124183251},
+    {{0.593877792, 0.188108027, 0.481568009, -0.293119013, 0.742369473},
+     0, 0.0124183251},
+    {{0.585114181, 0.0995026529, 0.473344803, -0.431428581, 0.746191561},
+     0, 0.0124183251},
+    {{0.577311218, 0.0153684067, 0.466599762, -0.56068939, 0.751154959},
+     0, 0.0124183251},
+    {{0.570424378, -0.064343527, 0.461215496, -0.681110561, 0.757050276},
+     0, 0.0124183251},
+    {{0.564406097, -0.139718905, 0.45707947, -0.792981684, 0.763694167},
+     0, 0.0124183251},
+    {{0.559206188, -0.2108711, 0.454083592, -0.896649182, 0.770926774},
+     0, 0.0124183251},
+    {{0.554774523, -0.277934194, 0.452125788, -0.992498636, 0.778609097},
+     0, 0.0124183251},
+    {{0.551060319, -0.341057181, 0.451108992, -1.08093977, 0.786620915},
+     0, 0.0124183251},
+    {{0.548014283, -0.400400221, 0.450942427, -1.16239536, 0.794858634},
+     0, 0.0124183251},
+    {{0.545588613, -0.456131309, 0.451541364, -1.23729241, 0.803233445},
+     0, 0.0124183251},
+    {{0.543736577, -0.508422494, 0.452825963, -1.30605471, 0.811669767},
+     0, 0.0124183251},
+    {{0.542415977, -0.557451189, 0.454724491, -1.36909819, 0.820103347},
+     0, 0.0124183251},
+    {{0.541584969, -0.603393793, 0.457169086, -1.42682636, 0.828480542},
+     0, 0.0124183251},
+    {{0.541206837, -0.646429718, 0.460099727, -1.47962761, 0.836756408},
+     0, 0.0124183251},
+    {{0.541246772, -0.686735749, 0.463461131, -1.52787304, 0.844894052},
+     0, 0.0124183251},
+    {{0.541673422, -0.724487484, 0.467203915, -1.57191491, 0.852863371},
+     0, 0.0124183251},
+    {{0.348538399, -0.127386004, 0.282937258, -0.887510598, 0.770245552},
+     1, 0.0246817619},
+    {{0.608451843, -0.30423972, 0.495855242, -0.99176538, 0.778546512},
+     0, 0.0246817619},
+    {{0.60627234, -0.380828559, 0.496501476, -1.08775795, 0.787277758},
+     0, 0.0246817619},
+    {{0.613113821, -0.459533721, 0.504999042, -1.17593932, 0.796314001},
+     0, 0.0246817619},
+    {{0.613687038, -0.530144751, 0.508750677, -1.25677276, 0.805547476},
+     0, 0.0246817619},
+    {{0.609758139, -0.592136979, 0.509070694, -1.33072472, 0.814886153},
+     0, 0.0246817619},
+    {{0.604433417, -0.647457123, 0.508429706, -1.39825702, 0.82425195},
+     0, 0.0246817619},
+    {{0.599357665, -0.697750866, 0.508135617, -1.45982182, 0.833578944},
+     0, 0.0246817619},
+    {{0.595194817, -0.744106591, 0.508706808, -1.51585674, 0.842812121},
+     0, 0.0246817619},
+    {{0.592157602, -0.787247479, 0.510297656, -1.56678247, 0.851905942},
+     0, 0.0246817619},
+    {{0.38234508, -0.140996009, 0.310405761, -0.890096724, 0.770437419},
+     1, 0.0487490855},
+    {{0.654482543, -0.342551649, 0.533797026, -1.00950694, 0.78007853},
+     0, 0.0487490855},
+    {{0.65487361, -0.439183474, 0.537315607, -1.11892521, 0.790355086},
+     0, 0.0487490855},
+    {{0.660845578, -0.535182357, 0.546102762, -1.2188499, 0.801095784},
+     0, 0.0487490855},
+    {{0.657962441, -0.618830681, 0.548156142, -1.30981219, 0.812152922},
+     0, 0.0487490855},
+    {{0.651504457, -0.692134082, 0.54764092, -1.39236176, 0.823399842},
+     0, 0.0487490855},
+    {{0.645337462, -0.758396566, 0.547660053, -1.46705365, 0.834728658},
+     0, 0.0487490855},
+    {{0.640968502, -0.81979847, 0.549421847, -1.53444004, 0.846048057},
+     0, 0.0487490855},
+    {{0.638862073, -0.877724946, 0.553294063, -1.59506226, 0.857281446},
+     0, 0.0487490855},
+    {{0.40238741, -0.202332258, 0.327954918, -0.99390173, 0.778729081},
+     1, 0.0950818062},
+    {{0.698495209, -0.483169854, 0.573672295, -1.13427699, 0.791916847},
+     0, 0.0950818062},
+    {{0.711596072, -0.619113088, 0.590141475, -1.26107228, 0.806066096},
+     0, 0.0950818062},
+    {{0.716168761, -0.742181718, 0.600779891, -1.37489057, 0.820914447},
+     0, 0.0950818062},
+    {{0.713682294, -0.848928332, 0.606451988, -1.47641575, 0.836234927},
+     0, 0.0950818062},
+    {{0.71315223, -0.947661221, 0.614524305, -1.56638563, 0.851832271},
+     0, 0.0950818062},
+    {{0.448208153, -0.218847185, 0.365122974, -0.98280406, 0.777786255},
+     1, 0.180835441},
+    {{0.793079495, -0.601997972, 0.653557062, -1.18277538, 0.797058225},
+     0, 0.180835441},
+    {{0.817126393, -0.82751441, 0.684253156, -1.358971, 0.818700373},
+     0, 0.180835441},
+};
+
+static const CarlFrontendChannelData kChannelData15625HzBlock64[56] = {
+    {{0.259411722, 0.492892861, 0.247057229, 1.80719543, 0.908139229},
+     0, 0.0124183251},
+    {{0.746973753, 1.35703671, 0.695196033, 1.65519977, 0.869601488},
+     0, 0.0124183251},
+    {{0.743633449, 1.2768836, 0.677471161, 1.48230553, 0.837193072},
+     0, 0.0124183251},
+    {{0.724160492, 1.16167462, 0.646916747, 1.29668808, 0.810475588},
+     0, 0.0124183251},
+    {{0.704099655, 1.04238832, 0.617864847, 1.10462379, 0.788927674},
+     0, 0.0124183251},
+    {{0.6855582, 0.924198866, 0.592002392, 0.910855889, 0.772003114},
+     0, 0.0124183251},
+    {{0.668713748, 0.808455467, 0.569271147, 0.71891284, 0.759165764},
+     0, 0.0124183251},
+    {{0.653348386, 0.695659518, 0.549295068, 0.531374037, 0.74990809},
+     0, 0.0124183251},
+    {{0.639249027, 0.586187303, 0.531730473, 0.350082129, 0.743761301},
+     0, 0.0124183251},
+    {{0.626297355, 0.480414808, 0.516335428, 0.176310897, 0.74029839},
+     0, 0.0124183251},
+    {{0.614438474, 0.3786681, 0.502936006, 0.0108963503, 0.739134908},
+     0, 0.0124183251},
+    {{0.603641391, 0.281184465, 0.491390169, -0.145661384, 0.739927113},
+     0, 0.0124183251},
+    {{0.593877792, 0.188108027, 0.481568009, -0.293119013, 0.742369473},
+     0, 0.0124183251},
+    {{0.585114181, 0.0995026529, 0.473344803, -0.431428581, 0.746191561},
+     0, 0.0124183251},
+    {{0.577311218, 0.0153684067, 0.466599762, -0.56068939, 0.751154959},
+     0, 0.0124183251},
+    {{0.570424378, -0.064343527, 0.461215496, -0.681110561, 0.757050276},
+     0, 0.0124183251},
+    {{0.564406097, -0.139718905, 0.45707947, -0.792981684, 0.763694167},
+     0, 0.0124183251},
+    {{0.559206188, -0.2108711, 0.454083592, -0.896649182, 0.770926774},
+     0, 0.0124183251},
+    {{0.554774523, -0.277934194, 0.452125788, -0.992498636, 0.778609097},
+     0, 0.0124183251},
+    {{0.551060319, -0.341057181, 0.451108992, -1.08093977, 0.786620915},
+     0, 0.0124183251},
+    {{0.548014283, -0.400400221, 0.450942427, -1.16239536, 0.794858634},
+     0, 0.0124183251},
+    {{0.545588613, -0.456131309, 0.451541364, -1.23729241, 0.803233445},
+     0, 0.0124183251},
+    {{0.543736577, -0.508422494, 0.452825963, -1.30605471, 0.811669767},
+     0, 0.0124183251},
+    {{0.542415977, -0.557451189, 0.454724491, -1.36909819, 0.820103347},
+     0, 0.0124183251},
+    {{0.541584969, -0.603393793, 0.457169086, -1.42682636, 0.828480542},
+     0, 0.0124183251},
+    {{0.541206837, -0.646429718, 0.460099727, -1.47962761, 0.836756408},
+     0, 0.0124183251},
+    {{0.541246772, -0.686735749, 0.463461131, -1.52787304, 0.844894052},
+     0, 0.0124183251},
+    {{0.541673422, -0.724487484, 0.467203915, -1.57191491, 0.852863371},
+     0, 0.0124183251},
+    {{0.348538399, -0.127386004, 0.282937258, -0.887510598, 0.770245552},
+     1, 0.0246817619},
+    {{0.608451843, -0.30423972, 0.495855242, -0.99176538, 0.778546512},
+     0, 0.0246817619},
+    {{0.60627234, -0.380828559, 0.496501476, -1.08775795, 0.787277758},
+     0, 0.0246817619},
+    {{0.613113821, -0.459533721, 0.504999042, -1.17593932, 0.796314001},
+     0, 0.0246817619},
+    {{0.613687038, -0.530144751, 0.508750677, -1.25677276, 0.805547476},
+     0, 0.0246817619},
+    {{0.609758139, -0.592136979, 0.509070694, -1.33072472, 0.814886153},
+     0, 0.0246817619},
+    {{0.604433417, -0.647457123, 0.508429706, -1.39825702, 0.82425195},
+     0, 0.0246817619},
+    {{0.599357665, -0.697750866, 0.508135617, -1.45982182, 0.833578944},
+     0, 0.0246817619},
+    {{0.595194817, -0.744106591, 0.508706808, -1.51585674, 0.842812121},
+     0, 0.0246817619},
+    {{0.592157602, -0.787247479, 0.510297656, -1.56678247, 0.851905942},
+     0, 0.0246817619},
+    {{0.38234508, -0.140996009, 0.310405761, -0.890096724, 0.770437419},
+     1, 0.0487490855},
+    {{0.654482543, -0.342551649, 0.533797026, -1.00950694, 0.78007853},
+     0, 0.0487490855},
+    {{0.65487361, -0.439183474, 0.537315607, -1.11892521, 0.790355086},
+     0, 0.0487490855},
+    {{0.660845578, -0.535182357, 0.546102762, -1.2188499, 0.801095784},
+     0, 0.0487490855},
+    {{0.657962441, -0.618830681, 0.548156142, -1.30981219, 0.812152922},
+     0, 0.0487490855},
+    {{0.651504457, -0.692134082, 0.54764092, -1.39236176, 0.823399842},
+     0, 0.0487490855},
+    {{0.645337462, -0.758396566, 0.547660053, -1.46705365, 0.834728658},
+     0, 0.0487490855},
+    {{0.640968502, -0.81979847, 0.549421847, -1.53444004, 0.846048057},
+     0, 0.0487490855},
+    {{0.638862073, -0.877724946, 0.553294063, -1.59506226, 0.857281446},
+     0, 0.0487490855},
+    {{0.40238741, -0.202332258, 0.327954918, -0.99390173, 0.778729081},
+     1, 0.0950818062},
+    {{0.698495209, -0.483169854, 0.573672295, -1.13427699, 0.791916847},
+     0, 0.0950818062},
+    {{0.711596072, -0.619113088, 0.590141475, -1.26107228, 0.806066096},
+     0, 0.0950818062},
+    {{0.716168761, -0.742181718, 0.600779891, -1.37489057, 0.820914447},
+     0, 0.0950818062},
+    {{0.713682294, -0.848928332, 0.606451988, -1.47641575, 0.836234927},
+     0, 0.0950818062},
+    {{0.71315223, -0.947661221, 0.614524305, -1.56638563, 0.851832271},
+     0, 0.0950818062},
+    {{0.448208153, -0.218847185, 0.365122974, -0.98280406, 0.777786255},
+     1, 0.180835441},
+    {{0.793079495, -0.601997972, 0.653557062, -1.18277538, 0.797058225},
+     0, 0.180835441},
+    {{0.817126393, -0.82751441, 0.684253156, -1.358971, 0.818700373},
+     0, 0.180835441},
+};
+
+static const CarlFrontendChannelData kChannelData16000HzBlock32[56] = {
+    {{0.258586615, 0.482976735, 0.243885279, 1.74745095, 0.891427338},
+     0, 0.0121290479},
+    {{0.707529485, 1.25753319, 0.652570963, 1.58581281, 0.855495989},
+     0, 0.0121290479},
+    {{0.721015513, 1.20553982, 0.651438773, 1.40694261, 0.825519919},
+     0, 0.0121290479},
+    {{0.708719134, 1.10167658, 0.628355205, 1.21817029, 0.80101794},
+     0, 0.0121290479},
+    {{0.692337275, 0.988015175, 0.603418231, 1.02508569, 0.781453729},
+     0, 0.0121290479},
+    {{0.676007032, 0.87330389, 0.580226302, 0.83188659, 0.766282856},
+     0, 0.0121290479},
+    {{0.660616457, 0.7601071, 0.559398472, 0.641674757, 0.754980206},
+     0, 0.0121290479},
+    {{0.646277905, 0.649459958, 0.540875077, 0.456698209, 0.747054219},
+     0, 0.0121290479},
+    {{0.632968783, 0.542004168, 0.524493277, 0.278543919, 0.742053866},
+     0, 0.0121290479},
+    {{0.620675623, 0.438227445, 0.510110557, 0.108289085, 0.739570498},
+     0, 0.0121290479},
+    {{0.609396636, 0.338487238, 0.497604907, -0.0533809103, 0.739237309},
+     0, 0.0121290479},
+    {{0.599125087, 0.243017718, 0.486860037, -0.206080973, 0.740727186},
+     0, 0.0121290479},
+    {{0.589844704, 0.15194948, 0.477760792, -0.349655122, 0.743749917},
+     0, 0.0121290479},
+    {{0.581527591, 0.0653311908, 0.470191389, -0.484121144, 0.748049021},
+     0, 0.0121290479},
+    {{0.574137628, -0.0168505255, 0.464037061, -0.609627247, 0.753398836},
+     0, 0.0121290479},
+    {{0.567632556, -0.0946555063, 0.459185749, -0.726418436, 0.759601295},
+     0, 0.0121290479},
+    {{0.561965883, -0.168178126, 0.455528677, -0.834809422, 0.766483366},
+     0, 0.0121290479},
+    {{0.557089269, -0.237538382, 0.452961892, -0.935164034, 0.77389425},
+     0, 0.0121290479},
+    {{0.552953064, -0.302875042, 0.451386154, -1.02787852, 0.781703234},
+     0, 0.0121290479},
+    {{0.549508214, -0.364340723, 0.450707972, -1.11336827, 0.789797306},
+     0, 0.0121290479},
+    {{0.546706498, -0.422097832, 0.45083949, -1.19205797, 0.798079312},
+     0, 0.0121290479},
+    {{0.544500947, -0.476315349, 0.451698512, -1.26437306, 0.806466222},
+     0, 0.0121290479},
+    {{0.542847097, -0.527166843, 0.453208894, -1.33073378, 0.814887345},
+     0, 0.0121290479},
+    {{0.541702807, -0.574828506, 0.45530045, -1.39155066, 0.823283195},
+     0, 0.0121290479},
+    {{0.541028798, -0.619477451, 0.457908988, -1.44722033, 0.831603706},
+     0, 0.0121290479},
+    {{0.540788829, -0.661291003, 0.460976213, -1.49812365, 0.83980751},
+     0, 0.0121290479},
+    {{0.540949881, -0.700445294, 0.464449584, -1.54462326, 0.847860634},
+     0, 0.0121290479},
+    {{0.541481435, -0.737113655, 0.468281657, -1.58706272, 0.85573566},
+     0, 0.0121290479},
+    {{0.345224082, -0.143273145, 0.280607492, -0.926320791, 0.773198962},
+     1, 0.0241103545},
+    {{0.606263041, -0.331503749, 0.494886845, -1.02716947, 0.781639814},
+     0, 0.0241103545},
+    {{0.603672743, -0.4056997, 0.495338261, -1.11995673, 0.790459037},
+     0, 0.0241103545},
+    {{0.610278189, -0.482408166, 0.503768563, -1.20513761, 0.79953897},
+     0, 0.0241103545},
+    {{0.611034393, -0.551072776, 0.507761657, -1.28317606, 0.808778584},
+     0, 0.0241103545},
+    {{0.607465327, -0.611203969, 0.508438587, -1.35453522, 0.818091869},
+     0, 0.0241103545},
+    {{0.60253334, -0.664797962, 0.508159518, -1.41967201, 0.82740587},
+     0, 0.0241103545},
+    {{0.597823501, -0.713507831, 0.508188665, -1.47903132, 0.836659431},
+     0, 0.0241103545},
+    {{0.593981922, -0.758413076, 0.509032965, -1.53304267, 0.845801532},
+     0, 0.0241103545},
+    {{0.591220915, -0.800225914, 0.510848641, -1.58211732, 0.854790151},
+     0, 0.0241103545},
+    {{0.378138244, -0.158149168, 0.307388484, -0.928823411, 0.773394883},
+     1, 0.0476345085},
+    {{0.65176028, -0.371283859, 0.532485068, -1.04432344, 0.783191144},
+     0, 0.0476345085},
+    {{0.651633978, -0.464965671, 0.535750449, -1.15006936, 0.793555975},
+     0, 0.0476345085},
+    {{0.657558978, -0.558444142, 0.544638753, -1.24656963, 0.804328203},
+     0, 0.0476345085},
+    {{0.655112326, -0.639675081, 0.547141969, -1.33435929, 0.81536895},
+     0, 0.0476345085},
+    {{0.64921385, -0.710747182, 0.54714185, -1.4139868, 0.826559484},
+     0, 0.0476345085},
+    {{0.643579125, -0.774996161, 0.547628582, -1.48600292, 0.837798774},
+     0, 0.0476345085},
+    {{0.639670849, -0.834584773, 0.549779654, -1.55095172, 0.849001646},
+     0, 0.0476345085},
+    {{0.637950361, -0.890875041, 0.553963661, -1.60936511, 0.860096991},
+     0, 0.0476345085},
+    {{0.398492366, -0.218989462, 0.325318664, -1.02923524, 0.781824768},
+     1, 0.092962727},
+    {{0.695992589, -0.510942459, 0.572809875, -1.16489935, 0.795125782},
+     0, 0.092962727},
+    {{0.708552182, -0.643273115, 0.589026153, -1.28732562, 0.809296548},
+     0, 0.092962727},
+    {{0.713555336, -0.763150454, 0.60013926, -1.39713728, 0.824089587},
+     0, 0.092962727},
+    {{0.711811602, -0.867030799, 0.606482267, -1.49502766, 0.839290977},
+     0, 0.092962727},
+    {{0.711977661, -0.963244259, 0.615147948, -1.58173501, 0.854717374},
+     0, 0.092962727},
+    {{0.444232285, -0.237796769, 0.362470448, -1.01850402, 0.780869305},
+     1, 0.177014187},
+    {{0.789978564, -0.631815255, 0.652444243, -1.21173894, 0.800284982},
+     0, 0.177014187},
+    {{0.814385653, -0.852318823, 0.68371135, -1.38178265, 0.82188791},
+     0, 0.177014187},
+};
+
+static const CarlFrontendChannelData kChannelData16000HzBlock64[56] = {
+    {{0.258586615, 0.482976735, 0.243885279, 1.74745095, 0.891427338},
+     0, 0.0121290479},
+    {{0.707529485, 1.25753319, 0.652570963, 1.58581281, 0.855495989},
+     0, 0.0121290479},
+    {{0.721015513, 1.20553982, 0.651438773, 1.40694261, 0.825519919},
+     0, 0.0121290479},
+    {{0.708719134, 1.10167658, 0.628355205, 1.21817029, 0.80101794},
+     0, 0.0121290479},
+    {{0.692337275, 0.988015175, 0.603418231, 1.02508569, 0.781453729},
+     0, 0.0121290479},
+    {{0.676007032, 0.87330389, 0.580226302, 0.83188659, 0.766282856},
+     0, 0.0121290479},
+    {{0.660616457, 0.7601071, 0.559398472, 0.641674757, 0.754980206},
+     0, 0.0121290479},
+    {{0.646277905, 0.649459958, 0.540875077, 0.456698209, 0.747054219},
+     0, 0.0121290479},
+    {{0.632968783, 0.542004168, 0.524493277, 0.278543919, 0.742053866},
+     0, 0.0121290479},
+    {{0.620675623, 0.438227445, 0.510110557, 0.108289085, 0.739570498},
+     0, 0.0121290479},
+    {{0.609396636, 0.338487238, 0.497604907, -0.0533809103, 0.739237309},
+     0, 0.0121290479},
+    {{0.599125087, 0.243017718, 0.486860037, -0.206080973, 0.740727186},
+     0, 0.0121290479},
+    {{0.589844704, 0.15194948, 0.477760792, -0.349655122, 0.743749917},
+     0, 0.0121290479},
+    {{0.581527591, 0.0653311908, 0.470191389, -0.484121144, 0.748049021},
+     0, 0.0121290479},
+    {{0.574137628, -0.0168505255, 0.464037061, -0.609627247, 0.753398836},
+     0, 0.0121290479},
+    {{0.567632556, -0.0946555063, 0.459185749, -0.726418436, 0.759601295},
+     0, 0.0121290479},
+    {{0.561965883, -0.168178126, 0.455528677, -0.834809422, 0.766483366},
+     0, 0.0121290479},
+    {{0.557089269, -0.237538382, 0.452961892, -0.935164034, 0.77389425},
+     0, 0.0121290479},
+    {{0.552953064, -0.302875042, 0.451386154, -1.02787852, 0.781703234},
+     0, 0.0121290479},
+    {{0.549508214, -0.364340723, 0.450707972, -1.11336827, 0.789797306},
+     0, 0.0121290479},
+    {{0.546706498, -0.422097832, 0.45083949, -1.19205797, 0.798079312},
+     0, 0.0121290479},
+    {{0.544500947, -0.476315349, 0.451698512, -1.26437306, 0.806466222},
+     0, 0.0121290479},
+    {{0.542847097, -0.527166843, 0.453208894, -1.33073378, 0.814887345},
+     0, 0.0121290479},
+    {{0.541702807, -0.574828506, 0.45530045, -1.39155066, 0.823283195},
+     0, 0.0121290479},
+    {{0.541028798, -0.619477451, 0.457908988, -1.44722033, 0.831603706},
+     0, 0.0121290479},
+    {{0.540788829, -0.661291003, 0.460976213, -1.49812365, 0.83980751},
+     0, 0.0121290479},
+    {{0.540949881, -0.700445294, 0.464449584, -1.54462326, 0.847860634},
+     0, 0.0121290479},
+    {{0.541481435, -0.737113655, 0.468281657, -1.58706272, 0.85573566},
+     0, 0.0121290479},
+    {{0.345224082, -0.143273145, 0.280607492, -0.926320791, 0.773198962},
+     1, 0.0241103545},
+    {{0.606263041, -0.331503749, 0.494886845, -1.02716947, 0.781639814},
+     0, 0.0241103545},
+    {{0.603672743, -0.4056997, 0.495338261, -1.11995673, 0.790459037},
+     0, 0.0241103545},
+    {{0.610278189, -0.482408166, 0.503768563, -1.20513761, 0.79953897},
+     0, 0.0241103545},
+    {{0.611034393, -0.551072776, 0.507761657, -1.28317606, 0.808778584},
+     0, 0.0241103545},
+    {{0.607465327, -0.611203969, 0.508438587, -1.35453522, 0.818091869},
+     0, 0.0241103545},
+    {{0.60253334, -0.664797962, 0.508159518, -1.41967201, 0.82740587},
+     0, 0.0241103545},
+    {{0.597823501, -0.713507831, 0.508188665, -1.47903132, 0.836659431},
+     0, 0.0241103545},
+    {{0.593981922, -0.758413076, 0.509032965, -1.53304267, 0.845801532},
+     0, 0.0241103545},
+    {{0.591220915, -0.800225914, 0.510848641, -1.58211732, 0.854790151},
+     0, 0.0241103545},
+    {{0.378138244, -0.158149168, 0.307388484, -0.928823411, 0.773394883},
+     1, 0.0476345085},
+    {{0.65176028, -0.371283859, 0.532485068, -1.04432344, 0.783191144},
+     0, 0.0476345085},
+    {{0.651633978, -0.464965671, 0.535750449, -1.15006936, 0.793555975},
+     0, 0.0476345085},
+    {{0.657558978, -0.558444142, 0.544638753, -1.24656963, 0.804328203},
+     0, 0.0476345085},
+    {{0.655112326, -0.639675081, 0.547141969, -1.33435929, 0.81536895},
+     0, 0.0476345085},
+    {{0.64921385, -0.710747182, 0.54714185, -1.4139868, 0.826559484},
+     0, 0.0476345085},
+    {{0.643579125, -0.774996161, 0.547628582, -1.48600292, 0.837798774},
+     0, 0.0476345085},
+    {{0.639670849, -0.834584773, 0.549779654, -1.55095172, 0.849001646},
+     0, 0.0476345085},
+    {{0.637950361, -0.890875041, 0.553963661, -1.60936511, 0.860096991},
+     0, 0.0476345085},
+    {{0.398492366, -0.218989462, 0.325318664, -1.02923524, 0.781824768},
+     1, 0.092962727},
+    {{0.695992589, -0.510942459, 0.572809875, -1.16489935, 0.795125782},
+     0, 0.092962727},
+    {{0.708552182, -0.643273115, 0.589026153, -1.28732562, 0.809296548},
+     0, 0.092962727},
+    {{0.713555336, -0.763150454, 0.60013926, -1.39713728, 0.824089587},
+     0, 0.092962727},
+    {{0.711811602, -0.867030799, 0.606482267, -1.49502766, 0.839290977},
+     0, 0.092962727},
+    {{0.711977661, -0.963244259, 0.615147948, -1.58173501, 0.854717374},
+     0, 0.092962727},
+    {{0.444232285, -0.237796769, 0.362470448, -1.01850402, 0.780869305},
+     1, 0.177014187},
+    {{0.789978564, -0.631815255, 0.652444243, -1.21173894, 0.800284982},
+     0, 0.177014187},
+    {{0.814385653, -0.852318823, 0.68371135, -1.38178265, 0.82188791},
+     0, 0.177014187},
+};
+
+const CarlFrontendPrecomputedDesign kCarlFrontendPrecomputedDesigns[] = {
+    {15625.0f, 32, 56, kChannelData15625HzBlock32},
+    {15625.0f, 64, 56, kChannelData15625HzBlock64},
+    {16000.0f, 32, 56, kChannelData16000HzBlock32},
+    {16000.0f, 64, 56, kChannelData16000HzBlock64},
+};
+
+const int kCarlFrontendNumPrecomputedDesigns = 4;
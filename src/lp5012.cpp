@@ -14,11 +14,24 @@
 
 #include "lp5012.h"  // NOLINT(build/include)
 
+#include <string.h>
+
 #include "two_wire.h"  // NOLINT(build/include)
 
 namespace audio_tactile {
-
-Lp5012::Lp5012() {}
+namespace {
+// Runs of changed registers separated by at most this many unchanged registers
+// are sent as one burst. Rewriting a few unchanged bytes is cheaper than the
+// address and register bytes, start and stop conditions, and completion
+// interrupt of another transaction.
+constexpr int kMaxMergedGap = 3;
+}  // namespace
+
+Lp5012::Lp5012()
+    : update_period_ms_(0), last_update_ms_(0), num_transactions_(0) {
+  memset(brightness_, 0, sizeof(brightness_));
+  memset(shadow_, 0, sizeof(shadow_));
+}
 
 void Lp5012::Initialize() {
   // Initialize the I2C bus.
@@ -43,27 +56,83 @@ void Lp5012::Initialize() {
   // Wait while chip goes online. This delay is a guess as datasheet doesn't
   // provide information.
   nrfx_coredep_delay_us(5000);  // 5 ms wait time.
+
+  // The reset cleared the brightness registers.
+  memset(shadow_, 0, sizeof(shadow_));
+  num_transactions_ = 0;
+  Flush();
 }
 
 void Lp5012::TurnOnAllLeds(uint8_t brightness) {
-  for (int i = 0; i < kNumLeds; ++i) {
-    SetOneLed(i, brightness);
-  }
+  memset(brightness_, brightness, sizeof(brightness_));
+  OnChange();
 }
 
 void Lp5012::SetOneLed(uint8_t led, uint8_t brightness) {
-  i2c_write(LP5012_OUT0_COLOR + led, brightness);
+  if (led >= kNumLeds) { return; }
+  brightness_[led] = brightness;
+  OnChange();
+}
+
+void Lp5012::SetAllLeds(const uint8_t* brightness) {
+  memcpy(brightness_, brightness, sizeof(brightness_));
+  OnChange();
+}
+
+void Lp5012::SetUpdatePeriod(uint32_t period_ms) {
+  update_period_ms_ = period_ms;
+  if (period_ms == 0) { Flush(); }
+}
+
+void Lp5012::Tick(uint32_t now_ms) {
+  if (update_period_ms_ == 0 || now_ms - last_update_ms_ < update_period_ms_) {
+    return;
+  }
+  last_update_ms_ = now_ms;
+  Flush();
+}
+
+void Lp5012::OnChange() {
+  if (update_period_ms_ == 0) { Flush(); }
+}
+
+void Lp5012::Flush() {
+  int i = 0;
+  while (i < kNumLeds) {
+    // Find the next changed register.
+    if (brightness_[i] == shadow_[i]) {
+      ++i;
+      continue;
+    }
+    // Extend the run through changed registers and short unchanged gaps.
+    const int start = i;
+    int end = i + 1;  // One past the last changed register in the run.
+    for (int j = end; j < kNumLeds && j - end <= kMaxMergedGap; ++j) {
+      if (brightness_[j] != shadow_[j]) { end = j + 1; }
+    }
+    // Update the shadow first and send from it, so that a value changed
+    // concurrently, e.g. from an interrupt, is still dirty afterwards. The
+    // LP5012 auto increments the register address by default (DEVICE_CONFIG1
+    // Auto_incr_EN), so the run goes in one transfer.
+    memcpy(shadow_ + start, brightness_ + start, end - start);
+    i2c_write_registers_async(kLp5012Address, LP5012_OUT0_COLOR + start,
+                              shadow_ + start, end - start, nullptr, nullptr);
+    ++num_transactions_;
+    i = end;
+  }
 }
 
 void Lp5012::CycleAllLeds(int cycles) {
   for (int g = 0; g < cycles; ++g) {
     for (int i = 0; i < 256; ++i) {
       TurnOnAllLeds(i);
+      Flush();
       nrfx_coredep_delay_us(2000);
     }
 
     for (int i = 255; i >= 0; --i) {
       TurnOnAllLeds(i);
+      Flush();
       nrfx_coredep_delay_us(2000);
     }
   }
@@ -74,11 +143,13 @@ void Lp5012::CycleLedsOneByOne(int cycles) {
     for (int h = 0; h < kNumLeds; ++h) {
       for (int i = 0; i < 256; ++i) {
         SetOneLed(h, i);
+        Flush();
         nrfx_coredep_delay_us(300);
       }
 
       for (int i = 255; i >= 0; --i) {
         SetOneLed(h, i);
+        Flush();
         nrfx_coredep_delay_us(300);
       }
     }
@@ -89,15 +160,15 @@ void Lp5012::LedBar(int value, int brightness) {
   const int kNumLedsInBar = 10;
   for (int i = 0; i < kNumLedsInBar; ++i) {
     if ((uint8_t)value >= 25 * i) {
-      LedArray.SetOneLed(i, (uint8_t)brightness);
+      brightness_[i] = (uint8_t)brightness;
     }
   }
+  OnChange();
 }
 
 void Lp5012::Clear() {
-  for (int i = 0; i < kNumLeds; ++i) {
-    SetOneLed(i, 0);
-  }
+  memset(brightness_, 0, sizeof(brightness_));
+  OnChange();
 }
 
 void Lp5012::Disable() { nrf_gpio_pin_write(kLp5012EnablePin, 0); }
@@ -15,6 +15,29 @@
 //
 // Library for the Lp5012 12-channels I2C LED driver from Texas Instruments.
 //
+// LED updates are sent asynchronously with the two_wire.h transaction queue,
+// so they don't stall the caller. A shadow copy of the brightness registers
+// tracks what the chip holds, so that only changed registers are written:
+// each run of changed registers is sent as one auto-increment burst, with
+// runs separated by a few unchanged registers merged into one burst, and
+// nothing is sent if no value changed.
+//
+// By default, each call sends its changes immediately. For animations like
+// volume meters, which may update LEDs at audio block rate, use
+// SetUpdatePeriod() to instead accumulate changes and send them at most once
+// per period from Tick(), called from the main loop. Intermediate values are
+// then never sent, so I2C bus time and CPU wakeups for transaction interrupts
+// are bounded by the update rate rather than the UI rate.
+//
+// Example use:
+//   LedArray.Initialize();
+//   LedArray.SetUpdatePeriod(40);  // Update at 25 Hz.
+//   ...
+//   // In the main loop.
+//   LedArray.Clear();
+//   LedArray.LedBar(volume, 20);
+//   LedArray.Tick(millis());
+//
 // The datasheet is provided here: https://www.ti.com/product/LP5012
 
 #ifndef AUDIO_TO_TACTILE_SRC_LP5012_H_
@@ -75,6 +98,10 @@ class Lp5012 {
   // Leds are numbered 0 to 11.
   void SetOneLed(uint8_t which_led, uint8_t brightness);
 
+  // Set the brightness of all leds from an array of kNumLeds values, in one
+  // I2C transfer.
+  void SetAllLeds(const uint8_t* brightness);
+
   // Set one brightness for all leds.
   void TurnOnAllLeds(uint8_t brightness);
 
@@ -97,6 +124,34 @@ class Lp5012 {
 
   // Clear all leds by setting them to 0.
   void Clear();
+
+  // Sets the animation mode update period. With `period_ms` > 0, changes are
+  // accumulated and sent from Tick(). With 0, the default, changes are sent
+  // immediately.
+  void SetUpdatePeriod(uint32_t period_ms);
+
+  // In animation mode, sends accumulated changes if at least the update period
+  // has passed since the last update. `now_ms` is the current time, e.g.
+  // millis(). Does nothing in immediate mode.
+  void Tick(uint32_t now_ms);
+
+  // Sends any changed registers now.
+  void Flush();
+
+  // Number of I2C transactions sent for LED updates since Initialize().
+  int num_transactions() const { return num_transactions_; }
+
+ private:
+  // Sends changes now in immediate mode.
+  void OnChange();
+
+  // Brightness of each led, as last set.
+  uint8_t brightness_[kNumLeds];
+  // Brightness registers as last sent to the chip.
+  uint8_t shadow_[kNumLeds];
+  uint32_t update_period_ms_;
+  uint32_t last_update_ms_;
+  int num_transactions_;
 };
 
 extern Lp5012 LedArray;
@@ -34,19 +34,13 @@ void Max14661::Enable() { nrf_gpio_pin_write(kMuxEnable, 1); }
 void Max14661::Disable() { nrf_gpio_pin_write(kMuxEnable, 0); }
 
 void Max14661::DisconnectAllSwitches() {
-  // Sets registers to zero for mux 1.
-  NRF_TWIM0->ADDRESS = kMax14661Address1;
-  i2c_write(DIR0, 0x00);
-  i2c_write(DIR1, 0x00);
-  i2c_write(DIR2, 0x00);
-  i2c_write(DIR3, 0x00);
-
-  // Sets registers to zero for mux 2.
-  NRF_TWIM0->ADDRESS = kMax14661Address2;
-  i2c_write(DIR0, 0x00);
-  i2c_write(DIR1, 0x00);
-  i2c_write(DIR2, 0x00);
-  i2c_write(DIR3, 0x00);
+  // Sets DIR0-DIR3 registers to zero for both muxes. The registers are written
+  // with one auto-increment transfer per mux.
+  static const uint8_t kZeros[4] = {0x00, 0x00, 0x00, 0x00};
+  i2c_write_registers_async(kMax14661Address1, DIR0, kZeros, 4, nullptr,
+                            nullptr);
+  i2c_write_registers_async(kMax14661Address2, DIR0, kZeros, 4, nullptr,
+                            nullptr);
 }
 
 void Max14661::ConnectChannel(int channel) {
@@ -137,15 +131,21 @@ void Max14661::ConnectChannel(int channel) {
     return;
   }
 
-  // Disconnect all previous switches.
-  DisconnectAllSwitches();
-
+  // Write all four DIR registers of each mux, which both disconnects the
+  // previous switches and connects the new ones. This takes two transfers
+  // rather than ten single-register writes.
   const auto& settings = kChannelSettings[channel];
-  NRF_TWIM0->ADDRESS = settings.i2c_address;
-  i2c_write(settings.connections[0].register_address,
-            settings.connections[0].value);
-  i2c_write(settings.connections[1].register_address,
-            settings.connections[1].value);
+  uint8_t dir[4] = {0x00, 0x00, 0x00, 0x00};
+  dir[settings.connections[0].register_address - DIR0] =
+      settings.connections[0].value;
+  dir[settings.connections[1].register_address - DIR0] =
+      settings.connections[1].value;
+  static const uint8_t kZeros[4] = {0x00, 0x00, 0x00, 0x00};
+  const bool is_mux1 = (settings.i2c_address == kMax14661Address1);
+  i2c_write_registers_async(kMax14661Address1, DIR0, is_mux1 ? dir : kZeros, 4,
+                            nullptr, nullptr);
+  i2c_write_registers_async(kMax14661Address2, DIR0, is_mux1 ? kZeros : dir, 4,
+                            nullptr, nullptr);
 }
 
 Max14661 Multiplexer;
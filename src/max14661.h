@@ -21,6 +21,9 @@
 // for current sensing. The board has two 16:2 muxes, so for ease of
 // integration, the driver behaves as there is one 32:2 mux.
 //
+// Switch settings are sent asynchronously with the two_wire.h transaction
+// queue, so they don't stall the caller.
+//
 // The datasheet is provided here:
 // https://datasheets.maximintegrated.com/en/ds/MAX14661.pdf
 
@@ -19,79 +19,208 @@
 
 #include "dsp/logging.h"
 #include "dsp/math_constants.h"
+#include "dsp/phase32_simd.h"
+
+#if kMuxChannels % 4 != 0
+#error "kMuxChannels must be a multiple of 4."
+#endif
+
+/* Max number of output frames processed at a time, setting the size of the
+ * scratch buffers in DemuxerProcessGroup().
+ */
+#define kDemuxerChunkFrames 4
+#define kDemuxerChunkSamples (kDemuxerChunkFrames * kMuxMaxRateFactor)
 
 void DemuxerInit(Demuxer* demuxer) {
+  MuxLayout layout;
+  MuxLayoutSetDefault(&layout);
+  CHECK(DemuxerInitWithLayout(demuxer, &layout));
+}
+
+int DemuxerInitWithLayout(Demuxer* demuxer, const MuxLayout* layout) {
+  if (!MuxLayoutIsValid(layout)) { return 0; }
+  demuxer->layout = *layout;
   const float kShiftedPilotHz = kMuxPilotHzAtBaseband - kMuxMidpointHz;
   PilotTrackerCoeffsInit(&demuxer->pilot_tracker_coeffs, kShiftedPilotHz,
-                         kMuxMuxedRate);
+                         layout->muxed_rate_hz);
 
-  DemuxerDesignWeaverLpf(&demuxer->weaver_lpf_coeffs);
+  DemuxerDesignWeaverLpfForLayout(layout, &demuxer->weaver_lpf_coeffs);
   /* Absorb factor 2 needed for converting the final signal to real. */
   demuxer->weaver_lpf_coeffs.b0 *= 2;
   demuxer->weaver_lpf_coeffs.b1 *= 2;
   demuxer->weaver_lpf_coeffs.b2 *= 2;
 
   int c;
-  for (c = 0; c < kMuxChannels; ++c) {
-    DemuxerChannel* channel = &demuxer->channels[c];
-    OscillatorInit(&channel->down_converter,
-                   -(kMuxMidpointHz + MuxCarrierFrequency(c)) / kMuxMuxedRate);
-    PilotTrackerInit(&channel->pilot_tracker, &demuxer->pilot_tracker_coeffs);
-    BiquadFilterInitZero(&channel->weaver_lpf_state_real);
-    BiquadFilterInitZero(&channel->weaver_lpf_state_imag);
-    OscillatorInit(&channel->up_converter,
-                   kMuxPilotHzAtBaseband / kMuxTactileRate);
+  for (c = 0; c < layout->num_channels; ++c) {
+    Oscillator down_converter;
+    OscillatorInit(&down_converter,
+                   -(kMuxMidpointHz + MuxLayoutCarrierFrequency(layout, c)) /
+                   layout->muxed_rate_hz);
+    demuxer->down_converter_phase[c] = down_converter.phase;
+    demuxer->down_converter_frequency[c] = down_converter.frequency;
+    BiquadFilterInitZero(&demuxer->weaver_lpf_state_real[c]);
+    BiquadFilterInitZero(&demuxer->weaver_lpf_state_imag[c]);
+  }
+  int g;
+  for (g = 0; g < layout->num_channels / 4; ++g) {
+    PilotTracker4Init(&demuxer->pilot_trackers[g],
+                      &demuxer->pilot_tracker_coeffs);
   }
+  OscillatorInit(&demuxer->up_converter,
+                 kMuxPilotHzAtBaseband / MuxLayoutTactileRate(layout));
+  return 1;
 }
 
-void DemuxerProcessSamples(Demuxer* demuxer, const float* muxed_input,
-                           int num_samples, float* tactile_output) {
-  CHECK(num_samples % kMuxRateFactor == 0);
+/* PWM destination for DemuxerProcessSamplesToPwm(). */
+typedef struct {
+  Float4 gain;
+  Float4 scale;
+  Float4 offset;
+  uint16_t* const* channels;
+  int stride;
+  /* Index of the first frame of the current chunk. */
+  int frame;
+} DemuxerPwmOutput;
 
-  const int num_output_frames = num_samples / kMuxRateFactor;
+/* Converts frame `i` of channels 4 * g to 4 * g + 3 to PWM, as
+ * ConvertSampleFloatTo0_MaxValue(gain * sample, max_value).
+ */
+static void DemuxerWritePwm(const DemuxerPwmOutput* pwm, int g, int i,
+                            Float4 sample) {
+  const Float4 minus_one = Float4Broadcast(-1.0f);
+  const Float4 one = Float4Broadcast(1.0f);
+  sample = Float4Min(Float4Max(Float4Mul(pwm->gain, sample), minus_one), one);
+  int32_t values[4];
+  /* Values are nonnegative, so truncation is the same as the scalar cast. */
+  Int4Store(values, Float4ToInt4(
+      Float4Add(Float4Mul(pwm->scale, sample), pwm->offset)));
+  uint16_t* const* channels = pwm->channels + 4 * g;
+  const int index = (pwm->frame + i) * pwm->stride;
+  channels[0][index] = (uint16_t)values[0];
+  channels[1][index] = (uint16_t)values[1];
+  channels[2][index] = (uint16_t)values[2];
+  channels[3][index] = (uint16_t)values[3];
+}
 
-  int c;
-  for (c = 0; c < kMuxChannels; ++c) {
-    DemuxerChannel* channel = &demuxer->channels[c];
-    const float* input = muxed_input;
-    float* output = tactile_output + c;
-
-    int i;
-    for (i = 0; i < num_output_frames; ++i) {
-      int j;
-      for (j = 0; j < kMuxRateFactor; ++j) {
-        /* Shift band midpoint down to DC. */
-        ComplexFloat sample;
-        sample.real = Phase32Cos(channel->down_converter.phase) * input[j];
-        sample.imag = Phase32Sin(channel->down_converter.phase) * input[j];
-        OscillatorNext(&channel->down_converter);
-
-        /* Phase-locked loop to track the pilot's phase. */
-        Phase32 pilot_phase = PilotTrackerProcessOneSample(
-            &channel->pilot_tracker, &demuxer->pilot_tracker_coeffs, sample);
-
-        /* Lowpass filter to the band. */
-        sample.real = BiquadFilterProcessOneSample(
-            &demuxer->weaver_lpf_coeffs, &channel->weaver_lpf_state_real,
-            sample.real);
-        sample.imag = BiquadFilterProcessOneSample(
-            &demuxer->weaver_lpf_coeffs, &channel->weaver_lpf_state_imag,
-            sample.imag);
-
-        if (j == 0) {
-          /* Shift up to recover the baseband signal, at the same time adjusting
-           * phase for synchronization based on the pilot phase.
-           */
-          *output = sample.real *
-                        Phase32Cos(channel->up_converter.phase - pilot_phase) -
-                    sample.imag *
-                        Phase32Sin(channel->up_converter.phase - pilot_phase);
-          OscillatorNext(&channel->up_converter);
-        }
-      }
-
-      input += kMuxRateFactor;
-      output += kMuxChannels;
+/* Processes one group of four channels for `num_frames` output frames, where
+ * num_frames <= kDemuxerChunkFrames. Output is written to `tactile_output`, or
+ * if `pwm` is non-null, converted and written to PWM channels.
+ */
+static void DemuxerProcessGroup(Demuxer* demuxer, int g,
+                                const float* muxed_input, int num_frames,
+                                float* tactile_output,
+                                const DemuxerPwmOutput* pwm) {
+  /* Scratch buffers in structure-of-arrays layout, element [4 * n + i] being
+   * sample n for channel 4 * g + i.
+   */
+  float real[4 * kDemuxerChunkSamples];
+  float imag[4 * kDemuxerChunkSamples];
+  Phase32 pilot_phases[4 * kDemuxerChunkSamples];
+  const int num_channels = demuxer->layout.num_channels;
+  const int rate_factor = demuxer->layout.rate_factor;
+  const int num_samples = num_frames * rate_factor;
+  const int c = 4 * g;
+  int n;
+
+  /* Shift band midpoint down to DC. */
+  Int4 down_phase = Int4Load((const int32_t*)demuxer->down_converter_phase + c);
+  const Int4 down_frequency =
+      Int4Load((const int32_t*)demuxer->down_converter_frequency + c);
+  for (n = 0; n < num_samples; ++n) {
+    const Float4 x = Float4Broadcast(muxed_input[n]);
+    Float4Store(real + 4 * n, Float4Mul(Phase32Cos4(down_phase), x));
+    Float4Store(imag + 4 * n, Float4Mul(Phase32Sin4(down_phase), x));
+    down_phase = Int4Add(down_phase, down_frequency);
+  }
+  Int4Store((int32_t*)demuxer->down_converter_phase + c, down_phase);
+
+  /* Phase-locked loop to track the pilot's phase. */
+  PilotTracker4ProcessSamples(&demuxer->pilot_trackers[g],
+                              &demuxer->pilot_tracker_coeffs,
+                              real, imag, num_samples, pilot_phases);
+
+  /* Lowpass filter to the band. */
+  BiquadFilterProcessInterleavedBlock(
+      &demuxer->weaver_lpf_coeffs, demuxer->weaver_lpf_state_real + c, 4,
+      real, num_samples, real);
+  BiquadFilterProcessInterleavedBlock(
+      &demuxer->weaver_lpf_coeffs, demuxer->weaver_lpf_state_imag + c, 4,
+      imag, num_samples, imag);
+
+  /* Shift up to recover the baseband signal, at the same time adjusting phase
+   * for synchronization based on the pilot phase. Only the first of every
+   * rate_factor samples is needed, decimating to the tactile rate.
+   */
+  const Int4 up_frequency =
+      Int4Broadcast((int32_t)demuxer->up_converter.frequency);
+  Int4 up_phase = Int4Broadcast((int32_t)demuxer->up_converter.phase);
+  int i;
+  for (i = 0, n = 0; i < num_frames; ++i, n += rate_factor) {
+    const Int4 phase = Int4Sub(
+        up_phase, Int4Load((const int32_t*)pilot_phases + 4 * n));
+    const Float4 sample = Float4Sub(
+        Float4Mul(Float4Load(real + 4 * n), Phase32Cos4(phase)),
+        Float4Mul(Float4Load(imag + 4 * n), Phase32Sin4(phase)));
+    if (pwm) {
+      DemuxerWritePwm(pwm, g, i, sample);
+    } else {
+      Float4Store(tactile_output + num_channels * i + c, sample);
     }
+    up_phase = Int4Add(up_phase, up_frequency);
   }
 }
+
+/* Implementation of DemuxerProcessSamples() and, if `pwm` is non-null,
+ * DemuxerProcessSamplesToPwm().
+ */
+static void DemuxerProcessSamplesImpl(Demuxer* demuxer,
+                                      const float* muxed_input,
+                                      int num_samples, float* tactile_output,
+                                      DemuxerPwmOutput* pwm) {
+  const int num_channels = demuxer->layout.num_channels;
+  const int rate_factor = demuxer->layout.rate_factor;
+  CHECK(num_samples % rate_factor == 0);
+
+  int num_output_frames = num_samples / rate_factor;
+  while (num_output_frames > 0) {
+    const int num_frames = (num_output_frames < kDemuxerChunkFrames)
+        ? num_output_frames : kDemuxerChunkFrames;
+    int g;
+    for (g = 0; g < num_channels / 4; ++g) {
+      DemuxerProcessGroup(demuxer, g, muxed_input, num_frames, tactile_output,
+                          pwm);
+    }
+    demuxer->up_converter.phase +=
+        (Phase32)num_frames * demuxer->up_converter.frequency;
+
+    muxed_input += num_frames * rate_factor;
+    if (pwm) {
+      pwm->frame += num_frames;
+    } else {
+      tactile_output += num_frames * num_channels;
+    }
+    num_output_frames -= num_frames;
+  }
+}
+
+void DemuxerProcessSamples(Demuxer* demuxer, const float* muxed_input,
+                           int num_samples, float* tactile_output) {
+  DemuxerProcessSamplesImpl(demuxer, muxed_input, num_samples, tactile_output,
+                            NULL);
+}
+
+void DemuxerProcessSamplesToPwm(Demuxer* demuxer, const float* muxed_input,
+                                int num_samples, float gain,
+                                int pwm_max_value,
+                                uint16_t* const* pwm_channels,
+                                int pwm_stride) {
+  const float scale = 0.5f * pwm_max_value;
+  DemuxerPwmOutput pwm;
+  pwm.gain = Float4Broadcast(gain);
+  pwm.scale = Float4Broadcast(scale);
+  pwm.offset = Float4Broadcast(scale + 0.5f);
+  pwm.channels = pwm_channels;
+  pwm.stride = pwm_stride;
+  pwm.frame = 0;
+  DemuxerProcessSamplesImpl(demuxer, muxed_input, num_samples, NULL, &pwm);
+}
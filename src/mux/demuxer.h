@@ -16,6 +16,8 @@
 #ifndef AUDIO_TO_TACTILE_SRC_MUX_DEMUXER_H_
 #define AUDIO_TO_TACTILE_SRC_MUX_DEMUXER_H_
 
+#include <stdint.h>
+
 #include "dsp/biquad_filter.h"
 #include "dsp/complex.h"
 #include "dsp/phase32.h"
@@ -26,24 +28,42 @@
 extern "C" {
 #endif
 
-typedef struct {
-  Oscillator down_converter;
-  PilotTracker pilot_tracker;
-  BiquadFilterState weaver_lpf_state_real;
-  BiquadFilterState weaver_lpf_state_imag;
-  Oscillator up_converter;
-} DemuxerChannel;
+/* Channels are processed four at a time with Float4 (see dsp/simd.h). */
+#define kDemuxerMaxGroups (kMuxMaxChannels / 4)
 
+/* Demuxer state in structure-of-arrays layout, where index c of each
+ * per-channel array is the state for channel c. Arrays are sized for
+ * kMuxMaxChannels, of which the first `layout.num_channels` are used.
+ */
 typedef struct {
-  DemuxerChannel channels[kMuxChannels];
+  MuxLayout layout;
+  /* Per-channel down converters, shifting the band midpoint down to DC. */
+  Phase32 down_converter_phase[kMuxMaxChannels];
+  Phase32 down_converter_frequency[kMuxMaxChannels];
+  /* Pilot trackers, where tracker lane i of pilot_trackers[g] is for channel
+   * 4 * g + i.
+   */
+  PilotTracker4 pilot_trackers[kDemuxerMaxGroups];
+  BiquadFilterState weaver_lpf_state_real[kMuxMaxChannels];
+  BiquadFilterState weaver_lpf_state_imag[kMuxMaxChannels];
+  /* All channels share the same up converter. */
+  Oscillator up_converter;
   PilotTrackerCoeffs pilot_tracker_coeffs;
   BiquadFilterCoeffs weaver_lpf_coeffs;
 } Demuxer;
 
-/* Initializes a Demuxer. */
+/* Initializes a Demuxer for the default layout. */
 void DemuxerInit(Demuxer* demuxer);
 
-/* Processes samples in a streaming manner.
+/* Initializes a Demuxer for `layout`, designing its Weaver lowpass filter for
+ * the layout's muxed sample rate. Returns 1 on success, 0 if the layout is
+ * invalid (see MuxLayoutIsValid()).
+ */
+int /*bool*/ DemuxerInitWithLayout(Demuxer* demuxer, const MuxLayout* layout);
+
+/* Processes samples in a streaming manner. The description below is for the
+ * default layout; for other layouts, replace kMuxChannels, kMuxTactileRate,
+ * kMuxMuxedRate, and kMuxRateFactor with the corresponding layout values.
  *
  * `muxed_input` is an array of `num_samples` elements of received muxed samples
  * at kMuxMuxedRate sample rate.
@@ -57,6 +77,24 @@ void DemuxerInit(Demuxer* demuxer);
 void DemuxerProcessSamples(Demuxer* demuxer, const float* muxed_input,
                            int num_samples, float* tactile_output);
 
+/* Same as DemuxerProcessSamples(), but writes the output directly as PWM
+ * samples, without an intermediate float buffer. Sample n of channel c is
+ * written as
+ *
+ *   pwm_channels[c][n * pwm_stride] =
+ *       ConvertSampleFloatTo0_MaxValue(gain * (tactile output), pwm_max_value),
+ *
+ * saturating to [0, pwm_max_value], where `pwm_channels` is an array of
+ * `layout.num_channels` pointers and `pwm_max_value` is at most 65535. On the
+ * sleeve, `pwm_max_value` is Pwm::kTopValue and `pwm_channels` point into the
+ * PWM sequence buffers, see Pwm::UpdateAllChannelsDemuxed().
+ */
+void DemuxerProcessSamplesToPwm(Demuxer* demuxer, const float* muxed_input,
+                                int num_samples, float gain,
+                                int pwm_max_value,
+                                uint16_t* const* pwm_channels,
+                                int pwm_stride);
+
 #ifdef __cplusplus
 }  /* extern "C" */
 #endif
@@ -18,8 +18,45 @@
 #include "dsp/iir_design.h"
 #include "dsp/logging.h"
 
+void MuxLayoutSetDefault(MuxLayout* layout) {
+  layout->num_channels = kMuxChannels;
+  layout->muxed_rate_hz = kMuxMuxedRate;
+  layout->rate_factor = kMuxRateFactor;
+  layout->carrier_spacing_hz = MuxCarrierFrequency(0);
+}
+
+void MuxLayoutSetDense24(MuxLayout* layout) {
+  layout->num_channels = 24;
+  layout->muxed_rate_hz = 48000.0f;
+  layout->rate_factor = 24;
+  layout->carrier_spacing_hz = 950.0f;
+}
+
+int MuxLayoutIsValid(const MuxLayout* layout) {
+  const int num_channels = layout->num_channels;
+  const float kMinSpacingHz = kMuxTactileMaxHz - kMuxPilotHzAtBaseband;
+  const float top_band_hz =
+      MuxLayoutCarrierFrequency(layout, num_channels - 1) + kMuxTactileMaxHz;
+  return num_channels >= 4 && num_channels % 4 == 0 &&
+         num_channels <= kMuxMaxChannels &&
+         1 <= layout->rate_factor && layout->rate_factor <= kMuxMaxRateFactor &&
+         /* The tactile band must be below Nyquist at the tactile rate. */
+         MuxLayoutTactileRate(layout) > 2 * kMuxTactileMaxHz &&
+         /* Neighboring bands and pilots must not overlap. */
+         layout->carrier_spacing_hz >= kMinSpacingHz &&
+         /* The top band must be below Nyquist at the muxed rate. */
+         top_band_hz < 0.5f * layout->muxed_rate_hz;
+}
+
 void DemuxerDesignWeaverLpf(BiquadFilterCoeffs* coeffs) {
+  MuxLayout layout;
+  MuxLayoutSetDefault(&layout);
+  DemuxerDesignWeaverLpfForLayout(&layout, coeffs);
+}
+
+void DemuxerDesignWeaverLpfForLayout(const MuxLayout* layout,
+                                     BiquadFilterCoeffs* coeffs) {
   CHECK(DesignChebyshev1Lowpass(2, 2.0, kMuxWeaverLpfCutoffHz,
-                                kMuxMuxedRate, coeffs, 1) == 1);
+                                layout->muxed_rate_hz, coeffs, 1) == 1);
 }
 
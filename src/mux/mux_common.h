@@ -14,6 +14,14 @@
  *
  *
  * Constants and definitions common to both the muxer and demuxer.
+ *
+ * The kMux* constants below define the default layout of the FDM scheme: 12
+ * channels with carriers spaced 1000 Hz apart, muxed at 31250 Hz. A `MuxLayout`
+ * describes other layouts, for instance MuxLayoutSetDense24() packs 24
+ * channels into a 48 kHz signal for a 24-tactor sleeve. Pass the layout to
+ * MuxerMakeWithLayout() and DemuxerInitWithLayout(); the Weaver lowpass filters
+ * are designed for it at init. In all layouts, each channel carries the
+ * kMuxTactileMinHz to kMuxTactileMaxHz band plus a pilot tone.
  */
 
 #ifndef AUDIO_TO_TACTILE_SRC_MUX_MUX_COMMON_H_
@@ -48,9 +56,66 @@ extern "C" {
 /* Carrier frequency in Hz for channel c. */
 static float MuxCarrierFrequency(int c) { return 1000.0f * (1 + c); }
 
-/* Designs the demuxer's Weaver lowpass filter, a single biquad. */
+/* Max number of channels and rate factor over all layouts, which set the size
+ * of the Demuxer. These may be defined at build time to save memory, e.g.
+ * -DkMuxMaxChannels=12 -DkMuxMaxRateFactor=16 when only the default layout is
+ * used.
+ */
+#ifndef kMuxMaxChannels
+#define kMuxMaxChannels 24
+#endif
+#ifndef kMuxMaxRateFactor
+#define kMuxMaxRateFactor 24
+#endif
+
+typedef struct {
+  /* Number of tactile channels, a multiple of 4 up to kMuxMaxChannels. */
+  int num_channels;
+  /* Sample rate in Hz of the muxed signal. */
+  float muxed_rate_hz;
+  /* Sample rate factor between the muxed signal and the tactile signals, up to
+   * kMuxMaxRateFactor.
+   */
+  int rate_factor;
+  /* Carrier spacing in Hz. Channel c has carrier (1 + c) * carrier_spacing_hz.
+   * This must be at least kMuxTactileMaxHz - kMuxPilotHzAtBaseband = 610 Hz so
+   * that neighboring bands and pilots don't overlap.
+   */
+  float carrier_spacing_hz;
+} MuxLayout;
+
+/* Sets the default layout given by the kMux* constants: 12 channels, 1000 Hz
+ * spacing, 31250 Hz muxed rate, and a rate factor of 16.
+ */
+void MuxLayoutSetDefault(MuxLayout* layout);
+
+/* Sets a dense layout for 24 channels: 950 Hz spacing, 48 kHz muxed rate, and
+ * a rate factor of 24 (2 kHz tactile rate). The top band ends at 23300 Hz.
+ */
+void MuxLayoutSetDense24(MuxLayout* layout);
+
+/* Checks that `layout` is supported. Returns 1 if so, 0 otherwise. */
+int /*bool*/ MuxLayoutIsValid(const MuxLayout* layout);
+
+/* Sample rate in Hz of the tactile signals for `layout`. */
+static float MuxLayoutTactileRate(const MuxLayout* layout) {
+  return layout->muxed_rate_hz / layout->rate_factor;
+}
+
+/* Carrier frequency in Hz for channel c in `layout`. */
+static float MuxLayoutCarrierFrequency(const MuxLayout* layout, int c) {
+  return layout->carrier_spacing_hz * (1 + c);
+}
+
+/* Designs the demuxer's Weaver lowpass filter for the default layout, a single
+ * biquad.
+ */
 void DemuxerDesignWeaverLpf(BiquadFilterCoeffs* coeffs);
 
+/* Same as above, for the muxed sample rate of `layout`. */
+void DemuxerDesignWeaverLpfForLayout(const MuxLayout* layout,
+                                     BiquadFilterCoeffs* coeffs);
+
 #ifdef __cplusplus
 }  /* extern "C" */
 #endif
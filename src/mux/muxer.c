@@ -18,41 +18,80 @@
 #include <math.h>
 #include <stdlib.h>
 
+#include "dsp/aligned_alloc.h"
 #include "dsp/complex.h"
 #include "dsp/logging.h"
 #include "dsp/fft.h"
 #include "dsp/math_constants.h"
-#include "dsp/phase32.h"
+#include "dsp/phase32_simd.h"
 
-/* Radius of Weaver lowpass filter in units of upsampled muxed samples. */
-#define kMuxerWeaverLpfFilterRadius 511
-
-/* Number of taps per phase in the weaver_lpf polyphase filter. */
+/* Number of taps per phase in the weaver_lpf polyphase filter. The filter has
+ * rate_factor * kLpfNumTaps taps in units of upsampled muxed samples, e.g.
+ * 1024 taps for the default layout, so its duration in tactile-rate samples is
+ * the same for all layouts.
+ */
 #define kLpfNumTaps 64
 
-typedef struct {
-  Oscillator down_converter;
-  /* Buffered downconverted samples. */
-  ComplexFloat buffer[kLpfNumTaps];
-  Oscillator up_converter;
-  Oscillator pilot;
-} MuxerChannel;
+/* Channels are processed four at a time with Float4 (see dsp/simd.h). */
+#if kMuxChannels % 4 != 0
+#error "kMuxChannels must be a multiple of 4."
+#endif
+#define kMuxerMaxGroups (kMuxMaxChannels / 4)
 
 struct Muxer {
-  MuxerChannel channels[kMuxChannels];
+  MuxLayout layout;
+  /* Buffered downconverted samples in structure-of-arrays layout, where
+   * `buffer_real[n * num_channels + c]` is the real part of tap n, channel c.
+   * Each has kLpfNumTaps * num_channels elements.
+   */
+  float* buffer_real;
+  float* buffer_imag;
+  /* All channels share the same down converter, shifting the band midpoint
+   * down to DC.
+   */
+  Oscillator down_converter;
+  /* Per-channel up converter and pilot oscillators, each with num_channels
+   * elements. These are Phase32 values, stored as int32_t to load them as Int4.
+   */
+  int32_t* up_converter_phase;
+  int32_t* up_converter_frequency;
+  int32_t* pilot_phase;
+  int32_t* pilot_frequency;
   int samples_in_buffer;
   int buffer_position;
-  float weaver_lpf[kMuxRateFactor * kLpfNumTaps];
+  /* Polyphase Weaver lowpass filter, rate_factor * kLpfNumTaps elements. */
+  float* weaver_lpf;
 };
 
+/* Size in bytes of a Muxer with `layout`, including its arrays, which are
+ * allocated together with the struct.
+ */
+static size_t MuxerAllocationSize(const MuxLayout* layout) {
+  const int num_channels = layout->num_channels;
+  return sizeof(Muxer) +
+         sizeof(float) * 2 * kLpfNumTaps * num_channels +
+         sizeof(int32_t) * 4 * num_channels +
+         sizeof(float) * layout->rate_factor * kLpfNumTaps;
+}
+
+/* Radius of the Weaver lowpass filter in units of upsampled muxed samples. */
+static int MuxerWeaverLpfRadius(const MuxLayout* layout) {
+  return layout->rate_factor * kLpfNumTaps / 2 - 1;
+}
+
 /* Gets muxer Weaver lowpass filter by windowed FIR design. */
-static void MuxerDesignWeaverLpf(float* polyphase_coeffs) {
-  const int kFftSize = 1024;
+static void MuxerDesignWeaverLpf(const MuxLayout* layout,
+                                 float* polyphase_coeffs) {
+  const int rate_factor = layout->rate_factor;
+  const int radius = MuxerWeaverLpfRadius(layout);
+  /* The FFT size is the smallest power of 2 holding the filter. */
+  int kFftSize = 1;
+  while (kFftSize < 2 * (radius + 1)) { kFftSize *= 2; }
   ComplexFloat* buffer =
       (ComplexFloat*)CHECK_NOTNULL(malloc(sizeof(ComplexFloat) * kFftSize));
 
   BiquadFilterCoeffs demuxer_lpf;
-  DemuxerDesignWeaverLpf(&demuxer_lpf);
+  DemuxerDesignWeaverLpfForLayout(layout, &demuxer_lpf);
 
   /* The demuxer should be cheap, since it runs in real time on device, so it
    * uses a cheap IIR filter. As a result, the demuxer filter's frequency
@@ -68,7 +107,8 @@ static void MuxerDesignWeaverLpf(float* polyphase_coeffs) {
   for (k = 0; k <= kFftSize / 2; ++k) {
     double cycles_per_sample = ((double)k) / kFftSize;
     ComplexDouble target_response = {0.0, 0.0};
-    if (cycles_per_sample <= kMuxWeaverLpfCutoffHz / kMuxMuxedRate) {
+    if (cycles_per_sample <=
+        kMuxWeaverLpfCutoffHz / layout->muxed_rate_hz) {
       /* Get demuxer filter's frequency response. */
       ComplexDouble demuxer_response =
           BiquadFilterFrequencyResponse(&demuxer_lpf, cycles_per_sample);
@@ -80,7 +120,7 @@ static void MuxerDesignWeaverLpf(float* polyphase_coeffs) {
        */
       target_response = ComplexDoubleMulReal(
           ComplexDoubleConj(demuxer_response),
-          ((double)kMuxRateFactor / kFftSize)
+          ((double)rate_factor / kFftSize)
           / (ComplexDoubleAbs2(demuxer_response) + 1e-6));
     }
 
@@ -97,26 +137,24 @@ static void MuxerDesignWeaverLpf(float* polyphase_coeffs) {
 
   /* Multiply `buffer` pointwise with cosine window. */
   const double kWindowRadPerSample =
-      M_PI / (2 * (kMuxerWeaverLpfFilterRadius + 1));
+      M_PI / (2 * (radius + 1));
   const ComplexDouble rotator =
       ComplexDoubleMake(cos(kWindowRadPerSample), sin(kWindowRadPerSample));
   ComplexDouble phasor = ComplexDoubleMake(rotator.imag, -rotator.real);
   /* Absorb factor 2 for converting signal to real. */
   phasor = ComplexDoubleMulReal(phasor, 2.0);
   int i;
-  for (i = -kMuxerWeaverLpfFilterRadius; i <= kMuxerWeaverLpfFilterRadius;
-       ++i) {
+  for (i = -radius; i <= radius; ++i) {
     buffer[(i >= 0) ? i : i + kFftSize].real *= phasor.real;
     phasor = ComplexDoubleMul(phasor, rotator);
   }
 
   /* Rearrange filter for polyphase representation. */
   int phase;
-  for (phase = 0, k = 0; phase < kMuxRateFactor; ++phase) {
+  for (phase = 0, k = 0; phase < rate_factor; ++phase) {
     int n;
     for (n = 0; n < kLpfNumTaps; ++n, ++k) {
-      i = kMuxerWeaverLpfFilterRadius + 1 + phase -
-          kMuxRateFactor * (1 + n);
+      i = radius + 1 + phase - rate_factor * (1 + n);
       i = (i >= 0) ? i : i + kFftSize;
       polyphase_coeffs[k] = (k != kLpfNumTaps - 1) ? buffer[i].real : 0.0f;
     }
@@ -126,38 +164,67 @@ static void MuxerDesignWeaverLpf(float* polyphase_coeffs) {
 }
 
 Muxer* MuxerMake(void) {
-  Muxer* muxer = (Muxer*)malloc(sizeof(Muxer));
+  MuxLayout layout;
+  MuxLayoutSetDefault(&layout);
+  return MuxerMakeWithLayout(&layout);
+}
+
+Muxer* MuxerMakeWithLayout(const MuxLayout* layout) {
+  if (!MuxLayoutIsValid(layout)) { return NULL; }
+  Muxer* muxer = (Muxer*)AlignedAlloc(MuxerAllocationSize(layout));
   if (muxer == NULL) { return NULL; }
 
-  MuxerDesignWeaverLpf(muxer->weaver_lpf);
+  muxer->layout = *layout;
+  const int num_channels = layout->num_channels;
+  float* storage = (float*)(muxer + 1);
+  muxer->buffer_real = storage;
+  storage += kLpfNumTaps * num_channels;
+  muxer->buffer_imag = storage;
+  storage += kLpfNumTaps * num_channels;
+  muxer->weaver_lpf = storage;
+  storage += layout->rate_factor * kLpfNumTaps;
+  int32_t* oscillators = (int32_t*)storage;
+  muxer->up_converter_phase = oscillators;
+  muxer->up_converter_frequency = oscillators + num_channels;
+  muxer->pilot_phase = oscillators + 2 * num_channels;
+  muxer->pilot_frequency = oscillators + 3 * num_channels;
+
+  MuxerDesignWeaverLpf(layout, muxer->weaver_lpf);
   MuxerReset(muxer);
   return muxer;
 }
 
 void MuxerFree(Muxer* muxer) {
-  free(muxer);
+  AlignedFree(muxer);
 }
 
 void MuxerReset(Muxer* muxer) {
+  const MuxLayout* layout = &muxer->layout;
   muxer->samples_in_buffer =
-      (kMuxerWeaverLpfFilterRadius + 1) / kMuxRateFactor - 1;
+      (MuxerWeaverLpfRadius(layout) + 1) / layout->rate_factor - 1;
   muxer->buffer_position = 0;
 
+  OscillatorInit(&muxer->down_converter,
+                 -kMuxMidpointHz / MuxLayoutTactileRate(layout));
+
+  const float muxed_rate_hz = layout->muxed_rate_hz;
   int c;
-  for (c = 0; c < kMuxChannels; ++c) {
-    MuxerChannel* channel = &muxer->channels[c];
-    OscillatorInit(&channel->down_converter,
-                   -kMuxMidpointHz / kMuxTactileRate);
-    OscillatorInit(&channel->up_converter,
-                   (kMuxMidpointHz + MuxCarrierFrequency(c)) / kMuxMuxedRate);
-    OscillatorInit(
-        &channel->pilot,
-        (kMuxPilotHzAtBaseband + MuxCarrierFrequency(c)) / kMuxMuxedRate);
-
-    int i;
-    for (i = 0; i < kLpfNumTaps; ++i) {
-      channel->buffer[i] = ComplexFloatMake(0.0f, 0.0f);
-    }
+  for (c = 0; c < layout->num_channels; ++c) {
+    const float carrier_hz = MuxLayoutCarrierFrequency(layout, c);
+    Oscillator oscillator;
+    OscillatorInit(&oscillator, (kMuxMidpointHz + carrier_hz) / muxed_rate_hz);
+    muxer->up_converter_phase[c] = (int32_t)oscillator.phase;
+    muxer->up_converter_frequency[c] = (int32_t)oscillator.frequency;
+    OscillatorInit(&oscillator,
+                   (kMuxPilotHzAtBaseband + carrier_hz) / muxed_rate_hz);
+    muxer->pilot_phase[c] = (int32_t)oscillator.phase;
+    muxer->pilot_frequency[c] = (int32_t)oscillator.frequency;
+  }
+
+  int i;
+  for (i = 0; i < kLpfNumTaps * layout->num_channels; ++i) {
+    muxer->buffer_real[i] = 0.0f;
+    muxer->buffer_imag[i] = 0.0f;
   }
 }
 
@@ -172,94 +239,156 @@ int MuxerNextOutputSize(Muxer* muxer, int num_input_frames) {
     }
 
     if (samples_in_buffer == kLpfNumTaps) {
-      num_written += kMuxRateFactor;
+      num_written += muxer->layout.rate_factor;
     }
   }
   return num_written;
 }
 
-int MuxerProcessSamples(Muxer* muxer, const float* tactile_input,
-                        int num_frames, float* muxed_output) {
-  int samples_in_buffer;
-  int num_written;
-  int p;
+/* Implements MuxerProcessSamples() for a layout with `num_groups` groups of
+ * four channels. The compiler inlines this static function into its callers,
+ * specializing it for the predefined layouts, where num_groups is a constant
+ * and the per-group accumulators stay in registers.
+ */
+static int MuxerProcessSamplesImpl(Muxer* muxer, const float* tactile_input,
+                                   int num_frames, float* muxed_output,
+                                   int num_groups) {
+  const int num_channels = 4 * num_groups;
+  const int rate_factor = muxer->layout.rate_factor;
+  int samples_in_buffer = muxer->samples_in_buffer;
+  int p = muxer->buffer_position;
+  int num_written = 0;
+  float* output = muxed_output;
+  const Float4 pilot_amplitude = Float4Broadcast(0.05f);
+
+  /* Keep the oscillator phases in vector registers over the loop. */
+  Int4 up_converter_phase[kMuxerMaxGroups];
+  Int4 up_converter_frequency[kMuxerMaxGroups];
+  Int4 pilot_phase[kMuxerMaxGroups];
+  Int4 pilot_frequency[kMuxerMaxGroups];
+  int g;
+  for (g = 0; g < num_groups; ++g) {
+    up_converter_phase[g] = Int4Load(muxer->up_converter_phase + 4 * g);
+    up_converter_frequency[g] = Int4Load(muxer->up_converter_frequency + 4 * g);
+    pilot_phase[g] = Int4Load(muxer->pilot_phase + 4 * g);
+    pilot_frequency[g] = Int4Load(muxer->pilot_frequency + 4 * g);
+  }
 
-  int c;
-  for (c = 0; c < kMuxChannels; ++c) {
-    const float* input = tactile_input + c;
-    float* output = muxed_output;
-    num_written = 0;
-    samples_in_buffer = muxer->samples_in_buffer;
-    p = muxer->buffer_position;
-
-    int i;
-    for (i = 0; i < num_frames; ++i) {
-      MuxerChannel* channel = &muxer->channels[c];
-
-      /* Shift band midpoint down to DC and store value in `buffer[p]`. */
-      channel->buffer[p] = ComplexFloatMulReal(
-          Phase32ComplexExp(channel->down_converter.phase), *input);
-      OscillatorNext(&channel->down_converter);
-
-      if (++samples_in_buffer > kLpfNumTaps) {
-        samples_in_buffer = kLpfNumTaps;
-      }
+  int i;
+  for (i = 0; i < num_frames; ++i) {
+    /* Shift band midpoint down to DC and store value in `buffer[p]`. */
+    const ComplexFloat down =
+        Phase32ComplexExp(muxer->down_converter.phase);
+    OscillatorNext(&muxer->down_converter);
+    const Float4 down_real = Float4Broadcast(down.real);
+    const Float4 down_imag = Float4Broadcast(down.imag);
+    for (g = 0; g < num_groups; ++g) {
+      const Float4 x = Float4Load(tactile_input + 4 * g);
+      Float4Store(muxer->buffer_real + p * num_channels + 4 * g,
+                  Float4Mul(x, down_real));
+      Float4Store(muxer->buffer_imag + p * num_channels + 4 * g,
+                  Float4Mul(x, down_imag));
+    }
 
-      if (samples_in_buffer == kLpfNumTaps) {
-        const float* lpf = muxer->weaver_lpf;
-        int phase;
+    if (++samples_in_buffer > kLpfNumTaps) {
+      samples_in_buffer = kLpfNumTaps;
+    }
+
+    if (samples_in_buffer == kLpfNumTaps) {
+      const float* lpf = muxer->weaver_lpf;
+      int phase;
+      for (phase = 0; phase < rate_factor; ++phase) {
+        Float4 filtered_real[kMuxerMaxGroups];
+        Float4 filtered_imag[kMuxerMaxGroups];
+        for (g = 0; g < num_groups; ++g) {
+          filtered_real[g] = Float4Broadcast(0.0f);
+          filtered_imag[g] = Float4Broadcast(0.0f);
+        }
+        /* Apply Weaver lowpass filter. Conceptually, the input to the filter
+         * is upsampled by zero insertion by factor rate_factor. We
+         * efficiently implement this by polyphase filtering with the lowpass
+         * filter divided into rate_factor different phases.
+         *
+         * The input samples are stored in a circular buffer, with `buffer[p]`
+         * being the most recent sample. So we apply the filter for the current
+         * phase starting at (p + 1), then wrap around and sum up to and
+         * including p.
+         */
+        int n = p + 1;
         int k;
-        for (phase = 0, k = 0; phase < kMuxRateFactor; ++phase) {
-          ComplexFloat filtered = {0.0f, 0.0f};
-          int n;
-          /* Apply Weaver lowpass filter. Conceptually, the input to the filter
-           * is upsampled by zero insertion by factor kMuxRateFactor. We
-           * efficiently implement this by polyphase filtering with the lowpass
-           * filter divided into kMuxRateFactor different phases.
-           *
-           * The input samples are stored in a circular buffer, with `buffer[p]`
-           * being the most recent sample. So we apply the filter for the
-           * current phase starting at (p + 1)...
-           */
-          for (n = p + 1; n < kLpfNumTaps; ++n, ++k) {
-            filtered = ComplexFloatAdd(
-                filtered, ComplexFloatMulReal(channel->buffer[n], lpf[k]));
-          }
-          /* ... then wrap around and sum up to and including p. */
-          for (n = 0; n <= p; ++n, ++k) {
-            filtered = ComplexFloatAdd(
-                filtered, ComplexFloatMulReal(channel->buffer[n], lpf[k]));
+        for (k = 0; k < kLpfNumTaps; ++k, ++n) {
+          if (n == kLpfNumTaps) { n = 0; }
+          const Float4 coeff = Float4Broadcast(*lpf++);
+          const float* tap_real = muxer->buffer_real + n * num_channels;
+          const float* tap_imag = muxer->buffer_imag + n * num_channels;
+          for (g = 0; g < num_groups; ++g) {
+            filtered_real[g] = Float4Add(filtered_real[g],
+                Float4Mul(Float4Load(tap_real + 4 * g), coeff));
+            filtered_imag[g] = Float4Add(filtered_imag[g],
+                Float4Mul(Float4Load(tap_imag + 4 * g), coeff));
           }
+        }
 
+        Float4 sum = Float4Broadcast(0.0f);
+        for (g = 0; g < num_groups; ++g) {
           /* Shift upper sideband above the carrier frequency. */
-          float sample =
-              filtered.real * Phase32Cos(channel->up_converter.phase) -
-              filtered.imag * Phase32Sin(channel->up_converter.phase);
-          OscillatorNext(&channel->up_converter);
+          Float4 sample = Float4Sub(
+              Float4Mul(filtered_real[g], Phase32Cos4(up_converter_phase[g])),
+              Float4Mul(filtered_imag[g], Phase32Sin4(up_converter_phase[g])));
+          up_converter_phase[g] =
+              Int4Add(up_converter_phase[g], up_converter_frequency[g]);
 
           /* Add pilot tone for synchronization. */
-          sample += 0.05f * Phase32Cos(channel->pilot.phase);
-          OscillatorNext(&channel->pilot);
+          sample = Float4Add(sample, Float4Mul(pilot_amplitude,
+              Phase32Cos4(pilot_phase[g])));
+          pilot_phase[g] = Int4Add(pilot_phase[g], pilot_frequency[g]);
 
-          if (c == 0) {
-            output[phase] = sample;
-          } else {
-            output[phase] += sample;
-          }
+          sum = Float4Add(sum, sample);
         }
 
-        output += kMuxRateFactor;
-        num_written += kMuxRateFactor;
+        float lanes[4];
+        Float4Store(lanes, sum);
+        output[phase] = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
       }
 
-      if (++p >= kLpfNumTaps) {
-        p = 0;
-      }
-      input += kMuxChannels;
+      output += rate_factor;
+      num_written += rate_factor;
+    }
+
+    if (++p >= kLpfNumTaps) {
+      p = 0;
     }
+    tactile_input += num_channels;
   }
 
+  for (g = 0; g < num_groups; ++g) {
+    Int4Store(muxer->up_converter_phase + 4 * g, up_converter_phase[g]);
+    Int4Store(muxer->pilot_phase + 4 * g, pilot_phase[g]);
+  }
   muxer->samples_in_buffer = samples_in_buffer;
   muxer->buffer_position = p;
   return num_written;
 }
+
+int MuxerProcessSamples(Muxer* muxer, const float* tactile_input,
+                        int num_frames, float* muxed_output) {
+  switch (muxer->layout.num_channels) {
+    case 12:
+      return MuxerProcessSamplesImpl(muxer, tactile_input, num_frames,
+                                     muxed_output, 3);
+    case 24:
+      return MuxerProcessSamplesImpl(muxer, tactile_input, num_frames,
+                                     muxed_output, 6);
+    default:
+      return MuxerProcessSamplesImpl(muxer, tactile_input, num_frames,
+                                     muxed_output,
+                                     muxer->layout.num_channels / 4);
+  }
+}
+
+void MuxerMemoryUsage(const Muxer* muxer, MemoryUsage* usage) {
+  MemoryUsageZero(usage);
+  /* The Muxer is one allocation, including its arrays. */
+  usage->heap_bytes = MuxerAllocationSize(&muxer->layout);
+  usage->table_bytes = sizeof(kPhase32SinTable);
+}
@@ -14,12 +14,19 @@
  *
  *
  * A frequency-division multiplexing (FDM) encoder, combining
- * kMuxChannels channels of tactile signals into a single channel.
+ * kMuxChannels channels of tactile signals into a single channel, or more
+ * generally the channels of a MuxLayout (see mux_common.h).
+ *
+ * The encoder is a polyphase Weaver modulator: each channel is shifted to
+ * baseband at the tactile rate, then upsampled and lowpass filtered at once by
+ * a polyphase filter with `rate_factor` phases, and finally shifted up to its
+ * carrier. The cost per muxed sample is linear in the number of channels.
  */
 
 #ifndef AUDIO_TO_TACTILE_SRC_MUX_MUXER_H_
 #define AUDIO_TO_TACTILE_SRC_MUX_MUXER_H_
 
+#include "dsp/memory_usage.h"
 #include "mux/mux_common.h"
 
 #ifdef __cplusplus
@@ -29,9 +36,15 @@ extern "C" {
 struct Muxer; /* Forward declaration. See muxer.c for definition. */
 typedef struct Muxer Muxer;
 
-/* Makes a Muxer. Returns NULL on failure. */
+/* Makes a Muxer for the default layout. Returns NULL on failure. */
 Muxer* MuxerMake(void);
 
+/* Makes a Muxer for `layout`, designing its Weaver lowpass filter for the
+ * layout's sample rates. Returns NULL on failure, including if the layout is
+ * invalid (see MuxLayoutIsValid()).
+ */
+Muxer* MuxerMakeWithLayout(const MuxLayout* layout);
+
 /* Frees a Muxer. */
 void MuxerFree(Muxer* muxer);
 
@@ -40,11 +53,14 @@ void MuxerReset(Muxer* muxer);
 
 /* Gets the number of output samples that will be written for a given number of
  * input frames by the next call to MuxerProcessSamples. The output size never
- * exceeds `kMuxRateFactor * num_input_frames`.
+ * exceeds `rate_factor * num_input_frames`, where rate_factor is that of the
+ * Muxer's layout (kMuxRateFactor by default).
  */
 int MuxerNextOutputSize(Muxer* muxer, int num_input_frames);
 
-/* Processes samples in a streaming manner.
+/* Processes samples in a streaming manner. The description below is for the
+ * default layout; for other layouts, replace kMuxChannels, kMuxTactileRate,
+ * kMuxMuxedRate, and kMuxRateFactor with the corresponding layout values.
  *
  * `tactile_input` is an array with `kMuxChannels * num_frames` elements
  * in which `tactile_input[i * kMuxChannels + c] is frame i, channel c of
@@ -59,6 +75,9 @@ int MuxerNextOutputSize(Muxer* muxer, int num_input_frames);
 int MuxerProcessSamples(Muxer* muxer, const float* tactile_input,
                         int num_frames, float* muxed_output);
 
+/* Gets the memory used by `muxer`, see dsp/memory_usage.h. */
+void MuxerMemoryUsage(const Muxer* muxer, MemoryUsage* usage);
+
 #ifdef __cplusplus
 }  /* extern "C" */
 #endif
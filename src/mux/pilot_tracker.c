@@ -16,6 +16,7 @@
 #include <math.h>
 
 #include "dsp/math_constants.h"
+#include "dsp/phase32_simd.h"
 #include "mux/pilot_tracker.h"
 
 /* Pilot amplitude is computed as the average of |real part| + |imag part|
@@ -38,6 +39,16 @@
 #define kPllIntegratorCoeff ((float)(kPllScale * kPllBandwidth * kPllBandwidth))
 #define kPllProportionalCoeff ((float)(kPllScale * M_SQRT2 * kPllBandwidth))
 
+/* For DecimatedPilotTracker, the integrator coefficient is scaled up by the
+ * decimation factor, since the frequency is updated once per
+ * kPilotTrackerDecimation samples. The proportional coefficient is unchanged,
+ * since its correction is applied on each of the samples until the next
+ * update. The loop bandwidth per update is kPilotTrackerDecimation *
+ * kPllBandwidth = 0.4 radians, still well within the stable range.
+ */
+#define kDecimatedPllIntegratorCoeff \
+  ((float)(kPilotTrackerDecimation * kPllIntegratorCoeff))
+
 void PilotTrackerCoeffsInit(PilotTrackerCoeffs* coeffs, float pilot_hz,
                             float sample_rate_hz) {
   /* Make a complex bandpass filter centered on pilot_hz, a 2-pole gamma filter
@@ -74,9 +85,12 @@ void PilotTrackerInit(PilotTracker* tracker, const PilotTrackerCoeffs* coeffs) {
   tracker->pilot_phase = 0;
 }
 
-Phase32 PilotTrackerProcessOneSample(PilotTracker* tracker,
-                                     const PilotTrackerCoeffs* coeffs,
-                                     ComplexFloat sample) {
+/* Processes one sample. This is `static` so that it is inlined into the loop
+ * in PilotTrackerProcessSamples().
+ */
+static Phase32 PilotTrackerStep(PilotTracker* tracker,
+                                const PilotTrackerCoeffs* coeffs,
+                                ComplexFloat sample) {
   /* Bandpass filter to extract the pilot. */
   tracker->pilot[0] = ComplexFloatAdd(
       sample, ComplexFloatMul(coeffs->pilot_bpf_pole, tracker->pilot[0]));
@@ -104,3 +118,179 @@ Phase32 PilotTrackerProcessOneSample(PilotTracker* tracker,
   return tracker->pilot_phase += Phase32FromFloat(
       tracker->pilot_frequency + kPllProportionalCoeff * phase_error);
 }
+
+Phase32 PilotTrackerProcessOneSample(PilotTracker* tracker,
+                                     const PilotTrackerCoeffs* coeffs,
+                                     ComplexFloat sample) {
+  return PilotTrackerStep(tracker, coeffs, sample);
+}
+
+void PilotTrackerProcessSamples(PilotTracker* tracker,
+                                const PilotTrackerCoeffs* coeffs,
+                                const ComplexFloat* input, int num_samples,
+                                Phase32* phases) {
+  int n;
+  for (n = 0; n < num_samples; ++n) {
+    phases[n] = PilotTrackerStep(tracker, coeffs, input[n]);
+  }
+}
+
+void PilotTracker4Init(PilotTracker4* tracker,
+                       const PilotTrackerCoeffs* coeffs) {
+  PilotTracker scalar_tracker;
+  PilotTrackerInit(&scalar_tracker, coeffs);
+  int i;
+  for (i = 0; i < 4; ++i) {
+    int k;
+    for (k = 0; k < 2; ++k) {
+      tracker->pilot_real[k][i] = scalar_tracker.pilot[k].real;
+      tracker->pilot_imag[k][i] = scalar_tracker.pilot[k].imag;
+      tracker->pilot_amplitude[k][i] = scalar_tracker.pilot_amplitude[k];
+    }
+    tracker->pilot_phase[i] = scalar_tracker.pilot_phase;
+    tracker->pilot_frequency[i] = scalar_tracker.pilot_frequency;
+  }
+}
+
+/* Elementwise absolute value, clearing the sign bits. */
+static Float4 PilotTrackerAbs4(Float4 x) {
+  return Int4AsFloat4(Int4And(Float4AsInt4(x), Int4Broadcast(0x7fffffff)));
+}
+
+void PilotTracker4ProcessSamples(PilotTracker4* tracker,
+                                 const PilotTrackerCoeffs* coeffs,
+                                 const float* input_real,
+                                 const float* input_imag,
+                                 int num_samples,
+                                 Phase32* phases) {
+  const Float4 pole_real = Float4Broadcast(coeffs->pilot_bpf_pole.real);
+  const Float4 pole_imag = Float4Broadcast(coeffs->pilot_bpf_pole.imag);
+  const Float4 smoother = Float4Broadcast(coeffs->pilot_amplitude_smoother);
+  const Float4 integrator_coeff = Float4Broadcast(kPllIntegratorCoeff);
+  const Float4 proportional_coeff = Float4Broadcast(kPllProportionalCoeff);
+
+  /* Keep the tracker states in vector registers over the loop. */
+  Float4 pilot0_real = Float4Load(tracker->pilot_real[0]);
+  Float4 pilot0_imag = Float4Load(tracker->pilot_imag[0]);
+  Float4 pilot1_real = Float4Load(tracker->pilot_real[1]);
+  Float4 pilot1_imag = Float4Load(tracker->pilot_imag[1]);
+  Float4 amplitude0 = Float4Load(tracker->pilot_amplitude[0]);
+  Float4 amplitude1 = Float4Load(tracker->pilot_amplitude[1]);
+  Int4 pilot_phase = Int4Load((const int32_t*)tracker->pilot_phase);
+  Float4 pilot_frequency = Float4Load(tracker->pilot_frequency);
+
+  int n;
+  for (n = 0; n < num_samples; ++n) {
+    /* Bandpass filter to extract the pilot, with complex multiplies computed
+     * in the same order as ComplexFloatMul().
+     */
+    const Float4 next0_real = Float4Add(Float4Load(input_real + 4 * n),
+        Float4Sub(Float4Mul(pole_real, pilot0_real),
+                  Float4Mul(pole_imag, pilot0_imag)));
+    const Float4 next0_imag = Float4Add(Float4Load(input_imag + 4 * n),
+        Float4Add(Float4Mul(pole_real, pilot0_imag),
+                  Float4Mul(pole_imag, pilot0_real)));
+    pilot0_real = next0_real;
+    pilot0_imag = next0_imag;
+    const Float4 next1_real = Float4Add(pilot0_real,
+        Float4Sub(Float4Mul(pole_real, pilot1_real),
+                  Float4Mul(pole_imag, pilot1_imag)));
+    const Float4 next1_imag = Float4Add(pilot0_imag,
+        Float4Add(Float4Mul(pole_real, pilot1_imag),
+                  Float4Mul(pole_imag, pilot1_real)));
+    pilot1_real = next1_real;
+    pilot1_imag = next1_imag;
+
+    /* Estimate the pilot's amplitude. */
+    amplitude0 = Float4Add(amplitude0, Float4Mul(smoother, Float4Sub(
+        Float4Add(PilotTrackerAbs4(pilot1_real), PilotTrackerAbs4(pilot1_imag)),
+        amplitude0)));
+    amplitude1 = Float4Add(amplitude1, Float4Mul(smoother,
+        Float4Sub(amplitude0, amplitude1)));
+
+    /* Phase-locked loop to track the pilot. */
+    const Float4 phase_error = Float4Div(
+        Float4Sub(Float4Mul(pilot1_imag, Phase32Cos4(pilot_phase)),
+                  Float4Mul(pilot1_real, Phase32Sin4(pilot_phase))),
+        amplitude1);
+    pilot_frequency = Float4Add(pilot_frequency,
+                                Float4Mul(integrator_coeff, phase_error));
+    pilot_phase = Int4Add(pilot_phase, Phase32FromFloat4(Float4Add(
+        pilot_frequency, Float4Mul(proportional_coeff, phase_error))));
+    Int4Store((int32_t*)phases + 4 * n, pilot_phase);
+  }
+
+  Float4Store(tracker->pilot_real[0], pilot0_real);
+  Float4Store(tracker->pilot_imag[0], pilot0_imag);
+  Float4Store(tracker->pilot_real[1], pilot1_real);
+  Float4Store(tracker->pilot_imag[1], pilot1_imag);
+  Float4Store(tracker->pilot_amplitude[0], amplitude0);
+  Float4Store(tracker->pilot_amplitude[1], amplitude1);
+  Int4Store((int32_t*)tracker->pilot_phase, pilot_phase);
+  Float4Store(tracker->pilot_frequency, pilot_frequency);
+}
+
+void DecimatedPilotTrackerInit(DecimatedPilotTracker* tracker,
+                               const PilotTrackerCoeffs* coeffs) {
+  PilotTracker scalar_tracker;
+  PilotTrackerInit(&scalar_tracker, coeffs);
+  int k;
+  for (k = 0; k < 2; ++k) {
+    tracker->pilot[k] = scalar_tracker.pilot[k];
+    tracker->pilot_amplitude[k] = scalar_tracker.pilot_amplitude[k];
+  }
+  tracker->pilot_phase = 0;
+  tracker->pilot_frequency = 0;
+  tracker->pilot_phase_step = 0;
+  tracker->samples_until_update = 1;
+}
+
+void DecimatedPilotTrackerProcessSamples(DecimatedPilotTracker* tracker,
+                                         const PilotTrackerCoeffs* coeffs,
+                                         const ComplexFloat* input,
+                                         int num_samples, Phase32* phases) {
+  const ComplexFloat pole = coeffs->pilot_bpf_pole;
+  const float smoother = coeffs->pilot_amplitude_smoother;
+  ComplexFloat pilot0 = tracker->pilot[0];
+  ComplexFloat pilot1 = tracker->pilot[1];
+  float amplitude0 = tracker->pilot_amplitude[0];
+  float amplitude1 = tracker->pilot_amplitude[1];
+  Phase32 pilot_phase = tracker->pilot_phase;
+  Phase32 pilot_phase_step = tracker->pilot_phase_step;
+  int samples_until_update = tracker->samples_until_update;
+
+  int n;
+  for (n = 0; n < num_samples; ++n) {
+    /* Bandpass filter to extract the pilot. */
+    pilot0 = ComplexFloatAdd(input[n], ComplexFloatMul(pole, pilot0));
+    pilot1 = ComplexFloatAdd(pilot0, ComplexFloatMul(pole, pilot1));
+
+    /* Estimate the pilot's amplitude. */
+    amplitude0 += smoother * (fabs(pilot1.real) + fabs(pilot1.imag) -
+                              amplitude0);
+    amplitude1 += smoother * (amplitude0 - amplitude1);
+
+    if (--samples_until_update == 0) {
+      /* Update the phase-locked loop. */
+      samples_until_update = kPilotTrackerDecimation;
+      const float phase_error = (pilot1.imag * Phase32Cos(pilot_phase) -
+                                 pilot1.real * Phase32Sin(pilot_phase)) /
+                                amplitude1;
+      tracker->pilot_frequency +=
+          Phase32FromFloat(kDecimatedPllIntegratorCoeff * phase_error);
+      pilot_phase_step = tracker->pilot_frequency +
+          Phase32FromFloat(kPllProportionalCoeff * phase_error);
+    }
+
+    /* Extrapolate the phase between updates. */
+    phases[n] = (pilot_phase += pilot_phase_step);
+  }
+
+  tracker->pilot[0] = pilot0;
+  tracker->pilot[1] = pilot1;
+  tracker->pilot_amplitude[0] = amplitude0;
+  tracker->pilot_amplitude[1] = amplitude1;
+  tracker->pilot_phase = pilot_phase;
+  tracker->pilot_phase_step = pilot_phase_step;
+  tracker->samples_until_update = samples_until_update;
+}
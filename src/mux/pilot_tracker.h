@@ -29,6 +29,21 @@
  *       phase error = Im{ sample * exp(-i2 * pi * pilot_phase) } / amplitude
  *
  * 4. Phase error is filtered with a loop filter.
+ *
+ * PilotTrackerProcessSamples() processes a block of samples, avoiding a
+ * function call per sample. `PilotTracker4` holds four trackers in
+ * structure-of-arrays layout to run them together in Float4 lanes (see
+ * dsp/simd.h), as the Demuxer does for its channels.
+ *
+ * `DecimatedPilotTracker` is a cheaper variant for small devices. The bandpass
+ * filter and amplitude estimate still run per sample, but the loop state is
+ * kept in Phase32 fixed point and the loop filter is updated only once every
+ * kPilotTrackerDecimation samples. Between updates, the phase is extrapolated
+ * by adding a constant Phase32 increment per sample. This way the sine and
+ * cosine lookups, the division by the amplitude, and the float-to-Phase32
+ * conversions, which dominate the per-sample cost, run at a fraction of the
+ * rate. The loop gains are scaled so that the loop bandwidth in Hz is the same
+ * as for PilotTracker.
  */
 
 #ifndef AUDIO_TO_TACTILE_SRC_MUX_PILOT_PHASE_TRACKER_H_
@@ -71,6 +86,80 @@ Phase32 PilotTrackerProcessOneSample(PilotTracker* tracker,
                                      const PilotTrackerCoeffs* coeffs,
                                      ComplexFloat sample);
 
+/* Processes a block of `num_samples` complex-valued samples, the same as
+ * calling PilotTrackerProcessOneSample() on each. The pilot phase after each
+ * sample is written to `phases`, an array of size `num_samples`.
+ */
+void PilotTrackerProcessSamples(PilotTracker* tracker,
+                                const PilotTrackerCoeffs* coeffs,
+                                const ComplexFloat* input, int num_samples,
+                                Phase32* phases);
+
+/* Four PilotTrackers with shared coefficients, where lane i of each array is
+ * the state of tracker i. Fields have the same meaning as in PilotTracker.
+ */
+typedef struct {
+  float pilot_real[2][4];
+  float pilot_imag[2][4];
+  float pilot_amplitude[2][4];
+  Phase32 pilot_phase[4];
+  float pilot_frequency[4];
+} PilotTracker4;
+
+/* Initializes all four trackers based on the given coefficients. */
+void PilotTracker4Init(PilotTracker4* tracker,
+                       const PilotTrackerCoeffs* coeffs);
+
+/* Processes a block of `num_samples` samples for each of the four trackers.
+ * The input is in structure-of-arrays layout: `input_real[4 * n + i]` and
+ * `input_imag[4 * n + i]` are the real and imaginary parts of sample n for
+ * tracker i. Similarly, the pilot phase of tracker i after sample n is written
+ * to `phases[4 * n + i]`.
+ *
+ * Results are close to but not bit-exact with PilotTrackerProcessSamples(),
+ * since the phase increment is computed with Phase32FromFloat4().
+ */
+void PilotTracker4ProcessSamples(PilotTracker4* tracker,
+                                 const PilotTrackerCoeffs* coeffs,
+                                 const float* input_real,
+                                 const float* input_imag,
+                                 int num_samples,
+                                 Phase32* phases);
+
+/* Number of samples between loop filter updates in DecimatedPilotTracker. */
+#define kPilotTrackerDecimation 8
+
+typedef struct {
+  /* pilot[1] is the BPF-filtered pilot signal (pilot[0] is an intermediate). */
+  ComplexFloat pilot[2];
+  /* pilot_amplitude[1] is the estimated pilot amplitude. */
+  float pilot_amplitude[2];
+  /* The current phase of the pilot, tracked by a phase-locked loop. */
+  Phase32 pilot_phase;
+  /* Pilot frequency estimate as a Phase32 increment per sample. */
+  Phase32 pilot_frequency;
+  /* Phase increment per sample until the next loop update, the frequency plus
+   * the loop's proportional correction.
+   */
+  Phase32 pilot_phase_step;
+  /* Number of samples remaining until the next loop update. */
+  int samples_until_update;
+} DecimatedPilotTracker;
+
+/* Initializes DecimatedPilotTracker based on the given coefficients. */
+void DecimatedPilotTrackerInit(DecimatedPilotTracker* tracker,
+                               const PilotTrackerCoeffs* coeffs);
+
+/* Processes a block of `num_samples` complex-valued samples, writing the pilot
+ * phase after each sample to `phases`. The loop is updated on a fixed schedule
+ * of every kPilotTrackerDecimation samples, independent of the block size, so
+ * results do not depend on how the input is split into blocks.
+ */
+void DecimatedPilotTrackerProcessSamples(DecimatedPilotTracker* tracker,
+                                         const PilotTrackerCoeffs* coeffs,
+                                         const ComplexFloat* input,
+                                         int num_samples, Phase32* phases);
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
@@ -21,8 +21,9 @@
 namespace audio_tactile {
 
 void PdmMic::Initialize(uint16_t clock_pin, uint16_t data_pin) {
-  // Set the buffer pointer for Easy DMA, thats where the PDM data goes.
-  nrf_pdm_buffer_set(NRF_PDM, (uint32_t *)pdm_buffer_[0], kPdmDataSize);
+  num_overruns_ = 0;
+  block_size_ = kPdmDataSize;
+  queue_depth_ = kPdmQueueDepth;
 
   // Set the clock speed of the pdm module to 1 MHz. This is the clock pin rate,
   // essentially rate at which a bit is clocked out.
@@ -49,6 +50,15 @@ void PdmMic::Initialize(uint16_t clock_pin, uint16_t data_pin) {
 }
 
 void PdmMic::Enable() {
+  // Empty the ring, and set the buffer pointer for Easy DMA to its first slot,
+  // thats where the PDM data goes.
+  while (queue_.Front() != nullptr) { queue_.PopFront(); }
+  timestamp_ = 0;
+  capture_in_ring_ = true;
+  next_capture_in_ring_ = false;
+  nrf_pdm_buffer_set(NRF_PDM, (uint32_t *)queue_.BeginPush()->samples,
+                     block_size_);
+
   NRFX_IRQ_ENABLE(PDM_IRQn);
   nrf_pdm_enable(NRF_PDM);
   nrf_pdm_event_clear(NRF_PDM, NRF_PDM_EVENT_STARTED);
@@ -60,9 +70,50 @@ void PdmMic::Disable() {
   NRFX_IRQ_DISABLE(PDM_IRQn);
 }
 
-void PdmMic::GetData(int16_t *destination_array) {
-  memcpy(destination_array, pdm_buffer_[which_buffer_ready_],
-         kPdmDataSize * sizeof(int16_t));
+void PdmMic::SetBlockSize(int block_size) {
+  if (block_size < 1) {
+    block_size = 1;
+  } else if (block_size > kPdmDataSize) {
+    block_size = kPdmDataSize;
+  }
+  block_size_ = block_size;
+}
+
+void PdmMic::SetQueueDepth(int queue_depth) {
+  if (queue_depth < 1) {
+    queue_depth = 1;
+  } else if (queue_depth > kPdmMaxQueueDepth) {
+    queue_depth = kPdmMaxQueueDepth;
+  }
+  queue_depth_ = queue_depth;
+}
+
+bool PdmMic::GetData(int16_t *destination_array) {
+  const Block* block = queue_.Front();
+  if (block == nullptr) { return false; }
+  memcpy(destination_array, block->samples, block_size_ * sizeof(int16_t));
+  queue_.PopFront();
+  return true;
+}
+
+Slice<const int16_t> PdmMic::PeekData(uint32_t* timestamp) const {
+  const Block* block = queue_.Front();
+  if (block == nullptr) { return Slice<const int16_t>(); }
+  if (timestamp != nullptr) { *timestamp = block->timestamp; }
+  return Slice<const int16_t>(block->samples, block_size_);
+}
+
+int16_t* PdmMic::NextCaptureBuffer() {
+  // The current capture, if in the ring, is at BeginPush(), so the next is one
+  // slot ahead of it. Once complete, the next capture would be queued behind
+  // the current one and those already queued.
+  const int ahead = capture_in_ring_ ? 1 : 0;
+  Block* block = nullptr;
+  if (queue_.size() + ahead + 1 <= queue_depth_) {
+    block = queue_.BeginPushAhead(ahead);
+  }
+  next_capture_in_ring_ = (block != nullptr);
+  return next_capture_in_ring_ ? block->samples : scratch_;
 }
 
 void PdmMic::SetMicGain(int16_t gain) { nrf_pdm_gain_set(NRF_PDM, gain, gain); }
@@ -76,6 +127,16 @@ void PdmMic::IrqHandler() {
   // started.
   if (nrf_pdm_event_check(NRF_PDM, NRF_PDM_EVENT_END)) {
     nrf_pdm_event_clear(NRF_PDM, NRF_PDM_EVENT_END);
+    // The completed capture is queued in place if it was into the ring.
+    if (capture_in_ring_) {
+      queue_.BeginPush()->timestamp = timestamp_;
+      queue_.EndPush();
+    } else {
+      ++num_overruns_;  // The main loop fell behind; drop the block.
+    }
+    timestamp_ += block_size_;
+    // EasyDMA has moved on to the buffer set at the last STARTED event.
+    capture_in_ring_ = next_capture_in_ring_;
     event_ = true;
   }
 
@@ -83,13 +144,9 @@ void PdmMic::IrqHandler() {
   if (nrf_pdm_event_check(NRF_PDM, NRF_PDM_EVENT_STARTED)) {
     nrf_pdm_event_clear(NRF_PDM, NRF_PDM_EVENT_STARTED);
 
-    // PDM is naturally double buffered, so we need to take care of that.
-    // See where the buffer pointer is. If its at first buffer, set next pointer
-    // to second buffer and vise-versa.
-    const int i =
-        (nrf_pdm_buffer_get(NRF_PDM) == (uint32_t *)pdm_buffer_[0]) ? 1 : 0;
-    nrf_pdm_buffer_set(NRF_PDM, (uint32_t *)pdm_buffer_[i], kPdmDataSize);
-    which_buffer_ready_ = i;
+    // EasyDMA latched the buffer pointer, so chain the next capture by setting
+    // the pointer to the following buffer.
+    nrf_pdm_buffer_set(NRF_PDM, (uint32_t *)NextCaptureBuffer(), block_size_);
   }
 
   // PDM module is stopped.
@@ -20,6 +20,24 @@
 // The pdm driver was build using the nordic HAL interface. HAL description:
 // https://infocenter.nordicsemi.com/index.jsp?topic=%2Fcom.nordic.infocenter.sdk5.v12.0.0%2Fgroup__nrf__pdm__hal.html
 // Microphone sampling rate is 16 kHz.
+//
+// EasyDMA captures directly into a ring of kPdmRingSize blocks, chaining each
+// block to the next without copies: when a capture starts, the interrupt points
+// EasyDMA at the following free slot of the ring. Each completed block is
+// queued for the main loop with a timestamp, the sample index since Enable() of
+// its first sample. If the main loop stalls, up to queue_depth() blocks
+// accumulate, and it can catch up by processing them all. Beyond that, blocks
+// are captured into a scratch buffer and dropped, and counted in
+// num_overruns(). Dropped blocks show as gaps in the timestamps.
+//
+// Example use:
+//   // Process all queued blocks in place.
+//   uint32_t timestamp;
+//   Slice<const int16_t> block;
+//   while (!(block = OnBoardMic.PeekData(&timestamp)).empty()) {
+//     Process(block);
+//     OnBoardMic.ReleaseData();
+//   }
 
 #ifndef AUDIO_TO_TACTILE_SRC_PDM_H_
 #define AUDIO_TO_TACTILE_SRC_PDM_H_
@@ -27,20 +45,29 @@
 #include <stdint.h>
 
 #include "board_defs.h"  // NOLINT(build/include)
+#include "cpp/slice.h"  // NOLINT(build/include)
+#include "cpp/spsc_ring_buffer.h"  // NOLINT(build/include)
 #include "nrf_pdm.h"  // NOLINT(build/include)
 
 namespace audio_tactile {
 
 // Buffer constants.
 const int kPdmDataSize = 64;
-const int kNumberPdmBuffers = 2;
 
 class PdmMic {
  public:
   // Pdm buffer constants.
   enum {
     kPdmDataSize = 64,
-    kNumberPdmBuffers = 2,
+    // Number of blocks in the EasyDMA ring.
+    kPdmRingSize = 16,
+    // Max number of completed blocks that can be queued. Two ring slots are
+    // reserved for the block being captured and the next one.
+    kPdmMaxQueueDepth = kPdmRingSize - 2,
+    // Default number of completed blocks that can be queued. A deeper queue
+    // absorbs more main loop jitter without dropouts, at the cost of more
+    // latency when the main loop falls behind.
+    kPdmQueueDepth = 4,
   };
 
   // Initialize the PDM microphone.
@@ -49,8 +76,40 @@ class PdmMic {
   // Start audio data collection.
   void Enable();
 
-  // Get the mic data array. The data is updated automatically in IRQ.
-  void GetData(int16_t* destination_array);
+  // Sets the number of samples per block, between 1 and kPdmDataSize. A
+  // smaller block reduces latency at the cost of more frequent interrupts.
+  // Should be called after Initialize() and before Enable(). The default is
+  // kPdmDataSize.
+  void SetBlockSize(int block_size);
+  int block_size() const { return block_size_; }
+
+  // Sets the max number of completed blocks that can be queued, between 1 and
+  // kPdmMaxQueueDepth. Should be called before Enable(). The default is
+  // kPdmQueueDepth.
+  void SetQueueDepth(int queue_depth);
+  int queue_depth() const { return queue_depth_; }
+
+  // Gets the oldest queued block of block_size() mic samples. Blocks are
+  // queued automatically in IRQ. Returns false if no block is available, in
+  // which case `destination_array` is not modified.
+  bool GetData(int16_t* destination_array);
+
+  // Zero-copy alternative to GetData(). Gets the oldest queued block of
+  // block_size() mic samples directly in the ring, or an empty slice if no
+  // block is available. If `timestamp` is non-null, it is set to the index
+  // since Enable() of the block's first sample. The block stays valid until
+  // ReleaseData().
+  Slice<const int16_t> PeekData(uint32_t* timestamp = nullptr) const;
+
+  // Releases the block from PeekData(), returning its slot to EasyDMA. Must
+  // only be called when a block is available.
+  void ReleaseData() { queue_.PopFront(); }
+
+  // Number of queued blocks.
+  int num_queued() const { return queue_.size(); }
+
+  // Number of blocks dropped because the queue was full.
+  int num_overruns() const { return num_overruns_; }
 
   // Disable the PDM mic.
   void Disable();
@@ -70,15 +129,34 @@ class PdmMic {
   // Callback for the interrupt.
   void (*callback_)(void);
 
-  // Two PDM buffers are required, as they swapped after filling.
-  int16_t pdm_buffer_[kNumberPdmBuffers][kPdmDataSize];
+  // Gets the buffer for the capture after the current one: the next ring slot,
+  // or scratch_ if the queue is too full. Sets next_capture_in_ring_.
+  int16_t* NextCaptureBuffer();
+
+  // Ring of blocks. EasyDMA writes samples in place, and IrqHandler() queues
+  // them for GetData() and PeekData() when complete.
+  struct Block {
+    int16_t samples[kPdmDataSize];
+    uint32_t timestamp;
+  };
+  SpscRingBuffer<Block, kPdmRingSize> queue_;
+  // Capture buffer to use when the queue is full.
+  int16_t scratch_[kPdmDataSize];
+  // Whether the current and next EasyDMA captures are into the ring, rather
+  // than scratch_. The current capture is at BeginPush(), and the next is
+  // after it.
+  bool capture_in_ring_;
+  bool next_capture_in_ring_;
+  // Index of the first sample of the current capture.
+  uint32_t timestamp_;
+  int num_overruns_;
+  // Number of samples per block.
+  int block_size_;
+  int queue_depth_;
 
   // Storing interrupt event.
   bool event_;
 
-  // Which buffer is currently ready to read.
-  uint8_t which_buffer_ready_;
-
   // PDM hardware constants.
   enum {
     kPdmIrqPriority = 6,
@@ -15,9 +15,15 @@
 
 #include "phonetics/classify_phoneme.h"
 
+#include <math.h>
+#include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "phonetics/classify_phoneme_params.h"
+#include "phonetics/classify_phoneme_params_f16.h"
+#include "phonetics/classify_phoneme_params_int8.h"
+#include "phonetics/classify_phoneme_params_tiled.h"
 #include "phonetics/nn_ops.h"
 
 /* Constant names prefixed with "kClassifyPhoneme" are exposed in the .h file,
@@ -63,25 +69,13 @@ static float BinaryScore(int in_size,
   return out[1];
 }
 
-void ClassifyPhoneme(const float* frames, ClassifyPhonemeLabels* labels,
-                     ClassifyPhonemeScores* scores) {
-  float buffer1[kDense1Units];
-  float buffer2[kDense2Units];
-
-  /* Run the common portion of the network. */
-  DenseReluLayer(kInputUnits, kDense1Units, frames,
-                 kDense1Weights, kDense1Bias, buffer1);
-  DenseReluLayer(kDense1Units, kDense2Units, buffer1,
-                 kDense2Weights, kDense2Bias, buffer2);
-  /* We can reuse buffer1 for the output, since kDense3Units < kDense1Units. */
-  DenseReluLayer(kDense2Units, kDense3Units, buffer2,
-                 kDense3Weights, kDense3Bias, buffer1);
-
-  /* If needed, reuse buffer2 for phonemes; kPhonemeUnits < kDense2Units. */
-  float* phoneme_scores = (scores != NULL) ? scores->phoneme : buffer2;
-  DenseLinearLayer(kDense3Units, kPhonemeUnits, buffer1,
-                   kPhonemeWeights, kPhonemeBias, phoneme_scores);
-
+/* Computes labels and scores from the phoneme layer output. This is the part
+ * of the network shared by ClassifyPhoneme(), ClassifyPhonemeInt8(), and
+ * ClassifyPhonemeF16().
+ */
+static void ClassifyFromPhonemeLayer(float* phoneme_scores,
+                                     ClassifyPhonemeLabels* labels,
+                                     ClassifyPhonemeScores* scores) {
   if (labels != NULL) {  /* Hard classification labels were requested. */
     labels->phoneme = ScoreArgMax(phoneme_scores, kPhonemeUnits);
 
@@ -130,3 +124,293 @@ void ClassifyPhoneme(const float* frames, ClassifyPhonemeLabels* labels,
                                  kVoicedOutputWeights, kVoicedOutputBias);
   }
 }
+
+/* Runs the network from the output of the first dense layer. `buffer1` is
+ * overwritten as scratch.
+ */
+static void ClassifyFromDense1Layer(float* buffer1,
+                                    ClassifyPhonemeLabels* labels,
+                                    ClassifyPhonemeScores* scores) {
+  float buffer2[kDense2Units];
+
+  DenseReluLayer(kDense1Units, kDense2Units, buffer1,
+                 kDense2Weights, kDense2Bias, buffer2);
+  /* We can reuse buffer1 for the output, since kDense3Units < kDense1Units. */
+  DenseReluLayer(kDense2Units, kDense3Units, buffer2,
+                 kDense3Weights, kDense3Bias, buffer1);
+
+  /* If needed, reuse buffer2 for phonemes; kPhonemeUnits < kDense2Units. */
+  float* phoneme_scores = (scores != NULL) ? scores->phoneme : buffer2;
+  DenseLinearLayer(kDense3Units, kPhonemeUnits, buffer1,
+                   kPhonemeWeights, kPhonemeBias, phoneme_scores);
+  ClassifyFromPhonemeLayer(phoneme_scores, labels, scores);
+}
+
+void ClassifyPhoneme(const float* frames, ClassifyPhonemeLabels* labels,
+                     ClassifyPhonemeScores* scores) {
+  float buffer1[kDense1Units];
+
+  /* Run the common portion of the network. */
+  DenseReluLayer(kInputUnits, kDense1Units, frames,
+                 kDense1Weights, kDense1Bias, buffer1);
+  ClassifyFromDense1Layer(buffer1, labels, scores);
+}
+
+#if kClassifyPhonemeStreamerNumFrames != kNumFrames || \
+    kClassifyPhonemeStreamerNumChannels != kNumCarlChannels || \
+    kClassifyPhonemeStreamerHiddenUnits != kDense1Units
+#error "ClassifyPhonemeStreamer sizes must match the network."
+#endif
+
+/* Number of first-layer weights that apply to one frame of the window. */
+#define kTileSize (kNumCarlChannels * kDense1Units)
+
+#ifdef AUDIO_TO_TACTILE_CLASSIFY_PHONEME_RAM_TILE
+/* RAM copy of the tile for the newest window position, which is on the path
+ * between a frame's arrival and its labels. On devices like the nRF52 where
+ * the weights are in flash, this avoids flash wait states and cache misses on
+ * that path, so the latency is shorter and more predictable.
+ */
+static float g_newest_tile[kTileSize];
+static int g_newest_tile_ready = 0;
+#endif  /* AUDIO_TO_TACTILE_CLASSIFY_PHONEME_RAM_TILE */
+
+/* Gets the tile of first-layer weights for window position `position`. */
+static const float* GetTile(int position) {
+#ifdef AUDIO_TO_TACTILE_CLASSIFY_PHONEME_RAM_TILE
+  if (position == kNumFrames - 1) { return g_newest_tile; }
+#endif  /* AUDIO_TO_TACTILE_CLASSIFY_PHONEME_RAM_TILE */
+  return kDense1WeightsTiled + position * kTileSize;
+}
+
+void ClassifyPhonemeStreamerReset(ClassifyPhonemeStreamer* streamer) {
+  memset(streamer->partial_sums, 0, sizeof(streamer->partial_sums));
+  streamer->head = 0;
+#ifdef AUDIO_TO_TACTILE_CLASSIFY_PHONEME_RAM_TILE
+  if (!g_newest_tile_ready) {
+    memcpy(g_newest_tile, kDense1WeightsTiled + (kNumFrames - 1) * kTileSize,
+           sizeof(g_newest_tile));
+    g_newest_tile_ready = 1;
+  }
+#endif  /* AUDIO_TO_TACTILE_CLASSIFY_PHONEME_RAM_TILE */
+}
+
+/* Adds the first-layer contribution of `frame` in window position `position`
+ * to `out`, where position kNumFrames - 1 is the newest frame. The weights are
+ * read sequentially from the position's tile.
+ */
+static void AccumulateFrame(const float* frame, int position, float* out) {
+  const float* weights_col_j = GetTile(position);
+  int j;
+  for (j = 0; j < kDense1Units; ++j, weights_col_j += kNumCarlChannels) {
+    float sum = 0.0f;
+    int k;
+    for (k = 0; k < kNumCarlChannels; ++k) {
+      sum += frame[k] * weights_col_j[k];
+    }
+    out[j] += sum;
+  }
+}
+
+void ClassifyPhonemeStreamerProcessFrame(ClassifyPhonemeStreamer* streamer,
+                                         const float* frame,
+                                         ClassifyPhonemeLabels* labels,
+                                         ClassifyPhonemeScores* scores) {
+  float buffer1[kDense1Units];
+  float* current = streamer->partial_sums[streamer->head];
+  int j;
+
+  if (labels != NULL || scores != NULL) {
+    /* Complete the first layer with the new frame as the newest in the
+     * window.
+     */
+    AccumulateFrame(frame, kNumFrames - 1, current);
+    for (j = 0; j < kDense1Units; ++j) {
+      const float x = current[j] + kDense1Bias[j];
+      buffer1[j] = (x > 0.0f) ? x : 0.0f;
+    }
+  }
+
+  /* The consumed slot becomes the farthest future output. */
+  memset(current, 0, sizeof(float) * kDense1Units);
+  streamer->head = (streamer->head + 1) % kNumFrames;
+
+  if (labels != NULL || scores != NULL) {
+    ClassifyFromDense1Layer(buffer1, labels, scores);
+  }
+
+  /* Accumulate the frame's contributions to the next kNumFrames - 1 outputs,
+   * for which it is at window positions kNumFrames - 2, ..., 0.
+   */
+  int i;
+  for (i = 0; i < kNumFrames - 1; ++i) {
+    AccumulateFrame(frame, kNumFrames - 2 - i,
+                    streamer->partial_sums[(streamer->head + i) % kNumFrames]);
+  }
+}
+
+int /*bool*/ ClassifyPhonemeCascadeInit(ClassifyPhonemeCascade* cascade,
+                                        float change_threshold,
+                                        int max_hold_frames) {
+  if (cascade == NULL) {
+    return 0;
+  } else if (!(change_threshold >= 0.0f)) {
+    fprintf(stderr, "Error: change_threshold must be nonnegative.\n");
+    return 0;
+  } else if (max_hold_frames < 0) {
+    fprintf(stderr, "Error: max_hold_frames must be nonnegative.\n");
+    return 0;
+  }
+
+  cascade->change_threshold = change_threshold;
+  cascade->max_hold_frames = max_hold_frames;
+  ClassifyPhonemeCascadeReset(cascade);
+  return 1;
+}
+
+void ClassifyPhonemeCascadeReset(ClassifyPhonemeCascade* cascade) {
+  cascade->has_cached = 0;
+  cascade->num_held_frames = 0;
+  cascade->num_frames = 0;
+  cascade->num_gate_evaluations = 0;
+  cascade->num_full_evaluations = 0;
+}
+
+/* The gate: whether the mean absolute difference between the input window and
+ * the reference window is within `threshold`.
+ */
+static int /*bool*/ InputIsUnchanged(const float* frames,
+                                     const float* reference,
+                                     float threshold) {
+  const float max_total_diff = threshold * kInputUnits;
+  float total_diff = 0.0f;
+  int i;
+  for (i = 0; i < kInputUnits; ++i) {
+    total_diff += fabs(frames[i] - reference[i]);
+  }
+  return total_diff <= max_total_diff;
+}
+
+int /*bool*/ ClassifyPhonemeCascadeProcess(ClassifyPhonemeCascade* cascade,
+                                           const float* frames,
+                                           ClassifyPhonemeLabels* labels,
+                                           ClassifyPhonemeScores* scores) {
+  int /*bool*/ use_cached = 0;
+  ++cascade->num_frames;
+
+  if (cascade->has_cached &&
+      cascade->num_held_frames < cascade->max_hold_frames) {
+    ++cascade->num_gate_evaluations;
+    use_cached = InputIsUnchanged(frames, cascade->reference_frames,
+                                  cascade->change_threshold);
+  }
+
+  if (use_cached) {
+    ++cascade->num_held_frames;  /* Early exit with cached results. */
+  } else {
+    ClassifyPhoneme(frames, &cascade->cached_labels, &cascade->cached_scores);
+    memcpy(cascade->reference_frames, frames, sizeof(float) * kInputUnits);
+    cascade->has_cached = 1;
+    cascade->num_held_frames = 0;
+    ++cascade->num_full_evaluations;
+  }
+
+  if (labels != NULL) { *labels = cascade->cached_labels; }
+  if (scores != NULL) { *scores = cascade->cached_scores; }
+  return !use_cached;
+}
+
+/* Number of multiply-accumulates in the full network, neglecting the small
+ * output layers after the phoneme layer.
+ */
+#define kFullNetworkMacs                                                  \
+  (kInputUnits * kDense1Units + kDense1Units * kDense2Units +             \
+   kDense2Units * kDense3Units + kDense3Units * kPhonemeUnits)
+
+float ClassifyPhonemeCascadeAverageCost(const ClassifyPhonemeCascade* cascade) {
+  if (cascade->num_frames == 0) { return 0.0f; }
+  const double cost = cascade->num_full_evaluations +
+      (double)cascade->num_gate_evaluations * kInputUnits / kFullNetworkMacs;
+  return (float)(cost / cascade->num_frames);
+}
+
+/* Number of outputs computed together in ClassifyPhonemeBatch(). */
+#define kBatchSize 16
+
+void ClassifyPhonemeBatch(const float* frames, int num_outputs,
+                          ClassifyPhonemeLabels* labels,
+                          ClassifyPhonemeScores* scores) {
+  float buffer1[kBatchSize * kDense1Units];
+  float buffer2[kBatchSize * kDense2Units];
+  float phoneme_buffer[kBatchSize * kPhonemeUnits];
+  int start;
+
+  for (start = 0; start < num_outputs; start += kBatchSize) {
+    const int batch_size = (num_outputs - start < kBatchSize)
+        ? num_outputs - start : kBatchSize;
+    /* Consecutive inputs overlap, with a stride of one frame. */
+    const float* in = frames + start * kNumCarlChannels;
+    DenseReluLayerBatch(batch_size, kInputUnits, kNumCarlChannels,
+                        kDense1Units, in, kDense1Weights, kDense1Bias,
+                        buffer1);
+    DenseReluLayerBatch(batch_size, kDense1Units, kDense1Units, kDense2Units,
+                        buffer1, kDense2Weights, kDense2Bias, buffer2);
+    DenseReluLayerBatch(batch_size, kDense2Units, kDense2Units, kDense3Units,
+                        buffer2, kDense3Weights, kDense3Bias, buffer1);
+    DenseLinearLayerBatch(batch_size, kDense3Units, kDense3Units,
+                          kPhonemeUnits, buffer1, kPhonemeWeights,
+                          kPhonemeBias, phoneme_buffer);
+
+    int m;
+    for (m = 0; m < batch_size; ++m) {
+      float* phoneme_scores = phoneme_buffer + m * kPhonemeUnits;
+      ClassifyPhonemeScores* scores_m = NULL;
+      if (scores != NULL) {
+        scores_m = &scores[start + m];
+        memcpy(scores_m->phoneme, phoneme_scores,
+               kPhonemeUnits * sizeof(float));
+        phoneme_scores = scores_m->phoneme;
+      }
+      ClassifyFromPhonemeLayer(
+          phoneme_scores, (labels != NULL) ? &labels[start + m] : NULL,
+          scores_m);
+    }
+  }
+}
+
+void ClassifyPhonemeInt8(const float* frames, ClassifyPhonemeLabels* labels,
+                         ClassifyPhonemeScores* scores) {
+  float buffer1[kDense1Units];
+  float buffer2[kDense2Units];
+
+  DenseReluLayerInt8(kInputUnits, kDense1Units, frames, kDense1WeightsInt8,
+                     kDense1WeightScales, kDense1Bias, buffer1);
+  DenseReluLayerInt8(kDense1Units, kDense2Units, buffer1, kDense2WeightsInt8,
+                     kDense2WeightScales, kDense2Bias, buffer2);
+  DenseReluLayerInt8(kDense2Units, kDense3Units, buffer2, kDense3WeightsInt8,
+                     kDense3WeightScales, kDense3Bias, buffer1);
+
+  float* phoneme_scores = (scores != NULL) ? scores->phoneme : buffer2;
+  DenseLinearLayerInt8(kDense3Units, kPhonemeUnits, buffer1,
+                       kPhonemeWeightsInt8, kPhonemeWeightScales, kPhonemeBias,
+                       phoneme_scores);
+  ClassifyFromPhonemeLayer(phoneme_scores, labels, scores);
+}
+
+void ClassifyPhonemeF16(const float* frames, ClassifyPhonemeLabels* labels,
+                        ClassifyPhonemeScores* scores) {
+  float buffer1[kDense1Units];
+  float buffer2[kDense2Units];
+
+  DenseReluLayerF16(kInputUnits, kDense1Units, frames, kDense1WeightsF16,
+                    kDense1Bias, buffer1);
+  DenseReluLayerF16(kDense1Units, kDense2Units, buffer1, kDense2WeightsF16,
+                    kDense2Bias, buffer2);
+  DenseReluLayerF16(kDense2Units, kDense3Units, buffer2, kDense3WeightsF16,
+                    kDense3Bias, buffer1);
+
+  float* phoneme_scores = (scores != NULL) ? scores->phoneme : buffer2;
+  DenseLinearLayerF16(kDense3Units, kPhonemeUnits, buffer1,
+                      kPhonemeWeightsF16, kPhonemeBias, phoneme_scores);
+  ClassifyFromPhonemeLayer(phoneme_scores, labels, scores);
+}
@@ -113,6 +113,172 @@ extern const char* kClassifyPhonemePlaceNames[kClassifyPhonemeNumPlaces];
 void ClassifyPhoneme(const float* frames, ClassifyPhonemeLabels* labels,
                      ClassifyPhonemeScores* scores);
 
+/* Batched ClassifyPhoneme() for offline use, classifying `num_outputs`
+ * consecutive positions of a sliding window. `frames` is an array of
+ * `num_outputs + kClassifyPhonemeNumFrames - 1` consecutive CARL+PCEN frames
+ * (each of kClassifyPhonemeNumChannels values), and `labels` and `scores` are
+ * arrays of size `num_outputs`. The mth output is the same as
+ *
+ *   ClassifyPhoneme(frames + m * kClassifyPhonemeNumChannels,
+ *                   &labels[m], &scores[m]);
+ *
+ * Either of `labels` or `scores` may be NULL if that output isn't needed.
+ * Frames are computed in batches, which is faster than calling
+ * ClassifyPhoneme() per frame since each weight is reused across the batch.
+ */
+void ClassifyPhonemeBatch(const float* frames, int num_outputs,
+                          ClassifyPhonemeLabels* labels,
+                          ClassifyPhonemeScores* scores);
+
+/* Same as ClassifyPhoneme(), but the large weight matrices are int8-quantized
+ * and the dense layers use integer dot products (see DenseLinearLayerInt8() in
+ * nn_ops.h). Results are close to but not exactly the same as
+ * ClassifyPhoneme(). The int8 weights take a quarter of the memory; when only
+ * this function is used, the linker can discard the float weights provided the
+ * build garbage-collects unused data sections.
+ */
+void ClassifyPhonemeInt8(const float* frames, ClassifyPhonemeLabels* labels,
+                         ClassifyPhonemeScores* scores);
+
+/* Same as ClassifyPhoneme(), but the large weight matrices are stored in half
+ * precision (IEEE binary16) and converted to float as they are read (see
+ * DenseLinearLayerF16() in nn_ops.h). The weights take half the memory, and
+ * results are very close to ClassifyPhoneme(), since the only difference is
+ * rounding each weight to 11 significant bits. As with ClassifyPhonemeInt8(),
+ * the linker can discard the float weights when only this function is used.
+ */
+void ClassifyPhonemeF16(const float* frames, ClassifyPhonemeLabels* labels,
+                        ClassifyPhonemeScores* scores);
+
+/* Streaming classifier, for calling once per CARL+PCEN frame. Rather than
+ * keeping a window of the most recent frames that must be shifted for each new
+ * frame, the streamer keeps a ring of partial sums of the first dense layer.
+ * The first layer is linear before the ReLU, so each frame's contribution can
+ * be accumulated as soon as the frame arrives. When a frame arrives, only its
+ * contribution as the newest frame is needed before classifying; its
+ * contributions to the next 4 outputs are accumulated after. This takes the
+ * same total arithmetic as ClassifyPhoneme(), but avoids the frame copies and
+ * cuts the first-layer work between a frame's arrival and its labels by 5x.
+ *
+ * The first-layer weights are read from kDense1WeightsTiled, a copy laid out as
+ * one contiguous tile per window position, so that each tile is read
+ * sequentially rather than in strides. If the library is built with
+ * -DAUDIO_TO_TACTILE_CLASSIFY_PHONEME_RAM_TILE, the tile for the newest
+ * position (21 kB) is also copied to RAM on the first reset. This is useful on
+ * devices like the nRF52 where weights are in flash, making the time from a
+ * frame's arrival to its labels shorter and more predictable.
+ *
+ * Example use:
+ *   ClassifyPhonemeStreamer streamer;
+ *   ClassifyPhonemeStreamerReset(&streamer);
+ *
+ *   // Once per frame.
+ *   ClassifyPhonemeStreamerProcessFrame(&streamer, frame, &labels, &scores);
+ */
+#define kClassifyPhonemeStreamerNumFrames 5
+#define kClassifyPhonemeStreamerNumChannels 56
+#define kClassifyPhonemeStreamerHiddenUnits 96
+
+typedef struct {
+  /* Ring of first-layer partial sums. partial_sums[(head + i) % 5] holds the
+   * contributions so far to the output i frames in the future.
+   */
+  float partial_sums[kClassifyPhonemeStreamerNumFrames]
+                    [kClassifyPhonemeStreamerHiddenUnits];
+  int head;
+} ClassifyPhonemeStreamer;
+
+/* Resets the streamer to its initial state, as if all previous frames were
+ * zero. Call this before the first frame, and e.g. after a gap in the input.
+ */
+void ClassifyPhonemeStreamerReset(ClassifyPhonemeStreamer* streamer);
+
+/* Processes one CARL+PCEN `frame` of kClassifyPhonemeNumChannels values and
+ * classifies the phoneme in it. Up to float rounding, the result is the same as
+ * ClassifyPhoneme() on an array of the kClassifyPhonemeNumFrames most recent
+ * frames, where frames before the last reset are zero. Either of `labels` or
+ * `scores` may be NULL if that output isn't needed. If both are NULL, only the
+ * frame's contributions to future outputs are accumulated, which is cheaper,
+ * e.g. to catch up on a batch of frames where only the newest is reported.
+ */
+void ClassifyPhonemeStreamerProcessFrame(ClassifyPhonemeStreamer* streamer,
+                                         const float* frame,
+                                         ClassifyPhonemeLabels* labels,
+                                         ClassifyPhonemeScores* scores);
+
+/* Cascaded classification with early exit. Most frames are silence or steady
+ * sounds, over which the labels rarely change. A cheap gate runs first on each
+ * input window, measuring the mean absolute difference from the window at the
+ * last full evaluation. The full network runs only when the gate detects a
+ * change above `change_threshold`, or after `max_hold_frames` consecutive
+ * skipped frames; otherwise the cached labels and scores are returned. The
+ * gate costs kInputUnits operations, under 1% of the full network.
+ *
+ * Example use:
+ *   ClassifyPhonemeCascade cascade;
+ *   ClassifyPhonemeCascadeInit(&cascade,
+ *                              kClassifyPhonemeCascadeDefaultChangeThreshold,
+ *                              kClassifyPhonemeCascadeDefaultMaxHoldFrames);
+ *
+ *   // Once per frame, where `frames` is the kClassifyPhonemeNumFrames most
+ *   // recent frames as for ClassifyPhoneme().
+ *   ClassifyPhonemeCascadeProcess(&cascade, frames, &labels, &scores);
+ *
+ *   // Average cost as a fraction of running the full network every frame.
+ *   float cost = ClassifyPhonemeCascadeAverageCost(&cascade);
+ */
+#define kClassifyPhonemeCascadeDefaultChangeThreshold 0.02f
+#define kClassifyPhonemeCascadeDefaultMaxHoldFrames 8
+
+typedef struct {
+  /* Gate threshold on the mean absolute difference of the input window. */
+  float change_threshold;
+  /* Max number of consecutive frames to return cached results. */
+  int max_hold_frames;
+
+  /* Input window at the last full evaluation. */
+  float reference_frames[kClassifyPhonemeStreamerNumFrames *
+                         kClassifyPhonemeStreamerNumChannels];
+  /* Results of the last full evaluation. */
+  ClassifyPhonemeLabels cached_labels;
+  ClassifyPhonemeScores cached_scores;
+  /*bool*/ int has_cached;
+  /* Number of consecutive frames that returned cached results. */
+  int num_held_frames;
+
+  /* Stats for computing the average cost. */
+  long num_frames;
+  long num_gate_evaluations;
+  long num_full_evaluations;
+} ClassifyPhonemeCascade;
+
+/* Initializes the cascade. `change_threshold` must be nonnegative and
+ * `max_hold_frames` must be nonnegative; max_hold_frames = 0 disables early
+ * exit. Returns 1 on success, 0 on failure.
+ */
+int /*bool*/ ClassifyPhonemeCascadeInit(ClassifyPhonemeCascade* cascade,
+                                        float change_threshold,
+                                        int max_hold_frames);
+
+/* Resets the cached results and cost stats. */
+void ClassifyPhonemeCascadeReset(ClassifyPhonemeCascade* cascade);
+
+/* Classifies the input window like ClassifyPhoneme(), returning cached results
+ * if the gate finds the input unchanged. Either of `labels` or `scores` may be
+ * NULL if that output isn't needed. Returns 1 if the full network was
+ * evaluated, 0 if cached results were returned.
+ */
+int /*bool*/ ClassifyPhonemeCascadeProcess(ClassifyPhonemeCascade* cascade,
+                                           const float* frames,
+                                           ClassifyPhonemeLabels* labels,
+                                           ClassifyPhonemeScores* scores);
+
+/* Returns the average cost per frame since the last reset, including the gate,
+ * as a fraction of the cost of running the full network on every frame. Returns
+ * 0 if no frames have been processed.
+ */
+float ClassifyPhonemeCascadeAverageCost(const ClassifyPhonemeCascade* cascade);
+
 #ifdef __cplusplus
 }  /* extern "C" */
 #endif
@@ -0,0 +1,4083 @@
+/* Copyright 2020 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * Half-precision weights for the phoneme classifier network, used by
+ * ClassifyPhonemeF16(). Each weight matrix in classify_phoneme_params.h is
+ * stored as IEEE 754 binary16 bit patterns, rounded to nearest,
+ *
+ *   kDense1Weights[i] ~= Float16ToFloat(kDense1WeightsF16[i]),
+ *
+ * and similarly for the other layers. Biases and the small output layers are
+ * taken from classify_phoneme_params.h. This file can be regenerated with
+ * extras/python/phonetics/export_model_as_c_data.py using --float16.
+ */
+
+#ifndef AUDIO_TO_TACTILE_SRC_PHONETICS_CLASSIFY_PHONEME_PARAMS_F16_H_
+#define AUDIO_TO_TACTILE_SRC_PHONETICS_CLASSIFY_PHONEME_PARAMS_F16_H_
+
+#include <stdint.h>
+
+#include "phonetics/classify_phoneme_params.h"
+
+static const uint16_t kDense1WeightsF16[kInputUnits * kDense1Units] = {0x32d2,
+    0x30e3, 0x2c56, 0xa6a9, 0xac40, 0xabaa, 0xa8c3, 0x102b, 0x223d, 0xa4d7,
+    0xaa57, 0xac68, 0xad70, 0xac23, 0x27e5, 0x2f55, 0x2ebf, 0x2963, 0x95af,
+    0xa849, 0xafbf, 0xb3bf, 0xb3d5, 0xae00, 0x2d5d, 0x32a6, 0x34b7, 0x3562,
+    0x34c4, 0x322c, 0x2ecd, 0x2a12, 0x23b4, 0x225e, 0x2b86, 0x2b55, 0xa516,
+    0xac38, 0xaa8c, 0x9a1c, 0x1c87, 0x1a8f, 0xa8ef, 0xae28, 0xae8e, 0xa5d7,
+    0xa97c, 0xad95, 0xac0c, 0xa693, 0xa023, 0x24ef, 0x2a1e, 0x2c0e, 0x2285,
+    0xaa57, 0x3057, 0x2d7a, 0x2588, 0xa9aa, 0xac22, 0xab54, 0xa97f, 0x1882,
+    0x28bb, 0x242c, 0xa6bd, 0xab43, 0xacd2, 0xac56, 0xa145, 0x2953, 0x2870,
+    0x1af0, 0x9ccb, 0x9eed, 0xa9bd, 0xad59, 0xa2ff, 0x30af, 0x3432, 0x3491,
+    0x3426, 0x31fe, 0x28ed, 0xaedd, 0xb109, 0xb0c6, 0xafb7, 0xac87, 0x2317,
+    0x2a1f, 0xa12e, 0xab48, 0xa9c0, 0xa1bd, 0x936a, 0x21f8, 0xa466, 0xab10,
+    0xab6f, 0x9aa1, 0xa996, 0xac77, 0xa2f6, 0x2c05, 0x2c8c, 0x2c5d, 0x2c34,
+    0x2c3d, 0x9d14, 0xac55, 0x21b2, 0xa5f4, 0xabce, 0xad5f, 0xac35, 0xa8ce,
+    0xa572, 0x25a3, 0x2c59, 0x2ad6, 0x9d60, 0xaa8b, 0xac7d, 0xac3a, 0xa868,
+    0x9630, 0x17f9, 0x9d31, 0x8f70, 0x2305, 0x26f0, 0x2ceb, 0x32eb, 0x35e9,
+    0x3662, 0x34d1, 0x311e, 0x9094, 0xb298, 0xb5c4, 0xb5f9, 0xb4f1, 0xb33a,
+    0xafd8, 0x1ba8, 0x2cbc, 0x2938, 0x9450, 0x9ad8, 0x9c96, 0x976d, 0x27c4,
+    0x24ee, 0x184e, 0x94fc, 0x2782, 0xa7e1, 0xa970, 0x1045, 0x2c95, 0x2dda,
+    0x2d37, 0x2c70, 0x2a51, 0xa920, 0xae38, 0xb098, 0xb17e, 0xb200, 0xb174,
+    0xae9f, 0xa837, 0x1ac8, 0x2a6b, 0x2ed3, 0x2e3d, 0x25df, 0xa8c4, 0xa9c4,
+    0xa518, 0x23cf, 0x2a6b, 0x2c6c, 0x2c7b, 0x2c16, 0x2d5e, 0x30d6, 0x348c,
+    0x3752, 0x3840, 0x3669, 0x30bb, 0xadd0, 0xb471, 0xb73f, 0xb87a, 0xb837,
+    0xb6ca, 0xb4e8, 0xb144, 0x9488, 0x2e77, 0x2d7e, 0x2acb, 0x2a14, 0x2433,
+    0x1c76, 0x2acf, 0x2c05, 0x2bcc, 0x2b97, 0x2d0b, 0x252e, 0x288e, 0x29d1,
+    0x2c51, 0x2d2f, 0x2c50, 0x2b0b, 0x24f4, 0xacbf, 0xaf36, 0xb209, 0xb36d,
+    0xb420, 0xb371, 0xb070, 0xa781, 0x28c8, 0x2e19, 0x3124, 0x310b, 0x2d29,
+    0x265d, 0x2888, 0x2dba, 0x3107, 0x3338, 0x3436, 0x33ce, 0x3217, 0x320c,
+    0x348f, 0x376d, 0x38f6, 0x3877, 0x32de, 0xb351, 0xb871, 0xb9b8, 0xba5e,
+    0xba8c, 0xb9df, 0xb8c7, 0xb753, 0xb4ad, 0xae80, 0x256b, 0x254e, 0x9655,
+    0x9ff8, 0xa9f3, 0xaacf, 0x235a, 0x2937, 0x29ac, 0x2878, 0x2b93, 0x275f,
+    0x2cdf, 0x2b21, 0x20fe, 0x9d35, 0xa506, 0xa47e, 0xa832, 0xae78, 0xaf3c,
+    0x3262, 0x3283, 0x31cf, 0x30cc, 0x2de6, 0x28af, 0x19d3, 0x9909, 0xa60b,
+    0xa967, 0xa72d, 0x9b2c, 0xa192, 0xa82e, 0xac77, 0xb105, 0xb463, 0xb52e,
+    0xb3f1, 0xaf24, 0xa6fb, 0xab7d, 0xb184, 0xb3cc, 0xb1cd, 0xa9a9, 0x2a64,
+    0x2b5d, 0x29d5, 0x2c0d, 0x2d51, 0x2d8d, 0x2aa4, 0xa2f4, 0xaeb9, 0xb295,
+    0xb471, 0xb451, 0xb29a, 0xb0d8, 0xac81, 0xa8c1, 0x8bab, 0x2947, 0x2e51,
+    0x2e3e, 0x2418, 0x26d6, 0x2839, 0xa7a0, 0xa952, 0x9e6b, 0xac3b, 0xb0f5,
+    0xaff8, 0xa8b9, 0x2d41, 0x2db8, 0x2d19, 0x2c78, 0x2908, 0x2225, 0x9efc,
+    0xa0eb, 0xa529, 0xa31f, 0x2713, 0x2c50, 0x2b0c, 0x2367, 0xa7ac, 0xad74,
+    0xb081, 0xb0b9, 0xac05, 0x2ca8, 0x310a, 0x2fd4, 0x9f82, 0xaeb9, 0xabdd,
+    0x2d31, 0x3251, 0x333f, 0x32d6, 0x327d, 0x3232, 0x3184, 0x2ee5, 0x2403,
+    0xacd9, 0xb0c1, 0xb173, 0xaf75, 0xa88c, 0x148e, 0x2ae1, 0x2ae2, 0x292d,
+    0x27db, 0x2ac5, 0x2991, 0xa4f7, 0xa46c, 0xa77b, 0xac8c, 0xaa2c, 0xa1ef,
+    0xac3f, 0xb030, 0xacdf, 0x2525, 0xa909, 0xa5f5, 0xa23a, 0x1c3e, 0x25ca,
+    0x295f, 0x28ea, 0x2458, 0xa10a, 0x1eee, 0x2c9a, 0x3005, 0x2ef7, 0x29b2,
+    0xa55d, 0xab93, 0xac07, 0xa803, 0x2b16, 0x3166, 0x3330, 0x315c, 0x2633,
+    0xad74, 0xa99b, 0x2fa8, 0x3465, 0x355d, 0x351f, 0x3461, 0x335d, 0x3234,
+    0x2ed6, 0xa217, 0xae8a, 0xb0e2, 0xb09e, 0xaac1, 0x2ae0, 0x2d8c, 0x2f89,
+    0x2d62, 0x273d, 0xa5ae, 0xa679, 0xa893, 0xad06, 0xad7f, 0xaea5, 0xb001,
+    0xacba, 0xa46e, 0xaa74, 0xacdb, 0x2736, 0x30e8, 0xb0f3, 0xb026, 0xaeba,
+    0xac68, 0x9e62, 0x2a60, 0x2bd3, 0x27cb, 0xa3b2, 0x9ff6, 0x2c1e, 0x3018,
+    0x2f44, 0x2908, 0xa8df, 0xac27, 0xa90a, 0x1a4b, 0x2c41, 0x3040, 0x3040,
+    0x26d7, 0xb0b5, 0xb45c, 0xb391, 0xaaf5, 0x30c9, 0x3471, 0x351c, 0x34bb,
+    0x3426, 0x33de, 0x316b, 0x286d, 0xacfc, 0xb0bd, 0xb0c3, 0xa929, 0x2dd2,
+    0x306d, 0x31bb, 0x300d, 0x2a5e, 0xa2d9, 0xa94d, 0xad31, 0xafb4, 0xafa3,
+    0xb009, 0xb0aa, 0xad9a, 0xa631, 0xa80a, 0x2337, 0x31f4, 0x3592, 0xb4c9,
+    0xb40d, 0xb2cb, 0xb112, 0xacc0, 0x9ed0, 0x1e45, 0xa82a, 0xae02, 0xae66,
+    0xa7cc, 0x290d, 0x2782, 0xaa00, 0xb021, 0xb0f3, 0xaff9, 0xae2f, 0xaca6,
+    0xaaf2, 0xae6b, 0xb3e7, 0xb749, 0xb8db, 0xb8a3, 0xb607, 0xaf65, 0x2f4d,
+    0x34a1, 0x35df, 0x3660, 0x3708, 0x3610, 0x32ab, 0x284a, 0xaec4, 0xb0f1,
+    0xaa97, 0x2efc, 0x323a, 0x344d, 0x32e4, 0x2f49, 0x254b, 0xab1d, 0xb0eb,
+    0xb287, 0xb1c2, 0xb18b, 0xb2a7, 0xb0e6, 0xad63, 0xaae1, 0x2c9d, 0x351b,
+    0x381e, 0x2a84, 0x2da6, 0x2e3c, 0x2d28, 0x2ae7, 0x287a, 0x28f1, 0x1d3a,
+    0xa5c1, 0x9f59, 0x25e8, 0x2916, 0x24fc, 0xa8f5, 0xb032, 0xb1c9, 0xaff1,
+    0xa8cc, 0x27d6, 0x2e0e, 0x3030, 0x30ae, 0x2f6f, 0x2c24, 0x2e19, 0x327f,
+    0x355c, 0x3717, 0x369c, 0x33a3, 0xa2fb, 0xb334, 0xb525, 0xb50c, 0xb37c,
+    0xb0d0, 0xaf79, 0xb003, 0xb01d, 0xb085, 0xae5b, 0xaca6, 0xb09b, 0xaeb2,
+    0xa83b, 0xa23e, 0x20b1, 0x2ee9, 0x3060, 0x3276, 0x3435, 0x33ee, 0x31ab,
+    0x2c6f, 0x29e1, 0xa4d9, 0xaa15, 0x98d1, 0x2576, 0x268f, 0x24f2, 0x2465,
+    0x263f, 0xa3c1, 0xab58, 0xa9b2, 0x0e18, 0x2969, 0x29cb, 0x9ea5, 0xaf0c,
+    0xb21a, 0xb1f7, 0xb0d2, 0xaf5d, 0xac98, 0xab29, 0xac0f, 0xae73, 0xb085,
+    0xad82, 0x2c46, 0x346e, 0x37c8, 0x3889, 0x377b, 0x3438, 0x2c0d, 0xad34,
+    0xb0b9, 0xafd5, 0xad3e, 0xac50, 0xab60, 0xa824, 0xa96d, 0x9f8c, 0x28ae,
+    0x23c7, 0x258b, 0x2723, 0x166b, 0xa6e0, 0x294c, 0x294c, 0x261d, 0x28fd,
+    0x2978, 0x260f, 0x1de3, 0x25f2, 0x972c, 0xb1a8, 0xae93, 0xaa56, 0xa278,
+    0x22a5, 0x2739, 0x281e, 0x9b39, 0xaa02, 0xa7ef, 0x275a, 0x2ceb, 0x2c37,
+    0x1840, 0xad28, 0xb02b, 0xb016, 0xaf2d, 0xae1e, 0xac83, 0xac76, 0xadaf,
+    0xb06a, 0xb2d6, 0xb32e, 0xb011, 0x2db5, 0x360b, 0x3890, 0x3855, 0x3612,
+    0x3254, 0x2900, 0xaa90, 0xa9ca, 0xa6b2, 0xa671, 0xa33e, 0x22d1, 0x20ac,
+    0x27cf, 0x2b5f, 0x2d17, 0x2cfe, 0x2a1e, 0x2280, 0xa8d3, 0xa4c8, 0xa85e,
+    0xac81, 0xad8f, 0xac0d, 0xaa4b, 0xa9c1, 0x9966, 0x298f, 0xb408, 0xb090,
+    0xaa55, 0x22c9, 0x2af0, 0x2c5a, 0x29bb, 0x9eec, 0xaa11, 0xa729, 0x289f,
+    0x2db6, 0x2caf, 0x1c1d, 0xaa4b, 0xa9e6, 0x9dda, 0x2197, 0x197e, 0x0f14,
+    0xa0b1, 0xa7d1, 0xae5f, 0xb3f3, 0xb666, 0xb767, 0xb593, 0xab9e, 0x3384,
+    0x356e, 0x34b4, 0x329e, 0x3024, 0x2dc6, 0x2e9b, 0x2e39, 0x2d48, 0x2c46,
+    0x2917, 0x1859, 0x9006, 0x99e1, 0x251e, 0x2617, 0x257f, 0x24de, 0xa8b0,
+    0xab51, 0xae8c, 0xb00f, 0xb0af, 0xae56, 0xac32, 0xabf4, 0xa28b, 0x2ded,
+    0xb08c, 0xaaf5, 0x2936, 0x2f70, 0x3168, 0x31aa, 0x3001, 0x293c, 0xa411,
+    0x19af, 0x2cc1, 0x3064, 0x2fea, 0x29cb, 0x215a, 0x2b35, 0x2e17, 0x2a47,
+    0xa86b, 0xadc4, 0xafc2, 0xb0e7, 0xb437, 0xb81f, 0xbaa5, 0xbc4a, 0xbc5b,
+    0xbaa4, 0xb6dd, 0xafc0, 0x2b1b, 0x3118, 0x33b9, 0x34fc, 0x35cc, 0x3562,
+    0x3472, 0x325d, 0x2d73, 0x9b1f, 0xa65d, 0xa651, 0x21ee, 0x2969, 0x2e6e,
+    0x2fee, 0x288d, 0xaa04, 0xb071, 0xb106, 0xb04d, 0xaa97, 0x9ce3, 0xa561,
+    0x2505, 0x30d7, 0xa9d6, 0xac52, 0xaee5, 0xb13b, 0xb2cf, 0xb399, 0xb2b3,
+    0xb069, 0xac96, 0xac6f, 0xb003, 0xb0a6, 0xab37, 0x2e1f, 0x3213, 0x3113,
+    0x2e08, 0x2e76, 0x309a, 0x30b3, 0x2ec0, 0x2d33, 0x2d58, 0x2bd9, 0x2091,
+    0xa8c7, 0xaca6, 0xaffc, 0xb243, 0xb3af, 0xb309, 0xb199, 0xb0f3, 0xb174,
+    0xb23c, 0xb264, 0xb1d3, 0xb0a2, 0xace2, 0x9da6, 0x297d, 0x3139, 0x3357,
+    0x32c7, 0x3309, 0x337d, 0x302a, 0x1d03, 0xa31c, 0xab03, 0xaec9, 0xaf09,
+    0xb070, 0xb426, 0xb315, 0xae39, 0xa3a6, 0xa808, 0xabfc, 0xaf03, 0xb110,
+    0xb20e, 0xb178, 0xaeed, 0xa9dc, 0xa853, 0xac4f, 0xac7e, 0x2181, 0x3040,
+    0x3209, 0x2f91, 0x25c8, 0x2362, 0x2c56, 0x2edd, 0x2f75, 0x304c, 0x30ee,
+    0x3033, 0x2cf1, 0x2859, 0x1b82, 0xa995, 0xae78, 0xaf7f, 0xac48, 0x998b,
+    0x268a, 0x1f68, 0xa8a4, 0xac23, 0xac42, 0xaa09, 0x1a66, 0x2c5a, 0x2dc9,
+    0x30e7, 0x31e3, 0x30fb, 0x30fe, 0x31e1, 0x2f53, 0x22cb, 0x2495, 0x1f78,
+    0xa746, 0xa2d4, 0xa6ed, 0xb0cf, 0xaf72, 0x9f1f, 0xa4b7, 0xa676, 0xa98b,
+    0xacf5, 0xafd0, 0xb108, 0xb0d2, 0xae6b, 0xaa18, 0xa7cb, 0xa9c3, 0xa868,
+    0x2840, 0x2fa8, 0x3045, 0x26b4, 0xae68, 0xaff1, 0xaaba, 0x28f1, 0x2f9b,
+    0x3266, 0x33dd, 0x32b3, 0x3025, 0x2c59, 0x25a1, 0xa9a4, 0xaf66, 0xafc7,
+    0xa9a2, 0x2a60, 0x2e5f, 0x2dd9, 0x294f, 0x9cea, 0xa68b, 0xa65e, 0x21c7,
+    0x2c6e, 0x2cc4, 0x2e2b, 0x2f04, 0x2d82, 0x2cdb, 0x2e2f, 0x29be, 0xa983,
+    0x1cb7, 0x293a, 0x244d, 0x2a4c, 0x2bf0, 0xa91f, 0x17c8, 0x2e7b, 0x94af,
+    0x98de, 0xa28b, 0xa96a, 0xad98, 0xb00d, 0xb023, 0xadd6, 0xaad0, 0xa91c,
+    0xa9f0, 0xa864, 0x2194, 0x2b6f, 0x28c2, 0xad9b, 0xb331, 0xb408, 0xb10d,
+    0xa153, 0x30c3, 0x34c8, 0x35ef, 0x3501, 0x31dc, 0x2c70, 0xa4b0, 0xaf4b,
+    0xb285, 0xb2a2, 0xaece, 0x25ec, 0x2ec4, 0x2f91, 0x2cb2, 0x2453, 0xa2ca,
+    0x9f7b, 0x29f3, 0x2fe2, 0x309d, 0x30d1, 0x30a6, 0x2f1b, 0x2d11, 0x2d13,
+    0x2279, 0xadab, 0xa56d, 0x2ac1, 0x2873, 0x2c9e, 0x2f63, 0x29d3, 0x2efd,
+    0x32b3, 0x2a1e, 0x29d1, 0x2866, 0x113c, 0xaa9a, 0xae9d, 0xafe9, 0xaeac,
+    0xada7, 0xadfc, 0xaf24, 0xaf25, 0xad7b, 0xac1f, 0xae83, 0xb312, 0xb590,
+    0xb5d7, 0xb3f0, 0xab17, 0x3152, 0x35e9, 0x374f, 0x35ef, 0x31e4, 0x2147,
+    0xafbd, 0xb3b6, 0xb560, 0xb53a, 0xb27a, 0xa92f, 0x2d02, 0x2f95, 0x2dc3,
+    0x2933, 0x25b0, 0x2aac, 0x306d, 0x3402, 0x34e8, 0x3507, 0x347b, 0x32a9,
+    0x3052, 0x2ebc, 0x24c3, 0xae65, 0xa878, 0x2bd1, 0x29a2, 0x2ce6, 0x306b,
+    0x2ed9, 0x322e, 0x34bb, 0xaa85, 0xa959, 0xa8db, 0x9c85, 0x2af6, 0x2f7c,
+    0x2f65, 0x2bf6, 0x9dab, 0xa656, 0x2251, 0x2b97, 0x2d8e, 0x2cc5, 0x2911,
+    0x292a, 0x2ce4, 0x2f7a, 0x3155, 0x3217, 0x3083, 0x2cf6, 0x2c07, 0x2d5b,
+    0x2e77, 0x2f59, 0x303a, 0x30b7, 0x31de, 0x32d0, 0x3305, 0x32f3, 0x34f4,
+    0x3715, 0x3842, 0x38a9, 0x3922, 0x3966, 0x386f, 0x350e, 0x2dc3, 0xb065,
+    0xb6fc, 0xb962, 0xba02, 0xb971, 0xb850, 0xb639, 0xb40a, 0xb29c, 0xad2f,
+    0x2fbf, 0x33b2, 0x351d, 0x3756, 0x39b4, 0xac5e, 0xacee, 0xadde, 0xad10,
+    0xa7f3, 0x2298, 0x2705, 0x20d2, 0xa9e9, 0xac7d, 0xa941, 0x1305, 0x27b2,
+    0x266e, 0x9f24, 0xa4b5, 0x995e, 0x261a, 0x2c78, 0x2e66, 0x2c49, 0x23b8,
+    0x1e61, 0x2847, 0x29ba, 0x27a2, 0x1d16, 0xa608, 0xa685, 0x9cec, 0x2044,
+    0x214c, 0x2dc7, 0x3236, 0x3408, 0x3457, 0x34ff, 0x3583, 0x33e3, 0x2c5b,
+    0xacd2, 0xb2b0, 0xb65d, 0xb840, 0xb88b, 0xb831, 0xb6bb, 0xb4c8, 0xb26b,
+    0xb254, 0xb073, 0x0c81, 0x2dda, 0x3120, 0x3456, 0x37c6, 0xa085, 0xa8e8,
+    0xacd2, 0xacff, 0xa9d8, 0xa52e, 0x0086, 0x99ff, 0xab2e, 0xad57, 0xac2d,
+    0xa8d4, 0xa5dc, 0xa83e, 0xace3, 0xaefd, 0xaeb7, 0xac3b, 0x1c03, 0x2aa2,
+    0x26c7, 0xa82d, 0xaac8, 0xa6fb, 0xa2dc, 0xa686, 0xa964, 0xacb4, 0xae89,
+    0xae43, 0xad3e, 0xadad, 0xa80b, 0x2b42, 0x2ea6, 0x2f1c, 0x3117, 0x32e7,
+    0x3134, 0x2c16, 0x952d, 0xab42, 0xb0e6, 0xb2e4, 0xb3e6, 0xb435, 0xb3bb,
+    0xb172, 0xaecc, 0xafa9, 0xaf40, 0xabe9, 0xa8b1, 0x228b, 0x2cf1, 0x3316,
+    0x30f8, 0x2e1f, 0x2626, 0x996b, 0x20ee, 0x2531, 0x2898, 0x26e7, 0xa69e,
+    0xa936, 0xa4af, 0x1fa5, 0x24c7, 0x2047, 0xaad0, 0xaff6, 0xb072, 0xaddc,
+    0x1151, 0x2cb2, 0x2abb, 0xa808, 0xace5, 0xab10, 0xa722, 0xa4c9, 0xa307,
+    0xa93f, 0xad91, 0xaeaa, 0xae2e, 0xb001, 0xaf98, 0xac85, 0xa9e5, 0xaae9,
+    0x215c, 0x3023, 0x3147, 0x30dc, 0x3083, 0x301b, 0x2d0b, 0x2bea, 0x2849,
+    0xaa3d, 0xaeed, 0xae00, 0xabec, 0xaa9c, 0xa9fc, 0xac7b, 0xafdd, 0xaea4,
+    0xace2, 0x1b64, 0x3520, 0x3445, 0x31b4, 0x2f65, 0x2d33, 0x2a67, 0x2975,
+    0x2475, 0xaa3f, 0xabbf, 0xa52d, 0x286f, 0x2cc7, 0x2daf, 0x287f, 0xab91,
+    0xaeac, 0xac47, 0x28f2, 0x3044, 0x2fa0, 0x24ef, 0xa88e, 0xa20c, 0x238d,
+    0x247c, 0x247a, 0xa537, 0xadcc, 0xb00b, 0xafbc, 0xb138, 0xb27c, 0xb243,
+    0xb22f, 0xb248, 0xae62, 0x2ddd, 0x3313, 0x345c, 0x34ba, 0x3523, 0x34c3,
+    0x34ab, 0x3409, 0x2ed7, 0xa6ed, 0xacd1, 0xac0e, 0xa3c8, 0x21b0, 0xabea,
+    0xb1e7, 0xb256, 0xb184, 0xafa5, 0x3247, 0x2e78, 0x2192, 0xab12, 0xac64,
+    0xa8a3, 0x9daf, 0x180e, 0x9981, 0x9e07, 0x9ca1, 0x28f2, 0x2ec5, 0x2f2f,
+    0x2c9d, 0x2892, 0x9901, 0xacba, 0xb0f1, 0xb0a9, 0x1b08, 0x3161, 0x3191,
+    0xab78, 0xb6a2, 0xb981, 0xb9f0, 0xb8ad, 0xb45b, 0x2c5b, 0x34ac, 0x35a1,
+    0x35ce, 0x3517, 0x33ae, 0x331e, 0x3182, 0x2a8e, 0xa88e, 0xafb4, 0xae64,
+    0x9dc8, 0x97d8, 0x29ba, 0x2e98, 0x2657, 0xa29d, 0xaaa9, 0xa8f6, 0xa91c,
+    0xa807, 0xad54, 0xaf45, 0xaac2, 0xa831, 0x2adb, 0x3249, 0x2ede, 0x25d7,
+    0xa8ea, 0xac1e, 0xaa48, 0xa64e, 0xa6a6, 0xa991, 0xabfb, 0xac99, 0xa8d8,
+    0x27e4, 0x2a76, 0x251d, 0xa368, 0xaaa5, 0xaec1, 0xb11a, 0xb09e, 0xa624,
+    0x2e2c, 0x2d9b, 0xad8e, 0xb4f1, 0xb667, 0xb4ce, 0xad7f, 0x30f2, 0x3540,
+    0x35da, 0x348c, 0x334a, 0x312a, 0x2cac, 0x2a49, 0x9f1d, 0xacd5, 0xaa65,
+    0xa998, 0xa6b3, 0x2794, 0x1472, 0x1385, 0x24e1, 0xa851, 0xa511, 0xaa59,
+    0xa991, 0xa503, 0x1ad7, 0xa597, 0xa676, 0x9db5, 0xa8d1, 0x1ef8, 0x33b0,
+    0x3101, 0x2d17, 0x25ed, 0x9f91, 0x1d19, 0x26a4, 0x1fc0, 0xa8c3, 0xaced,
+    0xae18, 0xac6b, 0x9dfc, 0x22f9, 0xa6db, 0xacb7, 0xaedf, 0xb026, 0xb08b,
+    0xafc0, 0xac2b, 0xa962, 0xae49, 0xb28f, 0xb441, 0xb130, 0x2d5a, 0x3544,
+    0x37c4, 0x3831, 0x36de, 0x33a3, 0x2f67, 0x24e7, 0xacfa, 0xae19, 0xb00a,
+    0xb072, 0xa8a0, 0x234e, 0x2572, 0x2c28, 0x1e32, 0xa44a, 0xa44f, 0xac77,
+    0xa91e, 0xaa22, 0xa960, 0xa5a2, 0x2448, 0x2544, 0x29b3, 0x2a62, 0x9bcb,
+    0x270e, 0x306c, 0x2ae5, 0xa07a, 0xa894, 0xa7e7, 0x25dd, 0x2b92, 0x2837,
+    0xa815, 0xad8c, 0xaed0, 0xad12, 0xa629, 0xa709, 0xae4d, 0xb0e6, 0xb0e1,
+    0xae78, 0xa9be, 0xa756, 0xaaf9, 0xaff8, 0xb252, 0xb2ce, 0xafc3, 0x2f0f,
+    0x3627, 0x3855, 0x3843, 0x3696, 0x3277, 0xab0d, 0xb239, 0xb3e9, 0xb41d,
+    0xb186, 0xaed0, 0xab87, 0x2c63, 0x2f3d, 0x2cd4, 0x2e93, 0x27dd, 0x1649,
+    0x21f3, 0xaa89, 0xa811, 0xa95d, 0xaaaa, 0xa911, 0x0c53, 0x1b90, 0x2844,
+    0x288f, 0x8c36, 0x2cb7, 0x319c, 0x26e7, 0xadb6, 0xb003, 0xadf4, 0x20ac,
+    0x2e15, 0x2e0d, 0x2660, 0xa9c6, 0xac77, 0xa697, 0x297b, 0x2767, 0xab7d,
+    0xae9e, 0xa9bc, 0x2f0e, 0x33c3, 0x3394, 0x2fba, 0x9e26, 0xa8f2, 0x2bb4,
+    0x3408, 0x37ca, 0x3907, 0x384b, 0x333a, 0xb09c, 0xb7f4, 0xba12, 0xba6a,
+    0xb991, 0xb836, 0xb4a3, 0xaf8b, 0xa843, 0x2c99, 0x2e62, 0x2a0a, 0x2d0a,
+    0x2af1, 0x2b71, 0x2e1a, 0x2d03, 0x2fb6, 0x2daa, 0x24d5, 0xa15a, 0x2094,
+    0x9c47, 0x1853, 0x1dfe, 0xa141, 0x2e60, 0x30c9, 0x3148, 0x308b, 0x2c55,
+    0xaa2d, 0xb0ab, 0xb1bb, 0xb290, 0xb3f1, 0xb3b6, 0xb18d, 0xae6a, 0xa99b,
+    0xa5a1, 0xa5ad, 0x21fc, 0x2da6, 0x3049, 0x2e25, 0x1f41, 0xabf2, 0xa9c3,
+    0x29ea, 0x30cc, 0x3332, 0x3474, 0x3530, 0x358c, 0x3593, 0x3579, 0x34b9,
+    0x31ff, 0x2a50, 0xaaaf, 0xb034, 0xb2ff, 0xb479, 0xb4c0, 0xb4b3, 0xb37f,
+    0xae53, 0xa895, 0xae1b, 0xad56, 0xa9c7, 0xa9d7, 0xa750, 0x1e4e, 0x1ad8,
+    0x29f4, 0x269a, 0xacd3, 0xafcb, 0xae46, 0xa936, 0xb018, 0x31ad, 0x327d,
+    0x323a, 0x3030, 0x24b8, 0xad2d, 0xaefb, 0xb012, 0xb171, 0xb19a, 0xb046,
+    0xad7e, 0xa9a4, 0xa6d3, 0xa765, 0xa020, 0x2996, 0x2c25, 0x250b, 0xabb0,
+    0xafad, 0xaf47, 0xab2f, 0x201b, 0x2a29, 0x2d28, 0x306d, 0x32d4, 0x34ad,
+    0x3573, 0x34f4, 0x321a, 0x287f, 0xad69, 0xb196, 0xb3f7, 0xb468, 0xb43b,
+    0xb3e6, 0xb1c5, 0xa9e9, 0x27ea, 0x9d0a, 0x221b, 0x28ff, 0x279f, 0x258c,
+    0x2209, 0x90d5, 0x2ad5, 0x2d97, 0x2aab, 0x2596, 0x2468, 0x2bea, 0xa084,
+    0x330e, 0x3426, 0x343b, 0x3270, 0x2cc2, 0xa8f9, 0xacba, 0xad95, 0xb028,
+    0xb0f4, 0xb09f, 0xaffd, 0xae98, 0xae11, 0xae44, 0xace1, 0xa6cb, 0x9f2d,
+    0xa976, 0xae34, 0xb00c, 0xaf24, 0xacf2, 0xab2d, 0xabdb, 0xabee, 0xa1f8,
+    0x2e10, 0x337d, 0x3545, 0x3518, 0x3243, 0x277a, 0xae85, 0xb237, 0xb407,
+    0xb3f7, 0xb304, 0xb25f, 0xb059, 0xa13d, 0x2cde, 0x2b95, 0x2c55, 0x2b97,
+    0x2624, 0x086c, 0xa758, 0xa8b2, 0x280b, 0x2ecb, 0x3035, 0x2fdd, 0x2f3c,
+    0x308f, 0x2c90, 0x3518, 0x35fb, 0x364f, 0x3548, 0x31da, 0x2963, 0xa2d3,
+    0xa9c0, 0xaf32, 0xb14e, 0xb202, 0xb270, 0xb29f, 0xb2c9, 0xb2c4, 0xb1ad,
+    0xaf65, 0xad95, 0xaed1, 0xb009, 0xaeec, 0xab66, 0xa60f, 0xa7c4, 0xacb7,
+    0xaf6d, 0xae38, 0x2117, 0x31c9, 0x3516, 0x3595, 0x3410, 0x2dc9, 0xab11,
+    0xb0e9, 0xb25e, 0xb20a, 0xb10c, 0xb081, 0xad7c, 0x24d7, 0x2d97, 0x2bb2,
+    0x289a, 0xa4e7, 0xacab, 0xad3c, 0xaceb, 0xab28, 0x258e, 0x300f, 0x3235,
+    0x324f, 0x3178, 0x3139, 0x2c4c, 0x3627, 0x37a5, 0x3841, 0x37a5, 0x351e,
+    0x30fb, 0x2cc5, 0x2299, 0xae1f, 0xb251, 0xb42b, 0xb4d0, 0xb52b, 0xb560,
+    0xb560, 0xb4c6, 0xb343, 0xb1c6, 0xb199, 0xb0f5, 0xad35, 0x2583, 0x2d33,
+    0x2c9b, 0x233c, 0xaa60, 0xaadc, 0x2962, 0x330c, 0x3638, 0x3770, 0x368d,
+    0x343b, 0x2ed4, 0xa155, 0xac41, 0xac87, 0xaa8a, 0xa8aa, 0x10f5, 0x2be9,
+    0x2d45, 0x221e, 0xaba7, 0xb0f5, 0xb310, 0xb2ae, 0xb0df, 0xadef, 0x9ca5,
+    0x3024, 0x331d, 0x332a, 0x315b, 0x2f9d, 0x1a24, 0xb019, 0xab01, 0x2a66,
+    0x3105, 0x325a, 0x311c, 0x2f79, 0x2d34, 0x2296, 0xac03, 0xacb3, 0x2440,
+    0x3165, 0x34a6, 0x34c9, 0x32b6, 0x2e92, 0x2c12, 0x2e8a, 0x312a, 0x31bc,
+    0x309f, 0x2fdb, 0x324d, 0x359c, 0x37b2, 0x3821, 0x3786, 0x3634, 0x34cc,
+    0x3236, 0x2ba2, 0xae14, 0xb405, 0xb666, 0xb84c, 0xb955, 0xba42, 0xbafd,
+    0xbb6e, 0xbb5d, 0xbac9, 0xb9cb, 0xb885, 0xb5fc, 0xb1e4, 0xac2f, 0xa6c5,
+    0x957d, 0x223c, 0x291f, 0x3074, 0x332d, 0x3042, 0x3230, 0x360f, 0xb288,
+    0xb065, 0xa995, 0x2bc0, 0x2e2e, 0x2c13, 0x257a, 0xa4b5, 0xad53, 0xb0cc,
+    0xb11e, 0xadaa, 0x284c, 0x3065, 0x30d1, 0x2d8f, 0x1ec4, 0xa46b, 0x2623,
+    0x2d3a, 0x2e37, 0x2a7a, 0x1e3e, 0x2a9f, 0x3203, 0x3539, 0x3638, 0x35f2,
+    0x34fe, 0x33f8, 0x31a6, 0x2cdf, 0xaa9b, 0xb1f5, 0xb51a, 0xb73f, 0xb8a9,
+    0xb992, 0xba4c, 0xbad1, 0xbb06, 0xbae7, 0xba69, 0xb9a5, 0xb8a2, 0xb6ef,
+    0xb4f5, 0xb2f3, 0xb06d, 0xad6f, 0xa99d, 0x2891, 0x2f25, 0x2b4c, 0x2e4d,
+    0x3326, 0xb0ab, 0xad69, 0x99d3, 0x2d87, 0x2ffc, 0x2f1a, 0x2cd3, 0x25a0,
+    0xab45, 0xafca, 0xb059, 0xadd0, 0x9e1c, 0x2c51, 0x2d20, 0x2974, 0xa379,
+    0xa8ad, 0x9a39, 0x2ad6, 0x2c48, 0x1b7c, 0xac20, 0xa8a3, 0x2e2b, 0x3401,
+    0x3565, 0x357d, 0x34eb, 0x3467, 0x33e8, 0x3246, 0x2eda, 0x9f09, 0xb031,
+    0xb435, 0xb65c, 0xb82a, 0xb903, 0xb9b7, 0xba38, 0xba84, 0xba80, 0xba2f,
+    0xb99e, 0xb8d2, 0xb7b3, 0xb599, 0xb334, 0xb03f, 0xad6f, 0xa792, 0x29e1,
+    0x28cb, 0x2c75, 0x30cb, 0xacd8, 0xa2d4, 0x2c4a, 0x3084, 0x3198, 0x3157,
+    0x307e, 0x2dcc, 0x1cc5, 0xac55, 0xae02, 0xacb8, 0xa575, 0x2507, 0x283c,
+    0x285e, 0x212a, 0x9f68, 0x2493, 0x2c02, 0x2b7f, 0xa752, 0xaf9f, 0xaea1,
+    0x26ca, 0x31fc, 0x3496, 0x34f5, 0x34ba, 0x3493, 0x3493, 0x344c, 0x32d8,
+    0x3028, 0x265f, 0xae15, 0xb328, 0xb598, 0xb76a, 0xb887, 0xb942, 0xb9d7,
+    0xba24, 0xba16, 0xb9c2, 0xb92c, 0xb847, 0xb673, 0xb440, 0xb0d0, 0xae22,
+    0xab20, 0x25aa, 0x2bbf, 0x2efe, 0x31af, 0xade0, 0xa91c, 0x2889, 0x2ec6,
+    0x309b, 0x30a3, 0x302a, 0x2e29, 0x2646, 0xa9a1, 0xac9e, 0xac04, 0xa814,
+    0xa3c0, 0x89a3, 0x28f9, 0x2b79, 0x2c7d, 0x2ecf, 0x309d, 0x2fcb, 0x2148,
+    0xaea3, 0xaec9, 0x246c, 0x31fa, 0x34f3, 0x35b9, 0x35e0, 0x35e5, 0x35d6,
+    0x3561, 0x346e, 0x326e, 0x2ef0, 0x9ee3, 0xb07b, 0xb45e, 0xb642, 0xb803,
+    0xb8d3, 0xb97d, 0xb9df, 0xb9e8, 0xb9b1, 0xb925, 0xb84b, 0xb6b2, 0xb496,
+    0xb12a, 0xae18, 0xabc1, 0x2456, 0x2d6e, 0x3132, 0x337a, 0xb1c2, 0xb1a4,
+    0xb166, 0xb157, 0xaf9b, 0xa955, 0x27e8, 0x2bce, 0x299e, 0x1962, 0x23b8,
+    0x2ba1, 0x28a0, 0x26a1, 0x2d28, 0x2f26, 0x2d7f, 0x29e5, 0x24e6, 0x142e,
+    0x2193, 0x2972, 0x2ac8, 0x2c75, 0x2e42, 0x2e25, 0x2ac4, 0x1de6, 0x2485,
+    0x2d67, 0x307d, 0x30e6, 0x3079, 0x2eec, 0x2aff, 0x2233, 0xa952, 0xb00f,
+    0xb304, 0xb3b4, 0xb3c2, 0xb485, 0xb43d, 0xb2bb, 0xb247, 0xb219, 0xb18e,
+    0xade8, 0xa8be, 0x9edb, 0xa813, 0x26f3, 0xa2a5, 0xb0f3, 0xae63, 0xac8c,
+    0xb210, 0xb0dd, 0xaed5, 0xaccf, 0xa712, 0x2860, 0x2dda, 0x2e7b, 0x2c0d,
+    0x204f, 0x1d7c, 0x29de, 0x2699, 0xa0e2, 0x1e80, 0x240a, 0xa21b, 0xa840,
+    0xa36b, 0x1b48, 0x23a6, 0x26f6, 0x2282, 0x20a8, 0x291b, 0x2b85, 0x27d3,
+    0xa4a3, 0xa79a, 0x2027, 0x28ce, 0x28ab, 0x2847, 0x265b, 0xa0a2, 0xa81f,
+    0xab48, 0xae8a, 0xb159, 0xb18e, 0xb1a0, 0xb348, 0xb2e5, 0xb1cf, 0xb299,
+    0xb2d7, 0xb302, 0xb1b0, 0xb043, 0xaeb8, 0xb06b, 0xadcd, 0xaecf, 0xb23b,
+    0xaef2, 0xa81d, 0xb13e, 0xaf14, 0xaa53, 0xa601, 0x9f1f, 0x25e7, 0x2b59,
+    0x2c49, 0x28d8, 0xa50f, 0xa6b5, 0x259c, 0x23db, 0xa5c5, 0xa49c, 0xa48d,
+    0xab29, 0xacac, 0xa63d, 0x2221, 0x22d8, 0x167e, 0xa7d8, 0xaabc, 0xa877,
+    0xa4f0, 0xa9da, 0xadde, 0xaf07, 0xad33, 0xabeb, 0xac32, 0xaab3, 0xaa63,
+    0xad47, 0xaea4, 0xaf5e, 0xb04a, 0xb215, 0xb216, 0xb17e, 0xb2e2, 0xb2a3,
+    0xb1df, 0xb2b9, 0xb25d, 0xb31e, 0xb2c8, 0xb165, 0xb079, 0xb19b, 0xafb9,
+    0xaeac, 0xb10f, 0xabe2, 0x2a1d, 0xab88, 0x9e8f, 0x2c09, 0x2d76, 0x2caa,
+    0x2c3a, 0x2c7a, 0x2c73, 0x2758, 0xab87, 0xad9f, 0xa974, 0xaa47, 0xaef0,
+    0xaf56, 0xae6e, 0xaff7, 0xb009, 0xab71, 0xa4cc, 0xa6d0, 0xa992, 0xad31,
+    0xaf7f, 0xaf4d, 0xae0e, 0xade7, 0xaecd, 0xaf80, 0xadd6, 0xac7c, 0xac96,
+    0xa99b, 0xa693, 0xaac0, 0xac4d, 0xac77, 0xaca1, 0xae23, 0xaa8c, 0x269e,
+    0x24d4, 0x2819, 0x2a56, 0x26bf, 0x2c28, 0x27c7, 0xa405, 0xa756, 0xa7f1,
+    0xac98, 0x9fcf, 0x28fd, 0x1bb0, 0x2da6, 0x327b, 0x33c7, 0x32a2, 0x3315,
+    0x3384, 0x330a, 0x324c, 0x31b1, 0x3182, 0x2fd9, 0x21e2, 0xa7f5, 0x25b5,
+    0x2815, 0xa714, 0xa874, 0x1bda, 0x205a, 0x24b4, 0x2de5, 0x300f, 0x2f2a,
+    0x2ded, 0x2bb6, 0x2a4f, 0x2dbc, 0x30b4, 0x31f6, 0x3255, 0x31f3, 0x3180,
+    0x3086, 0x2e92, 0x2f1c, 0x2f64, 0x2ce3, 0x2bde, 0x2c75, 0x2d1a, 0x2e88,
+    0x3354, 0x3693, 0x37c7, 0x3844, 0x3854, 0x37e4, 0x382a, 0x3755, 0x356a,
+    0x3396, 0x31b2, 0x303f, 0x331d, 0x34bf, 0x3402, 0x34fc, 0x3686, 0xa50a,
+    0xad5c, 0xad98, 0xa946, 0x25b3, 0x2a79, 0x2809, 0x26a4, 0x2cd2, 0x2f49,
+    0x2dd7, 0x283c, 0x9af3, 0xa0a9, 0x066c, 0x214e, 0x27e9, 0x2ead, 0x32a0,
+    0x3491, 0x3506, 0x3454, 0x3171, 0x2c83, 0xa4f3, 0xaf9f, 0xb2c7, 0xb36c,
+    0xb222, 0xb044, 0xabe1, 0xa573, 0x20ba, 0x2ae7, 0x2de5, 0x2e04, 0x2c86,
+    0x2d44, 0x3019, 0x3196, 0x31ce, 0x3085, 0x2ce2, 0x2640, 0x28dc, 0x2ddf,
+    0x978b, 0xa410, 0x19de, 0xa1ba, 0x22b7, 0xa854, 0xb19d, 0xb174, 0xb401,
+    0xb6f7, 0x2c9b, 0x2489, 0x24b2, 0x2ace, 0x2f00, 0x3066, 0x2f73, 0x2e62,
+    0x3011, 0x3077, 0x2e32, 0x26e0, 0xa17a, 0xa28f, 0x92ea, 0x2323, 0x2948,
+    0x2efa, 0x3206, 0x335b, 0x3360, 0x31f0, 0x2f3a, 0x2a06, 0xa270, 0xad55,
+    0xb0a2, 0xb055, 0xad7e, 0xaa78, 0xa464, 0xa612, 0xa7d6, 0x175d, 0x2ad7,
+    0x2ca0, 0x2aca, 0x2c1f, 0x2eb7, 0x3070, 0x30a1, 0x2f3e, 0x2bef, 0x282e,
+    0x2981, 0x2dc2, 0x2702, 0x265a, 0x2af7, 0x2b00, 0x2c8a, 0x290c, 0xad21,
+    0xaca6, 0xaf60, 0xb44d, 0x2c8e, 0x25d6, 0x24da, 0x2986, 0x2d1d, 0x2e66,
+    0x2da4, 0x2dd8, 0x3043, 0x302f, 0x2be4, 0xa572, 0xab08, 0xa9b8, 0xa61d,
+    0x996f, 0x275e, 0x2d85, 0x3083, 0x310e, 0x30a3, 0x2e99, 0x2ab4, 0x2460,
+    0xa4c0, 0xac6b, 0xae6f, 0xaad6, 0x2480, 0x2879, 0x242a, 0xa9a1, 0xad33,
+    0xab37, 0x9d2d, 0x2454, 0x9be8, 0xa10e, 0x9b2d, 0x21b2, 0x2652, 0x265c,
+    0x22ba, 0x2573, 0x29d8, 0x2cc3, 0x2769, 0x268e, 0x2995, 0x2b63, 0x2cb6,
+    0x2a5b, 0xa988, 0x9892, 0x20d9, 0xaed1, 0x2c32, 0x1d1d, 0xa869, 0xa967,
+    0xa644, 0xa0e0, 0x14aa, 0x2a1c, 0x3012, 0x302a, 0x295f, 0xacc1, 0xb036,
+    0xae9f, 0xaabd, 0xa3cc, 0x28b6, 0x2ebd, 0x307a, 0x2f99, 0x2c30, 0x9e99,
+    0xac8e, 0xaeca, 0xafac, 0xaff5, 0xad94, 0x2841, 0x310c, 0x31d3, 0x3047,
+    0x291b, 0xa5ce, 0xa2fe, 0x2599, 0x245f, 0xaa83, 0xafed, 0xb1d4, 0xb1c3,
+    0xb040, 0xad4d, 0xac1d, 0xa7fa, 0x2830, 0x2c48, 0x286a, 0x2a7f, 0x2b8d,
+    0x2bb0, 0x2c56, 0x297a, 0xa3d0, 0x2cee, 0x2fbd, 0x21ec, 0x35fb, 0x3523,
+    0x3437, 0x32fc, 0x32a4, 0x32ae, 0x32bb, 0x3408, 0x354d, 0x355d, 0x3330,
+    0x2c07, 0xa783, 0x1936, 0x2c1e, 0x2dd4, 0x304b, 0x3211, 0x320b, 0x2f54,
+    0xa1a3, 0xb11d, 0xb47c, 0xb56f, 0xb56e, 0xb4a4, 0xb1a8, 0x22f6, 0x3226,
+    0x341f, 0x338b, 0x3130, 0x2e93, 0x2e0c, 0x2ee4, 0x2ca2, 0xa935, 0xb1f5,
+    0xb532, 0xb57f, 0xb422, 0xb06b, 0xadbf, 0xa8de, 0x2ce2, 0x3073, 0x300b,
+    0x308d, 0x2fea, 0x2cd0, 0x292d, 0x2829, 0x27c7, 0x3167, 0x32a3, 0x2cc7,
+    0x3168, 0x2dea, 0x2729, 0x9b11, 0xa7d6, 0xa64c, 0xa2e0, 0x1453, 0xa014,
+    0x1c3c, 0x2a7a, 0x2bec, 0x2224, 0xac1a, 0xaf14, 0xb039, 0xb1eb, 0xb3a5,
+    0xb2d5, 0xaf32, 0xa28f, 0xa94a, 0xb1e6, 0xb4fc, 0xb4b1, 0xad8e, 0x32e6,
+    0x3806, 0x39de, 0x3a1b, 0x38ff, 0x359e, 0x2c49, 0xb130, 0xb350, 0xb266,
+    0xb17a, 0xb011, 0xac2b, 0x24bc, 0x211b, 0x2230, 0xa913, 0xadc1, 0xae8e,
+    0xaa2b, 0xa86f, 0xa867, 0x9fd3, 0x9b1b, 0x2c20, 0x2b7e, 0x2635, 0x2ca0,
+    0x25dc, 0xaaac, 0x2cad, 0x2441, 0xa685, 0xa8d1, 0xaae2, 0xa9fe, 0xa99a,
+    0xa940, 0xa906, 0x9ee1, 0x29c7, 0x2a68, 0x1758, 0xab4f, 0xad0a, 0xac2d,
+    0xac90, 0xad1a, 0xa8aa, 0x2a32, 0x302d, 0x3006, 0x2b79, 0x24aa, 0x2c33,
+    0x32b5, 0x35d2, 0x36ef, 0x3688, 0x341a, 0x2b4e, 0xb0c0, 0xb487, 0xb584,
+    0xb4a8, 0xb29f, 0xb10f, 0xae2a, 0xa2e2, 0x2c69, 0x2ae7, 0x2b57, 0x23e7,
+    0xa739, 0xa8e4, 0xa1cd, 0xa650, 0xa782, 0x1c5e, 0xa344, 0x262e, 0x252f,
+    0x9b0a, 0x288f, 0x1e41, 0xac50, 0xa405, 0xa9bc, 0xaa52, 0xa876, 0xa884,
+    0xa80c, 0xaa76, 0xad74, 0xadb0, 0xa984, 0x22c4, 0x26bf, 0x1b0c, 0xa7c4,
+    0xa920, 0xa11b, 0x2573, 0x295b, 0x2cfd, 0x2fe1, 0x3150, 0x3175, 0x3154,
+    0x322e, 0x3416, 0x354e, 0x3577, 0x336b, 0x2972, 0xb265, 0xb62f, 0xb796,
+    0xb6f5, 0xb548, 0xb217, 0xadf7, 0xab20, 0x9f68, 0x2a12, 0x2cfa, 0x295e,
+    0x2c78, 0x2be9, 0x28a4, 0x25d0, 0x271b, 0x9d2e, 0x0aea, 0x28de, 0xa356,
+    0x981b, 0x9c91, 0xa7c9, 0x2636, 0x2639, 0xa9ee, 0xa9af, 0xaad0, 0xa4c7,
+    0x285f, 0x2b22, 0x2ae7, 0x1529, 0xacf8, 0xaef8, 0xacd0, 0xa693, 0xa04d,
+    0xa26e, 0xa5a6, 0xa44e, 0x2623, 0x2c8b, 0x2e2c, 0x2ecf, 0x2d73, 0x2ad0,
+    0x25a1, 0x2754, 0x2cae, 0x3064, 0x31e8, 0x2f7e, 0xad63, 0xb511, 0xb827,
+    0xb8c6, 0xb838, 0xb547, 0xae78, 0x2cd4, 0x3057, 0x3021, 0x30de, 0x310d,
+    0x2dc6, 0xa3f8, 0x8fd9, 0x1f0f, 0x1701, 0x1da6, 0x22ff, 0xa521, 0x1c99,
+    0x2c94, 0x206c, 0x20da, 0x22d4, 0xa5d2, 0x2532, 0x2886, 0xa811, 0x2a98,
+    0x24b9, 0x29f5, 0x2f95, 0x3193, 0x3214, 0x303e, 0x2812, 0xa6b1, 0xa5e3,
+    0xa1b7, 0xa5e3, 0xa94b, 0xaab1, 0xa8f6, 0x2612, 0x2de4, 0x2f48, 0x2de8,
+    0x227f, 0xae27, 0xb231, 0xb308, 0xb1c6, 0xaf15, 0xabe3, 0xb098, 0xb5c3,
+    0xb88a, 0xb978, 0xb90d, 0xb698, 0xad7b, 0x3364, 0x36df, 0x374c, 0x369e,
+    0x369b, 0x3608, 0x3345, 0x289f, 0xa23a, 0xa9c8, 0xacb4, 0xab44, 0xa632,
+    0xaa7c, 0xa418, 0x2cb4, 0x24e6, 0x27d4, 0x2ab5, 0x9de7, 0x2551, 0x2857,
+    0xa871, 0xaf28, 0xae7b, 0xac9b, 0xa7ec, 0x2294, 0x26f7, 0x2252, 0xa40e,
+    0xa68f, 0xa5a9, 0xa1b6, 0x9816, 0x9e6b, 0x2238, 0x2da5, 0x3224, 0x342a,
+    0x33d2, 0x3208, 0x30f3, 0x30cb, 0x30dd, 0x308f, 0x2ed7, 0x2a9b, 0x244b,
+    0x29aa, 0x3009, 0x32ae, 0x33d1, 0x3426, 0x3496, 0x34b6, 0x341c, 0x3167,
+    0x23dc, 0xb116, 0xb46f, 0xb483, 0xb2fc, 0xb110, 0xb008, 0xae41, 0xadc9,
+    0xb147, 0xb52a, 0xb758, 0xb7c6, 0xb7c6, 0xb851, 0xb8eb, 0xb9af, 0xba51,
+    0xb96e, 0xb82d, 0xb853, 0xaca4, 0xaa8b, 0xa207, 0x28d5, 0x2d57, 0x2da2,
+    0x2c75, 0x2963, 0x2664, 0x248e, 0x2674, 0x28b0, 0x28e6, 0x2b36, 0x2f61,
+    0x3224, 0x33ce, 0x3352, 0x31e0, 0x3109, 0x30d5, 0x30f0, 0x310a, 0x307e,
+    0x2e22, 0x2b22, 0x2c2b, 0x2ff5, 0x31eb, 0x32a8, 0x330a, 0x33ec, 0x3437,
+    0x33c6, 0x31a1, 0x29c9, 0xaede, 0xb2c0, 0xb2cb, 0xb0b9, 0xad7e, 0xab18,
+    0xa77c, 0xa53b, 0xad94, 0xb382, 0xb5da, 0xb647, 0xb650, 0xb71d, 0xb820,
+    0xb8d7, 0xb95b, 0xb86b, 0xb665, 0xb66d, 0xacfb, 0xa986, 0x204b, 0x2bfc,
+    0x2e8f, 0x2ebb, 0x2e03, 0x2d5e, 0x2cf0, 0x2ba6, 0x2ae3, 0x2c14, 0x2c94,
+    0x2d85, 0x2fc1, 0x315e, 0x32b7, 0x3296, 0x3177, 0x3068, 0x2f33, 0x2ede,
+    0x3023, 0x30a9, 0x2fdd, 0x2c9a, 0x2990, 0x2c1d, 0x2ede, 0x3022, 0x309a,
+    0x31b9, 0x32cc, 0x32db, 0x317c, 0x2c53, 0xac01, 0xb13f, 0xb1b9, 0xafaa,
+    0xaa9e, 0xa4a9, 0x153e, 0x1f09, 0xaa6f, 0xb186, 0xb484, 0xb4f8, 0xb51c,
+    0xb5c8, 0xb6ab, 0xb7c8, 0xb82d, 0xb64d, 0xb3ac, 0xb32c, 0xb1ea, 0xb009,
+    0xa978, 0x287b, 0x2d64, 0x2e18, 0x2d70, 0x2d19, 0x2ca7, 0x2939, 0x24ec,
+    0x26ca, 0x29ab, 0x2bf7, 0x2d1f, 0x2e40, 0x3013, 0x3050, 0x2f16, 0x2ca2,
+    0x27f0, 0x251e, 0x2c0c, 0x2fb7, 0x2fe6, 0x2b93, 0xa135, 0xa80c, 0xa27b,
+    0x233c, 0x2a69, 0x2eeb, 0x312a, 0x31d2, 0x3152, 0x2dca, 0xa58c, 0xafa8,
+    0xb0d1, 0xaedb, 0xa88e, 0x2066, 0x27df, 0x284c, 0xa4f4, 0xafcb, 0xb2c8,
+    0xb408, 0xb482, 0xb521, 0xb5a2, 0xb610, 0xb5e7, 0xb380, 0xad72, 0xab5b,
+    0xb640, 0xb4fd, 0xb20f, 0xac65, 0x2293, 0x29df, 0x2930, 0x26d5, 0x19f8,
+    0xaa8a, 0xae0c, 0xae49, 0xacbf, 0xa9ae, 0xa791, 0xa646, 0x1b65, 0x26ed,
+    0x2463, 0xa72a, 0xad65, 0xaded, 0xa644, 0x2c0c, 0x2d2d, 0x1c1b, 0xae2d,
+    0xb0be, 0xb09b, 0xae91, 0xa77f, 0x2c66, 0x3111, 0x32b6, 0x32f9, 0x3104,
+    0x29e1, 0xab90, 0xaec5, 0xad30, 0xa0e6, 0x2b9d, 0x2e4d, 0x2df7, 0x2871,
+    0xab7b, 0xb09c, 0xb2a7, 0xb459, 0xb512, 0xb52f, 0xb4f3, 0xb412, 0xaed4,
+    0x2844, 0x2b91, 0x340c, 0x33cb, 0x330e, 0x3147, 0x2e73, 0x2bef, 0x2e97,
+    0x3106, 0x306c, 0x19b3, 0xb171, 0xb407, 0xb28c, 0xae73, 0xa438, 0xa875,
+    0xb147, 0xb466, 0xb3ed, 0xae05, 0x2d18, 0x312d, 0x2f98, 0x969c, 0xaeed,
+    0xafcf, 0xa952, 0x2acf, 0x2df7, 0x2d1c, 0x22f0, 0xab6e, 0xadd1, 0xadc1,
+    0xabaf, 0xa68b, 0xa65c, 0x1c6c, 0x2c54, 0x2e9a, 0x2e3b, 0x2c6d, 0x2d7e,
+    0x2fb5, 0x2a74, 0xa124, 0x2849, 0x0c5c, 0xab16, 0xa44a, 0x2c0a, 0x2c36,
+    0x2caa, 0x3088, 0x2b64, 0xae30, 0x3428, 0x341b, 0x332a, 0x30d0, 0x2b06,
+    0xa1c0, 0x20d1, 0x2ae2, 0x2991, 0xac16, 0xb29f, 0xb431, 0xb1ec, 0xa9a7,
+    0x2cf9, 0x2d52, 0xa993, 0xb166, 0xb12d, 0xa6da, 0x3044, 0x3281, 0x30a5,
+    0x2240, 0xaeb8, 0xafff, 0xa97f, 0x2b5b, 0x2e08, 0x2bdb, 0xa49f, 0xad5c,
+    0xaf00, 0xaeb0, 0xac57, 0xa667, 0xa51e, 0x9d29, 0x27ea, 0x2a1c, 0x2842,
+    0x1c62, 0x262d, 0x2b0b, 0xa598, 0xac46, 0xa33a, 0xa93b, 0xacac, 0xa900,
+    0x26ae, 0x28df, 0x28cd, 0x2e86, 0x28ce, 0xaf42, 0x352d, 0x3511, 0x3457,
+    0x3144, 0x25f7, 0xad5e, 0xadf3, 0xab26, 0xabe9, 0xb109, 0xb477, 0xb4d5,
+    0xb195, 0x28d7, 0x3329, 0x3411, 0x2ee9, 0xac4f, 0xaedc, 0x204b, 0x317a,
+    0x33dd, 0x31b7, 0x26de, 0xaf48, 0xb0df, 0xacde, 0x251a, 0x2a2c, 0x2166,
+    0xab8a, 0xaea4, 0xaf5a, 0xaee5, 0xacf8, 0xa96b, 0xa90f, 0xa7ae, 0x9400,
+    0x2645, 0x252b, 0xa18f, 0x1b74, 0x2716, 0xabf2, 0xaee7, 0xac6a, 0xadc1,
+    0xad57, 0xa8c7, 0x1d64, 0x24a5, 0x24bd, 0x2c6b, 0xa085, 0xb19d, 0x3635,
+    0x35d4, 0x34bd, 0x30d1, 0xa9fb, 0xb2a8, 0xb41f, 0xb35b, 0xb31e, 0xb4e1,
+    0xb696, 0xb660, 0xb295, 0x2de8, 0x35b3, 0x36b7, 0x33e3, 0x2099, 0xad4c,
+    0x2480, 0x323e, 0x34b8, 0x337d, 0x2c22, 0xae9d, 0xb168, 0xaf44, 0xa6a2,
+    0x242f, 0x1e74, 0xa7b9, 0xaa93, 0xab19, 0xab19, 0xa9ae, 0xa5cb, 0xa4f0,
+    0xa4ad, 0x9995, 0x28d5, 0x2a6a, 0x2471, 0x2059, 0x2336, 0xace5, 0xb020,
+    0xaf47, 0xb036, 0xad6a, 0xa248, 0x246f, 0x285a, 0x2995, 0x2c0d, 0xac20,
+    0xb42c, 0x3885, 0x37de, 0x35e1, 0x312b, 0xaee0, 0xb561, 0xb70f, 0xb6f9,
+    0xb6ba, 0xb7b7, 0xb88d, 0xb830, 0xb463, 0x2e16, 0x3698, 0x37bb, 0x3458,
+    0xa3a0, 0xb049, 0xa633, 0x321b, 0x3532, 0x3460, 0x2e16, 0xad9c, 0xb19f,
+    0xb0b8, 0xad4e, 0xa95a, 0xa856, 0xa96e, 0xa894, 0xa79f, 0xa924, 0xaa4f,
+    0xa8dd, 0xa6f5, 0xa67c, 0xa5f6, 0x24f4, 0x27f7, 0xa0f4, 0xa6e0, 0xa33a,
+    0xad30, 0xb00e, 0xaffb, 0xb056, 0xab81, 0x295b, 0x2d7f, 0x2f6c, 0x2fc3,
+    0x2d66, 0xae7f, 0xb51e, 0xb173, 0xb1d6, 0xb02d, 0xa4a5, 0x2e53, 0x31ee,
+    0x3261, 0x3149, 0x3027, 0x2a46, 0xaa90, 0xad17, 0xa68e, 0x2843, 0x2b32,
+    0x2c3e, 0x2c98, 0x28ca, 0xa83c, 0xabac, 0x1e99, 0x307d, 0x3442, 0x350f,
+    0x34cb, 0x347a, 0x3459, 0x33b7, 0x32f4, 0x32ca, 0x31f5, 0x3048, 0x2d04,
+    0x2cad, 0x2d85, 0x2d81, 0x2fc4, 0x31e6, 0x3126, 0x2ebd, 0x2c2a, 0x8af2,
+    0xac6e, 0xb04c, 0xb17e, 0xb312, 0xb431, 0xb32d, 0xb31e, 0xb476, 0xb51b,
+    0xb4c1, 0xb467, 0xb18a, 0xb109, 0xb036, 0xb05f, 0xb037, 0xac47, 0x2a05,
+    0x315d, 0x33be, 0x3399, 0x3238, 0x3142, 0x2e28, 0x237b, 0x1ce3, 0x2c25,
+    0x2faf, 0x3063, 0x3001, 0x2de3, 0x2493, 0xad06, 0xaf75, 0xab02, 0x2c81,
+    0x31dc, 0x3368, 0x3352, 0x32fd, 0x32b6, 0x31a6, 0x311c, 0x318f, 0x311f,
+    0x2f02, 0x2afa, 0x2b71, 0x2d30, 0x2cf9, 0x2f3e, 0x3239, 0x3294, 0x319d,
+    0x31c6, 0x3173, 0x303d, 0x2e02, 0x2d6b, 0x2c0c, 0x21d3, 0xa4eb, 0xaaa8,
+    0xadf3, 0xaef8, 0xabdc, 0xa815, 0x270e, 0x2caa, 0x3174, 0xb252, 0xb218,
+    0xb022, 0xa593, 0x2e04, 0x3121, 0x30e1, 0x2f5d, 0x2e35, 0x29ca, 0xa4da,
+    0xa563, 0x289e, 0x2de5, 0x2f4a, 0x2e88, 0x2c07, 0xa4f3, 0xaff5, 0xb17e,
+    0xafac, 0xa2d3, 0x2be2, 0x2c6e, 0x2a0f, 0x28a6, 0x288f, 0x2575, 0x27da,
+    0x2bae, 0x2a61, 0x18ba, 0xa927, 0xa5c9, 0x986c, 0xa6da, 0xa20b, 0x2c56,
+    0x2ddd, 0x2b79, 0x2cfd, 0x2ee4, 0x2e4a, 0x2d31, 0x2e8a, 0x2eb4, 0x2bec,
+    0x23be, 0xa5af, 0xa911, 0xa6a6, 0x2813, 0x2c5a, 0x2f47, 0x31e4, 0x355f,
+    0xb269, 0xb2d2, 0xb1c0, 0xad6d, 0x2856, 0x2ee5, 0x2f57, 0x2db9, 0x2d7e,
+    0x2ab3, 0xa40c, 0xa9c8, 0xa370, 0x268c, 0x2830, 0x24f3, 0x1c43, 0xa9d5,
+    0xaf4d, 0xafdd, 0xaa05, 0x295a, 0x2a7b, 0xa5d1, 0xae6e, 0xb048, 0xafc9,
+    0xae03, 0xa99a, 0x1c3d, 0x1bf6, 0xa80a, 0xab49, 0xa8e6, 0xa954, 0xae7d,
+    0xaffd, 0xacf0, 0xacbd, 0xb036, 0xafd5, 0xad5a, 0xadf2, 0xaf86, 0xac5f,
+    0xa582, 0xa874, 0xac1c, 0xad47, 0xac69, 0xa444, 0x2881, 0x2a67, 0x2c61,
+    0x3038, 0x34ac, 0xb5bd, 0xb5cc, 0xb551, 0xb3a5, 0xaf19, 0xa548, 0x137b,
+    0x9ecc, 0x2156, 0xa41b, 0xaeeb, 0xb17d, 0xb0ee, 0xae9d, 0xad03, 0xac31,
+    0xa89c, 0xa6e9, 0xa6e6, 0x2858, 0x30d9, 0x3358, 0x3188, 0x21c3, 0xb07b,
+    0xb2cf, 0xb255, 0xb042, 0xa9d6, 0x254e, 0x28ab, 0x25dd, 0x2687, 0x2add,
+    0x2750, 0xac6d, 0xb061, 0xb053, 0xb189, 0xb42a, 0xb43c, 0xb37c, 0xb428,
+    0xb4c7, 0xb2e2, 0xaefa, 0xad25, 0xac5a, 0xa9a5, 0x9f7e, 0x2c88, 0x2f16,
+    0x2cb6, 0x2617, 0x293a, 0x3139, 0xb467, 0xb59c, 0xb72b, 0xb7f3, 0xb79b,
+    0xb6b9, 0xb5b0, 0xb490, 0xb253, 0xb06c, 0xaf0b, 0xae7a, 0xad62, 0xa83a,
+    0x269d, 0x2a55, 0x2b4c, 0x2bd2, 0x2ba5, 0x2b27, 0x2843, 0x9f6d, 0xa2dc,
+    0x2708, 0x2b34, 0x2b7c, 0x2c01, 0x2a8a, 0xa429, 0xa7ed, 0x2a16, 0x2dbf,
+    0x29ec, 0x228f, 0x2887, 0x2c52, 0x2ad1, 0x285d, 0x2ba9, 0x299d, 0x2a6d,
+    0x26ef, 0x24ef, 0xa423, 0xab68, 0x27b2, 0x2614, 0x2ade, 0x2b7d, 0x2906,
+    0xa616, 0x25a0, 0xa328, 0xa604, 0xa2a0, 0xa7e3, 0xb40e, 0xb513, 0xb674,
+    0xb745, 0xb757, 0xb6da, 0xb5fe, 0xb4e5, 0xb36f, 0xb205, 0xb154, 0xb126,
+    0xb0c7, 0xaf95, 0xad45, 0xacce, 0xacfe, 0xac65, 0xa9dd, 0xa26a, 0x2116,
+    0x1dd2, 0x1fc3, 0x2868, 0x2afc, 0x2b53, 0x2b24, 0x283f, 0xa81c, 0xa92a,
+    0x2784, 0x2bc9, 0x2332, 0xa696, 0xa42a, 0x1e00, 0x0f6c, 0xa01c, 0x264b,
+    0x25d1, 0x24a3, 0xa190, 0x20ef, 0x217b, 0xa850, 0x20e8, 0x8779, 0x261a,
+    0x1ed1, 0x1d02, 0xa46e, 0x292d, 0x1c4e, 0x2028, 0xa12a, 0xab5d, 0xa80a,
+    0xad28, 0xb0ad, 0xb244, 0xb31a, 0xb380, 0xb2d3, 0xb185, 0xb070, 0xaff7,
+    0xafca, 0xafb7, 0xae89, 0xacf7, 0xac35, 0xada0, 0xaf57, 0xaf35, 0xad46,
+    0xa7e7, 0x22ef, 0x2649, 0x26bf, 0x297b, 0x2bb4, 0x2c9a, 0x2d1d, 0x2c14,
+    0x21d5, 0x258c, 0x2dce, 0x2efb, 0x2c11, 0x1aaa, 0xa8c7, 0xa9c8, 0xa9fe,
+    0xaaa6, 0xa792, 0xa1bb, 0xa17c, 0xa850, 0x24ba, 0x2b02, 0x245a, 0x295b,
+    0x27bc, 0x2398, 0xa030, 0x15ea, 0xa2dc, 0x2878, 0x287f, 0x28ce, 0xa49d,
+    0xac6b, 0x33c3, 0x32b5, 0x3123, 0x2f93, 0x2d01, 0x28a0, 0x24b8, 0x24ef,
+    0x24e2, 0x2151, 0x18fc, 0x9c8f, 0x1afd, 0x1e6a, 0xa273, 0xab45, 0xad8f,
+    0xab9c, 0x9815, 0x2b1a, 0x2db1, 0x2d3a, 0x2bc4, 0x29e1, 0x2844, 0x256e,
+    0x26a1, 0x289b, 0x257a, 0x2a9b, 0x2ee4, 0x2eb5, 0x2c56, 0x2413, 0xa9e0,
+    0xac12, 0xa9fc, 0xaa22, 0xa80b, 0x24bc, 0x2843, 0x1d94, 0x2bad, 0x2dc7,
+    0x2a51, 0x29de, 0x23c7, 0xa805, 0xa5b7, 0x2467, 0xa3b7, 0xa11c, 0x21cb,
+    0x262d, 0x17e9, 0x1db6, 0x3ac2, 0x3a26, 0x398f, 0x391c, 0x389a, 0x3809,
+    0x374d, 0x36e2, 0x3698, 0x363a, 0x35f0, 0x3596, 0x353b, 0x34a5, 0x3340,
+    0x3091, 0x2df6, 0x305a, 0x32f8, 0x3452, 0x3439, 0x3249, 0x2e06, 0xa304,
+    0xaf74, 0xb2a7, 0xb43c, 0xb49d, 0xb4f6, 0xb44e, 0xb278, 0xb1f6, 0xb23c,
+    0xb2c4, 0xb378, 0xb214, 0xadf0, 0xa9ed, 0xa5ce, 0x2909, 0x2b81, 0x2a6c,
+    0x30a9, 0x320d, 0x2f38, 0x2b70, 0xa113, 0xad9d, 0xabe5, 0xa09b, 0xaab5,
+    0xac8c, 0xab1f, 0xa6a5, 0x26b4, 0x2eb4, 0xb5ac, 0xb3c1, 0xae46, 0x2491,
+    0x2e7b, 0x30d9, 0x303d, 0x2ac6, 0xa6c5, 0xace0, 0xad70, 0xac3b, 0xac16,
+    0xad88, 0xaf33, 0xb040, 0xb07d, 0xafe1, 0xab7b, 0x28a0, 0x2ebd, 0x2ef4,
+    0x29dd, 0xa964, 0xaee2, 0xb018, 0xae02, 0xa59e, 0x28d7, 0x290a, 0x28b0,
+    0x2d02, 0x3095, 0x3273, 0x3253, 0x2fb3, 0x2885, 0xa827, 0xac44, 0x20f2,
+    0x2dc5, 0x2fe0, 0x3055, 0x24e3, 0xb1cd, 0xb58b, 0xb76d, 0xb7fa, 0xb6df,
+    0xb503, 0xad93, 0x3235, 0x3565, 0x35fd, 0x3856, 0x39c3, 0xb4be, 0xb222,
+    0xabb3, 0x298a, 0x2fa7, 0x3159, 0x30f4, 0x2d82, 0x250c, 0xa468, 0xa448,
+    0x220d, 0x264e, 0x1e8c, 0xa53b, 0xa91f, 0xaa04, 0xa934, 0x9a7f, 0x2bc5,
+    0x2f39, 0x2fd8, 0x2d17, 0x1e3a, 0xac26, 0xaf29, 0xaf77, 0xad76, 0xaaa7,
+    0xaa45, 0xa668, 0x2a53, 0x3087, 0x3352, 0x33f0, 0x319a, 0x2c8e, 0xa64b,
+    0xadde, 0xa9dc, 0x2115, 0x26af, 0x28af, 0xabec, 0xb341, 0xb5a7, 0xb74b,
+    0xb7bb, 0xb61e, 0xb3c5, 0xa757, 0x3360, 0x35f6, 0x367b, 0x3857, 0x3994,
+    0xb324, 0xb05d, 0xa6af, 0x2c0d, 0x2ff4, 0x3119, 0x30ce, 0x2e17, 0x29a9,
+    0x2538, 0x2612, 0x2a5f, 0x2c0b, 0x2a85, 0x2779, 0x21c7, 0x1c84, 0x94a5,
+    0x1f4f, 0x2906, 0x2cf3, 0x2e2d, 0x2cc3, 0x21cb, 0xac2a, 0xb01f, 0xb134,
+    0xb164, 0xb145, 0xb140, 0xaf20, 0x200a, 0x30a8, 0x3462, 0x353f, 0x345a,
+    0x30f1, 0x2694, 0xad45, 0xad0f, 0xaa91, 0xabad, 0xac79, 0xb140, 0xb4d7,
+    0xb64b, 0xb784, 0xb79c, 0xb56e, 0xb111, 0x2aca, 0x3450, 0x3626, 0x3677,
+    0x3819, 0x391b, 0xb0c2, 0xad5b, 0x9839, 0x2c49, 0x2f0a, 0x3011, 0x2f06,
+    0x2ba4, 0x251c, 0x1f5b, 0x2446, 0x299c, 0x2bbe, 0x2b98, 0x29c3, 0x254d,
+    0x942f, 0xa765, 0xaa8c, 0xa976, 0xa028, 0x253b, 0x20dd, 0xa960, 0xaf09,
+    0xb196, 0xb326, 0xb403, 0xb413, 0xb3c1, 0xb149, 0xa27b, 0x3127, 0x3530,
+    0x36a1, 0x361f, 0x343b, 0x2f9b, 0xa588, 0xac4c, 0xac57, 0xae39, 0xb022,
+    0xb35e, 0xb5ba, 0xb6f2, 0xb7ea, 0xb794, 0xb4de, 0xadc4, 0x2f48, 0x3467,
+    0x3589, 0x3593, 0x36fa, 0x384d, 0xac44, 0xa447, 0x29af, 0x2de7, 0x2f1d,
+    0x2ef0, 0x2cfc, 0x260e, 0xa3f0, 0xa5f7, 0xa362, 0x13df, 0x221e, 0x2583,
+    0x258f, 0x97b3, 0xa877, 0xad7c, 0xb07d, 0xb105, 0xb009, 0xadb2, 0xade8,
+    0xb061, 0xb25b, 0xb433, 0xb516, 0xb5a6, 0xb5aa, 0xb525, 0xb30b, 0xa981,
+    0x3103, 0x3582, 0x3750, 0x3710, 0x353a, 0x31aa, 0x2543, 0xabbc, 0xad69,
+    0xb005, 0xb17c, 0xb485, 0xb68d, 0xb7db, 0xb871, 0xb835, 0xb573, 0xaf1e,
+    0x2d72, 0x3297, 0x33da, 0x33fe, 0x3557, 0x36bc, 0xaeda, 0xaa3d, 0x92b6,
+    0x1cdf, 0xac36, 0xaaac, 0x29e0, 0x2c04, 0x26f3, 0x2527, 0x255c, 0xa71d,
+    0xa8ee, 0x2591, 0x1651, 0xab9b, 0xab82, 0xa914, 0xa80e, 0xa524, 0x2002,
+    0x28a9, 0x2902, 0x8703, 0x23ab, 0x2b33, 0x24b0, 0xa6ca, 0x2bba, 0x2e64,
+    0x2351, 0x2753, 0x2985, 0x2743, 0xa0c8, 0xa964, 0xa8de, 0xa307, 0xa041,
+    0x0df7, 0xa8be, 0xa443, 0xa9e0, 0xad43, 0x9a1e, 0xa564, 0x2467, 0x29f0,
+    0x28e1, 0xa882, 0xad9a, 0xada9, 0xa305, 0xab75, 0x9c3f, 0x29ef, 0xaab1,
+    0xa710, 0xa8e6, 0xa8b1, 0xaea5, 0xb031, 0xaa47, 0xa07d, 0x9325, 0x95a7,
+    0xa5a3, 0xac75, 0xac9a, 0x1cb2, 0x9c86, 0xaba2, 0xa8be, 0x9eae, 0xa0c1,
+    0x1cd9, 0x29de, 0x2cb3, 0x2b6b, 0x20f8, 0x25ac, 0x2ac7, 0x22d1, 0xab29,
+    0xa6b8, 0x1f78, 0xac16, 0xa9bf, 0xa733, 0xa35c, 0x9a1b, 0xa046, 0x196e,
+    0x269e, 0x23f2, 0x267f, 0x9aae, 0x9457, 0xa567, 0xaa13, 0x22fe, 0xa45b,
+    0x24f2, 0x2730, 0x29fa, 0x2b7f, 0x2c52, 0x28b6, 0x2c84, 0xa964, 0xa98f,
+    0x98cf, 0x313f, 0x30e3, 0x2e35, 0x29e0, 0xa964, 0xb00f, 0xade4, 0xab16,
+    0xa8c9, 0xa706, 0xa80c, 0xac11, 0xacce, 0xa5e5, 0xaab1, 0xafa6, 0xad30,
+    0xa70a, 0xa973, 0xa992, 0x9413, 0x27e5, 0x27c8, 0x8f53, 0x1be5, 0x2501,
+    0xa454, 0xad8d, 0xac40, 0xa061, 0xa9a8, 0xa876, 0xaa69, 0xaa55, 0x9cce,
+    0x20c8, 0x1d21, 0x2618, 0x22fa, 0x2933, 0x264b, 0x158c, 0xa689, 0xa823,
+    0x1d88, 0xaadc, 0xa8d6, 0xab55, 0xa571, 0x20d1, 0x2cb6, 0x2b78, 0x2c58,
+    0x9f55, 0x23d1, 0x2552, 0x3895, 0x38af, 0x38d4, 0x38b7, 0x37f2, 0x35f3,
+    0x3542, 0x3508, 0x34bd, 0x3426, 0x3226, 0x30ca, 0x312c, 0x32c3, 0x319f,
+    0x2ddc, 0x2e32, 0x2e64, 0x29b5, 0x2950, 0x2ffe, 0x3113, 0x2f21, 0x294b,
+    0x282a, 0x2a17, 0x2481, 0xa8dc, 0xa595, 0x289b, 0x26f0, 0x2bc5, 0x2a2c,
+    0x27f3, 0x2c47, 0x2e7a, 0x2e48, 0x2f25, 0x2d4c, 0x2db0, 0x2e78, 0x2d38,
+    0x29a2, 0x2578, 0x2824, 0xa45b, 0xa964, 0xb0c4, 0xb10c, 0xb0a3, 0xa9a8,
+    0xa88c, 0xa7ce, 0x8b3e, 0x2b74, 0xa919, 0xbc6f, 0xbaf7, 0xb8d5, 0xb68c,
+    0xb586, 0xb5a9, 0xb4e3, 0xb266, 0xadcd, 0xabe2, 0xb00f, 0xb16d, 0xb0dc,
+    0xae2c, 0xacdd, 0xac61, 0x98af, 0x2450, 0xa42f, 0x2548, 0x2f5f, 0x2ce8,
+    0xaed3, 0xb406, 0xb367, 0xb05a, 0xad0c, 0xaa25, 0x2094, 0x2c26, 0x2b07,
+    0x2d5d, 0x2d65, 0x2949, 0xa75f, 0xad5c, 0xb042, 0xb155, 0xb3d5, 0xb3d4,
+    0xb0a9, 0xa955, 0x2b9f, 0x2e54, 0x3012, 0x2fa3, 0x3035, 0x2c16, 0x2ec2,
+    0x3040, 0x32c3, 0x2edf, 0x2b50, 0x3271, 0x334a, 0xad12, 0xb12c, 0xad14,
+    0x2822, 0x300b, 0x3139, 0x31c8, 0x31dd, 0x31f6, 0x32c0, 0x33da, 0x3430,
+    0x3402, 0x331f, 0x329e, 0x32fc, 0x3284, 0x305d, 0x2c9d, 0x2cd1, 0x3025,
+    0x310d, 0x30a8, 0x2fb7, 0x2e5a, 0x2eab, 0x3092, 0x32fb, 0x3513, 0x361a,
+    0x35e0, 0x3444, 0x307b, 0x2383, 0xaf4d, 0xb240, 0xb394, 0xb40a, 0xb3be,
+    0xb0ff, 0xac10, 0xaab9, 0xada7, 0xb1e2, 0xb341, 0xb466, 0xb610, 0xb5ab,
+    0xb402, 0xb1db, 0xb045, 0xae85, 0xb003, 0xb0ac, 0xb02b, 0xae7a, 0xad5d,
+    0xb313, 0xb0fe, 0xacbd, 0xa417, 0xa175, 0xa5cc, 0xa88b, 0xa901, 0xa47b,
+    0x2506, 0x2b4d, 0x2d24, 0x2d94, 0x2e8d, 0x3065, 0x3066, 0x2cc5, 0x1c53,
+    0x9f63, 0x27ff, 0x2add, 0x2926, 0x20b2, 0xa47c, 0xa475, 0x1f10, 0x2bc7,
+    0x308d, 0x32ee, 0x33eb, 0x32fe, 0x317a, 0x2f77, 0x293b, 0xa595, 0xac49,
+    0xadfe, 0xaf7c, 0xad27, 0x1d6a, 0x28e0, 0x2835, 0xa636, 0xa9f8, 0xaca4,
+    0xb112, 0xb0c4, 0xadf8, 0xac52, 0xa87a, 0x1b90, 0xa455, 0xa9dd, 0xa8b4,
+    0xa066, 0x256e, 0xb172, 0xafea, 0xacd1, 0xaac0, 0xad07, 0xafb4, 0xb0de,
+    0xb161, 0xb0fb, 0xaf65, 0xab9a, 0xa1fc, 0x2141, 0x27d7, 0x2c53, 0x2c4c,
+    0x9e00, 0xadfb, 0xb006, 0xaee6, 0xae06, 0xaec4, 0xb075, 0xb197, 0xb203,
+    0xb1d2, 0xb0f0, 0xadff, 0xa0fd, 0x2c8a, 0x2fd7, 0x3151, 0x3248, 0x3221,
+    0x316f, 0x3066, 0x2e17, 0x240f, 0xa7ae, 0x21b4, 0x297c, 0x2cb2, 0x2c97,
+    0x2d51, 0x2d12, 0x2690, 0x2866, 0x292a, 0x2327, 0x24f9, 0x2b1d, 0x29b6,
+    0x239c, 0x24c9, 0x2acb, 0x2eeb, 0xaa9a, 0xa428, 0x2053, 0x95d5, 0xab5a,
+    0xb015, 0xb1ac, 0xb28f, 0xb269, 0xb112, 0xade3, 0xa8ae, 0xa553, 0xa469,
+    0x980e, 0xa69c, 0xafe0, 0xb36b, 0xb481, 0xb467, 0xb432, 0xb452, 0xb4eb,
+    0xb5af, 0xb61d, 0xb63b, 0xb601, 0xb528, 0xb335, 0xaf06, 0xa051, 0x2e2c,
+    0x3261, 0x3455, 0x34e0, 0x34a1, 0x338f, 0x2f80, 0x9a21, 0xa884, 0xa884,
+    0x2532, 0x2c46, 0x2f7a, 0x3078, 0x2ff2, 0x3080, 0x2f2b, 0x28ef, 0x1dae,
+    0x2379, 0x2098, 0xa3d1, 0xa1a4, 0x27ac, 0x2f05, 0x29aa, 0x2cb0, 0x2d3c,
+    0x29e7, 0xa8b0, 0xb061, 0xb2a8, 0xb3e2, 0xb3e7, 0xb299, 0xb071, 0xad3c,
+    0xaca5, 0xad96, 0xae51, 0xb0de, 0xb470, 0xb676, 0xb757, 0xb72b, 0xb6c3,
+    0xb6b8, 0xb749, 0xb811, 0xb857, 0xb863, 0xb835, 0xb762, 0xb594, 0xb2e0,
+    0xadc7, 0x2933, 0x31eb, 0x3524, 0x36ab, 0x36eb, 0x361b, 0x33b4, 0x2c41,
+    0xa839, 0xac9a, 0xa02b, 0x2ca0, 0x313b, 0x3309, 0x3344, 0x3383, 0x3148,
+    0x2ac5, 0xa04d, 0xa53e, 0xa6b1, 0xaa77, 0xab12, 0xa592, 0x2c49, 0x2e8d,
+    0x156f, 0xaece, 0xb096, 0xb079, 0xb00f, 0xac79, 0xa3e4, 0x1c97, 0x1900,
+    0x22b8, 0x22ca, 0xa661, 0xa84a, 0x9917, 0x232c, 0x9fdb, 0xa86f, 0xabf1,
+    0xadc8, 0xa827, 0x31f6, 0x36b8, 0x37ee, 0x3666, 0x30b4, 0xb27c, 0xb737,
+    0xb783, 0xb4ce, 0xad23, 0x2d98, 0x2f7a, 0x2cb6, 0x2532, 0xaaa3, 0xae05,
+    0xaa67, 0xa5d1, 0xa816, 0xa226, 0x2929, 0x23ec, 0x0d6c, 0x9cc6, 0xa89b,
+    0x27ad, 0x196c, 0xaa0c, 0xa90a, 0x230d, 0x25a5, 0x1d93, 0x2727, 0x2979,
+    0xaeb6, 0x3063, 0x2b0e, 0xa807, 0xaadf, 0xa924, 0x9f95, 0x2936, 0x2aca,
+    0x28b6, 0x2877, 0x2c49, 0x2cae, 0x2251, 0xa847, 0xa511, 0x1e10, 0x22ed,
+    0x2451, 0xa4a4, 0xb01e, 0xb29c, 0xae1e, 0x3079, 0x357a, 0x3712, 0x35a3,
+    0x2c95, 0xb2bb, 0xb562, 0xb4a3, 0xb09a, 0x1ccb, 0x2c72, 0x2d3a, 0x2c47,
+    0x1f21, 0xaadc, 0xa9ac, 0xaacd, 0xace8, 0xaaca, 0x9da0, 0xa2a7, 0xa022,
+    0x2591, 0xa203, 0x2649, 0x222e, 0xa77d, 0xaa0a, 0x1d06, 0x24de, 0xa42c,
+    0x25fe, 0x2c58, 0xab0b, 0x3016, 0x2adf, 0xa5c9, 0xaa2b, 0xa5d4, 0x27d3,
+    0x2c9e, 0x2a76, 0x9cf8, 0x9fc4, 0x2b18, 0x2cc1, 0xa2a4, 0xaefa, 0xaf7e,
+    0xab37, 0x2611, 0x2e15, 0x2cfd, 0xad4d, 0xb451, 0xb4aa, 0xb009, 0x307d,
+    0x36ab, 0x3829, 0x35bc, 0x2ca6, 0xb219, 0xb55a, 0xb542, 0xb341, 0xaf47,
+    0xa154, 0x29fc, 0x26c7, 0xa86f, 0xa9dc, 0xac01, 0xad7d, 0xac6a, 0xa838,
+    0xa4fb, 0x9a72, 0x29d9, 0x286d, 0x299b, 0x27c4, 0x269e, 0x9961, 0x2295,
+    0x27d6, 0x9fb9, 0x2835, 0x2dce, 0xa363, 0x3191, 0x2d19, 0xa3eb, 0xabbb,
+    0xaa4c, 0x9ac0, 0x26ce, 0xa5bb, 0xae5a, 0xadba, 0x2158, 0x2a0e, 0xabd9,
+    0xb1eb, 0xb1c7, 0xabcb, 0x2e5d, 0x33ce, 0x3441, 0x2e25, 0xb16b, 0xb5d1,
+    0xb65f, 0xb2ce, 0x314e, 0x3801, 0x38b8, 0x3714, 0x3007, 0xb1f9, 0xb597,
+    0xb597, 0xb3b6, 0xacf1, 0x297f, 0x2c43, 0x2693, 0x1c35, 0xa837, 0xaa23,
+    0xa638, 0xa4cc, 0xa593, 0xa655, 0x1dbe, 0x2159, 0x21ba, 0xa1ac, 0x2982,
+    0x28d7, 0x2642, 0x2839, 0xa313, 0x2468, 0x2c61, 0xa9fd, 0x3442, 0x3007,
+    0xa283, 0xad9e, 0xae0a, 0xaa79, 0xa757, 0xad71, 0xb0e5, 0xaf38, 0x20ee,
+    0x28a1, 0xae66, 0xb399, 0xb2d9, 0xaae9, 0x309a, 0x3508, 0x35c5, 0x326f,
+    0xb00f, 0xb82d, 0xbabb, 0xbab7, 0xb692, 0x323f, 0x393a, 0x3a76, 0x38f0,
+    0x33c8, 0xac7a, 0xb33b, 0xb2ac, 0xac38, 0x2c56, 0x2f86, 0x2f0d, 0x2e7c,
+    0x295f, 0x1e32, 0x24b6, 0xa632, 0xaca1, 0xad8b, 0xaab9, 0xa7d3, 0xa5a6,
+    0xa923, 0x2c90, 0x2f09, 0x2ce2, 0x2c5d, 0x2545, 0x190f, 0x211c, 0xb015,
+    0xaf84, 0xa57e, 0x2cb3, 0x2e31, 0x2bfd, 0x9244, 0xa7cb, 0xaa03, 0xacae,
+    0xa9fe, 0x206b, 0x21df, 0xa24c, 0xa113, 0x9ca5, 0xa4ad, 0xa8dd, 0xab73,
+    0xab3c, 0xa357, 0x2b5c, 0x2db3, 0x2c0f, 0x249d, 0xa45a, 0xa418, 0x2782,
+    0x2a22, 0x22b5, 0x24b1, 0x283c, 0x2532, 0xaa15, 0xad35, 0xa5df, 0x2e96,
+    0x2d89, 0xac5c, 0xaffe, 0xb073, 0xaa19, 0x2c6a, 0x30ef, 0x3278, 0x3409,
+    0x34ed, 0x35ad, 0x36e8, 0x3694, 0x3690, 0x36bd, 0x352e, 0x348f, 0x351b,
+    0x342d, 0x2f80, 0xb0f7, 0xab85, 0x29f7, 0x2e75, 0x2d70, 0x287a, 0x24e8,
+    0x2814, 0x27ad, 0x2a81, 0x2d8d, 0x2d9a, 0x2c4b, 0x2b95, 0x2c29, 0x2c36,
+    0x2c3b, 0x2a8e, 0x2572, 0x248a, 0x2c7d, 0x2eb1, 0x2cc6, 0x2440, 0xa6ce,
+    0xa148, 0x2be7, 0x2e38, 0x2c22, 0x2b36, 0x2c38, 0x2c8b, 0x253d, 0xa533,
+    0x20d4, 0x2f30, 0x2f64, 0x2373, 0xa403, 0xa977, 0x1f68, 0x2c2e, 0x2e5d,
+    0x3042, 0x3126, 0x31ca, 0x323e, 0x3392, 0x32d3, 0x3269, 0x3238, 0x2ce5,
+    0x1c69, 0x2a7c, 0x2b5f, 0xad23, 0xb3de, 0xb05f, 0x2425, 0x2fe7, 0x30a5,
+    0x2edf, 0x2d5a, 0x2def, 0x2dad, 0x2d87, 0x2e31, 0x2d81, 0x2b20, 0x26d3,
+    0x265b, 0x2978, 0x2ce8, 0x2df3, 0x2b02, 0x231d, 0x2800, 0x2b1c, 0x2a67,
+    0x281c, 0x2350, 0x29b1, 0x2f5d, 0x305e, 0x2e9e, 0x2e04, 0x2e4b, 0x2e3e,
+    0x2973, 0x1110, 0x242e, 0x2e2c, 0x2deb, 0x2582, 0x25c8, 0xa6f3, 0xa87b,
+    0xa798, 0xa663, 0x1879, 0xa150, 0xaa8f, 0xadd7, 0xae75, 0xb098, 0xb1e2,
+    0xb252, 0xb4e0, 0xb5fc, 0xb4ff, 0xb367, 0xb5aa, 0xb67a, 0xb4e3, 0xaf17,
+    0x2bf5, 0x3052, 0x300b, 0x2e91, 0x2eb7, 0x2d1b, 0x2931, 0x21c7, 0xa0ff,
+    0xa84a, 0xac77, 0xac81, 0xa895, 0x22d8, 0x2a92, 0x2457, 0xaa4e, 0xac45,
+    0xac0e, 0xab52, 0xa93f, 0xa6a6, 0x2470, 0x2cce, 0x2b98, 0xa195, 0xa744,
+    0xa4ad, 0xa1ba, 0xab30, 0xadb5, 0xad03, 0x1a26, 0x1f0d, 0xab32, 0xa9f5,
+    0xb002, 0xb186, 0xb263, 0xb291, 0xb147, 0xb201, 0xb3ba, 0xb4ac, 0xb597,
+    0xb6ac, 0xb771, 0xb77f, 0xb83c, 0xb899, 0xb825, 0xb697, 0xb867, 0xb1bc,
+    0xb439, 0xb250, 0xaccd, 0x9abe, 0x2400, 0x1fb6, 0x27bf, 0x26fd, 0x90f5,
+    0xa7ef, 0xaa16, 0xabbe, 0xad74, 0xad09, 0xa8c3, 0x25d4, 0x2cfd, 0x2a6f,
+    0xa612, 0xab48, 0xab84, 0xa9a7, 0xa5c8, 0xa13e, 0x2469, 0x29c3, 0x9eee,
+    0xae17, 0xaef8, 0xacab, 0xa79d, 0xa8f7, 0xab48, 0xabe1, 0x22dc, 0x29c5,
+    0x1871, 0x25e0, 0xa9bd, 0xab57, 0xa97f, 0x132f, 0x2f5a, 0x3170, 0x3239,
+    0x3236, 0x305d, 0x2959, 0x28eb, 0x2da6, 0x2782, 0xac93, 0xb062, 0xb137,
+    0xb68e, 0x32a4, 0x313f, 0x2e0e, 0x23d0, 0xaa40, 0xad4f, 0xaf42, 0xb12f,
+    0xb2f9, 0xb31f, 0xb056, 0xa212, 0x2a21, 0x24e3, 0xaaaf, 0xafcd, 0xb185,
+    0xb2c2, 0xb427, 0xb53d, 0xb657, 0xb6d6, 0xb65d, 0xb509, 0xb33d, 0xb15a,
+    0xaf54, 0xa95f, 0x2ae4, 0x3140, 0x3477, 0x35bf, 0x35d6, 0x353b, 0x34d8,
+    0x3509, 0x34e9, 0x33d4, 0x32be, 0x3316, 0x32c8, 0x337a, 0x3469, 0x326d,
+    0x2e7a, 0x2587, 0xaa91, 0xacbf, 0xac02, 0xa9f1, 0xa6cc, 0x283a, 0x2ea2,
+    0x28d8, 0xacca, 0xacdb, 0x339f, 0x322b, 0x301f, 0x2b43, 0x20df, 0x9d2d,
+    0xa5d0, 0xabc7, 0xaf25, 0xb02e, 0xacd5, 0x21ca, 0x29e5, 0x22f3, 0xa8b8,
+    0xac30, 0xaca7, 0xad05, 0xaf10, 0xb1b4, 0xb41d, 0xb4ca, 0xb475, 0xb284,
+    0xafda, 0xacc3, 0xa983, 0x9884, 0x2be5, 0x3083, 0x3334, 0x3467, 0x3436,
+    0x3325, 0x32d9, 0x3405, 0x3440, 0x32e6, 0x3194, 0x3128, 0x3037, 0x3070,
+    0x3141, 0x2c6a, 0xaa1f, 0xaebb, 0xb004, 0xaf2d, 0xada8, 0xab67, 0xa73d,
+    0x2953, 0x307e, 0x2dfa, 0xa3e0, 0xa271, 0x32e1, 0x316f, 0x2ee7, 0x29b0,
+    0x2216, 0x224d, 0x1ccf, 0xa5f1, 0xabc5, 0xad42, 0xaaa7, 0x1730, 0x2479,
+    0xa1d9, 0xa8f7, 0xa823, 0x9a3b, 0x24fa, 0x18e4, 0xac38, 0xb0e7, 0xb265,
+    0xb1a1, 0xae30, 0xa18c, 0x2962, 0x2c30, 0x2cf0, 0x2e0e, 0x2fa2, 0x30b3,
+    0x30db, 0x2fb8, 0x2d9d, 0x2e71, 0x3132, 0x3235, 0x30bb, 0x2dd1, 0x2ab2,
+    0x9613, 0xa2c1, 0x9d03, 0xaf13, 0xb329, 0xb3ba, 0xb274, 0xb0f7, 0xafe6,
+    0xad6f, 0xabfb, 0x8de2, 0x2fec, 0x2f9f, 0x2880, 0x29fc, 0x31f2, 0x3074,
+    0x2c76, 0x240d, 0x9525, 0x1514, 0x8b46, 0xa390, 0xa85a, 0xa977, 0xa576,
+    0x1db9, 0x9589, 0xa769, 0xaa17, 0xa8ae, 0x1838, 0x290d, 0x28e5, 0xa4d9,
+    0xae56, 0xb071, 0xaec2, 0xa328, 0x2d9f, 0x3111, 0x321a, 0x3201, 0x3118,
+    0x2fb4, 0x2d81, 0x29e8, 0x9c3b, 0xa7fd, 0x9c23, 0x2c10, 0x2e5c, 0x2ae1,
+    0xa647, 0xae51, 0xb218, 0xb375, 0xb3a5, 0xb562, 0xb6a2, 0xb5f7, 0xb481,
+    0xb2ef, 0xb175, 0xafe1, 0xaf05, 0xabe1, 0x2c8c, 0x2e7a, 0x2b17, 0x2d3b,
+    0x2cfc, 0x2b78, 0x1e68, 0xa8f2, 0xaafc, 0xaaee, 0xab28, 0xac21, 0xaca6,
+    0xac2b, 0xa887, 0x9e45, 0xa031, 0xa6c9, 0xaa13, 0xaa75, 0xa400, 0x288c,
+    0x2ae4, 0x2265, 0xaba1, 0xade0, 0xa9b7, 0x2c07, 0x31b5, 0x342e, 0x34cf,
+    0x34a9, 0x334d, 0x3065, 0x2b2e, 0xa166, 0xabfe, 0xacf5, 0xa89c, 0x2860,
+    0x2bc5, 0x9919, 0xaf4d, 0xb32d, 0xb5bb, 0xb705, 0xb75f, 0xb85b, 0xb8a6,
+    0xb7c3, 0xb5c1, 0xb47f, 0xb2bf, 0xb0b1, 0xb03e, 0xae67, 0x2628, 0x2ca6,
+    0x2b98, 0x2e52, 0x3637, 0x3735, 0x379f, 0x36d2, 0x357f, 0x348b, 0x3419,
+    0x3328, 0x319b, 0x314f, 0x328f, 0x32b0, 0x3014, 0x1dde, 0xad03, 0xac8f,
+    0x1c0e, 0x2d0d, 0x2ec9, 0x2e96, 0x2faa, 0x3166, 0x31fb, 0x301e, 0x2886,
+    0xaa91, 0xaee7, 0xb03c, 0xb0cd, 0xb14c, 0xb18e, 0xb236, 0xb35f, 0xb40d,
+    0xb3cd, 0xb36e, 0xb443, 0xb5b6, 0xb68d, 0xb5ac, 0xb44e, 0xb1b7, 0xb021,
+    0xb0b6, 0xb171, 0xb040, 0xb106, 0xb381, 0xb19f, 0xaddd, 0xa599, 0x2c94,
+    0x30b6, 0x3096, 0x305a, 0x310c, 0x32a7, 0x3406, 0x341a, 0x3264, 0x2fc5,
+    0x2c38, 0x2b3b, 0x2b43, 0x28d9, 0x298a, 0x2d92, 0x2e4c, 0x293b, 0xa899,
+    0xacd4, 0xabfc, 0xa5ce, 0x21d0, 0x24d6, 0x2662, 0x2ba3, 0x2f40, 0x303c,
+    0x2dd9, 0x272c, 0xa663, 0xaab3, 0xab5b, 0xac2a, 0xacb8, 0xac96, 0xad54,
+    0xaf29, 0xb02e, 0xb011, 0xb052, 0xb20a, 0xb4a7, 0xb5a6, 0xb4cb, 0xb291,
+    0xae9b, 0xa954, 0xab46, 0xad5f, 0xa8f3, 0xa78e, 0xae9f, 0xad42, 0xa8e8,
+    0xa827, 0x2426, 0x2c79, 0x29f9, 0x243b, 0x284a, 0x3078, 0x3101, 0x3085,
+    0x2d7b, 0x276f, 0x9c4c, 0x13fd, 0x212b, 0x9629, 0x2384, 0x2c1c, 0x2d30,
+    0x2a2a, 0x2415, 0x1ee3, 0x2104, 0x2141, 0x9aa1, 0xa81e, 0xa90c, 0xa0e4,
+    0x2845, 0x2a7b, 0x280c, 0x1e99, 0x9446, 0x222d, 0x26bd, 0x2561, 0x24de,
+    0x289a, 0x28e3, 0x20bd, 0xa687, 0xa97a, 0xad13, 0xb119, 0xb45a, 0xb562,
+    0xb46b, 0xb12a, 0xa95d, 0x29c7, 0x2adb, 0x286b, 0x2e1e, 0x308f, 0x2c95,
+    0x287f, 0x2402, 0xa985, 0xaa66, 0xa71f, 0xad7c, 0xb094, 0xb017, 0x2951,
+    0x278d, 0xa4c2, 0xad34, 0xb018, 0xb085, 0xb00f, 0xaf97, 0xb025, 0xae8c,
+    0xa835, 0x244d, 0x2825, 0x2b0e, 0x2ca5, 0x2be1, 0x2676, 0xa701, 0xadf3,
+    0xb015, 0xafb1, 0xade8, 0xac00, 0xa8e4, 0xa043, 0x289c, 0x2dac, 0x2fec,
+    0x3029, 0x303d, 0x308c, 0x305c, 0x2e24, 0x2935, 0x96e9, 0xabf3, 0xb0d8,
+    0xb424, 0xb528, 0xb425, 0xaf7e, 0x27b6, 0x30ba, 0x3217, 0x320c, 0x342d,
+    0x3582, 0x34a2, 0x3299, 0x2fce, 0xa19f, 0xad84, 0xae9f, 0xb1c7, 0xb3ff,
+    0xb31b, 0x2ed3, 0x2a80, 0xaaf2, 0xb138, 0xb3e6, 0xb47e, 0xb481, 0xb4a4,
+    0xb504, 0xb487, 0xb204, 0xae02, 0xa742, 0x2893, 0x2c68, 0x297f, 0xa57c,
+    0xae8c, 0xb275, 0xb455, 0xb48a, 0xb3ec, 0xb1b0, 0xae06, 0x9d1d, 0x2d29,
+    0x30d4, 0x323b, 0x32e8, 0x333b, 0x3351, 0x32f4, 0x3178, 0x2e40, 0x27ec,
+    0xa9ab, 0xb061, 0xb383, 0xb49b, 0xb319, 0xaa4d, 0x3031, 0x3456, 0x3561,
+    0x3552, 0x3628, 0x37a8, 0x371e, 0x358f, 0x3371, 0x2a5e, 0xae36, 0xb11c,
+    0xb320, 0xb467, 0xb334, 0xb348, 0xb1ae, 0xae22, 0xa5d0, 0x2119, 0x9dd0,
+    0xacac, 0xb08a, 0xb048, 0xaa76, 0x2799, 0x2a92, 0x94f1, 0xadd7, 0xb04c,
+    0xae26, 0xaa62, 0xa89f, 0xa010, 0x2a19, 0x2ec3, 0x3109, 0x31f5, 0x3157,
+    0x2d1a, 0xa833, 0xaddb, 0xacc9, 0xa896, 0xa4be, 0x1f17, 0x1364, 0xa3d7,
+    0x2914, 0x2f48, 0x31ac, 0x3276, 0x3155, 0x302f, 0x2f80, 0x2a66, 0x1b2d,
+    0xa8b2, 0xb0b3, 0xb43d, 0xb659, 0xb77a, 0xb70a, 0xb6cf, 0xb67c, 0xb655,
+    0xb775, 0xb7ed, 0xb6be, 0xb6eb, 0xb840, 0xb137, 0xaf44, 0xa85a, 0x28ba,
+    0x2ce4, 0x2c00, 0x9de4, 0xacd9, 0xac95, 0x222f, 0x2e64, 0x3039, 0x2d7f,
+    0xa058, 0xac9f, 0xac12, 0xa901, 0xa880, 0xa394, 0x26c9, 0x2c58, 0x2ec9,
+    0x3059, 0x3069, 0x2cb4, 0xa87a, 0xaf1f, 0xaf74, 0xad69, 0xabb2, 0xa7db,
+    0xa8a9, 0xaa17, 0x105a, 0x2bf1, 0x2ff0, 0x3115, 0x3070, 0x2f9a, 0x2ff8,
+    0x2d40, 0x2bf0, 0x2c4f, 0x2880, 0xa0ef, 0xae4b, 0xb115, 0xb0e6, 0xb117,
+    0xb097, 0xafe2, 0xb25a, 0xb42f, 0xb310, 0xb35b, 0xb54d, 0xb193, 0xafa1,
+    0xa9ab, 0x25fd, 0x2c44, 0x2abd, 0xa4a8, 0xada0, 0xad4a, 0x1c18, 0x2e35,
+    0x3065, 0x2e93, 0x248b, 0xab16, 0xacbb, 0xace9, 0xacd1, 0xa999, 0x9457,
+    0x275e, 0x2ae2, 0x2d2c, 0x2d90, 0x2713, 0xacce, 0xb0d0, 0xb0fd, 0xaf23,
+    0xac1a, 0xa6db, 0xa9b1, 0xac96, 0xa956, 0x1477, 0x2b1f, 0x2de1, 0x2d9d,
+    0x2e6c, 0x2ffe, 0x2e20, 0x2e19, 0x305d, 0x3117, 0x3183, 0x301a, 0x2dde,
+    0x2ccb, 0x2a74, 0x2cf8, 0x3006, 0x2c2c, 0xa384, 0x1df8, 0x1ec8, 0xadc8,
+    0xb195, 0xafb7, 0xab68, 0x9c7d, 0x281c, 0x2364, 0xaa75, 0xaecb, 0xad6e,
+    0x2155, 0x2e04, 0x2f45, 0x2cdc, 0x2430, 0xa8e1, 0xac79, 0xae06, 0xae6d,
+    0xac0a, 0xa31b, 0x2376, 0x283c, 0x2aec, 0x2b3e, 0x86d1, 0xad69, 0xb016,
+    0xade4, 0xa0b8, 0x2ac7, 0x2ca2, 0x21fb, 0xac23, 0xad08, 0xac8b, 0xa9b4,
+    0xa658, 0x9f02, 0x2b60, 0x2e16, 0x2a72, 0x2873, 0x2bc8, 0x2c63, 0x2c37,
+    0x29dd, 0x2cfa, 0x2ef9, 0x2e5f, 0x30ff, 0x3403, 0x32f5, 0x3068, 0x3153,
+    0x3181, 0x2cda, 0xae5c, 0xaa10, 0x205d, 0x29bc, 0x2c66, 0x299b, 0xa450,
+    0xaba0, 0xa51c, 0x2dd0, 0x31b0, 0x321c, 0x3103, 0x2fab, 0x2d52, 0x2a22,
+    0x24c1, 0x246e, 0x2c2b, 0x301b, 0x3170, 0x3260, 0x335f, 0x3363, 0x3151,
+    0x2d8e, 0x2bef, 0x2f9e, 0x32dc, 0x3458, 0x3443, 0x315c, 0x299a, 0xa47e,
+    0xa971, 0xa994, 0xa991, 0xa272, 0x2d92, 0x2f8c, 0x27f9, 0xa6a1, 0xa8c9,
+    0xab1a, 0xad04, 0xad6d, 0x23ba, 0x307f, 0x3198, 0x3406, 0x35eb, 0x359e,
+    0x347e, 0x34e1, 0x34b5, 0x3210, 0x9e28, 0x9e27, 0x9e28, 0x9e27, 0x9e28,
+    0x9e27, 0x9e28, 0x9e27, 0x9e27, 0x9e27, 0x9e27, 0x9e27, 0x9e27, 0x9e28,
+    0x9e27, 0x9e27, 0x9e27, 0x9e27, 0x9e27, 0x9e27, 0x9e27, 0x9e27, 0x9e27,
+    0x9e27, 0x9e27, 0x9e27, 0x9e27, 0x9e27, 0x9e28, 0x9e27, 0x9e28, 0x9e26,
+    0x9e2a, 0x9e25, 0x9e2b, 0x9e24, 0x9e2b, 0x9e24, 0x9e2a, 0x9e25, 0x9e29,
+    0x9e26, 0x9e28, 0x9e26, 0x9e29, 0x9e26, 0x9e29, 0x9e26, 0x9e29, 0x9e27,
+    0x9e28, 0x9e27, 0x9e27, 0x9e28, 0x9e27, 0x9e28, 0x9e27, 0x9e28, 0x9e27,
+    0x9e28, 0x9e27, 0x9e28, 0x9e27, 0x9e28, 0x9e27, 0x9e27, 0x9e27, 0x9e27,
+    0x9e28, 0x9e27, 0x9e28, 0x9e27, 0x9e27, 0x9e27, 0x9e27, 0x9e27, 0x9e27,
+    0x9e27, 0x9e27, 0x9e27, 0x9e27, 0x9e27, 0x9e27, 0x9e27, 0x9e27, 0x9e28,
+    0x9e26, 0x9e29, 0x9e25, 0x9e2b, 0x9e24, 0x9e2c, 0x9e23, 0x9e2b, 0x9e24,
+    0x9e2a, 0x9e26, 0x9e29, 0x9e26, 0x9e28, 0x9e26, 0x9e29, 0x9e26, 0x9e29,
+    0x9e26, 0x9e28, 0x9e27, 0x9e27, 0x9e28, 0x9e27, 0x9e28, 0x9e27, 0x9e28,
+    0x9e27, 0x9e28, 0x9e27, 0x9e28, 0x9e27, 0x9e28, 0x9e27, 0x9e27, 0x9e27,
+    0x9e27, 0x9e27, 0x9e27, 0x9e28, 0x9e27, 0x9e28, 0x9e27, 0x9e27, 0x9e27,
+    0x9e27, 0x9e27, 0x9e27, 0x9e27, 0x9e27, 0x9e27, 0x9e27, 0x9e27, 0x9e27,
+    0x9e28, 0x9e27, 0x9e28, 0x9e26, 0x9e2a, 0x9e24, 0x9e2b, 0x9e23, 0x9e2c,
+    0x9e24, 0x9e2b, 0x9e25, 0x9e29, 0x9e26, 0x9e28, 0x9e26, 0x9e29, 0x9e26,
+    0x9e29, 0x9e26, 0x9e29, 0x9e26, 0x9e28, 0x9e27, 0x9e27, 0x9e28, 0x9e27,
+    0x9e28, 0x9e27, 0x9e28, 0x9e27, 0x9e28, 0x9e27, 0x9e28, 0x9e27, 0x9e28,
+    0x9e27, 0x9e27, 0x9e27, 0x9e27, 0x9e28, 0x9e27, 0x9e28, 0x9e27, 0x9e27,
+    0x9e27, 0x9e27, 0x9e27, 0x9e27, 0x9e27, 0x9e27, 0x9e27, 0x9e27, 0x9e27,
+    0x9e27, 0x9e27, 0x9e27, 0x9e28, 0x9e26, 0x9e29, 0x9e25, 0x9e2b, 0x9e24,
+    0x9e2c, 0x9e23, 0x9e2b, 0x9e24, 0x9e2a, 0x9e26, 0x9e29, 0x9e26, 0x9e28,
+    0x9e26, 0x9e29, 0x9e26, 0x9e29, 0x9e26, 0x9e28, 0x9e27, 0x9e27, 0x9e28,
+    0x9e27, 0x9e28, 0x9e27, 0x9e28, 0x9e27, 0x9e28, 0x9e27, 0x9e28, 0x9e27,
+    0x9e28, 0x9e27, 0x9e27, 0x9e27, 0x9e27, 0x9e27, 0x9e27, 0x9e28, 0x9e27,
+    0x9e27, 0x9e27, 0x9e27, 0x9e27, 0x9e27, 0x9e27, 0x9e27, 0x9e27, 0x9e27,
+    0x9e27, 0x9e27, 0x9e27, 0x9e27, 0x9e28, 0x9e27, 0x9e28, 0x9e26, 0x9e2a,
+    0x9e25, 0x9e2b, 0x9e24, 0x9e2b, 0x9e24, 0x9e2a, 0x9e25, 0x9e29, 0x9e26,
+    0x9e28, 0x9e26, 0x9e29, 0x9e26, 0x9e29, 0x9e26, 0x9e29, 0x9e27, 0x9e28,
+    0x9e27, 0x9e27, 0x9e28, 0x9e27, 0x9e28, 0xb35f, 0xac82, 0x2ea0, 0x32dc,
+    0x334a, 0x31a6, 0x2de7, 0xa0e9, 0xaf3a, 0xb251, 0xb342, 0xb1c4, 0xae12,
+    0xa7d2, 0xa588, 0xa8b6, 0xa2c1, 0x2b34, 0x3028, 0x3100, 0x2ffc, 0x2bf2,
+    0x19cc, 0xa216, 0x24b9, 0x2b6f, 0x2ea7, 0x3165, 0x32f1, 0x3334, 0x334b,
+    0x33d8, 0x3425, 0x33bd, 0x3255, 0x2fb5, 0x2638, 0xa973, 0xb072, 0xb19a,
+    0xb162, 0xb0bc, 0xabc7, 0x20cd, 0x263b, 0x2235, 0xa0b7, 0x9cec, 0xa322,
+    0xaaf5, 0xaa1e, 0x2847, 0x2e8f, 0x213c, 0x99f8, 0x2df4, 0xb0ab, 0xa37f,
+    0x2fb8, 0x328e, 0x32a2, 0x30ff, 0x2d40, 0x9835, 0xacca, 0xb01e, 0xb07e,
+    0xadf7, 0xa7a2, 0x10ab, 0xa40b, 0xaa53, 0xab15, 0xa744, 0x21d6, 0x2815,
+    0x2416, 0xa7fd, 0xad9a, 0xafa8, 0xafa6, 0xaef3, 0xadb6, 0xaa59, 0xa18a,
+    0x21f7, 0x28d8, 0x2d24, 0x3002, 0x30f0, 0x3183, 0x3118, 0x2ec2, 0x2bd6,
+    0xa05c, 0xa904, 0xaa36, 0xa82d, 0x2b16, 0x2e90, 0x2e43, 0x2d72, 0x2a91,
+    0x27a6, 0x11a9, 0xacd2, 0xadee, 0x9f0a, 0x2e1c, 0x2a30, 0x2984, 0x3190,
+    0xaad4, 0x2947, 0x2ffc, 0x3154, 0x30ac, 0x2dfc, 0x27d0, 0xa7ae, 0xac06,
+    0xac64, 0xa93f, 0x2587, 0x2c23, 0x2ba7, 0x2476, 0xa933, 0xad6b, 0xae8a,
+    0xadcb, 0xac62, 0xac2e, 0xae53, 0xb136, 0xb36a, 0xb48e, 0xb526, 0xb578,
+    0xb561, 0xb513, 0xb4bf, 0xb451, 0xb34a, 0xb169, 0xae18, 0x1cdf, 0x2e19,
+    0x3030, 0x3077, 0x2ee8, 0x2cba, 0x2494, 0x9c03, 0x2ae4, 0x2bbc, 0x2632,
+    0x26a7, 0x21fa, 0x9bb6, 0x99bc, 0xaca8, 0xaed4, 0xa8ae, 0x2c2e, 0x2a12,
+    0x2c2b, 0x337b, 0x2ae1, 0x2f9f, 0x30e5, 0x30a4, 0x2e52, 0x2898, 0xa5b3,
+    0xac51, 0xac71, 0xa8c5, 0x2633, 0x2efa, 0x30e4, 0x302f, 0x2bfb, 0xa795,
+    0xafa1, 0xb1b9, 0xb1fc, 0xb0e8, 0xb016, 0xb101, 0xb3b5, 0xb59b, 0xb741,
+    0xb840, 0xb8a6, 0xb8cc, 0xb8c3, 0xb8ad, 0xb899, 0xb873, 0xb80f, 0xb680,
+    0xb335, 0x9f7a, 0x3146, 0x3449, 0x349b, 0x3373, 0x2e85, 0x243b, 0x24e7,
+    0xa72f, 0xae3f, 0xad40, 0xac16, 0xaa7c, 0x1a4f, 0xa7ce, 0xaca1, 0xa869,
+    0x2819, 0x2700, 0x2cca, 0x344f, 0x2c76, 0x306a, 0x30e5, 0x2f75, 0x29d4,
+    0xa93d, 0xaf8a, 0xb185, 0xb169, 0xaf76, 0xa855, 0x2c4c, 0x302a, 0x2ff3,
+    0x2aa6, 0xac8d, 0xb29b, 0xb4d3, 0xb51f, 0xb45a, 0xb33c, 0xb400, 0xb5a4,
+    0xb7f2, 0xb916, 0xb9e7, 0xba5f, 0xba86, 0xba78, 0xba5f, 0xba5b, 0xba57,
+    0xba0f, 0xb916, 0xb616, 0xa84b, 0x3485, 0x37bf, 0x385c, 0x3750, 0x3404,
+    0x2e9f, 0x2bb1, 0xa53b, 0xaece, 0xadfc, 0xaca0, 0xaa8c, 0x280b, 0x27a4,
+    0xa5cf, 0xa6f2, 0x19bf, 0x18d0, 0x2d49, 0x34aa, 0x3293, 0x2e30, 0x20d0,
+    0xa3b8, 0xa076, 0x1705, 0x29d1, 0x2d9e, 0x27c5, 0xa606, 0x9b87, 0x288f,
+    0x2e61, 0x2f45, 0x2508, 0xacae, 0xae8b, 0xa8e2, 0x2b6b, 0x2db2, 0x238b,
+    0xb144, 0xb5f0, 0xb73d, 0xb572, 0xac52, 0x33fb, 0x376c, 0x3810, 0x3658,
+    0x31b2, 0xab1e, 0xb1c5, 0xb0fe, 0xa97d, 0x1e61, 0x0f9a, 0x24c8, 0xa683,
+    0xab91, 0xa807, 0xa7d0, 0x2011, 0x2efd, 0x2f9a, 0x297a, 0xa500, 0xaaa3,
+    0xa7ba, 0xaa92, 0xb172, 0xb21c, 0xad9a, 0xaf68, 0xac80, 0x356b, 0x30ad,
+    0x2bcc, 0x152b, 0xa429, 0xa76d, 0xa863, 0x21c8, 0x2c49, 0x2726, 0xa2bb,
+    0x18c0, 0x24b4, 0x2a87, 0x2af6, 0xa442, 0xad20, 0xad95, 0xa031, 0x2db3,
+    0x2f4c, 0x2909, 0xb098, 0xb5c1, 0xb734, 0xb589, 0xad6f, 0x327d, 0x35f3,
+    0x35ec, 0x335f, 0x9825, 0xb30c, 0xb4cf, 0xb32b, 0xac1b, 0x2629, 0x290c,
+    0x2abb, 0x1d8c, 0xa294, 0x2447, 0x1992, 0xa173, 0x2796, 0x28bd, 0x16e0,
+    0xa1f2, 0xa5f3, 0x2366, 0x29d7, 0xa27a, 0xa676, 0x2888, 0xa910, 0xa6bb,
+    0x3477, 0x2c32, 0x25f5, 0x2391, 0x1f42, 0xa6b3, 0xa8c1, 0x22a6, 0x2c01,
+    0x2605, 0xa38b, 0x8dea, 0x246a, 0x2ada, 0x2c0b, 0xa486, 0xae5e, 0xaea8,
+    0x1786, 0x2f62, 0x2fd6, 0x1f6d, 0xb2f4, 0xb746, 0xb84a, 0xb66c, 0xaead,
+    0x3279, 0x35b1, 0x3505, 0x301e, 0xb05b, 0xb59f, 0xb64c, 0xb443, 0xaadd,
+    0x2d77, 0x2f8e, 0x2f74, 0x2bbb, 0x2750, 0x2641, 0xa521, 0xaa76, 0xa7d1,
+    0xa7ed, 0xa942, 0xa316, 0x9857, 0x2606, 0x2c4b, 0x2a03, 0x2969, 0x2d33,
+    0x23d6, 0x2246, 0x328b, 0xa8f9, 0xaa6e, 0xa74b, 0xa68b, 0xab92, 0xac15,
+    0x2313, 0x2d34, 0x28ad, 0xa498, 0xa476, 0x9c65, 0x2a0c, 0x2dad, 0x26ac,
+    0xacde, 0xaec4, 0x247b, 0x316c, 0x3135, 0xa827, 0xb583, 0xb8f7, 0xb964,
+    0xb740, 0xaac0, 0x352f, 0x37c2, 0x3657, 0x30cc, 0xb122, 0xb619, 0xb671,
+    0xb3dc, 0x1bec, 0x31b8, 0x32ca, 0x3216, 0x2ffe, 0x2b71, 0x199a, 0xace5,
+    0xae2b, 0xaab2, 0xa9c2, 0xa9d8, 0x9c8d, 0x246b, 0x230b, 0x2766, 0x22a4,
+    0x86d1, 0x2972, 0x2895, 0x29de, 0x30f0, 0xacbd, 0xad70, 0xaad0, 0xa9f2,
+    0xacbc, 0xa9f6, 0x2c7e, 0x3160, 0x3024, 0x2c52, 0x2b86, 0x2ca0, 0x3013,
+    0x30a6, 0x261c, 0xb094, 0xb247, 0xa853, 0x3192, 0x314e, 0xae9a, 0xb7f9,
+    0xba54, 0xba2e, 0xb6a3, 0x302b, 0x38c8, 0x3a1b, 0x38cc, 0x3418, 0xaf5d,
+    0xb56f, 0xb58b, 0xb202, 0x2c1b, 0x33e9, 0x345d, 0x33bb, 0x31cd, 0x2e77,
+    0x2418, 0xad57, 0xae4b, 0xa8a8, 0xa650, 0xa6b1, 0x2394, 0x26bb, 0x980a,
+    0xa857, 0xac67, 0xad6d, 0xa48b, 0x28f1, 0x2ce2, 0x30d0, 0x9ae4, 0x9ae4,
+    0x9ae4, 0x9ae4, 0x9ae4, 0x9ae4, 0x9ae4, 0x9ae4, 0x9ae4, 0x9ae5, 0x9ae4,
+    0x9ae5, 0x9ae3, 0x9ae6, 0x9ae2, 0x9ae6, 0x9ae2, 0x9ae6, 0x9ae2, 0x9ae5,
+    0x9ae4, 0x9ae4, 0x9ae5, 0x9ae3, 0x9ae6, 0x9ae2, 0x9ae6, 0x9ae3, 0x9ae5,
+    0x9ae4, 0x9ae4, 0x9ae5, 0x9ae4, 0x9ae5, 0x9ae3, 0x9ae5, 0x9ae4, 0x9ae4,
+    0x9ae4, 0x9ae4, 0x9ae5, 0x9ae4, 0x9ae5, 0x9ae3, 0x9ae5, 0x9ae4, 0x9ae5,
+    0x9ae4, 0x9ae4, 0x9ae5, 0x9ae3, 0x9ae6, 0x9ae2, 0x9ae7, 0x9ae1, 0x9ae7,
+    0x9ae4, 0x9ae4, 0x9ae4, 0x9ae4, 0x9ae4, 0x9ae4, 0x9ae4, 0x9ae4, 0x9ae5,
+    0x9ae4, 0x9ae5, 0x9ae3, 0x9ae6, 0x9ae3, 0x9ae6, 0x9ae2, 0x9ae7, 0x9ae2,
+    0x9ae6, 0x9ae3, 0x9ae5, 0x9ae5, 0x9ae3, 0x9ae6, 0x9ae2, 0x9ae7, 0x9ae2,
+    0x9ae6, 0x9ae3, 0x9ae5, 0x9ae4, 0x9ae4, 0x9ae5, 0x9ae3, 0x9ae5, 0x9ae3,
+    0x9ae5, 0x9ae4, 0x9ae4, 0x9ae5, 0x9ae4, 0x9ae5, 0x9ae3, 0x9ae5, 0x9ae3,
+    0x9ae5, 0x9ae4, 0x9ae4, 0x9ae5, 0x9ae3, 0x9ae6, 0x9ae2, 0x9ae7, 0x9ae1,
+    0x9ae7, 0x9ae1, 0x9ae4, 0x9ae4, 0x9ae4, 0x9ae4, 0x9ae4, 0x9ae4, 0x9ae4,
+    0x9ae4, 0x9ae4, 0x9ae5, 0x9ae3, 0x9ae5, 0x9ae3, 0x9ae6, 0x9ae2, 0x9ae7,
+    0x9ae2, 0x9ae7, 0x9ae2, 0x9ae6, 0x9ae4, 0x9ae4, 0x9ae5, 0x9ae2, 0x9ae6,
+    0x9ae2, 0x9ae6, 0x9ae2, 0x9ae6, 0x9ae4, 0x9ae4, 0x9ae5, 0x9ae3, 0x9ae5,
+    0x9ae3, 0x9ae5, 0x9ae4, 0x9ae4, 0x9ae4, 0x9ae4, 0x9ae5, 0x9ae4, 0x9ae5,
+    0x9ae3, 0x9ae5, 0x9ae4, 0x9ae5, 0x9ae4, 0x9ae4, 0x9ae5, 0x9ae3, 0x9ae6,
+    0x9ae2, 0x9ae7, 0x9ae1, 0x9ae7, 0x9ae4, 0x9ae4, 0x9ae4, 0x9ae4, 0x9ae4,
+    0x9ae4, 0x9ae4, 0x9ae4, 0x9ae5, 0x9ae4, 0x9ae5, 0x9ae3, 0x9ae6, 0x9ae3,
+    0x9ae6, 0x9ae2, 0x9ae7, 0x9ae2, 0x9ae6, 0x9ae3, 0x9ae5, 0x9ae5, 0x9ae3,
+    0x9ae6, 0x9ae2, 0x9ae7, 0x9ae2, 0x9ae6, 0x9ae3, 0x9ae5, 0x9ae4, 0x9ae4,
+    0x9ae5, 0x9ae3, 0x9ae5, 0x9ae3, 0x9ae5, 0x9ae4, 0x9ae4, 0x9ae5, 0x9ae4,
+    0x9ae5, 0x9ae3, 0x9ae5, 0x9ae3, 0x9ae5, 0x9ae4, 0x9ae4, 0x9ae5, 0x9ae3,
+    0x9ae6, 0x9ae2, 0x9ae7, 0x9ae1, 0x9ae7, 0x9ae1, 0x9ae4, 0x9ae4, 0x9ae4,
+    0x9ae4, 0x9ae4, 0x9ae4, 0x9ae4, 0x9ae4, 0x9ae4, 0x9ae5, 0x9ae4, 0x9ae5,
+    0x9ae3, 0x9ae6, 0x9ae2, 0x9ae6, 0x9ae2, 0x9ae6, 0x9ae2, 0x9ae5, 0x9ae4,
+    0x9ae4, 0x9ae5, 0x9ae3, 0x9ae6, 0x9ae2, 0x9ae6, 0x9ae3, 0x9ae5, 0x9ae4,
+    0x9ae4, 0x9ae5, 0x9ae4, 0x9ae5, 0x9ae3, 0x9ae5, 0x9ae4, 0x9ae4, 0x9ae4,
+    0x9ae4, 0x9ae5, 0x9ae4, 0x9ae5, 0x9ae3, 0x9ae5, 0x9ae4, 0x9ae5, 0x9ae4,
+    0x9ae4, 0x9ae5, 0x9ae3, 0x9ae6, 0x9ae2, 0x9ae7, 0x9ae1, 0x9ae7, 0xacaa,
+    0xa953, 0xa582, 0xa54b, 0xa53a, 0x1bc3, 0x2b5b, 0x2eb0, 0x305d, 0x30ce,
+    0x305d, 0x2e2b, 0x291d, 0xa186, 0xad47, 0xb221, 0xb498, 0xb581, 0xb621,
+    0xb6cc, 0xb74d, 0xb722, 0xb65c, 0xb554, 0xb452, 0xb32c, 0xb21b, 0xb0c3,
+    0xae0d, 0xa7ef, 0x28f4, 0x2e7a, 0x3106, 0x3232, 0x32f1, 0x338a, 0x32b2,
+    0x2de2, 0xadb1, 0xb271, 0xb382, 0xb3b6, 0xb161, 0xad66, 0xa91a, 0x2c3c,
+    0x327e, 0x3352, 0x2fc1, 0x25d0, 0x24e9, 0x2cd5, 0x2d99, 0x2dfa, 0x3016,
+    0x32b1, 0xaa1b, 0xa802, 0xa6e3, 0xa89f, 0xa9f9, 0xa811, 0x2422, 0x2c3a,
+    0x2f38, 0x30e9, 0x3174, 0x311e, 0x3051, 0x2f2f, 0x2c7e, 0x961a, 0xac46,
+    0xaf29, 0xb0ea, 0xb2e4, 0xb485, 0xb4ee, 0xb499, 0xb406, 0xb323, 0xb29e,
+    0xb22e, 0xb161, 0xb025, 0xad5a, 0xa82e, 0x24e8, 0x2ce2, 0x3048, 0x324d,
+    0x342f, 0x3484, 0x32c2, 0x2ad5, 0xaba3, 0xad4d, 0xad9c, 0xaa09, 0xa2ea,
+    0xa1ab, 0x2ad2, 0x30c1, 0x317c, 0x2eac, 0x2816, 0x2524, 0x2c4c, 0x2c4e,
+    0x2b7f, 0x2c18, 0x3062, 0xa7c4, 0xa70d, 0xa987, 0xac61, 0xad92, 0xad8b,
+    0xaaa5, 0x9b0d, 0x2a38, 0x2ea3, 0x308b, 0x30fc, 0x3124, 0x317e, 0x31a2,
+    0x311e, 0x306d, 0x2f90, 0x2da4, 0x262d, 0xabff, 0xaf97, 0xb00e, 0xaf74,
+    0xaf56, 0xb00e, 0xb09f, 0xb0de, 0xb0a3, 0xb040, 0xaff5, 0xaf54, 0xad45,
+    0xa541, 0x2c96, 0x31c4, 0x3412, 0x33b8, 0x2f90, 0x21f5, 0x9871, 0xa073,
+    0x1fb2, 0x1834, 0xa8f2, 0xa4c0, 0x274a, 0x2b39, 0x2bad, 0x2781, 0x9cf2,
+    0x242d, 0x2108, 0xa43d, 0xa843, 0x28ab, 0x9c7a, 0xa001, 0xa8a1, 0xacca,
+    0xaeb3, 0xaf88, 0xaee2, 0xad1a, 0xa99b, 0x0c25, 0x2a31, 0x2e01, 0x3050,
+    0x3192, 0x32b6, 0x3373, 0x33f5, 0x3438, 0x3449, 0x3352, 0x3061, 0x2a88,
+    0x22fc, 0x1fef, 0x176d, 0xa56c, 0xaafe, 0xad70, 0xaf92, 0xb10c, 0xb2af,
+    0xb43a, 0xb478, 0xb352, 0xafa5, 0x25e6, 0x309d, 0x31ce, 0x2eb5, 0x26f7,
+    0x2748, 0x26ee, 0x2916, 0x25f2, 0xa928, 0xaa34, 0xa97f, 0xa374, 0x28f2,
+    0x2850, 0xa8e9, 0xaabf, 0xac4a, 0xae48, 0xaf2f, 0xaa40, 0x1dea, 0x97be,
+    0xa84c, 0xacd2, 0xaf4c, 0xb08f, 0xb12d, 0xb134, 0xb0e9, 0xb029, 0xad31,
+    0xa1bb, 0x2bc0, 0x2fd4, 0x31b3, 0x332f, 0x3426, 0x34d4, 0x359d, 0x35a2,
+    0x344c, 0x30fe, 0x2d66, 0x2b2c, 0x29d0, 0x2827, 0x245d, 0x983d, 0xab04,
+    0xb0a7, 0xb413, 0xb5cd, 0xb6a1, 0xb608, 0xb437, 0xae80, 0x2a01, 0x2f42,
+    0x2c86, 0x25c4, 0x2a8c, 0x2cc9, 0x2eb6, 0x2e69, 0x2884, 0x2435, 0x9b49,
+    0x2140, 0x2d14, 0x2cb6, 0xa967, 0xadf6, 0xaec8, 0xb01e, 0xb059, 0xad6b,
+    0xb659, 0xb51f, 0xb354, 0xb099, 0xa9dd, 0x2967, 0x2de8, 0x2e01, 0x2d67,
+    0x2c75, 0x280f, 0x9f52, 0x16b6, 0x2cf9, 0x3180, 0x3235, 0x3030, 0x28e5,
+    0xaa00, 0xaebc, 0xafa1, 0xb01e, 0xb1d6, 0xb457, 0xb609, 0xb7d4, 0xb89e,
+    0xb8ef, 0xb8d7, 0xb872, 0xb787, 0xb5bd, 0xb3c3, 0xb10c, 0xafdb, 0xaeb4,
+    0xab63, 0x2546, 0x2d4e, 0x2ccd, 0x205f, 0xad90, 0xb0ca, 0xb0eb, 0xaecf,
+    0xab98, 0xa880, 0xa8db, 0xa7e2, 0x9efd, 0x298d, 0x3088, 0x31f2, 0x302f,
+    0x2c3d, 0x15e4, 0xb3a7, 0xb090, 0xa8d2, 0x2a2e, 0x2fde, 0x31cd, 0x323d,
+    0x3155, 0x309f, 0x300c, 0x2d52, 0x270f, 0x20cc, 0x2b8e, 0x30a8, 0x31c5,
+    0x30cc, 0x2e51, 0x2908, 0xa3c5, 0xa882, 0xaa0c, 0xadcb, 0xb11d, 0xb407,
+    0xb5b8, 0xb72a, 0xb7f9, 0xb806, 0xb7a0, 0xb6ad, 0xb541, 0xb393, 0xb17c,
+    0xb09c, 0xafe6, 0xac57, 0x2703, 0x2f87, 0x3071, 0x2dc8, 0x99bb, 0xacd3,
+    0xadee, 0xac51, 0xa822, 0x202a, 0x2384, 0x9bf0, 0x2072, 0x2a4d, 0x2fd4,
+    0x30e5, 0x2fe8, 0x2e04, 0x2bd8, 0xaefc, 0x0e6c, 0x2f49, 0x3270, 0x3435,
+    0x34a0, 0x3433, 0x3280, 0x313b, 0x30a1, 0x2ea3, 0x298a, 0x1ac4, 0x271b,
+    0x2e7f, 0x3067, 0x300e, 0x2f68, 0x2e12, 0x2aa3, 0x23ad, 0xa593, 0xac9a,
+    0xb00e, 0xb20a, 0xb433, 0xb552, 0xb622, 0xb68e, 0xb6b7, 0xb65d, 0xb56a,
+    0xb449, 0xb308, 0xb26e, 0xb1de, 0xb047, 0xa925, 0x2c51, 0x2fc6, 0x2e61,
+    0x22ca, 0xac0e, 0xadc0, 0xadcc, 0xac6e, 0xa0d3, 0x2367, 0xa465, 0xa206,
+    0x248d, 0x2b3a, 0x2b2d, 0x2982, 0x2b09, 0x2c9e, 0xaaf6, 0x28ae, 0x300f,
+    0x3295, 0x3440, 0x347a, 0x338d, 0x318e, 0x30db, 0x30fa, 0x3003, 0x2bd0,
+    0x95da, 0xa4c2, 0x2466, 0x2a7d, 0x2c7b, 0x2e9a, 0x2ff2, 0x2e9b, 0x2c66,
+    0x2850, 0x0c4f, 0xa555, 0xa98d, 0xad62, 0xb078, 0xb2b1, 0xb49f, 0xb5b0,
+    0xb62e, 0xb60a, 0xb582, 0xb4fb, 0xb497, 0xb410, 0xb22f, 0xadf2, 0x2928,
+    0x3036, 0x3060, 0x2b4c, 0xa2a5, 0xa841, 0xaa98, 0xaa82, 0x1bb5, 0x2492,
+    0xa9cf, 0xabe0, 0xaa0b, 0xa854, 0xac70, 0xacbe, 0xa614, 0x2960, 0x2b01,
+    0x2b41, 0x2b07, 0x2c7a, 0x2e43, 0x2dd8, 0x28f3, 0xa13f, 0x1f9e, 0x2bc2,
+    0x2b93, 0x9dc3, 0xad92, 0xb019, 0xaeb6, 0xaa49, 0x247e, 0x2e91, 0x31b3,
+    0x3286, 0x32ab, 0x32fc, 0x338d, 0x343d, 0x3466, 0x33a0, 0x313a, 0x2a43,
+    0xaedc, 0xb430, 0xb5e5, 0xb6bd, 0xb6d8, 0xb670, 0xb5a2, 0xb46d, 0xb18e,
+    0xa6ee, 0x314c, 0x34cc, 0x3560, 0x347a, 0x3342, 0x32ef, 0x31b0, 0x3047,
+    0x3066, 0x2e6d, 0xa085, 0xa9cf, 0xa982, 0xab20, 0xb044, 0xb0e0, 0xace2,
+    0x26b6, 0xb052, 0xb375, 0xb560, 0xb5ef, 0xb52e, 0xb3cb, 0xb25c, 0xb1ef,
+    0xb1c2, 0xb0fe, 0xaed7, 0xac1c, 0xaaa3, 0xa8ae, 0x9533, 0x206a, 0xa5d3,
+    0xabd9, 0xac46, 0xa570, 0x2a7f, 0x2ddd, 0x2c2e, 0x27fc, 0x2b16, 0x2f3c,
+    0x2f66, 0x2920, 0xa645, 0xab53, 0xad03, 0xabf5, 0x9895, 0x2cf1, 0x3085,
+    0x31f4, 0x33e4, 0x34ee, 0x350a, 0x34d4, 0x3399, 0x31f1, 0x2f99, 0xa591,
+    0xb1bd, 0xb415, 0xb407, 0xb382, 0xb174, 0xad9f, 0xa108, 0xa0ce, 0xab1b,
+    0xa407, 0xac90, 0xb3f1, 0xaf78, 0xb244, 0xb45d, 0xb488, 0xb29b, 0xae8f,
+    0xab02, 0xaab8, 0xab4c, 0xa997, 0xa32a, 0x1c36, 0x950a, 0x1244, 0x248c,
+    0x2473, 0x9927, 0xa4e9, 0xa402, 0x21a0, 0x2b14, 0x2d87, 0x2c4b, 0x2909,
+    0x2be2, 0x2f92, 0x3058, 0x2ddf, 0x2b35, 0x2626, 0xa6f0, 0xa8d5, 0x2539,
+    0x2f30, 0x31fb, 0x32ef, 0x3372, 0x338c, 0x328d, 0x31ca, 0x2f01, 0x2b0e,
+    0x01f7, 0xad50, 0xb117, 0xb21e, 0xb1a6, 0xb082, 0xad4f, 0xa73e, 0x2acb,
+    0x2dde, 0x2cc9, 0x2e9e, 0x2b76, 0xace8, 0xab06, 0xaffe, 0xb1d4, 0xb17b,
+    0xacad, 0x29c7, 0x2ddd, 0x2d99, 0x2d26, 0x2d97, 0x2e59, 0x2dbf, 0x2b48,
+    0x28c8, 0x28ae, 0x28b8, 0x292d, 0x2a58, 0x2a0e, 0x2645, 0x24a0, 0x290b,
+    0x286e, 0x2316, 0x2774, 0x2cc6, 0x2e56, 0x2dfe, 0x2e1c, 0x2c57, 0x9930,
+    0xa459, 0x2bd9, 0x318d, 0x341c, 0x342b, 0x324f, 0x2d25, 0xa9dc, 0xadcf,
+    0xb013, 0xb0e1, 0xb1ee, 0xb266, 0xb149, 0xafa6, 0xadad, 0xa96d, 0x1cc3,
+    0x21fd, 0x2c44, 0x302e, 0x3091, 0x3193, 0x3104, 0x2ca3, 0x1de4, 0xac4c,
+    0xafe5, 0xae9c, 0x230f, 0x3096, 0x321e, 0x31c0, 0x3193, 0x31f4, 0x31dc,
+    0x30b0, 0x2e03, 0x2bc7, 0x2a34, 0x2b39, 0x2dc1, 0x2fa7, 0x2e43, 0x2523,
+    0xa879, 0xa5b6, 0x9ca4, 0x14d1, 0x26b3, 0x2c73, 0x2ea4, 0x2fe7, 0x30ae,
+    0x2fe1, 0x2a4b, 0x29c6, 0x30f1, 0x34b4, 0x3621, 0x35ac, 0x326f, 0xabd2,
+    0xb551, 0xb704, 0xb71c, 0xb6ad, 0xb676, 0xb57e, 0xb279, 0xacb2, 0xa70b,
+    0x2099, 0x2a40, 0x2553, 0x2964, 0x2f65, 0x3080, 0x3186, 0x31c9, 0x3060,
+    0xaa8b, 0xb022, 0xb220, 0xb174, 0xaa0f, 0x2d9b, 0x308b, 0x302e, 0x3017,
+    0x30d6, 0x3104, 0x2fa7, 0x2c0d, 0x26d7, 0x2470, 0x2a7d, 0x2ff9, 0x319e,
+    0x305f, 0x2562, 0xac69, 0xac8e, 0xa95a, 0x9e87, 0x2a08, 0x2f51, 0x31bf,
+    0x3355, 0x3428, 0x3310, 0x305b, 0x308d, 0x3478, 0x3739, 0x3884, 0x381d,
+    0x344c, 0xb044, 0xb861, 0xb9e4, 0xba0c, 0xb9be, 0xb968, 0xb87c, 0xb582,
+    0xb0d4, 0xaddb, 0xac27, 0xa077, 0xa6e4, 0xa488, 0x2c18, 0x2daa, 0x2ed2,
+    0x305c, 0x2fd9, 0xb458, 0xaef3, 0x2e30, 0x33f2, 0x344e, 0x3291, 0x3131,
+    0x3166, 0x30b4, 0x3000, 0x2e66, 0x2909, 0xa649, 0xae2a, 0xb1fc, 0xb2ad,
+    0xb050, 0xa84d, 0x2246, 0x9ff6, 0xa476, 0xa024, 0x98a7, 0x2594, 0x2608,
+    0xabbe, 0xb242, 0xb4c9, 0xb592, 0xb4f3, 0xb32e, 0xb1dc, 0xb17d, 0xb0a2,
+    0xac40, 0x9c06, 0xa15c, 0xa783, 0x265a, 0x2d36, 0x3006, 0x31af, 0x3115,
+    0x2ec8, 0x2b51, 0xa8cf, 0x26f3, 0x2d35, 0xa433, 0xab3f, 0x28d4, 0x2f0e,
+    0x304c, 0x31b9, 0x3289, 0x31f0, 0xb45f, 0xaf77, 0x2cc4, 0x3289, 0x3245,
+    0x2ec0, 0x2942, 0x2843, 0x244e, 0x24c2, 0x28e3, 0x2758, 0xa00b, 0xacc9,
+    0xb0c6, 0xb091, 0xab50, 0x2742, 0x2ad5, 0x274e, 0x26b6, 0x299d, 0x2a49,
+    0x2c66, 0x2d4c, 0x294e, 0xa96f, 0xaf40, 0xb140, 0xb145, 0xb044, 0xaf31,
+    0xacea, 0xa58c, 0x2985, 0x2cfd, 0x2c5e, 0x29d9, 0x2daa, 0x305b, 0x31be,
+    0x32d0, 0x3151, 0x2f90, 0x2dd9, 0x9c3e, 0x28d8, 0x2d70, 0x2812, 0x1181,
+    0x2a2c, 0x2e25, 0x2e87, 0x303b, 0x31e8, 0x31b9, 0xb3e5, 0xadab, 0x2dd4,
+    0x3263, 0x3142, 0x2b2e, 0xa6e5, 0xab91, 0xad52, 0xac09, 0x9a0d, 0x2800,
+    0x257e, 0xa842, 0xad6c, 0xaa69, 0x2970, 0x2e98, 0x2dea, 0x292b, 0x2547,
+    0x2778, 0x28c8, 0x2b97, 0x2d55, 0x2d29, 0x2aea, 0x28a3, 0x25b7, 0x1e9d,
+    0xa36a, 0xa563, 0x2652, 0x2dc8, 0x3010, 0x2fcc, 0x2cd1, 0x242e, 0x273a,
+    0x2a32, 0x2dab, 0x2f98, 0x2d65, 0x2b7e, 0x2a84, 0xa900, 0xa8ba, 0x96fc,
+    0x9103, 0xa069, 0x23c4, 0x2ac2, 0x2975, 0x29cc, 0x2fa8, 0x300f, 0xb2f4,
+    0xabaf, 0x2fb4, 0x32f6, 0x315b, 0x292a, 0xab72, 0xaf16, 0xb0d8, 0xafd8,
+    0xa897, 0x246a, 0x2401, 0xa8a7, 0xaca5, 0xa485, 0x2ce0, 0x2f19, 0x2a5c,
+    0xac25, 0xb063, 0xb089, 0xae00, 0x9d92, 0x2d31, 0x3066, 0x3123, 0x3173,
+    0x3177, 0x30c8, 0x2d56, 0x275b, 0x2a4c, 0x2e8e, 0x2f40, 0x2d91, 0x25f0,
+    0xab4b, 0xac0d, 0xac01, 0xa768, 0x9e58, 0xa277, 0x9de5, 0xa617, 0xb064,
+    0xb1ab, 0xb17c, 0xb058, 0xae6a, 0xacdb, 0xa877, 0xaaca, 0xa9e3, 0x2c21,
+    0x2d3e, 0xa5b4, 0x2d94, 0x32fb, 0x346b, 0x3222, 0x245f, 0xb039, 0xb39a,
+    0xb529, 0xb4f8, 0xb2e7, 0xb07d, 0xafc3, 0xb12e, 0xb1f1, 0xaf0b, 0x177d,
+    0x27e1, 0xac74, 0xb3b1, 0xb58a, 0xb4e8, 0xaf81, 0x30e0, 0x361f, 0x3827,
+    0x3887, 0x385f, 0x37ce, 0x3660, 0x3411, 0x2feb, 0x2d9d, 0x2f15, 0x2eef,
+    0x2d85, 0x29ea, 0x9d03, 0x252b, 0x2479, 0x2656, 0x21e0, 0x1f64, 0x2974,
+    0x26a5, 0xae67, 0xb1a0, 0xb292, 0xb132, 0xade4, 0xaa4b, 0x9873, 0xa6c3,
+    0xa04f, 0x302b, 0x30cf, 0xb153, 0xb096, 0xb066, 0xb0c8, 0xb1b6, 0xb2cd,
+    0xb109, 0x2a80, 0x34b8, 0x3515, 0x2cd3, 0xb1f3, 0xb3a2, 0xac84, 0x3139,
+    0x345e, 0x3228, 0x289a, 0xaab9, 0xa59a, 0x2a46, 0x2c16, 0x27c2, 0xa485,
+    0xab61, 0xac7e, 0xab8f, 0xaa9d, 0xac3d, 0xac38, 0xab48, 0xaf0c, 0xb1c7,
+    0xb123, 0xae56, 0x242d, 0x2f24, 0x3012, 0x2f10, 0x2e94, 0x2eb7, 0x2d46,
+    0x2a2e, 0xa0cc, 0x1a19, 0x202f, 0x1a49, 0x2141, 0xae2e, 0xb059, 0x18ea,
+    0x2929, 0xa751, 0x2903, 0x207f, 0xb60a, 0xb240, 0xb19c, 0xb186, 0xb1c3,
+    0xb236, 0xb2a8, 0xb093, 0x2b6d, 0x34ab, 0x34d8, 0x29b7, 0xb32b, 0xb420,
+    0xaaa9, 0x3284, 0x34c3, 0x3177, 0xa8f7, 0xb0fe, 0xaee8, 0x2217, 0x2ce2,
+    0x2c90, 0x281f, 0xa066, 0xa736, 0xa626, 0xa119, 0xa180, 0xa25e, 0x970c,
+    0xaa45, 0xae4a, 0xaa35, 0x1e31, 0x2cd1, 0x308a, 0x30ac, 0x2e46, 0x2b3e,
+    0x2a34, 0x2a63, 0x2a33, 0x1967, 0x0379, 0x2200, 0x260f, 0x2b80, 0xa1f5,
+    0xaadb, 0x29d9, 0x2bd6, 0xa571, 0x28d7, 0x23b2, 0xb5a9, 0xb261, 0xb235,
+    0xb253, 0xb276, 0xb21a, 0xb15d, 0xac49, 0x307c, 0x359a, 0x3515, 0x1df4,
+    0xb4e4, 0xb54d, 0xac42, 0x33f2, 0x35b9, 0x31f8, 0xafb1, 0xb52b, 0xb472,
+    0xad39, 0x2cfe, 0x3041, 0x2ed2, 0x2a12, 0xa3c2, 0xac0a, 0xacc4, 0xaafa,
+    0xa702, 0x9967, 0xa95a, 0xad41, 0xa4b1, 0x28aa, 0x2d5d, 0x301c, 0x2fee,
+    0x2d6e, 0x28fb, 0x1cac, 0x2415, 0x2b35, 0x258d, 0xa490, 0xa2de, 0x16e2,
+    0x2635, 0xa0d9, 0xa5c2, 0x2c04, 0x29b1, 0xabc6, 0x9e16, 0xa307, 0xb5e1,
+    0xb02d, 0xb0dc, 0xb152, 0xb119, 0xafb4, 0xab3d, 0x2d1f, 0x34ce, 0x37d8,
+    0x3683, 0x263c, 0xb590, 0xb637, 0xaca5, 0x3553, 0x3813, 0x353b, 0xad2e,
+    0xb6a9, 0xb6e4, 0xb1eb, 0x2c8f, 0x3230, 0x31e1, 0x2e99, 0xa030, 0xaf47,
+    0xb10c, 0xafd3, 0xab86, 0xa359, 0xa8d7, 0xaaf9, 0x2741, 0x2dde, 0x3086,
+    0x318c, 0x304c, 0x2d2f, 0x2867, 0xa831, 0xa8da, 0x25e5, 0x2635, 0x9a1a,
+    0x198f, 0x16f2, 0xa8d5, 0xac10, 0xa57c, 0x2ca6, 0x264d, 0xae44, 0xaa49,
+    0xac91, 0xb6fa, 0xa253, 0xaca7, 0xaf92, 0xaf68, 0xabeb, 0x2740, 0x3211,
+    0x36d0, 0x38ee, 0x380b, 0x2adf, 0xb652, 0xb77c, 0xaee0, 0x3643, 0x3934,
+    0x37cd, 0x2330, 0xb6f6, 0xb833, 0xb465, 0x24d1, 0x3119, 0x3089, 0x29c1,
+    0xad08, 0xb260, 0xb417, 0xb272, 0xae85, 0xa98b, 0xac6d, 0xacd9, 0x280e,
+    0x2f6f, 0x31d9, 0x333a, 0x3146, 0x2d1a, 0x2472, 0xac3b, 0xad20, 0x9cb6,
+    0x2a5d, 0x2cd1, 0x2e0c, 0x2cb7, 0xa566, 0xac05, 0x2635, 0x30b7, 0x2db1,
+    0xac3f, 0xabcb, 0xafd2, 0xb815, 0x362f, 0x3571, 0x344e, 0x316f, 0x2cf6,
+    0x180f, 0xa5fa, 0x26a6, 0x2f1c, 0x3124, 0x3096, 0x2d2c, 0x2211, 0xa50e,
+    0xa6bb, 0xa178, 0x2cca, 0x329f, 0x3501, 0x356f, 0x3402, 0x2f27, 0x9d2b,
+    0xaea3, 0xb259, 0xb416, 0xb385, 0xb1fb, 0xb281, 0xb3ba, 0xb350, 0xb1cd,
+    0xb045, 0xaff0, 0xb0b7, 0xb1d8, 0xb2a5, 0xb26e, 0xb077, 0xade7, 0xa633,
+    0x204c, 0x2726, 0x2c3c, 0x3247, 0x34c3, 0x3594, 0x34ef, 0x31ea, 0x3313,
+    0x336b, 0x3016, 0xa845, 0xaf82, 0xafdd, 0xb1d8, 0x3029, 0x2ffb, 0x2f8c,
+    0x2cd3, 0x25e9, 0xa89d, 0xad4b, 0xacde, 0xa921, 0xa865, 0xac16, 0xad91,
+    0xad29, 0xa92e, 0xa508, 0xa97f, 0xa985, 0x20b8, 0x2d6f, 0x3063, 0x2ea2,
+    0x2579, 0xa888, 0xaba6, 0xad69, 0xaec8, 0xad13, 0xa6d2, 0xa241, 0x9de8,
+    0x279a, 0x2ad9, 0x28ef, 0xa490, 0xacaf, 0xaea0, 0xaefd, 0xac95, 0x28c1,
+    0x2ecc, 0x3131, 0x3193, 0x322c, 0x32bf, 0x3483, 0x3587, 0x355e, 0x34b7,
+    0x3290, 0x33e8, 0x3444, 0x3333, 0x3001, 0x2bd8, 0x28c8, 0x9fd7, 0xb06b,
+    0xaead, 0xaa26, 0xa33c, 0x9a5c, 0xa53e, 0xac1c, 0xad3f, 0xad47, 0xaea0,
+    0xb067, 0xb04a, 0xad62, 0xa207, 0x1efe, 0xab85, 0xb000, 0xb052, 0xadfa,
+    0xa8d6, 0xa89c, 0xac64, 0xaca3, 0xa8b0, 0x9d7e, 0x9bba, 0x2049, 0x28c4,
+    0x2a4b, 0x2d27, 0x306e, 0x30e7, 0x2e37, 0x1f76, 0xa9f1, 0xab06, 0xa96f,
+    0x1a34, 0x2f1d, 0x30e0, 0x31d6, 0x31b6, 0x3238, 0x31b5, 0x31a8, 0x32ea,
+    0x312d, 0x30d9, 0x2fd0, 0x3131, 0x319b, 0x31fc, 0x317b, 0x30be, 0x2f0b,
+    0x2c67, 0xb4bd, 0xb403, 0xb1ac, 0xae8d, 0xa8b9, 0x96e9, 0xa212, 0xa4e7,
+    0xa59b, 0xa98b, 0xacf5, 0xace9, 0xa5f6, 0x2a5d, 0x29b0, 0xabf3, 0xb170,
+    0xb2ea, 0xb267, 0xb0da, 0xafb2, 0xae6f, 0xac09, 0x9c66, 0x28c5, 0x278e,
+    0x1f72, 0x9988, 0xa3a9, 0x2430, 0x2d95, 0x2fc3, 0x2d41, 0x2462, 0x9934,
+    0x2293, 0x2864, 0x2b71, 0x2f61, 0x2de0, 0x2c53, 0x27b8, 0x2554, 0xac93,
+    0xb1ad, 0xb104, 0xb2a0, 0xb1ab, 0xb09b, 0xaeff, 0xaf98, 0xac42, 0xa22f,
+    0x2406, 0xa395, 0xaa76, 0xb45c, 0xb46d, 0xb3ee, 0xb21d, 0xaf66, 0xaa96,
+    0xa50f, 0x21d8, 0x28e2, 0x278c, 0x9f2c, 0xa404, 0x293d, 0x2ff9, 0x3033,
+    0x2824, 0xad80, 0xb127, 0xb1b8, 0xb08e, 0xac86, 0x2726, 0x3031, 0x3315,
+    0x3412, 0x326b, 0x2f04, 0x2865, 0xa52d, 0x9b46, 0x2d26, 0x30fb, 0x3188,
+    0x310e, 0x31b5, 0x32c1, 0x32e5, 0x3194, 0x30b5, 0x2b17, 0xa707, 0xafe1,
+    0xb238, 0xb627, 0xb8e1, 0xb919, 0xb950, 0xb897, 0xb7b4, 0xb760, 0xb800,
+    0xb6f4, 0xb562, 0xb436, 0xb434, 0xb47f, 0x34e2, 0x32f6, 0x2e2b, 0xa289,
+    0xacf4, 0xadd5, 0xadd8, 0xae63, 0xaed7, 0xad0e, 0xa368, 0x28f9, 0x2b2c,
+    0x2643, 0xae9b, 0xb4ee, 0xb6f7, 0xb5dd, 0xafa4, 0x31ca, 0x35e9, 0x360c,
+    0x3445, 0x302f, 0x2aca, 0x285b, 0x29f9, 0x2d59, 0x3030, 0x3071, 0x2e7e,
+    0x26de, 0xa6e0, 0xa92b, 0xab1e, 0xabc2, 0xa404, 0x28b8, 0x2d3b, 0x2cfc,
+    0x24f1, 0x279e, 0x2974, 0x9af9, 0xaae3, 0xaee5, 0xb01e, 0xac7d, 0xacf6,
+    0xafc5, 0xaf3d, 0xa93a, 0xa311, 0xa3c7, 0x2e5d, 0x3557, 0x340e, 0x314a,
+    0x2b0d, 0xa8d3, 0xad3e, 0xace9, 0xaba0, 0xab42, 0xac10, 0xa9ca, 0x1a98,
+    0x29d1, 0x2c64, 0x2ad2, 0xac12, 0xb44b, 0xb69c, 0xb5ff, 0xb114, 0x2fa4,
+    0x34bc, 0x34d6, 0x321c, 0x2ada, 0xa69d, 0xa933, 0xa625, 0x21ec, 0x2c11,
+    0x2ddc, 0x2cc8, 0x1bb1, 0xabea, 0xad76, 0xae9a, 0xae9d, 0xabea, 0xa70e,
+    0x9a92, 0xa16d, 0xac49, 0xaabb, 0xa559, 0xa7ff, 0xaa1f, 0xabf3, 0xab07,
+    0x1e36, 0xa530, 0xac58, 0xac9d, 0xa6be, 0xa5c1, 0xa944, 0x2afa, 0x3433,
+    0x3438, 0x316f, 0x2be8, 0xa531, 0xaa18, 0xa463, 0x252c, 0x2488, 0x9f69,
+    0xa051, 0x2141, 0x262c, 0x2989, 0x2a29, 0xaa9e, 0xb427, 0xb6ee, 0xb700,
+    0xb41d, 0x207f, 0x3260, 0x339d, 0x3126, 0x2aa4, 0xa410, 0xa863, 0xa7d2,
+    0xa100, 0x2940, 0x2d7a, 0x2d90, 0x2419, 0xacaf, 0xafa1, 0xb076, 0xb045,
+    0xae20, 0xacea, 0xac65, 0xacdc, 0xafc8, 0xae0d, 0xa904, 0x9a06, 0x24f5,
+    0x25e5, 0x28e2, 0x2e77, 0x2a21, 0xa65b, 0xa941, 0xa336, 0xa027, 0xa74f,
+    0x2a00, 0x3304, 0x3515, 0x32e9, 0x2e19, 0x204c, 0xa454, 0x2402, 0x2bae,
+    0x2b4c, 0x2526, 0x1c7e, 0x155f, 0x9e27, 0x2418, 0x290f, 0xab43, 0xb492,
+    0xb7f0, 0xb85b, 0xb64c, 0xb005, 0x2ee5, 0x330c, 0x332f, 0x31be, 0x3084,
+    0x2fb0, 0x2e85, 0x2e02, 0x2fb2, 0x30dc, 0x30a2, 0x2b4b, 0xac48, 0xb0db,
+    0xb1f6, 0xb191, 0xb062, 0xaff2, 0xaf99, 0xaf6f, 0xb081, 0xae18, 0xa4d1,
+    0x2a7f, 0x2e4a, 0x2e95, 0x2f52, 0x31db, 0x2e6d, 0xa27a, 0xab59, 0xaad0,
+    0xa751, 0xa0ce, 0x2c82, 0x32f7, 0x345e, 0x31a8, 0x2a30, 0xaa0f, 0xacc3,
+    0xab18, 0xa491, 0xa52d, 0xaae1, 0xaca9, 0xad67, 0xadc3, 0xab1c, 0xa36f,
+    0xaed0, 0xb5aa, 0xb8bc, 0xb949, 0xb813, 0xb2bd, 0x2d8e, 0x348d, 0x35e9,
+    0x3603, 0x35a9, 0x354d, 0x34e0, 0x347b, 0x3473, 0x346b, 0x334c, 0x2e07,
+    0xad25, 0xb2f2, 0xb486, 0xb479, 0xb3f1, 0xb3c9, 0xb3a3, 0xb2cc, 0xb259,
+    0xafc9, 0xa4d4, 0x2c3f, 0x2f3b, 0x2e32, 0x2e8c, 0x31fe, 0x2d86, 0xac1a,
+    0xb09a, 0xb154, 0xafbd, 0xa5e3, 0x2e3e, 0x3371, 0xad17, 0xab66, 0xa91f,
+    0xa8fc, 0xa983, 0xa83d, 0xa215, 0xa966, 0xad3f, 0xadfc, 0xac4d, 0xa183,
+    0x2aa1, 0x2e20, 0x2c84, 0x9272, 0xae77, 0xb24a, 0xb174, 0xa538, 0x30f1,
+    0x3374, 0x2f14, 0xb040, 0xb5ad, 0xb7ed, 0xb7f1, 0xb492, 0x2d0c, 0x35c3,
+    0x370e, 0x368b, 0x34c6, 0x2f95, 0xa62a, 0xadd9, 0xae04, 0xacaa, 0xaffe,
+    0xaedc, 0xa7dc, 0x1f8c, 0x25b6, 0xa79f, 0xa87a, 0x286f, 0xa61a, 0xac39,
+    0xa705, 0x9d4d, 0xa4a4, 0xa52a, 0xa906, 0xacd4, 0xabc4, 0xadca, 0x2739,
+    0x2ce6, 0x2fa5, 0x3039, 0x3079, 0x3106, 0x315a, 0x2e00, 0x1cba, 0xa877,
+    0xa5f1, 0x22b5, 0x29d5, 0x2c14, 0x2b3f, 0x292a, 0x9e52, 0xad64, 0xad2f,
+    0x2220, 0x3049, 0x32f7, 0x318c, 0x265a, 0xb176, 0xb63c, 0xb851, 0xb794,
+    0xb1fa, 0x2d6c, 0x32aa, 0x343b, 0x3401, 0x3070, 0x28b1, 0xa4ae, 0xa8fd,
+    0xa838, 0xac61, 0xaa1e, 0x2238, 0x298d, 0x2ccc, 0x2879, 0x9c5a, 0x27ab,
+    0xa5c1, 0xac08, 0xabf9, 0xaa5a, 0xa604, 0x9c1d, 0xa545, 0xa828, 0x1d46,
+    0x21f6, 0x250c, 0x2c5d, 0x2f52, 0x2faa, 0x303b, 0x3118, 0x31d5, 0x3012,
+    0x28b4, 0xa2ac, 0x0f25, 0x2860, 0x2894, 0x267d, 0x29d0, 0x2ec6, 0x2fb9,
+    0x29f4, 0x2006, 0x280b, 0x2d40, 0x30a5, 0x31e3, 0x3210, 0x2f06, 0xb069,
+    0xb754, 0xb8ea, 0xb7df, 0xb44e, 0xaef0, 0x2ac9, 0x3186, 0x3114, 0x2e74,
+    0x29cb, 0xa016, 0xa5ff, 0xa937, 0x99ba, 0x2a10, 0x2a5e, 0x2d77, 0x2c55,
+    0x24ba, 0x25b8, 0xa7d2, 0xab90, 0xac54, 0xad1a, 0xa94c, 0x9dc9, 0x0e53,
+    0x245f, 0x2c1f, 0x2d0c, 0xac59, 0xa8d5, 0x9b92, 0x1df1, 0x27b1, 0x2cd7,
+    0x2ff1, 0x2e95, 0x28e5, 0x1774, 0x2612, 0x2a85, 0x22b6, 0xa913, 0xa50c,
+    0x2d57, 0x30aa, 0x2dee, 0x2571, 0xa8aa, 0xacbb, 0xa8b6, 0x2edb, 0x358b,
+    0x380f, 0x35ad, 0xabb7, 0xb708, 0xb897, 0xb80b, 0xb61a, 0xb134, 0x2b7d,
+    0x3028, 0x2fa3, 0x2d29, 0x26a0, 0x9bc4, 0xa52e, 0x257d, 0x2b8b, 0x27c3,
+    0x2c77, 0x2c58, 0x2861, 0x28d4, 0xa0fd, 0xa1df, 0x8c32, 0xa929, 0xa920,
+    0xa475, 0x1694, 0x2ab6, 0x2e1f, 0x2c5f, 0xb256, 0xb2a9, 0xb299, 0xb26b,
+    0xb17f, 0xaf3a, 0xa982, 0xa56b, 0xa893, 0xa873, 0xa136, 0xa3c8, 0xaecf,
+    0xb264, 0xb1c0, 0xaa6b, 0x2860, 0xa20d, 0xae31, 0xb28f, 0xb537, 0xb591,
+    0xb071, 0x3559, 0x3a81, 0x3b50, 0x38a8, 0x2dcb, 0xb4db, 0xb7b1, 0xb7e0,
+    0xb4b8, 0xa682, 0x2ecc, 0x3085, 0x3070, 0x2e60, 0x2a86, 0x9fc5, 0xa52c,
+    0xa62e, 0xac20, 0x209a, 0x2899, 0x2694, 0x28d2, 0xa639, 0xa461, 0x2937,
+    0x2830, 0x169c, 0xa16b, 0xa063, 0x2a4d, 0x2ca1, 0xa446, 0xadef, 0xa9fa,
+    0x25bd, 0x2e42, 0x3099, 0x2f5b, 0x2227, 0xad6a, 0xad38, 0xa8a9, 0xa7a1,
+    0xacc4, 0xafea, 0xb03a, 0xae57, 0xa8b8, 0x2692, 0x2710, 0xa30b, 0xac68,
+    0xb04d, 0xb28a, 0xb471, 0xb58a, 0xb592, 0xb3b2, 0xa78e, 0x33c6, 0x3786,
+    0x384e, 0x37c0, 0x35ca, 0x33d7, 0x3277, 0x31e7, 0x30ba, 0x2d37, 0xa1e9,
+    0xadad, 0xacb8, 0xacf2, 0xad47, 0xac5f, 0xaed5, 0xaf1c, 0xac0e, 0xa0e6,
+    0xabad, 0xac09, 0x29ce, 0x2cee, 0x24a0, 0xa5e8, 0x2990, 0x309a, 0x2ac8,
+    0xac04, 0xa3a7, 0x2c27, 0x3111, 0x3349, 0x331a, 0x304e, 0x2a43, 0x2b23,
+    0x2dd4, 0x2ccb, 0x0f1c, 0xace9, 0xae90, 0xacc6, 0x1eb5, 0x2e8a, 0x2ff2,
+    0x2d58, 0x26ce, 0xa804, 0xad27, 0xb052, 0xb2a7, 0xb382, 0xb114, 0x2060,
+    0x32bc, 0x359c, 0x3598, 0x3411, 0x2fc0, 0x254b, 0x12dd, 0x196b, 0x9f03,
+    0xa89e, 0xadae, 0xb03e, 0xae55, 0xaddd, 0xad97, 0xac67, 0xaf44, 0xb004,
+    0xad84, 0xa90a, 0xab5f, 0xa9d0, 0x2977, 0x2c1d, 0x21e8, 0xa07b, 0x2b9a,
+    0x2f0f, 0x93d1, 0xb0dd, 0xaf18, 0xa97b, 0x2a52, 0x30b9, 0x31ff, 0x304e,
+    0x2c79, 0x2dc8, 0x3039, 0x2f01, 0x2566, 0xac76, 0xaeb3, 0xacbf, 0x251e,
+    0x3058, 0x3148, 0x2ed3, 0x27c7, 0xa65f, 0xa945, 0xaa0c, 0xada5, 0xaefa,
+    0xab20, 0x2b76, 0x31a7, 0x32f4, 0x3052, 0x9e58, 0xb039, 0xb220, 0xb1be,
+    0xb121, 0xb0e3, 0xb120, 0xb1de, 0xb257, 0xb0e6, 0xb004, 0xae37, 0xacf4,
+    0xb01c, 0xb036, 0xacd9, 0xa621, 0xa265, 0x2142, 0x2c45, 0x2d01, 0x290d,
+    0x2950, 0x2e5a, 0x2e82, 0xa577, 0xb486, 0xb42a, 0xb2f4, 0xb05d, 0xa4db,
+    0x2b8e, 0x2877, 0xa000, 0x28e2, 0x2f18, 0x2f49, 0x2a14, 0xa4f6, 0xa862,
+    0x1f4f, 0x2ea2, 0x32db, 0x334c, 0x3076, 0x2791, 0xa89e, 0xa5de, 0x2805,
+    0x2a41, 0x2af7, 0x2e0b, 0x3143, 0x3303, 0x31d0, 0x283d, 0xb09c, 0xb43d,
+    0xb4a4, 0xb3e8, 0xb29c, 0xb1e9, 0xb1b8, 0xb1b6, 0xb150, 0xaf12, 0xac41,
+    0xa49e, 0xa0b9, 0xad07, 0xad8c, 0xa66d, 0x26b8, 0x2b8c, 0x2dd7, 0x303b,
+    0x30ce, 0x2f9f, 0x2ff4, 0x3156, 0x30c2, 0x26dd, 0xb7d4, 0xb7b3, 0xb73d,
+    0xb5f7, 0xb359, 0xaf40, 0xae59, 0xaf24, 0xa7a5, 0x2d5b, 0x3023, 0x2eaa,
+    0x2cea, 0x2e44, 0x3168, 0x347f, 0x3632, 0x3611, 0x341b, 0x2f4b, 0x2867,
+    0x2bae, 0x3082, 0x3200, 0x329b, 0x33d4, 0x34fa, 0x35c0, 0x34d9, 0x2fdf,
+    0xad7a, 0xb2f8, 0xb355, 0xb18d, 0xafc8, 0xad7d, 0xac73, 0xac3b, 0xaa2a,
+    0x2072, 0x2be4, 0x2f61, 0x2f5c, 0x251e, 0xa403, 0x283a, 0x2c19, 0x2efd,
+    0x3109, 0x3243, 0x333d, 0x3287, 0x32eb, 0x3418, 0x339e, 0x3003, 0xb2cf,
+    0xaec1, 0xa8da, 0x29b7, 0x2f45, 0x30c1, 0x2f61, 0x2947, 0x2816, 0x2b28,
+    0x2982, 0x218e, 0x95c2, 0x1c44, 0x9fff, 0xa7a4, 0xa643, 0x20da, 0x10ea,
+    0xa718, 0xa8b3, 0xa8c9, 0xa983, 0xa595, 0x24e6, 0x28c6, 0x2509, 0x250f,
+    0x1aa1, 0x18c0, 0xa588, 0xab2d, 0xac9a, 0xa894, 0xa3f1, 0x26ed, 0xa34a,
+    0xa9a4, 0xaab2, 0xaf54, 0xae6b, 0xaef9, 0xac5c, 0xac0f, 0x26e6, 0x2c82,
+    0x2b7c, 0x2c25, 0x9f2e, 0x1b64, 0x2c0b, 0x2b7d, 0xa36d, 0xa832, 0x30ce,
+    0x2dea, 0xaffb, 0xad2a, 0xad2e, 0xab7c, 0x9c5d, 0x285f, 0x2a32, 0x2636,
+    0x2507, 0x2926, 0x2866, 0x236e, 0x25d1, 0x2ad0, 0x2730, 0x9961, 0x156f,
+    0x27b7, 0x27a9, 0x2888, 0x28e9, 0x2507, 0x9f9c, 0xa214, 0x23ac, 0x24f7,
+    0x9c8a, 0x2147, 0x96f2, 0x1fdb, 0x2399, 0x22c7, 0x2992, 0x2e51, 0x2ce6,
+    0x2d38, 0x2a0e, 0x2783, 0x2613, 0x20ee, 0x294b, 0x26dc, 0x2a68, 0x23d0,
+    0x0b46, 0xa0de, 0x1ace, 0x2b46, 0xa82b, 0xab73, 0xa6a7, 0x9d63, 0x98b7,
+    0x2592, 0x2d9f, 0x2052, 0xad6f, 0xa680, 0xad74, 0xb02b, 0xb04e, 0xaf9c,
+    0xac36, 0xa486, 0x2400, 0x2804, 0x2544, 0x2316, 0x26d9, 0x2ad6, 0x2692,
+    0xa622, 0xa8d0, 0xa464, 0xa304, 0x240a, 0x28fc, 0x27d3, 0xa322, 0xaa79,
+    0xa84e, 0xa639, 0xaa77, 0xa866, 0xaaad, 0xa8ed, 0x9da4, 0x1bbf, 0x26b7,
+    0x2cb8, 0x266e, 0x9831, 0x9ca0, 0x1c8a, 0xa95d, 0xaa85, 0xa285, 0xa6c7,
+    0xa369, 0xa980, 0xac36, 0xae30, 0xad69, 0xaac2, 0xae6d, 0xad94, 0xac78,
+    0xacfb, 0xab2a, 0xa464, 0xa649, 0xaf1c, 0xa963, 0x3293, 0x32d7, 0x2c49,
+    0xadff, 0xb2b6, 0xb256, 0xb06b, 0xad3e, 0xac6f, 0xa992, 0xa499, 0xa891,
+    0xa435, 0xa020, 0xac2e, 0xaddf, 0xacba, 0xa9a2, 0x27a9, 0x2ced, 0x2da9,
+    0x2b11, 0x26d8, 0x2bd7, 0x2d08, 0x296b, 0x2d1e, 0x2e1b, 0x2cf0, 0x2d19,
+    0x29af, 0x2194, 0x29f0, 0x29c5, 0x2842, 0x29a9, 0x2ea9, 0x2d4f, 0x2d0e,
+    0x2d74, 0x2d2a, 0x3042, 0x317b, 0x3272, 0x329e, 0x31fd, 0x31fc, 0x322b,
+    0x33d9, 0x34df, 0x3425, 0x3271, 0x316f, 0x2d19, 0x25b4, 0xbfbc, 0xb9fc,
+    0x2dbe, 0x36f0, 0x3808, 0x360e, 0x354d, 0x34d7, 0x3449, 0x31bf, 0x30f1,
+    0x3146, 0x2f34, 0x2e65, 0x2f48, 0x2aef, 0x2559, 0x29b1, 0x2a83, 0x2cdc,
+    0x2ca3, 0x2a75, 0x209f, 0xa4d7, 0x9daf, 0xa2b4, 0xab48, 0x20a4, 0x23a4,
+    0x2327, 0x2975, 0xa590, 0xacdf, 0xa852, 0x9af0, 0x15fd, 0xa487, 0xa6df,
+    0xae6e, 0xaf30, 0xaf52, 0xb0cb, 0xb02e, 0xaea8, 0xab56, 0xad93, 0xb281,
+    0xb404, 0xb298, 0xb285, 0xb287, 0xb364, 0xb3e1, 0xb198, 0xb029, 0xa7d1,
+    0xb232, 0xaf08, 0x27c0, 0x2fdd, 0x3051, 0x2c77, 0xa267, 0xa84c, 0xaa8a,
+    0xab35, 0x2230, 0x2f0e, 0x2ede, 0xab3e, 0xb412, 0xb52f, 0xb0ed, 0x30d2,
+    0x345d, 0x2e60, 0xb124, 0xb50c, 0xb469, 0xad04, 0x2d18, 0x3017, 0x30ca,
+    0x3181, 0x30d9, 0x2a7b, 0xaeda, 0xb21d, 0xb0ed, 0xac03, 0x1f82, 0x1fe5,
+    0x8a18, 0xa811, 0xac8e, 0xa429, 0x281c, 0x267f, 0x261d, 0x2b48, 0x2b21,
+    0x1d4e, 0xad50, 0xabfa, 0x2bb1, 0x2844, 0xaf45, 0xb0e8, 0xadfc, 0xae8a,
+    0xb0bd, 0x3291, 0xb2ae, 0xae3c, 0x2c28, 0x314e, 0x3149, 0x2cc3, 0xa6f2,
+    0xaa04, 0xa8c6, 0xa72f, 0x26e6, 0x2e88, 0x2d53, 0xac95, 0xb2f6, 0xb33e,
+    0xaa98, 0x3222, 0x33dd, 0x2b95, 0xb12f, 0xb465, 0xb354, 0xa935, 0x2fa0,
+    0x3198, 0x321a, 0x31e4, 0x2f63, 0x9dc0, 0xb047, 0xb175, 0xaf35, 0xa6c7,
+    0x2818, 0x2809, 0x29cb, 0x2919, 0x148c, 0x2b72, 0x2e29, 0x29f9, 0x2127,
+    0x25e7, 0x98f5, 0xa9ae, 0xacbb, 0xac06, 0x25b5, 0x26c2, 0xadbd, 0xace7,
+    0x2464, 0x9d79, 0xa9cb, 0x3456, 0xb41e, 0xaf14, 0x2dcb, 0x32d1, 0x32b3,
+    0x2f2f, 0x191c, 0xa7b6, 0xa50e, 0x9f7f, 0x2a66, 0x3033, 0x2f18, 0xaad6,
+    0xb225, 0xb15e, 0x25f1, 0x3396, 0x336c, 0x9f04, 0xb3b8, 0xb50d, 0xb329,
+    0xa1e1, 0x3138, 0x336d, 0x3397, 0x3220, 0x2d4b, 0xaa32, 0xb070, 0xb066,
+    0xad47, 0xa66d, 0x1c03, 0xa16d, 0x236b, 0x28be, 0x1d4f, 0x2a17, 0x2d18,
+    0x2642, 0xa274, 0x21f3, 0xa5ea, 0xabbe, 0xabaa, 0xaa90, 0xa16d, 0x22ef,
+    0xac22, 0xa6a7, 0x2d56, 0x2c88, 0x2abb, 0x355f, 0xb572, 0xb166, 0x2c35,
+    0x32f4, 0x3342, 0x3047, 0x26d4, 0xa1ff, 0xa0c7, 0x1f7d, 0x2ca5, 0x307a,
+    0x2cbf, 0xb069, 0xb48a, 0xb288, 0x2aa3, 0x3478, 0x331c, 0xae4b, 0xb5d6,
+    0xb5b5, 0xafa4, 0x3200, 0x35f8, 0x361f, 0x345d, 0x2e74, 0xac62, 0xb19e,
+    0xb1c6, 0xadd6, 0xa0ee, 0x289b, 0x2994, 0x21fc, 0x2504, 0x2883, 0xa062,
+    0xa526, 0xa4f4, 0xaafd, 0xa90c, 0x2861, 0x2162, 0xa75e, 0xa407, 0x9f8f,
+    0xa486, 0xa116, 0xabd8, 0xa24a, 0x2e5f, 0x2e02, 0x2f65, 0x366e, 0xb58a,
+    0xb0ab, 0x2f09, 0x3451, 0x345e, 0x3157, 0x29b4, 0xa160, 0xa5fe, 0xa43a,
+    0x2a7d, 0x2fa8, 0x247e, 0xb428, 0xb72f, 0xb552, 0x26da, 0x3563, 0x3467,
+    0xaf94, 0xb6c0, 0xb4e9, 0x3077, 0x38d5, 0x3a6c, 0x395c, 0x34c2, 0xb0f7,
+    0xb7e3, 0xb8b1, 0xb784, 0xb3c0, 0xad0c, 0x19f6, 0x26dd, 0x04a7, 0x9d3e,
+    0x9edd, 0xac06, 0xae8e, 0xb021, 0xb09c, 0xad02, 0x287c, 0x281b, 0x23e6,
+    0x2a82, 0x29c1, 0xa6b9, 0xac84, 0xb009, 0xacd9, 0x264c, 0x2910, 0x3009,
+    0x36f9, 0x2e03, 0x2c10, 0x23e0, 0x2674, 0x26b1, 0x2519, 0x15d5, 0x261e,
+    0x2825, 0xa0e8, 0xa0e8, 0x23ea, 0x2692, 0x2b4a, 0x2d9f, 0x2df1, 0x2e9d,
+    0x2e1d, 0x2c49, 0x2d10, 0x2ce7, 0x2a9c, 0x2220, 0xa826, 0xab25, 0xa9e5,
+    0xabe4, 0xaf81, 0xae59, 0xa94f, 0x28ba, 0x3024, 0x3058, 0x30e5, 0x321e,
+    0x320b, 0x30e4, 0x3132, 0x30ce, 0x2ea7, 0x2a17, 0xa2bd, 0x9d48, 0xa825,
+    0xab84, 0xaae8, 0xaaea, 0xaea1, 0xac9e, 0x1edc, 0xacb3, 0xac61, 0x27a4,
+    0x1ddc, 0x1ff4, 0xa9f5, 0x304a, 0x2cd9, 0x96bb, 0xa267, 0xa4ff, 0xa903,
+    0xaa8d, 0xa315, 0x2354, 0x9f8b, 0xa20d, 0x1f44, 0x1ddc, 0x265f, 0x28d2,
+    0x2770, 0x2862, 0x24ea, 0xa340, 0x981e, 0x9dbd, 0xa533, 0xa7d4, 0xa9af,
+    0xaa02, 0xa59d, 0x9f92, 0xa99d, 0xabc6, 0xaa52, 0xa013, 0x296a, 0xa54c,
+    0xab84, 0xa8b0, 0xa36c, 0xa14d, 0x22ac, 0x21cb, 0x24c2, 0x27bb, 0x99a7,
+    0x277d, 0x9953, 0xa426, 0xa5d9, 0xa9d2, 0xaf79, 0xae60, 0xa5e5, 0xad06,
+    0xad2c, 0xa747, 0xabb7, 0xaadd, 0xae15, 0x3472, 0x3258, 0x2d7e, 0x251b,
+    0xa75a, 0xad91, 0xafa9, 0xadea, 0xa9e6, 0xa5ce, 0xa277, 0x0bab, 0x9a2d,
+    0x2687, 0x2a60, 0x28c3, 0x291a, 0x2834, 0x19b0, 0x98a3, 0xa2ed, 0xa3d4,
+    0xa48f, 0xa987, 0xac29, 0xa9f9, 0xa09e, 0xa5bf, 0xabb7, 0xad27, 0xaa15,
+    0x1886, 0xadab, 0xb11a, 0xb05d, 0xadf9, 0xaa5f, 0x2048, 0x28a8, 0x2d89,
+    0x2f58, 0x2bee, 0x2e50, 0x2a61, 0x28d4, 0x264e, 0x292c, 0x24da, 0x2831,
+    0x2ab7, 0x28dc, 0x2ada, 0x289c, 0xa312, 0xa1e5, 0xac0e, 0x3714, 0x3703,
+    0x35e4, 0x3474, 0x31f7, 0x2cc0, 0x9cbd, 0xa5b7, 0x242f, 0x2bf8, 0x2ed6,
+    0x3037, 0x2e6f, 0x2d0a, 0x2e27, 0x2f86, 0x30ba, 0x30a2, 0x3032, 0x30f7,
+    0x3174, 0x31b3, 0x31e6, 0x31b8, 0x31b9, 0x3246, 0x32db, 0x3286, 0x3171,
+    0x2fab, 0x3031, 0x320c, 0x301c, 0x2c6a, 0x2f47, 0x313b, 0x31c3, 0x32b7,
+    0x32eb, 0x3457, 0x348f, 0x3219, 0x341e, 0x3371, 0x33bb, 0x33b8, 0x34ac,
+    0x3494, 0x346e, 0x338c, 0x33e8, 0x348e, 0x3212, 0x2f72, 0x2f83, 0x2c9c,
+    0xbc23, 0xb8a2, 0xb393, 0xab8d, 0x22a1, 0xa91e, 0xae76, 0xb029, 0xafaa,
+    0xaf6a, 0xae46, 0xad99, 0xb15a, 0xb44d, 0xb4aa, 0xb3d3, 0xb1ca, 0xb1b7,
+    0xb22f, 0xb1c6, 0xb22d, 0xb321, 0xb354, 0xb21c, 0xb018, 0xacee, 0xabbc,
+    0xab21, 0xacdb, 0xb03c, 0xb08a, 0xae33, 0xb029, 0xb256, 0xb237, 0xb243,
+    0xb432, 0xb572, 0xb6ca, 0xb5d4, 0xb4ce, 0xb5a7, 0xb284, 0xb246, 0xb2ad,
+    0xb3b8, 0xb10b, 0xaf8b, 0xad28, 0xb152, 0xb1d6, 0xb075, 0xb3db, 0xb265,
+    0x991c, 0x288f, 0x269a, 0xaa8d, 0xafad, 0xb073, 0xaecc, 0xa402, 0x2d7e,
+    0x305d, 0x2f9f, 0x2dd7, 0x2eb8, 0x2ff1, 0x2fcf, 0x2f1a, 0x2ceb, 0xa338,
+    0xaff9, 0xb193, 0xb073, 0xaa83, 0x2886, 0x2d49, 0x2d94, 0x2af9, 0x266b,
+    0x21c6, 0xa4bf, 0xacab, 0xaeb8, 0xaf05, 0xaf1d, 0xae1c, 0xab30, 0xa213,
+    0x2a6f, 0x2dc1, 0x2d17, 0x2b48, 0x2bf2, 0x2cd0, 0x2ac6, 0x2a35, 0xa847,
+    0xafdd, 0xb143, 0xafc1, 0xac6d, 0xa86f, 0xa0f6, 0x2a65, 0x2d54, 0x25a6,
+    0x224c, 0x2b9b, 0x2b6d, 0x2db5, 0xabd1, 0xb06c, 0xb298, 0xb300, 0xb192,
+    0xab7d, 0x2cad, 0x30c7, 0x30a4, 0x2fd1, 0x2f95, 0x2dc0, 0x276f, 0xa735,
+    0xad2f, 0xb0e6, 0xb28b, 0xb1b1, 0xade7, 0xa0be, 0x2935, 0x2bbe, 0x2aa3,
+    0x24b9, 0x9855, 0x1fef, 0x23ef, 0x1ca7, 0x19d5, 0x1eee, 0x1457, 0x19c5,
+    0x236d, 0x2873, 0x2d64, 0x2f1e, 0x2df9, 0x2c35, 0x2acc, 0x2a11, 0x2816,
+    0x2a8e, 0x1d89, 0xabad, 0xad7c, 0xa72d, 0x266d, 0x22bc, 0xa03f, 0x277b,
+    0x2c67, 0x2554, 0x9e11, 0x99e8, 0xa505, 0xa0d1, 0xafab, 0xb284, 0xb449,
+    0xb43e, 0xb1da, 0xa50b, 0x30b4, 0x33ce, 0x33e2, 0x32bb, 0x3128, 0x2b2b,
+    0xae32, 0xb384, 0xb516, 0xb56f, 0xb472, 0xafdd, 0x28d8, 0x2efc, 0x2e41,
+    0x2c02, 0x269f, 0xa1af, 0xa64e, 0x053e, 0x2831, 0x2a50, 0x2bd4, 0x2b8a,
+    0x2926, 0x257f, 0x249d, 0x2957, 0x2df4, 0x2f4b, 0x2e67, 0x2c88, 0x283b,
+    0x1f29, 0x10c2, 0x2a1c, 0x2a8e, 0x2725, 0x2460, 0x2ba0, 0x2db9, 0x2aa6,
+    0x1a6f, 0x2374, 0x2840, 0xa30d, 0xaa08, 0xab6a, 0xadad, 0xaf51, 0xaf83,
+    0xb34f, 0xb4c2, 0xb445, 0xb031, 0x2dd9, 0x34c6, 0x368d, 0x366e, 0x3535,
+    0x3299, 0x20b8, 0xb404, 0xb7ad, 0xb8af, 0xb848, 0xb54e, 0xa63d, 0x3375,
+    0x3508, 0x3417, 0x30fe, 0x2c48, 0x9436, 0xa878, 0xa626, 0x2219, 0x2814,
+    0x284c, 0x2625, 0x2109, 0x99c9, 0x155a, 0x2878, 0x2caf, 0x2c94, 0x29fd,
+    0x2031, 0xaca4, 0xb05c, 0xb04d, 0xaac9, 0x9c72, 0x2588, 0x2b80, 0x2e9f,
+    0x2eb4, 0x2a5e, 0x2143, 0x26cd, 0x25ec, 0xa940, 0xad18, 0xaec6, 0xb0e6,
+    0xb2d8, 0x2d95, 0xaf31, 0xb3f0, 0xb392, 0xac41, 0x3352, 0x3806, 0x3936,
+    0x3914, 0x37ef, 0x3473, 0xa7c3, 0xb683, 0xb9dd, 0xbb02, 0xba39, 0xb74a,
+    0xa015, 0x35bd, 0x37c7, 0x3696, 0x3420, 0x2eb1, 0xa151, 0xacda, 0xadc0,
+    0xab3d, 0xa50e, 0x9cf3, 0xa4ef, 0xa84a, 0xa73c, 0x1aa6, 0x2b54, 0x2cf5,
+    0x2880, 0xa48c, 0xacb1, 0xb22b, 0xb484, 0xb454, 0xb10c, 0xac6e, 0x1e0f,
+    0x2eed, 0x3209, 0x3237, 0x30f7, 0x3098, 0x3231, 0x31d4, 0x2cd2, 0xa205,
+    0xad53, 0xb1c1, 0xb47f, 0x2889, 0x2c14, 0x288c, 0xa3c3, 0xac4b, 0xad84,
+    0xacea, 0xa7f2, 0x2126, 0x267b, 0x2739, 0x1e43, 0xa197, 0xa72a, 0xac69,
+    0xa8c9, 0x2c32, 0x2c9a, 0xa303, 0xaa29, 0xa908, 0xa799, 0xaa2a, 0xae0b,
+    0xad27, 0xa137, 0x2a96, 0x2d61, 0x2e4a, 0x2e0f, 0x2e6e, 0x2f7e, 0x301b,
+    0x2ec2, 0x2c0d, 0x29bb, 0x2cbc, 0x3015, 0x31a2, 0x3324, 0x346e, 0x350b,
+    0x3591, 0x35c3, 0x349c, 0x2ebe, 0xb0d2, 0xb6fc, 0xba08, 0xbc15, 0xbceb,
+    0xbdeb, 0xbe9a, 0xbdf9, 0xbd56, 0xbd77, 0x2178, 0x2a14, 0x29ec, 0x24b1,
+    0xa14a, 0xa926, 0xaad9, 0xa593, 0x9c9e, 0x9ade, 0x2106, 0x20a5, 0x259d,
+    0x24d5, 0xa6c9, 0xa6aa, 0x293a, 0x2a17, 0x1f8d, 0x2666, 0x2979, 0x2583,
+    0xa2c5, 0xa921, 0xa195, 0x28dc, 0x2bea, 0x2c5a, 0x2c30, 0x29db, 0x2948,
+    0x2b5c, 0x2cd1, 0x2bce, 0x2658, 0x1feb, 0x288f, 0x2d5c, 0x300b, 0x319a,
+    0x339f, 0x3484, 0x34f7, 0x3538, 0x34ba, 0x3214, 0x0592, 0xb401, 0xb83b,
+    0xb9e5, 0xbaea, 0xbc0b, 0xbc79, 0xbc2f, 0xbbc9, 0xbc04, 0x222c, 0x2886,
+    0x2943, 0x2868, 0x2497, 0xa4a3, 0xa917, 0xa1e5, 0x2160, 0x9c94, 0xa7e0,
+    0xa8a8, 0x2444, 0x2985, 0x9ec6, 0xa8fb, 0x1b3a, 0x2687, 0x214f, 0x280c,
+    0x276d, 0xa379, 0xa9c8, 0xa9b8, 0x19ae, 0x28f1, 0x280e, 0x2406, 0x1d14,
+    0xa6ce, 0xaab2, 0xaa99, 0xa6a8, 0xa702, 0xabc2, 0xad73, 0xaccb, 0xa8c5,
+    0x2203, 0x2c8e, 0x3086, 0x31e5, 0x3262, 0x3286, 0x3253, 0x316c, 0x2b9b,
+    0xaff6, 0xb546, 0xb737, 0xb799, 0xb80b, 0xb853, 0xb81e, 0xb807, 0xb851,
+    0x2463, 0x1a8b, 0x9fe4, 0x1514, 0x1fd2, 0xa23a, 0xa8f7, 0xa785, 0x1ad6,
+    0x2578, 0xa232, 0xa9c2, 0x1815, 0x2860, 0xa4d1, 0xac0c, 0xa5ae, 0x2279,
+    0x1df8, 0x21db, 0x9f13, 0xa8a5, 0xa8dd, 0xa470, 0x2868, 0x2b8f, 0x29e6,
+    0x289e, 0x2861, 0x9735, 0xaa3d, 0xab93, 0xa6c2, 0xa740, 0xac93, 0xaea4,
+    0xaedc, 0xac94, 0xa1ec, 0x2a34, 0x2eb3, 0x3044, 0x3055, 0x2fa1, 0x2e97,
+    0x2df4, 0x25d1, 0xae2c, 0xb328, 0xb446, 0xb27e, 0xb03b, 0xaeb0, 0xae28,
+    0xaf8d, 0xb0e5, 0x2d5e, 0x2971, 0x1cc1, 0x200d, 0x2669, 0x2819, 0x2396,
+    0x25a2, 0x298e, 0x2c20, 0x2881, 0x9f81, 0x2500, 0x2a63, 0x1d56, 0xa9ec,
+    0xa697, 0xa131, 0xa287, 0x1dca, 0x1d5f, 0x1d5a, 0x25a4, 0x28f0, 0x2cc1,
+    0x2d71, 0x2c40, 0x2bb9, 0x2c28, 0x27d2, 0xa14d, 0x9d4c, 0x2a1f, 0x2baa,
+    0x24b3, 0xa530, 0xa80c, 0x1f7e, 0x2d02, 0x3025, 0x3110, 0x30ec, 0x2fb9,
+    0x2be9, 0x0fa7, 0xa980, 0xafa7, 0xb27c, 0xb465, 0xb428, 0xb033, 0x1c2d,
+    0x2cf7, 0x2dc9, 0x2c11, 0x28af, 0xba97, 0xb933, 0xb641, 0xaf25, 0x2f45,
+    0x32aa, 0x3248, 0x3090, 0x2d52, 0x1c19, 0xac1d, 0xac53, 0xa3d9, 0x28e8,
+    0x2dcf, 0x309f, 0x3267, 0x340c, 0x33a3, 0x2fcf, 0xa638, 0xadde, 0xa99a,
+    0x2985, 0x2c6e, 0x28fd, 0x2246, 0x9cdf, 0xa6b2, 0xa646, 0x153b, 0x2162,
+    0x9f96, 0xa1c0, 0x9676, 0x249c, 0x2a8a, 0x2b2b, 0xa4be, 0xaced, 0xa84b,
+    0xa157, 0xa72c, 0xaa8f, 0xa9eb, 0x2018, 0x2c6b, 0x29df, 0xa34a, 0x180d,
+    0x14c6, 0x9b17, 0xa16d, 0xac7d, 0xa846, 0x2bf9, 0xb8d5, 0xb6f9, 0xb1c6,
+    0x2e1f, 0x34fb, 0x3686, 0x366a, 0x358e, 0x3473, 0x3217, 0x2edd, 0x2c87,
+    0x2d47, 0x2e11, 0x2ef5, 0x3060, 0x315f, 0x3236, 0x3147, 0x2a7c, 0xad3a,
+    0xb030, 0xabed, 0x2ab3, 0x2ed6, 0x2df6, 0x2c21, 0x291b, 0x226a, 0x8dde,
+    0x19ba, 0x9db3, 0xa567, 0xa43b, 0x9823, 0x261d, 0x2c9b, 0x2dc6, 0x2849,
+    0xa3f7, 0x2563, 0x278b, 0x192f, 0xa473, 0xa1ba, 0x2483, 0x28f1, 0x2096,
+    0xaa06, 0xa88b, 0xa449, 0xa338, 0xa5c2, 0xa53e, 0x27fc, 0x2c46, 0xb81d,
+    0xb583, 0xad5a, 0x3222, 0x3693, 0x3820, 0x380e, 0x36ee, 0x3570, 0x3399,
+    0x3075, 0x2dc1, 0x2e28, 0x2e4d, 0x2cdf, 0x2ac9, 0x26d1, 0x0f42, 0xa9c9,
+    0xb076, 0xb3ba, 0xb425, 0xb101, 0x9eb6, 0x2d9f, 0x2e57, 0x2cdf, 0x2afc,
+    0x2879, 0x2419, 0x99ee, 0xa5a3, 0xa75a, 0xa5bb, 0xa5ce, 0xa0c4, 0x2a54,
+    0x2d68, 0x2994, 0x1a17, 0x269b, 0x2787, 0x22ab, 0x1b7a, 0x2425, 0x283c,
+    0x2768, 0x9fcb, 0xac64, 0xac10, 0xa467, 0x1c21, 0xa171, 0x226a, 0x2ae9,
+    0x28d8, 0xb8c6, 0xb6ac, 0xb0e8, 0x2fca, 0x359a, 0x377a, 0x3776, 0x3627,
+    0x348a, 0x31b3, 0x2d32, 0x28fb, 0x2ad4, 0x2ac2, 0x1e55, 0xab8b, 0xb07d,
+    0xb2eb, 0xb47f, 0xb5cd, 0xb705, 0xb6cd, 0xb498, 0xae4f, 0x28ed, 0x2cd1,
+    0x2aee, 0x274a, 0x218e, 0x99ba, 0xa5f4, 0xa8f4, 0xa880, 0xa74a, 0xa956,
+    0xa984, 0x2478, 0x2c45, 0x2a55, 0x23d1, 0x26b6, 0x2799, 0x24dd, 0x238b,
+    0x28b2, 0x29e7, 0x26a8, 0xa090, 0xac0c, 0xac3c, 0x1880, 0x29ac, 0x1ff0,
+    0x1e8f, 0x2343, 0xa695, 0xb917, 0xb737, 0xb1fd, 0x2db7, 0x3528, 0x371c,
+    0x3704, 0x3598, 0x340f, 0x3105, 0x2c52, 0x2815, 0x292e, 0x24c7, 0xac1d,
+    0xb1a8, 0xb4e9, 0xb6a5, 0xb7d8, 0xb885, 0xb906, 0xb8cb, 0xb713, 0xb33f,
+    0xabe3, 0x9cfd, 0xa544, 0xaa84, 0xac81, 0xad1b, 0xadbf, 0xad4c, 0xab17,
+    0xa7fb, 0xa7ae, 0xa564, 0x298b, 0x2e41, 0x2e0c, 0x2c5d, 0x2cad, 0x2d1b,
+    0x2c47, 0x2b96, 0x2cfc, 0x2c4a, 0x2749, 0x9e29, 0xab88, 0xacdf, 0x12e0,
+    0x2aa4, 0x9d22, 0xa79b, 0xa8a9, 0xacba, 0xa806, 0xaa95, 0xac0b, 0xac81,
+    0xacc0, 0xacd6, 0xadac, 0xae00, 0xaccc, 0xa845, 0x2097, 0x2609, 0x129a,
+    0xa415, 0x2411, 0x2c52, 0x2d1e, 0x2c7a, 0x2e21, 0x3066, 0x30d6, 0x2ecf,
+    0x2423, 0xacb7, 0xb03c, 0xb07f, 0xafe1, 0xaff8, 0xb085, 0xb0b0, 0xb0ac,
+    0xb088, 0xb03a, 0xacfc, 0x2a9a, 0x323b, 0x34ad, 0x3646, 0x3893, 0x3950,
+    0x3839, 0x34f5, 0x2faf, 0xaa20, 0xb3c5, 0xb698, 0xb7df, 0xb7a3, 0xb513,
+    0xb2bc, 0xb09b, 0x98bb, 0x306e, 0x2e01, 0x2b92, 0x3320, 0x15d9, 0xa526,
+    0xa85d, 0xa9cf, 0xaabb, 0xaa4f, 0xaa8b, 0xaa9a, 0xa854, 0x92ba, 0x25c1,
+    0x24bc, 0xa252, 0xa89b, 0xa434, 0x26f6, 0x294b, 0x29e5, 0x2d77, 0x2f8b,
+    0x2f2a, 0x2c0f, 0x9c49, 0xab80, 0xadea, 0xade1, 0xad2e, 0xae0f, 0xaf04,
+    0xaeab, 0xae91, 0xae54, 0xae4d, 0xad29, 0xa446, 0x2c55, 0x301b, 0x31e5,
+    0x353c, 0x3720, 0x3614, 0x3423, 0x30ed, 0x2c1e, 0xa825, 0xb0ee, 0xb396,
+    0xb48c, 0xb335, 0xb1d9, 0xb08a, 0xaa6e, 0x2779, 0xa645, 0xa95e, 0x30a9,
+    0x26e9, 0x193e, 0xa47e, 0xa7aa, 0xa8ab, 0xa6f8, 0xa500, 0xa550, 0xa492,
+    0xa077, 0xa345, 0xa92e, 0xad25, 0xaf3e, 0xaebb, 0xac09, 0xa7fb, 0x2267,
+    0x2da3, 0x2fef, 0x2dfa, 0x25f5, 0xa843, 0xa9fd, 0xa9cf, 0xa861, 0xa804,
+    0xab08, 0xac58, 0xaaaf, 0xa971, 0xa95d, 0xab61, 0xad4c, 0xad96, 0xac0e,
+    0xa9d0, 0xa8d2, 0x2c52, 0x3339, 0x341a, 0x33be, 0x32a8, 0x31b7, 0x319d,
+    0x2f6b, 0x2ac1, 0xa9bb, 0xaeb3, 0xb0c4, 0xb073, 0xad5d, 0xaad7, 0xaf8a,
+    0xaee1, 0x2f6b, 0x2a4c, 0x2571, 0x9d88, 0xa48b, 0xa5b1, 0x9f37, 0x2063,
+    0x208e, 0x1a35, 0x1179, 0xa34c, 0xa9d3, 0xad5e, 0xaf80, 0xafa8, 0xad93,
+    0xaa1a, 0x2764, 0x3081, 0x3203, 0x306d, 0x29da, 0x98c1, 0x25c2, 0x2b57,
+    0x2cb3, 0x2b81, 0x2424, 0xa01e, 0x98c0, 0x0032, 0xa4d8, 0xac0e, 0xb05e,
+    0xb298, 0xb3c4, 0xb46a, 0xb4eb, 0xb2c8, 0xa3b5, 0x2ea0, 0x3252, 0x33ad,
+    0x3437, 0x351c, 0x3515, 0x34a1, 0x317a, 0x15a0, 0xb06d, 0xb1d5, 0xb0c6,
+    0xafd9, 0xb180, 0xb004, 0x3049, 0x288b, 0x1b81, 0xa7fc, 0xaa13, 0xaa56,
+    0xa693, 0x97d2, 0x1de1, 0x1d83, 0x249c, 0x2698, 0x2374, 0xa20c, 0xa9a3,
+    0xab99, 0xaa02, 0xa50f, 0x2bcf, 0x31f4, 0x3388, 0x3172, 0x2c19, 0x26dd,
+    0x2d1a, 0x3067, 0x30f9, 0x2faf, 0x2a9f, 0x1e97, 0x9832, 0xa0cd, 0xab61,
+    0xb0d1, 0xb48e, 0xb6b0, 0xb80b, 0xb8a0, 0xb900, 0xb80c, 0xb416, 0xaa8a,
+    0x30bf, 0x345f, 0x357c, 0x36b3, 0x3707, 0x36f5, 0x3499, 0x28c6, 0xb153,
+    0xb415, 0xb3b9, 0xb27e, 0xb345, 0xb076, 0x3110, 0x99a1, 0x99a1, 0x99a1,
+    0x99a0, 0x99a2, 0x99a0, 0x99a2, 0x999f, 0x99a3, 0x999f, 0x99a4, 0x999e,
+    0x99a4, 0x999e, 0x99a5, 0x999d, 0x99a5, 0x999d, 0x99a6, 0x999c, 0x99a5,
+    0x999d, 0x99a5, 0x999e, 0x99a4, 0x999e, 0x99a4, 0x999e, 0x99a4, 0x999e,
+    0x99a3, 0x999f, 0x99a3, 0x99a0, 0x99a2, 0x99a0, 0x99a2, 0x99a0, 0x99a2,
+    0x99a1, 0x99a1, 0x99a1, 0x99a1, 0x99a2, 0x99a0, 0x99a2, 0x99a0, 0x99a2,
+    0x99a0, 0x99a2, 0x99a0, 0x99a2, 0x99a0, 0x99a2, 0x99a1, 0x99a1, 0x99a1,
+    0x99a1, 0x99a1, 0x99a2, 0x99a0, 0x99a2, 0x999f, 0x99a3, 0x999f, 0x99a4,
+    0x999e, 0x99a4, 0x999d, 0x99a5, 0x999d, 0x99a5, 0x999c, 0x99a6, 0x999c,
+    0x99a7, 0x999c, 0x99a6, 0x999d, 0x99a5, 0x999e, 0x99a4, 0x999e, 0x99a4,
+    0x999e, 0x99a4, 0x999e, 0x99a3, 0x999f, 0x99a2, 0x99a0, 0x99a2, 0x99a0,
+    0x99a2, 0x99a0, 0x99a1, 0x99a1, 0x99a1, 0x99a1, 0x99a0, 0x99a2, 0x99a0,
+    0x99a2, 0x99a0, 0x99a2, 0x99a0, 0x99a2, 0x99a0, 0x99a2, 0x99a0, 0x99a1,
+    0x99a1, 0x99a1, 0x99a1, 0x99a1, 0x99a0, 0x99a2, 0x99a0, 0x99a3, 0x999f,
+    0x99a3, 0x999e, 0x99a4, 0x999e, 0x99a5, 0x999d, 0x99a5, 0x999d, 0x99a6,
+    0x999c, 0x99a7, 0x999c, 0x99a6, 0x999c, 0x99a5, 0x999d, 0x99a4, 0x999e,
+    0x99a4, 0x999e, 0x99a4, 0x999e, 0x99a4, 0x999f, 0x99a3, 0x99a0, 0x99a2,
+    0x99a0, 0x99a2, 0x99a0, 0x99a2, 0x99a1, 0x99a1, 0x99a1, 0x99a1, 0x99a2,
+    0x99a0, 0x99a2, 0x99a0, 0x99a2, 0x99a0, 0x99a2, 0x99a0, 0x99a2, 0x99a0,
+    0x99a2, 0x99a1, 0x99a1, 0x99a1, 0x99a1, 0x99a1, 0x99a2, 0x99a0, 0x99a2,
+    0x999f, 0x99a3, 0x999f, 0x99a4, 0x999e, 0x99a4, 0x999d, 0x99a5, 0x999d,
+    0x99a5, 0x999c, 0x99a6, 0x999c, 0x99a7, 0x999c, 0x99a6, 0x999d, 0x99a5,
+    0x999e, 0x99a4, 0x999e, 0x99a4, 0x999e, 0x99a4, 0x999e, 0x99a3, 0x999f,
+    0x99a2, 0x99a0, 0x99a2, 0x99a0, 0x99a2, 0x99a0, 0x99a1, 0x99a1, 0x99a1,
+    0x99a1, 0x99a0, 0x99a2, 0x99a0, 0x99a2, 0x99a0, 0x99a2, 0x99a0, 0x99a2,
+    0x99a0, 0x99a2, 0x99a0, 0x99a1, 0x99a1, 0x99a1, 0x99a1, 0x99a1, 0x99a0,
+    0x99a2, 0x99a0, 0x99a2, 0x999f, 0x99a3, 0x999f, 0x99a4, 0x999e, 0x99a4,
+    0x999e, 0x99a5, 0x999d, 0x99a5, 0x999d, 0x99a6, 0x999c, 0x99a5, 0x999d,
+    0x99a5, 0x999e, 0x99a4, 0x999e, 0x99a4, 0x999e, 0x99a4, 0x999e, 0x99a3,
+    0x999f, 0x99a3, 0x99a0, 0x99a2, 0x99a0, 0x99a2, 0x99a0, 0x99a2, 0x99a1,
+    0x99a1, 0x99a1, 0x99a1, 0x99a2, 0x99a0, 0x99a2, 0x99a0, 0x99a2, 0x99a0,
+    0x99a2, 0x99a0, 0x99a2, 0x99a0, 0x99a2, 0x99a1, 0x99a1, 0xb281, 0xb16d,
+    0xafe9, 0xadcc, 0xae2d, 0xafc4, 0xaf45, 0xaba2, 0x980f, 0x2718, 0x25b9,
+    0xa0c7, 0xaa84, 0xae24, 0xaf21, 0xa911, 0x2e5a, 0x327f, 0x332b, 0x32f6,
+    0x335f, 0x336e, 0x31d2, 0x2e74, 0x2b3f, 0x2dd1, 0x31e8, 0x3462, 0x34ea,
+    0x3477, 0x33bf, 0x33d6, 0x34d5, 0x35c1, 0x35e6, 0x3463, 0x2cde, 0xb11b,
+    0xb57e, 0xb640, 0xb693, 0xb700, 0xb5ed, 0xb3ca, 0xaeaa, 0xa533, 0xac29,
+    0xb058, 0xacd9, 0x2074, 0x24e9, 0xa194, 0xa5cf, 0xab8c, 0xaccc, 0xaadd,
+    0xb1b4, 0xb0a0, 0xae63, 0xac85, 0xad2c, 0xaece, 0xae97, 0xab3a, 0x9c4e,
+    0x25e2, 0x2481, 0xa19a, 0xa9ac, 0xad46, 0xaee7, 0xac3a, 0x28f4, 0x3005,
+    0x30df, 0x3118, 0x31c4, 0x31fc, 0x3099, 0x2cad, 0x2833, 0x2b5d, 0x3024,
+    0x31f6, 0x321f, 0x30f7, 0x2fc4, 0x3081, 0x330e, 0x34c7, 0x353d, 0x3426,
+    0x2da3, 0xb030, 0xb4d7, 0xb584, 0xb5c3, 0xb621, 0xb508, 0xb22a, 0xab7b,
+    0x24ba, 0xa874, 0xafd3, 0xad2b, 0x1a60, 0x281c, 0x2513, 0x24da, 0xa07f,
+    0xa13f, 0x257a, 0xb00e, 0xadc3, 0xa9cf, 0xa4d7, 0xa835, 0xabca, 0xac3b,
+    0xa8f4, 0x1249, 0x27b0, 0x2717, 0x9312, 0xa762, 0xab93, 0xadf2, 0xad85,
+    0xa5d8, 0x29bd, 0x2cdf, 0x2def, 0x2f87, 0x3002, 0x2da2, 0x278b, 0x1192,
+    0x27b9, 0x2dfc, 0x2ffd, 0x2e6e, 0x2a7a, 0x22b7, 0x28bb, 0x3054, 0x33ac,
+    0x34c2, 0x3434, 0x3009, 0xac66, 0xb3ab, 0xb4ca, 0xb52c, 0xb5bb, 0xb4ba,
+    0xb197, 0xa6f2, 0x2cf0, 0x2846, 0xab92, 0xaaa5, 0x2326, 0x2990, 0x2a4d,
+    0x2c2b, 0x29d0, 0x2a48, 0x2d9e, 0xaad3, 0xa226, 0x2841, 0x2b03, 0x28ab,
+    0x1add, 0xa38f, 0xa33e, 0x1902, 0x2701, 0x280f, 0x1cdc, 0xa6cd, 0xabc6,
+    0xaec9, 0xb01a, 0xae3e, 0xa93f, 0x141a, 0x26a9, 0x29d5, 0x2a18, 0x2514,
+    0xa337, 0xa4c3, 0x254e, 0x2cd2, 0x2d3e, 0x2746, 0xa888, 0xacdb, 0xaa1b,
+    0x2c4f, 0x323c, 0x346a, 0x345e, 0x31aa, 0x22df, 0xb0e7, 0xb398, 0xb48f,
+    0xb54e, 0xb47b, 0xb135, 0x0db4, 0x308f, 0x2ff4, 0x27c4, 0x1fac, 0x2b6b,
+    0x2d63, 0x2e41, 0x2f3f, 0x2d8f, 0x2dac, 0x3039, 0x2966, 0x2d31, 0x2fc8,
+    0x3060, 0x2f20, 0x2bdb, 0x26ba, 0x1cde, 0xa16a, 0xa0af, 0x9fd7, 0xa821,
+    0xac0e, 0xae42, 0xb0d6, 0xb254, 0xb244, 0xb0c7, 0xae17, 0xaaab, 0xa53b,
+    0xa036, 0xa435, 0xa5d3, 0x9225, 0x2ac4, 0x2eca, 0x2e46, 0x2703, 0xa9f1,
+    0xade0, 0xac19, 0x2b4e, 0x324d, 0x34a5, 0x34de, 0x3362, 0x2dbd, 0xabb4,
+    0xb113, 0xb359, 0xb489, 0xb386, 0xaf45, 0x2c9e, 0x339d, 0x33a3, 0x30aa,
+    0x2e49, 0x3068, 0x3160, 0x31a5, 0x31e4, 0x3056, 0x2fdf, 0x3148, 0x34b6,
+    0x2feb, 0xade4, 0xb336, 0xb404, 0xb231, 0xafc8, 0xa884, 0x288c, 0x2d28,
+    0x2e2d, 0x2d28, 0x2a78, 0x28ba, 0x25e2, 0x92db, 0xa541, 0xa49b, 0xa478,
+    0x1802, 0x2ca2, 0x306a, 0x301b, 0x2dfe, 0x29eb, 0x9f2e, 0x1ad1, 0x2c1e,
+    0x2eab, 0x2e01, 0x2c0c, 0x2a27, 0x2828, 0xa821, 0xad6c, 0xace3, 0xac2f,
+    0xa143, 0x29bb, 0x20bb, 0x2cb9, 0x3019, 0x28c1, 0x2011, 0x2b2e, 0x2f8c,
+    0x329b, 0x3332, 0x30ca, 0x2ced, 0x2d66, 0xacaa, 0xb438, 0xb4b4, 0xb346,
+    0xb8d9, 0x322d, 0x2a87, 0xb03a, 0xb391, 0xb336, 0xb0a2, 0xac4f, 0x1fe6,
+    0x2ac4, 0x2b81, 0x2734, 0xa4c3, 0xaba9, 0xac7a, 0xab08, 0xa952, 0xa7cd,
+    0xa1d5, 0x9ccb, 0x2128, 0x2948, 0x2a90, 0x25d0, 0x13f0, 0xa5ff, 0xac19,
+    0xab3f, 0x20d1, 0x2bd4, 0x2c20, 0x2ba6, 0x2a66, 0x2989, 0x1865, 0xa985,
+    0xa56b, 0xa207, 0x23e8, 0x2a7a, 0x2395, 0x2834, 0x2bee, 0x1e6c, 0xa6e4,
+    0xa4da, 0x9ca3, 0x2622, 0x2c85, 0x2c34, 0x2367, 0x261c, 0xac88, 0xb1ce,
+    0xb30b, 0xb42e, 0xb902, 0x301d, 0x2918, 0xad87, 0xb0f4, 0xb04d, 0xabc7,
+    0x9f73, 0x2948, 0x2c10, 0x2898, 0xa5dd, 0xad1f, 0xaf10, 0xae4b, 0xab29,
+    0xa2c9, 0x2601, 0x2b5c, 0x2c58, 0x2c27, 0x2acc, 0x23f8, 0xa766, 0xa8a0,
+    0xa8a3, 0xac0d, 0xabd0, 0xa351, 0x24c5, 0x279d, 0x2983, 0x29d7, 0x2c00,
+    0x2959, 0x22e4, 0x29d7, 0x282d, 0x25e2, 0x2857, 0x2448, 0x23f8, 0x291e,
+    0x2b78, 0x2cc7, 0x2dfc, 0x2f80, 0x2ff5, 0x3055, 0x3089, 0x3024, 0x30c7,
+    0x2e25, 0x2837, 0xa950, 0xb1a5, 0xb728, 0xac99, 0xa75e, 0xa946, 0xaceb,
+    0xacba, 0xaa89, 0xa99f, 0xa59c, 0x9866, 0xa40f, 0xa9ab, 0xad3d, 0xae87,
+    0xacf7, 0xa729, 0x234b, 0x2b58, 0x2e28, 0x2dfd, 0x2b91, 0x2352, 0xa3ed,
+    0x9f08, 0x2b45, 0x2fc9, 0x303e, 0x2f7d, 0x2f71, 0x2f43, 0x2e91, 0x2dbd,
+    0x2d2e, 0x2e8c, 0x2e73, 0x3058, 0x336b, 0x3361, 0x31e0, 0x309a, 0x2ef5,
+    0x2c67, 0x2e32, 0x31a8, 0x336a, 0x33a0, 0x3433, 0x341f, 0x32e0, 0x3399,
+    0x3411, 0x3520, 0x3581, 0x3567, 0x34fa, 0x33e3, 0x3370, 0xb684, 0xad53,
+    0x310e, 0x33de, 0x3416, 0x325c, 0x30bc, 0x2f22, 0x2d36, 0x2ab7, 0x2995,
+    0x2919, 0x292a, 0x2aea, 0x2b7f, 0x280a, 0x0a21, 0xa7bf, 0xae8d, 0xb293,
+    0xb494, 0xb4a1, 0xb2bc, 0xadce, 0x1900, 0x2644, 0xa511, 0xac71, 0xaf60,
+    0xb160, 0xb389, 0xb4ab, 0xb51c, 0xb5ae, 0xb4c7, 0xb07e, 0xae7d, 0xb1a3,
+    0xb4ac, 0xb5f9, 0xb6fd, 0xb63c, 0xb441, 0xb389, 0xb4f1, 0xb573, 0xb604,
+    0xb76d, 0xb5fa, 0xb4ab, 0xb140, 0xa642, 0x309f, 0x3639, 0x3954, 0x3c24,
+    0xa717, 0xa92b, 0xaa5a, 0xa773, 0xa794, 0xa5fb, 0x2738, 0x2d70, 0x2b89,
+    0x1c4f, 0xa672, 0xa66c, 0x2389, 0x239e, 0xa94f, 0xac01, 0xa939, 0xaa1f,
+    0xaee6, 0xb0bd, 0xaf41, 0xac40, 0xac5a, 0xad0a, 0xabf8, 0xa37b, 0x2954,
+    0x2a62, 0x29e3, 0x2917, 0x24bc, 0x24d7, 0x252f, 0x1c99, 0x2211, 0x25af,
+    0xa09a, 0xa42f, 0xa697, 0x23a6, 0x2e7f, 0x3139, 0x3137, 0x2fbf, 0x2611,
+    0xa03d, 0x2ead, 0x3206, 0x3127, 0x31ae, 0x3326, 0x3597, 0x36b5, 0x3617,
+    0x364e, 0x35e0, 0x9e60, 0xa6b3, 0xa8ac, 0xa4b3, 0x9f8c, 0x13be, 0x2a04,
+    0x2dad, 0x2ad9, 0x2099, 0xa42a, 0xa67f, 0x20e2, 0x23d0, 0xa806, 0xa8a4,
+    0x164a, 0x23e7, 0xa76a, 0xac4c, 0xaabc, 0xa814, 0xaa3e, 0xac7e, 0xaadf,
+    0x9937, 0x287e, 0x2320, 0xa48f, 0xa89b, 0xab55, 0xabf3, 0xac25, 0xac8c,
+    0xaa69, 0xa33a, 0xa7ec, 0xad28, 0xb063, 0xafec, 0xadf1, 0xacae, 0xacaa,
+    0xadbe, 0xaf1f, 0xaf9a, 0xa9b9, 0x2718, 0x2cf9, 0x30ec, 0x336e, 0x35eb,
+    0x3673, 0x34f1, 0x3491, 0x33d7, 0x2a02, 0x21a9, 0xa4a1, 0xa402, 0xa382,
+    0xa005, 0x28e4, 0x2bdc, 0x21ac, 0xa4a0, 0xa467, 0xa099, 0x27ee, 0x291e,
+    0x98ca, 0xa20c, 0x2235, 0x26e0, 0x98ed, 0xa824, 0xa5a0, 0x1bd7, 0xa469,
+    0xac05, 0xac21, 0xa247, 0x2844, 0x2526, 0xa61f, 0xab1f, 0xacbe, 0xacb7,
+    0xac76, 0xad11, 0xacad, 0xa833, 0xa608, 0xac14, 0xb00e, 0xb0ba, 0xb119,
+    0xb0db, 0xafb6, 0xae5c, 0xa8de, 0x208f, 0x28b4, 0x2c63, 0x3055, 0x3277,
+    0x3459, 0x35cc, 0x3557, 0x3282, 0x3185, 0x30f8, 0x30ce, 0x2f27, 0x27f1,
+    0xa925, 0xae0e, 0xaf79, 0xaca9, 0xa9e6, 0xad6d, 0xadcd, 0xac1d, 0xaa7a,
+    0x9ff4, 0x2814, 0x2849, 0x28a4, 0x2996, 0x29ec, 0x2722, 0x22de, 0x2801,
+    0x2c7d, 0x2a50, 0xa5f9, 0xa8f7, 0x2417, 0x2c11, 0x2c92, 0x29a7, 0x1701,
+    0xa5d5, 0xa3c8, 0x9cc7, 0xa6be, 0xa90d, 0x1838, 0x28f7, 0x281f, 0xa10e,
+    0xaa5f, 0xae0e, 0xadbf, 0xa57b, 0x26f6, 0x2e77, 0x3070, 0x2e9b, 0x2d7d,
+    0x2e9f, 0x2ab9, 0x268c, 0x1c2b, 0xaeee, 0xb1f4, 0xad92, 0x230a, 0x2eeb,
+    0x3293, 0x3245, 0x2f30, 0x193b, 0xad4b, 0xac38, 0xab82, 0xaf4f, 0xb041,
+    0xaedd, 0xac30, 0x25b8, 0x2e7f, 0x3037, 0x3070, 0x3002, 0x2e86, 0x2c4c,
+    0x2903, 0x294f, 0x2d06, 0x2c90, 0x1f4c, 0x1b94, 0x2d6b, 0x3119, 0x324f,
+    0x31eb, 0x308c, 0x2fc3, 0x3057, 0x309b, 0x2e19, 0x2a27, 0x2c29, 0x2dc3,
+    0x2c11, 0x1cb6, 0xa959, 0xae6e, 0xaf98, 0xac24, 0xabc5, 0xaf64, 0xb339,
+    0xb604, 0xb72a, 0xb7b2, 0xb97c, 0xbafd, 0xbbed, 0xbc6f, 0xbc0f, 0xb930,
+    0xb5a5, 0x2b29, 0x3028, 0x313c, 0x309e, 0x3017, 0x2f36, 0x2eeb, 0x2c10,
+    0x2923, 0x2b4a, 0x2c99, 0x2c1d, 0x289a, 0x2a2f, 0x2e25, 0x2c71, 0x9a38,
+    0xa807, 0x2a9a, 0x3182, 0x3305, 0x3266, 0x315a, 0x3086, 0x3032, 0x3076,
+    0x3050, 0x2d71, 0x2d7a, 0x31a6, 0x33c9, 0x34d9, 0x3405, 0x321b, 0x3396,
+    0x34e5, 0x364b, 0x37ff, 0x38ea, 0x39d0, 0x3a3b, 0x39ed, 0x3945, 0x3780,
+    0x357c, 0x33f8, 0x30a5, 0x2803, 0xa602, 0x9f41, 0x26f0, 0x30fc, 0x3437,
+    0x338d, 0x3789, 0x386c, 0xad01, 0xa50a, 0x0c08, 0xa773, 0xac28, 0xad7b,
+    0xad2b, 0xaed0, 0xaf3e, 0xadb4, 0xac4f, 0xabd6, 0xad16, 0xad7b, 0xac3a,
+    0xad38, 0xaf66, 0xb010, 0xac98, 0x1ebe, 0x28b0, 0x2661, 0xa590, 0xadc8,
+    0xafd6, 0xae77, 0xad6e, 0xaf9b, 0xb01f, 0xac6d, 0xa667, 0x293a, 0x2871,
+    0x20e4, 0x28b0, 0x29d4, 0x2b48, 0x2d87, 0x2ec5, 0x2fe3, 0x2efb, 0x2cfe,
+    0x2c52, 0xa62c, 0xa68f, 0xa5b7, 0xa9c9, 0xa9ff, 0xabb8, 0xad57, 0xaccf,
+    0xa9d3, 0xa691, 0xa69b, 0x3088, 0x3026, 0xabd6, 0xa89f, 0xa8af, 0xac52,
+    0xae79, 0xafa8, 0xaec3, 0xae63, 0xad46, 0xac08, 0xa9b8, 0xa6a5, 0xa56a,
+    0xa780, 0xa806, 0xa957, 0xaa35, 0xaa8e, 0xa847, 0xa461, 0xa8f2, 0xabd6,
+    0xadf0, 0xb117, 0xb24d, 0xb1ac, 0xb109, 0xb182, 0xb1b1, 0xb121, 0xb0e8,
+    0xae2f, 0xad5e, 0xae15, 0xad8f, 0xb018, 0xb22f, 0xb3de, 0xb4c8, 0xb57e,
+    0xb624, 0xb62f, 0xb566, 0xb5a0, 0xb401, 0xb104, 0xaf8d, 0xa975, 0x1a77,
+    0xa63e, 0xa858, 0xacc5, 0xb077, 0xb0fc, 0xadf2, 0xb327, 0x209a, 0x20ca,
+    0x2025, 0xa046, 0xa619, 0xa889, 0xa80e, 0xa457, 0x197b, 0x9f71, 0xa4c1,
+    0x1a41, 0x276a, 0x25c7, 0x210a, 0x23e9, 0x26f6, 0x227c, 0xa0fb, 0xa885,
+    0xad00, 0xad82, 0xace6, 0xae62, 0xafbf, 0xaea9, 0xacfe, 0xac8b, 0xaca5,
+    0xada0, 0xafe8, 0xae3a, 0xad8a, 0xad60, 0xacb8, 0xafd0, 0xb2a0, 0xb48f,
+    0xb5b6, 0xb6cb, 0xb75f, 0xb6fb, 0xb5aa, 0xb522, 0xb1a7, 0xac72, 0xa940,
+    0x25b0, 0x2cd2, 0x2b22, 0x29c0, 0xa57e, 0xaf65, 0xb0ba, 0xb1b9, 0xb6a2,
+    0x31b9, 0x2b84, 0x9fab, 0xa3b5, 0x24b8, 0x2ac0, 0x2cdf, 0x2e5d, 0x2e77,
+    0x2a13, 0x1abf, 0x25ad, 0x2a39, 0x2380, 0xa6bd, 0x1e09, 0x2b63, 0x29ae,
+    0x9e51, 0xaad9, 0xad80, 0xab56, 0x1c46, 0x2a05, 0x2d44, 0x302d, 0x31bc,
+    0x32a8, 0x32e2, 0x310a, 0x2b38, 0x26c2, 0x2115, 0x2183, 0x27af, 0x16d5,
+    0xaabd, 0xaec1, 0xb0fe, 0xb311, 0xb3da, 0xb24d, 0xae45, 0xaa60, 0x2dfc,
+    0x3137, 0x302e, 0x308b, 0x316a, 0x3136, 0x3188, 0x2e83, 0x9a16, 0xab77,
+    0xb0f2, 0xb757, 0x3716, 0x35a2, 0x330d, 0x2eb6, 0x233c, 0xac57, 0xb02e,
+    0xb08e, 0xb125, 0xb224, 0xb284, 0xb22a, 0xb1f0, 0xb0f8, 0xaba9, 0x2c35,
+    0x2cca, 0xae21, 0xb51b, 0xb726, 0xb701, 0xb51c, 0xb14c, 0xaa62, 0x279d,
+    0x2e85, 0x30c3, 0x3052, 0x2cce, 0x250d, 0x224e, 0x2a0e, 0x2e81, 0x307f,
+    0x309f, 0x2fe9, 0x2c90, 0xa2f3, 0xae3d, 0xb0b7, 0xb234, 0xb3b4, 0xb3a6,
+    0xb3c4, 0xb44e, 0xb2a7, 0xaa9a, 0x2fb1, 0x311d, 0x3130, 0x318e, 0x300a,
+    0x2f05, 0x3046, 0xa80f, 0xb401, 0x3661, 0x3519, 0x3297, 0x2ef4, 0x273e,
+    0xa75e, 0xac06, 0xab31, 0xac19, 0xad57, 0xae12, 0xae12, 0xae70, 0xad12,
+    0x2066, 0x3034, 0x30e2, 0x2385, 0xb12a, 0xb3f8, 0xb343, 0xb034, 0xa59b,
+    0x2a71, 0x2d9d, 0x2fa0, 0x300b, 0x2d34, 0x24d1, 0xa0c1, 0x2376, 0x2c65,
+    0x3008, 0x3119, 0x3154, 0x3133, 0x3034, 0x2ca5, 0x1ddd, 0xa8c7, 0xad86,
+    0xb043, 0xb0d3, 0xb1c8, 0xb340, 0xb234, 0xac58, 0x2c3a, 0x2cc0, 0x2d0a,
+    0x2f31, 0x2c6e, 0x29c5, 0x2c47, 0xac95, 0xb487, 0x3577, 0x3471, 0x3225,
+    0x2f9a, 0x2c77, 0x29cd, 0x283d, 0x28b6, 0x2597, 0x2077, 0x9d3f, 0xa63c,
+    0xa976, 0xa5a9, 0x2c02, 0x3198, 0x3217, 0x2bde, 0xad61, 0xb049, 0xada1,
+    0xa202, 0x2a37, 0x2d4d, 0x2e6a, 0x2ed7, 0x2c6a, 0xa61c, 0xaeb4, 0xaf06,
+    0xa934, 0x2bcc, 0x30cd, 0x3220, 0x325d, 0x3288, 0x3263, 0x3162, 0x2e77,
+    0x28ae, 0xa92c, 0xae4b, 0xaf67, 0xb06c, 0xb18d, 0xb0cf, 0xa986, 0x2c27,
+    0x289d, 0x25af, 0x2c7e, 0x2853, 0x1663, 0x2519, 0xaee7, 0xb536, 0x3406,
+    0x321d, 0x2faf, 0x2c2f, 0x2931, 0x2956, 0x29f1, 0x295a, 0x208e, 0xa3a1,
+    0xa8de, 0xac5a, 0xad65, 0xa96f, 0x2caa, 0x3262, 0x328e, 0x2bcb, 0xad49,
+    0xaefc, 0xa942, 0x24e2, 0x27f6, 0x2712, 0x2905, 0x2a34, 0x9d0f, 0xb01c,
+    0xb38e, 0xb3bd, 0xb08d, 0x2432, 0x3135, 0x33bb, 0x3444, 0x344b, 0x341d,
+    0x333d, 0x30bc, 0x2bee, 0xa8dc, 0xaf13, 0xaffe, 0xafe0, 0xaf63, 0xac84,
+    0x24aa, 0x2ea0, 0x2a3c, 0x2215, 0x2c20, 0x2937, 0x1d92, 0x2493, 0xaf5f,
+    0xb5b4, 0x34ac, 0x322f, 0x2d5a, 0x1c55, 0xa899, 0xa93d, 0xa8d8, 0xaac3,
+    0xaec7, 0xb0e6, 0xb23e, 0xb368, 0xb352, 0xb05f, 0x28a7, 0x320d, 0x319e,
+    0x99e1, 0xb12c, 0xb1aa, 0xad9a, 0xa706, 0xa9af, 0xad10, 0xad0b, 0xac08,
+    0xae9b, 0xb31f, 0xb576, 0xb5cc, 0xb41b, 0xab73, 0x3037, 0x337e, 0x346c,
+    0x3488, 0x344c, 0x33d8, 0x317a, 0x2c00, 0xabae, 0xb048, 0xb061, 0xafe7,
+    0xadc1, 0xa6d5, 0x29a7, 0x2e85, 0x28eb, 0x1c7a, 0x2caa, 0x2a60, 0x1b64,
+    0x21ce, 0xafe6, 0xb63c, 0xb165, 0xb0bd, 0xb021, 0xafb8, 0xaf26, 0xad13,
+    0x9556, 0x300f, 0x3339, 0x337c, 0x30e2, 0x2912, 0xa29e, 0x21f1, 0x2960,
+    0x26e0, 0xa96a, 0xb058, 0xb328, 0xb3d7, 0xb051, 0x2d10, 0x3454, 0x3591,
+    0x3544, 0x339e, 0x2cc9, 0xac7f, 0xaebd, 0xadaa, 0xacb1, 0xad3b, 0xaf08,
+    0xac1a, 0x2680, 0x29e3, 0x2944, 0x2d80, 0x30be, 0x3290, 0x30f2, 0x2ee0,
+    0x2d58, 0x2b7c, 0x271d, 0x1d57, 0x2675, 0x2b07, 0x2012, 0x217f, 0x2910,
+    0x25e8, 0x1fb4, 0x9c14, 0x2036, 0x2e1b, 0xb172, 0xb079, 0xaf14, 0xadfb,
+    0xad1e, 0xaa70, 0x2624, 0x3085, 0x32fd, 0x3289, 0x2f1c, 0x1c78, 0xa776,
+    0x2420, 0x2ba0, 0x2997, 0xa81a, 0xb073, 0xb424, 0xb564, 0xb4b2, 0xafa2,
+    0x2d43, 0x3295, 0x33b1, 0x3257, 0x2ca3, 0xab3b, 0xade8, 0xad24, 0xaad3,
+    0xa76e, 0xa696, 0x2489, 0x2bec, 0x26b6, 0x9fe9, 0x24bd, 0x2b06, 0x2ebb,
+    0x2c38, 0x26f3, 0x9e17, 0xaa12, 0xac54, 0xac11, 0xa877, 0xa087, 0xa71d,
+    0xa2f1, 0x1e37, 0x9c31, 0xa4fd, 0xa8fc, 0xa788, 0x2968, 0xb101, 0xaf81,
+    0xacef, 0xaaaa, 0xa8e0, 0xa33f, 0x2ab5, 0x30e1, 0x32a4, 0x319a, 0x2cbf,
+    0xa819, 0xab45, 0x917b, 0x2a22, 0x2742, 0xaba6, 0xb227, 0xb5c0, 0xb80f,
+    0xb84b, 0xb66d, 0xb185, 0x290a, 0x31a8, 0x3339, 0x3135, 0x2991, 0xa7da,
+    0xab72, 0xa976, 0x9ddc, 0x2402, 0x2b97, 0x2ce6, 0x2239, 0xa7bb, 0xa254,
+    0x1fb4, 0x2a13, 0x2675, 0x1da2, 0xa4db, 0xabb8, 0xac9f, 0xabcd, 0xa9e3,
+    0xa922, 0xab6d, 0xa9e8, 0xa6f1, 0xa435, 0xa022, 0xa557, 0xa2d6, 0x2904,
+    0xaecf, 0xacb0, 0xa7dc, 0x9c9b, 0x0a85, 0x2389, 0x2cab, 0x3124, 0x328e,
+    0x3188, 0x2cca, 0xa848, 0xac0c, 0xa2a2, 0x2728, 0xa10c, 0xb02d, 0xb4f5,
+    0xb843, 0xb9f2, 0xbaa4, 0xb9c0, 0xb72b, 0xb00c, 0x3099, 0x34f3, 0x3529,
+    0x32ef, 0x2e8b, 0x2717, 0x1e4a, 0x2414, 0x25fd, 0x2bc4, 0x2c40, 0x9f6c,
+    0xab91, 0xac21, 0xac1e, 0xa834, 0xa8dd, 0xa425, 0x20d7, 0x24fb, 0x27a8,
+    0x2882, 0x27f1, 0x2029, 0xa796, 0xa90e, 0xa88e, 0x1b12, 0x2c33, 0x2c7c,
+    0x2c07, 0x2e50, 0x2d28, 0x2d74, 0x2f27, 0x2fe4, 0x2f3e, 0x2fed, 0x31ac,
+    0x3410, 0x3483, 0x33af, 0x3029, 0x1a34, 0xaa54, 0xa80a, 0xa81f, 0xaf56,
+    0xb475, 0xb802, 0xba1c, 0xbc08, 0xbc78, 0xbbfb, 0xb952, 0xb377, 0x3146,
+    0x36fc, 0x3814, 0x367f, 0x342b, 0x30e8, 0x2dc5, 0x2b55, 0x27ff, 0x2a30,
+    0x28b8, 0xab77, 0xb08f, 0xb1e3, 0xb241, 0xb10b, 0xb067, 0xacf8, 0x19d3,
+    0x2dbf, 0x3125, 0x3228, 0x31d9, 0x2ff1, 0x2ae6, 0x2669, 0x24f4, 0x2cd7,
+    0x3178, 0x31ef, 0x30b9, 0x311d, 0xa99c, 0x8afb, 0x29d9, 0x2da4, 0x2ec7,
+    0x2bca, 0xa5d0, 0xae6d, 0xb08b, 0xb13d, 0xb113, 0xaf6c, 0xae1b, 0xafc9,
+    0xb1b1, 0xb484, 0xb6cb, 0xb85b, 0xb8c6, 0xb894, 0xb819, 0xb7d8, 0xb84e,
+    0xb8ff, 0xb9a5, 0xba08, 0xba14, 0xb9b6, 0xb8eb, 0xb7b7, 0xb5b8, 0xb47d,
+    0xb3a9, 0xb2dc, 0xb17c, 0xade0, 0x2691, 0x2e72, 0x2cfc, 0x2634, 0xa0b7,
+    0xaa28, 0xad3e, 0xa833, 0x2873, 0x2919, 0x2b9e, 0x2fb4, 0x30e1, 0x3039,
+    0x2e1f, 0x2d4c, 0xa079, 0xaf97, 0xad6a, 0xad2e, 0x29c1, 0x2ccd, 0x2ed3,
+    0x303c, 0x2ff9, 0x2c6e, 0xa262, 0xad15, 0xae73, 0xae21, 0xac27, 0xa0dc,
+    0x24c4, 0x18ad, 0xa9bc, 0xb066, 0xb433, 0xb5bf, 0xb620, 0xb54c, 0xb42c,
+    0xb3e3, 0xb503, 0xb6ad, 0xb810, 0xb887, 0xb8b2, 0xb875, 0xb79d, 0xb5cf,
+    0xb411, 0xb1b3, 0xafe7, 0xad52, 0xa8c9, 0x2815, 0x2ff2, 0x312d, 0x2eb9,
+    0x2931, 0x2042, 0xa719, 0xacc7, 0xaa2a, 0x9edb, 0xa526, 0x89de, 0x2c1b,
+    0x2cd3, 0x2a5c, 0x2919, 0x29a6, 0xa8e1, 0xb035, 0xaed1, 0xade1, 0x3013,
+    0x30dd, 0x317f, 0x31e9, 0x315b, 0x2edf, 0x26e2, 0xa6ce, 0xa655, 0x94a7,
+    0x2887, 0x2d56, 0x2f2c, 0x2ece, 0x2cb5, 0x9dd2, 0xaf6f, 0xb205, 0xb185,
+    0xacea, 0x23ba, 0x2316, 0xace6, 0xb1eb, 0xb445, 0xb527, 0xb58b, 0xb509,
+    0xb34a, 0xaf20, 0x9a7f, 0x2c4b, 0x2f26, 0x3028, 0x306d, 0x3134, 0x3248,
+    0x313c, 0x2b4f, 0xa020, 0xa39c, 0xa53c, 0xac3e, 0xab37, 0xa7cd, 0xaaf1,
+    0xa8bf, 0x269a, 0x2248, 0xa5e0, 0x023a, 0x2889, 0xa4fc, 0xae0d, 0xac75,
+    0xa813, 0x2ea1, 0x304c, 0x3164, 0x3229, 0x3206, 0x3075, 0x2b91, 0x2194,
+    0x2543, 0x293c, 0x2c2f, 0x2e59, 0x2fa8, 0x2e80, 0x2b9e, 0xa405, 0xaf17,
+    0xb112, 0xaf84, 0x97ca, 0x2e42, 0x2dc4, 0x9c63, 0xae53, 0xb0f5, 0xb1c2,
+    0xb161, 0xadc8, 0x2a52, 0x3279, 0x34d1, 0x351c, 0x34d5, 0x3427, 0x32da,
+    0x3264, 0x31de, 0x2da3, 0xabd5, 0xb005, 0xadec, 0xa8f4, 0xa9df, 0xa926,
+    0xa780, 0xabf1, 0xaa3c, 0x163a, 0xa71e, 0xac00, 0xa4ae, 0x2b4f, 0x2b4b,
+    0x2402, 0x293a, 0x2f6f, 0x28de, 0x29fa, 0x2d3d, 0x3011, 0x30d8, 0x3001,
+    0x2b90, 0x2402, 0x2712, 0x2a14, 0x2c25, 0x2d1b, 0x2cbd, 0x2817, 0xa6b3,
+    0xae23, 0xb144, 0xb20a, 0xb056, 0xa515, 0x2c64, 0x29d7, 0xaae6, 0xb050,
+    0xb0fb, 0xb028, 0xab04, 0x2dfe, 0x34e8, 0x37f4, 0x388d, 0x3815, 0x3695,
+    0x34e9, 0x32df, 0x3164, 0x3008, 0x24b3, 0xaffa, 0xb1c3, 0xafd3, 0xa57a,
+    0x2478, 0x2855, 0x288e, 0xa1e0, 0xa407, 0x241a, 0xa806, 0xac5e, 0x9e7a,
+    0x2eef, 0x311f, 0x309e, 0x316f, 0x3486, 0xa971, 0x267b, 0x2efc, 0x31b6,
+    0x32c0, 0x3264, 0x30c3, 0x2d48, 0x28fc, 0x2495, 0xa389, 0xacf2, 0xb132,
+    0xb39e, 0xb40f, 0xb286, 0xb06f, 0xae43, 0xac8c, 0xac18, 0xad32, 0xae5f,
+    0xadb4, 0xaa6b, 0x9c0d, 0x247b, 0xa0ca, 0xad01, 0xb0a0, 0xb0f4, 0xae74,
+    0x8e14, 0x2bd1, 0x2754, 0xa9d9, 0xacfe, 0xae4e, 0xaf12, 0xa5f4, 0x307c,
+    0x354c, 0x37e7, 0x383f, 0x37bc, 0x3569, 0x3088, 0xacc3, 0xb3cf, 0xb3c3,
+    0xb3a6, 0xb30d, 0xb054, 0xae8f, 0xb017, 0xa8f8, 0x2d77, 0xa146, 0x2664,
+    0x2c42, 0x2e53, 0x2f30, 0x2f20, 0x2e86, 0x2d7e, 0x2d48, 0x2dbe, 0x2ce0,
+    0x288b, 0xa574, 0xad3a, 0xaefd, 0xada4, 0xab6a, 0xaa8a, 0xa9f6, 0xa9be,
+    0xab0e, 0xac70, 0xab99, 0xa628, 0x251a, 0x2a10, 0x28ed, 0x99da, 0xa95e,
+    0xaab6, 0xa8e0, 0x1fee, 0x2899, 0x9177, 0xabe5, 0xad97, 0xaf89, 0xb10e,
+    0xaf77, 0xa076, 0x30e5, 0x353b, 0x3604, 0x35a4, 0x3453, 0x30f6, 0x202c,
+    0xb0a3, 0xb1fb, 0xb2b4, 0xb263, 0xb135, 0xb145, 0xb179, 0xad8a, 0x255b,
+    0x261f, 0x2725, 0x2624, 0x2267, 0x9abf, 0xa23a, 0x1497, 0x268a, 0x2bcd,
+    0x2e2a, 0x2e9e, 0x2e25, 0x2da3, 0x2bf3, 0x2893, 0x28a6, 0x28de, 0x247a,
+    0x18af, 0x0c68, 0x9b43, 0xa2c4, 0x9f10, 0x2430, 0x289b, 0x29b9, 0x296b,
+    0x27f5, 0x26a3, 0x27eb, 0x2845, 0x294a, 0x2922, 0x2269, 0x9e91, 0x1d30,
+    0xa356, 0xadb0, 0xb029, 0xaf76, 0xa033, 0x315e, 0x3386, 0x3411, 0x33fb,
+    0x32cd, 0x3120, 0x2c53, 0xa43a, 0xadb9, 0xae54, 0xaf19, 0xb0ae, 0xb0d3,
+    0xaca3, 0x280c, 0x9ecb, 0xa2f3, 0xa926, 0xad19, 0xaf46, 0xb012, 0xaef5,
+    0xac96, 0xa61b, 0x263d, 0x2af6, 0x2da4, 0x3051, 0x30fa, 0x30b2, 0x304c,
+    0x2ead, 0x2b1a, 0x27b3, 0x28fd, 0x2b4c, 0x2c4d, 0x2cca, 0x2ca0, 0x29d1,
+    0x2220, 0xa06d, 0xa04b, 0x23eb, 0x297f, 0x2a9e, 0x29e7, 0x28d7, 0x284b,
+    0x2c0f, 0x2f79, 0x2e11, 0xa863, 0xb179, 0xb46d, 0xb3e7, 0xadda, 0x9feb,
+    0x2ce7, 0x3199, 0x335e, 0x3480, 0x3498, 0x3247, 0x2d46, 0x2832, 0xa603,
+    0xad56, 0xadce, 0xa596, 0x2d64, 0xb411, 0xb38b, 0xb3d2, 0xb460, 0xb4af,
+    0xb4a1, 0xb438, 0xb312, 0xb149, 0xaec0, 0xab1c, 0x2360, 0x2eb4, 0x3127,
+    0x3128, 0x3009, 0x2bad, 0xa3ea, 0xa9d0, 0xa4ac, 0x2739, 0x2c11, 0x2c98,
+    0x27b5, 0xab1c, 0xb04a, 0xb188, 0xb14f, 0xafbb, 0xaca3, 0xaa02, 0xa9e1,
+    0xa94d, 0xa5a6, 0x26f4, 0x2d73, 0x280d, 0xb14e, 0xb65e, 0xb8ca, 0xb8f6,
+    0xb75c, 0xb526, 0xb07d, 0x2c25, 0x32cc, 0x35c9, 0x3732, 0x35cd, 0x3358,
+    0x30e5, 0x2ae1, 0xa808, 0xa883, 0x269b, 0x2fe8, 0x2aa5, 0x290c, 0x29eb,
+    0x2a62, 0x25c1, 0xa7a3, 0xadfa, 0xb04b, 0xb10c, 0xb1ae, 0xb1a4, 0xb100,
+    0xaeeb, 0xaa3a, 0xa3bb, 0xa9a5, 0xb10e, 0xb456, 0xb409, 0xab48, 0x3281,
+    0x3626, 0x3720, 0x35f0, 0x3321, 0x2f48, 0x2cd2, 0x2bbe, 0x2a00, 0x2d39,
+    0x30e5, 0x3202, 0x3054, 0x24f4, 0xacf3, 0xb066, 0xb063, 0xae6f, 0xaef7,
+    0xae45, 0xa788, 0xa954, 0xad17, 0xa5e4, 0x26e3, 0xa98d, 0xb031, 0xb0f5,
+    0xa994, 0x1ac9, 0xad6d, 0xb0ed, 0xb05f, 0xb055, 0xac2f, 0x9c9e, 0x2695,
+    0x231d, 0x25ac, 0x28c4, 0x2542, 0xa521, 0xabad, 0xad27, 0xad37, 0xad1e,
+    0xabdb, 0xa957, 0xa649, 0x9d1d, 0x27a6, 0x2c9b, 0x2c0e, 0x2501, 0x26ba,
+    0x3059, 0x3474, 0x35c4, 0x35ef, 0x34b5, 0x3183, 0x2df0, 0x2c87, 0x2a69,
+    0x9993, 0xa685, 0x1c5c, 0x292e, 0x27f2, 0xa88e, 0xadf4, 0xafc7, 0xae11,
+    0xa757, 0x9cb5, 0x1c59, 0x2c10, 0x2c73, 0x24a8, 0x1f5b, 0x1dd8, 0xa9af,
+    0xacdf, 0xac4a, 0x2247, 0x2576, 0xa899, 0xac28, 0xab19, 0xacb3, 0xa7a7,
+    0x202c, 0xaed2, 0xadd2, 0xaa0f, 0x9efc, 0x9ba0, 0xa480, 0xa6fe, 0xa93b,
+    0xa8d9, 0xa45c, 0x2518, 0x2981, 0x2948, 0x256f, 0x2830, 0x2f8f, 0x3244,
+    0x32bd, 0x3287, 0x334c, 0x33e0, 0x32d6, 0x30ff, 0x2cec, 0x1f60, 0x863a,
+    0x28af, 0x29dc, 0xa4f3, 0xade9, 0xaf6b, 0xae9b, 0xae1e, 0xb033, 0xb0f9,
+    0xb0d7, 0xaf0b, 0xa8f5, 0x1707, 0x23a0, 0x2b96, 0x2ce3, 0x280f, 0xa007,
+    0xa804, 0xa9c8, 0xa6b2, 0x2071, 0x2ab8, 0x23ba, 0xa56d, 0xa394, 0x0b0c,
+    0xa85b, 0x9e82, 0x246a, 0xb329, 0xb176, 0xad0a, 0x1d86, 0x28fe, 0x2a64,
+    0x2c2e, 0x2c02, 0x2b7d, 0x2bfb, 0x2e6e, 0x30a9, 0x30b2, 0x2d73, 0x2a1b,
+    0x2f8a, 0x329e, 0x3315, 0x318f, 0x2e3e, 0xa3fd, 0xb113, 0xb44c, 0xb516,
+    0xb48a, 0xb134, 0xa465, 0x2c2c, 0x292a, 0xa60c, 0xab85, 0xac4b, 0xace7,
+    0xafbe, 0xb0ab, 0xb030, 0xadf6, 0xa8d3, 0x19cd, 0x20e6, 0x2740, 0x28e7,
+    0x1f59, 0xa099, 0xa0d1, 0x1e82, 0x2b26, 0x2d91, 0x2dc3, 0x26be, 0x1d55,
+    0x296c, 0x2a76, 0x1714, 0x1e47, 0x2596, 0xb586, 0xb3f7, 0xae7e, 0x2823,
+    0x2efd, 0x3127, 0x3239, 0x320e, 0x3144, 0x301e, 0x3055, 0x31c2, 0x318b,
+    0x2c01, 0xab49, 0xac2a, 0xa7f7, 0xab2a, 0xb0cc, 0xb4dd, 0xb80c, 0xb9aa,
+    0xba96, 0xba83, 0xb959, 0xb6af, 0xb125, 0x2008, 0x2b19, 0x2a26, 0x2acd,
+    0x2c20, 0x2b43, 0x1de1, 0xa77b, 0xa50b, 0x1cd5, 0x293e, 0x2ca3, 0x2c18,
+    0x2ac5, 0x285a, 0x1d2f, 0x28f9, 0x2e90, 0x315c, 0x3377, 0x33cb, 0x324b,
+    0x2f67, 0x2f56, 0x31d2, 0x31f5, 0x2f5b, 0x2d62, 0x2d6f, 0x350d, 0x3231,
+    0x24aa, 0xb063, 0xb2cf, 0xb27a, 0xaf4c, 0x9d5f, 0x2cf6, 0x2f7d, 0x30ba,
+    0x31fc, 0x3261, 0x31f2, 0x3076, 0x2974, 0xac41, 0xae2f, 0x9c0c, 0x30bf,
+    0x33f9, 0x33ae, 0x3008, 0x9f3e, 0xac91, 0xad7e, 0xae7d, 0xadbc, 0xa328,
+    0x280b, 0x29d5, 0x29d5, 0x2ab4, 0x2c51, 0x28af, 0x9ef6, 0x8fc4, 0x2652,
+    0x2d97, 0x2f94, 0x2a63, 0xac05, 0xafcc, 0xaee9, 0xaefe, 0xac1c, 0x2603,
+    0x3001, 0x302a, 0x2270, 0x9a78, 0x2e38, 0x2d33, 0x21e8, 0x2700, 0x33d1,
+    0x332d, 0x2e53, 0xad1f, 0xb3ba, 0xb53a, 0xb523, 0xb369, 0xaedc, 0xa2ad,
+    0x2507, 0x2598, 0x2898, 0x2ba3, 0x2dee, 0x2db9, 0x8f70, 0xb020, 0xb187,
+    0xacd1, 0x2d7f, 0x3242, 0x327c, 0x2f9c, 0x2560, 0xa4ac, 0xa735, 0xabef,
+    0xad75, 0xa963, 0x0160, 0x2586, 0x2614, 0x2262, 0x028e, 0xa84e, 0xac3d,
+    0xac0b, 0xa5b2, 0x2d7b, 0x314c, 0x2ffa, 0x263f, 0xa7c9, 0xa96e, 0xadeb,
+    0xae39, 0xac62, 0x9ed3, 0x9047, 0xac5b, 0xaa17, 0x2953, 0x298f, 0x1e5d,
+    0x278c, 0x328b, 0x31ec, 0x28de, 0xb133, 0xb584, 0xb737, 0xb768, 0xb610,
+    0xb3bb, 0xb01c, 0xaddb, 0xaeb6, 0xae72, 0xaab7, 0x291c, 0x2dd9, 0x21df,
+    0xb0c6, 0xb385, 0xb10c, 0x2152, 0x307d, 0x3143, 0x2e31, 0x25cc, 0x1f57,
+    0x2276, 0xa4a9, 0xab0c, 0xa81f, 0x259a, 0x2d00, 0x2f12, 0x2e86, 0x2bbd,
+    0xa0c7, 0xac85, 0xadb0, 0xaace, 0x2b7b, 0x314f, 0x3185, 0x2f07, 0x2c2c,
+    0x2a4d, 0xa5af, 0xae6f, 0xb0cb, 0xaf50, 0xadf3, 0xaec3, 0xaa6c, 0x28b2,
+    0x2c1c, 0x2cdc, 0x2fa4, 0x340a, 0x32d2, 0x2753, 0xb2c0, 0xb6be, 0xb86b,
+    0xb8a9, 0xb80f, 0xb5d5, 0xb39a, 0xb1f9, 0xb256, 0xb212, 0xaeb9, 0x2b9f,
+    0x31ac, 0x2f5c, 0xace4, 0xb298, 0xb100, 0x2373, 0x3151, 0x3220, 0x2e68,
+    0x973d, 0xa711, 0xa1c6, 0xa5bc, 0xa99a, 0x9d9a, 0x2d55, 0x31d3, 0x3402,
+    0x3429, 0x3262, 0x2cc6, 0xab13, 0xb019, 0xb042, 0xac1b, 0x2924, 0x2eaf,
+    0x2f09, 0x2d4c, 0x2c0e, 0x1e43, 0xae94, 0xb2bc, 0xb20d, 0xb0a3, 0xaf7f,
+    0xa7b3, 0x2be4, 0x2f27, 0x3176, 0x33e3, 0x3586, 0x3673, 0x30ad, 0xb13d,
+    0xb6bf, 0xb8a8, 0xb8f8, 0xb854, 0xb611, 0xb34f, 0xb10b, 0xb118, 0xb0b7,
+    0xa889, 0x31d6, 0x3575, 0x3464, 0x2a00, 0xaf5e, 0xacfc, 0x2e55, 0x341b,
+    0x340b, 0x2dc9, 0xae04, 0xb1b2, 0xb1aa, 0xb171, 0xb11c, 0xacaa, 0x2d71,
+    0x33e0, 0x35aa, 0x35f7, 0x34a3, 0x2f4a, 0xad28, 0xb2b1, 0xb442, 0xb448,
+    0xb1e5, 0xab04, 0x2a4c, 0x2d6f, 0x2e09, 0x2c0a, 0xa974, 0xb154, 0xb13b,
+    0xae02, 0xa542, 0x2d0a, 0x30c2, 0x3231, 0x3484, 0x35e8, 0x36dd, 0x350e,
+    0x345a, 0x3107, 0xa5e8, 0xb280, 0xb494, 0xb3f3, 0xb088, 0xaae9, 0xa570,
+    0xab04, 0xadf4, 0xad78, 0xa4c8, 0x258e, 0xaa84, 0xb1d2, 0xb317, 0xb037,
+    0xa55c, 0x2a00, 0x2d59, 0x2c90, 0x1d2e, 0xaccc, 0xb0e9, 0xb2a7, 0xb1ae,
+    0xab2f, 0x2c31, 0x305d, 0x307a, 0x2ff1, 0x2dc2, 0x2dfa, 0x2f7e, 0x1713,
+    0xb31e, 0xb6cd, 0xb842, 0xb766, 0xb4a8, 0xb224, 0xaf3e, 0xa7ce, 0x2bd5,
+    0x31c9, 0x3550, 0x366f, 0x353d, 0x316c, 0x8fcc, 0xb080, 0xb3d7, 0xb3a4,
+    0xafc2, 0x348a, 0x3430, 0x31e8, 0x2944, 0xae5b, 0xb131, 0xb07d, 0xac49,
+    0x0bee, 0x241e, 0xa7d6, 0xac86, 0xaac5, 0x283f, 0x2d88, 0x243d, 0xaee6,
+    0xb088, 0xac08, 0x26ee, 0x2d14, 0x2efe, 0x2e3a, 0x29c1, 0xa029, 0xac45,
+    0xafd0, 0xaf24, 0xa5cd, 0x2c6a, 0x2f64, 0x2dbb, 0x2a4e, 0x240d, 0x28cb,
+    0x2d8b, 0x232e, 0xb03e, 0xb401, 0xb4fb, 0xb365, 0xad13, 0xa2d5, 0x2a0c,
+    0x2e86, 0x30ad, 0x31fc, 0x32df, 0x3234, 0x2de6, 0xaa00, 0xb0b1, 0xb1e7,
+    0xb325, 0xb1e9, 0xa09a, 0x31e4, 0x3175, 0x2fb4, 0x26be, 0xabfc, 0xadc2,
+    0xad6d, 0xab61, 0xa2b5, 0xa2df, 0xad32, 0xaf88, 0xac64, 0x29e0, 0x2e84,
+    0x2646, 0xae07, 0xafe3, 0xaae9, 0x24e9, 0x2b58, 0x2ca9, 0x2ad4, 0x22e5,
+    0xa016, 0xa835, 0xacb9, 0xad2d, 0xa883, 0x1c17, 0x2533, 0x9f54, 0xaa73,
+    0xae1d, 0xad7e, 0xa8ae, 0xad13, 0xb098, 0xb0fe, 0xb0f6, 0xabce, 0x2cb5,
+    0x2f60, 0x31a2, 0x32d9, 0x3291, 0x31d6, 0x2ebb, 0x19b7, 0xaf0d, 0xb2a0,
+    0xb2f4, 0xb0bc, 0xb011, 0xabb9, 0x3183, 0x307f, 0x2e7c, 0x2944, 0xa685,
+    0xac68, 0xaadb, 0xa822, 0xa3d9, 0x26e8, 0x2889, 0xa845, 0xad3e, 0xa6ff,
+    0x2edc, 0x313e, 0x2c75, 0xac25, 0xaf13, 0xab14, 0x2074, 0x2831, 0x25ad,
+    0xa4a4, 0xa956, 0xa2e8, 0x226b, 0x9f49, 0xa86c, 0xa83b, 0xa739, 0xa7a7,
+    0xaabc, 0xae6b, 0xb16c, 0xb22c, 0xb159, 0xb1d6, 0xb122, 0xac26, 0x20b7,
+    0x2f5e, 0x3338, 0x3420, 0x34e9, 0x34e7, 0x32f5, 0x2f67, 0xa932, 0xb123,
+    0xb453, 0xb4e4, 0xb244, 0xa681, 0x2905, 0x2fbb, 0x365f, 0x30b3, 0x2c85,
+    0xa6d1, 0xae90, 0xb01e, 0xad1f, 0xa642, 0x20e2, 0x2bfd, 0x2d74, 0x2513,
+    0xaa47, 0xa120, 0x2fe3, 0x315c, 0x2b16, 0xad33, 0xb031, 0xad39, 0xa2b8,
+    0x21f4, 0xa0da, 0xab54, 0xab1c, 0x255d, 0x2df8, 0x2e95, 0x2d5a, 0x2cc2,
+    0x2c7c, 0x2bf2, 0x289c, 0xa662, 0xaf03, 0xb0be, 0xb03c, 0xaee2, 0x2031,
+    0x326e, 0x3567, 0x373b, 0x381a, 0x37b6, 0x3740, 0x35ba, 0x30c4, 0xacee,
+    0xb4d2, 0xb61c, 0xb767, 0xb763, 0xb3f9, 0x262e, 0x3065, 0x33ed, 0x3884,
+    0x3133, 0x31d7, 0x3139, 0x2e12, 0xa190, 0xaecb, 0xb05c, 0xb0e2, 0xb190,
+    0xb1c3, 0xb1c7, 0xb1c5, 0xb0cd, 0xaef2, 0xaf81, 0xb1c9, 0xb40f, 0xb468,
+    0xb3ab, 0xb263, 0xb1ac, 0xb030, 0x9ce6, 0x3139, 0x3423, 0x33c1, 0x31e3,
+    0x30c7, 0x30d4, 0x30bf, 0x2ef4, 0x2c64, 0x2a39, 0x2c15, 0x2fb2, 0x31e8,
+    0x321b, 0x3095, 0x2fa1, 0x2e5a, 0x2c9b, 0x26c1, 0x244f, 0x268f, 0x24cc,
+    0x29cd, 0x26e7, 0xa91c, 0xad3a, 0xac74, 0x9aef, 0x2612, 0x236d, 0xa5a2,
+    0xa0d8, 0x2fc2, 0x3486, 0x3461, 0x3327, 0x3042, 0x269f, 0xab4b, 0xac10,
+    0xab0a, 0xac40, 0xad55, 0xae68, 0xaf0a, 0xad4f, 0xa888, 0xa742, 0xacf6,
+    0xb0d8, 0xb20f, 0xb176, 0xb03c, 0xaeec, 0xad31, 0x9f09, 0x2e35, 0x30c8,
+    0x2fae, 0x2c6d, 0x2a7b, 0x2cbc, 0x2e9d, 0x2e4a, 0x2d5c, 0x2ce3, 0x2cf9,
+    0x2e0f, 0x2f9e, 0x2e97, 0x2c29, 0x2c23, 0x2be3, 0x2a50, 0x2076, 0xa12c,
+    0x9e8b, 0xa610, 0xa009, 0xa5dd, 0xac2c, 0xad4d, 0xac50, 0xa0cb, 0x2937,
+    0x2a96, 0x1f1f, 0x19ab, 0x2ffa, 0x3704, 0x365f, 0x34f0, 0x31de, 0x2b35,
+    0xa46d, 0x9f3b, 0x22e9, 0x8f7d, 0xa82c, 0xac0c, 0xacf9, 0xa9d2, 0x2245,
+    0x2837, 0x168e, 0xab75, 0xade6, 0xac7b, 0xa435, 0x25a2, 0x291d, 0x2c02,
+    0x2e11, 0x2e36, 0x2ac6, 0x1941, 0xa6b7, 0xa5a5, 0x21ac, 0x2821, 0x2955,
+    0x2aa5, 0x2a7a, 0x2979, 0x2988, 0x25c6, 0x1e82, 0x2727, 0x28e1, 0x28cf,
+    0x2307, 0x0c29, 0x975a, 0xa89a, 0xa757, 0xaaaa, 0xac7b, 0xac34, 0xabd9,
+    0xa69a, 0x26fe, 0x2c27, 0x27a6, 0x2400, 0x2f85, 0x386e, 0x3815, 0x3655,
+    0x335e, 0x2c79, 0xa4d2, 0x9c1f, 0x2601, 0x1d24, 0xa805, 0xabd1, 0xaceb,
+    0xa9ab, 0x25da, 0x2b64, 0x28f4, 0xa2c4, 0xa90b, 0x9867, 0x2cb5, 0x2f94,
+    0x2ea3, 0x2a54, 0x9dbc, 0xaaaf, 0xaeab, 0xb0fe, 0xb23f, 0xb290, 0xb1ca,
+    0xb0cc, 0xafaa, 0xad6c, 0xac61, 0xac85, 0xac1a, 0xacd1, 0xacb0, 0xa852,
+    0x9bf3, 0x2428, 0x2632, 0x27bf, 0x23ed, 0xa8d9, 0xa8ee, 0xacf8, 0xad3b,
+    0xaa4a, 0xaba5, 0xab4c, 0xa365, 0x292a, 0x24c6, 0x9f48, 0x2c48, 0x384b,
+    0x386e, 0x379c, 0x34e8, 0x3007, 0x228f, 0x24d0, 0x2af8, 0x2976, 0x2004,
+    0xa548, 0xa92c, 0xa552, 0x283f, 0x2c01, 0x2940, 0x9cd1, 0xa2c7, 0x2975,
+    0x3035, 0x3174, 0x2f2c, 0xa6bd, 0xb1b8, 0xb4a6, 0xb5dd, 0xb6ea, 0xb7c3,
+    0xb808, 0xb79e, 0xb6d5, 0xb5eb, 0xb4e4, 0xb443, 0xb40f, 0xb361, 0xb388,
+    0xb3c1, 0xb2d8, 0xb154, 0xaf7d, 0xad03, 0xabcb, 0xad59, 0xb053, 0xaf6f,
+    0xb0db, 0xb0c1, 0xae37, 0xaf95, 0xb0c5, 0xafb6, 0xa9e3, 0xaae9, 0xadaa,
+    0xa8a1, 0x34ce, 0x3173, 0x26ef, 0xabef, 0xa97d, 0x281a, 0x2c59, 0x28d9,
+    0x0875, 0x210b, 0x2468, 0x1c29, 0x21fa, 0x246d, 0xa902, 0xace5, 0xa2b4,
+    0x2cf1, 0x2f98, 0x2deb, 0x271c, 0xa865, 0xa6df, 0x29d4, 0x2c6c, 0x20eb,
+    0xa69e, 0x9b09, 0xa4a3, 0xaca4, 0xaf1f, 0xacc6, 0xa86d, 0xae5d, 0xb2c3,
+    0xb2ef, 0xb197, 0xb0c1, 0xaafe, 0x286c, 0x26e2, 0x2cbc, 0x30bf, 0x2e66,
+    0x2bb4, 0x2b51, 0x2a39, 0x2c79, 0x2b08, 0x9f29, 0x2149, 0xa603, 0xac94,
+    0xaba8, 0x1e74, 0x3060, 0x3504, 0x3105, 0xa3de, 0xaf5b, 0xaf15, 0xabf0,
+    0xa771, 0xa890, 0xab85, 0xaad2, 0xa8a2, 0xa584, 0x203a, 0x2790, 0xa146,
+    0xa9fb, 0x93b3, 0x2c53, 0x2db1, 0x29ba, 0xa91b, 0xaf18, 0xad7c, 0x21c9,
+    0x2a2e, 0x9dd8, 0xa888, 0x8d79, 0x2263, 0xa76b, 0xac19, 0xa58c, 0x23a0,
+    0xa8d0, 0xafb6, 0xaf1f, 0xac0e, 0xa3f2, 0x2c34, 0x2efe, 0x2c08, 0x299d,
+    0x2a7d, 0x1c1b, 0x1add, 0x9b7b, 0x992d, 0x2b0e, 0x2c6b, 0x2040, 0x28e8,
+    0x25af, 0xa7b0, 0xa439, 0x2cd7, 0x30c8, 0x366c, 0x3357, 0x2a36, 0xac44,
+    0xad4a, 0xacf3, 0xabe8, 0xac54, 0xade7, 0xadb1, 0xac01, 0xa91f, 0xa37b,
+    0x0475, 0xa7e6, 0xabff, 0xa73d, 0x2690, 0x27b3, 0xa378, 0xadf9, 0xb137,
+    0xaf05, 0x27f9, 0x2dcf, 0x2860, 0xa211, 0x1f70, 0x26ba, 0x152c, 0xa700,
+    0x1db3, 0x2883, 0x2023, 0xa940, 0xa6e1, 0x250d, 0x2d64, 0x317b, 0x32c0,
+    0x303c, 0x2cee, 0x2c49, 0x22b7, 0x9fda, 0xabe8, 0xadd1, 0xac65, 0xa8c2,
+    0xacb4, 0xa47f, 0x1ef7, 0xa44f, 0x21d6, 0x302a, 0x307f, 0x3562, 0x3166,
+    0x26e4, 0xa9f2, 0xaa5a, 0xab2f, 0xab95, 0xacd4, 0xaf17, 0xaffd, 0xaf7e,
+    0xaeff, 0xaeba, 0xaf2a, 0xb06b, 0xb0d4, 0xaf1c, 0xac6a, 0xac4a, 0xace5,
+    0xaf4b, 0xb1fd, 0xb13c, 0xa9d0, 0x210d, 0xa973, 0xad5c, 0xa9f3, 0x1fe0,
+    0x27a5, 0x270f, 0x2a13, 0x2c0d, 0x2909, 0xa3b7, 0xa7bc, 0xa8d0, 0xa425,
+    0x2b72, 0x3049, 0x2ed6, 0x2cc8, 0x284a, 0xaa8e, 0xae38, 0xb17d, 0xb244,
+    0xb183, 0xb17c, 0xb231, 0xb017, 0xacf3, 0xaaf4, 0x24f7, 0x3008, 0x27fc,
+    0x2ec4, 0xadc1, 0xb2a7, 0xb2d6, 0xb05a, 0xaccb, 0xa803, 0x242d, 0x2bd0,
+    0x2e6a, 0x2f8d, 0x2ef7, 0x2d0e, 0x2a33, 0x2690, 0x2894, 0x2f51, 0x32cf,
+    0x3467, 0x3508, 0x3453, 0x2e3e, 0xa919, 0xacf3, 0xaec8, 0xb17d, 0xb27f,
+    0xb0c0, 0xaaf9, 0x25e0, 0x2b53, 0x2ce4, 0x2cd9, 0x201f, 0xb07d, 0xb464,
+    0xb652, 0xb796, 0xb730, 0xb4c8, 0xb10d, 0xa3c3, 0x2dfe, 0x3075, 0x3378,
+    0x3483, 0x3676, 0x3835, 0x3738, 0x367b, 0x376d, 0x3709, 0x3715, 0x3807,
+    0x3732, 0x3062, 0xaf67, 0xada6, 0xa672, 0x2a59, 0x2d51, 0x2bf6, 0x9a31,
+    0xadf0, 0xb18d, 0xb1f7, 0xae89, 0x2650, 0x302a, 0x3184, 0x2fa1, 0xa300,
+    0xb16f, 0xb414, 0xb299, 0xaeb4, 0xae80, 0xb2fd, 0xb587, 0xb68e, 0xb6d5,
+    0xb70a, 0xb6ec, 0xb4d4, 0x2150, 0x34f1, 0x381a, 0x387a, 0x3785, 0x3584,
+    0x338a, 0x3133, 0x2deb, 0xa442, 0xaf06, 0xa94f, 0x296f, 0x2c58, 0x2f0d,
+    0x31a8, 0x31bc, 0x2bdc, 0xa98e, 0xaaae, 0xa6ef, 0xae86, 0xb337, 0xb107,
+    0xa221, 0xacd1, 0xaaf1, 0x350c, 0xadae, 0xabab, 0x1852, 0x2c8d, 0x2e67,
+    0x2cce, 0x23b3, 0xac00, 0xaff9, 0xb013, 0xaaf3, 0x2991, 0x2f1d, 0x302c,
+    0x2e77, 0x28fe, 0xa98f, 0xadb8, 0xa986, 0x2a1d, 0x2be3, 0xa7de, 0xb0e7,
+    0xb3d5, 0xb4de, 0xb5be, 0xb65a, 0xb548, 0xaebe, 0x2f6b, 0x3440, 0x34aa,
+    0x32de, 0x3018, 0x2cb8, 0x2c25, 0x2b06, 0x9e2e, 0xac27, 0x13ab, 0x29ad,
+    0x26ba, 0x24ef, 0x2bd8, 0x2dcb, 0x2708, 0xa934, 0xa613, 0x24fe, 0xa91a,
+    0xb092, 0xad19, 0x26ee, 0xaa48, 0xa5db, 0x3543, 0xabe4, 0xa68e, 0x2900,
+    0x2e09, 0x2e8e, 0x2ca8, 0x22f9, 0xac37, 0xafe0, 0xaeec, 0xa829, 0x2a1c,
+    0x2e36, 0x2ec0, 0x2d2c, 0x2a24, 0x8b4f, 0xa828, 0x1ecc, 0x2ddd, 0x2f94,
+    0x2958, 0xad5a, 0xb21f, 0xb427, 0xb4e8, 0xb56b, 0xb4ba, 0xb01d, 0x25cb,
+    0x2f2e, 0x2f57, 0x2ac4, 0x1c80, 0x9818, 0x288e, 0x2a72, 0x1c19, 0xa7e9,
+    0x2698, 0x279d, 0xa53a, 0xaab7, 0xa456, 0x2547, 0xa25e, 0xaa4c, 0xa1a4,
+    0x28cb, 0xa19b, 0xae38, 0xa854, 0x281f, 0xabb4, 0x9bd2, 0x35c1, 0xa75a,
+    0x21cd, 0x2d03, 0x2f8f, 0x2f24, 0x2c8b, 0x2367, 0xab37, 0xae55, 0xaba5,
+    0x25e9, 0x2d26, 0x2f09, 0x2f04, 0x2c4e, 0x0971, 0xad5b, 0xb064, 0xae8c,
+    0xa399, 0x2181, 0xac8f, 0xb27c, 0xb4ca, 0xb51c, 0xb49b, 0xb3cc, 0xb126,
+    0x1b57, 0x3000, 0x3191, 0x30b8, 0x2cf7, 0x2751, 0x23b5, 0x296b, 0x295d,
+    0x9dca, 0xa3fc, 0x2933, 0x26c9, 0xa7ae, 0xaaf0, 0xa22f, 0x24db, 0xa0fb,
+    0xa8d5, 0x9610, 0x287a, 0xa51a, 0xae53, 0xa912, 0x9d3e, 0xad75, 0x21f1,
+    0x36a1, 0xac55, 0xa549, 0x2a49, 0x2d3d, 0x2c43, 0x2438, 0xa958, 0xae89,
+    0xafd6, 0xaa5e, 0x2b5d, 0x2fb7, 0x30bf, 0x3034, 0x2859, 0xaf33, 0xb420,
+    0xb551, 0xb498, 0xb206, 0xb157, 0xb41d, 0xb610, 0xb6f5, 0xb5ff, 0xb371,
+    0xad98, 0x2c20, 0x345f, 0x3672, 0x36e4, 0x3618, 0x34ca, 0x3357, 0x31b7,
+    0x3114, 0x2ed6, 0x2817, 0x2682, 0x2d58, 0x2cf9, 0x27ae, 0x2575, 0x2c40,
+    0x2d57, 0x2a72, 0x2656, 0x2b64, 0x2b68, 0xa581, 0xad9c, 0xa57c, 0x1c4a,
+    0xabbc, 0x2c83, 0x3818, 0xb3db, 0xb181, 0xadf1, 0xa980, 0xa60b, 0xaa6f,
+    0xac99, 0xa997, 0x1cdc, 0x23dd, 0x24b7, 0x2611, 0x209b, 0xa8e1, 0xaca7,
+    0xac4c, 0xa95a, 0xa936, 0xad83, 0xb085, 0xb0fb, 0xac8d, 0x3025, 0x35b4,
+    0x3817, 0x3850, 0x36ce, 0x318d, 0xb064, 0xb466, 0xb32c, 0xaf38, 0xa7d1,
+    0x1a59, 0x9d46, 0xa67d, 0xa7f5, 0xa8c1, 0xa990, 0xac28, 0xa7c2, 0xa389,
+    0x1296, 0x24a9, 0x229c, 0x2560, 0xa971, 0xaa53, 0xa7ee, 0xa40c, 0xae85,
+    0xb05f, 0xae63, 0xa694, 0x2572, 0x30b4, 0xb11f, 0xad53, 0x9d37, 0x2a44,
+    0x2c67, 0x2919, 0x1b1e, 0x2107, 0x2970, 0x29f2, 0x28e7, 0x2a2b, 0x2ca5,
+    0x2cb8, 0x2b4a, 0x29fe, 0x2ac8, 0x2aa1, 0x2708, 0x1e81, 0x25c7, 0x2e49,
+    0x32d8, 0x3483, 0x3419, 0x30bd, 0xa05d, 0xb215, 0xb578, 0xb534, 0xb122,
+    0x2463, 0x2f56, 0x301a, 0x2d6c, 0x27bb, 0x1c87, 0x9aaa, 0x99f0, 0xa676,
+    0x9fd6, 0xa4e5, 0xa411, 0x20f8, 0x18bc, 0x2206, 0xa693, 0xa616, 0x9c15,
+    0x224e, 0xac4a, 0xadd3, 0xac19, 0xa980, 0xa6f4, 0x2d69, 0xae94, 0xa863,
+    0x2986, 0x2e64, 0x3002, 0x2e56, 0x2b84, 0x2a27, 0x2a0f, 0x2237, 0xa501,
+    0x9964, 0x2a94, 0x2d50, 0x2d0d, 0x2bc2, 0x2a99, 0x2983, 0x2737, 0x29a2,
+    0x2e8f, 0x3169, 0x31fd, 0x2e7a, 0xacbc, 0xb475, 0xb735, 0xb86b, 0xb873,
+    0xb684, 0xb0bf, 0x2dda, 0x32d5, 0x3301, 0x30ae, 0x2bfb, 0x2515, 0x244b,
+    0x2887, 0x26ee, 0x28b1, 0x20e7, 0x9357, 0x2625, 0x1c3c, 0x21e4, 0x1e0e,
+    0x282d, 0x285c, 0x2903, 0x9caa, 0xa3c4, 0x1fd7, 0xa44e, 0xa9dd, 0x2619,
+    0xae56, 0xaa4c, 0x25c5, 0x2ce9, 0x2e70, 0x2ddc, 0x2c20, 0x28db, 0x2123,
+    0xaa38, 0xadc7, 0xac4c, 0x9bdd, 0x2826, 0x287a, 0x2857, 0x2927, 0x25a4,
+    0xa4de, 0xa188, 0x2b87, 0x2e56, 0x268d, 0xb1a1, 0xb714, 0xb97c, 0xbab3,
+    0xbae8, 0xba1d, 0xb852, 0xb396, 0x2902, 0x3225, 0x32b6, 0x3027, 0x2886,
+    0xa0a7, 0x9df9, 0x27ba, 0x2993, 0x2b11, 0x28ff, 0x2906, 0x2d69, 0x2c80,
+    0x2c07, 0x2c30, 0x2e09, 0x2bce, 0x2a33, 0x2891, 0x290c, 0x2aea, 0x20d9,
+    0xa9fc, 0xa352, 0xa085, 0x9c57, 0x2602, 0x29d8, 0x29c1, 0x2a44, 0x29f7,
+    0x2644, 0xa1c6, 0xacdf, 0xafd4, 0xadc4, 0xa044, 0x2a42, 0x2d39, 0x2f2a,
+    0x303e, 0x2e1b, 0x2093, 0xa5c5, 0x2576, 0x23ec, 0xb06c, 0xb6d2, 0xba04,
+    0xbc07, 0xbc83, 0xbc65, 0xbb90, 0xb996, 0xb64e, 0xaf16, 0x2bbb, 0x2e4d,
+    0x285d, 0xaa45, 0xadf9, 0xae0c, 0xaaf3, 0xa45a, 0x1f21, 0x231b, 0x294c,
+    0x2f61, 0x2f93, 0x2e56, 0x2e47, 0x2e7b, 0x2129, 0xa572, 0xa136, 0x91d3,
+    0x9c7d, 0xa692, 0xabf9, 0xa9b1, 0x360a, 0x3484, 0x2fa7, 0xacac, 0xb451,
+    0xb6c9, 0xb78a, 0xb604, 0xb293, 0xaa76, 0x2d21, 0x30f0, 0x3037, 0x2df8,
+    0x2f8b, 0x310b, 0x3027, 0x29a1, 0xa842, 0xa83e, 0x256f, 0x2827, 0x9e17,
+    0xa2ef, 0x26ff, 0x2cc8, 0x2d1c, 0x2634, 0xa900, 0xa991, 0xa8ff, 0xa99e,
+    0xab09, 0xa858, 0x9ae9, 0xa941, 0xab3f, 0xa776, 0xa973, 0xa8a2, 0x1c34,
+    0xa0e1, 0xa07b, 0x9c01, 0x25b7, 0x272c, 0x242d, 0x2a7a, 0x245b, 0xac15,
+    0xad7f, 0xa8b2, 0x21e6, 0x28c2, 0x3006, 0x33f1, 0x3620, 0x347b, 0x2ee1,
+    0xadda, 0xb4c0, 0xb720, 0xb767, 0xb554, 0xb016, 0x2c0c, 0x32a3, 0x3429,
+    0x322a, 0x2e0d, 0x2c3a, 0x2c6c, 0x25f5, 0xabc5, 0xaffb, 0xaf64, 0xaa81,
+    0xa54d, 0xa958, 0xaa38, 0xa597, 0x210b, 0x2247, 0xa6dd, 0xab84, 0xa968,
+    0xa6d1, 0xa5e9, 0xa7af, 0x9e52, 0x2770, 0xa006, 0xa5b9, 0x20e7, 0x9d87,
+    0xa515, 0x1c50, 0xa43b, 0xa90e, 0xaadb, 0xa54b, 0xa034, 0xa87a, 0x9de2,
+    0x9e1f, 0xa9fa, 0xaa75, 0x1e87, 0x290d, 0x23e8, 0x2c7a, 0x3070, 0x369b,
+    0x3476, 0x2c77, 0xb161, 0xb66e, 0xb860, 0xb834, 0xb55d, 0xac0c, 0x3219,
+    0x35e5, 0x36ad, 0x3520, 0x3131, 0x2ba6, 0x224f, 0xaad6, 0xb066, 0xb231,
+    0xb182, 0xad89, 0xa693, 0xa597, 0xa6ba, 0x9f0f, 0x2460, 0x225a, 0xa50d,
+    0xa833, 0x9fc8, 0x21a6, 0x2025, 0xa11d, 0x162d, 0x263a, 0x9d75, 0x1d11,
+    0x2b71, 0x2a40, 0x23a3, 0x24d3, 0x22d5, 0x909b, 0xa878, 0xa739, 0xa8b8,
+    0xacb1, 0xa9ca, 0xa17e, 0xa4ec, 0xa4c2, 0x287b, 0x2aa7, 0xa24f, 0x1cc6,
+    0x21fd, 0x36d3, 0x33b0, 0xa6bd, 0xb505, 0xb8b8, 0xb9f5, 0xb98a, 0xb6d8,
+    0xab5b, 0x34a9, 0x3846, 0x38d9, 0x37e5, 0x3465, 0x2e0e, 0x1e41, 0xab7d,
+    0xb023, 0xb1fb, 0xb1c3, 0xae5b, 0xa4b8, 0x2444, 0x267f, 0x29b7, 0x2c91,
+    0x2c9e, 0x2a60, 0x2aa6, 0x2d18, 0x2d7d, 0x2c51, 0x2822, 0x2560, 0x2726,
+    0x24f7, 0x2c36, 0x2fe3, 0x2d39, 0x24c9, 0x2516, 0x2802, 0x2667, 0xa49b,
+    0xa58b, 0xab7b, 0xaf20, 0xad1c, 0xa487, 0x2466, 0x2583, 0x28e2, 0x2849,
+    0xaa44, 0xacda, 0xaffb, 0x3916, 0x35a1, 0xa3f1, 0xb62f, 0xb9c7, 0xbb2d,
+    0xba94, 0xb7b3, 0x218e, 0x37af, 0x3a56, 0x3aff, 0x39cb, 0x36d1, 0x30d4,
+    0x9c51, 0xad97, 0xb106, 0xb329, 0xb3a0, 0xb196, 0xae10, 0xaaf6, 0xa9fa,
+    0xa680, 0x23c2, 0x2826, 0x255b, 0x283f, 0x2ae8, 0x289a, 0x0e31, 0xa945,
+    0xab85, 0xaa0a, 0xa718, 0x2b24, 0x2f8c, 0x28a5, 0xac34, 0xace8, 0xaa58,
+    0xa71b, 0xa9f9, 0xa8c4, 0xacc1, 0xb008, 0xad55, 0x189c, 0x2c6a, 0x2df6,
+    0x2de2, 0x2a28, 0xabaa, 0xb07e, 0xb3b1, 0x987e, 0x9878, 0x987f, 0x9876,
+    0x9882, 0x9874, 0x9884, 0x9872, 0x9886, 0x9870, 0x9887, 0x986f, 0x9888,
+    0x986e, 0x988a, 0x986c, 0x988c, 0x9868, 0x9890, 0x9864, 0x9895, 0x9860,
+    0x9899, 0x985d, 0x989a, 0x985e, 0x9896, 0x9863, 0x9891, 0x9869, 0x988a,
+    0x9871, 0x9882, 0x9878, 0x987b, 0x987f, 0x9873, 0x9888, 0x986b, 0x9890,
+    0x9863, 0x9897, 0x985d, 0x989c, 0x985a, 0x989e, 0x9859, 0x989d, 0x985b,
+    0x989a, 0x9860, 0x9893, 0x9868, 0x988c, 0x986d, 0x9886, 0x9878, 0x987f,
+    0x9877, 0x9881, 0x9874, 0x9884, 0x9872, 0x9886, 0x9870, 0x9888, 0x986f,
+    0x9889, 0x986e, 0x988a, 0x986b, 0x988c, 0x9869, 0x9890, 0x9864, 0x9895,
+    0x985f, 0x989a, 0x985b, 0x989d, 0x985a, 0x989c, 0x985d, 0x9896, 0x9864,
+    0x988f, 0x986b, 0x9887, 0x9873, 0x987f, 0x987c, 0x9877, 0x9884, 0x986e,
+    0x988d, 0x9865, 0x9896, 0x985d, 0x989d, 0x9857, 0x98a0, 0x9855, 0x98a1,
+    0x9856, 0x989f, 0x985a, 0x9899, 0x9861, 0x9891, 0x9869, 0x988b, 0x986f,
+    0x987e, 0x9877, 0x9880, 0x9875, 0x9882, 0x9873, 0x9885, 0x9871, 0x9887,
+    0x986f, 0x9888, 0x986e, 0x9889, 0x986c, 0x988b, 0x986a, 0x988e, 0x9867,
+    0x9892, 0x9861, 0x9897, 0x985d, 0x989c, 0x985a, 0x989d, 0x985b, 0x989a,
+    0x9860, 0x9893, 0x9867, 0x988b, 0x9870, 0x9883, 0x9877, 0x987b, 0x9880,
+    0x9872, 0x9889, 0x9869, 0x9892, 0x9860, 0x989a, 0x985a, 0x989f, 0x9856,
+    0x98a1, 0x9855, 0x98a0, 0x9857, 0x989d, 0x985d, 0x9895, 0x9866, 0x988d,
+    0x986c, 0x9888, 0x9878, 0x987f, 0x9877, 0x9881, 0x9874, 0x9884, 0x9872,
+    0x9886, 0x9870, 0x9888, 0x986f, 0x9889, 0x986e, 0x988a, 0x986b, 0x988c,
+    0x9869, 0x9890, 0x9864, 0x9895, 0x985f, 0x989a, 0x985b, 0x989d, 0x985a,
+    0x989c, 0x985d, 0x9896, 0x9864, 0x988f, 0x986b, 0x9887, 0x9873, 0x987f,
+    0x987c, 0x9877, 0x9884, 0x986e, 0x988d, 0x9865, 0x9896, 0x985d, 0x989d,
+    0x9857, 0x98a0, 0x9855, 0x98a1, 0x9856, 0x989f, 0x985a, 0x9899, 0x9861,
+    0x9891, 0x9869, 0x988b, 0x986f, 0x987e, 0x9878, 0x987f, 0x9876, 0x9882,
+    0x9874, 0x9884, 0x9872, 0x9886, 0x9870, 0x9887, 0x986f, 0x9888, 0x986e,
+    0x988a, 0x986c, 0x988c, 0x9868, 0x9890, 0x9864, 0x9895, 0x9860, 0x9899,
+    0x985d, 0x989a, 0x985e, 0x9896, 0x9863, 0x9891, 0x9869, 0x988a, 0x9871,
+    0x9882, 0x9878, 0x987b, 0x987f, 0x9873, 0x9888, 0x986b, 0x9890, 0x9863,
+    0x9897, 0x985d, 0x989c, 0x985a, 0x989e, 0x9859, 0x989d, 0x985b, 0x989a,
+    0x9860, 0x9893, 0x9868, 0x988c, 0x986d, 0x9886, 0xb384, 0xb2da, 0xb212,
+    0xb127, 0xaf94, 0xac3f, 0xa3b4, 0x278c, 0x2b5f, 0x2c14, 0x2739, 0xac9d,
+    0xb213, 0xb2fc, 0xaef3, 0x2cdb, 0x32ec, 0x3392, 0x3124, 0x2c49, 0x2612,
+    0x27f9, 0x2855, 0x2004, 0x9e8b, 0x1c6a, 0x262c, 0x2b6c, 0x2dd9, 0x2e64,
+    0x2c5c, 0x9d76, 0xaee9, 0xb1f2, 0xb076, 0x9d04, 0x2ee0, 0x3302, 0x3558,
+    0x35ee, 0x34b9, 0x313e, 0x26e0, 0xa901, 0xacca, 0xaebe, 0xaa5c, 0x1bc3,
+    0xa0a9, 0x2953, 0x2eeb, 0x2a9e, 0xa7fb, 0xaa5a, 0xb15b, 0xb735, 0xb164,
+    0xb0f9, 0xb086, 0xafb1, 0xad5a, 0xa8e5, 0x1e82, 0x299a, 0x2c62, 0x2d13,
+    0x29ca, 0xabd2, 0xb1e4, 0xb309, 0xafe9, 0x2a1f, 0x31cf, 0x325d, 0x2fce,
+    0x285b, 0x1cf2, 0x27f3, 0x2a59, 0x25f1, 0x9d75, 0xa2f4, 0xa224, 0x1cf1,
+    0x2823, 0x2b19, 0x2a15, 0x9cbd, 0xae86, 0xb24c, 0xb1ec, 0xad6d, 0x1c0b,
+    0x2f06, 0x33ee, 0x3516, 0x3426, 0x30cc, 0x2a9e, 0x209e, 0xa970, 0xaef4,
+    0xac7c, 0xa0a0, 0xa6d4, 0x1fbc, 0x2b27, 0xa601, 0xaf82, 0xaf4f, 0xb2f6,
+    0xb7bc, 0xadeb, 0xad8c, 0xad3d, 0xac2d, 0xa851, 0x1dd2, 0x2a4e, 0x2d9e,
+    0x2f38, 0x2fd2, 0x2d42, 0xa8cd, 0xb1a3, 0xb34c, 0xb0ab, 0x2367, 0x3062,
+    0x304c, 0x282a, 0xac3a, 0xad55, 0xa7aa, 0x244c, 0x2071, 0xa455, 0xa77e,
+    0xa85b, 0xa74d, 0xa02d, 0x2605, 0x2857, 0x1aa0, 0xad95, 0xb272, 0xb35c,
+    0xb141, 0xadff, 0x2450, 0x3221, 0x34fe, 0x347f, 0x3227, 0x2f2f, 0x2cb2,
+    0x99e3, 0xaec3, 0xadea, 0xa869, 0xaad9, 0xa829, 0x1fc5, 0xad36, 0xb231,
+    0xb24f, 0xb4b9, 0xb850, 0xa917, 0xa829, 0xa6a8, 0xa205, 0x23f7, 0x2a95,
+    0x2d94, 0x2fa2, 0x3099, 0x30d7, 0x2ec4, 0xa696, 0xb1ec, 0xb42d, 0xb22c,
+    0xa8a3, 0x2d0a, 0x29e2, 0xae88, 0xb373, 0xb3f8, 0xb155, 0xad1c, 0xaa3d,
+    0xa977, 0xa7c0, 0xa59a, 0xa547, 0xa089, 0x2599, 0x2891, 0x2148, 0xacf8,
+    0xb28b, 0xb435, 0xb333, 0xb171, 0xab00, 0x3113, 0x3565, 0x3592, 0x3499,
+    0x32d8, 0x30f0, 0x28f9, 0xaed1, 0xb027, 0xad52, 0xae7a, 0xade9, 0xac03,
+    0xb0ce, 0xb43a, 0xb482, 0xb621, 0xb8e1, 0x259d, 0x2625, 0x27e6, 0x2abb,
+    0x2da4, 0x302d, 0x3155, 0x3232, 0x32c9, 0x32f9, 0x317a, 0x284a, 0xb086,
+    0xb395, 0xb1b7, 0xa6d8, 0x2c30, 0xa526, 0xb367, 0xb681, 0xb703, 0xb58b,
+    0xb386, 0xb195, 0xb04d, 0xad87, 0xaac5, 0xa93f, 0xa5b5, 0x2438, 0x2884,
+    0x1fd7, 0xad8e, 0xb353, 0xb500, 0xb4b0, 0xb3c9, 0xafdf, 0x2fbe, 0x35b2,
+    0x36bd, 0x366d, 0x3573, 0x3413, 0x2e18, 0xadff, 0xb105, 0xb03f, 0xb10c,
+    0xb117, 0xb057, 0xb2f4, 0xb530, 0xb591, 0xb73d, 0xb958, 0x93f4, 0x939a,
+    0x93f9, 0x93a3, 0x93ec, 0x93af, 0x93df, 0x93bc, 0x93d3, 0x93c4, 0x93cf,
+    0x93c6, 0x93cf, 0x93c4, 0x93d3, 0x93c0, 0x93d7, 0x93bc, 0x93db, 0x93ba,
+    0x93db, 0x93ba, 0x93d9, 0x93c0, 0x93d1, 0x93ca, 0x93c4, 0x93d7, 0x93b5,
+    0x93e6, 0x93a7, 0x93f6, 0x9396, 0x9404, 0x9385, 0x940b, 0x9379, 0x9410,
+    0x9372, 0x9411, 0x9370, 0x9413, 0x936c, 0x9414, 0x936a, 0x9415, 0x936a,
+    0x9414, 0x936e, 0x9412, 0x9372, 0x9410, 0x9377, 0x940e, 0x937b, 0x9406,
+    0x9398, 0x9400, 0x9398, 0x93f6, 0x93a5, 0x93e8, 0x93b5, 0x93d9, 0x93c0,
+    0x93d1, 0x93c6, 0x93cf, 0x93c6, 0x93d1, 0x93c2, 0x93d5, 0x93be, 0x93db,
+    0x93b8, 0x93dd, 0x93b8, 0x93dd, 0x93ba, 0x93d7, 0x93c4, 0x93ca, 0x93d1,
+    0x93bc, 0x93e1, 0x93ab, 0x93f2, 0x939a, 0x9403, 0x9387, 0x940b, 0x9377,
+    0x9412, 0x936c, 0x9415, 0x936a, 0x9416, 0x9366, 0x9419, 0x9362, 0x941b,
+    0x935f, 0x941b, 0x9362, 0x9419, 0x9366, 0x9416, 0x936c, 0x9413, 0x9370,
+    0x9411, 0x937d, 0x93fd, 0x9394, 0x93fd, 0x939e, 0x93f0, 0x93ad, 0x93df,
+    0x93bc, 0x93d5, 0x93c4, 0x93cf, 0x93c6, 0x93cf, 0x93c4, 0x93d3, 0x93c0,
+    0x93d7, 0x93ba, 0x93dd, 0x93b8, 0x93dd, 0x93b8, 0x93db, 0x93be, 0x93d1,
+    0x93ca, 0x93c4, 0x93d9, 0x93b3, 0x93ea, 0x93a3, 0x93fb, 0x9390, 0x9407,
+    0x937f, 0x940f, 0x9370, 0x9414, 0x936a, 0x9416, 0x9368, 0x9418, 0x9364,
+    0x941a, 0x935f, 0x941b, 0x935f, 0x941a, 0x9364, 0x9418, 0x9368, 0x9415,
+    0x936e, 0x9412, 0x9372, 0x940d, 0x9398, 0x9400, 0x9398, 0x93f6, 0x93a5,
+    0x93e8, 0x93b5, 0x93d9, 0x93c0, 0x93d1, 0x93c6, 0x93cf, 0x93c6, 0x93d1,
+    0x93c2, 0x93d5, 0x93be, 0x93db, 0x93b8, 0x93dd, 0x93b8, 0x93dd, 0x93ba,
+    0x93d7, 0x93c4, 0x93ca, 0x93d1, 0x93bc, 0x93e1, 0x93ab, 0x93f2, 0x939a,
+    0x9403, 0x9387, 0x940b, 0x9377, 0x9412, 0x936c, 0x9415, 0x936a, 0x9416,
+    0x9366, 0x9419, 0x9362, 0x941b, 0x935f, 0x941b, 0x9362, 0x9419, 0x9366,
+    0x9416, 0x936c, 0x9413, 0x9370, 0x9411, 0x937d, 0x93f4, 0x939a, 0x93f9,
+    0x93a3, 0x93ec, 0x93af, 0x93df, 0x93bc, 0x93d3, 0x93c4, 0x93cf, 0x93c6,
+    0x93cf, 0x93c4, 0x93d3, 0x93c0, 0x93d7, 0x93bc, 0x93db, 0x93ba, 0x93db,
+    0x93ba, 0x93d9, 0x93c0, 0x93d1, 0x93ca, 0x93c4, 0x93d7, 0x93b5, 0x93e6,
+    0x93a7, 0x93f6, 0x9396, 0x9404, 0x9385, 0x940b, 0x9379, 0x9410, 0x9372,
+    0x9411, 0x9370, 0x9413, 0x936c, 0x9414, 0x936a, 0x9415, 0x936a, 0x9414,
+    0x936e, 0x9412, 0x9372, 0x9410, 0x9377, 0x940e, 0x937b, 0x9406, 0xa8e5,
+    0xaec5, 0xb19f, 0xb305, 0xb356, 0xb261, 0xb119, 0xafb7, 0xabb6, 0xa59d,
+    0x24b1, 0x2978, 0x98c8, 0xab2f, 0xaaf0, 0xa5a3, 0xa040, 0xa843, 0xab9f,
+    0xabfb, 0xad39, 0xaf41, 0xafc2, 0xafdc, 0xb08e, 0xb132, 0xb0ed, 0xae1d,
+    0xaafc, 0xae5f, 0xb197, 0xb333, 0xb4c9, 0xb3c6, 0xb218, 0xb2e1, 0xb488,
+    0xb585, 0xb5de, 0xb61f, 0xb48e, 0xb41d, 0xb118, 0xb097, 0xb01b, 0xad95,
+    0x237b, 0xa2ca, 0xa6df, 0x2854, 0x1b38, 0x2cf9, 0x2dbf, 0x2864, 0x2b77,
+    0xac04, 0x3174, 0x2f28, 0x2be0, 0x286f, 0x282c, 0x2b0b, 0x2c47, 0x2b1e,
+    0x2b81, 0x2a9e, 0x2abf, 0x2c62, 0x2955, 0x8d5c, 0x1aaf, 0x2888, 0x2a0b,
+    0x2a30, 0x2c40, 0x2d2d, 0x2bbc, 0x28be, 0x2966, 0x2b30, 0x2b62, 0x2b90,
+    0x2ce4, 0x2f88, 0x3074, 0x2f33, 0x2d15, 0x2dd1, 0x2b95, 0x2fe7, 0x31cb,
+    0x3207, 0x31ba, 0x31e8, 0x31ab, 0x2fe2, 0x3131, 0x2ef7, 0x2f1c, 0x2a44,
+    0x1cb6, 0x9e2e, 0x2619, 0xa891, 0xab06, 0x2192, 0xa1b4, 0x2b46, 0x2ab5,
+    0x27dc, 0x2e77, 0x26ce, 0x320a, 0x30f7, 0x300d, 0x2e46, 0x2d9a, 0x2ded,
+    0x2d31, 0x2a66, 0x27eb, 0x14b1, 0xa40f, 0x9a4f, 0xa41e, 0xaa8c, 0xaa57,
+    0xa49e, 0x9cf5, 0x943c, 0x21fe, 0x223d, 0xa086, 0xa134, 0x1e91, 0x249f,
+    0x2580, 0x2702, 0x2ad4, 0x2f24, 0x316d, 0x3203, 0x3202, 0x3332, 0x32f6,
+    0x3483, 0x3540, 0x3554, 0x35b0, 0x36d0, 0x3704, 0x3581, 0x357a, 0x3429,
+    0x332d, 0x30dc, 0x2e13, 0x2b31, 0x2923, 0x1be7, 0xa65f, 0x9ed0, 0xa990,
+    0x25da, 0x2504, 0x9f65, 0x2de3, 0x2c2d, 0x3204, 0x3178, 0x3147, 0x307e,
+    0x2f22, 0x2e6a, 0x2cc7, 0x29b1, 0x29ae, 0x253b, 0x9205, 0x2131, 0x20d7,
+    0xa566, 0xa580, 0x9c05, 0xa4ef, 0xa943, 0xa8ed, 0xa73e, 0xa5f4, 0x9c56,
+    0x1840, 0xa221, 0xa54c, 0xa6b5, 0xa4b3, 0x2583, 0x2c82, 0x2cda, 0x295a,
+    0x29f5, 0x2874, 0x2e2c, 0x302e, 0x2fa7, 0x2f84, 0x31a8, 0x32f7, 0x30b9,
+    0x30e0, 0x2da0, 0x2de7, 0x2d12, 0x2cb2, 0x2d1e, 0x2d6b, 0x2da5, 0x2b4a,
+    0x2264, 0xac44, 0xa106, 0xa748, 0xad95, 0x2114, 0x9572, 0xb3ed, 0xb3ad,
+    0xb2d0, 0xb271, 0xb2e4, 0xb308, 0xb30f, 0xb1e7, 0xad91, 0xa7ae, 0xa430,
+    0x21fe, 0x28c5, 0x27d6, 0x2a96, 0x2cac, 0x275a, 0xa7ca, 0xa855, 0x1bf0,
+    0x29ea, 0x2e21, 0x2f5b, 0x2e51, 0x2c63, 0x25f7, 0xa5ca, 0xaa76, 0xad44,
+    0xb101, 0xb442, 0xb4f6, 0xb547, 0xb493, 0xb4a4, 0xb59d, 0xb69c, 0xb6c1,
+    0xb641, 0xb677, 0xb57e, 0xb56b, 0xb2ae, 0xafb2, 0xac23, 0x1b64, 0x2b25,
+    0x2f51, 0x2f3f, 0x2981, 0xa9cd, 0x21f2, 0xac27, 0xb257, 0xaf5a, 0xb114,
+    0xa866, 0x27db, 0x2e11, 0x3058, 0x30e9, 0x3106, 0x305d, 0x2fde, 0x2c4b,
+    0xa960, 0xae25, 0xac3e, 0xa770, 0xa92f, 0xad52, 0xaede, 0xad50, 0xaaec,
+    0xac25, 0xadbe, 0xae10, 0xacc0, 0xa6e6, 0x2886, 0x2d8b, 0x2fee, 0x3053,
+    0x2ecb, 0x2998, 0xa802, 0xaefd, 0xb222, 0xb361, 0xb200, 0xae9f, 0x935d,
+    0x298c, 0x1ea7, 0x2a91, 0x2fb2, 0x304d, 0x2fd6, 0x300f, 0x3250, 0x3501,
+    0x3490, 0x3092, 0x2c3e, 0x2e7f, 0xabf4, 0xb410, 0xb4a2, 0xb4d7, 0xb41a,
+    0xacd0, 0x3220, 0xac90, 0x2002, 0x2dbb, 0x3065, 0x3106, 0x30a8, 0x2f70,
+    0x2e63, 0x2a00, 0xaa2a, 0xadad, 0xaa1b, 0x9469, 0x9a33, 0xa66d, 0xa4e4,
+    0x25cb, 0x292c, 0x95fa, 0xaad7, 0xac94, 0xaaa6, 0x9ced, 0x2bca, 0x2f85,
+    0x30a6, 0x303b, 0x2e0e, 0x2bce, 0x283b, 0xa0ab, 0xadb7, 0xb04d, 0xad77,
+    0x21dd, 0x2f4c, 0x30f2, 0x2ece, 0x2fdf, 0x315d, 0x30ad, 0x2d93, 0x26db,
+    0x281f, 0x2d5f, 0x290a, 0xacbb, 0xaf8d, 0xaacc, 0xb190, 0xb53b, 0xb458,
+    0xb2a4, 0xb281, 0xaf00, 0x2f3d, 0xaf7d, 0xa8b7, 0x2ae9, 0x3019, 0x3175,
+    0x314a, 0x304a, 0x2f0d, 0x2b84, 0xa5fb, 0xab83, 0xa413, 0x2805, 0x275b,
+    0x2126, 0x27af, 0x2dea, 0x2fa9, 0x2c15, 0xa528, 0xac51, 0xab6f, 0xa422,
+    0x29c8, 0x2e80, 0x2fff, 0x2e52, 0x2a8f, 0x2692, 0x254f, 0x1e87, 0xab82,
+    0xae00, 0xa6ee, 0x2d61, 0x31ec, 0x333a, 0x3183, 0x3152, 0x325b, 0x3191,
+    0x2e3d, 0xa143, 0xab18, 0xab85, 0xb088, 0xb3fa, 0xb465, 0xb1ba, 0xb381,
+    0xb561, 0xb2ed, 0xae41, 0xaffa, 0xafcf, 0x2976, 0xb297, 0xb026, 0xa98e,
+    0x2a0e, 0x2f75, 0x3058, 0x2f78, 0x2de8, 0x2a4d, 0x9eef, 0xa698, 0x24e9,
+    0x2c24, 0x2b04, 0x2388, 0x2583, 0x2e0d, 0x308b, 0x2e35, 0x1fde, 0xa955,
+    0xa490, 0x28fd, 0x2e81, 0x3085, 0x302b, 0x2c0e, 0xa2f1, 0xa947, 0xa6b8,
+    0x9dca, 0xa766, 0xa93a, 0x28d8, 0x30c3, 0x3348, 0x3421, 0x32c3, 0x3213,
+    0x32e6, 0x331a, 0x31e3, 0x2eb6, 0x2bad, 0x268c, 0xaf04, 0xb42c, 0xb4cd,
+    0xb220, 0xb25d, 0xb414, 0xaead, 0x288e, 0xa65c, 0xacd5, 0x2c62, 0xb5fa,
+    0xb457, 0xb176, 0xac68, 0x2314, 0x29f3, 0x2a3f, 0x28e8, 0x14c8, 0xaae3,
+    0xad0f, 0xa92d, 0x211a, 0x21b8, 0xa7e0, 0xa724, 0x2a96, 0x2f1c, 0x2c42,
+    0xa844, 0xacb6, 0x9e61, 0x2e1b, 0x3166, 0x315d, 0x2d0d, 0xac55, 0xb256,
+    0xb3d7, 0xb2aa, 0xb00f, 0xaccc, 0xa8a1, 0x2ce9, 0x32f3, 0x34e8, 0x3563,
+    0x34c9, 0x3436, 0x346f, 0x34f2, 0x352f, 0x3494, 0x339b, 0x30c1, 0xabff,
+    0xb4ba, 0xb63a, 0xb4a9, 0xb466, 0xb4c4, 0xb044, 0x210e, 0xaa35, 0xac89,
+    0x2eeb, 0x35dd, 0x34ec, 0x32d2, 0x2d93, 0xa933, 0xb128, 0xb40a, 0xb4da,
+    0xb4f3, 0xb48e, 0xb3b8, 0xb184, 0xadd5, 0x1c3b, 0x2e60, 0x3114, 0x31c2,
+    0x3163, 0x2d33, 0xac9a, 0xb247, 0xb22b, 0xaacc, 0x3064, 0x342b, 0x341c,
+    0x3109, 0x255b, 0xae5f, 0xb08f, 0xaf76, 0xabe9, 0x9b69, 0x29dd, 0x2b20,
+    0x2860, 0x1e87, 0x9f92, 0x9a49, 0x9a12, 0xabed, 0xafcb, 0xac64, 0x2809,
+    0x2987, 0xa374, 0x9ed3, 0x2a73, 0x28c8, 0xa4aa, 0xa3e1, 0xa22d, 0xa86a,
+    0x15ac, 0x2997, 0x2d0d, 0x3513, 0x3448, 0x31f4, 0x2cf1, 0xa911, 0xb0e7,
+    0xb3a2, 0xb47c, 0xb468, 0xb3f3, 0xb2fd, 0xb172, 0xae31, 0x1fda, 0x2f50,
+    0x314b, 0x30fc, 0x2f7a, 0x28f4, 0xac7b, 0xb07f, 0xae9a, 0x286a, 0x321d,
+    0x3442, 0x3305, 0x2df4, 0xaa6c, 0xb132, 0xb21b, 0xb0d7, 0xad3a, 0x9e47,
+    0x2b9a, 0x2cd6, 0x2b24, 0x289d, 0x27db, 0x2592, 0x1772, 0xabe8, 0xb012,
+    0xaee1, 0xa920, 0xa7bb, 0xacd4, 0xaca0, 0xa61e, 0xa5fd, 0xaabf, 0xa935,
+    0xa69a, 0xa5b9, 0x25aa, 0x2b37, 0x2cf3, 0x3427, 0x3315, 0x3115, 0x2c7a,
+    0xa892, 0xb085, 0xb307, 0xb40a, 0xb3cc, 0xb351, 0xb33c, 0xb282, 0xb03d,
+    0x9dc5, 0x2fbd, 0x312f, 0x2f50, 0x2918, 0xa892, 0xae0d, 0xadeb, 0x1b1c,
+    0x30f4, 0x3486, 0x34f5, 0x330b, 0x2c5e, 0xad73, 0xb245, 0xb2ba, 0xb0f8,
+    0xacb4, 0x23e9, 0x2e21, 0x2fe2, 0x2f8c, 0x2f6d, 0x2fc5, 0x2e40, 0x2a66,
+    0xa690, 0xae2f, 0xaf2f, 0xacc8, 0xac48, 0xae61, 0xadea, 0xa9b3, 0xa70d,
+    0xa8fb, 0xa920, 0xa80c, 0x21ab, 0x2cbf, 0x2e80, 0x2e99, 0x3216, 0x30f2,
+    0x2e99, 0x2838, 0xab2f, 0xb0d8, 0xb348, 0xb420, 0xb3f9, 0xb3d2, 0xb431,
+    0xb3f0, 0xb11b, 0x9240, 0x30a9, 0x31a9, 0x2e3b, 0xa021, 0xae08, 0xafea,
+    0xab00, 0x2eaa, 0x3462, 0x35ed, 0x3577, 0x3273, 0x26cd, 0xafb2, 0xb2ae,
+    0xb298, 0xb09f, 0xac18, 0x2670, 0x2f3e, 0x30f5, 0x316b, 0x31d4, 0x3201,
+    0x3066, 0x2a8e, 0xa8b1, 0xaed4, 0xb0bc, 0xb016, 0xaed8, 0xaf96, 0xad8e,
+    0xa4cf, 0x25bb, 0x2463, 0xa4a8, 0xa86f, 0x28bb, 0x3064, 0x31a8, 0x3127,
+    0x346c, 0x32b8, 0x3064, 0x2afa, 0xa94d, 0xb074, 0xb31d, 0xb41b, 0xb3c5,
+    0xb37c, 0xb406, 0xb331, 0xae49, 0x2e72, 0x344a, 0x34d0, 0x32b9, 0x2dca,
+    0x9ffb, 0xa849, 0x2bfd, 0x33f6, 0x36aa, 0x377c, 0x35d8, 0x30bc, 0xacf2,
+    0xb380, 0xb4d4, 0xb46f, 0xb288, 0xb009, 0xa9f9, 0x2968, 0x2e46, 0x3020,
+    0x3102, 0x314d, 0x2d85, 0xa8ee, 0xb09d, 0xb2e3, 0xb45a, 0xb42a, 0xb30c,
+    0xb239, 0xaf5e, 0x9fe4, 0x2c3b, 0x2c62, 0x185a, 0xaa6c, 0x2690, 0x3145,
+    0x3364, 0x327f, 0xad8e, 0xacd8, 0xab56, 0xa956, 0xa1bd, 0x21cd, 0x13ee,
+    0xa844, 0xac74, 0xad05, 0xa480, 0x2d31, 0x2f92, 0x2c05, 0xa4c9, 0xaa2f,
+    0xa80a, 0x92fd, 0x2259, 0x2398, 0x152d, 0xa77d, 0xa944, 0xa82d, 0xa8fa,
+    0xab5f, 0xab1f, 0xa9bb, 0xac46, 0xabfb, 0xa427, 0x2557, 0x28cb, 0x2647,
+    0xac0c, 0xb179, 0xb36c, 0xb526, 0xb80d, 0xb918, 0xb8fb, 0xb8f1, 0xb815,
+    0xb520, 0xaeb4, 0x2feb, 0x3525, 0x35fa, 0x341e, 0x3445, 0x3427, 0x310f,
+    0x2d47, 0x2f3f, 0x2d6e, 0xacaf, 0xb0ba, 0xb0b2, 0xb07b, 0xb035, 0xae9d,
+    0xac82, 0xac2a, 0xadc9, 0xb000, 0xb02c, 0xacce, 0x1fcb, 0x2817, 0xa5d5,
+    0xae0e, 0xaf1e, 0xacf0, 0xa6fd, 0x9244, 0x1f73, 0x9cc8, 0xa913, 0xac09,
+    0xac28, 0xac5b, 0xacf2, 0xac6b, 0xab24, 0xad3e, 0xad9c, 0xa976, 0x9d29,
+    0x20b4, 0x0c92, 0xac12, 0xb057, 0xb186, 0xb31f, 0xb536, 0xb5fa, 0xb4ac,
+    0xb41c, 0xb1a5, 0xa9e9, 0x2d59, 0x32eb, 0x34f5, 0x3514, 0x3298, 0x3292,
+    0x3268, 0x3039, 0x2b12, 0x2d12, 0x2cf4, 0xac0e, 0xa8be, 0xac0e, 0xad43,
+    0xad9c, 0xabf6, 0xa4f6, 0x20c8, 0x1c74, 0xa39c, 0xa01b, 0x2984, 0x2efe,
+    0x2fd2, 0x2b6d, 0xa480, 0xa6aa, 0x26bd, 0x2dc4, 0x2f32, 0x2e87, 0x2d45,
+    0x2ada, 0x270f, 0x2382, 0x2217, 0x2154, 0x243d, 0x25a4, 0x9cbf, 0xa441,
+    0x2532, 0x2afd, 0x2c06, 0x2aea, 0x2056, 0xa944, 0xabf7, 0xac56, 0xadec,
+    0xacac, 0x2b0b, 0x2e94, 0x302d, 0x3216, 0x337c, 0x3448, 0x3413, 0x3360,
+    0x300c, 0x2db6, 0x2d0a, 0x2b17, 0xa363, 0x9cc9, 0x23eb, 0xaeef, 0xa49d,
+    0xaaeb, 0xad22, 0xada4, 0xabed, 0xa0e8, 0x28f4, 0x2b1b, 0x2b9d, 0x2d19,
+    0x2fc5, 0x314c, 0x3133, 0x2cdf, 0xa574, 0xa89b, 0x2778, 0x2eb7, 0x2fac,
+    0x2dc8, 0x2c51, 0x2b72, 0x2ab9, 0x2aea, 0x2c5d, 0x2d00, 0x2ccf, 0x2b7c,
+    0x26fe, 0x27d5, 0x2cc0, 0x2edd, 0x2eac, 0x2d63, 0x29f4, 0x248b, 0x265e,
+    0x2cba, 0x300b, 0x32c1, 0x35be, 0x363d, 0x359f, 0x3567, 0x34ec, 0x342e,
+    0x31d1, 0x303e, 0x2815, 0xa89c, 0xab75, 0xaa71, 0xaf57, 0xaf5d, 0xadd6,
+    0xb265, 0xaf09, 0xb132, 0xb25d, 0xb2a3, 0xb1cf, 0xafb5, 0xabda, 0xa6b6,
+    0x0e5b, 0x2902, 0x2d43, 0x2f56, 0x2e18, 0xa669, 0xb10f, 0xb1b6, 0xad49,
+    0x2725, 0x29e6, 0x9cfc, 0xa89c, 0xa62f, 0x147e, 0x278c, 0x2b85, 0x2c51,
+    0x29d1, 0x9d06, 0xac00, 0xac1d, 0xa7e8, 0xa26e, 0xa7ed, 0xabd2, 0xae95,
+    0xb026, 0xae36, 0x205b, 0x300d, 0x341a, 0x36a0, 0x36ea, 0x35ba, 0x3494,
+    0x321f, 0x2e81, 0x2561, 0xa3ca, 0xaec1, 0xb235, 0xb31f, 0xb223, 0xb3fd,
+    0xb3e7, 0xb34f, 0xb525, 0xace9, 0xb14c, 0xb302, 0xb18d, 0xaacd, 0x2c3f,
+    0x302a, 0x2f8e, 0x2696, 0xae2a, 0xb161, 0xb12d, 0xaffb, 0xaee0, 0xad30,
+    0x279a, 0x3264, 0x34ed, 0x34ca, 0x3404, 0x33be, 0x33db, 0x3107, 0xaa96,
+    0xb418, 0xb542, 0xb454, 0xb18e, 0xaef9, 0xac5b, 0xa504, 0x26ae, 0x283d,
+    0xa60f, 0xae11, 0xae35, 0xaaf5, 0xaabd, 0xadec, 0xaf92, 0xab60, 0x9c44,
+    0x1e98, 0x2370, 0x2a0c, 0x2e0d, 0x2f84, 0x28b4, 0xa9aa, 0xa9f0, 0xabe2,
+    0xacd8, 0xa923, 0xa4dc, 0xa50a, 0x1da0, 0xa262, 0xaeef, 0xb181, 0xb04f,
+    0xa4f5, 0x2e8a, 0x3128, 0x301f, 0x250a, 0xaefd, 0xb1d5, 0xb109, 0xad7b,
+    0xa989, 0xa4c4, 0x2c5f, 0x32a4, 0x34a2, 0x341e, 0x318d, 0x2ef8, 0x2ab5,
+    0xab5e, 0xb33a, 0xb58e, 0xb553, 0xb2ba, 0xacb9, 0x21d1, 0x2b4e, 0x2d33,
+    0x2d85, 0x2cd0, 0x25c3, 0xa935, 0xa90a, 0x2330, 0x2760, 0x1ced, 0xa024,
+    0x264a, 0x277c, 0x1da0, 0x1b83, 0x2569, 0x299f, 0x2c29, 0x2095, 0xaa4a,
+    0xa4c7, 0xa415, 0xa910, 0xa84e, 0xa79c, 0xa687, 0x9f1b, 0x22c5, 0xadb8,
+    0xb0fb, 0xaf8d, 0x1d56, 0x304c, 0x31e9, 0x2faa, 0xa200, 0xb0d8, 0xb36a,
+    0xb1f4, 0xabe8, 0x277a, 0x2bd9, 0x2fa1, 0x32e5, 0x340b, 0x31ee, 0x2cb2,
+    0xa77b, 0xb060, 0xb45e, 0xb67d, 0xb70c, 0xb545, 0xb037, 0x29b8, 0x3042,
+    0x30b5, 0x2f73, 0x2ce7, 0x2ab0, 0x2042, 0xa8c5, 0xa405, 0x2b85, 0x2dd7,
+    0x2d85, 0x2e10, 0x2e66, 0x2a23, 0xa653, 0xa8df, 0xa7a4, 0xa72b, 0x1a50,
+    0xa2ad, 0xa942, 0x24e2, 0x28aa, 0x183e, 0xa169, 0xa4ce, 0xa7aa, 0xa796,
+    0x24d4, 0xae21, 0xb13f, 0xaf51, 0x2833, 0x3217, 0x33a3, 0x307a, 0xa4b5,
+    0xb17c, 0xb427, 0xb234, 0xa2bf, 0x3064, 0x326e, 0x340d, 0x34e1, 0x3458,
+    0x3081, 0xa214, 0xb0ce, 0xb4e4, 0xb7b0, 0xb8cb, 0xb877, 0xb569, 0xa9a6,
+    0x31d9, 0x3455, 0x33cf, 0x30ba, 0x2a7d, 0x9d35, 0xaab8, 0xac72, 0x9ead,
+    0x2e66, 0x3123, 0x31d5, 0x328a, 0x31a7, 0x2c11, 0xac89, 0xaede, 0xaeb0,
+    0xaf5d, 0xac49, 0xa9a1, 0xa714, 0x2c22, 0x2ddb, 0x2afd, 0x2969, 0x27ac,
+    0xa030, 0xa84d, 0x26f2, 0xaede, 0xb1fd, 0xb041, 0x2865, 0x3371, 0x349f,
+    0x318c, 0x9e4e, 0xb1d6, 0xb497, 0xb269, 0x2a5b, 0x3486, 0x3682, 0x37a9,
+    0x37f5, 0x362d, 0x3165, 0xaa77, 0xb3d9, 0xb776, 0xb987, 0xba7a, 0xb9b4,
+    0xb667, 0x9e39, 0x34a0, 0x3655, 0x355c, 0x3191, 0x24a3, 0xacaf, 0xaff1,
+    0xae71, 0x232e, 0x30f8, 0x33dd, 0x349e, 0x34ea, 0x33db, 0x2cd2, 0xafd0,
+    0xb21e, 0xb26d, 0xb2c8, 0xb055, 0xaccc, 0xa650, 0x2d8b, 0x2f8d, 0x2d98,
+    0x2d9a, 0x2d74, 0x2603, 0xa617, 0x2b83, 0x2dbe, 0x2ef3, 0x2e40, 0x2cfd,
+    0x2b6e, 0x2986, 0x2b1e, 0x25e1, 0xa924, 0xac93, 0xa73b, 0x29fd, 0x2ba2,
+    0xa532, 0xaff9, 0xb0f8, 0xad38, 0x1808, 0xa0e7, 0xadaa, 0xb056, 0xaf27,
+    0xac67, 0xab4a, 0xad36, 0xadea, 0xac26, 0xa710, 0x29fe, 0x3071, 0x30cb,
+    0x2d38, 0x1192, 0xa919, 0xab29, 0xae01, 0xb122, 0xb2cc, 0xb33f, 0xb13c,
+    0x156e, 0x3054, 0x3183, 0x3212, 0x3351, 0x3401, 0x31a9, 0x3195, 0x32a8,
+    0x32cf, 0x31ee, 0x32ce, 0x2f55, 0x28e2, 0x31c5, 0xa815, 0x9164, 0x251d,
+    0x2611, 0x24ba, 0x255f, 0x26af, 0x29c2, 0x275f, 0xa407, 0xaa19, 0xa2d6,
+    0x2be1, 0x2d85, 0x278a, 0xaa5b, 0xabff, 0x239e, 0x2e2b, 0x2d94, 0x239f,
+    0xa6d6, 0xa282, 0x1b78, 0xa53b, 0xab7e, 0xac4c, 0xaa3b, 0xa8c6, 0x14b9,
+    0x2c0a, 0x2c96, 0x2612, 0xa726, 0xa90b, 0xa847, 0xaaec, 0xaf0e, 0xb180,
+    0xb39d, 0xb3cf, 0xb05f, 0xab2f, 0xac64, 0xad39, 0xaa0d, 0x24f8, 0x2102,
+    0x290d, 0x2d63, 0x2cd3, 0x247a, 0x2417, 0xac2c, 0xaf9c, 0x8f53, 0xac0f,
+    0xa6f5, 0x239b, 0x297a, 0x2c9e, 0x2dc4, 0x2de3, 0x2d36, 0x2b2e, 0x285f,
+    0x2215, 0x26f1, 0x2d0d, 0x2e1b, 0x29d7, 0xa604, 0xa716, 0x2ae0, 0x3060,
+    0x307d, 0x2d3d, 0x2913, 0x2a7e, 0x2abf, 0x9d4e, 0xabff, 0xac59, 0xaa30,
+    0xa94c, 0xa2ad, 0x28ad, 0x2a61, 0x25ff, 0x9d42, 0x1e78, 0x280a, 0x21a2,
+    0xab39, 0xb03e, 0xb369, 0xb49b, 0xb328, 0xb10a, 0xb1bb, 0xb2d5, 0xb1fa,
+    0xadad, 0xab3f, 0xa6ca, 0xa01c, 0xa973, 0xae48, 0xad8c, 0xb135, 0xb27d,
+    0xadca, 0xb0aa, 0xb005, 0xac0e, 0x20bb, 0x2c93, 0x2e0f, 0x2cfa, 0x2931,
+    0x2417, 0x2637, 0x24f9, 0x2847, 0x2ca8, 0x2c20, 0x995d, 0xad39, 0xaeda,
+    0xa946, 0x29af, 0x2c31, 0x266a, 0xa23d, 0x2064, 0x249a, 0xaa23, 0xaf12,
+    0xae91, 0xac41, 0xa9c7, 0xa11d, 0x27cd, 0x29a4, 0x28cb, 0x2763, 0x2a63,
+    0x2d40, 0x2b18, 0xa704, 0xaf5c, 0xb3bd, 0xb574, 0xb4e7, 0xb355, 0xb31e,
+    0xb3d5, 0xb223, 0xa897, 0x2237, 0x1867, 0xa4ba, 0xada1, 0xaf3e, 0xa884,
+    0xac91, 0xae18, 0x264e, 0x9cb0, 0xb042, 0xb1e2, 0xb106, 0xaf54, 0xaf1e,
+    0xb0de, 0xb212, 0xb210, 0xb093, 0xae97, 0xa95c, 0x28d5, 0x2a3b, 0xa89f,
+    0xb112, 0xb33a, 0xb179, 0xaba4, 0x99e9, 0xa4d7, 0xa997, 0xa204, 0x22a4,
+    0xa692, 0xab16, 0xa570, 0x25fd, 0x2a00, 0x2a74, 0x29aa, 0x28b1, 0x2873,
+    0x2772, 0x29a8, 0x2dcb, 0x2e21, 0x29d0, 0xa5b8, 0xb198, 0xb4f9, 0xb49c,
+    0xb19d, 0xae4e, 0xa9b9, 0x2e1f, 0x3557, 0x369b, 0x35d0, 0x351f, 0x33a6,
+    0x3341, 0x35cd, 0x3575, 0x34b6, 0x3665, 0xb145, 0xacfb, 0xa427, 0xa272,
+    0xa357, 0x2488, 0x2c85, 0x2d5e, 0x2a98, 0x1bef, 0xa0c6, 0x2997, 0x2fb0,
+    0x30c2, 0x2ffb, 0x2d9f, 0x2b51, 0x2651, 0xa22b, 0xa638, 0xa00a, 0x9434,
+    0xa4b0, 0xa80e, 0xa909, 0xab47, 0xadbc, 0xae29, 0xac5d, 0xab9e, 0xa8bc,
+    0x1922, 0x15fd, 0x1964, 0x29bf, 0x2f8e, 0x31e3, 0x3390, 0x34b5, 0x3424,
+    0x3193, 0x267e, 0xb172, 0xb519, 0xb683, 0xb7b4, 0xb800, 0xb464, 0xa766,
+    0x304e, 0x35ae, 0x3588, 0x3015, 0x2c0f, 0x26d9, 0xb11f, 0xb039, 0xabab,
+    0xa410, 0xa69f, 0xa8d8, 0xa57a, 0x253f, 0x27bd, 0x9e51, 0xac13, 0xadb3,
+    0xa94b, 0x2946, 0x2dc0, 0x2dcc, 0x2c4e, 0x28c1, 0x9964, 0xa94a, 0xa8de,
+    0x9857, 0x202a, 0xa4e3, 0xaa5b, 0xac8b, 0xadeb, 0xaf8b, 0xaf76, 0xadb5,
+    0xad42, 0xab2c, 0xa069, 0x01a3, 0x1acf, 0x270d, 0x2c46, 0x2e08, 0x2f25,
+    0x30d6, 0x2f45, 0x2969, 0xaaf7, 0xb176, 0xb3c9, 0xb444, 0xb448, 0xb3b9,
+    0xa992, 0x3022, 0x31ff, 0x348f, 0x3313, 0x2318, 0xa932, 0xab62, 0xb2ed,
+    0xaaf6, 0x9d38, 0x24d4, 0x1814, 0xa34c, 0x9e61, 0x2650, 0x27d7, 0xa1a1,
+    0xad7c, 0xb045, 0xae0a, 0x9dc4, 0x2b77, 0x2cff, 0x2c0e, 0x25ff, 0xa899,
+    0xaccc, 0xa8e8, 0x2961, 0x2cff, 0x2a00, 0xa10e, 0xaaea, 0xace4, 0xad59,
+    0xac59, 0xa959, 0xa8c3, 0xa4af, 0x2548, 0x272a, 0x2553, 0x245d, 0x2595,
+    0x22dc, 0x99a0, 0x2190, 0xa6b5, 0xad2b, 0xb036, 0xb190, 0xb149, 0xae78,
+    0x15d0, 0x2eb4, 0x3422, 0x3506, 0x33b4, 0x327d, 0x2c32, 0xb00c, 0xb0f3,
+    0xb117, 0xb4d0, 0xa72a, 0x2342, 0x267e, 0x207e, 0x1ab5, 0x2553, 0x2b39,
+    0x2c6f, 0x2601, 0xac9a, 0xb0ec, 0xb0b6, 0xacc0, 0x96a8, 0x2953, 0x2913,
+    0xa253, 0xae9f, 0xb106, 0xae6b, 0x2532, 0x2dce, 0x2c98, 0x20bf, 0xa8c2,
+    0xaa3a, 0xa84c, 0x0410, 0x26e5, 0x266a, 0x265f, 0x28cf, 0x2747, 0x1d14,
+    0xa4c2, 0xa621, 0xa8a2, 0xac03, 0xac90, 0xaf65, 0xb0fc, 0xb1c5, 0xb1fd,
+    0xb055, 0x9c4b, 0x3289, 0x3672, 0x382d, 0x3776, 0x344e, 0x2f5c, 0xac29,
+    0xb2ee, 0xb294, 0xb2ab, 0xb591, 0x1be3, 0x296b, 0x297f, 0x2544, 0x24ef,
+    0x2994, 0x2d21, 0x2e54, 0x2b5b, 0xa9f1, 0xb0ad, 0xb12f, 0xaea6, 0xa6f8,
+    0x2837, 0x298e, 0x9d45, 0xae52, 0xb0d6, 0xacbe, 0x2d47, 0x31f8, 0x31b0,
+    0x2ea7, 0x2a1e, 0x280a, 0x28f8, 0x2bbb, 0x2c86, 0x2aca, 0x270e, 0x21a7,
+    0xa030, 0xa625, 0xa8b6, 0xa6e6, 0xa5a9, 0xaac0, 0xadb3, 0xb0b0, 0xb1a7,
+    0xb1fe, 0xb1c0, 0xaebb, 0x2c07, 0x3555, 0x38c8, 0x39a7, 0x38a5, 0x34a8,
+    0x2995, 0xb105, 0xb41d, 0xb1c3, 0xb1d0, 0xb564, 0x3462, 0x303e, 0xa3e1,
+    0xaee3, 0xb0a5, 0xb0b2, 0xaf7e, 0xa9f2, 0x23b2, 0x23dd, 0x157d, 0x295a,
+    0x2d76, 0x2e50, 0x3015, 0x30b0, 0x2f72, 0x2cda, 0x2add, 0x281a, 0x223a,
+    0x265e, 0x29b0, 0x2781, 0x200e, 0x20b6, 0x2047, 0xa46e, 0xaa6c, 0xae8e,
+    0xb0d8, 0xb1a7, 0xb40c, 0xb5ae, 0xb6f9, 0xb7a7, 0xb6f7, 0xb52c, 0xaf10,
+    0x2973, 0x307c, 0x332d, 0x3689, 0x36c8, 0x35d5, 0x344b, 0x31ac, 0x2e77,
+    0xa825, 0xb130, 0xb459, 0xb639, 0xb6ab, 0xb5e6, 0xb528, 0xb284, 0x304e,
+    0x26b5, 0xac9b, 0xafbf, 0xaf96, 0xad89, 0xac38, 0xa9e8, 0xa29b, 0x92a9,
+    0x1225, 0x2878, 0x2aa2, 0x27c9, 0x26c5, 0x27a2, 0x2405, 0x1fc1, 0x265b,
+    0x28a2, 0x2830, 0x29e0, 0x2ad1, 0x2820, 0x2595, 0x267c, 0x2359, 0x9b04,
+    0x1f7f, 0x9bcc, 0xa70d, 0xa96a, 0xaf09, 0xb1d4, 0xb244, 0xb130, 0xad4f,
+    0x237f, 0x3163, 0x33b4, 0x3440, 0x3456, 0x35e7, 0x358e, 0x3405, 0x30a1,
+    0x293e, 0xa9ba, 0xaeab, 0xb0cd, 0xb17d, 0xb176, 0xb0fe, 0xb159, 0xb05d,
+    0x2ad6, 0x2811, 0xac37, 0xb088, 0xb10d, 0xaffd, 0xac4b, 0xab09, 0xad0d,
+    0xac74, 0xa8f3, 0xa26b, 0x25a7, 0x26ac, 0xa56d, 0xaaca, 0xaa07, 0xa838,
+    0xa721, 0xa42f, 0xa466, 0xa69a, 0x9cbb, 0x1da1, 0xa2f2, 0x9f63, 0x9b09,
+    0xa8e9, 0xac41, 0xa944, 0xa88d, 0xab2a, 0xabc4, 0xae56, 0xb0b4, 0xb077,
+    0xacf5, 0x2509, 0x2f46, 0x338d, 0x341c, 0x3420, 0x3332, 0x33cc, 0x325c,
+    0x2e59, 0x8c4f, 0xac0f, 0xaecc, 0xae57, 0xadb0, 0xaba5, 0x2691, 0x2e22,
+    0x2b20, 0x2c50, 0x348d, 0x2cb8, 0xaa00, 0xb06b, 0xb0b1, 0xad2f, 0x8979,
+    0x24db, 0xa69b, 0xa9ec, 0xa4d7, 0x2284, 0x2844, 0x2561, 0xa9c6, 0xae7b,
+    0xad47, 0xa297, 0x2885, 0x2ab4, 0x274c, 0xa488, 0xa81c, 0xaa1f, 0xac69,
+    0xa9e2, 0xa787, 0xab93, 0xacdb, 0xa6c1, 0x9b85, 0xa81b, 0xa6a7, 0xa1c4,
+    0xa185, 0x205f, 0x2cb0, 0x3213, 0x344e, 0x34cf, 0x32f7, 0x3094, 0x26ce,
+    0xa8e2, 0xae36, 0xb122, 0xb25c, 0xb146, 0xaf78, 0x993e, 0x2a6f, 0x2e4d,
+    0x3323, 0x3503, 0x346e, 0x3471, 0x37f9, 0x340f, 0x2cca, 0xad0e, 0xafe1,
+    0xac26, 0x2840, 0x2d0b, 0x29bb, 0x21fb, 0x24fb, 0x28e7, 0x2976, 0x2100,
+    0xacb9, 0xb040, 0xad02, 0x2af0, 0x30e1, 0x31cf, 0x3069, 0x2a58, 0xa435,
+    0xacb6, 0xae1a, 0xaa6d, 0xa4ab, 0xa86c, 0xa5bf, 0x2c0a, 0x2e22, 0x2bc1,
+    0x2dab, 0x318a, 0x3403, 0x3534, 0x36a2, 0x3852, 0x3898, 0x36fe, 0x3023,
+    0xb107, 0xb748, 0xb95a, 0xba44, 0xba4b, 0xb9a0, 0xb855, 0xb5c1, 0xae88,
+    0x9dcf, 0x2aa4, 0x32b1, 0x34ef, 0x34d2, 0x35a4, 0x38dc, 0xb2d4, 0xb0aa,
+    0xad3e, 0xab6c, 0xacc4, 0xac6b, 0xa800, 0x985f, 0x2273, 0x8182, 0xa24b,
+    0xa677, 0xa946, 0xa901, 0x1f6f, 0x29e4, 0x1e9b, 0xac65, 0xadee, 0xac64,
+    0xab21, 0xad1d, 0xafdf, 0xb057, 0xada6, 0xa702, 0x1a30, 0x2610, 0x2c64,
+    0x2fd9, 0x3093, 0x31a2, 0x3246, 0x318f, 0x308c, 0x2ff0, 0x2d49, 0x2984,
+    0x2a47, 0x2c6e, 0x2c6f, 0x258a, 0x9587, 0xa2b8, 0xa4ac, 0x20ca, 0x24d0,
+    0x2517, 0x267f, 0x209e, 0xaf59, 0xb09a, 0xad38, 0xa2ce, 0x1fb5, 0x2169,
+    0xaaec, 0xa4d5, 0x209f, 0x21ff, 0xa164, 0x9bb1, 0x29c4, 0x2d97, 0x2dd4,
+    0x2b30, 0x28c4, 0x2867, 0x2566, 0x1fb6, 0x282b, 0x2bce, 0x259d, 0xa83e,
+    0xa405, 0x288a, 0x298b, 0x18de, 0xa918, 0xa861, 0x2676, 0x2daa, 0x2ec1,
+    0x2e29, 0x2ee1, 0x306e, 0x3051, 0x304a, 0x305a, 0x2f4c, 0x2d32, 0x2aca,
+    0x216c, 0xa4ab, 0x9de6, 0x2573, 0x2a17, 0x2af5, 0x2dd1, 0x308d, 0x31c6,
+    0x3300, 0x33d4, 0x330a, 0x313f, 0x30be, 0x2aed, 0x1c19, 0x22a4, 0x2a12,
+    0x27b6, 0x252a, 0x2d15, 0x2cc2, 0x2a24, 0x209c, 0xa7d9, 0xa761, 0x2791,
+    0x2d90, 0x2dcd, 0x2a6b, 0x27d8, 0x27d6, 0x2649, 0x2449, 0x299c, 0x2c89,
+    0x26a4, 0xa763, 0x0b5f, 0x2b80, 0x2b96, 0x219d, 0xa5bf, 0x19c2, 0x2c6f,
+    0x2f9c, 0x2f3c, 0x2d09, 0x2b4a, 0x2c13, 0x290f, 0x1dfe, 0xa50b, 0xaa8a,
+    0xad7a, 0xaf2e, 0xb083, 0xb132, 0xb122, 0xb086, 0xae9e, 0xac24, 0x1d2f,
+    0x2eb3, 0x31c7, 0x3380, 0x34b6, 0x34c7, 0x33e4, 0x340e, 0x3270, 0x30b1,
+    0x2fb6, 0x2e7f, 0x28aa, 0x8925, 0x3383, 0x3248, 0x2eb3, 0x9c28, 0xae42,
+    0xb05d, 0xad7f, 0xa32f, 0x1f79, 0xa259, 0x9ce8, 0x2404, 0x270e, 0x29a3,
+    0x2dcf, 0x2f51, 0x2a44, 0xa481, 0x2236, 0x2ce0, 0x2c8a, 0x247c, 0x9f6e,
+    0x2668, 0x2cd5, 0x2d63, 0x2871, 0xa66b, 0xac40, 0xad26, 0xafdd, 0xb1c5,
+    0xb365, 0xb48c, 0xb566, 0xb600, 0xb65c, 0xb69f, 0xb6d0, 0xb6bc, 0xb62e,
+    0xb571, 0xb437, 0xb0d5, 0xac83, 0xa4eb, 0x2c96, 0x30d9, 0x317b, 0x33bb,
+    0x33fe, 0x32b7, 0x3155, 0x2e1f, 0xa61c, 0xaeb2, 0x341b, 0x3453, 0x320c,
+    0x2a4f, 0xae54, 0xb2a9, 0xb318, 0xb1ab, 0xb09f, 0xb00e, 0xad49, 0xa8d7,
+    0xa452, 0x21ec, 0x2dad, 0x302c, 0x2baf, 0xa2e8, 0x263f, 0x2eca, 0x2e93,
+    0x28ba, 0x1d79, 0x26d3, 0x2936, 0xa29b, 0xaf64, 0xb253, 0xb3e4, 0xb447,
+    0xb50a, 0xb61e, 0xb749, 0xb84c, 0xb8ef, 0xb968, 0xb9a8, 0xb9cb, 0xb9ec,
+    0xb9f1, 0xb9bf, 0xb969, 0xb8d1, 0xb7e7, 0xb6d6, 0xb648, 0xb4bb, 0xb107,
+    0xa98f, 0x2f1c, 0x315f, 0x306f, 0x2dfe, 0x1913, 0xb0f5, 0xb472, 0x215d,
+    0x3140, 0x34f8, 0x3615, 0x35d2, 0x3489, 0x3236, 0x304f, 0x3064, 0x30e4,
+    0x2ffe, 0x2a85, 0xab0a, 0xafb6, 0xae43, 0xac0c, 0xade7, 0xb0e8, 0xb264,
+    0xb348, 0xb381, 0xb2b5, 0xb158, 0xafc1, 0xab1b, 0x9c1a, 0xa812, 0xaef8,
+    0xafa4, 0x9fe0, 0x2efb, 0x309c, 0x2d35, 0xa82a, 0xaf6e, 0xb1a4, 0xb3a6,
+    0xb45e, 0xb369, 0xad54, 0x9602, 0x06af, 0xa5ad, 0xa9b9, 0xaa16, 0xa89a,
+    0xa8de, 0x1e75, 0x1f28, 0x24e6, 0x2904, 0xab0c, 0xb089, 0xb016, 0xae35,
+    0xb017, 0x9610, 0x3084, 0x345d, 0x3539, 0x34b7, 0x3295, 0x2faf, 0x2c87,
+    0x2d71, 0x2f11, 0x2e41, 0x293c, 0xab32, 0xb029, 0xb01a, 0xadfb, 0xadbc,
+    0xaeea, 0xaf71, 0xb043, 0xb128, 0xb122, 0xafd6, 0xac93, 0xa39e, 0x22ee,
+    0xa5e6, 0xada2, 0xade4, 0x8e57, 0x2d20, 0x2df3, 0x2862, 0xab9a, 0xaf6a,
+    0xb0b2, 0xb232, 0xb369, 0xb2d6, 0xad7a, 0x2069, 0x2924, 0x2830, 0x2147,
+    0x2272, 0x2979, 0x26ee, 0x269a, 0x1d34, 0x1eb0, 0x285f, 0xa125, 0xa874,
+    0xa43c, 0x1d29, 0xa149, 0xa852, 0x2dc6, 0x3245, 0x3349, 0x31fc, 0x2e10,
+    0x2070, 0xa4fe, 0x260d, 0x2c16, 0x2c1c, 0x2732, 0xaa07, 0xaf07, 0xaed5,
+    0xac69, 0xab3c, 0xac3c, 0xac36, 0xad66, 0xb011, 0xb037, 0xacc8, 0x1ab8,
+    0x2c02, 0x2c38, 0x20ec, 0xaa46, 0xaa19, 0x25dc, 0x2ca6, 0x2d00, 0x2964,
+    0xa667, 0xaad6, 0xac02, 0xaf2d, 0xb1e2, 0xb2f4, 0xb02f, 0xa89e, 0x2513,
+    0x2750, 0x1cda, 0x1a0f, 0x2a08, 0x2650, 0x13a5, 0xa616, 0xa8ac, 0xa029,
+    0x2318, 0x2cb5, 0x2fcb, 0x3063, 0x2f4e, 0xaa06, 0x2c4a, 0x30ec, 0x316c,
+    0x2fbd, 0x2564, 0xacae, 0xaddf, 0xa8ee, 0x9c52, 0x9477, 0xa30d, 0xaa68,
+    0xac6f, 0xa798, 0x2793, 0x2a28, 0x28af, 0x2902, 0x25fd, 0xa5f5, 0xa851,
+    0x2660, 0x2f1c, 0x311a, 0x300f, 0x2a2e, 0x9e25, 0x1c97, 0x2c54, 0x2f3e,
+    0x3090, 0x313f, 0x311b, 0x31dd, 0x3218, 0x2f30, 0xa620, 0xb0d3, 0xb11c,
+    0xaf99, 0xacdc, 0xac5e, 0xae06, 0xae07, 0xa818, 0xab37, 0xaccd, 0xac62,
+    0xab93, 0x1c75, 0x2ecb, 0x33cd, 0x34d2, 0x34b3, 0x33f3, 0xb150, 0xa23b,
+    0x2efe, 0x30e1, 0x3001, 0x2642, 0xad9b, 0xaf96, 0xad5f, 0xacb3, 0xacc7,
+    0xac6b, 0xaccb, 0xaad8, 0x267f, 0x2e7e, 0x2f15, 0x2d67, 0x2dfd, 0x2ebb,
+    0x2cff, 0x2c03, 0x2e19, 0x30bc, 0x3126, 0x2eaa, 0x282a, 0x22d2, 0x2b20,
+    0x303a, 0x3245, 0x344b, 0x35da, 0x3723, 0x384e, 0x3895, 0x3771, 0x33fd,
+    0x0c64, 0xb0b2, 0xb33b, 0xb449, 0xb50b, 0xb5ba, 0xb571, 0xb3f5, 0xb45e,
+    0xb443, 0xb25d, 0xb05a, 0xa50a, 0x3130, 0x35d4, 0x36cc, 0x3665, 0x357e,
+    0xaf42, 0xac28, 0xa248, 0x25af, 0x2a32, 0x29f6, 0x2805, 0x1bda, 0x243f,
+    0x2c29, 0x2cdc, 0x8e36, 0xae46, 0xb046, 0xaaab, 0x2df8, 0x3117, 0x2c5b,
+    0xac1c, 0xad4a, 0x9dff, 0x2a79, 0x2c04, 0x2c02, 0x28ec, 0xa597, 0xa987,
+    0x139a, 0x267b, 0x2859, 0x120e, 0xab86, 0xaaf1, 0xa864, 0x981f, 0x28ee,
+    0x1b72, 0x26ec, 0x2dbf, 0xa558, 0xa6e8, 0x2e05, 0x2d3a, 0xab0b, 0xb020,
+    0x26e1, 0x3027, 0xa6dd, 0xb67a, 0xb50d, 0x3126, 0x31cb, 0xacda, 0xb076,
+    0xb6cd, 0xbc1f, 0xae54, 0xacc0, 0xaa9a, 0xa80f, 0x8fb8, 0x1e7c, 0x9a24,
+    0xa5eb, 0xa27b, 0x299a, 0x2d8c, 0x2a0c, 0xa8a5, 0xae74, 0xace2, 0x279f,
+    0x2e68, 0x2a56, 0xa924, 0xaa65, 0x991b, 0x2333, 0x1fe4, 0x251e, 0x254a,
+    0x9f79, 0xa267, 0x233e, 0x2295, 0x249d, 0x24de, 0xa180, 0x9ff6, 0x1a09,
+    0x213e, 0x29a2, 0x12d1, 0x1060, 0x2a77, 0xab83, 0xacf3, 0x2c16, 0x2d62,
+    0xa872, 0xaf48, 0x2822, 0x30fb, 0x29ea, 0xb4bb, 0xb2d2, 0x3335, 0x3237,
+    0xa9fd, 0xab82, 0xb5e3, 0xbbf9, 0xa4e6, 0xa6d5, 0xa8c9, 0xa8a2, 0x9fe7,
+    0x2206, 0x2635, 0x2438, 0x216e, 0x2a68, 0x2e4a, 0x2d10, 0x1b24, 0xad73,
+    0xaeac, 0xa5ca, 0x2c40, 0x2b84, 0x12a7, 0x9593, 0x279a, 0x2445, 0x9ec3,
+    0x8f68, 0x1125, 0xa23a, 0xa050, 0x168f, 0xa34c, 0x1f5a, 0x28b2, 0x2637,
+    0x24f6, 0x249d, 0x243d, 0x2c2e, 0x27bd, 0x2011, 0x2874, 0xadd1, 0xb02e,
+    0x284e, 0x2d9c, 0xa412, 0xaeda, 0x2874, 0x31f4, 0x2d4b, 0xb3a4, 0xb03e,
+    0x34c8, 0x33bc, 0x195e, 0x0f5b, 0xb62c, 0xbc3b, 0x24cd, 0xa461, 0xabaa,
+    0xad34, 0xab83, 0xa4d5, 0x224a, 0x1c90, 0xa110, 0x271d, 0x2d40, 0x2c64,
+    0xa40e, 0xb001, 0xb11d, 0xacc3, 0x2815, 0x2846, 0xa824, 0xa836, 0x2490,
+    0x264f, 0x1feb, 0x1953, 0xa1d5, 0xa5ee, 0x9cca, 0x1e9c, 0xa79b, 0xa08b,
+    0x2645, 0x252c, 0x200b, 0x1ca5, 0x26f2, 0x2f60, 0x2e58, 0x2b52, 0x2cb0,
+    0xa998, 0xae06, 0x2beb, 0x2f20, 0xa2bb, 0xaf01, 0x25bc, 0x30ac, 0xa50a,
+    0xb562, 0xb04b, 0x363a, 0x3582, 0x2c07, 0x20b8, 0xb7de, 0xbcf4, 0x30b1,
+    0x2caa, 0xa416, 0xac19, 0xab33, 0xa23b, 0x271a, 0x2485, 0x1fec, 0x2c47,
+    0x304a, 0x2f10, 0x2117, 0xae6b, 0xaf5d, 0xa2f4, 0x2d28, 0x2958, 0xac06,
+    0xab6e, 0x2979, 0x2e01, 0x2d23, 0x2896, 0xa4d3, 0xa979, 0xa0f4, 0x24b2,
+    0xa0bf, 0x22af, 0x28a8, 0x2483, 0xa6bb, 0xaa54, 0xa5e6, 0x2c5a, 0x2b36,
+    0x9e18, 0x9d94, 0xaee6, 0xb012, 0x2925, 0x2f94, 0x1ebe, 0xac14, 0x2ad8,
+    0x2ff8, 0xaf28, 0xb6fe, 0xaeeb, 0x388a, 0x3855, 0x31be, 0x254f, 0xb8d2,
+    0xbdb6, 0x31b7, 0x3189, 0x30fe, 0x2e4b, 0x2939, 0xa5d6, 0xaf77, 0xb2df,
+    0xb46f, 0xb4fc, 0xb424, 0xae56, 0x2ba6, 0x2e39, 0x20d7, 0xaeb4, 0xae6b,
+    0x2b34, 0x31f5, 0x2f1e, 0xaf66, 0xb4bf, 0xb452, 0xa5f1, 0x33a4, 0x35af,
+    0x35c6, 0x3525, 0x3413, 0x316e, 0x2d59, 0x250d, 0xa828, 0xac2b, 0xacbf,
+    0xabcf, 0xa8b8, 0xa6f7, 0xa43b, 0x2030, 0x27e6, 0x248a, 0x9ee3, 0x94d6,
+    0x1579, 0x93d5, 0xa476, 0xa251, 0x2bba, 0x2c2a, 0xa7e3, 0xa843, 0x22b8,
+    0x2b8a, 0x32ae, 0x37dd, 0x3168, 0x3183, 0x314b, 0x2f1c, 0x2abf, 0x9840,
+    0xacef, 0xb0a2, 0xb1f8, 0xb317, 0xb1e4, 0xa935, 0x2e99, 0x302b, 0x28f9,
+    0xad6c, 0xadf0, 0x2c13, 0x328d, 0x304d, 0xae9c, 0xb505, 0xb552, 0xb04e,
+    0x2e1f, 0x3279, 0x32d1, 0x3212, 0x3081, 0x2c2b, 0x9cf7, 0xa939, 0xac9c,
+    0xae15, 0xae07, 0xad2c, 0xab27, 0xa82c, 0xa21f, 0x2599, 0x2a86, 0x28d1,
+    0x1cf1, 0x99f9, 0xa4fc, 0xab74, 0xae93, 0xae89, 0xa7f9, 0xa508, 0xad4a,
+    0xaad2, 0xa27d, 0x1eab, 0x2f13, 0x355b, 0x30d8, 0x311b, 0x3101, 0x2e7b,
+    0x296f, 0xa016, 0xac4a, 0xae86, 0xb013, 0xb139, 0xb00b, 0x24ef, 0x311c,
+    0x31c8, 0x2d33, 0xab98, 0xad37, 0x2d61, 0x33e3, 0x31de, 0xac8d, 0xb51f,
+    0xb627, 0xb31e, 0x9ea6, 0x2e5b, 0x2f65, 0x2e91, 0x2c00, 0x95b4, 0xaa52,
+    0xab08, 0xabc9, 0xaca4, 0xac81, 0xac67, 0xab71, 0xa808, 0x97ee, 0x2915,
+    0x2cd5, 0x2c0a, 0x2529, 0x9b83, 0xa7b9, 0xace5, 0xaf6e, 0xae55, 0xa92a,
+    0xaa73, 0xaf0a, 0xac0a, 0xa65a, 0xaa0a, 0x9c23, 0x3114, 0x2dc2, 0x2dd9,
+    0x2d12, 0x22c3, 0xac24, 0xaff0, 0xb1ae, 0xb247, 0xb27b, 0xb293, 0xafce,
+    0x2ca1, 0x33be, 0x342d, 0x3038, 0xa96c, 0xacb8, 0x2f7f, 0x34e0, 0x339b,
+    0xaa5e, 0xb558, 0xb686, 0xb36f, 0x13c2, 0x2f20, 0x2f91, 0x2e25, 0x2b84,
+    0x21a7, 0xa4ef, 0xa239, 0x9f63, 0xa51e, 0xa849, 0xab52, 0xac95, 0xabbb,
+    0xa9f6, 0xa4d9, 0x2452, 0x23d4, 0xa48c, 0xa952, 0xaab1, 0xab6a, 0xaad9,
+    0xa4b1, 0x260c, 0xa404, 0xadeb, 0xa9d8, 0xa309, 0xacfe, 0xad71, 0x2882,
+    0x31dc, 0x307c, 0x2d47, 0xa5bd, 0xb0c6, 0xb400, 0xb526, 0xb571, 0xb545,
+    0xb49e, 0xb075, 0x2fcd, 0x3575, 0x35ee, 0x32c7, 0x9bf2, 0xaac6, 0x3150,
+    0x3631, 0x350c, 0xa3af, 0xb579, 0xb6ac, 0xb2b3, 0x2b60, 0x3175, 0x30a9,
+    0x2cfe, 0x214c, 0xa77b, 0xa89e, 0xa447, 0xa010, 0xa6e9, 0xab8d, 0xae51,
+    0xafd7, 0xafa4, 0xafd3, 0xaf91, 0xadb0, 0xac1a, 0xaaa8, 0xa926, 0xa1c6,
+    0x28d7, 0x2db4, 0x300d, 0x30a8, 0x2e3e, 0x1fdb, 0x28a4, 0x2ab6, 0xaa94,
+    0xae19, 0x824b, 0xb4f5, 0xaca7, 0x2730, 0x288c, 0x284e, 0x2483, 0x2056,
+    0x25e4, 0x2675, 0x241c, 0x226a, 0x2464, 0x2b0c, 0x2a7d, 0x2378, 0x2849,
+    0x2c7e, 0x2412, 0xa797, 0x19d7, 0x2c2f, 0x2f3b, 0x2fb1, 0x2ad6, 0xa9b1,
+    0xaa9a, 0x273f, 0x2d52, 0x2ce1, 0x2a09, 0x9c19, 0xab75, 0xac13, 0xa53c,
+    0xa5ac, 0xad61, 0xadb2, 0xa005, 0x2cc1, 0x2e2a, 0x2adc, 0x20ce, 0x2a8b,
+    0x2ff3, 0x30fb, 0x31e4, 0x3325, 0x33bf, 0x347b, 0x360b, 0x3734, 0x373f,
+    0x364d, 0x3651, 0x3814, 0x386e, 0xb1fd, 0x9cb0, 0x2aa2, 0x2a9e, 0x2726,
+    0xa5a2, 0xa63d, 0x1ca9, 0x88c0, 0x9d2b, 0x9c64, 0xa645, 0xa292, 0x9d9b,
+    0xa1ba, 0x2708, 0x2b4f, 0x96b5, 0xabb7, 0xa9f5, 0x9f19, 0x296b, 0x2ced,
+    0x293f, 0xa627, 0xa602, 0x27e1, 0x2b2c, 0x26be, 0x206b, 0x239e, 0x24e9,
+    0x26b5, 0x29cb, 0x254f, 0xac04, 0xaeb8, 0xac49, 0x98e0, 0x272f, 0x9b5c,
+    0xaace, 0xaafe, 0xa5c5, 0x1a43, 0x26e6, 0x286c, 0x9f19, 0xaafd, 0xadb3,
+    0xb12b, 0xb439, 0xb55f, 0xb42b, 0xafdd, 0xb0a3, 0xae13, 0x22a9, 0x268f,
+    0x29ce, 0x2989, 0xa0cb, 0xa165, 0x2453, 0x1e80, 0x1d98, 0x1e6a, 0xa727,
+    0xa95d, 0xa88f, 0xa3c6, 0x284e, 0x2a91, 0xa058, 0xac6c, 0xab3c, 0xa7f2,
+    0x2178, 0x2a71, 0x23c9, 0xa8e1, 0xa5bc, 0x2802, 0x28d5, 0xa5a9, 0xaa13,
+    0x9188, 0x2a8e, 0x2ceb, 0x2e20, 0x2be4, 0xa853, 0xae5a, 0xae03, 0xa894,
+    0x25da, 0x277a, 0xa2ce, 0xaa8a, 0xac0b, 0xaada, 0xab21, 0xaea5, 0xb2e2,
+    0xb584, 0xb7cf, 0xb95f, 0xbadc, 0xbbc5, 0xbb3c, 0xba81, 0xbb2a, 0xa49d,
+    0x292b, 0x1c6b, 0x20fa, 0x2176, 0xa852, 0xa7a1, 0x19b8, 0x1fc4, 0x24f2,
+    0x272d, 0xa216, 0xa9df, 0xaa69, 0xa73f, 0x2495, 0x29ab, 0x22dc, 0xa6dd,
+    0xa1b3, 0x9e81, 0x216e, 0x2924, 0x1994, 0xa8b0, 0x9d6e, 0x2a9f, 0x2b60,
+    0x99f6, 0xa61c, 0x283e, 0x2dc4, 0x2f20, 0x3038, 0x2e73, 0x218e, 0xac32,
+    0xad58, 0xa824, 0x28f2, 0x2beb, 0x2471, 0xa9c5, 0xad1b, 0xad8f, 0xafb3,
+    0xb348, 0xb660, 0xb89f, 0xba33, 0xbc03, 0xbce5, 0xbd7a, 0xbd7a, 0xbd7a,
+    0xbe01, 0x2cdf, 0x3083, 0x2dfc, 0x2dfc, 0x2e54, 0x269f, 0x2935, 0x2c0e,
+    0x2927, 0x2907, 0x2995, 0x2126, 0xa649, 0xa89a, 0xa458, 0x268a, 0x2a89,
+    0x2748, 0x2194, 0x29c6, 0x2975, 0x280b, 0x28c2, 0xa19c, 0xa952, 0x1e31,
+    0x2ce5, 0x2e00, 0x2b33, 0x2bdd, 0x2f53, 0x3060, 0x2fe9, 0x2ff9, 0x2d5f,
+    0xa42f, 0xb006, 0xb1d0, 0xb0bb, 0xabca, 0xa4ea, 0xac17, 0xb092, 0xb21c,
+    0xb292, 0xb41c, 0xb665, 0xb8c5, 0xba6b, 0xbc1b, 0xbd0d, 0xbde7, 0xbe7c,
+    0xbea6, 0xbeeb, 0xbf9f, 0x9914, 0x98d1, 0x991a, 0x98d0, 0x991b, 0x98d1,
+    0x9918, 0x98d4, 0x9913, 0x98db, 0x990b, 0x98e4, 0x9902, 0x98ec, 0x98fc,
+    0x98ee, 0x98fd, 0x98eb, 0x9900, 0x98ea, 0x98fe, 0x98f0, 0x98f6, 0x98f8,
+    0x98f0, 0x98fc, 0x98ee, 0x98fc, 0x98f0, 0x98f9, 0x98f3, 0x98f7, 0x98f4,
+    0x98f6, 0x98f4, 0x98f7, 0x98f3, 0x98f9, 0x98f1, 0x98fb, 0x98ef, 0x98fb,
+    0x98f2, 0x98f6, 0x98f8, 0x98ee, 0x98fe, 0x98ec, 0x98fd, 0x98f1, 0x98f6,
+    0x98f6, 0x98f3, 0x98f8, 0x98f2, 0x98f7, 0x98d1, 0x991e, 0x98cc, 0x991e,
+    0x98cc, 0x991e, 0x98cf, 0x991a, 0x98d4, 0x9912, 0x98dd, 0x9908, 0x98e7,
+    0x98ff, 0x98ee, 0x98fd, 0x98ec, 0x9900, 0x98e9, 0x9901, 0x98ec, 0x98fb,
+    0x98f4, 0x98f2, 0x98fb, 0x98ed, 0x98fd, 0x98ee, 0x98fb, 0x98f1, 0x98f8,
+    0x98f4, 0x98f6, 0x98f5, 0x98f6, 0x98f4, 0x98f8, 0x98f1, 0x98fb, 0x98ee,
+    0x98fc, 0x98ef, 0x98f9, 0x98f4, 0x98f2, 0x98fd, 0x98eb, 0x9900, 0x98ed,
+    0x98fa, 0x98f4, 0x98f4, 0x98f8, 0x98f2, 0x98f8, 0x98f2, 0x9919, 0x98cd,
+    0x991e, 0x98cc, 0x991e, 0x98cd, 0x991c, 0x98d1, 0x9917, 0x98d8, 0x990d,
+    0x98e2, 0x9903, 0x98eb, 0x98fd, 0x98ee, 0x98fe, 0x98ea, 0x9902, 0x98e9,
+    0x98ff, 0x98f0, 0x98f6, 0x98f8, 0x98ef, 0x98fd, 0x98ed, 0x98fd, 0x98f0,
+    0x98f9, 0x98f3, 0x98f7, 0x98f4, 0x98f6, 0x98f4, 0x98f7, 0x98f3, 0x98f9,
+    0x98f0, 0x98fc, 0x98ee, 0x98fc, 0x98f1, 0x98f6, 0x98f9, 0x98ed, 0x9900,
+    0x98ea, 0x98fe, 0x98f0, 0x98f6, 0x98f7, 0x98f2, 0x98f9, 0x98f2, 0x98f8,
+    0x98d1, 0x991e, 0x98cc, 0x991e, 0x98cc, 0x991e, 0x98cf, 0x991a, 0x98d4,
+    0x9912, 0x98dd, 0x9908, 0x98e7, 0x98ff, 0x98ee, 0x98fd, 0x98ec, 0x9900,
+    0x98e9, 0x9901, 0x98ec, 0x98fb, 0x98f4, 0x98f2, 0x98fb, 0x98ed, 0x98fd,
+    0x98ee, 0x98fb, 0x98f1, 0x98f8, 0x98f4, 0x98f6, 0x98f5, 0x98f6, 0x98f4,
+    0x98f8, 0x98f1, 0x98fb, 0x98ee, 0x98fc, 0x98ef, 0x98f9, 0x98f4, 0x98f2,
+    0x98fd, 0x98eb, 0x9900, 0x98ed, 0x98fa, 0x98f4, 0x98f4, 0x98f8, 0x98f2,
+    0x98f8, 0x98f2, 0x9914, 0x98d1, 0x991a, 0x98d0, 0x991b, 0x98d1, 0x9918,
+    0x98d4, 0x9913, 0x98db, 0x990b, 0x98e4, 0x9902, 0x98ec, 0x98fc, 0x98ee,
+    0x98fd, 0x98eb, 0x9900, 0x98ea, 0x98fe, 0x98f0, 0x98f6, 0x98f8, 0x98f0,
+    0x98fc, 0x98ee, 0x98fc, 0x98f0, 0x98f9, 0x98f3, 0x98f7, 0x98f4, 0x98f6,
+    0x98f4, 0x98f7, 0x98f3, 0x98f9, 0x98f1, 0x98fb, 0x98ef, 0x98fb, 0x98f2,
+    0x98f6, 0x98f8, 0x98ee, 0x98fe, 0x98ec, 0x98fd, 0x98f1, 0x98f6, 0x98f6,
+    0x98f3, 0x98f8, 0x98f2, 0x98f7, 0x2c40, 0xa4e4, 0xafb5, 0xb282, 0xb379,
+    0xb215, 0xad3e, 0x2bea, 0x30be, 0x3074, 0x2de7, 0x28a9, 0xa8a7, 0xb0aa,
+    0xb491, 0xb61e, 0xb594, 0xb1c6, 0x2836, 0x330b, 0x3547, 0x3582, 0x3532,
+    0x34b1, 0x336a, 0x300f, 0xa7a7, 0xb3c3, 0xb757, 0xb887, 0xb835, 0xb61e,
+    0xb1f0, 0xa0dc, 0x2c65, 0x2e22, 0x2fc5, 0x2fc7, 0x300f, 0x302f, 0x2d73,
+    0x2c09, 0x29e7, 0x292d, 0x204a, 0xa6ff, 0x2002, 0xa476, 0xa91b, 0xa67c,
+    0xa996, 0xaa12, 0xa483, 0xa497, 0x987f, 0x3118, 0x30b2, 0x2ab6, 0xaba2,
+    0xb0e9, 0xb236, 0xb127, 0xac05, 0x2d06, 0x3193, 0x3190, 0x2f39, 0x28a8,
+    0xa8b4, 0xaf89, 0xb2bd, 0xb438, 0xb2be, 0xabc1, 0x2ed3, 0x337e, 0x3489,
+    0x33d2, 0x317f, 0x2d99, 0xa02f, 0xae83, 0xb265, 0xb518, 0xb6d1, 0xb715,
+    0xb572, 0xb12b, 0x28e8, 0x3191, 0x3218, 0x3189, 0x3199, 0x30d8, 0x2f89,
+    0x2e06, 0x296c, 0x273a, 0x273e, 0x24a4, 0xa78e, 0xad0e, 0xab70, 0xace0,
+    0xacab, 0xa922, 0xaaf3, 0xa9a0, 0x2360, 0xa218, 0xa942, 0x2d44, 0x31dc,
+    0x2cfd, 0xa9e9, 0xb0c9, 0xb22f, 0xb13f, 0xacfe, 0x2a59, 0x30b4, 0x30e6,
+    0x2d21, 0xa5fe, 0xaefe, 0xb178, 0xb2fa, 0xb2ba, 0xaee2, 0x2a3d, 0x319c,
+    0x33b1, 0x337f, 0x3114, 0x2a9e, 0xac6f, 0xb1bd, 0xb3d7, 0xb477, 0xb4f0,
+    0xb522, 0xb448, 0xb01f, 0x2b5e, 0x333c, 0x3471, 0x323f, 0x2fab, 0x2ebc,
+    0x2cea, 0x2916, 0x24d4, 0xa300, 0x1f26, 0x2934, 0x287d, 0xa5b6, 0xade3,
+    0xae36, 0xaeb4, 0xacc5, 0xa504, 0xa86d, 0xa48c, 0x2cd8, 0x2886, 0xa8f3,
+    0x2615, 0x32fe, 0x2d99, 0xac1f, 0xb199, 0xb2c0, 0xb15c, 0xac87, 0x2c1a,
+    0x316e, 0x31bf, 0x2d99, 0xa9ca, 0xb0d0, 0xb29a, 0xb2d4, 0xb0e2, 0xa458,
+    0x307b, 0x33dc, 0x3474, 0x339b, 0x301d, 0xa251, 0xb0e5, 0xb3f2, 0xb42f,
+    0xb2f2, 0xb141, 0xaf20, 0xa6b6, 0x2eca, 0x3420, 0x359b, 0x3498, 0x2eda,
+    0x9f8c, 0xa5b8, 0xa749, 0xa8df, 0xa9cd, 0xab3a, 0x14e0, 0x2c66, 0x2c09,
+    0xa233, 0xaea3, 0xb03d, 0xb031, 0xad0e, 0x9cd7, 0xa48f, 0x236e, 0x30c2,
+    0x2f76, 0x1fb0, 0x23ef, 0x33ca, 0x2bde, 0xb073, 0xb466, 0xb4c9, 0xb307,
+    0xad3e, 0x2d77, 0x32a4, 0x32c9, 0x2d8f, 0xad75, 0xb2bd, 0xb405, 0xb289,
+    0xacac, 0x2ef8, 0x3456, 0x35cc, 0x3601, 0x34de, 0x30ef, 0xa834, 0xb281,
+    0xb4a2, 0xb3d2, 0xae8a, 0x2a36, 0x314f, 0x33fb, 0x3536, 0x365b, 0x3665,
+    0x33fd, 0x22e3, 0xafd8, 0xb034, 0xaea7, 0xad89, 0xad97, 0xadbb, 0xa46d,
+    0x2ba1, 0x287d, 0xacbc, 0xb1f4, 0xb2a8, 0xb17c, 0xaea4, 0xa408, 0xa645,
+    0x25b1, 0x3214, 0x321a, 0x2c19, 0x2843, 0xb420, 0xb371, 0xb0f9, 0xa9e5,
+    0x2c90, 0x311e, 0x3325, 0x347b, 0x353d, 0x3555, 0x34da, 0x3426, 0x31e9,
+    0x2d36, 0x1cc2, 0x1c75, 0x2dda, 0x320b, 0x32fc, 0x3216, 0x2fe2, 0x28eb,
+    0x1b4d, 0x2800, 0x2865, 0xa836, 0xaed7, 0xb00e, 0xae7b, 0xa94b, 0x2470,
+    0x14bf, 0xac2d, 0xaff8, 0xb0be, 0xad68, 0xa536, 0x2526, 0x2c15, 0x26b1,
+    0xa8f4, 0xa985, 0xa9f8, 0xac86, 0xac6e, 0xa9a1, 0xaa32, 0xabc9, 0xada6,
+    0xaf62, 0xb147, 0xb1f1, 0xac7e, 0x2ce9, 0x2b8c, 0xa608, 0xb55a, 0xb4e5,
+    0xb34a, 0xafc1, 0x9b27, 0x2e02, 0x3185, 0x337e, 0x3472, 0x3473, 0x33f8,
+    0x3302, 0x316e, 0x2e19, 0x292c, 0x2978, 0x2f51, 0x3265, 0x3396, 0x3343,
+    0x3123, 0x2a25, 0xa438, 0x1c63, 0x262b, 0xa370, 0xac18, 0xacdd, 0xab17,
+    0xa236, 0x26c2, 0x9c90, 0xacdf, 0xafde, 0xaf86, 0xa57a, 0x2c4a, 0x2ef4,
+    0x3042, 0x2d28, 0x1f2b, 0x2050, 0x1f85, 0xa6aa, 0xab38, 0xac1a, 0xac7e,
+    0xaddc, 0xafac, 0xaf24, 0xb027, 0xb0f7, 0xab91, 0x2d60, 0x2cb4, 0xa01d,
+    0xb759, 0xb6ca, 0xb587, 0xb363, 0xae50, 0x24d6, 0x2f34, 0x3190, 0x3291,
+    0x3255, 0x3192, 0x315b, 0x30f1, 0x2fa7, 0x2dac, 0x2d36, 0x2f6d, 0x315f,
+    0x326c, 0x32cb, 0x310c, 0x25a6, 0xacfa, 0xac73, 0xa7c0, 0xa797, 0xa9f6,
+    0xaaa1, 0xaa06, 0xa67a, 0x9cd2, 0xaa32, 0xb040, 0xb1be, 0xb0b9, 0xa453,
+    0x2ec8, 0x3166, 0x320f, 0x3051, 0x2c36, 0x2c73, 0x2b38, 0x14f3, 0xac22,
+    0xae8e, 0xae06, 0xaeea, 0xb031, 0xad4a, 0xab86, 0xad03, 0xa3f6, 0x2d83,
+    0x2bd4, 0xa324, 0xb8f2, 0xb8a1, 0xb7f2, 0xb5f0, 0xb306, 0xace7, 0x2874,
+    0x2e56, 0x2ffd, 0x2f54, 0x2df2, 0x2e1e, 0x2edf, 0x2eda, 0x2e45, 0x2da6,
+    0x2e18, 0x2f93, 0x30c4, 0x31da, 0x30c9, 0x22cb, 0xae8a, 0xae84, 0xa9f2,
+    0xa328, 0xa090, 0xa407, 0xa80b, 0xa8a2, 0xa909, 0xaeac, 0xb2ad, 0xb41b,
+    0xb23f, 0xa5dc, 0x30a5, 0x33f9, 0x34b2, 0x340c, 0x323e, 0x3215, 0x30c6,
+    0x2ad5, 0xaac6, 0xaf29, 0xad3e, 0xacb1, 0xad0e, 0x9bb0, 0x2bac, 0x2bd1,
+    0x2da2, 0x2ff2, 0x2bf4, 0xa1b9, 0xba1d, 0xb9bf, 0xb912, 0xb808, 0xb571,
+    0xb1f3, 0xac85, 0x9f24, 0x25fe, 0x2513, 0x160c, 0x2084, 0x2939, 0x2cc5,
+    0x2e01, 0x2e14, 0x2e07, 0x2ece, 0x3089, 0x3249, 0x3219, 0x2cdd, 0xa84f,
+    0xa8aa, 0x2577, 0x2bc8, 0x2ba2, 0x26bf, 0xa7d3, 0xac8c, 0xae4c, 0xb1b9,
+    0xb4ad, 0xb556, 0xb3b8, 0xa669, 0x3236, 0x3593, 0x36db, 0x3666, 0x357b,
+    0x353a, 0x343a, 0x2ff2, 0xa919, 0xb036, 0xadd8, 0xaaed, 0xa883, 0x2c1c,
+    0x310f, 0x318b, 0x3222, 0x31d2, 0x2dd9, 0x2505, 0xb0f7, 0xb069, 0xb094,
+    0xb1b6, 0xb120, 0xacdc, 0x21c7, 0x2857, 0x1e49, 0x1fc5, 0x2bac, 0x2a4b,
+    0x221c, 0x1d41, 0xa81e, 0xa9a4, 0xa28b, 0xa1b8, 0x9e64, 0x25f7, 0x2c02,
+    0x2d31, 0x2b6a, 0x8e79, 0xab5d, 0xaac9, 0x22cf, 0x2ca1, 0x2ddd, 0x2d5a,
+    0x2928, 0xa4b4, 0xa6fc, 0x295b, 0x2b10, 0x2825, 0x2ba8, 0x24e0, 0xa79b,
+    0x1c9e, 0x9bab, 0x1e99, 0x26d4, 0xa824, 0xae60, 0xafbb, 0xa8ba, 0xa03a,
+    0x2d08, 0x2d09, 0x313d, 0x326b, 0x2a20, 0xa18c, 0xadbf, 0xb3d2, 0xa5a6,
+    0x15cd, 0x1cee, 0xa604, 0x9a54, 0x284f, 0x2bf3, 0x2b02, 0x2241, 0x201d,
+    0x2b5c, 0x2a8e, 0x2528, 0x261c, 0x1d87, 0x18a9, 0x248b, 0x9aff, 0x9f10,
+    0x2871, 0x2d46, 0x2e87, 0x2db1, 0x2b79, 0x299e, 0x29b4, 0x280d, 0x18d2,
+    0xa029, 0x1c06, 0x19d8, 0xa7d9, 0xaa6e, 0x9fb1, 0x22df, 0x2566, 0x2b71,
+    0x24a4, 0xa794, 0x9d6f, 0xa8da, 0xa9e8, 0x1c7b, 0x2333, 0x2403, 0x291e,
+    0x2bbf, 0x23ad, 0x2e7d, 0x317f, 0x3490, 0x358b, 0x34b6, 0x3525, 0x3503,
+    0x3327, 0x2ca2, 0x2bd2, 0x2534, 0x83cd, 0x2506, 0x27df, 0x27d9, 0x27af,
+    0x221c, 0x2137, 0x2864, 0x285d, 0x2645, 0x26ff, 0x1953, 0x19ef, 0x2864,
+    0x2762, 0x2436, 0x28cf, 0x2ae2, 0x2ae8, 0x2794, 0x9e1c, 0x1529, 0x2413,
+    0xa4a1, 0xac2e, 0xac32, 0xa7fa, 0x9d4b, 0xa6e1, 0xabf9, 0xaa32, 0xa84b,
+    0xa38a, 0x2693, 0x94d2, 0xaa02, 0xa81e, 0xaa06, 0xab6e, 0xa49c, 0x21f5,
+    0x2a2b, 0x2e0c, 0x2b72, 0xa22f, 0x29ec, 0x2d39, 0x3082, 0x31bf, 0x312d,
+    0x3521, 0x3737, 0x3695, 0x3283, 0x30c0, 0x24b6, 0xaaa0, 0xa9bc, 0xa8fd,
+    0xa6ea, 0x9f9a, 0x98db, 0x9802, 0x9a3f, 0xa635, 0xa71b, 0x9932, 0xa6aa,
+    0xaae2, 0xa6b9, 0x9f4d, 0xa0e0, 0x0e25, 0x991f, 0x9a92, 0xa72b, 0xac8d,
+    0xac1d, 0xaa63, 0xad43, 0xae00, 0xa7de, 0x2885, 0x2ace, 0x19a4, 0xac08,
+    0xac29, 0xa97f, 0xa2ff, 0x25c4, 0x1522, 0xa9e2, 0xa7ec, 0xa401, 0x9f58,
+    0x2841, 0x2c25, 0x2d8f, 0x2d20, 0xa827, 0xafc6, 0xb10e, 0xb46a, 0xb5f5,
+    0xb720, 0xb838, 0xb4b1, 0xab14, 0xac9f, 0x2c6b, 0x2ead, 0xa236, 0xae83,
+    0xaf5f, 0xaeae, 0xa8f0, 0x22ce, 0x24e9, 0x253d, 0x94bb, 0xac3c, 0xad6b,
+    0xa795, 0xa852, 0xad65, 0xac64, 0xa8d7, 0xa8c5, 0xa6b5, 0xa318, 0x223f,
+    0x2001, 0xa66b, 0xa4af, 0x94f9, 0xa4e2, 0x164f, 0x2d21, 0x306c, 0x3074,
+    0x2d25, 0x25fc, 0x281a, 0x2cd3, 0x2f8f, 0x3023, 0x2c04, 0xa174, 0x244b,
+    0x2c20, 0x2ed3, 0x30cb, 0x30f4, 0x2f0b, 0xa1b2, 0xb369, 0xb65d, 0xb881,
+    0xbad9, 0xbc7e, 0xbd3f, 0xbdc8, 0xbcb6, 0xbb57, 0xbb7e, 0xb5eb, 0xb6b8,
+    0xb732, 0xb672, 0xb389, 0xa469, 0x3080, 0x3114, 0x2d2b, 0x2739, 0x28a9,
+    0x2a38, 0x2375, 0xa04a, 0x25cb, 0x2e3c, 0x317c, 0x30af, 0x2a80, 0xa93a,
+    0xadf3, 0xaca3, 0xa99e, 0xaca4, 0xac85, 0x229d, 0x2f92, 0x31fa, 0x33cf,
+    0x347b, 0x3303, 0x2f7e, 0x27f0, 0xa91b, 0xa1bd, 0x2771, 0x265d, 0xa22a,
+    0xac8d, 0xae99, 0xae23, 0xb131, 0xb224, 0xafbe, 0xae0b, 0xa61b, 0xa443,
+    0x2c5c, 0x3106, 0x3078, 0x301d, 0x316f, 0x315f, 0x3264, 0x31a3, 0x2e1c,
+    0xb569, 0xb655, 0xb6f6, 0xb669, 0xb401, 0xa9b5, 0x2d8f, 0x2cad, 0xa5bc,
+    0xacd5, 0xac0f, 0xaa98, 0xac85, 0xab8d, 0xa380, 0x27a5, 0x2afc, 0x24ac,
+    0xa6dc, 0xa93d, 0xa89a, 0xa2fc, 0xa73b, 0xae4c, 0xb01c, 0xacd5, 0xa17a,
+    0x2522, 0x2d2d, 0x310d, 0x303f, 0x2b48, 0xa4d9, 0xad83, 0xa85b, 0x29f5,
+    0x2ca1, 0x2a9b, 0x2337, 0x1c05, 0x2927, 0x1d09, 0xa4ee, 0x296e, 0x2812,
+    0x2c78, 0x2c2f, 0x2e36, 0x305a, 0x2fd1, 0x2fd5, 0x30af, 0x303d, 0x3107,
+    0x3167, 0x2fe4, 0xb080, 0xb39b, 0xb510, 0xb4fe, 0xb1e6, 0x1c8e, 0x2e7c,
+    0x29d2, 0xac2f, 0xae64, 0xac6c, 0xaa85, 0xaad4, 0xa103, 0x29cc, 0x2aea,
+    0x22ef, 0xab2a, 0xac38, 0x14f2, 0x2d1f, 0x2f73, 0x2c0c, 0xa9b0, 0xae1c,
+    0xac44, 0xa999, 0xaae5, 0xa10e, 0x2cce, 0x2c58, 0x20a7, 0xac8d, 0xb0ff,
+    0xae4b, 0x25bf, 0x2db0, 0x2e1d, 0x2c89, 0x2aaf, 0x2d76, 0x2a81, 0x24d0,
+    0x2c6c, 0x2a13, 0x2cf7, 0x2c8d, 0x2d70, 0x2de4, 0x2d67, 0x2d25, 0x2cb8,
+    0x29b1, 0x2c2b, 0x2e82, 0x2d0d, 0x311a, 0xa45c, 0xb17a, 0xb29c, 0xae6a,
+    0x2cdd, 0x3114, 0x2d3b, 0xa8fd, 0xab6b, 0xa350, 0x214e, 0x281d, 0x2f3a,
+    0x31d3, 0x3100, 0x28ab, 0xaea9, 0xafe8, 0x1d46, 0x319a, 0x342b, 0x321c,
+    0x2994, 0xa960, 0xa9ce, 0xaa5e, 0xad66, 0xabb5, 0x23b4, 0x94d4, 0xab83,
+    0xb0a7, 0xb3f3, 0xb24a, 0xaad1, 0x29ac, 0x2d8f, 0x2d76, 0x2b51, 0x2c84,
+    0x0c4b, 0xaa6c, 0xa282, 0xa8cb, 0x9c04, 0xa2e8, 0x9d6e, 0x2448, 0x2aa0,
+    0x29b8, 0x98ef, 0xaac5, 0xa94b, 0xa597, 0xad96, 0x3a2d, 0x3648, 0x28a7,
+    0xb07d, 0xaf8a, 0x24b9, 0x2cee, 0x93be, 0xaed2, 0xae2f, 0xa593, 0x2606,
+    0x2cac, 0x3251, 0x34b5, 0x3403, 0x2c9e, 0xb073, 0xb1ca, 0x1f65, 0x348c,
+    0x3712, 0x35d4, 0x3173, 0x2a7d, 0x28ce, 0x29f5, 0x281c, 0x2d12, 0x30cf,
+    0x2f2f, 0x2862, 0xad8a, 0xb358, 0xb220, 0xa7f1, 0x2e2a, 0x3215, 0x3376,
+    0x3225, 0x3166, 0x284f, 0xaccf, 0xab52, 0xacda, 0xa8ed, 0xaa4e, 0xa34f,
+    0x2b70, 0x317c, 0x317b, 0x2c0b, 0xa649, 0xabf2, 0xaf75, 0xb43b, 0x24fe,
+    0x2ba9, 0x2f02, 0x30e4, 0x31b8, 0x31c7, 0x3009, 0x29ec, 0xa3b5, 0xa801,
+    0xa070, 0xa10c, 0xa8a9, 0xaad8, 0xabed, 0xa72d, 0x2ba7, 0x2e6a, 0x29a8,
+    0xaa32, 0xae7d, 0xad0c, 0xa859, 0xa501, 0xa23b, 0x22fb, 0x2ac2, 0x2cc1,
+    0x2967, 0xa454, 0xab12, 0xabeb, 0xa7c8, 0x1aec, 0x255f, 0x2be4, 0x2a28,
+    0x2c55, 0x3150, 0x2ddd, 0xaa9c, 0x2371, 0x3210, 0x30e4, 0xae07, 0xac0a,
+    0x2fa1, 0x3242, 0x2f19, 0xab23, 0xb3a7, 0xb724, 0xb648, 0xb0d3, 0xa60a,
+    0xaebc, 0xaea3, 0xaccf, 0xa9a4, 0xa014, 0x2738, 0x2a6f, 0x2781, 0xa1d5,
+    0xaa4b, 0xaba0, 0xa972, 0xa9a9, 0xab8d, 0xabe4, 0xac5e, 0xaacb, 0x2294,
+    0x29c7, 0x9f23, 0xadaf, 0xb00e, 0xad82, 0xa71d, 0xa121, 0xa045, 0x1969,
+    0x24aa, 0x2702, 0x21ed, 0xa4ff, 0xa89d, 0xa8a7, 0xa488, 0xa288, 0xa2dc,
+    0x28c9, 0x248d, 0x1c92, 0x2d88, 0x290c, 0xad60, 0xa63a, 0x305a, 0x2de8,
+    0xb12c, 0xafed, 0x2da8, 0x3284, 0x3084, 0xa7b7, 0xb335, 0xb6e4, 0xb62c,
+    0xb138, 0xac68, 0xb204, 0xb0c3, 0xb04f, 0xafb2, 0xae08, 0xaa7d, 0x9c0a,
+    0x2546, 0x27b3, 0x25c6, 0x226b, 0x1fe6, 0xa40e, 0xa70e, 0xa275, 0xa2c0,
+    0xa1b9, 0x28a2, 0x2b72, 0x96ed, 0xad58, 0xaebb, 0xa8bc, 0x29c7, 0x2c78,
+    0x2b7f, 0x28a8, 0x1ed9, 0xa253, 0xa3b9, 0xa431, 0xa22b, 0x9dfb, 0x1500,
+    0xa599, 0xa841, 0x29c7, 0x28fd, 0x960e, 0x2bf3, 0x2965, 0xaa88, 0x224f,
+    0x30e3, 0x2c8c, 0xb371, 0xb249, 0x2d35, 0x3415, 0x32d3, 0x2643, 0xb222,
+    0xb686, 0xb5ff, 0xb18e, 0xb030, 0xb4e2, 0xb115, 0xb0b5, 0xb06e, 0xafe5,
+    0xad36, 0xa5a0, 0x2867, 0x2ce6, 0x2d89, 0x2cfb, 0x2af9, 0x1fdb, 0x9ce6,
+    0x28bb, 0x2bcb, 0x2aff, 0x2c1e, 0x296c, 0xa9d5, 0xafda, 0xaf04, 0x9587,
+    0x2eb7, 0x304b, 0x2f47, 0x2c38, 0x9c5b, 0xaae1, 0xaaa8, 0xa770, 0x9e05,
+    0x20fc, 0x2415, 0xa208, 0xa358, 0x2d80, 0x2d64, 0x167b, 0x2717, 0x2892,
+    0xa1f8, 0x2d13, 0x32b1, 0x2c51, 0xb4f6, 0xb499, 0x2ce2, 0x3544, 0x34e6,
+    0x2daa, 0xb145, 0xb676, 0xb607, 0xb1f7, 0xb287, 0xb729, 0xb257, 0xb14c,
+    0xb080, 0xaf8a, 0xacdc, 0xa325, 0x2b20, 0x2f86, 0x3074, 0x3025, 0x2df9,
+    0x280a, 0x2555, 0x2e1d, 0x3114, 0x30c8, 0x2eb8, 0x25d4, 0xadef, 0xb0df,
+    0xadbe, 0x2c2c, 0x31fe, 0x327f, 0x3114, 0x2dc4, 0x17d9, 0xab0a, 0xa945,
+    0x974f, 0x278a, 0x2a3e, 0x2b27, 0x2786, 0x2720, 0x2fa5, 0x2e62, 0xa86d,
+    0xaada, 0xa427, 0x16ee, 0x3083, 0x3491, 0x2ee5, 0xb515, 0xb4e9, 0x303c,
+    0x376b, 0x3720, 0x3208, 0xaf58, 0xb632, 0xb5de, 0xb1ae, 0xb400, 0xb886,
+    0x2d87, 0x30c9, 0x32c7, 0x341f, 0x3482, 0x338e, 0x3159, 0x305f, 0x315c,
+    0x3100, 0x2ea1, 0x2a64, 0x9fd3, 0xa6fd, 0x9335, 0x9d59, 0xa6be, 0xa804,
+    0xa6f2, 0xa840, 0xa9b4, 0xa7f0, 0x23a7, 0x2822, 0x22f4, 0x21c3, 0x2aba,
+    0x308c, 0x3406, 0x34cf, 0x3443, 0x3261, 0x3019, 0x2c23, 0x25a6, 0x2648,
+    0x2bc3, 0x2f25, 0x308b, 0x3352, 0x3545, 0x35e4, 0x36c7, 0x366b, 0x34c1,
+    0x3381, 0x3293, 0x3155, 0x2e5a, 0x2a1c, 0x25f0, 0x2a7b, 0xa1ee, 0xab1d,
+    0x222a, 0x2cfa, 0xa97c, 0x225d, 0x2b38, 0x2da0, 0x2e8a, 0x2b6b, 0x9e80,
+    0xa5be, 0x2417, 0x24cf, 0x1023, 0x9e65, 0xa18f, 0x2078, 0x2943, 0x2890,
+    0x2524, 0x2635, 0x287f, 0x26d8, 0x1d2d, 0x23cb, 0x2b0e, 0x2afb, 0x217e,
+    0xa490, 0x9f3e, 0x2a18, 0x2fbb, 0x3069, 0x2cee, 0xa4a3, 0xaf94, 0xb2b6,
+    0xb468, 0xb4a0, 0xb40f, 0xb23c, 0xb0e8, 0xadd0, 0xa819, 0xa403, 0x28c4,
+    0x2968, 0x9e9a, 0xa339, 0x1fed, 0x2274, 0xa525, 0xa88a, 0xaa5e, 0xab3b,
+    0xb03f, 0xb0a3, 0xae4e, 0xad9d, 0xaf1a, 0xac70, 0xa8e4, 0xa479, 0x9f4a,
+    0xaa48, 0xaf9a, 0xb022, 0xacaa, 0xa902, 0xa565, 0x9d89, 0x1081, 0x25f4,
+    0x2bee, 0x2c8f, 0x2bf5, 0x2c21, 0x2c6f, 0x2b39, 0x2835, 0x29a4, 0x2d60,
+    0x2cf4, 0x2485, 0xa977, 0xad09, 0xacd0, 0xa9e5, 0xaadb, 0xb014, 0xb3db,
+    0xb618, 0xb821, 0xb8fd, 0xb95a, 0xb92a, 0xb8a1, 0xb81f, 0xb724, 0xb645,
+    0xb5d0, 0xb496, 0xb317, 0xb1d1, 0xb004, 0xacc7, 0xab4c, 0xabe6, 0xa827,
+    0xa57a, 0xa7fd, 0xad55, 0xae13, 0xadd5, 0xb044, 0xaef6, 0xac89, 0xa8ef,
+    0xa640, 0xa616, 0xacdc, 0xb12e, 0xb1b1, 0xaf03, 0xa99e, 0x2000, 0x267f,
+    0x1411, 0xa006, 0x268d, 0x2a1b, 0x28b6, 0x258a, 0x1f67, 0x9ecf, 0x9dd0,
+    0x288c, 0x2db9, 0x2ca5, 0xa498, 0xaf8f, 0xb231, 0xb2ff, 0xb2b7, 0xb32b,
+    0xb4c8, 0xb6d7, 0xb8b3, 0xba1e, 0xbb5a, 0xbc03, 0xbc04, 0xbb81, 0xbad2,
+    0xba1a, 0xb984, 0xb906, 0xb80c, 0xb5ad, 0xb2b9, 0xad63, 0xa479, 0xa4e1,
+    0xa86f, 0x25be, 0x2c57, 0x2d35, 0x2cd7, 0x2bd1, 0x1dc7, 0xadab, 0xa856,
+    0x18f1, 0x2950, 0x2c38, 0x2c7d, 0x1ea3, 0xae4c, 0xb067, 0xace3, 0x1fe3,
+    0x2d1e, 0x2daf, 0x230b, 0xab1e, 0xaa6e, 0xa4c0, 0xa67d, 0xabb7, 0xae4b,
+    0xaf10, 0xacae, 0x1eb0, 0x2cef, 0x2a5b, 0xac77, 0xb28b, 0xb4df, 0xb58f,
+    0xb584, 0xb5a2, 0xb6a5, 0xb85b, 0xb9c5, 0xbb65, 0xbc71, 0xbce7, 0xbcfc,
+    0xbcb9, 0xbc4e, 0xbbce, 0xbb1f, 0xba76, 0xb939, 0xb6ec, 0xb265, 0xa1d6,
+    0x2cd3, 0x2c15, 0x2572, 0x2dbe, 0x3124, 0x3260, 0x3370, 0x32ea, 0x2eff,
+    0xa7b8, 0x2c0f, 0x2c44, 0x2bb4, 0x2820, 0x9d1a, 0xa93f, 0xaca5, 0xaeaa,
+    0xb092, 0xb245, 0xb400, 0xb4d5, 0xb57a, 0xb5d7, 0xb5b6, 0xb4dd, 0xb338,
+    0xb0b4, 0xacb7, 0xa24a, 0x289b, 0x2d12, 0x2fc3, 0x30b4, 0x3066, 0x2d95,
+    0x230e, 0xaae9, 0xae13, 0xaf84, 0xb03d, 0xb0dd, 0xb1ef, 0xb2a6, 0xb1e6,
+    0xb0bd, 0xb00d, 0xaefc, 0xae57, 0xae0e, 0xacb8, 0xaa0f, 0xa940, 0xa525,
+    0x0f3a, 0x2c04, 0x30f7, 0x2ee4, 0xa442, 0xad26, 0xac5d, 0xacdf, 0xac14,
+    0xaded, 0xb42b, 0xb77b, 0x2e5f, 0x2e58, 0x2d5b, 0x2a1c, 0x9f81, 0xac3a,
+    0xaf4d, 0xb0e9, 0xb243, 0xb3e4, 0xb4c1, 0xb574, 0xb5f2, 0xb63d, 0xb624,
+    0xb576, 0xb47e, 0xb2fe, 0xb0d9, 0xada0, 0xa89e, 0x20be, 0x2ae3, 0x2d8b,
+    0x2de2, 0x2c16, 0x2398, 0xa817, 0xab77, 0xac5c, 0xac2a, 0xac0a, 0xacc4,
+    0xad65, 0xac74, 0xaacb, 0xaa54, 0xa94d, 0xa707, 0xa4c0, 0x9d18, 0x21c9,
+    0x20cc, 0x27c2, 0x2c23, 0x3028, 0x3272, 0x3051, 0x2221, 0xaba8, 0xab2c,
+    0xabe4, 0xabef, 0xada0, 0xb34b, 0xb6c8, 0x3172, 0x3152, 0x308f, 0x2d9a,
+    0x1c2e, 0xad6c, 0xb11c, 0xb307, 0xb466, 0xb546, 0xb5f7, 0xb668, 0xb6b9,
+    0xb6fc, 0xb6f1, 0xb66e, 0xb5b5, 0xb4e3, 0xb3b5, 0xb186, 0xaf33, 0xab85,
+    0x9cd3, 0x2955, 0x2c2e, 0x2bb6, 0x283c, 0x9663, 0xa674, 0xa835, 0xa550,
+    0x9d89, 0x1920, 0x20a1, 0x25e2, 0x256e, 0x1647, 0x15b3, 0x25b2, 0x283b,
+    0x299d, 0x2ab1, 0x29f2, 0x2c39, 0x2e67, 0x30f2, 0x325f, 0x2fce, 0x1ef5,
+    0xabf1, 0xac11, 0xac52, 0xad1e, 0xaec1, 0xb33a, 0xb696, 0x3488, 0x3471,
+    0x33e0, 0x3156, 0x2a45, 0xacd5, 0xb1d7, 0xb450, 0xb582, 0xb68c, 0xb72d,
+    0xb772, 0xb7ad, 0xb7f9, 0xb800, 0xb7a2, 0xb711, 0xb647, 0xb523, 0xb3c0,
+    0xb174, 0xaebc, 0xa8e9, 0x26d4, 0x2cc2, 0x2df0, 0x2d2a, 0x29e1, 0x2010,
+    0xa460, 0xa403, 0x9bb3, 0x2134, 0x2792, 0x2ab8, 0x2a74, 0x2556, 0x2526,
+    0x2b2a, 0x2ce9, 0x2dcb, 0x2e85, 0x2e32, 0x2e64, 0x2f29, 0x3086, 0x30e3,
+    0x2c8d, 0xa838, 0xae0d, 0xae1d, 0xae34, 0xafc4, 0xb0da, 0xb43a, 0xb71a,
+    0x371a, 0x36f1, 0x364c, 0x34b6, 0x30b4, 0xa30b, 0xb0fb, 0xb45e, 0xb5ff,
+    0xb756, 0xb80a, 0xb828, 0xb845, 0xb872, 0xb87b, 0xb84d, 0xb805, 0xb72d,
+    0xb5e8, 0xb478, 0xb225, 0xaef1, 0xa628, 0x2b50, 0x2fdf, 0x311f, 0x30f9,
+    0x2ecb, 0x27a4, 0xa8eb, 0xac6a, 0xaccc, 0xabe9, 0xa7f9, 0x16e2, 0x1fc7,
+    0xa38b, 0x988c, 0x2b49, 0x2da7, 0x2eae, 0x2f83, 0x2ef8, 0x2e25, 0x2d8c,
+    0x2dec, 0x2d39, 0x17ba, 0xae1b, 0xb0bd, 0xb081, 0xb082, 0xb180, 0xb2c8,
+    0xb538, 0xb7f9, 0x3243, 0x343d, 0x3593, 0x3676, 0x36e8, 0x364c, 0x35a2,
+    0x3519, 0x34c4, 0x3416, 0x33be, 0x343c, 0x342f, 0x325b, 0x303f, 0x2f12,
+    0x2f03, 0x2fd8, 0x2e24, 0xa224, 0xaf17, 0xb0c6, 0xb026, 0xaaf4, 0x2793,
+    0x2c62, 0x2937, 0xaab7, 0xb107, 0xb2c6, 0xb249, 0xb0c9, 0xae61, 0xaaf9,
+    0xa8fe, 0xa332, 0x2890, 0x2e9d, 0x2fa3, 0x2be6, 0x2eab, 0x2ffd, 0x253e,
+    0x2032, 0x212a, 0xac30, 0xad2c, 0xac0c, 0xada4, 0xac20, 0xaa72, 0x1c09,
+    0x2cb4, 0x2bf9, 0x2e48, 0x3247, 0x9d6c, 0x2d8c, 0x3185, 0x32c0, 0x3240,
+    0x3043, 0x2d7b, 0x2af2, 0x29af, 0x26d0, 0x283b, 0x2a82, 0x21fe, 0xad9c,
+    0xb0b9, 0xafdf, 0xac3d, 0xa0fa, 0x1101, 0xac21, 0xb00a, 0xb0a5, 0xb03b,
+    0xadb6, 0xa960, 0xa787, 0xac24, 0xb00c, 0xb18f, 0xb1b0, 0xb008, 0xac36,
+    0xa58b, 0x2309, 0x2485, 0x22dd, 0x2275, 0x28e5, 0x28cc, 0xa922, 0xa8da,
+    0xa794, 0xadc7, 0xac0f, 0xa57e, 0xa8eb, 0xa7ef, 0xa208, 0xa537, 0x1cd1,
+    0x21f4, 0x2842, 0x2c03, 0x2ca6, 0x2e43, 0x2f7a, 0xb437, 0xb15b, 0xada8,
+    0xacad, 0xaf78, 0xb199, 0xb288, 0xb2c6, 0xb2ca, 0xb33c, 0xb2a9, 0xb187,
+    0xb27c, 0xb4c5, 0xb56f, 0xb482, 0xb24b, 0xb003, 0xadb9, 0xaf15, 0xb027,
+    0xaf85, 0xae64, 0xadac, 0xada1, 0xae64, 0xaf9a, 0xaffa, 0xae54, 0xa9f8,
+    0x24e2, 0x2b0c, 0x2c23, 0x2cb1, 0x2aa0, 0x1c63, 0xaa28, 0xaa47, 0xa945,
+    0xaf11, 0xb03c, 0xafd3, 0xb037, 0xac9a, 0xa464, 0x1bd0, 0x28d7, 0x2b5b,
+    0x29f9, 0x2c48, 0x2d03, 0x2aa2, 0x281b, 0x2bf4, 0x2c16, 0xa1ee, 0xb52c,
+    0xb43f, 0xb298, 0xb271, 0xb370, 0xb412, 0xb3ad, 0xb2aa, 0xb1ef, 0xb200,
+    0xb11d, 0xaf79, 0xb06e, 0xb331, 0xb3d1, 0xb116, 0xacee, 0xa8e0, 0xa7b1,
+    0xaba5, 0xac3f, 0xa705, 0x1e8a, 0x15e6, 0xa854, 0xac0e, 0xaa9b, 0x21b6,
+    0x2eb3, 0x31c8, 0x32cb, 0x31a1, 0x2f11, 0x2c92, 0x278d, 0xa6ac, 0xacc3,
+    0xabff, 0xa9d2, 0xae6a, 0xb016, 0xaf29, 0xadce, 0xa861, 0x97b6, 0x2231,
+    0x2aec, 0x2c58, 0x2bb6, 0x2da4, 0x2ee9, 0x289a, 0xa9f5, 0xa57b, 0xa48e,
+    0xb0a3, 0x2cc2, 0x1c2a, 0xa481, 0xa8d7, 0xab8c, 0xa838, 0x28ed, 0x2fc5,
+    0x31c5, 0x322c, 0x328f, 0x32da, 0x3147, 0x2c27, 0x2a85, 0x310c, 0x340a,
+    0x3492, 0x3451, 0x3283, 0x315a, 0x3281, 0x33d5, 0x33a2, 0x3212, 0x3050,
+    0x2fea, 0x318a, 0x33d5, 0x3462, 0x334d, 0x2f20, 0x1907, 0xa6b7, 0xa7e1,
+    0xa849, 0xa432, 0x299e, 0x2cc4, 0x25d4, 0xa162, 0x1fa7, 0x2ac6, 0x2e5f,
+    0x2c02, 0x1e39, 0x25ba, 0x270b, 0x25a0, 0x29e8, 0x2ab8, 0xabbe, 0xb225,
+    0xb08d, 0xaf21, 0xb416, 0x2c79, 0xa553, 0xb025, 0xb271, 0xb267, 0xb06d,
+    0xab6d, 0x24ed, 0x2d81, 0x3084, 0x312c, 0x30e1, 0x3100, 0x30e0, 0x2cbe,
+    0xa9e4, 0xb01c, 0xb12e, 0xb17d, 0xb166, 0xaf6e, 0x29e4, 0x33ae, 0x356d,
+    0x3565, 0x349c, 0x33a7, 0x32ea, 0x32b1, 0x31cb, 0x2e6a, 0xa91a, 0xb28f,
+    0xb56d, 0xb68f, 0xb5f4, 0xb413, 0xb050, 0xab89, 0xa2d2, 0x2c5a, 0x303f,
+    0x2c4b, 0xa8c6, 0xac8b, 0xafca, 0xb0db, 0xaff6, 0x13ff, 0x2c91, 0x27a3,
+    0x287f, 0x1c56, 0xa732, 0x2f6e, 0x3439, 0x2cff, 0xa1ce, 0xafab, 0xb253,
+    0xb265, 0xb08d, 0xacc4, 0xa1c2, 0x2905, 0x2cc1, 0x2ce3, 0x2aee, 0x2ca4,
+    0x2fb0, 0x2e02, 0x9210, 0xad7f, 0xb04f, 0xb155, 0xb25f, 0xb243, 0xad3a,
+    0x2d6d, 0x317e, 0x3147, 0x3024, 0x2f7c, 0x3098, 0x3216, 0x3298, 0x3125,
+    0x29e4, 0xae79, 0xb388, 0xb520, 0xb4ac, 0xb24c, 0xaf58, 0xacae, 0xa9ee,
+    0x2871, 0x2f22, 0x2c03, 0xa4f5, 0xa902, 0xacab, 0xaf61, 0xaf24, 0xa2a4,
+    0x2a75, 0x24dd, 0x2891, 0x24ef, 0x1168, 0x2fee, 0x33fd, 0x2ec9, 0x25a0,
+    0xad7f, 0xb13b, 0xb156, 0xaf95, 0xabdb, 0x918e, 0x29c4, 0x2c1b, 0x28cc,
+    0xa1f0, 0x20d3, 0x2efb, 0x311d, 0x2faa, 0x29a0, 0xa859, 0xaf2a, 0xb244,
+    0xb3df, 0xb1de, 0xaa58, 0x27f0, 0x2813, 0x23c2, 0x28dd, 0x2ef4, 0x321f,
+    0x334f, 0x327b, 0x2ea9, 0xa699, 0xb0b5, 0xb33f, 0xb243, 0xafa4, 0xaccc,
+    0xac75, 0xac49, 0x19c9, 0x2cae, 0x27b5, 0xa820, 0xa680, 0xa275, 0xa98c,
+    0xac11, 0xa5d3, 0x22ed, 0xa50a, 0x1dbd, 0x24f3, 0x2492, 0x2f15, 0x32b7,
+    0x303c, 0x2adf, 0xaaf5, 0xb05c, 0xb0ad, 0xaee0, 0xab6e, 0x1b68, 0x2b0d,
+    0x2c91, 0x2722, 0xa8dd, 0xa131, 0x30a3, 0x3486, 0x34ef, 0x33af, 0x2f39,
+    0xa90b, 0xb1e9, 0xb462, 0xb369, 0xae65, 0xa142, 0x9e61, 0xa5ab, 0x21a8,
+    0x2ea1, 0x32ba, 0x3438, 0x33d2, 0x3088, 0x180d, 0xb018, 0xb289, 0xb172,
+    0xaf4c, 0xae4b, 0xaf0d, 0xafc5, 0xac47, 0x1d12, 0xa1d3, 0xa632, 0x25e3,
+    0x2ceb, 0x2c79, 0x26e7, 0xa108, 0xa6dd, 0xad8c, 0xac94, 0xa829, 0xa207,
+    0x2b97, 0x301d, 0x32b9, 0x3051, 0x26f0, 0xabc0, 0xad07, 0xaa78, 0xa251,
+    0x28b8, 0x2d6a, 0x2e8c, 0x2b54, 0xa094, 0x28aa, 0x3388, 0x3702, 0x380a,
+    0x3694, 0x327d, 0xa8b2, 0xb325, 0xb4c8, 0xb305, 0xaa70, 0x2bd4, 0x2c15,
+    0x287f, 0x2cc1, 0x326d, 0x35a1, 0x36e6, 0x368d, 0x347a, 0x2dcf, 0xaded,
+    0xb2ac, 0xb2ad, 0xb20c, 0xb230, 0xb27a, 0xb261, 0xb04d, 0xa9e2, 0xa53d,
+    0x28a1, 0x30a5, 0x3360, 0x336a, 0x312b, 0x28b3, 0xaa34, 0xb088, 0xb09a,
+    0xae1e, 0xac1d, 0xa076, 0x28a4, 0x3153, 0x3103, 0x3095, 0x301d, 0x3003,
+    0x2f52, 0x2ecb, 0x2f9c, 0x30ec, 0x30e5, 0x2dc6, 0xa14d, 0xae3d, 0xb05e,
+    0xb037, 0xaf21, 0xae0b, 0xab0a, 0x2c06, 0x339c, 0x359d, 0x34ef, 0x309a,
+    0xa981, 0xb210, 0xb47e, 0xb505, 0xb49d, 0xb2d2, 0xadb3, 0x2483, 0x2c2d,
+    0x30c7, 0x3451, 0x3614, 0x37dd, 0x3824, 0x372a, 0x3651, 0x357d, 0x32d7,
+    0x3020, 0x3023, 0x2ea8, 0x21dc, 0xb023, 0xb227, 0xb286, 0xb23f, 0xb045,
+    0xaffd, 0xb0b0, 0xb034, 0xad59, 0xb018, 0xb204, 0x3095, 0x3044, 0x2f68,
+    0x2dba, 0x2cd3, 0x2be6, 0x2a32, 0x2a00, 0x2c54, 0x2c41, 0x21fc, 0xac4b,
+    0xaf6b, 0xaf92, 0xae2b, 0xad48, 0xadfe, 0xadf9, 0xa59d, 0x2f2a, 0x32e5,
+    0x32ce, 0x2fb1, 0x8fd5, 0xaed7, 0xb1b4, 0xb2ac, 0xb229, 0xb068, 0xab7b,
+    0x9923, 0x092d, 0x26b1, 0x2ca9, 0x2f44, 0x3213, 0x331e, 0x31ec, 0x3198,
+    0x31d9, 0x2f21, 0x2cd4, 0x2f1e, 0x2fbf, 0x2e5e, 0x275e, 0xa212, 0xa34f,
+    0xa85a, 0xa469, 0xa81d, 0xad8c, 0xafb3, 0xac02, 0xacfe, 0xafb5, 0x2ec7,
+    0x2dd0, 0x2c0f, 0x257d, 0x9f0b, 0xa68a, 0xa941, 0xa98a, 0xa619, 0xa6c2,
+    0xad08, 0xb055, 0xb061, 0xadcf, 0xa9fd, 0xa9cc, 0xadfb, 0xb09a, 0xb00e,
+    0xa7fa, 0x2cd5, 0x3005, 0x2f2c, 0x2c04, 0x19a1, 0xa9cc, 0xaca5, 0xacca,
+    0xab59, 0xa531, 0x9c5b, 0xa903, 0xac4a, 0xae06, 0xb008, 0xae3b, 0xac39,
+    0xac9f, 0xaa9d, 0x9e75, 0xa4f6, 0x9c7b, 0x2a6b, 0x2c0d, 0x2e3f, 0x2f04,
+    0x2f4e, 0x3076, 0x2fda, 0x2f00, 0x2ad2, 0xa46c, 0xac3c, 0xa2d1, 0xa384,
+    0xa9c9, 0x2e15, 0x2c7c, 0x2579, 0xa8dd, 0xad06, 0xae44, 0xaf12, 0xaf0f,
+    0xadb0, 0xadb7, 0xb02e, 0xb123, 0xaf7c, 0xa5ed, 0x285d, 0x9836, 0xaf34,
+    0xb35c, 0xb468, 0xb2d6, 0xad5e, 0x2a83, 0x308d, 0x3164, 0x3076, 0x2e13,
+    0x2b3b, 0x2629, 0x9b73, 0x9b74, 0xa0a2, 0xac0a, 0xb020, 0xb295, 0xb480,
+    0xb4b6, 0xb478, 0xb442, 0xb2c2, 0xb059, 0xaf6c, 0xac85, 0x9f3f, 0x9e94,
+    0x2897, 0x2e57, 0x30e4, 0x333f, 0x3390, 0x32d7, 0x300b, 0x2bc3, 0x2617,
+    0x2a5e, 0x2839, 0x16d8, 0x32c0, 0x314d, 0x2daf, 0x209c, 0xa9c6, 0xacd3,
+    0xade8, 0xae1a, 0xac7e, 0xab98, 0xad65, 0xaddb, 0xa50a, 0x2e45, 0x30c5,
+    0x2b96, 0xb03c, 0xb546, 0xb6e9, 0xb61d, 0xb2a1, 0x254a, 0x32e5, 0x34fe,
+    0x34e6, 0x3417, 0x326f, 0x3060, 0x2ba5, 0x23bb, 0xa474, 0xad9e, 0xb1d9,
+    0xb4aa, 0xb62f, 0xb6d4, 0xb6ec, 0xb699, 0xb537, 0xb30b, 0xb1bc, 0xafa4,
+    0xab23, 0xace4, 0xab8b, 0x17b3, 0x2c6e, 0x31c7, 0x3337, 0x32ad, 0x2f32,
+    0x2c8b, 0x2c64, 0x2baf, 0x25d9, 0x97c7, 0x28c6, 0x25cc, 0x1f21, 0x9df3,
+    0x19f3, 0x2d23, 0x3123, 0x30d4, 0x2af9, 0x9ec2, 0xa3e4, 0xabda, 0xaf44,
+    0xae81, 0xa817, 0x2a15, 0x2b6c, 0x2081, 0xa44c, 0x233a, 0x2d4b, 0x2f85,
+    0x2deb, 0x2e66, 0x320f, 0x34cb, 0x3590, 0x3550, 0x341f, 0x2f21, 0xab7b,
+    0xb19d, 0xb37b, 0xb3a6, 0xb3b2, 0xb3c0, 0xb0b0, 0x2283, 0x3038, 0x3131,
+    0x3108, 0x3057, 0x3005, 0x302b, 0x3189, 0x30c9, 0x2e7f, 0x297d, 0xa56a,
+    0xabb4, 0xab65, 0xa617, 0xab58, 0xabf6, 0xa9bd, 0xae71, 0xa987, 0xab6a,
+    0xac4a, 0xac5b, 0xa997, 0x2990, 0x301e, 0x305c, 0x2b08, 0x9e8e, 0xa125,
+    0xa8f9, 0xade9, 0xae7c, 0xaab2, 0x248d, 0x278b, 0xa339, 0xa8f6, 0xa60b,
+    0x2201, 0x24c3, 0x9fa6, 0x253a, 0x3067, 0x346f, 0x3555, 0x349c, 0x3156,
+    0xa002, 0xb1de, 0xb450, 0xb441, 0xb2a2, 0xb10f, 0xb02b, 0xa9ad, 0x2cca,
+    0x310f, 0x3141, 0x300c, 0x2cbf, 0x296f, 0x25fe, 0x29b1, 0x28b2, 0x2657,
+    0x9dd1, 0xaa18, 0xabdb, 0xac1c, 0xaba0, 0xad2b, 0xac43, 0xabf9, 0xb0d3,
+    0xaea1, 0xaf45, 0xaf53, 0xae8a, 0xac1a, 0x27d1, 0x2fbf, 0x303b, 0x2b35,
+    0x1dab, 0x25ed, 0x2588, 0xa667, 0xaaf9, 0xa929, 0x93b3, 0x91cb, 0xa82c,
+    0xa8d5, 0xa6e4, 0xa71f, 0xaaca, 0xacab, 0xa25c, 0x3050, 0x34ab, 0x3575,
+    0x340d, 0x2c7b, 0xb0a2, 0xb52d, 0xb5dd, 0xb4b2, 0xb184, 0xac81, 0xa378,
+    0x2a59, 0x2ff0, 0x31d5, 0x31d0, 0x3029, 0x2a6c, 0x1be0, 0xa496, 0xa54c,
+    0xa883, 0xa631, 0xa4b2, 0xa815, 0xa380, 0x9c49, 0xa4cd, 0xa963, 0xa73e,
+    0xa999, 0xb143, 0xb0fe, 0xb0f6, 0xb0b6, 0xb045, 0xae22, 0x9d69, 0x2e2d,
+    0x3012, 0x2c70, 0x28f8, 0x2d32, 0x2eed, 0x2ccb, 0x28c6, 0x2670, 0x2621,
+    0xa19e, 0xa9c7, 0xa53a, 0x2160, 0x9ed7, 0xab10, 0xab75, 0x2b18, 0x3405,
+    0x36d5, 0x3745, 0x34e7, 0x2ab1, 0xb2b6, 0xb68d, 0xb702, 0xb54c, 0xb1ed,
+    0xac1a, 0x0c9f, 0x29e0, 0x2ddd, 0x3094, 0x318f, 0x3100, 0x2cd4, 0x26c5,
+    0x234e, 0xa889, 0xae64, 0xada9, 0xaa72, 0xa7e0, 0x2105, 0x2774, 0x1fe9,
+    0xa680, 0xa51c, 0xa975, 0xb18b, 0xb387, 0xb2d9, 0xb236, 0xb1bd, 0xb083,
+    0xaa26, 0x2ca9, 0x304b, 0x2eb1, 0x2e12, 0x311f, 0x32bf, 0x320e, 0x30a7,
+    0x2e85, 0x2a2c, 0xa921, 0xae12, 0xa9dd, 0x278b, 0x293d, 0x216d, 0x2b82,
+    0x343a, 0x386a, 0x3a3c, 0x3a67, 0x38ba, 0x33e9, 0xae4e, 0xb5ed, 0xb720,
+    0xb5ed, 0xb41e, 0xb0e7, 0xae22, 0xac01, 0xa735, 0x28b8, 0x2ff4, 0x314d,
+    0x2ecc, 0x2ca3, 0x2bdf, 0xab3a, 0xb259, 0xb246, 0xb04b, 0xaeae, 0xac48,
+    0xaae7, 0xac71, 0xae55, 0xad77, 0xae66, 0xb2f4, 0x2979, 0x2df3, 0x2e69,
+    0x2af7, 0xa766, 0xae1b, 0xae4d, 0xadc0, 0xae43, 0xaf87, 0xb0f1, 0xb233,
+    0xb220, 0xb101, 0xb008, 0xae09, 0xa99c, 0x2a69, 0x31b9, 0x34a7, 0x3563,
+    0x354e, 0x350e, 0x34f4, 0x347d, 0x3160, 0xa526, 0xb201, 0xb445, 0xb40b,
+    0xb316, 0xb270, 0xb1ac, 0xaef6, 0xa804, 0x2921, 0x2e9c, 0x317b, 0x33ca,
+    0x3305, 0x3178, 0x29ed, 0xac01, 0xad38, 0xac7a, 0xace9, 0xac80, 0xa816,
+    0x2ad6, 0x2d60, 0x9a1a, 0xa9f2, 0x2833, 0x3180, 0x30fa, 0xac5d, 0x2d87,
+    0x3006, 0x2fcc, 0x2c86, 0xa18b, 0xac9c, 0xac7a, 0xaa5d, 0xa9e0, 0xab3a,
+    0xadd4, 0xb076, 0xb0f5, 0xb093, 0xb0a4, 0xb16a, 0xb1ff, 0xb095, 0xa626,
+    0x2f8b, 0x32b9, 0x33ad, 0x33b5, 0x33e5, 0x33b0, 0x3121, 0x1cba, 0xb03f,
+    0xb1ec, 0xb163, 0xb119, 0xb159, 0xb10d, 0xaea7, 0xab30, 0xa25d, 0x27a6,
+    0x2c97, 0x2f77, 0x2ddd, 0x2b04, 0xa8df, 0xaf04, 0xae12, 0xac85, 0xad91,
+    0xad55, 0xab4a, 0x2406, 0x2c97, 0x299c, 0x235b, 0x2b7d, 0x3123, 0x2f5f,
+    0xaf6d, 0x3184, 0x3251, 0x31c1, 0x2fe4, 0x29ce, 0x19de, 0x2656, 0x2c06,
+    0x2cf8, 0x2d02, 0x2a0e, 0xa069, 0xa8fd, 0xaad0, 0xae8f, 0xb236, 0xb484,
+    0xb4a5, 0xb20b, 0xa713, 0x2ec1, 0x3193, 0x3234, 0x3297, 0x3304, 0x31d2,
+    0x2cf4, 0xa544, 0xaba8, 0xab58, 0xad2b, 0xb006, 0xb022, 0xace3, 0xa93f,
+    0x9ad7, 0x2872, 0x29fe, 0x29cf, 0x141c, 0xa933, 0xaf21, 0xb0dc, 0xaf53,
+    0xad5e, 0xafa8, 0xaf71, 0xad79, 0x1455, 0x2e4e, 0x2ff0, 0x2e0e, 0x2da4,
+    0x3070, 0x2c1c, 0xb1a6, 0x329f, 0x3340, 0x3224, 0x2f59, 0x26f1, 0xa118,
+    0x295e, 0x2f92, 0x30fc, 0x316d, 0x30bd, 0x2e0d, 0x2b37, 0x2565, 0xac48,
+    0xb2d5, 0xb5c6, 0xb6a4, 0xb562, 0xb16e, 0x9fbb, 0x2e4a, 0x309b, 0x3168,
+    0x3251, 0x31f7, 0x2f88, 0x2b5d, 0x29db, 0x2aaf, 0x2112, 0xac1e, 0xad3c,
+    0xa613, 0x25ec, 0x2cab, 0x2eff, 0x2d5e, 0x257b, 0xaa23, 0xadca, 0xb065,
+    0xb0a4, 0xae51, 0xad51, 0xb0db, 0xb102, 0xaec2, 0x20a2, 0x306c, 0x31ff,
+    0x3041, 0x2c46, 0x2cd3, 0x9f32, 0xb3ec, 0x32b6, 0x33bd, 0x327b, 0x2e6c,
+    0xa522, 0xacc6, 0xa4c5, 0x2d5b, 0x30a3, 0x314a, 0x30b1, 0x2e02, 0x2954,
+    0xa645, 0xb0d8, 0xb568, 0xb832, 0xb8eb, 0xb879, 0xb64b, 0xb264, 0xa921,
+    0x2b44, 0x2f85, 0x3168, 0x3194, 0x3002, 0x2dd9, 0x2e95, 0x2fd1, 0x2cfc,
+    0xa139, 0xa9ca, 0x1c15, 0x2a80, 0x2e8a, 0x3035, 0x2ce7, 0xa5a9, 0xae86,
+    0xb0b0, 0xb214, 0xb1c2, 0xb018, 0xb03d, 0xb3cc, 0xb467, 0xb29d, 0xabbd,
+    0x2d5a, 0x303f, 0x29d1, 0xac8e, 0xacdd, 0xb026, 0xb5ab, 0xb873, 0xb771,
+    0xb5bb, 0xb444, 0xb31d, 0xb43b, 0xb533, 0xb550, 0xb3e2, 0xb053, 0xadbe,
+    0xad4a, 0xabe1, 0xa80d, 0x19e1, 0x2a06, 0x30c0, 0x3485, 0x35c8, 0x363d,
+    0x36a2, 0x36ab, 0x353d, 0x3019, 0xaf3b, 0xb4a6, 0xb5f1, 0xb615, 0xb551,
+    0xb459, 0xb3ad, 0xb2e0, 0xb1b5, 0xafb7, 0xa463, 0x2d45, 0x2ef9, 0x2e07,
+    0x2a71, 0xa8a6, 0xaafb, 0x158f, 0xa457, 0xb094, 0xb32d, 0xaffa, 0xa848,
+    0x25a4, 0x2d47, 0x300a, 0x30cb, 0x347a, 0x35bc, 0x334e, 0x30a2, 0x2ef1,
+    0xb6a6, 0xb527, 0xb28f, 0xae95, 0xaa17, 0xad14, 0xb046, 0xb082, 0xacc9,
+    0x19bf, 0x26da, 0x2313, 0x8c32, 0x9ffa, 0x2141, 0x2c16, 0x3187, 0x3472,
+    0x34bf, 0x3461, 0x3496, 0x3529, 0x34bd, 0x3127, 0xa7ca, 0xb1c7, 0xb3e3,
+    0xb3c5, 0xb23b, 0xb0d7, 0xb071, 0xb019, 0xaeaf, 0xac67, 0x1e17, 0x2cf2,
+    0x2da1, 0x2c62, 0x2441, 0xad56, 0xaf93, 0xaaec, 0xa8fe, 0xaf5d, 0xb173,
+    0xadf3, 0xa82c, 0x1fda, 0x272d, 0x2900, 0x2bd3, 0x30fa, 0x32c5, 0x304b,
+    0x2c9a, 0x294d, 0xb4aa, 0xb1d8, 0xa9ac, 0x2d1c, 0x30ab, 0x2f5c, 0x2c21,
+    0x2bce, 0x2e99, 0x3047, 0x2fea, 0x2d78, 0x283c, 0xa105, 0x9905, 0x2c11,
+    0x31d4, 0x3438, 0x32ff, 0x3014, 0x2f0c, 0x31ac, 0x3358, 0x320f, 0x2cc1,
+    0xaa61, 0xb01d, 0xb08e, 0xaefe, 0xacc2, 0xabba, 0xa9c5, 0xa6bd, 0x9dbd,
+    0x2993, 0x2d21, 0x2c0e, 0x26cb, 0xa6bf, 0xaef6, 0xb0cf, 0xaefb, 0xadea,
+    0xaf5d, 0xaf62, 0xa7a4, 0x1da2, 0x1e43, 0x1e6a, 0x2022, 0x27b9, 0x2d1c,
+    0x2d68, 0x26c6, 0x9cc0, 0xa19f, 0xb3c9, 0xaee9, 0x2af3, 0x3214, 0x341e,
+    0x3351, 0x3180, 0x30d6, 0x3140, 0x30f1, 0x2fa7, 0x2cfa, 0x221e, 0xabac,
+    0xac88, 0x1e69, 0x30c8, 0x3390, 0x312a, 0x24b5, 0xa981, 0x25c4, 0x3032,
+    0x31cd, 0x309e, 0x2b1d, 0xa73b, 0xac4e, 0xabd5, 0xa8f8, 0xa272, 0x2439,
+    0x2844, 0x2913, 0x2c25, 0x2d50, 0x2bf2, 0x245b, 0xa9b9, 0xaf81, 0xb139,
+    0xb135, 0xb11a, 0xb007, 0xab4e, 0x2a81, 0x2bc7, 0x255e, 0x1f79, 0x18e0,
+    0x280b, 0x2b72, 0x207f, 0xabf0, 0xab66, 0xa763, 0xb53f, 0xb0ff, 0x28e2,
+    0x3227, 0x3440, 0x33b6, 0x317c, 0x3018, 0x2fe4, 0x2eab, 0x2c5c, 0x2814,
+    0xa7d2, 0xae82, 0xae19, 0x2577, 0x328f, 0x3516, 0x33bc, 0x2bc7, 0xab2b,
+    0xa70d, 0x2dc9, 0x3228, 0x32ef, 0x3162, 0x2e17, 0x293c, 0x2425, 0x26ca,
+    0x2b64, 0x2d52, 0x2da9, 0x2dcf, 0x2fb1, 0x30f1, 0x30ab, 0x2df6, 0x2502,
+    0xa9aa, 0xad46, 0xafc0, 0xb14b, 0xb020, 0xa8ec, 0x2bb4, 0x268b, 0xab75,
+    0xabd0, 0xab96, 0xa7f9, 0xa08f, 0xad8d, 0xb170, 0xafcb, 0xa9e6, 0x2f5a,
+    0xa949, 0xb34a, 0xb55d, 0xb563, 0xb393, 0xacf8, 0x27d2, 0x2c77, 0x2f26,
+    0x314b, 0x311e, 0x2ef8, 0x2ecf, 0x31ca, 0x34f9, 0x370f, 0x36ff, 0x33ac,
+    0xacdd, 0xb615, 0xb818, 0xb740, 0xb4f0, 0xb0bc, 0xabe9, 0xadc5, 0xb169,
+    0xb2b1, 0xb13e, 0xac4e, 0x2481, 0x2f54, 0x30f6, 0x2d14, 0x2481, 0x20c4,
+    0x9d83, 0xa1ca, 0x2bcb, 0x2d61, 0x296e, 0x1db1, 0x2802, 0x2720, 0xa8c5,
+    0xa970, 0xa4af, 0xa044, 0x2880, 0x2d87, 0x2bff, 0x294d, 0x2e17, 0x2927,
+    0xb01e, 0x32b1, 0x29e5, 0xb0d2, 0xb45e, 0xb4a0, 0xb272, 0xaca7, 0x96e8,
+    0x1f65, 0x2769, 0x2d25, 0x2d6c, 0x28a9, 0x25d7, 0x2cbe, 0x31bf, 0x3500,
+    0x361c, 0x3551, 0x3144, 0xad17, 0xb41c, 0xb4a5, 0xb2d3, 0xac97, 0x2802,
+    0x26bb, 0xa9d7, 0xae0e, 0xad2a, 0xa83d, 0xa019, 0x2759, 0x29db, 0xa16b,
+    0xaa20, 0xaab4, 0xac1c, 0xac54, 0x98ab, 0x2658, 0x9d59, 0xa86a, 0xa4cc,
+    0xa603, 0xac16, 0xab8e, 0xa684, 0xa646, 0x1fd7, 0x2c41, 0x25c4, 0xa665,
+    0x298b, 0x247a, 0xb013, 0x3515, 0x3078, 0xace7, 0xb2e7, 0xb3a2, 0xb132,
+    0xab7a, 0xa4c9, 0xa85f, 0xa5fb, 0x2574, 0x2674, 0xa67a, 0xab3d, 0xa8b0,
+    0x24d7, 0x2f25, 0x333f, 0x3568, 0x35d5, 0x33b0, 0x29a6, 0xaf81, 0xb1aa,
+    0xaeb3, 0x1da4, 0x29e0, 0x2317, 0xa5eb, 0xa91a, 0xa9af, 0xac6a, 0xab97,
+    0xa733, 0xa8aa, 0xa846, 0xa87d, 0xabfb, 0xacbc, 0xa4fe, 0x1fa1, 0xa436,
+    0xa9eb, 0xa99a, 0xab9e, 0xacc4, 0xab3e, 0xa180, 0xa46b, 0x2012, 0x2b75,
+    0x1a26, 0xab63, 0x25d1, 0x23ce, 0xafa8, 0x37de, 0x3491, 0x2865, 0xb03a,
+    0xb191, 0xaf79, 0xa870, 0xa46a, 0xaad1, 0xaa85, 0xa1e0, 0xa40f, 0xad44,
+    0xb09a, 0xb18e, 0xb250, 0xb20b, 0xaccf, 0x318e, 0x36e1, 0x3818, 0x362e,
+    0x3095, 0xab71, 0xae0f, 0xa605, 0x2929, 0x2a26, 0x25fa, 0xa22f, 0xa9c4,
+    0xad19, 0xab9e, 0x15e5, 0x2800, 0x2a70, 0x28d2, 0xa4b1, 0xabbe, 0xa534,
+    0x245e, 0x2118, 0x1cf9, 0x23cb, 0x9bff, 0x9f46, 0x995d, 0x2056, 0xa4f8,
+    0x242f, 0x2b5c, 0x1262, 0xac06, 0x243f, 0x200b, 0xb07b, 0x392d, 0x367e,
+    0x2f84, 0xad02, 0xb08d, 0xaec1, 0xa96b, 0xa9bc, 0xaeed, 0xb04f, 0xb022,
+    0xb194, 0xb471, 0xb608, 0xb747, 0xb878, 0xb940, 0xb8bb, 0xb408, 0x333e,
+    0x388d, 0x38e7, 0x3621, 0x2df6, 0xa9e3, 0xa704, 0x2bb6, 0x304a, 0x3122,
+    0x3009, 0x2ce6, 0x28fd, 0x2c0e, 0x3029, 0x30df, 0x3054, 0x2ce8, 0xa65d,
+    0xaea3, 0xad2e, 0xa861, 0xa7b0, 0xa2ff, 0x2541, 0x2178, 0xa026, 0xa88b,
+    0xab97, 0xaeb3, 0xa82f, 0x27fc, 0xa80a, 0xaf3c, 0xa99d, 0xab46, 0xb310,
+    0xb235, 0xaca3, 0x2c5f, 0x30e6, 0x3111, 0x2fae, 0x2e22, 0x2fca, 0x317d,
+    0x31ad, 0x3104, 0x3120, 0x31f1, 0x32c2, 0x3334, 0x3216, 0x2d1e, 0xa970,
+    0xaf12, 0xb071, 0xb0ba, 0xaff1, 0xad07, 0xa5bb, 0x2abf, 0x305e, 0x3150,
+    0x2d70, 0xab3f, 0xb110, 0xb203, 0xb038, 0xa992, 0x2796, 0x2bf6, 0x2a11,
+    0x2a21, 0x2e71, 0x306e, 0x309e, 0x2e84, 0x2396, 0xab27, 0xaccb, 0xad50,
+    0xaeac, 0xad0d, 0xa870, 0x9ec9, 0x2cc8, 0x30e7, 0x3150, 0x33a5, 0x32dc,
+    0x332d, 0x35f0, 0xb18d, 0xabc0, 0x2c2f, 0x307e, 0x307f, 0x2ea1, 0x2d7a,
+    0x2ee0, 0x305c, 0x3002, 0x2dc8, 0x2cb2, 0x2d2c, 0x2ebc, 0x3073, 0x3032,
+    0x2a73, 0xa8fd, 0xac92, 0xac76, 0xac13, 0xa9ed, 0xa43e, 0x278a, 0x2def,
+    0x30fd, 0x3190, 0x2f2e, 0x208b, 0xab93, 0xac52, 0x9529, 0x2d50, 0x3061,
+    0x30a3, 0x2e3f, 0x2c1e, 0x2dee, 0x3039, 0x315d, 0x3183, 0x3054, 0x2eeb,
+    0x2e48, 0x2a3a, 0xa3ff, 0x99ab, 0x1ea9, 0xa65e, 0x9d08, 0x2b23, 0x2cff,
+    0x30dd, 0x3061, 0x30eb, 0x34a2, 0xb0a2, 0xa908, 0x2c9f, 0x3017, 0x2f6a,
+    0x2c88, 0x28b6, 0x275e, 0x23cc, 0xa79d, 0xad89, 0xb013, 0xb090, 0xafc7,
+    0xabf5, 0xa46c, 0xa5e1, 0xa811, 0x9c35, 0x2588, 0x246e, 0x9de5, 0xa800,
+    0xa7d0, 0x14c9, 0x292a, 0x2a80, 0x2277, 0xaa07, 0xace7, 0xac0a, 0x1c08,
+    0x2d12, 0x2ff1, 0x2fef, 0x2bbb, 0x028e, 0x9c7d, 0x2521, 0x2c6c, 0x2e89,
+    0x2e59, 0x2f4a, 0x3055, 0x2e22, 0x2822, 0x29ca, 0x277d, 0xa8ea, 0xaca1,
+    0xac03, 0xac42, 0x1cb1, 0x205e, 0x251e, 0x2f83, 0xad3a, 0x265b, 0x3060,
+    0x31be, 0x30d9, 0x2cfd, 0x12d3, 0xac68, 0xb10c, 0xb456, 0xb5ef, 0xb6f2,
+    0xb770, 0xb70e, 0xb58e, 0xb355, 0xb02f, 0xa825, 0x2cd4, 0x304b, 0x2ecf,
+    0x211a, 0xaec1, 0xb1aa, 0xb1fa, 0xb15a, 0xb111, 0xb1b1, 0xb2a0, 0xb2b3,
+    0xb1d2, 0xaf9f, 0xa9f4, 0x1fe7, 0x257c, 0xa85f, 0xae9d, 0xb047, 0xb07a,
+    0xaebe, 0xacb5, 0xace7, 0xaab8, 0xa04b, 0x19bb, 0x209a, 0x2c12, 0x2bca,
+    0x1f0f, 0xa84a, 0xab34, 0xaf2d, 0xac6e, 0xac96, 0xaf4d, 0xad87, 0xb195,
+    0xa543, 0x3053, 0x326c, 0x31bc, 0x2da5, 0xa7a3, 0xb109, 0xb51a, 0xb815,
+    0xb959, 0xba19, 0xba65, 0xba1f, 0xb914, 0xb72b, 0xb407, 0xaaa3, 0x3047,
+    0x3346, 0x3198, 0x156e, 0xb281, 0xb55e, 0xb5f3, 0xb5c7, 0xb597, 0xb5b3,
+    0xb5e5, 0xb5ad, 0xb518, 0xb40f, 0xb19d, 0xaec8, 0xad05, 0xafef, 0xb202,
+    0xb32d, 0xb406, 0xb38d, 0xb309, 0xb3e7, 0xb3db, 0xb256, 0xb005, 0xa86e,
+    0x2cc9, 0x2f8f, 0x302e, 0x30b3, 0x3053, 0x2678, 0x1c92, 0xaa8a, 0xb189,
+    0xb35b, 0xb4f2, 0xb21c, 0xa853, 0x2f0a, 0x3225, 0x31c4, 0x30b1, 0x2f7a,
+    0x2d94, 0x28a8, 0x9d97, 0xaa04, 0xad60, 0xada7, 0xacc0, 0xa6ee, 0x28f0,
+    0x28c1, 0x178e, 0xaae6, 0xb02a, 0xb038, 0xaa87, 0xa044, 0x24d8, 0x2c86,
+    0x2ff9, 0x30e7, 0x30db, 0x2df3, 0x2d11, 0x2cc0, 0x2d59, 0x2e7e, 0x2f9b,
+    0x2ea7, 0x2f2e, 0x30ca, 0x306b, 0x27fb, 0xa578, 0xa8ff, 0xb04c, 0xb15d,
+    0xb247, 0xb0c6, 0xad99, 0xa929, 0xabaa, 0xb071, 0xaf8d, 0xadad, 0xb037,
+    0xac1b, 0xa998, 0xaff8, 0xb433, 0xb0ce, 0x23fb, 0x3130, 0x3335, 0x32bc,
+    0x3152, 0x3086, 0x3030, 0x2e6d, 0x2c4a, 0x285d, 0x259f, 0x2805, 0x27f3,
+    0x283a, 0x2d08, 0x2e4d, 0x2ea2, 0x2d19, 0x25ba, 0x23b3, 0x2a9b, 0x2842,
+    0x8c5c, 0x114b, 0x202f, 0xa261, 0xa88b, 0xabe1, 0xa7ef, 0x9203, 0x273d,
+    0x2878, 0x29da, 0x2947, 0x29bb, 0x2b6d, 0x29af, 0xa89a, 0xab17, 0xa332,
+    0xa3ab, 0x22ae, 0x1bf2, 0x263f, 0x24b0, 0x2437, 0x235e, 0x9cf0, 0x2801,
+    0x2977, 0xa56c, 0x1e8c, 0x2731, 0xaa26, 0xb4ee, 0xb3b3, 0xaf58, 0x1fae,
+    0x2c57, 0x2d0e, 0x2c3a, 0x2d44, 0x300e, 0x30c8, 0x306e, 0x2f0a, 0x2edc,
+    0x2f90, 0x2d10, 0x27df, 0x2c3a, 0x2f11, 0x30bb, 0x30c9, 0x2e9c, 0x2dce,
+    0x2f67, 0x2d9f, 0x28fb, 0x2505, 0x20d3, 0xa73e, 0xac5b, 0xad57, 0xa87d,
+    0x2568, 0x2bf4, 0x29be, 0x24c0, 0x1d4e, 0xa5f6, 0xab74, 0xac68, 0xafae,
+    0xaf08, 0xa7a4, 0x2944, 0x2fbd, 0x3002, 0x308c, 0x2e9b, 0x2e19, 0x2ce5,
+    0x2d2c, 0x310e, 0x30ee, 0x2c8b, 0x2e72, 0x3005, 0x28c5, 0xb577, 0xb647,
+    0xb639, 0xb57e, 0xb4ed, 0xb47f, 0xb405, 0xb220, 0xaf00, 0xa815, 0x08da,
+    0xa435, 0xa5dc, 0xa5e8, 0xada8, 0xb0ce, 0xaf06, 0xa93d, 0x249a, 0x2776,
+    0xa40f, 0xa952, 0xa895, 0xac8c, 0xaf49, 0xaeff, 0xad58, 0xae1f, 0xafea,
+    0xb04d, 0xada4, 0xa66d, 0x91cd, 0xacbf, 0xb128, 0xb1ff, 0xb2b7, 0xb3dc,
+    0xb366, 0xb352, 0xb1d7, 0xad60, 0x2900, 0x306e, 0x3031, 0x3004, 0x2bd0,
+    0x293f, 0x1cd7, 0x1a7c, 0x2de5, 0x2a27, 0xa854, 0x2a1d, 0x2f86, 0x241a,
+    0x3cc2, 0x393b, 0x3249, 0xae0c, 0xb45f, 0xb553, 0xb513, 0xb3fc, 0xb154,
+    0xabf7, 0x1818, 0x95cc, 0x9d69, 0x1da8, 0xa8ce, 0xace0, 0xa889, 0x1d9a,
+    0x260a, 0x8bbc, 0xaacb, 0xac78, 0xac6e, 0xaebe, 0xafcd, 0xac8e, 0x20f2,
+    0x289d, 0x2866, 0x155f, 0x1b2d, 0x2a8d, 0x2ae6, 0xaac4, 0xb068, 0xaf85,
+    0xac40, 0xa064, 0x2f62, 0x31e4, 0x333e, 0x3473, 0x3532, 0x352c, 0x327f,
+    0x2ec0, 0x9e78, 0xa8d2, 0xae45, 0xae7a, 0xa018, 0xace6, 0xb18a, 0xaa37,
+    0x2b54, 0xac0c, 0xb67c, 0xb556, 0xb255, 0xa584, 0x30b0, 0x32ae, 0x315e,
+    0x2eab, 0x2d09, 0x2e26, 0x30bf, 0x3291, 0x32d9, 0x30d6, 0x2f4c, 0x3273,
+    0x35c1, 0x3707, 0x363d, 0x34aa, 0x32fb, 0x3059, 0xa374, 0xb306, 0xb619,
+    0xb683, 0xb4b4, 0xb05a, 0xa596, 0x2902, 0x2c76, 0x2c0e, 0x263c, 0x22c3,
+    0x2950, 0x29c8, 0x208e, 0x28b1, 0x2f42, 0x2f5e, 0x31a3, 0x318a, 0x2ccb,
+    0x2272, 0xa138, 0xac9d, 0xac24, 0xa54d, 0x25a3, 0x2fd3, 0x2f2d, 0x2de4,
+    0x2d07, 0x9c85, 0xadaf, 0xacb9, 0xb5e8, 0xb4c2, 0xb173, 0xa01e, 0x308f,
+    0x326c, 0x30ea, 0x2c8e, 0x2588, 0x257d, 0x2b7c, 0x2e04, 0x2d3c, 0x1c4e,
+    0xa9c2, 0x2572, 0x30b7, 0x3260, 0x30a2, 0x2b25, 0xa43a, 0xaeb3, 0xb3f9,
+    0xb6d7, 0xb868, 0xb858, 0xb677, 0xb2f3, 0xac4d, 0x24bc, 0x2a4c, 0x2761,
+    0xa44c, 0xa724, 0x9e94, 0xa40d, 0xab84, 0xaa9e, 0x1429, 0xa4e1, 0x266b,
+    0x2963, 0x20f7, 0x23d4, 0x25c1, 0xa8dd, 0xa5df, 0x23db, 0x2509, 0x2df0,
+    0x2d71, 0x2c96, 0x2c72, 0x2836, 0xa2bf, 0x2025, 0xb49c, 0xb321, 0xaf21,
+    0x27bb, 0x3151, 0x3302, 0x3185, 0x2d5a, 0x24c2, 0x1bde, 0x276e, 0x2a7f,
+    0x261e, 0xac14, 0xafe8, 0xad4b, 0x04a7, 0x1c60, 0xad1f, 0xb1c0, 0xb42d,
+    0xb5b5, 0xb7db, 0xb910, 0xb9b3, 0xb95e, 0xb80a, 0xb47b, 0xad19, 0x297a,
+    0x2d1d, 0x2a71, 0x94c3, 0xa372, 0x193e, 0xa07e, 0xa9e6, 0xab99, 0xa85b,
+    0xac08, 0xa8f5, 0xa30a, 0x15c6, 0x2a11, 0x2c8d, 0x1f98, 0x2511, 0x2a33,
+    0x9e7a, 0x2710, 0x287e, 0x28d1, 0x2c46, 0x2d26, 0x2bd4, 0x2e06, 0xb328,
+    0xb161, 0xac65, 0x2ba9, 0x31ff, 0x33d6, 0x32b2, 0x2fa7, 0x2a74, 0x2858,
+    0x2bc5, 0x2d46, 0x2952, 0xac70, 0xb0fa, 0xb097, 0xadc8, 0xaf6d, 0xb35c,
+    0xb5ae, 0xb753, 0xb881, 0xb976, 0xba56, 0xbab2, 0xba22, 0xb891, 0xb4e0,
+    0xaaa9, 0x2f1d, 0x3125, 0x2fca, 0x2b6b, 0x2833, 0x2931, 0x2894, 0x2433,
+    0xa059, 0x9ff7, 0xa84b, 0xa651, 0xa1be, 0x2130, 0x2b37, 0x2c42, 0xa388,
+    0x9602, 0x2881, 0xaadb, 0xa9de, 0xa53b, 0x9791, 0x2b8e, 0x2fd0, 0x2f8f,
+    0x3161, 0xaef8, 0xac8b, 0x2055, 0x3009, 0x33f4, 0x3521, 0x34e3, 0x3300,
+    0x30d7, 0x30a3, 0x31c1, 0x3251, 0x302f, 0xa30a, 0xb006, 0xb02a, 0xadb7,
+    0xb046, 0xb472, 0xb6fa, 0xb889, 0xb97a, 0xba5f, 0xbb14, 0xbb39, 0xba6b,
+    0xb893, 0xb441, 0x2778, 0x3310, 0x347f, 0x33a9, 0x315c, 0x3010, 0x2fa6,
+    0x2f60, 0x2ec7, 0x2d03, 0x2c31, 0x29ac, 0x2a0f, 0x29b7, 0x2965, 0x2a43,
+    0x24cb, 0xad2b, 0xaa9a, 0x1f0f, 0xad5a, 0xad4b, 0xa9cf, 0xa372, 0x2c59,
+    0x3164, 0x318e, 0x3388, 0xafc4, 0xb065, 0xb15a, 0xb2a6, 0xb3b8, 0xb3cd,
+    0xb1f9, 0xaced, 0xa5f6, 0xa428, 0x2435, 0x2912, 0x244a, 0xa441, 0xa72a,
+    0x223a, 0x2f2d, 0x33e1, 0x35fb, 0x3798, 0x37c0, 0x35a1, 0x2f42, 0xb017,
+    0xb44e, 0xb415, 0xb06f, 0xa655, 0x0db8, 0xae53, 0xb2fc, 0xb50b, 0xb5b9,
+    0xb44e, 0xafb5, 0xa5e4, 0x2ce5, 0x31d1, 0x3119, 0x2e85, 0x2828, 0x21a8,
+    0xab7f, 0xa9a7, 0xa716, 0xaa7e, 0x2442, 0x2ca8, 0xa8c6, 0xad73, 0xaa88,
+    0xa915, 0xa607, 0x1965, 0x9f69, 0xa8b0, 0xa477, 0xa88c, 0xacad, 0xb00e,
+    0xb169, 0xb1ad, 0xb023, 0xa85f, 0x2263, 0x244f, 0x2847, 0x2930, 0x256d,
+    0x2798, 0x2c32, 0x2e9b, 0x3020, 0x30e0, 0x31d4, 0x3375, 0x344e, 0x33a3,
+    0x302b, 0xa835, 0xb1df, 0xb341, 0xb10d, 0xa9c5, 0x28f0, 0x263c, 0xa600,
+    0xadb4, 0xb07e, 0xae9c, 0xa94b, 0xa600, 0x2805, 0x2ffd, 0x2fed, 0x2def,
+    0x2b77, 0x2be3, 0xa470, 0xa403, 0x2126, 0xa04d, 0x2852, 0x2aeb, 0xa6be,
+    0xa8e3, 0x9b98, 0xa41f, 0xa66d, 0xa42f, 0x975f, 0xa6e1, 0x24e3, 0x1fbb,
+    0xa618, 0xad9c, 0xb086, 0xb117, 0xafcf, 0xa8e3, 0x2025, 0x230b, 0x2348,
+    0x1c92, 0x9d41, 0x29cc, 0x305e, 0x320d, 0x30b4, 0x2ade, 0xa757, 0xaa08,
+    0x2374, 0x2f72, 0x31c0, 0x2fb5, 0xaa04, 0xb1fc, 0xb304, 0xb11f, 0xab3e,
+    0x1389, 0x2710, 0x2037, 0xa7e5, 0xa48c, 0xa1ce, 0xa893, 0x148f, 0x2d52,
+    0x2eba, 0x2de7, 0x2cf0, 0x2d36, 0xa2cb, 0xa67a, 0x1edd, 0xa61b, 0xa453,
+    0x2069, 0xa4cc, 0xa053, 0x243a, 0xa18f, 0xa6cf, 0xa140, 0x284c, 0xa072,
+    0x31df, 0x3128, 0x2fd6, 0x29da, 0xa863, 0xad57, 0xac1e, 0x2124, 0x2aba,
+    0x2a3f, 0x24d9, 0xa3ca, 0xa728, 0x2610, 0x3015, 0x31d6, 0x2d98, 0xaefa,
+    0xb4e4, 0xb668, 0xb4f7, 0xa943, 0x343e, 0x3661, 0x347a, 0x2a96, 0xb03e,
+    0xb2c0, 0xb189, 0xae4a, 0xa3f0, 0x25a6, 0x248a, 0x28b9, 0x263e, 0xa668,
+    0xa478, 0x274f, 0x2b1d, 0x2baa, 0x2bb4, 0x2bf5, 0xa0d5, 0x9d2e, 0x28a0,
+    0xa430, 0xaa28, 0xa574, 0x9d90, 0x20c5, 0x2460, 0x1f83, 0x1ab2, 0x1fa0,
+    0x2a50, 0xaa48, 0x37ec, 0x3738, 0x3649, 0x348c, 0x3103, 0x2d5f, 0x2da3,
+    0x304c, 0x2fd0, 0x28d9, 0xadcf, 0xb2f2, 0xb4a3, 0xb49a, 0xb34f, 0xb27f,
+    0xb54e, 0xb89f, 0xba97, 0xbb7a, 0xba31, 0xb4e4, 0x34a4, 0x3991, 0x39d0,
+    0x37c3, 0x31dc, 0xa650, 0xac3e, 0xa5b0, 0x2c1f, 0x301f, 0x3091, 0x30c0,
+    0x2d99, 0xa7fe, 0xae36, 0xae51, 0xaae4, 0xa451, 0xa11e, 0xa438, 0xaab4,
+    0x2147, 0x2e5c, 0x2b89, 0xa290, 0xa537, 0x249d, 0x29b8, 0x2a90, 0x2bba,
+    0x290d, 0x231a, 0x238b, 0xb09f, 0xb1d1, 0xaea5, 0xa29f, 0x2dbd, 0x323b,
+    0x346d, 0x3467, 0x311b, 0x2c3e, 0x2d34, 0x3011, 0x2d95, 0xa715, 0xafa9,
+    0xb01f, 0x20b1, 0x3257, 0x330b, 0x2e3a, 0xab82, 0xb198, 0xaf98, 0x9517,
+    0xa6b8, 0xad64, 0xad40, 0xaf11, 0xb37c, 0xb662, 0xb7ad, 0xb6ff, 0xb436,
+    0xa9d2, 0x30eb, 0x3525, 0x35dc, 0x34d5, 0x3263, 0x2d29, 0xa93f, 0xa56c,
+    0xa8f6, 0xadb7, 0xabca, 0xa810, 0xa912, 0xa982, 0xa9f1, 0x2047, 0xa372,
+    0xaa8f, 0xaa46, 0x10f9, 0xa61d, 0xa571, 0x23f9, 0xb182, 0xb093, 0xaf4d,
+    0xac63, 0x22e9, 0x2f2e, 0x30f7, 0x2dc9, 0x2675, 0x2a75, 0x2e14, 0x2bc6,
+    0xa52e, 0xabbc, 0xa9c6, 0x2ad5, 0x31d4, 0x328d, 0x3086, 0x2a3e, 0xa889,
+    0x25e6, 0x30ca, 0x312e, 0x308c, 0x3128, 0x30cd, 0x2aa0, 0xaf5b, 0xb470,
+    0xb617, 0xb5bc, 0xb414, 0xaf6e, 0x298f, 0x302b, 0x30a1, 0x2f75, 0x2b10,
+    0xa4df, 0x2030, 0x1ac8, 0xa4de, 0x1bb1, 0x1eb3, 0xa7da, 0xa74f, 0xa099,
+    0x29e8, 0x27f6, 0x284c, 0x2430, 0x267c, 0x1e72, 0x9ca2, 0xa208, 0xa9ff,
+    0xad3f, 0xb044, 0xb0ec, 0xaf0c, 0xa4e6, 0x2949, 0x21b6, 0xa5d5, 0x2780,
+    0x2d2f, 0x29e3, 0xa41a, 0xa2e6, 0x2678, 0x2d16, 0x300f, 0x2f32, 0x2cc9,
+    0x2944, 0x2245, 0x2d58, 0x3290, 0x33b1, 0x341a, 0x34c5, 0x3559, 0x3517,
+    0x3267, 0xa03d, 0xb3c2, 0xb62c, 0xb6b2, 0xb587, 0xb1c9, 0xa924, 0x2b39,
+    0x2e5e, 0x2dec, 0x2b6d, 0x2b92, 0x2647, 0x23a3, 0x289b, 0x207d, 0xa874,
+    0x9ea6, 0x1bac, 0x25a7, 0x9437, 0x2791, 0x288f, 0x26a2, 0x2524, 0x9d14,
+    0xa9e1, 0x31c0, 0x2d3e, 0xaa11, 0xb04e, 0xb03b, 0xac63, 0xa676, 0xab8d,
+    0xaced, 0x221a, 0x2e1b, 0x2c84, 0x2099, 0x281d, 0x2d7e, 0x2db5, 0x28b1,
+    0xab01, 0xae90, 0xad39, 0xa8eb, 0x294e, 0x2f22, 0x2e93, 0x2e89, 0x3142,
+    0x34b4, 0x3709, 0x3788, 0x3511, 0x2943, 0xb2a1, 0xb5b0, 0xb609, 0xb446,
+    0xb069, 0xa00d, 0x2d19, 0x2e28, 0x2cfb, 0x2b27, 0x8dff, 0x2443, 0x2a2b,
+    0x9853, 0xa838, 0x274d, 0x252a, 0xa4e2, 0xa958, 0x1f1f, 0x2366, 0xa52b,
+    0x9ee1, 0xa971, 0xaf6e, 0x3425, 0x2f0f, 0xad1a, 0xb2d8, 0xb3b2, 0xb235,
+    0xb12e, 0xb213, 0xb21b, 0xad23, 0x22fc, 0xa68c, 0xaef2, 0xad8f, 0xa6f8,
+    0xabf6, 0xb269, 0xb5e5, 0xb707, 0xb62e, 0xb4ad, 0xb334, 0xb441, 0xb685,
+    0xb7c1, 0xb646, 0xae61, 0x3527, 0x3962, 0x39f1, 0x387d, 0x3475, 0x279a,
+    0xb00f, 0xb0e9, 0xaf88, 0xa860, 0x2979, 0x2ca4, 0x2afb, 0x2342, 0xab77,
+    0xa240, 0x2cab, 0x29c5, 0x2433, 0x2dd3, 0x2cb5, 0x1784, 0x2179, 0x2d5f,
+    0x29a1, 0xa9d4, 0xaa85, 0xaeaf, 0xb297};
+
+static const uint16_t kDense2WeightsF16[kDense1Units * kDense2Units] = {0x1dc9,
+    0xaac2, 0xac10, 0x260b, 0xa081, 0xad9e, 0x2e6f, 0xa1ea, 0xa156, 0xa9ad,
+    0xb0a0, 0xacb5, 0xab8d, 0x10ff, 0xadd5, 0xac56, 0xb82f, 0x27ed, 0xaecc,
+    0xa641, 0x9e0f, 0xa171, 0x1d54, 0x0022, 0x14d8, 0x3297, 0x893e, 0xb0a7,
+    0xb56b, 0x2e4b, 0xa072, 0x350f, 0x173d, 0xb91b, 0x23cb, 0x1c71, 0x1c99,
+    0x34f6, 0x9c3a, 0xb813, 0x1902, 0xa997, 0x1e8d, 0x086c, 0x2594, 0x9de9,
+    0x30d5, 0xade0, 0x1be5, 0x35c6, 0xaefc, 0x1fb4, 0x2007, 0xb1ea, 0xb0e1,
+    0x10cf, 0xa4ba, 0xaec5, 0x3a1d, 0x303b, 0x823a, 0x31bd, 0x0875, 0xa107,
+    0xafd6, 0x32b5, 0x9ba4, 0x34c5, 0x1d4b, 0x2a8e, 0xb205, 0xafa2, 0x289c,
+    0x308c, 0xa1a9, 0xb4fc, 0x8336, 0xad83, 0xaf20, 0x16cd, 0x99b7, 0x3239,
+    0x2090, 0xaae8, 0xa2b3, 0xa9a7, 0x26de, 0x24cd, 0x20e9, 0x9987, 0xb7b1,
+    0x1f5c, 0x2d72, 0x38b8, 0x324b, 0x94b9, 0x00fc, 0x025c, 0x80da, 0x084b,
+    0x0032, 0x013f, 0x08e2, 0x0325, 0x8914, 0x80a8, 0x098a, 0x8957, 0x86f2,
+    0x0746, 0x08a7, 0x8968, 0x8629, 0x00da, 0x0022, 0x0789, 0x0947, 0x079a,
+    0x0810, 0x05d5, 0x0808, 0x8560, 0x0b9a, 0x8789, 0x013f, 0x80b9, 0x0000,
+    0x01b4, 0x02b0, 0x8496, 0x054f, 0x87bc, 0x0208, 0x8821, 0x8b68, 0x82d1,
+    0x0592, 0x8608, 0x0150, 0x82e2, 0x8896, 0x8819, 0x0968, 0x8608, 0x89e6,
+    0x8992, 0x8193, 0x0065, 0x0864, 0x8336, 0x888e, 0x0097, 0x8a31, 0x00fc,
+    0x8819, 0x0aaf, 0x87cc, 0x027e, 0x8896, 0x8714, 0x83bc, 0x054f, 0x05f7,
+    0x012e, 0x898a, 0x87bc, 0x09ee, 0x8208, 0x893e, 0x012e, 0x03ff, 0x8cc9,
+    0x8032, 0x8560, 0x8043, 0x852d, 0x0810, 0x064b, 0x84a7, 0x865b, 0x0193,
+    0x0c25, 0x0ad9, 0x8eab, 0x00da, 0x89b4, 0x84a7, 0x8947, 0x8864, 0x0a10,
+    0x063a, 0x029f, 0x11ea, 0xa19d, 0xa065, 0x2d19, 0x2adc, 0x2bdf, 0xaf1f,
+    0x31ec, 0xa8b0, 0x2cf3, 0xaa6a, 0x1021, 0xaae5, 0xaa7c, 0x1dcb, 0x2f21,
+    0x301a, 0x2e58, 0x9c30, 0xb42d, 0xa8f8, 0x3199, 0xae36, 0x0c0c, 0x9c11,
+    0x2ecf, 0x085c, 0x33b5, 0x2d39, 0xae1e, 0xadb1, 0x9c62, 0xb69a, 0x2ac3,
+    0x1ed0, 0xb4c4, 0x32e8, 0xa0e8, 0x3cf0, 0x2103, 0xae98, 0xaafe, 0x2928,
+    0x8ac8, 0xa421, 0x38ef, 0x3183, 0xbd34, 0x31f5, 0x200e, 0x1b7c, 0x9ddf,
+    0x9d27, 0x11ab, 0xa9f0, 0x202f, 0x3034, 0x9c1b, 0x9190, 0x2044, 0x8a53,
+    0x13e1, 0x025c, 0x2bd4, 0xb234, 0x1045, 0x27f5, 0xa599, 0xb501, 0x2562,
+    0x9985, 0x3778, 0x1767, 0xa053, 0x2fb5, 0x1049, 0x83cd, 0xa1d8, 0x917f,
+    0x956e, 0xb439, 0x1e1e, 0x116c, 0x32e1, 0x1cca, 0x23fe, 0x9dd6, 0xa27e,
+    0xa469, 0xa4cf, 0x29be, 0x30d3, 0xba0c, 0x2d59, 0x309f, 0x2136, 0x358e,
+    0x08c0, 0xb4ce, 0xb808, 0xa45c, 0x3a0d, 0xb7a9, 0x311a, 0x2705, 0xb282,
+    0x3307, 0xaf3a, 0xa12f, 0x1eab, 0xb1d2, 0xa241, 0x9797, 0x218e, 0xb506,
+    0x1740, 0xb7d6, 0xad08, 0xb19e, 0x80b9, 0xa7bf, 0xa0f2, 0x8304, 0x94a7,
+    0xaa17, 0x26b0, 0xa15e, 0x9cc0, 0xa589, 0x9e47, 0x2553, 0xb103, 0x9acb,
+    0x34d0, 0x1e54, 0x1428, 0xaf0c, 0x2cb6, 0x36f1, 0x8779, 0xa497, 0x20d5,
+    0x31ec, 0x2870, 0x2447, 0x2211, 0x3589, 0x276c, 0x2e2b, 0x9933, 0xaf78,
+    0xa0e0, 0x1781, 0x1f90, 0x3840, 0x30b3, 0x8a31, 0xa348, 0x0cc0, 0x2d4f,
+    0xb200, 0xb272, 0x2633, 0x2fde, 0xaba5, 0xb1c0, 0xa414, 0x370f, 0xaab7,
+    0x0e6c, 0x155a, 0x329c, 0x0592, 0x2dd9, 0xae41, 0x266c, 0x149b, 0xa544,
+    0x35cb, 0xadce, 0xa8ba, 0xa0d6, 0x2214, 0x132d, 0x2206, 0x23e0, 0xa1cd,
+    0xb434, 0x2012, 0xa892, 0x1e2e, 0xa5a3, 0xade0, 0x2a6d, 0x2c13, 0x2a21,
+    0x2d1b, 0x2eb9, 0x2ad4, 0x2c96, 0x3393, 0x349b, 0x3371, 0x3316, 0xb2b2,
+    0xb738, 0x2374, 0x3465, 0x34a6, 0x3146, 0xa4c6, 0x371b, 0xb011, 0xb30c,
+    0xb1de, 0x8219, 0x3353, 0x3419, 0x89ff, 0x1fc2, 0xb543, 0xaa99, 0x205a,
+    0x1980, 0x1be3, 0xadb3, 0xab75, 0xb014, 0x1b36, 0x306c, 0x1f21, 0x291f,
+    0x97e0, 0xb5f2, 0x2fd3, 0x84da, 0xa944, 0x9877, 0x9cb8, 0xab7c, 0x2a20,
+    0xb403, 0x356b, 0x3517, 0x9e96, 0x2e5c, 0x8c7d, 0xa0c1, 0x1484, 0x2fc1,
+    0x2e5e, 0xaa41, 0x085c, 0x37ea, 0x851d, 0x30fa, 0x2727, 0x1a01, 0x1bc5,
+    0xad56, 0xa99a, 0x2353, 0xb3e3, 0x99ab, 0xb266, 0x1dc7, 0xb21d, 0x1e61,
+    0x0968, 0x1e7a, 0xb493, 0x100c, 0x266f, 0x2d12, 0x9e97, 0x9c6c, 0x1c2f,
+    0xab2a, 0xb4f7, 0x91a9, 0xa610, 0xabeb, 0xafe6, 0x2225, 0x9595, 0x217c,
+    0x2479, 0xa535, 0x251a, 0xaeb8, 0x1ed8, 0xa37b, 0xb3cc, 0xaf42, 0xa017,
+    0x1cd9, 0x3686, 0xaaeb, 0x2850, 0x30fb, 0xb8ca, 0x2d26, 0xb4aa, 0xa43e,
+    0xa1ad, 0x2870, 0xb138, 0xa06b, 0xa868, 0xb3e0, 0x333b, 0x0a18, 0x2322,
+    0xb048, 0x0054, 0xa96f, 0xad49, 0x34b9, 0x3229, 0x1c49, 0x35a4, 0xae4a,
+    0xad5a, 0x2f2a, 0x34d5, 0x1c7f, 0xaea0, 0xb730, 0x1f20, 0xb225, 0xaf2a,
+    0x09ee, 0x2027, 0x3510, 0x2fc9, 0x32d2, 0xb426, 0xb2c3, 0x1d87, 0xb63d,
+    0x2b42, 0xb7d6, 0xa0a0, 0x3057, 0xa0a8, 0x3163, 0xb53e, 0xb999, 0x0947,
+    0x1f06, 0x825c, 0x2874, 0xb450, 0xb7ea, 0xa23f, 0xb273, 0xb470, 0x2cce,
+    0x1d54, 0xb4a6, 0xaa2b, 0x20f5, 0xb575, 0x19e5, 0x0304, 0x9c04, 0xaecf,
+    0x9520, 0x1817, 0xa2a0, 0xb05c, 0xa1f5, 0xb530, 0x0c8a, 0xa1d4, 0x287b,
+    0xb0b9, 0x2b78, 0xb6e8, 0xb442, 0xae9a, 0x1dd9, 0xaf7c, 0xa25f, 0x0eb3,
+    0x3443, 0x9c58, 0xac78, 0x1e81, 0x3430, 0xad52, 0x2001, 0x3184, 0x2eec,
+    0xad3c, 0x272d, 0x9e6e, 0x317e, 0x289d, 0xb445, 0xb669, 0xb456, 0x260e,
+    0x202b, 0xad28, 0x1159, 0x29f0, 0x8c4b, 0xb619, 0x3099, 0x8432, 0xb1c6,
+    0x2bb4, 0xa93c, 0x324b, 0xa0ad, 0x22ef, 0x3205, 0xac89, 0x14e5, 0x9e90,
+    0x9c7f, 0xb18e, 0x2533, 0xa8b9, 0x33b5, 0xa4e9, 0x0746, 0x97f6, 0xb5d6,
+    0x1a5d, 0x26b3, 0xac7b, 0x2d97, 0x9ef9, 0xa066, 0xaf15, 0xb2ed, 0x3013,
+    0xade9, 0x946a, 0x317f, 0x94c7, 0x2f67, 0x8075, 0xb30c, 0x09c4, 0x2d49,
+    0xa019, 0x283e, 0x2f1e, 0x34a1, 0x321e, 0xae52, 0x8b68, 0x2ec1, 0xb709,
+    0xafe0, 0xb162, 0xa02b, 0x08c9, 0x16f0, 0xafed, 0x9b9e, 0x1a9e, 0xa4e2,
+    0x3826, 0xb128, 0x3143, 0x31b1, 0x3128, 0x3578, 0xa85d, 0x1952, 0xad87,
+    0xb414, 0x9d6c, 0x33ea, 0x306d, 0xb66e, 0xae88, 0x1e04, 0xb4dd, 0xa399,
+    0x2dc1, 0xabe1, 0x313a, 0xb82b, 0x1dd2, 0xa918, 0xb813, 0xb0e0, 0x2ec6,
+    0xa5b4, 0xb317, 0xa91e, 0x9392, 0xa953, 0xaa49, 0xaed0, 0x281c, 0x2871,
+    0x2824, 0x828e, 0x29d1, 0x9def, 0x8000, 0x0b1c, 0xba71, 0x2cad, 0xb230,
+    0xb4b3, 0xaccb, 0x2382, 0xa9d4, 0xa257, 0x1f70, 0xb42c, 0xaec9, 0x1e9a,
+    0x9cc1, 0xa689, 0x2d92, 0x00eb, 0x1dde, 0xa645, 0xad84, 0xad3b, 0xa881,
+    0xb2e0, 0x308c, 0x3086, 0x9a0c, 0x2735, 0x9b89, 0xb4c7, 0x2418, 0x9c9a,
+    0x1134, 0x2c09, 0x8c3e, 0x97a9, 0x8182, 0x2edd, 0x9749, 0x2cf4, 0xa90b,
+    0x2fa0, 0x9c69, 0xb224, 0x2f73, 0xa471, 0x2e1e, 0xb127, 0xb3d8, 0x1c41,
+    0x0358, 0xa448, 0xb11b, 0x8b0c, 0x980e, 0xac5f, 0x1d77, 0xaacd, 0x182e,
+    0x9aa9, 0x3019, 0xa3ec, 0xb26d, 0xa552, 0xb073, 0x249f, 0xb6b2, 0x34b2,
+    0xb5e7, 0x9abe, 0xb15f, 0x22b2, 0x2cfa, 0xa690, 0x2dc3, 0x2be6, 0xb019,
+    0x364e, 0xb174, 0xb4d2, 0x9fa0, 0xb2d0, 0xa112, 0xb0df, 0xbc1a, 0x3465,
+    0x3b1e, 0x32a5, 0x1576, 0x32e0, 0x2c8a, 0x2f8a, 0xb877, 0x8560, 0x31af,
+    0x1bba, 0x893e, 0x3108, 0x0ff6, 0xb297, 0x0d14, 0xaddf, 0x2862, 0x2c4c,
+    0x349d, 0x9c59, 0x245d, 0xa43a, 0x38b3, 0x2c0d, 0xa5ca, 0xa144, 0x2441,
+    0x88c0, 0xb0c6, 0xab2b, 0x3417, 0xa1c9, 0x1faf, 0xa060, 0x2796, 0x2f6f,
+    0x23e3, 0x2f95, 0xb014, 0x2c7b, 0xac8a, 0x287b, 0x8d29, 0x1d43, 0x89ab,
+    0x30a9, 0x80b9, 0x2397, 0xaec9, 0xaec2, 0x2e2a, 0x18d8, 0x3137, 0x2a88,
+    0xa796, 0x2c94, 0x27fa, 0x3624, 0xb017, 0x222c, 0x89ee, 0x31de, 0x1ab8,
+    0x9bbb, 0xa488, 0x35d1, 0x1bdb, 0x25e5, 0xa0cc, 0x1db8, 0x95a6, 0xb0ad,
+    0x2e46, 0x28e1, 0x33e8, 0x3409, 0x1b43, 0x982c, 0x11ff, 0x3618, 0x2c28,
+    0xad18, 0xa142, 0xa9f9, 0xb305, 0x2d25, 0xa892, 0x2096, 0xa4e2, 0x2014,
+    0x24aa, 0x273b, 0x1a9d, 0xb25c, 0xa0d0, 0xa807, 0xb11b, 0x316d, 0xaa72,
+    0x3821, 0xafa2, 0x93ca, 0x98b0, 0x079a, 0x2b07, 0x182c, 0x0735, 0x3220,
+    0xa167, 0xb288, 0x3403, 0x9c71, 0x1f49, 0xad36, 0xaa5a, 0x289b, 0x318f,
+    0x3035, 0xb6b2, 0x2deb, 0x2064, 0x203a, 0xb59c, 0x09b4, 0x298e, 0x2de7,
+    0x94f6, 0xb7b4, 0xb371, 0x2bb5, 0xa72d, 0x2a38, 0x3803, 0xb049, 0xa638,
+    0x34dd, 0x1a7c, 0x2e0e, 0xb042, 0xad71, 0x8022, 0x2f58, 0x0aea, 0x2c26,
+    0xa681, 0xa8ff, 0xa602, 0xaf27, 0x84a7, 0x32a9, 0xb744, 0xaffa, 0xb073,
+    0x2a21, 0x2e3a, 0x8bdd, 0x06af, 0xa760, 0x206e, 0x10b0, 0x2c28, 0x1457,
+    0xa02c, 0xa0c2, 0x942e, 0x33dc, 0xb0ce, 0xa5f0, 0xacaa, 0xaae9, 0xa2e4,
+    0xb579, 0x95e6, 0xb2d2, 0x378d, 0x1aad, 0xb0db, 0x1e03, 0x378f, 0x2ef7,
+    0xb41f, 0xb6ca, 0x2421, 0xacbe, 0x2eb8, 0x341a, 0xb1d3, 0x2cc8, 0x2633,
+    0x1894, 0x2881, 0x3192, 0x1ba5, 0x9b20, 0x3663, 0xaaab, 0x2c91, 0x9a6b,
+    0xb130, 0x8a85, 0x3808, 0xb37c, 0x8011, 0x2303, 0x2509, 0x3517, 0xab6a,
+    0xac80, 0xa05f, 0x98de, 0x35d6, 0xb233, 0x9cb6, 0xb925, 0xa31b, 0x182c,
+    0x26b1, 0x341a, 0xb343, 0x0097, 0xa4c4, 0xade3, 0xad94, 0x2e19, 0xb08d,
+    0x9e05, 0xad78, 0xb56d, 0x3695, 0xb0df, 0x16de, 0x9fe6, 0x9ebe, 0x1ded,
+    0x9830, 0x20ce, 0x8bf6, 0x95bb, 0x8d9a, 0xb3c6, 0xa45b, 0xb47a, 0x32d3,
+    0x2eee, 0xb71c, 0xa841, 0x3707, 0xb1e8, 0x1bf5, 0xb2c5, 0x1e2a, 0x0486,
+    0x8000, 0x1bad, 0xab60, 0x18c7, 0xa86d, 0xa9f1, 0x9bc0, 0xa972, 0x260b,
+    0x296a, 0xaf46, 0x983c, 0xac5b, 0x34fb, 0xadb7, 0xb238, 0x3146, 0x2db2,
+    0xa6a8, 0x34ea, 0x988f, 0x19d7, 0xad57, 0x302e, 0xb8cf, 0x328a, 0x1f09,
+    0x375f, 0x2c87, 0xb742, 0xa123, 0x2d3d, 0x2ad1, 0xba10, 0x34c5, 0x2daa,
+    0xaa08, 0x23b1, 0xac81, 0x318e, 0xb781, 0x24c7, 0xb74f, 0x8cd1, 0xb88f,
+    0xb01a, 0x0571, 0x33b6, 0xab31, 0xb03c, 0xadfa, 0x2491, 0x9ce8, 0x2817,
+    0x2463, 0x2d1d, 0x9a62, 0xb1fa, 0xb783, 0x0f03, 0xb917, 0x29a2, 0xb1a7,
+    0x0065, 0x210f, 0x9b98, 0xa490, 0x38d3, 0xadc7, 0x2d63, 0x348d, 0xb33d,
+    0x1d6e, 0xaa3d, 0xa079, 0x210c, 0x999f, 0x1cc2, 0xa513, 0x1ccf, 0x07ab,
+    0x2837, 0x0b46, 0x3249, 0x2ab9, 0x23e0, 0x2dc8, 0xa0ae, 0x28d0, 0x234a,
+    0xb33a, 0xb7f1, 0xaf34, 0xa62b, 0x1d3d, 0x35e9, 0x05d5, 0x9a38, 0xac51,
+    0xb496, 0x9bec, 0x9e0f, 0x38c2, 0x2abc, 0x3612, 0x2c20, 0x2243, 0x9ffe,
+    0x28a5, 0x3023, 0x1f13, 0xb12f, 0x30d4, 0x9466, 0x22a2, 0xaf53, 0xac02,
+    0x3721, 0x306d, 0xb191, 0x9738, 0x2863, 0xa6e7, 0xad2f, 0x27b5, 0xb0d1,
+    0x2349, 0xb499, 0x9eb2, 0x1e90, 0x3212, 0xac46, 0xb48f, 0xaff4, 0x35ed,
+    0x2b89, 0x2171, 0xab83, 0x9d01, 0x08d1, 0xb560, 0x27cf, 0x8a53, 0xb087,
+    0xb2f2, 0x3441, 0xb5f6, 0xab82, 0xb8f3, 0x2216, 0x2015, 0x3476, 0x99af,
+    0x1d13, 0xb0c4, 0x3598, 0x22be, 0x27ca, 0xad0c, 0x0b0c, 0xb032, 0x9547,
+    0x2876, 0x381d, 0x1848, 0xac4b, 0x9251, 0xabdb, 0xb15a, 0x19d4, 0x20c4,
+    0xaaa5, 0x2e86, 0x3057, 0xade5, 0x2858, 0x85a3, 0xa9da, 0x0843, 0x10d5,
+    0xb28f, 0xb222, 0xaf3f, 0xa0c1, 0xaa8e, 0x9990, 0x30ba, 0x308e, 0xabb7,
+    0x32de, 0x21f5, 0xa192, 0x0981, 0x2bf4, 0xb3a3, 0x07ff, 0x34d2, 0x254a,
+    0x9cbb, 0xb155, 0x9cd5, 0xa5b1, 0x2ac5, 0x3147, 0xaf4b, 0x12cb, 0x988d,
+    0x280f, 0x1ce2, 0xb47d, 0x981e, 0x352c, 0xacd1, 0xa084, 0x85f7, 0xa0db,
+    0xae30, 0xb503, 0x2215, 0xb30a, 0x9c6b, 0x2e91, 0xaf2f, 0x2214, 0x3387,
+    0xa9c3, 0x203a, 0x26e9, 0x9925, 0xb257, 0x3927, 0x9a20, 0xaf7b, 0xb143,
+    0x2920, 0x067d, 0x21dc, 0x1e95, 0x0336, 0xa81a, 0x997b, 0x203f, 0xb11e,
+    0x368f, 0x9b96, 0xba98, 0x3884, 0xae31, 0x11b4, 0x3691, 0xb230, 0x2e92,
+    0x2fd8, 0x9b49, 0xaad0, 0x84da, 0xb3d4, 0xa323, 0xa93f, 0x30d7, 0xb21d,
+    0x3040, 0x3029, 0x9caa, 0xa812, 0x3270, 0x9dca, 0xab9a, 0x9e9d, 0xb9d8,
+    0x2c3d, 0x35a8, 0x0bff, 0xab61, 0x0ac0, 0x1d9a, 0x2364, 0xac14, 0xab00,
+    0xb761, 0x28bc, 0x9660, 0x9eef, 0xb293, 0x30dc, 0x21b9, 0x3809, 0xa5d5,
+    0x80da, 0xb6fd, 0x1ccf, 0x8f89, 0xae8a, 0x273a, 0x25d0, 0xaefd, 0x3427,
+    0xad5e, 0x328f, 0xb652, 0xa8ba, 0xa2b9, 0xb21e, 0x3272, 0xafc5, 0xa46b,
+    0x33ee, 0x910a, 0xb123, 0xb191, 0xa226, 0x3092, 0x2e9b, 0xa64e, 0x9408,
+    0xba7c, 0xb507, 0x2da4, 0x9fbc, 0xb4a5, 0x2bc6, 0x9aec, 0x98c1, 0x31d5,
+    0xb854, 0x97d4, 0xadef, 0xb3b3, 0x9564, 0xa0c2, 0xa874, 0x0022, 0x3407,
+    0xa675, 0x86c0, 0x22b7, 0x9cce, 0xa8f1, 0x2e40, 0xaba5, 0xa8c9, 0xa68c,
+    0x333e, 0xb959, 0xb5e1, 0x9579, 0x3411, 0x2b6f, 0x2fc4, 0xa4e2, 0x9f7b,
+    0x83de, 0x985b, 0x34ef, 0xad56, 0x8cda, 0xa4dd, 0xb1ed, 0xad7c, 0xb33e,
+    0x1982, 0x1b95, 0x291f, 0x2c50, 0x25b7, 0xa15b, 0x2db1, 0xa819, 0x0dfb,
+    0xaccd, 0x812e, 0xb740, 0xae9c, 0x28b0, 0x223f, 0xaa85, 0x18e2, 0x1c58,
+    0x1a7c, 0x98c4, 0x99c3, 0xabe7, 0xae2e, 0xa486, 0x0171, 0x2383, 0xaa63,
+    0x9249, 0x1c29, 0xb136, 0xb25f, 0x31ad, 0xae15, 0x9ee6, 0xb014, 0xb1f4,
+    0xb21d, 0xaf1d, 0x2b06, 0x1faa, 0xabbf, 0x1b19, 0x2a64, 0xab33, 0x3003,
+    0xb9d3, 0x12ec, 0x29c8, 0xa1ba, 0x14b0, 0xb6a6, 0xb595, 0x26a1, 0x32b3,
+    0xb153, 0x299a, 0xb42c, 0xa5c7, 0x2ef7, 0xa2c6, 0x1b48, 0xb453, 0xb544,
+    0x31a8, 0xb7ba, 0x276b, 0x2bcc, 0x012e, 0x2484, 0xbd1b, 0x011d, 0xac4a,
+    0xa976, 0xb572, 0xacd7, 0x30c4, 0x22c9, 0x1d8d, 0xb5ed, 0x27f6, 0x9be5,
+    0x2e37, 0x2f63, 0xa3ae, 0xa482, 0x9d24, 0xa02c, 0x050c, 0xb449, 0x9e60,
+    0x9d1a, 0xae36, 0x1f02, 0xb5cd, 0x9a29, 0x9f0b, 0x9886, 0x31dd, 0xa4ec,
+    0x2352, 0x3139, 0xbb32, 0x2dd0, 0x2e5c, 0x00da, 0x3238, 0x8bbc, 0x21c8,
+    0x90fb, 0x36ea, 0x2183, 0x2eb3, 0x9e21, 0x2000, 0x9965, 0xaee5, 0x1aae,
+    0x98cf, 0xa8b5, 0x91e4, 0x8011, 0x18fa, 0x30a3, 0x1b10, 0xa984, 0xafc9,
+    0x29f4, 0x9e03, 0xa7ce, 0xa9b4, 0xa08e, 0xb81e, 0x991f, 0x26d8, 0xb812,
+    0xb078, 0xac30, 0x3898, 0xb717, 0xaaec, 0x390c, 0x263b, 0xb2c9, 0x3454,
+    0x2b57, 0x36dc, 0x297b, 0x2c6b, 0x2c98, 0xb3f5, 0xb002, 0x21c7, 0xa287,
+    0x153a, 0x95c5, 0x9dda, 0x9d8c, 0x3266, 0xa2c9, 0xa869, 0x30fa, 0x30a2,
+    0x9f13, 0x07ff, 0xb8a6, 0x3169, 0x89cd, 0x28ae, 0x2180, 0x345d, 0xacc4,
+    0xb28e, 0x3563, 0xabf3, 0xa8c0, 0x3072, 0x9e29, 0x3961, 0x9eb0, 0x3756,
+    0xa41e, 0xad9e, 0xb18a, 0x029f, 0x2054, 0xb75b, 0x97bb, 0xa4ea, 0xa125,
+    0x34dc, 0x256f, 0x2149, 0x9c3c, 0x2159, 0xa86e, 0xa114, 0xb4a4, 0x341d,
+    0x32f8, 0x3567, 0x829f, 0xb0c0, 0x86c0, 0x3058, 0x3115, 0x3029, 0x9a58,
+    0xaf60, 0x979a, 0xa0dd, 0x0d92, 0x247f, 0x300b, 0xb288, 0x2bec, 0x99e3,
+    0x83cd, 0x3482, 0xb198, 0x1c22, 0x30c8, 0xa6da, 0x30fa, 0x2ee0, 0x9d60,
+    0x18a5, 0x313c, 0x2f8f, 0x2829, 0xb426, 0x2fd0, 0xa338, 0x8819, 0xb47f,
+    0x3412, 0xade1, 0x84b8, 0x066c, 0x8808, 0x039b, 0x0757, 0x028e, 0x84da,
+    0x090c, 0x09ee, 0x8b25, 0x01f7, 0x0875, 0x8486, 0x879a, 0x0304, 0x05b4,
+    0x0475, 0x0cab, 0x00a8, 0x8347, 0x084b, 0x8714, 0x8022, 0x83ac, 0x011d,
+    0x0097, 0x8a10, 0x0843, 0x82d1, 0x0368, 0x866c, 0x81d6, 0x05e6, 0x826d,
+    0x0bd5, 0x8315, 0x051d, 0x0022, 0x8592, 0x8fe1, 0x0410, 0x8d47, 0x8853,
+    0x8947, 0x854f, 0x8325, 0x8a08, 0x8bdd, 0x87bc, 0x053e, 0x8864, 0x03ff,
+    0x85c4, 0x05d5, 0x86c0, 0x0618, 0x83de, 0x80a8, 0x8193, 0x09d5, 0x89bc,
+    0x0571, 0x87dd, 0x82e2, 0x0896, 0x0947, 0x064b, 0x04b8, 0x100c, 0x06f2,
+    0x02e2, 0x8618, 0x0618, 0x852d, 0x03ff, 0x08ea, 0x8000, 0x8496, 0x0182,
+    0x8a10, 0x03de, 0x0486, 0x0032, 0x0853, 0x0864, 0x83cd, 0x8d53, 0x05e6,
+    0x8486, 0x82b0, 0x022a, 0x8054, 0x0829, 0x0925, 0x0b5f, 0x84fb, 0x1d2b,
+    0xad0c, 0xb1a1, 0x2d07, 0xab80, 0x345d, 0x9bda, 0xa0ef, 0x2c8e, 0xb285,
+    0xa2fe, 0xac17, 0x1f05, 0x2030, 0x2910, 0xad77, 0xb2fb, 0xac19, 0xb743,
+    0x3706, 0x9196, 0x3441, 0x2bec, 0x089f, 0xa397, 0x2696, 0x8347, 0xa056,
+    0xaa73, 0x3393, 0x18ee, 0x32bf, 0x2e57, 0xaeae, 0xb4d0, 0x258c, 0xb163,
+    0x353e, 0xba42, 0xab0b, 0xaffd, 0xab7e, 0x246b, 0x027e, 0x24cc, 0xb0cd,
+    0xb1cc, 0x3279, 0x9f0a, 0x30e2, 0x2aad, 0xb0b1, 0xb064, 0x9c7e, 0x9cfd,
+    0x2b0e, 0xa567, 0x3268, 0xa4c0, 0x1c54, 0x85c4, 0xa25d, 0x8c81, 0x187d,
+    0x9ea6, 0x2c2a, 0x9bbb, 0xa70e, 0x2d53, 0xadfe, 0x341e, 0xb154, 0x2a30,
+    0x305b, 0x2a3e, 0xbacd, 0x0c68, 0x2084, 0x2246, 0xbd97, 0x2d83, 0xa4f9,
+    0x1b66, 0xa35f, 0x9488, 0x1e1f, 0xa988, 0xa7f5, 0x1f69, 0x239d, 0xaee8,
+    0xa174, 0x9dcb, 0x20f3, 0xb92f, 0xb0c0, 0x2b28, 0x33d7, 0x306d, 0x30a3,
+    0x2c7c, 0x9f6c, 0x2254, 0x23fa, 0x1958, 0xb0a7, 0x26dd, 0xb7c2, 0xaed9,
+    0x2477, 0xb44d, 0x299d, 0x1d79, 0x15d6, 0x1f8d, 0x9a37, 0xb43f, 0xb03d,
+    0xaa43, 0x885c, 0x31ec, 0xaaf7, 0x0065, 0xaca6, 0xb1b7, 0xa558, 0xad0c,
+    0x28bf, 0xb38b, 0x27c0, 0xafba, 0xa9b7, 0x1af6, 0x1953, 0x3aae, 0x236c,
+    0xb488, 0x16d2, 0xad5e, 0x0443, 0xb15e, 0xa153, 0x3369, 0x3384, 0x21fb,
+    0x1cc2, 0xb821, 0x206c, 0xab58, 0x2674, 0x0560, 0x1b31, 0x9aad, 0xb33d,
+    0x379d, 0x2cf8, 0x07ee, 0x9ee4, 0x0022, 0x2c5e, 0xb096, 0xa8e6, 0x9b24,
+    0x303c, 0x2219, 0x2ea9, 0x205e, 0x2d7d, 0x2d94, 0x243c, 0x24b2, 0x3ec5,
+    0x067d, 0x9c10, 0xab6f, 0x204b, 0xb224, 0xa41e, 0x385d, 0x2ca0, 0x33d1,
+    0xb13d, 0xb286, 0xaa48, 0x346f, 0x30c1, 0x0c32, 0x36a1, 0x3232, 0x8022,
+    0x3099, 0x244d, 0x1798, 0x2021, 0xae26, 0xa8c1, 0x24a5, 0x9ad6, 0x323d,
+    0x24a0, 0x3509, 0xa32f, 0x3491, 0x32b2, 0xa3ce, 0x29e5, 0xa7d1, 0x223e,
+    0xb80c, 0xaa84, 0x28f3, 0xb21c, 0x2641, 0xa0f0, 0x243c, 0x8ab8, 0x9886,
+    0x1c3e, 0x8864, 0x1cca, 0x2db0, 0x380b, 0x307e, 0x2345, 0x31da, 0xae61,
+    0x2acb, 0x963f, 0xb846, 0x1e5e, 0xb420, 0xa655, 0x2c74, 0x9a1a, 0xafc0,
+    0x0af2, 0x265d, 0xa05c, 0x25ac, 0x29dc, 0x2ef7, 0xb5d6, 0x3137, 0xb847,
+    0x1abb, 0x9ce3, 0x3414, 0xa027, 0xb97a, 0xa9d3, 0x22e8, 0x216b, 0x04fb,
+    0xb43e, 0x08b0, 0x29fe, 0x2860, 0x230e, 0x205c, 0xa0a1, 0xaff6, 0x2a22,
+    0x39bb, 0x9e59, 0x3134, 0x97b6, 0x2097, 0x9cfd, 0x825c, 0x92c6, 0x8789,
+    0x203b, 0x3514, 0xaf76, 0xbc5f, 0x30e0, 0xa977, 0xad19, 0x2dfc, 0xb2d3,
+    0xa27b, 0x2d2e, 0x1d2b, 0x1c3c, 0x377b, 0x9c61, 0xb130, 0xa017, 0x3400,
+    0xac39, 0xa9c2, 0x1aee, 0x33ce, 0x34b1, 0xa6fa, 0x318d, 0x2b99, 0xa233,
+    0x323c, 0x304a, 0xa6ef, 0x9e18, 0x2e30, 0xaff0, 0x9949, 0xa880, 0xb6d0,
+    0xaf38, 0x2adc, 0x2b3b, 0x3402, 0x0086, 0xb107, 0xb50b, 0x8336, 0x316c,
+    0xb6ce, 0xa9f7, 0xb184, 0xa0ab, 0xb507, 0x31d4, 0xb698, 0x2361, 0x1ca4,
+    0x1af2, 0xa04d, 0x3327, 0x2427, 0x2b87, 0xaa66, 0x023a, 0x32d2, 0xb24a,
+    0xbae4, 0xa70c, 0xaf40, 0x1c1b, 0xadaf, 0x9f10, 0x33cb, 0xa798, 0xb6e1,
+    0x34bd, 0x349c, 0x2860, 0x2deb, 0x2697, 0x09ee, 0xad79, 0x038a, 0x316b,
+    0xad39, 0xa235, 0x3332, 0xae1b, 0x3195, 0xa438, 0x21be, 0xa726, 0x209b,
+    0x9d2d, 0xac18, 0x1ce1, 0x0182, 0x2ead, 0xb29c, 0x1cae, 0x04c9, 0x1adf,
+    0x2a62, 0x9fc8, 0xa7f6, 0xa200, 0xae1b, 0xaf66, 0xb18b, 0xb5b1, 0xad7f,
+    0x9538, 0xac1d, 0x2c1c, 0xb21e, 0xaedc, 0xa445, 0xb78d, 0x96bb, 0x35a1,
+    0x2f3d, 0x3578, 0xa875, 0x9afc, 0xa908, 0x2838, 0x393d, 0x29b9, 0xb040,
+    0x278a, 0x282a, 0x2448, 0x9890, 0x1da4, 0xa641, 0x14d2, 0x22df, 0xb878,
+    0x2925, 0x09de, 0x370b, 0xb112, 0x0443, 0x2d82, 0x31d1, 0xa9c1, 0x1fad,
+    0x9592, 0xac1e, 0xa94a, 0xa979, 0x99f3, 0x9932, 0xa1bf, 0xacec, 0xa9dc,
+    0x2281, 0x2f47, 0x23e0, 0x8054, 0x22e1, 0xbab0, 0x1da8, 0x978b, 0x2ef6,
+    0x1da9, 0x2f89, 0xae23, 0x9cc6, 0x9c7e, 0x1436, 0x9e09, 0x1b70, 0x2447,
+    0x0f85, 0xaec3, 0x88fb, 0xa53e, 0x8960, 0xa196, 0x2792, 0xa196, 0xb394,
+    0x2e79, 0x953a, 0x028e, 0xa9bf, 0xb5f9, 0xa428, 0x28e3, 0xaf48, 0x9791,
+    0x09de, 0x35b9, 0x30e8, 0xa016, 0x1481, 0xa707, 0xa0c3, 0x3200, 0x2fd6,
+    0x20b3, 0x1aad, 0xb5d1, 0xb73d, 0xb4db, 0x999b, 0xb4f7, 0x255f, 0xb196,
+    0x2806, 0xb59d, 0x32fd, 0xae6b, 0xb9da, 0x33af, 0x3484, 0xb564, 0xa598,
+    0xb4aa, 0x2ebf, 0xaa2f, 0xb527, 0xb064, 0x315f, 0x2a3b, 0x230a, 0x3063,
+    0x2b40, 0xb85d, 0xb821, 0x1451, 0xb421, 0xa8f4, 0x1c2b, 0x8c14, 0xa6ff,
+    0x21f9, 0x01e7, 0xa50d, 0x1ec6, 0xad4c, 0xb023, 0x1e23, 0x8c71, 0xaf7a,
+    0xb56a, 0xb68f, 0x1f39, 0x381d, 0x94e2, 0x9885, 0x141e, 0xac35, 0x2f65,
+    0x0a08, 0xaee4, 0x152f, 0x94f9, 0x1653, 0x27e6, 0xa83f, 0xb412, 0x2e8c,
+    0x8629, 0xb0d4, 0xac0d, 0x2d1d, 0x1c7e, 0xbe59, 0x3c0a, 0xabed, 0x03de,
+    0xa966, 0x8bbc, 0x3012, 0x3435, 0xa668, 0x1406, 0x9772, 0x0f92, 0x950c,
+    0x1ef6, 0x0e46, 0x10b2, 0xa92c, 0x247d, 0xaf8b, 0x0ac0, 0x2875, 0x241a,
+    0x9ab1, 0x149f, 0x2051, 0x1ea1, 0xaf11, 0x9b3d, 0x2062, 0x2078, 0xb428,
+    0xa411, 0xa122, 0x9c69, 0x30c8, 0xadf4, 0x2c21, 0xa8d3, 0xb8c0, 0x2d42,
+    0x2f8a, 0x1699, 0x2c6b, 0xaec8, 0xa24a, 0x2aeb, 0xb3b3, 0x24f3, 0xa05a,
+    0x9f5d, 0x2b36, 0x18b1, 0xaf12, 0x31ce, 0x29be, 0x31b3, 0xa19d, 0x10cf,
+    0xa355, 0x0c36, 0xb047, 0x9d31, 0x85e6, 0xb317, 0xaebb, 0x0304, 0x19be,
+    0x3206, 0xb424, 0x1cf8, 0x2536, 0xa051, 0x315a, 0x2c3f, 0x2d79, 0x1c6e,
+    0xb28b, 0xa0ae, 0x30e5, 0x3418, 0x24b3, 0x3069, 0x8903, 0x15d9, 0x1188,
+    0x3160, 0x30fe, 0x2994, 0x9824, 0x30b5, 0x3167, 0x16c5, 0x9aac, 0x16d1,
+    0xadac, 0x9930, 0xa615, 0xa5ab, 0x30a8, 0x0a4b, 0x2776, 0x8735, 0x2e00,
+    0x2c4b, 0xacf7, 0x35e4, 0x2dd2, 0x920e, 0xb325, 0xb058, 0x1a76, 0xb381,
+    0xa9e7, 0x26a2, 0x3030, 0x0150, 0x977b, 0xa87c, 0x0629, 0xb343, 0x9cae,
+    0xbc11, 0xa480, 0x3355, 0x29d3, 0x2dcc, 0x29e2, 0x9b40, 0x29b8, 0x34e3,
+    0x2de5, 0x97e6, 0x0875, 0x32e1, 0x1c38, 0x8304, 0x06c0, 0x050c, 0x84c9,
+    0x066c, 0x01e7, 0x8968, 0x012e, 0x866c, 0x8368, 0x0d10, 0x0a10, 0x0410,
+    0x0608, 0x839b, 0x0c79, 0x05e6, 0x87bc, 0x8a75, 0x0b03, 0x8ba3, 0x0afb,
+    0x8325, 0x8629, 0x839b, 0x022a, 0x8464, 0x8c5c, 0x8864, 0x0b81, 0x8421,
+    0x8054, 0x886c, 0x0171, 0x8150, 0x0075, 0x8c08, 0x0464, 0x8d2d, 0x8000,
+    0x08fb, 0x810c, 0x04ea, 0x8bee, 0x0a31, 0x0703, 0x8453, 0x829f, 0x899a,
+    0x027e, 0x84c9, 0x01a3, 0x092d, 0x88b0, 0x06e2, 0x092d, 0x0a42, 0x8c4f,
+    0x085c, 0x0c86, 0x09ff, 0x8032, 0x8208, 0x8864, 0x8315, 0x065b, 0x82f3,
+    0x066c, 0x884b, 0x0cde, 0x8768, 0x8358, 0x0b92, 0x0d7d, 0x8779, 0x8bab,
+    0x8829, 0x8c4f, 0x0c1d, 0x0453, 0x8581, 0x0896, 0x0957, 0x0ae2, 0x0011,
+    0x80c9, 0x8011, 0x886c, 0x01b4, 0x822a, 0x8208, 0x850c, 0x8725, 0x0421,
+    0x8581, 0x8810, 0xad93, 0x3579, 0x9d01, 0x3432, 0x2d4a, 0xa0a4, 0xb51f,
+    0x3343, 0x3443, 0xb0f7, 0xb4dd, 0x1f2f, 0xb4a1, 0x1bbe, 0xac78, 0x340d,
+    0x9e6e, 0x98eb, 0xa975, 0x2c59, 0x2ec1, 0x341d, 0x1d7c, 0x823a, 0x2466,
+    0xa3e4, 0x04b8, 0x2e16, 0x309a, 0x2cce, 0x2a0b, 0xaa12, 0x305e, 0xafd8,
+    0x15d0, 0xa914, 0xa5a1, 0x2ec2, 0x22fc, 0xa5bf, 0xa8a9, 0x2163, 0x22f4,
+    0x83bc, 0xa314, 0x2d9c, 0xaca9, 0x35a2, 0x2e65, 0xb11e, 0xa648, 0x2d83,
+    0xa2b0, 0x287e, 0x2c25, 0x24e6, 0x1f32, 0x13f0, 0x21bb, 0xad5b, 0x0421,
+    0x9831, 0x8d14, 0x10d7, 0x34e0, 0x19dd, 0x1d5b, 0x3392, 0x3528, 0x1ee4,
+    0x2ff4, 0xb13b, 0x18a8, 0xb07e, 0x9c6b, 0x1be0, 0x8150, 0x9f7a, 0xaacb,
+    0x1935, 0x35ce, 0xa65b, 0x9949, 0xb3b8, 0xad20, 0xb017, 0x9b15, 0xaf26,
+    0xb156, 0x9f69, 0x9a82, 0x2543, 0x2017, 0xacd8, 0x99c4, 0x2c06, 0xa024,
+    0x9d96, 0x2ada, 0xac47, 0xadb5, 0xb165, 0x313c, 0xab96, 0x2991, 0x3474,
+    0x9d7c, 0x301e, 0xada1, 0xb2c6, 0x2e19, 0x311f, 0xbe43, 0x2ef8, 0xb18b,
+    0xb9c5, 0xab38, 0x9d56, 0x9bea, 0x89ee, 0x3045, 0xb299, 0x079a, 0x12c2,
+    0xb237, 0x2e80, 0xb544, 0xb240, 0x1a49, 0x2d7d, 0xa81f, 0xac63, 0x3f7e,
+    0xa8d7, 0xae13, 0xb1ca, 0xaad7, 0x331a, 0x95c3, 0x85d5, 0xb0d7, 0x3c3b,
+    0x3636, 0x2a71, 0x24f8, 0x1ccf, 0x129a, 0x1ded, 0x9de8, 0x1177, 0x2340,
+    0x2c85, 0xb487, 0xad25, 0x19e3, 0x9b63, 0x0171, 0x2822, 0x0368, 0xb42a,
+    0x2ef8, 0x2c74, 0xaf58, 0x24df, 0xb1dc, 0xaed9, 0x2d47, 0x2af9, 0x3203,
+    0x1c00, 0x2a78, 0x18e1, 0x85e6, 0xa9bd, 0xa9ab, 0x3bd9, 0xb25b, 0x2016,
+    0x346e, 0x1e87, 0xb031, 0x3024, 0x36cb, 0x29bd, 0x3030, 0x3065, 0x1ed1,
+    0x19cc, 0xb4ad, 0x1d4b, 0xb479, 0x9e81, 0x0bb3, 0x0886, 0x8d81, 0x8914,
+    0x8e21, 0x09cd, 0x853e, 0x827e, 0x8992, 0x8829, 0x0b79, 0x8a42, 0x898a,
+    0x053e, 0x8808, 0x0000, 0x098a, 0x8ba3, 0x0960, 0x08c9, 0x8347, 0x0475,
+    0x8e10, 0x81d6, 0x8608, 0x8032, 0x8a42, 0x052d, 0x82c1, 0x8011, 0x04fb,
+    0x01f7, 0x8a4b, 0x80a8, 0x0a7d, 0x8000, 0x88e2, 0x8496, 0x8c14, 0x8464,
+    0x0c25, 0x8075, 0x03bc, 0x8496, 0x8853, 0x8832, 0x81b4, 0x89de, 0x04a7,
+    0x0853, 0x85a3, 0x8dd9, 0x08e2, 0x0011, 0x0496, 0x0a53, 0x8a31, 0x05b4,
+    0x0821, 0x06c0, 0x8947, 0x00c9, 0x82b0, 0x0b70, 0x8ef7, 0x8bee, 0x8075,
+    0x0443, 0x03cd, 0x826d, 0x8379, 0x065b, 0x8d47, 0x09a3, 0x838a, 0x84c9,
+    0x890c, 0x0043, 0x827e, 0x80fc, 0x8410, 0x82d1, 0x885c, 0x854f, 0x8054,
+    0x8c8e, 0x0925, 0x09cd, 0x889f, 0x09cd, 0x0957, 0x0a08, 0x02e2, 0x0c2e,
+    0x0f14, 0x03ac, 0x33c8, 0xb02f, 0xa39b, 0xa0b5, 0x34d7, 0x32d6, 0xa972,
+    0x9abb, 0xb885, 0x9ff0, 0x2cb4, 0x993c, 0x9e92, 0xb4d9, 0x3365, 0xa25a,
+    0x394f, 0x2307, 0xa524, 0xa2ce, 0xb2b4, 0xa611, 0x9435, 0x0e57, 0x1a5c,
+    0x3024, 0x013f, 0x9d39, 0xaca7, 0xb4bd, 0xb44a, 0xa35a, 0xab09, 0x34af,
+    0x9ef3, 0x1b09, 0x1b1a, 0x2d1a, 0x37d5, 0xa70b, 0x9c40, 0x2c5c, 0x3208,
+    0x82e2, 0x2130, 0xa09c, 0xb709, 0xb85f, 0x3279, 0xa5a6, 0xafb4, 0x30cf,
+    0x0e3e, 0x30e5, 0xb0c9, 0x355c, 0x3312, 0x2b3f, 0x3279, 0x81c5, 0x8886,
+    0x3051, 0x825c, 0xaa0b, 0xa13f, 0x2aa1, 0xb5e2, 0x31a0, 0x337e, 0x9a59,
+    0xb934, 0x293a, 0x9b34, 0x9a88, 0xa621, 0x9b7a, 0x84da, 0x3156, 0x2ed7,
+    0x9c85, 0x1e82, 0xad42, 0xafcf, 0x27e8, 0xacb2, 0x9f4d, 0xa0e8, 0xac59,
+    0xb408, 0xafb6, 0xb258, 0x2cff, 0x15fe, 0x21b0, 0xa29b, 0x22d5, 0xb4bb,
+    0x2620, 0x3b25, 0xa18e, 0xa91b, 0xb49f, 0xb5d9, 0x2832, 0x329c, 0xb4b2,
+    0xb135, 0xb03e, 0xabd8, 0x2fed, 0xae2c, 0x1fff, 0x9657, 0x32d8, 0x2e63,
+    0x1406, 0x1574, 0x99e4, 0xb6fa, 0x8a9e, 0x35a3, 0xb8ec, 0x8336, 0x35e8,
+    0x315a, 0x231f, 0xb085, 0xafc1, 0x34c3, 0xa4bc, 0x3640, 0x9ea3, 0xb57e,
+    0xb706, 0xba82, 0x2fdb, 0x1277, 0x2d99, 0x908a, 0x0629, 0x181b, 0x25b7,
+    0x14b7, 0x3427, 0xac03, 0x1e23, 0xb338, 0x2aa4, 0x1663, 0x2608, 0xaaaf,
+    0xa587, 0x9c44, 0xb4b0, 0x3093, 0x9f93, 0x8486, 0x3465, 0x050c, 0x372f,
+    0xb083, 0x2350, 0x11f7, 0x2073, 0x2767, 0x2e12, 0xaf92, 0x2201, 0x12ec,
+    0x26a3, 0xa30d, 0x1f19, 0x82e2, 0x2828, 0xb101, 0xb8bf, 0xa00c, 0xab22,
+    0xace5, 0xab6b, 0xa061, 0x2f65, 0x2a3b, 0xa749, 0x1ca1, 0x34d9, 0x349b,
+    0x22cb, 0x1066, 0xa212, 0x1ac1, 0x3a25, 0x2e0c, 0x34b3, 0xb4ca, 0x2a77,
+    0x1df1, 0x3431, 0x1735, 0x2eca, 0xaa08, 0x2d3f, 0x320f, 0xb0e7, 0xa4e5,
+    0xb7f8, 0x2478, 0x1e8e, 0x376b, 0x2f5f, 0xb151, 0x33d5, 0xb1a7, 0xa1e8,
+    0x2163, 0x0e3a, 0xaec0, 0x1c8b, 0x0a75, 0xae20, 0xa827, 0x1da9, 0x2c62,
+    0x2ac8, 0xb984, 0x2097, 0xb416, 0x1be4, 0x9407, 0x9ae5, 0xa8f6, 0x11d9,
+    0x18a1, 0x3309, 0x307b, 0x0810, 0xad08, 0x20a8, 0x3651, 0x3084, 0xa537,
+    0x3128, 0x2b04, 0x1960, 0x21a2, 0x217a, 0x29b6, 0x9116, 0x31cf, 0x2971,
+    0x989d, 0x2c14, 0x0cbc, 0x2377, 0x8097, 0xb66b, 0x2bae, 0x2d84, 0xaa52,
+    0x2c3d, 0x353a, 0x9cb0, 0xaaac, 0xb292, 0x2e38, 0x2bcb, 0xb2d9, 0xb226,
+    0x8957, 0x2f37, 0x9ed7, 0x9b31, 0x27d7, 0x185e, 0x224d, 0x2ffb, 0xaac3,
+    0x2ddf, 0xaba7, 0x3440, 0xa403, 0x9eab, 0xa230, 0xb5b5, 0xb16d, 0x283a,
+    0xad79, 0xaed0, 0xa56f, 0x1b56, 0x34b3, 0xa070, 0x2e59, 0x2be5, 0xb1d5,
+    0x244c, 0x3329, 0x2991, 0x1efb, 0xab53, 0x2105, 0xa1ff, 0xad80, 0xac71,
+    0x3bfc, 0x2eb8, 0x3149, 0x2cb9, 0x2e53, 0x2667, 0x2dbd, 0x09a3, 0x2580,
+    0x2e09, 0x0981, 0xb234, 0x294e, 0x1838, 0x9f69, 0x3554, 0x9c1a, 0x2068,
+    0x37ee, 0xa099, 0x1d7e, 0x32ef, 0x350d, 0xa14d, 0x206f, 0x1564, 0x2b4f,
+    0x8219, 0x1e74, 0xb0d4, 0xb1aa, 0x1467, 0x2120, 0xb0a0, 0xad44, 0x184d,
+    0xabaa, 0x3421, 0x15d6, 0xa945, 0x2df0, 0x9c35, 0x21ca, 0x2f6f, 0x8054,
+    0x25bf, 0x80c9, 0x2463, 0x1f31, 0x22fa, 0xa436, 0x1b06, 0x1e11, 0xa981,
+    0xa6c3, 0xb462, 0xb382, 0xb015, 0x33ab, 0x1b7b, 0x0032, 0xa2b9, 0x164d,
+    0xa5ef, 0x2144, 0xb1c6, 0x2041, 0xb1fd, 0xac36, 0xb138, 0xb153, 0x3110,
+    0xb18d, 0xb27b, 0xb66d, 0xad38, 0x9779, 0x1e6c, 0xb71a, 0x34f3, 0x0936,
+    0x8864, 0x8c25, 0x8315, 0x086c, 0x0022, 0x028e, 0x8150, 0x8571, 0x050c,
+    0x02e2, 0x0971, 0x8bdd, 0x8304, 0x83ac, 0x012e, 0x8832, 0x06c0, 0x8c4f,
+    0x0336, 0x026d, 0x05e6, 0x08b8, 0x8b9a, 0x0981, 0x87dd, 0x8097, 0x8d4f,
+    0x00b9, 0x88c9, 0x0a8e, 0x85c4, 0x854f, 0x8065, 0x01b4, 0x85d5, 0x824b,
+    0x863a, 0x0c2e, 0x085c, 0x829f, 0x8443, 0x05d5, 0x0810, 0x850c, 0x0432,
+    0x810c, 0x85e6, 0x8925, 0x026d, 0x0432, 0x8bdd, 0x8903, 0x8325, 0x869e,
+    0x8571, 0x8c25, 0x0b81, 0x0746, 0x81f7, 0x08ea, 0x06d1, 0x89ee, 0x0b3e,
+    0x8a75, 0x8810, 0x8208, 0x8475, 0x8150, 0x88d1, 0x07ee, 0x8829, 0x84a7,
+    0x8a21, 0x88c0, 0x8421, 0x0432, 0x01e7, 0x0832, 0x0496, 0x090c, 0x885c,
+    0x03ff, 0x0dbc, 0x0618, 0x85c4, 0x81e7, 0x01a3, 0x8a5b, 0x8b35, 0x04b8,
+    0x0208, 0x8703, 0x84ea, 0x8608, 0x051d, 0x31fd, 0xb0be, 0xaeab, 0x1e40,
+    0x32fd, 0x3051, 0xa8e2, 0x3446, 0xa4c3, 0xb4bc, 0x96d0, 0x2acf, 0x97dc,
+    0xa3d9, 0xb081, 0xb3d3, 0x181b, 0x27a4, 0xae87, 0x22f4, 0x31c5, 0x9ef2,
+    0x3060, 0x8c3e, 0x2165, 0x9d4c, 0x88d1, 0x2ed0, 0x2160, 0x1e8b, 0x9b71,
+    0xb958, 0x2043, 0x31da, 0xabe7, 0xab37, 0x22b8, 0x1f72, 0x340c, 0xb398,
+    0xb140, 0x2978, 0x2d3c, 0x8b03, 0x29a5, 0xa0ea, 0x34ec, 0xb624, 0xb4c0,
+    0xad73, 0xbac3, 0x31f6, 0x21ad, 0x1908, 0xb20c, 0x9c94, 0xa120, 0x2281,
+    0x2188, 0xb642, 0x8c5c, 0xb11c, 0x80eb, 0x9c99, 0x1b6d, 0xa905, 0x825c,
+    0x2668, 0x1e92, 0x9678, 0xb450, 0x2403, 0xb2c6, 0x330b, 0xa278, 0x2103,
+    0x8735, 0x25cc, 0x1cdb, 0x976e, 0x96f6, 0x1c10, 0x9cae, 0xa0e3, 0x2982,
+    0x345d, 0x35ef, 0x2c8c, 0xa134, 0x2f78, 0x34cf, 0xac33, 0xb2a4, 0x12fb,
+    0x1c10, 0x3150, 0xb1ca, 0x2645, 0x328d, 0x9565, 0x320b, 0x1930, 0xac5c,
+    0x2aff, 0xbb26, 0x2c7f, 0x9f4a, 0xa53e, 0xa9c8, 0xa49d, 0xae51, 0xae07,
+    0xaaf7, 0x3695, 0x2761, 0xb46b, 0xa831, 0x3156, 0xa6c3, 0x0992, 0x34a7,
+    0xa457, 0x0022, 0x20c7, 0x2ab7, 0xb2a2, 0xb220, 0xb04b, 0xb0cc, 0x1903,
+    0x9f67, 0xb1e6, 0x938e, 0xa770, 0x9cac, 0x1c8d, 0xa9d7, 0xa0cf, 0x3158,
+    0x8022, 0xa2f9, 0x3550, 0x1c5e, 0xb78c, 0x1618, 0xa244, 0xb63b, 0x3475,
+    0x1bcd, 0x9b90, 0xa656, 0x2f44, 0x1955, 0xb173, 0xa3af, 0xa73f, 0x0054,
+    0x239a, 0x8d47, 0xbc44, 0xab13, 0x13ff, 0xb8aa, 0xac51, 0x2c96, 0xa852,
+    0xb71a, 0x1b89, 0x1e80, 0x2351, 0x28f5, 0x1f3d, 0x0032, 0xb105, 0xaacc,
+    0xa4cf, 0x29e4, 0xa464, 0xb1d6, 0xac33, 0xb17e, 0x2c38, 0x2817, 0x2e9c,
+    0x2d8c, 0x333b, 0xa134, 0xa137, 0xad83, 0x2358, 0xa710, 0x3358, 0xb491,
+    0xae9f, 0x9409, 0x8b89, 0x3338, 0xaa2b, 0x9723, 0xa805, 0xa9ef, 0x9983,
+    0xb471, 0xac8a, 0xb02d, 0x285b, 0x313b, 0x114d, 0xb528, 0x1ab4, 0xac97,
+    0xa985, 0xa1c9, 0x1d8f, 0x0e68, 0x8ba3, 0xa04e, 0xa937, 0x0c8e, 0xa614,
+    0xabe0, 0x2660, 0x17d3, 0xb7d4, 0x2c25, 0xb57d, 0xb3cd, 0xad2a, 0x397c,
+    0x9b2e, 0xb3a9, 0xb27d, 0xb241, 0x0c92, 0x97ad, 0x8b92, 0x2eae, 0x1c42,
+    0x1d4e, 0x188d, 0xa83a, 0xb148, 0xa9ba, 0x21ac, 0xae55, 0x1add, 0xa808,
+    0x35b4, 0xbc0d, 0xadc2, 0xb69f, 0xb557, 0x8c9b, 0xad1b, 0x8e53, 0xac34,
+    0x3007, 0x25d3, 0x9aa6, 0xb3c7, 0xba43, 0xa581, 0x1ec0, 0x3984, 0x1d17,
+    0xb636, 0x2033, 0x35d5, 0x8a18, 0xb97c, 0x2474, 0x36c1, 0x997a, 0x9d64,
+    0x38b3, 0x08f3, 0x2ec8, 0xa526, 0xa599, 0x960f, 0x2c09, 0x346c, 0xace3,
+    0x2fdd, 0xaa59, 0x220c, 0x0d81, 0xa9fe, 0x83ef, 0x8421, 0x08a7, 0x8d03,
+    0x0097, 0x89cd, 0x0629, 0x03ef, 0x8971, 0x85a3, 0x06af, 0x8e03, 0x80b9,
+    0x851d, 0x826d, 0x83cd, 0x00b9, 0x8219, 0x80a8, 0x0315, 0x83bc, 0x0011,
+    0x883a, 0x0821, 0x0608, 0x08fb, 0x82c1, 0x87ff, 0x0c0c, 0x850c, 0x88f3,
+    0x01d6, 0x8a85, 0x85b4, 0x826d, 0x06af, 0x88fb, 0x8a96, 0x02e2, 0x08b8,
+    0x0b46, 0x0486, 0x8779, 0x0a64, 0x83ac, 0x0c10, 0x0097, 0x8981, 0x09cd,
+    0x0864, 0x869e, 0x09cd, 0x8304, 0x029f, 0x0c21, 0x0336, 0x0971, 0x8c86,
+    0x8208, 0x851d, 0x8c60, 0x8379, 0x83bc, 0x8c32, 0x8560, 0x0a31, 0x0c5c,
+    0x84da, 0x87dd, 0x08ea, 0x88c0, 0x0b89, 0x0b79, 0x8b79, 0x8421, 0x02d1,
+    0x0325, 0x8ae2, 0x85c4, 0x098a, 0x8560, 0x85d5, 0x054f, 0x04b8, 0x09e6,
+    0x0d32, 0x8819, 0x82d1, 0x88e2, 0x8b0c, 0x0325, 0x8592, 0x87cc, 0x8925,
+    0x0768, 0x8358, 0xa3e5, 0xb10b, 0x9f8e, 0x2da8, 0xb279, 0x24b2, 0xb304,
+    0x3709, 0xb02b, 0x1c16, 0x24e0, 0xb5de, 0x266c, 0xb055, 0x30d4, 0x289d,
+    0xaef8, 0xadc4, 0xa557, 0x3089, 0x27cd, 0xa6f1, 0xaa2b, 0x0043, 0x2b0b,
+    0x9d38, 0x0843, 0xa180, 0x3203, 0x1e3b, 0x345a, 0xa469, 0x1de7, 0x1fdf,
+    0xae0f, 0x2ea0, 0xa85f, 0x867d, 0xbad9, 0x183b, 0xae6f, 0x9d8c, 0xb214,
+    0x01a3, 0x2d04, 0xb311, 0xb5ca, 0x1cfb, 0xad87, 0x97a0, 0x3409, 0xb55b,
+    0xac78, 0x2c1f, 0x3400, 0x1eca, 0x9c3a, 0xab11, 0x1c72, 0xa52f, 0x0cd5,
+    0x2879, 0x827e, 0xb473, 0xb57d, 0x3036, 0x22ed, 0xa395, 0x350a, 0x297b,
+    0xa956, 0x99f1, 0x83de, 0x35f2, 0x2182, 0xbfda, 0x0150, 0x2aa2, 0x31f3,
+    0xbd17, 0x19ad, 0x2ab1, 0x345e, 0x3015, 0xafbb, 0x2bef, 0x1a63, 0xae49,
+    0x18f9, 0x2b96, 0x30b3, 0x9f23, 0x2ce7, 0x9389, 0x2d00, 0xb2f3, 0xa432,
+    0x2c75, 0x2901, 0x304a, 0xa87a, 0x237b, 0x1d8e, 0xa99b, 0x1bdc, 0x35c2,
+    0xa74b, 0x8cfb, 0xa0df, 0xb034, 0x2183, 0x2f63, 0xbf80, 0x1f67, 0x9b50,
+    0x8a4b, 0x9f31, 0x2163, 0x283c, 0x89cd, 0xab0a, 0x1e7a, 0x8453, 0x26f4,
+    0x184a, 0xad47, 0x294d, 0x2869, 0xab88, 0x228a, 0xad8d, 0xada2, 0xbd0e,
+    0x195a, 0xb897, 0xa931, 0xab18, 0xa742, 0x2997, 0x08ea, 0xa7ca, 0xa6a7,
+    0xb361, 0xb052, 0x3416, 0x3065, 0x2c63, 0x9810, 0x0dff, 0x3556, 0xa360,
+    0x9efc, 0x28ed, 0x211f, 0x8c21, 0x2f31, 0x03ef, 0x2574, 0x88f3, 0xb044,
+    0xa97e, 0xa41c, 0x310a, 0x9fc6, 0x3014, 0x19ce, 0x183f, 0xa9a8, 0xb176,
+    0x34d1, 0x31a0, 0xb501, 0x8832, 0xa19a, 0x254e, 0xa025, 0x339a, 0x1f9a,
+    0x2fed, 0x2556, 0xb2ce, 0x21ed, 0x32a5, 0x9f41, 0x2d54, 0xb0e0, 0x9f9b,
+    0x9301, 0x3a50, 0x2e47, 0x1960, 0xa6ee, 0x30c5, 0x3148, 0x95b9, 0x3086,
+    0xa6d2, 0xb0d5, 0xaacd, 0x23ed, 0x2124, 0x3361, 0xb91c, 0x2721, 0xaf05,
+    0x24b7, 0x30ce, 0x2a4c, 0x9c3c, 0xa80e, 0xae75, 0x1d90, 0xa4fb, 0x2f90,
+    0x2f29, 0x012e, 0x1d00, 0xac20, 0x8097, 0x1c1c, 0x3465, 0x30c5, 0xb027,
+    0xb314, 0x9a76, 0x31d4, 0x223a, 0x1d79, 0x9584, 0x9ced, 0x2117, 0x18d6,
+    0x31ca, 0xb302, 0xa9b8, 0x087d, 0x1f77, 0x9a6b, 0x196a, 0x1cbe, 0xadfc,
+    0xa843, 0x8304, 0x9841, 0xbc45, 0x299a, 0x1690, 0x2c89, 0xa103, 0xa9a5,
+    0x9476, 0xadb8, 0x0a85, 0x2596, 0x8453, 0xacb5, 0x22bf, 0x29b2, 0xb208,
+    0xafd0, 0x2224, 0x2b11, 0xb1bb, 0x3199, 0x3470, 0xa687, 0x2cac, 0x1d65,
+    0x85a3, 0xb2c4, 0x3345, 0x1dc7, 0xab36, 0x9753, 0x20ab, 0xaec7, 0xb13b,
+    0x2e82, 0x252e, 0x349e, 0x1cf8, 0x0054, 0x17f3, 0xb4bc, 0xb57d, 0xa963,
+    0xaf2a, 0x255a, 0xb495, 0x0054, 0x1e0e, 0xa98d, 0x27ad, 0xac6e, 0x2c58,
+    0xaf19, 0x2fd5, 0x2ce0, 0x9add, 0x362f, 0x25ec, 0xa086, 0xac53, 0xae8b,
+    0x83cd, 0x2968, 0x21f1, 0x3780, 0xb3e2, 0x1aed, 0x3011, 0x81f7, 0x9d96,
+    0x3128, 0x0bbc, 0xa75a, 0xa70d, 0xa99e, 0x326e, 0x2c3c, 0xae91, 0x2427,
+    0xa8c8, 0xb43e, 0x9d39, 0x2e47, 0xbc0c, 0x22c5, 0x1ceb, 0x9f5d, 0xad00,
+    0x0358, 0x3001, 0x3427, 0xaba0, 0x1f51, 0x2b89, 0x17cb, 0xb482, 0xa462,
+    0x2523, 0xa654, 0xb242, 0x2080, 0x338b, 0x9166, 0xa3e0, 0x2845, 0x80da,
+    0xa692, 0x01a3, 0xb60f, 0xb091, 0xa2fa, 0x286e, 0x30b7, 0x8f89, 0x29db,
+    0x9f71, 0xb094, 0xac60, 0x3440, 0xa58b, 0xb830, 0x0768, 0x284f, 0xaac6,
+    0x1edf, 0xa45f, 0x341b, 0xa157, 0x32f7, 0x9d16, 0xafbf, 0x27b3, 0xb286,
+    0xb077, 0x2099, 0x9e44, 0x3608, 0x9b4e, 0x306f, 0x0f96, 0x2577, 0x28c0,
+    0x2a22, 0x2221, 0x244b, 0xb9af, 0xb432, 0xa06d, 0x35f1, 0x2f36, 0x93c2,
+    0xafa4, 0xb466, 0x23fc, 0xad0b, 0x1f3d, 0xacc7, 0x15fe, 0x2d71, 0x2cd5,
+    0x2a5a, 0xacbe, 0x1ce1, 0x29a6, 0x0afb, 0x211c, 0x9e17, 0x0c81, 0xa615,
+    0x2ef1, 0xb014, 0x2972, 0xb0d2, 0x18c1, 0x10a9, 0x31a6, 0x983f, 0x118a,
+    0xa131, 0x26fd, 0x2024, 0xc1df, 0x95f6, 0xab02, 0x08c9, 0x2806, 0x1fe6,
+    0x32f6, 0x2fa6, 0xae19, 0xa517, 0x9477, 0x29f7, 0x3479, 0xaa8c, 0x96ad,
+    0x9951, 0x2a42, 0x2caa, 0x2326, 0xa463, 0x8c81, 0x9a92, 0x8ca7, 0xa0dd,
+    0xb76d, 0x8fa7, 0xa4de, 0x1eb0, 0x29ac, 0xb23f, 0xae9f, 0x983b, 0x9e1f,
+    0xb2ca, 0xa14d, 0xa45b, 0x82c1, 0xb027, 0x308d, 0xba2a, 0xb1ed, 0xb46f,
+    0x1ef7, 0xa878, 0xae39, 0x9d20, 0x1ee2, 0x2d0c, 0x181c, 0x2ad8, 0x2c25,
+    0xa1af, 0xbc08, 0x2f1a, 0x245e, 0x17ad, 0xa82b, 0x907d, 0x9ce8, 0x946c,
+    0x380f, 0xacfa, 0x2d1e, 0x9ec6, 0xb804, 0x1d64, 0xaf28, 0xb78d, 0xae6f,
+    0x214c, 0x25ab, 0xa17f, 0x31d5, 0xa170, 0x238b, 0x2075, 0x318b, 0xa232,
+    0x2a2f, 0x87cc, 0xb04a, 0x1819, 0x813f, 0x1cd0, 0x362b, 0x2d84, 0xa4d0,
+    0x2c75, 0x38af, 0xa8ee, 0x28eb, 0xb2fc, 0x1f0d, 0x2169, 0x373b, 0xa1d1,
+    0xb032, 0xb206, 0xa161, 0x022a, 0x2a1f, 0x3536, 0x3865, 0xba2b, 0x21db,
+    0xa17a, 0xac19, 0x9988, 0xa3a6, 0x3587, 0x19d5, 0x272d, 0x9f20, 0xaf69,
+    0x1c4c, 0x192f, 0x886c, 0xb40b, 0x8725, 0x2ebb, 0x3626, 0x2c42, 0xa7c0,
+    0xadad, 0xb0d4, 0xa2fa, 0x208c, 0x2cb5, 0xb6ab, 0xa4de, 0x2c4d, 0x9a13,
+    0x0608, 0x993f, 0xac87, 0x208e, 0xb4d0, 0x925b, 0xa0d2, 0xb284, 0x2c9c,
+    0x3138, 0x2fde, 0xa24f, 0x2b03, 0xa821, 0x9968, 0x0c5c, 0xb871, 0xa519,
+    0x32d4, 0xaab6, 0x2e44, 0xb21f, 0x2727, 0xb1d2, 0x2bd9, 0xa4e1, 0x2173,
+    0xaeb3, 0x3863, 0x9ed8, 0xb521, 0x3457, 0xaee2, 0x2dfd, 0x2d4f, 0x28cc,
+    0x883a, 0x2110, 0xa37a, 0x349c, 0xa9f8, 0x2cd1, 0x2e0f, 0x0065, 0xaf83,
+    0x9cb9, 0x091d, 0x249f, 0x27f9, 0x1b7f, 0xa5df, 0xae5b, 0x356d, 0x21ee,
+    0x2e14, 0x28bf, 0xb3e2, 0xa3d9, 0xaa63, 0xb1f2, 0x2e47, 0xac07, 0x3402,
+    0x84c9, 0xa86d, 0x1f57, 0xb2b8, 0x3484, 0xb261, 0xab25, 0x9f62, 0x201d,
+    0x9af8, 0x11ba, 0xb840, 0xa059, 0x9e03, 0x0fff, 0x2293, 0xb149, 0x0a21,
+    0x30b2, 0x8a08, 0x39da, 0xb4ad, 0x2c80, 0x34d3, 0xb58c, 0x2d8d, 0xb08d,
+    0xa863, 0x36f2, 0x20e3, 0x20dd, 0x3488, 0xaf4d, 0x86c0, 0xb6c2, 0xb20d,
+    0x9e36, 0x250a, 0xaa14, 0x38b9, 0x28bf, 0x1c81, 0x2a8d, 0x3238, 0x1765,
+    0xa43d, 0x29ef, 0xb0b3, 0x2593, 0x2fc0, 0x9b48, 0xb5fa, 0x1dd4, 0x9d65,
+    0x04a7, 0x34e8, 0x328d, 0x2ce5, 0xacbd, 0x15ed, 0x2c0b, 0xb1b3, 0x26a1,
+    0x2e16, 0x2fd4, 0xaa06, 0xb4d0, 0xacda, 0x320c, 0xa9f5, 0x315f, 0x30a1,
+    0x9d44, 0x309e, 0x343b, 0x3454, 0x0d81, 0x968a, 0xa2ce, 0x052d, 0x27b0,
+    0x3486, 0x8a18, 0x9f02, 0xa1cb, 0x12a3, 0x25fa, 0x32a3, 0xa4a5, 0xa2f3,
+    0x1bc3, 0xbabc, 0xab59, 0xaa21, 0xb457, 0x3138, 0x8821, 0x2421, 0xa9f9,
+    0xb1f2, 0xbbae, 0x1d04, 0x9fb1, 0xb1d7, 0x1ee2, 0xb4a7, 0x306d, 0x2c7a,
+    0xa464, 0xb44b, 0x2538, 0x2550, 0xadf5, 0x80da, 0xb02a, 0x8a85, 0xbc73,
+    0x1909, 0x24f3, 0x989e, 0xa010, 0xb1d2, 0x21f1, 0xace7, 0xad16, 0xb5ff,
+    0x2136, 0x3029, 0xbcbf, 0x810c, 0x9b4a, 0xadab, 0x9e5c, 0x9e09, 0xa9a3,
+    0x3035, 0xa98e, 0xa71b, 0x2adb, 0x1b92, 0x9c90, 0xa8e1, 0x9e00, 0x2a64,
+    0xa034, 0x9938, 0x98e5, 0x0dee, 0x35a2, 0x0757, 0x08a7, 0x0d18, 0x850c,
+    0x0703, 0x0193, 0x8496, 0x851d, 0x079a, 0x051d, 0x0df3, 0x8757, 0x864b,
+    0x824b, 0x086c, 0x8de2, 0x8219, 0x88b0, 0x00da, 0x8e57, 0x8410, 0x88d1,
+    0x0703, 0x8886, 0x87bc, 0x85a3, 0x0608, 0x0336, 0x0097, 0x069e, 0x8065,
+    0x812e, 0x07ee, 0x02e2, 0x8be6, 0x883a, 0x05f7, 0x82b0, 0x03cd, 0x85b4,
+    0x8011, 0x0618, 0x8f21, 0x0bff, 0x02c1, 0x0d9f, 0x8808, 0x812e, 0x0097,
+    0x8b81, 0x0443, 0x03ac, 0x0c19, 0x0453, 0x8968, 0x079a, 0x81a3, 0x0043,
+    0x82e2, 0x029f, 0x09d5, 0x8875, 0x8757, 0x812e, 0x8c25, 0x80b9, 0x8a64,
+    0x8864, 0x88c0, 0x886c, 0x8086, 0x8379, 0x8560, 0x0608, 0x8703, 0x03cd,
+    0x8011, 0x067d, 0x027e, 0x850c, 0x0571, 0x8a85, 0x0347, 0x88d1, 0x079a,
+    0x0453, 0x85d5, 0x8a85, 0x09c4, 0x02d1, 0x8cc0, 0x8853, 0x8032, 0x0bd5,
+    0x8914, 0x0054, 0xb12a, 0x9ff9, 0xb292, 0xa363, 0x2056, 0x9dcd, 0x32e9,
+    0xaee0, 0x26d8, 0xb21f, 0xa2c7, 0x290f, 0x184e, 0x26b3, 0xb4dc, 0xa338,
+    0x341c, 0x2998, 0xb978, 0x1d61, 0x1db6, 0x366c, 0x9f13, 0x0453, 0xabb9,
+    0xb517, 0x81c5, 0xa889, 0x1cc0, 0xb230, 0xa1b2, 0xbc72, 0x99e4, 0x2b1c,
+    0xb757, 0xb2db, 0x9e89, 0xa92c, 0x2445, 0x22d3, 0x9134, 0xb032, 0x2a6e,
+    0x0981, 0x3465, 0xa17b, 0xb29a, 0x2c6e, 0x2d77, 0x2c3b, 0xa8fc, 0x90ee,
+    0xa9f7, 0x322a, 0xb03e, 0x29f6, 0xad61, 0xa554, 0xad44, 0xb375, 0x025c,
+    0x287c, 0x0325, 0x0065, 0x2cc0, 0xa4fa, 0xa404, 0xb1a6, 0x1e23, 0xadc0,
+    0xa4c4, 0xa3ea, 0xa03b, 0x1bd5, 0xa4df, 0x8c9b, 0x0725, 0xb202, 0x305e,
+    0x9b24, 0x36dc, 0x939e, 0x309e, 0x1a0d, 0xb8b3, 0x2c18, 0x2b6b, 0x298e,
+    0x312e, 0xb4e1, 0x33e6, 0x9aa6, 0x0d25, 0xb48f, 0x35b8, 0x34aa, 0xb40c,
+    0x288d, 0x3794, 0x2f6c, 0x3163, 0xb90b, 0xa1b2, 0xb570, 0xaea0, 0x2ad2,
+    0xb799, 0x991f, 0x225b, 0x1f16, 0x0b35, 0x2b25, 0xa227, 0x3142, 0x344a,
+    0x2dc0, 0x2a44, 0xa76a, 0x1309, 0x0757, 0x3106, 0xb029, 0x8629, 0x30a6,
+    0xae7d, 0x1b9f, 0xb09e, 0x28f9, 0xa9c5, 0x25f7, 0x31ee, 0xb28a, 0x1116,
+    0xafa3, 0x2d92, 0x250a, 0xae20, 0x259c, 0x3457, 0x8453, 0xad15, 0x1e96,
+    0xb137, 0xa1f1, 0x98ea, 0x3080, 0xac7d, 0x3512, 0xb075, 0x2c4f, 0xb36d,
+    0xb037, 0x3420, 0xb299, 0xb6d6, 0xa31e, 0x8d96, 0x3044, 0x80c9, 0xa6c2,
+    0x1b5c, 0x291b, 0xa8e5, 0x9bc3, 0x34a4, 0xaf1a, 0xb47f, 0x33f0, 0xa1a0,
+    0x91f5, 0x3005, 0xb491, 0x850c, 0xb109, 0x29a4, 0xbe18, 0x2c73, 0x9d77,
+    0x37e5, 0xb153, 0xb5a8, 0x1b0f, 0x2e5a, 0xae98, 0x1ccc, 0x3079, 0x9e63,
+    0x30b2, 0xb5f8, 0xadfd, 0x3022, 0x382f, 0x84ea, 0x0496, 0x85d5, 0x853e,
+    0x8a64, 0x013f, 0x85e6, 0x8c0c, 0x81d6, 0x8914, 0x8be6, 0x0304, 0x039b,
+    0x0379, 0x88c0, 0x0725, 0x886c, 0x8182, 0x82f3, 0x8325, 0x825c, 0x0ad9,
+    0x0789, 0x8c43, 0x8960, 0x0c64, 0x80fc, 0x87ff, 0x0703, 0x0779, 0x8afb,
+    0x05c4, 0x0325, 0x0768, 0x8703, 0x0571, 0x038a, 0x0432, 0x0725, 0x0358,
+    0x0315, 0x827e, 0x03bc, 0x084b, 0x063a, 0x00b9, 0x8347, 0x04da, 0x8560,
+    0x8171, 0x8808, 0x0d32, 0x813f, 0x067d, 0x04fb, 0x0810, 0x0cb8, 0x80c9,
+    0x024b, 0x0496, 0x0714, 0x87bc, 0x8c3a, 0x80da, 0x08e2, 0x069e, 0x8bd5,
+    0x8dbc, 0x038a, 0x81e7, 0x0464, 0x0914, 0x08da, 0x0032, 0x80b9, 0x8160,
+    0x8c0c, 0x08fb, 0x85e6, 0x80eb, 0x8768, 0x8160, 0x87bc, 0x884b, 0x02e2,
+    0x89bc, 0x8475, 0x838a, 0x093e, 0x8097, 0x0054, 0x0914, 0x88a7, 0x0a9e,
+    0x83ff, 0x0496, 0x3399, 0x308b, 0x3320, 0x2ebc, 0x32bd, 0x321b, 0xae7c,
+    0xa9b2, 0x2e87, 0xad64, 0x9c9f, 0xadd1, 0x1f10, 0xb666, 0x28e3, 0xa00f,
+    0xa208, 0xa1ce, 0x2058, 0x9f15, 0x271c, 0x30ac, 0x1a16, 0x8475, 0xa835,
+    0x2683, 0x067d, 0xad8d, 0x330c, 0x20e2, 0x2e8b, 0xb8c3, 0xb0c4, 0xaa48,
+    0x2608, 0x2396, 0x0dd1, 0x338f, 0xa021, 0x3269, 0x2ad1, 0x34df, 0x30ec,
+    0x83de, 0xa94e, 0x3302, 0x9c58, 0x3279, 0xb071, 0xb1ec, 0x281b, 0x2a5a,
+    0x3475, 0xb505, 0xa2e3, 0xaf4b, 0xb2e4, 0x2fa3, 0xb4e4, 0x2c66, 0x086c,
+    0x30c6, 0x0b3e, 0xa618, 0x3125, 0xadd3, 0x3045, 0x23f4, 0x9cbd, 0xafc7,
+    0x2b2c, 0xad9e, 0xb4e2, 0xc0dc, 0x26c5, 0x9049, 0x88b8, 0xa105, 0xae64,
+    0xa33f, 0xa520, 0xb9c7, 0x9525, 0x2c52, 0x304b, 0xb195, 0xb240, 0x32c4,
+    0x9575, 0x281f, 0xb472, 0x3423, 0xacf9, 0x3548, 0xa95a, 0xaf66, 0xa550,
+    0xadfd, 0x3249, 0xac2c, 0x319f, 0x914d, 0xa97b, 0x9de3, 0xa548, 0x2d84,
+    0xad09, 0xa4db, 0xa93f, 0x20bc, 0x21e2, 0xb40a, 0x15ed, 0x1d93, 0x2fce,
+    0x1b0d, 0xaf7f, 0xb7f9, 0x99c7, 0x0065, 0x300a, 0x2eb6, 0x0779, 0x2970,
+    0xb338, 0x24ba, 0x1d51, 0xaccf, 0xb0f5, 0x264f, 0xa27c, 0x0a85, 0x8808,
+    0x1476, 0x3549, 0x2840, 0xa53b, 0xa4cd, 0x3541, 0x80fc, 0x315a, 0xadde,
+    0x219c, 0xb023, 0x2fa6, 0x30b8, 0xa91c, 0x2bd0, 0xaa34, 0x3002, 0xb99b,
+    0x3312, 0xa407, 0x30a5, 0xa2af, 0x0d57, 0x051d, 0xabeb, 0x010c, 0x3129,
+    0xb188, 0x2eb3, 0xb801, 0x2531, 0x1090, 0xb70b, 0xb91e, 0x3710, 0x1c38,
+    0xb0b0, 0x2f1f, 0x9f8d, 0x88b8, 0xb051, 0xab24, 0xbd01, 0x2b73, 0xad0b,
+    0x3a7c, 0x9aa7, 0xb653, 0x2961, 0x3271, 0xad38, 0xae8b, 0x9ba8, 0xa663,
+    0x322b, 0xae19, 0x20eb, 0x1d24, 0x1e4a, 0x2f63, 0x306c, 0x26d8, 0xac4b,
+    0xb1f5, 0x161e, 0x9b5c, 0xa8a2, 0xb5ed, 0x9266, 0x2866, 0x9ac3, 0x1eb2,
+    0x34f0, 0xb6e2, 0x30f8, 0x1f97, 0x9c8b, 0x3531, 0xb7fa, 0x9253, 0xaaf0,
+    0x1e80, 0x8182, 0x1c24, 0x2a00, 0x027e, 0xa0cf, 0x24c7, 0x31b0, 0xb53c,
+    0x249c, 0x327f, 0xa166, 0x325c, 0x1f7d, 0x0182, 0x2c2f, 0x3196, 0xad82,
+    0x3051, 0x30ed, 0xb175, 0x00da, 0x2811, 0x1389, 0x228f, 0xb8cf, 0x96d6,
+    0x1710, 0x20b4, 0x286f, 0x2684, 0xae4d, 0x32a5, 0x2158, 0xb2c3, 0xa499,
+    0x32be, 0x2bd3, 0x8981, 0x9a32, 0x8208, 0xa37d, 0xab35, 0xac0a, 0x3432,
+    0x2e9e, 0xb7e8, 0x9988, 0x33d1, 0x2a42, 0x2ae9, 0xb4b6, 0x1d83, 0xbc1a,
+    0x0475, 0x2c5e, 0xa02b, 0x357b, 0x2895, 0xb143, 0x1f7d, 0xb072, 0xb00e,
+    0x2372, 0x2789, 0xa452, 0x2410, 0x28d1, 0xa18f, 0x3692, 0x0cd5, 0x2046,
+    0x30c4, 0x9a5a, 0x370a, 0x205c, 0xb6aa, 0xaa9b, 0x32f1, 0x39fc, 0xb350,
+    0x2c10, 0xb005, 0x2db4, 0x3845, 0x1e86, 0xb1f0, 0x9d7d, 0x2076, 0xb001,
+    0x33ac, 0xa73e, 0xb849, 0x2038, 0xa06c, 0x283f, 0x2974, 0x8000, 0xaed0,
+    0x91a1, 0x08b8, 0xb252, 0x15db, 0xa74a, 0xae73, 0x2831, 0xb30b, 0x2795,
+    0xb808, 0x9d47, 0x1fcb, 0x35d9, 0x34a6, 0x9c0a, 0xb140, 0xa476, 0x3057,
+    0x010c, 0x28ae, 0x37d2, 0x21ca, 0xb499, 0x2fb3, 0xa9a6, 0x341f, 0x2cf4,
+    0x3156, 0x345c, 0xab10, 0x9627, 0x95da, 0x229e, 0x2d8e, 0x0a8e, 0x0c68,
+    0x2de2, 0x0832, 0xa21a, 0xacf2, 0x9da5, 0xb50a, 0x25e8, 0xb4c0, 0xb619,
+    0xb62a, 0x3246, 0xac78, 0xa0ed, 0x9cc5, 0xa069, 0x80b9, 0x224b, 0x1d4d,
+    0x010c, 0xacee, 0xa0b0, 0x3a1c, 0xb18b, 0xb427, 0xa45b, 0x2987, 0x286c,
+    0xb522, 0xaa2c, 0xb507, 0x8c57, 0xb50a, 0x9d3e, 0xa477, 0xb4cb, 0xa33d,
+    0x1253, 0x36be, 0x3046, 0x8325, 0x22e9, 0x268b, 0xa7e2, 0x2cf1, 0xaaf3,
+    0xae38, 0xb1fb, 0x2494, 0xad66, 0xa954, 0xa498, 0x2d34, 0x2f0e, 0x3808,
+    0x35ef, 0x2c8e, 0x2a75, 0x2ce1, 0x09ee, 0x3869, 0x0d29, 0x09c4, 0xa46c,
+    0x30ba, 0xb283, 0x2549, 0x992f, 0x320c, 0x9c42, 0x3967, 0x20b8, 0xb293,
+    0x8592, 0x241a, 0x3033, 0x91b6, 0xac7b, 0xa834, 0x8810, 0xac82, 0x1e79,
+    0xb27a, 0xab8a, 0x324f, 0x2494, 0xb0a0, 0x239d, 0x2c22, 0x2ef6, 0x2f7a,
+    0x3058, 0x37b4, 0x2c37, 0x1e43, 0x364d, 0x8097, 0x108a, 0x89e6, 0x2c97,
+    0xb022, 0x2c25, 0x2d34, 0xa1dd, 0xb562, 0x1e1a, 0x233f, 0xaf9d, 0xb446,
+    0x3826, 0x1779, 0x16ac, 0x0b57, 0x2200, 0xa48a, 0xa563, 0x34ac, 0x33c7,
+    0xb41a, 0x310a, 0x23b3, 0x9cf9, 0xaea2, 0xadd7, 0x3477, 0xafb3, 0x3067,
+    0x3092, 0x1d58, 0xb36b, 0x1a79, 0x34a1, 0x2c53, 0x2dc6, 0x2f02, 0x2e8e,
+    0x2a61, 0xae98, 0xac30, 0x2e77, 0xb472, 0xae5f, 0xa323, 0xb3d6, 0x31c8,
+    0x8fc4, 0x2876, 0x2f74, 0xb7bb, 0xb339, 0x12c4, 0xac43, 0x3061, 0x2d1e,
+    0xaea3, 0x8a53, 0x2cbe, 0x1f34, 0x013f, 0x1d69, 0x2fd1, 0x22b6, 0xb107,
+    0x2966, 0x3136, 0x2db6, 0xa18a, 0x1808, 0x9cc5, 0x2df3, 0x31fc, 0xb34f,
+    0xa874, 0x279c, 0x2629, 0x0011, 0x146f, 0x3e40, 0x3cf4, 0xb283, 0xb0af,
+    0x32b1, 0xb061, 0x97b5, 0x9ee7, 0x335a, 0x299d, 0x2b32, 0xb021, 0x3086,
+    0x2e5c, 0x1f9a, 0x852d, 0x2998, 0x08e2, 0xb298, 0x2d30, 0x2d01, 0x3529,
+    0xac28, 0x2d86, 0x30bf, 0x2d19, 0xb03d, 0xb576, 0x3651, 0x2034, 0x3de1,
+    0x06e2, 0x2dcc, 0xa639, 0x21f4, 0xb448, 0x32f1, 0x99f3, 0x30a5, 0xb035,
+    0x1d89, 0x91b8, 0xab59, 0x28c2, 0x15e7, 0x3429, 0x9dd5, 0xb43b, 0x2368,
+    0x1bbd, 0xaec3, 0x9d2c, 0xb171, 0xac10, 0xa267, 0xa290, 0xb1d9, 0xa4c7,
+    0xaceb, 0xa857, 0x2808, 0x1d9a, 0xb0cf, 0xaf15, 0x9d01, 0xb352, 0xb2d4,
+    0xb115, 0xb478, 0x92af, 0x29fc, 0x9569, 0xb814, 0x32c8, 0x092d, 0xb7fc,
+    0x9d18, 0x85f7, 0x9624, 0xb09f, 0x315a, 0xb7ae, 0xab55, 0x2db4, 0x30c4,
+    0xa422, 0xb3b2, 0xaeeb, 0xb14c, 0x9d9a, 0x32b5, 0xac9f, 0xb00f, 0x9aa4,
+    0x0979, 0xade3, 0xb176, 0x1a27, 0x33d6, 0xac25, 0xa0e4, 0xb2b9, 0x9420,
+    0xb3e0, 0x31d8, 0xb35a, 0x2c68, 0x9aab, 0xb039, 0x21fb, 0x30ca, 0x8e3e,
+    0x1934, 0x02d1, 0x9863, 0x1d67, 0x2ffe, 0xa298, 0x3131, 0xb547, 0xb3ad,
+    0x25a5, 0xb565, 0x1398, 0x20b6, 0x94a0, 0xacca, 0x03de, 0x3011, 0xa65d,
+    0xa0ad, 0x19a2, 0x24ce, 0x9c11, 0xa100, 0xaed7, 0x2eb4, 0x2523, 0x3068,
+    0x9d34, 0x322a, 0x3101, 0xa201, 0x9c14, 0x9fda, 0xb23a, 0x154a, 0x85e6,
+    0x8c08, 0x898a, 0x06d1, 0x092d, 0x8da3, 0x04da, 0x8086, 0x0957, 0x0b14,
+    0x8022, 0x827e, 0x8086, 0x85e6, 0x02f3, 0x01b4, 0x06d1, 0x86af, 0x0618,
+    0x0768, 0x0936, 0x8714, 0x08f3, 0x8a85, 0x8e31, 0x0086, 0x08b8, 0x07ff,
+    0x87ab, 0x8a21, 0x05d5, 0x0097, 0x8086, 0x8b57, 0x8768, 0x8a10, 0x8768,
+    0x88a7, 0x824b, 0x0947, 0x0b92, 0x06f2, 0x8c6c, 0x011d, 0x80eb, 0x884b,
+    0x0b70, 0x0325, 0x01f7, 0x0618, 0x80c9, 0x0ef2, 0x03cd, 0x0f70, 0x8819,
+    0x0875, 0x03ac, 0x89c4, 0x8957, 0x01d6, 0x05b4, 0x0c04, 0x8eee, 0x891d,
+    0x022a, 0x83cd, 0x083a, 0x8936, 0x04c9, 0x08a7, 0x87cc, 0x825c, 0x8443,
+    0x0e75, 0x03ff, 0x8486, 0x8379, 0x82c1, 0x01f7, 0x8d68, 0x87ff, 0x8d3a,
+    0x0c71, 0x0a9e, 0x0c25, 0x8a10, 0x0864, 0x04b8, 0x0ad1, 0x8a42, 0x03de,
+    0x8a64, 0x0097, 0x08c9, 0x80c9, 0x82f3, 0x1c31, 0x1400, 0x9cb9, 0x2c2c,
+    0xa8b0, 0xa9ed, 0xa297, 0x1b12, 0x3318, 0x32b0, 0xb003, 0x289b, 0x3320,
+    0x9a0c, 0x2d56, 0xb260, 0x1cc7, 0x99d2, 0x2df9, 0x94b8, 0xa00a, 0xa033,
+    0x2bd1, 0x8475, 0xa16e, 0x34b0, 0x85d5, 0xaebf, 0xaa65, 0xa08a, 0x2904,
+    0xb546, 0x2a3a, 0xa188, 0x2402, 0x8b4f, 0x1cbc, 0x282d, 0xa074, 0x2f50,
+    0x2c37, 0x9efc, 0xa387, 0x8b35, 0x210e, 0x2747, 0x3910, 0xa69e, 0xae74,
+    0x2966, 0x2aa7, 0x18aa, 0x9335, 0xa175, 0xadd6, 0x310b, 0xb8cf, 0x2e02,
+    0x9cca, 0x300f, 0x084b, 0x23fc, 0x8410, 0x2d5b, 0x99da, 0x1ae3, 0x2287,
+    0x368c, 0xb05f, 0xb1f8, 0x992e, 0x3513, 0x356b, 0xa486, 0xb5a5, 0x97c0,
+    0x0c36, 0x30c9, 0xace4, 0x9dd8, 0x1d69, 0x2b1c, 0x33af, 0x327c, 0x2280,
+    0x9e03, 0x348c, 0x1ab6, 0x2b70, 0xb656, 0x34f1, 0xb2ce, 0x2317, 0x9b27,
+    0x34dc, 0x1758, 0x307d, 0xb568, 0xb6fa, 0x18ac, 0xb40f, 0x3ab7, 0x301d,
+    0xaf4a, 0xa874, 0x2fc4, 0x394a, 0xaf36, 0x2bc5, 0x2fb4, 0x9c05, 0x32dc,
+    0x1c40, 0xb40e, 0xb413, 0x2e1d, 0x2da2, 0xae19, 0xac8f, 0x8560, 0xa54a,
+    0xac90, 0x028e, 0xae9d, 0xa65d, 0x2bb8, 0xad62, 0x203d, 0x15d4, 0x26fe,
+    0xaf83, 0x25f7, 0x1b6f, 0x3221, 0xa95b, 0x24bd, 0xa295, 0x1ccb, 0xb368,
+    0x823a, 0xaea5, 0x9948, 0xb022, 0xb36a, 0x9a40, 0xae35, 0x29ec, 0x1c56,
+    0xa04b, 0x345b, 0x2729, 0x3720, 0x30be, 0xae77, 0x1d3d, 0x3436, 0x8a75,
+    0xb060, 0x89a3, 0x2cb3, 0xa4f8, 0x2e34, 0x2cd9, 0x32d2, 0xb00c, 0x3417,
+    0x2431, 0x1533, 0x18fc, 0xb145, 0xa153, 0xbe77, 0x8000, 0x3557, 0x2a29,
+    0xb480, 0x9f5d, 0x1661, 0xac22, 0x275c, 0x3548, 0xb572, 0xb117, 0x27db,
+    0xadeb, 0x28d3, 0xb0ca, 0x8032, 0x2129, 0xa990, 0x265b, 0xb2a8, 0x30e8,
+    0x9ee5, 0xb90d, 0xade8, 0x2c0a, 0x1ea1, 0xb083, 0x2c1d, 0x1fc1, 0xadbf,
+    0x2059, 0x28d5, 0x9da0, 0xaa6a, 0xb358, 0xaf43, 0xa747, 0x347c, 0xb589,
+    0x1c6a, 0x28a5, 0xb00a, 0x321f, 0x811d, 0xb615, 0xaf76, 0x0011, 0xb401,
+    0xaf62, 0x2cf4, 0x3273, 0xa4d4, 0xb9ce, 0x1c91, 0xb81d, 0x9589, 0xa931,
+    0x2d29, 0xb661, 0x1561, 0xa651, 0xa49c, 0x2c5e, 0x0171, 0xb1ee, 0x1c9b,
+    0xb821, 0x3900, 0xb520, 0xb373, 0x373f, 0x2525, 0xa0d8, 0xae4d, 0x334c,
+    0xa460, 0xa430, 0x1fed, 0x96e4, 0x2151, 0x813f, 0x9b5e, 0x0714, 0xa316,
+    0x26f5, 0x28f1, 0xa45b, 0x0a29, 0x1e14, 0x1d8b, 0x84ea, 0x3469, 0x9945,
+    0x9c04, 0xaa63, 0x2286, 0x85b4, 0x208d, 0xab70, 0x187a, 0xb203, 0xb10f,
+    0x376e, 0xa9a3, 0x9c28, 0xafbe, 0x9f49, 0x18d9, 0xb1b2, 0xa52f, 0xa87f,
+    0xa8ca, 0x1ad5, 0x318b, 0xa4df, 0xae31, 0xac4b, 0x1bcb, 0x2146, 0xa8ae,
+    0x334a, 0x9717, 0x3228, 0xb0c9, 0xa367, 0xae07, 0x9e16, 0x2f34, 0x27e9,
+    0x99f3, 0xab0f, 0x2cfa, 0x1cc3, 0x3357, 0xb43d, 0x192e, 0xb048, 0x235c,
+    0x3842, 0x8c75, 0x1dab, 0x3202, 0x0cc0, 0x1886, 0x9822, 0xa9c8, 0x2c7c,
+    0xa9ad, 0xb7cc, 0xab98, 0x17e6, 0x1df4, 0xa79f, 0x1af2, 0x1ca2, 0xaeeb,
+    0x2887, 0x2b11, 0x348f, 0x011d, 0xb149, 0x32f5, 0xa30a, 0x31ad, 0x1984,
+    0x30ae, 0x2c08, 0x3724, 0x0979, 0xac0d, 0x9463, 0x1e25, 0x1b9b, 0x322b,
+    0x8cd5, 0xac48, 0x8cc9, 0x1478, 0x8629, 0x153b, 0x2c5f, 0x272c, 0xb810,
+    0xa835, 0x3024, 0xac57, 0xb5c1, 0x2491, 0x240d, 0x1f0c, 0x1a49, 0x9580,
+    0x05a3, 0x198b, 0x8097, 0x9990, 0xb27e, 0x23e3, 0x1c2c, 0x2c8a, 0x204e,
+    0xa32d, 0xa012, 0xa85b, 0x31e4, 0xb5dc, 0x2289, 0xa56f, 0x98fe, 0x1e0c,
+    0x1dfb, 0x1c51, 0x20cc, 0x1dc0, 0xb7d6, 0x9f7e, 0x2981, 0xb361, 0xace0,
+    0x2794, 0x2cd8, 0xad24, 0xa520, 0x1162, 0x3415, 0x1e9e, 0x29ab, 0x2f61,
+    0x9f69, 0xb682, 0x356f, 0xa936, 0x2f07, 0x2e45, 0x22c5, 0x863a, 0xb0f6,
+    0x38d5, 0x0ba3, 0xb4a8, 0x11c9, 0xa051, 0x9e15, 0x35b5, 0x9520, 0x230e,
+    0x1804, 0xb803, 0x9a46, 0x390c, 0x91ad, 0x12cd, 0x2483, 0x22e9, 0x22b0,
+    0x050c, 0x1973, 0x3545, 0x2e4a, 0xa6be, 0x2b1e, 0x2b9c, 0xb590, 0xb5b7,
+    0xb26c, 0xb33c, 0xad70, 0x2436, 0x228d, 0xb2dd, 0xa54a, 0x2c51, 0x05e6,
+    0x2000, 0x0453, 0x1bcb, 0x9d9e, 0xa0ff, 0x9588, 0xabb5, 0xb33f, 0x15fd,
+    0x92f9, 0x178e, 0x2e77, 0x210e, 0x2761, 0xa160, 0x853e, 0x9094, 0x961f,
+    0x98da, 0xaf7c, 0x2ae9, 0x2647, 0x3336, 0x309b, 0xb1c9, 0x1dd0, 0xb056,
+    0x2c73, 0x3175, 0xb043, 0x357b, 0x1b28, 0xb684, 0x3121, 0xb723, 0xae96,
+    0x1db6, 0xaa45, 0xa801, 0xa40c, 0xa80f, 0x2b17, 0xa4c3, 0x2d53, 0x2edf,
+    0xa1d5, 0xb0b8, 0xad43, 0x99a1, 0xbeb0, 0x2d8e, 0xb42d, 0x1e39, 0x1843,
+    0xa5da, 0x88b0, 0x20b6, 0x2dee, 0x091d, 0xb2fb, 0xaeb7, 0x0032, 0x9d5b,
+    0xb29e, 0x2f06, 0x290c, 0x1f94, 0x1562, 0xb35b, 0xb06f, 0xa78e, 0x1b29,
+    0xa0b3, 0xac90, 0xb1bb, 0x1bd6, 0xbc80, 0xa4ee, 0x885c, 0xa072, 0x9bf2,
+    0x2cd9, 0xaded, 0xaf65, 0x38d4, 0x21a2, 0xab1d, 0xb0c2, 0xb098, 0xaa88,
+    0xa1f2, 0xafae, 0x2d91, 0xa9dd, 0xb4d3, 0x823a, 0x3003, 0x87bc, 0xacd7,
+    0xb2b1, 0xac34, 0xa8b8, 0xb329, 0x2554, 0xb14e, 0xac24, 0x2f82, 0xa09f,
+    0xb6a1, 0x1d79, 0xb489, 0x8075, 0x257b, 0xb765, 0xb23d, 0xad54, 0xb093,
+    0x210d, 0x23c6, 0xba1d, 0x328d, 0xafe4, 0x1b33, 0xaf28, 0xb033, 0xab06,
+    0xb24e, 0x15d1, 0xac88, 0x3a6f, 0xa80e};
+
+static const uint16_t kDense3WeightsF16[kDense2Units * kDense3Units] = {0x9931,
+    0x03bc, 0xb7e8, 0x9f3c, 0xb109, 0xb43f, 0x368c, 0xb52d, 0xbc18, 0x9e26,
+    0x3520, 0x39ac, 0x3427, 0xa4ef, 0x334a, 0x3875, 0x22de, 0x8714, 0x30a9,
+    0xb02b, 0x373a, 0x9682, 0x3b8f, 0xb81d, 0x8c14, 0x0725, 0x9eeb, 0x20b7,
+    0x9051, 0xb657, 0x99a8, 0x2862, 0xbb40, 0x8b68, 0xb0e1, 0xb66b, 0xbb09,
+    0x0453, 0x3326, 0x35c8, 0x946a, 0x9d8f, 0xb775, 0xb4b9, 0xa0ea, 0x3a16,
+    0x89cd, 0xb3f5, 0x30da, 0x09d5, 0x30d4, 0xb5e0, 0x3856, 0x1d76, 0xb521,
+    0xb5a8, 0x18a7, 0x87ff, 0xb4bd, 0x31b8, 0x2cb5, 0xabdf, 0xab16, 0xb34c,
+    0x1383, 0x8086, 0x1c2e, 0x2144, 0xa08d, 0x2072, 0x31cb, 0x1fb0, 0xa028,
+    0x3686, 0x9f02, 0x9c8a, 0xaa2d, 0x9bde, 0x2908, 0x2185, 0x2c33, 0x893e,
+    0x4009, 0x9a9d, 0xb566, 0xafe9, 0x38f5, 0xab4a, 0x3431, 0x0a42, 0x3404,
+    0xbbd4, 0x85d5, 0x240b, 0x37c8, 0x198c, 0xacc1, 0x04c9, 0x9cea, 0x1c10,
+    0xba83, 0x8bd5, 0x1e79, 0x3e3d, 0xb1b1, 0x304d, 0x38b2, 0x36ac, 0x2e7f,
+    0x370a, 0x0075, 0x301a, 0x31ff, 0x8968, 0x9cfc, 0xb120, 0x2f23, 0x1c1a,
+    0x3392, 0x903a, 0x38ae, 0x8864, 0xb18d, 0x37cd, 0x9c86, 0x93c8, 0xb2e1,
+    0x3696, 0xa77e, 0x8304, 0x9480, 0x1e26, 0xb574, 0x3d58, 0x91a5, 0x1030,
+    0x3614, 0x262d, 0xb02b, 0xb46c, 0x35cb, 0x1679, 0x9ae5, 0xb0d7, 0xb604,
+    0x838a, 0x913c, 0x31cd, 0xbd0f, 0x3591, 0x18c7, 0xb5a6, 0xac1d, 0x8022,
+    0xad33, 0x3748, 0x8789, 0x0ad9, 0x17e8, 0x9c11, 0x352c, 0x010c, 0x1573,
+    0x2b90, 0x3b20, 0x0bbc, 0x3a44, 0xb0b7, 0xaaa6, 0x9ba4, 0x28f7, 0x3ca1,
+    0x28c6, 0xb936, 0x88da, 0xa0c0, 0xace5, 0x0000, 0xa739, 0x3dc5, 0x9fd4,
+    0xb592, 0x3431, 0x19e2, 0xacff, 0x824b, 0xb1b1, 0xb818, 0x9d02, 0x3696,
+    0xb146, 0x95f3, 0x9ae1, 0x86af, 0x9e1a, 0x9f41, 0xa2b2, 0x2fb5, 0xb110,
+    0x1c7c, 0x21f1, 0x1c00, 0x3407, 0x9fa0, 0x35ec, 0x39d9, 0x9e1f, 0x1c0d,
+    0x31f3, 0x8e42, 0x9c49, 0x9ca8, 0xbb1b, 0x3915, 0x30de, 0x9c74, 0x828e,
+    0x887d, 0xb88a, 0xbb1c, 0x09f7, 0xb739, 0x3003, 0x9192, 0xb59f, 0x038a,
+    0x93ca, 0x1d36, 0xb97e, 0x85c4, 0x9d6c, 0x9e0b, 0xb113, 0x3e63, 0x360f,
+    0x34ec, 0x387f, 0x38fb, 0x8c2e, 0xb803, 0xb4c1, 0x05b4, 0xb2ac, 0x386d,
+    0xa346, 0xb50b, 0x19c5, 0xadad, 0x2842, 0x8c57, 0xafa4, 0x3a4d, 0xa17a,
+    0x31ae, 0x9b06, 0x3821, 0xada2, 0x00eb, 0x388b, 0x2419, 0x2d4a, 0x9cb4,
+    0x1a3a, 0xb87a, 0x2eb9, 0x393a, 0x964a, 0x9c04, 0x16d9, 0x1dfa, 0x326d,
+    0xb68c, 0x34f8, 0x838a, 0x2311, 0x38f7, 0xb513, 0x39b5, 0x24de, 0x3717,
+    0x9818, 0x0a8e, 0xb56c, 0x34f5, 0x80eb, 0x14ac, 0x2f26, 0x9e1f, 0x31f1,
+    0x0b46, 0x2011, 0x1f56, 0x24cc, 0x82b0, 0x3534, 0x9a01, 0xb2dd, 0x34cb,
+    0xb4ed, 0x346e, 0x0d96, 0x9cd0, 0x023a, 0x07bc, 0x9b38, 0x8410, 0xa04a,
+    0x996a, 0x344f, 0x39fc, 0x0e75, 0x9d4a, 0xb82b, 0x0ef7, 0x3bbc, 0x2745,
+    0x2ee4, 0xa71f, 0x2173, 0x26ab, 0x85b4, 0x88a7, 0x0011, 0x088e, 0x829f,
+    0x889f, 0x85a3, 0x850c, 0x8475, 0x8075, 0x0832, 0x0443, 0x826d, 0x8032,
+    0x82e2, 0x0a21, 0x8ae2, 0x885c, 0x02c1, 0x028e, 0x812e, 0x8453, 0x8171,
+    0x06af, 0x8043, 0x80eb, 0x8a29, 0x03ef, 0x87dd, 0x0886, 0x851d, 0x0853,
+    0x85c4, 0x8043, 0x854f, 0x066c, 0x84b8, 0x05d5, 0x86d1, 0x0a53, 0x0808,
+    0x898a, 0x8336, 0x0ba3, 0x854f, 0x82d1, 0x825c, 0x03ef, 0x8daf, 0x8581,
+    0x80fc, 0x87ee, 0x024b, 0x893e, 0x8725, 0x85a3, 0x8b5f, 0x8a6c, 0x88b0,
+    0x8ab8, 0x053e, 0x0864, 0x03ac, 0x052d, 0x2112, 0x089f, 0x306c, 0xbb07,
+    0x322e, 0x378a, 0xa8cd, 0x9af9, 0xa029, 0x1940, 0xacda, 0xb890, 0xacaf,
+    0x2e93, 0x3564, 0xb524, 0x8896, 0x01a3, 0x97e5, 0xb822, 0x3b6d, 0x3410,
+    0x32b1, 0xacb3, 0xa19b, 0x04a7, 0xad42, 0xb694, 0x08f3, 0xb7b2, 0x3c78,
+    0x0f92, 0xa8e0, 0x8bd5, 0x1e6d, 0xa16d, 0xa353, 0x00fc, 0x211c, 0x3825,
+    0xa069, 0x30c7, 0x9dc5, 0x21c2, 0x2fb7, 0x39b1, 0x8843, 0xac73, 0xa63a,
+    0x8b9a, 0x345a, 0x30b7, 0xaf01, 0xb638, 0xb422, 0xa1d1, 0x2e9a, 0x0054,
+    0xa9c2, 0xb856, 0xb99a, 0xb807, 0xa169, 0xb26a, 0x9dc9, 0x8496, 0xb76f,
+    0x206b, 0x9c90, 0xb627, 0x3382, 0x34ff, 0xb6f5, 0x1cb3, 0x34bf, 0x3bb3,
+    0xb0b0, 0x3b0c, 0x9476, 0x9b86, 0x1b1d, 0x07cc, 0xa164, 0x3108, 0x3704,
+    0x2d80, 0x1902, 0xa081, 0x1768, 0x0336, 0xb255, 0x2bf0, 0x0b1c, 0x141f,
+    0xb403, 0xbbfb, 0x2119, 0x0a4b, 0x1ee1, 0x9d71, 0x36ad, 0x0358, 0xad54,
+    0xae75, 0x3522, 0xb765, 0xbea8, 0x38f0, 0x332d, 0xadd8, 0x838a, 0x3002,
+    0xc024, 0x8475, 0x38cf, 0x1242, 0x3751, 0xb61b, 0xbc67, 0x3c80, 0x9f3f,
+    0x87ff, 0x345d, 0xa2d8, 0xb845, 0x1769, 0x2caf, 0x3561, 0x0c75, 0x83bc,
+    0x0e7d, 0x09ab, 0x8a53, 0x02c1, 0x027e, 0x8886, 0x8957, 0x0629, 0x054f,
+    0x0581, 0x085c, 0x00c9, 0x09de, 0x89ab, 0x0f3a, 0x80eb, 0x087d, 0x8182,
+    0x065b, 0x0779, 0x0a96, 0x87cc, 0x07ff, 0x039b, 0x08b8, 0x00fc, 0x8054,
+    0x0011, 0x05f7, 0x8432, 0x823a, 0x0432, 0x0022, 0x8968, 0x81b4, 0x03bc,
+    0x069e, 0x08ea, 0x83ef, 0x89ff, 0x0453, 0x053e, 0x0a08, 0x00b9, 0x8af2,
+    0x0182, 0x09f7, 0x83ef, 0x8925, 0x0592, 0x865b, 0x82d1, 0x89bc, 0x0a18,
+    0x8a6c, 0x812e, 0x09c4, 0x8c0c, 0x81d6, 0x885c, 0x0d79, 0x0475, 0x362a,
+    0x829f, 0xb5cb, 0xa433, 0x1281, 0xac2d, 0x3220, 0x9d3e, 0x2545, 0x90d5,
+    0x3a84, 0xb258, 0x3618, 0xa03b, 0x33d6, 0xb898, 0x3638, 0x813f, 0xb614,
+    0xb5ca, 0x2a45, 0x8ae2, 0x381b, 0xb923, 0x906c, 0x8011, 0x2f18, 0xa1dd,
+    0x07cc, 0x1f1a, 0x3e6f, 0xadc4, 0x0da3, 0x029f, 0xadbc, 0x179d, 0xb384,
+    0x8a85, 0xb7bc, 0x2dbe, 0xa681, 0xb788, 0x38db, 0xaa4b, 0xb9d3, 0x391f,
+    0x8032, 0x264e, 0x183b, 0x8757, 0xb6ad, 0xb121, 0x9c24, 0xa80b, 0x0629,
+    0x1c0d, 0x1c82, 0x83ef, 0x3757, 0xb77f, 0xb990, 0x3b48, 0xa818, 0x38a6,
+    0xa4bd, 0x839b, 0x3192, 0x254b, 0xa4ae, 0x3e65, 0xa713, 0x996c, 0x3c11,
+    0x29f1, 0x9557, 0x38f4, 0xb53a, 0xbd54, 0x9f2e, 0x3a0d, 0x38a9, 0x85a3,
+    0x2b88, 0x3c28, 0x2f8f, 0x35a0, 0x3175, 0x3858, 0x39d8, 0x0971, 0x15e8,
+    0x32d7, 0x065b, 0x37ff, 0xb6a1, 0xb2c6, 0x385a, 0x8757, 0x1aa3, 0xa1ac,
+    0x34fa, 0x0968, 0xb7ce, 0xb361, 0xb0b0, 0x107d, 0x19a1, 0xac65, 0x314f,
+    0xb5ed, 0x0022, 0x2e0f, 0x06d1, 0x09e6, 0x362a, 0xb47a, 0x36b6, 0xaa30,
+    0xb9ee, 0x3415, 0x1724, 0x828e, 0x1f7b, 0xabc3, 0x9ffb, 0xb7b4, 0x2ded,
+    0x1d9e, 0x3c3b, 0x03cd, 0x3bef, 0x9edd, 0xbc0c, 0xbbcf, 0xb06e, 0x3acc,
+    0x9cca, 0x9b9c, 0x3332, 0x1259, 0x38ff, 0x0336, 0xadd7, 0x246a, 0xb5a6,
+    0x80a8, 0x20a8, 0x1bdd, 0x35b1, 0x9c9d, 0xba20, 0x1cd2, 0x8dbc, 0x07bc,
+    0x1b42, 0x3c85, 0x0bbc, 0x30f7, 0xb53f, 0x288d, 0x2f07, 0x838a, 0xbaa3,
+    0xab21, 0x29dd, 0x8ca7, 0x3043, 0x34b4, 0x20ec, 0x31f6, 0x2579, 0x96e9,
+    0xb402, 0x2f54, 0x8968, 0xa676, 0xadaa, 0x8054, 0x3b87, 0x3cd6, 0xb699,
+    0x2665, 0xb5e1, 0x30e5, 0x3922, 0x0f07, 0x33f3, 0x2133, 0xb7a4, 0x1599,
+    0x361f, 0x987e, 0x3406, 0x82c1, 0x1ec5, 0xbc6f, 0xb1f6, 0x31b4, 0xb91e,
+    0x2b42, 0xb894, 0x9e88, 0xaf4d, 0x1adb, 0x388b, 0x3811, 0x1edb, 0xbae5,
+    0xbc22, 0x82f3, 0xb065, 0x1e1f, 0xb5f1, 0xb04a, 0xb669, 0xb728, 0xa728,
+    0x0992, 0xb109, 0xa814, 0x82f3, 0x1c0d, 0x9b6a, 0x32d2, 0x3286, 0x050c,
+    0xbb6a, 0x1f88, 0x3733, 0x8368, 0xb8c0, 0x2fbf, 0x8a5b, 0x292c, 0xa4c2,
+    0x3a11, 0x354d, 0x9b16, 0x8d18, 0x9eac, 0x23ff, 0x00a8, 0x397b, 0xb768,
+    0x30fe, 0xbb2d, 0x25e1, 0x3210, 0xa295, 0x0486, 0xb397, 0xb54a, 0x383c,
+    0x3225, 0x3856, 0xb534, 0x2689, 0x08b0, 0xb238, 0x1d5b, 0xb528, 0x3216,
+    0x153c, 0x9e95, 0xb93e, 0x98c5, 0xb41b, 0x3a28, 0x34cf, 0x3cca, 0xb328,
+    0x144e, 0xb81b, 0x8a08, 0x905e, 0x18fc, 0x3414, 0xb252, 0xb45c, 0x30da,
+    0xab30, 0x028e, 0x2fdf, 0x34e5, 0x8843, 0x3c12, 0x9ec2, 0x9ca0, 0x1b59,
+    0x89ee, 0x250d, 0xa796, 0x3832, 0x0896, 0x344b, 0xa23f, 0xab07, 0xb7de,
+    0x3b56, 0xad6e, 0x3455, 0x2237, 0x8ba3, 0xba24, 0xad03, 0x810c, 0x38c7,
+    0x1cda, 0xb140, 0x3926, 0xaf92, 0x3690, 0xb8fb, 0x8464, 0xa550, 0x3061,
+    0x8086, 0x1c82, 0x3a83, 0xbefe, 0xb04d, 0x8957, 0xb42b, 0x3b5c, 0x9d89,
+    0x1818, 0x95c0, 0xa02b, 0xb441, 0x33e2, 0x3385, 0xbc3c, 0x9c13, 0xb006,
+    0xa996, 0x3bb1, 0x34a1, 0x0086, 0x2b18, 0xb1ff, 0xb040, 0x3612, 0xb285,
+    0x35de, 0xba19, 0x0b14, 0x9bd0, 0x361b, 0x06af, 0xa286, 0xb5a0, 0x9834,
+    0xb61c, 0x0453, 0x347f, 0x3c2f, 0x3084, 0x050c, 0xa053, 0x36f4, 0x3b0d,
+    0x19cf, 0x98ff, 0xb433, 0x1faf, 0x3c64, 0x0347, 0x290d, 0xb4c0, 0x09bc,
+    0x1f7e, 0xb93a, 0xba97, 0x3921, 0x1928, 0x3a1f, 0xa8e7, 0x0757, 0xba08,
+    0xa0e9, 0x352a, 0x1827, 0xa886, 0xae40, 0xb313, 0x867d, 0xb6cb, 0xb36e,
+    0xa72b, 0x3645, 0x390a, 0x9897, 0x3879, 0xa3fe, 0x981c, 0x110c, 0xb24a,
+    0xbc6c, 0x37dd, 0xb6ef, 0x38fc, 0x0358, 0x0fc0, 0x9d46, 0x395a, 0x2aac,
+    0xb7c1, 0x3429, 0xa933, 0x0f53, 0x21e5, 0xb726, 0x8b68, 0x32d8, 0xae35,
+    0x3b1a, 0xb88b, 0x06c0, 0xbce3, 0x3ac6, 0x9ed1, 0x0c1d, 0x2805, 0x34e6,
+    0xb88e, 0x25c4, 0x2cad, 0x14c2, 0x234c, 0xb5e4, 0x09de, 0xa021, 0x2d8c,
+    0x0a08, 0x3451, 0xad38, 0x8e9e, 0xa076, 0x9c4b, 0xb6dc, 0xa9c6, 0x8c7d,
+    0x1974, 0x284b, 0x321d, 0x3a00, 0x399a, 0x1f47, 0x31d7, 0x81c5, 0x1638,
+    0x39e8, 0x3275, 0xba73, 0x3142, 0xb01e, 0xb555, 0x1e10, 0x397b, 0x407b,
+    0x2f8a, 0xa823, 0x341f, 0xa474, 0xab66, 0x825c, 0x1ed9, 0xb643, 0x1ff2,
+    0x9d85, 0x9cf9, 0x9436, 0x38f1, 0x8779, 0xb95e, 0x9dcc, 0x0150, 0x28cb,
+    0x3a21, 0x9e17, 0x3090, 0x0453, 0x3900, 0x356e, 0x9ceb, 0x87ff, 0xb8bc,
+    0x3d57, 0x3531, 0xb671, 0x298e, 0x2285, 0x3d46, 0x20eb, 0x825c, 0x8bd5,
+    0x8c57, 0x88ea, 0xb0bc, 0x3156, 0xba91, 0x3420, 0xb60e, 0xb4ef, 0xa2ee,
+    0x828e, 0x35a9, 0xa931, 0xb72e, 0x3299, 0x34ff, 0x2e03, 0x9f5f, 0x865b,
+    0x3943, 0x9285, 0x38d2, 0x1a04, 0x3464, 0x3791, 0x9428, 0x31fa, 0x3553,
+    0x1cbb, 0x24b5, 0x18a5, 0xb8e7, 0xb701, 0x17ae, 0x08d1, 0x08b8, 0xb809,
+    0xb634, 0x371a, 0xb4ef, 0x9b19, 0x1e5f, 0x8432, 0x30a0, 0x38ed, 0x0c0c,
+    0xaa62, 0x9590, 0x339c, 0x3684, 0x8c9b, 0x306e, 0xbf53, 0x2557, 0x8629,
+    0xa494, 0xadf7, 0x2f65, 0xb4ca, 0x2b32, 0x3327, 0x3a8e, 0x9cac, 0x0315,
+    0x30e7, 0x9cbc, 0x8618, 0xb95b, 0xb162, 0x2af0, 0x27f2, 0x3360, 0x3c33,
+    0x2cec, 0x83ac, 0xb12b, 0x9fbb, 0x223a, 0x25fe, 0x2d12, 0x9787, 0xb8af,
+    0x852d, 0x1f08, 0x1700, 0xb94c, 0xb288, 0x35b3, 0x935f, 0x10ab, 0x1896,
+    0xb977, 0xa61c, 0x1c69, 0xa582, 0xb591, 0x342f, 0x3837, 0x0757, 0x1a14,
+    0xb361, 0x367e, 0xbb03, 0x9b51, 0x3772, 0x3190, 0x8c9b, 0x2e6a, 0xb74c,
+    0x09ab, 0x1fde, 0xa23e, 0x3646, 0xb32d, 0x8421, 0x33b1, 0x15e5, 0x9aa2,
+    0x0421, 0x1dbb, 0x23c5, 0xb0cb, 0x2c40, 0x1b86, 0x3b06, 0x3431, 0x3667,
+    0x8496, 0x39ac, 0x1e21, 0x0960, 0x37c6, 0x38f6, 0xa69a, 0x2d95, 0xa23c,
+    0x185a, 0x3c91, 0x8219, 0x2973, 0xb3ec, 0x37d8, 0x2217, 0x2042, 0x4057,
+    0xba44, 0x8808, 0x321c, 0x1d45, 0xb83c, 0x24e1, 0x2916, 0x9e50, 0x22b4,
+    0x312f, 0xa4cd, 0x95dd, 0xad4a, 0x24fb, 0xb597, 0x39cb, 0x3304, 0x8022,
+    0xa3c3, 0x20d3, 0x18ca, 0x8f35, 0x9cee, 0x396b, 0x99ae, 0x0325, 0xb171,
+    0x3d87, 0x8608, 0xb940, 0x9b4a, 0x9e4a, 0x2c63, 0x08ea, 0x3382, 0x2c43,
+    0x377b, 0x8cde, 0x2f9a, 0xb832, 0x2eee, 0x9cbd, 0xb1fc, 0x2981, 0x98e7,
+    0x2609, 0x80b9, 0xb038, 0x3f27, 0x8968, 0x34ff, 0x9d77, 0x3061, 0xbcb2,
+    0xb44a, 0x31a8, 0x2ff2, 0x025c, 0x9c76, 0x3b75, 0x3190, 0x1755, 0x1e73,
+    0x94d7, 0x2ee2, 0x8219, 0xb5e1, 0x9624, 0x36b0, 0x2b05, 0x22b3, 0x387a,
+    0x363f, 0xa204, 0xa878, 0x18df, 0x31d5, 0xb131, 0x3485, 0xacfc, 0xaf81,
+    0x81b4, 0xbb55, 0xb137, 0xb278, 0x3501, 0x231a, 0xbd3f, 0xb782, 0x0475,
+    0x20f6, 0x1895, 0x08c9, 0x3bdc, 0x9d75, 0x95a6, 0x2860, 0x0c96, 0x1e2c,
+    0x3056, 0x3647, 0x054f, 0xba31, 0x200e, 0x1c51, 0xa587, 0x1e35, 0x9f38,
+    0x288a, 0x3096, 0x889f, 0xaa3e, 0xad57, 0x867d, 0xb795, 0x35ab, 0x208a,
+    0xa879, 0x3663, 0x3626, 0xb1e1, 0x8d7d, 0xa30c, 0xb862, 0x1c1c, 0x1e3f,
+    0xb031, 0x113e, 0xa944, 0x8b70, 0x38f1, 0xaa9e, 0x3608, 0x34ad, 0x9ae7,
+    0xba25, 0xb8a7, 0x39eb, 0xb8b7, 0xb97b, 0x24db, 0xb550, 0x2365, 0xa835,
+    0xb766, 0x0054, 0x92a7, 0x1e1c, 0xb040, 0xb82b, 0x2d30, 0x3039, 0x3475,
+    0x8c75, 0x230f, 0x3851, 0x0925, 0xb4ef, 0x18c1, 0x83de, 0x1c3d, 0x0925,
+    0x9159, 0x9999, 0x3a8d, 0x8d57, 0xb967, 0xb1ef, 0x34af, 0xb401, 0x9b33,
+    0xa204, 0x9a6f, 0xaa79, 0x022a, 0xa020, 0xbc72, 0x8097, 0x2090, 0x96ec,
+    0x1b1f, 0xb8ef, 0xb303, 0x3d04, 0x31c0, 0x8315, 0xa373, 0x99a7, 0x2c0f,
+    0x397a, 0x3508, 0x98ab, 0x3c5b, 0x0779, 0xb0f6, 0x3e41, 0xa1c8, 0xb0ac,
+    0xa97c, 0x96f8, 0xa03f, 0x30bb, 0x3ac8, 0xa1b1, 0xb5a8, 0xae7e, 0xaf35,
+    0x3b9f, 0xab5a, 0x8ab8, 0x03ff, 0xb485, 0x2331, 0x39f6, 0x1a5e, 0xb46c,
+    0xaf5d, 0x8171, 0x3629, 0xaa26, 0x04b8, 0x2c2e, 0x34b7, 0xb116, 0x249a,
+    0x0a3a, 0xafc9, 0x1d68, 0xacd9, 0x8779, 0x182b, 0x2070, 0xb81a, 0x864b,
+    0xa424, 0x18bc, 0xa3d3, 0x9d29, 0x85a3, 0xbb12, 0x1d43, 0x0703, 0x2fd3,
+    0x382b, 0x1f96, 0x2876, 0xad5c, 0x31d3, 0x2d59, 0x8fff, 0x9b33, 0x28b0,
+    0x3890, 0xa74c, 0xbb0f, 0xbc2e, 0x3b0b, 0x0714, 0x3065, 0x27a1, 0x388b,
+    0xb27f, 0x3c8a, 0x1f84, 0x347d, 0xb4ac, 0xa5c7, 0x9348, 0xaf5b, 0x359f,
+    0xb8a6, 0x38b3, 0xabc5, 0x8a4b, 0x8de2, 0x304b, 0x894f, 0xb573, 0x1515,
+    0x3c90, 0xb4e9, 0x8c29, 0xb337, 0xb058, 0x8971, 0xb8a6, 0xa86b, 0xb5e3,
+    0x3acc, 0x0829, 0xb93f, 0x9734, 0xac81, 0x8914, 0xa75f, 0x30c8, 0x2ac7,
+    0x1f15, 0x1e0c, 0x15c4, 0xa0bd, 0x3704, 0x82c1, 0xb71e, 0x1f3f, 0x82e2,
+    0x364f, 0x3464, 0x22c5, 0x99a7, 0xb9ac, 0x1c16, 0x28c5, 0x012e, 0x34a2,
+    0x3b04, 0xb4c0, 0x2953, 0x3aba, 0x2c74, 0x8a08, 0x069e, 0x03de, 0x053e,
+    0x8618, 0x8ea7, 0x09a3, 0x8571, 0x8ea7, 0x8703, 0x8914, 0x0a29, 0x8304,
+    0x8896, 0x03ac, 0x81c5, 0x03bc, 0x8618, 0x0714, 0x0703, 0x01f7, 0x8571,
+    0x027e, 0x8dd5, 0x89de, 0x8571, 0x028e, 0x02b0, 0x025c, 0x0571, 0x8b57,
+    0x8c71, 0x81e7, 0x08b8, 0x85f7, 0x8315, 0x0325, 0x88da, 0x84c9, 0x8b0c,
+    0x088e, 0x8c29, 0x8b89, 0x0347, 0x0f07, 0x8757, 0x8560, 0x07dd, 0x8725,
+    0x8c81, 0x0725, 0x02e2, 0x8d03, 0x00c9, 0x026d, 0x090c, 0x029f, 0x8022,
+    0x89ab, 0x8e9a, 0x013f, 0x8886, 0x81a3, 0x038a, 0x2860, 0x09ee, 0x2dfc,
+    0xb8d3, 0xa8ae, 0x9cb2, 0xad54, 0x16af, 0x1813, 0xb546, 0x3528, 0x1cb6,
+    0x3bbe, 0x3350, 0x3c69, 0x8464, 0x2401, 0x0c8a, 0x2188, 0x9171, 0x1ef2,
+    0x2916, 0xb42d, 0x2a1b, 0x19fc, 0x8c2e, 0x2b94, 0xb9e7, 0x8c3e, 0xb66c,
+    0x31ef, 0x2ef5, 0x3c17, 0x03cd, 0xb144, 0x936a, 0x9d0e, 0x887d, 0xb068,
+    0x314d, 0x33f1, 0x1c05, 0xb771, 0x3ba3, 0x9e6d, 0xa394, 0x84b8, 0x3145,
+    0x9ec1, 0x851d, 0x1d2c, 0xb6b2, 0x31e9, 0x9c95, 0x3043, 0xb57c, 0x2f18,
+    0x0821, 0xad05, 0x3c2d, 0x9329, 0x9dba, 0x2f27, 0xb802, 0xa824, 0x0914,
+    0xaddb, 0xa2c3, 0xa4d7, 0xac7a, 0xa21c, 0xbc78, 0xb99f, 0x24f6, 0xb155,
+    0x1600, 0xb16f, 0xadb8, 0x9854, 0x288b, 0x3459, 0x00fc, 0xb2a5, 0x9b67,
+    0x2f6e, 0xa74f, 0x21b0, 0x376a, 0xb0bb, 0x84c9, 0x3a79, 0xb834, 0x8a18,
+    0x9b37, 0x1f01, 0xacef, 0x9d0d, 0x0757, 0xb15e, 0xb418, 0xba4f, 0x0c71,
+    0x3d39, 0x2922, 0x3bdd, 0x11c0, 0xbb82, 0x3294, 0x2cbc, 0x9894, 0x0aaf,
+    0x394c, 0x30ad, 0x0b89, 0x29e3, 0x999c, 0x32cc, 0xb700, 0x3899, 0xaeb4,
+    0xa6bd, 0x0336, 0x1f02, 0x2156, 0x14aa, 0x0193, 0x25cc, 0x9144, 0xb4d5,
+    0x0aaf, 0xb4ac, 0x3379, 0xa8d0, 0xa683, 0x358f, 0xa168, 0x1e0e, 0xb854,
+    0x2680, 0x9487, 0x3aac, 0xaa1c, 0x19de, 0x3873, 0x39ce, 0x853e, 0xbc35,
+    0x3a99, 0xb05a, 0xa17f, 0xb0f7, 0x2e13, 0x344b, 0x88a7, 0xa68e, 0xadc7,
+    0x05e6, 0x9eb0, 0x39fe, 0xbb89, 0x1c51, 0x8886, 0xb627, 0xb0bf, 0xb212,
+    0x00fc, 0x38b4, 0x10de, 0x0fea, 0x9389, 0x3392, 0x333c, 0xb31d, 0xab1c,
+    0x09b4, 0x36fd, 0xba08, 0x8086, 0xb5b0, 0xa7f2, 0x9b09, 0x3376, 0xb05f,
+    0x9980, 0x3b16, 0x82b0, 0xb250, 0x2694, 0x14a6, 0xb72d, 0xa593, 0x0097,
+    0x2def, 0x0ae2, 0xa08e, 0x9e90, 0x30d7, 0x1f04, 0xaf51, 0x29f0, 0xa062,
+    0xb5a7, 0x1aaa, 0x13d7, 0xa4b0, 0xa53f, 0x235c, 0x34fc, 0x9d64, 0x0947,
+    0xaa07, 0x3e81, 0xad40, 0x140e, 0x3bad, 0x1f4e, 0x3864, 0x8bee, 0x3836,
+    0x36d3, 0x0b14, 0x9d69, 0x2d7d, 0x1ca7, 0x9d1e, 0x0789, 0x9f25, 0xb087,
+    0x1d35, 0x0971, 0xbc51, 0x1814, 0x117f, 0x3001, 0x1b80, 0x3af8, 0xb423,
+    0x1c02, 0x03bc, 0xad41, 0x32bd, 0x8bb3, 0x35a9, 0x2d21, 0xb4ab, 0x3bee,
+    0x8853, 0x9c84, 0xb866, 0x869e, 0xaf28, 0xb308, 0x36b6, 0x2cf4, 0x1ef0,
+    0x2057, 0x27d6, 0x09ab, 0x9a25, 0x207a, 0x363e, 0x0d18, 0xac7f, 0x2e6c,
+    0x1ef9, 0xbada, 0x329a, 0x349a, 0x2ca1, 0x1943, 0xb8e2, 0x2e04, 0xb50f,
+    0x027e, 0x3878, 0x31fd, 0x335a, 0x1b5b, 0x20b5, 0xb04c, 0xb10a, 0x0065,
+    0x32c1, 0x8f5f, 0x83ef, 0x3aa9, 0x3d9f, 0x3a44, 0x9964, 0x054f, 0x9e30,
+    0x1981, 0x30a6, 0x8421, 0x2dad, 0x941b, 0x2725, 0xb531, 0xa11d, 0x9ae5,
+    0x3d46, 0x39a2, 0x02c1, 0x33da, 0x29f5, 0x0379, 0xb663, 0x197b, 0x3cad,
+    0x1ea1, 0x355b, 0xbb5c, 0x3369, 0x05f7, 0xae64, 0x9e4e, 0x3b96, 0xa79c,
+    0xa172, 0x1dc8, 0xa1d6, 0x0914, 0x218f, 0x823a, 0x223d, 0x3067, 0xbd8c,
+    0xa01b, 0x36ef, 0x3536, 0xb77a, 0x2f2d, 0xb9a7, 0x1e1e, 0x1e2f, 0x8d7d,
+    0xb518, 0x8075, 0x2510, 0x34e2, 0xac20, 0xb33d, 0x945b, 0xb740, 0xad37,
+    0x0ccd, 0x9d29, 0x206f, 0x0464, 0x1ece, 0x3828, 0x1913, 0x2f0c, 0x8a9e,
+    0x24bf, 0x39b3, 0x39a1, 0x85d5, 0x324b, 0xac4c, 0x33e9, 0x2d23, 0x384a,
+    0xb8fa, 0x9c6d, 0x2fe7, 0x89de, 0x3ac1, 0x34b2, 0x0d47, 0x1bda, 0x9c46,
+    0x9025, 0xb46d, 0x3657, 0x3848, 0xb664, 0x8aea, 0x254f, 0x1c1f, 0x33ce,
+    0x2235, 0xbafe, 0x351c, 0x053e, 0x086c, 0x8a42, 0x0b2d, 0x09de, 0x079a,
+    0x86c0, 0x067d, 0x0c9f, 0x099a, 0x068e, 0x027e, 0x8864, 0x86c0, 0x0ca3,
+    0x8054, 0x889f, 0x8a53, 0x090c, 0x092d, 0x084b, 0x0832, 0x8b46, 0x07cc,
+    0x8486, 0x00c9, 0x02e2, 0x092d, 0x8a8e, 0x0f25, 0x8979, 0x01a3, 0x09ab,
+    0x0608, 0x0043, 0x81e7, 0x0b0c, 0x8a53, 0x8c29, 0x026d, 0x0160, 0x0d18,
+    0x81a3, 0x023a, 0x8629, 0x08b0, 0x8b1c, 0x853e, 0x07ee, 0x05d5, 0x090c,
+    0x0000, 0x0960, 0x093e, 0x0171, 0x0b1c, 0x099a, 0x0453, 0x0a29, 0x02e2,
+    0x0da3, 0x8336, 0x0347, 0x8c68};
+
+static const uint16_t kPhonemeWeightsF16[kDense3Units * kPhonemeUnits] =
+    {0xbcae, 0xb547, 0x338f, 0x25cc, 0x1faf, 0x01c5, 0x8864, 0x36c0, 0x812e,
+    0x9b55, 0x1605, 0x1351, 0x1726, 0xc03e, 0x3b4d, 0x15ca, 0xc023, 0x1a12,
+    0x198e, 0x3636, 0xaabd, 0x3928, 0xa201, 0x3b8c, 0x89ee, 0xb274, 0xbcf0,
+    0x13ee, 0xb8dc, 0x9450, 0x1e97, 0x8832, 0x38b8, 0xaee2, 0xa0dd, 0xb6e5,
+    0xa983, 0x8d64, 0x3871, 0x3a26, 0x024b, 0x386e, 0xb3db, 0x35a4, 0xb2e6,
+    0x3815, 0x1478, 0xb353, 0x237c, 0xb38a, 0x38a1, 0xbcf4, 0x967a, 0xb899,
+    0x2c83, 0xb6c0, 0x894f, 0x18fd, 0x3548, 0x329c, 0x33c7, 0x955f, 0x1b89,
+    0x8054, 0x3cb5, 0xb3b6, 0xabd4, 0x295c, 0xa2e4, 0x0475, 0x3447, 0x9c7d,
+    0x0097, 0xbda0, 0x2dc9, 0x3854, 0x38ec, 0xb60d, 0x19d9, 0x33b5, 0x2891,
+    0xbd28, 0x3a48, 0xb131, 0x9ed1, 0x2b35, 0x278a, 0x3492, 0x8336, 0x3862,
+    0x35f7, 0xb542, 0x8e96, 0x17ff, 0x1495, 0x06f2, 0x37db, 0x1ad6, 0x2295,
+    0xb553, 0xb66e, 0x063a, 0x2442, 0x2f1a, 0x0336, 0x24e7, 0xb6bf, 0x3634,
+    0x3312, 0x1d40, 0xb16c, 0x35ba, 0xb35b, 0x34a6, 0x9d16, 0xbce4, 0xb5b7,
+    0xb1b3, 0xb1ef, 0x3545, 0x085c, 0x3299, 0x3732, 0x2fcd, 0x2d80, 0x2fb7,
+    0xa77e, 0x8043, 0x367e, 0x3011, 0xb7ae, 0x18c4, 0x29e8, 0x88c0, 0x3539,
+    0x3888, 0x850c, 0x3acb, 0xb389, 0x37ce, 0x28bc, 0x2f7c, 0xa4da, 0xb56d,
+    0x18db, 0x9e25, 0xa72a, 0xbd43, 0xa2eb, 0xaca9, 0x8f64, 0xba5d, 0x83ac,
+    0x2ee7, 0x2c17, 0xa63a, 0x3a99, 0x105e, 0x392b, 0x00c9, 0x35c4, 0xa13b,
+    0xaa9c, 0xa474, 0xb72b, 0x8208, 0x3818, 0x3873, 0x8a29, 0xa5b3, 0x19b5,
+    0x34cb, 0x3514, 0xa49d, 0xaecf, 0x34a2, 0xa5c5, 0xbc0b, 0x3877, 0x29c9,
+    0x4096, 0xbc02, 0x243c, 0x379e, 0x00a8, 0x92b8, 0x3649, 0x827e, 0xb591,
+    0x9649, 0xaead, 0x0936, 0xb05e, 0x34cd, 0xaf72, 0xb796, 0x2003, 0x88d1,
+    0x1e7c, 0x3bbb, 0x00a8, 0x1f4e, 0x36ad, 0x38ad, 0xb44c, 0x1bc5, 0x356c,
+    0x0a10, 0xab69, 0xbd73, 0x330d, 0xbcd2, 0xbc32, 0xbc04, 0x1d45, 0x201f,
+    0x8315, 0x914b, 0x99bd, 0x19de, 0x284e, 0x362c, 0x1455, 0x88b0, 0x3ad7,
+    0x2a91, 0xb62d, 0xb430, 0xac33, 0x0443, 0x981d, 0xb512, 0x8629, 0xb930,
+    0xb38c, 0x9e40, 0x3841, 0xad15, 0xb121, 0xa40d, 0x9e00, 0xb52e, 0x3967,
+    0xb0e2, 0xa3d1, 0x1cd1, 0x314f, 0x3881, 0x8b3e, 0x31a5, 0x392c, 0xb619,
+    0x212b, 0xb0e8, 0x94f0, 0x0960, 0x928c, 0x3400, 0xb76f, 0xa1e5, 0x10ea,
+    0x0304, 0xb696, 0xa00a, 0x028e, 0x2859, 0xb8f0, 0xb84e, 0x9428, 0xb42a,
+    0xa832, 0x303d, 0x2e97, 0x8725, 0x3c49, 0xbb74, 0xa0e4, 0x3c77, 0xb008,
+    0xb9f8, 0x8171, 0x907d, 0x361d, 0x3650, 0xbac3, 0x2002, 0xa406, 0x052d,
+    0xa2fa, 0x39ea, 0xbb97, 0xb165, 0xb99e, 0x024b, 0xb88a, 0x9073, 0x8a53,
+    0xba1e, 0x388e, 0x9d05, 0xac89, 0xa562, 0x3040, 0x2d76, 0x345d, 0xb91b,
+    0x2f26, 0x2d85, 0x9370, 0xb65f, 0xad83, 0x373f, 0x84b8, 0xa92d, 0x3387,
+    0xb804, 0x3419, 0xa909, 0x9a68, 0x8fd5, 0x32e8, 0x3860, 0xb8fd, 0x270f,
+    0x35ce, 0x079a, 0xb2e6, 0xb51e, 0x8421, 0xb7b3, 0xa5c7, 0xb517, 0x394d,
+    0x9255, 0xa0d9, 0xb467, 0x9b6e, 0x33ef, 0x2d77, 0x28ac, 0x3014, 0x276d,
+    0x3179, 0x3a20, 0x04b8, 0x206a, 0x3709, 0x3005, 0xb852, 0x2b90, 0xb9cb,
+    0x0ef7, 0xa084, 0x3976, 0xb883, 0x39f8, 0x2233, 0x87dd, 0xbee9, 0x3736,
+    0x05c4, 0x273d, 0x3715, 0xb64f, 0xaca4, 0x25de, 0x3916, 0x310c, 0x2215,
+    0xaff8, 0xb436, 0x9d80, 0xb58f, 0xb0d2, 0x3b39, 0xa982, 0x84b8, 0x9d2f,
+    0x3864, 0xb06b, 0xbb0e, 0x996f, 0x387a, 0x822a, 0xb097, 0xa8a3, 0xb4da,
+    0xb4e9, 0xbdf6, 0x023a, 0x17e0, 0xb02a, 0x828e, 0x3925, 0xa104, 0xb089,
+    0x1eb6, 0x3059, 0x9d1e, 0x36b0, 0x3646, 0x1e06, 0xb843, 0xbba2, 0x3c17,
+    0xa623, 0xaedd, 0x19c8, 0x0421, 0x3997, 0x37f5, 0x1e18, 0xab3c, 0x1e3a,
+    0x9af1, 0x887d, 0x2d21, 0x13e1, 0xbe09, 0x97ea, 0x9ef4, 0x8a64, 0x327b,
+    0xb917, 0x09ff, 0x3c22, 0xbab1, 0xb505, 0x30a8, 0x3472, 0x357e, 0x1dca,
+    0x29dc, 0xba01, 0x94a8, 0xba08, 0x9dbe, 0x9ef6, 0xb9ad, 0x9813, 0x02b0,
+    0x33f9, 0xbd08, 0x3b04, 0x3cd5, 0x3b1c, 0x9ce3, 0x8cd5, 0x277e, 0x2f8b,
+    0xb6f1, 0x2ff6, 0x18f6, 0x00eb, 0x3339, 0xae07, 0x8571, 0x85a3, 0xb56a,
+    0xb7c8, 0xac1e, 0xb880, 0x9ee0, 0xa013, 0x30c4, 0x3b9d, 0xb7c5, 0xbc44,
+    0x27ab, 0x1747, 0xb210, 0x38a8, 0x89cd, 0x1e91, 0x3372, 0x2263, 0xac40,
+    0x27d0, 0x2933, 0x890c, 0xb995, 0x38d4, 0xba15, 0x2c10, 0x9266, 0x0065,
+    0x0fd9, 0x1535, 0x039b, 0x15fa, 0xba0d, 0xb97b, 0x26ab, 0xb5e6, 0x2625,
+    0x17d8, 0x21fe, 0x38fa, 0xb9b3, 0xad89, 0x3f1e, 0xb4f9, 0xb407, 0x1918,
+    0x850c, 0x35d0, 0x97bd, 0x9c3e, 0xc054, 0x320a, 0x3869, 0x06d1, 0x2756,
+    0x9df4, 0x3983, 0x3643, 0x9cab, 0x884b, 0xb596, 0xb1b8, 0x83ac, 0xa1f4,
+    0xbb7d, 0xb84a, 0xbde0, 0x365a, 0x3c8b, 0xa409, 0x9d7d, 0x9803, 0xab84,
+    0x219e, 0x2302, 0xbcd5, 0x3d0b, 0x9f11, 0x06d1, 0xbd09, 0x3b3f, 0x384b,
+    0x2377, 0x9aa1, 0xa680, 0x0065, 0x190a, 0x1728, 0x3618, 0x3a1f, 0xa834,
+    0x07dd, 0x39c6, 0x329f, 0x825c, 0x18fa, 0xa15e, 0xbb2e, 0xb741, 0xbcb6,
+    0x356e, 0x3963, 0x374b, 0xaef7, 0x3a08, 0xb546, 0x9da3, 0xb8a1, 0xbe18,
+    0xbb42, 0x80b9, 0x94ce, 0xb0b3, 0xa1b8, 0x93f6, 0xb96d, 0x3c93, 0x8853,
+    0xb404, 0x3547, 0x2b11, 0x34bb, 0x8315, 0x0086, 0x1c30, 0x0032, 0x05f7,
+    0x38fb, 0xb003, 0xb1a9, 0x3c3b, 0xb33a, 0x9a7b, 0x388f, 0x963e, 0xb0f6,
+    0x94a8, 0xb0d0, 0x31f6, 0xb873, 0x3d5c, 0xb3b0, 0x8703, 0x906a, 0xb752,
+    0xb924, 0xa566, 0x9c74, 0xb317, 0x8160, 0x2fde, 0x3767, 0x39ac, 0x13d7,
+    0x3375, 0x0c4b, 0x386e, 0xb083, 0x038a, 0x98a9, 0x20a4, 0xbc6b, 0xb1a6,
+    0xbd0f, 0x24ba, 0x32ae, 0xb0f9, 0xbba4, 0xb7c4, 0x30ab, 0xb27d, 0x9d0e,
+    0x3b4c, 0xbaaa, 0x8735, 0x1956, 0x2993, 0xb5ab, 0xad1b, 0x331e, 0x3ee5,
+    0x8208, 0xa0c3, 0xb691, 0xb992, 0x9cfa, 0xb9a6, 0x05d5, 0x2bd9, 0x3406,
+    0x8000, 0x3c24, 0x1f4d, 0x33ff, 0xb805, 0x9411, 0x3c30, 0xb595, 0xc098,
+    0x375a, 0x38a1, 0x3503, 0x310a, 0x3848, 0x3d9a, 0x3527, 0x8a5b, 0xad08,
+    0xb021, 0x249f, 0x9374, 0xbb33, 0xb29f, 0x0b68, 0xafee, 0xa16e, 0x376b,
+    0x3c01, 0xb4c4, 0x84fb, 0xb541, 0xba4e, 0x811d, 0xb9fc, 0xba10, 0x340f,
+    0x9a57, 0xbc6e, 0x1d2a, 0x2c64, 0xbdbe, 0x9825, 0xa004, 0x38cd, 0x9463,
+    0xb097, 0x297c, 0xbdf9, 0x01e7, 0x3b24, 0x9410, 0x3572, 0xa065, 0x3ac1,
+    0x9c44, 0x054f, 0xb890, 0x2197, 0x1dd6, 0x3ea7, 0x1c56, 0x066c, 0xb5d7,
+    0xb83e, 0x00a8, 0xb7ac, 0xa9b2, 0x32bb, 0x1d6c, 0xb1f6, 0xba79, 0xb55b,
+    0xbd5e, 0xb99d, 0x2d01, 0x9cb3, 0xaf92, 0xb0b0, 0x1927, 0x1580, 0x026d,
+    0x3ada, 0xb0ac, 0x35f4, 0x2be3, 0x2bca, 0xb09c, 0x8c19, 0xbb45, 0x3436,
+    0xb2dc, 0x3917, 0x261c, 0x0925, 0x9e5f, 0xb739, 0x0011, 0x91e2, 0x39ed,
+    0x9da0, 0xbada, 0xbc26, 0xb3f7, 0x983b, 0xbad0, 0xbb73, 0xb99c, 0xa9ec,
+    0x35c5, 0xb8f3, 0x20c8, 0x3068, 0x0065, 0x39f2, 0xb06c, 0x4017, 0x1fce,
+    0xb944, 0xa019, 0x03de, 0x255f, 0x3a56, 0x3d3d, 0xbb14, 0xbba6, 0x029f,
+    0xb000, 0xbd0c, 0x89b4, 0x20d2, 0x392f, 0x0e42, 0x3800, 0x301c, 0xa026,
+    0xb616, 0xb7e1, 0x1cdb, 0x1c5d, 0x2a20, 0x1df1, 0x39ee, 0xb8bf, 0xbb48,
+    0x827e, 0x14a6, 0xa3a6, 0x1b6d, 0xb815, 0x1aa2, 0x9eb7, 0x8a08, 0xb830,
+    0x2a69, 0x3be2, 0xbd55, 0x1a40, 0x85c4, 0x25a7, 0x1c68, 0x0c10, 0xb444,
+    0x35d4, 0xb5b4, 0x3466, 0x350e, 0x3abd, 0xb195, 0xbda7, 0x2f32, 0xb878,
+    0x37f0, 0x186a, 0x3a94, 0x2b9c, 0xbd03, 0x0a85, 0x2ef5, 0x28b1, 0x32e7,
+    0x2dc3, 0xb730, 0xba38, 0x8097, 0x9c1a, 0x9d55, 0x3a52, 0x3870, 0xa2e3,
+    0x06d1, 0x2c35, 0xae74, 0x82b0, 0xbc02, 0x3a65, 0x3222, 0x385d, 0x1cd4,
+    0xba6c, 0x36cc, 0xa931, 0x33c2, 0xb4b2, 0x94b6, 0x9c1f, 0x8a85, 0xb886,
+    0x24bf, 0x0ab8, 0xba1d, 0xb5ab, 0xbcc8, 0xa032, 0xa206, 0xb81a, 0x8171,
+    0x3188, 0xb6a2, 0x3677, 0x9938, 0x1c61, 0x0182, 0x1d73, 0x311c, 0x88d1,
+    0xba1d, 0x386f, 0xa6f6, 0x24b7, 0x3a3f, 0xb266, 0x3032, 0xbc00, 0x97c6,
+    0xbc01, 0x225a, 0x33d6, 0x3c03, 0xa1aa, 0xb2d6, 0x0453, 0x9f28, 0x93af,
+    0xb5c9, 0x397a, 0xba76, 0x20cf, 0x00b9, 0xb56c, 0xb59d, 0x3932, 0xb866,
+    0x1fd2, 0x01d6, 0xb9c1, 0xbbe3, 0x02f3, 0xb247, 0x2d45, 0x32c0, 0x2bd5,
+    0x1c0a, 0xb9cd, 0x20b3, 0xbc1d, 0x3731, 0x372a, 0x3347, 0xa124, 0x9710,
+    0xb5ef, 0xb974, 0x82c1, 0xb6e1, 0xb55c, 0xb910, 0x2038, 0x3d89, 0x3eb2,
+    0x0829, 0x401b, 0xbc94, 0x2928, 0xba9a, 0x2f41, 0x0410, 0xbc28, 0x1e05,
+    0x0e5b, 0x1d12, 0x3aed, 0xb5b5, 0x39dc, 0x1de4, 0x9473, 0x11f0, 0xbc72,
+    0x3780, 0x3a14, 0x3763, 0x3cbd, 0xaf2e, 0x1251, 0xb9d0, 0x0410, 0xb0ab,
+    0x1b06, 0x1d25, 0x1b49, 0x396d, 0x3db8, 0x0432, 0x86d1, 0xbcae, 0x3490,
+    0x8e42, 0x389d, 0x851d, 0x1f3e, 0xbbcc, 0x0581, 0x3a0e, 0x3d6f, 0x2e22,
+    0xbe40, 0xb577, 0xbc53, 0xa2f3, 0x3503, 0x30e8, 0x3534, 0x22ff, 0x1a60,
+    0xb800, 0xb5a6, 0x1d84, 0x07cc, 0xbac4, 0xb33c, 0x3cc2, 0xb0a0, 0x200f,
+    0x1b91, 0x0000, 0x3f18, 0xbff1, 0x2850, 0x3590, 0x2d56, 0x8608, 0xbd28,
+    0x14db, 0x8e81, 0x3c10, 0x3e5f, 0xaf87, 0xbc4b, 0xbc49, 0xb674, 0x236e,
+    0x296b, 0x20ec, 0x10a9, 0xadcf, 0x2030, 0x37e2, 0x9d31, 0x97f3, 0x03ff,
+    0xacbc, 0xa942, 0x3b4b, 0x393e, 0xac8b, 0x2ec6, 0x8c60, 0xb13c, 0x21a1,
+    0xacc2, 0x1cdd, 0x928a, 0x865b, 0xb048, 0x3858, 0x8936, 0xb174, 0x3140,
+    0xb57a, 0xb844, 0x3725, 0xba14, 0xbaaf, 0x2b8b, 0x360b, 0x3955, 0x3784,
+    0xa16c, 0x2a9a, 0x2e60, 0x9118, 0x8086, 0x12cf, 0xbc0f, 0xb79f, 0xaa44,
+    0x3085, 0xb1ab, 0x8af2, 0xaf6c, 0xbcf4, 0xb049, 0x1e15, 0x2ea8, 0x0011,
+    0xb7f8, 0x3f31, 0x083a, 0x2c20, 0x180b, 0xbac0, 0x192e, 0x34b4, 0xb807,
+    0xbc93, 0x340a, 0xb3ba, 0xb550, 0x38ea, 0x15ab, 0x253b, 0xa4ae, 0x3183,
+    0x084b, 0x9510, 0xa186, 0x9ffb, 0x9c59, 0x96a5, 0x38be, 0x0086, 0x2d4b,
+    0xb4ce, 0x9e06, 0x19ff, 0x1f6e, 0x827e, 0x3151, 0x8dfb, 0x068e, 0x9f37,
+    0x8d14, 0x3c09, 0xb4eb, 0x37c7, 0x1dc0, 0xc0ac, 0x3580, 0x2fb5, 0x9a17,
+    0x218f, 0xa235, 0x28b7, 0x322f, 0x2d9a, 0x88a7, 0xbcb8, 0xac1e, 0x9bd4,
+    0x1978, 0x3843, 0x1f79, 0x8c29, 0x1876, 0xbaa8, 0xa21c, 0xa282, 0xb020,
+    0x0043, 0x2a1d, 0x3abd, 0x0fea, 0x20cb, 0x1c8b, 0x3b6f, 0x8d53, 0xb46a,
+    0x3426, 0xc0eb, 0x3718, 0x1c69, 0xb667, 0xb236, 0x9f29, 0x3571, 0x33b6,
+    0xaf45, 0x893e, 0xb8b6, 0x2e88, 0x34ee, 0x396b, 0xa650, 0x2772, 0x88a7,
+    0xa651, 0xa675, 0x2032, 0x9196, 0x3c3a, 0x0097, 0x9683, 0xbb86, 0x8a21,
+    0x27aa, 0xb73f, 0x3c4c, 0x228f, 0x382c, 0xb369, 0x0fc0, 0xa0f8, 0xb477,
+    0xb939, 0x3022, 0x96bd, 0x3509, 0x261c, 0x960e, 0x879a, 0xb8a4, 0x107d,
+    0xb621, 0xb2db, 0xc042, 0x2425, 0x0d10, 0x9791, 0xae20, 0x9409, 0xb819,
+    0x3d24, 0x0bcc, 0xacfd, 0x2fed, 0x0a7d, 0x9959, 0x11c6, 0x3c1a, 0x3867,
+    0x2147, 0x3719, 0x2ea2, 0xac83, 0x1ec2, 0xbc29, 0x2e2a, 0x9da3, 0x34ab,
+    0xab19, 0x27b9, 0x85b4, 0x3193, 0xa4bf, 0x2fb6, 0x1ae6, 0xbefa, 0x198d,
+    0x8618, 0xb680, 0xb607, 0x33dd, 0x96ed, 0x2572, 0x88fb, 0x193d, 0xbccc,
+    0x87cc, 0x1f4e, 0xba81, 0x383c, 0xbc33, 0x3c30, 0x3c86, 0xbcf6, 0x37d8,
+    0x8022, 0x3339, 0x1fc3, 0x1279, 0x361d, 0x90f7, 0x32d2, 0x80da, 0xb3d8,
+    0xacce, 0x18df, 0xa0be, 0xbc0a, 0x9ee8, 0x8054, 0x9938, 0xb6cb, 0x1993,
+    0xba6c, 0x9c6d, 0x84fb, 0xb0cb, 0x3331, 0x853e, 0x9ed8, 0xa626, 0x3a85,
+    0xb766, 0x91d7, 0x3f5d, 0xbf45, 0x9d64, 0x34a7, 0xa225, 0x28aa, 0x9323,
+    0x1908, 0xa222, 0x9f43, 0x0bbc, 0x3b67, 0xbd3a, 0xac38, 0x0ed9, 0xba4a,
+    0xb06c, 0x05b4};
+
+#endif /* AUDIO_TO_TACTILE_SRC_PHONETICS_CLASSIFY_PHONEME_PARAMS_F16_H_ */
@@ -0,0 +1,2108 @@
+/* Copyright 2020 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * int8-quantized weights for the phoneme classifier network, used by
+ * ClassifyPhonemeInt8(). Each weight matrix in classify_phoneme_params.h is
+ * quantized with a scale per output unit,
+ *
+ *   kDense1Weights[k + kInputUnits * j]
+ *       ~= kDense1WeightScales[j] * kDense1WeightsInt8[k + kInputUnits * j],
+ *
+ * and similarly for the other layers. Biases and the small output layers are
+ * not quantized and are taken from classify_phoneme_params.h. This file can be
+ * regenerated with extras/python/phonetics/export_model_as_c_data.py using
+ * --quantize_int8.
+ */
+
+#ifndef AUDIO_TO_TACTILE_SRC_PHONETICS_CLASSIFY_PHONEME_PARAMS_INT8_H_
+#define AUDIO_TO_TACTILE_SRC_PHONETICS_CLASSIFY_PHONEME_PARAMS_INT8_H_
+
+#include <stdint.h>
+
+#include "phonetics/classify_phoneme_params.h"
+
+static const int8_t kDense1WeightsInt8[kInputUnits * kDense1Units] = {33, 24,
+    11, -4, -10, -9, -6, 0, 2, -3, -8, -11, -13, -10, 5, 18, 16, 7, 0, -5, -19,
+    -38, -38, -15, 13, 32, 46, 52, 46, 30, 16, 7, 2, 2, 9, 9, -3, -10, -8, 0, 1,
+    0, -6, -15, -16, -4, -7, -14, -10, -4, -1, 3, 7, 10, 2, -8, 21, 13, 3, -7,
+    -10, -9, -7, 0, 6, 3, -4, -9, -12, -11, -2, 6, 5, 1, -1, -1, -7, -13, -2,
+    23, 41, 44, 40, 29, 6, -17, -24, -23, -19, -11, 2, 7, -2, -9, -7, -2, 0, 2,
+    -3, -9, -9, -1, -7, -11, -2, 10, 11, 11, 10, 10, -1, -11, 2, -4, -9, -13,
+    -10, -6, -3, 3, 11, 8, -1, -8, -11, -10, -5, 0, 0, -1, 0, 2, 4, 12, 34, 57,
+    62, 47, 25, 0, -32, -56, -58, -48, -35, -19, 1, 11, 6, 0, -1, -1, 0, 5, 3,
+    0, 0, 5, -5, -7, 0, 11, 14, 13, 11, 8, -6, -15, -22, -27, -29, -26, -16, -5,
+    1, 8, 17, 15, 4, -6, -7, -3, 2, 8, 11, 11, 10, 13, 23, 44, 71, 82, 62, 23,
+    -14, -43, -70, -87, -82, -66, -48, -26, 0, 16, 13, 8, 7, 3, 1, 8, 10, 9, 9,
+    12, 3, 6, 7, 10, 13, 10, 9, 3, -12, -17, -29, -36, -40, -36, -22, -5, 6, 15,
+    25, 24, 13, 4, 5, 14, 24, 35, 41, 38, 30, 29, 44, 72, 96, 87, 33, -35, -86,
+    -111, -124, -127, -114, -93, -71, -45, -16, 3, 3, 0, -1, -7, -8, 2, 6, 7, 5,
+    9, 4, 12, 9, 2, -1, -3, -3, -5, -16, -18, 42, 43, 38, 31, 19, 8, 1, -1, -5,
+    -9, -6, -1, -2, -7, -15, -33, -57, -68, -52, -23, -6, -12, -36, -51, -38,
+    -9, 10, 12, 10, 13, 17, 18, 11, -3, -22, -43, -58, -56, -43, -32, -15, -8,
+    0, 9, 21, 20, 3, 6, 7, -6, -9, -1, -14, -32, -26, -8, 17, 19, 17, 15, 8, 3,
+    -1, -2, -4, -3, 6, 14, 12, 3, -6, -18, -29, -31, -13, 15, 33, 26, -2, -22,
+    -13, 17, 41, 47, 45, 42, 41, 36, 23, 3, -16, -31, -36, -24, -7, 0, 11, 11,
+    8, 6, 11, 9, -4, -4, -6, -15, -10, -2, -14, -27, -16, 4, -8, -5, -3, 1, 5,
+    9, 8, 4, -2, 1, 15, 26, 23, 9, -4, -12, -13, -7, 12, 35, 47, 35, 5, -18, -9,
+    25, 57, 70, 67, 57, 48, 41, 22, -2, -21, -32, -30, -11, 11, 18, 25, 18, 6,
+    -5, -5, -7, -16, -18, -22, -26, -15, -4, -11, -16, 6, 32, -32, -27, -22,
+    -14, -1, 10, 13, 6, -3, -2, 13, 27, 24, 8, -8, -14, -8, 1, 14, 28, 28, 6,
+    -31, -57, -49, -11, 31, 58, 67, 62, 54, 51, 35, 7, -16, -31, -31, -8, 19,
+    29, 37, 26, 10, -3, -9, -17, -25, -25, -26, -30, -18, -5, -7, 3, 39, 73,
+    -63, -53, -44, -33, -16, -1, 1, -7, -20, -21, -6, 8, 6, -10, -27, -32, -26,
+    -20, -15, -11, -21, -52, -95, -127, -121, -79, -24, 24, 61, 77, 83, 92, 79,
+    44, 7, -22, -32, -11, 23, 41, 56, 45, 24, 4, -12, -32, -43, -38, -36, -43,
+    -32, -18, -11, 15, 67, 108, 6, 10, 11, 9, 6, 4, 5, 1, -3, -1, 3, 5, 2, -5,
+    -15, -21, -14, -4, 4, 11, 15, 17, 14, 8, 11, 24, 39, 52, 48, 28, -2, -26,
+    -38, -37, -27, -18, -14, -15, -15, -16, -12, -8, -17, -12, -4, -1, 1, 13,
+    16, 24, 31, 29, 21, 8, 5, -2, -6, 0, 2, 3, 2, 2, 3, -2, -7, -5, 0, 5, 5, -1,
+    -13, -22, -22, -18, -13, -8, -7, -7, -12, -16, -10, 8, 32, 57, 66, 55, 31,
+    7, -9, -17, -14, -10, -8, -7, -4, -5, -1, 4, 2, 3, 3, 0, -3, 5, 5, 3, 5, 5,
+    3, 1, 3, 0, -21, -12, -6, -1, 2, 3, 4, 0, -5, -4, 3, 9, 8, 0, -9, -15, -15,
+    -13, -11, -8, -8, -10, -16, -25, -26, -15, 10, 44, 67, 63, 44, 23, 5, -6,
+    -5, -3, -3, -2, 2, 1, 4, 7, 9, 9, 6, 1, -4, -2, -4, -8, -10, -7, -6, -5, 0,
+    5, -29, -17, -6, 2, 6, 8, 5, -1, -6, -3, 4, 10, 9, 0, -6, -5, -1, 1, 0, 0,
+    -1, -4, -12, -29, -47, -54, -41, -7, 27, 40, 34, 24, 15, 11, 12, 11, 10, 8,
+    5, 0, 0, 0, 2, 3, 3, 2, -4, -7, -12, -15, -17, -12, -8, -7, -1, 11, -17, -6,
+    5, 14, 20, 21, 15, 5, -2, 0, 9, 16, 14, 5, 1, 7, 11, 6, -4, -11, -14, -18,
+    -31, -60, -97, -125, -127, -97, -50, -14, 6, 19, 28, 36, 42, 39, 32, 23, 10,
+    0, -3, -3, 1, 5, 12, 14, 4, -5, -16, -18, -16, -6, -1, -2, 2, 18, -13, -19,
+    -30, -45, -59, -66, -58, -38, -20, -19, -35, -40, -16, 27, 53, 44, 26, 28,
+    40, 41, 29, 23, 23, 17, 2, -10, -20, -35, -54, -67, -61, -49, -43, -47, -54,
+    -56, -51, -40, -21, -2, 12, 45, 64, 59, 61, 65, 36, 1, -4, -15, -29, -31,
+    -39, -72, -62, -27, -4, -9, -17, -30, -44, -53, -48, -30, -13, -9, -19, -20,
+    3, 37, 52, 33, 6, 4, 19, 30, 32, 37, 43, 36, 21, 9, 1, -12, -28, -33, -19,
+    -1, 7, 2, -10, -18, -18, -13, 1, 19, 25, 43, 51, 43, 43, 51, 32, 4, 5, 2,
+    -8, -4, -8, -42, -32, -2, -5, -7, -12, -22, -34, -44, -42, -28, -13, -8,
+    -13, -10, 9, 33, 37, 7, -28, -34, -15, 11, 33, 56, 68, 58, 36, 19, 6, -12,
+    -32, -34, -12, 14, 28, 25, 12, -1, -7, -7, 3, 19, 21, 27, 30, 24, 21, 27,
+    12, -12, 1, 11, 5, 14, 17, -11, 1, 28, 0, -1, -4, -12, -24, -35, -36, -25,
+    -15, -11, -13, -10, 3, 16, 10, -24, -62, -70, -44, -3, 41, 83, 103, 87, 51,
+    19, -5, -32, -57, -58, -30, 6, 29, 33, 20, 5, -4, -2, 13, 34, 40, 42, 40,
+    31, 22, 22, 4, -25, -6, 15, 10, 20, 32, 13, 30, 58, 13, 13, 10, 0, -14, -29,
+    -34, -29, -25, -26, -31, -31, -24, -18, -28, -61, -97, -101, -69, -15, 46,
+    103, 127, 103, 51, 3, -34, -67, -93, -91, -56, -11, 22, 33, 25, 11, 6, 14,
+    38, 70, 85, 87, 78, 58, 38, 29, 5, -28, -10, 17, 12, 21, 38, 30, 54, 82, -9,
+    -7, -6, -1, 9, 20, 20, 11, -1, -4, 2, 10, 15, 13, 7, 7, 13, 20, 28, 32, 24,
+    13, 11, 14, 17, 19, 22, 25, 31, 36, 37, 37, 52, 75, 90, 98, 108, 114, 94,
+    53, 15, -23, -74, -114, -127, -115, -91, -66, -43, -35, -14, 20, 41, 54, 78,
+    121, -12, -13, -15, -13, -5, 2, 5, 2, -8, -12, -7, 0, 5, 4, -1, -3, 0, 4,
+    12, 17, 11, 3, 1, 6, 8, 5, 1, -4, -4, -1, 1, 2, 15, 33, 43, 46, 53, 58, 42,
+    12, -13, -35, -67, -90, -96, -89, -71, -51, -34, -33, -24, 0, 15, 27, 46,
+    82, -1, -6, -13, -13, -8, -3, 0, 0, -9, -14, -11, -6, -4, -6, -13, -18, -18,
+    -11, 1, 9, 4, -6, -9, -5, -2, -4, -7, -12, -17, -17, -14, -15, -5, 10, 18,
+    19, 27, 36, 28, 11, 0, -10, -26, -36, -42, -44, -41, -29, -18, -20, -19,
+    -10, -6, 2, 13, 37, 26, 16, 4, 0, 2, 3, 6, 5, -4, -7, -3, 1, 3, 1, -9, -21,
+    -23, -15, 0, 12, 9, -5, -13, -9, -5, -3, -2, -7, -15, -18, -16, -21, -20,
+    -12, -8, -9, 2, 22, 28, 26, 24, 22, 13, 10, 6, -8, -18, -16, -10, -9, -8,
+    -12, -21, -18, -13, 1, 54, 45, 30, 20, 14, 8, 7, 3, -8, -10, -3, 6, 13, 15,
+    6, -10, -18, -11, 7, 23, 20, 3, -6, -2, 2, 3, 3, -3, -15, -21, -20, -28,
+    -34, -33, -33, -33, -17, 15, 37, 46, 50, 54, 50, 49, 43, 18, -5, -13, -11,
+    -3, 2, -10, -31, -33, -29, -20, 31, 16, 2, -9, -11, -6, -1, 0, 0, -1, -1, 6,
+    17, 18, 11, 6, 0, -12, -24, -23, 1, 27, 28, -9, -66, -109, -118, -93, -43,
+    11, 46, 56, 57, 50, 38, 35, 27, 8, -6, -19, -16, -1, 0, 7, 16, 4, -2, -8,
+    -6, -6, -5, -13, -18, -8, -5, 8, 31, 17, 4, -6, -10, -8, -4, -4, -7, -10,
+    -11, -6, 5, 8, 3, -2, -8, -17, -25, -23, -4, 15, 14, -14, -49, -63, -48,
+    -14, 24, 52, 58, 45, 36, 26, 12, 8, -1, -12, -8, -7, -4, 5, 0, 0, 3, -5, -3,
+    -8, -7, -3, 1, -3, -4, -1, -6, 1, 38, 25, 13, 4, -1, 1, 4, 1, -6, -12, -15,
+    -11, -1, 2, -4, -12, -17, -21, -22, -19, -10, -7, -16, -32, -42, -26, 13,
+    52, 77, 83, 68, 38, 18, 3, -12, -15, -20, -22, -6, 2, 3, 10, 1, -3, -3, -11,
+    -6, -8, -7, -3, 3, 3, 7, 8, -1, 4, 22, 9, -1, -6, -5, 4, 9, 5, -5, -14, -17,
+    -13, -4, -4, -16, -24, -24, -16, -7, -5, -9, -20, -31, -34, -19, 17, 61, 86,
+    84, 65, 32, -9, -31, -39, -41, -27, -17, -9, 11, 18, 12, 16, 5, 0, 2, -8,
+    -5, -7, -8, -6, 0, 1, 5, 6, 0, 12, 28, 4, -14, -20, -15, 1, 15, 15, 4, -7,
+    -11, -4, 7, 5, -9, -16, -7, 17, 38, 38, 19, -1, -6, 10, 40, 77, 100, 85, 36,
+    -23, -79, -120, -127, -110, -83, -46, -19, -5, 11, 16, 7, 12, 9, 9, 15, 12,
+    19, 14, 3, -2, 1, -1, 0, 1, -2, 16, 36, 39, 34, 16, -12, -35, -43, -49, -59,
+    -58, -41, -24, -10, -5, -5, 3, 21, 32, 23, 2, -15, -11, 11, 36, 54, 66, 77,
+    83, 83, 82, 71, 45, 12, -12, -31, -52, -67, -71, -70, -56, -24, -9, -23,
+    -20, -11, -11, -7, 1, 1, 11, 6, -18, -29, -23, -10, -31, 42, 48, 46, 31, 4,
+    -19, -26, -30, -41, -42, -32, -21, -11, -6, -7, -2, 10, 15, 5, -14, -29,
+    -27, -13, 2, 11, 19, 33, 51, 70, 81, 74, 46, 8, -20, -42, -59, -66, -63,
+    -59, -43, -11, 7, -1, 3, 9, 7, 5, 3, 0, 13, 21, 12, 5, 4, 15, -2, 53, 62,
+    63, 48, 18, -9, -18, -21, -31, -37, -34, -30, -25, -23, -23, -18, -6, -2,
+    -10, -23, -30, -27, -18, -13, -15, -15, -3, 23, 56, 79, 76, 47, 7, -24, -46,
+    -60, -59, -52, -48, -32, -2, 18, 14, 16, 14, 6, 0, -7, -9, 8, 25, 31, 29,
+    27, 34, 17, 76, 89, 94, 79, 44, 10, -3, -11, -27, -40, -45, -48, -49, -51,
+    -51, -42, -28, -21, -25, -30, -26, -14, -6, -7, -18, -28, -23, 2, 43, 76,
+    83, 61, 22, -13, -37, -48, -45, -38, -34, -20, 5, 21, 14, 9, -5, -17, -20,
+    -18, -13, 5, 30, 46, 47, 41, 39, 16, 92, 114, 127, 114, 76, 37, 18, 3, -23,
+    -47, -62, -72, -77, -80, -80, -71, -54, -43, -42, -37, -19, 5, 19, 17, 3,
+    -12, -13, 10, 53, 93, 111, 98, 63, 25, -2, -16, -17, -12, -9, 0, 15, 20, 3,
+    -14, -37, -53, -50, -36, -22, -1, 31, 53, 53, 40, 28, 1, -18, -7, 7, 21, 27,
+    22, 16, 11, 2, -9, -10, 2, 23, 40, 41, 29, 14, 9, 14, 22, 25, 20, 17, 27,
+    48, 66, 71, 64, 53, 41, 27, 8, -13, -34, -55, -73, -91, -107, -119, -127,
+    -126, -116, -99, -77, -51, -25, -9, -4, 0, 2, 5, 19, 31, 18, 26, 52, -28,
+    -19, -6, 8, 13, 9, 3, -3, -11, -20, -22, -12, 5, 19, 21, 12, 1, -2, 3, 11,
+    13, 7, 1, 7, 26, 45, 53, 51, 43, 34, 24, 10, -7, -25, -44, -62, -80, -95,
+    -108, -117, -120, -118, -110, -96, -79, -59, -42, -30, -19, -12, -6, 5, 15,
+    8, 13, 31, -20, -12, 0, 12, 17, 15, 10, 3, -8, -17, -19, -12, -1, 9, 11, 6,
+    -2, -5, 0, 7, 9, 0, -9, -5, 13, 34, 46, 47, 42, 38, 34, 27, 15, -1, -18,
+    -36, -54, -71, -86, -98, -106, -111, -111, -106, -96, -82, -66, -48, -31,
+    -18, -12, -4, 6, 5, 10, 20, -10, -2, 9, 19, 24, 23, 19, 12, 1, -9, -13, -10,
+    -3, 3, 5, 5, 1, -1, 2, 9, 8, -4, -16, -14, 4, 26, 39, 42, 40, 39, 39, 37,
+    29, 18, 3, -13, -31, -48, -63, -77, -90, -100, -105, -104, -98, -88, -73,
+    -55, -36, -21, -13, -8, 3, 8, 15, 24, -13, -5, 5, 14, 20, 20, 18, 13, 3, -6,
+    -10, -9, -4, -2, 0, 5, 8, 10, 15, 20, 17, 1, -14, -14, 2, 26, 42, 49, 50,
+    50, 50, 46, 38, 27, 15, -1, -19, -37, -53, -69, -82, -94, -100, -101, -97,
+    -88, -73, -57, -39, -22, -13, -8, 2, 12, 22, 32, -42, -41, -40, -39, -28,
+    -10, 7, 14, 10, 1, 4, 14, 8, 6, 19, 26, 20, 11, 4, 0, 3, 10, 12, 16, 23, 23,
+    12, 1, 4, 20, 33, 36, 33, 25, 13, 3, -10, -30, -51, -57, -57, -66, -62, -49,
+    -46, -45, -41, -22, -9, -2, -7, 6, -3, -36, -23, -17, -44, -36, -25, -18,
+    -6, 8, 21, 24, 15, 2, 1, 11, 6, -2, 1, 4, -3, -8, -3, 1, 4, 6, 3, 2, 9, 14,
+    7, -4, -7, 2, 9, 9, 8, 6, -2, -8, -13, -24, -39, -41, -41, -53, -51, -43,
+    -48, -50, -51, -42, -31, -25, -32, -21, -25, -46, -25, -8, -38, -26, -12,
+    -6, -2, 5, 13, 16, 9, -5, -6, 5, 4, -5, -4, -4, -13, -17, -6, 3, 3, 0, -7,
+    -12, -8, -5, -11, -22, -26, -19, -15, -15, -12, -12, -19, -24, -27, -31,
+    -45, -45, -40, -50, -49, -43, -49, -47, -52, -50, -40, -33, -41, -28, -24,
+    -37, -14, 11, -14, -2, 15, 20, 17, 16, 16, 16, 7, -14, -21, -10, -12, -25,
+    -27, -24, -29, -30, -14, -4, -6, -10, -19, -28, -27, -22, -22, -25, -28,
+    -21, -16, -17, -10, -6, -12, -16, -16, -17, -23, -12, 6, 4, 8, 12, 6, 15, 7,
+    -4, -7, -7, -17, -2, 9, 1, 21, 48, 57, 49, 52, 55, 52, 46, 42, 40, 29, 3,
+    -7, 5, 7, -6, -8, 1, 2, 4, 22, 30, 26, 22, 14, 12, 21, 35, 44, 46, 44, 40,
+    33, 24, 26, 27, 18, 14, 16, 19, 24, 54, 96, 114, 125, 127, 116, 122, 108,
+    79, 56, 42, 31, 52, 70, 59, 73, 96, -6, -24, -25, -12, 6, 15, 9, 8, 22, 33,
+    27, 10, -1, -3, 0, 3, 9, 30, 60, 83, 92, 79, 50, 21, -6, -35, -62, -68, -56,
+    -39, -18, -6, 3, 16, 27, 27, 21, 24, 37, 51, 53, 41, 22, 7, 11, 27, -1, -5,
+    1, -3, 4, -10, -51, -50, -73, -127, 21, 5, 5, 16, 32, 40, 34, 29, 37, 41,
+    28, 8, -3, -4, 0, 4, 12, 32, 55, 67, 67, 54, 33, 14, -4, -24, -42, -39, -25,
+    -15, -5, -7, -9, 1, 16, 21, 15, 19, 31, 40, 42, 33, 18, 10, 13, 26, 8, 7,
+    16, 16, 21, 11, -23, -21, -34, -78, 21, 7, 6, 13, 23, 29, 26, 27, 39, 38,
+    18, -6, -16, -13, -7, -1, 8, 25, 41, 46, 42, 30, 15, 5, -5, -20, -29, -16,
+    5, 10, 5, -13, -24, -16, -1, 5, -1, -3, -1, 3, 7, 7, 4, 6, 13, 22, 8, 7, 13,
+    17, 21, 14, -13, -1, 3, -31, 19, 1, -10, -12, -7, -3, 0, 14, 37, 38, 12,
+    -22, -38, -30, -15, -4, 11, 31, 41, 35, 19, -2, -21, -31, -35, -36, -25, 10,
+    46, 53, 39, 12, -7, -4, 6, 5, -15, -36, -53, -53, -39, -24, -19, -9, 10, 20,
+    10, 15, 17, 18, 20, 12, -4, 22, 35, 3, 109, 94, 77, 64, 61, 61, 61, 74, 97,
+    98, 66, 18, -9, 1, 19, 27, 39, 55, 55, 33, -3, -47, -82, -99, -99, -85, -52,
+    4, 56, 75, 69, 47, 30, 28, 31, 21, -12, -54, -95, -100, -75, -40, -26, -11,
+    22, 41, 37, 41, 36, 22, 12, 9, 9, 49, 61, 22, 28, 15, 5, -1, -5, -4, -2, 0,
+    -1, 1, 8, 10, 2, -11, -18, -22, -31, -40, -36, -19, -2, -7, -31, -52, -49,
+    -14, 36, 84, 122, 127, 104, 58, 11, -27, -38, -33, -28, -21, -11, 3, 2, 2,
+    -7, -15, -17, -8, -6, -6, -1, -1, 11, 10, 4, 12, 4, -9, 12, 3, -4, -6, -9,
+    -8, -7, -7, -7, -1, 8, 8, 0, -9, -13, -11, -12, -13, -6, 8, 22, 21, 10, 3,
+    11, 35, 61, 72, 68, 43, 9, -25, -47, -57, -48, -34, -26, -16, -2, 11, 9, 10,
+    3, -5, -6, -2, -4, -5, 1, -2, 4, 3, -1, 6, 1, -11, -3, -7, -8, -6, -6, -5,
+    -8, -14, -15, -7, 2, 4, 1, -5, -7, -2, 4, 7, 13, 20, 28, 28, 28, 32, 42, 55,
+    57, 39, 7, -33, -64, -79, -72, -55, -32, -16, -9, -1, 8, 13, 7, 12, 10, 6,
+    4, 5, -1, 0, 6, -2, 0, -1, -5, 4, 4, -8, -7, -9, -3, 6, 9, 9, 0, -13, -18,
+    -13, -4, -1, -2, -4, -3, 4, 12, 16, 18, 14, 9, 4, 5, 12, 23, 31, 19, -14,
+    -53, -86, -99, -88, -55, -17, 13, 23, 21, 25, 26, 15, -3, 0, 1, 0, 1, 2, -3,
+    1, 12, 1, 2, 2, -4, 3, 6, -5, 9, 3, 8, 20, 29, 32, 22, 5, -4, -4, -2, -4,
+    -7, -9, -6, 4, 15, 19, 15, 2, -16, -32, -37, -30, -18, -10, -24, -60, -94,
+    -114, -105, -69, -14, 38, 71, 76, 69, 69, 63, 38, 6, -2, -8, -12, -9, -4,
+    -8, -3, 12, 3, 5, 9, -1, 3, 6, -6, -18, -16, -12, -5, 2, 4, 2, -3, -4, -4,
+    -2, 0, -1, 2, 14, 31, 42, 39, 30, 25, 24, 24, 23, 17, 8, 3, 7, 20, 34, 39,
+    42, 46, 47, 41, 27, 2, -26, -45, -45, -35, -25, -20, -16, -15, -27, -52,
+    -74, -78, -78, -87, -99, -114, -127, -109, -84, -87, -12, -8, -2, 6, 13, 14,
+    11, 7, 4, 3, 4, 6, 6, 9, 19, 31, 39, 37, 30, 25, 24, 25, 25, 23, 15, 9, 10,
+    20, 30, 33, 35, 40, 42, 39, 28, 7, -17, -34, -34, -24, -14, -9, -5, -3, -14,
+    -38, -59, -63, -63, -72, -83, -97, -108, -89, -64, -65, -13, -7, 1, 10, 16,
+    17, 15, 13, 12, 10, 9, 10, 12, 14, 19, 27, 34, 33, 27, 22, 18, 17, 21, 23,
+    20, 12, 7, 10, 17, 21, 23, 29, 34, 34, 28, 11, -10, -26, -29, -19, -8, -3,
+    0, 1, -8, -28, -45, -50, -51, -58, -67, -78, -84, -63, -39, -36, -30, -20,
+    -7, 6, 14, 15, 14, 13, 12, 7, 3, 4, 7, 10, 13, 16, 20, 22, 18, 12, 5, 3, 10,
+    19, 20, 10, -2, -5, -2, 2, 8, 17, 26, 29, 27, 15, -3, -19, -24, -17, -6, 1,
+    5, 5, -3, -20, -34, -41, -45, -52, -57, -61, -59, -38, -14, -9, -63, -50,
+    -30, -11, 2, 7, 7, 4, 0, -8, -15, -16, -12, -7, -5, -4, 1, 4, 3, -5, -14,
+    -15, -4, 10, 13, 1, -16, -24, -23, -17, -5, 11, 25, 34, 35, 25, 7, -10, -17,
+    -13, -2, 10, 16, 15, 6, -9, -23, -33, -44, -51, -52, -50, -41, -17, 5, 10,
+    56, 54, 49, 37, 23, 14, 23, 35, 31, 1, -38, -56, -46, -23, -4, -8, -37, -61,
+    -55, -21, 18, 36, 26, 0, -24, -27, -9, 12, 21, 18, 3, -13, -20, -20, -13,
+    -6, -6, 1, 15, 23, 22, 15, 19, 27, 11, -2, 7, 0, -12, -4, 14, 15, 16, 32,
+    13, -22, 58, 57, 50, 34, 12, -3, 2, 12, 10, -14, -46, -58, -41, -10, 17, 19,
+    -10, -38, -36, -6, 30, 45, 32, 3, -23, -28, -10, 13, 21, 14, -4, -19, -24,
+    -23, -15, -6, -4, -1, 7, 11, 7, 1, 5, 12, -5, -15, -3, -9, -16, -9, 6, 8, 8,
+    23, 8, -25, 72, 71, 61, 37, 5, -19, -21, -12, -14, -35, -62, -67, -39, 8,
+    50, 57, 24, -15, -24, 2, 38, 55, 40, 6, -25, -34, -17, 4, 11, 2, -13, -23,
+    -26, -24, -17, -9, -9, -7, 0, 5, 5, -2, 1, 6, -14, -24, -15, -20, -19, -8,
+    1, 4, 4, 15, -2, -39, 87, 81, 66, 34, -10, -46, -58, -51, -50, -68, -92,
+    -89, -46, 21, 80, 94, 55, 2, -18, 4, 44, 66, 52, 14, -23, -38, -25, -6, 4,
+    1, -7, -11, -12, -12, -10, -5, -4, -4, -1, 8, 11, 4, 2, 3, -17, -29, -25,
+    -29, -19, -3, 4, 8, 10, 14, -14, -58, 126, 110, 82, 36, -24, -75, -99, -97,
+    -94, -108, -127, -117, -61, 21, 92, 108, 61, -3, -30, -5, 43, 73, 61, 21,
+    -20, -39, -33, -19, -9, -8, -9, -8, -7, -9, -11, -8, -6, -6, -5, 4, 7, -2,
+    -6, -3, -18, -28, -28, -30, -13, 9, 19, 26, 27, 19, -23, -71, -60, -64, -46,
+    -6, 35, 65, 70, 58, 45, 17, -18, -28, -9, 12, 20, 23, 25, 13, -12, -21, 2,
+    49, 93, 111, 105, 98, 95, 85, 76, 74, 65, 47, 27, 26, 30, 30, 43, 65, 56,
+    37, 23, 0, -24, -47, -60, -77, -92, -79, -78, -98, -112, -104, -96, -61,
+    -55, -46, -48, -46, -23, 16, 59, 85, 83, 68, 58, 34, 5, 2, 23, 42, 48, 44,
+    32, 6, -28, -41, -19, 25, 64, 81, 80, 77, 74, 62, 56, 61, 56, 38, 19, 20,
+    28, 27, 40, 68, 72, 62, 63, 60, 46, 33, 30, 22, 4, -7, -18, -33, -38, -22,
+    -11, 10, 26, 60, -69, -67, -45, -8, 33, 56, 53, 40, 34, 16, -7, -7, 13, 32,
+    40, 36, 22, -7, -44, -60, -42, -5, 22, 24, 17, 13, 12, 7, 11, 21, 17, 1,
+    -14, -8, -1, -9, -4, 24, 32, 20, 27, 38, 34, 28, 36, 37, 22, 5, -8, -14, -9,
+    11, 24, 40, 65, 118, -70, -75, -63, -30, 12, 38, 40, 31, 30, 18, -6, -16,
+    -5, 9, 11, 7, 1, -16, -40, -43, -16, 15, 18, -8, -35, -47, -43, -33, -15, 1,
+    1, -11, -20, -13, -15, -36, -44, -27, -26, -46, -43, -29, -33, -41, -24, -8,
+    -12, -23, -29, -24, -6, 12, 18, 24, 46, 102, -126, -127, -116, -84, -39, -7,
+    0, -2, 4, -6, -38, -60, -54, -36, -27, -23, -13, -9, -9, 12, 53, 80, 61, 4,
+    -49, -75, -69, -47, -16, 7, 13, 8, 9, 19, 10, -24, -48, -47, -61, -91, -93,
+    -82, -91, -105, -75, -38, -28, -24, -15, -3, 25, 39, 26, 8, 14, 57, -41,
+    -53, -67, -75, -71, -63, -53, -43, -30, -21, -17, -15, -13, -5, 4, 7, 9, 9,
+    9, 8, 5, -1, -2, 4, 8, 9, 9, 8, -2, -5, 7, 13, 7, 2, 5, 10, 8, 5, 9, 7, 8,
+    4, 3, -2, -9, 5, 4, 8, 9, 6, -4, 3, -2, -4, -2, -5, -38, -48, -61, -68, -69,
+    -64, -56, -46, -35, -28, -25, -24, -22, -18, -12, -11, -12, -10, -7, -2, 1,
+    1, 1, 5, 8, 9, 8, 5, -5, -6, 4, 9, 2, -4, -2, 1, 0, -1, 4, 3, 3, -2, 1, 2,
+    -5, 1, 0, 4, 1, 1, -3, 6, 1, 1, -2, -9, -5, -12, -22, -29, -33, -35, -32,
+    -26, -21, -19, -18, -18, -15, -12, -10, -13, -17, -17, -12, -5, 2, 4, 4, 6,
+    9, 11, 12, 10, 2, 3, 14, 16, 10, 0, -6, -7, -7, -8, -4, -2, -2, -5, 3, 8, 3,
+    6, 5, 2, -1, 0, -2, 5, 5, 6, -3, -10, 36, 32, 24, 18, 12, 5, 3, 3, 3, 2, 0,
+    -1, 1, 1, -2, -9, -13, -9, 0, 8, 13, 12, 9, 7, 5, 3, 4, 5, 3, 8, 16, 16, 10,
+    2, -7, -10, -7, -7, -5, 3, 5, 1, 9, 14, 7, 7, 2, -5, -3, 3, -2, -2, 2, 4, 0,
+    1, 127, 116, 104, 96, 86, 76, 69, 65, 62, 58, 56, 52, 49, 44, 34, 21, 14,
+    20, 33, 41, 40, 30, 14, -2, -18, -31, -40, -43, -47, -40, -30, -28, -29,
+    -32, -35, -29, -14, -7, -3, 6, 9, 8, 22, 28, 17, 9, -1, -13, -9, -1, -8,
+    -11, -8, -4, 4, 16, -63, -43, -17, 3, 18, 27, 23, 9, -5, -13, -15, -12, -11,
+    -15, -20, -23, -25, -22, -10, 6, 19, 19, 8, -7, -19, -23, -17, -4, 7, 7, 6,
+    14, 25, 36, 35, 21, 6, -6, -12, 2, 16, 22, 24, 3, -32, -61, -82, -88, -76,
+    -55, -15, 34, 59, 66, 96, 127, -52, -34, -11, 8, 21, 29, 27, 15, 3, -3, -3,
+    2, 4, 1, -4, -7, -8, -7, -1, 11, 20, 22, 14, 1, -11, -20, -21, -15, -9, -9,
+    -4, 9, 25, 40, 44, 31, 13, -4, -16, -8, 2, 5, 6, -11, -40, -62, -80, -85,
+    -67, -43, -5, 41, 66, 71, 96, 123, -39, -24, -5, 11, 22, 28, 26, 17, 8, 4,
+    4, 9, 11, 9, 5, 2, 1, 0, 1, 7, 14, 17, 13, 2, -11, -23, -29, -30, -29, -29,
+    -20, 1, 26, 48, 58, 48, 27, 5, -15, -14, -9, -11, -12, -29, -53, -69, -83,
+    -84, -60, -28, 9, 48, 68, 71, 90, 113, -26, -15, 0, 12, 19, 22, 19, 11, 4,
+    1, 3, 8, 11, 10, 8, 4, 0, -5, -9, -8, -1, 4, 2, -7, -19, -31, -39, -44, -45,
+    -43, -29, -2, 28, 57, 73, 67, 47, 21, -4, -12, -12, -17, -23, -41, -63, -77,
+    -87, -84, -54, -16, 20, 49, 61, 61, 77, 95, -12, -3, 8, 16, 20, 19, 14, 4,
+    -3, -4, -3, 0, 2, 4, 4, 0, -6, -15, -25, -28, -22, -16, -16, -24, -35, -46,
+    -56, -62, -62, -57, -39, -8, 28, 61, 81, 78, 58, 31, 4, -11, -15, -22, -30,
+    -50, -72, -87, -98, -93, -60, -20, 15, 36, 43, 44, 59, 74, -12, -6, 0, 1,
+    -8, -6, 5, 7, 3, 2, 2, -3, -4, 2, 0, -7, -7, -5, -4, -2, 1, 4, 4, 0, 2, 6,
+    2, -3, 7, 11, 2, 3, 5, 3, -1, -5, -4, -2, -1, 0, -4, -2, -5, -9, 0, -2, 2,
+    5, 4, -4, -10, -10, -2, -7, 0, 5, -6, -3, -4, -4, -12, -15, -6, -1, 0, 0,
+    -3, -8, -8, 1, -1, -7, -4, -1, -1, 1, 5, 8, 7, 1, 3, 6, 2, -6, -3, 1, -7,
+    -5, -3, -2, 0, -1, 0, 3, 2, 3, 0, 0, -2, -5, 2, -2, 2, 3, 5, 7, 8, 4, 8, -5,
+    -5, 0, 19, 17, 11, 5, -5, -15, -11, -6, -4, -3, -4, -7, -9, -3, -6, -14, -9,
+    -3, -5, -5, 0, 4, 3, 0, 0, 2, -2, -10, -8, -1, -5, -4, -6, -6, -1, 1, 1, 3,
+    2, 5, 3, 0, -3, -4, 1, -6, -4, -7, -2, 1, 8, 7, 8, -1, 2, 2, 66, 67, 69, 68,
+    57, 43, 38, 36, 34, 30, 22, 17, 19, 24, 20, 10, 11, 11, 5, 5, 14, 18, 13, 5,
+    4, 5, 2, -4, -2, 4, 3, 7, 6, 4, 8, 12, 11, 13, 9, 10, 12, 9, 5, 2, 4, -2,
+    -5, -17, -18, -17, -5, -4, -3, 0, 7, -5, -127, -100, -69, -47, -40, -41,
+    -35, -23, -10, -7, -15, -19, -17, -11, -9, -8, 0, 2, -2, 2, 13, 9, -12, -29,
+    -27, -16, -9, -6, 1, 7, 6, 10, 10, 5, -3, -10, -15, -19, -28, -28, -17, -5,
+    7, 11, 15, 14, 15, 7, 12, 15, 24, 12, 7, 23, 26, -9, -37, -18, 7, 29, 38,
+    42, 42, 43, 49, 57, 61, 58, 52, 48, 51, 47, 32, 17, 17, 30, 37, 34, 28, 23,
+    24, 33, 51, 73, 88, 85, 62, 32, 3, -26, -45, -55, -58, -56, -36, -15, -12,
+    -20, -43, -52, -64, -88, -82, -58, -42, -31, -24, -29, -34, -30, -23, -19,
+    -51, -36, -17, -4, -2, -5, -8, -9, -4, 5, 13, 19, 20, 24, 32, 32, 17, 1, -2,
+    7, 12, 9, 2, -4, -4, 2, 14, 33, 50, 57, 51, 40, 27, 9, -5, -16, -22, -27,
+    -19, 1, 9, 8, -6, -11, -17, -37, -34, -22, -16, -8, 1, -4, -11, -9, -2, 5,
+    -39, -29, -17, -12, -18, -28, -35, -39, -36, -27, -14, -3, 2, 7, 16, 16, -1,
+    -22, -29, -25, -22, -24, -32, -40, -43, -42, -36, -22, -2, 16, 28, 38, 45,
+    44, 39, 32, 22, 4, -7, 3, 10, 17, 17, 19, 18, 6, 8, 9, 3, 4, 13, 10, 3, 4,
+    12, 25, -12, -4, 2, 0, -13, -30, -41, -47, -46, -37, -21, -8, -5, -4, 0, -6,
+    -28, -54, -65, -64, -61, -63, -71, -82, -88, -90, -87, -75, -52, -25, -2,
+    22, 46, 63, 71, 67, 55, 27, -1, -8, -8, 5, 15, 27, 32, 29, 33, 26, 9, 1, 3,
+    2, -4, -3, 7, 25, 10, 17, 19, 11, -8, -32, -48, -57, -57, -48, -32, -19,
+    -17, -20, -23, -35, -64, -93, -106, -104, -98, -97, -105, -118, -126, -127,
+    -122, -107, -81, -50, -21, 9, 43, 74, 96, 100, 88, 56, 15, -8, -17, -2, 17,
+    38, 51, 53, 54, 38, 12, -2, -5, -6, -12, -13, -5, 15, 15, 0, -16, -22, -21,
+    -19, -11, -2, 1, 0, 2, 2, -4, -5, 0, 2, -1, -5, -9, -14, -5, 28, 63, 75, 60,
+    22, -31, -68, -71, -45, -12, 13, 18, 11, 3, -8, -14, -8, -3, -5, -2, 6, 2,
+    0, -1, -5, 5, 0, -7, -6, 2, 3, 1, 4, 6, -16, 21, 8, -5, -8, -6, -1, 6, 8, 6,
+    5, 10, 11, 2, -5, -3, 1, 2, 3, -3, -19, -31, -14, 21, 52, 67, 53, 11, -32,
+    -51, -44, -22, 1, 10, 12, 10, 1, -8, -7, -8, -12, -8, -1, -2, -1, 3, -2, 4,
+    2, -4, -7, 1, 3, -2, 4, 10, -8, 19, 8, -3, -7, -3, 5, 11, 8, -1, -1, 8, 11,
+    -2, -16, -18, -9, 4, 14, 12, -13, -41, -44, -19, 21, 63, 78, 54, 11, -29,
+    -51, -50, -34, -17, -2, 7, 4, -5, -7, -9, -13, -10, -5, -3, 0, 7, 5, 7, 5,
+    4, 0, 2, 5, -1, 5, 14, -2, 26, 12, -2, -9, -7, 0, 4, -3, -15, -14, 2, 7, -9,
+    -28, -27, -9, 15, 37, 40, 14, -26, -55, -60, -32, 25, 76, 89, 67, 19, -28,
+    -53, -53, -36, -12, 6, 10, 4, 1, -5, -7, -4, -3, -3, -4, 1, 2, 2, -2, 6, 6,
+    4, 5, -2, 3, 10, -7, 40, 19, -2, -13, -14, -8, -4, -13, -23, -17, 1, 5, -15,
+    -36, -32, -8, 22, 47, 54, 30, -19, -79, -127, -127, -62, 29, 99, 122, 93,
+    37, -11, -34, -31, -10, 10, 18, 17, 15, 6, 1, 3, -4, -11, -13, -8, -5, -3,
+    -6, 11, 17, 12, 10, 3, 0, 2, -19, -26, -5, 16, 21, 14, 0, -7, -10, -16, -10,
+    2, 3, -3, -2, -1, -4, -8, -13, -12, -3, 13, 20, 14, 4, -4, -4, 6, 11, 3, 4,
+    7, 4, -11, -18, -5, 23, 19, -15, -28, -31, -11, 15, 34, 45, 56, 68, 78, 95,
+    91, 91, 93, 72, 63, 71, 58, 26, -34, -13, 10, 22, 19, 8, 4, 7, 7, 11, 19,
+    19, 15, 13, 14, 15, 15, 11, 5, 4, 16, 23, 16, 4, -6, -2, 14, 21, 14, 12, 15,
+    16, 5, -4, 2, 25, 26, 3, -3, -9, 2, 14, 22, 29, 36, 40, 43, 52, 47, 44, 43,
+    17, 1, 11, 13, -18, -54, -30, 4, 27, 32, 24, 18, 20, 20, 19, 21, 19, 12, 6,
+    5, 9, 17, 21, 12, 3, 7, 12, 11, 7, 3, 10, 25, 30, 23, 21, 22, 22, 9, 0, 4,
+    21, 20, 5, 5, -6, -8, -7, -6, 0, -2, -11, -20, -22, -32, -41, -44, -67, -83,
+    -69, -51, -78, -89, -67, -24, 14, 30, 28, 23, 23, 18, 9, 2, -2, -7, -15,
+    -16, -8, 3, 11, 4, -11, -15, -14, -13, -9, -6, 4, 17, 13, -2, -6, -4, -2,
+    -12, -20, -17, 1, 2, -12, -10, -28, -38, -44, -45, -36, -41, -53, -65, -77,
+    -92, -103, -104, -117, -127, -115, -91, -122, -40, -58, -44, -17, -1, 3, 2,
+    7, 6, 0, -7, -11, -13, -19, -17, -8, 5, 17, 11, -5, -13, -13, -10, -5, -2,
+    4, 10, -1, -21, -24, -16, -7, -9, -13, -14, 3, 10, 0, 5, -10, -13, -9, 0,
+    25, 38, 43, 43, 30, 9, 8, 20, 6, -16, -30, -36, -91, 45, 36, 21, 3, -11,
+    -18, -25, -35, -48, -49, -30, -3, 10, 4, -11, -27, -38, -46, -57, -72, -87,
+    -93, -87, -69, -49, -37, -25, -9, 12, 36, 61, 79, 80, 71, 66, 69, 67, 53,
+    46, 48, 46, 51, 60, 44, 22, 5, -11, -16, -14, -10, -6, 7, 23, 8, -16, -17,
+    52, 42, 28, 12, 2, -1, -5, -13, -24, -29, -17, 2, 10, 3, -8, -14, -16, -17,
+    -24, -39, -56, -65, -61, -45, -27, -16, -9, 0, 13, 31, 49, 60, 58, 49, 47,
+    55, 58, 47, 38, 35, 29, 30, 36, 15, -10, -23, -27, -25, -19, -13, -6, 9, 31,
+    20, -3, -3, 47, 37, 24, 10, 3, 3, 1, -5, -13, -18, -11, 0, 4, -2, -8, -7,
+    -1, 4, 1, -14, -33, -44, -38, -21, -2, 9, 14, 17, 21, 26, 32, 33, 26, 19,
+    22, 35, 42, 32, 20, 11, 0, -3, -1, -24, -49, -53, -44, -34, -27, -19, -14,
+    0, 27, 26, 8, 10, 41, 30, 15, 3, 0, 0, 0, -3, -7, -9, -5, 1, 0, -6, -10, -8,
+    0, 9, 8, -4, -22, -30, -23, -3, 19, 35, 42, 41, 35, 26, 19, 10, -1, -7, -1,
+    14, 22, 12, -5, -22, -42, -51, -52, -74, -91, -82, -62, -47, -37, -27, -24,
+    -13, 16, 22, 12, 18, 17, 13, 1, -8, -12, -12, -12, -14, -16, -14, -8, -1,
+    -2, -6, -10, -11, -3, 8, 12, 3, -13, -20, -10, 14, 39, 57, 66, 64, 50, 30,
+    12, -2, -14, -17, -8, 7, 13, -1, -25, -49, -78, -96, -101, -119, -127, -106,
+    -79, -61, -46, -32, -29, -22, 5, 16, 13, 22, 103, 120, 126, 113, 91, 75, 68,
+    59, 47, 44, 54, 55, 34, 2, -21, -19, 1, 21, 28, 27, 32, 45, 50, 34, 9, -14,
+    -29, -35, -40, -44, -46, -52, -61, -67, -65, -62, -71, -95, -109, -94, -71,
+    -47, -34, -39, -45, -35, -42, -62, -47, -24, -6, 19, 39, 38, 36, 42, 55, 67,
+    68, 53, 32, 17, 15, 15, 10, 11, 23, 26, 11, -10, -20, -17, -6, 3, 5, 7, 16,
+    30, 35, 24, 7, -7, -14, -15, -17, -20, -19, -22, -30, -35, -34, -36, -50,
+    -77, -94, -79, -54, -27, -11, -15, -22, -10, -8, -27, -22, -10, -9, 4, 19,
+    12, 4, 9, 37, 41, 37, 23, 8, -1, 0, 3, 0, 4, 17, 22, 13, 4, 2, 3, 3, -1, -9,
+    -10, -3, 9, 13, 8, 2, 0, 3, 7, 6, 5, 10, 10, 2, -7, -11, -21, -42, -72, -89,
+    -73, -43, -11, 12, 14, 9, 25, 38, 19, 9, 4, -11, -13, -7, -23, -38, -34, 11,
+    8, -5, -22, -34, -37, -34, -31, -34, -27, -9, 4, 9, 15, 19, 16, 7, -7, -25,
+    -34, -32, -24, -17, -10, -2, 10, 24, 33, 34, 35, 38, 36, 25, 11, 0, -16,
+    -40, -69, -86, -69, -31, 8, 39, 50, 50, 69, 91, 77, 55, 32, -3, -23, -27,
+    -48, -66, -59, 28, 13, -14, -43, -66, -74, -75, -77, -83, -75, -50, -25, -8,
+    9, 18, 11, -6, -27, -54, -72, -75, -66, -47, -25, -1, 21, 40, 52, 57, 60,
+    61, 58, 45, 26, 8, -12, -36, -62, -76, -59, -13, 35, 72, 89, 88, 102, 127,
+    118, 92, 62, 13, -26, -42, -59, -73, -60, -54, -42, -23, -5, 2, -1, -17,
+    -34, -32, -12, 7, 12, 0, -22, -32, -23, -12, -9, -2, 11, 25, 38, 44, 40, 19,
+    -8, -22, -18, -9, -4, 2, 0, -4, 9, 27, 42, 48, 40, 31, 28, 12, 1, -9, -35,
+    -63, -95, -112, -105, -102, -97, -95, -111, -118, -101, -103, -127, -39,
+    -27, -8, 9, 18, 15, -1, -18, -17, 3, 24, 32, 21, -2, -17, -15, -9, -8, -4,
+    6, 16, 25, 32, 33, 18, -8, -27, -28, -20, -14, -7, -9, -11, 0, 15, 30, 38,
+    33, 28, 30, 20, 15, 16, 8, -2, -23, -38, -37, -38, -34, -29, -47, -62, -53,
+    -55, -79, -42, -28, -11, 6, 16, 13, -4, -21, -20, 1, 23, 33, 25, 4, -13,
+    -18, -18, -18, -10, 0, 7, 13, 19, 21, 7, -18, -36, -37, -27, -15, -6, -11,
+    -17, -10, 0, 13, 22, 21, 24, 30, 23, 23, 33, 38, 41, 31, 22, 18, 12, 19, 30,
+    16, -4, 1, 2, -22, -42, -29, -14, -1, 8, 3, -12, -25, -20, 2, 22, 27, 18, 4,
+    -9, -17, -22, -24, -15, -3, 3, 8, 13, 14, 0, -20, -31, -22, -2, 13, 17, 3,
+    -15, -19, -17, -11, -6, -2, 14, 23, 12, 8, 15, 16, 16, 11, 19, 26, 24, 37,
+    60, 52, 33, 40, 41, 18, -24, -11, 2, 11, 16, 10, -4, -14, -5, 22, 42, 46,
+    37, 29, 20, 11, 4, 4, 16, 31, 41, 48, 55, 55, 40, 21, 15, 28, 51, 65, 64,
+    40, 10, -4, -10, -10, -10, -3, 21, 28, 7, -6, -9, -13, -19, -20, 4, 34, 42,
+    60, 88, 84, 67, 73, 70, 45, -127, -127, -127, -127, -127, -127, -127, -127,
+    -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127,
+    -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127,
+    -127, -126, -127, -126, -127, -126, -127, -126, -127, -127, -127, -127,
+    -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127,
+    -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127,
+    -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127,
+    -127, -127, -127, -127, -127, -127, -127, -127, -126, -127, -126, -127,
+    -126, -127, -126, -127, -127, -127, -127, -127, -127, -127, -127, -127,
+    -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127,
+    -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127,
+    -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127,
+    -127, -127, -127, -127, -127, -126, -127, -126, -127, -126, -127, -126,
+    -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127,
+    -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127,
+    -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127,
+    -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127,
+    -126, -127, -126, -127, -126, -127, -126, -127, -127, -127, -127, -127,
+    -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127,
+    -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127,
+    -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127,
+    -127, -127, -127, -127, -127, -127, -127, -127, -127, -126, -127, -126,
+    -127, -126, -127, -126, -127, -127, -127, -127, -127, -127, -127, -127,
+    -127, -127, -127, -127, -127, -127, -127, -127, -36, -11, 16, 33, 35, 27,
+    14, -1, -18, -31, -35, -28, -15, -5, -3, -6, -2, 9, 20, 24, 19, 10, 0, -2,
+    3, 9, 16, 26, 34, 35, 35, 38, 40, 38, 31, 19, 4, -7, -22, -27, -26, -23, -9,
+    1, 4, 2, -1, -1, -2, -8, -7, 5, 16, 2, 0, 14, -23, -2, 19, 32, 32, 24, 13,
+    0, -12, -20, -22, -15, -5, 0, -2, -8, -9, -4, 2, 5, 2, -5, -14, -19, -19,
+    -17, -14, -8, -2, 2, 6, 13, 20, 24, 27, 25, 16, 10, -1, -6, -8, -5, 9, 16,
+    15, 13, 8, 5, 0, -12, -14, -1, 15, 8, 7, 27, -8, 6, 19, 26, 23, 15, 5, -5,
+    -10, -11, -6, 3, 10, 9, 3, -6, -13, -16, -14, -11, -10, -15, -25, -36, -44,
+    -50, -53, -52, -49, -46, -42, -35, -26, -15, 1, 15, 20, 22, 17, 12, 3, -1,
+    8, 9, 4, 4, 2, -1, 0, -11, -17, -6, 10, 7, 10, 36, 8, 19, 24, 23, 15, 6, -3,
+    -10, -11, -6, 4, 17, 24, 20, 10, -5, -19, -28, -29, -24, -20, -24, -37, -55,
+    -71, -83, -90, -93, -93, -91, -89, -87, -79, -63, -35, -1, 26, 42, 45, 36,
+    16, 3, 3, -4, -15, -13, -10, -8, 0, -5, -11, -5, 5, 4, 12, 42, 11, 21, 24,
+    18, 7, -6, -18, -27, -26, -18, -5, 10, 20, 19, 8, -11, -32, -47, -50, -42,
+    -35, -39, -55, -77, -99, -115, -124, -127, -126, -124, -124, -123, -118,
+    -99, -59, -5, 44, 75, 85, 71, 39, 16, 9, -3, -17, -15, -11, -8, 5, 5, -4,
+    -4, 0, 0, 13, 45, 33, 16, 2, -2, -1, 0, 7, 14, 5, -4, -1, 6, 16, 18, 3, -12,
+    -16, -6, 9, 14, 2, -26, -60, -73, -55, -11, 40, 74, 82, 64, 29, -9, -29,
+    -25, -7, 1, 0, 3, -4, -9, -5, -5, 1, 18, 19, 7, -3, -8, -5, -8, -27, -31,
+    -14, -19, -11, 54, 23, 10, 0, -3, -5, -6, 2, 11, 4, -2, 0, 3, 8, 9, -3, -13,
+    -14, -1, 14, 18, 6, -23, -58, -72, -56, -14, 33, 60, 59, 37, 0, -35, -48,
+    -36, -10, 4, 6, 8, 1, -2, 3, 0, -2, 5, 6, 0, -2, -4, 2, 7, -2, -4, 6, -6,
+    -4, 45, 11, 4, 2, 1, -4, -6, 2, 10, 4, -2, 0, 3, 9, 10, -3, -16, -17, 0, 19,
+    20, 1, -35, -73, -86, -64, -17, 32, 57, 50, 21, -22, -56, -63, -43, -9, 14,
+    19, 19, 10, 5, 4, -3, -8, -5, -5, -7, -2, 0, 4, 11, 8, 7, 13, 2, 2, 33, -6,
+    -8, -5, -4, -9, -10, 2, 13, 6, -3, -3, -1, 8, 14, 4, -12, -17, 3, 27, 26,
+    -5, -55, -100, -108, -73, -8, 52, 78, 64, 24, -26, -61, -65, -39, 1, 29, 34,
+    31, 20, 9, 0, -12, -15, -8, -7, -7, -1, 3, 2, 5, 2, 0, 7, 6, 7, 25, -12,
+    -14, -9, -7, -12, -7, 11, 27, 21, 11, 9, 12, 20, 23, 4, -23, -31, -5, 28,
+    27, -17, -80, -127, -124, -67, 21, 96, 123, 96, 41, -18, -55, -56, -30, 10,
+    40, 44, 39, 29, 16, 3, -13, -16, -6, -4, -4, 2, 4, 0, -5, -11, -14, -3, 6,
+    12, 24, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127,
+    -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127,
+    -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127,
+    -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127,
+    -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127,
+    -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127,
+    -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127,
+    -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127,
+    -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127,
+    -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127,
+    -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127,
+    -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127,
+    -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127,
+    -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127,
+    -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127,
+    -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127,
+    -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127,
+    -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127,
+    -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127,
+    -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127,
+    -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127,
+    -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127,
+    -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127,
+    -127, -127, -127, -127, -127, -20, -12, -6, -6, -6, 1, 16, 29, 38, 42, 38,
+    27, 11, -3, -23, -53, -80, -96, -107, -118, -127, -124, -111, -93, -75, -62,
+    -53, -41, -26, -9, 11, 28, 44, 54, 60, 66, 58, 26, -25, -56, -65, -67, -47,
+    -23, -11, 18, 56, 64, 34, 6, 5, 21, 24, 26, 36, 58, -13, -9, -7, -10, -13,
+    -9, 4, 18, 31, 43, 47, 45, 38, 31, 20, 0, -19, -31, -43, -60, -79, -86, -80,
+    -70, -62, -58, -54, -47, -36, -23, -9, 5, 21, 37, 55, 73, 79, 59, 15, -17,
+    -23, -24, -13, -4, -3, 15, 41, 48, 29, 9, 6, 19, 19, 16, 18, 38, -8, -8,
+    -12, -19, -24, -24, -14, -1, 14, 29, 40, 43, 45, 48, 49, 45, 38, 33, 25, 7,
+    -17, -33, -35, -32, -32, -35, -40, -42, -40, -37, -35, -32, -23, -6, 20, 50,
+    71, 67, 33, 3, -1, -2, 2, 1, -11, -5, 8, 16, 17, 8, -1, 5, 3, -5, -9, 10,
+    -1, -2, -10, -21, -29, -33, -30, -22, -12, 0, 13, 26, 38, 48, 58, 65, 69,
+    73, 75, 64, 38, 14, 4, 2, 1, -6, -15, -24, -33, -44, -58, -74, -78, -64,
+    -33, 6, 40, 51, 29, 8, 8, 8, 11, 6, -11, -13, -12, -4, 11, 9, -11, -15, -19,
+    -27, -31, -14, 2, -1, -9, -21, -32, -40, -45, -45, -43, -36, -23, -3, 17,
+    34, 50, 62, 72, 84, 98, 98, 75, 43, 23, 16, 13, 9, 5, -1, -15, -40, -71,
+    -101, -115, -105, -73, -28, 13, 32, 20, 6, 14, 21, 29, 28, 10, 5, -1, 3, 22,
+    20, -12, -26, -30, -36, -38, -24, -82, -66, -47, -30, -9, 9, 19, 19, 17, 14,
+    7, -1, 0, 16, 35, 40, 27, 8, -10, -22, -25, -26, -38, -56, -78, -101, -119,
+    -127, -125, -114, -97, -74, -50, -32, -25, -22, -12, 4, 17, 15, 2, -18, -31,
+    -32, -22, -12, -7, -8, -6, -1, 9, 29, 38, 27, 14, 0, -49, -29, -8, 10, 25,
+    37, 40, 34, 30, 26, 17, 6, 2, 12, 30, 37, 31, 20, 8, -3, -7, -10, -19, -33,
+    -52, -74, -92, -103, -104, -98, -86, -68, -49, -35, -30, -25, -14, 6, 24,
+    29, 19, -1, -16, -19, -14, -7, 2, 3, -1, 2, 10, 25, 31, 25, 19, 13, -22, 0,
+    23, 41, 54, 60, 54, 42, 34, 30, 21, 9, 1, 6, 21, 28, 26, 24, 20, 11, 3, -4,
+    -15, -26, -39, -54, -68, -79, -84, -86, -82, -70, -55, -45, -41, -38, -28,
+    -8, 14, 25, 21, 3, -13, -19, -19, -14, -2, 3, -4, -2, 4, 12, 12, 9, 11, 15,
+    -11, 8, 26, 42, 55, 58, 49, 36, 31, 32, 26, 13, 0, -4, 4, 10, 14, 21, 26,
+    21, 14, 7, 0, -4, -9, -17, -29, -43, -59, -73, -80, -78, -71, -64, -59, -52,
+    -40, -19, 8, 27, 28, 12, -3, -7, -11, -10, 1, 4, -9, -13, -10, -7, -14, -15,
+    -5, 9, 11, 12, 11, 14, 20, 19, 8, -2, 2, 12, 12, -1, -18, -26, -22, -10, 4,
+    21, 37, 42, 43, 45, 49, 55, 57, 49, 34, 10, -22, -54, -76, -87, -88, -83,
+    -72, -57, -36, -6, 34, 62, 69, 58, 47, 45, 37, 28, 28, 21, -2, -9, -9, -11,
+    -27, -31, -16, 5, -23, -39, -56, -62, -54, -41, -33, -31, -30, -26, -18,
+    -11, -9, -6, 0, 1, -4, -10, -11, -4, 9, 15, 11, 5, 9, 19, 19, 7, -4, -10,
+    -13, -10, 0, 13, 24, 31, 41, 52, 53, 51, 40, 31, 20, -4, -30, -43, -42, -39,
+    -29, -15, -2, -2, -9, -3, -12, -42, -20, -33, -46, -48, -35, -17, -9, -9,
+    -10, -7, -2, 1, 0, 0, 3, 3, 0, -3, -3, 2, 9, 15, 11, 7, 10, 20, 23, 15, 9,
+    4, -5, -6, 3, 19, 31, 36, 39, 40, 34, 30, 18, 9, 0, -14, -27, -32, -30, -24,
+    -14, -5, 9, 15, 13, 17, 10, -13, -9, -21, -31, -29, -12, 8, 15, 15, 14, 15,
+    17, 15, 10, 6, 6, 6, 7, 8, 8, 4, 3, 7, 6, 2, 5, 13, 17, 16, 16, 11, 0, -3,
+    10, 29, 43, 44, 33, 14, -8, -15, -21, -26, -31, -34, -28, -20, -15, -7, 1,
+    2, 11, 22, 24, 29, 26, 12, 1, -11, -21, -17, 2, 24, 32, 30, 29, 31, 31, 25,
+    16, 10, 8, 9, 15, 20, 16, 3, -6, -4, -1, 0, 4, 12, 17, 21, 25, 21, 8, 8, 26,
+    49, 64, 60, 34, -10, -56, -74, -75, -70, -68, -58, -34, -12, -5, 2, 8, 3, 7,
+    19, 24, 29, 30, 23, -9, -22, -32, -29, -8, 15, 24, 22, 21, 25, 26, 20, 11,
+    4, 3, 9, 21, 30, 23, 4, -12, -12, -7, -1, 8, 19, 30, 39, 44, 37, 23, 24, 47,
+    76, 95, 86, 45, -22, -92, -124, -127, -121, -114, -94, -58, -25, -15, -11,
+    -1, -5, -3, 11, 15, 18, 23, 21, -61, -24, 22, 56, 60, 46, 36, 38, 33, 28,
+    22, 9, -6, -22, -42, -47, -30, -8, 3, -2, -4, -2, -1, 5, 5, -14, -44, -67,
+    -78, -69, -50, -41, -39, -32, -15, -1, -2, -7, 6, 18, 28, 40, 36, 24, 13,
+    -8, 6, 18, -4, -13, 8, 25, 30, 40, 46, 42, -61, -26, 17, 46, 44, 24, 9, 7,
+    4, 4, 9, 6, -2, -17, -33, -32, -13, 6, 12, 6, 6, 10, 11, 15, 19, 9, -10,
+    -25, -37, -37, -30, -25, -17, -5, 10, 17, 15, 10, 20, 31, 40, 48, 37, 27,
+    21, -1, 8, 19, 7, 0, 11, 22, 23, 30, 41, 40, -55, -20, 20, 45, 37, 13, -6,
+    -13, -19, -14, -1, 7, 5, -7, -19, -11, 10, 23, 21, 9, 5, 7, 8, 13, 19, 18,
+    12, 8, 5, 1, -3, -5, 6, 20, 29, 27, 17, 4, 6, 11, 20, 27, 19, 13, 11, -9,
+    -8, 0, 0, -2, 3, 12, 10, 10, 27, 28, -49, -13, 27, 49, 38, 9, -13, -25, -34,
+    -28, -8, 4, 4, -8, -16, -4, 17, 25, 11, -15, -31, -32, -21, -1, 18, 31, 36,
+    38, 38, 34, 19, 6, 11, 23, 25, 20, 5, -13, -14, -14, -6, -1, -3, -1, -5,
+    -31, -40, -38, -30, -22, -17, -8, -12, -10, 14, 18, -5, 20, 49, 62, 43, 4,
+    -30, -53, -72, -70, -48, -31, -27, -36, -42, -25, 0, 7, -16, -54, -78, -69,
+    -26, 34, 86, 117, 127, 123, 110, 89, 57, 28, 20, 25, 24, 19, 10, -1, 5, 4,
+    6, 3, 2, 10, 6, -22, -39, -46, -36, -21, -11, 0, -6, -2, 29, 34, -32, -28,
+    -27, -29, -35, -41, -31, 10, 58, 62, 15, -36, -47, -14, 32, 53, 38, 7, -10,
+    -4, 10, 12, 6, -3, -11, -14, -12, -10, -13, -13, -11, -22, -35, -31, -19, 3,
+    22, 25, 22, 20, 20, 16, 9, -2, 1, 2, 1, 2, -19, -27, 0, 8, -6, 8, 2, -74,
+    -38, -34, -34, -35, -38, -41, -28, 11, 57, 59, 9, -44, -50, -10, 40, 58, 33,
+    -8, -30, -21, 2, 15, 14, 6, -2, -6, -5, -2, -2, -2, 0, -10, -19, -9, 1, 15,
+    28, 29, 19, 11, 9, 10, 9, 1, 0, 2, 5, 11, -2, -10, 9, 12, -4, 7, 3, -69,
+    -39, -38, -39, -39, -37, -33, -13, 27, 68, 62, 1, -60, -65, -13, 48, 70, 36,
+    -23, -63, -54, -16, 15, 26, 21, 9, -3, -12, -15, -11, -5, -1, -8, -16, -4,
+    7, 16, 25, 24, 17, 8, 1, 3, 11, 4, -3, -3, 0, 5, -2, -4, 12, 9, -12, -1, -3,
+    -72, -25, -30, -32, -31, -23, -11, 16, 59, 96, 79, 5, -68, -76, -14, 65, 99,
+    64, -16, -81, -84, -36, 14, 38, 36, 20, -2, -22, -31, -24, -11, -3, -7, -11,
+    6, 18, 28, 34, 26, 16, 7, -6, -7, 4, 5, -1, 1, 0, -7, -12, -4, 14, 5, -19,
+    -10, -14, -85, -2, -14, -23, -23, -12, 6, 37, 83, 120, 99, 10, -77, -91,
+    -21, 76, 127, 95, 3, -85, -103, -54, 4, 31, 28, 9, -15, -39, -50, -39, -20,
+    -8, -14, -15, 6, 23, 36, 44, 32, 16, 3, -13, -16, -1, 10, 15, 18, 14, -4,
+    -12, 5, 29, 17, -13, -12, -24, -100, 74, 65, 51, 32, 15, 0, -4, 5, 21, 31,
+    27, 15, 2, -4, -5, -2, 14, 40, 60, 65, 48, 21, -1, -20, -38, -49, -45, -36,
+    -39, -46, -44, -35, -26, -24, -28, -35, -40, -38, -27, -18, -5, 2, 5, 13,
+    38, 57, 67, 59, 35, 42, 44, 24, -6, -22, -24, -35, 25, 24, 23, 14, 4, -7,
+    -16, -15, -8, -7, -12, -17, -15, -8, -4, -8, -8, 2, 16, 26, 20, 4, -7, -11,
+    -16, -20, -15, -5, -2, -1, 6, 10, 7, -3, -14, -20, -21, -14, 7, 20, 31, 33,
+    37, 40, 54, 66, 64, 56, 39, 47, 51, 43, 24, 12, 7, -1, -26, -20, -9, -3, -1,
+    -4, -12, -16, -16, -20, -26, -26, -16, -2, 1, -11, -24, -26, -18, -7, -7,
+    -13, -14, -7, -1, -1, 2, 7, 9, 15, 26, 29, 19, 1, -9, -10, -8, 1, 21, 29,
+    35, 34, 37, 34, 34, 41, 31, 29, 23, 31, 34, 36, 33, 28, 21, 13, -57, -48,
+    -34, -20, -7, 0, -2, -4, -4, -8, -15, -15, -4, 10, 9, -12, -33, -41, -38,
+    -29, -23, -19, -12, -1, 7, 6, 1, -1, -3, 3, 17, 23, 16, 3, 0, 2, 7, 11, 22,
+    18, 13, 6, 4, -14, -34, -30, -40, -34, -28, -21, -23, -13, -2, 3, -3, -10,
+    -52, -53, -47, -37, -22, -10, -4, 2, 7, 6, -1, -3, 8, 24, 25, 6, -16, -31,
+    -34, -27, -14, 5, 25, 42, 49, 38, 21, 7, -4, -1, 15, 30, 33, 30, 34, 40, 41,
+    33, 28, 11, -5, -24, -37, -74, -117, -122, -127, -110, -92, -88, -96, -83,
+    -64, -50, -50, -54, 59, 42, 19, -2, -15, -18, -18, -19, -21, -15, -3, 7, 11,
+    5, -20, -59, -84, -70, -23, 35, 71, 73, 51, 25, 10, 7, 9, 16, 25, 27, 20, 5,
+    -5, -8, -11, -12, -3, 7, 16, 15, 4, 6, 8, -1, -10, -21, -25, -13, -15, -23,
+    -22, -8, -3, -3, 19, 64, 49, 32, 11, -7, -16, -15, -11, -11, -12, -9, 1, 9,
+    13, 10, -12, -52, -79, -72, -31, 23, 57, 58, 37, 10, -5, -8, -5, 2, 12, 18,
+    14, 1, -12, -16, -20, -20, -12, -5, -1, -2, -13, -10, -4, -6, -9, -12, -11,
+    1, -4, -13, -14, -5, -4, -8, 10, 50, 51, 33, 12, -4, -9, -3, 4, 3, -1, -2,
+    2, 5, 8, 9, -10, -50, -83, -84, -49, 2, 38, 46, 31, 10, -3, -7, -6, -2, 8,
+    16, 17, 3, -14, -23, -27, -26, -18, -15, -13, -15, -23, -18, -8, -1, 4, 4,
+    7, 19, 9, -5, -8, -3, -2, -5, 9, 42, 61, 42, 18, 2, -3, 3, 12, 11, 4, 1, 0,
+    -1, 3, 8, -11, -55, -95, -105, -76, -24, 21, 42, 43, 35, 27, 23, 20, 18, 23,
+    29, 28, 11, -13, -29, -36, -33, -26, -24, -23, -22, -27, -18, -4, 10, 19,
+    20, 22, 35, 19, -2, -11, -10, -5, -2, 14, 42, 52, 34, 9, -9, -14, -11, -3,
+    -4, -10, -14, -16, -17, -11, -3, -20, -68, -114, -127, -98, -40, 17, 55, 71,
+    72, 68, 64, 59, 54, 53, 53, 44, 18, -15, -42, -54, -54, -48, -47, -46, -41,
+    -38, -23, -4, 13, 22, 19, 20, 36, 17, -12, -28, -32, -23, -4, 19, 45, -11,
+    -8, -6, -5, -6, -5, -2, -6, -11, -13, -9, -1, 7, 13, 10, 0, -14, -27, -24,
+    -3, 21, 32, 15, -18, -49, -69, -69, -40, 11, 50, 61, 57, 41, 16, -3, -13,
+    -13, -10, -17, -15, -4, 1, 3, -4, -5, 5, -3, -9, -4, -1, -3, -3, -5, -10,
+    -8, -13, 4, 11, 17, 18, 19, 22, 23, 13, 1, -5, -3, 2, 6, 9, 8, 6, -1, -12,
+    -11, 2, 19, 30, 24, 3, -24, -54, -75, -66, -26, 12, 29, 37, 35, 19, 5, -3,
+    -5, -5, -10, -7, 2, 6, 10, 5, -1, 4, -3, -9, -9, -7, -3, -1, -3, -5, 1, 2,
+    3, 9, 16, 17, 18, 22, 25, 18, 5, -2, 0, 5, 5, 4, 6, 15, 17, 6, 1, 4, 11, 20,
+    26, 26, 15, -19, -64, -85, -68, -37, -15, 7, 24, 22, 14, 6, -1, -3, -6, 0,
+    7, 7, 12, 9, 3, 3, -4, -8, -9, -11, -6, -1, 0, 2, 9, 11, -9, -5, -1, 1, 4,
+    11, 17, 14, 5, 0, 3, 7, 2, -6, -3, 12, 20, 13, 3, -5, -10, -5, 15, 48, 70,
+    49, -8, -61, -80, -70, -53, -23, 8, 18, 17, 11, 4, -1, -3, 3, 8, 4, 10, 9,
+    5, 5, -1, -2, 0, -6, -6, -2, 0, 7, 13, 9, -27, -29, -29, -28, -24, -16, -6,
+    -3, -5, -5, -1, -2, -15, -28, -25, -7, 5, -2, -13, -28, -45, -48, -19, 46,
+    113, 127, 81, 13, -42, -67, -68, -41, -4, 15, 20, 19, 14, 7, -1, -3, -3, -9,
+    1, 5, 4, 5, -3, -2, 6, 5, 0, -1, -1, 7, 10, -2, -22, -11, 5, 23, 34, 27, 3,
+    -20, -19, -9, -7, -18, -29, -31, -23, -9, 6, 7, -3, -16, -32, -48, -66, -82,
+    -82, -57, -7, 57, 111, 127, 114, 85, 58, 48, 44, 35, 19, -3, -21, -17, -18,
+    -19, -16, -25, -26, -15, -2, -14, -15, 11, 18, 4, -5, 10, 34, 13, -15, -4,
+    15, 37, 54, 52, 32, 12, 13, 21, 18, 0, -18, -24, -18, 2, 24, 29, 20, 6, -7,
+    -19, -32, -49, -55, -37, 2, 50, 83, 83, 60, 29, 5, 0, 1, -2, -9, -21, -31,
+    -23, -22, -21, -16, -27, -30, -20, -9, -14, -11, 10, 15, 3, -2, 14, 26, 0,
+    -36, -26, -10, 12, 35, 44, 32, 16, 21, 31, 26, 5, -16, -25, -18, 5, 32, 39,
+    25, 7, -6, -10, -11, -21, -26, -13, 14, 42, 51, 32, -1, -31, -45, -42, -38,
+    -36, -38, -43, -47, -36, -30, -23, -18, -30, -31, -18, -6, -3, 2, 16, 18, 9,
+    10, 23, 24, -5, -67, -61, -51, -32, -4, 14, 8, -2, 9, 26, 27, 11, -5, -8, 2,
+    24, 51, 54, 33, 7, -9, -5, 7, 12, 13, 22, 39, 52, 43, 8, -34, -63, -68, -58,
+    -49, -44, -42, -42, -39, -26, -16, -4, -2, -19, -20, -6, 6, 14, 22, 31, 35,
+    28, 29, 39, 35, 6, -116, -114, -107, -88, -54, -27, -23, -26, -7, 20, 31,
+    25, 18, 23, 40, 66, 91, 89, 61, 27, 8, 14, 33, 44, 49, 58, 73, 85, 72, 29,
+    -20, -51, -54, -41, -29, -20, -16, -16, -11, 2, 15, 27, 27, 5, -4, 8, 15,
+    26, 37, 46, 53, 48, 51, 60, 56, 30, -14, -7, -2, 3, 7, 10, 8, 3, 2, 4, 3, 1,
+    0, 0, -1, -2, -2, 1, 0, -2, -2, -2, -3, -1, 1, 2, 1, 1, 0, 0, -1, -4, -5,
+    -2, -1, 2, -1, -3, -3, -8, -7, -7, -4, -4, 2, 5, 4, 4, 0, 0, 4, 4, -1, -2,
+    10, 6, -8, -5, -5, -4, 0, 2, 3, 2, 1, 3, 2, 1, 1, 3, 2, 0, 0, 2, 2, 2, 3, 1,
+    0, -1, 1, 1, 0, 1, 0, 1, 1, 1, 3, 6, 5, 5, 3, 2, 2, 1, 3, 2, 3, 1, 0, -1, 0,
+    4, -2, -4, -2, 0, 0, 1, 6, 1, -6, -2, -6, -9, -9, -8, -4, -1, 1, 2, 1, 1, 2,
+    4, 2, -2, -2, -1, -1, 1, 3, 2, -1, -3, -2, -2, -3, -2, -3, -3, 0, 0, 2, 5,
+    2, 0, 0, 0, -3, -3, -1, -2, -1, -3, -4, -6, -6, -3, -7, -6, -5, -5, -4, -1,
+    -2, -7, -3, 13, 14, 4, -6, -14, -13, -9, -5, -5, -3, -1, -2, -1, -1, -4, -6,
+    -5, -3, 2, 5, 6, 4, 2, 4, 5, 3, 5, 6, 5, 5, 3, 1, 3, 3, 2, 3, 7, 5, 5, 6, 5,
+    9, 11, 13, 14, 12, 12, 13, 16, 20, 17, 13, 11, 5, 1, -127, -49, 6, 28, 33,
+    25, 22, 20, 18, 12, 10, 11, 7, 7, 7, 4, 1, 3, 3, 5, 5, 3, 1, -1, 0, -1, -4,
+    1, 1, 1, 3, -1, -5, -2, 0, 0, -1, -2, -7, -7, -8, -10, -9, -7, -4, -6, -13,
+    -16, -14, -13, -13, -15, -16, -11, -9, -2, -31, -17, 5, 19, 21, 11, -2, -5,
+    -8, -9, 2, 17, 17, -9, -40, -51, -24, 24, 43, 16, -25, -50, -44, -12, 13,
+    20, 24, 27, 24, 8, -17, -30, -24, -10, 1, 1, 0, -5, -11, -3, 5, 4, 4, 9, 9,
+    1, -13, -10, 10, 5, -18, -24, -15, -16, -23, 32, -33, -15, 10, 26, 26, 12,
+    -4, -7, -6, -4, 4, 16, 13, -11, -34, -36, -8, 30, 39, 9, -26, -43, -36, -6,
+    19, 28, 30, 29, 18, -1, -21, -27, -18, -4, 5, 5, 7, 6, 0, 9, 15, 7, 2, 4, 0,
+    -7, -12, -10, 4, 4, -14, -12, 3, -1, -7, 43, -41, -17, 14, 34, 33, 18, 0,
+    -5, -3, -1, 8, 21, 18, -8, -30, -27, 4, 38, 37, -1, -38, -50, -35, -2, 26,
+    37, 38, 30, 13, -8, -22, -22, -13, -4, 1, -2, 2, 6, 1, 8, 13, 4, -2, 2, -4,
+    -10, -9, -8, -2, 2, -10, -4, 13, 11, 8, 53, -54, -27, 10, 34, 36, 21, 4, -2,
+    -1, 1, 11, 22, 12, -22, -45, -32, 8, 44, 35, -16, -58, -56, -19, 30, 59, 61,
+    43, 16, -11, -28, -29, -14, -2, 6, 7, 2, 3, 6, -1, -3, -3, -9, -6, 5, 2, -5,
+    -2, -1, -3, -2, -10, -2, 16, 15, 18, 64, -55, -23, 17, 43, 43, 26, 7, -2,
+    -4, -3, 8, 19, 3, -41, -71, -53, 4, 53, 44, -19, -67, -49, 22, 96, 127, 106,
+    47, -25, -78, -93, -74, -38, -12, 0, 4, 0, -1, -1, -10, -16, -20, -23, -12,
+    6, 5, 2, 8, 7, -4, -11, -20, -12, 4, 6, 20, 69, 12, 8, 2, 3, 3, 2, 0, 3, 4,
+    -1, -1, 2, 3, 7, 11, 11, 13, 12, 8, 10, 9, 6, 1, -4, -7, -6, -8, -14, -12,
+    -5, 5, 16, 17, 19, 23, 23, 19, 20, 18, 13, 6, -2, -1, -4, -7, -7, -7, -13,
+    -9, 1, -9, -8, 4, 1, 1, -6, 16, 9, 0, -2, -2, -5, -6, -2, 2, -1, -1, 1, 1,
+    3, 5, 4, 4, 2, -2, 0, -1, -2, -4, -5, -6, -3, -1, -5, -7, -6, -1, 5, -3, -7,
+    -4, -2, -1, 2, 1, 2, 4, 0, 4, 0, -2, -3, -6, -14, -12, -3, -10, -10, -3, -7,
+    -7, -12, 34, 24, 11, 2, -4, -11, -15, -11, -6, -3, -2, 0, 0, 3, 6, 5, 5, 4,
+    0, 0, -2, -2, -2, -5, -8, -6, -1, -3, -7, -10, -6, 0, -11, -20, -17, -11,
+    -6, 1, 4, 11, 14, 8, 12, 6, 5, 3, 5, 2, 4, 6, 5, 7, 4, -2, -1, -8, 54, 54,
+    45, 34, 23, 9, -1, -3, 2, 8, 13, 16, 12, 10, 12, 14, 18, 18, 16, 19, 21, 22,
+    23, 22, 22, 24, 26, 25, 21, 15, 16, 23, 16, 8, 14, 20, 22, 26, 27, 33, 35,
+    23, 32, 29, 30, 30, 36, 35, 34, 29, 30, 35, 23, 14, 14, 9, -127, -71, -29,
+    -7, 2, -5, -12, -16, -15, -14, -12, -11, -21, -33, -36, -30, -22, -22, -24,
+    -22, -24, -27, -28, -23, -16, -9, -7, -7, -9, -16, -17, -12, -16, -24, -24,
+    -24, -32, -42, -52, -45, -37, -43, -25, -24, -26, -30, -19, -14, -10, -20,
+    -22, -17, -30, -25, 0, 4, 4, -7, -17, -20, -15, -2, 12, 20, 17, 13, 15, 18,
+    18, 16, 11, -2, -18, -25, -20, -7, 5, 12, 13, 8, 4, 2, -3, -11, -15, -16,
+    -16, -14, -8, -2, 7, 13, 12, 8, 9, 11, 8, 7, -5, -18, -24, -18, -10, -5, -1,
+    7, 12, 3, 2, 9, 8, 13, -9, -20, -30, -32, -25, -8, 11, 22, 21, 18, 17, 13,
+    4, -4, -12, -22, -30, -26, -13, -1, 6, 9, 8, 3, 0, 1, 2, 1, 0, 1, 0, 0, 2,
+    5, 12, 16, 14, 10, 8, 7, 5, 7, 1, -9, -12, -4, 4, 2, -1, 4, 10, 3, -1, 0,
+    -3, -1, -17, -30, -39, -38, -27, -3, 21, 35, 36, 30, 23, 8, -14, -34, -46,
+    -49, -40, -18, 5, 16, 14, 9, 4, -2, -4, 0, 5, 7, 9, 9, 6, 3, 3, 6, 13, 17,
+    15, 10, 5, 1, 0, 7, 7, 4, 2, 9, 13, 8, 0, 2, 5, -2, -7, -8, -13, -17, -17,
+    -33, -43, -39, -19, 13, 43, 59, 58, 47, 30, 1, -36, -70, -85, -78, -48, -4,
+    34, 46, 37, 23, 10, 0, -5, -3, 2, 5, 5, 3, 1, 0, 0, 5, 11, 10, 7, 1, -11,
+    -20, -19, -8, -1, 3, 8, 15, 15, 7, 1, 4, 3, -6, -12, -15, -22, -31, 13, -16,
+    -36, -34, -10, 33, 73, 94, 92, 72, 40, -4, -59, -106, -127, -113, -66, -1,
+    52, 70, 60, 37, 15, -2, -11, -13, -8, -3, -1, -3, -5, -4, 0, 8, 11, 5, -3,
+    -11, -28, -41, -39, -23, -10, 1, 16, 27, 28, 22, 21, 28, 26, 11, -2, -12,
+    -26, -41, 3, 5, 3, -1, -5, -7, -6, -2, 1, 2, 2, 0, -1, -2, -5, -3, 5, 6, -1,
+    -4, -3, -2, -4, -7, -6, -1, 4, 6, 8, 7, 8, 9, 10, 8, 5, 3, 6, 10, 14, 17,
+    21, 24, 27, 28, 22, 8, -12, -34, -58, -79, -95, -114, -127, -115, -103,
+    -105, 1, 4, 4, 1, -1, -3, -4, -2, 0, 0, 1, 1, 2, 1, -2, -2, 3, 4, 1, 2, 3,
+    2, -1, -3, -1, 3, 5, 5, 5, 4, 3, 4, 6, 5, 2, 1, 3, 6, 10, 13, 18, 22, 24,
+    25, 23, 15, 0, -19, -41, -57, -66, -78, -86, -80, -75, -77, 1, 3, 3, 3, 1,
+    -1, -3, -1, 1, 0, -2, -3, 1, 3, -1, -3, 0, 2, 1, 2, 2, -1, -3, -3, 0, 3, 2,
+    1, 0, -2, -4, -4, -2, -2, -5, -7, -6, -3, 1, 5, 11, 14, 15, 16, 15, 13, 5,
+    -10, -25, -35, -37, -39, -42, -40, -39, -42, 1, 0, -1, 0, 1, -1, -3, -2, 0,
+    2, -1, -3, 0, 3, -1, -5, -2, 1, 0, 1, -1, -3, -3, -1, 3, 5, 4, 3, 3, 0, -4,
+    -5, -2, -2, -5, -8, -8, -6, -1, 4, 8, 10, 10, 9, 8, 7, 2, -7, -17, -21, -16,
+    -10, -8, -7, -9, -12, 6, 3, 0, 1, 2, 2, 1, 2, 3, 5, 3, -1, 2, 4, 0, -4, -2,
+    -1, -1, 0, 0, 0, 2, 3, 6, 7, 5, 5, 5, 2, -1, 0, 4, 5, 1, -2, -2, 1, 6, 10,
+    12, 12, 9, 5, 0, -3, -9, -16, -21, -20, -10, 0, 6, 7, 5, 3, -127, -100, -60,
+    -17, 18, 32, 30, 22, 13, 1, -10, -10, -2, 6, 14, 22, 31, 39, 37, 19, -4,
+    -14, -7, 7, 11, 6, 2, -1, -4, -4, 0, 2, -1, -2, 0, 3, 8, 9, -3, -12, -5, -2,
+    -4, -8, -7, 1, 11, 7, -2, 0, 0, -1, -2, -11, -5, 10, -93, -67, -28, 15, 48,
+    63, 62, 54, 43, 29, 17, 11, 13, 15, 17, 21, 26, 30, 25, 8, -13, -20, -10, 8,
+    16, 14, 10, 6, 2, 0, 0, -1, -3, -3, 0, 4, 11, 14, 5, -2, 3, 5, 0, -3, -2, 3,
+    6, 1, -7, -5, -3, -2, -3, -3, 5, 10, -79, -53, -13, 30, 63, 80, 78, 67, 52,
+    37, 21, 14, 15, 15, 12, 8, 4, 0, -7, -21, -37, -40, -24, -1, 14, 15, 12, 8,
+    5, 2, 0, -3, -4, -3, -3, -1, 8, 13, 7, 0, 4, 5, 2, 1, 2, 5, 4, -1, -11, -10,
+    -3, 1, -2, 2, 8, 6, -92, -64, -24, 19, 54, 72, 72, 59, 44, 27, 13, 6, 8, 8,
+    1, -9, -22, -33, -43, -56, -68, -66, -44, -15, 6, 12, 8, 4, 2, 0, -4, -6,
+    -5, -4, -6, -7, 3, 10, 8, 2, 4, 5, 3, 2, 6, 7, 4, -1, -10, -10, 0, 7, 1, 1,
+    2, -4, -98, -70, -29, 14, 50, 69, 68, 54, 39, 24, 10, 5, 6, 3, -10, -27,
+    -47, -64, -76, -87, -97, -92, -68, -35, -10, -1, -3, -8, -11, -12, -14, -13,
+    -9, -5, -5, -3, 7, 15, 15, 11, 11, 12, 10, 9, 12, 10, 4, -1, -9, -12, 0, 8,
+    -1, -5, -6, -11, -6, -10, -12, -13, -14, -14, -17, -18, -14, -6, 2, 5, 0,
+    -3, 3, 13, 15, 13, 18, 26, 29, 20, 3, -14, -25, -27, -24, -24, -27, -28,
+    -28, -27, -25, -15, 10, 37, 56, 75, 109, 127, 101, 59, 23, -9, -46, -79,
+    -94, -91, -61, -40, -28, 0, 26, 18, 11, 43, 0, -4, -7, -9, -10, -9, -10,
+    -10, -6, 0, 4, 4, -2, -7, -3, 5, 8, 9, 16, 23, 21, 12, -1, -11, -18, -18,
+    -15, -18, -21, -20, -20, -19, -19, -15, -3, 13, 25, 35, 63, 85, 73, 49, 29,
+    12, -6, -29, -45, -54, -43, -35, -27, -10, 6, -5, -8, 28, 5, 0, -3, -6, -7,
+    -5, -4, -4, -3, -2, -3, -8, -15, -22, -20, -12, -6, 2, 17, 24, 18, 4, -6,
+    -9, -9, -7, -6, -11, -13, -10, -8, -8, -11, -16, -17, -12, -9, -7, 13, 43,
+    49, 46, 40, 34, 34, 22, 10, -9, -20, -28, -27, -16, -10, -23, -21, 22, 9, 4,
+    -1, -3, -4, -1, 2, 2, 1, 0, -3, -9, -16, -22, -23, -17, -9, 6, 27, 36, 26,
+    9, 0, 4, 11, 14, 11, 3, -2, 0, 0, -4, -12, -26, -39, -46, -53, -59, -41, -3,
+    20, 38, 46, 50, 61, 61, 55, 33, 0, -26, -35, -29, -23, -33, -24, 26, 7, 1,
+    -6, -9, -9, -5, 0, 1, 1, 3, 5, 3, -2, -8, -11, -9, -4, 12, 36, 45, 33, 12,
+    5, 15, 26, 30, 23, 10, 1, 0, -2, -11, -29, -54, -80, -97, -111, -120, -97,
+    -49, -10, 28, 52, 66, 80, 84, 83, 55, 7, -32, -49, -46, -39, -43, -27, 30,
+    -127, -126, -127, -126, -127, -126, -127, -126, -127, -126, -127, -126,
+    -127, -126, -127, -126, -127, -126, -127, -126, -127, -126, -127, -126,
+    -127, -126, -127, -126, -127, -126, -127, -126, -127, -126, -127, -126,
+    -127, -126, -127, -126, -127, -127, -126, -127, -126, -127, -126, -127,
+    -126, -127, -126, -127, -126, -127, -126, -127, -126, -127, -126, -127,
+    -126, -127, -126, -127, -126, -127, -126, -127, -126, -127, -126, -127,
+    -126, -127, -126, -127, -126, -127, -126, -127, -126, -127, -126, -127,
+    -126, -127, -126, -127, -126, -127, -126, -127, -126, -127, -126, -127,
+    -126, -126, -127, -126, -127, -126, -127, -126, -127, -126, -127, -126,
+    -127, -126, -127, -126, -127, -126, -127, -126, -127, -126, -127, -126,
+    -127, -126, -127, -126, -127, -126, -127, -126, -127, -126, -127, -126,
+    -127, -126, -127, -126, -127, -126, -127, -126, -127, -126, -127, -126,
+    -127, -126, -127, -126, -127, -126, -127, -126, -127, -127, -126, -127,
+    -126, -127, -126, -127, -126, -127, -126, -127, -126, -127, -126, -127,
+    -126, -127, -126, -127, -126, -127, -126, -127, -126, -127, -126, -127,
+    -126, -127, -126, -127, -126, -127, -126, -127, -126, -127, -126, -127,
+    -126, -127, -126, -127, -126, -127, -126, -127, -126, -127, -126, -127,
+    -126, -127, -126, -127, -126, -126, -127, -126, -127, -126, -127, -126,
+    -127, -126, -127, -126, -127, -126, -127, -126, -127, -126, -127, -126,
+    -127, -126, -127, -126, -127, -126, -127, -126, -127, -126, -127, -126,
+    -127, -126, -127, -126, -127, -126, -127, -126, -127, -126, -127, -126,
+    -127, -126, -127, -126, -127, -126, -127, -126, -127, -126, -127, -126,
+    -127, -127, -126, -127, -126, -127, -126, -127, -126, -127, -126, -127,
+    -126, -127, -126, -127, -59, -49, -36, -26, -28, -35, -33, -17, -1, 8, 6,
+    -3, -15, -28, -32, -11, 29, 59, 65, 63, 67, 67, 53, 29, 16, 26, 54, 80, 89,
+    81, 70, 71, 88, 104, 107, 80, 22, -46, -100, -113, -119, -127, -108, -71,
+    -30, -6, -19, -39, -22, 3, 6, -3, -7, -17, -22, -16, -52, -42, -29, -20,
+    -23, -31, -30, -16, -1, 7, 5, -3, -13, -24, -31, -19, 11, 36, 44, 46, 52,
+    54, 42, 21, 10, 17, 38, 54, 56, 45, 35, 41, 64, 87, 95, 75, 26, -38, -88,
+    -100, -105, -111, -91, -56, -17, 5, -10, -35, -23, 1, 9, 6, 6, -3, -3, 6,
+    -37, -26, -13, -5, -10, -18, -19, -11, 0, 9, 8, 0, -8, -17, -27, -25, -7,
+    13, 22, 27, 34, 36, 26, 9, 0, 9, 27, 36, 29, 15, 4, 11, 39, 70, 86, 76, 37,
+    -20, -70, -87, -94, -104, -86, -51, -8, 22, 10, -17, -15, 4, 13, 14, 19, 13,
+    14, 25, -15, -3, 10, 16, 11, 1, -4, -4, 1, 8, 9, 1, -8, -18, -31, -37, -28,
+    -12, 0, 8, 13, 14, 6, -4, -5, 6, 22, 24, 8, -10, -22, -14, 20, 57, 80, 79,
+    51, 4, -44, -69, -83, -96, -81, -47, 0, 41, 36, 9, 2, 17, 24, 28, 33, 25,
+    26, 38, 12, 24, 35, 40, 32, 18, 8, 1, -3, -3, -2, -9, -18, -28, -44, -57,
+    -57, -43, -28, -15, -6, -2, -5, -7, 0, 15, 31, 28, 8, -13, -27, -19, 17, 57,
+    84, 88, 67, 26, -17, -46, -67, -82, -68, -33, 21, 69, 69, 42, 29, 40, 49,
+    51, 53, 39, 36, 48, 36, 15, -11, -28, -31, -24, -15, -4, 4, 10, 12, 10, 6,
+    5, 3, 0, -3, -2, -2, 0, 9, 17, 16, 11, 6, -1, 0, 8, 13, 12, 8, 6, 4, -4,
+    -10, -9, -8, -1, 5, 1, 9, 16, 5, 1, 7, 14, 25, 28, 18, 9, 10, -9, -32, -36,
+    -28, -74, 24, 6, -16, -29, -28, -18, -8, 1, 6, 7, 3, -2, -7, -9, -7, -5, -4,
+    -1, -1, 1, 5, 6, 3, 0, -3, -8, -7, 1, 8, 8, 7, 6, 5, 0, -5, -3, -1, 2, 6, 2,
+    4, 8, 1, -3, -2, -1, 3, 9, 8, 2, 3, -9, -22, -27, -32, -77, 16, 5, -11, -19,
+    -17, -7, -1, 5, 8, 4, -3, -10, -14, -12, -7, -2, 3, 7, 8, 8, 7, 2, -4, -4,
+    -4, -8, -7, -2, 2, 4, 5, 6, 8, 5, 2, 6, 4, 3, 4, 2, 2, 5, 7, 9, 11, 14, 15,
+    17, 17, 16, 18, 12, 4, -5, -22, -55, -9, -4, -5, -9, -9, -6, -5, -3, 0, -2,
+    -5, -10, -13, -10, -3, 2, 7, 12, 11, 7, 2, -2, -1, 7, 15, 16, 14, 14, 14,
+    13, 11, 10, 13, 12, 17, 28, 28, 23, 18, 13, 8, 12, 22, 28, 29, 32, 32, 26,
+    29, 31, 39, 42, 41, 38, 30, 29, -50, -10, 19, 30, 31, 24, 18, 14, 10, 6, 5,
+    5, 5, 7, 7, 4, 0, -4, -13, -25, -35, -36, -26, -11, 0, 3, -2, -9, -14, -21,
+    -29, -36, -39, -44, -37, -17, -12, -22, -36, -46, -54, -48, -33, -29, -38,
+    -42, -46, -57, -46, -36, -20, -3, 18, 48, 82, 127, -3, -5, -6, -3, -3, -3,
+    3, 10, 7, 0, -3, -3, 2, 2, -5, -7, -5, -5, -12, -17, -13, -8, -8, -9, -7,
+    -2, 5, 6, 5, 5, 2, 2, 2, 1, 1, 3, -1, -2, -3, 2, 12, 19, 19, 14, 3, -1, 12,
+    22, 18, 20, 26, 40, 48, 44, 45, 42, -1, -3, -4, -2, -1, 0, 5, 10, 6, 1, -2,
+    -3, 1, 2, -4, -4, 0, 2, -3, -8, -6, -4, -6, -8, -6, 0, 4, 2, -2, -4, -7, -7,
+    -7, -8, -6, -2, -4, -9, -16, -14, -11, -8, -8, -10, -13, -14, -5, 3, 9, 18,
+    27, 42, 46, 35, 33, 28, 5, 1, -2, -2, -2, -1, 4, 7, 1, -2, -2, -1, 4, 5, 0,
+    -1, 1, 3, 0, -4, -3, 0, -2, -7, -7, -1, 4, 2, -3, -6, -8, -8, -8, -9, -8,
+    -4, -3, -7, -15, -17, -18, -17, -14, -11, -4, 1, 4, 8, 16, 23, 31, 42, 38,
+    23, 20, 18, 17, 13, 4, -5, -11, -13, -8, -5, -10, -10, -7, -6, -1, 4, 4, 4,
+    5, 5, 3, 2, 4, 8, 6, -3, -4, 2, 7, 8, 5, 0, -3, -2, -1, -3, -5, 0, 4, 4, -1,
+    -6, -11, -10, -2, 3, 12, 16, 12, 10, 12, 6, 3, 0, -12, -21, -10, 2, 12, 24,
+    22, 13, 0, -9, -8, -7, -13, -15, -12, -7, 3, 12, 15, 16, 14, 12, 8, 4, 5, 9,
+    8, 1, 0, 10, 18, 23, 21, 16, 14, 16, 16, 11, 6, 7, 10, 7, 1, -5, -12, -14,
+    -7, -7, -13, -26, -43, -51, -55, -79, -100, -113, -127, -116, -74, -40, 9,
+    21, 27, 24, 21, 18, 18, 10, 7, 9, 12, 10, 6, 8, 16, 11, 0, -5, 8, 28, 36,
+    33, 27, 23, 21, 23, 22, 14, 14, 29, 40, 49, 41, 31, 39, 50, 64, 82, 100,
+    119, 127, 121, 107, 76, 56, 41, 24, 5, -4, -1, 4, 25, 43, 38, 77, 90, -13,
+    -3, 0, -5, -11, -14, -13, -17, -18, -15, -11, -10, -13, -14, -11, -13, -19,
+    -21, -12, 1, 6, 4, -4, -15, -20, -16, -14, -19, -21, -11, -4, 7, 6, 2, 6, 7,
+    9, 14, 17, 20, 18, 13, 11, -4, -4, -4, -7, -8, -10, -14, -12, -7, -4, -4,
+    23, 21, -10, -6, -6, -11, -16, -20, -17, -16, -13, -10, -7, -4, -3, -5, -5,
+    -7, -8, -8, -5, -3, -6, -10, -15, -26, -32, -29, -26, -28, -29, -26, -25,
+    -16, -14, -15, -14, -21, -32, -40, -49, -56, -63, -63, -55, -57, -41, -26,
+    -19, -7, 1, -4, -6, -12, -23, -25, -15, -36, 1, 2, 1, -1, -4, -6, -5, -3, 0,
+    -1, -3, 0, 5, 4, 2, 3, 4, 2, -2, -6, -13, -14, -12, -16, -20, -17, -13, -12,
+    -12, -14, -20, -16, -14, -14, -12, -20, -34, -46, -58, -69, -75, -71, -58,
+    -52, -29, -11, -7, 4, 12, 9, 7, -4, -19, -24, -29, -68, 29, 10, -1, -2, 3,
+    9, 12, 16, 16, 8, 1, 4, 8, 2, -4, 1, 9, 7, -1, -9, -14, -9, 1, 8, 13, 21,
+    29, 34, 35, 26, 9, 4, 2, 2, 5, 0, -9, -17, -25, -36, -40, -32, -16, -8, 15,
+    27, 21, 23, 28, 27, 28, 17, 0, -10, -25, -75, 126, 100, 63, 30, 4, -19, -37,
+    -40, -46, -55, -58, -55, -53, -44, -17, 19, 21, -27, -91, -127, -124, -91,
+    -47, -14, 8, 29, 42, 38, 21, 6, 3, 13, 29, 40, 41, 35, 20, -4, -28, -42,
+    -55, -68, -68, -69, -76, -59, -15, 34, 45, 46, 49, 36, 31, 38, -9, -71, 113,
+    91, 59, 31, 8, -8, -18, -16, -18, -24, -27, -27, -29, -23, 2, 37, 43, 4,
+    -46, -71, -65, -37, -6, 14, 25, 34, 36, 23, 5, -3, 4, 20, 36, 45, 47, 46,
+    37, 21, 2, -11, -25, -38, -43, -51, -64, -55, -19, 19, 21, 22, 32, 20, 13,
+    19, -20, -80, 97, 79, 55, 34, 20, 13, 9, 10, 6, 2, -1, -7, -12, -6, 18, 50,
+    54, 17, -24, -38, -25, -3, 14, 24, 28, 30, 20, -7, -30, -31, -12, 17, 43,
+    54, 57, 58, 57, 48, 29, 10, -11, -28, -33, -39, -49, -43, -12, 18, 10, 6,
+    20, 10, 0, 6, -31, -93, 71, 54, 34, 19, 12, 12, 13, 12, 3, -4, -11, -19,
+    -24, -12, 21, 57, 58, 17, -23, -31, -12, 5, 9, 8, 11, 14, -1, -37, -67, -69,
+    -40, 5, 46, 69, 76, 76, 73, 64, 42, 18, -11, -31, -35, -35, -33, -20, 5, 29,
+    14, 3, 18, 12, 2, 5, -33, -101, 83, 55, 24, 1, -10, -12, -11, -15, -30, -43,
+    -55, -66, -65, -39, 10, 54, 50, -1, -46, -50, -25, -8, -13, -22, -22, -18,
+    -29, -63, -97, -103, -73, -17, 37, 67, 79, 80, 76, 70, 49, 18, -17, -38,
+    -39, -35, -26, -8, 13, 29, 11, 1, 21, 14, 1, 3, -35, -111, -19, -17, -15,
+    -14, -13, -9, 0, 14, 26, 27, 17, 5, -1, 1, 5, 3, -5, -15, -25, -28, -15, 9,
+    31, 40, 37, 27, 9, -8, -12, -10, -8, -9, -12, -7, 3, 5, 5, 10, 17, 23, 18,
+    12, 9, 7, 3, 1, 3, 6, 1, 1, 4, 3, 1, 0, 1, 11, -19, -16, -13, -11, -9, -6,
+    3, 16, 25, 23, 13, 0, -3, 2, 7, 5, -4, -16, -29, -38, -33, -14, 9, 23, 27,
+    23, 8, -6, -10, -9, -6, -3, -3, 2, 7, 3, -1, 2, 6, 12, 7, 3, -1, -5, -8, -7,
+    -4, -1, -3, -2, 1, 0, -2, -4, -3, 5, -18, -13, -9, -6, -4, -2, 6, 17, 24,
+    20, 8, -4, -6, 0, 5, 3, -7, -22, -41, -58, -61, -46, -20, 4, 20, 26, 18, 5,
+    -3, -7, -5, -1, 2, 7, 9, 1, -3, -1, 1, 5, 3, 1, -2, -7, -8, -7, -5, -5, -7,
+    -5, -3, -2, -1, -2, -2, 4, -12, -8, -3, -1, 0, 2, 8, 18, 23, 20, 9, -4, -7,
+    -1, 3, -1, -15, -35, -61, -84, -94, -82, -51, -14, 16, 35, 37, 25, 12, 3, 1,
+    2, 3, 7, 8, -1, -7, -7, -7, -4, -4, -2, 1, 2, 3, 4, 4, 1, -3, -4, -4, 0, 7,
+    8, 7, 11, 9, 10, 13, 14, 13, 14, 20, 29, 32, 27, 15, 0, -6, -4, -4, -13,
+    -32, -57, -87, -115, -127, -113, -76, -27, 19, 50, 58, 46, 30, 17, 10, 7, 4,
+    5, 4, -7, -16, -21, -22, -18, -16, -9, 0, 10, 18, 22, 21, 14, 6, 3, 2, 9,
+    19, 21, 17, 18, -7, 0, 8, 15, 18, 10, -4, -17, -24, -27, -27, -19, -16, -20,
+    -30, -47, -71, -91, -100, -96, -86, -82, -90, -104, -118, -126, -127, -119,
+    -103, -81, -60, -47, -40, -36, -29, -15, 4, 17, 13, 4, -2, -8, -14, -5, 6,
+    7, 10, 20, 25, 22, 16, 14, -1, -20, -14, -14, 8, 13, 18, 22, 21, 12, -2,
+    -13, -17, -16, -11, -2, 3, 0, -7, -23, -44, -60, -64, -55, -44, -41, -52,
+    -70, -85, -95, -98, -93, -80, -61, -42, -30, -21, -14, -6, 5, 21, 27, 18, 7,
+    1, -5, -12, -8, -1, -3, 0, 11, 13, 8, 7, 7, -6, -22, -18, -15, 21, 25, 29,
+    31, 28, 18, 4, -4, -4, 0, 6, 14, 19, 18, 12, -1, -19, -31, -29, -13, 3, 2,
+    -13, -31, -45, -54, -58, -53, -38, -19, -1, 11, 19, 22, 23, 27, 33, 27, 10,
+    -1, -2, -3, -11, -9, -5, -9, -6, 4, 2, -4, 0, 6, -3, -16, -12, -5, 17, 22,
+    28, 32, 31, 23, 10, 2, 3, 7, 11, 17, 20, 17, 10, -3, -19, -26, -20, 0, 16,
+    15, -1, -17, -26, -30, -28, -15, 8, 34, 50, 53, 50, 43, 36, 33, 31, 15, -10,
+    -21, -15, -6, -8, -7, -5, -10, -8, 0, -5, -10, -3, 10, 10, 3, 7, 19, 6, 8,
+    14, 21, 25, 21, 10, 3, 5, 8, 11, 13, 12, 5, -4, -16, -28, -32, -23, -3, 11,
+    8, -9, -23, -26, -22, -9, 16, 51, 83, 95, 85, 69, 51, 36, 28, 21, 3, -21,
+    -30, -20, -4, 3, 6, 6, -2, -3, 3, -5, -11, -1, 18, 27, 24, 28, 47, -9, 5,
+    22, 37, 43, 41, 30, 17, 8, 4, -3, -16, -33, -49, -52, -42, -28, -20, -15,
+    -13, -17, -20, -18, -10, -1, 4, -2, -16, -30, -32, -21, 0, 13, 6, -9, -16,
+    -20, -23, -5, 29, 68, 101, 109, 99, 69, 29, -15, -50, -50, -49, -45, -28,
+    -21, -26, -8, 17, -2, 5, 14, 20, 23, 23, 21, 18, 17, 18, 16, 7, -4, -17,
+    -22, -18, -12, -10, -10, -9, -11, -14, -12, -5, 4, 10, 8, -1, -9, -11, -8,
+    2, 7, 0, -13, -18, -24, -32, -24, -2, 31, 67, 77, 72, 55, 32, 2, -30, -38,
+    -43, -41, -33, -34, -35, -18, 4, 5, 6, 5, 3, -1, -2, 0, 5, 12, 20, 21, 20,
+    18, 13, 7, 7, 8, 4, 0, 0, -1, -3, -1, 3, 7, 9, 9, 6, 5, 6, 7, 8, 8, 3, -1,
+    1, -3, -18, -27, -24, -2, 34, 48, 52, 51, 44, 33, 14, -3, -18, -20, -23,
+    -30, -31, -15, 6, -1, -3, -8, -16, -23, -26, -22, -15, -5, 5, 11, 18, 28,
+    32, 30, 27, 21, 11, 6, 8, 12, 14, 15, 15, 9, 2, -2, -2, 3, 9, 11, 9, 8, 7,
+    13, 24, 19, -7, -35, -57, -51, -19, -2, 16, 36, 47, 58, 59, 40, 17, 7, -5,
+    -17, -19, -4, 17, -52, -48, -50, -56, -60, -59, -54, -45, -34, -22, -11, 3,
+    21, 33, 33, 26, 12, -3, -9, -4, 6, 13, 15, 6, -11, -27, -35, -34, -25, -15,
+    -10, -9, -8, -5, 6, 17, 6, -34, -81, -123, -127, -94, -66, -29, 13, 43, 74,
+    92, 74, 47, 31, 11, -6, -7, 5, 25, 8, 6, 7, 8, 3, -5, -14, -21, -24, -27,
+    -27, -24, -17, -8, -2, -7, -24, -42, -39, -9, 31, 59, 69, 57, 34, 18, 12, 9,
+    7, 13, 24, 29, 21, 3, -12, -21, -21, -16, -17, -15, -5, -6, -12, -4, 4, -7,
+    -20, -24, -7, 1, -13, -24, -21, -21, -10, -1, 4, 2, 3, 6, 3, -3, -9, -12,
+    -13, -12, -9, -6, -4, -1, 5, 11, 10, 3, 4, 21, 43, 56, 57, 45, 27, 14, 11,
+    8, 0, -4, 1, 6, 5, -5, -14, -19, -15, -4, -1, 1, 10, 11, 3, 1, 1, -7, -12,
+    -10, 2, 3, -6, -10, -9, -11, -5, 1, -16, -14, -7, -1, -1, -3, -4, -6, -6,
+    -3, 3, 7, 6, 3, 5, 18, 30, 32, 31, 35, 38, 33, 24, 12, 1, 0, 6, 7, -3, -14,
+    -18, -16, -15, -20, -24, -23, -17, -6, 0, 2, 9, 12, 5, -1, -5, -7, -4, 1, 8,
+    2, -3, -2, 0, -5, -1, 3, -35, -26, -12, 1, 6, 8, 10, 10, 9, 10, 16, 22, 23,
+    13, 7, 18, 32, 34, 27, 15, -2, -24, -41, -49, -44, -25, -3, 10, 6, -4, -9,
+    -10, -12, -19, -23, -20, -14, -6, 0, 1, 4, 6, 1, -1, -1, 1, 9, 13, 14, 4, 1,
+    7, 8, 0, 1, 3, -53, -38, -16, 5, 17, 25, 30, 29, 25, 20, 21, 28, 27, 10, -9,
+    -10, -5, -9, -23, -47, -78, -109, -127, -126, -103, -64, -25, 1, 9, 7, 8,
+    10, 9, 1, -5, -3, 1, 6, 11, 10, 8, 5, 1, 6, 16, 26, 36, 38, 30, 18, 18, 28,
+    29, 18, 13, 13, 65, 40, 4, -28, -44, -41, -23, -1, 16, 24, 30, 38, 41, 38,
+    29, 9, -14, -20, -1, 30, 51, 49, 26, -1, -15, -18, -21, -18, -3, 6, 9, 9,
+    11, 14, 7, -1, 0, 5, 18, 24, 10, -13, -25, -22, -22, -13, 5, 26, 27, 3, -1,
+    20, 17, 2, 6, 50, 46, 20, -16, -49, -67, -66, -47, -22, -3, 4, 4, 7, 12, 19,
+    18, 0, -26, -35, -15, 18, 40, 41, 24, 4, -4, -6, -13, -17, -9, 0, 4, 5, 3,
+    0, -7, -14, -13, -5, 18, 34, 25, 5, -6, -9, -19, -20, -14, -1, 0, -14, -10,
+    9, 9, 1, 6, 42, 38, 8, -33, -71, -92, -95, -77, -49, -26, -19, -21, -21,
+    -11, 8, 19, 2, -31, -48, -32, 2, 29, 34, 20, 5, 1, 3, -4, -11, -7, 4, 16,
+    23, 21, 12, -2, -14, -18, -11, 12, 34, 35, 22, 13, 10, -5, -21, -31, -23,
+    -19, -22, -10, 8, 13, 16, 24, 52, 44, 6, -43, -86, -113, -119, -104, -75,
+    -49, -38, -40, -39, -21, 12, 36, 24, -16, -42, -32, 3, 34, 39, 20, 0, -6,
+    -2, -5, -9, -1, 17, 37, 51, 53, 41, 15, -11, -26, -27, -13, 8, 21, 22, 17,
+    13, 1, -21, -43, -39, -30, -24, -6, 13, 23, 35, 50, 71, 82, 30, -33, -86,
+    -119, -127, -111, -78, -47, -32, -33, -30, -7, 37, 70, 56, 10, -24, -16, 20,
+    52, 52, 18, -19, -36, -36, -35, -33, -15, 17, 50, 72, 76, 59, 23, -16, -43,
+    -54, -55, -38, -11, 10, 17, 19, 13, -9, -34, -33, -19, -4, 16, 30, 40, 58,
+    75, 88, 71, 61, 35, -5, -46, -64, -56, -32, -12, -5, -12, -21, -19, -4, 5,
+    -11, -41, -50, -30, -5, 11, 19, 16, 1, -17, -35, -47, -40, -13, 15, 31, 31,
+    28, 20, 21, 26, 0, -50, -96, -120, -104, -65, -43, -25, -7, 14, 41, 75, 90,
+    74, 38, 0, -32, -55, -54, -27, 64, 59, 42, 9, -22, -37, -32, -15, 0, 4, -7,
+    -16, -12, 7, 19, 4, -24, -32, -14, 6, 18, 25, 22, 10, -2, -15, -27, -25, -5,
+    16, 26, 20, 11, 4, 8, 19, 3, -30, -56, -70, -52, -18, -3, 11, 23, 33, 42,
+    48, 44, 21, -11, -33, -41, -50, -42, -2, 41, 38, 27, 6, -14, -20, -19, -13,
+    -3, -3, -18, -26, -15, 10, 23, 6, -21, -28, -12, 4, 13, 16, 12, 3, -2, -7,
+    -17, -18, -8, 1, 5, -2, -11, -21, -19, -8, -18, -32, -35, -35, -14, 17, 26,
+    40, 48, 46, 41, 24, 1, -25, -47, -49, -33, -29, -14, 39, 32, 23, 9, -6, -15,
+    -12, -7, -3, 6, 8, -8, -18, -6, 24, 37, 16, -15, -25, -12, 2, 7, 5, -4, -9,
+    -3, 3, -2, -8, -7, -6, -7, -12, -23, -38, -43, -38, -41, -36, -15, 2, 26,
+    51, 58, 69, 69, 49, 26, -9, -36, -61, -69, -44, -6, 9, 27, 90, 33, 16, -6,
+    -23, -29, -18, -5, 2, 14, 19, 4, -11, -2, 28, 38, 12, -18, -29, -18, -3, 3,
+    -2, -13, -12, 5, 21, 23, 19, 17, 16, 14, 8, -6, -25, -33, -30, -24, 2, 45,
+    76, 102, 115, 108, 102, 81, 34, -17, -68, -86, -104, -104, -56, 5, 31, 56,
+    127, 37, 42, 37, 22, -2, -24, -31, -35, -40, -41, -41, -41, -34, -25, -27,
+    -41, -58, -63, -55, -46, -41, -30, -1, 37, 59, 56, 42, 34, 35, 34, 25, 16,
+    11, 15, 28, 42, 44, 33, 27, 23, 17, 6, 4, 6, 4, 10, 6, -9, -19, -16, -1, 5,
+    3, -5, -2, 28, 65, 63, 51, 30, 6, -13, -15, -13, -15, -19, -23, -25, -19,
+    -8, -7, -18, -35, -43, -39, -30, -25, -19, -2, 22, 34, 28, 16, 12, 17, 24,
+    23, 19, 18, 18, 22, 27, 24, 15, 15, 14, 11, 2, -2, -1, -5, -2, -5, -15, -19,
+    -15, -2, 9, 12, 2, 1, 29, 101, 91, 71, 42, 13, -4, -2, 3, 0, -7, -15, -18,
+    -10, 3, 8, 0, -13, -21, -16, -4, 5, 9, 14, 22, 22, 12, 1, -6, -5, 3, 7, 10,
+    12, 12, 10, 10, 5, 1, 6, 9, 9, 3, 0, 0, -8, -7, -12, -16, -15, -14, -6, 6,
+    15, 7, 4, 27, 127, 117, 91, 53, 16, -4, -1, 5, 1, -7, -14, -18, -10, 5, 13,
+    9, -3, -9, 0, 17, 27, 24, 11, -1, -12, -24, -36, -45, -47, -41, -34, -27,
+    -19, -16, -16, -15, -17, -17, -8, -1, 4, 6, 7, 4, -9, -9, -18, -19, -11,
+    -14, -13, -3, 9, 4, -2, 15, 123, 127, 109, 70, 29, 3, 4, 12, 10, 2, -5, -9,
+    -5, 8, 14, 9, -1, -3, 10, 30, 39, 26, -6, -41, -67, -84, -99, -111, -116,
+    -109, -98, -85, -70, -61, -58, -53, -54, -56, -49, -38, -27, -18, -14, -19,
+    -31, -27, -35, -34, -22, -27, -34, -28, -11, -12, -20, -8, 73, 41, 7, -15,
+    -10, 8, 16, 9, 0, 2, 4, 1, 3, 4, -9, -18, -3, 19, 29, 22, 7, -8, -6, 11, 17,
+    2, -6, -1, -4, -18, -27, -18, -8, -24, -51, -52, -42, -36, -13, 8, 6, 18,
+    36, 24, 15, 14, 12, 17, 13, -2, 2, -6, -17, -14, 2, 33, 76, 38, -4, -28,
+    -27, -15, -7, -9, -14, -13, -9, -5, 2, 7, -2, -11, 0, 16, 21, 11, -10, -27,
+    -21, 3, 12, -1, -9, 0, 3, -7, -15, -5, 4, -9, -29, -27, -15, -4, 16, 26, 15,
+    11, 12, 1, 1, -1, -1, 13, 17, 2, 9, 5, -7, -4, 18, 36, 97, 55, 12, -16, -20,
+    -19, -15, -16, -22, -21, -15, -10, -4, 0, -7, -15, -7, 6, 7, -4, -23, -39,
+    -26, 8, 22, 8, -3, 2, 6, 0, -7, 1, 9, 2, -10, -6, 5, 20, 41, 51, 32, 19, 16,
+    3, -2, -15, -22, -17, -9, -18, -4, 2, -4, 3, 31, 34, 81, 41, 7, -11, -12,
+    -14, -14, -18, -27, -30, -28, -26, -25, -27, -33, -36, -27, -17, -16, -18,
+    -28, -45, -40, -11, 2, -10, -20, -11, 2, 7, 7, 11, 15, 10, -4, -7, -9, -4,
+    14, 32, 26, 18, 8, -12, -23, -41, -47, -42, -41, -47, -31, -19, -13, 5, 30,
+    8, 26, -22, -50, -52, -33, -18, -8, 4, 15, 24, 29, 26, 19, 12, 6, 9, 28, 51,
+    66, 76, 65, 24, -10, -19, -26, -41, -49, -36, -13, 6, 14, 18, 18, 2, -34,
+    -66, -95, -115, -109, -72, -38, -4, 23, 34, 56, 68, 98, 127, 109, 98, 112,
+    106, 107, 122, 109, 33, -26, -20, -6, 11, 19, 14, -1, -21, -39, -42, -23, 6,
+    30, 39, 27, -3, -39, -58, -47, -24, -23, -50, -78, -93, -97, -100, -98, -69,
+    2, 70, 116, 127, 107, 78, 53, 37, 21, -4, -25, -9, 10, 15, 25, 40, 41, 14,
+    -10, -12, -6, -23, -51, -36, -3, -17, -12, 72, -20, -14, 0, 16, 23, 17, 3,
+    -14, -28, -29, -12, 10, 25, 30, 23, 9, -10, -20, -10, 11, 14, -7, -35, -56,
+    -69, -81, -90, -75, -24, 26, 60, 66, 49, 29, 17, 15, 12, -1, -15, 0, 10, 6,
+    4, 14, 21, 6, -9, -5, 4, -9, -32, -18, 6, -11, -5, 75, -14, -6, 9, 21, 23,
+    17, 3, -15, -28, -25, -7, 11, 22, 24, 18, 11, 0, -7, 2, 21, 27, 9, -19, -43,
+    -59, -70, -77, -67, -29, 5, 25, 26, 12, 1, 0, 8, 11, 1, -7, 6, 7, -5, -12,
+    -4, 5, -3, -11, -3, 9, -2, -22, -8, 7, -14, -1, 82, -7, 3, 18, 27, 25, 16,
+    3, -13, -22, -14, 5, 18, 25, 25, 15, 0, -19, -31, -23, -3, 2, -16, -46, -68,
+    -72, -65, -55, -37, 1, 28, 39, 33, 18, 6, 3, 10, 10, -1, -4, 9, 6, -7, -12,
+    -3, 4, -2, -9, 0, 8, -5, -22, -9, -1, -19, 3, 94, -15, -5, 11, 19, 15, 4,
+    -9, -23, -28, -11, 13, 27, 34, 30, 8, -26, -59, -75, -65, -43, -38, -58,
+    -86, -99, -85, -53, -20, 15, 62, 91, 98, 86, 68, 52, 41, 36, 24, 7, 6, 19,
+    18, 7, 5, 15, 19, 11, 6, 13, 13, -5, -20, -5, 1, -14, 16, 116, -28, -19,
+    -10, -5, -3, -6, -8, -5, 1, 2, 2, 3, 1, -4, -8, -8, -5, -5, -10, -16, -18,
+    -8, 15, 40, 58, 61, 48, 20, -15, -31, -25, -13, -3, 0, -1, -3, -3, -4, -5,
+    -7, -3, -2, 0, 2, 1, 2, -5, -6, -3, -2, -11, -15, -11, -3, 2, 17, -18, -9,
+    -1, 6, 8, 4, 0, 1, 5, 5, 4, 5, 8, 8, 6, 5, 6, 6, 3, 1, 3, 11, 24, 32, 29,
+    17, -1, -21, -38, -37, -18, 2, 13, 14, 10, 3, 0, 0, 0, -3, -1, -2, -2, 1, 0,
+    1, -3, -3, 0, 1, -8, -10, -7, -5, -3, 10, -12, -4, 5, 11, 14, 11, 7, 5, 5,
+    1, -2, 0, 6, 9, 9, 7, 6, 5, 3, 5, 12, 19, 21, 11, -8, -31, -51, -62, -63,
+    -46, -17, 10, 24, 25, 16, 7, 2, 2, 4, 3, 4, 1, 0, 3, 0, 1, 1, 4, 4, 4, -1,
+    -2, 1, -2, -5, 3, -11, -6, 3, 9, 11, 10, 7, 4, 1, -5, -10, -8, 0, 4, 4, 4,
+    5, 2, -2, -1, 7, 11, 3, -20, -50, -77, -94, -97, -86, -61, -27, 4, 22, 24,
+    15, 4, -1, -1, 3, 5, 6, 4, 4, 10, 8, 7, 7, 11, 7, 5, 4, 4, 6, 1, -5, -2, -1,
+    0, 3, 5, 5, 6, 5, 3, -1, -9, -14, -10, -1, 6, 9, 13, 15, 11, 1, -3, 2, 2,
+    -16, -48, -85, -113, -127, -124, -106, -79, -44, -12, 7, 11, 4, -6, -11,
+    -11, -6, -2, 1, 2, 5, 13, 13, 11, 11, 11, 1, -2, -1, 0, 0, -3, -7, -5, 53,
+    40, 17, -10, -38, -60, -67, -53, -29, -7, 11, 22, 19, 13, 17, 22, 18, 6, -5,
+    -5, 3, 5, -1, -2, 4, 11, 11, 3, -6, -6, -6, -6, -8, -5, 0, -6, -8, -4, -6,
+    -5, 1, -1, -1, -1, 3, 4, 2, 7, 2, -9, -12, -5, 2, 5, 18, 35, 54, 40, 15,
+    -13, -42, -63, -66, -47, -18, 9, 29, 37, 27, 13, 9, 10, 3, -9, -18, -16, -7,
+    -3, -6, -7, -3, 1, 2, -4, -8, -6, -4, -3, -4, -1, 4, -1, -3, 1, -1, -3, 1,
+    -2, -6, -8, -3, -1, -5, -1, -1, -7, -7, 1, 6, 2, 10, 20, 58, 39, 10, -24,
+    -57, -77, -74, -47, -9, 27, 52, 59, 45, 23, 8, 2, -8, -19, -27, -24, -12,
+    -4, -3, -4, -1, 2, 2, -3, -5, -1, 2, 1, -1, 0, 3, -1, 1, 8, 7, 2, 3, 2, 0,
+    -5, -4, -5, -10, -6, -2, -3, -3, 5, 7, -2, 1, 2, 60, 34, -4, -44, -83, -105,
+    -98, -61, -8, 41, 76, 86, 70, 39, 13, 1, -8, -18, -26, -26, -14, -3, 2, 4,
+    6, 10, 10, 7, 7, 11, 12, 10, 5, 3, 4, 3, 9, 17, 12, 3, 3, 4, 4, -3, -3, -8,
+    -16, -11, -3, 2, 3, 5, 5, -7, -11, -18, 90, 50, -2, -55, -102, -127, -116,
+    -68, 2, 68, 112, 124, 103, 60, 21, -1, -12, -22, -32, -34, -25, -13, -8, -7,
+    -4, 2, 5, 3, 5, 8, 5, 0, -6, -8, -7, -4, 8, 17, 5, -9, -11, -7, -4, -7, -5,
+    -11, -18, -12, 0, 10, 13, 13, 7, -8, -20, -34, -123, -123, -123, -122, -124,
+    -122, -124, -122, -124, -122, -124, -122, -124, -121, -124, -121, -125,
+    -121, -125, -120, -126, -120, -126, -120, -126, -120, -126, -120, -125,
+    -121, -124, -122, -124, -123, -123, -123, -122, -124, -121, -125, -120,
+    -126, -120, -126, -119, -127, -119, -126, -119, -126, -120, -125, -121,
+    -125, -121, -124, -123, -123, -122, -124, -122, -124, -122, -124, -122,
+    -124, -122, -124, -121, -125, -121, -125, -121, -125, -120, -126, -120,
+    -126, -119, -126, -119, -126, -120, -126, -120, -125, -121, -124, -122,
+    -123, -123, -122, -124, -121, -125, -120, -126, -120, -127, -119, -127,
+    -119, -127, -119, -127, -119, -126, -120, -125, -121, -125, -122, -123,
+    -123, -123, -122, -124, -122, -124, -122, -124, -122, -124, -121, -124,
+    -121, -125, -121, -125, -121, -125, -120, -126, -120, -126, -119, -126,
+    -119, -126, -120, -125, -121, -125, -122, -124, -123, -123, -123, -122,
+    -124, -121, -125, -120, -126, -119, -127, -119, -127, -119, -127, -119,
+    -126, -120, -126, -121, -125, -121, -124, -123, -123, -122, -124, -122,
+    -124, -122, -124, -122, -124, -122, -124, -121, -125, -121, -125, -121,
+    -125, -120, -126, -120, -126, -119, -126, -119, -126, -120, -126, -120,
+    -125, -121, -124, -122, -123, -123, -122, -124, -121, -125, -120, -126,
+    -120, -127, -119, -127, -119, -127, -119, -127, -119, -126, -120, -125,
+    -121, -125, -122, -123, -123, -123, -122, -124, -122, -124, -122, -124,
+    -122, -124, -122, -124, -121, -124, -121, -125, -121, -125, -120, -126,
+    -120, -126, -120, -126, -120, -126, -120, -125, -121, -124, -122, -124,
+    -123, -123, -123, -122, -124, -121, -125, -120, -126, -120, -126, -119,
+    -127, -119, -126, -119, -126, -120, -125, -121, -125, -121, -124, -45, -41,
+    -36, -31, -23, -13, -3, 6, 11, 12, 5, -14, -36, -42, -21, 14, 41, 45, 31,
+    13, 5, 6, 6, 1, -1, 1, 5, 11, 17, 19, 13, -1, -21, -35, -27, -1, 20, 42, 63,
+    70, 56, 31, 5, -7, -14, -20, -9, 1, -2, 8, 21, 10, -6, -9, -32, -86, -32,
+    -30, -27, -23, -16, -7, 1, 8, 13, 15, 9, -12, -35, -42, -24, 9, 35, 38, 23,
+    6, 1, 6, 9, 4, -1, -3, -2, 1, 6, 11, 9, -1, -19, -37, -35, -16, 1, 21, 47,
+    60, 49, 28, 10, 2, -8, -21, -13, -2, -5, 1, 11, -4, -22, -22, -41, -92, -18,
+    -16, -16, -12, -6, 1, 9, 17, 21, 23, 16, -7, -33, -43, -28, 3, 26, 26, 6,
+    -13, -16, -6, 3, 2, -3, -6, -6, -5, -2, 4, 6, 1, -17, -38, -44, -31, -18, 3,
+    36, 59, 53, 37, 21, 14, -1, -20, -18, -7, -10, -6, 1, -15, -37, -37, -56,
+    -103, -8, -6, -5, -2, 3, 10, 17, 23, 27, 29, 20, -5, -35, -50, -37, -7, 15,
+    9, -19, -44, -47, -32, -15, -9, -8, -6, -4, -4, -2, 4, 7, 2, -15, -39, -50,
+    -43, -32, -10, 30, 64, 66, 55, 41, 29, 7, -20, -25, -16, -19, -18, -12, -29,
+    -50, -54, -73, -116, 4, 5, 6, 10, 17, 25, 32, 37, 40, 41, 33, 6, -27, -45,
+    -34, -5, 12, -4, -44, -77, -83, -66, -45, -33, -26, -16, -10, -8, -4, 3, 7,
+    1, -16, -44, -59, -56, -46, -23, 23, 68, 80, 76, 65, 48, 18, -18, -30, -25,
+    -30, -30, -26, -41, -62, -66, -86, -127, -123, -118, -123, -118, -123, -119,
+    -122, -120, -121, -120, -121, -120, -121, -120, -121, -120, -121, -120,
+    -122, -120, -122, -120, -121, -120, -121, -121, -120, -121, -119, -122,
+    -118, -123, -117, -124, -116, -125, -116, -126, -115, -126, -115, -126,
+    -115, -126, -115, -126, -115, -126, -115, -126, -115, -126, -115, -125,
+    -116, -124, -117, -124, -117, -123, -118, -122, -119, -121, -120, -121,
+    -120, -121, -120, -121, -120, -121, -120, -122, -119, -122, -119, -122,
+    -120, -121, -120, -121, -121, -120, -122, -119, -123, -118, -124, -116,
+    -125, -115, -126, -115, -126, -115, -126, -114, -127, -114, -127, -114,
+    -127, -114, -127, -114, -126, -115, -126, -115, -126, -116, -124, -117,
+    -124, -118, -123, -119, -122, -120, -121, -120, -121, -120, -121, -120,
+    -121, -120, -121, -120, -122, -119, -122, -119, -122, -120, -121, -121,
+    -120, -121, -119, -122, -118, -123, -117, -125, -116, -126, -115, -126,
+    -115, -126, -115, -127, -114, -127, -114, -127, -114, -127, -114, -127,
+    -115, -126, -115, -126, -115, -125, -117, -124, -117, -123, -118, -122,
+    -119, -121, -120, -121, -120, -121, -120, -121, -120, -121, -120, -122,
+    -119, -122, -119, -122, -120, -121, -120, -121, -121, -120, -122, -119,
+    -123, -118, -124, -116, -125, -115, -126, -115, -126, -115, -126, -114,
+    -127, -114, -127, -114, -127, -114, -127, -114, -126, -115, -126, -115,
+    -126, -116, -123, -118, -123, -118, -123, -119, -122, -120, -121, -120,
+    -121, -120, -121, -120, -121, -120, -121, -120, -122, -120, -122, -120,
+    -121, -120, -121, -121, -120, -121, -119, -122, -118, -123, -117, -124,
+    -116, -125, -116, -126, -115, -126, -115, -126, -115, -126, -115, -126,
+    -115, -126, -115, -126, -115, -126, -115, -125, -116, -124, -11, -31, -51,
+    -64, -66, -58, -46, -35, -17, -6, 5, 12, -1, -16, -16, -6, -2, -10, -17,
+    -18, -24, -33, -35, -36, -41, -47, -45, -28, -16, -29, -51, -65, -87, -70,
+    -55, -62, -82, -100, -106, -111, -82, -74, -46, -42, -37, -25, 4, -4, -8,
+    10, 1, 23, 26, 10, 17, -18, 49, 32, 18, 10, 9, 16, 19, 16, 17, 15, 15, 20,
+    12, 0, 1, 10, 14, 14, 19, 23, 18, 11, 12, 16, 17, 17, 22, 34, 40, 33, 23,
+    26, 17, 36, 52, 55, 52, 53, 51, 36, 47, 32, 32, 14, 1, -2, 7, -10, -16, 3,
+    -3, 16, 15, 9, 29, 8, 55, 45, 37, 28, 25, 27, 24, 14, 9, 0, -5, -1, -5, -15,
+    -14, -5, -1, 0, 3, 4, -3, -3, 2, 5, 6, 8, 15, 32, 49, 54, 54, 65, 63, 82,
+    95, 96, 103, 123, 127, 100, 99, 75, 65, 44, 28, 16, 12, 1, -7, -2, -13, 7,
+    6, -2, 27, 19, 54, 49, 48, 41, 32, 29, 22, 13, 13, 6, 0, 3, 3, -6, -6, -1,
+    -6, -12, -11, -8, -7, -1, 1, -3, -6, -8, -5, 6, 20, 22, 12, 13, 10, 28, 38,
+    35, 34, 51, 63, 43, 44, 25, 27, 23, 21, 23, 25, 26, 16, 4, -19, -3, -8, -25,
+    3, 0, -72, -69, -62, -58, -62, -64, -64, -53, -25, -9, -5, 3, 11, 9, 15, 21,
+    8, -9, -10, 1, 13, 28, 33, 29, 20, 7, -7, -15, -24, -45, -77, -90, -96, -83,
+    -84, -102, -120, -122, -113, -117, -99, -98, -60, -35, -19, 1, 16, 33, 33,
+    12, -13, 3, -19, -57, -33, -46, -11, 10, 31, 44, 50, 51, 44, 40, 22, -14,
+    -31, -22, -9, -13, -27, -35, -27, -18, -21, -29, -31, -24, -9, 12, 28, 40,
+    44, 35, 14, -10, -36, -63, -75, -61, -34, 0, 14, 2, 17, 39, 44, 40, 41, 64,
+    102, 93, 47, 22, 33, -20, -83, -95, -99, -84, -25, 62, -23, 3, 29, 45, 51,
+    47, 38, 33, 15, -16, -29, -16, 0, -1, -8, -6, 7, 13, 0, -17, -23, -17, -2,
+    20, 38, 47, 43, 31, 20, 11, -3, -29, -44, -28, 4, 37, 50, 35, 40, 55, 48,
+    28, 9, 11, 27, 13, -24, -39, -17, -57, -107, -89, -68, -66, -36, 37, -38,
+    -12, 18, 42, 56, 54, 44, 36, 19, -8, -19, -5, 10, 9, 3, 10, 30, 39, 21, -7,
+    -22, -19, -5, 15, 33, 41, 32, 17, 8, 7, 2, -19, -31, -9, 27, 60, 74, 56, 54,
+    65, 57, 32, -3, -18, -19, -46, -81, -90, -58, -77, -110, -71, -32, -41, -40,
+    14, -67, -42, -14, 15, 38, 44, 38, 30, 16, -2, -8, 6, 21, 18, 5, 7, 31, 46,
+    32, 3, -14, -6, 13, 33, 46, 43, 21, -4, -13, -9, -2, -9, -13, 12, 49, 74,
+    84, 69, 62, 70, 72, 60, 34, 20, 8, -36, -85, -98, -62, -65, -83, -34, 12,
+    -8, -25, 22, -122, -88, -56, -22, 5, 15, 16, 13, 0, -18, -26, -13, 3, 4,
+    -10, -9, 17, 36, 22, -11, -24, -2, 31, 55, 55, 26, -22, -65, -80, -68, -41,
+    -24, -12, 25, 71, 100, 110, 98, 86, 90, 101, 106, 93, 78, 48, -20, -96,
+    -127, -95, -90, -97, -43, 3, -16, -23, 35, 100, 84, 58, 24, -11, -44, -69,
+    -82, -84, -77, -66, -47, -25, 1, 27, 43, 49, 46, 22, -20, -53, -52, -14, 37,
+    71, 70, 43, 6, -27, -39, -32, -17, -1, 12, 15, 9, 2, -2, -1, -1, -17, -33,
+    -19, 9, 12, -4, -2, 14, 10, -5, -4, -3, -9, 0, 12, 21, 86, 73, 51, 21, -11,
+    -42, -65, -76, -75, -67, -59, -46, -26, 2, 31, 45, 42, 32, 11, -19, -38,
+    -28, 9, 52, 72, 60, 25, -14, -44, -52, -41, -22, -2, 16, 21, 15, 10, 8, 6,
+    0, -17, -35, -29, -11, -8, -20, -20, -6, -6, -14, -11, -7, -6, 6, 15, 21,
+    70, 60, 43, 19, -10, -38, -60, -69, -66, -62, -61, -55, -36, -2, 33, 44, 31,
+    11, -10, -26, -25, 1, 42, 77, 84, 60, 19, -23, -53, -57, -42, -20, 4, 26,
+    33, 32, 32, 33, 27, 14, -7, -26, -30, -20, -18, -27, -25, -12, -7, -11, -11,
+    -9, 3, 20, 28, 28, 52, 42, 28, 9, -15, -41, -62, -70, -68, -66, -71, -67,
+    -43, 0, 40, 48, 26, -2, -26, -34, -15, 28, 74, 101, 93, 55, 7, -33, -57,
+    -56, -39, -17, 7, 31, 42, 46, 49, 51, 37, 14, -10, -29, -40, -35, -29, -32,
+    -24, -5, 6, 5, -5, -9, 10, 37, 48, 44, 75, 57, 37, 15, -11, -38, -60, -70,
+    -66, -64, -68, -61, -27, 27, 73, 82, 57, 25, -2, -9, 17, 68, 113, 127, 99,
+    40, -21, -64, -82, -75, -55, -34, -13, 11, 27, 35, 42, 45, 23, -10, -39,
+    -58, -74, -71, -60, -53, -31, -2, 18, 19, 1, -14, 7, 45, 63, 55, -17, -15,
+    -11, -8, -2, 2, 0, -7, -14, -16, -4, 16, 24, 13, -4, -10, -6, 0, 2, 3, 0,
+    -6, -8, -7, -8, -11, -11, -9, -13, -12, -3, 4, 7, 5, -13, -34, -46, -64,
+    -101, -127, -124, -123, -102, -64, -21, 25, 64, 75, 51, 53, 52, 32, 16, 23,
+    17, -15, -29, -29, -28, -26, -21, -14, -13, -18, -25, -26, -15, 2, 6, -5,
+    -19, -22, -15, -5, 0, 1, -1, -8, -13, -13, -14, -15, -14, -11, -16, -17, -9,
+    -1, 2, 0, -13, -27, -34, -44, -65, -74, -58, -51, -35, -9, 17, 43, 62, 63,
+    41, 41, 40, 26, 11, 16, 15, -13, -7, -13, -16, -17, -12, -4, 2, 1, -3, -2,
+    9, 22, 24, 12, -4, -5, 5, 18, 22, 20, 16, 11, 5, 3, 2, 2, 3, 4, -1, -3, 4,
+    11, 13, 11, 2, -8, -12, -14, -18, -15, 11, 20, 26, 38, 47, 53, 51, 46, 25,
+    18, 16, 11, -3, -1, 3, -22, -4, -11, -16, -18, -12, -2, 8, 11, 12, 16, 24,
+    33, 32, 15, -4, -7, 6, 21, 24, 18, 13, 12, 10, 11, 14, 16, 15, 12, 5, 6, 15,
+    21, 21, 17, 9, 4, 5, 15, 25, 42, 72, 78, 70, 67, 61, 52, 36, 26, 6, -7, -12,
+    -10, -23, -23, -18, -40, -22, -32, -40, -41, -36, -24, -12, -5, 0, 8, 16,
+    23, 19, -5, -32, -36, -16, 6, 9, -1, -7, -5, 0, 6, 12, 13, 9, -1, -12, -13,
+    -6, -3, -6, -12, -21, -26, -19, 2, 25, 51, 83, 86, 71, 57, 38, 20, 4, -3,
+    -21, -39, -44, -38, -50, -49, -46, -64, -12, -26, -34, -27, -8, 10, 20, 19,
+    4, -15, -26, -25, -20, -17, -13, 5, 31, 48, 47, 39, 38, 39, 25, -8, -40,
+    -52, -42, -27, -17, -11, -3, 4, 5, -4, -15, -15, -9, -8, -15, -19, -9, -1,
+    1, 2, 7, 15, 18, 6, -7, -7, -10, -12, -6, -3, -3, 1, -2, -17, -27, -21, -3,
+    16, 25, 20, 3, -17, -29, -25, -13, -7, -3, 11, 33, 45, 40, 27, 17, 8, -9,
+    -35, -54, -52, -33, -12, 2, 9, 13, 14, 12, 4, -6, -6, 2, 5, 1, -1, 4, 5, 1,
+    1, 3, 7, 10, 1, -8, -3, -3, -6, -5, -5, -4, -1, 2, -14, -24, -19, 1, 21, 29,
+    19, -2, -24, -36, -29, -10, 5, 10, 19, 34, 40, 29, 12, -5, -21, -43, -64,
+    -69, -52, -21, 7, 21, 23, 18, 12, 8, 1, -6, -2, 9, 14, 14, 15, 16, 8, -4,
+    -6, -5, -4, 0, -2, -6, 3, 6, 0, -2, -3, -5, -5, 3, -15, -26, -18, 5, 30, 37,
+    22, -3, -27, -41, -30, -2, 22, 32, 40, 48, 43, 22, -2, -24, -48, -75, -94,
+    -88, -53, -7, 29, 42, 38, 23, 8, -1, -8, -11, -1, 16, 25, 29, 32, 28, 10,
+    -11, -17, -16, -18, -10, -7, -4, 10, 14, 9, 7, 5, -1, -5, 4, -17, -29, -21,
+    5, 36, 45, 27, -1, -29, -45, -31, 8, 44, 64, 75, 78, 61, 26, -8, -38, -73,
+    -108, -127, -112, -63, -1, 45, 62, 53, 27, 3, -11, -19, -16, 2, 24, 39, 45,
+    48, 38, 12, -19, -30, -31, -33, -21, -12, -4, 14, 19, 14, 14, 13, 4, -4, 18,
+    28, 33, 30, 24, 18, 13, 17, 7, -12, -22, -9, 14, 18, -6, -38, -48, -25, 1,
+    -3, -27, -42, -34, -21, -18, -25, -28, -20, -8, 14, 43, 46, 25, 0, -12, -17,
+    -29, -49, -65, -70, -50, 0, 42, 53, 58, 70, 77, 54, 54, 64, 65, 57, 65, 35,
+    12, 55, -10, 0, 6, 7, 6, 6, 8, 14, 9, -5, -15, -4, 19, 27, 9, -15, -19, 5,
+    30, 27, 5, -8, -4, 1, -6, -18, -21, -15, -11, 0, 19, 22, 7, -9, -12, -10,
+    -17, -34, -53, -73, -75, -42, -17, -21, -25, -15, 6, 3, 12, 26, 23, 5, 5,
+    -20, -37, 0, -20, -8, 5, 13, 22, 28, 28, 25, 17, 11, 4, 8, 24, 29, 14, -7,
+    -9, 17, 42, 43, 25, 12, 16, 16, -2, -19, -21, -15, -13, -4, 11, 15, 7, -2,
+    2, 10, 3, -17, -41, -71, -89, -69, -48, -55, -66, -57, -27, -17, -8, -2,
+    -13, -30, -27, -50, -62, -28, -45, -39, -19, 3, 22, 29, 24, 12, 5, 7, 6, 10,
+    22, 20, -1, -25, -33, -13, 14, 20, 8, -4, 3, 6, -15, -34, -32, -20, -14, -3,
+    9, 14, 12, 9, 15, 25, 17, -8, -35, -74, -105, -94, -70, -68, -75, -59, -11,
+    4, 1, -6, -27, -35, -11, -22, -29, 8, -1, -41, -57, -48, -35, -34, -47, -58,
+    -58, -44, -32, -13, 12, 15, -11, -49, -69, -53, -18, -1, -6, -13, -4, 4, -8,
+    -17, -7, 7, 14, 16, 14, 11, 11, 9, 14, 28, 29, 14, -7, -54, -96, -89, -54,
+    -30, -14, 29, 103, 127, 112, 98, 74, 70, 111, 105, 91, 123, -30, -14, -3,
+    -2, -3, 3, 13, 15, 9, 1, -2, 8, 22, 27, 22, 16, 10, 4, -2, -4, -1, 0, -3,
+    -6, -7, -10, -16, -17, -12, -11, -7, 0, 0, 0, 8, 21, 33, 42, 53, 47, 31, 5,
+    -31, -57, -73, -87, -90, -49, -5, 24, 64, 62, 23, 11, 5, -29, -24, -11, -3,
+    -5, -7, -4, 4, 5, -1, -11, -16, -7, 7, 16, 16, 12, 7, 0, -7, -7, 0, 1, -3,
+    -9, -13, -17, -21, -21, -16, -15, -10, -2, 0, 1, 5, 12, 17, 20, 27, 20, 8,
+    -10, -31, -44, -48, -48, -43, -8, 23, 34, 51, 40, 2, -7, -10, -39, -10, -1,
+    3, 0, -3, -1, 4, 6, -2, -15, -24, -17, -1, 10, 14, 11, 4, -6, -13, -7, 8,
+    14, 8, -2, -10, -14, -15, -12, -8, -7, -3, 4, 5, 4, 3, 4, 2, 0, 2, -5, -15,
+    -24, -31, -30, -18, 0, 19, 46, 56, 43, 36, 12, -23, -28, -29, -54, -5, 3, 5,
+    2, 1, 4, 10, 12, 4, -13, -28, -26, -13, 0, 7, 7, -2, -19, -28, -18, 4, 16,
+    13, 2, -7, -9, -6, 0, 5, 5, 4, 7, 5, 1, -3, -4, -7, -11, -13, -21, -28, -32,
+    -34, -24, -1, 37, 72, 94, 84, 48, 21, -12, -39, -37, -37, -63, 1, 8, 8, 4,
+    3, 8, 14, 18, 10, -8, -26, -29, -19, -5, 6, 8, -1, -18, -27, -13, 15, 34,
+    32, 19, 9, 6, 7, 11, 13, 10, 5, 2, -1, -4, -7, -5, -4, -9, -16, -26, -32,
+    -34, -32, -19, 11, 60, 107, 127, 104, 52, 8, -28, -46, -32, -33, -61, 44,
+    21, -2, -17, -23, -24, -19, -7, 2, 2, 0, 7, 14, 16, 21, 24, 19, 12, 9, 5, 2,
+    4, 7, 5, 1, 1, 1, -3, -8, -17, -24, -29, -41, -57, -70, -77, -70, -52, -18,
+    7, 23, 36, 66, 68, 59, 43, 29, 16, -5, -26, -44, -63, -67, -59, -52, -33,
+    22, 4, -12, -20, -19, -14, -11, -7, -2, 0, 0, 6, 8, 5, 4, 5, 3, 1, 4, 6, 5,
+    7, 9, 5, 4, 4, 2, -1, 1, -1, -4, -7, -18, -29, -32, -26, -13, 2, 27, 39, 43,
+    44, 60, 56, 41, 23, 7, -7, -17, -24, -28, -28, -25, -27, -22, 9, 5, -11,
+    -23, -25, -20, -11, -9, -13, -11, -6, -2, 4, 4, -3, -9, -8, -5, -4, -3, -3,
+    -4, -1, 1, -2, -1, -1, -6, -11, -7, -6, -9, -10, -16, -24, -23, -12, 3, 18,
+    38, 41, 42, 36, 39, 32, 16, 0, -10, -17, -16, -14, -10, 4, 15, 9, 11, 46,
+    12, -8, -22, -24, -13, 0, 3, -4, -7, -3, 2, 5, 3, -7, -16, -13, -2, 6, 8, 5,
+    -3, -5, -8, -11, -7, -5, -10, -12, -4, -1, -5, -4, -2, -2, 1, 12, 31, 43,
+    49, 35, 23, 4, -6, -16, -26, -32, -27, -19, 0, 8, 16, 36, 51, 45, 45, 80,
+    41, 12, -13, -20, -10, 5, 13, 7, 2, 3, 6, 7, 2, -12, -21, -13, 9, 25, 29,
+    22, 8, -3, -12, -15, -8, -3, -6, -4, 10, 15, 10, 14, 28, 40, 52, 67, 87, 93,
+    71, 21, -25, -73, -108, -126, -127, -114, -87, -58, -16, -1, 8, 34, 50, 49,
+    57, 98, -36, -25, -14, -10, -13, -12, -5, 0, 2, 0, -2, -4, -7, -7, 1, 8, 1,
+    -12, -16, -12, -10, -14, -21, -23, -15, -5, 1, 4, 12, 21, 24, 30, 34, 30,
+    24, 21, 14, 7, 8, 12, 12, 4, 0, -2, -3, 2, 3, 3, 4, 2, -20, -25, -14, -2, 1,
+    2, -9, -3, 2, 2, -2, -1, 8, 15, 16, 10, 6, 6, 4, 1, 6, 10, 4, -6, -3, 6, 7,
+    0, -7, -6, 4, 15, 18, 16, 18, 24, 23, 23, 23, 19, 14, 9, 2, -3, -1, 4, 8, 9,
+    16, 24, 31, 37, 42, 38, 28, 25, 9, 1, 2, 8, 5, 3, 14, 13, 8, 2, -5, -5, 5,
+    15, 15, 9, 5, 5, 4, 3, 7, 12, 4, -5, 0, 10, 10, 2, -4, 0, 12, 20, 19, 13,
+    10, 11, 7, 1, -3, -9, -15, -19, -24, -28, -27, -24, -18, -11, 1, 18, 31, 40,
+    50, 51, 42, 43, 34, 25, 21, 17, 6, 0, 40, 34, 18, -1, -17, -23, -15, -2, 1,
+    -2, -1, 3, 5, 8, 16, 20, 8, -3, 2, 13, 12, 3, -1, 4, 13, 14, 6, -4, -11,
+    -14, -21, -31, -40, -49, -58, -64, -68, -71, -73, -72, -66, -58, -45, -26,
+    -12, -3, 12, 26, 29, 41, 43, 36, 28, 16, -4, -18, 44, 46, 32, 8, -17, -36,
+    -38, -30, -25, -22, -14, -6, -3, 2, 15, 22, 10, -2, 4, 18, 18, 6, 1, 5, 7,
+    -2, -20, -34, -42, -46, -54, -65, -78, -92, -105, -116, -121, -124, -127,
+    -127, -123, -116, -103, -84, -73, -67, -51, -27, -7, 19, 29, 24, 16, 0, -26,
+    -47, 2, 36, 69, 84, 81, 63, 43, 30, 30, 34, 28, 11, -12, -27, -22, -14, -20,
+    -34, -44, -50, -52, -46, -37, -27, -12, -1, -7, -24, -26, -2, 24, 32, 18,
+    -7, -26, -39, -53, -60, -51, -18, 0, 0, -5, -10, -11, -8, -8, 1, 2, 4, 9,
+    -12, -31, -28, -21, -28, 0, 31, 60, 72, 65, 46, 27, 16, 19, 24, 22, 9, -12,
+    -29, -28, -21, -20, -24, -26, -30, -36, -36, -27, -16, -3, 3, -5, -20, -20,
+    0, 18, 21, 8, -13, -26, -33, -43, -51, -47, -19, 2, 9, 7, 2, 3, 9, 6, 6, 1,
+    1, 8, -2, -8, -4, 1, -2, -7, 20, 43, 50, 41, 21, 2, -4, 5, 14, 14, 6, -10,
+    -24, -24, -15, -13, -15, -15, -19, -28, -29, -17, 1, 14, 15, 2, -11, -11, 5,
+    16, 17, 9, -6, -12, -14, -25, -41, -48, -29, -8, 4, 6, 1, 1, 10, 5, 0, -5,
+    -8, -2, 3, 16, 27, 30, 25, -10, 15, 34, 38, 27, 5, -16, -20, -9, -1, 0, -3,
+    -11, -15, -7, 7, 11, 8, 9, 5, -5, -7, 6, 25, 35, 28, 11, -1, 1, 15, 25, 32,
+    36, 35, 41, 42, 25, -5, -33, -35, -26, -17, -15, -21, -21, -7, -12, -17,
+    -15, -13, 1, 24, 54, 67, 65, 55, -37, -3, 24, 34, 28, 5, -19, -26, -19, -16,
+    -17, -15, -17, -12, 6, 22, 25, 19, 21, 23, 17, 14, 21, 33, 36, 23, 7, 3, 12,
+    29, 43, 59, 81, 99, 119, 127, 103, 55, 0, -33, -50, -59, -70, -79, -75, -55,
+    -61, -59, -44, -30, -4, 36, 81, 94, 89, 76, -10, -6, -1, 2, 4, 4, 3, 0, 1,
+    6, 7, 0, -9, -12, -5, 8, 14, 6, -6, -7, -1, 4, 6, 6, 3, -2, -4, 0, 2, 3, 0,
+    -5, -5, -3, 0, 3, 0, 2, 8, -2, -2, 8, 7, -5, -11, 2, 12, -2, -36, -28, 14,
+    16, -7, -12, -38, -92, -9, -7, -5, -3, 0, 1, 0, -2, -1, 4, 8, 4, -3, -9, -7,
+    3, 9, 4, -4, -4, 0, 1, 1, 2, 2, -1, -1, 1, 1, 2, 2, -1, -1, 0, 1, 4, 0, 0,
+    4, -5, -7, 6, 7, -3, -10, 3, 14, 4, -26, -19, 20, 17, -4, -5, -33, -89, -2,
+    -2, -3, -3, -1, 1, 2, 1, 1, 4, 9, 7, 0, -8, -9, -2, 6, 5, 0, 0, 3, 1, -1, 0,
+    0, -1, -1, 0, -1, 1, 3, 2, 2, 2, 1, 6, 3, 1, 3, -8, -12, 3, 8, -1, -10, 3,
+    17, 7, -21, -12, 27, 21, 0, 0, -34, -94, 2, -2, -5, -7, -5, -2, 1, 0, -1, 2,
+    7, 6, -1, -11, -14, -7, 3, 3, -3, -3, 2, 2, 1, 0, -1, -2, 0, 1, -3, -1, 2,
+    2, 1, 0, 2, 10, 9, 5, 7, -4, -8, 6, 10, -1, -10, 2, 13, -2, -30, -12, 35,
+    31, 6, 1, -44, -110, 13, 6, -1, -6, -5, -1, 2, 2, 1, 6, 12, 10, 1, -9, -10,
+    -1, 7, 4, -6, -5, 4, 8, 7, 3, -2, -4, -1, 2, -1, 1, 3, 2, -2, -4, -2, 6, 5,
+    -1, 0, -10, -11, 4, 11, 1, -6, 5, 11, -10, -39, -10, 50, 48, 16, 2, -54,
+    -127, 46, 45, 40, 25, 11, -6, -30, -55, -72, -80, -67, -26, 15, 25, 2, -27,
+    -26, 15, 48, 29, -30, -77, -70, -6, 62, 92, 93, 83, 66, 44, 22, 5, -8, -17,
+    -19, -16, -10, -7, -4, 2, 8, 5, -2, 0, 0, 0, -5, -3, 16, 17, -8, -9, 3, 15,
+    54, 127, 44, 45, 43, 29, 14, -1, -20, -37, -48, -57, -48, -11, 27, 34, 10,
+    -22, -24, 16, 53, 35, -27, -81, -86, -35, 25, 52, 55, 49, 36, 17, -1, -11,
+    -19, -25, -24, -21, -14, -8, -3, 6, 13, 10, 1, -1, -5, -15, -27, -26, -8,
+    -5, -21, -14, -3, 2, 29, 87, 39, 41, 40, 26, 11, -2, -17, -26, -33, -42,
+    -33, 5, 41, 47, 21, -15, -21, 22, 64, 47, -18, -83, -99, -57, -2, 26, 30,
+    27, 16, 0, -13, -14, -16, -19, -18, -18, -15, -8, -1, 10, 20, 16, 5, -1, -8,
+    -20, -30, -26, -10, -13, -28, -16, -6, -12, -1, 41, 23, 24, 20, 3, -17, -32,
+    -46, -51, -52, -53, -32, 19, 63, 67, 34, -11, -19, 30, 79, 61, -13, -86,
+    -105, -60, 0, 29, 31, 25, 15, 3, -5, -3, -2, -5, -9, -15, -19, -16, -12, -5,
+    4, 4, -5, -11, -14, -15, -14, -5, 6, -4, -24, -12, -4, -20, -22, 9, 47, 36,
+    21, -6, -39, -65, -83, -88, -85, -75, -36, 32, 88, 96, 55, -1, -14, 43, 100,
+    81, -4, -88, -108, -54, 15, 44, 38, 20, 3, -8, -9, -4, -2, -7, -15, -25,
+    -32, -31, -32, -31, -23, -17, -13, -10, -3, 10, 23, 33, 38, 25, 2, 9, 14,
+    -13, -25, 0, -21, -5, 2, 2, 2, 1, 1, 2, 2, 1, 1, 1, 4, 3, 1, 2, 5, 1, -2, 0,
+    4, 8, 8, 4, -3, -3, 2, 6, 5, 3, 0, -4, -4, -1, -1, -6, -6, -1, 5, 6, 4, 1,
+    3, 8, 10, 12, 15, 16, 19, 25, 30, 30, 26, 26, 34, 37, -12, 0, 3, 3, 2, -1,
+    -2, 0, 0, 0, 0, -2, -1, 0, -1, 2, 4, 0, -4, -3, 0, 3, 5, 3, -2, -2, 2, 4, 2,
+    1, 1, 1, 2, 3, 1, -4, -7, -4, 0, 2, 0, -4, -4, -2, 0, 2, 2, 0, -4, -6, -11,
+    -18, -22, -17, -8, -10, -6, 1, 2, 3, 3, -1, -1, 1, 0, 0, 0, -2, -3, -2, -1,
+    2, 3, -1, -5, -4, -2, 1, 3, 1, -3, -1, 2, 3, -1, -3, 0, 3, 5, 6, 4, -2, -7,
+    -6, -2, 2, 2, -1, -3, -4, -4, -4, -7, -14, -23, -33, -45, -57, -65, -60,
+    -54, -60, -1, 3, 0, 1, 1, -2, -2, 0, 1, 1, 2, -1, -3, -3, -2, 1, 3, 1, -2,
+    -1, 0, 1, 3, 0, -2, 0, 3, 4, 0, -2, 2, 6, 7, 9, 7, 1, -4, -6, -2, 3, 4, 1,
+    -3, -5, -6, -8, -15, -27, -39, -52, -67, -82, -91, -91, -91, -100, 5, 9, 6,
+    6, 7, 2, 3, 4, 3, 3, 3, 1, -2, -2, -1, 2, 3, 2, 1, 3, 3, 2, 2, -1, -3, 0, 5,
+    6, 4, 4, 8, 9, 8, 8, 6, -1, -8, -12, -10, -4, -1, -4, -10, -13, -14, -17,
+    -27, -40, -53, -68, -84, -98, -108, -111, -115, -127, -126, -120, -127,
+    -119, -127, -119, -126, -120, -126, -120, -125, -121, -124, -122, -124,
+    -122, -124, -122, -124, -122, -124, -123, -123, -123, -123, -124, -122,
+    -124, -123, -123, -123, -123, -123, -123, -123, -123, -123, -123, -123,
+    -124, -122, -124, -123, -123, -123, -122, -124, -122, -124, -123, -123,
+    -123, -123, -123, -123, -123, -120, -127, -119, -127, -119, -127, -119,
+    -127, -120, -126, -121, -125, -122, -124, -122, -124, -122, -124, -122,
+    -124, -122, -124, -123, -123, -124, -122, -124, -122, -124, -123, -123,
+    -123, -123, -123, -123, -123, -123, -123, -124, -122, -124, -122, -123,
+    -123, -123, -124, -122, -124, -122, -123, -123, -123, -123, -123, -123,
+    -123, -127, -119, -127, -119, -127, -119, -127, -119, -126, -120, -125,
+    -121, -124, -122, -124, -122, -124, -122, -124, -122, -124, -122, -123,
+    -123, -122, -124, -122, -124, -122, -123, -123, -123, -123, -123, -123,
+    -123, -123, -123, -123, -124, -122, -124, -123, -123, -123, -122, -124,
+    -122, -124, -123, -123, -123, -123, -123, -123, -123, -120, -127, -119,
+    -127, -119, -127, -119, -127, -120, -126, -121, -125, -122, -124, -122,
+    -124, -122, -124, -122, -124, -122, -124, -123, -123, -124, -122, -124,
+    -122, -124, -123, -123, -123, -123, -123, -123, -123, -123, -123, -124,
+    -122, -124, -122, -123, -123, -123, -124, -122, -124, -122, -123, -123,
+    -123, -123, -123, -123, -123, -126, -120, -127, -119, -127, -119, -126,
+    -120, -126, -120, -125, -121, -124, -122, -124, -122, -124, -122, -124,
+    -122, -124, -123, -123, -123, -123, -124, -122, -124, -123, -123, -123,
+    -123, -123, -123, -123, -123, -123, -123, -123, -124, -122, -124, -123,
+    -123, -123, -122, -124, -122, -124, -123, -123, -123, -123, -123, -123,
+    -123, 15, -4, -27, -46, -52, -43, -18, 14, 33, 31, 21, 8, -8, -33, -64, -86,
+    -78, -40, 7, 49, 74, 77, 73, 66, 52, 28, -7, -54, -103, -127, -118, -86,
+    -42, -2, 15, 22, 27, 27, 28, 29, 19, 14, 10, 9, 2, -6, 2, -4, -9, -6, -10,
+    -11, -4, -4, 0, 36, 33, 12, -13, -34, -44, -36, -14, 18, 39, 39, 25, 8, -8,
+    -26, -47, -59, -47, -14, 24, 53, 64, 55, 39, 20, -2, -23, -45, -71, -96,
+    -99, -76, -36, 9, 39, 43, 39, 39, 34, 26, 21, 10, 6, 6, 4, -7, -18, -13,
+    -17, -16, -9, -12, -10, 3, -3, -9, 18, 41, 17, -10, -34, -43, -37, -17, 11,
+    33, 34, 18, -5, -25, -38, -49, -47, -24, 11, 39, 54, 53, 36, 12, -16, -40,
+    -55, -63, -69, -72, -60, -29, 13, 51, 62, 44, 27, 24, 17, 9, 4, -3, 2, 9, 8,
+    -5, -21, -22, -23, -17, -4, -8, -4, 17, 8, -9, 5, 49, 20, -14, -39, -47,
+    -38, -16, 14, 38, 40, 20, -10, -34, -46, -48, -34, -4, 31, 55, 62, 53, 29,
+    -3, -34, -56, -59, -49, -37, -25, -6, 24, 58, 79, 64, 24, -2, -5, -6, -9,
+    -10, -13, 0, 15, 14, -3, -23, -30, -29, -18, -1, -4, 3, 33, 26, 2, 3, 55,
+    14, -31, -62, -67, -49, -18, 19, 47, 48, 19, -19, -47, -56, -46, -16, 24,
+    61, 81, 84, 68, 35, -7, -46, -65, -55, -23, 11, 37, 56, 73, 89, 90, 56, 3,
+    -27, -29, -23, -19, -20, -20, -4, 13, 8, -17, -42, -47, -38, -23, -4, -5, 5,
+    43, 43, 14, 7, -43, -39, -26, -8, 12, 27, 37, 47, 54, 55, 50, 43, 31, 14, 1,
+    1, 15, 31, 36, 32, 20, 6, 1, 5, 6, -5, -18, -21, -17, -7, 3, 0, -11, -21,
+    -25, -14, -3, 3, 11, 4, -6, -7, -8, -12, -11, -7, -8, -10, -15, -19, -27,
+    -31, -12, 13, 10, -4, -56, -51, -38, -20, -1, 16, 29, 39, 46, 46, 41, 36,
+    28, 16, 7, 7, 19, 33, 39, 38, 27, 8, -3, 1, 4, -2, -11, -13, -9, -2, 4, -1,
+    -13, -20, -20, -4, 11, 18, 22, 13, 1, 1, 1, -4, -9, -11, -12, -15, -20, -19,
+    -22, -26, -10, 14, 12, -1, -76, -71, -57, -38, -16, 3, 19, 29, 34, 33, 29,
+    28, 26, 20, 15, 14, 19, 28, 33, 35, 26, 4, -13, -12, -5, -5, -8, -9, -8, -4,
+    -1, -8, -22, -30, -25, -3, 18, 28, 31, 22, 11, 12, 9, 0, -11, -17, -16, -18,
+    -22, -14, -10, -13, -3, 14, 10, -2, -103, -96, -83, -62, -36, -13, 6, 16,
+    21, 19, 15, 16, 18, 18, 16, 15, 16, 20, 25, 30, 25, 2, -17, -17, -8, -2, -1,
+    -3, -5, -6, -7, -17, -35, -43, -32, -4, 24, 41, 49, 42, 32, 32, 25, 9, -9,
+    -19, -14, -12, -13, -1, 10, 10, 15, 21, 10, -2, -127, -119, -105, -84, -57,
+    -31, -12, -1, 4, 3, 0, 1, 7, 12, 16, 16, 16, 18, 24, 33, 32, 13, -6, -6, 4,
+    10, 10, 4, -5, -12, -16, -30, -49, -55, -40, -4, 32, 58, 71, 66, 57, 54, 44,
+    21, -7, -22, -15, -9, -6, 11, 26, 29, 32, 30, 15, 3, -14, -12, -13, -16,
+    -14, -7, 1, 3, 1, 1, 5, 4, 1, 0, -3, -4, -1, -1, -1, 2, 6, 7, 5, 0, -5, -5,
+    1, 6, 8, 7, 4, -2, -2, 4, 5, 3, 5, 2, -3, 0, 0, 1, 2, -3, -9, -11, -3, -1,
+    7, 7, 14, 18, 4, -1, -8, -21, -2, 0, 0, -2, 0, 3, 5, 5, 1, 1, 5, 5, 2, 2, 0,
+    0, 2, 0, -1, 3, 7, 9, 8, 5, 4, 4, 3, 0, -1, 0, 0, -3, -4, -1, 1, 2, 5, 2,
+    -3, 0, -3, -4, 0, 1, 1, 4, 5, 1, 9, 15, 25, 30, 26, 28, 28, 20, 6, 5, 2, 0,
+    2, 3, 3, 3, 1, 1, 3, 3, 2, 2, 0, 0, 3, 3, 1, 3, 5, 5, 3, -1, 0, 1, -2, -6,
+    -6, -3, 0, -2, -5, -4, -3, -1, 2, 0, -4, -3, -4, -5, -2, 1, 4, 8, 5, -1, 4,
+    7, 12, 16, 14, 28, 40, 36, 18, 13, 2, -5, -4, -3, -2, -1, 0, 0, 0, -2, -2,
+    0, -2, -5, -2, -1, -1, 0, 0, 0, -2, -6, -6, -4, -7, -8, -3, 3, 5, 0, -6, -6,
+    -4, -1, 2, 0, -4, -3, -1, -1, 3, 6, 8, 7, -3, -11, -14, -24, -33, -39, -46,
+    -26, -5, -6, 6, 9, -1, -9, -10, -9, -3, 1, 2, 2, 0, -6, -7, -3, -3, -7, -6,
+    -3, -3, -2, -1, 1, 1, -2, -2, 0, -2, 0, 7, 12, 12, 7, 2, 3, 7, 10, 11, 6,
+    -1, 1, 6, 9, 13, 14, 10, -1, -20, -35, -49, -75, -99, -115, -127, -103, -81,
+    -82, -61, -69, -74, -66, -39, -3, 23, 26, 13, 5, 6, 8, 2, -1, 4, 16, 28, 24,
+    8, -7, -15, -12, -7, -12, -12, 2, 19, 31, 40, 46, 36, 19, 5, -7, -2, 5, 4,
+    -2, -12, -17, -16, -27, -32, -20, -16, -4, -3, 11, 26, 23, 21, 28, 28, 33,
+    29, 16, -56, -65, -72, -66, -41, -7, 14, 12, -4, -12, -10, -8, -12, -10, -2,
+    5, 9, 3, -4, -7, -6, -2, -5, -16, -21, -12, -2, 3, 13, 26, 22, 9, -3, -14,
+    -6, 8, 12, 8, 2, 1, 7, 1, -3, 7, 5, 11, 11, 16, 22, 20, 20, 24, 22, 26, 28,
+    20, -23, -39, -52, -51, -30, 1, 17, 7, -11, -16, -11, -8, -9, -2, 7, 9, 2,
+    -9, -11, 0, 13, 19, 10, -7, -16, -11, -7, -9, -2, 12, 11, 1, -12, -26, -16,
+    4, 15, 16, 12, 9, 14, 8, 3, 11, 8, 13, 12, 14, 15, 14, 13, 12, 7, 11, 17,
+    13, 26, -3, -28, -34, -16, 13, 26, 13, -6, -10, -2, 2, 5, 19, 30, 26, 6,
+    -17, -20, 1, 29, 43, 31, 7, -7, -7, -8, -14, -10, 2, 0, -10, -24, -41, -32,
+    -9, 7, 14, 14, 9, 12, 0, -8, -2, -6, -1, -2, -1, 3, 9, 7, 0, -9, -7, -4,
+    -14, 127, 65, 6, -23, -19, 3, 13, 0, -18, -16, -4, 4, 12, 32, 48, 41, 12,
+    -23, -30, 1, 47, 73, 60, 28, 8, 6, 8, 5, 13, 25, 18, 6, -14, -38, -31, -5,
+    16, 31, 38, 32, 28, 6, -12, -9, -12, -6, -8, -2, 10, 28, 28, 10, -4, -10,
+    -19, -44, 4, 13, 25, 34, 40, 41, 28, 10, -3, -7, -2, -2, -8, -12, -14, -6,
+    13, 23, 10, -11, -23, -18, -8, -4, -3, 3, 12, 17, 9, -4, -12, -14, -7, 1, 5,
+    14, 11, 15, 37, 21, -12, 3, 43, 34, -21, -14, 27, 44, 25, -13, -54, -100,
+    -88, -34, -5, -24, -23, -17, -10, -2, 6, 11, 7, -3, -11, -13, -10, -10, -13,
+    -14, -15, -12, 3, 10, -2, -20, -28, -19, -6, -2, -2, 1, 4, 6, 3, -4, -8, -8,
+    -4, -3, -3, 8, 4, 1, 19, 9, -19, -5, 31, 21, -36, -28, 20, 46, 32, -7, -51,
+    -97, -87, -37, -15, -42, -33, -30, -27, -21, -11, -1, 5, 7, 5, 3, 2, -4, -6,
+    -3, -3, -3, 8, 13, 0, -19, -24, -8, 10, 16, 13, 8, 2, -3, -3, -4, -3, -1, 0,
+    -5, -7, 10, 9, 0, 14, 9, -11, 3, 34, 16, -52, -44, 18, 57, 48, 5, -43, -92,
+    -84, -39, -29, -69, -36, -33, -31, -28, -18, -5, 8, 17, 19, 17, 12, 2, -1,
+    8, 14, 12, 14, 10, -10, -28, -25, 0, 24, 30, 26, 15, -1, -12, -12, -7, -1,
+    2, 4, -3, -3, 19, 19, 0, 6, 8, -3, 18, 47, 15, -70, -65, 17, 74, 69, 20,
+    -37, -91, -85, -42, -46, -101, -45, -37, -32, -26, -17, -3, 13, 26, 31, 29,
+    21, 7, 5, 21, 36, 34, 24, 5, -21, -34, -20, 15, 42, 46, 36, 20, 0, -12, -9,
+    0, 7, 11, 13, 7, 6, 27, 22, -8, -12, -4, 0, 32, 64, 24, -71, -69, 30, 104,
+    100, 42, -26, -87, -82, -40, -56, -127, 9, 15, 22, 26, 29, 24, 17, 14, 17,
+    16, 11, 5, -1, -3, 0, -1, -3, -3, -3, -3, -5, -3, 2, 3, 1, 1, 5, 14, 26, 31,
+    27, 20, 13, 7, 2, 3, 6, 11, 14, 23, 34, 38, 43, 41, 30, 24, 21, 17, 10, 5,
+    2, 5, -1, -6, 1, 8, -4, 1, 6, 9, 10, 6, -1, -2, 2, 2, 0, -1, -1, 1, 4, 4, 2,
+    2, 4, 3, 1, 2, 6, 6, 1, -2, -1, 5, 12, 14, 8, -2, -12, -21, -28, -29, -26,
+    -20, -16, -9, -3, -2, 4, 4, -1, -1, 1, 1, -2, -4, -5, -6, -14, -15, -10, -9,
+    -11, -7, -4, -2, -1, -5, -12, -13, -7, -4, -2, -1, 0, 2, 6, 7, 6, 7, 7, 6,
+    3, 4, 9, 8, 2, -4, -8, -8, -5, -5, -13, -25, -39, -53, -64, -68, -66, -59,
+    -53, -45, -40, -37, -29, -23, -19, -13, -8, -6, -6, -3, -2, -3, -8, -10, -9,
+    -14, -11, -7, -4, -2, -2, -8, -16, -18, -11, -4, 1, 3, 0, -1, 3, 5, 4, 2, 1,
+    -1, -1, 4, 9, 7, -2, -12, -20, -22, -21, -23, -30, -44, -60, -78, -94, -102,
+    -102, -96, -87, -78, -70, -64, -52, -36, -21, -9, -2, -2, -4, 2, 7, 8, 8, 6,
+    1, -9, -3, 0, 4, 7, 7, 1, -10, -14, -8, 1, 8, 9, 1, -6, -5, -2, -3, -6, -10,
+    -11, -7, 1, 8, 5, -7, -21, -31, -35, -35, -36, -42, -55, -73, -94, -113,
+    -125, -127, -120, -110, -99, -91, -82, -67, -44, -20, -1, 8, 7, 2, 9, 16,
+    20, 24, 22, 11, -3, 14, 15, 14, 7, -1, -9, -16, -24, -32, -44, -57, -68,
+    -78, -83, -81, -69, -51, -33, -17, -3, 8, 18, 28, 33, 31, 20, 3, -12, -22,
+    -27, -30, -34, -42, -47, -42, -34, -29, -25, -22, -21, -17, -11, -9, -5, 0,
+    14, 35, 24, -4, -18, -15, -17, -14, -21, -59, -106, 23, 22, 19, 11, -2, -15,
+    -26, -35, -44, -56, -67, -77, -84, -88, -87, -77, -64, -50, -34, -20, -8, 2,
+    12, 20, 21, 14, 3, -7, -13, -15, -15, -14, -17, -19, -16, -12, -11, -9, -6,
+    -4, -1, 3, 2, 7, 15, 29, 46, 31, 3, -14, -13, -14, -14, -20, -52, -96, 39,
+    38, 32, 20, 1, -19, -36, -50, -62, -75, -85, -91, -95, -99, -98, -91, -81,
+    -69, -55, -39, -26, -13, -1, 9, 15, 14, 8, 0, -6, -7, -5, -1, 1, 2, 5, 5, 0,
+    0, 5, 7, 10, 12, 11, 15, 23, 35, 45, 28, 2, -14, -14, -15, -18, -24, -51,
+    -93, 64, 63, 56, 38, 11, -17, -41, -61, -78, -93, -102, -106, -109, -113,
+    -113, -108, -100, -89, -73, -55, -39, -24, -9, 6, 17, 21, 18, 10, 2, -4, -4,
+    -1, 2, 7, 12, 11, 5, 5, 13, 17, 21, 23, 22, 23, 25, 32, 35, 16, -7, -21,
+    -22, -22, -28, -34, -60, -101, 101, 98, 89, 67, 33, -3, -35, -62, -85, -104,
+    -114, -118, -121, -126, -127, -122, -114, -102, -84, -63, -44, -25, -5, 13,
+    28, 36, 35, 24, 7, -9, -16, -17, -14, -7, 0, 2, -3, -1, 13, 20, 24, 27, 25,
+    22, 20, 21, 19, 0, -22, -34, -32, -32, -39, -48, -74, -113, 58, 78, 102,
+    119, 127, 116, 104, 94, 88, 75, 71, 78, 77, 58, 39, 33, 32, 36, 28, -4, -33,
+    -44, -38, -16, 9, 20, 12, -15, -46, -62, -58, -44, -29, -16, -11, -4, 10,
+    30, 35, 18, 31, 37, 6, 2, 3, -19, -24, -19, -26, -19, -15, 1, 22, 18, 29,
+    58, -2, 25, 51, 62, 57, 39, 25, 16, 13, 8, 10, 15, 3, -26, -43, -36, -19,
+    -3, 0, -19, -37, -43, -39, -26, -12, -9, -19, -37, -51, -52, -37, -19, -6,
+    4, 5, 4, 4, 11, 11, -12, -11, -9, -27, -19, -6, -11, -9, -3, -6, 1, 3, 10,
+    18, 21, 29, 34, -77, -49, -26, -22, -34, -51, -60, -62, -62, -67, -61, -51,
+    -60, -88, -100, -83, -58, -37, -26, -33, -38, -35, -29, -26, -26, -29, -35,
+    -37, -29, -14, 6, 16, 19, 22, 15, 1, -14, -14, -12, -32, -39, -36, -39, -21,
+    -5, 1, 11, 17, 14, 20, 23, 15, 9, 18, 19, -3, -95, -78, -61, -59, -68, -75,
+    -71, -61, -55, -55, -47, -34, -41, -66, -72, -47, -23, -11, -9, -18, -20,
+    -8, 2, 0, -10, -19, -15, 3, 31, 53, 62, 52, 32, 21, 9, -8, -22, -18, -13,
+    -29, -38, -33, -27, -10, -1, 4, 16, 20, 18, 26, 32, 11, -14, -6, -5, -43,
+    22, 1, -5, -11, -17, -10, 11, 36, 53, 57, 60, 63, 49, 19, 15, 46, 74, 84,
+    79, 60, 49, 60, 72, 70, 56, 40, 36, 51, 72, 81, 67, 33, 1, -8, -9, -10, -5,
+    13, 22, 7, -3, 2, 16, 29, 18, 2, 7, 8, 6, 14, 15, -18, -56, -42, -33, -75,
+    18, -5, -33, -51, -50, -35, -15, 5, 22, 35, 41, 38, 39, 38, 19, -12, -32,
+    -41, -43, -42, -29, 12, 60, 85, 85, 72, 60, 54, 53, 46, 25, -10, -52, -85,
+    -103, -94, -64, -34, -15, -3, 17, 33, 17, -9, -18, -31, -38, -31, 0, 18, 8,
+    9, 1, -7, 29, 66, 20, -3, -30, -50, -50, -36, -19, -3, 10, 19, 19, 14, 18,
+    30, 24, 0, -22, -34, -42, -50, -49, -21, 21, 43, 41, 33, 29, 36, 48, 52, 40,
+    12, -25, -59, -81, -73, -49, -29, -18, -12, 9, 28, 16, -5, -10, -18, -29,
+    -28, -3, 13, 5, 9, 5, 0, 31, 63, 27, 6, -22, -41, -42, -30, -15, 0, 11, 16,
+    9, -3, 2, 27, 40, 30, 11, -9, -28, -49, -62, -46, -12, 8, 8, 4, 10, 27, 48,
+    57, 51, 26, -6, -37, -57, -49, -30, -19, -18, -17, 1, 18, 8, -8, -6, -3,
+    -11, -16, -6, 3, -5, 1, 5, 4, 28, 53, 33, 13, -14, -34, -37, -27, -15, 1,
+    14, 18, 7, -10, -3, 36, 71, 78, 60, 28, -10, -46, -69, -58, -25, -3, -2, -6,
+    3, 26, 53, 66, 61, 36, 0, -32, -51, -43, -29, -25, -28, -31, -17, 1, -3, -6,
+    6, 19, 18, 7, -2, -7, -22, -18, -8, -3, 15, 32, 53, 34, 7, -15, -20, -13,
+    -3, 9, 21, 26, 14, -2, 9, 59, 110, 127, 103, 51, -9, -56, -75, -55, -13, 15,
+    16, 9, 19, 50, 88, 108, 103, 70, 23, -23, -52, -52, -48, -49, -51, -50, -34,
+    -12, -5, 9, 37, 58, 58, 41, 9, -12, -36, -36, -24, -16, -2, 9, 41, 38, 35,
+    32, 31, 28, 26, 29, 38, 38, 22, -3, -24, -33, -32, -27, -23, -13, 15, 58,
+    86, 76, 35, -11, -46, -69, -77, -71, -52, -22, 4, 16, 37, 66, 93, 121, 127,
+    110, 97, 84, 52, 32, 32, 26, 3, -32, -47, -50, -48, -33, -31, -36, -32, -20,
+    -31, -46, 35, 33, 28, 22, 18, 15, 12, 11, 17, 16, 3, -16, -28, -29, -24,
+    -20, -23, -23, -5, 27, 53, 52, 29, 0, -26, -44, -51, -47, -34, -14, -1, 0,
+    6, 18, 28, 47, 55, 45, 43, 45, 27, 18, 27, 30, 24, 7, -3, -4, -8, -4, -8,
+    -21, -30, -15, -19, -30, 26, 22, 16, 5, -2, -6, -10, -11, -6, -6, -19, -33,
+    -34, -22, -11, -11, -23, -35, -31, -8, 19, 31, 27, 15, 1, -11, -18, -18,
+    -14, -5, -1, -10, -16, -23, -31, -24, -16, -18, -13, -2, -5, -1, 12, 16, 24,
+    27, 28, 34, 30, 27, 13, -4, -16, -3, -4, -11, 23, 17, 5, -9, -19, -24, -27,
+    -27, -22, -22, -32, -39, -29, -6, 8, -1, -28, -56, -68, -52, -21, 12, 35,
+    41, 34, 23, 14, 6, -1, -1, -2, -15, -32, -50, -69, -72, -69, -65, -52, -33,
+    -28, -17, -2, -2, 9, 24, 37, 56, 58, 52, 31, 15, 6, 12, 8, 0, 52, 41, 22, 2,
+    -11, -18, -23, -23, -17, -15, -21, -22, -5, 24, 37, 15, -32, -81, -106, -94,
+    -51, 5, 53, 77, 75, 63, 49, 34, 15, 4, -4, -22, -45, -72, -95, -105, -106,
+    -101, -80, -54, -44, -29, -14, -19, -14, 0, 17, 44, 55, 51, 28, 17, 17, 15,
+    6, 0, 6, 4, 1, -1, 0, 13, 25, 24, 9, -1, -2, -10, -18, -16, -5, 8, 9, 1, -3,
+    2, 13, 19, 15, 16, 30, 48, 55, 53, 41, 18, -9, -28, -37, -38, -38, -38, -23,
+    2, 21, 26, 25, 22, 20, 21, 27, 24, 16, 7, -3, -10, -9, -4, -9, -10, -7, -16,
+    -7, -9, -11, -11, -7, 7, 20, 22, 9, -1, -2, -6, -15, -16, -8, 3, 5, -2, -6,
+    -4, 2, 3, -1, 3, 22, 44, 53, 46, 26, -1, -29, -43, -42, -33, -25, -21, -7,
+    12, 25, 26, 20, 12, 7, 4, 7, 6, 4, -1, -8, -10, -10, -9, -13, -11, -10, -24,
+    -16, -18, -18, -16, -10, 5, 19, 21, 9, 1, 4, 3, -4, -9, -6, 0, 0, -5, -6,
+    -4, -4, -8, -12, -2, 21, 46, 54, 40, 11, -23, -51, -58, -47, -27, -11, -2,
+    8, 20, 29, 29, 21, 8, 1, -3, -3, -6, -4, -3, -5, -2, -1, -3, -7, -4, -7,
+    -26, -25, -25, -23, -21, -15, -1, 15, 20, 11, 6, 13, 17, 12, 6, 4, 4, -2,
+    -7, -3, 2, -1, -9, -9, 9, 40, 68, 72, 49, 8, -33, -65, -69, -53, -29, -10,
+    0, 7, 15, 23, 28, 25, 12, 4, 2, -6, -16, -14, -8, -5, 2, 5, 1, -4, -3, -7,
+    -27, -37, -34, -31, -28, -22, -8, 12, 21, 17, 15, 25, 33, 30, 23, 16, 8, -6,
+    -15, -7, 5, 6, 2, 9, 42, 88, 124, 127, 94, 39, -16, -59, -71, -59, -41, -24,
+    -15, -10, -4, 6, 20, 26, 17, 11, 10, -9, -31, -31, -21, -17, -11, -9, -11,
+    -16, -14, -16, -34, 9, 19, 21, 11, -6, -20, -20, -19, -20, -24, -32, -40,
+    -40, -32, -26, -19, -9, 10, 37, 60, 70, 69, 65, 64, 58, 35, -4, -39, -55,
+    -52, -46, -42, -37, -22, -6, 8, 21, 35, 50, 45, 35, 10, -13, -17, -14, -16,
+    -15, -7, 11, 17, -1, -10, 7, 36, 32, -14, 18, 26, 25, 15, -2, -15, -14, -10,
+    -9, -12, -19, -29, -32, -30, -30, -35, -39, -30, -5, 24, 43, 50, 50, 51, 50,
+    33, 1, -27, -38, -35, -33, -35, -33, -21, -12, -3, 6, 15, 24, 19, 11, -8,
+    -23, -20, -15, -18, -17, -12, 3, 15, 9, 3, 12, 33, 24, -24, 36, 41, 37, 25,
+    9, 1, 5, 13, 16, 16, 10, -2, -8, -11, -21, -40, -58, -60, -39, -6, 22, 36,
+    40, 43, 45, 38, 16, -4, -12, -12, -17, -26, -27, -16, -8, -1, 7, 10, 9, 0,
+    -8, -23, -31, -24, -17, -25, -24, -18, 0, 20, 26, 20, 18, 29, 13, -36, 43,
+    47, 40, 24, 6, -2, 9, 24, 32, 35, 31, 20, 12, 4, -14, -44, -75, -86, -70,
+    -35, -2, 20, 30, 35, 41, 39, 24, 12, 9, 11, 2, -13, -17, -5, 5, 15, 23, 17,
+    4, -10, -19, -28, -30, -20, -17, -31, -32, -22, 2, 29, 39, 27, 14, 16, -1,
+    -51, 43, 50, 42, 21, -4, -15, -4, 17, 30, 34, 30, 19, 9, -5, -31, -70, -108,
+    -127, -116, -81, -41, -8, 12, 24, 35, 36, 26, 19, 21, 25, 16, -2, -9, 1, 10,
+    21, 27, 16, -5, -21, -30, -39, -37, -26, -27, -50, -57, -43, -12, 17, 27, 9,
+    -15, -16, -27, -73, -127, -106, -82, -61, -51, -60, -74, -76, -56, -31, -20,
+    -19, -14, -7, 1, 11, 34, 64, 83, 89, 95, 95, 75, 29, -26, -66, -85, -87,
+    -76, -62, -55, -49, -41, -28, -4, 19, 25, 22, 11, -8, -12, 0, -4, -33, -51,
+    -28, -8, 5, 19, 29, 34, 64, 82, 52, 33, 25, -95, -74, -47, -23, -11, -18,
+    -31, -32, -17, 1, 6, 3, 0, -2, 2, 15, 39, 63, 68, 62, 65, 74, 68, 37, -7,
+    -41, -56, -55, -44, -35, -32, -29, -24, -16, 1, 18, 20, 16, 4, -19, -27,
+    -12, -9, -26, -39, -21, -7, 2, 6, 9, 14, 36, 48, 31, 16, 9, -67, -42, -10,
+    18, 33, 26, 15, 14, 24, 31, 28, 20, 8, -2, -1, 15, 42, 60, 50, 29, 25, 40,
+    52, 43, 17, -11, -29, -33, -25, -17, -14, -10, -6, -1, 10, 18, 14, 6, -6,
+    -25, -34, -25, -21, -26, -26, -7, 1, 1, 1, 2, 7, 18, 19, 6, -1, -3, -56,
+    -25, 12, 43, 59, 52, 39, 35, 37, 35, 27, 18, 3, -14, -16, 1, 34, 54, 37, 4,
+    -10, 5, 30, 41, 33, 13, -6, -15, -14, -9, -3, 4, 8, 9, 15, 19, 14, 4, -10,
+    -27, -37, -37, -36, -29, -13, 12, 14, 5, 2, 1, 7, 13, 2, -14, -13, -7, -75,
+    -36, 9, 44, 61, 55, 39, 29, 28, 24, 16, 7, -7, -23, -22, 5, 47, 73, 55, 14,
+    -13, -6, 21, 44, 49, 38, 22, 9, 4, 6, 13, 19, 20, 21, 27, 35, 33, 21, 4,
+    -10, -19, -28, -38, -29, -9, 14, 6, -13, -14, -14, -7, -2, -20, -39, -28,
+    -11, 22, -8, -44, -65, -65, -46, -15, 6, 13, 22, 32, 31, 21, 21, 35, 60, 85,
+    85, 46, -15, -74, -99, -88, -60, -29, -12, -17, -33, -40, -32, -13, 3, 22,
+    30, 15, 3, 2, -1, -2, 12, 16, 8, 1, 6, 5, -7, -8, -4, -2, 7, 17, 12, 8, 18,
+    8, -25, 40, 9, -29, -53, -56, -39, -14, 0, 1, 6, 16, 16, 7, 4, 14, 35, 60,
+    74, 64, 32, -15, -50, -56, -41, -14, 6, 5, -9, -18, -16, -6, -2, 6, 9, -2,
+    -9, -10, -12, -13, 0, 5, -1, -7, -4, -5, -12, -11, -5, -5, 1, 13, 4, -5, 8,
+    3, -25, 61, 27, -15, -42, -46, -31, -11, -4, -7, -5, 4, 5, -5, -11, -7, 4,
+    22, 44, 65, 71, 46, 9, -23, -34, -20, 1, 9, 3, -4, -8, -9, -13, -11, -5, -7,
+    -6, -7, -12, -14, -4, 1, -3, -9, -8, -12, -14, -11, -2, -3, 2, 11, 1, -11,
+    4, 3, -23, 95, 55, 7, -26, -34, -23, -7, -3, -10, -10, -2, -3, -16, -28,
+    -34, -38, -37, -15, 34, 83, 99, 75, 28, -11, -18, -5, 8, 9, 5, -2, -9, -15,
+    -12, 0, 6, 10, 7, -4, -12, -4, 3, 2, 1, 3, -1, -1, -1, 2, -4, 3, 11, 0, -12,
+    3, 2, -27, 125, 79, 23, -15, -28, -20, -8, -9, -21, -26, -25, -34, -54, -73,
+    -88, -108, -127, -114, -49, 44, 110, 119, 74, 18, -9, -5, 12, 26, 31, 24,
+    15, 8, 12, 25, 29, 26, 15, -5, -20, -16, -7, -6, -3, 4, 2, -2, -7, -11, -20,
+    -6, 6, -6, -22, -8, -11, -43, -31, -12, 11, 24, 25, 19, 15, 19, 27, 28, 25,
+    25, 30, 34, 36, 30, 13, -7, -18, -22, -23, -20, -12, -4, 8, 22, 26, 13, -9,
+    -25, -30, -21, -7, 5, 10, 8, 8, 16, 22, 23, 16, 2, -9, -12, -13, -17, -13,
+    -6, -1, 12, 24, 26, 38, 34, 36, 59, -28, -10, 10, 22, 22, 16, 14, 17, 22,
+    20, 14, 12, 13, 17, 22, 21, 8, -6, -11, -11, -10, -7, -3, 5, 15, 25, 28, 18,
+    1, -9, -11, 0, 13, 22, 23, 16, 10, 15, 21, 27, 27, 21, 17, 16, 8, -2, 0, 1,
+    -4, -1, 9, 12, 24, 22, 24, 46, -23, -6, 11, 20, 18, 11, 6, 5, 2, -5, -14,
+    -20, -23, -19, -10, -3, -4, -5, -1, 3, 3, -1, -5, -5, 0, 6, 8, 2, -7, -12,
+    -10, 1, 13, 20, 20, 10, 0, -1, 3, 11, 16, 16, 18, 22, 15, 5, 7, 5, -6, -11,
+    -10, -11, 1, 1, 3, 19, -13, 4, 22, 28, 24, 12, 0, -11, -25, -43, -59, -69,
+    -74, -70, -55, -36, -21, -5, 12, 21, 17, 2, -17, -28, -30, -27, -25, -28,
+    -33, -33, -29, -19, -7, 1, 3, -5, -16, -21, -22, -17, -12, -12, -8, -1, 0,
+    1, 10, 10, 1, -5, -9, -18, -11, -11, -18, -14, -28, -3, 21, 32, 28, 14, -5,
+    -25, -51, -81, -106, -121, -127, -122, -101, -71, -40, -8, 21, 36, 28, 0,
+    -32, -53, -59, -57, -55, -57, -59, -56, -51, -40, -28, -17, -12, -20, -30,
+    -36, -40, -37, -35, -39, -39, -31, -20, -5, 12, 19, 21, 23, 21, 4, 1, -8,
+    -27, -37, -33, -20, -4, 12, 20, 19, 16, 12, 9, 4, -1, -5, -9, -9, -8, -3, 4,
+    4, 0, -6, -14, -14, -5, -1, 2, 8, 13, 16, 16, 10, 8, 8, 9, 11, 13, 11, 12,
+    16, 15, 3, -2, -4, -14, -18, -21, -16, -9, -4, -6, -15, -13, -9, -14, -7,
+    -5, -13, -28, -16, 2, 17, 24, 22, 18, 15, 14, 11, 7, 4, 2, 3, 3, 4, 8, 11,
+    11, 9, 2, 2, 6, 4, 0, 0, 1, -1, -4, -7, -3, 0, 3, 4, 5, 4, 5, 6, 5, -4, -6,
+    -2, -2, 1, 0, 3, 2, 2, 2, -1, 3, 5, -2, 1, 3, -5, -33, -26, -12, 1, 7, 8, 7,
+    9, 14, 16, 15, 12, 11, 13, 8, 3, 7, 12, 16, 16, 11, 10, 12, 9, 4, 2, 1, -3,
+    -7, -9, -4, 2, 7, 5, 2, 1, -2, -6, -7, -13, -12, -3, 4, 13, 13, 15, 11, 10,
+    8, 9, 17, 16, 8, 11, 13, 4, -36, -42, -42, -37, -33, -30, -27, -20, -12, -3,
+    0, -2, -2, -2, -9, -16, -12, -4, 2, 3, -2, -4, -4, -8, -12, -12, -9, -10,
+    -13, -14, -9, -3, 0, -8, -17, -20, -22, -26, -25, -24, -19, -9, 4, 15, 14,
+    13, 7, 4, 1, 0, 10, 5, -4, 5, 13, 2, 127, 70, 21, -10, -29, -36, -34, -27,
+    -18, -7, 0, 0, -1, 1, -4, -8, -4, 1, 3, 0, -6, -7, -7, -11, -13, -8, 1, 4,
+    4, 0, 0, 5, 6, -6, -15, -13, -7, -1, 12, 20, 24, 30, 35, 35, 22, 11, -1, -4,
+    -10, -11, -1, -8, -18, -5, 6, -7, -57, -47, -28, -3, 21, 29, 24, 15, 11, 14,
+    21, 29, 30, 21, 16, 28, 51, 62, 55, 41, 31, 19, -2, -31, -54, -57, -41, -19,
+    -3, 6, 10, 9, 3, 2, 6, 6, 1, 5, 16, 16, 25, 24, 11, 2, -1, -10, -9, -3, 3,
+    17, 16, 13, 11, -1, -12, -10, -52, -42, -24, -1, 20, 28, 22, 10, 3, 3, 8,
+    13, 12, 1, -6, 3, 21, 28, 20, 8, -2, -15, -35, -60, -77, -76, -57, -31, -9,
+    3, 7, 4, -2, -4, -1, -2, -8, -7, 0, -3, 4, 6, 1, 2, 3, -5, -3, 2, 3, 13, 12,
+    10, 10, 5, -2, 1, -41, -31, -16, 4, 23, 31, 24, 12, 3, 1, 4, 7, 3, -9, -17,
+    -12, 0, 1, -11, -25, -37, -50, -69, -89, -100, -94, -71, -39, -11, 6, 11, 7,
+    0, -2, 0, -1, -6, -8, -5, -9, -5, -2, 0, 7, 10, 1, 3, 7, -1, 4, 5, 5, 9, 11,
+    9, 13, -31, -24, -10, 8, 26, 34, 29, 17, 7, 5, 9, 12, 6, -10, -22, -20, -13,
+    -16, -32, -50, -64, -79, -96, -111, -118, -108, -80, -43, -7, 16, 23, 17, 8,
+    5, 6, 5, 2, -1, -1, -5, -3, -2, 1, 8, 9, -2, 0, 5, -8, -6, -3, 0, 8, 17, 17,
+    24, -15, -10, 1, 18, 35, 45, 43, 31, 21, 20, 25, 28, 18, -2, -18, -18, -13,
+    -19, -39, -61, -80, -96, -112, -124, -127, -113, -80, -37, 4, 31, 40, 34,
+    24, 18, 17, 16, 15, 11, 9, 6, 7, 6, 6, 7, 3, -11, -7, 1, -12, -12, -6, -2,
+    10, 24, 24, 33, -16, -19, -23, -28, -33, -33, -25, -10, -3, -2, 2, 5, 2, -2,
+    -4, 2, 15, 33, 51, 64, 66, 48, 15, -17, -37, -35, -19, -3, 0, -13, -30, -43,
+    -49, -37, -16, -3, 10, 25, 22, 14, 4, 2, -8, -6, -4, -7, 2, 10, -5, -12, -7,
+    -5, -3, 0, -1, -5, -2, -5, -10, -17, -23, -24, -18, -5, 2, 2, 5, 6, 3, 4, 9,
+    14, 18, 21, 25, 32, 37, 32, 18, -4, -25, -31, -21, -6, 5, 3, -3, -12, -19,
+    -14, -6, -3, 4, 17, 17, 13, 8, 8, -2, -2, 1, -1, 5, 7, -4, -5, -1, -2, -3,
+    -2, 0, -4, 3, 1, -3, -12, -19, -22, -17, -5, 1, 2, 2, 1, -1, 6, 19, 26, 20,
+    7, -4, -6, 2, 16, 24, 16, -6, -25, -30, -22, -8, 0, 4, 1, -4, -2, -2, -5, 0,
+    11, 14, 13, 10, 11, -2, -3, 1, -3, -2, 1, -3, -1, 2, -1, -4, -1, 5, -1, 25,
+    22, 17, 6, -5, -11, -9, 1, 7, 7, 3, -2, -4, 3, 17, 25, 12, -15, -42, -54,
+    -42, -6, 36, 54, 38, 7, -18, -29, -24, -13, -2, 3, 2, 5, 3, -3, -2, 4, 8, 8,
+    8, 8, -1, -1, 5, -2, -7, -3, -1, 1, 2, 1, 0, 1, 7, -7, 67, 61, 53, 39, 21,
+    11, 12, 18, 17, 5, -12, -29, -39, -39, -31, -28, -45, -79, -112, -127, -105,
+    -42, 39, 95, 99, 66, 25, -3, -9, -3, 9, 17, 19, 20, 12, -4, -13, -13, -7,
+    -2, -1, -2, -7, 1, 14, 8, -2, -3, 2, 6, 7, 8, 5, 2, 2, -20, -31, -18, -2,
+    15, 33, 47, 47, 27, 11, 14, 22, 15, -5, -20, -22, 2, 34, 38, 17, -10, -30,
+    -20, 0, -4, -14, -14, -19, -40, -68, -82, -75, -45, -8, 26, 55, 63, 52, 34,
+    14, -7, -4, -7, -15, -10, -5, -7, -7, -8, 1, -2, -9, -8, 0, -4, -4, 3, -29,
+    -24, -20, -12, 2, 19, 27, 15, 4, 9, 16, 10, -3, -10, -8, 9, 31, 35, 24, 8,
+    -6, 4, 26, 28, 24, 28, 26, 9, -20, -47, -65, -61, -44, -20, 7, 22, 25, 20,
+    9, -3, 1, 1, -3, 1, 1, -5, -5, -2, 8, 5, 6, 3, 4, 1, -1, -2, -8, -14, -23,
+    -26, -19, -3, 7, 2, -4, 5, 14, 8, -3, -2, 4, 14, 22, 19, 13, 7, 2, 14, 35,
+    41, 44, 51, 57, 54, 34, -1, -41, -66, -72, -59, -31, -7, 10, 17, 16, 10, 10,
+    4, 3, 6, 1, -6, -1, 1, 4, 0, 5, 6, 4, 3, -1, -8, 31, 14, -8, -23, -23, -12,
+    -4, -10, -13, 2, 16, 12, 2, 5, 15, 15, 6, -9, -18, -14, -7, 7, 19, 18, 17,
+    28, 50, 75, 80, 54, 7, -35, -61, -65, -46, -24, -1, 14, 16, 13, 10, 0, 3, 8,
+    0, -6, 5, 3, -3, -7, 1, 2, -3, -1, -7, -20, 44, 19, -14, -37, -41, -33, -28,
+    -32, -33, -14, 2, -4, -19, -15, -5, -11, -34, -63, -75, -66, -50, -38, -45,
+    -70, -83, -67, -17, 55, 115, 127, 96, 48, 5, -22, -26, -20, -6, 7, 12, 9, 2,
+    -10, -2, 12, 8, 3, 16, 13, 0, 2, 14, 8, -8, -9, -18, -35};
+
+static const float kDense1WeightScales[kDense1Units] = {6.443772e-03f,
+    4.778055e-03f, 8.574087e-03f, 3.596764e-03f, 5.913402e-03f, 6.314543e-03f,
+    4.185843e-03f, 7.313181e-03f, 4.258882e-03f, 3.428000e-03f, 6.009134e-03f,
+    6.215441e-03f, 4.477575e-03f, 2.851898e-03f, 6.651630e-03f, 5.669283e-03f,
+    8.727772e-03f, 4.319126e-03f, 6.622898e-03f, 4.523346e-03f, 4.574087e-03f,
+    3.768102e-03f, 4.184961e-03f, 4.745669e-05f, 6.422567e-03f, 6.226945e-03f,
+    2.654331e-05f, 3.592063e-03f, 4.857409e-03f, 5.949921e-03f, 4.454874e-03f,
+    5.121205e-03f, 5.228071e-03f, 5.200118e-03f, 7.198898e-03f, 4.235921e-03f,
+    1.522706e-02f, 6.319693e-03f, 8.142339e-03f, 6.897417e-03f, 1.299481e-02f,
+    6.484606e-03f, 5.227945e-03f, 2.172441e-05f, 3.445110e-03f, 8.147551e-03f,
+    8.729614e-03f, 6.131071e-03f, 3.517937e-03f, 8.793244e-03f, 5.982142e-03f,
+    4.883882e-03f, 6.480425e-03f, 4.889614e-03f, 4.445457e-03f, 4.361354e-03f,
+    4.140150e-03f, 4.405669e-03f, 8.880457e-03f, 7.061685e-03f, 1.780315e-05f,
+    5.259283e-03f, 7.889764e-06f, 3.451717e-03f, 3.064291e-03f, 3.682669e-03f,
+    5.014291e-03f, 6.375417e-03f, 3.251268e-03f, 5.564543e-03f, 6.195441e-03f,
+    5.849079e-03f, 4.511307e-03f, 1.124457e-02f, 3.869843e-03f, 1.499937e-02f,
+    1.967717e-05f, 4.457465e-03f, 6.016102e-03f, 1.137716e-02f, 6.076969e-03f,
+    4.451598e-03f, 9.812567e-03f, 4.409622e-03f, 3.399276e-03f, 3.976764e-03f,
+    4.076386e-03f, 6.302252e-03f, 4.839677e-03f, 4.378866e-03f, 5.167677e-03f,
+    6.294654e-03f, 9.366976e-03f, 7.107992e-03f, 7.358047e-03f, 5.848307e-03f};
+
+static const int8_t kDense2WeightsInt8[kDense1Units * kDense2Units] = {1, -9,
+    -11, 4, -1, -15, 17, -2, -2, -7, -24, -12, -10, 0, -15, -11, -87, 5, -18,
+    -4, -1, -2, 1, 0, 0, 34, 0, -24, -56, 16, -1, 53, 0, -106, 3, 1, 1, 52, -1,
+    -85, 0, -7, 1, 0, 4, -1, 25, -15, 1, 60, -18, 1, 1, -31, -25, 0, -3, -18,
+    127, 22, 0, 30, 0, -2, -20, 35, -1, 50, 1, 9, -31, -20, 6, 24, -2, -52, 0,
+    -14, -19, 0, 0, 32, 1, -9, -2, -7, 4, 3, 2, 0, -80, 1, 14, 98, 33, 0, 5, 11,
+    -4, 41, 1, 6, 46, 15, -48, -3, 53, -51, -33, 35, 44, -51, -29, 4, 1, 36, 50,
+    36, 39, 28, 38, -26, 72, -36, 6, -3, 0, 8, 13, -22, 25, -37, 10, -39, -71,
+    -13, 27, -29, 6, -14, -44, -39, 51, -29, -56, -53, -7, 2, 42, -15, -43, 3,
+    -59, 5, -39, 64, -37, 12, -44, -34, -18, 25, 28, 6, -53, -37, 56, -10, -50,
+    6, 19, -91, -1, -26, -1, -25, 39, 30, -22, -30, 7, 79, 65, -127, 4, -54,
+    -22, -50, -42, 58, 30, 12, 0, -1, -1, 8, 5, 6, -11, 18, -4, 8, -5, 0, -5,
+    -5, 1, 11, 13, 10, 0, -25, -4, 17, -9, 0, 0, 10, 0, 24, 8, -9, -9, 0, -40,
+    5, 1, -29, 21, -1, 121, 1, -10, -5, 4, 0, -2, 60, 17, -127, 18, 1, 0, -1, 0,
+    0, -5, 1, 13, 0, 0, 1, 0, 0, 0, 6, -19, 0, 3, -2, -31, 2, 0, 46, 0, -1, 12,
+    0, 0, -1, 0, 0, -26, 1, 0, 21, 0, 2, -1, -1, -2, -2, 4, 15, -74, 8, 14, 1,
+    58, 0, -50, -85, -3, 127, -80, 27, 5, -34, 37, -19, -2, 1, -31, -2, 0, 2,
+    -53, 0, -82, -13, -29, 0, -5, -2, 0, 0, -8, 4, -2, -1, -4, -1, 3, -26, -1,
+    51, 1, 0, -18, 12, 73, 0, -3, 2, 31, 6, 3, 2, 58, 5, 16, 0, -20, -2, 0, 1,
+    89, 25, 0, -2, 0, 14, -31, -34, 4, 21, -10, -30, -3, 74, -9, 0, 0, 35, 0,
+    15, -16, 4, 0, -3, 61, -15, -6, -2, 2, 0, 2, 3, -2, -44, 1, -6, 1, -4, -24,
+    13, 16, 12, 20, 27, 14, 18, 61, 74, 60, 57, -54, -116, 4, 71, 75, 42, -5,
+    114, -33, -57, -47, 0, 59, 66, 0, 2, -84, -13, 2, 1, 1, -23, -15, -33, 1,
+    35, 2, 10, 0, -95, 31, 0, -11, -1, -1, -15, 12, -64, 87, 82, -2, 26, 0, -2,
+    0, 31, 26, -13, 0, 127, 0, 40, 7, 1, 1, -21, -11, 4, -63, -1, -51, 1, -49,
+    2, 0, 2, -73, 0, 6, 20, -2, -1, 1, -14, -80, 0, -6, -16, -32, 3, 0, 3, 4,
+    -5, 4, -19, 1, -3, -44, -21, -1, 1, 74, -10, 6, 28, -109, 15, -53, -3, -2,
+    6, -30, -2, -6, -45, 41, 0, 3, -24, 0, -8, -15, 54, 35, 1, 64, -18, -15, 20,
+    55, 1, -19, -82, 1, -35, -20, 0, 1, 57, 22, 39, -47, -38, 1, -71, 10, -89,
+    -2, 25, -2, 31, -59, -127, 0, 1, 0, 6, -49, -90, -2, -37, -50, 14, 1, -53,
+    -9, 2, -62, 1, 0, -1, -19, 0, 0, -2, -25, -2, -59, 0, -2, 6, -27, 11, -78,
+    -48, -19, 1, -21, -2, 0, 65, -1, -17, 2, 64, -20, 2, 42, 26, -20, 7, -2, 42,
+    9, -65, -98, -66, 6, 2, -20, 0, 11, 0, -93, 35, 0, -44, 15, -10, 48, -2, 3,
+    46, -17, 0, -2, -1, -43, 5, -9, 59, -5, 0, 0, -89, 1, 6, -17, 21, -2, -2,
+    -27, -53, 31, -23, 0, 42, 0, 28, 0, -54, 0, 20, -2, 8, 27, 71, 47, -24, 0,
+    26, -108, -30, -41, -2, 0, 0, -30, -1, 1, -5, 127, -39, 40, 44, 39, 84, -8,
+    1, -21, -62, -1, 61, 34, -98, -16, 1, -48, -2, 14, -10, 26, -82, 1, -6, -80,
+    -24, 17, -4, -35, -6, 0, -7, -8, -17, 5, 5, 5, 0, 7, -1, 0, 0, -127, 12,
+    -30, -46, -12, 2, -7, -2, 1, -41, -17, 1, -1, -4, 14, 0, 1, -4, -14, -13,
+    -6, -34, 22, 22, 0, 4, -1, -47, 3, -1, 0, 10, 0, 0, 0, 17, 0, 12, -6, 19,
+    -1, -30, 18, -3, 15, -25, -39, 1, 0, -3, -25, 0, 0, -11, 1, -8, 0, -1, 20,
+    -2, -32, -3, -22, 3, -66, 46, -58, -1, -21, 2, 10, -3, 11, 8, -16, 49, -21,
+    -37, -1, -26, -1, -19, -127, 34, 110, 26, 0, 27, 9, 15, -69, 0, 22, 0, 0,
+    19, 0, -25, 0, -11, 4, 8, 36, -1, 2, -2, 73, 8, -3, -1, 2, 0, -18, -7, 32,
+    -1, 1, -1, 4, 14, 2, 15, -16, 9, -9, 4, 0, 1, 0, 18, 0, 2, -13, -13, 12, 0,
+    20, 6, -4, 9, 4, 48, -16, 1, 0, 23, 0, 0, -2, 45, 0, 3, -1, 1, 0, -18, 12,
+    5, 31, 31, 0, 0, 0, 47, 16, -20, -3, -11, -54, 20, -9, 2, -5, 2, 4, 7, 1,
+    -49, -2, -8, -39, 42, -12, 127, -29, 0, -1, 0, 14, 1, 0, 47, -3, -50, 62,
+    -1, 2, -20, -12, 9, 43, 32, -103, 23, 2, 2, -86, 0, 11, 23, 0, -118, -57,
+    15, -7, 12, 123, -33, -6, 75, 1, 23, -33, -21, 0, 28, 0, 16, -6, -10, -6,
+    -27, 0, 51, -112, -31, -34, 12, 24, 0, 0, -7, 2, 0, 16, 0, -2, -2, 0, 60,
+    -37, -6, -18, -13, -3, -84, 0, -52, 116, 1, -30, 1, 93, 21, -51, -84, 3,
+    -15, 21, 51, -36, 15, 5, 0, 7, 34, 1, -1, 79, -10, 14, -1, -32, 0, 99, -46,
+    0, 3, 4, 63, -11, -14, -2, 0, 72, -38, -1, -127, -3, 0, 5, 51, -45, 0, -4,
+    -18, -17, 19, -28, -1, -17, -67, 81, -30, 0, -2, -1, 1, 0, 2, 0, 0, 0, -48,
+    -3, -55, 42, 21, -88, -7, 87, -36, 1, -42, 1, 0, 0, 1, -11, 0, -7, -9, -1,
+    -8, 5, 8, -22, 0, -13, 61, -18, -38, 33, 18, -5, 61, 0, 0, -14, 22, -101,
+    34, 1, 77, 12, -76, -2, 14, 9, -127, 50, 15, -8, 3, -12, 29, -79, 3, -77, 0,
+    -95, -21, 0, 40, -9, -22, -16, 3, -1, 5, 3, 13, -1, -31, -79, 0, -107, 7,
+    -30, 0, 2, -1, -3, 101, -15, 14, 48, -38, 1, -8, -1, 2, 0, 1, -3, 1, 0, 6,
+    0, 33, 9, 3, 15, -2, 6, 2, -38, -83, -19, -4, 1, 62, 0, -1, -11, -48, -1,
+    -1, 100, 9, 64, 11, 2, -1, 6, 22, 1, -27, 25, 0, 2, -19, -13, 91, 28, -36,
+    0, 7, -6, -17, 6, -31, 3, -59, -1, 1, 39, -14, -59, -26, 76, 12, 2, -12, -1,
+    0, -69, 6, 0, -29, -45, 55, -76, -12, -127, 2, 2, 57, -1, 1, -31, 72, 3, 6,
+    -16, 0, -27, 0, 7, 106, 0, -14, 0, -13, -34, 1, 2, -11, 21, 28, -19, 7, 0,
+    -9, 0, 0, -42, -39, -23, -2, -11, -1, 30, 29, -12, 44, 2, -2, 0, 13, -49, 0,
+    62, 4, -1, -34, -1, -5, 11, 34, -23, 0, 0, 7, 1, -58, 0, 66, -12, -1, 0, -1,
+    -15, -48, 2, -34, -1, 16, -17, 2, 36, -7, 1, 4, 0, -31, 99, 0, -18, -25, 6,
+    0, 2, 1, 0, -5, 0, 1, -25, 63, -1, -127, 87, -15, 0, 63, -30, 16, 19, -1,
+    -8, 0, -38, -2, -6, 23, -29, 20, 20, -1, -5, 31, -1, -9, -1, -113, 10, 54,
+    0, -9, 0, 1, 2, -10, -8, -71, 6, 0, -1, -32, 23, 2, 78, -4, 0, -67, 1, 0,
+    -16, 4, 3, -17, 40, -13, 32, -61, -6, -2, -29, 31, -19, -3, 38, 0, -25, -27,
+    -2, 22, 16, -4, 0, -127, -49, 14, -1, -45, 10, -1, 0, 29, -85, 0, -15, -38,
+    0, -1, -5, 0, 39, -4, 0, 2, -1, -6, 15, -9, -6, -4, 35, -105, -58, 0, 40, 9,
+    19, -3, -1, 0, 0, 48, -13, 0, -3, -29, -13, -35, 0, 1, 6, 11, 3, -2, 14, -5,
+    0, -12, 0, -71, -16, 6, 2, -8, 0, 1, 0, 0, 0, -10, -15, -3, 0, 2, -8, 0, 1,
+    -26, -31, 28, -15, -1, -20, -29, -30, -17, 9, 1, -9, 1, 8, -9, 12, -72, 0,
+    4, -1, 0, -41, -35, 3, 21, -17, 4, -26, -2, 11, -1, 0, -27, -33, 18, -48, 3,
+    6, 0, 2, -127, 0, -7, -4, -34, -8, 15, 1, 1, -37, 3, 0, 10, 11, -1, -2, 0,
+    -1, 0, -27, -1, 0, -10, 1, -36, 0, -1, 0, 18, -2, 1, 16, -90, 9, 10, 0, 19,
+    0, 1, 0, 43, 1, 10, -1, 1, 0, -11, 0, 0, -4, 0, 0, 0, 14, 0, -4, -12, 5, -1,
+    -3, -4, -1, -51, 0, 3, -51, -14, -7, 57, -44, -5, 119, 5, -40, 51, 11, 81,
+    8, 13, 14, -47, -24, 2, -2, 0, 0, -1, -1, 38, -3, -7, 29, 27, -1, 0, -110,
+    32, 0, 7, 2, 52, -14, -39, 64, -12, -7, 26, -1, 127, -1, 87, -3, -17, -33,
+    0, 2, -87, 0, -4, -2, 57, 4, 2, -1, 2, -7, -2, -55, 49, 41, 64, 0, -28, 0,
+    26, 30, 25, -1, -22, 0, -2, 0, 3, 24, -39, 12, -1, 0, 53, -33, 1, 28, -5,
+    29, 20, -1, 0, 31, 22, 6, -49, 23, -3, 0, -53, 48, -17, -19, 25, -32, 14,
+    29, 10, -19, 40, 47, -56, 8, 35, -18, -30, 12, 22, 17, 73, 3, -13, 34, -28,
+    -1, -14, 4, 2, -48, 33, -11, 13, -25, -7, 23, -10, 61, -12, 20, 1, -22,
+    -124, 16, -83, -34, -41, -21, -12, -47, -62, -30, 21, -34, 16, -23, 23, -26,
+    24, -15, -3, -6, 46, -45, 21, -31, -11, 36, 41, 25, 19, 127, 27, 11, -24,
+    24, -20, 16, 39, 0, -18, 6, -48, 15, 18, 1, 34, 34, -15, -84, 23, -18, -11,
+    8, -1, 33, 40, 58, -20, 0, -7, -16, 7, -5, 25, 0, -1, 6, -19, -1, -6, 1, 1,
+    4, -8, -20, -6, -41, 40, 0, 24, 6, 0, -1, 2, 0, -1, -5, 22, 0, 19, 9, -9,
+    -27, 2, -15, 30, -71, -5, -11, -5, 2, 0, 2, -14, -16, 18, -1, 14, 5, -13,
+    -12, 0, 0, 5, -2, 18, -2, 0, 0, -1, 0, 0, -1, 6, 0, -3, 8, -9, 23, -15, 4,
+    12, 4, -77, 0, 1, 1, -127, 8, -2, 0, -1, 0, 1, -4, -3, 1, 1, -10, -1, -1, 1,
+    -59, -13, 4, 18, 10, 11, 5, -1, 1, 1, 0, -11, 2, -36, -8, 1, -20, 3, 0, 0,
+    1, 0, -20, -10, -4, 0, 14, -4, 0, -5, -13, -2, -6, 3, -18, 2, -9, -3, 0, 0,
+    63, 1, -21, 0, -6, 0, -13, -1, 17, 18, 1, 0, -39, 1, -4, 2, 0, 0, 0, -17,
+    36, 6, 0, -1, 0, 5, -11, -3, 0, 10, 1, 8, 1, 6, 7, 1, 1, 127, 0, 0, -4, 1,
+    -14, -1, 41, 5, 18, -12, -15, -4, 21, 11, 0, 31, 15, 0, 11, 1, 0, 1, -11,
+    -4, 2, 0, 23, 2, 37, -2, 33, 24, -2, 5, -4, 1, -59, -6, 4, -22, 3, -1, 2, 0,
+    0, 0, 0, 1, 10, 59, 16, 2, 21, -12, 6, 0, -62, 1, -30, -3, 8, 0, -14, 0, 3,
+    -1, 3, 5, 13, -42, 19, -62, 0, -1, 30, -1, -80, -5, 2, 1, 0, -31, 0, 5, 4,
+    2, 1, -1, -14, 6, 83, -1, 19, 0, 1, -1, 0, 0, 0, 1, 37, -14, -127, 18, -5,
+    -9, 11, -25, -1, 9, 1, 0, 54, 0, -19, -1, 37, -10, -7, 0, 36, 43, -4, 26, 9,
+    -2, 29, 20, -4, -1, 14, -18, 0, -5, -63, -17, 8, 8, 37, 0, -23, -46, 0, 25,
+    -63, -7, -25, -1, -46, 27, -61, 2, 1, 0, -1, 33, 2, 9, -7, 0, 31, -29, -127,
+    -4, -17, 1, -13, -1, 36, -4, -63, 44, 42, 5, 14, 4, 0, -13, 0, 25, -12, -2,
+    33, -14, 26, -2, 2, -4, 1, -1, -9, 1, 0, 15, -30, 1, 0, 0, 7, -1, -5, -2,
+    -14, -17, -26, -52, -13, 0, -9, 9, -28, -16, -3, -72, 0, 53, 17, 52, -5, -1,
+    -6, 5, 99, 7, -20, 4, 5, 3, 0, 1, -4, 0, 2, -85, 6, 0, 67, -24, 0, 13, 28,
+    -7, 1, 0, -10, -6, -6, 0, 0, -2, -12, -7, 2, 17, 2, 0, 2, -127, 1, 0, 17, 1,
+    18, -15, -1, -1, 0, -1, 1, 3, 0, -16, 0, -3, 0, -2, 4, -2, -36, 15, 0, 0,
+    -7, -57, -2, 6, -17, 0, 0, 54, 23, -1, 0, -4, -1, 28, 19, 1, 0, -55, -69,
+    -46, 0, -47, 3, -27, 5, -53, 17, -8, -59, 19, 23, -27, -2, -23, 8, -4, -26,
+    -11, 13, 4, 1, 11, 5, -44, -41, 0, -21, -3, 0, 0, -2, 1, 0, -2, 1, -7, -10,
+    0, 0, -9, -27, -33, 1, 41, 0, 0, 0, -5, 9, 0, -9, 0, 0, 0, 2, -3, -20, 8, 0,
+    -12, -5, 6, 0, -127, 81, -5, 0, -3, 0, 10, 21, -2, 0, 0, 0, 0, 1, 0, 0, -3,
+    1, -9, 0, 3, 1, 0, 0, 1, 1, -9, 0, 1, 1, -21, -1, -1, 0, 12, -7, 5, -3, -48,
+    10, 15, 0, 9, -13, -2, 7, -30, 2, -1, -1, 7, 0, -14, 23, 6, 22, -1, 0, -2,
+    0, -17, -1, 0, -28, -13, 0, 0, 24, -32, 1, 3, -1, 21, 8, 11, 1, -26, -1, 19,
+    32, 2, 17, 0, 0, 0, 21, 19, 5, 0, 18, 21, 0, 0, 0, -11, 0, -3, -3, 18, 0, 4,
+    0, 12, 8, -10, 46, 11, 0, -28, -17, 0, -29, -6, 3, 16, 0, 0, -4, 0, -28, -1,
+    -127, -2, 29, 6, 11, 6, 0, 6, 38, 12, 0, 0, 27, 1, -17, 39, 29, -28, 37, 11,
+    -63, 7, -37, -20, 117, 70, 24, 35, -21, 103, 34, -45, -75, 81, -88, 81, -18,
+    -36, -21, 13, -25, -101, -51, 87, -24, -2, -51, 8, -8, 3, -93, 25, -120, 0,
+    58, -6, 28, -92, 72, 41, -25, -15, -65, 14, -28, 9, 60, -54, 40, 60, 72,
+    -100, 50, 105, 69, -1, -12, -51, -18, 37, -17, 37, -50, 113, -43, -19, 88,
+    127, -43, -89, -48, -100, 95, 25, -32, 53, 62, 80, 0, -5, 0, -51, 10, -13,
+    -12, -29, -41, 24, -32, -47, -30, 120, -2, 92, 29, -3, -112, 79, 93, -54,
+    -106, 2, -101, 1, -24, 89, -2, -1, -15, 24, 37, 90, 2, 0, 6, -5, 0, 33, 50,
+    26, 17, -17, 48, -43, 0, -14, -8, 37, 5, -8, -13, 4, 5, 0, -5, 31, -25, 123,
+    35, -56, -9, 30, -5, 12, 23, 7, 2, 0, 4, -29, 0, -1, 0, 0, 107, 1, 2, 83,
+    113, 2, 43, -57, 1, -49, -2, 1, 0, -3, -19, 1, 127, -9, -1, -84, -28, -45,
+    -1, -39, -58, -3, -1, 7, 3, -26, -1, 22, -1, 0, 4, -5, -6, -11, 11, -4, 3,
+    19, 0, 9, -6, -14, 6, 11, -106, 7, -12, -49, -4, 0, 0, 0, 9, -14, 0, 0, -13,
+    7, -22, -13, 0, 6, -2, -5, 127, -3, -6, -12, -4, 15, 0, 0, -10, 72, 26, 3,
+    1, 0, 0, 0, 0, 0, 1, 5, -19, -5, 0, 0, 0, 2, 0, -18, 7, 5, -8, 1, -12, -7,
+    6, 4, 13, 0, 3, 0, 0, -3, -3, 66, -13, 1, 19, 0, -9, 9, 29, 3, 9, 9, 0, 0,
+    -20, 0, -19, 0, 69, 41, -99, -46, -110, 52, -24, -11, -50, -37, 67, -56,
+    -50, 24, -36, 0, 50, -68, 48, 43, -15, 20, -109, -8, -27, -1, -56, 23, -12,
+    0, 22, 9, -56, -3, 58, 0, -44, -21, -73, -20, 74, -2, 17, -21, -39, -38, -8,
+    -53, 21, 39, -25, -105, 44, 0, 21, 57, -56, 26, 37, 30, -47, 4, -12, 67,
+    -125, -71, -2, 19, 17, -11, -16, 29, -95, 51, -16, -21, -45, 1, -11, -4,
+    -18, -13, -39, -24, -1, -82, 46, 52, -41, 52, 48, 54, 13, 75, 127, 16, 47,
+    -25, -3, -2, 58, 41, -8, -1, -108, -1, 14, 0, -1, -58, 44, -2, 127, 3, -4,
+    -3, -40, -5, 0, 0, 1, 25, 0, -1, -14, -57, -51, -3, -11, 56, -1, 1, 1, 15,
+    94, -5, -1, 13, 36, 0, 2, -2, -84, -105, 39, -4, -23, 29, 0, 29, -29, 64,
+    42, 11, 39, 0, 0, 26, 0, -9, -2, 10, -70, 34, 45, -1, -124, 8, -1, -1, -5,
+    -1, 0, 32, 20, -1, 1, -16, -23, 6, -14, -1, -2, -13, -48, -23, -38, 15, 0,
+    2, -2, 3, -42, 3, 127, -2, -6, -41, -52, 5, 29, -42, -23, -19, -9, 18, -14,
+    1, 0, 30, 14, 0, 0, 0, -62, 0, 50, -88, 0, 52, 24, 2, -20, -17, 42, -3, 56,
+    -1, -49, -62, -116, 17, 0, 12, 0, 0, 0, 3, 0, 37, -9, 1, -32, 7, 0, 3, -7,
+    -3, -1, -42, 20, -1, 0, 39, 0, 64, -20, 2, 0, 1, 4, 13, -17, 2, 0, 4, -2, 1,
+    0, 5, -22, -84, -1, -8, -11, -8, -1, 16, 7, -4, 1, 43, 41, 2, 0, -2, 0, 109,
+    17, 54, -55, 9, 1, 48, 0, 20, -9, 15, 35, -28, -4, -92, 3, 1, 85, 21, -31,
+    45, -33, -2, 2, 0, -19, 1, 0, -18, -6, 1, 13, 10, -127, 2, -47, 1, 0, -1,
+    -7, 0, 0, 40, 26, 0, -14, 2, 73, 26, -4, 30, 10, 0, 2, 2, 8, 0, 33, 8, 0,
+    12, 0, 3, 0, -74, 11, 16, -9, 12, 60, -1, -10, -38, 18, 11, -39, -35, 0, 21,
+    -1, -1, 6, 0, 2, 23, -10, 17, -11, 49, -3, -1, -2, -66, -31, 6, -16, -20,
+    -3, 0, 37, -1, 13, 8, -23, 2, 28, 6, 1, -7, 1, -1, -11, -9, 127, 13, 21, 9,
+    13, 3, 11, 0, 3, 12, 0, -25, 5, 0, -1, 42, -1, 1, 63, -1, 1, 28, 40, -1, 1,
+    0, 7, 0, 1, -19, -23, 0, 1, -18, -10, 0, -8, 33, 0, -5, 12, -1, 1, 15, 0, 3,
+    0, 2, 1, 2, -2, 0, 1, -5, -3, -35, -30, -16, 30, 0, 0, -2, 0, -3, 1, -23, 1,
+    -24, -8, -21, -21, 20, -22, -26, -51, -10, 0, 1, -56, 39, 58, -49, -92, -17,
+    49, 1, 14, -7, -30, 28, 16, 60, -87, -17, -20, 7, -46, 37, -95, 18, 13, 33,
+    52, -84, 61, -44, -3, -118, 4, -53, 73, -32, -29, -2, 9, -32, -13, -34, 93,
+    48, -15, -24, 32, 45, -28, 23, -6, -33, -57, 13, 23, -87, -56, -17, -37,
+    -30, -92, 83, 40, -11, 54, 38, -66, 80, -71, -45, -11, -25, -7, -53, 44,
+    -46, -26, -68, -53, -23, 23, 11, 46, 25, 56, -48, 22, 127, 34, -32, -11, 9,
+    -70, -80, 26, 11, -39, -27, -33, 28, 28, -22, -16, 1, 33, 20, -6, 40, -3,
+    -44, 0, 8, 0, -2, -21, -37, 0, 4, -15, 2, 27, -1, 21, 0, 2, -1, 0, 16, 2, 1,
+    -1, -100, 1, 27, -9, -8, 2, 1, 38, -36, -25, 6, 12, 0, 7, -1, 46, -58, -45,
+    -13, -127, 28, 2, 0, -28, -1, -2, 2, 2, -59, 0, -24, 0, -1, 1, -6, 0, 4, 1,
+    0, -40, 2, -32, 33, -2, 1, 0, 3, 1, 0, 0, 1, -1, -1, 6, 41, 56, 11, -2, 18,
+    45, -10, -31, 0, 1, 25, -22, 3, 24, 0, 22, 0, -8, 7, -106, 8, -1, -2, -5,
+    -2, -12, -11, -6, 49, 3, -33, -4, 20, -3, 0, 35, -2, 0, 1, 6, -25, -23, -16,
+    -18, 0, -1, -22, 0, -3, -1, 1, -5, -1, 20, 0, -2, 40, 1, -56, 0, -1, -46,
+    33, 0, 0, -3, 14, 0, -20, -2, -3, 0, 2, 0, -127, -7, 0, -69, -8, 9, -4, -53,
+    0, 1, 2, 5, 1, 0, -19, -6, -2, 5, -2, -22, -8, -20, 8, 4, 12, 10, 27, -1,
+    -1, -10, 2, -3, 27, -36, -13, 0, 0, 28, -6, 0, -4, -6, 0, -35, -9, -16, 4,
+    21, 0, -40, 0, -9, -5, -1, 1, 0, 0, -1, -5, 0, -3, -8, 3, 0, -61, 8, -43,
+    -31, -10, 86, 0, -30, -25, -25, 0, 0, 0, 13, 1, 1, 0, -4, -21, -6, 1, -12,
+    0, -4, 45, -127, -11, -52, -42, 0, -10, 0, -8, 16, 3, 0, -30, -98, -3, 1,
+    86, 1, -49, 1, 46, 0, -86, 2, 53, 0, -1, 74, 0, 13, -3, -3, 0, 8, 35, -10,
+    15, -6, 1, 0, -6, -21, -22, 49, -106, 3, -61, 33, 21, -57, -30, 35, -127,
+    -4, -27, -13, -20, 4, -11, -3, 16, -20, 0, -45, 44, 32, 53, -15, -42, 85,
+    -27, -52, 10, -69, -30, -13, 35, -53, -70, 15, 50, 77, 24, -39, 67, -19, 86,
+    3, -58, 61, 46, -35, 61, -16, 14, 87, 17, 57, -96, -11, -27, -92, -18, -20,
+    -89, -28, 65, 92, -26, -42, 52, -50, 80, 79, -79, -22, 15, 17, -73, -30, 58,
+    -28, -31, 28, 25, 62, 110, -43, -15, -52, -74, 17, -29, -41, -54, 39, -18,
+    -1, -10, 0, 6, -13, 1, -14, 28, -8, 0, 1, -24, 2, -9, 10, 2, -7, -6, -1, 9,
+    2, -2, -3, 0, 4, 0, 0, -1, 12, 0, 18, -1, 0, 0, -6, 7, -2, 0, -55, 0, -7, 0,
+    -12, 0, 5, -14, -23, 0, -6, 0, 16, -22, -5, 4, 16, 0, 0, -4, 0, -1, 0, 2, 0,
+    -18, -22, 9, 1, -1, 20, 3, -3, 0, 0, 24, 1, -127, 0, 3, 12, -82, 0, 3, 18,
+    8, -8, 4, 0, -6, 0, 4, 9, 0, 5, 0, 5, -14, -1, 5, 3, 9, -2, 1, 0, -3, 0, 24,
+    -2, 0, -1, -9, 1, 8, -127, 0, 0, 0, 0, 1, 2, 0, -4, 0, 0, 2, 0, -6, 3, 2,
+    -4, 1, -6, -6, -86, 0, -39, -3, -4, -2, 3, 0, -2, -2, -16, -9, 17, 9, 5, 0,
+    0, 23, -1, 0, 3, 1, 0, 8, 0, 1, 0, -9, -3, -1, 11, -1, 9, 0, 0, -3, -12, 20,
+    12, -21, 0, -1, 1, -1, 16, 1, 8, 1, -14, 1, 14, 0, 6, -10, -1, 0, 53, 7, 0,
+    -2, 18, 20, 0, 17, -3, -18, -6, 2, 1, 27, -76, 3, -13, 2, 18, 6, 0, -4, -12,
+    1, -2, 14, 13, 0, 1, -8, 0, 0, 33, 18, -15, -26, 0, 22, 1, 1, 0, -1, 1, 0,
+    22, -26, -5, 0, 1, 0, 0, 1, -11, -4, 0, 0, -127, 5, 0, 8, -1, -5, 0, -11, 0,
+    3, 0, -9, 2, 5, -22, -15, 1, 7, -21, 21, 33, -3, 9, 1, 0, -25, 27, 1, -7, 0,
+    1, -13, -19, 12, 2, 34, 1, 0, 0, -35, -41, -5, -13, 2, -36, 0, 1, -5, 4, -9,
+    9, -14, 15, 10, 0, 49, 3, -1, -8, -13, 0, 5, 1, 59, -31, 0, 16, 0, -1, 20,
+    0, -4, -3, -6, 25, 8, -13, 2, -5, -33, -1, 12, -127, 2, 1, -1, -10, 0, 16,
+    33, -7, 1, 7, 0, -35, -2, 3, -3, -25, 1, 30, 0, -2, 4, 0, -3, 0, -48, -18,
+    -2, 4, 18, 0, 6, -1, -18, -9, 33, -3, -66, 0, 4, -7, 1, -2, 32, -1, 27, -1,
+    -15, 4, -26, -18, 1, -1, 47, 0, 17, 0, 3, 2, 2, 1, 1, -31, -11, 0, 16, 5, 0,
+    -5, -12, 1, -3, 0, -3, 0, 4, 3, 2, -3, 0, 2, 0, 0, 0, 0, -1, 5, -6, 2, -7,
+    0, 0, 8, 0, 0, 0, 1, 0, -127, 0, -2, 0, 1, 0, 9, 5, -4, -1, 0, 2, 12, -2, 0,
+    0, 2, 3, 1, -1, 0, 0, 0, 0, -20, 0, -1, 0, 2, -8, -4, 0, 0, -9, 0, -1, 0,
+    -6, 6, -33, -8, -12, 0, -2, -4, 0, 0, 3, 0, 2, 3, 0, -44, 5, 1, 0, -5, 0,
+    -1, 0, 84, -13, 13, -1, -83, 1, -18, -78, -17, 2, 4, -2, 30, -2, 2, 1, 29,
+    -2, 8, 0, -22, 0, 0, 1, 64, 14, -3, 11, 96, -6, 6, -36, 1, 2, 74, -2, -22,
+    -31, -2, 0, 8, 54, 90, -127, 2, -2, -11, 0, -2, 57, 0, 5, -1, -19, 1, 0, 0,
+    -42, 0, 17, 63, 11, -5, -15, -25, -2, 1, 12, -69, -3, 11, 0, 0, 0, -12, 1,
+    -50, 0, -2, -34, 12, 27, 20, -2, 9, -5, 0, 0, -92, -3, 35, -9, 17, -33, 5,
+    -32, 11, -3, 2, -18, 95, -1, -56, 47, -19, 16, 14, 7, 0, 2, -3, 50, -8, 13,
+    16, 0, -20, -1, 0, 3, 5, 1, -4, -17, 59, 2, 16, 6, -43, -3, -9, -32, 17,
+    -11, 43, 0, -6, 1, -36, 49, -35, -10, -1, 1, -1, 0, -92, -1, -1, 0, 2, -29,
+    0, 25, 0, 127, -51, 12, 52, -60, 15, -25, -6, 75, 2, 2, 49, -20, 0, -73,
+    -33, -1, 3, -8, 102, 6, 1, 9, 34, 0, -3, 8, -25, 4, 21, -1, -65, 1, -1, 0,
+    33, 22, 8, -8, 0, 7, -19, 3, 10, 13, -5, -32, -8, 20, -5, 18, 15, -1, 15,
+    28, 29, 0, 0, -1, 0, 3, 30, 0, -1, -1, 0, 2, 22, -2, -1, 0, -90, -6, -5,
+    -29, 17, 0, 2, -5, -20, -103, 1, -1, -20, 1, -31, 15, 7, -2, -29, 2, 2, -10,
+    0, -14, 0, -119, 0, 2, 0, -1, -19, 1, -8, -9, -40, 1, 14, -127, 0, 0, -9,
+    -1, -1, -5, 14, -5, -3, 6, 0, 0, -4, -1, 5, -1, 0, 0, 0, 38, 33, 41, 91,
+    -22, 31, 7, -20, -23, 34, 23, 106, -33, -28, -10, 39, -105, -9, -42, 4,
+    -113, -18, -43, 31, -40, -34, -25, 27, 14, 3, 29, -2, -5, 35, 13, -70, -38,
+    27, -12, 17, -25, 0, 27, -127, 71, 12, 100, -36, -5, 3, -67, 19, 16, 73, 19,
+    -48, 34, -7, 1, -13, 12, 52, -40, -33, -5, -74, -3, -57, -39, -42, -39, -2,
+    -15, -24, 27, -31, 17, 0, 29, 11, -22, 24, -58, 15, -43, 34, 19, -26, -58,
+    51, 13, -85, -39, -1, 70, -45, 1, -18, -1, -23, -2, 1, -1, 25, -12, 3, -22,
+    -2, 5, 0, 3, -35, -2, 29, 5, -78, 1, 1, 46, -1, 0, -7, -36, 0, -4, 1, -22,
+    -1, -127, 0, 6, -52, -24, -1, -5, 2, 2, 0, -15, 6, 0, 31, -1, -24, 8, 10, 8,
+    -4, 0, -5, 22, -15, 5, -10, -2, -9, -27, 0, 4, 0, 0, 8, -2, -2, -20, 1, -10,
+    -2, -2, -1, 0, -2, 0, 0, -21, 16, 0, 49, 0, 16, 0, -67, 7, 7, 5, 18, -35,
+    28, 0, 0, -33, 41, 33, -21, 3, 39, 10, 14, -53, -1, -28, -9, 4, -40, 0, 1,
+    1, 0, 5, -1, 14, 22, 7, 4, -2, 0, 0, 13, -11, 0, 12, -8, 0, -12, 3, -4, 2,
+    15, -17, 0, -10, 7, 2, -8, 2, 23, 0, -7, 1, -14, -1, 0, 12, -6, 26, -12, 6,
+    -19, -11, 22, -17, -36, -1, 0, 11, 0, -2, 0, 3, -3, 0, 24, -9, -23, 21, -1,
+    0, 10, -24, 0, -13, 4, -127, 6, 0, 41, -14, -29, 0, 8, -9, 0, 12, -1, 12,
+    -31, -8, 11, 44, -27, 25, -32, -29, -71, 7, -33, -90, -10, -56, -87, 17, 20,
+    19, -53, 40, -49, -8, -16, -17, -13, 76, 42, -94, -60, 97, -5, -44, 39, 41,
+    -77, 32, 17, 41, -39, 30, 20, 23, 40, 19, 17, -14, 21, 48, 34, 4, -18, 27,
+    -30, -8, -45, 115, -7, 36, 28, 45, 105, -4, 13, 25, 39, -43, -94, -5, 54,
+    37, -87, -127, 20, -11, 24, 56, 54, 1, -4, -8, -90, 55, -33, -5, -41, -8,
+    -43, -48, 16, -64, -25, -20, 58, -3, 2, 56, -52, 73, -22, 25, 12, 7, 12, 6,
+    11, 10, -5, -2, 5, -4, 0, -5, 0, -21, 2, 0, -1, -1, 0, 0, 1, 8, 0, 0, -2, 1,
+    0, -5, 12, 0, 5, -31, -8, -3, 1, 1, 0, 12, 0, 10, 3, 16, 8, 0, -2, 11, 0,
+    11, -7, -10, 2, 3, 15, -16, -1, -6, -11, 6, -16, 4, 0, 8, 0, -1, 8, -5, 7,
+    1, 0, -6, 3, -5, -16, -127, 1, 0, 0, -1, -5, -1, -1, -38, 0, 4, 7, -9, -10,
+    11, 0, 2, -15, 14, -4, 17, -2, -6, -2, -9, 20, -7, 18, 0, -4, -1, -2, 9, -8,
+    -2, -4, 1, 1, -26, 0, 1, 12, 0, -12, -51, 0, 0, 13, 11, 0, 4, -23, 2, 1, -8,
+    -16, 3, -1, 0, 0, 0, 34, 3, -2, -2, 33, 0, 17, -9, 1, -13, 12, 15, -4, 6,
+    -5, 13, -71, 22, -2, 15, -1, 0, 0, -6, 0, 16, -18, 11, -51, 2, 0, -45, -65,
+    45, 0, -15, 11, -1, 0, -14, -6, -127, 6, -8, 82, 0, -40, 4, 20, -8, -10, 0,
+    -3, 20, -10, 1, 1, 1, 14, 17, 3, -8, -23, 0, 0, -4, -46, 0, 4, 0, 1, 38,
+    -53, 19, 1, -1, 40, -62, 0, -7, 1, 0, 1, 6, 0, -1, 2, 22, -40, 2, 25, -1,
+    25, 1, 0, 8, 22, -11, 17, 19, -21, 0, 4, 0, 2, -74, 0, 0, 1, 4, 3, -12, 26,
+    1, -26, -2, 26, 8, 0, 0, 0, -2, -7, -8, 32, 13, -61, 0, 30, 6, 7, -36, 1,
+    -127, 0, 8, -1, 42, 4, -20, 1, -17, -16, 2, 4, -2, 2, 5, -1, 51, 0, 1, 18,
+    0, 73, 1, -69, -9, 36, 124, -38, 11, -21, 15, 89, 1, -31, -1, 1, -21, 40,
+    -5, -89, 1, -1, 6, 7, 0, -18, 0, 0, -33, 0, -5, -17, 5, -37, 5, -84, -1, 1,
+    61, 48, -1, -27, -3, 23, 0, 6, 81, 2, -48, 20, -7, 43, 13, 28, 45, -9, 0, 0,
+    2, 14, 0, 0, 15, 0, -2, -13, -1, -52, 4, -49, -63, -64, 33, -12, -2, -1, -1,
+    0, 2, 1, 0, -13, -2, 127, -29, -43, -3, 7, 6, -53, -8, -52, 0, -52, -1, -3,
+    -50, -3, 0, 79, 25, 0, 3, 5, -6, 15, -10, -18, -35, 3, -16, -8, -3, 15, 21,
+    95, 70, 13, 9, 14, 0, 104, 0, 0, -3, 28, -38, 4, 0, 36, -1, 127, 2, -39, 0,
+    3, 25, 0, -13, -6, 0, -13, 1, -38, -11, 37, 3, -27, 3, 12, 20, 22, 26, 91,
+    12, 1, 74, 0, 0, 0, 13, -24, 12, 15, -2, -63, 1, 3, -22, -50, 98, 0, 0, 0,
+    2, -3, -4, 55, 46, -48, 30, 3, -1, -19, -17, 52, -23, 26, 27, 1, -44, 1, 54,
+    5, 7, 9, 8, 4, -8, -5, 8, -23, -8, -1, -20, 15, 0, 3, 9, -39, -18, 0, -5,
+    11, 6, -8, 0, 6, 1, 0, 0, 10, 1, -13, 3, 13, 7, -1, 0, 0, 8, 15, -19, -3, 2,
+    2, 0, 0, 127, 101, -17, -12, 17, -11, 0, -1, 19, 4, 5, -10, 11, 8, 1, 0, 4,
+    0, -17, 7, 6, 26, -5, 7, 12, 6, -11, -28, 32, 1, 119, 0, 7, -2, 1, -22, 18,
+    0, 12, -11, 0, 0, -5, 3, 0, 21, 0, -22, 1, 0, -9, -1, -42, -16, -3, -3, -46,
+    -5, -19, -8, 8, 1, -37, -28, -1, -57, -53, -40, -70, 0, 12, 0, -127, 53, 0,
+    -124, -1, 0, 0, -36, 42, -120, -14, 22, 37, -4, -60, -27, -41, -1, 52, -18,
+    -32, -1, 0, -23, -43, 1, 61, -16, -2, -52, 0, -61, 45, -57, 17, -1, -33, 3,
+    37, 0, 1, 0, -1, 1, 31, -3, 40, -82, -60, 5, -84, 0, 2, 0, -19, 0, 32, -6,
+    -2, 1, 5, -1, -2, -27, 26, 5, 34, -1, 48, 39, -3, -1, -2, -48, 0, -25, -69,
+    -47, 29, 44, -96, 21, -2, 46, 60, -1, -11, -2, -25, 13, 7, 29, -29, 26, 32,
+    44, -30, 42, -56, -106, 2, 40, 34, -33, -52, 25, 3, -2, -63, -32, -52, -32,
+    -40, -10, 45, 65, 30, -76, 5, -4, -37, 64, 13, 8, 26, -3, 119, 16, 127, -35,
+    38, 16, -49, -46, 8, 24, 69, -118, -44, 9, -16, 36, -44, 20, 40, -33, -10,
+    -18, 110, 17, -19, -15, -12, 8, -92, -34, -89, 76, 57, 71, -52, 37, 20, 58,
+    -53, 17, -55, 3, 41, -3, -13, 1, 0, -1, 13, -7, -9, -3, 1, 44, 42, -25, 7,
+    45, -1, 17, -40, 1, -1, 19, 0, -2, -2, 12, 0, -2, 59, 0, -21, -10, -2, 8,
+    -66, 10, -2, 3, 0, 1, 7, -2, 23, 13, -1, -3, 0, 2, 6, 127, -5, -20, 8, 10,
+    0, 0, -2, -18, 32, -121, 19, -1, 25, 0, 3, 0, 17, -1, 1, 3, 82, -27, -37,
+    -1, 64, 68, -4, -71, 0, 0, 30, -15, -1, 1, 11, 48, 41, 3, -1, 57, 1, 12,
+    -79, 62, -43, 3, -1, 61, 0, 11, -27, -34, 0, -20, 66, 10, -9, -3, 10, 52,
+    -9, 5, 9, 0, 17, 0, -20, -20, 8, 7, -7, -6, 0, -2, -6, 0, -8, -2, 5, -7, 1,
+    0, 2, -9, 2, 0, 15, -3, 1, -1, 0, -18, 0, -8, 0, -10, -18, 0, -8, 4, 0, -1,
+    21, 2, 35, 12, -8, 0, 21, 0, -11, 0, 6, -2, 8, 6, 17, -10, 20, 1, 0, 0, -13,
+    -1, -127, 0, 26, 4, -22, -1, 0, -5, 2, 26, -27, -12, 2, -7, 3, -12, 0, 1,
+    -3, 2, -16, 27, -1, -110, -16, 11, 1, -25, 11, 1, -16, 1, 7, -1, -9, -40,
+    -20, -5, 49, -61, 1, 6, -22, 33, 0, -67, -20, 0, -44, -20, 14, 35, -3, -127,
+    1, -90, 0, -7, 14, -70, 0, -4, -3, 12, 0, -32, 1, -90, 109, -56, -41, 79, 4,
+    -2, -17, 40, -3, -3, 1, 0, 2, 0, -1, 0, -2, 5, 7, -3, 0, 1, 1, 0, 48, 0, -1,
+    -9, 2, 0, 2, -10, 0, -33, -28, 81, -8, -1, -21, -1, 0, -31, -4, -6, -7, 1,
+    30, -3, -17, -16, 1, 2, -9, 54, 0, 46, -36, -3, -22, -1, 27, 7, -1, -13, 19,
+    1, 55, -63, 1, -32, 3, 127, 0, 1, 45, 0, 1, 0, -11, 17, -11, -116, -14, 0,
+    1, -7, 1, 1, -26, 8, 13, 68, 0, -39, 52, -3, 42, 1, 35, 15, 107, 0, -15, 0,
+    1, 1, 46, 0, -16, 0, 0, 0, 0, 16, 7, -121, -8, 31, -16, -86, 4, 4, 2, 1, 0,
+    0, 1, 0, -1, -48, 4, 1, 17, 2, -3, -2, -8, 44, -87, 3, -5, -1, 1, 1, 1, 2,
+    1, -99, -1, 9, -46, -15, 6, 15, -16, -4, 0, 51, 1, 9, 23, -1, -82, 68, -8,
+    22, 20, 3, 0, -31, 122, 0, -59, 0, -2, -1, 72, 0, 3, 0, -101, -1, 127, 0, 0,
+    4, 3, 3, 0, 1, 66, 20, -5, 11, 12, -70, -72, -40, -45, -17, 3, 3, -43, -4,
+    14, 0, 2, 0, 1, -1, -2, 0, -12, -46, 0, 0, 0, 20, 2, 6, -2, 0, 0, 0, 0, -24,
+    11, 5, 45, 29, -36, 1, -27, 14, 34, -27, 69, 1, -82, 32, -90, -8, 0, -4, -2,
+    -1, -2, 4, -1, 6, 8, -1, -11, -6, 0, -127, 7, -20, 0, 0, -2, 0, 1, 7, 0,
+    -17, -8, 0, 0, -16, 8, 3, 1, 0, -17, -11, -2, 0, -1, -5, -14, 0, -85, -1, 0,
+    -1, 0, 6, -7, -9, 46, 1, -4, -11, -11, -4, -1, -9, 7, -3, -23, 0, 10, 0, -6,
+    -16, -5, -3, -17, 2, -13, -5, 9, -1, -31, 0, -22, 0, 2, -35, -15, -6, -11,
+    1, 1, -58, 16, -9, 0, -8, -10, -4, -15, 0, -5, 61, -2};
+
+static const float kDense2WeightScales[kDense2Units] = {6.016835e-03f,
+    3.204724e-06f, 1.024073e-02f, 5.956803e-03f, 3.894016e-03f, 5.508126e-03f,
+    4.081677e-03f, 6.339528e-03f, 8.076425e-03f, 4.064961e-03f, 5.065008e-03f,
+    5.967740e-03f, 4.871630e-03f, 6.491047e-03f, 6.381630e-03f, 1.005021e-02f,
+    5.295339e-03f, 3.889764e-06f, 1.100122e-02f, 1.332281e-02f, 8.600937e-03f,
+    6.783512e-03f, 6.584039e-03f, 1.249157e-02f, 8.007795e-03f, 2.637795e-06f,
+    2.857339e-03f, 1.475098e-02f, 3.401575e-06f, 5.226433e-03f, 7.033567e-03f,
+    5.429039e-03f, 7.858882e-03f, 2.755906e-06f, 6.654701e-03f, 8.396575e-03f,
+    7.974945e-03f, 2.889764e-06f, 1.545883e-02f, 1.476387e-02f, 8.403402e-03f,
+    7.966732e-03f, 2.311565e-02f, 6.068945e-03f, 5.760087e-03f, 9.343346e-03f,
+    3.425197e-06f, 8.750583e-03f, 1.199176e-02f, 2.755906e-06f, 1.913135e-02f,
+    9.851559e-03f, 8.075299e-03f, 6.014756e-03f, 5.316008e-03f, 1.230162e-02f,
+    4.014787e-03f, 3.574803e-06f, 4.984276e-03f, 1.272594e-02f, 5.713819e-03f,
+    4.189543e-03f, 4.968559e-03f, 1.316083e-02f};
+
+static const int8_t kDense3WeightsInt8[kDense2Units * kDense3Units] = {0, 0,
+    -61, -1, -20, -33, 51, -40, -127, -1, 40, 88, 32, -2, 28, 69, 2, 0, 18, -16,
+    56, 0, 117, -64, 0, 0, -1, 1, 0, -49, 0, 4, -112, 0, -19, -50, -109, 0, 28,
+    45, 0, -1, -58, -37, -1, 94, 0, -31, 19, 0, 19, -46, 67, 1, -40, -44, 0, 0,
+    -37, 22, 9, -8, -7, -28, 0, 0, 0, 1, -1, 1, 11, 0, -1, 26, 0, 0, -3, 0, 2,
+    1, 4, 0, 127, 0, -21, -8, 39, -4, 16, 0, 16, -62, 0, 1, 31, 0, -5, 0, 0, 0,
+    -51, 0, 0, 98, -11, 8, 37, 26, 6, 28, 0, 8, 12, 0, 0, -10, 7, 0, 15, 0, 37,
+    0, -11, 31, 0, 0, -14, 26, -3, 0, 0, 1, -30, 118, 0, 0, 33, 2, -11, -24, 32,
+    0, 0, -13, -33, 0, 0, 16, -111, 31, 0, -31, -6, 0, -7, 40, 0, 0, 0, 0, 28,
+    0, 0, 5, 78, 0, 69, -13, -5, 0, 3, 102, 3, -57, 0, -1, -7, 0, -2, 127, -1,
+    -31, 23, 0, -7, 0, -16, -45, 0, 36, -15, 0, 0, 0, 0, -1, -1, 10, -13, 0, 1,
+    0, 20, -1, 29, 58, 0, 0, 15, 0, 0, 0, -71, 51, 12, 0, 0, 0, -45, -71, 0,
+    -36, 10, 0, -28, 0, 0, 0, -55, 0, 0, 0, -13, 127, 30, 24, 45, 50, 0, -40,
+    -24, 0, -17, 44, -1, -25, 0, -7, 3, 0, -9, 63, -1, 14, 0, 41, -12, 0, 75, 2,
+    11, -1, 0, -74, 14, 86, 0, -1, 0, 1, 26, -54, 41, 0, 2, 82, -42, 94, 2, 58,
+    0, 0, -45, 41, 0, 0, 15, -1, 24, 0, 1, 1, 2, 0, 43, 0, -28, 39, -40, 36, 0,
+    -1, 0, 0, 0, 0, -1, 0, 35, 98, 0, -1, -68, 0, 127, 4, 14, -4, 1, 3, -32,
+    -52, 0, 51, -15, -52, -31, -28, -25, -3, 47, 24, -14, -1, -16, 68, -77, -49,
+    15, 14, -7, -24, -8, 37, -1, -5, -69, 22, -44, 51, -29, 48, -32, -1, -30,
+    36, -26, 33, -38, 71, 45, -62, -18, 85, -30, -16, -13, 22, -127, -31, -5,
+    -44, 13, -59, -40, -31, -82, -72, -52, -75, 29, 49, 20, 29, 1, 0, 16, -100,
+    22, 54, -4, 0, -1, 0, -9, -65, -8, 12, 38, -37, 0, 0, 0, -59, 106, 29, 24,
+    -8, -1, 0, -9, -47, 0, -55, 127, 0, -4, 0, 1, -1, -2, 0, 1, 59, -1, 17, -1,
+    1, 14, 81, 0, -8, -3, 0, 31, 17, -12, -44, -29, -1, 12, 0, -5, -62, -80,
+    -57, -1, -23, 0, 0, -28, 1, 0, -24, 14, 19, -27, 0, 18, 59, -9, 54, 0, 0, 0,
+    0, -1, 10, 27, 5, 0, -1, 0, 0, -12, 4, 0, 0, -15, -61, 1, 0, 0, 0, 26, 0,
+    -5, -6, 20, -28, -102, 38, 14, -6, 0, 8, -127, 0, 37, 0, 28, -23, -67, 69,
+    0, 0, 17, -1, -33, 0, 4, 21, 78, -16, 114, 50, -56, 12, 11, -40, -47, 27,
+    23, 24, 38, 3, 52, -50, 127, -4, 39, -7, 28, 33, 58, -34, 35, 16, 41, 4, -1,
+    0, 26, -18, -10, 18, 1, -48, -7, 16, 29, 43, -17, -53, 19, 23, 53, 3, -61,
+    7, 52, -17, -45, 24, -28, -12, -50, 54, -56, -5, 51, -71, -8, -38, 96, 20,
+    30, 0, -29, -1, 0, -5, 15, 0, 2, 0, 64, -16, 30, -1, 19, -45, 31, 0, -30,
+    -29, 4, 0, 41, -51, 0, 0, 9, -1, 0, 1, 127, -7, 0, 0, -7, 0, -19, 0, -38, 7,
+    -2, -37, 48, -4, -57, 51, 0, 2, 0, 0, -33, -13, 0, -2, 0, 0, 0, 0, 36, -37,
+    -55, 72, -3, 46, -1, 0, 14, 2, -1, 127, -2, 0, 81, 4, 0, 49, -26, -106, -1,
+    60, 46, 0, 5, 83, 9, 28, 14, 43, 58, 0, 0, 17, 0, 40, -33, -17, 43, 0, 0,
+    -1, 25, 0, -39, -18, -12, 0, 0, -5, 13, -29, 0, 8, 0, 0, 31, -22, 33, -4,
+    -59, 20, 0, 0, 1, -5, -1, -38, 7, 0, 111, 0, 104, -1, -106, -103, -15, 89,
+    0, 0, 24, 0, 66, 0, -10, 2, -37, 0, 1, 0, 37, 0, -80, 0, 0, 0, 0, 119, 0,
+    16, -34, 4, 12, 0, -87, -6, 5, 0, 14, 31, 1, 20, 2, 0, -26, 12, 0, -3, -9,
+    0, 99, 127, -43, 3, -39, 16, 67, 0, 26, 1, -50, 0, 40, 0, 29, 0, 1, -127,
+    -21, 20, -73, 6, -66, -1, -13, 0, 65, 58, 1, -99, -118, 0, -16, 1, -43, -15,
+    -46, -51, -3, 0, -18, -4, 0, 0, 0, 24, 23, 0, -106, 1, 52, 0, -68, 14, 0, 5,
+    -2, 87, 38, 0, 0, -1, 2, 0, 79, -53, 18, -103, 3, 22, -1, 0, -27, -38, 61,
+    22, 62, -37, 2, 0, -14, 0, -23, 14, 0, 0, -48, 0, -19, 56, 22, 87, -16, 0,
+    -37, 0, 0, 0, 19, -14, -20, 11, -4, 0, 9, 22, 0, 74, 0, 0, 0, 0, 1, -2, 38,
+    0, 19, -1, -4, -36, 67, -6, 20, 1, 0, -56, -6, 0, 43, 0, -12, 47, -9, 30,
+    -45, 0, -2, 10, 0, 0, 59, -127, -16, 0, -30, 106, -1, 0, 0, -1, -31, 29, 27,
+    -123, 0, -15, -5, 111, 33, 0, 6, -22, -15, 44, -24, 42, -88, 0, 0, 44, 0,
+    -1, -41, 0, -44, 0, 33, 121, 16, 0, -1, 50, 102, 0, 0, -30, 1, 127, 0, 5,
+    -34, 0, 1, -76, -95, 74, 0, 89, -4, 0, -87, -1, 37, 0, -4, -11, -23, 0, -44,
+    -24, -3, 41, 65, 0, 58, -2, 0, 0, -20, -115, 51, -45, 65, 0, 0, -1, 70, 5,
+    -50, 27, -4, 0, 1, -46, 0, 22, -10, 92, -59, 0, -127, 88, -1, 0, 3, 32, -59,
+    2, 8, 0, 1, -38, 0, -1, 9, 0, 28, -8, 0, -1, 0, -45, -5, 0, 0, 3, 20, 78,
+    73, 1, 10, 0, 0, 42, 11, -46, 9, -7, -19, 0, 39, 127, 7, -2, 15, -1, -3, 0,
+    0, -22, 0, 0, 0, 0, 35, 0, -38, 0, 0, 2, 43, 0, 8, 0, 35, 19, 0, 0, -34, 76,
+    18, -23, 2, 1, 75, 1, 0, 0, 0, 0, -8, 9, -47, 15, -21, -17, -1, 0, 20, -2,
+    -25, 12, 18, 5, 0, 0, 46, 0, 42, 0, 19, 33, 0, 13, 23, 0, 1, 0, -43, -30, 0,
+    0, 0, -35, -27, 31, -21, 0, 0, 0, 10, 43, 0, -3, 0, 17, 28, 0, 10, -127, 1,
+    0, -1, -6, 8, -21, 4, 16, 57, 0, 0, 11, 0, 0, -46, -12, 4, 2, 16, 73, 5, 0,
+    -11, -1, 1, 2, 5, 0, -34, 0, 0, 0, -39, -12, 21, 0, 0, 0, -40, -1, 0, -1,
+    -20, 15, 31, 0, 0, -14, 24, -51, 0, 27, 10, 0, 6, -27, 0, 0, -1, 23, -13, 0,
+    14, 0, 0, 0, 0, 1, -9, 4, 0, 51, 15, 23, 0, 42, 0, 0, 28, 36, -2, 5, -1, 0,
+    67, 0, 2, -14, 29, 1, 0, 127, -56, 0, 14, 0, -38, 1, 3, 0, 1, 12, -1, 0, -6,
+    1, -25, 51, 16, 0, -1, 1, 0, 0, 0, 48, 0, 0, -12, 98, 0, -47, 0, 0, 5, 0,
+    17, 5, 33, 0, 8, -37, 8, 0, -13, 3, 0, 2, 0, -9, 127, 0, 22, 0, 10, -83,
+    -19, 13, 9, 0, 0, 66, 12, 0, 0, 0, 10, 0, -36, 0, 40, 5, 1, 54, 38, -1, -3,
+    0, 18, -16, 27, -8, -11, 0, -89, -16, -20, 30, 1, -127, -45, 0, 1, 0, 0, 95,
+    -1, 0, 3, 0, 1, 13, 38, 0, -75, 1, 0, -2, 1, -1, 3, 14, 0, -5, -8, 0, -46,
+    34, 1, -3, 39, 37, -18, 0, -1, -53, 0, 1, -13, 0, -4, 0, 63, -5, 38, 30, 0,
+    -78, -59, 75, -60, -69, 2, -34, 1, -3, -47, 0, 0, 1, -13, -53, 8, 13, 28, 0,
+    1, 55, 0, -31, 0, 0, 0, 0, 0, 0, 83, 0, -68, -19, 30, -25, 0, -1, 0, -5, 0,
+    -1, -113, 0, 1, 0, 0, -62, -22, 127, 18, 0, -1, 0, 6, 69, 32, 0, 88, 0, -13,
+    127, -1, -12, -3, 0, -1, 12, 69, -1, -29, -8, -9, 77, -5, 0, 0, -23, 1, 61,
+    0, -22, -9, 0, 31, -4, 0, 5, 24, -13, 1, 0, -10, 0, -6, 0, 0, 1, -42, 0, -1,
+    0, -1, 0, 0, -72, 0, 0, 10, 42, 1, 3, -7, 15, 7, 0, 0, 3, 46, -2, -72, -85,
+    98, 0, 15, 3, 63, -23, 126, 1, 31, -33, -3, 0, -13, 39, -65, 65, -7, 0, 0,
+    15, 0, -38, 0, 127, -34, 0, -25, -15, 0, -65, -4, -41, 95, 0, -73, 0, -8, 0,
+    -3, 17, 6, 1, 1, 0, -1, 49, 0, -50, 1, 0, 44, 31, 1, 0, -79, 0, 4, 0, 32,
+    98, -33, 5, 94, 8, -54, 30, 17, 24, -28, -120, 51, -25, -120, -32, -46, 56,
+    -14, -41, 17, -8, 17, -28, 32, 32, 9, -25, 11, -105, -53, -25, 12, 12, 11,
+    25, -66, -80, -9, 43, -27, -14, 14, -44, -22, -64, 41, -75, -68, 15, 127,
+    -33, -24, 36, -32, -81, 32, 13, -91, 4, 11, 46, 12, -1, -51, -119, 6, -41,
+    -7, 16, 4, 0, 11, -69, -4, -1, -10, 0, 0, -38, 37, 1, 111, 26, 127, 0, 2, 0,
+    1, 0, 1, 5, -30, 5, 0, 0, 7, -85, 0, -46, 21, 13, 118, 0, -19, 0, -1, 0,
+    -16, 19, 29, 0, -54, 110, -1, -2, 0, 19, -1, 0, 1, -48, 21, -1, 15, -39, 13,
+    0, -9, 120, 0, -1, 13, -58, -3, 0, -9, -1, -2, -7, -1, -109, -68, 2, -16, 0,
+    -17, -9, 0, 3, 26, 0, -20, 0, 11, -3, 1, 45, -14, 0, 79, -51, 0, 0, 1, -7,
+    0, 0, -16, -25, -77, 0, 127, 4, 96, 0, -91, 20, 7, 0, 0, 64, 14, 0, 4, 0,
+    21, -43, 56, -10, -3, 0, 1, 1, 0, 0, 2, 0, -36, 0, -35, 28, -5, -3, 42, -1,
+    1, -65, 3, 0, 101, -6, 0, 67, 88, 0, -127, 100, -16, -1, -19, 11, 32, 0, -3,
+    -11, 0, -1, 90, -114, 1, 0, -46, -18, -23, 0, 71, 0, 0, 0, 29, 27, -27, -7,
+    0, 53, -91, 0, -43, -4, 0, 28, -16, 0, 107, 0, -24, 3, 0, -54, -3, 0, 7, 0,
+    -1, -1, 12, 1, -9, 4, -1, -28, 0, 0, -1, -2, 1, 24, 0, 0, -4, 127, -6, 0,
+    75, 1, 43, 0, 41, 33, 0, 0, 7, 0, 0, 0, -1, -11, 0, 0, -84, 0, 0, 10, 0, 68,
+    -20, 0, 0, -6, 16, 0, 28, 6, -23, 77, 0, 0, -43, 0, -9, -17, 33, 6, 1, 1, 3,
+    0, 0, 1, 35, 0, -6, 9, 1, -77, 19, 26, 7, 0, -55, 8, -29, 0, 50, 17, 21, 0,
+    1, -12, -14, 0, 19, 0, 0, 75, 127, 71, 0, 0, -1, 0, 13, 0, 8, 0, 3, -29, -1,
+    0, 119, 64, 0, 22, 4, 0, -36, 0, 106, 1, 30, -83, 21, 0, -9, -1, 86, -3, -1,
+    1, -1, 0, 1, 0, 1, 13, -127, -1, 40, 30, -43, 10, -65, 1, 1, 0, -29, 0, 2,
+    28, -6, -21, 0, -41, -7, 0, 0, 1, 0, 1, 48, 0, 10, 0, 2, 65, 64, 0, 18, -6,
+    23, 7, 49, -57, 0, 11, 0, 77, 27, 0, 0, 0, 0, -25, 36, 49, -37, 0, 2, 0, 22,
+    1, -80, 29, 23, 39, -56, 64, 52, 34, -30, 29, 82, 50, 29, 11, -39, -30, 82,
+    -1, -41, -56, 45, 46, 38, 37, -65, 35, -20, 3, 13, 46, -58, 127, -49, 7, 50,
+    27, 1, -8, 63, -56, -74, 11, 6, 91, -7, 10, -27, 42, -63, -23, 35, 26, 45,
+    0, 48, 47, 6, 63, 50, 19, 55, 13, 100, -14, 15, -78};
+
+static const float kDense3WeightScales[kDense3Units] = {8.061220e-03f,
+    1.588232e-02f, 1.135571e-02f, 1.257293e-02f, 7.612701e-03f, 2.732283e-06f,
+    8.793756e-03f, 1.630767e-02f, 3.472441e-06f, 1.266642e-02f, 1.258652e-02f,
+    9.521205e-03f, 8.724724e-03f, 1.376291e-02f, 8.641969e-03f, 9.622819e-03f,
+    1.763675e-02f, 1.441408e-02f, 1.707922e-02f, 1.407759e-02f, 1.032681e-02f,
+    9.870331e-03f, 1.230929e-02f, 8.977614e-03f, 3.377953e-06f, 8.681709e-03f,
+    1.028185e-02f, 8.283528e-03f, 1.280128e-02f, 1.106328e-02f, 1.091843e-02f,
+    3.433071e-06f};
+
+static const int8_t kPhonemeWeightsInt8[kDense3Units * kPhonemeUnits] = {-70,
+    -20, 14, 1, 0, 0, 0, 25, 0, 0, 0, 0, 0, -127, 55, 0, -124, 0, 0, 23, -3, 39,
+    -1, 56, 0, -12, -74, 0, -36, 0, 0, 0, 60, -11, -1, -44, -4, 0, 57, 79, 0,
+    57, -25, 36, -22, 52, 0, -23, 1, -24, 59, -127, 0, -59, 7, -43, 0, 0, 34,
+    21, 25, 0, 0, 0, 106, -22, -6, 4, -1, 0, 24, 0, 0, -127, 8, 49, 56, -34, 0,
+    22, 3, -116, 71, -15, -1, 5, 3, 26, 0, 49, 34, -30, 0, 0, 0, 0, 51, 0, 1,
+    -35, -42, 0, 2, 12, 0, 2, -44, 40, 23, 1, -18, 37, -24, 30, -1, -127, -37,
+    -19, -19, 34, 0, 21, 47, 13, 9, 13, -3, 0, 39, 12, -46, 0, 4, 0, 32, 55, 0,
+    82, -23, 47, 4, 11, -2, -33, 0, -1, -3, -127, -1, -7, 0, -77, 0, 10, 6, -2,
+    80, 0, 62, 0, 20, -1, -3, -1, -25, 0, 28, 31, 0, -1, 0, 17, 18, -1, -6, 16,
+    -1, -56, 31, 3, 127, -56, 1, 26, 0, 0, 22, 0, -19, 0, -6, 0, -13, 28, -11,
+    -44, 1, 0, 1, 90, 0, 1, 39, 55, -25, 0, 32, 0, -5, -127, 21, -112, -98, -94,
+    0, 1, 0, 0, 0, 0, 3, 36, 0, 0, 127, 8, -57, -39, -10, 0, 0, -47, 0, -96,
+    -35, -1, 79, -12, -24, -2, -1, -48, 100, -23, -2, 1, 25, 84, 0, 26, 96, -57,
+    1, -23, 0, 0, 0, 28, -53, -1, 0, 0, -47, -1, 0, 4, -70, -61, 0, -30, -4, 15,
+    12, 0, 122, -106, -1, 127, -14, -85, 0, 0, 43, 45, -96, 1, -2, 0, -2, 99,
+    -127, -23, -94, 0, -76, 0, 0, -102, 76, -1, -9, -3, 18, 11, 36, -85, 15, 12,
+    0, -53, -12, 61, 0, -5, 31, -67, 34, -5, 0, 0, 36, 91, -103, 5, 60, 0, -36,
+    -53, 0, -80, -4, -53, 110, 0, -2, -46, -1, 41, 14, 6, 21, 5, 28, 127, 0, 1,
+    73, 21, -90, 10, -120, 0, -1, 50, -41, 55, 1, 0, -127, 33, 0, 2, 33, -29,
+    -5, 2, 47, 12, 1, -9, -19, 0, -26, -11, 66, -3, 0, 0, 40, -10, -65, 0, 41,
+    0, -12, -3, -26, -26, -127, 0, 0, -11, 0, 55, -1, -12, 1, 12, 0, 36, 33, 1,
+    -45, -81, 87, -2, -9, 0, 0, 60, 42, 1, -5, 1, 0, 0, 7, 0, -127, 0, -1, 0,
+    17, -54, 0, 87, -70, -26, 12, 23, 29, 0, 4, -63, 0, -63, 0, -1, -60, 0, 0,
+    21, -106, 74, 102, 75, 0, 0, 3, 14, -52, 15, 0, 0, 27, -11, 0, 0, -40, -58,
+    -8, -67, -1, -1, 18, 113, -58, -127, 4, 0, -23, 69, 0, 1, 28, 1, -8, 4, 5,
+    0, -41, 35, -45, 4, 0, 0, 0, 0, 0, 0, -44, -40, 2, -22, 1, 0, 1, 37, -42,
+    -5, 104, -18, -15, 0, 0, 21, 0, 0, -127, 11, 32, 0, 2, -1, 60, 34, 0, 0,
+    -30, -15, 0, -1, -81, -46, -127, 34, 98, -1, 0, 0, -5, 1, 1, -104, 109, -1,
+    0, -109, 78, 46, 1, 0, -2, 0, 0, 0, 32, 64, -3, 0, 60, 17, 0, 0, -1, -75,
+    -38, -98, 28, 56, 38, -9, 63, -27, 0, -48, -127, -76, 0, 0, -12, -1, 0, -57,
+    95, 0, -24, 31, 5, 28, 0, 0, 0, 0, 0, 59, -12, -17, 100, -21, 0, 54, 0, -15,
+    0, -14, 18, -53, 127, -23, 0, 0, -43, -61, -2, 0, -21, 0, 9, 34, 52, 0, 17,
+    0, 41, -10, 0, 0, 1, -81, -13, -93, 1, 15, -11, -70, -36, 11, -15, 0, 67,
+    -61, 0, 0, 3, -26, -6, 16, 127, 0, -1, -23, -39, 0, -39, 0, 3, 14, 0, 57, 0,
+    14, -28, 0, 58, -19, -127, 25, 32, 17, 9, 30, 77, 18, 0, -4, -7, 1, 0, -50,
+    -11, 0, -11, -1, 39, 85, -25, 0, -28, -67, 0, -64, -64, 22, 0, -94, 0, 6,
+    -122, 0, -1, 51, 0, -12, 4, -127, 0, 76, 0, 29, -1, 72, 0, 0, -44, 1, 0,
+    127, 0, 0, -28, -40, 0, -37, -3, 16, 0, -14, -62, -26, -102, -54, 6, 0, -9,
+    -11, 0, 0, 0, 65, -11, 28, 5, 5, -11, 0, -56, 16, -13, 39, 1, 0, 0, -28, 0,
+    0, 46, 0, -53, -64, -15, 0, -53, -58, -44, -3, 22, -38, 1, 9, 0, 46, -9,
+    127, 0, -41, 0, 0, 2, 77, 127, -86, -93, 0, -12, -122, 0, 1, 63, 0, 49, 12,
+    -1, -37, -48, 0, 0, 5, 1, 72, -58, -88, 0, 0, -1, 0, -49, 0, -1, 0, -47, 4,
+    89, -120, 0, 0, 2, 0, 0, -24, 33, -32, 25, 28, 76, -16, -127, 10, -50, 45,
+    0, 74, 5, -113, 0, 10, 3, 19, 8, -40, -70, 0, 0, -1, 84, 59, -1, 0, 7, -11,
+    0, -106, 85, 20, 58, 1, -85, 45, -4, 26, -31, 0, 0, 0, -60, 2, 0, -81, -38,
+    -127, -1, -1, -54, 0, 22, -53, 51, 0, 1, 0, 1, 20, 0, -97, 70, -3, 2, 99,
+    -25, 17, -127, 0, -127, 2, 31, 127, -1, -27, 0, -1, 0, -46, 87, -102, 1, 0,
+    -26, -27, 49, -42, 1, 0, -55, -75, 0, -15, 6, 16, 5, 0, -55, 1, -78, 34, 34,
+    17, -1, 0, -28, -52, 0, -33, -25, -48, 1, 105, 127, 0, 127, -71, 2, -51, 7,
+    0, -64, 0, 0, 0, 54, -22, 45, 0, 0, 0, -69, 29, 47, 29, 73, -7, 0, -45, 0,
+    -9, 0, 0, 0, 42, 89, 0, 0, -95, 23, 0, 47, 0, 1, -79, 0, 62, 110, 8, -127,
+    -28, -88, -1, 25, 12, 26, 1, 0, -41, -29, 0, 0, -69, -18, 97, -12, 1, 0, 0,
+    113, -127, 2, 22, 5, 0, -82, 0, 0, 65, 102, -8, -69, -69, -26, 1, 3, 1, 0,
+    -6, 1, 32, 0, 0, 0, -5, -3, 58, 42, -5, 7, 0, -20, 1, -9, 1, 0, 0, -17, 68,
+    0, -21, 21, -43, -67, 56, -95, -105, 7, 47, 83, 59, -1, 6, 12, 0, 0, 0,
+    -127, -60, -6, 18, -22, 0, -8, -87, -9, 0, 7, 0, -35, 127, 0, 5, 0, -60, 0,
+    21, -36, -81, 18, -17, -23, 43, 0, 1, -1, 12, 0, 0, -1, -1, 0, 0, 42, 0, 4,
+    -16, 0, 0, 0, 0, 9, 0, 0, 0, 0, 55, -17, 26, 0, -127, 19, 7, 0, 1, -1, 2,
+    11, 5, 0, -64, -3, 0, 0, 29, 0, 0, 0, -43, -1, -1, -7, 0, 2, 44, 0, 0, 0,
+    48, 0, -14, 13, -127, 23, 0, -21, -10, 0, 18, 12, -6, 0, -30, 5, 16, 35, -1,
+    2, 0, -1, -2, 0, 0, 63, 0, 0, -56, 0, 2, -27, 64, 1, 31, -14, 0, -1, -17,
+    -39, 8, 0, 19, 1, 0, 0, -35, 0, -23, -13, -127, 1, 0, 0, -7, 0, -37, 94, 0,
+    -6, 9, 0, 0, 0, 75, 40, 1, 32, 8, -5, 0, -76, 7, 0, 21, -4, 2, 0, 13, -1, 9,
+    0, -127, 0, 0, -42, -39, 25, 0, 2, 0, 0, -123, 0, 1, -83, 54, -107, 107,
+    116, -127, 50, 0, 23, 1, 0, 39, 0, 22, 0, -25, -8, 0, -1, -103, -1, 0, 0,
+    -29, 0, -55, 0, 0, -10, 16, 0, 0, -2, 56, -32, 0, 127, -125, 0, 20, -1, 3,
+    0, 0, -1, 0, 0, 64, -90, -5, 0, -54, -10, 0};
+
+static const float kPhonemeWeightScales[kPhonemeUnits] = {1.670435e-02f,
+    9.749559e-03f, 1.107145e-02f, 9.626016e-03f, 1.035742e-02f, 1.805176e-02f,
+    1.072485e-02f, 6.732858e-03f, 8.792433e-03f, 7.471929e-03f, 6.029575e-03f,
+    1.360135e-02f, 1.173654e-02f, 1.188198e-02f, 8.397386e-03f, 1.703589e-02f,
+    1.156661e-02f, 1.199859e-02f, 1.054985e-02f, 1.357285e-02f, 1.808332e-02f,
+    1.175481e-02f, 1.309523e-02f, 1.610637e-02f, 1.031223e-02f, 1.112805e-02f,
+    9.413512e-03f, 7.895417e-03f, 1.318085e-02f, 1.615887e-02f, 1.230056e-02f,
+    1.563058e-02f, 7.988724e-03f, 1.415664e-02f, 1.839027e-02f, 1.935465e-02f,
+    1.676851e-02f, 1.373050e-02f, 9.764205e-03f, 1.449621e-02f};
+
+#endif /* AUDIO_TO_TACTILE_SRC_PHONETICS_CLASSIFY_PHONEME_PARAMS_INT8_H_ */
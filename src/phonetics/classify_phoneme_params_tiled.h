@@ -0,0 +1,4518 @@
+/* Copyright 2020 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Tiled layout of the first layer weights of the phoneme classifier network,
+ * used by ClassifyPhonemeStreamer. In kDense1Weights, the weights that apply to
+ * one frame of the window are 56-value runs strided by kInputUnits, so the
+ * streamer, which applies one frame at a time, reads the matrix in strides.
+ * Here the same weights are stored in the order the streamer consumes them,
+ *
+ *   kDense1WeightsTiled[c + kNumCarlChannels * (j + kDense1Units * p)]
+ *       = kDense1Weights[c + kNumCarlChannels * p + kInputUnits * j],
+ *
+ * for channel c, unit j, and window position p. The weights for each position
+ * are then one contiguous tile of kNumCarlChannels * kDense1Units values,
+ * read sequentially. This file can be regenerated with
+ * extras/python/phonetics/export_model_as_c_data.py using
+ * --tile_first_layer_frames=5.
+ */
+
+#ifndef AUDIO_TO_TACTILE_SRC_PHONETICS_CLASSIFY_PHONEME_PARAMS_TILED_H_
+#define AUDIO_TO_TACTILE_SRC_PHONETICS_CLASSIFY_PHONEME_PARAMS_TILED_H_
+
+#include "phonetics/classify_phoneme_params.h"
+
+static const float kDense1WeightsTiled[kInputUnits * kDense1Units] = {
+    0.213090f,  0.152651f,  0.067763f,  -0.026020f, -0.066406f, -0.059886f,
+    -0.037214f, 0.000509f,  0.012181f,  -0.018899f, -0.049516f, -0.068855f,
+    -0.084984f, -0.064659f, 0.030841f,  0.114549f,  0.105400f,  0.042086f,
+    -0.001388f, -0.033472f, -0.121054f, -0.242105f, -0.244760f, -0.093745f,
+    0.083775f,  0.207759f,  0.294702f,  0.336306f,  0.297790f,  0.192885f,
+    0.106267f,  0.047422f,  0.015045f,  0.012439f,  0.058792f,  0.057276f,
+    -0.019869f, -0.065898f, -0.051148f, -0.002984f, 0.004421f,  0.003203f,
+    -0.038546f, -0.096216f, -0.102447f, -0.022809f, -0.042835f, -0.087217f,
+    -0.063222f, -0.025688f, -0.008076f, 0.019272f,  0.047798f,  0.063383f,
+    0.012731f,  -0.049532f, 0.199495f,  0.203449f,  0.181552f,  0.149937f,
+    0.092150f,  0.036601f,  0.002843f,  -0.002458f, -0.023607f, -0.042195f,
+    -0.028023f, -0.003502f, -0.010882f, -0.032651f, -0.069737f, -0.156885f,
+    -0.274225f, -0.323642f, -0.248186f, -0.111548f, -0.027271f, -0.058501f,
+    -0.172406f, -0.243659f, -0.181297f, -0.044226f, 0.049925f,  0.057521f,
+    0.045568f,  0.063280f,  0.083082f,  0.086740f,  0.051881f,  -0.013579f,
+    -0.105018f, -0.205665f, -0.277599f, -0.269731f, -0.206249f, -0.151409f,
+    -0.070391f, -0.037133f, -0.000234f, 0.041236f,  0.098707f,  0.097555f,
+    0.015993f,  0.026706f,  0.032982f,  -0.029788f, -0.041568f, -0.006267f,
+    -0.066104f, -0.154914f, -0.124541f, -0.036884f, 0.050903f,  0.088255f,
+    0.097438f,  0.080545f,  0.053921f,  0.034976f,  0.038605f,  0.005105f,
+    -0.022470f, -0.007174f, 0.023074f,  0.039736f,  0.019469f,  -0.038712f,
+    -0.131096f, -0.180779f, -0.124086f, -0.037486f, 0.030605f,  0.094618f,
+    0.130881f,  0.146196f,  0.116120f,  0.064699f,  0.095286f,  0.202956f,
+    0.334947f,  0.443058f,  0.413100f,  0.238700f,  -0.013635f, -0.225098f,
+    -0.321536f, -0.315363f, -0.233826f, -0.150431f, -0.116766f, -0.125353f,
+    -0.128575f, -0.141228f, -0.099325f, -0.072628f, -0.143954f, -0.104586f,
+    -0.033059f, -0.012194f, 0.009162f,  0.107989f,  0.136682f,  0.201902f,
+    0.262972f,  0.247754f,  0.177134f,  0.069263f,  0.045924f,  -0.018938f,
+    -0.045604f, -0.067504f, -0.107724f, -0.163456f, -0.212791f, -0.237446f,
+    -0.209411f, -0.137776f, -0.071656f, -0.069248f, -0.125331f, -0.145281f,
+    -0.056357f, 0.095622f,  0.189874f,  0.158520f,  0.094212f,  0.100976f,
+    0.143821f,  0.146902f,  0.105460f,  0.081239f,  0.083472f,  0.061310f,
+    0.008917f,  -0.037335f, -0.072632f, -0.124748f, -0.195680f, -0.240109f,
+    -0.219788f, -0.174904f, -0.154618f, -0.170379f, -0.194869f, -0.199659f,
+    -0.182011f, -0.144774f, -0.076297f, -0.005515f, 0.042871f,  0.163256f,
+    0.229317f,  0.211746f,  0.219870f,  0.233971f,  0.130187f,  0.004893f,
+    -0.013882f, -0.054776f, -0.106043f, -0.109940f, -0.138623f, -0.259305f,
+    -0.221292f, -0.097247f, -0.050929f, -0.041792f, -0.037930f, -0.004413f,
+    0.054375f,  0.116943f,  0.115532f,  0.062196f,  -0.005537f, -0.024754f,
+    0.012335f,  0.059289f,  0.086819f,  0.074494f,  0.039573f,  0.040339f,
+    0.076416f,  0.116804f,  0.166580f,  0.190347f,  0.141012f,  0.077502f,
+    0.062903f,  0.083700f,  0.101024f,  0.114796f,  0.132114f,  0.147348f,
+    0.183301f,  0.212839f,  0.219362f,  0.217138f,  0.309599f,  0.442676f,
+    0.532415f,  0.582341f,  0.641416f,  0.674944f,  0.554321f,  0.315994f,
+    0.090040f,  -0.137335f, -0.436511f, -0.673009f, -0.751002f, -0.679954f,
+    -0.538847f, -0.388821f, -0.252472f, -0.206489f, -0.080984f, 0.121040f,
+    0.240440f,  0.319571f,  0.458571f,  0.712816f,  0.196205f,  0.101052f,
+    0.010881f,  -0.055229f, -0.068586f, -0.036226f, -0.005551f, 0.001979f,
+    -0.002688f, -0.005887f, -0.004519f, 0.038623f,  0.105762f,  0.112245f,
+    0.072067f,  0.035700f,  -0.002444f, -0.073859f, -0.154358f, -0.145680f,
+    0.003433f,  0.168041f,  0.173936f,  -0.058352f, -0.414621f, -0.687867f,
+    -0.742202f, -0.584293f, -0.272264f, 0.068045f,  0.292025f,  0.351894f,
+    0.362698f,  0.318038f,  0.239974f,  0.222459f,  0.172071f,  0.051210f,
+    -0.035584f, -0.120341f, -0.099873f, -0.005644f, -0.001915f, 0.044726f,
+    0.103013f,  0.024760f,  -0.012917f, -0.052045f, -0.038756f, -0.039910f,
+    -0.031465f, -0.083264f, -0.113562f, -0.052793f, -0.032740f, 0.053559f,
+    0.149526f,  0.165049f,  0.141925f,  0.067717f,  -0.048239f, -0.145928f,
+    -0.179068f, -0.205120f, -0.248137f, -0.240946f, -0.173429f, -0.100228f,
+    -0.043802f, -0.021989f, -0.022172f, 0.011690f,  0.088246f,  0.133893f,
+    0.096005f,  0.007084f,  -0.062078f, -0.045010f, 0.046195f,  0.149851f,
+    0.224863f,  0.278301f,  0.324264f,  0.346649f,  0.348329f,  0.342133f,
+    0.295146f,  0.187382f,  0.049313f,  -0.052230f, -0.131323f, -0.218670f,
+    -0.279611f, -0.296930f, -0.293639f, -0.234244f, -0.098830f, -0.035800f,
+    -0.095399f, -0.083386f, -0.045132f, -0.045639f, -0.028571f, 0.006157f,
+    0.003341f,  0.046495f,  0.025793f,  -0.075362f, -0.121762f, -0.098028f,
+    -0.040706f, -0.127936f, -0.128058f, -0.054729f, 0.050002f,  0.156850f,
+    0.198472f,  0.159661f,  0.116773f,  0.081316f,  0.012862f,  -0.062696f,
+    -0.073440f, 0.016604f,  0.168598f,  0.290628f,  0.299111f,  0.209709f,
+    0.102637f,  0.063605f,  0.102163f,  0.161341f,  0.179239f,  0.144357f,
+    0.122771f,  0.196840f,  0.350523f,  0.481002f,  0.516139f,  0.470232f,
+    0.387680f,  0.299691f,  0.194094f,  0.059623f,  -0.094989f, -0.251258f,
+    -0.399859f, -0.537295f, -0.666626f, -0.782076f, -0.873749f, -0.928774f,
+    -0.920401f, -0.848042f, -0.724065f, -0.564939f, -0.374065f, -0.184097f,
+    -0.065375f, -0.026448f, -0.001340f, 0.012180f,  0.040015f,  0.139127f,
+    0.224272f,  0.133104f,  0.193388f,  0.378709f,  -0.179895f, -0.176220f,
+    -0.168752f, -0.166889f, -0.118829f, -0.041667f, 0.030880f,  0.060983f,
+    0.043897f,  0.002629f,  0.015072f,  0.059594f,  0.036121f,  0.025896f,
+    0.080568f,  0.111716f,  0.085865f,  0.046042f,  0.019130f,  0.001020f,
+    0.010888f,  0.042532f,  0.052970f,  0.069646f,  0.097778f,  0.095982f,
+    0.052844f,  0.005759f,  0.017649f,  0.084400f,  0.140301f,  0.153098f,
+    0.139736f,  0.108180f,  0.054645f,  0.012110f,  -0.041563f, -0.126811f,
+    -0.219258f, -0.240742f, -0.242467f, -0.282560f, -0.264985f, -0.210342f,
+    -0.196220f, -0.190548f, -0.173635f, -0.092300f, -0.037041f, -0.006696f,
+    -0.031842f, 0.027153f,  -0.012979f, -0.154690f, -0.099768f, -0.071030f,
+    -0.019686f, -0.083724f, -0.087397f, -0.041185f, 0.022260f,  0.050568f,
+    0.031528f,  0.025934f,  0.075324f,  0.113822f,  0.091248f,  0.033077f,
+    -0.003394f, -0.009104f, 0.000098f,  0.010360f,  0.030894f,  0.104308f,
+    0.207047f,  0.285371f,  0.313954f,  0.270617f,  0.170075f,  0.070489f,
+    -0.019326f, -0.119088f, -0.211785f, -0.231955f, -0.191643f, -0.133286f,
+    -0.061557f, -0.021292f, 0.009230f,  0.053925f,  0.092115f,  0.094009f,
+    0.070702f,  0.082253f,  0.128073f,  0.174524f,  0.181403f,  0.141241f,
+    0.076308f,  0.024408f,  0.037967f,  0.091707f,  -0.001842f, -0.015876f,
+    0.002864f,  -0.011183f, 0.013113f,  -0.033823f, -0.175437f, -0.170453f,
+    -0.250231f, -0.435356f, 0.168950f,  0.092424f,  0.027967f,  -0.003451f,
+    -0.030608f, -0.024596f, -0.013430f, 0.001056f,  -0.007963f, 0.004134f,
+    0.050609f,  0.061886f,  0.011994f,  -0.064097f, -0.110613f, -0.131983f,
+    -0.184987f, -0.238906f, -0.213443f, -0.112419f, -0.012810f, -0.041308f,
+    -0.184372f, -0.311583f, -0.293202f, -0.086819f, 0.215578f,  0.502740f,
+    0.733455f,  0.763160f,  0.624274f,  0.351113f,  0.066973f,  -0.162118f,
+    -0.228551f, -0.199983f, -0.171120f, -0.127108f, -0.065103f, 0.018494f,
+    0.009971f,  0.012082f,  -0.039635f, -0.089918f, -0.102409f, -0.048185f,
+    -0.034638f, -0.034392f, -0.007639f, -0.003470f, 0.064446f,  0.058536f,
+    0.024248f,  0.072255f,  0.022894f,  -0.052129f, -0.111843f, -0.101259f,
+    -0.071977f, -0.030946f, 0.012846f,  0.027200f,  0.012348f,  -0.015837f,
+    -0.025627f, -0.022116f, -0.011155f, -0.001996f, -0.006267f, 0.012148f,
+    0.088181f,  0.191939f,  0.260365f,  0.244351f,  0.188422f,  0.154724f,
+    0.149779f,  0.151992f,  0.142399f,  0.106882f,  0.051592f,  0.016769f,
+    0.044249f,  0.126076f,  0.208773f,  0.244276f,  0.259219f,  0.286678f,
+    0.294371f,  0.256930f,  0.168795f,  0.015347f,  -0.158992f, -0.277200f,
+    -0.281937f, -0.218312f, -0.158234f, -0.125993f, -0.097742f, -0.090388f,
+    -0.164920f, -0.322726f, -0.458874f, -0.485929f, -0.485758f, -0.539358f,
+    -0.614879f, -0.710356f, -0.789361f, -0.678874f, -0.521889f, -0.540412f,
+    0.252914f,  0.243555f,  0.220448f,  0.164870f,  0.100763f,  0.061984f,
+    0.102996f,  0.156925f,  0.138152f,  0.002783f,  -0.170057f, -0.251597f,
+    -0.204612f, -0.100774f, -0.016478f, -0.034815f, -0.164958f, -0.274876f,
+    -0.247654f, -0.094067f, 0.079576f,  0.161697f,  0.118625f,  -0.001614f,
+    -0.108226f, -0.122031f, -0.041557f, 0.053190f,  0.093220f,  0.079815f,
+    0.013547f,  -0.058037f, -0.090870f, -0.089887f, -0.060037f, -0.025557f,
+    -0.024836f, 0.004317f,  0.067617f,  0.103147f,  0.097331f,  0.069142f,
+    0.085793f,  0.120438f,  0.050405f,  -0.010043f, 0.033480f,  0.000266f,
+    -0.055354f, -0.016752f, 0.063111f,  0.065802f,  0.072899f,  0.141660f,
+    0.057734f,  -0.096683f, -0.170243f, -0.182428f, -0.130539f, -0.018140f,
+    0.098844f,  0.185259f,  0.199381f,  0.165143f,  0.129716f,  0.048999f,
+    -0.051269f, -0.079520f, -0.025610f, 0.033284f,  0.056218f,  0.066268f,
+    0.071782f,  0.037413f,  -0.033095f, -0.059946f, 0.006442f,  0.140259f,
+    0.266031f,  0.316092f,  0.299599f,  0.279873f,  0.271838f,  0.241056f,
+    0.217242f,  0.212179f,  0.186101f,  0.133838f,  0.078366f,  0.073084f,
+    0.086255f,  0.086021f,  0.121318f,  0.184273f,  0.160884f,  0.105297f,
+    0.065065f,  -0.000212f, -0.069200f, -0.134291f, -0.171651f, -0.220990f,
+    -0.262051f, -0.224214f, -0.222358f, -0.278795f, -0.319107f, -0.297220f,
+    -0.275034f, -0.173069f, -0.157335f, -0.131649f, -0.275151f, -0.350500f,
+    -0.447975f, -0.496836f, -0.475328f, -0.420216f, -0.355503f, -0.285070f,
+    -0.197645f, -0.138155f, -0.110035f, -0.101181f, -0.084090f, -0.033023f,
+    0.025827f,  0.049479f,  0.057006f,  0.061096f,  0.059722f,  0.055891f,
+    0.033292f,  -0.007253f, -0.013396f, 0.027465f,  0.056277f,  0.058459f,
+    0.062581f,  0.051080f,  -0.016246f, -0.030961f, 0.047556f,  0.089787f,
+    0.046252f,  0.012813f,  0.035359f,  0.067476f,  0.053250f,  0.034102f,
+    0.059852f,  0.043857f,  0.050204f,  0.027090f,  0.019271f,  -0.016156f,
+    -0.057875f, 0.030063f,  0.023748f,  0.053654f,  0.058507f,  0.039236f,
+    -0.023766f, 0.021975f,  -0.013976f, -0.023491f, -0.012937f, -0.030815f,
+    -0.354545f, -0.242263f, -0.098050f, 0.017838f,  0.101229f,  0.151477f,
+    0.132432f,  0.052904f,  -0.026438f, -0.076180f, -0.084989f, -0.066123f,
+    -0.063817f, -0.086402f, -0.112518f, -0.132832f, -0.140202f, -0.123104f,
+    -0.058447f, 0.036118f,  0.105297f,  0.108623f,  0.045812f,  -0.042114f,
+    -0.107518f, -0.127949f, -0.093886f, -0.021947f, 0.037820f,  0.039377f,
+    0.036626f,  0.078270f,  0.143176f,  0.201595f,  0.197632f,  0.120303f,
+    0.035303f,  -0.032430f, -0.066623f, 0.009660f,  0.090123f,  0.123052f,
+    0.135320f,  0.019082f,  -0.181218f, -0.346547f, -0.464046f, -0.498443f,
+    -0.429511f, -0.313353f, -0.087068f, 0.193969f,  0.337221f,  0.374329f,
+    0.542202f,  0.719999f,  -0.107085f, -0.048749f, -0.000819f, 0.004757f,
+    -0.065795f, -0.052113f, 0.045891f,  0.062729f,  0.027151f,  0.020123f,
+    0.020936f,  -0.027779f, -0.038515f, 0.021739f,  0.001542f,  -0.059426f,
+    -0.058645f, -0.039685f, -0.031678f, -0.020083f, 0.007829f,  0.036393f,
+    0.039111f,  -0.000107f, 0.014973f,  0.056234f,  0.018308f,  -0.026519f,
+    0.060362f,  0.099850f,  0.014287f,  0.028607f,  0.043120f,  0.028359f,
+    -0.009339f, -0.042127f, -0.038035f, -0.013727f, -0.008309f, 0.000364f,
+    -0.037062f, -0.016642f, -0.045898f, -0.082215f, -0.002987f, -0.021055f,
+    0.017204f,  0.046394f,  0.038104f,  -0.035212f, -0.087495f, -0.088442f,
+    -0.013708f, -0.058247f, -0.004145f, 0.046353f,  -0.161660f, -0.079337f,
+    0.032285f,  0.126331f,  0.163230f,  0.180718f,  0.183194f,  0.186315f,
+    0.210958f,  0.245371f,  0.261812f,  0.250538f,  0.222542f,  0.206733f,
+    0.218276f,  0.203559f,  0.136327f,  0.072058f,  0.075280f,  0.129556f,
+    0.157838f,  0.145459f,  0.120553f,  0.099216f,  0.104201f,  0.142818f,
+    0.218197f,  0.317093f,  0.381313f,  0.367119f,  0.266628f,  0.139986f,
+    0.014674f,  -0.114046f, -0.195354f, -0.236876f, -0.252482f, -0.241914f,
+    -0.156120f, -0.063483f, -0.052528f, -0.088307f, -0.183786f, -0.226661f,
+    -0.274882f, -0.378881f, -0.354272f, -0.250560f, -0.182944f, -0.133453f,
+    -0.101859f, -0.125365f, -0.145987f, -0.130199f, -0.101169f, -0.083785f,
+    0.102343f,  0.001327f,  -0.106347f, -0.143310f, -0.139825f, -0.126862f,
+    -0.069879f, -0.015413f, 0.004481f,  0.002442f,  0.013121f,  0.013262f,
+    -0.024916f, -0.033497f, -0.002486f, 0.014008f,  -0.007671f, -0.034628f,
+    -0.062056f, -0.090316f, -0.032439f, 0.186286f,  0.420031f,  0.495484f,
+    0.399798f,  0.146929f,  -0.202633f, -0.450926f, -0.469455f, -0.300294f,
+    -0.080286f, 0.087422f,  0.116801f,  0.073601f,  0.020289f,  -0.051842f,
+    -0.094085f, -0.050020f, -0.022725f, -0.031911f, -0.012011f, 0.040327f,
+    0.015474f,  0.000331f,  -0.004661f, -0.035968f, 0.029979f,  0.002648f,
+    -0.047232f, -0.039381f, 0.013769f,  0.022051f,  0.005445f,  0.027942f,
+    0.042751f,  -0.104882f, -0.117452f, -0.021455f, 0.073439f,  0.096732f,
+    0.062401f,  -0.000765f, -0.030447f, -0.046965f, -0.073091f, -0.046806f,
+    0.008631f,  0.011467f,  -0.012299f, -0.009911f, -0.004534f, -0.018269f,
+    -0.038006f, -0.058182f, -0.056513f, -0.014334f, 0.057502f,  0.089027f,
+    0.063403f,  0.018021f,  -0.016992f, -0.015992f, 0.029323f,  0.047906f,
+    0.013096f,  0.018329f,  0.033070f,  0.020292f,  -0.047521f, -0.081365f,
+    -0.022937f, 0.102899f,  0.086511f,  -0.068098f, -0.124880f, -0.139080f,
+    -0.047653f, 0.068995f,  0.154210f,  0.202156f,  0.252283f,  0.307758f,
+    0.354655f,  0.431663f,  0.411032f,  0.410181f,  0.421176f,  0.323816f,
+    0.285018f,  0.319213f,  0.260978f,  0.117170f,  0.207488f,  0.163914f,
+    0.094629f,  0.015260f,  -0.048836f, -0.082932f, -0.113407f, -0.162025f,
+    -0.217923f, -0.222545f, -0.135542f, -0.011856f, 0.047882f,  0.019087f,
+    -0.052227f, -0.121859f, -0.172510f, -0.211230f, -0.259450f, -0.327483f,
+    -0.396153f, -0.427366f, -0.397766f, -0.314714f, -0.226140f, -0.167287f,
+    -0.114492f, -0.041967f, 0.053844f,  0.164016f,  0.279119f,  0.359125f,
+    0.364798f,  0.327000f,  0.302731f,  0.314669f,  0.306890f,  0.244669f,
+    0.210754f,  0.221430f,  0.211943f,  0.233661f,  0.275675f,  0.200856f,
+    0.101173f,  0.021585f,  -0.051303f, -0.074172f, -0.062629f, -0.046411f,
+    -0.026546f, 0.033008f,  0.103629f,  0.037838f,  -0.074843f, -0.075872f,
+    0.388370f,  0.450450f,  0.476300f,  0.426243f,  0.343599f,  0.283926f,
+    0.256011f,  0.223593f,  0.175226f,  0.165927f,  0.204974f,  0.208948f,
+    0.127391f,  0.005731f,  -0.078294f, -0.071209f, 0.003958f,  0.078897f,
+    0.106000f,  0.102884f,  0.119740f,  0.168719f,  0.186921f,  0.128662f,
+    0.035353f,  -0.051289f, -0.107839f, -0.132309f, -0.150027f, -0.165486f,
+    -0.173558f, -0.194111f, -0.230335f, -0.253077f, -0.243741f, -0.232185f,
+    -0.266414f, -0.357041f, -0.409472f, -0.354455f, -0.269073f, -0.178604f,
+    -0.129015f, -0.147222f, -0.170066f, -0.132859f, -0.157016f, -0.234460f,
+    -0.175718f, -0.091610f, -0.021862f, 0.071521f,  0.147258f,  0.143273f,
+    0.135951f,  0.157716f,  -0.227561f, -0.177517f, -0.095802f, -0.022710f,
+    0.009959f,  -0.005676f, -0.073017f, -0.141864f, -0.133751f, -0.050466f,
+    0.029673f,  0.051341f,  -0.001206f, -0.091258f, -0.134303f, -0.096098f,
+    -0.049878f, -0.036113f, -0.007934f, 0.047648f,  0.105639f,  0.157397f,
+    0.186188f,  0.166913f,  0.079682f,  -0.032813f, -0.091482f, -0.074769f,
+    -0.035840f, -0.018526f, 0.006925f,  0.000902f,  -0.015309f, 0.039664f,
+    0.113744f,  0.177263f,  0.201877f,  0.166584f,  0.130731f,  0.117164f,
+    0.050000f,  0.003503f,  -0.036685f, -0.146857f, -0.264866f, -0.396652f,
+    -0.467286f, -0.440053f, -0.425567f, -0.405388f, -0.395830f, -0.466047f,
+    -0.495241f, -0.421392f, -0.432374f, -0.531490f, -0.006011f, -0.006008f,
+    -0.006012f, -0.006008f, -0.006011f, -0.006008f, -0.006011f, -0.006009f,
+    -0.006010f, -0.006010f, -0.006009f, -0.006010f, -0.006009f, -0.006011f,
+    -0.006009f, -0.006010f, -0.006009f, -0.006010f, -0.006010f, -0.006010f,
+    -0.006010f, -0.006009f, -0.006010f, -0.006009f, -0.006010f, -0.006010f,
+    -0.006010f, -0.006009f, -0.006011f, -0.006008f, -0.006013f, -0.006004f,
+    -0.006018f, -0.005999f, -0.006023f, -0.005995f, -0.006025f, -0.005996f,
+    -0.006021f, -0.006002f, -0.006015f, -0.006006f, -0.006013f, -0.006006f,
+    -0.006014f, -0.006005f, -0.006015f, -0.006005f, -0.006014f, -0.006007f,
+    -0.006011f, -0.006010f, -0.006009f, -0.006012f, -0.006008f, -0.006012f,
+    -0.230380f, -0.070423f, 0.103502f,  0.214383f,  0.227800f,  0.176511f,
+    0.092242f,  -0.009590f, -0.112945f, -0.197327f, -0.226835f, -0.180145f,
+    -0.094833f, -0.030541f, -0.021603f, -0.036810f, -0.013192f, 0.056271f,
+    0.129823f,  0.156227f,  0.124778f,  0.062075f,  0.002831f,  -0.011884f,
+    0.018452f,  0.058075f,  0.103965f,  0.168597f,  0.216939f,  0.225146f,
+    0.227846f,  0.245163f,  0.258988f,  0.241881f,  0.197848f,  0.120442f,
+    0.024296f,  -0.042565f, -0.138878f, -0.175075f, -0.168270f, -0.147911f,
+    -0.060754f, 0.009374f,  0.024341f,  0.012121f,  -0.009207f, -0.004807f,
+    -0.013934f, -0.054358f, -0.047790f, 0.033413f,  0.102455f,  0.010220f,
+    -0.002915f, 0.093019f,  0.205415f,  0.096678f,  0.009402f,  -0.015073f,
+    -0.008713f, 0.001714f,  0.045455f,  0.087792f,  0.030355f,  -0.023534f,
+    -0.003675f, 0.035613f,  0.099684f,  0.113609f,  0.019654f,  -0.073107f,
+    -0.102256f, -0.038152f, 0.057942f,  0.088997f,  0.014736f,  -0.164522f,
+    -0.370981f, -0.452433f, -0.340403f, -0.067503f, 0.249395f,  0.463754f,
+    0.507854f,  0.396417f,  0.178008f,  -0.055603f, -0.180303f, -0.156003f,
+    -0.042865f, 0.006228f,  0.000464f,  0.018676f,  -0.025436f, -0.059123f,
+    -0.031449f, -0.030514f, 0.007943f,  0.109195f,  0.118764f,  0.042794f,
+    -0.019525f, -0.051857f, -0.030187f, -0.051333f, -0.170216f, -0.190880f,
+    -0.087528f, -0.115698f, -0.070327f, 0.338544f,  -0.003365f, -0.003365f,
+    -0.003365f, -0.003365f, -0.003365f, -0.003365f, -0.003365f, -0.003365f,
+    -0.003364f, -0.003366f, -0.003364f, -0.003367f, -0.003362f, -0.003368f,
+    -0.003361f, -0.003369f, -0.003361f, -0.003369f, -0.003361f, -0.003367f,
+    -0.003364f, -0.003364f, -0.003367f, -0.003362f, -0.003369f, -0.003361f,
+    -0.003369f, -0.003362f, -0.003367f, -0.003364f, -0.003365f, -0.003366f,
+    -0.003364f, -0.003367f, -0.003363f, -0.003366f, -0.003364f, -0.003365f,
+    -0.003365f, -0.003364f, -0.003366f, -0.003364f, -0.003366f, -0.003363f,
+    -0.003366f, -0.003364f, -0.003366f, -0.003365f, -0.003364f, -0.003367f,
+    -0.003362f, -0.003369f, -0.003360f, -0.003370f, -0.003359f, -0.003370f,
+    -0.072887f, -0.041598f, -0.021521f, -0.020681f, -0.020418f, 0.003790f,
+    0.057463f,  0.104498f,  0.136302f,  0.150142f,  0.136393f,  0.096356f,
+    0.039952f,  -0.010789f, -0.082433f, -0.191585f, -0.287057f, -0.343970f,
+    -0.383106f, -0.424777f, -0.456192f, -0.445860f, -0.397357f, -0.332891f,
+    -0.270027f, -0.224061f, -0.190792f, -0.148846f, -0.094535f, -0.030988f,
+    0.038694f,  0.101192f,  0.156970f,  0.193654f,  0.216921f,  0.235619f,
+    0.209260f,  0.091923f,  -0.088909f, -0.201280f, -0.234614f, -0.240960f,
+    -0.168114f, -0.084354f, -0.039847f, 0.066184f,  0.202909f,  0.228758f,
+    0.121177f,  0.022711f,  0.019176f,  0.075502f,  0.087453f,  0.093399f,
+    0.127680f,  0.209110f,  -0.396656f, -0.320067f, -0.229059f, -0.143672f,
+    -0.045797f, 0.042193f,  0.092259f,  0.093795f,  0.084442f,  0.069648f,
+    0.031715f,  -0.007148f, 0.001638f,  0.077719f,  0.171872f,  0.194000f,
+    0.130839f,  0.038229f,  -0.046866f, -0.105246f, -0.119185f, -0.128629f,
+    -0.182355f, -0.271263f, -0.377119f, -0.489171f, -0.577256f, -0.616891f,
+    -0.605016f, -0.555526f, -0.470435f, -0.358604f, -0.242575f, -0.157746f,
+    -0.122767f, -0.104741f, -0.057721f, 0.020596f,  0.082856f,  0.075025f,
+    0.008539f,  -0.086912f, -0.149657f, -0.153724f, -0.106359f, -0.059318f,
+    -0.035141f, -0.037939f, -0.030790f, -0.006826f, 0.043372f,  0.141623f,
+    0.185788f,  0.130754f,  0.066198f,  0.001438f,  -0.134964f, -0.233084f,
+    -0.335829f, -0.370746f, -0.323696f, -0.243557f, -0.198709f, -0.185472f,
+    -0.179914f, -0.155980f, -0.106884f, -0.064223f, -0.051853f, -0.036546f,
+    -0.001269f, 0.008624f,  -0.022755f, -0.061324f, -0.066771f, -0.021244f,
+    0.050741f,  0.091608f,  0.065292f,  0.031196f,  0.055367f,  0.113038f,
+    0.115587f,  0.040049f,  -0.024489f, -0.057230f, -0.078318f, -0.062153f,
+    -0.002237f, 0.077182f,  0.141283f,  0.186039f,  0.246554f,  0.308187f,
+    0.315049f,  0.301816f,  0.237441f,  0.185715f,  0.118701f,  -0.021749f,
+    -0.179355f, -0.255196f, -0.251807f, -0.234594f, -0.170470f, -0.087800f,
+    -0.009827f, -0.009381f, -0.055524f, -0.015728f, -0.071284f, -0.248120f,
+    -0.271585f, -0.108562f, 0.096682f,  0.248349f,  0.269046f,  0.205247f,
+    0.162280f,  0.168754f,  0.146989f,  0.125057f,  0.099985f,  0.039350f,
+    -0.024549f, -0.096315f, -0.187002f, -0.208660f, -0.134811f, -0.033607f,
+    0.012253f,  -0.007774f, -0.017420f, -0.008084f, -0.002272f, 0.021784f,
+    0.023562f,  -0.060474f, -0.195536f, -0.299058f, -0.348137f, -0.309329f,
+    -0.224418f, -0.183086f, -0.171539f, -0.144764f, -0.066430f, -0.003928f,
+    -0.010467f, -0.029339f, 0.024806f,  0.081429f,  0.125672f,  0.177660f,
+    0.158860f,  0.105933f,  0.057154f,  -0.037559f, 0.027141f,  0.081359f,
+    -0.016399f, -0.056624f, 0.037715f,  0.110199f,  0.134327f,  0.178790f,
+    0.204194f,  0.185514f,  -0.166382f, -0.143345f, -0.137479f, -0.149406f,
+    -0.178479f, -0.212494f, -0.157335f, 0.050778f,  0.294896f,  0.317601f,
+    0.075383f,  -0.185878f, -0.238567f, -0.070554f, 0.163181f,  0.272926f,
+    0.192424f,  0.035955f,  -0.052515f, -0.021875f, 0.049000f,  0.063815f,
+    0.030299f,  -0.017659f, -0.057633f, -0.070174f, -0.059043f, -0.051658f,
+    -0.066233f, -0.065902f, -0.056885f, -0.110119f, -0.180516f, -0.160520f,
+    -0.099022f, 0.016319f,  0.111563f,  0.127222f,  0.110324f,  0.102800f,
+    0.104935f,  0.082380f,  0.048274f,  -0.009369f, 0.002977f,  0.008173f,
+    0.003069f,  0.010263f,  -0.096579f, -0.135824f, 0.002399f,  0.040307f,
+    -0.028577f, 0.039164f,  0.008783f,  -0.377485f, 0.386389f,  0.339994f,
+    0.269017f,  0.169757f,  0.077515f,  0.001981f,  -0.023340f, 0.025968f,
+    0.111080f,  0.160615f,  0.143264f,  0.080788f,  0.011851f,  -0.019739f,
+    -0.026294f, -0.010678f, 0.074837f,  0.206894f,  0.312852f,  0.339686f,
+    0.250515f,  0.111746f,  -0.005047f, -0.103695f, -0.198344f, -0.255338f,
+    -0.234997f, -0.186863f, -0.203233f, -0.241507f, -0.228533f, -0.181252f,
+    -0.133447f, -0.124025f, -0.147292f, -0.182607f, -0.207688f, -0.200981f,
+    -0.139572f, -0.092252f, -0.024210f, 0.008393f,  0.027922f,  0.066145f,
+    0.196112f,  0.297554f,  0.348682f,  0.308419f,  0.184774f,  0.221115f,
+    0.231827f,  0.127631f,  -0.033356f, -0.117294f, -0.122892f, -0.182607f,
+    0.305284f,  0.217515f,  0.096387f,  -0.012761f, -0.077397f, -0.091112f,
+    -0.091286f, -0.099795f, -0.106883f, -0.078971f, -0.014465f, 0.038845f,
+    0.056018f,  0.024463f,  -0.103236f, -0.308092f, -0.435391f, -0.366353f,
+    -0.119360f, 0.180910f,  0.369295f,  0.377872f,  0.266851f,  0.130783f,
+    0.053051f,  0.034023f,  0.046667f,  0.083531f,  0.130842f,  0.138737f,
+    0.101430f,  0.026832f,  -0.026857f, -0.040377f, -0.055594f, -0.060613f,
+    -0.015689f, 0.036856f,  0.081713f,  0.077866f,  0.019300f,  0.029752f,
+    0.042606f,  -0.003404f, -0.053814f, -0.107710f, -0.128691f, -0.070129f,
+    -0.077490f, -0.121398f, -0.113077f, -0.040822f, -0.013804f, -0.015190f,
+    0.099427f,  0.333631f,  -0.079513f, -0.057800f, -0.040002f, -0.038953f,
+    -0.043047f, -0.033119f, -0.011880f, -0.042169f, -0.081986f, -0.093496f,
+    -0.067192f, -0.010767f, 0.051785f,  0.095684f,  0.070544f,  -0.000787f,
+    -0.101037f, -0.196554f, -0.170419f, -0.020384f, 0.154400f,  0.232886f,
+    0.110606f,  -0.132781f, -0.354677f, -0.495377f, -0.496400f, -0.285764f,
+    0.078838f,  0.359995f,  0.440850f,  0.408865f,  0.298354f,  0.118451f,
+    -0.024075f, -0.091395f, -0.094011f, -0.072890f, -0.124856f, -0.107151f,
+    -0.030703f, 0.007370f,  0.022306f,  -0.029767f, -0.034965f, 0.034631f,
+    -0.023834f, -0.065987f, -0.027414f, -0.005178f, -0.018124f, -0.020178f,
+    -0.039246f, -0.075423f, -0.060673f, -0.090478f, -0.092738f, -0.046698f,
+    0.022410f,  0.097764f,  0.143703f,  0.114915f,  0.012017f,  -0.084599f,
+    -0.081554f, -0.036421f, -0.029801f, -0.074454f, -0.123632f, -0.132125f,
+    -0.099080f, -0.036870f, 0.025661f,  0.027587f,  -0.013754f, -0.068869f,
+    -0.134411f, -0.204355f, -0.277588f, -0.346185f, -0.348188f, -0.240450f,
+    -0.029517f, 0.242927f,  0.470303f,  0.537962f,  0.484422f,  0.361792f,
+    0.245055f,  0.202076f,  0.184489f,  0.147714f,  0.081477f,  -0.011545f,
+    -0.088713f, -0.073750f, -0.077275f, -0.082465f, -0.068310f, -0.106732f,
+    -0.111072f, -0.063361f, -0.009568f, -0.059963f, -0.063033f, 0.045345f,
+    0.077034f,  0.018070f,  -0.023064f, 0.043470f,  0.143842f,  0.052985f,
+    -0.212774f, -0.105538f, -0.037904f, 0.044655f,  0.113572f,  0.148509f,
+    0.115314f,  0.041241f,  0.031923f,  0.055917f,  0.043026f,  0.010846f,
+    -0.001406f, 0.004166f,  -0.007807f, -0.029848f, -0.024465f, 0.009473f,
+    0.000600f,  -0.027713f, -0.036713f, -0.037371f, -0.043059f, -0.021811f,
+    0.019134f,  0.037296f,  0.019663f,  0.019763f,  0.003237f,  0.002320f,
+    -0.021606f, -0.056057f, -0.071888f, -0.035779f, -0.015512f, 0.027049f,
+    -0.014237f, -0.044071f, -0.052316f, -0.114518f, -0.100270f, -0.108937f,
+    -0.068117f, -0.063430f, 0.026951f,  0.070465f,  0.058474f,  0.064764f,
+    -0.007011f, 0.003609f,  0.063154f,  0.058494f,  -0.014507f, -0.032789f,
+    0.150136f,  0.092402f,  -0.193614f, -0.109874f, 0.030268f,  0.122859f,
+    0.134925f,  0.069754f,  -0.012508f, -0.033563f, -0.051090f, -0.056317f,
+    0.012083f,  0.110201f,  0.107300f,  -0.056583f, -0.254515f, -0.324012f,
+    -0.153884f, 0.150674f,  0.272634f,  0.099621f,  -0.160635f, -0.315367f,
+    -0.275610f, -0.078395f, 0.079584f,  0.127857f,  0.149609f,  0.171943f,
+    0.151438f,  0.050641f,  -0.107050f, -0.191040f, -0.153969f, -0.062711f,
+    0.007331f,  0.007711f,  -0.000186f, -0.031765f, -0.071176f, -0.016257f,
+    0.032103f,  0.025372f,  0.023884f,  0.056884f,  0.055702f,  0.005181f,
+    -0.082994f, -0.062315f, 0.060091f,  0.033310f,  -0.113582f, -0.153350f,
+    -0.093516f, -0.102175f, -0.148058f, 0.205187f,  0.093909f,  0.063473f,
+    0.015383f,  0.025211f,  0.026142f,  0.019908f,  0.001424f,  0.023893f,
+    0.032390f,  -0.009579f, -0.009582f, 0.015454f,  0.025661f,  0.056934f,
+    0.087847f,  0.092847f,  0.103321f,  0.095506f,  0.066971f,  0.079085f,
+    0.076606f,  0.051622f,  0.011966f,  -0.032409f, -0.055813f, -0.046036f,
+    -0.061632f, -0.117230f, -0.099155f, -0.041487f, 0.036936f,  0.129381f,
+    0.135801f,  0.152955f,  0.191181f,  0.188885f,  0.152848f,  0.162390f,
+    0.150190f,  0.103936f,  0.047584f,  -0.013162f, -0.005159f, -0.032377f,
+    -0.058719f, -0.053960f, -0.054020f, -0.103601f, -0.072158f, 0.006700f,
+    -0.073428f, -0.068411f, 0.029845f,  0.005723f,  0.007766f,  -0.046526f,
+    0.025794f,  -0.051182f, -0.119934f, -0.139099f, -0.106186f, -0.015660f,
+    0.085809f,  0.136339f,  0.119076f,  0.091236f,  0.104967f,  0.124083f,
+    0.122003f,  0.110990f,  0.076870f,  -0.014098f, -0.124553f, -0.174202f,
+    -0.138997f, -0.050867f, 0.035346f,  0.082597f,  0.087144f,  0.054477f,
+    0.025065f,  0.011279f,  -0.018541f, -0.072935f, -0.105005f, -0.109704f,
+    -0.111148f, -0.095489f, -0.056154f, -0.011860f, 0.050269f,  0.089905f,
+    0.079542f,  0.056897f,  0.062088f,  0.075177f,  0.052905f,  0.048491f,
+    -0.033421f, -0.122890f, -0.164475f, -0.121179f, -0.069129f, -0.034636f,
+    -0.009690f, 0.049961f,  0.083246f,  0.022066f,  0.012298f,  0.059425f,
+    0.058013f,  0.089160f,  0.035433f,  0.063706f,  0.035516f,  -0.015159f,
+    -0.067108f, -0.086166f, -0.076762f, -0.031035f, 0.010056f,  0.025308f,
+    0.028217f,  0.006116f,  -0.010919f, -0.027983f, -0.068930f, -0.037398f,
+    0.065550f,  0.071901f,  -0.013698f, -0.048134f, -0.039315f, -0.029671f,
+    -0.048145f, -0.094410f, -0.080490f, -0.010188f, 0.051443f,  0.084067f,
+    0.098272f,  0.094673f,  0.100477f,  0.117053f,  0.128291f,  0.105614f,
+    0.063287f,  0.044766f,  0.073995f,  0.127598f,  0.176067f,  0.223117f,
+    0.276921f,  0.315216f,  0.347850f,  0.360135f,  0.288166f,  0.105330f,
+    -0.150660f, -0.436500f, -0.753727f, -1.020865f, -1.229598f, -1.479314f,
+    -1.650341f, -1.493422f, -1.333739f, -1.366305f, -0.823545f, -0.649978f,
+    -0.390918f, -0.111637f, 0.113599f,  0.208283f,  0.196243f,  0.142545f,
+    0.083130f,  0.004002f,  -0.064261f, -0.067552f, -0.015329f, 0.038316f,
+    0.090766f,  0.144385f,  0.200120f,  0.252819f,  0.238631f,  0.121985f,
+    -0.024296f, -0.091687f, -0.043770f, 0.043112f,  0.069224f,  0.038968f,
+    0.012251f,  -0.004757f, -0.026159f, -0.024504f, 0.001277f,  0.010511f,
+    -0.007408f, -0.011229f, -0.001577f, 0.018007f,  0.051076f,  0.055991f,
+    -0.018520f, -0.076940f, -0.033532f, -0.010429f, -0.028015f, -0.051239f,
+    -0.046234f, 0.007994f,  0.069036f,  0.045880f,  -0.014233f, 0.001978f,
+    0.001165f,  -0.003461f, -0.010597f, -0.070101f, -0.033396f, 0.062301f,
+    -0.031429f, -0.051421f, -0.063201f, -0.070357f, -0.074223f, -0.075572f,
+    -0.088651f, -0.093753f, -0.074944f, -0.033355f, 0.008964f,  0.023580f,
+    0.000806f,  -0.015949f, 0.015889f,  0.067505f,  0.079955f,  0.069952f,
+    0.095761f,  0.137417f,  0.151126f,  0.106362f,  0.016162f,  -0.073673f,
+    -0.132274f, -0.140523f, -0.123131f, -0.124484f, -0.141183f, -0.146480f,
+    -0.145958f, -0.141638f, -0.132128f, -0.077859f, 0.051564f,  0.194761f,
+    0.292189f,  0.392097f,  0.571607f,  0.663949f,  0.528054f,  0.309915f,
+    0.120081f,  -0.047848f, -0.242835f, -0.412091f, -0.491884f, -0.477356f,
+    -0.317060f, -0.210490f, -0.143950f, -0.002310f, 0.138464f,  0.093826f,
+    0.059132f,  0.222627f,  -0.002749f, -0.002748f, -0.002749f, -0.002747f,
+    -0.002750f, -0.002746f, -0.002751f, -0.002745f, -0.002753f, -0.002744f,
+    -0.002754f, -0.002743f, -0.002755f, -0.002742f, -0.002756f, -0.002741f,
+    -0.002757f, -0.002740f, -0.002758f, -0.002739f, -0.002757f, -0.002740f,
+    -0.002756f, -0.002742f, -0.002755f, -0.002743f, -0.002754f, -0.002743f,
+    -0.002754f, -0.002743f, -0.002753f, -0.002745f, -0.002752f, -0.002746f,
+    -0.002750f, -0.002747f, -0.002750f, -0.002747f, -0.002750f, -0.002748f,
+    -0.002749f, -0.002749f, -0.002748f, -0.002750f, -0.002747f, -0.002751f,
+    -0.002746f, -0.002751f, -0.002746f, -0.002751f, -0.002746f, -0.002750f,
+    -0.002747f, -0.002750f, -0.002748f, -0.002749f, -0.203307f, -0.169542f,
+    -0.123610f, -0.090586f, -0.096506f, -0.121324f, -0.113602f, -0.059637f,
+    -0.001981f, 0.027714f,  0.022352f,  -0.009334f, -0.050893f, -0.095928f,
+    -0.111405f, -0.039570f, 0.099219f,  0.203061f,  0.223963f,  0.217513f,
+    0.230371f,  0.232181f,  0.181854f,  0.100801f,  0.056619f,  0.090858f,
+    0.184590f,  0.274014f,  0.307113f,  0.279087f,  0.242057f,  0.244834f,
+    0.301882f,  0.359628f,  0.368722f,  0.274069f,  0.076071f,  -0.159515f,
+    -0.343311f, -0.390674f, -0.410795f, -0.437529f, -0.370480f, -0.243463f,
+    -0.104100f, -0.020306f, -0.064988f, -0.135791f, -0.075732f, 0.008698f,
+    0.019183f,  -0.010894f, -0.022688f, -0.058962f, -0.074947f, -0.053612f,
+    0.294519f,  0.123726f,  -0.092012f, -0.225381f, -0.250883f, -0.193500f,
+    -0.121588f, -0.035266f, 0.035517f,  0.080593f,  0.096489f,  0.080594f,
+    0.050548f,  0.036914f,  0.022980f,  -0.000837f, -0.020519f, -0.017993f,
+    -0.017452f, 0.001957f,  0.072407f,  0.137911f,  0.128343f,  0.093649f,
+    0.046233f,  -0.007010f, 0.003328f,  0.064313f,  0.104193f,  0.093781f,
+    0.063210f,  0.048070f,  0.032458f,  -0.032259f, -0.084696f, -0.076337f,
+    -0.065396f, -0.010275f, 0.044783f,  0.009240f,  0.073793f,  0.128015f,
+    0.037153f,  0.007944f,  0.056095f,  0.117910f,  0.206430f,  0.224793f,
+    0.149706f,  0.076948f,  0.084342f,  -0.072899f, -0.263627f, -0.293968f,
+    -0.227276f, -0.605872f, -0.027701f, -0.040361f, -0.049629f, -0.029092f,
+    -0.029602f, -0.023367f, 0.028196f,  0.084974f,  0.058881f,  0.004206f,
+    -0.025174f, -0.025087f, 0.014716f,  0.014874f,  -0.041464f, -0.062544f,
+    -0.040802f, -0.047824f, -0.107799f, -0.148067f, -0.113334f, -0.066428f,
+    -0.067976f, -0.078765f, -0.062256f, -0.014610f, 0.041629f,  0.049859f,
+    0.045998f,  0.039750f,  0.018490f,  0.018904f,  0.020255f,  0.004491f,
+    0.011845f,  0.022195f,  -0.008988f, -0.016338f, -0.025742f, 0.014938f,
+    0.101480f,  0.163219f,  0.162925f,  0.121057f,  0.023700f,  -0.008281f,
+    0.104314f,  0.188207f,  0.161042f,  0.177471f,  0.223441f,  0.349348f,
+    0.419258f,  0.380562f,  0.394070f,  0.367083f,  0.055933f,  0.129854f,
+    0.163515f,  0.144276f,  0.127759f,  0.112684f,  0.108096f,  0.063506f,
+    0.040129f,  0.056955f,  0.071808f,  0.064279f,  0.035958f,  0.048316f,
+    0.096005f,  0.069382f,  -0.003037f, -0.031468f, 0.051582f,  0.172156f,
+    0.219331f,  0.199933f,  0.167214f,  0.141317f,  0.131074f,  0.139351f,
+    0.134721f,  0.084995f,  0.085587f,  0.176544f,  0.243307f,  0.302938f,
+    0.251234f,  0.190756f,  0.237048f,  0.305970f,  0.393337f,  0.499809f,
+    0.614381f,  0.726721f,  0.778646f,  0.740940f,  0.658816f,  0.468691f,
+    0.342878f,  0.249024f,  0.145110f,  0.031356f,  -0.023463f, -0.007082f,
+    0.027101f,  0.155707f,  0.263477f,  0.235933f,  0.471030f,  0.552533f,
+    0.442898f,  0.352081f,  0.220382f,  0.104878f,  0.014131f,  -0.067791f,
+    -0.130575f, -0.142298f, -0.160798f, -0.191936f, -0.203611f, -0.192661f,
+    -0.185486f, -0.155254f, -0.059856f, 0.065761f,  0.074835f,  -0.095781f,
+    -0.319152f, -0.446778f, -0.437647f, -0.319432f, -0.165527f, -0.049853f,
+    0.029734f,  0.101841f,  0.148769f,  0.135059f,  0.075055f,  0.019725f,
+    0.012311f,  0.047307f,  0.101644f,  0.140454f,  0.144396f,  0.123570f,
+    0.071308f,  -0.013572f, -0.097456f, -0.147298f, -0.193907f, -0.240704f,
+    -0.239036f, -0.242631f, -0.269078f, -0.207918f, -0.051576f, 0.120164f,
+    0.159756f,  0.162051f,  0.173603f,  0.126231f,  0.109652f,  0.133487f,
+    -0.031701f, -0.250332f, -0.168592f, -0.148025f, -0.128998f, -0.120606f,
+    -0.111666f, -0.079314f, -0.001303f, 0.126780f,  0.225664f,  0.233859f,
+    0.152579f,  0.039601f,  -0.012921f, 0.011606f,  0.041996f,  0.026855f,
+    -0.042301f, -0.135764f, -0.223627f, -0.244998f, -0.134846f, 0.079100f,
+    0.270483f,  0.347837f,  0.329176f,  0.237987f,  0.074763f,  -0.070269f,
+    -0.105270f, -0.088492f, -0.073273f, -0.081708f, -0.109851f, -0.064110f,
+    0.025386f,  0.045979f,  0.041123f,  0.085923f,  0.148169f,  0.205043f,
+    0.154574f,  0.107392f,  0.083499f,  0.058479f,  0.027785f,  0.005215f,
+    0.025221f,  0.054905f,  0.007947f,  0.010731f,  0.039542f,  0.023078f,
+    0.007524f,  -0.003984f, 0.008224f,  0.095398f,  -0.043831f, -0.000213f,
+    0.045698f,  0.088138f,  0.105893f,  0.060841f,  -0.022709f, -0.100384f,
+    -0.141947f, -0.163692f, -0.158581f, -0.115981f, -0.095410f, -0.121632f,
+    -0.177883f, -0.282343f, -0.424457f, -0.544298f, -0.596722f, -0.572030f,
+    -0.512425f, -0.490289f, -0.537918f, -0.624406f, -0.705554f, -0.753920f,
+    -0.759732f, -0.713757f, -0.614940f, -0.482098f, -0.357439f, -0.280610f,
+    -0.239384f, -0.214309f, -0.171335f, -0.091780f, 0.025654f,  0.100718f,
+    0.077908f,  0.024231f,  -0.009208f, -0.048093f, -0.081884f, -0.032801f,
+    0.034745f,  0.039833f,  0.059497f,  0.120341f,  0.152410f,  0.131996f,
+    0.095620f,  0.082758f,  -0.008736f, -0.118612f, -0.084587f, -0.080943f,
+    -0.042525f, 0.025318f,  0.109101f,  0.178445f,  0.210880f,  0.199689f,
+    0.148759f,  0.082530f,  0.038935f,  0.017902f,  -0.014719f, -0.077249f,
+    -0.162317f, -0.238070f, -0.253632f, -0.203842f, -0.138538f, -0.097869f,
+    -0.071043f, -0.063985f, -0.081206f, -0.099560f, -0.089114f, -0.050153f,
+    -0.003955f, 0.017505f,  -0.009352f, -0.078189f, -0.144493f, -0.154767f,
+    -0.100822f, -0.000371f, 0.061070f,  0.028627f,  -0.045699f, -0.078024f,
+    -0.098506f, -0.110481f, -0.023250f, 0.140151f,  0.330955f,  0.493985f,
+    0.530644f,  0.483475f,  0.338081f,  0.141627f,  -0.074380f, -0.244009f,
+    -0.242594f, -0.239035f, -0.220375f, -0.135272f, -0.102460f, -0.127846f,
+    -0.038829f, 0.085392f,  0.051907f,  0.039437f,  0.046238f,  0.049857f,
+    0.022474f,  -0.029830f, -0.093412f, -0.134144f, -0.157733f, -0.177463f,
+    -0.176263f, -0.156305f, -0.108075f, -0.048636f, -0.015095f, -0.044098f,
+    -0.158001f, -0.270978f, -0.252290f, -0.056874f, 0.203188f,  0.384349f,
+    0.445386f,  0.371060f,  0.222827f,  0.113764f,  0.075347f,  0.060497f,
+    0.046865f,  0.081610f,  0.152962f,  0.187796f,  0.135250f,  0.019347f,
+    -0.077345f, -0.137466f, -0.137090f, -0.100513f, -0.108820f, -0.097964f,
+    -0.029421f, -0.041612f, -0.079521f, -0.023012f, 0.026896f,  -0.043352f,
+    -0.130971f, -0.154895f, -0.043589f, 0.003314f,  -0.084791f, -0.153968f,
+    -0.136565f, -0.135384f, -0.065376f, -0.004510f, 0.315775f,  0.193482f,
+    0.018222f,  -0.137031f, -0.212773f, -0.202332f, -0.114019f, -0.005247f,
+    0.077496f,  0.117015f,  0.147658f,  0.186991f,  0.199368f,  0.185827f,
+    0.139430f,  0.042615f,  -0.066475f, -0.096600f, -0.003952f, 0.148330f,
+    0.249178f,  0.240020f,  0.125953f,  -0.007073f, -0.071339f, -0.085824f,
+    -0.101395f, -0.089581f, -0.013979f, 0.031592f,  0.045569f,  0.045553f,
+    0.052355f,  0.067446f,  0.036594f,  -0.006797f, -0.000474f, 0.024694f,
+    0.087347f,  0.118422f,  0.049904f,  -0.062830f, -0.121803f, -0.107948f,
+    -0.109269f, -0.064202f, 0.023476f,  0.125125f,  0.130079f,  0.012574f,
+    -0.003158f, 0.097148f,  0.081243f,  0.011535f,  0.027351f,  0.244276f,
+    0.316028f,  0.271934f,  0.157049f,  -0.023074f, -0.203129f, -0.286066f,
+    -0.248420f, -0.141570f, -0.053978f, -0.021241f, -0.054822f, -0.093012f,
+    -0.085450f, -0.018680f, 0.021698f,  -0.050894f, -0.181929f, -0.221515f,
+    -0.131670f, -0.020932f, 0.046885f,  0.083545f,  0.071303f,  0.005060f,
+    -0.074936f, -0.153417f, -0.207849f, -0.177446f, -0.056122f, 0.065500f,
+    0.136313f,  0.139867f,  0.124077f,  0.089983f,  0.093383f,  0.117048f,
+    0.001727f,  -0.222401f, -0.424985f, -0.532351f, -0.462289f, -0.290955f,
+    -0.191910f, -0.113143f, -0.030493f, 0.061194f,  0.180829f,  0.332056f,
+    0.402134f,  0.327371f,  0.169394f,  -0.000476f, -0.140636f, -0.244997f,
+    -0.238718f, -0.121188f, 0.162415f,  0.182516f,  0.163243f,  0.094836f,
+    -0.010868f, -0.106141f, -0.136220f, -0.152533f, -0.173871f, -0.180026f,
+    -0.180583f, -0.180243f, -0.149994f, -0.108499f, -0.117243f, -0.180803f,
+    -0.253780f, -0.275279f, -0.239685f, -0.199612f, -0.177220f, -0.130858f,
+    -0.004783f, 0.163251f,  0.258549f,  0.242343f,  0.184001f,  0.149236f,
+    0.150835f,  0.148359f,  0.108618f,  0.068578f,  0.048609f,  0.063778f,
+    0.120253f,  0.184528f,  0.190854f,  0.143131f,  0.119201f,  0.099265f,
+    0.071988f,  0.026380f,  0.016832f,  0.025616f,  0.018740f,  0.045314f,
+    0.026965f,  -0.039923f, -0.081685f, -0.069608f, -0.003385f, 0.023706f,
+    0.014507f,  -0.022000f, -0.009463f, 0.121196f,  0.300355f,  0.170228f,
+    0.027081f,  -0.061967f, -0.042867f, 0.032046f,  0.067955f,  0.037885f,
+    0.000136f,  0.009848f,  0.017211f,  0.004061f,  0.011674f,  0.017295f,
+    -0.039115f, -0.076447f, -0.013093f, 0.077190f,  0.118649f,  0.092455f,
+    0.027764f,  -0.034335f, -0.026839f, 0.045535f,  0.069093f,  0.009603f,
+    -0.025854f, -0.003436f, -0.018116f, -0.072491f, -0.111244f, -0.074585f,
+    -0.034578f, -0.099416f, -0.211333f, -0.216675f, -0.174647f, -0.148570f,
+    -0.054618f, 0.034542f,  0.026880f,  0.074005f,  0.148324f,  0.099946f,
+    0.060168f,  0.057169f,  0.048621f,  0.069859f,  0.054943f,  -0.006992f,
+    0.010325f,  -0.023482f, -0.071524f, -0.059811f, 0.006302f,  0.136737f,
+    -0.115638f, -0.088267f, -0.025183f, 0.049596f,  0.083050f,  0.062186f,
+    -0.003023f, -0.092745f, -0.173428f, -0.186422f, -0.102104f, 0.024652f,
+    0.130079f,  0.172361f,  0.119199f,  -0.013675f, -0.169827f, -0.254896f,
+    -0.206154f, -0.104732f, -0.101579f, -0.218358f, -0.345414f, -0.409655f,
+    -0.427022f, -0.439888f, -0.432683f, -0.301802f, 0.010374f,  0.308890f,
+    0.512617f,  0.559520f,  0.469907f,  0.344669f,  0.235591f,  0.162523f,
+    0.092491f,  -0.016630f, -0.109732f, -0.041464f, 0.042435f,  0.067849f,
+    0.110152f,  0.176800f,  0.179167f,  0.061399f,  -0.043398f, -0.052195f,
+    -0.027077f, -0.101952f, -0.225519f, -0.157088f, -0.011970f, -0.075283f,
+    -0.054235f, 0.315425f,  -0.245544f, -0.171988f, -0.092823f, -0.042964f,
+    -0.023610f, -0.050274f, -0.071825f, -0.043672f, 0.004747f,  0.015360f,
+    0.018424f,  0.023698f,  0.008997f,  -0.038112f, -0.072666f, -0.067129f,
+    -0.041805f, -0.040712f, -0.086094f, -0.141208f, -0.155656f, -0.071105f,
+    0.129500f,  0.356553f,  0.511238f,  0.538888f,  0.425370f,  0.173405f,
+    -0.137217f, -0.274972f, -0.224132f, -0.112774f, -0.030538f, 0.003099f,
+    -0.005148f, -0.025340f, -0.031081f, -0.037132f, -0.043469f, -0.064953f,
+    -0.030310f, -0.014716f, 0.000804f,  0.018210f,  0.012909f,  0.021002f,
+    -0.042526f, -0.049415f, -0.030975f, -0.015812f, -0.101875f, -0.136574f,
+    -0.099822f, -0.025700f, 0.021274f,  0.146957f,  0.377363f,  0.282184f,
+    0.119597f,  -0.072979f, -0.269845f, -0.424155f, -0.471107f, -0.376024f,
+    -0.205430f, -0.050481f, 0.080143f,  0.154315f,  0.131696f,  0.093259f,
+    0.117858f,  0.157614f,  0.129773f,  0.043977f,  -0.033254f, -0.033136f,
+    0.021229f,  0.032449f,  -0.005949f, -0.013544f, 0.027329f,  0.074712f,
+    0.079817f,  0.024232f,  -0.039065f, -0.043490f, -0.039047f, -0.043883f,
+    -0.054962f, -0.033939f, -0.003375f, -0.041031f, -0.056625f, -0.029137f,
+    -0.042568f, -0.036200f, 0.004105f,  -0.009527f, -0.008754f, -0.003910f,
+    0.022321f,  0.028020f,  0.016310f,  0.050611f,  0.017016f,  -0.063785f,
+    -0.085850f, -0.036669f, 0.011521f,  0.037184f,  0.125787f,  0.248112f,
+    -0.002193f, -0.002182f, -0.002196f, -0.002178f, -0.002201f, -0.002174f,
+    -0.002205f, -0.002170f, -0.002208f, -0.002167f, -0.002211f, -0.002165f,
+    -0.002213f, -0.002163f, -0.002216f, -0.002159f, -0.002221f, -0.002152f,
+    -0.002228f, -0.002144f, -0.002237f, -0.002136f, -0.002244f, -0.002131f,
+    -0.002246f, -0.002133f, -0.002240f, -0.002141f, -0.002229f, -0.002154f,
+    -0.002216f, -0.002168f, -0.002202f, -0.002182f, -0.002188f, -0.002196f,
+    -0.002173f, -0.002212f, -0.002157f, -0.002228f, -0.002142f, -0.002241f,
+    -0.002130f, -0.002250f, -0.002124f, -0.002254f, -0.002123f, -0.002252f,
+    -0.002127f, -0.002246f, -0.002137f, -0.002233f, -0.002151f, -0.002220f,
+    -0.002161f, -0.002209f, -0.234824f, -0.214163f, -0.189664f, -0.161030f,
+    -0.118390f, -0.066322f, -0.015045f, 0.029486f,  0.057590f,  0.063732f,
+    0.028217f,  -0.072091f, -0.189870f, -0.218265f, -0.108552f, 0.075871f,
+    0.216253f,  0.236614f,  0.160630f,  0.066974f,  0.023706f,  0.031143f,
+    0.033852f,  0.007844f,  -0.006389f, 0.004310f,  0.024106f,  0.057979f,
+    0.091389f,  0.099835f,  0.068131f,  -0.005333f, -0.107955f, -0.185794f,
+    -0.139394f, -0.004898f, 0.107395f,  0.218949f,  0.333905f,  0.370666f,
+    0.295233f,  0.163765f,  0.026854f,  -0.039084f, -0.074804f, -0.105347f,
+    -0.049669f, 0.003790f,  -0.009103f, 0.041606f,  0.108115f,  0.051701f,
+    -0.031170f, -0.049634f, -0.167337f, -0.450385f, -0.000971f, -0.000928f,
+    -0.000973f, -0.000932f, -0.000967f, -0.000938f, -0.000961f, -0.000944f,
+    -0.000955f, -0.000948f, -0.000953f, -0.000949f, -0.000953f, -0.000948f,
+    -0.000955f, -0.000946f, -0.000957f, -0.000944f, -0.000959f, -0.000943f,
+    -0.000959f, -0.000943f, -0.000958f, -0.000946f, -0.000954f, -0.000951f,
+    -0.000948f, -0.000957f, -0.000941f, -0.000964f, -0.000934f, -0.000972f,
+    -0.000926f, -0.000980f, -0.000918f, -0.000987f, -0.000912f, -0.000992f,
+    -0.000909f, -0.000993f, -0.000908f, -0.000995f, -0.000906f, -0.000996f,
+    -0.000905f, -0.000997f, -0.000905f, -0.000996f, -0.000907f, -0.000994f,
+    -0.000909f, -0.000992f, -0.000911f, -0.000990f, -0.000913f, -0.000982f,
+    -0.038235f, -0.105747f, -0.175666f, -0.219312f, -0.229287f, -0.199383f,
+    -0.159285f, -0.120567f, -0.060234f, -0.021927f, 0.018333f,  0.042713f,
+    -0.002335f, -0.056110f, -0.054207f, -0.022016f, -0.008297f, -0.033297f,
+    -0.059525f, -0.062350f, -0.081587f, -0.113363f, -0.121198f, -0.122774f,
+    -0.142342f, -0.162380f, -0.153924f, -0.095544f, -0.054578f, -0.099526f,
+    -0.174707f, -0.224918f, -0.299125f, -0.242924f, -0.190435f, -0.214980f,
+    -0.283279f, -0.344851f, -0.366714f, -0.382585f, -0.284759f, -0.257048f,
+    -0.159126f, -0.143429f, -0.128301f, -0.087224f, 0.014609f,  -0.013261f,
+    -0.026838f, 0.033806f,  0.003525f,  0.077710f,  0.089797f,  0.034293f,
+    0.058328f,  -0.062729f, -0.034351f, 0.030682f,  0.094774f,  0.135771f,
+    0.153417f,  0.156938f,  0.136294f,  0.122932f,  0.067062f,  -0.041987f,
+    -0.096011f, -0.066261f, -0.029046f, -0.040499f, -0.083151f, -0.107278f,
+    -0.082988f, -0.054064f, -0.064737f, -0.089693f, -0.094697f, -0.074199f,
+    -0.026944f, 0.035351f,  0.086589f,  0.123899f,  0.135095f,  0.106156f,
+    0.043705f,  -0.031308f, -0.109216f, -0.191619f, -0.230539f, -0.187493f,
+    -0.103464f, -0.000899f, 0.043329f,  0.006498f,  0.051304f,  0.120256f,
+    0.134399f,  0.122412f,  0.126866f,  0.197275f,  0.312764f,  0.285130f,
+    0.142852f,  0.066290f,  0.101531f,  -0.062134f, -0.253809f, -0.289627f,
+    -0.302513f, -0.256231f, -0.075184f, 0.191364f,  0.366515f,  0.307690f,
+    0.213178f,  0.087069f,  -0.040614f, -0.161078f, -0.252402f, -0.303197f,
+    -0.309357f, -0.284776f, -0.241219f, -0.172305f, -0.091108f, 0.004131f,
+    0.099593f,  0.158671f,  0.179979f,  0.168373f,  0.081220f,  -0.071919f,
+    -0.196119f, -0.192759f, -0.053087f, 0.137231f,  0.260429f,  0.256897f,
+    0.157383f,  0.020921f,  -0.099570f, -0.142444f, -0.116585f, -0.061802f,
+    -0.003618f, 0.045795f,  0.055654f,  0.034173f,  0.006373f,  -0.007392f,
+    -0.003069f, -0.002964f, -0.061907f, -0.121792f, -0.068574f, 0.031515f,
+    0.043177f,  -0.014556f, -0.006666f, 0.050370f,  0.037339f,  -0.018225f,
+    -0.015391f, -0.012059f, -0.034498f, 0.001385f,  0.043669f,  0.078891f,
+    -0.086795f, -0.075708f, -0.057322f, -0.041682f, -0.011206f, 0.011329f,
+    0.000968f,  -0.033336f, -0.069600f, -0.078435f, -0.017580f, 0.081133f,
+    0.118284f,  0.062790f,  -0.018698f, -0.048300f, -0.031542f, -0.000853f,
+    0.012397f,  0.014829f,  0.001264f,  -0.029253f, -0.041135f, -0.032624f,
+    -0.038879f, -0.057595f, -0.055645f, -0.044772f, -0.066797f, -0.062337f,
+    -0.016214f, 0.020859f,  0.037459f,  0.024526f,  -0.063219f, -0.170988f,
+    -0.231894f, -0.321768f, -0.506319f, -0.636815f, -0.622498f, -0.617855f,
+    -0.510379f, -0.320208f, -0.104734f, 0.123717f,  0.321432f,  0.373646f,
+    0.257422f,  0.266737f,  0.259538f,  0.158131f,  0.082478f,  0.113234f,
+    0.084864f,  -0.073174f, -0.076746f, -0.165475f, -0.219028f, -0.173486f,
+    -0.053126f, 0.066335f,  0.130067f,  0.118051f,  0.025724f,  -0.096333f,
+    -0.168097f, -0.161720f, -0.124665f, -0.107419f, -0.081048f, 0.029701f,
+    0.199680f,  0.307837f,  0.299218f,  0.250916f,  0.241986f,  0.245527f,
+    0.157131f,  -0.051463f, -0.255822f, -0.328496f, -0.270578f, -0.173543f,
+    -0.108944f, -0.068044f, -0.019585f, 0.026100f,  0.033106f,  -0.023665f,
+    -0.094797f, -0.096992f, -0.054345f, -0.052629f, -0.092557f, -0.118297f,
+    -0.057632f, -0.004167f, 0.006439f,  0.014528f,  0.047252f,  0.094543f,
+    0.117460f,  0.036738f,  -0.044237f, -0.046400f, -0.061575f, -0.075657f,
+    -0.040122f, -0.018980f, -0.019688f, 0.005495f,  0.058676f,  0.089718f,
+    0.108562f,  0.097681f,  0.077915f,  0.058041f,  0.043138f,  0.055616f,
+    0.022967f,  -0.040154f, -0.071499f, -0.028245f, 0.046772f,  0.059640f,
+    -0.020294f, -0.124583f, -0.155225f, -0.081528f, 0.001968f,  -0.009573f,
+    -0.088495f, -0.135449f, -0.111776f, -0.068811f, -0.056944f, -0.081434f,
+    -0.092399f, -0.064813f, -0.027588f, 0.046808f,  0.138794f,  0.149759f,
+    0.081567f,  0.000680f,  -0.039833f, -0.055924f, -0.093833f, -0.160406f,
+    -0.212352f, -0.226472f, -0.163624f, 0.001326f,  0.135247f,  0.172235f,
+    0.189746f,  0.228588f,  0.250294f,  0.176822f,  0.174428f,  0.207998f,
+    0.212723f,  0.185287f,  0.212681f,  0.114574f,  0.038132f,  0.180328f,
+    -0.164689f, -0.077804f, -0.016217f, -0.012592f, -0.014334f, 0.017704f,
+    0.070633f,  0.083883f,  0.051501f,  0.003873f,  -0.009321f, 0.043669f,
+    0.120121f,  0.148638f,  0.124699f,  0.087836f,  0.057163f,  0.024667f,
+    -0.012045f, -0.024287f, -0.007887f, -0.001026f, -0.018309f, -0.031672f,
+    -0.039323f, -0.056861f, -0.089628f, -0.096245f, -0.068187f, -0.059519f,
+    -0.036990f, 0.002507f,  0.001462f,  0.002633f,  0.044897f,  0.118027f,
+    0.183956f,  0.236318f,  0.294206f,  0.258872f,  0.174149f,  0.025362f,
+    -0.170205f, -0.318713f, -0.406929f, -0.481359f, -0.499946f, -0.274381f,
+    -0.028897f, 0.134465f,  0.355093f,  0.345697f,  0.127561f,  0.063418f,
+    0.026749f,  -0.160088f, 0.273856f,  0.132508f,  -0.015388f, -0.107610f,
+    -0.145086f, -0.146705f, -0.117056f, -0.046461f, 0.015027f,  0.015357f,
+    0.001340f,  0.041810f,  0.085347f,  0.098648f,  0.127516f,  0.146502f,
+    0.116311f,  0.075833f,  0.053608f,  0.032039f,  0.012162f,  0.024868f,
+    0.044428f,  0.029308f,  0.007916f,  0.009198f,  0.008356f,  -0.017301f,
+    -0.050163f, -0.102416f, -0.151369f, -0.176677f, -0.252930f, -0.355081f,
+    -0.435714f, -0.478214f, -0.435308f, -0.323240f, -0.110342f, 0.042566f,
+    0.140098f,  0.224236f,  0.408533f,  0.423741f,  0.364557f,  0.268362f,
+    0.177215f,  0.101003f,  -0.032380f, -0.162138f, -0.271683f, -0.388817f,
+    -0.416855f, -0.368540f, -0.322345f, -0.203598f, -0.213432f, -0.145724f,
+    -0.081888f, -0.057989f, -0.074440f, -0.069027f, -0.031250f, -0.002134f,
+    0.012594f,  -0.000023f, -0.012289f, -0.025248f, -0.041202f, -0.039080f,
+    0.007260f,  0.046028f,  0.006450f,  -0.068677f, -0.092671f, -0.068613f,
+    -0.055704f, -0.079913f, -0.122979f, -0.135575f, -0.088263f, -0.027380f,
+    0.003021f,  0.023677f,  0.068584f,  0.122603f,  0.142919f,  0.176018f,
+    0.196062f,  0.173721f,  0.142057f,  0.124035f,  0.082556f,  0.043089f,
+    0.049032f,  0.069226f,  0.069251f,  0.021630f,  -0.001349f, -0.013120f,
+    -0.018243f, 0.009356f,  0.018801f,  0.019887f,  0.025372f,  0.009016f,
+    -0.114820f, -0.143859f, -0.081556f, -0.013291f, 0.007525f,  0.010564f,
+    0.010478f,  0.164061f,  0.310635f,  0.380043f,  0.363804f,  0.283334f,
+    0.194119f,  0.134703f,  0.137229f,  0.152788f,  0.124879f,  0.050929f,
+    -0.054986f, -0.120466f, -0.097837f, -0.063235f, -0.092207f, -0.153296f,
+    -0.199724f, -0.227515f, -0.234438f, -0.209616f, -0.167030f, -0.121148f,
+    -0.055522f, -0.004005f, -0.031803f, -0.108878f, -0.119363f, -0.007692f,
+    0.109066f,  0.144004f,  0.081339f,  -0.032521f, -0.116064f, -0.176226f,
+    -0.239034f, -0.272858f, -0.231530f, -0.083249f, -0.001467f, 0.000102f,
+    -0.022167f, -0.044698f, -0.047549f, -0.035960f, -0.038019f, 0.006307f,
+    0.006988f,  0.019132f,  0.039193f,  -0.055055f, -0.141705f, -0.127673f,
+    -0.096960f, -0.127853f, -0.113431f, -0.064939f, -0.012270f, 0.022197f,
+    0.048409f,  0.046573f,  0.031395f,  0.003834f,  0.016593f,  0.064997f,
+    0.075947f,  -0.000379f, -0.098044f, -0.133535f, -0.052085f, 0.093234f,
+    0.159055f,  0.068050f,  -0.064201f, -0.082643f, -0.005857f, 0.050553f,
+    0.062734f,  0.062604f,  0.038462f,  -0.021829f, -0.043170f, 0.000928f,
+    0.025313f,  0.033973f,  0.000739f,  -0.058766f, -0.054221f, -0.034303f,
+    -0.002012f, 0.038510f,  0.003636f,  0.027042f,  0.089785f,  -0.020881f,
+    -0.026983f, 0.094046f,  0.081677f,  -0.055014f, -0.128952f, 0.026872f,
+    0.129806f,  -0.026809f, -0.404907f, -0.315661f, 0.160941f,  0.181064f,
+    -0.075782f, -0.139419f, -0.424951f, -1.030255f, 0.178605f,  0.172924f,
+    0.156034f,  0.098315f,  0.040808f,  -0.022801f, -0.116646f, -0.214665f,
+    -0.277220f, -0.311511f, -0.258876f, -0.099019f, 0.059741f,  0.097206f,
+    0.009451f,  -0.104707f, -0.100260f, 0.056264f,  0.186176f,  0.111231f,
+    -0.115614f, -0.296561f, -0.270064f, -0.023212f, 0.238725f,  0.355197f,
+    0.360867f,  0.321635f,  0.254609f,  0.169685f,  0.083568f,  0.019737f,
+    -0.032459f, -0.065127f, -0.074185f, -0.060999f, -0.036854f, -0.027205f,
+    -0.016531f, 0.008181f,  0.030850f,  0.017727f,  -0.006726f, -0.001181f,
+    0.001336f,  -0.000956f, -0.017428f, -0.012340f, 0.060362f,  0.065047f,
+    -0.030805f, -0.033295f, 0.013123f,  0.058892f,  0.208726f,  0.491470f,
+    -0.309788f, -0.072677f, 0.028080f,  0.035510f,  0.033645f,  0.017631f,
+    0.008469f,  0.023009f,  0.025216f,  0.016053f,  0.012525f,  0.017158f,
+    0.055058f,  0.050688f,  0.014588f,  0.033484f,  0.070193f,  0.015893f,
+    -0.029652f, 0.002851f,  0.065373f,  0.112979f,  0.120203f,  0.053419f,
+    -0.044467f, -0.051578f, 0.028308f,  0.083125f,  0.076243f,  0.047155f,
+    -0.004003f, -0.058253f, -0.063659f, -0.020445f, -0.022157f, -0.084054f,
+    -0.088966f, -0.007848f, 0.074255f,  0.096308f,  0.053602f,  0.009387f,
+    0.051122f,  0.124229f,  0.155676f,  0.184083f,  0.223212f,  0.242081f,
+    0.280141f,  0.377693f,  0.450236f,  0.452930f,  0.393910f,  0.394817f,
+    0.509721f,  0.553499f,  -0.002479f, -0.002352f, -0.002491f, -0.002350f,
+    -0.002492f, -0.002351f, -0.002488f, -0.002358f, -0.002478f, -0.002371f,
+    -0.002462f, -0.002388f, -0.002445f, -0.002404f, -0.002434f, -0.002408f,
+    -0.002436f, -0.002402f, -0.002442f, -0.002400f, -0.002437f, -0.002411f,
+    -0.002423f, -0.002426f, -0.002411f, -0.002434f, -0.002407f, -0.002433f,
+    -0.002411f, -0.002428f, -0.002416f, -0.002424f, -0.002419f, -0.002422f,
+    -0.002419f, -0.002424f, -0.002416f, -0.002428f, -0.002412f, -0.002432f,
+    -0.002409f, -0.002432f, -0.002414f, -0.002422f, -0.002427f, -0.002408f,
+    -0.002438f, -0.002403f, -0.002435f, -0.002412f, -0.002423f, -0.002423f,
+    -0.002416f, -0.002427f, -0.002415f, -0.002425f, 0.066426f,  -0.019097f,
+    -0.120418f, -0.203401f, -0.233580f, -0.190055f, -0.081900f, 0.061819f,
+    0.148215f,  0.139120f,  0.092208f,  0.036396f,  -0.036357f, -0.145800f,
+    -0.285508f, -0.382223f, -0.348588f, -0.180439f, 0.032906f,  0.220111f,
+    0.329768f,  0.344234f,  0.324705f,  0.293192f,  0.231667f,  0.126814f,
+    -0.029894f, -0.242607f, -0.458666f, -0.566098f, -0.525636f, -0.382236f,
+    -0.185515f, -0.009491f, 0.068655f,  0.095839f,  0.121415f,  0.121539f,
+    0.126814f,  0.130797f,  0.085118f,  0.063034f,  0.046101f,  0.040448f,
+    0.008377f,  -0.027335f, 0.007824f,  -0.017418f, -0.039881f, -0.025325f,
+    -0.043647f, -0.047424f, -0.017621f, -0.017926f, -0.002196f, 0.159130f,
+    -0.257734f, -0.232575f, -0.155445f, -0.046059f, 0.071298f,  0.159888f,
+    0.223206f,  0.279991f,  0.327278f,  0.333295f,  0.303152f,  0.259168f,
+    0.184717f,  0.081444f,  0.004648f,  0.004351f,  0.091454f,  0.188867f,
+    0.218229f,  0.190242f,  0.123156f,  0.038409f,  0.003565f,  0.031248f,
+    0.034319f,  -0.032902f, -0.106853f, -0.126736f, -0.101230f, -0.041365f,
+    0.017341f,  0.001159f,  -0.065256f, -0.124494f, -0.148184f, -0.084454f,
+    -0.020357f, 0.020114f,  0.063776f,  0.026144f,  -0.038700f, -0.043120f,
+    -0.046645f, -0.070699f, -0.069184f, -0.043965f, -0.048392f, -0.060814f,
+    -0.088240f, -0.115357f, -0.164868f, -0.185644f, -0.070208f, 0.076731f,
+    0.058972f,  -0.023555f, -0.155209f, -0.137874f, -0.143010f, -0.178470f,
+    -0.160176f, -0.075948f, 0.011285f,  0.033911f,  0.006139f,  0.007589f,
+    0.059927f,  0.049149f,  0.011930f,  0.005132f,  -0.032162f, -0.044057f,
+    -0.012779f, -0.011170f, -0.006239f, 0.023296f,  0.062641f,  0.081143f,
+    0.057930f,  -0.000395f, -0.057517f, -0.053021f, 0.013296f,  0.072304f,
+    0.091604f,  0.083647f,  0.040285f,  -0.018366f, -0.027285f, 0.041839f,
+    0.055172f,  0.032374f,  0.059817f,  0.019040f,  -0.029710f, 0.004508f,
+    -0.003745f, 0.006443f,  0.026674f,  -0.032340f, -0.099636f, -0.120806f,
+    -0.036937f, -0.008252f, 0.078637f,  0.078686f,  0.163673f,  0.200530f,
+    0.047865f,  -0.010832f, -0.089757f, -0.244333f, -0.369847f, -0.419820f,
+    -0.449812f, -0.402841f, -0.235471f, -0.017232f, 0.140660f,  0.158709f,
+    0.080747f,  0.028208f,  0.036403f,  0.048578f,  0.014563f,  -0.008378f,
+    0.022629f,  0.097397f,  0.171371f,  0.146304f,  0.050783f,  -0.040823f,
+    -0.092971f, -0.072419f, -0.043886f, -0.072482f, -0.070602f, 0.012915f,
+    0.118283f,  0.186797f,  0.244057f,  0.280017f,  0.219096f,  0.117086f,
+    0.031013f,  -0.039876f, -0.011205f, 0.029063f,  0.024860f,  -0.012037f,
+    -0.071117f, -0.103079f, -0.095858f, -0.162236f, -0.191859f, -0.120967f,
+    -0.094426f, -0.023842f, -0.016641f, 0.068137f,  0.156941f,  0.139678f,
+    0.128572f,  0.169807f,  0.167821f,  0.199719f,  0.176190f,  0.095469f,
+    0.019495f,  0.059848f,  0.109497f,  0.152878f,  0.178701f,  0.180499f,
+    0.126133f,  0.046259f,  -0.015054f, -0.031269f, -0.008668f, -0.009860f,
+    -0.036418f, -0.053463f, -0.061932f, -0.028025f, 0.059769f,  0.100196f,
+    0.044201f,  -0.048399f, -0.101359f, -0.078832f, -0.033951f, -0.019544f,
+    -0.012168f, 0.013635f,  0.052788f,  0.074270f,  0.042206f,  -0.016902f,
+    -0.055234f, -0.061849f, -0.030395f, 0.003379f,  0.020985f,  0.061650f,
+    0.048097f,  0.067694f,  0.165985f,  0.091609f,  -0.051624f, 0.014536f,
+    0.189493f,  0.152827f,  -0.094184f, -0.063083f, 0.119174f,  0.195566f,
+    0.110895f,  -0.055761f, -0.239103f, -0.446195f, -0.392629f, -0.150817f,
+    -0.023593f, -0.105246f, 0.086365f,  0.149579f,  0.211824f,  0.257526f,
+    0.281679f,  0.236129f,  0.167098f,  0.136653f,  0.167500f,  0.156281f,
+    0.103587f,  0.049936f,  -0.007642f, -0.027303f, -0.000880f, -0.005222f,
+    -0.026332f, -0.031386f, -0.027136f, -0.033193f, -0.044565f, -0.031008f,
+    0.014946f,  0.032276f,  0.013580f,  0.011253f,  0.052566f,  0.142096f,
+    0.251363f,  0.300594f,  0.266392f,  0.199322f,  0.128050f,  0.064661f,
+    0.022057f,  0.024534f,  0.060650f,  0.111660f,  0.142017f,  0.228740f,
+    0.329411f,  0.368067f,  0.423681f,  0.401197f,  0.297222f,  0.234455f,
+    0.205452f,  0.166611f,  0.099227f,  0.047722f,  0.023193f,  0.050633f,
+    -0.011585f, -0.055563f, 0.012036f,  0.077760f,  0.063435f,  0.066669f,
+    0.060173f,  0.032220f,  -0.004983f, -0.040993f, -0.072591f, -0.104112f,
+    -0.142866f, -0.195873f, -0.250051f, -0.302037f, -0.342401f, -0.364998f,
+    -0.356864f, -0.304049f, -0.225533f, -0.146936f, -0.073647f, -0.012283f,
+    0.035986f,  0.079200f,  0.121301f,  0.147029f,  0.137430f,  0.087192f,
+    0.013781f,  -0.053991f, -0.094926f, -0.117412f, -0.132398f, -0.151940f,
+    -0.185441f, -0.207771f, -0.184340f, -0.148046f, -0.126634f, -0.109102f,
+    -0.099085f, -0.094613f, -0.073730f, -0.047337f, -0.041007f, -0.020099f,
+    0.000441f,  0.062728f,  0.155188f,  0.107667f,  -0.016631f, -0.080444f,
+    -0.068157f, -0.076086f, -0.063721f, -0.092563f, -0.260506f, -0.467504f,
+    0.195731f,  0.265005f,  0.348359f,  0.403799f,  0.431708f,  0.393662f,
+    0.352088f,  0.318612f,  0.297973f,  0.255434f,  0.241950f,  0.264635f,
+    0.261484f,  0.198566f,  0.132704f,  0.110480f,  0.109560f,  0.122553f,
+    0.095927f,  -0.011996f, -0.110795f, -0.149182f, -0.129593f, -0.054318f,
+    0.029589f,  0.068499f,  0.040728f,  -0.052463f, -0.157107f, -0.211647f,
+    -0.196457f, -0.149569f, -0.099670f, -0.054480f, -0.039000f, -0.014053f,
+    0.035641f,  0.103350f,  0.119324f,  0.061714f,  0.104175f,  0.124821f,
+    0.020473f,  0.008196f,  0.010083f,  -0.065438f, -0.080817f, -0.063234f,
+    -0.088138f, -0.064458f, -0.050353f, 0.003939f,  0.073487f,  0.062293f,
+    0.098135f,  0.196203f,  0.069910f,  -0.020800f, -0.129509f, -0.201345f,
+    -0.200082f, -0.138302f, -0.058029f, 0.019245f,  0.086016f,  0.141149f,
+    0.161573f,  0.152417f,  0.156245f,  0.152288f,  0.074123f,  -0.046018f,
+    -0.128475f, -0.161890f, -0.171474f, -0.168760f, -0.116062f, 0.046030f,
+    0.240023f,  0.339022f,  0.337101f,  0.288051f,  0.239151f,  0.216119f,
+    0.209074f,  0.181083f,  0.100225f,  -0.039865f, -0.204907f, -0.339057f,
+    -0.409925f, -0.372178f, -0.254758f, -0.134748f, -0.058864f, -0.013324f,
+    0.068000f,  0.132724f,  0.067093f,  -0.037298f, -0.070957f, -0.121698f,
+    -0.151731f, -0.124409f, 0.000976f,  0.071364f,  0.029832f,  0.035133f,
+    0.004234f,  -0.028107f, 0.116059f,  0.263822f,  0.166439f,  0.156674f,
+    0.143208f,  0.128600f,  0.125408f,  0.114386f,  0.106162f,  0.118895f,
+    0.153831f,  0.152912f,  0.090224f,  -0.010351f, -0.097495f, -0.136458f,
+    -0.131674f, -0.111383f, -0.094433f, -0.054984f, 0.062853f,  0.237839f,
+    0.350821f,  0.308263f,  0.143826f,  -0.042989f, -0.189422f, -0.280766f,
+    -0.313726f, -0.288346f, -0.213163f, -0.089043f, 0.017627f,  0.065247f,
+    0.149332f,  0.269868f,  0.379985f,  0.491507f,  0.517701f,  0.447757f,
+    0.394748f,  0.342932f,  0.213750f,  0.128868f,  0.129326f,  0.103993f,
+    0.011445f,  -0.129313f, -0.192241f, -0.203825f, -0.195144f, -0.133366f,
+    -0.124847f, -0.146448f, -0.131373f, -0.083547f, -0.127921f, -0.188034f,
+    0.037281f,  0.022648f,  0.006961f,  -0.005810f, 0.002904f,  0.080243f,
+    0.160570f,  0.150893f,  0.054472f,  -0.006601f, -0.015409f, -0.061343f,
+    -0.113518f, -0.101595f, -0.031967f, 0.047530f,  0.057983f,  0.008795f,
+    -0.016787f, 0.014116f,  0.082686f,  0.117463f,  0.092497f,  0.099946f,
+    0.189349f,  0.299673f,  0.347618f,  0.332099f,  0.257506f,  0.111367f,
+    -0.058448f, -0.175453f, -0.233746f, -0.239013f, -0.240479f, -0.242247f,
+    -0.146483f, 0.012721f,  0.131840f,  0.162195f,  0.157196f,  0.135608f,
+    0.125579f,  0.130210f,  0.172965f,  0.149574f,  0.101519f,  0.042877f,
+    -0.021150f, -0.060194f, -0.057775f, -0.023787f, -0.057385f, -0.062196f,
+    -0.044836f, -0.100631f, 0.042760f,  0.092936f,  0.100157f,  0.054422f,
+    -0.028903f, -0.095370f, -0.098447f, -0.089824f, -0.097845f, -0.117602f,
+    -0.154470f, -0.193771f, -0.191365f, -0.156418f, -0.126024f, -0.094296f,
+    -0.043812f, 0.050087f,  0.178875f,  0.290747f,  0.336710f,  0.331660f,
+    0.315875f,  0.309573f,  0.280534f,  0.168017f,  -0.020104f, -0.187613f,
+    -0.266783f, -0.252645f, -0.221455f, -0.201111f, -0.177253f, -0.108794f,
+    -0.031366f, 0.040069f,  0.103263f,  0.171250f,  0.243410f,  0.219318f,
+    0.170925f,  0.046301f,  -0.062550f, -0.081553f, -0.069923f, -0.076709f,
+    -0.070308f, -0.031936f, 0.053414f,  0.083955f,  -0.002979f, -0.046451f,
+    0.032814f,  0.171818f,  0.155532f,  -0.068147f, -0.556116f, -0.464971f,
+    -0.358197f, -0.266638f, -0.222231f, -0.264404f, -0.324853f, -0.331954f,
+    -0.246329f, -0.135100f, -0.089745f, -0.082656f, -0.061559f, -0.031640f,
+    0.002870f,  0.047071f,  0.148380f,  0.282422f,  0.361421f,  0.389928f,
+    0.414646f,  0.416766f,  0.327395f,  0.128083f,  -0.112951f, -0.290474f,
+    -0.371326f, -0.380174f, -0.332158f, -0.271720f, -0.239871f, -0.214832f,
+    -0.178392f, -0.120546f, -0.017137f, 0.082323f,  0.108944f,  0.094152f,
+    0.050335f,  -0.036321f, -0.054549f, 0.001357f,  -0.016958f, -0.143052f,
+    -0.224237f, -0.124615f, -0.033460f, 0.022036f,  0.082479f,  0.126194f,
+    0.149819f,  0.279704f,  0.358395f,  0.228276f,  0.144789f,  0.108450f,
+    0.114895f,  -0.041302f, -0.227778f, -0.335307f, -0.336577f, -0.236685f,
+    -0.077607f, 0.030554f,  0.069744f,  0.111698f,  0.165409f,  0.159899f,
+    0.108885f,  0.106379f,  0.180954f,  0.310856f,  0.441263f,  0.437313f,
+    0.239720f,  -0.075989f, -0.380195f, -0.511865f, -0.453017f, -0.308704f,
+    -0.148006f, -0.061792f, -0.090172f, -0.169091f, -0.209079f, -0.163786f,
+    -0.067259f, 0.017597f,  0.114522f,  0.154999f,  0.079321f,  0.017599f,
+    0.009305f,  -0.005383f, -0.011306f, 0.060897f,  0.084056f,  0.042418f,
+    0.005558f,  0.031307f,  0.027830f,  -0.037259f, -0.042485f, -0.018296f,
+    -0.008332f, 0.035171f,  0.086372f,  0.062455f,  0.041404f,  0.095135f,
+    0.040244f,  -0.128618f, -0.194013f, -0.072427f, 0.068323f,  0.153023f,
+    0.158306f,  0.120021f,  0.095828f,  0.121703f,  0.171559f,  0.177374f,
+    0.156746f,  0.160168f,  0.185702f,  0.211139f,  0.225043f,  0.190134f,
+    0.079939f,  -0.042476f, -0.110444f, -0.138766f, -0.147658f, -0.124070f,
+    -0.078536f, -0.022385f, 0.052719f,  0.136496f,  0.165998f,  0.084941f,
+    -0.056598f, -0.158169f, -0.187855f, -0.131796f, -0.043531f, 0.029635f,
+    0.062187f,  0.047382f,  0.047888f,  0.100645f,  0.138417f,  0.144315f,
+    0.101791f,  0.014818f,  -0.055871f, -0.074872f, -0.082986f, -0.104277f,
+    -0.078899f, -0.034670f, -0.006626f, 0.074685f,  0.153165f,  0.165982f,
+    0.238944f,  0.214315f,  0.224237f,  0.371054f,  -0.309003f, -0.190871f,
+    -0.033769f, 0.109970f,  0.191963f,  0.180151f,  0.146597f,  0.116842f,
+    0.087156f,  0.036368f,  -0.005460f, -0.046988f, -0.083971f, -0.088320f,
+    -0.074199f, -0.027068f, 0.038582f,  0.037141f,  0.001844f,  -0.053886f,
+    -0.130071f, -0.131805f, -0.050994f, -0.008328f, 0.018927f,  0.070693f,
+    0.124546f,  0.153191f,  0.151682f,  0.092958f,  0.079140f,  0.074208f,
+    0.083537f,  0.101433f,  0.118846f,  0.103917f,  0.112174f,  0.149598f,
+    0.138053f,  0.031171f,  -0.021364f, -0.039025f, -0.134312f, -0.167589f,
+    -0.196177f, -0.149207f, -0.087464f, -0.040309f, -0.059876f, -0.138850f,
+    -0.117970f, -0.088667f, -0.131667f, -0.064137f, -0.043701f, -0.124542f,
+    -0.405188f, -0.333393f, -0.197848f, -0.021543f, 0.146530f,  0.208761f,
+    0.167779f,  0.104157f,  0.078676f,  0.096082f,  0.148374f,  0.205257f,
+    0.213964f,  0.151109f,  0.114019f,  0.201502f,  0.359674f,  0.439211f,
+    0.389849f,  0.291592f,  0.218083f,  0.135872f,  -0.014555f, -0.219488f,
+    -0.381129f, -0.406870f, -0.294031f, -0.136026f, -0.021822f, 0.039119f,
+    0.069681f,  0.063339f,  0.024357f,  0.013209f,  0.041490f,  0.045159f,
+    0.008893f,  0.036651f,  0.113413f,  0.115123f,  0.176186f,  0.173049f,
+    0.074899f,  0.012590f,  -0.010194f, -0.072090f, -0.064675f, -0.020702f,
+    0.022020f,  0.122269f,  0.112107f,  0.092042f,  0.078546f,  -0.004415f,
+    -0.088791f, -0.073796f, -0.121318f, -0.137383f, -0.167194f, -0.207807f,
+    -0.241189f, -0.243814f, -0.186613f, -0.076954f, -0.023282f, -0.016239f,
+    0.016436f,  0.039598f,  0.016749f,  -0.016611f, -0.027977f, 0.012163f,
+    0.112115f,  0.246210f,  0.373826f,  0.474515f,  0.484474f,  0.351790f,
+    0.113388f,  -0.127858f, -0.269157f, -0.255051f, -0.138577f, -0.024742f,
+    0.000349f,  -0.098792f, -0.218313f, -0.315104f, -0.357579f, -0.268966f,
+    -0.120399f, -0.023012f, 0.076497f,  0.181781f,  0.159320f,  0.101865f,
+    0.032462f,  0.011044f,  -0.058566f, -0.044170f, -0.027674f, -0.050720f,
+    0.016625f,  0.072741f,  -0.037282f, -0.085125f, -0.051031f, -0.039715f,
+    -0.023543f, 0.002634f,  -0.007235f, -0.036609f, -0.181795f, -0.103842f,
+    -0.012932f, 0.089668f,  0.194747f,  0.276609f,  0.275253f,  0.159494f,
+    0.066293f,  0.081292f,  0.127117f,  0.087206f,  -0.027658f, -0.119719f,
+    -0.128750f, 0.009162f,  0.198156f,  0.220059f,  0.097281f,  -0.058670f,
+    -0.174791f, -0.118666f, -0.001243f, -0.026246f, -0.084207f, -0.082014f,
+    -0.110435f, -0.233881f, -0.398840f, -0.479718f, -0.437329f, -0.263263f,
+    -0.045469f, 0.153640f,  0.321439f,  0.366313f,  0.301942f,  0.199526f,
+    0.080614f,  -0.040996f, -0.021173f, -0.038758f, -0.089283f, -0.060844f,
+    -0.031724f, -0.039617f, -0.043020f, -0.046408f, 0.008352f,  -0.014545f,
+    -0.051247f, -0.049021f, 0.000607f,  -0.023878f, -0.021256f, 0.015573f,
+    0.135665f,  0.085597f,  0.021606f,  -0.044249f, -0.064602f, -0.057240f,
+    -0.042946f, 0.002201f,  0.036953f,  0.016302f,  -0.026322f, -0.056739f,
+    -0.075331f, -0.067773f, -0.010294f, 0.041601f,  0.034670f,  0.003388f,
+    -0.004679f, -0.006765f, -0.044818f, -0.083552f, -0.013664f, 0.146392f,
+    0.262323f,  0.285438f,  0.259288f,  0.187249f,  0.038477f,  -0.107260f,
+    -0.157346f, -0.149197f, -0.120526f, -0.070713f, 0.013848f,  0.047806f,
+    -0.010118f, -0.056893f, -0.044913f, -0.011204f, -0.000905f, 0.011656f,
+    -0.017188f, -0.055167f, -0.058061f, -0.003236f, -0.043655f, -0.069761f,
+    -0.013599f, 0.062787f,  0.071024f,  0.068195f,  0.065651f,  0.066210f,
+    -0.004959f, -0.067706f, 0.082109f,  0.089327f,  0.079668f,  0.069811f,
+    0.039317f,  0.012004f,  -0.006822f, -0.009603f, -0.020154f, -0.013909f,
+    0.027637f,  0.067369f,  0.055064f,  0.014460f,  -0.029975f, -0.085209f,
+    -0.140752f, -0.147622f, -0.062829f, 0.072732f,  0.157461f,  0.122284f,
+    -0.007330f, -0.105053f, -0.061446f, 0.081138f,  0.197411f,  0.226474f,
+    0.213599f,  0.202803f,  0.193658f,  0.172368f,  0.107727f,  0.015664f,
+    -0.075765f, -0.148526f, -0.170296f, -0.116522f, -0.035517f, 0.001112f,
+    0.053741f,  0.053784f,  0.040446f,  0.030693f,  0.052877f,  0.043500f,
+    -0.019400f, -0.017277f, -0.029225f, -0.071059f, -0.048203f, -0.011587f,
+    -0.066358f, -0.130807f, -0.076108f, 0.020101f,  -0.047503f, -0.002351f,
+    0.021334f,  0.025613f,  0.019311f,  0.017162f,  0.024404f,  -0.015148f,
+    -0.057381f, -0.044504f, 0.000372f,  0.042280f,  0.045269f,  -0.006487f,
+    -0.110113f, -0.190695f, -0.186384f, -0.150630f, -0.115071f, -0.071771f,
+    -0.055929f, -0.063433f, -0.100779f, -0.141260f, -0.086049f, 0.066781f,
+    0.276746f,  0.486260f,  0.566754f,  0.467456f,  0.263622f,  0.063320f,
+    -0.081316f, -0.147605f, -0.122397f, -0.081884f, -0.067354f, -0.057608f,
+    -0.032362f, -0.042396f, -0.007370f, 0.036554f,  0.015192f,  0.021648f,
+    0.027871f,  0.001567f,  -0.026853f, 0.041373f,  0.041382f,  0.023883f,
+    0.038983f,  0.042710f,  0.023659f,  0.005749f,  0.023220f,  -0.001751f,
+    -0.014940f, -0.031484f, -0.062369f, -0.109559f, -0.158152f, -0.189184f,
+    -0.170944f, -0.108189f, -0.045769f, -0.033774f, -0.067324f, -0.070207f,
+    0.010747f,  0.132803f,  0.188558f,  0.118196f,  0.022590f,  0.014422f,
+    0.067729f,  0.107265f,  0.116536f,  0.134233f,  0.154053f,  0.131225f,
+    0.077225f,  0.033969f,  0.003665f,  -0.043611f, -0.101078f, -0.117115f,
+    -0.066875f, -0.002706f, 0.025539f,  0.007233f,  -0.036263f, -0.064631f,
+    -0.066538f, -0.047159f, 0.003124f,  0.067996f,  0.090395f,  0.153210f,
+    0.183945f,  0.155686f,  0.155981f,  0.183675f,  0.114416f,  0.013264f,
+    0.017901f,  0.007293f,  -0.028408f, -0.013338f, -0.027047f, -0.150247f,
+    -0.116335f, -0.006953f, -0.068261f, -0.077003f, -0.091650f, -0.079087f,
+    -0.031046f, 0.012882f,  0.027413f,  0.009415f,  -0.046168f, -0.070136f,
+    -0.041043f, 0.000857f,  0.030058f,  0.025109f,  -0.006972f, -0.018389f,
+    -0.002620f, 0.023831f,  0.069819f,  0.099959f,  0.066942f,  0.015075f,
+    0.006228f,  0.033429f,  0.044744f,  0.029813f,  0.004967f,  -0.023565f,
+    -0.025474f, -0.004805f, 0.008328f,  0.010347f,  0.090258f,  0.194035f,
+    0.252063f,  0.271156f,  0.312240f,  0.344419f,  0.246514f,  0.068058f,
+    -0.075312f, -0.209032f, -0.397654f, -0.531251f, -0.568040f, -0.523964f,
+    -0.420643f, -0.298880f, -0.200586f, -0.197725f, -0.139099f, 0.000275f,
+    0.091404f,  0.160144f,  0.271003f,  0.485804f,  0.196377f,  0.107322f,
+    0.022805f,  -0.038378f, -0.064351f, -0.049076f, -0.024633f, -0.025975f,
+    -0.043473f, -0.062360f, -0.071826f, -0.037857f, 0.030828f,  0.050464f,
+    0.019971f,  -0.014464f, -0.051925f, -0.105549f, -0.159394f, -0.144310f,
+    -0.023993f, 0.096446f,  0.087601f,  -0.086800f, -0.308827f, -0.400089f,
+    -0.300335f, -0.085869f, 0.154523f,  0.328216f,  0.365617f,  0.284258f,
+    0.227735f,  0.161415f,  0.073015f,  0.049105f,  -0.006945f, -0.075529f,
+    -0.049944f, -0.043691f, -0.026171f, 0.029606f,  0.001085f,  0.000918f,
+    0.019059f,  -0.033727f, -0.019795f, -0.049600f, -0.043482f, -0.019584f,
+    0.003339f,  -0.021839f, -0.025239f, -0.005574f, -0.037635f, 0.006807f,
+    0.177366f,  0.202747f,  0.194592f,  0.130840f,  0.018427f,  -0.080877f,
+    -0.109044f, -0.127222f, -0.170077f, -0.175005f, -0.133550f, -0.085823f,
+    -0.044073f, -0.026658f, -0.028890f, -0.008057f, 0.043635f,  0.064782f,
+    0.019696f,  -0.060046f, -0.119938f, -0.113708f, -0.056134f, 0.008020f,
+    0.048134f,  0.080581f,  0.138255f,  0.213327f,  0.292253f,  0.340491f,
+    0.309543f,  0.190730f,  0.035127f,  -0.084526f, -0.174501f, -0.248927f,
+    -0.275323f, -0.264428f, -0.246875f, -0.180307f, -0.046185f, 0.030916f,
+    -0.004921f, 0.011926f,  0.039032f,  0.029773f,  0.021674f,  0.011787f,
+    -0.000590f, 0.053380f,  0.087369f,  0.052094f,  0.021814f,  0.017207f,
+    0.061816f,  -0.008818f, -0.204077f, -0.137304f, -0.043617f, 0.060535f,
+    0.096582f,  0.063647f,  0.021395f,  -0.018394f, -0.083211f, -0.149919f,
+    -0.159892f, -0.088513f, 0.033565f,  0.137387f,  0.150514f,  0.086834f,
+    0.006606f,  -0.017251f, 0.023970f,  0.081677f,  0.097084f,  0.050602f,
+    0.006095f,  0.051714f,  0.187822f,  0.326496f,  0.388667f,  0.371477f,
+    0.312048f,  0.248969f,  0.176489f,  0.076121f,  -0.051593f, -0.186136f,
+    -0.318752f, -0.452887f, -0.582707f, -0.696464f, -0.787054f, -0.851988f,
+    -0.878059f, -0.862978f, -0.801448f, -0.705559f, -0.579104f, -0.433326f,
+    -0.309829f, -0.217121f, -0.138265f, -0.084878f, -0.043847f, 0.035675f,
+    0.111638f,  0.057000f,  0.098456f,  0.223430f,  -0.189471f, -0.151985f,
+    -0.106728f, -0.075107f, -0.027620f, 0.034187f,  0.091448f,  0.101243f,
+    0.063279f,  0.008417f,  0.005355f,  0.045835f,  0.025766f,  -0.009535f,
+    0.006347f,  0.015772f,  -0.011925f, -0.033200f, -0.014487f, 0.003556f,
+    0.014935f,  0.027194f,  0.012712f,  0.009091f,  0.039895f,  0.058746f,
+    0.030564f,  -0.018113f, -0.029700f, 0.008111f,  0.037551f,  0.036479f,
+    0.033424f,  0.024830f,  -0.009052f, -0.032186f, -0.056877f, -0.102169f,
+    -0.167094f, -0.173581f, -0.175766f, -0.227562f, -0.215493f, -0.181575f,
+    -0.206183f, -0.213749f, -0.218960f, -0.177747f, -0.133227f, -0.105005f,
+    -0.138026f, -0.090638f, -0.106402f, -0.194728f, -0.108520f, -0.032150f,
+    0.071963f,  0.017723f,  0.018343f,  0.053159f,  0.109387f,  0.137481f,
+    0.116382f,  0.099719f,  0.127122f,  0.139486f,  0.096815f,  0.026851f,
+    -0.010694f, -0.012811f, -0.000844f, 0.013942f,  0.041247f,  0.108992f,
+    0.188238f,  0.229902f,  0.230483f,  0.185600f,  0.112935f,  0.047045f,
+    -0.012577f, -0.083287f, -0.144723f, -0.135358f, -0.085826f, -0.050539f,
+    -0.017146f, -0.023716f, -0.030615f, 0.001798f,  0.053430f,  0.072277f,
+    0.053040f,  0.064375f,  0.104937f,  0.138649f,  0.144651f,  0.113189f,
+    0.061967f,  0.032665f,  0.043003f,  0.089982f,  0.027373f,  0.024807f,
+    0.054400f,  0.054696f,  0.070919f,  0.039419f,  -0.080164f, -0.072613f,
+    -0.115264f, -0.268821f, 0.073060f,  0.016614f,  -0.025474f, -0.037643f,
+    -0.053758f, -0.046814f, -0.043760f, -0.041015f, -0.039250f, -0.006716f,
+    0.045133f,  0.050056f,  0.001793f,  -0.057086f, -0.078728f, -0.065247f,
+    -0.071273f, -0.079707f, -0.036449f, 0.048398f,  0.130516f,  0.125710f,
+    0.058388f,  0.018212f,  0.065605f,  0.209574f,  0.363740f,  0.433431f,
+    0.408244f,  0.256312f,  0.057056f,  -0.148408f, -0.283074f, -0.344749f,
+    -0.291128f, -0.206934f, -0.158075f, -0.096332f, -0.013442f, 0.068916f,
+    0.053921f,  0.057344f,  0.015435f,  -0.028217f, -0.038203f, -0.011327f,
+    -0.024656f, -0.029335f, 0.004263f,  -0.014188f, 0.024138f,  0.020241f,
+    -0.003437f, 0.035613f,  0.006109f,  -0.067385f, -0.072511f, -0.051120f,
+    -0.011770f, 0.037738f,  0.083460f,  0.088027f,  0.069642f,  0.042082f,
+    0.024956f,  0.017796f,  0.025208f,  0.036635f,  0.038275f,  0.056344f,
+    0.115319f,  0.191924f,  0.243955f,  0.228774f,  0.183590f,  0.157320f,
+    0.151006f,  0.154301f,  0.157455f,  0.140366f,  0.095841f,  0.055729f,
+    0.065112f,  0.124332f,  0.184904f,  0.208032f,  0.219962f,  0.247597f,
+    0.263456f,  0.242947f,  0.175889f,  0.045182f,  -0.107275f, -0.210956f,
+    -0.212266f, -0.147628f, -0.085822f, -0.055423f, -0.029242f, -0.020435f,
+    -0.087164f, -0.234632f, -0.365636f, -0.392396f, -0.394597f, -0.444485f,
+    -0.515742f, -0.605111f, -0.669592f, -0.552434f, -0.399653f, -0.401732f,
+    0.259834f,  0.256520f,  0.223882f,  0.150360f,  0.054857f,  -0.011228f,
+    0.009405f,  0.053785f,  0.043478f,  -0.063821f, -0.206925f, -0.261906f,
+    -0.185018f, -0.044164f, 0.077697f,  0.083138f,  -0.043559f, -0.168738f,
+    -0.161747f, -0.026762f, 0.133252f,  0.203212f,  0.145105f,  0.012204f,
+    -0.105006f, -0.124968f, -0.042942f, 0.057452f,  0.094218f,  0.061385f,
+    -0.018047f, -0.083767f, -0.109351f, -0.104495f, -0.067827f, -0.025011f,
+    -0.019989f, -0.005039f, 0.030909f,  0.047724f,  0.033260f,  0.004281f,
+    0.024120f,  0.055028f,  -0.021844f, -0.066793f, -0.014113f, -0.040867f,
+    -0.073000f, -0.039049f, 0.026097f,  0.038056f,  0.037518f,  0.101931f,
+    0.037543f,  -0.113383f, -0.136631f, -0.131721f, -0.066828f, 0.047034f,
+    0.167590f,  0.241941f,  0.237444f,  0.194336f,  0.164318f,  0.096183f,
+    0.014608f,  0.004773f,  0.064766f,  0.120045f,  0.137120f,  0.125156f,
+    0.091992f,  0.017864f,  -0.078506f, -0.116507f, -0.054738f, 0.070388f,
+    0.183140f,  0.231385f,  0.228783f,  0.218403f,  0.209659f,  0.176517f,
+    0.159615f,  0.173674f,  0.159981f,  0.109490f,  0.054501f,  0.058125f,
+    0.081051f,  0.077701f,  0.113155f,  0.194455f,  0.205559f,  0.175407f,
+    0.180409f,  0.170246f,  0.132421f,  0.093900f,  0.084679f,  0.063222f,
+    0.011372f,  -0.019214f, -0.052000f, -0.092970f, -0.108907f, -0.061395f,
+    -0.031899f, 0.027564f,  0.072905f,  0.170471f,  -0.253466f, -0.317161f,
+    -0.403289f, -0.454366f, -0.458701f, -0.428257f, -0.374432f, -0.305819f,
+    -0.232354f, -0.188132f, -0.166510f, -0.160949f, -0.149281f, -0.118491f,
+    -0.082335f, -0.075095f, -0.078028f, -0.068670f, -0.045798f, -0.012527f,
+    0.009936f,  0.005682f,  0.007579f,  0.034417f,  0.054556f,  0.057220f,
+    0.055791f,  0.033176f,  -0.032117f, -0.040358f, 0.029362f,  0.060833f,
+    0.014052f,  -0.025728f, -0.016265f, 0.005859f,  0.000453f,  -0.008025f,
+    0.024584f,  0.022714f,  0.018111f,  -0.010862f, 0.009638f,  0.010704f,
+    -0.033701f, 0.009581f,  -0.000114f, 0.023833f,  0.006656f,  0.004891f,
+    -0.017300f, 0.040425f,  0.004204f,  0.008121f,  -0.010089f, -0.057531f,
+    -0.296358f, -0.191676f, -0.060142f, 0.043283f,  0.119564f,  0.167153f,
+    0.154775f,  0.086082f,  0.019715f,  -0.017206f, -0.016727f, 0.011815f,
+    0.024634f,  0.006394f,  -0.020439f, -0.040016f, -0.047012f, -0.040652f,
+    -0.003172f, 0.060712f,  0.112864f,  0.122551f,  0.079526f,  0.006081f,
+    -0.064831f, -0.111875f, -0.116613f, -0.085324f, -0.051961f, -0.048993f,
+    -0.025027f, 0.049411f,  0.141519f,  0.228712f,  0.248081f,  0.175034f,
+    0.071149f,  -0.024579f, -0.091661f, -0.045766f, 0.009928f,  0.026113f,
+    0.036599f,  -0.061899f, -0.226727f, -0.353214f, -0.455811f, -0.483051f,
+    -0.382438f, -0.242767f, -0.028672f, 0.230506f,  0.372617f,  0.405059f,
+    0.542501f,  0.697049f,  -0.052272f, -0.027591f, -0.038263f, -0.036638f,
+    -0.103836f, -0.130970f, -0.049049f, -0.008766f, -0.000872f, -0.001380f,
+    -0.022022f, -0.069658f, -0.071896f, 0.004585f,  -0.004417f, -0.059622f,
+    -0.037058f, -0.006522f, -0.009285f, 0.004734f,  0.045839f,  0.073451f,
+    0.057959f,  0.009701f,  0.022161f,  0.052956f,  0.013310f,  -0.055949f,
+    -0.026243f, 0.007293f,  -0.063860f, -0.044878f, -0.028122f, -0.014370f,
+    -0.002981f, -0.008343f, 0.002651f,  0.025848f,  0.015518f,  0.025373f,
+    -0.003261f, -0.001060f, -0.021100f, -0.047463f, 0.013655f,  -0.017012f,
+    0.019311f,  0.028078f,  0.046680f,  0.058555f,  0.067527f,  0.036799f,
+    0.070530f,  -0.042100f, -0.043412f, -0.002348f, -0.221038f, -0.155965f,
+    -0.074017f, -0.015981f, -0.010657f, -0.022642f, -0.035479f, -0.039093f,
+    -0.017509f, 0.019627f,  0.057028f,  0.080337f,  0.087185f,  0.102337f,
+    0.137390f,  0.137470f,  0.074534f,  0.004223f,  -0.007213f, 0.031238f,
+    0.053633f,  0.040222f,  0.009173f,  -0.017516f, -0.017406f, 0.006897f,
+    0.060756f,  0.142271f,  0.216610f,  0.247494f,  0.218546f,  0.171147f,
+    0.116651f,  0.040849f,  -0.021805f, -0.066973f, -0.093656f, -0.116968f,
+    -0.080502f, 0.005288f,  0.038080f,  0.032872f,  -0.024266f, -0.046617f,
+    -0.072492f, -0.158452f, -0.148882f, -0.093250f, -0.067491f, -0.034972f,
+    0.003692f,  -0.016916f, -0.045800f, -0.036752f, -0.008591f, 0.021204f,
+    0.137105f,  0.055103f,  -0.031452f, -0.053686f, -0.040175f, -0.007405f,
+    0.040721f,  0.053054f,  0.036802f,  0.034873f,  0.066945f,  0.073146f,
+    0.012335f,  -0.033413f, -0.019797f, 0.005920f,  0.013524f,  0.016868f,
+    -0.018121f, -0.128636f, -0.206510f, -0.095560f, 0.139829f,  0.342273f,
+    0.441941f,  0.352354f,  0.071581f,  -0.210305f, -0.336439f, -0.289752f,
+    -0.143856f, 0.004681f,  0.069488f,  0.081660f,  0.066815f,  0.006961f,
+    -0.053584f, -0.044302f, -0.053123f, -0.076671f, -0.053048f, -0.005494f,
+    -0.012995f, -0.008072f, 0.021748f,  -0.011744f, 0.024546f,  0.012073f,
+    -0.029245f, -0.047187f, 0.004906f,  0.019010f,  -0.016301f, 0.023412f,
+    0.067887f,  -0.055028f, -0.155132f, -0.058741f, 0.046604f,  0.100886f,
+    0.084983f,  0.034986f,  0.019163f,  0.031856f,  0.029979f,  0.050816f,
+    0.086706f,  0.087503f,  0.067083f,  0.059224f,  0.065014f,  0.065778f,
+    0.066109f,  0.051194f,  0.021270f,  0.017730f,  0.070126f,  0.104563f,
+    0.074586f,  0.016602f,  -0.026580f, -0.010316f, 0.061730f,  0.097148f,
+    0.064600f,  0.056350f,  0.065892f,  0.070985f,  0.020462f,  -0.020314f,
+    0.009431f,  0.112312f,  0.115491f,  0.014550f,  -0.015672f, -0.042709f,
+    0.007232f,  0.065300f,  0.099420f,  0.133068f,  0.160890f,  0.180943f,
+    0.195036f,  0.236572f,  0.213271f,  0.200369f,  0.194375f,  0.076485f,
+    0.004307f,  0.050644f,  0.057595f,  -0.080235f, 0.238170f,  0.192757f,
+    0.128748f,  0.056719f,  0.009512f,  -0.005056f, -0.022709f, -0.060754f,
+    -0.111613f, -0.130612f, -0.075516f, 0.011307f,  0.046052f,  0.013574f,
+    -0.036851f, -0.065443f, -0.072679f, -0.078446f, -0.110358f, -0.178233f,
+    -0.257186f, -0.299229f, -0.278538f, -0.203592f, -0.122690f, -0.074397f,
+    -0.043066f, -0.002205f, 0.061683f,  0.140938f,  0.225141f,  0.275218f,
+    0.263254f,  0.223234f,  0.213969f,  0.251155f,  0.265674f,  0.215563f,
+    0.174374f,  0.161123f,  0.131656f,  0.138653f,  0.164228f,  0.068986f,
+    -0.047809f, -0.105164f, -0.125525f, -0.112122f, -0.088384f, -0.057824f,
+    -0.028278f, 0.041591f,  0.140387f,  0.093374f,  -0.015379f, -0.012578f,
+    0.207847f,  0.251473f,  0.256412f,  0.199747f,  0.121382f,  0.065930f,
+    0.056474f,  0.056720f,  0.037880f,  0.043278f,  0.087011f,  0.098377f,
+    0.040872f,  -0.035923f, -0.075465f, -0.062387f, -0.022679f, 0.011352f,
+    0.018885f,  0.024933f,  0.059665f,  0.113261f,  0.132360f,  0.091387f,
+    0.028009f,  -0.024946f, -0.052349f, -0.057467f, -0.065040f, -0.073742f,
+    -0.071646f, -0.083265f, -0.111855f, -0.130674f, -0.127020f, -0.134999f,
+    -0.188728f, -0.290857f, -0.353105f, -0.299514f, -0.205229f, -0.103232f,
+    -0.041630f, -0.056835f, -0.083949f, -0.038664f, -0.029508f, -0.103437f,
+    -0.082179f, -0.038323f, -0.032430f, 0.016205f,  0.069870f,  0.046649f,
+    0.016522f,  0.033498f,  -0.162944f, -0.113509f, -0.033984f, 0.036920f,
+    0.076406f,  0.062485f,  -0.005752f, -0.075762f, -0.071584f, 0.012078f,
+    0.099854f,  0.132003f,  0.085873f,  -0.008484f, -0.072204f, -0.063571f,
+    -0.039086f, -0.035145f, -0.014804f, 0.026500f,  0.067866f,  0.106028f,
+    0.135904f,  0.137869f,  0.073481f,  -0.034972f, -0.111259f, -0.116457f,
+    -0.084522f, -0.060118f, -0.030678f, -0.036412f, -0.047586f, 0.000531f,
+    0.062039f,  0.124028f,  0.158817f,  0.138620f,  0.118763f,  0.124514f,
+    0.082026f,  0.062004f,  0.067335f,  0.035146f,  -0.009634f, -0.098307f,
+    -0.158814f, -0.153033f, -0.159035f, -0.143428f, -0.123191f, -0.198441f,
+    -0.261468f, -0.220758f, -0.229863f, -0.331183f, -0.006008f, -0.006012f,
+    -0.006008f, -0.006012f, -0.006008f, -0.006011f, -0.006009f, -0.006011f,
+    -0.006009f, -0.006010f, -0.006010f, -0.006009f, -0.006011f, -0.006009f,
+    -0.006011f, -0.006009f, -0.006010f, -0.006009f, -0.006010f, -0.006010f,
+    -0.006009f, -0.006010f, -0.006009f, -0.006010f, -0.006010f, -0.006010f,
+    -0.006010f, -0.006010f, -0.006009f, -0.006012f, -0.006006f, -0.006016f,
+    -0.006001f, -0.006022f, -0.005995f, -0.006027f, -0.005993f, -0.006025f,
+    -0.005998f, -0.006019f, -0.006004f, -0.006014f, -0.006006f, -0.006013f,
+    -0.006006f, -0.006015f, -0.006004f, -0.006015f, -0.006005f, -0.006013f,
+    -0.006008f, -0.006010f, -0.006011f, -0.006008f, -0.006012f, -0.006007f,
+    -0.145929f, -0.014641f, 0.120582f,  0.204859f,  0.207320f,  0.156077f,
+    0.082013f,  -0.002054f, -0.074848f, -0.128693f, -0.140404f, -0.093185f,
+    -0.029818f, 0.000570f,  -0.015795f, -0.049423f, -0.055325f, -0.028384f,
+    0.011400f,  0.031881f,  0.015962f,  -0.031202f, -0.087552f, -0.119631f,
+    -0.119491f, -0.108589f, -0.089233f, -0.049594f, -0.010821f, 0.011649f,
+    0.037835f,  0.080342f,  0.125265f,  0.154281f,  0.172251f,  0.159195f,
+    0.105621f,  0.061219f,  -0.008518f, -0.039177f, -0.048508f, -0.032614f,
+    0.055363f,  0.102561f,  0.097813f,  0.085066f,  0.051313f,  0.029875f,
+    0.000691f,  -0.075335f, -0.092653f, -0.006874f, 0.095457f,  0.048345f,
+    0.043093f,  0.173888f,  0.146060f,  0.060901f,  0.001262f,  -0.016247f,
+    -0.029004f, -0.034272f, 0.011292f,  0.066937f,  0.027925f,  -0.013143f,
+    0.002320f,  0.018365f,  0.050991f,  0.054371f,  -0.016638f, -0.080055f,
+    -0.087234f, -0.008184f, 0.089039f,  0.114007f,  0.039331f,  -0.143526f,
+    -0.359687f, -0.450126f, -0.346059f, -0.084881f, 0.202706f,  0.371826f,
+    0.370153f,  0.230333f,  -0.002023f, -0.220191f, -0.300638f, -0.224052f,
+    -0.064143f, 0.024057f,  0.039439f,  0.052591f,  0.005415f,  -0.012848f,
+    0.016709f,  0.002719f,  -0.010644f, 0.029631f,  0.037017f,  0.001678f,
+    -0.011613f, -0.023236f, 0.014452f,  0.045635f,  -0.012647f, -0.025242f,
+    0.035388f,  -0.039565f, -0.026286f, 0.279074f,  -0.003365f, -0.003365f,
+    -0.003365f, -0.003365f, -0.003365f, -0.003365f, -0.003365f, -0.003365f,
+    -0.003366f, -0.003364f, -0.003366f, -0.003363f, -0.003368f, -0.003362f,
+    -0.003369f, -0.003360f, -0.003370f, -0.003360f, -0.003369f, -0.003362f,
+    -0.003366f, -0.003366f, -0.003363f, -0.003369f, -0.003361f, -0.003370f,
+    -0.003361f, -0.003369f, -0.003362f, -0.003366f, -0.003365f, -0.003364f,
+    -0.003367f, -0.003363f, -0.003367f, -0.003363f, -0.003366f, -0.003365f,
+    -0.003364f, -0.003366f, -0.003364f, -0.003366f, -0.003363f, -0.003367f,
+    -0.003363f, -0.003366f, -0.003364f, -0.003365f, -0.003366f, -0.003363f,
+    -0.003368f, -0.003361f, -0.003370f, -0.003359f, -0.003371f, -0.003359f,
+    -0.047690f, -0.031309f, -0.026907f, -0.036115f, -0.046675f, -0.031778f,
+    0.016146f,  0.066035f,  0.112815f,  0.153444f,  0.170451f,  0.159873f,
+    0.134903f,  0.112274f,  0.070181f,  -0.001490f, -0.066795f, -0.111899f,
+    -0.153555f, -0.215315f, -0.282483f, -0.308023f, -0.287367f, -0.251527f,
+    -0.222988f, -0.206733f, -0.193061f, -0.168134f, -0.129476f, -0.083620f,
+    -0.032644f, 0.019158f,  0.076311f,  0.133751f,  0.196844f,  0.261430f,
+    0.282229f,  0.211199f,  0.053386f,  -0.059671f, -0.082797f, -0.087631f,
+    -0.047152f, -0.013504f, -0.011069f, 0.053273f,  0.148533f,  0.171373f,
+    0.104234f,  0.031910f,  0.020085f,  0.067124f,  0.067269f,  0.058575f,
+    0.063935f,  0.136907f,  -0.239169f, -0.142564f, -0.037666f, 0.048283f,
+    0.122950f,  0.181255f,  0.194901f,  0.166634f,  0.144425f,  0.126451f,
+    0.083132f,  0.027567f,  0.009366f,  0.059008f,  0.145456f,  0.180352f,
+    0.149948f,  0.098719f,  0.039316f,  -0.015174f, -0.035214f, -0.047241f,
+    -0.090500f, -0.159782f, -0.251789f, -0.357484f, -0.447792f, -0.498310f,
+    -0.502787f, -0.476590f, -0.417239f, -0.328380f, -0.236686f, -0.171408f,
+    -0.144025f, -0.123411f, -0.067830f, 0.027388f,  0.117632f,  0.138844f,
+    0.090324f,  -0.002798f, -0.075366f, -0.092657f, -0.067426f, -0.032274f,
+    0.008134f,  0.014681f,  -0.003876f, 0.008686f,  0.049237f,  0.122327f,
+    0.152965f,  0.123521f,  0.094020f,  0.061273f,  -0.116725f, -0.195792f,
+    -0.272736f, -0.283205f, -0.206433f, -0.102475f, -0.054738f, -0.052486f,
+    -0.057003f, -0.043658f, -0.013990f, 0.004114f,  -0.001230f, 0.000765f,
+    0.017763f,  0.017387f,  -0.002515f, -0.019179f, -0.015660f, 0.010983f,
+    0.055305f,  0.086395f,  0.067063f,  0.039348f,  0.061585f,  0.118292f,
+    0.135762f,  0.091719f,  0.056310f,  0.024021f,  -0.027104f, -0.037752f,
+    0.020406f,  0.112282f,  0.186895f,  0.216710f,  0.232659f,  0.235781f,
+    0.204679f,  0.180942f,  0.109416f,  0.055105f,  0.000030f,  -0.082978f,
+    -0.159083f, -0.191214f, -0.176521f, -0.140815f, -0.082947f, -0.028290f,
+    0.053057f,  0.091649f,  0.074757f,  0.103367f,  0.058293f,  -0.076680f,
+    -0.273172f, -0.116610f, 0.074482f,  0.204270f,  0.195971f,  0.105456f,
+    0.041086f,  0.033305f,  0.016809f,  0.018587f,  0.038181f,  0.028682f,
+    -0.007898f, -0.074742f, -0.149125f, -0.142754f, -0.057139f, 0.028357f,
+    0.053377f,  0.028539f,  0.026219f,  0.043860f,  0.049110f,  0.068722f,
+    0.082742f,  0.041435f,  -0.042447f, -0.113282f, -0.164060f, -0.164663f,
+    -0.133263f, -0.112365f, -0.076781f, -0.021667f, 0.043122f,  0.077927f,
+    0.068244f,  0.045684f,  0.088518f,  0.136104f,  0.179415f,  0.212912f,
+    0.166108f,  0.118154f,  0.091386f,  -0.004142f, 0.037851f,  0.084950f,
+    0.031810f,  0.000672f,  0.048205f,  0.096036f,  0.101970f,  0.132219f,
+    0.184558f,  0.178818f,  -0.195334f, -0.175308f, -0.172647f, -0.180056f,
+    -0.194056f, -0.207947f, -0.142971f, 0.058000f,  0.291838f,  0.302721f,
+    0.044640f,  -0.223982f, -0.257900f, -0.052039f, 0.203555f,  0.297515f,
+    0.170776f,  -0.038784f, -0.155962f, -0.107888f, 0.011898f,  0.076313f,
+    0.071284f,  0.032183f,  -0.008588f, -0.028173f, -0.024021f, -0.009960f,
+    -0.010746f, -0.012438f, -0.001720f, -0.048973f, -0.098279f, -0.048496f,
+    0.006048f,  0.075248f,  0.141849f,  0.145970f,  0.098011f,  0.056580f,
+    0.048452f,  0.049908f,  0.048442f,  0.002637f,  0.000053f,  0.011718f,
+    0.023665f,  0.058592f,  -0.011635f, -0.053549f, 0.045679f,  0.061213f,
+    -0.021251f, 0.037815f,  0.015030f,  -0.353837f, 0.129991f,  0.124685f,
+    0.117941f,  0.075370f,  0.023081f,  -0.036049f, -0.082693f, -0.076066f,
+    -0.040060f, -0.034321f, -0.063835f, -0.086985f, -0.080656f, -0.040454f,
+    -0.019653f, -0.042926f, -0.043122f, 0.009215f,  0.084888f,  0.137123f,
+    0.103661f,  0.021380f,  -0.035413f, -0.059754f, -0.084523f, -0.105944f,
+    -0.079311f, -0.026648f, -0.012215f, -0.005768f, 0.029698f,  0.053505f,
+    0.038556f,  -0.017829f, -0.073182f, -0.103532f, -0.109207f, -0.071581f,
+    0.037134f,  0.106171f,  0.162176f,  0.174181f,  0.192852f,  0.210807f,
+    0.282048f,  0.345572f,  0.335508f,  0.294771f,  0.205130f,  0.247102f,
+    0.266535f,  0.224986f,  0.125111f,  0.061284f,  0.037341f,  -0.007655f,
+    0.253419f,  0.165314f,  0.055097f,  -0.037702f, -0.081907f, -0.076733f,
+    -0.059556f, -0.056698f, -0.063500f, -0.045231f, 0.003219f,  0.045428f,
+    0.068626f,  0.053293f,  -0.063589f, -0.268198f, -0.413050f, -0.374721f,
+    -0.158750f, 0.119364f,  0.295810f,  0.302172f,  0.190899f,  0.053535f,
+    -0.025828f, -0.040607f, -0.023999f, 0.011568f,  0.063513f,  0.091581f,
+    0.074705f,  0.003756f,  -0.061819f, -0.085337f, -0.103119f, -0.103344f,
+    -0.061832f, -0.027563f, -0.003208f, -0.010597f, -0.066958f, -0.052581f,
+    -0.020887f, -0.031236f, -0.047807f, -0.062105f, -0.054899f, 0.006065f,
+    -0.020260f, -0.067892f, -0.072068f, -0.026331f, -0.022481f, -0.041147f,
+    0.054504f,  0.262466f,  0.028207f,  0.076534f,  0.119470f,  0.131979f,
+    0.139727f,  0.156933f,  0.167189f,  0.093731f,  0.004615f,  -0.034880f,
+    -0.023215f, 0.013101f,  0.045572f,  0.063726f,  0.056598f,  0.040334f,
+    -0.006171f, -0.084244f, -0.081001f, 0.011960f,  0.133879f,  0.217591f,
+    0.173385f,  0.024804f,  -0.170638f, -0.389717f, -0.539379f, -0.473699f,
+    -0.186807f, 0.084692f,  0.208241f,  0.264362f,  0.250138f,  0.138638f,
+    0.036656f,  -0.018276f, -0.038977f, -0.032964f, -0.068433f, -0.047799f,
+    0.012147f,  0.043367f,  0.074947f,  0.034934f,  -0.004251f, 0.029946f,
+    -0.022477f, -0.062976f, -0.062295f, -0.049623f, -0.023499f, -0.004018f,
+    -0.020585f, -0.032476f, 0.005148f,  0.011643f,  -0.062743f, -0.014947f,
+    0.064884f,  0.158367f,  0.227609f,  0.221966f,  0.134565f,  0.048909f,
+    0.055769f,  0.091062f,  0.074900f,  0.000434f,  -0.076740f, -0.102557f,
+    -0.074605f, 0.006548f,  0.102177f,  0.124132f,  0.083466f,  0.026579f,
+    -0.031365f, -0.080509f, -0.134965f, -0.207890f, -0.234588f, -0.158735f,
+    0.008542f,  0.210487f,  0.350484f,  0.349497f,  0.254170f,  0.121109f,
+    0.020669f,  0.000838f,  0.002645f,  -0.006848f, -0.036067f, -0.088749f,
+    -0.132526f, -0.098950f, -0.091632f, -0.087340f, -0.068798f, -0.113539f,
+    -0.125514f, -0.086200f, -0.039358f, -0.057591f, -0.045414f, 0.042705f,
+    0.064254f,  0.011538f,  -0.008754f, 0.059379f,  0.110302f,  -0.000954f,
+    -0.124720f, -0.080675f, -0.080933f, -0.058477f, -0.004262f, 0.034134f,
+    0.048398f,  0.024263f,  0.019641f,  0.040235f,  0.034376f,  0.014514f,
+    0.022720f,  0.053223f,  0.028069f,  -0.002627f, 0.001327f,  0.030137f,
+    0.029924f,  0.035392f,  0.038373f,  0.019640f,  -0.007430f, -0.011869f,
+    0.014981f,  0.019394f,  -0.004433f, 0.010311f,  -0.001696f, 0.007670f,
+    0.014842f,  0.013238f,  0.043509f,  0.098669f,  0.076561f,  0.081519f,
+    0.047290f,  0.029336f,  0.023733f,  0.009632f,  0.041366f,  0.026796f,
+    0.050046f,  0.015257f,  0.000222f,  -0.009509f, 0.003322f,  0.056836f,
+    -0.032570f, -0.058204f, -0.025980f, -0.005259f, -0.002303f, 0.021765f,
+    0.087858f,  0.008441f,  -0.208692f, -0.097416f, 0.064920f,  0.165796f,
+    0.165188f,  0.074387f,  -0.027126f, -0.047004f, -0.037303f, -0.028066f,
+    0.026954f,  0.102080f,  0.083212f,  -0.071621f, -0.217583f, -0.226269f,
+    -0.051522f, 0.191595f,  0.245698f,  0.059222f,  -0.161935f, -0.274563f,
+    -0.228963f, -0.040694f, 0.119138f,  0.174841f,  0.190673f,  0.184120f,
+    0.115419f,  -0.005614f, -0.133695f, -0.170590f, -0.112591f, -0.026481f,
+    0.031995f,  0.031513f,  0.045268f,  0.039812f,  0.001110f,  0.058153f,
+    0.096244f,  0.046660f,  0.010065f,  0.023056f,  -0.002421f, -0.044362f,
+    -0.073922f, -0.062889f, 0.022296f,  0.026402f,  -0.089662f, -0.076628f,
+    0.017156f,  -0.005346f, -0.045256f, 0.270940f,  0.134025f,  0.075760f,
+    -0.001643f, -0.012507f, -0.019517f, -0.039149f, -0.051177f, -0.013833f,
+    0.014315f,  -0.007366f, -0.011820f, 0.007097f,  0.005722f,  0.024888f,
+    0.037669f,  0.029048f,  0.034239f,  0.019188f,  -0.014163f, -0.002011f,
+    -0.005605f, -0.020305f, -0.030572f, -0.044389f, -0.046947f, -0.021930f,
+    -0.007391f, -0.043846f, -0.060730f, -0.049369f, -0.007959f, 0.042285f,
+    -0.020686f, -0.058709f, -0.036626f, -0.014496f, -0.010355f, 0.013028f,
+    0.011313f,  0.018585f,  0.030190f,  -0.002760f, 0.029254f,  -0.002599f,
+    -0.016203f, -0.022847f, -0.045466f, -0.116741f, -0.099632f, -0.023025f,
+    -0.078486f, -0.080840f, -0.028434f, -0.060279f, -0.053626f, -0.095053f,
+    -0.061067f, -0.138184f, -0.206051f, -0.218747f, -0.174026f, -0.058491f,
+    0.073089f,  0.149321f,  0.144989f,  0.122158f,  0.118468f,  0.089826f,
+    0.029045f,  -0.028159f, -0.080997f, -0.153123f, -0.204464f, -0.177836f,
+    -0.092209f, -0.009262f, 0.040684f,  0.060495f,  0.051841f,  0.018443f,
+    -0.002115f, 0.007749f,  0.015495f,  0.004543f,  0.002847f,  0.006769f,
+    0.001060f,  0.002818f,  0.014502f,  0.034762f,  0.084206f,  0.111178f,
+    0.093326f,  0.065739f,  0.053115f,  0.047405f,  0.031933f,  0.051207f,
+    0.005405f,  -0.059980f, -0.085679f, -0.028027f, 0.025094f,  0.013150f,
+    -0.008295f, 0.029219f,  0.068789f,  0.020811f,  -0.005925f, -0.002884f,
+    -0.019610f, -0.009404f, 0.010678f,  0.047487f,  0.046265f,  0.018323f,
+    -0.010327f, -0.040232f, -0.053488f, -0.021777f, -0.004510f, -0.003353f,
+    0.009812f,  0.009073f,  0.021925f,  0.018871f,  -0.026499f, -0.026027f,
+    0.040844f,  0.047579f,  0.007372f,  0.024990f,  0.042748f,  0.021532f,
+    -0.013223f, -0.040077f, -0.010902f, 0.037965f,  0.061833f,  0.068008f,
+    0.065401f,  0.045753f,  0.041256f,  0.057486f,  0.075253f,  0.060969f,
+    0.024780f,  0.007731f,  0.035628f,  0.083738f,  0.126385f,  0.175037f,
+    0.238217f,  0.282249f,  0.310358f,  0.326061f,  0.295334f,  0.189973f,
+    0.000085f,  -0.250126f, -0.529046f, -0.736733f, -0.864050f, -1.010288f,
+    -1.118515f, -1.045775f, -0.972934f, -1.004030f, -0.603807f, -0.435674f,
+    -0.180382f, 0.095662f,  0.311244f,  0.407814f,  0.400984f,  0.347168f,
+    0.278047f,  0.190277f,  0.107234f,  0.070733f,  0.082481f,  0.094772f,
+    0.108684f,  0.136690f,  0.167817f,  0.194069f,  0.164878f,  0.050657f,
+    -0.081635f, -0.130907f, -0.061929f, 0.052344f,  0.106825f,  0.093138f,
+    0.064507f,  0.039893f,  0.012526f,  -0.000358f, 0.002796f,  -0.005565f,
+    -0.021103f, -0.016521f, -0.002019f, 0.023883f,  0.071984f,  0.090226f,
+    0.033464f,  -0.015557f, 0.021049f,  0.029465f,  0.002532f,  -0.017381f,
+    -0.011188f, 0.017620f,  0.038592f,  0.008956f,  -0.047071f, -0.035502f,
+    -0.016732f, -0.014099f, -0.022488f, -0.020478f, 0.031183f,  0.066790f,
+    0.001428f,  -0.020110f, -0.034102f, -0.045380f, -0.052587f, -0.049273f,
+    -0.051106f, -0.051580f, -0.033812f, -0.000821f, 0.022478f,  0.018494f,
+    -0.012347f, -0.035969f, -0.016422f, 0.027189f,  0.041347f,  0.046050f,
+    0.085389f,  0.117869f,  0.111958f,  0.063417f,  -0.004186f, -0.058597f,
+    -0.092408f, -0.091850f, -0.080929f, -0.094666f, -0.109622f, -0.104182f,
+    -0.102626f, -0.098889f, -0.098467f, -0.080636f, -0.016686f, 0.067672f,
+    0.128263f,  0.184202f,  0.327149f,  0.445329f,  0.379787f,  0.258621f,
+    0.153988f,  0.064343f,  -0.032364f, -0.154042f, -0.237118f, -0.284257f,
+    -0.225245f, -0.182758f, -0.141801f, -0.050232f, 0.029185f,  -0.024485f,
+    -0.041944f, 0.145630f,  -0.002748f, -0.002749f, -0.002748f, -0.002750f,
+    -0.002747f, -0.002751f, -0.002745f, -0.002752f, -0.002744f, -0.002754f,
+    -0.002743f, -0.002755f, -0.002741f, -0.002756f, -0.002741f, -0.002757f,
+    -0.002739f, -0.002758f, -0.002738f, -0.002759f, -0.002739f, -0.002758f,
+    -0.002740f, -0.002756f, -0.002742f, -0.002755f, -0.002742f, -0.002755f,
+    -0.002742f, -0.002754f, -0.002743f, -0.002753f, -0.002745f, -0.002751f,
+    -0.002747f, -0.002750f, -0.002747f, -0.002750f, -0.002747f, -0.002749f,
+    -0.002748f, -0.002748f, -0.002749f, -0.002747f, -0.002750f, -0.002746f,
+    -0.002751f, -0.002746f, -0.002751f, -0.002746f, -0.002751f, -0.002747f,
+    -0.002750f, -0.002747f, -0.002749f, -0.002748f, -0.178269f, -0.144491f,
+    -0.099790f, -0.070600f, -0.080805f, -0.106326f, -0.102963f, -0.056470f,
+    -0.004202f, 0.022975f,  0.017601f,  -0.010942f, -0.044308f, -0.082398f,
+    -0.107826f, -0.066024f, 0.038688f,  0.125613f,  0.152178f,  0.159234f,
+    0.180218f,  0.187030f,  0.143670f,  0.073047f,  0.032793f,  0.057514f,
+    0.129359f,  0.186270f,  0.191294f,  0.155122f,  0.121344f,  0.140716f,
+    0.220461f,  0.298603f,  0.327475f,  0.259191f,  0.088086f,  -0.130851f,
+    -0.302475f, -0.344762f, -0.360087f, -0.383085f, -0.314550f, -0.192566f,
+    -0.058454f, 0.018459f,  -0.034798f, -0.122257f, -0.080749f, 0.003112f,
+    0.032094f,  0.019818f,  0.018952f,  -0.008784f, -0.010244f, 0.021390f,
+    0.192938f,  0.050984f,  -0.132138f, -0.236404f, -0.225315f, -0.144724f,
+    -0.067315f, 0.007712f,  0.052865f,  0.058610f,  0.028134f,  -0.018594f,
+    -0.059846f, -0.069938f, -0.054932f, -0.041569f, -0.030473f, -0.011394f,
+    -0.004679f, 0.010073f,  0.041261f,  0.051259f,  0.022710f,  0.000969f,
+    -0.023417f, -0.064039f, -0.056615f, 0.009404f,  0.061164f,  0.064454f,
+    0.059762f,  0.049974f,  0.043235f,  0.002145f,  -0.043126f, -0.021158f,
+    -0.011771f, 0.015441f,  0.050590f,  0.014810f,  0.032844f,  0.061963f,
+    0.006272f,  -0.026911f, -0.018949f, -0.004527f, 0.023956f,  0.070646f,
+    0.065646f,  0.014458f,  0.023862f,  -0.070779f, -0.181348f, -0.220079f,
+    -0.261224f, -0.626085f, -0.006224f, -0.026168f, -0.036489f, -0.018356f,
+    -0.007371f, 0.000945f,  0.047009f,  0.088677f,  0.053509f,  0.008976f,
+    -0.016272f, -0.025381f, 0.009533f,  0.015256f,  -0.031443f, -0.036246f,
+    0.001535f,  0.015435f,  -0.028956f, -0.067127f, -0.052616f, -0.031857f,
+    -0.048756f, -0.070197f, -0.053674f, -0.002546f, 0.035085f,  0.013917f,
+    -0.017801f, -0.035968f, -0.057282f, -0.062098f, -0.064760f, -0.071059f,
+    -0.050068f, -0.014113f, -0.030948f, -0.080558f, -0.137081f, -0.123805f,
+    -0.092844f, -0.073119f, -0.072863f, -0.089741f, -0.111270f, -0.118783f,
+    -0.044717f, 0.027710f,  0.077697f,  0.153772f,  0.232151f,  0.369942f,
+    0.403094f,  0.308928f,  0.285465f,  0.244974f,  -0.078197f, -0.019682f,
+    0.000246f,  -0.029101f, -0.064958f, -0.085649f, -0.080753f, -0.106464f,
+    -0.113148f, -0.089092f, -0.067298f, -0.061231f, -0.079475f, -0.085608f,
+    -0.066065f, -0.081536f, -0.115619f, -0.126994f, -0.071767f, 0.006584f,
+    0.036615f,  0.024912f,  -0.021734f, -0.090305f, -0.122465f, -0.101020f,
+    -0.084858f, -0.118844f, -0.128820f, -0.069136f, -0.025009f, 0.040828f,
+    0.034690f,  0.009555f,  0.036633f,  0.045532f,  0.056898f,  0.086388f,
+    0.105789f,  0.123254f,  0.109076f,  0.077992f,  0.067515f,  -0.024112f,
+    -0.025614f, -0.022316f, -0.045191f, -0.046842f, -0.060306f, -0.083405f,
+    -0.075152f, -0.045513f, -0.025644f, -0.025809f, 0.141601f,  0.129623f,
+    0.398612f,  0.318507f,  0.205993f,  0.108618f,  0.028297f,  -0.028781f,
+    -0.062845f, -0.056179f, -0.064040f, -0.083433f, -0.094845f, -0.094862f,
+    -0.100568f, -0.079225f, 0.008587f,  0.131322f,  0.152648f,  0.014688f,
+    -0.161329f, -0.249047f, -0.226938f, -0.131338f, -0.021893f, 0.050316f,
+    0.087714f,  0.119140f,  0.126329f,  0.081301f,  0.018821f,  -0.009283f,
+    0.014575f,  0.068658f,  0.126037f,  0.159319f,  0.166484f,  0.162451f,
+    0.131360f,  0.072585f,  0.005726f,  -0.037313f, -0.086332f, -0.133216f,
+    -0.150722f, -0.180683f, -0.226539f, -0.193808f, -0.067856f, 0.066017f,
+    0.074243f,  0.078706f,  0.112387f,  0.069194f,  0.045067f,  0.066819f,
+    -0.071606f, -0.283080f, -0.170226f, -0.139747f, -0.110625f, -0.093451f,
+    -0.079960f, -0.050305f, 0.023994f,  0.141279f,  0.218367f,  0.204241f,
+    0.111067f,  0.004363f,  -0.029138f, 0.016106f,  0.059556f,  0.043674f,
+    -0.032039f, -0.139091f, -0.258871f, -0.336992f, -0.293521f, -0.119289f,
+    0.082207f,  0.205749f,  0.240409f,  0.198144f,  0.072464f,  -0.056499f,
+    -0.092279f, -0.080298f, -0.053300f, -0.029020f, -0.025721f, 0.017708f,
+    0.061898f,  0.026209f,  -0.007725f, 0.018507f,  0.054873f,  0.105171f,
+    0.065942f,  0.027143f,  -0.005948f, -0.047437f, -0.067624f, -0.063533f,
+    -0.034893f, -0.008844f, -0.027780f, -0.013554f, 0.006071f,  -0.004094f,
+    -0.019479f, -0.038945f, -0.029425f, 0.042240f,  0.044957f,  0.074999f,
+    0.106651f,  0.132364f,  0.124577f,  0.069213f,  -0.012470f, -0.079422f,
+    -0.100774f, -0.095742f, -0.064851f, -0.009489f, 0.018613f,  0.002283f,
+    -0.044811f, -0.137467f, -0.262375f, -0.359028f, -0.382779f, -0.331064f,
+    -0.260687f, -0.246500f, -0.313245f, -0.417124f, -0.507665f, -0.565919f,
+    -0.586977f, -0.557091f, -0.475764f, -0.362928f, -0.254045f, -0.178048f,
+    -0.123470f, -0.083108f, -0.037391f, 0.031896f,  0.124128f,  0.161777f,
+    0.105064f,  0.040544f,  0.008314f,  -0.027729f, -0.074640f, -0.048164f,
+    -0.006693f, -0.020114f, -0.000179f, 0.064134f,  0.075402f,  0.049696f,
+    0.039840f,  0.044121f,  -0.038104f, -0.131433f, -0.106525f, -0.091868f,
+    -0.010300f, 0.024966f,  0.066552f,  0.098797f,  0.112303f,  0.111338f,
+    0.101957f,  0.085838f,  0.082524f,  0.089746f,  0.076197f,  0.035491f,
+    -0.021308f, -0.081665f, -0.109176f, -0.088148f, -0.057931f, -0.051094f,
+    -0.046560f, -0.044873f, -0.055106f, -0.069332f, -0.059362f, -0.024041f,
+    0.019934f,  0.047357f,  0.038478f,  -0.002857f, -0.041932f, -0.052436f,
+    -0.038073f, 0.007743f,  0.035904f,  -0.000667f, -0.061687f, -0.087339f,
+    -0.117707f, -0.157942f, -0.116641f, -0.008709f, 0.152918f,  0.326885f,
+    0.376020f,  0.352637f,  0.270215f,  0.155053f,  0.008145f,  -0.144871f,
+    -0.186879f, -0.209464f, -0.199565f, -0.162690f, -0.164723f, -0.171063f,
+    -0.086521f, 0.020923f,  0.025710f,  0.013895f,  0.022158f,  0.037228f,
+    0.020533f,  -0.020029f, -0.059959f, -0.080480f, -0.081512f, -0.079943f,
+    -0.061366f, -0.041705f, -0.024544f, -0.004994f, 0.029877f,  0.071984f,
+    0.063343f,  0.019545f,  0.026269f,  0.135852f,  0.278293f,  0.360249f,
+    0.370774f,  0.294252f,  0.172301f,  0.092765f,  0.070721f,  0.050071f,
+    -0.002721f, -0.025461f, 0.004258f,  0.040472f,  0.031032f,  -0.035574f,
+    -0.093028f, -0.121506f, -0.094779f, -0.028678f, -0.004596f, 0.004244f,
+    0.063478f,  0.069502f,  0.018188f,  0.007184f,  0.005708f,  -0.044405f,
+    -0.076104f, -0.067013f, 0.012263f,  0.021330f,  -0.035929f, -0.064915f,
+    -0.055455f, -0.073414f, -0.029894f, 0.008145f,  0.224284f,  0.098830f,
+    -0.080016f, -0.241448f, -0.326712f, -0.321107f, -0.231548f, -0.107181f,
+    -0.013035f, 0.019639f,  0.021848f,  0.035874f,  0.059671f,  0.092642f,
+    0.089396f,  -0.000454f, -0.128901f, -0.172735f, -0.075283f, 0.085874f,
+    0.195570f,  0.202618f,  0.118889f,  0.020992f,  -0.018252f, -0.028154f,
+    -0.061980f, -0.085254f, -0.042085f, 0.000021f,  0.021583f,  0.023738f,
+    0.012466f,  0.000039f,  -0.033621f, -0.066202f, -0.063186f, -0.022245f,
+    0.085637f,  0.165553f,  0.124605f,  0.024392f,  -0.030405f, -0.042431f,
+    -0.092482f, -0.097204f, -0.068495f, -0.006663f, -0.000522f, -0.068025f,
+    -0.047568f, 0.041606f,  0.043431f,  0.006216f,  0.029478f,  0.204500f,
+    0.283698f,  0.261780f,  0.184559f,  0.041141f,  -0.099290f, -0.162282f,
+    -0.140275f, -0.066957f, 0.000242f,  0.016078f,  -0.030603f, -0.070660f,
+    -0.052896f, 0.033173f,  0.086446f,  0.016552f,  -0.107782f, -0.141634f,
+    -0.062976f, 0.027062f,  0.079328f,  0.109280f,  0.097274f,  0.044954f,
+    -0.008126f, -0.066702f, -0.122060f, -0.111593f, -0.022657f, 0.068995f,
+    0.115503f,  0.089563f,  0.049253f,  0.015818f,  0.037438f,  0.086638f,
+    0.014025f,  -0.132599f, -0.250341f, -0.311190f, -0.231022f, -0.079306f,
+    -0.013345f, 0.047254f,  0.101910f,  0.146107f,  0.187026f,  0.214771f,
+    0.193855f,  0.092135f,  -0.046890f, -0.146585f, -0.184458f, -0.223288f,
+    -0.184720f, -0.008985f, 0.282632f,  0.273706f,  0.223564f,  0.133011f,
+    0.025866f,  -0.056991f, -0.063473f, -0.054986f, -0.066376f, -0.083293f,
+    -0.100103f, -0.109986f, -0.082960f, -0.035400f, -0.028351f, -0.077515f,
+    -0.151428f, -0.189386f, -0.170666f, -0.132326f, -0.108165f, -0.081127f,
+    -0.006871f, 0.096999f,  0.149379f,  0.119994f,  0.069175f,  0.050618f,
+    0.074004f,  0.103362f,  0.098275f,  0.083767f,  0.076345f,  0.077701f,
+    0.094669f,  0.119005f,  0.102953f,  0.065002f,  0.064662f,  0.061617f,
+    0.049316f,  0.008712f,  -0.010102f, -0.006389f, -0.023676f, -0.007881f,
+    -0.022901f, -0.065180f, -0.082828f, -0.067398f, -0.009360f, 0.040745f,
+    0.051455f,  0.006956f,  0.002767f,  0.124663f,  0.313545f,  0.156806f,
+    -0.015367f, -0.114954f, -0.110661f, -0.062018f, -0.029062f, -0.035651f,
+    -0.058754f, -0.053274f, -0.036180f, -0.021552f, 0.008253f,  0.029535f,
+    -0.010302f, -0.046710f, -0.000940f, 0.067548f,  0.088951f,  0.044737f,
+    -0.039897f, -0.110811f, -0.085676f, 0.011299f,  0.048289f,  -0.005705f,
+    -0.035397f, -0.000334f, 0.012473f,  -0.028975f, -0.064042f, -0.021675f,
+    0.014895f,  -0.037598f, -0.120490f, -0.111285f, -0.063376f, -0.015516f,
+    0.065664f,  0.109275f,  0.062998f,  0.043845f,  0.050676f,  0.004010f,
+    0.003351f,  -0.003653f, -0.002527f, 0.055114f,  0.069003f,  0.008300f,
+    0.038332f,  0.022197f,  -0.030026f, -0.016495f, 0.075641f,  0.149469f,
+    -0.088775f, -0.059911f, 0.002109f,  0.071133f,  0.100023f,  0.075084f,
+    0.015041f,  -0.062509f, -0.124596f, -0.127338f, -0.054293f, 0.043499f,
+    0.111159f,  0.130424f,  0.100983f,  0.039005f,  -0.043437f, -0.089351f,
+    -0.043156f, 0.047771f,  0.061600f,  -0.030736f, -0.153215f, -0.244779f,
+    -0.304185f, -0.358909f, -0.397002f, -0.329999f, -0.105369f, 0.115912f,
+    0.265622f,  0.291622f,  0.214570f,  0.127977f,  0.073743f,  0.064769f,
+    0.054863f,  -0.006033f, -0.064908f, 0.000936f,  0.044330f,  0.026275f,
+    0.019273f,  0.061281f,  0.090515f,  0.027466f,  -0.040657f, -0.023728f,
+    0.019504f,  -0.039870f, -0.142772f, -0.079624f, 0.027066f,  -0.049073f,
+    -0.022867f, 0.328917f,  -0.160028f, -0.083171f, -0.005092f, 0.048959f,
+    0.068761f,  0.039818f,  0.003475f,  0.009821f,  0.042493f,  0.046446f,
+    0.038295f,  0.048183f,  0.072562f,  0.073739f,  0.056942f,  0.046802f,
+    0.052975f,  0.051782f,  0.027469f,  0.006353f,  0.022561f,  0.098226f,
+    0.213827f,  0.282087f,  0.256138f,  0.148112f,  -0.008519f, -0.190119f,
+    -0.341812f, -0.325145f, -0.160443f, 0.017143f,  0.114627f,  0.128165f,
+    0.084688f,  0.030190f,  0.004420f,  -0.003253f, -0.002899f, -0.025231f,
+    -0.007652f, -0.019125f, -0.015878f, 0.009701f,  0.002312f,  0.011763f,
+    -0.025676f, -0.023769f, -0.003987f, 0.012317f,  -0.067044f, -0.090981f,
+    -0.064009f, -0.042975f, -0.027161f, 0.084546f,  0.382906f,  0.280042f,
+    0.107470f,  -0.091450f, -0.296837f, -0.445203f, -0.462663f, -0.332929f,
+    -0.127708f, 0.063252f,  0.207448f,  0.260124f,  0.192661f,  0.094530f,
+    0.066067f,  0.069075f,  0.023275f,  -0.060690f, -0.124711f, -0.115471f,
+    -0.050810f, -0.020703f, -0.041751f, -0.048580f, -0.021836f, 0.009846f,
+    0.012257f,  -0.026805f, -0.058712f, -0.042235f, -0.026624f, -0.023087f,
+    -0.030017f, -0.006173f, 0.029051f,  -0.007858f, -0.022355f, 0.009573f,
+    -0.005398f, -0.019848f, 0.004212f,  -0.016532f, -0.039494f, -0.053557f,
+    -0.020677f, -0.008213f, -0.034972f, -0.005746f, -0.005979f, -0.046705f,
+    -0.050446f, 0.006373f,  0.039450f,  0.015441f,  0.069951f,  0.138688f,
+    -0.002182f, -0.002196f, -0.002180f, -0.002199f, -0.002175f, -0.002205f,
+    -0.002170f, -0.002209f, -0.002166f, -0.002212f, -0.002164f, -0.002214f,
+    -0.002162f, -0.002217f, -0.002158f, -0.002221f, -0.002153f, -0.002228f,
+    -0.002144f, -0.002237f, -0.002135f, -0.002246f, -0.002127f, -0.002252f,
+    -0.002125f, -0.002250f, -0.002131f, -0.002240f, -0.002143f, -0.002226f,
+    -0.002158f, -0.002211f, -0.002173f, -0.002196f, -0.002189f, -0.002180f,
+    -0.002205f, -0.002162f, -0.002223f, -0.002145f, -0.002240f, -0.002130f,
+    -0.002253f, -0.002120f, -0.002259f, -0.002116f, -0.002260f, -0.002118f,
+    -0.002256f, -0.002125f, -0.002245f, -0.002139f, -0.002230f, -0.002154f,
+    -0.002218f, -0.002164f, -0.168502f, -0.155392f, -0.141342f, -0.120179f,
+    -0.083597f, -0.038238f, 0.006355f,  0.043756f,  0.068477f,  0.079297f,
+    0.045232f,  -0.061092f, -0.184050f, -0.219792f, -0.123626f, 0.047832f,
+    0.181494f,  0.198901f,  0.121978f,  0.034014f,  0.004831f,  0.031053f,
+    0.049584f,  0.023216f,  -0.005329f, -0.013582f, -0.011991f, 0.004827f,
+    0.032321f,  0.055456f,  0.047521f,  -0.004627f, -0.101908f, -0.196743f,
+    -0.185057f, -0.084756f, 0.003950f,  0.109765f,  0.247848f,  0.317912f,
+    0.259190f,  0.149874f,  0.051698f,  0.009018f,  -0.042488f, -0.108666f,
+    -0.070087f, -0.009033f, -0.026676f, 0.007554f,  0.055872f,  -0.023456f,
+    -0.117292f, -0.114208f, -0.217512f, -0.483462f, -0.000927f, -0.000977f,
+    -0.000927f, -0.000972f, -0.000933f, -0.000965f, -0.000941f, -0.000958f,
+    -0.000946f, -0.000954f, -0.000949f, -0.000953f, -0.000949f, -0.000954f,
+    -0.000947f, -0.000956f, -0.000945f, -0.000959f, -0.000942f, -0.000960f,
+    -0.000942f, -0.000960f, -0.000943f, -0.000957f, -0.000948f, -0.000951f,
+    -0.000954f, -0.000944f, -0.000962f, -0.000936f, -0.000970f, -0.000928f,
+    -0.000979f, -0.000919f, -0.000987f, -0.000911f, -0.000994f, -0.000906f,
+    -0.000997f, -0.000905f, -0.000998f, -0.000903f, -0.001000f, -0.000901f,
+    -0.001002f, -0.000900f, -0.001002f, -0.000901f, -0.001000f, -0.000903f,
+    -0.000998f, -0.000906f, -0.000995f, -0.000908f, -0.000993f, -0.000914f,
+    0.170449f,  0.111832f,  0.061509f,  0.034626f,  0.032597f,  0.055009f,
+    0.066843f,  0.055600f,  0.058623f,  0.051682f,  0.052692f,  0.068504f,
+    0.041651f,  -0.000327f, 0.003264f,  0.035388f,  0.047207f,  0.048347f,
+    0.066408f,  0.080887f,  0.060435f,  0.037042f,  0.042190f,  0.056140f,
+    0.057668f,  0.059093f,  0.076428f,  0.117693f,  0.139141f,  0.112491f,
+    0.079420f,  0.090900f,  0.059229f,  0.123504f,  0.181034f,  0.188305f,
+    0.178973f,  0.184588f,  0.177143f,  0.123182f,  0.162201f,  0.108810f,
+    0.111067f,  0.048956f,  0.004599f,  -0.006033f, 0.023816f,  -0.035687f,
+    -0.054870f, 0.010877f,  -0.011136f, 0.056819f,  0.052400f,  0.030702f,
+    0.101024f,  0.026578f,  -0.071279f, 0.007827f,  0.089562f,  0.137286f,
+    0.156976f,  0.145467f,  0.116225f,  0.099787f,  0.046864f,  -0.048169f,
+    -0.088694f, -0.047685f, -0.001077f, -0.003027f, -0.025106f, -0.019102f,
+    0.022636f,  0.040404f,  -0.001459f, -0.053428f, -0.071541f, -0.051954f,
+    -0.004811f, 0.060865f,  0.117492f,  0.145324f,  0.132258f,  0.094620f,
+    0.060966f,  0.033037f,  -0.009116f, -0.089315f, -0.134457f, -0.085365f,
+    0.011455f,  0.113986f,  0.154485f,  0.106351f,  0.123011f,  0.167646f,
+    0.146084f,  0.087071f,  0.026782f,  0.032190f,  0.083910f,  0.039355f,
+    -0.073904f, -0.117984f, -0.053091f, -0.173804f, -0.326827f, -0.271563f,
+    -0.207562f, -0.203189f, -0.109354f, 0.113108f,  0.317103f,  0.267476f,
+    0.186054f,  0.077207f,  -0.039584f, -0.153165f, -0.238468f, -0.280374f,
+    -0.275428f, -0.248450f, -0.218441f, -0.170182f, -0.096744f, 0.007669f,
+    0.114282f,  0.165404f,  0.155749f,  0.116820f,  0.038705f,  -0.069985f,
+    -0.140551f, -0.103168f, 0.034496f,  0.191044f,  0.266196f,  0.219304f,
+    0.093041f,  -0.050173f, -0.162304f, -0.190806f, -0.151218f, -0.081688f,
+    -0.006129f, 0.059374f,  0.075582f,  0.055797f,  0.036048f,  0.030687f,
+    0.021758f,  0.001818f,  -0.061780f, -0.127169f, -0.107470f, -0.040042f,
+    -0.030194f, -0.075442f, -0.072281f, -0.023902f, -0.023388f, -0.052717f,
+    -0.040667f, -0.025784f, -0.022352f, 0.022126f,  0.056372f,  0.077350f,
+    -0.147737f, -0.146721f, -0.139979f, -0.131516f, -0.103352f, -0.070463f,
+    -0.065045f, -0.090376f, -0.125027f, -0.130411f, -0.075100f, 0.007611f,
+    0.031964f,  -0.022783f, -0.094614f, -0.111196f, -0.077144f, -0.027303f,
+    -0.000765f, 0.007274f,  -0.004670f, -0.039647f, -0.063053f, -0.064942f,
+    -0.068035f, -0.077266f, -0.069046f, -0.055801f, -0.081909f, -0.087639f,
+    -0.042670f, -0.005039f, 0.009189f,  0.000279f,  -0.063592f, -0.135643f,
+    -0.172559f, -0.222558f, -0.325603f, -0.373535f, -0.292026f, -0.256831f,
+    -0.176452f, -0.046166f, 0.083572f,  0.216161f,  0.309786f,  0.317490f,
+    0.206041f,  0.205286f,  0.200158f,  0.131905f,  0.055241f,  0.079210f,
+    0.077381f,  -0.063348f, -0.012467f, -0.108332f, -0.171988f, -0.134691f,
+    -0.019361f, 0.102175f,  0.161120f,  0.128829f,  0.019681f,  -0.109203f,
+    -0.182229f, -0.157299f, -0.085657f, -0.043252f, -0.018621f, 0.068280f,
+    0.207467f,  0.289560f,  0.257409f,  0.173453f,  0.108917f,  0.052399f,
+    -0.057543f, -0.225860f, -0.347061f, -0.332781f, -0.210191f, -0.073803f,
+    0.011359f,  0.057054f,  0.081216f,  0.086270f,  0.075213f,  0.022506f,
+    -0.040686f, -0.039368f, 0.014036f,  0.028811f,  0.004809f,  -0.008089f,
+    0.024572f,  0.029243f,  0.005492f,  0.003668f,  0.021133f,  0.043907f,
+    0.065006f,  0.008950f,  -0.049130f, -0.018669f, -0.015941f, -0.039538f,
+    -0.033632f, -0.029722f, -0.025499f, -0.006940f, -0.031878f, -0.000658f,
+    0.019976f,  0.023697f,  0.018466f,  0.020986f,  0.026111f,  0.044988f,
+    0.028800f,  -0.015739f, -0.047642f, -0.013353f, 0.061546f,  0.086231f,
+    0.029444f,  -0.049661f, -0.062478f, 0.014876f,  0.096376f,  0.087145f,
+    0.014885f,  -0.026705f, -0.012710f, 0.003647f,  -0.020433f, -0.058527f,
+    -0.067131f, -0.048664f, -0.037282f, 0.001153f,  0.063082f,  0.071642f,
+    0.023717f,  -0.027916f, -0.039394f, -0.033427f, -0.054078f, -0.110245f,
+    -0.171888f, -0.237947f, -0.244049f, -0.136603f, -0.056125f, -0.068610f,
+    -0.081588f, -0.047277f, 0.019409f,  0.009781f,  0.039463f,  0.084137f,
+    0.075378f,  0.017479f,  0.015978f,  -0.065212f, -0.118884f, -0.000447f,
+    -0.131921f, -0.059916f, -0.015869f, -0.025867f, -0.037853f, -0.021394f,
+    0.020486f,  0.030232f,  -0.006170f, -0.063674f, -0.089043f, -0.041339f,
+    0.041185f,  0.089834f,  0.090555f,  0.067270f,  0.037147f,  -0.002633f,
+    -0.041318f, -0.038022f, -0.002119f, 0.008133f,  -0.019094f, -0.049664f,
+    -0.070978f, -0.092471f, -0.117843f, -0.116600f, -0.089161f, -0.082151f,
+    -0.056026f, -0.008613f, 0.000025f,  0.003325f,  0.027542f,  0.066774f,
+    0.094218f,  0.111622f,  0.151155f,  0.113568f,  0.042255f,  -0.054403f,
+    -0.170608f, -0.243232f, -0.266578f, -0.267615f, -0.241349f, -0.043531f,
+    0.129209f,  0.187425f,  0.284806f,  0.221081f,  0.013855f,  -0.040575f,
+    -0.057676f, -0.216484f, 0.134537f,  0.026199f,  -0.071931f, -0.121015f,
+    -0.118530f, -0.086476f, -0.065914f, -0.046144f, -0.012898f, -0.000813f,
+    0.000750f,  0.034924f,  0.051833f,  0.030416f,  0.026436f,  0.029809f,
+    0.015699f,  0.007571f,  0.024831f,  0.036193f,  0.032725f,  0.045912f,
+    0.053243f,  0.032229f,  0.021798f,  0.025329f,  0.014353f,  -0.003425f,
+    0.007319f,  -0.003808f, -0.027539f, -0.042285f, -0.109905f, -0.182162f,
+    -0.195861f, -0.162151f, -0.082935f, 0.014637f,  0.168370f,  0.240770f,
+    0.265590f,  0.271110f,  0.368901f,  0.347154f,  0.251132f,  0.144672f,
+    0.040967f,  -0.044725f, -0.104172f, -0.150077f, -0.171472f, -0.170609f,
+    -0.156063f, -0.167100f, -0.136366f, 0.053416f,  -0.054081f, -0.018879f,
+    0.009028f,  0.011711f,  -0.010532f, -0.003756f, 0.045051f,  0.087317f,
+    0.091046f,  0.056147f,  0.037220f,  0.034408f,  0.021091f,  0.007530f,
+    0.032561f,  0.060962f,  0.021933f,  -0.033149f, -0.015696f, 0.035450f,
+    0.043313f,  0.002376f,  -0.039785f, -0.034214f, 0.025232f,  0.088476f,
+    0.105523f,  0.096222f,  0.107455f,  0.138416f,  0.134853f,  0.134046f,
+    0.135954f,  0.114027f,  0.081204f,  0.053042f,  0.010589f,  -0.018235f,
+    -0.005761f, 0.021280f,  0.047583f,  0.054346f,  0.090895f,  0.142228f,
+    0.180458f,  0.218704f,  0.244626f,  0.219930f,  0.163909f,  0.148162f,
+    0.054102f,  0.004003f,  0.012970f,  0.047411f,  0.030120f,  0.020179f,
+    -0.001480f, 0.141108f,  0.272762f,  0.326527f,  0.294675f,  0.205717f,
+    0.120082f,  0.070746f,  0.084992f,  0.110428f,  0.097707f,  0.040889f,
+    -0.056201f, -0.130034f, -0.128125f, -0.093438f, -0.089573f, -0.108042f,
+    -0.116255f, -0.133154f, -0.161192f, -0.160354f, -0.122464f, -0.071464f,
+    -0.014881f, 0.013538f,  -0.023046f, -0.088020f, -0.092051f, -0.000387f,
+    0.080062f,  0.092960f,  0.034233f,  -0.059379f, -0.115871f, -0.146733f,
+    -0.193573f, -0.231588f, -0.213665f, -0.085591f, 0.008617f,  0.040153f,
+    0.032708f,  0.010304f,  0.012588f,  0.042770f,  0.027073f,  0.025788f,
+    0.005081f,  0.006532f,  0.034151f,  -0.010047f, -0.034781f, -0.016537f,
+    0.005040f,  -0.010324f, -0.098880f, -0.074239f, -0.051585f, -0.031709f,
+    -0.000471f, 0.006333f,  -0.002998f, -0.023117f, -0.012655f, 0.043756f,
+    0.086684f,  0.047239f,  -0.036279f, -0.100814f, -0.076272f, 0.029777f,
+    0.100125f,  0.049499f,  -0.040176f, -0.049968f, -0.002493f, 0.014062f,
+    0.007705f,  0.019985f,  0.020664f,  -0.007299f, -0.012506f, 0.014147f,
+    0.012853f,  0.018024f,  0.019019f,  -0.010744f, -0.007774f, 0.002947f,
+    0.010236f,  0.044012f,  0.000832f,  0.000534f,  0.050496f,  -0.058672f,
+    -0.077347f, 0.063836f,  0.084116f,  -0.034719f, -0.113784f, 0.032279f,
+    0.155650f,  0.046203f,  -0.295766f, -0.213079f, 0.225265f,  0.194254f,
+    -0.046779f, -0.058647f, -0.367874f, -0.996559f, 0.168970f,  0.172220f,
+    0.165392f,  0.111082f,  0.052698f,  -0.002076f, -0.077064f, -0.144804f,
+    -0.186552f, -0.221601f, -0.184098f, -0.040675f, 0.103106f,  0.130300f,
+    0.038850f,  -0.084694f, -0.092780f, 0.063661f,  0.204748f,  0.134401f,
+    -0.103262f, -0.313732f, -0.332489f, -0.134557f, 0.095642f,  0.202219f,
+    0.213025f,  0.189751f,  0.140738f,  0.065128f,  -0.004847f, -0.040791f,
+    -0.072051f, -0.095036f, -0.094191f, -0.080836f, -0.055883f, -0.032600f,
+    -0.011956f, 0.021861f,  0.050953f,  0.037634f,  0.004825f,  -0.002917f,
+    -0.019477f, -0.058242f, -0.102724f, -0.102124f, -0.031146f, -0.019651f,
+    -0.082669f, -0.053296f, -0.012675f, 0.006513f,  0.110518f,  0.334813f,
+    -0.187173f, -0.004578f, 0.051805f,  0.051689f,  0.027922f,  -0.022002f,
+    -0.024361f, 0.004551f,  -0.000145f, -0.005046f, -0.004287f, -0.024483f,
+    -0.012835f, -0.005473f, -0.011185f, 0.027465f,  0.057098f,  -0.001637f,
+    -0.060270f, -0.046548f, -0.006933f, 0.042336f,  0.076970f,  0.040984f,
+    -0.024030f, -0.023474f, 0.030776f,  0.056036f,  0.026331f,  0.008628f,
+    0.014878f,  0.019186f,  0.026204f,  0.045257f,  0.020730f,  -0.062715f,
+    -0.104955f, -0.066981f, -0.002381f, 0.028068f,  -0.003594f, -0.053169f,
+    -0.054640f, -0.022534f, 0.003057f,  0.026942f,  0.034558f,  -0.006933f,
+    -0.054588f, -0.089049f, -0.161517f, -0.263964f, -0.335688f, -0.260458f,
+    -0.122849f, -0.144930f, -0.002352f, -0.002498f, -0.002343f, -0.002499f,
+    -0.002343f, -0.002498f, -0.002347f, -0.002491f, -0.002357f, -0.002476f,
+    -0.002375f, -0.002457f, -0.002394f, -0.002439f, -0.002407f, -0.002435f,
+    -0.002404f, -0.002442f, -0.002397f, -0.002444f, -0.002403f, -0.002431f,
+    -0.002419f, -0.002415f, -0.002432f, -0.002406f, -0.002436f, -0.002407f,
+    -0.002432f, -0.002413f, -0.002426f, -0.002418f, -0.002423f, -0.002420f,
+    -0.002423f, -0.002418f, -0.002426f, -0.002413f, -0.002431f, -0.002408f,
+    -0.002434f, -0.002409f, -0.002429f, -0.002419f, -0.002414f, -0.002435f,
+    -0.002401f, -0.002441f, -0.002405f, -0.002430f, -0.002419f, -0.002418f,
+    -0.002427f, -0.002414f, -0.002427f, -0.002415f, 0.146748f,  0.052434f,
+    -0.059643f, -0.153430f, -0.194036f, -0.160958f, -0.062814f, 0.078495f,
+    0.174157f,  0.173827f,  0.112882f,  0.036379f,  -0.036741f, -0.117740f,
+    -0.210632f, -0.263632f, -0.210669f, -0.060575f, 0.106642f,  0.234134f,
+    0.283367f,  0.244427f,  0.171705f,  0.087483f,  -0.008169f, -0.101740f,
+    -0.199873f, -0.318267f, -0.426080f, -0.442738f, -0.340364f, -0.161454f,
+    0.038330f,  0.173924f,  0.190392f,  0.173020f,  0.174949f,  0.151353f,
+    0.117715f,  0.094095f,  0.042373f,  0.028228f,  0.028295f,  0.018127f,
+    -0.029517f, -0.078976f, -0.058108f, -0.076175f, -0.072944f, -0.040104f,
+    -0.054306f, -0.043932f, 0.014406f,  -0.011903f, -0.041076f, 0.082274f,
+    -0.334432f, -0.305856f, -0.227778f, -0.121174f, -0.003493f, 0.093845f,
+    0.172494f,  0.234093f,  0.277946f,  0.278056f,  0.249000f,  0.219031f,
+    0.169702f,  0.095289f,  0.040399f,  0.042712f,  0.114303f,  0.199888f,
+    0.237040f,  0.226988f,  0.160462f,  0.048015f,  -0.016486f, 0.004284f,
+    0.024097f,  -0.014527f, -0.063937f, -0.075998f, -0.055402f, -0.012129f,
+    0.026397f,  -0.004456f, -0.076115f, -0.122954f, -0.117575f, -0.021400f,
+    0.067014f,  0.108637f,  0.133071f,  0.080554f,  0.006999f,  0.008420f,
+    0.007344f,  -0.026036f, -0.056404f, -0.064113f, -0.070172f, -0.091532f,
+    -0.119886f, -0.111567f, -0.129722f, -0.155179f, -0.059106f, 0.083966f,
+    0.073507f,  -0.008032f, -0.022057f, 0.001416f,  0.004815f,  -0.023496f,
+    -0.003089f, 0.033676f,  0.062091f,  0.054762f,  0.012213f,  0.008036f,
+    0.057484f,  0.051210f,  0.020136f,  0.023859f,  0.005399f,  0.002275f,
+    0.017750f,  -0.003416f, -0.006897f, 0.034689f,  0.082420f,  0.101998f,
+    0.088930f,  0.058392f,  0.043871f,  0.044541f,  0.031651f,  0.002354f,
+    -0.008125f, 0.003931f,  0.002853f,  -0.030661f, -0.050241f, -0.007511f,
+    0.013422f,  0.021083f,  0.058137f,  0.018121f,  -0.029604f, -0.005306f,
+    -0.037888f, -0.046137f, 0.004376f,  0.014058f,  0.015677f,  0.039982f,
+    0.060509f,  0.014995f,  0.101398f,  0.171763f,  0.285252f,  0.346476f,
+    0.294471f,  0.321468f,  0.313345f,  0.223543f,  -0.338193f, -0.395870f,
+    -0.435044f, -0.400594f, -0.250277f, -0.044595f, 0.086857f,  0.073043f,
+    -0.022398f, -0.075525f, -0.063437f, -0.051502f, -0.070621f, -0.058995f,
+    -0.014650f, 0.029855f,  0.054575f,  0.018253f,  -0.026791f, -0.040929f,
+    -0.035959f, -0.013641f, -0.028249f, -0.098415f, -0.128415f, -0.075489f,
+    -0.010693f, 0.020044f,  0.080892f,  0.157864f,  0.132734f,  0.056870f,
+    -0.018942f, -0.086130f, -0.034016f, 0.046534f,  0.072354f,  0.051615f,
+    0.014088f,  0.003927f,  0.040246f,  0.004919f,  -0.019260f, 0.042424f,
+    0.031792f,  0.069845f,  0.065367f,  0.097024f,  0.135961f,  0.122137f,
+    0.122362f,  0.146366f,  0.132445f,  0.157163f,  0.168772f,  0.123277f,
+    -0.103724f, -0.075126f, -0.044061f, -0.007967f, 0.028201f,  0.050258f,
+    0.029318f,  -0.011393f, -0.049177f, -0.059585f, -0.042532f, -0.044211f,
+    -0.059005f, -0.061643f, -0.068219f, -0.053059f, 0.012847f,  0.045132f,
+    -0.006970f, -0.088836f, -0.126703f, -0.086043f, -0.027790f, -0.010021f,
+    -0.008337f, 0.002641f,  0.018217f,  0.027377f,  0.011576f,  -0.019512f,
+    -0.036054f, -0.036355f, -0.017702f, -0.012757f, -0.013396f, 0.037369f,
+    0.017772f,  0.004465f,  0.086443f,  0.039439f,  -0.083973f, -0.024325f,
+    0.135939f,  0.092278f,  -0.161566f, -0.123831f, 0.088379f,  0.203673f,
+    0.141092f,  -0.030140f, -0.225199f, -0.430772f, -0.385767f, -0.163127f,
+    -0.068821f, -0.188031f, -0.042848f, 0.012427f,  0.056404f,  0.087866f,
+    0.102148f,  0.057957f,  -0.006347f, -0.022424f, 0.015973f,  0.018783f,
+    0.000505f,  -0.006244f, -0.010858f, 0.008727f,  0.041114f,  0.035634f,
+    0.020080f,  0.024252f,  0.035118f,  0.026728f,  0.005054f,  0.015220f,
+    0.055105f,  0.054531f,  0.010724f,  -0.017823f, -0.007074f, 0.047613f,
+    0.120763f,  0.137757f,  0.077054f,  -0.018115f, -0.118380f, -0.209764f,
+    -0.275307f, -0.288987f, -0.253733f, -0.194810f, -0.153326f, -0.090802f,
+    -0.032015f, -0.015672f, 0.037221f,  0.042239f,  -0.006445f, -0.014105f,
+    0.007739f,  0.012606f,  -0.020090f, -0.035464f, -0.049735f, -0.056497f,
+    -0.132743f, -0.144889f, -0.098515f, -0.087710f, 0.099556f,  0.099101f,
+    0.083665f,  0.047734f,  -0.007329f, -0.066042f, -0.114104f, -0.153470f,
+    -0.195686f, -0.246629f, -0.297063f, -0.340833f, -0.371610f, -0.389973f,
+    -0.383805f, -0.341251f, -0.280704f, -0.218517f, -0.151437f, -0.087908f,
+    -0.036075f, 0.009263f,  0.053793f,  0.086590f,  0.091920f,  0.063838f,
+    0.014833f,  -0.031963f, -0.058319f, -0.068086f, -0.065059f, -0.063103f,
+    -0.074477f, -0.084267f, -0.069555f, -0.053079f, -0.049450f, -0.041420f,
+    -0.027448f, -0.018554f, -0.004974f, 0.011300f,  0.009368f,  0.030300f,
+    0.064651f,  0.129854f,  0.201429f,  0.134946f,  0.011968f,  -0.059825f,
+    -0.056045f, -0.061654f, -0.061979f, -0.087875f, -0.227875f, -0.423769f,
+    -0.005296f, 0.086646f,  0.172493f,  0.210958f,  0.195332f,  0.133135f,
+    0.085628f,  0.054260f,  0.044391f,  0.026607f,  0.033046f,  0.050840f,
+    0.011707f,  -0.087648f, -0.147566f, -0.122969f, -0.066198f, -0.009718f,
+    0.000611f,  -0.064510f, -0.126228f, -0.145101f, -0.132261f, -0.089210f,
+    -0.041981f, -0.029398f, -0.064701f, -0.126436f, -0.173732f, -0.177720f,
+    -0.125917f, -0.065817f, -0.021650f, 0.013739f,  0.017656f,  0.013404f,
+    0.012610f,  0.038248f,  0.037472f,  -0.040101f, -0.037897f, -0.029601f,
+    -0.090299f, -0.063392f, -0.021455f, -0.038419f, -0.030986f, -0.011782f,
+    -0.020368f, 0.004705f,  0.011631f,  0.033265f,  0.062670f,  0.072642f,
+    0.097819f,  0.116818f,  0.078076f,  -0.011341f, -0.119810f, -0.197623f,
+    -0.199782f, -0.142230f, -0.074469f, -0.011246f, 0.039208f,  0.074290f,
+    0.076344f,  0.054130f,  0.072506f,  0.120092f,  0.093861f,  -0.000740f,
+    -0.085873f, -0.134695f, -0.166629f, -0.199090f, -0.195644f, -0.081686f,
+    0.084758f,  0.171601f,  0.164879f,  0.129404f,  0.116944f,  0.143583f,
+    0.190201f,  0.206007f,  0.160762f,  0.046015f,  -0.101165f, -0.235369f,
+    -0.320227f, -0.292005f, -0.196789f, -0.114773f, -0.073130f, -0.046317f,
+    0.034698f,  0.111464f,  0.062710f,  -0.019368f, -0.039109f, -0.072909f,
+    -0.115280f, -0.111585f, -0.012967f, 0.050451f,  0.018993f,  0.035674f,
+    0.019276f,  0.000660f,  0.123874f,  0.249580f,  0.143236f,  0.133281f,
+    0.115695f,  0.089458f,  0.075356f,  0.061705f,  0.048386f,  0.046860f,
+    0.067625f,  0.066449f,  0.011689f,  -0.067094f, -0.115933f, -0.118262f,
+    -0.096399f, -0.082538f, -0.093639f, -0.093325f, -0.021934f, 0.111937f,
+    0.215510f,  0.212663f,  0.120149f,  -0.000478f, -0.106871f, -0.178185f,
+    -0.208441f, -0.192503f, -0.137647f, -0.058454f, -0.002508f, 0.000158f,
+    0.026136f,  0.072828f,  0.113547f,  0.189776f,  0.222439f,  0.185096f,
+    0.174863f,  0.182761f,  0.111392f,  0.075413f,  0.111197f,  0.121003f,
+    0.099496f,  0.028775f,  -0.011857f, -0.014274f, -0.034000f, -0.017221f,
+    -0.032127f, -0.086668f, -0.120287f, -0.062604f, -0.078004f, -0.120421f,
+    -0.043171f, -0.057921f, -0.067011f, -0.068080f, -0.043678f, 0.043451f,
+    0.128632f,  0.136248f,  0.054943f,  -0.006401f, -0.010049f, -0.038839f,
+    -0.092350f, -0.101310f, -0.052303f, 0.017782f,  0.029458f,  -0.014109f,
+    -0.038766f, -0.023610f, 0.011725f,  0.018602f,  -0.007468f, 0.020421f,
+    0.137593f,  0.277028f,  0.333241f,  0.288101f,  0.166742f,  -0.007824f,
+    -0.183398f, -0.269467f, -0.265986f, -0.207320f, -0.158109f, -0.130249f,
+    -0.044332f, 0.074847f,  0.158036f,  0.164217f,  0.126507f,  0.074184f,
+    0.042443f,  0.023411f,  0.044467f,  0.036690f,  0.024758f,  -0.005680f,
+    -0.047610f, -0.061379f, -0.064219f, -0.059574f, -0.080759f, -0.066597f,
+    -0.062296f, -0.150779f, 0.086391f,  0.125726f,  0.121810f,  0.070705f,
+    -0.010826f, -0.072017f, -0.069932f, -0.049725f, -0.045901f, -0.056470f,
+    -0.091059f, -0.139464f, -0.154933f, -0.142925f, -0.144990f, -0.169174f,
+    -0.187337f, -0.143217f, -0.024012f, 0.117831f,  0.210104f,  0.239898f,
+    0.240849f,  0.246761f,  0.240276f,  0.160337f,  0.004616f,  -0.132694f,
+    -0.185095f, -0.168322f, -0.159314f, -0.167103f, -0.157793f, -0.103965f,
+    -0.056149f, -0.012427f, 0.029875f,  0.071693f,  0.116656f,  0.091586f,
+    0.054798f,  -0.038068f, -0.109620f, -0.094873f, -0.070614f, -0.086961f,
+    -0.083302f, -0.056956f, 0.015711f,  0.071707f,  0.043835f,  0.014364f,
+    0.058510f,  0.160531f,  0.115152f,  -0.116038f, -0.415439f, -0.322135f,
+    -0.204911f, -0.102861f, -0.047566f, -0.079318f, -0.133565f, -0.140862f,
+    -0.074774f, 0.002805f,  0.026761f,  0.013816f,  -0.000256f, -0.007791f,
+    0.010258f,  0.063851f,  0.172685f,  0.277913f,  0.296745f,  0.273580f,
+    0.286674f,  0.322522f,  0.296164f,  0.161034f,  -0.030427f, -0.180589f,
+    -0.246441f, -0.242858f, -0.194659f, -0.151250f, -0.138837f, -0.128053f,
+    -0.104414f, -0.068809f, 0.005946f,  0.077266f,  0.087967f,  0.068457f,
+    0.016621f,  -0.083379f, -0.118370f, -0.054086f, -0.039013f, -0.115028f,
+    -0.170267f, -0.092965f, -0.032589f, 0.007667f,  0.028027f,  0.039051f,
+    0.061132f,  0.155479f,  0.211511f,  0.134103f,  0.071917f,  0.041400f,
+    0.209070f,  0.046045f,  -0.150606f, -0.273018f, -0.289052f, -0.201423f,
+    -0.072676f, -0.001686f, 0.007223f,  0.028943f,  0.080383f,  0.084694f,
+    0.036418f,  0.022811f,  0.074125f,  0.179510f,  0.312441f,  0.381784f,
+    0.332375f,  0.164517f,  -0.079538f, -0.256772f, -0.290174f, -0.213303f,
+    -0.071736f, 0.031306f,  0.026285f,  -0.045611f, -0.094625f, -0.080670f,
+    -0.033100f, -0.008004f, 0.028699f,  0.045736f,  -0.010579f, -0.047845f,
+    -0.052370f, -0.064197f, -0.067651f, -0.002279f, 0.024779f,  -0.005224f,
+    -0.034489f, -0.018739f, -0.023487f, -0.063813f, -0.059011f, -0.025448f,
+    -0.024501f, 0.007656f,  0.066489f,  0.022520f,  -0.024975f, 0.043308f,
+    0.017481f,  -0.127336f, -0.173429f, -0.060545f, 0.065356f,  0.140384f,
+    0.140527f,  0.103582f,  0.085577f,  0.107411f,  0.136190f,  0.125189f,
+    0.090316f,  0.073384f,  0.080824f,  0.105252f,  0.139067f,  0.131079f,
+    0.050398f,  -0.038966f, -0.071435f, -0.069681f, -0.063673f, -0.046288f,
+    -0.016577f, 0.029450f,  0.092726f,  0.155927f,  0.173888f,  0.112169f,
+    0.008872f,  -0.059177f, -0.067483f, -0.001260f, 0.082978f,  0.136854f,
+    0.144913f,  0.097600f,  0.064352f,  0.092667f,  0.131982f,  0.167587f,
+    0.172285f,  0.135213f,  0.108064f,  0.098128f,  0.048649f,  -0.015619f,
+    -0.002767f, 0.006504f,  -0.024872f, -0.004915f, 0.055755f,  0.078076f,
+    0.152002f,  0.136801f,  0.153669f,  0.289467f,  -0.262531f, -0.150195f,
+    0.015587f,  0.162097f,  0.225226f,  0.210418f,  0.166206f,  0.141352f,
+    0.130833f,  0.100430f,  0.066997f,  0.034083f,  0.021964f,  0.031413f,
+    0.031046f,  0.033015f,  0.078643f,  0.098457f,  0.103619f,  0.079668f,
+    0.022373f,  0.015038f,  0.051619f,  0.033252f,  -0.000266f, 0.000646f,
+    0.008171f,  -0.012457f, -0.035484f, -0.061563f, -0.030993f, -0.000734f,
+    0.028276f,  0.034905f,  0.045729f,  0.041239f,  0.044774f,  0.058019f,
+    0.044390f,  -0.035964f, -0.055404f, -0.014056f, -0.014974f, 0.013045f,
+    0.003879f,  0.024393f,  0.018310f,  0.016459f,  0.014390f,  -0.004822f,
+    0.031276f,  0.042688f,  -0.021181f, 0.006392f,  0.028097f,  -0.048045f,
+    -0.369022f, -0.297318f, -0.170255f, -0.008040f, 0.142455f,  0.200635f,
+    0.153623f,  0.071141f,  0.021608f,  0.021432f,  0.058466f,  0.094020f,
+    0.081810f,  0.004205f,  -0.044969f, 0.021274f,  0.147393f,  0.199230f,
+    0.144790f,  0.055803f,  -0.016509f, -0.104650f, -0.249185f, -0.427404f,
+    -0.550740f, -0.542786f, -0.404024f, -0.217128f, -0.067176f, 0.018491f,
+    0.049208f,  0.028829f,  -0.016780f, -0.027894f, -0.006425f, -0.015821f,
+    -0.058725f, -0.051685f, 0.001016f,  -0.019054f, 0.025073f,  0.042078f,
+    0.009697f,  0.015291f,  0.022474f,  -0.037983f, -0.022939f, 0.015345f,
+    0.019667f,  0.092746f,  0.085020f,  0.071678f,  0.069444f,  0.032884f,
+    -0.013173f, 0.008097f,  -0.017437f, -0.035532f, -0.073080f, -0.126748f,
+    -0.169028f, -0.177396f, -0.129224f, -0.034138f, 0.012473f,  0.016831f,
+    0.033403f,  0.040520f,  0.021192f,  0.029658f,  0.065576f,  0.103235f,
+    0.128943f,  0.152293f,  0.182124f,  0.233026f,  0.269136f,  0.238708f,
+    0.130214f,  -0.032857f, -0.183464f, -0.226676f, -0.157892f, -0.045068f,
+    0.038576f,  0.024347f,  -0.023435f, -0.089131f, -0.140322f, -0.103302f,
+    -0.041358f, -0.023442f, 0.031392f,  0.124828f,  0.123870f,  0.092697f,
+    0.058328f,  0.061621f,  -0.017329f, -0.015669f, 0.010055f,  -0.008398f,
+    0.033743f,  0.054048f,  -0.026334f, -0.038168f, -0.003708f, -0.016105f,
+    -0.025101f, -0.016347f, -0.001800f, -0.026873f, -0.172145f, -0.142894f,
+    -0.114070f, -0.068551f, 0.013496f,  0.112190f,  0.155112f,  0.090393f,
+    0.025219f,  0.050440f,  0.094941f,  0.060726f,  -0.020234f, -0.060417f,
+    -0.045100f, 0.053376f,  0.182089f,  0.204734f,  0.141337f,  0.048760f,
+    -0.035425f, 0.023048f,  0.149609f,  0.161827f,  0.142039f,  0.161181f,
+    0.150045f,  0.051770f,  -0.114903f, -0.277434f, -0.380682f, -0.358296f,
+    -0.254948f, -0.116108f, 0.043435f,  0.130222f,  0.144623f,  0.116530f,
+    0.055166f,  -0.019028f, 0.008181f,  0.003311f,  -0.019019f, 0.003756f,
+    0.006543f,  -0.030663f, -0.028551f, -0.008981f, 0.046153f,  0.031104f,
+    0.033571f,  0.016362f,  0.025322f,  0.006293f,  -0.004523f, -0.011783f,
+    0.011124f,  -0.023247f, -0.060970f, -0.083925f, -0.065737f, -0.037536f,
+    -0.021271f, 0.022020f,  0.067953f,  0.053415f,  -0.005250f, -0.051122f,
+    -0.070154f, -0.066070f, -0.034434f, -0.001511f, 0.001946f,  -0.005071f,
+    -0.000454f, 0.013713f,  0.027101f,  0.076829f,  0.216148f,  0.369309f,
+    0.399024f,  0.301118f,  0.159895f,  -0.000559f, -0.206036f, -0.360364f,
+    -0.373343f, -0.308896f, -0.225782f, -0.122561f, 0.003739f,  0.073988f,
+    0.040786f,  -0.001053f, -0.003341f, -0.004478f, -0.001813f, 0.030336f,
+    0.019261f,  0.002101f,  -0.001217f, 0.029323f,  -0.030772f, -0.042477f,
+    0.000521f,  0.071609f,  0.091449f,  0.081470f,  0.069323f,  0.049349f,
+    -0.040029f, -0.097155f, -0.039331f, -0.023265f, -0.012161f, 0.004144f,
+    0.022610f,  0.041948f,  0.038400f,  0.016971f,  -0.009844f, 0.006767f,
+    0.071882f,  0.125639f,  0.108810f,  0.044484f,  -0.020954f, -0.059188f,
+    -0.062933f, -0.031355f, 0.055356f,  0.168665f,  0.224598f,  0.167490f,
+    0.024212f,  -0.085235f, -0.043788f, 0.119617f,  0.274689f,  0.335087f,
+    0.320145f,  0.273782f,  0.230047f,  0.193796f,  0.106834f,  -0.011898f,
+    -0.102163f, -0.152534f, -0.144249f, -0.052771f, 0.053705f,  0.086693f,
+    0.117722f,  0.084080f,  0.028267f,  -0.022192f, -0.025286f, -0.035749f,
+    -0.078503f, -0.085884f, -0.103795f, -0.125166f, -0.073881f, -0.017298f,
+    -0.050430f, -0.075842f, 0.028163f,  0.153366f,  -0.176804f, -0.102723f,
+    -0.049507f, -0.012631f, 0.012978f,  0.028221f,  0.032163f,  -0.003526f,
+    -0.046940f, -0.030987f, 0.028717f,  0.076821f,  0.065886f,  0.002076f,
+    -0.080551f, -0.130307f, -0.127716f, -0.112133f, -0.095609f, -0.070503f,
+    -0.069703f, -0.088815f, -0.137936f, -0.213581f, -0.224311f, -0.127039f,
+    0.089160f,  0.377778f,  0.570281f,  0.541696f,  0.379360f,  0.197713f,
+    0.039068f,  -0.051263f, -0.045236f, -0.026159f, -0.025162f, -0.014146f,
+    0.013312f,  0.009123f,  0.030504f,  0.057579f,  0.079526f,  0.078005f,
+    0.047776f,  0.012696f,  -0.037698f, -0.018681f, -0.034133f, -0.070383f,
+    -0.086864f, -0.063299f, -0.049151f, -0.044950f, -0.002636f, 0.043438f,
+    -0.018415f, -0.025238f, -0.043297f, -0.077434f, -0.122067f, -0.157219f,
+    -0.150622f, -0.100304f, -0.047601f, -0.030448f, -0.045001f, -0.034411f,
+    0.033213f,  0.119655f,  0.133441f,  0.026189f,  -0.100073f, -0.124065f,
+    -0.052557f, 0.038609f,  0.118857f,  0.199981f,  0.245754f,  0.209291f,
+    0.129487f,  0.067926f,  0.021984f,  -0.044066f, -0.115575f, -0.121522f,
+    -0.043999f, 0.049803f,  0.099565f,  0.091375f,  0.041482f,  -0.004798f,
+    -0.025555f, -0.024865f, 0.011281f,  0.069196f,  0.074467f,  0.096362f,
+    0.109622f,  0.086057f,  0.075882f,  0.096641f,  0.044851f,  -0.043066f,
+    0.004605f,  0.040839f,  0.016798f,  0.049196f,  0.062026f,  -0.040002f,
+    0.001900f,  0.101245f,  -0.008831f, -0.038342f, -0.075338f, -0.078069f,
+    -0.045648f, -0.020240f, 0.000008f,  -0.002927f, -0.056095f, -0.083461f,
+    -0.065273f, -0.037711f, -0.022892f, -0.033140f, -0.076385f, -0.109183f,
+    -0.104948f, -0.066072f, 0.003916f,  0.051830f,  0.026471f,  -0.032632f,
+    -0.052972f, -0.027268f, -0.013399f, -0.025483f, -0.042122f, -0.073463f,
+    -0.102139f, -0.097832f, -0.081891f, -0.088701f, -0.031574f, 0.056713f,
+    0.103905f,  0.111114f,  0.159055f,  0.215707f,  0.162638f,  0.063832f,
+    -0.001264f, -0.056711f, -0.153115f, -0.215296f, -0.246839f, -0.262911f,
+    -0.241545f, -0.170144f, -0.106186f, -0.119698f, -0.113303f, -0.061795f,
+    -0.036659f, 0.012777f,  0.077222f,  0.221443f,  0.240287f,  0.156357f,
+    0.079524f,  0.023153f,  -0.007390f, 0.004978f,  0.025946f,  0.007570f,
+    -0.037209f, -0.076959f, -0.095224f, -0.069020f, -0.005844f, 0.013616f,
+    -0.026784f, -0.073678f, -0.107389f, -0.129616f, -0.141998f, -0.121112f,
+    -0.065143f, -0.042046f, -0.098192f, -0.204965f, -0.265867f, -0.162104f,
+    0.083632f,  0.329133f,  0.485299f,  0.524080f,  0.429160f,  0.238691f,
+    0.115687f,  0.019147f,  -0.077742f, -0.095265f, -0.126177f, -0.138914f,
+    -0.036142f, 0.014266f,  0.021276f,  0.064924f,  0.006049f,  -0.016760f,
+    -0.016833f, -0.069756f, -0.039989f, -0.047905f, -0.042002f, -0.022009f,
+    0.016722f,  0.020566f,  0.044527f,  0.049865f,  -0.003806f, 0.027550f,
+    0.220422f,  0.259397f,  0.264485f,  0.201127f,  0.074336f,  -0.038847f,
+    -0.073823f, -0.087248f, -0.129833f, -0.154808f, -0.144386f, -0.124838f,
+    -0.103040f, -0.094793f, -0.097925f, -0.076217f, -0.026539f, -0.007008f,
+    -0.042663f, -0.096904f, -0.126461f, -0.111586f, -0.077247f, -0.056062f,
+    -0.061362f, -0.061944f, -0.011661f, 0.094733f,  0.234022f,  0.329251f,
+    0.318425f,  0.195685f,  0.029212f,  -0.101894f, -0.194216f, -0.251651f,
+    -0.248858f, -0.219281f, -0.199053f, -0.135810f, -0.010232f, 0.076077f,
+    0.059239f,  0.067686f,  0.059300f,  0.023980f,  0.000135f,  -0.028683f,
+    -0.036694f, 0.031594f,  0.106112f,  0.131485f,  0.122842f,  0.113015f,
+    0.142419f,  0.071260f,  -0.145863f, -0.084536f, -0.002844f, 0.086342f,
+    0.124777f,  0.110971f,  0.075407f,  0.021975f,  -0.056804f, -0.121722f,
+    -0.135826f, -0.090833f, -0.005968f, 0.067421f,  0.080105f,  0.042596f,
+    -0.014597f, -0.036534f, -0.003039f, 0.053414f,  0.066918f,  0.003655f,
+    -0.064440f, -0.036231f, 0.096357f,  0.250323f,  0.337229f,  0.342962f,
+    0.307276f,  0.275063f,  0.247094f,  0.196055f,  0.107054f,  -0.006869f,
+    -0.130993f, -0.262967f, -0.397388f, -0.520513f, -0.626629f, -0.714199f,
+    -0.777360f, -0.814462f, -0.812352f, -0.772752f, -0.702314f, -0.602782f,
+    -0.481190f, -0.349860f, -0.225140f, -0.132674f, -0.084884f, -0.029566f,
+    0.045932f,  0.037449f,  0.069617f,  0.149841f,  -0.163771f, -0.110595f,
+    -0.049393f, -0.023450f, -0.006956f, 0.023050f,  0.057391f,  0.066939f,
+    0.037841f,  -0.019753f, -0.026195f, 0.021906f,  0.015346f,  -0.022538f,
+    -0.018009f, -0.017770f, -0.055936f, -0.073013f, -0.024369f, 0.011969f,
+    0.013368f,  0.001585f,  -0.030645f, -0.052598f, -0.034875f, -0.019285f,
+    -0.045709f, -0.091648f, -0.109798f, -0.081227f, -0.061873f, -0.065550f,
+    -0.052323f, -0.049896f, -0.082488f, -0.103753f, -0.115096f, -0.133975f,
+    -0.190024f, -0.190210f, -0.171631f, -0.215058f, -0.207435f, -0.183438f,
+    -0.210111f, -0.198832f, -0.222379f, -0.211926f, -0.168605f, -0.139747f,
+    -0.175183f, -0.120641f, -0.104227f, -0.158039f, -0.061586f, 0.047766f,
+    0.071172f,  0.022795f,  0.018954f,  0.043154f,  0.079869f,  0.099973f,
+    0.088139f,  0.091296f,  0.133201f,  0.130761f,  0.061642f,  -0.021269f,
+    -0.054945f, -0.044677f, -0.023884f, -0.002653f, 0.028781f,  0.086235f,
+    0.141052f,  0.157905f,  0.144884f,  0.103081f,  0.052379f,  0.017095f,
+    -0.018557f, -0.069044f, -0.100504f, -0.053408f, 0.017578f,  0.034929f,
+    0.016268f,  -0.043961f, -0.081208f, -0.056375f, -0.005054f, 0.016904f,
+    -0.003860f, -0.009875f, -0.003503f, 0.011127f,  0.024692f,  0.024842f,
+    0.013135f,  0.021283f,  0.045666f,  0.074389f,  0.028939f,  0.025607f,
+    0.043598f,  0.057717f,  0.073612f,  0.049662f,  -0.043228f, -0.002231f,
+    0.009471f,  -0.106510f, -0.015706f, -0.044789f, -0.049387f, -0.034863f,
+    -0.035280f, -0.031626f, -0.050482f, -0.085232f, -0.088870f, -0.043090f,
+    0.013215f,  0.026352f,  0.003441f,  -0.030329f, -0.040036f, -0.009969f,
+    0.021286f,  0.041844f,  0.077955f,  0.123130f,  0.165976f,  0.170521f,
+    0.166534f,  0.193132f,  0.255271f,  0.331639f,  0.341519f,  0.231807f,
+    0.042531f,  -0.199883f, -0.386531f, -0.474207f, -0.434805f, -0.330098f,
+    -0.190310f, -0.093180f, -0.055656f, -0.007232f, 0.047419f,  0.077783f,
+    0.041916f,  0.069832f,  0.061811f,  0.036254f,  0.022707f,  0.027756f,
+    -0.005060f, 0.000211f,  0.038036f,  -0.014328f, -0.002005f, -0.004460f,
+    -0.030404f, 0.024267f,  0.024306f,  -0.046318f, -0.077801f, -0.043166f,
+    0.008386f,  0.062375f,  0.102465f,  0.105175f,  0.093960f,  0.083869f,
+    0.077164f,  0.059742f,  0.053796f,  0.063728f,  0.071558f,  0.086225f,
+    0.121172f,  0.167667f,  0.209796f,  0.205754f,  0.170776f,  0.137665f,
+    0.112458f,  0.107302f,  0.129292f,  0.145636f,  0.122837f,  0.071920f,
+    0.043467f,  0.064286f,  0.107277f,  0.129135f,  0.143848f,  0.178872f,
+    0.212362f,  0.214237f,  0.171447f,  0.067565f,  -0.062589f, -0.163933f,
+    -0.178865f, -0.119731f, -0.051697f, -0.018211f, 0.001280f,  0.006871f,
+    -0.050257f, -0.172591f, -0.282208f, -0.310578f, -0.319314f, -0.361442f,
+    -0.416709f, -0.486437f, -0.522046f, -0.393795f, -0.239744f, -0.224134f,
+    0.323588f,  0.316688f,  0.271188f,  0.164585f,  0.023299f,  -0.083886f,
+    -0.092943f, -0.055853f, -0.061800f, -0.157380f, -0.279137f, -0.301896f,
+    -0.174390f, 0.037797f,  0.223745f,  0.254175f,  0.107955f,  -0.067322f,
+    -0.107198f, 0.008383f,  0.171153f,  0.245696f,  0.178642f,  0.026820f,
+    -0.113783f, -0.152216f, -0.076080f, 0.019928f,  0.048205f,  0.010545f,
+    -0.058904f, -0.103748f, -0.114851f, -0.107745f, -0.077653f, -0.042317f,
+    -0.039522f, -0.029995f, -0.000977f, 0.024496f,  0.020194f,  -0.010857f,
+    0.003640f,  0.027686f,  -0.062058f, -0.107847f, -0.068967f, -0.089880f,
+    -0.083426f, -0.037334f, 0.005264f,  0.018142f,  0.018509f,  0.069027f,
+    -0.008824f, -0.175355f, -0.197536f, -0.190407f, -0.129142f, -0.021770f,
+    0.093975f,  0.160336f,  0.152456f,  0.115029f,  0.096971f,  0.045217f,
+    -0.018954f, -0.021049f, 0.036076f,  0.092123f,  0.113922f,  0.102051f,
+    0.062927f,  -0.019334f, -0.124334f, -0.171661f, -0.119862f, -0.013326f,
+    0.061574f,  0.069200f,  0.047321f,  0.036302f,  0.035608f,  0.021322f,
+    0.030667f,  0.059993f,  0.049831f,  0.002308f,  -0.040239f, -0.022596f,
+    -0.002159f, -0.026760f, -0.011801f, 0.067754f,  0.091597f,  0.058368f,
+    0.077951f,  0.107663f,  0.098268f,  0.081136f,  0.102165f,  0.104755f,
+    0.061889f,  0.015125f,  -0.022199f, -0.039596f, -0.025968f, 0.031818f,
+    0.068002f,  0.113717f,  0.184077f,  0.335697f,  -0.031565f, -0.080565f,
+    -0.146089f, -0.195781f, -0.221897f, -0.234410f, -0.213235f, -0.172521f,
+    -0.138663f, -0.124460f, -0.121721f, -0.120574f, -0.102085f, -0.077601f,
+    -0.065754f, -0.087901f, -0.114657f, -0.112640f, -0.082424f, -0.030869f,
+    0.013543f,  0.024557f,  0.026358f,  0.042828f,  0.060195f,  0.071920f,
+    0.079914f,  0.063748f,  0.011390f,  0.021667f,  0.090672f,  0.109084f,
+    0.063553f,  0.003254f,  -0.037328f, -0.045157f, -0.046808f, -0.051932f,
+    -0.029565f, -0.011189f, -0.010709f, -0.033682f, 0.018468f,  0.054759f,
+    0.017002f,  0.041832f,  0.030214f,  0.014835f,  -0.008180f, 0.001444f,
+    -0.013397f, 0.034927f,  0.035125f,  0.037525f,  -0.018016f, -0.069034f,
+    -0.223086f, -0.136351f, -0.026113f, 0.063288f,  0.124273f,  0.159311f,
+    0.150182f,  0.095128f,  0.044212f,  0.020385f,  0.023710f,  0.049782f,
+    0.063197f,  0.050919f,  0.029183f,  0.011281f,  0.004408f,  -0.001134f,
+    0.007136f,  0.039234f,  0.077356f,  0.096471f,  0.074375f,  0.011316f,
+    -0.065079f, -0.128751f, -0.162606f, -0.168460f, -0.164723f, -0.164039f,
+    -0.111331f, 0.007888f,  0.145528f,  0.273979f,  0.327965f,  0.271938f,
+    0.154416f,  0.025699f,  -0.082313f, -0.079051f, -0.051299f, -0.059969f,
+    -0.069909f, -0.164118f, -0.302443f, -0.393213f, -0.469627f, -0.475667f,
+    -0.339419f, -0.158334f, 0.053028f,  0.269432f,  0.384328f,  0.404164f,
+    0.512244f,  0.638022f,  0.163892f,  0.152714f,  0.096972f,  0.045904f,
+    -0.042128f, -0.126779f, -0.092044f, -0.055357f, -0.037398f, -0.027441f,
+    -0.031614f, -0.063511f, -0.075072f, -0.023029f, -0.052283f, -0.119517f,
+    -0.081044f, -0.027489f, -0.042562f, -0.043523f, -0.000995f, 0.030836f,
+    0.030403f,  -0.000447f, 0.003855f,  0.019554f,  -0.016900f, -0.086737f,
+    -0.066427f, -0.008550f, -0.044183f, -0.034843f, -0.050081f, -0.049455f,
+    -0.004691f, 0.009335f,  0.005009f,  0.023809f,  0.013627f,  0.040633f,
+    0.024586f,  0.001354f,  -0.025530f, -0.032323f, 0.005400f,  -0.053574f,
+    -0.037769f, -0.057268f, -0.021254f, 0.009406f,  0.073591f,  0.058341f,
+    0.067864f,  -0.007162f, 0.015270f,  0.020781f,  -0.170149f, -0.123674f,
+    -0.075229f, -0.052731f, -0.078533f, -0.120379f, -0.152160f, -0.168135f,
+    -0.155591f, -0.115515f, -0.059391f, -0.011687f, 0.010264f,  0.030628f,
+    0.067539f,  0.067154f,  -0.005861f, -0.093440f, -0.125733f, -0.107760f,
+    -0.094107f, -0.105714f, -0.139318f, -0.174697f, -0.187858f, -0.181929f,
+    -0.154242f, -0.093692f, -0.009743f, 0.070935f,  0.122484f,  0.166146f,
+    0.196236f,  0.191573f,  0.169801f,  0.137402f,  0.095128f,  0.015857f,
+    -0.029999f, 0.011140f,  0.042844f,  0.073342f,  0.071715f,  0.083059f,
+    0.079202f,  0.025629f,  0.034356f,  0.040351f,  0.013968f,  0.019428f,
+    0.055568f,  0.044626f,  0.014864f,  0.018699f,  0.053075f,  0.108079f,
+    0.127699f,  0.053685f,  -0.022602f, -0.048197f, -0.022759f, 0.030561f,
+    0.072163f,  0.050470f,  -0.004853f, -0.007583f, 0.055423f,  0.074266f,
+    -0.012973f, -0.108982f, -0.117038f, -0.056381f, 0.023702f,  0.095030f,
+    0.077948f,  -0.082834f, -0.269886f, -0.291434f, -0.126045f, 0.140230f,
+    0.416643f,  0.519832f,  0.358469f,  0.072615f,  -0.190538f, -0.334563f,
+    -0.328499f, -0.226697f, -0.113698f, -0.010408f, 0.046739f,  0.026480f,
+    -0.034646f, -0.045790f, -0.062575f, -0.085747f, -0.068997f, -0.032973f,
+    -0.019459f, -0.003147f, 0.045676f,  0.034581f,  0.043798f,  0.030332f,
+    0.025843f,  -0.002627f, 0.012857f,  0.030602f,  -0.007543f, 0.032857f,
+    0.090702f,  -0.014424f, -0.245807f, -0.136637f, 0.016195f,  0.123456f,
+    0.145188f,  0.107337f,  0.083641f,  0.092708f,  0.088670f,  0.086359f,
+    0.096754f,  0.086029f,  0.055663f,  0.026656f,  0.024819f,  0.042710f,
+    0.076640f,  0.092978f,  0.054740f,  0.013894f,  0.031245f,  0.055547f,
+    0.050029f,  0.032102f,  0.014282f,  0.044467f,  0.115027f,  0.136459f,
+    0.103422f,  0.093971f,  0.098312f,  0.097528f,  0.042576f,  0.000618f,
+    0.016327f,  0.096457f,  0.092467f,  0.021508f,  0.022581f,  -0.027140f,
+    -0.035014f, -0.029670f, -0.024950f, 0.002184f,  -0.010373f, -0.051250f,
+    -0.091261f, -0.100900f, -0.143517f, -0.183883f, -0.197520f, -0.304655f,
+    -0.374067f, -0.312202f, -0.231348f, -0.353992f, 0.214950f,  0.169820f,
+    0.107848f,  0.044432f,  0.011885f,  0.012307f,  0.004695f,  -0.023204f,
+    -0.060686f, -0.082159f, -0.051975f, 0.001755f,  0.017472f,  -0.011423f,
+    -0.038783f, -0.032326f, -0.003042f, 0.019442f,  0.002388f,  -0.065924f,
+    -0.153181f, -0.199789f, -0.175960f, -0.096706f, -0.010834f, 0.042054f,
+    0.065449f,  0.077172f,  0.094606f,  0.119245f,  0.146830f,  0.151780f,
+    0.120609f,  0.087733f,  0.100673f,  0.162361f,  0.194003f,  0.147798f,
+    0.090869f,  0.052301f,  -0.001483f, -0.013194f, -0.004894f, -0.110512f,
+    -0.223781f, -0.241407f, -0.201634f, -0.155152f, -0.123431f, -0.084904f,
+    -0.062344f, -0.000359f, 0.123762f,  0.119106f,  0.035142f,  0.046749f,
+    0.139601f,  0.156364f,  0.141221f,  0.085617f,  0.029033f,  -0.004196f,
+    0.000975f,  0.010097f,  -0.001504f, 0.014680f,  0.064231f,  0.081059f,
+    0.048154f,  0.015944f,  0.006727f,  0.009797f,  0.010258f,  -0.003236f,
+    -0.032159f, -0.039436f, -0.009549f, 0.033350f,  0.050629f,  0.031616f,
+    0.006444f,  -0.001043f, 0.012065f,  0.026315f,  0.021017f,  0.019014f,
+    0.035959f,  0.038187f,  0.009256f,  -0.025494f, -0.042800f, -0.079308f,
+    -0.159296f, -0.271946f, -0.336347f, -0.276044f, -0.161360f, -0.041906f,
+    0.045121f,  0.053573f,  0.034522f,  0.095553f,  0.142502f,  0.071616f,
+    0.035114f,  0.015653f,  -0.043129f, -0.049988f, -0.027824f, -0.085686f,
+    -0.143021f, -0.127863f, -0.174144f, -0.119183f, -0.044268f, 0.023386f,
+    0.066636f,  0.052634f,  -0.018196f, -0.087872f, -0.082626f, 0.003999f,
+    0.096982f,  0.137386f,  0.102742f,  0.017752f,  -0.055360f, -0.073913f,
+    -0.076694f, -0.075251f, -0.043743f, -0.001060f, 0.028777f,  0.053770f,
+    0.080810f,  0.086898f,  0.027630f,  -0.075046f, -0.150406f, -0.155919f,
+    -0.111516f, -0.064071f, -0.026777f, -0.044460f, -0.071647f, -0.041682f,
+    0.001090f,  0.055625f,  0.091871f,  0.087731f,  0.100366f,  0.124903f,
+    0.095692f,  0.095260f,  0.136348f,  0.159016f,  0.172187f,  0.128222f,
+    0.091698f,  0.074864f,  0.050428f,  0.077646f,  0.125710f,  0.065165f,
+    -0.014679f, 0.005830f,  0.006624f,  -0.090340f, -0.006012f, -0.006008f,
+    -0.006012f, -0.006008f, -0.006012f, -0.006008f, -0.006011f, -0.006009f,
+    -0.006010f, -0.006010f, -0.006009f, -0.006010f, -0.006009f, -0.006011f,
+    -0.006009f, -0.006011f, -0.006009f, -0.006010f, -0.006010f, -0.006010f,
+    -0.006010f, -0.006009f, -0.006010f, -0.006009f, -0.006010f, -0.006010f,
+    -0.006010f, -0.006010f, -0.006011f, -0.006008f, -0.006013f, -0.006004f,
+    -0.006018f, -0.005998f, -0.006025f, -0.005993f, -0.006027f, -0.005995f,
+    -0.006022f, -0.006001f, -0.006016f, -0.006005f, -0.006013f, -0.006006f,
+    -0.006014f, -0.006005f, -0.006015f, -0.006004f, -0.006014f, -0.006006f,
+    -0.006012f, -0.006010f, -0.006009f, -0.006012f, -0.006007f, -0.006012f,
+    -0.053345f, 0.041216f,  0.124741f,  0.166459f,  0.145996f,  0.093533f,
+    0.030522f,  -0.030001f, -0.062854f, -0.068613f, -0.040997f, 0.021586f,
+    0.064610f,  0.059794f,  0.017431f,  -0.040615f, -0.084628f, -0.102166f,
+    -0.090497f, -0.068485f, -0.065300f, -0.098840f, -0.162854f, -0.231747f,
+    -0.284775f, -0.321788f, -0.341744f, -0.336148f, -0.317026f, -0.296523f,
+    -0.269769f, -0.227757f, -0.169074f, -0.095238f, 0.004758f,  0.095248f,
+    0.130840f,  0.139572f,  0.107908f,  0.073878f,  0.017884f,  -0.003918f,
+    0.053818f,  0.060425f,  0.024205f,  0.025989f,  0.011670f,  -0.003766f,
+    -0.002800f, -0.072779f, -0.106675f, -0.036569f, 0.065318f,  0.047422f,
+    0.065100f,  0.233765f,  0.065530f,  0.023275f,  0.014777f,  0.007087f,
+    -0.026169f, -0.037136f, 0.012989f,  0.062589f,  0.023520f,  -0.014736f,
+    -0.000361f, 0.017247f,  0.053528f,  0.063199f,  -0.017663f, -0.099474f,
+    -0.103977f, 0.001837f,  0.115376f,  0.122439f,  0.007251f,  -0.217274f,
+    -0.454511f, -0.536174f, -0.401334f, -0.104292f, 0.202317f,  0.355751f,
+    0.313793f,  0.128613f,  -0.136143f, -0.351344f, -0.393655f, -0.266443f,
+    -0.053633f, 0.085394f,  0.118064f,  0.116461f,  0.060401f,  0.028559f,
+    0.024422f,  -0.020037f, -0.050469f, -0.030530f, -0.030953f, -0.041075f,
+    -0.013837f, -0.002120f, 0.023530f,  0.067090f,  0.046957f,  0.042276f,
+    0.081235f,  0.015304f,  0.012255f,  0.204472f,  -0.003365f, -0.003365f,
+    -0.003365f, -0.003365f, -0.003365f, -0.003365f, -0.003365f, -0.003365f,
+    -0.003364f, -0.003366f, -0.003363f, -0.003367f, -0.003362f, -0.003368f,
+    -0.003361f, -0.003370f, -0.003360f, -0.003370f, -0.003361f, -0.003368f,
+    -0.003364f, -0.003364f, -0.003367f, -0.003361f, -0.003369f, -0.003360f,
+    -0.003369f, -0.003361f, -0.003368f, -0.003364f, -0.003365f, -0.003366f,
+    -0.003363f, -0.003367f, -0.003363f, -0.003367f, -0.003364f, -0.003365f,
+    -0.003365f, -0.003364f, -0.003366f, -0.003364f, -0.003367f, -0.003363f,
+    -0.003367f, -0.003364f, -0.003366f, -0.003365f, -0.003364f, -0.003367f,
+    -0.003362f, -0.003369f, -0.003360f, -0.003371f, -0.003359f, -0.003371f,
+    -0.030328f, -0.027541f, -0.043187f, -0.068427f, -0.087044f, -0.086602f,
+    -0.051911f, -0.003442f, 0.048596f,  0.103690f,  0.141941f,  0.155771f,
+    0.160609f,  0.171691f,  0.176045f,  0.159904f,  0.138248f,  0.118183f,
+    0.088163f,  0.024124f,  -0.062463f, -0.118582f, -0.126680f, -0.116434f,
+    -0.114624f, -0.126728f, -0.144372f, -0.152044f, -0.144952f, -0.132773f,
+    -0.124328f, -0.114532f, -0.082334f, -0.020517f, 0.071680f,  0.180141f,
+    0.254442f,  0.241232f,  0.118175f,  0.011633f,  -0.002169f, -0.008691f,
+    0.007514f,  0.002053f,  -0.038643f, -0.018549f, 0.028467f,  0.056412f,
+    0.059971f,  0.029316f,  -0.004831f, 0.016313f,  0.009824f,  -0.016563f,
+    -0.033296f, 0.036480f,  -0.109141f, 0.000392f,  0.113854f,  0.201220f,
+    0.262867f,  0.289157f,  0.262395f,  0.203111f,  0.163434f,  0.144658f,
+    0.103696f,  0.043279f,  0.003304f,  0.027752f,  0.101480f,  0.137544f,
+    0.126757f,  0.115729f,  0.094831f,  0.051852f,  0.014990f,  -0.021774f,
+    -0.071919f, -0.126683f, -0.188728f, -0.262477f, -0.332571f, -0.383233f,
+    -0.409724f, -0.419583f, -0.397588f, -0.338437f, -0.267924f, -0.219679f,
+    -0.200900f, -0.183370f, -0.133616f, -0.040202f, 0.067455f,  0.121488f,
+    0.099660f,  0.013257f,  -0.063329f, -0.089865f, -0.090598f, -0.069223f,
+    -0.009425f, 0.014457f,  -0.017171f, -0.011766f, 0.017774f,  0.056450f,
+    0.056055f,  0.043028f,  0.054960f,  0.072155f,  -0.054864f, -0.124880f,
+    -0.182118f, -0.171216f, -0.073072f, 0.045142f,  0.091625f,  0.087442f,
+    0.080419f,  0.087344f,  0.099205f,  0.089754f,  0.056880f,  0.037364f,
+    0.036546f,  0.036856f,  0.040440f,  0.049550f,  0.047301f,  0.024489f,
+    0.018073f,  0.039402f,  0.034597f,  0.013841f,  0.029117f,  0.074575f,
+    0.098985f,  0.093609f,  0.095457f,  0.067820f,  -0.002533f, -0.016988f,
+    0.061306f,  0.173445f,  0.256845f,  0.260603f,  0.197088f,  0.080366f,
+    -0.045779f, -0.090737f, -0.127359f, -0.152427f, -0.185247f, -0.199966f,
+    -0.165221f, -0.119522f, -0.088696f, -0.042374f, 0.004650f,  0.011697f,
+    0.066639f,  0.130591f,  0.142706f,  0.174217f,  0.156756f,  0.072453f,
+    -0.246708f, -0.088548f, 0.091080f,  0.199542f,  0.164312f,  0.056089f,
+    -0.026928f, -0.059119f, -0.083114f, -0.063036f, -0.002955f, 0.031257f,
+    0.021458f,  -0.033261f, -0.084707f, -0.050084f, 0.042493f,  0.103022f,
+    0.092386f,  0.040380f,  0.020611f,  0.029173f,  0.037359f,  0.059302f,
+    0.083337f,  0.080644f,  0.054007f,  0.036213f,  0.022325f,  0.006460f,
+    -0.014480f, -0.021046f, 0.024683f,  0.090318f,  0.127010f,  0.121812f,
+    0.075259f,  0.016332f,  0.028233f,  0.048414f,  0.088539f,  0.118682f,
+    0.084277f,  0.058538f,  0.050908f,  -0.039057f, -0.036922f, -0.001705f,
+    -0.000612f, -0.008614f, 0.015168f,  0.052791f,  0.042637f,  0.045280f,
+    0.119655f,  0.126886f,  -0.199354f, -0.193964f, -0.197643f, -0.201906f,
+    -0.190728f, -0.167648f, -0.066951f, 0.140182f,  0.350218f,  0.317725f,
+    0.005812f,  -0.305589f, -0.331209f, -0.066522f, 0.248288f,  0.357566f,
+    0.186472f,  -0.120184f, -0.323029f, -0.277867f, -0.081577f, 0.078020f,
+    0.132933f,  0.106567f,  0.047426f,  -0.015154f, -0.063099f, -0.074451f,
+    -0.054498f, -0.027379f, -0.002638f, -0.041808f, -0.082112f, -0.018328f,
+    0.036434f,  0.083794f,  0.128417f,  0.123904f,  0.084817f,  0.038922f,
+    0.004563f,  0.015951f,  0.056305f,  0.021676f,  -0.017825f, -0.013416f,
+    0.001680f,  0.024249f,  -0.009467f, -0.022499f, 0.062758f,  0.044450f,
+    -0.060730f, -0.005942f, -0.013722f, -0.367530f, -0.138086f, -0.104322f,
+    -0.048044f, -0.014127f, -0.003106f, -0.020482f, -0.064193f, -0.081986f,
+    -0.082468f, -0.103543f, -0.137545f, -0.134084f, -0.084105f, -0.011769f,
+    0.006829f,  -0.058742f, -0.125056f, -0.134972f, -0.093381f, -0.037788f,
+    -0.036004f, -0.068599f, -0.072447f, -0.036632f, -0.005364f, -0.003772f,
+    0.008373f,  0.037229f,  0.049165f,  0.080485f,  0.138379f,  0.153185f,
+    0.097080f,  0.007286f,  -0.046404f, -0.054857f, -0.042439f, 0.003029f,
+    0.111150f,  0.152392f,  0.182383f,  0.178469f,  0.194385f,  0.178392f,
+    0.176736f,  0.216067f,  0.161760f,  0.151496f,  0.122100f,  0.162213f,
+    0.175203f,  0.186983f,  0.171318f,  0.148179f,  0.110040f,  0.068766f,
+    0.263763f,  0.169777f,  0.061778f,  -0.020272f, -0.047612f, -0.017142f,
+    0.020205f,  0.017705f,  -0.007235f, -0.008434f, 0.010260f,  0.024103f,
+    0.043237f,  0.048113f,  -0.051693f, -0.259594f, -0.433009f, -0.437532f,
+    -0.257148f, 0.008778f,  0.199267f,  0.237916f,  0.160906f,  0.051878f,
+    -0.015876f, -0.034277f, -0.030541f, -0.009763f, 0.041026f,  0.085562f,
+    0.086895f,  0.015999f,  -0.073193f, -0.119194f, -0.139449f, -0.133450f,
+    -0.095679f, -0.076791f, -0.068646f, -0.075901f, -0.121567f, -0.094539f,
+    -0.039189f, -0.002942f, 0.019360f,  0.023027f,  0.038139f,  0.101000f,
+    0.047888f,  -0.024832f, -0.041060f, -0.014081f, -0.008112f, -0.028546f,
+    0.046867f,  0.219252f,  0.019719f,  0.068181f,  0.114356f,  0.119768f,
+    0.132245f,  0.159211f,  0.182251f,  0.127170f,  0.036756f,  -0.013029f,
+    0.000436f,  0.034168f,  0.035774f,  0.025352f,  0.045421f,  0.105833f,
+    0.120664f,  0.046504f,  0.007855f,  0.031597f,  0.082007f,  0.145145f,
+    0.184002f,  0.189440f,  0.109754f,  -0.137844f, -0.457974f, -0.614113f,
+    -0.491889f, -0.269159f, -0.108396f, 0.052998f,  0.172550f,  0.158681f,
+    0.100822f,  0.045265f,  -0.007983f, -0.023429f, -0.040742f, -0.002796f,
+    0.047359f,  0.049752f,  0.085373f,  0.067663f,  0.018467f,  0.022345f,
+    -0.030549f, -0.059081f, -0.067632f, -0.079713f, -0.041370f, -0.005648f,
+    0.000386f,  0.017079f,  0.064366f,  0.078836f,  -0.151939f, -0.110860f,
+    -0.042801f, 0.049369f,  0.147594f,  0.187407f,  0.134571f,  0.069857f,
+    0.090341f,  0.131991f,  0.109433f,  0.021084f,  -0.069694f, -0.104656f,
+    -0.074175f, 0.019994f,  0.135728f,  0.165045f,  0.106629f,  0.030380f,
+    -0.024882f, -0.041180f, -0.047237f, -0.088201f, -0.108990f, -0.055657f,
+    0.058303f,  0.176613f,  0.217270f,  0.135034f,  -0.006196f, -0.131986f,
+    -0.191371f, -0.179487f, -0.160231f, -0.152710f, -0.160197f, -0.183393f,
+    -0.198060f, -0.153123f, -0.125513f, -0.097130f, -0.077401f, -0.128395f,
+    -0.131634f, -0.075740f, -0.023944f, -0.012491f, 0.010268f,  0.066716f,
+    0.078182f,  0.039474f,  0.041497f,  0.099224f,  0.101704f,  -0.021347f,
+    -0.084885f, -0.025387f, -0.085187f, -0.130234f, -0.134539f, -0.118872f,
+    -0.065816f, -0.017670f, 0.015623f,  0.031383f,  0.020563f,  0.013842f,
+    0.026744f,  0.053400f,  0.025658f,  -0.023962f, -0.037603f, -0.017158f,
+    -0.013702f, 0.015782f,  0.038952f,  0.030559f,  -0.013929f, -0.050553f,
+    -0.033620f, -0.024313f, -0.050510f, -0.034354f, -0.052141f, -0.038482f,
+    -0.005508f, 0.003783f,  0.026231f,  0.073712f,  0.025111f,  -0.002047f,
+    -0.004515f, 0.004433f,  -0.041897f, -0.050929f, -0.012733f, -0.026472f,
+    -0.014470f, -0.042974f, -0.065825f, -0.096665f, -0.084512f, -0.052790f,
+    -0.100418f, -0.087129f, -0.069808f, -0.077806f, -0.055971f, -0.017156f,
+    -0.024550f, -0.111096f, -0.257327f, -0.110582f, 0.090542f,  0.213060f,
+    0.209352f,  0.112271f,  0.002495f,  -0.030116f, -0.019752f, -0.007320f,
+    0.050000f,  0.131272f,  0.110848f,  -0.053397f, -0.191990f, -0.167700f,
+    0.023205f,  0.237052f,  0.231987f,  -0.006853f, -0.241170f, -0.315591f,
+    -0.223784f, -0.011483f, 0.163074f,  0.232061f,  0.237122f,  0.191373f,
+    0.082682f,  -0.048388f, -0.138644f, -0.137499f, -0.082489f, -0.025103f,
+    0.003919f,  -0.010599f, 0.014492f,  0.037036f,  0.005185f,  0.047589f,
+    0.079595f,  0.024443f,  -0.012600f, 0.011623f,  -0.023108f, -0.060492f,
+    -0.059882f, -0.051272f, -0.010600f, 0.013541f,  -0.064545f, -0.025986f,
+    0.083371f,  0.070772f,  0.052587f,  0.335648f,  0.277874f,  0.198184f,
+    0.085819f,  0.019936f,  -0.028723f, -0.086992f, -0.119689f, -0.092417f,
+    -0.046070f, -0.022671f, -0.012629f, 0.000234f,  -0.003015f, 0.025492f,
+    0.049809f,  0.037203f,  0.039854f,  0.032833f,  0.002777f,  -0.002264f,
+    -0.013529f, -0.015290f, -0.017811f, -0.043183f, -0.064998f, -0.046660f,
+    -0.009018f, -0.022449f, -0.060271f, -0.080510f, -0.047518f, 0.002208f,
+    -0.088543f, -0.159446f, -0.136366f, -0.093331f, -0.049774f, 0.008361f,
+    0.036392f,  0.086468f,  0.114746f,  0.061937f,  0.098608f,  0.049849f,
+    0.037722f,  0.024629f,  0.040399f,  0.018952f,  0.032760f,  0.052471f,
+    0.037953f,  0.053520f,  0.035998f,  -0.013810f, -0.011510f, -0.063359f,
+    -0.119787f, -0.203641f, -0.267930f, -0.265030f, -0.182846f, -0.019697f,
+    0.147004f,  0.243865f,  0.246356f,  0.210286f,  0.161166f,  0.055994f,
+    -0.096773f, -0.234856f, -0.317814f, -0.339635f, -0.277807f, -0.122887f,
+    0.037849f,  0.109106f,  0.097732f,  0.062640f,  0.025860f,  -0.011102f,
+    -0.024633f, 0.000080f,  0.032759f,  0.049309f,  0.061169f,  0.058909f,
+    0.040233f,  0.021466f,  0.018018f,  0.041713f,  0.093034f,  0.113946f,
+    0.100035f,  0.070816f,  0.033051f,  0.006991f,  0.000581f,  0.047715f,
+    0.051211f,  0.027901f,  0.017087f,  0.059575f,  0.089390f,  0.051954f,
+    0.003142f,  0.014558f,  0.033203f,  -0.013774f, -0.047110f, -0.057937f,
+    -0.088703f, -0.114332f, 0.012052f,  0.035332f,  0.041115f,  0.034432f,
+    0.017935f,  -0.018108f, -0.039761f, -0.011509f, 0.010497f,  -0.004472f,
+    -0.030762f, -0.036373f, 0.016667f,  0.043118f,  -0.006616f, -0.038904f,
+    0.003528f,  0.025496f,  0.010368f,  0.031630f,  0.029007f,  -0.014593f,
+    -0.045161f, -0.044689f, 0.002773f,  0.038591f,  0.031678f,  0.015710f,
+    0.004958f,  -0.026578f, -0.052308f, -0.051559f, -0.026001f, -0.027373f,
+    -0.060611f, -0.085137f, -0.074872f, -0.037258f, 0.011744f,  0.071149f,
+    0.141380f,  0.184154f,  0.199419f,  0.203810f,  0.197640f,  0.169455f,
+    0.059421f,  -0.124372f, -0.329495f, -0.450923f, -0.474851f, -0.505182f,
+    -0.540612f, -0.514720f, -0.503440f, -0.539451f, -0.514257f, -0.344460f,
+    -0.083597f, 0.191630f,  0.410957f,  0.515778f,  0.506957f,  0.433089f,
+    0.339873f,  0.237469f,  0.139269f,  0.089902f,  0.096180f,  0.098427f,
+    0.076130f,  0.053008f,  0.026626f,  0.000443f,  -0.045205f, -0.139401f,
+    -0.241512f, -0.259046f, -0.156340f, -0.006554f, 0.087846f,  0.099044f,
+    0.076140f,  0.054576f,  0.034929f,  0.016001f,  -0.002895f, -0.022026f,
+    -0.028716f, -0.022379f, -0.022679f, -0.009305f, 0.049448f,  0.084489f,
+    0.043592f,  0.002974f,  0.025804f,  0.029409f,  0.013025f,  0.003650f,
+    0.016193f,  0.033071f,  0.028934f,  -0.007609f, -0.068614f, -0.063466f,
+    -0.017193f, 0.004034f,  -0.010626f, 0.012528f,  0.053983f,  0.037844f,
+    0.027000f,  0.002559f,  -0.017542f, -0.029944f, -0.036455f, -0.027225f,
+    -0.019533f, -0.020756f, -0.017860f, -0.008718f, -0.014197f, -0.040464f,
+    -0.080359f, -0.113153f, -0.105189f, -0.063055f, -0.031167f, 0.012503f,
+    0.088090f,  0.123971f,  0.093365f,  0.023268f,  -0.033283f, -0.046789f,
+    -0.045366f, -0.034195f, -0.031362f, -0.054920f, -0.067850f, -0.052221f,
+    -0.042504f, -0.041908f, -0.057650f, -0.082764f, -0.087275f, -0.063373f,
+    -0.045421f, -0.037662f, 0.067476f,  0.225691f,  0.256371f,  0.241967f,
+    0.208051f,  0.178555f,  0.175402f,  0.115931f,  0.052774f,  -0.044770f,
+    -0.104668f, -0.148875f, -0.139073f, -0.083799f, -0.053433f, -0.117824f,
+    -0.107497f, 0.115920f,  -0.002749f, -0.002748f, -0.002749f, -0.002747f,
+    -0.002750f, -0.002746f, -0.002752f, -0.002745f, -0.002753f, -0.002743f,
+    -0.002755f, -0.002742f, -0.002756f, -0.002741f, -0.002756f, -0.002740f,
+    -0.002758f, -0.002739f, -0.002759f, -0.002738f, -0.002758f, -0.002739f,
+    -0.002757f, -0.002741f, -0.002755f, -0.002742f, -0.002755f, -0.002742f,
+    -0.002755f, -0.002743f, -0.002754f, -0.002744f, -0.002752f, -0.002746f,
+    -0.002750f, -0.002747f, -0.002750f, -0.002747f, -0.002750f, -0.002748f,
+    -0.002749f, -0.002749f, -0.002748f, -0.002750f, -0.002747f, -0.002751f,
+    -0.002746f, -0.002751f, -0.002746f, -0.002751f, -0.002746f, -0.002750f,
+    -0.002747f, -0.002750f, -0.002748f, -0.002749f, -0.126690f, -0.090037f,
+    -0.045393f, -0.018909f, -0.032858f, -0.060862f, -0.066090f, -0.038682f,
+    0.000767f,  0.030029f,  0.027692f,  -0.000863f, -0.028833f, -0.059175f,
+    -0.092909f, -0.086262f, -0.022832f, 0.044827f,  0.076120f,  0.092726f,
+    0.117597f,  0.125305f,  0.088033f,  0.029466f,  0.000680f,  0.030159f,
+    0.093495f,  0.124804f,  0.100440f,  0.050592f,  0.013115f,  0.036947f,
+    0.135209f,  0.239791f,  0.297242f,  0.262783f,  0.126110f,  -0.068696f,
+    -0.239596f, -0.299235f, -0.323354f, -0.358223f, -0.295518f, -0.174698f,
+    -0.027131f, 0.077172f,  0.033401f,  -0.059132f, -0.051921f, 0.013959f,
+    0.043453f,  0.049224f,  0.065122f,  0.045423f,  0.049082f,  0.087794f,
+    0.128530f,  0.039802f,  -0.086372f, -0.154827f, -0.134451f, -0.060751f,
+    -0.007275f, 0.041262f,  0.063489f,  0.035902f,  -0.022902f, -0.080001f,
+    -0.110340f, -0.098327f, -0.055940f, -0.013249f, 0.023446f,  0.057484f,
+    0.067844f,  0.064906f,  0.053096f,  0.015567f,  -0.028897f, -0.036140f,
+    -0.036218f, -0.063316f, -0.061048f, -0.014293f, 0.018635f,  0.029737f,
+    0.043048f,  0.045614f,  0.062513f,  0.041788f,  0.013455f,  0.045624f,
+    0.032620f,  0.022973f,  0.033910f,  0.016726f,  0.015566f,  0.039964f,
+    0.058358f,  0.074617f,  0.093495f,  0.117187f,  0.124343f,  0.135411f,
+    0.141759f,  0.129389f,  0.149259f,  0.095986f,  0.032925f,  -0.041517f,
+    -0.176382f, -0.447351f, 0.046945f,  0.011056f,  -0.018077f, -0.015662f,
+    -0.014664f, -0.007851f, 0.038211f,  0.061402f,  0.011079f,  -0.018071f,
+    -0.017202f, -0.008979f, 0.030975f,  0.039970f,  -0.002339f, -0.011814f,
+    0.012121f,  0.026850f,  -0.002405f, -0.032349f, -0.021980f, 0.003829f,
+    -0.017226f, -0.062834f, -0.064531f, -0.012259f, 0.033340f,  0.020107f,
+    -0.023903f, -0.055634f, -0.074110f, -0.073657f, -0.069729f, -0.079157f,
+    -0.073036f, -0.032819f, -0.023560f, -0.063749f, -0.126694f, -0.147748f,
+    -0.159336f, -0.151759f, -0.120513f, -0.099359f, -0.038039f, 0.008903f,
+    0.036737f,  0.068563f,  0.135413f,  0.202028f,  0.271740f,  0.362343f,
+    0.333640f,  0.203360f,  0.172484f,  0.155284f,  -0.061210f, -0.036111f,
+    -0.036598f, -0.067507f, -0.101109f, -0.119601f, -0.105673f, -0.099811f,
+    -0.082390f, -0.062987f, -0.044670f, -0.025958f, -0.021144f, -0.029292f,
+    -0.031437f, -0.041708f, -0.048488f, -0.051211f, -0.033413f, -0.017105f,
+    -0.038623f, -0.061215f, -0.092756f, -0.159060f, -0.196959f, -0.177294f,
+    -0.157396f, -0.172133f, -0.177866f, -0.160236f, -0.153353f, -0.096594f,
+    -0.083846f, -0.095002f, -0.086882f, -0.127949f, -0.193225f, -0.245849f,
+    -0.298851f, -0.343140f, -0.383817f, -0.386583f, -0.337303f, -0.351654f,
+    -0.250307f, -0.156749f, -0.117982f, -0.042647f, 0.003156f,  -0.024377f,
+    -0.033924f, -0.074503f, -0.139484f, -0.155788f, -0.092883f, -0.223519f,
+    0.341567f,  0.277601f,  0.192004f,  0.118782f,  0.069791f,  0.045315f,
+    0.033107f,  0.036814f,  0.021829f,  0.008717f,  -0.005125f, -0.024348f,
+    -0.042663f, -0.022114f, 0.062593f,  0.174833f,  0.190254f,  0.061465f,
+    -0.084022f, -0.133880f, -0.087932f, -0.011734f, 0.048549f,  0.082802f,
+    0.100195f,  0.106895f,  0.068956f,  -0.023871f, -0.104729f, -0.109720f,
+    -0.040637f, 0.060907f,  0.149965f,  0.191457f,  0.198851f,  0.204064f,
+    0.199644f,  0.168173f,  0.101033f,  0.036555f,  -0.040398f, -0.098357f,
+    -0.115662f, -0.138123f, -0.173449f, -0.150229f, -0.043140f, 0.064859f,
+    0.036055f,  0.022203f,  0.070169f,  0.033797f,  0.001559f,  0.019918f,
+    -0.107842f, -0.325627f, -0.156343f, -0.117226f, -0.077063f, -0.052057f,
+    -0.038093f, -0.014155f, 0.052386f,  0.152503f,  0.207499f,  0.175072f,
+    0.074159f,  -0.032002f, -0.056787f, -0.000669f, 0.047919f,  0.028357f,
+    -0.059751f, -0.192260f, -0.359350f, -0.507490f, -0.536681f, -0.401508f,
+    -0.172526f, 0.039359f,  0.176811f,  0.225728f,  0.162673f,  0.043481f,
+    -0.030674f, -0.058173f, -0.042660f, -0.005723f, 0.015648f,  0.059288f,
+    0.076549f,  0.012152f,  -0.030204f, -0.012361f, 0.007522f,  0.047447f,
+    0.025228f,  0.005502f,  -0.018968f, -0.060294f, -0.072235f, -0.060937f,
+    -0.045990f, -0.040109f, -0.058000f, -0.046150f, -0.027110f, -0.016431f,
+    -0.008073f, -0.020853f, -0.013348f, 0.039198f,  0.127361f,  0.152001f,
+    0.171718f,  0.184676f,  0.167414f,  0.107371f,  0.026882f,  -0.026577f,
+    -0.024727f, -0.001136f, 0.035369f,  0.083391f,  0.112060f,  0.106336f,
+    0.073559f,  -0.005683f, -0.116133f, -0.188091f, -0.172437f, -0.076798f,
+    0.015092f,  0.013842f,  -0.076515f, -0.184966f, -0.266886f, -0.322140f,
+    -0.346522f, -0.314623f, -0.227800f, -0.111301f, -0.003172f, 0.067093f,
+    0.111714f,  0.129872f,  0.138267f,  0.162555f,  0.196321f,  0.163611f,
+    0.057106f,  -0.008055f, -0.014859f, -0.020444f, -0.066255f, -0.056379f,
+    -0.030468f, -0.054217f, -0.037081f, 0.025782f,  0.012268f,  -0.022948f,
+    0.000034f,  0.035445f,  -0.019470f, -0.094558f, -0.069654f, -0.031835f,
+    0.023910f,  0.027915f,  0.023982f,  0.012504f,  -0.003294f, -0.012160f,
+    0.001121f,  0.025541f,  0.060948f,  0.096288f,  0.103386f,  0.096031f,
+    0.088044f,  0.062106f,  0.035742f,  0.036308f,  0.038013f,  0.017492f,
+    0.002287f,  0.000269f,  -0.003545f, -0.013212f, -0.006896f, 0.016352f,
+    0.035966f,  0.044717f,  0.042340f,  0.031081f,  0.025929f,  0.030925f,
+    0.033354f,  0.041325f,  0.040085f,  0.012518f,  -0.006413f, 0.005065f,
+    -0.014330f, -0.088872f, -0.129965f, -0.116586f, -0.008199f, 0.167719f,
+    0.235058f,  0.254091f,  0.249419f,  0.212575f,  0.160145f,  0.067584f,
+    -0.016504f, -0.089438f, -0.098896f, -0.110893f, -0.146239f, -0.150699f,
+    -0.072440f, 0.031615f,  -0.106597f, -0.090944f, -0.047340f, -0.006821f,
+    -0.003724f, -0.017578f, -0.027312f, -0.040853f, -0.037873f, -0.017027f,
+    0.019903f,  0.042996f,  0.041246f,  0.021221f,  0.032728f,  0.118102f,
+    0.195805f,  0.210583f,  0.204037f,  0.227972f,  0.246094f,  0.213586f,
+    0.156119f,  0.076911f,  0.007203f,  -0.000095f, 0.036592f,  0.045769f,
+    -0.019326f, -0.092327f, -0.115888f, -0.103228f, -0.095596f, -0.131256f,
+    -0.155395f, -0.151218f, -0.110063f, -0.038730f, 0.001716f,  0.014895f,
+    0.059274f,  0.076366f,  0.031715f,  -0.007863f, -0.031380f, -0.045151f,
+    -0.026159f, 0.008673f,  0.052495f,  0.015092f,  -0.021198f, -0.014804f,
+    0.000215f,  -0.034024f, -0.006356f, 0.017248f,  0.185096f,  0.038031f,
+    -0.162470f, -0.344819f, -0.450886f, -0.462892f, -0.378871f, -0.241620f,
+    -0.128432f, -0.091486f, -0.104883f, -0.100724f, -0.052455f, 0.039912f,
+    0.091383f,  0.011468f,  -0.149169f, -0.234980f, -0.157715f, 0.010392f,
+    0.140316f,  0.164378f,  0.096721f,  0.022648f,  0.007166f,  0.012620f,
+    -0.018210f, -0.055049f, -0.032203f, 0.021876f,  0.078096f,  0.110482f,
+    0.101919f,  0.060448f,  -0.009333f, -0.070602f, -0.088877f, -0.053159f,
+    0.058452f,  0.165896f,  0.172482f,  0.109779f,  0.065202f,  0.049220f,
+    -0.022202f, -0.100539f, -0.149730f, -0.114237f, -0.092958f, -0.105669f,
+    -0.050160f, 0.036694f,  0.064200f,  0.075916f,  0.119415f,  0.252468f,
+    0.184140f,  0.170542f,  0.120389f,  0.026339f,  -0.062391f, -0.089989f,
+    -0.084806f, -0.057654f, -0.013098f, -0.013423f, -0.081188f, -0.117682f,
+    -0.068574f, 0.045887f,  0.101801f,  0.024501f,  -0.094151f, -0.123221f,
+    -0.053978f, 0.019185f,  0.057363f,  0.072845f,  0.053355f,  0.013469f,
+    -0.007982f, -0.032856f, -0.073803f, -0.080892f, -0.035241f, 0.003994f,
+    0.020315f,  -0.007155f, -0.050372f, -0.095521f, -0.085844f, -0.036574f,
+    -0.079282f, -0.143536f, -0.156020f, -0.155086f, -0.060959f, 0.073565f,
+    0.115212f,  0.176072f,  0.213977f,  0.205235f,  0.182430f,  0.105177f,
+    0.002790f,  -0.110157f, -0.206994f, -0.217288f, -0.148005f, -0.127134f,
+    -0.060324f, 0.172207f,  0.438377f,  0.398267f,  0.308487f,  0.183339f,
+    0.056304f,  -0.017293f, -0.007062f, 0.013498f,  -0.000457f, -0.032593f,
+    -0.063249f, -0.077713f, -0.045468f, 0.012248f,  0.032930f,  0.001600f,
+    -0.058255f, -0.092177f, -0.070032f, -0.016433f, 0.022002f,  0.039956f,
+    0.062629f,  0.094765f,  0.097048f,  0.052921f,  0.002566f,  -0.026224f,
+    -0.022051f, 0.011079f,  0.032260f,  0.041647f,  0.051906f,  0.050609f,
+    0.042747f,  0.043198f,  0.022554f,  0.006355f,  0.027939f,  0.038111f,
+    0.037582f,  0.013724f,  0.000254f,  -0.001795f, -0.035936f, -0.028674f,
+    -0.052062f, -0.069991f, -0.065676f, -0.061301f, -0.025788f, 0.027316f,
+    0.064869f,  0.029881f,  0.015626f,  0.117508f,  0.401451f,  0.229345f,
+    0.048531f,  -0.066621f, -0.082667f, -0.077307f, -0.061753f, -0.067601f,
+    -0.092237f, -0.088936f, -0.062542f, -0.039995f, -0.014614f, 0.000068f,
+    -0.030850f, -0.062470f, -0.028271f, 0.025628f,  0.030076f,  -0.014591f,
+    -0.093315f, -0.162990f, -0.109651f, 0.031149f,  0.090735f,  0.034169f,
+    -0.011845f, 0.007264f,  0.026272f,  0.001263f,  -0.027351f, 0.005566f,
+    0.035255f,  0.008081f,  -0.041027f, -0.026868f, 0.019723f,  0.084259f,
+    0.171258f,  0.210997f,  0.132267f,  0.077054f,  0.066968f,  0.013115f,
+    -0.007668f, -0.061781f, -0.090869f, -0.068635f, -0.037170f, -0.073485f,
+    -0.017558f, 0.006803f,  -0.016824f, 0.011396f,  0.130066f,  0.140561f,
+    -0.061632f, -0.025602f, 0.039061f,  0.094284f,  0.102438f,  0.072779f,
+    0.013617f,  -0.065870f, -0.123062f, -0.108139f, -0.032505f, 0.047741f,
+    0.097031f,  0.105477f,  0.080833f,  0.047978f,  -0.000223f, -0.032456f,
+    0.006638f,  0.091617f,  0.118398f,  0.041748f,  -0.083641f, -0.191314f,
+    -0.259459f, -0.306716f, -0.338642f, -0.295292f, -0.128513f, 0.022633f,
+    0.112208f,  0.114701f,  0.052859f,  0.004393f,  -0.001998f, 0.035598f,
+    0.050364f,  0.004001f,  -0.030897f, 0.025758f,  0.029745f,  -0.020415f,
+    -0.052447f, -0.016934f, 0.020608f,  -0.012433f, -0.049200f, -0.011020f,
+    0.037458f,  -0.010947f, -0.097157f, -0.033799f, 0.032182f,  -0.060185f,
+    -0.003819f, 0.359526f,  -0.102793f, -0.034273f, 0.043156f,  0.099870f,
+    0.125254f,  0.099029f,  0.058723f,  0.048080f,  0.047342f,  0.012139f,
+    -0.019554f, -0.002632f, 0.051391f,  0.083001f,  0.078912f,  0.060599f,
+    0.051540f,  0.043058f,  0.028189f,  0.044010f,  0.102470f,  0.169067f,
+    0.187099f,  0.101172f,  -0.073973f, -0.278585f, -0.450453f, -0.552034f,
+    -0.555988f, -0.407178f, -0.148267f, 0.091448f,  0.213488f,  0.218830f,
+    0.146278f,  0.062342f,  0.019859f,  0.016777f,  0.035380f,  0.027063f,
+    0.036659f,  0.009577f,  -0.000896f, 0.024006f,  0.004134f,  0.011506f,
+    0.005911f,  0.032638f,  0.034049f,  0.039149f,  -0.004554f, -0.015168f,
+    0.007655f,  -0.016817f, -0.045821f, 0.023814f,  0.412938f,  0.278850f,
+    0.069786f,  -0.168079f, -0.401899f, -0.546700f, -0.525594f, -0.335254f,
+    -0.063239f, 0.190590f,  0.368498f,  0.417213f,  0.320259f,  0.162274f,
+    0.059758f,  0.012321f,  -0.053394f, -0.137497f, -0.193480f, -0.172133f,
+    -0.086458f, -0.025678f, -0.021834f, -0.026275f, -0.006893f, 0.017086f,
+    0.012407f,  -0.019728f, -0.032821f, -0.007597f, 0.011034f,  0.008096f,
+    -0.009984f, 0.001508f,  0.024330f,  -0.005328f, 0.004947f,  0.058143f,
+    0.048813f,  0.014919f,  0.018842f,  0.013343f,  -0.000562f, -0.034906f,
+    -0.028207f, -0.036866f, -0.073332f, -0.045230f, -0.010730f, -0.019230f,
+    -0.018582f, 0.035016f,  0.051976f,  -0.012319f, 0.004662f,  0.011699f,
+    -0.002194f, -0.002181f, -0.002197f, -0.002177f, -0.002202f, -0.002172f,
+    -0.002207f, -0.002168f, -0.002211f, -0.002165f, -0.002213f, -0.002163f,
+    -0.002215f, -0.002160f, -0.002219f, -0.002156f, -0.002224f, -0.002149f,
+    -0.002232f, -0.002139f, -0.002242f, -0.002130f, -0.002250f, -0.002124f,
+    -0.002252f, -0.002126f, -0.002246f, -0.002136f, -0.002234f, -0.002150f,
+    -0.002219f, -0.002166f, -0.002203f, -0.002181f, -0.002188f, -0.002197f,
+    -0.002171f, -0.002214f, -0.002153f, -0.002232f, -0.002136f, -0.002247f,
+    -0.002124f, -0.002257f, -0.002117f, -0.002261f, -0.002116f, -0.002259f,
+    -0.002120f, -0.002252f, -0.002131f, -0.002238f, -0.002147f, -0.002223f,
+    -0.002159f, -0.002213f, -0.092440f, -0.086652f, -0.081864f, -0.065237f,
+    -0.033719f, 0.005682f,  0.049244f,  0.087779f,  0.112774f,  0.122222f,
+    0.082170f,  -0.037501f, -0.176119f, -0.228029f, -0.145835f, 0.014457f,
+    0.136905f,  0.134222f,  0.032542f,  -0.066043f, -0.083326f, -0.029938f,
+    0.016783f,  0.008675f,  -0.016929f, -0.029263f, -0.034032f, -0.028515f,
+    -0.008158f, 0.023520f,  0.033906f,  0.003234f,  -0.087238f, -0.201418f,
+    -0.229934f, -0.164148f, -0.093671f, 0.016843f,  0.191569f,  0.312103f,
+    0.281101f,  0.192293f,  0.112258f,  0.073344f,  -0.002874f, -0.105671f,
+    -0.092426f, -0.034444f, -0.053492f, -0.032495f, 0.007589f,  -0.081409f,
+    -0.193459f, -0.197085f, -0.295093f, -0.539203f, -0.000975f, -0.000925f,
+    -0.000975f, -0.000930f, -0.000969f, -0.000937f, -0.000961f, -0.000944f,
+    -0.000956f, -0.000948f, -0.000953f, -0.000949f, -0.000953f, -0.000948f,
+    -0.000955f, -0.000946f, -0.000957f, -0.000943f, -0.000960f, -0.000942f,
+    -0.000960f, -0.000942f, -0.000959f, -0.000945f, -0.000954f, -0.000951f,
+    -0.000948f, -0.000958f, -0.000940f, -0.000966f, -0.000932f, -0.000974f,
+    -0.000923f, -0.000983f, -0.000915f, -0.000991f, -0.000908f, -0.000996f,
+    -0.000905f, -0.000998f, -0.000904f, -0.000999f, -0.000902f, -0.001001f,
+    -0.000900f, -0.001002f, -0.000900f, -0.001001f, -0.000902f, -0.000999f,
+    -0.000904f, -0.000997f, -0.000907f, -0.000994f, -0.000909f, -0.000989f,
+    0.188698f,  0.155135f,  0.126568f,  0.098024f,  0.087533f,  0.092592f,
+    0.081139f,  0.049974f,  0.030936f,  0.001145f,  -0.015849f, -0.003080f,
+    -0.016089f, -0.051145f, -0.049545f, -0.018041f, -0.004842f, -0.001034f,
+    0.011701f,  0.012182f,  -0.008835f, -0.010163f, 0.006412f,  0.018047f,
+    0.021477f,  0.027380f,  0.053357f,  0.111586f,  0.169500f,  0.187858f,
+    0.187758f,  0.224798f,  0.217502f,  0.282076f,  0.328065f,  0.333042f,
+    0.355470f,  0.425791f,  0.438368f,  0.343941f,  0.342268f,  0.259912f,
+    0.224251f,  0.151810f,  0.094937f,  0.056183f,  0.040140f,  0.003859f,
+    -0.024892f, -0.006652f, -0.043472f, 0.022860f,  0.019587f,  -0.007221f,
+    0.091977f,  0.065237f,  -0.117023f, -0.036840f, 0.053993f,  0.128106f,
+    0.170573f,  0.165249f,  0.134045f,  0.110198f,  0.058711f,  -0.023355f,
+    -0.058675f, -0.015909f, 0.031401f,  0.028730f,  0.010059f,  0.030014f,
+    0.092412f,  0.119662f,  0.063753f,  -0.020143f, -0.067429f, -0.058089f,
+    -0.016149f, 0.045153f,  0.101540f,  0.124935f,  0.098767f,  0.051230f,
+    0.025665f,  0.020733f,  0.006375f,  -0.058651f, -0.093767f, -0.027064f,
+    0.084015f,  0.185078f,  0.225831f,  0.172208f,  0.166212f,  0.198569f,
+    0.174009f,  0.097457f,  -0.010276f, -0.055430f, -0.058740f, -0.141595f,
+    -0.249225f, -0.274692f, -0.178960f, -0.234485f, -0.336096f, -0.216373f,
+    -0.097743f, -0.124621f, -0.121981f, 0.042678f,  0.259425f,  0.221309f,
+    0.158856f,  0.069943f,  -0.035697f, -0.141221f, -0.219594f, -0.252328f,
+    -0.243617f, -0.228648f, -0.226085f, -0.203394f, -0.132461f, -0.005635f,
+    0.120903f,  0.162040f,  0.114244f,  0.039809f,  -0.035710f, -0.094567f,
+    -0.092464f, 0.003472f,  0.154740f,  0.282639f,  0.309861f,  0.220076f,
+    0.068230f,  -0.085118f, -0.195953f, -0.210256f, -0.155309f, -0.073490f,
+    0.015446f,  0.095761f,  0.123167f,  0.117933f,  0.116049f,  0.121400f,
+    0.097651f,  0.049986f,  -0.025638f, -0.096600f, -0.112224f, -0.074700f,
+    -0.066867f, -0.099667f, -0.092416f, -0.044531f, -0.027546f, -0.038923f,
+    -0.040048f, -0.031612f, 0.011074f,  0.074153f,  0.101538f,  0.103093f,
+    -0.037063f, -0.063343f, -0.082217f, -0.087644f, -0.062180f, -0.019385f,
+    0.009335f,  0.004347f,  -0.014862f, -0.008018f, 0.043092f,  0.109281f,
+    0.122162f,  0.058006f,  -0.017585f, -0.026027f, 0.026315f,  0.090068f,
+    0.112443f,  0.102008f,  0.082316f,  0.053520f,  0.027566f,  0.014660f,
+    0.011895f,  0.010408f,  0.016550f,  0.022028f,  -0.004636f, -0.016610f,
+    0.020299f,  0.054607f,  0.062880f,  0.054003f,  0.008470f,  -0.041134f,
+    -0.062238f, -0.067727f, -0.092531f, -0.073027f, 0.055022f,  0.102792f,
+    0.130475f,  0.190125f,  0.233884f,  0.267581f,  0.254695f,  0.230489f,
+    0.126459f,  0.089207f,  0.078716f,  0.055392f,  -0.014429f, -0.004673f,
+    0.015463f,  -0.108329f, 0.013224f,  -0.089339f, -0.155669f, -0.117991f,
+    0.005209f,  0.134315f,  0.184674f,  0.119760f,  -0.011719f, -0.151414f,
+    -0.231632f, -0.186021f, -0.061759f, 0.029210f,  0.061320f,  0.119181f,
+    0.215469f,  0.252569f,  0.185296f,  0.073365f,  -0.029213f, -0.136722f,
+    -0.273026f, -0.405517f, -0.440394f, -0.329321f, -0.131700f, 0.044679f,
+    0.133035f,  0.147089f,  0.116394f,  0.076580f,  0.052240f,  0.008316f,
+    -0.037251f, -0.015702f, 0.058756f,  0.091230f,  0.086245f,  0.094749f,
+    0.099980f,  0.047952f,  -0.024697f, -0.038048f, -0.029850f, -0.027999f,
+    0.003082f,  -0.013040f, -0.041084f, 0.019076f,  0.036447f,  0.002071f,
+    -0.010568f, -0.018772f, -0.029931f, -0.029626f, -0.063403f, -0.027172f,
+    0.014857f,  0.042780f,  0.072155f,  0.090107f,  0.091953f,  0.081391f,
+    0.056103f,  0.034139f,  0.011878f,  0.027118f,  0.078932f,  0.095378f,
+    0.045625f,  -0.023506f, -0.027675f, 0.053725f,  0.136735f,  0.140297f,
+    0.081852f,  0.039650f,  0.050730f,  0.052717f,  -0.005180f, -0.062479f,
+    -0.067920f, -0.048326f, -0.041382f, -0.013039f, 0.036533f,  0.049850f,
+    0.023425f,  -0.005133f, 0.006316f,  0.031550f,  0.011003f,  -0.056439f,
+    -0.132508f, -0.231507f, -0.287758f, -0.223640f, -0.157514f, -0.179133f,
+    -0.213495f, -0.186767f, -0.088688f, -0.056625f, -0.026516f, -0.008023f,
+    -0.042564f, -0.098163f, -0.086667f, -0.162729f, -0.202804f, -0.090434f,
+    -0.054388f, -0.005097f, 0.018864f,  0.001991f,  -0.014250f, -0.006229f,
+    0.024662f,  0.030617f,  -0.010993f, -0.085711f, -0.133367f, -0.094340f,
+    -0.005629f, 0.058310f,  0.078061f,  0.063346f,  0.023419f,  -0.035929f,
+    -0.074973f, -0.038336f, 0.042016f,  0.078063f,  0.046863f,  -0.009869f,
+    -0.054027f, -0.076431f, -0.083529f, -0.067957f, -0.041789f, -0.037208f,
+    -0.018293f, 0.020628f,  0.027987f,  0.020804f,  0.017042f,  0.021805f,
+    0.013398f,  -0.002746f, 0.010868f,  -0.026202f, -0.080777f, -0.131532f,
+    -0.173871f, -0.165203f, -0.101053f, 0.001419f,  0.104766f,  0.258336f,
+    0.313891f,  0.240748f,  0.202805f,  0.065578f,  -0.126514f, -0.154659f,
+    -0.159009f, -0.300693f, 0.031773f,  -0.065841f, -0.141647f, -0.157823f,
+    -0.124791f, -0.067098f, -0.054957f, -0.078907f, -0.069555f, -0.038665f,
+    -0.012534f, 0.022073f,  0.026060f,  -0.021201f, -0.053032f, -0.047086f,
+    -0.032974f, -0.027854f, -0.016347f, -0.017187f, -0.025784f, -0.004621f,
+    0.005497f,  -0.013565f, -0.007214f, -0.003435f, -0.038368f, -0.066450f,
+    -0.041145f, -0.035555f, -0.055966f, -0.060673f, -0.098987f, -0.147014f,
+    -0.139524f, -0.077434f, 0.019661f,  0.113663f,  0.236003f,  0.256751f,
+    0.257894f,  0.224871f,  0.243606f,  0.198791f,  0.099182f,  -0.000263f,
+    -0.063414f, -0.106184f, -0.099066f, -0.088851f, -0.059733f, 0.025651f,
+    0.095851f,  0.055674f,  0.067368f,  0.284315f,  0.079403f,  0.074357f,
+    0.047959f,  0.009001f,  -0.030662f, -0.028819f, 0.029558f,  0.086931f,
+    0.090660f,  0.050141f,  0.030641f,  0.030611f,  0.024551f,  0.016739f,
+    0.043811f,  0.070846f,  0.025944f,  -0.028855f, 0.000225f,  0.058609f,
+    0.059266f,  0.010962f,  -0.022440f, 0.002812f,  0.069298f,  0.118923f,
+    0.113040f,  0.078652f,  0.056941f,  0.063682f,  0.039534f,  0.005853f,
+    -0.019701f, -0.051077f, -0.085542f, -0.112206f, -0.140943f, -0.162364f,
+    -0.160459f, -0.141361f, -0.103415f, -0.064674f, 0.005062f,  0.104699f,
+    0.180533f,  0.234331f,  0.294393f,  0.298636f,  0.246610f,  0.253410f,
+    0.201228f,  0.146555f,  0.120497f,  0.101506f,  0.036448f,  -0.000157f,
+    -0.033740f, 0.090231f,  0.195939f,  0.227666f,  0.187054f,  0.094756f,
+    0.008669f,  -0.019500f, 0.023643f,  0.063848f,  0.064222f,  0.028108f,
+    -0.047095f, -0.109829f, -0.106742f, -0.068899f, -0.056508f, -0.066176f,
+    -0.065815f, -0.084340f, -0.127032f, -0.131666f, -0.074713f, 0.003281f,
+    0.062623f,  0.065910f,  0.009616f,  -0.049019f, -0.047653f, 0.022883f,
+    0.072646f,  0.078145f,  0.042099f,  -0.025010f, -0.053405f, -0.062633f,
+    -0.112132f, -0.183806f, -0.217316f, -0.130751f, -0.036075f, 0.019823f,
+    0.028572f,  0.004738f,  0.002958f,  0.047104f,  0.024653f,  0.000933f,
+    -0.023772f, -0.036508f, -0.008122f, 0.013853f,  0.073537f,  0.121783f,
+    0.137134f,  0.114130f,  -0.019136f, -0.026687f, -0.037387f, -0.036183f,
+    -0.007719f, 0.011763f,  0.024242f,  0.016482f,  0.010604f,  0.050045f,
+    0.098264f,  0.079126f,  0.003487f,  -0.085160f, -0.104240f, -0.022621f,
+    0.066397f,  0.058702f,  0.000812f,  -0.001361f, 0.029699f,  0.016676f,
+    -0.006602f, -0.000452f, 0.000628f,  -0.012159f, -0.008426f, 0.001601f,
+    -0.014254f, 0.007179f,  0.036697f,  0.024272f,  0.019386f,  0.018016f,
+    0.016554f,  0.065304f,  0.030232f,  0.007944f,  0.034779f,  -0.090895f,
+    -0.130558f, 0.033631f,  0.087631f,  -0.015907f, -0.107072f, 0.034792f,
+    0.186053f,  0.082692f,  -0.238736f, -0.132554f, 0.298937f,  0.241651f,
+    0.002620f,  0.000449f,  -0.385805f, -1.057841f, 0.151342f,  0.159529f,
+    0.156340f,  0.101232f,  0.042450f,  -0.007984f, -0.067018f, -0.101956f,
+    -0.127359f, -0.163268f, -0.126288f, 0.019276f,  0.159666f,  0.180671f,
+    0.081236f,  -0.059337f, -0.081472f, 0.084050f,  0.246466f,  0.183400f,
+    -0.071120f, -0.320002f, -0.384409f, -0.222444f, -0.006494f, 0.099312f,
+    0.115554f,  0.102622f,  0.062521f,  -0.001392f, -0.049376f, -0.054939f,
+    -0.060811f, -0.072484f, -0.070377f, -0.068806f, -0.058134f, -0.031492f,
+    -0.001936f, 0.039707f,  0.075518f,  0.063140f,  0.020150f,  -0.003667f,
+    -0.030164f, -0.076452f, -0.116074f, -0.098942f, -0.040355f, -0.050381f,
+    -0.110001f, -0.063106f, -0.024810f, -0.047183f, -0.004038f, 0.158744f,
+    -0.094890f, 0.013009f,  0.025622f,  0.045358f,  0.043230f,  -0.009358f,
+    -0.010536f, 0.016889f,  0.006346f,  0.005464f,  0.006262f,  -0.027939f,
+    -0.041901f, -0.035618f, -0.015185f, 0.033640f,  0.051294f,  -0.008486f,
+    -0.069065f, -0.056509f, -0.031044f, 0.010683f,  0.050333f,  0.015207f,
+    -0.038110f, -0.022395f, 0.031319f,  0.037738f,  -0.022108f, -0.047462f,
+    -0.000675f, 0.051196f,  0.076818f,  0.095721f,  0.061653f,  -0.033789f,
+    -0.099230f, -0.093947f, -0.035777f, 0.022863f,  0.029206f,  -0.013291f,
+    -0.051081f, -0.063194f, -0.053528f, -0.055685f, -0.103846f, -0.215053f,
+    -0.344632f, -0.488008f, -0.671493f, -0.857447f, -0.971167f, -0.904412f,
+    -0.812887f, -0.895617f, -0.002490f, -0.002344f, -0.002499f, -0.002343f,
+    -0.002499f, -0.002344f, -0.002495f, -0.002351f, -0.002485f, -0.002365f,
+    -0.002467f, -0.002385f, -0.002447f, -0.002402f, -0.002435f, -0.002407f,
+    -0.002438f, -0.002399f, -0.002445f, -0.002397f, -0.002439f, -0.002410f,
+    -0.002423f, -0.002427f, -0.002409f, -0.002436f, -0.002405f, -0.002435f,
+    -0.002410f, -0.002429f, -0.002416f, -0.002424f, -0.002419f, -0.002422f,
+    -0.002419f, -0.002424f, -0.002416f, -0.002428f, -0.002411f, -0.002433f,
+    -0.002407f, -0.002433f, -0.002413f, -0.002422f, -0.002428f, -0.002406f,
+    -0.002441f, -0.002400f, -0.002437f, -0.002411f, -0.002423f, -0.002424f,
+    -0.002415f, -0.002428f, -0.002414f, -0.002426f, 0.183062f,  0.077972f,
+    -0.046172f, -0.149514f, -0.193276f, -0.163889f, -0.077977f, 0.049593f,
+    0.146996f,  0.153029f,  0.080110f,  -0.023412f, -0.109277f, -0.170956f,
+    -0.217998f, -0.210186f, -0.107530f, 0.048726f,  0.175335f,  0.240358f,
+    0.234274f,  0.158722f,  0.051702f,  -0.069278f, -0.179322f, -0.244981f,
+    -0.279112f, -0.308688f, -0.320720f, -0.267462f, -0.128800f, 0.057542f,
+    0.226111f,  0.277690f,  0.195152f,  0.119783f,  0.105254f,  0.076757f,
+    0.039747f,  0.018858f,  -0.013670f, 0.006980f,  0.040639f,  0.035073f,
+    -0.022315f, -0.091967f, -0.097023f, -0.104723f, -0.074549f, -0.019591f,
+    -0.034576f, -0.017757f, 0.075699f,  0.035325f,  -0.038654f, 0.023765f,
+    -0.459330f, -0.424297f, -0.345567f, -0.230864f, -0.098631f, 0.018891f,
+    0.112527f,  0.173847f,  0.205206f,  0.197930f,  0.174109f,  0.167373f,
+    0.154429f,  0.119557f,  0.088653f,  0.081415f,  0.116020f,  0.167869f,
+    0.200670f,  0.212286f,  0.157671f,  0.022063f,  -0.077774f, -0.069490f,
+    -0.030272f, -0.029643f, -0.046564f, -0.051800f, -0.047058f, -0.025298f,
+    -0.004708f, -0.048405f, -0.132862f, -0.179400f, -0.147600f, -0.016892f,
+    0.105935f,  0.168740f,  0.189356f,  0.134923f,  0.065774f,  0.069521f,
+    0.056403f,  0.001208f,  -0.064567f, -0.102447f, -0.094087f, -0.108033f,
+    -0.130943f, -0.082638f, -0.058788f, -0.078282f, -0.015548f, 0.086109f,
+    0.061169f,  -0.013950f, 0.072398f,  0.061089f,  0.020327f,  -0.000058f,
+    0.019616f,  0.030744f,  0.030659f,  0.030019f,  0.011932f,  0.010185f,
+    0.034311f,  0.034096f,  0.024496f,  0.027332f,  0.002599f,  0.002897f,
+    0.034303f,  0.028838f,  0.016445f,  0.037555f,  0.053765f,  0.053944f,
+    0.029605f,  -0.005966f, 0.001260f,  0.015909f,  -0.018081f, -0.065334f,
+    -0.065580f, -0.031162f, -0.005168f, -0.026870f, -0.062291f, -0.048397f,
+    -0.033553f, -0.014726f, 0.025683f,  -0.001177f, -0.046921f, -0.032165f,
+    -0.047066f, -0.058048f, -0.018009f, 0.011636f,  0.048180f,  0.094504f,
+    0.058162f,  -0.012078f, 0.046253f,  0.081585f,  0.140828f,  0.179553f,
+    0.161746f,  0.320472f,  0.450850f,  0.411305f,  -0.140565f, -0.237702f,
+    -0.316497f, -0.312007f, -0.184376f, 0.004447f,  0.101321f,  0.045474f,
+    -0.065344f, -0.099869f, -0.069117f, -0.050929f, -0.053357f, -0.009788f,
+    0.045279f,  0.054016f,  0.013542f,  -0.055967f, -0.065933f, 0.001207f,
+    0.080005f,  0.116381f,  0.063256f,  -0.044434f, -0.095488f, -0.066672f,
+    -0.043717f, -0.053869f, -0.009875f, 0.075068f,  0.067860f,  0.009088f,
+    -0.071120f, -0.156180f, -0.098302f, 0.022452f,  0.088859f,  0.095537f,
+    0.070852f,  0.052204f,  0.085327f,  0.050799f,  0.018793f,  0.069105f,
+    0.047446f,  0.077554f,  0.071127f,  0.084989f,  0.092022f,  0.084388f,
+    0.080392f,  0.073742f,  0.044465f,  0.065115f,  0.101705f,  0.078923f,
+    -0.148774f, -0.134697f, -0.120262f, -0.094243f, -0.050683f, -0.003944f,
+    0.020593f,  0.030068f,  0.022560f,  0.012533f,  0.007713f,  -0.015842f,
+    -0.027556f, -0.012609f, -0.013181f, -0.011175f, 0.036195f,  0.058165f,
+    -0.001691f, -0.083470f, -0.105134f, -0.036984f, 0.045133f,  0.069814f,
+    0.058565f,  0.036380f,  0.006688f,  -0.012351f, -0.015081f, -0.016367f,
+    -0.012049f, -0.005842f, 0.001221f,  -0.021864f, -0.033237f, 0.045124f,
+    0.038970f,  -0.001478f, 0.062094f,  0.042135f,  -0.051033f, 0.012319f,
+    0.152689f,  0.071053f,  -0.232602f, -0.196417f, 0.081383f,  0.255111f,
+    0.213236f,  0.024467f,  -0.191671f, -0.407789f, -0.374758f, -0.173607f,
+    -0.130836f, -0.305162f, -0.110983f, -0.069337f, -0.038218f, -0.017474f,
+    -0.007117f, -0.049060f, -0.118748f, -0.129152f, -0.072865f, -0.039128f,
+    -0.021074f, -0.005407f, 0.000550f,  0.023258f,  0.061964f,  0.071219f,
+    0.062159f,  0.064525f,  0.069294f,  0.056435f,  0.032869f,  0.044078f,
+    0.084007f,  0.077403f,  0.017657f,  -0.042689f, -0.078699f, -0.075217f,
+    -0.046055f, -0.053547f, -0.127399f, -0.245471f, -0.380890f, -0.516057f,
+    -0.623573f, -0.668748f, -0.645331f, -0.578767f, -0.515356f, -0.446329f,
+    -0.391798f, -0.363322f, -0.286654f, -0.221527f, -0.181781f, -0.125535f,
+    -0.074652f, -0.056995f, -0.061719f, -0.032426f, -0.021400f, -0.031207f,
+    -0.083312f, -0.094895f, -0.091107f, -0.133272f, 0.170195f,  0.166290f,
+    0.142434f,  0.087547f,  0.004080f,  -0.084743f, -0.159687f, -0.219662f,
+    -0.274797f, -0.329622f, -0.372904f, -0.400393f, -0.420083f, -0.436615f,
+    -0.433865f, -0.401868f, -0.356588f, -0.305367f, -0.240830f, -0.172620f,
+    -0.112458f, -0.058745f, -0.004713f, 0.041647f,  0.065321f,  0.060247f,
+    0.033085f,  -0.001559f, -0.025206f, -0.032856f, -0.020758f, -0.005405f,
+    0.002503f,  0.009042f,  0.022979f,  0.021217f,  0.001533f,  0.001391f,
+    0.022254f,  0.033043f,  0.043851f,  0.052285f,  0.046437f,  0.065984f,
+    0.100025f,  0.154553f,  0.199102f,  0.121971f,  0.006795f,  -0.062040f,
+    -0.063561f, -0.067509f, -0.079963f, -0.105548f, -0.225882f, -0.411516f,
+    -0.263341f, -0.167410f, -0.088373f, -0.073085f, -0.116713f, -0.174869f,
+    -0.204098f, -0.211709f, -0.212117f, -0.226094f, -0.208143f, -0.172726f,
+    -0.202578f, -0.298073f, -0.339627f, -0.281750f, -0.196696f, -0.125419f,
+    -0.089427f, -0.110648f, -0.129761f, -0.117509f, -0.099836f, -0.088627f,
+    -0.087952f, -0.099879f, -0.118750f, -0.124658f, -0.098906f, -0.046631f,
+    0.019073f,  0.055060f,  0.064635f,  0.073281f,  0.051747f,  0.004283f,
+    -0.048095f, -0.049043f, -0.041164f, -0.110419f, -0.132278f, -0.122227f,
+    -0.131686f, -0.071880f, -0.017152f, 0.003815f,  0.037818f,  0.057470f,
+    0.046671f,  0.066879f,  0.078294f,  0.051832f,  0.032072f,  0.062135f,
+    0.063871f,  -0.011585f, 0.106003f,  0.021977f,  -0.085871f, -0.163439f,
+    -0.166772f, -0.118486f, -0.061362f, -0.000678f, 0.045029f,  0.064143f,
+    0.037478f,  -0.011597f, 0.009420f,  0.109043f,  0.159747f,  0.119731f,
+    0.043948f,  -0.033964f, -0.111915f, -0.195794f, -0.245960f, -0.183326f,
+    -0.049570f, 0.031003f,  0.031820f,  0.015154f,  0.037985f,  0.108659f,
+    0.191236f,  0.228399f,  0.202490f,  0.104073f,  -0.025778f, -0.147097f,
+    -0.226412f, -0.195630f, -0.119399f, -0.074972f, -0.069621f, -0.066962f,
+    0.002825f,  0.073105f,  0.030109f,  -0.032232f, -0.025388f, -0.012610f,
+    -0.043340f, -0.063535f, -0.022751f, 0.013524f,  -0.019683f, 0.005604f,
+    0.019340f,  0.017856f,  0.110657f,  0.209837f,  0.105896f,  0.090819f,
+    0.063408f,  0.021446f,  -0.006879f, -0.025547f, -0.041052f, -0.043289f,
+    -0.023813f, -0.026396f, -0.078593f, -0.135335f, -0.136878f, -0.090752f,
+    -0.046788f, -0.045280f, -0.093448f, -0.143816f, -0.126755f, -0.031164f,
+    0.075489f,  0.125635f,  0.112080f,  0.062739f,  0.002748f,  -0.045279f,
+    -0.072565f, -0.074846f, -0.057414f, -0.020279f, -0.004254f, -0.039150f,
+    -0.067014f, -0.094134f, -0.125978f, -0.097366f, -0.065969f, -0.072189f,
+    -0.051661f, -0.006306f, -0.019375f, -0.004375f, 0.050144f,  0.063293f,
+    0.097567f,  0.109624f,  0.114153f,  0.139446f,  0.122654f,  0.109381f,
+    0.053275f,  -0.017266f, -0.066132f, -0.013316f, -0.014677f, -0.045207f,
+    -0.103587f, -0.113610f, -0.114442f, -0.102183f, -0.064082f, 0.030533f,
+    0.121034f,  0.132162f,  0.056317f,  0.005537f,  0.023150f,  0.021611f,
+    -0.025006f, -0.054480f, -0.040299f, -0.000940f, -0.000707f, -0.032586f,
+    -0.037754f, -0.026918f, -0.027823f, -0.053036f, -0.072963f, -0.012421f,
+    0.134766f,  0.291716f,  0.341126f,  0.253181f,  0.070032f,  -0.144723f,
+    -0.323522f, -0.366415f, -0.293527f, -0.172371f, -0.070402f, -0.014585f,
+    0.049599f,  0.124034f,  0.182218f,  0.181640f,  0.130047f,  0.050183f,
+    0.003846f,  -0.017918f, -0.020695f, -0.035242f, -0.024183f, -0.018347f,
+    -0.031879f, -0.014646f, -0.004183f, -0.018748f, -0.042084f, -0.028289f,
+    -0.043744f, -0.164437f, 0.172410f,  0.197400f,  0.179791f,  0.123276f,
+    0.045351f,  0.002864f,  0.024746f,  0.062863f,  0.077622f,  0.078269f,
+    0.047303f,  -0.008610f, -0.038985f, -0.053209f, -0.102482f, -0.194103f,
+    -0.282225f, -0.290261f, -0.188841f, -0.027640f, 0.105550f,  0.174161f,
+    0.193907f,  0.205937f,  0.219271f,  0.181834f,  0.077382f,  -0.020571f,
+    -0.059812f, -0.057384f, -0.080761f, -0.125752f, -0.129124f, -0.076364f,
+    -0.040988f, -0.003339f, 0.034734f,  0.046822f,  0.045391f,  0.001003f,
+    -0.040634f, -0.111414f, -0.151916f, -0.114426f, -0.083847f, -0.119607f,
+    -0.116281f, -0.085503f, 0.001058f,  0.098523f,  0.124030f,  0.094610f,
+    0.088107f,  0.138615f,  0.064237f,  -0.176493f, -0.291595f, -0.182656f,
+    -0.044325f, 0.079848f,  0.145917f,  0.115001f,  0.064541f,  0.060985f,
+    0.103104f,  0.133681f,  0.123630f,  0.085444f,  0.033067f,  -0.009807f,
+    -0.002450f, 0.063518f,  0.182185f,  0.263660f,  0.218671f,  0.127440f,
+    0.110087f,  0.177251f,  0.229545f,  0.189344f,  0.074254f,  -0.049823f,
+    -0.128549f, -0.142361f, -0.109258f, -0.074327f, -0.060353f, -0.045081f,
+    -0.026323f, -0.005604f, 0.043560f,  0.080161f,  0.063367f,  0.026536f,
+    -0.026346f, -0.108748f, -0.150240f, -0.109070f, -0.092436f, -0.115064f,
+    -0.115334f, -0.029846f, 0.005502f,  0.006116f,  0.006265f,  0.008075f,
+    0.030164f,  0.079858f,  0.084458f,  0.026458f,  -0.004638f, -0.010975f,
+    0.317699f,  0.139709f,  -0.076591f, -0.215658f, -0.238476f, -0.162348f,
+    -0.058423f, -0.018696f, -0.034149f, -0.023354f, 0.021304f,  0.025209f,
+    -0.025306f, -0.056558f, -0.036607f, 0.018907f,  0.111615f,  0.226442f,
+    0.337805f,  0.364408f,  0.240279f,  0.044138f,  -0.117232f, -0.176957f,
+    -0.104676f, 0.005508f,  0.045890f,  0.013851f,  -0.023117f, -0.039860f,
+    -0.044417f, -0.068947f, -0.059285f, -0.028127f, -0.036445f, -0.033388f,
+    -0.035058f, -0.062346f, -0.073992f, -0.019503f, 0.007449f,  -0.016456f,
+    -0.046225f, -0.043755f, -0.059516f, -0.074452f, -0.056586f, -0.010746f,
+    -0.017260f, 0.007951f,  0.058269f,  0.003003f,  -0.057699f, 0.022714f,
+    0.015245f,  -0.119659f, -0.144800f, -0.039301f, 0.072235f,  0.127795f,
+    0.115833f,  0.070799f,  0.036792f,  0.028782f,  0.015231f,  -0.029747f,
+    -0.086493f, -0.127335f, -0.142578f, -0.121498f, -0.062160f, -0.017272f,
+    -0.022957f, -0.031780f, -0.004109f, 0.021599f,  0.017303f,  -0.005755f,
+    -0.031254f, -0.030525f, 0.001168f,  0.040354f,  0.050771f,  0.012623f,
+    -0.047080f, -0.076611f, -0.063116f, 0.003936f,  0.079235f,  0.124084f,
+    0.123944f,  0.060401f,  0.000039f,  -0.004383f, 0.020040f,  0.069064f,
+    0.102142f,  0.099207f,  0.113878f,  0.135378f,  0.095845f,  0.032285f,
+    0.045223f,  0.029257f,  -0.038391f, -0.072315f, -0.062684f, -0.066499f,
+    0.004580f,  0.008530f,  0.019996f,  0.117372f,  -0.308003f, -0.240612f,
+    -0.114747f, 0.007499f,  0.067793f,  0.078964f,  0.066054f,  0.082273f,
+    0.126770f,  0.149429f,  0.138429f,  0.109994f,  0.107193f,  0.118142f,
+    0.079104f,  0.030751f,  0.066013f,  0.110433f,  0.147857f,  0.149591f,
+    0.103245f,  0.090680f,  0.115636f,  0.087844f,  0.038912f,  0.019606f,
+    0.009425f,  -0.028295f, -0.068057f, -0.083438f, -0.035054f, 0.021116f,
+    0.062131f,  0.044865f,  0.018558f,  0.005181f,  -0.023281f, -0.058227f,
+    -0.068849f, -0.119998f, -0.109845f, -0.029848f, 0.041127f,  0.120882f,
+    0.125269f,  0.142117f,  0.103206f,  0.095258f,  0.076473f,  0.080812f,
+    0.157912f,  0.154098f,  0.070968f,  0.100738f,  0.125633f,  0.037275f,
+    -0.288105f, -0.222818f, -0.111380f, 0.030190f,  0.166079f,  0.218936f,
+    0.172500f,  0.083642f,  0.018583f,  0.003842f,  0.029024f,  0.050738f,
+    0.023895f,  -0.063724f, -0.123565f, -0.082709f, 0.000071f,  0.004272f,
+    -0.080041f, -0.179704f, -0.261038f, -0.356598f, -0.490878f, -0.632939f,
+    -0.712465f, -0.670946f, -0.504919f, -0.279969f, -0.079648f, 0.042798f,
+    0.079878f,  0.050309f,  -0.001163f, -0.014538f, 0.002560f,  -0.008777f,
+    -0.046094f, -0.059363f, -0.034034f, -0.062960f, -0.038741f, -0.013748f,
+    0.001410f,  0.047409f,  0.071130f,  0.007415f,  0.019794f,  0.048417f,
+    -0.006325f, 0.027595f,  0.035109f,  0.037620f,  0.066781f,  0.080468f,
+    0.061151f,  0.094126f,  0.019094f,  0.007549f,  -0.023797f, -0.087656f,
+    -0.141297f, -0.159023f, -0.122026f, -0.038179f, 0.008091f,  0.013753f,
+    0.014223f,  0.004464f,  -0.005129f, 0.045284f,  0.136448f,  0.189111f,
+    0.147000f,  0.053656f,  -0.028667f, -0.047114f, 0.014560f,  0.116327f,
+    0.179741f,  0.120407f,  -0.046982f, -0.187035f, -0.219207f, -0.160053f,
+    -0.056568f, 0.000920f,  0.027582f,  0.008233f,  -0.030844f, -0.017763f,
+    -0.011338f, -0.035721f, 0.001113f,  0.083150f,  0.105132f,  0.092195f,
+    0.077120f,  0.081448f,  -0.013269f, -0.025298f, 0.006704f,  -0.023857f,
+    -0.016891f, 0.008614f,  -0.018734f, -0.008446f, 0.016514f,  -0.010859f,
+    -0.026594f, -0.010257f, 0.033563f,  -0.008682f, -0.046850f, -0.081942f,
+    -0.133247f, -0.153807f, -0.110095f, -0.019128f, 0.041296f,  0.011156f,
+    -0.022774f, 0.029297f,  0.080977f,  0.045976f,  -0.016020f, -0.013476f,
+    0.025271f,  0.079442f,  0.126883f,  0.112433f,  0.074793f,  0.041143f,
+    0.012247f,  0.083510f,  0.205052f,  0.240352f,  0.256267f,  0.298171f,
+    0.334184f,  0.318055f,  0.200127f,  -0.008279f, -0.242379f, -0.385690f,
+    -0.418387f, -0.345505f, -0.180805f, -0.040171f, 0.056425f,  0.099465f,
+    0.092517f,  0.058027f,  0.059150f,  0.024528f,  0.014916f,  0.035983f,
+    0.008763f,  -0.034799f, -0.006491f, 0.003746f,  0.022076f,  -0.001029f,
+    0.029550f,  0.035608f,  0.025915f,  0.020074f,  -0.004960f, -0.045941f,
+    -0.143568f, -0.171583f, -0.187441f, -0.170430f, -0.103476f, -0.032921f,
+    0.003311f,  0.050148f,  0.106634f,  0.097491f,  0.022941f,  -0.037222f,
+    -0.045047f, -0.019903f, 0.015249f,  0.050146f,  0.069078f,  0.069997f,
+    0.063864f,  0.083842f,  0.151110f,  0.284228f,  0.457633f,  0.531353f,
+    0.400645f,  0.147824f,  -0.090833f, -0.277473f, -0.452914f, -0.559610f,
+    -0.527014f, -0.424232f, -0.306566f, -0.164503f, -0.001106f, 0.101029f,
+    0.085841f,  0.053058f,  0.047494f,  0.016405f,  0.004356f,  0.053207f,
+    0.062811f,  0.060928f,  0.059296f,  0.078779f,  0.020231f,  0.035590f,
+    0.045429f,  0.067427f,  0.081024f,  0.067401f,  0.055008f,  0.019341f,
+    -0.074169f, -0.112699f, -0.154713f, -0.129661f, -0.105080f, -0.068833f,
+    -0.006233f, 0.049818f,  0.061131f,  0.030439f,  -0.015030f, -0.007774f,
+    0.064350f,  0.127891f,  0.113554f,  0.039311f,  -0.038056f, -0.064856f,
+    -0.039377f, 0.003072f,  0.066453f,  0.132834f,  0.132768f,  0.026719f,
+    -0.147078f, -0.272549f, -0.236435f, -0.054355f, 0.149542f,  0.277512f,
+    0.319319f,  0.295616f,  0.259300f,  0.245839f,  0.169276f,  0.034577f,
+    -0.077858f, -0.148114f, -0.148823f, -0.040320f, 0.090951f,  0.138268f,
+    0.179080f,  0.126608f,  0.049748f,  -0.013376f, -0.041401f, -0.081110f,
+    -0.120378f, -0.119318f, -0.126057f, -0.145724f, -0.087549f, -0.024186f,
+    -0.031567f, 0.014090f,  0.186025f,  0.348061f,  -0.251918f, -0.142594f,
+    -0.049474f, 0.013255f,  0.054212f,  0.068018f,  0.044771f,  -0.006758f,
+    -0.047405f, -0.027974f, 0.036102f,  0.089261f,  0.073181f,  0.004015f,
+    -0.049156f, -0.046071f, -0.005716f, 0.010918f,  0.002682f,  0.000432f,
+    -0.009164f, -0.030528f, -0.099562f, -0.248365f, -0.400005f, -0.462725f,
+    -0.348438f, -0.059522f, 0.234841f,  0.339253f,  0.293851f,  0.206730f,
+    0.129450f,  0.090221f,  0.103190f,  0.097241f,  0.082518f,  0.066777f,
+    0.039750f,  0.002122f,  -0.000491f, -0.002870f, 0.019982f,  0.023796f,
+    0.021472f,  0.019017f,  -0.036618f, -0.057153f, -0.102301f, -0.126878f,
+    -0.146412f, -0.098985f, -0.065563f, -0.062120f, -0.012780f, 0.092613f,
+    -0.001143f, -0.002376f, -0.012782f, -0.042303f, -0.087407f, -0.126617f,
+    -0.129255f, -0.091198f, -0.053210f, -0.039914f, -0.046396f, -0.034287f,
+    0.010894f,  0.058087f,  0.037173f,  -0.087591f, -0.224758f, -0.251961f,
+    -0.157880f, -0.010399f, 0.148794f,  0.298721f,  0.370827f,  0.312681f,
+    0.183076f,  0.069351f,  -0.018309f, -0.113930f, -0.203728f, -0.207284f,
+    -0.106333f, 0.023139f,  0.105701f,  0.118209f,  0.073364f,  0.016895f,
+    -0.013263f, -0.007306f, 0.046489f,  0.123182f,  0.144216f,  0.150564f,
+    0.145324f,  0.111012f,  0.079148f,  0.079258f,  0.012645f,  -0.088585f,
+    -0.021200f, 0.052768f,  0.034758f,  0.072140f,  0.115444f,  0.045509f,
+    0.109197f,  0.209338f,  0.155321f,  0.095662f,  0.024012f,  -0.002646f,
+    0.009630f,  0.020286f,  0.035886f,  0.026965f,  -0.025851f, -0.040707f,
+    -0.018298f, 0.007465f,  0.018656f,  0.008358f,  -0.053215f, -0.124382f,
+    -0.138950f, -0.091572f, 0.000649f,  0.073386f,  0.052570f,  -0.031499f,
+    -0.076471f, -0.055182f, -0.027868f, -0.018696f, -0.013727f, -0.040985f,
+    -0.087003f, -0.104138f, -0.096545f, -0.125165f, -0.118658f, -0.070613f,
+    -0.046066f, -0.053976f, 0.010468f,  0.129242f,  0.164948f,  0.151874f,
+    0.140972f,  0.128277f,  0.078781f,  0.061832f,  0.033473f,  -0.048729f,
+    -0.108226f, -0.093779f, -0.061883f, -0.051643f, -0.046750f, -0.070005f,
+    -0.122873f, -0.103788f, -0.076322f, 0.003608f,  0.138194f,  0.053849f,
+    -0.008745f, -0.035779f, -0.030876f, 0.022899f,  0.059131f,  0.032943f,
+    -0.031905f, -0.086686f, -0.106474f, -0.079248f, -0.024060f, -0.027487f,
+    -0.098448f, -0.153025f, -0.152472f, -0.101050f, -0.044851f, -0.028657f,
+    -0.054478f, -0.124498f, -0.197570f, -0.212656f, -0.121306f, 0.110294f,
+    0.384533f,  0.541277f,  0.532847f,  0.411694f,  0.202063f,  -0.055085f,
+    -0.194479f, -0.247182f, -0.257000f, -0.172662f, -0.106437f, -0.058813f,
+    0.068567f,  0.113072f,  0.075420f,  0.102738f,  0.030717f,  0.001534f,
+    0.011616f,  -0.051050f, -0.031760f, -0.041906f, -0.052072f, -0.039576f,
+    0.000264f,  0.003692f,  0.033331f,  0.035600f,  -0.000257f, 0.073669f,
+    0.318294f,  0.373745f,  0.394219f,  0.330126f,  0.182917f,  0.042087f,
+    -0.013326f, -0.044922f, -0.112411f, -0.165718f, -0.187749f, -0.201150f,
+    -0.206875f, -0.212051f, -0.211478f, -0.177355f, -0.115517f, -0.087198f,
+    -0.106501f, -0.126087f, -0.108155f, -0.057804f, -0.023659f, -0.030328f,
+    -0.073652f, -0.116055f, -0.097190f, 0.009939f,  0.180805f,  0.317889f,
+    0.348977f,  0.253852f,  0.090367f,  -0.055218f, -0.153492f, -0.199012f,
+    -0.188727f, -0.157724f, -0.140794f, -0.085717f, 0.018899f,  0.087357f,
+    0.060128f,  0.035952f,  -0.019155f, -0.072947f, -0.081766f, -0.076815f,
+    -0.055919f, 0.021697f,  0.126800f,  0.193955f,  0.197176f,  0.170920f,
+    0.163215f,  0.067118f,  -0.075673f, -0.013334f, 0.067018f,  0.141130f,
+    0.174854f,  0.166916f,  0.140364f,  0.090602f,  0.004659f,  -0.067671f,
+    -0.093887f, -0.073756f, -0.021314f, 0.019641f,  0.033070f,  0.034133f,
+    0.010084f,  -0.007234f, 0.017862f,  0.062646f,  0.058577f,  -0.028600f,
+    -0.119062f, -0.103593f, 0.026522f,  0.186963f,  0.286731f,  0.309830f,
+    0.295338f,  0.285927f,  0.285979f,  0.268456f,  0.213847f,  0.129906f,
+    0.024880f,  -0.095057f, -0.223590f, -0.349508f, -0.463260f, -0.566104f,
+    -0.657107f, -0.729825f, -0.767391f, -0.760508f, -0.719901f, -0.646538f,
+    -0.534639f, -0.403084f, -0.265591f, -0.150391f, -0.095805f, -0.055674f,
+    0.022129f,  0.060507f,  0.109270f,  0.177672f,  -0.058824f, -0.006404f,
+    0.063029f,  0.085335f,  0.072858f,  0.066033f,  0.069970f,  0.069545f,
+    0.028693f,  -0.058793f, -0.087812f, -0.042600f, -0.049055f, -0.108419f,
+    -0.114628f, -0.100446f, -0.124450f, -0.126148f, -0.058126f, -0.018745f,
+    -0.026610f, -0.043532f, -0.081118f, -0.117147f, -0.114084f, -0.094631f,
+    -0.092213f, -0.106250f, -0.117165f, -0.091202f, -0.070066f, -0.071666f,
+    -0.043779f, -0.025685f, -0.052740f, -0.067198f, -0.069764f, -0.072311f,
+    -0.095908f, -0.051150f, 0.025850f,  0.018854f,  0.032005f,  0.049508f,
+    0.026354f,  0.064919f,  0.030387f,  -0.015702f, -0.028657f, -0.031016f,
+    -0.071778f, -0.007627f, 0.038961f,  0.003754f,  0.088264f,  0.202525f,
+    0.065572f,  0.004992f,  -0.034448f, -0.042220f, -0.024480f, -0.009524f,
+    0.001139f,  0.047737f,  0.127142f,  0.130147f,  0.041953f,  -0.074300f,
+    -0.131643f, -0.103478f, -0.052650f, -0.015225f, 0.036809f,  0.105314f,
+    0.139880f,  0.118742f,  0.065450f,  -0.006443f, -0.071144f, -0.106069f,
+    -0.119851f, -0.124327f, -0.087181f, 0.033237f,  0.157764f,  0.181963f,
+    0.133636f,  0.039873f,  -0.022682f, -0.013654f, 0.021862f,  0.017081f,
+    -0.050873f, -0.123815f, -0.182095f, -0.180050f, -0.132843f, -0.082847f,
+    -0.064291f, -0.031153f, 0.032706f,  0.066882f,  0.034499f,  0.050761f,
+    0.058991f,  0.060059f,  0.067732f,  0.042780f,  -0.015258f, 0.077032f,
+    0.120920f,  0.011568f,  -0.044402f, -0.053212f, -0.018666f, 0.034140f,
+    0.055725f,  0.053939f,  0.001260f,  -0.077655f, -0.108905f, -0.075173f,
+    -0.025685f, -0.008397f, -0.012556f, -0.022070f, -0.016811f, 0.023973f,
+    0.071014f,  0.096425f,  0.106406f,  0.085139f,  0.053225f,  0.021990f,
+    0.028620f,  0.073119f,  0.137228f,  0.184583f,  0.117069f,  -0.084143f,
+    -0.316530f, -0.519027f, -0.596739f, -0.527585f, -0.329844f, -0.101057f,
+    0.075435f,  0.135599f,  0.129082f,  0.152114f,  0.157866f,  0.090191f,
+    -0.015567f, -0.000479f, 0.006892f,  0.001710f,  0.005517f,  0.013661f,
+    -0.020038f, 0.004491f,  0.071529f,  0.008634f,  0.009474f,  0.013334f,
+    -0.022734f, 0.020300f,  0.035352f,  -0.031772f, -0.184845f, -0.126071f,
+    -0.042732f, 0.034990f,  0.084249f,  0.095229f,  0.084940f,  0.079653f,
+    0.072670f,  0.040794f,  0.019221f,  0.026516f,  0.044287f,  0.062231f,
+    0.080008f,  0.097665f,  0.127321f,  0.134747f,  0.110713f,  0.072362f,
+    0.031013f,  0.019991f,  0.063239f,  0.120568f,  0.123400f,  0.059172f,
+    -0.010173f, -0.031630f, -0.012654f, 0.014133f,  0.050077f,  0.108123f,
+    0.161347f,  0.181869f,  0.166243f,  0.090424f,  -0.021672f, -0.119612f,
+    -0.150540f, -0.107090f, -0.035571f, 0.008594f,  0.030743f,  0.033571f,
+    -0.019355f, -0.121793f, -0.211874f, -0.251875f, -0.281617f, -0.320625f,
+    -0.352137f, -0.378789f, -0.368988f, -0.234374f, -0.085069f, -0.057456f,
+    0.387982f,  0.364270f,  0.296256f,  0.150496f,  -0.046724f, -0.207961f,
+    -0.257642f, -0.229886f, -0.222375f, -0.304953f, -0.411666f, -0.398441f,
+    -0.205637f, 0.092276f,  0.356260f,  0.419724f,  0.246403f,  0.008980f,
+    -0.082790f, 0.017581f,  0.195017f,  0.294897f,  0.234029f,  0.064546f,
+    -0.103312f, -0.168959f, -0.113541f, -0.025914f, 0.016341f,  0.006301f,
+    -0.030173f, -0.051364f, -0.055437f, -0.055449f, -0.044372f, -0.022629f,
+    -0.019287f, -0.018266f, -0.002725f, 0.037758f,  0.050103f,  0.017346f,
+    0.008492f,  0.014083f,  -0.076460f, -0.128916f, -0.113736f, -0.131628f,
+    -0.084618f, -0.012267f, 0.017325f,  0.034001f,  0.043606f,  0.063315f,
+    -0.064466f, -0.260803f, -0.200261f, -0.213161f, -0.179627f, -0.084805f,
+    0.033884f,  0.107734f,  0.114693f,  0.089408f,  0.085801f,  0.052336f,
+    -0.015805f, -0.045165f, -0.014528f, 0.025577f,  0.032705f,  0.019327f,
+    0.004163f,  -0.045559f, -0.114051f, -0.122852f, -0.047018f, 0.041809f,
+    0.050635f,  -0.022716f, -0.100456f, -0.133809f, -0.121656f, -0.093958f,
+    -0.043764f, 0.004140f,  0.003888f,  -0.031566f, -0.056907f, -0.038269f,
+    -0.041628f, -0.101397f, -0.124810f, -0.077144f, -0.074059f, -0.131603f,
+    -0.122389f, -0.083643f, -0.092877f, -0.117562f, -0.068291f, -0.021514f,
+    -0.034790f, -0.064188f, -0.082465f, -0.068894f, -0.016662f, 0.035173f,
+    0.050022f,  0.068414f,  0.131890f,  0.291933f,  0.242548f,  0.209596f,
+    0.160565f,  0.118368f,  0.078161f,  0.036143f,  0.018439f,  0.019271f,
+    0.019078f,  0.010383f,  0.002434f,  -0.004451f, 0.003413f,  0.006264f,
+    -0.012599f, -0.056802f, -0.086824f, -0.059437f, -0.001994f, 0.055487f,
+    0.088931f,  0.081672f,  0.060679f,  0.045941f,  0.033332f,  0.021216f,
+    0.025894f,  0.035994f,  0.021389f,  0.051600f,  0.107641f,  0.104770f,
+    0.067747f,  0.015908f,  -0.045912f, -0.063617f, -0.046749f, -0.047914f,
+    -0.031598f, 0.018490f,  0.033306f,  0.005448f,  0.059961f,  0.090288f,
+    0.049339f,  0.045829f,  0.015187f,  -0.031411f, -0.022318f, 0.017195f,
+    -0.015066f, -0.009982f, 0.011313f,  0.024123f,  0.001931f,  0.005578f,
+    -0.148650f, -0.083681f, -0.002062f, 0.066945f,  0.109983f,  0.127066f,
+    0.109766f,  0.059698f,  0.019953f,  0.007182f,  0.016697f,  0.043808f,
+    0.060498f,  0.059318f,  0.045015f,  0.020706f,  -0.001021f, -0.028879f,
+    -0.051160f, -0.042676f, -0.008121f, 0.020439f,  0.009498f,  -0.041992f,
+    -0.109913f, -0.174502f, -0.223361f, -0.250620f, -0.254569f, -0.242309f,
+    -0.165175f, -0.012658f, 0.160988f,  0.324156f,  0.414345f,  0.382642f,
+    0.264295f,  0.118815f,  -0.021606f, -0.067123f, -0.067796f, -0.097199f,
+    -0.129174f, -0.230281f, -0.357805f, -0.434160f, -0.494509f, -0.473668f,
+    -0.304287f, -0.090067f, 0.113771f,  0.275176f,  0.345870f,  0.348498f,
+    0.435984f,  0.537398f,  0.572592f,  0.585537f,  0.603561f,  0.589502f,
+    0.496581f,  0.371932f,  0.328651f,  0.314406f,  0.296054f,  0.259259f,
+    0.192151f,  0.149655f,  0.161579f,  0.211282f,  0.175701f,  0.091568f,
+    0.096817f,  0.099833f,  0.044578f,  0.041497f,  0.124891f,  0.158567f,
+    0.111410f,  0.041340f,  0.032518f,  0.047588f,  0.017596f,  -0.037969f,
+    -0.021798f, 0.035969f,  0.027099f,  0.060710f,  0.048207f,  0.031045f,
+    0.066831f,  0.101196f,  0.098160f,  0.111637f,  0.082784f,  0.088845f,
+    0.101069f,  0.081517f,  0.044018f,  0.021369f,  0.032346f,  -0.017013f,
+    -0.042124f, -0.148957f, -0.157666f, -0.144842f, -0.044202f, -0.035524f,
+    -0.030482f, -0.000221f, 0.058238f,  -0.039835f, -0.051584f, -0.016242f,
+    0.008446f,  -0.001424f, -0.057436f, -0.127517f, -0.177256f, -0.204927f,
+    -0.200294f, -0.158444f, -0.091989f, -0.036571f, -0.020802f, -0.017222f,
+    -0.001979f, -0.025822f, -0.123026f, -0.231808f, -0.281586f, -0.275209f,
+    -0.262163f, -0.270085f, -0.307433f, -0.355141f, -0.381978f, -0.389473f,
+    -0.375142f, -0.322281f, -0.225180f, -0.109755f, -0.008430f, 0.096446f,
+    0.199294f,  0.270812f,  0.304623f,  0.289296f,  0.236266f,  0.117205f,
+    -0.002992f, -0.035276f, -0.035271f, 0.020289f,  0.066755f,  0.116846f,
+    0.139656f,  0.124146f,  0.140665f,  0.111999f,  0.038531f,  0.005548f,
+    0.014596f,  0.008973f,  -0.015268f, -0.011019f, 0.029964f,  0.109676f,
+    0.173988f,  0.079646f,  -0.015462f, -0.060407f, -0.049206f, -0.003295f,
+    0.026586f,  -0.022389f, -0.099225f, -0.089494f, 0.010434f,  0.047295f,
+    -0.061305f, -0.184880f, -0.180590f, -0.060868f, 0.099408f,  0.243872f,
+    0.265979f,  0.096017f,  -0.169258f, -0.363414f, -0.398078f, -0.212664f,
+    0.165807f,  0.500424f,  0.589774f,  0.442468f,  0.125810f,  -0.186649f,
+    -0.349313f, -0.349358f, -0.241006f, -0.077204f, 0.042927f,  0.066559f,
+    0.025678f,  0.004107f,  -0.032923f, -0.047952f, -0.024289f, -0.018739f,
+    -0.021780f, -0.024739f, 0.005609f,  0.010444f,  0.011183f,  -0.011077f,
+    0.043018f,  0.037810f,  0.024451f,  0.033003f,  -0.013817f, 0.017214f,
+    0.068405f,  -0.046775f, -0.404697f, -0.305316f, -0.110798f, 0.062158f,
+    0.134999f,  0.126377f,  0.102628f,  0.104903f,  0.079791f,  0.040567f,
+    0.011282f,  -0.009759f, -0.033509f, -0.069733f, -0.070348f, -0.035791f,
+    0.013369f,  0.051335f,  0.016959f,  -0.049256f, -0.066684f, -0.063361f,
+    -0.057190f, -0.040996f, -0.025965f, 0.017331f,  0.075073f,  0.059323f,
+    -0.010900f, -0.028382f, -0.018268f, -0.011181f, -0.056156f, -0.089164f,
+    -0.078280f, 0.003003f,  0.006887f,  -0.056203f, -0.046536f, -0.125191f,
+    -0.172662f, -0.199636f, -0.205208f, -0.164866f, -0.187615f, -0.241440f,
+    -0.291917f, -0.349285f, -0.417032f, -0.464986f, -0.468385f, -0.529477f,
+    -0.574465f, -0.518036f, -0.411939f, -0.550474f, 0.185816f,  0.139109f,
+    0.069726f,  0.015818f,  -0.001256f, 0.001240f,  -0.000222f, -0.014769f,
+    -0.033984f, -0.042690f, -0.021325f, 0.005588f,  -0.001351f, -0.028940f,
+    -0.047566f, -0.036573f, 0.002060f,  0.039469f,  0.038230f,  -0.018936f,
+    -0.098990f, -0.138795f, -0.105577f, -0.013980f, 0.087842f,  0.158314f,
+    0.190680f,  0.187631f,  0.159151f,  0.120334f,  0.086001f,  0.046146f,
+    -0.004133f, -0.031200f, -0.004038f, 0.063495f,  0.099386f,  0.053754f,
+    -0.024524f, -0.098694f, -0.190445f, -0.233008f, -0.238871f, -0.336407f,
+    -0.414497f, -0.372869f, -0.281518f, -0.216655f, -0.170531f, -0.123111f,
+    -0.109650f, -0.061558f, 0.071021f,  0.101198f,  0.055387f,  0.081703f,
+    0.041537f,  0.029497f,  -0.018591f, -0.081315f, -0.127900f, -0.141253f,
+    -0.126877f, -0.118608f, -0.129558f, -0.102322f, -0.032864f, 0.016806f,
+    0.032390f,  0.055104f,  0.072587f,  0.061564f,  0.025231f,  -0.027356f,
+    -0.092955f, -0.127509f, -0.120185f, -0.092295f, -0.062524f, -0.038200f,
+    -0.008323f, 0.035999f,  0.088613f,  0.123776f,  0.129987f,  0.132497f,
+    0.142118f,  0.136230f,  0.095930f,  0.040672f,  -0.001687f, -0.062099f,
+    -0.151398f, -0.258675f, -0.322277f, -0.258963f, -0.117041f, 0.030128f,
+    0.147709f,  0.190276f,  0.189022f,  0.260905f,  0.344290f,  0.289561f,
+    0.206168f,  0.121942f,  -0.010981f, -0.086211f, -0.103433f, -0.180486f,
+    -0.249824f, -0.221986f, -0.174498f, -0.120563f, -0.057864f, -0.004382f,
+    0.032100f,  0.014432f,  -0.050441f, -0.106135f, -0.084838f, 0.010415f,
+    0.094006f,  0.113558f,  0.075906f,  0.016360f,  -0.038128f, -0.069885f,
+    -0.094135f, -0.100404f, -0.063133f, -0.013879f, 0.014574f,  0.033072f,
+    0.054088f,  0.056585f,  -0.000104f, -0.084504f, -0.127725f, -0.092054f,
+    -0.009217f, 0.052946f,  0.072377f,  0.011682f,  -0.064653f, -0.078616f,
+    -0.070980f, -0.044570f, -0.024779f, -0.006843f, 0.057606f,  0.095097f,
+    0.050343f,  0.034762f,  0.060795f,  0.068523f,  0.065885f,  0.045821f,
+    0.077736f,  0.108977f,  0.099538f,  0.156068f,  0.250790f,  0.217385f,
+    0.137664f,  0.166385f,  0.171998f,  0.075801f,  -0.006008f, -0.006012f,
+    -0.006008f, -0.006012f, -0.006008f, -0.006011f, -0.006009f, -0.006011f,
+    -0.006009f, -0.006010f, -0.006010f, -0.006009f, -0.006011f, -0.006009f,
+    -0.006011f, -0.006009f, -0.006010f, -0.006009f, -0.006010f, -0.006010f,
+    -0.006009f, -0.006010f, -0.006009f, -0.006010f, -0.006010f, -0.006010f,
+    -0.006010f, -0.006010f, -0.006009f, -0.006012f, -0.006006f, -0.006016f,
+    -0.006001f, -0.006022f, -0.005995f, -0.006027f, -0.005993f, -0.006025f,
+    -0.005998f, -0.006019f, -0.006004f, -0.006014f, -0.006006f, -0.006013f,
+    -0.006006f, -0.006015f, -0.006004f, -0.006015f, -0.006005f, -0.006013f,
+    -0.006008f, -0.006010f, -0.006011f, -0.006008f, -0.006012f, -0.006007f,
+    0.053751f,  0.119100f,  0.152915f,  0.145022f,  0.098748f,  0.035902f,
+    -0.022262f, -0.067432f, -0.069370f, -0.037254f, 0.024215f,  0.109028f,
+    0.152825f,  0.130778f,  0.062350f,  -0.029615f, -0.119228f, -0.178797f,
+    -0.187008f, -0.153359f, -0.127727f, -0.156361f, -0.240791f, -0.350362f,
+    -0.453318f, -0.531468f, -0.581084f, -0.599686f, -0.595397f, -0.584358f,
+    -0.574556f, -0.555915f, -0.507457f, -0.406208f, -0.225220f, -0.007301f,
+    0.164759f,  0.267927f,  0.287727f,  0.232751f,  0.101893f,  0.016522f,
+    0.019143f,  -0.028061f, -0.097611f, -0.082059f, -0.063870f, -0.050662f,
+    0.003080f,  -0.030481f, -0.072316f, -0.034442f, 0.032003f,  0.027346f,
+    0.074834f,  0.269230f,  -0.038843f, -0.050234f, -0.028492f, -0.025556f,
+    -0.059128f, -0.063786f, 0.013814f,  0.081301f,  0.036524f,  -0.017947f,
+    -0.017427f, -0.004293f, 0.047244f,  0.088713f,  0.026060f,  -0.076056f,
+    -0.105684f, 0.017499f,  0.169402f,  0.162665f,  -0.032447f, -0.344511f,
+    -0.620465f, -0.673959f, -0.453099f, -0.052725f, 0.323856f,  0.484775f,
+    0.396208f,  0.149854f,  -0.160361f, -0.381083f, -0.402468f, -0.245560f,
+    0.003868f,  0.178732f,  0.212192f,  0.190128f,  0.124885f,  0.058140f,
+    0.002736f,  -0.076474f, -0.096362f, -0.052311f, -0.044973f, -0.045640f,
+    -0.004444f, 0.017260f,  0.013755f,  0.028901f,  0.012972f,  -0.000104f,
+    0.042531f,  0.035809f,  0.045824f,  0.154341f,  -0.003365f, -0.003365f,
+    -0.003365f, -0.003365f, -0.003365f, -0.003365f, -0.003365f, -0.003365f,
+    -0.003366f, -0.003364f, -0.003366f, -0.003363f, -0.003368f, -0.003362f,
+    -0.003369f, -0.003360f, -0.003370f, -0.003360f, -0.003369f, -0.003362f,
+    -0.003366f, -0.003366f, -0.003363f, -0.003369f, -0.003361f, -0.003370f,
+    -0.003361f, -0.003369f, -0.003362f, -0.003366f, -0.003365f, -0.003364f,
+    -0.003367f, -0.003363f, -0.003367f, -0.003363f, -0.003366f, -0.003365f,
+    -0.003364f, -0.003366f, -0.003364f, -0.003366f, -0.003363f, -0.003367f,
+    -0.003363f, -0.003366f, -0.003364f, -0.003365f, -0.003366f, -0.003363f,
+    -0.003368f, -0.003361f, -0.003370f, -0.003359f, -0.003371f, -0.003359f,
+    -0.004370f, -0.007817f, -0.036156f, -0.074846f, -0.104685f, -0.117694f,
+    -0.107519f, -0.079734f, -0.043791f, 0.000253f,  0.048363f,  0.093813f,
+    0.134712f,  0.174083f,  0.209678f,  0.232808f,  0.248664f,  0.263742f,
+    0.267832f,  0.228735f,  0.136900f,  0.051040f,  0.013645f,  0.007746f,
+    0.001813f,  -0.021180f, -0.054627f, -0.084960f, -0.118305f, -0.157689f,
+    -0.208906f, -0.264199f, -0.279256f, -0.228741f, -0.119456f, 0.023048f,
+    0.144107f,  0.181441f,  0.104767f,  0.027205f,  0.028439f,  0.027064f,
+    0.039720f,  0.023231f,  -0.040279f, -0.048458f, -0.042924f, -0.014559f,
+    0.038639f,  0.033692f,  -0.038359f, -0.052707f, -0.067014f, -0.098128f,
+    -0.112218f, -0.048833f, -0.054376f, 0.036573f,  0.126777f,  0.205638f,
+    0.265532f,  0.279828f,  0.235982f,  0.173564f,  0.151674f,  0.155479f,
+    0.125356f,  0.061044f,  -0.001429f, -0.018591f, 0.017177f,  0.050687f,
+    0.069977f,  0.103153f,  0.124173f,  0.103222f,  0.068710f,  0.033683f,
+    0.000263f,  -0.020828f, -0.043365f, -0.084116f, -0.139663f, -0.209095f,
+    -0.288898f, -0.355589f, -0.386176f, -0.377430f, -0.344204f, -0.311225f,
+    -0.286769f, -0.253826f, -0.193267f, -0.092914f, 0.040271f,  0.131642f,
+    0.136678f,  0.057008f,  -0.012975f, -0.033221f, -0.051526f, -0.050841f,
+    0.003763f,  0.017856f,  -0.045384f, -0.061511f, -0.047218f, -0.033819f,
+    -0.069354f, -0.074097f, -0.023744f, 0.041995f,  0.005751f,  -0.067150f,
+    -0.123346f, -0.103246f, 0.013789f,  0.143277f,  0.191178f,  0.179649f,
+    0.174144f,  0.186015f,  0.183108f,  0.146462f,  0.093916f,  0.060758f,
+    0.048467f,  0.056422f,  0.089910f,  0.119562f,  0.097869f,  0.020065f,
+    -0.034948f, -0.022314f, -0.004530f, 0.001176f,  0.026174f,  0.069549f,
+    0.103766f,  0.123451f,  0.146185f,  0.123137f,  0.049171f,  0.045113f,
+    0.154389f,  0.294027f,  0.383010f,  0.354605f,  0.201003f,  -0.061100f,
+    -0.332245f, -0.438496f, -0.444448f, -0.417278f, -0.403848f, -0.343338f,
+    -0.202330f, -0.073339f, -0.027504f, 0.008981f,  0.048833f,  0.020793f,
+    0.042106f,  0.115538f,  0.140602f,  0.172560f,  0.180734f,  0.136754f,
+    -0.217254f, -0.060042f, 0.120341f,  0.217476f,  0.167371f,  0.040334f,
+    -0.058168f, -0.110729f, -0.151403f, -0.122535f, -0.035863f, 0.017247f,
+    0.015635f,  -0.036346f, -0.072591f, -0.017661f, 0.076167f,  0.110873f,
+    0.049680f,  -0.064753f, -0.137033f, -0.141679f, -0.093775f, -0.005441f,
+    0.081122f,  0.137430f,  0.160583f,  0.170259f,  0.170741f,  0.149432f,
+    0.083386f,  0.028739f,  0.049187f,  0.102441f,  0.113302f,  0.087005f,
+    0.023193f,  -0.056989f, -0.063271f, -0.062586f, -0.028935f, -0.006195f,
+    -0.012623f, -0.005756f, -0.023788f, -0.137171f, -0.177064f, -0.171374f,
+    -0.135720f, -0.100230f, -0.075885f, -0.034868f, -0.053033f, -0.045980f,
+    0.064502f,  0.081894f,  -0.130475f, -0.151883f, -0.166233f, -0.159331f,
+    -0.120338f, -0.056534f, 0.080027f,  0.300350f,  0.490195f,  0.407049f,
+    0.024355f,  -0.347627f, -0.388532f, -0.072587f, 0.332689f,  0.509074f,
+    0.327014f,  -0.080956f, -0.416139f, -0.430741f, -0.184898f, 0.071218f,
+    0.193335f,  0.183676f,  0.103078f,  -0.008178f, -0.113715f, -0.157716f,
+    -0.122248f, -0.058765f, -0.014352f, -0.037819f, -0.054463f, 0.028338f,
+    0.091657f,  0.141322f,  0.173387f,  0.134298f,  0.081001f,  0.034392f,
+    -0.032760f, -0.037918f, 0.023023f,  0.024252f,  -0.002980f, 0.002714f,
+    0.001696f,  -0.037756f, -0.063457f, -0.021428f, 0.072615f,  0.024618f,
+    -0.097930f, -0.049110f, -0.071340f, -0.436054f, -0.296062f, -0.250722f,
+    -0.177227f, -0.102385f, -0.036901f, -0.001687f, -0.011855f, -0.019150f,
+    -0.021900f, -0.043315f, -0.077470f, -0.076706f, -0.023281f, 0.049707f,
+    0.044442f,  -0.062096f, -0.169934f, -0.216050f, -0.200077f, -0.151637f,
+    -0.120222f, -0.100529f, -0.063022f, -0.004297f, 0.037262f,  0.029508f,
+    0.007271f,  -0.002700f, -0.014962f, 0.016352f,  0.087206f,  0.121299f,
+    0.082110f,  0.017118f,  -0.002541f, 0.012844f,  0.034308f,  0.058125f,
+    0.115278f,  0.091771f,  0.067564f,  0.030154f,  0.020810f,  -0.071494f,
+    -0.177325f, -0.156758f, -0.207070f, -0.177148f, -0.143947f, -0.109333f,
+    -0.118646f, -0.066508f, -0.012077f, 0.015718f,  -0.014808f, -0.050465f,
+    0.317559f,  0.215984f,  0.095284f,  0.008393f,  -0.016914f, 0.015661f,
+    0.059987f,  0.057011f,  0.020111f,  0.004386f,  0.001311f,  -0.006008f,
+    0.015994f,  0.039515f,  -0.056721f, -0.285561f, -0.496130f, -0.544219f,
+    -0.393615f, -0.125641f, 0.107710f,  0.220273f,  0.224428f,  0.179481f,
+    0.141161f,  0.120144f,  0.101867f,  0.093902f,  0.120263f,  0.151911f,
+    0.144762f,  0.056985f,  -0.066897f, -0.151764f, -0.186281f, -0.174005f,
+    -0.137011f, -0.124135f, -0.118698f, -0.116164f, -0.140689f, -0.095207f,
+    -0.018816f, 0.050760f,  0.098259f,  0.102818f,  0.114381f,  0.182963f,
+    0.100419f,  -0.012648f, -0.057397f, -0.053213f, -0.028582f, -0.009384f,
+    0.070453f,  0.217677f,  -0.067947f, -0.037738f, -0.003696f, 0.005804f,
+    0.030044f,  0.075620f,  0.124107f,  0.102862f,  0.038235f,  0.001820f,
+    0.023708f,  0.050948f,  0.013104f,  -0.039643f, -0.019719f, 0.083434f,
+    0.145772f,  0.092624f,  0.021257f,  -0.036447f, -0.073926f, -0.036811f,
+    0.107099f,  0.346541f,  0.507519f,  0.354685f,  -0.060266f, -0.439413f,
+    -0.573922f, -0.505158f, -0.381417f, -0.162623f, 0.058510f,  0.129840f,
+    0.119348f,  0.080612f,  0.025885f,  -0.003791f, -0.020239f, 0.021435f,
+    0.058920f,  0.030316f,  0.069747f,  0.067890f,  0.034225f,  0.037731f,
+    -0.009745f, -0.011465f, -0.000256f, -0.040322f, -0.040036f, -0.017412f,
+    0.001606f,  0.052415f,  0.095644f,  0.068310f,  -0.282727f, -0.260306f,
+    -0.217301f, -0.136295f, -0.018960f, 0.059013f,  0.034891f,  -0.007812f,
+    0.038158f,  0.110840f,  0.113828f,  0.047490f,  -0.019372f, -0.034238f,
+    0.007139f,  0.103634f,  0.214233f,  0.228057f,  0.139362f,  0.029549f,
+    -0.036059f, -0.022912f, 0.031400f,  0.048849f,  0.054425f,  0.094401f,
+    0.164487f,  0.219126f,  0.181633f,  0.033114f,  -0.143999f, -0.264994f,
+    -0.289978f, -0.247043f, -0.206510f, -0.184655f, -0.178682f, -0.178415f,
+    -0.166029f, -0.110475f, -0.066489f, -0.018037f, -0.009223f, -0.078567f,
+    -0.086647f, -0.025106f, 0.026245f,  0.058950f,  0.091268f,  0.132146f,
+    0.150158f,  0.119052f,  0.124291f,  0.166754f,  0.148682f,  0.026810f,
+    -0.042073f, 0.205497f,  0.213702f,  0.066958f,  -0.093714f, -0.209736f,
+    -0.198018f, -0.138016f, -0.081881f, -0.069279f, -0.043516f, -0.017958f,
+    -0.035683f, -0.016431f, -0.008053f, -0.065294f, -0.091752f, -0.073850f,
+    -0.044011f, 0.029926f,  0.076991f,  0.088427f,  0.055193f,  0.026730f,
+    0.061260f,  0.078641f,  0.042318f,  0.079952f,  0.095369f,  0.077167f,
+    0.079667f,  0.044418f,  0.010893f,  0.046375f,  0.045067f,  0.033258f,
+    0.044205f,  0.104036f,  0.082934f,  0.079008f,  0.085187f,  0.080717f,
+    0.133097f,  0.171223f,  0.201435f,  0.206775f,  0.187152f,  0.186961f,
+    0.192757f,  0.245189f,  0.304426f,  0.259081f,  0.201328f,  0.169773f,
+    0.079644f,  0.022284f,  -0.340401f, -0.168656f, 0.065714f,  0.217261f,
+    0.226844f,  0.133693f,  0.026679f,  -0.011712f, -0.009329f, 0.007312f,
+    0.072550f,  0.139916f,  0.074168f,  -0.137828f, -0.283641f, -0.204142f,
+    0.051841f,  0.279251f,  0.222199f,  -0.098355f, -0.364867f, -0.356648f,
+    -0.119401f, 0.187558f,  0.372976f,  0.382666f,  0.272808f,  0.100808f,
+    -0.068452f, -0.175559f, -0.180389f, -0.091172f, -0.009626f, 0.035990f,
+    0.043580f,  0.011690f,  0.019585f,  0.035238f,  -0.008562f, -0.020117f,
+    -0.019346f, -0.054608f, -0.039433f, 0.034202f,  0.010515f,  -0.028774f,
+    -0.015730f, -0.007382f, -0.017677f, -0.009932f, -0.061273f, -0.012287f,
+    0.099566f,  0.093899f,  0.115545f,  0.401786f,  0.442406f,  0.438316f,
+    0.368175f,  0.278225f,  0.186368f,  0.074189f,  -0.004626f, -0.022327f,
+    0.016335f,  0.062260f,  0.106842f,  0.131669f,  0.100539f,  0.078764f,
+    0.096154f,  0.117538f,  0.147722f,  0.144805f,  0.131051f,  0.155164f,
+    0.170407f,  0.178094f,  0.184282f,  0.178686f,  0.178790f,  0.196088f,
+    0.214184f,  0.203806f,  0.169983f,  0.119795f,  0.130922f,  0.188920f,
+    0.128441f,  0.068987f,  0.113722f,  0.163475f,  0.180047f,  0.209849f,
+    0.216194f,  0.271269f,  0.284911f,  0.190607f,  0.257382f,  0.232485f,
+    0.241544f,  0.241168f,  0.292005f,  0.286028f,  0.276879f,  0.235822f,
+    0.247072f,  0.284596f,  0.189648f,  0.116309f,  0.117373f,  0.071993f,
+    -0.117342f, -0.228401f, -0.297266f, -0.266935f, -0.131009f, 0.091359f,
+    0.298241f,  0.409416f,  0.401959f,  0.325490f,  0.206163f,  0.009214f,
+    -0.250993f, -0.479679f, -0.585293f, -0.535056f, -0.331653f, -0.024374f,
+    0.233059f,  0.314559f,  0.255540f,  0.156032f,  0.066903f,  -0.001028f,
+    -0.034922f, -0.024010f, 0.011907f,  0.031846f,  0.033584f,  0.024002f,
+    0.009833f,  -0.002824f, 0.001307f,  0.034914f,  0.073175f,  0.071540f,
+    0.046785f,  0.008187f,  -0.072495f, -0.136190f, -0.134411f, -0.053008f,
+    -0.004341f, 0.021607f,  0.058586f,  0.103445f,  0.104734f,  0.049752f,
+    0.010277f,  0.026560f,  0.023135f,  -0.041028f, -0.079571f, -0.105850f,
+    -0.153037f, -0.213876f, 0.017142f,  0.003195f,  -0.007706f, 0.001240f,
+    0.007638f,  -0.012165f, -0.038802f, -0.029366f, 0.003337f,  0.021362f,
+    -0.012100f, -0.044997f, 0.001993f,  0.034179f,  -0.018816f, -0.063213f,
+    -0.022187f, 0.012642f,  0.005828f,  0.011434f,  -0.006909f, -0.036278f,
+    -0.038007f, -0.017340f, 0.034423f,  0.059047f,  0.046088f,  0.036077f,
+    0.034198f,  -0.001760f, -0.048746f, -0.059168f, -0.026397f, -0.028316f,
+    -0.071445f, -0.103739f, -0.107149f, -0.071520f, -0.011565f, 0.048477f,
+    0.104703f,  0.133293f,  0.135360f,  0.119186f,  0.102956f,  0.093033f,
+    0.022724f,  -0.096435f, -0.223630f, -0.267098f, -0.202866f, -0.132244f,
+    -0.104467f, -0.096215f, -0.117955f, -0.152986f, -0.596646f, -0.416902f,
+    -0.153345f, 0.121727f,  0.349983f,  0.467283f,  0.466422f,  0.384479f,
+    0.283751f,  0.178156f,  0.081178f,  0.038910f,  0.053345f,  0.052808f,
+    0.006184f,  -0.058944f, -0.140285f, -0.216235f, -0.281073f, -0.362450f,
+    -0.438706f, -0.425038f, -0.287207f, -0.098584f, 0.038495f,  0.075235f,
+    0.054134f,  0.028478f,  0.010847f,  -0.002796f, -0.023252f, -0.038694f,
+    -0.035146f, -0.028478f, -0.041686f, -0.043086f, 0.017458f,  0.066733f,
+    0.049455f,  0.015269f,  0.026219f,  0.029676f,  0.019000f,  0.014731f,
+    0.036667f,  0.046099f,  0.026002f,  -0.008908f, -0.063239f, -0.066136f,
+    0.002197f,  0.044324f,  0.007753f,  0.006404f,  0.014182f,  -0.025711f,
+    0.049186f,  0.021251f,  -0.005402f, -0.017752f, -0.022230f, -0.007045f,
+    0.008568f,  0.008896f,  0.003031f,  0.000668f,  -0.014252f, -0.045494f,
+    -0.083832f, -0.117173f, -0.119605f, -0.087098f, -0.047655f, 0.028876f,
+    0.140704f,  0.187844f,  0.138345f,  0.045729f,  -0.002321f, 0.022492f,
+    0.057340f,  0.073454f,  0.058632f,  0.016177f,  -0.008039f, -0.002319f,
+    0.000003f,  -0.018923f, -0.063373f, -0.136465f, -0.206021f, -0.242688f,
+    -0.275776f, -0.307361f, -0.211886f, -0.015054f, 0.103486f,  0.197560f,
+    0.239840f,  0.263328f,  0.319298f,  0.317585f,  0.289399f,  0.171150f,
+    0.001373f,  -0.138337f, -0.182292f, -0.149138f, -0.122593f, -0.171917f,
+    -0.125500f, 0.133939f,  -0.002748f, -0.002749f, -0.002748f, -0.002750f,
+    -0.002747f, -0.002751f, -0.002745f, -0.002752f, -0.002744f, -0.002754f,
+    -0.002743f, -0.002755f, -0.002741f, -0.002756f, -0.002741f, -0.002757f,
+    -0.002739f, -0.002758f, -0.002738f, -0.002759f, -0.002739f, -0.002758f,
+    -0.002740f, -0.002756f, -0.002742f, -0.002755f, -0.002742f, -0.002755f,
+    -0.002742f, -0.002754f, -0.002743f, -0.002753f, -0.002745f, -0.002751f,
+    -0.002747f, -0.002750f, -0.002747f, -0.002750f, -0.002747f, -0.002749f,
+    -0.002748f, -0.002748f, -0.002749f, -0.002747f, -0.002750f, -0.002746f,
+    -0.002751f, -0.002746f, -0.002751f, -0.002746f, -0.002751f, -0.002747f,
+    -0.002750f, -0.002747f, -0.002749f, -0.002748f, -0.053303f, -0.012012f,
+    0.033224f,  0.054787f,  0.036461f,  0.003352f,  -0.014761f, -0.014147f,
+    0.002446f,  0.027355f,  0.031703f,  0.004747f,  -0.026571f, -0.060743f,
+    -0.106011f, -0.128197f, -0.097546f, -0.040974f, 0.001001f,  0.026019f,
+    0.045559f,  0.047594f,  0.019842f,  -0.014092f, -0.018602f, 0.020720f,
+    0.075317f,  0.081919f,  0.028408f,  -0.035390f, -0.075837f, -0.047712f,
+    0.067320f,  0.194877f,  0.275839f,  0.273044f,  0.177044f,  0.013417f,
+    -0.153186f, -0.237283f, -0.284849f, -0.331428f, -0.280137f, -0.162687f,
+    0.000348f,  0.142432f,  0.124297f,  0.030340f,  0.007491f,  0.057957f,
+    0.084176f,  0.097732f,  0.113226f,  0.086856f,  0.088644f,  0.131924f,
+    -0.071827f, -0.028777f, -0.041184f, -0.076814f, -0.073882f, -0.051055f,
+    -0.043906f, -0.021905f, -0.002148f, -0.015849f, -0.044293f, -0.081878f,
+    -0.101983f, -0.077597f, -0.027965f, 0.014243f,  0.057371f,  0.096197f,
+    0.093562f,  0.059100f,  0.014297f,  -0.015482f, -0.006865f, 0.056791f,
+    0.121645f,  0.132572f,  0.116999f,  0.116269f,  0.113443f,  0.102584f,
+    0.089676f,  0.080956f,  0.102277f,  0.100776f,  0.135778f,  0.231858f,
+    0.230636f,  0.183637f,  0.143758f,  0.108696f,  0.068767f,  0.096780f,
+    0.176740f,  0.231706f,  0.238271f,  0.262504f,  0.257686f,  0.214827f,
+    0.237373f,  0.254061f,  0.320222f,  0.344048f,  0.337692f,  0.311095f,
+    0.246501f,  0.232382f,  0.150158f,  0.111785f,  0.031016f,  -0.040193f,
+    -0.094623f, -0.116788f, -0.072816f, -0.046071f, -0.084760f, -0.090625f,
+    -0.064291f, -0.050605f, -0.007765f, 0.031873f,  0.033480f,  0.036267f,
+    0.043627f,  0.046260f,  0.027868f,  0.013416f,  0.031291f,  0.070154f,
+    0.049315f,  -0.023325f, -0.038802f, 0.015969f,  0.063534f,  0.071400f,
+    0.044158f,  0.001710f,  -0.022777f, -0.015200f, -0.004666f, -0.026330f,
+    -0.039452f, 0.002059f,  0.038778f,  0.032199f,  -0.009873f, -0.049772f,
+    -0.094604f, -0.089760f, -0.021413f, 0.027186f,  0.101007f,  0.138626f,
+    0.103229f,  0.085746f,  0.103446f,  0.052518f,  0.025580f,  0.004069f,
+    -0.108301f, -0.185976f, -0.087055f, 0.013745f,  0.008984f,  0.009352f,
+    0.008093f,  -0.008347f, -0.023822f, -0.035431f, -0.031671f, -0.016956f,
+    0.002676f,  -0.007267f, -0.018567f, 0.003054f,  0.028954f,  0.022571f,
+    0.009841f,  0.015452f,  0.027188f,  0.012666f,  -0.009731f, -0.035317f,
+    -0.078100f, -0.086082f, -0.076555f, -0.099722f, -0.121043f, -0.104054f,
+    -0.077977f, -0.070988f, -0.072587f, -0.087895f, -0.123538f, -0.097316f,
+    -0.086540f, -0.083969f, -0.073734f, -0.122069f, -0.207042f, -0.284871f,
+    -0.356896f, -0.424601f, -0.460608f, -0.436289f, -0.354099f, -0.320698f,
+    -0.176636f, -0.069448f, -0.041017f, 0.022211f,  0.075334f,  0.055720f,
+    0.044921f,  -0.021460f, -0.115557f, -0.147703f, -0.178807f, -0.414658f,
+    0.251417f,  0.191014f,  0.120049f,  0.065399f,  0.040549f,  0.041682f,
+    0.046412f,  0.041818f,  0.008896f,  -0.014902f, -0.038036f, -0.067969f,
+    -0.084262f, -0.042454f, 0.072851f,  0.199514f,  0.204867f,  0.060871f,
+    -0.082580f, -0.109156f, -0.041064f, 0.019081f,  0.031090f,  0.027619f,
+    0.039228f,  0.048458f,  -0.004939f, -0.128457f, -0.236084f, -0.241834f,
+    -0.142189f, 0.016384f,  0.162733f,  0.241589f,  0.266613f,  0.268265f,
+    0.257182f,  0.226156f,  0.147991f,  0.061936f,  -0.037962f, -0.110553f,
+    -0.124871f, -0.123062f, -0.115434f, -0.070529f, 0.018216f,  0.103487f,
+    0.048708f,  0.011878f,  0.064439f,  0.040728f,  0.005441f,  0.017863f,
+    -0.115159f, -0.356494f, -0.106364f, -0.073227f, -0.030699f, -0.004499f,
+    0.000199f,  0.014717f,  0.072910f,  0.160614f,  0.204794f,  0.172810f,
+    0.074811f,  -0.033456f, -0.063209f, -0.012953f, 0.027956f,  -0.009854f,
+    -0.130522f, -0.309753f, -0.532494f, -0.742955f, -0.829978f, -0.718981f,
+    -0.447988f, -0.126506f, 0.143701f,  0.309350f,  0.322583f,  0.216677f,
+    0.102206f,  0.027694f,  0.006140f,  0.015923f,  0.023387f,  0.060668f,
+    0.066424f,  -0.007247f, -0.059114f, -0.064520f, -0.064344f, -0.032848f,
+    -0.037986f, -0.016185f, 0.009450f,  0.019450f,  0.029900f,  0.035203f,
+    0.031024f,  0.008125f,  -0.029628f, -0.039486f, -0.035576f, 0.003453f,
+    0.065598f,  0.070072f,  0.062947f,  0.098613f,  0.103603f,  0.134293f,
+    0.168404f,  0.192454f,  0.188228f,  0.139226f,  0.059109f,  0.010891f,
+    0.020550f,  0.040908f,  0.065372f,  0.099196f,  0.119607f,  0.101567f,
+    0.059507f,  -0.015704f, -0.110753f, -0.158413f, -0.117421f, -0.001902f,
+    0.097768f,  0.090083f,  -0.004282f, -0.098835f, -0.154900f, -0.179926f,
+    -0.168050f, -0.090354f, 0.049364f,  0.202317f,  0.301110f,  0.319416f,
+    0.301918f,  0.259464f,  0.214086f,  0.199737f,  0.183351f,  0.088055f,
+    -0.061185f, -0.125571f, -0.092553f, -0.038682f, -0.045873f, -0.040213f,
+    -0.029295f, -0.062042f, -0.048701f, 0.001520f,  -0.027802f, -0.062494f,
+    -0.018282f, 0.057096f,  0.056971f,  0.015660f,  0.040822f,  0.116159f,
+    -0.006632f, -0.013571f, -0.040208f, -0.079661f, -0.113669f, -0.127139f,
+    -0.108683f, -0.071652f, -0.023850f, 0.024374f,  0.054394f,  0.088116f,
+    0.134859f,  0.155576f,  0.146701f,  0.134241f,  0.104282f,  0.055475f,
+    0.030077f,  0.038977f,  0.057011f,  0.067223f,  0.074856f,  0.072261f,
+    0.045446f,  0.011964f,  -0.008643f, -0.008381f, 0.015463f,  0.042928f,
+    0.051708f,  0.046121f,  0.037810f,  0.033528f,  0.063401f,  0.116732f,
+    0.094777f,  -0.034275f, -0.171063f, -0.276543f, -0.246910f, -0.091428f,
+    -0.007733f, 0.076579f,  0.174885f,  0.230276f,  0.281151f,  0.287099f,
+    0.196143f,  0.082392f,  0.032772f,  -0.023479f, -0.083397f, -0.090700f,
+    -0.021824f, 0.084239f,  -0.223712f, -0.170707f, -0.078723f, 0.005393f,
+    0.038989f,  0.049932f,  0.065318f,  0.062593f,  0.058509f,  0.062354f,
+    0.100480f,  0.145591f,  0.146721f,  0.085114f,  0.047710f,  0.117804f,
+    0.206762f,  0.221372f,  0.173728f,  0.097542f,  -0.015603f, -0.158535f,
+    -0.268436f, -0.317752f, -0.283798f, -0.162571f, -0.017162f, 0.065175f,
+    0.040353f,  -0.023628f, -0.058756f, -0.067067f, -0.076629f, -0.120942f,
+    -0.145871f, -0.130873f, -0.093148f, -0.037704f, 0.002832f,  0.009566f,
+    0.028326f,  0.038297f,  0.007174f,  -0.008979f, -0.009405f, 0.006356f,
+    0.055857f,  0.086991f,  0.090019f,  0.026334f,  0.005206f,  0.042352f,
+    0.050485f,  0.001728f,  0.006130f,  0.021820f,  0.213093f,  0.028610f,
+    -0.210953f, -0.421346f, -0.552163f, -0.582717f, -0.507545f, -0.364580f,
+    -0.237537f, -0.186661f, -0.197987f, -0.189688f, -0.105019f, 0.059555f,
+    0.177198f,  0.114985f,  -0.076396f, -0.206009f, -0.156273f, 0.014549f,
+    0.166108f,  0.191439f,  0.100104f,  -0.001767f, -0.027597f, -0.011279f,
+    -0.022407f, -0.043756f, -0.005471f, 0.083310f,  0.182026f,  0.250513f,
+    0.259890f,  0.199497f,  0.074612f,  -0.055255f, -0.128038f, -0.133076f,
+    -0.064147f, 0.040161f,  0.104442f,  0.109932f,  0.082766f,  0.063368f,
+    0.006115f,  -0.102763f, -0.210484f, -0.189033f, -0.144925f, -0.117106f,
+    -0.030072f, 0.061640f,  0.111762f,  0.170652f,  0.246403f,  0.345126f,
+    0.140454f,  0.101332f,  0.041129f,  -0.025470f, -0.068850f, -0.053548f,
+    -0.032286f, -0.015330f, 0.026973f,  0.035422f,  -0.033358f, -0.081928f,
+    -0.027327f, 0.107172f,  0.163841f,  0.069634f,  -0.064761f, -0.110551f,
+    -0.055304f, 0.008701f,  0.032757f,  0.022168f,  -0.018121f, -0.041676f,
+    -0.013486f, 0.012534f,  -0.007116f, -0.034545f, -0.033041f, -0.028209f,
+    -0.029898f, -0.052601f, -0.100293f, -0.169444f, -0.192876f, -0.167172f,
+    -0.182371f, -0.160370f, -0.064807f, 0.009205f,  0.115093f,  0.225596f,
+    0.257783f,  0.306999f,  0.306501f,  0.217401f,  0.115671f,  -0.040575f,
+    -0.160563f, -0.270188f, -0.305592f, -0.195813f, -0.025400f, 0.039206f,
+    0.120793f,  0.398094f,  0.553691f,  0.510237f,  0.395846f,  0.230199f,
+    0.069902f,  -0.018829f, -0.004024f, 0.023452f,  0.005019f,  -0.031398f,
+    -0.061062f, -0.076865f, -0.044279f, 0.022851f,  0.057743f,  0.038697f,
+    -0.013214f, -0.039399f, -0.002149f, 0.073541f,  0.118387f,  0.103675f,
+    0.049447f,  -0.005601f, -0.052222f, -0.104192f, -0.156017f, -0.195131f,
+    -0.205073f, -0.180933f, -0.149910f, -0.119722f, -0.084696f, -0.068447f,
+    -0.070636f, -0.064061f, -0.075228f, -0.073236f, -0.033740f, -0.003882f,
+    0.016230f,  0.024198f,  0.030256f,  0.015483f,  -0.037869f, -0.038504f,
+    -0.077636f, -0.081722f, -0.049134f, -0.059708f, -0.057014f, -0.014443f,
+    0.040350f,  0.018639f,  -0.007112f, 0.066882f,  0.336494f,  0.168641f,
+    0.026921f,  -0.046437f, -0.049618f, -0.056122f, -0.059221f, -0.075437f,
+    -0.110750f, -0.124831f, -0.117041f, -0.109313f, -0.105104f, -0.111954f,
+    -0.138086f, -0.150907f, -0.111064f, -0.068940f, -0.067001f, -0.076466f,
+    -0.113932f, -0.187147f, -0.163610f, -0.045416f, 0.009865f,  -0.042562f,
+    -0.083727f, -0.046490f, 0.007690f,  0.029867f,  0.027567f,  0.047469f,
+    0.063288f,  0.039345f,  -0.015069f, -0.030211f, -0.037603f, -0.016185f,
+    0.058179f,  0.133900f,  0.106829f,  0.074712f,  0.033503f,  -0.051206f,
+    -0.097151f, -0.171452f, -0.195816f, -0.172246f, -0.171415f, -0.193490f,
+    -0.127767f, -0.077338f, -0.054332f, 0.019401f,  0.125956f,  0.031187f,
+    -0.028717f, 0.011333f,  0.078278f,  0.118120f,  0.111586f,  0.071010f,
+    0.014458f,  -0.056368f, -0.098945f, -0.059710f, 0.023085f,  0.080419f,
+    0.109940f,  0.109636f,  0.067256f,  0.000166f,  -0.083694f, -0.137157f,
+    -0.102292f, -0.014842f, 0.010753f,  -0.071207f, -0.202582f, -0.299219f,
+    -0.319310f, -0.287942f, -0.243594f, -0.160931f, 0.003584f,  0.124993f,
+    0.173895f,  0.147431f,  0.077587f,  0.028582f,  0.015054f,  0.042339f,
+    0.041900f,  -0.005652f, -0.015594f, 0.040630f,  0.026511f,  -0.029995f,
+    -0.054198f, -0.012080f, 0.018961f,  -0.009725f, -0.037750f, -0.001480f,
+    0.034960f,  -0.019934f, -0.098837f, -0.039615f, -0.005120f, -0.085296f,
+    0.011606f,  0.414287f,  -0.099005f, -0.049197f, 0.022534f,  0.076729f,
+    0.100567f,  0.091570f,  0.064467f,  0.037947f,  0.010035f,  -0.048580f,
+    -0.090271f, -0.067113f, -0.003839f, 0.032402f,  0.034969f,  0.033901f,
+    0.040253f,  0.022039f,  -0.019006f, -0.010800f, 0.058799f,  0.098995f,
+    0.025584f,  -0.175897f, -0.442472f, -0.685452f, -0.837551f, -0.863050f,
+    -0.764223f, -0.539862f, -0.237025f, 0.039123f,  0.192035f,  0.209688f,
+    0.129740f,  0.035331f,  -0.009083f, -0.005833f, 0.030186f,  0.043562f,
+    0.055206f,  0.039021f,  0.039252f,  0.084532f,  0.070311f,  0.062932f,
+    0.065433f,  0.094284f,  0.060981f,  0.048439f,  0.035668f,  0.039436f,
+    0.054011f,  0.009470f,  -0.046758f, -0.014297f, 0.426593f,  0.240229f,
+    -0.026329f, -0.313825f, -0.589602f, -0.744582f, -0.692201f, -0.427642f,
+    -0.057468f, 0.291330f,  0.534097f,  0.605848f,  0.493433f,  0.274726f,
+    0.094602f,  0.006107f,  -0.058505f, -0.129255f, -0.186867f, -0.180098f,
+    -0.099295f, -0.018427f, 0.016656f,  0.025369f,  0.044640f,  0.071347f,
+    0.072163f,  0.049803f,  0.051934f,  0.079583f,  0.085757f,  0.067453f,
+    0.032299f,  0.020990f,  0.027929f,  0.019394f,  0.065810f,  0.123206f,
+    0.081580f,  0.018699f,  0.019869f,  0.031326f,  0.025012f,  -0.017997f,
+    -0.021657f, -0.058435f, -0.111342f, -0.079820f, -0.017680f, 0.017183f,
+    0.021527f,  0.038148f,  0.033480f,  -0.048952f, -0.075826f, -0.124674f,
+    -0.002182f, -0.002196f, -0.002180f, -0.002199f, -0.002175f, -0.002205f,
+    -0.002170f, -0.002209f, -0.002166f, -0.002212f, -0.002164f, -0.002214f,
+    -0.002162f, -0.002217f, -0.002158f, -0.002221f, -0.002153f, -0.002228f,
+    -0.002144f, -0.002237f, -0.002135f, -0.002246f, -0.002127f, -0.002252f,
+    -0.002125f, -0.002250f, -0.002131f, -0.002240f, -0.002143f, -0.002226f,
+    -0.002158f, -0.002211f, -0.002173f, -0.002196f, -0.002189f, -0.002180f,
+    -0.002205f, -0.002162f, -0.002223f, -0.002145f, -0.002240f, -0.002130f,
+    -0.002253f, -0.002120f, -0.002259f, -0.002116f, -0.002260f, -0.002118f,
+    -0.002256f, -0.002125f, -0.002245f, -0.002139f, -0.002230f, -0.002154f,
+    -0.002218f, -0.002164f, -0.039761f, -0.032504f, -0.026007f, -0.011754f,
+    0.015558f,  0.051410f,  0.087161f,  0.119281f,  0.143731f,  0.151257f,
+    0.105732f,  -0.025721f, -0.185089f, -0.260990f, -0.192869f, -0.036211f,
+    0.078710f,  0.045974f,  -0.102079f, -0.232779f, -0.249056f, -0.166620f,
+    -0.079829f, -0.048751f, -0.042700f, -0.030277f, -0.021874f, -0.020621f,
+    -0.008856f, 0.021862f,  0.035667f,  0.010314f,  -0.077607f, -0.204455f,
+    -0.262942f, -0.224962f, -0.170005f, -0.054697f, 0.158559f,  0.337208f,
+    0.348099f,  0.287464f,  0.213875f,  0.154345f,  0.038838f,  -0.106492f,
+    -0.129700f, -0.083157f, -0.101215f, -0.092349f, -0.062689f, -0.150117f,
+    -0.264249f, -0.281621f, -0.383109f, -0.610011f, -0.000927f, -0.000977f,
+    -0.000927f, -0.000972f, -0.000933f, -0.000965f, -0.000941f, -0.000958f,
+    -0.000946f, -0.000954f, -0.000949f, -0.000953f, -0.000949f, -0.000954f,
+    -0.000947f, -0.000956f, -0.000945f, -0.000959f, -0.000942f, -0.000960f,
+    -0.000942f, -0.000960f, -0.000943f, -0.000957f, -0.000948f, -0.000951f,
+    -0.000954f, -0.000944f, -0.000962f, -0.000936f, -0.000970f, -0.000928f,
+    -0.000979f, -0.000919f, -0.000987f, -0.000911f, -0.000994f, -0.000906f,
+    -0.000997f, -0.000905f, -0.000998f, -0.000903f, -0.001000f, -0.000901f,
+    -0.001002f, -0.000900f, -0.001002f, -0.000901f, -0.001000f, -0.000903f,
+    -0.000998f, -0.000906f, -0.000995f, -0.000908f, -0.000993f, -0.000914f,
+    0.188014f,  0.170845f,  0.164867f,  0.140354f,  0.111469f,  0.100209f,
+    0.074670f,  0.044467f,  0.044374f,  0.020433f,  -0.000735f, 0.010137f,
+    0.009456f,  -0.021091f, -0.021481f, -0.003927f, -0.019265f, -0.041121f,
+    -0.038494f, -0.028295f, -0.023254f, -0.004234f, 0.002076f,  -0.011968f,
+    -0.020688f, -0.026197f, -0.018353f, 0.021523f,  0.070449f,  0.075814f,
+    0.041794f,  0.046545f,  0.034788f,  0.096443f,  0.130606f,  0.119577f,
+    0.117423f,  0.176763f,  0.217700f,  0.147574f,  0.152401f,  0.087898f,
+    0.092253f,  0.079216f,  0.073348f,  0.079974f,  0.084639f,  0.088214f,
+    0.056947f,  0.012480f,  -0.066631f, -0.009809f, -0.028440f, -0.087236f,
+    0.009917f,  -0.001329f, -0.205939f, -0.129632f, -0.043406f, 0.047295f,
+    0.116516f,  0.135773f,  0.116684f,  0.092310f,  0.049213f,  -0.006772f,
+    -0.025751f, 0.019176f,  0.064724f,  0.054802f,  0.014710f,  0.021533f,
+    0.094554f,  0.141968f,  0.097005f,  0.007682f,  -0.041644f, -0.017819f,
+    0.038985f,  0.101594f,  0.141244f,  0.130309f,  0.063326f,  -0.013560f,
+    -0.041225f, -0.026241f, -0.005655f, -0.028902f, -0.040826f, 0.037827f,
+    0.148766f,  0.227482f,  0.258039f,  0.211318f,  0.189841f,  0.215540f,
+    0.221969f,  0.183972f,  0.104844f,  0.059964f,  0.025575f,  -0.109593f,
+    -0.260781f, -0.300025f, -0.191437f, -0.198871f, -0.254838f, -0.104301f,
+    0.035588f,  -0.024841f, -0.075490f, 0.068460f,  0.190158f,  0.154554f,
+    0.103072f,  0.032961f,  -0.056120f, -0.151397f, -0.227492f, -0.257755f,
+    -0.249198f, -0.244383f, -0.262005f, -0.248095f, -0.159537f, -0.000763f,
+    0.145580f,  0.176839f,  0.097381f,  -0.008061f, -0.094268f, -0.123686f,
+    -0.054696f, 0.104126f,  0.273998f,  0.370243f,  0.341484f,  0.201488f,
+    0.026569f,  -0.120214f, -0.208792f, -0.206084f, -0.144428f, -0.063943f,
+    0.025147f,  0.113144f,  0.154914f,  0.169310f,  0.182097f,  0.187624f,
+    0.137411f,  0.051196f,  -0.036649f, -0.106678f, -0.147933f, -0.127712f,
+    -0.106919f, -0.118552f, -0.086771f, -0.018790f, 0.022381f,  0.017128f,
+    -0.018186f, -0.034639f, 0.036970f,  0.137153f,  0.176708f,  0.161056f,
+    -0.018017f, -0.054055f, -0.080206f, -0.088158f, -0.061915f, -0.009586f,
+    0.038687f,  0.055510f,  0.059477f,  0.079642f,  0.121381f,  0.165524f,
+    0.162525f,  0.076128f,  -0.021296f, -0.035975f, 0.029178f,  0.104949f,
+    0.119899f,  0.090349f,  0.067428f,  0.058158f,  0.052522f,  0.054020f,
+    0.068183f,  0.078127f,  0.075144f,  0.058481f,  0.027311f,  0.030593f,
+    0.074241f,  0.107244f,  0.104218f,  0.084192f,  0.046499f,  0.017750f,
+    0.024869f,  0.073873f,  0.126320f,  0.211070f,  0.358928f,  0.389914f,
+    0.351347f,  0.337684f,  0.307574f,  0.261308f,  0.181715f,  0.132556f,
+    0.031878f,  -0.035998f, -0.058247f, -0.050317f, -0.114692f, -0.115054f,
+    -0.091164f, -0.199839f, 0.018856f,  -0.095756f, -0.163957f, -0.114302f,
+    0.032799f,  0.190299f,  0.238588f,  0.139855f,  -0.018383f, -0.171408f,
+    -0.259496f, -0.193870f, -0.013178f, 0.137167f,  0.200965f,  0.253250f,
+    0.304951f,  0.271385f,  0.140745f,  -0.011873f, -0.150102f, -0.305625f,
+    -0.480531f, -0.599301f, -0.558089f, -0.338013f, -0.044136f, 0.182694f,
+    0.270780f,  0.244063f,  0.147737f,  0.050704f,  -0.005084f, -0.052493f,
+    -0.069483f, -0.006521f, 0.099982f,  0.160549f,  0.182253f,  0.204297f,
+    0.176653f,  0.063538f,  -0.070861f, -0.107322f, -0.104471f, -0.115065f,
+    -0.066939f, -0.043970f, -0.027656f, 0.064548f,  0.091492f,  0.054604f,
+    0.042269f,  0.029964f,  -0.008176f, -0.033585f, -0.145766f, -0.125622f,
+    -0.063351f, 0.009242f,  0.071473f,  0.094686f,  0.077757f,  0.040568f,
+    0.015972f,  0.024272f,  0.019423f,  0.033425f,  0.072770f,  0.064439f,
+    -0.002619f, -0.081579f, -0.107078f, -0.041194f, 0.044406f,  0.065513f,
+    0.025057f,  -0.012185f, 0.008578f,  0.017978f,  -0.047949f, -0.110452f,
+    -0.102573f, -0.066456f, -0.045123f, -0.009986f, 0.030468f,  0.044065f,
+    0.037447f,  0.028859f,  0.049884f,  0.082035f,  0.055412f,  -0.027399f,
+    -0.114980f, -0.241794f, -0.340721f, -0.306282f, -0.229168f, -0.222398f,
+    -0.244745f, -0.191716f, -0.035870f, 0.012139f,  0.002149f,  -0.018464f,
+    -0.087955f, -0.113129f, -0.035275f, -0.071344f, -0.095205f, 0.024625f,
+    -0.027989f, 0.014173f,  0.025367f,  0.008770f,  0.003275f,  0.020800f,
+    0.056423f,  0.069272f,  0.023446f,  -0.071901f, -0.153865f, -0.147225f,
+    -0.074200f, -0.001625f, 0.041596f,  0.039647f,  -0.012350f, -0.103450f,
+    -0.156989f, -0.100279f, 0.020296f,  0.090688f,  0.071775f,  0.009270f,
+    -0.037179f, -0.048659f, -0.033561f, 0.000062f,  0.026939f,  0.025048f,
+    0.024888f,  0.037558f,  0.028421f,  0.004958f,  -0.018587f, -0.023948f,
+    -0.036186f, -0.062687f, -0.071310f, -0.115527f, -0.155809f, -0.180349f,
+    -0.187091f, -0.135381f, -0.004193f, 0.204169f,  0.402876f,  0.522058f,
+    0.466345f,  0.269143f,  0.114981f,  -0.065020f, -0.216593f, -0.205623f,
+    -0.208338f, -0.347970f, 0.073747f,  -0.046860f, -0.138090f, -0.146623f,
+    -0.080999f, -0.000167f, 0.018974f,  -0.025801f, -0.046265f, -0.018905f,
+    0.012728f,  0.033335f,  0.021004f,  -0.045095f, -0.101285f, -0.082450f,
+    -0.012867f, 0.035324f,  0.052367f,  0.028499f,  -0.017702f, -0.032098f,
+    -0.047817f, -0.068928f, -0.045950f, -0.029400f, -0.059161f, -0.075864f,
+    -0.026389f, -0.003671f, -0.032060f, -0.025981f, -0.011261f, -0.010783f,
+    0.008537f,  0.073264f,  0.189819f,  0.269084f,  0.300537f,  0.217657f,
+    0.143124f,  0.026577f,  -0.038156f, -0.097048f, -0.160456f, -0.198687f,
+    -0.164734f, -0.116685f, -0.002559f, 0.050258f,  0.098439f,  0.222994f,
+    0.313134f,  0.276918f,  0.277550f,  0.498366f,  0.234759f,  0.196243f,
+    0.104663f,  -0.004060f, -0.097755f, -0.136304f, -0.085904f, -0.014032f,
+    0.007297f,  -0.012401f, -0.004792f, 0.015684f,  0.027559f,  0.044034f,
+    0.090754f,  0.114323f,  0.048955f,  -0.017591f, 0.012134f,  0.076190f,
+    0.070909f,  0.017523f,  -0.007256f, 0.025028f,  0.075508f,  0.084191f,
+    0.034710f,  -0.025070f, -0.066405f, -0.080443f, -0.122837f, -0.180291f,
+    -0.231131f, -0.284286f, -0.337490f, -0.374921f, -0.397510f, -0.413815f,
+    -0.425787f, -0.421009f, -0.386124f, -0.340013f, -0.263425f, -0.151025f,
+    -0.070507f, -0.019212f, 0.071640f,  0.151482f,  0.171299f,  0.241614f,
+    0.249703f,  0.209843f,  0.166672f,  0.095612f,  -0.023868f, -0.104594f,
+    -0.047055f, 0.066999f,  0.153813f,  0.169425f,  0.120934f,  0.021058f,
+    -0.073136f, -0.091744f, -0.038509f, -0.004218f, -0.001090f, -0.013774f,
+    -0.050048f, -0.069265f, -0.029658f, 0.029583f,  0.048083f,  0.036576f,
+    0.039124f,  0.023399f,  -0.023263f, -0.033737f, 0.024907f,  0.111067f,
+    0.159446f,  0.126879f,  0.048283f,  -0.006002f, 0.004484f,  0.067616f,
+    0.113130f,  0.142580f,  0.163928f,  0.159524f,  0.183208f,  0.190377f,
+    0.112326f,  -0.023933f, -0.150744f, -0.159639f, -0.118727f, -0.075942f,
+    -0.068221f, -0.094146f, -0.094152f, -0.031984f, -0.056357f, -0.075008f,
+    -0.068473f, -0.059181f, 0.004353f,  0.106117f,  0.243749f,  0.301208f,
+    0.293667f,  0.248448f,  0.018755f,  -0.017105f, -0.059883f, -0.081304f,
+    -0.058692f, -0.018882f, 0.012282f,  0.004457f,  -0.009887f, 0.027785f,
+    0.082045f,  0.068628f,  -0.015842f, -0.125175f, -0.159736f, -0.074409f,
+    0.031889f,  0.033386f,  -0.032357f, -0.032892f, 0.017815f,  0.024648f,
+    0.007732f,  0.002599f,  -0.011393f, -0.023167f, -0.004676f, 0.006455f,
+    -0.029710f, -0.008872f, 0.024488f,  0.020203f,  0.007894f,  0.004534f,
+    0.027132f,  0.115230f,  0.099093f,  0.057195f,  0.073228f,  -0.043707f,
+    -0.094110f, 0.061874f,  0.111337f,  -0.013144f, -0.109407f, 0.022405f,
+    0.145961f,  -0.019686f, -0.336467f, -0.134202f, 0.389184f,  0.344266f,
+    0.062929f,  0.009217f,  -0.491589f, -1.237970f, 0.089943f,  0.091347f,
+    0.079197f,  0.013205f,  -0.064692f, -0.124009f, -0.177453f, -0.196182f,
+    -0.202486f, -0.205427f, -0.121939f, 0.072337f,  0.241991f,  0.261074f,
+    0.131799f,  -0.042362f, -0.073717f, 0.117153f,  0.304780f,  0.237707f,
+    -0.049729f, -0.334038f, -0.407663f, -0.232342f, 0.000947f,  0.111342f,
+    0.118216f,  0.095981f,  0.058707f,  0.011039f,  -0.019270f, -0.012153f,
+    -0.007213f, -0.019986f, -0.033476f, -0.057180f, -0.071620f, -0.060403f,
+    -0.046574f, -0.018939f, 0.016880f,  0.015287f,  -0.017761f, -0.041562f,
+    -0.052276f, -0.057911f, -0.053508f, -0.018331f, 0.023617f,  -0.015687f,
+    -0.092444f, -0.045645f, -0.013738f, -0.078027f, -0.085015f, 0.035227f,
+    -0.018026f, 0.040375f,  0.004314f,  0.009721f,  0.010669f,  -0.033740f,
+    -0.029797f, 0.002793f,  0.007582f,  0.019321f,  0.028038f,  -0.011890f,
+    -0.045857f, -0.050073f, -0.028310f, 0.017894f,  0.044282f,  0.013400f,
+    -0.026805f, -0.011131f, -0.006351f, 0.010608f,  0.040167f,  0.002723f,
+    -0.036606f, -0.005303f, 0.051742f,  0.057616f,  -0.002910f, -0.023866f,
+    0.033142f,  0.090093f,  0.111334f,  0.131787f,  0.100753f,  0.010852f,
+    -0.065565f, -0.083525f, -0.032357f, 0.038638f,  0.061854f,  0.017349f,
+    -0.045081f, -0.079753f, -0.086872f, -0.120291f, -0.227502f, -0.398353f,
+    -0.577753f, -0.774668f, -1.002663f, -1.223362f, -1.368793f, -1.368755f,
+    -1.369101f, -1.500968f, -0.002352f, -0.002498f, -0.002343f, -0.002499f,
+    -0.002343f, -0.002498f, -0.002347f, -0.002491f, -0.002357f, -0.002476f,
+    -0.002375f, -0.002457f, -0.002394f, -0.002439f, -0.002407f, -0.002435f,
+    -0.002404f, -0.002442f, -0.002397f, -0.002444f, -0.002403f, -0.002431f,
+    -0.002419f, -0.002415f, -0.002432f, -0.002406f, -0.002436f, -0.002407f,
+    -0.002432f, -0.002413f, -0.002426f, -0.002418f, -0.002423f, -0.002420f,
+    -0.002423f, -0.002418f, -0.002426f, -0.002413f, -0.002431f, -0.002408f,
+    -0.002434f, -0.002409f, -0.002429f, -0.002419f, -0.002414f, -0.002435f,
+    -0.002401f, -0.002441f, -0.002405f, -0.002430f, -0.002419f, -0.002418f,
+    -0.002427f, -0.002414f, -0.002427f, -0.002415f, 0.218460f,  0.087434f,
+    -0.064408f, -0.174891f, -0.210986f, -0.167420f, -0.070714f, 0.064067f,
+    0.169671f,  0.179582f,  0.087469f,  -0.045219f, -0.150405f, -0.206267f,
+    -0.213357f, -0.152547f, -0.016973f, 0.140069f,  0.245578f,  0.278340f,
+    0.237719f,  0.128572f,  -0.012333f, -0.152920f, -0.248299f, -0.261468f,
+    -0.217020f, -0.164197f, -0.111299f, -0.026215f, 0.106074f,  0.257746f,
+    0.350426f,  0.287179f,  0.107055f,  -0.007369f, -0.022341f, -0.028451f,
+    -0.038063f, -0.045326f, -0.056450f, 0.001190f,  0.068710f,  0.063056f,
+    -0.012110f, -0.103696f, -0.132390f, -0.131006f, -0.079001f, -0.004727f,
+    -0.017800f, 0.014512f,  0.148659f,  0.116586f,  0.007506f,  0.015498f,
+    -0.617936f, -0.578631f, -0.496633f, -0.371190f, -0.219521f, -0.076587f,
+    0.034798f,  0.098993f,  0.124806f,  0.114483f,  0.092892f,  0.095601f,
+    0.107339f,  0.107054f,  0.097931f,  0.088265f,  0.095191f,  0.118375f,
+    0.148909f,  0.182807f,  0.149595f,  0.013270f,  -0.102161f, -0.101815f,
+    -0.046452f, -0.013975f, -0.008910f, -0.015729f, -0.031587f, -0.036181f,
+    -0.039325f, -0.104234f, -0.208580f, -0.256627f, -0.195186f, -0.022882f,
+    0.145183f,  0.249178f,  0.293536f,  0.252843f,  0.195034f,  0.190020f,
+    0.149179f,  0.053367f,  -0.052917f, -0.111859f, -0.081915f, -0.073281f,
+    -0.078972f, -0.003753f, 0.059941f,  0.061065f,  0.088042f,  0.124134f,
+    0.062137f,  -0.011177f, 0.203448f,  0.148410f,  0.018399f,  -0.051767f,
+    -0.044797f, -0.038960f, -0.027015f, -0.007423f, -0.002370f, -0.001956f,
+    -0.003050f, -0.024249f, -0.027751f, -0.002537f, -0.026025f, -0.053768f,
+    -0.026265f, -0.007131f, -0.009524f, 0.000375f,  -0.002501f, -0.003208f,
+    -0.028004f, -0.071106f, -0.064265f, -0.049898f, -0.082210f, -0.093773f,
+    -0.030732f, 0.035296f,  0.053161f,  0.002754f,  -0.063012f, -0.064984f,
+    -0.042941f, -0.013664f, 0.022515f,  0.001253f,  -0.045954f, -0.030938f,
+    -0.015647f, -0.007171f, 0.033232f,  0.064734f,  0.086828f,  0.080108f,
+    -0.032455f, -0.121473f, -0.158020f, -0.275849f, -0.372411f, -0.445382f,
+    -0.527190f, -0.293121f, -0.055301f, -0.072197f, 0.159409f,  -0.017023f,
+    -0.171108f, -0.206558f, -0.100226f, 0.076007f,  0.158720f,  0.081708f,
+    -0.038959f, -0.057968f, -0.014284f, 0.010358f,  0.032140f,  0.112901f,
+    0.181995f,  0.156224f,  0.036469f,  -0.104058f, -0.123533f, 0.005150f,
+    0.175079f,  0.260567f,  0.190876f,  0.043567f,  -0.041996f, -0.045357f,
+    -0.049749f, -0.084380f, -0.060221f, 0.015044f,  -0.001179f, -0.058694f,
+    -0.145415f, -0.248370f, -0.196513f, -0.053245f, 0.044323f,  0.086868f,
+    0.085334f,  0.057149f,  0.070541f,  0.000262f,  -0.050175f, -0.012714f,
+    -0.037430f, -0.003920f, -0.013492f, -0.005302f, 0.016722f,  0.051758f,
+    0.044673f,  -0.002409f, -0.052883f, -0.041347f, -0.021832f, -0.087302f,
+    -0.158824f, -0.147066f, -0.138383f, -0.123364f, -0.081425f, -0.021980f,
+    0.034386f,  0.076536f,  0.086465f,  0.077844f,  0.054461f,  0.007671f,
+    -0.004783f, 0.036961f,  0.060886f,  0.054667f,  0.064339f,  0.042369f,
+    -0.045552f, -0.122689f, -0.109649f, -0.001349f, 0.104916f,  0.134190f,
+    0.113719f,  0.065940f,  -0.004252f, -0.053741f, -0.051995f, -0.029050f,
+    -0.005877f, 0.009737f,  0.015941f,  -0.011777f, -0.014347f, 0.085921f,
+    0.084206f,  0.001582f,  0.027691f,  0.035709f,  -0.011656f, 0.079255f,
+    0.209166f,  0.067416f,  -0.310091f, -0.287322f, 0.076285f,  0.329174f,
+    0.306084f,  0.088492f,  -0.164694f, -0.403880f, -0.376675f, -0.186383f,
+    -0.204040f, -0.447459f, -0.108794f, -0.070846f, -0.038545f, -0.024420f,
+    -0.023768f, -0.075956f, -0.161891f, -0.177914f, -0.109558f, -0.043894f,
+    0.007813f,  0.025370f,  0.000993f,  -0.007862f, 0.025592f,  0.047694f,
+    0.036810f,  0.021643f,  0.007230f,  -0.006648f, -0.005675f, 0.035512f,
+    0.089435f,  0.072591f,  -0.017949f, -0.118107f, -0.193508f, -0.218591f,
+    -0.209796f, -0.224021f, -0.298822f, -0.427482f, -0.587255f, -0.764453f,
+    -0.918708f, -1.002583f, -1.003458f, -0.937864f, -0.852448f, -0.762594f,
+    -0.689695f, -0.628126f, -0.505834f, -0.354675f, -0.210095f, -0.084165f,
+    -0.017464f, -0.019051f, -0.034629f, 0.022435f,  0.067818f,  0.081381f,
+    0.075618f,  0.061071f,  0.005642f,  -0.088537f, 0.283238f,  0.277561f,
+    0.246090f,  0.166719f,  0.048971f,  -0.075512f, -0.182520f, -0.269546f,
+    -0.344186f, -0.409076f, -0.448568f, -0.465438f, -0.479690f, -0.498277f,
+    -0.500106f, -0.477152f, -0.441768f, -0.392369f, -0.320990f, -0.242131f,
+    -0.170466f, -0.105210f, -0.038374f, 0.026665f,  0.074340f,  0.092803f,
+    0.080693f,  0.045938f,  0.007937f,  -0.017097f, -0.015667f, -0.003759f,
+    0.010163f,  0.029571f,  0.052477f,  0.050424f,  0.020841f,  0.020114f,
+    0.055963f,  0.076716f,  0.090536f,  0.101887f,  0.096795f,  0.099862f,
+    0.111867f,  0.141356f,  0.152737f,  0.071112f,  -0.032967f, -0.094534f,
+    -0.095537f, -0.096947f, -0.121359f, -0.151644f, -0.264236f, -0.443817f,
+    -0.323180f, -0.265371f, -0.206061f, -0.201340f, -0.232368f, -0.254275f,
+    -0.239866f, -0.208267f, -0.185387f, -0.187474f, -0.159835f, -0.116749f,
+    -0.138409f, -0.224735f, -0.244297f, -0.158908f, -0.077021f, -0.038073f,
+    -0.030039f, -0.059708f, -0.066374f, -0.027426f, 0.006384f,  0.001440f,
+    -0.033818f, -0.063371f, -0.051607f, 0.011151f,  0.104668f,  0.180643f,
+    0.212287f,  0.175952f,  0.110387f,  0.071439f,  0.029497f,  -0.026066f,
+    -0.074383f, -0.062468f, -0.045470f, -0.100215f, -0.127694f, -0.111873f,
+    -0.090691f, -0.034223f, -0.001883f, 0.012094f,  0.054075f,  0.067894f,
+    0.060247f,  0.088158f,  0.107981f,  0.035937f,  -0.046551f, -0.021415f,
+    -0.017787f, -0.144939f, 0.132295f,  0.053686f,  -0.054340f, -0.136171f,
+    -0.146151f, -0.107414f, -0.058039f, 0.003616f,  0.055074f,  0.071352f,
+    0.027869f,  -0.037985f, -0.010142f, 0.144863f,  0.282595f,  0.308355f,
+    0.240088f,  0.112843f,  -0.039385f, -0.184714f, -0.273962f, -0.231511f,
+    -0.099914f, -0.010268f, -0.006229f, -0.022139f, 0.011047f,  0.103582f,
+    0.210221f,  0.263792f,  0.244414f,  0.141555f,  0.001977f,  -0.127895f,
+    -0.204276f, -0.170124f, -0.113998f, -0.098316f, -0.110142f, -0.121395f,
+    -0.066847f, 0.004953f,  -0.011374f, -0.024198f, 0.023000f,  0.076815f,
+    0.069909f,  0.026967f,  -0.009828f, -0.026804f, -0.086672f, -0.071554f,
+    -0.032497f, -0.011774f, 0.059304f,  0.128546f,  0.095016f,  0.070098f,
+    0.021376f,  -0.037997f, -0.078475f, -0.097911f, -0.110481f, -0.110302f,
+    -0.088875f, -0.089295f, -0.130657f, -0.160527f, -0.116915f, -0.023153f,
+    0.034095f,  -0.002057f, -0.112532f, -0.229994f, -0.275424f, -0.213625f,
+    -0.083854f, 0.050875f,  0.142213f,  0.168508f,  0.139443f,  0.094939f,
+    0.056502f,  0.024063f,  -0.003638f, -0.003639f, -0.009046f, -0.063095f,
+    -0.128961f, -0.205670f, -0.281271f, -0.294349f, -0.279390f, -0.266135f,
+    -0.211239f, -0.135875f, -0.115955f, -0.070612f, -0.007078f, -0.006425f,
+    0.035846f,  0.099069f,  0.152852f,  0.226443f,  0.236350f,  0.213771f,
+    0.126344f,  0.060643f,  0.023782f,  0.049747f,  0.032983f,  0.001671f,
+    -0.155977f, -0.155006f, -0.147271f, -0.133386f, -0.095822f, -0.005283f,
+    0.096470f,  0.127205f,  0.069340f,  0.038827f,  0.081173f,  0.108195f,
+    0.074881f,  0.037295f,  0.025142f,  0.023948f,  -0.010968f, -0.045136f,
+    -0.020420f, 0.010499f,  -0.006680f, -0.055191f, -0.058272f, 0.055435f,
+    0.251270f,  0.426977f,  0.454346f,  0.306404f,  0.052289f,  -0.209736f,
+    -0.409537f, -0.437949f, -0.331028f, -0.185188f, -0.064109f, 0.000282f,
+    0.045904f,  0.091609f,  0.143074f,  0.173685f,  0.156227f,  0.075442f,
+    0.026451f,  0.014268f,  -0.035446f, -0.099874f, -0.088465f, -0.050353f,
+    -0.030758f, 0.009804f,  0.029119f,  0.007723f,  -0.025395f, -0.019962f,
+    -0.042640f, -0.173183f, 0.206947f,  0.226535f,  0.191876f,  0.114814f,
+    0.027116f,  -0.009949f, 0.041941f,  0.118265f,  0.155750f,  0.169599f,
+    0.148125f,  0.094535f,  0.056361f,  0.021070f,  -0.066908f, -0.213551f,
+    -0.360836f, -0.414973f, -0.336403f, -0.169641f, -0.007550f, 0.098259f,
+    0.143927f,  0.168941f,  0.197385f,  0.186421f,  0.117677f,  0.057512f,
+    0.045755f,  0.052217f,  0.009902f,  -0.064347f, -0.081779f, -0.023731f,
+    0.023134f,  0.072907f,  0.109342f,  0.083841f,  0.021408f,  -0.047946f,
+    -0.090479f, -0.137326f, -0.144973f, -0.098702f, -0.083094f, -0.151684f,
+    -0.156482f, -0.105588f, 0.009049f,  0.138194f,  0.187389f,  0.132979f,
+    0.066774f,  0.075368f,  -0.007025f, -0.247550f, -0.243317f, -0.107974f,
+    0.054289f,  0.189965f,  0.257386f,  0.228644f,  0.171842f,  0.151161f,
+    0.164066f,  0.154374f,  0.119572f,  0.077786f,  0.011951f,  -0.059944f,
+    -0.070782f, 0.006259f,  0.149363f,  0.236377f,  0.161354f,  0.018389f,
+    -0.043013f, 0.022523f,  0.131127f,  0.181225f,  0.144278f,  0.055564f,
+    -0.028238f, -0.067284f, -0.061177f, -0.038809f, -0.012592f, 0.016489f,
+    0.033336f,  0.039630f,  0.064754f,  0.082996f,  0.062065f,  0.017006f,
+    -0.044705f, -0.117222f, -0.163212f, -0.162677f, -0.159482f, -0.125827f,
+    -0.057059f, 0.050812f,  0.060770f,  0.020967f,  0.007297f,  0.002381f,
+    0.031588f,  0.058180f,  0.008779f,  -0.062022f, -0.057803f, -0.028848f,
+    0.491685f,  0.285444f,  0.034340f,  -0.132027f, -0.173894f, -0.116731f,
+    -0.034670f, -0.017244f, -0.053250f, -0.050938f, -0.011478f, -0.015859f,
+    -0.082264f, -0.143813f, -0.173524f, -0.197264f, -0.188819f, -0.075118f,
+    0.173555f,  0.430008f,  0.511801f,  0.386172f,  0.143212f,  -0.058151f,
+    -0.094675f, -0.023514f, 0.040314f,  0.048049f,  0.023339f,  -0.012075f,
+    -0.045049f, -0.079652f, -0.059508f, 0.001439f,  0.031245f,  0.050290f,
+    0.037649f,  -0.018326f, -0.060496f, -0.020318f, 0.017065f,  0.009952f,
+    0.004856f,  0.015220f,  -0.003904f, -0.007104f, -0.002618f, 0.008470f,
+    -0.019414f, 0.016342f,  0.057482f,  0.000779f,  -0.062892f, 0.016592f,
+    0.007900f,  -0.140027f, -0.081682f, 0.024827f,  0.136669f,  0.179390f,
+    0.151500f,  0.077946f,  0.000833f,  -0.068875f, -0.157674f, -0.271042f,
+    -0.370926f, -0.434152f, -0.464747f, -0.441025f, -0.347124f, -0.229102f,
+    -0.130729f, -0.032378f, 0.075430f,  0.134191f,  0.106364f,  0.009962f,
+    -0.105521f, -0.176985f, -0.186708f, -0.167244f, -0.158317f, -0.177842f,
+    -0.207060f, -0.209313f, -0.181919f, -0.119087f, -0.046524f, 0.007717f,
+    0.021420f,  -0.034148f, -0.103340f, -0.133727f, -0.139844f, -0.105375f,
+    -0.073554f, -0.076613f, -0.052479f, -0.008383f, 0.002799f,  0.008987f,
+    0.063586f,  0.060848f,  0.006892f,  -0.033501f, -0.056260f, -0.112129f,
+    -0.069211f, -0.071685f, -0.114086f, -0.086376f, -0.341651f, -0.392435f,
+    -0.388942f, -0.343176f, -0.307912f, -0.280955f, -0.251209f, -0.191433f,
+    -0.109379f, -0.031883f, 0.000148f,  -0.016429f, -0.022888f, -0.023074f,
+    -0.088392f, -0.150152f, -0.109719f, -0.040930f, 0.017980f,  0.029138f,
+    -0.015858f, -0.041557f, -0.035791f, -0.071020f, -0.113858f, -0.109329f,
+    -0.083501f, -0.095613f, -0.123665f, -0.134388f, -0.088115f, -0.025098f,
+    -0.000708f, -0.074133f, -0.161137f, -0.187415f, -0.209865f, -0.245662f,
+    -0.231248f, -0.228734f, -0.182470f, -0.083983f, 0.039075f,  0.138484f,
+    0.131029f,  0.125450f,  0.061025f,  0.040979f,  0.004728f,  0.003166f,
+    0.092087f,  0.048074f,  -0.033807f, 0.047760f,  0.117539f,  0.016023f,
+    -0.223592f, -0.168105f, -0.068657f, 0.059843f,  0.187414f,  0.244861f,
+    0.209176f,  0.119556f,  0.050417f,  0.033931f,  0.060704f,  0.082414f,
+    0.041555f,  -0.069313f, -0.155497f, -0.143473f, -0.090347f, -0.116049f,
+    -0.229995f, -0.354986f, -0.457733f, -0.562990f, -0.682795f, -0.791805f,
+    -0.836926f, -0.766644f, -0.570695f, -0.304627f, -0.052040f, 0.111146f,
+    0.160789f,  0.121731f,  0.057950f,  0.032809f,  0.040554f,  0.035781f,
+    0.016399f,  -0.008495f, -0.007777f, -0.033533f, -0.024679f, -0.011219f,
+    0.010131f,  0.056375f,  0.066521f,  -0.014711f, -0.001467f, 0.035200f,
+    -0.053546f, -0.045845f, -0.020436f, -0.001847f, 0.059012f,  0.122079f,
+    0.118095f,  0.168073f,  0.183415f,  0.161185f,  0.122422f,  0.045717f,
+    -0.034258f, -0.083412f, -0.064308f, 0.010041f,  0.052550f,  0.048807f,
+    0.018931f,  -0.015215f, -0.027953f, 0.023689f,  0.127549f,  0.182424f,
+    0.087385f,  -0.109037f, -0.305596f, -0.400407f, -0.310395f, -0.041098f,
+    0.265210f,  0.398673f,  0.279712f,  0.051440f,  -0.132577f, -0.210991f,
+    -0.172957f, -0.098261f, -0.015501f, 0.022062f,  0.017732f,  0.036908f,
+    0.024377f,  -0.025018f, -0.017463f, 0.028543f,  0.055558f,  0.059871f,
+    0.060187f,  0.062159f,  -0.009437f, -0.005059f, 0.036145f,  -0.016351f,
+    -0.048110f, -0.021308f, -0.005433f, 0.009315f,  0.017089f,  0.007334f,
+    0.003269f,  0.007445f,  0.049311f,  -0.049079f, 0.179689f,  0.081884f,
+    -0.047391f, -0.134552f, -0.132250f, -0.068567f, -0.025231f, -0.058984f,
+    -0.076959f, 0.011917f,  0.095375f,  0.070573f,  0.008982f,  0.032127f,
+    0.085809f,  0.089165f,  0.036637f,  -0.054729f, -0.102538f, -0.081583f,
+    -0.038428f, 0.041446f,  0.111473f,  0.102703f,  0.102123f,  0.164333f,
+    0.294016f,  0.439738f,  0.470727f,  0.316634f,  0.041100f,  -0.207170f,
+    -0.355357f, -0.377313f, -0.267171f, -0.137784f, -0.007908f, 0.079623f,
+    0.096192f,  0.077820f,  0.055874f,  -0.000366f, 0.016643f,  0.048180f,
+    -0.002112f, -0.032962f, 0.028514f,  0.020174f,  -0.019075f, -0.041736f,
+    0.006956f,  0.014450f,  -0.020181f, -0.006719f, -0.042526f, -0.116087f,
+    -0.188657f, -0.232106f, -0.257850f, -0.232598f, -0.138617f, -0.029306f,
+    0.037346f,  0.095274f,  0.160665f,  0.157645f,  0.080645f,  0.024850f,
+    0.035400f,  0.089463f,  0.157084f,  0.225529f,  0.263256f,  0.243901f,
+    0.190330f,  0.189015f,  0.284839f,  0.464088f,  0.620212f,  0.558081f,
+    0.214573f,  -0.228608f, -0.554957f, -0.714610f, -0.796099f, -0.818359f,
+    -0.733648f, -0.597154f, -0.457876f, -0.292263f, -0.101532f, 0.021159f,
+    0.020727f,  -0.001546f, -0.007782f, -0.046469f, -0.053198f, 0.014361f,
+    0.040729f,  0.044320f,  0.034897f,  0.059169f,  0.028790f,  0.076134f,
+    0.055686f,  0.009750f,  -0.005085f, -0.019628f, -0.017553f, -0.032789f,
+    -0.101068f, -0.113011f, -0.298980f, -0.253264f, -0.212340f, -0.158467f,
+    -0.074222f, -0.006654f, 0.006123f,  -0.032533f, -0.093889f, -0.099972f,
+    -0.030457f, 0.039460f,  0.029334f,  -0.046874f, -0.129042f, -0.154635f,
+    -0.124573f, -0.096605f, -0.072642f, -0.054248f, -0.100254f, -0.246979f,
+    -0.455399f, -0.606813f, -0.579440f, -0.376720f, -0.115529f, 0.114074f,
+    0.289259f,  0.366924f,  0.398322f,  0.439557f,  0.379002f,  0.208322f,
+    0.033504f,  -0.105685f, -0.154379f, -0.051476f, 0.109158f,  0.194522f,
+    0.268910f,  0.215331f,  0.113817f,  0.020673f,  -0.055578f, -0.153714f,
+    -0.203986f, -0.179920f, -0.173227f, -0.207839f, -0.153040f, -0.084195f,
+    -0.053728f, 0.072113f,  0.319101f,  0.514410f,  -0.142086f, -0.054339f,
+    0.040725f,  0.116206f,  0.168989f,  0.176982f,  0.125079f,  0.040882f,
+    -0.015882f, 0.002775f,  0.074281f,  0.137231f,  0.123633f,  0.045272f,
+    0.010456f,  0.056293f,  0.095175f,  0.049049f,  -0.034518f, -0.090059f,
+    -0.121233f, -0.153164f, -0.263450f, -0.515348f, -0.830711f, -1.072526f,
+    -1.088909f, -0.830030f, -0.429058f, -0.121091f, 0.055507f,  0.159237f,
+    0.241273f,  0.311518f,  0.362226f,  0.336427f,  0.277843f,  0.198872f,
+    0.085131f,  -0.003477f, -0.024864f, -0.024676f, 0.011583f,  0.042255f,
+    0.100485f,  0.123917f,  0.035568f,  -0.047012f, -0.138785f, -0.156973f,
+    -0.134437f, -0.051495f, -0.004772f, -0.021012f, 0.019608f,  0.151230f,
+    0.047790f,  0.045437f,  0.034372f,  0.000639f,  -0.051561f, -0.103336f,
+    -0.123623f, -0.104258f, -0.088346f, -0.093487f, -0.111579f, -0.111636f,
+    -0.085653f, -0.064398f, -0.101728f, -0.220921f, -0.347561f, -0.365036f,
+    -0.248020f, -0.055385f, 0.166266f,  0.369296f,  0.456789f,  0.370937f,
+    0.184029f,  0.010311f,  -0.120883f, -0.241022f, -0.335831f, -0.326770f,
+    -0.202403f, -0.040506f, 0.078250f,  0.118453f,  0.090009f,  0.040633f,
+    0.022220f,  0.052115f,  0.138266f,  0.250504f,  0.306717f,  0.314265f,
+    0.280125f,  0.208174f,  0.135049f,  0.105254f,  0.018607f,  -0.099886f,
+    -0.034914f, 0.061054f,  0.044021f,  0.076560f,  0.138072f,  0.106967f,
+    0.193131f,  0.295693f,  0.320232f,  0.266890f,  0.178243f,  0.115563f,
+    0.081258f,  0.050030f,  0.042638f,  0.017407f,  -0.048793f, -0.060528f,
+    -0.020216f, 0.034634f,  0.074632f,  0.088784f,  0.035112f,  -0.059109f,
+    -0.104243f, -0.066851f, 0.038631f,  0.133278f,  0.119116f,  0.019272f,
+    -0.035597f, -0.011808f, 0.014745f,  0.017517f,  0.017485f,  -0.020365f,
+    -0.090590f, -0.126384f, -0.120857f, -0.163132f, -0.202596f, -0.195643f,
+    -0.193198f, -0.196230f, -0.099704f, 0.091633f,  0.221048f,  0.272392f,
+    0.295368f,  0.321161f,  0.297585f,  0.291702f,  0.252250f,  0.106870f,
+    -0.027050f, -0.075252f, -0.063330f, -0.015201f, 0.011105f,  -0.061831f,
+    -0.184471f, -0.198005f, -0.172409f, -0.119462f, 0.175315f,  0.026965f,
+    -0.089228f, -0.125415f, -0.093035f, 0.009125f,  0.095061f,  0.094539f,
+    0.024896f,  -0.045097f, -0.069738f, -0.025746f, 0.042811f,  0.028915f,
+    -0.058489f, -0.103420f, -0.044793f, 0.110222f,  0.242571f,  0.236826f,
+    0.120702f,  -0.006004f, -0.038624f, 0.060175f,  0.251887f,  0.486935f,
+    0.628506f,  0.536759f,  0.225783f,  -0.144013f, -0.496973f, -0.758961f,
+    -0.801947f, -0.695692f, -0.526540f, -0.289914f, -0.117883f, -0.033301f,
+    0.071811f,  0.099704f,  0.047194f,  0.078734f,  0.054228f,  0.058137f,
+    0.095342f,  0.078301f,  0.120476f,  0.088482f,  0.018881f,  -0.010451f,
+    0.008945f,  -0.004177f, 0.002112f,  0.005852f,  -0.010259f, 0.099616f,
+    0.384461f,  0.477679f,  0.531602f,  0.477662f,  0.319914f,  0.155635f,
+    0.074500f,  0.012887f,  -0.095659f, -0.197372f, -0.260606f, -0.300708f,
+    -0.323001f, -0.336020f, -0.336054f, -0.298376f, -0.226882f, -0.180457f,
+    -0.174923f, -0.154917f, -0.081372f, 0.021528f,  0.081217f,  0.071950f,
+    0.014132f,  -0.049819f, -0.053602f, 0.042045f,  0.220169f,  0.388559f,
+    0.464743f,  0.409453f,  0.264525f,  0.106690f,  -0.010412f, -0.066457f,
+    -0.070716f, -0.051079f, -0.036431f, 0.000605f,  0.061798f,  0.082342f,
+    0.011949f,  -0.059787f, -0.154848f, -0.220655f, -0.208717f, -0.152161f,
+    -0.092716f, -0.004536f, 0.129441f,  0.222259f,  0.223826f,  0.167316f,
+    0.118975f,  0.002998f,  -0.091783f, -0.039915f, 0.035431f,  0.105834f,
+    0.143951f,  0.144856f,  0.130171f,  0.096282f,  0.024506f,  -0.043964f,
+    -0.072160f, -0.062731f, -0.031867f, -0.015134f, -0.000172f, 0.038848f,
+    0.058379f,  0.070135f,  0.106402f,  0.144203f,  0.121752f,  0.010315f,
+    -0.103708f, -0.106027f, 0.017266f,  0.186814f,  0.309223f,  0.357667f,
+    0.367292f,  0.368400f,  0.364743f,  0.336151f,  0.276919f,  0.200977f,
+    0.108399f,  -0.006727f, -0.139975f, -0.272929f, -0.391060f, -0.501602f,
+    -0.602821f, -0.686156f, -0.733709f, -0.738522f, -0.711317f, -0.643189f,
+    -0.536864f, -0.418492f, -0.286523f, -0.161318f, -0.095189f, -0.060592f,
+    0.016938f,  0.084833f,  0.162293f,  0.233681f,  0.243003f,  0.207300f,
+    0.221334f,  0.234879f,  0.219949f,  0.196730f,  0.177821f,  0.172083f,
+    0.122602f,  0.011488f,  -0.031086f, 0.022295f,  0.031893f,  -0.027649f,
+    -0.034802f, 0.003833f,  0.008499f,  0.018370f,  0.092073f,  0.126828f,
+    0.111941f,  0.092599f,  0.060240f,  0.049296f,  0.089587f,  0.146949f,
+    0.186239f,  0.197925f,  0.185882f,  0.171926f,  0.141358f,  0.102651f,
+    0.111072f,  0.115507f,  0.076349f,  0.061451f,  0.069668f,  0.079727f,
+    0.102023f,  0.228975f,  0.410918f,  0.486163f,  0.533359f,  0.540878f,
+    0.493134f,  0.520546f,  0.458225f,  0.338400f,  0.237098f,  0.178028f,
+    0.132683f,  0.222231f,  0.296541f,  0.250397f,  0.311614f,  0.407787f,
+    0.373891f,  0.321044f,  0.263359f,  0.218219f,  0.207479f,  0.208700f,
+    0.210288f,  0.251958f,  0.331415f,  0.335211f,  0.224627f,  0.062937f,
+    -0.029336f, 0.002544f,  0.064338f,  0.091037f,  0.134097f,  0.189601f,
+    0.188858f,  0.114525f,  -0.011013f, -0.159757f, -0.280341f, -0.339716f,
+    -0.339359f, -0.289992f, -0.176816f, 0.013597f,  0.192154f,  0.257516f,
+    0.235661f,  0.162077f,  0.102735f,  0.094468f,  0.107667f,  0.072390f,
+    -0.040678f, -0.186194f, -0.324636f, -0.343426f, -0.258342f, -0.138090f,
+    -0.089785f, -0.038019f, 0.076324f,  0.138993f,  0.126315f,  0.142172f,
+    0.123661f,  0.075183f,  0.040432f,  0.032501f,  0.030385f,  0.168809f,
+    0.207449f,  0.074654f,  0.051526f,  0.018449f,  0.046546f,  0.118473f,
+    0.174250f,  0.189954f,  0.132609f,  0.031786f,  -0.026144f, -0.022992f,
+    -0.011163f, -0.022999f, -0.041345f, -0.052286f, -0.038747f, 0.023715f,
+    0.092058f,  0.113773f,  0.092296f,  0.012684f,  -0.096134f, -0.193497f,
+    -0.219777f, -0.180450f, -0.110639f, -0.061604f, -0.143544f, -0.360070f,
+    -0.567325f, -0.683374f, -0.631536f, -0.412065f, -0.085619f, 0.231001f,
+    0.429553f,  0.456069f,  0.413607f,  0.412747f,  0.376851f,  0.227198f,
+    0.036104f,  -0.012163f, -0.045156f, -0.073456f, -0.056772f, -0.024204f,
+    -0.050667f, -0.015989f, 0.073492f,  0.019130f,  0.030580f,  0.052404f,
+    -0.005765f, 0.020766f,  0.033891f,  -0.034706f, -0.390666f, -0.311807f,
+    -0.189353f, -0.068636f, 0.012837f,  0.045865f,  0.040537f,  0.026687f,
+    0.002915f,  -0.051094f, -0.094507f, -0.098220f, -0.074156f, -0.044383f,
+    -0.029559f, -0.024512f, 0.003611f,  0.027060f,  0.017130f,  -0.027977f,
+    -0.084314f, -0.092613f, -0.024478f, 0.063209f,  0.080877f,  0.004008f,
+    -0.096512f, -0.148198f, -0.143981f, -0.102614f, -0.029282f, 0.068697f,
+    0.158356f,  0.209712f,  0.217930f,  0.156781f,  0.045923f,  -0.059084f,
+    -0.105785f, -0.081033f, -0.009571f, 0.059474f,  0.098438f,  0.093229f,
+    0.034713f,  -0.058434f, -0.144020f, -0.207829f, -0.271766f, -0.316917f,
+    -0.324021f, -0.309429f, -0.254339f, -0.106705f, 0.033328f,  0.059106f,
+    0.565108f,  0.491634f,  0.367361f,  0.161459f,  -0.107433f, -0.336289f,
+    -0.441085f, -0.435870f, -0.420406f, -0.482090f, -0.568652f, -0.523591f,
+    -0.274259f, 0.095069f,  0.412160f,  0.483256f,  0.271403f,  -0.014892f,
+    -0.133915f, -0.024223f, 0.190821f,  0.324710f,  0.273344f,  0.095093f,
+    -0.087661f, -0.175643f, -0.147463f, -0.082908f, -0.041817f, -0.033882f,
+    -0.042405f, -0.035753f, -0.029763f, -0.040160f, -0.049288f, -0.038005f,
+    -0.027169f, -0.025332f, -0.023288f, 0.019348f,  0.031118f,  -0.009671f,
+    -0.026860f, -0.014111f, -0.081048f, -0.126649f, -0.124715f, -0.135449f,
+    -0.058624f, 0.041838f,  0.085868f,  0.115954f,  0.121258f,  0.084376f,
+    -0.101501f, -0.319930f, -0.358543f, -0.362191f, -0.332190f, -0.238832f,
+    -0.110910f, -0.020626f, 0.000913f,  -0.006637f, 0.010419f,  -0.016042f,
+    -0.108089f, -0.171541f, -0.154073f, -0.103336f, -0.078280f, -0.065508f,
+    -0.036003f, -0.026998f, -0.026952f, 0.033936f,  0.151433f,  0.229504f,
+    0.172858f,  0.011255f,  -0.139993f, -0.212727f, -0.197838f, -0.133055f,
+    -0.045604f, 0.020727f,  0.036472f,  0.022899f,  0.025496f,  0.053628f,
+    0.028559f,  -0.069180f, -0.136840f, -0.135164f, -0.172945f, -0.260151f,
+    -0.264529f, -0.233856f, -0.259721f, -0.298661f, -0.215140f, -0.109030f,
+    -0.080388f, -0.067975f, -0.044110f, -0.007317f, 0.070801f,  0.110688f,
+    0.073619f,  0.023792f,  0.040823f,  0.163210f,  0.844757f,  0.768786f,
+    0.694942f,  0.638763f,  0.575280f,  0.504550f,  0.456214f,  0.430293f,
+    0.412160f,  0.389078f,  0.371026f,  0.349072f,  0.326955f,  0.290195f,
+    0.226523f,  0.142701f,  0.093167f,  0.135995f,  0.217759f,  0.270113f,
+    0.263821f,  0.196356f,  0.094086f,  -0.013701f, -0.116467f, -0.207909f,
+    -0.264683f, -0.288276f, -0.310040f, -0.269154f, -0.202100f, -0.186222f,
+    -0.194836f, -0.211399f, -0.233367f, -0.189950f, -0.092758f, -0.046295f,
+    -0.022667f, 0.039329f,  0.058637f,  0.050164f,  0.145574f,  0.189067f,
+    0.112800f,  0.058115f,  -0.009911f, -0.087689f, -0.061664f, -0.008993f,
+    -0.052399f, -0.071020f, -0.055641f, -0.025952f, 0.026182f,  0.104757f,
+    -0.066632f, -0.016715f, 0.044399f,  0.092206f,  0.111167f,  0.108378f,
+    0.077888f,  0.023644f,  -0.015506f, -0.023293f, -0.014418f, 0.000961f,
+    0.011945f,  0.021526f,  0.021717f,  -0.001880f, -0.034893f, -0.085702f,
+    -0.140266f, -0.156839f, -0.126124f, -0.088967f, -0.092267f, -0.136881f,
+    -0.198665f, -0.262526f, -0.317780f, -0.352973f, -0.353939f, -0.321645f,
+    -0.220062f, -0.043009f, 0.156649f,  0.344329f,  0.457047f,  0.441304f,
+    0.326627f,  0.176992f,  0.020547f,  -0.060424f, -0.084553f, -0.125593f,
+    -0.171360f, -0.282355f, -0.409531f, -0.490873f, -0.555281f, -0.525667f,
+    -0.340598f, -0.111191f, 0.085062f,  0.205913f,  0.245386f,  0.249782f,
+    0.333737f,  0.420838f,  -1.108427f, -0.870374f, -0.604086f, -0.409068f,
+    -0.345131f, -0.353743f, -0.305460f, -0.199998f, -0.090643f, -0.061592f,
+    -0.126818f, -0.169522f, -0.151909f, -0.096437f, -0.075983f, -0.068447f,
+    -0.002286f, 0.016841f,  -0.016346f, 0.020626f,  0.115194f,  0.076661f,
+    -0.106605f, -0.251386f, -0.231342f, -0.135985f, -0.078864f, -0.048019f,
+    0.008944f,  0.064835f,  0.054914f,  0.083809f,  0.084279f,  0.041300f,
+    -0.028793f, -0.083726f, -0.133053f, -0.166618f, -0.244700f, -0.244679f,
+    -0.145663f, -0.041657f, 0.059544f,  0.098875f,  0.127180f,  0.119354f,
+    0.131457f,  0.063858f,  0.105597f,  0.132855f,  0.211296f,  0.107364f,
+    0.057138f,  0.201253f,  0.227738f,  -0.079245f, 0.044250f,  0.073251f,
+    0.081783f,  0.046117f,  -0.036623f, -0.136805f, -0.207995f, -0.246334f,
+    -0.246958f, -0.206133f, -0.138843f, -0.081780f, -0.072553f, -0.087308f,
+    -0.098674f, -0.152044f, -0.277256f, -0.403775f, -0.458742f, -0.447997f,
+    -0.422562f, -0.419973f, -0.455255f, -0.508256f, -0.542337f, -0.548529f,
+    -0.525964f, -0.461431f, -0.348749f, -0.214786f, -0.090254f, 0.040618f,
+    0.184993f,  0.321336f,  0.416757f,  0.432430f,  0.381592f,  0.240767f,
+    0.066472f,  -0.032988f, -0.071906f, -0.008143f, 0.072295f,  0.163401f,
+    0.219904f,  0.227007f,  0.234695f,  0.165054f,  0.052883f,  -0.008401f,
+    -0.020470f, -0.026136f, -0.050509f, -0.055224f, -0.021762f, 0.066941f,
+    0.266061f,  0.125830f,  -0.012721f, -0.087764f, -0.094373f, -0.050572f,
+    -0.028678f, -0.085023f, -0.152995f, -0.112769f, 0.009625f,  0.036157f,
+    -0.100005f, -0.237416f, -0.214046f, -0.053998f, 0.143850f,  0.314403f,
+    0.360661f,  0.201003f,  -0.126848f, -0.521915f, -0.841108f, -0.839325f,
+    -0.410650f, 0.195163f,  0.653124f,  0.807725f,  0.617243f,  0.243203f,
+    -0.069968f, -0.225906f, -0.208480f, -0.065931f, 0.067760f,  0.117544f,
+    0.110150f,  0.101297f,  0.041973f,  0.006051f,  0.018398f,  -0.024202f,
+    -0.072324f, -0.086625f, -0.052513f, -0.030568f, -0.022057f, -0.040119f,
+    0.071318f,  0.109894f,  0.076275f,  0.068203f,  0.020590f,  0.002470f,
+    0.009977f,  -0.127523f, -0.179248f, -0.263954f, -0.197261f, -0.075042f,
+    -0.003293f, 0.015632f,  0.007531f,  0.030263f,  0.027298f,  -0.000605f,
+    -0.030998f, -0.047557f, -0.060501f, -0.085230f, -0.078690f, -0.037207f,
+    0.022771f,  0.077923f,  0.050259f,  -0.023712f, -0.056893f, -0.058709f,
+    -0.044155f, -0.022576f, -0.010239f, 0.017224f,  0.045009f,  -0.006769f,
+    -0.095135f, -0.108896f, -0.072916f, -0.029742f, -0.038803f, -0.056891f,
+    -0.061542f, 0.013396f,  0.045068f,  0.002169f,  0.022949f,  -0.044838f,
+    -0.057356f, -0.042947f, 0.000877f,  0.114846f,  0.169868f,  0.194432f,
+    0.194117f,  0.136342f,  0.041771f,  0.038419f,  0.088244f,  0.029333f,
+    -0.071495f, -0.136909f, -0.162929f, -0.409735f, 0.077905f,  0.058347f,
+    0.006256f,  -0.038624f, -0.054572f, -0.054146f, -0.055920f, -0.064542f,
+    -0.072630f, -0.065124f, -0.035368f, -0.006122f, -0.008186f, -0.026509f,
+    -0.047452f, -0.050450f, -0.015630f, 0.035520f,  0.053823f,  0.012491f,
+    -0.059610f, -0.091814f, -0.044644f, 0.062938f,  0.178362f,  0.261199f,
+    0.300512f,  0.291322f,  0.228145f,  0.137348f,  0.056080f,  -0.010541f,
+    -0.062425f, -0.077458f, -0.036001f, 0.034189f,  0.060692f,  -0.002490f,
+    -0.114046f, -0.224204f, -0.358209f, -0.438610f, -0.460614f, -0.544573f,
+    -0.580909f, -0.485170f, -0.359503f, -0.281086f, -0.210837f, -0.146584f,
+    -0.132512f, -0.100012f, 0.024048f,  0.072651f,  0.059337f,  0.098780f,
+    0.106638f,  0.050790f,  -0.054270f, -0.163134f, -0.246820f, -0.280672f,
+    -0.281415f, -0.290082f, -0.313494f, -0.282992f, -0.187929f, -0.093859f,
+    -0.028355f, 0.035744f,  0.068834f,  0.042935f,  -0.021418f, -0.102295f,
+    -0.201835f, -0.270825f, -0.283756f, -0.247565f, -0.177787f, -0.094130f,
+    -0.004993f, 0.080634f,  0.150939f,  0.194687f,  0.215790f,  0.225919f,
+    0.228671f,  0.217338f,  0.170889f,  0.097678f,  0.030946f,  -0.044269f,
+    -0.136827f, -0.234707f, -0.287924f, -0.221793f, -0.049225f, 0.130975f,
+    0.270989f,  0.336086f,  0.332534f,  0.384828f,  0.478549f,  0.444760f,
+    0.347507f,  0.232509f,  0.049750f,  -0.097049f, -0.159653f, -0.222626f,
+    -0.275191f, -0.225091f, -0.099336f, -0.047359f, 0.008525f,  0.044795f,
+    0.068713f,  0.043794f,  -0.016846f, -0.059569f, -0.019958f, 0.090796f,
+    0.177769f,  0.190969f,  0.156654f,  0.119825f,  0.083107f,  0.047925f,
+    0.018568f,  0.017297f,  0.065114f,  0.128315f,  0.169866f,  0.199197f,
+    0.230318f,  0.230794f,  0.166194f,  0.086773f,  0.061995f,  0.119015f,
+    0.214352f,  0.271568f,  0.266359f,  0.167520f,  0.043754f,  -0.017544f,
+    -0.042517f, -0.043594f, -0.043489f, -0.012590f, 0.087056f,  0.117915f,
+    0.031148f,  -0.025895f, -0.037381f, -0.055493f, -0.078348f, -0.084750f,
+    0.015094f,  0.140445f,  0.174770f,  0.251478f,  0.369981f,  0.351183f,
+    0.280807f,  0.304833f,  0.294177f,  0.189434f,  -0.006011f, -0.006008f,
+    -0.006012f, -0.006008f, -0.006011f, -0.006008f, -0.006011f, -0.006009f,
+    -0.006010f, -0.006010f, -0.006009f, -0.006010f, -0.006009f, -0.006011f,
+    -0.006009f, -0.006010f, -0.006009f, -0.006010f, -0.006010f, -0.006010f,
+    -0.006010f, -0.006009f, -0.006010f, -0.006009f, -0.006010f, -0.006010f,
+    -0.006010f, -0.006009f, -0.006011f, -0.006008f, -0.006013f, -0.006004f,
+    -0.006018f, -0.005999f, -0.006023f, -0.005995f, -0.006025f, -0.005996f,
+    -0.006021f, -0.006002f, -0.006015f, -0.006006f, -0.006013f, -0.006006f,
+    -0.006014f, -0.006005f, -0.006015f, -0.006005f, -0.006014f, -0.006007f,
+    -0.006011f, -0.006010f, -0.006009f, -0.006012f, -0.006008f, -0.006012f,
+    0.069732f,  0.137998f,  0.152962f,  0.116537f,  0.045522f,  -0.040914f,
+    -0.117813f, -0.172469f, -0.169080f, -0.116596f, -0.033841f, 0.067123f,
+    0.130081f,  0.124223f,  0.051954f,  -0.071097f, -0.206416f, -0.301467f,
+    -0.319978f, -0.271863f, -0.226066f, -0.249980f, -0.352506f, -0.496629f,
+    -0.635548f, -0.737949f, -0.796521f, -0.815666f, -0.808356f, -0.796536f,
+    -0.794623f, -0.792316f, -0.757121f, -0.635914f, -0.380282f, -0.033524f,
+    0.282396f,  0.484032f,  0.545153f,  0.457064f,  0.250996f,  0.103473f,
+    0.060089f,  -0.020436f, -0.106351f, -0.093493f, -0.072271f, -0.051153f,
+    0.031595f,  0.029842f,  -0.022697f, -0.027129f, 0.002806f,  0.002349f,
+    0.082599f,  0.291516f,  -0.074021f, -0.084973f, -0.053228f, -0.046451f,
+    -0.073948f, -0.046556f, 0.070186f,  0.167926f,  0.129410f,  0.067493f,
+    0.058789f,  0.072290f,  0.127280f,  0.145263f,  0.023870f,  -0.143050f,
+    -0.196147f, -0.033792f, 0.174019f,  0.165727f,  -0.103156f, -0.498172f,
+    -0.790822f, -0.772666f, -0.414905f, 0.130271f,  0.597711f,  0.763076f,
+    0.599727f,  0.255829f,  -0.115035f, -0.339667f, -0.346461f, -0.187723f,
+    0.064141f,  0.247139f,  0.272689f,  0.241603f,  0.181214f,  0.100983f,
+    0.015990f,  -0.083457f, -0.098337f, -0.036372f, -0.024661f, -0.026132f,
+    0.014799f,  0.026291f,  -0.001973f, -0.033900f, -0.068759f, -0.084783f,
+    -0.017747f, 0.038610f,  0.076315f,  0.150428f,  -0.003365f, -0.003365f,
+    -0.003365f, -0.003365f, -0.003365f, -0.003365f, -0.003365f, -0.003365f,
+    -0.003364f, -0.003366f, -0.003364f, -0.003367f, -0.003362f, -0.003368f,
+    -0.003361f, -0.003369f, -0.003361f, -0.003369f, -0.003361f, -0.003367f,
+    -0.003364f, -0.003364f, -0.003367f, -0.003362f, -0.003369f, -0.003361f,
+    -0.003369f, -0.003362f, -0.003367f, -0.003364f, -0.003365f, -0.003366f,
+    -0.003364f, -0.003367f, -0.003363f, -0.003366f, -0.003364f, -0.003365f,
+    -0.003365f, -0.003364f, -0.003366f, -0.003364f, -0.003366f, -0.003363f,
+    -0.003366f, -0.003364f, -0.003366f, -0.003365f, -0.003364f, -0.003367f,
+    -0.003362f, -0.003369f, -0.003360f, -0.003370f, -0.003359f, -0.003370f,
+    0.005777f,  -0.001890f, -0.033558f, -0.075295f, -0.114042f, -0.142450f,
+    -0.161723f, -0.162646f, -0.153445f, -0.130043f, -0.081105f, -0.011191f,
+    0.060551f,  0.122308f,  0.178151f,  0.224432f,  0.259305f,  0.301851f,
+    0.350795f,  0.352066f,  0.268495f,  0.156051f,  0.084333f,  0.056031f,
+    0.045416f,  0.032428f,  0.017047f,  -0.002069f, -0.054803f, -0.145417f,
+    -0.254610f, -0.362514f, -0.414244f, -0.376987f, -0.263475f, -0.101542f,
+    0.046898f,  0.113379f,  0.070671f,  0.022526f,  0.051154f,  0.074755f,
+    0.104835f,  0.100158f,  0.035268f,  0.016434f,  -0.003558f, 0.010256f,
+    0.079356f,  0.073619f,  -0.042204f, -0.093115f, -0.105980f, -0.128616f,
+    -0.135909f, -0.084651f, 0.054723f,  0.056663f,  0.054894f,  0.069957f,
+    0.097864f,  0.091295f,  0.038661f,  -0.010249f, 0.007440f,  0.060596f,
+    0.059168f,  -0.005628f, -0.087014f, -0.128030f, -0.104858f, -0.049091f,
+    0.017549f,  0.102590f,  0.178155f,  0.203874f,  0.208378f,  0.218247f,
+    0.235974f,  0.264995f,  0.274849f,  0.238290f,  0.163322f,  0.048906f,
+    -0.107156f, -0.261706f, -0.368331f, -0.421053f, -0.427712f, -0.402326f,
+    -0.352109f, -0.276708f, -0.173625f, -0.027069f, 0.165535f,  0.299860f,
+    0.335826f,  0.279798f,  0.226781f,  0.216674f,  0.177713f,  0.133668f,
+    0.137426f,  0.100382f,  -0.008830f, -0.045376f, -0.043045f, -0.055677f,
+    -0.133300f, -0.152403f, -0.076310f, 0.026222f,  -0.051130f, -0.129192f,
+    -0.191386f, -0.170418f, -0.047320f, 0.087579f,  0.141913f,  0.130613f,
+    0.127819f,  0.151079f,  0.156778f,  0.119553f,  0.063292f,  0.026719f,
+    0.017334f,  0.050691f,  0.124568f,  0.175583f,  0.136592f,  0.021019f,
+    -0.068914f, -0.071141f, -0.041794f, -0.006376f, 0.047116f,  0.114310f,
+    0.179587f,  0.229111f,  0.259883f,  0.220687f,  0.136094f,  0.142200f,
+    0.279393f,  0.451454f,  0.564673f,  0.514048f,  0.268652f,  -0.133356f,
+    -0.547517f, -0.736532f, -0.755640f, -0.717788f, -0.675776f, -0.560741f,
+    -0.344124f, -0.150843f, -0.091501f, -0.064892f, -0.008724f, -0.026912f,
+    -0.017698f, 0.063965f,  0.088528f,  0.106581f,  0.136258f,  0.122593f,
+    -0.022274f, 0.087148f,  0.218187f,  0.276095f,  0.191652f,  0.017070f,
+    -0.131950f, -0.237578f, -0.322555f, -0.310492f, -0.215681f, -0.140272f,
+    -0.121302f, -0.161870f, -0.185616f, -0.110038f, 0.001828f,  0.030779f,
+    -0.069583f, -0.240407f, -0.346313f, -0.306520f, -0.117239f, 0.152397f,
+    0.382531f,  0.519103f,  0.565769f,  0.546266f,  0.487855f,  0.398405f,
+    0.254072f,  0.123720f,  0.087727f,  0.110632f,  0.108339f,  0.086259f,
+    0.046206f,  -0.004895f, 0.020191f,  0.017470f,  0.024756f,  0.011476f,
+    0.007218f,  0.042590f,  0.025957f,  -0.100067f, -0.175824f, -0.205351f,
+    -0.162340f, -0.092041f, -0.049159f, -0.002172f, -0.026416f, -0.008414f,
+    0.130307f,  0.150325f,  -0.012350f, -0.072675f, -0.118295f, -0.115746f,
+    -0.061857f, 0.028321f,  0.189562f,  0.425862f,  0.616152f,  0.505192f,
+    0.053667f,  -0.394997f, -0.467777f, -0.107428f, 0.391456f,  0.650393f,
+    0.487624f,  0.014039f,  -0.434993f, -0.524952f, -0.274636f, 0.018808f,
+    0.159265f,  0.141739f,  0.044938f,  -0.078631f, -0.199177f, -0.255510f,
+    -0.201371f, -0.101877f, -0.043293f, -0.069147f, -0.075751f, 0.031692f,
+    0.116156f,  0.182777f,  0.225888f,  0.164742f,  0.079711f,  0.017369f,
+    -0.066097f, -0.080081f, -0.004599f, 0.049699f,  0.075269f,  0.094453f,
+    0.073666f,  -0.021095f, -0.062826f, 0.024248f,  0.147286f,  0.088909f,
+    -0.066366f, -0.060888f, -0.122221f, -0.510438f, -0.272367f, -0.276537f,
+    -0.247785f, -0.191100f, -0.115576f, -0.051444f, -0.019753f, 0.011411f,
+    0.038140f,  0.029486f,  -0.007003f, -0.015693f, 0.040933f,  0.124582f,
+    0.131238f,  0.032359f,  -0.085959f, -0.160961f, -0.178768f, -0.142300f,
+    -0.070680f, 0.027923f,  0.130968f,  0.221303f,  0.254337f,  0.200565f,
+    0.109646f,  0.034345f,  -0.020224f, -0.003552f, 0.080432f,  0.155694f,
+    0.172828f,  0.157915f,  0.178384f,  0.211094f,  0.215407f,  0.174356f,
+    0.147124f,  0.055387f,  -0.027456f, -0.123120f, -0.194388f, -0.384414f,
+    -0.609968f, -0.637294f, -0.663965f, -0.573875f, -0.481520f, -0.460997f,
+    -0.499917f, -0.434692f, -0.336333f, -0.263101f, -0.262714f, -0.280911f,
+    0.272866f,  0.176718f,  0.048335f,  -0.047334f, -0.074405f, -0.055428f,
+    -0.017840f, -0.020223f, -0.053751f, -0.072840f, -0.084422f, -0.090041f,
+    -0.055553f, -0.014521f, -0.106437f, -0.354007f, -0.591959f, -0.660415f,
+    -0.509063f, -0.210587f, 0.086781f,  0.284433f,  0.369308f,  0.375666f,
+    0.353787f,  0.331190f,  0.304634f,  0.279993f,  0.278156f,  0.276074f,
+    0.228024f,  0.094189f,  -0.080371f, -0.217032f, -0.282821f, -0.279489f,
+    -0.248194f, -0.243279f, -0.238653f, -0.212380f, -0.198372f, -0.121671f,
+    -0.018865f, 0.066316f,  0.112984f,  0.096829f,  0.102320f,  0.187298f,
+    0.086297f,  -0.064090f, -0.143777f, -0.166538f, -0.120924f, -0.022996f,
+    0.097516f,  0.232529f,  -0.197961f, -0.208131f, -0.206170f, -0.200562f,
+    -0.171796f, -0.112920f, -0.043037f, -0.021158f, -0.035741f, -0.034767f,
+    -0.010179f, -0.015197f, -0.106400f, -0.199700f, -0.179731f, -0.050127f,
+    0.034187f,  -0.011821f, -0.096736f, -0.204947f, -0.325868f, -0.348005f,
+    -0.138766f, 0.334182f,  0.813102f,  0.914260f,  0.581889f,  0.090517f,
+    -0.303582f, -0.480757f, -0.492088f, -0.294941f, -0.025422f, 0.106184f,
+    0.141243f,  0.138622f,  0.099615f,  0.050957f,  -0.007588f, -0.020205f,
+    -0.024137f, -0.064438f, 0.008990f,  0.035904f,  0.025702f,  0.037662f,
+    -0.024302f, -0.017099f, 0.040731f,  0.032712f,  0.001614f,  -0.010585f,
+    -0.008570f, 0.049238f,  0.072327f,  -0.016693f, -0.489372f, -0.481321f,
+    -0.452499f, -0.372801f, -0.229573f, -0.113265f, -0.099201f, -0.111567f,
+    -0.029862f, 0.083695f,  0.129223f,  0.104103f,  0.076784f,  0.097883f,
+    0.168921f,  0.280918f,  0.387292f,  0.379072f,  0.256499f,  0.113973f,
+    0.034397f,  0.059990f,  0.140864f,  0.187467f,  0.206398f,  0.244651f,
+    0.310931f,  0.359450f,  0.303094f,  0.123014f,  -0.085543f, -0.217772f,
+    -0.229152f, -0.173515f, -0.121572f, -0.085746f, -0.069492f, -0.066090f,
+    -0.048149f, 0.008686f,  0.061633f,  0.115295f,  0.114971f,  0.019988f,
+    -0.015677f, 0.033006f,  0.064008f,  0.109210f,  0.157389f,  0.195669f,
+    0.226241f,  0.203998f,  0.216164f,  0.255879f,  0.238074f,  0.125398f,
+    -1.933836f, -0.748182f, 0.089731f,  0.433488f,  0.503850f,  0.378508f,
+    0.331326f,  0.302404f,  0.267810f,  0.179626f,  0.154361f,  0.164845f,
+    0.112538f,  0.099938f,  0.113771f,  0.054159f,  0.020885f,  0.044467f,
+    0.050870f,  0.075927f,  0.072434f,  0.050436f,  0.009024f,  -0.018903f,
+    -0.005549f, -0.013092f, -0.056893f, 0.009060f,  0.014925f,  0.013970f,
+    0.042630f,  -0.021730f, -0.076085f, -0.033741f, -0.003387f, 0.001462f,
+    -0.017691f, -0.026838f, -0.100441f, -0.112328f, -0.114391f, -0.149728f,
+    -0.130613f, -0.103978f, -0.057317f, -0.087122f, -0.203265f, -0.250872f,
+    -0.206066f, -0.203733f, -0.204028f, -0.231015f, -0.246215f, -0.174860f,
+    -0.129949f, -0.030537f, -0.346171f, -0.145813f, 0.109935f,  0.269700f,
+    0.273024f,  0.166854f,  0.044556f,  -0.010499f, -0.023408f, -0.016506f,
+    0.050692f,  0.119650f,  0.017544f,  -0.259655f, -0.448853f, -0.332495f,
+    0.026766f,  0.336715f,  0.275057f,  -0.118418f, -0.421987f, -0.306892f,
+    0.139498f,  0.603947f,  0.802601f,  0.670098f,  0.297413f,  -0.155171f,
+    -0.492989f, -0.586206f, -0.469629f, -0.242200f, -0.078886f, 0.002911f,
+    0.026810f,  0.000071f,  -0.005120f, -0.006702f, -0.062896f, -0.102426f,
+    -0.128983f, -0.143998f, -0.078257f, 0.035038f,  0.032069f,  0.015426f,
+    0.050830f,  0.044965f,  -0.026266f, -0.070586f, -0.126106f, -0.075743f,
+    0.024603f,  0.039565f,  0.126112f,  0.435688f,  -1.034077f, -0.579228f,
+    -0.236676f, -0.059002f, 0.012949f,  -0.039982f, -0.100958f, -0.129994f,
+    -0.119764f, -0.115828f, -0.098039f, -0.087478f, -0.167183f, -0.268820f,
+    -0.291475f, -0.244487f, -0.180919f, -0.178592f, -0.193254f, -0.180367f,
+    -0.192980f, -0.222769f, -0.228945f, -0.190956f, -0.127947f, -0.077009f,
+    -0.060437f, -0.055700f, -0.075841f, -0.132291f, -0.141840f, -0.096860f,
+    -0.129977f, -0.197968f, -0.194246f, -0.195659f, -0.262311f, -0.340244f,
+    -0.424437f, -0.364323f, -0.300311f, -0.353283f, -0.203563f, -0.196099f,
+    -0.208669f, -0.241245f, -0.157649f, -0.117871f, -0.080572f, -0.166288f,
+    -0.182422f, -0.139255f, -0.245544f, -0.199769f, -0.002494f, 0.035623f,
+    0.087210f,  -0.112357f, -0.248061f, -0.236516f, -0.066462f, 0.228771f,
+    0.503089f,  0.651334f,  0.635000f,  0.495947f,  0.278079f,  -0.030320f,
+    -0.406877f, -0.732879f, -0.875972f, -0.777690f, -0.455657f, -0.007973f,
+    0.358577f,  0.486051f,  0.411669f,  0.257874f,  0.104563f,  -0.010383f,
+    -0.075825f, -0.089823f, -0.056560f, -0.019744f, -0.004835f, -0.019276f,
+    -0.033514f, -0.028265f, 0.003246f,  0.057260f,  0.077447f,  0.035143f,
+    -0.017765f, -0.073333f, -0.192803f, -0.282289f, -0.270607f, -0.157769f,
+    -0.069201f, 0.005917f,  0.108237f,  0.188540f,  0.194181f,  0.155184f,
+    0.143495f,  0.193516f,  0.182094f,  0.075298f,  -0.011759f, -0.083172f,
+    -0.179857f, -0.280921f, 0.083854f,  0.042519f,  0.004642f,  0.007910f,
+    0.025037f,  0.032023f,  0.014820f,  0.022006f,  0.043408f,  0.064439f,
+    0.035197f,  -0.007329f, 0.019527f,  0.049889f,  0.005210f,  -0.046273f,
+    -0.025745f, -0.010137f, -0.012751f, 0.005652f,  0.005244f,  0.005228f,
+    0.022040f,  0.038572f,  0.074304f,  0.084994f,  0.066392f,  0.060338f,
+    0.064954f,  0.030547f,  -0.010355f, -0.005171f, 0.047812f,  0.059868f,
+    0.018360f,  -0.020264f, -0.031611f, 0.007315f,  0.078219f,  0.129482f,
+    0.158234f,  0.153762f,  0.120688f,  0.061802f,  0.000467f,  -0.042973f,
+    -0.119538f, -0.202582f, -0.274754f, -0.259772f, -0.131170f, 0.004077f,
+    0.077601f,  0.090395f,  0.063563f,  0.036594f,  -0.636447f, -0.450883f,
+    -0.187153f, 0.089269f,  0.322378f,  0.444321f,  0.438536f,  0.349616f,
+    0.253622f,  0.156864f,  0.067534f,  0.031879f,  0.040463f,  0.018662f,
+    -0.064282f, -0.176803f, -0.306968f, -0.415257f, -0.490258f, -0.565179f,
+    -0.628136f, -0.599122f, -0.442080f, -0.226496f, -0.061630f, -0.004870f,
+    -0.020575f, -0.050912f, -0.070345f, -0.079757f, -0.089763f, -0.082766f,
+    -0.055381f, -0.031167f, -0.029997f, -0.021060f, 0.043301f,  0.097694f,
+    0.094468f,  0.068164f,  0.073044f,  0.079747f,  0.066803f,  0.059262f,
+    0.077869f,  0.067003f,  0.028458f,  -0.006017f, -0.058827f, -0.076089f,
+    0.000839f,  0.051878f,  -0.005012f, -0.029707f, -0.036410f, -0.073880f,
+    0.035493f,  0.003664f,  -0.031190f, -0.047440f, -0.049493f, -0.025675f,
+    -0.001909f, 0.005740f,  0.005381f,  0.018009f,  0.025757f,  0.014554f,
+    -0.011810f, -0.044040f, -0.059359f, -0.046939f, -0.019753f, 0.060992f,
+    0.186031f,  0.235325f,  0.170132f,  0.064020f,  0.026814f,  0.079726f,
+    0.137570f,  0.155344f,  0.120073f,  0.051722f,  0.006435f,  -0.002049f,
+    -0.009376f, -0.057654f, -0.150472f, -0.284732f, -0.417948f, -0.505420f,
+    -0.578112f, -0.625167f, -0.505813f, -0.255363f, -0.051086f, 0.148316f,
+    0.273144f,  0.342885f,  0.418721f,  0.439183f,  0.434823f,  0.287289f,
+    0.037300f,  -0.166435f, -0.255102f, -0.241326f, -0.202836f, -0.227170f,
+    -0.139410f, 0.158250f,  -0.002749f, -0.002748f, -0.002749f, -0.002747f,
+    -0.002750f, -0.002746f, -0.002751f, -0.002745f, -0.002753f, -0.002744f,
+    -0.002754f, -0.002743f, -0.002755f, -0.002742f, -0.002756f, -0.002741f,
+    -0.002757f, -0.002740f, -0.002758f, -0.002739f, -0.002757f, -0.002740f,
+    -0.002756f, -0.002742f, -0.002755f, -0.002743f, -0.002754f, -0.002743f,
+    -0.002754f, -0.002743f, -0.002753f, -0.002745f, -0.002752f, -0.002746f,
+    -0.002750f, -0.002747f, -0.002750f, -0.002747f, -0.002750f, -0.002748f,
+    -0.002749f, -0.002749f, -0.002748f, -0.002750f, -0.002747f, -0.002751f,
+    -0.002746f, -0.002751f, -0.002746f, -0.002751f, -0.002746f, -0.002750f,
+    -0.002747f, -0.002750f, -0.002748f, -0.002749f, 0.042189f,  0.081140f,
+    0.121565f,  0.136770f,  0.111309f,  0.061385f,  0.026277f,  0.004752f,
+    -0.010577f, -0.009144f, -0.007658f, -0.032247f, -0.063375f, -0.097795f,
+    -0.151166f, -0.197776f, -0.195858f, -0.149307f, -0.095145f, -0.052083f,
+    -0.020432f, -0.008224f, -0.016431f, -0.022754f, -0.000750f, 0.052860f,
+    0.106058f,  0.098031f,  0.027392f,  -0.046425f, -0.091801f, -0.064030f,
+    0.057070f,  0.196892f,  0.290295f,  0.304309f,  0.230697f,  0.089676f,
+    -0.060187f, -0.158558f, -0.229598f, -0.283361f, -0.235114f, -0.113605f,
+    0.072129f,  0.237933f,  0.238615f,  0.145755f,  0.098217f,  0.137643f,
+    0.167965f,  0.176366f,  0.184067f,  0.135467f,  0.123005f,  0.165093f,
+    -0.407255f, -0.083216f, 0.157987f,  0.245824f,  0.255270f,  0.198759f,
+    0.147923f,  0.111468f,  0.081433f,  0.052455f,  0.043622f,  0.039826f,
+    0.040341f,  0.054019f,  0.058554f,  0.031546f,  0.000187f,  -0.030258f,
+    -0.102330f, -0.205467f, -0.286086f, -0.289303f, -0.210390f, -0.090719f,
+    0.002441f,  0.024468f,  -0.019784f, -0.069399f, -0.115243f, -0.167960f,
+    -0.235437f, -0.291819f, -0.319337f, -0.354963f, -0.298677f, -0.140332f,
+    -0.101393f, -0.176110f, -0.291914f, -0.373295f, -0.436672f, -0.389649f,
+    -0.265830f, -0.235434f, -0.308958f, -0.340677f, -0.376081f, -0.464192f,
+    -0.373430f, -0.291860f, -0.164106f, -0.024450f, 0.144456f,  0.388826f,
+    0.666115f,  1.034739f,  0.108064f,  0.205412f,  0.195921f,  0.112314f,
+    0.002554f,  -0.082699f, -0.065934f, -0.058648f, -0.114207f, -0.132941f,
+    -0.107236f, -0.065437f, 0.022344f,  0.101507f,  0.131705f,  0.138649f,
+    0.125218f,  0.101901f,  0.067155f,  0.039158f,  0.041471f,  0.078517f,
+    0.071294f,  0.007126f,  0.003700f,  0.084664f,  0.159301f,  0.197186f,
+    0.184887f,  0.142044f,  0.121283f,  0.135573f,  0.143928f,  0.095275f,
+    0.048050f,  0.064972f,  0.090023f,  0.063562f,  0.004601f,  -0.041789f,
+    -0.100472f, -0.118642f, -0.064669f, -0.060690f, -0.115454f, -0.225757f,
+    -0.375867f, -0.447746f, -0.481016f, -0.685627f, -0.873388f, -0.990661f,
+    -1.108661f, -1.014765f, -0.648363f, -0.352703f, 0.178857f,  0.058704f,
+    -0.007487f, -0.015052f, 0.018440f,  0.052749f,  0.076129f,  0.099440f,
+    0.101033f,  0.047460f,  0.003294f,  0.022166f,  0.048614f,  0.014645f,
+    -0.026317f, 0.005895f,  0.057707f,  0.044384f,  -0.006169f, -0.053493f,
+    -0.085951f, -0.057299f, 0.004172f,  0.047035f,  0.082282f,  0.130509f,
+    0.179253f,  0.207958f,  0.215098f,  0.157417f,  0.056403f,  0.026392f,
+    0.009929f,  0.010767f,  0.030014f,  0.001668f,  -0.052652f, -0.105547f,
+    -0.155987f, -0.220822f, -0.245341f, -0.196942f, -0.097958f, -0.049818f,
+    0.093515f,  0.163024f,  0.130584f,  0.142026f,  0.169145f,  0.162874f,
+    0.172834f,  0.101758f,  -0.002971f, -0.058317f, -0.154549f, -0.458848f,
+    0.292062f,  0.193214f,  0.083644f,  0.004232f,  -0.035912f, -0.040925f,
+    -0.037841f, -0.052827f, -0.105894f, -0.153022f, -0.195045f, -0.231427f,
+    -0.228737f, -0.136643f, 0.036356f,  0.189111f,  0.175520f,  -0.002871f,
+    -0.161682f, -0.176984f, -0.087519f, -0.027431f, -0.044409f, -0.079096f,
+    -0.078777f, -0.062963f, -0.103232f, -0.222476f, -0.341189f, -0.362321f,
+    -0.256702f, -0.058189f, 0.131700f,  0.234189f,  0.276402f,  0.283165f,
+    0.268616f,  0.245083f,  0.171126f,  0.062524f,  -0.059998f, -0.133777f,
+    -0.136782f, -0.123460f, -0.089913f, -0.026694f, 0.044163f,  0.101855f,
+    0.038435f,  0.004372f,  0.072890f,  0.049792f,  0.003609f,  0.011337f,
+    -0.123387f, -0.389568f, 0.080553f,  0.085233f,  0.111757f,  0.123316f,
+    0.113171f,  0.123814f,  0.177261f,  0.253788f,  0.282007f,  0.240095f,
+    0.129974f,  0.003029f,  -0.049442f, -0.031544f, -0.032206f, -0.114624f,
+    -0.278560f, -0.501000f, -0.763716f, -1.008150f, -1.116742f, -0.997430f,
+    -0.664897f, -0.233286f, 0.164814f,  0.436467f,  0.509953f,  0.406113f,
+    0.260387f,  0.153354f,  0.090131f,  0.057285f,  0.031233f,  0.048344f,
+    0.036861f,  -0.058329f, -0.142409f, -0.184007f, -0.195490f, -0.157580f,
+    -0.137631f, -0.077667f, 0.002843f,  0.089777f,  0.160770f,  0.192375f,
+    0.182690f,  0.124087f,  0.053880f,  0.025034f,  0.019353f,  0.075609f,
+    0.170909f,  0.185440f,  0.147612f,  0.159850f,  0.038036f,  0.046681f,
+    0.081847f,  0.127056f,  0.151370f,  0.125091f,  0.059085f,  0.015658f,
+    0.027625f,  0.047490f,  0.064759f,  0.079783f,  0.074040f,  0.031966f,
+    -0.026166f, -0.095873f, -0.164611f, -0.188691f, -0.135449f, -0.019848f,
+    0.068600f,  0.045629f,  -0.053893f, -0.134711f, -0.155642f, -0.129839f,
+    -0.054815f, 0.093658f,  0.306547f,  0.496992f,  0.568770f,  0.510295f,
+    0.411473f,  0.306863f,  0.214670f,  0.168471f,  0.125984f,  0.018359f,
+    -0.124652f, -0.180107f, -0.122269f, -0.021388f, 0.017454f,  0.033830f,
+    0.035580f,  -0.011472f, -0.015734f, 0.016025f,  -0.031440f, -0.068246f,
+    -0.006326f, 0.108352f,  0.160042f,  0.144276f,  0.169755f,  0.282612f,
+    -0.254211f, -0.235749f, -0.244332f, -0.273359f, -0.292794f, -0.289350f,
+    -0.263691f, -0.220979f, -0.165168f, -0.105480f, -0.055547f, 0.014402f,
+    0.104757f,  0.160955f,  0.161161f,  0.126077f,  0.059982f,  -0.015456f,
+    -0.045402f, -0.018242f, 0.028209f,  0.063535f,  0.071747f,  0.030104f,
+    -0.055529f, -0.134089f, -0.172802f, -0.165872f, -0.120806f, -0.072451f,
+    -0.046938f, -0.045937f, -0.041426f, -0.022059f, 0.027156f,  0.085129f,
+    0.031651f,  -0.165824f, -0.397949f, -0.598581f, -0.620253f, -0.459903f,
+    -0.321857f, -0.140240f, 0.064760f,  0.212392f,  0.361453f,  0.449786f,
+    0.362582f,  0.229482f,  0.152953f,  0.053730f,  -0.031486f, -0.035247f,
+    0.025809f,  0.123546f,  -0.345311f, -0.248865f, -0.101419f, 0.032316f,
+    0.109207f,  0.160989f,  0.194507f,  0.189258f,  0.164561f,  0.128701f,
+    0.135375f,  0.179970f,  0.173278f,  0.062591f,  -0.056926f, -0.065070f,
+    -0.031116f, -0.055983f, -0.149963f, -0.303896f, -0.505759f, -0.707932f,
+    -0.823014f, -0.814060f, -0.668640f, -0.417638f, -0.160753f, 0.007871f,
+    0.055454f,  0.048048f,  0.053145f,  0.064440f,  0.056742f,  0.005742f,
+    -0.029213f, -0.019701f, 0.004719f,  0.040941f,  0.072442f,  0.063960f,
+    0.052898f,  0.034001f,  0.005063f,  0.038839f,  0.102511f,  0.167485f,
+    0.233330f,  0.243507f,  0.196702f,  0.115635f,  0.114634f,  0.181889f,
+    0.186133f,  0.114947f,  0.084100f,  0.084902f,  0.403111f,  0.146124f,
+    -0.163644f, -0.421727f, -0.582208f, -0.620981f, -0.540870f, -0.379245f,
+    -0.228415f, -0.157540f, -0.159219f, -0.147376f, -0.035446f, 0.182397f,
+    0.340971f,  0.274321f,  0.046881f,  -0.115088f, -0.077884f, 0.098915f,
+    0.256691f,  0.252736f,  0.090366f,  -0.093982f, -0.178014f, -0.177047f,
+    -0.169991f, -0.159657f, -0.072861f, 0.084992f,  0.246130f,  0.354048f,
+    0.372729f,  0.289721f,  0.113873f,  -0.080556f, -0.209090f, -0.266109f,
+    -0.267465f, -0.184263f, -0.054821f, 0.049184f,  0.084910f,  0.094314f,
+    0.063127f,  -0.042617f, -0.166493f, -0.163414f, -0.093900f, -0.020533f,
+    0.078731f,  0.148715f,  0.193497f,  0.282164f,  0.369039f,  0.428971f,
+    0.146842f,  0.070591f,  -0.026623f, -0.102564f, -0.128691f, -0.079989f,
+    -0.024447f, 0.009538f,  0.062400f,  0.085190f,  0.019816f,  -0.049048f,
+    -0.010010f, 0.123220f,  0.167433f,  0.055368f,  -0.081216f, -0.130944f,
+    -0.081604f, -0.013121f, 0.011631f,  -0.009475f, -0.057262f, -0.055543f,
+    0.020948f,  0.093292f,  0.102820f,  0.083608f,  0.074322f,  0.070046f,
+    0.062065f,  0.035997f,  -0.024935f, -0.109530f, -0.148210f, -0.132269f,
+    -0.107545f, 0.008187f,  0.200903f,  0.337686f,  0.451955f,  0.512908f,
+    0.482020f,  0.453158f,  0.357887f,  0.148977f,  -0.077042f, -0.301376f,
+    -0.381941f, -0.462545f, -0.461641f, -0.249117f, 0.024139f,  0.137317f,
+    0.247635f,  0.564573f,  0.536432f,  0.553892f,  0.475546f,  0.306655f,
+    0.125838f,  0.012811f,  0.018803f,  0.054431f,  0.042663f,  0.007844f,
+    -0.020632f, -0.040396f, -0.020789f, 0.033165f,  0.062555f,  0.041010f,
+    -0.004702f, -0.013236f, 0.042625f,  0.131529f,  0.170395f,  0.112053f,
+    -0.026323f, -0.178724f, -0.290420f, -0.366417f, -0.432015f, -0.485001f,
+    -0.503737f, -0.476047f, -0.427001f, -0.369812f, -0.305591f, -0.266445f,
+    -0.253759f, -0.230614f, -0.235335f, -0.242352f, -0.213832f, -0.166502f,
+    -0.116988f, -0.078338f, -0.060880f, -0.083569f, -0.135111f, -0.116158f,
+    -0.151749f, -0.148615f, -0.097103f, -0.118482f, -0.149018f, -0.120511f,
+    -0.045985f, -0.053976f, -0.088495f, -0.036172f, 0.105726f,  -0.089881f,
+    -0.207862f, -0.213647f, -0.135943f, -0.074897f, -0.031355f, 0.016305f,
+    0.061026f,  0.100217f,  0.118001f,  0.108845f,  0.078979f,  0.048427f,
+    0.025630f,  0.035766f,  0.114316f,  0.212798f,  0.275037f,  0.314573f,
+    0.270168f,  0.097529f,  -0.039828f, -0.077333f, -0.105953f, -0.171482f,
+    -0.202946f, -0.148408f, -0.054487f, 0.022951f,  0.057231f,  0.076415f,
+    0.075737f,  0.008052f,  -0.140281f, -0.274349f, -0.394921f, -0.474136f,
+    -0.449265f, -0.298886f, -0.157830f, -0.015160f, 0.093625f,  0.139298f,
+    0.233438f,  0.281899f,  0.403761f,  0.525799f,  0.451280f,  0.405151f,
+    0.464134f,  0.439678f,  0.442715f,  0.503371f,  0.449625f,  0.136918f,
+    -0.067701f, -0.020646f, 0.049115f,  0.081853f,  0.066576f,  0.016486f,
+    -0.041740f, -0.102126f, -0.122427f, -0.049757f, 0.057515f,  0.120571f,
+    0.148358f,  0.131400f,  0.033973f,  -0.112462f, -0.257931f, -0.332335f,
+    -0.287187f, -0.188260f, -0.166911f, -0.257180f, -0.378949f, -0.434833f,
+    -0.374777f, -0.232531f, -0.087390f, 0.064474f,  0.273192f,  0.402853f,
+    0.430662f,  0.380794f,  0.299216f,  0.229408f,  0.178612f,  0.158751f,
+    0.106815f,  0.031967f,  0.025424f,  0.083469f,  0.077694f,  0.030002f,
+    0.021320f,  0.066395f,  0.083425f,  0.050351f,  0.024756f,  0.057744f,
+    0.057865f,  -0.021493f, -0.087667f, -0.021426f, 0.004187f,  -0.060433f,
+    0.070519f,  0.511937f,  -0.008830f, -0.004240f, 0.023469f,  0.045651f,
+    0.044951f,  0.048942f,  0.046588f,  0.024470f,  -0.011273f, -0.076091f,
+    -0.122336f, -0.090111f, -0.008331f, 0.048898f,  0.081601f,  0.111933f,
+    0.132516f,  0.095412f,  0.008933f,  -0.022540f, 0.021326f,  0.015470f,
+    -0.138150f, -0.426289f, -0.751785f, -1.006797f, -1.127818f, -1.098640f,
+    -0.945479f, -0.698035f, -0.394082f, -0.110742f, 0.060392f,  0.098441f,
+    0.034093f,  -0.048993f, -0.093303f, -0.094454f, -0.054290f, -0.017000f,
+    0.006961f,  0.013875f,  0.041391f,  0.115306f,  0.118318f,  0.098985f,
+    0.098063f,  0.101252f,  0.010079f,  -0.021267f, -0.010175f, -0.000711f,
+    -0.004384f, -0.025658f, -0.062298f, -0.044472f, 0.635551f,  0.351805f,
+    -0.015507f, -0.386582f, -0.722253f, -0.896834f, -0.822232f, -0.481155f,
+    0.010846f,  0.480247f,  0.791996f,  0.874602f,  0.724301f,  0.425951f,
+    0.150836f,  -0.004216f, -0.087345f, -0.157024f, -0.223812f, -0.238228f,
+    -0.174550f, -0.094740f, -0.054369f, -0.046703f, -0.025392f, 0.015151f,
+    0.032406f,  0.020927f,  0.033187f,  0.053954f,  0.035940f,  0.000378f,
+    -0.041178f, -0.058739f, -0.047181f, -0.027715f, 0.055801f,  0.117942f,
+    0.036273f,  -0.065656f, -0.076644f, -0.049567f, -0.027759f, -0.046663f,
+    -0.037233f, -0.074295f, -0.126020f, -0.083340f, 0.002251f,  0.068978f,
+    0.093118f,  0.091896f,  0.048086f,  -0.059866f, -0.140368f, -0.240400f,
+    -0.002193f, -0.002182f, -0.002196f, -0.002178f, -0.002201f, -0.002174f,
+    -0.002205f, -0.002170f, -0.002208f, -0.002167f, -0.002211f, -0.002165f,
+    -0.002213f, -0.002163f, -0.002216f, -0.002159f, -0.002221f, -0.002152f,
+    -0.002228f, -0.002144f, -0.002237f, -0.002136f, -0.002244f, -0.002131f,
+    -0.002246f, -0.002133f, -0.002240f, -0.002141f, -0.002229f, -0.002154f,
+    -0.002216f, -0.002168f, -0.002202f, -0.002182f, -0.002188f, -0.002196f,
+    -0.002173f, -0.002212f, -0.002157f, -0.002228f, -0.002142f, -0.002241f,
+    -0.002130f, -0.002250f, -0.002124f, -0.002254f, -0.002123f, -0.002252f,
+    -0.002127f, -0.002246f, -0.002137f, -0.002233f, -0.002151f, -0.002220f,
+    -0.002161f, -0.002209f, 0.021924f,  0.024002f,  0.030847f,  0.052569f,
+    0.088160f,  0.130448f,  0.166659f,  0.193657f,  0.211986f,  0.217861f,
+    0.171194f,  0.033521f,  -0.141362f, -0.236895f, -0.178568f, -0.026739f,
+    0.065401f,  -0.020108f, -0.231348f, -0.406507f, -0.438222f, -0.346390f,
+    -0.235112f, -0.174437f, -0.134372f, -0.086364f, -0.052893f, -0.040993f,
+    -0.022290f, 0.016474f,  0.035272f,  0.007655f,  -0.086763f, -0.228841f,
+    -0.312409f, -0.292898f, -0.243326f, -0.122989f, 0.120981f,  0.355918f,
+    0.421048f,  0.401565f,  0.340557f,  0.254677f,  0.095187f,  -0.093687f,
+    -0.156865f, -0.132704f, -0.157714f, -0.159018f, -0.135599f, -0.217317f,
+    -0.324296f, -0.347863f, -0.452508f, -0.667929f, -0.000971f, -0.000928f,
+    -0.000973f, -0.000932f, -0.000967f, -0.000938f, -0.000961f, -0.000944f,
+    -0.000955f, -0.000948f, -0.000953f, -0.000949f, -0.000953f, -0.000948f,
+    -0.000955f, -0.000946f, -0.000957f, -0.000944f, -0.000959f, -0.000943f,
+    -0.000959f, -0.000943f, -0.000958f, -0.000946f, -0.000954f, -0.000951f,
+    -0.000948f, -0.000957f, -0.000941f, -0.000964f, -0.000934f, -0.000972f,
+    -0.000926f, -0.000980f, -0.000918f, -0.000987f, -0.000912f, -0.000992f,
+    -0.000909f, -0.000993f, -0.000908f, -0.000995f, -0.000906f, -0.000996f,
+    -0.000905f, -0.000997f, -0.000905f, -0.000996f, -0.000907f, -0.000994f,
+    -0.000909f, -0.000992f, -0.000911f, -0.000990f, -0.000913f, -0.000982f,
+    -0.247739f, -0.239815f, -0.212848f, -0.201286f, -0.215358f, -0.219677f,
+    -0.220523f, -0.184500f, -0.086969f, -0.030001f, -0.016359f, 0.011705f,
+    0.037257f,  0.030610f,  0.051465f,  0.072998f,  0.028724f,  -0.030433f,
+    -0.033844f, 0.003875f,  0.046205f,  0.095735f,  0.114938f,  0.098715f,
+    0.068513f,  0.023293f,  -0.022618f, -0.050473f, -0.082257f, -0.156406f,
+    -0.266220f, -0.310030f, -0.329932f, -0.285789f, -0.289989f, -0.350803f,
+    -0.413050f, -0.422009f, -0.390961f, -0.403991f, -0.343331f, -0.338507f,
+    -0.208736f, -0.120262f, -0.064635f, 0.003609f,  0.055813f,  0.114324f,
+    0.113215f,  0.043008f,  -0.045312f, 0.011609f,  -0.064863f, -0.198126f,
+    -0.114852f, -0.158676f, -0.373609f, -0.271138f, -0.170638f, -0.068839f,
+    0.013823f,  0.046468f,  0.048802f,  0.038340f,  0.001167f,  -0.053788f,
+    -0.079060f, -0.040444f, 0.009963f,  0.011166f,  -0.030768f, -0.027886f,
+    0.051447f,  0.111089f,  0.066550f,  -0.033315f, -0.073618f, -0.006228f,
+    0.095388f,  0.168688f,  0.167602f,  0.078930f,  -0.067714f, -0.198044f,
+    -0.245033f, -0.208303f, -0.126780f, -0.074980f, -0.036151f, 0.076719f,
+    0.217163f,  0.306747f,  0.336740f,  0.299169f,  0.263083f,  0.277070f,
+    0.309021f,  0.323921f,  0.286056f,  0.237703f,  0.148601f,  -0.062465f,
+    -0.295446f, -0.389165f, -0.291310f, -0.274870f, -0.297926f, -0.133246f,
+    0.009876f,  -0.048491f, -0.070891f, 0.108079f,  0.276246f,  0.209902f,
+    0.137209f,  0.054497f,  -0.041403f, -0.139219f, -0.222320f, -0.256577f,
+    -0.242831f, -0.233936f, -0.251386f, -0.224700f, -0.098230f, 0.100689f,
+    0.267959f,  0.300675f,  0.210123f,  0.090480f,  -0.007794f, -0.033483f,
+    0.062394f,  0.248721f,  0.416438f,  0.467699f,  0.365352f,  0.147899f,
+    -0.077245f, -0.234334f, -0.301726f, -0.277115f, -0.204152f, -0.126044f,
+    -0.046670f, 0.042223f,  0.097997f,  0.128868f,  0.156441f,  0.165677f,
+    0.086255f,  -0.038509f, -0.144105f, -0.215200f, -0.272028f, -0.260366f,
+    -0.220195f, -0.194496f, -0.115131f, -0.007706f, 0.066128f,  0.068490f,
+    0.002124f,  -0.050185f, 0.025631f,  0.164660f,  0.230917f,  0.203048f,
+    -0.109917f, -0.162346f, -0.198883f, -0.207365f, -0.181510f, -0.120432f,
+    -0.061355f, -0.026211f, 0.000388f,  0.039123f,  0.082191f,  0.114628f,
+    0.095230f,  -0.025038f, -0.158047f, -0.178411f, -0.082585f, 0.027912f,
+    0.046078f,  -0.004866f, -0.035997f, -0.024157f, 0.001097f,  0.029486f,
+    0.058758f,  0.067419f,  0.045454f,  -0.004907f, -0.062528f, -0.064290f,
+    -0.030891f, -0.012556f, -0.030957f, -0.061085f, -0.102866f, -0.129695f,
+    -0.097069f, 0.008504f,  0.126584f,  0.256453f,  0.414045f,  0.432112f,
+    0.358024f,  0.286087f,  0.191281f,  0.101622f,  0.021015f,  -0.015210f,
+    -0.105516f, -0.193918f, -0.222584f, -0.191721f, -0.249599f, -0.246925f,
+    -0.228450f, -0.321562f, 0.027127f,  -0.107323f, -0.187155f, -0.132876f,
+    0.034329f,  0.232601f,  0.288828f,  0.173309f,  -0.006156f, -0.182399f,
+    -0.286887f, -0.200297f, 0.049652f,  0.282650f,  0.406806f,  0.478708f,
+    0.497283f,  0.386046f,  0.168553f,  -0.050511f, -0.245259f, -0.466329f,
+    -0.690805f, -0.809678f, -0.713061f, -0.400168f, -0.006075f, 0.289034f,
+    0.395689f,  0.334857f,  0.173909f,  0.018109f,  -0.073198f, -0.124065f,
+    -0.100673f, 0.014023f,  0.155258f,  0.245773f,  0.288550f,  0.307242f,
+    0.245452f,  0.075327f,  -0.122050f, -0.191119f, -0.200762f, -0.211914f,
+    -0.135401f, -0.074961f, -0.024655f, 0.086613f,  0.117992f,  0.087428f,
+    0.087499f,  0.085232f,  0.023486f,  -0.023788f, -0.004576f, -0.133071f,
+    -0.183817f, -0.156988f, -0.114489f, -0.111221f, -0.152131f, -0.189744f,
+    -0.189415f, -0.142943f, -0.102979f, -0.041877f, 0.037762f,  0.048685f,
+    -0.036113f, -0.158396f, -0.225854f, -0.170964f, -0.059701f, -0.002886f,
+    -0.018908f, -0.043684f, -0.011749f, 0.012972f,  -0.025671f, -0.055372f,
+    -0.021240f, 0.023396f,  0.046875f,  0.050426f,  0.044257f,  0.036660f,
+    0.034765f,  0.029082f,  0.044198f,  0.090508f,  0.095737f,  0.045395f,
+    -0.022333f, -0.174806f, -0.310763f, -0.288039f, -0.175377f, -0.098525f,
+    -0.044720f, 0.095618f,  0.333752f,  0.412911f,  0.363337f,  0.320047f,
+    0.238974f,  0.226679f,  0.362479f,  0.341063f,  0.294386f,  0.399756f,
+    0.003851f,  0.042335f,  0.042936f,  0.020568f,  0.019267f,  0.043575f,
+    0.080137f,  0.098881f,  0.057453f,  -0.046403f, -0.146160f, -0.161999f,
+    -0.103904f, -0.027217f, 0.032918f,  0.043382f,  -0.005146f, -0.098766f,
+    -0.151072f, -0.074076f, 0.082484f,  0.186527f,  0.177680f,  0.103955f,
+    0.047777f,  0.031541f,  0.038821f,  0.060392f,  0.070681f,  0.053037f,
+    0.027557f,  0.011036f,  -0.008178f, -0.024002f, -0.036792f, -0.026948f,
+    -0.022103f, -0.052739f, -0.089025f, -0.146454f, -0.176586f, -0.187196f,
+    -0.179745f, -0.105150f, 0.062948f,  0.333370f,  0.597424f,  0.706697f,
+    0.580363f,  0.291028f,  0.043606f,  -0.156895f, -0.257139f, -0.180097f,
+    -0.181669f, -0.336801f, 0.253657f,  0.074821f,  -0.078993f, -0.123134f,
+    -0.064843f, 0.033191f,  0.078785f,  0.044783f,  0.011682f,  0.019459f,
+    0.038307f,  0.042658f,  0.009767f,  -0.073803f, -0.132768f, -0.078230f,
+    0.054193f,  0.152411f,  0.181571f,  0.137837f,  0.049571f,  -0.016433f,
+    -0.073625f, -0.095330f, -0.050192f, -0.018227f, -0.034548f, -0.022447f,
+    0.063096f,  0.095833f,  0.060577f,  0.088570f,  0.173144f,  0.250668f,
+    0.325185f,  0.414462f,  0.540131f,  0.574379f,  0.437043f,  0.129302f,
+    -0.157113f, -0.455002f, -0.669184f, -0.783210f, -0.786821f, -0.703335f,
+    -0.541354f, -0.359596f, -0.102060f, -0.005672f, 0.051871f,  0.209087f,
+    0.308437f,  0.301354f,  0.352630f,  0.607415f,  0.256592f,  0.270224f,
+    0.188913f,  0.049298f,  -0.098899f, -0.208157f, -0.221635f, -0.177084f,
+    -0.144445f, -0.126764f, -0.082556f, -0.037805f, -0.016876f, 0.011567f,
+    0.088714f,  0.130341f,  0.060040f,  -0.013486f, 0.024404f,  0.106075f,
+    0.102735f,  0.036933f,  0.005346f,  0.026663f,  0.040700f,  -0.012903f,
+    -0.115475f, -0.197689f, -0.246571f, -0.267342f, -0.315063f, -0.382310f,
+    -0.455268f, -0.537219f, -0.616547f, -0.676025f, -0.706935f, -0.723952f,
+    -0.740376f, -0.742833f, -0.718467f, -0.676316f, -0.601807f, -0.494000f,
+    -0.427368f, -0.392525f, -0.295746f, -0.157156f, -0.043437f, 0.111104f,
+    0.167786f,  0.138499f,  0.093607f,  0.002477f,  -0.154922f, -0.277790f,
+    -0.165973f, -0.012170f, 0.109247f,  0.152496f,  0.125091f,  0.024442f,
+    -0.087566f, -0.118504f, -0.083899f, -0.073450f, -0.074659f, -0.069057f,
+    -0.074879f, -0.053468f, 0.025378f,  0.101451f,  0.110636f,  0.084401f,
+    0.093586f,  0.105186f,  0.078074f,  0.062695f,  0.095293f,  0.147902f,
+    0.160830f,  0.104114f,  0.032530f,  0.013319f,  0.055652f,  0.132108f,
+    0.195922f,  0.268216f,  0.365834f,  0.446005f,  0.537917f,  0.572936f,
+    0.465006f,  0.249578f,  0.000268f,  -0.146769f, -0.225974f, -0.267718f,
+    -0.315109f, -0.358027f, -0.340063f, -0.248631f, -0.272941f, -0.266468f,
+    -0.198821f, -0.136007f, -0.019690f, 0.162094f,  0.364225f,  0.424840f,
+    0.399612f,  0.343187f,  0.146552f,  0.072898f,  -0.015956f, -0.064035f,
+    -0.056230f, -0.012169f, 0.027745f,  0.017656f,  0.007738f,  0.066823f,
+    0.134049f,  0.110379f,  0.009939f,  -0.100290f, -0.115077f, -0.013581f,
+    0.080542f,  0.041744f,  -0.062851f, -0.058034f, 0.042755f,  0.093833f,
+    0.080270f,  0.035827f,  -0.018839f, -0.042766f, -0.009673f, 0.018343f,
+    -0.009272f, 0.013054f,  0.036375f,  0.017622f,  -0.026297f, -0.049425f,
+    -0.023044f, 0.068002f,  0.056348f,  -0.005951f, -0.005448f, -0.107793f,
+    -0.127190f, 0.040200f,  0.118400f,  0.006583f,  -0.063743f, 0.053479f,
+    0.124523f,  -0.111833f, -0.437087f, -0.108082f, 0.567380f,  0.541592f,
+    0.179474f,  0.020736f,  -0.602339f, -1.428061f, 0.183135f,  0.140092f,
+    0.082436f,  -0.022421f, -0.149215f, -0.250034f, -0.321758f, -0.340095f,
+    -0.329274f, -0.288471f, -0.139294f, 0.121910f,  0.341147f,  0.370713f,
+    0.211733f,  -0.003879f, -0.052914f, 0.165974f,  0.386860f,  0.315363f,
+    -0.015005f, -0.341958f, -0.416889f, -0.209309f, 0.057618f,  0.170521f,
+    0.145622f,  0.078000f,  0.010348f,  -0.029213f, -0.036080f, -0.016702f,
+    -0.007931f, -0.026999f, -0.058988f, -0.098669f, -0.122524f, -0.119367f,
+    -0.122248f, -0.118214f, -0.088844f, -0.064102f, -0.052011f, -0.040237f,
+    -0.011275f, 0.037822f,  0.089139f,  0.126556f,  0.145494f,  0.097529f,
+    0.007670f,  0.036242f,  0.052431f,  -0.051381f, -0.095301f, -0.000035f,
+    0.076112f,  0.141015f,  0.093522f,  0.093512f,  0.098854f,  0.025867f,
+    0.040689f,  0.063353f,  0.040255f,  0.039264f,  0.043609f,  0.010056f,
+    -0.024551f, -0.035942f, -0.016973f, 0.025539f,  0.051047f,  0.028450f,
+    0.010898f,  0.045107f,  0.042623f,  0.031578f,  0.037169f,  -0.010959f,
+    -0.041565f, 0.006047f,  0.076473f,  0.093774f,  0.056236f,  0.061419f,
+    0.114461f,  0.136673f,  0.123610f,  0.124588f,  0.083947f,  -0.016337f,
+    -0.125749f, -0.181655f, -0.147774f, -0.060864f, -0.019192f, -0.063909f,
+    -0.142781f, -0.190939f, -0.205304f, -0.256945f, -0.399740f, -0.595994f,
+    -0.802271f, -1.026585f, -1.262660f, -1.475438f, -1.621257f, -1.661808f,
+    -1.729169f, -1.904920f, -0.002479f, -0.002352f, -0.002491f, -0.002350f,
+    -0.002492f, -0.002351f, -0.002488f, -0.002358f, -0.002478f, -0.002371f,
+    -0.002462f, -0.002388f, -0.002445f, -0.002404f, -0.002434f, -0.002408f,
+    -0.002436f, -0.002402f, -0.002442f, -0.002400f, -0.002437f, -0.002411f,
+    -0.002423f, -0.002426f, -0.002411f, -0.002434f, -0.002407f, -0.002433f,
+    -0.002411f, -0.002428f, -0.002416f, -0.002424f, -0.002419f, -0.002422f,
+    -0.002419f, -0.002424f, -0.002416f, -0.002428f, -0.002412f, -0.002432f,
+    -0.002409f, -0.002432f, -0.002414f, -0.002422f, -0.002427f, -0.002408f,
+    -0.002438f, -0.002403f, -0.002435f, -0.002412f, -0.002423f, -0.002423f,
+    -0.002416f, -0.002427f, -0.002415f, -0.002425f, 0.243373f,  0.061474f,
+    -0.139064f, -0.274893f, -0.299086f, -0.219596f, -0.081895f, 0.085372f,
+    0.207463f,  0.212024f,  0.086880f,  -0.085271f, -0.210542f, -0.251176f,
+    -0.204198f, -0.073010f, 0.108892f,  0.270956f,  0.362319f,  0.375273f,
+    0.304092f,  0.154214f,  -0.032834f, -0.203294f, -0.289639f, -0.244432f,
+    -0.102180f, 0.048532f,  0.165855f,  0.249428f,  0.325716f,  0.397334f,
+    0.399737f,  0.249592f,  0.013450f,  -0.122577f, -0.131358f, -0.103935f,
+    -0.086461f, -0.087344f, -0.089537f, -0.017290f, 0.059605f,  0.035073f,
+    -0.073976f, -0.186009f, -0.208025f, -0.171386f, -0.103738f, -0.015746f,
+    -0.024489f, 0.022238f,  0.189987f,  0.190715f,  0.064049f,  0.033281f,
+    -0.764045f, -0.718409f, -0.633949f, -0.503705f, -0.340000f, -0.185953f,
+    -0.070601f, -0.006972f, 0.023404f,  0.019820f,  0.001476f,  0.008821f,
+    0.040802f,  0.074537f,  0.093814f,  0.094949f,  0.094190f,  0.106301f,
+    0.141703f,  0.196362f,  0.190568f,  0.075973f,  -0.033663f, -0.036426f,
+    0.021354f,  0.060797f,  0.059621f,  0.026352f,  -0.030570f, -0.071040f,
+    -0.098375f, -0.178881f, -0.292259f, -0.333531f, -0.241197f, -0.025033f,
+    0.194034f,  0.348268f,  0.428467f,  0.399859f,  0.342519f,  0.326654f,
+    0.264220f,  0.124152f,  -0.039822f, -0.131626f, -0.091286f, -0.054121f,
+    -0.035245f, 0.064194f,  0.158072f,  0.173242f,  0.191619f,  0.181831f,
+    0.091367f,  0.019600f,  0.069012f,  0.104290f,  -0.012127f, -0.101734f,
+    -0.115143f, -0.104385f, -0.038580f, 0.013288f,  0.019178f,  0.020469f,
+    -0.001155f, -0.066138f, -0.084666f, -0.029620f, -0.033752f, -0.084296f,
+    -0.068595f, -0.037805f, -0.037247f, -0.026198f, -0.013858f, 0.012197f,
+    0.007823f,  -0.025074f, -0.018289f, -0.001214f, -0.019080f, 0.001540f,
+    0.080155f,  0.138170f,  0.139147f,  0.080358f,  0.023379f,  0.032031f,
+    0.075397f,  0.118073f,  0.129222f,  0.062748f,  -0.010649f, 0.016774f,
+    0.064477f,  0.106603f,  0.149773f,  0.154830f,  0.110065f,  -0.011126f,
+    -0.231535f, -0.397772f, -0.562943f, -0.855899f, -1.122650f, -1.311223f,
+    -1.444899f, -1.177501f, -0.917450f, -0.936357f, 0.771775f,  0.392542f,
+    0.036337f,  -0.140224f, -0.117815f, 0.018447f,  0.077028f,  -0.000945f,
+    -0.106591f, -0.096614f, -0.021770f, 0.023535f,  0.073018f,  0.197408f,
+    0.294237f,  0.250850f,  0.072144f,  -0.139017f, -0.180922f, 0.007222f,
+    0.284143f,  0.441853f,  0.364298f,  0.170334f,  0.050704f,  0.037523f,
+    0.046531f,  0.032116f,  0.079208f,  0.150281f,  0.112265f,  0.034238f,
+    -0.086521f, -0.229528f, -0.191351f, -0.031015f, 0.096299f,  0.190007f,
+    0.233124f,  0.191975f,  0.168742f,  0.033647f,  -0.075104f, -0.057198f,
+    -0.075828f, -0.038468f, -0.049260f, -0.014276f, 0.058100f,  0.171407f,
+    0.171268f,  0.063181f,  -0.024550f, -0.062059f, -0.116507f, -0.264389f,
+    -0.198173f, -0.165541f, -0.140676f, -0.117785f, -0.075940f, -0.013951f,
+    0.055668f,  0.117578f,  0.139162f,  0.129558f,  0.093320f,  0.031565f,
+    0.020821f,  0.095516f,  0.158665f,  0.149405f,  0.104976f,  0.022767f,
+    -0.092733f, -0.152177f, -0.089743f, 0.065195f,  0.187255f,  0.203016f,
+    0.158725f,  0.090075f,  0.001916f,  -0.054980f, -0.041175f, -0.001784f,
+    0.029446f,  0.048767f,  0.055866f,  0.029382f,  0.027831f,  0.119432f,
+    0.099719f,  -0.034565f, -0.053518f, -0.016222f, 0.001692f,  0.140952f,
+    0.285316f,  0.107710f,  -0.317540f, -0.306879f, 0.132374f,  0.463517f,
+    0.445404f,  0.188504f,  -0.114743f, -0.387190f, -0.366616f, -0.177521f,
+    -0.250086f, -0.565353f, -0.033863f, 0.002412f,  0.041518f,  0.065943f,
+    0.070111f,  0.006483f,  -0.098409f, -0.137514f, -0.076384f, 0.007702f,
+    0.079986f,  0.088825f,  0.013753f,  -0.055590f, -0.050245f, -0.018561f,
+    -0.025351f, -0.060282f, -0.098347f, -0.110380f, -0.073138f, 0.006530f,
+    0.077076f,  0.049662f,  -0.069778f, -0.204418f, -0.304533f, -0.347292f,
+    -0.344762f, -0.352115f, -0.415238f, -0.544458f, -0.720979f, -0.924329f,
+    -1.109881f, -1.225568f, -1.246196f, -1.180355f, -1.076527f, -0.975385f,
+    -0.890061f, -0.807596f, -0.652888f, -0.432539f, -0.199882f, -0.011399f,
+    0.075401f,  0.063808f,  0.021265f,  0.089695f,  0.160677f,  0.199212f,
+    0.232433f,  0.216084f,  0.109296f,  -0.030154f, 0.443912f,  0.433873f,
+    0.393644f,  0.294439f,  0.146973f,  -0.013759f, -0.155651f, -0.273002f,
+    -0.374818f, -0.458490f, -0.504695f, -0.519613f, -0.533728f, -0.555438f,
+    -0.560022f, -0.537587f, -0.502281f, -0.448531f, -0.369237f, -0.279270f,
+    -0.191988f, -0.108482f, -0.024042f, 0.057126f,  0.122967f,  0.160081f,
+    0.155353f,  0.106143f,  0.029839f,  -0.038416f, -0.068998f, -0.074951f,
+    -0.061798f, -0.031140f, 0.001680f,  0.007595f,  -0.014736f, -0.002220f,
+    0.056907f,  0.088320f,  0.104367f,  0.117353f,  0.108878f,  0.096002f,
+    0.086655f,  0.092531f,  0.081634f,  0.001886f,  -0.095370f, -0.148107f,
+    -0.140711f, -0.140915f, -0.171923f, -0.211863f, -0.326089f, -0.498252f,
+    0.074325f,  0.004065f,  -0.017596f, -0.037812f, -0.058971f, -0.032967f,
+    0.038491f,  0.121402f,  0.180328f,  0.192909f,  0.204967f,  0.214104f,
+    0.164961f,  0.064866f,  0.050945f,  0.157660f,  0.252554f,  0.285652f,
+    0.269682f,  0.203533f,  0.167240f,  0.203220f,  0.244773f,  0.238485f,
+    0.189702f,  0.134771f,  0.123633f,  0.173137f,  0.244750f,  0.273960f,
+    0.228191f,  0.111321f,  0.002454f,  -0.026230f, -0.030779f, -0.033490f,
+    -0.016389f, 0.043871f,  0.074450f,  0.022771f,  -0.010510f, 0.007474f,
+    0.052925f,  0.099554f,  0.062608f,  0.006076f,  0.022365f,  0.027516f,
+    0.021973f,  0.046130f,  0.052491f,  -0.060501f, -0.191996f, -0.142221f,
+    -0.111366f, -0.255375f, 0.210025f,  0.134868f,  0.027106f,  -0.060554f,
+    -0.078558f, -0.050532f, -0.012335f, 0.036877f,  0.084581f,  0.102284f,
+    0.057244f,  -0.008938f, 0.036445f,  0.235359f,  0.438056f,  0.505049f,
+    0.411249f,  0.202798f,  -0.036675f, -0.223230f, -0.298893f, -0.219400f,
+    -0.050295f, 0.061159f,  0.063795f,  0.035139f,  0.074279f,  0.200778f,
+    0.351906f,  0.431048f,  0.409388f,  0.279703f,  0.090758f,  -0.092571f,
+    -0.208554f, -0.208611f, -0.189004f, -0.193330f, -0.202353f, -0.199306f,
+    -0.134375f, -0.045962f, -0.020461f, 0.036159f,  0.145153f,  0.230408f,
+    0.231655f,  0.161521f,  0.036725f,  -0.048477f, -0.141561f, -0.143830f,
+    -0.095589f, -0.064297f, -0.008713f, 0.036250f,  0.210982f,  0.165665f,
+    0.088778f,  0.009001f,  -0.045111f, -0.075368f, -0.092305f, -0.095312f,
+    -0.070190f, -0.059313f, -0.084301f, -0.091490f, -0.019686f, 0.097951f,
+    0.149032f,  0.059260f,  -0.132306f, -0.329566f, -0.431847f, -0.382196f,
+    -0.207201f, 0.020658f,  0.215508f,  0.311970f,  0.306254f,  0.255580f,
+    0.201056f,  0.136687f,  0.059734f,  0.015095f,  -0.017396f, -0.087754f,
+    -0.182687f, -0.291484f, -0.386452f, -0.426687f, -0.432520f, -0.412473f,
+    -0.325838f, -0.220089f, -0.179170f, -0.119357f, -0.055764f, -0.076428f,
+    -0.058929f, 0.001880f,  0.069237f,  0.180590f,  0.225419f,  0.208637f,
+    0.112443f,  0.070991f,  0.068607f,  0.060030f,  0.022845f,  -0.001899f,
+    -0.235226f, -0.214026f, -0.194106f, -0.179285f, -0.140998f, -0.048041f,
+    0.072830f,  0.134139f,  0.104563f,  0.094857f,  0.159996f,  0.210855f,
+    0.189242f,  0.145334f,  0.101887f,  0.048221f,  -0.040067f, -0.094855f,
+    -0.045821f, 0.029463f,  0.040934f,  0.010599f,  0.058657f,  0.264276f,
+    0.551518f,  0.779436f,  0.800386f,  0.590637f,  0.247164f,  -0.098532f,
+    -0.370343f, -0.445226f, -0.370476f, -0.257221f, -0.153172f, -0.095803f,
+    -0.062566f, -0.028157f, 0.036867f,  0.124277f,  0.165696f,  0.106215f,
+    0.072426f,  0.061480f,  -0.056469f, -0.198364f, -0.196105f, -0.134131f,
+    -0.104361f, -0.066895f, -0.053931f, -0.069425f, -0.098956f, -0.085416f,
+    -0.099967f, -0.217281f, 0.209735f,  0.241809f,  0.202457f,  0.100347f,
+    -0.020055f, -0.074600f, -0.018630f, 0.083695f,  0.144936f,  0.165264f,
+    0.146631f,  0.093845f,  0.041618f,  -0.024488f, -0.151329f, -0.337992f,
+    -0.524606f, -0.614639f, -0.559280f, -0.393256f, -0.199745f, -0.040072f,
+    0.056753f,  0.117512f,  0.168934f,  0.174264f,  0.125259f,  0.091345f,
+    0.102860f,  0.122111f,  0.077853f,  -0.010201f, -0.045215f, 0.003986f,
+    0.050767f,  0.102201f,  0.131506f,  0.076571f,  -0.022110f, -0.101951f,
+    -0.146504f, -0.189921f, -0.179909f, -0.127981f, -0.132458f, -0.243683f,
+    -0.275079f, -0.206699f, -0.060442f, 0.083590f,  0.132647f,  0.045455f,
+    -0.071158f, -0.075993f, -0.129591f, -0.354220f, -0.327843f, -0.156156f,
+    0.038140f,  0.192264f,  0.265568f,  0.240907f,  0.171410f,  0.127964f,
+    0.123318f,  0.104194f,  0.068124f,  0.031859f,  -0.030544f, -0.101695f,
+    -0.095255f, 0.021350f,  0.204908f,  0.317795f,  0.241639f,  0.060753f,
+    -0.055994f, -0.027535f, 0.090396f,  0.192336f,  0.216729f,  0.168259f,
+    0.095174f,  0.040885f,  0.016184f,  0.026514f,  0.057734f,  0.083127f,
+    0.088411f,  0.090739f,  0.120195f,  0.154427f,  0.145876f,  0.093154f,
+    0.019563f,  -0.044265f, -0.082387f, -0.121102f, -0.165386f, -0.128892f,
+    -0.038466f, 0.060187f,  0.025561f,  -0.058250f, -0.061033f, -0.059251f,
+    -0.031148f, -0.008903f, -0.086740f, -0.169873f, -0.121738f, -0.046077f,
+    0.646960f,  0.405721f,  0.117459f,  -0.078253f, -0.142226f, -0.105522f,
+    -0.042315f, -0.044807f, -0.108240f, -0.134650f, -0.129201f, -0.174332f,
+    -0.277691f, -0.376949f, -0.454718f, -0.558398f, -0.656295f, -0.591285f,
+    -0.251869f, 0.226299f,  0.569043f,  0.612584f,  0.383043f,  0.093169f,
+    -0.046002f, -0.027399f, 0.060234f,  0.134092f,  0.160359f,  0.126043f,
+    0.076527f,  0.038960f,  0.063382f,  0.130043f,  0.152165f,  0.135283f,
+    0.076654f,  -0.024864f, -0.103712f, -0.080917f, -0.034201f, -0.030036f,
+    -0.013664f, 0.020525f,  0.010681f,  -0.008106f, -0.035498f, -0.059296f,
+    -0.104700f, -0.032687f, 0.031194f,  -0.031542f, -0.113025f, -0.043844f,
+    -0.056813f, -0.220739f, -0.174439f, -0.020556f, 0.135192f,  0.200657f,
+    0.179143f,  0.088215f,  -0.029836f, -0.157305f, -0.318968f, -0.510460f,
+    -0.668698f, -0.761983f, -0.799421f, -0.764924f, -0.634885f, -0.447949f,
+    -0.251757f, -0.051842f, 0.133683f,  0.227276f,  0.174846f,  0.001326f,
+    -0.203282f, -0.335402f, -0.371806f, -0.361015f, -0.349278f, -0.356154f,
+    -0.368368f, -0.354702f, -0.318347f, -0.253553f, -0.175467f, -0.105953f,
+    -0.078426f, -0.123935f, -0.187751f, -0.224215f, -0.251398f, -0.236020f,
+    -0.219798f, -0.246993f, -0.245453f, -0.197960f, -0.125631f, -0.034611f,
+    0.074782f,  0.118128f,  0.130565f,  0.146791f,  0.135149f,  0.025268f,
+    0.004464f,  -0.051101f, -0.172941f, -0.229815f, 1.189606f,  0.654031f,
+    0.196399f,  -0.094482f, -0.273313f, -0.332810f, -0.317083f, -0.249465f,
+    -0.166464f, -0.062229f, 0.001998f,  -0.001415f, -0.005284f, 0.005525f,
+    -0.037544f, -0.076145f, -0.035422f, 0.005470f,  0.023589f,  -0.000236f,
+    -0.053074f, -0.069836f, -0.069234f, -0.105351f, -0.121857f, -0.071175f,
+    0.009659f,  0.036034f,  0.034356f,  0.001311f,  0.003504f,  0.051170f,
+    0.053896f,  -0.052852f, -0.137662f, -0.117497f, -0.066393f, -0.008578f,
+    0.115376f,  0.184049f,  0.226292f,  0.277965f,  0.324695f,  0.323339f,
+    0.202953f,  0.105462f,  -0.006316f, -0.037671f, -0.097974f, -0.101215f,
+    -0.007992f, -0.076518f, -0.173094f, -0.048556f, 0.057255f,  -0.063215f,
+    -0.108912f, -0.071003f, 0.008463f,  0.126069f,  0.248484f,  0.320670f,
+    0.305406f,  0.218701f,  0.151210f,  0.144894f,  0.179862f,  0.197346f,
+    0.130701f,  -0.013746f, -0.125754f, -0.130178f, -0.089297f, -0.133513f,
+    -0.277914f, -0.436047f, -0.566773f, -0.684796f, -0.796154f, -0.884530f,
+    -0.902715f, -0.802030f, -0.571873f, -0.265790f, 0.029181f,  0.220686f,
+    0.280937f,  0.239407f,  0.167516f,  0.126986f,  0.119492f,  0.115261f,
+    0.105871f,  0.078278f,  0.065492f,  0.044310f,  0.047340f,  0.044660f,
+    0.042145f,  0.048931f,  0.018726f,  -0.080724f, -0.051575f, 0.006892f,
+    -0.083591f, -0.082708f, -0.045366f, -0.014543f, 0.067902f,  0.168419f,
+    0.173574f,  0.235369f,  0.495239f,  0.451065f,  0.392776f,  0.284229f,
+    0.156657f,  0.083931f,  0.088073f,  0.134260f,  0.122068f,  0.037858f,
+    -0.090754f, -0.217049f, -0.289682f, -0.287511f, -0.228414f, -0.203051f,
+    -0.331628f, -0.577857f, -0.823749f, -0.934472f, -0.773908f, -0.305732f,
+    0.290147f,  0.695637f,  0.726343f,  0.485002f,  0.183054f,  -0.024653f,
+    -0.066309f, -0.022212f, 0.064375f,  0.128724f,  0.142693f,  0.148390f,
+    0.087461f,  -0.031220f, -0.097023f, -0.098701f, -0.053847f, -0.016859f,
+    -0.009997f, -0.016473f, -0.052380f, 0.010311f,  0.099391f,  0.058876f,
+    -0.012818f, -0.020366f, 0.018015f,  0.044685f,  0.051266f,  0.060367f,
+    0.039465f,  0.013874f,  0.014735f,  -0.144365f, 0.259132f,  0.110269f,
+    -0.079718f, -0.213923f, -0.240509f, -0.193969f, -0.161829f, -0.189836f,
+    -0.190787f, -0.080289f, 0.013642f,  -0.025579f, -0.108511f, -0.086833f,
+    -0.027226f, -0.062185f, -0.200363f, -0.368528f, -0.439312f, -0.386321f,
+    -0.292119f, -0.225040f, -0.265755f, -0.407543f, -0.484555f, -0.392158f,
+    -0.099652f, 0.322077f,  0.672651f,  0.742735f,  0.561023f,  0.278599f,
+    0.029686f,  -0.126875f, -0.153437f, -0.117678f, -0.034189f, 0.042752f,
+    0.072490f,  0.054548f,  0.014179f,  -0.058310f, -0.012205f, 0.072919f,
+    0.045075f,  0.016405f,  0.091009f,  0.073562f,  0.001835f,  0.010692f,
+    0.083942f,  0.043982f,  -0.045539f, -0.050938f, -0.104447f, -0.205966f};
+
+#endif /* AUDIO_TO_TACTILE_SRC_PHONETICS_CLASSIFY_PHONEME_PARAMS_TILED_H_ */
@@ -21,6 +21,7 @@
 #include "phonetics/hexagon_interpolation.h"
 #include "phonetics/nn_ops.h"
 #include "phonetics/embed_vowel_params.h"
+#include "phonetics/embed_vowel_params_f16.h"
 
 const EmbedVowelTarget kEmbedVowelTargets[8] = {
     {"aa", {0.00000f, -1.00000f}},
@@ -67,6 +68,14 @@ int EmbedVowelTargetByName(const char* target_name) {
   return -1;  /* `target_name` was not found. */
 }
 
+/* Maps the bottleneck layer output to the hexagon. */
+static void SquashCoord(float coord[2]) {
+  const float radius = 1e-4f + HexagonNorm(coord[0], coord[1]);
+  const float scale = FastTanh(radius) / radius;
+  coord[0] *= scale;
+  coord[1] *= scale;
+}
+
 void EmbedVowel(const float* frame, float coord[2]) {
   float buffer1[kDense1Units];
   float buffer2[kDense2Units];
@@ -80,9 +89,51 @@ void EmbedVowel(const float* frame, float coord[2]) {
   /* Third dense layer, bottleneck layer. */
   DenseLinearLayer(kDense2Units, kDense3Units, buffer2,
                    kDense3Weights, kDense3Bias, coord);
+  SquashCoord(coord);
+}
 
-  const float radius = 1e-4f + HexagonNorm(coord[0], coord[1]);
-  const float scale = FastTanh(radius) / radius;
-  coord[0] *= scale;
-  coord[1] *= scale;
+void EmbedVowelF16(const float* frame, float coord[2]) {
+  float buffer1[kDense1Units];
+  float buffer2[kDense2Units];
+
+  DenseReluLayerF16(kNumChannels, kDense1Units, frame,
+                    kDense1WeightsF16, kDense1Bias, buffer1);
+  DenseReluLayerF16(kDense1Units, kDense2Units, buffer1,
+                    kDense2WeightsF16, kDense2Bias, buffer2);
+  DenseLinearLayerF16(kDense2Units, kDense3Units, buffer2,
+                      kDense3WeightsF16, kDense3Bias, coord);
+  SquashCoord(coord);
+}
+
+/* Number of frames computed together in EmbedVowelBatch(). */
+#define kBatchSize 16
+
+void EmbedVowelBatch(const float* frames, int num_frames, float* coords) {
+  float buffer1[kBatchSize * kDense1Units];
+  float buffer2[kBatchSize * kDense2Units];
+  int start;
+
+  for (start = 0; start < num_frames; start += kBatchSize) {
+    const int batch_size = (num_frames - start < kBatchSize)
+        ? num_frames - start : kBatchSize;
+    float* coords_batch = coords + 2 * start;
+    DenseReluLayerBatch(batch_size, kNumChannels, kNumChannels, kDense1Units,
+                        frames + start * kNumChannels,
+                        kDense1Weights, kDense1Bias, buffer1);
+    DenseReluLayerBatch(batch_size, kDense1Units, kDense1Units, kDense2Units,
+                        buffer1, kDense2Weights, kDense2Bias, buffer2);
+    DenseLinearLayerBatch(batch_size, kDense2Units, kDense2Units,
+                          kDense3Units, buffer2, kDense3Weights, kDense3Bias,
+                          coords_batch);
+    int m;
+    for (m = 0; m < batch_size; ++m) {
+      SquashCoord(coords_batch + 2 * m);
+    }
+  }
+}
+
+size_t EmbedVowelTableBytes(void) {
+  return sizeof(kDense1Weights) + sizeof(kDense1Bias) +
+      sizeof(kDense2Weights) + sizeof(kDense2Bias) +
+      sizeof(kDense3Weights) + sizeof(kDense3Bias);
 }
@@ -42,6 +42,8 @@
 #ifndef AUDIO_TO_TACTILE_SRC_PHONETICS_EMBED_VOWEL_H_
 #define AUDIO_TO_TACTILE_SRC_PHONETICS_EMBED_VOWEL_H_
 
+#include <stddef.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -68,6 +70,22 @@ extern const int kEmbedVowelNumChannels;
  */
 void EmbedVowel(const float* frame, float coord[2]);
 
+/* Same as EmbedVowel(), but with the network weights stored in half precision
+ * (IEEE binary16) and converted to float as they are read. The weights take
+ * half the memory, and the result differs from EmbedVowel() only by the
+ * rounding of each weight to 11 significant bits.
+ */
+void EmbedVowelF16(const float* frame, float coord[2]);
+
+/* Batched EmbedVowel() for offline use. `frames` is an array of `num_frames`
+ * CARL+PCEN frames, each of kEmbedVowelNumChannels values, and `coords` is an
+ * array of size `2 * num_frames`. The coordinate for frame m is written to
+ * (coords[2 * m], coords[2 * m + 1]), the same as
+ *
+ *   EmbedVowel(frames + m * kEmbedVowelNumChannels, coords + 2 * m);
+ */
+void EmbedVowelBatch(const float* frames, int num_frames, float* coords);
+
 /* Returns index in `kEmbedVowelTargets` of the target closest to `coord`. */
 int EmbedVowelClosestTarget(const float coord[2]);
 
@@ -76,6 +94,11 @@ int EmbedVowelClosestTarget(const float coord[2]);
  */
 int EmbedVowelTargetByName(const char* target_name);
 
+/* Gets the size in bytes of the network weights and biases, constant tables
+ * read by EmbedVowel().
+ */
+size_t EmbedVowelTableBytes(void);
+
 #ifdef __cplusplus
 }  /* extern "C" */
 #endif
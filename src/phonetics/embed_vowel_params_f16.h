@@ -0,0 +1,169 @@
+/* Copyright 2020 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * Half-precision weights for the vowel embedding network, used by
+ * EmbedVowelF16(). Each weight matrix in embed_vowel_params.h is stored as
+ * IEEE 754 binary16 bit patterns, rounded to nearest. Biases are taken from
+ * embed_vowel_params.h. This file can be regenerated with
+ * extras/python/phonetics/export_model_as_c_data.py using --float16.
+ */
+
+#ifndef AUDIO_TO_TACTILE_SRC_PHONETICS_EMBED_VOWEL_PARAMS_F16_H_
+#define AUDIO_TO_TACTILE_SRC_PHONETICS_EMBED_VOWEL_PARAMS_F16_H_
+
+#include <stdint.h>
+
+#include "phonetics/embed_vowel_params.h"
+
+static const uint16_t kDense1WeightsF16[kNumChannels * kDense1Units] = {0xb21c,
+    0xb2be, 0xb3a2, 0xb3b3, 0xb264, 0xb064, 0xace9, 0xa607, 0x1ed1, 0x25df,
+    0x27d1, 0x27f1, 0x2cb1, 0x312e, 0x31e4, 0x2e62, 0x28c9, 0x2c6d, 0x31cd,
+    0x352d, 0x3604, 0x3436, 0x2caa, 0xa5ec, 0xa22e, 0xa6ed, 0xaec2, 0xb076,
+    0xac17, 0x249b, 0x2995, 0x26f1, 0x1eb2, 0x245e, 0x2c93, 0x3051, 0x3089,
+    0x2d80, 0x9ee8, 0xb04d, 0xb345, 0xb24f, 0xb152, 0xb197, 0xad9e, 0x2c6f,
+    0x315d, 0x34d6, 0x3528, 0x3444, 0x3285, 0x2fc2, 0x2cf9, 0x3144, 0x3270,
+    0x2cfb, 0xaa61, 0x9517, 0x2b72, 0x2e83, 0x2f50, 0x2d46, 0x9b87, 0xaef1,
+    0xb14d, 0xb073, 0xa64c, 0x2ec3, 0x30a1, 0x2d6c, 0x9f60, 0xad3f, 0xaf53,
+    0xaf92, 0xb00a, 0xafef, 0xae7b, 0xad9c, 0xb02f, 0xb3c6, 0xb5fd, 0xb716,
+    0xb5e8, 0xb05a, 0x3208, 0x36ee, 0x381a, 0x36c9, 0x33cf, 0x2f79, 0x2cc9,
+    0x295e, 0xa9f1, 0xb109, 0xb123, 0xaaab, 0x26f1, 0x2ab7, 0x29c8, 0x255b,
+    0x2627, 0x27b6, 0x11c9, 0x23f4, 0xa416, 0xad38, 0xab72, 0x2949, 0x2a6d,
+    0x2bdc, 0x316c, 0x3458, 0x314e, 0x3081, 0x302d, 0x306d, 0x311f, 0x315f,
+    0x2fbd, 0x29ad, 0x9b35, 0x9fdc, 0x175c, 0x2432, 0x99d9, 0xad36, 0xb02b,
+    0xad8f, 0x26a7, 0x3268, 0x3549, 0x3440, 0x9d88, 0xb554, 0xb800, 0xb666,
+    0xb154, 0x29a1, 0x3151, 0x31bd, 0x2ff5, 0x2e57, 0x2edc, 0x2d7a, 0x2c1a,
+    0x2a9b, 0x2a54, 0x2769, 0x298e, 0x2cef, 0x2af9, 0x2430, 0x2842, 0x2b1b,
+    0xa359, 0xadcf, 0xac75, 0xaf5d, 0xb243, 0xb48b, 0xb23a, 0xb001, 0xae92,
+    0x111d, 0x2dfd, 0xa001, 0x26cc, 0x34ce, 0x31c4, 0x30ab, 0x2e72, 0x2a58,
+    0x9c0c, 0xa93d, 0xab00, 0xac0d, 0xad27, 0xaf18, 0xb0e4, 0xb240, 0xb320,
+    0xb3cf, 0xb491, 0xb5bb, 0xb733, 0xb84b, 0xb8a5, 0xb827, 0xb518, 0xa6fb,
+    0x3394, 0x35c3, 0x351c, 0x324b, 0x2e3d, 0x2b25, 0x2aed, 0x2bd3, 0x2cf9,
+    0x2eab, 0x2e26, 0x27e0, 0xaa05, 0xaf21, 0xb0ef, 0xaff5, 0xaba6, 0xa7f9,
+    0xa315, 0x23d2, 0x2a1b, 0x2c31, 0x29df, 0x9ec2, 0xa9d1, 0xa7f1, 0xad1e,
+    0xacfc, 0x212a, 0x2736, 0x1453, 0x2d31, 0x2cdb, 0xa4fb, 0xb5cc, 0xb431,
+    0xb01c, 0xa22c, 0x2a16, 0x29c3, 0x2509, 0x18b4, 0x2144, 0x270c, 0x280c,
+    0x2c51, 0x3070, 0x30f3, 0x2cd6, 0xa278, 0xa79b, 0x25a0, 0x2f06, 0x3258,
+    0x3386, 0x3202, 0x2fbf, 0x2dbc, 0x2dbb, 0x2d1d, 0x224b, 0xae82, 0xb2e6,
+    0xb437, 0xb2c6, 0xae6a, 0x9634, 0x29c8, 0x13f2, 0xad99, 0xb08f, 0xb1b1,
+    0xb1a1, 0xae43, 0xaee8, 0xb136, 0xafa3, 0xad00, 0xa6e4, 0x3092, 0x34d4,
+    0x360e, 0x34b3, 0x3085, 0x3008, 0x2cbe, 0xa926, 0xa458, 0x159f, 0xaf5a,
+    0x2e03, 0x2d8c, 0x2ec2, 0x305c, 0x30b5, 0x30a7, 0x2fa1, 0x2b1f, 0xa740,
+    0xaec6, 0xb042, 0xadec, 0xac41, 0xad81, 0xa934, 0x2c87, 0x2ff4, 0x2e6e,
+    0x2601, 0xac91, 0xa86f, 0x3306, 0x377f, 0x368e, 0x2d73, 0xb1d6, 0xb3c8,
+    0xb422, 0xb59d, 0xb65d, 0xb569, 0xb423, 0xb1b5, 0xaed7, 0xa91b, 0x25d0,
+    0x2fde, 0x3316, 0x3458, 0x3460, 0x3413, 0x3109, 0x2452, 0xa70f, 0xa2e0,
+    0xa8ac, 0xaa48, 0xb04d, 0xadce, 0x23d3, 0xab2d, 0xaa15, 0x2f8a, 0xa729,
+    0xb0f1, 0x3250, 0x2e19, 0x25c7, 0xae34, 0xb219, 0xb207, 0xaa2a, 0x30df,
+    0x3287, 0x27d4, 0xad7f, 0x2bc4, 0x313b, 0x25fe, 0xb004, 0xb08c, 0xaacb,
+    0x2f35, 0x317d, 0x28d9, 0xafeb, 0xb031, 0x2857, 0x317e, 0x2e83, 0xa6de,
+    0xa6c3, 0x27d3, 0x2833, 0xa679, 0xaaf3, 0xaccf, 0xa30a, 0xa5fa, 0xaf4f,
+    0xad0b, 0x28a6, 0x27b7, 0x2955, 0x2d91, 0x28bc, 0xa0ef, 0x291f, 0x2ca6,
+    0x288f, 0xa9a6, 0x2a75, 0x2db0, 0x25d7, 0xb358, 0xb132, 0x3097, 0x30b7,
+    0x2182, 0xa859, 0xb67b, 0xbc8d, 0xb2a4, 0xb1b8, 0xb01d, 0xaca4, 0xa4d1,
+    0x2acc, 0x305c, 0x31c7, 0x3017, 0x9626, 0xae24, 0xad29, 0x0ccd, 0x2afd,
+    0x2869, 0xa877, 0xac11, 0xa724, 0x9d34, 0xa95a, 0xad7d, 0xab91, 0x24ee,
+    0x2b67, 0x2a74, 0x2c35, 0x2e21, 0x2dcb, 0x2c3d, 0x2cdd, 0x2c6a, 0x2691,
+    0x9f27, 0xac12, 0xb04a, 0xb207, 0xb410, 0xb4a6, 0xb14b, 0x2871, 0x32c1,
+    0x3420, 0x337c, 0x33af, 0x325f, 0x2b8a, 0xac91, 0xb281, 0xad0e, 0x2ab0,
+    0xafea, 0xb021, 0x324e, 0x309e, 0x29ee, 0x3798, 0xb22f, 0xb1d6, 0xb0bd,
+    0xadf5, 0xa539, 0x2986, 0x2ae8, 0x2486, 0xa183, 0x2092, 0x2ce4, 0x30a6,
+    0x3096, 0x2caf, 0x29fd, 0x2f10, 0x3198, 0x3115, 0x2930, 0xaf1b, 0xb02f,
+    0x2c12, 0x34e9, 0x358d, 0x30aa, 0xad65, 0xb1a8, 0xb120, 0xad69, 0x2a52,
+    0x3203, 0x3412, 0x3421, 0x3376, 0x3261, 0x30b2, 0x2d7a, 0xa42b, 0xb15e,
+    0xb313, 0xb10e, 0xaec6, 0xad75, 0xa632, 0x2d27, 0x3197, 0x3286, 0x2cca,
+    0x1ed9, 0x9b9f, 0x9e76, 0x2aba, 0x2ef6, 0x27a7, 0x274d, 0x3097, 0xb3ea,
+    0xb2ec, 0xb173, 0xafac, 0xad03, 0xaa8b, 0xa43f, 0x2993, 0x2fb1, 0x317a,
+    0x314d, 0x2f1b, 0x2b15, 0x2a1b, 0x2d63, 0x2fa7, 0x2fe4, 0x2f03, 0x2ecc,
+    0x3028, 0x3157, 0x326f, 0x33c9, 0x34db, 0x35e3, 0x3686, 0x3664, 0x3571,
+    0x33b4, 0x300a, 0x23cd, 0xad62, 0xb104, 0xb16d, 0xb0a8, 0xafa8, 0xaefb,
+    0xacfb, 0x1d99, 0x2c31, 0x262b, 0xa914, 0xa95a, 0x1ae0, 0x245c, 0x2649,
+    0x2817, 0xa613, 0xa8d4, 0xab2f, 0xa8ef, 0x26c6, 0x260c, 0xa46e, 0xa256,
+    0xb11b, 0xa895, 0x2759, 0x2eb3, 0x3153, 0x3292, 0x32d2, 0x32ac, 0x3237,
+    0x30fb, 0x2e24, 0x1935, 0xb047, 0xb406, 0xb461, 0xb16f, 0x274f, 0x31f9,
+    0x3157, 0x217d, 0xae7b, 0xad37, 0x0219, 0x293e, 0x2439, 0xa674, 0xa8cc,
+    0xa655, 0x98e2, 0x1cf3, 0x9a04, 0xa4d8, 0xaae0, 0xadf3, 0xaea5, 0xaf59,
+    0xafe7, 0xb061, 0xb053, 0xaf11, 0xaceb, 0x2a68, 0x328d, 0x33e7, 0x302f,
+    0xace2, 0xb2c0, 0xb0b0, 0x2c37, 0x3423, 0x34ba, 0x3074, 0xaeec, 0xb467,
+    0xb4c5, 0xb531, 0xb6bb, 0xb65c, 0xb55a, 0xb3a8, 0xaf21, 0x2b49, 0x3112,
+    0x3028, 0x2b03, 0x24a9, 0x237d, 0x299f, 0x2f97, 0x30fb, 0x2e2e, 0x26e2,
+    0x2b40, 0x3190, 0x3489, 0x3482, 0x30d0, 0x2986, 0x2a48, 0x22d3, 0xb07b,
+    0xb4ef, 0xb602, 0xb50c, 0xb282, 0xaf71, 0xac1f, 0xac60, 0xafed, 0xb0f3,
+    0xae71, 0x25b6, 0x2ffc, 0x304f, 0x2a89, 0xa93b, 0xa9cc, 0xabdf, 0xb04a,
+    0xb0ba, 0xacdd, 0xa65f, 0xa5d5, 0x2859, 0x30e3, 0x3273, 0x3155, 0x3355,
+    0x31ec, 0x2d3a, 0x31c2, 0x3279, 0xb2ee, 0xade8, 0xa9ed, 0x2598, 0x2c8e,
+    0x2c0c, 0x26b0, 0x2675, 0x2c45, 0x2fd3, 0x304a, 0x2c32, 0xa78a, 0xabd9,
+    0x9fda, 0x2dc1, 0x3185, 0x31d7, 0x2f62, 0x25b8, 0xac5d, 0xb0bd, 0xb292,
+    0xb2af, 0xb06c, 0xa71a, 0x2934, 0x2a3c, 0x2bab, 0x2f72, 0x3162, 0x31a0,
+    0x3117, 0x2fcc, 0x2e21, 0x2c48, 0x1a30, 0xa9d2, 0xa987, 0xacf8, 0xb257,
+    0xb44b, 0xb0c3, 0x2688, 0x303a, 0x32ca, 0x3418, 0x3205, 0x2d68, 0x2c7b,
+    0x3036, 0x3046, 0x2c9b, 0x2dbe, 0x31a4, 0x3318, 0x3485, 0x2fb2, 0x2fde,
+    0x2f2e, 0x2d3a, 0x2952, 0x0eea, 0xa49a, 0x22e5, 0x2cd2, 0x2e52, 0x2c72,
+    0x2894, 0x29c8, 0x2edb, 0x31db, 0x3263, 0x2e2c, 0xaeb4, 0xb49d, 0xb5c4,
+    0xb534, 0xb3b6, 0xb125, 0xaf37, 0xae34, 0xadf3, 0xac8d, 0xa156, 0x2c6b,
+    0x2de1, 0x2274, 0xad6b, 0xaf1a, 0xad25, 0xaae5, 0xa8ef, 0xa815, 0x241a,
+    0x30d9, 0x338e, 0x315e, 0x949f, 0xb07e, 0xb09d, 0xa953, 0x2dbb, 0x31e6,
+    0x324b, 0x2e05, 0xa5c1, 0xa0c0, 0x2004, 0xac43, 0xacb6, 0xae78, 0xb3f3,
+    0xb26e, 0xb16f, 0xafba, 0xabcf, 0x26dc, 0x2e64, 0x2f19, 0x2d83, 0x2c1b,
+    0x2a01, 0x28f6, 0x2944, 0x2814, 0x2270, 0x28f8, 0x3019, 0x323d, 0x3123,
+    0x2955, 0xac74, 0xaca3, 0x2979, 0x30db, 0x2fb8, 0xa8d5, 0xb0ed, 0xafd8,
+    0xa748, 0x2675, 0x25bf, 0xa9b8, 0xaf65, 0xb017, 0xae94, 0xaa97, 0x25ca,
+    0x302e, 0x339c, 0x3459, 0x3263, 0x313f, 0x2dae, 0x27cb, 0x2b22, 0x2e4b,
+    0x2a5a, 0x2657, 0x2aad, 0x2881, 0x271f, 0x27f8, 0xa645, 0xae29, 0xafd4,
+    0xaecc, 0xb007, 0xb142, 0xae79, 0xa86b, 0x1524, 0x9c86, 0xa5b3, 0x19e3,
+    0x2b87, 0x2e9e, 0x2e9e, 0x2b2b, 0x1ef6, 0x23bc, 0x2b92, 0x2c4c, 0x2b1c,
+    0x2cf9, 0x2f00, 0x2f78, 0x2e9d, 0x2c0d, 0xa685, 0xaff5, 0xb1ca, 0xb27c,
+    0xb2ed, 0xb225, 0xac64, 0x3044, 0x3473, 0x34d9, 0x33bf, 0x2eff, 0xaa6e,
+    0xb204, 0xb4d7, 0xb6e1, 0xb7df, 0xb6a3, 0xb3f8, 0xa8e9, 0x30c2, 0x3400,
+    0x3424, 0x3333, 0x3151, 0x2cb2, 0x27db, 0x2415, 0x297d, 0x2fb4, 0x31db,
+    0x32e4, 0x3480, 0x34d8, 0x33cd};
+
+static const uint16_t kDense2WeightsF16[kDense1Units * kDense2Units] = {0x3db0,
+    0x310c, 0xa36a, 0x3c0e, 0xbbe4, 0xb54e, 0xbf96, 0x3de5, 0x388c, 0x3811,
+    0x3057, 0xbe63, 0xb492, 0x3383, 0x349f, 0xb5ec, 0xb3d6, 0x3d1e, 0x3ad1,
+    0x3c6d, 0xbc22, 0x3c5c, 0xc1bb, 0x3510, 0x399c, 0xa54c, 0xb4a4, 0x3d29,
+    0x34c5, 0xb263, 0xb167, 0xb772, 0xb493, 0xb5cd, 0xba99, 0x3aaf, 0x3baa,
+    0xbc0e, 0x4224, 0x315b, 0xb890, 0x2d9b, 0x3e38, 0xbf77, 0x38cb, 0x396f,
+    0x3927, 0x3d37, 0xb04b, 0xb538, 0x9d4c, 0x26c4, 0x3ced, 0x3a1c, 0xb4e1,
+    0xb748, 0xaead, 0xc5ac, 0xbcbc, 0x393f, 0x3554, 0xb353, 0xb1da, 0x22ba,
+    0xb617, 0x329b, 0xb90a, 0x3ee5, 0x3b04, 0x35e3, 0xb20e, 0x36fa, 0xb83d,
+    0x35e0, 0xb832, 0x303e, 0xad11, 0xb94b, 0x34a9, 0x34e3, 0x3419, 0x3c9a,
+    0x2f38, 0x32c9, 0xb86a, 0xb871, 0x2ecc, 0xac76, 0xb37e, 0xad27, 0xb1bf,
+    0x4197, 0xa429, 0x337e, 0x34fe, 0xb211, 0x8a21, 0x0a7d, 0x8592, 0x0936,
+    0x024b, 0x0347, 0x86f2, 0x0182, 0x8779, 0x04a7, 0x8022, 0x052d, 0x8cc5,
+    0x0453, 0x8c25, 0x8410, 0x39cc, 0x3fb8, 0x392b, 0xb90a, 0xbce6, 0xb08a,
+    0xaeae, 0x940d, 0x2f3a, 0x30bd, 0xab4a, 0xbab3, 0xaa45, 0x3926, 0xb2e6,
+    0xb99b, 0xb7c8, 0x3d78, 0xb583, 0x39d8, 0x3d4a, 0xbc4f, 0x4125, 0xc02c,
+    0xb77b, 0x2d4f, 0x3d67, 0xb33c, 0x3a18, 0x3964, 0x36ac, 0x39cb, 0x360b,
+    0xbc0c, 0x3a32, 0xc437, 0xb4fb, 0xab65, 0x37dd, 0xb418, 0x3486, 0xb89c,
+    0x3534, 0x34d4, 0xab3f, 0x39f1, 0xb464, 0x3415, 0xb68d, 0x357e, 0x36bf,
+    0x3c3f, 0x4072, 0xb9d9, 0x410b, 0xc0a0, 0xb295, 0x9931, 0x3e2e, 0xb81a,
+    0x3bae, 0x3b0a, 0xae61, 0x39c8, 0x8e3e, 0x00b9, 0x09de, 0x83ff, 0x083a,
+    0x822a, 0x03ef, 0x0cc9, 0x8c14, 0x8336, 0x84ea, 0x05a3, 0x05e6, 0x0cc5,
+    0x050c, 0x8a8e, 0xb9b5, 0x3689, 0xbd0a, 0x3b9e, 0x3a52, 0xb938, 0x4168,
+    0x3a9e, 0xb621, 0x30d3, 0x403e, 0xbdf7, 0x3b36, 0x3a16, 0x3bf6, 0x3f1b,
+    0x3f36, 0x3d8a, 0xc078, 0xbd9d, 0x37b0, 0xc100, 0x486e, 0xbe97, 0xbce6,
+    0x2cdd, 0x40d9, 0xc32e, 0xa6ec, 0xb50f, 0xb9e9, 0x3803, 0xb32d, 0xad84,
+    0x38bd, 0x3254, 0xbfae, 0x3acf, 0xae33, 0x4045, 0xb53d, 0x3464, 0xba5f,
+    0xbb0c, 0xad93, 0xafea, 0xb358, 0xb55e, 0xb22c, 0xa05e, 0xba89, 0x4160,
+    0x30e1, 0x307a, 0x3f09, 0xba8c, 0xb8cc, 0x35b0, 0x39ce, 0xbdfe, 0x3c68,
+    0x3142, 0xbb1b, 0x3551};
+
+static const uint16_t kDense3WeightsF16[kDense2Units * kDense3Units] = {0xba5f,
+    0xb87b, 0x2fc1, 0x446f, 0xbf09, 0x37cc, 0x3091, 0x3d9d, 0xc293, 0xbccc,
+    0x3f19, 0xae7e, 0x3a94, 0x4e40, 0xbcbf, 0x431a, 0x39cb, 0xbd78, 0xc312,
+    0xc6eb, 0xb9e7, 0x3e87, 0xac74, 0xbde7, 0x3440, 0x36e7, 0x3c84, 0xb5a1,
+    0x3ef7, 0xcc4f, 0x39e7, 0x3380};
+
+#endif /* AUDIO_TO_TACTILE_SRC_PHONETICS_EMBED_VOWEL_PARAMS_F16_H_ */
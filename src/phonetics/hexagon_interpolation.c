@@ -86,9 +86,353 @@ void GetHexagonInterpolationWeights(float x, float y, float weights[7]) {
   }
 }
 
+/* Spacing between grid points is 1 / kGridScale. */
+#define kGridScale 8.0f
+
+void GetHexagonInterpolationWeightsTable(float x, float y, float weights[7]) {
+  /* Map [-1, 1] to grid coordinates [0, kHexagonTableGridSize - 1]. The upper
+   * clamp is slightly less so that the cell index is at most GridSize - 2.
+   */
+  const float kMaxCoord = (kHexagonTableGridSize - 1) * 0.99999f;
+  float grid_x = kGridScale * (x + 1.0f);
+  float grid_y = kGridScale * (y + 1.0f);
+  grid_x = (grid_x < 0.0f) ? 0.0f : (grid_x > kMaxCoord) ? kMaxCoord : grid_x;
+  grid_y = (grid_y < 0.0f) ? 0.0f : (grid_y > kMaxCoord) ? kMaxCoord : grid_y;
+  /* Since grid_x and grid_y are nonnegative, truncation is floor. */
+  const int i = (int)grid_x;
+  const int j = (int)grid_y;
+  const float frac_x = grid_x - i;
+  const float frac_y = grid_y - j;
+
+  const float* p00 = kHexagonInterpolationTable +
+      7 * (kHexagonTableGridSize * j + i);
+  const float* p01 = p00 + 7;
+  const float* p10 = p00 + 7 * kHexagonTableGridSize;
+  const float* p11 = p10 + 7;
+  const float w00 = (1.0f - frac_x) * (1.0f - frac_y);
+  const float w01 = frac_x * (1.0f - frac_y);
+  const float w10 = (1.0f - frac_x) * frac_y;
+  const float w11 = frac_x * frac_y;
+  int n;
+  for (n = 0; n < 7; ++n) {
+    weights[n] = w00 * p00[n] + w01 * p01[n] + w10 * p10[n] + w11 * p11[n];
+  }
+}
+
+void ComputeHexagonInterpolationTable(float* table) {
+  int j;
+  for (j = 0; j < kHexagonTableGridSize; ++j) {
+    int i;
+    for (i = 0; i < kHexagonTableGridSize; ++i) {
+      GetHexagonInterpolationWeights(-1.0f + i / kGridScale,
+                                     -1.0f + j / kGridScale,
+                                     table + 7 * (kHexagonTableGridSize * j + i));
+    }
+  }
+}
+
 float HexagonNorm(float x, float y) {
   x = kSecPi_6 * (float)fabs(x);
   y = fabs(y);
   const float v = kSinPi_6 * x + y;
   return (x > v) ? x : v; /* Get the max of x and v. */
 }
+
+/* These table values match the values computed by
+ * ComputeHexagonInterpolationTable(). Printed tables can be regenerated by
+ * running the unit test as
+ *
+ * hexagon_interpolation_test --print_tables
+ */
+const float kHexagonInterpolationTable[
+    7 * kHexagonTableGridSize * kHexagonTableGridSize] = {
+    0.422649741f, 0.0f, 0.0f, 0.0f, 0.0f, 1.15470052f, 0.0f,
+    0.494818509f, 0.0f, 0.0f, 0.0f, 0.0f, 1.01036298f, 0.0f,
+    0.566987276f, 0.0f, 0.0f, 0.0f, 0.0f, 0.866025388f, 0.0f,
+    0.639156103f, 0.0f, 0.0f, 0.0f, 0.0f, 0.721687794f, 0.0f,
+    0.711324871f, 0.0f, 0.0f, 0.0f, 0.0f, 0.577350259f, 0.0f,
+    0.783493638f, 0.0f, 0.0f, 0.0f, 0.0f, 0.433012694f, 0.0f,
+    0.855662465f, 0.0f, 0.0f, 0.0f, 0.0f, 0.288675129f, 0.0f,
+    0.927831233f, 0.0f, 0.0f, 0.0f, 0.0f, 0.144337565f, 0.0f,
+    1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.927831233f, 0.144337565f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.855662465f, 0.288675129f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.783493638f, 0.433012694f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.711324871f, 0.577350259f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.639156103f, 0.721687794f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.566987276f, 0.866025388f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.494818509f, 1.01036298f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.422649741f, 1.15470052f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.297649741f, 0.0f, 0.0f, 0.0f, 0.0f, 1.15470052f, 0.0f,
+    0.369818509f, 0.0f, 0.0f, 0.0f, 0.0f, 1.01036298f, 0.0f,
+    0.441987306f, 0.0f, 0.0f, 0.0f, 0.0f, 0.866025388f, 0.0f,
+    0.514156103f, 0.0f, 0.0f, 0.0f, 0.0f, 0.721687794f, 0.0f,
+    0.586324871f, 0.0f, 0.0f, 0.0f, 0.0f, 0.577350259f, 0.0f,
+    0.658493638f, 0.0f, 0.0f, 0.0f, 0.0f, 0.433012694f, 0.0f,
+    0.730662465f, 0.0f, 0.0f, 0.0f, 0.0f, 0.288675129f, 0.0f,
+    0.802831233f, 0.0f, 0.0f, 0.0f, 0.0f, 0.144337565f, 0.0528312325f,
+    0.875f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.125f,
+    0.802831233f, 0.144337565f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0528312325f,
+    0.730662465f, 0.288675129f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.658493638f, 0.433012694f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.586324871f, 0.577350259f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.514156103f, 0.721687794f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.441987306f, 0.866025388f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.369818509f, 1.01036298f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.297649741f, 1.15470052f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.172649741f, 0.0f, 0.0f, 0.0f, 0.0f, 1.15470052f, 0.0f,
+    0.244818509f, 0.0f, 0.0f, 0.0f, 0.0f, 1.01036298f, 0.0f,
+    0.316987306f, 0.0f, 0.0f, 0.0f, 0.0f, 0.866025388f, 0.0f,
+    0.389156103f, 0.0f, 0.0f, 0.0f, 0.0f, 0.721687794f, 0.0f,
+    0.461324871f, 0.0f, 0.0f, 0.0f, 0.0f, 0.577350259f, 0.0f,
+    0.533493638f, 0.0f, 0.0f, 0.0f, 0.0f, 0.433012694f, 0.033493638f,
+    0.605662465f, 0.0f, 0.0f, 0.0f, 0.0f, 0.288675129f, 0.105662405f,
+    0.677831233f, 0.0f, 0.0f, 0.0f, 0.0f, 0.144337565f, 0.177831233f,
+    0.75f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.25f,
+    0.677831233f, 0.144337565f, 0.0f, 0.0f, 0.0f, 0.0f, 0.177831233f,
+    0.605662465f, 0.288675129f, 0.0f, 0.0f, 0.0f, 0.0f, 0.105662405f,
+    0.533493638f, 0.433012694f, 0.0f, 0.0f, 0.0f, 0.0f, 0.033493638f,
+    0.461324871f, 0.577350259f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.389156103f, 0.721687794f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.316987306f, 0.866025388f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.244818509f, 1.01036298f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.172649741f, 1.15470052f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.0476497412f, 0.0f, 0.0f, 0.0f, 0.0f, 1.15470052f, 0.0f,
+    0.119818509f, 0.0f, 0.0f, 0.0f, 0.0f, 1.01036298f, 0.0f,
+    0.191987306f, 0.0f, 0.0f, 0.0f, 0.0f, 0.866025388f, 0.0f,
+    0.264156103f, 0.0f, 0.0f, 0.0f, 0.0f, 0.721687794f, 0.0141561031f,
+    0.336324871f, 0.0f, 0.0f, 0.0f, 0.0f, 0.577350259f, 0.0863248706f,
+    0.408493638f, 0.0f, 0.0f, 0.0f, 0.0f, 0.433012694f, 0.158493638f,
+    0.480662435f, 0.0f, 0.0f, 0.0f, 0.0f, 0.288675129f, 0.230662435f,
+    0.552831233f, 0.0f, 0.0f, 0.0f, 0.0f, 0.144337565f, 0.302831233f,
+    0.625f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.375f,
+    0.552831233f, 0.144337565f, 0.0f, 0.0f, 0.0f, 0.0f, 0.302831233f,
+    0.480662435f, 0.288675129f, 0.0f, 0.0f, 0.0f, 0.0f, 0.230662435f,
+    0.408493638f, 0.433012694f, 0.0f, 0.0f, 0.0f, 0.0f, 0.158493638f,
+    0.336324871f, 0.577350259f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0863248706f,
+    0.264156103f, 0.721687794f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0141561031f,
+    0.191987306f, 0.866025388f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.119818509f, 1.01036298f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.0476497412f, 1.15470052f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.0773502588f, 1.07735026f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.00518149137f, 1.00518155f, 0.0f,
+    0.0669873059f, 0.0f, 0.0f, 0.0f, 0.0f, 0.866025388f, 0.0669873059f,
+    0.139156103f, 0.0f, 0.0f, 0.0f, 0.0f, 0.721687794f, 0.139156103f,
+    0.211324871f, 0.0f, 0.0f, 0.0f, 0.0f, 0.577350259f, 0.211324871f,
+    0.283493638f, 0.0f, 0.0f, 0.0f, 0.0f, 0.433012694f, 0.283493638f,
+    0.355662435f, 0.0f, 0.0f, 0.0f, 0.0f, 0.288675129f, 0.355662435f,
+    0.427831233f, 0.0f, 0.0f, 0.0f, 0.0f, 0.144337565f, 0.427831233f,
+    0.5f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.5f,
+    0.427831233f, 0.144337565f, 0.0f, 0.0f, 0.0f, 0.0f, 0.427831233f,
+    0.355662435f, 0.288675129f, 0.0f, 0.0f, 0.0f, 0.0f, 0.355662435f,
+    0.283493638f, 0.433012694f, 0.0f, 0.0f, 0.0f, 0.0f, 0.283493638f,
+    0.211324871f, 0.577350259f, 0.0f, 0.0f, 0.0f, 0.0f, 0.211324871f,
+    0.139156103f, 0.721687794f, 0.0f, 0.0f, 0.0f, 0.0f, 0.139156103f,
+    0.0669873059f, 0.866025388f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0669873059f,
+    0.0f, 1.00518155f, 0.00518149137f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 1.07735026f, 0.0773502588f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.202350259f, 0.952350259f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.130181491f, 0.880181491f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.0580126941f, 0.808012724f, 0.133974552f,
+    0.0141561031f, 0.0f, 0.0f, 0.0f, 0.0f, 0.721687794f, 0.264156103f,
+    0.0863248706f, 0.0f, 0.0f, 0.0f, 0.0f, 0.577350259f, 0.336324871f,
+    0.158493653f, 0.0f, 0.0f, 0.0f, 0.0f, 0.433012694f, 0.408493638f,
+    0.230662435f, 0.0f, 0.0f, 0.0f, 0.0f, 0.288675129f, 0.480662435f,
+    0.302831233f, 0.0f, 0.0f, 0.0f, 0.0f, 0.144337565f, 0.552831233f,
+    0.375f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.625f,
+    0.302831233f, 0.144337565f, 0.0f, 0.0f, 0.0f, 0.0f, 0.552831233f,
+    0.230662435f, 0.288675129f, 0.0f, 0.0f, 0.0f, 0.0f, 0.480662435f,
+    0.158493653f, 0.433012694f, 0.0f, 0.0f, 0.0f, 0.0f, 0.408493638f,
+    0.0863248706f, 0.577350259f, 0.0f, 0.0f, 0.0f, 0.0f, 0.336324871f,
+    0.0141561031f, 0.721687794f, 0.0f, 0.0f, 0.0f, 0.0f, 0.264156103f,
+    0.0f, 0.808012724f, 0.0580126941f, 0.0f, 0.0f, 0.0f, 0.133974582f,
+    0.0f, 0.880181491f, 0.130181491f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.952350259f, 0.202350259f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.327350259f, 0.827350259f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.255181491f, 0.755181491f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.183012694f, 0.683012724f, 0.133974552f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.110843897f, 0.610843897f, 0.278312206f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.0386751294f, 0.538675129f, 0.422649741f,
+    0.0334936529f, 0.0f, 0.0f, 0.0f, 0.0f, 0.433012694f, 0.533493638f,
+    0.105662435f, 0.0f, 0.0f, 0.0f, 0.0f, 0.288675129f, 0.605662465f,
+    0.177831218f, 0.0f, 0.0f, 0.0f, 0.0f, 0.144337565f, 0.677831233f,
+    0.25f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.75f,
+    0.177831218f, 0.144337565f, 0.0f, 0.0f, 0.0f, 0.0f, 0.677831233f,
+    0.105662435f, 0.288675129f, 0.0f, 0.0f, 0.0f, 0.0f, 0.605662465f,
+    0.0334936529f, 0.433012694f, 0.0f, 0.0f, 0.0f, 0.0f, 0.533493638f,
+    0.0f, 0.538675129f, 0.0386751294f, 0.0f, 0.0f, 0.0f, 0.422649741f,
+    0.0f, 0.610843897f, 0.110843897f, 0.0f, 0.0f, 0.0f, 0.278312206f,
+    0.0f, 0.683012724f, 0.183012694f, 0.0f, 0.0f, 0.0f, 0.133974582f,
+    0.0f, 0.755181491f, 0.255181491f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.827350259f, 0.327350259f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.452350259f, 0.702350259f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.380181491f, 0.630181491f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.308012694f, 0.558012724f, 0.133974552f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.235843897f, 0.485843897f, 0.278312206f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.163675129f, 0.413675129f, 0.422649741f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.0915063471f, 0.341506362f, 0.566987276f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.0193375647f, 0.269337565f, 0.71132493f,
+    0.0528312176f, 0.0f, 0.0f, 0.0f, 0.0f, 0.144337565f, 0.802831233f,
+    0.125f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.875f,
+    0.0528312176f, 0.144337565f, 0.0f, 0.0f, 0.0f, 0.0f, 0.802831233f,
+    0.0f, 0.269337565f, 0.0193375647f, 0.0f, 0.0f, 0.0f, 0.71132493f,
+    0.0f, 0.341506362f, 0.0915063471f, 0.0f, 0.0f, 0.0f, 0.566987276f,
+    0.0f, 0.413675129f, 0.163675129f, 0.0f, 0.0f, 0.0f, 0.422649741f,
+    0.0f, 0.485843897f, 0.235843897f, 0.0f, 0.0f, 0.0f, 0.278312206f,
+    0.0f, 0.558012724f, 0.308012694f, 0.0f, 0.0f, 0.0f, 0.133974582f,
+    0.0f, 0.630181491f, 0.380181491f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.702350259f, 0.452350259f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.577350259f, 0.577350259f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.505181491f, 0.505181491f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.433012694f, 0.433012694f, 0.133974582f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.360843897f, 0.360843897f, 0.278312206f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.288675129f, 0.288675129f, 0.422649741f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.216506347f, 0.216506347f, 0.566987276f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.144337565f, 0.144337565f, 0.71132493f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.0721687824f, 0.0721687824f, 0.855662465f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f,
+    0.0f, 0.0721687824f, 0.0721687824f, 0.0f, 0.0f, 0.0f, 0.855662465f,
+    0.0f, 0.144337565f, 0.144337565f, 0.0f, 0.0f, 0.0f, 0.71132493f,
+    0.0f, 0.216506347f, 0.216506347f, 0.0f, 0.0f, 0.0f, 0.566987276f,
+    0.0f, 0.288675129f, 0.288675129f, 0.0f, 0.0f, 0.0f, 0.422649741f,
+    0.0f, 0.360843897f, 0.360843897f, 0.0f, 0.0f, 0.0f, 0.278312206f,
+    0.0f, 0.433012694f, 0.433012694f, 0.0f, 0.0f, 0.0f, 0.133974582f,
+    0.0f, 0.505181491f, 0.505181491f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.577350259f, 0.577350259f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.702350259f, 0.452350259f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.630181491f, 0.380181491f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.558012724f, 0.308012694f, 0.133974582f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.485843897f, 0.235843897f, 0.278312206f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.413675129f, 0.163675129f, 0.422649741f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.341506362f, 0.0915063471f, 0.566987276f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.269337565f, 0.0193375647f, 0.71132493f,
+    0.0f, 0.0f, 0.0f, 0.0528312176f, 0.144337565f, 0.0f, 0.802831233f,
+    0.0f, 0.0f, 0.0f, 0.125f, 0.0f, 0.0f, 0.875f,
+    0.0f, 0.0f, 0.144337565f, 0.0528312176f, 0.0f, 0.0f, 0.802831233f,
+    0.0f, 0.0193375647f, 0.269337565f, 0.0f, 0.0f, 0.0f, 0.71132493f,
+    0.0f, 0.0915063471f, 0.341506362f, 0.0f, 0.0f, 0.0f, 0.566987276f,
+    0.0f, 0.163675129f, 0.413675129f, 0.0f, 0.0f, 0.0f, 0.422649741f,
+    0.0f, 0.235843897f, 0.485843897f, 0.0f, 0.0f, 0.0f, 0.278312206f,
+    0.0f, 0.308012694f, 0.558012724f, 0.0f, 0.0f, 0.0f, 0.133974552f,
+    0.0f, 0.380181491f, 0.630181491f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.452350259f, 0.702350259f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.827350259f, 0.327350259f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.755181491f, 0.255181491f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.683012724f, 0.183012694f, 0.133974582f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.610843897f, 0.110843897f, 0.278312206f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.538675129f, 0.0386751294f, 0.422649741f,
+    0.0f, 0.0f, 0.0f, 0.0334936529f, 0.433012694f, 0.0f, 0.533493638f,
+    0.0f, 0.0f, 0.0f, 0.105662435f, 0.288675129f, 0.0f, 0.605662465f,
+    0.0f, 0.0f, 0.0f, 0.177831218f, 0.144337565f, 0.0f, 0.677831233f,
+    0.0f, 0.0f, 0.0f, 0.25f, 0.0f, 0.0f, 0.75f,
+    0.0f, 0.0f, 0.144337565f, 0.177831218f, 0.0f, 0.0f, 0.677831233f,
+    0.0f, 0.0f, 0.288675129f, 0.105662435f, 0.0f, 0.0f, 0.605662465f,
+    0.0f, 0.0f, 0.433012694f, 0.0334936529f, 0.0f, 0.0f, 0.533493638f,
+    0.0f, 0.0386751294f, 0.538675129f, 0.0f, 0.0f, 0.0f, 0.422649741f,
+    0.0f, 0.110843897f, 0.610843897f, 0.0f, 0.0f, 0.0f, 0.278312206f,
+    0.0f, 0.183012694f, 0.683012724f, 0.0f, 0.0f, 0.0f, 0.133974552f,
+    0.0f, 0.255181491f, 0.755181491f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.327350259f, 0.827350259f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.952350259f, 0.202350259f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.880181491f, 0.130181491f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.808012724f, 0.0580126941f, 0.133974582f,
+    0.0f, 0.0f, 0.0f, 0.0141561031f, 0.721687794f, 0.0f, 0.264156103f,
+    0.0f, 0.0f, 0.0f, 0.0863248706f, 0.577350259f, 0.0f, 0.336324871f,
+    0.0f, 0.0f, 0.0f, 0.158493653f, 0.433012694f, 0.0f, 0.408493638f,
+    0.0f, 0.0f, 0.0f, 0.230662435f, 0.288675129f, 0.0f, 0.480662435f,
+    0.0f, 0.0f, 0.0f, 0.302831233f, 0.144337565f, 0.0f, 0.552831233f,
+    0.0f, 0.0f, 0.0f, 0.375f, 0.0f, 0.0f, 0.625f,
+    0.0f, 0.0f, 0.144337565f, 0.302831233f, 0.0f, 0.0f, 0.552831233f,
+    0.0f, 0.0f, 0.288675129f, 0.230662435f, 0.0f, 0.0f, 0.480662435f,
+    0.0f, 0.0f, 0.433012694f, 0.158493653f, 0.0f, 0.0f, 0.408493638f,
+    0.0f, 0.0f, 0.577350259f, 0.0863248706f, 0.0f, 0.0f, 0.336324871f,
+    0.0f, 0.0f, 0.721687794f, 0.0141561031f, 0.0f, 0.0f, 0.264156103f,
+    0.0f, 0.0580126941f, 0.808012724f, 0.0f, 0.0f, 0.0f, 0.133974552f,
+    0.0f, 0.130181491f, 0.880181491f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.202350259f, 0.952350259f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f, 1.07735026f, 0.0773502588f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f, 1.00518155f, 0.00518149137f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0669873059f, 0.866025388f, 0.0f, 0.0669873059f,
+    0.0f, 0.0f, 0.0f, 0.139156103f, 0.721687794f, 0.0f, 0.139156103f,
+    0.0f, 0.0f, 0.0f, 0.211324871f, 0.577350259f, 0.0f, 0.211324871f,
+    0.0f, 0.0f, 0.0f, 0.283493638f, 0.433012694f, 0.0f, 0.283493638f,
+    0.0f, 0.0f, 0.0f, 0.355662435f, 0.288675129f, 0.0f, 0.355662435f,
+    0.0f, 0.0f, 0.0f, 0.427831233f, 0.144337565f, 0.0f, 0.427831233f,
+    0.0f, 0.0f, 0.0f, 0.5f, 0.0f, 0.0f, 0.5f,
+    0.0f, 0.0f, 0.144337565f, 0.427831233f, 0.0f, 0.0f, 0.427831233f,
+    0.0f, 0.0f, 0.288675129f, 0.355662435f, 0.0f, 0.0f, 0.355662435f,
+    0.0f, 0.0f, 0.433012694f, 0.283493638f, 0.0f, 0.0f, 0.283493638f,
+    0.0f, 0.0f, 0.577350259f, 0.211324871f, 0.0f, 0.0f, 0.211324871f,
+    0.0f, 0.0f, 0.721687794f, 0.139156103f, 0.0f, 0.0f, 0.139156103f,
+    0.0f, 0.0f, 0.866025388f, 0.0669873059f, 0.0f, 0.0f, 0.0669873059f,
+    0.0f, 0.00518149137f, 1.00518155f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0773502588f, 1.07735026f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0476497412f, 1.15470052f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.119818509f, 1.01036298f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.191987306f, 0.866025388f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.264156103f, 0.721687794f, 0.0f, 0.0141561031f,
+    0.0f, 0.0f, 0.0f, 0.336324871f, 0.577350259f, 0.0f, 0.0863248706f,
+    0.0f, 0.0f, 0.0f, 0.408493638f, 0.433012694f, 0.0f, 0.158493638f,
+    0.0f, 0.0f, 0.0f, 0.480662435f, 0.288675129f, 0.0f, 0.230662435f,
+    0.0f, 0.0f, 0.0f, 0.552831233f, 0.144337565f, 0.0f, 0.302831233f,
+    0.0f, 0.0f, 0.0f, 0.625f, 0.0f, 0.0f, 0.375f,
+    0.0f, 0.0f, 0.144337565f, 0.552831233f, 0.0f, 0.0f, 0.302831233f,
+    0.0f, 0.0f, 0.288675129f, 0.480662435f, 0.0f, 0.0f, 0.230662435f,
+    0.0f, 0.0f, 0.433012694f, 0.408493638f, 0.0f, 0.0f, 0.158493638f,
+    0.0f, 0.0f, 0.577350259f, 0.336324871f, 0.0f, 0.0f, 0.0863248706f,
+    0.0f, 0.0f, 0.721687794f, 0.264156103f, 0.0f, 0.0f, 0.0141561031f,
+    0.0f, 0.0f, 0.866025388f, 0.191987306f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 1.01036298f, 0.119818509f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 1.15470052f, 0.0476497412f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.172649741f, 1.15470052f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.244818509f, 1.01036298f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.316987306f, 0.866025388f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.389156103f, 0.721687794f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.461324871f, 0.577350259f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.533493638f, 0.433012694f, 0.0f, 0.033493638f,
+    0.0f, 0.0f, 0.0f, 0.605662465f, 0.288675129f, 0.0f, 0.105662405f,
+    0.0f, 0.0f, 0.0f, 0.677831233f, 0.144337565f, 0.0f, 0.177831233f,
+    0.0f, 0.0f, 0.0f, 0.75f, 0.0f, 0.0f, 0.25f,
+    0.0f, 0.0f, 0.144337565f, 0.677831233f, 0.0f, 0.0f, 0.177831233f,
+    0.0f, 0.0f, 0.288675129f, 0.605662465f, 0.0f, 0.0f, 0.105662405f,
+    0.0f, 0.0f, 0.433012694f, 0.533493638f, 0.0f, 0.0f, 0.033493638f,
+    0.0f, 0.0f, 0.577350259f, 0.461324871f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.721687794f, 0.389156103f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.866025388f, 0.316987306f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 1.01036298f, 0.244818509f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 1.15470052f, 0.172649741f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.297649741f, 1.15470052f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.369818509f, 1.01036298f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.441987306f, 0.866025388f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.514156103f, 0.721687794f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.586324871f, 0.577350259f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.658493638f, 0.433012694f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.730662465f, 0.288675129f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.802831233f, 0.144337565f, 0.0f, 0.0528312325f,
+    0.0f, 0.0f, 0.0f, 0.875f, 0.0f, 0.0f, 0.125f,
+    0.0f, 0.0f, 0.144337565f, 0.802831233f, 0.0f, 0.0f, 0.0528312325f,
+    0.0f, 0.0f, 0.288675129f, 0.730662465f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.433012694f, 0.658493638f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.577350259f, 0.586324871f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.721687794f, 0.514156103f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.866025388f, 0.441987306f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 1.01036298f, 0.369818509f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 1.15470052f, 0.297649741f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.422649741f, 1.15470052f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.494818509f, 1.01036298f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.566987276f, 0.866025388f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.639156103f, 0.721687794f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.711324871f, 0.577350259f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.783493638f, 0.433012694f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.855662465f, 0.288675129f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.927831233f, 0.144337565f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.144337565f, 0.927831233f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.288675129f, 0.855662465f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.433012694f, 0.783493638f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.577350259f, 0.711324871f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.721687794f, 0.639156103f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.866025388f, 0.566987276f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 1.01036298f, 0.494818509f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 1.15470052f, 0.422649741f, 0.0f, 0.0f, 0.0f,
+};
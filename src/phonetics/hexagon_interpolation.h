@@ -23,6 +23,9 @@
 extern "C" {
 #endif
 
+/* Number of grid points along each axis of kHexagonInterpolationTable. */
+#define kHexagonTableGridSize 17
+
 /* Gets piecewise trilinear interpolation weights on the regular hexagon:
  *        ___
  *       /   \
@@ -43,6 +46,45 @@ extern "C" {
  */
 void GetHexagonInterpolationWeights(float x, float y, float weights[7]);
 
+/* Same as GetHexagonInterpolationWeights(), but approximates the weights by
+ * bilinear interpolation of kHexagonInterpolationTable, a precomputed grid of
+ * weights over the square [-1, 1] x [-1, 1] with spacing 1/8. This is
+ * branch-free apart from clamping and costs 28 multiply-adds. Points outside
+ * the square are clamped to it, which is fine for coordinates from EmbedVowel()
+ * since they are always inside the hexagon.
+ *
+ * Within the hexagon, the max absolute error in each weight is about 0.031. The
+ * error is largest near the creases of the piecewise trilinear interpolation,
+ * which bilinear interpolation rounds off.
+ */
+void GetHexagonInterpolationWeightsTable(float x, float y, float weights[7]);
+
+/* Gets interpolation weights with GetHexagonInterpolationWeightsTable() if the
+ * library was built with -DAUDIO_TO_TACTILE_HEXAGON_TABLE, and with the exact
+ * GetHexagonInterpolationWeights() otherwise. TactileProcessor uses this to map
+ * the vowel embedding to weights once per block.
+ */
+static void GetHexagonInterpolationWeightsFast(float x, float y,
+                                               float weights[7]) {
+#ifdef AUDIO_TO_TACTILE_HEXAGON_TABLE
+  GetHexagonInterpolationWeightsTable(x, y, weights);
+#else
+  GetHexagonInterpolationWeights(x, y, weights);
+#endif
+}
+
+/* Grid of weights used by GetHexagonInterpolationWeightsTable(). Entry
+ * `7 * (kHexagonTableGridSize * j + i) + n` is the nth sample weight at
+ * (x, y) = (-1 + i/8, -1 + j/8).
+ */
+extern const float kHexagonInterpolationTable[
+    7 * kHexagonTableGridSize * kHexagonTableGridSize];
+
+/* Computes kHexagonInterpolationTable by evaluating
+ * GetHexagonInterpolationWeights() on the grid.
+ */
+void ComputeHexagonInterpolationTable(float* table);
+
 /* Computes a 2D norm or distance to the origin for the hexagon. The "unit ball"
  * set {(x,y) : HexagonNorm(x,y) == 1.0} is the hexagon with vertices
  *
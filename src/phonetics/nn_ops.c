@@ -14,7 +14,16 @@
  */
 
 #include "phonetics/nn_ops.h"
+
+#include <string.h>
+
+#include "dsp/cpu_dispatch.h"
 #include "dsp/fast_fun.h"
+#include "dsp/simd.h"
+
+#if defined(__F16C__) && !defined(AUDIO_TO_TACTILE_DISABLE_SIMD)
+#include <immintrin.h>
+#endif
 
 static float DotProduct(const float* x, const float* y, int size) {
   float sum = 0.0f;
@@ -53,6 +62,243 @@ void DenseReluLayer(int in_size,
   }
 }
 
+/* Number of inputs per block in the batched dense layers. */
+enum { kDenseBatchBlockSize = 4 };
+
+static void DenseLayerBatch(int num_inputs,
+                            int in_size,
+                            int in_stride,
+                            int out_size,
+                            const float* in,
+                            const float* weights,
+                            const float* bias,
+                            int apply_relu,
+                            float* out) {
+  int m;
+  for (m = 0; m + kDenseBatchBlockSize <= num_inputs;
+       m += kDenseBatchBlockSize) {
+    const float* in0 = in + m * in_stride;
+    const float* in1 = in0 + in_stride;
+    const float* in2 = in1 + in_stride;
+    const float* in3 = in2 + in_stride;
+    float* out0 = out + m * out_size;
+    const float* weights_col_j = weights;
+    int j;
+    for (j = 0; j < out_size; ++j, weights_col_j += in_size) {
+      /* Compute four dot products with one pass over the weights. Each sum
+       * accumulates in the same order as DotProduct().
+       */
+      float sum0 = 0.0f;
+      float sum1 = 0.0f;
+      float sum2 = 0.0f;
+      float sum3 = 0.0f;
+      int k;
+      for (k = 0; k < in_size; ++k) {
+        const float w = weights_col_j[k];
+        sum0 += in0[k] * w;
+        sum1 += in1[k] * w;
+        sum2 += in2[k] * w;
+        sum3 += in3[k] * w;
+      }
+      sum0 += bias[j];
+      sum1 += bias[j];
+      sum2 += bias[j];
+      sum3 += bias[j];
+      if (apply_relu) {
+        sum0 = Relu(sum0);
+        sum1 = Relu(sum1);
+        sum2 = Relu(sum2);
+        sum3 = Relu(sum3);
+      }
+      out0[j] = sum0;
+      out0[j + out_size] = sum1;
+      out0[j + 2 * out_size] = sum2;
+      out0[j + 3 * out_size] = sum3;
+    }
+  }
+
+  /* Process remaining inputs one at a time. */
+  for (; m < num_inputs; ++m) {
+    if (apply_relu) {
+      DenseReluLayer(in_size, out_size, in + m * in_stride, weights, bias,
+                     out + m * out_size);
+    } else {
+      DenseLinearLayer(in_size, out_size, in + m * in_stride, weights, bias,
+                       out + m * out_size);
+    }
+  }
+}
+
+void DenseLinearLayerBatch(int num_inputs,
+                           int in_size,
+                           int in_stride,
+                           int out_size,
+                           const float* in,
+                           const float* weights,
+                           const float* bias,
+                           float* out) {
+  DenseLayerBatch(num_inputs, in_size, in_stride, out_size,
+                  in, weights, bias, 0, out);
+}
+
+void DenseReluLayerBatch(int num_inputs,
+                         int in_size,
+                         int in_stride,
+                         int out_size,
+                         const float* in,
+                         const float* weights,
+                         const float* bias,
+                         float* out) {
+  DenseLayerBatch(num_inputs, in_size, in_stride, out_size,
+                  in, weights, bias, 1, out);
+}
+
+/* Quantizes `in` to int16 with a common scale factor. Returns the scale, such
+ * that in[k] ~= scale * in_q[k]. Returns 0 if `in` is all zeros.
+ */
+static float QuantizeInputInt16(const float* in, int size, int16_t* in_q) {
+  float max_abs = 0.0f;
+  int k;
+  for (k = 0; k < size; ++k) {
+    const float abs_value = (in[k] >= 0.0f) ? in[k] : -in[k];
+    if (abs_value > max_abs) {
+      max_abs = abs_value;
+    }
+  }
+  if (!(max_abs > 0.0f)) {  /* Zero or NaN input. */
+    for (k = 0; k < size; ++k) {
+      in_q[k] = 0;
+    }
+    return 0.0f;
+  }
+
+  const float inv_scale = 32767.0f / max_abs;
+  for (k = 0; k < size; ++k) {
+    const float value = in[k] * inv_scale;
+    /* Round to nearest. |value| <= 32767, so the conversion is in range. */
+    in_q[k] = (int16_t)((value >= 0.0f) ? value + 0.5f : value - 0.5f);
+  }
+  return max_abs / 32767.0f;
+}
+
+/* Computes an int16 * int8 dot product with int32 accumulation. The loop is
+ * simple so that compilers can map it to multiply-accumulate instructions
+ * (e.g. SMLABB on Cortex-M4, PMADDWD on x86).
+ */
+static int32_t DotProductInt8(const int16_t* x, const int8_t* y, int size) {
+  int32_t sum = 0;
+  int k;
+  for (k = 0; k < size; ++k) {
+    sum += (int32_t)x[k] * (int32_t)y[k];
+  }
+  return sum;
+}
+
+CPU_DISPATCH_CLONES
+void DenseLinearLayerInt8(int in_size,
+                          int out_size,
+                          const float* in,
+                          const int8_t* weights_q,
+                          const float* weight_scales,
+                          const float* bias,
+                          float* out) {
+  int16_t in_q[kDenseInt8MaxInSize];
+  const float in_scale = QuantizeInputInt16(in, in_size, in_q);
+  const int8_t* weights_col_j = weights_q;
+  int j;
+  for (j = 0; j < out_size; ++j, weights_col_j += in_size) {
+    out[j] = (in_scale * weight_scales[j]) *
+        (float)DotProductInt8(in_q, weights_col_j, in_size) + bias[j];
+  }
+}
+
+CPU_DISPATCH_CLONES
+void DenseReluLayerInt8(int in_size,
+                        int out_size,
+                        const float* in,
+                        const int8_t* weights_q,
+                        const float* weight_scales,
+                        const float* bias,
+                        float* out) {
+  int16_t in_q[kDenseInt8MaxInSize];
+  const float in_scale = QuantizeInputInt16(in, in_size, in_q);
+  const int8_t* weights_col_j = weights_q;
+  int j;
+  for (j = 0; j < out_size; ++j, weights_col_j += in_size) {
+    out[j] = Relu((in_scale * weight_scales[j]) *
+        (float)DotProductInt8(in_q, weights_col_j, in_size) + bias[j]);
+  }
+}
+
+/* Converts binary16 to float. This is static so that it inlines into the dot
+ * products.
+ */
+static float HalfToFloat(uint16_t value) {
+#if defined(__F16C__) && !defined(AUDIO_TO_TACTILE_DISABLE_SIMD)
+  return _cvtsh_ss(value);
+#elif defined(__ARM_FP16_FORMAT_IEEE)
+  __fp16 half;
+  memcpy(&half, &value, sizeof(half));
+  return (float)half;
+#else
+  const uint32_t exponent = (value >> 10) & 0x1f;
+  const uint32_t mantissa = value & 0x3ff;
+  uint32_t bits;
+  float result;
+  if (exponent == 0) {  /* Zero or subnormal, mantissa * 2^-24. */
+    result = (float)mantissa * (1.0f / 16777216.0f);
+    return (value & 0x8000) ? -result : result;
+  } else if (exponent == 0x1f) {  /* Infinity or NaN. */
+    bits = UINT32_C(0x7f800000) | (mantissa << 13);
+  } else {  /* Normal, rebias the exponent from 15 to 127. */
+    bits = ((exponent + 112) << 23) | (mantissa << 13);
+  }
+  bits |= (uint32_t)(value & 0x8000) << 16;
+  memcpy(&result, &bits, sizeof(result));
+  return result;
+#endif
+}
+
+float Float16ToFloat(uint16_t value) { return HalfToFloat(value); }
+
+/* Computes a float * binary16 dot product, converting the weights on the fly.
+ * Each sum accumulates in the same order as DotProduct().
+ */
+static float DotProductF16(const float* x, const uint16_t* y, int size) {
+  float sum = 0.0f;
+  int k;
+  for (k = 0; k < size; ++k) {
+    sum += x[k] * HalfToFloat(y[k]);
+  }
+  return sum;
+}
+
+void DenseLinearLayerF16(int in_size,
+                         int out_size,
+                         const float* in,
+                         const uint16_t* weights_f16,
+                         const float* bias,
+                         float* out) {
+  const uint16_t* weights_col_j = weights_f16;
+  int j;
+  for (j = 0; j < out_size; ++j, weights_col_j += in_size) {
+    out[j] = DotProductF16(in, weights_col_j, in_size) + bias[j];
+  }
+}
+
+void DenseReluLayerF16(int in_size,
+                       int out_size,
+                       const float* in,
+                       const uint16_t* weights_f16,
+                       const float* bias,
+                       float* out) {
+  const uint16_t* weights_col_j = weights_f16;
+  int j;
+  for (j = 0; j < out_size; ++j, weights_col_j += in_size) {
+    out[j] = Relu(DotProductF16(in, weights_col_j, in_size) + bias[j]);
+  }
+}
+
 void Conv1DReluLayer(int in_frames,
                      int in_channels,
                      int out_channels,
@@ -85,6 +331,211 @@ void Conv1DReluLayer(int in_frames,
   }
 }
 
+/* Loads the first `size` of 4 lanes from `p`, with zeros in the other lanes. */
+static Float4 LoadPartialFloat4(const float* p, int size) {
+  if (size == 4) { return Float4Load(p); }
+  float lanes[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+  int c;
+  for (c = 0; c < size; ++c) {
+    lanes[c] = p[c];
+  }
+  return Float4Load(lanes);
+}
+
+/* Adds `bias` to `sums`, applies ReLU if `apply_relu` is nonzero, and stores
+ * the first `size` of 4 lanes to `out`.
+ */
+static void StoreUnitsFloat4(Float4 sums, Float4 bias, int apply_relu,
+                             int size, float* out) {
+  sums = Float4Add(sums, bias);
+  if (apply_relu) { sums = Float4Max(sums, Float4Broadcast(0.0f)); }
+  if (size == 4) {
+    Float4Store(out, sums);
+  } else {
+    float lanes[4];
+    Float4Store(lanes, sums);
+    int c;
+    for (c = 0; c < size; ++c) {
+      out[c] = lanes[c];
+    }
+  }
+}
+
+static void DenseLayerSparse(const DenseSparseWeights* weights,
+                             const float* in,
+                             const float* bias,
+                             int apply_relu,
+                             float* out) {
+  const uint16_t* group_begin = weights->group_begin;
+  const uint16_t* block_input = weights->block_input;
+  const int out_size = weights->out_size;
+  int j0;
+  int g;
+  for (j0 = 0, g = 0; j0 < out_size; j0 += 4, ++g) {
+    const int size = (out_size - j0 < 4) ? out_size - j0 : 4;
+    const float* block_weights = weights->block_weights + 4 * group_begin[g];
+    Float4 sum = Float4Broadcast(0.0f);
+    int b;
+    for (b = group_begin[g]; b < group_begin[g + 1]; ++b, block_weights += 4) {
+      sum = Float4Add(sum, Float4Mul(Float4Broadcast(in[block_input[b]]),
+                                     Float4Load(block_weights)));
+    }
+    StoreUnitsFloat4(sum, LoadPartialFloat4(bias + j0, size), apply_relu,
+                     size, out + j0);
+  }
+}
+
+void DenseLinearLayerSparse(const DenseSparseWeights* weights,
+                            const float* in,
+                            const float* bias,
+                            float* out) {
+  DenseLayerSparse(weights, in, bias, 0, out);
+}
+
+void DenseReluLayerSparse(const DenseSparseWeights* weights,
+                          const float* in,
+                          const float* bias,
+                          float* out) {
+  DenseLayerSparse(weights, in, bias, 1, out);
+}
+
+/* Number of output channels and frames in a tile of the packed conv layer. */
+enum { kConvTileChannels = 4, kConvTileFrames = 4 };
+
+int Conv1DPackedFiltersSize(int in_channels,
+                            int out_channels,
+                            int kernel_size) {
+  const int num_groups = (out_channels + kConvTileChannels - 1)
+      / kConvTileChannels;
+  return in_channels * kernel_size * kConvTileChannels * num_groups;
+}
+
+void Conv1DPackFilters(int in_channels,
+                       int out_channels,
+                       int kernel_size,
+                       const float* filters,
+                       float* packed) {
+  const int dot_size = kernel_size * in_channels;
+  const int size = Conv1DPackedFiltersSize(
+      in_channels, out_channels, kernel_size);
+  int k;
+  for (k = 0; k < size; ++k) {
+    packed[k] = 0.0f;
+  }
+  for (k = 0; k < out_channels; ++k) {
+    float* dest = packed + kConvTileChannels * dot_size *
+        (k / kConvTileChannels) + k % kConvTileChannels;
+    const float* filter_k = filters + dot_size * k;
+    int i;
+    for (i = 0; i < dot_size; ++i) {
+      dest[kConvTileChannels * i] = filter_k[i];
+    }
+  }
+}
+
+static void Conv1DLayerPacked(int in_frames,
+                              int in_channels,
+                              int out_channels,
+                              int kernel_size,
+                              const float* in,
+                              const float* packed_filters,
+                              const float* bias,
+                              int max_pool,
+                              float* out) {
+  const int conv_frames = in_frames - kernel_size + 1;
+  /* With max pooling, a trailing odd frame is dropped. */
+  const int num_frames = max_pool ? conv_frames & ~1 : conv_frames;
+  /* Number of conv frames per output frame. */
+  const int frame_step = max_pool ? 2 : 1;
+  const int dot_size = kernel_size * in_channels;
+  int k0;
+  for (k0 = 0; k0 < out_channels; k0 += kConvTileChannels) {
+    const float* filters = packed_filters + dot_size * k0;
+    const int num_channels = (out_channels - k0 < kConvTileChannels)
+        ? out_channels - k0 : kConvTileChannels;
+    const Float4 bias4 = LoadPartialFloat4(bias + k0, num_channels);
+
+    int n = 0;
+    for (; n + kConvTileFrames <= num_frames; n += kConvTileFrames) {
+      const float* in0 = in + in_channels * n;
+      const float* in1 = in0 + in_channels;
+      const float* in2 = in1 + in_channels;
+      const float* in3 = in2 + in_channels;
+      Float4 sum0 = Float4Broadcast(0.0f);
+      Float4 sum1 = sum0;
+      Float4 sum2 = sum0;
+      Float4 sum3 = sum0;
+      int i;
+      for (i = 0; i < dot_size; ++i) {
+        const Float4 w = Float4Load(filters + kConvTileChannels * i);
+        sum0 = Float4Add(sum0, Float4Mul(Float4Broadcast(in0[i]), w));
+        sum1 = Float4Add(sum1, Float4Mul(Float4Broadcast(in1[i]), w));
+        sum2 = Float4Add(sum2, Float4Mul(Float4Broadcast(in2[i]), w));
+        sum3 = Float4Add(sum3, Float4Mul(Float4Broadcast(in3[i]), w));
+      }
+      if (max_pool) {
+        /* Adding bias and ReLU are monotonic, so pool before them. */
+        float* out_n = out + out_channels * (n / 2) + k0;
+        StoreUnitsFloat4(Float4Max(sum0, sum1), bias4, 1, num_channels,
+                         out_n);
+        StoreUnitsFloat4(Float4Max(sum2, sum3), bias4, 1, num_channels,
+                         out_n + out_channels);
+      } else {
+        float* out_n = out + out_channels * n + k0;
+        StoreUnitsFloat4(sum0, bias4, 1, num_channels, out_n);
+        StoreUnitsFloat4(sum1, bias4, 1, num_channels,
+                         out_n + out_channels);
+        StoreUnitsFloat4(sum2, bias4, 1, num_channels,
+                         out_n + 2 * out_channels);
+        StoreUnitsFloat4(sum3, bias4, 1, num_channels,
+                         out_n + 3 * out_channels);
+      }
+    }
+
+    /* Process remaining frames, one output frame at a time. Without pooling,
+     * in1 is the same as in0, and the max is a no-op.
+     */
+    for (; n < num_frames; n += frame_step) {
+      const float* in0 = in + in_channels * n;
+      const float* in1 = in0 + in_channels * (frame_step - 1);
+      Float4 sum0 = Float4Broadcast(0.0f);
+      Float4 sum1 = sum0;
+      int i;
+      for (i = 0; i < dot_size; ++i) {
+        const Float4 w = Float4Load(filters + kConvTileChannels * i);
+        sum0 = Float4Add(sum0, Float4Mul(Float4Broadcast(in0[i]), w));
+        sum1 = Float4Add(sum1, Float4Mul(Float4Broadcast(in1[i]), w));
+      }
+      StoreUnitsFloat4(Float4Max(sum0, sum1), bias4, 1, num_channels,
+                       out + out_channels * (n / frame_step) + k0);
+    }
+  }
+}
+
+void Conv1DReluLayerPacked(int in_frames,
+                           int in_channels,
+                           int out_channels,
+                           int kernel_size,
+                           const float* in,
+                           const float* packed_filters,
+                           const float* bias,
+                           float* out) {
+  Conv1DLayerPacked(in_frames, in_channels, out_channels, kernel_size,
+                    in, packed_filters, bias, 0, out);
+}
+
+void Conv1DReluMaxPoolLayerPacked(int in_frames,
+                                  int in_channels,
+                                  int out_channels,
+                                  int kernel_size,
+                                  const float* in,
+                                  const float* packed_filters,
+                                  const float* bias,
+                                  float* out) {
+  Conv1DLayerPacked(in_frames, in_channels, out_channels, kernel_size,
+                    in, packed_filters, bias, 1, out);
+}
+
 /* Max pool size is hard coded to 2. */
 enum { kMaxPoolSize = 2 };
 
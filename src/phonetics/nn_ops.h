@@ -19,10 +19,17 @@
 #ifndef AUDIO_TO_TACTILE_SRC_PHONETICS_NN_OPS_H_
 #define AUDIO_TO_TACTILE_SRC_PHONETICS_NN_OPS_H_
 
+#include <stdint.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/* Max `in_size` for the int8 dense layers. This bounds int32 accumulation of
+ * int16 * int8 products, 512 * 32767 * 127 < 2^31.
+ */
+#define kDenseInt8MaxInSize 512
+
 /* Computes in * weights + bias to perform dense (fully-connected) layer,
  *
  *   out[j] = (sum_k in[k] * weights[k, j]) + bias[j],
@@ -51,6 +58,141 @@ void DenseReluLayer(int in_size,
                     const float* bias,
                     float* out);
 
+/* Batched DenseLinearLayer, computing the layer for `num_inputs` inputs,
+ *
+ *   out[m, j] = (sum_k in[m * in_stride + k] * weights[k, j]) + bias[j],
+ *
+ * where `out` is a row-major matrix of shape [num_inputs, out_size]. Use
+ * in_stride = in_size for densely-packed inputs; a smaller in_stride lets
+ * consecutive inputs overlap, as for a sliding window over frames. Inputs are
+ * processed in blocks so that each weight is loaded once per block rather than
+ * once per input. Results are the same as calling DenseLinearLayer on each
+ * input.
+ */
+void DenseLinearLayerBatch(int num_inputs,
+                           int in_size,
+                           int in_stride,
+                           int out_size,
+                           const float* in,
+                           const float* weights,
+                           const float* bias,
+                           float* out);
+
+/* Same as above but with ReLU activation. */
+void DenseReluLayerBatch(int num_inputs,
+                         int in_size,
+                         int in_stride,
+                         int out_size,
+                         const float* in,
+                         const float* weights,
+                         const float* bias,
+                         float* out);
+
+/* Dense layer with int8-quantized weights. This computes approximately the
+ * same as DenseLinearLayer with weights[k, j] = weight_scales[j] * weights_q[k,
+ * j], but using integer arithmetic for the dot products:
+ *
+ *  - `in` is quantized on the fly to int16 with a common scale factor,
+ *    in_scale = max_k |in[k]| / 32767,
+ *  - each dot product is accumulated in int32,
+ *  - out[j] = in_scale * weight_scales[j] * dot_j + bias[j].
+ *
+ * where `weights_q` is a column-major int8 matrix of shape [in_size, out_size]
+ * and `weight_scales` is an array of size out_size. Requires in_size <=
+ * kDenseInt8MaxInSize. Compared to float weights, the int8 weights take a
+ * quarter of the memory.
+ */
+void DenseLinearLayerInt8(int in_size,
+                          int out_size,
+                          const float* in,
+                          const int8_t* weights_q,
+                          const float* weight_scales,
+                          const float* bias,
+                          float* out);
+
+/* Same as above but with ReLU activation. */
+void DenseReluLayerInt8(int in_size,
+                        int out_size,
+                        const float* in,
+                        const int8_t* weights_q,
+                        const float* weight_scales,
+                        const float* bias,
+                        float* out);
+
+/* Converts an IEEE 754 binary16 (half-precision) value, given as its bit
+ * pattern, to float. The conversion is exact, including subnormals, infinities
+ * and NaNs. It uses the F16C instruction on x86 when compiled with -mf16c, and
+ * the half-precision conversion instructions on ARM (e.g. the Cortex-M4 FPU)
+ * when compiled with -mfp16-format=ieee.
+ */
+float Float16ToFloat(uint16_t value);
+
+/* Dense layer with half-precision weights. This computes the same as
+ * DenseLinearLayer with weights[k, j] = Float16ToFloat(weights_f16[k, j]),
+ * converting the weights as they are read in the dot products. `weights_f16`
+ * is a column-major matrix of shape [in_size, out_size] of binary16 bit
+ * patterns. Compared to float weights, the weights take half the memory, and
+ * unlike int8 quantization, the only error is rounding each weight to 11
+ * significant bits.
+ */
+void DenseLinearLayerF16(int in_size,
+                         int out_size,
+                         const float* in,
+                         const uint16_t* weights_f16,
+                         const float* bias,
+                         float* out);
+
+/* Same as above but with ReLU activation. */
+void DenseReluLayerF16(int in_size,
+                       int out_size,
+                       const float* in,
+                       const uint16_t* weights_f16,
+                       const float* bias,
+                       float* out);
+
+/* Block-sparse weight matrix for DenseLinearLayerSparse(), for pruned
+ * networks. The [in_size, out_size] matrix is divided into 4x1 blocks of 4
+ * consecutive output units for one input, and only the nonzero blocks are
+ * stored, in compressed sparse row (CSR) form by group of 4 output units:
+ *
+ *  - `group_begin` has ceil(out_size / 4) + 1 elements. The blocks for units
+ *    4 * g to 4 * g + 3 are blocks group_begin[g] to group_begin[g + 1] - 1.
+ *  - `block_input[b]` is the input index k of block b. Within a group, blocks
+ *    are in increasing order of k.
+ *  - `block_weights[4 * b + c]` is weights[k, 4 * g + c]. The last group is
+ *    padded with zeros if out_size is not a multiple of 4.
+ *
+ * Storage is 18 bytes per nonzero block versus 16 bytes for dense float
+ * weights, so with 75% of blocks pruned, the matrix takes 28% of the memory
+ * and the layer a quarter of the multiplies. Indices are 16-bit,
+ * so in_size and the number of blocks must be at most 65535.
+ * export_model_as_c_data.py writes weights in this form with --sparse.
+ */
+typedef struct {
+  int in_size;
+  int out_size;
+  const uint16_t* group_begin;
+  const uint16_t* block_input;
+  const float* block_weights;
+} DenseSparseWeights;
+
+/* Dense layer with block-sparse weights, computing the same as
+ * DenseLinearLayer() with the corresponding dense weights. The 4 units of a
+ * block are computed together in Float4 lanes (see simd.h). Each output
+ * accumulates in the same order as DenseLinearLayer(), skipping zeros, so
+ * results are the same.
+ */
+void DenseLinearLayerSparse(const DenseSparseWeights* weights,
+                            const float* in,
+                            const float* bias,
+                            float* out);
+
+/* Same as above but with ReLU activation. */
+void DenseReluLayerSparse(const DenseSparseWeights* weights,
+                          const float* in,
+                          const float* bias,
+                          float* out);
+
 /* Computes a 1D conv layer with ReLU activation,
  *
  *   out[n, k] = relu(sum_{dn, q} in[n + dn, q] * filters[q, dn, k] + bias[k]).
@@ -72,6 +214,58 @@ void Conv1DReluLayer(int in_frames,
                      const float* bias,
                      float* out);
 
+/* Gets the number of floats in the packed filters for Conv1DReluLayerPacked(),
+ * which is `in_channels * kernel_size * out_channels` with `out_channels`
+ * rounded up to a multiple of 4.
+ */
+int Conv1DPackedFiltersSize(int in_channels,
+                            int out_channels,
+                            int kernel_size);
+
+/* Repacks `filters`, in the layout of Conv1DReluLayer(), for
+ * Conv1DReluLayerPacked(). The output channels are interleaved in groups of 4,
+ *
+ *   packed[4 * (i + dot_size * (k / 4)) + k % 4] = filters[i + dot_size * k],
+ *
+ * where dot_size = in_channels * kernel_size, with zeros in the padding lanes
+ * of the last group. This can be done once at load time, or at export time for
+ * constant filters. `packed` must have Conv1DPackedFiltersSize() elements.
+ */
+void Conv1DPackFilters(int in_channels,
+                       int out_channels,
+                       int kernel_size,
+                       const float* filters,
+                       float* packed);
+
+/* Same as Conv1DReluLayer(), but with filters repacked by Conv1DPackFilters().
+ * Each step of the inner loop computes a tile of 4 output channels (in Float4
+ * lanes, see simd.h) by 4 output frames, so each filter vector is loaded once
+ * per 4 frames and each input value once per 4 channels. Each output
+ * accumulates in the same order as Conv1DReluLayer(), so results are the same.
+ */
+void Conv1DReluLayerPacked(int in_frames,
+                           int in_channels,
+                           int out_channels,
+                           int kernel_size,
+                           const float* in,
+                           const float* packed_filters,
+                           const float* bias,
+                           float* out);
+
+/* Fused Conv1DReluLayerPacked() followed by MaxPool1DLayer(), without writing
+ * the intermediate conv output. `out` is a row-major matrix of shape
+ * [floor((in_frames - kernel_size + 1) / 2), out_channels]. Results are the
+ * same as the two separate layers.
+ */
+void Conv1DReluMaxPoolLayerPacked(int in_frames,
+                                  int in_channels,
+                                  int out_channels,
+                                  int kernel_size,
+                                  const float* in,
+                                  const float* packed_filters,
+                                  const float* bias,
+                                  float* out);
+
 /* Computes 1D max pooling with a pool size (decimation factor) of 2,
  *
  *   out[n, c] = max(in[2 * n, c], in[2 * n + 1, c]).
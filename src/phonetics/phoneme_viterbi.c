@@ -0,0 +1,190 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "phonetics/phoneme_viterbi.h"
+
+#include <math.h>
+#include <stdio.h>
+
+void PhonemeViterbiSetDefaultParams(PhonemeViterbiParams* params) {
+  params->lag = 6;
+  params->stay_log_prob = log(0.9);
+  params->switch_log_prob = log(0.1 / (kClassifyPhonemeNumPhonemes - 1));
+  params->min_score = 1e-4f;
+  params->arcs = NULL;
+  params->num_arcs = 0;
+}
+
+int /*bool*/ PhonemeViterbiInit(PhonemeViterbi* viterbi,
+                                const PhonemeViterbiParams* params) {
+  if (viterbi == NULL || params == NULL) {
+    return 0;
+  } else if (!(0 <= params->lag && params->lag <= kPhonemeViterbiMaxLag)) {
+    fprintf(stderr, "Error: lag must be between 0 and %d.\n",
+            kPhonemeViterbiMaxLag);
+    return 0;
+  } else if (!(0 <= params->num_arcs &&
+               params->num_arcs <= kPhonemeViterbiMaxArcs) ||
+             (params->num_arcs > 0 && params->arcs == NULL)) {
+    fprintf(stderr, "Error: num_arcs must be between 0 and %d.\n",
+            kPhonemeViterbiMaxArcs);
+    return 0;
+  } else if (!(params->min_score > 0.0f)) {
+    fprintf(stderr, "Error: min_score must be positive.\n");
+    return 0;
+  }
+
+  /* Count arcs into each state, then bucket them by destination. */
+  int count[kClassifyPhonemeNumPhonemes] = {0};
+  int i;
+  for (i = 0; i < params->num_arcs; ++i) {
+    const PhonemeViterbiArc* arc = &params->arcs[i];
+    if (!(0 <= arc->from && arc->from < kClassifyPhonemeNumPhonemes &&
+          0 <= arc->to && arc->to < kClassifyPhonemeNumPhonemes) ||
+        arc->from == arc->to) {
+      fprintf(stderr, "Error: Invalid arc %d -> %d.\n", arc->from, arc->to);
+      return 0;
+    }
+    ++count[arc->to];
+  }
+  viterbi->arc_begin[0] = 0;
+  int j;
+  for (j = 0; j < kClassifyPhonemeNumPhonemes; ++j) {
+    viterbi->arc_begin[j + 1] = viterbi->arc_begin[j] + count[j];
+    count[j] = viterbi->arc_begin[j];
+  }
+  for (i = 0; i < params->num_arcs; ++i) {
+    const PhonemeViterbiArc* arc = &params->arcs[i];
+    const int k = count[arc->to]++;
+    viterbi->arc_from[k] = (uint8_t)arc->from;
+    viterbi->arc_log_prob[k] = arc->log_prob;
+  }
+
+  viterbi->lag = params->lag;
+  viterbi->stay_log_prob = params->stay_log_prob;
+  viterbi->switch_log_prob = params->switch_log_prob;
+  viterbi->min_score = params->min_score;
+  viterbi->log_min_score = log(params->min_score);
+  PhonemeViterbiReset(viterbi);
+  return 1;
+}
+
+void PhonemeViterbiReset(PhonemeViterbi* viterbi) {
+  int j;
+  for (j = 0; j < kClassifyPhonemeNumPhonemes; ++j) {
+    viterbi->path_log_prob[j] = 0.0f;
+  }
+  viterbi->head = 0;
+  viterbi->num_frames = 0;
+}
+
+/* Finds the index of the largest path log probability. */
+static int BestState(const PhonemeViterbi* viterbi) {
+  int best = 0;
+  int j;
+  for (j = 1; j < kClassifyPhonemeNumPhonemes; ++j) {
+    if (viterbi->path_log_prob[j] > viterbi->path_log_prob[best]) { best = j; }
+  }
+  return best;
+}
+
+/* Follows the backpointers of the newest frame and `num_steps - 1` frames
+ * before it, starting from `state`, to get the state `num_steps` frames back.
+ */
+static int TraceBack(const PhonemeViterbi* viterbi, int state, int num_steps) {
+  int index = viterbi->head;
+  int k;
+  for (k = 0; k < num_steps; ++k) {
+    index = (index == 0 ? viterbi->lag : index) - 1;
+    state = viterbi->backpointers[index][state];
+  }
+  return state;
+}
+
+int PhonemeViterbiProcessFrame(PhonemeViterbi* viterbi,
+                               const float* phoneme_scores) {
+  const float* prev = viterbi->path_log_prob;
+
+  /* Find the best and second-best previous states. The best path into state j
+   * through a generic switch transition comes from the best state other
+   * than j, which is the second best when j is the best.
+   */
+  int best = BestState(viterbi);
+  int second = (best == 0) ? 1 : 0;
+  int j;
+  for (j = 0; j < kClassifyPhonemeNumPhonemes; ++j) {
+    if (j != best && prev[j] > prev[second]) { second = j; }
+  }
+
+  float next[kClassifyPhonemeNumPhonemes];
+  uint8_t backpointers[kClassifyPhonemeNumPhonemes];
+  float max_log_prob = kPhonemeViterbiImpossible;
+  for (j = 0; j < kClassifyPhonemeNumPhonemes; ++j) {
+    /* Self-loop. */
+    float log_prob = prev[j] + viterbi->stay_log_prob;
+    int from = j;
+    /* Generic switch transition. */
+    const int other = (j == best) ? second : best;
+    float candidate = prev[other] + viterbi->switch_log_prob;
+    if (candidate > log_prob) {
+      log_prob = candidate;
+      from = other;
+    }
+    /* Sparse arcs. */
+    int k;
+    for (k = viterbi->arc_begin[j]; k < viterbi->arc_begin[j + 1]; ++k) {
+      candidate = prev[viterbi->arc_from[k]] + viterbi->arc_log_prob[k];
+      if (candidate > log_prob) {
+        log_prob = candidate;
+        from = viterbi->arc_from[k];
+      }
+    }
+
+    /* Emission log probability. */
+    const float score = phoneme_scores[j];
+    log_prob += (score > viterbi->min_score) ? (float)log(score)
+                                             : viterbi->log_min_score;
+    next[j] = log_prob;
+    backpointers[j] = (uint8_t)from;
+    if (log_prob > max_log_prob) { max_log_prob = log_prob; }
+  }
+
+  /* Normalize so that the max is zero, to keep values bounded. */
+  for (j = 0; j < kClassifyPhonemeNumPhonemes; ++j) {
+    viterbi->path_log_prob[j] = next[j] - max_log_prob;
+  }
+  ++viterbi->num_frames;
+
+  if (viterbi->lag == 0) { return BestState(viterbi); }
+
+  for (j = 0; j < kClassifyPhonemeNumPhonemes; ++j) {
+    viterbi->backpointers[viterbi->head][j] = backpointers[j];
+  }
+  if (++viterbi->head == viterbi->lag) { viterbi->head = 0; }
+
+  if (viterbi->num_frames <= viterbi->lag) { return -1; }
+  return TraceBack(viterbi, BestState(viterbi), viterbi->lag);
+}
+
+int PhonemeViterbiFlush(const PhonemeViterbi* viterbi, int* phonemes) {
+  const int num_pending = (viterbi->num_frames < viterbi->lag)
+      ? (int)viterbi->num_frames : viterbi->lag;
+  const int best = BestState(viterbi);
+  int i;
+  for (i = 0; i < num_pending; ++i) {
+    phonemes[i] = TraceBack(viterbi, best, num_pending - 1 - i);
+  }
+  return num_pending;
+}
@@ -0,0 +1,158 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * Streaming fixed-lag Viterbi smoothing of ClassifyPhoneme() scores.
+ *
+ * The argmax label of ClassifyPhoneme() is decided independently per frame, so
+ * it flickers between phonemes with similar scores. PhonemeViterbi smooths the
+ * labels by decoding the most likely path through a hidden Markov model (HMM)
+ * with one state per phoneme class, taking the classifier's phoneme scores as
+ * emission probabilities. Decoding is fixed lag: the label for a frame is
+ * decided `lag` frames after it arrives, by tracing back from the best state of
+ * the newest frame. Larger lag gives the decoder more future context at the
+ * cost of latency.
+ *
+ * The transition matrix is sparse. Each state has a self-loop with log
+ * probability `stay_log_prob` and a transition to any other state with log
+ * probability `switch_log_prob`. In addition, a sparse list of arcs may give
+ * specific transitions a higher log probability. Setting `switch_log_prob` to
+ * kPhonemeViterbiImpossible restricts transitions to the listed arcs. The
+ * generic transitions are computed from the best and second-best previous
+ * states, so the cost per frame is O(num_phonemes + num_arcs) rather than
+ * O(num_phonemes^2).
+ *
+ * All state is in the struct, with no dynamic allocation. With the maximum lag
+ * and arcs it takes about 3 kB.
+ *
+ * Example use:
+ *   PhonemeViterbiParams params;
+ *   PhonemeViterbiSetDefaultParams(&params);
+ *   PhonemeViterbi viterbi;
+ *   PhonemeViterbiInit(&viterbi, &params);
+ *
+ *   // Once per frame.
+ *   ClassifyPhoneme(frames, NULL, &scores);
+ *   int phoneme = PhonemeViterbiProcessFrame(&viterbi, scores.phoneme);
+ *   if (phoneme >= 0) {
+ *     // `phoneme` is the smoothed label for the frame `params.lag` frames ago.
+ *   }
+ */
+
+#ifndef AUDIO_TO_TACTILE_SRC_PHONETICS_PHONEME_VITERBI_H_
+#define AUDIO_TO_TACTILE_SRC_PHONETICS_PHONEME_VITERBI_H_
+
+#include <stdint.h>
+
+#include "phonetics/classify_phoneme.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Max supported lag in frames. */
+#define kPhonemeViterbiMaxLag 32
+/* Max number of sparse arcs. */
+#define kPhonemeViterbiMaxArcs 256
+/* Log probability representing an impossible transition. */
+#define kPhonemeViterbiImpossible (-1e30f)
+
+typedef struct {
+  int from;  /* Source phoneme index. */
+  int to;  /* Destination phoneme index. */
+  float log_prob;  /* Transition log probability. */
+} PhonemeViterbiArc;
+
+typedef struct {
+  /* Number of frames of delay before a label is decided. Must be between 0
+   * and kPhonemeViterbiMaxLag.
+   */
+  int lag;
+  /* Log probability of staying in the same phoneme. */
+  float stay_log_prob;
+  /* Log probability of a transition to any other phoneme, or
+   * kPhonemeViterbiImpossible to allow only the transitions in `arcs`.
+   */
+  float switch_log_prob;
+  /* Scores are clamped below to `min_score` before taking the log, which
+   * bounds the penalty of a frame where the classifier strongly disagrees.
+   */
+  float min_score;
+  /* Sparse arcs, with from != to. Where an arc and the generic switch
+   * transition both apply, the larger log probability is used. The arcs are
+   * copied by PhonemeViterbiInit().
+   */
+  const PhonemeViterbiArc* arcs;
+  int num_arcs;
+} PhonemeViterbiParams;
+
+typedef struct {
+  int lag;
+  float stay_log_prob;
+  float switch_log_prob;
+  float min_score;
+  float log_min_score;
+
+  /* Arcs in compressed sparse row form by destination: the arcs into state j
+   * are entries arc_begin[j] to arc_begin[j + 1] - 1 of arc_from and
+   * arc_log_prob.
+   */
+  uint16_t arc_begin[kClassifyPhonemeNumPhonemes + 1];
+  uint8_t arc_from[kPhonemeViterbiMaxArcs];
+  float arc_log_prob[kPhonemeViterbiMaxArcs];
+
+  /* Log probability of the best path ending in each state, normalized so that
+   * the max is zero.
+   */
+  float path_log_prob[kClassifyPhonemeNumPhonemes];
+  /* Ring of backpointers for the last `lag` frames, where backpointers[k][j]
+   * is the previous state on the best path ending in state j at that frame.
+   */
+  uint8_t backpointers[kPhonemeViterbiMaxLag][kClassifyPhonemeNumPhonemes];
+  /* Index in `backpointers` for the next frame. */
+  int head;
+  /* Number of frames processed since the last reset. */
+  long num_frames;
+} PhonemeViterbi;
+
+/* Sets default parameters: 6 frames (48 ms) of lag, stay probability 0.9 with
+ * the remainder split evenly among the other phonemes, and no arcs.
+ */
+void PhonemeViterbiSetDefaultParams(PhonemeViterbiParams* params);
+
+/* Initializes the decoder from `params`. Returns 1 on success, 0 on failure. */
+int /*bool*/ PhonemeViterbiInit(PhonemeViterbi* viterbi,
+                                const PhonemeViterbiParams* params);
+
+/* Resets to the initial state, with all phonemes equally likely. */
+void PhonemeViterbiReset(PhonemeViterbi* viterbi);
+
+/* Processes one frame of `phoneme_scores`, an array of
+ * kClassifyPhonemeNumPhonemes scores as in ClassifyPhonemeScores::phoneme.
+ * Returns the decided phoneme index for the frame `lag` frames before this
+ * one, or -1 if fewer than `lag + 1` frames have been processed.
+ */
+int PhonemeViterbiProcessFrame(PhonemeViterbi* viterbi,
+                               const float* phoneme_scores);
+
+/* Gets the labels for the frames that are still undecided, e.g. at the end of
+ * the input. Writes min(num_frames, lag) phoneme indices to `phonemes`, oldest
+ * frame first, and returns the number written. This does not change the state.
+ */
+int PhonemeViterbiFlush(const PhonemeViterbi* viterbi, int* phonemes);
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif
+#endif /* AUDIO_TO_TACTILE_SRC_PHONETICS_PHONEME_VITERBI_H_ */
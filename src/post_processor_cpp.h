@@ -45,6 +45,23 @@ class PostProcessorWrapper {
   // processor scales down the output to consume less power.
   void LowBattery();
 
+  // Sets the channels in use, e.g. from ChannelMapUsedInputs(), so that unused
+  // channels are skipped. See PostProcessorSetActiveChannels().
+  void SetActiveChannels(uint32_t active_channels) {
+    ::PostProcessorSetActiveChannels(&post_processor_, active_channels);
+  }
+
+  // Gets the warm state of kPostProcessorWarmStateSize floats, see
+  // PostProcessorGetWarmState().
+  void GetWarmState(float* warm_state) const {
+    ::PostProcessorGetWarmState(&post_processor_, warm_state);
+  }
+
+  // Restores the warm state. Returns true on success.
+  bool SetWarmState(const float* warm_state) {
+    return ::PostProcessorSetWarmState(&post_processor_, warm_state);
+  }
+
  private:
   PostProcessor post_processor_;
   float sample_rate_;
@@ -19,8 +19,19 @@ static uint8_t pwm_event;
 
 static void (*callback)(void);
 
+/* Bit i is set if module PWMi is parked. */
+static volatile uint8_t parked_modules;
+
 void on_pwm_sequence_end(void (*function)(void)) { callback = function; }
 
+void set_pwm_module_parked(uint8_t which_pwm_module, int parked) {
+  if (parked) {
+    parked_modules |= 1 << which_pwm_module;
+  } else {
+    parked_modules &= ~(1 << which_pwm_module);
+  }
+}
+
 uint8_t get_pwm_event() { return pwm_event; }
 
 void PWM0_IRQHandler() { pwm_irq_handler(NRF_PWM0, 0); }
@@ -40,7 +51,17 @@ void pwm_irq_handler(NRF_PWM_Type* pwm_module, uint8_t which_pwm_module) {
      * buffer before it gets played.
      */
     callback();
-    nrf_pwm_task_trigger(pwm_module, NRF_PWM_TASK_SEQSTART0);
+    if (!(parked_modules & (1 << which_pwm_module))) {
+      nrf_pwm_task_trigger(pwm_module, NRF_PWM_TASK_SEQSTART0);
+    }
+  }
+  /* Triggered when looped playback finishes, see Pwm::PlayLooped(). Only
+   * module 0 enables this interrupt. The sequence is not restarted.
+   */
+  if (nrf_pwm_event_check(pwm_module, NRF_PWM_EVENT_LOOPSDONE)) {
+    nrf_pwm_event_clear(pwm_module, NRF_PWM_EVENT_LOOPSDONE);
+    pwm_event = which_pwm_module;
+    callback();
   }
   /* Triggered when playback is stopped. */
   if (nrf_pwm_event_check(pwm_module, NRF_PWM_EVENT_STOPPED)) {
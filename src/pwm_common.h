@@ -39,6 +39,12 @@ uint8_t get_pwm_event(void);
 /* Callback function for the interrupt handler. Can be assigned a function. */
 void on_pwm_sequence_end(void (*function)(void));
 
+/* Sets whether a pwm module is parked. The interrupt handler doesn't restart
+ * the sequence of a parked module when it ends, so that the module stays
+ * stopped after NRF_PWM_TASK_STOP.
+ */
+void set_pwm_module_parked(uint8_t which_pwm_module, int parked);
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
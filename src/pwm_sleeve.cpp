@@ -14,8 +14,10 @@
 
 #include "pwm_sleeve.h"  // NOLINT(build/include)
 
+#include <math.h>
 #include <string.h>
 
+#include "dsp/math_constants.h"  // NOLINT(build/include)
 #include "look_up.h"     // NOLINT(build/include)
 #include "nrf_gpio.h"    // NOLINT(build/include)
 #include "nrf_pwm.h"     // NOLINT(build/include)
@@ -25,6 +27,23 @@ namespace audio_tactile {
 
 Pwm SleeveTactors;
 
+// Returns true if the kNumPwmValues values data[i * stride] are all equal.
+template <typename T>
+static bool IsConstant(const T* data, int stride = 1) {
+  for (int i = 1; i < kNumPwmValues; ++i) {
+    if (data[i * stride] != data[0]) { return false; }
+  }
+  return true;
+}
+
+static NRF_PWM_Type* GetModuleRegisters(int module) {
+  switch (module) {
+    case 0: return NRF_PWM0;
+    case 1: return NRF_PWM1;
+    default: return NRF_PWM2;
+  }
+}
+
 void Pwm::Initialize() {
   // Configure amplifiers shutdowns pin.
   nrf_gpio_cfg_output(kAmpEnablePin1);
@@ -51,12 +70,7 @@ void Pwm::Initialize() {
   // <pin 1 PWM> <pin 2 PWM> <pin 3 PWM> <pin 4 PWM> ... <pin 1 PWM>
   // Even if we only use two pins (as here), we still need to set values for
   // 4 channels, as easy DMA reads them consecutively.
-  nrf_pwm_seq_cnt_set(NRF_PWM0, 0, kSamplesPerModule);
-  nrf_pwm_seq_ptr_set(NRF_PWM0, 0, pwm_buffer_);
-  nrf_pwm_seq_cnt_set(NRF_PWM1, 0, kSamplesPerModule);
-  nrf_pwm_seq_ptr_set(NRF_PWM1, 0, pwm_buffer_ + kSamplesPerModule);
-  nrf_pwm_seq_cnt_set(NRF_PWM2, 0, kSamplesPerModule);
-  nrf_pwm_seq_ptr_set(NRF_PWM2, 0, pwm_buffer_ + 2 * kSamplesPerModule);
+  SetSequenceBuffers(pwm_buffer_, kSamplesPerModule);
 
   // Enable global interrupts for PWM.
   NVIC_SetPriority(PWM0_IRQn, kIrqPriority);
@@ -108,9 +122,54 @@ void Pwm::StartPlayback() {
 void Pwm::SetUpsamplingFactor(uint32_t upsampling_factor) {
   // Subtract 1, since when refresh is at 0, 1 cycle is repeated.
   // Refresh of 1, actually means 2 cycles.
-  nrf_pwm_seq_refresh_set(NRF_PWM0, 0, upsampling_factor - 1);
-  nrf_pwm_seq_refresh_set(NRF_PWM1, 0, upsampling_factor - 1);
-  nrf_pwm_seq_refresh_set(NRF_PWM2, 0, upsampling_factor - 1);
+  refresh_ = upsampling_factor - 1;
+  nrf_pwm_seq_refresh_set(NRF_PWM0, 0, refresh_);
+  nrf_pwm_seq_refresh_set(NRF_PWM1, 0, refresh_);
+  nrf_pwm_seq_refresh_set(NRF_PWM2, 0, refresh_);
+}
+
+bool Pwm::SetInterpolationFactor(int factor) {
+  if (factor == 1) {
+    interpolation_factor_ = 1;
+    SetSequenceBuffers(pwm_buffer_, kSamplesPerModule);
+    return true;
+  }
+  if (!(1 < factor && factor <= kMaxInterpolationFactor) ||
+      !PolyphaseInterpolatorFixedInit(&interpolator_, factor, kNumTotalPwm)) {
+    return false;
+  }
+  interpolation_factor_ = factor;
+  InterpolateAllChannels();
+  SetSequenceBuffers(pwm_interpolated_, kSamplesPerModule * factor);
+  // Play each interpolated value once.
+  SetUpsamplingFactor(1);
+  return true;
+}
+
+void Pwm::SetSequenceBuffers(uint16_t* buffer, int samples_per_module) {
+  nrf_pwm_seq_cnt_set(NRF_PWM0, 0, samples_per_module);
+  nrf_pwm_seq_ptr_set(NRF_PWM0, 0, buffer);
+  nrf_pwm_seq_cnt_set(NRF_PWM1, 0, samples_per_module);
+  nrf_pwm_seq_ptr_set(NRF_PWM1, 0, buffer + samples_per_module);
+  nrf_pwm_seq_cnt_set(NRF_PWM2, 0, samples_per_module);
+  nrf_pwm_seq_ptr_set(NRF_PWM2, 0, buffer + 2 * samples_per_module);
+}
+
+void Pwm::InterpolateChannel(int channel) {
+  if (interpolation_factor_ == 1) { return; }
+  const int samples_per_module = kSamplesPerModule * interpolation_factor_;
+  uint16_t* dest = pwm_interpolated_ +
+      samples_per_module * (channel / kChannelsPerModule) +
+      (channel % kChannelsPerModule);
+  PolyphaseInterpolatorFixedProcessChannel(
+      &interpolator_, channel, GetChannelPointer(channel), kChannelsPerModule,
+      kNumPwmValues, kTopValue / 2, dest, kChannelsPerModule);
+}
+
+void Pwm::InterpolateAllChannels() {
+  for (int c = 0; c < kNumTotalPwm; ++c) {
+    InterpolateChannel(c);
+  }
 }
 
 void Pwm::DisablePwm() {
@@ -132,6 +191,7 @@ void Pwm::EnablePwm() {
 }
 
 void Pwm::DisableAmplifiers() {
+  amplifiers_enabled_ = false;
   nrf_gpio_pin_write(kAmpEnablePin1, 0);
   nrf_gpio_pin_write(kAmpEnablePin2, 0);
   nrf_gpio_pin_write(kAmpEnablePin3, 0);
@@ -141,49 +201,341 @@ void Pwm::DisableAmplifiers() {
 }
 
 void Pwm::EnableAmplifiers() {
-  nrf_gpio_pin_write(kAmpEnablePin1, 1);
-  nrf_gpio_pin_write(kAmpEnablePin2, 1);
-  nrf_gpio_pin_write(kAmpEnablePin3, 1);
-  nrf_gpio_pin_write(kAmpEnablePin4, 1);
-  nrf_gpio_pin_write(kAmpEnablePin5, 1);
-  nrf_gpio_pin_write(kAmpEnablePin6, 1);
+  amplifiers_enabled_ = true;
+  // Amplifiers of modules stopped by sparse updates stay disabled.
+  for (int module = 0; module < kNumModules; ++module) {
+    WriteModuleAmplifiers(module, !IsModuleStopped(module));
+  }
+}
+
+void Pwm::WriteModuleAmplifiers(int module, bool enable) {
+  // Module m drives the L and R pins of amplifiers 2m + 1 and 2m + 2.
+  static const uint32_t kAmpEnablePins[2 * kNumModules] = {
+      kAmpEnablePin1, kAmpEnablePin2, kAmpEnablePin3,
+      kAmpEnablePin4, kAmpEnablePin5, kAmpEnablePin6};
+  nrf_gpio_pin_write(kAmpEnablePins[2 * module], enable);
+  nrf_gpio_pin_write(kAmpEnablePins[2 * module + 1], enable);
+}
+
+void Pwm::SetSparseUpdates(bool enable) {
+  MarkAllChannelsActive();
+  sparse_updates_ = enable;
+}
+
+bool Pwm::SkipChannelUpdate(int channel, bool constant, uint16_t value) {
+  if (!sparse_updates_) { return false; }
+  if (!constant) {
+    constant_count_[channel] = 0;
+  } else if (constant_count_[channel] > 0 &&
+             constant_value_[channel] == value) {
+    if (constant_count_[channel] >= 2) { return true; }
+    ++constant_count_[channel];
+  } else {
+    constant_value_[channel] = value;
+    constant_count_[channel] = 1;
+  }
+
+  const int module = channel / kChannelsPerModule;
+  if (module == 0) { return false; }
+  bool steady = true;
+  for (int c = 0; c < kChannelsPerModule; ++c) {
+    steady &= (constant_count_[module * kChannelsPerModule + c] >= 2);
+  }
+  if (steady && !IsModuleStopped(module)) {
+    StopModule(module);
+  } else if (!steady && IsModuleStopped(module)) {
+    StartModule(module);
+  }
+  return false;
+}
+
+void Pwm::MarkAllChannelsActive() {
+  memset(constant_count_, 0, sizeof(constant_count_));
+  for (int module = 0; module < kNumModules; ++module) {
+    if (IsModuleStopped(module)) { StartModule(module); }
+  }
+}
+
+void Pwm::StopModule(int module) {
+  stopped_modules_ |= 1 << module;
+  // Park the module first, so that the interrupt handler doesn't restart it.
+  set_pwm_module_parked(module, 1);
+  nrf_pwm_task_trigger(GetModuleRegisters(module), NRF_PWM_TASK_STOP);
+  WriteModuleAmplifiers(module, false);
+}
+
+void Pwm::StartModule(int module) {
+  stopped_modules_ &= ~(1 << module);
+  WriteModuleAmplifiers(module, amplifiers_enabled_);
+  set_pwm_module_parked(module, 0);
+  nrf_pwm_task_trigger(GetModuleRegisters(module), NRF_PWM_TASK_SEQSTART0);
 }
 
 void Pwm::UpdatePwmModule(const uint16_t* data, int module) {
+  if (sparse_updates_) { MarkAllChannelsActive(); }
   memcpy(pwm_buffer_ + module * kSamplesPerModule, data,
          kSamplesPerModule * sizeof(int16_t));
+  for (int c = 0; c < kChannelsPerModule; ++c) {
+    InterpolateChannel(module * kChannelsPerModule + c);
+  }
 }
 
 void Pwm::SilenceChannel(int channel) {
+  if (SkipChannelUpdate(channel, true, 0)) { return; }
   uint16_t* dest = GetChannelPointer(channel);
   for (int i = 0; i < kNumPwmValues; ++i) {
     dest[i * kChannelsPerModule] = 0;
   }
+  InterpolateChannel(channel);
 }
 
 void Pwm::UpdateChannel(int channel, const uint16_t* data) {
+  if (SkipChannelUpdate(channel, IsConstant(data), data[0])) { return; }
   uint16_t* dest = GetChannelPointer(channel);
   for (int i = 0; i < kNumPwmValues; ++i) {
     dest[i * kChannelsPerModule] = data[i];
   }
+  InterpolateChannel(channel);
 }
 
 void Pwm::UpdateChannel(int channel, const float* data) {
+  if (SkipChannelUpdate(channel, IsConstant(data),
+                        FloatToPwmSample(data[0]))) {
+    return;
+  }
   uint16_t* dest = GetChannelPointer(channel);
   for (int i = 0; i < kNumPwmValues; ++i) {
     dest[i * kChannelsPerModule] = FloatToPwmSample(data[i]);
   }
+  InterpolateChannel(channel);
 }
 
 void Pwm::UpdateChannelWithGain(int channel, float gain, const float* data,
                                 int stride) {
-  uint16_t* dest = GetChannelPointer(channel);
   const float scale = 0.5f * kTopValue * gain;
   const float offset = 0.5f * kTopValue + 0.5f;
+  if (SkipChannelUpdate(channel, IsConstant(data, stride),
+                        static_cast<uint16_t>(scale * (*data) + offset))) {
+    return;
+  }
+  uint16_t* dest = GetChannelPointer(channel);
   for (int i = 0; i < kNumPwmValues; ++i, data += stride) {
     dest[i * kChannelsPerModule] =
         static_cast<uint16_t>(scale * (*data) + offset);
   }
+  InterpolateChannel(channel);
+}
+
+void Pwm::PostProcessToBuffer(PostProcessor* post_processor,
+                              const ChannelMap& channel_map,
+                              const float* data, uint16_t* buffer) {
+  uint16_t* pwm_channels[kNumTotalPwm];
+  for (int c = 0; c < kNumTotalPwm; ++c) {
+    pwm_channels[c] = GetChannelPointer(buffer, c);
+  }
+  PostProcessorProcessSamplesToPwm(post_processor, &channel_map, data,
+                                   kNumPwmValues, kTopValue, pwm_channels,
+                                   kChannelsPerModule);
+}
+
+void Pwm::UpdateAllChannelsPostProcessed(PostProcessor* post_processor,
+                                         const ChannelMap& channel_map,
+                                         const float* data) {
+  if (sparse_updates_) { MarkAllChannelsActive(); }
+  PostProcessToBuffer(post_processor, channel_map, data, pwm_buffer_);
+  InterpolateAllChannels();
+}
+
+bool Pwm::UpdateAllChannelsDemuxed(Demuxer* demuxer,
+                                   const float* muxed_input, float gain) {
+  if (demuxer->layout.num_channels != kNumTotalPwm) { return false; }
+  if (sparse_updates_) { MarkAllChannelsActive(); }
+  uint16_t* pwm_channels[kNumTotalPwm];
+  for (int c = 0; c < kNumTotalPwm; ++c) {
+    pwm_channels[c] = GetChannelPointer(c);
+  }
+  DemuxerProcessSamplesToPwm(demuxer, muxed_input,
+                             kNumPwmValues * demuxer->layout.rate_factor, gain,
+                             kTopValue, pwm_channels, kChannelsPerModule);
+  InterpolateAllChannels();
+  return true;
+}
+
+void Pwm::MeterEnergy(EnergyMeter* meter) {
+  const uint16_t* pwm_channels[kNumTotalPwm];
+  for (int c = 0; c < kNumTotalPwm; ++c) {
+    pwm_channels[c] = GetChannelPointer(c);
+  }
+  EnergyMeterAddPwm(meter, pwm_channels, kNumPwmValues, kChannelsPerModule,
+                    kTopValue);
+}
+
+bool Pwm::QueueAllChannelsPostProcessed(PostProcessor* post_processor,
+                                        const ChannelMap& channel_map,
+                                        const float* data) {
+  Frame* frame = queue_.BeginPush();
+  if (frame == nullptr) { return false; }
+  PostProcessToBuffer(post_processor, channel_map, data, frame->samples);
+  queue_.EndPush();
+  return true;
+}
+
+bool Pwm::PlayQueuedFrame() {
+  const Frame* frame = queue_.Front();
+  if (frame == nullptr) { return false; }
+  if (sparse_updates_) { MarkAllChannelsActive(); }
+  memcpy(pwm_buffer_, frame->samples, sizeof(pwm_buffer_));
+  queue_.PopFront();
+  InterpolateAllChannels();
+  return true;
+}
+
+bool Pwm::PlayLooped(const uint16_t* buffer, int num_frames,
+                     int num_repeats) {
+  if (buffer == nullptr ||
+      !(1 <= num_frames && num_frames <= kMaxLoopedFrames) ||
+      !(0 <= num_repeats && num_repeats <= 2 * 0xffff)) {
+    return false;
+  }
+  // Disable the per-sequence interrupts first, so that the interrupt handler
+  // doesn't restart the normal sequences.
+  for (int module = 0; module < kNumModules; ++module) {
+    nrf_pwm_int_disable(GetModuleRegisters(module),
+                        NRF_PWM_INT_SEQSTARTED0_MASK |
+                        NRF_PWM_INT_SEQEND0_MASK);
+  }
+  if (sparse_updates_) { MarkAllChannelsActive(); }
+  looped_ = true;
+
+  // Samples are at the tactile rate, so repeat each as in normal playback
+  // without interpolation.
+  const uint32_t refresh =
+      (interpolation_factor_ > 1) ? interpolation_factor_ - 1 : refresh_;
+  const int samples_per_module = kChannelsPerModule * num_frames;
+  // As in nrfx_pwm_simple_playback(), play the buffer as both SEQ0 and SEQ1.
+  // A loop plays SEQ0 then SEQ1, so an odd number of repeats starts at SEQ1.
+  const bool odd = (num_repeats % 2) != 0;
+  const uint16_t loop_count =
+      num_repeats ? static_cast<uint16_t>((num_repeats + 1) / 2) : 1;
+  for (int module = 0; module < kNumModules; ++module) {
+    NRF_PWM_Type* registers = GetModuleRegisters(module);
+    const uint16_t* sequence = buffer + module * samples_per_module;
+    for (uint8_t seq = 0; seq < 2; ++seq) {
+      nrf_pwm_seq_ptr_set(registers, seq, sequence);
+      nrf_pwm_seq_cnt_set(registers, seq, samples_per_module);
+      nrf_pwm_seq_refresh_set(registers, seq, refresh);
+      nrf_pwm_seq_end_delay_set(registers, seq, 0);
+    }
+    nrf_pwm_loop_set(registers, loop_count);
+    nrf_pwm_event_clear(registers, NRF_PWM_EVENT_LOOPSDONE);
+    // Repeating forever restarts in hardware. Otherwise, stop when done.
+    nrf_pwm_shorts_set(registers, num_repeats
+        ? NRF_PWM_SHORT_LOOPSDONE_STOP_MASK
+        : NRF_PWM_SHORT_LOOPSDONE_SEQSTART0_MASK);
+  }
+  // Only module 0 interrupts, once, at the end.
+  if (num_repeats) {
+    nrf_pwm_int_enable(NRF_PWM0, NRF_PWM_INT_LOOPSDONE_MASK);
+  }
+
+  const nrf_pwm_task_t start_task =
+      odd ? NRF_PWM_TASK_SEQSTART1 : NRF_PWM_TASK_SEQSTART0;
+  nrf_pwm_task_trigger(NRF_PWM0, start_task);
+  nrf_pwm_task_trigger(NRF_PWM1, start_task);
+  nrf_pwm_task_trigger(NRF_PWM2, start_task);
+  return true;
+}
+
+void Pwm::StopLoopedPlayback() {
+  if (!looped_) { return; }
+  looped_ = false;
+  for (int module = 0; module < kNumModules; ++module) {
+    NRF_PWM_Type* registers = GetModuleRegisters(module);
+    nrf_pwm_int_disable(registers, NRF_PWM_INT_LOOPSDONE_MASK);
+    nrf_pwm_shorts_set(registers, 0);
+    nrf_pwm_loop_set(registers, 0);
+    nrf_pwm_seq_refresh_set(registers, 0, refresh_);
+    nrf_pwm_event_clear(registers, NRF_PWM_EVENT_LOOPSDONE);
+    nrf_pwm_event_clear(registers, NRF_PWM_EVENT_SEQEND0);
+    nrf_pwm_int_enable(registers, NRF_PWM_INT_SEQSTARTED0_MASK |
+                                  NRF_PWM_INT_SEQEND0_MASK);
+  }
+  if (interpolation_factor_ > 1) {
+    SetSequenceBuffers(pwm_interpolated_,
+                       kSamplesPerModule * interpolation_factor_);
+  } else {
+    SetSequenceBuffers(pwm_buffer_, kSamplesPerModule);
+  }
+  StartPlayback();
+}
+
+int Pwm::LoadPatternToLoopBuffer(TactilePatternCache* cache,
+                                 PostProcessor* post_processor,
+                                 const ChannelMap& channel_map,
+                                 uint16_t* buffer, int max_frames) {
+  // Only a cached pattern has a known length.
+  if (cache->active_entry < 0) { return 0; }
+  const int num_frames =
+      cache->entries[cache->active_entry].num_frames - cache->position;
+  if (!(1 <= num_frames && num_frames <= max_frames &&
+        num_frames <= kMaxLoopedFrames)) {
+    return 0;
+  }
+
+  const int samples_per_module = kChannelsPerModule * num_frames;
+  memset(buffer, 0, sizeof(uint16_t) * kNumModules * samples_per_module);
+  uint16_t* pwm_channels[kNumTotalPwm];
+  for (int c = 0; c < kNumTotalPwm; ++c) {
+    pwm_channels[c] = buffer +
+        samples_per_module * (c / kChannelsPerModule) +
+        (c % kChannelsPerModule);
+  }
+  // Render in blocks of kNumPwmValues frames, as in streaming playback.
+  float block[kNumPwmValues * kTactilePatternMaxChannels];
+  for (int start = 0; start < num_frames; start += kNumPwmValues) {
+    const int block_frames = (num_frames - start < kNumPwmValues)
+        ? num_frames - start : kNumPwmValues;
+    TactilePatternCacheSynthesize(cache, block_frames, block);
+    PostProcessorProcessSamplesToPwm(post_processor, &channel_map, block,
+                                     block_frames, kTopValue, pwm_channels,
+                                     kChannelsPerModule);
+    for (int c = 0; c < kNumTotalPwm; ++c) {
+      pwm_channels[c] += kChannelsPerModule * block_frames;
+    }
+  }
+  return num_frames;
+}
+
+int Pwm::LoadToneToLoopBuffer(int channel, float frequency_hz,
+                              float amplitude, float sample_rate_hz,
+                              uint16_t* buffer, int max_frames) {
+  if (!(0 <= channel && channel < kNumTotalPwm) ||
+      !(0.0f < frequency_hz && frequency_hz < sample_rate_hz / 2)) {
+    return 0;
+  }
+  if (max_frames > kMaxLoopedFrames) { max_frames = kMaxLoopedFrames; }
+  // Fit as many whole periods as possible, so that the loop is seamless.
+  const int num_periods =
+      static_cast<int>(max_frames * frequency_hz / sample_rate_hz);
+  if (num_periods < 1) { return 0; }
+  int num_frames = static_cast<int>(
+      num_periods * sample_rate_hz / frequency_hz + 0.5f);
+  if (num_frames > max_frames) { num_frames = max_frames; }
+
+  const int samples_per_module = kChannelsPerModule * num_frames;
+  const uint16_t silence = FloatToPwmSample(0.0f);
+  for (int i = 0; i < kNumModules * samples_per_module; ++i) {
+    buffer[i] = silence;
+  }
+  uint16_t* dest = buffer +
+      samples_per_module * (channel / kChannelsPerModule) +
+      (channel % kChannelsPerModule);
+  const float radians_per_frame = 2 * M_PI * num_periods / num_frames;
+  for (int i = 0; i < num_frames; ++i) {
+    dest[i * kChannelsPerModule] =
+        FloatToPwmSample(amplitude * sinf(radians_per_frame * i));
+  }
+  return num_frames;
 }
 
 void Pwm::UpdatePwmAllChannelsByte(const uint8_t* data) {
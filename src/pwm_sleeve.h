@@ -61,6 +61,13 @@
 #include "board_defs.h"
 #include "nrf_pwm.h"
 #include "cpp/constants.h"
+#include "cpp/spsc_ring_buffer.h"
+#include "dsp/channel_map.h"
+#include "dsp/polyphase_interpolator_fixed.h"
+#include "mux/demuxer.h"
+#include "tactile/energy_meter.h"
+#include "tactile/post_processor.h"
+#include "tactile/tactile_pattern_cache.h"
 
 // NOLINTEND
 
@@ -73,6 +80,12 @@ class Pwm {
   enum {
     kTopValue = 512,   // Individual PWM values can't be above this number.
     kUpsamplingFactor = 8,
+    // Number of frames that can be queued with QueueAllChannelsPostProcessed.
+    kQueueDepth = 4,
+    // Max factor for SetInterpolationFactor().
+    kMaxInterpolationFactor = 8,
+    // Max frames for PlayLooped(), limited by the 15-bit sequence length.
+    kMaxLoopedFrames = 8191,
   };
 
   // Pins on port 1 are always offset by 32. For example pin 7 (P1.07) is 39.
@@ -131,6 +144,42 @@ class Pwm {
   // 1 means each pwm value is repeated once. For example, 1,1,2,2,3,3,4,4.
   void SetUpsamplingFactor(uint32_t upsampling_factor);
 
+  // Interpolation. Rather than repeating each PWM value, upsamples by `factor`
+  // with a fixed-point polyphase interpolator (see
+  // dsp/polyphase_interpolator_fixed.h). This attenuates images of the tactile
+  // signal around multiples of the tactile sample rate by 45 dB or more, where
+  // repetition attenuates them by only 12-25 dB, so the tactile pipeline can
+  // run at the decimated rate with clean output. A sequence then plays
+  // kNumPwmValues * factor values once each, the same duration as with
+  // SetUpsamplingFactor(factor), plus a delay of 2 tactile samples.
+  //
+  // `factor` is between 1 and kMaxInterpolationFactor, where 1 disables
+  // interpolation. While enabled, the Update*() and SilenceChannel() functions
+  // interpolate each channel as it is written, so each channel should be
+  // written once per sequence. Returns false if `factor` is invalid.
+  bool SetInterpolationFactor(int factor);
+
+  // Sparse updates. When enabled, a channel written with constant samples, e.g.
+  // silence, is written as usual for two updates, after which its playback
+  // buffer (and interpolation) holds the steady value. Further updates with
+  // the same constant are skipped. A PWM module whose four channels are all
+  // steady is stopped and its two amplifiers are disabled, saving CPU, DMA
+  // bandwidth, and idle power, until one of its channels is written with
+  // different samples. Module 0 is never stopped, since its sequence end
+  // event paces the OnSequenceEnd() callback.
+  //
+  // Sparse updates apply to the per-channel Update*() functions,
+  // SilenceChannel(), and UpdatePwmAllChannelsByte(). Writes of whole
+  // buffers (UpdatePwmModule(), UpdateAllChannelsPostProcessed(),
+  // UpdateAllChannelsDemuxed(), and PlayQueuedFrame()) mark all channels
+  // active. Disabled by default.
+  void SetSparseUpdates(bool enable);
+
+  // Returns true if `module` is stopped by sparse updates.
+  bool IsModuleStopped(int module) const {
+    return (stopped_modules_ & (1 << module)) != 0;
+  }
+
   // Stop the callbacks, disables the PWM.
   void DisablePwm();
 
@@ -195,6 +244,119 @@ class Pwm {
   void UpdateChannelWithGain(int channel, float gain, const float* data,
                              int stride = 1);
 
+  // Runs post processing, channel mapping, and PWM conversion in a single pass
+  // with PostProcessorProcessSamplesToPwm(), writing output channel c of
+  // `channel_map` to PWM channel c. The result is the same as calling
+  // PostProcessorProcessSamples(), ChannelMapApply(), and UpdateChannel() on
+  // each channel, but it avoids intermediate buffers. `data` has
+  // kNumPwmValues frames of `post_processor->num_channels` channels in
+  // interleaved order and is not modified. `channel_map` should have at most
+  // 12 output channels.
+  void UpdateAllChannelsPostProcessed(PostProcessor* post_processor,
+                                      const ChannelMap& channel_map,
+                                      const float* data);
+
+  // Runs the demuxer on `muxed_input`, kNumPwmValues * rate_factor received
+  // samples, writing demuxed channel c scaled by `gain` and saturated to PWM
+  // channel c with DemuxerProcessSamplesToPwm(). The result is the same as
+  // calling DemuxerProcessSamples() and UpdateChannel() on each channel with
+  // clipping, but it avoids the intermediate float buffer and conversion pass.
+  // Returns false if the demuxer layout doesn't have 12 channels.
+  bool UpdateAllChannelsDemuxed(Demuxer* demuxer, const float* muxed_input,
+                                float gain = 1.0f);
+
+  // Accumulates the current PWM values of all channels, before interpolation,
+  // into `meter` for energy accounting, see tactile/energy_meter.h. Call once
+  // per update, after writing the channels. The meter should be initialized
+  // for kNumTotalPwm channels at the PWM update rate of kNumPwmValues frames
+  // per update.
+  void MeterEnergy(EnergyMeter* meter);
+
+  // Queued playback. Rather than updating the playback buffer directly, the
+  // main loop may queue whole frames of all channels, and the sequence end
+  // callback plays the next queued frame with PlayQueuedFrame(). Queueing up to
+  // kQueueDepth frames absorbs main loop jitter without dropouts:
+  //
+  //   // In the main loop, after computing a block of tactile output:
+  //   SleeveTactors.QueueAllChannelsPostProcessed(
+  //       &post_processor, channel_map, tactile_output);
+  //
+  //   // In the sequence end callback, on the module 0 event:
+  //   SleeveTactors.PlayQueuedFrame();
+  //
+  // Like UpdateAllChannelsPostProcessed(), but writes into a new queued frame.
+  // Returns false if the queue is full, in which case nothing is processed.
+  bool QueueAllChannelsPostProcessed(PostProcessor* post_processor,
+                                     const ChannelMap& channel_map,
+                                     const float* data);
+
+  // Copies the next queued frame, if any, into the playback buffer. Returns
+  // false if the queue is empty, in which case the playback buffer is
+  // unchanged. Should be called from the sequence end callback.
+  bool PlayQueuedFrame();
+
+  // Looped playback. A pre-rendered signal, e.g. a cached tactile pattern or a
+  // calibration tone, is played from a caller-provided buffer by the PWM
+  // hardware, which loops the DMA sequence without CPU intervention:
+  //
+  //   static uint16_t loop_buffer[12 * kLoopFrames];
+  //   int num_frames = SleeveTactors.LoadPatternToLoopBuffer(
+  //       &pattern_cache, &post_processor, channel_map, loop_buffer,
+  //       kLoopFrames);
+  //   if (num_frames) {
+  //     SleeveTactors.PlayLooped(loop_buffer, num_frames, 1);
+  //   }
+  //
+  //   // In the sequence end callback:
+  //   if (SleeveTactors.IsLoopedPlaybackActive()) {
+  //     SleeveTactors.StopLoopedPlayback();
+  //   }
+  //
+  // While looping, no PWM interrupts occur, so the MCU may sleep, and
+  // OnSequenceEnd() is called only once when playback ends, with GetEvent() ==
+  // 0. The callback should then call StopLoopedPlayback() to resume normal
+  // playback from the playback buffer, or start another looped playback.
+  //
+  // The buffer is laid out like the playback buffer, with `num_frames` values
+  // per channel: module m's four channels are interleaved starting at
+  // buffer + 4 * num_frames * m, a total of 12 * num_frames values. Samples are
+  // at the tactile rate, repeated like the playback buffer as set by
+  // SetUpsamplingFactor() or, if interpolating, SetInterpolationFactor(), but
+  // without interpolation.
+
+  // Starts playing `num_frames` frames of `buffer` `num_repeats` times, or
+  // repeating until StopLoopedPlayback() if `num_repeats` is 0. The buffer
+  // must stay valid while playing. Sparse updates are reset, so that all
+  // modules run. Returns false if the args are invalid.
+  bool PlayLooped(const uint16_t* buffer, int num_frames, int num_repeats);
+
+  // Stops looped playback, if active, and resumes normal playback.
+  void StopLoopedPlayback();
+
+  // Returns true if looped playback is active or has ended without
+  // StopLoopedPlayback() being called.
+  bool IsLoopedPlaybackActive() const { return looped_; }
+
+  // Renders the pattern playing in `cache` through `post_processor` and
+  // `channel_map` into `buffer`, laid out for PlayLooped(). Returns the number
+  // of frames, or 0 if no cached pattern is playing or it is longer than
+  // `max_frames`, in which case `cache` is unchanged and the pattern may be
+  // played by streaming instead. Otherwise, the pattern is consumed from
+  // `cache`. Channels not written by `channel_map` are silent.
+  int LoadPatternToLoopBuffer(TactilePatternCache* cache,
+                              PostProcessor* post_processor,
+                              const ChannelMap& channel_map, uint16_t* buffer,
+                              int max_frames);
+
+  // Renders a sine tone on `channel` with the other channels silent into
+  // `buffer`, laid out for PlayLooped(), for looping with `num_repeats` = 0.
+  // The tone has a whole number of periods in at most `max_frames` frames, with
+  // frequency rounded accordingly. Returns the number of frames, or 0 if the
+  // args are invalid or a period doesn't fit.
+  int LoadToneToLoopBuffer(int channel, float frequency_hz, float amplitude,
+                           float sample_rate_hz, uint16_t* buffer,
+                           int max_frames);
+
   // Update all 12 channels.
   // The data array is a byte array. The size is 96 bytes.
   // The samples are in interleaved format:
@@ -232,13 +394,43 @@ class Pwm {
   // Internal initialization helper.
   void InitializePwmModule(NRF_PWM_Type* p_reg, uint32_t pins[4]);
 
+  // Sparse update bookkeeping, called before writing `channel`. `constant`
+  // says whether the new samples are all equal to `value`. Returns true if
+  // the write should be skipped. Otherwise, updates the channel's activity and
+  // stops or starts its module accordingly.
+  bool SkipChannelUpdate(int channel, bool constant, uint16_t value);
+  // Marks all channels active and starts any stopped modules.
+  void MarkAllChannelsActive();
+  void StopModule(int module);
+  void StartModule(int module);
+  // Writes the enable pins of the two amplifiers driven by `module`.
+  void WriteModuleAmplifiers(int module, bool enable);
+
+  // Points the DMA sequences of the three modules to consecutive blocks of
+  // `samples_per_module` samples in `buffer`.
+  void SetSequenceBuffers(uint16_t* buffer, int samples_per_module);
+
+  // If interpolation is enabled, interpolates `channel` of pwm_buffer_ into
+  // pwm_interpolated_.
+  void InterpolateChannel(int channel);
+  void InterpolateAllChannels();
+
   // Gets pointer to the start of `channel` in pwm_buffer_.
   uint16_t* GetChannelPointer(int channel) {
-    return pwm_buffer_ +
+    return GetChannelPointer(pwm_buffer_, channel);
+  }
+  // Gets pointer to the start of `channel` in a buffer laid out as pwm_buffer_.
+  static uint16_t* GetChannelPointer(uint16_t* buffer, int channel) {
+    return buffer +
         kSamplesPerModule * (channel / kChannelsPerModule) +
         (channel % kChannelsPerModule);
   }
 
+  // Writes post processed `data` into `buffer`, laid out as pwm_buffer_.
+  static void PostProcessToBuffer(PostProcessor* post_processor,
+                                  const ChannelMap& channel_map,
+                                  const float* data, uint16_t* buffer);
+
   // Playback buffer.
   // In "individual" decoder mode, buffer represents 4 channels:
   // <pin 1 PWM 1>, <pin 2 PWM 1>, <pin 3 PWM 1 >, <pin 4 PWM 1>,
@@ -247,6 +439,36 @@ class Pwm {
   // 4 channels, as easy DMA reads them consecutively.
   // The playback on pin 1 will be <pin 1 PWM 1>, <pin 1 PWM 2>.
   uint16_t pwm_buffer_[kNumModules * kNumPwmValues * kChannelsPerModule];
+
+  // When interpolation is enabled, the DMA plays from this buffer instead,
+  // laid out like pwm_buffer_ with kNumPwmValues * interpolation_factor_
+  // values per channel.
+  uint16_t pwm_interpolated_[kNumModules * kNumPwmValues * kChannelsPerModule *
+                             kMaxInterpolationFactor];
+  PolyphaseInterpolatorFixed interpolator_;
+  int interpolation_factor_ = 1;
+
+  // Queue of frames for queued playback, produced by the main loop and consumed
+  // by the sequence end callback.
+  struct Frame {
+    uint16_t samples[kNumModules * kNumPwmValues * kChannelsPerModule];
+  };
+  SpscRingBuffer<Frame, kQueueDepth> queue_;
+
+  // Sparse update state. For each channel, `constant_count_` is the number of
+  // consecutive updates, up to 2, that were all equal to `constant_value_`.
+  bool sparse_updates_ = false;
+  uint8_t constant_count_[kNumModules * kChannelsPerModule] = {};
+  uint16_t constant_value_[kNumModules * kChannelsPerModule] = {};
+  // Bit m is set if module m is stopped.
+  uint8_t stopped_modules_ = 0;
+  bool amplifiers_enabled_ = false;
+
+  // Sequence REFRESH value for normal playback, as set by Initialize(),
+  // SetUpsamplingFactor(), and SetInterpolationFactor().
+  uint32_t refresh_ = kUpsamplingFactor;
+  // True while in looped playback.
+  bool looped_ = false;
 };
 
 extern Pwm SleeveTactors;
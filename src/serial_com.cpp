@@ -16,13 +16,25 @@
 
 #include <string.h>
 
+#include "cpp/std_shim.h"  // NOLINT(build/include)
 #include "nrf_gpio.h"   // NOLINT(build/include)
+#include "nrf_ppi.h"    // NOLINT(build/include)
+#include "nrf_timer.h"  // NOLINT(build/include)
 #include "nrf_uarte.h"  // NOLINT(build/include)
 
 namespace audio_tactile {
 
 AudioTactileSerialCom SerialCom;
 
+namespace {
+// Resources for COBS framing. TIMER1 counts received bytes and TIMER4 measures
+// RX idle time.
+NRF_TIMER_Type* const kByteCounter = NRF_TIMER1;
+NRF_TIMER_Type* const kIdleTimer = NRF_TIMER4;
+constexpr nrf_ppi_channel_t kPpiByteCount = NRF_PPI_CHANNEL10;
+constexpr nrf_ppi_channel_t kPpiIdleStart = NRF_PPI_CHANNEL11;
+}  // namespace
+
 AudioTactileSerialCom::AudioTactileSerialCom() {}
 
 void AudioTactileSerialCom::InitSleeve(void (*event_fun)()) {
@@ -37,20 +49,110 @@ void AudioTactileSerialCom::InitSlimBoard(void (*event_fun)()) {
   InitInternal(kTxSlimPin, kRxSlimPin, event_fun);
 }
 
+void AudioTactileSerialCom::EnableCobsFraming() {
+  // Stop the receiver and wait for it to flush before reconfiguring.
+  nrf_uarte_shorts_disable(NRF_UARTE0, NRF_UARTE_SHORT_ENDRX_STARTRX);
+  nrf_uarte_event_clear(NRF_UARTE0, NRF_UARTE_EVENT_RXTO);
+  nrf_uarte_task_trigger(NRF_UARTE0, NRF_UARTE_TASK_STOPRX);
+  while (!nrf_uarte_event_check(NRF_UARTE0, NRF_UARTE_EVENT_RXTO)) {}
+  nrf_uarte_event_clear(NRF_UARTE0, NRF_UARTE_EVENT_RXTO);
+  nrf_uarte_event_clear(NRF_UARTE0, NRF_UARTE_EVENT_ENDRX);
+  nrf_uarte_event_clear(NRF_UARTE0, NRF_UARTE_EVENT_RXSTARTED);
+
+  cobs_framing_ = true;
+  rx_processed_ = 0;
+  // The RXSTARTED handler below queues buffer `which_buffer_ready_` next, so
+  // that DMA alternates 0, 1, 0, 1, ...
+  which_buffer_ready_ = 1;
+  cobs_decoder_.Reset();
+
+  // TIMER1 counts RXDRDY events, one per received byte.
+  nrf_timer_mode_set(kByteCounter, NRF_TIMER_MODE_COUNTER);
+  nrf_timer_bit_width_set(kByteCounter, NRF_TIMER_BIT_WIDTH_32);
+  nrf_timer_task_trigger(kByteCounter, NRF_TIMER_TASK_CLEAR);
+  nrf_timer_task_trigger(kByteCounter, NRF_TIMER_TASK_START);
+
+  // TIMER4 restarts from zero on each received byte and stops at the timeout,
+  // so COMPARE0 fires once when the line goes idle.
+  nrf_timer_mode_set(kIdleTimer, NRF_TIMER_MODE_TIMER);
+  nrf_timer_bit_width_set(kIdleTimer, NRF_TIMER_BIT_WIDTH_16);
+  nrf_timer_frequency_set(kIdleTimer, NRF_TIMER_FREQ_1MHz);
+  nrf_timer_cc_write(kIdleTimer, NRF_TIMER_CC_CHANNEL0, kIdleTimeoutUs);
+  nrf_timer_shorts_enable(kIdleTimer, NRF_TIMER_SHORT_COMPARE0_STOP_MASK |
+                                          NRF_TIMER_SHORT_COMPARE0_CLEAR_MASK);
+  nrf_timer_int_enable(kIdleTimer, NRF_TIMER_INT_COMPARE0_MASK);
+  NVIC_ClearPendingIRQ(TIMER4_IRQn);
+  NVIC_SetPriority(TIMER4_IRQn, kUarteIrqPriority);
+  NVIC_EnableIRQ(TIMER4_IRQn);
+
+  const uint32_t rxdrdy =
+      nrf_uarte_event_address_get(NRF_UARTE0, NRF_UARTE_EVENT_RXDRDY);
+  nrf_ppi_channel_endpoint_setup(
+      kPpiByteCount, rxdrdy,
+      nrf_timer_task_address_get(kByteCounter, NRF_TIMER_TASK_COUNT));
+  nrf_ppi_fork_endpoint_setup(
+      kPpiByteCount,
+      nrf_timer_task_address_get(kIdleTimer, NRF_TIMER_TASK_CLEAR));
+  nrf_ppi_channel_endpoint_setup(
+      kPpiIdleStart, rxdrdy,
+      nrf_timer_task_address_get(kIdleTimer, NRF_TIMER_TASK_START));
+  nrf_ppi_channel_enable(kPpiByteCount);
+  nrf_ppi_channel_enable(kPpiIdleStart);
+
+  // Restart the receiver on the DMA buffers. RXSTARTED sets up the other
+  // buffer, and the short restarts into it as soon as one fills.
+  SetRxBuffer(0);
+  nrf_uarte_shorts_enable(NRF_UARTE0, NRF_UARTE_SHORT_ENDRX_STARTRX);
+  nrf_uarte_task_trigger(NRF_UARTE0, NRF_UARTE_TASK_STARTRX);
+}
+
 void AudioTactileSerialCom::Disable() {
   nrf_uarte_disable(NRF_UARTE0);
   NVIC_DisableIRQ(UARTE0_UART0_IRQn);
+  if (cobs_framing_) { NVIC_DisableIRQ(TIMER4_IRQn); }
 }
 
 void AudioTactileSerialCom::Enable() {
   nrf_uarte_enable(NRF_UARTE0);
   NVIC_EnableIRQ(UARTE0_UART0_IRQn);
+  if (cobs_framing_) { NVIC_EnableIRQ(TIMER4_IRQn); }
+}
+
+void AudioTactileSerialCom::SendTxMessage() { SendMessage(&tx_message_); }
+
+void AudioTactileSerialCom::SendMessage(Message* message) {
+  message->SetHeader(MessageRecipient::kSleeve);
+  if (cobs_framing_) {
+    const int size = CobsEncode(message->data(), message->size(), tx_cobs_);
+    tx_cobs_[size] = 0;  // Delimiter.
+    SendRaw({tx_cobs_, size + 1});
+  } else {
+    // To simplify the protocol, always transfer a full buffer.
+    SendRaw({message->data(), Message::kMaxMessageSize});
+  }
+}
+
+void AudioTactileSerialCom::ServiceTxQueue() {
+  if (tx_in_flight_) {
+    if (!__atomic_load_n(&tx_done_, __ATOMIC_ACQUIRE)) { return; }
+    tx_in_flight_ = false;
+    tx_queue_.Complete(MessageSendStatus::kSent);
+  }
+
+  Message* message = tx_queue_.Front();
+  if (message != nullptr) {
+    __atomic_store_n(&tx_done_, false, __ATOMIC_RELAXED);
+    tx_in_flight_ = true;
+    SendMessage(message);
+  }
 }
 
-void AudioTactileSerialCom::SendTxMessage() {
-  tx_message_.SetHeader(MessageRecipient::kSleeve);
-  // To simplify the protocol, always transfer a full buffer.
-  SendRaw({tx_message_.data(), Message::kMaxMessageSize});
+Message& AudioTactileSerialCom::rx_message() {
+  if (cobs_framing_) {
+    memcpy(rx_message_[0].data(), rx_frame_.data(), rx_frame_.size());
+    return rx_message_[0];
+  }
+  return rx_message_[which_buffer_ready_];
 }
 
 void AudioTactileSerialCom::SendRaw(Slice<const uint8_t> buffer) {
@@ -100,16 +202,74 @@ void AudioTactileSerialCom::InitInternal(uint32_t tx_pin, uint32_t rx_pin,
 }
 
 void AudioTactileSerialCom::SetRxBuffer(int i) {
-  nrf_uarte_rx_buffer_set(NRF_UARTE0, rx_message_[i].data(),
-                          Message::kMaxMessageSize);
+  if (cobs_framing_) {
+    nrf_uarte_rx_buffer_set(NRF_UARTE0, rx_dma_[i], kRxDmaSize);
+  } else {
+    nrf_uarte_rx_buffer_set(NRF_UARTE0, rx_message_[i].data(),
+                            Message::kMaxMessageSize);
+  }
 }
 
-// Interrupt handler for the serial port.
+void AudioTactileSerialCom::ProcessCobsBytes() {
+  // Read the number of bytes received so far.
+  nrf_timer_task_trigger(kByteCounter, NRF_TIMER_TASK_CAPTURE0);
+  const uint32_t num_received =
+      nrf_timer_cc_read(kByteCounter, NRF_TIMER_CC_CHANNEL0);
+
+  if (num_received - rx_processed_ > kRxDmaSize) {
+    // The DMA has wrapped around onto unprocessed bytes. Drop them and
+    // resynchronize at the next delimiter.
+    cobs_decoder_.Reset();
+    rx_processed_ = num_received;
+    event_ = SerialEvent::kCommError;
+    event_fun_();
+    return;
+  }
+
+  // Buffers fill completely before DMA moves to the other, so byte index `i` of
+  // the stream is at offset i % kRxDmaSize of buffer (i / kRxDmaSize) % 2.
+  while (rx_processed_ != num_received) {
+    const int offset = rx_processed_ % kRxDmaSize;
+    const int size = std_shim::min<int>(num_received - rx_processed_,
+                                        kRxDmaSize - offset);
+    cobs_decoder_.Feed({rx_dma_[(rx_processed_ / kRxDmaSize) % 2] + offset,
+                        size});
+    rx_processed_ += size;
+
+    while (cobs_decoder_.Next(&rx_frame_)) {
+      const bool is_message = rx_frame_.size() >= Message::kHeaderSize &&
+          rx_frame_.size() == Message::kHeaderSize + rx_frame_[3] &&
+          rx_frame_[0] == Message::kPacketStart;
+      bytes_received_ = rx_frame_.size();
+      event_ = is_message ? SerialEvent::kMessageReceived
+                          : SerialEvent::kCommError;
+      event_fun_();
+    }
+  }
+}
+
+// Interrupt handlers for the serial port.
 extern "C" {
 void UARTE0_UART0_IRQHandler() { SerialCom.IrqHandler(); }
+void TIMER4_IRQHandler() { SerialCom.IdleTimeoutIrqHandler(); }
+}
+
+void AudioTactileSerialCom::IdleTimeoutIrqHandler() {
+  if (nrf_timer_event_check(kIdleTimer, NRF_TIMER_EVENT_COMPARE0)) {
+    nrf_timer_event_clear(kIdleTimer, NRF_TIMER_EVENT_COMPARE0);
+    ProcessCobsBytes();
+  }
 }
 
 void AudioTactileSerialCom::IrqHandler() {
+  // With COBS framing, a full DMA buffer is processed without waiting for the
+  // line to go idle, skipping the fixed-size packet handling below.
+  if (cobs_framing_ &&
+      nrf_uarte_event_check(NRF_UARTE0, NRF_UARTE_EVENT_ENDRX)) {
+    nrf_uarte_event_clear(NRF_UARTE0, NRF_UARTE_EVENT_ENDRX);
+    ProcessCobsBytes();
+  }
+
   // Triggered when new serial data is received into Easy DMA buffer.
   if (nrf_uarte_event_check(NRF_UARTE0, NRF_UARTE_EVENT_ENDRX)) {
     nrf_uarte_event_clear(NRF_UARTE0, NRF_UARTE_EVENT_ENDRX);
@@ -134,6 +294,8 @@ void AudioTactileSerialCom::IrqHandler() {
   // Triggered when data transmission is started.
   if (nrf_uarte_event_check(NRF_UARTE0, NRF_UARTE_EVENT_ENDTX)) {
     nrf_uarte_event_clear(NRF_UARTE0, NRF_UARTE_EVENT_ENDTX);
+    // Let ServiceTxQueue() complete the queued message in flight.
+    __atomic_store_n(&tx_done_, true, __ATOMIC_RELEASE);
   }
 
   // Triggered when there is an error.
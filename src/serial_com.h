@@ -49,11 +49,39 @@
 //       break;
 //   }
 // }
+//
+// COBS framing:
+//
+// For streaming at high rates, EnableCobsFraming() switches to variable-size
+// frames delimited with COBS (see cpp/cobs.h), each holding one message with
+// the header above but without padding. Received bytes stream by EasyDMA into
+// a pair of kRxDmaSize buffers that refill back to back without CPU
+// involvement. TIMER1 counts received bytes through PPI, and TIMER4 detects
+// when the line has been idle for kIdleTimeoutUs, so the CPU is interrupted
+// once per burst of frames rather than per fixed-size packet. Frames are
+// decoded in place in the DMA buffer, and rx_frame() is a view of the frame
+// without copying. With the continuous DMA ring, the sender doesn't need
+// kRequestMoreData flow control as long as the application keeps up.
+//
+// Both ends must use the same framing. TIMER1, TIMER4, and PPI channels 10 and
+// 11 are reserved for this when COBS framing is enabled.
+//
+// Asynchronous sending:
+//
+// SendTxMessage() starts a DMA transfer from tx_message, so tx_message must not
+// be rewritten until the transfer ends. Producers that shouldn't wait, like the
+// audio loop, may instead write messages to tx_queue() and return immediately.
+// The main loop calls ServiceTxQueue(), which sends queued messages one at a
+// time by DMA directly from their queue slots and calls each completion
+// function when its transfer ends. See cpp/message_send_queue.h. Don't mix
+// SendTxMessage() or SendRaw() with a nonempty tx_queue.
 
 #ifndef AUDIO_TO_TACTILE_SRC_SERIAL_PUCK_SLEEVE_H_
 #define AUDIO_TO_TACTILE_SRC_SERIAL_PUCK_SLEEVE_H_
 
+#include "cpp/cobs.h"  // NOLINT(build/include)
 #include "cpp/message.h"  // NOLINT(build/include)
+#include "cpp/message_send_queue.h"  // NOLINT(build/include)
 
 namespace audio_tactile {
 
@@ -75,7 +103,14 @@ class AudioTactileSerialCom {
     kRxSleevePin = 46,      // P1.14
     kTxSleevePin = 47,      // P1.15
     kRxSlimPin = 26,        // P0.04
-    kTxSlimPin = 4          // P0.26
+    kTxSlimPin = 4,         // P0.26
+    // Size of each of the two RX DMA buffers for COBS framing.
+    kRxDmaSize = 256,
+    // Idle time on the RX line after which received bytes are processed. At
+    // 1 Mbaud, this is 5 byte durations.
+    kIdleTimeoutUs = 50,
+    // Number of Message slots in tx_queue.
+    kTxQueueCapacity = 8,
   };
 
   AudioTactileSerialCom();
@@ -91,6 +126,10 @@ class AudioTactileSerialCom {
   // Initializes serial communications for the slim board.
   void InitSlimBoard(void (*event_fun)());
 
+  // Switches to COBS framing with continuous DMA receive, as described above.
+  // Call after one of the Init functions.
+  void EnableCobsFraming();
+
   // Stops the callbacks, disables the serial port.
   void Disable();
 
@@ -108,8 +147,21 @@ class AudioTactileSerialCom {
   // Sends tx_message over serial UART.
   void SendTxMessage();
 
-  // Gets Message that was most recently received.
-  Message& rx_message() { return rx_message_[which_buffer_ready_]; }
+  // Gets the queue of messages to send asynchronously.
+  MessageSendQueue<kTxQueueCapacity>& tx_queue() { return tx_queue_; }
+  // Completes the queued message in flight if its transfer has ended, and
+  // starts sending the next one. Must be called from a single context, e.g. the
+  // main loop.
+  void ServiceTxQueue();
+
+  // Gets Message that was most recently received. With COBS framing, this
+  // copies the message from the frame.
+  Message& rx_message();
+
+  // With COBS framing, gets a view of the most recently received frame in the
+  // DMA buffer without copying. The view is valid only during the event
+  // callback.
+  Slice<const uint8_t> rx_frame() const { return rx_frame_; }
 
   // Sends byte array without any formatting.
   void SendRaw(Slice<const uint8_t> buffer);
@@ -124,17 +176,35 @@ class AudioTactileSerialCom {
   // The callback is only triggered if the header id is correct.
   void IrqHandler();
 
+  // Called on the TIMER4 line idle timeout with COBS framing.
+  void IdleTimeoutIrqHandler();
+
  private:
+  // Starts sending `message` by DMA. The message must stay valid until the
+  // transfer ends.
+  void SendMessage(Message* message);
+
   // Internal initialization helper.
   void InitInternal(uint32_t tx_pin, uint32_t rx_pin, void (*event_fun)());
 
-  // Sets the receiving buffer to rx_message_[i].
+  // Sets the receiving buffer to rx_message_[i], or with COBS framing, to
+  // rx_dma_[i].
   void SetRxBuffer(int i);
 
+  // With COBS framing, decodes bytes received since the last call and calls
+  // the event function for each complete frame.
+  void ProcessCobsBytes();
+
   // UARTE buffers for EasyDMA. RX is double buffered.
   Message rx_message_[2];
   Message tx_message_;
 
+  // Asynchronous send queue. The front message is in flight while
+  // tx_in_flight_ is true. The interrupt handler sets tx_done_ on ENDTX.
+  MessageSendQueue<kTxQueueCapacity> tx_queue_;
+  bool tx_in_flight_ = false;
+  bool tx_done_ = false;
+
   // Callback for the interrupt.
   void (*event_fun_)();
 
@@ -151,6 +221,16 @@ class AudioTactileSerialCom {
   // Serial timeout error counter. If serial data that can't be parsed keeps
   // coming, something is wrong, unless send/getDataRaw() is used.
   int rx_counter_ = 0;
+
+  // COBS framing state.
+  bool cobs_framing_ = false;
+  uint8_t rx_dma_[2][kRxDmaSize];
+  // Total number of bytes processed, compared with the TIMER1 byte count.
+  uint32_t rx_processed_ = 0;
+  CobsStreamDecoder<Message::kMaxMessageSize> cobs_decoder_;
+  Slice<const uint8_t> rx_frame_;
+  // Encoded frame plus delimiter.
+  uint8_t tx_cobs_[CobsMaxEncodedSize(Message::kMaxMessageSize) + 1];
 };
 
 extern AudioTactileSerialCom SerialCom;
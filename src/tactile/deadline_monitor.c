@@ -0,0 +1,75 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "tactile/deadline_monitor.h"
+
+#include <stdio.h>
+
+int /*bool*/ DeadlineMonitorInit(DeadlineMonitor* monitor,
+                                 uint32_t budget_ticks) {
+  if (monitor == NULL) {
+    return 0;
+  } else if (budget_ticks == 0) {
+    fprintf(stderr, "Error: DeadlineMonitor budget_ticks must be positive.\n");
+    return 0;
+  }
+
+  ProfilerEnableTicks();
+  monitor->budget_ticks = budget_ticks;
+  monitor->near_miss_ticks = (uint32_t)(
+      ((uint64_t)budget_ticks * kDeadlineMonitorNearMissPercent) / 100);
+  monitor->start_ticks = 0;
+  DeadlineMonitorReset(monitor);
+  return 1;
+}
+
+void DeadlineMonitorReset(DeadlineMonitor* monitor) {
+  monitor->num_buffers = 0;
+  monitor->num_overruns = 0;
+  monitor->num_near_misses = 0;
+  monitor->sum_ticks = 0;
+  monitor->max_ticks = 0;
+  monitor->last_ticks = 0;
+}
+
+void DeadlineMonitorRecord(DeadlineMonitor* monitor, uint32_t elapsed_ticks) {
+  if (elapsed_ticks > monitor->budget_ticks) {
+    ++monitor->num_overruns;
+  } else if (elapsed_ticks > monitor->near_miss_ticks) {
+    ++monitor->num_near_misses;
+  }
+  if (elapsed_ticks > monitor->max_ticks) {
+    monitor->max_ticks = elapsed_ticks;
+  }
+  monitor->sum_ticks += elapsed_ticks;
+  monitor->last_ticks = elapsed_ticks;
+  ++monitor->num_buffers;
+}
+
+void DeadlineMonitorGetStats(const DeadlineMonitor* monitor,
+                             DeadlineMonitorStats* stats) {
+  stats->num_buffers = monitor->num_buffers;
+  stats->num_overruns = monitor->num_overruns;
+  stats->num_near_misses = monitor->num_near_misses;
+  if (monitor->num_buffers == 0) {
+    stats->mean_load = 0.0f;
+    stats->max_load = 0.0f;
+  } else {
+    const double scale = 1.0 / monitor->budget_ticks;
+    stats->mean_load = (float)(
+        (scale * monitor->sum_ticks) / monitor->num_buffers);
+    stats->max_load = (float)(scale * monitor->max_ticks);
+  }
+}
@@ -0,0 +1,133 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * Real-time deadline monitor for the firmware processing loop.
+ *
+ * Each mic buffer must be processed within the buffer period, otherwise the
+ * next buffer is late and the output glitches. `DeadlineMonitor` timestamps
+ * the start and finish of processing each buffer and counts:
+ *
+ *  - overruns, buffers whose processing took longer than the budget, and
+ *  - near misses, buffers that finished in time but used more than 90% of the
+ *    budget (kDeadlineMonitorNearMissPercent).
+ *
+ * It also tracks the mean and max load, the processing time as a fraction of
+ * the budget, so that CPU headroom can be compared across devices and tuning
+ * settings. Stats accumulate from the last `DeadlineMonitorReset()`, e.g. when
+ * tuning is changed, and may be sent to the app in a kDeadlineStats message
+ * (see cpp/message.h).
+ *
+ * Time is measured in ticks from `ProfilerGetTicks()` (see profiler.h), which
+ * are CPU cycles on nRF52. So for the sleeve with 64-sample buffers at
+ * 15625 Hz on a 64 MHz CPU, the budget is 64 / 15625 * 64e6 = 262144 ticks.
+ *
+ * Example use:
+ *   DeadlineMonitor monitor;
+ *   DeadlineMonitorInit(&monitor, budget_ticks);
+ *
+ *   // Processing loop, once per mic buffer.
+ *   DeadlineMonitorStartBuffer(&monitor);
+ *   Process(...);
+ *   DeadlineMonitorFinishBuffer(&monitor);
+ *
+ *   DeadlineMonitorStats stats;
+ *   DeadlineMonitorGetStats(&monitor, &stats);
+ */
+
+#ifndef AUDIO_TO_TACTILE_SRC_TACTILE_DEADLINE_MONITOR_H_
+#define AUDIO_TO_TACTILE_SRC_TACTILE_DEADLINE_MONITOR_H_
+
+#include <stdint.h>
+
+#include "tactile/profiler.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Buffers taking more than this percentage of the budget are near misses. */
+#define kDeadlineMonitorNearMissPercent 90
+
+/* Deadline stats accumulated since the last reset. */
+typedef struct {
+  /* Number of buffers processed. */
+  uint32_t num_buffers;
+  /* Number of buffers whose processing exceeded the budget. */
+  uint32_t num_overruns;
+  /* Number of buffers within budget but above the near-miss threshold. */
+  uint32_t num_near_misses;
+  /* Mean and max processing time as a fraction of the budget. A load above 1
+   * is an overrun. Both are zero if no buffers have been processed.
+   */
+  float mean_load;
+  float max_load;
+} DeadlineMonitorStats;
+
+typedef struct {
+  /* Processing budget per buffer in ticks. */
+  uint32_t budget_ticks;
+  /* Near-miss threshold in ticks. */
+  uint32_t near_miss_ticks;
+  /* Tick count at the last `DeadlineMonitorStartBuffer()`. */
+  uint32_t start_ticks;
+
+  uint32_t num_buffers;
+  uint32_t num_overruns;
+  uint32_t num_near_misses;
+  uint64_t sum_ticks;
+  uint32_t max_ticks;
+  /* Elapsed ticks of the most recent buffer. */
+  uint32_t last_ticks;
+} DeadlineMonitor;
+
+/* Initializes the monitor with a processing budget of `budget_ticks` ticks per
+ * buffer, typically the buffer period. Returns 1 on success, 0 on failure.
+ */
+int /*bool*/ DeadlineMonitorInit(DeadlineMonitor* monitor,
+                                 uint32_t budget_ticks);
+
+/* Resets all stats. */
+void DeadlineMonitorReset(DeadlineMonitor* monitor);
+
+/* Records that processing one buffer took `elapsed_ticks` ticks. */
+void DeadlineMonitorRecord(DeadlineMonitor* monitor, uint32_t elapsed_ticks);
+
+/* Marks the start of processing a buffer. */
+static void DeadlineMonitorStartBuffer(DeadlineMonitor* monitor) {
+  monitor->start_ticks = ProfilerGetTicks();
+}
+
+/* Marks the finish of processing a buffer, recording the ticks since the
+ * matching `DeadlineMonitorStartBuffer()` call.
+ */
+static void DeadlineMonitorFinishBuffer(DeadlineMonitor* monitor) {
+  DeadlineMonitorRecord(monitor, ProfilerGetTicks() - monitor->start_ticks);
+}
+
+/* Gets the load of the most recent buffer, its processing time as a fraction
+ * of the budget, e.g. for TactileProcessorUpdateLoad().
+ */
+static float DeadlineMonitorLastLoad(const DeadlineMonitor* monitor) {
+  return (float)monitor->last_ticks / monitor->budget_ticks;
+}
+
+/* Gets the stats accumulated since the last reset. */
+void DeadlineMonitorGetStats(const DeadlineMonitor* monitor,
+                             DeadlineMonitorStats* stats);
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif
+#endif /* AUDIO_TO_TACTILE_SRC_TACTILE_DEADLINE_MONITOR_H_ */
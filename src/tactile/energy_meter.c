@@ -0,0 +1,128 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "tactile/energy_meter.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+int /*bool*/ EnergyMeterInit(EnergyMeter* meter, int num_channels,
+                             float sample_rate_hz, uint32_t ticks_per_second) {
+  if (meter == NULL) {
+    return 0;
+  } else if (!(1 <= num_channels && num_channels <= kEnergyMeterMaxChannels)) {
+    fprintf(stderr, "Error: EnergyMeter num_channels must be between 1 and "
+            "%d.\n", kEnergyMeterMaxChannels);
+    return 0;
+  } else if (!(sample_rate_hz >= 1.0f) || ticks_per_second == 0) {
+    fprintf(stderr, "Error: EnergyMeter sample_rate_hz and ticks_per_second "
+            "must be positive.\n");
+    return 0;
+  }
+
+  meter->num_channels = num_channels;
+  meter->frames_per_minute = (uint32_t)(60.0f * sample_rate_hz + 0.5f);
+  meter->ticks_per_minute = (uint64_t)60 * ticks_per_second;
+  meter->power_time_constant_frames =
+      kEnergyMeterPowerTimeConstantS * sample_rate_hz;
+  EnergyMeterReset(meter);
+  return 1;
+}
+
+/* Resets the counters for the current minute. */
+static void ResetCounters(EnergyMeter* meter) {
+  meter->frame_count = 0;
+  memset(meter->drive_sum, 0, sizeof(meter->drive_sum));
+  meter->cpu_ticks = 0;
+}
+
+void EnergyMeterReset(EnergyMeter* meter) {
+  ResetCounters(meter);
+  meter->max_value_squared = 1;
+  meter->num_minutes = 0;
+  meter->last_cpu_active_fraction = 0.0f;
+  memset(meter->last_channel_power, 0, sizeof(meter->last_channel_power));
+  meter->minute_completed = 0;
+  meter->power = 0.0f;
+}
+
+/* Latches the counters of the completed minute as the last stats. */
+static void CompleteMinute(EnergyMeter* meter) {
+  const double scale =
+      1.0 / ((double)meter->max_value_squared * meter->frames_per_minute);
+  int c;
+  for (c = 0; c < meter->num_channels; ++c) {
+    meter->last_channel_power[c] = (float)(scale * meter->drive_sum[c]);
+  }
+  const double cpu_active_fraction =
+      (double)meter->cpu_ticks / meter->ticks_per_minute;
+  meter->last_cpu_active_fraction =
+      (float)(cpu_active_fraction < 1.0 ? cpu_active_fraction : 1.0);
+  ++meter->num_minutes;
+  meter->minute_completed = 1;
+  ResetCounters(meter);
+}
+
+void EnergyMeterAddPwm(EnergyMeter* meter, const uint16_t* const* pwm_channels,
+                       int num_frames, int pwm_stride, int pwm_max_value) {
+  const int num_channels = meter->num_channels;
+  meter->minute_completed = 0;
+  if (num_frames <= 0) { return; }
+  meter->max_value_squared = (uint32_t)pwm_max_value * pwm_max_value;
+
+  uint64_t block_sum = 0;
+  int start = 0;
+  while (start < num_frames) {
+    /* Process up to the end of the current minute. */
+    const uint32_t frames_left =
+        meter->frames_per_minute - meter->frame_count;
+    const int end = (uint32_t)(num_frames - start) < frames_left
+        ? num_frames : start + (int)frames_left;
+    int c;
+    for (c = 0; c < num_channels; ++c) {
+      const uint16_t* src = pwm_channels[c] + start * pwm_stride;
+      uint64_t sum = 0;
+      int i;
+      for (i = start; i < end; ++i, src += pwm_stride) {
+        const int32_t d = 2 * (int32_t)*src - pwm_max_value;
+        const uint32_t magnitude = (uint32_t)(d < 0 ? -d : d);
+        sum += magnitude * magnitude;
+      }
+      meter->drive_sum[c] += sum;
+      block_sum += sum;
+    }
+
+    meter->frame_count += end - start;
+    if (meter->frame_count >= meter->frames_per_minute) {
+      CompleteMinute(meter);
+    }
+    start = end;
+  }
+
+  /* Smooth the mean power of the block with a one-pole filter. */
+  const float block_power =
+      (float)block_sum / ((float)meter->max_value_squared * num_frames);
+  const float coeff =
+      1.0f - (float)exp(-num_frames / meter->power_time_constant_frames);
+  meter->power += coeff * (block_power - meter->power);
+}
+
+void EnergyMeterGetStats(const EnergyMeter* meter, EnergyMeterStats* stats) {
+  stats->num_minutes = meter->num_minutes;
+  stats->cpu_active_fraction = meter->last_cpu_active_fraction;
+  memcpy(stats->channel_power, meter->last_channel_power,
+         sizeof(stats->channel_power));
+}
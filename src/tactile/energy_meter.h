@@ -0,0 +1,159 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * Energy accounting of the tactor drive and CPU.
+ *
+ * PostProcessor limits the summed output power reactively, when
+ * PostProcessorLowBattery() is called, but nothing measures the energy that is
+ * actually spent. `EnergyMeter` integrates, per minute:
+ *
+ *  - the drive energy of each channel, the sum of squared drive levels at the
+ *    PWM stage, where a PWM value v in [0, max_value] has drive level
+ *    x = (2 v - max_value) / max_value in [-1, 1], and
+ *  - the CPU active time, in ticks from ProfilerGetTicks() (see profiler.h),
+ *    e.g. the processing time of each buffer from DeadlineMonitor.
+ *
+ * Minutes are counted in PWM frames, so they follow the output sample rate.
+ * Once a minute completes, its counters are latched as the stats of the last
+ * minute, which may be sent to the app in a kEnergyStats message (see
+ * cpp/message.h) to find which tuning settings and patterns drain the battery.
+ *
+ * The meter also tracks the drive power smoothed over about a second,
+ * sum_c x[c]^2, the same measure that PostProcessor limits by output_limit.
+ * This gives a predictive signal of battery drain before the battery is low.
+ *
+ * Drive levels are accumulated as exact integer sums, so the cost is a few
+ * integer operations per PWM value.
+ *
+ * Example use:
+ *   EnergyMeter meter;
+ *   EnergyMeterInit(&meter, kNumTotalPwm, pwm_sample_rate_hz,
+ *                   SystemCoreClock);
+ *
+ *   // Processing loop, once per buffer. CPU ticks are added first, so that
+ *   // they count toward the same minute as the buffer's PWM values.
+ *   EnergyMeterAddCpuTicks(&meter, monitor.last_ticks);
+ *   EnergyMeterAddPwm(&meter, pwm_channels, kNumPwmValues, pwm_stride,
+ *                     kTopValue);
+ *
+ *   if (EnergyMeterMinuteCompleted(&meter)) {
+ *     EnergyMeterStats stats;
+ *     EnergyMeterGetStats(&meter, &stats);
+ *     message.WriteEnergyStats(stats);
+ *   }
+ */
+
+#ifndef AUDIO_TO_TACTILE_SRC_TACTILE_ENERGY_METER_H_
+#define AUDIO_TO_TACTILE_SRC_TACTILE_ENERGY_METER_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Max supported number of channels. */
+#define kEnergyMeterMaxChannels 24
+/* Time constant in seconds for smoothing the drive power. */
+#define kEnergyMeterPowerTimeConstantS 1.0f
+
+/* Energy stats of the last completed minute. */
+typedef struct {
+  /* Number of minutes completed since the last reset. The other fields are
+   * zero if no minute has completed.
+   */
+  uint32_t num_minutes;
+  /* Fraction of the minute that the CPU was active, in [0, 1]. */
+  float cpu_active_fraction;
+  /* Mean drive power of each channel, the mean of x^2 over the minute, in
+   * [0, 1], where 1 is full-scale drive for the whole minute. Channels beyond
+   * `num_channels` are zero.
+   */
+  float channel_power[kEnergyMeterMaxChannels];
+} EnergyMeterStats;
+
+typedef struct {
+  int num_channels;
+  /* Number of PWM frames in one minute. */
+  uint32_t frames_per_minute;
+  /* CPU ticks in one minute. */
+  uint64_t ticks_per_minute;
+  /* Time constant in PWM frames for smoothing `power`. */
+  float power_time_constant_frames;
+
+  /* Counters for the current minute. `drive_sum[c]` is the sum of
+   * (2 v - max_value)^2 over PWM values v of channel c.
+   */
+  uint32_t frame_count;
+  uint64_t drive_sum[kEnergyMeterMaxChannels];
+  uint64_t cpu_ticks;
+  /* Squared max_value of the most recent PWM values, for normalization. */
+  uint32_t max_value_squared;
+
+  /* Stats of the last completed minute. */
+  uint32_t num_minutes;
+  float last_cpu_active_fraction;
+  float last_channel_power[kEnergyMeterMaxChannels];
+  /* Whether a minute completed in the last EnergyMeterAddPwm() call. */
+  int /*bool*/ minute_completed;
+
+  /* Smoothed drive power sum_c x[c]^2. */
+  float power;
+} EnergyMeter;
+
+/* Initializes the meter for `num_channels` channels of PWM values at
+ * `sample_rate_hz` frames per second, with CPU time in ticks at
+ * `ticks_per_second`. Returns 1 on success, 0 on failure.
+ */
+int /*bool*/ EnergyMeterInit(EnergyMeter* meter, int num_channels,
+                             float sample_rate_hz, uint32_t ticks_per_second);
+
+/* Resets all counters and stats. */
+void EnergyMeterReset(EnergyMeter* meter);
+
+/* Accumulates `num_frames` frames of PWM values, where frame i of channel c is
+ * `pwm_channels[c][i * pwm_stride]`, in [0, pwm_max_value]. The layout is the
+ * same as for PostProcessorProcessSamplesToPwm(), so the sleeve can meter its
+ * PWM buffers directly. Advances the minute counter by `num_frames`.
+ */
+void EnergyMeterAddPwm(EnergyMeter* meter, const uint16_t* const* pwm_channels,
+                       int num_frames, int pwm_stride, int pwm_max_value);
+
+/* Adds `ticks` of CPU active time to the current minute. */
+static void EnergyMeterAddCpuTicks(EnergyMeter* meter, uint32_t ticks) {
+  meter->cpu_ticks += ticks;
+}
+
+/* Returns 1 if a minute completed in the last EnergyMeterAddPwm() call, so
+ * that new stats are available.
+ */
+static int /*bool*/ EnergyMeterMinuteCompleted(const EnergyMeter* meter) {
+  return meter->minute_completed;
+}
+
+/* Gets the drive power sum_c x[c]^2 smoothed over about
+ * kEnergyMeterPowerTimeConstantS seconds.
+ */
+static float EnergyMeterPower(const EnergyMeter* meter) {
+  return meter->power;
+}
+
+/* Gets the stats of the last completed minute. */
+void EnergyMeterGetStats(const EnergyMeter* meter, EnergyMeterStats* stats);
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif
+#endif /* AUDIO_TO_TACTILE_SRC_TACTILE_ENERGY_METER_H_ */
@@ -0,0 +1,240 @@
+/* Copyright 2021 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "tactile/envelope_events.h"
+
+#include <stdio.h>
+
+void EnvelopeEventEncoderSetDefaultParams(EnvelopeEventEncoderParams* params) {
+  params->min_change = 0.01f;
+  params->relative_change = 0.12f;
+  params->max_interval = kEnvelopeEventsMaxInterval;
+}
+
+int /*bool*/ EnvelopeEventEncoderInit(EnvelopeEventEncoder* encoder,
+                                      const EnvelopeEventEncoderParams* params,
+                                      int num_channels) {
+  if (encoder == NULL || params == NULL) {
+    return 0;
+  } else if (!(1 <= num_channels &&
+               num_channels <= kEnvelopeEventsMaxChannels)) {
+    fprintf(stderr, "Error: num_channels must be between 1 and %d.\n",
+            kEnvelopeEventsMaxChannels);
+    return 0;
+  } else if (!(1 <= params->max_interval &&
+               params->max_interval <= kEnvelopeEventsMaxInterval)) {
+    fprintf(stderr, "Error: max_interval must be between 1 and %d.\n",
+            kEnvelopeEventsMaxInterval);
+    return 0;
+  } else if (!(params->min_change > 0.0f && params->relative_change >= 0.0f)) {
+    fprintf(stderr, "Error: min_change must be positive and relative_change "
+            "must be nonnegative.\n");
+    return 0;
+  }
+
+  encoder->num_channels = num_channels;
+  encoder->min_change = params->min_change;
+  encoder->relative_change = params->relative_change;
+  encoder->max_interval = params->max_interval;
+  EnvelopeEventEncoderReset(encoder);
+  return 1;
+}
+
+void EnvelopeEventEncoderReset(EnvelopeEventEncoder* encoder) {
+  int c;
+  for (c = 0; c < encoder->num_channels; ++c) {
+    EnvelopeEventChannel* channel = &encoder->channels[c];
+    channel->keyframe_age = 0;
+    channel->keyframe_value = 0.0f;
+    channel->min_slope = 0.0f;
+    channel->max_slope = 0.0f;
+    channel->prev_value = 0.0f;
+  }
+}
+
+/* Quantizes amplitude `value` in [0, 1] to 8 bits. */
+static uint8_t QuantizeAmplitude(float value) {
+  return (uint8_t)(255.0f * value + 0.5f);
+}
+
+/* Writes an event for channel `c` with a keyframe `duration` frames after the
+ * channel's previous keyframe, and makes it the new keyframe. The keyframe is
+ * the point closest to the previous frame on a line within the door of slopes,
+ * so that interpolation is within the tolerance for all frames since the
+ * previous keyframe.
+ */
+static uint8_t* WriteKeyframe(EnvelopeEventChannel* channel, int c,
+                              int duration, uint8_t* dest) {
+  float slope = (channel->prev_value - channel->keyframe_value) / duration;
+  if (slope < channel->min_slope) { slope = channel->min_slope; }
+  if (slope > channel->max_slope) { slope = channel->max_slope; }
+  float value = channel->keyframe_value + slope * duration;
+  if (value < 0.0f) { value = 0.0f; }
+  if (value > 1.0f) { value = 1.0f; }
+
+  const uint8_t code = QuantizeAmplitude(value);
+  dest[0] = (uint8_t)(c | (duration - 1) << 4);
+  dest[1] = code;
+  channel->keyframe_value = code / 255.0f;
+  return dest + kEnvelopeEventBytes;
+}
+
+int EnvelopeEventEncoderProcessFrames(EnvelopeEventEncoder* encoder,
+                                      const float* input, int num_frames,
+                                      uint8_t* events) {
+  const int num_channels = encoder->num_channels;
+  uint8_t* dest = events;
+  int n;
+  for (n = 0; n < num_frames; ++n, input += num_channels) {
+    int c;
+    for (c = 0; c < num_channels; ++c) {
+      EnvelopeEventChannel* channel = &encoder->channels[c];
+      float value = input[c];
+      if (!(value >= 0.0f)) { value = 0.0f; }  /* Also clamps NaN to zero. */
+      if (value > 1.0f) { value = 1.0f; }
+      /* Range of amplitudes within the tolerance of `value`, limited to
+       * [0, 1] so that keyframes on the interpolating line are in range.
+       */
+      const float tolerance =
+          encoder->min_change + encoder->relative_change * value;
+      const float low = (value > tolerance) ? value - tolerance : 0.0f;
+      const float high = (value + tolerance < 1.0f) ? value + tolerance : 1.0f;
+      int age = channel->keyframe_age + 1;
+
+      if (age > 1) {
+        /* Narrow the "door" of slopes from the keyframe passing within the
+         * tolerance of all frames so far. If it closes, or the keyframe is too
+         * old, the previous frame becomes a keyframe.
+         */
+        float min_slope = (low - channel->keyframe_value) / age;
+        float max_slope = (high - channel->keyframe_value) / age;
+        if (min_slope < channel->min_slope) { min_slope = channel->min_slope; }
+        if (max_slope > channel->max_slope) { max_slope = channel->max_slope; }
+
+        if (min_slope > max_slope || age > encoder->max_interval) {
+          /* The door in `channel` is still for the frames before this one. */
+          dest = WriteKeyframe(channel, c, age - 1, dest);
+          age = 1;
+        } else {
+          channel->min_slope = min_slope;
+          channel->max_slope = max_slope;
+        }
+      }
+
+      if (age == 1) {  /* First frame after a keyframe. */
+        channel->min_slope = low - channel->keyframe_value;
+        channel->max_slope = high - channel->keyframe_value;
+      }
+      channel->keyframe_age = age;
+      channel->prev_value = value;
+    }
+  }
+  return (int)(dest - events) / kEnvelopeEventBytes;
+}
+
+int EnvelopeEventEncoderFlush(EnvelopeEventEncoder* encoder, uint8_t* events) {
+  uint8_t* dest = events;
+  int c;
+  for (c = 0; c < encoder->num_channels; ++c) {
+    EnvelopeEventChannel* channel = &encoder->channels[c];
+    if (channel->keyframe_age > 0) {
+      dest = WriteKeyframe(channel, c, channel->keyframe_age, dest);
+      channel->keyframe_age = 0;
+    }
+  }
+  return (int)(dest - events) / kEnvelopeEventBytes;
+}
+
+int /*bool*/ EnvelopeEventDecoderInit(EnvelopeEventDecoder* decoder,
+                                      int num_channels) {
+  if (decoder == NULL) {
+    return 0;
+  } else if (!(1 <= num_channels &&
+               num_channels <= kEnvelopeEventsMaxChannels)) {
+    fprintf(stderr, "Error: num_channels must be between 1 and %d.\n",
+            kEnvelopeEventsMaxChannels);
+    return 0;
+  }
+  decoder->num_channels = num_channels;
+  EnvelopeEventDecoderReset(decoder);
+  return 1;
+}
+
+void EnvelopeEventDecoderReset(EnvelopeEventDecoder* decoder) {
+  int c;
+  for (c = 0; c < decoder->num_channels; ++c) {
+    decoder->keyframe_value[c] = 0.0f;
+    decoder->keyframe_count[c] = 0;
+  }
+  decoder->num_read = 0;
+}
+
+int EnvelopeEventDecoderProcessEvents(EnvelopeEventDecoder* decoder,
+                                      const uint8_t* events, int num_events) {
+  int i;
+  for (i = 0; i < num_events; ++i, events += kEnvelopeEventBytes) {
+    const int c = events[0] & 15;
+    const int duration = (events[0] >> 4) + 1;
+    if (c >= decoder->num_channels) { return -1; }
+
+    const uint32_t count = decoder->keyframe_count[c];
+    if (count + duration - decoder->num_read >
+        kEnvelopeEventDecoderBufferFrames) {
+      break;  /* Buffer is full. */
+    }
+
+    /* Interpolate frames from the previous keyframe to this one. */
+    const float start = decoder->keyframe_value[c];
+    const float end = events[1] / 255.0f;
+    const float step = (end - start) / duration;
+    int k;
+    for (k = 1; k < duration; ++k) {
+      decoder->frames[(count + k - 1) % kEnvelopeEventDecoderBufferFrames][c] =
+          start + step * k;
+    }
+    decoder->frames[(count + duration - 1) %
+                    kEnvelopeEventDecoderBufferFrames][c] = end;
+
+    decoder->keyframe_value[c] = end;
+    decoder->keyframe_count[c] = count + duration;
+  }
+  return i;
+}
+
+int EnvelopeEventDecoderReadFrames(EnvelopeEventDecoder* decoder,
+                                   float* output, int max_frames) {
+  const int num_channels = decoder->num_channels;
+  /* Frames are ready up to the channel with the oldest keyframe. */
+  uint32_t num_ready = decoder->keyframe_count[0];
+  int c;
+  for (c = 1; c < num_channels; ++c) {
+    if (decoder->keyframe_count[c] < num_ready) {
+      num_ready = decoder->keyframe_count[c];
+    }
+  }
+  num_ready -= decoder->num_read;
+
+  const int num_frames =
+      ((uint32_t)max_frames < num_ready) ? max_frames : (int)num_ready;
+  int n;
+  for (n = 0; n < num_frames; ++n, output += num_channels) {
+    const float* frame = decoder->frames[decoder->num_read++ %
+                                         kEnvelopeEventDecoderBufferFrames];
+    for (c = 0; c < num_channels; ++c) {
+      output[c] = frame[c];
+    }
+  }
+  return num_frames;
+}
@@ -0,0 +1,193 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * Sparse event-stream coding of multichannel tactile amplitudes.
+ *
+ * When the phone runs the audio-to-tactile processing and streams to the
+ * sleeve, most frames of the per-channel amplitudes, e.g. Enveloper outputs,
+ * are near zero or slowly varying. Rather than sending every frame, the
+ * encoder sends sparse per-channel keyframes, and the decoder reconstructs the
+ * frames between keyframes by linear interpolation.
+ *
+ * Keyframes are chosen per channel with the "swinging door" algorithm: a new
+ * keyframe is made only when a straight line from the previous keyframe can no
+ * longer pass within the tolerance of every frame since. The tolerance for an
+ * amplitude `x` is `min_change + relative_change * x`, where the relative term
+ * follows the roughly constant relative just-noticeable difference of
+ * vibrotactile amplitude. So the reconstruction is within the tolerance of the
+ * input, plus the 8-bit quantization error. A keyframe is also forced at least
+ * every `max_interval` frames, which bounds the latency: a frame is decoded
+ * once every channel has a keyframe at or after it, at most `max_interval`
+ * frames after it was encoded.
+ *
+ * Amplitudes are in [0, 1], and values outside are clamped. Each event is 2
+ * bytes:
+ *
+ *   byte 0: low nibble = channel, high nibble = duration - 1, where duration
+ *           in [1, 16] is the number of frames since the channel's previous
+ *           keyframe.
+ *   byte 1: keyframe amplitude, quantized as round(255 * x).
+ *
+ * Both sides start with an implicit keyframe of zero amplitude. Events must be
+ * delivered in order and without loss, e.g. in kEnvelopeEvents messages over
+ * BLE (see cpp/message.h).
+ *
+ * Example use:
+ *   // Phone side.
+ *   EnvelopeEventEncoder encoder;
+ *   EnvelopeEventEncoderInit(&encoder, &params, num_channels);
+ *   uint8_t events[2 * kMaxFrames * kMaxChannels];
+ *   int num_events = EnvelopeEventEncoderProcessFrames(
+ *       &encoder, amplitudes, num_frames, events);
+ *   // Send 2 * num_events bytes of `events`.
+ *
+ *   // Sleeve side.
+ *   EnvelopeEventDecoder decoder;
+ *   EnvelopeEventDecoderInit(&decoder, num_channels);
+ *   while (num_events > 0) {
+ *     const int num_decoded =
+ *         EnvelopeEventDecoderProcessEvents(&decoder, events, num_events);
+ *     if (num_decoded < 0) { ... }  // Invalid events.
+ *     events += kEnvelopeEventBytes * num_decoded;
+ *     num_events -= num_decoded;
+ *
+ *     float frames[kEnvelopeEventDecoderBufferFrames * kMaxChannels];
+ *     int num_frames = EnvelopeEventDecoderReadFrames(
+ *         &decoder, frames, kEnvelopeEventDecoderBufferFrames);
+ *     // Play `num_frames` frames.
+ *   }
+ */
+
+#ifndef AUDIO_TO_TACTILE_SRC_TACTILE_ENVELOPE_EVENTS_H_
+#define AUDIO_TO_TACTILE_SRC_TACTILE_ENVELOPE_EVENTS_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Max number of channels. */
+#define kEnvelopeEventsMaxChannels 16
+/* Max number of frames between keyframes of a channel. */
+#define kEnvelopeEventsMaxInterval 16
+/* Bytes per encoded event. */
+#define kEnvelopeEventBytes 2
+
+typedef struct {
+  /* Absolute tolerance on the reconstructed amplitude. */
+  float min_change;
+  /* Tolerance relative to the amplitude. */
+  float relative_change;
+  /* Max number of frames between keyframes, in [1, 16]. */
+  int max_interval;
+} EnvelopeEventEncoderParams;
+
+typedef struct {
+  /* Frame index of the previous keyframe, relative to the current frame. */
+  int keyframe_age;
+  /* Quantized amplitude of the previous keyframe. */
+  float keyframe_value;
+  /* Range of slopes from the keyframe that pass within the tolerance of all
+   * frames since it.
+   */
+  float min_slope;
+  float max_slope;
+  /* Amplitude of the previous frame. */
+  float prev_value;
+} EnvelopeEventChannel;
+
+typedef struct {
+  EnvelopeEventChannel channels[kEnvelopeEventsMaxChannels];
+  int num_channels;
+  float min_change;
+  float relative_change;
+  int max_interval;
+} EnvelopeEventEncoder;
+
+/* Sets default params: tolerance of 0.01 + 12% (about 1 dB), and keyframes at
+ * least every 16 frames.
+ */
+void EnvelopeEventEncoderSetDefaultParams(EnvelopeEventEncoderParams* params);
+
+/* Initializes the encoder for `num_channels` channels, at most
+ * kEnvelopeEventsMaxChannels. Returns 1 on success, 0 on failure.
+ */
+int /*bool*/ EnvelopeEventEncoderInit(EnvelopeEventEncoder* encoder,
+                                      const EnvelopeEventEncoderParams* params,
+                                      int num_channels);
+
+/* Resets to the initial state, with zero amplitude on all channels. */
+void EnvelopeEventEncoderReset(EnvelopeEventEncoder* encoder);
+
+/* Encodes `num_frames` frames of `input`, with `num_channels` amplitudes per
+ * frame interleaved. Writes events to `events`, which must have space for
+ * kEnvelopeEventBytes * num_frames * num_channels bytes in the worst case, and
+ * returns the number of events written.
+ */
+int EnvelopeEventEncoderProcessFrames(EnvelopeEventEncoder* encoder,
+                                      const float* input, int num_frames,
+                                      uint8_t* events);
+
+/* Ends the stream, writing a keyframe for the last frame of each channel that
+ * doesn't already have one, so that the decoder can decode all frames. Writes
+ * up to num_channels events and returns the number of events written.
+ */
+int EnvelopeEventEncoderFlush(EnvelopeEventEncoder* encoder, uint8_t* events);
+
+/* Number of frames buffered by the decoder, enough for the channels to be
+ * kEnvelopeEventsMaxInterval frames apart.
+ */
+#define kEnvelopeEventDecoderBufferFrames (2 * kEnvelopeEventsMaxInterval)
+
+typedef struct {
+  /* Ring buffer of decoded frames. */
+  float frames[kEnvelopeEventDecoderBufferFrames][kEnvelopeEventsMaxChannels];
+  /* Amplitude of each channel's latest keyframe. */
+  float keyframe_value[kEnvelopeEventsMaxChannels];
+  /* Frame count up to each channel's latest keyframe. */
+  uint32_t keyframe_count[kEnvelopeEventsMaxChannels];
+  /* Number of frames read so far. */
+  uint32_t num_read;
+  int num_channels;
+} EnvelopeEventDecoder;
+
+/* Initializes the decoder for `num_channels` channels. Returns 1 on success, 0
+ * on failure.
+ */
+int /*bool*/ EnvelopeEventDecoderInit(EnvelopeEventDecoder* decoder,
+                                      int num_channels);
+
+/* Resets to the initial state, with zero amplitude on all channels. */
+void EnvelopeEventDecoderReset(EnvelopeEventDecoder* decoder);
+
+/* Decodes events until all `num_events` are decoded or the frame buffer is
+ * full. Returns the number of events decoded. If it is less than `num_events`,
+ * frames should be read with EnvelopeEventDecoderReadFrames() before decoding
+ * the rest. Returns -1 if an event is invalid.
+ */
+int EnvelopeEventDecoderProcessEvents(EnvelopeEventDecoder* decoder,
+                                      const uint8_t* events, int num_events);
+
+/* Reads up to `max_frames` decoded frames to `output`, with num_channels
+ * amplitudes per frame interleaved. Returns the number of frames read.
+ */
+int EnvelopeEventDecoderReadFrames(EnvelopeEventDecoder* decoder,
+                                   float* output, int max_frames);
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif
+#endif /* AUDIO_TO_TACTILE_SRC_TACTILE_ENVELOPE_EVENTS_H_ */
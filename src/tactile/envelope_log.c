@@ -0,0 +1,201 @@
+/* Copyright 2021 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "tactile/envelope_log.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "dsp/serialize.h"
+
+/* Magic number at the start of each page, "ETL1" in little endian. */
+#define kPageMagic UINT32_C(0x314c5445)
+
+/* Gets the flash address of entry `entry` in page `page`. */
+static uint32_t EntryAddress(const EnvelopeLog* log, int page, int entry) {
+  return log->base_address + (uint32_t)page * log->page_size +
+         kEnvelopeLogPageHeaderBytes + (uint32_t)entry * kEnvelopeLogEntryBytes;
+}
+
+/* Gets the page after `page` in the ring. */
+static int NextPage(const EnvelopeLog* log, int page) {
+  return (page + 1 == log->num_pages) ? 0 : page + 1;
+}
+
+/* Reads the header of `page`. Returns 1 and sets `*sequence` if valid. */
+static int /*bool*/ ReadPageHeader(const EnvelopeLog* log, int page,
+                                   uint32_t* sequence) {
+  uint8_t header[kEnvelopeLogPageHeaderBytes];
+  log->flash.read(log->flash.user_data,
+                  log->base_address + (uint32_t)page * log->page_size,
+                  header, kEnvelopeLogPageHeaderBytes);
+  if (LittleEndianReadU32(header) != kPageMagic) { return 0; }
+  *sequence = LittleEndianReadU32(header + 4);
+  return 1;
+}
+
+/* Erases `page` and writes its header with `sequence`, making it the head. */
+static int /*bool*/ StartPage(EnvelopeLog* log, int page, uint32_t sequence) {
+  const uint32_t address = log->base_address + (uint32_t)page * log->page_size;
+  uint8_t header[kEnvelopeLogPageHeaderBytes];
+  LittleEndianWriteU32(kPageMagic, header);
+  LittleEndianWriteU32(sequence, header + 4);
+  log->head_page = page;
+  log->head_entry = 0;
+  log->head_sequence = sequence;
+  return log->flash.erase_page(log->flash.user_data, address) &&
+         log->flash.write(log->flash.user_data, address, header,
+                          kEnvelopeLogPageHeaderBytes);
+}
+
+/* Returns 1 if all `size` bytes of `bytes` are in the erased state. */
+static int /*bool*/ IsErased(const uint8_t* bytes, int size) {
+  int i;
+  for (i = 0; i < size; ++i) {
+    if (bytes[i] != 0xff) { return 0; }
+  }
+  return 1;
+}
+
+int /*bool*/ EnvelopeLogInit(EnvelopeLog* log, const EnvelopeLogFlash* flash,
+                             uint32_t base_address, int page_size,
+                             int num_pages) {
+  if (log == NULL || flash == NULL || flash->read == NULL ||
+      flash->write == NULL || flash->erase_page == NULL) {
+    return 0;
+  } else if (page_size < kEnvelopeLogPageHeaderBytes + kEnvelopeLogEntryBytes) {
+    fprintf(stderr, "Error: page_size must be at least %d.\n",
+            kEnvelopeLogPageHeaderBytes + kEnvelopeLogEntryBytes);
+    return 0;
+  } else if (num_pages < 1) {
+    fprintf(stderr, "Error: num_pages must be positive.\n");
+    return 0;
+  }
+
+  log->flash = *flash;
+  log->base_address = base_address;
+  log->page_size = page_size;
+  log->num_pages = num_pages;
+  log->entries_per_page =
+      (page_size - kEnvelopeLogPageHeaderBytes) / kEnvelopeLogEntryBytes;
+
+  /* Find the valid page with the newest sequence number. Comparison is by
+   * signed difference so that sequence numbers may wrap around.
+   */
+  int head_page = -1;
+  uint32_t head_sequence = 0;
+  int page;
+  for (page = 0; page < num_pages; ++page) {
+    uint32_t sequence;
+    if (ReadPageHeader(log, page, &sequence) &&
+        (head_page == -1 || (int32_t)(sequence - head_sequence) > 0)) {
+      head_page = page;
+      head_sequence = sequence;
+    }
+  }
+
+  if (head_page == -1) { /* No valid pages, start an empty log. */
+    return StartPage(log, 0, 0);
+  }
+
+  log->head_page = head_page;
+  log->head_sequence = head_sequence;
+  /* The head entry is after the last entry that isn't erased. An entry that
+   * was partially written before a power loss is also skipped.
+   */
+  log->head_entry = log->entries_per_page;
+  while (log->head_entry > 0) {
+    uint8_t bytes[kEnvelopeLogEntryBytes];
+    log->flash.read(log->flash.user_data,
+                    EntryAddress(log, head_page, log->head_entry - 1),
+                    bytes, kEnvelopeLogEntryBytes);
+    if (!IsErased(bytes, kEnvelopeLogEntryBytes)) { break; }
+    --log->head_entry;
+  }
+  return 1;
+}
+
+int /*bool*/ EnvelopeLogClear(EnvelopeLog* log) {
+  int success = 1;
+  int page;
+  for (page = 1; page < log->num_pages; ++page) {
+    success &= log->flash.erase_page(
+        log->flash.user_data,
+        log->base_address + (uint32_t)page * log->page_size);
+  }
+  /* Restart at page 0. Pages 1 and up are erased, so page 0 is the newest. */
+  return StartPage(log, 0, log->head_sequence + 1) && success;
+}
+
+int /*bool*/ EnvelopeLogAppend(EnvelopeLog* log, uint32_t timestamp,
+                               const uint8_t* record) {
+  if (timestamp == kEnvelopeLogInvalidTimestamp) { return 0; }
+  if (log->head_entry == log->entries_per_page) {
+    /* Head page is full. Erase the oldest page, the next in the ring. */
+    if (!StartPage(log, NextPage(log, log->head_page),
+                   log->head_sequence + 1)) {
+      return 0;
+    }
+  }
+
+  uint8_t bytes[kEnvelopeLogEntryBytes];
+  LittleEndianWriteU32(timestamp, bytes);
+  memcpy(bytes + 4, record, kEnvelopeTrackerRecordBytes);
+  const uint32_t address = EntryAddress(log, log->head_page, log->head_entry);
+  /* Advance even if the write fails, since the entry may be partly written. */
+  ++log->head_entry;
+  return log->flash.write(log->flash.user_data, address, bytes,
+                          kEnvelopeLogEntryBytes);
+}
+
+void EnvelopeLogReadBegin(const EnvelopeLog* log, EnvelopeLogCursor* cursor) {
+  /* The oldest page is the one after the head page in the ring. */
+  cursor->page = NextPage(log, log->head_page);
+  cursor->entry = 0;
+}
+
+int /*bool*/ EnvelopeLogReadNext(const EnvelopeLog* log,
+                                 EnvelopeLogCursor* cursor,
+                                 EnvelopeLogEntry* entry) {
+  for (;;) {
+    const int is_head = (cursor->page == log->head_page);
+    const int num_entries = is_head ? log->head_entry : log->entries_per_page;
+    uint32_t sequence;
+
+    if (cursor->entry == 0 && !is_head &&
+        !ReadPageHeader(log, cursor->page, &sequence)) {
+      /* Page was never written, skip it. */
+      cursor->entry = num_entries;
+    }
+
+    if (cursor->entry < num_entries) {
+      uint8_t bytes[kEnvelopeLogEntryBytes];
+      log->flash.read(log->flash.user_data,
+                      EntryAddress(log, cursor->page, cursor->entry),
+                      bytes, kEnvelopeLogEntryBytes);
+      ++cursor->entry;
+      entry->timestamp = LittleEndianReadU32(bytes);
+      /* Skip entries that were left erased or partially written. */
+      if (entry->timestamp == kEnvelopeLogInvalidTimestamp) { continue; }
+      memcpy(entry->record, bytes + 4, kEnvelopeTrackerRecordBytes);
+      return 1;
+    } else if (is_head) {
+      return 0;  /* Reached the end of the log. */
+    }
+
+    cursor->page = NextPage(log, cursor->page);
+    cursor->entry = 0;
+  }
+}
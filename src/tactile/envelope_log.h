@@ -0,0 +1,165 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * Wear-leveled flash ring log of EnvelopeTracker records.
+ *
+ * EnvelopeTracker records (see envelope_tracker.h) are normally sent to the
+ * app in kStatsRecord messages, so history is lost while no phone is
+ * connected. `EnvelopeLog` appends timestamped records to a region of flash
+ * instead, to be downloaded later in bulk with kEnvelopeLogEntries messages
+ * (see cpp/message.h) without keeping the BLE link active.
+ *
+ * The region is `num_pages` erasable pages, written as a ring. Each page starts
+ * with an 8-byte header of a magic number and a sequence number, followed by
+ * entries of kEnvelopeLogEntryBytes (= 17) bytes:
+ *
+ *   [timestamp: uint32 little endian][record: kEnvelopeTrackerRecordBytes]
+ *
+ * Entries are appended to the newest page. When it is full, the oldest page is
+ * erased and becomes the newest, with the sequence number incremented. So all
+ * pages are erased equally often, and each page is erased once per lap of the
+ * ring. Pages are never rewritten in place, and on Init() the newest page and
+ * first free entry are found by scanning, so the log survives power loss.
+ * Unlike a FAT file appended one record at a time, there is no metadata to
+ * rewrite per append.
+ *
+ * For example with 4 KB pages, a page holds 240 entries, about 4 minutes of
+ * records, and 1 MB of flash holds about 17 hours. The oldest page is lost
+ * when the ring wraps.
+ *
+ * Flash access is through callbacks, so that this library is hardware agnostic
+ * and testable on the host. The write callback is only called on erased bytes.
+ *
+ * Example use:
+ *   EnvelopeLog log;
+ *   EnvelopeLogInit(&log, &flash, base_address, page_size, num_pages);
+ *
+ *   // When EnvelopeTrackerProcessSamples() returns 1.
+ *   uint8_t record[kEnvelopeTrackerRecordBytes];
+ *   EnvelopeTrackerGetRecord(&tracker, record);
+ *   EnvelopeLogAppend(&log, timestamp, record);
+ *
+ *   // Reading all entries, oldest first.
+ *   EnvelopeLogCursor cursor;
+ *   EnvelopeLogReadBegin(&log, &cursor);
+ *   EnvelopeLogEntry entry;
+ *   while (EnvelopeLogReadNext(&log, &cursor, &entry)) {
+ *     // Use entry.timestamp and entry.record.
+ *   }
+ */
+
+#ifndef AUDIO_TO_TACTILE_SRC_TACTILE_ENVELOPE_LOG_H_
+#define AUDIO_TO_TACTILE_SRC_TACTILE_ENVELOPE_LOG_H_
+
+#include <stdint.h>
+
+#include "tactile/envelope_tracker.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Bytes in a page header: 4-byte magic number and 4-byte sequence number. */
+#define kEnvelopeLogPageHeaderBytes 8
+/* Bytes in a log entry: 4-byte timestamp followed by the record. */
+#define kEnvelopeLogEntryBytes (4 + kEnvelopeTrackerRecordBytes)
+/* Timestamp value reserved to mark erased entries. */
+#define kEnvelopeLogInvalidTimestamp UINT32_C(0xffffffff)
+
+/* Callbacks for accessing flash. Addresses are absolute, as passed to Init. */
+typedef struct {
+  /* Reads `size` bytes at `address` into `dest`. */
+  void (*read)(void* user_data, uint32_t address, uint8_t* dest, int size);
+  /* Programs `size` bytes at `address`, which are in the erased state. Returns
+   * 1 on success, 0 on failure.
+   */
+  int /*bool*/ (*write)(void* user_data, uint32_t address,
+                        const uint8_t* src, int size);
+  /* Erases the page at `address` to all 0xff bytes. Returns 1 on success, 0 on
+   * failure.
+   */
+  int /*bool*/ (*erase_page)(void* user_data, uint32_t address);
+  /* Pointer passed to the callbacks. */
+  void* user_data;
+} EnvelopeLogFlash;
+
+/* A timestamped record. */
+typedef struct {
+  /* Timestamp, in units chosen by the caller, e.g. seconds since boot. */
+  uint32_t timestamp;
+  /* Encoded EnvelopeTracker record. */
+  uint8_t record[kEnvelopeTrackerRecordBytes];
+} EnvelopeLogEntry;
+
+typedef struct {
+  EnvelopeLogFlash flash;
+  /* Address of the first page. */
+  uint32_t base_address;
+  /* Page size in bytes. */
+  int page_size;
+  /* Number of pages in the ring. */
+  int num_pages;
+  /* Number of entries that fit in a page after the header. */
+  int entries_per_page;
+  /* Index of the newest page, which entries are appended to. */
+  int head_page;
+  /* Index of the next free entry in the head page. */
+  int head_entry;
+  /* Sequence number of the head page. */
+  uint32_t head_sequence;
+} EnvelopeLog;
+
+/* Read position in the log. */
+typedef struct {
+  /* Page being read and index of the next entry in it. */
+  int page;
+  int entry;
+} EnvelopeLogCursor;
+
+/* Initializes the log for `num_pages` pages of `page_size` bytes starting at
+ * `base_address`, and finds the newest page by scanning the page headers. If
+ * no page has a valid header, the first page is erased to start an empty log.
+ * Returns 1 on success, 0 on failure.
+ */
+int /*bool*/ EnvelopeLogInit(EnvelopeLog* log, const EnvelopeLogFlash* flash,
+                             uint32_t base_address, int page_size,
+                             int num_pages);
+
+/* Erases all pages, discarding all entries. Returns 1 on success. */
+int /*bool*/ EnvelopeLogClear(EnvelopeLog* log);
+
+/* Appends a record with `timestamp`, which must not be
+ * kEnvelopeLogInvalidTimestamp. If the head page is full, the oldest page is
+ * erased to make room. Returns 1 on success, 0 on failure.
+ */
+int /*bool*/ EnvelopeLogAppend(EnvelopeLog* log, uint32_t timestamp,
+                               const uint8_t* record);
+
+/* Sets `cursor` to the oldest entry in the log. */
+void EnvelopeLogReadBegin(const EnvelopeLog* log, EnvelopeLogCursor* cursor);
+
+/* Reads the entry at `cursor` into `entry` and advances the cursor. Returns 1
+ * on success, or 0 when no entries are left. Entries appended while reading
+ * are also read. If the ring wraps onto the page being read, entries on it
+ * are lost.
+ */
+int /*bool*/ EnvelopeLogReadNext(const EnvelopeLog* log,
+                                 EnvelopeLogCursor* cursor,
+                                 EnvelopeLogEntry* entry);
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif
+#endif /* AUDIO_TO_TACTILE_SRC_TACTILE_ENVELOPE_LOG_H_ */
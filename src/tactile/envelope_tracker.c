@@ -135,6 +135,43 @@ void EnvelopeTrackerDecodeRecord(const uint8_t* record, float* dest) {
   }
 }
 
+void EnvelopeTrackerDecodeRecords(const uint8_t* records, int num_records,
+                                  float* dest) {
+  /* Table of DecodeEnergy() for all 256 codes, computed on first use. */
+  static float energy_table[256];
+  static int /*bool*/ energy_table_ready = 0;
+  if (!energy_table_ready) {
+    int code;
+    for (code = 0; code < 256; ++code) {
+      energy_table[code] = DecodeEnergy((uint8_t)code);
+    }
+    energy_table_ready = 1;
+  }
+
+  int n;
+  for (n = 0; n < num_records; ++n) {
+    const uint8_t* record = records;
+    int cumulative = record[0];
+    dest[0] = energy_table[cumulative];
+
+    int i;
+    for (i = 1; i < kEnvelopeTrackerRecordPoints; i += 8, record += 3) {
+      uint_fast32_t pack24 = (uint_fast32_t)(record[1])
+                           | (uint_fast32_t)(record[2]) << 8
+                           | (uint_fast32_t)(record[3]) << 16;
+      int j;
+      for (j = 0; j < 8; ++j, pack24 >>= 3) {
+        cumulative += DecodeDelta(pack24 & 7);
+        /* Wrap to 8 bits, as the uint8_t conversion in DecodeEnergy() does. */
+        dest[i + j] = energy_table[cumulative & 255];
+      }
+    }
+
+    records += kEnvelopeTrackerRecordBytes;
+    dest += kEnvelopeTrackerRecordPoints;
+  }
+}
+
 /* Records `energy` as the next measurement, saving it in `buffer`. If the
  * buffer is filled, the record is encoded and the function returns 1.
  * Otherwise, it returns 0.
@@ -38,6 +38,11 @@
  *   uint8_t record[kEnvelopeTrackerRecordBytes] = ...
  *   float powers[kEnvelopeTrackerRecordPoints];
  *   EnvelopeTrackerDecodeRecord(record, powers);
+ *
+ *   // Decoding many records at once, e.g. a log downloaded from flash.
+ *   uint8_t records[kNumRecords * kEnvelopeTrackerRecordBytes] = ...
+ *   float powers[kNumRecords * kEnvelopeTrackerRecordPoints];
+ *   EnvelopeTrackerDecodeRecords(records, kNumRecords, powers);
  */
 
 #ifndef AUDIO_TO_TACTILE_SRC_TACTILE_ENVELOPE_TRACKER_H_
@@ -98,6 +103,15 @@ void EnvelopeTrackerGetRecord(const EnvelopeTracker* tracker, uint8_t* dest);
  */
 void EnvelopeTrackerDecodeRecord(const uint8_t* record, float* dest);
 
+/* Decodes `num_records` consecutive records, each kEnvelopeTrackerRecordBytes
+ * bytes, to `dest`, which must have space for
+ * `num_records * kEnvelopeTrackerRecordPoints` elements. The result is the same
+ * as calling EnvelopeTrackerDecodeRecord() on each record, but faster, since
+ * energies are looked up in a table rather than computed with FastPow().
+ */
+void EnvelopeTrackerDecodeRecords(const uint8_t* records, int num_records,
+                                  float* dest);
+
 #ifdef __cplusplus
 }  /* extern "C" */
 #endif
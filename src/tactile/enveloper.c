@@ -18,10 +18,14 @@
 #include <math.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "dsp/butterworth.h"
+#include "dsp/denormals.h"
 #include "dsp/fast_fun.h"
 #include "dsp/math_constants.h"
+#include "dsp/simd.h"
+#include "tactile/enveloper_kernel.h"
 
 /* NOTE: These pages have a good description of acoustic phonetics and
  * describe spectrogram characteristics of different categories of phones:
@@ -47,6 +51,7 @@ const EnveloperParams kDefaultEnveloperParams = {
             /*bpf_high_edge_hz=*/500.0f,
             /*denoising_strength=*/25.0f,
             /*output_gain=*/2.5f,
+            /*output_decimation=*/1,
         },
         /* Vowel channel, sensitive to 500-3500 Hz. */
         {
@@ -54,6 +59,7 @@ const EnveloperParams kDefaultEnveloperParams = {
             /*bpf_high_edge_hz=*/3500.0f,
             /*denoising_strength=*/4.0f,
             /*output_gain=*/2.5f,
+            /*output_decimation=*/1,
         },
         /* "sh" fricative channel, sensitive to 2500-3500 Hz.
          * This channel should respond especially to "sh", "ch" and other
@@ -68,6 +74,7 @@ const EnveloperParams kDefaultEnveloperParams = {
             /*bpf_high_edge_hz=*/3500.0f,
             /*denoising_strength=*/2.5f,
             /*output_gain=*/2.5f,
+            /*output_decimation=*/1,
         },
         /* Fricative channel, sensitive to 4000-6000 Hz.
          * This channel should respond especially to "s" and "z" alveolar
@@ -80,6 +87,7 @@ const EnveloperParams kDefaultEnveloperParams = {
             /*bpf_high_edge_hz=*/6000.0f,
             /*denoising_strength=*/2.5f,
             /*output_gain=*/2.5f,
+            /*output_decimation=*/1,
         },
     },
     /*energy_cutoff_hz=*/500.0f,
@@ -90,9 +98,15 @@ const EnveloperParams kDefaultEnveloperParams = {
     /*gain_tau_attack_s=*/0.005f,
     /*gain_tau_release_s=*/0.15f,
     /*compressor_exponent=*/0.25f,
+    /*use_fast_pow_table=*/0,
+    /*side_energy_sample_rate_hz=*/0.0f,
 };
 
-static const float kCompressorStabilization = 0.125f;
+static const float kCompressorStabilization =
+    kEnveloperCompressorStabilization;
+
+/* Max decimation of the baseband in EnveloperProcessSamplesMultirate(). */
+#define kEnveloperMaxBasebandDecimation 4
 
 static float ComputeFilteredPeak(
     const BiquadFilterCoeffs* filter, const EnveloperChannelParams* params_c,
@@ -129,6 +143,7 @@ int EnveloperInit(Enveloper* state,
              !(params->denoising_transition_db > 0.0f) ||
              !(0.0f <= params->agc_strength && params->agc_strength <= 1.0f) ||
              !(params->compressor_exponent > 0.0f) ||
+             !(params->side_energy_sample_rate_hz >= 0.0f) ||
              !(decimation_factor > 0)) {
     fprintf(stderr, "EnveloperInit: Invalid EnveloperParams.\n");
     return 0;
@@ -143,24 +158,56 @@ int EnveloperInit(Enveloper* state,
   for (c = 0; c < kEnveloperNumChannels; ++c) {
     const EnveloperChannelParams* params_c = &params->channel_params[c];
     EnveloperChannel* state_c = &state->channels[c];
-    state_c->peak = ComputeFilteredPeak(
-        &state->energy_biquad_coeffs, params_c, input_sample_rate_hz);
+    /* With side energy, the fricative channel's filters are those the sender
+     * runs at its rate.
+     */
+    const int is_side = (c == kEnveloperNumChannels - 1 &&
+                         params->side_energy_sample_rate_hz > 0.0f);
+    const float rate_hz = is_side ? params->side_energy_sample_rate_hz
+                                  : input_sample_rate_hz;
+    BiquadFilterCoeffs energy_coeffs = state->energy_biquad_coeffs;
+    if (is_side && !DesignButterworthOrder2Lowpass(
+            params->energy_cutoff_hz, rate_hz, &energy_coeffs)) {
+      fprintf(stderr, "EnveloperInit: Failed to design energy smoother.\n");
+      return 0;
+    }
+    if (!(1 <= params_c->output_decimation &&
+          params_c->output_decimation <= kEnveloperMaxOutputDecimation)) {
+      fprintf(stderr, "EnveloperInit: output_decimation must be between "
+              "1 and %d.\n", kEnveloperMaxOutputDecimation);
+      return 0;
+    }
+    state_c->peak = ComputeFilteredPeak(&energy_coeffs, params_c, rate_hz);
     state_c->gate_thresh_factor = params_c->denoising_strength;
     state_c->output_gain = params_c->output_gain;
+    state_c->output_decimation = params_c->output_decimation;
 
     if (!DesignButterworthOrder2Bandpass(
             params_c->bpf_low_edge_hz, params_c->bpf_high_edge_hz,
-            input_sample_rate_hz, state_c->bpf_biquad_coeffs)) {
+            rate_hz, state_c->bpf_biquad_coeffs)) {
       fprintf(stderr, "EnveloperInit: Failed to design bandpass filter %d.\n",
               c);
       return 0;
     }
+
+    int k;
+    for (k = 0; k < 2; ++k) {
+      const BiquadFilterCoeffs* coeffs = &state_c->bpf_biquad_coeffs[k];
+      state->bpf_coeffs[k][0][c] = coeffs->b0;
+      state->bpf_coeffs[k][1][c] = coeffs->b1;
+      state->bpf_coeffs[k][2][c] = coeffs->b2;
+      state->bpf_coeffs[k][3][c] = coeffs->a1;
+      state->bpf_coeffs[k][4][c] = coeffs->a2;
+    }
   }
 
   state->input_sample_rate_hz = input_sample_rate_hz;
   state->decimation_factor = decimation_factor;
   state->agc_exponent = -params->agc_strength;
   state->compressor_exponent = params->compressor_exponent;
+  state->use_fast_pow_table = params->use_fast_pow_table;
+  memset(&state->agc_pow_table, 0, sizeof(FastPowTable));
+  memset(&state->compressor_pow_table, 0, sizeof(FastPowTable));
 
   state->energy_smoother_coeff =
       EnveloperSmootherCoeff(state, params->energy_tau_s);
@@ -173,36 +220,139 @@ int EnveloperInit(Enveloper* state,
   state->gain_smoother_coeffs[1] =
       EnveloperSmootherCoeff(state, params->gain_tau_release_s);
 
+  /* Design the multirate baseband filters at the lowest rate, down by a factor
+   * of up to kEnveloperMaxBasebandDecimation, that divides the decimation
+   * factor and keeps the rectified baseband signal, with up to twice the
+   * baseband frequencies, below Nyquist.
+   */
+  const EnveloperChannelParams* baseband_params = &params->channel_params[0];
+  int r;
+  for (r = kEnveloperMaxBasebandDecimation; r > 1; r /= 2) {
+    const float rate_hz = input_sample_rate_hz / r;
+    if (decimation_factor % r == 0 &&
+        baseband_params->bpf_high_edge_hz < 0.25f * rate_hz &&
+        params->energy_cutoff_hz < 0.25f * rate_hz &&
+        DesignButterworthOrder2Bandpass(
+            baseband_params->bpf_low_edge_hz,
+            baseband_params->bpf_high_edge_hz, rate_hz,
+            state->baseband_bpf_biquad_coeffs) &&
+        DesignButterworthOrder2Lowpass(
+            params->energy_cutoff_hz, rate_hz,
+            &state->baseband_energy_biquad_coeffs)) {
+      break;
+    }
+  }
+  state->baseband_decimation = r;
+
   /* Warm up duration is 500 ms. */
   state->num_warm_up_samples =
       (int)(0.5f * input_sample_rate_hz / decimation_factor + 0.5f);
 
+  state->first_active_channel = 0;
   EnveloperUpdatePrecomputedParams(state);
   EnveloperReset(state);
   return 1;
 }
 
 void EnveloperReset(Enveloper* state) {
+  memset(state->biquad_z, 0, sizeof(state->biquad_z));
+  memset(state->halfband_z, 0, sizeof(state->halfband_z));
+  memset(&state->dual_mic, 0, sizeof(state->dual_mic));
   int c;
   for (c = 0; c < kEnveloperNumChannels; ++c) {
     EnveloperChannel* state_c = &state->channels[c];
-    BiquadFilterInitZero(&state_c->bpf_biquad_state[0]);
-    BiquadFilterInitZero(&state_c->bpf_biquad_state[1]);
-    BiquadFilterInitZero(&state_c->energy_biquad_state);
     state_c->smoothed_energy = 0.0f;
     state_c->noise = 0.0f;
     state_c->smoothed_gain = 0.0f;
+    state_c->hold_counter = 0;
+    state_c->held_output = 0.0f;
+    state->dual_mic.weight[c] = 0.5f;
   }
 
   state->warm_up_counter = state->num_warm_up_samples;
 }
 
+void EnveloperSetActiveChannels(Enveloper* state, int active_channels) {
+  int first = 0;
+  while (first < kEnveloperNumChannels && !(active_channels & (1 << first))) {
+    ++first;
+  }
+  if (first < state->first_active_channel) { EnveloperReset(state); }
+  state->first_active_channel = first;
+}
+
+void EnveloperGetWarmState(const Enveloper* state, float* warm_state) {
+  int c;
+  for (c = 0; c < kEnveloperNumChannels; ++c) {
+    const EnveloperChannel* state_c = &state->channels[c];
+    warm_state[3 * c] = state_c->smoothed_energy;
+    warm_state[3 * c + 1] = state_c->noise;
+    warm_state[3 * c + 2] = state_c->smoothed_gain;
+  }
+}
+
+int EnveloperSetWarmState(Enveloper* state, const float* warm_state) {
+  int i;
+  for (i = 0; i < kEnveloperWarmStateSize; ++i) {
+    /* All values are nonnegative. This also rejects NaN and infinity. */
+    if (!(0.0f <= warm_state[i] && warm_state[i] <= 1e30f)) {
+      fprintf(stderr, "Error: Invalid Enveloper warm state.\n");
+      return 0;
+    }
+  }
+
+  int c;
+  for (c = 0; c < kEnveloperNumChannels; ++c) {
+    EnveloperChannel* state_c = &state->channels[c];
+    state_c->smoothed_energy = warm_state[3 * c];
+    state_c->noise = warm_state[3 * c + 1];
+    state_c->smoothed_gain = warm_state[3 * c + 2];
+  }
+  state->warm_up_counter = 0;
+  return 1;
+}
+
 void EnveloperUpdatePrecomputedParams(Enveloper* state) {
-  /* Precompute noise estimation decay coefficient. */
-  state->noise_coeffs[0] = 1.0f / state->noise_coeffs[1];
+  EnveloperTuning tuning;
+  EnveloperGetTuning(state, &tuning);
+  EnveloperUpdateTuning(state, &tuning, kEnveloperTuningAllChanged);
+  EnveloperSetTuning(state, &tuning);
+}
+
+void EnveloperGetTuning(const Enveloper* state, EnveloperTuning* tuning) {
+  tuning->noise_coeffs[0] = state->noise_coeffs[0];
+  tuning->noise_coeffs[1] = state->noise_coeffs[1];
+  tuning->gate_transition_factor = state->gate_transition_factor;
+  tuning->agc_exponent = state->agc_exponent;
+  tuning->compressor_exponent = state->compressor_exponent;
+  tuning->compressor_delta = state->compressor_delta;
+  int c;
+  for (c = 0; c < kEnveloperNumChannels; ++c) {
+    const EnveloperChannel* state_c = &state->channels[c];
+    tuning->gate_thresh_factor[c] = state_c->gate_thresh_factor;
+    tuning->output_gain[c] = state_c->output_gain;
+    tuning->equalization[c] = state_c->equalization;
+  }
+  tuning->agc_pow_table = state->agc_pow_table;
+  tuning->compressor_pow_table = state->compressor_pow_table;
+}
+
+void EnveloperUpdateTuning(const Enveloper* state, EnveloperTuning* tuning,
+                           int changed_flags) {
+  if (changed_flags & kEnveloperTuningNoiseChanged) {
+    /* Precompute noise estimation decay coefficient. */
+    tuning->noise_coeffs[0] = 1.0f / tuning->noise_coeffs[1];
+  }
+  if (!(changed_flags & kEnveloperTuningCompressorChanged)) { return; }
+
   /* Precompute compressor delta = kCompressorStabilization^(1/exponent). */
-  state->compressor_delta = (float) pow(kCompressorStabilization,
-                                        1.0f / state->compressor_exponent);
+  tuning->compressor_delta = (float) pow(kCompressorStabilization,
+                                         1.0f / tuning->compressor_exponent);
+  if (state->use_fast_pow_table) {
+    FastPowTableInit(&tuning->agc_pow_table, tuning->agc_exponent);
+    FastPowTableInit(&tuning->compressor_pow_table,
+                     tuning->compressor_exponent);
+  }
 
   /* Enveloper's process for envelope extraction and compression inherently
    * amplifies lower frequencies somewhat more than higher frequencies.
@@ -234,137 +384,738 @@ void EnveloperUpdatePrecomputedParams(Enveloper* state) {
    */
   int c;
   for (c = 0; c < kEnveloperNumChannels; ++c) {
-    EnveloperChannel* state_c = &state->channels[c];
+    const EnveloperChannel* state_c = &state->channels[c];
 
     /* Target output is -3 dBFS, a little below maximum to avoid saturation. */
     const float kTargetOutput = (float)(1.0 / M_SQRT2);
     const float pcen_peak =
-        FastPow(FastExp2(-2 * state->agc_exponent) * state_c->peak +
-            state->compressor_delta, state->compressor_exponent)
+        FastPow(FastExp2(-2 * tuning->agc_exponent) * state_c->peak +
+            tuning->compressor_delta, tuning->compressor_exponent)
         - kCompressorStabilization;
-    state_c->equalization = FastPow(kTargetOutput / pcen_peak,
-        1.0f / (state->agc_exponent * state->compressor_exponent));
+    tuning->equalization[c] = FastPow(kTargetOutput / pcen_peak,
+        1.0f / (tuning->agc_exponent * tuning->compressor_exponent));
   }
 }
 
-/* Smooth gate function `x^2 / (x^2 + halfway_point^2)`. The function behaves
- * like `x^2 / halfway_point^2` for x near zero, is equal to 1/2 at
- * x = halfway_point, and is asymptotically 1 as x -> infinity.
+/* Gets `coeff^factor`, for a growth or decay coefficient `coeff` applied once
+ * per `factor` frames instead of every frame.
  */
-static float SoftGate(float x, float halfway_point) {
-  const float x_sqr = x * x;
-  return x_sqr / (x_sqr + halfway_point * halfway_point);
+static float DecimatedGrowthCoeff(float coeff, int factor) {
+  float result = coeff;
+  int i;
+  for (i = 1; i < factor; ++i) { result *= coeff; }
+  return result;
 }
 
+/* Same as DecimatedGrowthCoeff() for a one-pole smoother coefficient. */
+static float DecimatedSmootherCoeff(float coeff, int factor) {
+  return (factor == 1) ? coeff
+                       : 1.0f - DecimatedGrowthCoeff(1.0f - coeff, factor);
+}
+
+void EnveloperSetTuning(Enveloper* state, const EnveloperTuning* tuning) {
+  state->noise_coeffs[0] = tuning->noise_coeffs[0];
+  state->noise_coeffs[1] = tuning->noise_coeffs[1];
+  state->gate_transition_factor = tuning->gate_transition_factor;
+  state->agc_exponent = tuning->agc_exponent;
+  state->compressor_exponent = tuning->compressor_exponent;
+  state->compressor_delta = tuning->compressor_delta;
+  int c;
+  for (c = 0; c < kEnveloperNumChannels; ++c) {
+    EnveloperChannel* state_c = &state->channels[c];
+    state_c->gate_thresh_factor = tuning->gate_thresh_factor[c];
+    state_c->output_gain = tuning->output_gain[c];
+    state_c->equalization = tuning->equalization[c];
+
+    const int factor = state_c->output_decimation;
+    state_c->energy_smoother_coeff =
+        DecimatedSmootherCoeff(state->energy_smoother_coeff, factor);
+    state_c->noise_coeffs[0] =
+        DecimatedGrowthCoeff(tuning->noise_coeffs[0], factor);
+    state_c->noise_coeffs[1] =
+        DecimatedGrowthCoeff(tuning->noise_coeffs[1], factor);
+    int k;
+    for (k = 0; k < 2; ++k) {
+      state_c->gain_smoother_coeffs[k] =
+          DecimatedSmootherCoeff(state->gain_smoother_coeffs[k], factor);
+    }
+  }
+  state->agc_pow_table = tuning->agc_pow_table;
+  state->compressor_pow_table = tuning->compressor_pow_table;
+}
 void EnveloperProcessSamples(Enveloper* state,
                              const float* input,
                              int num_samples,
                              float* output) {
-  const float energy_smoother_coeff = state->energy_smoother_coeff;
-  const float gate_transition_factor = state->gate_transition_factor;
-  const float agc_exponent = state->agc_exponent;
-  const float compressor_exponent = state->compressor_exponent;
-  const float compressor_delta = state->compressor_delta;
+  EnveloperProcessSamplesKernel(state, input, num_samples,
+                                state->decimation_factor, NULL, output);
+}
+
+void EnveloperProcessSamplesWithTaps(Enveloper* state,
+                                     const float* input,
+                                     int num_samples,
+                                     const EnveloperTaps* taps,
+                                     float* output) {
+  EnveloperProcessSamplesKernel(state, input, num_samples,
+                                state->decimation_factor, taps, output);
+}
+
+/* Max number of output frames per chunk in
+ * EnveloperProcessSamplesChannelMajor().
+ */
+#define kEnveloperChunkFrames 32
+
+/* Computes EnveloperPow(use_table, table, x, y) in each lane. This is done
+ * with the scalar function so that results are identical to
+ * EnveloperProcessSamples().
+ */
+static Float4 EnveloperPowLanes(int use_table, const FastPowTable* table,
+                                Float4 x, float y) {
+  float values[4];
+  Float4Store(values, x);
+  values[0] = EnveloperPow(use_table, table, values[0], y);
+  values[1] = EnveloperPow(use_table, table, values[1], y);
+  values[2] = EnveloperPow(use_table, table, values[2], y);
+  values[3] = EnveloperPow(use_table, table, values[3], y);
+  return Float4Load(values);
+}
+
+/* Runs channel `c`'s bandpass and energy filters over `num_frames`
+ * decimated frames of input, writing the clamped energy for each output frame
+ * to `energies[kEnveloperNumChannels * i + c]`. The arithmetic is the same as
+ * BiquadProcessOneSample4 in each lane, so results are identical.
+ */
+static void ComputeChannelEnergies(Enveloper* state, int c,
+                                   const float* input, int num_frames,
+                                   float* energies) {
+  const float bpf0_b0 = state->bpf_coeffs[0][0][c];
+  const float bpf0_b1 = state->bpf_coeffs[0][1][c];
+  const float bpf0_b2 = state->bpf_coeffs[0][2][c];
+  const float bpf0_a1 = state->bpf_coeffs[0][3][c];
+  const float bpf0_a2 = state->bpf_coeffs[0][4][c];
+  const float bpf1_b0 = state->bpf_coeffs[1][0][c];
+  const float bpf1_b1 = state->bpf_coeffs[1][1][c];
+  const float bpf1_b2 = state->bpf_coeffs[1][2][c];
+  const float bpf1_a1 = state->bpf_coeffs[1][3][c];
+  const float bpf1_a2 = state->bpf_coeffs[1][4][c];
+  const BiquadFilterCoeffs* lpf = &state->energy_biquad_coeffs;
   const int decimation_factor = state->decimation_factor;
-  int warm_up_counter = state->warm_up_counter;
+  /* Hold the filter states in local variables over the loop. */
+  float bpf0_z0 = state->biquad_z[0][0][c];
+  float bpf0_z1 = state->biquad_z[0][1][c];
+  float bpf1_z0 = state->biquad_z[1][0][c];
+  float bpf1_z1 = state->biquad_z[1][1][c];
+  float lpf_z0 = state->biquad_z[2][0][c];
+  float lpf_z1 = state->biquad_z[2][1][c];
+  float energy = 0.0f;
+  int i;
+
+  for (i = 0; i < num_frames; ++i) {
+    int j;
+    for (j = 0; j < decimation_factor; ++j) {
+      /* Apply bandpass filter. */
+      float next_state = input[j] - bpf0_a1 * bpf0_z0 - bpf0_a2 * bpf0_z1;
+      float sample =
+          bpf0_b0 * next_state + bpf0_b1 * bpf0_z0 + bpf0_b2 * bpf0_z1;
+      bpf0_z1 = bpf0_z0;
+      bpf0_z0 = next_state;
+
+      next_state = sample - bpf1_a1 * bpf1_z0 - bpf1_a2 * bpf1_z1;
+      sample = bpf1_b0 * next_state + bpf1_b1 * bpf1_z0 + bpf1_b2 * bpf1_z1;
+      bpf1_z1 = bpf1_z0;
+      bpf1_z0 = next_state;
+
+      /* Half-wave rectification and squaring. Like Float4Max(sample, zero),
+       * this maps NaN to zero.
+       */
+      sample = (sample > 0.0f) ? sample : 0.0f;
+      const float rectified = sample * sample;
+
+      /* Lowpass filter the energy envelope. */
+      next_state = rectified - lpf->a1 * lpf_z0 - lpf->a2 * lpf_z1;
+      energy = lpf->b0 * next_state + lpf->b1 * lpf_z0 + lpf->b2 * lpf_z1;
+      lpf_z1 = lpf_z0;
+      lpf_z0 = next_state;
+    }
+
+    /* Clamp negative energy to zero, preserving NaN. */
+    energies[kEnveloperNumChannels * i + c] = (0.0f > energy) ? 0.0f : energy;
+    input += decimation_factor;
+  }
+
+  state->biquad_z[0][0][c] = bpf0_z0;
+  state->biquad_z[0][1][c] = bpf0_z1;
+  state->biquad_z[1][0][c] = bpf1_z0;
+  state->biquad_z[1][1][c] = bpf1_z1;
+  state->biquad_z[2][0][c] = lpf_z0;
+  state->biquad_z[2][1][c] = lpf_z1;
+}
+
+/* The dual microphone mix weights are updated only when a microphone's SNR
+ * exceeds this energy ratio, about 6 dB, so that they hold through pauses.
+ */
+#define kDualMicMinSnr 4.0f
+
+/* Same as ComputeChannelEnergies(), but for EnveloperProcessSamplesDualMic().
+ * Both microphones are bandpass filtered and their rectified energies mixed
+ * with the channel's weight, which is then updated at the end of each frame.
+ * `warm_up_counter` is the Enveloper's counter at the first frame. While
+ * warming up, the noise estimates are the average energies, as in PCEN.
+ */
+static void ComputeChannelEnergiesDualMic(Enveloper* state, int c,
+                                          const float* input0,
+                                          const float* input1,
+                                          int num_frames,
+                                          int warm_up_counter,
+                                          float* energies) {
+  const float bpf0_b0 = state->bpf_coeffs[0][0][c];
+  const float bpf0_b1 = state->bpf_coeffs[0][1][c];
+  const float bpf0_b2 = state->bpf_coeffs[0][2][c];
+  const float bpf0_a1 = state->bpf_coeffs[0][3][c];
+  const float bpf0_a2 = state->bpf_coeffs[0][4][c];
+  const float bpf1_b0 = state->bpf_coeffs[1][0][c];
+  const float bpf1_b1 = state->bpf_coeffs[1][1][c];
+  const float bpf1_b2 = state->bpf_coeffs[1][2][c];
+  const float bpf1_a1 = state->bpf_coeffs[1][3][c];
+  const float bpf1_a2 = state->bpf_coeffs[1][4][c];
+  const BiquadFilterCoeffs* lpf = &state->energy_biquad_coeffs;
+  const int decimation_factor = state->decimation_factor;
+  const float energy_smoother_coeff = state->energy_smoother_coeff;
+  const float* noise_coeffs = state->noise_coeffs;
+  EnveloperDualMic* dual_mic = &state->dual_mic;
+  /* Bandpass filter states, indexed by microphone. */
+  float bpf0_z0[2] = {state->biquad_z[0][0][c], dual_mic->biquad_z[0][0][c]};
+  float bpf0_z1[2] = {state->biquad_z[0][1][c], dual_mic->biquad_z[0][1][c]};
+  float bpf1_z0[2] = {state->biquad_z[1][0][c], dual_mic->biquad_z[1][0][c]};
+  float bpf1_z1[2] = {state->biquad_z[1][1][c], dual_mic->biquad_z[1][1][c]};
+  float lpf_z0 = state->biquad_z[2][0][c];
+  float lpf_z1 = state->biquad_z[2][1][c];
+  float weight = dual_mic->weight[c];
+  float energy = 0.0f;
+  int i;
+
+  for (i = 0; i < num_frames; ++i) {
+    float frame_energy[2] = {0.0f, 0.0f};
+    int j;
+    for (j = 0; j < decimation_factor; ++j) {
+      float rectified[2];
+      int m;
+      for (m = 0; m < 2; ++m) {
+        /* Apply bandpass filter. */
+        const float x = (m == 0) ? input0[j] : input1[j];
+        float next_state = x - bpf0_a1 * bpf0_z0[m] - bpf0_a2 * bpf0_z1[m];
+        float sample = bpf0_b0 * next_state + bpf0_b1 * bpf0_z0[m] +
+            bpf0_b2 * bpf0_z1[m];
+        bpf0_z1[m] = bpf0_z0[m];
+        bpf0_z0[m] = next_state;
+
+        next_state = sample - bpf1_a1 * bpf1_z0[m] - bpf1_a2 * bpf1_z1[m];
+        sample = bpf1_b0 * next_state + bpf1_b1 * bpf1_z0[m] +
+            bpf1_b2 * bpf1_z1[m];
+        bpf1_z1[m] = bpf1_z0[m];
+        bpf1_z0[m] = next_state;
+
+        /* Half-wave rectification and squaring. */
+        sample = (sample > 0.0f) ? sample : 0.0f;
+        rectified[m] = sample * sample;
+        frame_energy[m] += rectified[m];
+      }
+
+      /* Mix the microphones. This is exactly rectified[0] if the inputs are
+       * equal, so that results match ComputeChannelEnergies().
+       */
+      const float mixed =
+          rectified[0] + weight * (rectified[1] - rectified[0]);
+
+      /* Lowpass filter the energy envelope. */
+      const float next_state = mixed - lpf->a1 * lpf_z0 - lpf->a2 * lpf_z1;
+      energy = lpf->b0 * next_state + lpf->b1 * lpf_z0 + lpf->b2 * lpf_z1;
+      lpf_z1 = lpf_z0;
+      lpf_z0 = next_state;
+    }
+
+    /* Clamp negative energy to zero, preserving NaN. */
+    energies[kEnveloperNumChannels * i + c] = (0.0f > energy) ? 0.0f : energy;
+
+    /* Update each microphone's smoothed energy, noise estimate, and SNR. */
+    float snr[2];
+    int m;
+    for (m = 0; m < 2; ++m) {
+      float* smoothed = &dual_mic->energy[m][c];
+      float* noise = &dual_mic->noise[m][c];
+      *smoothed += energy_smoother_coeff *
+          (frame_energy[m] / decimation_factor - *smoothed);
+      if (warm_up_counter) {
+        const int count = state->num_warm_up_samples - warm_up_counter + 1;
+        *noise += (*smoothed - *noise) / count;
+      } else {
+        *noise *= noise_coeffs[*noise < *smoothed];
+      }
+      snr[m] = *smoothed / (*noise + 1e-9f);
+    }
+    /* Hold the weight unless a microphone has salient signal. */
+    if (snr[0] > kDualMicMinSnr || snr[1] > kDualMicMinSnr) {
+      const float snr_sqr0 = snr[0] * snr[0];
+      const float snr_sqr1 = snr[1] * snr[1];
+      weight = snr_sqr1 / (snr_sqr0 + snr_sqr1);
+    }
+
+    if (warm_up_counter) { --warm_up_counter; }
+    input0 += decimation_factor;
+    input1 += decimation_factor;
+  }
+
+  state->biquad_z[0][0][c] = bpf0_z0[0];
+  state->biquad_z[0][1][c] = bpf0_z1[0];
+  state->biquad_z[1][0][c] = bpf1_z0[0];
+  state->biquad_z[1][1][c] = bpf1_z1[0];
+  state->biquad_z[2][0][c] = lpf_z0;
+  state->biquad_z[2][1][c] = lpf_z1;
+  dual_mic->biquad_z[0][0][c] = bpf0_z0[1];
+  dual_mic->biquad_z[0][1][c] = bpf0_z1[1];
+  dual_mic->biquad_z[1][0][c] = bpf1_z0[1];
+  dual_mic->biquad_z[1][1][c] = bpf1_z1[1];
+  dual_mic->weight[c] = weight;
+}
+
+/* Taps of the maximally-flat 7-tap halfband lowpass filter
+ * [-1, 0, 9, 16, 9, 0, -1] / 32 for 2:1 decimation. Its response is -47 dB at
+ * 7/16 of the input rate, where frequencies alias to within 1/16 of the input
+ * rate of DC.
+ */
+#define kHalfbandTap0 (-1.0f / 32)
+#define kHalfbandTap2 (9.0f / 32)
+
+/* Decimates an even number `num_samples` of `input` by 2, writing
+ * `num_samples / 2` samples to `output`. `z` holds the last 5 input samples,
+ * newest first. In-place processing output == input is allowed.
+ */
+static void HalfbandDecimate(float* z, const float* input, int num_samples,
+                             float* output) {
+  float z0 = z[0];
+  float z1 = z[1];
+  float z2 = z[2];
+  float z3 = z[3];
+  float z4 = z[4];
   int i;
+  for (i = 0; i < num_samples; i += 2) {
+    const float a = input[i];
+    const float b = input[i + 1];
+    /* The odd taps are zero, except for the center tap 1/2. */
+    output[i / 2] = kHalfbandTap0 * (b + z4) + kHalfbandTap2 * (z0 + z2) +
+        0.5f * z1;
+    z4 = z2;
+    z3 = z1;
+    z2 = z0;
+    z1 = a;
+    z0 = b;
+  }
+  z[0] = z0;
+  z[1] = z1;
+  z[2] = z2;
+  z[3] = z3;
+  z[4] = z4;
+}
 
-  for (i = decimation_factor - 1; i < num_samples; i += decimation_factor) {
-    float energy = 0.0f;
-    float prev_smoothed_energy = 0.0f;
-    int c;
+/* Max number of input samples decimated at a time in
+ * ComputeBasebandEnergiesMultirate().
+ */
+#define kHalfbandChunkSamples 256
 
-    for (c = kEnveloperNumChannels - 1; c >= 0; --c) {
-      EnveloperChannel* state_c = &state->channels[c];
+/* Same as ComputeChannelEnergies() for the baseband channel c = 0, but running
+ * the filters at the reduced rate of EnveloperProcessSamplesMultirate().
+ */
+static void ComputeBasebandEnergiesMultirate(Enveloper* state,
+                                             const float* input,
+                                             int num_frames,
+                                             float* energies) {
+  const BiquadFilterCoeffs* bpf0 = &state->baseband_bpf_biquad_coeffs[0];
+  const BiquadFilterCoeffs* bpf1 = &state->baseband_bpf_biquad_coeffs[1];
+  const BiquadFilterCoeffs* lpf = &state->baseband_energy_biquad_coeffs;
+  const int decimation_factor = state->decimation_factor;
+  const int baseband_decimation = state->baseband_decimation;
+  /* Number of reduced-rate samples per output frame. */
+  const int frame_samples = decimation_factor / baseband_decimation;
+  /* Decimate a group of whole frames at a time, or a frame in several chunks
+   * if decimation_factor exceeds the chunk size.
+   */
+  const int group_frames = (decimation_factor < kHalfbandChunkSamples)
+      ? kHalfbandChunkSamples / decimation_factor : 1;
+  float bpf0_z0 = state->biquad_z[0][0][0];
+  float bpf0_z1 = state->biquad_z[0][1][0];
+  float bpf1_z0 = state->biquad_z[1][0][0];
+  float bpf1_z1 = state->biquad_z[1][1][0];
+  float lpf_z0 = state->biquad_z[2][0][0];
+  float lpf_z1 = state->biquad_z[2][1][0];
+  float decimated[kHalfbandChunkSamples / 2];
+  int frame_sample = 0;
+  int i = 0;
+
+  while (i < num_frames) {
+    const int num_input = decimation_factor *
+        ((num_frames - i < group_frames) ? num_frames - i : group_frames);
+    int start;
+    /* Chunk sizes are multiples of baseband_decimation, since
+     * decimation_factor and kHalfbandChunkSamples are.
+     */
+    for (start = 0; start < num_input; start += kHalfbandChunkSamples) {
+      int num_samples = num_input - start;
+      if (num_samples > kHalfbandChunkSamples) {
+        num_samples = kHalfbandChunkSamples;
+      }
+      HalfbandDecimate(state->halfband_z[0], input + start, num_samples,
+                       decimated);
+      num_samples /= 2;
+      if (baseband_decimation == 4) {
+        HalfbandDecimate(state->halfband_z[1], decimated, num_samples,
+                         decimated);
+        num_samples /= 2;
+      }
 
       int j;
-      for (j = 0; j < decimation_factor; ++j) {
+      for (j = 0; j < num_samples; ++j) {
         /* Apply bandpass filter. */
-        float sample = BiquadFilterProcessOneSample(
-            &state_c->bpf_biquad_coeffs[0],
-            &state_c->bpf_biquad_state[0], input[j]);
-        sample = BiquadFilterProcessOneSample(
-            &state_c->bpf_biquad_coeffs[1],
-            &state_c->bpf_biquad_state[1], sample);
+        float next_state =
+            decimated[j] - bpf0->a1 * bpf0_z0 - bpf0->a2 * bpf0_z1;
+        float sample =
+            bpf0->b0 * next_state + bpf0->b1 * bpf0_z0 + bpf0->b2 * bpf0_z1;
+        bpf0_z1 = bpf0_z0;
+        bpf0_z0 = next_state;
+
+        next_state = sample - bpf1->a1 * bpf1_z0 - bpf1->a2 * bpf1_z1;
+        sample =
+            bpf1->b0 * next_state + bpf1->b1 * bpf1_z0 + bpf1->b2 * bpf1_z1;
+        bpf1_z1 = bpf1_z0;
+        bpf1_z0 = next_state;
 
         /* Half-wave rectification and squaring. */
-        const float rectified = (sample > 0.0f) ? sample * sample : 0.0f;
+        sample = (sample > 0.0f) ? sample : 0.0f;
+        const float rectified = sample * sample;
 
         /* Lowpass filter the energy envelope. */
-        energy = BiquadFilterProcessOneSample(
-            &state->energy_biquad_coeffs,
-            &state_c->energy_biquad_state, rectified);
+        next_state = rectified - lpf->a1 * lpf_z0 - lpf->a2 * lpf_z1;
+        const float energy =
+            lpf->b0 * next_state + lpf->b1 * lpf_z0 + lpf->b2 * lpf_z1;
+        lpf_z1 = lpf_z0;
+        lpf_z0 = next_state;
+
+        /* Output the energy on the last sample of each frame. */
+        if (++frame_sample == frame_samples) {
+          /* Clamp negative energy to zero, preserving NaN. */
+          energies[kEnveloperNumChannels * i] =
+              (0.0f > energy) ? 0.0f : energy;
+          frame_sample = 0;
+          ++i;
+        }
       }
+    }
+
+    input += num_input;
+  }
+
+  state->biquad_z[0][0][0] = bpf0_z0;
+  state->biquad_z[0][1][0] = bpf0_z1;
+  state->biquad_z[1][0][0] = bpf1_z0;
+  state->biquad_z[1][1][0] = bpf1_z1;
+  state->biquad_z[2][0][0] = lpf_z0;
+  state->biquad_z[2][1][0] = lpf_z1;
+}
+
+/* Implementation of EnveloperProcessSamplesChannelMajor(), and if `multirate`
+ * is nonzero, of EnveloperProcessSamplesMultirate(). If `side_energy` is
+ * non-null, it gives the fricative channel's energies as in
+ * EnveloperProcessSamplesWithSideEnergy(). If `input1` is non-null, it is the
+ * second microphone as in EnveloperProcessSamplesDualMic().
+ */
+static void ProcessSamplesChannelMajor(Enveloper* state,
+                                       const float* input,
+                                       const float* input1,
+                                       int num_samples,
+                                       int multirate,
+                                       const float* side_energy,
+                                       float* output) {
+  const int decimation_factor = state->decimation_factor;
+  const Float4 zero = Float4Broadcast(0.0f);
+  const Float4 energy_smoother_coeff =
+      Float4Broadcast(state->energy_smoother_coeff);
+  const Float4 gate_transition_factor =
+      Float4Broadcast(state->gate_transition_factor);
+  const Float4 gain_smoother_coeffs[2] = {
+      Float4Broadcast(state->gain_smoother_coeffs[0]),
+      Float4Broadcast(state->gain_smoother_coeffs[1])};
+  const Float4 compressor_delta = Float4Broadcast(state->compressor_delta);
+  const Float4 compressor_stabilization =
+      Float4Broadcast(kCompressorStabilization);
+  const Float4 min_noise = Float4Broadcast(1e-9f);
+  const Float4 min_diff = Float4Broadcast(1e-9f);
+  const Float4 two = Float4Broadcast(2.0f);
+  const float agc_exponent = state->agc_exponent;
+  const float compressor_exponent = state->compressor_exponent;
+  const int use_fast_pow_table = state->use_fast_pow_table;
+  const int first_active = state->first_active_channel;
+  int warm_up_counter = state->warm_up_counter;
+  if (first_active == kEnveloperNumChannels) {  /* All channels skipped. */
+    memset(output, 0, sizeof(float) * kEnveloperNumChannels *
+                      (num_samples / decimation_factor));
+    return;
+  }
+  DenormalGuard guard;
+  DenormalGuardBegin(&guard);
+  DenormalsDither(&state->biquad_z[0][0][0],
+                  sizeof(state->biquad_z) / sizeof(float));
+  if (input1) {
+    DenormalsDither(&state->dual_mic.biquad_z[0][0][0],
+                    sizeof(state->dual_mic.biquad_z) / sizeof(float));
+  }
 
-      if (energy < 0.0f) { energy = 0.0f; }
+  /* Gather per-channel params and PCEN states, with channel c in lane c. */
+  float values[12][kEnveloperNumChannels];
+  int hold_counter[kEnveloperNumChannels];
+  /* Nonzero if any channel has output decimation. */
+  int any_decimated = 0;
+  int c;
+  for (c = 0; c < kEnveloperNumChannels; ++c) {
+    const EnveloperChannel* state_c = &state->channels[c];
+    values[0][c] = state_c->equalization;
+    values[1][c] = state_c->gate_thresh_factor;
+    values[2][c] = state_c->output_gain;
+    values[3][c] = state_c->smoothed_energy;
+    values[4][c] = state_c->noise;
+    values[5][c] = state_c->smoothed_gain;
+    values[6][c] = state_c->held_output;
+    values[7][c] = state_c->energy_smoother_coeff;
+    values[8][c] = state_c->noise_coeffs[0];
+    values[9][c] = state_c->noise_coeffs[1];
+    values[10][c] = state_c->gain_smoother_coeffs[0];
+    values[11][c] = state_c->gain_smoother_coeffs[1];
+    hold_counter[c] = state_c->hold_counter;
+    if (state_c->output_decimation > 1) { any_decimated = 1; }
+  }
+  const Float4 equalization = Float4Load(values[0]);
+  const Float4 gate_thresh_factor = Float4Load(values[1]);
+  const Float4 output_gain = Float4Load(values[2]);
+  Float4 smoothed_energy = Float4Load(values[3]);
+  /* The noise estimate, or during warm up, the sum of 2 * energy. */
+  Float4 noise_state = Float4Load(values[4]);
+  Float4 smoothed_gain = Float4Load(values[5]);
+  Float4 held_output = Float4Load(values[6]);
+  /* Coefficients after warm up, which account for output decimation. */
+  const Float4 channel_energy_smoother_coeff = Float4Load(values[7]);
+  const Float4 noise_coeffs[2] = {Float4Load(values[8]),
+                                  Float4Load(values[9])};
+  const Float4 channel_gain_smoother_coeffs[2] = {Float4Load(values[10]),
+                                                  Float4Load(values[11])};
+
+  float energies[kEnveloperNumChannels * kEnveloperChunkFrames];
+  int num_frames_left = num_samples / decimation_factor;
+
+  while (num_frames_left > 0) {
+    const int num_frames = (num_frames_left < kEnveloperChunkFrames)
+        ? num_frames_left : kEnveloperChunkFrames;
+    int i;
+    /* Skipped channels get zero energy, which doesn't affect the channels
+     * above them.
+     */
+    for (i = 0; i < num_frames; ++i) {
+      for (c = 0; c < first_active; ++c) {
+        energies[kEnveloperNumChannels * i + c] = 0.0f;
+      }
+    }
+    c = first_active;
+    if (c == 0 && multirate && state->baseband_decimation > 1) {
+      ComputeBasebandEnergiesMultirate(state, input, num_frames, energies);
+      c = 1;
+    }
+    const int num_computed = side_energy ? kEnveloperNumChannels - 1
+                                         : kEnveloperNumChannels;
+    for (; c < num_computed; ++c) {
+      if (input1) {
+        ComputeChannelEnergiesDualMic(state, c, input, input1, num_frames,
+                                      warm_up_counter, energies);
+      } else {
+        ComputeChannelEnergies(state, c, input, num_frames, energies);
+      }
+    }
+    if (side_energy) {
+      int i;
+      for (i = 0; i < num_frames; ++i) {
+        /* Clamp negative energy to zero, preserving NaN. */
+        const float energy = side_energy[i];
+        energies[kEnveloperNumChannels * i + c] =
+            (0.0f > energy) ? 0.0f : energy;
+      }
+      side_energy += num_frames;
+    }
 
-      float smoothed_energy = state_c->smoothed_energy;
-      float noise = state_c->noise;
-      float smoothed_gain = state_c->smoothed_gain;
+    for (i = 0; i < num_frames; ++i) {
+      const Float4 energy = Float4Load(energies + kEnveloperNumChannels * i);
+      const Float4 prev_smoothed_energy = smoothed_energy;
+      const Float4 prev_noise_state = noise_state;
+      const Float4 prev_smoothed_gain = smoothed_gain;
+      /* With output decimation, lanes where `update` is false hold their
+       * state and output, as in EnveloperProcessSamples().
+       */
+      const int use_update = any_decimated && !warm_up_counter;
+      Int4 update;
+      if (use_update) {
+        float hold[kEnveloperNumChannels];
+        for (c = 0; c < kEnveloperNumChannels; ++c) {
+          hold[c] = (c >= first_active && hold_counter[c]) ? 1.0f : 0.0f;
+        }
+        update = Float4LessThan(Float4Load(hold), Float4Broadcast(0.5f));
+      }
 
       /* Update PCEN denominator. */
-      smoothed_energy += energy_smoother_coeff * (
-          state_c->equalization * energy - smoothed_energy);
+      smoothed_energy = Float4Add(smoothed_energy, Float4Mul(
+          warm_up_counter ? energy_smoother_coeff
+                          : channel_energy_smoother_coeff,
+          Float4Sub(Float4Mul(equalization, energy), smoothed_energy)));
+      if (use_update) {
+        smoothed_energy =
+            Float4Select(update, smoothed_energy, prev_smoothed_energy);
+      }
 
-      if (prev_smoothed_energy > smoothed_energy) {
-        smoothed_energy = prev_smoothed_energy;
+      /* Couple channels so that each channel's smoothed energy is at least that
+       * of the channels above it, as EnveloperProcessSamples() does by
+       * iterating from the top channel down. This is a suffix max over the
+       * lanes, computed in two steps of shifting and maxing. Float4Max(a, b)
+       * is `(a > b) ? a : b`, matching the scalar comparison.
+       */
+      smoothed_energy = Float4Max(
+          Float4ShiftLanesDown(smoothed_energy, 0.0f), smoothed_energy);
+      smoothed_energy = Float4Max(
+          Float4ShiftLanesDown(Float4ShiftLanesDown(smoothed_energy, 0.0f),
+                               0.0f),
+          smoothed_energy);
+      if (use_update) {
+        smoothed_energy =
+            Float4Select(update, smoothed_energy, prev_smoothed_energy);
       }
-      prev_smoothed_energy = smoothed_energy;
 
+      Float4 noise;
       if (warm_up_counter) {  /* While warming up. */
-        /* When processing first starts up, we don't yet have a good estimate of
-         * the noise. During this "warm up" period, we compute `noise` to be the
-         * average of the `energy` samples seen so far, and multiplied by 2 to
-         * err on the side that the actual noise level might be somewhat higher.
-         */
-        noise += 2.0f * energy;  /* Sum up `energy`. */
-
-        /* Divide to get the average. */
-        const float average =
-            noise / (state->num_warm_up_samples - warm_up_counter + 1);
-        /* Store the average on the last warm up sample. Otherwise, store the
-         * unnormalized energy sum.
-         */
-        state_c->noise = (warm_up_counter == 1) ? average : noise;
-        noise = average;  /* Work with the average in the processing below. */
+        /* Sum up `energy`, and divide to get the average. */
+        noise_state = Float4Add(noise_state, Float4Mul(two, energy));
+        noise = Float4Div(noise_state, Float4Broadcast((float)(
+            state->num_warm_up_samples - warm_up_counter + 1)));
+        /* Store the average on the last warm up sample. */
+        if (warm_up_counter == 1) { noise_state = noise; }
       } else {  /* After warm up is done. */
         /* Update noise level estimate. */
-        noise *= state->noise_coeffs[smoothed_energy > noise];
-        state_c->noise = noise;
+        noise_state = Float4Mul(noise_state, Float4Select(
+            Float4LessThan(noise_state, smoothed_energy),
+            noise_coeffs[1], noise_coeffs[0]));
+        if (use_update) {
+          noise_state = Float4Select(update, noise_state, prev_noise_state);
+        }
+        noise = noise_state;
       }
 
-      if (noise < 1e-9f) { noise = 1e-9f; }
+      noise = Float4Max(min_noise, noise);
 
-      const float thresh = state_c->gate_thresh_factor * noise;
-      const float diff = smoothed_energy - thresh;
-      float gain;
-      if (diff <= 1e-9f) {
-        gain = 0.0f;  /* Gain of zero if smoothed_energy <= thresh. */
-      } else {
-        /* Apply soft noise gate and AGC gain. */
-        gain = SoftGate(diff, gate_transition_factor * thresh) *
-            FastPow(smoothed_energy, agc_exponent);
-      }
+      const Float4 thresh = Float4Mul(gate_thresh_factor, noise);
+      const Float4 diff = Float4Sub(smoothed_energy, thresh);
+      /* Apply soft noise gate and AGC gain, or gain of zero if
+       * smoothed_energy <= thresh.
+       */
+      const Float4 diff_sqr = Float4Mul(diff, diff);
+      const Float4 halfway_point = Float4Mul(gate_transition_factor, thresh);
+      const Float4 soft_gate = Float4Div(diff_sqr, Float4Add(
+          diff_sqr, Float4Mul(halfway_point, halfway_point)));
+      const Float4 gain = Float4Select(
+          Float4LessEqual(diff, min_diff), zero,
+          Float4Mul(soft_gate, EnveloperPowLanes(
+              use_fast_pow_table, &state->agc_pow_table, smoothed_energy,
+              agc_exponent)));
 
       /* Update smoothed AGC gain with asymmetric smoother. */
-      smoothed_gain += state->gain_smoother_coeffs[gain < smoothed_gain] *
-                       (gain - smoothed_gain);
-
-      state_c->smoothed_energy = smoothed_energy;
-      state_c->smoothed_gain = smoothed_gain;
+      const Float4* gain_coeffs = warm_up_counter
+          ? gain_smoother_coeffs : channel_gain_smoother_coeffs;
+      smoothed_gain = Float4Add(smoothed_gain, Float4Mul(
+          Float4Select(Float4LessThan(gain, smoothed_gain),
+                       gain_coeffs[1], gain_coeffs[0]),
+          Float4Sub(gain, smoothed_gain)));
 
       /* Apply power law compression and output gain. */
-      output[c] = state_c->output_gain *
-                  (FastPow(smoothed_gain * energy + compressor_delta,
-                           compressor_exponent)
-                   - kCompressorStabilization);
-    }
+      Float4 output4 = Float4Mul(output_gain, Float4Sub(
+          EnveloperPowLanes(use_fast_pow_table, &state->compressor_pow_table,
+                            Float4Add(Float4Mul(smoothed_gain, energy),
+                                      compressor_delta),
+                            compressor_exponent),
+          compressor_stabilization));
+      if (use_update) {
+        smoothed_gain = Float4Select(update, smoothed_gain, prev_smoothed_gain);
+        output4 = Float4Select(update, output4, held_output);
+      }
+      held_output = output4;
+      Float4Store(output, output4);
+      for (c = 0; c < first_active; ++c) {
+        output[c] = 0.0f;
+      }
+      if (!warm_up_counter) {
+        for (c = first_active; c < kEnveloperNumChannels; ++c) {
+          hold_counter[c] = hold_counter[c]
+              ? hold_counter[c] - 1
+              : state->channels[c].output_decimation - 1;
+        }
+      }
 
-    if (warm_up_counter) { --warm_up_counter; }
+      if (warm_up_counter) { --warm_up_counter; }
+      output += kEnveloperNumChannels;
+    }
 
-    output += kEnveloperNumChannels;
-    input += decimation_factor;
+    input += num_frames * decimation_factor;
+    if (input1) { input1 += num_frames * decimation_factor; }
+    num_frames_left -= num_frames;
   }
 
+  /* Scatter PCEN states back to the channels. */
+  Float4Store(values[3], smoothed_energy);
+  Float4Store(values[4], noise_state);
+  Float4Store(values[5], smoothed_gain);
+  Float4Store(values[6], held_output);
+  for (c = 0; c < kEnveloperNumChannels; ++c) {
+    EnveloperChannel* state_c = &state->channels[c];
+    state_c->smoothed_energy = values[3][c];
+    state_c->noise = values[4][c];
+    state_c->smoothed_gain = values[5][c];
+    if (c >= first_active) { state_c->held_output = values[6][c]; }
+    state_c->hold_counter = hold_counter[c];
+  }
   state->warm_up_counter = warm_up_counter;
+  DenormalGuardEnd(&guard);
+}
+
+void EnveloperProcessSamplesChannelMajor(Enveloper* state,
+                                         const float* input,
+                                         int num_samples,
+                                         float* output) {
+  ProcessSamplesChannelMajor(state, input, NULL, num_samples, 0, NULL,
+                             output);
+}
+
+void EnveloperProcessSamplesMultirate(Enveloper* state,
+                                      const float* input,
+                                      int num_samples,
+                                      float* output) {
+  ProcessSamplesChannelMajor(state, input, NULL, num_samples, 1, NULL,
+                             output);
+}
+
+void EnveloperProcessSamplesWithSideEnergy(Enveloper* state,
+                                           const float* input,
+                                           int num_samples,
+                                           const float* side_energy,
+                                           float* output) {
+  ProcessSamplesChannelMajor(state, input, NULL, num_samples, 0, side_energy,
+                             output);
+}
+
+void EnveloperProcessSamplesDualMic(Enveloper* state,
+                                    const float* input0,
+                                    const float* input1,
+                                    int num_samples,
+                                    float* output) {
+  ProcessSamplesChannelMajor(state, input0, input1, num_samples, 0, NULL,
+                             output);
 }
@@ -40,6 +40,9 @@
  *     c. A second order lowpass filter is applied to the energy.
  *     d. The lowpassed energy is decimated.
  *
+ *     Step 1 is computed for all four channels in parallel with 4-lane vector
+ *     operations (see dsp/simd.h).
+ *
  *   2. Soft noise gating. We want to normalize speech and salient sounds toward
  *      0 dB, yet we don't want to amplify noise. Our assumption is that the
  *      noise envelope changes slowly and that salient sounds are bursty and
@@ -84,6 +87,7 @@
 
 #include "dsp/biquad_filter.h"
 #include "dsp/decibels.h"
+#include "dsp/fast_fun.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -91,6 +95,8 @@ extern "C" {
 
 /* Number of bandpass channels. */
 #define kEnveloperNumChannels 4
+/* Max value of EnveloperChannelParams::output_decimation. */
+#define kEnveloperMaxOutputDecimation 16
 
 /* Parameters for one bandpass channel. */
 typedef struct {
@@ -106,6 +112,17 @@ typedef struct {
   float denoising_strength;
   /* The final output is multiplied by this gain. */
   float output_gain;
+  /* Output decimation factor, between 1 and kEnveloperMaxOutputDecimation.
+   * After warm up, the channel's noise gate, AGC, and compression are computed
+   * every `output_decimation` output frames, with smoothers adjusted for the
+   * reduced rate, and the output is held in between. This saves compute for
+   * slowly-varying channels like the baseband. The energy has ripple up to
+   * `energy_cutoff_hz`, so keep the update rate at least about 4x that, e.g.
+   * 2 kHz, to limit aliasing. Default is 1, no decimation.
+   * EnveloperProcessSamplesChannelMajor() and similar produce the same output,
+   * but compute all channels every frame. EnveloperFixed ignores this.
+   */
+  int output_decimation;
 } EnveloperChannelParams;
 
 typedef struct {
@@ -135,30 +152,96 @@ typedef struct {
   float gain_tau_release_s;
   /* Compression exponent in a memoryless nonlinearity, between 0.0 and 1.0. */
   float compressor_exponent;
+
+  /* If nonzero, the AGC and compressor power laws are computed with
+   * FastPowTable lookup tables for their exponents instead of FastPow(). This
+   * is about as fast, with max relative error about 1e-4 rather than 0.5%. The
+   * tables are regenerated when tuning changes the exponents.
+   */
+  int use_fast_pow_table;
+
+  /* If positive, the fricative channel's energy is not computed from the input
+   * but passed to EnveloperProcessSamplesWithSideEnergy(), having been computed
+   * by the sender at this sample rate. Its band may then be above the input
+   * Nyquist frequency, and its filters are designed at this rate. This is for
+   * input streamed at a reduced rate, see low_rate_stream.h. Default is 0.
+   */
+  float side_energy_sample_rate_hz;
 } EnveloperParams;
 extern const EnveloperParams kDefaultEnveloperParams;
 
 typedef struct {
-  /* Bandpass filter coefficients, represented as two second-order sections. */
+  /* Bandpass filter coefficients, represented as two second-order sections.
+   * This is the design; processing reads the copy in Enveloper::bpf_coeffs.
+   */
   BiquadFilterCoeffs bpf_biquad_coeffs[2];
   float peak;
   float equalization;
   float gate_thresh_factor;
   float output_gain;
 
-  BiquadFilterState bpf_biquad_state[2];
-  BiquadFilterState energy_biquad_state;
   float smoothed_energy;
   float noise;
   float smoothed_gain;
+
+  /* Output decimation, see EnveloperChannelParams. */
+  int output_decimation;
+  /* Coefficients for updating once per `output_decimation` frames, used after
+   * warm up. These equal Enveloper's coefficients if `output_decimation` is 1.
+   */
+  float energy_smoother_coeff;
+  float noise_coeffs[2];
+  float gain_smoother_coeffs[2];
+  /* Number of frames left to hold `held_output` before the next update. */
+  int hold_counter;
+  float held_output;
 } EnveloperChannel;
 
+/* State for EnveloperProcessSamplesDualMic(). Arrays are indexed by
+ * microphone m and channel c.
+ */
+typedef struct {
+  /* Bandpass filter states for the second microphone, biquad_z[k][i][c] as in
+   * Enveloper::biquad_z. The first microphone uses Enveloper::biquad_z.
+   */
+  float biquad_z[2][2][kEnveloperNumChannels];
+  /* Smoothed energy of each microphone's bandpassed signal. */
+  float energy[2][kEnveloperNumChannels];
+  /* Noise estimate of each microphone's bandpassed signal. */
+  float noise[2][kEnveloperNumChannels];
+  /* Mix weight of the second microphone in each channel, between 0 and 1. */
+  float weight[kEnveloperNumChannels];
+} EnveloperDualMic;
+
 /* Enveloper data and state variables. */
 typedef struct {
+  /* Hot filter data, read and written every input sample, laid out with the
+   * channel index last so that the four channels load as one Float4 and the
+   * whole filter bank spans a few consecutive cache lines at the start of the
+   * struct. bpf_coeffs[k][i][c] is coefficient i (b0, b1, b2, a1, a2) of
+   * bandpass section k of channel c. biquad_z[k][i][c] is state z[i] of biquad
+   * k of channel c, where k = 0 and 1 are the bandpass filter sections and
+   * k = 2 is the energy lowpass filter.
+   */
+  float bpf_coeffs[2][5][kEnveloperNumChannels];
+  float biquad_z[3][2][kEnveloperNumChannels];
+
   EnveloperChannel channels[kEnveloperNumChannels];
 
   /* Energy envelope smoothing coefficients. */
   BiquadFilterCoeffs energy_biquad_coeffs;
+
+  /* Multirate baseband for EnveloperProcessSamplesMultirate(). The baseband
+   * channel's filters run at input_sample_rate_hz / baseband_decimation, on a
+   * copy of the input decimated by a cascade of halfband filters with states
+   * halfband_z[stage], newest sample first. Filter states are kept in
+   * biquad_z[k][i][0] as usual.
+   */
+  int baseband_decimation;
+  BiquadFilterCoeffs baseband_bpf_biquad_coeffs[2];
+  BiquadFilterCoeffs baseband_energy_biquad_coeffs;
+  float halfband_z[2][5];
+
   /* Input sample rate in Hz. */
   float input_sample_rate_hz;
   /* Decimation factor after computing the energy envelope. */
@@ -173,6 +256,20 @@ typedef struct {
   float compressor_exponent;
   float compressor_delta;
   int warm_up_counter;
+  /* Channels below `first_active_channel` are skipped and output zero, see
+   * EnveloperSetActiveChannels().
+   */
+  int first_active_channel;
+
+  /* If nonzero, powers are computed with the tables below, for x^agc_exponent
+   * and x^compressor_exponent. Otherwise the tables are zero and unused.
+   */
+  int use_fast_pow_table;
+  FastPowTable agc_pow_table;
+  FastPowTable compressor_pow_table;
+
+  /* Dual microphone state, see EnveloperProcessSamplesDualMic(). */
+  EnveloperDualMic dual_mic;
 } Enveloper;
 
 /* Initialize state with the specified parameters. The output sample rate is
@@ -186,6 +283,19 @@ int EnveloperInit(Enveloper* state,
 /* Resets to initial state. */
 void EnveloperReset(Enveloper* state);
 
+/* Sets which channels are computed, where `active_channels` is a bit mask with
+ * bit c set if channel c is needed. Skipping channels saves their filters in
+ * the channel-major functions and their noise gating and compression in all
+ * functions. Each channel's smoothed energy is coupled to be at least that of
+ * the channels above it, so channels above a needed channel are needed as
+ * well: all channels from the lowest set bit up are computed, exactly as if
+ * all channels were, and channels below it output zero. If this enables any
+ * skipped channel, the Enveloper is reset, since the noise estimate of a
+ * restarted channel is only initialized by warming up. Initially all channels
+ * are active.
+ */
+void EnveloperSetActiveChannels(Enveloper* state, int active_channels);
+
 /* Process audio in a streaming manner. The `input` pointer should point to a
  * contiguous array of `num_samples` samples, where `num_samples` is a multiple
  * of `decimation_factor`. The output has `num_samples / decimation_factor` and
@@ -200,6 +310,120 @@ void EnveloperProcessSamples(Enveloper* state,
                              int num_samples,
                              float* output);
 
+/* Intermediate signals to record with EnveloperProcessSamplesWithTaps(). Each
+ * field is either NULL, in which case that signal isn't recorded, or points to
+ * an array where the signal is written in interleaved order with
+ * kEnveloperNumChannels channels.
+ */
+typedef struct {
+  /* Bandpass filter output, one frame per input sample, so the array has
+   * `num_samples * kEnveloperNumChannels` elements.
+   */
+  float* bandpassed;
+  /* The remaining signals have one frame per output frame, so the arrays have
+   * `num_samples / decimation_factor * kEnveloperNumChannels` elements, and
+   * are zero for skipped channels. `energy` is the lowpassed energy envelope,
+   * `smoothed_energy` the PCEN denominator, `noise` the noise estimate for the
+   * noise gate, and `gain` the smoothed AGC gain.
+   */
+  float* energy;
+  float* smoothed_energy;
+  float* noise;
+  float* gain;
+} EnveloperTaps;
+
+/* Same as EnveloperProcessSamples(), and additionally records the requested
+ * intermediate signals `taps` in the same pass. Recording is for analysis and
+ * debugging; EnveloperProcessSamples() is this function with `taps` NULL,
+ * where the recording code compiles away.
+ */
+void EnveloperProcessSamplesWithTaps(Enveloper* state,
+                                     const float* input,
+                                     int num_samples,
+                                     const EnveloperTaps* taps,
+                                     float* output);
+
+/* Alternative to EnveloperProcessSamples() with the same arguments and
+ * identical output, processing in channel-major order. The input is processed
+ * in chunks. For each chunk, each channel's bandpass and energy filters first
+ * run over the whole chunk with the filter state in local variables. Then the
+ * noise gate, PCEN, and compression run over the decimated frames with the
+ * channels in Float4 lanes. This is faster when Float4 is the portable
+ * fallback, e.g. on Cortex-M4F, where the filter states of all four channels
+ * don't fit in registers. With SSE or NEON, EnveloperProcessSamples() is
+ * faster since it runs the filters in SIMD lanes.
+ */
+void EnveloperProcessSamplesChannelMajor(Enveloper* state,
+                                         const float* input,
+                                         int num_samples,
+                                         float* output);
+
+/* Alternative to EnveloperProcessSamplesChannelMajor() with the same arguments,
+ * where the baseband channel runs at a reduced rate. Its 80-500 Hz band and
+ * 500 Hz energy lowpass don't need the full input rate, so the input is
+ * decimated by 2 or 4 with cheap 7-tap halfband filters and the baseband
+ * filters run at that rate. The decimation divides `decimation_factor`, so
+ * that the energy is still computed at the end of each output frame and the
+ * output lines up with that of the other functions. It is
+ * `state->baseband_decimation`, which is 1 if `decimation_factor` is odd, in
+ * which case the output is identical to ...ChannelMajor(). Otherwise the
+ * other channels are identical, and the baseband channel differs slightly,
+ * from the filter designs at a lower rate and up to 0.6 ms more delay.
+ *
+ * The other channels run at the full rate: the vowel band reaches 3.5 kHz,
+ * too close to the halved Nyquist frequency for a cheap halfband filter.
+ * Don't mix this with the other processing functions on the same Enveloper
+ * without calling EnveloperReset() in between.
+ */
+void EnveloperProcessSamplesMultirate(Enveloper* state,
+                                      const float* input,
+                                      int num_samples,
+                                      float* output);
+
+/* Alternative to EnveloperProcessSamplesChannelMajor() where the energy of the
+ * fricative channel, channel 3, is given by `side_energy` instead of computed
+ * from the input. `side_energy` has one value per output frame, the channel's
+ * lowpassed energy at the end of the frame, as computed by the sender from
+ * full-band audio at `params.side_energy_sample_rate_hz`. The other channels
+ * are identical to ...ChannelMajor(). This is the only processing function to
+ * use when `side_energy_sample_rate_hz` is set.
+ */
+void EnveloperProcessSamplesWithSideEnergy(Enveloper* state,
+                                           const float* input,
+                                           int num_samples,
+                                           const float* side_energy,
+                                           float* output);
+
+/* Alternative to EnveloperProcessSamplesChannelMajor() for two microphones.
+ * `input0` and `input1` are the two microphones' signals, each with
+ * `num_samples` samples. Both are bandpass filtered. The mixing is per
+ * channel, after the half-wave rectification and squaring:
+ *
+ *   rectified = (1 - weight) * rectified0 + weight * rectified1.
+ *
+ * The energy lowpass filter, noise gate, PCEN, and compression then run once
+ * on the mixed signal. So, compared to one microphone, only the bandpass
+ * filters are doubled. Mixing energies rather than signals avoids
+ * cancellation between the microphones' different phases.
+ *
+ * Each channel's weight is updated per output frame from the per-band SNRs of
+ * the microphones. SNR is a microphone's smoothed bandpassed energy over its
+ * noise estimate, tracked as in the noise gate. Then
+ *
+ *   weight = snr1^2 / (snr0^2 + snr1^2),
+ *
+ * so the channel mostly selects the cleaner microphone, and mixes them evenly
+ * when the SNRs are similar. The weight holds while neither SNR is above about
+ * 6 dB, e.g. during pauses and warm up. The current weights are in
+ * `state->dual_mic.weight`. If `input1` equals `input0`, the output is
+ * identical to the other processing functions.
+ */
+void EnveloperProcessSamplesDualMic(Enveloper* state,
+                                    const float* input0,
+                                    const float* input1,
+                                    int num_samples,
+                                    float* output);
+
 /* Computes the smoother coefficient for a one-pole lowpass filter with time
  * constant `tau_s` in units of seconds. The coefficient should be used as:
  *
@@ -221,6 +445,65 @@ static float EnveloperGrowthCoeff(const Enveloper* state, float growth_db_s) {
  */
 void EnveloperUpdatePrecomputedParams(Enveloper* state);
 
+/* The tunable Enveloper fields, as set by TactileProcessorApplyTuning(), along
+ * with the params precomputed from them. This is a separate block so that
+ * tuning can be computed away from the audio loop and then applied with a
+ * quick copy by EnveloperSetTuning().
+ */
+typedef struct {
+  float noise_coeffs[2];
+  float gate_transition_factor;
+  float agc_exponent;
+  float compressor_exponent;
+  float compressor_delta;
+  float gate_thresh_factor[kEnveloperNumChannels];
+  float output_gain[kEnveloperNumChannels];
+  float equalization[kEnveloperNumChannels];
+  /* Power law tables, if `use_fast_pow_table` is set. */
+  FastPowTable agc_pow_table;
+  FastPowTable compressor_pow_table;
+} EnveloperTuning;
+
+/* Flags for EnveloperUpdateTuning() indicating which fields have changed. */
+enum {
+  /* `noise_coeffs[1]` changed. */
+  kEnveloperTuningNoiseChanged = 1,
+  /* `agc_exponent` or `compressor_exponent` changed. */
+  kEnveloperTuningCompressorChanged = 2,
+  kEnveloperTuningAllChanged = 3
+};
+
+/* Gets the tunable fields of `state`. */
+void EnveloperGetTuning(const Enveloper* state, EnveloperTuning* tuning);
+
+/* Updates the precomputed fields in `tuning` that depend on the fields flagged
+ * in `changed_flags`, a bitwise OR of the flags above. Only `state`'s fixed
+ * params (sample rate, decimation, channel peaks) are read.
+ */
+void EnveloperUpdateTuning(const Enveloper* state, EnveloperTuning* tuning,
+                           int changed_flags);
+
+/* Sets the tunable fields of `state` from `tuning`. This is just a copy, cheap
+ * enough to call in the audio loop. Enveloper state is not reset.
+ */
+void EnveloperSetTuning(Enveloper* state, const EnveloperTuning* tuning);
+
+/* Number of floats in the Enveloper warm state. */
+#define kEnveloperWarmStateSize (3 * kEnveloperNumChannels)
+
+/* Gets the slowly-adapting "warm" state, the smoothed energy, noise estimate,
+ * and smoothed PCEN gain of each channel, as an array of
+ * kEnveloperWarmStateSize floats. This may be persisted and later restored
+ * with EnveloperSetWarmState() to skip warming up, e.g. after a reboot.
+ */
+void EnveloperGetWarmState(const Enveloper* state, float* warm_state);
+
+/* Restores warm state from EnveloperGetWarmState() and ends warm up. Filter
+ * states are not changed. Returns 1 on success, or 0 if `warm_state` has
+ * invalid values, in which case Enveloper is unchanged.
+ */
+int /*bool*/ EnveloperSetWarmState(Enveloper* state, const float* warm_state);
+
 #ifdef __cplusplus
 }  /* extern "C" */
 #endif
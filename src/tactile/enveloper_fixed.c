@@ -0,0 +1,351 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "tactile/enveloper_fixed.h"
+
+#include <math.h>
+#include <stdio.h>
+
+#include "dsp/fixed_point.h"
+#include "dsp/math_constants.h"
+
+/* Fixed-point formats of the signals. Bandpass filtering is done in Q29 to
+ * give a few bits of headroom over the Q15 input. The smoothed energy and gain
+ * have extra fractional bits so that the smoothers don't stall from rounding
+ * when the signal is small.
+ */
+#define kBpfFracBits 29
+#define kEnergyFracBits 30
+#define kSmoothedEnergyFracBits 36
+#define kGainFracBits 20
+/* Format of the product of gain and energy, computed as
+ * (gain >> kGainShift) * energy.
+ */
+#define kGainShift 4
+#define kAgcOutputFracBits (kGainFracBits - kGainShift + kEnergyFracBits)
+/* Format of smoother coefficients. */
+#define kCoeffFracBits 24
+/* Format of exponents, gains, and the equalization factor. */
+#define kParamFracBits 16
+
+/* Shorthand for log2 values in Q24. */
+#define kLog2One (INT32_C(1) << kFixedLog2FracBits)
+
+/* Enveloper's kCompressorStabilization = 0.125 in Q24. */
+static const int32_t kCompressorStabilization = INT32_C(1) << 21;
+/* Floor on the noise estimate, log2(1e-9) in Q24. */
+static const int32_t kLog2NoiseFloor = -501594347;
+/* Max AGC gain, 65536 in Q20. */
+static const int64_t kMaxGain = INT64_C(1) << 36;
+
+int EnveloperFixedInit(EnveloperFixed* state,
+                       const EnveloperParams* params,
+                       float input_sample_rate_hz,
+                       int decimation_factor) {
+  if (state == NULL || params == NULL) {
+    fprintf(stderr, "EnveloperFixedInit: Null argument.\n");
+    return 0;
+  }
+
+  /* Design in float, then convert to fixed point. */
+  Enveloper design;
+  if (!EnveloperInit(&design, params, input_sample_rate_hz,
+                     decimation_factor) ||
+      !EnveloperFixedSetParams(state, &design)) {
+    return 0;
+  }
+
+  EnveloperFixedReset(state);
+  return 1;
+}
+
+/* Converts a positive float value to log2 in Q24. */
+static int32_t Log2FromFloat(double x) {
+  return FixedFromFloat((float)(log(x) / M_LN2), kFixedLog2FracBits);
+}
+
+/* Computes the gain |H(e^jw)| of a biquad at the angle w of its poles, which
+ * for a resonant section is close to its peak gain. Returns 1 if the poles are
+ * real.
+ */
+static double GainAtPoleFrequency(const BiquadFilterCoeffs* coeffs) {
+  const double a1 = coeffs->a1;
+  const double a2 = coeffs->a2;
+  if (!(a2 > 0.0) || a1 * a1 >= 4.0 * a2) { return 1.0; }
+  const double cos_w = -a1 / (2.0 * sqrt(a2));
+  const double cos_2w = 2.0 * cos_w * cos_w - 1.0;
+  const double sin_w = sqrt(1.0 - cos_w * cos_w);
+  const double sin_2w = 2.0 * sin_w * cos_w;
+  /* Evaluate B(z) and A(z) at z^-1 = e^-jw. */
+  const double b_re = coeffs->b0 + coeffs->b1 * cos_w + coeffs->b2 * cos_2w;
+  const double b_im = coeffs->b1 * sin_w + coeffs->b2 * sin_2w;
+  const double a_re = 1.0 + a1 * cos_w + a2 * cos_2w;
+  const double a_im = a1 * sin_w + a2 * sin_2w;
+  return sqrt((b_re * b_re + b_im * b_im) / (a_re * a_re + a_im * a_im));
+}
+
+/* Converts the two bandpass sections to fixed point. Rounding error at the
+ * output of the first section is amplified by the second. With a narrow
+ * low-frequency band, e.g. 80 Hz at 44.1 kHz, the first section has a low peak
+ * gain below 0.001, so its output uses few bits of the Q29 format and the
+ * amplified rounding error is significant. So the gain is moved by a power of
+ * two from the second section to the first to make the first section's peak
+ * gain about 1.
+ */
+static int /*bool*/ ConvertBandpassFilter(
+    const BiquadFilterCoeffs* coeffs, BiquadFilterFixedCoeffs* fixed) {
+  BiquadFilterCoeffs balanced[2];
+  const double gain = GainAtPoleFrequency(&coeffs[0]);
+  const double scale = (gain > 0.0 && gain < 1.0)
+      ? ldexp(1.0, (int)floor(-log(gain) / M_LN2)) : 1.0;
+  int k;
+  balanced[0] = coeffs[0];
+  balanced[1] = coeffs[1];
+  balanced[0].b0 *= scale;
+  balanced[0].b1 *= scale;
+  balanced[0].b2 *= scale;
+  balanced[1].b0 /= scale;
+  balanced[1].b1 /= scale;
+  balanced[1].b2 /= scale;
+  for (k = 0; k < 2; ++k) {
+    if (!BiquadFilterFixedCoeffsFromFloat(&balanced[k], &fixed[k])) {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+int EnveloperFixedSetParams(EnveloperFixed* state, const Enveloper* design) {
+  if (!BiquadFilterFixedCoeffsFromFloat(&design->energy_biquad_coeffs,
+                                        &state->energy_biquad_coeffs)) {
+    fprintf(stderr, "EnveloperFixedSetParams: Unstable energy smoother.\n");
+    return 0;
+  }
+
+  int c;
+  for (c = 0; c < kEnveloperNumChannels; ++c) {
+    const EnveloperChannel* design_c = &design->channels[c];
+    EnveloperFixedChannel* state_c = &state->channels[c];
+    if (!ConvertBandpassFilter(design_c->bpf_biquad_coeffs,
+                               state_c->bpf_biquad_coeffs)) {
+      fprintf(stderr,
+              "EnveloperFixedSetParams: Unstable bandpass filter %d.\n", c);
+      return 0;
+    }
+
+    if (!(design_c->gate_thresh_factor > 0.0f)) {
+      fprintf(stderr, "EnveloperFixedSetParams: Invalid denoising_strength.\n");
+      return 0;
+    }
+    const float equalization = design_c->equalization * (1 << kParamFracBits);
+    state_c->equalization = (equalization < 4294967295.0f)
+        ? (uint32_t)(equalization + 0.5f) : UINT32_MAX;
+    state_c->log2_gate_thresh_factor =
+        Log2FromFloat(design_c->gate_thresh_factor);
+    state_c->output_gain =
+        FixedFromFloat(design_c->output_gain, kParamFracBits);
+  }
+
+  state->decimation_factor = design->decimation_factor;
+  state->num_warm_up_samples = design->num_warm_up_samples;
+  state->energy_smoother_coeff =
+      FixedFromFloat(design->energy_smoother_coeff, kCoeffFracBits);
+  state->log2_noise_coeffs[0] = Log2FromFloat(design->noise_coeffs[0]);
+  state->log2_noise_coeffs[1] = Log2FromFloat(design->noise_coeffs[1]);
+  state->log2_gate_transition_factor =
+      Log2FromFloat(design->gate_transition_factor);
+  state->agc_exponent = FixedFromFloat(design->agc_exponent, kParamFracBits);
+  state->gain_smoother_coeffs[0] =
+      FixedFromFloat(design->gain_smoother_coeffs[0], kCoeffFracBits);
+  state->gain_smoother_coeffs[1] =
+      FixedFromFloat(design->gain_smoother_coeffs[1], kCoeffFracBits);
+  state->compressor_exponent =
+      FixedFromFloat(design->compressor_exponent, kParamFracBits);
+  state->compressor_delta = (uint64_t)floor(
+      ldexp(design->compressor_delta, kAgcOutputFracBits) + 0.5);
+  return 1;
+}
+
+void EnveloperFixedReset(EnveloperFixed* state) {
+  int c;
+  for (c = 0; c < kEnveloperNumChannels; ++c) {
+    EnveloperFixedChannel* state_c = &state->channels[c];
+    BiquadFilterFixedInitZero(&state_c->bpf_biquad_state[0]);
+    BiquadFilterFixedInitZero(&state_c->bpf_biquad_state[1]);
+    BiquadFilterFixedInitZero(&state_c->energy_biquad_state);
+    state_c->smoothed_energy = 0;
+    state_c->log2_noise = kFixedLog2OfZero;
+    state_c->noise_sum = 0;
+    state_c->smoothed_gain = 0;
+  }
+
+  state->warm_up_counter = state->num_warm_up_samples;
+}
+
+/* Computes the bandpass energy of one channel for one decimated frame. */
+static int32_t ComputeEnergy(const EnveloperFixed* state,
+                             EnveloperFixedChannel* state_c,
+                             const int16_t* input) {
+  const int decimation_factor = state->decimation_factor;
+  int32_t energy = 0;
+  int j;
+  for (j = 0; j < decimation_factor; ++j) {
+    /* Apply bandpass filter. */
+    int32_t sample = BiquadFilterFixedProcessOneSample(
+        &state_c->bpf_biquad_coeffs[0], &state_c->bpf_biquad_state[0],
+        (int32_t)input[j] * (1 << (kBpfFracBits - 15)));
+    sample = BiquadFilterFixedProcessOneSample(
+        &state_c->bpf_biquad_coeffs[1], &state_c->bpf_biquad_state[1], sample);
+
+    /* Half-wave rectification and squaring. */
+    if (sample < 0) { sample = 0; }
+    const int32_t rectified = FixedSaturateInt32(
+        ((int64_t)sample * sample
+         + (INT64_C(1) << (2 * kBpfFracBits - kEnergyFracBits - 1)))
+        >> (2 * kBpfFracBits - kEnergyFracBits));
+
+    /* Lowpass filter the energy envelope. */
+    energy = BiquadFilterFixedProcessOneSample(
+        &state->energy_biquad_coeffs, &state_c->energy_biquad_state, rectified);
+  }
+
+  /* Clamp negative energy to zero. */
+  return (energy < 0) ? 0 : energy;
+}
+
+/* Updates a one-pole smoother `value += coeff * (target - value)`, with
+ * `coeff` in Q24.
+ */
+static int64_t SmootherUpdate(int64_t value, int64_t target, int32_t coeff) {
+  return value + ((coeff * (target - value) + (INT64_C(1) << 23)) >> 24);
+}
+
+void EnveloperFixedProcessSamples(EnveloperFixed* state,
+                                  const int16_t* input,
+                                  int num_samples,
+                                  int32_t* output) {
+  const int32_t energy_smoother_coeff = state->energy_smoother_coeff;
+  const int32_t log2_gate_transition_factor =
+      state->log2_gate_transition_factor;
+  const int32_t agc_exponent = state->agc_exponent;
+  const int32_t compressor_exponent = state->compressor_exponent;
+  const uint64_t compressor_delta = state->compressor_delta;
+  const int decimation_factor = state->decimation_factor;
+  int warm_up_counter = state->warm_up_counter;
+  int i;
+
+  for (i = decimation_factor - 1; i < num_samples; i += decimation_factor) {
+    int64_t prev_smoothed_energy = 0;
+    int c;
+
+    for (c = kEnveloperNumChannels - 1; c >= 0; --c) {
+      EnveloperFixedChannel* state_c = &state->channels[c];
+      const int32_t energy = ComputeEnergy(state, state_c, input);
+
+      /* Update PCEN denominator. */
+      const int64_t equalized_energy = (int64_t)(
+          ((uint64_t)state_c->equalization * (uint32_t)energy) >>
+          (kParamFracBits + kEnergyFracBits - kSmoothedEnergyFracBits));
+      int64_t smoothed_energy = SmootherUpdate(
+          state_c->smoothed_energy, equalized_energy, energy_smoother_coeff);
+
+      if (prev_smoothed_energy > smoothed_energy) {
+        smoothed_energy = prev_smoothed_energy;
+      }
+      prev_smoothed_energy = smoothed_energy;
+      state_c->smoothed_energy = smoothed_energy;
+
+      const int32_t log2_smoothed_energy = FixedLog2(smoothed_energy)
+          - kSmoothedEnergyFracBits * kLog2One;
+      int32_t log2_noise;
+
+      if (warm_up_counter) {  /* While warming up. */
+        /* As in Enveloper, the noise is twice the average energy so far. */
+        state_c->noise_sum += 2 * (uint64_t)energy;
+        log2_noise = FixedLog2(state_c->noise_sum)
+            - FixedLog2(state->num_warm_up_samples - warm_up_counter + 1)
+            - kEnergyFracBits * kLog2One;
+        state_c->log2_noise = log2_noise;
+      } else {  /* After warm up is done. */
+        /* Update noise level estimate. */
+        log2_noise = state_c->log2_noise + state->log2_noise_coeffs[
+            log2_smoothed_energy > state_c->log2_noise];
+        if (log2_noise < kFixedLog2OfZero) { log2_noise = kFixedLog2OfZero; }
+        state_c->log2_noise = log2_noise;
+      }
+
+      if (log2_noise < kLog2NoiseFloor) { log2_noise = kLog2NoiseFloor; }
+
+      const int32_t log2_thresh = state_c->log2_gate_thresh_factor + log2_noise;
+      const uint64_t thresh = FixedExp2(log2_thresh, kSmoothedEnergyFracBits);
+      const uint64_t diff = ((uint64_t)smoothed_energy > thresh)
+          ? (uint64_t)smoothed_energy - thresh : 0;
+      int64_t gain;
+      /* Gain of zero if smoothed_energy <= thresh + 1e-9. */
+      if (diff <= (1 << (kSmoothedEnergyFracBits - 30))) {
+        gain = 0;
+      } else {
+        /* Apply soft noise gate and AGC gain. The soft gate is
+         *
+         *   diff^2 / (diff^2 + (transition_factor * thresh)^2)
+         *   = 1 / (1 + r^2), r = transition_factor * thresh / diff,
+         *
+         * so in log2, the gain is
+         *
+         *   agc_exponent * log2(smoothed_energy) - log2(1 + r^2).
+         */
+        const int32_t log2_diff =
+            FixedLog2(diff) - kSmoothedEnergyFracBits * kLog2One;
+        const int32_t log2_r_sqr =
+            2 * (log2_gate_transition_factor + log2_thresh - log2_diff);
+        /* log2(1 + r^2) ~= log2(r^2) with error < 2^-15 when r^2 > 2^15. */
+        const int32_t log2_one_plus_r_sqr = (log2_r_sqr > 15 * kLog2One)
+            ? log2_r_sqr
+            : FixedLog2((UINT32_C(1) << 16) + FixedExp2(log2_r_sqr, 16))
+                - 16 * kLog2One;
+        const uint64_t unclamped_gain = FixedExp2(
+            FixedLog2Scale(log2_smoothed_energy, agc_exponent)
+            - log2_one_plus_r_sqr, kGainFracBits);
+        gain = (unclamped_gain < (uint64_t)kMaxGain)
+            ? (int64_t)unclamped_gain : kMaxGain;
+      }
+
+      /* Update smoothed AGC gain with asymmetric smoother. */
+      const int64_t smoothed_gain = SmootherUpdate(
+          state_c->smoothed_gain, gain,
+          state->gain_smoother_coeffs[gain < state_c->smoothed_gain]);
+      state_c->smoothed_gain = smoothed_gain;
+
+      /* Apply power law compression and output gain. */
+      const uint64_t agc_output =
+          (uint64_t)(smoothed_gain >> kGainShift) * (uint32_t)energy
+          + compressor_delta;
+      uint64_t compressed = FixedExp2(FixedLog2Scale(
+          FixedLog2(agc_output) - kAgcOutputFracBits * kLog2One,
+          compressor_exponent), kEnveloperFixedOutputFracBits);
+      if (compressed > ((uint64_t)1 << 40)) { compressed = (uint64_t)1 << 40; }
+      output[c] = FixedSaturateInt32(
+          ((int64_t)state_c->output_gain *
+           ((int64_t)compressed - kCompressorStabilization)) >> kParamFracBits);
+    }
+
+    if (warm_up_counter) { --warm_up_counter; }
+
+    output += kEnveloperNumChannels;
+    input += decimation_factor;
+  }
+
+  state->warm_up_counter = warm_up_counter;
+}
@@ -0,0 +1,151 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * Fixed-point Enveloper for microcontrollers without an FPU.
+ *
+ * EnveloperFixed computes the same processing as Enveloper (see enveloper.h),
+ * but EnveloperFixedProcessSamples() uses only integer arithmetic. Filters are
+ * fixed-point biquads with 32-bit coefficients (dsp/biquad_filter_fixed.h).
+ * The soft noise gate, AGC, and power law compressor are computed with
+ * FixedLog2() and FixedExp2() (dsp/fixed_point.h) in place of FastPow().
+ *
+ * Formats:
+ *  - Input audio is int16_t in Q15, i.e. 32768 represents 1.0.
+ *  - Output is int32_t in Q24, kEnveloperFixedOutputFracBits fractional bits,
+ *    in the same interleaved layout as Enveloper's float output.
+ *
+ * Parameters and tuning are the same as for Enveloper. EnveloperFixedInit()
+ * takes an EnveloperParams, and EnveloperFixedSetParams() copies the
+ * parameters of a float Enveloper, e.g. after changing its noise_coeffs,
+ * compressor params, or per-channel gains as TactileProcessorApplyTuning()
+ * does. These functions precompute coefficients in float, so on an FPU-less
+ * microcontroller they run with software float emulation, but only once.
+ *
+ * With background noise above about -55 dBFS, the output matches the float
+ * Enveloper to within 0.01 (absolute, where outputs are typically 0 to 5)
+ * after the warm up period. The main differences are:
+ *
+ *  - Energy resolution. Energies are in Q30, so with quieter background noise
+ *    (energies below about 1e-7), the noise estimate is less accurate than in
+ *    float, e.g. the error is about 0.02 with -65 dBFS noise.
+ *  - The AGC gain is saturated at 65536, which may happen when the noise
+ *    estimate is near zero and the energy is below about 1e-7.
+ *
+ * Example use:
+ *   EnveloperFixed enveloper;
+ *   EnveloperFixedInit(&enveloper, &kDefaultEnveloperParams,
+ *                      input_sample_rate_hz, decimation_factor);
+ *
+ *   // Processing loop.
+ *   const int kNumSamples = 64;
+ *   const int kOutputFrames = kNumSamples / decimation_factor;
+ *   while (...) {
+ *     int16_t input[kNumSamples] = ...
+ *     int32_t output[kOutputFrames * kEnveloperNumChannels];
+ *     EnveloperFixedProcessSamples(&enveloper, input, kNumSamples, output);
+ *     ...
+ *   }
+ */
+
+#ifndef AUDIO_TO_TACTILE_SRC_TACTILE_ENVELOPER_FIXED_H_
+#define AUDIO_TO_TACTILE_SRC_TACTILE_ENVELOPER_FIXED_H_
+
+#include <stdint.h>
+
+#include "dsp/biquad_filter_fixed.h"
+#include "tactile/enveloper.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Number of fractional bits in EnveloperFixed output. */
+#define kEnveloperFixedOutputFracBits 24
+
+typedef struct {
+  /* Bandpass filter coefficients, represented as two second-order sections. */
+  BiquadFilterFixedCoeffs bpf_biquad_coeffs[2];
+  /* Energy equalization factor in Q16. */
+  uint32_t equalization;
+  /* log2(gate_thresh_factor) in Q24. */
+  int32_t log2_gate_thresh_factor;
+  /* Output gain in Q16. */
+  int32_t output_gain;
+
+  BiquadFilterFixedState bpf_biquad_state[2];
+  BiquadFilterFixedState energy_biquad_state;
+  /* Smoothed energy in Q36. */
+  int64_t smoothed_energy;
+  /* log2 of the noise estimate in Q24. */
+  int32_t log2_noise;
+  /* Sum of 2 * energy in Q30 over the warm up period. */
+  uint64_t noise_sum;
+  /* Smoothed AGC gain in Q20. */
+  int64_t smoothed_gain;
+} EnveloperFixedChannel;
+
+typedef struct {
+  EnveloperFixedChannel channels[kEnveloperNumChannels];
+
+  /* Energy envelope smoothing coefficients. */
+  BiquadFilterFixedCoeffs energy_biquad_coeffs;
+  /* Decimation factor after computing the energy envelope. */
+  int decimation_factor;
+  int num_warm_up_samples;
+
+  /* Smoother coefficients are in Q24, and other values as noted. */
+  int32_t energy_smoother_coeff;
+  int32_t log2_noise_coeffs[2];  /* log2(Enveloper noise_coeffs) in Q24. */
+  int32_t log2_gate_transition_factor;  /* Q24. */
+  int32_t agc_exponent;  /* Q16. */
+  int32_t gain_smoother_coeffs[2];  /* [0] = attack coeff, [1] = release. */
+  int32_t compressor_exponent;  /* Q16. */
+  uint64_t compressor_delta;  /* Q46. */
+  int warm_up_counter;
+} EnveloperFixed;
+
+/* Initializes with the specified parameters. The output sample rate is
+ * input_sample_rate_hz / decimation_factor. Returns 1 on success, 0 on failure.
+ */
+int /*bool*/ EnveloperFixedInit(EnveloperFixed* state,
+                                const EnveloperParams* params,
+                                float input_sample_rate_hz,
+                                int decimation_factor);
+
+/* Sets parameters from an initialized float Enveloper `design`, converting
+ * them to fixed point. Filter states are not modified. Returns 1 on success, 0
+ * on failure.
+ */
+int /*bool*/ EnveloperFixedSetParams(EnveloperFixed* state,
+                                     const Enveloper* design);
+
+/* Resets to initial state. */
+void EnveloperFixedReset(EnveloperFixed* state);
+
+/* Process audio in a streaming manner, like EnveloperProcessSamples(). The
+ * `input` pointer should point to a contiguous array of `num_samples` Q15
+ * samples, where `num_samples` is a multiple of `decimation_factor`. The output
+ * has `num_samples / decimation_factor` frames and `kEnveloperNumChannels`
+ * channels in Q24, written in interleaved order.
+ */
+void EnveloperFixedProcessSamples(EnveloperFixed* state,
+                                  const int16_t* input,
+                                  int num_samples,
+                                  int32_t* output);
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif
+#endif /* AUDIO_TO_TACTILE_SRC_TACTILE_ENVELOPER_FIXED_H_ */
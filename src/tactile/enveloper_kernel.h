@@ -0,0 +1,335 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * Inline implementation of EnveloperProcessSamples().
+ *
+ * EnveloperProcessSamplesKernel() takes the decimation factor and number of
+ * samples as arguments, so that a caller passing compile-time constants gets a
+ * specialized copy where the per-sample decimation loop has a known trip count
+ * and can be fully unrolled. TactileProcessorT in cpp/tactile_processor_t.h
+ * uses this. Most code should call EnveloperProcessSamples() instead. Passing
+ * `taps` as NULL likewise compiles away the recording of intermediate signals.
+ *
+ * NOTE: Functions below are marked `static` [the C analogy for `inline`] so
+ * that ideally they get inline expanded.
+ */
+
+#ifndef AUDIO_TO_TACTILE_SRC_TACTILE_ENVELOPER_KERNEL_H_
+#define AUDIO_TO_TACTILE_SRC_TACTILE_ENVELOPER_KERNEL_H_
+
+#include "dsp/denormals.h"
+#include "dsp/fast_fun.h"
+#include "dsp/simd.h"
+#include "tactile/enveloper.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Offset subtracted after power law compression, so that the output is zero
+ * for zero input.
+ */
+#define kEnveloperCompressorStabilization 0.125f
+
+
+/* Smooth gate function `x^2 / (x^2 + halfway_point^2)`. The function behaves
+ * like `x^2 / halfway_point^2` for x near zero, is equal to 1/2 at
+ * x = halfway_point, and is asymptotically 1 as x -> infinity.
+ */
+static float EnveloperSoftGate(float x, float halfway_point) {
+  const float x_sqr = x * x;
+  return x_sqr / (x_sqr + halfway_point * halfway_point);
+}
+
+/* Computes x^y, where y is the AGC or compressor exponent and `table` is the
+ * corresponding FastPowTable, with the table if `use_table` is nonzero or with
+ * FastPow() otherwise.
+ */
+static float EnveloperPow(int use_table, const FastPowTable* table,
+                          float x, float y) {
+  return use_table ? FastPowTableEval(table, x) : FastPow(x, y);
+}
+
+/* Biquad filter coefficients with the four channels in the four lanes. */
+typedef struct {
+  Float4 b0;
+  Float4 b1;
+  Float4 b2;
+  Float4 a1;
+  Float4 a2;
+} EnveloperBiquadCoeffs4;
+
+/* Loads bandpass filter section `k` coefficients of all channels. */
+static void EnveloperLoadBpfCoeffs(const Enveloper* state, int k,
+                                   EnveloperBiquadCoeffs4* coeffs) {
+  coeffs->b0 = Float4Load(state->bpf_coeffs[k][0]);
+  coeffs->b1 = Float4Load(state->bpf_coeffs[k][1]);
+  coeffs->b2 = Float4Load(state->bpf_coeffs[k][2]);
+  coeffs->a1 = Float4Load(state->bpf_coeffs[k][3]);
+  coeffs->a2 = Float4Load(state->bpf_coeffs[k][4]);
+}
+
+/* Loads the `k`th biquad state of all channels into `z`. */
+static void EnveloperLoadBiquadState(const Enveloper* state, int k,
+                                     Float4 z[2]) {
+  z[0] = Float4Load(state->biquad_z[k][0]);
+  z[1] = Float4Load(state->biquad_z[k][1]);
+}
+
+/* Stores `z` back to the `k`th biquad state of all channels. */
+static void EnveloperStoreBiquadState(Enveloper* state, int k,
+                                      const Float4 z[2]) {
+  Float4Store(state->biquad_z[k][0], z[0]);
+  Float4Store(state->biquad_z[k][1], z[1]);
+}
+
+/* Processes one sample through four biquads in parallel. This does the same
+ * arithmetic as BiquadFilterProcessOneSample in each lane.
+ */
+static Float4 EnveloperBiquadProcessOneSample4(
+    const EnveloperBiquadCoeffs4* coeffs, Float4 z[2], Float4 input_sample) {
+  const Float4 next_state = Float4Sub(
+      Float4Sub(input_sample, Float4Mul(coeffs->a1, z[0])),
+      Float4Mul(coeffs->a2, z[1]));
+  const Float4 output_sample = Float4Add(
+      Float4Add(Float4Mul(coeffs->b0, next_state), Float4Mul(coeffs->b1, z[0])),
+      Float4Mul(coeffs->b2, z[1]));
+  z[1] = z[0];
+  z[0] = next_state;
+  return output_sample;
+}
+
+/* Implementation of EnveloperProcessSamplesWithTaps(), with `decimation_factor`
+ * passed as an argument. It must equal `state->decimation_factor`. `taps` may
+ * be NULL to record nothing.
+ */
+static void EnveloperProcessSamplesKernel(Enveloper* state,
+                                          const float* input,
+                                          int num_samples,
+                                          int decimation_factor,
+                                          const EnveloperTaps* taps,
+                                          float* output) {
+  const float energy_smoother_coeff = state->energy_smoother_coeff;
+  const float gate_transition_factor = state->gate_transition_factor;
+  const float agc_exponent = state->agc_exponent;
+  const float compressor_exponent = state->compressor_exponent;
+  const int use_fast_pow_table = state->use_fast_pow_table;
+  const float compressor_delta = state->compressor_delta;
+  const int first_active = state->first_active_channel;
+  int warm_up_counter = state->warm_up_counter;
+  /* Write positions of the requested taps, or NULL if not requested. */
+  float* tap_bandpassed = taps ? taps->bandpassed : NULL;
+  float* tap_energy = taps ? taps->energy : NULL;
+  float* tap_smoothed_energy = taps ? taps->smoothed_energy : NULL;
+  float* tap_noise = taps ? taps->noise : NULL;
+  float* tap_gain = taps ? taps->gain : NULL;
+  int i;
+  if (first_active == kEnveloperNumChannels) {  /* All channels skipped. */
+    const int output_size =
+        kEnveloperNumChannels * (num_samples / decimation_factor);
+    for (i = 0; i < output_size; ++i) {
+      output[i] = 0.0f;
+      if (tap_energy) { tap_energy[i] = 0.0f; }
+      if (tap_smoothed_energy) { tap_smoothed_energy[i] = 0.0f; }
+      if (tap_noise) { tap_noise[i] = 0.0f; }
+      if (tap_gain) { tap_gain[i] = 0.0f; }
+    }
+    if (tap_bandpassed) {
+      for (i = 0; i < decimation_factor * output_size; ++i) {
+        tap_bandpassed[i] = 0.0f;
+      }
+    }
+    return;
+  }
+  DenormalGuard guard;
+  DenormalGuardBegin(&guard);
+  DenormalsDither(&state->biquad_z[0][0][0],
+                  sizeof(state->biquad_z) / sizeof(float));
+
+  /* The bandpass energy computation runs the four channels in parallel as
+   * 4-lane vector operations, with channel c in lane c.
+   */
+  EnveloperBiquadCoeffs4 bpf_coeffs[2];
+  EnveloperLoadBpfCoeffs(state, 0, &bpf_coeffs[0]);
+  EnveloperLoadBpfCoeffs(state, 1, &bpf_coeffs[1]);
+  EnveloperBiquadCoeffs4 energy_coeffs;
+  energy_coeffs.b0 = Float4Broadcast(state->energy_biquad_coeffs.b0);
+  energy_coeffs.b1 = Float4Broadcast(state->energy_biquad_coeffs.b1);
+  energy_coeffs.b2 = Float4Broadcast(state->energy_biquad_coeffs.b2);
+  energy_coeffs.a1 = Float4Broadcast(state->energy_biquad_coeffs.a1);
+  energy_coeffs.a2 = Float4Broadcast(state->energy_biquad_coeffs.a2);
+  Float4 bpf_z[2][2];
+  Float4 energy_z[2];
+  EnveloperLoadBiquadState(state, 0, bpf_z[0]);
+  EnveloperLoadBiquadState(state, 1, bpf_z[1]);
+  EnveloperLoadBiquadState(state, 2, energy_z);
+  const Float4 zero = Float4Broadcast(0.0f);
+
+  for (i = decimation_factor - 1; i < num_samples; i += decimation_factor) {
+    float prev_smoothed_energy = 0.0f;
+    Float4 energy4 = zero;
+    float energies[kEnveloperNumChannels];
+    int c;
+
+    int j;
+    for (j = 0; j < decimation_factor; ++j) {
+      /* Apply bandpass filter. */
+      Float4 sample = EnveloperBiquadProcessOneSample4(
+          &bpf_coeffs[0], bpf_z[0], Float4Broadcast(input[j]));
+      sample = EnveloperBiquadProcessOneSample4(
+          &bpf_coeffs[1], bpf_z[1], sample);
+      if (tap_bandpassed) {
+        Float4Store(tap_bandpassed, sample);
+        tap_bandpassed += kEnveloperNumChannels;
+      }
+
+      /* Half-wave rectification and squaring. */
+      sample = Float4Max(sample, zero);  /* Maps NaN to zero. */
+      const Float4 rectified = Float4Mul(sample, sample);
+
+      /* Lowpass filter the energy envelope. */
+      energy4 = EnveloperBiquadProcessOneSample4(
+          &energy_coeffs, energy_z, rectified);
+    }
+
+    /* Clamp negative energy to zero. Argument order is so that, like a scalar
+     * `if (energy < 0.0f) { energy = 0.0f; }`, NaN is preserved.
+     */
+    Float4Store(energies, Float4Max(zero, energy4));
+
+    for (c = kEnveloperNumChannels - 1; c >= first_active; --c) {
+      EnveloperChannel* state_c = &state->channels[c];
+      const float energy = energies[c];
+
+      float smoothed_energy = state_c->smoothed_energy;
+      float noise = state_c->noise;
+      float smoothed_gain = state_c->smoothed_gain;
+
+      if (!warm_up_counter && state_c->hold_counter) {
+        /* Hold the output of a decimated channel. */
+        --state_c->hold_counter;
+        if (prev_smoothed_energy < smoothed_energy) {
+          prev_smoothed_energy = smoothed_energy;
+        }
+        output[c] = state_c->held_output;
+        if (tap_energy) { tap_energy[c] = energy; }
+        if (tap_smoothed_energy) { tap_smoothed_energy[c] = smoothed_energy; }
+        if (tap_noise) { tap_noise[c] = (noise < 1e-9f) ? 1e-9f : noise; }
+        if (tap_gain) { tap_gain[c] = smoothed_gain; }
+        continue;
+      }
+      /* After warm up, the channel's coefficients account for decimation. */
+      const float smoother_coeff = warm_up_counter
+          ? energy_smoother_coeff : state_c->energy_smoother_coeff;
+      const float* gain_smoother_coeffs = warm_up_counter
+          ? state->gain_smoother_coeffs : state_c->gain_smoother_coeffs;
+      if (!warm_up_counter) {
+        state_c->hold_counter = state_c->output_decimation - 1;
+      }
+
+      /* Update PCEN denominator. */
+      smoothed_energy += smoother_coeff * (
+          state_c->equalization * energy - smoothed_energy);
+
+      if (prev_smoothed_energy > smoothed_energy) {
+        smoothed_energy = prev_smoothed_energy;
+      }
+      prev_smoothed_energy = smoothed_energy;
+
+      if (warm_up_counter) {  /* While warming up. */
+        /* When processing first starts up, we don't yet have a good estimate of
+         * the noise. During this "warm up" period, we compute `noise` to be the
+         * average of the `energy` samples seen so far, and multiplied by 2 to
+         * err on the side that the actual noise level might be somewhat higher.
+         */
+        noise += 2.0f * energy;  /* Sum up `energy`. */
+
+        /* Divide to get the average. */
+        const float average =
+            noise / (state->num_warm_up_samples - warm_up_counter + 1);
+        /* Store the average on the last warm up sample. Otherwise, store the
+         * unnormalized energy sum.
+         */
+        state_c->noise = (warm_up_counter == 1) ? average : noise;
+        noise = average;  /* Work with the average in the processing below. */
+      } else {  /* After warm up is done. */
+        /* Update noise level estimate. */
+        noise *= state_c->noise_coeffs[smoothed_energy > noise];
+        state_c->noise = noise;
+      }
+
+      if (noise < 1e-9f) { noise = 1e-9f; }
+      if (tap_noise) { tap_noise[c] = noise; }
+
+      const float thresh = state_c->gate_thresh_factor * noise;
+      const float diff = smoothed_energy - thresh;
+      float gain;
+      if (diff <= 1e-9f) {
+        gain = 0.0f;  /* Gain of zero if smoothed_energy <= thresh. */
+      } else {
+        /* Apply soft noise gate and AGC gain. */
+        gain = EnveloperSoftGate(diff, gate_transition_factor * thresh) *
+            EnveloperPow(use_fast_pow_table, &state->agc_pow_table,
+                         smoothed_energy, agc_exponent);
+      }
+
+      /* Update smoothed AGC gain with asymmetric smoother. */
+      smoothed_gain += gain_smoother_coeffs[gain < smoothed_gain] *
+                       (gain - smoothed_gain);
+
+      state_c->smoothed_energy = smoothed_energy;
+      state_c->smoothed_gain = smoothed_gain;
+      if (tap_energy) { tap_energy[c] = energy; }
+      if (tap_smoothed_energy) { tap_smoothed_energy[c] = smoothed_energy; }
+      if (tap_gain) { tap_gain[c] = smoothed_gain; }
+
+      /* Apply power law compression and output gain. */
+      output[c] = state_c->output_gain *
+                  (EnveloperPow(use_fast_pow_table,
+                                &state->compressor_pow_table,
+                                smoothed_gain * energy + compressor_delta,
+                                compressor_exponent)
+                   - kEnveloperCompressorStabilization);
+      state_c->held_output = output[c];
+    }
+    for (; c >= 0; --c) {  /* Skipped channels output zero. */
+      output[c] = 0.0f;
+      if (tap_energy) { tap_energy[c] = 0.0f; }
+      if (tap_smoothed_energy) { tap_smoothed_energy[c] = 0.0f; }
+      if (tap_noise) { tap_noise[c] = 0.0f; }
+      if (tap_gain) { tap_gain[c] = 0.0f; }
+    }
+
+    if (warm_up_counter) { --warm_up_counter; }
+
+    output += kEnveloperNumChannels;
+    input += decimation_factor;
+    if (tap_energy) { tap_energy += kEnveloperNumChannels; }
+    if (tap_smoothed_energy) { tap_smoothed_energy += kEnveloperNumChannels; }
+    if (tap_noise) { tap_noise += kEnveloperNumChannels; }
+    if (tap_gain) { tap_gain += kEnveloperNumChannels; }
+  }
+
+  EnveloperStoreBiquadState(state, 0, bpf_z[0]);
+  EnveloperStoreBiquadState(state, 1, bpf_z[1]);
+  EnveloperStoreBiquadState(state, 2, energy_z);
+  state->warm_up_counter = warm_up_counter;
+  DenormalGuardEnd(&guard);
+}
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif
+#endif /* AUDIO_TO_TACTILE_SRC_TACTILE_ENVELOPER_KERNEL_H_ */
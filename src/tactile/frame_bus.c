@@ -0,0 +1,62 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "tactile/frame_bus.h"
+
+#include <stdio.h>
+
+int /*bool*/ FrameBusInit(FrameBus* bus, float* storage, int frame_size) {
+  if (bus == NULL || storage == NULL) {
+    return 0;
+  } else if (frame_size <= 0) {
+    fprintf(stderr, "Error: FrameBus frame_size must be positive.\n");
+    return 0;
+  }
+
+  bus->frames = storage;
+  bus->frame_size = frame_size;
+  bus->num_published = 0;
+  return 1;
+}
+
+/* Gets the frame with index `index`, which must be one of the last
+ * kFrameBusNumSlots - 1 published.
+ */
+static const float* GetFrame(const FrameBus* bus, uint32_t index) {
+  return bus->frames + bus->frame_size *
+      (int)(index & (kFrameBusNumSlots - 1));
+}
+
+const float* FrameBusLatest(const FrameBus* bus) {
+  return bus->num_published ? GetFrame(bus, bus->num_published - 1) : NULL;
+}
+
+void FrameBusSubscribe(const FrameBus* bus, FrameBusReader* reader) {
+  reader->next = bus->num_published;
+  reader->num_dropped = 0;
+}
+
+const float* FrameBusRead(const FrameBus* bus, FrameBusReader* reader) {
+  /* Unsigned subtraction counts correctly across wraparound. */
+  const uint32_t num_unread = bus->num_published - reader->next;
+  if (num_unread == 0) { return NULL; }
+  if (num_unread > kFrameBusNumSlots - 1) {
+    /* Skip to the oldest frame that hasn't been written over. */
+    const uint32_t num_skipped = num_unread - (kFrameBusNumSlots - 1);
+    reader->next += num_skipped;
+    reader->num_dropped += num_skipped;
+  }
+  return GetFrame(bus, reader->next++);
+}
@@ -0,0 +1,111 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * Frame bus, sharing CARL+PCEN frames among several consumers.
+ *
+ * TactileProcessor runs a CarlFrontend for the vowel embedding, producing one
+ * CARL+PCEN frame per block. Other consumers of such frames, like a streaming
+ * phoneme classifier (ClassifyPhonemeStreamer) or tap_out capture, may
+ * subscribe to the processor's FrameBus instead of running a second
+ * CarlFrontend, so that the filterbank is computed once.
+ *
+ * The bus is a ring of the most recent kFrameBusNumSlots frames. The producer
+ * gets the slot for the next frame with `FrameBusNextSlot()`, writes the frame
+ * there, e.g. as the output of CarlFrontendProcessSamples() so that there is
+ * no copy, and then calls `FrameBusPublish()`. Each consumer holds a
+ * FrameBusReader cursor and reads frames in order with `FrameBusRead()`. A
+ * consumer that falls behind by more than kFrameBusNumSlots - 1 frames skips
+ * ahead to the oldest frame still held, counting the skipped frames in
+ * `num_dropped`.
+ *
+ * The producer and consumers should run on the same thread, e.g. reading
+ * frames after each TactileProcessorProcessSamples() call.
+ *
+ * Example use:
+ *   FrameBusReader reader;
+ *   FrameBusSubscribe(&processor->frame_bus, &reader);
+ *
+ *   // Once per block.
+ *   TactileProcessorProcessSamples(processor, input, output);
+ *   const float* frame;
+ *   while ((frame = FrameBusRead(&processor->frame_bus, &reader))) {
+ *     ClassifyPhonemeStreamerProcessFrame(&streamer, frame, &labels, NULL);
+ *   }
+ */
+
+#ifndef AUDIO_TO_TACTILE_SRC_TACTILE_FRAME_BUS_H_
+#define AUDIO_TO_TACTILE_SRC_TACTILE_FRAME_BUS_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Number of frames held in the ring. Must be a power of 2. */
+#define kFrameBusNumSlots 8
+
+typedef struct {
+  /* Storage for kFrameBusNumSlots frames of `frame_size` floats. */
+  float* frames;
+  /* Number of floats per frame. */
+  int frame_size;
+  /* Number of frames published so far, modulo 2^32. */
+  uint32_t num_published;
+} FrameBus;
+
+/* Consumer cursor on a FrameBus. */
+typedef struct {
+  /* Index of the next frame to read, in units of published frames. */
+  uint32_t next;
+  /* Number of frames skipped because the consumer fell behind. */
+  uint32_t num_dropped;
+} FrameBusReader;
+
+/* Initializes `bus` with caller-provided `storage` for
+ * `kFrameBusNumSlots * frame_size` floats, which must outlive the bus. Returns
+ * 1 on success, 0 on failure.
+ */
+int /*bool*/ FrameBusInit(FrameBus* bus, float* storage, int frame_size);
+
+/* Producer: Gets the slot where the next frame should be written. The slot
+ * holds the oldest frame, which is no longer readable once written over.
+ */
+static float* FrameBusNextSlot(FrameBus* bus) {
+  return bus->frames + bus->frame_size *
+      (int)(bus->num_published & (kFrameBusNumSlots - 1));
+}
+
+/* Producer: Publishes the frame written to `FrameBusNextSlot()`. */
+static void FrameBusPublish(FrameBus* bus) { ++bus->num_published; }
+
+/* Gets the most recently published frame, or NULL if there is none. */
+const float* FrameBusLatest(const FrameBus* bus);
+
+/* Consumer: Subscribes `reader` to `bus`, starting from the next frame to be
+ * published.
+ */
+void FrameBusSubscribe(const FrameBus* bus, FrameBusReader* reader);
+
+/* Consumer: Gets the next unread frame and advances `reader`, or returns NULL
+ * if the reader is caught up. The returned pointer is valid until the
+ * producer writes another kFrameBusNumSlots - 1 frames.
+ */
+const float* FrameBusRead(const FrameBus* bus, FrameBusReader* reader);
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif
+#endif /* AUDIO_TO_TACTILE_SRC_TACTILE_FRAME_BUS_H_ */
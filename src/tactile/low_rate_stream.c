@@ -0,0 +1,165 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "tactile/low_rate_stream.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "dsp/aligned_alloc.h"
+#include "dsp/butterworth.h"
+
+/* Energy coded as 1, the smallest nonzero code. */
+#define kMinEnergy 1e-10f
+/* Number of codes per factor of 10 in energy. */
+#define kCodesPerDecade 24
+
+LowRateStreamEncoder* LowRateStreamEncoderMake(const EnveloperParams* params,
+                                               float input_sample_rate_hz,
+                                               int max_input_frames) {
+  if (params == NULL || !(input_sample_rate_hz > 0.0f) ||
+      !(max_input_frames > 0)) {
+    fprintf(stderr, "LowRateStreamEncoderMake: Invalid arguments.\n");
+    return NULL;
+  }
+
+  LowRateStreamEncoder* encoder =
+      (LowRateStreamEncoder*)AlignedAlloc(sizeof(LowRateStreamEncoder));
+  if (encoder == NULL) { return NULL; }
+
+  const EnveloperChannelParams* fricative_params =
+      &params->channel_params[kEnveloperNumChannels - 1];
+  encoder->resampler = QResamplerMake(
+      input_sample_rate_hz, input_sample_rate_hz / kLowRateStreamDecimation,
+      1, max_input_frames, NULL);
+  if (encoder->resampler == NULL ||
+      !DesignButterworthOrder2Bandpass(
+          fricative_params->bpf_low_edge_hz, fricative_params->bpf_high_edge_hz,
+          input_sample_rate_hz, encoder->bpf_biquad_coeffs) ||
+      !DesignButterworthOrder2Lowpass(params->energy_cutoff_hz,
+                                      input_sample_rate_hz,
+                                      &encoder->energy_biquad_coeffs)) {
+    fprintf(stderr, "LowRateStreamEncoderMake: Failed to design filters.\n");
+    LowRateStreamEncoderFree(encoder);
+    return NULL;
+  }
+
+  LowRateStreamEncoderReset(encoder);
+  return encoder;
+}
+
+void LowRateStreamEncoderFree(LowRateStreamEncoder* encoder) {
+  if (encoder) {
+    QResamplerFree(encoder->resampler);
+    AlignedFree(encoder);
+  }
+}
+
+void LowRateStreamEncoderReset(LowRateStreamEncoder* encoder) {
+  QResamplerReset(encoder->resampler);
+  memset(encoder->biquad_z, 0, sizeof(encoder->biquad_z));
+}
+
+void LowRateStreamEncode(LowRateStreamEncoder* encoder, const float* input,
+                         int num_input_frames, float* audio, uint8_t* codes) {
+  const int group_size = kLowRateStreamDecimation * kLowRateStreamCodeStride;
+  const int num_codes = num_input_frames / group_size;
+  const int num_audio = num_input_frames / kLowRateStreamDecimation;
+  const int num_resampled = QResamplerProcessSamplesToBuffer(
+      encoder->resampler, input, num_codes * group_size, audio);
+  if (num_resampled < num_audio) {
+    /* Only happens if input is dropped for exceeding max_input_frames. */
+    memset(audio + num_resampled, 0,
+           sizeof(float) * (num_audio - num_resampled));
+  }
+
+  /* Compute the fricative channel's energy with the same arithmetic as the
+   * Enveloper, see ComputeChannelEnergies() in enveloper.c.
+   */
+  const BiquadFilterCoeffs* bpf0 = &encoder->bpf_biquad_coeffs[0];
+  const BiquadFilterCoeffs* bpf1 = &encoder->bpf_biquad_coeffs[1];
+  const BiquadFilterCoeffs* lpf = &encoder->energy_biquad_coeffs;
+  float bpf0_z0 = encoder->biquad_z[0][0];
+  float bpf0_z1 = encoder->biquad_z[0][1];
+  float bpf1_z0 = encoder->biquad_z[1][0];
+  float bpf1_z1 = encoder->biquad_z[1][1];
+  float lpf_z0 = encoder->biquad_z[2][0];
+  float lpf_z1 = encoder->biquad_z[2][1];
+  float energy = 0.0f;
+  int i;
+
+  for (i = 0; i < num_codes; ++i) {
+    int j;
+    for (j = 0; j < group_size; ++j) {
+      /* Apply bandpass filter. */
+      float next_state = input[j] - bpf0->a1 * bpf0_z0 - bpf0->a2 * bpf0_z1;
+      float sample =
+          bpf0->b0 * next_state + bpf0->b1 * bpf0_z0 + bpf0->b2 * bpf0_z1;
+      bpf0_z1 = bpf0_z0;
+      bpf0_z0 = next_state;
+
+      next_state = sample - bpf1->a1 * bpf1_z0 - bpf1->a2 * bpf1_z1;
+      sample = bpf1->b0 * next_state + bpf1->b1 * bpf1_z0 + bpf1->b2 * bpf1_z1;
+      bpf1_z1 = bpf1_z0;
+      bpf1_z0 = next_state;
+
+      /* Half-wave rectification and squaring. */
+      sample = (sample > 0.0f) ? sample : 0.0f;
+      const float rectified = sample * sample;
+
+      /* Lowpass filter the energy envelope. */
+      next_state = rectified - lpf->a1 * lpf_z0 - lpf->a2 * lpf_z1;
+      energy = lpf->b0 * next_state + lpf->b1 * lpf_z0 + lpf->b2 * lpf_z1;
+      lpf_z1 = lpf_z0;
+      lpf_z0 = next_state;
+    }
+
+    codes[i] = LowRateStreamEncodeEnergy(energy);
+    input += group_size;
+  }
+
+  encoder->biquad_z[0][0] = bpf0_z0;
+  encoder->biquad_z[0][1] = bpf0_z1;
+  encoder->biquad_z[1][0] = bpf1_z0;
+  encoder->biquad_z[1][1] = bpf1_z1;
+  encoder->biquad_z[2][0] = lpf_z0;
+  encoder->biquad_z[2][1] = lpf_z1;
+}
+
+uint8_t LowRateStreamEncodeEnergy(float energy) {
+  /* This comparison is false for NaN, which is coded as 0. */
+  if (!(energy >= kMinEnergy)) { return 0; }
+  const float code =
+      1.5f + kCodesPerDecade * (float)log10(energy / kMinEnergy);
+  return (code < 255.0f) ? (uint8_t)code : 255;
+}
+
+float LowRateStreamDecodeEnergy(uint8_t code) {
+  if (code == 0) { return 0.0f; }
+  return kMinEnergy * (float)pow(10.0, (code - 1) / (double)kCodesPerDecade);
+}
+
+void LowRateStreamDecodeEnergies(const uint8_t* codes, int num_samples,
+                                 int decimation_factor, float* energies) {
+  const int num_frames = num_samples / decimation_factor;
+  int i;
+  for (i = 0; i < num_frames; ++i) {
+    const int last_sample = (i + 1) * decimation_factor - 1;
+    const uint8_t code = codes[last_sample / kLowRateStreamCodeStride];
+    energies[i] = LowRateStreamDecodeEnergy(code);
+  }
+}
@@ -0,0 +1,127 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * Low-rate audio stream with a fricative energy side channel.
+ *
+ * When audio is streamed to the sleeve, e.g. from the puck in kAudioSamples
+ * messages, the Enveloper's fricative channel, sensitive to 4-6 kHz, is the
+ * only reason to send 16 kHz audio. The other channels and the CARL frontend
+ * for the vowel embedding are below 3.5 kHz.
+ *
+ * Instead, the sender runs a LowRateStreamEncoder, which downsamples the audio
+ * by kLowRateStreamDecimation and computes the fricative channel's energy from
+ * the full-band audio, the same way the Enveloper does. The energy is sent as
+ * one byte per kLowRateStreamCodeStride downsampled samples, log coded in
+ * steps of about 0.4 dB. In kAudioSamplesLowRate messages, this is 72 bytes
+ * per 64 input samples instead of 128 for kAudioSamples.
+ *
+ * The receiver decodes the energies with LowRateStreamDecodeEnergies() and runs
+ * a TactileProcessor with the low-rate profile (see
+ * TactileProcessorSetLowRateParams()) through
+ * TactileProcessorProcessSamplesWithSideEnergy(), at half the compute.
+ *
+ * Example use:
+ *   // Sender.
+ *   LowRateStreamEncoder* encoder = LowRateStreamEncoderMake(
+ *       &kDefaultEnveloperParams, sample_rate_hz, kNumSamples);
+ *   float audio[kNumSamples / kLowRateStreamDecimation];
+ *   uint8_t codes[kNumSamples / (kLowRateStreamDecimation *
+ *                                kLowRateStreamCodeStride)];
+ *   LowRateStreamEncode(encoder, input, kNumSamples, audio, codes);
+ *   // Send `audio` and `codes`.
+ *
+ *   // Receiver.
+ *   float side_energy[kBlockSize / decimation_factor];
+ *   LowRateStreamDecodeEnergies(codes, kBlockSize, decimation_factor,
+ *                               side_energy);
+ *   TactileProcessorProcessSamplesWithSideEnergy(processor, audio,
+ *                                                side_energy, output);
+ */
+
+#ifndef AUDIO_TO_TACTILE_SRC_TACTILE_LOW_RATE_STREAM_H_
+#define AUDIO_TO_TACTILE_SRC_TACTILE_LOW_RATE_STREAM_H_
+
+#include <stdint.h>
+
+#include "dsp/biquad_filter.h"
+#include "dsp/q_resampler.h"
+#include "tactile/enveloper.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Factor by which the streamed audio is downsampled. */
+#define kLowRateStreamDecimation 2
+/* Number of streamed (downsampled) samples per fricative energy code. */
+#define kLowRateStreamCodeStride 4
+
+typedef struct {
+  /* Downsamples the input by kLowRateStreamDecimation. */
+  QResampler* resampler;
+  /* Fricative channel filters, designed at the input rate. */
+  BiquadFilterCoeffs bpf_biquad_coeffs[2];
+  BiquadFilterCoeffs energy_biquad_coeffs;
+  /* biquad_z[k] is the state of biquad k, where k = 0 and 1 are the bandpass
+   * filter sections and k = 2 is the energy lowpass filter.
+   */
+  float biquad_z[3][2];
+} LowRateStreamEncoder;
+
+/* Makes a LowRateStreamEncoder for audio at `input_sample_rate_hz`, computing
+ * the energy of the fricative channel of `params`. `max_input_frames` is the
+ * max number of frames passed to LowRateStreamEncode(). Returns NULL on
+ * failure. The caller should free it when done with LowRateStreamEncoderFree().
+ */
+LowRateStreamEncoder* LowRateStreamEncoderMake(const EnveloperParams* params,
+                                               float input_sample_rate_hz,
+                                               int max_input_frames);
+
+/* Frees a LowRateStreamEncoder. */
+void LowRateStreamEncoderFree(LowRateStreamEncoder* encoder);
+
+/* Resets to initial state. */
+void LowRateStreamEncoderReset(LowRateStreamEncoder* encoder);
+
+/* Encodes `num_input_frames` samples of `input`, a multiple of
+ * kLowRateStreamDecimation * kLowRateStreamCodeStride. Writes
+ * `num_input_frames / kLowRateStreamDecimation` downsampled samples to `audio`
+ * and one fricative energy code per kLowRateStreamCodeStride of them to
+ * `codes`. Each code is the energy at the end of its group of samples.
+ */
+void LowRateStreamEncode(LowRateStreamEncoder* encoder, const float* input,
+                         int num_input_frames, float* audio, uint8_t* codes);
+
+/* Log codes energy as a byte, 0 for energy below about 1e-10, including NaN,
+ * and otherwise steps of about 0.4 dB up to about 3.
+ */
+uint8_t LowRateStreamEncodeEnergy(float energy);
+
+/* Inverse of LowRateStreamEncodeEnergy(). */
+float LowRateStreamDecodeEnergy(uint8_t code);
+
+/* Decodes the fricative energies for an Enveloper with `decimation_factor`
+ * processing `num_samples` streamed samples, the codes for which are `codes`.
+ * `num_samples` must be a multiple of kLowRateStreamCodeStride and of
+ * `decimation_factor`. Writes `num_samples / decimation_factor` energies to
+ * `energies`, each decoded from the code for the frame's last sample.
+ */
+void LowRateStreamDecodeEnergies(const uint8_t* codes, int num_samples,
+                                 int decimation_factor, float* energies);
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif
+#endif /* AUDIO_TO_TACTILE_SRC_TACTILE_LOW_RATE_STREAM_H_ */
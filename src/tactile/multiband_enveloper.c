@@ -0,0 +1,426 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "tactile/multiband_enveloper.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "dsp/butterworth.h"
+#include "dsp/decibels.h"
+#include "dsp/fast_fun.h"
+#include "dsp/math_constants.h"
+#include "dsp/simd.h"
+#include "tactile/enveloper_kernel.h"
+
+const MultibandEnveloperParams kDefaultMultibandEnveloperParams = {
+    /*num_bands=*/24,
+    /*band_edges_hz=*/{
+        80.0f, 95.8f, 114.6f, 137.2f, 164.3f, 196.7f, 235.4f, 281.8f,
+        337.4f, 403.9f, 483.5f, 578.8f, 692.8f, 829.4f, 992.8f, 1188.5f,
+        1422.8f, 1703.2f, 2038.9f, 2440.7f, 2921.7f, 3497.6f, 4186.9f, 5012.1f,
+        6000.0f,
+    },
+    /*denoising_strength=*/4.0f,
+    /*output_gain=*/2.5f,
+    /*energy_cutoff_hz=*/500.0f,
+    /*energy_tau_s=*/0.01f,
+    /*noise_db_s=*/2.0f,
+    /*denoising_transition_db=*/10.0f,
+    /*agc_strength=*/0.7f,
+    /*gain_tau_attack_s=*/0.005f,
+    /*gain_tau_release_s=*/0.15f,
+    /*compressor_exponent=*/0.25f,
+};
+
+static const float kCompressorStabilization =
+    kEnveloperCompressorStabilization;
+
+/* Max number of output frames per chunk in ProcessSamples. */
+#define kMultibandEnveloperChunkFrames 32
+
+int MultibandEnveloperSetLogSpacedBands(
+    MultibandEnveloperParams* params, int num_bands,
+    float low_edge_hz, float high_edge_hz) {
+  if (params == NULL ||
+      !(1 <= num_bands && num_bands <= kMultibandEnveloperMaxBands) ||
+      !(0.0f < low_edge_hz && low_edge_hz < high_edge_hz)) {
+    fprintf(stderr, "Error: Invalid MultibandEnveloper bands.\n");
+    return 0;
+  }
+  const double ratio = (double)high_edge_hz / low_edge_hz;
+  params->num_bands = num_bands;
+  int b;
+  for (b = 0; b <= num_bands; ++b) {
+    params->band_edges_hz[b] =
+        (float)(low_edge_hz * pow(ratio, (double)b / num_bands));
+  }
+  return 1;
+}
+
+/* Computes the peak after rectification, squaring, and energy lowpass filtering
+ * of a unit-amplitude sinusoid at the band's geometric midpoint, the same as
+ * ComputeFilteredPeak() in enveloper.c.
+ */
+static float ComputeFilteredPeak(const BiquadFilterCoeffs* filter,
+                                 float low_edge_hz, float high_edge_hz,
+                                 float input_sample_rate_hz) {
+  static const float kSeriesCoeffs[4] =
+      {0.25f, (float)(4 / (3 * M_PI)), 0.25f, (float)(4 / (15 * M_PI))};
+  const float freq_hz = (float)sqrt(low_edge_hz * high_edge_hz);
+  float peak = kSeriesCoeffs[0];
+  int k;
+  for (k = 1; k <= 3; ++k) {
+    peak += (float)ComplexDoubleAbs(BiquadFilterFrequencyResponse(
+        filter, k * freq_hz / input_sample_rate_hz)) * kSeriesCoeffs[k];
+  }
+  return peak;
+}
+
+int MultibandEnveloperInit(MultibandEnveloper* state,
+                           const MultibandEnveloperParams* params,
+                           float input_sample_rate_hz,
+                           int decimation_factor) {
+  if (state == NULL || params == NULL) {
+    fprintf(stderr, "MultibandEnveloperInit: Null argument.\n");
+    return 0;
+  }
+  const int num_bands = params->num_bands;
+  if (!(1 <= num_bands && num_bands <= kMultibandEnveloperMaxBands) ||
+      !(input_sample_rate_hz > 0.0f) ||
+      !(params->denoising_strength > 0.0f) ||
+      !(params->energy_tau_s >= 0.0f) ||
+      !(params->denoising_transition_db > 0.0f) ||
+      !(0.0f <= params->agc_strength && params->agc_strength <= 1.0f) ||
+      !(params->compressor_exponent > 0.0f) ||
+      !(decimation_factor > 0)) {
+    fprintf(stderr, "MultibandEnveloperInit: Invalid params.\n");
+    return 0;
+  } else if (!DesignButterworthOrder2Lowpass(params->energy_cutoff_hz,
+                                             input_sample_rate_hz,
+                                             &state->energy_biquad_coeffs)) {
+    fprintf(stderr,
+            "MultibandEnveloperInit: Failed to design energy smoother.\n");
+    return 0;
+  }
+
+  /* Zero everything so that padding bands have zero coefficients and gains. */
+  const BiquadFilterCoeffs energy_biquad_coeffs = state->energy_biquad_coeffs;
+  memset(state, 0, sizeof(MultibandEnveloper));
+  state->energy_biquad_coeffs = energy_biquad_coeffs;
+  state->num_bands = num_bands;
+
+  int b;
+  for (b = 0; b < num_bands; ++b) {
+    const float low_edge_hz = params->band_edges_hz[b];
+    const float high_edge_hz = params->band_edges_hz[b + 1];
+    BiquadFilterCoeffs bpf_coeffs[2];
+    if (!(low_edge_hz < high_edge_hz) ||
+        !DesignButterworthOrder2Bandpass(low_edge_hz, high_edge_hz,
+                                         input_sample_rate_hz, bpf_coeffs)) {
+      fprintf(stderr,
+              "MultibandEnveloperInit: Failed to design bandpass filter %d.\n",
+              b);
+      return 0;
+    }
+
+    int k;
+    for (k = 0; k < 2; ++k) {
+      state->bpf_coeffs[k][0][b] = bpf_coeffs[k].b0;
+      state->bpf_coeffs[k][1][b] = bpf_coeffs[k].b1;
+      state->bpf_coeffs[k][2][b] = bpf_coeffs[k].b2;
+      state->bpf_coeffs[k][3][b] = bpf_coeffs[k].a1;
+      state->bpf_coeffs[k][4][b] = bpf_coeffs[k].a2;
+    }
+    state->peak[b] = ComputeFilteredPeak(&state->energy_biquad_coeffs,
+                                         low_edge_hz, high_edge_hz,
+                                         input_sample_rate_hz);
+    state->gate_thresh_factor[b] = params->denoising_strength;
+    state->output_gain[b] = params->output_gain;
+  }
+
+  state->input_sample_rate_hz = input_sample_rate_hz;
+  state->decimation_factor = decimation_factor;
+  state->agc_exponent = -params->agc_strength;
+  state->compressor_exponent = params->compressor_exponent;
+
+  const float frame_s = decimation_factor / input_sample_rate_hz;
+  state->energy_smoother_coeff =
+      1.0f - (float)exp(-frame_s / params->energy_tau_s);
+  state->noise_coeffs[1] = DecibelsToPowerRatio(params->noise_db_s * frame_s);
+  state->gate_transition_factor =
+      DecibelsToPowerRatio(params->denoising_transition_db);
+  state->gain_smoother_coeffs[0] =
+      1.0f - (float)exp(-frame_s / params->gain_tau_attack_s);
+  state->gain_smoother_coeffs[1] =
+      1.0f - (float)exp(-frame_s / params->gain_tau_release_s);
+
+  /* Warm up duration is 500 ms. */
+  state->num_warm_up_samples =
+      (int)(0.5f * input_sample_rate_hz / decimation_factor + 0.5f);
+
+  MultibandEnveloperUpdatePrecomputedParams(state);
+  MultibandEnveloperReset(state);
+  return 1;
+}
+
+void MultibandEnveloperReset(MultibandEnveloper* state) {
+  memset(state->bpf_z, 0, sizeof(state->bpf_z));
+  memset(state->energy_z, 0, sizeof(state->energy_z));
+  memset(state->smoothed_energy, 0, sizeof(state->smoothed_energy));
+  memset(state->noise, 0, sizeof(state->noise));
+  memset(state->smoothed_gain, 0, sizeof(state->smoothed_gain));
+  state->warm_up_counter = state->num_warm_up_samples;
+}
+
+void MultibandEnveloperUpdatePrecomputedParams(MultibandEnveloper* state) {
+  /* Precompute noise estimation decay coefficient. */
+  state->noise_coeffs[0] = 1.0f / state->noise_coeffs[1];
+  /* Precompute compressor delta = kCompressorStabilization^(1/exponent). */
+  state->compressor_delta = (float)pow(kCompressorStabilization,
+                                       1.0f / state->compressor_exponent);
+
+  /* Compute per-band equalization, as explained in EnveloperUpdateTuning().
+   * Target output is -3 dBFS, a little below maximum to avoid saturation.
+   */
+  const float kTargetOutput = (float)(1.0 / M_SQRT2);
+  int b;
+  for (b = 0; b < state->num_bands; ++b) {
+    const float pcen_peak =
+        FastPow(FastExp2(-2 * state->agc_exponent) * state->peak[b] +
+            state->compressor_delta, state->compressor_exponent)
+        - kCompressorStabilization;
+    state->equalization[b] = FastPow(kTargetOutput / pcen_peak,
+        1.0f / (state->agc_exponent * state->compressor_exponent));
+  }
+}
+
+/* Computes FastPow(x, y) in each lane. */
+static Float4 FastPowLanes(Float4 x, float y) {
+  float values[4];
+  Float4Store(values, x);
+  values[0] = FastPow(values[0], y);
+  values[1] = FastPow(values[1], y);
+  values[2] = FastPow(values[2], y);
+  values[3] = FastPow(values[3], y);
+  return Float4Load(values);
+}
+
+/* Loads biquad coefficients for four bands from `coeffs`, pointing to b0 of
+ * the first band in a `bpf_coeffs[k]` array.
+ */
+static void LoadCoeffs4(const float* coeffs, EnveloperBiquadCoeffs4* coeffs4) {
+  coeffs4->b0 = Float4Load(coeffs);
+  coeffs4->b1 = Float4Load(coeffs + kMultibandEnveloperMaxBands);
+  coeffs4->b2 = Float4Load(coeffs + 2 * kMultibandEnveloperMaxBands);
+  coeffs4->a1 = Float4Load(coeffs + 3 * kMultibandEnveloperMaxBands);
+  coeffs4->a2 = Float4Load(coeffs + 4 * kMultibandEnveloperMaxBands);
+}
+
+/* Runs the bandpass and energy filters of bands [b, b + 4) over `num_frames`
+ * decimated frames of input, writing the clamped energies for output frame i
+ * to `energies[4 * i]`.
+ */
+static void ComputeBandEnergies4(MultibandEnveloper* state, int b,
+                                 const float* input, int num_frames,
+                                 float* energies) {
+  const int decimation_factor = state->decimation_factor;
+  const Float4 zero = Float4Broadcast(0.0f);
+  EnveloperBiquadCoeffs4 bpf_coeffs[2];
+  LoadCoeffs4(&state->bpf_coeffs[0][0][b], &bpf_coeffs[0]);
+  LoadCoeffs4(&state->bpf_coeffs[1][0][b], &bpf_coeffs[1]);
+  EnveloperBiquadCoeffs4 energy_coeffs;
+  energy_coeffs.b0 = Float4Broadcast(state->energy_biquad_coeffs.b0);
+  energy_coeffs.b1 = Float4Broadcast(state->energy_biquad_coeffs.b1);
+  energy_coeffs.b2 = Float4Broadcast(state->energy_biquad_coeffs.b2);
+  energy_coeffs.a1 = Float4Broadcast(state->energy_biquad_coeffs.a1);
+  energy_coeffs.a2 = Float4Broadcast(state->energy_biquad_coeffs.a2);
+  /* Hold the filter states in local variables over the loop. */
+  Float4 bpf_z[2][2];
+  Float4 energy_z[2];
+  int k;
+  for (k = 0; k < 2; ++k) {
+    bpf_z[k][0] = Float4Load(state->bpf_z[k][0] + b);
+    bpf_z[k][1] = Float4Load(state->bpf_z[k][1] + b);
+    energy_z[k] = Float4Load(state->energy_z[k] + b);
+  }
+  Float4 energy = zero;
+  int i;
+
+  for (i = 0; i < num_frames; ++i) {
+    int j;
+    for (j = 0; j < decimation_factor; ++j) {
+      /* Apply bandpass filter. */
+      Float4 sample = EnveloperBiquadProcessOneSample4(
+          &bpf_coeffs[0], bpf_z[0], Float4Broadcast(input[j]));
+      sample = EnveloperBiquadProcessOneSample4(
+          &bpf_coeffs[1], bpf_z[1], sample);
+
+      /* Half-wave rectification and squaring. */
+      sample = Float4Max(sample, zero);  /* Maps NaN to zero. */
+      const Float4 rectified = Float4Mul(sample, sample);
+
+      /* Lowpass filter the energy envelope. */
+      energy = EnveloperBiquadProcessOneSample4(
+          &energy_coeffs, energy_z, rectified);
+    }
+
+    /* Clamp negative energy to zero, preserving NaN. */
+    Float4Store(energies + 4 * i, Float4Max(zero, energy));
+    input += decimation_factor;
+  }
+
+  for (k = 0; k < 2; ++k) {
+    Float4Store(state->bpf_z[k][0] + b, bpf_z[k][0]);
+    Float4Store(state->bpf_z[k][1] + b, bpf_z[k][1]);
+    Float4Store(state->energy_z[k] + b, energy_z[k]);
+  }
+}
+
+/* Runs the noise gate, PCEN, and compression of bands [b, b + 4) over
+ * `num_frames` frames of energies from ComputeBandEnergies4(), writing output
+ * frame i to `frames[kMultibandEnveloperMaxBands * i + b]`.
+ */
+static void ComputeBandOutputs4(MultibandEnveloper* state, int b,
+                                const float* energies, int num_frames,
+                                float* frames) {
+  const Float4 zero = Float4Broadcast(0.0f);
+  const Float4 energy_smoother_coeff =
+      Float4Broadcast(state->energy_smoother_coeff);
+  const Float4 gate_transition_factor =
+      Float4Broadcast(state->gate_transition_factor);
+  const Float4 noise_coeffs[2] = {Float4Broadcast(state->noise_coeffs[0]),
+                                  Float4Broadcast(state->noise_coeffs[1])};
+  const Float4 gain_smoother_coeffs[2] = {
+      Float4Broadcast(state->gain_smoother_coeffs[0]),
+      Float4Broadcast(state->gain_smoother_coeffs[1])};
+  const Float4 compressor_delta = Float4Broadcast(state->compressor_delta);
+  const Float4 compressor_stabilization =
+      Float4Broadcast(kCompressorStabilization);
+  const Float4 min_noise = Float4Broadcast(1e-9f);
+  const Float4 min_diff = Float4Broadcast(1e-9f);
+  const Float4 two = Float4Broadcast(2.0f);
+  const float agc_exponent = state->agc_exponent;
+  const float compressor_exponent = state->compressor_exponent;
+  int warm_up_counter = state->warm_up_counter;
+
+  const Float4 equalization = Float4Load(state->equalization + b);
+  const Float4 gate_thresh_factor = Float4Load(state->gate_thresh_factor + b);
+  const Float4 output_gain = Float4Load(state->output_gain + b);
+  Float4 smoothed_energy = Float4Load(state->smoothed_energy + b);
+  /* The noise estimate, or during warm up, the sum of 2 * energy. */
+  Float4 noise_state = Float4Load(state->noise + b);
+  Float4 smoothed_gain = Float4Load(state->smoothed_gain + b);
+  int i;
+
+  for (i = 0; i < num_frames; ++i) {
+    const Float4 energy = Float4Load(energies + 4 * i);
+
+    /* Update PCEN denominator. */
+    smoothed_energy = Float4Add(smoothed_energy, Float4Mul(
+        energy_smoother_coeff,
+        Float4Sub(Float4Mul(equalization, energy), smoothed_energy)));
+
+    Float4 noise;
+    if (warm_up_counter) {  /* While warming up. */
+      /* Sum up `energy`, and divide to get the average. */
+      noise_state = Float4Add(noise_state, Float4Mul(two, energy));
+      noise = Float4Div(noise_state, Float4Broadcast((float)(
+          state->num_warm_up_samples - warm_up_counter + 1)));
+      /* Store the average on the last warm up sample. */
+      if (warm_up_counter == 1) { noise_state = noise; }
+    } else {  /* After warm up is done. */
+      /* Update noise level estimate. */
+      noise_state = Float4Mul(noise_state, Float4Select(
+          Float4LessThan(noise_state, smoothed_energy),
+          noise_coeffs[1], noise_coeffs[0]));
+      noise = noise_state;
+    }
+
+    noise = Float4Max(min_noise, noise);
+
+    const Float4 thresh = Float4Mul(gate_thresh_factor, noise);
+    const Float4 diff = Float4Sub(smoothed_energy, thresh);
+    /* Apply soft noise gate and AGC gain, or gain of zero if
+     * smoothed_energy <= thresh.
+     */
+    const Float4 diff_sqr = Float4Mul(diff, diff);
+    const Float4 halfway_point = Float4Mul(gate_transition_factor, thresh);
+    const Float4 soft_gate = Float4Div(diff_sqr, Float4Add(
+        diff_sqr, Float4Mul(halfway_point, halfway_point)));
+    const Float4 gain = Float4Select(
+        Float4LessEqual(diff, min_diff), zero,
+        Float4Mul(soft_gate, FastPowLanes(smoothed_energy, agc_exponent)));
+
+    /* Update smoothed AGC gain with asymmetric smoother. */
+    smoothed_gain = Float4Add(smoothed_gain, Float4Mul(
+        Float4Select(Float4LessThan(gain, smoothed_gain),
+                     gain_smoother_coeffs[1], gain_smoother_coeffs[0]),
+        Float4Sub(gain, smoothed_gain)));
+
+    /* Apply power law compression and output gain. */
+    Float4Store(frames + kMultibandEnveloperMaxBands * i + b,
+        Float4Mul(output_gain, Float4Sub(
+            FastPowLanes(Float4Add(Float4Mul(smoothed_gain, energy),
+                                   compressor_delta),
+                         compressor_exponent),
+            compressor_stabilization)));
+
+    if (warm_up_counter) { --warm_up_counter; }
+  }
+
+  Float4Store(state->smoothed_energy + b, smoothed_energy);
+  Float4Store(state->noise + b, noise_state);
+  Float4Store(state->smoothed_gain + b, smoothed_gain);
+}
+
+void MultibandEnveloperProcessSamples(MultibandEnveloper* state,
+                                      const float* input,
+                                      int num_samples,
+                                      float* output) {
+  const int decimation_factor = state->decimation_factor;
+  const int num_bands = state->num_bands;
+  float energies[4 * kMultibandEnveloperChunkFrames];
+  float frames[kMultibandEnveloperMaxBands * kMultibandEnveloperChunkFrames];
+  int num_frames_left = num_samples / decimation_factor;
+
+  while (num_frames_left > 0) {
+    const int num_frames = (num_frames_left < kMultibandEnveloperChunkFrames)
+        ? num_frames_left : kMultibandEnveloperChunkFrames;
+    int b;
+    for (b = 0; b < num_bands; b += 4) {
+      ComputeBandEnergies4(state, b, input, num_frames, energies);
+      ComputeBandOutputs4(state, b, energies, num_frames, frames);
+    }
+
+    /* Advance the warm up counter, which ComputeBandOutputs4() counts down
+     * locally for each group.
+     */
+    state->warm_up_counter = (state->warm_up_counter > num_frames)
+        ? state->warm_up_counter - num_frames : 0;
+
+    /* Copy the padded frames to the interleaved output. */
+    int i;
+    for (i = 0; i < num_frames; ++i) {
+      memcpy(output, frames + kMultibandEnveloperMaxBands * i,
+             sizeof(float) * num_bands);
+      output += num_bands;
+    }
+
+    input += num_frames * decimation_factor;
+    num_frames_left -= num_frames;
+  }
+}
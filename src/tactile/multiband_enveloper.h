@@ -0,0 +1,170 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * N-band generalization of Enveloper, for high-density tactor arrays.
+ *
+ * `MultibandEnveloper` computes energy envelopes over `num_bands` bandpass
+ * bands, up to kMultibandEnveloperMaxBands, with band edges given by a table.
+ * Each band is processed the same way as an Enveloper channel (see
+ * enveloper.h): Butterworth bandpass as two biquads, half-wave rectification
+ * and squaring, energy lowpass, decimation, soft noise gate, PCEN, and power
+ * law compression. A few differences from Enveloper:
+ *
+ *  - All bands share the same denoising strength and output gain.
+ *  - Enveloper couples its channels so that each channel's smoothed energy is
+ *    at least that of the channels above it. That makes sense for its
+ *    overlapping hand-picked bands, but with many narrow bands, it would smear
+ *    energy from high bands down the whole array. MultibandEnveloper bands are
+ *    independent.
+ *
+ * State is stored in structure-of-arrays layout with band b in element b of
+ * each array, so that bands are processed four at a time in Float4 lanes (see
+ * dsp/simd.h). The input is processed in chunks. For each chunk and each group
+ * of four bands, the filters run over the whole chunk with the group's filter
+ * state in Float4 locals, then the noise gate, PCEN, and compression run over
+ * the decimated frames. The cost is then proportional to the number of groups,
+ * ceil(num_bands / 4), e.g. 16 bands cost about four Enveloper instances, but
+ * without repeating the per-instance overhead.
+ *
+ * Example use:
+ *   MultibandEnveloperParams params = kDefaultMultibandEnveloperParams;
+ *   MultibandEnveloperSetLogSpacedBands(&params, 16, 80.0f, 6000.0f);
+ *   MultibandEnveloper enveloper;
+ *   MultibandEnveloperInit(&enveloper, &params, input_sample_rate_hz,
+ *                          decimation_factor);
+ *
+ *   // Processing loop.
+ *   float output[kOutputFrames * 16];
+ *   MultibandEnveloperProcessSamples(&enveloper, input, kNumSamples, output);
+ */
+
+#ifndef AUDIO_TO_TACTILE_SRC_TACTILE_MULTIBAND_ENVELOPER_H_
+#define AUDIO_TO_TACTILE_SRC_TACTILE_MULTIBAND_ENVELOPER_H_
+
+#include "dsp/biquad_filter.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Max number of bands, a multiple of 4. This equals kPostProcessorMaxChannels
+ * so that every tactor may have its own band.
+ */
+#define kMultibandEnveloperMaxBands 24
+
+typedef struct {
+  /* Number of bands, between 1 and kMultibandEnveloperMaxBands. */
+  int num_bands;
+  /* Band edges in Hz, `num_bands + 1` increasing values. Band b covers
+   * `band_edges_hz[b]` to `band_edges_hz[b + 1]`.
+   */
+  float band_edges_hz[kMultibandEnveloperMaxBands + 1];
+
+  /* Denoising strength, a positive value where larger means stronger
+   * denoising, for all bands. See EnveloperChannelParams.
+   */
+  float denoising_strength;
+  /* The final output is multiplied by this gain. */
+  float output_gain;
+
+  /* The following are the same as in EnveloperParams. */
+  float energy_cutoff_hz;
+  float energy_tau_s;
+  float noise_db_s;
+  float denoising_transition_db;
+  float agc_strength;
+  float gain_tau_attack_s;
+  float gain_tau_release_s;
+  float compressor_exponent;
+} MultibandEnveloperParams;
+/* Default params, with 24 bands log-spaced over 80-6000 Hz. */
+extern const MultibandEnveloperParams kDefaultMultibandEnveloperParams;
+
+/* Sets `params` to have `num_bands` bands with edges log-spaced from
+ * `low_edge_hz` to `high_edge_hz`. Returns 1 on success, 0 on failure.
+ */
+int /*bool*/ MultibandEnveloperSetLogSpacedBands(
+    MultibandEnveloperParams* params, int num_bands,
+    float low_edge_hz, float high_edge_hz);
+
+/* MultibandEnveloper data and state variables. Arrays have band b in element
+ * b. Elements from `num_bands` up to the next multiple of 4 are padding, with
+ * zero coefficients and gains so that they output zero.
+ */
+typedef struct {
+  int num_bands;
+  /* Bandpass filter coefficients of two second-order sections, where
+   * `bpf_coeffs[k][0..4][b]` are b0, b1, b2, a1, a2 of section k of band b.
+   */
+  float bpf_coeffs[2][5][kMultibandEnveloperMaxBands];
+  float peak[kMultibandEnveloperMaxBands];
+  float equalization[kMultibandEnveloperMaxBands];
+  float gate_thresh_factor[kMultibandEnveloperMaxBands];
+  float output_gain[kMultibandEnveloperMaxBands];
+
+  /* Biquad states, where `bpf_z[k][m][b]` is z[m] of section k of band b. */
+  float bpf_z[2][2][kMultibandEnveloperMaxBands];
+  float energy_z[2][kMultibandEnveloperMaxBands];
+  float smoothed_energy[kMultibandEnveloperMaxBands];
+  float noise[kMultibandEnveloperMaxBands];
+  float smoothed_gain[kMultibandEnveloperMaxBands];
+
+  /* Energy envelope smoothing coefficients, the same for all bands. */
+  BiquadFilterCoeffs energy_biquad_coeffs;
+  float input_sample_rate_hz;
+  int decimation_factor;
+  int num_warm_up_samples;
+
+  float energy_smoother_coeff;
+  float noise_coeffs[2];
+  float gate_transition_factor;
+  float agc_exponent;
+  float gain_smoother_coeffs[2]; /* [0] = attack coeff, [1] = release coeff. */
+  float compressor_exponent;
+  float compressor_delta;
+  int warm_up_counter;
+} MultibandEnveloper;
+
+/* Initialize state with the specified parameters. The output sample rate is
+ * input_sample_rate_hz / decimation_factor. Returns 1 on success, 0 on failure.
+ */
+int MultibandEnveloperInit(MultibandEnveloper* state,
+                           const MultibandEnveloperParams* params,
+                           float input_sample_rate_hz,
+                           int decimation_factor);
+
+/* Resets to initial state. */
+void MultibandEnveloperReset(MultibandEnveloper* state);
+
+/* Process audio in a streaming manner. The `input` pointer should point to a
+ * contiguous array of `num_samples` samples, where `num_samples` is a multiple
+ * of `decimation_factor`. The output has `num_samples / decimation_factor`
+ * frames of `num_bands` channels, written in interleaved order. In-place
+ * processing output == input is not allowed.
+ */
+void MultibandEnveloperProcessSamples(MultibandEnveloper* state,
+                                      const float* input,
+                                      int num_samples,
+                                      float* output);
+
+/* Updates precomputed params, useful if noise_coeffs or compressor params have
+ * been changed.
+ */
+void MultibandEnveloperUpdatePrecomputedParams(MultibandEnveloper* state);
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif
+#endif /* AUDIO_TO_TACTILE_SRC_TACTILE_MULTIBAND_ENVELOPER_H_ */
@@ -0,0 +1,138 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "tactile/multiband_tactile_processor.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "dsp/aligned_alloc.h"
+
+void MultibandTactileProcessorSetDefaultParams(
+    MultibandTactileProcessorParams* params) {
+  if (params) {
+    params->enveloper_params = kDefaultMultibandEnveloperParams;
+    params->input_sample_rate_hz = 16000.0f;
+    params->block_size = 64;
+    params->decimation_factor = 8;
+    params->num_tactors = kPostProcessorMaxChannels;
+    MultibandTactileProcessorMapBandsEvenly(params);
+  }
+}
+
+void MultibandTactileProcessorMapBandsEvenly(
+    MultibandTactileProcessorParams* params) {
+  const int num_bands = params->enveloper_params.num_bands;
+  const int num_tactors = params->num_tactors;
+  int t;
+  for (t = 0; t < kPostProcessorMaxChannels; ++t) {
+    params->tactor_band[t] = (t < num_tactors)
+        ? (t * num_bands) / num_tactors : -1;
+  }
+}
+
+MultibandTactileProcessor* MultibandTactileProcessorMake(
+    const MultibandTactileProcessorParams* params) {
+  if (params == NULL) { return NULL; }
+  const int num_bands = params->enveloper_params.num_bands;
+  if (!(params->decimation_factor > 0) || !(params->block_size > 0) ||
+      params->block_size % params->decimation_factor != 0) {
+    fprintf(stderr, "Error: block_size must be a positive "
+            "integer multiple of decimation_factor.\n");
+    return NULL;
+  } else if (!(1 <= params->num_tactors &&
+               params->num_tactors <= kPostProcessorMaxChannels)) {
+    fprintf(stderr, "Error: num_tactors must be between 1 and %d.\n",
+            kPostProcessorMaxChannels);
+    return NULL;
+  }
+  int t;
+  for (t = 0; t < params->num_tactors; ++t) {
+    if (!(-1 <= params->tactor_band[t] && params->tactor_band[t] < num_bands)) {
+      fprintf(stderr, "Error: Invalid band %d for tactor %d.\n",
+              params->tactor_band[t], t);
+      return NULL;
+    }
+  }
+
+  MultibandTactileProcessor* processor =
+      (MultibandTactileProcessor*)AlignedAlloc(
+          sizeof(MultibandTactileProcessor));
+  if (processor == NULL) {
+    fprintf(stderr, "Error: Memory allocation failed.\n");
+    return NULL;
+  }
+  processor->workspace = NULL;
+
+  if (!MultibandEnveloperInit(&processor->enveloper,
+                              &params->enveloper_params,
+                              params->input_sample_rate_hz,
+                              params->decimation_factor)) {
+    fprintf(stderr, "Error: MultibandEnveloperInit failed.\n");
+    goto fail;
+  }
+
+  processor->block_size = params->block_size;
+  processor->decimation_factor = params->decimation_factor;
+  processor->num_tactors = params->num_tactors;
+  for (t = 0; t < kPostProcessorMaxChannels; ++t) {
+    processor->tactor_band[t] = params->tactor_band[t];
+  }
+  processor->workspace = (float*)AlignedAlloc(sizeof(float) * num_bands *
+      (params->block_size / params->decimation_factor));
+  if (processor->workspace == NULL) {
+    fprintf(stderr, "Error: Memory allocation failed.\n");
+    goto fail;
+  }
+  return processor;
+
+fail:
+  MultibandTactileProcessorFree(processor);
+  return NULL;
+}
+
+void MultibandTactileProcessorFree(MultibandTactileProcessor* processor) {
+  if (processor) {
+    AlignedFree(processor->workspace);
+    AlignedFree(processor);
+  }
+}
+
+void MultibandTactileProcessorReset(MultibandTactileProcessor* processor) {
+  MultibandEnveloperReset(&processor->enveloper);
+}
+
+void MultibandTactileProcessorProcessSamples(
+    MultibandTactileProcessor* processor, const float* input, float* output) {
+  const int num_bands = processor->enveloper.num_bands;
+  const int num_tactors = processor->num_tactors;
+  const int* tactor_band = processor->tactor_band;
+  const int decimated_block_size =
+      processor->block_size / processor->decimation_factor;
+  const float* envelopes = processor->workspace;
+  MultibandEnveloperProcessSamples(&processor->enveloper, input,
+                                   processor->block_size, processor->workspace);
+
+  /* Map bands to tactors. */
+  int i;
+  for (i = 0; i < decimated_block_size; ++i) {
+    int t;
+    for (t = 0; t < num_tactors; ++t) {
+      output[t] = (tactor_band[t] >= 0) ? envelopes[tactor_band[t]] : 0.0f;
+    }
+    envelopes += num_bands;
+    output += num_tactors;
+  }
+}
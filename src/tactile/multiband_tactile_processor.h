@@ -0,0 +1,118 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * TactileProcessor variant for high-density tactor arrays.
+ *
+ * `MultibandTactileProcessor` takes a mono audio stream as input and produces
+ * up to kPostProcessorMaxChannels tactile signals, one per tactor, from the
+ * bands of a MultibandEnveloper (see multiband_enveloper.h). Each tactor is
+ * driven by one band, as given by the `tactor_band` table, so that e.g. a
+ * 24-tactor sleeve may present 24 bands from low to high frequency along its
+ * length. Several tactors may share a band, and a tactor may be left off.
+ *
+ * Unlike TactileProcessor, there is no vowel embedding: with enough bands, the
+ * spectral shape of vowels is already spread out over the array.
+ *
+ * The output is intended to be passed to a PostProcessor with `num_tactors`
+ * channels.
+ *
+ * Example use:
+ *   MultibandTactileProcessorParams params;
+ *   MultibandTactileProcessorSetDefaultParams(&params);
+ *   params.input_sample_rate_hz = 16000.0f;
+ *   MultibandTactileProcessor* processor =
+ *       MultibandTactileProcessorMake(&params);
+ *
+ *   // Processing loop.
+ *   float output[kPostProcessorMaxChannels * kBlockSize / kDecimationFactor];
+ *   MultibandTactileProcessorProcessSamples(processor, input, output);
+ *   ...
+ *   MultibandTactileProcessorFree(processor);
+ */
+
+#ifndef AUDIO_TO_TACTILE_SRC_TACTILE_MULTIBAND_TACTILE_PROCESSOR_H_
+#define AUDIO_TO_TACTILE_SRC_TACTILE_MULTIBAND_TACTILE_PROCESSOR_H_
+
+#include "tactile/multiband_enveloper.h"
+#include "tactile/post_processor.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* MultibandTactileProcessor parameters. */
+typedef struct {
+  MultibandEnveloperParams enveloper_params;
+  /* Input sample rate in Hz. */
+  float input_sample_rate_hz;
+  /* Number of input samples per call to ...ProcessSamples(). */
+  int block_size;
+  /* Decimation factor after computing the energy envelope. */
+  int decimation_factor;
+  /* Number of tactors / output channels, at most kPostProcessorMaxChannels. */
+  int num_tactors;
+  /* `tactor_band[t]` is the band driving tactor t, or -1 for none. */
+  int tactor_band[kPostProcessorMaxChannels];
+} MultibandTactileProcessorParams;
+
+/* Set `params` to default values: 24 bands over 80-6000 Hz, one per tactor on
+ * 24 tactors, and block size 64 at 16 kHz with decimation factor 8.
+ */
+void MultibandTactileProcessorSetDefaultParams(
+    MultibandTactileProcessorParams* params);
+
+/* Sets `tactor_band` to spread the enveloper's bands evenly over `num_tactors`
+ * tactors, in order of increasing frequency. If there are more tactors than
+ * bands, adjacent tactors share a band, and if there are fewer, bands are
+ * skipped.
+ */
+void MultibandTactileProcessorMapBandsEvenly(
+    MultibandTactileProcessorParams* params);
+
+typedef struct {
+  MultibandEnveloper enveloper;
+  int block_size;
+  int decimation_factor;
+  int num_tactors;
+  int tactor_band[kPostProcessorMaxChannels];
+  /* Workspace for the enveloper output, `num_bands * block_size /
+   * decimation_factor` floats.
+   */
+  float* workspace;
+} MultibandTactileProcessor;
+
+/* Makes a `MultibandTactileProcessor`. The caller should free it when done
+ * with `MultibandTactileProcessorFree()`. Returns NULL on failure.
+ */
+MultibandTactileProcessor* MultibandTactileProcessorMake(
+    const MultibandTactileProcessorParams* params);
+
+/* Frees a `MultibandTactileProcessor`. */
+void MultibandTactileProcessorFree(MultibandTactileProcessor* processor);
+
+/* Resets to initial state. */
+void MultibandTactileProcessorReset(MultibandTactileProcessor* processor);
+
+/* Runs in a streaming manner. `input` is an array of `block_size` elements and
+ * `output` is an array of `num_tactors * block_size / decimation_factor`
+ * elements, written in interleaved order.
+ */
+void MultibandTactileProcessorProcessSamples(
+    MultibandTactileProcessor* processor, const float* input, float* output);
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif
+#endif /* AUDIO_TO_TACTILE_SRC_TACTILE_MULTIBAND_TACTILE_PROCESSOR_H_ */
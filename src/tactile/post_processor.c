@@ -19,7 +19,9 @@
 #include <stdlib.h>
 
 #include "dsp/butterworth.h"
+#include "dsp/denormals.h"
 #include "dsp/fast_fun.h"
+#include "dsp/simd.h"
 #include "tactile/tactor_equalizer.h"
 
 /* `output_limit` is constrained to [kLimitMin, kLimitMax]. */
@@ -36,6 +38,9 @@ static const float kLimitGrowRateDbPerSecond = 2.0f;
 static const float kRecoveryLimit = 0.25f;
 static const int kRecoveryNumBuffers = 10;
 
+/* Signals are hard clipped to [-kClipAmplitude, kClipAmplitude]. */
+static const float kClipAmplitude = 0.96f;
+
 void PostProcessorSetDefaultParams(PostProcessorParams* params) {
   if (params) {
     params->use_equalizer = 1;
@@ -46,6 +51,12 @@ void PostProcessorSetDefaultParams(PostProcessorParams* params) {
   }
 }
 
+/* Gets the bit mask of channels 0 to num_channels - 1. */
+static uint32_t AllChannelsMask(int num_channels) {
+  return (num_channels >= 32) ? ~UINT32_C(0)
+                              : (UINT32_C(1) << num_channels) - 1;
+}
+
 int PostProcessorInit(PostProcessor* state,
                       const PostProcessorParams* params,
                       float sample_rate_hz,
@@ -78,6 +89,7 @@ int PostProcessorInit(PostProcessor* state,
   state->equalizer_biquad_coeffs[0].b2 *= params->gain;
 
   state->num_channels = num_channels;
+  state->active_channels = AllChannelsMask(num_channels);
   state->limit_grow_coeff = (float)exp(
       (float)(M_LN10 / 10.0) * kLimitGrowRateDbPerSecond / sample_rate_hz);
   PostProcessorReset(state);
@@ -87,15 +99,49 @@ int PostProcessorInit(PostProcessor* state,
 void PostProcessorReset(PostProcessor* state) {
   int c;
   for (c = 0; c < state->num_channels; ++c){
-    PostProcessorChannelState* channel = &state->channels[c];
-    BiquadFilterInitZero(&channel->equalizer_biquad_state[0]);
-    BiquadFilterInitZero(&channel->equalizer_biquad_state[1]);
-    BiquadFilterInitZero(&channel->lpf_biquad_state);
+    BiquadFilterInitZero(&state->equalizer_biquad_state[0][c]);
+    BiquadFilterInitZero(&state->equalizer_biquad_state[1][c]);
+    BiquadFilterInitZero(&state->lpf_biquad_state[c]);
   }
   state->output_limit = kLimitReduceFactor * kLimitMax;
   state->recovery = 0;
 }
 
+void PostProcessorSetActiveChannels(PostProcessor* state,
+                                    uint32_t active_channels) {
+  active_channels &= AllChannelsMask(state->num_channels);
+  /* Inactive channels' filter states are stale, so zero them on activation. */
+  const uint32_t activated = active_channels & ~state->active_channels;
+  int c;
+  for (c = 0; c < state->num_channels; ++c) {
+    if (activated & (UINT32_C(1) << c)) {
+      BiquadFilterInitZero(&state->equalizer_biquad_state[0][c]);
+      BiquadFilterInitZero(&state->equalizer_biquad_state[1][c]);
+      BiquadFilterInitZero(&state->lpf_biquad_state[c]);
+    }
+  }
+  state->active_channels = active_channels;
+}
+
+void PostProcessorGetWarmState(const PostProcessor* state, float* warm_state) {
+  warm_state[0] = state->output_limit;
+}
+
+int PostProcessorSetWarmState(PostProcessor* state, const float* warm_state) {
+  float output_limit = warm_state[0];
+  if (output_limit != output_limit /* isnan(output_limit) */) {
+    fprintf(stderr, "Error: Invalid PostProcessor warm state.\n");
+    return 0;
+  }
+  if (output_limit < kLimitMin) {
+    output_limit = kLimitMin;
+  } else if (output_limit > kLimitMax) {
+    output_limit = kLimitMax;
+  }
+  state->output_limit = output_limit;
+  return 1;
+}
+
 void PostProcessorLowBattery(PostProcessor* state) {
   if (!state->recovery) {
     /* When battery goes low, reduce limit by a bit. */
@@ -105,9 +151,10 @@ void PostProcessorLowBattery(PostProcessor* state) {
   state->recovery = kRecoveryNumBuffers;
 }
 
-void PostProcessorProcessSamples(PostProcessor* state,
-                                 float* input_output,
-                                 int num_frames) {
+/* Updates the output limit at the start of a buffer and returns the limit to
+ * use for the buffer.
+ */
+static float UpdateOutputLimit(PostProcessor* state) {
   float output_limit = state->output_limit;
 
   if (state->recovery) {
@@ -120,47 +167,261 @@ void PostProcessorProcessSamples(PostProcessor* state,
     if (output_limit > kLimitMax) { output_limit = kLimitMax; }
     state->output_limit = output_limit;
   }
+  return output_limit;
+}
 
+/* Dithers the filter states to avoid denormals, if enabled (see denormals.h).
+ */
+static void DitherFilterStates(PostProcessor* state) {
+  int c;
+  for (c = 0; c < state->num_channels; ++c) {
+    DenormalsDither(state->equalizer_biquad_state[0][c].z, 2);
+    DenormalsDither(state->equalizer_biquad_state[1][c].z, 2);
+    DenormalsDither(state->lpf_biquad_state[c].z, 2);
+  }
+}
+
+/* Filter states for the fused processing in struct-of-arrays layout, so that
+ * channels can be processed four at a time. The filters are indexed as 0 and 1
+ * for the equalizer sections and 2 for the lowpass filter.
+ */
+typedef struct {
+  float z0[3][kPostProcessorMaxChannels];
+  float z1[3][kPostProcessorMaxChannels];
+} FusedStates;
+
+/* Coefficients, states, and limit for processing one buffer frame by frame. */
+typedef struct {
+  const BiquadFilterCoeffs* coeffs[3];
+  /* `coeffs` as {b0, b1, b2, a1, a2} broadcast to Float4s. */
+  Float4 coeffs4[3][5];
+  FusedStates z;
+  int num_channels;
+  /* Active channels, and for each four-channel group, 1.0 in the lanes of
+   * active channels and 0.0 in the others.
+   */
+  uint32_t active_channels;
+  Float4 lane_masks[kPostProcessorMaxChannels / 4];
+  float output_limit;
+  float sqrt_output_limit;
+} FusedProcessor;
+
+/* Gets the states of filter `f`, indexed as in FusedStates. */
+static BiquadFilterState* FilterStates(PostProcessor* state, int f) {
+  return (f < 2) ? state->equalizer_biquad_state[f] : state->lpf_biquad_state;
+}
+
+/* Begins processing a buffer, loading the filter states into `fused`. */
+static void FusedBegin(PostProcessor* state, FusedProcessor* fused) {
   const int num_channels = state->num_channels;
-  int n;
-  for (n = 0; n < num_frames; ++n) {
-    float power = 0.0f;
+  fused->coeffs[0] = &state->equalizer_biquad_coeffs[0];
+  fused->coeffs[1] = &state->equalizer_biquad_coeffs[1];
+  fused->coeffs[2] = &state->lpf_biquad_coeffs;
+  fused->num_channels = num_channels;
+  fused->active_channels = state->active_channels;
+  int c;
+  for (c = 0; c + 4 <= num_channels; c += 4) {
+    float lanes[4];
+    int i;
+    for (i = 0; i < 4; ++i) {
+      lanes[i] = ((state->active_channels >> (c + i)) & 1) ? 1.0f : 0.0f;
+    }
+    fused->lane_masks[c / 4] = Float4Load(lanes);
+  }
+  fused->output_limit = UpdateOutputLimit(state);
+  /* sqrt(x) = x / sqrt(x). */
+  fused->sqrt_output_limit =
+      fused->output_limit * FastRsqrt(fused->output_limit);
+  DitherFilterStates(state);
 
-    int c;
+  int f;
+  for (f = 0; f < 3; ++f) {
+    const BiquadFilterCoeffs* coeffs = fused->coeffs[f];
+    const BiquadFilterState* states = FilterStates(state, f);
+    fused->coeffs4[f][0] = Float4Broadcast(coeffs->b0);
+    fused->coeffs4[f][1] = Float4Broadcast(coeffs->b1);
+    fused->coeffs4[f][2] = Float4Broadcast(coeffs->b2);
+    fused->coeffs4[f][3] = Float4Broadcast(coeffs->a1);
+    fused->coeffs4[f][4] = Float4Broadcast(coeffs->a2);
     for (c = 0; c < num_channels; ++c) {
-      PostProcessorChannelState* channel = &state->channels[c];
-      float sample = input_output[c];
-
-      /* Apply equalizer. */
-      sample = BiquadFilterProcessOneSample(
-          &state->equalizer_biquad_coeffs[0],
-          &channel->equalizer_biquad_state[0], sample);
-      sample = BiquadFilterProcessOneSample(
-          &state->equalizer_biquad_coeffs[1],
-          &channel->equalizer_biquad_state[1], sample);
+      fused->z.z0[f][c] = states[c].z[0];
+      fused->z.z1[f][c] = states[c].z[1];
+    }
+  }
+}
 
-      /* Apply hard clipping. */
-      const float kClipAmplitude = 0.96f;
-      if (sample > kClipAmplitude) { sample = kClipAmplitude; }
-      if (sample < -kClipAmplitude) { sample = -kClipAmplitude; }
+/* Ends processing a buffer, storing the filter states back to `state`. */
+static void FusedEnd(const FusedProcessor* fused, PostProcessor* state) {
+  int f;
+  for (f = 0; f < 3; ++f) {
+    BiquadFilterState* states = FilterStates(state, f);
+    int c;
+    for (c = 0; c < fused->num_channels; ++c) {
+      states[c].z[0] = fused->z.z0[f][c];
+      states[c].z[1] = fused->z.z1[f][c];
+    }
+  }
+}
 
-      /* Apply lowpass filter. */
-      sample = BiquadFilterProcessOneSample(
-          &state->lpf_biquad_coeffs,
-          &channel->lpf_biquad_state, sample);
+/* Processes one sample for four channels, with the same arithmetic as
+ * BiquadFilterProcessOneSample(). `coeffs` is {b0, b1, b2, a1, a2} broadcast.
+ */
+static Float4 FusedBiquadProcessOneSample(const Float4* coeffs,
+                                          float* z0, float* z1, Float4 input) {
+  const Float4 state0 = Float4Load(z0);
+  const Float4 state1 = Float4Load(z1);
+  const Float4 next_state = Float4Sub(
+      Float4Sub(input, Float4Mul(coeffs[3], state0)),
+      Float4Mul(coeffs[4], state1));
+  Float4Store(z1, state0);
+  Float4Store(z0, next_state);
+  return Float4Add(Float4Add(Float4Mul(coeffs[0], next_state),
+                             Float4Mul(coeffs[1], state0)),
+                   Float4Mul(coeffs[2], state1));
+}
 
-      power += sample * sample;
-      input_output[c] = sample;
+/* Processes one frame of `num_channels` samples from `input` to `frame`, which
+ * may be the same array. The equalizer, hard clipping, lowpass filter, and
+ * power sum are done four channels at a time with channels in SIMD lanes, then
+ * the remaining channels one at a time. Groups and channels that are inactive
+ * are skipped, and inactive channels are written as zero.
+ */
+static void FusedProcessFrame(FusedProcessor* fused,
+                              const float* input, float* frame) {
+  const int num_channels = fused->num_channels;
+  FusedStates* z = &fused->z;
+  const Float4 clip_max = Float4Broadcast(kClipAmplitude);
+  const Float4 clip_min = Float4Broadcast(-kClipAmplitude);
+  Float4 power4 = Float4Broadcast(0.0f);
+  const uint32_t active_channels = fused->active_channels;
+  const Float4 zero = Float4Broadcast(0.0f);
+  int c;
+  for (c = 0; c + 4 <= num_channels; c += 4) {
+    const uint32_t group_active = (active_channels >> c) & 15;
+    if (!group_active) {
+      Float4Store(frame + c, zero);
+      continue;
     }
+    Float4 sample = FusedBiquadProcessOneSample(
+        fused->coeffs4[0], z->z0[0] + c, z->z1[0] + c, Float4Load(input + c));
+    sample = FusedBiquadProcessOneSample(
+        fused->coeffs4[1], z->z0[1] + c, z->z1[1] + c, sample);
+    sample = Float4Min(Float4Max(sample, clip_min), clip_max);
+    sample = FusedBiquadProcessOneSample(
+        fused->coeffs4[2], z->z0[2] + c, z->z1[2] + c, sample);
+    if (group_active != 15) {
+      sample = Float4Mul(sample, fused->lane_masks[c / 4]);
+    }
+    power4 = Float4Add(power4, Float4Mul(sample, sample));
+    Float4Store(frame + c, sample);
+  }
 
-    /* Limit the power when needed. */
-    if (power > output_limit) {
-      const float limiter_gain = FastPow(output_limit / power, 0.5f);
-      for (c = 0; c < num_channels; ++c) {
-        input_output[c] *= limiter_gain;
+  /* Sum the power over lanes. */
+  float power_lanes[4];
+  Float4Store(power_lanes, power4);
+  float power = (power_lanes[0] + power_lanes[1]) +
+      (power_lanes[2] + power_lanes[3]);
+
+  for (; c < num_channels; ++c) {
+    if (!((active_channels >> c) & 1)) {
+      frame[c] = 0.0f;
+      continue;
+    }
+    float sample = input[c];
+    int f;
+    for (f = 0; f < 3; ++f) {
+      if (f == 2) {
+        if (sample > kClipAmplitude) { sample = kClipAmplitude; }
+        if (sample < -kClipAmplitude) { sample = -kClipAmplitude; }
       }
+      BiquadFilterState biquad_state;
+      biquad_state.z[0] = z->z0[f][c];
+      biquad_state.z[1] = z->z1[f][c];
+      sample = BiquadFilterProcessOneSample(
+          fused->coeffs[f], &biquad_state, sample);
+      z->z0[f][c] = biquad_state.z[0];
+      z->z1[f][c] = biquad_state.z[1];
+    }
+    frame[c] = sample;
+    power += sample * sample;
+  }
+
+  /* Limit the power when needed, scaling by sqrt(output_limit / power). */
+  if (power > fused->output_limit) {
+    const float limiter_gain = fused->sqrt_output_limit * FastRsqrt(power);
+    const Float4 limiter_gain4 = Float4Broadcast(limiter_gain);
+    for (c = 0; c + 4 <= num_channels; c += 4) {
+      Float4Store(frame + c, Float4Mul(Float4Load(frame + c), limiter_gain4));
+    }
+    for (; c < num_channels; ++c) {
+      frame[c] *= limiter_gain;
     }
+  }
+}
+
+void PostProcessorProcessSamples(PostProcessor* state,
+                                 float* input_output,
+                                 int num_frames) {
+  DenormalGuard guard;
+  DenormalGuardBegin(&guard);
+  FusedProcessor fused;
+  FusedBegin(state, &fused);
+  const int num_channels = state->num_channels;
 
+  int n;
+  for (n = 0; n < num_frames; ++n) {
+    FusedProcessFrame(&fused, input_output, input_output);
     input_output += num_channels;
   }
+
+  FusedEnd(&fused, state);
+  DenormalGuardEnd(&guard);
+}
+
+void PostProcessorProcessSamplesToPwm(PostProcessor* state,
+                                      const ChannelMap* channel_map,
+                                      const float* input,
+                                      int num_frames,
+                                      int pwm_top_value,
+                                      uint16_t* const* pwm_channels,
+                                      int pwm_stride) {
+  DenormalGuard guard;
+  DenormalGuardBegin(&guard);
+  FusedProcessor fused;
+  FusedBegin(state, &fused);
+  const int num_channels = state->num_channels;
+  const float* gains = channel_map->gains;
+  const int* sources = channel_map->sources;
+  const int num_output_channels = channel_map->num_output_channels;
+  /* Same conversion as Pwm::FloatToPwmSample(). */
+  const float pwm_scale = 0.5f * pwm_top_value;
+  const float pwm_offset = pwm_scale + 0.5f;
+
+  float frame[kPostProcessorMaxChannels];
+  int pwm_index = 0;
+  int n;
+  for (n = 0; n < num_frames; ++n) {
+    FusedProcessFrame(&fused, input, frame);
+
+    /* Map channels, apply channel gains, and convert to PWM. */
+    int c;
+    for (c = 0; c < num_output_channels; ++c) {
+      const float sample = gains[c] * frame[sources[c]];
+      pwm_channels[c][pwm_index] =
+          (uint16_t)(pwm_scale * sample + pwm_offset);
+    }
+
+    input += num_channels;
+    pwm_index += pwm_stride;
+  }
+
+  FusedEnd(&fused, state);
+  DenormalGuardEnd(&guard);
+}
+
+void PostProcessorMemoryUsage(const PostProcessor* state, MemoryUsage* usage) {
+  (void)state;
+  MemoryUsageZero(usage);
+  usage->state_bytes = sizeof(PostProcessor);
+  /* FastRsqrt() in the limiter uses no tables. */
 }
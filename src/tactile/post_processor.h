@@ -48,7 +48,11 @@
 #ifndef AUDIO_TO_TACTILE_SRC_TACTILE_POST_PROCESSOR_H_
 #define AUDIO_TO_TACTILE_SRC_TACTILE_POST_PROCESSOR_H_
 
+#include <stdint.h>
+
 #include "dsp/biquad_filter.h"
+#include "dsp/channel_map.h"
+#include "dsp/memory_usage.h"
 #include "tactile/tuning.h"
 
 #ifdef __cplusplus
@@ -76,20 +80,19 @@ typedef struct {
 /* Set `params` to default values. */
 void PostProcessorSetDefaultParams(PostProcessorParams* params);
 
-typedef struct {
-  BiquadFilterState equalizer_biquad_state[2];
-  BiquadFilterState lpf_biquad_state;
-} PostProcessorChannelState;
-
 typedef struct {
   BiquadFilterCoeffs equalizer_biquad_coeffs[2];
   BiquadFilterCoeffs lpf_biquad_coeffs;
   int num_channels;
 
-  PostProcessorChannelState channels[kPostProcessorMaxChannels];
+  /* Filter states, indexed by channel. */
+  BiquadFilterState equalizer_biquad_state[2][kPostProcessorMaxChannels];
+  BiquadFilterState lpf_biquad_state[kPostProcessorMaxChannels];
   float limit_grow_coeff;
   float output_limit;
   int recovery;
+  /* Bit mask of active channels, see PostProcessorSetActiveChannels(). */
+  uint32_t active_channels;
 } PostProcessor;
 
 /* Initializes post processing. Returns 1 on success, 0 on failure. */
@@ -101,18 +104,78 @@ int /*bool*/ PostProcessorInit(PostProcessor* state,
 /* Resets to initial state. */
 void PostProcessorReset(PostProcessor* state);
 
+/* Sets which channels are processed, where `active_channels` is a bit mask with
+ * bit c set if channel c is needed, e.g. from ChannelMapUsedInputs(). Inactive
+ * channels output zero and don't count toward the output limit. Four-channel
+ * groups with no active channel skip their filters entirely. Channels that
+ * become active start from zero filter state. Initially all channels are
+ * active.
+ */
+void PostProcessorSetActiveChannels(PostProcessor* state,
+                                    uint32_t active_channels);
+
+/* Number of floats in the PostProcessor warm state. */
+#define kPostProcessorWarmStateSize 1
+
+/* Gets the slowly-adapting "warm" state, the output power limit, as an array
+ * of kPostProcessorWarmStateSize floats. This may be persisted and later
+ * restored with PostProcessorSetWarmState(), e.g. after a reboot, so that a
+ * limit lowered for low battery is not forgotten.
+ */
+void PostProcessorGetWarmState(const PostProcessor* state, float* warm_state);
+
+/* Restores warm state from PostProcessorGetWarmState(). The limit is clamped
+ * to the valid range. Returns 1 on success, or 0 if `warm_state` has invalid
+ * values, in which case PostProcessor is unchanged.
+ */
+int /*bool*/ PostProcessorSetWarmState(PostProcessor* state,
+                                       const float* warm_state);
+
 /* Processes in-place in a streaming manner, where `input_output` points to an
- * array of `num_frames * num_channels` samples in interleaved order.
+ * array of `num_frames * num_channels` samples in interleaved order. Channels
+ * are processed four at a time with SIMD (see simd.h), in one pass per frame.
  */
 void PostProcessorProcessSamples(PostProcessor* state,
                                  float* input_output,
                                  int num_frames);
 
+/* Fused post processing, channel mapping, and PWM conversion in one pass over
+ * the frames. The result is bit-for-bit the same as
+ *
+ *   PostProcessorProcessSamples(state, x, num_frames);
+ *   ChannelMapApply(channel_map, x, num_frames, mapped);
+ *
+ * followed by converting each mapped sample to PWM like
+ * `Pwm::FloatToPwmSample()`, but without writing intermediate buffers.
+ *
+ * `input` is an array of `num_frames * num_channels` samples in interleaved
+ * order and is not modified. `channel_map->num_input_channels` should equal
+ * the PostProcessor's num_channels. Sample n of output channel c is written as
+ *
+ *   pwm_channels[c][n * pwm_stride] =
+ *       (uint16_t)(0.5 * pwm_top_value * (mapped sample + 1) + 0.5),
+ *
+ * where `pwm_channels` is an array of `channel_map->num_output_channels`
+ * pointers. No clipping is done, as with Pwm::FloatToPwmSample().
+ */
+void PostProcessorProcessSamplesToPwm(PostProcessor* state,
+                                      const ChannelMap* channel_map,
+                                      const float* input,
+                                      int num_frames,
+                                      int pwm_top_value,
+                                      uint16_t* const* pwm_channels,
+                                      int pwm_stride);
+
 /* Tells the post processor that the battery is low. When called, the post
  * processor scales down the output to consume less power.
  */
 void PostProcessorLowBattery(PostProcessor* state);
 
+/* Gets the memory used by `state`, see dsp/memory_usage.h. PostProcessor has
+ * no heap allocation; its state is sized for kPostProcessorMaxChannels.
+ */
+void PostProcessorMemoryUsage(const PostProcessor* state, MemoryUsage* usage);
+
 #ifdef __cplusplus
 }  /* extern "C" */
 #endif
@@ -0,0 +1,177 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "tactile/post_processor_fixed.h"
+
+#include <stdio.h>
+
+#include "dsp/fixed_point.h"
+
+/* Filtering is done in Q27, giving headroom over the Q15 input. */
+#define kFilterFracBits 27
+/* Format of output_limit. */
+#define kLimitFracBits 28
+/* Format of limit_grow_coeff. */
+#define kGrowCoeffFracBits 30
+
+/* Limits as in post_processor.c, in Q28. `output_limit` is constrained to
+ * [kLimitMin, kLimitMax] = [1.0, 6.0].
+ */
+static const uint32_t kLimitMin = UINT32_C(1) << kLimitFracBits;
+static const uint32_t kLimitMax = UINT32_C(6) << kLimitFracBits;
+/* kLimitReduceFactor = 0.8 in Q30. */
+static const uint32_t kLimitReduceFactor = UINT32_C(858993459);
+/* 0.8 * kLimitMax, the initial output_limit. */
+static const uint32_t kLimitInitial = UINT32_C(1288490189);
+/* kRecoveryLimit = 0.25. */
+static const uint32_t kRecoveryLimit = UINT32_C(1) << (kLimitFracBits - 2);
+static const int kRecoveryNumBuffers = 10;
+/* kClipAmplitude = 0.96 in Q27. */
+static const int32_t kClipAmplitude = INT32_C(128849019);
+
+/* Rounds a Q27 sample to Q15. */
+static int32_t RoundToQ15(int32_t sample) {
+  return (sample + (1 << (kFilterFracBits - 16))) >> (kFilterFracBits - 15);
+}
+
+int PostProcessorFixedInit(PostProcessorFixed* state,
+                           const PostProcessorParams* params,
+                           float sample_rate_hz,
+                           int num_channels) {
+  if (state == NULL || params == NULL) {
+    return 0;
+  }
+
+  /* Design in float, then convert to fixed point. */
+  PostProcessor design;
+  if (!PostProcessorInit(&design, params, sample_rate_hz, num_channels)) {
+    return 0;
+  }
+  int k;
+  for (k = 0; k < 2; ++k) {
+    if (!BiquadFilterFixedCoeffsFromFloat(&design.equalizer_biquad_coeffs[k],
+                                          &state->equalizer_biquad_coeffs[k])) {
+      fprintf(stderr, "PostProcessorFixedInit: Failed to convert equalizer.\n");
+      return 0;
+    }
+  }
+  if (!BiquadFilterFixedCoeffsFromFloat(&design.lpf_biquad_coeffs,
+                                        &state->lpf_biquad_coeffs)) {
+    fprintf(stderr,
+            "PostProcessorFixedInit: Failed to convert lowpass filter.\n");
+    return 0;
+  }
+
+  state->num_channels = num_channels;
+  state->limit_grow_coeff = (uint32_t)FixedFromFloat(
+      design.limit_grow_coeff, kGrowCoeffFracBits);
+  PostProcessorFixedReset(state);
+  return 1;
+}
+
+void PostProcessorFixedReset(PostProcessorFixed* state) {
+  int c;
+  for (c = 0; c < state->num_channels; ++c) {
+    BiquadFilterFixedInitZero(&state->equalizer_biquad_state[0][c]);
+    BiquadFilterFixedInitZero(&state->equalizer_biquad_state[1][c]);
+    BiquadFilterFixedInitZero(&state->lpf_biquad_state[c]);
+  }
+  state->output_limit = kLimitInitial;
+  state->recovery = 0;
+}
+
+void PostProcessorFixedLowBattery(PostProcessorFixed* state) {
+  if (!state->recovery) {
+    /* When battery goes low, reduce limit by a bit. */
+    state->output_limit = (uint32_t)(
+        ((uint64_t)state->output_limit * kLimitReduceFactor)
+        >> kGrowCoeffFracBits);
+    if (state->output_limit < kLimitMin) { state->output_limit = kLimitMin; }
+  }
+  state->recovery = kRecoveryNumBuffers;
+}
+
+void PostProcessorFixedProcessSamples(PostProcessorFixed* state,
+                                      int16_t* input_output,
+                                      int num_frames) {
+  uint32_t output_limit = state->output_limit;
+
+  if (state->recovery) {
+    /* Use extra low limit for a few buffers to give battery time to recover. */
+    output_limit = kRecoveryLimit;
+    --state->recovery;
+  } else if (output_limit < kLimitMax) {
+    /* Otherwise, slowly grow the limit. */
+    const uint64_t grown = ((uint64_t)output_limit * state->limit_grow_coeff
+        + (UINT64_C(1) << (kGrowCoeffFracBits - 1))) >> kGrowCoeffFracBits;
+    output_limit = (grown > kLimitMax) ? kLimitMax : (uint32_t)grown;
+    state->output_limit = output_limit;
+  }
+
+  const int num_channels = state->num_channels;
+  /* Limit in Q30, the format of the power of Q15 samples. */
+  const uint64_t output_limit_q30 = (uint64_t)output_limit << 2;
+  const int32_t log2_output_limit = FixedLog2(output_limit_q30);
+  int n;
+  for (n = 0; n < num_frames; ++n) {
+    /* Filtered samples of the current frame in Q27. The lowpass filter may
+     * overshoot 1.0 slightly, so the power limiter is applied before rounding
+     * and saturating to Q15.
+     */
+    int32_t frame[kPostProcessorMaxChannels];
+    uint64_t power = 0;
+
+    int c;
+    for (c = 0; c < num_channels; ++c) {
+      int32_t sample = (int32_t)input_output[c] * (1 << (kFilterFracBits - 15));
+      /* Apply equalizer. */
+      sample = BiquadFilterFixedProcessOneSample(
+          &state->equalizer_biquad_coeffs[0],
+          &state->equalizer_biquad_state[0][c], sample);
+      sample = BiquadFilterFixedProcessOneSample(
+          &state->equalizer_biquad_coeffs[1],
+          &state->equalizer_biquad_state[1][c], sample);
+
+      /* Apply hard clipping. */
+      if (sample > kClipAmplitude) { sample = kClipAmplitude; }
+      if (sample < -kClipAmplitude) { sample = -kClipAmplitude; }
+
+      /* Apply lowpass filter. */
+      sample = BiquadFilterFixedProcessOneSample(
+          &state->lpf_biquad_coeffs, &state->lpf_biquad_state[c], sample);
+      frame[c] = sample;
+
+      /* Accumulate power in Q30. */
+      const int32_t sample_q15 = RoundToQ15(sample);
+      power += (int64_t)sample_q15 * sample_q15;
+    }
+
+    /* Limit the power when needed. */
+    if (power > output_limit_q30) {
+      /* limiter_gain = sqrt(output_limit / power) in Q15. */
+      const int32_t limiter_gain = (int32_t)FixedExp2(
+          (log2_output_limit - FixedLog2(power)) / 2, 15);
+      for (c = 0; c < num_channels; ++c) {
+        frame[c] = (int32_t)(((int64_t)frame[c] * limiter_gain
+            + (1 << 14)) >> 15);
+      }
+    }
+
+    for (c = 0; c < num_channels; ++c) {
+      input_output[c] = FixedSaturateInt16(RoundToQ15(frame[c]));
+    }
+    input_output += num_channels;
+  }
+}
@@ -0,0 +1,88 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * Fixed-point PostProcessor for microcontrollers without an FPU.
+ *
+ * PostProcessorFixed computes the same processing as PostProcessor (see
+ * post_processor.h) with only integer arithmetic: equalization, gain, hard
+ * clipping to [-0.96, 0.96], lowpass filtering, and the output power limiter.
+ * Filters are fixed-point biquads (dsp/biquad_filter_fixed.h), computed on
+ * Q27 samples for headroom, and the limiter gain is computed with FixedLog2()
+ * and FixedExp2() (dsp/fixed_point.h).
+ *
+ * Samples are int16_t in Q15, i.e. 32768 represents 1.0, processed in place.
+ * The output matches the float PostProcessor to within 2e-4 (about 6 LSBs).
+ * When the power limiter is active, the difference is larger, up to about
+ * 0.5%, since the float PostProcessor approximates the limiter gain with
+ * FastPow(). The fixed-point limiter gain is accurate to about 1e-4.
+ *
+ * Parameters are the same PostProcessorParams as for PostProcessor.
+ * PostProcessorFixedInit() designs the filters in float and converts them, so
+ * on an FPU-less microcontroller it runs with software float emulation, but
+ * only once.
+ */
+
+#ifndef AUDIO_TO_TACTILE_SRC_TACTILE_POST_PROCESSOR_FIXED_H_
+#define AUDIO_TO_TACTILE_SRC_TACTILE_POST_PROCESSOR_FIXED_H_
+
+#include <stdint.h>
+
+#include "dsp/biquad_filter_fixed.h"
+#include "tactile/post_processor.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+  BiquadFilterFixedCoeffs equalizer_biquad_coeffs[2];
+  BiquadFilterFixedCoeffs lpf_biquad_coeffs;
+  int num_channels;
+
+  /* Filter states, indexed by channel. */
+  BiquadFilterFixedState equalizer_biquad_state[2][kPostProcessorMaxChannels];
+  BiquadFilterFixedState lpf_biquad_state[kPostProcessorMaxChannels];
+  /* Growth factor per buffer for output_limit in Q30. */
+  uint32_t limit_grow_coeff;
+  /* Limit for summed output power in Q28. */
+  uint32_t output_limit;
+  int recovery;
+} PostProcessorFixed;
+
+/* Initializes post processing. Returns 1 on success, 0 on failure. */
+int /*bool*/ PostProcessorFixedInit(PostProcessorFixed* state,
+                                    const PostProcessorParams* params,
+                                    float sample_rate_hz,
+                                    int num_channels);
+
+/* Resets to initial state. */
+void PostProcessorFixedReset(PostProcessorFixed* state);
+
+/* Processes in-place in a streaming manner, where `input_output` points to an
+ * array of `num_frames * num_channels` Q15 samples in interleaved order.
+ */
+void PostProcessorFixedProcessSamples(PostProcessorFixed* state,
+                                      int16_t* input_output,
+                                      int num_frames);
+
+/* Tells the post processor that the battery is low, like
+ * PostProcessorLowBattery().
+ */
+void PostProcessorFixedLowBattery(PostProcessorFixed* state);
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif
+#endif /* AUDIO_TO_TACTILE_SRC_TACTILE_POST_PROCESSOR_FIXED_H_ */
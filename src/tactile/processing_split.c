@@ -0,0 +1,119 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "tactile/processing_split.h"
+
+#include <math.h>
+#include <stdio.h>
+
+#include "tactile/enveloper.h"
+
+uint8_t TactileFeaturesEncodeEnvelope(float value) {
+  /* This comparison is false for NaN, which is coded as 0. */
+  if (!(value > 0.0f)) { return 0; }
+  if (value >= kTactileFeaturesMaxEnvelope) { return 255; }
+  return (uint8_t)(
+      255.0f * (float)sqrt(value / kTactileFeaturesMaxEnvelope) + 0.5f);
+}
+
+float TactileFeaturesDecodeEnvelope(uint8_t code) {
+  const float x = code / 255.0f;
+  return kTactileFeaturesMaxEnvelope * x * x;
+}
+
+void TactileFeaturesEncode(const float* envelopes, int num_frames,
+                           const float* hex_weights, uint8_t* envelope_codes,
+                           uint8_t* hex_codes) {
+  const int num_values = num_frames * kEnveloperNumChannels;
+  int i;
+  for (i = 0; i < num_values; ++i) {
+    envelope_codes[i] = TactileFeaturesEncodeEnvelope(envelopes[i]);
+  }
+  for (i = 0; i < kTactileFeaturesNumHexWeights; ++i) {
+    const float w = hex_weights[i];
+    /* Weights are in [0, 1]. Clamp anyway, coding NaN as 0. */
+    hex_codes[i] = (w > 0.0f) ?
+        ((w < 1.0f) ? (uint8_t)(255.0f * w + 0.5f) : 255) : 0;
+  }
+}
+
+void TactileFeaturesDecode(const uint8_t* envelope_codes, int num_frames,
+                           const uint8_t* hex_codes, float* envelopes,
+                           float* hex_weights) {
+  const int num_values = num_frames * kEnveloperNumChannels;
+  int i;
+  for (i = 0; i < num_values; ++i) {
+    envelopes[i] = TactileFeaturesDecodeEnvelope(envelope_codes[i]);
+  }
+  for (i = 0; i < kTactileFeaturesNumHexWeights; ++i) {
+    hex_weights[i] = hex_codes[i] / 255.0f;
+  }
+}
+
+int ProcessingSplitSelectorInit(ProcessingSplitSelector* selector,
+                                int split, float moved_load, float margin) {
+  if (selector == NULL ||
+      !(split == kProcessingSplitSleeve || split == kProcessingSplitPuck) ||
+      !(moved_load > 0.0f) || !(margin >= 0.0f)) {
+    fprintf(stderr, "ProcessingSplitSelectorInit: Invalid arguments.\n");
+    return 0;
+  }
+  selector->split = split;
+  selector->moved_load = moved_load;
+  selector->margin = margin;
+  selector->load_before_switch = -1.0f;
+  return 1;
+}
+
+/* Gets the load used for selection, counting overruns as full load. */
+static float EffectiveLoad(const DeadlineMonitorStats* stats) {
+  return (stats->num_overruns > 0 && stats->mean_load < 1.0f)
+      ? 1.0f : stats->mean_load;
+}
+
+int ProcessingSplitSelectorUpdate(ProcessingSplitSelector* selector,
+                                  const DeadlineMonitorStats* puck_stats,
+                                  const DeadlineMonitorStats* sleeve_stats) {
+  if (puck_stats->num_buffers == 0 || sleeve_stats->num_buffers == 0) {
+    return selector->split;
+  }
+  const float puck_load = EffectiveLoad(puck_stats);
+  const float sleeve_load = EffectiveLoad(sleeve_stats);
+  /* `busy_load` is the load of the device running the moved stages. */
+  const int on_puck = (selector->split == kProcessingSplitPuck);
+  const float busy_load = on_puck ? puck_load : sleeve_load;
+  const float idle_load = on_puck ? sleeve_load : puck_load;
+
+  if (selector->load_before_switch >= 0.0f) {
+    /* First stats since the last switch. The idle device gave up the moved
+     * stages, so its drop in load measures them.
+     */
+    const float measured = selector->load_before_switch - idle_load;
+    if (measured > 0.0f) { selector->moved_load = measured; }
+    selector->load_before_switch = -1.0f;
+  }
+
+  const float moved = selector->moved_load;
+  const float max_load = (busy_load > idle_load) ? busy_load : idle_load;
+  const float busy_after = busy_load - moved;
+  const float idle_after = idle_load + moved;
+  const float max_load_after =
+      (busy_after > idle_after) ? busy_after : idle_after;
+  if (max_load_after + selector->margin < max_load) {
+    selector->load_before_switch = busy_load;
+    selector->split = on_puck ? kProcessingSplitSleeve : kProcessingSplitPuck;
+  }
+  return selector->split;
+}
@@ -0,0 +1,139 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * Partitioning of tactile processing between the puck and the sleeve.
+ *
+ * By default, the puck streams mic audio in kAudioSamples messages and the
+ * sleeve runs the whole TactileProcessor. Alternatively, the puck runs the
+ * costly stages, the Enveloper, CARL frontend and vowel embedding, with
+ * `TactileProcessorComputeFeatures()`, and sends the resulting features in a
+ * kTactileFeatures message (see cpp/message.h). The sleeve then only maps them
+ * to tactor outputs with `TactileProcessorWriteOutputs()` and runs the
+ * PostProcessor and PWM.
+ *
+ * The features for one block are the Enveloper output, coded as one byte per
+ * value with square-root companding, and the 7 vowel hex cluster weights for
+ * the end of the block, linearly coded as one byte each. For the sleeve's
+ * 64-sample blocks with 8x decimation, this is 39 bytes rather than 128.
+ *
+ * `ProcessingSplitSelector` chooses the split from the DeadlineMonitor stats
+ * of both devices, moving the costly stages to the device with more headroom
+ * when that lowers the max load of the two by at least a margin. The load of
+ * the moved stages is measured from the change in load at each switch.
+ *
+ * Example use:
+ *   // Puck, after receiving kDeadlineStats `sleeve_stats` from the sleeve.
+ *   DeadlineMonitorStats puck_stats;
+ *   DeadlineMonitorGetStats(&puck_monitor, &puck_stats);
+ *   const int split = selector.split;
+ *   if (ProcessingSplitSelectorUpdate(&selector, &puck_stats, &sleeve_stats)
+ *       != split) {
+ *     DeadlineMonitorReset(&puck_monitor);
+ *   }
+ *
+ *   // Puck, for each block when selector.split == kProcessingSplitPuck.
+ *   TactileProcessorComputeFeatures(processor, input, envelopes, hex_weights);
+ *   TactileFeaturesEncode(envelopes, num_frames, hex_weights,
+ *                         envelope_codes, hex_codes);
+ *   // Send the codes.
+ *
+ *   // Sleeve.
+ *   TactileFeaturesDecode(envelope_codes, num_frames, hex_codes,
+ *                         envelopes, hex_weights);
+ *   TactileProcessorWriteOutputs(processor, envelopes, hex_weights, output,
+ *                                kTactileProcessorNumTactors);
+ */
+
+#ifndef AUDIO_TO_TACTILE_SRC_TACTILE_PROCESSING_SPLIT_H_
+#define AUDIO_TO_TACTILE_SRC_TACTILE_PROCESSING_SPLIT_H_
+
+#include <stdint.h>
+
+#include "tactile/deadline_monitor.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Number of vowel hex cluster weights per block of features. */
+#define kTactileFeaturesNumHexWeights 7
+/* Max Enveloper output value that is coded. Larger values are clamped, which
+ * is inaudible in practice since the PostProcessor limits output to 1.
+ */
+#define kTactileFeaturesMaxEnvelope 2.0f
+
+/* Where the costly processing stages run. */
+typedef enum {
+  /* Puck streams audio, sleeve runs the whole TactileProcessor. */
+  kProcessingSplitSleeve = 0,
+  /* Puck computes features, sleeve maps them to tactor outputs. */
+  kProcessingSplitPuck = 1,
+} ProcessingSplit;
+
+typedef struct {
+  /* Current split, a ProcessingSplit value. */
+  int split;
+  /* Estimated load of the moved stages as a fraction of the buffer period. */
+  float moved_load;
+  /* Min reduction in the max load of the two devices to switch. */
+  float margin;
+  /* Load before the last switch of the device that gave up the moved stages,
+   * or negative once the moved load has been measured.
+   */
+  float load_before_switch;
+} ProcessingSplitSelector;
+
+/* Codes an Enveloper output value as a byte. */
+uint8_t TactileFeaturesEncodeEnvelope(float value);
+
+/* Inverse of TactileFeaturesEncodeEnvelope(). */
+float TactileFeaturesDecodeEnvelope(uint8_t code);
+
+/* Codes the features for one block, `num_frames` frames of interleaved
+ * Enveloper output `envelopes` and kTactileFeaturesNumHexWeights weights
+ * `hex_weights`. Writes `num_frames * kEnveloperNumChannels` codes to
+ * `envelope_codes` and kTactileFeaturesNumHexWeights codes to `hex_codes`.
+ */
+void TactileFeaturesEncode(const float* envelopes, int num_frames,
+                           const float* hex_weights, uint8_t* envelope_codes,
+                           uint8_t* hex_codes);
+
+/* Inverse of TactileFeaturesEncode(). */
+void TactileFeaturesDecode(const uint8_t* envelope_codes, int num_frames,
+                           const uint8_t* hex_codes, float* envelopes,
+                           float* hex_weights);
+
+/* Initializes the selector, starting with `split`. `moved_load` is the initial
+ * estimate of the moved stages' load, and `margin` is the min reduction in the
+ * max load of the two devices to switch, which adds hysteresis. Returns 1 on
+ * success, 0 on failure.
+ */
+int /*bool*/ ProcessingSplitSelectorInit(ProcessingSplitSelector* selector,
+                                         int split, float moved_load,
+                                         float margin);
+
+/* Updates the selector with deadline stats of the puck and sleeve, which
+ * should be accumulated since the last switch. A device with overruns counts
+ * as fully loaded. Returns the possibly changed split. Stats with no buffers
+ * are ignored.
+ */
+int ProcessingSplitSelectorUpdate(ProcessingSplitSelector* selector,
+                                  const DeadlineMonitorStats* puck_stats,
+                                  const DeadlineMonitorStats* sleeve_stats);
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif
+#endif /* AUDIO_TO_TACTILE_SRC_TACTILE_PROCESSING_SPLIT_H_ */
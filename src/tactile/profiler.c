@@ -0,0 +1,149 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#if !defined(_POSIX_C_SOURCE) || _POSIX_C_SOURCE < 199309L
+#undef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 199309L /* For clock_gettime(). */
+#endif
+
+#include "tactile/profiler.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "dsp/serialize.h"
+
+#if defined(__arm__) && (defined(__ARM_ARCH_7M__) || \
+    defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_MAIN__))
+#define PROFILER_USE_DWT 1
+/* Cortex-M debug registers for the DWT cycle counter. */
+#define kDemcr (*(volatile uint32_t*)0xe000edfc)
+#define kDwtCtrl (*(volatile uint32_t*)0xe0001000)
+#define kDwtCyccnt (*(volatile uint32_t*)0xe0001004)
+#define kDemcrTrcena (1u << 24)
+#define kDwtCtrlCyccntena 1u
+#else
+#include <time.h>
+#if defined(CLOCK_MONOTONIC)
+#define PROFILER_USE_CLOCK_GETTIME 1
+#endif
+#endif
+
+int /*bool*/ ProfilerInit(Profiler* profiler, int num_stages,
+                          int window_buffers) {
+  if (profiler == NULL) {
+    return 0;
+  } else if (!(1 <= num_stages && num_stages <= kProfilerMaxStages)) {
+    fprintf(stderr, "Error: Profiler num_stages must be between 1 and %d.\n",
+            kProfilerMaxStages);
+    return 0;
+  } else if (window_buffers < 1) {
+    fprintf(stderr, "Error: Profiler window_buffers must be positive.\n");
+    return 0;
+  }
+
+  ProfilerEnableTicks();
+  profiler->num_stages = num_stages;
+  profiler->window_buffers = window_buffers;
+  ProfilerReset(profiler);
+  return 1;
+}
+
+/* Clears stats for one window. */
+static void ClearStats(ProfilerStageStats* stats) {
+  int i;
+  for (i = 0; i < kProfilerMaxStages; ++i) {
+    stats[i].min_ticks = UINT32_MAX;
+    stats[i].max_ticks = 0;
+    stats[i].sum_ticks = 0;
+    stats[i].count = 0;
+  }
+}
+
+void ProfilerReset(Profiler* profiler) {
+  profiler->buffer_count = 0;
+  memset(profiler->start_ticks, 0, sizeof(profiler->start_ticks));
+  ClearStats(profiler->current);
+  ClearStats(profiler->last);
+}
+
+void ProfilerEnableTicks(void) {
+#ifdef PROFILER_USE_DWT
+  /* Enable the DWT cycle counter, if not already running. */
+  if (!(kDwtCtrl & kDwtCtrlCyccntena)) {
+    kDemcr |= kDemcrTrcena;
+    kDwtCyccnt = 0;
+    kDwtCtrl |= kDwtCtrlCyccntena;
+  }
+#endif
+}
+
+uint32_t ProfilerGetTicks(void) {
+#if defined(PROFILER_USE_DWT)
+  return kDwtCyccnt;
+#elif defined(PROFILER_USE_CLOCK_GETTIME)
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  /* Arithmetic is mod 2^32, so wraparound is fine for differences. */
+  return (uint32_t)t.tv_sec * UINT32_C(1000000000) + (uint32_t)t.tv_nsec;
+#else
+  return (uint32_t)clock();
+#endif
+}
+
+void ProfilerRecord(Profiler* profiler, int stage, uint32_t elapsed_ticks) {
+  ProfilerStageStats* stats = &profiler->current[stage];
+  if (elapsed_ticks < stats->min_ticks) { stats->min_ticks = elapsed_ticks; }
+  if (elapsed_ticks > stats->max_ticks) { stats->max_ticks = elapsed_ticks; }
+  stats->sum_ticks += elapsed_ticks;
+  ++stats->count;
+}
+
+void ProfilerFinishedBuffer(Profiler* profiler) {
+  if (++profiler->buffer_count >= profiler->window_buffers) {
+    memcpy(profiler->last, profiler->current, sizeof(profiler->last));
+    ClearStats(profiler->current);
+    profiler->buffer_count = 0;
+  }
+}
+
+void ProfilerGetStats(const Profiler* profiler, int stage, uint32_t* min_ticks,
+                      uint32_t* mean_ticks, uint32_t* max_ticks) {
+  const ProfilerStageStats* stats = &profiler->last[stage];
+  if (stats->count == 0) {
+    *min_ticks = 0;
+    *mean_ticks = 0;
+    *max_ticks = 0;
+  } else {
+    *min_ticks = stats->min_ticks;
+    *mean_ticks = (uint32_t)((stats->sum_ticks + stats->count / 2)
+        / stats->count);
+    *max_ticks = stats->max_ticks;
+  }
+}
+
+void ProfilerWriteStats(const Profiler* profiler, uint8_t* dest) {
+  int stage;
+  for (stage = 0; stage < profiler->num_stages; ++stage) {
+    uint32_t min_ticks;
+    uint32_t mean_ticks;
+    uint32_t max_ticks;
+    ProfilerGetStats(profiler, stage, &min_ticks, &mean_ticks, &max_ticks);
+    LittleEndianWriteU32(min_ticks, dest);
+    LittleEndianWriteU32(mean_ticks, dest + 4);
+    LittleEndianWriteU32(max_ticks, dest + 8);
+    dest += 12;
+  }
+}
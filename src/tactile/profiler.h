@@ -0,0 +1,146 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * Lightweight profiler for measuring time spent in firmware processing stages.
+ *
+ * The profiler keeps min, mean, and max elapsed time of each stage over a
+ * window of mic buffers, and can write these stats as a tap-out output (see
+ * tap_out.h) for capture with extras/python/tactile/run_tap_out.py.
+ *
+ * Time is measured in "ticks", whose meaning depends on the platform:
+ *
+ *  - On Cortex-M3/M4/M7/M33 (e.g. nRF52), ticks are CPU cycles from the DWT
+ *    cycle counter. The counter is enabled by `ProfilerInit()` or
+ *    `ProfilerEnableTicks()`.
+ *  - On POSIX hosts, ticks are nanoseconds from `clock_gettime()`.
+ *  - Otherwise, ticks are from the C standard `clock()`.
+ *
+ * Ticks are 32-bit and wrap around, which is fine for measuring intervals
+ * shorter than 2^32 ticks (about 67 s at 64 MHz, or 4.3 s on host).
+ *
+ * Example use:
+ *   enum { kStageProcess, kStageOutput, kNumStages };
+ *   Profiler profiler;
+ *   ProfilerInit(&profiler, kNumStages, 64);
+ *
+ *   static const TapOutDescriptor kProfileDescriptor =
+ *       {"profile", "uint32", 3, {1, kNumStages, 3}};
+ *   TapOutToken profile_token = TapOutAddDescriptor(&kProfileDescriptor);
+ *
+ *   // Processing loop, once per mic buffer.
+ *   ProfilerStart(&profiler, kStageProcess);
+ *   Process(...);
+ *   ProfilerStop(&profiler, kStageProcess);
+ *   ...
+ *   ProfilerFinishedBuffer(&profiler);
+ *
+ *   const TapOutSlice* slice;
+ *   if ((slice = TapOutGetSlice(profile_token))) {
+ *     ProfilerWriteStats(&profiler, slice->data);
+ *   }
+ */
+
+#ifndef AUDIO_TO_TACTILE_SRC_TACTILE_PROFILER_H_
+#define AUDIO_TO_TACTILE_SRC_TACTILE_PROFILER_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Max supported number of stages. */
+#define kProfilerMaxStages 8
+
+/* Accumulated stats for one stage. */
+typedef struct {
+  uint32_t min_ticks;
+  uint32_t max_ticks;
+  uint64_t sum_ticks;
+  uint32_t count;
+} ProfilerStageStats;
+
+typedef struct {
+  /* Number of stages. */
+  int num_stages;
+  /* Number of buffers in each stats window. */
+  int window_buffers;
+  /* Number of buffers so far in the current window. */
+  int buffer_count;
+  /* Tick count at the last `ProfilerStart()` for each stage. */
+  uint32_t start_ticks[kProfilerMaxStages];
+  /* Stats accumulated in the current window. */
+  ProfilerStageStats current[kProfilerMaxStages];
+  /* Stats of the last completed window. */
+  ProfilerStageStats last[kProfilerMaxStages];
+} Profiler;
+
+/* Initializes the profiler for `num_stages` stages, with stats computed over
+ * windows of `window_buffers` buffers. Returns 1 on success, 0 on failure.
+ */
+int /*bool*/ ProfilerInit(Profiler* profiler, int num_stages,
+                          int window_buffers);
+
+/* Resets all stats. */
+void ProfilerReset(Profiler* profiler);
+
+/* Enables the tick counter, if needed on this platform. This is called by
+ * `ProfilerInit()`, and is only needed to use `ProfilerGetTicks()` without a
+ * Profiler, e.g. in deadline_monitor.h.
+ */
+void ProfilerEnableTicks(void);
+
+/* Gets the current tick count. */
+uint32_t ProfilerGetTicks(void);
+
+/* Records that one run of `stage` took `elapsed_ticks` ticks. */
+void ProfilerRecord(Profiler* profiler, int stage, uint32_t elapsed_ticks);
+
+/* Marks the start of a run of `stage`. */
+static void ProfilerStart(Profiler* profiler, int stage) {
+  profiler->start_ticks[stage] = ProfilerGetTicks();
+}
+
+/* Marks the end of a run of `stage`, recording the ticks since the matching
+ * `ProfilerStart()` call.
+ */
+static void ProfilerStop(Profiler* profiler, int stage) {
+  ProfilerRecord(profiler, stage,
+                 ProfilerGetTicks() - profiler->start_ticks[stage]);
+}
+
+/* Indicates that a buffer has just finished. After every `window_buffers`
+ * buffers, the current stats become the "last" stats and a new window begins.
+ */
+void ProfilerFinishedBuffer(Profiler* profiler);
+
+/* Gets min, mean, and max ticks for `stage` over the last completed window.
+ * All are zero if the stage was not run in that window.
+ */
+void ProfilerGetStats(const Profiler* profiler, int stage, uint32_t* min_ticks,
+                      uint32_t* mean_ticks, uint32_t* max_ticks);
+
+/* Writes the stats of the last completed window to `dest` as an array of
+ * `num_stages * 3` uint32 values in little endian order, where
+ * [3 * s, 3 * s + 1, 3 * s + 2] are the min, mean, and max for stage s. This
+ * matches a tap-out descriptor with dtype "uint32" and shape
+ * {1, num_stages, 3}, one row per buffer.
+ */
+void ProfilerWriteStats(const Profiler* profiler, uint8_t* dest);
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif
+#endif /* AUDIO_TO_TACTILE_SRC_TACTILE_PROFILER_H_ */
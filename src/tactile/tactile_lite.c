@@ -71,9 +71,12 @@ int SingleBandEnvelopeInit(SingleBandEnvelope* state,
     fprintf(stderr,
             "SingleBandEnvelopeInit: Failed to design energy smoother.\n");
     return 0;
-  } else if (!DesignButterworthOrder2Bandpass(
+  }
+
+  BiquadFilterCoeffs input_filter_coeffs[kSingleBandEnvelopeInputSections];
+  if (!DesignButterworthOrder2Bandpass(
           params->bpf_low_edge_hz, params->bpf_high_edge_hz,
-          input_sample_rate_hz, state->bpf_biquad_coeffs)) {
+          input_sample_rate_hz, input_filter_coeffs + 2)) {
     fprintf(stderr,
             "SingleBandEnvelopeInit: Failed to design bandpass filter.\n");
     return 0;
@@ -81,17 +84,19 @@ int SingleBandEnvelopeInit(SingleBandEnvelope* state,
 
   if (!(params->feedback_hpf_cutoff_hz > 0.0f)) {
     /* Bypass the feedback highpass filter. */
-    state->feedback_hpf_biquad_coeffs[0] = kBiquadFilterIdentityCoeffs;
-    state->feedback_hpf_biquad_coeffs[1] = kBiquadFilterIdentityCoeffs;
+    input_filter_coeffs[0] = kBiquadFilterIdentityCoeffs;
+    input_filter_coeffs[1] = kBiquadFilterIdentityCoeffs;
   } else if (DesignChebyshev2Highpass(
                  4, params->feedback_hpf_stopband_ripple_db,
                  params->feedback_hpf_cutoff_hz, input_sample_rate_hz,
-                 state->feedback_hpf_biquad_coeffs, 2) != 2) {
+                 input_filter_coeffs, 2) != 2) {
     fprintf(stderr,
             "SingleBandEnvelopeInit: "
             "Failed to design feedback highpass filter.\n");
     return 0;
   }
+  BiquadCascadeInit(&state->input_filter, input_filter_coeffs,
+                    kSingleBandEnvelopeInputSections);
 
   state->input_sample_rate_hz = input_sample_rate_hz;
   state->decimation_factor = decimation_factor;
@@ -120,10 +125,7 @@ int SingleBandEnvelopeInit(SingleBandEnvelope* state,
 }
 
 void SingleBandEnvelopeReset(SingleBandEnvelope* state) {
-  BiquadFilterInitZero(&state->feedback_hpf_biquad_state[0]);
-  BiquadFilterInitZero(&state->feedback_hpf_biquad_state[1]);
-  BiquadFilterInitZero(&state->bpf_biquad_state[0]);
-  BiquadFilterInitZero(&state->bpf_biquad_state[1]);
+  BiquadCascadeStateInitZero(&state->input_filter_state);
   BiquadFilterInitZero(&state->energy_biquad_state);
   state->smoothed_energy = 0.0f;
   state->noise = 0.0f;
@@ -169,21 +171,9 @@ void SingleBandEnvelopeProcessSamples(SingleBandEnvelope* state,
 
     int j;
     for (j = 0; j < decimation_factor; ++j) {
-      /* Apply feedback highpass filter. */
-      float sample = BiquadFilterProcessOneSample(
-          &state->feedback_hpf_biquad_coeffs[0],
-          &state->feedback_hpf_biquad_state[0], input[j]);
-      sample = BiquadFilterProcessOneSample(
-          &state->feedback_hpf_biquad_coeffs[1],
-          &state->feedback_hpf_biquad_state[1], sample);
-
-      /* Apply bandpass filter. */
-      sample = BiquadFilterProcessOneSample(
-          &state->bpf_biquad_coeffs[0],
-          &state->bpf_biquad_state[0], sample);
-      sample = BiquadFilterProcessOneSample(
-          &state->bpf_biquad_coeffs[1],
-          &state->bpf_biquad_state[1], sample);
+      /* Apply feedback highpass and bandpass filters. */
+      const float sample = BiquadCascadeProcessOneSample(
+          &state->input_filter, &state->input_filter_state, input[j]);
 
       /* Half-wave rectification and squaring. */
       const float rectified = (sample > 0.0f) ? sample * sample : 0.0f;
@@ -47,6 +47,7 @@
 #ifndef AUDIO_TO_TACTILE_SRC_TACTILE_TACTILE_LITE_H_
 #define AUDIO_TO_TACTILE_SRC_TACTILE_TACTILE_LITE_H_
 
+#include "dsp/biquad_cascade.h"
 #include "dsp/biquad_filter.h"
 #include "dsp/decibels.h"
 
@@ -54,6 +55,9 @@
 extern "C" {
 #endif
 
+/* Number of sections in SingleBandEnvelope's input filter. */
+#define kSingleBandEnvelopeInputSections 4
+
 typedef struct {
   /* Feedback may be a problem in applications where the input is live
    * microphone audio, and if that microphone is close enough to the output
@@ -119,10 +123,11 @@ extern const SparsePeakPickerParams kDefaultSparsePeakPickerParams;
 typedef struct {
   /* Input sample rate in Hz. */
   float input_sample_rate_hz;
-  /* Feedback highpass filter coeffs, represented as two 2nd-order sections. */
-  BiquadFilterCoeffs feedback_hpf_biquad_coeffs[2];
-  /* Bandpass filter coefficients. */
-  BiquadFilterCoeffs bpf_biquad_coeffs[2];
+  /* Input filter, a cascade of kSingleBandEnvelopeInputSections sections: the
+   * feedback highpass filter in sections [0, 1], then the bandpass filter in
+   * sections [2, 3].
+   */
+  BiquadCascade input_filter;
   /* Energy envelope smoothing coefficients. */
   BiquadFilterCoeffs energy_biquad_coeffs;
   float gate_thresh_factor;
@@ -135,8 +140,7 @@ typedef struct {
   float compressor_delta;
   int num_warm_up_samples;
 
-  BiquadFilterState feedback_hpf_biquad_state[2];
-  BiquadFilterState bpf_biquad_state[2];
+  BiquadCascadeState input_filter_state;
   BiquadFilterState energy_biquad_state;
   /* Decimation factor after computing the energy envelope. */
   int decimation_factor;
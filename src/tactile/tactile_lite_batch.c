@@ -0,0 +1,505 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "tactile/tactile_lite_batch.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "dsp/aligned_alloc.h"
+#include "dsp/fast_fun_simd.h"
+#include "dsp/simd.h"
+
+/* Must match kCompressorStabilization in tactile_lite.c. */
+static const float kCompressorStabilization = 0.125f;
+/* Must match the peak picking threshold in tactile_lite.c. */
+static const float kMinPickedPeak = 0.05f;
+
+/* Per-instance coefficients. Each is an array over lanes, so that coefficient
+ * k for instance i is at coeffs[k * num_lanes + i]. Biquads take 5 entries in
+ * the order b0, b1, b2, a1, a2.
+ */
+enum {
+  kCoeffFeedbackHpf0 = 0,
+  kCoeffFeedbackHpf1 = 5,
+  kCoeffBpf0 = 10,
+  kCoeffBpf1 = 15,
+  kCoeffEnergy = 20,
+  kCoeffEnergySmoother = 25,
+  kCoeffGateThreshFactor,
+  kCoeffNoiseDecay,
+  kCoeffNoiseGrowth,
+  kCoeffGateTransitionFactor,
+  kCoeffAgcExponent,
+  kCoeffGainAttack,
+  kCoeffGainRelease,
+  kCoeffCompressorExponent,
+  kCoeffCompressorDelta,
+  kCoeffNumWarmUpSamples,
+  kCoeffSmoothedAttack,
+  kCoeffSmoothedRelease,
+  kCoeffThreshAttack,
+  kCoeffThreshRelease,
+  kCoeffMinPeakSpacing,
+  kNumCoeffs
+};
+
+/* Per-instance state, laid out like the coefficients. Biquads take 2 entries.
+ * Counters are stored as floats, which represent them exactly.
+ */
+enum {
+  kStateFeedbackHpf0 = 0,
+  kStateFeedbackHpf1 = 2,
+  kStateBpf0 = 4,
+  kStateBpf1 = 6,
+  kStateEnergy = 8,
+  kStateSmoothedEnergy = 10,
+  kStateNoise,
+  kStateSmoothedGain,
+  kStateWarmUpCounter,
+  kStatePickerSmoothed0,
+  kStatePickerSmoothed1,
+  kStatePickerThresh,
+  kStatePickerPeak,
+  kStatePickerSpacingCounter,
+  kNumStates
+};
+
+#define kNumBiquads 5
+
+typedef struct {
+  Float4 b0;
+  Float4 b1;
+  Float4 b2;
+  Float4 a1;
+  Float4 a2;
+} Biquad4Coeffs;
+
+typedef struct {
+  Float4 z0;
+  Float4 z1;
+} Biquad4State;
+
+/* Four-lane analog of BiquadFilterProcessOneSample(). */
+static Float4 Biquad4ProcessOneSample(const Biquad4Coeffs* coeffs,
+                                      Biquad4State* state, Float4 input) {
+  const Float4 next_state = Float4Sub(
+      Float4Sub(input, Float4Mul(coeffs->a1, state->z0)),
+      Float4Mul(coeffs->a2, state->z1));
+  const Float4 output = Float4Add(
+      Float4Add(Float4Mul(coeffs->b0, next_state),
+                Float4Mul(coeffs->b1, state->z0)),
+      Float4Mul(coeffs->b2, state->z1));
+  state->z1 = state->z0;
+  state->z0 = next_state;
+  return output;
+}
+
+/* Sets lane `i` of the biquad coefficients starting at index `k`. */
+static void SetBiquadCoeffs(TactileLiteBatch* batch, int k, int i,
+                            const BiquadFilterCoeffs* coeffs) {
+  float* dest = batch->coeffs + k * batch->num_lanes + i;
+  const int stride = batch->num_lanes;
+  dest[0 * stride] = coeffs->b0;
+  dest[1 * stride] = coeffs->b1;
+  dest[2 * stride] = coeffs->b2;
+  dest[3 * stride] = coeffs->a1;
+  dest[4 * stride] = coeffs->a2;
+}
+
+/* Sets all coefficients of lane `dest_lane` to those of `src_lane`. */
+static void CopyLaneCoeffs(TactileLiteBatch* batch, int dest_lane,
+                           int src_lane) {
+  int k;
+  for (k = 0; k < kNumCoeffs; ++k) {
+    float* coeffs = batch->coeffs + k * batch->num_lanes;
+    coeffs[dest_lane] = coeffs[src_lane];
+  }
+}
+
+TactileLiteBatch* TactileLiteBatchMake(
+    int num_instances, const SingleBandEnvelopeParams* envelope_params,
+    const SparsePeakPickerParams* peak_picker_params,
+    float input_sample_rate_hz, int decimation_factor, int max_block_size) {
+  if (envelope_params == NULL || peak_picker_params == NULL) { return NULL; }
+  if (!(num_instances >= 1) || !(decimation_factor >= 1) ||
+      !(max_block_size >= decimation_factor)) {
+    fprintf(stderr, "Error: Invalid TactileLiteBatch size arguments.\n");
+    return NULL;
+  }
+
+  TactileLiteBatch* batch =
+      (TactileLiteBatch*)AlignedAlloc(sizeof(TactileLiteBatch));
+  if (batch == NULL) {
+    fprintf(stderr, "Error: Memory allocation failed.\n");
+    goto fail;
+  }
+  batch->num_instances = num_instances;
+  batch->num_lanes = (num_instances + 3) & ~3;
+  batch->input_sample_rate_hz = input_sample_rate_hz;
+  batch->decimation_factor = decimation_factor;
+  batch->max_block_size = max_block_size;
+  batch->num_dropped_events = 0;
+
+  batch->coeffs =
+      (float*)AlignedAlloc(sizeof(float) * kNumCoeffs * batch->num_lanes);
+  batch->state =
+      (float*)AlignedAlloc(sizeof(float) * kNumStates * batch->num_lanes);
+  /* Zero-initialize so that padding lanes have zero input. */
+  batch->workspace =
+      (float*)AlignedCalloc((size_t)max_block_size * batch->num_lanes,
+                            sizeof(float));
+  if (batch->coeffs == NULL || batch->state == NULL ||
+      batch->workspace == NULL) {
+    fprintf(stderr, "Error: Memory allocation failed.\n");
+    goto fail;
+  }
+
+  int i;
+  for (i = 0; i < num_instances; ++i) {
+    if (!TactileLiteBatchSetParams(batch, i, &envelope_params[i],
+                                   &peak_picker_params[i])) {
+      fprintf(stderr, "Error: Invalid params for instance %d.\n", i);
+      goto fail;
+    }
+  }
+  /* Padding lanes get valid coefficients to avoid inf or NaN values. */
+  for (; i < batch->num_lanes; ++i) {
+    CopyLaneCoeffs(batch, i, num_instances - 1);
+    TactileLiteBatchResetInstance(batch, i);
+  }
+  return batch;
+
+fail:
+  TactileLiteBatchFree(batch);
+  return NULL;
+}
+
+void TactileLiteBatchFree(TactileLiteBatch* batch) {
+  if (batch) {
+    AlignedFree(batch->workspace);
+    AlignedFree(batch->state);
+    AlignedFree(batch->coeffs);
+    AlignedFree(batch);
+  }
+}
+
+int TactileLiteBatchSetParams(
+    TactileLiteBatch* batch, int instance,
+    const SingleBandEnvelopeParams* envelope_params,
+    const SparsePeakPickerParams* peak_picker_params) {
+  if (!(0 <= instance && instance < batch->num_instances)) { return 0; }
+
+  /* Use the scalar implementation to validate params and design filters. */
+  SingleBandEnvelope envelope;
+  SparsePeakPicker peak_picker;
+  if (!SingleBandEnvelopeInit(&envelope, envelope_params,
+                              batch->input_sample_rate_hz,
+                              batch->decimation_factor) ||
+      !SparsePeakPickerInit(
+          &peak_picker, peak_picker_params,
+          batch->input_sample_rate_hz / batch->decimation_factor)) {
+    return 0;
+  }
+
+  const int i = instance;
+  SetBiquadCoeffs(batch, kCoeffFeedbackHpf0, i,
+                  &envelope.input_filter.coeffs[0]);
+  SetBiquadCoeffs(batch, kCoeffFeedbackHpf1, i,
+                  &envelope.input_filter.coeffs[1]);
+  SetBiquadCoeffs(batch, kCoeffBpf0, i, &envelope.input_filter.coeffs[2]);
+  SetBiquadCoeffs(batch, kCoeffBpf1, i, &envelope.input_filter.coeffs[3]);
+  SetBiquadCoeffs(batch, kCoeffEnergy, i, &envelope.energy_biquad_coeffs);
+
+  float* coeffs = batch->coeffs + i;
+  const int stride = batch->num_lanes;
+  coeffs[kCoeffEnergySmoother * stride] = envelope.energy_smoother_coeff;
+  coeffs[kCoeffGateThreshFactor * stride] = envelope.gate_thresh_factor;
+  coeffs[kCoeffNoiseDecay * stride] = envelope.noise_coeffs[0];
+  coeffs[kCoeffNoiseGrowth * stride] = envelope.noise_coeffs[1];
+  coeffs[kCoeffGateTransitionFactor * stride] =
+      envelope.gate_transition_factor;
+  coeffs[kCoeffAgcExponent * stride] = envelope.agc_exponent;
+  coeffs[kCoeffGainAttack * stride] = envelope.gain_smoother_coeffs[0];
+  coeffs[kCoeffGainRelease * stride] = envelope.gain_smoother_coeffs[1];
+  coeffs[kCoeffCompressorExponent * stride] = envelope.compressor_exponent;
+  coeffs[kCoeffCompressorDelta * stride] = envelope.compressor_delta;
+  coeffs[kCoeffNumWarmUpSamples * stride] =
+      (float)envelope.num_warm_up_samples;
+  coeffs[kCoeffSmoothedAttack * stride] = peak_picker.smoothed_coeffs[0];
+  coeffs[kCoeffSmoothedRelease * stride] = peak_picker.smoothed_coeffs[1];
+  coeffs[kCoeffThreshAttack * stride] = peak_picker.thresh_coeffs[0];
+  coeffs[kCoeffThreshRelease * stride] = peak_picker.thresh_coeffs[1];
+  coeffs[kCoeffMinPeakSpacing * stride] =
+      (float)peak_picker.min_peak_spacing_samples;
+
+  TactileLiteBatchResetInstance(batch, i);
+  return 1;
+}
+
+void TactileLiteBatchReset(TactileLiteBatch* batch) {
+  int i;
+  for (i = 0; i < batch->num_lanes; ++i) {
+    TactileLiteBatchResetInstance(batch, i);
+  }
+}
+
+void TactileLiteBatchResetInstance(TactileLiteBatch* batch, int instance) {
+  const int stride = batch->num_lanes;
+  float* state = batch->state + instance;
+  const float* coeffs = batch->coeffs + instance;
+  int k;
+  for (k = 0; k < kNumStates; ++k) {
+    state[k * stride] = 0.0f;
+  }
+  state[kStateWarmUpCounter * stride] =
+      coeffs[kCoeffNumWarmUpSamples * stride];
+  state[kStatePickerSpacingCounter * stride] =
+      coeffs[kCoeffMinPeakSpacing * stride];
+}
+
+/* Processes lanes [4 * g, 4 * g + 3], appending events to `events`. Returns
+ * the updated number of events.
+ */
+static int ProcessGroup(TactileLiteBatch* batch, int g, int num_frames,
+                        float* const* envelope_outputs,
+                        TactileLiteEvent* events, int num_events,
+                        int max_events) {
+  const int num_lanes = batch->num_lanes;
+  const int decimation_factor = batch->decimation_factor;
+  const float* coeffs = batch->coeffs + 4 * g;
+  float* state = batch->state + 4 * g;
+  const Float4 kZero = Float4Broadcast(0.0f);
+  const Float4 kOne = Float4Broadcast(1.0f);
+  const Float4 kEpsilon = Float4Broadcast(1e-9f);
+  int k;
+
+#define LOAD_COEFF(k) Float4Load(coeffs + (k) * num_lanes)
+  Biquad4Coeffs biquad_coeffs[kNumBiquads];
+  Biquad4State biquad_state[kNumBiquads];
+  for (k = 0; k < kNumBiquads; ++k) {
+    biquad_coeffs[k].b0 = LOAD_COEFF(5 * k + 0);
+    biquad_coeffs[k].b1 = LOAD_COEFF(5 * k + 1);
+    biquad_coeffs[k].b2 = LOAD_COEFF(5 * k + 2);
+    biquad_coeffs[k].a1 = LOAD_COEFF(5 * k + 3);
+    biquad_coeffs[k].a2 = LOAD_COEFF(5 * k + 4);
+    biquad_state[k].z0 = Float4Load(state + (2 * k + 0) * num_lanes);
+    biquad_state[k].z1 = Float4Load(state + (2 * k + 1) * num_lanes);
+  }
+  const Float4 energy_smoother_coeff = LOAD_COEFF(kCoeffEnergySmoother);
+  const Float4 gate_thresh_factor = LOAD_COEFF(kCoeffGateThreshFactor);
+  const Float4 noise_decay = LOAD_COEFF(kCoeffNoiseDecay);
+  const Float4 noise_growth = LOAD_COEFF(kCoeffNoiseGrowth);
+  const Float4 gate_transition_factor = LOAD_COEFF(kCoeffGateTransitionFactor);
+  const Float4 agc_exponent = LOAD_COEFF(kCoeffAgcExponent);
+  const Float4 gain_attack = LOAD_COEFF(kCoeffGainAttack);
+  const Float4 gain_release = LOAD_COEFF(kCoeffGainRelease);
+  const Float4 compressor_exponent = LOAD_COEFF(kCoeffCompressorExponent);
+  const Float4 compressor_delta = LOAD_COEFF(kCoeffCompressorDelta);
+  const Float4 num_warm_up_samples = LOAD_COEFF(kCoeffNumWarmUpSamples);
+  const Float4 smoothed_attack = LOAD_COEFF(kCoeffSmoothedAttack);
+  const Float4 smoothed_release = LOAD_COEFF(kCoeffSmoothedRelease);
+  const Float4 thresh_attack = LOAD_COEFF(kCoeffThreshAttack);
+  const Float4 thresh_release = LOAD_COEFF(kCoeffThreshRelease);
+  const Float4 min_peak_spacing = LOAD_COEFF(kCoeffMinPeakSpacing);
+#undef LOAD_COEFF
+
+#define LOAD_STATE(k) Float4Load(state + (k) * num_lanes)
+  Float4 smoothed_energy = LOAD_STATE(kStateSmoothedEnergy);
+  /* As in the scalar implementation, the working noise estimate `noise` may
+   * differ from the stored value `stored_noise` during warm up.
+   */
+  Float4 noise = LOAD_STATE(kStateNoise);
+  Float4 stored_noise = noise;
+  Float4 smoothed_gain = LOAD_STATE(kStateSmoothedGain);
+  Float4 warm_up_counter = LOAD_STATE(kStateWarmUpCounter);
+  Float4 smoothed0 = LOAD_STATE(kStatePickerSmoothed0);
+  Float4 smoothed1 = LOAD_STATE(kStatePickerSmoothed1);
+  Float4 thresh = LOAD_STATE(kStatePickerThresh);
+  Float4 peak = LOAD_STATE(kStatePickerPeak);
+  Float4 spacing_counter = LOAD_STATE(kStatePickerSpacingCounter);
+#undef LOAD_STATE
+
+  const float* input = batch->workspace + 4 * g;
+  int t;
+  for (t = 0; t < num_frames; ++t) {
+    /* SingleBandEnvelope, as in SingleBandEnvelopeProcessSamples(). */
+    Float4 energy = kZero;
+    int j;
+    for (j = 0; j < decimation_factor; ++j, input += num_lanes) {
+      Float4 sample = Float4Load(input);
+      for (k = 0; k < 4; ++k) {  /* Feedback highpass and bandpass filters. */
+        sample =
+            Biquad4ProcessOneSample(&biquad_coeffs[k], &biquad_state[k], sample);
+      }
+      /* Half-wave rectification and squaring. */
+      const Float4 rectified = Float4Select(
+          Float4LessThan(kZero, sample), Float4Mul(sample, sample), kZero);
+      /* Lowpass filter the energy envelope. */
+      energy = Biquad4ProcessOneSample(&biquad_coeffs[4], &biquad_state[4],
+                                       rectified);
+    }
+    energy = Float4Max(energy, kZero);
+
+    smoothed_energy = Float4Add(smoothed_energy, Float4Mul(
+        energy_smoother_coeff, Float4Sub(energy, smoothed_energy)));
+
+    /* Noise estimate. While warming up, the stored noise is the sum of
+     * 2 * energy, except on the last warm up sample where it is the average.
+     */
+    const Int4 warming_up = Float4LessThan(kZero, warm_up_counter);
+    const Float4 warm_up_sum =
+        Float4Add(noise, Float4Mul(Float4Broadcast(2.0f), energy));
+    const Float4 warm_up_average = Float4Div(warm_up_sum, Float4Add(
+        Float4Sub(num_warm_up_samples, warm_up_counter), kOne));
+    const Float4 updated_noise = Float4Mul(noise, Float4Select(
+        Float4LessThan(noise, smoothed_energy), noise_growth, noise_decay));
+    stored_noise = Float4Select(
+        warming_up,
+        Float4Select(Float4LessThan(warm_up_counter, Float4Broadcast(1.5f)),
+                     warm_up_average, warm_up_sum),
+        updated_noise);
+    noise = Float4Max(
+        Float4Select(warming_up, warm_up_average, updated_noise), kEpsilon);
+
+    /* Soft noise gate and AGC gain. */
+    const Float4 gate_thresh = Float4Mul(gate_thresh_factor, noise);
+    const Float4 diff = Float4Sub(smoothed_energy, gate_thresh);
+    const Float4 diff_sqr = Float4Mul(diff, diff);
+    const Float4 halfway = Float4Mul(gate_transition_factor, gate_thresh);
+    const Float4 soft_gate = Float4Div(
+        diff_sqr, Float4Add(diff_sqr, Float4Mul(halfway, halfway)));
+    const Float4 gain = Float4Select(
+        Float4LessEqual(diff, kEpsilon), kZero,
+        Float4Mul(soft_gate, FastPowFloat4(
+            Float4Max(smoothed_energy, kEpsilon), agc_exponent)));
+
+    smoothed_gain = Float4Add(smoothed_gain, Float4Mul(
+        Float4Select(Float4LessThan(gain, smoothed_gain),
+                     gain_release, gain_attack),
+        Float4Sub(gain, smoothed_gain)));
+
+    /* Power law compression. */
+    const Float4 envelope = Float4Sub(
+        FastPowFloat4(Float4Add(Float4Mul(smoothed_gain, energy),
+                                compressor_delta), compressor_exponent),
+        Float4Broadcast(kCompressorStabilization));
+    warm_up_counter = Float4Select(
+        warming_up, Float4Sub(warm_up_counter, kOne), warm_up_counter);
+
+    /* SparsePeakPicker, as in SparsePeakPickerProcessSamples(). */
+    smoothed0 = Float4Add(smoothed0, Float4Mul(
+        Float4Select(Float4LessThan(envelope, smoothed0),
+                     smoothed_release, smoothed_attack),
+        Float4Sub(envelope, smoothed0)));
+    smoothed1 = Float4Add(smoothed1, Float4Mul(
+        smoothed_attack, Float4Sub(smoothed0, smoothed1)));
+    thresh = Float4Add(thresh, Float4Mul(
+        Float4Select(Float4LessThan(smoothed1, thresh),
+                     thresh_release, thresh_attack),
+        Float4Sub(smoothed1, thresh)));
+
+    /* Lanes take the first applicable case: counting down after a recent
+     * peak, growing the peak, or picking the peak.
+     */
+    const Int4 counting = Float4LessThan(kZero, spacing_counter);
+    const Int4 growing = Int4And(Float4LessEqual(thresh, smoothed1),
+                                 Float4LessEqual(peak, smoothed1));
+    const Int4 picking =
+        Float4LessThan(Float4Broadcast(kMinPickedPeak), peak);
+    const Float4 picked = Float4Select(counting, kZero,
+        Float4Select(growing, kZero, Float4Select(picking, peak, kZero)));
+    spacing_counter = Float4Select(
+        counting, Float4Sub(spacing_counter, kOne),
+        Float4Select(growing, spacing_counter,
+                     Float4Select(picking, min_peak_spacing, spacing_counter)));
+    peak = Float4Select(counting, peak,
+        Float4Select(growing, smoothed1,
+                     Float4Select(picking, kZero, peak)));
+
+    /* Write envelope output and events. */
+    if (envelope_outputs) {
+      float lanes[4];
+      Float4Store(lanes, envelope);
+      for (k = 0; k < 4 && 4 * g + k < batch->num_instances; ++k) {
+        envelope_outputs[4 * g + k][t] = lanes[k];
+      }
+    }
+    float picked_lanes[4];
+    Float4Store(picked_lanes, picked);
+    for (k = 0; k < 4 && 4 * g + k < batch->num_instances; ++k) {
+      if (picked_lanes[k] > 0.0f) {
+        if (num_events < max_events) {
+          events[num_events].instance = 4 * g + k;
+          events[num_events].frame = t;
+          events[num_events].peak = picked_lanes[k];
+          ++num_events;
+        } else {
+          ++batch->num_dropped_events;
+        }
+      }
+    }
+  }
+
+  for (k = 0; k < kNumBiquads; ++k) {
+    Float4Store(state + (2 * k + 0) * num_lanes, biquad_state[k].z0);
+    Float4Store(state + (2 * k + 1) * num_lanes, biquad_state[k].z1);
+  }
+#define STORE_STATE(k, value) Float4Store(state + (k) * num_lanes, (value))
+  STORE_STATE(kStateSmoothedEnergy, smoothed_energy);
+  STORE_STATE(kStateNoise, stored_noise);
+  STORE_STATE(kStateSmoothedGain, smoothed_gain);
+  STORE_STATE(kStateWarmUpCounter, warm_up_counter);
+  STORE_STATE(kStatePickerSmoothed0, smoothed0);
+  STORE_STATE(kStatePickerSmoothed1, smoothed1);
+  STORE_STATE(kStatePickerThresh, thresh);
+  STORE_STATE(kStatePickerPeak, peak);
+  STORE_STATE(kStatePickerSpacingCounter, spacing_counter);
+#undef STORE_STATE
+  return num_events;
+}
+
+int TactileLiteBatchProcessSamples(TactileLiteBatch* batch,
+                                   const float* const* inputs,
+                                   int num_samples,
+                                   float* const* envelope_outputs,
+                                   TactileLiteEvent* events, int max_events) {
+  if (num_samples > batch->max_block_size) {
+    fprintf(stderr, "Error: num_samples exceeds max_block_size.\n");
+    return 0;
+  }
+  const int num_lanes = batch->num_lanes;
+  const int num_frames = num_samples / batch->decimation_factor;
+  const int num_used = num_frames * batch->decimation_factor;
+
+  /* Transpose input to [num_used, num_lanes] layout. */
+  int i;
+  for (i = 0; i < batch->num_instances; ++i) {
+    const float* input = inputs[i];
+    float* dest = batch->workspace + i;
+    int n;
+    for (n = 0; n < num_used; ++n, dest += num_lanes) {
+      *dest = input[n];
+    }
+  }
+
+  int num_events = 0;
+  int g;
+  for (g = 0; g < num_lanes / 4; ++g) {
+    num_events = ProcessGroup(batch, g, num_frames, envelope_outputs, events,
+                              num_events, max_events);
+  }
+  return num_events;
+}
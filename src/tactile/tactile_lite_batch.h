@@ -0,0 +1,149 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * Batched "tactile lite", advancing many single-tactor instances in lockstep.
+ *
+ * `TactileLiteBatch` runs `num_instances` independent pairs of
+ * SingleBandEnvelope and SparsePeakPicker (see tactile_lite.h), for instance
+ * to serve many single-tactor devices from one hub. Each instance may have
+ * different params, but all share the input sample rate and decimation factor.
+ *
+ * Coefficients and state are stored in struct-of-arrays layout with the
+ * instance as the fastest-varying index, and instances are processed four at
+ * a time in Float4 lanes (see dsp/simd.h). Filtering and peak picking match
+ * the scalar implementation exactly; AGC and compression use FastPowFloat4()
+ * rather than the table-based FastPow(), so envelopes agree to within FastPow's
+ * error of about 0.5%.
+ *
+ * Rather than returning one peak value per instance, picked peaks are
+ * returned as a compact list of events. Each instance's events are in time
+ * order, and events are grouped by instance when at most 4 instances are in use.
+ *
+ * Example use:
+ *   SingleBandEnvelopeParams envelope_params[kNumDevices] = ...
+ *   SparsePeakPickerParams peak_picker_params[kNumDevices] = ...
+ *   TactileLiteBatch* batch = TactileLiteBatchMake(
+ *       kNumDevices, envelope_params, peak_picker_params,
+ *       sample_rate_hz, decimation_factor, kBlockSize);
+ *
+ *   TactileLiteEvent events[kMaxEvents];
+ *   while (...) {
+ *     const float* inputs[kNumDevices] = ...  // Each has `kBlockSize` samples.
+ *     const int num_events = TactileLiteBatchProcessSamples(
+ *         batch, inputs, kBlockSize, NULL, events, kMaxEvents);
+ *     for (i = 0; i < num_events; ++i) {
+ *       // Output a click on device events[i].instance with events[i].peak.
+ *     }
+ *   }
+ *
+ *   TactileLiteBatchFree(batch);
+ */
+
+#ifndef AUDIO_TO_TACTILE_SRC_TACTILE_TACTILE_LITE_BATCH_H_
+#define AUDIO_TO_TACTILE_SRC_TACTILE_TACTILE_LITE_BATCH_H_
+
+#include "tactile/tactile_lite.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* A peak picked by one instance. */
+typedef struct {
+  /* Index of the instance that picked the peak. */
+  int instance;
+  /* Index of the decimated output frame within the block where the peak was
+   * picked, between 0 and `num_samples / decimation_factor - 1`.
+   */
+  int frame;
+  /* Peak height, as would be returned by SparsePeakPickerProcessSamples. */
+  float peak;
+} TactileLiteEvent;
+
+typedef struct {
+  /* Number of instances. */
+  int num_instances;
+  /* Number of lanes, `num_instances` rounded up to a multiple of 4. Padding
+   * lanes have zero input and never report events.
+   */
+  int num_lanes;
+  float input_sample_rate_hz;
+  int decimation_factor;
+  /* Max number of input samples per call. */
+  int max_block_size;
+
+  /* Coefficients and state in struct-of-arrays layout, so that variable k for
+   * instance i is at `coeffs[k * num_lanes + i]`, and similarly for state.
+   */
+  float* coeffs;
+  float* state;
+  /* Workspace for the input in [max_block_size, num_lanes] layout. */
+  float* workspace;
+
+  /* Number of events dropped because the `events` array was full. */
+  int num_dropped_events;
+} TactileLiteBatch;
+
+/* Makes a `TactileLiteBatch` of `num_instances` instances, where instance i
+ * is configured with `envelope_params[i]` and `peak_picker_params[i]`. The
+ * caller should free it when done with `TactileLiteBatchFree`. Returns NULL on
+ * failure.
+ */
+TactileLiteBatch* TactileLiteBatchMake(
+    int num_instances, const SingleBandEnvelopeParams* envelope_params,
+    const SparsePeakPickerParams* peak_picker_params,
+    float input_sample_rate_hz, int decimation_factor, int max_block_size);
+
+/* Frees a `TactileLiteBatch`. */
+void TactileLiteBatchFree(TactileLiteBatch* batch);
+
+/* Sets params for instance `instance` and resets its state, leaving other
+ * instances unchanged. Returns 1 on success, 0 on failure.
+ */
+int /*bool*/ TactileLiteBatchSetParams(
+    TactileLiteBatch* batch, int instance,
+    const SingleBandEnvelopeParams* envelope_params,
+    const SparsePeakPickerParams* peak_picker_params);
+
+/* Resets all instances to initial state. */
+void TactileLiteBatchReset(TactileLiteBatch* batch);
+
+/* Resets instance `instance` to initial state. */
+void TactileLiteBatchResetInstance(TactileLiteBatch* batch, int instance);
+
+/* Processes one block for every instance. `inputs` is an array of
+ * `num_instances` pointers, each to `num_samples` samples, where `num_samples`
+ * is a multiple of `decimation_factor` and at most `max_block_size`. The same
+ * pointer may be passed for several instances to process the same audio with
+ * different params.
+ *
+ * If `envelope_outputs` is non-NULL, it is an array of `num_instances`
+ * pointers, each to space for `num_samples / decimation_factor` elements, that
+ * is filled with the SingleBandEnvelope output.
+ *
+ * Picked peaks are written to `events`, up to `max_events`. Returns the number
+ * of events written. Events past `max_events` are dropped and counted in
+ * `batch->num_dropped_events`.
+ */
+int TactileLiteBatchProcessSamples(TactileLiteBatch* batch,
+                                   const float* const* inputs,
+                                   int num_samples,
+                                   float* const* envelope_outputs,
+                                   TactileLiteEvent* events, int max_events);
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif
+#endif /* AUDIO_TO_TACTILE_SRC_TACTILE_TACTILE_LITE_BATCH_H_ */
@@ -19,6 +19,8 @@
 #include <math.h>
 #include <string.h>
 #include "dsp/fast_fun.h"
+#include "dsp/phase32_simd.h"
+#include "dsp/simd.h"
 
 /* Default gain in [0, 1]. SetGain and SetAllGain ops can override this. */
 static const float kDefaultGain = 0.15f;
@@ -28,6 +30,10 @@ static const float kFadeSeconds = 0.02f;
 static const float kChirpSeconds = 0.3f;
 static const float kChirpStartHz = 40.0f;
 static const float kChirpEndHz = 120.0f;
+/* Max number of frames to synthesize at a time with OscillatorBank. Must be a
+ * multiple of 4 for UpdateFadingState().
+ */
+#define kBlockFrames 64
 
 /* "Connect" pattern: low tone followed by two higher tones. */
 const char* kTactilePatternConnect = "66-A-A";
@@ -86,11 +92,11 @@ static float DecodeGain(uint8_t byte) {
 
 /* Sets the amplitude for channel `c` to `amplitude` and starts fading. */
 static void SetAmplitude(TactilePattern* p, int c, float amplitude) {
-  TactilePatternChannel* channel = &p->channels[c];
+  OscillatorBank* bank = &p->bank;
 
   /* Start fading to the new amplitude. */
-  channel->amplitude_fade_delta += channel->amplitude - amplitude;
-  channel->amplitude = amplitude;
+  bank->gain_fade_delta[c] += bank->gain[c] - amplitude;
+  bank->gain[c] = amplitude;
   p->fade.phase = 0;
   p->fade_counter = p->fade_frames;
 }
@@ -98,7 +104,7 @@ static void SetAmplitude(TactilePattern* p, int c, float amplitude) {
 /* Sets the waveform for channel `c` to `waveform`. */
 static void SetWaveform(TactilePattern* p, int c, int waveform) {
   TactilePatternChannel* channel = &p->channels[c];
-  if (channel->waveform == waveform && channel->amplitude > 0.0f) { return; }
+  if (channel->waveform == waveform && p->bank.gain[c] > 0.0f) { return; }
   float frequency_hz = 0.0f;
   float amplitude = channel->gain;
 
@@ -115,29 +121,27 @@ static void SetWaveform(TactilePattern* p, int c, int waveform) {
 
   channel->waveform = waveform;
   if (frequency_hz > 0.0f) {
-    channel->tone.frequency = FrequencyToPhase32(p, frequency_hz);
+    p->bank.frequency[c] = (int32_t)FrequencyToPhase32(p, frequency_hz);
   }
+  /* Grow the frequency of chirps exponentially. */
+  p->bank.frequency_ramp[c] =
+      (waveform == kTactilePatternWaveformChirp) ? p->chirp_rate : 1.0f;
   SetAmplitude(p, c, amplitude);
 }
 
 /* Sets the linear gain for channel `c` to `gain` and starts fading. */
 static void SetGain(TactilePattern* p, int c, float gain) {
-  TactilePatternChannel* channel = &p->channels[c];
-
-  if (channel->amplitude > 0.0f) {
+  if (p->bank.gain[c] > 0.0f) {
     SetAmplitude(p, c, gain);
   }
-  channel->gain = gain;
+  p->channels[c].gain = gain;
 }
 
 /* "Moves" a waveform from channel `c_from` to channel `c_to`. */
 static void MoveChannel(TactilePattern* p, int c_from, int c_to) {
-  TactilePatternChannel* channel_from = &p->channels[c_from];
-  TactilePatternChannel* channel_to = &p->channels[c_to];
-
-  channel_to->tone.frequency = channel_from->tone.frequency;
-  SetAmplitude(p, c_to,
-               channel_from->amplitude + channel_from->amplitude_fade_delta);
+  OscillatorBank* bank = &p->bank;
+  bank->frequency[c_to] = bank->frequency[c_from];
+  SetAmplitude(p, c_to, bank->gain[c_from] + bank->gain_fade_delta[c_from]);
 }
 
 static void Stop(TactilePattern* p) {
@@ -239,45 +243,52 @@ static void ExecuteOps(TactilePattern* p) {
   }
 }
 
-/* Updates fading state when a waveform is fading in/out to a new amplitude. */
-static void UpdateFadingState(TactilePattern* p) {
-  if (--p->fade_counter == 0) { /* Fading just completed. */
-    if (p->playback_state == kTactilePatternStateStopping) {
-      p->playback_state = kTactilePatternStateStopped;
-    }
-
-    int c;
-    for (c = 0; c < p->num_channels; ++c) {
-      p->channels[c].amplitude_fade_delta = 0.0f;
-    }
-    return;
+/* Updates fading state for the next `num_frames` frames, while a waveform is
+ * fading in/out to a new amplitude, and gets the fade weight for each frame.
+ * Returns 1 if fading completed within these frames.
+ *
+ * This is equivalent to stepping the fade oscillator frame by frame, but the
+ * number of fading frames is known in advance, so the Hann window weights are
+ * computed four frames at a time.
+ */
+static int /*bool*/ UpdateFadingState(TactilePattern* p, int num_frames,
+                                      float* fade_weights) {
+  /* The fade continues while the counter stays positive after decrementing. */
+  const int counter = p->fade_counter;
+  const int num_fading = (counter - 1 < num_frames) ? counter - 1 : num_frames;
+  const int32_t frequency = (int32_t)p->fade.frequency;
+  const int32_t lane_phases[4] = {frequency, (int32_t)(2u * frequency),
+                                  (int32_t)(3u * frequency),
+                                  (int32_t)(4u * frequency)};
+  const Int4 phase_step = Int4Broadcast(lane_phases[3]);
+  const Float4 kHalf = Float4Broadcast(0.5f);
+  const Float4 kOne = Float4Broadcast(1.0f);
+  Int4 phase = Int4Add(Int4Broadcast((int32_t)p->fade.phase),
+                       Int4Load(lane_phases));
+  int i;
+  /* Fade smoothly using a Hann window. Since kBlockFrames is a multiple of 4,
+   * the last group may write harmlessly past `num_fading`.
+   */
+  for (i = 0; i < num_fading; i += 4) {
+    Float4Store(fade_weights + i,
+                Float4Mul(kHalf, Float4Add(kOne, Phase32Cos4(phase))));
+    phase = Int4Add(phase, phase_step);
   }
-
-  /* Fade smoothly using a Hann window. */
-  OscillatorNext(&p->fade);
-  p->fade_weight = 0.5f * (1.0f + Phase32Cos(p->fade.phase));
-}
-
-/* Generate the next sample for channel `c`. */
-static float GenerateSample(TactilePattern* p, int c) {
-  TactilePatternChannel* channel = &p->channels[c];
-
-  OscillatorNext(&channel->tone);
-  float value = Phase32Sin(channel->tone.phase);
-
-  if (channel->waveform == kTactilePatternWaveformChirp) {
-    /* Grow the oscillator frequency to make an exponential chirp. */
-    channel->tone.frequency *= p->chirp_rate;
+  for (i = num_fading; i < num_frames; ++i) {
+    fade_weights[i] = 0.0f;
   }
 
-  if (p->fade_counter) {
-    value *= channel->amplitude
-        + channel->amplitude_fade_delta * p->fade_weight;
-  } else {
-    value *= channel->amplitude;
+  p->fade.phase += (uint32_t)num_fading * p->fade.frequency;
+  if (num_fading > 0) { p->fade_weight = fade_weights[num_fading - 1]; }
+  if (counter > num_frames) {
+    p->fade_counter = counter - num_frames;
+    return 0;
   }
-
-  return value;
+  p->fade_counter = 0;  /* Fading completed. */
+  if (p->playback_state == kTactilePatternStateStopping) {
+    p->playback_state = kTactilePatternStateStopped;
+  }
+  return 1;
 }
 
 void TactilePatternInit(TactilePattern* p, float sample_rate_hz,
@@ -296,6 +307,7 @@ void TactilePatternInit(TactilePattern* p, float sample_rate_hz,
    */
   p->chirp_rate =
       pow(kChirpEndHz / kChirpStartHz, 1.0f / (kChirpSeconds * sample_rate_hz));
+  OscillatorBankInit(&p->bank, num_channels);
   TactilePatternStartEx(p, NULL);
 }
 
@@ -309,33 +321,45 @@ void TactilePatternStartEx(TactilePattern* p, const uint8_t* ex_pattern) {
   int c;
   for (c = 0; c < p->num_channels; ++c) {
     TactilePatternChannel* channel = &p->channels[c];
-    channel->tone.phase = 0;
-    channel->tone.frequency = 0;
     channel->waveform = kTactilePatternWaveformSin25Hz;
-    channel->amplitude = 0.0f;
-    channel->amplitude_fade_delta = 0.0f;
     channel->gain = kDefaultGain;
   }
+  OscillatorBankInit(&p->bank, p->num_channels);
 }
 
 int TactilePatternSynthesize(TactilePattern* p, int num_frames, float* output) {
-  const int num_channels = p->num_channels;
+  float fade_weights[kBlockFrames];
 
-  int i;
-  for (i = 0; i < num_frames; ++i, output += num_channels) {
+  while (num_frames > 0) {
     if (p->num_frames_until_next_op <= 0) {
       ExecuteOps(p); /* Execute ops until the next Play or End op. */
     }
-    p->num_frames_until_next_op -= 1;
-
-    if (p->fade_counter) { /* If fading, update fading state variables. */
-      UpdateFadingState(p);
+    /* Synthesize in blocks up to the next op. Ops only change synthesis
+     * parameters between blocks.
+     */
+    int block_size = num_frames;
+    if (block_size > kBlockFrames) { block_size = kBlockFrames; }
+    if (block_size > p->num_frames_until_next_op) {
+      block_size = p->num_frames_until_next_op;
     }
+    p->num_frames_until_next_op -= block_size;
 
-    int c;
-    for (c = 0; c < num_channels; ++c) {
-      output[c] = GenerateSample(p, c);
+    const int /*bool*/ fading = (p->fade_counter != 0);
+    int /*bool*/ fade_completed = 0;
+    if (fading) { /* If fading, update fading state variables. */
+      fade_completed = UpdateFadingState(p, block_size, fade_weights);
+    }
+    OscillatorBankSynthesize(&p->bank, fading ? fade_weights : NULL,
+                             block_size, output);
+    if (fade_completed) {
+      int c;
+      for (c = 0; c < p->num_channels; ++c) {
+        p->bank.gain_fade_delta[c] = 0.0f;
+      }
     }
+
+    output += block_size * p->num_channels;
+    num_frames -= block_size;
   }
 
   return p->playback_state != kTactilePatternStateStopped;
@@ -474,3 +498,11 @@ int TactilePatternTranslateSimplePattern(const char* simple_pattern,
   *output = kTactilePatternOpEnd;
   return 1;
 }
+
+void TactilePatternMemoryUsage(const TactilePattern* p, MemoryUsage* usage) {
+  (void)p;
+  MemoryUsageZero(usage);
+  usage->state_bytes = sizeof(TactilePattern);
+  /* Oscillators and fades read the Phase32 sine table. */
+  usage->table_bytes = sizeof(kPhase32SinTable);
+}
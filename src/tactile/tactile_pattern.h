@@ -65,6 +65,8 @@
 #define AUDIO_TO_TACTILE_SRC_TACTILE_TACTILE_PATTERN_H_
 
 #include <stdint.h>
+#include "dsp/memory_usage.h"
+#include "dsp/oscillator_bank.h"
 #include "dsp/phase32.h"
 
 #ifdef __cplusplus
@@ -175,14 +177,6 @@ enum {
 
 /* Synthesis state for one channel/tactor. */
 typedef struct {
-  /* Oscillator for synthesizing sine waves and chirps. */
-  Oscillator tone;
-  /* Current signal amplitude, or the final amplitude during a fade. */
-  float amplitude;
-  /* During a fade, `amplitude + amplitude_fade_delta` is the starting
-   * amplitude and is weighted with `fade_weight`.
-   */
-  float amplitude_fade_delta;
   /* Linear gain for this channel. */
   float gain;
   /* Waveform currently being generated. */
@@ -191,6 +185,12 @@ typedef struct {
 
 typedef struct {
   TactilePatternChannel channels[kTactilePatternMaxChannels];
+  /* Oscillators for synthesizing sine waves and chirps, one per channel. For
+   * channel c, `bank.gain[c]` is the current signal amplitude, or the final
+   * amplitude during a fade, and `bank.gain[c] + bank.gain_fade_delta[c]` is
+   * the starting amplitude, weighted with `fade_weight`.
+   */
+  OscillatorBank bank;
   uint8_t buffer[kTactilePatternBufferSize];
 
   /* Pattern byte string. See the opcodes documentation above for details. */
@@ -277,6 +277,11 @@ int /*bool*/ TactilePatternSynthesize(TactilePattern* p,
                                       int num_frames,
                                       float* output);
 
+/* Gets the memory used by `p`, see dsp/memory_usage.h. TactilePattern has no
+ * heap allocation; its state is sized for the max number of channels.
+ */
+void TactilePatternMemoryUsage(const TactilePattern* p, MemoryUsage* usage);
+
 /* Returns 1 if the pattern is still playing, or 0 if completed. */
 static int /*bool*/ TactilePatternIsActive(const TactilePattern* p) {
   return p->playback_state != kTactilePatternStateStopped;
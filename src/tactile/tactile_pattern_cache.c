@@ -0,0 +1,385 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "tactile/tactile_pattern_cache.h"
+
+#include <string.h>
+
+#include "tactile/tactile_pattern_library.h"
+
+/* Patterns longer than this are not cached. This covers patterns stored in a
+ * TactilePatternLibrary, which may exceed kTactilePatternBufferSize bytes.
+ */
+static const int kMaxPatternSize = kTactilePatternLibraryMaxPatternBytes;
+/* Scale factors between float samples in [-1, 1] and int16. */
+static const float kToInt16 = 32767.0f;
+static const float kFromInt16 = 1.0f / 32767.0f;
+
+/* Rounds `size` up to a multiple of 2, to align int16 samples. */
+static int PadToEven(int size) { return (size + 1) & ~1; }
+
+/* Gets a pointer to an entry's int16 track samples. */
+static int16_t* EntryTracks(const TactilePatternCache* cache,
+                            const TactilePatternCacheEntry* entry) {
+  return (int16_t*)(cache->storage + entry->offset +
+                    PadToEven(entry->pattern_size));
+}
+
+/* Parses `pattern` to get its size in bytes, including the End op, and an
+ * upper bound on its duration in frames. Returns 0 if the pattern is too long.
+ */
+static int ParsePattern(const TactilePatternCache* cache,
+                        const uint8_t* pattern, int* max_frames) {
+  const float sample_rate_hz = cache->synth.sample_rate_hz;
+  /* The synthesizer fades out after the End op. */
+  int frames = cache->synth.fade_frames + 1;
+  int i = 0;
+
+  while (i < kMaxPatternSize) {
+    const uint8_t opcode = pattern[i++];
+    if (opcode >= 0x80) {
+      switch (opcode & 0xf0) {
+        case kTactilePatternOpPlay:
+        case kTactilePatternOpPlay + 0x10: {
+          /* Same as the frame count computed in tactile_pattern.c. */
+          const float duration_s = ((opcode & 0x1f) + 1) * 0.02f;
+          frames += (int)(duration_s * sample_rate_hz + 0.5f);
+        } break;
+        case kTactilePatternOpSetWaveform:
+        case kTactilePatternOpSetGain:
+          ++i;
+          break;
+        default: /* Any other op ends the pattern. */
+          *max_frames = frames;
+          return i;
+      }
+    } else {
+      switch (opcode) {
+        case kTactilePatternOpSetAllWaveform:
+        case kTactilePatternOpSetAllGain:
+        case kTactilePatternOpMove:
+          ++i;
+          break;
+        default: /* End op, or any other op ends the pattern. */
+          *max_frames = frames;
+          return i;
+      }
+    }
+  }
+  return 0;
+}
+
+/* Finds the entry for `pattern`, or returns -1 if not found. */
+static int FindEntry(const TactilePatternCache* cache, const uint8_t* pattern,
+                     int pattern_size) {
+  int i;
+  for (i = 0; i < cache->num_entries; ++i) {
+    const TactilePatternCacheEntry* entry = &cache->entries[i];
+    if (entry->pattern_size == pattern_size &&
+        !memcmp(cache->storage + entry->offset, pattern, pattern_size)) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+/* Evicts the least-recently-used entry other than `protected_index`, and
+ * compacts storage. Returns 0 if there is nothing to evict.
+ */
+static int EvictLeastRecentlyUsed(TactilePatternCache* cache,
+                                  int protected_index) {
+  int lru = -1;
+  int i;
+  for (i = 0; i < cache->num_entries; ++i) {
+    if (i != protected_index &&
+        (lru == -1 ||
+         cache->entries[i].last_used < cache->entries[lru].last_used)) {
+      lru = i;
+    }
+  }
+  if (lru == -1) { return 0; }
+
+  /* Move data of later entries down to fill the gap. */
+  const int offset = cache->entries[lru].offset;
+  const int size = cache->entries[lru].size;
+  memmove(cache->storage + offset, cache->storage + offset + size,
+          cache->storage_used - (offset + size));
+  cache->storage_used -= size;
+  for (i = 0; i < cache->num_entries; ++i) {
+    if (cache->entries[i].offset > offset) {
+      cache->entries[i].offset -= size;
+    }
+  }
+
+  /* Remove the entry from the array. */
+  for (i = lru; i + 1 < cache->num_entries; ++i) {
+    cache->entries[i] = cache->entries[i + 1];
+  }
+  --cache->num_entries;
+  if (cache->active_entry > lru) { --cache->active_entry; }
+
+  ++cache->stats.evictions;
+  return 1;
+}
+
+/* Synthesizes one frame with `cache->synth`, converted to int16. Returns 1 if
+ * the synthesizer is still active.
+ */
+static int RenderFrame(TactilePatternCache* cache, int16_t* frame) {
+  float samples[kTactilePatternMaxChannels];
+  const int active = TactilePatternSynthesize(&cache->synth, 1, samples);
+  int c;
+  for (c = 0; c < cache->synth.num_channels; ++c) {
+    float value = samples[c];
+    if (value > 1.0f) { value = 1.0f; }
+    if (value < -1.0f) { value = -1.0f; }
+    frame[c] = (int16_t)(kToInt16 * value + (value >= 0.0f ? 0.5f : -0.5f));
+  }
+  return active;
+}
+
+/* Renders the pattern that `cache->synth` was started with into a new entry.
+ * Returns the entry index, or -1 if it doesn't fit.
+ *
+ * Rendering is done in two passes, one frame at a time. The first pass finds
+ * the exact duration and which channels are silent or identical, without
+ * storing anything. The second pass writes only the distinct tracks, so that
+ * no scratch space is needed beyond the entry's final size.
+ */
+static int AddEntry(TactilePatternCache* cache, const uint8_t* pattern,
+                    int pattern_size, int max_frames, int protected_index) {
+  const int num_channels = cache->synth.num_channels;
+  int16_t frame[kTactilePatternMaxChannels];
+  /* Bit d of same_as[c] is set while channel c equals channel d < c. */
+  uint16_t same_as[kTactilePatternMaxChannels];
+  int /*bool*/ nonzero[kTactilePatternMaxChannels];
+  int c;
+  int d;
+  for (c = 0; c < num_channels; ++c) {
+    same_as[c] = (uint16_t)((1 << c) - 1);
+    nonzero[c] = 0;
+  }
+
+  /* First pass. */
+  int num_frames = 0;
+  int active = 1;
+  while (active && num_frames < max_frames) {
+    active = RenderFrame(cache, frame);
+    for (c = 0; c < num_channels; ++c) {
+      if (frame[c]) { nonzero[c] = 1; }
+      for (d = 0; d < c; ++d) {
+        if (frame[c] != frame[d]) { same_as[c] &= ~(1 << d); }
+      }
+    }
+    ++num_frames;
+  }
+  if (active) { return -1; }  /* Should not happen, max_frames is a bound. */
+
+  TactilePatternCacheEntry entry;
+  int num_tracks = 0;
+  for (c = 0; c < num_channels; ++c) {
+    entry.channel_track[c] = -1;
+    if (!nonzero[c]) { continue; }  /* Channel is silent. */
+    for (d = 0; d < c; ++d) {
+      if (nonzero[d] && (same_as[c] & (1 << d))) { break; }
+    }
+    entry.channel_track[c] =
+        (int8_t)((d < c) ? entry.channel_track[d] : num_tracks++);
+  }
+
+  const int padded_pattern_size = PadToEven(pattern_size);
+  entry.pattern_size = pattern_size;
+  entry.num_frames = num_frames;
+  entry.size = padded_pattern_size +
+               num_tracks * num_frames * (int)sizeof(int16_t);
+  if (entry.size > cache->storage_size) { return -1; }
+  while (cache->num_entries >= kTactilePatternCacheMaxEntries ||
+         cache->storage_size - cache->storage_used < entry.size) {
+    if (!EvictLeastRecentlyUsed(cache, protected_index)) { return -1; }
+  }
+
+  /* Second pass. */
+  ++cache->stats.misses;
+  entry.offset = cache->storage_used;
+  uint8_t* data = cache->storage + entry.offset;
+  memcpy(data, pattern, pattern_size);
+  int16_t* tracks = (int16_t*)(data + padded_pattern_size);
+  TactilePatternStartEx(&cache->synth, pattern);
+  int i;
+  for (i = 0; i < num_frames; ++i) {
+    RenderFrame(cache, frame);
+    for (c = 0; c < num_channels; ++c) {
+      /* Channels sharing a track have identical samples, so rewriting is
+       * harmless.
+       */
+      const int track = entry.channel_track[c];
+      if (track >= 0) { tracks[track * num_frames + i] = frame[c]; }
+    }
+  }
+
+  entry.last_used = cache->clock;
+  cache->storage_used += entry.size;
+  cache->entries[cache->num_entries] = entry;
+  return cache->num_entries++;
+}
+
+/* Looks up or renders the pattern that `cache->synth` was started with.
+ * Returns the entry index, or -1 if the pattern can't be cached.
+ */
+static int LookUpOrAdd(TactilePatternCache* cache, int protected_index,
+                       int /*bool*/ count_hit) {
+  const uint8_t* pattern = cache->synth.pattern;
+  int max_frames;
+  const int pattern_size = ParsePattern(cache, pattern, &max_frames);
+  if (!pattern_size) { return -1; }
+
+  int index = FindEntry(cache, pattern, pattern_size);
+  if (index >= 0) {
+    if (count_hit) { ++cache->stats.hits; }
+  } else {
+    index = AddEntry(cache, pattern, pattern_size, max_frames,
+                     protected_index);
+    if (index < 0) { return -1; }
+  }
+  cache->entries[index].last_used = ++cache->clock;
+  return index;
+}
+
+/* Starts playback of the pattern that `cache->synth` was started with. */
+static void StartPlayback(TactilePatternCache* cache) {
+  const uint8_t* pattern = cache->synth.pattern;
+  cache->active_entry = -1;
+  cache->position = 0;
+  if (!pattern) { return; }
+
+  cache->active_entry = LookUpOrAdd(cache, -1, 1);
+  if (cache->active_entry < 0) {
+    /* Play by live synthesis. Restart, since rendering may have advanced it. */
+    ++cache->stats.uncached;
+    TactilePatternStartEx(&cache->synth, pattern);
+    cache->active_entry = kTactilePatternCacheLive;
+  }
+}
+
+int TactilePatternCacheInit(TactilePatternCache* cache, uint8_t* storage,
+                            int storage_size, float sample_rate_hz,
+                            int num_channels) {
+  /* Storage must be 2-byte aligned for int16 samples. */
+  if (!cache || !storage || storage_size < 0 || ((uintptr_t)storage & 1)) {
+    return 0;
+  }
+  TactilePatternInit(&cache->synth, sample_rate_hz, num_channels);
+  cache->num_entries = 0;
+  cache->storage = storage;
+  cache->storage_size = storage_size & ~1;
+  cache->storage_used = 0;
+  cache->clock = 0;
+  cache->active_entry = -1;
+  cache->position = 0;
+  memset(&cache->stats, 0, sizeof(cache->stats));
+  return 1;
+}
+
+int TactilePatternCacheCompile(TactilePatternCache* cache,
+                               const uint8_t* ex_pattern) {
+  /* Rendering would clobber the synthesizer if it is playing live. */
+  if (!ex_pattern || cache->active_entry == kTactilePatternCacheLive) {
+    return 0;
+  }
+  TactilePatternStartEx(&cache->synth, ex_pattern);
+  return LookUpOrAdd(cache, cache->active_entry, 0) >= 0;
+}
+
+int TactilePatternCacheCompileSimple(TactilePatternCache* cache,
+                                     const char* simple_pattern) {
+  uint8_t buffer[kTactilePatternBufferSize];
+  return TactilePatternTranslateSimplePattern(simple_pattern, buffer,
+                                              kTactilePatternBufferSize) &&
+         TactilePatternCacheCompile(cache, buffer);
+}
+
+void TactilePatternCacheStartEx(TactilePatternCache* cache,
+                                const uint8_t* ex_pattern) {
+  TactilePatternStartEx(&cache->synth, ex_pattern);
+  StartPlayback(cache);
+}
+
+int TactilePatternCacheStart(TactilePatternCache* cache,
+                             const char* simple_pattern) {
+  const int success = TactilePatternStart(&cache->synth, simple_pattern);
+  StartPlayback(cache);
+  return success;
+}
+
+void TactilePatternCacheStartCalibrationTones(TactilePatternCache* cache,
+                                              int first_channel,
+                                              int second_channel) {
+  TactilePatternStartCalibrationTones(&cache->synth, first_channel,
+                                      second_channel);
+  StartPlayback(cache);
+}
+
+int TactilePatternCacheSynthesize(TactilePatternCache* cache, int num_frames,
+                                  float* output) {
+  const int num_channels = cache->synth.num_channels;
+  int num_copy = 0;
+
+  if (cache->active_entry == kTactilePatternCacheLive) {
+    if (!TactilePatternSynthesize(&cache->synth, num_frames, output)) {
+      cache->active_entry = -1;
+    }
+    return TactilePatternCacheIsActive(cache);
+  } else if (cache->active_entry >= 0) {
+    const TactilePatternCacheEntry* entry =
+        &cache->entries[cache->active_entry];
+    const int16_t* tracks = EntryTracks(cache, entry);
+    num_copy = entry->num_frames - cache->position;
+    if (num_copy > num_frames) { num_copy = num_frames; }
+
+    int c;
+    for (c = 0; c < num_channels; ++c) {
+      float* dest = output + c;
+      const int track = entry->channel_track[c];
+      int i;
+      if (track < 0) {
+        for (i = 0; i < num_copy; ++i, dest += num_channels) {
+          *dest = 0.0f;
+        }
+      } else {
+        const int16_t* src =
+            tracks + track * entry->num_frames + cache->position;
+        for (i = 0; i < num_copy; ++i, dest += num_channels) {
+          *dest = kFromInt16 * src[i];
+        }
+      }
+    }
+
+    cache->position += num_copy;
+    if (cache->position >= entry->num_frames) { cache->active_entry = -1; }
+  }
+
+  /* Pad with silence. */
+  memset(output + num_copy * num_channels, 0,
+         (num_frames - num_copy) * num_channels * sizeof(float));
+  return TactilePatternCacheIsActive(cache);
+}
+
+void TactilePatternCacheGetStats(const TactilePatternCache* cache,
+                                 TactilePatternCacheStats* stats) {
+  *stats = cache->stats;
+  stats->num_entries = cache->num_entries;
+  stats->bytes_used = cache->storage_used;
+  stats->bytes_capacity = cache->storage_size;
+}
@@ -0,0 +1,178 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * Cache of pre-rendered TactilePattern waveforms.
+ *
+ * TactilePatternSynthesize interprets the pattern ops and runs oscillators and
+ * fades for every output sample. For patterns that play often, like UI
+ * feedback, this cache renders each pattern once to int16 samples in a
+ * caller-provided storage buffer, so that playback is just a copy.
+ *
+ * Storage is kept compact by rendering per channel and storing each distinct
+ * channel signal ("track") once: silent channels store nothing, and channels
+ * playing the same signal share a track. Simple patterns, which play the same
+ * waveform on all channels, need only one track.
+ *
+ * When a new pattern doesn't fit, least-recently-used patterns are evicted. A
+ * pattern too large for the whole cache is played by live synthesis instead,
+ * so playback always works.
+ *
+ * Example use:
+ *   static uint8_t storage[16384];
+ *   TactilePatternCache cache;
+ *   TactilePatternCacheInit(&cache, storage, sizeof(storage),
+ *                           kSampleRateHz, kNumChannels);
+ *   // Optionally render frequently used patterns ahead of time.
+ *   TactilePatternCacheCompileSimple(&cache, kTactilePatternConfirm);
+ *
+ *   TactilePatternCacheStart(&cache, kTactilePatternConfirm);
+ *   float samples[kNumFrames * kNumChannels];
+ *   while (TactilePatternCacheSynthesize(&cache, kNumFrames, samples)) {
+ *     // ...
+ *   }
+ */
+
+#ifndef AUDIO_TO_TACTILE_SRC_TACTILE_TACTILE_PATTERN_CACHE_H_
+#define AUDIO_TO_TACTILE_SRC_TACTILE_TACTILE_PATTERN_CACHE_H_
+
+#include <stdint.h>
+
+#include "tactile/tactile_pattern.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Max number of cached patterns. */
+enum { kTactilePatternCacheMaxEntries = 8 };
+
+typedef struct {
+  /* Byte offset of the entry's data in storage. The data is the pattern bytes,
+   * padded to even size, followed by `num_tracks * num_frames` int16 samples.
+   */
+  int offset;
+  /* Total size of the entry's data in bytes. */
+  int size;
+  /* Size of the pattern bytes, including the End op. */
+  int pattern_size;
+  /* Number of frames in the rendered pattern. */
+  int num_frames;
+  /* Track index for each channel, or -1 if the channel is silent. */
+  int8_t channel_track[kTactilePatternMaxChannels];
+  /* Value of the cache's `clock` when the entry was last used. */
+  uint32_t last_used;
+} TactilePatternCacheEntry;
+
+typedef struct {
+  /* Number of Start calls that played a cached pattern. */
+  int hits;
+  /* Number of Start and Compile calls that rendered a pattern. */
+  int misses;
+  /* Number of entries evicted to make room. */
+  int evictions;
+  /* Number of Start calls that fell back to live synthesis. */
+  int uncached;
+  /* Number of cached patterns. */
+  int num_entries;
+  /* Storage bytes in use and total capacity. */
+  int bytes_used;
+  int bytes_capacity;
+} TactilePatternCacheStats;
+
+typedef struct {
+  /* Synthesizer for rendering, and for live playback of uncached patterns. */
+  TactilePattern synth;
+  TactilePatternCacheEntry entries[kTactilePatternCacheMaxEntries];
+  int num_entries;
+
+  /* Caller-provided storage. Entries are packed contiguously from the start. */
+  uint8_t* storage;
+  int storage_size;
+  int storage_used;
+
+  /* Counter incremented on each use, for LRU eviction. */
+  uint32_t clock;
+
+  /* Playback state. `active_entry` is the index of the entry being played,
+   * kTactilePatternCacheLive if playing by live synthesis, or -1 if stopped.
+   */
+  int active_entry;
+  /* Playback position in frames within the active entry. */
+  int position;
+
+  TactilePatternCacheStats stats;
+} TactilePatternCache;
+
+enum { kTactilePatternCacheLive = -2 };
+
+/* Initializes the cache to use `storage` of `storage_size` bytes, which must
+ * remain valid for the cache's lifetime. Returns 1 on success, 0 on failure.
+ */
+int /*bool*/ TactilePatternCacheInit(TactilePatternCache* cache,
+                                     uint8_t* storage, int storage_size,
+                                     float sample_rate_hz, int num_channels);
+
+/* Renders `ex_pattern` into the cache if not already cached, without playing
+ * it. Returns 1 if the pattern is cached, 0 if it doesn't fit or if a pattern
+ * is currently playing by live synthesis.
+ */
+int /*bool*/ TactilePatternCacheCompile(TactilePatternCache* cache,
+                                        const uint8_t* ex_pattern);
+
+/* Same as above, for a simple pattern string. */
+int /*bool*/ TactilePatternCacheCompileSimple(TactilePatternCache* cache,
+                                              const char* simple_pattern);
+
+/* Starts playing an extended format pattern, rendering it into the cache if
+ * needed. The counterpart of TactilePatternStartEx().
+ */
+void TactilePatternCacheStartEx(TactilePatternCache* cache,
+                                const uint8_t* ex_pattern);
+
+/* Starts playing a simple pattern. Returns 1 on success, 0 if the pattern is
+ * invalid. The counterpart of TactilePatternStart().
+ */
+int /*bool*/ TactilePatternCacheStart(TactilePatternCache* cache,
+                                      const char* simple_pattern);
+
+/* Starts playing calibration tones. The counterpart of
+ * TactilePatternStartCalibrationTones().
+ */
+void TactilePatternCacheStartCalibrationTones(TactilePatternCache* cache,
+                                              int first_channel,
+                                              int second_channel);
+
+/* Produces `num_frames` frames of interleaved output for `num_channels`
+ * channels, padding with silence once the pattern completes. Returns 1 if the
+ * pattern is still playing, 0 if it has completed. The counterpart of
+ * TactilePatternSynthesize().
+ */
+int /*bool*/ TactilePatternCacheSynthesize(TactilePatternCache* cache,
+                                           int num_frames, float* output);
+
+/* Returns 1 if a pattern is playing, or 0 if completed. */
+static int /*bool*/ TactilePatternCacheIsActive(
+    const TactilePatternCache* cache) {
+  return cache->active_entry != -1;
+}
+
+/* Gets cache statistics. */
+void TactilePatternCacheGetStats(const TactilePatternCache* cache,
+                                 TactilePatternCacheStats* stats);
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif
+#endif /* AUDIO_TO_TACTILE_SRC_TACTILE_TACTILE_PATTERN_CACHE_H_ */
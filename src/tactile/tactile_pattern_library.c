@@ -0,0 +1,199 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "tactile/tactile_pattern_library.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "dsp/serialize.h"
+#include "tactile/tactile_pattern.h"
+
+/* Magic number at the start of each slot, "TPL1" in little endian. */
+#define kSlotMagic UINT32_C(0x314c5054)
+
+/* Gets the flash address of the slot for pattern `id`. */
+static uint32_t SlotAddress(const TactilePatternLibrary* library, int id) {
+  return library->base_address + (uint32_t)id * library->page_size;
+}
+
+static int /*bool*/ IsValidId(const TactilePatternLibrary* library, int id) {
+  return 0 <= id && id < library->num_patterns;
+}
+
+/* Reads the header of slot `id`. Returns the pattern size and sets
+ * `*checksum`, or returns 0 if the slot is empty or invalid.
+ */
+static int ReadSlotHeader(const TactilePatternLibrary* library, int id,
+                          uint16_t* checksum) {
+  uint8_t header[kTactilePatternLibraryHeaderBytes];
+  library->flash.read(library->flash.user_data, SlotAddress(library, id),
+                      header, kTactilePatternLibraryHeaderBytes);
+  if (LittleEndianReadU32(header) != kSlotMagic) { return 0; }
+  const int size = LittleEndianReadU16(header + 4);
+  if (!(1 <= size && size <= kTactilePatternLibraryMaxPatternBytes)) {
+    return 0;
+  }
+  *checksum = LittleEndianReadU16(header + 6);
+  return size;
+}
+
+int /*bool*/ TactilePatternLibraryInit(TactilePatternLibrary* library,
+                                       const TactilePatternLibraryFlash* flash,
+                                       uint32_t base_address, int page_size,
+                                       int num_patterns) {
+  if (library == NULL || flash == NULL || flash->read == NULL ||
+      flash->write == NULL || flash->erase_page == NULL) {
+    return 0;
+  } else if (page_size < kTactilePatternLibraryHeaderBytes +
+                         kTactilePatternLibraryMaxPatternBytes) {
+    fprintf(stderr, "Error: page_size must be at least %d.\n",
+            kTactilePatternLibraryHeaderBytes +
+            kTactilePatternLibraryMaxPatternBytes);
+    return 0;
+  } else if (!(1 <= num_patterns &&
+               num_patterns <= kTactilePatternLibraryMaxPatterns)) {
+    fprintf(stderr, "Error: num_patterns must be between 1 and %d.\n",
+            kTactilePatternLibraryMaxPatterns);
+    return 0;
+  }
+
+  library->flash = *flash;
+  library->base_address = base_address;
+  library->page_size = page_size;
+  library->num_patterns = num_patterns;
+  library->upload_id = -1;
+  library->upload_size = 0;
+  library->upload_received = 0;
+  library->loaded_id = -1;
+
+  /* Only headers are read here. Checksums are verified when patterns are read
+   * by Get(), which reads the pattern bytes anyway.
+   */
+  int id;
+  for (id = 0; id < kTactilePatternLibraryMaxPatterns; ++id) {
+    uint16_t checksum;
+    library->pattern_sizes[id] =
+        (id < num_patterns) ? ReadSlotHeader(library, id, &checksum) : 0;
+  }
+  return 1;
+}
+
+/* Erases slot `id` and writes `size` bytes of `pattern` to it. */
+static int /*bool*/ WriteSlot(TactilePatternLibrary* library, int id,
+                              const uint8_t* pattern, int size) {
+  const uint32_t address = SlotAddress(library, id);
+  /* Invalidate the RAM copy, whether or not the write succeeds. */
+  library->pattern_sizes[id] = 0;
+  if (library->loaded_id == id) { library->loaded_id = -1; }
+
+  if (!library->flash.erase_page(library->flash.user_data, address)) {
+    return 0;
+  }
+  uint8_t header[kTactilePatternLibraryHeaderBytes];
+  LittleEndianWriteU32(kSlotMagic, header);
+  LittleEndianWriteU16((uint16_t)size, header + 4);
+  LittleEndianWriteU16(Fletcher16(pattern, size, 1), header + 6);
+  /* Write the header last, so that the slot is valid only once the pattern is
+   * completely written.
+   */
+  if (!library->flash.write(library->flash.user_data,
+                            address + kTactilePatternLibraryHeaderBytes,
+                            pattern, size) ||
+      !library->flash.write(library->flash.user_data, address, header,
+                            kTactilePatternLibraryHeaderBytes)) {
+    return 0;
+  }
+  library->pattern_sizes[id] = size;
+  return 1;
+}
+
+int TactilePatternLibraryWriteChunk(TactilePatternLibrary* library, int id,
+                                    int total_size, int offset,
+                                    const uint8_t* data, int data_size) {
+  if (!IsValidId(library, id) ||
+      !(0 <= total_size &&
+        total_size < kTactilePatternLibraryMaxPatternBytes) ||
+      data_size < 0 || (data == NULL && data_size > 0) ||
+      !(0 <= offset && offset + data_size <= total_size)) {
+    return kTactilePatternLibraryErrorInvalidArgs;
+  }
+
+  if (offset == 0) { /* Start a new upload. */
+    library->upload_id = id;
+    library->upload_size = total_size;
+    library->upload_received = 0;
+  } else if (id != library->upload_id ||
+             total_size != library->upload_size ||
+             offset != library->upload_received) {
+    library->upload_id = -1;
+    return kTactilePatternLibraryErrorOutOfOrder;
+  }
+
+  if (data_size > 0) {
+    memcpy(library->upload_buffer + offset, data, data_size);
+    library->upload_received += data_size;
+  }
+  if (library->upload_received < total_size) {
+    return kTactilePatternLibraryChunkAccepted;
+  }
+
+  library->upload_id = -1;
+  if (total_size == 0) {
+    return TactilePatternLibraryDelete(library, id)
+        ? kTactilePatternLibraryUploadComplete
+        : kTactilePatternLibraryErrorFlash;
+  }
+  library->upload_buffer[total_size] = kTactilePatternOpEnd;
+  return WriteSlot(library, id, library->upload_buffer, total_size + 1)
+      ? kTactilePatternLibraryUploadComplete
+      : kTactilePatternLibraryErrorFlash;
+}
+
+int /*bool*/ TactilePatternLibraryDelete(TactilePatternLibrary* library,
+                                         int id) {
+  if (!IsValidId(library, id)) { return 0; }
+  library->pattern_sizes[id] = 0;
+  if (library->loaded_id == id) { library->loaded_id = -1; }
+  return library->flash.erase_page(library->flash.user_data,
+                                   SlotAddress(library, id));
+}
+
+int /*bool*/ TactilePatternLibraryHas(const TactilePatternLibrary* library,
+                                      int id) {
+  return IsValidId(library, id) && library->pattern_sizes[id] > 0;
+}
+
+const uint8_t* TactilePatternLibraryGet(TactilePatternLibrary* library,
+                                        int id) {
+  if (!TactilePatternLibraryHas(library, id)) { return NULL; }
+  if (library->loaded_id == id) { return library->loaded_pattern; }
+
+  uint16_t checksum;
+  const int size = ReadSlotHeader(library, id, &checksum);
+  library->loaded_id = -1;
+  if (size != library->pattern_sizes[id]) { return NULL; }
+  library->flash.read(library->flash.user_data,
+                      SlotAddress(library, id) +
+                      kTactilePatternLibraryHeaderBytes,
+                      library->loaded_pattern, size);
+  if (Fletcher16(library->loaded_pattern, size, 1) != checksum) {
+    /* Corrupted, e.g. by power loss while writing. Treat as empty. */
+    library->pattern_sizes[id] = 0;
+    return NULL;
+  }
+  library->loaded_id = id;
+  return library->loaded_pattern;
+}
@@ -0,0 +1,165 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * Flash-resident library of extended-format tactile patterns, indexed by ID.
+ *
+ * A kTactileExPattern message carries at most Message::kMaxPayloadSize (= 128)
+ * bytes of pattern, and the whole pattern is sent again on every play.
+ * `TactilePatternLibrary` instead stores patterns of up to
+ * kTactilePatternLibraryMaxPatternBytes in flash, uploaded once in chunks
+ * (kTactilePatternChunk messages, see cpp/message.h), after which a
+ * kPlayTactilePattern message of a single ID byte plays one. The most recently
+ * played pattern is kept in RAM, so replaying it costs no flash read, and the
+ * returned bytes are stable so TactilePatternCache finds them cached.
+ *
+ * Pattern `id` is stored in slot `id`, which is one erasable flash page:
+ *
+ *   [magic: uint32][size: uint16][checksum: uint16][pattern: `size` bytes]
+ *
+ * where `size` includes the End op and `checksum` is the Fletcher-16 checksum
+ * of the pattern bytes. Multi-byte fields are little endian. To store a
+ * pattern, the page is erased, the pattern written, and the header written
+ * last, so a pattern interrupted by power loss reads as an empty slot. Each
+ * upload erases one page, so wear is negligible.
+ *
+ * Chunks of an upload must arrive in order, starting at offset 0. A chunk at
+ * offset 0 discards any incomplete upload. When the last chunk arrives, an End
+ * op is appended and the pattern is written to flash. Uploading a pattern of
+ * size 0 deletes it.
+ *
+ * Flash access is through callbacks as in envelope_log.h, so that this library
+ * is hardware agnostic and testable on the host.
+ *
+ * Example use:
+ *   TactilePatternLibrary library;
+ *   TactilePatternLibraryInit(&library, &flash, base_address, page_size,
+ *                             num_patterns);
+ *
+ *   // On receiving a kTactilePatternChunk message.
+ *   const int status = TactilePatternLibraryWriteChunk(
+ *       &library, id, total_size, offset, data, data_size);
+ *
+ *   // On receiving a kPlayTactilePattern message.
+ *   const uint8_t* pattern = TactilePatternLibraryGet(&library, id);
+ *   if (pattern) { TactilePatternCacheStartEx(&cache, pattern); }
+ */
+
+#ifndef AUDIO_TO_TACTILE_SRC_TACTILE_TACTILE_PATTERN_LIBRARY_H_
+#define AUDIO_TO_TACTILE_SRC_TACTILE_TACTILE_PATTERN_LIBRARY_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Max number of patterns in the library. */
+#define kTactilePatternLibraryMaxPatterns 16
+/* Max size in bytes of a stored pattern, including the End op. */
+#define kTactilePatternLibraryMaxPatternBytes 512
+/* Bytes in a slot header: magic number, size, and checksum. */
+#define kTactilePatternLibraryHeaderBytes 8
+
+/* Status of a chunk passed to TactilePatternLibraryWriteChunk(). */
+enum {
+  /* Chunk accepted, more are expected. */
+  kTactilePatternLibraryChunkAccepted = 0,
+  /* Last chunk accepted and the pattern was written to flash. */
+  kTactilePatternLibraryUploadComplete = 1,
+  /* Invalid ID, size, or offset. */
+  kTactilePatternLibraryErrorInvalidArgs = 2,
+  /* Chunk doesn't continue the upload in progress. The upload is discarded. */
+  kTactilePatternLibraryErrorOutOfOrder = 3,
+  /* Writing to flash failed. */
+  kTactilePatternLibraryErrorFlash = 4,
+};
+
+/* Callbacks for accessing flash. Addresses are absolute, as passed to Init. */
+typedef struct {
+  /* Reads `size` bytes at `address` into `dest`. */
+  void (*read)(void* user_data, uint32_t address, uint8_t* dest, int size);
+  /* Programs `size` bytes at `address`, which are in the erased state. Returns
+   * 1 on success, 0 on failure.
+   */
+  int /*bool*/ (*write)(void* user_data, uint32_t address,
+                        const uint8_t* src, int size);
+  /* Erases the page at `address` to all 0xff bytes. Returns 1 on success, 0 on
+   * failure.
+   */
+  int /*bool*/ (*erase_page)(void* user_data, uint32_t address);
+  /* Pointer passed to the callbacks. */
+  void* user_data;
+} TactilePatternLibraryFlash;
+
+typedef struct {
+  TactilePatternLibraryFlash flash;
+  /* Address of the first slot. */
+  uint32_t base_address;
+  /* Page size in bytes, which is also the slot size. */
+  int page_size;
+  /* Number of slots, so IDs are in [0, num_patterns). */
+  int num_patterns;
+  /* Size of each stored pattern, or 0 if the slot is empty. */
+  int pattern_sizes[kTactilePatternLibraryMaxPatterns];
+
+  /* Upload in progress. `upload_id` is -1 if there is none. */
+  int upload_id;
+  int upload_size;
+  int upload_received;
+  uint8_t upload_buffer[kTactilePatternLibraryMaxPatternBytes];
+
+  /* Pattern most recently returned by Get(), or -1 if none. */
+  int loaded_id;
+  uint8_t loaded_pattern[kTactilePatternLibraryMaxPatternBytes];
+} TactilePatternLibrary;
+
+/* Initializes the library for `num_patterns` slots of one `page_size`-byte
+ * page each, starting at `base_address`, and scans the slot headers to find
+ * the stored patterns. `page_size` must be at least
+ * kTactilePatternLibraryHeaderBytes + kTactilePatternLibraryMaxPatternBytes.
+ * Returns 1 on success, 0 on failure.
+ */
+int /*bool*/ TactilePatternLibraryInit(TactilePatternLibrary* library,
+                                       const TactilePatternLibraryFlash* flash,
+                                       uint32_t base_address, int page_size,
+                                       int num_patterns);
+
+/* Handles a chunk of `data_size` bytes at byte `offset` of an upload of a
+ * `total_size`-byte pattern for `id`. `total_size` excludes the End op that is
+ * appended, so it is at most kTactilePatternLibraryMaxPatternBytes - 1.
+ * Returns a kTactilePatternLibrary* status code.
+ */
+int TactilePatternLibraryWriteChunk(TactilePatternLibrary* library, int id,
+                                    int total_size, int offset,
+                                    const uint8_t* data, int data_size);
+
+/* Deletes pattern `id`. Returns 1 on success, 0 on failure. */
+int /*bool*/ TactilePatternLibraryDelete(TactilePatternLibrary* library,
+                                         int id);
+
+/* Returns 1 if pattern `id` is stored. */
+int /*bool*/ TactilePatternLibraryHas(const TactilePatternLibrary* library,
+                                      int id);
+
+/* Gets pattern `id`, reading it from flash unless it is the pattern returned
+ * by the previous call. Returns NULL if the pattern isn't stored or fails its
+ * checksum. The returned pointer is valid until the next call to Get().
+ */
+const uint8_t* TactilePatternLibraryGet(TactilePatternLibrary* library, int id);
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif
+#endif /* AUDIO_TO_TACTILE_SRC_TACTILE_TACTILE_PATTERN_LIBRARY_H_ */
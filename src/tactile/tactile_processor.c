@@ -15,20 +15,74 @@
 
 #include "tactile/tactile_processor.h"
 
+#include <math.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
+#include "dsp/aligned_alloc.h"
+#include "dsp/arena.h"
 #include "dsp/decibels.h"
+#include "dsp/fast_fun.h"
+#include "frontend/carl_frontend_design.h"
 #include "phonetics/hexagon_interpolation.h"
+#include "tactile/low_rate_stream.h"
 
 const int kTactileProcessorNumTactors = 10;
 
+/* Smoothing coefficient per block for the adaptive quality load estimate. */
+#define kQualityLoadSmoothing 0.25f
+/* After a quality change, number of blocks before the smoothed load may lower
+ * quality again, so that the estimate reflects the new level.
+ */
+#define kQualitySettleBlocks 8
+/* Bit mask of the vowel hex cluster tactors, output channels 1 to 7. */
+#define kHexClusterTactors UINT32_C(0xfe)
+
 void TactileProcessorSetDefaultParams(TactileProcessorParams* params) {
   if (params) {
     params->enveloper_params = kDefaultEnveloperParams;
     params->decimation_factor = 1;
     params->frontend_params = kCarlFrontendDefaultParams;
+    params->enable_silence_gating = 0;
+    params->silence_threshold = 1e-3f;
+    params->silence_hold_s = 0.25f;
+    params->silence_warm_start_blocks = 4;
+    params->vowel_embedding_stride = 1;
+    params->enable_adaptive_quality = 0;
+    params->quality_degrade_load = 0.85f;
+    params->quality_restore_load = 0.5f;
+    params->quality_restore_hold_s = 2.0f;
+    params->capture_sample_rate_hz = 0.0f;
+    params->frame_channel_offset = 0;
+  }
+}
+
+void TactileProcessorSetLowRateParams(TactileProcessorParams* params,
+                                      float sender_sample_rate_hz) {
+  if (params) {
+    TactileProcessorSetDefaultParams(params);
+    CarlFrontendParams* frontend_params = &params->frontend_params;
+    const float low_rate_hz = sender_sample_rate_hz / kLowRateStreamDecimation;
+    /* Skip the default design's channels down to the first pole that is as
+     * far below the low-rate Nyquist frequency as the highest pole is below
+     * the default one. The remaining poles are the same as the default's.
+     */
+    const double max_pole_hz = frontend_params->highest_pole_frequency_hz *
+        low_rate_hz / frontend_params->input_sample_rate_hz;
+    double pole_hz = frontend_params->highest_pole_frequency_hz;
+    int offset = 0;
+    while (pole_hz > max_pole_hz) {
+      pole_hz = CarlFrontendNextAuditoryFrequency(pole_hz,
+                                                  frontend_params->step_erbs);
+      ++offset;
+    }
+    frontend_params->input_sample_rate_hz = low_rate_hz;
+    frontend_params->block_size /= kLowRateStreamDecimation;
+    frontend_params->highest_pole_frequency_hz = (float)pole_hz;
+    params->frame_channel_offset = offset;
+    params->enveloper_params.side_energy_sample_rate_hz =
+        sender_sample_rate_hz;
   }
 }
 
@@ -37,69 +91,262 @@ float TactileProcessorOutputSampleRateHz(const TactileProcessorParams* params) {
       / params->decimation_factor;
 }
 
-TactileProcessor* TactileProcessorMake(TactileProcessorParams* params) {
-  if (params == NULL) { return NULL; }
+/* Sizes of the buffers that TactileProcessor lays out in its arena. */
+typedef struct {
+  size_t frontend_bytes;
+  size_t resampler_bytes;
+  int capture_max_input_frames;
+  int capture_slack;
+  int workspace_size;
+  int frame_size;
+  int warm_start_size;
+} TactileProcessorLayout;
 
-  TactileProcessor* processor = (TactileProcessor*)malloc(
-      sizeof(TactileProcessor));
-  if (processor == NULL) {
+/* Checks params and computes the layout. Returns 1 on success, 0 on failure. */
+static int ComputeLayout(const TactileProcessorParams* params,
+                         TactileProcessorLayout* layout) {
+  if (params == NULL) { return 0; }
+  const int block_size = params->frontend_params.block_size;
+  if (!(params->decimation_factor > 0) ||
+      block_size % params->decimation_factor != 0) {
+    fprintf(stderr, "Error: block_size must be an "
+            "integer multiple of decimation_factor.\n");
+    return 0;
+  } else if (params->vowel_embedding_stride < 1) {
+    fprintf(stderr, "Error: vowel_embedding_stride must be positive.\n");
+    return 0;
+  }
+  layout->frontend_bytes = CarlFrontendRequiredBytes(&params->frontend_params);
+  if (!layout->frontend_bytes) {
+    fprintf(stderr, "Error: CarlFrontendMake failed.\n");
+    return 0;
+  }
+  /* The workspace holds the Enveloper output followed by a copy of the input
+   * for the CARL frontend, which processes in place.
+   */
+  layout->workspace_size = kEnveloperNumChannels *
+      (block_size / params->decimation_factor) + block_size;
+  if (params->frame_channel_offset < 0) {
+    fprintf(stderr, "Error: frame_channel_offset must be nonnegative.\n");
+    return 0;
+  }
+  layout->frame_size = params->frame_channel_offset +
+      CarlFrontendCountNumOutputChannels(&params->frontend_params);
+
+  layout->resampler_bytes = 0;
+  layout->capture_max_input_frames = 0;
+  layout->capture_slack = 0;
+  if (params->capture_sample_rate_hz > 0.0f) {
+    const float ratio = params->capture_sample_rate_hz /
+        params->frontend_params.input_sample_rate_hz;
+    /* The resampler is run on at most enough input to complete one block. */
+    layout->capture_max_input_frames = (int)ceil(block_size * ratio);
+    layout->resampler_bytes = QResamplerRequiredBytes(
+        params->capture_sample_rate_hz,
+        params->frontend_params.input_sample_rate_hz, 1,
+        layout->capture_max_input_frames, NULL);
+    if (!layout->resampler_bytes) {
+      fprintf(stderr, "Error: QResamplerMake failed.\n");
+      return 0;
+    }
+    /* When upsampling, one input frame may produce several output frames, so
+     * leave room for them past the end of the block. The margin of 1 covers
+     * rounding in the resampler's rational approximation.
+     */
+    layout->capture_slack = (int)ceil(1.0f / ratio) + 1;
+    layout->workspace_size += layout->capture_slack;
+  }
+
+  layout->warm_start_size = 0;
+  if (params->enable_silence_gating) {
+    if (!(params->silence_threshold > 0.0f) ||
+        !(params->silence_hold_s >= 0.0f) ||
+        params->silence_warm_start_blocks < 0) {
+      fprintf(stderr, "Error: Invalid silence gating params.\n");
+      return 0;
+    }
+    layout->warm_start_size = params->silence_warm_start_blocks * block_size;
+  }
+  if (params->enable_adaptive_quality &&
+      !(0.0f < params->quality_restore_load &&
+        params->quality_restore_load < params->quality_degrade_load &&
+        params->quality_restore_hold_s >= 0.0f)) {
+    fprintf(stderr, "Error: Invalid adaptive quality params.\n");
+    return 0;
+  }
+  return 1;
+}
+
+/* Gets the buffer size needed for `layout`. */
+static size_t LayoutRequiredBytes(const TactileProcessorLayout* layout) {
+  /* The frontend is allocated aligned, so exclude its alignment slack. */
+  return kArenaAlignmentSlack +
+      ArenaAllocationSize(sizeof(TactileProcessor)) +
+      (layout->frontend_bytes - kArenaAlignmentSlack) +
+      ArenaAllocationSize(sizeof(float) * layout->workspace_size) +
+      ArenaAllocationSize(
+          sizeof(float) * kFrameBusNumSlots * layout->frame_size) +
+      ArenaAllocationSize(sizeof(float) * layout->warm_start_size) +
+      (layout->resampler_bytes ? layout->resampler_bytes - kArenaAlignmentSlack
+                               : 0);
+}
+
+size_t TactileProcessorRequiredBytes(const TactileProcessorParams* params) {
+  TactileProcessorLayout layout;
+  if (!ComputeLayout(params, &layout)) { return 0; }
+  return LayoutRequiredBytes(&layout);
+}
+
+TactileProcessor* TactileProcessorMake(TactileProcessorParams* params) {
+  const size_t required_bytes = TactileProcessorRequiredBytes(params);
+  if (!required_bytes) { return NULL; }
+  void* buffer = AlignedAlloc(required_bytes);
+  if (buffer == NULL) {
     fprintf(stderr, "Error: Memory allocation failed.\n");
-    goto fail;
+    return NULL;
+  }
+  TactileProcessor* processor =
+      TactileProcessorInitInBuffer(buffer, required_bytes, params);
+  if (processor == NULL) {
+    AlignedFree(buffer);
+    return NULL;
+  }
+  processor->allocation = buffer;
+  return processor;
+}
+
+TactileProcessor* TactileProcessorInitInBuffer(
+    void* buffer, size_t buffer_size, const TactileProcessorParams* params) {
+  TactileProcessorLayout layout;
+  if (!ComputeLayout(params, &layout)) { return NULL; }
+
+  /* Lay out the TactileProcessor struct, the CarlFrontend, and the buffers
+   * contiguously in `buffer`, in that order.
+   */
+  Arena arena;
+  ArenaInit(&arena, buffer, buffer_size);
+  TactileProcessor* processor =
+      (TactileProcessor*)ArenaAlloc(&arena, sizeof(TactileProcessor));
+  void* frontend_buffer = ArenaAlloc(
+      &arena, layout.frontend_bytes - kArenaAlignmentSlack);
+  float* frames = NULL;
+  if (processor == NULL || frontend_buffer == NULL ||
+      !(processor->workspace = (float*)ArenaAlloc(
+            &arena, sizeof(float) * layout.workspace_size)) ||
+      !(frames = (float*)ArenaAlloc(
+            &arena, sizeof(float) * kFrameBusNumSlots * layout.frame_size))) {
+    fprintf(stderr, "TactileProcessorInitInBuffer: Buffer is too small.\n");
+    return NULL;
+  }
+  processor->warm_start_buffer = NULL;
+  if (layout.warm_start_size > 0 &&
+      !(processor->warm_start_buffer = (float*)ArenaAlloc(
+            &arena, sizeof(float) * layout.warm_start_size))) {
+    fprintf(stderr, "TactileProcessorInitInBuffer: Buffer is too small.\n");
+    return NULL;
+  }
+  processor->capture_resampler = NULL;
+  processor->block_fill = 0;
+  processor->capture_slack = layout.capture_slack;
+  if (layout.resampler_bytes) {
+    /* As with the frontend, the resampler's alignment slack is unneeded. */
+    void* resampler_buffer = ArenaAlloc(
+        &arena, layout.resampler_bytes - kArenaAlignmentSlack);
+    if (resampler_buffer == NULL) {
+      fprintf(stderr, "TactileProcessorInitInBuffer: Buffer is too small.\n");
+      return NULL;
+    }
+    processor->capture_resampler = QResamplerInitInBuffer(
+        resampler_buffer, layout.resampler_bytes - kArenaAlignmentSlack,
+        params->capture_sample_rate_hz,
+        params->frontend_params.input_sample_rate_hz, 1,
+        layout.capture_max_input_frames, NULL);
+    if (processor->capture_resampler == NULL) {
+      fprintf(stderr, "Error: QResamplerMake failed.\n");
+      return NULL;
+    }
   }
-  processor->frontend = NULL;
-  processor->workspace = NULL;
-  processor->frame = NULL;
+  processor->allocation = NULL;
+  if (!FrameBusInit(&processor->frame_bus, frames, layout.frame_size)) {
+    return NULL;
+  }
+  /* The frontend writes past the first `frame_channel_offset` channels of each
+   * slot, so these stay zero.
+   */
+  processor->frame_channel_offset = params->frame_channel_offset;
+  memset(frames, 0, sizeof(float) * kFrameBusNumSlots * layout.frame_size);
+
   int i;
   for (i = 0; i < 7; ++i) {
     processor->vowel_hex_weights[i] = 0.0f;
   }
 
   const int sample_rate_hz = params->frontend_params.input_sample_rate_hz;
+  const int block_size = params->frontend_params.block_size;
   processor->decimation_factor = params->decimation_factor;
+  processor->vowel_embedding_stride = params->vowel_embedding_stride;
 
   /* Create Enveloper. */
   if (!EnveloperInit(&processor->enveloper, &params->enveloper_params,
                      sample_rate_hz, params->decimation_factor)) {
     fprintf(stderr, "Error: EnveloperInit failed.\n");
-    goto fail;
+    return NULL;
   }
 
-  /* Create CarlFrontend. */
-  const int block_size = params->frontend_params.block_size;
-  const int decimated_block_size = block_size / params->decimation_factor;
-  if (block_size % params->decimation_factor != 0) {
-    fprintf(stderr, "Error: block_size must be an "
-            "integer multiple of decimation_factor.\n");
-    goto fail;
-  }
-  processor->frontend = CarlFrontendMake(&params->frontend_params);
+  /* Create CarlFrontend. Since the frontend buffer is already aligned, the
+   * frontend's own alignment slack is unneeded.
+   */
+  processor->frontend = CarlFrontendInitInBuffer(
+      frontend_buffer, layout.frontend_bytes - kArenaAlignmentSlack,
+      &params->frontend_params);
   if (processor->frontend == NULL) {
     fprintf(stderr, "Error: CarlFrontendMake failed.\n");
-    goto fail;
-  }
-  int workspace_size = kEnveloperNumChannels * decimated_block_size;
-  if (workspace_size < block_size) { workspace_size = block_size; }
-  processor->workspace = (float*)malloc(workspace_size * sizeof(float));
-  processor->frame = (float*)malloc(
-      sizeof(float) * CarlFrontendNumChannels(processor->frontend));
-  if (processor->workspace == NULL || processor->frame == NULL) {
-    fprintf(stderr, "Error: Memory allocation failed.\n");
-    goto fail;
+    return NULL;
   }
 
-  return processor;
+  /* Set up silence gating. */
+  processor->enable_silence_gating = params->enable_silence_gating;
+  processor->silence_threshold = params->silence_threshold;
+  processor->silence_hold_blocks = 0;
+  processor->warm_start_blocks = 0;
+  if (params->enable_silence_gating) {
+    /* Round the hold duration up to a whole number of blocks. */
+    processor->silence_hold_blocks = (int)ceil(
+        params->silence_hold_s * sample_rate_hz / block_size);
+    if (processor->silence_hold_blocks < 1) {
+      processor->silence_hold_blocks = 1;
+    }
+    processor->warm_start_blocks = params->silence_warm_start_blocks;
+  }
+  processor->silent_block_count = 0;
+  processor->is_silent = 0;
+  processor->warm_start_count = 0;
+  processor->warm_start_index = 0;
 
-fail:
-  TactileProcessorFree(processor);
-  return NULL;
+  /* Set up adaptive quality. */
+  processor->enable_adaptive_quality = params->enable_adaptive_quality;
+  processor->quality_degrade_load = params->quality_degrade_load;
+  processor->quality_restore_load = params->quality_restore_load;
+  processor->quality_restore_hold_blocks = (int)ceil(
+      params->quality_restore_hold_s * sample_rate_hz / block_size);
+  processor->quality = kTactileQualityFull;
+  processor->smoothed_load = 0.0f;
+  processor->quality_restore_count = 0;
+  processor->quality_settle_count = 0;
+  processor->vowel_phase = 0;
+  processor->active_tactors =
+      (UINT32_C(1) << kTactileProcessorNumTactors) - 1;
+
+  EnveloperGetTuning(&processor->enveloper, &processor->tuning);
+  processor->has_tuning_knobs = 0;
+  processor->tuning_staged = 0;
+
+  return processor;
 }
 
 void TactileProcessorFree(TactileProcessor* processor) {
   if (processor) {
-    free(processor->frame);
-    free(processor->workspace);
-    CarlFrontendFree(processor->frontend);
-    free(processor);
+    AlignedFree(processor->allocation);
   }
 }
 
@@ -110,44 +357,341 @@ void TactileProcessorReset(TactileProcessor* processor) {
   for (i = 0; i < 7; ++i) {
     processor->vowel_hex_weights[i] = 0.0f;
   }
+  processor->silent_block_count = 0;
+  processor->is_silent = 0;
+  processor->warm_start_count = 0;
+  processor->warm_start_index = 0;
+  processor->quality = kTactileQualityFull;
+  processor->smoothed_load = 0.0f;
+  processor->quality_restore_count = 0;
+  processor->quality_settle_count = 0;
+  processor->vowel_phase = 0;
+  if (processor->capture_resampler) {
+    QResamplerReset(processor->capture_resampler);
+  }
+  processor->block_fill = 0;
 }
 
-void TactileProcessorProcessSamples(TactileProcessor* processor,
-    const float* input, float* output) {
+void TactileProcessorSetQuality(TactileProcessor* processor, int quality) {
+  if (quality < kTactileQualityFull) {
+    quality = kTactileQualityFull;
+  } else if (quality > kTactileQualityEnvelopeOnly) {
+    quality = kTactileQualityEnvelopeOnly;
+  }
+  if (quality == processor->quality) { return; }
+  /* The frontend missed input while paused, so restart it. */
+  if (processor->quality == kTactileQualityEnvelopeOnly) {
+    CarlFrontendReset(processor->frontend);
+  }
+  processor->quality = quality;
+  processor->quality_restore_count = 0;
+  processor->quality_settle_count = kQualitySettleBlocks;
+  processor->vowel_phase = 0;
+}
+
+/* Returns 1 if any vowel hex cluster tactor is in use. */
+static int /*bool*/ HexClusterActive(const TactileProcessor* processor) {
+  return (processor->active_tactors & kHexClusterTactors) != 0;
+}
+
+void TactileProcessorSetActiveTactors(TactileProcessor* processor,
+                                      uint32_t active_tactors) {
+  /* Get the Enveloper channels that the tactors are mapped from. */
+  int active_channels = 0;
+  if (active_tactors & 1) { active_channels |= 1; }
+  if (active_tactors & kHexClusterTactors) { active_channels |= 2; }
+  if (active_tactors & (1 << 8)) { active_channels |= 4; }
+  if (active_tactors & (1 << 9)) { active_channels |= 8; }
+  EnveloperSetActiveChannels(&processor->enveloper, active_channels);
+
+  if ((active_tactors & kHexClusterTactors) && !HexClusterActive(processor)) {
+    /* The frontend missed input while skipped, so restart it. */
+    CarlFrontendReset(processor->frontend);
+    processor->warm_start_count = 0;
+    processor->vowel_phase = 0;
+    memset(processor->vowel_hex_weights, 0,
+           sizeof(processor->vowel_hex_weights));
+    memset(processor->vowel_hex_start, 0, sizeof(processor->vowel_hex_start));
+    memset(processor->vowel_hex_target, 0,
+           sizeof(processor->vowel_hex_target));
+  }
+  processor->active_tactors = active_tactors;
+}
+
+void TactileProcessorUpdateLoad(TactileProcessor* processor, float load) {
+  if (!processor->enable_adaptive_quality || !(load >= 0.0f)) { return; }
+  processor->smoothed_load +=
+      kQualityLoadSmoothing * (load - processor->smoothed_load);
+  if (processor->quality_settle_count > 0) {
+    --processor->quality_settle_count;
+  }
+
+  if (processor->quality < kTactileQualityEnvelopeOnly &&
+      (load > 1.0f || (processor->quality_settle_count == 0 &&
+                       processor->smoothed_load >
+                           processor->quality_degrade_load))) {
+    /* Overrun or sustained high load: lower quality. */
+    TactileProcessorSetQuality(processor, processor->quality + 1);
+  } else if (processor->quality > kTactileQualityFull &&
+             processor->smoothed_load < processor->quality_restore_load) {
+    /* Raise quality once the load has been low for the hold time. */
+    if (++processor->quality_restore_count >=
+        processor->quality_restore_hold_blocks) {
+      TactileProcessorSetQuality(processor, processor->quality - 1);
+    }
+  } else {
+    processor->quality_restore_count = 0;
+  }
+}
+
+void TactileProcessorMemoryUsage(const TactileProcessor* processor,
+                                 MemoryUsage* usage) {
+  /* Recover the layout from the processor's fields. */
   const int block_size = CarlFrontendBlockSize(processor->frontend);
-  const int decimation_factor = processor->decimation_factor;
-  const int decimated_block_size = block_size / decimation_factor;
-  /* Run the CARL frontend. */
-  float* workspace = processor->workspace;
-  memcpy(workspace, input, sizeof(float) * block_size);
-  CarlFrontendProcessSamples(processor->frontend, workspace, processor->frame);
-  /* Get 2-D vowel space coordinate. */
-  EmbedVowel(processor->frame, processor->vowel_coord);
+  MemoryUsage frontend_usage;
+  CarlFrontendMemoryUsage(processor->frontend, &frontend_usage);
+  TactileProcessorLayout layout;
+  layout.frontend_bytes = frontend_usage.heap_bytes;
+  layout.workspace_size = kEnveloperNumChannels *
+      (block_size / processor->decimation_factor) + block_size;
+  layout.frame_size = processor->frame_channel_offset +
+      CarlFrontendNumChannels(processor->frontend);
+  layout.warm_start_size = processor->warm_start_buffer
+      ? processor->warm_start_blocks * block_size : 0;
+  layout.resampler_bytes = 0;
+  if (processor->capture_resampler) {
+    MemoryUsage resampler_usage;
+    QResamplerMemoryUsage(processor->capture_resampler, &resampler_usage);
+    layout.resampler_bytes = resampler_usage.heap_bytes;
+    layout.workspace_size += processor->capture_slack;
+  }
 
-  /* Compute energy envelopes, writing into `workspace`. */
-  EnveloperProcessSamples(&processor->enveloper, input, block_size, workspace);
+  MemoryUsageZero(usage);
+  usage->heap_bytes = LayoutRequiredBytes(&layout);
+  /* The Enveloper's FastPow() reads both FastFun tables. */
+  usage->table_bytes = frontend_usage.table_bytes +
+      sizeof(kFastFunLog2Table) + sizeof(kFastFunExp2Table) +
+      EmbedVowelTableBytes();
+#ifdef AUDIO_TO_TACTILE_HEXAGON_TABLE
+  usage->table_bytes += sizeof(kHexagonInterpolationTable);
+#endif
+}
+
+int TactileProcessorWarmStateSize(const TactileProcessor* processor) {
+  return kEnveloperWarmStateSize +
+      CarlFrontendWarmStateSize(processor->frontend);
+}
+
+void TactileProcessorGetWarmState(const TactileProcessor* processor,
+                                  float* warm_state) {
+  EnveloperGetWarmState(&processor->enveloper, warm_state);
+  CarlFrontendGetWarmState(processor->frontend,
+                           warm_state + kEnveloperWarmStateSize);
+}
+
+int TactileProcessorSetWarmState(TactileProcessor* processor,
+                                 const float* warm_state) {
+  if (!EnveloperSetWarmState(&processor->enveloper, warm_state) ||
+      !CarlFrontendSetWarmState(processor->frontend,
+                                warm_state + kEnveloperWarmStateSize)) {
+    EnveloperReset(&processor->enveloper);
+    CarlFrontendReset(processor->frontend);
+    return 0;
+  }
+  return 1;
+}
+
+/* A checkpoint is a copy of the TactileProcessor struct, followed by the
+ * CarlFrontend checkpoint and the warm start buffer.
+ */
+static size_t WarmStartBufferSize(const TactileProcessor* processor) {
+  return (size_t)processor->warm_start_blocks *
+      CarlFrontendBlockSize(processor->frontend);
+}
+
+size_t TactileProcessorCheckpointBytes(const TactileProcessor* processor) {
+  return sizeof(TactileProcessor) + sizeof(float) *
+      (CarlFrontendCheckpointSize(processor->frontend) +
+       WarmStartBufferSize(processor));
+}
+
+void TactileProcessorSaveCheckpoint(const TactileProcessor* processor,
+                                    void* checkpoint) {
+  char* dest = (char*)checkpoint;
+  memcpy(dest, processor, sizeof(TactileProcessor));
+  dest += sizeof(TactileProcessor);
+  CarlFrontendSaveCheckpoint(processor->frontend, (float*)dest);
+  dest += sizeof(float) * CarlFrontendCheckpointSize(processor->frontend);
+  if (processor->warm_start_buffer != NULL) {
+    memcpy(dest, processor->warm_start_buffer,
+           sizeof(float) * WarmStartBufferSize(processor));
+  }
+}
+
+int TactileProcessorLoadCheckpoint(TactileProcessor* processor,
+                                   const void* checkpoint) {
+  const char* src = (const char*)checkpoint;
+  TactileProcessor saved;
+  memcpy(&saved, src, sizeof(TactileProcessor));
+  if (saved.decimation_factor != processor->decimation_factor ||
+      saved.warm_start_blocks != processor->warm_start_blocks ||
+      saved.vowel_embedding_stride != processor->vowel_embedding_stride ||
+      saved.enveloper.num_warm_up_samples !=
+          processor->enveloper.num_warm_up_samples) {
+    fprintf(stderr, "Error: TactileProcessor checkpoint doesn't match.\n");
+    return 0;
+  }
+  src += sizeof(TactileProcessor);
+
+  /* Keep the pointers to this processor's buffers. */
+  saved.frontend = processor->frontend;
+  saved.workspace = processor->workspace;
+  /* The frame bus isn't part of the checkpoint, so that subscribed readers
+   * stay valid.
+   */
+  saved.frame_bus = processor->frame_bus;
+  saved.warm_start_buffer = processor->warm_start_buffer;
+  saved.capture_resampler = processor->capture_resampler;
+  saved.block_fill = 0;
+  saved.allocation = processor->allocation;
+  *processor = saved;
+  if (processor->capture_resampler) {
+    QResamplerReset(processor->capture_resampler);
+  }
+  CarlFrontendLoadCheckpoint(processor->frontend, (const float*)src);
+  src += sizeof(float) * CarlFrontendCheckpointSize(processor->frontend);
+  if (processor->warm_start_buffer != NULL) {
+    memcpy(processor->warm_start_buffer, src,
+           sizeof(float) * WarmStartBufferSize(processor));
+  }
+  return 1;
+}
 
-  const float* src = workspace;
-  float* dest = output;
+/* Resets the CARL frontend and runs it on the saved warm start blocks, oldest
+ * first, so that its state has settled when resuming from silence.
+ */
+static void WarmStartFrontend(TactileProcessor* processor) {
+  const int block_size = CarlFrontendBlockSize(processor->frontend);
+  const int num_blocks = processor->warm_start_blocks;
+  CarlFrontendReset(processor->frontend);
+
+  int index = processor->warm_start_index - processor->warm_start_count;
+  if (index < 0) { index += num_blocks; }
+  /* The warm start frames are written to the bus's next slot as scratch, but
+   * not published.
+   */
+  float* frame = FrameBusNextSlot(&processor->frame_bus) +
+      processor->frame_channel_offset;
+  int k;
+  for (k = 0; k < processor->warm_start_count; ++k) {
+    /* The frontend overwrites the saved block, which is no longer needed. */
+    CarlFrontendProcessSamples(processor->frontend,
+                               processor->warm_start_buffer + block_size * index,
+                               frame);
+    if (++index == num_blocks) { index = 0; }
+  }
+  processor->warm_start_count = 0;
+}
+
+/* Updates silence gating, given the Enveloper output `envelopes` and `input`
+ * for the current block. Returns 1 if the block is silent, in which case the
+ * frontend should be skipped and the output is zero.
+ */
+static int UpdateSilenceGate(TactileProcessor* processor,
+                             const float* envelopes,
+                             const float* input) {
+  const int block_size = CarlFrontendBlockSize(processor->frontend);
+  const int num_envelopes =
+      kEnveloperNumChannels * block_size / processor->decimation_factor;
+  const float threshold = processor->silence_threshold;
   int i;
-  for (i = 0; i < decimated_block_size; ++i) {
-    dest[0] = src[0]; /* Map baseband envelope to output channel 0. */
-    dest[8] = src[2]; /* Map sh fricative envelope to output channel 8. */
-    dest[9] = src[3]; /* Map fricative envelope to output channel 9. */
-    src += kEnveloperNumChannels;
-    dest += kTactileProcessorNumTactors;
+  for (i = 0; i < num_envelopes; ++i) {
+    /* Written so that NaN counts as active. */
+    if (!(-threshold < envelopes[i] && envelopes[i] < threshold)) {
+      break;
+    }
+  }
+
+  if (i < num_envelopes) {  /* The block is active. */
+    processor->silent_block_count = 0;
+    if (processor->is_silent) {
+      if (processor->quality == kTactileQualityEnvelopeOnly ||
+          !HexClusterActive(processor)) {
+        processor->warm_start_count = 0;  /* Frontend is paused anyway. */
+      } else {
+        WarmStartFrontend(processor);
+      }
+      processor->is_silent = 0;
+    }
+    return 0;
   }
 
+  if (!processor->is_silent) {
+    if (++processor->silent_block_count < processor->silence_hold_blocks) {
+      return 0;  /* Keep processing normally until the hold time has passed. */
+    }
+    /* Pause the frontend. */
+    processor->is_silent = 1;
+    processor->warm_start_count = 0;
+    processor->vowel_phase = 0;
+    for (i = 0; i < 7; ++i) {
+      processor->vowel_hex_weights[i] = 0.0f;
+    }
+  }
+
+  /* Save the input block for warm starting the frontend later. */
+  if (processor->warm_start_blocks > 0) {
+    memcpy(processor->warm_start_buffer +
+               block_size * processor->warm_start_index,
+           input, sizeof(float) * block_size);
+    if (++processor->warm_start_index == processor->warm_start_blocks) {
+      processor->warm_start_index = 0;
+    }
+    if (processor->warm_start_count < processor->warm_start_blocks) {
+      ++processor->warm_start_count;
+    }
+  }
+  return 1;
+}
+
+/* Writes `num_frames` zeros to `out`, `frame_stride` elements apart. */
+static void WriteZeroChannel(float* out, int num_frames, int frame_stride) {
+  int i;
+  for (i = 0; i < num_frames; ++i) {
+    *out = 0.0f;
+    out += frame_stride;
+  }
+}
+
+/* Writes zeros to the output of one block, with the same layout as
+ * WriteTactorOutputs().
+ */
+static void WriteZeroOutputs(TactileProcessor* processor,
+                             float* const* outputs,
+                             int frame_stride) {
+  const int decimated_block_size =
+      CarlFrontendBlockSize(processor->frontend) / processor->decimation_factor;
+  int c;
+  for (c = 0; c < kTactileProcessorNumTactors; ++c) {
+    WriteZeroChannel(outputs[c], decimated_block_size, frame_stride);
+  }
+}
+
+/* Writes the vowel hex cluster output of one block, blending the hex weights
+ * from `processor->vowel_hex_weights` to `next_vowel_hex_weights` over the
+ * block, with the layout of WriteTactorOutputs().
+ */
+static void WriteHexClusterOutputs(TactileProcessor* processor,
+                                   const float* envelopes,
+                                   const float* next_vowel_hex_weights,
+                                   float* const* outputs,
+                                   int frame_stride) {
+  const int decimated_block_size =
+      CarlFrontendBlockSize(processor->frontend) / processor->decimation_factor;
   float* vowel_hex_weights = processor->vowel_hex_weights;
-  float next_vowel_hex_weights[7];
-  /* Get the next hexagonal interpolation weights based on `vowel_coord`. The
-   * fine-time signal is modulated by the hex weights.
-   */
-  GetHexagonInterpolationWeights(processor->vowel_coord[0],
-                                 processor->vowel_coord[1],
-                                 next_vowel_hex_weights);
-  /* We will blend linearly from `vowel_hex_weights` to `next_vowel_hex_weights`
-   * over the block.
+  /* The fine-time signal is modulated by the hex weights. We will blend
+   * linearly from `vowel_hex_weights` to `next_vowel_hex_weights` over the
+   * block.
    */
   float weights_diff[7];
   int c;
@@ -158,51 +702,487 @@ void TactileProcessorProcessSamples(TactileProcessor* processor,
   /* Map to the vowel hex cluster. */
   const float blend_step = 1.0f / decimated_block_size;
   float blend = 0.0f;
-  src = workspace + 1; /* Get the vowel channel energy envelope. */
-  dest = output + 1;
+  /* Get the vowel channel energy envelope. */
+  const float* src = envelopes + 1;
+  int offset = 0;
+  int i;
   for (i = 0; i < decimated_block_size; ++i) {
     blend += blend_step;
     const float sample = *src; /* Get the next fine-time sample. */
     int c;
     for (c = 0; c < 7; ++c) {  /* Fill the vowel channels. */
-      dest[c] = (vowel_hex_weights[c] + blend * weights_diff[c]) * sample;
+      outputs[1 + c][offset] =
+          (vowel_hex_weights[c] + blend * weights_diff[c]) * sample;
     }
     src += kEnveloperNumChannels;
-    dest += kTactileProcessorNumTactors;
+    offset += frame_stride;
   }
 
-  memcpy(vowel_hex_weights, next_vowel_hex_weights,
-         sizeof(next_vowel_hex_weights));
+  memcpy(vowel_hex_weights, next_vowel_hex_weights, sizeof(float) * 7);
 }
 
-void TactileProcessorApplyTuning(TactileProcessor* processor,
-                                 const TuningKnobs* knobs) {
-  const float output_gain_db = TuningGet(knobs, kKnobOutputGain);
-  /* Convert dB to linear amplitude ratio. */
-  const float output_gain = FastDecibelsToAmplitudeRatio(output_gain_db);
-  const float noise_db_s = TuningGet(knobs, kKnobNoiseAdaptation);
-  const float denoising_transition_db =
-      TuningGet(knobs, kKnobDenoisingTransition);
-  const float agc_strength = TuningGet(knobs, kKnobAgcStrength);
-  const float compressor_exponent = TuningGet(knobs, kKnobCompressor);
-
-  Enveloper* enveloper = &processor->enveloper;
-  enveloper->noise_coeffs[1] =
-      EnveloperGrowthCoeff(enveloper, noise_db_s);
-  enveloper->gate_transition_factor =
-      DecibelsToPowerRatio(denoising_transition_db);
-  enveloper->agc_exponent = -agc_strength;
-  enveloper->compressor_exponent = compressor_exponent;
+/* Writes the output of one block, blending the vowel hex cluster weights from
+ * `processor->vowel_hex_weights` to `next_vowel_hex_weights` over the block.
+ * `envelopes` are the Enveloper outputs in interleaved order, and sample i of
+ * output channel c is written to `outputs[c][i * frame_stride]`.
+ */
+static void WriteTactorOutputs(TactileProcessor* processor,
+                               const float* envelopes,
+                               const float* next_vowel_hex_weights,
+                               float* const* outputs,
+                               int frame_stride) {
+  const int decimated_block_size =
+      CarlFrontendBlockSize(processor->frontend) / processor->decimation_factor;
+  float* out0 = outputs[0];
+  float* out8 = outputs[8];
+  float* out9 = outputs[9];
+  const float* src = envelopes;
+  int i;
+  for (i = 0; i < decimated_block_size; ++i) {
+    *out0 = src[0]; /* Map baseband envelope to output channel 0. */
+    *out8 = src[2]; /* Map sh fricative envelope to output channel 8. */
+    *out9 = src[3]; /* Map fricative envelope to output channel 9. */
+    src += kEnveloperNumChannels;
+    out0 += frame_stride;
+    out8 += frame_stride;
+    out9 += frame_stride;
+  }
+
+  if (HexClusterActive(processor)) {
+    WriteHexClusterOutputs(processor, envelopes, next_vowel_hex_weights,
+                           outputs, frame_stride);
+  }
+
+  /* Unused tactors output zero, though their envelopes may be computed. */
+  const uint32_t active_tactors = processor->active_tactors;
+  int c;
+  for (c = 0; c < kTactileProcessorNumTactors; ++c) {
+    if (!((active_tactors >> c) & 1)) {
+      WriteZeroChannel(outputs[c], decimated_block_size, frame_stride);
+    }
+  }
+}
+
+/* Runs the CARL frontend and vowel embedding as the quality level and the
+ * active tactors allow, and gets the vowel hex cluster weights for the end of
+ * the block. If the frontend runs, it processes `frontend_input` in place,
+ * after copying `input` into it if they differ.
+ *
+ * EmbedVowel runs once per interval of `vowel_embedding_stride` blocks, or
+ * twice that at half rate, and the hex weights blend linearly over the
+ * interval from their value at the start of the interval to the new target.
+ */
+static void ProcessVowel(TactileProcessor* processor,
+                         const float* input,
+                         float* frontend_input,
+                         float* next_vowel_hex_weights) {
+  int c;
+  if (!HexClusterActive(processor)) {
+    /* No vowel cluster tactor is in use, so skip the frontend. */
+    for (c = 0; c < 7; ++c) {
+      next_vowel_hex_weights[c] = 0.0f;
+    }
+  } else if (processor->quality == kTactileQualityEnvelopeOnly) {
+    /* Fixed cluster: everything on the center tactor, sample 6 of the hex. */
+    for (c = 0; c < 6; ++c) {
+      next_vowel_hex_weights[c] = 0.0f;
+    }
+    next_vowel_hex_weights[6] = 1.0f;
+  } else {
+    const int half_rate = (processor->quality == kTactileQualityHalfRateVowel);
+    const int interval = processor->vowel_embedding_stride << half_rate;
+    const int phase = processor->vowel_phase;
+    /* At half rate, the frontend runs every other block. */
+    if (!half_rate || phase % 2 == 0) {
+      const int block_size = CarlFrontendBlockSize(processor->frontend);
+      if (frontend_input != input) {
+        memcpy(frontend_input, input, sizeof(float) * block_size);
+      }
+      CarlFrontendProcessSamples(processor->frontend, frontend_input,
+                                 FrameBusNextSlot(&processor->frame_bus) +
+                                 processor->frame_channel_offset);
+      FrameBusPublish(&processor->frame_bus);
+    }
+    if (phase == 0) {
+      /* Get 2-D vowel space coordinate from the frame just published. */
+      EmbedVowel(FrameBusLatest(&processor->frame_bus),
+                 processor->vowel_coord);
+      /* Get the target hexagonal interpolation weights based on
+       * `vowel_coord`.
+       */
+      GetHexagonInterpolationWeightsFast(processor->vowel_coord[0],
+                                         processor->vowel_coord[1],
+                                         processor->vowel_hex_target);
+      memcpy(processor->vowel_hex_start, processor->vowel_hex_weights,
+             sizeof(processor->vowel_hex_start));
+    }
+
+    if (phase + 1 == interval) {
+      memcpy(next_vowel_hex_weights, processor->vowel_hex_target,
+             sizeof(processor->vowel_hex_target));
+      processor->vowel_phase = 0;
+    } else {
+      const float blend = (float)(phase + 1) / interval;
+      for (c = 0; c < 7; ++c) {
+        next_vowel_hex_weights[c] = processor->vowel_hex_start[c] + blend *
+            (processor->vowel_hex_target[c] - processor->vowel_hex_start[c]);
+      }
+      processor->vowel_phase = phase + 1;
+    }
+  }
+}
+
+void TactileProcessorProcessVowel(TactileProcessor* processor,
+                                  float* input,
+                                  float* next_vowel_hex_weights) {
+  ProcessVowel(processor, input, input, next_vowel_hex_weights);
+}
+
+int TactileProcessorUpdateSilenceGate(TactileProcessor* processor,
+                                      const float* input,
+                                      const float* envelopes) {
+  return processor->enable_silence_gating &&
+      UpdateSilenceGate(processor, envelopes, input);
+}
 
+void TactileProcessorWriteOutputs(TactileProcessor* processor,
+                                  const float* envelopes,
+                                  const float* next_vowel_hex_weights,
+                                  float* output,
+                                  int frame_stride) {
+  float* outputs[10];
   int c;
+  for (c = 0; c < kTactileProcessorNumTactors; ++c) {
+    outputs[c] = output + c;
+  }
+  WriteTactorOutputs(processor, envelopes, next_vowel_hex_weights, outputs,
+                     frame_stride);
+}
+
+void TactileProcessorComputeFeatures(TactileProcessor* processor,
+                                     const float* input,
+                                     float* envelopes,
+                                     float* next_vowel_hex_weights) {
+  const int block_size = CarlFrontendBlockSize(processor->frontend);
+  const int decimated_block_size = block_size / processor->decimation_factor;
+  TactileProcessorTakeStagedTuning(processor);
+  EnveloperProcessSamples(&processor->enveloper, input, block_size, envelopes);
+
+  if (processor->enable_silence_gating &&
+      UpdateSilenceGate(processor, envelopes, input)) {
+    /* Zero envelopes make WriteTactorOutputs() write zeros, as
+     * WriteZeroOutputs() does, and the hex weights hold.
+     */
+    memset(envelopes, 0,
+           sizeof(float) * kEnveloperNumChannels * decimated_block_size);
+    memcpy(next_vowel_hex_weights, processor->vowel_hex_weights,
+           sizeof(processor->vowel_hex_weights));
+    return;
+  }
+
+  float* frontend_input =
+      processor->workspace + kEnveloperNumChannels * decimated_block_size;
+  ProcessVowel(processor, input, frontend_input, next_vowel_hex_weights);
+  /* Track the weights as WriteTactorOutputs() would, since ProcessVowel()
+   * blends from them.
+   */
+  memcpy(processor->vowel_hex_weights, next_vowel_hex_weights,
+         sizeof(processor->vowel_hex_weights));
+}
+
+/* The staging flag is accessed with acquire/release atomics, as in
+ * cpp/spsc_ring_buffer.h, so that `tuning` is fully written before the audio
+ * loop sees the flag and fully read before the control thread sees it cleared.
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define LOAD_ACQUIRE(p) __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define STORE_RELEASE(p, value) __atomic_store_n((p), (value), __ATOMIC_RELEASE)
+#else
+#define LOAD_ACQUIRE(p) (*(volatile int*)(p))
+#define STORE_RELEASE(p, value) (*(volatile int*)(p) = (value))
+#endif
+
+void TactileProcessorTakeStagedTuning(TactileProcessor* processor) {
+  if (LOAD_ACQUIRE(&processor->tuning_staged)) {
+    EnveloperSetTuning(&processor->enveloper, &processor->tuning);
+    STORE_RELEASE(&processor->tuning_staged, 0);
+  }
+}
+
+void TactileProcessorProcessSamples(TactileProcessor* processor,
+    const float* input, float* output) {
+  const int block_size = CarlFrontendBlockSize(processor->frontend);
+  TactileProcessorTakeStagedTuning(processor);
+  /* Compute energy envelopes, writing into `workspace`. */
+  float* workspace = processor->workspace;
+  EnveloperProcessSamples(&processor->enveloper, input, block_size, workspace);
+  TactileProcessorProcessEnvelopes(processor, input, workspace, output,
+                                   kTactileProcessorNumTactors);
+}
+
+void TactileProcessorProcessSamplesWithSideEnergy(TactileProcessor* processor,
+    const float* input, const float* side_energy, float* output) {
+  const int block_size = CarlFrontendBlockSize(processor->frontend);
+  TactileProcessorTakeStagedTuning(processor);
+  float* workspace = processor->workspace;
+  EnveloperProcessSamplesWithSideEnergy(&processor->enveloper, input,
+                                        block_size, side_energy, workspace);
+  TactileProcessorProcessEnvelopes(processor, input, workspace, output,
+                                   kTactileProcessorNumTactors);
+}
+
+/* Gets the block where TactileProcessorPushSamples() and ...ProcessCapture()
+ * stage input. This is the frontend's slot of `workspace`, so that the
+ * Enveloper reads it there and the CARL frontend processes it in place.
+ */
+static float* StagingBlock(TactileProcessor* processor) {
+  const int block_size = CarlFrontendBlockSize(processor->frontend);
+  return processor->workspace +
+      kEnveloperNumChannels * (block_size / processor->decimation_factor);
+}
+
+void TactileProcessorProcessSamplesDualMic(TactileProcessor* processor,
+    const float* input0, const float* input1, float* output) {
+  const int block_size = CarlFrontendBlockSize(processor->frontend);
+  TactileProcessorTakeStagedTuning(processor);
+  float* workspace = processor->workspace;
+  /* The vowel channel's weight, which is the most relevant to the frontend. */
+  const float* weight = &processor->enveloper.dual_mic.weight[1];
+  const float start_weight = *weight;
+  EnveloperProcessSamplesDualMic(&processor->enveloper, input0, input1,
+                                 block_size, workspace);
+
+  /* Mix the inputs for the frontend, ramping the weight over the block. */
+  const float weight_step = (*weight - start_weight) / block_size;
+  float* mixed = StagingBlock(processor);
+  int i;
+  for (i = 0; i < block_size; ++i) {
+    const float w = start_weight + weight_step * (i + 1);
+    mixed[i] = input0[i] + w * (input1[i] - input0[i]);
+  }
+
+  TactileProcessorProcessEnvelopes(processor, mixed, workspace, output,
+                                   kTactileProcessorNumTactors);
+}
+
+/* Processes the full block in StagingBlock(), writing its output. */
+static void ProcessStagedBlock(TactileProcessor* processor, float* output) {
+  const int block_size = CarlFrontendBlockSize(processor->frontend);
+  float* block = StagingBlock(processor);
+  TactileProcessorTakeStagedTuning(processor);
+  EnveloperProcessSamples(&processor->enveloper, block, block_size,
+                          processor->workspace);
+  TactileProcessorProcessEnvelopes(processor, block, processor->workspace,
+                                   output, kTactileProcessorNumTactors);
+}
+
+int TactileProcessorPushSamples(TactileProcessor* processor,
+                                const float* input,
+                                int num_frames,
+                                float* output) {
+  const int block_size = CarlFrontendBlockSize(processor->frontend);
+  const int decimated_block_size = block_size / processor->decimation_factor;
+  const int output_block_size =
+      kTactileProcessorNumTactors * decimated_block_size;
+  float* block = StagingBlock(processor);
+  int num_output_frames = 0;
+
+  if (processor->block_fill > 0) {  /* Complete the staged block. */
+    int n = block_size - processor->block_fill;
+    if (n > num_frames) { n = num_frames; }
+    memcpy(block + processor->block_fill, input, sizeof(float) * n);
+    processor->block_fill += n;
+    input += n;
+    num_frames -= n;
+    if (processor->block_fill < block_size) { return 0; }
+    ProcessStagedBlock(processor, output);
+    output += output_block_size;
+    num_output_frames += decimated_block_size;
+  }
+
+  /* Process full blocks directly from `input`. */
+  for (; num_frames >= block_size; num_frames -= block_size) {
+    TactileProcessorProcessSamples(processor, input, output);
+    input += block_size;
+    output += output_block_size;
+    num_output_frames += decimated_block_size;
+  }
+
+  /* Stage the remainder. */
+  memcpy(block, input, sizeof(float) * num_frames);
+  processor->block_fill = num_frames;
+  return num_output_frames;
+}
+
+int TactileProcessorNextNumPushOutputFrames(const TactileProcessor* processor,
+                                            int num_frames) {
+  const int block_size = CarlFrontendBlockSize(processor->frontend);
+  return ((processor->block_fill + num_frames) / block_size) *
+      (block_size / processor->decimation_factor);
+}
+
+int TactileProcessorProcessCapture(TactileProcessor* processor,
+                                   const float* input,
+                                   int num_input_frames,
+                                   float* output) {
+  QResampler* resampler = processor->capture_resampler;
+  if (resampler == NULL) { return 0; }
+  const int block_size = CarlFrontendBlockSize(processor->frontend);
+  const int decimated_block_size = block_size / processor->decimation_factor;
+  const int max_chunk_frames = QResamplerMaxInputFrames(resampler);
+  float* block = StagingBlock(processor);
+  int num_output_frames = 0;
+
+  while (num_input_frames > 0) {
+    /* Get as much input as completes the block without passing its end, or
+     * when upsampling, at least one frame, which may spill into the slack.
+     */
+    int chunk_frames = QResamplerMaxInputFramesForOutput(
+        resampler, block_size - processor->block_fill);
+    if (chunk_frames < 1) {
+      chunk_frames = 1;
+    } else if (chunk_frames > max_chunk_frames) {
+      chunk_frames = max_chunk_frames;
+    }
+    if (chunk_frames > num_input_frames) {
+      chunk_frames = num_input_frames;
+    }
+    processor->block_fill += QResamplerProcessSamplesToBuffer(
+        resampler, input, chunk_frames, block + processor->block_fill);
+    input += chunk_frames;
+    num_input_frames -= chunk_frames;
+
+    if (processor->block_fill >= block_size) {
+      ProcessStagedBlock(processor, output);
+      /* Move frames that spilled into the slack to start the next block. */
+      processor->block_fill -= block_size;
+      memmove(block, block + block_size,
+              sizeof(float) * processor->block_fill);
+      output += kTactileProcessorNumTactors * decimated_block_size;
+      num_output_frames += decimated_block_size;
+    }
+  }
+  return num_output_frames;
+}
+
+int TactileProcessorNextNumCaptureOutputFrames(
+    const TactileProcessor* processor, int num_input_frames) {
+  if (processor->capture_resampler == NULL) { return 0; }
+  const int block_size = CarlFrontendBlockSize(processor->frontend);
+  const int num_frames = processor->block_fill +
+      QResamplerNextNumOutputFrames(processor->capture_resampler,
+                                    num_input_frames);
+  return (num_frames / block_size) *
+      (block_size / processor->decimation_factor);
+}
+
+void TactileProcessorProcessEnvelopes(TactileProcessor* processor,
+                                      const float* input,
+                                      const float* envelopes,
+                                      float* output,
+                                      int frame_stride) {
+  const int block_size = CarlFrontendBlockSize(processor->frontend);
+  float* outputs[10];
+  int c;
+  for (c = 0; c < kTactileProcessorNumTactors; ++c) {
+    outputs[c] = output + c;
+  }
+  if (processor->enable_silence_gating &&
+      UpdateSilenceGate(processor, envelopes, input)) {
+    WriteZeroOutputs(processor, outputs, frame_stride);
+    return;
+  }
+
+  /* Run the CARL frontend on a copy of the input. */
+  float* frontend_input = processor->workspace + kEnveloperNumChannels *
+      (block_size / processor->decimation_factor);
+  float next_vowel_hex_weights[7];
+  ProcessVowel(processor, input, frontend_input, next_vowel_hex_weights);
+  WriteTactorOutputs(processor, envelopes, next_vowel_hex_weights, outputs,
+                     frame_stride);
+}
+
+void TactileProcessorProcessSamplesPlanar(TactileProcessor* processor,
+    float* input, float* const* outputs) {
+  const int block_size = CarlFrontendBlockSize(processor->frontend);
+  TactileProcessorTakeStagedTuning(processor);
+  /* Compute energy envelopes first, while `input` is unmodified. */
+  float* workspace = processor->workspace;
+  EnveloperProcessSamples(&processor->enveloper, input, block_size, workspace);
+
+  if (processor->enable_silence_gating &&
+      UpdateSilenceGate(processor, workspace, input)) {
+    WriteZeroOutputs(processor, outputs, 1);
+    return;
+  }
+
+  /* Run the CARL frontend in place on `input`. */
+  float next_vowel_hex_weights[7];
+  ProcessVowel(processor, input, input, next_vowel_hex_weights);
+  WriteTactorOutputs(processor, workspace, next_vowel_hex_weights, outputs, 1);
+}
+
+/* Updates `processor->tuning` for `knobs`, recomputing only the fields
+ * affected by knobs that differ from `processor->tuning_knobs`.
+ */
+static void UpdateTuning(TactileProcessor* processor,
+                         const TuningKnobs* knobs) {
+  const Enveloper* enveloper = &processor->enveloper;
+  EnveloperTuning* tuning = &processor->tuning;
+  const uint8_t* old_values = processor->tuning_knobs.values;
+  const int update_all = !processor->has_tuning_knobs;
+#define KNOB_CHANGED(knob) \
+    (update_all || knobs->values[knob] != old_values[knob])
+  int changed_flags = 0;
+  int c;
+
+  if (KNOB_CHANGED(kKnobOutputGain)) {
+    /* Convert dB to linear amplitude ratio. */
+    const float output_gain =
+        FastDecibelsToAmplitudeRatio(TuningGet(knobs, kKnobOutputGain));
+    for (c = 0; c < kEnveloperNumChannels; ++c) {
+      tuning->output_gain[c] = output_gain;
+    }
+  }
+  if (KNOB_CHANGED(kKnobNoiseAdaptation)) {
+    tuning->noise_coeffs[1] = EnveloperGrowthCoeff(
+        enveloper, TuningGet(knobs, kKnobNoiseAdaptation));
+    changed_flags |= kEnveloperTuningNoiseChanged;
+  }
   for (c = 0; c < kEnveloperNumChannels; ++c) {
-    const float denoising_strength =
-        TuningGet(knobs, kKnobDenoisingBaseband + c);
-    EnveloperChannel* enveloper_c = &enveloper->channels[c];
-    enveloper_c->gate_thresh_factor = denoising_strength;
-    enveloper_c->output_gain = output_gain;
+    if (KNOB_CHANGED(kKnobDenoisingBaseband + c)) {
+      tuning->gate_thresh_factor[c] =
+          TuningGet(knobs, kKnobDenoisingBaseband + c);
+    }
+  }
+  if (KNOB_CHANGED(kKnobDenoisingTransition)) {
+    tuning->gate_transition_factor =
+        DecibelsToPowerRatio(TuningGet(knobs, kKnobDenoisingTransition));
   }
+  if (KNOB_CHANGED(kKnobAgcStrength) || KNOB_CHANGED(kKnobCompressor)) {
+    tuning->agc_exponent = -TuningGet(knobs, kKnobAgcStrength);
+    tuning->compressor_exponent = TuningGet(knobs, kKnobCompressor);
+    changed_flags |= kEnveloperTuningCompressorChanged;
+  }
+#undef KNOB_CHANGED
+
+  EnveloperUpdateTuning(enveloper, tuning, changed_flags);
+  processor->tuning_knobs = *knobs;
+  processor->has_tuning_knobs = 1;
+}
+
+void TactileProcessorApplyTuning(TactileProcessor* processor,
+                                 const TuningKnobs* knobs) {
+  UpdateTuning(processor, knobs);
+  EnveloperSetTuning(&processor->enveloper, &processor->tuning);
+  EnveloperReset(&processor->enveloper);
+  processor->tuning_staged = 0;
+}
 
-  EnveloperUpdatePrecomputedParams(enveloper);
-  EnveloperReset(enveloper);
+int TactileProcessorStageTuning(TactileProcessor* processor,
+                                const TuningKnobs* knobs) {
+  if (LOAD_ACQUIRE(&processor->tuning_staged)) { return 0; }
+  UpdateTuning(processor, knobs);
+  STORE_RELEASE(&processor->tuning_staged, 1);
+  return 1;
 }
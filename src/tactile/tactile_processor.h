@@ -43,14 +43,71 @@
  *
  * TactileProcessor hooks together the CARL+PCEN frontend, vowel embedding,
  * and the tactor energy envelope design.
+ *
+ * Silence gating: Optionally, TactileProcessor detects when the Enveloper noise
+ * gate has closed on all channels and pauses the CARL frontend and vowel
+ * embedding, which are most of the compute, while the input stays quiet. The
+ * Enveloper keeps running as the activity detector, so that noise estimates
+ * stay current, and output is exact zeros. When activity resumes, the frontend
+ * is reset and warm started on the most recent few blocks of input before the
+ * current block, so that resuming adds no latency and a bounded amount of
+ * compute. Enable by setting `params.enable_silence_gating = 1`.
+ *
+ * Adaptive quality: Optionally, TactileProcessor steps down a ladder of
+ * quality levels when the CPU load is too high to process each block in real
+ * time, so that overload degrades the vowel cluster gracefully rather than
+ * causing glitches in all channels:
+ *
+ *   kTactileQualityFull:          Full processing.
+ *   kTactileQualityHalfRateVowel: The CARL frontend runs every other block,
+ *                                 and the vowel embedding at half its usual
+ *                                 rate, with hex weights interpolated over the
+ *                                 longer interval.
+ *   kTactileQualityEnvelopeOnly:  Only the Enveloper runs. The vowel energy
+ *                                 envelope is presented on the center tactor of
+ *                                 the vowel cluster.
+ *
+ * The caller measures the load, the processing time of each block as a
+ * fraction of the block period (e.g. with DeadlineMonitor, deadline_monitor.h),
+ * and passes it to `TactileProcessorUpdateLoad()`. Quality drops a level on an
+ * overrun or when the smoothed load exceeds `quality_degrade_load`, and rises
+ * a level after the smoothed load has stayed below `quality_restore_load` for
+ * `quality_restore_hold_s`. Enable by setting
+ * `params.enable_adaptive_quality = 1`.
+ *
+ * Capture resampling: Optionally, TactileProcessor resamples input captured at
+ * another rate, e.g. 44.1 or 48 kHz from a sound card, to the frontend rate.
+ * Set `params.capture_sample_rate_hz` to the capture rate and pass captured
+ * buffers of any size to `TactileProcessorProcessCapture()`. The resampler
+ * writes directly into the block that the Enveloper and CARL frontend read,
+ * so no separate resampling pass or block buffering is needed.
+ *
+ * Frame bus: Each CARL+PCEN frame computed for the vowel embedding is
+ * published on `processor->frame_bus`, a small ring of recent frames. Other
+ * consumers, like a streaming phoneme classifier or tap_out capture, may
+ * subscribe to it with `FrameBusSubscribe()` and read the same frames with
+ * `FrameBusRead()` rather than running a second CarlFrontend (see
+ * frame_bus.h). Frames are published only on blocks where the frontend runs.
+ *
+ * Dead channel elimination: When some tactors are unused, e.g. because the
+ * ChannelMap maps no output to them or sets their gain to zero, pass the used
+ * tactors to `TactileProcessorSetActiveTactors()` to skip computing the rest.
+ * Without any vowel cluster tactor, the CARL frontend and vowel embedding are
+ * skipped, and no frames are published on the frame bus. Enveloper channels
+ * below the lowest one in use are skipped. Unused tactors output zero.
  */
 
 #ifndef AUDIO_TO_TACTILE_SRC_TACTILE_TACTILE_PROCESSOR_H_
 #define AUDIO_TO_TACTILE_SRC_TACTILE_TACTILE_PROCESSOR_H_
 
+#include <stddef.h>
+#include <stdint.h>
+
+#include "dsp/q_resampler.h"
 #include "frontend/carl_frontend.h"
 #include "phonetics/embed_vowel.h"
 #include "tactile/enveloper.h"
+#include "tactile/frame_bus.h"
 #include "tactile/tuning.h"
 
 #ifdef __cplusplus
@@ -60,6 +117,13 @@ extern "C" {
 /* Number of tactors / output channels. */
 extern const int kTactileProcessorNumTactors;
 
+/* Quality levels for adaptive quality, from highest to lowest. */
+typedef enum {
+  kTactileQualityFull = 0,
+  kTactileQualityHalfRateVowel = 1,
+  kTactileQualityEnvelopeOnly = 2,
+} TactileQuality;
+
 /* TactileProcessor parameters. */
 typedef struct {
   EnveloperParams enveloper_params;
@@ -70,11 +134,58 @@ typedef struct {
    * rate and `frontend_params.block_size` to the desired block size.
    */
   CarlFrontendParams frontend_params;
+  /* Number of CARL blocks between evaluations of the vowel embedding network.
+   * The hex weights blend linearly over this interval, so a larger stride
+   * saves compute at the cost of slower vowel tracking. Default 1.
+   */
+  int vowel_embedding_stride;
+  /* Nonzero to enable silence gating. Default is 0, disabled. */
+  int enable_silence_gating;
+  /* Blocks where all Enveloper outputs are below this value count as silent. */
+  float silence_threshold;
+  /* Duration in seconds of silent blocks before the frontend is paused. */
+  float silence_hold_s;
+  /* Number of blocks of recent input to warm start the frontend on resuming. */
+  int silence_warm_start_blocks;
+  /* Nonzero to enable adaptive quality. Default is 0, disabled. */
+  int enable_adaptive_quality;
+  /* Smoothed load above which quality is lowered. Default 0.85. */
+  float quality_degrade_load;
+  /* Smoothed load below which quality is raised. Default 0.5. */
+  float quality_restore_load;
+  /* Duration in seconds the load must stay low before raising quality. */
+  float quality_restore_hold_s;
+  /* If positive, sample rate in Hz of the input to
+   * TactileProcessorProcessCapture(), which is resampled to
+   * `frontend_params.input_sample_rate_hz`. Default is 0, disabled.
+   */
+  float capture_sample_rate_hz;
+  /* Number of zero channels published ahead of the frontend's channels in
+   * each frame on `frame_bus`. The vowel embedding expects frames laid out as
+   * from the default 16 kHz frontend. When the frontend runs at a lower rate,
+   * its channels are the lower channels of that layout, and the channels above
+   * its Nyquist frequency are published as zeros. Default is 0.
+   */
+  int frame_channel_offset;
 } TactileProcessorParams;
 
 /* Set `params` to default values. */
 void TactileProcessorSetDefaultParams(TactileProcessorParams* params);
 
+/* Set `params` to default values for the low-rate profile, processing audio
+ * streamed as in low_rate_stream.h by a sender sampling at
+ * `sender_sample_rate_hz`, e.g. 8 kHz audio from a 16 kHz sender. This is
+ * about half the bandwidth and compute of full-rate input. The fricative
+ * channel's 4-6 kHz band is above the streamed Nyquist frequency, so its energy
+ * is computed by the sender and passed to
+ * `TactileProcessorProcessSamplesWithSideEnergy()`. The CARL frontend keeps the
+ * default design's channels below 7/8 of the streamed Nyquist frequency,
+ * padded to the default layout with `frame_channel_offset`. The block size is
+ * half the default, for the same block duration and frame rate.
+ */
+void TactileProcessorSetLowRateParams(TactileProcessorParams* params,
+                                      float sender_sample_rate_hz);
+
 /* Get TactileProcessor's output sample rate in Hz. */
 float TactileProcessorOutputSampleRateHz(const TactileProcessorParams* params);
 
@@ -87,12 +198,78 @@ typedef struct {
   CarlFrontend* frontend;
   /* Workspace buffer with space for `block_size` floats. */
   float* workspace;
-  /* PCEN frame buffer. */
-  float* frame;
+  /* Bus of recent PCEN frames, read by the vowel embedding and any other
+   * subscribed consumers.
+   */
+  FrameBus frame_bus;
+  /* Number of leading zero channels in each frame, before the frontend's. */
+  int frame_channel_offset;
   /* 2D vowel embedding coordinate. */
   float vowel_coord[2];
   /* Interpolation weights for the hexagonal vowel cluster. */
   float vowel_hex_weights[7];
+  /* Number of blocks between vowel embedding evaluations. */
+  int vowel_embedding_stride;
+  /* Block index within the current vowel embedding interval. */
+  int vowel_phase;
+  /* Hex weights at the start of the interval, and the target to blend to. */
+  float vowel_hex_start[7];
+  float vowel_hex_target[7];
+
+  /* Silence gating state. `is_silent` is nonzero while the frontend is paused,
+   * and may be read by the caller, e.g. to lower the CPU clock.
+   */
+  int enable_silence_gating;
+  float silence_threshold;
+  int silence_hold_blocks;
+  int silent_block_count;
+  int is_silent;
+  /* Ring buffer of the last `warm_start_blocks` input blocks while silent. */
+  float* warm_start_buffer;
+  int warm_start_blocks;
+  int warm_start_count;
+  int warm_start_index;
+
+  /* Adaptive quality state. `quality` is the current TactileQuality level,
+   * and may be read by the caller, e.g. for diagnostics.
+   */
+  int enable_adaptive_quality;
+  float quality_degrade_load;
+  float quality_restore_load;
+  int quality_restore_hold_blocks;
+  int quality;
+  float smoothed_load;
+  int quality_restore_count;
+  int quality_settle_count;
+
+  /* Bit mask of the tactors in use, see TactileProcessorSetActiveTactors(). */
+  uint32_t active_tactors;
+
+  /* Tuning. `tuning` holds the Enveloper's tunable fields for `tuning_knobs`,
+   * the knobs last applied or staged, so that changing knobs only recomputes
+   * the affected fields. It doubles as the back buffer for live tuning: when
+   * `tuning_staged` is nonzero, it is owned by the audio thread until copied
+   * into the Enveloper at the next block boundary.
+   */
+  TuningKnobs tuning_knobs;
+  EnveloperTuning tuning;
+  int has_tuning_knobs;
+  int tuning_staged;
+
+  /* Re-blocking state for TactileProcessorPushSamples() and
+   * TactileProcessorProcessCapture(). `block_fill` is the number of frames
+   * staged so far into the current block, held in the frontend's slot of
+   * `workspace`. `capture_resampler` resamples to the frontend rate, or is
+   * NULL if disabled, and `capture_slack` is the number of frames after the
+   * block for upsampled output past its end.
+   */
+  int block_fill;
+  QResampler* capture_resampler;
+  int capture_slack;
+
+  /* Buffer to free in `TactileProcessorFree()`, or NULL if the caller owns it.
+   */
+  void* allocation;
 } TactileProcessor;
 
 /* Makes a `TactileProcessor`. The caller should free it when done with
@@ -104,6 +281,30 @@ TactileProcessor* TactileProcessorMake(TactileProcessorParams* params);
 /* Frees a `TactileProcessor`. */
 void TactileProcessorFree(TactileProcessor* processor);
 
+/* Gets the buffer size in bytes needed by `TactileProcessorInitInBuffer()`, or
+ * 0 if `params` are invalid.
+ */
+size_t TactileProcessorRequiredBytes(const TactileProcessorParams* params);
+
+/* Same as `TactileProcessorMake()`, but lays out the processor, including its
+ * CarlFrontend and buffers, contiguously in a caller-provided `buffer` of
+ * `buffer_size` bytes, with cache-line-aligned allocations. This way no heap
+ * allocation is needed. The buffer must be at least
+ * `TactileProcessorRequiredBytes(params)` bytes and outlive the processor.
+ * `TactileProcessorFree()` may be called on the result, but does not free the
+ * buffer. Returns NULL on failure.
+ */
+TactileProcessor* TactileProcessorInitInBuffer(
+    void* buffer, size_t buffer_size, const TactileProcessorParams* params);
+
+/* Gets the memory used by `processor`, see dsp/memory_usage.h. Heap bytes are
+ * TactileProcessorRequiredBytes(), which includes the CarlFrontend. Table
+ * bytes include the frontend designs, FastFun tables, and vowel embedding
+ * network weights.
+ */
+void TactileProcessorMemoryUsage(const TactileProcessor* processor,
+                                 MemoryUsage* usage);
+
 /* Resets to initial state. */
 void TactileProcessorReset(TactileProcessor* processor);
 
@@ -116,10 +317,245 @@ void TactileProcessorReset(TactileProcessor* processor);
 void TactileProcessorProcessSamples(TactileProcessor* processor,
     const float* input, float* output);
 
-/* Applies tuning specified by `knobs`. May be called at any time. */
+/* Same as `TactileProcessorProcessSamples()` for the low-rate profile, where
+ * `side_energy` is the fricative channel's energy for each of the block's
+ * `block_size / decimation_factor` output frames, e.g. as decoded by
+ * `LowRateStreamDecodeEnergies()`. Use this function when
+ * `params.enveloper_params.side_energy_sample_rate_hz` is set.
+ */
+void TactileProcessorProcessSamplesWithSideEnergy(TactileProcessor* processor,
+    const float* input, const float* side_energy, float* output);
+
+/* Same as `TactileProcessorProcessSamples()`, but for two microphones.
+ * `input0` and `input1` are each arrays of `block_size` elements. The
+ * Enveloper mixes the microphones per band by SNR, see
+ * `EnveloperProcessSamplesDualMic()`. The CARL frontend and vowel embedding run
+ * once, on the two inputs mixed with the vowel channel's weight, ramped
+ * linearly over the block. Compute is about 1.3x that of one microphone, since
+ * only the Enveloper's bandpass filters run per microphone. If both inputs are
+ * equal, the output is the same as for `TactileProcessorProcessSamples()`. The
+ * mixed input is staged in the same buffer as
+ * `TactileProcessorPushSamples()`, so don't mix the two.
+ */
+void TactileProcessorProcessSamplesDualMic(TactileProcessor* processor,
+    const float* input0, const float* input1, float* output);
+
+/* Push-style processing: Runs the `TactileProcessor` on `input`, an array of
+ * `num_frames` elements of any size, at the input sample rate. Input is
+ * re-blocked internally: full blocks are processed directly from `input`, and
+ * only a remainder of less than `block_size` frames is staged for the next
+ * call. Each block's output is appended to `output`, as in
+ * `TactileProcessorProcessSamples()`. Returns the number of output frames
+ * written, a multiple of `block_size / decimation_factor`. Get it in advance
+ * with `TactileProcessorNextNumPushOutputFrames()` to size `output`.
+ *
+ * This way the caller, e.g. an audio callback with a different buffer size,
+ * doesn't need its own FIFO. Don't mix this with `...ProcessSamples()`, which
+ * overwrites the staged frames, without calling `TactileProcessorReset()` in
+ * between. Loading a checkpoint discards the staged frames.
+ */
+int TactileProcessorPushSamples(TactileProcessor* processor,
+                                const float* input,
+                                int num_frames,
+                                float* output);
+
+/* Gets the number of output frames that the next
+ * `TactileProcessorPushSamples()` call writes for `num_frames` frames of input.
+ */
+int TactileProcessorNextNumPushOutputFrames(const TactileProcessor* processor,
+                                            int num_frames);
+
+/* Runs the `TactileProcessor` on input captured at
+ * `params.capture_sample_rate_hz`, which is resampled to the frontend rate.
+ * `input` is an array of `num_input_frames` elements of any size. Each time a
+ * block of `block_size` resampled frames is complete, it is processed as in
+ * `TactileProcessorProcessSamples()` and its output is appended to `output`.
+ * Returns the number of output frames written, a multiple of
+ * `block_size / decimation_factor` that typically varies between calls. Get
+ * it in advance with `TactileProcessorNextNumCaptureOutputFrames()` to size
+ * `output`. Returns 0 if capture resampling is disabled.
+ *
+ * Don't mix this with the other processing functions, which overwrite the
+ * partial block, without calling `TactileProcessorReset()` in between.
+ * Checkpoints don't include the resampler state, so loading a checkpoint
+ * restarts capture.
+ */
+int TactileProcessorProcessCapture(TactileProcessor* processor,
+                                   const float* input,
+                                   int num_input_frames,
+                                   float* output);
+
+/* Gets the number of output frames that the next
+ * `TactileProcessorProcessCapture()` call writes for `num_input_frames` frames
+ * of input.
+ */
+int TactileProcessorNextNumCaptureOutputFrames(
+    const TactileProcessor* processor, int num_input_frames);
+
+/* Runs the rest of `TactileProcessorProcessSamples()` on `envelopes`, the
+ * interleaved output of running `processor->enveloper` on `input`. This is for
+ * callers that compute the envelopes themselves, like TactileProcessorT in
+ * cpp/tactile_processor_t.h. `envelopes` may point to `processor->workspace`.
+ * Output frames are written `frame_stride >= kTactileProcessorNumTactors`
+ * elements apart to `output`. Other elements of `output` are left unchanged.
+ */
+void TactileProcessorProcessEnvelopes(TactileProcessor* processor,
+                                      const float* input,
+                                      const float* envelopes,
+                                      float* output,
+                                      int frame_stride);
+
+/* The three stages of `TactileProcessorProcessEnvelopes()`, for callers that
+ * run the CARL frontend on another thread, like PipelinedTactileProcessor in
+ * extras/tools/pipelined_tactile_processor.h. For each block, in order:
+ *
+ *  1. `TactileProcessorUpdateSilenceGate()` updates silence gating and returns
+ *     1 if the block is silent, in which case the output is zero and the other
+ *     stages are skipped. Returns 0 if silence gating is disabled.
+ *
+ *  2. `TactileProcessorProcessVowel()` runs the CARL frontend and vowel
+ *     embedding in place on `input`, and writes the 7 vowel hex cluster
+ *     weights for the end of the block to `next_vowel_hex_weights`.
+ *
+ *  3. `TactileProcessorWriteOutputs()` writes the block's output as in
+ *     `TactileProcessorProcessEnvelopes()`.
+ *
+ * Stage 2 may run concurrently with the Enveloper, but not with stages 1 or 3.
+ */
+int TactileProcessorUpdateSilenceGate(TactileProcessor* processor,
+                                      const float* input,
+                                      const float* envelopes);
+void TactileProcessorProcessVowel(TactileProcessor* processor,
+                                  float* input,
+                                  float* next_vowel_hex_weights);
+void TactileProcessorWriteOutputs(TactileProcessor* processor,
+                                  const float* envelopes,
+                                  const float* next_vowel_hex_weights,
+                                  float* output,
+                                  int frame_stride);
+
+/* Runs the Enveloper, silence gating, CARL frontend and vowel embedding on one
+ * block of `input`, but not the mapping to tactor outputs, for splitting
+ * processing across devices (see processing_split.h). Writes the interleaved
+ * Enveloper output, `block_size / decimation_factor` frames of
+ * kEnveloperNumChannels, to `envelopes`, zeroed if the block is silent, and the
+ * 7 vowel hex cluster weights for the end of the block to
+ * `next_vowel_hex_weights`. Passing these to `TactileProcessorWriteOutputs()`
+ * of another processor made with the same params produces the same output as
+ * `TactileProcessorProcessSamples()`.
+ */
+void TactileProcessorComputeFeatures(TactileProcessor* processor,
+                                     const float* input,
+                                     float* envelopes,
+                                     float* next_vowel_hex_weights);
+
+/* Same as `TactileProcessorProcessSamples()`, but writes the output in planar
+ * layout to caller-provided buffers, avoiding an interleaved intermediate
+ * buffer. `outputs` is an array of `kTactileProcessorNumTactors` pointers, and
+ * `outputs[c]` points to an array of `block_size / decimation_factor` elements
+ * for output channel c.
+ *
+ * NOTE: To avoid copying, `input` is used as scratch space by the CARL
+ * frontend and is overwritten.
+ */
+void TactileProcessorProcessSamplesPlanar(TactileProcessor* processor,
+    float* input, float* const* outputs);
+
+/* Sets the quality level, a TactileQuality value. With adaptive quality
+ * enabled, the level is subsequently changed by TactileProcessorUpdateLoad().
+ * Must not be called concurrently with processing.
+ */
+void TactileProcessorSetQuality(TactileProcessor* processor, int quality);
+
+/* Sets which tactors are in use, where `active_tactors` is a bit mask with bit
+ * c set if output channel c is needed, e.g. from ChannelMapUsedInputs() on the
+ * channel map applied to the output. Computation that only feeds unused
+ * tactors is skipped, and unused tactors output zero. Stages that come back
+ * into use are reset: the CARL frontend and vowel hex weights when a vowel
+ * cluster tactor is enabled, and the Enveloper when it has to compute a
+ * channel that it skipped. Initially all tactors are in use. Must not be
+ * called concurrently with processing.
+ */
+void TactileProcessorSetActiveTactors(TactileProcessor* processor,
+                                      uint32_t active_tactors);
+
+/* Updates adaptive quality with the measured `load` of the last block, its
+ * processing time as a fraction of the block period. Call once per block from
+ * the audio loop after processing. Does nothing if adaptive quality is
+ * disabled.
+ */
+void TactileProcessorUpdateLoad(TactileProcessor* processor, float load);
+
+/* Gets the number of floats in the TactileProcessor warm state. */
+int TactileProcessorWarmStateSize(const TactileProcessor* processor);
+
+/* Gets the slowly-adapting "warm" state of the Enveloper and CARL frontend as
+ * an array of TactileProcessorWarmStateSize() floats, see
+ * EnveloperGetWarmState() and CarlFrontendGetWarmState(). This may be
+ * persisted and later restored with TactileProcessorSetWarmState() to resume
+ * at full quality without warming up, e.g. after a reboot.
+ */
+void TactileProcessorGetWarmState(const TactileProcessor* processor,
+                                  float* warm_state);
+
+/* Restores warm state from TactileProcessorGetWarmState(). Since
+ * TactileProcessorApplyTuning() resets the Enveloper, call this after applying
+ * tuning. Returns 1 on success, or 0 if `warm_state` has invalid values, in
+ * which case the Enveloper and frontend are reset.
+ */
+int /*bool*/ TactileProcessorSetWarmState(TactileProcessor* processor,
+                                          const float* warm_state);
+
+/* Gets the size in bytes of a checkpoint of the full processor state. */
+size_t TactileProcessorCheckpointBytes(const TactileProcessor* processor);
+
+/* Saves the full processor state, including the Enveloper, CARL frontend,
+ * vowel hex weights, silence gating, and tuning, to `checkpoint`, a buffer of
+ * TactileProcessorCheckpointBytes() bytes. Unlike warm state, restoring a
+ * checkpoint resumes processing exactly as if it had not been interrupted.
+ * This is meant for seeking in offline tools: save checkpoints periodically
+ * on a first pass, then seek by loading the nearest earlier checkpoint and
+ * processing from there. The checkpoint is an opaque in-memory format, not
+ * for persisting.
+ */
+void TactileProcessorSaveCheckpoint(const TactileProcessor* processor,
+                                    void* checkpoint);
+
+/* Restores a checkpoint from TactileProcessorSaveCheckpoint() of a processor
+ * made with the same params. Returns 1 on success, or 0 if the checkpoint is
+ * for a different configuration, in which case `processor` is unchanged.
+ */
+int /*bool*/ TactileProcessorLoadCheckpoint(TactileProcessor* processor,
+                                            const void* checkpoint);
+
+/* Applies tuning specified by `knobs` immediately and resets the Enveloper.
+ * Only the precomputed params affected by knobs that changed since the last
+ * call are recomputed. Must not be called concurrently with processing.
+ */
 void TactileProcessorApplyTuning(TactileProcessor* processor,
                                  const TuningKnobs* tuning_knobs);
 
+/* Live tuning: stages `knobs` to be applied by the audio loop at the start of
+ * the next TactileProcessorProcessSamples() or ...Planar() call, without
+ * resetting the Enveloper. This may be called from a control thread (e.g. BLE
+ * or UI handlers) concurrently with processing. Params are computed on the
+ * calling thread, so the audio loop only copies them.
+ *
+ * Returns 1 if staged, or 0 if the previously staged tuning has not yet been
+ * taken by the audio loop, in which case nothing is changed and the caller
+ * should try again later with its latest knobs. There must be at most one
+ * control thread, and it must not call TactileProcessorApplyTuning()
+ * concurrently with processing.
+ */
+int /*bool*/ TactileProcessorStageTuning(TactileProcessor* processor,
+                                         const TuningKnobs* tuning_knobs);
+
+/* Takes tuning staged by TactileProcessorStageTuning(), if any. This is called
+ * by TactileProcessorProcessSamples() and ...Planar(); custom processing loops
+ * that call the Enveloper directly should call it at the start of each block.
+ */
+void TactileProcessorTakeStagedTuning(TactileProcessor* processor);
+
 #ifdef __cplusplus
 }  /* extern "C" */
 #endif
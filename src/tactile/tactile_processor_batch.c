@@ -0,0 +1,629 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "tactile/tactile_processor_batch.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "dsp/aligned_alloc.h"
+#include "dsp/denormals.h"
+#include "dsp/fast_fun.h"
+#include "frontend/carl_frontend_design.h"
+#include "phonetics/hexagon_interpolation.h"
+
+/* Must match kCompressorStabilization in enveloper.c. */
+static const float kCompressorStabilization = 0.125f;
+
+/* Per-channel Enveloper state variables. Each variable is an array over
+ * streams, so that the state for channel c, variable k, stream s is at
+ *
+ *   enveloper_state[(c * kBatchEnveloperStateSize + k) * num_streams + s].
+ */
+enum {
+  kBatchBpf0Z0,
+  kBatchBpf0Z1,
+  kBatchBpf1Z0,
+  kBatchBpf1Z1,
+  kBatchEnergyZ0,
+  kBatchEnergyZ1,
+  kBatchSmoothedEnergy,
+  kBatchNoise,
+  kBatchSmoothedGain,
+  kBatchEnveloperStateSize,
+};
+
+/* Per-channel CarlFrontend state variables, laid out like Enveloper state. */
+enum {
+  kBatchBiquadZ0,
+  kBatchBiquadZ1,
+  kBatchDiffState,
+  kBatchEnergyEnvelopeStage1,
+  kBatchEnergyEnvelope,
+  kBatchPcenDenom,
+  kBatchFrontendStateSize,
+};
+
+/* Gets the array over streams for Enveloper channel `c`, variable `k`. */
+static float* EnveloperStateArray(TactileProcessorBatch* batch, int c, int k) {
+  return batch->enveloper_state +
+      (c * kBatchEnveloperStateSize + k) * batch->num_streams;
+}
+
+/* Gets the array over streams for CarlFrontend channel `c`, variable `k`. */
+static float* FrontendStateArray(TactileProcessorBatch* batch, int c, int k) {
+  return batch->frontend_state +
+      (c * kBatchFrontendStateSize + k) * batch->num_streams;
+}
+
+TactileProcessorBatch* TactileProcessorBatchMake(
+    TactileProcessorParams* params, int num_streams) {
+  if (params == NULL) { return NULL; }
+  if (!(num_streams >= 1)) {
+    fprintf(stderr, "Error: num_streams must be positive.\n");
+    return NULL;
+  }
+
+  TactileProcessorBatch* batch = (TactileProcessorBatch*)AlignedAlloc(
+      sizeof(TactileProcessorBatch));
+  if (batch == NULL) {
+    fprintf(stderr, "Error: Memory allocation failed.\n");
+    goto fail;
+  }
+  batch->enveloper_state = NULL;
+  batch->warm_up_counters = NULL;
+  batch->frontend_state = NULL;
+  batch->workspace = NULL;
+  batch->scratch = NULL;
+  batch->frames = NULL;
+  batch->vowel_hex_weights = NULL;
+  batch->num_streams = num_streams;
+
+  batch->processor = TactileProcessorMake(params);
+  if (batch->processor == NULL) {
+    fprintf(stderr, "Error: TactileProcessorMake failed.\n");
+    goto fail;
+  }
+
+  const int block_size = CarlFrontendBlockSize(batch->processor->frontend);
+  const int num_frontend_channels =
+      CarlFrontendNumChannels(batch->processor->frontend);
+  /* The batch frontend runs the full cascade and PCEN of all channels. */
+  if (batch->processor->frontend->first_output_channel != 0 ||
+      num_frontend_channels !=
+          CarlFrontendCountNumChannels(&params->frontend_params)) {
+    fprintf(stderr, "Error: TactileProcessorBatch does not support a "
+            "frontend channel subset.\n");
+    goto fail;
+  }
+  batch->num_frontend_channels = num_frontend_channels;
+  /* The batch computes the Enveloper power laws with FastPow(). */
+  if (params->enveloper_params.use_fast_pow_table) {
+    fprintf(stderr, "Error: TactileProcessorBatch does not support "
+            "use_fast_pow_table.\n");
+    goto fail;
+  }
+  /* The batch updates all Enveloper channels every frame. */
+  int c;
+  for (c = 0; c < kEnveloperNumChannels; ++c) {
+    if (params->enveloper_params.channel_params[c].output_decimation != 1) {
+      fprintf(stderr, "Error: TactileProcessorBatch does not support "
+              "output_decimation.\n");
+      goto fail;
+    }
+  }
+  /* The batch computes all Enveloper channels from the input, and its frames
+   * are the frontend's channels.
+   */
+  if (params->enveloper_params.side_energy_sample_rate_hz > 0.0f ||
+      params->frame_channel_offset != 0) {
+    fprintf(stderr, "Error: TactileProcessorBatch does not support the "
+            "low-rate profile.\n");
+    goto fail;
+  }
+
+  batch->enveloper_state = (float*)AlignedAlloc(sizeof(float) *
+      kEnveloperNumChannels * kBatchEnveloperStateSize * num_streams);
+  batch->warm_up_counters = (int*)AlignedAlloc(sizeof(int) * num_streams);
+  batch->frontend_state = (float*)AlignedAlloc(sizeof(float) *
+      num_frontend_channels * kBatchFrontendStateSize * num_streams);
+  batch->workspace =
+      (float*)AlignedAlloc(sizeof(float) * block_size * num_streams);
+  batch->scratch = (float*)AlignedAlloc(sizeof(float) * 2 * num_streams);
+  batch->frames = (float*)AlignedAlloc(
+      sizeof(float) * num_frontend_channels * num_streams);
+  batch->vowel_hex_weights =
+      (float*)AlignedAlloc(sizeof(float) * 7 * num_streams);
+  if (batch->enveloper_state == NULL || batch->warm_up_counters == NULL ||
+      batch->frontend_state == NULL || batch->workspace == NULL ||
+      batch->scratch == NULL || batch->frames == NULL ||
+      batch->vowel_hex_weights == NULL) {
+    fprintf(stderr, "Error: Memory allocation failed.\n");
+    goto fail;
+  }
+
+  TactileProcessorBatchReset(batch);
+  return batch;
+
+fail:
+  TactileProcessorBatchFree(batch);
+  return NULL;
+}
+
+void TactileProcessorBatchFree(TactileProcessorBatch* batch) {
+  if (batch) {
+    AlignedFree(batch->vowel_hex_weights);
+    AlignedFree(batch->frames);
+    AlignedFree(batch->scratch);
+    AlignedFree(batch->workspace);
+    AlignedFree(batch->frontend_state);
+    AlignedFree(batch->warm_up_counters);
+    AlignedFree(batch->enveloper_state);
+    TactileProcessorFree(batch->processor);
+    AlignedFree(batch);
+  }
+}
+
+/* Resets Enveloper state for one stream, like `EnveloperReset`. */
+static void ResetEnveloperStream(TactileProcessorBatch* batch, int stream) {
+  int c;
+  for (c = 0; c < kEnveloperNumChannels; ++c) {
+    int k;
+    for (k = 0; k < kBatchEnveloperStateSize; ++k) {
+      EnveloperStateArray(batch, c, k)[stream] = 0.0f;
+    }
+  }
+  batch->warm_up_counters[stream] =
+      batch->processor->enveloper.num_warm_up_samples;
+}
+
+void TactileProcessorBatchReset(TactileProcessorBatch* batch) {
+  int s;
+  for (s = 0; s < batch->num_streams; ++s) {
+    TactileProcessorBatchResetStream(batch, s);
+  }
+}
+
+void TactileProcessorBatchResetStream(TactileProcessorBatch* batch,
+                                      int stream) {
+  ResetEnveloperStream(batch, stream);
+
+  const float pcen_init_value = batch->processor->frontend->pcen_init_value;
+  int c;
+  for (c = 0; c < batch->num_frontend_channels; ++c) {
+    int k;
+    for (k = 0; k < kBatchFrontendStateSize; ++k) {
+      FrontendStateArray(batch, c, k)[stream] =
+          /* PCEN denominator resets to a small positive value, not zero. */
+          (k == kBatchPcenDenom) ? pcen_init_value : 0.0f;
+    }
+  }
+
+  int i;
+  for (i = 0; i < 7; ++i) {
+    batch->vowel_hex_weights[7 * stream + i] = 0.0f;
+  }
+}
+
+/* Smooth gate function, same as SoftGate in enveloper.c. */
+static float SoftGate(float x, float halfway_point) {
+  const float x_sqr = x * x;
+  return x_sqr / (x_sqr + halfway_point * halfway_point);
+}
+
+/* Runs Enveloper on `input` of shape [num_samples, num_streams]. Channel c of
+ * the output for frame i, stream s is written to
+ * outputs[s][channel_map[c] + i * frame_stride].
+ */
+static void BatchEnveloperProcessSamples(TactileProcessorBatch* batch,
+                                         const float* input,
+                                         int num_samples,
+                                         const int* channel_map,
+                                         int frame_stride,
+                                         float* const* outputs) {
+  const Enveloper* enveloper = &batch->processor->enveloper;
+  const int num_streams = batch->num_streams;
+  const BiquadFilterCoeffs energy_coeffs = enveloper->energy_biquad_coeffs;
+  const float energy_smoother_coeff = enveloper->energy_smoother_coeff;
+  const float gate_transition_factor = enveloper->gate_transition_factor;
+  const float agc_exponent = enveloper->agc_exponent;
+  const float compressor_exponent = enveloper->compressor_exponent;
+  const float compressor_delta = enveloper->compressor_delta;
+  const int decimation_factor = enveloper->decimation_factor;
+  const int num_frames = num_samples / decimation_factor;
+  int* warm_up_counters = batch->warm_up_counters;
+  float* energy = batch->scratch;
+  float* prev_smoothed_energy = batch->scratch + num_streams;
+  int i;
+  int s;
+  int c;
+  DenormalGuard guard;
+  DenormalGuardBegin(&guard);
+  /* Dither the filter states as EnveloperProcessSamples() does. */
+  for (c = 0; c < kEnveloperNumChannels; ++c) {
+    DenormalsDither(EnveloperStateArray(batch, c, kBatchBpf0Z0),
+                    (kBatchEnergyZ1 + 1) * num_streams);
+  }
+
+  for (i = 0; i < num_frames; ++i) {
+    for (s = 0; s < num_streams; ++s) {
+      prev_smoothed_energy[s] = 0.0f;
+    }
+
+    for (c = kEnveloperNumChannels - 1; c >= 0; --c) {
+      const EnveloperChannel* enveloper_c = &enveloper->channels[c];
+      const BiquadFilterCoeffs bpf0 = enveloper_c->bpf_biquad_coeffs[0];
+      const BiquadFilterCoeffs bpf1 = enveloper_c->bpf_biquad_coeffs[1];
+      float* bpf0_z0 = EnveloperStateArray(batch, c, kBatchBpf0Z0);
+      float* bpf0_z1 = EnveloperStateArray(batch, c, kBatchBpf0Z1);
+      float* bpf1_z0 = EnveloperStateArray(batch, c, kBatchBpf1Z0);
+      float* bpf1_z1 = EnveloperStateArray(batch, c, kBatchBpf1Z1);
+      float* energy_z0 = EnveloperStateArray(batch, c, kBatchEnergyZ0);
+      float* energy_z1 = EnveloperStateArray(batch, c, kBatchEnergyZ1);
+
+      int j;
+      for (j = 0; j < decimation_factor; ++j) {
+        const float* x = input + (i * decimation_factor + j) * num_streams;
+        /* This inner loop over streams has no cross-iteration dependencies. It
+         * performs the same arithmetic as BiquadFilterProcessOneSample.
+         */
+        for (s = 0; s < num_streams; ++s) {
+          /* Apply bandpass filter. */
+          float next_state = x[s] - bpf0.a1 * bpf0_z0[s] - bpf0.a2 * bpf0_z1[s];
+          float sample = bpf0.b0 * next_state + bpf0.b1 * bpf0_z0[s]
+              + bpf0.b2 * bpf0_z1[s];
+          bpf0_z1[s] = bpf0_z0[s];
+          bpf0_z0[s] = next_state;
+
+          next_state = sample - bpf1.a1 * bpf1_z0[s] - bpf1.a2 * bpf1_z1[s];
+          sample = bpf1.b0 * next_state + bpf1.b1 * bpf1_z0[s]
+              + bpf1.b2 * bpf1_z1[s];
+          bpf1_z1[s] = bpf1_z0[s];
+          bpf1_z0[s] = next_state;
+
+          /* Half-wave rectification and squaring. */
+          const float rectified = (sample > 0.0f) ? sample * sample : 0.0f;
+
+          /* Lowpass filter the energy envelope. */
+          next_state = rectified - energy_coeffs.a1 * energy_z0[s]
+              - energy_coeffs.a2 * energy_z1[s];
+          energy[s] = energy_coeffs.b0 * next_state
+              + energy_coeffs.b1 * energy_z0[s]
+              + energy_coeffs.b2 * energy_z1[s];
+          energy_z1[s] = energy_z0[s];
+          energy_z0[s] = next_state;
+        }
+      }
+
+      float* smoothed_energy_array =
+          EnveloperStateArray(batch, c, kBatchSmoothedEnergy);
+      float* noise_array = EnveloperStateArray(batch, c, kBatchNoise);
+      float* smoothed_gain_array =
+          EnveloperStateArray(batch, c, kBatchSmoothedGain);
+
+      /* PCEN, once per output frame. This follows EnveloperProcessSamples. */
+      for (s = 0; s < num_streams; ++s) {
+        const int warm_up_counter = warm_up_counters[s];
+        float energy_s = energy[s];
+        if (energy_s < 0.0f) { energy_s = 0.0f; }
+
+        float smoothed_energy = smoothed_energy_array[s];
+        float noise = noise_array[s];
+        float smoothed_gain = smoothed_gain_array[s];
+
+        /* Update PCEN denominator. */
+        smoothed_energy += energy_smoother_coeff * (
+            enveloper_c->equalization * energy_s - smoothed_energy);
+
+        if (prev_smoothed_energy[s] > smoothed_energy) {
+          smoothed_energy = prev_smoothed_energy[s];
+        }
+        prev_smoothed_energy[s] = smoothed_energy;
+
+        if (warm_up_counter) {  /* While warming up. */
+          noise += 2.0f * energy_s;  /* Sum up `energy`. */
+          const float average =
+              noise / (enveloper->num_warm_up_samples - warm_up_counter + 1);
+          noise_array[s] = (warm_up_counter == 1) ? average : noise;
+          noise = average;
+        } else {  /* After warm up is done. */
+          /* Update noise level estimate. */
+          noise *= enveloper->noise_coeffs[smoothed_energy > noise];
+          noise_array[s] = noise;
+        }
+
+        if (noise < 1e-9f) { noise = 1e-9f; }
+
+        const float thresh = enveloper_c->gate_thresh_factor * noise;
+        const float diff = smoothed_energy - thresh;
+        float gain;
+        if (diff <= 1e-9f) {
+          gain = 0.0f;
+        } else {
+          /* Apply soft noise gate and AGC gain. */
+          gain = SoftGate(diff, gate_transition_factor * thresh) *
+              FastPow(smoothed_energy, agc_exponent);
+        }
+
+        /* Update smoothed AGC gain with asymmetric smoother. */
+        smoothed_gain += enveloper->gain_smoother_coeffs[gain < smoothed_gain] *
+                         (gain - smoothed_gain);
+
+        smoothed_energy_array[s] = smoothed_energy;
+        smoothed_gain_array[s] = smoothed_gain;
+
+        /* Apply power law compression and output gain. */
+        outputs[s][channel_map[c] + i * frame_stride] =
+            enveloper_c->output_gain *
+            (FastPow(smoothed_gain * energy_s + compressor_delta,
+                     compressor_exponent)
+             - kCompressorStabilization);
+      }
+    }
+
+    for (s = 0; s < num_streams; ++s) {
+      if (warm_up_counters[s]) { --warm_up_counters[s]; }
+    }
+  }
+
+  DenormalGuardEnd(&guard);
+}
+
+/* Runs the CARL+PCEN frontend on `input` of shape [block_size, num_streams],
+ * which is overwritten. PCEN frames are written to `batch->frames`.
+ */
+static void BatchFrontendProcessSamples(TactileProcessorBatch* batch,
+                                        float* input) {
+  const CarlFrontend* frontend = batch->processor->frontend;
+  const int num_channels = batch->num_frontend_channels;
+  const int num_streams = batch->num_streams;
+  const int block_size = frontend->block_size;
+  int stride = 1;
+  int c;
+  int s;
+  DenormalGuard guard;
+  DenormalGuardBegin(&guard);
+  /* Dither the states as CarlFrontendProcessSamples() does. */
+  for (c = 0; c < num_channels; ++c) {
+    DenormalsDither(FrontendStateArray(batch, c, kBatchBiquadZ0),
+                    kBatchPcenDenom * num_streams);
+  }
+
+  for (c = 0; c < num_channels; ++c) {
+    const CarlFrontendChannelData channel_data = frontend->channel_data[c];
+    const BiquadFilterCoeffs coeffs = channel_data.biquad_coeffs;
+    const float envelope_smoother_coeff = channel_data.envelope_smoother_coeff;
+    float* z0 = FrontendStateArray(batch, c, kBatchBiquadZ0);
+    float* z1 = FrontendStateArray(batch, c, kBatchBiquadZ1);
+    float* diff_state = FrontendStateArray(batch, c, kBatchDiffState);
+    float* stage1 = FrontendStateArray(batch, c, kBatchEnergyEnvelopeStage1);
+    float* envelope = FrontendStateArray(batch, c, kBatchEnergyEnvelope);
+
+    if (channel_data.should_decimate) {
+      stride *= 2;  /* Decimate by factor 2. */
+    }
+
+    int i;
+    for (i = 0; i < block_size; i += stride) {
+      float* x = input + i * num_streams;
+      for (s = 0; s < num_streams; ++s) {
+        /* Apply asymmetric resonator biquad filter. */
+        const float next_state = x[s] - coeffs.a1 * z0[s] - coeffs.a2 * z1[s];
+        const float biquad_output =
+            coeffs.b0 * next_state + coeffs.b1 * z0[s] + coeffs.b2 * z1[s];
+        z1[s] = z0[s];
+        z0[s] = next_state;
+        /* Overwrite `input` so that the next biquad is cascaded. */
+        x[s] = biquad_output;
+
+        /* Apply difference filter. This computes CARL's output. */
+        const float carl_output = biquad_output - diff_state[s];
+        diff_state[s] = biquad_output;
+
+        /* Half-wave rectification and square to get energy. */
+        const float energy = (carl_output > 0.0f)
+            ? carl_output * carl_output : 0.0f;
+
+        /* Apply 2nd-order Gamma filter to get anti-aliased energy envelope. */
+        stage1[s] += envelope_smoother_coeff * (energy - stage1[s]);
+        envelope[s] += envelope_smoother_coeff * (stage1[s] - envelope[s]);
+      }
+    }
+  }
+
+  /* Second pass of lowpass filtering for PCEN denominator. */
+  const float pcen_smoother_coeff = frontend->pcen_smoother_coeff;
+  for (c = 0; c < num_channels; ++c) {
+    const float* envelope = FrontendStateArray(batch, c, kBatchEnergyEnvelope);
+    float* pcen_denom = FrontendStateArray(batch, c, kBatchPcenDenom);
+    for (s = 0; s < num_streams; ++s) {
+      pcen_denom[s] += pcen_smoother_coeff * (envelope[s] - pcen_denom[s]);
+    }
+  }
+
+  /* Smooth pcen_denom across channels, as in
+   * PcenDenomCrossChannelSmoothing() in carl_frontend.c.
+   */
+  const float coeff = frontend->pcen_cross_channel_smoother_coeff;
+  float* left_flux = batch->scratch;
+  float* right_flux = batch->scratch + num_streams;
+  float* denom = FrontendStateArray(batch, 0, kBatchPcenDenom);
+  float* next_denom = FrontendStateArray(batch, 1, kBatchPcenDenom);
+  for (s = 0; s < num_streams; ++s) {
+    right_flux[s] = next_denom[s] - denom[s];
+    denom[s] += coeff * right_flux[s];
+  }
+  for (c = 1; c < num_channels - 1; ++c) {
+    denom = next_denom;
+    next_denom = FrontendStateArray(batch, c + 1, kBatchPcenDenom);
+    for (s = 0; s < num_streams; ++s) {
+      left_flux[s] = right_flux[s];
+      right_flux[s] = next_denom[s] - denom[s];
+      denom[s] += coeff * (right_flux[s] - left_flux[s]);
+    }
+  }
+  for (s = 0; s < num_streams; ++s) {
+    next_denom[s] -= coeff * right_flux[s];
+  }
+
+  /* Compute PCEN-normalized energy, with the same formula as CarlFrontend. */
+  for (c = 0; c < num_channels; ++c) {
+    const float* envelope = FrontendStateArray(batch, c, kBatchEnergyEnvelope);
+    const float* pcen_denom = FrontendStateArray(batch, c, kBatchPcenDenom);
+    if (!frontend->vectorized_pcen_compression) {
+      for (s = 0; s < num_streams; ++s) {
+        batch->frames[s * num_channels + c] = CarlFrontendPcenCompression(
+            frontend, envelope[s], pcen_denom[s]);
+      }
+      continue;
+    }
+
+    /* Vectorized compression, four streams at a time. */
+    float pcen[4];
+    for (s = 0; s < num_streams; s += 4) {
+      const int count = (num_streams - s < 4) ? num_streams - s : 4;
+      int j;
+      if (count == 4) {
+        Float4Store(pcen, CarlFrontendPcenCompressionFloat4(
+            frontend, Float4Load(envelope + s), Float4Load(pcen_denom + s)));
+      } else {
+        /* Pad the remaining 1-3 streams with zero energy. */
+        float padded_envelope[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+        float padded_denom[4] = {1.0f, 1.0f, 1.0f, 1.0f};
+        for (j = 0; j < count; ++j) {
+          padded_envelope[j] = envelope[s + j];
+          padded_denom[j] = pcen_denom[s + j];
+        }
+        Float4Store(pcen, CarlFrontendPcenCompressionFloat4(
+            frontend, Float4Load(padded_envelope), Float4Load(padded_denom)));
+      }
+      for (j = 0; j < count; ++j) {
+        batch->frames[(s + j) * num_channels + c] = pcen[j];
+      }
+    }
+  }
+
+  DenormalGuardEnd(&guard);
+}
+
+/* Transposes one block of `inputs` into `batch->workspace` in
+ * [block_size, num_streams] layout.
+ */
+static void TransposeInputs(TactileProcessorBatch* batch,
+                            const float* const* inputs) {
+  const int num_streams = batch->num_streams;
+  const int block_size = CarlFrontendBlockSize(batch->processor->frontend);
+  float* workspace = batch->workspace;
+  int s;
+  for (s = 0; s < num_streams; ++s) {
+    const float* input = inputs[s];
+    int i;
+    for (i = 0; i < block_size; ++i) {
+      workspace[i * num_streams + s] = input[i];
+    }
+  }
+}
+
+void TactileProcessorBatchProcessSamples(TactileProcessorBatch* batch,
+                                         const float* const* inputs,
+                                         float* const* outputs) {
+  /* Output channel for each Enveloper channel. Channel 1 (vowel) is written
+   * temporarily to output channel 1 and later distributed over the cluster.
+   */
+  static const int kMap[kEnveloperNumChannels] = {0, 1, 8, 9};
+  const int num_streams = batch->num_streams;
+  const int block_size = CarlFrontendBlockSize(batch->processor->frontend);
+  const int decimated_block_size =
+      block_size / batch->processor->decimation_factor;
+  float* workspace = batch->workspace;
+  int i;
+  int s;
+
+  TransposeInputs(batch, inputs);
+
+  /* Compute energy envelopes. This must run before the frontend, which
+   * overwrites `workspace`.
+   */
+  BatchEnveloperProcessSamples(batch, workspace, block_size, kMap,
+                               kTactileProcessorNumTactors, outputs);
+  /* Run the CARL frontend. */
+  BatchFrontendProcessSamples(batch, workspace);
+
+  for (s = 0; s < num_streams; ++s) {
+    /* Get 2-D vowel space coordinate. */
+    float vowel_coord[2];
+    EmbedVowel(batch->frames + s * batch->num_frontend_channels, vowel_coord);
+
+    float* vowel_hex_weights = batch->vowel_hex_weights + 7 * s;
+    float next_vowel_hex_weights[7];
+    GetHexagonInterpolationWeightsFast(vowel_coord[0], vowel_coord[1],
+                                       next_vowel_hex_weights);
+    float weights_diff[7];
+    int c;
+    for (c = 0; c < 7; ++c) {
+      weights_diff[c] = next_vowel_hex_weights[c] - vowel_hex_weights[c];
+    }
+
+    /* Map to the vowel hex cluster. */
+    const float blend_step = 1.0f / decimated_block_size;
+    float blend = 0.0f;
+    float* dest = outputs[s] + 1;
+    for (i = 0; i < decimated_block_size; ++i) {
+      blend += blend_step;
+      const float sample = *dest; /* Get the next fine-time sample. */
+      for (c = 0; c < 7; ++c) {  /* Fill the vowel channels. */
+        dest[c] = (vowel_hex_weights[c] + blend * weights_diff[c]) * sample;
+      }
+      dest += kTactileProcessorNumTactors;
+    }
+
+    memcpy(vowel_hex_weights, next_vowel_hex_weights,
+           sizeof(next_vowel_hex_weights));
+  }
+}
+
+void TactileProcessorBatchProcessEnveloper(TactileProcessorBatch* batch,
+                                           const float* const* inputs,
+                                           float* const* outputs) {
+  static const int kIdentityMap[kEnveloperNumChannels] = {0, 1, 2, 3};
+  TransposeInputs(batch, inputs);
+  BatchEnveloperProcessSamples(
+      batch, batch->workspace,
+      CarlFrontendBlockSize(batch->processor->frontend),
+      kIdentityMap, kEnveloperNumChannels, outputs);
+}
+
+void TactileProcessorBatchProcessFrontend(TactileProcessorBatch* batch,
+                                          const float* const* inputs,
+                                          float* const* outputs) {
+  const int num_channels = batch->num_frontend_channels;
+  TransposeInputs(batch, inputs);
+  BatchFrontendProcessSamples(batch, batch->workspace);
+  int s;
+  for (s = 0; s < batch->num_streams; ++s) {
+    memcpy(outputs[s], batch->frames + s * num_channels,
+           num_channels * sizeof(float));
+  }
+}
+
+void TactileProcessorBatchApplyTuning(TactileProcessorBatch* batch,
+                                      const TuningKnobs* knobs) {
+  TactileProcessorApplyTuning(batch->processor, knobs);
+  int s;
+  for (s = 0; s < batch->num_streams; ++s) {
+    ResetEnveloperStream(batch, s);
+  }
+}
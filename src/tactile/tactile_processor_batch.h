@@ -0,0 +1,146 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * Batched TactileProcessor, advancing many independent streams in lockstep.
+ *
+ * `TactileProcessorBatch` computes the same output as running `num_streams`
+ * separate `TactileProcessor` instances with identical params, but is intended
+ * for offline or server-side transcoding where many streams are processed at
+ * once. Filter coefficients are shared between streams, and filter state is
+ * stored in struct-of-arrays layout with the stream as the fastest-varying
+ * index, so that the Enveloper and CARL cascade inner loops run contiguously
+ * across streams and are amenable to compiler auto-vectorization.
+ *
+ * Example use:
+ *   TactileProcessorParams params;
+ *   TactileProcessorSetDefaultParams(&params);
+ *   TactileProcessorBatch* batch = TactileProcessorBatchMake(&params, 16);
+ *
+ *   // Processing loop.
+ *   while (...) {
+ *     const float* inputs[16] = ...   // Each has `block_size` samples.
+ *     float* outputs[16] = ...        // Each has space for
+ *                                     // `kTactileProcessorNumTactors *
+ *                                     //  block_size / decimation_factor`.
+ *     TactileProcessorBatchProcessSamples(batch, inputs, outputs);
+ *     ...
+ *   }
+ *
+ *   TactileProcessorBatchFree(batch);
+ */
+
+#ifndef AUDIO_TO_TACTILE_SRC_TACTILE_TACTILE_PROCESSOR_BATCH_H_
+#define AUDIO_TO_TACTILE_SRC_TACTILE_TACTILE_PROCESSOR_BATCH_H_
+
+#include "tactile/tactile_processor.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+  /* Processor holding the filter coefficients and tuning shared by all
+   * streams. Its own state is not used.
+   */
+  TactileProcessor* processor;
+  /* Number of streams. */
+  int num_streams;
+  /* Number of CarlFrontend channels. */
+  int num_frontend_channels;
+
+  /* Enveloper state in struct-of-arrays layout, with the stream as the
+   * fastest-varying index.
+   */
+  float* enveloper_state;
+  /* Enveloper warm up counters, one for each stream. */
+  int* warm_up_counters;
+  /* CarlFrontend state in struct-of-arrays layout, with the stream as the
+   * fastest-varying index.
+   */
+  float* frontend_state;
+  /* Workspace with space for `block_size * num_streams` floats, used for the
+   * input in [block_size, num_streams] layout.
+   */
+  float* workspace;
+  /* Scratch space of `2 * num_streams` floats. */
+  float* scratch;
+  /* PCEN frames of shape [num_streams, num_frontend_channels]. */
+  float* frames;
+  /* Interpolation weights for the hexagonal vowel cluster, [num_streams, 7]. */
+  float* vowel_hex_weights;
+} TactileProcessorBatch;
+
+/* Makes a `TactileProcessorBatch` for `num_streams` streams, each processed
+ * as by a `TactileProcessor` with `params`. The caller should free it when
+ * done with `TactileProcessorBatchFree`. Returns NULL on failure.
+ */
+TactileProcessorBatch* TactileProcessorBatchMake(
+    TactileProcessorParams* params, int num_streams);
+
+/* Frees a `TactileProcessorBatch`. */
+void TactileProcessorBatchFree(TactileProcessorBatch* batch);
+
+/* Resets all streams to initial state. */
+void TactileProcessorBatchReset(TactileProcessorBatch* batch);
+
+/* Resets stream `stream` to initial state, leaving other streams unchanged.
+ * This is useful to reuse a stream slot for a new input.
+ */
+void TactileProcessorBatchResetStream(TactileProcessorBatch* batch,
+                                      int stream);
+
+/* Processes one block for every stream. `inputs` is an array of `num_streams`
+ * pointers, each to `block_size` samples, and `outputs` is an array of
+ * `num_streams` pointers, each to space for
+ * `kTactileProcessorNumTactors * block_size / decimation_factor` elements.
+ * Output for each stream matches `TactileProcessorProcessSamples`.
+ */
+void TactileProcessorBatchProcessSamples(TactileProcessorBatch* batch,
+                                         const float* const* inputs,
+                                         float* const* outputs);
+
+/* Runs only the Enveloper for one block of every stream, e.g. to compute
+ * energy envelopes for many utterances at once. `outputs` is an array of
+ * `num_streams` pointers, each to space for
+ * `kEnveloperNumChannels * block_size / decimation_factor` elements. Output
+ * for each stream matches `EnveloperProcessSamples` with
+ * `params.enveloper_params`. Only Enveloper state is advanced, so a batch
+ * should be used either with this function or with
+ * `TactileProcessorBatchProcessSamples`, but not both.
+ */
+void TactileProcessorBatchProcessEnveloper(TactileProcessorBatch* batch,
+                                           const float* const* inputs,
+                                           float* const* outputs);
+
+/* Runs only the CARL+PCEN frontend for one block of every stream. `outputs` is
+ * an array of `num_streams` pointers, each to space for
+ * `CarlFrontendNumChannels(batch->processor->frontend)` elements. Output for
+ * each stream matches `CarlFrontendProcessSamples` with
+ * `params.frontend_params`. Only frontend state is advanced, as above.
+ */
+void TactileProcessorBatchProcessFrontend(TactileProcessorBatch* batch,
+                                          const float* const* inputs,
+                                          float* const* outputs);
+
+/* Applies tuning specified by `knobs` to all streams. Like
+ * `TactileProcessorApplyTuning`, this resets Enveloper state.
+ */
+void TactileProcessorBatchApplyTuning(TactileProcessorBatch* batch,
+                                      const TuningKnobs* tuning_knobs);
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif
+#endif /* AUDIO_TO_TACTILE_SRC_TACTILE_TACTILE_PROCESSOR_BATCH_H_ */
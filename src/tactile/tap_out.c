@@ -34,6 +34,8 @@ enum {
    * that the receiver can send once every 100 buffers plus a little slack.
    */
   kMaxBuffersPerHeartbeat = 100 + 5,
+  /* Header size in bytes of a kTapOutMessageCaptureEx message. */
+  kCaptureExHeaderSize = 3 + 5,
 };
 
 typedef enum {
@@ -64,6 +66,19 @@ static TapOutSlice g_slices[kTapOutMaxOutputs];
 static int g_num_outputs = 0;
 static int g_heartbeat_countdown = 0;
 
+/* Ring-buffered capture state. */
+static int g_ring_mode = 0;
+static uint8_t g_every_n[kTapOutMaxOutputs];
+/* Number of buffers until each output is next captured. */
+static int g_every_n_countdown[kTapOutMaxOutputs];
+/* Bit i is set if output i is captured in the current buffer. */
+static int g_output_mask = 0;
+static uint16_t g_sequence = 0;
+static uint16_t g_num_dropped = 0;
+static uint8_t g_ring[kTapOutRingCapacity];
+static int g_ring_start = 0;
+static int g_ring_size = 0;
+
 static void (*g_tx_fun)(const char*, int) = NULL;
 static void (*g_error_fun)(const char*) = NULL;
 
@@ -218,11 +233,18 @@ void TapOutClearDescriptors(void) {
   g_num_descriptors = 0;
 }
 
-int TapOutEnable(const TapOutToken* outputs, int num_outputs) {
+/* Sets up the outputs and slices, with data starting at `offset`. Returns the
+ * total message size, or 0 on failure.
+ */
+static int SetOutputs(const TapOutToken* outputs, int num_outputs,
+                      int offset) {
   g_tap_out_buffer_size = 0;
   g_num_outputs = 0;
+  g_ring_mode = 0;
+  g_ring_start = 0;
+  g_ring_size = 0;
   if (outputs == NULL || num_outputs <= 0) {
-    return 1;
+    return 0;
   }
 
   if (num_outputs > kTapOutMaxOutputs) {
@@ -230,10 +252,6 @@ int TapOutEnable(const TapOutToken* outputs, int num_outputs) {
     return 0;
   }
 
-  int offset = 3;
-  g_tap_out_buffer[0] = kTapOutMarker;
-  g_tap_out_buffer[1] = kTapOutMessageCapture;
-
   int i;
   for (i = 0; i < num_outputs; ++i) {
     if (!(1 <= outputs[i] && outputs[i] <= g_num_descriptors)) { return 0; }
@@ -251,12 +269,113 @@ int TapOutEnable(const TapOutToken* outputs, int num_outputs) {
     }
   }
 
-  g_tap_out_buffer_size = offset;
-  g_tap_out_buffer[2] = offset - 3;  /* Set payload size. */
   g_num_outputs = num_outputs;
+  return offset;
+}
+
+int TapOutEnable(const TapOutToken* outputs, int num_outputs) {
+  const int size = SetOutputs(outputs, num_outputs, 3);
+  if (!size) {
+    return outputs == NULL || num_outputs <= 0;
+  }
+
+  g_tap_out_buffer[0] = kTapOutMarker;
+  g_tap_out_buffer[1] = kTapOutMessageCapture;
+  g_tap_out_buffer[2] = size - 3;  /* Set payload size. */
+  g_tap_out_buffer_size = size;
+  g_output_mask = (1 << num_outputs) - 1;
+  return 1;
+}
+
+/* For ring-buffered capture, determines which outputs are captured in the
+ * current buffer and packs their slices after the header.
+ */
+static void PrepareRingBuffer(void) {
+  int offset = kCaptureExHeaderSize;
+  int mask = 0;
+  int i;
+  for (i = 0; i < g_num_outputs; ++i) {
+    if (g_every_n_countdown[i] == 0) {
+      mask |= 1 << i;
+      g_slices[i].data = g_tap_out_buffer + offset;
+      offset += g_slices[i].size;
+    }
+  }
+  g_output_mask = mask;
+  g_tap_out_buffer_size = offset;
+}
+
+int TapOutEnableRing(const TapOutToken* outputs,
+                     const uint8_t* every_n, int num_outputs) {
+  if (!SetOutputs(outputs, num_outputs, kCaptureExHeaderSize)) { return 0; }
+
+  int i;
+  for (i = 0; i < num_outputs; ++i) {
+    if (!(1 <= every_n[i] && every_n[i] <= kTapOutMaxEveryN)) {
+      Error("TapOutEnableRing: Invalid every_n: %d", every_n[i]);
+      g_num_outputs = 0;
+      return 0;
+    }
+    g_every_n[i] = every_n[i];
+    g_every_n_countdown[i] = 0;
+  }
+
+  g_tap_out_buffer[0] = kTapOutMarker;
+  g_tap_out_buffer[1] = kTapOutMessageCaptureEx;
+  g_ring_mode = 1;
+  g_sequence = 0;
+  g_num_dropped = 0;
+  PrepareRingBuffer();
   return 1;
 }
 
+int TapOutRingSize(void) {
+  return g_ring_size;
+}
+
+int TapOutNumDropped(void) {
+  return g_num_dropped;
+}
+
+/* Appends the current message to the ring, or drops it if there is no room. */
+static void PushToRing(void) {
+  const int size = g_tap_out_buffer_size;
+  if (g_ring_size + size > kTapOutRingCapacity) {
+    ++g_num_dropped;
+    return;
+  }
+
+  g_tap_out_buffer[2] = size - 3;  /* Set payload size. */
+  LittleEndianWriteU16(g_sequence, g_tap_out_buffer + 3);
+  LittleEndianWriteU16(g_num_dropped, g_tap_out_buffer + 5);
+  g_tap_out_buffer[7] = (uint8_t)g_output_mask;
+
+  int end = g_ring_start + g_ring_size;
+  if (end >= kTapOutRingCapacity) { end -= kTapOutRingCapacity; }
+  int first = kTapOutRingCapacity - end;  /* Contiguous space after `end`. */
+  if (first > size) { first = size; }
+  memcpy(g_ring + end, g_tap_out_buffer, first);
+  memcpy(g_ring, g_tap_out_buffer + first, size - first);
+  g_ring_size += size;
+}
+
+int TapOutService(int max_bytes) {
+  int sent = 0;
+  while (g_ring_size > 0 && sent < max_bytes) {
+    int size = kTapOutRingCapacity - g_ring_start;  /* Contiguous bytes. */
+    if (size > g_ring_size) { size = g_ring_size; }
+    if (size > max_bytes - sent) { size = max_bytes - sent; }
+    if (g_tx_fun) {
+      g_tx_fun((const char*)g_ring + g_ring_start, size);
+    }
+    g_ring_start += size;
+    if (g_ring_start >= kTapOutRingCapacity) { g_ring_start = 0; }
+    g_ring_size -= size;
+    sent += size;
+  }
+  return sent;
+}
+
 int TapOutIsActive(void) {
   return g_heartbeat_countdown > 0;
 }
@@ -266,7 +385,9 @@ const TapOutSlice* TapOutGetSlice(TapOutToken output) {
   const TapOutToken* p =
       (const TapOutToken*)memchr(g_outputs, output, g_num_outputs);
   if (p == NULL) { return NULL; }
-  return &g_slices[(int)(p - g_outputs)];
+  const int i = (int)(p - g_outputs);
+  if (!(g_output_mask & (1 << i))) { return NULL; }
+  return &g_slices[i];
 }
 
 void TapOutTextPrint(TapOutToken output, const char* format, ...) {
@@ -307,6 +428,21 @@ static void HandleMessage(int op, const uint8_t* payload, int payload_size) {
       }
       break;
 
+    case kTapOutMessageStartCaptureEx:
+      if (2 <= payload_size && payload_size <= 2 * kTapOutMaxOutputs &&
+          payload_size % 2 == 0) {
+        TapOutToken tokens[kTapOutMaxOutputs];
+        uint8_t every_n[kTapOutMaxOutputs];
+        const int num_outputs = payload_size / 2;
+        int i;
+        for (i = 0; i < num_outputs; ++i) {
+          tokens[i] = payload[2 * i];
+          every_n[i] = payload[2 * i + 1];
+        }
+        TapOutEnableRing(tokens, every_n, num_outputs);
+      }
+      break;
+
     default:
       Error("Unknown op: 0x%02x", op);
   }
@@ -336,6 +472,16 @@ void TapOutFinishedCaptureBuffer(void) {
   --g_heartbeat_countdown;
   if (g_heartbeat_countdown == 0) {
     TapOutEnable(NULL, 0); /* Deactivate tap_out. */
+  } else if (g_ring_mode) {
+    if (g_output_mask) { PushToRing(); }
+    ++g_sequence;
+    int i;
+    for (i = 0; i < g_num_outputs; ++i) {
+      if (--g_every_n_countdown[i] < 0) {
+        g_every_n_countdown[i] = g_every_n[i] - 1;
+      }
+    }
+    PrepareRingBuffer();
   } else if (g_num_outputs > 0) {
     SendBuffer();
   }
@@ -75,6 +75,35 @@
  *  [2] <payload size> - The size of the payload.
  *
  * Followed by the payload data.
+ *
+ * Ring-buffered capture:
+ *
+ * With a "Start Capture" message, a Capture message is sent synchronously
+ * from `TapOutFinishedCaptureBuffer()` for every buffer, which may stall the
+ * caller if the serial link can't keep up. Alternatively, a "Start Capture Ex"
+ * message, or `TapOutEnableRing()`, selects ring-buffered capture:
+ *
+ *  - `TapOutFinishedCaptureBuffer()` only copies the message into a ring
+ *    buffer of kTapOutRingCapacity bytes. If the ring is full, the message is
+ *    dropped and counted.
+ *
+ *  - The caller sends buffered data by calling `TapOutService(max_bytes)`
+ *    from wherever is convenient, e.g. the main loop with
+ *    `max_bytes = Serial.availableForWrite()`, so that sending never blocks.
+ *
+ *  - Each output has an `every_n` factor, so that it is captured only on every
+ *    Nth buffer. On other buffers, `TapOutGetSlice()` returns NULL for it, so
+ *    that its data isn't computed.
+ *
+ * Ring-buffered messages have op kTapOutMessageCaptureEx and payload
+ *
+ *  [0-1] <sequence> - uint16 index of the buffer, incrementing every buffer
+ *        including those where nothing is captured.
+ *  [2-3] <num dropped> - uint16 count of messages dropped so far because the
+ *        ring was full.
+ *  [4]   <output mask> - Bit i is set if the ith enabled output is included.
+ *
+ * followed by the data of the included outputs, in order.
  */
 
 #ifndef AUDIO_TO_TACTILE_SRC_TACTILE_TAP_OUT_H_
@@ -89,6 +118,10 @@ extern "C" {
 enum {
   /* Tap out buffer capacity in bytes. */
   kTapOutBufferCapacity = 256,
+  /* Ring buffer capacity in bytes for ring-buffered capture. */
+  kTapOutRingCapacity = 2048,
+  /* Max `every_n` factor for ring-buffered capture. */
+  kTapOutMaxEveryN = 255,
   /* Max number of dimensions in an output. */
   kTapOutMaxDims = 3,
   /* Max number of simultaneously enabled outputs. */
@@ -109,6 +142,14 @@ enum {
   kTapOutMessageStartCapture = 0x04,
   /* Message containing captured tap out output. */
   kTapOutMessageCapture = 0x05,
+  /* Request to begin ring-buffered capture. Payload is (token, every_n) pairs
+   * for each output.
+   */
+  kTapOutMessageStartCaptureEx = 0x06,
+  /* Message containing ring-buffered captured output, with a sequence number
+   * and drop count.
+   */
+  kTapOutMessageCaptureEx = 0x07,
 };
 
 /* Descriptor metadata for one tap-out output. */
@@ -194,8 +235,27 @@ void TapOutFinishedCaptureBuffer(void);
 int /*bool*/ TapOutEnable(const TapOutToken* outputs, int num_outputs);
 
 
-/* Gets the buffer slice associated with `output`, if it is enabled, or returns
- * NULL if that output is disabled.
+/* Enables `outputs` for ring-buffered capture, where output i is captured on
+ * every `every_n[i]`th buffer, with `every_n[i]` between 1 and
+ * kTapOutMaxEveryN. Returns 1 on success, or 0 on failure. The ring is
+ * cleared and sequence and drop counters restart from zero.
+ */
+int /*bool*/ TapOutEnableRing(const TapOutToken* outputs,
+                              const uint8_t* every_n, int num_outputs);
+
+/* For ring-buffered capture, sends up to `max_bytes` of buffered data with the
+ * tx callback. Returns the number of bytes sent.
+ */
+int TapOutService(int max_bytes);
+
+/* Returns the number of bytes waiting in the ring buffer. */
+int TapOutRingSize(void);
+
+/* Returns the number of ring-buffered messages dropped since capture began. */
+int TapOutNumDropped(void);
+
+/* Gets the buffer slice associated with `output`, if it is enabled and
+ * captured in the current buffer, or returns NULL otherwise.
  */
 const TapOutSlice* TapOutGetSlice(TapOutToken output);
 
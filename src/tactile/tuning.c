@@ -132,6 +132,16 @@ static float MapLogarithmically(int value_in, float min_out, float max_out) {
 }
 
 float TuningMapControlValue(int knob, int value) {
+  if (!(0 <= knob && knob < kNumTuningKnobs)) { return 0.0f; }
+  if (value < 0) {
+    value = 0;
+  } else if (value > 255) {
+    value = 255;
+  }
+  return kTuningKnobTables[knob][value];
+}
+
+float TuningComputeControlValue(int knob, int value) {
   if (!(0 <= knob && knob < kNumTuningKnobs)) { return 0.0f; }
   const TuningKnobInfo* info = &kTuningKnobInfo[knob];
 
@@ -161,9 +171,12 @@ float TuningMapControlValue(int knob, int value) {
   return 0;
 }
 
-float TuningGetInputGain(const TuningKnobs* tuning) {
-  const float input_gain_db =
-      TuningMapControlValue(kKnobInputGain, tuning->values[kKnobInputGain]);
+float TuningComputeInputGain(int value) {
+  const float input_gain_db = TuningComputeControlValue(kKnobInputGain, value);
   /* Convert dB to linear amplitude ratio. */
   return FastExp2((float)(M_LN10 / (20.0 * M_LN2)) * input_gain_db);
 }
+
+float TuningGetInputGain(const TuningKnobs* tuning) {
+  return kTuningInputGainTable[tuning->values[kKnobInputGain]];
+}
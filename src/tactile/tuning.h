@@ -131,7 +131,8 @@ extern const TuningKnobInfo kTuningKnobInfo[kNumTuningKnobs];
 
 /* Maps control values to float parameters in the same way that TuningApply()
  * does. The `knob` arg is a tuning knob index from 0 to kNumTuningKnobs - 1,
- * and `value` is a control value between 0 and 255.
+ * and `value` is a control value between 0 and 255. This is a lookup in the
+ * precomputed kTuningKnobTables.
  *
  * The meaning of the returned float value depends on the knob:
  *
@@ -145,14 +146,31 @@ extern const TuningKnobInfo kTuningKnobInfo[kNumTuningKnobs];
  */
 float TuningMapControlValue(int knob, int value);
 
-/* Gets the mapped value for knob `knob`. */
+/* Precomputed TuningComputeControlValue() for every knob and control value,
+ * and TuningComputeInputGain() for every input gain control value, so that
+ * applying tuning is table lookups. Defined in tuning_tables.c.
+ */
+extern const float kTuningKnobTables[kNumTuningKnobs][256];
+extern const float kTuningInputGainTable[256];
+
+/* Gets the mapped value for knob `knob`, which must be a valid knob index. */
 static float TuningGet(const TuningKnobs* tuning, int knob) {
-  return TuningMapControlValue(knob, tuning->values[knob]);
+  return kTuningKnobTables[knob][tuning->values[knob]];
 }
 
 /* Gets the input gain as a linear amplitude ratio. */
 float TuningGetInputGain(const TuningKnobs* tuning);
 
+/* Computes the mapping of TuningMapControlValue() from kTuningKnobInfo, as
+ * used to generate kTuningKnobTables.
+ */
+float TuningComputeControlValue(int knob, int value);
+
+/* Computes the input gain of TuningGetInputGain() for control value `value`,
+ * as used to generate kTuningInputGainTable.
+ */
+float TuningComputeInputGain(int value);
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
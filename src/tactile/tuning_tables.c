@@ -0,0 +1,757 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * Precomputed tuning knob maps.
+ *
+ * These are TuningComputeControlValue() for every knob and control value 0 to
+ * 255, and TuningComputeInputGain() for every input gain control value, so
+ * that reading and applying tuning knobs is table lookups rather than
+ * exp/log evaluations. Tables after the includes can be regenerated by
+ * running the unit test as
+ *
+ * tuning_test --print_tables
+ */
+
+#include "tactile/tuning.h"
+
+const float kTuningKnobTables[kNumTuningKnobs][256] = {
+  { /* Input gain */
+    -30, -29.7637787, -29.5275593, -29.291338,
+    -29.0551167, -28.8188953, -28.5826759, -28.3464546,
+    -28.1102333, -27.874012, -27.6377926, -27.4015713,
+    -27.16535, -26.9291306, -26.6929092, -26.4566879,
+    -26.2204666, -25.9842472, -25.7480259, -25.5118046,
+    -25.2755852, -25.0393639, -24.8031425, -24.5669212,
+    -24.3307018, -24.0944805, -23.8582592, -23.6220398,
+    -23.3858185, -23.1495972, -22.9133759, -22.6771564,
+    -22.4409351, -22.2047138, -21.9684944, -21.7322731,
+    -21.4960518, -21.2598305, -21.0236092, -20.7873898,
+    -20.5511684, -20.314949, -20.0787277, -19.8425064,
+    -19.6062851, -19.3700638, -19.1338444, -18.8976231,
+    -18.6614037, -18.4251823, -18.188961, -17.9527397,
+    -17.7165184, -17.480299, -17.2440777, -17.0078583,
+    -16.771637, -16.5354156, -16.2991943, -16.062973,
+    -15.8267536, -15.5905323, -15.3543119, -15.1180906,
+    -14.8818703, -14.6456499, -14.4094286, -14.1732082,
+    -13.9369869, -13.7007656, -13.4645462, -13.2283249,
+    -12.9921036, -12.7558842, -12.5196629, -12.2834415,
+    -12.0472202, -11.8110008, -11.5747795, -11.3385582,
+    -11.1023369, -10.8661175, -10.6298962, -10.3936749,
+    -10.1574554, -9.92123413, -9.68501282, -9.4487915,
+    -9.2125721, -8.97635078, -8.74012947, -8.50391006,
+    -8.26768875, -8.03146744, -7.79524612, -7.55902672,
+    -7.3228054, -7.08658409, -6.85036469, -6.61414337,
+    -6.37792206, -6.14170074, -5.90548134, -5.66926003,
+    -5.43303871, -5.19681931, -4.96059799, -4.72437668,
+    -4.48815536, -4.25193596, -4.01571465, -3.77949333,
+    -3.54327393, -3.30705261, -3.0708313, -2.83460999,
+    -2.59839058, -2.36216927, -2.12594795, -1.88972664,
+    -1.65350723, -1.41728592, -1.18106461, -0.9448452,
+    -0.708623886, -0.472402573, -0.236181259, 3.81469727e-05,
+    0.23625946, 0.472480774, 0.70870018, 0.944921494,
+    1.18114281, 1.41736412, 1.65358353, 1.88980484,
+    2.12602615, 2.36224747, 2.59846878, 2.83468628,
+    3.07090759, 3.30712891, 3.54335022, 3.77957153,
+    4.01579285, 4.25201416, 4.48823166, 4.72445297,
+    4.96067429, 5.1968956, 5.43311691, 5.66933823,
+    5.90555954, 6.14177704, 6.37799835, 6.61421967,
+    6.85044098, 7.08666229, 7.32288361, 7.55910492,
+    7.79532623, 8.03154373, 8.26776505, 8.50398636,
+    8.74020767, 8.97642899, 9.2126503, 9.44887161,
+    9.68508911, 9.92131042, 10.1575317, 10.3937531,
+    10.6299744, 10.8661957, 11.102417, 11.3386345,
+    11.5748558, 11.8110771, 12.0472984, 12.2835197,
+    12.5197411, 12.7559624, 12.9921799, 13.2284012,
+    13.4646225, 13.7008438, 13.9370651, 14.1732864,
+    14.4095078, 14.6457253, 14.8819466, 15.1181679,
+    15.3543892, 15.5906105, 15.8268318, 16.0630531,
+    16.2992706, 16.5354919, 16.7717133, 17.0079346,
+    17.2441559, 17.4803772, 17.7165985, 17.952816,
+    18.1890373, 18.4252586, 18.6614799, 18.8977013,
+    19.1339226, 19.3701439, 19.6063614, 19.8425827,
+    20.078804, 20.3150253, 20.5512466, 20.787468,
+    21.0236893, 21.2599068, 21.4961281, 21.7323494,
+    21.9685707, 22.204792, 22.4410133, 22.6772346,
+    22.9134521, 23.1496735, 23.3858948, 23.6221161,
+    23.8583374, 24.0945587, 24.33078, 24.5670013,
+    24.8032188, 25.0394402, 25.2756615, 25.5118828,
+    25.7481041, 25.9843254, 26.2205467, 26.4567642,
+    26.6929855, 26.9292068, 27.1654282, 27.4016495,
+    27.6378708, 27.8740921, 28.1103096, 28.3465309,
+    28.5827522, 28.8189735, 29.0551949, 29.2914162,
+    29.5276375, 29.763855, 30.0000763, 30.2362995,
+  },
+  { /* Output gain */
+    -30, -29.7637787, -29.5275593, -29.291338,
+    -29.0551167, -28.8188953, -28.5826759, -28.3464546,
+    -28.1102333, -27.874012, -27.6377926, -27.4015713,
+    -27.16535, -26.9291306, -26.6929092, -26.4566879,
+    -26.2204666, -25.9842472, -25.7480259, -25.5118046,
+    -25.2755852, -25.0393639, -24.8031425, -24.5669212,
+    -24.3307018, -24.0944805, -23.8582592, -23.6220398,
+    -23.3858185, -23.1495972, -22.9133759, -22.6771564,
+    -22.4409351, -22.2047138, -21.9684944, -21.7322731,
+    -21.4960518, -21.2598305, -21.0236092, -20.7873898,
+    -20.5511684, -20.314949, -20.0787277, -19.8425064,
+    -19.6062851, -19.3700638, -19.1338444, -18.8976231,
+    -18.6614037, -18.4251823, -18.188961, -17.9527397,
+    -17.7165184, -17.480299, -17.2440777, -17.0078583,
+    -16.771637, -16.5354156, -16.2991943, -16.062973,
+    -15.8267536, -15.5905323, -15.3543119, -15.1180906,
+    -14.8818703, -14.6456499, -14.4094286, -14.1732082,
+    -13.9369869, -13.7007656, -13.4645462, -13.2283249,
+    -12.9921036, -12.7558842, -12.5196629, -12.2834415,
+    -12.0472202, -11.8110008, -11.5747795, -11.3385582,
+    -11.1023369, -10.8661175, -10.6298962, -10.3936749,
+    -10.1574554, -9.92123413, -9.68501282, -9.4487915,
+    -9.2125721, -8.97635078, -8.74012947, -8.50391006,
+    -8.26768875, -8.03146744, -7.79524612, -7.55902672,
+    -7.3228054, -7.08658409, -6.85036469, -6.61414337,
+    -6.37792206, -6.14170074, -5.90548134, -5.66926003,
+    -5.43303871, -5.19681931, -4.96059799, -4.72437668,
+    -4.48815536, -4.25193596, -4.01571465, -3.77949333,
+    -3.54327393, -3.30705261, -3.0708313, -2.83460999,
+    -2.59839058, -2.36216927, -2.12594795, -1.88972664,
+    -1.65350723, -1.41728592, -1.18106461, -0.9448452,
+    -0.708623886, -0.472402573, -0.236181259, 3.81469727e-05,
+    0.23625946, 0.472480774, 0.70870018, 0.944921494,
+    1.18114281, 1.41736412, 1.65358353, 1.88980484,
+    2.12602615, 2.36224747, 2.59846878, 2.83468628,
+    3.07090759, 3.30712891, 3.54335022, 3.77957153,
+    4.01579285, 4.25201416, 4.48823166, 4.72445297,
+    4.96067429, 5.1968956, 5.43311691, 5.66933823,
+    5.90555954, 6.14177704, 6.37799835, 6.61421967,
+    6.85044098, 7.08666229, 7.32288361, 7.55910492,
+    7.79532623, 8.03154373, 8.26776505, 8.50398636,
+    8.74020767, 8.97642899, 9.2126503, 9.44887161,
+    9.68508911, 9.92131042, 10.1575317, 10.3937531,
+    10.6299744, 10.8661957, 11.102417, 11.3386345,
+    11.5748558, 11.8110771, 12.0472984, 12.2835197,
+    12.5197411, 12.7559624, 12.9921799, 13.2284012,
+    13.4646225, 13.7008438, 13.9370651, 14.1732864,
+    14.4095078, 14.6457253, 14.8819466, 15.1181679,
+    15.3543892, 15.5906105, 15.8268318, 16.0630531,
+    16.2992706, 16.5354919, 16.7717133, 17.0079346,
+    17.2441559, 17.4803772, 17.7165985, 17.952816,
+    18.1890373, 18.4252586, 18.6614799, 18.8977013,
+    19.1339226, 19.3701439, 19.6063614, 19.8425827,
+    20.078804, 20.3150253, 20.5512466, 20.787468,
+    21.0236893, 21.2599068, 21.4961281, 21.7323494,
+    21.9685707, 22.204792, 22.4410133, 22.6772346,
+    22.9134521, 23.1496735, 23.3858948, 23.6221161,
+    23.8583374, 24.0945587, 24.33078, 24.5670013,
+    24.8032188, 25.0394402, 25.2756615, 25.5118828,
+    25.7481041, 25.9843254, 26.2205467, 26.4567642,
+    26.6929855, 26.9292068, 27.1654282, 27.4016495,
+    27.6378708, 27.8740921, 28.1103096, 28.3465309,
+    28.5827522, 28.8189735, 29.0551949, 29.2914162,
+    29.5276375, 29.763855, 30.0000763, 30.2362995,
+  },
+  { /* Noise adaptation */
+    0.200000003, 0.20350343, 0.207397267, 0.21136561,
+    0.214827418, 0.218937919, 0.223127082, 0.226781532,
+    0.231120765, 0.235543028, 0.239400819, 0.243981525,
+    0.248649865, 0.252722323, 0.257557899, 0.262486011,
+    0.266785115, 0.271889776, 0.277092099, 0.281630397,
+    0.287019134, 0.292510957, 0.297301769, 0.302990347,
+    0.308787763, 0.313845187, 0.319850296, 0.325970322,
+    0.33130917, 0.337648422, 0.344108999, 0.349744916,
+    0.356436938, 0.363256991, 0.369206548, 0.37627095,
+    0.383470505, 0.389751107, 0.397208601, 0.404808789,
+    0.411438882, 0.419311345, 0.427334458, 0.434333473,
+    0.442644, 0.451113552, 0.458502024, 0.467274994,
+    0.476215839, 0.484015465, 0.493276596, 0.502714932,
+    0.510948598, 0.520725071, 0.530688643, 0.539380372,
+    0.549700916, 0.560218871, 0.57093811, 0.580289125,
+    0.591392338, 0.602708042, 0.612579405, 0.62430048,
+    0.636245847, 0.646666467, 0.659039795, 0.671649873,
+    0.682650387, 0.695712209, 0.709023952, 0.720636547,
+    0.734425247, 0.748477697, 0.760736525, 0.775292456,
+    0.79012692, 0.803067863, 0.818433762, 0.83409363,
+    0.847754717, 0.863975644, 0.880506933, 0.894928157,
+    0.912051737, 0.929502904, 0.944726586, 0.962803006,
+    0.981225252, 0.997296095, 1.01637828, 1.03582573,
+    1.05279076, 1.07293487, 1.09346437, 1.11137354,
+    1.13263857, 1.15431046, 1.1732161, 1.19566441,
+    1.21854222, 1.23849988, 1.26219738, 1.28634822,
+    1.30741644, 1.33243251, 1.35792732, 1.38016784,
+    1.40657604, 1.43348944, 1.45696759, 1.48484516,
+    1.51325619, 1.53804076, 1.56746972, 1.59746158,
+    1.62802744, 1.65469182, 1.68635261, 1.71861935,
+    1.7467674, 1.78019011, 1.81425226, 1.8439666,
+    1.8792491, 1.91520655, 1.94657445, 1.9838202,
+    2.02177858, 2.05489182, 2.09421015, 2.13428092,
+    2.16923666, 2.21074295, 2.25304317, 2.28994441,
+    2.33376002, 2.37841415, 2.41736865, 2.46362257,
+    2.5107615, 2.5518837, 2.60071135, 2.65047336,
+    2.69388366, 2.74542832, 2.79795933, 2.84378529,
+    2.89819813, 2.95365238, 3.00202823, 3.05946898,
+    3.11800885, 3.16907668, 3.22971368, 3.29151106,
+    3.34542036, 3.4094317, 3.47466779, 3.53157687,
+    3.59915018, 3.6680162, 3.72809219, 3.79942536,
+    3.87212372, 3.93554258, 4.01084518, 4.08758879,
+    4.15453625, 4.23402929, 4.31504297, 4.38571644,
+    4.46963263, 4.5551548, 4.642313, 4.71834612,
+    4.80862713, 4.90063524, 4.98089933, 5.07620382,
+    5.17333174, 5.25806236, 5.35867023, 5.4612031,
+    5.55064821, 5.65685415, 5.76509237, 5.85951519,
+    5.97163105, 6.0858922, 6.18556881, 6.30392361,
+    6.4245429, 6.52976608, 6.65470648, 6.78203773,
+    6.893116, 7.02500868, 7.15942526, 7.27668476,
+    7.41591644, 7.55781269, 7.68159676, 7.82857656,
+    7.97836876, 8.10904026, 8.26419926, 8.42232609,
+    8.56026936, 8.72406197, 8.89098835, 9.03660774,
+    9.20951366, 9.38572884, 9.53945065, 9.72197914,
+    9.90799904, 10.0702753, 10.2629604, 10.4593315,
+    10.6306381, 10.8340445, 11.0413427, 11.2221813,
+    11.4369068, 11.6557407, 11.8466415, 12.0733156,
+    12.3043261, 12.5397577, 12.7451372, 12.9890032,
+    13.2375345, 13.4543428, 13.7117786, 13.9741392,
+    14.2030125, 14.4747725, 14.7517328, 14.9933414,
+    15.2802238, 15.5725956, 15.8276482, 16.1304951,
+    16.4391346, 16.7083797, 17.0280781, 17.3538933,
+    17.6381207, 17.9756088, 18.3195553, 18.6195984,
+    18.9758644, 19.3389492, 19.6556892, 20,
+  },
+  { /* Denoising: baseband */
+    0.5, 0.510948598, 0.522136867, 0.53357023,
+    0.543779552, 0.555686772, 0.567854702, 0.578720033,
+    0.591392338, 0.604342163, 0.615905643, 0.629392207,
+    0.643174112, 0.655480623, 0.669833779, 0.684501231,
+    0.697598457, 0.712873876, 0.728483796, 0.744435489,
+    0.758679509, 0.775292456, 0.79226917, 0.80742842,
+    0.825108826, 0.843176305, 0.859309673, 0.878126085,
+    0.897354543, 0.914524555, 0.934549987, 0.95501399,
+    0.973287225, 0.994599462, 1.01637828, 1.03582573,
+    1.05850732, 1.08168566, 1.10238254, 1.12652159,
+    1.15118921, 1.1732161, 1.19890618, 1.22515881,
+    1.24860096, 1.27594185, 1.30388129, 1.32882977,
+    1.35792732, 1.38766205, 1.41421354, 1.44518077,
+    1.47682619, 1.5050838, 1.53804076, 1.57171953,
+    1.60179281, 1.63686752, 1.67271018, 1.70471585,
+    1.74204421, 1.78019011, 1.81425226, 1.85397911,
+    1.89457595, 1.93082678, 1.97310638, 2.01631188,
+    2.05489182, 2.09988809, 2.14586973, 2.18692875,
+    2.23481631, 2.28375244, 2.33376002, 2.37841415,
+    2.43049479, 2.48371553, 2.53123903, 2.58666587,
+    2.64330649, 2.69388366, 2.75287199, 2.81315207,
+    2.86697888, 2.9297576, 2.99391079, 3.05119634,
+    3.11800885, 3.1862843, 3.2472508, 3.31835628,
+    3.39101887, 3.45590258, 3.53157687, 3.60890841,
+    3.67796135, 3.75849819, 3.84079838, 3.91428828,
+    4, 4.08758879, 4.16580057, 4.25701952,
+    4.35023642, 4.43347359, 4.53055429, 4.62976027,
+    4.71834612, 4.82166433, 4.92724514, 5.021523,
+    5.13148022, 5.24384499, 5.34418058, 5.4612031,
+    5.58078766, 5.68757057, 5.81211185, 5.93938065,
+    6.05302477, 6.18556881, 6.32101536, 6.44196129,
+    6.58302212, 6.72717142, 6.85588932, 7.00601339,
+    7.15942526, 7.31619644, 7.45618439, 7.61945343,
+    7.7862978, 7.9352808, 8.10904026, 8.28660583,
+    8.44516182, 8.63008595, 8.81906033, 8.98780441,
+    9.18461227, 9.38572884, 9.56531525, 9.77476788,
+    9.98880768, 10.1799335, 10.4028454, 10.6306381,
+    10.8340445, 11.0712795, 11.3137083, 11.5301847,
+    11.7826633, 12.0406704, 12.2710562, 12.5397577,
+    12.8143425, 13.0595322, 13.3454981, 13.6377268,
+    13.8986712, 14.2030125, 14.5140181, 14.791729,
+    15.1156254, 15.4466143, 15.7421703, 16.0868778,
+    16.4391346, 16.7536812, 17.1205387, 17.49543,
+    17.8301888, 18.2206192, 18.6195984, 18.9758644,
+    19.3913822, 19.8159981, 20.195158, 20.6373749,
+    21.0892735, 21.4927959, 21.9634266, 22.4443626,
+    22.9358311, 23.3746853, 23.8865242, 24.4095707,
+    24.8766232, 25.4213505, 25.9780064, 26.475069,
+    27.0547981, 27.6472206, 28.1762218, 28.7932014,
+    29.4236908, 29.9866829, 30.6433048, 31.3143063,
+    31.913475, 32.6122894, 33.3264046, 33.9640732,
+    34.7077866, 35.4677887, 36.146431, 36.9379349,
+    37.746769, 38.469017, 39.3113785, 40.172184,
+    40.9408379, 41.837326, 42.7534447, 43.5714874,
+    44.5255814, 45.5005646, 46.37117, 47.3865662,
+    48.4241982, 49.3507462, 50.4313889, 51.5356903,
+    52.5217743, 53.6718521, 54.8471146, 55.8965569,
+    57.120533, 58.3713112, 59.4881859, 60.7908058,
+    62.1219521, 63.3105927, 64.6969147, 66.1135941,
+    67.5612946, 68.8540115, 70.3617172, 71.9024353,
+    73.2782211, 74.8828049, 76.522522, 77.986702,
+    79.6943893, 81.4394684, 82.9977341, 84.8151474,
+    86.6723557, 88.3307419, 90.2649384, 92.241478,
+    94.0064316, 96.0649033, 98.1684494, 100,
+  },
+  { /* Denoising: vowel */
+    0.5, 0.510948598, 0.522136867, 0.53357023,
+    0.543779552, 0.555686772, 0.567854702, 0.578720033,
+    0.591392338, 0.604342163, 0.615905643, 0.629392207,
+    0.643174112, 0.655480623, 0.669833779, 0.684501231,
+    0.697598457, 0.712873876, 0.728483796, 0.744435489,
+    0.758679509, 0.775292456, 0.79226917, 0.80742842,
+    0.825108826, 0.843176305, 0.859309673, 0.878126085,
+    0.897354543, 0.914524555, 0.934549987, 0.95501399,
+    0.973287225, 0.994599462, 1.01637828, 1.03582573,
+    1.05850732, 1.08168566, 1.10238254, 1.12652159,
+    1.15118921, 1.1732161, 1.19890618, 1.22515881,
+    1.24860096, 1.27594185, 1.30388129, 1.32882977,
+    1.35792732, 1.38766205, 1.41421354, 1.44518077,
+    1.47682619, 1.5050838, 1.53804076, 1.57171953,
+    1.60179281, 1.63686752, 1.67271018, 1.70471585,
+    1.74204421, 1.78019011, 1.81425226, 1.85397911,
+    1.89457595, 1.93082678, 1.97310638, 2.01631188,
+    2.05489182, 2.09988809, 2.14586973, 2.18692875,
+    2.23481631, 2.28375244, 2.33376002, 2.37841415,
+    2.43049479, 2.48371553, 2.53123903, 2.58666587,
+    2.64330649, 2.69388366, 2.75287199, 2.81315207,
+    2.86697888, 2.9297576, 2.99391079, 3.05119634,
+    3.11800885, 3.1862843, 3.2472508, 3.31835628,
+    3.39101887, 3.45590258, 3.53157687, 3.60890841,
+    3.67796135, 3.75849819, 3.84079838, 3.91428828,
+    4, 4.08758879, 4.16580057, 4.25701952,
+    4.35023642, 4.43347359, 4.53055429, 4.62976027,
+    4.71834612, 4.82166433, 4.92724514, 5.021523,
+    5.13148022, 5.24384499, 5.34418058, 5.4612031,
+    5.58078766, 5.68757057, 5.81211185, 5.93938065,
+    6.05302477, 6.18556881, 6.32101536, 6.44196129,
+    6.58302212, 6.72717142, 6.85588932, 7.00601339,
+    7.15942526, 7.31619644, 7.45618439, 7.61945343,
+    7.7862978, 7.9352808, 8.10904026, 8.28660583,
+    8.44516182, 8.63008595, 8.81906033, 8.98780441,
+    9.18461227, 9.38572884, 9.56531525, 9.77476788,
+    9.98880768, 10.1799335, 10.4028454, 10.6306381,
+    10.8340445, 11.0712795, 11.3137083, 11.5301847,
+    11.7826633, 12.0406704, 12.2710562, 12.5397577,
+    12.8143425, 13.0595322, 13.3454981, 13.6377268,
+    13.8986712, 14.2030125, 14.5140181, 14.791729,
+    15.1156254, 15.4466143, 15.7421703, 16.0868778,
+    16.4391346, 16.7536812, 17.1205387, 17.49543,
+    17.8301888, 18.2206192, 18.6195984, 18.9758644,
+    19.3913822, 19.8159981, 20.195158, 20.6373749,
+    21.0892735, 21.4927959, 21.9634266, 22.4443626,
+    22.9358311, 23.3746853, 23.8865242, 24.4095707,
+    24.8766232, 25.4213505, 25.9780064, 26.475069,
+    27.0547981, 27.6472206, 28.1762218, 28.7932014,
+    29.4236908, 29.9866829, 30.6433048, 31.3143063,
+    31.913475, 32.6122894, 33.3264046, 33.9640732,
+    34.7077866, 35.4677887, 36.146431, 36.9379349,
+    37.746769, 38.469017, 39.3113785, 40.172184,
+    40.9408379, 41.837326, 42.7534447, 43.5714874,
+    44.5255814, 45.5005646, 46.37117, 47.3865662,
+    48.4241982, 49.3507462, 50.4313889, 51.5356903,
+    52.5217743, 53.6718521, 54.8471146, 55.8965569,
+    57.120533, 58.3713112, 59.4881859, 60.7908058,
+    62.1219521, 63.3105927, 64.6969147, 66.1135941,
+    67.5612946, 68.8540115, 70.3617172, 71.9024353,
+    73.2782211, 74.8828049, 76.522522, 77.986702,
+    79.6943893, 81.4394684, 82.9977341, 84.8151474,
+    86.6723557, 88.3307419, 90.2649384, 92.241478,
+    94.0064316, 96.0649033, 98.1684494, 100,
+  },
+  { /* Denoising: sh fricative */
+    0.5, 0.510948598, 0.522136867, 0.53357023,
+    0.543779552, 0.555686772, 0.567854702, 0.578720033,
+    0.591392338, 0.604342163, 0.615905643, 0.629392207,
+    0.643174112, 0.655480623, 0.669833779, 0.684501231,
+    0.697598457, 0.712873876, 0.728483796, 0.744435489,
+    0.758679509, 0.775292456, 0.79226917, 0.80742842,
+    0.825108826, 0.843176305, 0.859309673, 0.878126085,
+    0.897354543, 0.914524555, 0.934549987, 0.95501399,
+    0.973287225, 0.994599462, 1.01637828, 1.03582573,
+    1.05850732, 1.08168566, 1.10238254, 1.12652159,
+    1.15118921, 1.1732161, 1.19890618, 1.22515881,
+    1.24860096, 1.27594185, 1.30388129, 1.32882977,
+    1.35792732, 1.38766205, 1.41421354, 1.44518077,
+    1.47682619, 1.5050838, 1.53804076, 1.57171953,
+    1.60179281, 1.63686752, 1.67271018, 1.70471585,
+    1.74204421, 1.78019011, 1.81425226, 1.85397911,
+    1.89457595, 1.93082678, 1.97310638, 2.01631188,
+    2.05489182, 2.09988809, 2.14586973, 2.18692875,
+    2.23481631, 2.28375244, 2.33376002, 2.37841415,
+    2.43049479, 2.48371553, 2.53123903, 2.58666587,
+    2.64330649, 2.69388366, 2.75287199, 2.81315207,
+    2.86697888, 2.9297576, 2.99391079, 3.05119634,
+    3.11800885, 3.1862843, 3.2472508, 3.31835628,
+    3.39101887, 3.45590258, 3.53157687, 3.60890841,
+    3.67796135, 3.75849819, 3.84079838, 3.91428828,
+    4, 4.08758879, 4.16580057, 4.25701952,
+    4.35023642, 4.43347359, 4.53055429, 4.62976027,
+    4.71834612, 4.82166433, 4.92724514, 5.021523,
+    5.13148022, 5.24384499, 5.34418058, 5.4612031,
+    5.58078766, 5.68757057, 5.81211185, 5.93938065,
+    6.05302477, 6.18556881, 6.32101536, 6.44196129,
+    6.58302212, 6.72717142, 6.85588932, 7.00601339,
+    7.15942526, 7.31619644, 7.45618439, 7.61945343,
+    7.7862978, 7.9352808, 8.10904026, 8.28660583,
+    8.44516182, 8.63008595, 8.81906033, 8.98780441,
+    9.18461227, 9.38572884, 9.56531525, 9.77476788,
+    9.98880768, 10.1799335, 10.4028454, 10.6306381,
+    10.8340445, 11.0712795, 11.3137083, 11.5301847,
+    11.7826633, 12.0406704, 12.2710562, 12.5397577,
+    12.8143425, 13.0595322, 13.3454981, 13.6377268,
+    13.8986712, 14.2030125, 14.5140181, 14.791729,
+    15.1156254, 15.4466143, 15.7421703, 16.0868778,
+    16.4391346, 16.7536812, 17.1205387, 17.49543,
+    17.8301888, 18.2206192, 18.6195984, 18.9758644,
+    19.3913822, 19.8159981, 20.195158, 20.6373749,
+    21.0892735, 21.4927959, 21.9634266, 22.4443626,
+    22.9358311, 23.3746853, 23.8865242, 24.4095707,
+    24.8766232, 25.4213505, 25.9780064, 26.475069,
+    27.0547981, 27.6472206, 28.1762218, 28.7932014,
+    29.4236908, 29.9866829, 30.6433048, 31.3143063,
+    31.913475, 32.6122894, 33.3264046, 33.9640732,
+    34.7077866, 35.4677887, 36.146431, 36.9379349,
+    37.746769, 38.469017, 39.3113785, 40.172184,
+    40.9408379, 41.837326, 42.7534447, 43.5714874,
+    44.5255814, 45.5005646, 46.37117, 47.3865662,
+    48.4241982, 49.3507462, 50.4313889, 51.5356903,
+    52.5217743, 53.6718521, 54.8471146, 55.8965569,
+    57.120533, 58.3713112, 59.4881859, 60.7908058,
+    62.1219521, 63.3105927, 64.6969147, 66.1135941,
+    67.5612946, 68.8540115, 70.3617172, 71.9024353,
+    73.2782211, 74.8828049, 76.522522, 77.986702,
+    79.6943893, 81.4394684, 82.9977341, 84.8151474,
+    86.6723557, 88.3307419, 90.2649384, 92.241478,
+    94.0064316, 96.0649033, 98.1684494, 100,
+  },
+  { /* Denoising: fricative */
+    0.5, 0.510948598, 0.522136867, 0.53357023,
+    0.543779552, 0.555686772, 0.567854702, 0.578720033,
+    0.591392338, 0.604342163, 0.615905643, 0.629392207,
+    0.643174112, 0.655480623, 0.669833779, 0.684501231,
+    0.697598457, 0.712873876, 0.728483796, 0.744435489,
+    0.758679509, 0.775292456, 0.79226917, 0.80742842,
+    0.825108826, 0.843176305, 0.859309673, 0.878126085,
+    0.897354543, 0.914524555, 0.934549987, 0.95501399,
+    0.973287225, 0.994599462, 1.01637828, 1.03582573,
+    1.05850732, 1.08168566, 1.10238254, 1.12652159,
+    1.15118921, 1.1732161, 1.19890618, 1.22515881,
+    1.24860096, 1.27594185, 1.30388129, 1.32882977,
+    1.35792732, 1.38766205, 1.41421354, 1.44518077,
+    1.47682619, 1.5050838, 1.53804076, 1.57171953,
+    1.60179281, 1.63686752, 1.67271018, 1.70471585,
+    1.74204421, 1.78019011, 1.81425226, 1.85397911,
+    1.89457595, 1.93082678, 1.97310638, 2.01631188,
+    2.05489182, 2.09988809, 2.14586973, 2.18692875,
+    2.23481631, 2.28375244, 2.33376002, 2.37841415,
+    2.43049479, 2.48371553, 2.53123903, 2.58666587,
+    2.64330649, 2.69388366, 2.75287199, 2.81315207,
+    2.86697888, 2.9297576, 2.99391079, 3.05119634,
+    3.11800885, 3.1862843, 3.2472508, 3.31835628,
+    3.39101887, 3.45590258, 3.53157687, 3.60890841,
+    3.67796135, 3.75849819, 3.84079838, 3.91428828,
+    4, 4.08758879, 4.16580057, 4.25701952,
+    4.35023642, 4.43347359, 4.53055429, 4.62976027,
+    4.71834612, 4.82166433, 4.92724514, 5.021523,
+    5.13148022, 5.24384499, 5.34418058, 5.4612031,
+    5.58078766, 5.68757057, 5.81211185, 5.93938065,
+    6.05302477, 6.18556881, 6.32101536, 6.44196129,
+    6.58302212, 6.72717142, 6.85588932, 7.00601339,
+    7.15942526, 7.31619644, 7.45618439, 7.61945343,
+    7.7862978, 7.9352808, 8.10904026, 8.28660583,
+    8.44516182, 8.63008595, 8.81906033, 8.98780441,
+    9.18461227, 9.38572884, 9.56531525, 9.77476788,
+    9.98880768, 10.1799335, 10.4028454, 10.6306381,
+    10.8340445, 11.0712795, 11.3137083, 11.5301847,
+    11.7826633, 12.0406704, 12.2710562, 12.5397577,
+    12.8143425, 13.0595322, 13.3454981, 13.6377268,
+    13.8986712, 14.2030125, 14.5140181, 14.791729,
+    15.1156254, 15.4466143, 15.7421703, 16.0868778,
+    16.4391346, 16.7536812, 17.1205387, 17.49543,
+    17.8301888, 18.2206192, 18.6195984, 18.9758644,
+    19.3913822, 19.8159981, 20.195158, 20.6373749,
+    21.0892735, 21.4927959, 21.9634266, 22.4443626,
+    22.9358311, 23.3746853, 23.8865242, 24.4095707,
+    24.8766232, 25.4213505, 25.9780064, 26.475069,
+    27.0547981, 27.6472206, 28.1762218, 28.7932014,
+    29.4236908, 29.9866829, 30.6433048, 31.3143063,
+    31.913475, 32.6122894, 33.3264046, 33.9640732,
+    34.7077866, 35.4677887, 36.146431, 36.9379349,
+    37.746769, 38.469017, 39.3113785, 40.172184,
+    40.9408379, 41.837326, 42.7534447, 43.5714874,
+    44.5255814, 45.5005646, 46.37117, 47.3865662,
+    48.4241982, 49.3507462, 50.4313889, 51.5356903,
+    52.5217743, 53.6718521, 54.8471146, 55.8965569,
+    57.120533, 58.3713112, 59.4881859, 60.7908058,
+    62.1219521, 63.3105927, 64.6969147, 66.1135941,
+    67.5612946, 68.8540115, 70.3617172, 71.9024353,
+    73.2782211, 74.8828049, 76.522522, 77.986702,
+    79.6943893, 81.4394684, 82.9977341, 84.8151474,
+    86.6723557, 88.3307419, 90.2649384, 92.241478,
+    94.0064316, 96.0649033, 98.1684494, 100,
+  },
+  { /* Denoising transition */
+    1, 1.05490196, 1.10980392, 1.16470587,
+    1.21960783, 1.27450979, 1.32941175, 1.3843137,
+    1.43921566, 1.49411762, 1.54901958, 1.60392165,
+    1.65882349, 1.71372557, 1.76862741, 1.82352948,
+    1.87843132, 1.9333334, 1.98823524, 2.04313731,
+    2.09803915, 2.15294123, 2.2078433, 2.26274514,
+    2.31764698, 2.37254906, 2.42745113, 2.48235297,
+    2.53725481, 2.59215689, 2.64705896, 2.7019608,
+    2.75686264, 2.81176472, 2.86666679, 2.92156863,
+    2.97647047, 3.03137255, 3.08627462, 3.14117646,
+    3.19607854, 3.25098038, 3.30588245, 3.36078429,
+    3.41568637, 3.47058821, 3.52549028, 3.58039212,
+    3.6352942, 3.69019604, 3.74509811, 3.79999995,
+    3.85490203, 3.90980387, 3.96470594, 4.01960754,
+    4.07450962, 4.1294117, 4.18431377, 4.23921585,
+    4.29411793, 4.34901953, 4.4039216, 4.4588232,
+    4.51372528, 4.56862736, 4.62352943, 4.67843151,
+    4.73333359, 4.78823566, 4.84313726, 4.89803934,
+    4.95294094, 5.00784302, 5.06274509, 5.11764717,
+    5.17254925, 5.22745085, 5.28235292, 5.337255,
+    5.39215708, 5.44705868, 5.50196075, 5.55686283,
+    5.61176491, 5.66666651, 5.72156858, 5.77647066,
+    5.83137274, 5.88627434, 5.94117641, 5.99607849,
+    6.05098057, 6.10588217, 6.16078424, 6.21568632,
+    6.2705884, 6.32549047, 6.38039207, 6.43529415,
+    6.49019623, 6.5450983, 6.5999999, 6.65490198,
+    6.70980406, 6.76470613, 6.81960773, 6.87450981,
+    6.92941189, 6.98431396, 7.03921556, 7.09411764,
+    7.14901972, 7.20392179, 7.25882339, 7.31372547,
+    7.36862755, 7.42352962, 7.47843122, 7.5333333,
+    7.58823538, 7.64313745, 7.69803905, 7.75294113,
+    7.80784321, 7.86274529, 7.91764688, 7.97254896,
+    8.02745056, 8.08235359, 8.13725471, 8.19215679,
+    8.24705887, 8.30196095, 8.35686302, 8.41176414,
+    8.46666718, 8.5215683, 8.57647133, 8.63137245,
+    8.68627453, 8.74117661, 8.79607868, 8.85098076,
+    8.90588188, 8.96078491, 9.01568604, 9.07058811,
+    9.12549019, 9.18039227, 9.23529434, 9.29019642,
+    9.3450985, 9.39999962, 9.4549017, 9.50980377,
+    9.56470585, 9.61960793, 9.67451, 9.72941208,
+    9.78431416, 9.83921623, 9.89411736, 9.94901943,
+    10.0039215, 10.0588236, 10.1137257, 10.1686277,
+    10.2235298, 10.2784319, 10.333333, 10.3882351,
+    10.4431372, 10.4980392, 10.5529413, 10.6078434,
+    10.6627455, 10.7176476, 10.7725487, 10.8274508,
+    10.8823528, 10.9372549, 10.992157, 11.0470591,
+    11.1019611, 11.1568632, 11.2117643, 11.2666664,
+    11.3215685, 11.3764706, 11.4313726, 11.4862747,
+    11.5411768, 11.5960789, 11.6509809, 11.7058821,
+    11.7607841, 11.8156862, 11.8705883, 11.9254904,
+    11.9803925, 12.0352945, 12.0901966, 12.1450977,
+    12.1999998, 12.2549019, 12.309804, 12.364706,
+    12.4196081, 12.4745102, 12.5294123, 12.5843134,
+    12.6392155, 12.6941175, 12.7490196, 12.8039217,
+    12.8588238, 12.9137259, 12.9686279, 13.0235291,
+    13.0784311, 13.1333332, 13.1882353, 13.2431374,
+    13.2980394, 13.3529415, 13.4078436, 13.4627457,
+    13.5176468, 13.5725489, 13.6274509, 13.682353,
+    13.7372551, 13.7921572, 13.8470592, 13.9019613,
+    13.9568624, 14.0117645, 14.0666666, 14.1215687,
+    14.1764708, 14.2313728, 14.2862749, 14.341177,
+    14.3960781, 14.4509802, 14.5058823, 14.5607843,
+    14.6156864, 14.6705885, 14.7254906, 14.7803926,
+    14.8352938, 14.8901958, 14.9450979, 15,
+  },
+  { /* AGC strength */
+    0.100000001, 0.103137255, 0.106274508, 0.109411761,
+    0.112549022, 0.115686275, 0.118823528, 0.121960782,
+    0.125098035, 0.128235295, 0.131372541, 0.134509802,
+    0.137647063, 0.140784308, 0.143921569, 0.147058815,
+    0.150196075, 0.153333336, 0.156470582, 0.159607843,
+    0.162745088, 0.165882349, 0.16901961, 0.172156855,
+    0.175294101, 0.178431362, 0.181568623, 0.184705883,
+    0.187843129, 0.190980375, 0.194117635, 0.197254896,
+    0.200392157, 0.203529403, 0.206666648, 0.209803909,
+    0.21294117, 0.21607843, 0.219215676, 0.222352922,
+    0.225490183, 0.228627443, 0.231764704, 0.234901965,
+    0.238039196, 0.241176456, 0.244313717, 0.247450978,
+    0.250588208, 0.253725469, 0.25686273, 0.25999999,
+    0.263137251, 0.266274482, 0.269411743, 0.272549003,
+    0.275686264, 0.278823525, 0.281960756, 0.285098016,
+    0.288235277, 0.291372538, 0.294509798, 0.297647029,
+    0.30078429, 0.303921551, 0.307058811, 0.310196072,
+    0.313333303, 0.316470563, 0.319607824, 0.322745085,
+    0.325882345, 0.329019576, 0.332156837, 0.335294098,
+    0.338431358, 0.341568619, 0.34470585, 0.347843111,
+    0.350980371, 0.354117632, 0.357254863, 0.360392123,
+    0.363529384, 0.366666645, 0.369803905, 0.372941136,
+    0.376078397, 0.379215658, 0.382352918, 0.385490179,
+    0.38862741, 0.391764671, 0.394901931, 0.398039192,
+    0.401176423, 0.404313684, 0.407450944, 0.410588205,
+    0.413725466, 0.416862696, 0.419999957, 0.423137218,
+    0.426274478, 0.429411739, 0.43254897, 0.435686231,
+    0.438823491, 0.441960752, 0.445098013, 0.448235244,
+    0.451372504, 0.454509765, 0.457647026, 0.460784286,
+    0.463921517, 0.467058778, 0.470196038, 0.473333299,
+    0.47647056, 0.479607791, 0.482745051, 0.485882312,
+    0.489019573, 0.492156833, 0.495294064, 0.498431325,
+    0.501568615, 0.504705846, 0.507843137, 0.510980368,
+    0.514117599, 0.517254889, 0.52039212, 0.52352941,
+    0.526666641, 0.529803872, 0.532941163, 0.536078393,
+    0.539215684, 0.542352915, 0.545490146, 0.548627436,
+    0.551764667, 0.554901958, 0.558039188, 0.561176419,
+    0.56431371, 0.567450941, 0.570588231, 0.573725462,
+    0.576862693, 0.579999983, 0.583137214, 0.586274505,
+    0.589411736, 0.592548966, 0.595686257, 0.598823488,
+    0.601960778, 0.605098009, 0.6082353, 0.61137253,
+    0.614509761, 0.617647052, 0.620784283, 0.623921573,
+    0.627058804, 0.630196035, 0.633333325, 0.636470556,
+    0.639607847, 0.642745078, 0.645882308, 0.649019599,
+    0.65215683, 0.65529412, 0.658431351, 0.661568582,
+    0.664705873, 0.667843103, 0.670980394, 0.674117625,
+    0.677254856, 0.680392146, 0.683529377, 0.686666667,
+    0.689803898, 0.692941129, 0.69607842, 0.699215651,
+    0.702352881, 0.705490172, 0.708627403, 0.711764693,
+    0.714901924, 0.718039155, 0.721176445, 0.724313676,
+    0.727450967, 0.730588198, 0.733725429, 0.736862719,
+    0.73999995, 0.74313724, 0.746274471, 0.749411702,
+    0.752548993, 0.755686224, 0.758823514, 0.761960745,
+    0.765097976, 0.768235266, 0.771372497, 0.774509788,
+    0.777647018, 0.780784249, 0.78392154, 0.787058771,
+    0.790196061, 0.793333292, 0.796470523, 0.799607813,
+    0.802745044, 0.805882335, 0.809019566, 0.812156796,
+    0.815294087, 0.818431318, 0.821568608, 0.824705839,
+    0.82784307, 0.830980361, 0.834117591, 0.837254882,
+    0.840392113, 0.843529344, 0.846666634, 0.849803865,
+    0.852941155, 0.856078386, 0.859215617, 0.862352908,
+    0.865490139, 0.868627429, 0.87176466, 0.874901891,
+    0.878039181, 0.881176412, 0.884313703, 0.887450933,
+    0.890588164, 0.893725455, 0.896862686, 0.899999976,
+  },
+  { /* Compressor */
+    0.100000001, 0.101568632, 0.103137255, 0.104705885,
+    0.106274508, 0.107843138, 0.109411769, 0.110980392,
+    0.112549022, 0.114117652, 0.115686275, 0.117254905,
+    0.118823528, 0.120392159, 0.121960789, 0.123529412,
+    0.125098035, 0.126666665, 0.128235295, 0.129803926,
+    0.131372541, 0.132941186, 0.134509802, 0.136078432,
+    0.137647063, 0.139215678, 0.140784323, 0.142352939,
+    0.143921569, 0.145490199, 0.14705883, 0.14862746,
+    0.150196075, 0.151764706, 0.153333336, 0.154901966,
+    0.156470597, 0.158039212, 0.159607843, 0.161176473,
+    0.162745088, 0.164313734, 0.165882349, 0.167450979,
+    0.16901961, 0.170588225, 0.17215687, 0.173725486,
+    0.175294116, 0.176862746, 0.178431362, 0.180000007,
+    0.181568623, 0.183137253, 0.184705883, 0.186274514,
+    0.187843144, 0.189411759, 0.19098039, 0.19254902,
+    0.19411765, 0.195686281, 0.197254896, 0.198823527,
+    0.200392157, 0.201960787, 0.203529418, 0.205098033,
+    0.206666663, 0.208235294, 0.209803924, 0.211372554,
+    0.21294117, 0.2145098, 0.21607843, 0.217647061,
+    0.219215691, 0.220784307, 0.222352952, 0.223921567,
+    0.225490183, 0.227058828, 0.228627443, 0.230196089,
+    0.231764704, 0.233333319, 0.234901965, 0.23647058,
+    0.238039225, 0.239607841, 0.241176456, 0.242745101,
+    0.244313717, 0.245882362, 0.247450978, 0.249019593,
+    0.250588238, 0.252156854, 0.253725499, 0.255294114,
+    0.25686273, 0.258431375, 0.25999999, 0.261568636,
+    0.263137251, 0.264705867, 0.266274512, 0.267843127,
+    0.269411772, 0.270980388, 0.272549033, 0.274117649,
+    0.275686264, 0.277254909, 0.278823525, 0.28039217,
+    0.281960785, 0.283529401, 0.285098046, 0.286666662,
+    0.288235307, 0.289803922, 0.291372538, 0.292941183,
+    0.294509798, 0.296078444, 0.297647059, 0.299215674,
+    0.30078432, 0.302352935, 0.30392158, 0.305490196,
+    0.307058811, 0.308627456, 0.310196072, 0.311764717,
+    0.313333333, 0.314901948, 0.316470593, 0.318039209,
+    0.319607854, 0.321176469, 0.322745085, 0.32431373,
+    0.325882345, 0.327450991, 0.329019606, 0.330588222,
+    0.332156867, 0.333725482, 0.335294127, 0.336862743,
+    0.338431358, 0.340000004, 0.341568619, 0.343137264,
+    0.34470588, 0.346274495, 0.34784314, 0.349411756,
+    0.350980371, 0.352549016, 0.354117632, 0.355686277,
+    0.357254893, 0.358823508, 0.360392153, 0.361960769,
+    0.363529414, 0.365098029, 0.366666645, 0.36823529,
+    0.369803905, 0.371372551, 0.372941166, 0.374509782,
+    0.376078427, 0.377647042, 0.379215688, 0.380784303,
+    0.382352918, 0.383921564, 0.385490179, 0.387058824,
+    0.38862744, 0.390196055, 0.3917647, 0.393333316,
+    0.394901961, 0.396470577, 0.398039192, 0.399607837,
+    0.401176453, 0.402745098, 0.404313713, 0.405882329,
+    0.407450974, 0.409019589, 0.410588235, 0.41215685,
+    0.413725466, 0.415294111, 0.416862726, 0.418431371,
+    0.419999987, 0.421568602, 0.423137248, 0.424705863,
+    0.426274508, 0.427843124, 0.429411739, 0.430980384,
+    0.432549, 0.434117645, 0.43568626, 0.437254906,
+    0.438823521, 0.440392137, 0.441960782, 0.443529397,
+    0.445098042, 0.446666658, 0.448235273, 0.449803919,
+    0.451372534, 0.452941179, 0.454509795, 0.45607841,
+    0.457647055, 0.459215671, 0.460784316, 0.462352931,
+    0.463921547, 0.465490192, 0.467058808, 0.468627453,
+    0.470196068, 0.471764684, 0.473333329, 0.474901944,
+    0.47647059, 0.478039205, 0.479607821, 0.481176466,
+    0.482745081, 0.484313726, 0.485882342, 0.487450957,
+    0.489019603, 0.490588218, 0.492156863, 0.493725479,
+    0.495294094, 0.496862739, 0.498431355, 0.5,
+  },
+};
+
+const float kTuningInputGainTable[256] = {
+    0.0315902904, 0.0324573144, 0.0333481394, 0.0343563072,
+    0.035299249, 0.0362680703, 0.0372634791, 0.0382862128,
+    0.0393370129, 0.0404166542, 0.0415259302, 0.0426656492,
+    0.0438366458, 0.0450397842, 0.0462759435, 0.0475460328,
+    0.0488509797, 0.0501917414, 0.0515693016, 0.0529846698,
+    0.0544388816, 0.0559330098, 0.0574681461, 0.0590454116,
+    0.0606659688, 0.0623310059, 0.0642153695, 0.0659778267,
+    0.0677886456, 0.0696491748, 0.0715607628, 0.0735248104,
+    0.0755427703, 0.0776161104, 0.0797463655, 0.0819350779,
+    0.0841838643, 0.0864943713, 0.0888682902, 0.0913073644,
+    0.0938133821, 0.0963881761, 0.0990336463, 0.101751715,
+    0.104544386, 0.107413709, 0.110361777, 0.113390766,
+    0.116818748, 0.120024949, 0.123319149, 0.126703754,
+    0.130181268, 0.133754209, 0.137425229, 0.141196996,
+    0.145072281, 0.149053916, 0.153144851, 0.157348052,
+    0.161666617, 0.166103721, 0.170662597, 0.175346583,
+    0.180159137, 0.185103774, 0.190184131, 0.195403919,
+    0.200766966, 0.206277207, 0.211938679, 0.218345925,
+    0.224338636, 0.230495825, 0.236821994, 0.243321806,
+    0.25, 0.256861478, 0.263911307, 0.271154583,
+    0.278596699, 0.286243051, 0.294099241, 0.302171081,
+    0.310464442, 0.318985462, 0.327740312, 0.336735457,
+    0.345977485, 0.355473161, 0.365229458, 0.375253528,
+    0.385552704, 0.396134585, 0.40811038, 0.419311345,
+    0.43081975, 0.442644, 0.454792798, 0.467274994,
+    0.480099797, 0.493276596, 0.506815016, 0.520725071,
+    0.535016835, 0.549700916, 0.564787984, 0.580289125,
+    0.596215665, 0.612579405, 0.629392207, 0.646666467,
+    0.664414883, 0.682650387, 0.701386333, 0.720636547,
+    0.742422581, 0.762799084, 0.783734858, 0.805245161,
+    0.827345908, 0.850053191, 0.873383701, 0.897354543,
+    0.921983302, 0.947287977, 0.973287225, 1,
+    1.02744591, 1.05564523, 1.08461833, 1.1143868,
+    1.14497221, 1.17639697, 1.20868433, 1.24185777,
+    1.27594185, 1.31096125, 1.34694183, 1.38766205,
+    1.42574775, 1.4648788, 1.5050838, 1.5463922,
+    1.5888344, 1.63244152, 1.67724538, 1.723279,
+    1.770576, 1.81917119, 1.86909997, 1.92039919,
+    1.97310638, 2.02726007, 2.08290029, 2.14006734,
+    2.19880366, 2.25915194, 2.3211565, 2.38486266,
+    2.45031762, 2.52439475, 2.59367919, 2.66486502,
+    2.73800492, 2.81315207, 2.89036155, 2.96969032,
+    3.05119634, 3.13493943, 3.22098064, 3.30938363,
+    3.40021276, 3.4935348, 3.58941817, 3.68793321,
+    3.78915191, 3.8931489, 4, 4.10978365,
+    4.22258091, 4.33847332, 4.45754719, 4.57988882,
+    4.71834612, 4.84784555, 4.98089933, 5.11760473,
+    5.25806236, 5.40237474, 5.55064821, 5.70299101,
+    5.85951519, 6.0203352, 6.18556881, 6.35533762,
+    6.52976608, 6.70898151, 6.893116, 7.082304,
+    7.27668476, 7.4763999, 7.68159676, 7.89242554,
+    8.10904026, 8.33160114, 8.56026936, 8.81906033,
+    9.06110859, 9.30979919, 9.56531525, 9.82784462,
+    10.097579, 10.3747168, 10.6594601, 10.9520197,
+    11.2526083, 11.5614462, 11.8787613, 12.2047853,
+    12.5397577, 12.8839226, 13.2375345, 13.6008511,
+    13.9741392, 14.3576727, 14.7517328, 15.1566076,
+    15.5725956, 16.0433807, 16.4837055, 16.9361172,
+    17.4009457, 17.8785305, 18.3692245, 18.8733845,
+    19.3913822, 19.9235973, 20.4704189, 21.0322495,
+    21.609499, 22.2025928, 22.811964, 23.4380608,
+    24.0813408, 24.7422752, 25.4213505, 26.1190643,
+    26.8359261, 27.572464, 28.329216, 29.106739,
+    29.9866829, 30.8096962, 31.6552963, 32.5241051,
+};
@@ -0,0 +1,197 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "tactile/usb_stream.h"
+
+#include <string.h>
+
+#include "dsp/serialize.h"
+
+/* Max frames per Data block, limited by the one-byte frame count. */
+#define kMaxFramesPerBlock 255
+
+/* Computes the Fletcher-16 checksum over header bytes [1, 5] and the payload,
+ * the bytes following the checksum field.
+ */
+static uint16_t Checksum(const uint8_t* message, int payload_size) {
+  uint32_t sum1 = 0;
+  uint32_t sum2 = 0;
+  int i;
+  for (i = 1; i < 6; ++i) {
+    sum1 = (sum1 + message[i]) % 255;
+    sum2 = (sum2 + sum1) % 255;
+  }
+  const uint8_t* payload = message + kUsbStreamHeaderBytes;
+  for (i = 0; i < payload_size; ++i) {
+    sum1 = (sum1 + payload[i]) % 255;
+    sum2 = (sum2 + sum1) % 255;
+  }
+  return (uint16_t)((sum2 << 8) | sum1);
+}
+
+/* Writes the header fields, then the checksum over the header and payload. */
+static int FinishMessage(UsbStreamType type, uint16_t sequence,
+                         int num_channels, int num_frames, int payload_size,
+                         uint8_t* message) {
+  message[0] = kUsbStreamMarker;
+  message[1] = (uint8_t)type;
+  LittleEndianWriteU16(sequence, message + 2);
+  message[4] = (uint8_t)num_channels;
+  message[5] = (uint8_t)num_frames;
+  LittleEndianWriteU16(Checksum(message, payload_size), message + 6);
+  return kUsbStreamHeaderBytes + payload_size;
+}
+
+/* Returns the payload size implied by a header, or -1 if it is invalid. */
+static int PayloadSize(const uint8_t* header) {
+  const int num_channels = header[4];
+  const int num_frames = header[5];
+  switch (header[1]) {
+    case kUsbStreamData:
+      if (num_channels < 1 || num_frames < 1 ||
+          num_channels * num_frames > kUsbStreamMaxPayloadBytes) {
+        return -1;
+      }
+      return num_channels * num_frames;
+    case kUsbStreamCredit:
+      return (num_channels == 0 && num_frames == 0)
+          ? kUsbStreamCreditPayloadBytes : -1;
+    case kUsbStreamReset:
+      return (num_channels == 0 && num_frames == 0) ? 0 : -1;
+    default:
+      return -1;
+  }
+}
+
+int UsbStreamFramesPerBlock(int num_channels, int frame_multiple) {
+  if (num_channels < 1 || frame_multiple < 1) { return 0; }
+  int num_frames = kUsbStreamMaxPayloadBytes / num_channels;
+  if (num_frames > kMaxFramesPerBlock) { num_frames = kMaxFramesPerBlock; }
+  return num_frames - num_frames % frame_multiple;
+}
+
+int UsbStreamEncodeData(uint16_t sequence, int num_channels, int num_frames,
+                        const uint8_t* samples, uint8_t* message) {
+  if (num_channels < 1 || num_frames < 1 || num_frames > kMaxFramesPerBlock ||
+      num_channels * num_frames > kUsbStreamMaxPayloadBytes) {
+    return 0;
+  }
+  const int payload_size = num_channels * num_frames;
+  memcpy(message + kUsbStreamHeaderBytes, samples, payload_size);
+  return FinishMessage(kUsbStreamData, sequence, num_channels, num_frames,
+                       payload_size, message);
+}
+
+int UsbStreamEncodeCredit(const UsbStreamCredit* credit, uint8_t* message) {
+  uint8_t* payload = message + kUsbStreamHeaderBytes;
+  LittleEndianWriteU32(credit->num_consumed, payload);
+  LittleEndianWriteU16(credit->capacity, payload + 4);
+  LittleEndianWriteU16(credit->num_underruns, payload + 6);
+  LittleEndianWriteU16(credit->num_errors, payload + 8);
+  return FinishMessage(kUsbStreamCredit, 0, 0, 0,
+                       kUsbStreamCreditPayloadBytes, message);
+}
+
+int UsbStreamEncodeReset(uint8_t* message) {
+  return FinishMessage(kUsbStreamReset, 0, 0, 0, 0, message);
+}
+
+int UsbStreamDecodeCredit(const UsbStreamMessage* message,
+                          UsbStreamCredit* credit) {
+  if (message->type != kUsbStreamCredit ||
+      message->payload_size != kUsbStreamCreditPayloadBytes) {
+    return 0;
+  }
+  const uint8_t* payload = message->payload;
+  credit->num_consumed = LittleEndianReadU32(payload);
+  credit->capacity = LittleEndianReadU16(payload + 4);
+  credit->num_underruns = LittleEndianReadU16(payload + 6);
+  credit->num_errors = LittleEndianReadU16(payload + 8);
+  return 1;
+}
+
+int UsbStreamSendableBlocks(const UsbStreamCredit* credit, uint32_t num_sent) {
+  /* Unsigned arithmetic so that the counters may wrap. */
+  const int32_t in_flight = (int32_t)(num_sent - credit->num_consumed);
+  const int32_t sendable = (int32_t)credit->capacity - in_flight;
+  return sendable > 0 ? (int)sendable : 0;
+}
+
+void UsbStreamParserInit(UsbStreamParser* parser) {
+  parser->size = 0;
+  parser->num_errors = 0;
+}
+
+int UsbStreamParserFeed(UsbStreamParser* parser, const uint8_t* data, int size,
+                        UsbStreamMessage* message) {
+  uint8_t* buffer = parser->buffer;
+  message->type = kUsbStreamNone;
+  int consumed = 0;
+
+  while (consumed < size) {
+    if (parser->size == 0) {
+      /* Skip to the next marker byte. */
+      const uint8_t* marker = (const uint8_t*)memchr(
+          data + consumed, kUsbStreamMarker, size - consumed);
+      if (marker == NULL) { return size; }
+      consumed = (int)(marker - data);
+    }
+
+    int payload_size = -1;
+    if (parser->size < kUsbStreamHeaderBytes) {
+      /* Copy the rest of the header. */
+      int n = kUsbStreamHeaderBytes - parser->size;
+      if (n > size - consumed) { n = size - consumed; }
+      memcpy(buffer + parser->size, data + consumed, n);
+      parser->size += n;
+      consumed += n;
+      if (parser->size < kUsbStreamHeaderBytes) { break; }
+
+      payload_size = PayloadSize(buffer);
+      if (payload_size < 0) {  /* Invalid header. */
+        ++parser->num_errors;
+        parser->size = 0;
+        continue;
+      }
+    } else {
+      payload_size = PayloadSize(buffer);
+    }
+
+    /* Copy as much of the payload as available. */
+    const int message_size = kUsbStreamHeaderBytes + payload_size;
+    int n = message_size - parser->size;
+    if (n > size - consumed) { n = size - consumed; }
+    memcpy(buffer + parser->size, data + consumed, n);
+    parser->size += n;
+    consumed += n;
+    if (parser->size < message_size) { break; }
+
+    parser->size = 0;
+    if (LittleEndianReadU16(buffer + 6) != Checksum(buffer, payload_size)) {
+      ++parser->num_errors;
+      continue;
+    }
+
+    message->type = (UsbStreamType)buffer[1];
+    message->sequence = LittleEndianReadU16(buffer + 2);
+    message->num_channels = buffer[4];
+    message->num_frames = buffer[5];
+    message->payload = buffer + kUsbStreamHeaderBytes;
+    message->payload_size = payload_size;
+    break;
+  }
+
+  return consumed;
+}
@@ -0,0 +1,189 @@
+/* Copyright 2022 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * Binary block protocol for streaming tactile samples over USB serial.
+ *
+ * The streaming apps in extras/streaming play tactile samples sent from a PC.
+ * Previously, each 8-frame packet was requested with a "buffer_copied" text
+ * line, so the link idled for a round trip per packet. This protocol instead
+ * sends blocks of many frames with credit-based flow control, so the host
+ * keeps several blocks in flight and the link stays busy.
+ *
+ * Every message starts with an 8-byte header:
+ *
+ *   [0]     kUsbStreamMarker (0xfe).
+ *   [1]     Message type, a UsbStreamType.
+ *   [2, 3]  Sequence number, uint16 little endian.
+ *   [4]     Number of channels (Data messages, otherwise 0).
+ *   [5]     Number of frames (Data messages, otherwise 0).
+ *   [6, 7]  Fletcher-16 checksum of bytes [1, 5] and the payload, uint16 little
+ *           endian.
+ *
+ * followed by the payload:
+ *
+ *   Data    (host -> device) num_frames * num_channels uint8 samples,
+ *           interleaved in frame-major order, 128 meaning zero.
+ *   Credit  (device -> host) kUsbStreamCreditPayloadBytes bytes, see
+ *           UsbStreamCredit.
+ *   Reset   (host -> device) no payload. Clears the device's queue and
+ *           counters. The host sends it before the first Data message.
+ *
+ * Messages are at most kUsbStreamMaxMessageBytes = 512 bytes, which is 8
+ * full-speed USB bulk packets or one high-speed packet, so the device can
+ * receive each block into a fixed-size, aligned slot.
+ *
+ * Flow control: the device has a queue of `capacity` block slots. It sends a
+ * Credit message after each block finishes playing (and periodically as a
+ * heartbeat), reporting the total number of blocks consumed since the last
+ * Reset. The host may send Data blocks as long as
+ *
+ *   num_sent < num_consumed + capacity,
+ *
+ * see UsbStreamSendableBlocks(). Since credits are cumulative rather than
+ * incremental, a lost or corrupted Credit message is harmless: the next one
+ * carries the up-to-date count.
+ *
+ * Bytes may arrive in chunks of any size. UsbStreamParser reassembles
+ * messages, skipping bytes before a marker, e.g. text printed by the firmware,
+ * and dropping messages with a bad size or checksum.
+ *
+ * Example use:
+ *   // Host.
+ *   uint8_t message[kUsbStreamMaxMessageBytes];
+ *   int size = UsbStreamEncodeData(sequence++, num_channels, num_frames,
+ *                                  samples, message);
+ *   Write(message, size);
+ *
+ *   // Device.
+ *   UsbStreamParser parser;
+ *   UsbStreamParserInit(&parser);
+ *   while (size > 0) {
+ *     UsbStreamMessage message;
+ *     const int consumed = UsbStreamParserFeed(&parser, data, size, &message);
+ *     data += consumed;
+ *     size -= consumed;
+ *     if (message.type == kUsbStreamData) { ... }
+ *   }
+ */
+
+#ifndef AUDIO_TO_TACTILE_SRC_TACTILE_USB_STREAM_H_
+#define AUDIO_TO_TACTILE_SRC_TACTILE_USB_STREAM_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define kUsbStreamMarker 0xfe
+#define kUsbStreamHeaderBytes 8
+/* Max message size, including the header. */
+#define kUsbStreamMaxMessageBytes 512
+#define kUsbStreamMaxPayloadBytes \
+  (kUsbStreamMaxMessageBytes - kUsbStreamHeaderBytes)
+#define kUsbStreamCreditPayloadBytes 10
+
+typedef enum {
+  kUsbStreamNone = 0,  /* No complete message (parser output only). */
+  kUsbStreamData = 1,
+  kUsbStreamCredit = 2,
+  kUsbStreamReset = 3,
+} UsbStreamType;
+
+/* Device state reported in Credit messages. */
+typedef struct {
+  /* Number of blocks consumed since the last Reset, wrapping mod 2^32. */
+  uint32_t num_consumed;
+  /* Number of block slots in the device's queue. */
+  uint16_t capacity;
+  /* Number of times the queue ran empty while playing, saturating. */
+  uint16_t num_underruns;
+  /* Number of Data messages with an unexpected sequence number, channel count
+   * or frame count, or received while the queue was full. Saturating.
+   */
+  uint16_t num_errors;
+} UsbStreamCredit;
+
+/* A parsed message. */
+typedef struct {
+  UsbStreamType type;
+  uint16_t sequence;
+  int num_channels;
+  int num_frames;
+  /* Payload, pointing into the parser's buffer. It is valid until the next
+   * call to UsbStreamParserFeed().
+   */
+  const uint8_t* payload;
+  int payload_size;
+} UsbStreamMessage;
+
+typedef struct {
+  uint8_t buffer[kUsbStreamMaxMessageBytes];
+  /* Number of bytes in `buffer`. */
+  int size;
+  /* Number of dropped messages with bad size or checksum. */
+  int num_errors;
+} UsbStreamParser;
+
+/* Returns the largest number of frames per Data block for `num_channels`
+ * channels that is a multiple of `frame_multiple`, e.g. the number of frames
+ * per PWM sequence on the device. Returns 0 if no such block fits.
+ */
+int UsbStreamFramesPerBlock(int num_channels, int frame_multiple);
+
+/* Writes a Data message with `num_frames` frames of `num_channels` interleaved
+ * uint8 samples to `message`, which must have space for
+ * kUsbStreamHeaderBytes + num_channels * num_frames bytes. Returns the message
+ * size, or 0 if num_channels or num_frames is invalid.
+ */
+int UsbStreamEncodeData(uint16_t sequence, int num_channels, int num_frames,
+                        const uint8_t* samples, uint8_t* message);
+
+/* Writes a Credit message to `message`, which must have space for
+ * kUsbStreamHeaderBytes + kUsbStreamCreditPayloadBytes bytes. Returns the
+ * message size.
+ */
+int UsbStreamEncodeCredit(const UsbStreamCredit* credit, uint8_t* message);
+
+/* Writes a Reset message of kUsbStreamHeaderBytes bytes. Returns the size. */
+int UsbStreamEncodeReset(uint8_t* message);
+
+/* Decodes the payload of a Credit message. Returns 1 on success, 0 if
+ * `message` is not a valid Credit message.
+ */
+int /*bool*/ UsbStreamDecodeCredit(const UsbStreamMessage* message,
+                                   UsbStreamCredit* credit);
+
+/* Returns the number of blocks the host may send after having sent `num_sent`
+ * blocks since the Reset, according to `credit`.
+ */
+int UsbStreamSendableBlocks(const UsbStreamCredit* credit, uint32_t num_sent);
+
+/* Initializes a parser. */
+void UsbStreamParserInit(UsbStreamParser* parser);
+
+/* Feeds up to `size` received bytes to the parser. Parsing stops after the
+ * first complete message, which is written to `*message`; otherwise
+ * message->type is set to kUsbStreamNone. Returns the number of bytes
+ * consumed. Call again with the remaining bytes until all are consumed.
+ */
+int UsbStreamParserFeed(UsbStreamParser* parser, const uint8_t* data, int size,
+                        UsbStreamMessage* message);
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif
+
+#endif  /* AUDIO_TO_TACTILE_SRC_TACTILE_USB_STREAM_H_ */
@@ -17,16 +17,35 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "dsp/aligned_alloc.h"
 #include "tactile/tuning.h"
 
 namespace audio_tactile {
 
 TactileProcessorWrapper::TactileProcessorWrapper()
-    : tactile_processor_(nullptr), tactile_output_(nullptr) {}
+    : tactile_processor_(nullptr), tactile_output_(nullptr),
+      owns_output_(false) {}
 
-TactileProcessorWrapper::~TactileProcessorWrapper() {
+TactileProcessorWrapper::~TactileProcessorWrapper() { Deinit(); }
+
+void TactileProcessorWrapper::Deinit() {
   TactileProcessorFree(tactile_processor_);
-  free(tactile_output_);
+  if (owns_output_) { AlignedFree(tactile_output_); }
+  tactile_processor_ = nullptr;
+  tactile_output_ = nullptr;
+  owns_output_ = false;
+}
+
+void TactileProcessorWrapper::SetParams(float sample_rate, int block_size,
+                                        int decimation_factor,
+                                        TactileProcessorParams* params) {
+  sample_rate_ = sample_rate;
+  block_size_ = block_size;
+  decimation_factor_ = decimation_factor;
+  TactileProcessorSetDefaultParams(params);
+  params->frontend_params.input_sample_rate_hz = sample_rate;
+  params->frontend_params.block_size = block_size;
+  params->decimation_factor = decimation_factor;
 }
 
 bool TactileProcessorWrapper::Init(float sample_rate, int block_size,
@@ -34,15 +53,10 @@ bool TactileProcessorWrapper::Init(float sample_rate, int block_size,
   const float kDefaultGain = 4.0f;
   const float kDefaultCutOff = 975.0f;
 
-  sample_rate_ = sample_rate;
-  block_size_ = block_size;
-  decimation_factor_ = decimation_factor;
-  const int frames_per_carl_block = block_size_ / decimation_factor_;
+  Deinit();
   TactileProcessorParams params;
-  TactileProcessorSetDefaultParams(&params);
-  params.frontend_params.input_sample_rate_hz = sample_rate;
-  params.frontend_params.block_size = block_size;
-  params.decimation_factor = decimation_factor;
+  SetParams(sample_rate, block_size, decimation_factor, &params);
+  const int frames_per_carl_block = block_size_ / decimation_factor_;
   tactile_processor_ = TactileProcessorMake(&params);
   if (tactile_processor_ == NULL) {
     // Error initializing due to issues such as memory allocation or if filter
@@ -52,12 +66,35 @@ bool TactileProcessorWrapper::Init(float sample_rate, int block_size,
 
   // Allocate tactile buffer with space for one CARL block's worth of output.
   // Currently it is 320 bytes = 8 * 10 * 4
-  tactile_output_ = (float*)malloc(frames_per_carl_block *
-                                   kTactileProcessorNumTactors * sizeof(float));
+  tactile_output_ = (float*)AlignedAlloc(
+      frames_per_carl_block * kTactileProcessorNumTactors * sizeof(float));
+  owns_output_ = true;
 
   return false;
 }
 
+bool TactileProcessorWrapper::InitInArena(Arena* arena, float sample_rate,
+                                          int block_size,
+                                          int decimation_factor) {
+  Deinit();
+  TactileProcessorParams params;
+  SetParams(sample_rate, block_size, decimation_factor, &params);
+  const size_t required_bytes = TactileProcessorRequiredBytes(&params);
+  void* buffer = ArenaAlloc(arena, required_bytes);
+  float* output = (float*)ArenaAlloc(
+      arena, (block_size_ / decimation_factor_) * kTactileProcessorNumTactors *
+                 sizeof(float));
+  if (required_bytes == 0 || buffer == nullptr || output == nullptr) {
+    return false;
+  }
+
+  tactile_processor_ =
+      TactileProcessorInitInBuffer(buffer, required_bytes, &params);
+  if (tactile_processor_ == nullptr) { return false; }
+  tactile_output_ = output;
+  return true;
+}
+
 float* TactileProcessorWrapper::ProcessSamples(float* audio_input) {
   TactileProcessorProcessSamples(tactile_processor_, audio_input,
                                  tactile_output_);
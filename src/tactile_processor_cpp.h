@@ -19,6 +19,7 @@
 #ifndef AUDIO_TO_TACTILE_SRC_TACTILE_PROCESSOR_CPP_H_
 #define AUDIO_TO_TACTILE_SRC_TACTILE_PROCESSOR_CPP_H_
 
+#include "dsp/arena.h"
 #include "tactile/tactile_processor.h"
 #include "tactile/tuning.h"
 
@@ -32,6 +33,22 @@ class TactileProcessorWrapper {
   // Allocate memory and initialize paramenters for tactile processor.
   bool Init(float sample_rate, int block_size, int decimation_factor);
 
+  // Alternative to Init() that lays out the processor and its output buffer in
+  // `arena` rather than on the heap, e.g. in a UnionArena (cpp/union_arena.h)
+  // shared with subsystems for other modes. Returns true on success, or false
+  // if the arena is too small or the params are invalid. The arena memory must
+  // outlive the processor, or Deinit() must be called before it is reused.
+  bool InitInArena(Arena* arena, float sample_rate, int block_size,
+                   int decimation_factor);
+
+  // Returns true if Init() or InitInArena() has succeeded and the processor
+  // has not since been deinitialized.
+  bool initialized() const { return tactile_processor_ != nullptr; }
+
+  // Frees the processor, if any, returning to the uninitialized state. Memory
+  // from InitInArena() is not freed but may be reused once this returns.
+  void Deinit();
+
   // Process the raw microphone data.
   // Returns float array, corresponding to the processing result.
   // The microphone data array is expected to have 'block_size' number of
@@ -43,9 +60,82 @@ class TactileProcessorWrapper {
   // send to the PWM hardware module.
   float* ProcessSamples(float* audio_input);
 
+  // Same as ProcessSamples(), but for two microphones, each with 'block_size'
+  // samples. Bands are mixed by SNR and the vowel network runs once, see
+  // TactileProcessorProcessSamplesDualMic().
+  float* ProcessSamplesDualMic(const float* audio_input0,
+                               const float* audio_input1) {
+    ::TactileProcessorProcessSamplesDualMic(tactile_processor_, audio_input0,
+                                            audio_input1, tactile_output_);
+    return tactile_output_;
+  }
+
+  // Runs only the costly stages on the puck when processing is split, see
+  // tactile/processing_split.h. Writes `GetOutputBlockSize()` frames of
+  // Enveloper output to `envelopes` and 7 vowel hex weights to `hex_weights`.
+  void ComputeFeatures(const float* audio_input, float* envelopes,
+                       float* hex_weights) {
+    ::TactileProcessorComputeFeatures(tactile_processor_, audio_input,
+                                      envelopes, hex_weights);
+  }
+
+  // Maps features from ComputeFeatures(), e.g. received from the puck, to
+  // tactor outputs. Returns the output buffer, as for ProcessSamples().
+  float* ProcessFeatures(const float* envelopes, const float* hex_weights) {
+    ::TactileProcessorWriteOutputs(tactile_processor_, envelopes, hex_weights,
+                                   tactile_output_,
+                                   kTactileProcessorNumTactors);
+    return tactile_output_;
+  }
+
+  // Resets the processor to its initial state, e.g. after it has been idle
+  // while the other device ran the costly stages.
+  void Reset() { ::TactileProcessorReset(tactile_processor_); }
+
   // Applies tuning settings. Can be called anytime.
   void ApplyTuning(const TuningKnobs& tuning_knobs);
 
+  // Sets the tactors in use, e.g. from ChannelMapUsedInputs(), so that
+  // computation for unused tactors is skipped. See
+  // TactileProcessorSetActiveTactors().
+  void SetActiveTactors(uint32_t active_tactors) {
+    ::TactileProcessorSetActiveTactors(tactile_processor_, active_tactors);
+  }
+
+  // Enables adaptive quality, see TactileProcessorUpdateLoad(). Call after
+  // Init().
+  void EnableAdaptiveQuality(bool enable) {
+    tactile_processor_->enable_adaptive_quality = enable;
+  }
+
+  // Updates adaptive quality with the measured load of the last block, its
+  // processing time as a fraction of the block period.
+  void UpdateLoad(float load) {
+    ::TactileProcessorUpdateLoad(tactile_processor_, load);
+  }
+
+  // Gets the current TactileQuality level.
+  int quality() const { return tactile_processor_->quality; }
+
+  // Returns the number of floats in the warm state.
+  int WarmStateSize() const {
+    return ::TactileProcessorWarmStateSize(tactile_processor_);
+  }
+
+  // Gets the warm state, see TactileProcessorGetWarmState().
+  void GetWarmState(float* warm_state) const {
+    ::TactileProcessorGetWarmState(tactile_processor_, warm_state);
+  }
+
+  // Restores the warm state. Call after ApplyTuning(), since that resets the
+  // enveloper. Returns true on success.
+  bool SetWarmState(const float* warm_state) {
+    return ::TactileProcessorSetWarmState(tactile_processor_, warm_state);
+  }
+
+  // Gets the output buffer, as returned by ProcessSamples().
+  float* output() const { return tactile_output_; }
+
   // Gets the TactileProcessor C object.
   TactileProcessor* get() const {
     return tactile_processor_;
@@ -65,8 +155,14 @@ class TactileProcessorWrapper {
   }
 
  private:
+  // Fills `params` and sets sample_rate_, block_size_, decimation_factor_.
+  void SetParams(float sample_rate, int block_size, int decimation_factor,
+                 TactileProcessorParams* params);
+
   TactileProcessor* tactile_processor_;
   float* tactile_output_;
+  // True if tactile_output_ is from the heap rather than an arena.
+  bool owns_output_;
   float sample_rate_;
   int block_size_;
   int decimation_factor_;
@@ -41,6 +41,10 @@ void TemperatureMonitor::StartMonitoringTemperature() {
   // Set reference input source to analog in (AIN) pin 1.
   nrf_lpcomp_input_select(NRF_LPCOMP, NRF_LPCOMP_INPUT_1);
 
+  // Enable hysteresis, so that noise near the threshold doesn't generate a
+  // burst of crossings.
+  NRF_LPCOMP->HYST = LPCOMP_HYST_HYST_Hyst50mV << LPCOMP_HYST_HYST_Pos;
+
   // Enable and start the low power comparator.
   nrf_lpcomp_enable(NRF_LPCOMP);
   nrf_lpcomp_task_trigger(NRF_LPCOMP, NRF_LPCOMP_TASK_START);
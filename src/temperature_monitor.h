@@ -24,7 +24,8 @@
 // https://infocenter.nordicsemi.com/index.jsp?topic=%2Fcom.nordic.infocenter.nrf52832.ps.v1.1%2Flpcomp.html
 // To measure the analog battery voltage, SAADC was used.
 // Note: the low power comparator can run only for one of the battery monitor or
-// temperature monitor at a time
+// temperature monitor at a time. For periodic temperature readings without
+// busy waiting, use BackgroundAdc (background_adc.h) with adc_input().
 //
 // We use a 10K NTC thermistor (NTCG103JF103FT1), as described here:
 // https://product.tdk.com/info/en/catalog/datasheets/503021/tpd_commercial_ntc-thermistor_ntcg_en.pdf
@@ -79,6 +80,9 @@ class TemperatureMonitor {
   // tactors are overheating, so accuracy isn't critical.
   float ConvertAdcSampleToTemperature(int16_t raw_adc_battery_reading);
 
+  // SAADC input connected to the thermistor voltage divider.
+  nrf_saadc_input_t adc_input() const { return NRF_SAADC_INPUT_AIN1; }
+
  private:
   // Callback for the interrupt.
   void (*callback_)(void);
@@ -15,83 +15,137 @@
 
 #include "two_wire.h"
 
+#include <string.h>
+
+static const IRQn_Type kI2cIrqn = SPIM0_SPIS0_TWIM0_TWIS0_SPI0_TWI0_IRQn;
+
+typedef struct {
+  uint8_t address;
+  /* Bytes to write. Points either to `tx_buffer` or to a caller's buffer. */
+  const uint8_t* tx;
+  uint16_t tx_size;
+  uint8_t* rx;
+  uint16_t rx_size;
+  I2cCallback callback;
+  void* user_data;
+  uint8_t tx_buffer[kI2cMaxWriteSize];
+} I2cTransaction;
+
+/* Ring buffer of pending transactions. The main loop appends at the tail, and
+ * the interrupt handler removes from the head. The transaction at the head is
+ * the one in progress while `busy` is true.
+ */
+static I2cTransaction queue[kI2cQueueCapacity];
+static volatile uint8_t queue_head;
+static volatile uint8_t queue_tail;
+static volatile bool busy;
+static volatile bool transfer_error;
+/* Device address for the synchronous functions. */
+static uint8_t default_address;
+
 static volatile uint32_t *pincfg_reg(uint32_t pin) {
   NRF_GPIO_Type *port = nrf_gpio_pin_port_decode(&pin);
   return &port->PIN_CNF[pin];
 }
 
-void i2c_write(uint8_t addr, uint8_t data) {
-  static uint8_t tx_buf[2];
-  NRF_TWIM0->SHORTS = TWIM_SHORTS_LASTTX_STOP_Msk;
+static uint8_t next_index(uint8_t i) {
+  return (i + 1 < kI2cQueueCapacity) ? i + 1 : 0;
+}
 
-  tx_buf[0] = addr;
-  tx_buf[1] = data;
-  NRF_TWIM0->TXD.MAXCNT = sizeof(tx_buf);
-  NRF_TWIM0->TXD.PTR = (uint32_t)&tx_buf[0];
+/* Programs TWIM0 for transaction `t` and starts it. */
+static void start_transaction(const I2cTransaction *t) {
+  NRF_TWIM0->ADDRESS = t->address;
+  NRF_TWIM0->TXD.PTR = (uint32_t)t->tx;
+  NRF_TWIM0->TXD.MAXCNT = t->tx_size;
+  NRF_TWIM0->RXD.PTR = (uint32_t)t->rx;
+  NRF_TWIM0->RXD.MAXCNT = t->rx_size;
 
   NRF_TWIM0->EVENTS_STOPPED = 0;
-  NRF_TWIM0->TASKS_STARTTX = 1;
-  while (NRF_TWIM0->EVENTS_STOPPED == 0) {
+  NRF_TWIM0->EVENTS_ERROR = 0;
+  NRF_TWIM0->ERRORSRC = NRF_TWIM0->ERRORSRC;  /* Clear by writing ones. */
+  transfer_error = false;
+
+  if (t->tx_size == 0) {
+    /* Read only. */
+    NRF_TWIM0->SHORTS = TWIM_SHORTS_LASTRX_STOP_Msk;
+    NRF_TWIM0->TASKS_STARTRX = 1;
+  } else {
+    /* Enable shortcuts that start a read right after the write (if there is
+     * anything to read) and send a stop condition at the end.
+     */
+    NRF_TWIM0->SHORTS = (t->rx_size > 0)
+        ? (TWIM_SHORTS_LASTTX_STARTRX_Msk | TWIM_SHORTS_LASTRX_STOP_Msk)
+        : TWIM_SHORTS_LASTTX_STOP_Msk;
+    NRF_TWIM0->TASKS_STARTTX = 1;
   }
 }
 
-uint8_t i2c_read(uint8_t addr) {
-  /* Arrays are static since the hardware uses them after the function exits. */
-  static uint8_t tx_buf[1];
-  static uint8_t rx_buf[1];
-  /* Enable shortcuts that starts a read right after a write and sends a stop
-   * condition after last TWI read.
-   */
-  NRF_TWIM0->SHORTS =
-      TWIM_SHORTS_LASTTX_STARTRX_Msk | TWIM_SHORTS_LASTRX_STOP_Msk;
-  /* Transmit the address. */
-  tx_buf[0] = addr;
-  NRF_TWIM0->TXD.MAXCNT = sizeof(tx_buf);
-  NRF_TWIM0->TXD.PTR = (uint32_t)&tx_buf[0];
-
-  NRF_TWIM0->RXD.MAXCNT = 1;  /* Max number of bytes per transfer. */
-  NRF_TWIM0->RXD.PTR = (uint32_t)&rx_buf[0];  /* Point to RXD buffer. */
-
-  NRF_TWIM0->EVENTS_STOPPED = 0;
-  NRF_TWIM0->TASKS_STARTTX = 1;
-  while (NRF_TWIM0->EVENTS_STOPPED == 0) {
+/* Copies `t` into the queue and starts it if the bus is idle. */
+static void enqueue(const I2cTransaction *t) {
+  const uint8_t tail = queue_tail;
+  const uint8_t next_tail = next_index(tail);
+  /* If the queue is full, wait for the interrupt handler to drain a slot. */
+  while (next_tail == queue_head) {
   }
 
-  return rx_buf[0];
-}
+  I2cTransaction *slot = &queue[tail];
+  *slot = *t;
+  if (t->tx == t->tx_buffer) {
+    slot->tx = slot->tx_buffer;
+  }
 
-uint8_t *i2c_read_array(uint8_t addr, uint8_t size) {
-  /* Arrays are static since they are used after the function exits. */
-  static uint8_t tx_buf[1];
-  static uint8_t buffer[8];
-  /* Enable shortcuts that starts a read right after a write and sends a stop
-   * condition after last TWI read.
+  /* Mask the interrupt so that the handler doesn't finish the last
+   * transaction between checking `busy` and advancing the tail.
    */
-  NRF_TWIM0->SHORTS =
-      TWIM_SHORTS_LASTTX_STARTRX_Msk | TWIM_SHORTS_LASTRX_STOP_Msk;
+  NVIC_DisableIRQ(kI2cIrqn);
+  queue_tail = next_tail;
+  if (!busy) {
+    busy = true;
+    start_transaction(&queue[queue_head]);
+  }
+  NVIC_EnableIRQ(kI2cIrqn);
+}
 
-  tx_buf[0] = addr;
-  NRF_TWIM0->TXD.MAXCNT = sizeof(tx_buf);
-  NRF_TWIM0->TXD.PTR = (uint32_t)&tx_buf[0];
+void SPIM0_SPIS0_TWIM0_TWIS0_SPI0_TWI0_IRQHandler(void) {
+  if (NRF_TWIM0->EVENTS_ERROR) {
+    /* E.g. the device did not acknowledge. Stop the transfer, which generates
+     * the STOPPED event below.
+     */
+    NRF_TWIM0->EVENTS_ERROR = 0;
+    transfer_error = true;
+    NRF_TWIM0->TASKS_STOP = 1;
+  }
 
-  /* Load the data pointer into the TWI registers. */
-  NRF_TWIM0->RXD.MAXCNT = size; /* Max number of bytes per transfer. */
-  NRF_TWIM0->RXD.PTR = (uint32_t)&buffer; /* Point to RXD buffer. */
+  if (NRF_TWIM0->EVENTS_STOPPED) {
+    NRF_TWIM0->EVENTS_STOPPED = 0;
+    /* Copy what we need from the finished transaction before its slot can be
+     * reused, since the callback may enqueue more transactions.
+     */
+    const I2cTransaction *t = &queue[queue_head];
+    const I2cCallback callback = t->callback;
+    void *user_data = t->user_data;
+    const bool success = !transfer_error;
 
-  /* Start read sequence. Note that it uses starttx, not start RX. */
-  NRF_TWIM0->EVENTS_STOPPED = 0;
-  NRF_TWIM0->TASKS_STARTTX = 1;
+    const uint8_t head = next_index(queue_head);
+    queue_head = head;
+    if (head != queue_tail) {
+      start_transaction(&queue[head]);
+    } else {
+      busy = false;
+    }
 
-  /* Wait for the device to finish up. Currently, there is no time out so this
-   * can go forever if somthing is wrong.
-   */
-  while (NRF_TWIM0->EVENTS_STOPPED == 0) {
+    if (callback) {
+      callback(user_data, success);
+    }
   }
-
-  return buffer;
 }
 
 void i2c_init(uint8_t scl, uint8_t sda, uint8_t device_addr) {
+  /* Let pending transactions finish before reconfiguring. */
+  i2c_wait_idle();
+  NVIC_DisableIRQ(kI2cIrqn);
+  NRF_TWIM0->ENABLE = TWIM_ENABLE_ENABLE_Disabled << TWIM_ENABLE_ENABLE_Pos;
+
   *pincfg_reg(scl) =
       ((uint32_t)GPIO_PIN_CNF_DIR_Input << GPIO_PIN_CNF_DIR_Pos) |
       ((uint32_t)GPIO_PIN_CNF_INPUT_Connect << GPIO_PIN_CNF_INPUT_Pos) |
@@ -109,22 +163,109 @@ void i2c_init(uint8_t scl, uint8_t sda, uint8_t device_addr) {
   NRF_TWIM0->PSEL.SCL = scl;
   NRF_TWIM0->PSEL.SDA = sda;
 
+  default_address = device_addr;
   NRF_TWIM0->ADDRESS = device_addr;
   NRF_TWIM0->FREQUENCY = TWIM_FREQUENCY_FREQUENCY_K400
                          << TWIM_FREQUENCY_FREQUENCY_Pos;
   NRF_TWIM0->SHORTS = 0;
 
+  /* Interrupt on STOPPED, when a transaction completes, and on ERROR. */
+  NRF_TWIM0->INTENCLR = 0xffffffff;
+  NRF_TWIM0->INTENSET = TWIM_INTENSET_STOPPED_Msk | TWIM_INTENSET_ERROR_Msk;
+  queue_head = 0;
+  queue_tail = 0;
+  busy = false;
+
+  NVIC_ClearPendingIRQ(kI2cIrqn);
+  NVIC_SetPriority(kI2cIrqn, kI2cIrqPriority);
+  NVIC_EnableIRQ(kI2cIrqn);
+
   NRF_TWIM0->ENABLE = TWIM_ENABLE_ENABLE_Enabled << TWIM_ENABLE_ENABLE_Pos;
 }
 
-void i2c_write_array(const uint8_t *data, uint16_t size) {
-  NRF_TWIM0->SHORTS = TWIM_SHORTS_LASTTX_STOP_Msk;
+void i2c_transfer_async(uint8_t address, const uint8_t *tx, uint16_t tx_size,
+                        uint8_t *rx, uint16_t rx_size, I2cCallback callback,
+                        void *user_data) {
+  I2cTransaction t;
+  t.address = address;
+  t.tx = tx;
+  t.tx_size = tx_size;
+  t.rx = rx;
+  t.rx_size = rx_size;
+  t.callback = callback;
+  t.user_data = user_data;
+  enqueue(&t);
+}
 
-  NRF_TWIM0->TXD.MAXCNT = size;
-  NRF_TWIM0->TXD.PTR = (uint32_t)data;
+void i2c_write_registers_async(uint8_t address, uint8_t first_register,
+                               const uint8_t *data, uint8_t size,
+                               I2cCallback callback, void *user_data) {
+  I2cTransaction t;
+  if (size > kI2cMaxWriteSize - 1) {
+    size = kI2cMaxWriteSize - 1;
+  }
+  t.address = address;
+  t.tx_buffer[0] = first_register;
+  memcpy(t.tx_buffer + 1, data, size);
+  t.tx = t.tx_buffer;
+  t.tx_size = 1 + size;
+  t.rx = NULL;
+  t.rx_size = 0;
+  t.callback = callback;
+  t.user_data = user_data;
+  enqueue(&t);
+}
 
-  NRF_TWIM0->EVENTS_STOPPED = 0;
-  NRF_TWIM0->TASKS_STARTTX = 1;
-  while (NRF_TWIM0->EVENTS_STOPPED == 0) {
+void i2c_read_registers_async(uint8_t address, uint8_t first_register,
+                              uint8_t *rx, uint8_t size, I2cCallback callback,
+                              void *user_data) {
+  I2cTransaction t;
+  t.address = address;
+  t.tx_buffer[0] = first_register;
+  t.tx = t.tx_buffer;
+  t.tx_size = 1;
+  t.rx = rx;
+  t.rx_size = size;
+  t.callback = callback;
+  t.user_data = user_data;
+  enqueue(&t);
+}
+
+bool i2c_is_idle(void) { return !busy; }
+
+void i2c_wait_idle(void) {
+  /* Currently, there is no time out so this can go forever if something is
+   * wrong.
+   */
+  while (busy) {
   }
 }
+
+void i2c_write(uint8_t addr, uint8_t data) {
+  i2c_write_registers_async(default_address, addr, &data, 1, NULL, NULL);
+  i2c_wait_idle();
+}
+
+uint8_t i2c_read(uint8_t addr) {
+  /* Static since the hardware uses it after the function exits. */
+  static uint8_t rx_buf[1];
+  i2c_read_registers_async(default_address, addr, rx_buf, 1, NULL, NULL);
+  i2c_wait_idle();
+  return rx_buf[0];
+}
+
+uint8_t *i2c_read_array(uint8_t addr, uint8_t size) {
+  /* Static since it is used after the function exits. */
+  static uint8_t buffer[8];
+  if (size > sizeof(buffer)) {
+    size = sizeof(buffer);
+  }
+  i2c_read_registers_async(default_address, addr, buffer, size, NULL, NULL);
+  i2c_wait_idle();
+  return buffer;
+}
+
+void i2c_write_array(const uint8_t *data, uint16_t size) {
+  i2c_transfer_async(default_address, data, size, NULL, 0, NULL, NULL);
+  i2c_wait_idle();
+}
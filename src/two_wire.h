@@ -16,10 +16,38 @@
  * Hardware level (registers) library for the I2C controller.
  *
  * The I2C controller is also called TWIM in nRF. It is mostly intended to
- * communicate with chips (e.g. IMU, sensors). This is a simple library so it
- * does not implement callbacks and peripheral functionality. A nice thing is
- * that it does not have any dependencies. The module is described here:
+ * communicate with chips (e.g. IMU, sensors). A nice thing is that it does not
+ * have any dependencies. The module is described here:
  * https://infocenter.nordicsemi.com/index.jsp?topic=%2Fcom.nordic.infocenter.nrf52832.ps.v1.1%2Ftwim.html
+ *
+ * Transfers go through an interrupt-driven transaction queue. Each transaction
+ * is a write, a read, or a write followed by a repeated-start read, to any
+ * device address on the bus. EasyDMA runs the transfer and the TWIM interrupt
+ * starts the next queued transaction, so the CPU is free during transfers. At
+ * 400 kHz, each byte takes about 23 us on the bus, so e.g. updating all 12
+ * LP5012 LEDs with separate register writes stalls about 1 ms when done
+ * synchronously.
+ *
+ * The `*_async` functions enqueue a transaction and return immediately. An
+ * optional callback is called from the interrupt handler when the transaction
+ * completes, with `success` false if the device did not acknowledge. Since it
+ * runs in interrupt context, the callback should be short. It may enqueue
+ * further transactions. If the queue is full, enqueueing blocks until a slot
+ * frees, so don't enqueue from an interrupt of higher priority than
+ * kI2cIrqPriority.
+ *
+ * Register writes are copied into the queue, so the caller's buffer may be
+ * reused immediately. Auto-increment register writes of several bytes are sent
+ * as one transfer, which saves the address and register bytes and interrupt
+ * overhead of separate writes. Read destinations must stay valid until the
+ * transaction completes.
+ *
+ * The synchronous functions i2c_write(), i2c_read(), etc. are implemented on
+ * the queue and wait for completion. They use the device address set by
+ * i2c_init().
+ *
+ * NOTE: This module defines the TWIM0 interrupt handler, so it cannot be used
+ * together with another driver of TWIM0, like the Arduino Wire library.
  */
 
 #ifndef AUDIO_TO_TACTILE_SRC_TWO_WIRE_H_
@@ -35,12 +63,59 @@
 extern "C" {
 #endif
 
+enum {
+  /* Max number of pending transactions. */
+  kI2cQueueCapacity = 16,
+  /* Max bytes in a transaction written with i2c_write_registers_async(),
+   * including the register address byte.
+   */
+  kI2cMaxWriteSize = 16,
+  kI2cIrqPriority = 7,  /* Lowest priority. */
+};
+
+/* Callback for when a transaction completes. `success` is false on error, e.g.
+ * if the device did not acknowledge.
+ */
+typedef void (*I2cCallback)(void* user_data, bool success);
+
 /* Start the I2C bus. The address to which i2c communicates
- * is specified here, and automatically used in read/write.
+ * is specified here, and automatically used in the synchronous read/write
+ * functions. If the bus is already running, this waits for pending
+ * transactions to complete before reconfiguring.
  */
 void i2c_init(uint8_t scl_pin, uint8_t sda_pin,
               uint8_t i2c_peripheral_device_address);
 
+/* Enqueues a transaction to device `address`, writing `tx_size` bytes from `tx`
+ * then reading `rx_size` bytes into `rx`. Either size may be zero. `tx` and
+ * `rx` must be in RAM and stay valid until the transaction completes.
+ * `callback` may be NULL.
+ */
+void i2c_transfer_async(uint8_t address, const uint8_t* tx, uint16_t tx_size,
+                        uint8_t* rx, uint16_t rx_size, I2cCallback callback,
+                        void* user_data);
+
+/* Enqueues a write of `size` bytes to consecutive registers starting at
+ * `first_register`, for devices that auto increment the register address.
+ * `data` is copied, and `size` must be at most kI2cMaxWriteSize - 1.
+ */
+void i2c_write_registers_async(uint8_t address, uint8_t first_register,
+                               const uint8_t* data, uint8_t size,
+                               I2cCallback callback, void* user_data);
+
+/* Enqueues a read of `size` bytes from registers starting at
+ * `first_register` into `rx`.
+ */
+void i2c_read_registers_async(uint8_t address, uint8_t first_register,
+                              uint8_t* rx, uint8_t size, I2cCallback callback,
+                              void* user_data);
+
+/* Returns true if no transactions are pending. */
+bool i2c_is_idle(void);
+
+/* Waits until all pending transactions have completed. */
+void i2c_wait_idle(void);
+
 /* Write a byte to a specific address. */
 void i2c_write(uint8_t register_to_write, uint8_t data_to_write);
 